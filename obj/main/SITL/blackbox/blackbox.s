@@ -0,0 +1,31214 @@
+	.file	"blackbox.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 7 "./src/main/common/time.h"
+	.file 8 "./src/main/config/parameter_group.h"
+	.file 9 "./src/main/blackbox/blackbox.h"
+	.file 10 "./src/main/blackbox/blackbox_compress.h"
+	.file 11 "./src/main/blackbox/blackbox_io.h"
+	.file 12 "./src/main/build/debug.h"
+	.file 13 "./src/main/build/version.h"
+	.file 14 "./src/main/config/feature.h"
+	.file 15 "./src/main/drivers/io_types.h"
+	.file 16 "./src/main/drivers/bus_i2c.h"
+	.file 17 "./src/main/drivers/bus.h"
+	.file 18 "./src/main/drivers/sensor.h"
+	.file 19 "./src/main/drivers/accgyro/accgyro.h"
+	.file 20 "./src/main/drivers/resource.h"
+	.file 21 "./src/main/drivers/serial.h"
+	.file 22 "./src/main/fc/config.h"
+	.file 23 "./src/main/flight/pid.h"
+	.file 24 "./src/main/fc/controlrate_profile.h"
+	.file 25 "./src/main/fc/rc_controls.h"
+	.file 26 "./src/main/fc/rc_modes.h"
+	.file 27 "./src/main/fc/runtime_config.h"
+	.file 28 "./src/main/flight/failsafe.h"
+	.file 29 "./src/main/flight/imu.h"
+	.file 30 "./src/main/drivers/pwm_output.h"
+	.file 31 "./src/main/flight/mixer.h"
+	.file 32 "./src/main/flight/navigation.h"
+	.file 33 "./src/main/flight/servos.h"
+	.file 34 "./src/main/io/beeper.h"
+	.file 35 "./src/main/io/gps.h"
+	.file 36 "./src/main/io/serial.h"
+	.file 37 "./src/main/rx/rx.h"
+	.file 38 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 42 "./src/main/sensors/sensors.h"
+	.file 43 "./src/main/sensors/acceleration.h"
+	.file 44 "./src/main/drivers/barometer/barometer.h"
+	.file 45 "./src/main/sensors/barometer.h"
+	.file 46 "./src/main/sensors/current.h"
+	.file 47 "./src/main/sensors/voltage.h"
+	.file 48 "./src/main/sensors/battery.h"
+	.file 49 "./src/main/sensors/compass.h"
+	.file 50 "./src/main/sensors/gyro.h"
+	.file 51 "./src/main/blackbox/blackbox.c"
+	.file 52 "/usr/include/string.h"
+	.file 53 "./src/main/common/encoding.h"
+	.file 54 "./src/main/blackbox/blackbox_encoding.h"
+	.file 55 "./src/main/common/maths.h"
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 57 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox.c.efb5f9c7
+	.weak	blackbox.c.efb5f9c7
+blackbox.c.efb5f9c7:
+	.long	0x41f7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x37
+	.long	.LASF3540
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2362
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2363
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2364
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2365
+	.uleb128 0x4
+	.long	.LASF2367
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2366
+	.uleb128 0x4
+	.long	.LASF2368
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2369
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2370
+	.uleb128 0x4
+	.long	.LASF2371
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2372
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.long	0x88
+	.uleb128 0x4
+	.long	.LASF2373
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2374
+	.uleb128 0x39
+	.byte	0x8
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2375
+	.uleb128 0xb
+	.long	0xa9
+	.uleb128 0x4
+	.long	.LASF2376
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF2377
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0xb
+	.long	0xc1
+	.uleb128 0x4
+	.long	.LASF2378
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0xb
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF2379
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xb
+	.long	0xe3
+	.uleb128 0x3a
+	.long	0xe3
+	.uleb128 0x4
+	.long	.LASF2380
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xb
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2381
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0xb
+	.long	0x10a
+	.uleb128 0x4
+	.long	.LASF2382
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.long	0xb0
+	.uleb128 0xb
+	.long	0x127
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2383
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2384
+	.uleb128 0x29
+	.long	.LASF2932
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0x10a
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x5
+	.byte	0xd4
+	.byte	0x9
+	.long	0x162
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0x5
+	.byte	0xd6
+	.byte	0xb
+	.long	0xa7
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2385
+	.byte	0x5
+	.byte	0xd7
+	.byte	0x3
+	.long	0x14b
+	.uleb128 0xd
+	.long	0x131
+	.long	0x17e
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2411
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x225
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x16
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2411
+	.byte	0x6
+	.byte	0x34
+	.byte	0x3
+	.long	0x17e
+	.uleb128 0x1a
+	.long	.LASF2412
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x36
+	.long	0x290
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0xc
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2426
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x60
+	.long	0x2d7
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0xb
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2436
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x6c
+	.long	0x2f4
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2439
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x71
+	.long	0x323
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2439
+	.byte	0x6
+	.byte	0x77
+	.byte	0x3
+	.long	0x2f4
+	.uleb128 0x8
+	.long	.LASF2448
+	.byte	0x4
+	.byte	0x6
+	.byte	0x79
+	.byte	0x10
+	.long	0x34a
+	.uleb128 0x2
+	.long	.LASF2446
+	.byte	0x6
+	.byte	0x7a
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2447
+	.byte	0x6
+	.byte	0x7b
+	.byte	0x3
+	.long	0x32f
+	.uleb128 0x8
+	.long	.LASF2449
+	.byte	0x8
+	.byte	0x6
+	.byte	0x7d
+	.byte	0x10
+	.long	0x37e
+	.uleb128 0x2
+	.long	.LASF2450
+	.byte	0x6
+	.byte	0x7e
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0x6
+	.byte	0x7f
+	.byte	0xe
+	.long	0x10a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2452
+	.byte	0x6
+	.byte	0x80
+	.byte	0x3
+	.long	0x356
+	.uleb128 0x8
+	.long	.LASF2453
+	.byte	0xc
+	.byte	0x6
+	.byte	0x82
+	.byte	0x10
+	.long	0x3cc
+	.uleb128 0x2
+	.long	.LASF2454
+	.byte	0x6
+	.byte	0x83
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2455
+	.byte	0x6
+	.byte	0x84
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2456
+	.byte	0x6
+	.byte	0x85
+	.byte	0xd
+	.long	0xd2
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2457
+	.byte	0x6
+	.byte	0x86
+	.byte	0xb
+	.long	0x131
+	.byte	0x8
+	.byte	0
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2458
+	.uleb128 0x4
+	.long	.LASF2459
+	.byte	0x6
+	.byte	0x87
+	.byte	0x3
+	.long	0x38a
+	.uleb128 0x8
+	.long	.LASF2460
+	.byte	0x8
+	.byte	0x6
+	.byte	0x89
+	.byte	0x10
+	.long	0x407
+	.uleb128 0x2
+	.long	.LASF2461
+	.byte	0x6
+	.byte	0x8a
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2462
+	.byte	0x6
+	.byte	0x8b
+	.byte	0xe
+	.long	0x10a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2463
+	.byte	0x6
+	.byte	0x8c
+	.byte	0x3
+	.long	0x3df
+	.uleb128 0x8
+	.long	.LASF2464
+	.byte	0xc
+	.byte	0x6
+	.byte	0x90
+	.byte	0x10
+	.long	0x448
+	.uleb128 0x2
+	.long	.LASF2465
+	.byte	0x6
+	.byte	0x91
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2466
+	.byte	0x6
+	.byte	0x92
+	.byte	0xd
+	.long	0xd2
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0x6
+	.byte	0x93
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2468
+	.byte	0x6
+	.byte	0x94
+	.byte	0x3
+	.long	0x413
+	.uleb128 0x23
+	.long	.LASF2577
+	.byte	0xc
+	.byte	0x6
+	.byte	0x96
+	.long	0x49d
+	.uleb128 0x1c
+	.long	.LASF2469
+	.byte	0x6
+	.byte	0x97
+	.byte	0x1f
+	.long	0x34a
+	.uleb128 0x1c
+	.long	.LASF2470
+	.byte	0x6
+	.byte	0x98
+	.byte	0x21
+	.long	0x37e
+	.uleb128 0x1c
+	.long	.LASF2471
+	.byte	0x6
+	.byte	0x99
+	.byte	0x29
+	.long	0x3d3
+	.uleb128 0x1c
+	.long	.LASF2472
+	.byte	0x6
+	.byte	0x9a
+	.byte	0x24
+	.long	0x407
+	.uleb128 0x1c
+	.long	.LASF2473
+	.byte	0x6
+	.byte	0x9b
+	.byte	0x27
+	.long	0x448
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2474
+	.byte	0x6
+	.byte	0x9c
+	.byte	0x3
+	.long	0x454
+	.uleb128 0x4
+	.long	.LASF2475
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x12
+	.long	0x10a
+	.uleb128 0x4
+	.long	.LASF2476
+	.byte	0x7
+	.byte	0x21
+	.byte	0x12
+	.long	0x10a
+	.uleb128 0x4
+	.long	.LASF2477
+	.byte	0x8
+	.byte	0x19
+	.byte	0x12
+	.long	0xf9
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x8
+	.byte	0x21
+	.byte	0xe
+	.long	0x4f5
+	.uleb128 0x13
+	.long	.LASF2478
+	.value	0xfff
+	.uleb128 0x13
+	.long	.LASF2479
+	.value	0xf000
+	.uleb128 0x13
+	.long	.LASF2480
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2482
+	.byte	0x8
+	.byte	0x29
+	.byte	0xf
+	.long	0x501
+	.uleb128 0x1b
+	.long	0x511
+	.uleb128 0x5
+	.long	0xa7
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x2b
+	.byte	0x8
+	.byte	0x8
+	.byte	0x31
+	.byte	0x5
+	.long	0x532
+	.uleb128 0x1e
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x32
+	.byte	0xf
+	.long	0xa7
+	.uleb128 0x1e
+	.string	"fn"
+	.byte	0x8
+	.byte	0x33
+	.byte	0x16
+	.long	0x532
+	.byte	0
+	.uleb128 0x7
+	.long	0x4f5
+	.uleb128 0x8
+	.long	.LASF2483
+	.byte	0x28
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x10
+	.long	0x593
+	.uleb128 0x14
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xb
+	.long	0x4c1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xe
+	.long	0x593
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xe
+	.long	0x593
+	.byte	0x10
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x30
+	.byte	0xf
+	.long	0x598
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0x8
+	.byte	0x34
+	.byte	0x7
+	.long	0x511
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0xe3
+	.uleb128 0x7
+	.long	0x593
+	.uleb128 0x4
+	.long	.LASF2488
+	.byte	0x8
+	.byte	0x35
+	.byte	0x3
+	.long	0x537
+	.uleb128 0xb
+	.long	0x59d
+	.uleb128 0x1a
+	.long	.LASF2489
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x18
+	.long	0x5d1
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2493
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x23
+	.long	0x5fa
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2498
+	.byte	0x9
+	.byte	0x28
+	.byte	0x3
+	.long	0x5d1
+	.uleb128 0x8
+	.long	.LASF2499
+	.byte	0x8
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x10
+	.long	0x67c
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2502
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2503
+	.byte	0x9
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2504
+	.byte	0x9
+	.byte	0x2f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2505
+	.byte	0x9
+	.byte	0x30
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2506
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.long	0xe3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2507
+	.byte	0x9
+	.byte	0x32
+	.byte	0xd
+	.long	0xe3
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2508
+	.byte	0x9
+	.byte	0x33
+	.byte	0x3
+	.long	0x606
+	.uleb128 0xb
+	.long	0x67c
+	.uleb128 0xa
+	.long	.LASF2509
+	.byte	0x9
+	.byte	0x35
+	.byte	0x19
+	.long	0x67c
+	.uleb128 0xa
+	.long	.LASF2510
+	.byte	0x9
+	.byte	0x35
+	.byte	0x48
+	.long	0x67c
+	.uleb128 0x11
+	.long	0x30
+	.byte	0xa
+	.byte	0x26
+	.byte	0xe
+	.long	0x6ca
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2515
+	.byte	0x18
+	.byte	0xa
+	.byte	0x2d
+	.byte	0x10
+	.long	0x6ff
+	.uleb128 0x2
+	.long	.LASF2516
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xd
+	.long	0x6ff
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2517
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xe
+	.long	0x70f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2518
+	.byte	0xa
+	.byte	0x30
+	.byte	0xe
+	.long	0x10a
+	.byte	0x14
+	.byte	0
+	.uleb128 0xd
+	.long	0xd2
+	.long	0x70f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.long	0x10a
+	.long	0x71f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2519
+	.byte	0xa
+	.byte	0x31
+	.byte	0x3
+	.long	0x6ca
+	.uleb128 0x3b
+	.long	.LASF2520
+	.value	0x484
+	.byte	0xa
+	.byte	0x33
+	.byte	0x10
+	.long	0x754
+	.uleb128 0x2
+	.long	.LASF2521
+	.byte	0xa
+	.byte	0x34
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2522
+	.byte	0xa
+	.byte	0x35
+	.byte	0x1d
+	.long	0x754
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0x71f
+	.long	0x764
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2523
+	.byte	0xa
+	.byte	0x36
+	.byte	0x3
+	.long	0x72b
+	.uleb128 0x11
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.byte	0xe
+	.long	0x78f
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2527
+	.byte	0xb
+	.byte	0x18
+	.byte	0x3
+	.long	0x770
+	.uleb128 0xa
+	.long	.LASF2528
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x10
+	.long	0xd2
+	.uleb128 0xa
+	.long	.LASF2529
+	.byte	0xb
+	.byte	0x30
+	.byte	0x11
+	.long	0x593
+	.uleb128 0xa
+	.long	.LASF2530
+	.byte	0xb
+	.byte	0x31
+	.byte	0xc
+	.long	0x88
+	.uleb128 0xa
+	.long	.LASF2531
+	.byte	0xb
+	.byte	0x32
+	.byte	0xc
+	.long	0x88
+	.uleb128 0xd
+	.long	0xc1
+	.long	0x7db
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2532
+	.byte	0xc
+	.byte	0x15
+	.byte	0x10
+	.long	0x7cb
+	.uleb128 0xa
+	.long	.LASF2533
+	.byte	0xc
+	.byte	0x16
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x11
+	.long	0x30
+	.byte	0xc
+	.byte	0x30
+	.byte	0xe
+	.long	0x88a
+	.uleb128 0x1
+	.long	.LASF2534
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2535
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2536
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2538
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x16
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2557
+	.byte	0xd
+	.byte	0x1d
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0xa
+	.long	.LASF2558
+	.byte	0xd
+	.byte	0x20
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0xa
+	.long	.LASF2559
+	.byte	0xd
+	.byte	0x23
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0xa
+	.long	.LASF2560
+	.byte	0xd
+	.byte	0x26
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0xd
+	.long	0x131
+	.long	0x8ca
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2561
+	.byte	0x4
+	.byte	0xe
+	.byte	0x16
+	.byte	0x10
+	.long	0x8e5
+	.uleb128 0x2
+	.long	.LASF2562
+	.byte	0xe
+	.byte	0x17
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2563
+	.byte	0xe
+	.byte	0x18
+	.byte	0x3
+	.long	0x8ca
+	.uleb128 0xb
+	.long	0x8e5
+	.uleb128 0xa
+	.long	.LASF2564
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x18
+	.long	0x8e5
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0xf
+	.byte	0x18
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x4
+	.long	.LASF2566
+	.byte	0xf
+	.byte	0x19
+	.byte	0xf
+	.long	0xa7
+	.uleb128 0x1a
+	.long	.LASF2567
+	.byte	0x5
+	.long	0x88
+	.byte	0x10
+	.byte	0x1e
+	.long	0x949
+	.uleb128 0x3c
+	.long	.LASF2568
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2567
+	.byte	0x10
+	.byte	0x24
+	.byte	0x3
+	.long	0x91a
+	.uleb128 0x8
+	.long	.LASF2573
+	.byte	0x10
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xc
+	.long	0x97d
+	.uleb128 0x2
+	.long	.LASF2574
+	.byte	0x11
+	.byte	0x1b
+	.byte	0x16
+	.long	0x97d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2575
+	.byte	0x11
+	.byte	0x1f
+	.byte	0xe
+	.long	0x90e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x162
+	.uleb128 0x8
+	.long	.LASF2576
+	.byte	0x8
+	.byte	0x11
+	.byte	0x21
+	.byte	0xc
+	.long	0x9aa
+	.uleb128 0x2
+	.long	.LASF2502
+	.byte	0x11
+	.byte	0x22
+	.byte	0x12
+	.long	0x949
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x11
+	.byte	0x23
+	.byte	0x10
+	.long	0xe3
+	.byte	0x4
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2578
+	.byte	0x10
+	.byte	0x11
+	.byte	0x19
+	.long	0x9cf
+	.uleb128 0x1e
+	.string	"spi"
+	.byte	0x11
+	.byte	0x20
+	.byte	0x7
+	.long	0x955
+	.uleb128 0x1e
+	.string	"i2c"
+	.byte	0x11
+	.byte	0x24
+	.byte	0x7
+	.long	0x982
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2579
+	.byte	0x11
+	.byte	0x25
+	.byte	0x3
+	.long	0x9aa
+	.uleb128 0xb
+	.long	0x9cf
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x12
+	.byte	0x17
+	.byte	0xe
+	.long	0xa23
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2589
+	.byte	0x12
+	.byte	0x21
+	.byte	0x3
+	.long	0x9e0
+	.uleb128 0x4
+	.long	.LASF2590
+	.byte	0x12
+	.byte	0x27
+	.byte	0x10
+	.long	0xa3b
+	.uleb128 0x7
+	.long	0xa40
+	.uleb128 0x1b
+	.long	0xa4b
+	.uleb128 0x5
+	.long	0xa4b
+	.byte	0
+	.uleb128 0x7
+	.long	0xa50
+	.uleb128 0x8
+	.long	.LASF2591
+	.byte	0x88
+	.byte	0x13
+	.byte	0x4c
+	.byte	0x10
+	.long	0xaed
+	.uleb128 0x2
+	.long	.LASF2592
+	.byte	0x13
+	.byte	0x4d
+	.byte	0x1a
+	.long	0xa2f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2593
+	.byte	0x13
+	.byte	0x4e
+	.byte	0x1a
+	.long	0xaed
+	.byte	0x8
+	.uleb128 0x14
+	.string	"bus"
+	.byte	0x13
+	.byte	0x4f
+	.byte	0x11
+	.long	0x9cf
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2594
+	.byte	0x13
+	.byte	0x50
+	.byte	0xe
+	.long	0xf9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2595
+	.byte	0x13
+	.byte	0x51
+	.byte	0xd
+	.long	0x1628
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2596
+	.byte	0x13
+	.byte	0x52
+	.byte	0xa
+	.long	0xa9
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2597
+	.byte	0x13
+	.byte	0x53
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2598
+	.byte	0x13
+	.byte	0x55
+	.byte	0x15
+	.long	0x1fdc
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2599
+	.byte	0x13
+	.byte	0x57
+	.byte	0x14
+	.long	0xa23
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2600
+	.byte	0x13
+	.byte	0x58
+	.byte	0x1a
+	.long	0x1edc
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2601
+	.byte	0x13
+	.byte	0x59
+	.byte	0x18
+	.long	0x1e22
+	.byte	0x68
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2602
+	.byte	0x12
+	.byte	0x28
+	.byte	0xf
+	.long	0xaf9
+	.uleb128 0x7
+	.long	0xafe
+	.uleb128 0x1f
+	.long	0x3cc
+	.long	0xb0d
+	.uleb128 0x5
+	.long	0xa4b
+	.byte	0
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x14
+	.byte	0x14
+	.byte	0xe
+	.long	0xc34
+	.uleb128 0x1
+	.long	.LASF2603
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2604
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2605
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2645
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2648
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2649
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2650
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x17
+	.long	0xc57
+	.uleb128 0x1
+	.long	.LASF2651
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2652
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2650
+	.byte	0x15
+	.byte	0x1b
+	.byte	0x3
+	.long	0xc34
+	.uleb128 0x1a
+	.long	.LASF2654
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x1d
+	.long	0xcb0
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2654
+	.byte	0x15
+	.byte	0x30
+	.byte	0x3
+	.long	0xc63
+	.uleb128 0x4
+	.long	.LASF2665
+	.byte	0x15
+	.byte	0x32
+	.byte	0x10
+	.long	0xcc8
+	.uleb128 0x7
+	.long	0xccd
+	.uleb128 0x1b
+	.long	0xcd8
+	.uleb128 0x5
+	.long	0xf9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2666
+	.byte	0x48
+	.byte	0x15
+	.byte	0x34
+	.byte	0x10
+	.long	0xd9c
+	.uleb128 0x2
+	.long	.LASF2667
+	.byte	0x15
+	.byte	0x36
+	.byte	0x24
+	.long	0xe31
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2668
+	.byte	0x15
+	.byte	0x38
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2669
+	.byte	0x15
+	.byte	0x39
+	.byte	0x10
+	.long	0xc57
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2670
+	.byte	0x15
+	.byte	0x3a
+	.byte	0x13
+	.long	0xcb0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2671
+	.byte	0x15
+	.byte	0x3c
+	.byte	0xe
+	.long	0x10a
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2672
+	.byte	0x15
+	.byte	0x3e
+	.byte	0xe
+	.long	0x10a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2673
+	.byte	0x15
+	.byte	0x3f
+	.byte	0xe
+	.long	0x10a
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2674
+	.byte	0x15
+	.byte	0x40
+	.byte	0x17
+	.long	0xe36
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2675
+	.byte	0x15
+	.byte	0x41
+	.byte	0x17
+	.long	0xe36
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2676
+	.byte	0x15
+	.byte	0x42
+	.byte	0xe
+	.long	0x10a
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2677
+	.byte	0x15
+	.byte	0x43
+	.byte	0xe
+	.long	0x10a
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2678
+	.byte	0x15
+	.byte	0x44
+	.byte	0xe
+	.long	0x10a
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2679
+	.byte	0x15
+	.byte	0x45
+	.byte	0xe
+	.long	0x10a
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2680
+	.byte	0x15
+	.byte	0x47
+	.byte	0x1e
+	.long	0xcbc
+	.byte	0x40
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2681
+	.byte	0x50
+	.byte	0x15
+	.byte	0x5c
+	.byte	0x8
+	.long	0xe2c
+	.uleb128 0x2
+	.long	.LASF2682
+	.byte	0x15
+	.byte	0x5d
+	.byte	0xc
+	.long	0xe61
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2683
+	.byte	0x15
+	.byte	0x5f
+	.byte	0x10
+	.long	0xe7a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2684
+	.byte	0x15
+	.byte	0x60
+	.byte	0x10
+	.long	0xe7a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2685
+	.byte	0x15
+	.byte	0x62
+	.byte	0xf
+	.long	0xe8e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2686
+	.byte	0x15
+	.byte	0x65
+	.byte	0xc
+	.long	0xea3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2687
+	.byte	0x15
+	.byte	0x67
+	.byte	0xb
+	.long	0xeb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2688
+	.byte	0x15
+	.byte	0x69
+	.byte	0xc
+	.long	0xecc
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2689
+	.byte	0x15
+	.byte	0x6b
+	.byte	0xc
+	.long	0xeec
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2690
+	.byte	0x15
+	.byte	0x6d
+	.byte	0xc
+	.long	0xefc
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2691
+	.byte	0x15
+	.byte	0x6e
+	.byte	0xc
+	.long	0xefc
+	.byte	0x48
+	.byte	0
+	.uleb128 0xb
+	.long	0xd9c
+	.uleb128 0x7
+	.long	0xe2c
+	.uleb128 0x7
+	.long	0xf4
+	.uleb128 0x4
+	.long	.LASF2692
+	.byte	0x15
+	.byte	0x48
+	.byte	0x3
+	.long	0xcd8
+	.uleb128 0xb
+	.long	0xe3b
+	.uleb128 0x1b
+	.long	0xe5c
+	.uleb128 0x5
+	.long	0xe5c
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x7
+	.long	0xe3b
+	.uleb128 0x7
+	.long	0xe4c
+	.uleb128 0x1f
+	.long	0x10a
+	.long	0xe75
+	.uleb128 0x5
+	.long	0xe75
+	.byte	0
+	.uleb128 0x7
+	.long	0xe47
+	.uleb128 0x7
+	.long	0xe66
+	.uleb128 0x1f
+	.long	0xe3
+	.long	0xe8e
+	.uleb128 0x5
+	.long	0xe5c
+	.byte	0
+	.uleb128 0x7
+	.long	0xe7f
+	.uleb128 0x1b
+	.long	0xea3
+	.uleb128 0x5
+	.long	0xe5c
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x7
+	.long	0xe93
+	.uleb128 0x1f
+	.long	0x3cc
+	.long	0xeb7
+	.uleb128 0x5
+	.long	0xe75
+	.byte	0
+	.uleb128 0x7
+	.long	0xea8
+	.uleb128 0x1b
+	.long	0xecc
+	.uleb128 0x5
+	.long	0xe5c
+	.uleb128 0x5
+	.long	0xc57
+	.byte	0
+	.uleb128 0x7
+	.long	0xebc
+	.uleb128 0x1b
+	.long	0xee6
+	.uleb128 0x5
+	.long	0xe5c
+	.uleb128 0x5
+	.long	0xee6
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x7
+	.long	0xeeb
+	.uleb128 0x3d
+	.uleb128 0x7
+	.long	0xed1
+	.uleb128 0x1b
+	.long	0xefc
+	.uleb128 0x5
+	.long	0xe5c
+	.byte	0
+	.uleb128 0x7
+	.long	0xef1
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x16
+	.byte	0x22
+	.byte	0xe
+	.long	0xfde
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x80
+	.uleb128 0x13
+	.long	.LASF2700
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF2701
+	.value	0x200
+	.uleb128 0x13
+	.long	.LASF2702
+	.value	0x400
+	.uleb128 0x13
+	.long	.LASF2703
+	.value	0x1000
+	.uleb128 0x13
+	.long	.LASF2704
+	.value	0x2000
+	.uleb128 0x13
+	.long	.LASF2705
+	.value	0x4000
+	.uleb128 0x13
+	.long	.LASF2706
+	.value	0x8000
+	.uleb128 0x17
+	.long	.LASF2707
+	.long	0x10000
+	.uleb128 0x17
+	.long	.LASF2708
+	.long	0x20000
+	.uleb128 0x17
+	.long	.LASF2709
+	.long	0x40000
+	.uleb128 0x17
+	.long	.LASF2710
+	.long	0x80000
+	.uleb128 0x17
+	.long	.LASF2711
+	.long	0x100000
+	.uleb128 0x17
+	.long	.LASF2712
+	.long	0x200000
+	.uleb128 0x17
+	.long	.LASF2713
+	.long	0x400000
+	.uleb128 0x17
+	.long	.LASF2714
+	.long	0x800000
+	.uleb128 0x17
+	.long	.LASF2715
+	.long	0x2000000
+	.uleb128 0x17
+	.long	.LASF2716
+	.long	0x4000000
+	.uleb128 0x17
+	.long	.LASF2717
+	.long	0x8000000
+	.uleb128 0x17
+	.long	.LASF2718
+	.long	0x10000000
+	.uleb128 0x17
+	.long	.LASF2719
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2720
+	.byte	0x15
+	.byte	0x16
+	.byte	0x46
+	.byte	0x10
+	.long	0x102d
+	.uleb128 0x2
+	.long	.LASF2721
+	.byte	0x16
+	.byte	0x47
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2722
+	.byte	0x16
+	.byte	0x48
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2723
+	.byte	0x16
+	.byte	0x49
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2724
+	.byte	0x16
+	.byte	0x4a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0x16
+	.byte	0x4e
+	.byte	0xa
+	.long	0x102d
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0xa9
+	.long	0x103d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2726
+	.byte	0x16
+	.byte	0x4f
+	.byte	0x3
+	.long	0xfde
+	.uleb128 0xb
+	.long	0x103d
+	.uleb128 0xa
+	.long	.LASF2727
+	.byte	0x16
+	.byte	0x59
+	.byte	0x17
+	.long	0x103d
+	.uleb128 0x8
+	.long	.LASF2728
+	.byte	0x4c
+	.byte	0x17
+	.byte	0x4a
+	.byte	0x10
+	.long	0x11d4
+	.uleb128 0x14
+	.string	"pid"
+	.byte	0x17
+	.byte	0x4b
+	.byte	0xc
+	.long	0x1912
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2729
+	.byte	0x17
+	.byte	0x4d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2730
+	.byte	0x17
+	.byte	0x4e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2731
+	.byte	0x17
+	.byte	0x4f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2732
+	.byte	0x17
+	.byte	0x50
+	.byte	0xe
+	.long	0xf9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2733
+	.byte	0x17
+	.byte	0x51
+	.byte	0xe
+	.long	0xf9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2734
+	.byte	0x17
+	.byte	0x52
+	.byte	0xd
+	.long	0xe3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2735
+	.byte	0x17
+	.byte	0x53
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2736
+	.byte	0x17
+	.byte	0x54
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2737
+	.byte	0x17
+	.byte	0x55
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2738
+	.byte	0x17
+	.byte	0x56
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2739
+	.byte	0x17
+	.byte	0x57
+	.byte	0xd
+	.long	0xe3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2740
+	.byte	0x17
+	.byte	0x58
+	.byte	0xd
+	.long	0xe3
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2741
+	.byte	0x17
+	.byte	0x59
+	.byte	0xd
+	.long	0xe3
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2742
+	.byte	0x17
+	.byte	0x5b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2743
+	.byte	0x17
+	.byte	0x5c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2744
+	.byte	0x17
+	.byte	0x5f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2745
+	.byte	0x17
+	.byte	0x60
+	.byte	0xe
+	.long	0xf9
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0x17
+	.byte	0x61
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x17
+	.byte	0x62
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2748
+	.byte	0x17
+	.byte	0x63
+	.byte	0xe
+	.long	0xf9
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2749
+	.byte	0x17
+	.byte	0x64
+	.byte	0xe
+	.long	0xf9
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2750
+	.byte	0x17
+	.byte	0x65
+	.byte	0xe
+	.long	0xf9
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2751
+	.byte	0x17
+	.byte	0x66
+	.byte	0xe
+	.long	0xf9
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2752
+	.byte	0x17
+	.byte	0x67
+	.byte	0xe
+	.long	0xf9
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2753
+	.byte	0x17
+	.byte	0x68
+	.byte	0xd
+	.long	0xe3
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2754
+	.byte	0x17
+	.byte	0x69
+	.byte	0xd
+	.long	0xe3
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2755
+	.byte	0x17
+	.byte	0x6a
+	.byte	0x18
+	.long	0x18cb
+	.byte	0x48
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2756
+	.byte	0x16
+	.byte	0x63
+	.byte	0x1d
+	.long	0x11e0
+	.uleb128 0x7
+	.long	0x105a
+	.uleb128 0x8
+	.long	.LASF2757
+	.byte	0xc
+	.byte	0x18
+	.byte	0x19
+	.byte	0x10
+	.long	0x1268
+	.uleb128 0x2
+	.long	.LASF2758
+	.byte	0x18
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2759
+	.byte	0x18
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2760
+	.byte	0x18
+	.byte	0x1c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2761
+	.byte	0x18
+	.byte	0x1d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2762
+	.byte	0x18
+	.byte	0x1e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2763
+	.byte	0x18
+	.byte	0x1f
+	.byte	0xd
+	.long	0x1268
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2764
+	.byte	0x18
+	.byte	0x20
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2765
+	.byte	0x18
+	.byte	0x21
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2766
+	.byte	0x18
+	.byte	0x22
+	.byte	0xe
+	.long	0xf9
+	.byte	0xa
+	.byte	0
+	.uleb128 0xd
+	.long	0xe3
+	.long	0x1278
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2767
+	.byte	0x18
+	.byte	0x23
+	.byte	0x3
+	.long	0x11e5
+	.uleb128 0xb
+	.long	0x1278
+	.uleb128 0xd
+	.long	0x1278
+	.long	0x1299
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2768
+	.byte	0x18
+	.byte	0x26
+	.byte	0x1c
+	.long	0x1289
+	.uleb128 0x1a
+	.long	.LASF2769
+	.byte	0x7
+	.long	0x30
+	.byte	0x19
+	.byte	0x18
+	.long	0x12fe
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x1
+	.uleb128 0x3e
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2780
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2781
+	.byte	0x19
+	.byte	0x4f
+	.byte	0xe
+	.long	0x16e
+	.uleb128 0x8
+	.long	.LASF2782
+	.byte	0x5
+	.byte	0x19
+	.byte	0x51
+	.byte	0x10
+	.long	0x1359
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0x19
+	.byte	0x52
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0x19
+	.byte	0x53
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0x19
+	.byte	0x54
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2786
+	.byte	0x19
+	.byte	0x55
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2787
+	.byte	0x19
+	.byte	0x56
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2788
+	.byte	0x19
+	.byte	0x57
+	.byte	0x3
+	.long	0x130a
+	.uleb128 0xb
+	.long	0x1359
+	.uleb128 0xa
+	.long	.LASF2789
+	.byte	0x19
+	.byte	0x59
+	.byte	0x1b
+	.long	0x1359
+	.uleb128 0x8
+	.long	.LASF2790
+	.byte	0x8
+	.byte	0x19
+	.byte	0x5b
+	.byte	0x10
+	.long	0x13b8
+	.uleb128 0x2
+	.long	.LASF2791
+	.byte	0x19
+	.byte	0x5c
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2792
+	.byte	0x19
+	.byte	0x5d
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2793
+	.byte	0x19
+	.byte	0x5e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2794
+	.byte	0x19
+	.byte	0x5f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2795
+	.byte	0x19
+	.byte	0x60
+	.byte	0x3
+	.long	0x1376
+	.uleb128 0xb
+	.long	0x13b8
+	.uleb128 0xa
+	.long	.LASF2796
+	.byte	0x19
+	.byte	0x62
+	.byte	0x19
+	.long	0x13b8
+	.uleb128 0x8
+	.long	.LASF2797
+	.byte	0x3
+	.byte	0x19
+	.byte	0x64
+	.byte	0x10
+	.long	0x140a
+	.uleb128 0x2
+	.long	.LASF2798
+	.byte	0x19
+	.byte	0x65
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2799
+	.byte	0x19
+	.byte	0x66
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2800
+	.byte	0x19
+	.byte	0x67
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2801
+	.byte	0x19
+	.byte	0x68
+	.byte	0x3
+	.long	0x13d5
+	.uleb128 0xb
+	.long	0x140a
+	.uleb128 0xa
+	.long	.LASF2802
+	.byte	0x19
+	.byte	0x6a
+	.byte	0x17
+	.long	0x140a
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x1a
+	.byte	0x18
+	.byte	0xe
+	.long	0x1518
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x25
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2841
+	.byte	0x1a
+	.byte	0x3f
+	.byte	0x3
+	.long	0x1427
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x42
+	.byte	0x9
+	.long	0x153b
+	.uleb128 0x2
+	.long	.LASF2842
+	.byte	0x1a
+	.byte	0x42
+	.byte	0x1b
+	.long	0x153b
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x10a
+	.long	0x154b
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2843
+	.byte	0x1a
+	.byte	0x42
+	.byte	0x44
+	.long	0x1524
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x1b
+	.byte	0x15
+	.byte	0xe
+	.long	0x1570
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2846
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xa
+	.long	.LASF2847
+	.byte	0x1b
+	.byte	0x64
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x1c
+	.byte	0x2b
+	.byte	0xe
+	.long	0x15b9
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2849
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2852
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2853
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2854
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x3
+	.long	0x1588
+	.uleb128 0xd
+	.long	0xd2
+	.long	0x15d5
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x22
+	.byte	0x5
+	.long	0x1606
+	.uleb128 0x2
+	.long	.LASF2855
+	.byte	0x1d
+	.byte	0x24
+	.byte	0x11
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2856
+	.byte	0x1d
+	.byte	0x25
+	.byte	0x11
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x14
+	.string	"yaw"
+	.byte	0x1d
+	.byte	0x26
+	.byte	0x11
+	.long	0xc1
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2b
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x20
+	.byte	0x9
+	.long	0x1628
+	.uleb128 0x1e
+	.string	"raw"
+	.byte	0x1d
+	.byte	0x21
+	.byte	0xd
+	.long	0x1628
+	.uleb128 0x1c
+	.long	.LASF2857
+	.byte	0x1d
+	.byte	0x27
+	.byte	0x7
+	.long	0x15d5
+	.byte	0
+	.uleb128 0xd
+	.long	0xc1
+	.long	0x1638
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2858
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x3
+	.long	0x1606
+	.uleb128 0xa
+	.long	.LASF2859
+	.byte	0x1d
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x1638
+	.uleb128 0x8
+	.long	.LASF2860
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x8e
+	.byte	0x10
+	.long	0x169f
+	.uleb128 0x2
+	.long	.LASF2861
+	.byte	0x1e
+	.byte	0x8f
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2862
+	.byte	0x1e
+	.byte	0x90
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2863
+	.byte	0x1e
+	.byte	0x91
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2864
+	.byte	0x1e
+	.byte	0x92
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2865
+	.byte	0x1e
+	.byte	0x93
+	.byte	0xd
+	.long	0x169f
+	.byte	0x5
+	.byte	0
+	.uleb128 0xd
+	.long	0x902
+	.long	0x16af
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2866
+	.byte	0x1e
+	.byte	0x94
+	.byte	0x3
+	.long	0x1650
+	.uleb128 0x1a
+	.long	.LASF2867
+	.byte	0x7
+	.long	0x30
+	.byte	0x1f
+	.byte	0x24
+	.long	0x1768
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2874
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2875
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2876
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2894
+	.byte	0x2
+	.byte	0x1f
+	.byte	0x53
+	.byte	0x10
+	.long	0x1790
+	.uleb128 0x2
+	.long	.LASF2867
+	.byte	0x1f
+	.byte	0x54
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2895
+	.byte	0x1f
+	.byte	0x55
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2896
+	.byte	0x1f
+	.byte	0x56
+	.byte	0x3
+	.long	0x1768
+	.uleb128 0xb
+	.long	0x1790
+	.uleb128 0xa
+	.long	.LASF2897
+	.byte	0x1f
+	.byte	0x58
+	.byte	0x16
+	.long	0x1790
+	.uleb128 0x8
+	.long	.LASF2898
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0x5a
+	.byte	0x10
+	.long	0x17fc
+	.uleb128 0x14
+	.string	"dev"
+	.byte	0x1f
+	.byte	0x5b
+	.byte	0x16
+	.long	0x16af
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2899
+	.byte	0x1f
+	.byte	0x5c
+	.byte	0xe
+	.long	0xf9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2900
+	.byte	0x1f
+	.byte	0x5d
+	.byte	0xe
+	.long	0xf9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2901
+	.byte	0x1f
+	.byte	0x5e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2902
+	.byte	0x1f
+	.byte	0x5f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2903
+	.byte	0x1f
+	.byte	0x60
+	.byte	0x3
+	.long	0x17ad
+	.uleb128 0xb
+	.long	0x17fc
+	.uleb128 0xa
+	.long	.LASF2904
+	.byte	0x1f
+	.byte	0x62
+	.byte	0x16
+	.long	0x17fc
+	.uleb128 0xd
+	.long	0x131
+	.long	0x1829
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2905
+	.byte	0x1f
+	.byte	0x69
+	.byte	0xe
+	.long	0x1819
+	.uleb128 0xa
+	.long	.LASF2906
+	.byte	0x1f
+	.byte	0x6a
+	.byte	0xe
+	.long	0x1819
+	.uleb128 0xd
+	.long	0xc1
+	.long	0x1851
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2907
+	.byte	0x20
+	.byte	0x2d
+	.byte	0x10
+	.long	0x6ff
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x17
+	.byte	0x25
+	.byte	0xe
+	.long	0x18ac
+	.uleb128 0x1
+	.long	.LASF2908
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2909
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2910
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2911
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2912
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2914
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2915
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2916
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2917
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2918
+	.byte	0xa
+	.byte	0
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xe
+	.long	0x18cb
+	.uleb128 0x1
+	.long	.LASF2919
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2920
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2921
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2922
+	.byte	0x17
+	.byte	0x42
+	.byte	0x3
+	.long	0x18ac
+	.uleb128 0x8
+	.long	.LASF2923
+	.byte	0x3
+	.byte	0x17
+	.byte	0x44
+	.byte	0x10
+	.long	0x1906
+	.uleb128 0x14
+	.string	"P"
+	.byte	0x17
+	.byte	0x45
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x14
+	.string	"I"
+	.byte	0x17
+	.byte	0x46
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x14
+	.string	"D"
+	.byte	0x17
+	.byte	0x47
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2924
+	.byte	0x17
+	.byte	0x48
+	.byte	0x3
+	.long	0x18d7
+	.uleb128 0xd
+	.long	0x1906
+	.long	0x1922
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2925
+	.byte	0x1
+	.byte	0x17
+	.byte	0x6f
+	.byte	0x10
+	.long	0x193d
+	.uleb128 0x2
+	.long	.LASF2926
+	.byte	0x17
+	.byte	0x70
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2927
+	.byte	0x17
+	.byte	0x71
+	.byte	0x3
+	.long	0x1922
+	.uleb128 0xb
+	.long	0x193d
+	.uleb128 0xa
+	.long	.LASF2928
+	.byte	0x17
+	.byte	0x73
+	.byte	0x14
+	.long	0x193d
+	.uleb128 0xa
+	.long	.LASF2929
+	.byte	0x17
+	.byte	0x78
+	.byte	0xe
+	.long	0x8ba
+	.uleb128 0xa
+	.long	.LASF2930
+	.byte	0x17
+	.byte	0x78
+	.byte	0x1c
+	.long	0x8ba
+	.uleb128 0xa
+	.long	.LASF2931
+	.byte	0x17
+	.byte	0x78
+	.byte	0x2a
+	.long	0x8ba
+	.uleb128 0x29
+	.long	.LASF2933
+	.byte	0x17
+	.byte	0x79
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x21
+	.byte	0x19
+	.byte	0x6
+	.long	0x19f1
+	.uleb128 0x1
+	.long	.LASF2934
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2937
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2938
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2939
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2940
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2941
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2942
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2943
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2944
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2945
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2946
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2947
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2948
+	.byte	0xe
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2949
+	.byte	0x21
+	.byte	0x29
+	.byte	0x3
+	.long	0x198a
+	.uleb128 0xd
+	.long	0xc1
+	.long	0x1a0d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2950
+	.byte	0x21
+	.byte	0x7e
+	.byte	0x10
+	.long	0x19fd
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x22
+	.byte	0x17
+	.byte	0xe
+	.long	0x1aaa
+	.uleb128 0x1
+	.long	.LASF2951
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2952
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2953
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2954
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2955
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2956
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2957
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2958
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2959
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2960
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2961
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2962
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2963
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2964
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2965
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2966
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2967
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2968
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2969
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2970
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2971
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2972
+	.byte	0x15
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2973
+	.byte	0x22
+	.byte	0x31
+	.byte	0x3
+	.long	0x1a19
+	.uleb128 0x8
+	.long	.LASF2974
+	.byte	0xc
+	.byte	0x23
+	.byte	0x4f
+	.byte	0x10
+	.long	0x1aeb
+	.uleb128 0x14
+	.string	"lat"
+	.byte	0x23
+	.byte	0x50
+	.byte	0xd
+	.long	0xd2
+	.byte	0
+	.uleb128 0x14
+	.string	"lon"
+	.byte	0x23
+	.byte	0x51
+	.byte	0xd
+	.long	0xd2
+	.byte	0x4
+	.uleb128 0x14
+	.string	"alt"
+	.byte	0x23
+	.byte	0x52
+	.byte	0xe
+	.long	0xf9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2975
+	.byte	0x23
+	.byte	0x53
+	.byte	0x3
+	.long	0x1ab6
+	.uleb128 0x8
+	.long	.LASF2976
+	.byte	0x18
+	.byte	0x23
+	.byte	0x55
+	.byte	0x10
+	.long	0x1b53
+	.uleb128 0x2
+	.long	.LASF2977
+	.byte	0x23
+	.byte	0x56
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x14
+	.string	"llh"
+	.byte	0x23
+	.byte	0x57
+	.byte	0x13
+	.long	0x1aeb
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2978
+	.byte	0x23
+	.byte	0x58
+	.byte	0xe
+	.long	0xf9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2979
+	.byte	0x23
+	.byte	0x59
+	.byte	0xe
+	.long	0xf9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2980
+	.byte	0x23
+	.byte	0x5a
+	.byte	0xe
+	.long	0xf9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2981
+	.byte	0x23
+	.byte	0x5b
+	.byte	0xe
+	.long	0xf9
+	.byte	0x16
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2982
+	.byte	0x23
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1af7
+	.uleb128 0xa
+	.long	.LASF2983
+	.byte	0x23
+	.byte	0x76
+	.byte	0x1a
+	.long	0x1b53
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x24
+	.byte	0x20
+	.byte	0xe
+	.long	0x1bd8
+	.uleb128 0x1
+	.long	.LASF2984
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2985
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2986
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2987
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2988
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2989
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2990
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2991
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2992
+	.byte	0x80
+	.uleb128 0x13
+	.long	.LASF2993
+	.value	0x200
+	.uleb128 0x13
+	.long	.LASF2994
+	.value	0x400
+	.uleb128 0x13
+	.long	.LASF2995
+	.value	0x800
+	.uleb128 0x13
+	.long	.LASF2996
+	.value	0x1000
+	.uleb128 0x13
+	.long	.LASF2997
+	.value	0x2000
+	.uleb128 0x13
+	.long	.LASF2998
+	.value	0x4000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2999
+	.byte	0x24
+	.byte	0x30
+	.byte	0x3
+	.long	0x1b6b
+	.uleb128 0xa
+	.long	.LASF3000
+	.byte	0x25
+	.byte	0x4b
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x8
+	.long	.LASF3001
+	.byte	0x2c
+	.byte	0x25
+	.byte	0x75
+	.byte	0x10
+	.long	0x1d43
+	.uleb128 0x2
+	.long	.LASF3002
+	.byte	0x25
+	.byte	0x76
+	.byte	0xd
+	.long	0x1d43
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3003
+	.byte	0x25
+	.byte	0x77
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3004
+	.byte	0x25
+	.byte	0x78
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3005
+	.byte	0x25
+	.byte	0x79
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3006
+	.byte	0x25
+	.byte	0x7a
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3007
+	.byte	0x25
+	.byte	0x7b
+	.byte	0xe
+	.long	0x10a
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3008
+	.byte	0x25
+	.byte	0x7c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3009
+	.byte	0x25
+	.byte	0x7d
+	.byte	0xd
+	.long	0x902
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3010
+	.byte	0x25
+	.byte	0x7e
+	.byte	0xd
+	.long	0x902
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3011
+	.byte	0x25
+	.byte	0x7f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF3012
+	.byte	0x25
+	.byte	0x80
+	.byte	0xd
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3013
+	.byte	0x25
+	.byte	0x81
+	.byte	0xd
+	.long	0xe3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3014
+	.byte	0x25
+	.byte	0x82
+	.byte	0xd
+	.long	0xe3
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3015
+	.byte	0x25
+	.byte	0x83
+	.byte	0xd
+	.long	0xe3
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF3016
+	.byte	0x25
+	.byte	0x84
+	.byte	0xe
+	.long	0xf9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3017
+	.byte	0x25
+	.byte	0x85
+	.byte	0xe
+	.long	0xf9
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3018
+	.byte	0x25
+	.byte	0x86
+	.byte	0xe
+	.long	0xf9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3019
+	.byte	0x25
+	.byte	0x87
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3020
+	.byte	0x25
+	.byte	0x88
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF3021
+	.byte	0x25
+	.byte	0x89
+	.byte	0xd
+	.long	0xe3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3022
+	.byte	0x25
+	.byte	0x8a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF3023
+	.byte	0x25
+	.byte	0x8b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3024
+	.byte	0x25
+	.byte	0x8c
+	.byte	0xe
+	.long	0xf9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF3025
+	.byte	0x25
+	.byte	0x8e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF3026
+	.byte	0x25
+	.byte	0x8f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0xe3
+	.long	0x1d53
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3027
+	.byte	0x25
+	.byte	0x90
+	.byte	0x3
+	.long	0x1bf0
+	.uleb128 0xb
+	.long	0x1d53
+	.uleb128 0xa
+	.long	.LASF3028
+	.byte	0x25
+	.byte	0x92
+	.byte	0x13
+	.long	0x1d53
+	.uleb128 0x4
+	.long	.LASF3029
+	.byte	0x26
+	.byte	0x80
+	.byte	0xf
+	.long	0x1d7c
+	.uleb128 0x7
+	.long	0x1d81
+	.uleb128 0x1f
+	.long	0x3cc
+	.long	0x1d9f
+	.uleb128 0x5
+	.long	0x1d9f
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x5
+	.long	0x593
+	.byte	0
+	.uleb128 0x7
+	.long	0x9db
+	.uleb128 0x4
+	.long	.LASF3030
+	.byte	0x26
+	.byte	0x81
+	.byte	0xf
+	.long	0x1db0
+	.uleb128 0x7
+	.long	0x1db5
+	.uleb128 0x1f
+	.long	0x3cc
+	.long	0x1dce
+	.uleb128 0x5
+	.long	0x1d9f
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3031
+	.byte	0x26
+	.byte	0x82
+	.byte	0x10
+	.long	0x1dda
+	.uleb128 0x7
+	.long	0x1ddf
+	.uleb128 0x3f
+	.uleb128 0x8
+	.long	.LASF3032
+	.byte	0x20
+	.byte	0x26
+	.byte	0x86
+	.byte	0x10
+	.long	0x1e22
+	.uleb128 0x2
+	.long	.LASF2593
+	.byte	0x26
+	.byte	0x87
+	.byte	0x1a
+	.long	0x1d70
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3033
+	.byte	0x26
+	.byte	0x88
+	.byte	0x1b
+	.long	0x1da4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3034
+	.byte	0x26
+	.byte	0x89
+	.byte	0x13
+	.long	0x1dce
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3035
+	.byte	0x26
+	.byte	0x8a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3036
+	.byte	0x26
+	.byte	0x8b
+	.byte	0x3
+	.long	0x1de0
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x26
+	.byte	0xa9
+	.byte	0xe
+	.long	0x1e83
+	.uleb128 0x1
+	.long	.LASF3037
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3038
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3039
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3040
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3041
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3042
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3043
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3044
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3045
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3046
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3047
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3048
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3049
+	.byte	0x26
+	.byte	0xb6
+	.byte	0x3
+	.long	0x1e2e
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x26
+	.byte	0xb8
+	.byte	0xe
+	.long	0x1ea8
+	.uleb128 0x1
+	.long	.LASF3050
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3051
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3052
+	.byte	0x26
+	.byte	0xbb
+	.byte	0x3
+	.long	0x1e8f
+	.uleb128 0x8
+	.long	.LASF3053
+	.byte	0x8
+	.byte	0x26
+	.byte	0xbd
+	.byte	0x10
+	.long	0x1edc
+	.uleb128 0x2
+	.long	.LASF3054
+	.byte	0x26
+	.byte	0xbe
+	.byte	0x11
+	.long	0x1e83
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3055
+	.byte	0x26
+	.byte	0xbf
+	.byte	0x19
+	.long	0x1ea8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3056
+	.byte	0x26
+	.byte	0xc0
+	.byte	0x3
+	.long	0x1eb4
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3057
+	.uleb128 0x8
+	.long	.LASF3058
+	.byte	0x10
+	.byte	0x27
+	.byte	0x33
+	.byte	0x10
+	.long	0x1f17
+	.uleb128 0x2
+	.long	.LASF3059
+	.byte	0x27
+	.byte	0x35
+	.byte	0x23
+	.long	0x1f17
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3060
+	.byte	0x27
+	.byte	0x36
+	.byte	0x23
+	.long	0x1f17
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x1eef
+	.uleb128 0x4
+	.long	.LASF3061
+	.byte	0x27
+	.byte	0x37
+	.byte	0x3
+	.long	0x1eef
+	.uleb128 0x8
+	.long	.LASF3062
+	.byte	0x28
+	.byte	0x28
+	.byte	0x16
+	.byte	0x8
+	.long	0x1f9e
+	.uleb128 0x2
+	.long	.LASF3063
+	.byte	0x28
+	.byte	0x18
+	.byte	0x7
+	.long	0x88
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3064
+	.byte	0x28
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3065
+	.byte	0x28
+	.byte	0x1a
+	.byte	0x7
+	.long	0x88
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3066
+	.byte	0x28
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3067
+	.byte	0x28
+	.byte	0x20
+	.byte	0x7
+	.long	0x88
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3068
+	.byte	0x28
+	.byte	0x22
+	.byte	0x9
+	.long	0x69
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3069
+	.byte	0x28
+	.byte	0x23
+	.byte	0x9
+	.long	0x69
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3070
+	.byte	0x28
+	.byte	0x24
+	.byte	0x14
+	.long	0x1f1c
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2b
+	.byte	0x28
+	.byte	0x29
+	.byte	0x43
+	.byte	0x9
+	.long	0x1fcc
+	.uleb128 0x1c
+	.long	.LASF3071
+	.byte	0x29
+	.byte	0x45
+	.byte	0x1c
+	.long	0x1f28
+	.uleb128 0x1c
+	.long	.LASF3072
+	.byte	0x29
+	.byte	0x46
+	.byte	0x8
+	.long	0x1fcc
+	.uleb128 0x1c
+	.long	.LASF3073
+	.byte	0x29
+	.byte	0x47
+	.byte	0xc
+	.long	0xa0
+	.byte	0
+	.uleb128 0xd
+	.long	0xa9
+	.long	0x1fdc
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3074
+	.byte	0x29
+	.byte	0x48
+	.byte	0x3
+	.long	0x1f9e
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3075
+	.uleb128 0x4
+	.long	.LASF3076
+	.byte	0x13
+	.byte	0x5a
+	.byte	0x3
+	.long	0xa50
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x2a
+	.byte	0x14
+	.byte	0xe
+	.long	0x2026
+	.uleb128 0x1
+	.long	.LASF3077
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3078
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3079
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3080
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3081
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF3082
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x1e
+	.byte	0x10
+	.long	0x205b
+	.uleb128 0x2
+	.long	.LASF2855
+	.byte	0x2a
+	.byte	0x1f
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2856
+	.byte	0x2a
+	.byte	0x20
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x14
+	.string	"yaw"
+	.byte	0x2a
+	.byte	0x21
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3083
+	.byte	0x2a
+	.byte	0x22
+	.byte	0x3
+	.long	0x2026
+	.uleb128 0x23
+	.long	.LASF3084
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x24
+	.long	0x208c
+	.uleb128 0x1e
+	.string	"raw"
+	.byte	0x2a
+	.byte	0x25
+	.byte	0xd
+	.long	0x1628
+	.uleb128 0x1c
+	.long	.LASF2857
+	.byte	0x2a
+	.byte	0x26
+	.byte	0x1f
+	.long	0x205b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3085
+	.byte	0x2a
+	.byte	0x27
+	.byte	0x3
+	.long	0x2067
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x2a
+	.byte	0x2d
+	.byte	0xe
+	.long	0x20cf
+	.uleb128 0x1
+	.long	.LASF3086
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3087
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3088
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3089
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3090
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3091
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3092
+	.byte	0x40
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF3093
+	.byte	0xa0
+	.byte	0x2b
+	.byte	0x2c
+	.byte	0x10
+	.long	0x2111
+	.uleb128 0x14
+	.string	"dev"
+	.byte	0x2b
+	.byte	0x2d
+	.byte	0xe
+	.long	0x1fef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3094
+	.byte	0x2b
+	.byte	0x2e
+	.byte	0xe
+	.long	0x10a
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF3095
+	.byte	0x2b
+	.byte	0x2f
+	.byte	0xd
+	.long	0x15c5
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF3096
+	.byte	0x2b
+	.byte	0x30
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3097
+	.byte	0x2b
+	.byte	0x31
+	.byte	0x3
+	.long	0x20cf
+	.uleb128 0x30
+	.string	"acc"
+	.byte	0x2b
+	.byte	0x33
+	.long	0x2111
+	.uleb128 0x8
+	.long	.LASF3098
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x35
+	.byte	0x10
+	.long	0x2150
+	.uleb128 0x2
+	.long	.LASF2855
+	.byte	0x2b
+	.byte	0x36
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2856
+	.byte	0x2b
+	.byte	0x37
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3099
+	.byte	0x2b
+	.byte	0x38
+	.byte	0x3
+	.long	0x2128
+	.uleb128 0x23
+	.long	.LASF3100
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x3a
+	.long	0x2181
+	.uleb128 0x1e
+	.string	"raw"
+	.byte	0x2b
+	.byte	0x3b
+	.byte	0xd
+	.long	0x1841
+	.uleb128 0x1c
+	.long	.LASF2857
+	.byte	0x2b
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x2150
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3101
+	.byte	0x2b
+	.byte	0x3d
+	.byte	0x3
+	.long	0x215c
+	.uleb128 0x8
+	.long	.LASF3102
+	.byte	0x14
+	.byte	0x2b
+	.byte	0x40
+	.byte	0x10
+	.long	0x21dc
+	.uleb128 0x2
+	.long	.LASF3103
+	.byte	0x2b
+	.byte	0x41
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3104
+	.byte	0x2b
+	.byte	0x42
+	.byte	0x14
+	.long	0xa23
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3105
+	.byte	0x2b
+	.byte	0x43
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3106
+	.byte	0x2b
+	.byte	0x44
+	.byte	0x1b
+	.long	0x208c
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3107
+	.byte	0x2b
+	.byte	0x45
+	.byte	0x19
+	.long	0x2181
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3108
+	.byte	0x2b
+	.byte	0x46
+	.byte	0x3
+	.long	0x218d
+	.uleb128 0xb
+	.long	0x21dc
+	.uleb128 0xa
+	.long	.LASF3109
+	.byte	0x2b
+	.byte	0x48
+	.byte	0x1e
+	.long	0x21dc
+	.uleb128 0x4
+	.long	.LASF3110
+	.byte	0x2c
+	.byte	0x14
+	.byte	0x10
+	.long	0x1dda
+	.uleb128 0x4
+	.long	.LASF3111
+	.byte	0x2c
+	.byte	0x15
+	.byte	0x10
+	.long	0x2211
+	.uleb128 0x7
+	.long	0x2216
+	.uleb128 0x1b
+	.long	0x2226
+	.uleb128 0x5
+	.long	0x2226
+	.uleb128 0x5
+	.long	0x2226
+	.byte	0
+	.uleb128 0x7
+	.long	0xd2
+	.uleb128 0x8
+	.long	.LASF3112
+	.byte	0x30
+	.byte	0x2c
+	.byte	0x17
+	.byte	0x10
+	.long	0x2294
+	.uleb128 0x2
+	.long	.LASF3113
+	.byte	0x2c
+	.byte	0x18
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3114
+	.byte	0x2c
+	.byte	0x19
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3115
+	.byte	0x2c
+	.byte	0x1a
+	.byte	0x13
+	.long	0x21f9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3116
+	.byte	0x2c
+	.byte	0x1b
+	.byte	0x13
+	.long	0x21f9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3117
+	.byte	0x2c
+	.byte	0x1c
+	.byte	0x13
+	.long	0x21f9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3118
+	.byte	0x2c
+	.byte	0x1d
+	.byte	0x13
+	.long	0x21f9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3119
+	.byte	0x2c
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x2205
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3120
+	.byte	0x2c
+	.byte	0x1f
+	.byte	0x3
+	.long	0x222b
+	.uleb128 0x8
+	.long	.LASF3121
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x21
+	.byte	0x10
+	.long	0x22ef
+	.uleb128 0x2
+	.long	.LASF3122
+	.byte	0x2d
+	.byte	0x22
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3123
+	.byte	0x2d
+	.byte	0x23
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3124
+	.byte	0x2d
+	.byte	0x24
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3125
+	.byte	0x2d
+	.byte	0x25
+	.byte	0xe
+	.long	0xf9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3126
+	.byte	0x2d
+	.byte	0x26
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3127
+	.byte	0x2d
+	.byte	0x27
+	.byte	0x3
+	.long	0x22a0
+	.uleb128 0xb
+	.long	0x22ef
+	.uleb128 0xa
+	.long	.LASF3128
+	.byte	0x2d
+	.byte	0x29
+	.byte	0x1a
+	.long	0x22ef
+	.uleb128 0x8
+	.long	.LASF3129
+	.byte	0x38
+	.byte	0x2d
+	.byte	0x2b
+	.byte	0x10
+	.long	0x2341
+	.uleb128 0x14
+	.string	"dev"
+	.byte	0x2d
+	.byte	0x2c
+	.byte	0xf
+	.long	0x2294
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3130
+	.byte	0x2d
+	.byte	0x2d
+	.byte	0xd
+	.long	0xd2
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF3131
+	.byte	0x2d
+	.byte	0x2e
+	.byte	0xd
+	.long	0xd2
+	.byte	0x34
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3132
+	.byte	0x2d
+	.byte	0x2f
+	.byte	0x3
+	.long	0x230c
+	.uleb128 0xa
+	.long	.LASF3133
+	.byte	0x2d
+	.byte	0x31
+	.byte	0xf
+	.long	0x2341
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x2e
+	.byte	0x17
+	.byte	0xe
+	.long	0x238a
+	.uleb128 0x1
+	.long	.LASF3134
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3135
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3136
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3137
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3138
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3139
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3140
+	.byte	0x2e
+	.byte	0x1e
+	.byte	0x3
+	.long	0x2359
+	.uleb128 0x8
+	.long	.LASF3141
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x43
+	.byte	0x10
+	.long	0x23be
+	.uleb128 0x2
+	.long	.LASF3142
+	.byte	0x2e
+	.byte	0x44
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3143
+	.byte	0x2e
+	.byte	0x45
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3144
+	.byte	0x2e
+	.byte	0x46
+	.byte	0x3
+	.long	0x2396
+	.uleb128 0xb
+	.long	0x23be
+	.uleb128 0xa
+	.long	.LASF3145
+	.byte	0x2e
+	.byte	0x48
+	.byte	0x21
+	.long	0x23be
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x2f
+	.byte	0x1a
+	.byte	0xe
+	.long	0x23fa
+	.uleb128 0x1
+	.long	.LASF3146
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3147
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3148
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3149
+	.byte	0x2f
+	.byte	0x1e
+	.byte	0x3
+	.long	0x23db
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x2f
+	.byte	0x3f
+	.byte	0xe
+	.long	0x242b
+	.uleb128 0x1
+	.long	.LASF3150
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3151
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3152
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3153
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF3154
+	.byte	0x3
+	.byte	0x2f
+	.byte	0x47
+	.byte	0x10
+	.long	0x2460
+	.uleb128 0x2
+	.long	.LASF3155
+	.byte	0x2f
+	.byte	0x48
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3156
+	.byte	0x2f
+	.byte	0x49
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3157
+	.byte	0x2f
+	.byte	0x4a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3158
+	.byte	0x2f
+	.byte	0x4b
+	.byte	0x3
+	.long	0x242b
+	.uleb128 0xb
+	.long	0x2460
+	.uleb128 0xd
+	.long	0x2460
+	.long	0x2481
+	.uleb128 0xe
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3159
+	.byte	0x2f
+	.byte	0x4d
+	.byte	0x21
+	.long	0x2471
+	.uleb128 0x8
+	.long	.LASF3160
+	.byte	0x14
+	.byte	0x30
+	.byte	0x1b
+	.byte	0x10
+	.long	0x252a
+	.uleb128 0x2
+	.long	.LASF3161
+	.byte	0x30
+	.byte	0x1d
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3162
+	.byte	0x30
+	.byte	0x1e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3163
+	.byte	0x30
+	.byte	0x1f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3164
+	.byte	0x30
+	.byte	0x20
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3165
+	.byte	0x30
+	.byte	0x22
+	.byte	0x1a
+	.long	0x23fa
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3166
+	.byte	0x30
+	.byte	0x25
+	.byte	0x1a
+	.long	0x238a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3167
+	.byte	0x30
+	.byte	0x26
+	.byte	0xe
+	.long	0xf9
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3168
+	.byte	0x30
+	.byte	0x29
+	.byte	0x9
+	.long	0x3cc
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3169
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x9
+	.long	0x3cc
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF3170
+	.byte	0x30
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3171
+	.byte	0x30
+	.byte	0x2c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3172
+	.byte	0x30
+	.byte	0x2d
+	.byte	0x3
+	.long	0x248d
+	.uleb128 0xb
+	.long	0x252a
+	.uleb128 0xa
+	.long	.LASF3173
+	.byte	0x30
+	.byte	0x2f
+	.byte	0x18
+	.long	0x252a
+	.uleb128 0x8
+	.long	.LASF3174
+	.byte	0x10
+	.byte	0x31
+	.byte	0x23
+	.byte	0x10
+	.long	0x256f
+	.uleb128 0x2
+	.long	.LASF3175
+	.byte	0x31
+	.byte	0x24
+	.byte	0xd
+	.long	0x15c5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3176
+	.byte	0x31
+	.byte	0x25
+	.byte	0xb
+	.long	0x131
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3177
+	.byte	0x31
+	.byte	0x26
+	.byte	0x3
+	.long	0x2547
+	.uleb128 0x30
+	.string	"mag"
+	.byte	0x31
+	.byte	0x28
+	.long	0x256f
+	.uleb128 0x8
+	.long	.LASF3178
+	.byte	0x10
+	.byte	0x31
+	.byte	0x2a
+	.byte	0x10
+	.long	0x25d5
+	.uleb128 0x2
+	.long	.LASF3179
+	.byte	0x31
+	.byte	0x2b
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3180
+	.byte	0x31
+	.byte	0x2d
+	.byte	0x14
+	.long	0xa23
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3181
+	.byte	0x31
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3182
+	.byte	0x31
+	.byte	0x2f
+	.byte	0xd
+	.long	0x902
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3183
+	.byte	0x31
+	.byte	0x30
+	.byte	0x1b
+	.long	0x208c
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3184
+	.byte	0x31
+	.byte	0x31
+	.byte	0x3
+	.long	0x2586
+	.uleb128 0xb
+	.long	0x25d5
+	.uleb128 0xa
+	.long	.LASF3185
+	.byte	0x31
+	.byte	0x33
+	.byte	0x18
+	.long	0x25d5
+	.uleb128 0x8
+	.long	.LASF3186
+	.byte	0x10
+	.byte	0x32
+	.byte	0x40
+	.byte	0x10
+	.long	0x261a
+	.uleb128 0x2
+	.long	.LASF3187
+	.byte	0x32
+	.byte	0x41
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3188
+	.byte	0x32
+	.byte	0x42
+	.byte	0xb
+	.long	0x8ba
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3189
+	.byte	0x32
+	.byte	0x43
+	.byte	0x3
+	.long	0x25f2
+	.uleb128 0xa
+	.long	.LASF3190
+	.byte	0x32
+	.byte	0x45
+	.byte	0xf
+	.long	0x261a
+	.uleb128 0x8
+	.long	.LASF3191
+	.byte	0x18
+	.byte	0x32
+	.byte	0x4c
+	.byte	0x10
+	.long	0x2710
+	.uleb128 0x2
+	.long	.LASF3192
+	.byte	0x32
+	.byte	0x4d
+	.byte	0x14
+	.long	0xa23
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3193
+	.byte	0x32
+	.byte	0x4e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3194
+	.byte	0x32
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3195
+	.byte	0x32
+	.byte	0x50
+	.byte	0xd
+	.long	0xe3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3196
+	.byte	0x32
+	.byte	0x51
+	.byte	0xd
+	.long	0xe3
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3197
+	.byte	0x32
+	.byte	0x52
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3198
+	.byte	0x32
+	.byte	0x53
+	.byte	0xd
+	.long	0x3cc
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3199
+	.byte	0x32
+	.byte	0x54
+	.byte	0xd
+	.long	0x3cc
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3200
+	.byte	0x32
+	.byte	0x55
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3201
+	.byte	0x32
+	.byte	0x56
+	.byte	0xd
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3202
+	.byte	0x32
+	.byte	0x57
+	.byte	0xe
+	.long	0xf9
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3203
+	.byte	0x32
+	.byte	0x58
+	.byte	0xe
+	.long	0xf9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3204
+	.byte	0x32
+	.byte	0x59
+	.byte	0xe
+	.long	0xf9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3205
+	.byte	0x32
+	.byte	0x5a
+	.byte	0xe
+	.long	0xf9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3206
+	.byte	0x32
+	.byte	0x5b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3207
+	.byte	0x32
+	.byte	0x5c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x17
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3208
+	.byte	0x32
+	.byte	0x5d
+	.byte	0x3
+	.long	0x2632
+	.uleb128 0xb
+	.long	0x2710
+	.uleb128 0xa
+	.long	.LASF3209
+	.byte	0x32
+	.byte	0x5f
+	.byte	0x15
+	.long	0x2710
+	.uleb128 0xa
+	.long	.LASF3210
+	.byte	0x33
+	.byte	0x54
+	.byte	0x1f
+	.long	0x688
+	.uleb128 0x31
+	.long	0x68d
+	.byte	0x54
+	.byte	0x50
+	.uleb128 0x31
+	.long	0x699
+	.byte	0x54
+	.byte	0x78
+	.uleb128 0xa
+	.long	.LASF3211
+	.byte	0x33
+	.byte	0x54
+	.byte	0xa7
+	.long	0x5a9
+	.uleb128 0x40
+	.long	0x2747
+	.byte	0xd3
+	.uleb128 0x41
+	.long	0x272d
+	.byte	0x56
+	.byte	0x18
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x33
+	.byte	0x72
+	.byte	0xe
+	.long	0x27b2
+	.uleb128 0x1
+	.long	.LASF3212
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3213
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3214
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3215
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3216
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3217
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3218
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3219
+	.byte	0x80
+	.uleb128 0x13
+	.long	.LASF3220
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF3221
+	.value	0x200
+	.uleb128 0x13
+	.long	.LASF3222
+	.value	0x400
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF3223
+	.byte	0x4
+	.byte	0x33
+	.byte	0x80
+	.byte	0x10
+	.long	0x27e7
+	.uleb128 0x2
+	.long	.LASF3224
+	.byte	0x33
+	.byte	0x81
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3225
+	.byte	0x33
+	.byte	0x83
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3226
+	.byte	0x33
+	.byte	0x84
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3227
+	.byte	0x33
+	.byte	0x85
+	.byte	0x3
+	.long	0x27b2
+	.uleb128 0xb
+	.long	0x27e7
+	.uleb128 0xd
+	.long	0x27f3
+	.long	0x2808
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x27f8
+	.uleb128 0x24
+	.long	.LASF3228
+	.byte	0x87
+	.byte	0x2a
+	.long	0x2808
+	.uleb128 0xd
+	.long	0xb0
+	.long	0x2828
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x5e
+	.byte	0
+	.uleb128 0xb
+	.long	0x2818
+	.uleb128 0x24
+	.long	.LASF3229
+	.byte	0x9a
+	.byte	0x13
+	.long	0x2828
+	.uleb128 0xd
+	.long	0x12c
+	.long	0x2848
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0xb
+	.long	0x2838
+	.uleb128 0x24
+	.long	.LASF3230
+	.byte	0x9f
+	.byte	0x1a
+	.long	0x2848
+	.uleb128 0x8
+	.long	.LASF3231
+	.byte	0x10
+	.byte	0x33
+	.byte	0xa9
+	.byte	0x10
+	.long	0x288d
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0x33
+	.byte	0xaa
+	.byte	0x11
+	.long	0x127
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3232
+	.byte	0x33
+	.byte	0xac
+	.byte	0xc
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x14
+	.string	"arr"
+	.byte	0x33
+	.byte	0xaf
+	.byte	0xd
+	.long	0x288d
+	.byte	0x9
+	.byte	0
+	.uleb128 0xd
+	.long	0xe3
+	.long	0x289d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3233
+	.byte	0x33
+	.byte	0xb0
+	.byte	0x3
+	.long	0x2858
+	.uleb128 0xb
+	.long	0x289d
+	.uleb128 0x8
+	.long	.LASF3234
+	.byte	0x10
+	.byte	0x33
+	.byte	0xb6
+	.byte	0x10
+	.long	0x28fd
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0x33
+	.byte	0xb7
+	.byte	0x11
+	.long	0x127
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3232
+	.byte	0x33
+	.byte	0xb8
+	.byte	0xc
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3235
+	.byte	0x33
+	.byte	0xba
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3236
+	.byte	0x33
+	.byte	0xbb
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3237
+	.byte	0x33
+	.byte	0xbc
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3238
+	.byte	0x33
+	.byte	0xbd
+	.byte	0x3
+	.long	0x28ae
+	.uleb128 0xb
+	.long	0x28fd
+	.uleb128 0x8
+	.long	.LASF3239
+	.byte	0x10
+	.byte	0x33
+	.byte	0xbf
+	.byte	0x10
+	.long	0x296a
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0x33
+	.byte	0xc0
+	.byte	0x11
+	.long	0x127
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3232
+	.byte	0x33
+	.byte	0xc1
+	.byte	0xc
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3235
+	.byte	0x33
+	.byte	0xc3
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3236
+	.byte	0x33
+	.byte	0xc4
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3237
+	.byte	0x33
+	.byte	0xc5
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3240
+	.byte	0x33
+	.byte	0xc6
+	.byte	0xd
+	.long	0xe3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3241
+	.byte	0x33
+	.byte	0xc7
+	.byte	0x3
+	.long	0x290e
+	.uleb128 0xb
+	.long	0x296a
+	.uleb128 0x8
+	.long	.LASF3242
+	.byte	0x18
+	.byte	0x33
+	.byte	0xc9
+	.byte	0x10
+	.long	0x29fe
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0x33
+	.byte	0xca
+	.byte	0x11
+	.long	0x127
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3232
+	.byte	0x33
+	.byte	0xcb
+	.byte	0xc
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3235
+	.byte	0x33
+	.byte	0xcd
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3243
+	.byte	0x33
+	.byte	0xce
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3244
+	.byte	0x33
+	.byte	0xcf
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3245
+	.byte	0x33
+	.byte	0xd0
+	.byte	0xd
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3246
+	.byte	0x33
+	.byte	0xd1
+	.byte	0xd
+	.long	0xe3
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF3240
+	.byte	0x33
+	.byte	0xd2
+	.byte	0xd
+	.long	0xe3
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3247
+	.byte	0x33
+	.byte	0xd3
+	.byte	0xe
+	.long	0xf9
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3248
+	.byte	0x33
+	.byte	0xd4
+	.byte	0x3
+	.long	0x297b
+	.uleb128 0xb
+	.long	0x29fe
+	.uleb128 0xd
+	.long	0x2a0a
+	.long	0x2a1f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2b
+	.byte	0
+	.uleb128 0xb
+	.long	0x2a0f
+	.uleb128 0x24
+	.long	.LASF3249
+	.byte	0xdc
+	.byte	0x2d
+	.long	0x2a1f
+	.uleb128 0xd
+	.long	0x2976
+	.long	0x2a3f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.long	0x2a2f
+	.uleb128 0x6
+	.long	.LASF3250
+	.value	0x122
+	.byte	0x33
+	.long	0x2a3f
+	.uleb128 0xd
+	.long	0x2909
+	.long	0x2a60
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.long	0x2a50
+	.uleb128 0x6
+	.long	.LASF3251
+	.value	0x12d
+	.byte	0x2e
+	.long	0x2a60
+	.uleb128 0xd
+	.long	0x2909
+	.long	0x2a81
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x2a71
+	.uleb128 0x6
+	.long	.LASF3252
+	.value	0x134
+	.byte	0x2e
+	.long	0x2a81
+	.uleb128 0x42
+	.long	.LASF3253
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x33
+	.value	0x13d
+	.byte	0xe
+	.long	0x2b00
+	.uleb128 0x1
+	.long	.LASF3254
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3255
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3256
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3257
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3258
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3259
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3260
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3261
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3262
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3263
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3264
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3265
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3266
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3267
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3268
+	.byte	0xe
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3253
+	.value	0x14d
+	.byte	0x3
+	.long	0x2a92
+	.uleb128 0x25
+	.long	.LASF3269
+	.byte	0x84
+	.value	0x150
+	.long	0x2be9
+	.uleb128 0x10
+	.long	.LASF2446
+	.value	0x151
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2929
+	.value	0x153
+	.byte	0xd
+	.long	0x15c5
+	.byte	0x4
+	.uleb128 0x10
+	.long	.LASF2930
+	.value	0x154
+	.byte	0xd
+	.long	0x15c5
+	.byte	0x10
+	.uleb128 0x10
+	.long	.LASF2931
+	.value	0x155
+	.byte	0xd
+	.long	0x15c5
+	.byte	0x1c
+	.uleb128 0x10
+	.long	.LASF2781
+	.value	0x157
+	.byte	0xd
+	.long	0x7cb
+	.byte	0x28
+	.uleb128 0x10
+	.long	.LASF3270
+	.value	0x158
+	.byte	0xd
+	.long	0x1628
+	.byte	0x30
+	.uleb128 0x10
+	.long	.LASF3095
+	.value	0x159
+	.byte	0xd
+	.long	0x1628
+	.byte	0x36
+	.uleb128 0x10
+	.long	.LASF2532
+	.value	0x15a
+	.byte	0xd
+	.long	0x7cb
+	.byte	0x3c
+	.uleb128 0x10
+	.long	.LASF2905
+	.value	0x15b
+	.byte	0xd
+	.long	0x2be9
+	.byte	0x44
+	.uleb128 0x10
+	.long	.LASF2950
+	.value	0x15c
+	.byte	0xd
+	.long	0x19fd
+	.byte	0x5c
+	.uleb128 0x10
+	.long	.LASF3271
+	.value	0x15e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6c
+	.uleb128 0x10
+	.long	.LASF3272
+	.value	0x15f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6e
+	.uleb128 0x10
+	.long	.LASF3130
+	.value	0x162
+	.byte	0xd
+	.long	0xd2
+	.byte	0x70
+	.uleb128 0x10
+	.long	.LASF3175
+	.value	0x165
+	.byte	0xd
+	.long	0x1628
+	.byte	0x74
+	.uleb128 0x10
+	.long	.LASF3000
+	.value	0x16a
+	.byte	0xe
+	.long	0xf9
+	.byte	0x7a
+	.uleb128 0x10
+	.long	.LASF2859
+	.value	0x16b
+	.byte	0xd
+	.long	0x1628
+	.byte	0x7c
+	.byte	0
+	.uleb128 0xd
+	.long	0xc1
+	.long	0x2bf9
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3273
+	.value	0x16c
+	.byte	0x3
+	.long	0x2b0c
+	.uleb128 0xb
+	.long	0x2bf9
+	.uleb128 0x25
+	.long	.LASF3274
+	.byte	0x14
+	.value	0x16e
+	.long	0x2c3e
+	.uleb128 0x10
+	.long	.LASF2907
+	.value	0x16f
+	.byte	0xd
+	.long	0x6ff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3275
+	.value	0x170
+	.byte	0xd
+	.long	0x6ff
+	.byte	0x8
+	.uleb128 0x10
+	.long	.LASF3276
+	.value	0x171
+	.byte	0xd
+	.long	0xe3
+	.byte	0x10
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3277
+	.value	0x172
+	.byte	0x3
+	.long	0x2c0a
+	.uleb128 0x25
+	.long	.LASF3278
+	.byte	0x8
+	.value	0x175
+	.long	0x2c98
+	.uleb128 0x10
+	.long	.LASF3279
+	.value	0x176
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2847
+	.value	0x177
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x10
+	.long	.LASF3280
+	.value	0x178
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF3281
+	.value	0x179
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x6
+	.uleb128 0x10
+	.long	.LASF3282
+	.value	0x17a
+	.byte	0x9
+	.long	0x3cc
+	.byte	0x7
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3283
+	.value	0x17b
+	.byte	0x1f
+	.long	0x2c4a
+	.uleb128 0x2c
+	.long	.LASF3284
+	.value	0x17e
+	.byte	0xe
+	.long	0x131
+	.uleb128 0x2c
+	.long	.LASF3285
+	.value	0x17e
+	.byte	0x1f
+	.long	0x131
+	.uleb128 0x2c
+	.long	.LASF3286
+	.value	0x181
+	.byte	0x15
+	.long	0x154b
+	.uleb128 0x6
+	.long	.LASF3287
+	.value	0x183
+	.byte	0x16
+	.long	0x2b00
+	.uleb128 0x6
+	.long	.LASF3288
+	.value	0x185
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0x6
+	.long	.LASF3289
+	.value	0x186
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x33
+	.value	0x18e
+	.byte	0x5
+	.long	0x2d0f
+	.uleb128 0x32
+	.long	.LASF3290
+	.value	0x18f
+	.byte	0xd
+	.long	0x88
+	.uleb128 0x32
+	.long	.LASF3291
+	.value	0x190
+	.byte	0x12
+	.long	0x10a
+	.byte	0
+	.uleb128 0x44
+	.byte	0x8
+	.byte	0x33
+	.value	0x188
+	.byte	0x8
+	.long	0x2d33
+	.uleb128 0x10
+	.long	.LASF3292
+	.value	0x189
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x45
+	.string	"u"
+	.byte	0x33
+	.value	0x191
+	.byte	0x7
+	.long	0x2cec
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3293
+	.value	0x192
+	.byte	0x3
+	.long	0x2d0f
+	.uleb128 0x6
+	.long	.LASF3294
+	.value	0x195
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0x6
+	.long	.LASF3295
+	.value	0x199
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0x6
+	.long	.LASF3296
+	.value	0x19a
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF3297
+	.value	0x19b
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF3298
+	.value	0x19c
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF3299
+	.value	0x19d
+	.byte	0xc
+	.long	0x3cc
+	.uleb128 0x6
+	.long	.LASF3300
+	.value	0x1a4
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF3301
+	.value	0x1a6
+	.byte	0x1b
+	.long	0x2c3e
+	.uleb128 0x6
+	.long	.LASF3302
+	.value	0x1a7
+	.byte	0x1c
+	.long	0x2c98
+	.uleb128 0xd
+	.long	0x2bf9
+	.long	0x2dbb
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3303
+	.value	0x1aa
+	.byte	0x1c
+	.long	0x2dab
+	.uleb128 0xd
+	.long	0x2dd7
+	.long	0x2dd7
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x2bf9
+	.uleb128 0x6
+	.long	.LASF3304
+	.value	0x1ad
+	.byte	0x1d
+	.long	0x2dc7
+	.uleb128 0x6
+	.long	.LASF3305
+	.value	0x1b0
+	.byte	0xc
+	.long	0x3cc
+	.uleb128 0x6
+	.long	.LASF3306
+	.value	0x1b1
+	.byte	0x20
+	.long	0x764
+	.uleb128 0x6
+	.long	.LASF3307
+	.value	0x1b3
+	.byte	0xc
+	.long	0x3cc
+	.uleb128 0x6
+	.long	.LASF3308
+	.value	0x1b6
+	.byte	0x1a
+	.long	0x5fa
+	.uleb128 0x6
+	.long	.LASF3309
+	.value	0x1b7
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x6
+	.long	.LASF3310
+	.value	0x1b8
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x6
+	.long	.LASF3311
+	.value	0x1b9
+	.byte	0xc
+	.long	0x3cc
+	.uleb128 0x25
+	.long	.LASF3312
+	.byte	0x38
+	.value	0x24e
+	.long	0x2ea4
+	.uleb128 0x10
+	.long	.LASF2521
+	.value	0x24f
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3313
+	.value	0x250
+	.byte	0xc
+	.long	0x2eaf
+	.byte	0x8
+	.uleb128 0x10
+	.long	.LASF3314
+	.value	0x251
+	.byte	0xc
+	.long	0x2ec4
+	.byte	0x10
+	.uleb128 0x10
+	.long	.LASF3315
+	.value	0x252
+	.byte	0xc
+	.long	0x2ed9
+	.byte	0x18
+	.uleb128 0x10
+	.long	.LASF3316
+	.value	0x253
+	.byte	0xb
+	.long	0x2ef2
+	.byte	0x20
+	.uleb128 0x10
+	.long	.LASF3317
+	.value	0x255
+	.byte	0xe
+	.long	0x593
+	.byte	0x28
+	.uleb128 0x10
+	.long	.LASF3318
+	.value	0x256
+	.byte	0xe
+	.long	0x593
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1b
+	.long	0x2eaf
+	.uleb128 0x5
+	.long	0x2dd7
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ea4
+	.uleb128 0x1b
+	.long	0x2ebf
+	.uleb128 0x5
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x7
+	.long	0x2c05
+	.uleb128 0x7
+	.long	0x2eb4
+	.uleb128 0x1b
+	.long	0x2ed9
+	.uleb128 0x5
+	.long	0x2ebf
+	.uleb128 0x5
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ec9
+	.uleb128 0x1f
+	.long	0x88
+	.long	0x2ef2
+	.uleb128 0x5
+	.long	0x2ebf
+	.uleb128 0x5
+	.long	0x2226
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ede
+	.uleb128 0x20
+	.long	.LASF3319
+	.value	0x257
+	.byte	0x3
+	.long	0x2e3c
+	.uleb128 0xb
+	.long	0x2ef7
+	.uleb128 0x46
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x33
+	.value	0x25a
+	.byte	0xe
+	.long	0x2f48
+	.uleb128 0x1
+	.long	.LASF3320
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3321
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3322
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3323
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3324
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3325
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3326
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3327
+	.byte	0x7
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3328
+	.value	0x26a
+	.byte	0x3
+	.long	0x2f08
+	.uleb128 0x6
+	.long	.LASF3329
+	.value	0x26c
+	.byte	0x10
+	.long	0x1268
+	.uleb128 0x6
+	.long	.LASF3330
+	.value	0x26d
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xd
+	.long	0xe3
+	.long	0x2f7c
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3331
+	.value	0x26e
+	.byte	0x10
+	.long	0x2f6c
+	.uleb128 0x6
+	.long	.LASF3332
+	.value	0x26f
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x6
+	.long	.LASF3333
+	.value	0x273
+	.byte	0x10
+	.long	0x1d43
+	.uleb128 0x6
+	.long	.LASF3334
+	.value	0x274
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xd
+	.long	0x2f03
+	.long	0x2fbc
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xb
+	.long	0x2fac
+	.uleb128 0x6
+	.long	.LASF3335
+	.value	0x420
+	.byte	0x24
+	.long	0x2fbc
+	.uleb128 0xd
+	.long	0x2fdd
+	.long	0x2fdd
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	0x2f03
+	.uleb128 0x6
+	.long	.LASF3336
+	.value	0x431
+	.byte	0x25
+	.long	0x2fcd
+	.uleb128 0x6
+	.long	.LASF3337
+	.value	0x432
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xd
+	.long	0xe3
+	.long	0x300a
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3338
+	.value	0x433
+	.byte	0x10
+	.long	0x2ffa
+	.uleb128 0x47
+	.long	.LASF3339
+	.byte	0x33
+	.value	0x569
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x18
+	.long	.LASF3342
+	.byte	0xa
+	.byte	0x3c
+	.long	0x3039
+	.uleb128 0x5
+	.long	0x3039
+	.uleb128 0x5
+	.long	0x303e
+	.byte	0
+	.uleb128 0x7
+	.long	0x764
+	.uleb128 0x7
+	.long	0xde
+	.uleb128 0x1d
+	.long	.LASF3340
+	.byte	0x25
+	.byte	0xa4
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x1d
+	.long	.LASF3341
+	.byte	0x25
+	.byte	0xa3
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x33
+	.long	.LASF3280
+	.byte	0x1c
+	.byte	0x53
+	.byte	0x11
+	.long	0x15b9
+	.long	0x306d
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3344
+	.byte	0x34
+	.byte	0x40
+	.byte	0xc
+	.long	0x88
+	.long	0x308d
+	.uleb128 0x5
+	.long	0xee6
+	.uleb128 0x5
+	.long	0xee6
+	.uleb128 0x5
+	.long	0x11b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3343
+	.byte	0xa
+	.byte	0x38
+	.long	0x30a8
+	.uleb128 0x5
+	.long	0x3039
+	.uleb128 0x5
+	.long	0x303e
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3352
+	.byte	0x52
+	.uleb128 0x19
+	.long	.LASF3345
+	.byte	0x35
+	.byte	0x16
+	.byte	0xa
+	.long	0x10a
+	.long	0x30c4
+	.uleb128 0x5
+	.long	0x131
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3346
+	.byte	0x36
+	.byte	0x22
+	.long	0x30db
+	.uleb128 0x5
+	.long	0x127
+	.uleb128 0x5
+	.long	0x127
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3347
+	.byte	0x36
+	.byte	0x21
+	.byte	0x5
+	.long	0x88
+	.long	0x30f2
+	.uleb128 0x5
+	.long	0x127
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF3348
+	.byte	0x34
+	.value	0x197
+	.byte	0xf
+	.long	0x11b
+	.long	0x3109
+	.uleb128 0x5
+	.long	0x127
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3349
+	.byte	0xb
+	.byte	0x5e
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x1d
+	.long	.LASF3350
+	.byte	0xb
+	.byte	0x58
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x18
+	.long	.LASF3351
+	.byte	0x22
+	.byte	0x3c
+	.long	0x3132
+	.uleb128 0x5
+	.long	0x1aaa
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3353
+	.byte	0x57
+	.uleb128 0x21
+	.long	.LASF3354
+	.byte	0x55
+	.uleb128 0x19
+	.long	.LASF3355
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x5
+	.long	0x3cc
+	.long	0x3154
+	.uleb128 0x5
+	.long	0x3cc
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3356
+	.byte	0xb
+	.byte	0x53
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x19
+	.long	.LASF3357
+	.byte	0xb
+	.byte	0x62
+	.byte	0x1f
+	.long	0x78f
+	.long	0x3176
+	.uleb128 0x5
+	.long	0xd2
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF3386
+	.byte	0xb
+	.byte	0x61
+	.byte	0x6
+	.long	0x3184
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3358
+	.byte	0xb
+	.byte	0x5a
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x21
+	.long	.LASF3359
+	.byte	0x5b
+	.uleb128 0x21
+	.long	.LASF3360
+	.byte	0x50
+	.uleb128 0x21
+	.long	.LASF3361
+	.byte	0x34
+	.uleb128 0x19
+	.long	.LASF3362
+	.byte	0x36
+	.byte	0x23
+	.byte	0x5
+	.long	0x88
+	.long	0x31b8
+	.uleb128 0x5
+	.long	0x127
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3363
+	.byte	0x36
+	.byte	0x2f
+	.long	0x31c9
+	.uleb128 0x5
+	.long	0x131
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3364
+	.byte	0x36
+	.byte	0x27
+	.long	0x31df
+	.uleb128 0x5
+	.long	0x303e
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3365
+	.byte	0x36
+	.byte	0x2a
+	.long	0x31f0
+	.uleb128 0x5
+	.long	0x2226
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3366
+	.byte	0x37
+	.byte	0x78
+	.long	0x3210
+	.uleb128 0x5
+	.long	0x2226
+	.uleb128 0x5
+	.long	0x303e
+	.uleb128 0x5
+	.long	0x303e
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3367
+	.byte	0x34
+	.byte	0x2b
+	.byte	0xe
+	.long	0xa7
+	.long	0x3230
+	.uleb128 0x5
+	.long	0xa7
+	.uleb128 0x5
+	.long	0xee6
+	.uleb128 0x5
+	.long	0x11b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3368
+	.byte	0x36
+	.byte	0x2c
+	.long	0x3241
+	.uleb128 0x5
+	.long	0x2226
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3369
+	.byte	0x30
+	.byte	0x4b
+	.byte	0x9
+	.long	0xd2
+	.uleb128 0x18
+	.long	.LASF3370
+	.byte	0x36
+	.byte	0x2d
+	.long	0x3263
+	.uleb128 0x5
+	.long	0x2226
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF3371
+	.byte	0x38
+	.value	0x13d
+	.byte	0x11
+	.long	0xa0
+	.long	0x327a
+	.uleb128 0x5
+	.long	0x131
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3372
+	.byte	0x36
+	.byte	0x25
+	.long	0x328b
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3373
+	.byte	0x36
+	.byte	0x28
+	.long	0x32a1
+	.uleb128 0x5
+	.long	0x32a1
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x7
+	.long	0xcd
+	.uleb128 0x18
+	.long	.LASF3374
+	.byte	0x36
+	.byte	0x26
+	.long	0x32b7
+	.uleb128 0x5
+	.long	0xd2
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3375
+	.byte	0x1b
+	.byte	0x69
+	.byte	0x5
+	.long	0x3cc
+	.long	0x32cd
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF3376
+	.byte	0x1f
+	.byte	0x6d
+	.byte	0x9
+	.long	0xe3
+	.long	0x32df
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3377
+	.byte	0x1a
+	.byte	0x66
+	.byte	0x5
+	.long	0x3cc
+	.long	0x32f5
+	.uleb128 0x5
+	.long	0x1518
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3378
+	.byte	0x22
+	.byte	0x41
+	.byte	0xa
+	.long	0x10a
+	.uleb128 0x19
+	.long	.LASF3379
+	.byte	0x1a
+	.byte	0x6e
+	.byte	0x5
+	.long	0x3cc
+	.long	0x3317
+	.uleb128 0x5
+	.long	0x1518
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3380
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x5
+	.long	0x3cc
+	.long	0x332d
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3381
+	.byte	0x30
+	.byte	0x47
+	.byte	0xa
+	.long	0xf9
+	.uleb128 0x19
+	.long	.LASF3382
+	.byte	0x34
+	.byte	0x3d
+	.byte	0xe
+	.long	0xa7
+	.long	0x3359
+	.uleb128 0x5
+	.long	0xa7
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x11b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3383
+	.byte	0xb
+	.byte	0x54
+	.byte	0x5
+	.long	0x3cc
+	.uleb128 0x19
+	.long	.LASF3384
+	.byte	0x24
+	.byte	0x66
+	.byte	0xf
+	.long	0xe5c
+	.long	0x3380
+	.uleb128 0x5
+	.long	0xf9
+	.uleb128 0x5
+	.long	0x1bd8
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3385
+	.byte	0x39
+	.byte	0x1d
+	.byte	0xa
+	.long	0x4a9
+	.uleb128 0x49
+	.string	"gcd"
+	.byte	0x37
+	.byte	0x4f
+	.byte	0x5
+	.long	0x88
+	.long	0x33a7
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3429
+	.value	0x866
+	.uleb128 0x26
+	.long	.LASF3387
+	.value	0x79b
+	.long	0x33e4
+	.uleb128 0x3
+	.long	.LASF3389
+	.value	0x79b
+	.byte	0x1e
+	.long	0x4b5
+	.uleb128 0x27
+	.long	0x33d5
+	.uleb128 0xf
+	.string	"i"
+	.value	0x7c2
+	.byte	0x1a
+	.long	0x88
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3388
+	.value	0x808
+	.byte	0x2c
+	.long	0x407
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3393
+	.value	0x769
+	.long	0x33fc
+	.uleb128 0x3
+	.long	.LASF3389
+	.value	0x769
+	.byte	0x2b
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3423
+	.value	0x75c
+	.uleb128 0x28
+	.long	.LASF3390
+	.value	0x751
+	.byte	0x18
+	.long	0x3cc
+	.uleb128 0x28
+	.long	.LASF3391
+	.value	0x744
+	.byte	0xc
+	.long	0x3cc
+	.uleb128 0x12
+	.long	.LASF3400
+	.value	0x73c
+	.byte	0xc
+	.long	0x3cc
+	.long	0x3438
+	.uleb128 0x3
+	.long	.LASF3392
+	.value	0x73c
+	.byte	0x2d
+	.long	0x10a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3394
+	.value	0x72b
+	.long	0x3452
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3395
+	.value	0x72f
+	.byte	0x25
+	.long	0x37e
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3396
+	.value	0x71f
+	.long	0x346c
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3395
+	.value	0x724
+	.byte	0x23
+	.long	0x34a
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3397
+	.value	0x6f6
+	.long	0x3490
+	.uleb128 0x3
+	.long	.LASF3398
+	.value	0x6f6
+	.byte	0x26
+	.long	0x323
+	.uleb128 0x3
+	.long	.LASF3399
+	.value	0x6f6
+	.byte	0x43
+	.long	0x3490
+	.byte	0
+	.uleb128 0x7
+	.long	0x49d
+	.uleb128 0x12
+	.long	.LASF3401
+	.value	0x668
+	.byte	0xc
+	.long	0x3cc
+	.long	0x34ca
+	.uleb128 0x6
+	.long	.LASF3402
+	.value	0x66a
+	.byte	0x14
+	.long	0x105
+	.uleb128 0x6
+	.long	.LASF3403
+	.value	0x66b
+	.byte	0x14
+	.long	0x105
+	.uleb128 0x6
+	.long	.LASF3404
+	.value	0x672
+	.byte	0x20
+	.long	0x34ca
+	.byte	0
+	.uleb128 0x7
+	.long	0x1284
+	.uleb128 0x12
+	.long	.LASF3405
+	.value	0x5f3
+	.byte	0xc
+	.long	0x3cc
+	.long	0x35aa
+	.uleb128 0x3
+	.long	.LASF3406
+	.value	0x5f3
+	.byte	0x25
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF3407
+	.value	0x5f3
+	.byte	0x39
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF3408
+	.value	0x5f3
+	.byte	0x55
+	.long	0xee6
+	.uleb128 0x3
+	.long	.LASF3409
+	.value	0x5f4
+	.byte	0x15
+	.long	0xee6
+	.uleb128 0x3
+	.long	.LASF2521
+	.value	0x5f4
+	.byte	0x30
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF3410
+	.value	0x5f4
+	.byte	0x4b
+	.long	0x35aa
+	.uleb128 0x3
+	.long	.LASF3411
+	.value	0x5f4
+	.byte	0x66
+	.long	0x35aa
+	.uleb128 0xf
+	.string	"def"
+	.value	0x5f6
+	.byte	0x26
+	.long	0x35af
+	.uleb128 0x6
+	.long	.LASF3412
+	.value	0x5f7
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x6
+	.long	.LASF3413
+	.value	0x5f8
+	.byte	0x10
+	.long	0x3cc
+	.uleb128 0x6
+	.long	.LASF3414
+	.value	0x5f9
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x6
+	.long	.LASF3415
+	.value	0x5fa
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x6
+	.long	.LASF3416
+	.value	0x61a
+	.byte	0x14
+	.long	0x116
+	.uleb128 0x27
+	.long	0x358d
+	.uleb128 0x6
+	.long	.LASF3417
+	.value	0x60d
+	.byte	0x12
+	.long	0x10a
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3418
+	.value	0x622
+	.byte	0x15
+	.long	0xd2
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3419
+	.value	0x644
+	.byte	0x15
+	.long	0x88
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xef
+	.uleb128 0x7
+	.long	0x28a9
+	.uleb128 0x9
+	.long	.LASF3420
+	.value	0x5d3
+	.long	0x35e4
+	.uleb128 0x3
+	.long	.LASF3389
+	.value	0x5d3
+	.byte	0x24
+	.long	0x4b5
+	.uleb128 0x6
+	.long	.LASF3421
+	.value	0x5d5
+	.byte	0x1a
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x5d9
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3422
+	.value	0x5b4
+	.long	0x35fc
+	.uleb128 0x3
+	.long	.LASF3389
+	.value	0x5b4
+	.byte	0x24
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3424
+	.value	0x5a8
+	.uleb128 0x4a
+	.long	.LASF3425
+	.byte	0x33
+	.value	0x589
+	.byte	0x5
+	.long	0x3cc
+	.long	0x3643
+	.uleb128 0x6
+	.long	.LASF3426
+	.value	0x58a
+	.byte	0x15
+	.long	0x10a
+	.uleb128 0x6
+	.long	.LASF3427
+	.value	0x58b
+	.byte	0xe
+	.long	0xf9
+	.uleb128 0xf
+	.string	"i"
+	.value	0x596
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x6
+	.long	.LASF3428
+	.value	0x597
+	.byte	0x9
+	.long	0x3cc
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3430
+	.value	0x578
+	.uleb128 0x26
+	.long	.LASF3431
+	.value	0x56b
+	.long	0x3664
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3432
+	.value	0x56f
+	.byte	0x1b
+	.long	0xe5c
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3433
+	.value	0x553
+	.uleb128 0x9
+	.long	.LASF3434
+	.value	0x516
+	.long	0x3683
+	.uleb128 0x6
+	.long	.LASF2506
+	.value	0x52b
+	.byte	0x28
+	.long	0x3683
+	.byte	0
+	.uleb128 0x7
+	.long	0x27f3
+	.uleb128 0x2e
+	.long	.LASF3435
+	.value	0x50c
+	.uleb128 0x28
+	.long	.LASF3436
+	.value	0x507
+	.byte	0x1a
+	.long	0x5fa
+	.uleb128 0x26
+	.long	.LASF3437
+	.value	0x4df
+	.long	0x36b5
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"div"
+	.value	0x4e9
+	.byte	0x13
+	.long	0x8f
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3438
+	.value	0x4c5
+	.byte	0xc
+	.long	0x3cc
+	.long	0x36e0
+	.uleb128 0x6
+	.long	.LASF3439
+	.value	0x4c8
+	.byte	0x9
+	.long	0x3cc
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3440
+	.value	0x4cd
+	.byte	0x1d
+	.long	0x2c98
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3441
+	.value	0x4b6
+	.long	0x36f8
+	.uleb128 0x3
+	.long	.LASF3442
+	.value	0x4b6
+	.byte	0x30
+	.long	0x36f8
+	.byte	0
+	.uleb128 0x7
+	.long	0x2c98
+	.uleb128 0x9
+	.long	.LASF3443
+	.value	0x49f
+	.long	0x3715
+	.uleb128 0x6
+	.long	.LASF2857
+	.value	0x4a1
+	.byte	0xd
+	.long	0x15c5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3444
+	.value	0x487
+	.long	0x373f
+	.uleb128 0x27
+	.long	0x3732
+	.uleb128 0x6
+	.long	.LASF2857
+	.value	0x48c
+	.byte	0x11
+	.long	0x373f
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x490
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xd2
+	.long	0x374f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3445
+	.value	0x46b
+	.long	0x3785
+	.uleb128 0x6
+	.long	.LASF3421
+	.value	0x46d
+	.byte	0x1a
+	.long	0x2dd7
+	.uleb128 0x27
+	.long	0x3776
+	.uleb128 0xf
+	.string	"i"
+	.value	0x471
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF2857
+	.value	0x477
+	.byte	0x11
+	.long	0x373f
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3446
+	.value	0x460
+	.byte	0xc
+	.long	0x88
+	.long	0x37c6
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x460
+	.byte	0x3b
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x460
+	.byte	0x4b
+	.long	0x2226
+	.uleb128 0x6
+	.long	.LASF3448
+	.value	0x462
+	.byte	0x9
+	.long	0x88
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x464
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3449
+	.value	0x439
+	.long	0x382a
+	.uleb128 0x3
+	.long	.LASF3224
+	.value	0x439
+	.byte	0x30
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF3290
+	.value	0x43b
+	.byte	0xe
+	.long	0x30
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x43f
+	.byte	0x13
+	.long	0x30
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3450
+	.value	0x440
+	.byte	0x26
+	.long	0x2fdd
+	.uleb128 0x6
+	.long	.LASF3451
+	.value	0x441
+	.byte	0xd
+	.long	0x88
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"j"
+	.value	0x447
+	.byte	0x12
+	.long	0x88
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"def"
+	.value	0x448
+	.byte	0x33
+	.long	0x382a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x2a0a
+	.uleb128 0x12
+	.long	.LASF3452
+	.value	0x41a
+	.byte	0xc
+	.long	0x88
+	.long	0x3858
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x41a
+	.byte	0x3a
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x41a
+	.byte	0x4a
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3453
+	.value	0x413
+	.long	0x3888
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x413
+	.byte	0x3b
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x413
+	.byte	0x5f
+	.long	0x2ebf
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x415
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3456
+	.value	0x40e
+	.long	0x38a0
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x40e
+	.byte	0x3b
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3457
+	.value	0x407
+	.long	0x38c4
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x407
+	.byte	0x2f
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x409
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3458
+	.value	0x401
+	.byte	0xc
+	.long	0x88
+	.long	0x38ed
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x401
+	.byte	0x3b
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x401
+	.byte	0x4b
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3459
+	.value	0x3fc
+	.long	0x3911
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3fc
+	.byte	0x3c
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x3fc
+	.byte	0x60
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3460
+	.value	0x3f6
+	.long	0x3929
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3f6
+	.byte	0x3c
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3461
+	.value	0x3ec
+	.long	0x3941
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3ec
+	.byte	0x30
+	.long	0x2dd7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3462
+	.value	0x3e7
+	.byte	0xc
+	.long	0x88
+	.long	0x396a
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3e7
+	.byte	0x38
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x3e7
+	.byte	0x48
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3463
+	.value	0x3e2
+	.long	0x398e
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3e2
+	.byte	0x39
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x3e2
+	.byte	0x5d
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3464
+	.value	0x3d7
+	.long	0x39b2
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3d7
+	.byte	0x39
+	.long	0x2ebf
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"x"
+	.value	0x3dd
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3465
+	.value	0x3d0
+	.long	0x39d6
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3d0
+	.byte	0x2d
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x3d2
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3466
+	.value	0x3cb
+	.byte	0xc
+	.long	0x88
+	.long	0x39ff
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3cb
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x3cb
+	.byte	0x47
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3467
+	.value	0x3c6
+	.long	0x3a23
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3c6
+	.byte	0x38
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x3c6
+	.byte	0x5c
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3468
+	.value	0x3c1
+	.long	0x3a3b
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3c1
+	.byte	0x38
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3469
+	.value	0x3ba
+	.long	0x3a5f
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3ba
+	.byte	0x2c
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x3bc
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3470
+	.value	0x3b5
+	.byte	0xc
+	.long	0x88
+	.long	0x3a88
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3b5
+	.byte	0x35
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x3b5
+	.byte	0x45
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3471
+	.value	0x3b0
+	.long	0x3aac
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3b0
+	.byte	0x36
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x3b0
+	.byte	0x5a
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3472
+	.value	0x3ab
+	.long	0x3ac4
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x3ab
+	.byte	0x36
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3473
+	.value	0x3a4
+	.long	0x3ae8
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x3a4
+	.byte	0x2a
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x3a6
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3474
+	.value	0x39f
+	.byte	0xc
+	.long	0x88
+	.long	0x3b11
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x39f
+	.byte	0x36
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x39f
+	.byte	0x46
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3475
+	.value	0x39a
+	.long	0x3b35
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x39a
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x39a
+	.byte	0x5b
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3476
+	.value	0x394
+	.long	0x3b4d
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x394
+	.byte	0x37
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3477
+	.value	0x38d
+	.long	0x3b71
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x38d
+	.byte	0x2b
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x38f
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3478
+	.value	0x385
+	.byte	0xc
+	.long	0x88
+	.long	0x3bb2
+	.uleb128 0x3
+	.long	.LASF3479
+	.value	0x385
+	.byte	0x30
+	.long	0x32a1
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x385
+	.byte	0x40
+	.long	0x2226
+	.uleb128 0x3
+	.long	.LASF3448
+	.value	0x385
+	.byte	0x4c
+	.long	0x88
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x387
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3480
+	.value	0x37b
+	.long	0x3c08
+	.uleb128 0x3
+	.long	.LASF3481
+	.value	0x37b
+	.byte	0x45
+	.long	0x32a1
+	.uleb128 0x3
+	.long	.LASF3482
+	.value	0x37b
+	.byte	0x5a
+	.long	0x32a1
+	.uleb128 0x3
+	.long	.LASF3483
+	.value	0x37b
+	.byte	0x70
+	.long	0x32a1
+	.uleb128 0x3
+	.long	.LASF3448
+	.value	0x37b
+	.byte	0x7b
+	.long	0x88
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x37d
+	.byte	0xe
+	.long	0x88
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3484
+	.value	0x37f
+	.byte	0x11
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3485
+	.value	0x373
+	.byte	0xc
+	.long	0x88
+	.long	0x3c3d
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x373
+	.byte	0x39
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x373
+	.byte	0x49
+	.long	0x2226
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x375
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3486
+	.value	0x367
+	.long	0x3c79
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x367
+	.byte	0x3a
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x367
+	.byte	0x5e
+	.long	0x2ebf
+	.uleb128 0x6
+	.long	.LASF3487
+	.value	0x36a
+	.byte	0xd
+	.long	0x3c79
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x36c
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xd2
+	.long	0x3c89
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3488
+	.value	0x34c
+	.long	0x3cad
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x34c
+	.byte	0x3a
+	.long	0x2ebf
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x34e
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3489
+	.value	0x329
+	.long	0x3cd1
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x329
+	.byte	0x2e
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x32b
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3490
+	.value	0x30d
+	.byte	0x10
+	.long	0xd2
+	.long	0x3cfa
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x30d
+	.byte	0x3a
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2522
+	.value	0x30d
+	.byte	0x57
+	.long	0x2f48
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3491
+	.value	0x305
+	.byte	0xc
+	.long	0x88
+	.long	0x3d2f
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x305
+	.byte	0x3b
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x305
+	.byte	0x4b
+	.long	0x2226
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"x"
+	.value	0x307
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3492
+	.value	0x2f7
+	.long	0x3d6b
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x2f7
+	.byte	0x3c
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x2f7
+	.byte	0x60
+	.long	0x2ebf
+	.uleb128 0x6
+	.long	.LASF3487
+	.value	0x2fd
+	.byte	0xd
+	.long	0x3d6b
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"x"
+	.value	0x2fe
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xd2
+	.long	0x3d7b
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3493
+	.value	0x2eb
+	.long	0x3d93
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x2eb
+	.byte	0x3c
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3494
+	.value	0x2e4
+	.long	0x3db7
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x2e4
+	.byte	0x30
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x2e6
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3495
+	.value	0x2dc
+	.byte	0xc
+	.long	0x88
+	.long	0x3dec
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x2dc
+	.byte	0x36
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x2dc
+	.byte	0x46
+	.long	0x2226
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x2de
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3496
+	.value	0x2d5
+	.long	0x3e1c
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x2d5
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x2d5
+	.byte	0x5b
+	.long	0x2ebf
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x2d7
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3497
+	.value	0x2ce
+	.long	0x3e40
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x2ce
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x2d0
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3498
+	.value	0x2c7
+	.long	0x3e64
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x2c7
+	.byte	0x2b
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x2c9
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3499
+	.value	0x2bd
+	.byte	0xc
+	.long	0x88
+	.long	0x3e8d
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x2bd
+	.byte	0x36
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x2bd
+	.byte	0x46
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3500
+	.value	0x2b2
+	.long	0x3ebd
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x2b2
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x2b2
+	.byte	0x5b
+	.long	0x2ebf
+	.uleb128 0x6
+	.long	.LASF3487
+	.value	0x2b8
+	.byte	0xd
+	.long	0x15c5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3501
+	.value	0x2ad
+	.long	0x3ed5
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x2ad
+	.byte	0x37
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3502
+	.value	0x2a6
+	.long	0x3ef9
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x2a6
+	.byte	0x2b
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x2a8
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3503
+	.value	0x2a0
+	.byte	0xc
+	.long	0x88
+	.long	0x3f22
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x2a0
+	.byte	0x36
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x2a0
+	.byte	0x46
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3504
+	.value	0x299
+	.long	0x3f52
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x299
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x299
+	.byte	0x5b
+	.long	0x2ebf
+	.uleb128 0x6
+	.long	.LASF3487
+	.value	0x29b
+	.byte	0xd
+	.long	0x15c5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3505
+	.value	0x294
+	.long	0x3f6a
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x294
+	.byte	0x37
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3506
+	.value	0x28d
+	.long	0x3f8e
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x28d
+	.byte	0x2b
+	.long	0x2dd7
+	.uleb128 0xc
+	.uleb128 0xf
+	.string	"i"
+	.value	0x28f
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3507
+	.value	0x287
+	.byte	0xc
+	.long	0x88
+	.long	0x3fb7
+	.uleb128 0x3
+	.long	.LASF3447
+	.value	0x287
+	.byte	0x36
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF2857
+	.value	0x287
+	.byte	0x46
+	.long	0x2226
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3508
+	.value	0x27c
+	.long	0x3fdb
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x27c
+	.byte	0x37
+	.long	0x2ebf
+	.uleb128 0x3
+	.long	.LASF3455
+	.value	0x27c
+	.byte	0x5b
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3509
+	.value	0x276
+	.long	0x3ff3
+	.uleb128 0x3
+	.long	.LASF3454
+	.value	0x276
+	.byte	0x37
+	.long	0x2ebf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3510
+	.value	0x226
+	.long	0x400b
+	.uleb128 0x3
+	.long	.LASF3511
+	.value	0x226
+	.byte	0x2c
+	.long	0x2b00
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3512
+	.value	0x221
+	.byte	0xc
+	.long	0x3cc
+	.long	0x4028
+	.uleb128 0x3
+	.long	.LASF3240
+	.value	0x221
+	.byte	0x3a
+	.long	0x225
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF3513
+	.value	0x217
+	.long	0x4042
+	.uleb128 0xc
+	.uleb128 0x6
+	.long	.LASF3514
+	.value	0x21a
+	.byte	0x22
+	.long	0x225
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3515
+	.value	0x1d0
+	.byte	0xc
+	.long	0x3cc
+	.long	0x405f
+	.uleb128 0x3
+	.long	.LASF3240
+	.value	0x1d0
+	.byte	0x42
+	.long	0x225
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF3516
+	.value	0x1cb
+	.byte	0xc
+	.long	0x3cc
+	.uleb128 0x35
+	.long	.LASF3517
+	.value	0x1c6
+	.long	0x3cc
+	.uleb128 0x35
+	.long	.LASF3518
+	.value	0x1be
+	.long	0x3cc
+	.uleb128 0x15
+	.long	.LASF3519
+	.byte	0x32
+	.byte	0x5f
+	.byte	0x6f
+	.long	0x408d
+	.uleb128 0x7
+	.long	0x271c
+	.uleb128 0x15
+	.long	.LASF3520
+	.byte	0x31
+	.byte	0x33
+	.byte	0x7e
+	.long	0x409e
+	.uleb128 0x7
+	.long	0x25e1
+	.uleb128 0x15
+	.long	.LASF3521
+	.byte	0x30
+	.byte	0x2f
+	.byte	0x7e
+	.long	0x40af
+	.uleb128 0x7
+	.long	0x2536
+	.uleb128 0x36
+	.long	.LASF3522
+	.byte	0x2f
+	.byte	0x4d
+	.byte	0xbb
+	.long	0x40d1
+	.long	0x40d1
+	.uleb128 0x2f
+	.long	.LASF3523
+	.byte	0x2f
+	.byte	0x4d
+	.byte	0xd6
+	.long	0x88
+	.byte	0
+	.uleb128 0x7
+	.long	0x246c
+	.uleb128 0x15
+	.long	.LASF3524
+	.byte	0x2e
+	.byte	0x48
+	.byte	0xab
+	.long	0x40e2
+	.uleb128 0x7
+	.long	0x23ca
+	.uleb128 0x15
+	.long	.LASF3525
+	.byte	0x2d
+	.byte	0x29
+	.byte	0x88
+	.long	0x40f3
+	.uleb128 0x7
+	.long	0x22fb
+	.uleb128 0x15
+	.long	.LASF3526
+	.byte	0x2b
+	.byte	0x48
+	.byte	0x9c
+	.long	0x4104
+	.uleb128 0x7
+	.long	0x21e8
+	.uleb128 0x15
+	.long	.LASF3527
+	.byte	0x25
+	.byte	0x92
+	.byte	0x65
+	.long	0x4115
+	.uleb128 0x7
+	.long	0x1d5f
+	.uleb128 0x15
+	.long	.LASF3528
+	.byte	0x17
+	.byte	0x73
+	.byte	0x6a
+	.long	0x4126
+	.uleb128 0x7
+	.long	0x1949
+	.uleb128 0x15
+	.long	.LASF3529
+	.byte	0x1f
+	.byte	0x62
+	.byte	0x74
+	.long	0x4137
+	.uleb128 0x7
+	.long	0x1808
+	.uleb128 0x15
+	.long	.LASF3530
+	.byte	0x1f
+	.byte	0x58
+	.byte	0x74
+	.long	0x4148
+	.uleb128 0x7
+	.long	0x179c
+	.uleb128 0x15
+	.long	.LASF3531
+	.byte	0x19
+	.byte	0x6a
+	.byte	0x79
+	.long	0x4159
+	.uleb128 0x7
+	.long	0x1416
+	.uleb128 0x15
+	.long	.LASF3532
+	.byte	0x19
+	.byte	0x62
+	.byte	0x83
+	.long	0x416a
+	.uleb128 0x7
+	.long	0x13c4
+	.uleb128 0x15
+	.long	.LASF3533
+	.byte	0x19
+	.byte	0x59
+	.byte	0x8d
+	.long	0x417b
+	.uleb128 0x7
+	.long	0x1365
+	.uleb128 0x36
+	.long	.LASF3534
+	.byte	0x18
+	.byte	0x26
+	.byte	0xa6
+	.long	0x34ca
+	.long	0x419d
+	.uleb128 0x2f
+	.long	.LASF3523
+	.byte	0x18
+	.byte	0x26
+	.byte	0xbe
+	.long	0x88
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3535
+	.byte	0x16
+	.byte	0x59
+	.byte	0x79
+	.long	0x41a9
+	.uleb128 0x7
+	.long	0x1049
+	.uleb128 0x15
+	.long	.LASF3536
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x7e
+	.long	0x41ba
+	.uleb128 0x7
+	.long	0x8f1
+	.uleb128 0x4b
+	.long	.LASF3537
+	.byte	0xb
+	.byte	0x37
+	.byte	0x14
+	.long	0x41d8
+	.uleb128 0x2f
+	.long	.LASF3419
+	.byte	0xb
+	.byte	0x37
+	.byte	0x2a
+	.long	0xe3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3538
+	.byte	0x9
+	.byte	0x35
+	.byte	0xdb
+	.long	0x41e4
+	.uleb128 0x7
+	.long	0x67c
+	.uleb128 0x15
+	.long	.LASF3539
+	.byte	0x9
+	.byte	0x35
+	.byte	0x83
+	.long	0x41f5
+	.uleb128 0x7
+	.long	0x688
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 58 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 59 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3c
+	.file 61 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 63 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 64 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x40
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 67 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 69 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x45
+	.file 70 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 76 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 77 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4e
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 86 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x56
+	.file 87 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 88 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1411
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1412
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.file 89 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 90 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 91 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 92 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x5c
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xe
+	.byte	0x4
+	.file 93 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 94 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x5e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 95 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1606
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x16
+	.file 96 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x60
+	.byte	0x4
+	.file 97 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 99 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.file 100 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x64
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.file 101 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 102 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1999
+	.byte	0x4
+	.file 103 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 104 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x68
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2003
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2004
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.file 105 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2048
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.file 106 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 107 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2210
+	.file 108 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x4
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2213
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2222
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2227
+	.byte	0x4
+	.byte	0x4
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 116 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x75
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x76
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x4
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x78
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x4
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x4
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2265
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2266
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2267
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x7b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2268
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.file 124 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x7c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2280
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.file 125 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x7d
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2287
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2288
+	.byte	0x4
+	.file 126 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2289
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 127 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7f
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 128 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x80
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2292
+	.byte	0x4
+	.file 129 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x81
+	.file 130 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x82
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2293
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2327
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2328
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x30
+	.file 131 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2e
+	.file 132 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x84
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.file 133 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x85
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.file 134 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x86
+	.file 135 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x87
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2344
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x65c
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x65f
+	.long	.LASF2361
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1437
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_compress.h.32.db9d67464cf7dd3c4de956009bb63da8,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1440
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_encoding.h.21.6b5a7223d6e4ab47a21397b1e9a5f416,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.30.0a00ae9199efd475f4080a54886f9f0b,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.cda5e1a8f37a08b4f46fc428ef372810,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1470
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1510
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1605
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1608
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1610
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1630
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2039
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2047
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2054
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2119
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2209
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2219
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2221
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2242
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2259
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2279
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2286
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2291
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2323
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2332
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2336
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2339
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2343
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x17
+	.long	.LASF1
+	.long	.LASF3541
+	.long	.LASF3542
+	.long	.LASF3543
+	.long	.LASF3544
+	.long	.LASF3545
+	.long	.LASF3546
+	.long	.LASF3547
+	.long	.LASF3548
+	.long	.LASF3549
+	.long	.LASF3550
+	.long	.LASF3551
+	.long	.LASF3552
+	.long	.LASF3553
+	.long	.LASF3554
+	.long	.LASF3555
+	.long	.LASF3556
+	.long	.LASF3557
+	.long	.LASF3558
+	.long	.LASF3559
+	.long	.LASF3560
+	.long	.LASF3561
+	.long	.LASF3562
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x88
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3563
+	.byte	0x12
+	.long	.LASF3564
+	.byte	0x12
+	.long	.LASF3565
+	.byte	0x12
+	.long	.LASF3566
+	.byte	0x16
+	.long	.LASF3567
+	.byte	0xe
+	.long	.LASF3568
+	.byte	0x1
+	.long	.LASF3569
+	.byte	0x3
+	.long	.LASF3570
+	.byte	0x4
+	.long	.LASF3571
+	.byte	0x1
+	.long	.LASF3572
+	.byte	0x1
+	.long	.LASF3573
+	.byte	0x1
+	.long	.LASF3574
+	.byte	0x2
+	.long	.LASF3575
+	.byte	0x2
+	.long	.LASF3576
+	.byte	0x4
+	.long	.LASF3577
+	.byte	0x8
+	.long	.LASF3578
+	.byte	0x8
+	.long	.LASF3579
+	.byte	0x8
+	.long	.LASF3580
+	.byte	0x8
+	.long	.LASF3581
+	.byte	0x5
+	.long	.LASF3582
+	.byte	0x8
+	.long	.LASF3583
+	.byte	0x8
+	.long	.LASF3584
+	.byte	0x9
+	.long	.LASF3585
+	.byte	0xa
+	.long	.LASF3586
+	.byte	0x9
+	.long	.LASF3587
+	.byte	0x9
+	.long	.LASF3588
+	.byte	0x9
+	.long	.LASF3589
+	.byte	0x9
+	.long	.LASF3590
+	.byte	0xa
+	.long	.LASF3591
+	.byte	0xa
+	.long	.LASF3592
+	.byte	0x8
+	.long	.LASF3593
+	.byte	0xa
+	.long	.LASF3594
+	.byte	0xa
+	.long	.LASF3595
+	.byte	0xa
+	.long	.LASF3596
+	.byte	0xb
+	.long	.LASF3597
+	.byte	0xb
+	.long	.LASF3583
+	.byte	0xb
+	.long	.LASF3598
+	.byte	0xc
+	.long	.LASF3599
+	.byte	0x5
+	.long	.LASF3600
+	.byte	0x12
+	.long	.LASF3601
+	.byte	0x12
+	.long	.LASF3602
+	.byte	0x12
+	.long	.LASF3603
+	.byte	0xd
+	.long	.LASF3604
+	.byte	0xd
+	.long	.LASF3605
+	.byte	0x6
+	.long	.LASF3605
+	.byte	0xd
+	.long	.LASF3606
+	.byte	0xd
+	.long	.LASF3607
+	.byte	0xd
+	.long	.LASF3608
+	.byte	0xd
+	.long	.LASF3609
+	.byte	0xd
+	.long	.LASF3610
+	.byte	0xd
+	.long	.LASF3611
+	.byte	0x1
+	.long	.LASF3612
+	.byte	0x15
+	.long	.LASF3613
+	.byte	0x3
+	.long	.LASF3614
+	.byte	0x1
+	.long	.LASF3615
+	.byte	0x3
+	.long	.LASF3616
+	.byte	0x12
+	.long	.LASF3569
+	.byte	0x8
+	.long	.LASF3617
+	.byte	0x15
+	.long	.LASF3618
+	.byte	0x16
+	.long	.LASF3619
+	.byte	0x16
+	.long	.LASF3619
+	.byte	0x15
+	.long	.LASF3620
+	.byte	0x12
+	.long	.LASF3621
+	.byte	0x15
+	.long	.LASF3622
+	.byte	0x15
+	.long	.LASF3623
+	.byte	0x12
+	.long	.LASF3624
+	.byte	0x12
+	.long	.LASF3625
+	.byte	0x14
+	.long	.LASF3626
+	.byte	0x12
+	.long	.LASF3627
+	.byte	0x13
+	.long	.LASF3628
+	.byte	0x13
+	.long	.LASF3629
+	.byte	0x12
+	.long	.LASF3630
+	.byte	0x12
+	.long	.LASF3631
+	.byte	0x12
+	.long	.LASF3632
+	.byte	0x11
+	.long	.LASF3633
+	.byte	0x11
+	.long	.LASF3634
+	.byte	0x15
+	.long	.LASF3635
+	.byte	0x15
+	.long	.LASF3636
+	.byte	0x12
+	.long	.LASF3637
+	.byte	0x12
+	.long	.LASF3638
+	.byte	0x12
+	.long	.LASF3639
+	.byte	0x12
+	.long	.LASF3640
+	.byte	0x12
+	.long	.LASF3641
+	.byte	0x12
+	.long	.LASF3642
+	.byte	0x12
+	.long	.LASF3643
+	.byte	0x12
+	.long	.LASF3644
+	.byte	0x10
+	.long	.LASF3645
+	.byte	0xf
+	.long	.LASF3646
+	.byte	0xf
+	.long	.LASF3647
+	.byte	0x2
+	.long	.LASF3648
+	.byte	0x2
+	.long	.LASF3649
+	.byte	0x3
+	.long	.LASF3650
+	.byte	0x3
+	.long	.LASF3651
+	.byte	0x4
+	.long	.LASF3609
+	.byte	0x7
+	.long	.LASF3652
+	.byte	0x8
+	.long	.LASF3653
+	.byte	0x8
+	.long	.LASF3654
+	.byte	0x8
+	.long	.LASF3655
+	.byte	0x8
+	.long	.LASF3656
+	.byte	0x8
+	.long	.LASF3657
+	.byte	0x8
+	.long	.LASF3658
+	.byte	0x8
+	.long	.LASF3659
+	.byte	0x8
+	.long	.LASF3660
+	.byte	0x8
+	.long	.LASF3661
+	.byte	0x8
+	.long	.LASF3662
+	.byte	0x8
+	.long	.LASF3663
+	.byte	0x8
+	.long	.LASF3664
+	.byte	0x15
+	.long	.LASF3665
+	.byte	0x15
+	.long	.LASF3666
+	.byte	0x11
+	.long	.LASF3667
+	.byte	0x11
+	.long	.LASF3668
+	.byte	0x12
+	.long	.LASF3669
+	.byte	0x12
+	.long	.LASF3665
+	.byte	0x12
+	.long	.LASF3670
+	.byte	0x11
+	.long	.LASF3671
+	.byte	0x12
+	.long	.LASF3569
+	.byte	0x15
+	.long	.LASF3569
+	.byte	0x12
+	.long	.LASF3672
+	.byte	0x11
+	.long	.LASF3673
+	.byte	0x11
+	.long	.LASF3674
+	.byte	0x11
+	.long	.LASF3675
+	.byte	0x11
+	.long	.LASF3676
+	.byte	0x11
+	.long	.LASF3677
+	.byte	0x12
+	.long	.LASF3678
+	.byte	0x12
+	.long	.LASF3679
+	.byte	0x12
+	.long	.LASF3680
+	.byte	0x12
+	.long	.LASF3681
+	.byte	0x11
+	.long	.LASF3682
+	.byte	0x11
+	.long	.LASF3683
+	.byte	0x12
+	.long	.LASF3684
+	.byte	0x12
+	.long	.LASF3685
+	.byte	0x3
+	.long	.LASF3686
+	.byte	0xd
+	.long	.LASF3687
+	.byte	0xd
+	.long	.LASF3688
+	.byte	0xd
+	.long	.LASF3689
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2170:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF2808:
+	.string	"BOXMAG"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2820:
+	.string	"BOXCALIB"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1743:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2565:
+	.string	"ioTag_t"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2676:
+	.string	"rxBufferHead"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF2877:
+	.string	"MIXER_HEX6X"
+.LASF3402:
+	.string	"motorOutputLowInt"
+.LASF1949:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1657:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1637:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF3236:
+	.string	"predict"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2074:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF3463:
+	.string	"writeInterMotors"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF2814:
+	.string	"BOXGPSHOLD"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2455:
+	.string	"floatFlag"
+.LASF3477:
+	.string	"loadGyro"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1827:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF2011:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2233:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF3002:
+	.string	"rcmap"
+.LASF3032:
+	.string	"mpuConfiguration_s"
+.LASF3036:
+	.string	"mpuConfiguration_t"
+.LASF3004:
+	.string	"sbus_inversion"
+.LASF2365:
+	.string	"long unsigned int"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF2988:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1794:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1651:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1998:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF3303:
+	.string	"blackboxHistoryRing"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF2813:
+	.string	"BOXGPSHOME"
+.LASF1862:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF3256:
+	.string	"BLACKBOX_STATE_PREPARE_LOG_FILE"
+.LASF3304:
+	.string	"blackboxHistory"
+.LASF2719:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF3359:
+	.string	"blackboxDevicePrepareLog"
+.LASF2313:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2187:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2121:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF3530:
+	.string	"mixerConfig"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1775:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2157:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF3487:
+	.string	"deltas"
+.LASF2736:
+	.string	"pidSumLimitYaw"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1478:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2086:
+	.string	"LON 1"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2479:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF2215:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2059:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF380:
+	.string	"__unix 1"
+.LASF3483:
+	.string	"prev2"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF2559:
+	.string	"buildDate"
+.LASF2489:
+	.string	"BlackboxDevice"
+.LASF2764:
+	.string	"dynThrPID"
+.LASF2786:
+	.string	"alt_hold_fast_change"
+.LASF1845:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF3482:
+	.string	"prev1"
+.LASF2470:
+	.string	"flightMode"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1744:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF3504:
+	.string	"writeInterPidP"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF3011:
+	.string	"spektrum_sat_bind"
+.LASF1688:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF3382:
+	.string	"memset"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2063:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF3439:
+	.string	"shouldWrite"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF3464:
+	.string	"writeIntraMotors"
+.LASF3407:
+	.string	"deltaFrameChar"
+.LASF2457:
+	.string	"newFloatValue"
+.LASF2504:
+	.string	"record_acc"
+.LASF2104:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF3259:
+	.string	"BLACKBOX_STATE_SEND_GPS_H_HEADER"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2168:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF3188:
+	.string	"gyroADCf"
+.LASF2410:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_LAST"
+.LASF1680:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1896:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2035:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2742:
+	.string	"horizon_tilt_effect"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2114:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF2419:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_INC"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF2832:
+	.string	"BOX3DDISABLE"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF3177:
+	.string	"mag_t"
+.LASF2339:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF3350:
+	.string	"isBlackboxErased"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2065:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF2407:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_DEBUG"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2357:
+	.string	"BLACKBOX_SIMPLE_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF3513:
+	.string	"blackboxBuildConditionCache"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1707:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2987:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF2725:
+	.string	"name"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2962:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1732:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF2815:
+	.string	"BOXPASSTHRU"
+.LASF2948:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF3306:
+	.string	"blackboxCompressState"
+.LASF2174:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF2747:
+	.string	"dtermSetpointWeight"
+.LASF1509:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF2324:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2649:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2145:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1517:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1665:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2755:
+	.string	"crash_recovery"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1427:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1482:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1619:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF3338:
+	.string	"blackboxMainFieldConditions"
+.LASF2061:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1476:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1546:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF3131:
+	.string	"baroTemperature"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF3388:
+	.string	"resume"
+.LASF2718:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1592:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF3362:
+	.string	"blackboxPrint"
+.LASF2687:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF2978:
+	.string	"GPS_altitude"
+.LASF3476:
+	.string	"writeIntraGyro"
+.LASF3325:
+	.string	"BLACKBOX_SENSOR_BARO"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF3524:
+	.string	"currentSensorADCConfig"
+.LASF2293:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1438:
+	.string	"BLACKBOX_COMPRESS_MAX_FIELDS 48"
+.LASF2590:
+	.string	"sensorAccInitFuncPtr"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF3080:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2341:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1872:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1666:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1413:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF3082:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2743:
+	.string	"horizon_tilt_expert_mode"
+.LASF3316:
+	.string	"loadValues"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2550:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF2618:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1454:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF2381:
+	.string	"uint32_t"
+.LASF1621:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF3114:
+	.string	"up_delay"
+.LASF1739:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2422:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_VBATREF"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1810:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1928:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1767:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2931:
+	.string	"axisPID_D"
+.LASF2428:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB"
+.LASF2023:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF2930:
+	.string	"axisPID_I"
+.LASF3488:
+	.string	"writeIntraSensors"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF3537:
+	.string	"blackboxWrite"
+.LASF2929:
+	.string	"axisPID_P"
+.LASF2225:
+	.string	"SCHED_FIFO 1"
+.LASF2007:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF2574:
+	.string	"instance"
+.LASF3012:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF1979:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2792:
+	.string	"deadband3d_high"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1515:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2970:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF3050:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF3401:
+	.string	"blackboxWriteSysinfo"
+.LASF3113:
+	.string	"ut_delay"
+.LASF3279:
+	.string	"flightModeFlags"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2154:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2890:
+	.string	"MIXER_CUSTOM"
+.LASF2430:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF3518:
+	.string	"blackboxMayEditConfig"
+.LASF3010:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2095:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1790:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF3421:
+	.string	"blackboxCurrent"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF2196:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF3380:
+	.string	"feature"
+.LASF3536:
+	.string	"featureConfig"
+.LASF1878:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF1578:
+	.string	"PG_PWM_CONFIG 508"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2232:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF2492:
+	.string	"BLACKBOX_DEVICE_SERIAL"
+.LASF2990:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF3206:
+	.string	"dyn_notch_window"
+.LASF1557:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1503:
+	.string	"BIT(x) (1 << (x))"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF3280:
+	.string	"failsafePhase"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1916:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2692:
+	.string	"serialPort_t"
+.LASF2331:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1795:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF1883:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2936:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF3396:
+	.string	"blackboxCheckAndLogArmingBeep"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1633:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1905:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2348:
+	.string	"SLOW_FRAME_INTERVAL 4096"
+.LASF2310:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2858:
+	.string	"attitudeEulerAngles_t"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2135:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF1841:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1548:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1982:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1608:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2029:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2810:
+	.string	"BOXHEADADJ"
+.LASF2055:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF2912:
+	.string	"PID_POS"
+.LASF3094:
+	.string	"accSamplingInterval"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF3281:
+	.string	"rxSignalReceived"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2159:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2895:
+	.string	"yaw_motors_reversed"
+.LASF2878:
+	.string	"MIXER_OCTOX8"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF3324:
+	.string	"BLACKBOX_SENSOR_MAG_Z"
+.LASF2352:
+	.string	"CONDITION(x) CONCAT(FLIGHT_LOG_FIELD_CONDITION_, x)"
+.LASF1568:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF3235:
+	.string	"isSigned"
+.LASF3015:
+	.string	"rssi_invert"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1919:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1977:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF2206:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF2218:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2612:
+	.string	"OWNER_ADC_EXT"
+.LASF1731:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2100:
+	.string	"PWM_PULSE_MIN 750"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1892:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF514:
+	.string	"__wur "
+.LASF2537:
+	.string	"DEBUG_GYRO"
+.LASF1554:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1853:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3290:
+	.string	"fieldIndex"
+.LASF2423:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME"
+.LASF2653:
+	.string	"MODE_RXTX"
+.LASF1616:
+	.string	"IOCFG_IPD 0"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2703:
+	.string	"FEATURE_3D"
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1703:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1784:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2172:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2243:
+	.string	"sched_priority sched_priority"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF1994:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF3247:
+	.string	"group"
+.LASF2037:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF2201:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF3478:
+	.string	"loadValuesInt16Array"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2484:
+	.string	"size"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1922:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF3284:
+	.string	"motorOutputHigh"
+.LASF1585:
+	.string	"PG_VTX_CONFIG 515"
+.LASF3229:
+	.string	"blackboxHeader"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1943:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF3323:
+	.string	"BLACKBOX_SENSOR_MAG_Y"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1588:
+	.string	"PG_I2C_CONFIG 518"
+.LASF3308:
+	.string	"blackboxProfile"
+.LASF1907:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF3267:
+	.string	"BLACKBOX_STATE_ERASING"
+.LASF3346:
+	.string	"blackboxPrintfHeaderLine"
+.LASF1758:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2120:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF2158:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF3443:
+	.string	"writeSlowFrame"
+.LASF2972:
+	.string	"BEEPER_PREFERENCE"
+.LASF3009:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1679:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1465:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2766:
+	.string	"tpa_breakpoint"
+.LASF2802:
+	.string	"armingConfig_System"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF1754:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2812:
+	.string	"BOXCAMTRIG"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2126:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1577:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1579:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF3538:
+	.string	"blackboxConfigMutable"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1611:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2675:
+	.string	"txBuffer"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF2635:
+	.string	"OWNER_MPU_EXTI"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF2835:
+	.string	"BOXCAMERA1"
+.LASF555:
+	.string	"__stub_stty "
+.LASF2837:
+	.string	"BOXCAMERA3"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2382:
+	.string	"size_t"
+.LASF2582:
+	.string	"CW90_DEG"
+.LASF1598:
+	.string	"IO_TAG_NONE 0"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1910:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF3018:
+	.string	"maxcheck"
+.LASF1702:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1640:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1720:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2561:
+	.string	"featureConfig_s"
+.LASF2563:
+	.string	"featureConfig_t"
+.LASF721:
+	.string	"NULL"
+.LASF3423:
+	.string	"blackboxAdvanceIterationTimers"
+.LASF3034:
+	.string	"resetFn"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF1583:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2599:
+	.string	"accAlign"
+.LASF3437:
+	.string	"blackboxValidateConfig"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2606:
+	.string	"OWNER_MOTOR"
+.LASF2151:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2094:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2439:
+	.string	"FlightLogEvent"
+.LASF2966:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1449:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2941:
+	.string	"INPUT_RC_THROTTLE"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF3249:
+	.string	"blackboxMainFields"
+.LASF2690:
+	.string	"beginWrite"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF723:
+	.string	"__need_NULL"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3014:
+	.string	"rssi_scale"
+.LASF1520:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF2928:
+	.string	"pidConfig_System"
+.LASF3318:
+	.string	"fieldListCount"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1954:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2332:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF3398:
+	.string	"event"
+.LASF2611:
+	.string	"OWNER_ADC_CURR"
+.LASF2194:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF3173:
+	.string	"batteryConfig_System"
+.LASF1544:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF3508:
+	.string	"writeInterTime"
+.LASF2906:
+	.string	"motor_disarmed"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF3356:
+	.string	"blackboxDeviceFlushForce"
+.LASF1913:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2171:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF2826:
+	.string	"BOXSERVO1"
+.LASF1639:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2828:
+	.string	"BOXSERVO3"
+.LASF3199:
+	.string	"gyro_use_32khz"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2738:
+	.string	"vbatPidCompensation"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2002:
+	.string	"BEEP_ON do {} while (0)"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF3052:
+	.string	"mpu6050Resolution_e"
+.LASF1846:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2070:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF2277:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF3422:
+	.string	"writeGPSFrame"
+.LASF3327:
+	.string	"BLACKBOX_SENSOR_COUNT"
+.LASF3337:
+	.string	"blackboxActiveEncoderCount"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2038:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF3212:
+	.string	"BLACKBOX_FIELDS_TIME"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF3343:
+	.string	"blackboxCompressReset"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2343:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1511:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2975:
+	.string	"gpsLocation_t"
+.LASF3334:
+	.string	"blackboxMotorCount"
+.LASF3353:
+	.string	"blackboxEraseAll"
+.LASF2616:
+	.string	"OWNER_PINDEBUG"
+.LASF1778:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2284:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF3253:
+	.string	"BlackboxState"
+.LASF1944:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF3374:
+	.string	"blackboxWriteSignedVB"
+.LASF2552:
+	.string	"DEBUG_ALTITUDE"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF3163:
+	.string	"vbatwarningcellvoltage"
+.LASF3484:
+	.string	"predictor"
+.LASF2605:
+	.string	"OWNER_PPMINPUT"
+.LASF3293:
+	.string	"xmitState"
+.LASF3181:
+	.string	"mag_hardware"
+.LASF2349:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ]"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2303:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2883:
+	.string	"MIXER_HELI_90_DEG"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF3315:
+	.string	"writeInter"
+.LASF1559:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2863:
+	.string	"motorPwmInversion"
+.LASF3360:
+	.string	"blackboxOpen"
+.LASF2922:
+	.string	"pidCrashRecovery_e"
+.LASF1573:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2231:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2285:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2689:
+	.string	"writeBuf"
+.LASF1956:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1689:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2894:
+	.string	"mixerConfig_s"
+.LASF2386:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_ALWAYS"
+.LASF2261:
+	.string	"__struct_tm_defined 1"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1610:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2230:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1877:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"TIMER_ABSTIME 1"
+.LASF2500:
+	.string	"rate_num"
+.LASF3065:
+	.string	"__owner"
+.LASF2240:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF2337:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF3313:
+	.string	"load"
+.LASF1929:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF3393:
+	.string	"blackboxLogIteration"
+.LASF2108:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1766:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF3134:
+	.string	"CURRENT_METER_NONE"
+.LASF2204:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF3061:
+	.string	"__pthread_list_t"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3020:
+	.string	"rcInterpolationChannels"
+.LASF2220:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF3125:
+	.string	"baro_cf_vel"
+.LASF3531:
+	.string	"armingConfig"
+.LASF2541:
+	.string	"DEBUG_PIDLOOP"
+.LASF1904:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1869:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1471:
+	.string	"sq(x) ((x)*(x))"
+.LASF1740:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2532:
+	.string	"debug"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1545:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1782:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2265:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF3139:
+	.string	"CURRENT_METER_MAX"
+.LASF2490:
+	.string	"BLACKBOX_DEVICE_NONE"
+.LASF1642:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF3257:
+	.string	"BLACKBOX_STATE_SEND_HEADER"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2686:
+	.string	"serialSetBaudRate"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2854:
+	.string	"failsafePhase_e"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2016:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF2872:
+	.string	"MIXER_GIMBAL"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF2368:
+	.string	"__uint8_t"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2474:
+	.string	"flightLogEventData_t"
+.LASF2577:
+	.string	"flightLogEventData_u"
+.LASF2351:
+	.string	"ENCODING(x) CONCAT(FLIGHT_LOG_FIELD_ENCODING_, x)"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2662:
+	.string	"SERIAL_BIDIR"
+.LASF1817:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF3351:
+	.string	"beeper"
+.LASF2014:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2274:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF2041:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2598:
+	.string	"lock"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3496:
+	.string	"writeInterPidD"
+.LASF2728:
+	.string	"pidProfile_s"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF3500:
+	.string	"writeInterPidI"
+.LASF382:
+	.string	"unix 1"
+.LASF1648:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2666:
+	.string	"serialPort_s"
+.LASF3165:
+	.string	"voltageMeterSource"
+.LASF2892:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF1836:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2298:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2557:
+	.string	"targetName"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF3242:
+	.string	"blackboxDeltaFieldDefinition_s"
+.LASF3248:
+	.string	"blackboxDeltaFieldDefinition_t"
+.LASF2502:
+	.string	"device"
+.LASF2660:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF3391:
+	.string	"blackboxShouldLogIFrame"
+.LASF1606:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF1751:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1809:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1525:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF2697:
+	.string	"FEATURE_SERVO_TILT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF1730:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1722:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF2806:
+	.string	"BOXBARO"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF3266:
+	.string	"BLACKBOX_STATE_START_ERASE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF3389:
+	.string	"currentTimeUs"
+.LASF2401:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_RSSI"
+.LASF2199:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF2971:
+	.string	"BEEPER_ALL"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1501:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1842:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2315:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF3040:
+	.string	"MPU_60x0_SPI"
+.LASF2046:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1757:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF2638:
+	.string	"OWNER_USB_DETECT"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF1632:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2963:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF2957:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF3371:
+	.string	"lrintf"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2626:
+	.string	"OWNER_SDCARD"
+.LASF1493:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF2805:
+	.string	"BOXHORIZON"
+.LASF2416:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2643:
+	.string	"OWNER_LED_STRIP"
+.LASF3409:
+	.string	"secondFieldDefinition"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1785:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2708:
+	.string	"FEATURE_DASHBOARD"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1893:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF1615:
+	.string	"IOCFG_AF_OD 0"
+.LASF2648:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF3049:
+	.string	"mpuSensor_e"
+.LASF2800:
+	.string	"auto_disarm_delay"
+.LASF2871:
+	.string	"MIXER_BICOPTER"
+.LASF1971:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2977:
+	.string	"numSat"
+.LASF2969:
+	.string	"BEEPER_USB"
+.LASF2833:
+	.string	"BOXFPVANGLEMIX"
+.LASF2947:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF3148:
+	.string	"VOLTAGE_METER_ESC"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2760:
+	.string	"rcExpo8"
+.LASF3451:
+	.string	"enabledCount"
+.LASF2886:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2190:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF2678:
+	.string	"txBufferHead"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF3329:
+	.string	"blackboxPidDAxes"
+.LASF2955:
+	.string	"BEEPER_DISARMING"
+.LASF2698:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1704:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF3030:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF2949:
+	.string	"inputSource_e"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2110:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF3119:
+	.string	"calculate"
+.LASF1843:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2665:
+	.string	"serialReceiveCallbackPtr"
+.LASF1572:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1662:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF3107:
+	.string	"accelerometerTrims"
+.LASF1708:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF3400:
+	.string	"blackboxShouldLogPFrame"
+.LASF2497:
+	.string	"BLACKBOX_PROFILE_COUNT"
+.LASF2476:
+	.string	"timeUs_t"
+.LASF2973:
+	.string	"beeperMode_e"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF2822:
+	.string	"BOXOSD"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2049:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF3288:
+	.string	"blackboxLastArmingBeep"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2935:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2824:
+	.string	"BOXGTUNE"
+.LASF2603:
+	.string	"OWNER_FREE"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2993:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF3312:
+	.string	"blackboxMainEncoder_s"
+.LASF3319:
+	.string	"blackboxMainEncoder_t"
+.LASF1446:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF2085:
+	.string	"LAT 0"
+.LASF2087:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2217:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2443:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1797:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF2437:
+	.string	"FLIGHT_LOG_FIELD_UNSIGNED"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2179:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2540:
+	.string	"DEBUG_AIRMODE"
+.LASF2185:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1508:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1819:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF3406:
+	.string	"mainFrameChar"
+.LASF2921:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF1995:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2539:
+	.string	"DEBUG_MIXER"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF2323:
+	.string	"GYRO_LPF_NONE 7"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2691:
+	.string	"endWrite"
+.LASF3207:
+	.string	"dyn_notch_peaks"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1441:
+	.string	"BLACKBOX_VB_MAX_BYTES 5"
+.LASF3352:
+	.string	"blackboxDeviceFlush"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF3368:
+	.string	"blackboxWriteTag8_4S16"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF3105:
+	.string	"acc_hardware"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1920:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF2237:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2740:
+	.string	"levelAngleLimit"
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF2084:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF3271:
+	.string	"vbatLatest"
+.LASF1652:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF3174:
+	.string	"mag_s"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF3156:
+	.string	"vbatresdivval"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2387:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1"
+.LASF2388:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2"
+.LASF2389:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF2391:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5"
+.LASF2392:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6"
+.LASF2393:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7"
+.LASF2394:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2984:
+	.string	"FUNCTION_NONE"
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF3243:
+	.string	"Ipredict"
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2122:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF3028:
+	.string	"rxConfig_System"
+.LASF2414:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS"
+.LASF3162:
+	.string	"vbatmincellvoltage"
+.LASF2098:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF2950:
+	.string	"servo"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF3493:
+	.string	"writeIntraRcCommand"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2784:
+	.string	"yaw_deadband"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1663:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2727:
+	.string	"systemConfig_System"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF3450:
+	.string	"encoder"
+.LASF2256:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1596:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1947:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1787:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF3221:
+	.string	"BLACKBOX_FIELDS_ATTITUDE"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2113:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF2192:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1436:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF1965:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2715:
+	.string	"FEATURE_RX_SPI"
+.LASF2564:
+	.string	"featureConfig_System"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1620:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1868:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2882:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF2433:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_NULL"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2064:
+	.string	"ALL_MOTORS 255"
+.LASF1510:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1547:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2181:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF1643:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2607:
+	.string	"OWNER_SERVO"
+.LASF3126:
+	.string	"baro_cf_alt"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF3262:
+	.string	"BLACKBOX_STATE_SEND_SYSINFO"
+.LASF3019:
+	.string	"rcInterpolation"
+.LASF2769:
+	.string	"rc_alias"
+.LASF1628:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF3440:
+	.string	"newSlowState"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1507:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2283:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1774:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1860:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2699:
+	.string	"FEATURE_GPS"
+.LASF1433:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2079:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2620:
+	.string	"OWNER_SYSTEM"
+.LASF1781:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1773:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF3520:
+	.string	"compassConfig"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF3096:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF2859:
+	.string	"attitude"
+.LASF1968:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2527:
+	.string	"blackboxBufferReserveStatus_e"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2072:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF2893:
+	.string	"MIXER_QUADX_1234"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF3122:
+	.string	"baro_hardware"
+.LASF1953:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF3428:
+	.string	"atLeastOneMotorActivated"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF3170:
+	.string	"consumptionWarningPercentage"
+.LASF2116:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2544:
+	.string	"DEBUG_VELOCITY"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2659:
+	.string	"SERIAL_PARITY_NO"
+.LASF1695:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF2811:
+	.string	"BOXCAMSTAB"
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2521:
+	.string	"fieldCount"
+.LASF2836:
+	.string	"BOXCAMERA2"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF3462:
+	.string	"loadValuesMotors"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2176:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2650:
+	.string	"portMode_t"
+.LASF2272:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1889:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF2269:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1686:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF2819:
+	.string	"BOXLLIGHTS"
+.LASF3379:
+	.string	"isModeActivationConditionPresent"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2672:
+	.string	"rxBufferSize"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF1636:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2148:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF3228:
+	.string	"blackboxProfiles"
+.LASF3441:
+	.string	"loadSlowState"
+.LASF1412:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2889:
+	.string	"MIXER_ATAIL4"
+.LASF3433:
+	.string	"blackboxFinish"
+.LASF2917:
+	.string	"PID_VEL"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1700:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2138:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2861:
+	.string	"motorPwmRate"
+.LASF1721:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1713:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2636:
+	.string	"OWNER_BARO_EXTI"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF3178:
+	.string	"compassConfig_s"
+.LASF3481:
+	.string	"curr"
+.LASF2587:
+	.string	"CW180_DEG_FLIP"
+.LASF2507:
+	.string	"mode_profile"
+.LASF1452:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2371:
+	.string	"__uint16_t"
+.LASF2160:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF3258:
+	.string	"BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER"
+.LASF2384:
+	.string	"double"
+.LASF2908:
+	.string	"PID_ROLL"
+.LASF1852:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1464:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2791:
+	.string	"deadband3d_low"
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1535:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF3331:
+	.string	"blackboxSensorFields"
+.LASF377:
+	.string	"__linux 1"
+.LASF3456:
+	.string	"writeIntraAttitude"
+.LASF2629:
+	.string	"OWNER_FLASH_CS"
+.LASF1566:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2309:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1997:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF1885:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2191:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1821:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1477:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1729:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF2338:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF3161:
+	.string	"vbatmaxcellvoltage"
+.LASF2632:
+	.string	"OWNER_OSD_CS"
+.LASF2511:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_PREVIOUS"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1440:
+	.string	"BLACKBOX_COMPRESS_MAX_RICE_BITS 24"
+.LASF1565:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF2044:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF3048:
+	.string	"BMI_160_SPI"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF3191:
+	.string	"gyroConfig_s"
+.LASF3208:
+	.string	"gyroConfig_t"
+.LASF2533:
+	.string	"debugMode"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF3376:
+	.string	"getMotorCount"
+.LASF3344:
+	.string	"memcmp"
+.LASF3302:
+	.string	"slowHistory"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2916:
+	.string	"PID_MAG"
+.LASF2006:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1991:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2729:
+	.string	"dterm_filter_type"
+.LASF2115:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF1661:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2143:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF3129:
+	.string	"baro_s"
+.LASF3132:
+	.string	"baro_t"
+.LASF1486:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF3017:
+	.string	"mincheck"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1635:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF3295:
+	.string	"blackboxIteration"
+.LASF1423:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF3066:
+	.string	"__nusers"
+.LASF1802:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF1518:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1526:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2512:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_STRAIGHT_LINE"
+.LASF2667:
+	.string	"vTable"
+.LASF720:
+	.string	"__need_size_t"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2163:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2244:
+	.string	"__sched_priority sched_priority"
+.LASF2052:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1917:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF3455:
+	.string	"last"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF2412:
+	.string	"FlightLogFieldPredictor"
+.LASF3138:
+	.string	"CURRENT_METER_MSP"
+.LASF2683:
+	.string	"serialTotalRxWaiting"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF3095:
+	.string	"accSmooth"
+.LASF1435:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF2458:
+	.string	"_Bool"
+.LASF3059:
+	.string	"__prev"
+.LASF3037:
+	.string	"MPU_NONE"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2325:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2090:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2060:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF3246:
+	.string	"Pencode"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF2413:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_0"
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2798:
+	.string	"gyro_cal_on_first_arm"
+.LASF2525:
+	.string	"BLACKBOX_RESERVE_TEMPORARY_FAILURE"
+.LASF2036:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF3466:
+	.string	"loadValuesDebug"
+.LASF2796:
+	.string	"flight3DConfig_System"
+.LASF2222:
+	.string	"__pid_t_defined "
+.LASF3431:
+	.string	"startInTestMode"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF3435:
+	.string	"blackboxResetIterationTimers"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2136:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2919:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF3525:
+	.string	"barometerConfig"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF3367:
+	.string	"memcpy"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1973:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2840:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2071:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1613:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1542:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF3299:
+	.string	"blackboxLoggedAnyFrames"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2661:
+	.string	"SERIAL_UNIDIR"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2733:
+	.string	"dterm_notch_cutoff"
+.LASF2027:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF515:
+	.string	"__always_inline"
+.LASF2286:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF3264:
+	.string	"BLACKBOX_STATE_RUNNING"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2576:
+	.string	"deviceI2C_s"
+.LASF1654:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF3118:
+	.string	"get_up"
+.LASF1626:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF3158:
+	.string	"voltageSensorADCConfig_t"
+.LASF2101:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF3116:
+	.string	"get_ut"
+.LASF1911:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2177:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2482:
+	.string	"pgResetFunc"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1603:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2347:
+	.string	"BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200"
+.LASF2327:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF2518:
+	.string	"residualSum"
+.LASF2901:
+	.string	"maxthrottle"
+.LASF2317:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF3364:
+	.string	"blackboxWriteSignedVBArray"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF398:
+	.string	"false 0"
+.LASF2356:
+	.string	"BLACKBOX_DELTA_FIELD_HEADER_COUNT ARRAYLEN(blackboxFieldHeaderNames)"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2224:
+	.string	"SCHED_OTHER 0"
+.LASF1792:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1976:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2142:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF3055:
+	.string	"resolution"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1832:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF3274:
+	.string	"blackboxGpsState_s"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF2251:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF1824:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1737:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF3392:
+	.string	"pFrameIndex"
+.LASF1854:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1513:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2043:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3087:
+	.string	"SENSOR_ACC"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2248:
+	.string	"CLOCK_REALTIME 0"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2663:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1555:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1859:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2964:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF3301:
+	.string	"gpsHistory"
+.LASF3540:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF2304:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF3472:
+	.string	"writeIntraAcc"
+.LASF3244:
+	.string	"Iencode"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2722:
+	.string	"activeRateProfile"
+.LASF1762:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2961:
+	.string	"BEEPER_RX_SET"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF3445:
+	.string	"writeIntraframe"
+.LASF1818:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2491:
+	.string	"BLACKBOX_DEVICE_FLASH"
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1788:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF2986:
+	.string	"FUNCTION_GPS"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF1964:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2281:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1851:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1505:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1629:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF3336:
+	.string	"blackboxActiveEncoders"
+.LASF2209:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF364:
+	.string	"__k8 1"
+.LASF2189:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF3130:
+	.string	"BaroAlt"
+.LASF1772:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1764:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2440:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1481:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF2449:
+	.string	"flightLogEvent_flightMode_s"
+.LASF2452:
+	.string	"flightLogEvent_flightMode_t"
+.LASF3270:
+	.string	"gyroADC"
+.LASF2829:
+	.string	"BOXBLACKBOX"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF3083:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1685:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF3143:
+	.string	"offset"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF2768:
+	.string	"controlRateProfiles_SystemArray"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF3073:
+	.string	"__align"
+.LASF2981:
+	.string	"hdop"
+.LASF1600:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF3190:
+	.string	"gyro"
+.LASF1839:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF3426:
+	.string	"resetTime"
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1473:
+	.string	"FAST_MATH "
+.LASF3458:
+	.string	"loadValuesTailServo"
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1656:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2306:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF2130:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1677:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF3171:
+	.string	"vbathysteresis"
+.LASF2188:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2580:
+	.string	"ALIGN_DEFAULT"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF2600:
+	.string	"mpuDetectionResult"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF3121:
+	.string	"barometerConfig_s"
+.LASF3127:
+	.string	"barometerConfig_t"
+.LASF2531:
+	.string	"blackboxWriteBufferCount"
+.LASF1447:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2568:
+	.string	"I2CINVALID"
+.LASF1538:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1996:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF1712:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2619:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1480:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF3232:
+	.string	"fieldNameIndex"
+.LASF2128:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF1646:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF1605:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF3534:
+	.string	"controlRateProfiles"
+.LASF2408:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NEVER"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2111:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF3311:
+	.string	"blackboxLogGps"
+.LASF2353:
+	.string	"UNSIGNED FLIGHT_LOG_FIELD_UNSIGNED"
+.LASF1717:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1701:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2712:
+	.string	"FEATURE_TRANSPONDER"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF3159:
+	.string	"voltageSensorADCConfig_SystemArray"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2161:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2951:
+	.string	"BEEPER_SILENCE"
+.LASF2896:
+	.string	"mixerConfig_t"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF1955:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1594:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF3468:
+	.string	"writeIntraDebug"
+.LASF2654:
+	.string	"portOptions_t"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF3430:
+	.string	"stopInTestMode"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2318:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2042:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2844:
+	.string	"ARMED"
+.LASF1890:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1623:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF3175:
+	.string	"magADC"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF2112:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2717:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2702:
+	.string	"FEATURE_TELEMETRY"
+.LASF1463:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF2716:
+	.string	"FEATURE_SOFTSPI"
+.LASF2267:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2869:
+	.string	"MIXER_QUADP"
+.LASF1527:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2994:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1752:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2870:
+	.string	"MIXER_QUADX"
+.LASF2517:
+	.string	"predictorError"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF2005:
+	.string	"AIRMODEDEADBAND 12"
+.LASF2398:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_VBAT"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2617:
+	.string	"OWNER_TIMER"
+.LASF1617:
+	.string	"IOCFG_IPU 0"
+.LASF3187:
+	.string	"targetLooptime"
+.LASF2818:
+	.string	"BOXLEDLOW"
+.LASF3142:
+	.string	"scale"
+.LASF1601:
+	.string	"I2CDEV_COUNT 4"
+.LASF1491:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2592:
+	.string	"initFn"
+.LASF1549:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF3197:
+	.string	"gyro_soft_lpf_hz"
+.LASF2584:
+	.string	"CW270_DEG"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1881:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF3326:
+	.string	"BLACKBOX_SENSOR_RSSI"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1992:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF1439:
+	.string	"BLACKBOX_COMPRESS_ESCAPE_QUOTIENT 16"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF2124:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF3321:
+	.string	"BLACKBOX_SENSOR_AMPERAGE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2418:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0"
+.LASF2127:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1607:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1970:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1962:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2888:
+	.string	"MIXER_SINGLECOPTER"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF3355:
+	.string	"blackboxDeviceEndLog"
+.LASF2102:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1451:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF2830:
+	.string	"BOXFAILSAFE"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF3039:
+	.string	"MPU_60x0"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF3298:
+	.string	"blackboxSlowFrameIterationTimer"
+.LASF1638:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2363:
+	.string	"short unsigned int"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1604:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1961:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2464:
+	.string	"flightLogEvent_gtuneCycleResult_s"
+.LASF1448:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1302:
+	.string	"ACC "
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2288:
+	.string	"__have_pthread_attr_t 1"
+.LASF1672:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1875:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF2367:
+	.string	"__int8_t"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2694:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2253:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2078:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF2369:
+	.string	"__int16_t"
+.LASF2646:
+	.string	"OWNER_COMPASS_CS"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1499:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF2601:
+	.string	"mpuConfiguration"
+.LASF3300:
+	.string	"vbatReference"
+.LASF2556:
+	.string	"DEBUG_COUNT"
+.LASF2033:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF3202:
+	.string	"gyro_soft_notch_hz_1"
+.LASF3204:
+	.string	"gyro_soft_notch_hz_2"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2385:
+	.string	"SPI_TypeDef"
+.LASF2096:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2350:
+	.string	"PREDICT(x) CONCAT(FLIGHT_LOG_FIELD_PREDICTOR_, x)"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF3436:
+	.string	"blackboxSelectedProfile"
+.LASF3051:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1826:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF3172:
+	.string	"batteryConfig_t"
+.LASF1569:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF3239:
+	.string	"blackboxConditionalFieldDefinition_s"
+.LASF3241:
+	.string	"blackboxConditionalFieldDefinition_t"
+.LASF2528:
+	.string	"blackboxHeaderBudget"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF2549:
+	.string	"DEBUG_STACK"
+.LASF2109:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2995:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1589:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2031:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF3219:
+	.string	"BLACKBOX_FIELDS_DEBUG"
+.LASF3133:
+	.string	"baro"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF3449:
+	.string	"blackboxCompileMainFields"
+.LASF3397:
+	.string	"blackboxLogEvent"
+.LASF2746:
+	.string	"setpointRelaxRatio"
+.LASF1455:
+	.string	"FC_VERSION_MINOR 1"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1418:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2212:
+	.string	"__time_t_defined 1"
+.LASF2688:
+	.string	"setMode"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF3005:
+	.string	"halfDuplex"
+.LASF2989:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF2483:
+	.string	"pgRegistry_s"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF3128:
+	.string	"barometerConfig_System"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1823:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF1844:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1815:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2485:
+	.string	"address"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF3240:
+	.string	"condition"
+.LASF1306:
+	.string	"MAG "
+.LASF2641:
+	.string	"OWNER_RX_BIND"
+.LASF2801:
+	.string	"armingConfig_t"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2749:
+	.string	"rateAccelLimit"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2379:
+	.string	"uint8_t"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF3341:
+	.string	"rxIsReceivingSignal"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1736:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF2241:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF2591:
+	.string	"accDev_s"
+.LASF3076:
+	.string	"accDev_t"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2566:
+	.string	"IO_t"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3077:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2024:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF3408:
+	.string	"fieldDefinitions"
+.LASF1285:
+	.string	"GPS "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1835:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2345:
+	.string	"DEFAULT_BLACKBOX_DEVICE BLACKBOX_DEVICE_SERIAL"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2529:
+	.string	"blackboxWriteBuffer"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2214:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2714:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2340:
+	.string	"SONAR_GPIO GPIOB"
+.LASF1728:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2051:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF2460:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF2463:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF1521:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2538:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2793:
+	.string	"neutral3d"
+.LASF3276:
+	.string	"GPS_numSat"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF3068:
+	.string	"__spins"
+.LASF1591:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2336:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2610:
+	.string	"OWNER_ADC_BATT"
+.LASF3086:
+	.string	"SENSOR_GYRO"
+.LASF2421:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_1500"
+.LASF2307:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2475:
+	.string	"timeMs_t"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1763:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1755:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2750:
+	.string	"crash_dthreshold"
+.LASF1586:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF3358:
+	.string	"blackboxDeviceBeginLog"
+.LASF2383:
+	.string	"float"
+.LASF1886:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1519:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2586:
+	.string	"CW90_DEG_FLIP"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2326:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1676:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF3446:
+	.string	"loadMainFieldValues"
+.LASF2362:
+	.string	"unsigned char"
+.LASF3453:
+	.string	"writeInterAttitude"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2918:
+	.string	"PID_ITEM_COUNT"
+.LASF2266:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2149:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF2012:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF3214:
+	.string	"BLACKBOX_FIELDS_SETPOINT"
+.LASF1431:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF3385:
+	.string	"millis"
+.LASF3218:
+	.string	"BLACKBOX_FIELDS_ACC"
+.LASF3149:
+	.string	"voltageMeterSource_e"
+.LASF1697:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2205:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2677:
+	.string	"rxBufferTail"
+.LASF3434:
+	.string	"blackboxStart"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2496:
+	.string	"BLACKBOX_PROFILE_LONG_RANGE"
+.LASF1668:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF3387:
+	.string	"blackboxUpdate"
+.LASF2262:
+	.string	"__clockid_t_defined 1"
+.LASF2186:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2865:
+	.string	"ioTags"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2067:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF3489:
+	.string	"loadSensors"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2759:
+	.string	"rcYawRate8"
+.LASF1937:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF700:
+	.string	"__need_size_t "
+.LASF3372:
+	.string	"blackboxWriteUnsignedVB"
+.LASF3169:
+	.string	"useConsumptionAlerts"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF3354:
+	.string	"blackboxDeviceClose"
+.LASF2451:
+	.string	"lastFlags"
+.LASF379:
+	.string	"linux 1"
+.LASF2707:
+	.string	"FEATURE_LED_STRIP"
+.LASF2704:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3035:
+	.string	"gyroReadXRegister"
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF2898:
+	.string	"motorConfig_s"
+.LASF2903:
+	.string	"motorConfig_t"
+.LASF3047:
+	.string	"ICM_20689_SPI"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1479:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2542:
+	.string	"DEBUG_NOTCH"
+.LASF1748:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2503:
+	.string	"on_motor_test"
+.LASF1974:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2139:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF2647:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2997:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF3414:
+	.string	"definitionStride"
+.LASF2235:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1532:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2083:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1602:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF2197:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF2562:
+	.string	"enabledFeatures"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF3071:
+	.string	"__data"
+.LASF2695:
+	.string	"FEATURE_RX_SERIAL"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF3291:
+	.string	"startTime"
+.LASF3016:
+	.string	"midrc"
+.LASF2107:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2058:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2645:
+	.string	"OWNER_VTX"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1614:
+	.string	"IOCFG_AF_PP 0"
+.LASF1799:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2311:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2487:
+	.string	"reset"
+.LASF3237:
+	.string	"encode"
+.LASF3252:
+	.string	"blackboxSlowFields"
+.LASF1420:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2682:
+	.string	"serialWrite"
+.LASF2319:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1816:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF3200:
+	.string	"gyro_to_use"
+.LASF2013:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF3230:
+	.string	"blackboxFieldHeaderNames"
+.LASF2346:
+	.string	"BLACKBOX_I_INTERVAL 32"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF2495:
+	.string	"BLACKBOX_PROFILE_TUNING"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2775:
+	.string	"AUX3"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF2182:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF3292:
+	.string	"headerIndex"
+.LASF2567:
+	.string	"I2CDevice"
+.LASF1587:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF3333:
+	.string	"blackboxMotors"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1926:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2852:
+	.string	"FAILSAFE_RX_LOSS_MONITORING"
+.LASF3268:
+	.string	"BLACKBOX_STATE_ERASED"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2594:
+	.string	"acc_1G"
+.LASF1698:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2167:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF3410:
+	.string	"conditions"
+.LASF2429:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT"
+.LASF3332:
+	.string	"blackboxSensorFieldCount"
+.LASF1492:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF2737:
+	.string	"dterm_average_count"
+.LASF3373:
+	.string	"blackboxWriteSigned16VBArray"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2569:
+	.string	"I2CDEV_1"
+.LASF2570:
+	.string	"I2CDEV_2"
+.LASF2571:
+	.string	"I2CDEV_3"
+.LASF2572:
+	.string	"I2CDEV_4"
+.LASF2673:
+	.string	"txBufferSize"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1850:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF3029:
+	.string	"mpuReadRegisterFnPtr"
+.LASF2276:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2426:
+	.string	"FlightLogFieldEncoding"
+.LASF2555:
+	.string	"DEBUG_FFT_FREQ"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2203:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1609:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2257:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2553:
+	.string	"DEBUG_FFT"
+.LASF2106:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF2831:
+	.string	"BOXAIRMODE"
+.LASF1874:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1530:
+	.string	"PG_SERVO_MIXER 21"
+.LASF3361:
+	.string	"blackboxFlushWriteBuffer"
+.LASF3485:
+	.string	"loadValuesSensors"
+.LASF3424:
+	.string	"writeGPSHomeFrame"
+.LASF2642:
+	.string	"OWNER_INVERTER"
+.LASF1801:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF2633:
+	.string	"OWNER_RX_SPI_CS"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2069:
+	.string	"PIDSUM_LIMIT 500"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2907:
+	.string	"GPS_home"
+.LASF3026:
+	.string	"rx_max_usec"
+.LASF1417:
+	.string	"UNIT_TESTED "
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF2219:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF2271:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF1649:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1658:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2864:
+	.string	"useUnsyncedPwm"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF3153:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2942:
+	.string	"INPUT_RC_AUX1"
+.LASF2943:
+	.string	"INPUT_RC_AUX2"
+.LASF2944:
+	.string	"INPUT_RC_AUX3"
+.LASF2945:
+	.string	"INPUT_RC_AUX4"
+.LASF2227:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF2825:
+	.string	"BOXSONAR"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1522:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1641:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2373:
+	.string	"__uint32_t"
+.LASF1901:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3419:
+	.string	"value"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF2579:
+	.string	"busDevice_t"
+.LASF2578:
+	.string	"busDevice_u"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF2735:
+	.string	"pidSumLimit"
+.LASF2622:
+	.string	"OWNER_SPI_MISO"
+.LASF2247:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF3427:
+	.string	"inactiveMotorCommand"
+.LASF3182:
+	.string	"interruptTag"
+.LASF2803:
+	.string	"BOXARM"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1779:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF3515:
+	.string	"testBlackboxConditionUncached"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF3342:
+	.string	"blackboxCompressWriteFrame"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1550:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1563:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF3417:
+	.string	"charsToBeWritten"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF3539:
+	.string	"blackboxConfig"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1814:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF3429:
+	.string	"blackboxInit"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1806:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF2881:
+	.string	"MIXER_AIRPLANE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1540:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF1727:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2604:
+	.string	"OWNER_PWMINPUT"
+.LASF2547:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF3023:
+	.string	"max_aux_channel"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2505:
+	.string	"compression"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2551:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1516:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2091:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF2264:
+	.string	"__itimerspec_defined 1"
+.LASF2855:
+	.string	"roll"
+.LASF3234:
+	.string	"blackboxSimpleFieldDefinition_s"
+.LASF3238:
+	.string	"blackboxSimpleFieldDefinition_t"
+.LASF3516:
+	.string	"blackboxIsOnlyLoggingIntraframes"
+.LASF2905:
+	.string	"motor"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF3448:
+	.string	"count"
+.LASF2772:
+	.string	"THROTTLE"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1622:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1495:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1719:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2260:
+	.string	"__clock_t_defined 1"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1444:
+	.string	"BLACKBOX_TAG8_8SVB_MAX_BYTES (1 + 8 * BLACKBOX_VB_MAX_BYTES)"
+.LASF2602:
+	.string	"sensorAccReadFuncPtr"
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2162:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF2781:
+	.string	"rcCommand"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF3498:
+	.string	"loadPidD"
+.LASF3502:
+	.string	"loadPidI"
+.LASF3152:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF3506:
+	.string	"loadPidP"
+.LASF1597:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF3432:
+	.string	"sharedBlackboxAndMspPort"
+.LASF3115:
+	.string	"start_ut"
+.LASF3186:
+	.string	"gyro_s"
+.LASF3189:
+	.string	"gyro_t"
+.LASF2790:
+	.string	"flight3DConfig_s"
+.LASF2795:
+	.string	"flight3DConfig_t"
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF3528:
+	.string	"pidConfig"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2280:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF3411:
+	.string	"secondCondition"
+.LASF3231:
+	.string	"blackboxFieldDefinition_s"
+.LASF3233:
+	.string	"blackboxFieldDefinition_t"
+.LASF2314:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF2292:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF3532:
+	.string	"flight3DConfig"
+.LASF1667:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2721:
+	.string	"pidProfileIndex"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2445:
+	.string	"test"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2934:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF2047:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2461:
+	.string	"logIteration"
+.LASF1498:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1726:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF3509:
+	.string	"writeIntraTime"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2938:
+	.string	"INPUT_RC_ROLL"
+.LASF2904:
+	.string	"motorConfig_System"
+.LASF2701:
+	.string	"FEATURE_SONAR"
+.LASF3471:
+	.string	"writeInterAcc"
+.LASF2762:
+	.string	"thrExpo8"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2979:
+	.string	"groundSpeed"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF1670:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1460:
+	.string	"MW_VERSION 231"
+.LASF2004:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF2395:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_TRICOPTER"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2535:
+	.string	"DEBUG_CYCLETIME"
+.LASF2009:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2900:
+	.string	"minthrottle"
+.LASF1625:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF3287:
+	.string	"blackboxState"
+.LASF2860:
+	.string	"motorDevConfig_s"
+.LASF2866:
+	.string	"motorDevConfig_t"
+.LASF2857:
+	.string	"values"
+.LASF1887:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF3254:
+	.string	"BLACKBOX_STATE_DISABLED"
+.LASF3216:
+	.string	"BLACKBOX_FIELDS_SENSORS"
+.LASF1659:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF2876:
+	.string	"MIXER_Y4"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2873:
+	.string	"MIXER_Y6"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF3369:
+	.string	"getAmperageLatest"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2249:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1356:
+	.string	"USE_SPI"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF3164:
+	.string	"vbatnotpresentcellvoltage"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2548:
+	.string	"DEBUG_SCHEDULER"
+.LASF1426:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2444:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF3179:
+	.string	"mag_declination"
+.LASF2405:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME"
+.LASF2305:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF3146:
+	.string	"VOLTAGE_METER_NONE"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2178:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF3203:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF2846:
+	.string	"armingFlags"
+.LASF3205:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2081:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF1938:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF3085:
+	.string	"flightDynamicsTrims_t"
+.LASF3084:
+	.string	"flightDynamicsTrims_u"
+.LASF2588:
+	.string	"CW270_DEG_FLIP"
+.LASF2996:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF3322:
+	.string	"BLACKBOX_SENSOR_MAG_X"
+.LASF3140:
+	.string	"currentMeterSource_e"
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF1562:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2734:
+	.string	"itermWindupPointPercent"
+.LASF3535:
+	.string	"systemConfig"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2117:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF2991:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF1428:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2073:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF491:
+	.string	"__flexarr []"
+.LASF2713:
+	.string	"FEATURE_AIRMODE"
+.LASF1749:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2213:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2080:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF1624:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF3475:
+	.string	"writeInterGyro"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2925:
+	.string	"pidConfig_s"
+.LASF2927:
+	.string	"pidConfig_t"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF2402:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0"
+.LASF2403:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1"
+.LASF2404:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2"
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1925:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF3507:
+	.string	"loadValuesTime"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2321:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1459:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF2252:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2200:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF3184:
+	.string	"compassConfig_t"
+.LASF1989:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2270:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF3013:
+	.string	"rssi_channel"
+.LASF3383:
+	.string	"blackboxDeviceOpen"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2415:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2933:
+	.string	"airmodeWasActivated"
+.LASF1564:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF3217:
+	.string	"BLACKBOX_FIELDS_GYRO"
+.LASF2534:
+	.string	"DEBUG_NONE"
+.LASF2856:
+	.string	"pitch"
+.LASF2448:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF2447:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2290:
+	.string	"____sigset_t_defined "
+.LASF3526:
+	.string	"accelerometerConfig"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF3357:
+	.string	"blackboxDeviceReserveBufferSpace"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2575:
+	.string	"csnPin"
+.LASF1800:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF2850:
+	.string	"FAILSAFE_LANDING"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF2693:
+	.string	"FEATURE_RX_PPM"
+.LASF3209:
+	.string	"gyroConfig_System"
+.LASF2359:
+	.string	"BLACKBOX_MOTOR_FIELD_COUNT 8"
+.LASF1830:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1304:
+	.string	"GYRO "
+.LASF2289:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF3135:
+	.string	"CURRENT_METER_ADC"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF3151:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF2053:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF2144:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2092:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2536:
+	.string	"DEBUG_BATTERY"
+.LASF3074:
+	.string	"pthread_mutex_t"
+.LASF2411:
+	.string	"FlightLogFieldCondition"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1328:
+	.string	"USE_ADC"
+.LASF3245:
+	.string	"Ppredict"
+.LASF2953:
+	.string	"BEEPER_RX_LOST"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1865:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF3098:
+	.string	"rollAndPitchTrims_s"
+.LASF3101:
+	.string	"rollAndPitchTrims_t"
+.LASF3100:
+	.string	"rollAndPitchTrims_u"
+.LASF3497:
+	.string	"writeIntraPidD"
+.LASF2731:
+	.string	"yaw_lpf_hz"
+.LASF2390:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF3501:
+	.string	"writeIntraPidI"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF2558:
+	.string	"shortGitRevision"
+.LASF2056:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2741:
+	.string	"levelSensitivity"
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2028:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF2424:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF3198:
+	.string	"gyro_isr_update"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF3070:
+	.string	"__list"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1988:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1980:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"IOCFG_OUT_PP 0"
+.LASF3297:
+	.string	"blackboxIFrameIndex"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1857:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2202:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2105:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2965:
+	.string	"BEEPER_READY_BEEP"
+.LASF3155:
+	.string	"vbatscale"
+.LASF2354:
+	.string	"SIGNED FLIGHT_LOG_FIELD_SIGNED"
+.LASF2273:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2169:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF2236:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF3064:
+	.string	"__count"
+.LASF3330:
+	.string	"blackboxPidDAxisCount"
+.LASF3006:
+	.string	"rx_spi_protocol"
+.LASF2153:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF2546:
+	.string	"DEBUG_ANGLERATE"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2082:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF3038:
+	.string	"MPU_3050"
+.LASF1759:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1950:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"PG_PID_CONFIG 504"
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF3007:
+	.string	"rx_spi_id"
+.LASF3141:
+	.string	"currentSensorADCConfig_s"
+.LASF3144:
+	.string	"currentSensorADCConfig_t"
+.LASF1983:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF3102:
+	.string	"accelerometerConfig_s"
+.LASF3108:
+	.string	"accelerometerConfig_t"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF3093:
+	.string	"acc_s"
+.LASF3097:
+	.string	"acc_t"
+.LASF2370:
+	.string	"short int"
+.LASF2920:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF1807:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2221:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2530:
+	.string	"blackboxWriteBufferSize"
+.LASF1805:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2291:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1770:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2940:
+	.string	"INPUT_RC_YAW"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2897:
+	.string	"mixerConfig_System"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF3001:
+	.string	"rxConfig_s"
+.LASF3027:
+	.string	"rxConfig_t"
+.LASF2851:
+	.string	"FAILSAFE_LANDED"
+.LASF2048:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF1502:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1683:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2434:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF702:
+	.string	"__size_t__ "
+.LASF2967:
+	.string	"BEEPER_ARMED"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1488:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF3473:
+	.string	"loadAcc"
+.LASF3394:
+	.string	"blackboxCheckAndLogFlightMode"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1644:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF3412:
+	.string	"headerCount"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF3495:
+	.string	"loadValuesPidD"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF3499:
+	.string	"loadValuesPidI"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1494:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF3363:
+	.string	"blackboxWriteFloat"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1718:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2960:
+	.string	"BEEPER_GPS_STATUS"
+.LASF2469:
+	.string	"syncBeep"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF478:
+	.string	"__P(args) args"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1866:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1286:
+	.string	"USE_NAV "
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF3192:
+	.string	"gyro_align"
+.LASF3442:
+	.string	"slow"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1450:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1694:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2668:
+	.string	"identifier"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF3381:
+	.string	"getBatteryVoltageLatest"
+.LASF1710:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2242:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF3416:
+	.string	"LONGEST_INTEGER_STRLEN"
+.LASF1483:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2545:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF1804:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF3365:
+	.string	"blackboxWriteTag2_3S32"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2466:
+	.string	"gtuneGyroAVG"
+.LASF1466:
+	.string	"TRACE_END(event,arg) {}"
+.LASF1934:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF3110:
+	.string	"baroOpFuncPtr"
+.LASF389:
+	.string	"SITL 1"
+.LASF2329:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1425:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF1714:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF1469:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF3289:
+	.string	"blackboxLastFlightModeFlags"
+.LASF3180:
+	.string	"mag_align"
+.LASF2671:
+	.string	"baudRate"
+.LASF2976:
+	.string	"gpsSolutionData_s"
+.LASF2982:
+	.string	"gpsSolutionData_t"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1445:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF1745:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2118:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF3314:
+	.string	"writeIntra"
+.LASF2823:
+	.string	"BOXTELEMETRY"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF3335:
+	.string	"blackboxMainEncoders"
+.LASF2010:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2816:
+	.string	"BOXBEEPERON"
+.LASF3104:
+	.string	"acc_align"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1490:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2709:
+	.string	"FEATURE_OSD"
+.LASF1952:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2670:
+	.string	"options"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2374:
+	.string	"long int"
+.LASF2909:
+	.string	"PID_PITCH"
+.LASF3185:
+	.string	"compassConfig_System"
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF2985:
+	.string	"FUNCTION_MSP"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF3305:
+	.string	"blackboxCompressFrames"
+.LASF2585:
+	.string	"CW0_DEG_FLIP"
+.LASF2615:
+	.string	"OWNER_SERIAL_RX"
+.LASF2322:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2297:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF2134:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2372:
+	.string	"__int32_t"
+.LASF2123:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1985:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2794:
+	.string	"deadband3d_throttle"
+.LASF2062:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2756:
+	.string	"currentPidProfile"
+.LASF2275:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF2438:
+	.string	"FLIGHT_LOG_FIELD_SIGNED"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF2008:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF3054:
+	.string	"sensor"
+.LASF2711:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF3168:
+	.string	"useVBatAlerts"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF3078:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2634:
+	.string	"OWNER_SPI_CS"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2732:
+	.string	"dterm_notch_hz"
+.LASF3413:
+	.string	"needComma"
+.LASF1796:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF3223:
+	.string	"blackboxProfileDefinition_s"
+.LASF2998:
+	.string	"FUNCTION_RCSPLIT"
+.LASF2983:
+	.string	"gpsSol"
+.LASF3196:
+	.string	"gyro_soft_lpf_type"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1496:
+	.string	"EXPAND_I(x) x"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2420:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD"
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF2296:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1551:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF3183:
+	.string	"magZero"
+.LASF3521:
+	.string	"batteryConfig"
+.LASF1771:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF3438:
+	.string	"writeSlowFrameIfNeeded"
+.LASF2456:
+	.string	"newValue"
+.LASF3088:
+	.string	"SENSOR_BARO"
+.LASF2361:
+	.string	"BLACKBOX_PRINT_HEADER_LINE_CUSTOM(...) case __COUNTER__: {__VA_ARGS__}; break;"
+.LASF3370:
+	.string	"blackboxWriteTag8_8SVB"
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF2841:
+	.string	"boxId_e"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2657:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2658:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2614:
+	.string	"OWNER_SERIAL_TX"
+.LASF2132:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF3377:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF3447:
+	.string	"state"
+.LASF1575:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1422:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2761:
+	.string	"thrMid8"
+.LASF1560:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF3454:
+	.string	"current"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1847:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"Q12 (1 << 12)"
+.LASF2501:
+	.string	"rate_denom"
+.LASF2406:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_ACC"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF3213:
+	.string	"BLACKBOX_FIELDS_PID"
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF397:
+	.string	"true 1"
+.LASF2655:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2748:
+	.string	"yawRateAccelLimit"
+.LASF2751:
+	.string	"crash_gthreshold"
+.LASF3339:
+	.string	"startedLoggingInTestMode"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1593:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF3415:
+	.string	"conditionsStride"
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF3265:
+	.string	"BLACKBOX_STATE_SHUTTING_DOWN"
+.LASF1999:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF3405:
+	.string	"sendFieldDefinition"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF3378:
+	.string	"getArmingBeepTimeMicros"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2923:
+	.string	"pid8_s"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF3079:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1908:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2377:
+	.string	"int16_t"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1898:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2679:
+	.string	"txBufferTail"
+.LASF3227:
+	.string	"blackboxProfileDefinition_t"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1631:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2133:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1829:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2446:
+	.string	"time"
+.LASF3480:
+	.string	"writeMainStateArrayUsingAveragePredictor"
+.LASF3072:
+	.string	"__size"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF3285:
+	.string	"motorOutputLow"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2208:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2131:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1489:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2937:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF3261:
+	.string	"BLACKBOX_STATE_SEND_SLOW_HEADER"
+.LASF2681:
+	.string	"serialPortVTable"
+.LASF2152:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF2184:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF3053:
+	.string	"mpuDetectionResult_s"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2621:
+	.string	"OWNER_SPI_SCK"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2207:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2312:
+	.string	"__cleanup_fct_attribute "
+.LASF2026:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF3106:
+	.string	"accZero"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF3056:
+	.string	"mpuDetectionResult_t"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF3025:
+	.string	"rx_min_usec"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1734:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2498:
+	.string	"BlackboxProfile_e"
+.LASF2097:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2103:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2015:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF1808:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2845:
+	.string	"WAS_EVER_ARMED"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF701:
+	.string	"__need_NULL "
+.LASF3492:
+	.string	"writeInterRcCommand"
+.LASF2454:
+	.string	"adjustmentFunction"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1769:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF3527:
+	.string	"rxConfig"
+.LASF2506:
+	.string	"profile"
+.LASF2399:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF3260:
+	.string	"BLACKBOX_STATE_SEND_GPS_G_HEADER"
+.LASF1576:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2848:
+	.string	"FAILSAFE_IDLE"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1524:
+	.string	"PG_PID_PROFILE 14"
+.LASF1539:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2068:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1761:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2915:
+	.string	"PID_LEVEL"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2656:
+	.string	"SERIAL_INVERTED"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2785:
+	.string	"alt_hold_deadband"
+.LASF1682:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF1674:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3533:
+	.string	"rcControlsConfig"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2959:
+	.string	"BEEPER_BAT_LOW"
+.LASF1599:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF3099:
+	.string	"rollAndPitchTrims_t_def"
+.LASF2040:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF3403:
+	.string	"motorOutputHighInt"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2278:
+	.string	"__LOCK_ALIGNMENT "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1553:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF2543:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF3523:
+	.string	"_index"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF3091:
+	.string	"SENSOR_GPS"
+.LASF2730:
+	.string	"dterm_lpf_hz"
+.LASF3282:
+	.string	"rxFlightChannelsValid"
+.LASF1709:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1523:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1424:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2226:
+	.string	"SCHED_RR 2"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2674:
+	.string	"rxBuffer"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF3117:
+	.string	"start_up"
+.LASF2255:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF2022:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1791:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1833:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF3166:
+	.string	"currentMeterSource"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2308:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1969:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2887:
+	.string	"MIXER_DUALCOPTER"
+.LASF1487:
+	.string	"NOOP do {} while (0)"
+.LASF3505:
+	.string	"writeIntraPidP"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2770:
+	.string	"ROLL"
+.LASF2954:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF3044:
+	.string	"ICM_20601_SPI"
+.LASF3460:
+	.string	"writeIntraTailServo"
+.LASF1506:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2441:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2597:
+	.string	"dataReady"
+.LASF2867:
+	.string	"mixerMode"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2952:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF2471:
+	.string	"inflightAdjustment"
+.LASF3003:
+	.string	"serialrx_provider"
+.LASF3092:
+	.string	"SENSOR_GPSMAG"
+.LASF1884:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1647:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2211:
+	.string	"_SCHED_H 1"
+.LASF2366:
+	.string	"signed char"
+.LASF396:
+	.string	"bool _Bool"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF3157:
+	.string	"vbatresdivmultiplier"
+.LASF2263:
+	.string	"__timer_t_defined 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF2039:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2125:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1567:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF2155:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2939:
+	.string	"INPUT_RC_PITCH"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2651:
+	.string	"MODE_RX"
+.LASF2425:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_ADAPTIVE"
+.LASF2804:
+	.string	"BOXANGLE"
+.LASF3226:
+	.string	"rateDenom"
+.LASF3444:
+	.string	"writeInterframe"
+.LASF2173:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF3033:
+	.string	"writeFn"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2282:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF3090:
+	.string	"SENSOR_SONAR"
+.LASF1580:
+	.string	"PG_ADC_CONFIG 510"
+.LASF3154:
+	.string	"voltageSensorADCConfig_s"
+.LASF2250:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1813:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1475:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2164:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2473:
+	.string	"gtuneCycleResult"
+.LASF2045:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2088:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1935:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1967:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2956:
+	.string	"BEEPER_ARMING"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF3296:
+	.string	"blackboxPFrameIndex"
+.LASF3063:
+	.string	"__lock"
+.LASF2974:
+	.string	"gpsLocation_s"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF3340:
+	.string	"rxAreFlightChannelsValid"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF2147:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF3193:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2300:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF2745:
+	.string	"itermAcceleratorGain"
+.LASF3251:
+	.string	"blackboxGpsHFields"
+.LASF1514:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF1746:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF2839:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF2333:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1653:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1959:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2652:
+	.string	"MODE_TX"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF2376:
+	.string	"int8_t"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1556:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2758:
+	.string	"rcRate8"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2700:
+	.string	"FEATURE_FAILSAFE"
+.LASF2639:
+	.string	"OWNER_BEEPER"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1871:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1880:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2245:
+	.string	"_TIME_H 1"
+.LASF1414:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1986:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2799:
+	.string	"disarm_kill_switch"
+.LASF1856:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF3479:
+	.string	"array"
+.LASF3103:
+	.string	"acc_lpf_hz"
+.LASF2328:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1467:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2025:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1798:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF2462:
+	.string	"currentTime"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF3514:
+	.string	"cond"
+.LASF3384:
+	.string	"findSharedSerialPort"
+.LASF1570:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF3522:
+	.string	"voltageSensorADCConfig"
+.LASF3490:
+	.string	"getSensorValue"
+.LASF2513:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_AVERAGE_2"
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF3123:
+	.string	"baro_sample_count"
+.LASF2624:
+	.string	"OWNER_I2C_SCL"
+.LASF2480:
+	.string	"PGR_SIZE_MASK"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2228:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1497:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF2021:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2146:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF3062:
+	.string	"__pthread_mutex_s"
+.LASF2821:
+	.string	"BOXGOV"
+.LASF2380:
+	.string	"uint16_t"
+.LASF2076:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2195:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3000:
+	.string	"rssi"
+.LASF3112:
+	.string	"baroDev_s"
+.LASF3120:
+	.string	"baroDev_t"
+.LASF3491:
+	.string	"loadValuesRcCommand"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1533:
+	.string	"PG_RX_CONFIG 24"
+.LASF3317:
+	.string	"fieldList"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2316:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1456:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF2468:
+	.string	"flightLogEvent_gtuneCycleResult_t"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2258:
+	.string	"CLOCK_TAI 11"
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1899:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2141:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF3517:
+	.string	"blackboxIsLogging"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF3057:
+	.string	"long long unsigned int"
+.LASF2524:
+	.string	"BLACKBOX_RESERVE_SUCCESS"
+.LASF2583:
+	.string	"CW180_DEG"
+.LASF2254:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF3467:
+	.string	"writeInterDebug"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2119:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1820:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF3255:
+	.string	"BLACKBOX_STATE_STOPPED"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF3160:
+	.string	"batteryConfig_s"
+.LASF1848:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1590:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF2018:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2342:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2625:
+	.string	"OWNER_I2C_SDA"
+.LASF3201:
+	.string	"gyro_fusion_mode"
+.LASF2706:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF2435:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_RICE"
+.LASF3136:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF2417:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE"
+.LASF2486:
+	.string	"copy"
+.LASF1671:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF2397:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_BARO"
+.LASF2613:
+	.string	"OWNER_ADC_RSSI"
+.LASF2834:
+	.string	"BOXBLACKBOXERASE"
+.LASF3452:
+	.string	"loadValuesAttitude"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF3474:
+	.string	"loadValuesGyro"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2787:
+	.string	"yaw_control_reversed"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1733:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1582:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF1725:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF3320:
+	.string	"BLACKBOX_SENSOR_VBAT"
+.LASF3211:
+	.string	"blackboxConfig_Registry"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF2623:
+	.string	"OWNER_SPI_MOSI"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2862:
+	.string	"motorPwmProtocol"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF3167:
+	.string	"batteryCapacity"
+.LASF3263:
+	.string	"BLACKBOX_STATE_PAUSED"
+.LASF2853:
+	.string	"FAILSAFE_RX_LOSS_RECOVERED"
+.LASF2581:
+	.string	"CW0_DEG"
+.LASF2516:
+	.string	"previous"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF2560:
+	.string	"buildTime"
+.LASF2020:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2911:
+	.string	"PID_ALT"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2089:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF3220:
+	.string	"BLACKBOX_FIELDS_MOTOR"
+.LASF1760:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2198:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF1552:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2847:
+	.string	"stateFlags"
+.LASF2589:
+	.string	"sensor_align_e"
+.LASF2344:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF2763:
+	.string	"rates"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF3425:
+	.string	"inMotorTestMode"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2238:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1437:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1581:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF3529:
+	.string	"motorConfig"
+.LASF2914:
+	.string	"PID_NAVR"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF3176:
+	.string	"magneticDeclination"
+.LASF3046:
+	.string	"ICM_20608_SPI"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF3145:
+	.string	"currentSensorADCConfig_System"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2175:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2842:
+	.string	"bits"
+.LASF2335:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1673:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF3224:
+	.string	"fields"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2817:
+	.string	"BOXLEDMAX"
+.LASF1470:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF2724:
+	.string	"task_statistics"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2066:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF3512:
+	.string	"testBlackboxCondition"
+.LASF2884:
+	.string	"MIXER_VTAIL4"
+.LASF2137:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF3150:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF2450:
+	.string	"flags"
+.LASF2436:
+	.string	"FlightLogFieldSign"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1723:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF2493:
+	.string	"BlackboxProfile"
+.LASF2358:
+	.string	"BLACKBOX_CONDITIONAL_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)"
+.LASF3511:
+	.string	"newState"
+.LASF1512:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1691:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1812:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1634:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF2631:
+	.string	"OWNER_MPU_CS"
+.LASF2477:
+	.string	"pgn_t"
+.LASF2075:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF3286:
+	.string	"rcModeActivationMask"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF2442:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF2827:
+	.string	"BOXSERVO2"
+.LASF3307:
+	.string	"blackboxModeActivationConditionPresent"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2030:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF3510:
+	.string	"blackboxSetState"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF2488:
+	.string	"pgRegistry_t"
+.LASF2644:
+	.string	"OWNER_TRANSPONDER"
+.LASF3042:
+	.string	"MPU_65xx_SPI"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1442:
+	.string	"BLACKBOX_TAG2_3S32_MAX_BYTES 13"
+.LASF1931:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2680:
+	.string	"rxCallback"
+.LASF3470:
+	.string	"loadValuesAcc"
+.LASF1484:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF2140:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2375:
+	.string	"char"
+.LASF2032:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF2494:
+	.string	"BLACKBOX_PROFILE_FULL"
+.LASF1536:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2593:
+	.string	"readFn"
+.LASF2609:
+	.string	"OWNER_ADC"
+.LASF2514:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_COUNT"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1458:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1742:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"STR_HELPER(x) #x"
+.LASF2628:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF1849:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2783:
+	.string	"deadband"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2287:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF3041:
+	.string	"MPU_65xx_I2C"
+.LASF2809:
+	.string	"BOXHEADFREE"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF3067:
+	.string	"__kind"
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2166:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF2508:
+	.string	"blackboxConfig_t"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF3195:
+	.string	"gyro_lpf"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2843:
+	.string	"boxBitmask_t"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2050:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2054:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF3404:
+	.string	"currentControlRateProfile"
+.LASF1541:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2868:
+	.string	"MIXER_TRI"
+.LASF3250:
+	.string	"blackboxGpsGFields"
+.LASF2229:
+	.string	"__CPU_SETSIZE 1024"
+.LASF3222:
+	.string	"BLACKBOX_FIELDS_GPS"
+.LASF2685:
+	.string	"serialRead"
+.LASF2301:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF1434:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1793:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1923:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF1429:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2710:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF2932:
+	.string	"SystemCoreClock"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF2210:
+	.string	"_PTHREAD_H 1"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3022:
+	.string	"fpvCamAngleDegrees"
+.LASF2099:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF2019:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF2838:
+	.string	"BOXDSHOTREVERSE"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2465:
+	.string	"gtuneAxis"
+.LASF3277:
+	.string	"blackboxGpsState_t"
+.LASF2789:
+	.string	"rcControlsConfig_System"
+.LASF2771:
+	.string	"PITCH"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF3058:
+	.string	"__pthread_internal_list"
+.LASF1421:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1958:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF3109:
+	.string	"accelerometerConfig_System"
+.LASF2360:
+	.string	"BLACKBOX_PRINT_HEADER_LINE(name,format,...) case __COUNTER__: blackboxPrintfHeaderLine(name, format, __VA_ARGS__); break;"
+.LASF1432:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1650:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF3519:
+	.string	"gyroConfig"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2432:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF3420:
+	.string	"loadMainState"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2902:
+	.string	"mincommand"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF3278:
+	.string	"blackboxSlowState_s"
+.LASF3283:
+	.string	"blackboxSlowState_t"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1655:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF3024:
+	.string	"airModeActivateThreshold"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF2720:
+	.string	"systemConfig_s"
+.LASF2726:
+	.string	"systemConfig_t"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2980:
+	.string	"groundCourse"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF2017:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1940:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF3457:
+	.string	"loadAttitude"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1993:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2223:
+	.string	"_BITS_SCHED_H 1"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1462:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF3503:
+	.string	"loadValuesPidP"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2595:
+	.string	"ADCRaw"
+.LASF3390:
+	.string	"blackboxShouldLogGpsHomeFrame"
+.LASF468:
+	.string	"__PMT"
+.LASF1472:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF3461:
+	.string	"loadTailServo"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1786:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2077:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF1863:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF3399:
+	.string	"data"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1443:
+	.string	"BLACKBOX_TAG8_4S16_MAX_BYTES 9"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF3147:
+	.string	"VOLTAGE_METER_ADC"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2608:
+	.string	"OWNER_LED"
+.LASF2946:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF2180:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF1645:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2156:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2910:
+	.string	"PID_YAW"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1895:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2765:
+	.string	"rcYawExpo8"
+.LASF2000:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF2453:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF2459:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1419:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2669:
+	.string	"mode"
+.LASF3124:
+	.string	"baro_noise_lpf"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1776:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2926:
+	.string	"pid_process_denom"
+.LASF2510:
+	.string	"blackboxConfig_Copy"
+.LASF1706:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2193:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF2968:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF3111:
+	.string	"baroCalculateFuncPtr"
+.LASF2899:
+	.string	"digitalIdleOffsetValue"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF2509:
+	.string	"blackboxConfig_System"
+.LASF2723:
+	.string	"debug_mode"
+.LASF1558:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2330:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1561:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1811:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF2958:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF2913:
+	.string	"PID_POSR"
+.LASF1803:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1630:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1946:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF3060:
+	.string	"__next"
+.LASF2999:
+	.string	"serialPortFunction_e"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF3075:
+	.string	"long long int"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF3089:
+	.string	"SENSOR_MAG"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF3310:
+	.string	"blackboxRateDenom"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF1500:
+	.string	"PP_IIF_0(t,f) f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1584:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2782:
+	.string	"rcControlsConfig_s"
+.LASF2788:
+	.string	"rcControlsConfig_t"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF3045:
+	.string	"ICM_20602_SPI"
+.LASF2427:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB"
+.LASF2320:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2753:
+	.string	"crash_recovery_angle"
+.LASF2554:
+	.string	"DEBUG_FFT_TIME"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2891:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF2302:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF2183:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2467:
+	.string	"gtuneNewP"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF2431:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF3386:
+	.string	"blackboxReplenishHeaderBudget"
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1474:
+	.string	"VERY_FAST_MATH "
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF2522:
+	.string	"field"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1528:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF3194:
+	.string	"gyro_sync_denom"
+.LASF3366:
+	.string	"arraySubInt32"
+.LASF1461:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1724:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF3349:
+	.string	"isBlackboxDeviceFull"
+.LASF1716:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2924:
+	.string	"pid8_t"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF2526:
+	.string	"BLACKBOX_RESERVE_PERMANENT_FAILURE"
+.LASF3031:
+	.string	"mpuResetFnPtr"
+.LASF1453:
+	.string	"FC_FIRMWARE_NAME \"Cleanflight\""
+.LASF2627:
+	.string	"OWNER_SDCARD_CS"
+.LASF2684:
+	.string	"serialTotalTxFree"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2773:
+	.string	"AUX1"
+.LASF2774:
+	.string	"AUX2"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2776:
+	.string	"AUX4"
+.LASF2777:
+	.string	"AUX5"
+.LASF2778:
+	.string	"AUX6"
+.LASF2779:
+	.string	"AUX7"
+.LASF2780:
+	.string	"AUX8"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2807:
+	.string	"BOXANTIGRAVITY"
+.LASF2515:
+	.string	"blackboxCompressField_s"
+.LASF2519:
+	.string	"blackboxCompressField_t"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1627:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF2478:
+	.string	"PGR_PGN_MASK"
+.LASF3137:
+	.string	"CURRENT_METER_ESC"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF3395:
+	.string	"eventData"
+.LASF2239:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF2400:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_SONAR"
+.LASF1715:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2334:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3272:
+	.string	"amperageLatest"
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF3459:
+	.string	"writeInterTailServo"
+.LASF1411:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF3328:
+	.string	"blackboxSensorField_e"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1838:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2520:
+	.string	"blackboxCompressState_s"
+.LASF2523:
+	.string	"blackboxCompressState_t"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF3043:
+	.string	"MPU_9250_SPI"
+.LASF1265:
+	.string	"CMS "
+.LASF2885:
+	.string	"MIXER_HEX6H"
+.LASF1595:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2234:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF3486:
+	.string	"writeInterSensors"
+.LASF2481:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2640:
+	.string	"OWNER_OSD"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2279:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF3210:
+	.string	"pgResetTemplate_blackboxConfig"
+.LASF2001:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF2573:
+	.string	"deviceSpi_s"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2246:
+	.string	"_BITS_TIME_H 1"
+.LASF1711:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2637:
+	.string	"OWNER_USB"
+.LASF2355:
+	.string	"FIELDS(x) BLACKBOX_FIELDS_ ## x"
+.LASF1664:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2752:
+	.string	"crash_time"
+.LASF3215:
+	.string	"BLACKBOX_FIELDS_BATTERY"
+.LASF2739:
+	.string	"pidAtMinThrottle"
+.LASF3345:
+	.string	"castFloatBytesToInt"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF2165:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF719:
+	.string	"__size_t "
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF3021:
+	.string	"rcInterpolationInterval"
+.LASF1543:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF3348:
+	.string	"strlen"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2129:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2664:
+	.string	"SERIAL_BIDIR_PP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF3347:
+	.string	"blackboxPrintf"
+.LASF1468:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3375:
+	.string	"sensors"
+.LASF3275:
+	.string	"GPS_coord"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1416:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2696:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF3269:
+	.string	"blackboxMainState_s"
+.LASF3273:
+	.string	"blackboxMainState_t"
+.LASF2216:
+	.string	"__BIG_ENDIAN 4321"
+.LASF3494:
+	.string	"loadRcCommand"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF3309:
+	.string	"blackboxRateNum"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3081:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF2034:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2744:
+	.string	"itermThrottleThreshold"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF2630:
+	.string	"OWNER_BARO_CS"
+.LASF2396:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_MAG"
+.LASF2378:
+	.string	"int32_t"
+.LASF3294:
+	.string	"blackboxConditionCache"
+.LASF2299:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF2705:
+	.string	"FEATURE_RX_MSP"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1822:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF2472:
+	.string	"loggingResume"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2797:
+	.string	"armingConfig_s"
+.LASF2409:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_FIRST"
+.LASF2057:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1837:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF3008:
+	.string	"rx_spi_rf_channel_count"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF3465:
+	.string	"loadMotors"
+.LASF1534:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF3469:
+	.string	"loadDebug"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF3418:
+	.string	"bytesToWrite"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF3225:
+	.string	"rateNum"
+.LASF1692:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1902:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2874:
+	.string	"MIXER_HEX6"
+.LASF2150:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF2754:
+	.string	"crash_recovery_rate"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2003:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2596:
+	.string	"revisionCode"
+.LASF2294:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2875:
+	.string	"MIXER_FLYING_WING"
+.LASF2992:
+	.string	"FUNCTION_BLACKBOX"
+.LASF2879:
+	.string	"MIXER_OCTOFLATP"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1430:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2880:
+	.string	"MIXER_OCTOFLATX"
+.LASF2268:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2364:
+	.string	"unsigned int"
+.LASF1932:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF2499:
+	.string	"blackboxConfig_s"
+.LASF1308:
+	.string	"BARO "
+.LASF3069:
+	.string	"__elision"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF1789:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1914:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2849:
+	.string	"FAILSAFE_RX_LOSS_DETECTED"
+.LASF2757:
+	.string	"controlRateConfig_s"
+.LASF2767:
+	.string	"controlRateConfig_t"
+.LASF2093:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1504:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3655:
+	.string	"rx_pwm.h"
+.LASF3600:
+	.string	"thread-shared-types.h"
+.LASF3592:
+	.string	"pwm_output.h"
+.LASF3637:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3561:
+	.string	"/usr/include"
+.LASF3643:
+	.string	"mathcalls-helper-functions.h"
+.LASF3687:
+	.string	"voltage_ids.h"
+.LASF3669:
+	.string	"endianness.h"
+.LASF3639:
+	.string	"floatn-common.h"
+.LASF3619:
+	.string	"stdint.h"
+.LASF3644:
+	.string	"platform.h"
+.LASF3542:
+	.string	"src/main/build"
+.LASF3558:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3605:
+	.string	"barometer.h"
+.LASF3618:
+	.string	"stdbool.h"
+.LASF3654:
+	.string	"flash.h"
+.LASF3657:
+	.string	"io.h"
+.LASF3569:
+	.string	"time.h"
+.LASF3623:
+	.string	"wordsize.h"
+.LASF3671:
+	.string	"cpu-set.h"
+.LASF3579:
+	.string	"bus.h"
+.LASF3594:
+	.string	"navigation.h"
+.LASF3554:
+	.string	"src/main/target/SITL"
+.LASF3616:
+	.string	"mathcalls.h"
+.LASF3614:
+	.string	"blackbox_encoding.h"
+.LASF3602:
+	.string	"pthreadtypes.h"
+.LASF3660:
+	.string	"sound_beeper.h"
+.LASF3674:
+	.string	"clockid_t.h"
+.LASF3684:
+	.string	"pthread_stack_min.h"
+.LASF3651:
+	.string	"parameter_group_ids.h"
+.LASF3681:
+	.string	"__sigset_t.h"
+.LASF3575:
+	.string	"version.h"
+.LASF3620:
+	.string	"libc-header-start.h"
+.LASF3675:
+	.string	"timer_t.h"
+.LASF3590:
+	.string	"failsafe.h"
+.LASF3611:
+	.string	"blackbox.c"
+.LASF3562:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3546:
+	.string	"src/main/drivers/barometer"
+.LASF3685:
+	.string	"filter.h"
+.LASF3571:
+	.string	"blackbox.h"
+.LASF3582:
+	.string	"resource.h"
+.LASF3678:
+	.string	"atomic_wide_counter.h"
+.LASF3572:
+	.string	"blackbox_compress.h"
+.LASF3550:
+	.string	"src/main/flight"
+.LASF3591:
+	.string	"imu.h"
+.LASF3574:
+	.string	"debug.h"
+.LASF3617:
+	.string	"stdc-predef.h"
+.LASF3581:
+	.string	"accgyro.h"
+.LASF3662:
+	.string	"timer.h"
+.LASF3635:
+	.string	"math.h"
+.LASF3557:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3663:
+	.string	"exti.h"
+.LASF3621:
+	.string	"features.h"
+.LASF3556:
+	.string	"src/main"
+.LASF3648:
+	.string	"trace.h"
+.LASF3551:
+	.string	"src/main/io"
+.LASF3547:
+	.string	"src/main/drivers/compass"
+.LASF3680:
+	.string	"setjmp.h"
+.LASF3688:
+	.string	"sonar.h"
+.LASF3673:
+	.string	"struct_tm.h"
+.LASF3544:
+	.string	"src/main/config"
+.LASF3676:
+	.string	"struct_itimerspec.h"
+.LASF3622:
+	.string	"features-time64.h"
+.LASF3634:
+	.string	"strings.h"
+.LASF3609:
+	.string	"compass.h"
+.LASF3545:
+	.string	"src/main/drivers/accgyro"
+.LASF3596:
+	.string	"beeper.h"
+.LASF3679:
+	.string	"struct_rwlock.h"
+.LASF3589:
+	.string	"runtime_config.h"
+.LASF3584:
+	.string	"config.h"
+.LASF3627:
+	.string	"stubs.h"
+.LASF3610:
+	.string	"gyro.h"
+.LASF3630:
+	.string	"time64.h"
+.LASF3612:
+	.string	"string.h"
+.LASF3567:
+	.string	"target.h"
+.LASF3658:
+	.string	"io_def.h"
+.LASF3645:
+	.string	"common_fc_pre.h"
+.LASF3615:
+	.string	"maths.h"
+.LASF3631:
+	.string	"wchar.h"
+.LASF3624:
+	.string	"timesize.h"
+.LASF3543:
+	.string	"src/main/common"
+.LASF3607:
+	.string	"voltage.h"
+.LASF3598:
+	.string	"rx.h"
+.LASF3606:
+	.string	"current.h"
+.LASF3560:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3652:
+	.string	"rcc_types.h"
+.LASF3597:
+	.string	"gps.h"
+.LASF3666:
+	.string	"time_t.h"
+.LASF3604:
+	.string	"acceleration.h"
+.LASF3566:
+	.string	"stddef.h"
+.LASF3642:
+	.string	"fp-fast.h"
+.LASF3686:
+	.string	"current_ids.h"
+.LASF3549:
+	.string	"src/main/fc"
+.LASF3638:
+	.string	"floatn.h"
+.LASF3564:
+	.string	"stdint-intn.h"
+.LASF3578:
+	.string	"bus_i2c.h"
+.LASF3649:
+	.string	"axis.h"
+.LASF3628:
+	.string	"stubs-64.h"
+.LASF3656:
+	.string	"sdcard.h"
+.LASF3570:
+	.string	"parameter_group.h"
+.LASF3586:
+	.string	"controlrate_profile.h"
+.LASF3585:
+	.string	"pid.h"
+.LASF3659:
+	.string	"io_def_generated.h"
+.LASF3576:
+	.string	"feature.h"
+.LASF3573:
+	.string	"blackbox_io.h"
+.LASF3670:
+	.string	"struct_sched_param.h"
+.LASF3593:
+	.string	"mixer.h"
+.LASF3603:
+	.string	"sensors.h"
+.LASF3682:
+	.string	"struct___jmp_buf_tag.h"
+.LASF3661:
+	.string	"vcd.h"
+.LASF3599:
+	.string	"accgyro_mpu.h"
+.LASF3636:
+	.string	"math-vector.h"
+.LASF3588:
+	.string	"rc_modes.h"
+.LASF3565:
+	.string	"stdint-uintn.h"
+.LASF3668:
+	.string	"endian.h"
+.LASF3683:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox.c"
+.LASF3672:
+	.string	"clock_t.h"
+.LASF3641:
+	.string	"fp-logb.h"
+.LASF3653:
+	.string	"adc.h"
+.LASF3626:
+	.string	"long-double.h"
+.LASF3587:
+	.string	"rc_controls.h"
+.LASF3608:
+	.string	"battery.h"
+.LASF3625:
+	.string	"cdefs.h"
+.LASF3640:
+	.string	"flt-eval-method.h"
+.LASF3552:
+	.string	"src/main/rx"
+.LASF3629:
+	.string	"typesizes.h"
+.LASF3541:
+	.string	"src/main/blackbox"
+.LASF3689:
+	.string	"sonar_hcsr04.h"
+.LASF3646:
+	.string	"common_fc_post.h"
+.LASF3632:
+	.string	"locale_t.h"
+.LASF3555:
+	.string	"src/main/target"
+.LASF3664:
+	.string	"pthread.h"
+.LASF3580:
+	.string	"sensor.h"
+.LASF3548:
+	.string	"src/main/drivers"
+.LASF3583:
+	.string	"serial.h"
+.LASF3650:
+	.string	"utils.h"
+.LASF3647:
+	.string	"build_config.h"
+.LASF3667:
+	.string	"struct_timespec.h"
+.LASF3553:
+	.string	"src/main/sensors"
+.LASF3613:
+	.string	"encoding.h"
+.LASF3595:
+	.string	"servos.h"
+.LASF3633:
+	.string	"__locale_t.h"
+.LASF3563:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3601:
+	.string	"struct_mutex.h"
+.LASF3568:
+	.string	"blackbox_fielddefs.h"
+.LASF3677:
+	.string	"pthreadtypes-arch.h"
+.LASF3577:
+	.string	"io_types.h"
+.LASF3665:
+	.string	"sched.h"
+.LASF3559:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003}"
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\343\013\2451"
+	.string	"\032D\244\017CP\236Nc\373\020\261\302#\017\373M-O\n;\021\371?^\"h\340I\337\020<H.\236\337\034J\001"
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	"\307\ba\036\204u\277F\326\347\222\023~\357\312r\344\302\277\337o\273o\271w\267$w\340"
+	.string	"\363"
+	.string	"\336"
+	.string	"H\3377\372\201\033\335\300\213\276Ot\242\027\370\276\361\265#\343#H\002\004ML-^_\236\304\2457\255\211\322O)i\350\004\204.4\340\373\353W\0017\336\370\240\007\375\350\005T\262\307\206\264\277\370\314\330\216\200\016t\026\316\373;\3643r\005\253g:\f\004\270\333\032C5D\256\235\336\330a\201\241\237\027\357\316k\3118\207BT\266@\345"
+	.string	"\237\303g\331\352\334\237\033#\313\005\214O\0314\373\214\001>\223\001\344\313g\017D\017*\375\361\231c\375\370=\337\377\361\211\306\325%e\370\354\273\005\r\036\"\261{\370"
+	.ascii	"\212Q\262\240\365\200[Vnj8\005\360\302M5j\324\335\337\177\277"
+	.ascii	"\377\366\300\2012\013[\255T\323\346N\321}{\366\305\263m\025\317"
+	.ascii	"N\214\376\177\375\365\254\373\244\323\264\262j\345\032O\003\321"
+	.string	"<\023k\374\206\356H^\211\036\270\301\2606\022+\273t3\204p\204\323\235\376\026\r/N\317k\235\005\021\213\224\021\261\312\3204\252Y\b\005o\337W\007\030\364\013\304n\237\340\355\021\274u\333\301\2678s<4\275\351Mo\213\212\322<d\236H&*\031\034\035\207-}\27626u6,=\216\253\334iY\323\312\260\277c \230i\226&\005\303\376.\276x\23054\234\223f\2551X\240\035\013k\317\234\033rG*\254;\254\207\241\030\205uN\022'\307\331\004\367\353\225\236\364\316}a\364\270H\330\337\256\\\007&\220\211\265\277_\271.`\312\"\264{\323\033T\256\\=<ckV\227\231,\321\314\252 (=\351\254\034\025\342\034C%_v_\300\205\001\231\372v\022f:\225j\211\264M1\214\322\207\213\204W\320\266@\255_\335V\316a\236\332\203\247\006\307B\222\350f|:U\252\237f\212\341\210\311"
+	.ascii	"\227\354\320a\307\037\203\316A+I\256s\205:D/\031\300=[\b\241"
+	.ascii	"\214i\345\361[\337\337\332\033>\357f\262\255\210\376\322I\033"
+	.ascii	"5\216?j\270\006\255\240g\370\320\t\024\315<\252\320:\0323\240"
+	.ascii	"\276b\210\227\276\343\037]\370~\326\367-\354W\210\261(|\307;"
+	.ascii	"\236p\t\337\307\372>\323\327\b\207\215\366\325\367lu\253\035"
+	.ascii	"\365\252\357;gi\242\036\236\214\030\257\230B:60\356\254\316="
+	.ascii	"_\270\200\372J\365}\252C\240\232\372\324\217?J=\352P_\017\365"
+	.ascii	"\007\317\332\323,q`-\266\203\307O\355\035|?I^\316\001;\303b\305"
+	.ascii	"\323S\003X*\007\005\252\"\005\n\247;\035\357\364v\237\301\327"
+	.ascii	"\033[6\205O\244\2340\336\270\340\013\332\307m\035\222+\334T\243"
+	.ascii	"F5\335\2229\271\227K\033\"\201Z\311k\027\270\334\323qpq5\351"
+	.ascii	"\254\243\337^\037\317f\242N\342\0238\370VF\273\261S\324\230\202"
+	.ascii	"\032\211\274g\307I\236n;\376\350u/\257\257"
+	.string	"\367\022\361\020V\267\322\312G1\373\303\243\215$\372A\357\350\"\353W\020\217\377\316P,n\356\264\020\371\355\016M\235\016\302\352A\302'\234\216\276i\272\204aj \333\013\242\224?\315\266\366\"\340\225/j\264\232\033\205>Q\352\037HrR\354\315M\3738\312\203\327\247{\034&\203\347\224\3524\344\221\354v\2333\263\324\320\247\017\373J\352\213\364\215~v\275\353\310#\273\276\352\264\302)e\232\007\327\271\316ux\276sW\005\324h\036n\234\233\364\235=\321;t\\\013\"\326!\3523\263\034N]Fv3|_`\364\030\362\310\016\357\200T5'2\t\201*\250Q1a\206T\215\314H\222\224:\321\004\3169\006]\235\007\022\300\3645\2101\022\221@D\222\222\244\244$\245\3120\007\350\242<\244\363\320\031W\017\336\376\337N^a{:\371-\177Q\315\364\372\303\362\360YS\264\2623)\374\013\371\273\363\f<"
+	.ascii	"F\337&\344\232)\353\033R\300\361g\302r\370\212\250?\203\033p"
+	.ascii	"`0%ig\b8\233\356\330#\225\3424\243=4\200\316\017 HT\224nG\262"
+	.ascii	"\007Ox\230)\262\341\276\277;#+\" \220\2218\t[\233\\\356o\262"
+	.ascii	"\303BX\346b\303K\323\366:U\262\221\227\245\241\275\034$PN\204"
+	.ascii	"[\245\375U{%I\315\023\206\270\216\262?\360\227\232r\007\373\204"
+	.ascii	"\235\233\355\031q~\177Ge\277\fPO\357N\022tr\n\020\230\355\301"
+	.ascii	"\224\025\342\2607\273\365\267;\240'\017\025\0371\252qW\227s("
+	.ascii	"\224D\213\024\022\216k\330\211\347\253d\225\343\311\b\376L\243"
+	.ascii	"t$\261\271\n)\336\027\036M\320PR\330\206\201\245\213Ci\301}z"
+	.ascii	"\357\300\372-s\333\370A\320\320\030\"\312E\377a\217G\271\223"
+	.ascii	"\332\315\302g\256\353\367\251\\\007y\211\f\202`\260\026\320\217"
+	.ascii	"3\b\2340\334\b\320\017@.{\271Vg\366\207\316\375\003=\224\324"
+	.ascii	"\232\232S8\031%\240\232\320\367~\207\001\017\370\035\270\216"
+	.ascii	"\351,\036w\254\362\213\374\235y\364x\336\033\257\n\301\031c\372"
+	.ascii	"\311\264/\317$\274\2129\020[\241\2164\372>\034\372\216-\035\352"
+	.ascii	"\310r2K\354\266\261\236\027c\324R\227\327\300\030\372C\005\371"
+	.ascii	"\222\2750]\314\324\231\327\025wq_\344\314\367\323C\332A [\231"
+	.ascii	"\346@\305\261\252\007k\260c\246\005cB`\360\337!15/X\027\303T"
+	.ascii	"b6\0022F\324X\004\364\340\304}u{'\373\230\263\271G\203\013\344"
+	.ascii	"\307\343G\210\315\367\361S\325\306\376\222\253\337_s\370V\303"
+	.ascii	"<2\322Q\021}\352c\030(:\fNK\373\2521\006\3128\241\272\345 \270"
+	.ascii	"p\203\021\005\317P\231n\247T-$\241\332H\360\326\2568\314\271"
+	.ascii	"\262B$N\334\236\254o\374\242\206\311\303\\\225\033\373\310u\314"
+	.ascii	"uZ85\nL"
+	.text
+	.section	.gnu.lto_.ipa_sra.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`<\005\225\017"
+	.string	"\006\32172\320j'\215\001\020\206F\021gY\226\265S\257\367gz\"W\343\024WWb\231\206\215\202|\347/X3Ex\3151E\025\207\257\241v\244\021\262eJ\001+"
+	.string	")"
+	.string	"*"
+	.string	"\240\313\276\033\321\241\356\233\220\210\200xp\260\201\241]\366\351|9\243;\335\335\302H\324,\365BW\373\233\225m\351\231\356\263$\b#('&\337%\030\3115\"\022\002\362\261n}\036\253\302*\325\336;\236\003\333X/u\177\251\227\206n\306\331\276\260\250\240h\001\363\350\252wp\004\255\356n\230\315\326\320\314\354\312\240\356d\332\332\230Rh\244\2725\314\314a^\324eoa\331\225O\205DJ\t\356\023t%\204\324R}\004!\374@\035\334`g\360\202U\201\t\232#h~@\003\005\224\300"
+	.string	"k\001\006"
+	.ascii	"\360\263\373\330c\200\225\250p\226\221$\225B\007\240\202!\252"
+	.ascii	"!7\022\340\004IDD\022A#AIRf\251e\377\r%0&\316\364\264x\335]q"
+	.ascii	"J\2263\370\231e%\n\265\020\302\365^\207e\355G\223\234\373\237"
+	.ascii	"!/v\220>\024\357\204f@\322\273O\007:\031\by$\226\256L#3\025\255"
+	.ascii	"E\234\304\314\243\301\303\020\312z\212\001\370\rp\032\016\313"
+	.ascii	"\302\023TQ3\320K\344\216\307}h\214\333$\345Q.K3\2569\300\020"
+	.ascii	"\331\263\341wH\267{\321~\212?:c\313e\314\272\033\005\271\310"
+	.ascii	"\372\262\301p\374\035\220YXI\255\261z\207\022\341e\244u\344\004"
+	.ascii	"v\256\312I\020\2408\004\f2\314\302}\006YOI\210\003>\002\336B"
+	.ascii	"M,\227\037\361\312\273M\212\241\344\243\306\3466\323\b)\360\303"
+	.ascii	"\001*|\325\264\377\227\375\177A\r\230q\304T>K%\006\346<\007e"
+	.ascii	"\261\220\200+\361\346\312\306\024\306\016\313\207\256\033\031"
+	.ascii	"\326\232\250|XB\203\246T\017<qI\022\340#"
+	.text
+	.section	.gnu.lto_.inline.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`Q\033}E"
+	.string	"ZN\274\020C`\346M:\253\211\212\204z\276\264\317l\377\240Pk\344*iL\355f\nQ\326\016\252#\342H\202L\007\357\340\255\316\205\372\217zyaB\33225\244\343\027\344[\223\373\251\311\202\206\231\355\220&\215l)S\356"
+	.string	"\354"
+	.string	"\007\001IC\365?\022\006\201\277\242\252\377i\016\366\361\2066\365\216#\235\241\354\230\2674b\276\346\013rX<Bp\332\234r\330<48m\022\216\240h"
+	.ascii	"-\263oQ\340\377\223\265\375\001dbM3\242\231\360JG\013\2449\306"
+	.string	"\306\027E\313\315\022i\252\277\2105\317\202\027\020\300\222Y\327@w\277\023\223z\356\336+\214\262[\367\336\337\221\320\177\252\263\2105\315\206\375\237\247\272\213X\323,xUU\337\351\323\367y%S\251\305]\3127n\351?e\205\254k\362Az\264\016\275\273\017\316\236E\363\355y\312\"\231\311\274\003\027r0o]W@GQ\3265\017\370\037\027I5\327\275\027\200T\227\335{\215\336\263\377\355\362^+\337\037e\211\334{\217\372\267Q\026x>\177\276\337o\033\275\274\367\372\376\032|\376\366+\232\317\347c\337{o\357Oq\002!\002l\322_\312\016\322rc\206x\376D\332\267\260T='\315+I\374\007\017\306\016\377\231\266\372K\016\251E}\034\374\206&w\032R\"\367^b\377\311\275V\3523`\270\360?u\321-\234i\353\374o\324\373o\343\3543\222\302\323O\266Z\346h\315)\271h\266|\246\262E\306\330"
+	.string	"\r\277\364dm\335\204?\365\323\364\372\230\243:\275\004`\037;\375\243\372\316\352\271\327J\370\bg\332\342\237\203\226\252\323\314y\253C\274a\301\270\321\202T\017\341\007v\361\344\007\355o\3723\235\321W\257\322\3507T\302\224\374\316\367\334\367}\336\237\227F#\253\344\251\363S\357u\3520X}\326\316\247W-\336\027\257\223\235s\263c\007\275\361\336xi\364\22297\274\337\325{\177\264\023\272\320\337\307\275\327\352\027\376ojF\263\306M\215c\311M\255\343?"
+	.string	"bg\253\027\311\251'3m=\351\312\020\375\0377\306vg\354\2701\266?\022x\331\003\365\365P\246\255'\273\256\211\364\fQ\222\204\354\274#$\210\017\235\036\223S\331\027_<v\223\316\b\223(\325\200\200\300%Q\243\372\212\213+\356|z\017\325^w\232V\322\243\227\227Xq\004)\3370\221\024F3/5\2431\232\341\324\360R\363\370\321\205.uU\317\307\032\024FW\361/\215K\335!\266\272\215\377\177T\277\361)\243\306\201\032Z\222\301k\374\255\3463~\264`\214C\365rO\233\035\027\2437\265"
+	.ascii	"\006Y\254\340\227\005U\244\370\355\211\202O\266\256y\303/\353"
+	.ascii	"\212w\244\236\3504\246R\013\330\206\251\314Zb[W\257\0047q6_\276"
+	.ascii	"ml\303/\026\3254)w\323U)\027Wb\310\314\354\273\366/\230\252\313"
+	.ascii	"\230\3118K\004JX\022\310\021K\021\374%%\016[p\fX\2410\r\3750"
+	.ascii	"\260BP\032\034\004[\250.\323\034\013\377\261\226\377\354+\342"
+	.ascii	"0k\005\357\214Z\367\001#vW\246\251\244l\005QJWE-\354w\256\202"
+	.ascii	"D\202\bM\261\017dH\242;Jg1\250\306j\263\343\342;K9\2533\305\217"
+	.ascii	":EP\033/\352\031\031%\bz0\246\222N=\207!\237\364\332\227\345"
+	.ascii	"\021\324nK\232@\277\263\2233!H\310\214v_my\024\234\301\376\367"
+	.ascii	"\227\374\305M\274\204x\256\222T\344@\341\254~]\030\272C\227s"
+	.ascii	"f\202\264G\222dX\002\244\334\305\206\350\310\300\031\366\225"
+	.ascii	"gh\314\222N\346b\243\232\026\317sFZ\003\230:\365\324\342\213"
+	.ascii	"N\315T2\221}\276?\266\322\032\b\370_F\363j\300H\310\206\312\350"
+	.ascii	"\252\243\205\326\365P\205\363\022N\002\224j(S\370\230Qa\247\206"
+	.ascii	"\246\374\3329+@\377\252\313\227\333\321\031\353h/_\025\311!\365"
+	.ascii	"\032Q\232W\026\021\375\2659\366F\201\227,\344_f\335k% \345 \310"
+	.ascii	"\037\033\tw\357U\003\202\f\250R\373\322!e\016\321HA\222\264\006"
+	.ascii	"\262\t\020\222CI\022\007\222\356\022@\002y\220FQ\312\030"
+	.string	"c\fQDDDdD$\020\221\240\240\005M\032\003L\266\263\337\323D\003v\327\017\026\306\301 \035k\232r\210.c\204#\216`\033Z\376fi\320\214^\3412\262\373\206j\b1 \004\246{\243\\G\b\004M\365\334\270\205\325\331W\203\321\302o\037P\253S\273-\022\277\224\274]\243\304a\372?\"\370R@\200\037\016Z\300\235\223zP#\013\b\027X\262\374A\003&\013\200\272J\322\306\247\301_.\235\354\320\231c\352c\331$|\324\223\210\275\322\260X\302\200\244_\257W\277\246\374-\031\302\240C+{\021\032\374UO:\234\350\203\017\326\234\201\313\301\025\f\255\347b\32708\267$\b\275\245\273k\004\217\210\362\211w\300[z\021\177\361Po\325\3666P_\035\207\373\024Z\346\262*\240-\024\361\352\200\206>\311\374\2131.\312*\217\177)`\211^x+\301b\335\025_\034#\302\326\0069|k\324\274"
+	.ascii	"\030\361\243\245\346*\232a\251\n9\020Q\227\"\367\375\tX\310\336"
+	.ascii	"\342O\247\243\273N\031>\263\212\026t\005\030Z\b\243G\021\255"
+	.ascii	"j\340.%w\321\233c\027\016*\233\211o\272D\177\302[\347\226\005"
+	.ascii	"c\362\001\312?B\177\007\261\007\025)_=\261\305\254\321\230~:"
+	.ascii	"\276\3520\002\032\250v\245\223L\351\177\2032\204!L\265\255Qz"
+	.ascii	"q\355\3562) \216\272!\177\252\321\271[\253p\362\222t0y\ry\231"
+	.ascii	"\2570\227\260\366}\372Q>5\352;\035\204\320\233\205\241\022B\254"
+	.ascii	"\3435\375\005\347  \002\0373D\213\207\007\350\375\376W8|\357"
+	.ascii	"\232\f.U[TB\365\007k\337\330\350\274\352\021$\375\310x<v\304"
+	.ascii	"\224\322\252\230\264\036\224\364\037L\303\336]\210\2049\327\232"
+	.ascii	"eOk\n\016\241\020\371\030\256\365h\300\315\311\211\375($ni\307"
+	.ascii	"m\261\2351O\032\353k\346\373h\3100\262E\340\205-\016\217\273"
+	.ascii	"*\342\276[R\214\365\315\020\243\350\022Ax\247\304%\373\362\265"
+	.ascii	"\327(\270\221f\211\n2\326%\230\023UL\323^\362\021&KB\230\256"
+	.ascii	"c\245\267\027\313\336\346\314\013z(\235;|\027&\b(_\300w\232s"
+	.ascii	"\217\031,0\241\023\265\307!D\310\213\2619$\201f\217\271W\263"
+	.ascii	"\262E\231:o\344\205W/;y\035\277h\177\255\025\352\362t"
+	.string	"\354X\255\2031\340\245\024\224\253\\,0\274\257f\20639\260\347=:yTU0\227\303\232k\315\b\303\034M\310\n\f\325}1\355\315\246\210\310\261=\305&l\317]|\322f\032\222\344\363\223\350U\263\275\327{\267\267jb\334/*k\326lL\347\333\266\270G\350)\330U\004\314\377\2767\031B\304\244H\034\017\234/\016\336_\324J\026\327\006\333Jd\003\244\316#\236\"\210\312x\266\321ik\372k?\233k\377\307\025r\006\032\004t\372\327t\262\371\322\365\362\330\215G\332\026\330\030'\206<\247I)\313\223E\034V\032em\365\304\304\355|\223\240%];\226;E\331N\343B\214iY\253(CH\252\3162\213\036\b\2320\316\"[\271d\363'\257/\341]\270\347\023\006\337\314!g\254\321\3419\350`\371\332\007\206#mnH\253\306\f8Tr\215\230\246.c\260\027\222\222\262t\362\001|\253\225\026"
+	.ascii	"\377\215\243(\340"
+	.ascii	"V\331\232\322#\264\277\035\\{\223\224\274v\363\r<z\\Jtc\005\205"
+	.ascii	"\237\372\315\260\030lh1\312u\025\326\275k\305-E1`\206#B\031t"
+	.ascii	"KMN\306!\201\270.7\250\205\260\321\2631\220\005\332\213\0323"
+	.ascii	"\204\332\t\316V\340\357\346\f\241\b\"g\264\256\273\355\202\025"
+	.ascii	"\004\020\247\330\001\002\2050/D\345\205\205T\344\003\031\004"
+	.ascii	"\300\233\330MVm,\255\226\033\346\274O\377\224\2052\346\250\350"
+	.ascii	"jo\3066\037\t\301\236\223\343\312\234\334\337\326Vf\016\217\367"
+	.ascii	"3\315\363*\302\262\362\260J[a\204\r\307\2632d\256\204\312!\374"
+	.ascii	"}\374q\252_Lu\347\351\t\207\b'F\364\024\313\326\253\367\255\206"
+	.ascii	"ye\230u\002\327Ri\271\317z\216\343:\001\374bl\017k2Tal\247\017"
+	.ascii	"\332\235\227`\256d\333M\232'\271k\271\3161\003\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`F,\255X"
+	.ascii	"\332i\260\0268@\3566\007\033\245\f\307c\327p}\363\365Z#T\227"
+	.ascii	"\277S\030M\n\021\261\211\344M]\220\f\215\266\023\371\n\332'g"
+	.ascii	"\005\004\264\016\342k\343\020\021\021\265li[\312\224\002O\001"
+	.ascii	"d\001`\001\200\326\264\331\303\207\362f\017\317\306\342\354\241"
+	.ascii	"\r\024\371\225\263\207\027\036\215\316\036\346\306\254\353\354"
+	.ascii	"!\002!\356\336\331\303\2551k\t.\311\305x\366\260\366\216\226"
+	.ascii	"g\017\177\314\342Kx\214\265\2646`w\003vy\370\350\201]\327f\026"
+	.ascii	"*\304\350\263\230\230!C\357\222\\\322\035\022$\354\303\313\035"
+	.ascii	":\036\267\305\0348^\270\367\215_\3648\033\\\\\357\226\364\013"
+	.ascii	"\267\273\242\306\370\037\273[\377\270\006\246\341\036\303f3\202"
+	.ascii	"E\030X\277\360\0268m\213_\357\2530\235\377\353}W\270\277\257"
+	.ascii	"\241\017\323\337\347\361\347\367M\341_\357\373\276'\204&\346"
+	.ascii	"\224\370B\231\204M\323\026\177\204\213\360\020\016B(\374\340"
+	.ascii	"y\302\317\231\343!k\332YS\207\217\360\370\377\375\037\364/\350"
+	.ascii	"_$\263\335\1774?\032\277\273\370]$\263\367s\340\321\205\335\177"
+	.ascii	"\377\377\305\r\257\352LP\025\232\374\257\341\377\374\247}\206"
+	.ascii	"\374\276F\204G\336%i\374\356c\177\354\030\f|\230\366\017\323"
+	.ascii	"\370\031\274\230\346\216\335/\370\336\242(\024\n\205\356/\246"
+	.ascii	"\341\027\323\336\361\243\375\321\030\357\b\003\322\300\305-p"
+	.ascii	"\005\b\300\f\024 0 \200\013\240\213K\353V\313\032\273\371\377"
+	.ascii	"1v\037\373\327?v\033.\246\271\207\021\t\370\177\340\327J\203"
+	.ascii	"\023\342\314\224qG;\242E2c\334\177\330\223~_1`\334\277<\241\307"
+	.ascii	"\263$xq\377.\356\317e\013\316\305\"v1-\242h\004\347 \316z\301"
+	.ascii	"\202,\356\2176Hc,\370vg\314x\320\240\030\330\177\374\225*\016"
+	.ascii	"\006\366hL^8\352\377Q\343\177\360\340\321\230\020 \020\341\361"
+	.ascii	"\257\310?q\342\376CG\216D\367_\262"
+	.string	"\267\031\021\234\265\022wwq\004\347:\316=t(\310\031\016\246\245\251\031\263\276\215\271Y\271%\331\247\306\314\025\252\322\230\267(<\nm\212?\034G\253\202v\005\377\223\257\211\357\244\364\327\362\236\204h\314z\007\332x~\263\031\263\376\"e\037\031\263n\364Bw\254D(D\342\300\006\313\324\230\265\215S~m\225l\214\306\254\005\331\352\344\327&\307\246\306}\333\2261o[\024\035k\314Z\207\322D\tQ\226=\324|\354\270\321d4\2251k\355D\013Y\225\372\204I\322\226=\254)\032\263\026\2401k}m\316\230\273\354a\215\315\230\265\374kYjLDX\242(\221\222xH\324#\262\371\262\207\"\225,+s\312\211\362\2360{\230\351\3443\271Jf\342\n\233\2724f\017q\2421k\274g\314\273\314\036\342;\330\314\230\267\273X\013nrf\017\337U\232=|Qk\366\360#}\347\357\254e\331\362W\246\246"
+	.string	"\234\b\317\313\315\234\0043\247}\267S[\240\216\344\351Z\325'\300\211\360\310\335/\335\322\351\312.u-\305\274\374\\\3132s-y\344X\331\353\362\336Z\222-\273\242;\322\247\222i\251#\325\365l\254\200\007\360\264$\363\251h[\246\352o=[\037J\352V0?\323\266UW^K\236mI\206\266\272\222\\\321\022\314\327\323D\311\314\326\264D\327\223\025\340\346\251\363\235\261> y\262\300"
+	.string	"\236\252:\265U\327\337"
+	.string	"?\333r%{e?rU[\265\367\345'0-\311\31035Q\262Uy\254\031\300OS\355\221c@\261\323\334r\366\\\201my\356n\376\201\315\341t9\234\231\236\350\n\\\213/\377a\346z\324\334\314e8\030\326c\314"
+	.string	"\312c\314\352}\005\372_\301O\310\204\306\307;\344\227\364\007\302d1\301M\236\202\235\016D\301\031\273:\204[\341<\374\022\004%*\030\352\211!G\t\272L\340\n\222\312[\202\246D\016\356.!\330*\210J\354\360\265lS\364Y\202\251Z\005W\351\177\242\244\320\243|\345\261\233Ec\257\325"
+	.string	"d*\271J\320\225\370p<(+\bK\003\br\004\347o\364\330\313\035G\342\177/\257\3671\316Q\006\f\370\340\2531f\300\300\325\2101\002>\246\246\270\235\2123}*\266,P\270@\001\203Nw\276\362LQpA`sa8/\224\354\\\0058\233\303\2619m\342z+\272\302\313\331\\\366\263W\372p\355\256\\Ql\271\231\253`\3464n\306\226\373T\224e\317\365\327Su\270\031^~\246\350nLM}h\217\313\254\354q\271Y\316\314Bm\313[\340\257\005\312\340r\026\027l~\246\245\216%\267\\\0020w\363s\254lS\225,MO\035"
+	.string	"\007\346\262\357\316u\373\252\262\276\323F\353;\327\025\250\363\362\263\207\266?UMo=\325w\232$\313\236:u\375\t\360\255[\271\334D{\333\325\237\331I\256\274\366\3467\037R\236\253\030Y\376\332/gu\252\256\233\247k\321\337\255\254<k\323\322\306\252?\033\253\376\366JV\372\366\231\216\225=\333\315S\270\230\221\236d\266\365lSt\327\265\345Dx_\003\374\0074}h\031\332e\242?\262-\305\310\274n\370\320\030\255\211T\345\261\347\312k\r\270\017-\307\310\263\026%+\3271\022m}\245"
+	.string	"_\315\312\364\\\301\274\345\215\241g\031\331\372P\365\327\236,\331[\317\326,\340\345Z\336\345e\345\031\331\242=4%{@\326D\177\001nn\372J1\263<M\262\254<\353\362\335\357\346\001\202\177\250R\032I\006\235\241\221\tD$I\2224\006\362\t\020\212Fy\034\350\220n\022\200\362<\205a\034\205A\212\030B\b!\310\030eDD\"\221\021\021\021\265\003I\331\200G\\\200\241\264`\265\306\017i=9\315"
+	.string	"\206\343\226\226\226p\340\265\321\202\003Jm@\002d6\242K6`\210\212\2744\022\325\n<\241\276\305D4\027+\316h\f\266\\\346b\316\335\030V\214\007\270\013\376L\251b\205\345\355F_!\251\372%"
+	.string	""
+	.string	"\315\025x"
+	.ascii	"\234wD\320\334\246!\310\023V\021\003#\230\037\004\361\234\306"
+	.ascii	"Tv{\336\013\264\227\n\214^\370\345\204\346\203T@\217\304o\220"
+	.ascii	"e\353i\020\3577\317\345}\020\274\f\355\266\036\301\335\301\020"
+	.ascii	"\2263i\311\210\326\001z\260$\311\242\033$xN\233\337\243\351\314"
+	.ascii	"\bOs\222\207vS\302H\216s?\242j\304Y:\246A\005Y@\375\032\271\274"
+	.ascii	"D1\357\350a\035\200I\253L4\016\021\232\244H\345r"
+	.string	"`\351\267;\265\202\373N\347\323\220\213\201\325\240\356\201=\347E\365k\004\231c\376\241\017b\201\357\350\314\022\246\331\"@\224&\017\265\357;C\216)\305\177\374\267\307\344\023T\240\276\2210\307!\314\bkk]\230~\216\240&\230\214mh\377\246.8[\271\234zg\327\202\346\276_%\361/P/\332-\007p\234\006\027}\275\345i\254S\221f\331\217}\213\250t0\2642\204\017H=.st\023\221d\330\t\205\006\236\017\277\201\350\310\224q[\250\212YG3j\334\006&\034\361\247\t\331\3163\207\026`\357Z\332T\246\255\021\n\035\004`\206dD\240\270,\037\367\254\006\244\357\207$\346<\353\272\303n\f!>!s\360&\b\362=:*\200VB>\303n3@3\016u\224\273\230\345\356\371%\353\332<\374\305\201\226*\304\036\024\003\360W\211\254\353\243\233\344\030pr\253\257\003\261`K\365\356\350\207A\360"
+	.ascii	"\337H\022\025\007\200\321\263\352^\202\r6"
+	.string	"\332\007\241E\243j\275\t\241\021\275\311?\013\306\030\236\001\370(\026\331h/\305\273\237\214a\031C\002%c\321\206\370\224\036d\005\n\267\020,o\364\203)q\031\375`\017L\230D\367I\206<\245\325~)\311rt\3221\302L\261\362\374\002\225,]\242\260\351\330&\221\345\222X\254\r\316}\037\037D\233CV\261-\273\257\370-:\207*\335\017\030\006n\356\3216\247"
+	.string	"IP$\362J\002\025\343Mf\366K\363W\304"
+	.string	"\201\213\221\312\314t#\032?JN\353\270\341;\021\310\005:R[\332J\274\006\r\311\034\243q\001D\375\346?9\265\317\342"
+	.ascii	"\016S1\246~1\221\0366\317_\236\243\310\320\344\206BU\217cB\276"
+	.ascii	"KB\240\251\225\312\023\365\372\001\363\001j\313\354_\026X\223"
+	.ascii	"\354\201\022\310\332E\362\032\236E\001\360\234\004q\222M\250"
+	.ascii	"\2506\366.\f\346V\375\276\3420\314RP\025\026\365Xa`6x\341}\275"
+	.ascii	"\212\314\311\2047:8\323\340G\31601\232H\361\306{\346*2\3050|"
+	.ascii	"\374\200&\237h\252\202\3463[\255d\332\276\314QZ\351-\301\332"
+	.ascii	"`\226W\267\200p\r\360\360$\037\224\020\244@\204\326u\314\007"
+	.ascii	"\026!\243JOb2\270\211m\316\027r\0352(\350#"
+	.string	"\261\341EM\220\332\b\276\bD\331\024\337y\3572fKA0\267\253c&!*\242\\\225\213)e5\177d\235\266\202\203l\027g62>\332\234\246=\b\342Jb\366\234\360\371{^\256\263\021\0346h\234\335\022B\321\240LU\026=\362\b;\b9\024\226\020\234\200\rl\354\305\355@\313\225\023\320\030$\213~'F\177\271\326\311,\254#\001T\rd\311\377\267AA\033\334\345\233\367oi\302G\n\006S2^\221\"\220\207\224c[\316<4\220\027:\336\025\361\225\006\256\260\204\366ic\002>\356W\352\301^\242\234M8\340K\353J?/E\007d\210U]\207{r\272*Z\036W\220\345\267U\201\361C+\006\365\230\242hC\026\234\366\376\205Y\377\307T\032Y\3579\223]\214Mz\250\245\322\226!\177i\355\206\271bs\005\241^S\313\316\304\273\2033\036\225C\006\013zJ\003y\3269`\016\026\376\240"
+	.string	"\326\n\225\003\232\336\262zCB2Nt\310\206\364\tV\211Z\301\220,c\223%9\3014y\244&\210.T\365\232\302\364\342\337c\003 \233\013\243\317\030\310\265\301\330\n\345\330\003\350y \243\253\004\366*:\312\267\020\213\"\322\263)\376)V\"\" +[\232U\200\311\215p\347%Bf\254S~8\022\031\310n\027moj\266&\027%\001t\324\243\005\201&\203\304\306D\362\005,\271l\307BL\333\201\020\rfG\004\302\201\265g\215\r7\"\3647kCd\n\202\034=\245\244\351\311D\026\273l\206$\351\332\275K.\261e$v\365/\322\3316-\242\373\f8\312\206Y\2765\264\263{\2152\224\362\341\346\026\355\216\352h\324a\223\301K\351\255\310NR\005 -\200\245\004g\214\256\034\344\342HOY\263\3312\307)\024<\025\033\261y\021\330"
+	.ascii	"\25260\003k\373Ez\353\"\327"
+	.text
+	.section	.gnu.lto_.pureconst.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"}\006"
+	.string	"v\3212*"
+	.string	"\207U:\354\362\t\301Lf\016\326\344\262\302\177\247\257\365\377+\273\366\350\023\210\356+\345\251\305\177u\344\250\007\222#\212\224$\001("
+	.string	"("
+	.string	"'"
+	.string	"\b..\213[q)\356\304\225\270\021\027\342>\\\207\333pK\227\341.\\\205\233p\021\356\3015\270\005w\227d\"\221V\n\227\313m\271X\356\312\245r\245\\(\327\3114\231%\223d\216\\\"W\310\0052?\246\307\354\230\034\327\306\245qe\\\030\007\265\2409\240\273\2379\237\271\236k<w\247\273\235K\347\3129\001\316u3mf\315\245\2313Sf\306L\230i\232/\001s\007\346\f\314\025\230#07`N\300\\\2009"
+	.string	"sGsFs\375\264\3724\316\025\335\021\335\r\315\t\035"
+	.text
+	.section	.gnu.lto_.ipa_modref.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\207\b\035\033"
+	.string	"\246_fE\360\260&\351\330\201\317\300\260\201\215\312\256\n\374\320\342OW\025\327q\fL\220$\362\320\357\355\311D\301J3\360\030\270\217!y\334\337g\265\254\311q\240X\313\254\371oJ\bd\234\304qf0K\364\273\255m[\246S"
+	.string	"U"
+	.string	"U"
+	.string	"\247\200\332\307jiQpJ0\204\231\213\305\202\340\300\327\203\235V\201\217\261\217\265\262\021x\020\304\\*\225\001\237\240\200S\200\337\203\351\261R"
+	.ascii	"\374Uy|\236r\330\377\305x\177\221]\241d5\332\253\312\036\343"
+	.ascii	"\367>\222\275'\331_\333Q\312E\376x\017\023\001 \250\265 \324"
+	.ascii	"r\334#\314\276\222\304>x\340V/\035\232s0\301H\bSGn\320\220a\f"
+	.ascii	"\207|a\013\177bW(\205'H\210\220\271d\207\2209\037\216\234\217"
+	.ascii	"\363\376\321(\037\374y\261m\333:\016\332\321_\3217?m[6\310\242"
+	.ascii	"\262!\006\177f\243\013\342\0011^\025w\211b\346\204\201"
+	.string	"\020\316\304\305q\034\267\242\353\260\256\313kh\366\\T\214\314;\223\231\347\245\275\264W\351\265\0221\331[\231t\361\220X\025\323B\225da\262#~\313\276\345%\311N\222)\342\323\246GJ!:4vp7\\\257\223\364W\344c\324\270{\213H\"R\nD;\222R \236E!\021\210TH\373qn\r\rN^\323\214\354T\346\273\2561\237\255\302\374K\327\271\264,\203e\345\2532\353S\356\315\315\352\317_\314kc\263\235E\371\344t\361&m\321\027\367e\361\336\336\037\320\035~\"L\006\200\360\250!]\310f4\005\311\262\033\220\002\031*\"v\021\3400f\240B3#\"I\212R\3104\006\n\033\204|\0241C7\003\004g\270k\302x\211b@\251\001~\343\2018\007\013\016\031hc3j\333\024(x0{\353?!g\3374\251\3372\013\253\2552\244!A\235T\221\276\341\242\254\004nj%\"\343"
+	.string	"\205\375\300\013\332\277<\"\354\321\231>09\256\345\227\343v\232]H\335C>\"\343y\323F<M\204\035\304\325\220\310'o\337\023\260\223\315h\201\371\355z\235\300#]\242\243\267\240\341\274t0\205\002\320\022\013i\266\240xm\212\316\224\201!!\276;f\007\342,\260T^C\034\214?oT\"\\Ia\262\b\177\204\005\230\267f|>3\244\215\002)<\261aq){\214Z\260\017jtK\224\246q\035\305f~)i\271\224-\244\355\017\303Y-\007\0315\311\336 \357\005\321X"
+	.string	"\204\204E\316\253Y\310=H_7w\365\233\233\205\353\260t\017{\006\272\352&\210\266c(\244\201\024\004\333\2714c\\\273\332\003Q\007\235\371&\203uO\251\261\327\263\224t|\351\270\024\357@\005\352I1\224\346\215\376\261\201\232\210\334r\227x?Se\212\214y\234t,\033\241\273n`\376~\267\371\2762\372\034\256-\226\tB\373C=\313\3211M\365\035BD\272\027\373\322\253uH\313\013\355\375\233t\226\202f\306.\032\250'\221N<\207\375g\366\276\230\221\215\025\024\253\310\030_\210#2\330\350\272OE\366\031.\230\361!H\370\0213;\001\217h\031D\207\344\213\026\264GA\371\360"
+	.ascii	"\365\202\036_\226\242\213\003D\255\232y\037"
+	.text
+	.section	.gnu.lto_.lto.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.7.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k\001E\016"
+	.string	"&\032^D"
+	.string	"\263$\035c"
+	.string	"\361\356"
+	.string	"\272\033\256\203\347\323n?\215\265@W\007\342\317\232=\315\327j\321\0138\3046\365 \274\276>z4\312M"
+	.string	"Q\327\200J\n\n\232\370\257\006.\252e\360\207/\026i\272\221\275\245L)J"
+	.string	"E"
+	.string	"K"
+	.string	"\326\335\231\0319\273_\002+"
+	.ascii	"\360h\223m\343_j%\334\210Q\361\330]LA\334t\250i\362\217\363\220"
+	.ascii	"\207:\035v\270\302\003=/v\210\240"
+	.string	"^\340\210\214\b\3578\317\r\250.\023\364`w\235\036\212\303\035o\033\202\355\b\366]\004\326\261\036\257\006Bxp\311\225Gr\324\330\374\261\277Sj\215}\270Jc\377\346\017\3214\b\246\255L\307LCMk\2463\323\027\t c@\212]\231\225\217\335\2110F\330>\210\375\216\205I\246\275\240\304\364\233\226\206j\351c~D]q\017\007\202C\215z\230\231N\005T\006<\252\243`\031\221H\326\243*I\017\030J\233\273\220\367L\240\323\2237\035O\371\364\344\250\326\244^\263\0234^\322\307\204Jj\310/\361\3171|\033\257X'\357=\372\0016\321\034\234\224d'\333\245]\002\266\025\024Q\206h\n\0277\232\240\201\313H\232\b%\303,\214D\0250\255\244\202]\005\314\245l%\f\003\307\2250\220o\017Wi\342\317\216\213v\016Q\277EJ\013I\312\306g\261\036\033\360|\260T\025\244\252\202!\321\345*\037"
+	.ascii	"8\311\007K\275\231\241}\002\003\377-\334e(Oc?\r\201\305\224\022"
+	.ascii	"\307\024kp\231\310d6\230\223\203-\2140\316\300\275\204\221,R"
+	.ascii	"\001\310\250\3104\327\2401\200\205\317\0345\252\025\027F\324"
+	.ascii	"\031\273\323\324\220p\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.113.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375 \231E\004"
+	.string	"t\007`"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\b\005?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.ascii	"\312R0\345z\230\305S\324}\003(\002"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.115.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375 >\315\001"
+	.string	"\344\0021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"\003?\202\210\200\300\001\177}\273\001{\273\001y\275\001w\274\001u\273\001s\274\001q\274\001o\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_blackboxProfiles.116.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375 }\345\002"
+	.string	"4\004p"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001 \001\005\001\006'\001\230\f\005\001?\202\210\200\030\177}\275\001{\274\001y\273\025\001\002\246\003\300\274\035\001"
+	.string	"\376\013\303\001{\302\001y\302w3\304\0014\301\001\277\001\276\001"
+	.string	"\n"
+	.string	"2\207\001\205\301\r\260\003\215\001mA\265c\347\302)\002\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_blackboxHeader.117.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375 rU\003"
+	.string	"\202\306\027\035pks\344?b\2771\243\247\211C/W\222\313\227"
+	.string	"X\341LY\354R\3759o;2\210\224Ar\371\364\276\246\335p\205\224\324psz\237\302\025b\224]/K\334I\307L\333\341\217\345\275\253Y\267\237/\327\037c4\267\270\203\027F\323\021\322\323\306\342F\\)\020\022\210$\002LD\004\004\002"
+	.ascii	"\007R!\016\240\b"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.118.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\254\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\270\346Ry\276\004\330\345\002}\301\003\230\345\002y\304\002\005\001'C\206\bw\344\002u\307'K\206\bs\230\344\002q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.119.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`K\f\215'"
+	.string	"F\273\332BP\246j\016\005/\260\217^\rU\017\235H\021=Z\222u-\367\377\377\377\325\377\323\316G\rx\251%e\356\367\032IC\322a\013\311"
+	.string	"\246)R'\002"
+	.string	"\020&"
+	.string	"\222W\377\216\351o+;\332\2262\023\t\306"
+	.string	"\316"
+	.string	"\306"
+	.string	"\246\222C@\"\255\034\320\350\360\241\300\255\321\220\"\370\021\372\333:\355}\t\311A\202\266N\213'\334\341\035]/o\353\344\273DA\255\356\350~\354\266N\352\nqr}\266V{-\260\265\035\375\315mk\2658X\204\242%\325\326\216\236'\336z\355\005\201\272Yd\346\013f\252\237\241\031\035\276\362:G\277cgk\266xx\272\037P7\315\323\3501\214\035\235\316\234,\335\026\227\031\344\034\035\354+K\273\275\256\301\225\332\250\016\023\035^\035\311:l\345\260\321\221W\356\346\350^5l\370\230\026\327\026\2107YGdv{N\002\265\264\\\357r\363\306\351>\352\346\373R\320Mw&g\n\272\251\265\034\r\272Y\216\225e\3221i\326\013\360u\320\356\214\016\337\261\223f>?\202\242dI+?3+K\221\373T\234\256s\241n&\201\251\0376&\306\"\367\2658],\324M"
+	.string	"'\2018p\236\362\337[\300\r\362)\377\305\006^\r\2335O9\360uq\272U\250\233G\007\034\360\214\031\250|h\370_\324\007C\364\270\325\221\360\2079\376\230\027\003C\177\2751N7E\335\274!`"
+	.string	"\002.[\2404X\234"
+	.ascii	"\313\025(\035\366.IQ\035\2462\005J\207\3052N\367\005\352&\004"
+	.ascii	"\005O"
+	.string	"\234\244Z\354]\260\344M\265X\314\240\210\372F\220\034Iu\231\360tS\240n\036(\275\032\274\220 [\227\305L\357\243kk\263\327\301\363p\2676\213\037\270\222\3728>\307om}V\002\365L\276\311C\371(_\345\255|\226\327\362]\336\313\223\3712\217\346\323|\233\207\377\315{\275\234\377\3729O\347\317\036\355\361|\332\257}\374{\236\355\337\036\356\347\236\356\377<\240\327\363\360\202~\320\373\375\337\033z\300G\364\211\362V\316\221\335\314#\373\350\220\203p0a\302\235\255\036\007\344\207S~{O\234\256\263\341\362\313]\271\007\214,\347f\320\274C\307\316rq\3168\262\326\316s\257\206\017\005\356<\367\245\020\241\235\351\342`\037\337\316uo\021[\240\275\235\353b,\350\035\321\341<\274\235\357\336\001FuD\207\375\330\355|\027\0238\342\243~\034\321a\271>;\343y\224GrkKs\336\233\244'O\232\363b"
+	.string	"j\311%\025\253\266iq\267NU,;\025\240\334\253\332\232\345\n'\022F\025+\r\226RT\351\272\262#\204\305\2436\215\242\201T\266\306\335\246(\3660-\356\2525\0250L\327\242\262\235\n\301\026S\021g\251\032\215E\263\034A\"\004[\2541<\313\031-\313\256-\204\302\364\250\034^Em\251`Yd[v\r\226,\215\3426\006K\341\006,6\212(L\247\242\232\250\324tm\022\026\215M\033\036\224l\325.6\265,[lB*\267\324U\253\266mjT:\034\217\343a.\346d^\346x<\315\365\370\036\207s>>\347t\376\307\001\371\236\007r>\357\363Bn\310\021y\242\327\361;\236\353{\374\217\007\362C\236\310'y%\037\200\356\250\241TE %2\222\024\025T2\214\001"
+	.ascii	"#\021!b\035\021P4e\220\"\b#\253\261\326\016\300\206\312\306\377"
+	.ascii	"|\351+\004u\313\234\235\\\020\365\275\207\325\367 `\242\201\356"
+	.ascii	"\323\242I\202xE~\022\332\344\206q\rY\232\207\0218\352@p\321\343"
+	.ascii	"P\307\034\323\224\246\207\224\350\347\031N\246\031\310=\325c"
+	.ascii	"\\\302&C+\241\331\312\352(\034IM\325LYR\225J\305\265\236\263"
+	.ascii	"\331=\230\200"
+	.string	"\312IU\363\021$MDB\037O\246D\203\034\203\353\304\330A,\370\357\345\314\215\364\016\f\r\306-\321\221\th\033 \273\236\250\2013\022\326\332\264\321\016\265\006\315>l\237\325#\030\254\020\234B +\031\021AA\243\020\215\035\006\255\354\033\021\211\004\"Br\303\b\350\272E\350Q\247\323\234\325\024\374\367\245\334\031_\320\307X\355v\336g,\253\b\027c>\207m\0344\277\235\257YV\354\320\327,O\021\354\0347}\n\f\227`\340F\324\236\215\367rQ\223>\334\313G\255\372\350\033\005v\241V\326\306Z\311\001\005\303\340\230+Y\352\032\273\251J\330\231/g\265J\031\027\304wV)3UJw\021,4\302\307X\r/0\227\231N\236\266!\274\261\\d#'2 {)M\212rj\360h\270\177\357\273\334\224s\3629\256\266\341\026\324e\203\230\006tC\263l\021\202#\"\271\364\342\262\244`\360\177\016P"
+	.ascii	"&c\232\001"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.120.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\311\315\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\354\004k\302\303\005\005\001'L\206\bi\330\347\004g\306\307\004\007\001\005\001'Z\347\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\346\004k\321\322\001w\320\002\005\001'e\206\be\230\346\004c\325\326\035\001\023\n\005\001'q\206\ba\330\345\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.121.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\315\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\357\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.122.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\321\317\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\374\004m\302\303\003\005\001'W\206\bk\230\374\004i\306\307\002\001\005\001'f\206\bg\230\367\004e\313\314\312r\206\bc\330\366\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.145.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\355\006"
+	.string	"rM03`m\322\001\003[n\221VKHn{Z\304m\260{S\307&\003Q\350\326\320\261N\213\250_\202\212\210T\303p\022(\364\rQ\372\f\227\027D\310\2262\245\266*\212ga\260*\r\026\367\260Pqp\326\025\341\252\001?\b\205\313I\274w9\n\356\333jH\225`\243\034\377\227\351\252\372N\007'\243\375\217\203\\|\rO`\362\331%\0373]\272\006dTl2\232\262\330<\261\241&Ud\277\255\206l\2475\323o\002\240\222\027w=\021eI\244\021\016\333\031\233\362\001B\306\330!\206\347\033)\235\220\321.tzq\354\211\371\367x3\031\211d\037\315\023 aw\235\331\007t\353m\027\3306\260-\n\t"
+	.ascii	"`\251'\023:\365\201\037`\002t\r\177\214pK\b\022\356\234\251\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_blackboxIsLogging.146.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\205\007"
+	.string	"\242N45Po\322\001\003\333Y\324\302\240\343\324\034\215\326\311\306\322\340m\333\315M\002\335\032j\216\037\035\021\2165\013\372gf\322u\335_\307\324\023\206\030\251\203\354-eJ\001\2662\237\213\303`m\0328\360aa\343"
+	.string	"-\254\0033\004\276 \0240\030q]\030\254\266\275[=9-\020\351\310\001\307P\251NO\372\020\2101\276\034C]S?q1\312h_\344#\035\237\303\022\236\274\366\347{\250\277\253F\305B\224\321\025\306f\213\275\205R3\354\273\325\223\355\264\323tf\372o\300#\345\023wK\321eQ\236I\207m\220]\031A\003r\366m\243\364\016\n\022\311\312\356\006U\343\3313\363\017\362w\302R\242\231BO\200\204\335uj\246\212[o\333\300\366\201\355\220\n"
+	.ascii	"`\251'\023\032\370\201]L\004\266\031\266k\342\316\b\262\204\310"
+	.ascii	"\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.148.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`c\n\3752"
+	.string	"\032YT\023AP\346M:\257Bq\033d\277\316\246*@\024<\004\025\023\306\304\247\311\240e\334\234\035\320j\362\350I\307\243'/\004D\324 "
+	.string	""
+	.string	"\0205\340\t\004\256\214\366\206_\242!\275q\272\273[#\322\244\224)%\001\n\001$\001\374\341\371\302\346\007\177| \312\3775\037\365\361\317\223\357k~\373\370\334\374M\200\032y\303(\017\207\\\255\311\346\243Jw\306\271\362\177\377\357\370\207\377\3268\023\230\377m\3330;\326-\207o\251\202AA\276\251\025\256\301\035"
+	.string	"\367\264\332'tO\3376\241{\376\377\003\b;\236.\034Z\362\227D;\3061\252\025\016\253\247l\272"
+	.string	"\242\240\236\234\232\214LKE\245$\342P\030\004\376\320\323\327\234~y,\200\035\264,\213\022bY*\311\203Z\333\2475v\262\242\306M|\266L\032E@\361A\327\266\307\224\266Kubi>\253\242\357)\271\206\334:\261&>\005xp\364\366m\007d\021Cc\245\365b\333\244F\304"
+	.ascii	"\311C\303\242\335R(L\342\t\312\270\342\006HB.M\336\017\210d\321"
+	.ascii	"\343\351S`\246\247\210\322X\017\337S\037(\206\206ca\354\333\267"
+	.ascii	"=\305\034\341\265\355=\031\302\266]\205\n\231Y\031\223%J\222"
+	.ascii	"\200\t\307\276\330P\237\036\221;\373D\354J\022\377\262j\255g"
+	.ascii	"\344\330\220\275\324\376\273\367\237\303\0374\006W\355\213;\272"
+	.ascii	"}q\363\333\334{\214\344\305\315\017\371o\361\202\027\271\255"
+	.ascii	"u\366\325<N\344\003\251\256\262\243o\334\256\":Fx<\030\022\202"
+	.ascii	"eY\\\267\362\017\364\025\364\304\004K=\363\363\375\343\264{V"
+	.ascii	"\227I\350\276}\232\266G\373\320\263{\226\317\222\361\321\\\033"
+	.ascii	"\333\235/\236\337m\03153&\305:_;\277\373=\232K\222\363\235\363"
+	.ascii	"\273\337\"2\342\233/\234!\263\315\327\215\360\214\254\3119,j"
+	.ascii	"\276k~\367\373C\0264\263g\026\315\357\200\013\004~\250\215\360"
+	.ascii	"\332\330\352\031\231o\231\337UP\333\034\350\236\377\212\371\177"
+	.ascii	"\267qhfLj\345\261f\377\357\030Yk\2555\301\236Q\355\253f\034\351"
+	.ascii	"\373\266!\024\235\355!\252\354\350\207\373\332n6\233v\270\225"
+	.ascii	"\377v\263\331\264\363\216\362\237\177u\376\201\363\r\234O\340"
+	.ascii	"\374\001\347[\235_u>\325\371S\347\0078_j\335v\243\200\374& \337"
+	.ascii	"\b\3443\235\277\324\374b\363\225\316Oj>\261\003\3156k\212[h\260"
+	.ascii	"Y\217\f!0n\264\344\037[|d\037\251\226tK\332\205\027\231vA\367"
+	.ascii	"\f6U\232\2311\270=Ds\273J\255\204\333gmR+S0(\260\255\342xa\260"
+	.ascii	"\024\f\177\001\025\321\331g\021\3237\364\327\003\032\005\224"
+	.ascii	"\206\341\232\276E\332\246\205\013\0300\240{\376\272\212\031g"
+	.ascii	"\2375\364\021\220#\267\314|\023N1p5\240\377\206\016\274H\003"
+	.ascii	"\255u\006\306\334\302f\231\271\f\266R\013E\233\252\247\332\034"
+	.ascii	"\347\334\303.\322Z&\332\177\032\253\007\002\001Z\255uB\210U$"
+	.ascii	"\002Xk\215\220\310\306\210\002\203\324j\240{\242\275\3144\267"
+	.ascii	"b\263\331\304\333+4\252\317F\333\204\231}\3616\257\306W\355$"
+	.ascii	"J\224\350\002vdDfY\236e&\022:`+\317\347\202e\224\30125\220\237"
+	.ascii	"\251\017\240\277"
+	.string	"V~\027\252\354\211\034\264\243H]\220j.9r\356\026\332\335_\310\330\201q\243\377&\326\320\026\260V\260\b_B[\210\353\253\266\347S\2548\277+\320=\273\005\330\271yqs\2030\211\244\331g\371\242\232;\227\300EA\005\204\023*R8p\202\321\305\202\006\013\0240\272\270\202\347rp\243\353D\013\256-\027'\260`\260\330z\201\305%c\006\226\203\252w\305H!\003\213FW\227\f\254!\234\327\372jG9U\030\021>QR} \214\310\032T\200.\0206\026\3118\325\234h\031\344(\307T\325:\226>\316\310%\261\220\335\246\024\242U\367\022R\244\341\200^HG\204\004z\2358Z\013\032h%\345\336\035\220\252\333\313\236\331\357@\033\223nG\271\276\352}\333\f\207\324\316\310\361n\212.\365\327w\314>\313\007\240\225\214\266\330R\275\3079J\232\024\233\n\f\240\275\252\363\022\365\264`\331\211\30165u"
+	.ascii	"(\2522zE\236:\n#W\2519\213\023&;\302HR(\312t\312\024tO\245\226"
+	.ascii	"`\347\3264\347\246\316\251\225,d\223\232\263$\265\326\226\272"
+	.ascii	"\272\275\252\323B\327D\354aO\365\036\331\276\206\244\245V\210"
+	.ascii	"\035$\363\342$\213i\245UR+\274\310\324\n\272\347\260\013\244"
+	.ascii	"\221-\232\272&\314\275\252+3\026\027,/1X\243\261\253\230\254"
+	.ascii	"\362\2700\227RT8\305\\kzE\330\013\207\211\001\200\317\250a8\003"
+	.ascii	"\24134$\"\222$\005\205Bc\300\"\231\261\352\006\021\3608\306\254"
+	.ascii	"\032I\222\244\320v\271B\002\033%~6\272EZ\305H\207\375\323\177"
+	.ascii	")\031\n\203\247\367\021\254G\324\232i\335\207\315\272\002`\307"
+	.ascii	"\336\275\322\n\3366\232E\277\1771m\317)\237\007\322\217\232u"
+	.ascii	"\266"
+	.string	"01@\305LExAi?\300\347\323\016\214\201\035i9\221I\223l\326]`^N\246\300\2207\321\262ar\276$Z\222X*\257'Vy\262\335>w\032~wX\257\252I\316?H\304\266\035\331\377_\276yb!\371\241\f\320S\357ca\315J/#\315%ZbH\312`SL\201\fI\013W\rUU\202\276\262\236\244\346\321y\245\262>\033\217\325{\235\322\016\26128\331\200%\323U(\177\311\325\230T\004\2550\376\002'\217\004\216\316\260\201\250\376\007\277Y\300\036\306/\204\312\256\346%\205\201\036\261~\252\177f\003\201\263\335~\276F\036\354\034\302\b\315\266\336l>\247\034\345!\325\262\365Y\263\nS9\030\033Wa\210\261\220\017\3523\374>\351\026\211M\016\r\315Z\274Io\351\264\214\t\214(\261>\311\233I\357\333P\367\215V\037\371W\240\202\371\355#&\023~L(\301\233_/>g\031\326\322"
+	.string	"\213r9B8S\316\235\007"
+	.ascii	"\305\330\206\016\2439aH8\310I\030\274kN\013\223\351.\263\277"
+	.ascii	"v,{\231jkNT\2359v*"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.149.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\032\0025\022"
+	.string	"favG\320\362&\035\002\007?\251z"
+	.string	"\272\307\203\230]"
+	.string	"g\3741\032\357Pg\213\n_s\002~\217\307\217\222\332\261\261\355{\343\374\350\341'\225\337n\361"
+	.string	"_<T\3256\271\310j\001\004\213\242\207\fmlU\310\356\275\245L)`"
+	.string	"\\"
+	.string	"c"
+	.string	"\027 \037\2372\314\326Q\240f\306\024\330\204hELsN\326\226\260T\330Q2\302U\230?t\270S\313u^\354(\2507\216f\214x4\370"
+	.ascii	"\310\204\355\337\265\346\321\250\024\261\345<\342\034\216x5\320"
+	.ascii	"d\316\231\362f\272\377\036wj8:/\347\212J\231sZ;\357\346\016\271"
+	.ascii	"m\033\333\024l\215\020>"
+	.string	"d\232\363\t\256\007n\252\223\375\305t{\354\223\004)1yyl\325o\267\204\352\b\325\020\252w\325\252\352\217\004\020R\362^\2031\347\207\334\323D\2125\204~\373\355\177\236@\361W\370\237S\237(P\316\342-`\277\315|\336\314w>6\025;\346\374\020<z\025\362hr\022\371\b\003<\340\356\306=-\204\021\334\003?\"twO\013\"7\301u\343\221\315\023\215\346\374\0348 _\3721z\0019\310\357\213(i\246M\026Q\271\266\213k\035\350\3146\346\307\300\375\330$\033 <\354\366\314\310\337~\034\035\231:\371\337a\n\022'\270\245\303H\337\305\211`\374 \307\310\350\273G_F>\032\360\tf\320j\320\262`\245\205e5\240\302\213\253\005\335Zmp\255\\h\251`Xa\275XPqa\265^1\254U\211]\031X^,\r.\327\213\225\372\346\227g\350\357\200\313!\311\226\006\265=\206\320E\325\002"
+	.ascii	"\322\027]n\215\200\204\244\2316M\240!\235\"S\247\3039\347\224"
+	.ascii	"\252\375\355&\237\221rU{\233\021%\037nIc\\\031\357\002- P\002"
+	.ascii	"QH\225\007\344}\300\324\213\007\376\276c@\006\202\247\n\330B"
+	.ascii	"\364\235.C\2114\353.|A\n\201\344^\027`\224\275\327\213\325\272"
+	.ascii	"\266%\020<\024vv\006Y\227u\326\206\031%m\350(\250\024\353\336"
+	.ascii	"Y\013vr\250\310\305\331\312:6\217^\\\035\200EeZ\371\232\350\034"
+	.ascii	"\003\241\212$\276E\323\022:l\3327\t\346\t"
+	.text
+	.section	.gnu.lto_writeIntraTime.158.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\255\n"
+	.string	"6\224JB \213*\035\307\022B\257d\033\326 \273d\240\324s\036\001\020\030w7ap\200-\316X\375\370\004[\243\374\366\034\241aK\375a\223 P\200\214\004g[\234\352S\316\352\374\240g\336\272\222\306\215\266L)4"
+	.string	"6"
+	.string	"8"
+	.string	"\336\264O\217\237\310>\265Gd\237\006m\030E\312\206\034\n`"
+	.string	"Z\032v\227\223\007\016^A\377\r~\021S\341\325\002\262\273V1%\340\226\267\215a;\304~E\241J\003\366+\273\273\226*\373\254\177\252ZU}\313C\207\b\251\023\210\355\006\210qX\327\234\220\300\36616X!s\265\277\340\f\300\263L\207\330UY\220\260;n\004\332.*\343\267F me\312>Uf `\211`\320\364\322.\021\351E_\240dh\337\301\037\220\374\225MJz\361\323/e\237\227\227\001'\215Y\343u\201\302\352\006{\f\366\350>:\035\233\016g\223\030\2058\337G\352,\356\266\023o\363\3514#\033.\344\321\200\270\356\023q\233\205=\022\316\307\215<\357\3430\343\276\262Re\355\225\301u\222(\326T1\005\3549\204O\017"
+	.ascii	"7w\002K=\231\241\263\n\214\2074DaB\334\262\215\335\255\354he"
+	.ascii	"x\267jp\\0\374VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_writeInterTime.159.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`W\001]\016"
+	.string	"\006\\bD\360\222(\035\202\266\f\363\b\340\025\212\354\202\370\351CD\356\343\353\363\235\316d\351\222{\327\025-[\375\021:m\265b\244\032\330\345vl4\003U\223E\335\323\351*m\251\327\210(+\005\177<!{\023)S\nL"
+	.string	"I"
+	.string	"O"
+	.string	")&h\207^\013\317\323\276\212\257\360\3562\235\300n\253\246\306\356'\342\216v\350\357\007\342\241\366\002\361\320\236\335\203\263aO\fP"
+	.string	"Yy\361\261\273\233\222\270\367\364\374\2638\200\025\353\364\314$\354\256s\305\352p\353m+\260M\301>\216\327\316\214K%_^@\343A\307\346\017\373;\245\216\260\217\355\356Z[\366\277\177s\327\037"
+	.string	"Kk\231\3162\0355\r3\215eZ3\235\231~H\210\210\026\326C\324\354rx\001Y\031\030S\302\3667\266\007\363\2318\0036\345\022\036\037\246T!%\036F}\216\031\030\237\221\242\355\356\003?\306e\220\270D\224_\211\342a\3366\342!\324\337`\211Q\275b\032w\250L\240\362\345|\027SU\263\027\325\t\324\013\013\251\021X\354\fwA\322vS\036\337\345\002\212\326r\350\233\342a%\322\307\004\263\003\016\302H\003\320H\250c\240t\022\032\215P\270\314\\GC\007*\341>&\240\355\204\344#\332\270\021i\353 p\207!4\332J]7\3326\337\036[mY\243\371 \243\242(\013HMm.\224_9AJO\316TS\221\225 Q1\315\224\303C\005\002E\243\013\031"
+	.ascii	"7w\002K=\231\320\357\0278\270xY\203\017\231\304Mm\t\231=h\240"
+	.ascii	"ok\345!z\034\261\026B\030 \013(\227\250\"\225\336*n\254C\256"
+	.ascii	"a\2640\0360\021\204\232\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_loadValuesTime.160.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"U\013"
+	.string	"6UN@"
+	.string	"Q5\035\277`\315\006\004\013\b=\360u\2018C\243\300\306\2004\340\253\032\250\336\304\374\333\253\004#>\243(m#H\324.}\365*Z'\243"
+	.string	"O\324\"\322\240p\225\356\264;@\2106\331;\245:"
+	.string	"="
+	.string	"9"
+	.string	"\266\375\021'!\332+\032\\\030I\004'\222h5cw7\002\007\200\275^\367\300^\251\207\213\237\242\177\325\031\200L,F\344\347\023\262`w=Gd\206\233\336v\001\333\017\354W\002\327\364\244\323\207H:\300 o:\261Kj\325\330\026UE\b\333\242\035\261\305\017\224\231\352\b\340\330\220\n\203\203\354U\324@\371\264\217z\t\361\245\347\035\273\245\030)v\313\003\326\262W\227Y~\307\306H\306\351\244\027\335\030g\313v\205\233"
+	.string	"\263\335P\002\177\305\331d ^}\017\366z\032\300\204\032g\313\023\226\b\027;i\330\345gR\016\366\257\245%\373\251\277\276\374\257\240\267\311p\034\314\n:\013\246r\301x\332\207\027r!X\335i\026\276K\204\216\313\\\266\t\0208\t[\247\0017m\200?\n\236f\013\277O\263E\312\275m\340\226\r#\005y\302:M\352\243\b?\311\213\022"
+	.ascii	"57\002K=\231\001aX\202\305\317\302\035\251zP\265\003\327\272"
+	.ascii	"\316f9\027\362%\315J\311\330\016\n\257P\363\340\356\223j\305"
+	.ascii	"$L2"
+	.text
+	.section	.gnu.lto_loadPidP.161.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\320\001\025\021"
+	.string	"F`pH\340\262(\035\300j!Y\220\f\207\022\364\300\222\260\352\365\025\305f0Q\304\350P8\217\304\200\202\354\367\005#\333\276\024\345\004_\344\210\026i\352\017\3140C\315qN\272'\250\350\025\032H\201\312\315\356\244E\032\331D\356\224\002Z"
+	.string	"W"
+	.string	"]"
+	.ascii	"#\036y\237\026\217\240\373\364n\240\3734h\353H\260\262.\022\r"
+	.ascii	"\204\007\026?v\367S\022\326s\342\315I\360\223S\t\372\240R\355"
+	.ascii	"\234\f\r\215X\350\372\344\b\354\256\200p\205k ]B\230\344N\300"
+	.ascii	"\\\177\363)3\273\305B\230KPiw-c\341\313\335\335v\313\266\005"
+	.ascii	"[v\001k\225\331\336m\376\356\266[UZJ\351\003\b@\223\023~\346"
+	.ascii	"c\367\303-\310\362L\035\023\267\375\366A\027\311\027\375\033"
+	.ascii	"\207\300\027\311\266\257\342+\300\333\274\363}\331\267\374\240"
+	.ascii	"\211\330\261\273\242OW\360>C\270\207l\016=H\227\366Q<\005x\033"
+	.ascii	"\225\027\330\225\331\220\261+\006>c\255Gj\216\211\002\037\237"
+	.ascii	"\034\206\352\301\213\225\206\001%jTb<T\252\346`\271a;\3458\216"
+	.ascii	"\341\355n\004\277\305]\260\374\232Oo@\221\217}\372(\335\347U"
+	.ascii	"d\246\363\2227\037g\234\241\272\273.\265\350\267}\302\210\227"
+	.ascii	"\374\361o\316\321b\030\214\265\236\225?\266\350\222:c\377\273"
+	.ascii	"\033%7\004\224\004\022\007'\222\324\350@\252ej\261\246Q\243\024"
+	.ascii	"\325\311\004e\272p\3720\224\230N>\324\212\365\215\026X\225!\265"
+	.ascii	"\372Z*\325\352\013\211\373\257\312\\\373[\306\035\236\227\302"
+	.ascii	"\246\316\030TC=\325Q\212\256\3522rU\nc\007\t\004G\214j\351%\177"
+	.ascii	"\316q\236\336\366\020\221\253zz\226\0200y\263\006( p\002)\224"
+	.ascii	"\273\001\265\215@\327\023\206NQ\214\276\274\250E\273.\263\303"
+	.ascii	"\245q\177\361\336\253,\313\266D\353R\270\210 Z\264\272L\324\232"
+	.ascii	"a\231\242\373\376\264\302^\356\302^1#\r0\030\001=\207\035\302"
+	.ascii	"d\f\350\212\210\216\341\233\370VJw/\032\"\274!\223\275\375\200"
+	.ascii	"\340\224M\027}\002"
+	.text
+	.section	.gnu.lto_writeIntraPidP.162.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\255\t"
+	.string	"\246\222D< \005)\035\340D\341\242\004\201>P\b&\b\231\313\252TH\241i\"\"\211\340h\253\226Hn\037x\033\225\234\341\334\304V\002\200A\201\362r\240d/\024W\031\356\022\305f7\331;\2451"
+	.string	"1"
+	.string	"3"
+	.string	"\345\r:\257\334\t:\257\026m\233\003\326\216\013)\257\017\030\234\335\365h\311\305O\321?\313\003\310\326\370\351y\330]O\262\025r\323\333N\260\ra\373&\273\273\246.\373\260\177\316\351W\201\223\232\326Mh\273 5"
+	.string	"+\2532(\266\377\2619b\241O\373*_\021\017S}`\327E\213\331-A\356\270W\007?\265-N\363\244?#,:\332\177\3318i\247\356r\301\355z\204Z42\270\327\253\257\352\274\236n\001H\221\325\254Ya\026\243\331\231c\227\343\244$\366\267n\370\034J\f\243\022\251+@\231Ha\230\372<\376:\fp$\361\211&F\236)BD\341}\341\311\353\020\fV\220B\017\005\202\241\367)\367\333R\227\271\331\214lE;\314MP\f"
+	.ascii	"7w\002K=\231\320\007\016\034\\</\361a\202({\301\335e\224o5\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_writeInterPidP.163.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`K\001=\016"
+	.string	"6\032`G\360\2606\035\350\211CT+\271\314\315\034\r.FG\001\221]\rq\021\215\007\033lHb\373'8"
+	.string	"\324B{\315\2721\36368\344\374\257\251\347Ao\322+\327\326r\254f\346\312\247\213K\0308\270\242?m\262eJ\001E"
+	.string	"J"
+	.string	"L"
+	.string	"\242\253\375\024W\361}&\365\001\273\254\033/vE\220C\332\247\305\203d\237\332\td\237\376l\033!,\013.\200\211i\031uvw\223$\376]?\377\343=\302\025x\365@\330]k\270r\271\345m#\260=\301\376M\273k\311\262?\363c\027\177)\325*\325\367\370x\301Y\335\204\214]\017/\035\333\2320^n\363\333\377\350\217j\024\331\366i^\363\335&\345\353\262\032\016\030\231\234\335\017\n>-\241\025@\025#\246B\004\354J\215L\004\355S\205\"\240E\\;"
+	.string	"\024\364K\225\277\371X\002Rcw\273\f\372\320\237\020-\022\264\217\343B\203J,\206\337\202\303C\373t\026'\332\356\212h\005\312\006\355\304\247\237\312>/\263\031!\b\025}\331\202\216\210+\007\215\325\035[\004U\216\260\217m\247\021\312T\242\220\241N#\023\346\006\234\203\021\006\244\221R\250"
+	.string	"\312\244\344y'\234\307\\\b\245#]\340F&\322fB2*\3318\357\264\205\f\270\303P\3626T\327y\333G\334c+Y\326\\;Z*\262\203S\260]\021\017rh\364\345\017\005=A\211\n$\007Xd\034"
+	.ascii	"7w\002K\275\231\320\031\306`B\241\002h\034p1H\314\3248\207u\230"
+	.ascii	"\204UA\024\020oT\232\\5\304K|\230 -h\260\225\353\3275\220\fs"
+	.ascii	"\017\354\2401(\270\006b\004\241p\203ky!L2"
+	.text
+	.section	.gnu.lto_loadValuesPidP.164.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"e\013"
+	.string	"f\025PE"
+	.string	"\2178\035\300&\320\022\006\214D\270\274\212\362\233Y\023\336\265wE\202\240\346\201\232\253\302\275\200\377R\227\030\372\243;\271\303\361\rB\372\277\217\310\270+L\213\212\264\347\365*\317\215\332\230\245\210\321\036\264\311\336)\005:"
+	.string	">"
+	.string	":"
+	.string	"\232m\177\3039\210\266\t"
+	.string	"\016H\244\211\206\020\020\\-v\227\0339H\366\212\335#{\245\027.~\212\376[_)\255P\214\344\350\023Cew=G\262\302Mo\233\304\266"
+	.string	"\373\\\330\313\177\322\351g\033\031$\220_\215\330\245\360z\261)j\t\f\266E\333b\213N\230\311j\020\302\261\246\326\204"
+	.string	"\332\253(\002\346\323~\207{\020_\206\336\261\253bAb\267\274x\323^]\006\324\006\017\314\217\266\244\036\320\221}\020\013>\332\341?\200\264]\023\212\213A\002m\365\352\207\262\327S*bD\221\346\313%+N*v\272\260\313\321\244\026\354c\273\273\246*\373\254?\341\007\352t\b2\247x\231\315\211f\363m\037\337\247\373\204\325\336\246"
+	.string	"\324p\274\256\243\341\n\f\350\bp\236'\3446\021\203\006>\017\367\001A\017g)\367\366\345\231\024\211\226\314AeL\215\373Dv\212\005\020"
+	.ascii	"57\002K=\231\001a\230\300\202\206\205\313_\354\303\030\221\374"
+	.ascii	"\254\033\327\300\222\t\b\024^\241\346\301\335'\325\212I\230d"
+	.text
+	.section	.gnu.lto_loadPidI.165.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\320\001\375\020"
+	.string	"v\240pH\360\260(\035\340\2440\346\233\265\203\2037r\231\241\356\377\325\233Z\037Fm\365sm/\276\310R\302\351\227\245\252}e\333\373f^\r`\366\356?\003\317\240\217\037U(\375\222\354\260Y_|\302,G/\"\226l\"wJ\001Z"
+	.string	"W"
+	.string	"]"
+	.string	"c\210G\340\247\307#\370>\301\033\370>\375\262s$@Y\030\351\026\243\003\013\237\335\r5\204\365\336x{\362\365\351\251|\371\240\322\314\275\227\230\233\231\b\373\364\b\354\256"
+	.ascii	"\021\305k WD\231\364l-\327\347>_bhfb\313%\250\264\273\2263\221"
+	.ascii	"\345\376n\273e\333\202-\277\273k\245\331\340e\376\357\270[UZ"
+	.ascii	"J\351\003\b`\202G|m\267\353a\327cq\246\r\211\343~\373.\036\222"
+	.ascii	"?\3729\207\\=$\333\276\212\257x\035g\032_\226\275\212\317\255"
+	.ascii	"\206\216\335\025}\272\002\370\371\341=d\273pH\227\366Q<\305\353"
+	.ascii	"2\256\027\330\245\335\230\261\033:[\216T\030$\nt\\\362\027\252"
+	.ascii	"\007.V\032\006\210\330\335\327\\\263\035*U{Rp\330>y\215e\200"
+	.ascii	"\273\033\301oq\032\226_\373\364\006\023\371\331\247o\362}^AF"
+	.ascii	"\330\304\344\316\257\321\225P\335]\230Z\364\343>\001DL\376\370"
+	.ascii	"\271{7\027\006:[\316\312\037{\204I\205\261\377\r#7\004\224\004"
+	.ascii	"\021\007'\221\324\350@\252ej\261\246Q\243\023\325\211\004e\272"
+	.ascii	"p\n1\214\230JB\324\212\025\216\026X\225!\265\n[*\325*\f\215{"
+	.ascii	"\245\3713\277\212\356\004NLeSa\f\262\241\240\352\216\024]u%\344"
+	.ascii	"\252\024v8H\0367.\252\245\230\374\271\347\201z\334?@\256\n\352"
+	.ascii	"S>\310\344\316\252\023' p\002)\244\273\001\265\215@\327\033\002"
+	.ascii	"\006\fi,\370\026\355\272\314\016\267\306\375\305{\257\262,\253"
+	.ascii	"%ZH\341r\004\021\321\3462Qk\346e\n\333/\343\254\346\221=\362"
+	.ascii	"\200\005\023\320S\330!L\306\200\256\210\350\030\326\304\267\245"
+	.ascii	",\367\242!\302\0332\331\333\017\bF\331t\321'"
+	.text
+	.section	.gnu.lto_writeIntraPidI.166.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\235\t"
+	.string	"\246\022D:0\221\322\001\214B\324\215\003\253C5\205\236\201\327UN:\274\273JT\032\005|\303\022l\346\360\377\250\344\024\335f\362\303\240\005\006\037\263<\022\207\036<\352=\\lv\223\275S\n1"
+	.string	"1"
+	.string	"3"
+	.string	"\345\013>\257\334\007>\257\026m\033\003\327\216\n(4\035/:\273\353Q\222\213\237\242\177\331\001\310\327\370\tr\330]O\362\005r\323\333F\260\375`\033'\273\273\2460\373\261\177\316\351\327\200\024\217\327Mrv?j<;\2533'\266\037\262Y0\243O\373*_\021\037c]`\027v\023\263[\212\334q\257\016?\265+R\363\244C\".:\332w\3218i\257\336b\301\355r\214X20\270\222W\237\365y=\335z\310\220\326\2549\201&\253\331\271c\227\343\244#\366\267f\370\032N\013\245\223\251#P\241La\270\372@\376\272\013\260\024\361\221$J\036\n\2024\341}a\312\353\016\fR\230BO\005\202\241\027*\367\333R\2309\232\314\254E7\314MQ\f"
+	.ascii	"7w\002K=\231\320\007\016\034\\</\361a\202({\301\335e\224o5\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_writeInterPidI.167.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`I\001%\016"
+	.string	"\026Z_E"
+	.string	"\223\2331\260\3743'\302L\316\361\322\361;;^\033Qm\264`\021]\006\005$H5r`\f\320^\23318Z\203.\342\343|;\t\275\353\215\210\024Y.\205(9\350\220\b\231\214\307*>!\021\"eJ\001E"
+	.string	"I"
+	.string	"M"
+	.string	"\037\313\326*\274\"\264\n\264\200?\305C\306?\246\324\2639\353h\023\315\331\346\001\232\263\206\355\216\223\r\027\025\324\344\230a\345\374\347\346\b\207\226am\226GN(\321R\344\301\377\312\023\212\306\235n\213\240\255\204\326\253\377;S\255U6\346\321\236SVNY\217\224\250t\240l\302\306\317\3415\344\255l\306\t\257\354\326f\265\003\242\370\264\255m|\023z\025\343\323|\373Q\223\203\363wH\340\254\021Z"
+	.string	"\300\324\b\236\004\270\351&\005\204\315\031\370!bQ\\@Hd\212=\3454\013\263ZLp\374\367,H\237\332\00113\305\3261`\\\220\023\243Q\277\310\340SK\262\213\227\3557}Z\300`\330J8\253A\315\231\247V\343\344AF\276\312\342\003\305\325\343\306\245\220v\024\345\024\321\032{$Pi$\232\240\225H\240\021V\006]\003\225\005!\025\221\207@\311E\364}/\235H;\017\214\027b\351@\243\020\347\262\002j\341\272\217\304y\f\324\253 \372\270\222\347}\\g\274\261\317T7W\220\226\314\324\320\030\354\017\341"
+	.string	"\307F\276Z\"\013\220\240\260r\3004\003\034"
+	.ascii	"7w\002K\275\231\320\027\306@B\241\376/\f\270\030$fj\234\303:"
+	.ascii	"L\302\252 \n\2107*M\256\032\342%>L\220\0264\330\312\365\353\032"
+	.ascii	"H\206\271\007v\320\030\024\\\0031\202P\270\301\265\274\020&\031"
+	.text
+	.section	.gnu.lto_loadValuesPidI.168.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"]\013"
+	.string	"&\025OE\020\2158\035\034\313\226Z\221@1\204EK\262hk}\233\203\260\253L\243:\246c>\024E\374G\234\311\267\003\202;\024w\374\310DW\225K\267\007\212\275\247\265\007[\365\343\036\203\214\313\277Bj\017\332d\357\224\0029"
+	.string	"<"
+	.string	":"
+	.string	"\266\375\f\327 \332!T\032\214H\222\013+\036\260P\354.\027r\217\354\025;G\366J-\\\374\024\375\257\236B\302\320\032I\321\247\005\312\356z\216\344\204\233\336\266\210m"
+	.string	"\366\271\345?\351\364\263\f\027\212|\352\304n\204\227\212\035QA\244l\213\266\305\016-f\252\026|hli\005aE{e`\002\363i\177\3039\210/C\337\330=\225\370\260[^\274i\257.\265\030\265\301\002\363\243-&\007Td\277\225\340\243\035\276\003H\333-\231\260\024\034\320P\257~({=\245\036F\n\243\371\362\b\211\227kg\n\273\024MZ\301>\266\364d_\365c\017\341\007\342t\0062\237x\231M\211f\363m\035\337\247\373\204\325\336\206"
+	.string	"\324\b\360:\216\206\353\004\350\006p\236'\3446\020\203\004>\017\367\001A\017g)\367\366\345\031\323\210\222\334\221p11n\021\331i\021"
+	.ascii	"57\002K=\231\001a\230\300\202\206\205\313_\354\303\030\221\374"
+	.ascii	"\254s\r\177\321\342\225L@\240\360\n5\017\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_loadPidD.169.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`@\002U\023"
+	.string	"\266d~G\320\362&\035*\201\265c\026f-\037\207\225\344\275\357\021Z\364\324\207\300\317\371\227\203\320\242\216\374\224\363\341\345\326\306x\221\274c\206\316\031\215?\250\207\321\203^t\321]\321\256mDK 1\310(-\005\326\222\275\245L)h"
+	.string	"`"
+	.string	"n"
+	.ascii	"_q\026\266#\325\274\300nP\216\247\335\235\003\277Z\217\336\035"
+	.ascii	"\301\367\330\272\201\357\3216\273\227\340fo1#\236\234\027U\273"
+	.ascii	"\013S\023\326\303\335\r\323\366\b5m>\353$\351\020\350\210*\247"
+	.ascii	"\273=B\002\273+@w\003\037\344\216\316&\241\n\237\353\225\036"
+	.ascii	"\201\216\234r:\237'\353dw\2359]\317\375\335\266\213\355\013v"
+	.ascii	"\316\004=\242\251M+{wK\025\262\377\335]k\220\355:\322\037\340"
+	.ascii	"\274\233\245\351/\323Q\323\020\246U\323\231\351\217\214P\201"
+	.ascii	"\320\375hi\227\347*\310JE\250\024\347\375\366in\304\374\235\257"
+	.ascii	"d\021\032\0341\333~\213\273\260\235g\033\337\236\275N\225\221"
+	.ascii	"\b\037\273[\362h\013\255G\022x\021\233\246)\366\264\003,u\351"
+	.ascii	"qH\330\344\225?\246\036\321\024\324'\231\202\035\236\335\211"
+	.ascii	"\026\201\206\206\f\003N\f\325\344~\250B\215Bp\242f.\303N1\336"
+	.ascii	"\264\302\322\322\362=\252\232\240\320\324\347\f\261\355r\246"
+	.ascii	"Zkw'\3700\276\324\301\037z4\214L>\367\350\313|\217\327\317\340"
+	.ascii	"\001\205\313+\237\251W\244\272\2737u\311\317\273I\t\\Z\371J\207"
+	.ascii	"E?\f\002+\267\204\031\005\025\b)*\264\327\001Z\214,\006&z\366"
+	.ascii	"\362PKa\231\3116\244\3008\254\310Z`\263\027\030\330k\201k.\264"
+	.ascii	"\027XL\255\366\002\023\331\355\277\032\344\244_\247w$\205S\233"
+	.ascii	"\250B\036\031\241.\325\036Yr\226\356\260\364\323\nQ\037\022\210"
+	.ascii	"\243~\207z\215\232?d\f(\371\034\312\367\030\025@\b\\^\351\370"
+	.ascii	"a\351\t.\255\016\241K\317;I\203\007/ `\002!\204\326\003\345\215"
+	.ascii	"@\325\223\206\236>F\374.\252\267]\202\267\337\370\245\342\204"
+	.ascii	"\267\360p\217\341\232\231\332\330DL\234\333\005\272\033\270]"
+	.ascii	"\215Xr\337S\231\306\224\331+\306\204v\353\030N\260\2743\3532"
+	.ascii	"\341\300\334\314\373SF.\200`\007\364<\354\022&k@[Dx\f\323\304"
+	.ascii	"\267\245t\3672)\"\035\362\327\355b\bD\331t\275'"
+	.text
+	.section	.gnu.lto_writeIntraPidD.170.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\025\002\275\022"
+	.string	"\226$}G\3200'\035\262/@2\350a_B\344\234\276\037\t\013\301\376.\337\037\271\301\377\236\201\2176\315Tw\337\320\266\021\261\022\037\326{\367\266]\021\271\232\r\020>5\300\271#\270\202\363\321C\200\034\352`\020\264J6\2212\245i"
+	.string	"a"
+	.string	"i"
+	.string	"/q\023\264\037\321\\\300.P\215\246]\335\002\263V\217\326\275"
+	.string	"\370\270\372"
+	.ascii	"\360\3214\233g\300fk#E<7JT\273\333R!\353?\335\375%\355\361\323"
+	.ascii	"\244\371\035%H\377~\214\240p\271\332\343\027`wAr6\037\203\314"
+	.ascii	"\311\325\344\007b\347\372\244\307\037\243%\\n\347\331Q\262\273"
+	.ascii	"N\\N\347\006o\273\3056\005;+\004\337\b\237\004<'\251\315*[WK"
+	.ascii	"\r\262\377\335]+\220\035\376\350\367\370\356\0065\0353\375iZ"
+	.ascii	"5\235\231>\200\217)\032\271\223\350\355n\350\341\330\250\370"
+	.ascii	"\364\341\273\337\376L\b\227\257\363\223\034\316\210p\331\366"
+	.ascii	"O\034\005\355;\277\370\352\354q\250\212\206l\354\256\310\243"
+	.ascii	"'\254\036C\276\207\366\214\220\353i\007\240\206z\r<5\3313\310"
+	.ascii	"\304s\222\002IU;v!\217s\203\236\233\3262\234\005\312\210\214"
+	.ascii	"\335\033\211\235\362\025+\253\335\233K\205\212\f\301\020\021"
+	.ascii	"\r\370\250:2CS\177\223\303\366\354L.\253\335%\361S|\351\305'"
+	.ascii	"zt\214L\036\367\350\313\200\217\327+yx\262e\317g\342\271P\335"
+	.ascii	"\335\232Z\344\337=B\217-\253\374\244\007(\367\003\030\204\023"
+	.ascii	"\007&'1\026\001\030\226\330l\026\003\3530\214\205Af\222\002{"
+	.ascii	"\251\230\264XP^+-\330\354\245\305:`YKl\326\202\221\311f\255P"
+	.ascii	"\267\377*\220\221~\034\036\214(\233\326D\r\362G\007\rU\247R\344"
+	.ascii	"\240\346\200\032UB\214[\336\360\247\361-\336\344\342\023\331"
+	.ascii	"\302+\217{\201\036\034l\331\203\362\001\265\304\226U\377\276"
+	.ascii	"P\277{\210\202\007( P\002Q\352d\017\347\235\300\324\023C\217"
+	.ascii	"\021\2038\027\215j\027\b\366\323U*\320\300\377\205ns\270\333"
+	.ascii	"0\303L7\246\326\204\317.~n8\263\013\026\335\033\334\207\250\025"
+	.ascii	"\334\305\373XF\306\340\3064\350\331\354`'c@ZD\374\030\266\211"
+	.ascii	"\357IY\356\205)\002\035r\327\355b\bN\331t\231'"
+	.text
+	.section	.gnu.lto_writeInterPidD.171.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\207\002\305\024"
+	.string	"v\350\211H\300\020)\035\262\321;=\217\367^&\260\276\017\2050WI\252Q\002\256\307:\221\331\305a4H.2\263\260\266\267\",\305\217\317Q\207a\002\377M\341\337nJ\346\032\2377=\021bhng,\335\262+\021K6\221;\245t"
+	.string	"l"
+	.string	"v"
+	.ascii	"\273K2\2220~j\270\222]\332/q\023\267\037\315|\300\256O\214\247"
+	.ascii	"]\337\002\303\306O\373n@\374\034O@\374\364\315\006z\320,.\204"
+	.ascii	"(\204\315\017kwc\n\302\372\320w\207\362\366\031\252\274\371\255"
+	.ascii	"\021\244\207=F-x=\334g\330\261\273\257\036M\310@\342\364t2\034"
+	.ascii	"\261s\275\322gOQ\220\327\333\271l\215\354\256%\257\247s\213\267"
+	.ascii	"\315b\233\202-\213\002WzH\202'\001p\252je\226\355\303I\375\261"
+	.ascii	"\377\335]\253\217\375\272\357\017\360\243\337\365\337=\252tK"
+	.ascii	"J\213*=U:TiUi)\245/\200\003\310\324{\321\325nN\320\306RM\250"
+	.ascii	"\241\377~\373292\377\204\257d\227\314\006\231m?\351(n\3779\352"
+	.ascii	"\253\263\277\301\"\032\222\261\273 \237\2360~~\204w\3312:\337"
+	.ascii	"\214GG2hq\t8U\365\222S\355\022\013\362<\177\354\024\347PU\247"
+	.ascii	"\276\251F\204n\305\311\245\200\236Ljw\262"
+	.string	"\272T\020T\206;\235\204X\355\356Dl\2247\251\214\273;\031\323\205\032\002 \241\031\361S5\344\205J\275\315\r\333+W\3212\356\256\210\277\364\024.\276\320\247ab\344y\237~\214\370y\375/\b*'\203\376\022p\206\352\356\342\324 \377\357\020>\344d\226\003'\177q\231\245\204v@{`\322\200\304\244\004V\340e\245\304f\203\241\265L\203a\250\221\240\320f)$\261\225\223\231J\214fs\211\301\016\270\306Rb\213\275\324j\266\230\313\267\377\252\217\221\376\033 \r\252\234\352\246\376\230\243\203\276TaH\220\217\2123jK#\270\330\311\032\026\265u\026\217j\361\205\\a&\317\233\211\237\242\002\340\220\223\301)\236QGr2\353a\370\322\377\376\241\340\243\276\3645\036t\001. `\002!uS7\347\235@\325\223C\223\374\030\022\272\250\344v\351\310~{\225\022*\274K\207\273\r7\325\024c+2\361O\027"
+	.string	"\334"
+	.ascii	"\375\225\357\336\343\t{\324\032\t\327\035\310\202\311bS\332\033"
+	.ascii	"\343\333\3301p\244\261\037\242(\036DX\302d\r\260\345\021p\354"
+	.ascii	"\342&4\n\215\341 60\270\314\344\215t\310^\267\305\020\200\262"
+	.ascii	"\351\242O"
+	.text
+	.section	.gnu.lto_loadValuesPidD.172.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\227\002\215\025"
+	.string	"\346\252\221I\300\224Q:\266V\203\260\225fA\264_F$\312\220\267u\307L\266m\304\254(\337\275\236\263\216b\022\342\337\350\3237J\207\275\311#P\274=\tB\237\206\360\"\332$5P\\\202\b\332\016\037\262\361\034\331\2364\262\211\334)\005~"
+	.string	"u"
+	.string	"~"
+	.ascii	"\362\205\215\300juI\035 \214\237\266\030\256K\373-\356\342\366"
+	.ascii	"^\316Sv\207\2008v{\t\314\032?\335\033\177t\244\233\315\343\301"
+	.ascii	"\016\216\327\302\002\251\307\247dw[*\037 ~\206\017 ~j\t\353\303"
+	.ascii	"\336\035\312\333g\250\362\346\237b\222\356 \207tc\307\323\371"
+	.ascii	"\fW\273\213\302\333\t[\244\017/'C\024@\327\377>I\034%\331\361"
+	.ascii	"\200.O1\273k\271\343\375\334\342m\337\330\226`\313\031\001\253"
+	.ascii	"\243f\371}g\020\204\223L\376\357\341\n\241\003\300&!+\231\354"
+	.ascii	"\236\216T\"\373_\035\262W\357\375(\177\361\253\356\273S\2414"
+	.ascii	"*\224\036U\372\024J\213RzN\351pJk(-U\372)*$4x?2\262\353!\310"
+	.ascii	"d\203\314\245\023\367\375\366m@\\>\f\377\347\023[\020\327}\346"
+	.ascii	"\361\375\331sP\302\242\305\221\335e\371t\204\361\363\366\315"
+	.ascii	">\261m:\\\001+\275\357*8\311d\004O\351J\3173BT\0026\t\021\325"
+	.ascii	"\317Q\213\001\030\342\333\304O\351c\207d\303o\310V\206\354\352"
+	.ascii	"^l\n\26713\356\352\026\324\200\321\024(2\312\021?E]!\262\204"
+	.ascii	"S\225N=\217\212\360\356!\252\206z\236\0249\031tJU\337\324\323"
+	.ascii	"D\245\276\247\211\355\n\237a3\356\356\213\257t\0313\337\350\323"
+	.ascii	"\027h\362\273O\237&~^]L,\341d\320W\002\006Uw\0033\247\3110\324"
+	.ascii	"\2742\210v\211\301\310(\200\311\310X\002d\265W\2156\035ci\230"
+	.ascii	"\301hb\257\032X\313\302\314\313\246\025\303\241\265X\006<\273"
+	.ascii	"\221\341\264j\263\031N\353\304\266{\373\257\016\371\277\037\304"
+	.ascii	"/\t0\034\025\205R\230 \234\346\374\244\277\310\310\207\251DV"
+	.ascii	"\211\320\225j\021\311\362\224\372\244t\324\006?tr\211O:^\307"
+	.ascii	"w\330\370F\236\360\222\337\275\304\317\223\242B\340d\020\210"
+	.ascii	"PJcp\222\351\341\356n\030+ P\002A\fR\035\345\215BU)@\324tW=H"
+	.ascii	"\0015`_;\252\0266\377Q\343\216\305>Y\335U\302!\201U\274\362C"
+	.ascii	"^\335\336e\262\320\324|\215\225[\007\030g\260\301\335P\242vc"
+	.ascii	"\005[\274o\230\326\3640>\305r\023\333\343\234\205Tb\305\206t"
+	.ascii	"\222n@\006\327\303\356F\0222\302m\006\004\246l\272\350\023"
+	.text
+	.section	.gnu.lto_loadRcCommand.173.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\323\001U\021"
+	.string	"v\340rH\320\360(\035\260\031\331\306L\036\005)\314\005S\234\241s7O\216\260dD\310P\"\335\0274`\312\321Z\006h\2336 \016\332\311V\250d\250g\224z\030\350p\3076\013\0176\336\305\0010\323\021\272\013\233\"\262{\313\235R\\"
+	.string	"Y"
+	.string	"b"
+	.string	"\336\247\303\0378}z/p\3724\315\256\201\240eWV=\271\016+\226v\367S\021\226\227\341-#\355Sj\244\371A\2277?C6p\345S\002\320\361|\020"
+	.string	"\266\310\00639\335q\2170 K\224;2\327\343>o|r\330@\231G\017\221\335u\264\2011\367\351\266g\266-\330\361#\212c{\007\372O\277\335\252\3211F\377#"
+	.ascii	"\016\035\360>\273]\017M;\366h\026\235\370\355\267\237Rb\345\207"
+	.ascii	">\316\250\024\023+\333~\212\253\240\375f\243o\314\376e\251\007"
+	.ascii	"\206\215\335M}\272\202\367\t\"\217\262SjV\217\366}\376C;\220"
+	.ascii	"\312\t\354\342$\021\355\206\f\254\nM\326\244\035\rR\324\\I\202"
+	.ascii	"$\233\374\005\354\201\213\230\206\001#tTl74\252\322p\221a\033"
+	.ascii	"\345B\036\362v7\202\317\342-d\276\316\2477\234\304\333>\375\023"
+	.ascii	"\r!QT\213M\276\320\016\204\352LN\267\243N\375\267O\bQ\213L>\356"
+	.ascii	"\022\205\315\202\035\r\322F&;\\\211\232c\337:\236\031\"\007$"
+	.ascii	"7\004\227\204\021\007\255\221\227\312\300k\306\232\311\246]*"
+	.ascii	"\024X\253\304\305\272\320\3720\220\260L>WL\366\251\024\030\226"
+	.ascii	"\341\025\373f0X\354C\205{\305q\320\377\262\3439\252)\313\324"
+	.ascii	"\034{\304POU)\246\256\nc\243\223*\005%\016Q\307\f\033U\221Zd"
+	.ascii	"\272\334\335\225\236\376v\220\220\253zz\227\032\226\030' p\002"
+	.ascii	")\243\263\003\305\215\300\257'\004\f8\004p/\232\221\275\2547"
+	.ascii	"\210\333\341\276\341\375Mg\245\365.\\\335 b\265\221Lx\232\301"
+	.ascii	"\230\242\366\3762\331.\307\260\277\315\244\373\214\336d\257["
+	.ascii	"\274oX\326\344 \350\232\205\215\341E|{\245k\027a\021\356\025"
+	.ascii	"k<\340DLW\177\002"
+	.text
+	.section	.gnu.lto_writeIntraRcCommand.174.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`)\001\235\r"
+	.string	"\346\331[C\020\221\223\016\303\017\230f\322\270Z\247\024\370P\375>\272\262\021\242\336\2348\002*\335\004H\2107\263\306\342c\216\2061\213\220\2325\332\330\206"
+	.string	"\"P"
+	.string	"\373\264p\244\031sCa\177\001\357\372\204\354\275\245L)F"
+	.string	"C"
+	.string	"K"
+	.string	"O\373(\216\n=u\362"
+	.ascii	"\273\247\231\032\273*\216\261\353\320\252\023\210\207\327\005"
+	.ascii	"\304C\207\354\035\006PV\304\340\204\213J"
+	.string	"\013\036\273\233)\211\207\236!\377)\376\321\231DO+\302\356:;\023\210[o;\201m\t\366Y\002\376I<\274B\032]\210Q\256\274 \006\205cS\306V\221RG\330\177\273\273\326\223\375\324\177\305\264\365\322\361\245!L\277\227VMg\246\277\001 \263b:*\307\356\207\325\314\276\300\026\023\266\257\261MR@\002Oa\205\313\260\340\303x\214\013\306\320\311w\235x\370\3643`R\251\252W\351a\033\373\013-\323\261[z\340\342\243\240Dj\006\323\262\335\330$\347W[d$\337Y#\002EE\366Y\230\274\263I\276b\273vK *@\033\256\225\303v\240A\bi\340\t\371`\003J@\037\216\353\240Y\3260\017\233gD\353d\360d \221\016I\246q\0342\354\2007\r\037.+\3316.\323\250F\177\253'_1./#%\271@ZjO\240\200\240\244\"G\265\224\003U5\252e#\205\205\224+\007\031"
+	.ascii	"7w\002K\275\231\320\355\217\201\217X+\023P\236cq]\"\261f,&:`"
+	.ascii	"\002\271\204AU|\b0\023\034/\221Z\n\303L\241\307\227\3750KT\276"
+	.ascii	"\345\207\0136\337j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_writeInterRcCommand.175.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\261\002\275\025"
+	.string	"v(\217J\240\022V:\372\"\360\245\275[\321j\202\246Iy\231QM\273\261\030-\370!\037\203\037~K\314\357\270\360\364\2016\253Nh\271\327\337>\334\266\243I\0139\254\347x\340\277\340\304\310L\037\205\327&\005\207\300%\255\233'd\357\235Ru"
+	.string	"t"
+	.string	"~"
+	.ascii	"\021V'q)`\237\366U|E\356F6\017\260\013T\345\264\013L`\327\352"
+	.ascii	"\244\201'P\236\\]@y\3229;\007\t\316\352P\212\242t\202<v\367E"
+	.ascii	"G\270\276\002\357:s'+\2359?\370\372#\204\352\371t'kH\221\bD\313"
+	.ascii	"\207S\025\3704\025O\374\334\361\335\314:\324sz\342\311\237\243"
+	.ascii	"\035=_\317'\310\312\356z\366|<wy\3337\333\024\354\t#A\366]$\362"
+	.ascii	"q2\005\262[\007\376!7\372Y\037\336e\235&\353t\245\323\264NO:"
+	.ascii	"}\221\326\017\207\357GL\273\033\216UK\203|2\361\341\257\204\233"
+	.ascii	"\001\363\227|\242Y8(\246\013s\037\372\205\006\036E?\244vw\302"
+	.ascii	"\352dI\375\203f\341\236`\266}\244'\345\256T\363\345\331\177\320"
+	.ascii	"Q\344Cj\227\303\311IKX\235\374\216\340\226\2006$#\313K\022\006"
+	.ascii	"uw\267\266\350\207/A\360\222\266\350sB\030\243|\324 i0F\304\270"
+	.ascii	"\273)SFoj7\217\224\244\244\214\234\0237\363hJ\253\013\232\212"
+	.ascii	"\220S\313\f\212\221R\025\022t\322\353\374\260]{\013\232\211q"
+	.ascii	"\227\227bg8\013\333j\227\007k\2720S@\250\304I\337\206\232\330"
+	.ascii	"x\332\315\243/\214:R\352\323T\034\242>\371\207w b7\251|\342+"
+	.ascii	"\212\037\255\352"
+	.string	"@\024U\215\235T6P7i4\267\305n0\263\n\345\315\026\203\251f k\320\262\200\245e\346\032p\223\231\325j32\020\313\\44\226\027Y\f\206\345%\343\022\213y\311j\266\227\313\200i\030f\265\327\215F\253\275X\300=\005\362j\312\003\215\035\275qM\335\375=\270\322/\2054\217\0060\277\364\240\205\236\355\3622\337s\t\217\352\374\340/4\325\201\244A\006\211A[\224\336\230'/\351\216_\224%\205p\2037{@\375J\272\262\233T\0173 p\002!:2\017\347\235\300\327\233\016X\332\020?\030\334\016\016l\024\221\213N\0205\324\270{\361\314V\267\212\367R\276\216\023=2U\303\332\273\376kU\035\032\271\030\362\227I\321)h\305\b\306\233U\300p\202\022\302(\254GP\242\355w2\016X1v\321\357\357\017\337q\256\251\033S@\204\032D\271+\2403\326p\020\036\270\\F\343\006\366\212}<"
+	.ascii	"DL\227y\002"
+	.text
+	.section	.gnu.lto_loadValuesRcCommand.176.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`*\002=\023"
+	.string	"V\345\201G\320\362\030:\312B\370 \205\276\267\356s\n\244\311\326\214\037\302t(+\214\367p\2348m.\236\263u<\326v\367\347\217\262\2009\215\326b\001\347\340\2700{\307\352;5\253@\030,\t\224\375\347\273\236d\354\275\345N)n"
+	.string	"h"
+	.string	"n"
+	.ascii	"\275\231\023\2505h\310Tk\257\201Y\252O\367Toq\0277\333\351B\r"
+	.ascii	"\216\347\340H\304\215O\252\326\3322\371\001\372)_\200~.\n\313"
+	.ascii	"\313\336-\343\355Sn\274\371I\267\220S\252\261\343\321|\312U\260"
+	.ascii	"\210D\t\257F>\340Y\n\376\367\210\303\313EI\264\363\375\357\023"
+	.ascii	"\b8\265\343\355<\212\250\324Z\035w<\235\233\336v\315\266\006"
+	.ascii	";n\b\276\203E<L\336 {u\244\177\344\275\037\300}7\235\3213FK\031"
+	.ascii	"\2752:n\364\003\224\234\340\301;\360G\2559SA\252\216\331\244"
+	.ascii	"\342\276\337\276\355\307\345\307\360\177&\261\001\271\356\263"
+	.ascii	"\323\253N}\b\251\243\034\037\265V\224OgP}\336\276\331$\266m\204"
+	.ascii	"+\"\311 \030PuI%0\250>m;\327\243\375\027\207q{=Os\375\0310-\002"
+	.ascii	"\240|\031\372\031q\354\204;W\366\330\035Y\271\267a!\357\0334"
+	.ascii	"\356\356mV\344\342\224\351\306\275\220\233!\266g\227\361r\002"
+	.ascii	"U\253n\202-\273\322\007U\255\272\b@\027Z\202\241\024\237\376"
+	.ascii	"\f\375\374\236\354h\302\305)\037($\332\345Y\n\022\255Q~\337)"
+	.ascii	"\370\340\342\320\377]\032\375,\020\366<\3258\264{4q\205\0341"
+	.ascii	"\247\305@\270\274`\250%\300RX \254\260\304X\006b\265W\2156\r"
+	.ascii	"c\305\310VZ`/\227\225V\007\016\257\227\026lFk\261\024X\346!6"
+	.ascii	"k\325d\262Y\213\244W\277A4\236\342\203\333\234\237\364\017\t"
+	.ascii	"\215\346\nY\304\306\256v\243\"\312\351\342\330v\242t+D\351\""
+	.ascii	"\220\034?tUpqxYk\255r\265\367\335\004\027\207fp\272\253\275\215"
+	.ascii	"\211\034\2240& P\002A\210\021=\345\215@\325+\f\030\255\031L\344"
+	.ascii	"\252^Vn\242L\312\227\326\031-b\361.\240aw\251,\343\314\016\213"
+	.ascii	"\206^\205f\233\303\020\003\275\300\201\361\3401\004B\210\342"
+	.ascii	"A\204%L\326\200E0D\347(o\341\025\235\367.\351\300E\327\303\370"
+	.ascii	"\306\275b\031\017\214\210\351zO"
+	.text
+	.section	.gnu.lto_loadSensors.178.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\n\006\255!"
+	.string	"\026\374\315E\200ZN:/\fl\234(\367A\375z\362\303\206\264P\271\212\276\246G\340s\307r\377\357e\203\364^\326V\r\236\271\263\b\245\222=Q\301\261%\207X\207)\b\373\2524.z\230\366-\035c\315\210%\204\310\235R\276"
+	.string	"\247"
+	.string	"\277"
+	.ascii	"S\204\036\345R\200\017\263\361u\252>\307\0341\f\233Z\353\317"
+	.ascii	"K\1778_. \357\263\235\234\b\235\332\207r/\340\277h"
+	.string	"<@\255E\326\266\324Z\224`\240\363\245\213/`\276<?\300|i\240\rg\340F\r\n\021\323\240\246\314\325Z\203\366\210w'\213w\217\002\357\353\361\316\235Y\222K\201\376n\b\354$\2214\264\241T\360>\362t\213\242\"/P\035RO\264g\006F\246\202\234\227\241\307Y\267\23331\244aR\236o\210lm\256\246\200\234\374U\324\017(\0347zR6\314\2361\211\321\f\256\242\200\230{\261\227 \206is5\025\344t7Tk5\035JM\335;\267\355\3066\b\273\224\022\257\362}\254*QmI\255\366\311l\303\375UgV\215\252\305\na\202\025\024\255\343/\335C\325\261\315\342cIg\255\365\202O\345U\224|\255\227\226\301D?|\3513\231/\277\016\320\230\t\351\321\037\213#n\261\326\340\372\347\017\273\006+!\245\363\305Nn]=\210\343r\253\224\316.\006\351b\331w\261V\036\336\"v\317\277\376"
+	.string	"\017\273y\226z\207R\373H\352\336R\363J\352s\251wKm\222\324\345R\223$\365.5\245\324?"
+	.ascii	"\240\f\026\251\227\241\325\332\343H\247\266\225fJ\036\366\333"
+	.ascii	"w\022\023\362\213\276\230}N\001_Bz\224c\214\263ksn\032\017>\037"
+	.ascii	"\216&\304\271\333s{\336\226n\206\350b\262,\342eF\274\313\231"
+	.ascii	"Zk\0052\177#a\2338A?<a\276\334\355\305 1\253q\033M\272\346&("
+	.ascii	"\303Q\365D\217l\\\322Lc\2716\212\2179\271\345\222jPu\004P[\305"
+	.ascii	"\n\372!\271\247:\313\362\217\305q)\301\334v\355\242\257\375*"
+	.ascii	"\370j)\216\ndi\3210_n\335\320\215\220\036\275Cm$\027\364\303"
+	.ascii	"\335\373\260z\332\240\177&\316\313\255^9\323\223\266 \255\263"
+	.ascii	"\213\301\233\314\230\344\214\\,\247\371`\314\256\035^|\264\222"
+	.ascii	"\316\354g\357B\357\243F\213\277\345g\226T+,~\231\341\316Z\203"
+	.ascii	"\001H\267\205\037\206\026\024\214Z\034\001\0218j*jb*\375\003"
+	.ascii	"\232\241d\344\342W\364\302(\b\006RQR\320o\211)\bH\201\225b\034"
+	.ascii	"-\0055))-\005\371\212\365.\202\3759\344\266\332\204\373T}\213"
+	.ascii	"e\0362^\317n\032\372s\236\325\301\263;\313a\315\006\235c\337"
+	.ascii	"\356\304\371\\R\023\340\326\226\371\322\267<\261\223lW<;$\244"
+	.ascii	"t'k\255\265\327\263\017\373\002!\245s\204\363l\317\336l\213\343"
+	.ascii	"\262\362\323:\272`\307#\034\236\334\220\036\327\341\374|7\217"
+	.ascii	"\373\371Z\006\022\201]\300.\363eo\021\240\371!'\344\313?&Gu\322"
+	.ascii	"\361\326\006z\235\r\321\276\201\035\216H\315\327l\340\320\201"
+	.ascii	"~\330\301|\311\333\006H\002}\250q4e\230b\310\310\210\214\310"
+	.ascii	"H\222\246\003\260\002\231\241\242n\021\200\271d5\214k\264\001"
+	.ascii	"%\363\201\204d=@\211\245I\340\323\361\241J\226\317\r(\b\3134"
+	.ascii	"\325+\020YZ\255\320\020#\005\205\254\204W\255\216\341s/\031\264"
+	.ascii	"\333\004x\t\006\254\314\200\223\362\355&AY\006os\362\220x\245"
+	.ascii	"2K\231C\253\263\360\227q\2751{\335\n\"\\\203\270O\357\377?X\303"
+	.ascii	"\257\250\ff\025\275,e\0134\263\254xF\377X\016\2373\264\002L\225"
+	.ascii	"\233]c\3515\207Z\312|\020\207n\216\256kN7\363\034E\320!\277;"
+	.ascii	".S\245\353\315\351Oq\363\303YZ\202\2509k8?\277\223D\322\013E"
+	.ascii	"#\020\372\315\030\373w\211`-\306\003\245557^l\2576\335?\234f"
+	.ascii	"\337\371\347)\246\"\220I\013\220\370\250X~A\016\006\317=\250"
+	.ascii	"\343\232\225\026*\223\bV\022\270?\214\216&zQ\001"
+	.text
+	.section	.gnu.lto_writeIntraSensors.179.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\210\b\025-"
+	.string	"\032M\304\020F`\\N:\3735\375_\374B[\025\226\352u\254,\271\252Z\003\203S\351YHV\210'\271\203[\267\263\034mcBG\031m\177\201\217\023\300\351J\364\351\016\320t\3063\242\276B\205\242|[\333F\b\331d\357$\003\365"
+	.string	"\352"
+	.string	"\372"
+	.ascii	"\267gN\235\215\252)\377G\\\331\221\272\343\376\260\036K%\225"
+	.ascii	"\372\313\376\232\024\022\245_9\226\343\325\332\371\354\225\257"
+	.ascii	"\203O\tV\227s>:n\017\353q\021z+S\335\301\343\007\273\245\200"
+	.ascii	"(\335v\337\354g\307\243Q=@\316J\354t\311y\351\240\221\326\343"
+	.ascii	"^\236@z\274^@z\334\307\356\271\002X\271*\202\322\210\326\032"
+	.ascii	"_\3169\3516i\365\350\362=\264\307\367\f\205A\340oUS\214^{\354"
+	.ascii	"\253KiG\223\240\241\333\352\252z\017\272\302q\201\241\024\354"
+	.ascii	"\216.+;L\300\304\353\310\205mv\301\nnR\200S\312\314~\315\377"
+	.ascii	"\362\312\212|\375\032\3620.\")\320)\346\354\004a\\EP5-\265`&"
+	.ascii	"\005\257y\312*va^F\216fa\245>9g`\327U\352\243\205\336\257\235"
+	.ascii	"\204\022\314.\314\353\310\255\272\224sn\273\325\345\365\006\360"
+	.ascii	"\356?\350\356\023\335*^}1'\246\307N\310r\316\f\016\246\273\347"
+	.ascii	"\326\234\253\016\366'\263\222I\226\223\231\001\204$\226\355k"
+	.ascii	"q/\3065\347L\241\317\345]^\364\307\216\333\t\206\375\026\214"
+	.ascii	"\364\370W\201\334\027\244}\366\231ziw\231s\325\355\243_\355\027"
+	.ascii	"\222H{\247\277v\224J\230\221\336\031\\\266w\272\227V\366.y#\346"
+	.ascii	"\034\353\253\244{\265M\264\332&b\333C\253\355\003\253m\003?\333"
+	.ascii	"B\251\355\002AG\373\177\260m\237\253\275\207\253m!j;\250\332"
+	.ascii	"\006\246\266\177\330\366\232\332V\261\3554\265\215\261m\024\333"
+	.ascii	"\276\330\266Em\037A\017\336X\327\313\320\345\354\343\211'\277"
+	.ascii	"\341/Q\256\366\276\2257\247\236\245\257\345[\210n\310\344\234"
+	.ascii	"\203nmRs\224\256\275\333\324\333\244l2\007\340a6b=f\262Q\371"
+	.ascii	"d\270|\256<\245\221\272\234\227G\307Rl\224\002\317\276\033\245"
+	.ascii	"\300[\340\242o\262\300\254\230wvt\2072\363\343\024s\256u\370"
+	.ascii	"\332\350\364\365p\236\262\356v\277\263'\022S\272\325I\346\312"
+	.ascii	"\311\2512(\315\376\234\356\236\033\202\363\325\227\323S\335s"
+	.ascii	"v\253\b\313\366\365\233\277\223\2734\270\274\345?\313;e\033\340"
+	.ascii	"\275\333\213~\356\231/B^\340\275V\337\336\217/?s\257K\355\373"
+	.ascii	"\255\367\027\342rk\0363wR>5\275\352\275\210\303I/\322\023\264"
+	.ascii	"\2751?S\017\017\337\250\203\003\262\370v\2270a\277\325EW\267"
+	.ascii	"\252}.\276_{\2009Z}\310\347\363\013R\364\372\334\266Z_V\366\331"
+	.ascii	"\367\332\213^\2414YdV"
+	.string	"\215\342p*\326\234\257\224\372lR\254X\307\250\322\343{1\310\241!\355\263\373j\276\206E\177\254\231\212\305\364\330\3367\345\276\342\364\326\300\3450\277\321\345\255\312\346\351\272\2343z\246\217&=#\323/\3632\262\234t\006-b\030\235\\`c\024ST\r\354\364\236P\254\340BB\223\013#\322\200\250\031F((\033E\265\213H9\236\232`\024\231b4%\315pb\222\221T\204\252\221\204\204\240\237h\030\241\222\242\236\236\240\222\202K\344\323~\035{E\336\220\327j\231s\356\271Kz\330&\f\2727\216=\372\360\356\030^\341\325\240\346\312\332\351\340\025Z,\233e<\226\035\225\366[Gez\034\274\277/$\272&lx\227\220\366\316\321a\320\275Z\203\017o\320=\320\233\336\231\275D\234bN\341]\322DlBz\254\006\256*$\313\357\300\005b\033\202\006$\3367\177 ZC\324\250\375\343YJtwt\343"
+	.string	"Rd\211nw\006\r\217\333\373\361\206\224\363^js\212\201\t\016]b\b[\245b\bO\b\337\215\360\202"
+	.ascii	"7\374\311a=p\201\344\320\220u\362nt\267\367\023\272\006\232\335"
+	.ascii	" \236\247\003Q\\\316W\024\336l\017\307\363\001(\356\270\205."
+	.ascii	"\021\200\3473\200\261\250q0\344\224SFdFDd$i\322\001\220\002\221"
+	.ascii	"!#v\021p\255e5\263\240)\265\277\001g$\004~\022;`\351\216a\351"
+	.ascii	">\317\006\350a\225-Y\321A\"\t\237\221\221''\212\354\274t\245"
+	.ascii	"\2152\024\006\362\3613h\001\342\222\363\322\312[R\235f\325\216"
+	.ascii	"]\274\\:\"\314\324-\346\034\220y\262\240\020d\255G%\215h\361"
+	.ascii	"Mi\007^\006\200\0254\354\240\334\266\236\035\035N\021Q\253\225"
+	.ascii	"\326\224\244\315\375\233\025;\202\216\f\263\230\257\202\216\303"
+	.ascii	"%&\252Z\214641\303*\246\b\301\314\347\214\234)I\006\001\336\201"
+	.ascii	"z\263\254(<\375\316\344\352s+@\300 \3222C\340\332\033\254bZ\356"
+	.ascii	"\263\033\306\002=\225\206\036~)(\204$\200\274\260\311\336\310"
+	.ascii	"\314|\374\006\313FCq\232v\312\305\304 <%\354J\260\3060\013>'"
+	.ascii	"\300\241\3079K\375\334pkKU\3319S\240\371\366\342(\n$\242O |a"
+	.ascii	"\027T\305\322h\236\005\\\213\336R\356U\276G\013\232\242\242W"
+	.ascii	"\315\252\315\243\"\371(\223+\024V\334F\373?QU\360m\225\237\352"
+	.ascii	"\004\321\365\272\237\337\310E\004\220\374[\377\200\n&\006/%\363"
+	.ascii	"\362\254G\315\327\005&\260\225w\275\241H\225\016\253\212\201"
+	.ascii	"\225<\310U\340^?\350\030~\325\\\2625\270\333U\001\0211)\235\n"
+	.text
+	.section	.gnu.lto_writeInterSensors.180.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\365\013M5"
+	.ascii	"JYp\023F`\330N:\277F\027\272v\"$\352\310y\345c\007\231\214F\216"
+	.ascii	"+\033DV\013\377\272U\264\252\004o\216\320\220\003\266!*bE\326"
+	.ascii	"\023\271\276\330\361\255\373x\377\340a-|Q\374\2738\3338\032\207"
+	.ascii	"\020\"m\357$\003%\001\021\001'\001\277\267\313:\026-e\376\215"
+	.ascii	"?8\037\203W[D{\025\313\fS\237J\277\016+\260\312\255l\375\331"
+	.ascii	"{\217\201\330\3642\230s\016\321^M\026O\227\325m\274z?\327F,)"
+	.ascii	"\323\245|\312\326\345^<\227\345\026M\223\313`\316cIW{C{\365\322"
+	.ascii	"!\254,N-\241\236\3545%\016C{\025\253\n\323o\367\237\034\312\326"
+	.ascii	"\343\264\216\3149\b\033\274\234\235\fZ\251\275\332\316\003\255"
+	.ascii	"W\333\377\254W{\253[P\350+s5h\336\205\315!\346\234\2270\221f"
+	.ascii	"_t\276{\356\326\221=G\236\035\035c\016N\313\256j\021\337\255"
+	.ascii	">\3334\367\"\220\276;&\031\327\221\305\326o\254H\021\302\025"
+	.ascii	"#\353\272=GC\312\330~\344\331\3211F_\204+\362\266V\366\3439i"
+	.ascii	">z\360\330\361c\305\251{k\225\300=!d\321\3005!\\#\034yS\241\307"
+	.ascii	"Q\002W\204p\255\f\355\305\257\215\235\205\201}\345\220y\2559"
+	.ascii	"{F\366\372hm\fm\305\257\273\207\246\027\302\2652\266_\266)\347"
+	.ascii	"\334\227IV\366\366y\367at\367\211n#\033Q\374\262\336}\234\205"
+	.ascii	"M0\027?\357I\035|\273'\361\30570,qy\247,\336\345\251\3159C\350"
+	.ascii	"o9\027\250~\333\325F!u\317\274\332\227Z\257\036_\016Poy\247\375"
+	.ascii	"*\207M\214\2359s\341N\372\237\227\240\266\274m\372u/.Ys\321\004"
+	.ascii	"\351p\211_\276m\272\235]\027\013q\346\274\243q\220n\3666\002"
+	.ascii	"\366\366\201\366\266\001\366v\001\366\366Q\316\355$\316m#\366"
+	.ascii	"vQ{\233\210\275=\324\336&\300\336\036\300\336\026\320\336\026"
+	.ascii	"bo\007`o\007\345\334\006\302\271\r\200\275\375\323\336\366A\266"
+	.ascii	"\267\217w\376<\354\355\235\307\375:\177\276Y\366\366\312\336"
+	.ascii	"V\325\333E\3666^o_\365\366\023\360\260i#;\037]\3166\246n\262"
+	.ascii	"T\325K\362\347/\027\335\273\226\325\255\223^\316L6vh\267\261"
+	.ascii	"\263~\245\177w\275\021>\004\215yx.\002\231\212\367yY\307sq\325"
+	.ascii	"2\222\306\023\023\355U;,Z=\331/\177\fM\363n0gg\322\325\254/L"
+	.ascii	"\0019XH\263hL\332\0038\210\316\314\216-\200\213\350\314j\254"
+	.ascii	"G\230\315\301D-\302At9\322\212C\030G\030Z\037\356gX\021`\261"
+	.ascii	"\356\031}C\302'\263\177&\260\031\343d^\346\017\tX\177L\030/i"
+	.ascii	"\264\3572\252e\357I\036\374,_\337\376\272\267\207N\244K\276w"
+	.ascii	"\023\2162\235\246\3011\200\017h\270\331\204\001C3\302#\031\346"
+	.ascii	"h9<\261C\2015\201G*<d\223\370\250\233\356\346C\321_\316^\020"
+	.ascii	"\016\355\020o#\"\350\357j\022\027\035\247\323i\342\221\326\213"
+	.ascii	"\215pQ\fXZ\027\341\337\221\n\273\254D\270\210\304\021\211\242"
+	.ascii	"a\216T\270\247\022\300C\370a\211\320.q5&\332\234\275\230\372"
+	.ascii	"i\242\234\372mZ\353U\0028\b0\256\020*}\025\236\224\353\276\351"
+	.ascii	"~\356\031\201\026\013\373\206+\341S\260\177F\r"
+	.string	"l\002\236\314\313\334\023\375!\021\323\037\3630jF\334\262\332\227\276_\013\266'Z/m\331\362\330\257\226\341\330\334\016\355\367u\267\340\320\230\263\234\271\236\326}\276\316\352\026\274\314\254 \031v\023\373\320\237\2550'\246\240\244\242T\250+\247++U\352VNWSP'\326++\247\251b?x\212\020\345@\031\005\245\004\340j\005TUU\213'\266\237\224\260\250\224)\236\234\246\224K+\244\234T,=UY-)\0315\025\013\250\252\245+*\252\252%\243s\371v\342 7\243k\332\365\250xm\017\241\322%\356\352\027\305\234\327&\\\356\037\224r\247mtW|*\237\243P\304\226s>\263\273\202\205{f'\2770W\177\356g;\314\313H,\244w\236G$\306dn\322Y,\306b\025S\350\363\272l\272\210\325\276<n\217\247~[_\300p\317\304\200q\316\226w\352\203\310\342\246\345m\363b\017\217\200\235"
+	.ascii	":A\306\237\234\035\374(\316\245\361\001H\374\347\202\263\030"
+	.ascii	"\211\277J\017\3410\236\313p\374\273|\314\302\001\030\001\306"
+	.ascii	"X(\r\230[\327\367\262\034\315y\330\274\\\200G!,@\303=S\n]\261"
+	.ascii	"<\036\016W\2072\300\225\261\003\204\203\032\304\305\021\355\020"
+	.ascii	"\367\206\022\350k~1\200\033\246\343\203\177H\\"
+	.string	"2\245\317\375\3123\036\361N\264K\\\033\312\343\355\372\243yy\001\200\362\250q<\310\234B##\"\222$\005\311p\320\002\221\031\233\270\001\021\340(E\316\210\215\2144I\n[c'\034\017\356\037\256\350\217s\302\320\206cVY \235|\026?\207\020Z\371\217\214\033W\337\222\266~\037Hk]\302\336\267\366],\037\b\021>E\312u\214\017\206(')\tWBpw\341\345\037_w%I2~\366n\273H\307kI\274_{@\247\310\203\034\231\367\002\200\211\346\300fh\017\221(\262h&\314\t\374\220\271\260l\035\312\277\004\356dA\036\223\333\222j5Rp]\375\376\233\314\232\202g-)\022\277A- \267T\214s\320u\275*\033\260\301hA\017\177\247@\370\351\344&\375\254\357\215\314\264\0331a\261%\333\247\307BS\025u/\360\247\030\241\020\212\340\353NX{\203\355\2040\342\263\b'i\2724A"
+	.string	"\004\262\246\347C%?\254\b\316\250\306'zf\207\006\017v]\367\301L\n}\016\270 \320\305,9\210\231|\211\003\337\006\254\300v\031T9\305,A\322A\341\252Q\234\007\363\353\013\214\364\351\271\323\266rl\235\207\343NF\216\377\337\223\265;!a\202\033\363Pw\330\363\264\356\266\020\336\223\254\205\254\016\025\364sl"
+	.ascii	"\314#\276\352\032 \304gY\277h\332>\024\345\242DQ\311_\301\347"
+	.ascii	"\364\205\021\362\252\316\310\034M\215\001\257\030D\007\263\301"
+	.ascii	"\225\342\226p\204Q\370\220\021>\366\200PP\363B%\210RO6\264\303"
+	.ascii	"X(\022<.\206\307\237\207|\262#\002}\nM. \027\005l$\tMU\312\273"
+	.ascii	"\314qq\304\n\020q\305\324\322\256\3742\300\374RX\311PjL`T\354"
+	.ascii	"\030\333V\275\351\020\177"
+	.text
+	.section	.gnu.lto_loadValuesSensors.181.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`z\007}("
+	.string	"ZH\220\017Bp\350JcC\207\240r\313\373\215\023\2034\275a\266w\227\245B\223\247Mn\340\332\226\250\313\374G\324TZ\215\327\304\365<\200\200H\251\200\321$\225\346\220?O\016\001\330\371\253U d\357\275\367\2262\245\347"
+	.string	"\330"
+	.string	"\350"
+	.string	"\017\002\227f\204\356e\325\223%\237\213?\254\202\262t5\027\177\277\356y\350\t\312\321\335{\221^\032\304\273X\331\275\227\267\257\354\236]e\266T\265\3440\n\272Z[\3048\240/\253\302\226^\355cy\226\253\013u\\\350^\263=c\356\025Bp\022\372\322B\364\301[\271\262\213\033v\374\274\"\004\353"
+	.string	"\273\350\271\367*1x\221\371\222<\221\371\322&\361yRx\363\352\325{\274\024=\315\222\264\365\312?\231\266\\C\226\233!\227\027\326{$\372\326U\204\254P{xeU^\003$_D\236\202\201\202JI\263Rw\336I\253RgZ`\002\245$>\225\222\246\244\256\354K\354\344\313\272\302\200[;x^Z&\257\270\244\350\006e]b\246\375\360$\202rue_D^O\246{\257+\227\327\327\r\340\266\363\330>a\237\r\002U\016x\367\253\307\250\227iB\357\275\025\3741'\363\344\243\2754\324\213z\256\027\346\313[\fqe~\365\350{\261kc\255\360^,k\244_\355\027\310~\265\217?<9\245\354\310\216\355\355\326>\2660\253\332#\302{\177\330\232\331h\265\001\264\272@Zm\204V\023@\253}\275\352\"^\365"
+	.string	"\264\232(\255\036B\253\205\202\322j\240\013\377"
+	.string	"\327\362\003\270\332\235\242\325(Z}\226\325f\255.\317j\362\254\266fu-\253\177"
+	.ascii	"\350\016\315\353ms\356\005r\364s\335\3122N\256\366\333\367\273"
+	.ascii	"\234hu/\376\332\305\2440bW\345\336\333\013\003\006\207\334\022"
+	.ascii	"Y\037\306\352`pT\262+\344\303\212E\240/\277\004\335\267\373."
+	.ascii	"\272`\035\272{\205H/\255\336,\275\376\213\325\205:\234n\037"
+	.string	"\236'\004\201=q~d\264;\213\254\317&~g\204\002\270{\265*\234\350\022\267s\302\007\367\262\310*\020p<\036\357~dV;\300\222q\266\306\262\352\334~dd3\207,\021\212\323\r\241a\363#c\261\004\262B\366\300;\242U|n\005z\257\326\004_\256\005\013\037M\207\371\022\310\372\342\260x1\232I\363\2511nX\365\217\275V\\b\206\244\343\3271\343\326\344\370s\3128\3017\177;\234\372\004nM\332\370mgC\266\344\311%S\343\257\361\034\372\004\346\323\240g\267\353'\273igON\364\317\330\236C '\354^\254\217\331/\332\276\262\225=W\271\256\003\006\300z\347\023\3773c\226\267+\346CBc\020N\265\017\023\300\376\313\031\220\026\200-\355\267\244\2207\233i-i\277\025%\253\036\235Zk\377\007xg\253\r-\242\240`\270(a\274\006\224\215\250\246\033\246)<Yp!\301\311\005T\322"
+	.string	"(\252&\252\032\245\237\222\252\244\234b<5E9)\315\200\321$C\351i\252\206R\322\002K\321\200\232R\242\222\222\232R\352\t\177\267\320\232\371\303\037lx\245\215wZ\024\265\026\310~6\313\337\362\237\331\325\331#\016\260\226\006YK\247\"=\265=R{\332\fmZ\225\217M{\376\371]\223\217f\r\034\352\2718\230/M\233\206\r?\244'\265L\277\332\347$\317\036\361)F\005-`}C0\342I\300*\030\202\3750}\366\034B\245$\262\276\341\2201R\310\n\001\212\265Y\277\203i\300\366\260\203\354\325\036<\265A\366[c\246\233\035\233\001\353\363\241\352 "
+	.string	"\016\315\317a\276\254m\270\214\377\360\250\035\033\267_\361f\262Y\216G<\251\221-\340\341zV\030\331\001\213\373\221\235!h\200\217\250a@\304\234BFHDDd$-\026\016\260\002\231\2312u\021\200)U5R\322d\331\357%\261\200\364\245\352\0160\3604\225\035\022\326k\242T\2010\037$\250}s\b\313\350}]\237\337\221\225\"w\233\023\312\354\352\341\303;\020L\017\221\021\214o\301/\265\"J\377\244\002Q\220\023%\313\202\212\3472\220\013\357\230\251O\001\330\036\217\360\320L\326I\217\257\017e\347jvG\317\241\017\013\226\366;V\2741\202\273\021r\006\215SW_\t\217\221Cl\004\257\247+/*K*p\350\256\0215f\002\317\326\336\227\313@c\255\005;\006#\303\r\312\251"
+	.ascii	"\177\224\300\366{\026t\314AnL\245O\030P\356\004N\030\331\357"
+	.ascii	"@1\004\341\223jm\260\361`\277\016\270\"a\210\252d[Y\007\213\345"
+	.ascii	"\036\247@\002V\224\270\033\263\b\356\363\023\037\311\323 \355"
+	.ascii	"\002\004\021\027!\200\323\t\201\206s\005xU\t,\262\314\307&\002"
+	.ascii	"\225\3222\362\226\003\366g&\034/R\374\246\337\002\025\327QIM"
+	.ascii	"9,a\236\221x\210\321\270\351[\177"
+	.text
+	.section	.gnu.lto_writeMainStateArrayUsingAveragePredictor.182.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`J\003\005\030"
+	.string	"v-\234H\260XQ:D\366\304V\220\236\307i\276\362m|(\215b\037\313\"\023\325\363\304\264\215G\240f\213RA_O\337\323G\334\241\352)\237\345=\3459\274yEh\236K\366\363\030;q\235=\004\250U\024=\233\335[\312\224\002\211"
+	.string	"~"
+	.string	"\206"
+	.ascii	"\006<\341\273\234\211\265%\037M$\354t:\"|\2275\036\261\253\375"
+	.ascii	"\035\347a{\017\0212\001f\317\017\023Js\352\f\370\365]Z\367\030"
+	.ascii	"\324\345w\030\324\245mv\024\031\237\271\223\200\2507\"\310\323"
+	.ascii	"\234\023\2660\234\n\3030|\324\335Qm\227q\325\346\027=\n5a\372"
+	.ascii	"\311\355\\\306\224\317\211\031\254\234Od\300k\"\362\243+P\216"
+	.ascii	"G\243\r\025\337\037]\n1I\371\311\251\270\246\036\3149\255?9\024"
+	.ascii	"7\352\266ul\317\354\255\t\367\361\303\\\367\013\270\220\377\345"
+	.ascii	"\273\233\245j\027U\267H\365\352j\026"
+	.string	"U\253T\375Iu\352j\224\252\245T\307\2537\2525\252/\003 \350I\356LL\346<\021V\231I$\021\032G\372w\265\247\230?\304O\362\252F\005)D\211!\242\260\002\224\230o\344\037yuY\213\022\263w^\372D1O\342\211\310J\323\234\223\346\322\024\276\313\257\354\232\222\230\002y\020\333\205x)\006\230=B=\2459g1\313\262\021\t\016\007\217\021/\305\222\326\036\35137\355-\241T\333ZM\302\351\370V\256j\243\025\\\213\324~`\nfQ+\247\304\225{_I\307\3037\347\274\f_\004\352@,n+`w\217\303\241\267\021\324W\367\270\033<\032\232\265\337\210d\304\225\233\206~\322_\214\234\302\335\242\">\2715\315\277\273\003\0277\355\371G\2179\202\b8\365\226L\355\331\272\035\335\027\366\031\304\3405y\207l\327{\3741G\272[\001 -Gvca\006\342\250n\236\303\341\003M&\021\034"
+	.ascii	"1\003q\244\027\310\032\\P`sa\366j\201\340\007Y\264\354\245C\263"
+	.ascii	"\311 \253\321`\003\343pS\263\001&\003=\300^\003L\303\231\201"
+	.ascii	"\260\034\032\r\204\255t\363;\344\027\375$x+\222\334\226G\356"
+	.ascii	"\013\253X\254k\327\211\322\234\265@/\313Z\bGz\224\307\024\304"
+	.ascii	"\332\0077\355=\3169gt\355w\005\316Z\327\276e\344\324S\251\313"
+	.ascii	"\332\264\016\372\037\317\364\354\216[\333\262.\373$\\\215\325"
+	.ascii	"\266`X\005? \220\002\031B\252\007b\261\210\366\001_O:\360\177"
+	.ascii	"\204\201\365EI\255\211\211\223\266\207\201\0316\324\264\255\350"
+	.ascii	"l#\373\320\032h\340\262\213\214-\203\3400\202|\305\354\201\331"
+	.ascii	"\310\325v\002\032\362\032\302\016\315A3\263oX9^CO\215\221\310"
+	.ascii	"\320\3017\307\027\367\021\205\253\b\373\230\353U5\320\242o\355"
+	.ascii	"\323\"^P\r\335\250\207U\024\215\022\267\313F\232h\023\250a\016"
+	.ascii	"i\256\3000\302\270 \0368\\\006\363\315\013\213m<\340DL\327z\002"
+	.text
+	.section	.gnu.lto_loadGyro.184.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\365\001\335\021"
+	.string	"\226\342vG\320\322(\035\242\f+9\326\023\024\375\025\241 R~\336W\3452\352\215c\210\234\270\002\203\305\317\264\016\215\2335+\224V\207p]\350)_\300 W\263\214\330RC\274QNu\201\201\034[d\027]\255o\373{K\231Rb"
+	.string	"["
+	.string	"f"
+	.string	"'\260\253S\003\306\256\216\304,\324\243u?`zD\275\200\351\3214[G\002\231\255\265|:\314\244P\332\335OCX\017u7L\332#\324\244\371\247\222\334aN\222\214\033\256\366\b\007\354\256"
+	.string	"\234\fd\22058\230\204$n\256\007z\314A\352\335p7\317S\311\356:o8\233\333t\3332\333\025\354\\\005\271d\353j\251;\366\277\273k\325\261S\377\371O\337\335\020\246U\323\231\351\003"
+	.ascii	"\021!\204;R\217]\016=\037["
+	.string	"\024\207F|\367\333\237\341h\371:\037\310\252Y\216\226m\377\304Q\320\2763\321\327fO\243\344\363a\307\356\256\036M\001\365(\002\257\262g3ZO\373&\356C\373\317K9#U\027\026\020\270\336\342\205\022Z\201\201\360\364\274\334x\244\252\252\215\231\037\001\362j\243\244\230~K\025\211\321\232m\317\316\302/B\216v\027\202\255\362\240\330\b\317\356:P\361\025\031\374\236G\267\270\344o\217\276\213\351\361\032\2024d\313\236\037\304\213\241\272\2735\365\352\337]\002\b[.\371@\207%p\026\360rF\033(\367\203W\204\223\006&'0\226\001\230\314%k\211~\2614\304LR^\256\013&\037\006\024\227\312\367bi\371X\n\034[\201\261|\262X\214\345S\351\366_\325\361s?\r\217\250\310\2460Qw|\242\241)\325\244\\\035j\r\311\241NH\212I\336\r\034\250%\266\\:\334\335\205)\375\356\"#\207\232\322o\360"
+	.ascii	"\223=\353\021/' `\0021ee\007\345F\340\353\315B\247\210\321<\370"
+	.ascii	"7\331\225\302N\377\215{-\346\310jVqZ\212'\"\f\031\315\332u\327"
+	.ascii	"\362\303F\217T!\215\333\035\370\017\316\211Qh\013B\210G\361\020"
+	.ascii	"a\206\311\030\020V\021\034\303i\342\273R\226{\331\020\341\rY"
+	.ascii	"\366\266\003\202P6]\375\t"
+	.text
+	.section	.gnu.lto_writeIntraGyro.185.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\225\t"
+	.string	"\246\322C:0\221\322\001"
+	.string	"\027|~\201\027\315`4\226\030\325<C\326<o\262\330\270\002\276a\t6s\360oQ\311)\272\315\344\207A\013\f>fy$\016=x\324w\270H\343\266{\247\0241"
+	.string	"0"
+	.string	"3"
+	.string	"\345\013\266W\356\003\333\253E\273\306\200\265\243\002\354\345\301r\263\273\036%\271\370)\372G9"
+	.string	"\331\032?=\016\273\353I\266@nz\333\b\266\037l\333\004\273\273\246.\373\261\177\316\351\327\200\022\232\326gf\273\037\265\234\225\325\027\023\333\377\330\026e\350\323\376\311a\342c\252\013\354\272f.\273%\310\035\367\352?\265+N\363\244?\",:\332_\3318i\247\256r\301\355v\204R42\270\327\253\257\332^Ok\013\031\262\2325'\320`dv\342\330\3458\351\210\375Nf\370\032J\013\243\022\251#@\231Ha\230\372<\376:\fp\024\361\211$F\236\tB4\341}\341\311\353\016\fR\220B\017\005\202\241\367)\367\235\245.s\264\030\331\212r\230\233\240\f"
+	.ascii	"7w\002K=\231\320\007\016\034\\</\361a\202({\301\335e\224o5\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_writeInterGyro.186.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`=\001\255\r"
+	.string	"f\231[D"
+	.string	"\261&\035\340\300\f|\260>\314\357\031\3622\303\377f\0360,\037\346\271B\264\326\330r\370\035\027[S#\037\354\026+\030\210\fe\225\346\377\377\333\377\027\0374&\002o\254d\347y\2519\350\266do)S\nE"
+	.string	"F"
+	.string	"K"
+	.string	"\366E\274%u\027\324\001\354\262d\314\354v\036\006\305Cw\037p\035\306\007\270\016\235\262c|,\254\nA\013\210\025\230\031\273\213i\207\247\236)\377$\276\301\255T\317N\203\335ur+\f\267\336\266\001\333\017\354\217\b4)\231\343\00374Zl\342\330\235*\225\203\375\267\273ke\331w\371;\357\376\353\245\337K\253\2463\323\337\340`i\255\376\242f\367BN\215\265\2014,\266\357\261O<t\250O\307\252\274\204p\020\017O4|<\003_1\023\022cBzz\301P\021A&$\356\252\304l$\324u\250\372q\361\024\0238[\344(H\342\356~\234\240\240\305\026\212\022\220\3412\274\334\004J\334\335\005~\211\303@\360[\207.\235\362\334\241\177\272\016\363fq\035^_\363!\246Rh\344YA\306"
+	.string	"$\201\bd\004\022`*\031m\333)\3538\003I\320D\"YhD\204\225\220B$X\266\2250P\001k&\243\r3i\332\206y\272\375[e9\336\340\330\244h\005s\244\307SU\237\332\331(\317\331\263aEUv\034"
+	.ascii	"7w\002K=\231\320\225\027\230\270\360\2422,*\002\334Q\006B\256"
+	.ascii	"\"|\t\001L\001w\200\315\257\312\261\323\t\300\245\f\272\007\226"
+	.ascii	"M\265\257u\255\037\314\002\300\205\217\026\306\003&\202P\263"
+	.ascii	"\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_loadValuesGyro.187.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\316\003m\032"
+	.string	"V\260\247J\300VQ:d\371\324\365F\260v\020\023\371\362\327^\321\220\205<\022\216\252\004\251\f\001x9\237G\360\314\"P\344\232\342[B\215\254\215"
+	.string	"\305o\262\333-\213e\373\t"
+	.string	"~+O\251\240\220o\236iX\004\321 \204\354-w\222\001\217"
+	.string	"\221"
+	.string	"\216"
+	.string	"\263]\362\365\273\264]rW\004\320j2\375\030\240i\240\246\025\026\306W\237-\253\317\335\013\371\022\355\270\022\257\351>\272\"\325\215\303\331\234\361uq\343\201<\bm\267W!\250\274-PZ:\341\264\245\273U6/\020\276\322\017\b_\031\307\362)\356K'\355\225\362\244\355\233N\241fEg\273\231x\245b\020\321\016"
+	.string	"\267 \372"
+	.ascii	"\370\343\235\3679t\253M\332\343\305\371\274W\033T\202\266\333"
+	.ascii	"\213OQBw\357\264\335Z|\303\357nlw5\3542\226[\317\364\323"
+	.string	"\343\376\031\316=M\200\244\334\355V\236\272\211\202]z\252\362x|\367\357~\017\365\335\236\267\344\322f\037\2627\362#\227:0\205Iw\223:\332\221t\214U\235\327!\331\336,\352\232\024\277\3160\346T\254\346|\216\351G\246\250\005\244\210*\"\243i_\237\305Oi\351\327\215\273y\225\231X\321\371\250\331\213\310t\372.\212\224T\374^\027\303\370*CZ\035\352N\373'\331\215\325\356\237f'\262\275w\213>\212-JD\277\356\276y\335\013w\n{\035{Y\370\n\303\037\222Q\316\340\212|\036\371B>\346\327I\030\262\310\027J\252\315\340V\016\231{'\276\034\n\330\303\307OK\202n\2747\377\356\021\212J\336\351\017\243\004\300\032\276\226z\315\024p\206\024\234_G\371\271\363\243nS^I\317m\273;\357y\030\273\201\032$!\001b\324Q\"|=S-6\030\345\f.i\324\223\313.\2566\031i\367\017r"
+	.ascii	"\177\313G\2733u\256\314\234K\212sc\306\2710t\356(\316\025\305"
+	.ascii	"\271\341w\0171\036\237W\253\316X0\030\253\356\274\307\345\363"
+	.ascii	"\201%\"\\\007-\b\033\030\350lp\345\020p\305X\261\236\272\255"
+	.string	"\234\021/\035\017-\326\007\035\025\317\016\013\204\252\005\353Q\345 \330W\b\027L\025{\275`*\022W\236\217lJ\256\351rQ\177\323k\246\270\270\230*\237\003\370\303W\031iad\360\fs\225y\363\312C8\257<\241\n\320\004F1\252,\241\244\335\335t\206\277S\360\3123|!\032\024\nX\303'\303\373'\035\\?\341\353\204b\313\002\30321L\231\2441|/BI\373&<\034\002L\250a,\205\030S\312\220\210H \024\264\005\327`\002!dv\036\021\260\261E\307\205\2159e:(?\032\204\210{+\326\222\333R\322\326\226\032C\362'\3129\331r\266T\007\252\r)v\275\234\360g\007%;w`L\214\207\265E\3261\004\316LL\241\245\353\344V\322\251\232\3165\3426\316!\254r\027\356\n\240\007L\270\260k\337\334)\302iQ\211\240\3728\"q\265\202:H\002\032&\276\350\007,\206\364\264\251"
+	.ascii	"\f\345CVZ\247\322&E\312\304\017\211Z\001J\247\337\371\260b\t"
+	.ascii	"^\"p\255\230q\031\221cY\005{\233\224N\005"
+	.text
+	.section	.gnu.lto_loadAcc.188.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\336\001]\021"
+	.string	"\226\340qH\320\322(\035\0029\210\030#kd\212\334"
+	.string	"(\020<Z\235"
+	.string	"p\266l\263%\2651\276\361\025\226\330\314\007o\366\353\001\244\334\276[74\320\373\201\007\370\342a\262\330\206\312Fy\320\0077"
+	.string	"\246\017\335tS\300f7\221;\245\\"
+	.string	"X"
+	.string	"a"
+	.string	"+\216\370\363>-\276\300\350\323;\201\321\247g\366\r\003*K;\331\354\254\254\340\261\273\240\206\260\276\023\357N\316>;\2253\237\204\302y'C\304s\013i\237\235\200\335\r\020\252t\fdKh\223\035\211\227\353s>e\206v\334\302\227K\022jw-o\241\313=\272\355\230\355\n\266\f\t\337\335\265\342l\3577\377\350\271[UZJ\351\003"
+	.string	"9Q\023~\b\307n\207\"\037\3733{F<\367\333\227\3218\371\242\237\343\222\254\306\311\266\237\342*f\317y\306\327e\317\302\303&F\216\3355}\232\202\367)\322\275d\313xN\227\366Q\334f\366\233\224\017\330\305\371\310\330\0324\302"
+	.string	"I\205\301:\020d\341;-\357\305\253\004\204\246&\345\246C\245*\321\312\017\333(wa\362A\260]\327\321\220\200fw\035\260x\013\230_\363i\331\211\374\355\323?\031}^?\021=5Y\344\353\214\037Tw\227\2466\375\271K"
+	.ascii	"Q\223\243\237\363\316D\214\202\021\006h\345h\2134\2513\366\003"
+	.ascii	"\255\373\301*\002I\003\025\t\353\013a\305R1\330\364\352Cq\251"
+	.ascii	"JV\251\013*\020C+e\002\256^0\360C`W\006\326\013\214\271\\/\260"
+	.ascii	"$\356\277\2123\316\3172\226\370\251\251m\352\214I>\352\251\n"
+	.ascii	"I\323U[F\256:Ah\203\354a#F\025U\223\343\273\316\323\347.\262"
+	.ascii	"\340\252\236\236\203\007\233,r) p\0021Ue\007\345F \352IB\247"
+	.ascii	"\032cq/J\222]\027\354\250\337\270\373\342\204V\277\354\214%v"
+	.ascii	"H\301{\004X\321x3\241\241\013%m,\330C(\t\314\344\f\020\343n\373"
+	.ascii	"4\355\265K+\236-\354vr\003\272\"\242\307\360\233\370^\312y/\032"
+	.ascii	"\"\262!\313\336\326\200\340\224M\227x\002"
+	.text
+	.section	.gnu.lto_writeIntraAcc.189.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\225\t"
+	.string	"\246\322C:0\221\322\001"
+	.string	"\313\332)\214q\n\352\fi\210S\336\r\307\201\337ba\272&\276a\t6s\370\177Tr\212n3\371a\320\002\203\217Y\036\211C\017\036\365\035\256m\335\177\357\224\0021"
+	.string	"0"
+	.string	"3"
+	.string	"\343\013:\247\365\003\235S\203\366\314\200\265\241\002,\246\203\305fw\2719r\360\022\364\217r"
+	.string	"\261\025^z\034v\327Rl}\334\363\266\021l?\330\256\t\273\273\236.\373\261_J\351\323\200WK\35343\273\036\265\233\225Q\230\022\333\377\330\251W\350\322\376\311a\340c\252\013\354\272f/\273#\310[=u\377\264+N\362\242?!\254\031\332_\321\270h\247\256bQw9B)\031\030\225\344\324WuN?\251\213\b\262\2225'\320LdV\322\3541\224S\304>'f\350\032J\013\243\022i#@\231H\337\227\352<\356\266\013o\024\321\211$F\234\tB4\301u\337\211\333\016\354Q\220>\016\345y\037\367\031\367\234\235.W\032L\266\232\033\256\022\024\f"
+	.ascii	"7w\002K=\231\320\007\016\034\\</\361a\202({\301\335e\224o5\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_writeInterAcc.190.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`=\001\245\r"
+	.string	"fY[D\020\221\223\016\300e\242\356\300y\n\270\376\303\220\250\036)P\243d\"\366\360\r\203\222\321p\b!\024\031\333\020\352\240\026k\020\021\227\2375z"
+	.string	" \026@\004]\323\302QS\r\254\344{\256\0315b\311\336R\246\024D"
+	.string	"E"
+	.string	"L"
+	.string	"\366E|\305t\226\322\003\354\246T0\273\037\207\261\353\321\337\tX\217\327\005X\2176\331*\317\205=%X\211\201\342Bcw3\375p\323\323\344\237\3049\036\352\364\3348\330]\247\207\312p\353m\037\260\r\301\376\2101&Yc\004+\231\027\233+\373;\245z\260\017ww\255)\373,\377\346\337o\3014\204i\325tf\372\234\r\025\031\250\253X\354b\250\251\26131&\204\355w\354\216\303W\362"
+	.string	"\330\223\026\225\007\327c\247\241\343\031o\001\363\361B\"\202j\321\254\220\240\342\343\332=y\341D%\353Q\3253\343)(x6\310Q\210\\\273\333q\242\302v\245\224h\001\032oC\313M\224\\\273\313\300/q\227\b~\312\243G]\336{\364;\3531o\031\353\361z\030 \002\244\321'\004z\201\326\300C\001\310#\204\r \215\2048\256\3236\326\260\t\033\bD\373\204\200\262\021\321G$\323\270Q\206\031\360F\022\3422\322\266qY\347\333\303\325\224\257\225\213\031\023\265\340\215\344x\252*T[\013\345=w:\240\350\311\016\034"
+	.ascii	"7w\002K=\231\320\225\027\230\270\360\2422,*\002\334Q\006B\256"
+	.ascii	"\"|\t\001L\001w\200\315\257\312\261\323\t\300\245\f\272\007\226"
+	.ascii	"M\265\257u\255\037\314\002\300\205\217\026\306\003&\202P\263"
+	.ascii	"\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_loadValuesAcc.191.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\316\003e\032"
+	.string	"Vp\247J\300\224Q:\270y\370w\214m\246w\203\250\bu<\355\310\bo4{\207\350\276\222`\252\016\310\200\242\356\355E\t\331\271\3554\333\367\254|\366~u[L\266\257\301\237\217\240\232\226\307dc\311`5\360\364DM\b\331[\356$\003\216"
+	.string	"\221"
+	.string	"\216"
+	.string	"\264\335\361\365\273\265\335qW\306\2055\227|\f\320\364\017\023\221\005\361Uf\205\365\271\373 \027R;\316\304k\272\221\252\246\272q8\233#\276.N\374\217\003\251\355\356*"
+	.string	"\221\345\002\245*\024M[\272{e\363\002\340+\375"
+	.string	"\360\225m,\237\342\276t\326^)\317\332\236\351\024lU~\267\362\304+\r\201\212r"
+	.string	"(\201\350\003_Ow\335\247Pi\233tG\213\363u\2574\246\374ne\213\317PBw\357\274\225+\276\340wW\266\273\032v\371J[\277\364\323\343\376\t\316=M\200 C\345\253h\351.\372ui\252\252\323\361\334\277\373\375\323s{\335\216[\243}\310\336\310\217|\352\200\026&\335=J\325\216\244_\260\352\274\024\222\335M\243\256\031\352u\0061\212\2105\347\243\226|d\214Z\300\020T\221\031M\363\372*zJU\275n\334\315\353\354\004\213\316C\321^d\246\323ga\244D\324{]\f\342\353,\211\365\2477\355\235f5X\273w\242\235\310\356\336+\372)\266(\025\365\272\373\346u/\274){\034\373\031\370\n\303\027\202A\316\337\206|\026\371A=\346\327\t\br\310\017\342a\233\277\255\f2\357P|\371\223o\007\217\235\226"
+	.ascii	"\225\2747\177\356\021\214H\335\251\217\243\004\276\031\274\236"
+	.ascii	"z\r\225/\206\024\234_\212\362\243\316\207\272\ry%=\277\355\356"
+	.ascii	"|\347A\354\376i\220\244\004\b\021\207\t\360\365L\263\334\\\220"
+	.ascii	"\363\267\343QO.\2738\333\344\244\335?\270\341\353-#\355\316\324"
+	.ascii	"\2712s\356\030\316\215\021\347\302\320\271b87\f\347\202\317="
+	.ascii	"2\036\0210W\245\265b\261V\335y\317K\304\207\326\bp\035\270 l"
+	.ascii	"`\240\263\341\225C\340%k\311z\352\272"
+	.string	"rH\300t<\270Z\037tV<;-\020+W\254g\225\203`a!^\261\225\f\006\213\255F\034yF\262!\331&\025\005\3653\275\206\212K\024*\3627|>x\225\223\026\006\006\3170S\2317\257,\204\363\312\023\250\374L_\224\243\312\022H\332\335Mg\3709\005\257<\303\017\222A\237|3x2\274\177\322\341\345\003\276N(7,0,\023\303\224G\032\303\367\022\304c\337\204\207CL\250a,\205\030S\312\220\210H \024\264\005\327`\002!dv\036\021\260\261E\307\205\2159e:(?\032\204\210{+\326\222\333R\322\326\226\032C\362'\3129\331r\266T\007\252\r)v\275\234\360g\007%;w`L\214\207\265E\3261\004\316LL\241\245\353\344V\322\251\232\3165\3426\316!\254r\027\356\n\240\007L\270\260k\337\334)\302iQ\211\240\3728\"q\265\202:H\002\032&\276\350\007,\206\364\264\251"
+	.ascii	"\f\345CVZ\247\322&E\312\304\017\211Z\001J\247\337\371\260b\t"
+	.ascii	"^\"p\255\230q\031\221cY\005{\233\224N\005"
+	.text
+	.section	.gnu.lto_loadDebug.192.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\303\001\335\020"
+	.string	"\266\237oG\340\320(\035\200"
+	.string	"\207\206~6f\2267\001(\270\001\302]\275\241\0020\205R\016\3027PJx\021\202'0\327L\233\336\\\231\345\254\303\351\375\017\303\f\353"
+	.string	"?@8\363\237\371l\210r"
+	.string	"\177\214\235\345[\362\367\226;\245Z"
+	.string	"V"
+	.string	"^"
+	.ascii	"\006_`\364I\372\200\321\247a\366\216\003(\033C\321\020\211\200"
+	.ascii	"!\264\273\235\242"
+	.string	"\260\274\004o\031a\237R#\314\267\271t\t\272\315\276\330\247\004`\233!\021\340C\221\rZrl\257=\252|'Q\312\260\\_\373t\t\3121\373X\036\271\220\335u\234}+\367\350\266=\333\026\354\017\0056\367\232\177\236v\307\030}\322\207\215\216\357A=\273#nE\3533wV\234\366\333\367vP>\350\327\\\362j\240l\373.\376\002v\232y\276+\373\024!\232\"\036\273k\372t\005\322'\210|\311\366nP\217\366[\234\006\366\032\223\013\330}\271\241\263\0132\360\211\364\031'\361f\375\321\234\227\201\037\267>\203\344\201\f\217\303G\212\030\223\321\247\322\230\365\260\375\3418/\322\356F\360o\036\203\304\217\371t\207\222\370\331\247_\242\tT\354\310\342\315\307\tC\325\226\034\233\214\332\364\323>\301\204,\206~\355\222\305\t\005\341\020\216\215\241\r\306\242\302\330\267m\246E\307\372\022#7\204\225\004\021\007*\021\326\211"
+	.ascii	"\313Ky\257\351\325\311CKua\225\302\240\3524\214\2442t+\327\253"
+	.ascii	";!pk\003\313\325y\255\226\253+\201{}\261\315\237\022\336|dz2"
+	.ascii	"\025\306\234\r\345T\201\242\351QU\3143\212J\001\bD$\352\211\032"
+	.ascii	"\"\213\341\345\356\256\344\364\264\203,xTN\037\242D& `\002)\264"
+	.ascii	"\302\035\345\215\300\324\023\002\006\033\002\267\027m\310^\306"
+	.ascii	"\033\364.\364\215\337X\315*\241\244\020=\312C,\206!\362G\260"
+	.ascii	"\326\226\313\302\373\336\\\001/W\364>!6\331\373\026o\033\246"
+	.ascii	"5Y\b\262\312Bc8\021\337\273\022\264\313\260\210\367\212=\036"
+	.ascii	"H\"\246\313<\001"
+	.text
+	.section	.gnu.lto_writeIntraDebug.193.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\305\t"
+	.string	"\326RE=\020\0059\035\b\360\035\250"
+	.string	"x*\377m\213\fW\304\006\220W8\035\301t\372}\030\373\307\022v\353\217\031EE\275\323\272\032\001"
+	.string	"\212Px,+\323\252ZP\260\2179\257-m\262wJ\0011"
+	.string	"2"
+	.string	"4"
+	.string	".o\260\275r'\330^-\332:\007\253\035\031^ \0372\261\335\365h\312\305O\321\377\353\001$k\374\364@\354\256'\311\032\271\351m'\330\216\260\275\023\327vwM[\366]\377\234\323\257\0029!\254\307nvEf\001\026VkXl\377c\237V@\237\366[\356\"\336\225\372\300n+F\263[.\270\343^\003\267\315vj_\230\346I\177NVt\264\037\303q\322F\035\006\203\333\365"
+	.string	"\275lhp*\257~j{=\2553$\211j\316\254 +\301\331\t\300.\307IQ\354v\370\036H\r\"\322\250+8\225Fa\210\372<\376\272\fP4\361\205(D^I\"T\341}\241\311\353\020\fZ\214B\357\004\202\241\367)\367\332\322\2269\231\tLE;\314M-\f"
+	.ascii	"7w\002K=\231\320\n\016L\\</\361a\202({\301\335e\224o5\032\334"
+	.ascii	"\345E;\311"
+	.text
+	.section	.gnu.lto_writeInterDebug.194.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`@\001\235\r"
+	.string	"V\231ZC \217\223\016\300\241\211\351\334\224\0018<>\f\371\247\212GZ5\256j\221XS|R\001\264p\277\365\365\274\204\021s\004\021q\351\331\242\001"
+	.string	"\f"
+	.string	"\005\360\211)G5\203\300\325\372\350\264n\304\222\275\245L)E"
+	.string	"D"
+	.string	"K"
+	.ascii	"\366S.\242t\025\322\001\354\242T.\273\037\002c\327\243\277\017"
+	.ascii	"\260\036\257\007\260\036]\262ct.\254)"
+	.string	"\301\b\f',\252\335\315\264\303K\317\222\177\022\337x'\323S\343`w\235\336I\303\255\267m\3006\004\373%\002/%\271\362\201\031\020/6e\330\237)\225\203}\270\273kE\331W\3715\377~\013\246!L\253\2463\323\337h\300H\235\256Z\355fX\315\330\230\370\362\301\3669v\207\362\221:\033k\262\222\362\340z\354<\216go\341\342\3212\022\202j\311\260\220\260\302\343\3325i\341B$\353Q\265\003s\025\024<\373\343)B\256\335\345@Qa\273R$J@\306CY\371\t\222kw\031\370&\316\022\301O=Z4\312{\217\376\310z\314\033\306z\274\336\205\207\235\310\003\002\275@k\320\241\340\323\001\302\004t\" \216\033i\032k\330\204\355\363\241y@>\231H\310\023\222i\234(\303\nx\033\001qY\267m\\\306\371\366p\025\345k&DL\211Z\260F\302TU\250\266\006\312{\346l8Q\223\035\035"
+	.string	"7w\002K=\231\320\230\027\030\217\024kB\213\312\260\250\bpG\031\b\271\212\360%\0040\005\334\0016\277*\307N'"
+	.string	"\2272\350\036X6\325\276\326\265~0\013"
+	.ascii	"\027>Z\030\017\230\bB\315\006wy\321N2"
+	.text
+	.section	.gnu.lto_loadValuesDebug.195.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\323\003e\032"
+	.string	"\306\260\247I\300VQ:d\261Y;\033\324\331L\266\210\330,.\004QTw\"\332\241\363\215d\323\357\301\322t-\216\305\210\\S|\243\327K\343IR\374&\273\335\262X\266\237"
+	.string	"\340\2672\003\231Z`\220B\201b\035 \237\354\275wJ\001\216"
+	.string	"\220"
+	.string	"\217"
+	.string	"J5[\365z\333f\253lY\026\226D\3521P\263>IB\026\304W\031\025\326\245}\"?\262]g\3426\273EX\224\354\352\0248G|\265N|\220\013\261\331\276\n?cn\301\321\020\n%.\273\273\272y\201\360\225~@\370:q\230\236\352n*m\257tJ\233\237t\n\267.Xp\271\023\2574\365#\264\003@\356\207>\b\002{\357]\006\345n\222\366x\361\371\336\253\r+Q\270\334\213\313\224\204\335\265\304\345Z\334\341m\317lk\260\347\226\274\273\036\351\247\327\3752\224~M\200*\273\334\273T\331\025\212\372\262P\265\307\343\274\337\276\317t\236\337\263\312\266\332\213\370H\236\344J\01689\331]\325\223\355N\033\203U\345\237\234\354\223Dk\243\002\270\031\304\335\n\226\224\337!\365\314\020\255"
+	.string	"\025MGh5\373\333\263"
+	.string	"\036\r\001wu8\257\264\023,*\337T\373\021\232\316\336\005\321\220\025\300Wc\020_iF\2543]\311_\242\335`\331_\252\335\210}\337\026\373\024\\\206\b\001w\027\347\325\027\036\034|\035>-|\215\231\017\2221\312(\247\346\2478\017\364C\336P\302p\246\346\201|\334d\224\353\f\347\364\241\bs\246`\217\337\\j\362\223\233\306\371y\217@4\366N\201 \b\322\370\255\222\333@\005\207\246\354\355\013\377D\347w\237o\372\315x&\262\343\354\235\373<\210\273>\r\226\224"
+	.ascii	"!\3520\021\276~R-8\030\243\214\262\252\306J/\266\356&\247\221"
+	.ascii	"\375\0079\202@\317\"\233\246J\317HiUJZF\224\216\241\322bJ:\225"
+	.ascii	"\222\016\0373\036\0210W\255\265b\261V\335\271\354%\342CkDh\007"
+	.ascii	".\b\033\030\350lx\345\020x\315Z"
+	.string	"3Y\265+\207\004L\307\203\253\365Ag\305\263\323\002\261r\305d\253\234\003\206\205x\305V3\030,\266R\331\266n\374,\272\031\347\355i\327\364'\335\006*L\020\250\3619\202@~u\0329F\306\244\231\363\212\304y\235An\362:'\\\361\221A)5\352\2240\322\335]J3\317K\360:i\346\201fP\246 \215\337\314\364\243tx\365\204\2572\n.K\314\234\221\231t\252\250\314<\030 \037\376\023\236K\250a,\204\230b\b!\021\221@H\264\005\327`\002!c\266\036\021\2405U\307\205\2159e\"SN\321\354\317\21164\267\214\2647\341\313\360N4\3129\205tvn\037\020nS\251\236\353\371I\007T\246y@A\020\016\277\314\335a/\234\244\230aF~\313keLy\224-\r\025x\207\315\nw\311]\027\030\200\t\027v\3337\020E\222\265/\021V\037\220\n\2566@\007\254\322\322\225\nc"
+	.ascii	"?\244\320\265.\260\216\337\262\036:\025L\212\326\023\032\022"
+	.ascii	"n\301\365'\304\323ZQ\357d2\2702\314\274\214\270\261\261\002:"
+	.ascii	"L\311\373\003"
+	.text
+	.section	.gnu.lto_loadMotors.196.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\372\001-\022"
+	.string	"\346bxG\340\320(\035Q\243\310z\2535`\177$21\310\221TYU\355\013\354AU\307'n\002\363\273q\366\021\377\264\343l\2053\330\217=\323\366s0\306\270\005F\030E\021!g\325QAa\351!\360)k\321\337[\312\224\002d"
+	.string	"\\"
+	.string	"g"
+	.ascii	"{\023\343\305\356"
+	.string	"\255\201Q\245G\337n\200\364X:\001\322\243av\r\004\262eQ\331r^P\340\330\335\224zp\200\303\333\r\023\366\b5a\276\355\320fgcFcy\204\0352\231\020\002h2\030\262\323\001=\367\214\241\265$\034As}\356\321f'4\243\321<;Dv\3279\243\315\334\244\333N\261]\301NU,\2518\366Crv:\353\215m\372\316_:\356\2161\raZ5\235\231\376\311\203F\215\366\335\317\256L/\307\022E \021\307\375\366?\025*\377\346\347|\372|T\266}\023?\001;\316A\337\231=\f\016\033\b\335\356\202<\232B\351\361\003\376d\177:\252\247\375\022\327\201}g\345\0036pw\027\232\364\270\1770xT\223\336\205CK\366\034u\274\240\242T\026\026\016\314p\311W\230<\360A9\361\310\251\255\314nh\252\266p\031\262\375z\217\177J\273\033\342\2478\217\313\257=\032\303\227\237=\372\237*\370"
+	.ascii	"\024\313\236\337\303\023R\345\021\222\321\324 ?\356\022:\304"
+	.ascii	"\362\310\317\035\222\250Y\300\013*\332<\262o\001%7\004V\004\022"
+	.ascii	"\007#$-T\201\326k\365\372\242Y\250\f\256\021\023\326\352\302"
+	.ascii	"H\n\245du\222b\251|)T\002\273RZ*\251\227\313\245\222:\335\366"
+	.ascii	"zc\333\017\303\203A\024\323\226\2508>\031\251I\325(A\0365&*\324"
+	.ascii	"\tC\032rgU\250\177\341\335\305\177V~\315\254V~\326\"=\252\002"
+	.ascii	"\330\020\313\236\214\232\250\"\261<z) `\002!\303v\003\345\215"
+	.ascii	"@\255\027\026\370\355\bk6\364']\203\263%\205\255\342,\317%\270"
+	.ascii	"7p\236\320\214\322\342\n\327,\210`\rZ&\022\315\023L\211x\201"
+	.ascii	"\n\031\227\027\330?3\031{LX\262\373\260\302\315\302d3\272\226"
+	.ascii	"\325\n\3020'\276o\345\025\227I\021\333\212\005?0DL\227y\002"
+	.text
+	.section	.gnu.lto_writeIntraMotors.197.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\330\002\355\025"
+	.string	"&\351\215J\300\360*\035k\242\344\212\220\031\277\223L\216\221\241\236\337\227Cf\373=\225\032\241\007D\367\251\177\243\312\334\nw\r\213\203\f\321\375\261\370\032\227sL\232\246\302.s\3158X\234\276\2043\212\375\036\017(\032\351\212\032\331D\356\224\002w"
+	.string	"p"
+	.string	"|"
+	.string	"\224\204|\312\256mx}\332/q \333\203f.R+O\216\026\265\002Yn\235N\r|\200\362\364\364Uyj\233MC\200\256\336\020\374~jP\340\250\265\272\026\204S'\20179m\247\344N\233\377;\271\243c\310\353\335NI\223\016'\004HOG\232(\025\211\027~\336\364h&9B\347{\341\351\216\261\006\257\247\363iB\251\265z\362z9wy\3330\266\035\330\033\022\313B\"\342\346\321\006\226n\310\250\323h\003os}\366Mz\224\212^\036{\365\240?\344\301[E\247?\312\351\024\235\366\240\323\2509}\242\323\2469]\222\323t\247\311\235\336\235\236s\372#"
+	.string	"ld\350\3358\254\025\347\250\243\036Q\342\317\203\277\375\232\357\345\003}\241S\265\017/\333\276\211\237\260=\350\242\327\234z\033\034?\240b\255\365\300\251\033\234\036\262\013]\234\234\366B$b\271\246}\315\322\204\023\311ZC\005\312m!\021\205\226v\254\201\267\357\020\206\256\267\353{\360'\035p\323\350\013O\222\360\200A\td\322\265c\024\346y&\311\355\315\344\322e\355\214p\363\270\344~'\202\346*\276\302D\276\217[<4\317\363Py\272\213\322\360\235Kw\354\212\270y,\271\220\2145\243\326\234\211\355\362\341\354Tk\356\225\"\202\005\002=>\247\376L2\267\002\330\002\226\004+,\261\326H\314K\214F\273"
+	.string	"3\031\326\222\231\255\310`*\025V\\/-*..\030\255\346j\r\360\f&Fs\305\314f4W\nX\277<\376\357\2679\366\216pKC\327\347T\322\256v\223\346\215j?\226\201Qn*9\265\037E\177\361"
+	.ascii	"BJJy\232\212\2412\nn\032O\326Z+\271\332\007ORr\325\256\366;\016"
+	.ascii	"\264\270d\024\231\036kKPA\255i=\366,N\213\"\0069 p\002!\262\331"
+	.ascii	"\003\347\235\300\327\223\016\374\036a\261~\177+]\343B\035\017"
+	.ascii	"\371\005\2565\351\332\302^s\3725\214\266\033\240\260f@\002R?"
+	.ascii	"X\335\344\202e\032\207\256\271vf\202\002\350\273\020\305\371"
+	.ascii	"a@\004\037\016\233\254\026\214#~\223\026|\003\361\355\313\275"
+	.ascii	"\253Z\355\314\202\225\307\026\021\013?\316\017\037\330`\321\320"
+	.ascii	";G\371S\204\275Z\350\206\330\004O\356\267W\272v\221\023\001\261"
+	.ascii	"b7\036\020\021\323E\237"
+	.text
+	.section	.gnu.lto_writeInterMotors.198.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`o\001\245\016"
+	.string	"\226[aD\020\221\223\016\343;H\342"
+	.string	"\315%X\nh\312z\216\336\347k"
+	.string	"E\350_e,\022\335"
+	.string	"\210q\fD\372G\336\260\225\317\354h\021\264M\372\223\256x\337\215\300GI\021\036\305\002\216\267\305\304\224\021\2647\2212\245L"
+	.string	"I"
+	.string	"P"
+	.string	"\020\260C.G\310\323\376\210\273\244\376\202\272\200\335\226\0352\273_\002\177\260C\177'\020\017\261\017\210\207N\3316<\027\266S@\202\205\352\204\216\335\315\024\304S\317\224\377\022\347x\253\356\371\361`w\235\336*\303\255\267}\300v\004\3737\002\320?\211\207W\316\206\225l\031A\213C\215M\036\366\327\245~\260\177\355\356Z[\354\277\374\234\177?\026\3231\246!L_WZ5\235\231~\007"
+	.string	"\016\326\35274v1\264n\266\006\316\210\260\375\216m\352>\224'\300\262\300\270\004\032m`\230dD\260]\226\230\322\b*\036B\365\320\374\005\212g\203\356B\013i\241\"\302X)\361\360\322\0026\236\006\024_\221\202\355n\003?\305UP\360Y\207.\031\215\342a\3364\361P\3653B\314\\S\257\352\341\303\334\204\211\317\362v\222\367\036'\023\210t\231\201\346\200dA\210D\364\0019\225D\034\207\242}X\373\250l\241\221\006\"\205\262R\t\310$\3238S\3661\340\255\202\210\313N\333\306e\235o\177\255\266\030ku\250YQ\013\006\311\324K\241F\265%L\310{\356xPig_F\f\221\030\322H\f\037"
+	.ascii	"7w\002K=\231\320\225\027\230\270\360\2422,*\002\334Q\006B\256"
+	.ascii	"\"|\t\001L\001w\200\315\257\312\261\263\355\251\2750KKt\357T"
+	.ascii	"\213Z\027\314\231\325Z\345\313e\215\204Z\005q\341\250\205\241"
+	.ascii	"\201\341 \324@p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_loadValuesMotors.199.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\377\003u\033"
+	.string	"Fr\255H\260VU:\244\345\261\334H\036\217p\004TB\311 I\304\251\247qR\024\306\314\210\020\254\360\232\351\3733I\264\263fB\366\037\236R\036\\S\377~\362\376b\373\342\237\225S\322\214\362\327\351\022<\022\243\246\244\221M\244L2\225"
+	.string	"\224"
+	.string	"\226"
+	.string	"6\237\232\341J6U\325\347Uo\252*\325\331\025\327\"\361\034\020\320=I40\224\237\263\237\353\253z%?\272\235\247\3424\335Ea\234\272y\f\364\246\374T^y\344Hn\252\301\013>\270]\203#\037\220R\230\356n\325\334"
+	.string	"\3719\236"
+	.ascii	"\371\311<\364\305\217\274\353\270\267\317\221\367\246O\272\205"
+	.ascii	"\034\031\237n\267\342sD\371\b\001Y\355|\306\b\304!\360\300o\320"
+	.ascii	".\267\243\020\031\347\003?ul)\352v2\276(\n\335\255\253\333\301"
+	.ascii	"\270\222W\325\231\252rP\035\023\004\253\345\177W\324\221~\362"
+	.ascii	"\274\177\242Vy\256.\271\372\001,0\275\335\311,u\013\025\307\364"
+	.ascii	"\323\004\006\371\357W\275\236\351?=PUz\263}\211\336\311\237\334"
+	.ascii	"\tA\227)\335\255\362\335\016\245k\270\346\336\007E"
+	.string	"\203;\3244-\206\275\241\354\271p\355\276\207\30433\324\003Z45\251\tha\377\305\360\3107\354\346\331|\326V\270\306}\223\355Mj8\375\030CI\\\f?UC\371Y3r\235\351J\372\245\332\016\227\352\227lg\242\3017\214>\2130I\204\206\335\0356p[\324\0243\003\340\377\024\331k\025\262\344\024\377gHn\213\212\342\2229\bT\206\211(D\310KR|v\2546\377\357\023\206p\300\217F\210\024\020s\b\357t\232'\342\r-\313\367\221\374\036\363\233^\203;\025\023\327\251\276>\005Vv\367<\220B\213\225?T\360\370E7\343\274|\2402\372(\017\202\320\377\320\034\235\275N\207\374<\257|\320\300mQUD\275bTy\271e#\325G\350A\034*\027\251\262\346\352jW\003\224\2533\251U\325\270\n\240\\M\225\0014\022'd\260i{\315f\257\231\363\235\330\t\021/\024\244B\200I\370\340"
+	.string	"\347C\354\246@\214\366\242\355L\205\335\244\220\341\350\300^\"pZ$r^#Z\260\331N\353\006\201\312J\304f-\232L6k\251x\270s\321r\r\216s\276^\323\237t\232\247\"\221'\334{\020\215\b'\033i\312\006\263\230\271\254\315Q\034\204\342\345\nXz\226\230\205\b\305\024pcw\367\310\342\377\026\034\305,\376\017\216\221\211\230C\270b}\026\017\034x\310\317\275\242\363\242\342\325\f\223\034`\234\341\223\371\031\222\263\022\242\303k\344\247\212\037\024Q\250a(\245\230R\314\220\210H0#m\3015`\002)cv\033\021\320\265TF\205\2159ez0\244p\205\374<\276"
+	.string	"\t\002\3018b\215\2561T\322\2644\007\336\316\326\352\2600\027\345\326{'\274\335yd\371\016\213\204\213\220\215\325/|%,\274\270#F\334\342p\037AO{\365\f\346\001\r\265\303h\017\355\370\037\300\"R\370\244\203IoaC\030\267\2647;G\310Z\323\210@sx\243\\}\2478\270"
+	.string	"Z1H\321\004\354\217t\032\351"
+	.string	"\233\367\301Vt\244R\223\"\312\304\263\004\241"
+	.ascii	"\372\323L~S\261\t11\260\267\224\f\203|\027k)\240\267I\351i"
+	.text
+	.section	.gnu.lto_loadTailServo.200.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\225\n"
+	.string	"\206\323HA \347(\035\360\344\202\"7\240wL6\321\362\t\240\333\320:\332\003\250~\036\260\n"
+	.string	"\207Q+X\255a\307\321i\rb8\306\362\207\251"
+	.string	"\204\201"
+	.string	"\034\324\246AM\025i\\\247\240\264D\020\267\335;\2453"
+	.string	"3"
+	.string	"8"
+	.string	"\257&\357\240\275no\320^-\332\n\036L6\365y\0358\271i\260\273\035e\271\370)\372\177=a\\\245>\0216v\327s\\\251\334\364\266'ls\330\207\bt\305>gw\327\224e\337\365\3239\375\2720CY\375\301\202\335\224\322\301\306*\354\305\366;6\b\363\371\264\037s\031\361.\324\031vY\262\001\273d\205\271-\245\013"
+	.string	"\246\021\205\226\026J{\235\tF\0063\267\t\267\335\315\360i^S\362[\257&9\315\217\257\376I{\255w\001\355\3654\302\005\246\232\245)J\002\bv\316l25\003\306\3604F\026\241\221\210\363\210H RX\355q\246/\344\341\201>B]H\007\b\244\363\300\260\343$\374\211\210\300\216\364}`\327!\367\234\245,o\245\201\230\212\226\370T@\350\221\371{\200\021"
+	.ascii	"57\002K=\231\241\265\n\214\013^\253!Y\235:e,\306\236\371\231"
+	.ascii	"\210\3128\253\205\256\203\205w\031\345[\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_writeIntraTailServo.201.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\255\n"
+	.string	"&\225K<\0201\324t\340\327HtF\003Q\001,\200\375\234\300"
+	.string	"\252\200\373\t\004@\022\330\250\274m\254\303L\213\263E#\261,\021"
+	.string	"\250"
+	.string	"\205>$yYqX\032\2443\226\337\bq#)S\n8"
+	.string	"6"
+	.string	"<"
+	.string	"\273\240\304\227\365h\360\006\252G\353\004\252Gw\366\351"
+	.string	"\207\365\034\220N\240\0266v\027\323\021\357\236\235\177\322\001\204D\336\3631aw\235!\321\207[o{\201m\n\366\021\0047l\320K\025a\337\261\273k\375\354\217\376\250i\325tf\372\017\001)\027\242\247\302]\017!jM\261d\302\366!\366\006b\362\264\177\342(\272\2178\037\260\373\241^\004\037\365\314}\251\252\222\016!<\031\372\232zP\312\366S\234E\206\210\214\335O\004[\363\025\033k\3673Q\301i`@\242\304\243\317\251\036\343\r\243z\274Ff\224:\031\272AH#\306f\206\220I\270<\250\\,W\001.c\331\266M\366pvm\320*\0262\312\205\n\226\251@\301`\331\246\301\256\004\3260X6\214\323\264\r\203\200{\307\352g+\254a\352\250\307\001R\325\306h\371\220\025\004\r"
+	.ascii	"7w\002K\275\231\320%\216\361\326\030\232\b\233\020\002\307\304"
+	.ascii	"#\360\005r.c\177\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_writeInterTailServo.202.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\001\001m\f"
+	.string	"\366\027VC\020\2176\0353\027b\201]\002 \002\264\"\206\006\355D\036"
+	.string	"\274T\033\253\252k/\200g\206\026\033\365.B\355\373\332\227\351\267o\376\377\177]]%L\220\226\220\037[\326D\267\213G\302\260-m\"eJ\001@"
+	.string	"="
+	.string	"H"
+	.string	"\334SB\027\260[:\231\330\3758|Y\207\376^\240:\264>\240:4g\257\320\250\260\335\202\020\247\223\225\227\335\305T\303\271'\347_\3041F\244\356\211y\260\273\316\021\t\303\255\267\215\300v\004\373\242\251\031\354S\273\273\326\222\375\357\267\236\362c4\r5MeZ5\235\231~\006@TAzd\261{!\236\266\005\232:\330~\206\275y_H#\300z*,\020\254C\317\213\307\323\376\207\203\b\n\225\303\202\007QF\253R%<\037(,\235\222\016\027\325\217\r\246k\352O^\250\234\204g\303e\327k`\177\276Bb\355z\036#FJ\022\240p8\364C\325!\274OT\207\327\215\024&\223\214V\020]\240\330la\177]\240\217&\2042\203\314\001H\307\006\204s\021"
+	.string	"u8\333F\222a\234]\024\264\315\204L\023\262\301:\0224\"X\266}\260\313\200\265\021\316\206\2014m\3032\276=\265Z\262\025c\213\211\212\234I\250\266\210\226\037\371\200\247\235)\315\024"
+	.string	"7w\002K=\231\320\236\027X\270\240"
+	.ascii	"\231\3401\210\031\b\256]kB,81\313bV\223\375\326\023.l\2640\036"
+	.ascii	"0\021\204\232\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_loadValuesTailServo.203.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\005\f"
+	.string	"\366\025RB"
+	.string	"Q5\035\217\f\377\022\230\360\264~\315\251\206\226\307\333\215\246\352\201bYY\317\007n3\007\364\374W\tF|\226\240\351\030A\242v\351\313\317\203\240&|\200\003\354\033XX\017\3018\"\212\264\311\336)\005<"
+	.string	"?"
+	.string	"?"
+	.string	".7\333>\212\247 \355\217\t&\222\212A\214\016\247\030\216\335\355\020\234\200\366\232}\200\366JK\234\374$\375\303.\301\204\252\221R\215>%\021v\3273\245Z\335\364\266\023\330\266`\277B\365\345\237e\323\223N_B\031\341Z\0355c\327\303H\216\005\251\036'l\223\366\304\356\200\\\346+d \300\226`!(l\257\035\031\227O\373*\276\202|)\272\200\335\226\b\214\335r\201\271\3555:R7N'\375iG\354.\302J\310n\t\202\335y\013q\333-9`\001\372\0240\341z\365E\332k\275?\264\327\323\212\r\017\322\034\261\205\365\201\306N\021\273\034MJ\302~\266\264e\377\365\007\"\370\331x \315\017>\214\246AF\003r\024p\364F\261\372\3436\204\031\f\237\267\311t\031.x\234\356\363\210\035w\300\241\006\320\323\215a\350\351&\345\336Vp\214\b\022\345`\013\013\304\244\376\213\221\003 \304\017\005\025"
+	.ascii	"57\002K=\231\001aX\216\305\217\343\316\020=\230\260\303\265&"
+	.ascii	"\304\202\007\263,f5\335o=\027\362%\315J\311\330\016\n\257P\363"
+	.ascii	"\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_loadAttitude.204.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\317\001\365\020"
+	.string	"\326\037oG\340\262(\035\300\022\320(\274I\241\242\320\303\305\304\\ZQ6h\2434\244\321I\230e \f-,-\b\210\377\232v9|\373\220\331\241\257\376\300\f3\324\034\347\244{\202\212Z\201#\3560\361\375\317(F\332&R\246\024Y"
+	.string	"W"
+	.string	"]"
+	.string	"6\211\036\035\276@\350Qt\002\241G\307\354\037\006VVv\322i\371\020\343gw?\215\261\276\013\357.c\217\235f\314\367P6\357p\264\0365\233\354\261\023\260\273"
+	.string	"l+\035\203d\261\251d\207\342\345\372\233G\034\355F\315\366\362\364P\273\353\254\331\\\356\320m\303lW\2603\006\273k\205\261\275\327\374\361\271;3}\221HL\b\227\323pv[\202\206lO\3349\361\334o\277\245\342\344\207\376\215G\255\025'\333\376\213\303\210=\347\034_\227=\210\037\035\021@v\227\364h\n\242\307\221\356#\273e\342\364\264\337\342.b\257I\371\200]\030\036\034\273a)AV\037j\003<`\362\032/\021\r\330I"
+	.ascii	"\231\231\224\320\243\362\250\005\261\315\3419`\t\202\335\372"
+	.ascii	"\214W\002\231\335u \3438\031\374\231Gk@\311\327\036}\224\320"
+	.ascii	"\343\265Tbg\226A~\316\215Fuwej\322\237\273\004\022\263\004\362"
+	.ascii	"o\336\321\334\024\334R\354\330\004\262CY*\316\3767%\367\203U"
+	.ascii	"\004\222\006*\022\226I\204\005K\301^\321+\323\006Pe\262JYP}\027"
+	.ascii	"JR'\337\312\365\372L\b\fb`\271>\030\b\272\276Q\270\377*\214m"
+	.ascii	"~\332\215E\317LU\242\342\354\351PO\325'IOe)=u\202O\207\024\302"
+	.ascii	"\223\212\232%\320\273\316\323\347>\262\340\251\236\336\303\b"
+	.ascii	"\225\f) `\0021f\352\001\345F\340\353\211\241S\024\203//\232\321"
+	.ascii	".F\355h\367\213`?B\t\306%\004\214+bY\265\262\265\261\211\332"
+	.ascii	"\310v\325\330\020\273\352\227e\354l\004\336\370\337Os\377{\333"
+	.ascii	"\342y\303\264&\207 \353-h\fW\3047\257\004\3552,\302\r\271\366"
+	.ascii	"6\007\004\244l\272\304\023"
+	.text
+	.section	.gnu.lto_writeIntraAttitude.205.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\225\t"
+	.string	"\246\322C:0\257\322\001 in8\301E\245n\344\250&\360\007\032\366U\016\003\246Hg\"\372F0\251\270\377\347\027\367)\355\214p\260h\300\002\366\243D\321\242\235s-\250\262a\267\275S\n1"
+	.string	"0"
+	.string	"3"
+	.string	"\345\0056\257\334\0036\257\026m\230\201\326\216\0074\217\f\025\231\335\365h\310\305O\321\277\311;\244k\374\344,\354\256'\351z\335\364\266\013l3\330\216\t\273\273\2461\373\263\177\316\351\327\217\210\354u\215\333\356\306mfk\265e\304\366=\366\211#\364i\237\344%\342g\253\003\354\306l,\273%\310\035\367\352?\265O\250y\322\236\217\026\035\355\247X\234\264UG\221\340v1B'\025\024\234\354\325_m^O\353\n\331\301\2327\033\300h/;mv9N\nb_\023N\370\024J\b\243\022\251\373\244L\2440T}\034\177\335\0048r\370D\017#\317\324 \202\360\276\020\345u\004\006#H\241\227\002\301\320\363\224{\315\322\230;0\227\032\213^\230\233\240\f"
+	.ascii	"7w\002K=\231\320\007\016\034\\</\361a\202({\301\335e\224o5\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_writeInterAttitude.206.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`4\002\225\022"
+	.string	"\326\343zG\320\360(\035\0029\224\037\021\244\035d\0133\202\342^\327^\230\355!\227\345\216\222\344\274A\244+\006D>L[=F\260\236\326C)\0318\354 wX\260VJ\300\332\244\350A\r\266\316\255\367\026\244\031\331F\366\2262\245e"
+	.string	"a"
+	.string	"e"
+	.ascii	"'d\377\251\371\200\335\236\336\213]]\211U\250G\353^\340{D\235"
+	.ascii	"\300\367h\231}C\344fg&D\036rvK\273\273R\016\326C\335\rS\366\b"
+	.ascii	"5e\376\t\005\3500\247\263\302v\233=B\220\335\025p\273\201\nR"
+	.ascii	"\347f\223\220\004\317\365\274\307\234M\311v\343y\236Pv\327i\273"
+	.ascii	"\355\334\337m\307lK\260\263\025\326\036;u\335\357\361\237\037"
+	.ascii	"\300w\367\247\351\250i\230i\325tf\372\001BB`\330\271\255\306"
+	.ascii	"n\206&\246=\212E\"\276\373\355\277z,?\205\317\363\307\213\211"
+	.ascii	"e\333\017\272\n\331w\206\361\335\331[X\"\002\201cwI\036\035\001"
+	.ascii	"\3658\002\377a\277\224t5\" [\013B\001\001\365\370\242\301z\332"
+	.ascii	"7\361/\256\274\315#5\235\031jj\324\017\341\214\260\311&\253\302"
+	.ascii	"\241\230\363\\L\2409Q=OS\237\263\3036\354-bL|vk\rl\231\013\315"
+	.ascii	"\240vk,\026.4\007|><\3725\337\343\325\244C\021-\233|!\234\f\325"
+	.ascii	"\335\235\251I\376\335O6\320\262\347\363\016K\340\020\340\214"
+	.ascii	"\2206{\266n\226\232\263\377\335\335-\217\311\244\270@3h9`Y\240"
+	.ascii	"\302\262\242\n\211\301\254\300`3\255\223[\252\n.\025\n\255\024"
+	.ascii	"\027\225\025LK\312\313\252\005\223Y\251\f\330\365Z\201\255b."
+	.ascii	"\027l\365\241\333\177\265\307@\377\005\\\216#\232\332D\315\371"
+	.ascii	"\024CS\252II\362OuJ\376\351\203\244Z\352\230\201\373\024\205"
+	.ascii	"\226\275C\230\322\357>\222\340\237\246\3648\032l\340\214\220"
+	.ascii	"<2\252\035* p\002!3\333\001\247\235\300\327\023C?(\306n.:\304"
+	.ascii	"._v\022\332\270\277\030e\253-3\330%\264/e\3738\253\216\350y\353"
+	.ascii	"\005\034b\271\231\001\210\220\202Y\320\333\210\332c\227\t\232"
+	.ascii	"\310\212\347\026\026;\371\003\\1\302\307\256\233\320\"4\206\203"
+	.ascii	"\310\300\3452\0327\260!\317\336v@\020\312\246k=\001"
+	.text
+	.section	.gnu.lto_loadValuesAttitude.207.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\316\003e\032"
+	.string	"Vp\247I\240\230Q:P\034\251\354\024\004\264\007\027\273_;\301\023\235h\037\360g\bpT\315\201=\025\240B\357\257\033\0232\035\324\371>\263\2404\365\217\247\213<\017\236\031'\346\220u\365\330y\322@9\216\"6\275\361\023B\366\226;\311\217"
+	.string	"\222"
+	.string	"\215"
+	.string	"\265\335\325\353wm\273\253]\036\"\255\251\344C@\246\201\226\210&\214\257<@Z\237\273\377q \266\357D|\246\373\250\224\352\336\335,\316\370\272\273\361<\336\303\266\353\223p#u\bx;H0a\351nV\315\007\204\257\364\002\302W\236\261|\272\373\322i{\245<m\373\245G\270\345\244\340t#^\251x\023\252\001@w\243\fJ`\357\275\317\234\356g\322\033*\316\357\275\306\230\022\304\351T|\212\017\272{'N7\364\r\277\273\263\335\275\260\313U\002[\257\364\323\357\376\031\316\275\f\215\215\244\241\347\236t\013\005\267\364T\355\3318\357\337\375\336\351\274}oWk\253=\310\236\310\213\\\312\200\023\026\335\275\212\262\335H\267h\325\371(#\353\233E=c\002\330\026F\250\023\2559\017\245\344\003S\324\001L<\r\241\311\364\257\217\002\310\333\001\354\336\331\274\322F\264\350\374S\355Ch9\375\024E>N"
+	.ascii	"_\267\302\370JCj\335\351L\373&\232\214\326\356\233j\027\262\276"
+	.ascii	"\367P\277\004\026\037B\300\356\266y]\ng\n\373\244=-|U\361sD\344"
+	.ascii	"\f\256\310\347\221\037\224c~\227\204!\213\374 \034?3\270\225"
+	.ascii	"Cf\037\211.w*o\374\270)\311M\307k\363\363\356\240\210\354\235"
+	.ascii	"\35202P\302\370\265\324g\246J\027Qn\376(\312\207:\377\3515\344"
+	.ascii	"\221\364\034\267\253s\337\206\261\033H\301\221\020\035\306$\021"
+	.ascii	"\341\353\231^\301\255 gpWF=\265\354\356~&#\355\236\001\215\022"
+	.ascii	"\270|\264\033S\347\302\314\271+q\356\3138WE\347\216\342\\Q\234"
+	.ascii	"\033\236\367\263\035\017\261W\255\271d2W\325y\017\314\003\007"
+	.ascii	"\327\207p\027\274\032`H\220\203\001\206C\003\233\271f=u_"
+	.string	"8 b9\033^.\0169\254\035\035W\007\326K\326\303\302)\2601\036\230\2145\213\305d\254\325\216<\037\325\220\374\023\005\365\364/}\006\212Q\226)\3624J\035\277\312H\253\"\342\030f*\323\346\225s7\257\f\201\n\320,\237\030U~@\322\356n\032\303\347\035x\345\030~\320\013\352T\302\370\301\360\236\211\006\230O\370:\233\340\254\250\030\346\205)\257\350\013\237K\020\216\275\222\235\f\001L\250a,\205\030S\312\220\210H \024\264\005\327`\002!dv\036\021\260\261E\307\205\2159e:(?\032\204\210{+\326\222\333R\322\326\226\032C\362'\3129\331r\266T\007\252\r)v\275\234\360g\007%;w`L\214\207\265E\3261\004\316LL\241\245\353\344V\322\251\232\3165\3426\316!\254r\027\356\n\240\007L\270\260k\337\334)\302iQ\211\240\3728\"q\265\202:H\002\032&\276\350\007,\206\364\264\251"
+	.ascii	"\f\345CVZ\247\322&E\312\304\017\211Z\001J\247\337\371\260b\t"
+	.ascii	"^\"p\255\230q\031\221cY\005{\233\224N\005"
+	.text
+	.section	.gnu.lto_blackboxMainEncoders.208.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\006\004\325\024"
+	.string	"\266 \177H\220\334i\306>]xa\233\203}i\334Y\2006\001\253vx\356\255\233937\307\032r\365\255\205E\332D\343\361gs\313C\b\022Ia7"
+	.string	"\"\210 \202\b\210\335\265\006,\216L\235\034P\326U\351!m\306]\373\222vk"
+	.string	"m"
+	.string	"j"
+	.string	"\242\205\323\300\005\224\007C\n!\203\206SmPC\262\335E&@\n?I\276\022}\266\374\222s0\305\016g\256\365\200\216\037\322\023"
+	.ascii	"\302~\375V\234\337\302\333\336\264{\023\371\025\337)\377\210"
+	.ascii	"\376Sy(\240 \007\275$\237"
+	.string	"\317m6\317\341\231\342\320\231#\201\352\266\211\364\300\200\355%\225u\326\353\371\276t\033x5\274\r\354\001\301\332Tm\016\324g\353H_\325\356P{|\313\207z\023\266\271\212\204^\360\261\362\277\350g\3750\305 'n\b\272\243\022I\305(v\275\311\202\257%\177\213\376\225\021S\334M\347\255uB\021\250O\251\330\202\305\252\202_\225oE\377Jy\253Z\004\t'\256\235\200&\240\220\212`\254\326o\r\340d\367'\344\241\340O\345S\351G)/\005@\0053iEF\373\376\026\236\341\243\345\257\321O;BRbJ\305(\226\307o\265\t\333]\214|\032\374\261|2\375\262\362P*V\234\270\315\002\335q\2216\330/T\030gc\250\341\325\336\252y\341\233\311\377\322?S\336J\206)\356\031g\256\245\201\216\273\206\220\337j\013\263\373\026y.\3746_\214\376\230\362drB\033\246\316\306q\366\004 \326\225\340\375"
+	.string	"a\022\304\317\030\242$\203F,44\352t@\236\210,4\216\340\361\204F\034\360H\036u&o\362)\247r,\f\316\345]\016\346Z/\363\256\203\035\315\325\334\354\366n\321E\261\340\246P@$v,$|\223\362U\322w\251\274L\367f8v\362\3542\364\201Y\372\002>\366\306\365\341k\224\357\t}\217\210\320\210\002[\250a@\203\261\221\022\031\005\306\205e\r0#!\2316\020(\202\324$\251\016\022]\265?"
+	.string	"Vt\006\027\331\243\230@\347\325\027\026\373\226\325K\376\r\f\257\315\230\324\350\262\236t\366\3656\277'\017\257T\016\367G\b\305Yp\351W\f\371j\354\327\200\311Z\347!"
+	.string	"1\300\301\f\005\346\rJ\244\"h\204\326\236\007\355\037"
+	.ascii	"\304\233H\n\342P\r \343\334\026\331f\342\364\374\013\022P\213"
+	.ascii	"\367H\300\311u\356]`\355\240\265\204\346\320t\317\275\253\342"
+	.ascii	"ycmy8\325]\034\264\177v="
+	.text
+	.section	.gnu.lto_blackboxCompileMainFields.212.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`q\013-?"
+	.string	"\nk\224\027DP^R\007\363<\336\270\275\234B!\372\332}\313\217=\271\203\304\213\f\321\254\375\207\351\370/U\362S\245\335\367D\f\250F\004\211H"
+	.ascii	"\032\002"
+	.string	"\3204\310=C\314\3050{\2436@\252\352dk\355\336;\311\224\002g\001[\001j\001y_\320\241\277S=\232\355]\332\263S>\360v\\\363\270^\3745\333\265\264o\361;@.^'u;\032\310X\033\273u-OG\224\333p\312\212\256\367t\374\345\355\360\213\343\230\304\320\337h_\263=K\373\\\264\215\334\216\264\354\240\210\241\277\355q6\272\215\376\272\303\2651J\246\351n\216E\352oH\036[c\327\021\230\025\364\213c7%\177[\303\320_#7\232m\346\334\355lnE\352m9\372\215c\262-^\034\2731u\323\320_\244\023\301\376f\027\202\375miw\234eVl\365\224\275\263\025\027\030\3071\363\221,-\371\364\321]7\357\344K=(\211\004\372\3619\032\213\304\241\020~\335\317\322v8w\317\210\360Q\275\254<\310u\001\005\257\270\266+\211\013\201\212\205\305\347\256r\022\353\310\253\003\271\001\306\306"
+	.ascii	"qm\327\325=\200\306\354\215\3379\201&]F\362\217+\314\342Z\342"
+	.ascii	"\332\2561\327\001\036?/\236\325\312>hV1?\032\205\024\210\177"
+	.ascii	"y\3279e\326\"^$Pf\rs\242k\273\302\232t\201\345a\223\256"
+	.string	"\257,\324v\021q\215\364\2662\234\305\374\r\342\256+\004V\267\346\307+\313]Z\343$\314\357<W\275\260\362\373\234\207\310\016\316)\263b=\013)\304q\334\231\352e\365\026\362n\207v\367\215\356\"\216&`\177*\2706X\031Ow\223\360\255\211\022X,\006lP\300a\330,kj|\r\r\330_\177%\266m\232\007\207(A\240C\373\241-\360bd\32344\236\256q\214\345\324\356\376\340Z\024.\267\215c,\007g\034M\n\327\323\374m\025P0\024\354o\201w\001\251B\374\316\223th^\016\256x\374\376\317\304\220\3609w\241\224\305\203N\270}\214\223q\266\247\3653Fvj\f\330_\003\327\277i\036\354$3AG\202\375\315%\220M\263`'\231\331\321\306Y\260\333\355*\377Y\267\273`\344\266\364\037\351~:\346^p\314\255\340\230;\201\023\223)\347N\3626w\244#\267\363.\020\300\361\274\213\226"
+	.string	"\\\316[I4\224s\013\021s\007\021s'sn$17\0201\367\2170\267\2171\367\221\230\333H\314]$:\235\367P\230[X\314\r\023s\277\303\334\3560\367\373\233w\026\346\366\346P\234:\253s\361\3051\327`\236\370\314\353\205\211\343\271\323\271\333\271\313\271\277y{\234\207\3516\266\r\337k\007\343O\260vkq\034\033\375\345\373\"\303\b\313-\366\022\236qia\013\364\230H\023\316\316g\303\277\310p\335b/\001p<\264\260\005\372\333T_\315v/\355zS`yU?\322\002\317\364\017Gk\354*[\374\371\3666QN\004E\377\363K\300\343\013\337\347]=ZO\212\177\374\345\336\326\036\343/m\235J\307\335\t\027\337\370\313=\255\261a\361_\273jX\037\232\225.f\304\304\020\275\317\205\357M\244R\262\226\211\032\330\273\234\245&c\t_"
+	.string	"\266\255J\236:\233\256q\034;\350\034g+\351\224\226V\221Z\221Z\201\375\215\260\375\313thRz\016 \232#C\227^\201\027|ns\327sWBuBv\307O\301'\370\005\357\236\307\365H\257T\260\220-\300\376*\370#\354\327'x\207\177\311\223\376\265\323\312\343a\334\257i\206\270\017-\260\256;u\340w>7z\037\376wok\317\364\202\343\301"
+	.ascii	"\013\271\023\370\276\307\365\271\247q\363\246E\370g\355\b`\367"
+	.ascii	"\275\f\351\377\335\317v[_Wy\260\27338\340\206\023X\f\3768\300"
+	.ascii	"k\330\2725:^\247\n\366\367_\331\327\006E\033\273q\317s\243=\367"
+	.ascii	"\253jnG\270\034\016.\364Vwf\214\r\216\307\351\340\001\004\b\021"
+	.ascii	"]5$\263&\211m\331\234\234O\317\223}hj?\307\227\345\005\377Yg"
+	.ascii	"\335\203P\325\366\270J\376\364\325\374J\356w\256AM\210\253\344"
+	.ascii	"\304\257\366\023}\273.\321\007\370j\373\373ge\274}\f"
+	.string	"\016\347\3176\r\301\365\257\017\r\fA\224\262\255\033\320\250\324\f\251(h\324Id\361\214\372\026N\365\214\212:\241O\341\fhU\324B\324\363\305\n(\350\363(\3455\236Q\320\f\305n\340|\300\242\271\202\305\263iHF\324\213\247\024\013\270\235M5\242+\\8\241^\254`B\245\240`0\235T2\230M\003::\365\244b\316\210F\251\230F\267\251\377\221\336\201\006xf\372WA\177\326\017\250 \217\336\347\334\203l1\262G\211\314\357p\356\\T#m\331\3058\321W\221`\345[\270SF\364\376\246|\227s\tVX\250$\217\336\3452\227+\377\350\335\347<\027\tc6\230\221]\340\273\273D&B\343\300\026,\207I\231\250I\2358\211K\276P\320\017q*\035\035\236\374\240\367\034$\371\023\260_f\b\210\035\321\003\362Y\376\360\253\355\372\f}V\362\341S\221\371\3713&*G\346\367\373\364E_\355#"
+	.string	"\342/\277\352Yw\325\302\216N\337\356\033\340\207\276Z\024\007\256\f\320#\337\245P\362\017\f\376\205\235\263z\001\375\021\266m*\024f\350\375m\371N\327E9\013\272\273\033\307q\354\343\032\227?\266\005\212\217\"\323\003\370j\267\223\321\324\221\340\241w\372\245\235\326\030\363\035\257\350\231\017\223\321\032\273\312\272\262\017\315\b\200\2470\315\202\371\250t'\334\203\307^\336Cc\006\307\310\364N\347FK\276\f\200\367\250a,\346\230R\210fDF\222$Ic\200\002\221!+\326\001\020P\247f&I:ob7\363;\210\275\274\373&^!\243\253\232\237\013\275\317\230| \221\222\245\200\274),\272\001~\360\035\212\355\240,\315\327\201<\375\304\234:/\317\263\262T<m:=\367\247\334\326\361\\Z\314\256\215eZ\\-e\201@I\310H\265\213\001\341\215Y_\227\177;'\004\252\275\317\210G"
+	.ascii	".!\353\3758\007\003jc=N\213\237\246\211o\274\007"
+	.string	"\177]\tAl`\223`\025\t[H(\212T\260f\216?\320\177s\254\373b*\261\343:\230l.\333\236\326\013ad\372Mb\216\250w\016\237nb\302\220_\212\366\205\022\343\021\246]\3313\352l\007\244\255\353\266\030\023G\352\2275\256M\215\2045\322\322\302\263\333\356\001@,\326\255\342\202\365\322\006\275\276N\336\316\021\032\020\325c\205i\020\331(d\273\307\306.\346\243{~\370=D\003_<\322\256`\335w3\230L\304z\227\305\355L\327\302x\305\304\214?\034;!\263\264\326\345O\343d\316c5m\024\027\274H\305\254\363]\352J3\241\202\247B\037\202\260\313\357\017F_YT \236\2718\027:I\023$\253\n\266Tb\365e+?\037Gz\3268\337\323\344\370O\357\302\022@\346\2427\301A_:@\273g^\021\032\2401\232\220\377n\2437\323=\243\331/.\367E\016\272l\bm\360+ \364\327"
+	.string	"\276q`u"
+	.ascii	"R\rv\256\256\227-\206N\310\225\352\302\200\322N8g@-~\251\343"
+	.ascii	"\316\323\372\362:\364U\021\274n\314\271T$_W\315\225)\301\360"
+	.ascii	";\275\311/\317\303zc\027\t\022\006\251\232\033\002\306\245\276"
+	.ascii	"\246\"\370A\340\3240\346w*'"
+	.ascii	"\004\251\250tzX\350\270\356#\t(q\331j\301\331{Zb\363w{\327\364"
+	.ascii	"e7\251I\230?"
+	.text
+	.section	.gnu.lto_writeIntraframe.214.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\263\be0"
+	.string	"\nS\024\022DP^N:\263\003\224\036#\366\363\013\313\275\037N\351w\213vP\221L]\224\036\266\336\232E\261q\244.\375o\372e#}\020\006@"
+	.string	"\bc\b\203\336\022\220\361\376q\025\363\365\031{\246\2735i\204\220\275\223\f\013\001\375"
+	.string	"\021\001w\240{J\037P\351\375\335\326\355fL\345\367\210\003\215{p\265\247\362\324Y\351\001\3630\355\351j\020\217@\351\b\346,\206\202\275z\314wS\256A}\356q}\271+ra\036\267e\274\252d\002\325\375/[\367\302\006:g\202\275j\345\006\252\357\326\207k\243\025\234-\347\322\376\255\243\317c\3718\366@\001\005s\316%\330\253\310\364\276\255\215Vf\240\236\345Z\332\263q\001\310~\371\316?\350\031\301\234\335\230\256\266\023{\265\335N`\275\312~h\275\332v\3171"
+	.ascii	"\226\273$@\367nt\331\223s~\302\317a\037\237\272\275S\334\236"
+	.ascii	"\310\016\327\242\232\342\333\366\207\032\220\222x\351:\361\350"
+	.ascii	"l\254\354\354\375\304\202\3501\357\260\250\006\344+\013\344E"
+	.ascii	"?\261\262\024\331\366#(bB\256\232\016\301\302\232\0049\301R\013"
+	.ascii	"\203\202x\207\373\325\341\364\272\251\032\331\361\341\356 \355"
+	.ascii	"\316\333\2339'\331\357PC\316\271o\3239\3666\276\273\313tw\213"
+	.ascii	"n\266E\370K\036\230\0237\323\377v\ffK\270\247S\316\376\304\273"
+	.ascii	"-\367\216\256\335(R\3347\033\371\205\273\272\301\263\315o\b\237"
+	.ascii	"\355Zf\313K\330t>.\f\1779g\013}3\337S\321_r\265\245\222\367\315"
+	.ascii	"\344zu\b\027\245\341-oa\3379,v|\354\344K\330\355\346u1Z\367-"
+	.ascii	" \031\024l"
+	.string	"|\244\233x\233\001{{\301\222\022\361\266\002\365v\322\3616\322\361\366\021\022\350\266\321z;\301\363\336EDg{\017\375\355-\364\333A\307\333@\307\333G\343m\243\361v\321x\233h\274\315>\372\036\376\366Z\274\255\022o\247\354m<\274}\327\333gz\022!a<\306N\344M\316a\205}r\237\212\347\344\321?\357\247\373\337~\266\367\347\236\327\327kc\267\217\366\311\264\227\216\2469\256\003t\356\311\326\305\364\361>\006BZ\037+9g#\224N\313\b\224z\017\245\323:\232e\001;\356\354f\210\005\f\360,\320C\336K\330E\370y}s\316]\303%\374\274\"\274T\246\204\037U\200\221X\t\337\017\263H\322M\302C\270\215\260\002|\357\236C\372\300pW#\341\213y]\213\245\231\204o\224)%}\357\255G\030\t\237\t\005\211\217\260\001<7\376\264Z^\247m\343@\242\215\360\003@\266hw\207\323\231\223"
+	.string	"7\245\341\351=\200\334sH\177\r\034.q+F\353\237\210L\213\225bW\255*\236z\013\354\007\036N\325\206\250\250\365\252\212\217\200A\332\376\264\347\236\237\212\321\032(\020\023a\034x\231.\204u\b\341\024G\241\371\272\203\215q\212\177\343\317\337\374\317C\177I\177"
+	.string	"q\337\004\261^\305\230\030dy\013\323\234\ta\r\313K\3704\347\234S\"\374\267#\233.\204\211\360\231E\274na\257u\236P?\004w\b\367\305\035\301\254[\304\333\214`s\376\242\320gc\203\004\273\004\013+\245\261-o\341\212\373a\261}WS\302\304\211\023\330\b\360r\317(\016TYRYX*\026\225\326\013)\031k\226\225\2262\251\272xWH^`1a\212\005\225S\322i@\226\025\325\325\225V\224P'\235h(\247\252\222R/\246\236\254\\H\301xJ^a=9\031\2652\006\325\325S\226Ry\365dt[>\304\235\035\037\301%\366\352\277j\355\007\336\037-Z\324\337\235\262 |\311z"
+	.ascii	"\341\276N\261 |\246\224#\006\302\007\3740\241\030\361\021\027"
+	.ascii	"\261\021\037\2102\361\210\270\210\r\310a\026\361\372z\363\255"
+	.ascii	",&\3423\371\274n\263Urq\334\034\3553\255U\242de\261\352\207I"
+	.string	"\305\313\307\375\272L\260\233\304\271\342\356~p\227\\\005\220\334.\334\245igy\013\013\271\330?+n\002\304\363CL\207H<\254\221\346|\226A\220\313-\354\006wX\341\357b>\330Fas^\276\331\337s>\255\223n\325\332(m\224\265\235\322Va\366\363\376\272:}d\324\330u\t\0135\327\352\212L/\302:\256\367\207\315\255\241Y\225\360\311\374;\346\326\232\024\231\216d\200\213p\024\337\002\034\200\276\250a4\307\024chdDDa\222$\215\001\220\002\021)*\363\021\2005t\246iR\031\346c\340\377 \005|\177\350\273\027Ca\361-v\017?|D\037)\356\2427\317\247}\017\274zxw5\n\217\315b\235\303\3531`\250\222i\225\227\221(s\245\025\r\216\203`\215\206\264z\275D\343\365\373\367\251\265\016\32385\266\322\024I\337\225\034%\370\036p(\227\264\242n#\267E\302u$\324\t\037\241"
+	.string	"\264\003\030\2445<\304\252l\\T,\227\313\036V]\"\276\245\367/\016\373\3771\244\031*\363\314\365\306\206qn\245\246\005\264R\201x\216*t\020\222\311\257\002c\204\034\307\242\347\244\212M\266\241\342\030\035\223Z\025\3045\212\200%\222\333vR\332z\f\211\303\227\003"
+	.string	"7\022\3123*m\310\271GkZ\367\332?o@O\215\262\005Mj\027u\305\213\"\243QMG\001\223\034?\b\353\224\370`\337&\2046\017\266\372D\213\0310\351\310\373\3576\265\304&\335g\265\224h\022"
+	.string	"=\315~\265\317\352\354\224\247\347U\305\004Z!( k\264\216\373\027\300\363'\254\366\345\002\217\"s\004c\n\3057D_H\354\343\004\344\312G\353\314G\203\302\361\330w\337\023z/\330(\314S\350w9\334Fu\371\0048\262\252\346\202>\243\005;\200#\253\234\202=\260\233b0\223"
+	.ascii	"\035\272W\213\211\337v\316\024\326\276\327b\376"
+	.text
+	.section	.gnu.lto_writeInterframe.215.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`i\tu2"
+	.string	"\332V\264\022E`\336Q:\363)\037\212\r\266\252\306\215\372\216\r\325\220y\214\007L_.\245-\"\231\341Y\367\243\276\2411\304\320\301\307\244\243\362\022\274\005>\005\037\302c\t\371\326\362\342\021\2768o\364\241~\373\277\021B\344N2\027\001\006\001\033\001D\200\250=\2314\032\235\343\006\21141\257\017c\003\275c\312[\324\031\217\304E=\315\362\001l{1|\266\203\301\36106\220\224\267h"
+	.ascii	"N\020\245r\301S\006\241\334a\r\001\362\317\370jXF\340\321\376"
+	.ascii	"e}\332\r\256\236\361\330\346,\356\3360\016\273\247\277{eV\022"
+	.ascii	"x/\337\302\357b\245\013\027n\376\026\357s\304\271\205yj\330="
+	.ascii	"\345o\301\341{\232\245\004\310|%\037\313\263\340\270\026n*u)"
+	.ascii	"\257\230j\f\322v\026\365\224\247vO\225.@}\212\036\200\372\324"
+	.ascii	"\372V\346;H^\227\013\330\004\373B\213\273\367R\265Y\312\277\243"
+	.ascii	"\312\363\256\327\363v:5E\273gW>\023RM\0279lb\\\347\335\031FV"
+	.ascii	"\346\313\356\226\214\024\307\256\323U-\225\025\311\256\242:/"
+	.ascii	"\260%CbC4\302\237'\363o]6u\342\343\250\256\352\355\n\216q\204"
+	.ascii	"r\330\304|\274\037\034{\317\031\366\003U\272\367\376\312\255"
+	.ascii	"\0161\241\265\272\252{/[\242X\361\354;3\257a\346\021\314\274"
+	.ascii	"\247o\243\265\273\367F\340\2579\033\021\374$Oy\004\t\022=udZ"
+	.ascii	"\271\332\215\326\220Ig\267\221\377\bG\376<{\274\245\276Qt\241"
+	.ascii	"\323e\3770\377\314\321l\361\223\260\211\023\366\304\023\375\203"
+	.ascii	"\033\013\3329>r\212\263\310r\333\271\2512[]\331\023Y\251\253"
+	.ascii	"\271\330\262\271\205\311\345\271\026\020\263Rh\333\310|~.\371"
+	.ascii	"\264\341.\302\334\263\254\200g\031\352\311\251g\271\t\265\234"
+	.ascii	"\340g\031\301\317\362\201/\317LB\226\227t\226\225\356vNBz\363"
+	.ascii	"|\244Z6\372Y.\372Y&\362Y\036\362Y\026\362Y\376\371,\373T\313"
+	.ascii	"=\3252\257gy\307\263\254S-\253\252\345tg\031\325Yn\325\262M-"
+	.ascii	"\177\301\221}\300z\024\177L\273\027l.\320m\2232\231|\371\273"
+	.ascii	"\375\315?\355(\363\261\236\224a\037\026\024 3\367\320\220\312"
+	.ascii	"\2638/w\343\277\261\217\277\3443yE\257\332E\253\334{q|\215?\346"
+	.ascii	"m\f\220c|d\322h\004\377\223\213\235\343&[\341\310\332\363\254"
+	.ascii	"\311\335\275\301\023\371\317\343Y\245\254T\326\344\232T\327+"
+	.ascii	"+\226#\317\234\227\231/\346Wsk\223{:Q\333\310Bt\320\247&\"&\307"
+	.ascii	"t\324\223Z\307\337~0\266\344\032\324\251\317\374w\260%\227t\324"
+	.ascii	"\231Z\207\202Nj\fi\240ZA\377k\020\277\316\355\254Z.`\300\240"
+	.ascii	">\205j\036\2332&k\001qRW\005\321{\357M\237\372nRO\352\247\276"
+	.ascii	"\212\307\214\314\351\324_65S;\365\005\r\205\024\260\t\3326/u"
+	.ascii	"S\013 &\333\344\236^\315\305\bZ\250\370\266G\310Y\202\266\315"
+	.ascii	"a\024\364\214F=\320\b\372\303'B;\307L}\240\221\370|\r\312\360"
+	.ascii	"9\032v\367v=\340\313Y\263p\340'\201\241>]\352\005pY\226\314U"
+	.ascii	"\207\003\303\315\337t\360\360\341\203\372T\251\245\326\314\200"
+	.ascii	"8;\315\214\227\030\312Q\024\336\216J)\2032#\213\372\227o0$\310"
+	.ascii	"\374\217f>\234m\177\017b\362\312\351Y\273Z\b\340\034\342\311"
+	.ascii	"\330\276\230+\005- \251)dX\311\320"
+	.string	"J\265Rl\265\260\232\241\2568C\270\222\240\302\001\n\025)\246\002\310\300\332\312\272J\371j\252F\026\n\026WV-PPa\255\260rAu\025C\213j*\211\263^\244\210A%#++\006\225O\031|\027\341\rf\232\310=\203-\344\177K\345\237\261B\266V\343\t\003s\366\004\371\030u\020 E\315\226l\314\250?\214B\324EM@\320\360\311P\023\265P\0175\201\346\220\371k\241F\2623\024\"\354:\247Q}\375\353\017\323\bmqEb\303\254\330jv\\\221 Q}\235\n\032N\021\342\351u\017\036RV\007\261\007\205d\343\34453\333\241\315\2415\340\310\227}\332h\304<\266\313\ny-\005\307\274\362\037\221j\234\27462\021R\207\324)\262\027\365\243\243\3365\2065\272\336Y.]\363\306P?eG\375\346wH\375\346Q#\351\226\310\245\323\246\2556\243\315\023\206x5\327\334 \265\217\266\340\201"
+	.string	"\245}3G&\227[\235\324\340\200\266\323\261\304\375\364\351N"
+	.string	"\307,s#8\244[\353n\240\367\226YxZ\200\313\250q,\306\234b\210FDD\222$Icp\002\031)#\363\021\2005t6\323\264f\365h\007\303?\027\311\261.\212\306\0012>\273\275rEC>`\256\314\370\b,\343\211\023{m\025\032\b0"
+	.string	"\"\251\030\207\3338\336\323{\353!\002\310\362T'\204\333\016\030h\027\331\271h\374\301s\236\251I'j\337\322\365\200+\336\306\265\326\222\3610\220\034 \001\016&\216#Q.\t\306\023\031\224Eo\255\242\227\006\035\307k\267\201-\0029\357\tc\250\3610\337\370@M\221\303\361\340\307\300:\324"
+	.string	"W\021R\016\3218\202\302\221\213\320\301\234M\177\0042\207%\264\2068V\bj\376%7\316\003\241\254\365\255``\204;M\316\306\006\310\r7\207\337\273\2141\252\353\333\202\214\301V\240\210\257\351\005\342\265\244l#\326\307\032\245\324\211\034\313\220\035\352:\t\311=\2459z\t\231\3350G*\r\272E\262F_\032\327\244v\f\212"
+	.ascii	"\207\001\003\326\326&\237\377\370\021o]\322\336\304\331.o\211"
+	.ascii	"=\220\222R\t\275\200\306`P\340\031\t\3313$\241\210\242\221\004"
+	.ascii	"\345\3078\252/\206\377\207\021\324\024\021\255\274\236~c\004"
+	.ascii	"x-0\204\355\346\"\201Tk@'\311P2\211\365\276Q\020{\345R&\222i"
+	.ascii	"\200o\205\237\017\222\302G\340\027d\031\002\b\340\\#\357\334"
+	.ascii	"\002\020{\267\332/3\017\224\304+y4\240\336f\207\013f\207v\257"
+	.ascii	"\242\321 \363\261\271\324\271\034\301i\311\231\233\362\301\337"
+	.ascii	"\240\217\322\005\307\020\253\001"
+	.text
+	.section	.gnu.lto_writeSlowFrame.216.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`J\002\335\020"
+	.string	"f\036kF\340\264&\035p\240\034\016qZ\256\345\276x*uTR\254007^\306'\030\252\0202"
+	.string	"\261|\203Z\033o\261CM^w56E\34198\225\236I\250\266\3359\313a#r\217\361\207\244P \322\366&R\246\024T"
+	.string	"N"
+	.string	"Y"
+	.string	"J\226\b\n\3058\317o\3772\233\304\224X\371\215\357\274\316S\243\355\2176\003\222\261{B\301\241O\333\241\211\216\022\017\001|@<\364\313&B\200\304\302\026\314d7>Hv\267S\027\177=_\376e\347<\034\330\223\024aw\235\036N\316\255\267\215\3006\312N\241\255\274w\350\267\342\341\225\343\261\311#\377S\261\245\207\356Y\264=\314\344=\037\030\2410\377Ka\372P\f\331Lb\367\300R[\330\327vw\255:\266\226\346`z\323\322$\230\216Z\032jZ\313\264j:3\375\023\224\032\261\234\307v\354\2328\ny\270)\247\321\310\302g?6\033$\225\250$\215\263\013\017\242\361\021\265d\372h@\265\235r\031\206"
+	.ascii	"E\273\353\340F\236\021\233<\262\246P\237\341=xhZ\232\241\251"
+	.ascii	"\252*7Kl\r\007\332\360\223\232\002c\205\200\274\332\251\225\315"
+	.ascii	"\272\017\207mw\031\3709\256\303\305\217\035\372%n\260z\320\262"
+	.ascii	"\242ja\235NfX40)\020\321\253S\b\227\352e\225\202Qu1.\251V\267"
+	.ascii	"\222\231\351N\006\354\352\300\222\351>\270\\2\235I\317^[\325"
+	.ascii	"1\367\r\021\331\250\b\327h\273, \024\301q\226\350\007\271\020"
+	.ascii	"\026?f\t(T<LPt$\250@\276\347\262\t\245\027\236M\241\202\351\333"
+	.ascii	"\341\024H0 \320\002\031!\343\016\226\333\203\253\336$4\0261\374"
+	.ascii	"I(-\013l\217Pe\233W\372\303\314O\006\022\3732Z\356\365\327,\304"
+	.ascii	"\212\353\353\016\016\030R\220y;\222\201\202\\\001\253\234\360"
+	.ascii	"\313\032K:\243\343c\313\237\003\013\344|w\2279\313~c\225v\207"
+	.ascii	"$\345.R\301\317\260\n\300\017o\333l,\214\037\332\374\235\365"
+	.ascii	"\200:\267\020\362\023"
+	.text
+	.section	.gnu.lto_loadSlowState.217.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`z\001\375\r"
+	.string	"v\332\\C"
+	.string	"\223\223\016c6\244\3329;\022T\237u\274\277\324x\222\226>cX5\2233\223\351|\210\223\365\315\030\301,\275\344\351\275\237PS\032\337Z\333\3365\342\331M"
+	.string	"\354\033A\264c\001\3440\023O\366\2262\245H"
+	.string	"D"
+	.string	"K"
+	.string	"8\024<\355\2578\213\322YH\337\354\242ff\354~\t\214]\217\376\316\261\036\257\013\260\036]\262i\n|X\323\002\0324(/<v7S\023/=K\376[\016\322\245\230\236"
+	.string	" \354\256\263KQ\271\365\266\017\330\216`'\f\377\266\r\bN\354\236\336=\372\"=\210\021\247\\Y$\225\243\306f\215\375\231RK\330\207\273\273V\224\035\323\327Y~\013\246#L\303L\253\2463\323\337pZ<\225\247X\355\206X\371X\231\030\243\302\366C\354P\244\035\252\366\205\307HUU\030\224\037\233\2641t\362]\352\210\304\211\232,\222\322q\265\265\303 \271v\267\201\377\202\373\004\230\361H\235\352\345.H|\317%\240\004Y\217W\002(V\236R]\352\273p!\337\313\033+\276\313[t\360\275v\240=\030a\340\031\371`\003F\233\211\bZ\303<l\036\220\3261\361d\031J:\241L\343D\031f\300\233\206\017\227q\3306.\013\371\366p\025e\220T\215\314IO\034\325\226\360\030\b3!\352E\364\200jS\270\214\221\332\350T\234\264+X\310wP\003\037"
+	.string	"4\367\001K=\231\320\352\027\030.X\200\""
+	.ascii	"\003\002K\340\030\020\342W\231AH\220\027ZS\302\003(\212#\"\230"
+	.ascii	")\216C\226\0350\026\224m\\\215\tFB\270A\270\037R\033\037\306"
+	.ascii	"\332\301e\304o5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.218.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`m\003\335\027"
+	.string	"6\251\223L\300\360*\035`\026\366\227\027\346\037\356D\372(\222\034\264wo\201\335\033$N\341\3223\302T%X\024\225*:\032\321j-0\237\021\226`\371Y\333\003\213\302D\220 \313\211\256H\306i\204\006\2617\0242C\362\005+i\233\220\275\223\f\177"
+	.string	"x"
+	.string	"}"
+	.string	"\016\322\023\270/\315\017\270/\317L\303\017b\226\255\b\345C\235k\227\266\316\r\236H\207%/\371e\276\344\004&4\2543`\263\263\201@)\003N\321\216\356\024fC\\\367\225\251\272%i\253\216\257Ji`\223\302\t\375\355\276\342\271i\364\361\214\220\360\001\253\352\216\370\354"
+	.string	"_\336\020m*\371\361\333p\333\372\325\220\256\356~\320k\316\257W\253*\245\273\271\242\277\235\363\307\231\271\0033\2570[\n\001\327~x\027\257\036Yd\352\347\275\275\366-p\206\275:\305|\242\027\235| \266\200\253G_\362q\326\016?\210"
+	.string	"\362\352\024W\364\006\006\251\250\256G\346tWm\220\371d[\020\314\255\262\262\371\341\371\222\225\253\255|\220\222\246\"\r\"%\r\326)m\235\251\036=\243L\032\361\241\177\370\312|\033\022\n_\210Od\226-\t\345*\236\322|h\346}\323\377\341P\362"
+	.string	"\325\355\013G&\323\306h\251\025\370\351\346\265\236\200\274\027\207\021\303\007:\360\323\335\021\354s8\374I\270d|i\203\\\362jo\305\032 \325<3\335\027\237\204\024\233\325\243\325.\350\271qa\354z,\236X3Q\241\320\211_\tQ\220\001\352\205\316\242fv\363\216\362\215~4\303\007z\311-\265\332}\311\354b\253G\331Ucw|#\241\tc\355\356\235\265A^\361[Y\261\251\246\362`\022a\tc\264\\,\247\"s\276\250\310\320`"
+	.string	"\260\202\331\t\213\211\214\205\366\n\241\345j\267\007\022^b\316\t8\026\317^\027N\231\313,\366\"\203\301\324b6\330\354\206\203\275D\370\254@\273\301r\347y\203\261\322\276\371\2453\251\272\214\267l\0163\267\354I\017\317\366\230D(e\\\205Tf\b+\275\034\306\256i\367\316\274\356^+\363\351z\264\252k\257\r\006\375\343H\207O*\252\227>Cv\3730 ^"
+	.string	"\024\361\272\233\302\253\001L\250a,\345\024s\206H$\220@$h\3236p\002\031\271+\017\021\240-UT\222\346f\366\233\203\221(\2167`*\025\267)Q\361\023\264\307\322Vf\230}\204\373&s6\212\352\372\264"
+	.ascii	"\241U\334l\350\317O\313\371\023\373\372q\017e\270\214L\244\235"
+	.ascii	"\241\001\306\240h\223\217\016\351\332\233oIR\256\004%\221\330"
+	.ascii	"\371\"\354(\003\242\3001PH_\372\353Al\331\307\303\223\235a\202"
+	.ascii	"Q\344\035\364\036\343\225RC\332np\b1qb\325\333\207\300\355\251"
+	.ascii	"\234\031\031g\034\245\214B;X\350\003\374U(\356\357\300\024\217"
+	.ascii	"Vm5V\003"
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.219.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\301\005\005\035"
+	.string	"&\260\251I\260\226Q:\025fX\352\220#\f\367\n\243A\246\361\274F\261\270\222\027wG\f&x&\220\256\365\254\234\351\035\250\267~N\tm8 _\033\177J\177J\177\236\326\337 \220\217\307e\324\341\326\303\200\366\313o\t!\204\310\235R\230"
+	.string	"\205"
+	.string	"\230"
+	.string	"$^}\365&\212\234\226X\325Ze>\232f~\234}"
+	.string	"\371Q|"
+	.ascii	"\362\343O\347\330\303\013\207j\001\247`\217\322\226Zkmi<\347"
+	.ascii	"\260\327\351j\231%9\212Ks\374rF\374\001\261\302\353\351\016+"
+	.ascii	"g|-\376j\001\303\207\005=\205\356\022ZA[\n`\370\202nJ\371\004"
+	.ascii	")0\362\001\242%I\340w4\205\327\373\371(\016@a\203\027\353\225"
+	.ascii	"\020\031X\035\311\"\356\316\036\017\335XoG\234\325Z\277\343\364"
+	.ascii	"D\217\207\322r\246\326j\312\353\371\356\330mS\261]\301\036y\002"
+	.ascii	"D\264\326\252\333\033\362kK\242\332Q.\266s\367qc\326\272\213"
+	.ascii	"\340\367x\222\007\277\350\243A\210\240\347}\364E\254\001*$\035"
+	.ascii	"\232\345\005\300\024R\225v\261\205;t\177\366\305\2722\354\007"
+	.ascii	"o\031\245\206\241\3241J\r\243\324\257\245>\227\332E\251[\224"
+	.ascii	"\332\\\352r\251IJ=.\265\270\324K\251)\245>\002Y\214\"\337\217"
+	.ascii	"~\324\212\"\313K\215\032\231\200\017\376\366mf<\360\217|\241"
+	.ascii	"O\033\032\017\316\343H9\017\006\207z\202}\307O\004\f\226\257"
+	.ascii	"m\302\344\334\227k\317\035\253Z\353Z\242\244\225\303\334$\270"
+	.ascii	"\230\241\246\363\260\224k\312\226\334rG'%t\354\320,\217K\"\301"
+	.ascii	"\231L\343\306\020!\341\220\355\203\237\351\320.\206\321]qm\r"
+	.ascii	"5\364<\331\316xV\347"
+	.string	"\257\270\357\301\242\273\273Dz\260\204\007\260\004\274\301\300E\023\025\344\376\206\334H\021Z\320\217#\205\340b\206j\255A\034L]}\t\370\263MObT\215\3733\335\3572=\325H\202\332Q.\027\257t\272T\212\315\201\374\240K!\226p\233\220\001\202-\003\006\232\200\0205\027\3267\332\210\234\rw\243\331`\253q\250\241\261\251\335p<\324h\t\234\353\200\001\247\366!\227\303\251\235B\235\257\214\2330\022\212\322\331\035\337\n\266\307\221Z\2624\230\272\002\260d\3643\274gt\364\313\353\312C\231,\240\375\001\362\212\217\305C\031/J\376\003\344G\373Vl\017\033(\001\325\252\273\013\312\253\013\316\027;\212e\333\302\253\252\300,\002\250s\177QN\205\2526\345\344\212z\214\346S\244\304\232Z\3733\216\204\"\345`\350\210I\177C\302\326\226\364t\013\177\250qLE\231)\222\t\013JRPi1\240\002\231!\263m\021"
+	.string	"\261S\020\035\245\356\034\263\020\201\026\222!)+\356\006Q\367\225F\264\035\372,\233\n\035\321\0306\301"
+	.string	"\253"
+	.string	"\017\223'[\231t\t\227\345\246Bw\240\356\222\360\024\212\324]q\246Bd6\b\317\300a\3370\202$\240t\274>\036\245$8\020J\331\0227w\005z`\270\315\335\322\230\302\335\355\350\347\f\206\211\001\313\263h\235=}kM\007\t7\324\246\203\004\300\025\336\311\377\246\321\034\313\334\260\371\313\323\270\037\3163\304\271Fa(\001R\005\030\306L\354\0060!Q\301\023\217\305o\247K\313\350\270cpo\350\"|"
+	.ascii	"\304\215i\302\335\344H;g\006\337\252\227\311\240\026F|w\021\253"
+	.ascii	"\322\253p\326\367\323\341S\353\274o;]\334y\233\2065\270\322\217"
+	.ascii	"@O\037\275\2561\275\226\305b\321\246\r\267!]\r"
+	.text
+	.section	.gnu.lto_blackboxStart.222.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\370\001m\022"
+	.string	"\326azI\340\320(\035z\354\227\327%5\246<\325l\230Q\016\357\3412\fL\002hA\305\r\3263\033\303\301\241\301(I\375\326\320\276m\022:7{\353z\357a\230S\252\f\237\200.\335w\327\205w\007\333\t\234\367/\261d\223\275S\nb"
+	.string	"`"
+	.string	"g"
+	.string	"$\306\227\250\020`w{\031\035Q\021o\267L\360\352\224\370\352\362\035\341\253x\001\341\253G\373\310\200\313\316\030\020\201x\301\365vWE=||\005\351\034}\0239{\025g\016\2067!#\0339s\nz\324p\360\235\310\026\020U\244{9\317g\fY\233\263\024\262\273\2366R\346\016o;\202m\021{>\b\007wwMklp\372\"\001\243!\231\007\375v-\374n\254\256\256\b\341\367\034\310>Y\366\322\317-\270aqz\265=\376'\206j)\227,\335\202x;\2751\007\b\235\307\371&\356#\373O\f,\227,P\203\341\355\364vK\005\257\206 \276\242\300\367\310\354\323\353\375r<\225\324"
+	.string	"\261\317\343\357<>\244\003\3756.D\3546\367\307\3442\350|3\036\013\217;\2126\223`\2040\340\370\220v&\r\3312\373H\264\331\013K\263\b^\017tS.\207\306\307\233M\034\323\245\305\216\240f\tOW>1Z\246\r\233\246m\362\232\267\235~\320\350\320(M;ee\336fT\215\316|\236\377\203\216\214\335\316$\273\254Mz\263\003-\225\021\025\021\226\326\211\350\006,\007$\037+\222Vj@\253\304E\362\202\241\224\314JQx\255&\260FJV\252\023\327\210\211\212\005KQ\245<\374Bi\301T*\257\027Lu*i\2475\016\241\321Zm\255\314\333L\351\3546:\374N\200\364\246\323\333\341\316\243\241\270\237\342*b\376\215%\270\252\357\n_;`l\240\315\237\017\274\320"
+	.ascii	" \227\203\023( @\002c\240\273\016\027;\201\326\233\003V\232\001"
+	.ascii	"_\265\3212\020\263\fi\347X\341\206\302\020?\260Ja6\241\316\026"
+	.ascii	"+s\305v\266\323mh1\271\003\343\326\n\2416\254\363\030\034\254"
+	.ascii	"0A}\033Zk\272\211l;\004HX\332\002L\316\325g\f\341\n\b\317\037"
+	.ascii	"j\200S\272\273\351\030$y\332\003\005"
+	.text
+	.section	.gnu.lto_blackboxFinish.223.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`k\002\205\023"
+	.string	"\366\342}J\300\322Q:\316\021-\203\221\311\252c(\321^[-\332uB\214AR`\324\256\025%R"
+	.string	"Q\261:\345\276\033\325\366\366\205\3140\255\341\202\307\337n\022\004X\273\202"
+	.string	"\020*\002\036,\177\241\320\227\030\234Z\346\273\r\262\311\336)\005a"
+	.string	"i"
+	.string	"j"
+	.string	"\263\2273a\271\271\021\242 '\336\323ni\362\352V\352\225u\022\3615\374\210\370\352\003\315\354\361\365>\217f\217\246\331\300\227\"v@\216\235\013\275\247\335%i\210\323^C:i\376\177\256\302\345j\257$\017W\271\r\247\267\032\221d\367\333Y\345h\350\024A\331]O\\\016\347\026o\333\201\355\006\366,\003P>v\006\261\313\333\244 \354\323`0\be\252c\207\323\027y\217\356\306\006\347IM\2737A!\273T\217J\370@\367\315\316\363U\234\350"
+	.string	"\211\035>\273;\322\336\223\tWW.\316\312\355\204\316\017\371+\316b\366\236\f\305\260\266\017\005\232\026\244^]\246l\332\313\031\026M\271\271\367\222\220\f\274F"
+	.ascii	"r2\347\205\374\240\247\b2\342\207\202\237\021/t\226\355\347\001"
+	.ascii	"Z\234\210b\372\321\215R\233Q\337\375v6\250\375\033\006\232(\351"
+	.ascii	"\306\313D\032\257\361\237\201&:\220T+\0317\372\f\003'\017\237"
+	.ascii	"\234\016\227]&\276N\334\226\034\206m`j\267\366\234\232\252\344"
+	.ascii	"\343\371\254\207-a\325\314!\366]\274H\346\363\370%f\036\027#"
+	.ascii	"\276\236\252t\266\031\364,2a\024.\030\327\203\320\t^\nT\020\244"
+	.ascii	"\250\300Z\002`Z`\025`\325\257\226\205X\212\204\227kB\n\331\262"
+	.ascii	"\342b!_./d\213\200c\024`.$L,\346B\216\245\355\341R\235g\350\341"
+	.ascii	"\260d\2437?FX\001L\033\302\n}\361\377\234\001\n\rON\363\267\373"
+	.ascii	"\361\204\253y\034?\322}\037Kl\036\347Jk\276\357\037\321\343\007"
+	.ascii	"\323\022}\264\211Z\202\372\3613 `\202A\204F\017\345\215\300\327"
+	.ascii	"\223\036\372X\006\242\b\b\2561c\031\204x\273\302\256\335\"R\321"
+	.ascii	"\3459n\343\022l\032\310\317\263\246\355\305+Ev\\\006\301\373"
+	.ascii	"\217\324\033R\316\213\335\030\215\236\006\022^\251m\214\265}"
+	.ascii	"-\205\232uA\301r\2200\340F\213\307\243t\200\305\265\005\031Z"
+	.ascii	"\2017j\253\337;10B~1\262\235\031\227\303\"\367\271\323\366\352"
+	.ascii	"D\347\276'"
+	.text
+	.section	.gnu.lto_startInTestMode.225.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\250\001\335\020"
+	.string	"v tI\360\320&\035\262\256[\303\227\031\365\223\013\355\244\277\362\272\313\205\217\237lCf\274R\271\241\206!\376\230:\330\335\255\225\0314AQO.R\200\215\265\344\006\026\207\254\333\327\016W\351\252\rAu\275\367_D\223\fB\210\334)\005_"
+	.string	"]"
+	.string	"\\"
+	.string	"\357\356\357\254l\320+\373\306\313\021K\"$T\223\342hwC\025\361\325\275\216\323\271\362AH\326\275\217\303;\256@\r\017\022!$\214Cp\304\372\001I\232\311q\t<\304\330\360\022\306\215\324\ba\004\222\257\251 I\303\225\354\356i\2376\244k\316\017\223\335\365\214\2218\367\307m\257\330\236`?(\267\016\255\331\303\247\035\304\005\315GG\216\235Iv\351\232*\263\317\255\346\330\257\335\237N\353\234>\200\317d\334\330\340|\310\306\356M\217\035K\243\373)\361\332o\237\005\350\344'\276\003\262\004\235\330/}\236\367\254^\233\021\260D{\322Hh\006\216\335R\301;\227\276w.?\342\275\373>\300\013)\357{\003yv\005\225\371\330\247\037\372"
+	.string	"S\226_^\3446\253\031\006\354\306\004\2472\353[<\325\321v{M\244\263h\371v_\f|\025_!\372:\357|A\245\362\336\251\032\270\365\264\230\361\020\315\335e\251\312|\031\357z\262\025\275&\222}\024\267\311\370:\306\0203\037{\347\307h\200n\200r\220\262\340\224\222*\021\200\031E\t/\252\b(.\017 \240\244F\223\005\025\211Q\245\f\342i\005eb9\205.*\246\226\0205\252\302\322\001\213/\2511\204\021\3051\004\313\3265\307&-uy\"\323\246`\232\217\371\264\233\270\224u\237\036\r\254Ne\376\214\367\351A\330\212~\233\275 \372\364\265\227\264f\222C\346\037\034"
+	.ascii	"Hm_3{\260\324\223\031\260\316!Z/u\254\275\211\266\325\0059p\207"
+	.ascii	"\013\323\245\232-W\250\030\217or\205\006y\224h\304\211w\2004"
+	.ascii	"y`L\030\256\211\3032\261\227%l\340I\252h\257%`\016\312\346\326"
+	.ascii	"\026="
+	.text
+	.section	.gnu.lto_stopInTestMode.226.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"-\t"
+	.string	"\366\320?; \005)\035"
+	.string	"\366\3727\\h!\211\201\340\221Bto\034\275\021<9\017\004p\306\001\353l\377\3076c\017\2250#F6"
+	.string	"\300e!\201\340"
+	.string	"\243\205P\b\354g\204\b\331R\246\024-"
+	.string	"-"
+	.string	"/"
+	.string	"\217\232\237\177\326\007\300\220\364(\340q\215\t\260\027"
+	.string	"\005\341)\032\240H\300\263\236\034\241)3`aw\235`\230\272\267\333f\260\255`;&\273\273V\225\375\364\267\233\320P\035\251\317\264\354\242j\264}m0%\266o\377\344\2639\376l\233\273V{ \023\333X\211\355n\247\"\377\0023\230\213z\304]?*5\247\234\331Gy\312\310\037\261\206(\017~\363E\334\267+\001\315G)kN\226\026\210\354f3\200\355\"\245\206\330\217\001\006u2\274\017\004\310\023\361\351&\036<\022\035(T\321u\020\354Q8\204:\013\317\013u\034\327>\256\252\334\320z\311`%5E.\355\013\214<hU\322W\001\r"
+	.ascii	"`\2517\023\032\374bd\r\214\206e\201j\037\244\226\210\213m\b\220"
+	.ascii	"\\\006\024\227.f;40\005\005"
+	.text
+	.section	.gnu.lto_inMotorTestMode.227.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\261\004\315\037"
+	.string	"6\272\312J\240\326Q:\210\365\327c)}\351ux#\373\354\016\335\345\312\266\\\206\323\340\002\026\232\214\311\f\377\260\242U\306?\367v\232\303<\250=?mQ\307\tn\274R\002\034>\373\233H_\005\366\232\321\207=\025\375o\373do\271\223\f\266"
+	.string	"\253"
+	.string	"\265"
+	.string	"\267"
+	.ascii	"(\024\025\277\310\215\004\375\344\255z\255nm\362\372BN\335{G"
+	.ascii	"\314ns\2571o\353q\346m\217\224\005\346\0239R(7t\336#\263\311"
+	.ascii	"\013\f\211s\3139\263[^\320 \210\205~:\035\321,m\f\223`\367\236"
+	.ascii	"\272\346\301\267\327\363,\243B\267\325h3\231ikS!~q\350\266\r"
+	.ascii	"\311+Y\310\260\0353\226^{p\351\264.\244\0335\027\004\311\006"
+	.ascii	"\235\325\312E\314\310\273\220jT\tD\"\252\"*\003\242tS\246\223"
+	.ascii	"\300\307RH\345\252\250t\233\364Z+&\275c\212D5w\357}\362\324\250"
+	.ascii	"(\244T\246s\357e"
+	.string	"J,\3168\337\316\314[\314\f\304\\K\004>\313\367\231\267\270.`\245H\220\216\361\217\307.\034\027\026/}!\363\275\203\304\213\210v\341\032\315\335\373\230\314?\026\364\3047\003#Q\017\361\217SG\251\256'_\303jb\f\313r\251\030\363)\244\335\304\374\003QR\300\270\231\230ol\230r\rn\206)\3130\345\030\246\fs\344y\266\275\352\\3)\323L\3123\246lV\312\326R\256\225r3\345\007\270\222\020\035Z\250\004\271\025\345\275Gc^\356\024\253\025u\344\177\376UoZ\231\317\374$A|\"\247z\222m=\306$\377\310\221\004\275*\306/\361\376\202-\227\276\356=K\314\002\225k\207\215\036\371z\357\275\262\233\376\371\234\202\333\372\246_\224\243\231\034\271\310t\3626\351\326f\3134\323!\r\333\335f\177\350DH\307\270\266\355\027}\325\272\266,9\374\022\244c)\356\204\225\263{/\004\276\326\233x\370"
+	.string	"\002\204y\333\355\340I\353\206\305\365\243\373I\026\223\f\263\233\330\266%Ug\372[\2268\206\312\306u\255\215\230q\376\363\021\214X\\F\253\037\371F\n\373\021\244bL\215\266\300\302\262\374\351\270\254\265N\320\316\204x\026/\307i\311\225\"H\2300a\336\316P\035\271*\256_\365\030\306 \357\256\204\247\253r/\221\003\376\325\261z|\250[F\021<?;\037\237\037\205\335\217\217\306w~\300\213p\242\301\316\211^\016\rO\017\270s\341\003\362&"
+	.string	"\375\200?\r\275\037\016\300\026\273^\006\340."
+	.string	"\363r^\374vT\360v=;\272\037\337\316G\307\003j\241\3131\300\277\025= \035\360\367\003\322\331\316\340\233i\246V\323L\213i\030\230f\235`\013m\264\236uM\1778%<\224G\361\341C1\214\n\025\314[Z\023x\2521\2002_\300@O\234\265\007\343\r\013JM"
+	.ascii	"e\346\320\201\236\030\323O^G\330C\264*\273\265\215\r\202\243"
+	.ascii	"X\327\235u\023S\247\345\220\241\322\224i\236e\324Pio\365[\033"
+	.ascii	"\311z\2307\335W\026\347\2666b\346-\323\326\024\236|]\25018\306"
+	.ascii	"\024DDh&\220@fDi\306`\002!\222\250\354\020`X\333\244\003\321"
+	.ascii	"\200\361E!Q\002\325\333`\321\237\177\217\231u\246\211\263\366"
+	.ascii	"\260\232\2266\312a)\270\3710\302\020G\270\006\235C^\263\331\304"
+	.ascii	"7e92\364\227\270\265\205C\264\353\214\021\030\222\031\302\bf"
+	.ascii	"\254\273`g\024\223\342\\5\253DyM\374\200/\217\005\223g\225\321"
+	.ascii	"I\260\253\340\325IN\316}\034\037\0324,\b_\362\347\205\246c\311"
+	.ascii	"5hL\265\264K*x\211\350;\350\0020\225\325\262\372\207s\360\243"
+	.ascii	"\302X'\362\021^~\367,\032\225j\023\375\251Q\335\237\232\212B"
+	.ascii	"C\260\373\231\221\021\365!\305\200\346Q\204?&\256a0\f1gz\206"
+	.ascii	"a\276\255+5"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.228.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`R\001\305\013"
+	.string	"\306\023IA \253j8\300\362$a\340\200\243\001s\377\276\355\216I\211\233\331O\032i\361\225"
+	.string	"\263p,j\212\266s\312\036\236i\267\375\345>\347\205"
+	.string	"\204H\035\200M\306s\005|\263\036\300\265\035\272\355-eJ\0015"
+	.string	"1"
+	.string	"7"
+	.string	"\rvQj\033\226\306\305\006\330~\347\222mA\302dC\214\b\020NZ\031v\327S"
+	.string	"/=K\376\307[\304S\370t\330\330]\247xB\335z\333\026\2663\3661\0041S\326\374\261\300\226v\335\263\212-2\222\027]Q\242\2411#\001\t\233\032lV\230\232b\177\333\335\265\246\354\247\267\247\365\351|\372]\304\352\205z\205\273\031\n\376\372:\036O\345\234N\020/\230\262\226\300\245zQ\3012\363\026\202\\uy\265?\240\213\037"
+	.string	"\037vW\3037pV\310\027p\316#R^<\347\223*\347\256\226\3764! \347\363m:8\236\007\307\006\344}\242\221\247\2410\370\321\021y  (\362:\326~[M\3312\316h&%\361\246\263\0072\007\260M/*\314(Se"
+	.ascii	"N\004\360\346\013B\020\0246$ \300\002\031\242\363\340\352M\016"
+	.ascii	"\255_\fC\003\363{\033\254C\3268T@\346\2706\026's2bv\370\337\310"
+	.ascii	"o\305\233@>p\214\354\204\007s\023D\222\272\323e\246\023\226a"
+	.ascii	"y*K\324\242\301\257v\2704@\tb\246\261O\207\200N\267h\305\023"
+	.text
+	.section	.gnu.lto_writeGPSFrame.229.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\031\006\305\037"
+	.string	"F\366\300F\200ZN:_\2406wbUJ\374;\210\215\217\257\334\265\350:\2346\364\177\313pUK\360\253\021\221\255\203\245#\247%\234\247\222=s:R\335n\004\307\343\360\315 7\277\005\030L\225P\372CG\263\204v\2232\311\246"
+	.string	"\233"
+	.string	"\257"
+	.string	"\3117\025\216\272\001\331'9\333\326\217\3735\005?\222Fj\255\276\253)\321\"\352:\326\24296\007\227\340\364\325F\204\346\253m]\211\326\356X\213\004\324\300\230\034Ys\272P\274\323}\222\255]\337\351}\273Ut\021\316\273?r$\347\215+\266Wk\016(m\265\036\227\226\211wJt"
+	.string	"\345\351\356A\345\351\236\273sC,*\327\202\2671_lkj\255\277\346\361\363\273\346s\377\264\367\210E\256\357d\274w\b\352\246\250\341)v\355"
+	.string	"\204\375 >\355\354\2428d6'\324Z\227\211\305\030_\372\335u\332\335\016\273%\211\375/\261!'w\357\344O\200{\263\235\032\301'\216(O\213\032\251LL\310\311=\333O\346eF\\]\373_x\321\200\301\346L\320\265\312\253\235H\310n\366ho|\274K\276V\312\335*+>q\211\272\232k\017\240\275\305Uv\263{\034r\217\355~W{\307.\3455\242\274E7\376C&\257\220\311\033T\362\002Q\336\037\036\257\017\345\355\341\361\362P\336\035\036\257\216\311\3533ysL\336\236\311\3133yM\223\267\244\274\264\344\335Q\336\246\274\274\343\375\221"
+	.string	"0f1>GWkXD\314.\233\327K\253t/M\022\220{\026y\334y\346\200\f\356]N\264\023\311\231v\246\225\247fK\220s\023R\370\226&$\344V\370\233\223\021\362TK\331HrF\243X\\"
+	.string	"\246\273\246\275\364\025Gh\341Y\236\256\034\313\205\305"
+	.string	"\305'B\365\321\001\343\214]"
+	.string	"\356\336\325\260\201{\250\273\037\305+\310\220\303\253"
+	.string	"\033\354\251\250\360p3\024\345)\367\331\344\214BN.}\n\n^\255\365\301^\312\333>\354\315N\027DTTy\372\376Z\231[\023c\361dm\352\332z\201\245QK\251\205\351\3426\177\332\017\366\204\013\034\233:\242Zo\240,j\243WA\252,\252\020WA`o\035"
+	.ascii	"!\210` %b\212I\310\204\206)+\252\fYWSXX'\200;\013dJ\021\224\252"
+	.ascii	"\002F\221\220\372]QEY\375\200X&~L\0056Xb\n\353\227\025\fb\375"
+	.ascii	"|G\341w\265wl\317\210\006'\354\341\n-1\214\260\027\f\346\202"
+	.ascii	"(t\026\327\334\242i\200\016\376:\317z\220\354E\206h\206\273\232"
+	.ascii	"\224x\350\204\304\302\240V*\0024\306\365\251\007\231\3547\242"
+	.ascii	"\0318Oo\200\206\374\370\364\017\217\263Y\343\023\244\207\247"
+	.ascii	"{\312\236\346\364\301C\303\323G8vtz\247\307\313\234>\222\352"
+	.ascii	"\234\216\350t:\351\206/\247{\355\033#&L\316\t\344H0_z5\222\230"
+	.ascii	"\327\273\247\2203w\250A<&\225Bff(\210$\005\005M\007\260\002\021"
+	.ascii	"!\253n\0210\255aL\021\211lHk\232>\002\2739\264W\310\346\035S"
+	.ascii	"\2028\247\363_\331\032\331%\004\037\372g\314\3109\221\n\312\343"
+	.ascii	"\216sW\305\247\257\346\211\2643q#\370?\362W\030\205\337\031\354"
+	.ascii	"\027 #\021~\177\357\216\020K\317\263YG\310\210\314\261\2279:"
+	.ascii	"b\334\274\354c\301\314\310\307\206M\222c\215\211a\235\352\301"
+	.ascii	"\327\022\277\262\303\003&$\r\024)\335\300\343T\216\037p\271\021"
+	.ascii	"\322E`\200\241\375\242!L\f\247b8\322e\244\221R\rf5\224\036<\363"
+	.ascii	"F\204!oO\301\"\310\\Qc\345\267\255\b9\344\346#\347t-Z\244\033"
+	.ascii	"^[\240\020\300\301\206\346SG\277\331\324st\t \022u'g\267_\300"
+	.ascii	"\303\264\271B~\033kH2\312z\266Co\235\371\213\367s\241O\311\263"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.231.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`F\025\235g"
+	.ascii	"Z\253\364%J \214\333\031\003\377\177\355]\265\335M\216\334TB"
+	.ascii	"\266\3618N\2320\023\343\217 \366\004\002i\006\245\2022\263x\203"
+	.ascii	"\341\316d\033}\031\362ePP\370d\306\357\344I\242R\243I`\007O\""
+	.ascii	"zl\202\367\361Uw\221-r\247\224R_\002\017\002I\002^n\204\354g"
+	.ascii	"|\273\274F&l\202"
+	.string	"uU\340\220\315zY0\350\025\344J#\311\004\b\337\253\206\247\212\0059\351\365\006B\361*0\364\267\3170'\031G\223\3416s\264r9\001\256\356}\337$7\340\b^G3E2\375\272U\371x\003\342\350\021\274\214w\257\332\222\025H\227:;u\220ep0'\233}\346\036\334`:L\213\320~\375\307I\033R\306|-\337\353\333kU\002\337 \312\261\023\223\301\207\213\242\235:;\205\177}:\254\310~\244\bL\214\3427X\305\314\247\303\370\262\335\275kG\263\305-p\252\230\367v8\313\356^\265d4\215\257\216C\263\334Nl0\321\333{s\253bC\340\341\306\327k\310fm\b\251z\020\032\257Gwa?\356y_9\303\216\"\233u\032m\220ma8[o\253M\tl\203\250\303\204*\2433\367]\177\320\243\2650\234\243\345[fu\302\367\276wR\374\300]3\333f\221M\3246\013eSM\\"
+	.ascii	"\331,4\260\352\275\353(\340\177_\270/|\357\373J\361\024\262Y"
+	.ascii	"\017!z\260{d&\026\247C \233(\027;\357{G\365L\330\351n?9]\260"
+	.ascii	"\320\344dZRJ\252@\001\351\310\250\311,\"\032\022Z*\203\200~\222"
+	.ascii	">=\310c\313\032\337]n\261~:Z\371\314\225P%\216\334\332\227v\322"
+	.ascii	"\353\013z^\334\202\361\203\231\235$}\225\352\031\177\356D\323"
+	.ascii	"4\2354\004o\352\2534\357\357\315\235\031\254ui\246\243\325R\265"
+	.ascii	"\225\262\320I\253\236D'\255\363\nX\234B\365\212#U\013\255\370"
+	.ascii	"\221]\033]\245vM'\205\342\315*\203O\234Y\344\244\211\214\033"
+	.ascii	"\020\303\324\351\253\264\211\221)\344\tZ\323I7\360!cU\226*\324"
+	.ascii	"\276J50\276\026\274?!j/\251s\256\034\354\246\253\324\316\350"
+	.ascii	"\f2F\025JA\322W)\234\221\250M\257\260\377\342\034\310\273\364"
+	.ascii	"O\222N6\371\034\255\344\326\334\272\347*E\322\346\310\036\373"
+	.ascii	"\322G\266\244Z\324[#\323\222\270\304 \2653\243\023P0\332\202"
+	.ascii	"\335D'\375\342\254q\003\234\031\"}\225&12I\300\240\215\231\033"
+	.ascii	"\211\364\007\251\221\031\235\357\373\366_{\232Z\231\373\321\352"
+	.ascii	"}_v4\265\265f\250fv&\314=\202y\bF-\362\261\336\375\316\340\216"
+	.ascii	"\217\374\343\231\250\242\223\267\317\354Zq\261x\243\035\277\361"
+	.ascii	"(){\261\b\232\216\233\005\371\276e\002p\227\320s\\;\243\211\253"
+	.ascii	"\266\321\256\332f\333o4\324\276\237\275!|\211rz\f\233\320\265"
+	.ascii	"?e\017o|0k V\307\201\"\021\215o$\330ByW)EhrJ\330\237rr\261\316"
+	.ascii	"\267a7\275,\242\361\2663\264\036>m\252\377\267\254\207\314(\332"
+	.ascii	"\r\3735\231Ut\233\025\314\271\367}E\254i6\tp7i\226Y,\340\215"
+	.ascii	"\266@\333\354\177\223Z\355\277n\352\225\003\017o5f4v\206\266"
+	.ascii	"\305t\003J\362\354\026\257JV5\025<S\320^\375\226uM\231\337a\r"
+	.ascii	"v\211'\276\371\374O\230x\253\367o\363h\260\243S\342\273\257\235"
+	.ascii	"c_\342\2330\2528\346\213L\342G|"
+	.string	"\377\321\315\231\007d\276\310\311E\251\0359\210vh\256^\362\b&\312y\035\017\363\035\231\377\224\271\013\210\356\251\361/aV:w)\235\271\224\316[M\330\234\325\327f\031\357\034\243\3074\303`\347\027\335\245\233\305;\257xg\025\357\234\242\353\272Qt`3VW\273\257\232\257\371D\207\320m\242\365\272\255\272\257\271Dk\351&\321[\272G\274\263\bv\016\321\204\315 \372\332\374\241\3054{P:\003\240t\356\240t\246z\347\251w\226\032r\216zg\016\357\274\341\2355\0209g`g\fD\316PJ\347\247wvj:_X:[P:7\261\263\363\235\231\336yi\310Y\211\351\234\304t\246 \344\214\264t>R:\033\02597\211\234\231\254s\221\2203\221\220\363\220\220\263\320;/\337Y\371\316A\357\f\264t\376Q:'\207\234}\336\271G\351\214\024r>.\235\333wf\225\316\306w\376 g\017r\356\347"
+	.string	"f\254\203[\002\335\274\232\273W\310\342\t\257 \333\007\245\t\273\257\335\201\335|\335}\r\344-\246{L#\231\333\013I\025w\032\356BN\006\357\344\207\205jTv\340\214\030\375\224\335v\243\355\205o:3\247\342F/|\022\265\252X\200[Hs-h1\305\302?Q\023\233Mt\0344\305Ea\272\355\023%\3039\203h\256o\343\t!!\257H"
+	.ascii	"\217j\366k\231]5w\2107\032;\313^\f\360\312\327\n\306\\@\364S"
+	.ascii	"'\322\316o9\r\234_t\310V\206i\356\303/=S\006K\377De\013\332{"
+	.ascii	"S\222(\207\332Fe\315\320O9\310\315\210\362\233F\313\024\244\355"
+	.ascii	"\315R\306\177\370\264\304V\372\226\373\240\364-\260|\370\276"
+	.ascii	"\n\311\370\276\2663\351e\260\375\242\245\360I\337HO\341\237\316"
+	.ascii	"\021\322\367\020\267\210+\021\301\036\347\243\317=\362\3256{"
+	.ascii	"\364R\207\2367\370\326oq\201oKG\322F\337r\326C\177Kb\364J\324"
+	.ascii	"\352\341\240[T\367u\260\205\016\007\213\\\375\212]\025\213\362"
+	.ascii	"\247\334\320\266\353\273\260\341\202\034ALD\344\372\255\357\372"
+	.ascii	"\216\262\261y\033\264\315usk\233\345z(*[\214\337\372n~T\307x"
+	.ascii	"\366\313\331\tdg\272\347\006\217\\_3\335A\316\332\244\211%4\277"
+	.ascii	"\001\231\337\3747\002\303}C6a~\247!!z\023_\364G\302\023/\364"
+	.ascii	"D\217D\247\275\217\314\217\267 \036"
+	.string	"\255\211\007\263\036\226\371\235E\030\337c\206\236\304\303\370vs6\245\304\013\375\320'\021\236\321qx\241_\372\022U\004\262w\204\357\007\331h\351\002\324RW\266\374\370\371)\273O\212w\332+R\355Q\361\">\255e_\363!\356\323\215\213k\233e\032\3169\263|\251\013\361 Q\255\374\345\177\036\007\342i\216\246\004\f\372\037\215&g\305\003}\320\367Y\024v3?\243\301\335\204\335\013\\\f\334\305\240m\026\350\231\250lR\376\363\"\276Ip2\227\t\362}\317\032\315\245\"\317|\t\006w\003\327\2117\332\212w\236\275\2301\211\342S\270\317\325\253\370\356\207\323K\353\371\206\266\311\367\f\254h\312\374N\215^T\374\371Ws\002\236\344\377\034j\265H\2246\013\233\021\344O\273(\f\2226G\027J\353\363`\3265\030\274G\212\333\2017\232\317;\261\276\347\333MT1\357j\207\365\035\230lh\334\365\364\234\325\365\324"
+	.string	"\313\004\354xrr=9\235)\224O\0367\264\"`\237_.v<\303&\330\372\311\361\f\013\203\202\305x\236\370r\261\003L\253\006\327\262g\306\263\353\301\236]Z\317\032\311\256\345\263\013\n\026\326b\251"
+	.string	"\026\002\f\270h\341"
+	.string	"\003X(\260\\(\240\302\001\027-\260P(\300\002\201\346\225\322',\007\217\257+\237\003\272r|q=w0w\344\370\202\206As@g<\r\350\272\361\204\316Xj\205\335xv\005q"
+	.string	"\\\003\314\b\2615\3439U\004\246U\343\352\211C\013\354"
+	.ascii	" \346\232\222\340k\313\213K\353\306\026U\016\250\026\016*.\260"
+	.ascii	"\035TSL\374\005\301"
+	.string	"\023\214*\354\353\013\214*y7\326\277\204\243`\234^\274\2169<\274\243C\351\026\354\236&q\220\340\201a\235H\207\3704f\016\361l5\366dC\236~\n\300\277x\243_\264\n\2347"
+	.string	"|\363\260:V\030\347\352\364\3236\316f\215\323\034`\2077\2042\347\324tC[\252\357\360O'\r\0249H\365Lju\214\214"
+	.ascii	"\356\3637\365\201n\323h\245~\352\373\f\316\214\324/\035\262\025"
+	.ascii	"\372!\nF/\374\224\243\336\357X\017\243:\352A \226\275X\263e\270"
+	.ascii	"(Z\370)w]\234\272(\030'\207g?\215\365\275\016\244ID\262Ti\372"
+	.ascii	")\263x\016\357O\254f\312\374N\031\36632$\263\242i\370\307\341"
+	.ascii	"\215\016\253cG\344^\307\323\335\306\367}_\347\006?\366#!f\305"
+	.ascii	"\b\0214\374\206?\312\343a\330\217\204\363\255\030\001F\303\223"
+	.ascii	"\240V\205\360\366\216\334\365q\301b\207\211B\326{\205\254?\312"
+	.ascii	"zWJ\272\233=)pI?\315=\016\366\220\262\036\304\247\201\370V\343"
+	.ascii	"^|\230\340\344#\021y\346W\250\200\370&\\\372\351\021\312\bp\224"
+	.ascii	"\232o\244$\213\274\261&\375\224{\332}k3\370\026\007\301}\203"
+	.ascii	"\232\343\302dhl\006l\233\315\360\315fE\317J\337\262\316\2257"
+	.ascii	"\025\336n\372\037\017\274\251\r\035@\n\030\376j\215\026\037x"
+	.ascii	"0\274\324!\033[\313\260\241\202\364S\346;\364\274\302\270k\326"
+	.ascii	"7!\324g\275\273\231\342v\356\033\224!\373\310\343U\037\213\315"
+	.ascii	":\315A=\324a\237rqqq\261\241m\323?\301\221\025\366P^a\333\221"
+	.ascii	"\224;}\247q,\256\030\324\034\031\362\314\247\230\275\030_\b\201"
+	.ascii	"\277\250\201(\346\030S\210FDD\222$IsA\005\304\030\346\244d\266"
+	.ascii	"\001\021\0205DN\315\210&I!\0352\346\236td\305<\002\217\204\326"
+	.ascii	"<\375P\351\206t\360} \004\265\312\237!mI\035\244\177oK\377@\366"
+	.ascii	"\376\025\373D&\227\224\312/\250\332\337pk\321\355\304\261\344"
+	.ascii	"\245z\357\230\331&~W\261\240\t\260\242`i\212\374\3560\366\204"
+	.ascii	"\241\nC\216\307\364\034\304\211>A/.-\004\210W\205\371.Ds\353"
+	.ascii	"\2731\341H]Z\237J\356\200\260\254\247\250\274xb\253C\267\246"
+	.ascii	"6\005\005\021\026\266c\371C0\200\262\321\361\220\007\226K\215"
+	.ascii	"\322\307\243'\2064\367['Nl\324?\351QNb6\253p\2524J9V\353E\347"
+	.ascii	"b\177ja\256\215\232\202Xi\316\335\366\033\201\322\036\265\345"
+	.ascii	"\240\357a\004\217\312\317K\201c\237p\003\324W\2659A\332\2416"
+	.ascii	"Hf\354\354\227\316R\242S\211\034\343\272e1\353.\230\3121\272"
+	.ascii	"-r\203K\240\017?g\214\273\360t\353X\204\220\376\360\234\223\215"
+	.ascii	"@\251\221\261\263`&\033\220\023\306\030\035\026\273\034\226\031"
+	.ascii	"7!\314\222\r\blb,C\250\316\270-M\344\341bj\311\272\035}\023\220"
+	.ascii	"8\215\fH\2278>.h\005\003r\022\250u\3264d@}\356\216\252\n\236"
+	.ascii	"\331\260\007R\301@\r\017\377\2275J\360\036u\362\034\243(R\373"
+	.ascii	"\373\205\034\023\361\214\205eZ.\357\267;\315p\312\224\033\240"
+	.ascii	"\306\246O\375e)\222\2176t\360\305\241\234\313e|"
+	.string	"t\206\272\004\013\345(P\322\341\020]u#:N.7n\212\204\202nh\006\210\345\240\254y\216\312\344\264o\036\344\034E[T\0134\013\373p\n~\275\252J5 |\315\036L,\2011\237\332\253\203AEX0)B\363\241\230w+\306kB\026\252;\321N\354z\242\\\342\356!\267\356\360\312'\212\200\206\025\266<_\377\255m|\233\bh\004\235\301\355\b\232\tO\372\265\245R\033\024\260\210[\221[\262}\326\037\365\214\264\245\346\276\032\3174\320Z#m\372\275\224\230\036E\034\246\300v\310V\256A\306\350\213-\212`\003\213\366\036\250\356\344.L\215$\002\333\f\247\310q\255\272\017\363\322\004\niQ\320\251'ot\242>L\224\203\307\314\320\344\032\2458\342\003\206\0344\311.\247\337O77\247~\252|\307\\\310\363#k\245\325\004%\227\203\316U\260\n\335;\204:C\330\236C\363\265'\244\372]\037F"
+	.ascii	"\0365\311g\034\267\320^\257L\242\301\336\225\341CX\330\304\304"
+	.ascii	"\312C\243(\356\"\324\032\330\211\003\222n\214D\336a\203\211\004"
+	.ascii	"\375\322F\267\266+B7g\223@\220:$!\367\367\312Y\211\341R&PB:-"
+	.ascii	"\177s\022>\223UF\006\020\275r\334\365F\006f \230ei$\030\212\304"
+	.ascii	"\333\361\213F\337\r\202<\b\214fP\n\373EW\001Ihwh\200\334\211"
+	.ascii	"\004(\221#\303D\265d\212x\230\321\271\203}\276\356P\250\315s"
+	.ascii	"\261\b\016\334\376a?\255t\003E)|K\\>\375.f\364R\037\334\350\021"
+	.ascii	"!\252C\f\351\020Q\035m\0255\356\217\350\202\036\026\0329\374"
+	.ascii	"\375\332w\037]k\225\273\230\2205)m#z\3576\357x{\177C\002#tX\330"
+	.ascii	"V\334\027t\267y\207\032"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.232.e09a4ef4ab3f58a1,"e",@progbits
+	.ascii	"(\265/\375`9e\215,\001\372\350UlQ\020 fi\215\001\363\262\300"
+	.ascii	"\247\254\f\343Y\267Y\236\214I\246\006\002\022C\236\274\207\367"
+	.ascii	"gq\200-\247R\374\266gl+Chl\200Mm\306\332\270\301\276\003\354"
+	.ascii	"n\300\030\261_C\364W\310\016U\334\005z\307\202\272\326\252?\326"
+	.ascii	"R\036\021I\331RJ)A\006\213\006\363\006\254s\337\271\316m\307"
+	.ascii	":\367T\307\271\245\254s\327\3518\267\032\326\271\323\270\316"
+	.ascii	"\215\206u\3563\256s\233a\235\273\214\353\334dX\347\246\323q\356"
+	.ascii	"9\326\271\345\\\347\216c\235\033\316un\032X\347~s\235\333\215"
+	.ascii	"u\356\250\353\334m\254sC]\347fc\235{\315u\3561\254s\253\265\316"
+	.ascii	"-\246u\3564\326\271\237:\316\035\206un4\035\347>c\235\033\214"
+	.ascii	"\216s;Y\347\376\242\343\334f\254s7u\234\273\214un2\327\271\307"
+	.ascii	"X\347\366\342:\267\030\353\334a\256s\203\261\316\375\345:\267"
+	.ascii	"\027\353\334]\\\347\356b\235\233\213\216so\331qn-\254ss\3518"
+	.ascii	"w\226\035\347\306\302:\367\f:\316\275\265\343\3342\260\316\255"
+	.ascii	"\245\343\334Wv\234\333\n\353\334U\\\347\246\262\343\334SX\347"
+	.ascii	"\316r"
+	.string	"\235[\312\216sc\261\316}\245\343\334Qv\234;\006\326\271\241\35087\f;\316\375\204un'\256s7\331qn&\254s[\271\316]\265\343\334L\326\271\227\270\316M\265\343\334JX\347\236\322qn\251\035\347N\302:7\022\035\347\216\332q\356#\254sC\3518\267\221\035\347.\302:7\021\035\347\036\262\343\334O\254s\013q\235;\310\216s\003a\235\333\311u\356\037\254s\277\340:w\023\353\334>\\\347\356\261\343\334K\254s+\271\316\235\264\343\334K\326Y\351:\277\254s\322uFb\235/\340:[`\307\231\007\353\274\303u\326\301:\347p\235q\260\316H\327\371h\307\371\310:W\300u6b\235\215\256s\021\353L\344:\017\3558S\200uv\301u\026b\235o\270\3166X\347\032\256sq\3079\210u\006r\235i\260\316D\327y\002\254\363\217\353,\201\035\347\b\260\316\020p\235\037\300:;\300un"
+	.string	"\353\314"
+	.string	"\327y\001;\316\n`\235[p\235\023\300:\263\340:#\200u>\200\353\274\302\216\263\001X\347\002\270\316*\260\316\004p\235\007\300:\013\300uNa\307\031\005\326\371\004\327\331\004\3269"
+	.string	"\256s\t\2543\t\2563"
+	.string	"X\347\031:\3162X\347\030\256\363\b\2543\f\327\371\005\353\354\343:\273`\235Ep\235C`\235[\270\316,Xg\020\\\347\017Xg\017\\\347\016Xg\016\\\347\rX\347\025\256\263\212\034\347\036\3269\305\007g\024\254\263\006\037\234Oxp\316\200u\306@\307\371\002\326\331\204\353l\001\353\\\201\353L\001\353<\201\353\314\223\343,\001\353\\\302u&\301:\217\320q\216\200u\026\301:C\220\343\374"
+	.ascii	"\353\034B\307\331\001\326\031\204\216s\003\035\234\031`\235w"
+	.ascii	"\330\371\003\353\354\301u\326a\235;\270\316\03488\347ppv98o\340"
+	.ascii	"\340<\314qnYg\326u\026np^\207\316\301\326\371\207\316\336:\267"
+	.ascii	"\233\371\264\031;C\266\367\366ua\313!\201q\226d\3261V\332K7Y"
+	.ascii	";s"
+	.string	"\363\221\232\316X\332\225\2304\206.Q\364\332KDP`\275\305\034u\032C\3358O\247\2667\313\3452H\333a\230]\326\321Mn\264u\217\r\206\252.\313\345\322M6\030\034<=\302\226E\330&fX/\251PX\275\317\270\277\264SG\203\301\021\f[\026)1\026\344KO\257\334Jm\257<\3016\323\301\354\366\352\314In\260\036\3532v\205\240\220\361\b.\257d\354\321p\305\250\355UH+\254\305\222\355\205\007\217R\330\222\210\333\304t\213@\333\253\007\027\362B\201\231\271\273\264W\262\277.\020\\J\205-\215\3544U\211\351\362f\271\fC\321+\253h{\345\260\006!\354\265m\006\204\275r\007 $Y\371\200\217$\275\r\366\334\232\312\336,\227a+>J+\233\241\314\306k<\206\325X\f\247\361\223\3030\032\2371\030v\362\0276\343&\2271\031\217\261\027\026\343\260\030#\300x\341\343B\204\020Z\260"
+	.string	"\341\003\017:\340`\203\025*zR\240\320\340D\006\030\\`\302\202\n(\230\200G\202\022$FD \002\202\007B8"
+	.string	"\242\001\006v>x\320\351\300!\307\3350lY\341\032|Wr'5CYt\265yR\007\246\bT3\033\232'\277\2525\277\2471\200j}T1}si}\317g\337W\0307\317\276*hn\236\372\252\316\372\236\300T\237\370"
+	.string	"\235|\324/|sf|\317&\337W\231\334\023_\025\231\247=U\001\307\324<\253T/\3259\261\350S\365\311a\325\257\030\325*#"
+	.string	"\302\330S\363\"\315\323\336\234\317\232\347\336\323E\365\271\367%\302\323^\225\020\332<\355U\265h\276\347\336\023\013\2756\020\236z\317\017\236\364\276<\320\253\322\201^\025\007zO\033\320\001\256\240>\351\250*\350\276z\232\356IW%\205\034 \n\271\246\006rU'\324d"
+	.string	"\227\005\003\274'\334\323\005\325\347\333\234\211\274\347[\025\013<\3163ZA\3363JAtn\2024\317\350\223'\372%A\f%\326<E\253HD\231F\240yB\001#xB\251\"\324<A\347 \370"
+	.ascii	"}B\237\017\204\bz\340\343\315\222\021N\226\246\004s\3404\241"
+	.ascii	"i\031\210Xq\007\326\236 v\002\237\326\252\032\b2\320\200\223"
+	.ascii	"'Sz'\250\001\03357m\206HV\020\304\220*N-\003\021)\376\341\371"
+	.ascii	"\004\346\001\357\t\214\252\323\326\241\003X\223\303\334\023\330"
+	.ascii	"W\016\333\023\254\212+\367\004V\265\241\356\t\354i\330\366\364"
+	.ascii	"\002l[\356\351Ee\035\372\364\232\023vY\273\022\013\366\3264\245"
+	.ascii	"\035q\362dJ\257YR\260\256\254\252\230K\250\224LI\ry\022\022\004"
+	.ascii	"\210\323\217\027\002\001\377\342\370\301\351{\223G\305[sg7\225"
+	.ascii	"\322\315\311\305\301\321\360\346\226\366\f\203v\006\306\371\005"
+	.ascii	"\354\313\253K\027\227-Z\252P\231\202ueU\305\\B\245dJ\350\202"
+	.ascii	"V^;!\"\325\304$tA+oC\021\037B\027\264\362\032p\262DE\205\240"
+	.ascii	"\207'T\372\203\032T\305\035\351P\244G\020D\231'k\272\254\035"
+	.ascii	"H\221%wV\306r\271dw*b\244Y\001\315\334\222`^\217\230\031\300"
+	.ascii	"\flk\026|\307M)\370\n\260\202jb(\370\016\304\342\371\t\336\241"
+	.ascii	"Y\301\347\f\264`\230\227\212\225WKK\330+\317{\335T\315n\353\203"
+	.ascii	"\236\235\025T\263\214\006$xf%V\020\2142\353\237\322\240\263\235"
+	.ascii	"j\330\353\366%x\037(S\325\222\007r\207)'K\367s\177S\305\311\300"
+	.ascii	"\007^\342\273\0314S2;\316U\331\033\330x\037F\342K\274\210\255"
+	.ascii	"\240\227\031aA\261\027K\273\\.\271\336-]\302^I\274S\247_J_\335"
+	.ascii	"\201O(\232\231\203_Id(\260\036\374z\275PX*A\241\030cR\035Ys\322"
+	.ascii	"[\254\234\331y(\334x\335~\337\\\270\317\222<\325\210\360,;\003"
+	.ascii	"a\367}\373}7I-\005\271\004\273\224Y`\257\230\230\260\327\356"
+	.ascii	"\373\013\260\244\302t_\235Ib\006\255\373\211i\212H_N\343\020"
+	.ascii	"\366\331\233\035\224\tP\"\037\266\214\340R2Y|\025\226w\254G\372"
+	.ascii	"\226\265L\217$\202\037\361\0165\013\312\360:\273\354\212\337"
+	.ascii	"\263\240\326\033&\306\325r\271d\321+\007\255\004\257\274ij\357"
+	.ascii	"\332\232\260\327\b\276\313\260\276"
+	.string	"\002K\210\325\375\271\220@\017X x\021T\224M0~H\226r\252G\372J\275\367\"\272\315C\340ju\177~N\177:\017\\\275\3207\3322y\234`\fl\234\323z\311\354=\226K\245\n\230_\270W\316\333\351\201\347\351\361I~ju}f\232\272\235u~d:\204hbu\306\201\017A\027\\B\345@\337\tQ=8\364\201\230J\322\326\300\203x\017\363\226\t\036\341\0214\022\204z\317\274i\336\272:a\257\r|?\371L\240\363\244f\0319k\f\020Q2_<)\247z\256\334\311A\247 \220wz\367\342\341\t{e\240:B\254n\017\260\352Vw\276\233\301\027\274,\310\224\345\303\357\004\225\202K\312\274WOO\330\353\207=\022e\352\364\374\272\235u{d6\260\314\016\357\341\273\031\\*\233^\\Y\001|\242\363\036\374\366\336>\327\341\360\035\276\233"
+	.ascii	"\337|\337[\345\236\302/\337\333\347o\237\260W\016z\021\274\275"
+	.ascii	"\351v\326\351\221\031\302\361\273y\375\274\235\370\333|\365\375"
+	.ascii	"\0136\343\tkP2_\\\261y\003\223Z&O\342\316::3e}\002\224\223j\263"
+	.ascii	"\214V\310\347~\316w\363\361\224M0\234\310\235'5I\227r\324\370"
+	.ascii	"p\345P8\353\340j\220c7D\207\277\341\273\371h\224MM\367\243ej"
+	.ascii	"8f\224S\315vEF\331$\206\364nN\tDH\313\324n\301\345\324'\301\r"
+	.ascii	"QF\t\333\251\327\r?\224z\267\177S\026\t\366\024VB)\243\204Q\302"
+	.ascii	"^\207?\224r\326\301\211\350\253{3\223\327\355\254\203\023\n\327"
+	.ascii	">\360n~\233r\252\311\250Z\246>cS2aH\255Z\2466\303\240\327n\376"
+	.ascii	"\030e\223\236\253\345\222\251\235\224OZ\246\326\202A\257\314"
+	.ascii	"J(\312(\336N\314\303\364I\314\202\223"
+	.string	"5\335und\222\374/\2505\227\265>\224\177\362\247\271\235\235\361\2431\325g\215\024\230/\374N7g\031\177\223\251>uR_\274\360\217\271\231\201\361\2071\325G\215T\263\013\277\227[\331\026~.L\365I#E\226\205\237\313ml\213\177\006\246\372\240\221\362r\205_\313M\214\n\177\025\246\372\320I\205I\341\317r\213\021\205\377\212\251>sR#\300\300\017\205\251>r0\232\360;a\252O\334\213*~+7\037*\376%L\365\211J\271\220\342\237r\023!\212\037\tS}\332\244Bx#\374PL\365\201\272\265\370!\374D\230\352\003e\021\204_\b\bV?\370\235>\250b\342o\362\200\271\304\337\243\203%\277\344O\342\200\352\217\035p\003%p\330\375VL\361\261\277Q!\325\206\275\332#D\217\275\206\024A\250\354y(\200\334\261\257\321\300I\312>=\361#\r\273\232\f\370^0\303~\006\203@:v2\027"
+	.ascii	"\306\261\313\231\360{c\247\301\0028m\354\321\n\362\326\330\331"
+	.ascii	"(X#\206]m\202i\030\366'\317\034\030\3663\t\340\314\330\277\224"
+	.ascii	"p#c/#\021F\214\335\313\b0_\354`\021\200u\261w\021\361\245\205"
+	.ascii	"}\013\004^X\330\263<\320E\006\366\255\020]V\330\2578\300e\n;"
+	.ascii	"\025\020[\256,\231`\261Ki@\313\225%\223\030\330\2430`\345\t;"
+	.ascii	"\fLu\021\225\332a\302\336\204\251.\332\334>0\331\253<LQ\302N"
+	.string	"\305T\027iR:\236\204]\252Cu\211\037a\217b\252\0134\016E\330\2150\325\005\231[\316\023\373\0207\020\b{\220\r\200W\226L\374\005\366\037\303\277+K&>\330\231\230*\002\240T\353J\354KL\025\341\217\rd_\n\341\\Y2\211\303\375\267\366\365q\303\t\276q\303\315\307T\021\370\334~\217\273\215S\331p\3535\336\225%\023<n*S\333Vf\t{\355f\262\334[s\205\271\357\230\231\332A\027\336\233\3452\251\2538\311Lu\247\345r\271\\\236\350\265}\007\302\226\252\034\220\231\225X=Uf\265\313\345\222\005w]K\225T\254(\265\224Z\302^\333\017q\242.j\206L\367W\363\210\351.\353\376z\362b\322\307F\311\375\230;\215\322\353\323\244\313\345\262\235z\f\263Q\243Qn\261tQ|duY.\227!\364\312m\246\317(\261(\271\224[\224[\224]\254\364j\231\0309\301\224n\300\005"
+	.string	"c\242\344~\334A\313\311\322\375\270\325\272\221lY\022Eeo\351~\314~\213\021>\373,\263\022\254\351f\264\313e\017\026\334r=G\002\367\224^9"
+	.string	"'\234 \354U\370M\207\365\245\344\201\354O/W\253\226i\022\354~\277'\023\257\177(\314)\b\327\2471f\327\303\341\260\b\347\260f\250\220Y\005\003x;\255\357\001\223\036\237\304'\352\274\332|{\t~\267\371`\364"
+	.ascii	"\374\364v\352\365?\305\364D\035\227\231\245\373q\357}\2235\217"
+	.ascii	"\222\373\261\177\357\275\247i\002T\362@v\300\373\231[X\200\260"
+	.ascii	"\235\374yz|\022s\2575\033\247qO\341\006\360\323\333\251Wn~\n"
+	.ascii	"{\355O\201%\245\344\201\334e\275\341\331\305\244\257\206\245"
+	.ascii	"\3731\207-up\271\\.\375\241"
+	.string	"0wp\271\\.\371a`\316qn\277\034\347\356k/\315\335\246\311\232{\217\235;/\307\271\2519\316\215\227\343\334k\002\\e\250X\002\271D\220\313\372n\266@\224\314F\273j\177$\251\230-\023;%\345;\313\252ez\253S\244\264=\260\276\351\246T,z\324\2558\335N*\226\020\324\256\276\233\255R\273d\231\242|_5a\377^\247\fQ\374b\370\216N\267$\230R\265\372\266Z\320A\371n\262}Jf7\371\222O\240\264LB*\f\337P\242\260m^\247\026\030jx\362=\247E\345F\213\005\227\0236Jf\fj\022+\253e\022\3065\371vB\205\275{\253_M~8e\362\035\245RQ\247\366\250@\340\262\252S2G\270J\243l\322#\025\206\251\372\266\262\302\232y\253dUd\230\337\320\351T\2112\324$l\246>\360Z2\027\007F\365\275D\213}{\253`\250\242J\250I\250QxI<"
+	.ascii	"\233\372n\262P%\263\311\326\222[I,-\2230K\352{\212\213\025#F"
+	.ascii	"\352\231\344;\016K\212\032E\205\262\353vR\243:@\362\335d\321"
+	.ascii	"X0B\252\250o$[X\263\327\331\026\365\303\262#\337mT(j\221\272"
+	.ascii	"n'\025\212\003\250\357&;\246d\276\220\212\275\201=R\341\020#"
+	.ascii	"\337P]\354W\234\221.E\276\331\260\244\250E\356\002\321t;\251"
+	.ascii	"E6HB\344\273\311rQ2aH\265$\275\222`-\2230i\3107\0211\026\313"
+	.ascii	"\35343d\353\351\033\212\025\370W&p\005\333%\344\273\311j\261"
+	.ascii	"VVj\220o!c\354\224\267\332\256yIiR\255\r\362C)@\276\243\323?"
+	.ascii	"\277\271?\025>\276_\370v\372n\262W\257\025\213\030\324\364\217"
+	.ascii	"o'\366\211\223&?\276\321`5}\277\300ZU1\333M7\365\370\366\341"
+	.ascii	"d\251\336\252\327I\261J\222g>7\365&\251\346q\303\036\357uH\226"
+	.ascii	"\336\343\260\370FL\357\252\016\327\355\274\343\353\tT\372n\262"
+	.ascii	"G\224L\026R\326\310\\'}+\ry\253-\307\006a\237\222g\315&e\205"
+	.ascii	"$\001\223j\375\274j;\351[\216u\352\345\367\263\272\347VMq\201"
+	.ascii	"O\276\362\273\311\276\3002\261\275\257d\227X%6\351E\372d \340"
+	.ascii	"_\307AzG\233Z\340/\340\367V=\357\215\020N_\020\326\002\357yn"
+	.ascii	"x\274\323a\321\311A\351P ?\307\357hS\303\231\216\337\221G\305"
+	.ascii	"\323\201\343s\334\331M\225\3408zd\035\032\241\2324J"
+	.ascii	"\204G\357xf\216\357r\323\267\350\2307\r\210\336\370\025\370n"
+	.ascii	"\n\311\b\347\274\030}\005\340\336j\247\241!y\326qoR\243\3574"
+	.ascii	"Eo\214\276U7kK\2365 \264\371\212\336\315\260\206\236h\355\255"
+	.ascii	":\236\030\341\030\241\332\325:\364\216\367\244\300\273\334tM"
+	.ascii	"-m\355D\215\277\361.\240\201\341\"\364.\2305\313\204l\374\215"
+	.ascii	"1/bYl\024\277\006\330[\365:a\027\341W\362\314\347\274\262$\325"
+	.ascii	"<.X\344\022\344\325\205\346\225\301\317\023\037HK\026\031h<\320"
+	.ascii	"\226\fZ4&\360D+U\250\220M@\002\377\223\245B(\005\213L\002Q\""
+	.ascii	"\300E"
+	.string	"\242\357\016\213\223\013\003.\006\274\003\036\002P^+\026\302'\253\224\007<\004\230\274\325Fse\225<\353\250\264\n\372\200o4\rx\007,y\253^&\245J\236\365\337\225\222v\323\200\367\262\351\002\236\001B\251\267\352u\302$\3113\237C2&\251\346q\013x\257;\242\200\3678-\347\235US\353\202\350\001\236\205o\341\273)4\362Z\265\220\n\211\274V=R&\t\370\026\312\204B\336j\253\271\n\222<\3538)\220\266\253\004|\253\301B\300\263`&\374\361V\035M\372B\362\254\003\257\232:\016\002\336\321\246+\374\001\234B\037o\325\363z\204=\222g\236F*\\\"\223Ts\272\253\025\336\363\204I\006x\247\303\242\022\273\233\032\2432\001&\200'\300\027 \360\265j\361\267&Q\341\013P\266\302y\253\235\246/y\326qo\240*|\247\031\300\023\300lu\363V\335\254\232<k\3006\3157\200w3\254\024^"
+	.string	"\316\265\206\267\352xz\3113Gs\305\3110+\233dZ\273\346\275\324\244\232\313I\373\001\302^Sx\307\303\372Z\327\254x\017\340\236\302\311\265$\024*\354\025\205w\271\251\324]T\211\267;\250\260n\347]\224\005\356\036\t\037\200?\341\273\271\332\275V,\256V!ReS\217te2\341OH\261\246\231\321h\320$\337:\304\0313&|\243)\341\003\320\263\222\231\341hWt\3117\377"
+	.string	"5'W\302;\032\326\030%\017d"
+	.ascii	"<\t\274FW\270\031\336F\272"
+	.string	"\\\366\b\2019\031]iH\276y\004O\240q\32677o\206\n{\005\300{\233\351\230\300\022S\273?\257\300\n\300f@\225\314\021\326\222pI\271\226)\350F\306\317\240[\305\360\350\020c\3207iO\031\337s\177jv~\\\376(\230\212\201\006f\315\b\037\243\314j\326\246Y6\302w\024\313\217\204\323\256\217\253\333i\347Gf\0026\t\214\357\346:\266\212\005\315\274x\030g\326\257\031\r\342\f\224\215W\227\027\337Q\254>\276\031\372x|\270hys\361>iV,kf\330r\361\335\306W\325\342\223@\004-+h!\274\bu\353\024i\226\224\020\252$\364\354\366\252TKh\265\270R2a\2541\004\301X|\213\351\372dF\207\200\202\242q\322\204\305w\334\236^\326\036\t\020\254\230Y>x\020\356V%d\246\244>\370n\233\352\215\350\263\243\273\352v\332\351\221\031\001\345\001\022%\263\305z$H\245\203\367"
+	.string	"o-2\243A\254A\273TuY.{\260X\211\254O\353\220\013\b{\355\340\273m\372EGbj'\007\205.\002\326\212\203\357\346\032D\311l\262\325I\t\244G\032T\262\301s\220\2676\255>V\246\244\336^\262Z\025\366\272\3017\333T\356\004,ND\260S+\276\233\353\222\222\031\343jM\n\376P\361+\222|A\3008\301\277d_\322/\371\227\374\023\366\252\342\233\r\013n\317\n\202h\017\034%\263\305\233\327\252G\032\310\311\300`5\270\027l\363&-\275>|\b{\355\371\341\233\236\035tI\267\323\356\215\314\003\032|\212\357fPO\331\324\200\322<e\223\246>\033\024\237\242)\270\346\016\305\373\334\3645x\021r?\202\323\027H]P\372\n\031\362\026)\"\354\365\304{\340T\030e\275\267\036!\372\215\022f0\345\027*\210\346\215:\223\301c\3405\345"
+	.ascii	"\006e\224\314\026Wto\222\036\351;\3252}\335\005\217\001\\0\356"
+	.ascii	"uR\275L\246\260\327\013~(e\267\245\204\323\216\013I\267\323n"
+	.ascii	"\013\b\367o\202\257\340M|7\203o\257U\214\253\267I\313\364r\301"
+	.ascii	"\350\373\244G\372Bi\231\036M\352\223\330\2027\021%\030|T<\342"
+	.ascii	"@\022\2135\206\\\f2\022\375\330\300A\243\030\344r\021\307\020"
+	.ascii	"1\307Oq(H\350\007"
+	.string	"i\274q\024\364A\207\207\214@F\244\361h\364C\244\303\350\207\001&\322a\364\023T\004*\342qT\204\343\247x\204\343\003\037\213AB9\214G\243\237\035\307!\242\320\261x\264\363SD\022s\b!\201\210?\305 #\321Q\210(\342G\004\017\031\215~\200\216\037\230\350H\374A\036\035\205j\374\024\031\177\206\210@\016\330 \022q0\036\2114:p\361H\324\021t$\336\370\001\002\"rpw:\260\005nx8:\"\032\3510\356p\r\243\241\341\217\016\"\017\016\034TD\244\021D,\006\r\211p\034\005\t\031q\340\rH!\"\241\241\037  b\207\242\016\007\330(\204$\036\177\212\214BH\342\016\342P\361\370\203,\036\211\330\341\240!\343\215\243\342\361\006\362\207\007R(\007\361h\343G\bYD\f\221\200\"!\025\2203\202\204\214>p\221\020\321\306O\220\220Q\0076\302\021T$\244C\210\003\327\250aD\342"
+	.ascii	"b\200-p\343\347\006\020\322X\244\243\203\310\303e\013\334\370"
+	.ascii	"\251a4\304\341\347XD\016\t\325\370!:\026\221A;6\210Dl1Gqh\230"
+	.ascii	"\203X\324r\t)\254p<2\032\265GF#\344\020Q\007\221\007\313%\244"
+	.ascii	"\260\302\r \244\220\321\220KHa\205\241!\343\261\345 \023)\206"
+	.ascii	"|TD\022\217BF\026\t\031\215(@,\036i\374\020\215\220:L4B\016\371"
+	.ascii	"x\0039\344 !\242\237\343\rdk4\332Q\324A\344\361\223\303F\243"
+	.ascii	"\035\305\"\222x\374\001:\266GGE \343\321\350'H\310h\207\211\214"
+	.ascii	"E\305\240\037\240\"\036\036\270H$\20442\032\207\206\314B\007"
+	.ascii	"\256Q<\"\2114r\264\234\002\207\211!\017\r\025\201"
+	.string	"\220D\0329< \2114r\270|CE\321\006\0219d\314\261\342\350h<**\036\221`\034&\236O\340\340\007\b\210\310r\220\211\024A&\204\234\303;L\354\330`\345\342\020\021\350\350\307x\344a\303\335A$\312\341\342\020\022i<\336@\026\t\021\345\260\r\343P\016\007\231\370\243\342\321\210\310\b\304\263B\007\0162\261\"\310\204\220\207\2109\216Ed\221\020\317\n.\027\211\210E<\310\032\304#\t.\013\271\210$\006m\240\202\003\025\035\b\371\310\004\317\211#\023\031\360\034\231\34092\321\201\213\214BGB9\212\307\035F\336\260!4T\243\210X\034\"!\207\217L<\027\215x y\212G\242\016\242\243\220\t\035\370\206\n\243\237\"\222x\004Z\001T\303\202\035\305\240\"\241\037a\221Q\b)\024Td\004\032\"\213R\320a$\300\007dQ\n7l\b\241\200\304a\204\304a\200\243\021i$\332\341\026@\"\324"
+	.ascii	"\201F\215\242\212\006\212CB5\214\307\025\212H\"\002\206\214G"
+	.ascii	"d\221\221\004dQ\361x\304\001\004\001\003\251\330a\244A\001 \342"
+	.ascii	"\020\215\025EBD\242\025@\307\243\025*$`\243Q\361\270\002i4\036"
+	.ascii	"W\270\314\314aJ\3750pO\341\2133K\013v+\205]\326m\234=:\263\264"
+	.ascii	"\347V\n;\357\2010"
+	.ascii	"s\347\275\377\022\267]\263\214\017\f\004\224\266p\"O\215\372"
+	.ascii	"\201\312,\235\253! \233n\274o\352\3770\2162\253\035\372\341\275"
+	.ascii	"\216\037\233\276\032<\fY\222\\\002\330\"k\276\233\303\276!\337"
+	.ascii	"\006\273\026\230 a\r\333 e\3250\334C\242b\005IKK\330k\257\371"
+	.ascii	"~b\345m\205a\341\216\315\220\272a\316\356\373\356\035\212\264"
+	.string	"5\274\033\332\331}?\265\242`\020\3205\225\252A\223~O\261\f\317\230\221~C\261\362\254\314\232e\034\200\252\356\2739$3\234\333\320E\315w\035\327\020\216G\267\321\200\004\326loj\276\333\246\314(Y\263\214\025\272\322|7\207\321!t\303\025\232\3574[\206cft\234\032\022X\267\211A\363\0357\245\002\0233\300\326\231'\332\006$f\276\317\274C\273\206\316\031\035\2252\222\327\360\013\022XC\257\226\313\036F\206ff\276\243\323\251-_\005`\226)S2\233l8\266a\211\314w\031\261a\330\f02\337lI\370\272T\200\243\363\352\222\316}\323\215\r\265\360\340\232\373\216\303\212\252ji\226A\2007\271\357\346\020\313pk\030&\356[\256lx\305J\334w\034V\036\324\026\226\001$\201\373n\016\251\f\263\206]4|\303\231\r\257b\030FAr\236!\205\t#\354\265i\370N\233\346\025\321\223\241Y\206"
+	.ascii	"\240o\337\315!\fC'C\030\334\276\337\322\206V\314a\025\222\332"
+	.ascii	"\032\022\024\352\366\035\207\025he%\005\250(\325\324\020I\333"
+	.ascii	"w4:Drd\030\205\364\006\207$'\327\366\315"
+	.string	"\206\365\3075\005\005*\250\021%s\204\253!\221a\323;\224n(d\306\020\3100\bR\2313Hi\322\b{m\266o\250_\027\326\tVk\337\315\341\217aS\337\230\357\265wh\335\260\307\214\341R\217\371\216b\365\3559\211\241Y\206\tj\337\315aR\033\330\342\211\371V{\2072\315\245\365\227\016\235\366-\346\233I\206%\017\344~~\247\375\210?&6\337\317o\244i\353\307\243\257\205\203t\207\204\207\224\207\224'\354\265\303|\313a\361\225\241V\237\004\240\n\346\033\355\273\331\362)\233\232\254J\303\3317\232^[\203\336\331w\233\363\033\314^\233Gu~\003\356y\225\030U\317\f\223f\031%l\360\352/\337\315v\215\262i\004\273\366\254\311\354\373K\265\255\343\241\306\354\233mZ\366\335\344k\321\3608S\366\355fJ\307\305l\226A\002\025\331w\263-\323\322\265\\\306\276\311\372\3328\270\261o6,9%\3152"
+	.ascii	"\260\345\345-\332F\021\373\366\342\327\262\255\211}C\261\340"
+	.ascii	"L\350K2C.L-\215\t\366\035\206\364\327\242\265g`\337h\324\267"
+	.ascii	"?\322,C\306\324\227\323\254\035\342\365\375\205\024\330\222\215"
+	.ascii	"y}C\243_\244YF\214"
+	.string	"\276.\337\315VL\311l\321\202\265>\272\276\273$\265]Z.mWr\311G\262\251I\330kw}\247Q\241`N\236\232e\214\260\305\345\273\331ji\263\260{[\276\271\374h\267\236\266hi\371\216\202y=\0200\030Q\\\337\315\326JK\205M\223\345\233\013H+\345u\036\311r\205\345\033\212\345EB\214\332\365/x\275\210\232\341\273\331\306\240d\276haH\nI\016i\231X\032\266\276g(\3226y\235J\266Z+\031\276\323\250]\324-\357\243\313gK\353\273\3312[*\366\354\312\267\026T+\365:\231\\Ab\345\033\272E\002'\225\353\225\266\270\210V9\242dv\323H2*\231\244ebg\240\362]e\252\035\362Vc\240\322\n\231\362-\027\207l\250\343\360\246\221x\325*\304\220\310\210H\222$\031\326c\033 \f\306\2218J\035\232\007\023\200\003\311j\363q\232Dj\222!\004\335\244\222T\007\031\253"
+	.ascii	"\034-\227S\313\210fy$\336\354\316\265\244\"@&9\313\344^A\304"
+	.ascii	"\222-4\"\f\305R\03617%\210D\206:\217\341\031\322x(\350\226\272"
+	.ascii	"\260\201v\304\2603l\004\0364\360/\320\213\270\250\"\265i\217"
+	.ascii	"e\222Vz\006\247@n\002P\013F\213\2768@A\004\331\317\250]\374\343"
+	.ascii	"\246#\300{\321\206\370\325\243>\017M\\\220\007\3307y\307\273"
+	.ascii	"\037\325+.\026\020\271QwP\335\"\006\032\267P\245XH\216a\3219"
+	.ascii	"p4/\b\305Z\250?\244\350\r=y\215^\"\252\242\025\232\022\005Q\321"
+	.ascii	"(\213E\035\026EC\254\310\354\340\302q\027aL^\214\235 l\262\250"
+	.ascii	"!\342b\352\274\213)\030\r\300~\357[\350\371\315Z\370of\237\232"
+	.ascii	"\254$\027Y\027_\221/\206\007\350\334\246\304\215/\320x\250#\240"
+	.ascii	"\316J\247\334E\030\360\316(\320\345\030\335\251\250\rG\003%\321"
+	.ascii	"\254_%#\315\272\300|C\213\330>\261\230CTqZ\037]^\002#9\341\347"
+	.ascii	"R\226\213\333\222R\t\205xR\335oQ\335\264\374\007\215\223\334"
+	.ascii	"]t=7@sX44+\334\334\254xy\262\203\226\322\270\234\237\207)\f\307"
+	.ascii	"\333\322\007\372`\232\222%\307aYk\323\317 \3631\371\343ou\262"
+	.ascii	"\3238\202\375\372\037\356\023\234\301\263x\n;\022y\330QI\035"
+	.ascii	"v\0028E\335\t\317\037f\364\003\307\310\263\332\356\332X\374@"
+	.ascii	"\017\024\203_\247\341\353\017\302\022P\215\251\240\253&\310\235"
+	.ascii	"\364\030\375\355\020\034S\227\354\357\034q\227s\300MQ\270U\354"
+	.ascii	"!\350P\021?\341?V\332\346\244\036z\373\0325R\204O\312\253\355"
+	.ascii	"\302\212\342J\266y\327J\275D)\316\023C\306\"\300\033%\241~\205"
+	.ascii	"\262x\321\252\013\353\353%&c$\351x3\375\240\034\253\313\206\251"
+	.ascii	"\002K`&\264\343\317\201\306^ \351\321\375\341=JQ>B\325\372\215"
+	.ascii	"\025Kk\234&S\200P\251\004\317>\216V\357a\177\f^\336\355\277\326"
+	.ascii	"\377\322c\351$\322\207\354"
+	.string	"\222\246\231\322\350 +\325|\254\013\177\261\225\300=\363\022l\273\274\223\024q\234\367\330E\347\307>.x\270\337\245\"\2500R\256\252=\322\201v\352\245e\t\275\310Lx|\227\271\365<\374\3050\314\\x\341\351\016pKdP\364\032\307D\363D\214O{)6=\263md-\257\333B \033\017\255\310\363\220B\252c05\023\t\205\306\372\274j*\223E\016M\254\231ctnr\342\275(|\347\363\220S\353X\321L&\37174Yw\007\232?G \260\357z\361\363\244\204\"r\013\327\241\331U\220_3y\365G2<\236)Jh\362\311\336\350\177\226Dd\025.e1\323%-\325O\256E\374\325@\233L\024\350$\006\032\213}=F\376d\311\336Cb\024\233\363D\342\313\325\315\210\316\317\023D\231\275\222\340K\350\024\213[V\360>\360O\247.\256\243_\242\003B/\245\001ta.\214\"m;\341e"
+	.ascii	"\0304Y\240\223\005\b\345\001\003\366.\312\212-\024vF\275\375"
+	.ascii	"\214\215\203\314\346VD$ \370%Ex\302\026J\253\035#D\344N\313\274"
+	.ascii	"]\025\303A\204vQB\017\255\376\003\235\326\374q\227\001\246\210"
+	.ascii	"\204\276\027\035\027(wa\203\305U\343\213\376f\3011\324\225qM"
+	.ascii	"\372\235\226\336\350\341\271'\035\233AA\"\355v\373\330\307(\031"
+	.ascii	"\273\035\301\356B\r\023\031i>A\240\252\0057\221(\245\237\023"
+	.ascii	"t\261\036hP\312\316)^\342C\310\232P/\030\326\316R?l\302\325\234"
+	.ascii	"tX2\255\033\325\005\347\304\2760Kt'\266\2669lVa\202t\260\357"
+	.ascii	"\026w^\001+\r\"H\207\305\356\n\315\253~\frC\230&\261\210\330"
+	.ascii	"\333\002\275.\242\273\362[d\235\214\340\037H"
+	.string	"U0\342\020.[\231\271\314\035\310\020\336\350\303\025\275*J$M\022\2702d2\27134O\034P6V\240E\330\340\316\007\344\212:6|\3250\0216\320aA\353\003\220\265\243\304\263\316\177S\361k\360\344\356^V\340\237\217\237\364\363\211\310s\203f*\220\217\031\304\023\250\031\215\220\356\251\273\216\017\320\0351\243\213\fs\013%*\212\220\323\214"
+	.string	"x\204\307l8\b\002\362`8/\227\215\351\300G\327\336\356\351\311\250~\324\335\fo\267"
+	.ascii	"\247)\243\013cb\002\366"
+	.string	"{}\323\037\037\204t\022\265a\273A\340\032U\233\274\306tS0_\\N\271\247\016\364\337\364\031\362\031XT\322\227\342\371\372R>\036\020\031\317\354\"\033bk\001\272 \257_\363rY\347M\243\027\317\377\246\001\245\241\025\342\325)t\250n\236\212\357U9\r$\2429\245H\272\222v\335\246\"6G`j\013\2551\270:\243\303L\204\340\244\342\177\374\2639\2178\201\234\220y\316\354\227Il S\b\230\337\302:e\216\362d\214g\310\n\364\220z\2420\205\027\r\245\322\333?\211)GQ\207em#\021+\245\t\316\210\034S\355\2259\372\243m\205\031\374\364\371\226\311\373\321\370\013\003\020\005\307\377\207u\240\233C\321e\251\377\345\177_k\313\241\267\325\023\n\355\350\304\255\244\270\367\235\205\360GSR\317=#t\273T_6Gd\372`\225\347\0331\264 \227\3217\026\206\233H\343\263\360\n\326VPj\2623"
+	.string	"\351W\002!\305\205\021v"
+	.string	"Q\315\325\f-\300\236\202+\021\311s\025\307\342^\344\376MY\335v'\006\332\253>1\216\025\252\235\022\024\031#\262\372\353\350\242^\200\353$haI\243\301\231'\320!\377\226\025a\216\225%\0031;f\t\202I\n\367\"\317Hb\371\274'\375\341\263xX\261V\214\304\005\275\030\355\235!\205R\340L\t\300"
+	.string	"\242\351\327D\\\323|\320\0130\002\207w]\344\343\323\275c\"\343L\226\375RI\330o\213k,R\246\245{\036`$s^\313&P\301\\\312\032}\276.`)\366\304\031b\267\221\t:#g\266\324\321\261\223\376\342\013([\t\016\030\220\215pj\275\2476\005$\f\310\004m\313"
+	.string	"n\315\033b\341\267\367\\R\324b![8V\253\227\257\212F\016q\253\002\bn\371\224\034:\216\362r\200w\253\370d9\033\307y\t\032\310\247?\201\223R\273\355$\212r\303$\004\2501\214\201,:\264\205\203\033h%\217\361N\334\016\316\206\340\363\373\005'\265I\024\362\335wIuW[\bG\370Y\275'\247\315\241$\021\210\007\277e\031J6\021\350\320h\f\236\337\355N\035\206\220h\2417\210\004wDN\n\002W\263\234\035\215\230\345\246\350\315\331\005\342\206J\005\271\367\204\341\226\233\"\002\275\330\343)\310\247\226\263\206)k\003\251e([\\6\027\031R\003\302\374\003\n\016\035qN\252g\301O\017Q\222\200X\036\214\213m\250\270I\302\312V\326\352\022\242\224m\026.R\202"
+	.string	"Y,\2236C-\250\034\242\034\360F<\367\007\340\341\275\203\344]\336\342K~\374\257\214\310p\325\016\341\230\234\313\340`\234a\233d\347`\3534\013\305-\345\005"
+	.string	",V\032\013\205Db\322f\243\325\271\340\230\206\203"
+	.string	"\211"
+	.ascii	"\023\340\341\332\316\331\374@\254E\330g\247\330\374\001tFL/\273"
+	.ascii	"\254\271\336J3S\256u2\241k\006[\213R\272\212\231\252'(K\211\271"
+	.ascii	"\362m\"6!i\3014\340\327\262R\232dw\3305\314T'Zxj\025\261c8yT"
+	.ascii	"{M\026\266\311iMj\210\321\216\327FE\241\345\031y'\026\216\224"
+	.ascii	"\007\334\346\336\005\2743\370\246\345\027%!Q\343c\240I\316\305"
+	.ascii	"MY\340a\376'\366n\363|\t\216\336\003\246j\240J\311\366\351D?"
+	.ascii	"7\243\022\365\257\t+\320\034\271\r\350\263.\332X}\327c3\320O"
+	.ascii	"]hc\365U\217\315@w\007\336\272\200\\\375\262\306\366{\217\332"
+	.ascii	"\201\017J5\250\337f#\212,}\334\275\272\016\037.\354(S(\250l\003"
+	.ascii	"\340\303\213\225\276\377/>b\251\034\021\033\211I\236P\215\214"
+	.ascii	"+=\250\216\314\227>\264FbJ\017$#s\205\017\252\223b\032f\331\030"
+	.ascii	"@\210\351\252\342\204\312%\334\304G\3472\336\340!r\tV\360Q\231"
+	.ascii	"\f7y\250\234\214\237|\264L\302L\036$&\343\006\037*\317\022\020"
+	.ascii	"\311\271\261\003\336E\230M\\ \374\322\340PSWV\357z\0359Kt\021"
+	.ascii	"\302\255\207`\315\251\315\343\032\254\217h\343\376\337\322\373"
+	.ascii	"\342p\356\365:\302\356'0\370Zg5\241\215\373\365'\304=d\255\t"
+	.ascii	"\304\242'\230Z\016\215\377W;J2\263\367F\027\032'\t\254\260\306"
+	.ascii	"\022\243+\374\223\177\004g%\376;\320\204\314\210Y\221\323\022"
+	.ascii	",K`6\255\250E\005v\321\0011\224M\260X\036\346\327\277\"\002\002"
+	.ascii	"t\237L\350\033\2277x#Y\350l\260k\300!\275\3404\023]+\22300\203"
+	.ascii	"`d\325\030\\\211\340\3230\305bQ\243\026\333\304\353Q\003%]"
+	.string	"\003\002\323B\307\376*\240\265\307^\345\302\300\007\211\036\006\177\334\221\026\250V\326lE\004\307Q\241\364\372C\226\f\034\336\216\246\020)C\027K\351\265n\210U\026=H\222j\207\245\322\322\255\3009\252}\214\031]b^L\324.j&\375(\254H%\273\324\216\242W5f\300\305\001\257\006\327\007\265\017\321\023\005\310\036\213\200g\242\353\254aI\277\377\256L\363\243?<\250\333?\250#\201\334F<\f\211.\211\373\260\323?\b@\324\210\275\266\336\243\327\355P8\"^\275?\013\177\320D\374\t\"l\356sM\346\274\364\233\004\b\265M\200\271\362\307\220>W\251\311\317=\r(\272*\345$\205Qp\r\374?\232\235!\203b\365\371\202\230\277%\360t\265q\t\303P@\371\004\372\226Y\027\300+iZf-\025\023\200\334\253i[f]@\257\246i\2315\001\274\222\246e\326\004\360J\232\226Y\023\300+iZfM"
+	.string	"\237Q\276\321\230"
+	.ascii	"\025\212\026\261\006\272\b"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.233.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\b\001-\r"
+	.string	"\326Y\\C"
+	.string	"\223\223\016 \202\200\232\315\200\003TCB \265\002M\267'r\033\325U(\222l\026\243\buk\324\340\2415\fY\322\026\\i\356\371\377\337\277\334\271?+(\266Sh\022;\253\304\225\215d\262\267\224)\005H"
+	.string	"H"
+	.string	"G"
+	.string	"\306\256\303\005?`\035\276\033\260\016\275\3315\347`\226dU\003B\005dw3]\361\355Os\3639(\322\337\365r}\bfN\250\006\240J\217\301\013\032\030\357\236.(S&\200\223\335u\236P#nx\333\022lS\260\037\n\277\365\324\017_:5\375+AL\b\022O\305]\021\321fi`\216\030\333\267_c\263E\354\224\222I\346;\237;\215\3552\035H\n\254\251s\231p\035\232\273,\254L\236\237\341\307\270\214\355)\017\016\260\213\342\006\216]\316AJ\272\r\02760\372\022+\325\323\3510\245\020\023\2101\256^b]S\377\301D)\243}\325g4\370-\274\302\222?\035\372,\326\341U"
+	.string	"\217\022-\031\375\356g\321\343\307\216\315!6GJUa\377\355\356ZS\330\227\t\235Q\247\3023\204O\004\224\007\036\024\02062\n\2016\200\240?\030\007\315s\341\323\301\340\311B)\035\225\354#Z\3110\005\3262\200D\331H\323D\231\b\267?i\321\222sd_\202\234|,\267\r\2367\327\030\343\315\343\244\245Pm\025-\1772\f\023"
+	.string	"57\002K=\231\001\247\016\363,\254\024A\363Y[\201\301D5"
+	.ascii	"\002`\304r\036&\004\3462\016T\003\301\t>\325\2128\311M\335Gc"
+	.ascii	"P{"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.234.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\"\003\345\027"
+	.string	"\226*\230L\240\022V:\250\306\220\035\224|\b,h\r\240\227\352{\264\326^\354A_\214\247\263\271\360\013}\002\211\037\037\200f\205\355=\313\026T\331\266Q\266,\024W\023\030\017\322\344\323\034Ww\257B\343\210\257\241\245\360\342\264\302\254&\233\354\235d\201"
+	.string	"\177"
+	.string	"\203"
+	.string	"D\227(\332m\374\210\367\225\346y'_\r2\233\260r\326Y9n\231\3538\366\023\364\370\374"
+	.string	"\364\270o\264\353~\035\377\325\274n+\0026\271\307\200y\204s\364\221s\236\335\030\347\035\305\347\265\274\376\205\027Q\201\275\243"
+	.ascii	"\200*\216y~\236\005\222~\216#\300\232\023A\r\245\360I\033{\317"
+	.ascii	"\330\016%\316\b\360\346D\t\372a^xk\002\370\2636DB\316\271\255"
+	.ascii	"\n\334y\207\274\273"
+	.string	"q\335}\241\373Z\b\366G\367\372\263W\250\373g\276A\335\3306\f\265\375\302\266/\266m\261\355\223\030\240\221\203\342MJ9\237h\002\311J\3744\343\353\337\375\276\321\223\273#\365\217gR0\244*\3129\277x_\222\t\220\245\362up?\332i\217\354']i\367%\031\030P.\311\tVp\035\367\3522\026gH\364`\036\255\034\273h\321\256\275q\367\342LI\276Z\244e\205\225\363\232\340\270)\270\216]\240h\375a?\3677.~\266\331\375\034\327\241aC\232\242\307\257\013\253\352I\3762\256\226RL?\321\025\324\024\322\211\266;\r\251G>\346\373\fz\343c>\237\276\235\330r2\224svp\217j\326\227-\216\\\262\270\367\351<\252Y\367\236\347\304\013@.W|\353Es\351^\241\266\367\267V\344Qc\267\272\177\343N-\375`\343^\354\325\027\364\330\336\003U=>\333l\021\333\235\003a\257\376."
+	.ascii	"\372\335^\253,y\244r\251.\345p\342~`\203\300\322\240\306r\223"
+	.ascii	"\231\244\272t\202\016\346&\342&\3226\331\210\\\355\305\226v\250"
+	.ascii	"\315`p\251\207\231-&\304L\206\322\271\017\267\230\231.\227\213"
+	.ascii	"\231\275V\337\205\177\211%\221\322w\177(\315\2313\214\b_\177"
+	.ascii	",$\343}\224\375(\327P\326\351\336u[Y\223\234\202\251b\3455\253"
+	.ascii	"\034\337\006\301&\026\035\016\251\212p\274\237\304\220\301^m"
+	.ascii	"|{=\265\004\022<\237\202\302n\255\030E\322l6\265\236\202\276"
+	.ascii	".,A\250a \211\230AJ\031\022\tFD\244\005\352P\002A\250\356:\020"
+	.ascii	"P\212Hk8B\322\371\336\3408\261\r\016A/$}p\276\320R\253\225w,"
+	.ascii	"\251\200\276vF'\001\265\200Un\302:\375-\"\232X\233e\217\330\023"
+	.ascii	"7\272\251\023\303?\033\213\217X\356\020\244\264)\364\365R\304"
+	.ascii	"$\3664G\204\256\322Z\242k\303m\206U\361\260}\262X\262\022\226"
+	.ascii	":+s\024\025\f\203$\201\022\275b\005b\325\331|\te\340\004\222"
+	.ascii	"\017gr\202\353U\"\340>l\024%\332\246\371\3445U"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.235.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\241\003%\032"
+	.string	"\306\355\242J\240RR:\252n\331l\203\254\016\267'\334\331M\325\351\334\265\244\210>\200\316\261\037,g\354q$q\231Q\377\315\326\267@\224z{\337\252\006\314\"\277\004\336C\223&i<FD\363p\033-6,\004\227\266\352\265\2727\331;\311\207"
+	.string	"\212"
+	.string	"\217"
+	.ascii	"\267\234S\273\225)\201\270n\370C~\021\250\353\346Y\327\352\235"
+	.ascii	"\250\364\206\352C\265H\373q\326\375Ts\3136\265[&\036\346\336"
+	.ascii	"\326.\340\336\362\261x\314\266\333\333\270\307l6\200\251}\013"
+	.ascii	"\322\3048x)\351\356[M\361\336\257-+\355\361QpR\316\240\357W%"
+	.ascii	"8\342V\304\313\222\300\227\t/\226\340Ry\300\305\361\352aL\264"
+	.ascii	"\262\004\233J\231\356\376\325\251S\020H)\nNw3=\203Pg\2243\363"
+	.ascii	"\216\231y\230k\216\374\252[\376\331\321\237\273\033$D\177\276"
+	.ascii	"*\220j\252>\246Ab\2215e\302L\004\322:\305\374\262+\n\346K\331"
+	.ascii	"V\243\254\202B\371^\312\324R>K\314U\214\020\2271\244\033D\262"
+	.ascii	"I\037\255\215\025'\376\314\347c=\214\367-\376\213\303H0Lb\325"
+	.ascii	"\3356#\030R\200&\353?\355\2007%\275\221w0\244\025\251v\371P\245"
+	.ascii	"\303\334\273WR\007$ib5\267@h7\225\376\213\317\365.\336\275\222"
+	.ascii	"\\\372\247\025\232\331Y7\021A*u\245L\030\366\2530\202$\203\361"
+	.ascii	"\26302\006\244\267"
+	.string	"^\3449\r\"\347\2151O\272\377\272\314\017\271\343G\321\213&\247\bs\334:\2063_V\312\204=.V\264\365\263\273Qu\377(\334\333[\357D\302\210\274A+s\205\027{`\250\272\273\301\317#:z\370U\264\306\224\t\1774\311G\326x\361-F\244\026\355n_\255S\\\363\327\034W\221%\272\204[hy\026\273\037\036\207i\3437zp\246yo?|\215]\255\373\367\223?\3434t\001\270#\234\205\322\262\003\363\201\017\203\234\217\316\346\005w\204\213p4\244\323\240Ka\323f\003Q.\310\304]\310\335\206v8\241\233i\224\341fc\200\2110\350\214nGDDF7\033\361\367\253\337\003r\354\370\253\300\253Tv\237\200p\266\305\377:\217\343\2172)R\243\352'f\036\263\031}\351\250\264\363\254\211Ms{\352\304\026\2407k\230\304\352x~X\216\004\372\223m\365\261\020\341\223\250\3623\327Vs\\>"
+	.string	"$\223I\264\317\\\225j\253o*\001\004\362 \023tv\350\316\275\rQ\250A$\2119d\020C#\022L\030),\320\001P\0021\306\360:\020hh\2336\302\004f\310"
+	.string	"\225%\007l\207\002\020\350~q\030MK$*\222\366\333<M!\230Ygsc2\330\247x\235\247\356\302\327\304d\300\"5tH\203\321d\023c\002\322~\365\211\217\223\025\002\263|\213L"
+	.string	"\346o\370P\217F \302\022*"
+	.ascii	"\256ad\204\342\243\276\037Y\033\336\201\357\006C\334\221{\026"
+	.ascii	"\020\f||\341)\034\213So\366j<5Ke5W/<\b\002\273\200\001p\212x"
+	.ascii	"\007\\\033C\036\310\207\221f\001\277\213$\201\323\3252A\320\337"
+	.ascii	"\302\007\264\237d|lT\375\001"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.239.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`3\001m\f"
+	.string	"vUOB"
+	.string	"q\225\016l\250\312+6\300\303\235\300\332!\355\276Ka\217\216\316\267\307\254_&4t\346\212\032\251\032\241i>\032+U\206\364\377\377nDP\214@;,|\324\364\321\250\210\b\267\325d\357-eJ\001>"
+	.string	"7"
+	.string	"<"
+	.string	"\"\r&'\340\245z0\202\306\2343[\f\337\016W7\377\251S:\217;\344(}!"
+	.string	"\223\212\322\207G\202 +.\270x\352\n\301\033\251b\003\346\234\326\316\223p\307\333&`;\200\375\016\001\"\375l\231q\203\305\324\227\275\342tQ\366\341\334\223}5v\265TuT5\274z\257\276\007\211\214\023\023\236\002\306\234\021>\033\263\025Qp\260}\373\252\315\256x\263_\004\330\232"
+	.ascii	"q\271X\211\216\334\021\227\027\227\204&\341F\326Eh\t>\037\371"
+	.ascii	"\b7\344\333\r\361.\306\017\222\337\335;0\215\364\263\357\341"
+	.ascii	"\037@\276\006/\b\351\273G?$\037\277'\031*\004\326\\\030h\031"
+	.ascii	"\216\006c \223\035\330`:\231\306\363\311.%\326\020\024\360d\n"
+	.ascii	"4\315\223UV\363{\242\270,\264D;\202\035jo8\372\316\273\3347t"
+	.ascii	"\246\326.\312\344 \211m\206\325\202\2445lqQ\b\" \300\002\021"
+	.ascii	"\272\323\001 \325\033\005\314\317\310uM\246\275@\265_\021\341"
+	.ascii	"\260v\253\251\221\305\t\3276\377\350\007\305q]\2067\\\331\250"
+	.ascii	"\272]\242\013H-\020\f\353\214w\251\004\013\230\202\235Jo\267"
+	.ascii	"9Qm\024\266t\346\260I\032\030\333\003"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.240.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\234\020\025M"
+	.ascii	"\252{\204\033="
+	.string	"@\344\316\030G\300)x\022\204\034\017\3174\214jhD\204\3128^\332m\030Ef\"\022\027\023\375\363H\350\207\035\260\223\322y\320\367?\273\236V\013V\220\251]\254\345\245I\225R\246\224R\251\001\221\001\247\001\275\307$\213\276iEV\b\365l\340]h\357=\250\220\244\267\317\270\340\241Kl\326\006\340\205v\323z\334m\352\264\361\321lxN\277jo\033i\304S\227\370\276\357\213\243\236\017\35656\334\\`\3565\334h:\215\217V\003d}\331\242\257\332Q\032\252\241]\343\373F\255\232e\023\307f9zl\245\266\317\004\351(\237\200\256Q6\313m&\b\263\262\331V\311<#\320\205v\346\266\353;\267\241B\030\371\276r\202}\357\033\305\342\254c\263\314fj\233][\251m\226]f@Me/\221\b\206\354\230\245i|\337W\353\255\004`\243^\243\315\311w\373\311\311@\001\002M\003\0040-)%\005"
+	.string	"\200t\2644R&\221\307\242\226]\337]n\004P\300\261>m\322\210\364\223\323\235\001i\263L\201\225)Xh\326\322&\231\025\212J\334\264\2754\355\234@\323\200\2266\353\2744\267\270"
+	.ascii	"-LY\316\214\361\245\225)m\336\255L,\256D\327IW\374:\312K\023"
+	.ascii	"\316\003<\033\300\\#\315\305\371\221_w\232\234\332\263\227\322"
+	.ascii	"&\235\227\346\233\033\341u\224\234\332]+\327\24224--m\266\255"
+	.ascii	"\024\250\211\177Mh\346\311*jP\032\031%\247\366\244\217\253\322"
+	.ascii	"\223=>-m>Y\257\370|\201\322^\232l^\324\204\315:\r\351\331M\345"
+	.ascii	"\324\240t\333\244YeZ\231\257k\025\334\340\222\243\264\"+S\236"
+	.ascii	")~\272\220\314\177eB\323r\326\322\246\333Z\225\350\267\330x\355"
+	.ascii	"G\322\306\334\2136\274\357\313~\226\246\326|\240\231}\0043\347"
+	.ascii	"`>\262\023\202-\001g.a\302\373\214\231cO\204\033\257[\t\234\273"
+	.ascii	"(\323A\257\033j\315dI\3032\233\253=\372\303\205b\305\321OPZ+"
+	.ascii	"k\\\337\331\\m\323{\225\274\303F\344R\261bE\333l\323\037(\354"
+	.ascii	"\344\2352GA\212\\\246\212l\030\343P\230\243\002zf\321.}\343\265"
+	.ascii	"\263\3011\022Q\324sH\346T\346\336\323|Xpc\341\026.\274\317\\"
+	.string	"\264\315.\275\202'\233\230W\271\365t?\027\337Z\tZ\227\350T\221\212\261N\372\272!\346\350\230\277S\216\331\037\032?\025f\244\363\004\244\363\026\322Y\302\3229\302\322\031\302\322\371\301\322\331\301\322\271\201\221\263V\026\2223\326\221\363U\3675[5_sU\322\231*\351\314\300\310y*\351\274 \351,\225tV`\344\234`\351\214\300\3109\212\211\344\fu\344|\240\007\233\237:\260\331\311\310\271\t\351\274\324\320\356$#\347\243\2453r\351|\\:\027-\235[#g\326\310yU:\177\322\331\221\316\275\001\212no\255\t\001\337\027\255z\350-d\377\2664_w_w`\367`\257\314\315-m=_\035\345\007w\200\306H\277\230\225x\272pGG\371\343\004\242\002g\207g\307 7a \267\240\235\007w\213\215\353\253\367\301\220\035.q\032\260\007\035\f\210\352\314\221\023F\203\356B\353=\247G\313\t[\243o\332"
+	.string	"+p\n\355\032\271\353\030\247\007\263\322M\367q\373\261\222\335\346\343\206\303\256\217\216r\277\311\220\206-VZ\337\300\211\226\237\325w\037\307q+\333\023 \353\273\317\352\263"
+	.string	"T=cA\360\343f\007\351\235\211\032\313\025\343L\334*X\356\234\257\271\332\025\26712W=\352\363\343c\017\336t\257T}\363\3611_\271\022OR\005\347M\223(\304\245q\217\272\344\220\232\206\\\033\344\263|\005\017\226w\207\314\251\215\307e\232\310\340\027<\325w\221\277\251g\340gS\037\341\311\206T\255V\253\035\326J\375\202g\t\025\274\277T\202W\340f\t\336\351\020p\215N\\t\252\350\337s\232\371\356e\375G\207l\214\213\317At\211\006\356"
+	.ascii	"J1\242rfw\213\333\205qP\372\006r\327i$p\356\372\246\211b\211"
+	.ascii	"\312w\362\022\021\311\374Gl\255\372\351\217 \370\247\3670\030"
+	.ascii	"\365\b\276\315\022\211y\325_.\367K\324#\361\310=\375\006\261"
+	.ascii	"\365}\3377\371\316\357\301\253~z\346w\021\2701\257r+\b\252\250"
+	.ascii	"\206\224r\247g\250g&\331!\224\321\241\207\026\r\217n]\013\365"
+	.ascii	"`y\210dNu\3054\"\267\356\370\276d[\334\207:\270e\272\332f\241"
+	.ascii	"~\352\t\025\363\352\207\246v\035\033{\352\336\271x\0348\264\315"
+	.ascii	"\036x\251C6\320B\277\006\260,\255\310\252{\2601\020\366\nF\016"
+	.ascii	"\252(\rd\017\275\030&`\356}\337-\356B!@pc\001\3226\373t\350F"
+	.ascii	"\005\305#u\372\016\354\036Q\304\002\231\257Z\021\b\006\303\367"
+	.ascii	"})p\013\352A\"\270\2614\313#H\220h\233u\372\247\347\237`\367"
+	.ascii	"\023*h\247[\211\233B\\\246\212I\337u\232)\026?\274b\344\030\341"
+	.ascii	"\205\343\005X\b\035\312\032\355\001\211'tU\220!\001\206\f\257"
+	.ascii	"\254\2450./\0345R\360\310\341\005\006\326\243k\311]Y?\276`\330"
+	.ascii	"\350zq\003\206V\216\032/phu\201\205ieA\361\227\016/0-\036__`"
+	.ascii	"Z\312\250X?\025*a\241\330\217\rQ\244\242\n\246=9\033\352\235"
+	.ascii	"\013\2722\306\t\371\307=7m\220\205\\o\215\232#_\035\243q\273"
+	.ascii	"c\240\350\333\3570h\3346\rs<\204"
+	.string	"\321\363\334\267\2553E\257\341\371'\346\325\251G\3356\2519\036b\310\361\206 \202\202\266\337K\240o\246P=9f\n\274\223\331_\277\241y\210<\244\352v\\\3072\354K8$\342u\\G\027\343c\334\2612\327\314\354\241\236P\317C\005\363F\362\364\bX\360\244gv\217\270I\310\250^\320\334.K\340\304y\247\203\330,\n&\371\030\032iz'\367T;\341\035P\336a\265\247\332\255\237\360m\3066\326\205E\332\326\367\336\263\233(\n\016x'\003h\026\255\204\227\221wH\346T-\022\276\325\356\350\324\261}\031DB\002\336\311\021\036\302{\",n[\323\231\243s\337\372\215\341\225\b\337t\236X>g\005\302cx\376\265\214s\f\231\336\311\017\336\301\303p\272mX\206}\206\3355\247\342\276I5\313.\347S\\&N\334'O\332f\037<V\024\267\315\341<\316}\213s\245Hi\233u\360K\207\177g"
+	.string	"\245f\272\335\320\3004\343\226\201\350\374\226j\264\357P\274\255\306\024\327\351}\346:\333f\237\r\365M\311\n\265\t_\337\236_\224i\242X\022\200\254\177\304\245U[5\370\201_\250\221 \007\225S\210FD\244 )H\322\001Q\005\204 \005-\\\017\022@\2045\316R\206\310Da\222\244\260?c.7`\213H\313\217\202\007\245\007\325~_\227\026\252\241\256/V{\204\373\336\016\267\371\031i\344\245#\342x\245\210F\220\323t\204\360X\316\213\237\223 \026\315\001\016\")\256\362)\357\276\n\311\273\016>\254\271)\210\340\274\261\315\366\235\"\004\027\345\0355\356,\201\020k\"\t\2202\273lm6\"P#@\317\030\342\312\221i\\_P~\332|*WA\367\344"
+	.string	"\347\363:\027\220\333\021t\357\341\302#\r0bq\374\3436\244(J\232\241\024\026\213\303\"\230\001\237\307H"
+	.ascii	"\rH\314\236\355\261I\n\020\321\231\367\354\212k\347\035~\307"
+	.ascii	"5\"\361\2004\341\222\205\254\270\201'WUF"
+	.ascii	"\276\317\004\275Z\376\261\205G\021\nP@\017/\037\323i\b\273?\335"
+	.ascii	"\256<Z;\253\004\344\341\343\341\341\3756R&Y\277?\201"
+	.string	"4\277Wp&A\321\332,\326\270\262\255\020\360\216\223\3346\334V\300\271\b0SaP\256\266E/\t]\376\370\355\341\215\274kc\366\t\331\267\257\001i&\r\032\274\2650\026\354\027\225\202\224\233l\002\031\344J\n)F\374\310M\266\350\0173\304&i&\220;3\317_ \263>\344\3004\262\331\030\365$\323T\350\316O\252\364\327\245\002\361\027X^\255\312\365\311\235>\032\314Q%9\320\001\314\343\211|\025\002'{\034oB\223\333w\310\222\021\226Y\211\024XxG\360!A\345\300\254g\013\242\262]\240\306\273r<B\263\221\"f\233\ta\206\037\350Q\345\336G\024\213\022\216\006\021\231\214\036\022\345\341\330\304\241N=\302\260\314@\006\257\247\325T\354y\376\306\357F\211\030jv\260\334`\320(&\333\316\307\226\316\205\230\203\252\211R\036\317G/\233\231n\2527\016\365v\252\2507kr\365\254\245\304\200KY"
+	.string	" \310\035\211\257\253\366\377C\324\027\254n\n\004\251\211\351\366\025\034\301\201\242\266\246\331b\264\222\235\317\366\211V\357\032\216\312\251\335\232\211\225\177\263\303\002\264U"
+	.ascii	"X\252\376\017\001\022;P\n\035\fww\004\002w\376\302\3341NF\035"
+	.ascii	"\001\322`M\315\026\314\364\327Z\332\233p\244\026\236\327\303"
+	.ascii	"\037\244\227\035\262\300A\013\316\277Q`2\343M\016\016\235@\202"
+	.ascii	"f\342\267\236\342\330\002\232\303\026\376\\R_\t\374\234{\305"
+	.ascii	"1\270iS\033\240\361\004.&\006\tJF\255\327\001\n\330\266\336P"
+	.ascii	"\270\311[\362\335\240\354\365\307\235\007\032\350\375\360\226"
+	.ascii	"\023f\247\220\211\224\331\251\001"
+	.text
+	.section	.gnu.lto_blackboxUpdate.241.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`-1\265\243"
+	.string	"\372\352\3004L N\333\031\003\377\314\376\bs\006\272\275\202k\256\304g$\321\274\373\331n\314M\233\377\275{\376\216>\021\277\267T\006e\244s\227\221\263\363\005"
+	.string	"  z\346^\231\240\244\376\035\245\2277\304\334\351\354:\360\216Z\236\272_n\231RJ\001H\003"
+	.ascii	"\003>\003\335\204\334in\004\352\351\322\006\r\375\211\207+\331"
+	.ascii	"\207x\221\247Ks'\"%\254/\325\363\235\"\201I\211\307\335\211\207"
+	.ascii	"\023)\341\213\274J'&\326\220P\364&g\3221\202\034\245\035\367"
+	.ascii	"&\036\316\244\003\210\355\fG\261\211\"\324yR\214\022\037v\325"
+	.ascii	"\365w\307\024\207\247\247\247\224\007\317b\003\261\206<DPS\342"
+	.ascii	"B6\212\360\246\304\314\204\\\327\357\324\333O|\325\345\364}\337"
+	.ascii	"\016\212rz\260G?\231\202\2634\203rz"
+	.string	"0\033\005\341\3148{\003\3707\343,\316\340\0337\0358\277\370\261\261\300)F\254\230\224*\2161$\233J\371,p\332\r\356\251\371\271C-\275\350\317\035B\241y?W}\202g\206\230$M\353\256\311\3748kc\023\273\373\301l\264\023\363tjtsO\267\226&L\334'Y\233\023\003\230\247c\303\342\345\355\351\330\374\322\272-H?\271\331\236\356\013\034\346^S\0032\324\364|\231\315\306f\314Q\023\335C\245\325{-H\253\001Y\237/\223\003\223\221i\331`\023\271\202bZ\020\346\356\302B?\231H\007\306\017\253\354}_c\023\271\271\260\300ll\242\220\221Y\2041\245v\346.k3\267\317\204\360\316\3736\317\342\336\367\331\202\221\212M\034j!\266\211k\003\261Md\227\331M?\273\336\016\206dNj\203\357\373&}\224g\257\317\346 w\233\3278\215\321\270\013s\341g\r\003\nP\2421\203\200\001\004\b"
+	.string	""
+	.string	"\0311`\274p\221\204\324\202\305\221\321\212\"\025)P\020\2350Qb\210\304\b\021!@|\360\320\201\303\006\241  f\323\360\223\301\007\331s4\362\354\024uX\342\372\356r\273[\0324\2757f\262y-\255\213\021g\264uI\223\t\312\271\013sYc\f\031lr$tJ\263\241\311\364\344\374\\\026\361\032U7`M\322\334:\322\005\030\272R\210&\323\2219N\343\260\320gx!\200\352\003\b\360\306\0038\322\006"
+	.string	"\235\f\302\030l\374\034\006\230T\237\277\200\232\272H\262\353u\213j\312\327Hg\274E\036\236\263\3103\343G:6\030\360ZB\313\250Fdz\305]\027\255\036\326\262\324:*5fM1\006%\363\247;WA\006\316S\220\211\301Q\340\021\021~\361\023^\334\004\264\204\233\017\351\221p\372\210=\021f\036B\n\302\357\003\331\026\367"
+	.string	"\026\225\032\363\016o\272\231\034\254\370\206\365\273\260\331)\231\211y5\230\224\024\027Z\333$O\035\225\252\262\326H\262\221\323\205T<\b\312\324\224\006j\345\224f\266\rM\246(\327\360\202\377"
+	.string	"v33t\271\217`\237\240\232\226\2155\247\b\033I\210\345=G\035\033\315\251\2536F\245\2328\273\004\230\224\225\363\f\272i#-\003\346\255\355\254L\314+\313\005vm2\237\272)E\350\263\303%\232SU]\\\215\246a\3424\230T\325*\024Ue\331Q)*\327Y\205\320l\371\031a\231I\342\344\354\222&\3620\227\364\212d\016Y\207\336\367\355\301&\3775\311nHTG\245\252\326\f]\204\177\355l\207b2\271\353\330x\337\227}\311\234jv\240\231\211Sf\326\301|\224\026\177U\272\247xqh"
+	.ascii	"\233g\315*\316\350D\315\225\f\305_r\341\304\335\362^\026\237"
+	.ascii	"\206\026\323]\364\205ng\363\300\341]\3619#$mR\264g\025=\256}"
+	.ascii	"]\241\002\nvw\351\205E_8\315@\025t0\320\255;\260\207\224\316"
+	.ascii	"\356#pe\246f\230\331\345 \314n\212]\257\324\253\325\202\315\263"
+	.ascii	"\366\245EE\352\374\022\t\326y\032f=\\0\034\243\024\202yI\013"
+	.ascii	"\277~\212\2445\215\"\330N\026\001\273E\260\354w\362\331\235\250"
+	.ascii	"\344|\316\225B\305\265b\205m\"\373\"\274\262<J\373\334A\007\247"
+	.ascii	"I74\301,\222\306\003\307\036\207\244~a\007\323\323\347\306\376"
+	.ascii	"v\304[cg3:\321\330\323x\250\\y\262s\331I2\215\230\261\237\025"
+	.ascii	"\017\241eb[\330\311t\252f\264\260\213\261s\306\224\211aa\317"
+	.ascii	"B$\373b\007[\253WU\330\255\374\240\024\366)\336Z\257!\233+\257"
+	.ascii	"V\027\273\027\273)v\003\031\242\3437-\023s"
+	.string	"(\314\354fe\233\203\325\344}\223\215\345\313w\305\372v\371\341\023\342\357XEwT8\263\033\346f\361^\362\020\223[\241\222h\b-{\323b\222^\377\343h\271\023\034Z\334\261\261\377bj1J\310\320\351<\027;\261\307\2670\345\256\312\tn\345\361>\036\312\307\377\247\300~\345X.\231k\346:]'\333\304\377v\366\321V\234'Xf\354\322\3678\300\255\\X\372\336\223\022%x\036\377\001\317\351\260\0079\001\247Z\240\370\276M\001\260/q&\rpOi\"?\020A\004l\023%\370^\363:Sz\225\271l\261)[\237\213q\260:\276\247\nZ\237\007'\352\tX\356\301\n.\360^\352x\002\264\232>\311=\330\355\005\026\026}\275\260\257\240\230Sj`+\331\304P\377\271\270\213X\377\033hxMN\310>\325jUN\027\261\375\376M\004\213\311\253\314~\304\243\200pO\341\f6\360^n\3006\261\037"
+	.ascii	"/*\245WyE!3\352\323\374(\2738*\340\353\205\314O&\177.\346\376"
+	.ascii	"j\265\252\306\377\204\331\307\271\223H\347 Gg\025\214\316@\200"
+	.ascii	"\234S8:\377\350q\366\321\343\334\303\307y\251\307\231\007\322"
+	.ascii	"Y\007\b>\316\022\364Y7\004M\330,\303\350\034\303\350\f\003\351"
+	.ascii	"\374\302\307\331\005\3229\351\350\214dtn\201tf\201t>B:\033!\235"
+	.ascii	"W\034\235\213\216\316*\216\316)\220\316(~\234\211\220\316'\220"
+	.ascii	"\316&\220\316%\220\316CGg\022H\347\021Hg\021H\347\020Hg\020H"
+	.ascii	"\347\017Hg\017H\347\016Hg\016\032\2347\034\235\20548\007\035"
+	.ascii	"\235\201\216\316\032\216\316??\316\031~\234}~\234\221>\316=\031"
+	.ascii	"\234\217Gg\343\321\231\347\350\274\203t.\"\235u|\234Y\2433\021"
+	.ascii	"\351\274\3668\377\321\331\215\316\335Z\017\244A\323K3,\3735\317"
+	.ascii	"7\252:\347\205\022\345\254\370\033f\320\272\313$\221c\276UxO"
+	.ascii	"\"\021\337\315,\"\376\002-\246j\365D\210VK\210*`\265L\231\341"
+	.ascii	"\323\204\331\232D\016\224\335\250ujefiA\363\314\272\317\030J"
+	.ascii	"\255Q\320\346Y\313\222*\001\342\357\232\270\032i\315V\250\365"
+	.ascii	"\2515[\235\326\"\355\030Ykf6\007\342\214l\254\3609\264eU\266"
+	.ascii	"j\326W\257z\2507\247P/\212\246P\217\304\207A9\013\364\2278-\027"
+	.ascii	"\266\211``\353\246\344\\#\366\276DZ\347\003.\240\202\257\211"
+	.ascii	"\177-\227\246r\256\031l\342\224\325i\323\262\371\325\350k\331"
+	.ascii	"\370^\332\242\251\265lll\037\252M\252U0P\257\214\320\242\267"
+	.ascii	"\207f\017\232\267\207gfO\215\226\3564\324wO\204\207\277k\356"
+	.ascii	"\326\215u\273\026\316\247\253\356\305\324\3100\327\302\205y\271"
+	.ascii	"\326\013\230\026\016\216m\342Qs\233\2079\207\32409!\266|\221"
+	.ascii	"\276I\335\332\244kjR\276-\335k\246\322:(\b,]\374\236~\3163\277"
+	.ascii	"22?6X\272\373\222\300\t>\375\212iM\346\207\016\337\315\027\303"
+	.ascii	"\321\206q\307:|\220"
+	.ascii	"\235\007\016\032x?\037\206\026\237\305\225\302\226a\001s\255"
+	.ascii	"(9\351\304\336W\331Kff\361_\256\224\336\342\244\033\240\211\374"
+	.ascii	"V\376J[\307v\355\235\337\261Md\321\317\237\322\346\371t\275\360"
+	.ascii	"R:\255\353}\211thn\363\374\2566\257\370\276Dz\311\017\345\243"
+	.ascii	"\264e\360\332\274\274874\255\236\367\222\303\353\320\275.\304"
+	.ascii	"\035\232]\t\214\353\360\365Z\177Q\244V\315cq\335\220\277jB\324"
+	.ascii	"\225'\355~\343B\325\025\364\215\233\356#kUP\352Ww\233%p\201\357"
+	.ascii	"3y\323<kWZ\31676\205\303s\361G\365\206o04)\006\257$\311\206G"
+	.ascii	"1"
+	.string	"\305\024z$\351\231\2635\270\035fmx\2565l\320{\024\215\203?\322\256\031\200\337\310\267\320J\327\226M\333\206m\333\260M\fz%\251\234r\371\004\364\255&}8\274%T\350\271X\200-@ \274\316\013\r\034\265\214\207\242\266\214O\240\257\311\t\211_M\031oC\351\205\0357\347n.H\303;\271\314\366\353\"\322?\257\341G\250\211z&\227Y|\345\317\267\237\327\031\b\337\204,Z\306\203\360 \360@H\017\225dxv\275\177{\t\350\266[\305\372|\006C\237g!\245:\244r\300\221\317\334\376\265\201=\217|o\343t\030\364=\317\202q:,l\r\322C&\253\027){\205@\317\305\335\3048\3001\r\374\223V\220=~7\321\244\n8?\233\353X\346\226\332\026z/\217\177\201V\323!\022\r\317\305\306\337\371%\2643ix\336\370D\3018.\023\005\237\240\353D\304\007\207\347QH\317x\347P\352"
+	.string	"gn\253n2\220J\336\373Se\032\302\222\271\037\317\344n\\\346\206!\336\306uj\242\337\033.\001i87\240\013\345\266\340\275\374\361\215D\213\351\223a\242\3552\331\006d7\312\371\\\246P\327\373\276\001\260\357\371\032\027\211\253\304e\302\204\017N\233\2363z\324\354z\236\306\255\262r\257\256\330&\222\350\202s\\\263\202\002\006\037\370\370"
+	.string	"\204\325\307\t9R\310A\314\241\343G\217\034K,\t\235\303\307\007>."
+	.string	"\222\343\204\"\013\200\203\200\020"
+	.ascii	"\270\021B\016\244\240\036\031\344\320A\002\006>N\310\261\264"
+	.ascii	"\364\003G\017\343@Ra\307\215\022p|`\302\215\244\023H\370@G\022"
+	.ascii	"\216\245\036IH$x\007\n9\226\222|\354\330\261\224d|*{}\377\tO"
+	.ascii	"\024$P\3453\031\247\306\336\225\201\356"
+	.string	"\"\344\317\315\342\237\334\251z#\243@\220\277\021'Hw\351\366\322\"h\204r\276T9 \246Z\310$\020\243\017N\fA\004\204\004z\037\224\277\265.\303\003`|\203\375\301x\024^\376\006%\317\306\213\357\246\340\213\277@\253\017\n\036\323\231\211u\325x.\356\005X\027,D\316\332f\365s\361#\244grY\236T@\003\236\253\257\327\272\340hi\276\317\367}\013H\372n\362%}\020\224\263\350Z\357\265\261\255\205\305\265\365\373\276\257R\027\261H\377i_\326\240\235\201\323El\213GB\323\342g\270\201\241B\tk\032,\376\006\225\305\307\320\202\202%\244\320\345\276\236T\3007\260\273\360l\332--,\323\246]z\370\325\327}8\006\272\246\203\246i\272\253RP4\355S\370\016N\317tK\253se\332\337\232L\271\366-0\250\322\255\247J\256f\033I7\254\316\300\363\362\346\226u\305\013\001G\277\344d\216\276"
+	.string	"\255&\301\030\332h+p\200\225\256\315D\337\376\322\355\274\032\023\003\030\270\356/Wq1\b`\364KB\f\215\236\206\235\2276\332\252\013`K.\372:P\267I\246v\310V\034\\\033\221\263\232R\247J\2710q_\272\341\316\234\266\314\332\344\254\342"
+	.ascii	"\350Z\341\232\256\347\272\272\345zH\271\005\366\324\267\365U"
+	.ascii	"\034\233\322$c\305#\267\254x\2350\217\361\\\\\364)\376\335t\233"
+	.ascii	"\212/\372\020j\353\233\313l1\253\233\353\324u|k\233\212o1)\276"
+	.ascii	"\253\r\003\305\nN\324B\033\345\275D\361'\236\350;\215yb+K\255"
+	.ascii	"\215\232\325\027s\n\353\332\233\200P\245\027\272\270\"\302\215"
+	.ascii	"\234\262\244\347\372\264\023\363\354\256\223c\"e\2676\231OH&"
+	.ascii	"\276\347l53\361\215\347\345-J\374\203\255N\232\271\304\367_\263"
+	.ascii	"\030\372\245u\013\016$\356\330\320#\377\242]\332\250Y\006\232"
+	.ascii	"t\303\243\347j\216i\225\374\2745\355\214v\254\357\333\2541\355"
+	.ascii	"\342U\366\341\020T\265V\336\214\213\276Kh\226\365\252\303\334"
+	.ascii	"\210C\371\262\207\224\315\262\366d\367\0219$q\324\251r\375z\362"
+	.ascii	"\350(mqe\203\357\323\rW\360p\016Mip\260\312\326\027\232\375\251"
+	.ascii	"\315j\235\020?\371X\232\\(b\266\n\177\003\355\214K5\220Wa\245"
+	.ascii	"\002\344\217O\335^o\002\243E\332x\304\020J\rTz\262\335j3]KwB"
+	.ascii	"\266\016\326\233\310"
+	.string	" \340\"\362j\322\327\324B\"\212']\246\020\337\ne\215\3422\275Z)R\330&\222x\")\2257\261$\373\247\257\371\245\"\2057\363d\213K\240\236t\253\265B\245\rK\341\211\274\310t{\305\271\232\340\353\231b\304\207\021o\315+\247\034\363\211\002m\3152\214\016\275\335Zay\265Z\233\264V\276\332\260\260\2548\274\203\366\250\02299\316R\246hDD\024$IA\322\001\322\013\020\006\342H\222Z\352<\022\200Ri\220'Q\306\020\"2\"#\221\210HIAA\223\003z\302\n\250\033\003\350\373\312[1@C\223VW\b\333g\351vZ\330\301\343\234s$B\242\340\r\220X;oO[/\310\263\214UCv&&Q\f\220\005\206\360\332\347Jr\020\267\214y\372\330\205-\311^u\361Iz#\322\272s \n`C\224mh\277~K\272_\034[\331\340@\333D*Et\355x\250-\326\234n\275"
+	.string	"H|p\026\334:\"\001f\361I\217\310\247cX\373\t7\354\317\267\236\263_j\353b\321\303\263\2237L\241\373\331\231\251\336\266\205\r\313\233\032\025\337\352\b\210j^\021|\242\220\375=\270\3447\276"
+	.string	"\267a\344}|\n"
+	.ascii	"\311~\3441=6\002t\26226P\201\226\377o\321\270\267|3\363-\214"
+	.ascii	"\330)\030\036\232\233\223r\315\346yGd4\001\222i\203c\245\017"
+	.ascii	"\331'\200\240\004\007\266\200X\367\321\217"
+	.string	"2\322\013\024\356z\334\034b\230\376%\"*\360\244\274K\222>i\331\272\326\311\006!\347\374\362\216\233\242\260\2673\326\344\227\234B~\243\312:\302#8\217uM\370[\023\236\341\377\2268\362\361\355)\245y\005\355\023\316m\201#j\341b\316B\302\027\262\311\3024.\315\221\223c%7\311\205i\222s\345+\033h\274\230ttI\272k\020\212\302\307\223J\nQ\335\360\341p\262\262\376\375\326\303.\001e}\357p\352f\222im\327\200\341\236~\027\370P\307wE\354\320r\226\303]\313X\025;L\270\314\317\rx\3007\rCR\243\275|\246q\265\316\267\252\275\\u:,\275eZ\235#h.\236\233\326\301x\357\316\233\243[0\213\005K\366P\037\300?\376X\305%\371g\032W$}\252G\343\027_\036R[\342\017\203I*\341\024Yk\\\324r6\274$\027R\216\230\024_\031\322\332\222\232\221\270\001\340\023"
+	.ascii	"\343\225|\263\374!\356\370\353\240\213\013\231\247\375\205P,"
+	.ascii	"\003\370\246wS\270\313\303E\202\326\265\220~\360,\nW$\336\203"
+	.ascii	"\211D,\027=h\035\257\310\304\235NVk0\337\363\227\232\240\352"
+	.ascii	"2G\021\350\301_\235\323\254\234"
+	.ascii	"\004\362\217\255\001\224\270\210\b}\203E\n\311\252\260\332A\212"
+	.ascii	"\371\266U\356;\211\213\224\305\020m\021(\233\035\246\007\001"
+	.ascii	"\235i)\260\021\f;\376\221\342\377'\n\023\036k\215[\231\320\275"
+	.ascii	"\237\307\033o\016Y\373\254i\020\365._\236\214\366\266\207\n\024"
+	.ascii	"\300\2773z"
+	.string	"\356_\234.m\265\302\370wL\250\271s\214\346\305g\035\206\253\212\337SC\201G\f\231\266M\2773\3637\212\032\230\207A\255\220\301\272\004\204H\3632yQ\212X\006JXC\376\220\266\230J\007\214\257\2555\325^\227<\"\034\343\370\2231\022\315\355\314\330\270\350\366\2421\237\222\243\364w\033cGU\026I\022\312\364KM\020`\213\356_\324\2625\361\276{\273Sq\303\234I\271\261'\310\227\371\337\325\336\034\243q\361Wu\035\034W\277~\363\221\225p\037 q\246\235s\206\276\261.xx\026\354\325\205X\206\207\334\375\342\354\315z\213\0016\302\237\271\201\253\203n\310\3629\027\233\353\365\036\b\037_o\312\275\360\277`s\021LI\026\3020\357\306\253\364\035\f\256n\325\334\2550\377n\342$\360\n\"\234a\033X\222&\257z~\2032\312\006\230m\222\265\243`\235\301\234\300\232'?\327\031^\331\332\374\032\273\341"
+	.string	"\243\266\300\003\272.\215vdW\344\026\377\315#\322S\214FR\375.pN\254\005\\\237l\351\214\246\260\372L\221v\002L2V\ft\221(B\232\257m4\034\330\263\226\344~\277(\001O\022\207\233J\223ZS\240||C|\033]cn?5\032\223G$\212\006\261AR\327\250D\002\260\335\r\261\031<>\306%oM=C\334f\352\331\326\371\317\347\031\244G\232\030\304P\343H\307@\252\252\235\254\036\216\322@D\326\001\204\374\233\231\301\346\347l\237SN\274g\357\220)\034x\363\333\346\227\213\265jQ\\\216]\212(\226y\207\307\260\361p[&\335\360/A\363UW]\022o\270\253g\031\354|\270"
+	.string	"\177\366\215)\357\365\263j\326-\241\334\311l\352j6\260\021\325M\032\252\022\236\206HJ\213I\253\224\266\276\016\230\r\247\232\325\352\215\220\212IT\337=T\365\256\350Q>I\206+\225\366\230i\2453\274\230\341\215D?q1bZ\275\222B\271\001\211\370\030P,Q2\033\033g\251<"
+	.ascii	"X\301\313g]'\234\354Zc\tX\233\247\231\032\214\246\357N"
+	.string	"\361Ip\20478\"\0229w\277\377\\\376 \321qI\005k6\3638\274\251\300\300\032J\241\346\240\314>\242i2\016\377\t\2253\355z\241IsY\n\376:<\276*6bj\030\273\033\322\211\005\205nWvx\004\214\3558(\254r\336\006S\021\243\225;}\334O\200\275AVR\274\250o=\262\3020\244\263fbq\bh\234\177Z\034\214=\317\321Y\233\007\020\275\265\237\327\310\367!D\247\245\270pu\036\215\220\250\363t'\317l\222\237\325\222U\311\024\361\377Y\004y\227\240S\256\216\322?\326\002\316U\001K,\343\313\365x\360\372S\365\365\312\331#>\3776\206\001\355\227\260\367\250)v%\t\001\317l\301m\331\261\003\361\200)(\006\0248\022\005\313\025\016e\347k\256\257J.\007\351\311I\007Y\b\211\226\001\343\332c\233\276)\315h\275\031(\207\351=\300i\0379\324c\330N\t\272\357\262\316,\372"
+	.ascii	"\016v"
+	.string	"\222\b\200\3351SoJ\024\017\272X\276\310\216\027\237}\341\3228\034\303\231\005\367\276\270\334\331}Kw\fITQ\364\252DAj\300\237\276O\034\222\304]\353\240\030\212\"\374BM\371\250\273\206\032\233r:\355Y\306\314\373\\u\262\305*:\255P\307J\275\250\215\362}}\202\234\324>k\350\277\202\316U\264\260\325z\333\273\257]\223R \370\235}\374G\033\3461l\227Bf`\240\244pX\023\255\217\200\206u\226\243V\347h\207\035IC\301\371y\301\320\344V\351\\V\021F\214\225\335\262s\025\2739\331\363\201\336K\262\263\233\223\f\373\260\317 \321\232wg\f\245\026$\024cC\345\264R\203\323\301Z\332aL\262T\331\371\032\233'\242.\223C\366\001c\254\363\330\265joI\004\3435\0168`\031'\207\325\243\314P\034$>\214\357Od\353\302\262\367\261\371\036\306V\2476\237\025\265\013\274Q\017\236Q"
+	.string	"\321\231\n\035\0230\247\304\254>AT\340\311\363\034\232\3127\025+N_-!{\263\267\360\001@\3442\221\201\307`\005&\263L\372\016\333"
+	.ascii	"m&\376b\021fF\246\350n\260\325\032\206\032\375\255\216\256\255"
+	.ascii	"\233a\304\267\2729\243\271\220\223\230Xj\277\241T]d>\335\210"
+	.ascii	"t\r<\004"
+	.text
+	.section	.gnu.lto_blackboxInit.242.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`y\002\245\022"
+	.string	"\266\340vI\340\320(\035z\234\240\272\330\232p\360&\305\177S\251g\211\202\tu\016\337\302p\374\347ak-<"
+	.string	"\001\234D\255\344\265\337\007\b\030\f\314\356\247V\300\020\202\031\3039\355\313\230\3718%\243I\023I\370>\212X\262\311\336)\005\\"
+	.string	"c"
+	.string	"_"
+	.string	"\325\364\016\357\265\373"
+	.string	"\357\325'\341\262K\257\263\344\227M\364\221\266\006Z|4\360\314\330]\220\316\376z\355\350|\371$\224\215\210\f\352\021a\257\344\001\250\210.\357H\250\362\363\305D,\250Gt9\025 \312:\323\356\276\366\271A\214\315IB\355\256\247\212\350\341\366n\233\202m\t\366\324\t8\341<2\203\231\r\320N#{\214M:c\277[*c\323\351{\td\320|8\314\321n\207\243\032{\253?!J\036\017\333\213\017\306\362\265h\361\301\235t\375\306\327\361\260\301(\275\332~}l\231d\343\212\267\3014x}\335\370\230\3639>\316K\270>\266\272q\305\002\261\025\334\315\214\335\321\301\253O\337\0035\271\242\362\247\005\215"
+	.ascii	"\342\3719\224/\267\\\214}\313\373\316M\3414\362k\377\312O\215"
+	.ascii	"%W\264\323\b\205\355\262\211>\332\262l\314.x}y\216\322&&\207"
+	.ascii	"\203M\033swa\324%\336i\212t!\2334l\263\336S\362\355\312 \370"
+	.ascii	"'n;\361i^\215!e^\345\325O\361^O\017\f\005\376PE\by\220\nY\235"
+	.ascii	"\b\254P@P&\244\254H>\253N\031X)\021\025\210\205\024HR\001d\004"
+	.ascii	"T\231\234\200'\004f]X\231\200(,\226\tX\032\303wKe\3141\253\335"
+	.ascii	"B\032\263\277\3639\023q\013s\216\013\353\n\026\244\216sj\310"
+	.ascii	"\237&\344r\353\350\214\317\375\024W\321\362i,22\342\275v\f\301"
+	.ascii	"(\020\002\001\024\240\264\t3 p\002)T\330\r\270\375A\327\023\032"
+	.ascii	"z[\n\f#\254\3356k\321\036\307\245\271]\226x3\030\323\020\362"
+	.ascii	"e\261\035\202\261\fT\346L\313\033X\007e|\032\344\215\004\263"
+	.ascii	"\3624\023\024\304\217qT\b\333\006P3\254;\306\007-\231\f\366\254"
+	.ascii	"qLt\310\300J\261\nb\005\301x\336X`\325\230~\317\217U\310]\362"
+	.ascii	"!\204\207\306\202\034\351w2\b{\317\322\326\2322"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.348.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"U\t"
+	.string	"V\320;70\221\322\001"
+	.string	"\257\271n\033r\222\301S\370Z`8$J\271\330O\303\367x\335\375\037{n\032\336\f\214{d.\005\005\221h\231\2353\351\034T\020\332\341\311&R\246\024+"
+	.string	")"
+	.string	"-"
+	.string	"kJ\200\245`\260\330\354n<\324\221{\327\314<\377\3379)\225\351*\240\332x\016<\003X\330]\007p\334\360\266\025l\037\330/\b\253+;\323\231\351k\371!\300\354f\304nV\004\276\234\330\377J\366\346\177\236\275\035\036\305v\311v\275E\262\032\366l\027\201E\372\213\020T\306\274\"\272vJ<>\374\221\346\253\2745\362MLA\312\247\016}\222v\330\231\2519e\314wyu\310l\302RY\326\354Y\346<\025\035\310\201\373<\200bD\303\007\"r!Q\364\030\270\223`\b\305\211\256\013\305\355\2722\347\005\022sR\224*\313vjK\212\346#\355\232\001\030"
+	.string	"`\251?*"
+	.ascii	"\2353\360\300\017\206\030\004L\351\265W8\005v\2401\245\360\003"
+	.ascii	")\344T+\340=\200\302ec\212\2611\247\201\300t\247\001\340\332"
+	.ascii	"\213)\247\345\364k\313\030"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.408.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`W\f\365<"
+	.string	"zb\300\025DPdR\007\023\347\255\211L\\\342\230\n}\\\276X_\354\330%\265N\253\n\306\344\004\264\210%6\222&-\207\235\251\203\251R"
+	.string	"T\220\002"
+	.ascii	"\"P\274FqM\256XQ\352\240\243\0067\262\226%\273\211L)\005?\001"
+	.ascii	";\001N\001\335~\306\314\204\250\234gg\366!zq`U2\016w\303\251"
+	.ascii	"\275\"Z\207\314\215\037Q\275\275\035Q=,\355_\334M\207S\333\333"
+	.ascii	"\204_n{R\316\006\205\244\234\346&\220\013L\265l\017\003\262\300"
+	.ascii	"\276\207i_s0:\234\r\3527\315M\001\311\"\325\262\275\234\247\020"
+	.ascii	"|\355\017A_\221~^\304~\321\321\355j\335\303\346\341\324\026~"
+	.ascii	"\251\245\361\350\366\341\324\006\362\325\005K\316y\bl\347\"\325"
+	.ascii	"\216\326\303\226\362-Q?`\232\235U\316\005\017}\235\261\307B\267"
+	.ascii	"O\333\315\374\f\373\226(\241L\227\335\331&nM5\347\251\222\257"
+	.ascii	"\035!\350kO\375\210\3655\350E\254\257N\326\335R\335v|\n\315U"
+	.ascii	"\215\273\355\f\b\222\217\024\342\300\226i{9\347%_o\227c'\016"
+	.ascii	"\205AA \273\376\356\027q\373\321\211@&7O\220U-\313\002\305\271"
+	.ascii	"\304\207[.D\n\253\332\372\240\237\203\352\333\036\247\253R\362"
+	.ascii	";"
+	.string	"\242\002c:\232#\b\253\322\372 \002 \220\t\2123\313\331%\232\220_\237\331\274\362\237\260y\345\327\330T\376\220r\316\016\347?\325L\376\023y\021\310\224snG2\3616zw\227\351n\250n\342/\330\n\333\016\207\245\370\312;\363o\206\247\022\316\335+LJ\227\277\257\350-\314I]\222\364\212\337\366?\016\b\217\265G\033g\301d\357LL\306\372\372r\314<\004\337\215\267h\270)\236\311{\354$\351\026_\237==\337\243\347\275\315\260I\362\360T!\270\235:W\355x\037\f\314\331\260d\347w\034:x\360\300>\3608\037\002@s\316\030\332\3378\034\020!F\214`}\275iL,\344\007\352$\251\025]\2007\362^\303*\271S\335\r\n#4g\2443\333\347\274M\211\366\250\257}\002\305;\023E\n\025\357\314F\022r\217\355h.dKR\355\223\227\277\357/W\337\242\377r\316\271\257\224n\241o\001"
+	.ascii	"\276\003\f\277\217\206\337F\304\357\242\3417\221\361{h\370-$"
+	.ascii	"\374\006`\3746\n\277\213\302o\"\361{H\374\026\022\277\203\210"
+	.ascii	"\337\301\3427\260\370\315\022\277\327\342\367\217\370}\207\337"
+	.ascii	"/\374\366\013\377\305\200M\316T\201\374\344\347J\246\212sq6M"
+	.ascii	"\303\263\363\250\341F\323 :j b\027GU\375\2524\375\364\313YS\250"
+	.ascii	"S9U\352n\037\3754`\nu\n\261\352\bI\263\344\353\032\301\f\340"
+	.ascii	"\366/\263\222|\034\336x\273[>m\037\345=v\361\032\257/\0019\003"
+	.ascii	"\226x\213\027\302\022I\262\355\373*\355\037_\022\005\004\366"
+	.ascii	"E\274\f\244{LG\234\314\023\034N!\"\027\344\241]C2r\244\214\201"
+	.ascii	"\243\023rQ\265-?\n\024\341u4W\n\223\363lbv&\324\003%\213qG\362"
+	.ascii	"\245\306\210\225<\371\373\336\200AO\"\270"
+	.string	"\371Wn\352\233\340.\317\212\336a\262$\350.\360:[\223\232\005o\277\326+\301F\250p\263\3316\264&%c/W\377\217\275\016\347Cf\330\254\232\334\337\005\336)\334\305\006\257\013\253\307\302]\"\242v\260\\\341+\026+Zg\317\352\221D\261\276\006\257\221\327Y\226/\342\316\305\221\220\324oF=\200\346\254\264\361U\370\312\207\302\342\320iR\226\263\022\203\257\375G\236\n'\371i\341-v\213\365\225IG\005\237\316$&ve\022\334\312\0239\006\274\375\314\237\242\341\004?y\302\372\352h\376\201\253\r\r3o]/\033\345\207,\327\353q\356~\367\376.\001\271% \207k\314\365ApW0g\245\205\376\344+\261\027\246\202\277\276\256\253y\235]\377\234\363\361^\256\356vb\377\026\301\250s\224\317\327\r^\201\007\035\243)G\213\034$x4\325\b\366\205\027\031`Tp\001\243)\202Q\323\f'\030O8l"
+	.string	"\373E\204\036O.d\274h1\303\305R\r\247\0264\226^\340\200Z\212p\240\237l4\341X\312\361\364\204ci\350\277|\2454\023\362&\273=\214'\211\221\265A~\037\361r\365\013\225|/\356\317RL\320\003\037\272S\335_\306\373\323|\034\024\265MKc}=\272[\022g\013\006\026\035Qmkz\306\311K\213\247\340K\335\230\233;\264N\332\346~DM\253M\237<\357P\254\207q$$\231\200\013\267\326\316\031\357\262~\314\277\261\240\266lm\033\0041\327\247\224\210\215]\267\366\316[;g\342\273[3-\232wf\200+\345^bW~\315\331\342\336\360\030\333\376\347\277\340\2615\230\254\200\235^\330\226\357\362i\355\035\271vn\216\365U\200\235\036R\315l\350.,K\235\326\021\232\233\026\257\301\023pl\245\356\350\272\331S)vet\346\324\302i\361\334"
+	.ascii	"[t\215\256/\313$[9O\246\245\210\216\016U\254It\373\307\036\213"
+	.ascii	"S{\327\342\265x\254\257\017\207\2317t\211\206~\251\240y\211\023"
+	.ascii	"\376\321\205\356\365\360\236\275\275\303v\267x\332<\357L\241"
+	.ascii	"\313Z=\257;\224\257:&\210\001\013`\310\027\201\031\250\241,&"
+	.ascii	"\025233\"\"\222$I:A\005\304 '\235<\017\022\300TzV*!\032I\f\205"
+	.ascii	"}6\003\223\325\366\327\257\t>\366;Q\b\253rB%\260AJ\030[\252\271"
+	.ascii	"nX\203\304\247\036l\213\212?M\267\224M\2076=\246\376\204F\223"
+	.ascii	"\3176\271\020\301\002r\0239F\246\021,\2129\240\254\260\t\263"
+	.ascii	"?\006\r\223\317\031I`J$\036\222I6\204<"
+	.string	"\251\037\030a\241Y\n*\224\037<\211$a\304_\256:\001\024\002\0321\246\360!\\Y\272\367(b\353`\275d\270\230\210\313{\360&\032\033\253z\376\214\222i]\030:Azu\327g\364\017cR\b\222&\213\256H\230\025u\312\354vr\200`\220\377\023\227\307\033]\347\303\235\n\260G\b\376\246\211\031\303ew(w{e;`_\341\374\235\276P\026H}\006QY\252\353\022\256:\347N\330\253N\363\206\312\321\022V^nLE\346.\261\377\326\002e+\314\230\0272\275uz\330\346\201\333d\355Z\301E3~\261\336\005w\351\352\217G\271h,\265\334\036h\340][\345=fi\r3v\363\203\017\371\221\001\232\305J>7\376\016A\270\345\262U\267\303\340[\254\r\027K\332WL;.\030\034 \301`\2527\032\250[7\275\345>\204\002\267c\020\004\243\231\307\037n\026\007\320\313\027\212>\210d\2514\031"
+	.string	"\314\316Gh\005\215\022\274\0162\306\317}\224\226j\254\202\033\265<\340\260Q\275\263"
+	.string	"\003\"\323\2420r\300\025;\3641\033\326e\307\333\b\354\345\213\311A%\021\235\034C\262\207`%/\214+\320!/q\342\313,7\225\036+\337;>\212\262\022\266\245\342\261\212\244\307"
+	.string	"OGV9I6\334\007\031(\246\253y\027\275\2509B'\273^\200:@4\221\003\264Y\2350\213\251\013,9N\347r\322x\030\317P\345Y\234~\b\237\272W\212\272\357+_up\021\326\020\372\023\214\001'k\302\233\233\0076\342\035H\267)\nUY\357\227\315\373\361"
+	.ascii	"f^b\262#\r"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.410.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`H\001\245\r"
+	.string	"v\031\\E"
+	.string	"\2216\035pC\331\255\007X\217\347\227\364\267\007\355Av\310/\334\223\255\252\347\372\\\360\214\367\r\026\021\021\373@iBK\211\341\030\242\206\r\300\177'\254B)\035\232[n\271\204\277\013\203M4\177\333\233\354\235RA"
+	.string	"F"
+	.string	"M"
+	.string	"\2171\203\0206$v\367\222~X\262/?\374\354\353\364%l\227L\376\354\031\257\340b\242h!5\356\256v:?\374\373\224\325\347\253|z\\2\\\006x\305\371\330]w4\334\364\266\021\330&\3317\005\025<y6\310\2500\216\273U;\225\366}\324c\374\224/\227.\223\"\261\272'\323h\005\310Q\017\375\231\021\013\020\3733~\375\211\3572)"
+	.string	"\266f\357\022C\204Ac\267z\234:\353\234\272\236\200u\332\271"
+	.string	"\353\324\244\347\254\323\003\240\215\025y\343\217pQ\303\221\266'A\276\305\006X\246\212\037\376\027h\302z\243\306J\034r\302xV\257v\276\330U%\332tt\330\305p\223c=P\025\"\216:\n\243T\313\241\202\247\247^\26401.\205\352a\233d\024,\036Q\260-\020I"
+	.string	"\022\te\003N:\016\202\211\367 \244\244\201\203\220P\367\031\3610o\331\004\016$\332>#\220V\022\341C\242m\235\247e\005\314\231\204:\355\204\343:\355\262-?_\374\2612Y\346\204\271\310\362S\234F\344\2030\t'\337r\352\032"
+	.ascii	"Qh\007\251\355kfO\226\362p\316\300\257\276\202F\203V<\200\n\016"
+	.ascii	"\020\005\303\\\341\326\254\020\020\304$\f\223S\3675UP\324Ah\n"
+	.ascii	"at\006h3e\247\001\340\332\003n\264\210~W\031\003"
+	.text
+	.section	.gnu.lto_inMotorTestMode.part.0.411.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\226\002\325\023"
+	.string	"6$\202I\320\3626c@WP\304\216\231\246\343\013\345gy\330\315\032G\221\265\225\001\025\344=\2346\345\322Q@{\222fc\323\023\236\274\375\271f\247\370/\353u?\300^\307\b\240\313\022\221\001?}\250`\233\306\325\244E\334\204H\231Rk"
+	.string	"n"
+	.string	"j"
+	.string	"\267\353\325\232\234l/\356\275\026\300\177%\037\200\372\347]"
+	.ascii	"\352\337\312E\004\373@\227\021+\241I/\rUk\322\331L\3769\004\377"
+	.ascii	"=\206OP^\"l\373\004\005\346\330\323\036\032I\016\205\215\220"
+	.ascii	"\356\336T\374gW<v[\275\230_g84\267\307\335\003\372\331\301\344"
+	.ascii	"\003\207C\342u\344\236H\312\275\327`\211\373\273\355\006\266"
+	.ascii	"Y\330\225'L\270\231-\307\313.\357\236H{F\274\366\343f\323\335"
+	.ascii	"\016\251\311\321q\310\330eo<\324\250` \303\331(9\005?\373\216"
+	.ascii	"\271\221\303#\035\226\271\2219\374$\351\356\275\251\352\023\275"
+	.ascii	"\374\333\213\216s\312\257\327\353D0\037\350A\037r\352\337Jg\310"
+	.ascii	"\257q\033\260\013m\370\235\335_].\205\323\275\351\005\360_\200"
+	.ascii	"\352\023\344\317x\n;\r'y7\266\035\320L\334\256\335\361\213`\354"
+	.ascii	"zT\353+}i\364}L\226\365\26327{\252\251;'\270y\013\352\266Z\013"
+	.ascii	"\344C\216\254\356\234\252\366\013\253~v[AGfi|\334\037\302h\211"
+	.ascii	"G\220\247[\205T[\263\365\356]\313c\273\332\202\325\025\254\276"
+	.ascii	"\210\227\273\001 \347^\332n\310\325\371\220Z\274\350\277\375"
+	.ascii	"DG\202\2111\314\016\202v\t]+\363D[&\211\201<E\322\200]\302\263"
+	.ascii	"\234Q\261D\324\245E\265b)\260\322\032Y,\023\302\330R\221\250"
+	.ascii	"n\005\344\002\026\024\025\2262$Y)\321Q\203\n%\037\234&jN([\024"
+	.ascii	"P\327XJ@G\002&\303\031S\345\205\034W*bK5\262D\362t\211\341\001"
+	.ascii	"\233\031\312SDM\363\024S\367\256\345\031\251\177\fe-\b\333\326"
+	.ascii	":\245\306\312\254\255\0051 \240\242)$z\\|\241\031\216\231\300"
+	.ascii	"\034V\350\266\003]\357fc\340J\340\273\206P\006\331\224\006`d"
+	.ascii	"\b\0036@\211\3060\233p)P\350A\310\3560\\\305q\bY\267\267\004"
+	.ascii	"G\274 \313lj\002yI@\301\2578\027\032\321.\340\017g\027\345\277"
+	.ascii	"\322\3260\2751QP\263q\332D\274}{\343([\245\271T\303S\237\302"
+	.ascii	"\344\324k\315\030"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.412.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`l\007]!"
+	.string	"v\267\302G\220XN:\303{G;c:\306\343\206\321\266\213\237\261\261q}\245S\237\341\317=\316\tF\016h\256\377g\316\001\277\270\217{8\020\021\030\300\243h\006X\025\007\255\b\to\033\247\024\t\305\216t\2645#\226H\3332\245\253"
+	.string	"\230"
+	.string	"\264"
+	.ascii	"\t\350\336\314/\362\262\363F\230tn\252TY\n\t\346I\027M\247\223"
+	.ascii	"5\351\212\365\312\352C\231\004\273/\372D>v\236\254\311\274Z\271"
+	.ascii	"\230\240\325ZDp\322=\346\311\340\005\224'u\017P\236\264/\304"
+	.ascii	"\266\223\225O\333\355E\257\252S\306\215\312\314L\255\225x\222"
+	.ascii	"\336\370\371\036\317\334\225\244\216\256\357\364\267\352\352"
+	.ascii	"\351\275 <\035\034\0171\223gW\002\257\250t\301"
+	.string	"Z\253\357jjI&,1\335\317nn\201S\361\306\325\"\353\024K\n\306\211\336UT\3313~\031\317e\225U.\200\373v\016j\255>T\214\373w\333Jlg\260w\r\002\337\252p)\302j\255C&\276\226\375%f\261\016O\236\006\251V\316?\272\240t)\245?;\217J\016j\356M\345\351R/\025\214\250\235\363\301\310\375\326f\267\261\264\215\216\366U\016J\321'\377\354\307\001&.K]4K\273L}\327Uj\303.\3278\345\372\206\\\333\220k\240\271\256\341\255\177\344\332g\256{\346\232\267[\233\345zW\256\313rM\336\354\327\221k\252[\357\213\377yv\bQF\255,\346\322\324-\362\t\230\355\333?s\262}\376\331i\373\354T\254-\214\242\002\377R\377S\362h\217\352\304Mi\331\021N\346\307g\f\320\016\217\372\264\035\201\320\0330~\245\225#J\223*\225u\221\3323\266%\374m\204p\302\303"
+	.string	"\345\230T\330\366#\355\303\243\017\262\307\256\302\277x\331\035\303J\013o\273p6\f%\r\265\017\2173t\264\353\230\225\263$\2653h\2607\234\013\207\237\035\364-CB\266Z\253\002-%\210|\035'}\246\362$IycH\216XG\373\217/\326\2366\316\3646~\031\275(\355\262\261\370I\326\300\252\370V\b\250\255\230\342S\001J\311a\364\241\324\244me\205\325\255:t\342?\261\233Y\353\323\265\374\246\022\255\006\366\220\004\"X\224\024\354\200\024\301\027\264\024\324A\347\005C\f\212|\204\212\210zr\226\220\210J\020\221\036\3521\221$t4\024\004B\210\210d\024\024\2028\244D\202\330\263\343$\021DJ\304\245\244$%\242\317\366\336\001\024\215\362\227\374tnn\356\2557\346\300\305\020\367Gv\305Yc"
+	.string	"[\255S\257:\273\314)\n\005\316\033'\216\267\265\017\217Wxj89\266\n\305)&d\303\241r\263c\247N\260=q\212\335L\221\362\3411\212)\\\033\037\347\217\023\310B\235B\366\t\250"
+	.ascii	"\233\r\032\260\206\002\345~|\342\200vj\250O\333\330\216g\177"
+	.ascii	"\324>\311\036"
+	.string	"@\370\0317\001\302\001\t\275~A|\3246:\352Q\037\r\200\227\250a\\\003\025*\021\021\021I\222\0242\034\340\002\021\032Z7\021\300,&\235CSR\330\264\337\001u`\222\302\0376\375K\200J\276M\331\301j\006X\372G\351z\374\341^\276\233\004\3627wZgX\034\367\245|\260\245\t\300\034\336h\236\375\303\371\235F\330L\025\370S\215\340\334\220\272\201\201B$G\033y\005K+Pw\350\2607\271Mm\334\333\016\303\244]\351\340\327K~\255m\256R\376\243\024\005N\001\004\030'T\345\3554/\\\246Z\263\232\020VN\303\225[\0247\365\r\214\303\227\251\330&\t\224NR^\214W\261b\022\334I\245\025\241\004\370>\276*\241V\304\253\351\025\361jzE\346l\202\"a\206g\251Z\267\001\343\236\301\365\310\331h\253]v\357X\211\246I\355\273@\372{\243t\236@\342\027\f\267f\263Dd\210;"
+	.ascii	"\367\347\314\304\024#B\0018\337\315O\r\340=\255g\371[\227\260"
+	.ascii	"D\341iND\345us\021~m\342\001\252\216Ka\2472\207=\334\212$V\b"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.415.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\276\002\345\024"
+	.string	"\026$\203J\260\022R:\216\223\013\264=cR\345\327\350\031\026\312z\203\320{\312\276'\240\245\377J\316\373\b\222E\035\007{\255\333g\332=\365\375\323B\266\277w|\f\235\364\215m\374\032C\007\024A\337\017\271vS\362H\242y\262\311\336)\005d"
+	.string	"t"
+	.string	"m"
+	.ascii	"3\027\312\215\303\2651\320\253\241\002\262\332\0356x\365\253"
+	.ascii	"\365\212\362\023\362u\274\t\371\352\327\230\231\276Pg\273|\341"
+	.ascii	"\316v\275\236\206m\335\t\357\354\251\017\203{\340\351\305\210"
+	.ascii	"\322jwa\257\324\305w\247s\334\371\302\317\036)\232\323\227\237"
+	.ascii	"8\304^\024\222\315\357s\300G\022\225\335u\013\305]o[\202m\013"
+	.ascii	"6E\020$\323'\307'%\0019\273&\216\024Y`m\202\341\023\217\003\207"
+	.ascii	"\364\033\016z\200\314\320})f\\\025\303\275\251\365b\344<\223"
+	.ascii	"\237t%\334\227b(\211\345\265P\020\204B\353\325\303\326M\310#"
+	.ascii	"#\031\016Dbu\376\bw#\031\023b\320\204\026\021g\273^\316<\310"
+	.ascii	"'\2427S\301\034\240\335\325](\207\"b\2706/{81x\335\031\211\321"
+	.string	"\371!\177x\033\001\005J\313\3564;\t\356.\004\035\337A\363y^\275\2416\357\253\221\2574\313W\305\233G\034`\372\245\213m\336w\372\037\260Gi\\R\024c\257\252\312?\030%\003j'\226O\364\227(\302)^\r\331\347\310\017\271~\200VU\313t\024\336\304zI\222O\361\212\2127\261\232Z\300MyM\361\371\025if\326\244;\246\343\307\335]S\035;\262\233L\303x{\241\201\240U\307f\021Z\036\260\264\320^\004h7\331\255\002\216\366\322\362\354\025\302\306\322a&\363\300\002{\251\311\\`3\230\030\330+\201m\037h0\260\233\315\006\003s\331\236\037\227\352\030\200\017N\221G{\366\207~\341_\223\364\003\3741}V\241t'\307\375\247\373\310\371<\276\260\262B\276\236\ba\261@j\005TK\n#\251\037}i\f\347\221!? \200\002)\033\233\007\250\375OS\257f\212\341[\201]\207AD\345"
+	.string	"\013`XF\262\200a\2135j\203\021AeJ\243\305\310K\213\3711\326\307\001Nb\213\332G\202\320\211\337\276\322@\332A5\3266v\305Z\305\304\253\366vf\323D?lcd\341x\204\250`>,\240\\\206\366\300\0335Vv\\r\3343\3744\024B\030k\027\023\246\3354vsU;x%\227\037\307\r\246\310R\204\262\345\255\260"
+	.ascii	"j/\324\262\241\324\376\023\314\030"
+	.text
+	.section	.gnu.lto_stopInTestMode.part.0.416.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"e\b"
+	.string	"RO77Po\322\001\203\305\244\310HiU7\036\032\265\254\013k\022k\331,F\246\016T\267\206\362\0014jZ8\326,\350\237)W\256\334\032\225-s1\315\020\337\222\275\345N)\3166\026Z\007\"\343Dt\346\304\003Gbf\333gn\016\254Q8l\263B\323\266\211\331\206\217\253&7\244TX.#%YUO\366\\\276\352&\036?\304\037\020|w\351\203\256\313\004\024\314\b\266|\222o%B\373\002\003\2763\002IE\036@I\215\260^\026\306@=Y\343\343\252\311\216q5C\340\261\253\321\222\331\017\231\"b\337\013\331\230\357q6v\371\022\333\241\rsv\313U\2505X}\031'\337\356\316K\0059w\205\221\363\357=\240+\211\256\002%\216\303\202G\r\303\356\032\240\343\226\267\275`[\3016K\022"
+	.string	"g\325[\233\300x\360i\f\241\036\342\3013\f@\036\030\341\212\241a\202\315\031Kg(\233y;-"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`t\036\365V"
+	.ascii	"\332\2138\035Vp\320\345\244\003\317E\217\301\356[\365\003R\027"
+	.ascii	"\211\341\300\334\271\244\207X2\352z\260\336g\263\361,X\211J\177"
+	.ascii	"p.\277\2729\256U\260i-\212\253\351\3275YX\203\351\344B\343bB"
+	.ascii	"\343bB\343m\017k\313\245\332+\273\201\312\340/!\214\257\002\370"
+	.ascii	"\215X)\323\016\260\001\270\001\312\0018\313\303\267N7\333d\263"
+	.ascii	"L5k\322l\322\214\3351\263K2+\214Y%\031g\021c\217`\254Qou\300"
+	.ascii	"l\021\013\373\364\262C\274~\021\032\276sY\241\027\317\301\005"
+	.ascii	"5\033[P\266\fVL\271,\213>\221\235a\243d\350\017y\341*v;l\351"
+	.ascii	"\237\273,O1\272\360\025+\372Z\253bsV\3667n]\032c\2126\321\365"
+	.ascii	"}\271>\316\222\375_[\277\006[\277\334\265~\316\252\365{v\311"
+	.ascii	"\302\244\355\313\250dyh}\237\215\371Y?\207\331\272\030_\326\027"
+	.ascii	"\312\341$Y\237fla\214I\372<+\366\225!\300\341\316\221\364\177"
+	.ascii	"\216\354n\304\241\277d\244?\024\3267*\366\225n\350K\335\212\364"
+	.ascii	"k\210\364\201\007\353\353\f\351\023\235\375\243\375\352\013\211"
+	.ascii	"o\031\205\364\231\326\253\037"
+	.string	"\264\267\256>\217 \375\247\265\241?\265\005\354\030A;W\037f\201\254n\244\271\377\240G\266\356B\353-\262v\005k\353p\311\253M\301mmmY\267\352\277\254\217W\275\270U\025mcA\317F\252S\365\270\017rH\213\351\351S\375\253\225\352\367\210Z\026\250~\324S\037\212\307\266\334\234\372NM\375&\246\317\030\227v\206\321\354\233;\372;\204\313bT\352'%\365\221\220\266\305x\324\327\261\026\344\244\211\335\250_\244\3432E\217I\"\311\026'\352\003\355P\377\306\nm\214\221\202\375\310\240z\260oc\203\372;\013t\031c\216\22512\245\257\344\177\036\303\247_\003\216\245\271\321\247\221\300{\266f<O\377\006G\352tIB\2246\245S/~#I\222\274\215\276\315RJI\240\020\024T\300'\345\271)k\305\345A\n\370\345\004\3743(\001\343\3143I\222\271\007#\340\023\317E+^K\t\b8%D\275"
+	.ascii	"mRP\007*\301\036\314\2233G\t~y\006p\314XzP\tV\321\013\\\351\325"
+	.ascii	"\251\275;)zm\350zo\344z{\230\354\305\321\326\353\303\326\233"
+	.ascii	"c\255\367G\255\027hI\337,\255\177\246\244O\206\326+u\326\213"
+	.ascii	"c\326/+\353\253\345\320_B\326g\033\353\243%\351\275\022\353\355"
+	.ascii	"\201\244\267\352H\257\017\034z\255\214\364N\205\365\"\025{\211"
+	.ascii	"n\350\r*\322[\022\351\r\202\365\362\f\351\255q\366\316\370\352"
+	.ascii	"\225!\366\316\b\351\215\361\352\355u\365\225\004\351\245\301"
+	.ascii	"\206^\027\256\336\027@ze\370\321\273b\253W\205V\277-\253\237"
+	.ascii	"v\222$)%\321\266X\275\271\017\351\025M\262\242J\243\017\212d"
+	.ascii	"\244\264\005\024*\244@\202J\025M2R\n\202\n \234Pa\204\024F@\361"
+	.ascii	"\201\n\n\016\320\327\225\245\242d=>3N\365\3076G\323*E\373\216"
+	.ascii	"*\221\242ec\324\3260.-T?\311S\377\206\345\2616\243\323\372F\006"
+	.ascii	"z\200\240mS\377\213\251O\\\352\013Y\263\331F\311\356\350w-\315"
+	.ascii	"\255\360^U\2519&\251\037\004\251\017\344\250O\303\352H\"\243"
+	.ascii	"\276\213\216\346\032z\265\302\207\213-\352\213\021\365\303\206"
+	.ascii	"\372\305\255B\3153\033\334\233\032\324,\003D\227\304@\327\306"
+	.ascii	"\034T\355\3473\214>\177\201\203\346p\2439\306\366\364\221\360"
+	.ascii	"\\g\343\271\235^\256\025\253*\363Z\235~\326\002\373?\266\206"
+	.ascii	"\245\032a\370ZN\177\253\306\353\357,c\013\227ai\364\261\266\\"
+	.ascii	"\250\337q\b\346\216U\254\276c\023\342\317\263\243\361\272\212"
+	.ascii	"\267p\312\360\244l\345\026\242\307W\330\004\325\372\n\243\370"
+	.ascii	"\276I$\231\243\\\345\024qs\257lrB=\307"
+	.string	"&Q\3171N\3529F)\373\277\302\204Nt\355f\002C\327n)\345\rx1\022\372\023]\343\373\250\026]\343\001|f[]R\236\231d\347X=R\026M\260\363\253\"\225Ef\360\f\252>\245\316)@\r\001p\3126s\311\231V\315\312\261#E0\342\021Q\220\017\017\220\177\354cK3\033\013#B,\n\352Y\340\342\260\231g\346\330\211\244\206\225D\314\257\223X\217J\"3\350\374\351)y\352i\222\255Z\243\036\247\214\241\376C=_)\240\250'\224'T\036\264\310%\234*U\204\222\304\211@\025q\2060?\234(\3657\034At\356D\213lb\322\"\343*\021-\362\201\302_\314k\305\177\347\307\255%\266\373\352\337\344B\b\017\026\314?\200F\263B=\023=\031\205\356\224\330\202uC\265\350\311&\230_\"\244\243\"\025\363\237Q\3235\003g\024\243\367%z\362\207j\3223\200\";>o\242'\207"
+	.string	"\361\241D)=\020\271\303ir\016Q\"\221q\365e\220v\261\211.\366P\271\030w\223\213C\370\215\324\242\\\317I\023\243\372\016\252\305'\262\370'\026\226\220\016\371I\364\212_*\321++$\352\203O\352\021\255b\223S\007\225b\234iD\245X\345<M*\242Q|\"\372\3047O\374F:1\356\374\215db\342\021\365\364i\b\264z\220\232\354\301<\251&\346\251\330\0205\271\003\025\362\317!*T\242I\035\360\t!\016\030gn\300\270\252A\006\030\\\300\027Z\3008]\224u\210\017@\306\323\217\327\324\020\036"
+	.ascii	"\246\234\265\333\374\307\374\323\235^\031\t\345\334\227V\177"
+	.ascii	"\234\231\347\35787\254\002\001\343\372\252@\216L\033\210\352"
+	.ascii	"\001\030\332\251\017\022,?R\215i\275+\350\347\364\362\361\365"
+	.ascii	"\b\177\300"
+	.string	"\2213\035\357\001\313*b\313\177\274?\335\0010}.\357\261\351\3169j\314yd\265\253(,\026+\321\207t\006\205\301J\344)c\320\321\027\314\022|\247P:`K\250\326\177\254R\315S\004!\3771\211\362'7Cn\374\352?N!\376\307 \312/\340\302b\276\352\374\372\217?\370d\376c\224\363\004\260\230\276\237\377\031\020\004\023;\315\177\214+\177]\023\226\222W\375\367(\034j9\347\235\006\207\250W\3671\b\341Ad\341\240v\227z\240\373\370\272\232\337\234\352\210%\367\231\333\320\254\025\0277\276u\033\232\327\260\211\356;\204q\032\306\t\177\340\020\210u\336id>\303\035t\273\313\360\253\f\233\370\215\214\271L\0034\\/\317z\f\343J\030\\B\331%02\263\365\336\r\245\354{\244fV\344\275\333qJ\227c\275\307\367\021\277I\200BD\342{\374\202\357\035\300\212\260\320\256\367\030\205o\345=\016A\370"
+	.string	"x\\`)>\030\342G\004\311\272\371\313{,b\355=6\021\036\247dc\351\365=>\361\235\202\305`{9\3570S\207\341\016\304\323/2\265\235\363\376\222v\323\346\344\301\013\2330\351P\236T\024\341\207\362\303\363\030\204/D}\003C\340\325\203U\304\320y\234r\236\351<\036\341;\035\002\2079T\353\274\253\273\260\007;\306\231FU\337\261\b\037\004\337q\212P\201\357x\004P\202\020\250\222\220P\323\267\314\b\315H\322$\035\362\013\020\222E\265td\033\022\240\321\230\224\006A\034$\206\b\206H R\367!\216=\340zTj'!\020.\211Q"
+	.string	"\b\250\n&\264,\204\267w\350\026KM\262\334\213o\201jyEMg\214U\020\037p\267\366"
+	.string	"6\246,)\2251\344"
+	.ascii	"\207\267\f\231\227\353F13\004\370\212C\243;\314\356D\237\200"
+	.ascii	" n\250"
+	.string	"\fg\326\343\307q\t\374\247;@{c\213K\321\353\372\241\241\225\267X\227}CEk\260|\3254RE\\\337'$*\301\353\354\351\351\361\024\022%\362gy;\343\340\310qR\301\304\264\310AM\2055\274yfq):PoN\260\265\022\276B\207vsb\350\023\024>Aq\306\312\255urlb\254\373\205\342T1l\215\020keX\260G\320\257\013\026o\344\2310y\256\367)\347\346\337\021\257,lO{\374\310\332\3610\253\243x\213\367e\034\242\027*J?t\360\253\325{\357\225d<\303=c\006\333\375\242\3169\022\242^sc\3613_\215\304EG\346\352I~\261\332K\013-\375\004\353\345\347\346\300\303\325\301\303Z\307\001w\364tq\360t\361{\2316\260 \312\023\017'\375kJ\277o\364&9\225\272\2460\266@{"
+	.string	"J\b\305\026_\275\345\253$\242|+He\031\233\213\213t\204<\345\203\326\277\245\213\360\253\253\017\023\267\020\250E\274\353\030\362\231\r\214g\004XU\335\007`\355\310\204@\247:Z\222\017T\211g\231\255\365\203\320N{\t\320\313hm\031"
+	.ascii	"&\307 \271\024\314\007!\024\207\027v0\313\334\203\007\004\311"
+	.ascii	"%\300b\375*\351\353\023a\361|\264w40u!l\315\225\243\030\321\353"
+	.ascii	"\323\333\251\337\252\177'_\326\367\342\nH\363Z\005\373\026'\373"
+	.ascii	"\220NK\254\034%\237\264\251\347\372Y\326\244\335\233cuX\0357"
+	.ascii	"\307\356_\335\333s\365,\277\365\261:l\034\373oum\217\365\273"
+	.ascii	"\374V\347\352\007P\327\024^~C\225\030:P\\n\263\242`\251\357\227"
+	.ascii	"7\241\227\261\347\217{\214/\021\271\200\030\020\031q\023\335"
+	.ascii	"\241\224m\375\025+\006w\350\320\n+\237\305\031\263\333"
+	.string	"\023\315n\24172\025\003\334\371\004\214\345\362\"\231\336\277'g\236\315\364vs\314\271\260\0135D\036\364\206\371\332\347$1\007\274\244\272\bH\306D*\005At\276\365M\037\031\243\234\247I\016\234\033\357\305C\3347\001\2506\316p\251N\025{\337\3677\263P\343J\241\022\003%\350\n\002\373\364\301\355\327=}SO\362W\345(;\312\177F\276>\226\307\251\212\247\225\r\314\214\365\177\357\2133\331\344\241 -\305\212PC\337f\316\317\023A\347\3321C\326\021\f\346O\264\244 \370\2445\3717\217o\211\266\222UH+\t\320q \347\3449q\017\034\0163d-Bk\237\314\255$l=\357\211B\341!\027J\005\244\313\304\334nd\027\025\261]*\"\254\376\206\324\246.\220\323j\3019\363\025*s\277\302\247+\031\007\203j\306\266\346\377\204\n|\223q\323\311\224%7c\270\222L\021H\354\\5\355 \202A"
+	.ascii	"\235\265\242<\337#D0\212\"\023M\262\202\025y<\225\207+\262\244"
+	.ascii	"\030LFpC+\210\206\232$\331\373\206\002\201p<\350\352y\262\003"
+	.ascii	"\306\247\267\352\356\005\354\013\265\323|\0040]\277\365\001\205"
+	.ascii	"V"
+	.text
+	.section	.gnu.lto_.refs.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375`\331\b\245-"
+	.string	":^,\021G\200ZN\032\003_\200\227\271\375\352@\343\266)\263(t^\300\3039,`\035\270 \232l\023g\3769OB\251\376\3031\352\233,\337\3470\036A\334\3269\006\023\035\271\333\032\026\372\303?\3609\254\327XV-!d\313\024\372"
+	.string	""
+	.string	"\001\374"
+	.ascii	";\224\317\363\006\233P.\200\350\315\277\226P\327\245G\355>P\365"
+	.ascii	"\337S\205\340\264\327\364\246\335L\177P\367\tw\036\341W\3412"
+	.ascii	"\225?)x\007\350\243\3067.\275R\202G*>\201\342\377\210\337C\360"
+	.ascii	"\001\336Q]P\245j\201J\2402\250\r\252Q%\252+\244\026\325\007u"
+	.ascii	"\257:T\003\324\246\032\241\n\325\240\352TwR\177\365\247B\250"
+	.ascii	"w\325\305\252O\365\325\236\272\224\372\223\372\224\312S/\253"
+	.ascii	"C\251\275\272\253\272\312\253O\025\252\236u+\365+u,\265\254\233"
+	.ascii	"\325\263\324\317\352\326kT=J\r:x\263\341~\031p\237\f\370#\203"
+	.ascii	"\337\244\264\023\203\177@i\017\n\177@\322\023%\275/\370\274`"
+	.ascii	"\335\004.R\317\247\201\013\354u\300F{%\272h\367\021\375)\340"
+	.ascii	"\241\372\t`\241\375\004\372\267\033}\376\364\335S?w\356\355@"
+	.ascii	";^\375g\367::\177\352>\313O\363r?\353\273\317\303\022M\220\020"
+	.ascii	"\341A\303\205\026\361\313\25396e\334\322\314\220J\210\340pA\374"
+	.ascii	"ZbN\216\370\033\027\346\255M\213\231\0240&H\212\274\346\327\307"
+	.ascii	"j~o\234\346w\353\261\345\226\373EAb\260\337\252\342/\325\\\361"
+	.ascii	"\207sr\321\374e\204\177\022\350/\033\211\374\237|\346\243\036"
+	.ascii	",}\003c\\\035\301f\376\300e\0368\2311/\300\34781_{x\313\033\343"
+	.ascii	"E\213\025\307=\261\"6\304\311}A\254\031\356\377\322e\265\337"
+	.ascii	"\376\264\321\026\373K\370\013~\333\025\234L\272\355\304\335>"
+	.ascii	")H4\230\344\007\235\274\203\321\013\230Pc\202\3420h\300\250h"
+	.ascii	"/m\017\340\267\227\347I_G8\207\237}=;\267\355=\235\331\330\336"
+	.ascii	"\240\273\350\265]\350\207g5\265?W[\203\356\235\321v\336h\277"
+	.ascii	";\355\313\265|\035\355\f\347E\237G\272\312\017\230\354\003L\005"
+	.ascii	"\303\371b>\257\363}\241~>\266\205\275\036v\205]g\344\024\002"
+	.ascii	"\253\245U\353\262\320\375\263\307\327)\367\304\273\242\334\334"
+	.ascii	"\024\273(\366\323\366\270\177\266S\253\265_eA\374T\366\304\376"
+	.ascii	"\330b\215\374kM\f\267K\241\017a\263v\264h\334\211\350+-\355B"
+	.ascii	"\364\221\214\373Q\201\245\335hK|\200\317\354A\350\377P\260}\267"
+	.ascii	"K\347v\323L\333\352\2228\232g\257\366\336^\205\355\272\303\326"
+	.ascii	"v\204n\335b\355\346b]\355\212(_\212X\330\327]\351K\245{T\372"
+	.ascii	"N\300gJ_A\372\306\341\027\201\300\007\032\376.\205{\255~\377"
+	.ascii	"VS\253\365\372\332\033\302\374\334\252\257\013\342\245\252\357"
+	.ascii	"\265S\373N\322=\202\323s\3654\335\035\244{\203\364"
+	.string	"\231\236S'\002\277h\370CA\300\357\r\377\340\373\274:\255N\252\343\274\371\306\224\213K\232k\346Y\2250\257\004o*\031\316\233F~\363\246\220\335\274\271c\3536o\262P\221E\302\254\212\243\246$\3436\233/\271\234\221!\003\357\220\272E*Z\227Hy\320\316\0367Hy\311\242<\226(\255\320/\253\226k/\247\344\310U\266\262.$?\252\216\235\372\272\245\242j\255\211\257V\225J\315\036\303\366Jm\247\204\235\334\256\005R\337%I\216\234\334!\373\243\276>t\3408\2712\326G}[\2448\216X\253\255\202\263Y+\265I\252/WfLr{\264m\217\237\355d\022\213Y\224\275\244\236\234\214{\344\361C@\313\365?=\350\357\240o\356xL\307\216`S\274\320\346\370\336H\034\357\r\323\306~\242\\o\215Jcgp\355n\355={\334\225\261\027\321}\210\276\020\335\201\350\037\241;\001\364\215\320}\b}"
+	.string	"\350\366\320}\207\356&\372\025}c\370`\354u\217\357\213\335\267\307\344\256\213\372N\315\311\211\363\306\315f\026\353's\234\030\270\337\366\262Y\277\026\262\341\217L\037\312\370MK\317@\t\370F\303\017J\177\307\370\274\2457\367\352mA4P\217\247\013\200\337\250!d\211\220\231!\021\021Q\220$IZ\003\260\242\033\"\325\001\021\220\352\205\3663\020X\221]nd6\340\371\234=\265!\252\323*\274"
+	.string	"sa\013)]\203;*\257\276\253\3123;\335\276\360ot-NT$+\300\365\210\354\325\fy\371\035\233&M\231\37492\3733FL(r\241\261z&\024*\224,a\321}"
+	.string	"\002/\267\342\322\260o\214\312\234c\024\250f\363%\207,\332\245u\220\350\234\262b\213yS\265Y\367\223\007\251\310[>\351\360\213&\336\335}#\032I\347\221\017A\325W`#\324\320;\326l\244\317\3304\026\237\177\022\365!~-\007\020;\372\231G\221\242"
+	.string	"\204\024VW\022\341l\350.\322\223\177\307\256\202~M\231G\202EK\216\341\343\370a\274\257\335P\272{\243\273\324p\222&s\356\341\362\253\367\375\372~\20231d\031\220\277\274\377\217\307\304\227?E\276\203\357z\354\331\301g\017\242v\034\336\032\351\265:$\3048\257a\343D0\241\030\244d\202}\353\221\025\344\254\267\226\r\267H\317\302#\206\342\"\233\\\225\362\254\300+\276\210q\034<R\b\217Ws1v\334\254"
+	.string	"I?\204\214^\315\026(B\310\332\003f\211P\b6\264|\252d\373\207y\240*\221I`\213#\024"
+	.ascii	"\262B\234\207\n"
+	.text
+	.section	.gnu.lto_.decls.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"(\265/\375\240\224\016\001"
+	.string	"\2554\004^\217\306+\027T\020(e%5\006\373\321\024@\362\360\034\310\2015\324\246\212}\026@\22496\323\301\032\237\300\240&\267\030\247(\255\375v\003|2D\004\023 \357 \373\032B\001\334R\224H\302\240\325("
+	.ascii	"\004\031>_$H\220@\230\363qOK/\255\264M\356\275\345\2262\005\351"
+	.ascii	"\023A\027D\030*\\\216\222\365:\030%\275\357\023\bI\244p\225M"
+	.ascii	"\323\250p\352\273\004\013N\245R\205,\351\241E\305\242\276\251"
+	.ascii	"WT)*\0255N\265\242NQ\253\250YpT\205S\253\236\225d/\276\\E\205"
+	.ascii	">\333&K\210HU8\225H\355\301\225A\327\031\256\262)\027\270\034"
+	.ascii	"\315m\352Y\323f3\322\312{?N\003\227\337d.<'\365\022\235\311 "
+	.ascii	"\311\026W\331\364}\241*\327\022\230=\035\035%\370$\273J\312\372"
+	.ascii	"\277\275}\021T\252\023&LR$j\331\bHM\277\032_\244T6uM}\242B\301"
+	.ascii	"Q\265MU;N\223\301\344\332\324h\266R\241\317\326\t\020\035rj\233"
+	.ascii	"\252\245v\001\277\344\350@\247\203\016\332)$)<\200\372?\273\375"
+	.ascii	"\237\225\315Dm\222F,\032\263\202\004\215I\232v\203\244\210\314"
+	.ascii	"\222\253i\032\315\314\022\253\254U4\025Loj\304*k\365l_\351\b"
+	.ascii	"\223f\255B\263U\233\21712\263\377?\025ml\215\231Y\266\332\242"
+	.string	"d\224\365\230J&V\304\253C\n\313\372?#c\252\330\025#7\254d\255\212\3450`\274@\263V\225\250`\377\177X\315\323\351\251\202\251_k\322\314Dy@_ U8\246x\251L\034\022\340\306hF\326j\022\340\235\231\270\267\254\277\346\267\372`C&J\326\377\375\330R\271\236\354\226\230!}Y\377\027\265\365\324\321\034X>\276\346\352s\245Crd-\353\377j\354\3577ET#Dv\326\227)*b\212\020\251S{\305d\255\0229\036kGT%\257\213\032\344\307^\224\024\255\254\277\333\366qT\005\242\376x\202DF[\326\352\217?D\b\231K\370v\020\346i\341\002\225\365\327\250W\377\177D0eQ\246d\375\253WV\304%\272\367\312J\255\372\261\021\363F,\353\357%\373{l\363\340\200\335\210\362hd\375\375\334\352\016\265H\255\021D\355\371\276\257\016u\nG\325\035*\323\016\265I\225\202\322&\365"
+	.ascii	")/\n\253U)\365I\275"
+	.string	"\201\347\324HPY\223\2528\324\0348\252J\251Q!BP\245T\247l\205\347\244\024\340\306&%ju\211\221\261\372\373\307\326^GN\266d\255B\2516\336\341\020\217\007\034\222\254\277u\354o\033\373\233\306\376\216\261\337\352\251J\352\022\216\2525T\032H\352\214\016FI(h\021\223\2525T#\025F\353D\332\367\264\247\020\2412\204\325o\341\366\257\316Pe\310\210\322\025&k5\txCj\216J\326o\243[\215q\\c\013F\\\326o\241\3738\3722\352\321\361t\021-QdY\277\025\333o\221\354\267\317\375\326\310~\013d\277\355\261\337:\355\2671\366\325\360\0066\347q(\376\020R\364%\353\263m\266[\266\242B\237%\214jH\331d7\271\r\216\346\351\247\371J&3\002R\023\013FK\322i^s-\035\214\222\336\"\253\017\266\246l\2448t\320\201n\202\205\205j\353\263c\373\370\314\013\007<\207\345"
+	.ascii	".\266\2661`R,G&c\311u\035\214\222R\270\322&\005s8\342\357}\257"
+	.ascii	"\324\304\204I\303p\200\347\324H\270\215I\337\027J&\333\035\356"
+	.ascii	"\350\310\227T\216L\376\302\201X\004}\233\330!Xh\270\246h\262"
+	.ascii	"\232\\&\237\311f\2624\247\311x8\232\311\344\273\353@\327&L\246"
+	.ascii	"z9\372k\233\375U\272\277\212\331_\347\366W+\373\253\333\376\252"
+	.ascii	"\266\277\226\321\351d\"3tLY\177\315\332\377\263\\\236\303\321"
+	.ascii	"\334%\307\351@\337\267-K\336B$2\276\357\2172\317\367\205\202"
+	.ascii	"\350\222\271\344-xN\n\372>\345\224\021\023\246\312\364}\241:"
+	.ascii	"\035t\240B\271S\303\204\325\327d\366\237\267h\t\362\221\361\340"
+	.ascii	"\313\372?\216f-9\016\372\352\020\313\264\224~d}Me_?\331\327M"
+	.ascii	"\366\265\331\376\363\333\263\225??\311Pr\2255*#.F\326\231J\206"
+	.ascii	"{\256\222\247\274\271\n\bU\357[\224\253\024\367\336\267\250\210"
+	.ascii	"1\006\030c\240\303|h\255\261\372:lg) \236\337``)=e\275\001\316"
+	.ascii	"\300^w\355\353#;C\361\006\226\003\234\201]\313l\270\216M\236"
+	.ascii	"\214\254\257\251\326t\324v\242S\264\301\303IR\326\327D\373\""
+	.ascii	"\304r\231z\326\264\327\200\360\3759-7\301\321\314$\233\2511\311"
+	.ascii	"\320\274\204x\004}\235\210@\372zp\231\276/\264\003\235\016\206"
+	.ascii	"kS\275(V\237e\264\"\215\254\030E\226\234}\355\253>2Y~bBDF\326"
+	.ascii	"Wq\344\261k\264\252\241Z\024\265%J\326W\233\366\363\233\235_"
+	.ascii	"\274\201}v\2637\024o`q\022\316\300>\177\331\370\305\031\330\314"
+	.ascii	"\225\363V\356z\346\312\317\207\b\341\302\243\314\245\337\267"
+	.ascii	"\bc\f\210\030c\260\302e\025-a\365\263\334~f\262qS\3162\202\341"
+	.ascii	"\200\220\321\200\022\363\352\230\332\024\331\340h\n\333\030\221"
+	.ascii	"!\252\327W\227/Y\310\363\220\037\323e,\342\0170puY\217\2007\260"
+	.ascii	"\030\n\342YH&\013\222D$\b\007/)TA\200\374`cP\245\311e\235\177"
+	.ascii	"<J\3362\326\274\311\363q5\034\213\202\007\305x\231G\266r\201"
+	.ascii	"\251\225\243I\326\271G\246\302\321\nr\325C\204p\225\b\355\035"
+	.ascii	"{_hq\310\007\306\247\227\3653\331>\256\200\305}\270\002V'OUP"
+	.ascii	"\204F-\375\330\241c\313\251\201J\321\321[\260TY\313\221\245\332"
+	.ascii	"\262\245\034IYg"
+	.string	"\251G\311rgzLq`,Y\253\206\326\232\254\377\034u\003\210\2454c-\353\f\005=z\337WgH\345\b\264F\326\317C\3661\332\217\315\230d\221\276/\324\f\016cY;;\203\247\020\213\300\306~\234F\r\226\262i\201pS\204K\226\201\273`/Gwcd0\232\023\212|IA<\313\300y\230\217x\204\363\036\025\031\362|_\350q\331\226\2626\374\004Oy\362g\243l#\317\310O\371(\323\3105r\214\f#;\345\245\334\224\2232Rf\312J8\232e\340\276\3477\023]C\337\367\210M\326\263\355\307_\262\f,\006\337\021\213\304D\374X.\313\300S\334\206x\204\363\276E\214<\337\367%\223e\3402X\252B\335~1\212\204I\337\367=\316\362\343\270g\031X\013fS\241n;\006\233\231\364}\241fYF.\302ST\250\333\373\372\200\023\301K[\024\275\351\373\276\035\350t\020\314a6V\005"
+	.ascii	"\372X\315\336Ux\003\213\217\3466\326\303{8\312\001~\003-\376"
+	.ascii	"\300\244\341\241\226\365\261\225}\314\001[\344\200=~\333\307"
+	.ascii	"j\373\270l\267\371\361\032\\\206\261d\241\333\036RT\326\307H"
+	.ascii	"\266\220\310\366p\265\217\245\366\217\315\034K\325\2106\230|"
+	.ascii	"\351\310\032\343\20186\243\200\"?\302\262V\237\366\007v`p\230"
+	.ascii	"#uK\323\035\214\254\361\030\020\307vk\2168\253\"Y\007\2256\206"
+	.ascii	"\342\r\254\016\316\300\036Zw\354\345\307rx\256\355}_\t\212k\210"
+	.ascii	"\324\300d\215\351@\034\327Y\360\004NJ\326-\316\300\036#m\374"
+	.ascii	"\342\r,N\006\366\035\330\007\332\237\333\300\342*\330\n\216\036"
+	.ascii	"\016_9\246\202\333\376;\202\276iC\254\020\r\311\372=\333\305"
+	.ascii	"\373\276/>\034\333\366\365\365"
+	.string	"\365\341\303\261\307\300\3268\003\373c(\307S~\f\305g\370\rW\275\357\321\373\276\022\264OT\316\336\262\306Q\260\033\216r\300R\336\"F\203e\344\224\365Ul\020\274/\346\300\342\276>\314\201\305K@\034C\311\3006IA_\265\367}\213\252[\025\244\275\254\257\302\366\2007\260\270\tv\202\243\033\340\265\343%8\355k\021\364\205\276/\264\230\213\274\211.\311\372$\266p\347X\355\031\320\336\020\336\356\343\rX\265\257\017o\300>o\034\274\201\3158\003{7\274\201\375"
+	.string	"o`Y\234\201\275\024g`?\2077\260?&\373\261\030\036\343@MR\252z\325\336\027j\034\272\001c\364\225\365\241x\003\273q\0066\330\341\373'\036\340o\204\327\360\0239\374m\232\206\362\353\253\254\315\341\337\023\374\277\023\2776\362\353\"C~\335\366k-\255\344\327l\277\376\322Q\364\333\ng\332\374\017~\342:\325\360c\341\377\251\360\377 \360\377LX3\274\3731\b\226\316\304/\001\355\206\002\254\021`\3616\261\270^\331V~\355\204\265\360S?\351&6\314\257\001\377\325\276\306\001O\320\356\375\377\030\240\272\331\370}\370-\340\377%\240\356\307\177\350\344g\345\342\206^\252\360\035\006\220\242\335\240\266\255\222\020\377J\201\177\213\370\177!\374\333"
+	.string	"\f\370w\003\376\037\bd6\360\363\340'\342\327T\277\256b\267$`\365I\276P\237 \370\327\020\260-~!\362N\273\301\377\003\261I\370}\360\253V\277\262I\354\022\033\205\037{\300eA\342\016\376k\211\337\216\004Z0\325MK]\375>\374\277\001\264\024"
+	.string	"\340\177\322O4\341\337\035~\265\006\023\016v\003?\017X\271_5\262\373U\027-\213\265\3603\027\177\035\2600v\026\366\260%\343\\\305o"
+	.string	"\377o\203\237\006\377/"
+	.string	"?\f\332\375\377\204\237hd\343\330-l\226\377\303\177\230\344\002\235\344o\333D`Ua\013\371:\005?q\370\263\340\327bx8\3776\376\277\n\276\201.\323\304\037Q\375\365\007\330\263\237E\373\177\035~\225\355W\013\360\253\030\374j"
+	.string	"~U"
+	.ascii	"\277J\200\377G\301\237\277\374\331\314\237\247\177\276\323-~"
+	.ascii	"\226\354g\313\376\337\004\277\006\372Y\260\037\207_\037\1776"
+	.ascii	"\311O\347\327)~\035\201\237\335\372Y\256\377'\301\257\256\371"
+	.ascii	"\325\275_m\363k\365\327\370\327\372W\371~\355\301\257\007\360"
+	.ascii	"\263Y?{\344\377E\360\347\032\177\226\221\245\376\034#\303\370"
+	.ascii	"\177\0332\323\237\221\376\237\206\\\225y\374\371\350\3177\376"
+	.ascii	"_\206\354\364\347\244?\333\310P\177\336\361\347\030\376\374\201"
+	.ascii	"?w@w\370\1779\332\202_S\360k\016\277\276\340\327\023"
+	.string	"\374:\202_\353\374Z\202_\003\177\326\307\317\370\253\323\237\245\372\341\374\252\bj\227_\235cw\374\354\324\377+f\264?\233\375\031\252^\371\325\270\237\225\372\177\304_\325\362\377\206\270\n\376\362\343-\355\225\277\305\362\377\330_\375\360\253 X\033?\013\365\377\3265o\357\247\3775\003V\211\235\361\377\324\277\245\362\377\362\277Z\360\303\177\303b\375\354\220\237%\362\377\276\373~u\315\003\233\224\255r\021\325\355\002\233\357\216E\"\363\017\207\377n\363k7^\377f\243~\375{\315\337\246\375-\223\177\253Q\223\374j\230\252\305\202\240\205\3564\177+\366\267c\177K\366o4\177\033\345o\335\376}\346_\241X\017\374[\372\253A~\365\352W\261\324![H\013\226?\370\277\001K\364\246\335\241>\257\202\205\301\204_h\346W\337_-\372\325\250_\235\372U'\265\206\032\203\312\244\343Wm\374*\216\037{`\203\376m\006s\270"
+	.string	"\360\004{\007\373\302\377\235_h\345W\215\376\265\204\215\027\303\317\372\374j\007X\026O\366\2062?\013cg\265\036\324\017\264\334\257\357Z\013\376M\346\205o\300N\325\374\030\304pL\207\037?)0@\004\233"
+	.string	"\273"
+	.ascii	"\377\276\373Ua\253\363\016\333\356o7\020=\020\376\370\3716\377"
+	.ascii	";LOi\361\337\006\211\022\374l\335\016\300\277\263\332\034\fb"
+	.ascii	"\203\261tC&\277*\334\036\222\374\330\203\252\265\221\374m\016"
+	.ascii	"Q\203\037k\341g\333fs\375\254\224\177m\300\336\332O\001\260p"
+	.ascii	"?\0061,\322zaa\374-\230\177g\265v\177{\367o#Z\006;\245\310\277"
+	.ascii	"\256\360o\"[H\033\346\177\207\267\377\034\376!\220\377k;\006"
+	.ascii	"\325Gu\376*\007\230\277\332\374\261\207\026\377\3374\340\327"
+	.ascii	"30\210\rV\374\267\340\0272\311\353\016\362\267{o\376\r\344\032"
+	.ascii	"){\300 X+Z"
+	.string	"j?\033\375\367\217\277\355\362\257\n\330>\376\226\356\337W\177\376\257\221\266\225\352\342\267\253\376|\001k\201M\365\0260\210\354A\303\370w\217\264\377\037\376\241\214?\233\370W0\035Hd\0232\b\031\001\231\001HW+\321eO\375\330\3037\320e\376w\300e\271\001{\307\332\007\360\007\273\376\265\013{\301J\265^\261'V \253\221\225\b\013b\335b\013\260v\261\007`9\254b\254\004\353\031\313\016`e\3339\326',\233#\370\363\004\177\326\3713\207?W\360g\t\376\334\341\317\027d\234\f\314l\306%\376 \223\fW\304H\377\266\214$\fF\3748\377\230\303\232uiK\275\001Y\335\202V\354p\343\370\261\206m\374\361\260\016\337=\331\361\377\312;\260\341\210\3327\376\r\365\343\t\214\001\300\036l\033\035\276\002\336\360\r\2770\305\217=\3402\366\277\335\030lw\235&\301%\315L\223\321\274\2310\033<\330Mf"
+	.string	"N\370\261\226\262\242]\347\314\b\307,\0048\022\354\340h"
+	.string	"\001\034L\267\322\330O\377uV1\030\204;i;\3758\202\025,\330\374Y\342\246\261g\374x\002\016\"\266\214\244\rX\020\376\177\3331\376\026\306\277\221~u\004\247\r\343\002\354\001\232\036\264p\025l\361\202.\237\277\225\321\316\370\367\021\316QU\005\374x\303=\374\302\016\374\253\227\321\203m\364\343\034}\367\265\035\303\366\300\006\301\277\213~\274\341\031\374\302\013\374\253\027\316\371Y\024\376\035\303\217\215\277\272\342gK\354\027\277\377o\252\003\330\022\266\213\037\253\177\253\264a\3701\360\377Z\313\364\267M\377n\301\001\036\300\005\3006@\030\202\026\266x\376\326F\013\365+\270\2105\250\356\003n\250 V\246=\2649\360\267-\376\026\206\177;w\363\307\032\004\360_\305f\376x\303%\370\205<E\314a\325\272\316\221\f\374J\013\021\254F\202\026\240\300"
+	.string	"\332\314\356\371\261\206\n\204\t\300e-\326\301\030\374\253\220\257\320\001H\020\002k\n9\376\326\306\337\n\371\267\320z\302jE\001d\365qe\302\277\227;\211#8\360\027\362h\217\264Z\377\3769\033\025\377\211\277p\310\337vm\237\315b\273\023\310\"\376g\203%\300:+\254T\301\006\374\277\362\rV\036\301\004\374-\007\376\226\371o\236\037s`3\374\315\004\307\371\205\r\370q\360\327vm\f{\005k"
+	.string	"\274\341\302_\370\302\277\216\331\310\377o\266\013*4\336\203\277p\375\331\2578\366\003\332\027\376\f\346_\333\354\343\237\301\376\255\201?\237\375;\003\377\232fc\340o\177\332\344\277/\360\347\016\344\020\374Y\351\317\357\237\233\376U\272B\231\335\302\337\006m\013\344\"\177\366\361g\253wX\355@\374A\270o\200\323\376D\f\376\365\306\256\300\257\2450\210\023+\370W\237\177S\340_#\330\023\370U\250\004n\374\201R\216\377\212\374\327\f\374\353\212\177\325\300\277\262"
+	.ascii	"\276\371W\027*\376\325\270r\340_\205\376"
+	.string	"\225\371\257\312\177m\376\353r\247\370\327\026\230\346_a\374\033\205f\263#\360\353\276\023;\205\315BF\300\237A\370s\002\376<\302\237E\374\371"
+	.ascii	"\177\016\341\317\n\370\263\b\177f@\005\177p\370\263\035\370\367"
+	.ascii	"\n[\205\235\302\206\300\277b\241\233\277\025\300\177\374\023"
+	.string	"Y\370\3310\277~\372u\323\257\235~}\343\377\372\017\245\374*\361W\207\277Z\374U\340\257\266\277*\374\325\375\253\301\2775\300\377\337O\344\300\337N\340o-\360\267\025\370[\t\374m\212\277\245\300\337^\340_\371\366\003Z\024\177{\342oG\370\267\211\377\305\237\b\366\263.`\255\277U\362\343\347s\256\202m\341\277\360\027&\3717\n\377.\361o\022\377.\341\337\r\370w\002\376}\200\177\033\340\337!\374[\304\277w\376]\200\177\007\340\337\030\374\273\303\277'\370w\004\3776\376\233\370o\341\277\367\337\276\371\333\351\337\336\375-\230\277\365\362\267t\177\213\345o\341\376\326\355o\231\374\355\331\337\222\375\255\222\277E\362\267Z\177+\344o\201\374-\324\3376\375\355\322\337\316\370[\030\177\333\201\277\205\341o\231\177\253\374\333\027\3766\371\267\356\337\362\374-\362o5\360\267\030\370\333\021\376\326\203\277\035\300\337n\360\267\031\374-"
+	.ascii	"\376\026\377\255\207\277\265\340g\325\374-\005\177\273\341o;"
+	.ascii	"\374m\360ou\3766\202\237\245\373\333\234\277\305\371[\342\337"
+	.ascii	"\n\377v\377-\373\267\372o\363\317N\177v\315\317\236\371Y\274"
+	.ascii	"\237%\363\263v?+\346g\353~6\313\317\312\375\354\226\237\215\373"
+	.ascii	"Y+?\013\367\263S~\366\355g\331~6\372\263i?\213\366\263e?\033"
+	.ascii	"\366\263J~\226\353g\217\374,\221\237\375\361\263U?;\365\263R"
+	.ascii	"?\013\365\263M?[\343g\225~v\306\317&\375,\322\317\032\375,\321"
+	.ascii	"\317\202\340g=\360\263/~\026\206\237\r\372\331\027~\326\347g"
+	.ascii	"Y\374l\317\317\256\370Y\027~V\003?\213\201\237m\341g'\360\263"
+	.ascii	"*~\026\305\317\236\370\331\025~6\205\237}\300\317\242\360\263"
+	.string	"'\374\354\210\237m\300\317.\340g\023\360\263\007\370Y\003\374l\b?+\342gA\374\354\316\317\026\340g=\370\331\001\374\354\006?\253\301\317\006\340g1\370\331\013~\266\202\237\245\340g9\374\254\004?\273\341g3\374\254\361g\213?\273\177\226\375Y\375\263\371g\377\257|\377\272\367\257y\377:\375W5\377*\375W\274\177\265\373W0\377\352\345_\351\3765\356_\261\374+\334\277N\371\327\267\177u\373W(\377\372\344_\331\3765\372\257N\376\265\311\277\246\375+\332\277\236\375\253\331\277\222\375\253\330\277\202\375\253\327\277&\371\327\256\177\335\372W\255\177=\362\257F\376\225\310\277b\375\253\220\177\005\362\257>\376\365\352_\253\376\225\352_y\374x\314\277\346\370W\034\377z\343\327o?\006\361\257P\277\032\366\253U\277*\344_m\374k\t\277\032\303\257e\374\253\323\2772\375j\316\277.\375\257\373o\346_i\374\227\362\343"
+	.ascii	"\374\230\303\377\025~,\301\377+?\326\360\2572\376\025\306\277"
+	.ascii	"\306\370W\244\177\375\300\277\206\340_A\360\257\034\370U\255"
+	.ascii	"\177\205\341_]\374k\f\377\372\342_}\3765\371\257?\377J\201\177"
+	.ascii	"U\361\257\021\370\327\025\376\265\304\277\216\370\327\006\374"
+	.ascii	"\353\002\3765\203\177\r\300\277b\360\257\026\374k\005\377\332"
+	.ascii	"\341_)\370W\t\3765\202\177\325\360\257\031\376\325\370\257\304"
+	.ascii	"\177\005\376k\373\257\353\257B\177\275\346_\361\257\373~\255"
+	.ascii	"\367k7\277\236\376\330\303\257\331\374\177\363\177\355\327h\376"
+	.ascii	"+\177,\201_\233\371\257\342\327x?\366\340\327w\277\266\373\365"
+	.ascii	"\230_\213\3715\335\257\273\374\272\312\257\341~M\345\327S~\235"
+	.ascii	"\343\327Q\277\246\361\353\031\277\216\361k\244_\277\277\016\301"
+	.ascii	"\257A\360\353\027\277\026\3725\317\257'\360\353\235_\003\340"
+	.ascii	"\327\301_\263\277Z\367\253Z~U\312\257B\371\325\261_\025\373\325"
+	.ascii	"\347\257\036\371U\"\277:\344W}\374*\217_=\372\325\016\374\252"
+	.ascii	"\213_\205\341W\177~\325\347WY\374j\317\257"
+	.string	"\216\370\325\005\374\352\001~5\304\257f\370U\343\257\342\374\231\357\317L\376\234\366\347\037\177\266\372\363\325\237#\360\347\007\374\371\204?\227\370\263\t\177n\300\217\313\376\354\341\307\323\037\337\375\330\356\307a~\f\346\307\004\370q\007?\036\300\2175\370q\006?\006\300\217)\370\361\004\377S\374X\347\277\n?\216\340\307\033\376\217\3758\306\377\270\377\032\350\353\353\353\373;H\373A0\371\267\364\002@)Q\240\024\314\207\233\366ZV\r\351\333\344\346\301C\030\333\307\230\217\265\300\330\316\201jj@(\372\b\355}\nf\311x\342\3224\372\326\334d\r|\302j\241\342k\223\365C\320\332\377\201l8\nl{\0330\n\\#\036A\337'\026\252\206]\226a\020..J\032\270\306\227\227\202\204I\312\372!4\355\203\240\007l\362\253\322\261\244(\353\203\220\006\310\344\0026v\016<;\216\002\317\200K\200M+\224\201\"}\233\232<"
+	.string	"\242\025\323\310\340\306\262>\bs\373 \300\355\013P\355\034h\026\005\232\375f\350@\337\247\342R\024\020\242\373\002jv\016\fr\034\005\006\001\222\241"
+	.string	"}\211r\226\306<qM\337\246&\017\306tL\261\263\313\372 lm \230~:\034\236S#\301EF\n\0064\002\374\302sj:\257L\030P\fG\201`\300\"\007\n\001b\351\004\343r\220\205\261\300\257\0378\004H\004\350\225\253dl\331\342\222\265\2222/\267\273\254\017B\216}<\006\354\002f\001\217\34095=&\007\354\002j\261zxN\r\2050.R \0270\t\020\t\216\002\273\200O`\027p\353"
+	.string	"n5\314\334T#L\220\236[_\204\227}\021m\373\"\226"
+	.string	"\217\360\345*&\257\224i\326\027\201d_\304\221}\021Q\373j/\336\300\376^\234\201\275Z\025\336\300\376\216p\006\366\"^\375\244Z#E&k\017Pv\016\364q\034\005\372"
+	.string	"Zm\243\243\267H\213E#\345Ak%Ef&\353\207 \263\177\340\025\320\352\313\322\332\223\254\201U1\326j\004\311\372!\266l \325\207S\\?\200d\r\354\341\302\233,\032r@\036\302/P\320`\3458p\352\007\352"
+	.string	"\356\310U\\ \002\005\245M\326\370\013o`%\300\031X\340\022\210\003s\f\261\214(\211\2225P\352\377\251\301h}Zj\224\242\016\304Q\305\205\037\025\324\016\272\254\177} \016\214\342sCC\rx\343l\322\321\025\022\033\007B\375\27778\213\322\016)3Y\003\235@\034h#k\251\305\3055\035\370\364\003\235\264\217\030\372\336\264\311z\2103\260x\r\210\003\233\202\\\252H\315\224\016d\372\201K\300\032\3013\271=\260\254\361\023o`#\300\031\330\326\t\210\003\225\212<\216\020I\3158\220\306s\225\254%\"kY\003e\2008pF\0241\271\037Ys"
+	.string	"\30680\211\n\rM*\353\266\f\304\2011\210N`L\326\214\016D\372\201G@\030\370\306{\205\2245\226\302\033\330\f8\003\313\346"
+	.string	"q\240\321/\232\027\304\n\220\350\300\242_\257\311{Dn\330\220\313\032\213\2018\220\250X\027e\315\021\276\003\337\377\327\247\303\304a\251\323\313\272\370\006\304\177|}}S\206dM\324\373o\357\271\212\013P\2660\t\2225\246\002\342?\275\037l\230\270~yU\\"
+	.ascii	"\322\303\216*\353\337TX\024\005\245K\326\017Ae\377\2776l\316"
+	.ascii	"\230l Y\363\037\233\037\217\321Ar\025"
+	.ascii	"\027\336\367(\204\322\020!Y\377\324\200\370oM\222^X\326@\234"
+	.ascii	"\201}\003\225\352\201\346w\006\030ed"
+	.string	"\364f\375\020L\366[\024\332\255\311\255i\022\267\025\005\357W\006I\324\024\233\254\037\"kC\203n=\242PYC5Hy\325\260\373Q\021\317\340\200\361\033\363\023\243\345v\366\373\362\237\230\377\007\346\027&W\021\202c\307\222\254\327)\336\300^\316\013\210\377\276\354\2663\267\034Y\237K\364Wg\202\222\035wt\\\216D\274\216\262\276\210\270\2616,W~r\277\271\337\226_\027\034\375q\371i\311i\\~Y0[\0176OIol\312693F\007P?\304\324~\210\245}\020o\366A\244\331\007!\267\377\237\025\355\024\244\242\033\303R\345\227$[u\251\333\203\373\221Ai9\201Ae\212\331\335\f+Y\277\001\313\344\bC%\353\203X\203\362\213\362{\362k\373\271\341\350O\312\017*\345\027\3663S\317\232v\224/Z;~>\324\263\246\237\r\030ag?6\365\254)\305\0271\351O\312\357\307\357\251\2365M"
+	.string	"\b\230\224\337\326\017L=k\372=\001\371\222\276\357\313A\277B\222\320\t\365\332\nDj\311[\326\007\201\265\217\333\232\374\3200\026\"\317_\223\337\222/C\232\374\230\340\267\0160\336\267\212\007\260\312\022\036\227\351\317\311/\372S\303\321_\223_\032\373\205\267\245\265\365A\364\330\377`o\377\0034\373\037|\331\377\200\312\376\007feE \317/\246\254\377\001\2201\034\375\221\375\304\310p^\336\263\365\301\304\351\211\326\377\200\306\376\007E\373\353Gd\027g\226\365w\300\354\213\340\362\301\227\344\207\244\345S\362\363\302\321_\222_\027\313\003L\2260\254\376\216\226\375\035\350\376N\330\376\216\326\326b\317\320i%\311\372;4\366q\033\020\214\005\310R\221\337\220G\351 \343}\257\354"
+	.string	"N-\341q\231\212\020\222\255x"
+	.string	"\243\262~G~D~Fp\364W\344\207U\344\027$s\251\320g\333\004\210\222\364}\241wf\242\f\001\352\177x\263\377\001\313\376\207&\373\037\306\366?t\355\177\250\332WbK\244\250\262\376\007\242}\021S\230\017\210\216\037\325\257\007\346\353 \343}\257z"
+	.string	"\225,\341q\231\376\252~V8\372\243\372\361\320\031\276\221N\237X\375\002\260\355\027\300\310~\001\250\366\013\340\264\377\237\216_\216!\024\242\036N\277\034?\251\037\026*0\034Y\277"
+	.string	"F\373\377\341\370EA\257\332\306\262\276\001M\373\352Q$,\353\023 \314\376\377\263\361s\372=\341\350\017\352\307\224\326\224\255\224\244?\250_\r\031\322\037\324o\t\b\215'\256\016\326<5}R\266>\001\266\354\023\340l\237"
+	.string	"a\373\004\340\332\377OI\307Xk\033\322\204\306o\006\364J][\326?\031\353\223\023\225+Y\237"
+	.ascii	"=\366\377K\312U\222\240F|\244\325\206\026\343\207\324Z]\2011"
+	.ascii	"\303\350?\244\377w\364\203\201\261\344\252\265\213\227)Y\013"
+	.ascii	"_\234\201\375\025\201\370\317\210\003?\252\206d\275\363#*"
+	.string	"\362R\364\024&\353\377\367^\323\360\321\204CI\326\377\356{\363C\212\022.Y_\304\233\255\207\371\234F\340\262D\3674\345\303\321\375f\357\351\f}T\311X\323\372\036\234\331\367\240K\036\2330\2720\256\254\037B\032(O4Q\236\233\315V\243CIo\272\335\35468\272\331\3545A/\035\\D[\337\203\267}\017\306\366=\030\262\357\001\2163d\246\020=\001\222\365E\220\331c\360[\3343\357\201Y\263\310\221\331_v\033\236\303\322l\304H\311\3540\\\360\266\231]f\337m)\216n2\333n\223\331br[\220\306\0241-\32371<\354\204\372\036\304\330\357\240\315~\007e\366;\230\333\357`\312~\007^\352\210Y9\236\262\310m.\273\313\246\333s8\272\353\366\226\034\307\226\226\245MZ\267\265\254I\317\256`\266\266]\267\261L\261{N\211k\304\252\362\204\372\035\200\355wPd\277\203\034\373\035\314\330\037"
+	.string	"\337\376"
+	.string	"\320\354\177[\331pVTm4\262\226\333\332e*\324mC\361\261TeO\331T\266\224\375\206\243\033n\273m\270\375\204\006\3346\333m*\324m\205:%\351\206\333QdH\3416\224\334\206\347\324\336\242\247\017\266\254\224HM\205`\3340\215\021\352\017@\313\376"
+	.string	"\244\354\017\300\311\376"
+	.ascii	"\3026\033{\344K\036\\\326\037\300\217]f;\301sX\232\017\212tm"
+	.ascii	"\253\341\350\216n\350\216\022\327\367-z\362\fR\375p\222\301\352"
+	.ascii	"&G\352\024\213\033[\326\037\300\214%jO\274h\332f\262\321pt/\331"
+	.ascii	"g{\211*\305o \360-\t\371Z\331H\335\234\331\372\034\270\355s\020"
+	.ascii	"\266\317\001\027\031\007a\034\230\2657\353s\320c\213\3550\034"
+	.ascii	"\335c\273\253\314"
+	.string	"\006\303sX$\362\366\244{L]\263\271\210\353\373^\351=\337\367\345\320A\007@4Dt\260\372KHU\022\252\254\317\001\222\231\347\366\332Ipt+\331H\266\2226\253\213\022)\325M\332\026)\253\277\001\232\375\r\270\354\315\3654\033scrd\375\r\330\366\277\237[+\310D\254\310\227}dg\355\"\333\310&\202\243[k\017ykd\245r\374#su0z\337\0369X-JzcS YB\212\0041\262\2656\026\025%\275\261\257\367\205\352\254)\tc%\324\337`\307\376\006O\373\033\300\330\027@\232}\001p\331\027@\324\307\276\212\006\351S\222\265\225\236*\363\224f}\001$\331\317<\234\310v\217\035\265&\245\332;\366\324\346\261u\354\252\235c\343\330R8\272{\354\033\273\307f\312WD\365}\213\314\2365\324\236K\321gS\331\363iL\004T\330\356\261m\264PB\343\326A+\006.\252\246A_"
+	.string	"D\373\032\224\331\327\340\313\276\006Y\3665x\333\327`m_\203\263}\r\304\3665\330\332\327 \310\376\267\322\236\021\266\343mF\326{\306NZ@\221\326\030\r\034\3353\266\214\207\ba\254\210fJ\215\r\255\257\201\216}\r\222\366\277c\344\335`\372\202\226\3653\326\227%aO_R\033aOS16\302\236\246miz<\307\314\370\b{\372\"\223\255\246\204=M\333\274V\r\017)\2103!\030\205=}\225\335\205\t\223\226\311\\F\300d+\003t\205=}m\244V\257}\263\217Z6\355\264\345\333D\355^\333f\027m\030m_\353f\033\355\027G\333\274v\315J\005MW\232\260\247)\b\273$i\302\236\246m^\213\227\271\272\302\236\246m^;\306\313(\354\t\270\325\243\n\r"
+	.string	"\3643\320\333\317@\272\237A\224\375\f\314\3663P\262\237\201\217\375\f\236\3663(\332\017@\232\375"
+	.string	"\204\331\017@\225\375"
+	.string	"\234\355\007"
+	.string	"k?"
+	.string	"6\366\001\220\267\017\2001\373"
+	.string	"\300\262\377\326K[\007|\276Q\346Z\272\266\013\216\266u\355\\\032\027\374\266\364\254k\345\360\233\224R\027\233\257\367}u:\350\340\002qd\334\260\372"
+	.string	"\270\332\007\300\324>"
+	.ascii	"n\354\277\335\322j\2011\206FL\326q?\032Qzo\262>\006{\373!L\241"
+	.ascii	"\"\325Zi\263\264Xp\264\275\322\302\265W\332*\331\n\211\322\221"
+	.ascii	"\275/\240\264#V[\037\203\350>\006\317}\f\202\354c \265\377\366"
+	.ascii	"\255\225r\265F\357)\353VJ\353F\314\221\246\343H\326\307 i\377"
+	.ascii	"m\224(\235\r\272*Y_\004\0234\035\317%9\236!D\3334)i\033\325Z"
+	.ascii	"\355Y\007\243\367-\322\301\216)\tq\233\256\265O\332\266\226\255"
+	.ascii	"\205\202\243m\264"
+	.ascii	"m\362\326I\253\246R\251A\243\211Pc,\274\201\335\2003\260\367"
+	.ascii	"\320e\337\203\224}\017f\373\036\220\354{\370\261\377\026\332"
+	.ascii	"\226\265f\271\312\234\022%`\262\306r \336B\201P\244bLY\343$\274"
+	.ascii	"\2015\222\351\f\357\366\266pi\307Z\261.>#\264\254\303\332\360"
+	.ascii	"\224\212J\214\254\357a\006\f-\322\367}[\257\266\253M\"\367\325"
+	.ascii	"\202\265Jp\264\365j\271Z/\255\245\267\200dy\342\332e\304\214"
+	.ascii	"bl\375\267H\336&\371C\204\220\255\\x\3371\270\027M\\\326 @\274"
+	.ascii	"E\202\315\364\316\254d}\017H\373\027\220\331\177\273\325>g\220"
+	.ascii	"\251\211\002\02521\025\251\322j\217\374\274\240\304\310e\275"
+	.ascii	"=\242\267\204\303\030O\212\216\262n\215\200x\233%\306I\312\215"
+	.ascii	"\254\327\266\210\336\022\363\344\241%\353\277%\322b\265dX\252"
+	.ascii	"\230\001i\255\360\234\232\te\206\264CZ!8\332b\035\253\r\202\371"
+	.ascii	"\236\344\220\336\025\321\362\305\352_0\267\177\001\227\375\267"
+	.ascii	"?Z+/9\206\330\310\272\352pYTR\253\226\n\363\001\237`\265W\255"
+	.ascii	"\017\034m\255\3228\004\271\240\205MY\375\013\246\354_\020\355"
+	.ascii	"1u\226\204d-\353\343\264$0\035-\216\226G\233\243\335\321J\341"
+	.ascii	"h;\325F\265S\355\214\026J=kz@\235\226\024I\354)\343K\332N\265"
+	.ascii	"7\216H\337\027\332N\2651\302\236C\250\2220m\210\372\027x\355"
+	.ascii	"_\360\3346x\270\332,\311\372\027\\\355\326\251\255AD"
+	.string	"\372\3242\265M8\332:\265KZ\tc\361\201\365l\235Z\032!\330\310\013\373\002fQQ\205\331\372\027\310\330\267@o\337\2026\373\026\244\331\267\300\314\276\005t\373\026T\331\267 \272oA\332\376[\030^_\256xe}\021}\254\036\233\334\263-b\337\214i\215Z\242\366\bG\333\242\366m\213X>VO=k\372\305(\"F\312\332(\003cd\353[\260\265o\001\326\276\005=\366-\260\261\177v\217\325\2331\003/\357\254\236\232V\024\034^\326!@\234\315c\277\250X\271q\363\314%V\305\207\032;e\331\364I}\230e}\021lX<\314Gt\202\276N-\033\336\023\327t\r\213\206M\303\252a\333\340(\313\2065\303\236IR\263\313k+sg\206\314\364\211k\312\262a\357\334<q\025wT\321\302\022\352\237\225\376?\340\22669\236Y\337\002\245\375\n\246\373\025\210\331\257`\313~\005Q\366+(\333\257"
+	.ascii	"k\377\354\030\325lM\313\242\206K\233\314dF\021\0166\f\013\006"
+	.ascii	"\267\331\305x\262`0\226\250'3\314\276\274\313o\256\r\233\024"
+	.ascii	"\333%\177\261r\035\214\222t\231\026\f\207\261ly\222\351\3022"
+	.ascii	"\301X\332\"uv\317)\035[\307z\301Q\266\013;\247\203\227\360\311"
+	.ascii	"P\262\365+ \332\\\272\312\252\250\262~\2076[nMLj\205\315\302"
+	.ascii	"^a\267\260UX,l\034\216\262ZX(:O\276\244M\310\244Z\3306\007\214"
+	.ascii	"\201\311EY\265\016FI(T\031\223Fa\341:\030%\241\240\246L\312j"
+	.ascii	"a\331X\2650>\300\204M\337\027J$\033\033b\005G\263T\27441a\223"
+	.ascii	"\365;|\355\343(;\205}s\022\247\243(k\366\215\r\322\336Z\326\254"
+	.ascii	"\233*\367&HQ\207#\373\035~\354w\330\261\337\341i\277\203\214"
+	.ascii	"\375\016E\373\024\270a\235<\271\331\361%\353Sp\267O\201\227}"
+	.ascii	"\n\250\354\237M"
+	.string	"c\321\324D\211\203\312\372\270\f\2155{\024<\247\206\237J\236,a\317p\224Ec\241,\032~2d\211\230\0266IF\022-V\237\202\347>\005S\373g\313X2a\\\022\247-1v\fc\311\305\251(j\244\262\306sx\003\333\201\r\373\n\306\335\335m}\261H\262\224z\326T\242n\206\224\005c\275p\224\375b\225h\366\213M\202\371@\330\b{\372R\223\272,\331b\365'\310\333\237\340n\177\002\272\256g\215\327\314\\\326\307m8\310\2367\314\266X-\226\213=\302f\341(\373d\211\234-\302\032y>\213*\223c\237\254\324\030\373\314_\354\020<\207\365\276O#xm\275\303<\271/kB\215\335\360\006v\002\234\201\375\004T6\326~S\353a$\353O\260d\037\267\355 \342\203\025\302\002a\177\260W8\312\006a\251\316\346`u<\363\230\032\302\006ayd\253/X \330 l\025k\245B\237'"
+	.ascii	")\"e\203\260=0\033\236\303z\213\210F\230\222\246\013j\372\276"
+	.ascii	"P\342\223\tMT\310Z\255Y\202zpGgY\177\202\035\373\023\314\330"
+	.ascii	"\347\360f\237\003\231}\016Y\3669\260m\334\2047\26098\003{\016"
+	.ascii	"H\3669`\355s\230\332\347\340\264\177\026\212\265Q\2642\304F\027"
+	.ascii	"kc\207P\b\323\026\265\247\274\243\255\241$$\214ubg\330)\3018"
+	.ascii	"\222\365W*Eb\236\257\335\031K4\346\251>mA\212{\032\311=Y&\266"
+	.ascii	"\006\333\304\322`\223\330%V\006\253\204\243\354\f6\006\016\001"
+	.ascii	"\006\bv\006{T'\344\355WE\212\213M\216\276\316"
+	.string	"\334\276\216\225}\235\266}\235\262}\235\256}\035!\373:T\373:O\373_\373\302 \215\311ZN\212\322\263l\272n\301|\352Y\323v\262Dom\307sn\372\324\262\367l\313\361\264[\325\254\322uoE\263\272Y\323\254d\3261+\233\225om\263~Y\303\254kV\274\325\314*f\315[\337\254e\3263\253\336\nf\275\303\321u\272z\311Xo@h\310\271-\311U\001\222t\246\326C*\367D\352\231\206M\307S\316\2154:%\275\262f\341{b9+}O.uyP\230\236\357\013]\247+\335Z\247B\237\277\030>\360\244N`P=\327\351\032\205I\r)\226\213[\263\274Y\251\300}\221\361\354b\346)\267N\327)R\256\372\366\326\270\2701^@\320\227 \315^\353\324\272\372j\240\311\372\022\224\331\227 n_\202\266}\t\316\366%\330\332\227@\310\276\004L\373\021\340\355\025\213\216\332\002\344H\326\217"
+	.string	"\314~\004O\366#\020\333\217\200j?\202\247\315\001\336\300>\202\030\373\033\364\3667\254\331\337@f\177C\335\376\206)\373\033\304\3667\370\330\337\320\264\277\341\335\327\020f_C\334\276\206(M\2140Y\311\2728\341\031e}\234eH\221\247\272\267)\2222i\233\326\272\265\226\204\254+\314l%[\211`\2666JW\3676\305R"
+	.ascii	"W\226\261Ul-[\323V\2635lE[\301V\350\272d=\303\321\225lU\362\325"
+	.ascii	"k\375\n!H\266\"\252\357\333C\313SH\021\256\272\267\351J\266\026"
+	.ascii	"Y\217\34095\022j\236\254d+\327\220\242\272\267\351\373BY51\254"
+	.ascii	"\332\350h\\\2057\260\032p\006\366\032\254\3665\324\330\317\240"
+	.ascii	"\267\237\301\313~\206\265\275>\207s8\306\254e\375\fI\3663\\\255"
+	.ascii	"YxI\r\020%Y?\303\322j$'o?\307n?G\313~\216\223\375\034\"\3739"
+	.ascii	";\366\277\002Y\177,\311\022V\224\365\372\303\307U\023,IO\353"
+	.ascii	"\325\352d\267\305%k2]\314\244i\306da\211\002F\353y\345\312S\356"
+	.ascii	"\f\217/qO\244\031\353\307_\254`\221b2Z\332x\324\211\205\360\345"
+	.ascii	"+\r\031\"\322\036\31743Tmtc\322\263\037\247)3dUZu\254<V\252\265"
+	.ascii	"\306\272c\315\261&\255Hk\323\032c\265Zm\254R+\215\025\307\332"
+	.ascii	"c\205\261V\255L\353\2145j}Ze\254P\353\215uj]\302\321\325i-\372"
+	.ascii	"j\264\036]\243\311E\313\354\214<\277d\201\"u\322jV\"\025\372"
+	.ascii	"<"
+	.ascii	"\301h\207\364\313\352\244\247\350*\352Y\323\206b\224\005\247"
+	.ascii	"y\311V>\300p\232\273\"\3174xXe[0\233\021\333\223\314\352\244"
+	.ascii	"\347\324\244\230\f\227\272\2650?N\263:i1G\236\357\013e\333\302"
+	.ascii	"\3600C\200\326m8\003\373\234\032{%\3725\032\235f}]\360\221\306"
+	.ascii	"HJ\326}\277\2601S\300\262~N\214\375\020\332\324x\356i>\255\207"
+	.ascii	"\243\372\215vs\234\226W\307\364|\243\247[oZc\323\016~`\200tA"
+	.ascii	"\263\365\215d\366\215_\366\215u\373\306.[\257\001q\315&x\004"
+	.ascii	"\265v$\353\337\226\215\245x\003k\001\316\300\336\310\266o,\333"
+	.ascii	"7v\355\033\177\354\033\235\366q\334\354\343\224\331\307\341\262"
+	.ascii	"\217\263\266\217\243d\177\2127\260\307\001\262\217sc\037\347"
+	.ascii	"h\277(\335/Z\331/B\367\213E\366\213R\373\305\243}\"\232}b\335"
+	.ascii	">\361m\237x\266OT\262O\264\332'.i\270\240\\[]\215\254?\314\323"
+	.ascii	"T\206w\373\327oZJ\361\207\036\023\225v\323QpTK\321P0\364}\bm"
+	.ascii	"R\360\334\246\357\013\325R\364\223l\005B\2223<\267VLL\022\"\254"
+	.ascii	"\376\020m\177\370\265?\374\261\177\315\246\327\264\22412bz\355"
+	.ascii	"\307q:\252\255\204:\353I\304M\326\254V\263j\343\001\226\005\345"
+	.ascii	"BD\313\026\335D3\361Z\263K\202v\315\344\327KtZ\266r!\312\264"
+	.ascii	"\252-\353<\2077\260\004\300\031X}\006\342\032M\217\205i\223&"
+	.ascii	"k\0174\324\354\f\022\364J\326e\371\031\204\306\233\254?\204\261"
+	.ascii	"\217\307\210\350#1vh\037?\206H\337\027*\247\277t\227\223\"\030"
+	.ascii	"\r\253G\031\020!Xb:\211\036\323`\032\211\016\323J4\231\366\302"
+	.ascii	"Q\375\245\271D|i-\2755\002R\323o\206\020\035Cx\340,W\331\212"
+	.ascii	"H\204\363\032\205!\242\203\374 \364\227\026\222\255Z!T\2772\271"
+	.ascii	"\267\034\032\364\205}\373\302\271\375\353-\375\024\203\nb\004"
+	.ascii	":\366\276o\361'E/\311\215\254/\214\333\272\2106\202\243::\213"
+	.ascii	"\316\250\306T\326\027R\331!x\261\016\373>\254\303^\310d_8\266"
+	.ascii	"/\354\332\027\026\331\277r\265/\324\261/\006o`/l\262\252Z\241"
+	.ascii	"\352\232tdM\325\n\341c{\223\365\203y;I\323\030\"BO\351\247l5"
+	.ascii	"\002\322\353BM\027\225\306\241w\350\034Z\207\356\241\2454\017"
+	.ascii	"\034\325S\332\3065\224\276\221\247\232M\273\262\214t\f\"iT=]"
+	.ascii	"D\246\253\210\222vj_\272\0277I\273\260\310\350)\035\245\232\215"
+	.ascii	"\320u\344\211k\372\276\320\325)\351\311\r\216~\360n\253P\274"
+	.ascii	"\201\035\001g`\037\204\333\017\25695\341\"(\321-L\327M\277\033"
+	.ascii	"fV\272F\021*\345\314\021]C/\261Ua4z\004\351\260\314H\263~\220"
+	.ascii	"\311\3765\r=\203\307\2232%Y\353\031A#t@\232\302\366\257ch\244"
+	.ascii	"(=zH\311Z#\341\355&Mx<\262\326G\330.I\2251Y\177\215p\310\031"
+	.ascii	"\2536Y?\250\265\177]\244\211\324\220\255\035\311Z\023\035\016"
+	.ascii	"S\271y\215d\255\356\251}\377\177\254\235\327\017\267\276\363"
+	.ascii	"Y\251aq\311P\320%h\320\370x\203\373r\226\035f_8\376\377\206e"
+	.ascii	"\3170U\262~\360\307~P\307\376U7j\233\265g\032(Y\227Q\323\020"
+	.ascii	"\213p\336\367H\224\251\312\006G\3256m\3245x\n\236\303\322aQ\275"
+	.ascii	"6\365\221\205\325\017F\355\34343*\032U\215z\006G\3254\317mx\370"
+	.ascii	"\215\270\276o\025\224g\032U\212\337\200C\316\274\362t:\350\200"
+	.ascii	"Y\006Do\353\003\247\373@4\373@\274}`\230\375\253d\260\227.}O"
+	.ascii	"lw\267+\232q\246)k\325\356\307d\3241.\222\2401\223\265\372\252"
+	.ascii	"b\260\264\205\224TY\030\225n\0050Nrd}\021*]\376R\271\020\265"
+	.ascii	"lR\224HM\363\021\272\254\225\271\210D\320\227\211\315\"R\"5}"
+	.ascii	"_hFB\227\223`><\247Fb\214\2134#Q\351\360\031\334\206x\004}\211"
+	.ascii	"\332\"g\224HM\277\250u\252\027\025\f\216\252t\252\334\3259\265"
+	.ascii	"\013\021LL\216\tP\003_\274\201\305U8\003{`\331\336\202\271\300"
+	.ascii	"hB$\353\003\223\354\3431\025N=\242\272\331\360\340\345\304U6"
+	.ascii	"M\373q\032\025.\367\371\030\202\245f\211\220\302U\366\365\276"
+	.ascii	"\320\034\226\325\324\263\246_\215%_\322\233\005\026\037>\206"
+	.ascii	"HW\212j\370\262X\351\261}\224z\364\300\261\322\251\"Z\303\226"
+	.ascii	"E\361q\351\340\322\245\rN\325q\254\306\236\321/Y\343P\035\256"
+	.ascii	"\215\343\342\203\n\003:6\022\013g\ng\212\245r\305\r\336\220\254"
+	.ascii	"\217\001\244\315\363\205#\205#\205\243\243,*\f\027\225\353M\315"
+	.ascii	"\036N\216\343\350\310ci^\226.\220f\373\27486pl\340D\305\200\243"
+	.ascii	"L*$\217\314.k\234(\234\033nrT\275\301\201\352\001\342\204J\326"
+	.ascii	"\277@\224\375\013\250mw\rN\023N\023\216\223\016\366\t\207\230"
+	.ascii	"\333t\225\361\364\324\006\307\311\316kN+\353_@j\263 \252Q\003"
+	.ascii	"G\t\243\275L\355X\r\273,j\221\250(uY\277\2056\333\225\303\231"
+	.ascii	"\2013\003Gi\252\206]\026b]\220\0314ph\034G\311(\211\221'Y\177"
+	.ascii	"\r\320\311W\231/9\262~\013_6\013\260\276\343\020\365\341$\251"
+	.ascii	"`\364\202g4\316\272\340\034\035'\35181B\204\3602\373K\t\230\242"
+	.ascii	"\254q\220p`\340"
+	.string	"\030\275LFRF\351L\3268E\207\023J\205\231\n\301y[\340\262]\360\221\227W|3\255a\3466\375\241\301`\303V\334{\361\215\256\332\373b\222uQ\2578\267R\331\242#I\221\342\024I\020\265\254\337\302\222\355B\2312/J\313\024\247\305\244)\326)\bf\247\204J\232\027\247/\266\t\021\302\341\332\304<\261\262.\262YST\203\346f\204Y\244Lwd]<c\006\257\205\261\355B\034K\206%S\274\033\302V\301\301\265\027\254K\202\346\253xW\264\013Ja9\245e]\034\303\002\227\222\026j\210q!\n\0300\026\340\352\333\323n\222,]\311\333.,\361\342e\210\204\321^&\rX\320\372\366\366\240,\341u\331\310\245\270\270\"\235\264\206\231\233\360n\313+H\227\027\3516\340!&)\353\342\226\342\334\027\261\263\272\342\\Q\216\006\216\275\347X\213c\314\206\232\"\027`\221b\216\267!a\262.j\261"
+	.string	"\333F\036\261b\245\210E\247\212\350\f\007Zp\024\t\233\242I\221\301u\345E,\230\017#\205\251\361\335\002962\355\355\255\b\007\365\313A\203\253\253H\345E8:15<\262.N\321B\037\321'M\026x7\022\215\223\027\331\234\024\335\212j\370}\245\250&\220\033>\321\001V\325\366\242\333\213QB\204P\234\252\001w\305&\353\"\224\023\245\266\274I\263~\361\t\260\013H\232W\326/"
+	.string	"Z\224\223Sq-X\006\207T\227u1\212\203\324\230\243S\373\177\3023F\242\210d\375\n\350\355W@\315\346\271Z\262\244\310\204\355\t\303\326\227\255b\332\213L\340\332 QC$\353\257\321[^z4\300d\375\n\200\331\31083\263\342\031F{\2316<E\205\341\302\346a\301\361\025\241/\236\035\216)\316\216,\353\353\255\341\230V\030.Y\277\002V\366\212\271\257\257\"\331\325\243\267\207Y\013\005e\226\367\233\3415\246\f\354E\262\342\330\020\030A\342\262.\212\265JG\242o\326\257"
+	.ascii	"X1\254\002R\233gJ\211\022\365y\005\312,\357\313\213\231>\257"
+	.ascii	"\254O\201\276\315\023\335\332*\"\301"
+	.ascii	"=\242\302p\371j\237 q9\352z\021\t\031\034gxd]\344\362\262y\244"
+	.ascii	"C\206\024\2650\332"
+	.string	"\313\324J\243\370\270\020\300\306\211\354\310\213ZD\\b\202d]\314\3128\322\210\231v\311\272h\244XD\211\312\315-\353\"\221b\221\337myR\344'\025!&\372\244\200\330\346\221+\n)\n)B!\331aQ3)Y\237\002?vOS\324\213RQE j\035\206\276RUDg\016\340\025\225\0276}\223\2448 \3220s\005\204\352E /\376\b\021\302\313(\2034i\222u\321\307\361\2204M\222\262~\321\252x\365\377~[d\332\370\262>\005`\354bU\001x\344Y\355e]\354\3612\377\177y\351-\t\217\254\213<n\246\355\fk\2528\305\305G\235Q\326\305\034E\0358\372\270\342\216C\213\304\267\030\321\270\254?\001\276}\37486\004\370ql\021\307\357\255\007\220\253\254\337\256\201\331\361l\263{\236OOE\250\257\2500\\\246*\224)k\272\024m\274\bu\267e\315\333\334f\221\305\304Tl\372"
+	.string	"\2771\232,a\222\252P5LK\232\330\200E\316\220\254\262\376\004\324v\317YQ\251\250T\\\352\342\252{\303D6\214\210e]\\\302X`\224a\201e\375\t(\331=O\2121\2121\2123\302\242\302p\231\256;\316\260\210)\312xq\2060\316H\212(\353bR\306\361c\303\245\206o\002T\273\247\356\315\213Fo\2120Z*:\257\321\321\333cH\006\275(3e\3237i\212\003\237 TZ\212G/\302\320\322\307\304\355*\353\257y\224\377?\234\004\n\330Z\326E\242\027\213\376_\033\346K\034Z\326\227@\230M\354{\361\375\177\353\016\033wH\262\276\004\350\366O\344\373\177B,-\\\320d}\th\331\227"
+	.string	"\334\356\311s\343\206\250\367D\330\307\346e+\357D=]g\006F\214\004\310\266KC\215\032b\233\253Go\217+\317\367\225\342 \237q\362F\217\315\211m\260\302\346\310\262&\256\221@\325v\203H\245D4\030\355e\3420\025\025\206\313\001\200\250Is\346D4\307k\257\224\021,c\220X\305\350\262\335'e\312\020\361t\252\210\316d &\005\317\315G\027\323\215\023\361\254|\\\305"
+	.ascii	"\233\262Y\340\270\273#\216\301h/\223\007\226\350\236\276\336"
+	.ascii	"W\212\203\241\334S\024\247\254\257\202m\273^;\377\211a\302\020"
+	.ascii	"\307\350T\021\255i\271\2448P\303d\200\241\022s\342\230\341\032"
+	.ascii	"&se|\377\177,\027\246\275\274\254\257b\311\316f;'~\371\202\371"
+	.ascii	"\266\214\367\275\322\021|\212\252\2032f\315ye}\025O;\004\337"
+	.ascii	"\316\211uu\231K\233=i\215\201pkJ\312\372)\370\266\2103;'\316"
+	.ascii	"\021\347\210]\364\021\364u\032r1\231=\021\243pm\336\262&vI!\335"
+	.ascii	"+@wN\344\302%(\245\211p\336\243%S\267\267I\312\003l\227\244\211"
+	.ascii	"\230\254\237B\313^aJ\330\211g\371I\206\202\243\3040\242\0265"
+	.ascii	"I\352\265\321A\235\221'\035E\222d\035G#\007\233Z\326O\021e\037"
+	.ascii	"\217\241\261c\304\310-Q\315:\030%\2410&'eBt\242D\0131J\224\202"
+	.ascii	"\347\244p\336#(d\244cD8\325I5\343\362\264B\314B\304B\254B\244"
+	.ascii	"B\274\202\243D8\242\032\021\216\230\266E\372\276\320 \2305Zs"
+	.ascii	"D\215\3662\035\214\222P(\263#J!\256\021\335:\030%\275EW\007\250"
+	.ascii	"\022%\206dJ|#N\301Q\242\224\353p\030\352\215\231\226\261\372"
+	.ascii	"'\272\021\243\270\315\330\021#k\"\024\274\2648\032?\262~\212"
+	.ascii	"\036\373'\266\341(\361I1\006\327\233#Y\023\331^F\313 \232A#\305"
+	.ascii	"\216\375\0247\366S$mb\223\375E\312\203K\326OQ\264\217\202o\037"
+	.ascii	"\205\233}\024j\366QH7\261\214\b-\206\271\005a\313\372\304\025"
+	.ascii	"\210\310\261e\255\311r\234\326s)\353\023\307\210b\216D\317\262"
+	.ascii	">Q\354\377oe\353S\223#k\340\323FBA\267\001\220\007\024\252\035"
+	.ascii	"Y\037\305\332^\001K\326\211^Y\304\257|\006}\"\032\035\231\362"
+	.ascii	" \343\240\202zf\r\245\241UD\2275\261\213\230\204\250\344\377"
+	.ascii	"\375\246(\325Me}\024h\373D$XtYI\262\316\370p,q\353D\256\377\327"
+	.ascii	"\2165\035E\263>\n\262}\242\026\361\371\377\3247Z\246\310\310"
+	.ascii	"\372(\222\354\023\217\374\377\205\340\316\n,k \324FB\021d\203"
+	.ascii	"\237\035Z\231\"Y\037E\214}\204\3329\261H\221\265NMz\213\256<"
+	.ascii	"t\335E`\272}\204\f\031\242>9\330\200\242{\bI\223\222\365#p\267"
+	.ascii	"Od\355`0L\f\202\243\304 D!(@_\"\340\2270\375t\201I\024\254\275"
+	.ascii	"\254\037\001-\273\003\351\316\211?\210?\324\2507\334\316\324"
+	.ascii	"\262~\004\334\266\317\221\253+\341\335\0331b\233(g\230\262~\004"
+	.ascii	"\316\366\007IvN\254\"VEYAu\311\372\021\340\332\033DwN\354A\354"
+	.ascii	"\021\324\261a\034\275?\300Z\250\265H\024\227Q\326\217\300\224"
+	.ascii	"\016\342\224\216%;\210S;\246bt^\326d\375\b,\355\237h\263]\210"
+	.ascii	"\332\311\\\230(E\224\322\020\207\245\351\212\007\300,<2tY\377"
+	.ascii	"\004\027(b\024\324\332\rb\324\215\013\304\265F\222\306\276d\375"
+	.ascii	"\023P\366Ox\355\240\035OO\352s"
+	.string	"\353X1\003\306\230R\345\226\365OTm\374\336\021\233\210MC\244\237j\246\306\023\327\327\221\021\326\217\254\177\242\306\306/\233\235\032'\326\030\"\241\360\342,\276<\345M\035\227\254\317\302\2248\203\250D\234\241>\201\274\020i\020\225\2104\324g\\\221,{FXY\237\2051\373,L\331>^\210I\304$\341]\007\260<q}\261P\266\177\276\210HD$\365\351&\216\205\252\375\363F<\"\036\251O7fR\026\212\362\210EyD\242\0372z\304\"=\"\221N\033\274 \222\032\330\\\326?\361=\221\250\035\222\306\207\226\254\207}\2774JQ\274h\341\013\206a\002\263\3027|\223\325EF\306\333\306\232\212F\r\367~P\016\272\314\016+\263\254\277\302\231\375\025\260l \2506\037\256\031N1\037~\237^,\003\311\026\035Q\366WX\222f\270&\315\020\311H\315p\215\232!\322&\322\260%\307\023\327\364\225\222\342"
+	.string	"7M\243XY\177\205\256\375\025\246\266\005\324v\206f\360\360\314\231`\024n\332lOhHW\250\261\217\203Q\254\005\250\354"
+	.string	"\243\340!\336\020oI\2056\033\003/\0312\231K\347U\313\334\251\340\2661\360\334\371\320\316\316\215\ng\373\304\322\016\006\303\303/\303/C1:\320\227(\002&L\277(1\263,\\a\206`0RY\333X\3267\200I\246\320\375\310\372*<\273\f\353\272"
+	.ascii	"\335\321\r\353\350\232\260\034Q\341j_\205\245\335B\335\316\207"
+	.ascii	"rr\230-\343\274GKbO7\273\005+;\037n\031n\tK\341\313>\026,\352"
+	.ascii	"\223}_\f\255bjz\245\2328\360\331\3132\214\033fQ\237\233\250\003"
+	.ascii	"c)4\331O\241j+oX\261\242>\231Rh\332AI\340\340\206H\037XYr\263"
+	.ascii	";\330\3339[\206-\223\255\266\321\321\333\003\253\225\272Q\206"
+	.ascii	"f\275b\323\006,\353\240\271\341\223\341\223\341\033\034\336\360"
+	.ascii	"\355\212\2204`\262\376\232\241[\333\232\033\254\254\377\241\333"
+	.ascii	"0\n\233\234\020\251\237\f#g\300d\r\2055\303\236\371\337'\037"
+	.ascii	"xrY\037\002l\273\005\275\235\017\331\3302\327\007\255\223%2)"
+	.ascii	"\004\272\366\005\304v>l\202\243\303&\303hq"
+	.string	")K\364\037:\031\252e\035\031\312\217,g\262\326\231\303\033XU\tg`\017\001\252\255\034\246\r\323\324'\bS\342 \300\264\215lv>\204B\207h\016P\253*\262\341A\315\022\335S\224'Q-Y\017\3174k\244K\354+\353?\240o\377\001v\233\203\035;\037\216\215\r\313\264Z$z\214\233\232\233\254\207d\230\3569\245K\326\177@\334\376\003\234l\b\200\331\371\360k\3705\f[\352\022\323R\001\022\331\233\254\207`pD\330le\375\007x\355?\340j\227xw>D\202d\250D\027\241\275OD6\243\035F\320\206I\332\035B\320Pe\375\0074\355\233p\263G\224\331\371\3609|\016\271F\350\"\322B\346\365\222\365p\213\003\321\261\276\254o\242n\337\204\332\026\200\335\316\207F\216\243C#\303#b,\032\3544G\3449\314\232Z\365\240\222\365M$\3317\301ck\220c\347\303 8:\f2$\342"
+	.ascii	"\254\252\327\006\210)%4n\323\261 T[C\"\377P\310\020k8\004W=5"
+	.ascii	"\221\266\261\361\242\312:W\341\rl\0068\003{\024\336\354\020P"
+	.ascii	"v>\274\032^\r\177|@\306\2455F\034K\242\273\222\365\320\207N\206"
+	.ascii	"=1\257\254\217\302\231}\024\346\366\nV;\037\366\030\366\030V"
+	.ascii	"\201\340\225&\354\t\0239k\263\226\365\220J\325\332:\363\314\372"
+	.ascii	"(L\331G\341l\237\020e\347C\035:\206S\272\b\355ub\237J]l\276\300"
+	.ascii	"\004\2411\334A|\243\"w&\353\243\200\265\217\302\214m\202h\347"
+	.ascii	"\303\250a\324P*\312\206)\035\331\303bE\252.\017\245\2068\\H\203"
+	.ascii	"\262\323!\374\"\253\"&\353\237\020fc@i\347\303\247\247!\024\n"
+	.ascii	"\257\316\302\033\332\320]JJTY\377\004\270\375\023\230l\343\325"
+	.ascii	"\316\207MMlk\016\"P\266\304\266\361\310\316\2075j@\311W\350\362"
+	.ascii	"\256\266\2661j\347C%\245\340\rMd<z\177\250=\337W\213\007*\026"
+	.ascii	"'>\360\262\376\tU\3338c\347\303\031\303\031\301\033\333(\251"
+	.ascii	"\252\310\007\007yPyR\323\367\325\342A[\243\352\207\223\254_\302"
+	.ascii	"\315\266\300\217\235\017\223\206I-[\373\005VG#\353\227\030\263"
+	.ascii	"\2237\2060\2060\206\315+O\\_C\244\337V\227\017\245\254_\202\312"
+	.ascii	"\276\200\230\235\017\215\206F\231\013C_\246vIL\t\262\275\001"
+	.ascii	"\266\235\314\205\207\302\351\220(sy \202\276L\307\351\023\327"
+	.ascii	"W\211\256"
+	.string	"\375\022Bvq\307\316\205||\030\213\003\324\252\212\2360\030\2032\313\233N\225y1\313\372%\236\366\211';\030\f\013\365\204z\302=\024\240/\021\221\211Y\360\206\260J\213\022T\\\3267\301\315n\241k\347B7nZ,\035\350\373\024D\304\0043;\031EhFhF\330F\356N\310\346\30260\320\230\351\221\265p\215\005\262\034i\311Z\250&W)\216\251B\346\231\2650\315\315\320-\265\301e-Ds3xglM\262\026\2369\234\272\304\313\356M\326Bi\273\005f\312\016.\353\257i\267\376\377\202>\266x\331\222\365M\210\333\"\310\355\\X\246L\020\212\003\262\272\2740)\317\035X\262\276\tT\366\013^\306\214\021\336\221y\342\262\273\360\2168\006'u\343\346\377\357\bGd\232\365Mh\262?\220\262s\266\217\355c\365\034\240VUt\205A\030\324\335\224\272\267\307\346&\353\027\366\300\200Q\237[\256\230"
+	.string	"\265[0\263s\241\027/c$\324\354\2407tt\352\023\316\214\304\227]\024\262s\341\234pN5\333FI\373U{\023#5S\332\002C\312.v\355\\\310\205\313\341\364\357\350\275\032\363\f\243#J%\353\223"
+	.string	"\333E\263\235\013\265h9\234\003\324\366\233\366e'\235\306\300\262\226\365ITmldv\345\2120\013nB\003\202\013\224Y\336\024\013\216\n\263\210\275Aq\2140\263A\360V\245\212\236adn\203\340\212\n\025\215\004\366\224\262?@\366\366\246gly\242\355\017,\t\335\204n\032\311N\332\265?\340F\bE\b%\211\332s\304\217\355\001/\3026a[\2227\322\033;\006\255\2655\215df\004\3216\200\227\235c&\230\tfs"
+	.string	"VUQQ\006]\\}{yOG\324\227\254K<\331\271\220\311qT\310D\350\244\214\r\273\247X\030+F\262\0266\tc\206\212+\353\227\220\267_\302\232\375"
+	.ascii	"\275\235\013\317\316\204KZ6#1-|HT\204d-DS*\022r\224\365K0\263"
+	.ascii	"_\302\335~\221ef\246\233\300\260<\345\266\013222\215\024\245"
+	.ascii	"\204';\205"
+	.string	" ;\027\212\t\305\202O\n\330\232\022\366\004\206\312\f^\326/Am\267x\002\006\246\233\310x\230\355\026\330v.\364\022z\201\225\220\265C\020\227$I\027^\t=\366\007K;\027v\035G\205]\301&\007`U\275O#\200Y\025\277\\y\222\224\365K\240\261c\320\333\332\362\212k\263/\020c\347B-\241\026f\313\320\267\t\230\325F\302\230\375BFV\226\236!6E\202\225m\201\347\316\205E\204E\036E\037\241\275F\212w|O\\k\356\224dd}\022\324v\263\306\220!fZ^\273E\022!B\214`\355!#@\200\220\305\351\330N\037>|\230\311 a\306\346@\222\225\225\236!\245G\233\035\002/**\215\324\265'f{`\212\007\017=\243\007\226\335\0012;vxe\255\355\026N9r\204\211\355\241$\0348\310\304<\263v\263\357\306\r\215dV\303\001<\366\005\264\354\\h\3438*\264\301\332\340"
+	.ascii	"\372\022\025\263\266\274\036\334\001K\233i\347\344\244\221\326"
+	.ascii	"\3666\f\\\302\031\302\031B&\275\247\260\306\205L\307\033^\351"
+	.ascii	"Rb\225\265p)g=\231\302\304\262\026*\345,\036S&g\262\026\322\310"
+	.ascii	"Y\377\177\255\230\231+j\207\273!ElK\326o\300\224\315tJJ\3223"
+	.ascii	"\360\3146\007\312\b\221\204H\032\311l\357Yd\013]\021\036\t\217"
+	.ascii	"4R\004\212<q}5@j\343\027KX$,R\237[ZO\\S\006\354\355b\230\235"
+	.ascii	"\013_\341\233\255\034 UE\204\306\203\026&/5B7gn\306d}\006\240"
+	.ascii	"\331+\200\355<\310\307\027\224r\200\324[d\325\201\221\221'\256"
+	.ascii	"\351\333$\345\201\3662\2635\226\365\031\240ec\340\307\316\203"
+	.ascii	"{{\331\n\343\274Fe\246\317\265\215\001\251\235\007\363\362\262"
+	.ascii	"\025\206\276L\300%3\f\b\333\b\360\262\363 \0336\301\251\003\324"
+	.ascii	"\252\336'\002\300]\365\355U\371\312\241&\353`\033&4.g\262>\003"
+	.ascii	"\264\366\031@\265\037 \266\363 \232 \232\240\032}\204\366\022"
+	.ascii	"\021i\240\251{\223R)R\223u0\r\227\030\003\230\366\027\220\267"
+	.ascii	"\003@e\347AiP\272^\341w\353\350\375A\326F]\361\200\350tf\205"
+	.ascii	"G\326_\200\230\275c\265\363 \031\034\r\222\t\3429@\252\252\250"
+	.ascii	"h\004/\"<7\241\264\312T[\260\214N0\016\314\017\"Y\177\001Y\366"
+	.ascii	"\027\340d\343\027M\214\230\240\335~\337\227\tk\314\203v\321\037"
+	.ascii	"h\222\262\376\232\237\231\377\277\337\231\027\030Y\262\376\002"
+	.ascii	"\206\354#\335\316\203`p4\bF\257A\201 e\314\002\236v\013f;\017"
+	.ascii	"z\tz\301|\032\372:\001\263\262\236\270\246z\373x\266\005G\203"
+	.ascii	"[\202t\277\244\367\205\372@\212\032\224\007\272J(\2151%F\326"
+	.ascii	"\301.\177\220KP.8'\254b\222W\004\315+\025\245#\353\016V\005\200"
+	.ascii	"\331G\274\235\007\343\342\262\025\373\276\250\222b'}\233\240"
+	.ascii	"\036\\\001l{\331\304\212\225 \026)"
+	.string	"n\036\274\362 \026u\013\221\256\264\254\277\006\263\375\377i\263.\251 Y_\001[[H\013\016NJ\230\002zl\002\244\355<\027EsQ\260\206.B{\211\212lV^yX\013\033\034LYs\240\352\355M\n\223T\001N\233\003innRd$\340\315\006ai\347\270K\027\354e\3038z\203`\265{LfO\303\271\034P]\262f\016y\362\304LK\002\246l\346\031\033\233Y\224\004\240\355c\325\316\203\321(\231\004h\355\017\206\354\034\213\301Q,F\265\023s\302s\373=\331\261\345*\353&W\223&fX\t\370\261\233U\322\322\314v$"
+	.string	"j\027\343v\216\313\3402X\352"
+	.string	"\254\252\242+\017Y\230\274\324"
+	.string	"\313\314\254<\311\332)vv\226'\225n\247\234\231\031Y\031\004\320\355\022x\354<Hv\034\r\222\005\225\034 \205\366\022\265O\266\224H\241\021\3635#\353#\200\313\036J\023\023#C@\225=$\006\f\214\314\f\001N\3661i\347A/\257l\245\243\200.\271'\002\216l\r\354\355<\230\004G\203I\362\020.\b\310\261]$uu)@\354\356\211\200\030\373E\336\326\226&\372"
+	.string	"l)\315\326\200o\347XM\024\253\311?\266\214\2437H\017\266LI/\210'#LV\326\035\260q\344\210nR\343\325\366ew\300\313\210\021M$\365\032\223V\331\032\230\333y\220\310\037\"\004\034\r\022\311V:/\021\032\017][\236\270\246\007\200\356\020hv\216\331\260\271\301A\333\265\006\t4k\rP\331yP\b\216\006\205\344+\366\375Uui\221\036@k{"
+	.string	"\n\004\210\027S\220\035\002\314\316\361tj\343\003\266\013\220<\271\254?"
+	.string	"wu\245\233\240\360\330!\262\354\034\273\211b7Y\312\001jU\257\323\bfEZc\373J\032*(Y\203\300\216\212J7yx\337\027\351u\241&\t\017)\324\016A\215\235\340\216\340\324\203<\036\344\241\211\360\373\276\257\324Kt\346\203$LO\\\323W\252\211\203\037"
+	.ascii	"\306\376\361\363\317\276EM\357\373>\255\320\267\311H\310\376"
+	.ascii	"\370x\305\230\203\177\210U\255~\001T.\274o\217(\317\367}\261"
+	.ascii	"\232\335\025\245h\207\207\367\377\365\373J\360B\257\234\222\216"
+	.ascii	"^\"\234\224v\345\224\224v\325dL\322r\345\364\0369}\035]U\341"
+	.ascii	"\244\243\253\246\246\243\227\310\370\246]5%\275WN8o\332\213#"
+	.ascii	")\255\210\b'\035\275N\357{\365\342\274IENo\032\264\311\230\224"
+	.ascii	"v\325\224\224v\345dLJ+rJz\253^\234$\350\217\246\027zEd\244\221"
+	.ascii	"V\344\364\246U9\031\337\264+\247\244<\2603\013\240\250\3611\006"
+	.ascii	"\314\021\331\024&J:zk,M\0255\341\314%A\253^1\357\213\325\220"
+	.ascii	"\336\246w\356}\001\360\276SUMb\212p`7\243\271\032FmEU\030\372"
+	.ascii	"\276/\207%#\037U\357\321\034\021~\347\222\220T\275/\022\243\237"
+	.ascii	"w\351}\337\027\004\"\350\334;\004\317\021\375\230z\225\220\336"
+	.ascii	"w\202\027\372\276K\357K\204\337\271\367}\211\336\367m\233\246"
+	.ascii	"\240\357\253\003'\351\271\264\364\276R:K\357\024\221\024\244"
+	.ascii	"\367\315jvnNIi>\252@Hi\222\366|c@\211p\222R\325\373|\305\\5\355"
+	.ascii	"4\242\263W\351}_\234f?\235l\240\311:\230#\003\331Xi\323\312\372"
+	.ascii	"#D\331A\034X\265\362\246IZ\326\037\241l?\351R\005K\326A\251\244"
+	.ascii	"'eY\007m\f\363\216\344\271e\375\021\214\354\240\023\361\207\022"
+	.ascii	"^\224\254?\002\220\035d\002\"\255\251\305e\375\021p\354\340R"
+	.ascii	"\0246)\247\254?\002\321\016\322\250\261\304\206\224\365\r\240"
+	.ascii	"\267]"
+	.string	"\230\261\363\240\214\343hP\206f\362Kz\337'\017R\356\f \267\377`R\020\311\212\027\034:\262V\361c\007\203\341 \021\216\006\211\202H9M\024\0202\246\315\204hvaG\2020\376`Q\320(x4$\252\001\345\253)\017\355\305\033\330]\2053\2607@\333\376\203/\237\032\225!\344+k\025_\366p\024\270\007\344\313i\242@tK\030a\025\0323:\266\362\033\340\027\341\020\032YS\262\276\001\300\366\017\324\003\272\251j\263fG\326*\322\356p\024x\007t\223\323\324\302\230\265i\316\221\005UB\203k\223\266\371\261\031\220\f\220\315\017\f\013\007\230\254\327\020\247\234\232\210e}\003@\305\220\001\214\253\361|_(\236\220%<!I@<=\204\206\024\r\360\f0\r\320\fP\rP\212\243@<`\231\"h\222\304\020\365E0\263[\021\264\354\037h\007\024#\205\307\227\254\254%\200\264\203\3010\020\013\216\002\261"
+	.string	"\305\3444Q JF\3726Ay\020f\247q\201A\t\303D\265xd\r\004\363c.\300,\300/B`\031\263-=\262\366\362\266Oyd`Y_\204\261\2514N\357\t\234\003\322\001\271"
+	.string	"\353\200r8\n\354\002\324\242\203"
+	.string	"\267\354I\337\027\n\354\002\304\214\024\330E\017\311\3136\240\\\321\022\352\213\220d_\204\033\373\",\355\365\305\033\330\207\220\267\253"
+	.string	"\255d\0344\270\236\312T\231\002\244BdCc\215\225\254\037\302\225)\026\230\333\001F\301\001\304`\323u\362\270@n\n\tL\274"
+	.string	"R\262\32041\354\001\032Z\376\244\210\200\351<\341\352\274\300\203\\\001\004\204\034\341\202\t\234"
+	.string	"\216\013\264\002\251\242\005\313t\223,\222N\245\333\223\004:\217\314\245\020\320\355Y\006i\347\221\005's)4l*\227I\247\320\262u\235H\024=C\310\025\333\215!\231\302\215!\231b;7S\330\203tQ"
+	.string	"J\"U8\205n\neRmn\020\001\204SiB\203{t}\210JW\210\005\241\3172\005\227\211\024r\231'|\226)(\223>n\t?\315\244\322\005\022rQ\230\300\303\\\226h.\201F"
+	.string	"\001\221\320\3436\221L\023pX \240\241\022\315\244\206\377|p6\217\302\024)z\224I\026\032\224\256\020\013=<>*r\t\364\237\017nP\322\351<6Uh&\201\200\222;\313\344\222\311\223T\301\rJ\252p}$h&=\2300\001\023*F\220p4\201\004\013*\034G\2408\2460at\272\315 7\210\025\n\372\317\007\367X\364Q&\233&\\03\270L\022\\0u68\225&\226*\232\256\363E\tN\344\222'\203\253L\246\300\302e\016\ti\245\013\304t6\331\023\356\2619\344D:ST\340\362 \205R\264`\272M\027\005\t\017?\315!\240\022:\377\371\320T.\203\202\226<!D8\225&V\f\245@\016C\210H!\342\030\302\007\251\"\002\246\263\031\001\020\320\220R\271T\266\316\243\033C\262\311\276\020\342\tr\203X\021@\244"
+	.ascii	"a\002%8]\037\tHp\272>\306\022&\220b\204\343\b>H\025@H\236\037"
+	.ascii	"'2h\007\206%\363\307\271T\266,\220.\220v6\225K\236\225\205S\231"
+	.ascii	"d\002\261M\245\004J\230\200\b :\374\347\203\2172Y\302\004\234"
+	.ascii	"\256\317\260m\377\363!\005\025&R\354\274\300\263\004\032\341"
+	.ascii	"2\227#\212=M$\005\334\236e\0203\211\314\340\036\235CB\312\344"
+	.ascii	"\360\205\320r\304\177>\034\221L\244\320\016\217r\250DP\311\""
+	.ascii	"\257\315\243\217\220\320yT\372\b\255J\037!\325\215!\331\324/"
+	.ascii	"\204\226<\232\351\024R?|\301<\366\270m\217\333\034\322\315\366"
+	.ascii	"H'\262\347\350#\364\201xt\235H \241 W\205\217\220\005MgRiB\030"
+	.ascii	"\354q7\b-\235\315\r=\256\216\322D\004)4\235\311\036\023^ U \376"
+	.ascii	"4"
+	.string	"\223\312d\211\024*\360Y\246\320\243$\341\005\036\367gD\005?\020\037\334\240\244\212`\321\355Y\252\340l\272*\224\311\b\\\247\220\353\226@\202\263\211L\341\204"
+	.string	"\232B'\370,S 6\207N&\322\231B\203\211\023\037|p2\221B\037\232<Jd\213\036\0224`\272=n\217\353\256\300\302D\004G7(\351T\0161wxX\f_(I\350q}|\226)\370(\223(\202\220L\026N\r\316\fN\r\316\b\234\0238%h^\3404:u*"
+	.ascii	"\200kt\235H\022nPR\305\017\2053y\202\223\271\374i\342\374\347"
+	.ascii	"\203\033\204\\\001\370\343\223D\241\270d\241L6_\244\370}\360"
+	.ascii	"\241\307u\225A\247\353\3233T\202\033\204\\\001\005g2\310\305"
+	.ascii	"\257G\35163\260C\237d\013\244\322\rZ\242\220\342\304\tL7(\251"
+	.ascii	"\"\b\311tcH\246\220\200\005\213\241\022\376\363a\231\034\236"
+	.ascii	"8a\242'y\202\351\236\350I\236h\022M0]'\273d\"Wh"
+	.string	"\247\0172H\355A.\201\202Lw\311|\341\243\227\314\027'\270AI\025Hf\216\313\243t\231.\013\027E\323\b\3032\005\026\210H&\016\222\211d\"\231E$3(\251\202\351\"\231$z\222'\226\314\027'\020yxH\030\026\231.\316\t\022|\224\311\246\004^ \231L\0228@230\335\234\344P\tn\317R\205\337\006#\212\242\263\350\324p\302\350\314\351q\177x\220<J\t\224\340l\272\316\n\232\356\017\017rD\004Mw\202\246\013\224\024\nZ\216\310!\241\007\271\004\022\376\347Cs\207\202e\013\246\233\002(\211T\321\304q*\207\230K\347R\205\241\025n\317N\017Prh\205\317\320\n\227D\017r\t\364\343\341!a\310\303\203TyxHh\227\314\027'\3504\215\031P\fI\364$O4\223M\327\005\t$z\222'H\2308\321\223<\321\203\\\002m7(\251\202x\236$\323U\272>\373 \210P"
+	.string	"\021Fp\321~\004\004|\200\200\017\330\217\200"
+	.ascii	"\020 \020 \002\210}\021@\250N\247\363\310:"
+	.string	"\233L\027h\310\204\r\316f\te\022\251B\016\n@\310\fNh\n\235\340d] \241\240\344\005m\023\206%P\212\243\220\353\256\020\272G\346\362\204\206\024\234\307\027\232\310 g\262\004\027\313\025B\036\346\016\017\013gr\205~\241\211TA\271L\36205\270\307\036\023.\226+ZgS\310\007\370\202\271t6\223(\300\260\004j\006\235G\347\177>p\0204\224\002\b9\324\223l\272\314`\363\330\034Z&[\270L\241\315\\2\231&0\227\304\265y\224`D\212\fN\347\261)\0017(\351\334\304\021%$ !\002\007\206%\020\361\307'\371S\354\021\001\204d:\207\\\345\357\330#\"\203\363\004\f\356\n\315#\006\315\244\013\022~'L\200\204%\363\305\tB\027\210\347\305\bW9\344\364\301\031\322\340l\0369\b\271n\t<\312\027\315\355l\"\201~\315#\005M\037$\020\213\025\350D.\201J\300\340*\207\315c"
+	.ascii	"\224C%\2209>H\240\022N\344\022\210\305\017\006W\271\235J7\310"
+	.ascii	"\331\034\332@\017\t\312d\216\363?\037\232,\334\236cPRE\260y<"
+	.ascii	":\225n\013\023|\226)X\3404\341\263\004\022\272"
+	.string	"ACM\027\205\2172\351\343\263\004\032\016\235AK\245K\302u\"\231?\n\232l\320\320\n\256\023\311l\235?\037vX\024\233n\211\036\027h\005R\351\026}\224\311 &\222\030\304D\036\235Mf\222\305Q\271<\002!y6\374\3608\22304\217@@\311\027r\202\230\310f\262\347\270t\016!\215\305\236\243\0172\250\350\203\f\372\371 \203\204>H\025N\241!\246p\311t[\360A\006\265F \241 d\323\310B\b\350\3506\223K%\021\310m\341\004B\036Y\360\0047\360\360 \201<<\310\237\313D\302\320\303D\376\034yx\220B\247\363\310\302\355\341\360\237\017\0244y\222AH\345\013\022\033\226L\267\005\036\036d\353d\341\366\034\235\0224\207\216?<\316\344\211\036%\t@@Kf\206fP\222\251\002\231\363\237\017M\036f\207\346\b\036f\316\206\001\371B\330\243D\256\350A\272=F\327\307\331D\2628\366"
+	.string	"-\177\216N \244\206#\f\310\027\032\234\377\371"
+	.string	"\264d:3x\001\3512W\034\221BN\242\353D\242"
+	.ascii	"Z2\235\312%O\006\036f;\202\353D\242\340a\266#\364$U`\3768[\346"
+	.ascii	"\217s7]'\222\271\2220q\202\371\243B\371\242\3477\302R\310\205"
+	.ascii	"\t0 -\300\303\004\366$\205\202\315\246\313\263d\n\035{\222B\306"
+	.ascii	"%\363\205\217\020\270\"\t\204\034\341T\272An\213\245\nK\346\013"
+	.ascii	"\037\017<\312\027M\026B@GW\350\2053\007g\350\310l&\2131\374\274"
+	.ascii	"\020B\304\321m\016\021\335\346\320q\351\f\272=\311\346\020\013"
+	.ascii	"\034\020 B\034c\370\321\020\342\350d\261\324\201a\331\243L\302"
+	.ascii	"\200\323|\001\351\n)_\364\024\377\363a]\262\316\377|`\272I \241"
+	.ascii	"\244\023h(H\303\b\022)t\234\310\025-~@\310\026-\222=M\227\351"
+	.ascii	"D\256h1,\241\370"
+	.string	"\237\017<;<,$\br\235\315\027Mb\321u\"Q\270-\222N\036\244\021\330\344I:\233I'\322\331<\276\320D:\213N&\023\251r`\272=H\367'8\204\335\240\244\212_\363\210t\"I\244h\n\371\030Y\347\177>4\205|v\226I\rN \244\332<\362,Sh\n\371\f\235H U\271\004R\177\200\200T \3441\305\211\023\204=\256+\224\"\3506\231C\313\021=\312\241%\323G(\264\354\371\321M\241\023r\334\240\345\3171\305\211\023v\017s\271\3449\2468q\302\317\211L\0214\244<\2468q\002\260\307}\201\007)\3046aX\002\245\350Y\252Pl\372 \201J\270N\244\263\tt\233\310\237\023.\013d\023(\211d1\354q[$]\036\027\005\020R\351\223L\341\202\211\323\223\004BN\240\204\013\346\206%\023\271\202u\376\347\003\323u\272AK&r\305\210%\023\271B\203\353D\002\r\361"
+	.ascii	"!y~K&r\305\3179\264_ \201\334\236\243\320\320v:\205"
+	.string	"\206\216N&\322\331\334B,,\231\310\025C\241\241\243\323\365a]\346\220\323U\261d\"W\024\377\363\241\331D\n\005-y\220A\2532\t\304\343\222\340I:]\245\0172(\303\177>,\231/|\226\314\027>\254\033\224t\n-\227)8]\037&\322Id\261\207\316\377|p\016\t9\207\226\307 \030\204<4\331\026.\t\327\211D!<\201c\"\b\206\023\306 \030N\364\270<\312\027M\245\004\334\346\020\321\3516Y\260`\301\005\3521\001\204t&}\222=\021(\223AA\247\013dP\220G\231\f\002\376\347\303\0058AC\312\035\264T\272=G\327\211d\036\225\313!\017\017\362\330\303\\\362\270L\240r\231l6]\246P\320\222'\330\n\035\335\236e\220\360?\037\\0w\\03\270`\002\205\220A<\314\225\351\366$[,\231BG\027L d\222\3516\215\312e\262\331\034Z\321$\272p\201\204\206H\260"
+	.string	"B\376"
+	.ascii	"\201\226<K\347\222)T\354I\376X0\217I\241\346\321\005S\002\267"
+	.ascii	"'\311d\272-\226Ge\322\203\363\330\372 U,\223G\237! !\035\343"
+	.ascii	"\3229\204<\366(\223+\216Nd\363\0304\304t\276\340\n5)\020\272"
+	.ascii	"@H\236&\320\311t[(\223\307d\263\311\f\3620{\222A\253"
+	.string	"2\031\264_\340q\177x\\ \203v\2619\002h)\304\303\224\240\351\272L\037\227D\020rD\013!\0269@\256R\211\374\3419\272\030B\036] \203\212Nd\213\244\223\207\204$RG\231\344q\233CG\027\310\240\243\013f\360?\037*h\036] \225\311\240\034\030\234\310\025-\""
+	.ascii	"\002ry\234J\267\3512\205\234K\245\023\271\242\005\007\367\350"
+	.ascii	"\372 \235@\313\0269\356Q\203\313\303\034Z\246`\272NW\005\247"
+	.ascii	"\322e2\207xr^8\223<H!\344\210\027L\327\351D\256(:\221%L\300m"
+	.ascii	"\016\r\233N\246\013D\302\b\2679\244\301\365A\372(\223J&\222\002"
+	.ascii	"\312e\322)\0244\324T.y:4\223M\227\351:\233/~\234\310\025-\210"
+	.ascii	"\315\243\013\224d\261d\236\350I\n\t\235\377\371\320\223\024\""
+	.ascii	"\201\233\307\021z\222B\354\tl\002\367$\205TW\350\205\363\310"
+	.ascii	"t\235@I\026Fa\f?G\026B@G\030\220/\2001\374\020Y\260X:\207x\216"
+	.ascii	"?<\316\245\362\230\343T\272<L\367\204S\231\\\236\020\032\352"
+	.ascii	"Q&) A\020\006\244\005\202\206R\364$\205\210-\220\307\246\322"
+	.ascii	"\025\nZ\216\350I\236p\"W\264\310\240L\252\340$\241')\204\343"
+	.ascii	"\002\371(I(\276p&[$\235\311\246\322M\001\344\266p\201p\234<."
+	.ascii	"\013\026\031\334\236e\320\321\311t\205\\\270G'P\322yT.cH2\227"
+	.ascii	"?:*\\ \247s\311\374Q\021\2012\211<\201"
+	.string	"\271t\"\231n\020\323u&5,\223N$\n\027H \027E3\307\371\343\223t)\340T&\227BN7E\020\323u\366d@\001\003\362\205\321\231\fJ\246\340:\221LbO\017\320\362\247\3512\177\234>8nP\322\tt\201|\224H\r\256\023\311<fp\217(~\232H\346\210\236\244P\316\013\246\333b\311\3432\217?M$\223\207\370\237\017\0234\217C\267g\251\002\323u\221\f\372\365\270M\246\333\302e\036\233G\030\220/28\205\206\226L\237\265yT&Y\270$z\200\334d\t\244\023\310%a\201\033\204Tj\326\205\333\2434\341\006!W\350q\225>\311\024\315\3446a\242u\362${\\\246\320\211\355\236H\366(\227<?'\261yd\272=K\036\245\t\033\234\312\241\345\b`\017r\t\244\221L\340\004z\220K \240\263\231L\241\007\310M\262\370\301\200d\252\377\3710\024\224\334q\376\370$\201X\350"
+	.string	"\001-\231\372\207\307\231\024Za@\276P\233\356\020\020\262\005\373\237\017.\220\013\200\346\221\207\007\271:\377\363A\003g\005z\220.\212%\363\205\217\261y\314\351Aj`:O(K0]g3\351\343\242\240\300\220P\320\006e\t\327\231d\302\3202\235'P\f\t\005\r\225%\234n\323e\266\312e\322\211d\016\371$Y(\227#\206\204\202p\234I\245\te\tgR\231d\231\316\023<\312\241\022=H\027\005\017\017\t\032\232\307\026.\t\036\036\344V\226\350A\272L\326\331<\216\babD\b\023?\266\331t\231==\310\226'DR\035:\222h\016\255\b\376\347Csh\005\207\3461)\224\302\345I\266p{\202,\\\022\256\320\013\025G\023'R\004]\036%\322\331T&\267\363\310\202\t\255L\236P6y\330\244PSm\016\255PO"
+	.string	"q\344\341A\2620 Q\214 A\002\353\366,G\264p\231\302\027=H\027\005\322\211\354\3719\213\307\366?\037\234<CLg3D\363\350\302u\016\005\031_\340Y\002\035\217\254S9\264\3449\036[\246\253\204ay<\266M\246\333\034R\036\217\273G\231|\341xd\233\312\244P\363xl\225\313d3\t\344\036\217?\347\321\331L\002\341\374\347C\323\025z\341,@\217\313D\3764\013\260\323t&W\354\f)}\n\340bH\231\004*"
+	.ascii	"\b\"\034E\030\301\305\216\3333\004\304\243L\3560\233C;\007p\272"
+	.ascii	"p\225@H%\323u*\223\307\036\244\313\374q\n\035\217\022\264p\231"
+	.ascii	"B\307#\353l&\201\216G\026\351D\366\034\217,\023\371\303\243\335"
+	.ascii	"\030\222\315\343\221}\201g\t\244\335\243\322'\t\204<\022\225"
+	.ascii	">I \022xx\220\333\371\237\017CBA\307%\363\205\017\017\017r\247"
+	.ascii	"\311t[$\231=\003p\217(>\b\341\003\021\206\204\2022(\227I\347"
+	.ascii	"\020\320\262\3512\201\315\243\006\367\230bH((\310\\6\225n\223"
+	.ascii	"u\002\r5]\024\312e\322\311\343:]\022CBA9-\334\036\025\b\331\202"
+	.ascii	"\351:\225&|\224I \241 d\n\036\036d\006\240\345\262\204\343\352"
+	.ascii	"\362(Yp6\221n\nN\022z\\'\262GH\002@.\017\017\t\315$\007\347q"
+	.ascii	"\004\24729\324:\177\301\227B.s\307\271\\2w\202n\317\2203\351"
+	.ascii	"t\"w\363\350:\221\316\024\312$R\205\f\316c\b\021"
+	.string	"nP\322\251O\230 q$a\342D3\351\002\371\353Q\"\203\202\226#x\230\277\021$HX2_\370\264?\316\3452(\005\017\017\362\3473\264\302\355Y\231K\3472h]\266`\272\315\325\211\\\321\002\350l\272Nd\n\256\017\222\351\n\005!\211\316c\b\021Ne\262u\002\221\260d\"Kh\333\021$H\360A\006\261\316\243\b \234\312\344\320\276\001x\016\300\"\204\025,\334\017\032~\200\003\214\360 \201\025N\330<\037\\,W\274\300\203\004Z\261\243L\"\203vx\230\315\235\017\026$\233M\246\376\237#E\307\017)\275\250[N\0242\351\0314c0\255\246&(O\232\304%\341\221\265\n\306\024\325\2225.\342\342$\247-\307I\016\333\217\b\030\245\2447v\205m-\333H\303\022d-\312\336\261=\021\242\026\314\361#\333z\301\324~ZV\274\267\035[Y\237\307k\343\242\"9g9Mr\316r\230\364\370"
+	.string	"\314\n\317\215IN\032\364\313\021 i9Kv\2645\205\t2\201\240*o\013\032K$*I\0240Y\237\247\310\376s\240C1\031L\341B\304\f'i\316\254oH\326AI9d9e9dS<566\032\343\2253\346\225#\206\233\320"
+	.ascii	"\240\314\024!o\323W\nJ,'\354\215\307{$,\007\354D\030\030\323"
+	.ascii	" \016 \214>\275\251\234/6\306\223\030\031 Y\177E\337\376s\224"
+	.ascii	"\340t\001\233x\335\251%1{\225x\034!\371\371\b\253\273\352\321"
+	.ascii	"%l\363K\263#L\213\213(d\204\035D\360\266p\320\200o\216p\231>"
+	.ascii	"q\224\316\204\2611\222u\020SV\216VV\316\021\314\001\026\246'"
+	.ascii	"\256i\316\221!T\234\2176)Y\177E\230\375\347\030\021\336\261|"
+	.ascii	"h\230Hqj\032\276oFzY\3770\345\f\311!\2223d\210\204\202R\224\215"
+	.ascii	"_9!9X9B\232v<q}\035\331?;\200\344\004\001B\034\363\373\300\315"
+	.ascii	"^\324~\001I\216\217\234\0379>\204wrEV$\355\037\243\034\253\234"
+	.ascii	"\253\034\253!\322/\215\007\275!H\273\375\347T\375\300\33071<"
+	.ascii	"rP\375\314\210]\314\246\324\364\300q\222\321\003O\217\007\332"
+	.ascii	"\214\266%\034Y\257Q\324\230Msv\f\3134R\226\227)9:\206aC\035^"
+	.ascii	"v\264\311\3111T\262\303M\024\233\034\251!\227\226\262*\003\313"
+	.ascii	"\3011<\322\343\314\\\024\220F\361N\351\013\224\033\300)\035w"
+	.ascii	"V\220\344@\001\221X\247,/^Z61$JO\303\037\353\225\252,eN\303*"
+	.ascii	"\265/jM\231\246)\342\027\024'gLR\032o\210\223\227\2541\021\222"
+	.ascii	"\234\244\234\0329I9K\330"
+	.ascii	"C\325\373>_\243/zl\230\322\221\275\034\031\317Y\312Q\202\202"
+	.ascii	"y\202\311Q\312\241\241\204n\f_\\\313\004\fo-gF\0137\264\"\203"
+	.ascii	"J\223)\373\317\211Q\304\222\311\306\230\274HC(\341\0312/20\200"
+	.ascii	"@\232pW\240\034\005o\020\301H\367\236\030\001\251v\024\214\263"
+	.ascii	"\034EE8\235c\n\025+\242!\221 c_r\336\341\220$zI\226\262\306F"
+	.ascii	"\257\033c\237\033#\337s\212\336\327\350}{\0309\200\024\024\007"
+	.ascii	"\2771\357F\2767C\270\374\360zc\334\363\361\203\350\212\0254\254"
+	.ascii	"\254\213Qo\337(+\242\265\2054\333\277q\372\313\363:\373\201\224"
+	.ascii	"\333g\033c\213\336\215\254\265Q\026\033Sk\212L\212\322\351\232"
+	.ascii	"45\3053=\335+\373\221\246H\226\241\270q\312CSt{Y7&\263&g\204"
+	.ascii	"{\30412"
+	.string	"\200\234\221\006\241\204Mh\266\350\231Y\222\351\320\244\250\301\303\211R\343\242$\3612\226\t\352x\367\234\264N\311H\006'\353m\353x\210\311qg\264\273+\222\021\2275\021*F\246\254d-\227\206\371\372\332\312h\214\221)=\337\027:\266\364lk\262\367\305\2121\313\bHM?\246%LK\214h# 5\375h\324%1\341\223\032\275\030\301\030\303\030\305\030\267\030\343\214u\3061F:\343\027\343\234Q\213Q\316\310\005G\215]p\260n\2043Vqb\\\253\222g\354b\2142u3R\351`\224dB\n\317l\206\324\330\305\310f\204\342f\314\330\305\b5\242\251\320\255\367\375\241\305>M\025\201\002N\353\274<Y\240\215X\270\224\306\304\262>R\306>\216\032\257\004\261\300\261\021ae}\027\370\266\206\342\r\354\325p\006\3667R1NQ;#c\247\271\302D\3212\276\031\245\260euXY\262\276\013e\366]"
+	.ascii	"\263\357B\334\216\3728\363\304\3306\005FLF\326w\301m\337\005"
+	.ascii	"\266\rF\366\245/kc\324\250F#\315\017\272\254\357\002\331\276"
+	.ascii	"\013I\366]0\262\357\002\325\276\013O\373.\310\330\277\021\315"
+	.ascii	"x\266>\265\320\312\314\025\205|buVY\337\205w\377\230f\377\bf"
+	.ascii	"\377\210e\377\330&"
+	.string	"F$\272\362%\327\224u\b\322x\031\303\214^F0\3746A\371\272\021LH\306T&\030eGDz\227\365\217b\3737*\301\261\"2\004\306U\326F$D.a\300\210\311\372G\257\375\033\273\212S\272\037EG\270\206o1\246\262\300em\3242>\3773\037HA\253\326*R\251\037Y\037\377\f\033\002\3743\354q\324xd\210T\002\032% \306\254\342\335\221\264\2730Y_=\202V\245\265\031\205\3510\026\001B\301a\003L]\326F,5\004}}}}{\357[d\304\312F\"\306!7b\275\330\212\371J*b5t\213\341b\246\305\030\244\370F*$\212\033#\220(\223\021$\306\037@2(H|>\350\244\264\231\233+\"j\363\236,\355\310\032\272\252\315\005\2413V\t\263L\263|\221\221\365\022F\017#U\017M\264S\250\371\330\277\221G\220.O\314\212M\326\370\245a\334a\2342\356\b\332\241"
+	.string	"\"z\\\332\277Q\307Z\307\216y\275w9\2025:\230\006A\313:\033\301@#N\242\214e\035vYE\214QF\250m\346\b\021;\343\r|\367\346\350\351&\353l\004W\275/fB\243q\306FPi\310\024\257\031Y\2678c\\2>\031\227\214N\036\216\226\244M7:\341-A\313\313\332\310d"
+	.ascii	"3k\226dm\254\241\201\351\376\215JB\246%:\3300\321\300S\230<\256"
+	.ascii	"L\263\036\276Y\314\354d\030\217\302\264\350t@\2218\371\002c\214"
+	.ascii	"\001\243\311\024\312\023R\360I\002jdU\2140\2123t\030M]\311:\033"
+	.ascii	"\301z>\236W\262~!\005g\317h\204\263g,\372\275Mh<\200\3610\022"
+	.ascii	"\335X\004<\223we)k\343\253\366\251s4h\264\341\364\311\335\315"
+	.ascii	"x\313\032\207\257K\2275\244\254\257\001\272\215\363F\003S"
+	.string	"\366\217\243\207\331X\0340\364\330\362\204N\204[\356\330$q#\\\022\227\026\343kZ\\b\225\246\220y\265)6\t \206\222\033\233\246 \032/E_k\210m\300\230\334\310\313\032\252\2665\343*.\r\016\032\247\351\215+Y\343 \230)l\276\234)B\241\031#r\205c\3468R4QV;\262\306)\203\203\347\365\\\033\2235^\027\231\267\262\254q\356p\310`=\243S\362\245MS$S;\034\273\"\0201\275 8c\264z\\\231R\022SD\342\2055\355\313\032j\246\210\222+08_\354\246T?\262\376Is\225\234\01670/h\332XyC\252#\352\35142n\336\320\005\355V4:\270\254t\331Q\2749\032s\323\033`<\202d\275\275\266\204\350e\r]\323\241E\310\226\240\032\341\336\0233}Z\210c\212b\252\200(\305\005\211P\352\310\340e!\342\251t?\270\222`\tF\r\313\344\250D\257"
+	.ascii	"q\024\301\004)\343b\345\354\307\333\227*@& "
+	.string	"?\340\200OA\230\254\335\240\222\304\204\311V\323\024(\341;\027\204\356\355\025\372h\032\003D\n\260\307\321i\353\213\033\360\306p\215\235\217\030Q~{\3010M\264D\241\360\320k\274l\261\361D*\b\243I\013\2146`\321z\226\304f\215-(\325&\005\305\310\332\027Z\f\0346\262\346\211RSs\2032\313\373\302J\256\236h5\331<MM\232\250O\235\375\222-\021\223\276\257\024\007\233I\0213|Y_\003Y\233\347(-M\r\313\204\204\315K\326\327@\324^\301\346\354\f\007M\247\212\210M\373\004e\226\367\005\004\355\211\203F\3674\346\315\372\031\230\356\025edd8fS(\263\274\257\240\021\033zWe\3071k\233B\345\225\271f<M\351Q\267WP\021\023\253\"\354\022\333B\223\3653\260\266W|\201\035L}b\034\250Q]\3263\253\tS\027%{\005\227\227\227\372\324\251\"b\303ra\373\334@\223"
+	.string	"\331+n$I\"\2052\313\233\376\264\246\306\366\262~\006\240\366\n\253\255-\234\256)\0161\267\254#\r\027\"\\\307\351\342C:\303v\345\377\357\003\273\"G\262~\006\226\366\n\031ZZC\244=(\263<)\257-6\262>\006\246\233\305\027 @p\262\250\332)\034a\232\364\226*)3p\204\034'\013\307\b\025\2437:\034#8E\324+5\342\212dMD\353`\243\202%\353c`\312\306\031\202\203%\354\001DG\230\254\217\201&\033'\bf\373y\t3\206\005\024>\351\322\344\311V\223\350\2504\345\215\326F\351\204Q\220\005J\022t\3129ETD\006\001c\025"
+	.string	"0H@\036\220H\224aV=\024"
+	.string	"\013T\310\224pP\246\315\243,\251\024C\0020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201"
+	.string	"\002\036\221;\nw2>\266:\317\371\022 ^R\246\303\273\022\005G\224\275\r\022\357\315\360\370\311\356\347\264\221gFL{\225\314\003\356\340]D{[\231\305\224\021\267\365\267\364w\306SD65v,\225\f\334L-\222*\021\351\032ez\366n\220\247\271\003\331\300\204\334\340\233\2426nn\326\304\230jl\345-"
+	.string	"\210!\257o\315\200\002\316\233K\177\265\210\233\032:@\347@wd\2434\257c7BXM\364\267\245\n\030\357T\003F3\261}\267.\305D~T\204\335(\373\0366\"\312z\035\311\243\t\376\305\2141\201\330\315\216\372\272\244\367\277BBU\200e\021\263\033\f\324\305\r\031\263\351m\233+\257\335\226\033"
+	.string	"!\207\370\373\264\360\333Jn\037\001\245\271"
+	.ascii	"\233I\270\225\037\351=\376\246\026\005\217\241&\304M\211\303"
+	.ascii	"\005Rq\264K\245R\250\335[b\031 \313S\352\356)\375h8\023r\346"
+	.ascii	"\225\374\266\035\337\325\372qJ>\rF\306,\371.|\234\305\001\210"
+	.ascii	"\220\rv\034\267\230\225}\306\022\244!\326\267\322\321x\311\211"
+	.ascii	"\315@\366==\261\034\320\266\377\223\315KX\333\\\220\027\241"
+	.string	"\226\341\375q6j\314\314\355\222_\366\320\017;\240\276;\264\277\"\242\356V\315n\263\374a\262\364\320\312\250\314\232@\023\270\272\003F;\327\223\342p\036\337\352\355Jl\365\237\\0/\366\320F\021\376w\271\f\361\333l\\-JC\344\200{\\\317\350\302o=H\006\372\206\332#\354|\371)\007\252\251$\375\217\252+\n*\245Q\2571T\311\205O\247\355W\003.\327\223\202\016\006\252\3702\323H*K\002\375\225B[\344\261=Eys\332(Y\002K\346\210\241\263#\177D\004Is\016\367\246\003/1\3062\340I{\353\342cd\267\237e\023\007B1\023\245\273\247d/5fsP\273\263\306\352\326\365\310\211C\232v\252\367\\\352\310\022\235b,\222K\325\020\n\215\310J)\240\357F\353!\n\225\370\225\346Tw\206-X\320\271\312\240\350\2252\030\002\2213\320\233a\007\245\nB\276h\004\307.Z (w"
+	.string	"3\360\277\251\257\026\325\2733\244\017\002\333\253^$[%\312\024\237T\265E\240)\320o\314g\"O\313)n\230\220-L\223\206\306i\335 ~\351_\353WYQ%t\3742\244OW\351\241\272\245\254g\374\306\277\353q\224\276\266\225\315zTY\020\302\220\310??\214\306wQf\374\313aRx\027\377\354\277\\5\332\363\351\252}\266*\242\314i\332k\310\n\200?\322\243\276?7\035\321\305r/\n\"\354\226\036]5^\n\r\265c_\005\"\331\207W\276\035t]\340\311\341\004\206\215F"
+	.string	"]\027\025L\200\255\316h\271\213+\2365x\245t\2759fwu\337/%\334\320"
+	.string	"\316h\355\242A\3241\215\277\021F\367\222\242\300`d\361\234"
+	.string	"\r\340dr\205\363u\301\\\221\356\3237\177`)\323\303\222\223\273q-\\k\260\203\253\022\032+W\236\210\265\0022!\311b;\025\224\022\215\246\310]/\330\271\257\265cL\232i\317\263a%\362\\\025\254\273\320\377\325\243\340\224\005\311\356\347e\227K\255T\361\236}!\350\211\355S\023ea\312\325\251~\252\n\223odc\276\311\350Lx\210XH,\225\271r)\366\267\324@\230{~\235-\317W\335q~\300\013~\247K\005\336\271N\274Q\343r\242\336\215\256\2171&SR\201\273\355\342\024\023\276\006\026\213^\207&G=F %Q\340\334b\275\332c\001\240n\220\217\365\274c\315{\2466\313[Cl\316Fs\237\230\3419\221\300es\366<\314(\352\220n<m\306\207\034\f\364D"
+	.string	"Y\241\3633\304\207\275/\323\365x\272\004\023\221\233\002\020jU\020\334\362\r\034vE\215C\300\275\324+h\241\"\370\364\262%\317\341s(\321\026\324k\"\370\3670$\372\260\261\257\017\027\017Tl\235\255L\006\207\244\203\237\256\322\260\037\256;\246\241[\252\3074\027\324\337(\320\fT\335<\320"
+	.ascii	"\216\333\354\254-\177\250<\027:s^\346\340\375\247\327\005\215"
+	.ascii	"\346R\001\031\272\355\314\274>\210m\234\223\300n!\2566&\252\320"
+	.ascii	"o\213@\265\324P\006\322f\030]\276rNn\030\336\246\034\f\377\016"
+	.ascii	"\360\270\270\f\214]\324\275\330\f\261l\300v&?\313\026\317"
+	.string	"B\373\220J\005\354YECNQ\223\037\3172\361\006\245\357]\215\311P\301\240\314$\317\361pu\330R\213y\320\236CLQ\271\006p\003\346\267:\277\336\353\274\t\213E\334?\006\007\331\255EU\026\300`2\373\354e\2614z\354F\356\206V\322\013\"\327\034\007O=\342\226g\247\234\320\366\032\021Nz\020.\"k@\256\363\372\365\245\250\300\375C\002'\312\257\255\313xV\224\2744P_*\264*\357QY\203\340\t1\031T\341D\035\376\307\323W\214knN\343\f@\027\3519l\223\342\b\235\262K\233\262K\206\206\270\216\323\244\211(:\022\25318ex\022\252,<,ed\201\217\355u\351b\016\002\214\245\223\355|\272B\261\375\275\025\322\344\260_d\016T6\200e*h\231%^\275\245\210\222\372\034\377\314\305M\245'\374\t\336\270e\370'\0052\245\034?>e(5\"\213c+\026\006\016\203\307>"
+	.string	"O\333\270\247\247\321\301j\"~\371\003\024\374:\324\376\211\224\350y\257\025_j\347B\206:Y=c\350K\240In\352\261\021|it\3769\252c\024\004\362\352r\2628\362j\343\177\356\307{\262\274\271\332\377\275\347\377xB\341NU9G\276\\4z\017\251+pr\371\367 \247\353\215\r\r\205\255\260F\025\376\013\200\b#lYo2\225|0.\300-2\0346/Z\250\243\f\206M\201\334\\W\257\03091\356F\037\335\312\254\361 ?\235\235\n\367IA\030\210e\363#\210A\331\330\357!@\344k\226')\332\212\260\024^\205\241\026\005\321\351\337\246\210H\363C\262\335\3608\372\222\0252x\b\334"
+	.string	"\2642K;\031\212<\274\006\370\326\367\230[\253\357g\241\327\317\263\r!\267\006V\273\264&\\\251\024#\257\245@C\303\252\200;"
+	.string	"\360,a3a\"\"\366\202'\030\275\343v\376\221\202UQ\372\325^\001|\025c\251\317\353\206\032\215Q\317 &\232\276U|\343r\362\324*>\024Hm\217\327\031r\n}MyC\341<\336\204tg~\300k\030\013L\351\007_\222\001\322H\025\bB\r=\323\212\"\353%4\2178.\267\210X\245<*\336\374m\320 `\270\3158p\341\232\033\214\270\033\004\240\317\251f\243\264\3161\314\005\n\200\332\233\021\356\215\323d\247g..\235Z+\207\227\222\367\017_\352,\024M\247F\253\td\210\351\227uSf\353\233|\370\335\3135m{\315\273\323*\337\251\207e\313\031D\367\214'\004\337"
+	.ascii	"\217\t\343\206\272\213\373\215\305c\372\346(\272\217\001\005"
+	.ascii	"\b\216V\336Zx\352~\372\247\255\252\375$F\202\205\256\276P\237"
+	.ascii	"\242|\265X(\b\213\257(\020\260\031\002z@\226\377\030-V\315\205"
+	.ascii	"-\\\337\\\372.\351\360\\\242\321\272\3256\321\201\275q\260\270"
+	.ascii	"\004\245(\330f\333J\022\364\357\222\f\004-\342\216X\324H_\202"
+	.ascii	"m\254\013~\363\320\2057\004\035\334:S\246\217\206\300\310\243"
+	.ascii	"\333\0225\220\351\270\374\231?\354$\013\377\375\246\255\222\330"
+	.ascii	"62\351\356\t\371\356\337\261\003\335@\f\272\211\024>\253\307"
+	.ascii	"\021}\3053\225C\177\r\021\303\017e,\240)\350\330xPXqR\342Kv\257"
+	.ascii	"\373\260\006\234\250n6\253\300A\301\031]z\267\321\372\b\247C"
+	.ascii	"\231GJ\004\204\233\250\364ye\337\317\255\327\202\217\370\345"
+	.ascii	"P)\204\200\215\225\237\237}\2047(\3550v\257\213\333\316\3621"
+	.ascii	"f\350\243;\323\232\355\256\035pQ|g\207\222\261\276:\364\376\345"
+	.ascii	"\001F\020a\202%u\004D\027@ \273\237\307H\003\266W=\332\200\355"
+	.ascii	"M*\307\253\255\036\264\033\204U\024:\227\021\031\0014o}\256O"
+	.ascii	"\013\201\341\177 \344\275\204\207\r\241\350\302=uT\203V\335!"
+	.ascii	"\247\3475\300>NL\272\241IA\335i\253\2640\340\206\020+\\\217\026"
+	.ascii	"\272-Z\270"
+	.ascii	"\323J-],i5\234\241\320\354\366\226B\037\327\371\232L*6\322\273"
+	.ascii	"^\234\336\022!\362\212\206\264I!$_J\223(\372\244\221a\222Em\304"
+	.ascii	"\250c1\262\365.\344A\372\341\365\216q\026\221\322\251\377\354"
+	.ascii	"\353\335Js\212\274R\322\177\364\364![\206\224\032d\215\326\352"
+	.ascii	"\033\366\004\327\223\326\214C\317\035\300\nq\3516\001\226PN&"
+	.ascii	"\b\027\213\212\\\026\274\310\330E\326`\211`\330\022\204\264,"
+	.ascii	"\301ufK\220\353s\324\b\335U\2002\353\357\323\227\371\336\205"
+	.ascii	"\027\316*\256|\212O-\035\b\350\262\330\235ae&\033\330\270"
+	.string	"\234oU\007\030\326\177\245I\256N\204\236\027\n\fOx\373)}l\264\242q\220\250\336\253\007\304\236d\210\222\377q+\364h\337\202\341\243\023\361\003\353\370\341h\0322\323t*\3127\251\023\221Zq\221\300\2364\\BIW\235\324\343\341\210\337\344\374\034T\227\021%\004+\372P3*<m?\016((bd\003\312\002\355\214,O\223\314GS\343\241\313R\337\206\264V\273E\003\305s\232\0354\270@\230\203\227\212\344(\250\024 \256\300\231\356\244$\034\311p\026\203\341m'\032\031\001D\333?\277\251*p\332v\323\316)'p\352'C\340?\240p\364\030o\350\226\b7\324\310\2064\016\237\327q\024N\251\235g1\240\332>i\326\211\326\242W\262\036\033\360S\215\0249\017~\024\373\231\231e\213J)\227\244 \031\030\216\253\031kN\023\333\244\301\221\302\371rFm\343\177!\252\r\013\r\245\335o\031H\323m"
+	.string	"\331\245:h\257i\030a\242?D\377z 1\215\337/\346\322\361\317\351\251\342\3407\360@\332\265\312\035\305,w\025\025\264"
+	.string	"\347\236y\277<\242,\315\206\035\027\320e\272?\307\335M~\001\312\201\371\264M@\346a\023\274`QY\301\317~\304"
+	.string	"q\003\025\217\340\tyT\243\231\322~\334\277\033}\373hoNr\343\227m\007P\271\310\251\323\263 \344S\214\213\346o\177\215\376#\305\031)dA\316\361\226\3250\300\3455\027_,\314\226\366FHB\311_\344Z\236\220\"\273\360\223\246\231\364z_J\237\214"
+	.ascii	"\335\242\215\023)\342y\306\336\243Wq\247\347\332\f{\216\203 "
+	.ascii	"x\317\257D\226wZ{\347\354\311\003L7\3353Q\205\271\262 oq\007"
+	.ascii	"n\332\035"
+	.string	"\363\313CB\225\360}\3026H\034\3353\210\333\271\034\016Qp\215\220\"\"\210\003\345\344\205\310\221\023\260\205\263\374N!\262\365.]\271\217+\177Y\327\205\374uK\255\362\370F\316c\356\235\343\322?\250Fp\244\310)\334|\264\305W\354\304*\373\2048Z\377\274c\365H\370P\372f\315\305\237\332!s|\247\305\\\332\213\"\266^,\204\313\307 \272\357#a\331\351\356rm~!\001\255\372s\2628\353\346T\227Ht\340@o}8\231\273\245\003E\\\3209}\270\255[\236\320\037smw\307\221\223\234\0264\216\214\354\254\037\311C<p;\303\200\245a\375\350\036wJ)\234\251\b\266\"\216\030\234cy\2563\332a&\317j\242\312\265C\3235\311\265tr\n\031*\020\236\351\376CJ'\032\022\241i\206\025A|\0331\004+\3529\217\207\302\037w\230q\345s\262L\373\001\231y\251\226\363\374\027o\303k"
+	.string	"}\302\300\371\247\305\3020\363\025:?\301%\211\351T\246\313\235\005Y\025\271\030t\321\2540\235TY.i\227\237\302\007\346\223!\267R\246_\241EE\335@i\206\022\307\366w\033x\001_\027y\324I\220\177\275+\r\200\206%\240u\3651\275\343\260\250\032\207\300H\250\275\3716\203\262v\373Q\033_\365\031\253\b\354\357 G1HQ\327\006\203\256\210\360T\2530\231\301\307\2004\251\204\321\003\211[\b\353i\031\231=x\016\2056\323\345\254f\033yEw+\253\275\037\222e\216\262\351\376m\276IF\360(\215i\035\260\275\273\261\270\206[\0328h\213<\202\222b\341"
+	.string	"f\260*\\\311\351\275Kn7]\017S\335.\216\023\246\216\203,\333\207\307\t\246\312C"
+	.string	"\016\245D\332\347\354\351j\177\344\b\204\tOQ\b\225\272\003\267\325|D\241\\\376\313\335\017\021\336}9\357\234\007\210_\262\001\204\224\245I\237\t\214\215\206\2460y\303\236iL1\240\346\341,J\022\227\351y`#\330\023\no\002N\250h\306<Y\224=\272\031\307\327\005UI}\377\240@|\204\361\233&;[h\206\344\341\312\307\257\246\321\310s\302-i\b\231\020\202pr9V\022\244m\034tT\3728\304\307\377\331\033\322]\227\217C\276\3212a\366\260R\204\300\217\026\240J\254\262\271\323\246\310@\335Qm6uRS\344\311(\r\034\237U\202\022\003NL\253\220\364\316\355\340\024~h\234\214\347gp\3361\210\3173\265\032T7y\323\205\260,\262P\262m\234b\353\241Y\250!!\374?\352\341kmT\330>"
+	.string	"\023\311FJ\n\003@\023u\373_\376Q\n\033\354\232\361\001\332\016\367\224\206\202~|\271\024\235>\031\3511#f\t\362%\223{\375\256\223M\255}\331\247e\024v\331g\310\352\206f_\253z\b\257`6\377\253\234K\243>X4lSA\255j\273H\333q\310'\353\342U\334\017g\222t\032\265\351P+\321\260j\377G\352\255W\367\371?r)3y\207\237\371,>\232L\377$n6\373O\242\030\342\201\272\265\243\b\207Hy\037W2\202_4\272\360\253\363'\032\002`>"
+	.string	"3\021\232E\034d:\037C\341K\355\016\205\264\374\264}\226/Z\201\025\202[L\224\2228\027\375\005P+"
+	.string	"\3011\271,p\226\344@\223\025\230\t\201*\365s: \225W\344\023~\3451\r{\362r\312\\\374\001u\264\217`Q2Ax\332D\250\314\312W\253REb<\023(z\377\276E\251\336\230\264&\301\372`\023\266Y\210\232\350\006Y\232\027Ba-\232\225\252\214\253\323\032\3566\265W\2676\234\350\036\264\007\200%U\037 \247\263^[\177\n\n:\312\322\3774}Qd\373\223%\353\302\206$=\t\\\276\t\221f\221\3631zThJ\265c\361\032\036\257k\005.a\312\203k\301)\3170\311\001r\031\214/0\241\264r\3202\b\025\027IK\003:\306b\361\022HhxM\340\263\325-Vo\3022\315\273`\355\327\332*%\374\005\273\247"
+	.string	"T?\201\336\373\260^\350\275{P$)\370\371460\206w\356\241\\lS\t\216M\257\fuH\334\323\342+\237\271z\371\245\216\272\221\341\351\0210qs\206\257\344\237Tf,$\226\177\254\257\027\353\267\320\344#:$0\262\213m&h\225<"
+	.string	"\202\025S_\030t\320H\261\360\036\366Td\272\035m\256\273\001\3035&\261\3222\202\272'\201\316\250\016\306\225\246^EJM.\225\244BI\216b\032\305\362~W{\320_\324\373zzI\0346\b\255\021\367oxsx\0131{\327C6\202\246\242EE\021X#aK\373e\305P\346\303\313q\263Vl\323;\265K\274e\0368o\231t21\350&'\356\212\360c<\225Ha\241\226<\342\f\r\305!,H\261\017#\3520,\251\325\0228\203\337\220\375\202f6\0367\261;\332M@\335\360%&c\355o\025\037p\177\266"
+	.string	"\003\232\260\nJW\2521Pcx\377\"\306x\b;\227\037P\204#\345w\221&\262\313Q\207\207\213"
+	.ascii	"$\251m+^\201"
+	.ascii	"\030\357y\3018\201\034\200+\r\003\"\302\024\301\375\311<H\020"
+	.ascii	"\215w\260m\351j\026\313\034\275\217X\b\033W\352B\376\363o3\261"
+	.ascii	"Y\020\tz\262-\0054\210\317\021\236*\t\231+&\371U\213\002Y\377"
+	.ascii	",`5\256\024\260\031\006\367\346\276\264u\340\333hI-8\215\n\360"
+	.ascii	"\364\206l(F\346\025\300*\203\034\334\020N\370\316\205\274I\237"
+	.ascii	"0\026\030d\343\331\223I\302\342{H\030\316\232\025\tj$"
+	.string	"\272\356\245\217\321k\223\336i$3\255\3040\220\013\034\t\372I\003\235>\30141\321x \271\262m.\361\306\316w\016(^tO|N\002\035P\321\016\207\215BM\272\225p\323:e\306\310\361\235\317t\355\317\2166\2073\224\2028M\216w/:\346V\215!\366\316*9iQ\343]lW!\032\277#[\217\020\252z-\2427\216\314\007ijK\342\r+\367\356\350;GFa@\f\300f\207@;Z\247\"\n\351hY\231s\370\323U\225\372P\243Z3,5\r-\256\302\3439\370\334a\007=`\243\341\304\264:g\217C\361\245\275\b\024\243\327\3417\263\3238\217\206m\346j\200V\203\314x'C\256\023T\235r\021\260\203\001o\345\222t\313@\335uiH\300\2505\306\244#\325\200(\313\004\022\263\232\301\3208\224\030\205T\340\223\212\216G=Ak\222\320\210\027\320\356\022\016\345\177X\374;;\260\001"
+	.ascii	"\013\002\347\207\203-\351\020\247E\246\2603\240\204}\221:\\\241"
+	.ascii	"\321\211\0055o\225fz*\220\254L\022\031\225\006`\306N\320]\217"
+	.ascii	"\265\\(,e\351uP\344\353Q\236\205\311HE\327\\3i\241\274\307"
+	.string	"W\233\254\273-\3511z\355\255\3645{/\263\341\276\n\351\247\223L\300\024\202\357\315{\343\213\310\0327\360WQJ]\250\264SHeJ\313\330\240\314\251\242S'^\0131mxCy\231\347h\211z\323\275\272 (\361\357\204\376\020\316QmL\222\330D\266\247\026\025\241\326\316\037\222\030\n\250\023\353#\355F\b\257^\177\326\371\240\215\276\237`\025\313/\342r\004\265~J=so\224=\337]\340\201\341K\240\324\336\270\3256\245$)\005\305\245\365&\242\313\0052\016\260\274*)\001lNS\013\300\340\327-\307X\333\nn&Rga^\236\3329\002\252d\366k\b\203\351:Y\313U\334\214\020J\312o\001\033*n4\037w\200vy\222W\210\251\361\304.\343\2768\333\026Q\231swd\314\227\352\275.RN\261\364m\272\007z1\245\222\332G.\346\321[\3141\"R\330\214\330g$<Hi\026w\312"
+	.ascii	"\232\231\\\201T,\3474t\033V\274\371\233A9\t\351\306\263\"\242"
+	.ascii	"\300\226\313c\034#\316\004u"
+	.string	"\315g\024\006~\351\324\220?\275\270\026Lj\362\016u\210TQ\344\265\2743P\250=\nW\343t\375\334`\273\234\275\362\013/Lm([\361\2155\276\214\253'm(\326y\373\351\256\335uH\037\213\276\347\"\327\315\351\223[\025|`\220;\244'\362\351\352\305\\\013-\363\217P\204\311\362\223|\222\201\334\033$\033\336\0331\257c\263\213\002\373\224z\331\354\220\214\355\357J&8\263E\317\304Y\226\211\374R\202\\G\300#\337o\207P\206\274\330\301e\321B\022N\tr\361Q\002\fWDK\356\354LCJ\3228\006[Ek\237#\221<\316Et/\341\311\363#\207\246\243(\201\214\324tP\n3\270\254|\235].\215\275\233,\026\257\310\316\354\221\340\262\016%^5zm\233m\361\233\001\246\355p\376N%^c\250#l(\364\207\322`2z(\271#~wv \354#\212\232\0039]\2771\001\022\372\277"
+	.string	"\343\250\021\230^S\374\260d\334\206\374\245!\n\366\354\316\360\324e\016J\303\256\f\307\365\233%\232\\.\311\212\320) \376\003X\207c\362\006b\351\325\367\341\264\240\030S\271\r\312G\310\002N\274Q1\300\363\372\177R^ \004~\350\270C\324\204\032P^\302\242\362|L\233z_\022l3\207\337\007\236\003\204\312\260\220ThZ\3468\304\322\333\223\002S\t\263\035Y\031\236\310`\306R<\305\251\027\330\367\034 \007\310\307\343\203\005\030\023w\026\021\007\254{\347\245\310\270\200\205\032\271g\232=Y\227\004\220\177\277\005"
+	.string	"\235*\330]\214,Y8\230\377\360\214,B\244\211\206\303\314\255\243\001\030n\311\352\251\245\233\320o\355$\274\275\020\324\036E\253\334|\217\031+\305l\242D\225\037\243\375\034\255A"
+	.string	"?_o\325H\311\345\317\002\274o\241\215\350xx\227\261}\202\t(\304e\255\261Q"
+	.string	"{\t\235[]\304\257F\006c\311\304\275J\327`\315\2125\256\352\353%O\n\245D\342v?&\201\232/\031/\345\322KP\264@g`\257\001\332;*\355,Y\374\fpd\306\002 \177\226\365:u\334\260a\013\364\312l\210\260\2515\356V\016}\362\241"
+	.string	"ByY\305\b\205\017\013~O`\264\"{C\233O\023I\356\340\224<\213\322%gvq\330[\300jt\272\312P\nFi\342\203\336\245\234.\207\363\033:h\220Fd\017\020Hf\261\225N\313H\177\374\253\311Y \200\203\306\242\3672f\2044\324y\334\r\031\"\277\312\177\002"
+	.string	"\327{\323VdJ\267\241\236\\\217\355u\322\267\261\245\005\233\315\207\370\002\236^\362\f\034u\213so\327nlD\342/\221Z\257\356y\344\276.\332e6'\337\355i7(}\002\022\030\322?Z\027\r\352\2471\347\374EL\360\351\376\nj\264`\035\006;T\344"
+	.string	"9u\021\201u\271w%\032V#"
+	.string	"\323\027|\244\235\206\203\024C\215v0\034\362<\021\341$\233\330\355[\021Y\312\314\301O\004\352\240\225\374_1\034\262rB\273\224\227C\032\354L\375\215\037A\037\200$\fs\037j4\340*b\35596\205\203\315\356\301\264c\243\251}\274\264\212\033\225\240\370\221\022D9\332\323<\024\331NP\331\f\341\\ww\244\204\r%WNt\307/\365;\207\360\005\235\025c\232\367&\244*\003}\217\236\025\272~\241Y\001:\006P?\333\304\304ho\311\241%\356\t+\035\027\0252\206.\204\363\363\353J\244\346\301\022\366\276\026\020[k\020\313\035\205\372\230iG\0053\032\301\005\334\263\356\007k\017\300\004\234\024\330\344\360U\346\303\323r3\n\257\316\n\371\227\245[\031\245\331Pru\333~\266\327\206T\360\023\356J#u\206\274\"\221\034\275\333jL\211s\221\260 \240<V=U\330\353"
+	.string	"L\255\347F7\216\256\323f\021x\273l\027\247\003\nE\023`z\272\2429\002V\263!\314.\254\3056\276q.S\002v\035\320\230so\253\016\304\007\234I\024\240x)6\222\200=JT\337\016%aq\301\b\200\3009\207\020E\244\222\027\324\342\226\032\307\037c\031\315(\363\234\3503^\003\201F\202Ek\023\377\220\253\335\2074\321\225\333\312!)\361'\337\242\217\253\223B$%\007\231\313"
+	.ascii	"\031\235|\003\2235|\262L\001m%\025\312\tn\234'\f\300\357\341"
+	.ascii	"\324B\225\341y\202j\241v\036r\301k\357!\377\271\314\3141,\311"
+	.ascii	"@\346wA\222\tb\217u?\005Q8{\013\374\204/\373\246\"Dy\\2\245\236"
+	.ascii	":*^kjR\031\016\027\277\\\204s\227V!\220b\272\270j\026\216~\036"
+	.ascii	"\267\250\375\024`o\271^;\362!tv\203\021\226\3730\360+>Y\222\335"
+	.ascii	"[\205"
+	.ascii	"\362\260\225{\270\345xG\002\372/\277\322Q\357j\214\210\312\276"
+	.ascii	"\336&\263!>\337\376O\354<\305\307\363\"\200\262\032\221\356\237"
+	.ascii	"\256\257\257\"S8N)s\0011\213\241\242\037\367~\332K\035\034\354"
+	.ascii	"\202:\237Z\031\022\020\251\263S\235\350a\372Q\260\323\273!7\210"
+	.ascii	"\330G5\230\353Ph|\b\013>\314t}\177\032\027q\023*mn\024\353\251"
+	.ascii	"\247\247\310\221\233\031\fy\213D\220\2637)\003\343^\355\322d"
+	.ascii	"\356f!"
+	.string	"\321Jm\264\336\315Nr\r\334\021\035\263\341\215\305\300\330\220Vd4/}\267\322\252\023\025?D8Z\005wJ\367\034\\\266\253a<\212!\362\310r\350l\346A\004-\241\266\226\234\tQ(=^\313\313l\313\275\325;\304\034\347\226\237M\352\315\331\262\006\036\326n\260\252\002|\301\364\375*B\327!\253+\330Q\336kZ\243\002\367Po\360\201\367\003\341\263D\261<\346\201\242\264\223+W\025\271\241|\005KI\200C\007\345\352_\375+e\006\342a/*\322\315\360UB\200\001W\002\330H\025\353`l\"\202\272+m`#\263\371\2207+\376\037A\250\322\241\236\272\300\"J\177t\360-z\314\003\202\032,\230i\\\352\327\267@\250\307\007\323\026\002\213\346\275\021 \207\031\212\027^\264\004WY\234\027\2041\261\326\\\216\333\222\333\254s\2450'\242\306u`\335:\"\325\213\026\237\261\016]\361*\004\375\200~\013"
+	.string	"\373"
+	.ascii	"3m\367y\223<`h}\r\250\242\230\356r\224O\327\306\377\331\207\317"
+	.ascii	"}-\206d\272\265\344\200\371Zb\307\357\354\274\362]$5Q\200,\247"
+	.ascii	"z\007\351q\275\3544\177u\367z6tD\223\231k,\336S\222/\363!\312"
+	.ascii	"\030\n\364\205\003rX\327\221\355\023\034\007\335\240\267\354"
+	.ascii	"\272\334.A\270z5\374fw\300\f\033n\366M\330\204\336s\215l~jr\241"
+	.ascii	"\377J\030\370\253\254\200\216\f\271\246x\345\236z\216&\334\360"
+	.ascii	"'}\330\361A\201\342.c\274\270\212\257Y\006;|V\362\016PB\022\221"
+	.ascii	"\322\347\027\025\024\037\363X\001\265\204\005o\251\267x\255\376"
+	.ascii	"\222z\255\353E[\270S)\253ae\036\304\316XG\273S\224G|*\327#\002"
+	.ascii	"\243\315\264/\263\360\215\354\274\227\t7\032\211K?D\251\306\221"
+	.ascii	"\264\326\3044\007\243\310\f\024"
+	.string	"\004A\037J\346\236;!\204\027\341\324\226\343\035a\237\267\212a\025[\351\300\341\226\006\234fm\343'\243\263\336\3157\212\0037\t%\373P\3712\337\354\031xB\333j\254\250<s\355\251u\333r\232\344'\270\364L\366w\3454\204)a\306Xl\031b\034\245\n\2547\203\341\006\315\332\376\266\340*U\207\221 \255W\217\243c\004D\201$\016\t\013\013\266\313\031\237lx@\361\246\303\360\ny@+\002\212\025\324#e2P&JX\375,\247=\204-\377\354w\314\271\030\313\2641\241\270\024\220\275\266Z\304\362\315\340\360\036^\320\275\250\235\375-G\341\335\377\363\342\350\210\254)\346\310\t'\035\001\334]M@\022o\220\013jn\312\0020\275\206\3334\370\365N\202\2436e\236^G\373\005\023\242\020m\022<\021\236\021\024\252\f\325(0Y>\302\200E\\\354d!\002\367\333\223\210x%\213B\317\202\325\364<\370"
+	.string	"\303H\217\005\250\361Z\2703`\032\275\366*\235\265\b\\v\033\332\"\266\3111\240\342a`\351\356\260~\n\341\324\203q\215=T_\223\2671*\233d\3612\t\034\307\001\022F\270\r\234\324a\371\352q\374A\330\233\3576\b\\\001EskitA7\310-1o\303F\277el\217\347\027 s\026*mI%\324\223\017;\241\224x<\200\344\250\303'\320`\315;\003"
+	.string	"_"
+	.ascii	"\253\257\231\274lz\250\206\350\nc.\311\231\340\254-\260\357\321"
+	.ascii	"\227\016p\344\367\213\255\241\2777\255w\372kHUP\f\306\036\244"
+	.ascii	"\200\207{\203\351\3006\025\2105\026\360\311\341\030B\245\315"
+	.ascii	"\305\207\021\247\206\220\217\205\252C=\374\345\257\236\230\313"
+	.ascii	"\231\013\245\376\257g D\320\274\177\201\267\250\212K\376\373"
+	.ascii	"9\f\030\353\327(:?\220^k\334\232\016urS\201}w\205 \017%#vR\333"
+	.ascii	"Fa,\305\240;F\312\t\254\271\217\360m\243\341@\002\252\021+\227"
+	.ascii	"tEG\275bO\242\377{\304d\35556Eq\360\255\251\213\272zu\242\243"
+	.ascii	"\006\\.m\031\024\231`\310\030D\335\253U\277\020zm\211\001:m^"
+	.ascii	"\251/S\334\b\205?\1775&\266\327=\202\250\223d\007%\032\214\001"
+	.ascii	"Gwp\241R\332\032l]\374\300U\271\213\301\275`\326\020wO@\321\344"
+	.ascii	"\302V,\240\366\332\003>\226\376\003\344\312s\207\224\340\372"
+	.ascii	"\342K<\332\241\255\024\341HJz\205H\376\231\277\226Vy\321\325"
+	.ascii	"\336\321\377\255\263\316k\\Q\350\301&\343Z\365xl\216\222!\353"
+	.ascii	"\204\276\317\035\315/\220v\3447>\350\037\035nreJ\nk\262j\344"
+	.ascii	"\032\340\322n\223\372\033\022\372\332U\272q\300\037\301\224n"
+	.ascii	"\374\307\026\337_i\357\035\333\244\307)*\243\274\036g\352\032"
+	.ascii	"$\371\267:8\364\023\245\2136aX\200\272\276\363\002\202N\213E"
+	.ascii	"\342K\373n+\210\243Je\214\336c!r\206}\265\307\311\321!%\312("
+	.ascii	"\\\372\023\375\236\367A\020\005\033\225k\270]E\266\321\324\350"
+	.ascii	"\267\266\033_\321&\346b\367\230\250\233x\264\2603\343*\317"
+	.string	"G\262\267\264\227\3303~\210V\227\255^\245>\203\216\353<^\353\035\034\004\004\336\262Q\375\332y\035\216\270W\314\025h\026\2638\344=\343\004 \224s\374K\3461\315\030\221\340\210\005V\341&Qr\304\261\373I\255\235f\"\2621\336H\361\310{\205\345\330\\\302\224$bW'\266\245!\377\277\245l\362\013~h}b>T\307v\302\253JIW\220>\020\004\017\261\031\017a)\3634\353s\240\274\213~j\236f{\205M>\"\370\264\213'9\200\252\202|\345\033N\211[\277\375\250\n\244\352\333\350IS (D\221q\310~48\307\264\"\007\213\324\260\207|\2713_\211\033\217\376&\235\024,3\236;v0p\376Z\344\023o\327\327y\024M\334n\213N\275\037\245\251\327\270uLf/\334\004\375\342r\304\rq\235S[\360\301#\226h\236W\332X\212\311\261\fO\030\214%\225\222-\003\356\321\211\365N"
+	.string	"\265(,[\017\274+\337-\3038\214\245\002\334$\033Y\240q#\233\226\366\377\340\230\225\334\0136\356\222;.\3059\364\001E\224\035<\364n\030=$\316'[\302IXN6\264\t\274\374\234\362v\277\tU\364\245\227\031\327\317s\307\247\345\211\274\036|\271\321#\220\243S\205\272\233\242]\217\366B\303\005\034\341U('\355p"
+	.string	"%\304b\206\260\307D\311\210A\332\337\307\341\347\035t\332Y\242\2470\305\367\272\t\350\263\225\204\354\364\337\242\246\274\216T\303\2330\213\266\215s\350\037\3247\214\270\017\2532&\226M\227\b\225\343)7Oa\361\351Q\344\251\253N0\262%\311)51!a\362\0037i+I\032si\310\026{r\\\275\361\337\372\n\307\"u\375\2627\257H\214\360Ln$\367\236B\200\371\213"
+	.string	"\035\252KW\265fmLQ\004\222\370\201\b\216\006(\235EN07W9\231\360"
+	.string	"\307d\367\200\256\032\006f>\200}\364\r\372~\342\252%\261\0047\242u\342\337\311\261\227\336\356\262:\332O\352\261A\036J\003/\\DZs\323\241\216\021\320\227\365\250"
+	.ascii	"\377\256\327\027\032\210\205\035R\375\207\3775t[\273\326M\217"
+	.ascii	"\035p\210\371\216A\216,eA)\231;'\266\360\235\300z\200\017\273"
+	.ascii	"\2118\005\314\r\337\013\276kZ\310\177\007yu\370\243\335\376\016"
+	.ascii	"\023{k2\017\355\230C\335\bF\330b\317pZs\036DrR\b`\017A\362\302"
+	.ascii	"m\033\004\302\201\215c\216W[f\314\303kD\230\034,\r\377W\224y"
+	.ascii	"\026+\361\214\006\311@H\026d\363\355\377\215\031e\203d=\355h"
+	.ascii	"R\240\017\252g\031\243>\325\3572#"
+	.string	"\242\204\217\330O}\221\373\235\323\031[\312\361\201\326\315\236\213\370\033\346O\325\270\361\352\236{x\347\256\031\336\233\207\256\310\353xtn\3056\26315\002rV\337r\036QC\377\314>\204\246LI8\350\217o\200\225\f\256\320\237\203\345\250\001\346\305\347\360\301\234\242~1\343\025\313\274r\305\204@\270\266\361\234\355\301!\"\271\227\177\030\237nJe8\337<5\"\371pv`=)\315\037r\217xZ\375\246f.\004fs\357p\377h\212\265-\266\005\317\004p.\246\366\f\3465RO\021\315\340\"\252X\364\320\374\355l\273o\027S\320l\265k\322E>\\eo$\316=K\030\"\336\362\377G\314\327\3468\245/\260I\025X\272$\3000a\360\367z5\261=\222xz$.\027\244\031-\303\376W\177\373\201\355\340\344\217{z\232\026\251\374\275C;\3030\254!\212\275L+\200\257\311\363\255@\246R\257yl"
+	.string	"\344'\267\244:\331>\354\222 g\220\241\233M\340\\\366H\013#\227\306\030\347\177\314\232v\253\325\373\327\232\273\315\f\305Q,M)Oz\017\264\205\021\311\3553m\237\237\231P\243\251i0\030)\362\326\343I\372q\027\235\344\235\357\201qI\314t\360\2614\275\200\246\325w\037~\226\374*\340Zi\316\374#\213\254\260\245p\226\264\2118\201-\316\024\333\367^\036\327\363\354?F\331\230N\365A>.\260\2621\262+\177.R\220\267\350\233\357\017\357\n\td\201\201k(OB\331w\275\361\311\210\371\221\021`\347w\211\210T\202Ela\263\331\337\265\323\313\301\224\262\236!DHn-\344\216`\236<\234\007na\225%\345\331U\274\001u\223\023\210\3269\357\r\347\336\2100J\262]Uv\216m\025\\"
+	.string	"\377\220\303*\003\265\213\016\240ly\373\377\265\362'_F\274\307\275\324\262O\204\334\232??]\2702\327#\356\202~\356\\@g\242f\321\n\261>k\207\345K\032L8:\030r1\n\224\327\226[\315N\305<\022\205.\022\360\264@\023\027'\304\321D\245\323\245\247%\225j\305\242\253\311c\361\267\223\372\363\367\226\304`A\365\363\357%\240\223\320\320)\370\370\003!\177\267\356\2446\273)\024W*\364\340\260v\267\006^6A\031\314k\342\f\355\375f\236\357\230\344\260\201\343\032\342 \021C_\351.\332\031r\202;\205\335\336+Z\341c\240\024\376\023\223\335\"t3\277\356E7G}3\320|\337tW\231,\200w/\235\264\363\250\373\201L\3310\360<\370y\246l@\251\207\270\334B\\\272\204\335\003Oq\325\233v"
+	.string	"\304\r$\r\006^\030\034=\314\177\365=\366\374l\346\274S\256\264\247\2262\234\324z\217\020\342;\213G\271~\202`V\236?\224\373i\016}\352l\270\377\205\256\352H\367\377\222\323(6\"\351\221\273yY\272\3262\027\301 <\b\250\3439H|\3375'\204\201y\036\326"
+	.string	"\346\347)\371\370\222\254\316\361\2170 \375\026\201\316\025\021v\345\312-\3576d\222\0343N\007D\343\177\256\376<\247{\223q\307b\371\376\337\016\177\217\241\330&\246\204\373h\\\362`\001\257\002\333o"
+	.ascii	"\306\254\267\254z\257C\273\316\260X\314\315\342O}\204\373\264"
+	.ascii	"\324\017\201\353\314\374\367\201,\351;\031\332\375\006\005=\031"
+	.ascii	"\237y\236\351d\365~\373g\370I\f`\334'\363F\313'\331\376;\267"
+	.ascii	"\200K\234\275\313\247\355f\204\205\275\322\016\216\275\231\273"
+	.ascii	"m\235~\255\245\274\316\"\372\343\335;\230\311/\364\313\007}k"
+	.ascii	"\241m\371\232\3077\361\177r\373\036\254xp\"\017w\313.\241\363"
+	.ascii	":\277\256\371\272\020\013{\330\360\004\1777\255\237?\375\361"
+	.ascii	"\327\022?\215?\031.K~Om\327\257s\351\374\f\016\310\305\250|\241"
+	.ascii	"w\350\304\370\206\360\335n\257\234\321\263\220\207\375\354\344"
+	.ascii	"\032g\262\227\376\317\246q\231jx\3773\313\337\226<\245J\237\177"
+	.ascii	"\242\273\314\316\023\216P\027\340[\3528\310\274\334q+\277\001"
+	.ascii	"\352v\247\215\301\273x)7\234\fv{y\314\206p%\212\257\2438\355"
+	.ascii	"\3338\206sU@\016zY\271#\026o\256v\331\243\333\263c7y\001\335"
+	.ascii	"-\377{\370\365\004c\016#\315u\272\366\352.\257g\326\253 \377"
+	.ascii	"\2570N\016vg'\335\365\216Z\303\307\230\307?\273}\250\351\275"
+	.ascii	"\311\237\210\375\377\207}\321g}\336{\023\275\017\233Gt\310\214"
+	.ascii	"[!\364\355\336W\323Y\207s\036\305\275\251`zFJ{\271#6w\345\365"
+	.ascii	"\344\f\303\355\327D\263\016\363\321\362\346zp\374\310B+\216\017"
+	.ascii	"\331\030\237\377\305\313B?E\360\314G\273\311?\233\330H\356\021"
+	.ascii	"\370\267u\037\276\302}7Y\036 \3237\375\024F\276\336\317\345\007"
+	.ascii	"\366\266\313\277\036\341\033;y[\017\354\363?m\26093\263\340\262"
+	.ascii	"l\217\177/\364wR\217\370\231\363\355\220\277\031+\341\321\320"
+	.ascii	"\276\036oO\032\334\":\334\317\226\366\333\t\036\007Kn\305\372"
+	.ascii	"~F\247\327\336\217\225\366\343\364\tF\332\326\221e\002\216\223"
+	.ascii	"\321\345B\2513D\334\226C]\253\037n\357U\324\273\241\\.\340\330"
+	.ascii	"9\332d\250\372\233#}~\2151\211?\263\314\035\026\033!_\024\355"
+	.ascii	"\027\275\276\221>\262\340%\260?!-t\356 \362\377\305\334u\307"
+	.ascii	"\207]O\222\271a\350\360\306\225\377\212\373e\325n\371\303\234"
+	.ascii	"-k\354\360\375\327Q\225Q\264\031\247\377\310\020\346\020\372"
+	.ascii	"\3734\314\233\311=\351~\261z\317)\277n~"
+	.string	"\b\336\r<\207\337\035;\216\002\375\312\r~\243\206\203\366\210\216\264s\313\271A\377\030\321\\\247\264\204\305\r0\355'\320\032\221y\004r\377QWGZ\201\242\353xl\320\r/\236s{w\356`/\327\270\346\\\371\341\340\035\224wZ\211Fkz\206\353\243\376\007\311\365\036\205\364;\3213\272X\367\350\321\035\274\313\236K\364v\271AC\345ek\002\235Qb\177w\207\233\342t\356\375\321\300\200~\217%\366\034O\243g\273\213\223\317\261\026$\376\030\356Ad\026\201\274\200f\263\272W7V\255\034\fR\023\b\356NB\227\346\335\201\355\236\034\272Z\344\\\n\374u\345\227\256\037o\377Q\243\330\t\237f\216\264 \214c\323\223\3771\333\257\213|\223-\356\365?>\034c\274`|\376V\266\231\305\001B\327\347\017\321\362g\324\314\233(\0077v3\f\267\241\321\370\031\364NAM\016i\345\342\002\350\021%\274H\345\020"
+	.ascii	"\264K\354\246\004\016U\223\037\353?,\320\314_?X\374\247\313\030"
+	.ascii	"\337\300\354\001z\230\271}\0064X\b=@\216MXe\264%d\020\272?\352"
+	.ascii	"\243\223\220\\\260\366\365\345A2^\003t\303q\270Y\225\317JH\356"
+	.ascii	"h\216PY\372\353\3751\250u\026\375\232\f\275'\235\003c\301$\340"
+	.ascii	"\354\364\302\344\t\031v\013\335\356Y\354\231\244\376\232\377"
+	.ascii	"\337\217\r\177\336\236\312\3403\362\177\016B\343\035\215\001"
+	.ascii	"\376\370}\262\367\227\341~\265\244\237"
+	.ascii	"\273\332a\216\223\020\227\254y\247!\r\277e\316)0\317\371\361"
+	.ascii	"\230\375\033\346\030\030?DdH\247\365\312\021x\036\354}\256\037"
+	.ascii	"\3229P?\027p\357\307r\033\223N\375\032w7a\320\375\223\232\320"
+	.ascii	"\037~\247\341.K\336G\222\313\321\272\344\322~\272}[\t#\322\367"
+	.ascii	"\377\347\3666\274\210\325\253\215\276\334\364W9\375W\232\003"
+	.ascii	"\372\374\230\275\366\027\270c\375\272\222j\215\372\365u9U\316"
+	.ascii	"\007\262T\372\021\337\331\f\373\2078\004\261%\016\373\343\217"
+	.ascii	"\357\3176q\342\343v\351\251\356w,{JY\2249\351\344\207a\340\275"
+	.ascii	"\374'.]\347\tw\230\240\213\206\371\016\270\317l\246\351\275r"
+	.ascii	"\347\342\266\256\334\213\002lp\200\244\r\b7\372\203\357&?\031"
+	.ascii	"\213y\002:\325O`\215)\331\341\r>\375N\\&\321\276\3609\213\371"
+	.ascii	"\356n\231\236b\221\211\022\353;\266\030\005\337\202*\366Y\362"
+	.ascii	"m\320GeS\235x\303<}\ba\272=\231\273\224\030\372\357M\036`\316"
+	.ascii	"\210\220<\363\374\301_d\361\224.\r\\Q\275\214\220\033\344\214"
+	.ascii	"\347_\327\276B\206\004\2641\212\277\324]Q\324\363\203\341\363"
+	.ascii	"\325\275\004\242e}\234[\273\243C\352Y\374s\2139\027\317\375\357"
+	.ascii	"\204\354\233\261\244\223\317\363\253\221\017\374c\226\3579\323"
+	.ascii	"\363M\324GId<\230\227c\201\315\003\33577\203pql\350\307\310\316"
+	.ascii	"U\211O\213\213\343\324\037[p\340K6\254x4#w9\316\236\241,\271"
+	.ascii	"`7a\370\240Zsn\370\035f\265\337\364\024C\323o\211#j\213\305\375"
+	.ascii	"\314\371t>\317\033\352\273\303\247f2\205\255\360e\325\367\253"
+	.ascii	"\377k\030\310N\361v\373\312\364R\267;\340\037m\224\025b\307\203"
+	.ascii	"\207\by\n\035\316\376\001"
+	.text
+	.section	.gnu.lto_.symtab.e09a4ef4ab3f58a1,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\005"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\007"
+	.string	""
+	.string	"blackboxIsLogging"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"startedLoggingInTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\007"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"startInTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\007"
+	.string	""
+	.string	"stopInTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"inMotorTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\006"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\007"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\007"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\007"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\007"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\007"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\007"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\007"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\007"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\005"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\005"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\005"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\005"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\005"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\005"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\006"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\006"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\006"
+	.string	""
+	.string	"blackboxWriteBufferCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"blackboxWriteBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\006"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\006"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\006"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\005"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\006"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\005"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \007"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\007"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\007"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\007"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\007"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\007"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\007"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\007"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\007"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\007"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\007"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\007"
+	.string	""
+	.string	"blackboxFlushWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\007"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\007"
+	.string	""
+	.string	"blackboxPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\007"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\007"
+	.string	""
+	.string	"blackboxCompressReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\007"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\007"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\007"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\007"
+	.string	""
+	.string	"blackboxCompressWriteFrame"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\007"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\b"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\b"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\b"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\b"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\b"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\b"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\b"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\b"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\b"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\b"
+	.string	""
+	.string	"isBlackboxErased"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\b"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\b"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\b"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\b"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\b"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\b"
+	.string	""
+	.string	"blackboxDevicePrepareLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\b"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e09a4ef4ab3f58a1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7315 @@
+	.file	"blackbox_compress.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/blackbox/blackbox_compress.h"
+	.file 6 "./src/main/blackbox/blackbox_io.h"
+	.file 7 "./src/main/blackbox/blackbox_compress.c"
+	.file 8 "./src/main/common/encoding.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_compress.c.b1470227
+	.weak	blackbox_compress.c.b1470227
+blackbox_compress.c.b1470227:
+	.long	0x51c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF995
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF927
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF928
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF929
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF930
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF931
+	.uleb128 0x3
+	.long	.LASF933
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF932
+	.uleb128 0x3
+	.long	.LASF934
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF935
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF936
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF937
+	.uleb128 0x3
+	.long	.LASF938
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x8
+	.long	0x8c
+	.uleb128 0x3
+	.long	.LASF939
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF940
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x8
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF941
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x19
+	.long	.LASF996
+	.byte	0xa
+	.byte	0xa1
+	.byte	0xa
+	.long	0xa9
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF942
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF943
+	.uleb128 0x1a
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x5
+	.byte	0x26
+	.byte	0xe
+	.long	0x107
+	.uleb128 0x9
+	.long	.LASF944
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF945
+	.byte	0x1
+	.uleb128 0x9
+	.long	.LASF946
+	.byte	0x2
+	.uleb128 0x9
+	.long	.LASF947
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF948
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x3
+	.long	0xe0
+	.uleb128 0x11
+	.long	.LASF953
+	.byte	0x18
+	.byte	0x5
+	.byte	0x2d
+	.long	0x147
+	.uleb128 0x6
+	.long	.LASF949
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xd
+	.long	0x147
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF950
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x157
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF951
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0xa9
+	.byte	0x14
+	.byte	0
+	.uleb128 0xa
+	.long	0x8c
+	.long	0x157
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.long	0x167
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF952
+	.byte	0x5
+	.byte	0x31
+	.byte	0x3
+	.long	0x113
+	.uleb128 0x8
+	.long	0x167
+	.uleb128 0x1b
+	.long	.LASF954
+	.value	0x484
+	.byte	0x5
+	.byte	0x33
+	.byte	0x10
+	.long	0x1a1
+	.uleb128 0x6
+	.long	.LASF955
+	.byte	0x5
+	.byte	0x34
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF956
+	.byte	0x5
+	.byte	0x35
+	.byte	0x1d
+	.long	0x1a1
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0x167
+	.long	0x1b1
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF957
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x178
+	.uleb128 0xe
+	.long	.LASF958
+	.byte	0x30
+	.byte	0x11
+	.long	0x1c8
+	.uleb128 0x5
+	.long	0x9d
+	.uleb128 0xe
+	.long	.LASF959
+	.byte	0x31
+	.byte	0xc
+	.long	0x64
+	.uleb128 0xe
+	.long	.LASF960
+	.byte	0x32
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x11
+	.long	.LASF961
+	.byte	0x8
+	.byte	0x7
+	.byte	0x26
+	.long	0x20a
+	.uleb128 0x6
+	.long	.LASF962
+	.byte	0x7
+	.byte	0x27
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF963
+	.byte	0x7
+	.byte	0x28
+	.byte	0x9
+	.long	0x64
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF964
+	.byte	0x7
+	.byte	0x29
+	.byte	0x3
+	.long	0x1e3
+	.uleb128 0x1c
+	.long	.LASF997
+	.byte	0x6
+	.byte	0x34
+	.byte	0x6
+	.uleb128 0x12
+	.long	.LASF965
+	.byte	0x8
+	.byte	0x17
+	.byte	0xa
+	.long	0xa9
+	.long	0x234
+	.uleb128 0xc
+	.long	0x8c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF966
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x254
+	.uleb128 0xc
+	.long	0x83
+	.uleb128 0xc
+	.long	0x64
+	.uleb128 0xc
+	.long	0xba
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF974
+	.byte	0x94
+	.long	0x2cf
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0x7
+	.byte	0x94
+	.byte	0x3a
+	.long	0x2cf
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0x7
+	.byte	0x94
+	.byte	0x50
+	.long	0x2d4
+	.uleb128 0x2
+	.long	.LASF969
+	.byte	0x96
+	.byte	0x11
+	.long	0x20a
+	.uleb128 0x7
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x98
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0x99
+	.byte	0x22
+	.long	0x2d9
+	.uleb128 0x2
+	.long	.LASF970
+	.byte	0x9a
+	.byte	0x11
+	.long	0x2de
+	.uleb128 0x2
+	.long	.LASF971
+	.byte	0x9c
+	.byte	0x17
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF972
+	.byte	0x9d
+	.byte	0x18
+	.long	0xb5
+	.uleb128 0x10
+	.string	"k"
+	.byte	0x9e
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x9f
+	.byte	0x18
+	.long	0xb5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1b1
+	.uleb128 0x5
+	.long	0x98
+	.uleb128 0x5
+	.long	0x167
+	.uleb128 0xa
+	.long	0x8c
+	.long	0x2ee
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF975
+	.byte	0x87
+	.long	0x327
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x7
+	.byte	0x87
+	.byte	0x36
+	.long	0x2d9
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x7
+	.byte	0x87
+	.byte	0x45
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF970
+	.byte	0x89
+	.byte	0xd
+	.long	0x2de
+	.uleb128 0x2
+	.long	.LASF971
+	.byte	0x8b
+	.byte	0x13
+	.long	0x98
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF978
+	.byte	0x80
+	.byte	0x5
+	.long	0x64
+	.long	0x359
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x7
+	.byte	0x80
+	.byte	0x42
+	.long	0x359
+	.uleb128 0x2
+	.long	.LASF977
+	.byte	0x82
+	.byte	0x14
+	.long	0xb5
+	.uleb128 0x2
+	.long	.LASF962
+	.byte	0x83
+	.byte	0xf
+	.long	0x6b
+	.byte	0
+	.uleb128 0x5
+	.long	0x173
+	.uleb128 0x13
+	.long	.LASF979
+	.byte	0x76
+	.byte	0x9
+	.long	0x8c
+	.long	0x385
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x7
+	.byte	0x76
+	.byte	0x40
+	.long	0x359
+	.uleb128 0x2
+	.long	.LASF970
+	.byte	0x78
+	.byte	0xd
+	.long	0x2de
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF980
+	.byte	0x6c
+	.long	0x3bf
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0x7
+	.byte	0x6c
+	.byte	0x35
+	.long	0x2cf
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0x7
+	.byte	0x6c
+	.byte	0x4b
+	.long	0x2d4
+	.uleb128 0x1
+	.long	.LASF955
+	.byte	0x7
+	.byte	0x6c
+	.byte	0x57
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x70
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF985
+	.byte	0x5f
+	.long	0x414
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x39
+	.long	0x2d9
+	.uleb128 0x1
+	.long	.LASF970
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x4f
+	.long	0x2d4
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x64
+	.long	0x8c
+	.uleb128 0x1
+	.long	.LASF981
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x74
+	.long	0xa9
+	.uleb128 0x7
+	.uleb128 0x2
+	.long	.LASF982
+	.byte	0x63
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x2
+	.long	.LASF983
+	.byte	0x64
+	.byte	0x13
+	.long	0x414
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x14
+	.long	.LASF988
+	.byte	0x53
+	.byte	0x2b
+	.long	0x107
+	.long	0x440
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x7
+	.byte	0x53
+	.byte	0x58
+	.long	0x359
+	.uleb128 0x2
+	.long	.LASF984
+	.byte	0x55
+	.byte	0x21
+	.long	0x107
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF986
+	.byte	0x47
+	.long	0x479
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x7
+	.byte	0x47
+	.byte	0x3e
+	.long	0x359
+	.uleb128 0x1
+	.long	.LASF970
+	.byte	0x7
+	.byte	0x47
+	.byte	0x4e
+	.long	0x479
+	.uleb128 0x2
+	.long	.LASF949
+	.byte	0x49
+	.byte	0x13
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF987
+	.byte	0x4a
+	.byte	0x13
+	.long	0x98
+	.byte	0
+	.uleb128 0x5
+	.long	0x8c
+	.uleb128 0x14
+	.long	.LASF989
+	.byte	0x3e
+	.byte	0x18
+	.long	0xa9
+	.long	0x4bf
+	.uleb128 0x15
+	.string	"a"
+	.byte	0x2e
+	.long	0x8c
+	.uleb128 0x15
+	.string	"b"
+	.byte	0x39
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF990
+	.byte	0x40
+	.byte	0x13
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0x41
+	.byte	0x14
+	.long	0xb5
+	.uleb128 0x2
+	.long	.LASF992
+	.byte	0x42
+	.byte	0x14
+	.long	0xb5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF993
+	.byte	0x36
+	.long	0x4d6
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0x7
+	.byte	0x36
+	.byte	0x30
+	.long	0x4d6
+	.byte	0
+	.uleb128 0x5
+	.long	0x20a
+	.uleb128 0xd
+	.long	.LASF994
+	.byte	0x2c
+	.long	0x50a
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0x7
+	.byte	0x2c
+	.byte	0x30
+	.long	0x4d6
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x7
+	.byte	0x2c
+	.byte	0x41
+	.long	0xa9
+	.uleb128 0x1
+	.long	.LASF963
+	.byte	0x7
+	.byte	0x2c
+	.byte	0x4c
+	.long	0x64
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF998
+	.byte	0x6
+	.byte	0x37
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x6
+	.byte	0x37
+	.byte	0x2a
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 62
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 30 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.file 31 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 32 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8
+	.byte	0x4
+	.file 33 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF926
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_compress.h.32.db9d67464cf7dd3c4de956009bb63da8,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.30.0a00ae9199efd475f4080a54886f9f0b,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF923
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF999
+	.long	.LASF1000
+	.long	.LASF1001
+	.long	.LASF1002
+	.long	.LASF1003
+	.long	.LASF1004
+	.long	.LASF1005
+	.long	.LASF1006
+	.long	.LASF1007
+	.long	.LASF1008
+	.long	.LASF1009
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1010
+	.byte	0x7
+	.long	.LASF1011
+	.byte	0x7
+	.long	.LASF1012
+	.byte	0x7
+	.long	.LASF1013
+	.byte	0xb
+	.long	.LASF1014
+	.byte	0x1
+	.long	.LASF1015
+	.byte	0x1
+	.long	.LASF1016
+	.byte	0x1
+	.long	.LASF1017
+	.byte	0x2
+	.long	.LASF1018
+	.byte	0xa
+	.long	.LASF1019
+	.byte	0x3
+	.long	.LASF1020
+	.byte	0xa
+	.long	.LASF1021
+	.byte	0xb
+	.long	.LASF1022
+	.byte	0xb
+	.long	.LASF1022
+	.byte	0xa
+	.long	.LASF1023
+	.byte	0x7
+	.long	.LASF1024
+	.byte	0xa
+	.long	.LASF1025
+	.byte	0xa
+	.long	.LASF1026
+	.byte	0x7
+	.long	.LASF1027
+	.byte	0x7
+	.long	.LASF1028
+	.byte	0x9
+	.long	.LASF1029
+	.byte	0x7
+	.long	.LASF1030
+	.byte	0x8
+	.long	.LASF1031
+	.byte	0x8
+	.long	.LASF1032
+	.byte	0x7
+	.long	.LASF1033
+	.byte	0x7
+	.long	.LASF1034
+	.byte	0x7
+	.long	.LASF1035
+	.byte	0x6
+	.long	.LASF1036
+	.byte	0x6
+	.long	.LASF1037
+	.byte	0xa
+	.long	.LASF1038
+	.byte	0x5
+	.long	.LASF1039
+	.byte	0x4
+	.long	.LASF1040
+	.byte	0x4
+	.long	.LASF1041
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF925:
+	.string	"RESIDUAL_DECAY_SHIFT 4"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF941:
+	.string	"size_t"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF981:
+	.string	"zigzagResidual"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF924:
+	.string	"PREDICTOR_ERROR_DECAY_SHIFT 3"
+.LASF917:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF923:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF980:
+	.string	"blackboxCompressReset"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF969:
+	.string	"writer"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF991:
+	.string	"sign"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF958:
+	.string	"blackboxWriteBuffer"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF820:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF962:
+	.string	"bits"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF974:
+	.string	"blackboxCompressWriteFrame"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF909:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF919:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF965:
+	.string	"zigzagEncode"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF913:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF983:
+	.string	"error"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF922:
+	.string	"Q12 (1 << 12)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF931:
+	.string	"signed char"
+.LASF939:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF906:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF985:
+	.string	"updateField"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF821:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF927:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF926:
+	.string	"MAX_ACCUMULATED_ERROR 0xFFFFFF"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF976:
+	.string	"value"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF937:
+	.string	"char"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF953:
+	.string	"blackboxCompressField_s"
+.LASF952:
+	.string	"blackboxCompressField_t"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF987:
+	.string	"previous2"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF904:
+	.string	"BLACKBOX_COMPRESS_MAX_RICE_BITS 24"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF945:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_STRAIGHT_LINE"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF992:
+	.string	"magnitude"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF997:
+	.string	"blackboxFlushWriteBuffer"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF951:
+	.string	"residualSum"
+.LASF975:
+	.string	"blackboxCompressUpdate"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF998:
+	.string	"blackboxWrite"
+.LASF396:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF933:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF957:
+	.string	"blackboxCompressState_t"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF902:
+	.string	"BLACKBOX_COMPRESS_MAX_FIELDS 48"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF989:
+	.string	"absDifference"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF795:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF979:
+	.string	"blackboxCompressPredict"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF955:
+	.string	"fieldCount"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF986:
+	.string	"predictAll"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF996:
+	.string	"SystemCoreClock"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF938:
+	.string	"int32_t"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF911:
+	.string	"VERY_FAST_MATH "
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF960:
+	.string	"blackboxWriteBufferCount"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF822:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF935:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF942:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF468:
+	.string	"__PMT"
+.LASF959:
+	.string	"blackboxWriteBufferSize"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF918:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF946:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_AVERAGE_2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF963:
+	.string	"count"
+.LASF914:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF929:
+	.string	"unsigned int"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF967:
+	.string	"state"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF936:
+	.string	"long int"
+.LASF793:
+	.string	"ACC "
+.LASF954:
+	.string	"blackboxCompressState_s"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF908:
+	.string	"sq(x) ((x)*(x))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF970:
+	.string	"predictions"
+.LASF973:
+	.string	"quotient"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF797:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF777:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF949:
+	.string	"previous"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF928:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF748:
+	.string	"BLACKBOX "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF972:
+	.string	"zigzag"
+.LASF995:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF921:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF977:
+	.string	"halfMean"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF907:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF846:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF799:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF930:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF971:
+	.string	"residual"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF847:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF756:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF903:
+	.string	"BLACKBOX_COMPRESS_ESCAPE_QUOTIENT 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF990:
+	.string	"difference"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF966:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF984:
+	.string	"best"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF737:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF956:
+	.string	"field"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF910:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF968:
+	.string	"values"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF738:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF776:
+	.string	"GPS "
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF819:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF932:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF988:
+	.string	"bestPredictor"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF920:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF961:
+	.string	"bitWriter_s"
+.LASF964:
+	.string	"bitWriter_t"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF947:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_COUNT"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF734:
+	.string	"USE_CLI "
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF948:
+	.string	"blackboxCompressPredictor_e"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF905:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF915:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF978:
+	.string	"blackboxCompressRiceParameter"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF982:
+	.string	"predictor"
+.LASF940:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF912:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF943:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF916:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF934:
+	.string	"__int32_t"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF950:
+	.string	"predictorError"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF993:
+	.string	"bitWriterFlush"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF994:
+	.string	"bitWriterWrite"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF944:
+	.string	"BLACKBOX_COMPRESS_PREDICTOR_PREVIOUS"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1019:
+	.string	"target.h"
+.LASF1007:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1031:
+	.string	"stubs-64.h"
+.LASF1038:
+	.string	"platform.h"
+.LASF1008:
+	.string	"/usr/include"
+.LASF1011:
+	.string	"stdint-intn.h"
+.LASF1023:
+	.string	"libc-header-start.h"
+.LASF1037:
+	.string	"strings.h"
+.LASF1040:
+	.string	"common_fc_post.h"
+.LASF1002:
+	.string	"src/main/target"
+.LASF1018:
+	.string	"string.h"
+.LASF1024:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_compress.c"
+.LASF1027:
+	.string	"timesize.h"
+.LASF1012:
+	.string	"stdint-uintn.h"
+.LASF1016:
+	.string	"blackbox_compress.c"
+.LASF1034:
+	.string	"wchar.h"
+.LASF1022:
+	.string	"stdint.h"
+.LASF1014:
+	.string	"blackbox_compress.h"
+.LASF1006:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1033:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1039:
+	.string	"common_fc_pre.h"
+.LASF1035:
+	.string	"locale_t.h"
+.LASF1005:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1041:
+	.string	"maths.h"
+.LASF1013:
+	.string	"stddef.h"
+.LASF1030:
+	.string	"stubs.h"
+.LASF1004:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1032:
+	.string	"typesizes.h"
+.LASF1025:
+	.string	"features-time64.h"
+.LASF999:
+	.string	"src/main/blackbox"
+.LASF1015:
+	.string	"blackbox_io.h"
+.LASF1028:
+	.string	"cdefs.h"
+.LASF1017:
+	.string	"encoding.h"
+.LASF1029:
+	.string	"long-double.h"
+.LASF1001:
+	.string	"src/main/target/SITL"
+.LASF1003:
+	.string	"src/main"
+.LASF1021:
+	.string	"stdbool.h"
+.LASF1026:
+	.string	"wordsize.h"
+.LASF1036:
+	.string	"__locale_t.h"
+.LASF1000:
+	.string	"src/main/common"
+.LASF1020:
+	.string	"stdc-predef.h"
+.LASF1009:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1010:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\315\005"
+	.string	"RG\034'\220+\215\001;t\036\013\357\207\365\025\177\004\343\324\363\023R\002nff\264\231\211\264\356\350.\233\354\275\367\336\222\244-\003\032\245\003f\212\3442\302\345\272`2\032\020O\034T\212\007\\:*\026\316\213^\270F\370\036\330\210\244\231\270\367\276\367\267\022\b\003\325\334\273n}B\231O\325a\355\306f\273d\324b\222\254\365Bk\03507\205\013E\241.B\037"
+	.string	"K\004\f\021\240\264\200\204\t\300\005\264\002\376\020 G`'\001."
+	.ascii	"07\317\0015\013\t\004\323>\327\344\326\261;\223\263kw\272j\340"
+	.ascii	"\f\2537\027\200x\355\204z)#\227\317\216L.\017X\330\265\244\201"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.ipa_sra.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\205\003"
+	.string	"\322\004\r\023\260%\351\f\3030\f$\220L\032n\2154B\344\336)\005^\273/\r\353\002o\022\310\";\017p\251\351;D\221\f\275=G\005\215\203%\327\330\337Y\334\004\030"
+	.string	"_C"
+	.string	"\220\2139QU"
+	.ascii	"@\3234\001\220\026 5\205\300\030\026\033C2\003\300\250\304\004"
+	.ascii	"AW\305\307\024\007\306\005\303U\202\204S\342N,\364d=T\213A'\005"
+	.ascii	"\030\002"
+	.text
+	.section	.gnu.lto_.inline.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`D\003}\017"
+	.string	"\226\227K:PM\223\306\004\023\320\262\301\367\217\303R\267\356\363\264y\t}\3561\252.\212\t+\214t\300i\033\352\366}&\234\364\032\243\256\200\200\210n\326\372\3336B\210ZSkdK)S4"
+	.string	"E"
+	.string	"9"
+	.string	"\031\252\361)\323\232vt&\363vF\365l'E\356\356\342yn\024c\267Bz\216j\354\256\201\350\363uJ\342\257#\206>I\274\215\235\204\260\273\004>\272%\b\231\247C\344;y\241B\246aI\034;j\321\361\271\230\370\261{\370(\345\001\313:\007\004\210&\212DL3\317\206\022\033!,@L\244-\275RY\220\035\037\n\031"
+	.string	"\206$\232\307c\271\261\273\227|\304\224\004\307\210\026v\267\300\024\331=\304\337Pg{\260\273\025\337\252\021\223\216\256\353D\260\246m$G\021t6\310\333\335J5\356\205\321+\213J\034\032\025\254\200\t\262{\372S\3553\267\374\020\357\036>N\212\273\347\236>R-B{\254 )99!\363x\250\236\201J\270\310\3708h\240\034\0344d\213\270H&\335\275\335k\177\005\275\343b\256\313\2620\354\256\005\037#G\003W\250\301L\345\224\241\231\321\242\026\322\030\200\"\232\"\273\001\022"
+	.ascii	"U\035I\241\034\r%J\313m\375\317\231\001`\247V\013\311\2721S\204"
+	.ascii	"\3764\202\213\306\267\\ \312_MI&e}\020\007d\360\336\277\203i"
+	.ascii	"\234\264I/\3554\226\020e\025\035{\354A\222\3112h3\214\230;F4"
+	.ascii	"%\212\365\274c\303\350 \037\327\f\242\240\306\343\306+\022c\223"
+	.ascii	"\273\276l`G\006\265\345$RH\221?7@\b4\037\020\211\020\315\026"
+	.ascii	"\231\200\235\231W\225\250\237D\214\376\216\0020n\364\202\017"
+	.ascii	"k\333\344\002\251\227\227Z[\222\220A4\206\315\363:\333i\307\310"
+	.ascii	"\254\366\234Eh\"\332\367\224<\256\213h\336?M&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\300\001}\b"
+	.string	"\242M%&\220'I\007\352\177\227\357|\332\360\347\337\335\271b\237F\215\375\177\251c\245\200\211q}\333\240\242Fz#Bd\222\001\244-\274\302;60\367X~\020(\356\005\346\316\334}P\335q\rMJ\323\241\252\341\031\356\264\"~\0014*w\367vlF=\243:\021\246@i\206\251O\332Ai\345\233$\352\023\325\027w()\315#L\032Ic>T\311\025\227\264N;\205@\305\357\263\360\263L\026QSjHm\361\033"
+	.string	"\016\324\314\257\324R\255\265k\337\377!b\023\0023 @B\342\034\336\006\032X\023d\033\362d\"\324\3003\035\334b\210\305b\265\340=\350\270\303\345\f\f\n\270! \265\214\363\313"
+	.string	"\307\352\302^tI\326\201U\\\326\253\023\262\240\371\201\342\334\223\270\033f5\240\rQ\254ii\300\312"
+	.string	"\2260v\231\036\211\bX"
+	.ascii	"\367\242\227zA\257\036B\2734\311Q\240\313\301\303\203\232\243"
+	.ascii	"\013\\]$\0233J\245\275w\001eX\200!"
+	.text
+	.section	.gnu.lto_.pureconst.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\232\004\005\232\004\006\232\004\007\205\004\b\205"
+	.ascii	"\004\t\231\004\n\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\325\006"
+	.string	"r\311\035'\240%I\007?\272\316z\352\217\366\002\013\214\316\343C\361\325\233t\351\264\376\256\021\255Y\327\232E\bk\233%\255\021)S7"
+	.string	"\002\030\311?\016\330"
+	.ascii	"\373\233>wN\323\352\241\006\215A5\374T\376Do\335\331\301\002"
+	.ascii	"B\220\300\004\242\347\256)\347R\005I\365v;f\225/)yU\256:\231"
+	.ascii	"r\246\365\021\3566\237\034\321\273\227\336\021\232sE\373\242"
+	.ascii	"\351\265 +\253g\024* `\002\231Ay\0033B@\244\200k\357\274\032"
+	.ascii	"\230\325\343\2712\361\r\374N\265\"\302\221o\262\020]\006XG4\230"
+	.ascii	"\273\343\345B\0047\337\024\002[`{\320\256\275\n\206\004\267\320"
+	.ascii	"\003|\326\001\025\036\020lv\rF\001\214\347F\\\007l\0070\200\347"
+	.ascii	"|\261\200\\ \304\342g\031\226\004\002\034.\034"
+	.text
+	.section	.gnu.lto_.lto.1427ec20d815a0d6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.1.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`s\001}\016"
+	.string	"\226\332_E"
+	.string	"\261&\035\343\200\207'i\2227\316\221w\221\304yfs\307\357h\013\254-\326\275\031\273o\354"
+	.string	"!\335\352\301\375\331\366\261\250\273k\351y\323\355\277+\0013\216\253=\300\227\227\016\277>\031\331v,\331[\312\224\002K"
+	.string	"E"
+	.string	"N"
+	.string	"2'\326]\227\0265\273\237\002\207"
+	.string	"x4\313\206\361\357\265\021b\254\300l\354\356\246\035\316:\324d\371\237\371\307s\265\0165\\!\202\234\0245<\\)\360\203\345\203\367\231g\006W\227\351q\260\273N\317\325r\307\333~`\033\202}\232\336\243o\233\354\361z\300\303\006\224\214\371c\306\213\315\035\373k\245\302\330\207\253/\366e\376\016M{`:\313t\3144\324\264f:3}\017\001,\006\230\330e\211\341\330\233\250\002\204\355\203\354"
+	.string	"-\242L;\304\200\365\nS\t\321e\314P3\375J\216\250(\356\311Hp\250Q\257\342\322\235\200*\202\003{\t\223\023\n\225=\252\202\334\200\237\264\271\ny\317\005:m\331D\343/\235\234\032U\230\324+\211\204\213\224\324\031\261J\375\370\"\376y\205\037\343\022\333\344\003\026\205B\013D\"!$\255\244\255V&U\212\204+\0210\225\214\214.DO\320\270\223\004\f\034\tU\032\215\2206\n\247\021\311VR\2556\315\200\271\224I\265Y\3408\325\006\372\366p\365%\356\334\240h\347\016\365iR' \257\030\337${l\200\303!SU\217\006\037"
+	.ascii	"8\313\007K\275\231\241}\002\003\377\255\333e(Oc?\r\201\305\224"
+	.ascii	"\022\307\024kp\231\310d6\230\223\203-\2140\316\300\275\204\221"
+	.ascii	",R\001\310\250\2704\327\2401\200\205\317\0345\252\025\027F\314"
+	.ascii	"\031\273\301\324\220p\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_bitWriterWrite.6.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\b\003\215\025"
+	.string	"\206\347\212J\300\020)\035\313\256\317\377\256d\361\004a\030\310\021\203\036\027\332z\030\377\263\214\357\"\274\355\f\346;\260\233\271\333\226\337\200{\3210\331\244!\333D\001"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"%\352\357w+c&\210\377t\271\225Uk\204\020\262\267\2242\005v"
+	.string	"k"
+	.string	"x"
+	.ascii	"3@\255\301@\341D\\\n2\307$\223\345\177A\254\217my2\313Q\353\216"
+	.ascii	"\222P\255=\221\223\210K\337\333\026\270T\\\017p\351m?\214\355"
+	.ascii	"\365\324\006+r\276\031\265VXg\370d\333\322\331l\373\np\241\333"
+	.ascii	"\315,\235\241\315\r\007\326\316f\226<5\021\255o\271\302\216\206"
+	.ascii	"\247\007\234\355\365m\201\017A\272\035\316r\310\240\326z\326"
+	.ascii	"\355,\354\301\375\037\373\377\340\357\004\001K\267?\226x7\376"
+	.ascii	"\275\345\323\2422\215\2777\303\315\363oI\317S\323{\347\256\375"
+	.ascii	"\331\365X\240\335\216\345\355r4\237\325\374\325\344oL\276\252"
+	.ascii	"\371\251\346\217\315\027'?\234|p\362i\363g\363{\362y\362w\300"
+	.ascii	"\212D+F\2557?\250\212D\211:\374_\325?\3260i\240\227\027\204j"
+	.ascii	"\255\"\217\211KG\031&\334[\021\266\375\211\t\252\336\350\231"
+	.ascii	"\204\213*\212Q5\201%\336\255L\r\001\200\331\227 \253S\3155fE"
+	.ascii	"\035dd\263\353\267\206\306N\361ruN7\261\307\346#\234N\204=\361"
+	.ascii	"R\354U\210\260M\254\224\270\3249\201\315\0356M\312\341x4m\260"
+	.ascii	"A\246\\\316l\332\233\213zm\367l\027\023N\307\300v\207G\035\275"
+	.ascii	"\315=K\034\024\r\377\376\327\266D\214Xk]\360\r:y\0217,\375\312"
+	.ascii	"\200\001.,/\244\214\316^TP$\320\223\214\214\034 Q\200 \366\372"
+	.ascii	"\240\315\\Rh\023\300\313^\265\332\214\326\262B\312\034\300\220"
+	.ascii	"1\b2\024\225\030\214%\005e\005&\243\325`\257\220\223-3\032\314"
+	.ascii	"\205$i0U\257n\357\234\252@\2725\rm\236\207\373b\004\213\032~"
+	.ascii	"\272\321KV\2674\360\226\206f\255\265\316\024\257\372_!yu\007"
+	.ascii	"\251\351\231\273z\325\353[\016\024\271\250\375m\b\270\321\256"
+	.ascii	">\347rR\0359 \220\002\02123\017\336$\006\276\236t`\365\221\244"
+	.ascii	"\266<H5@\300\325\f\2677\030\372\2565\r[\0134\264\323\276\037"
+	.ascii	"\013)\351\305\256zy\355h\fA\340.\245\356\243\032\270\202U(\024"
+	.ascii	"\243\343a\25158\223\374rP\007\375\301OyK7r\261\272\261\321xv"
+	.ascii	"Q\213T\326P-4\270\034\036\007\235\f\247\277\347\nf\217!c\217"
+	.ascii	"k\020]}\373\335\243\035\343\243iN\\\260\264\270\226\277_\356"
+	.ascii	"\b\346\t"
+	.text
+	.section	.gnu.lto_updateField.11.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\246\007\235+"
+	.string	"\312Kd\020G\200\236M:\253DD\f\201?\"`Kt\020\235u;5JA\327h\031\302\001]\004\352\301ooQ\201F&\032\376j\320\350Gx\216\1779\007\205)e|\3113\335\260\214:\300\347\351\005y\2605\"\215l\"w\222\001\361"
+	.string	"\340"
+	.string	"\360"
+	.string	"E4^hA\364\354\370X\370_l{v\314_\fv\264\262\005\307\351E\310\327r\257wa\334-\352\243\013\227\021Z\320\270@\273\367biym\231\322]\275\330zz\336\242Mv\314\327\"|\226\251s\305\214s\213U\021\355^\343\202[Nq\336\036\307l\213\263+\273\250\340D\231\355\272\312\255\f\177\245\252\004p\257\206x}\335{\227\370\351\274\325\2256\260]5\242\020\002p\257\254"
+	.string	"\341p\336\332\262\354^\231\037\345R\206\237\242\342\001\356%\242\347\353^\343\022O8o\331\370 \363\366\374"
+	.ascii	"\363\226\207\314rn\324\2728+*-\270\362\334{\231\372\b\367K\343"
+	.ascii	"\271\254\303\333\262\353\220o\253p|\222\217\260b\326\212\333"
+	.ascii	"\022\300\2757\227\305\242lP\261\262\254j\271\304\306\373_\256"
+	.ascii	"\240GY1\313\306\253\255\302\275\227k1\213\306\331<3\007\231\031"
+	.ascii	"\t\263m\030\265\207\342\244u\254j\222\231}?\243:\357\275\022"
+	.ascii	"\370f\035\236\316$*\314\3337\020\222)\304\232\344z\254qv\253"
+	.ascii	"\032\263\321\252v\021\346\3776\021f\264\362\201\217\235\223\320"
+	.ascii	"\312\006\216<\353p\225\221Nv>B+\033\241\225\213\210\320\312C"
+	.ascii	"he\241\033\377\002\277\362\007\275\353\027\360)\177\200\177\235"
+	.ascii	"s\270\312@h\345\037\2642\016\255|\303UFk\345\363V\331v\253l\242"
+	.ascii	"\225-Z\271D+7Z\271\242\225\217\300\346\304\254\350x\257\214$"
+	.ascii	"\237{\306\202Qr\262\037\371\217\375_/\231\317\367\3621>\362d"
+	.ascii	"/c\034\017\207C\341\301\370dn\306.Q\203\023+sC\254LU\206\013"
+	.ascii	"iZ\314\017\033SE\005\215\261\353\372\2601U\031.DYC3r\336\236"
+	.ascii	",v|0|1g\272c\016\003\374Mg\240\001\277q\344q\206X\325\246\314"
+	.ascii	"\244>\320f\232\264N\216\263\244\376\330uD\003\235\3245\215\256"
+	.ascii	"\215\332@\233vZ\340\270\241\353#\221Z\3275\r\322Q#ui']\263\352"
+	.ascii	"\252qv\324'3\352\243\256\310\242\026j\2436\355\244[h\027\265"
+	.ascii	"\215+\250\205\332\202\275\354\267\256,3G\315\372\240A\373b\327"
+	.ascii	"\005\365\303\256#^\216\324\210\223\217\302\274E\273\"\261v\020"
+	.ascii	"\273@\237\375\324\211\031\323l[?e\222k\263Md\2135bM\362\317\221"
+	.ascii	"\307\331]\363\207\271\016\354o\200Al\212\314\334t7T\020\330\334"
+	.ascii	"{)|x\033\336-\232\245\006J\217\201\377\305R\244\254\301\0061"
+	.ascii	"?\214\243\216\356{\357\212\346\005\273 \304\252\306\377\362\362"
+	.ascii	"\211\220"
+	.string	"z\314a[\r\220\326\213i\304~\333n\256\364Gw\355\262\211\220\351Vy\0063\337\335G\\\3225[2\231<\225)\240\003M\347=\b\f\006}6\bD}=)_\320\007\002\304\317\351&\365\364\023\226>\247)\022?\251'^\024\n\305\233r\372\t}\032\236x'\236~'r\276)(^\t+\224\002\376H\364~N\276\240\b\034Ox\360\240\301\004\b\016\232\030\0309A\371~ ,\367\030\b\205\276\240\210(`\357\203\t`S\210\036\017\252\211I\352\307\213b\352\005\205L\f\0220P\204/\310D\002\b\f2\341\214\304\3776\021\306\360\344\f\261\2558H\251\336d\021\222\036M\316\200\272O\025\001->\036\316\346*\246\021\225\276\247J\211\303\365x@\002j\2456`~\374\355\270\304v\021\216 \326D\335n\352\202\347\032k\351\271\266\340\346\252\356\261@\204\344\272\002\261\252\275,\211\372_\327)=\327D\375"
+	.ascii	"c\216?\215\347\316P\337\372\247+W\372\003\327\007z\250\205\270"
+	.ascii	"\322\255\245\337\032\327\246\223\036s\322\265:txi\035\236\030"
+	.ascii	"h\336\336Z\350d\3101\261\260\200\244\250a(\250\230rjfDD\222\024"
+	.ascii	"\024\026:p\002\021\242\262\362\021\200%e\214f\n\n\222\326\206"
+	.ascii	"\237\243v\254\020\2309\017B\353O\375\342\323?_k\2778z\254\320"
+	.ascii	"\317\271\277'\313Z\225\001\005\n \215\253\351\251nB@\213\031"
+	.ascii	"\023q\355\215J}\021 \013\362\252\271\224uG\340\261\347&\261\240"
+	.ascii	"\321rM&\356\277;\rz\b\214\207\006\"\320\200\361W\220\330p\257"
+	.ascii	"q]}\377\243\003crE\020\275+0`\\\255\362t\020\026\200ae\2259\003"
+	.ascii	"c\037\266!#\271\032Y\200\206\322\266\306S\211\242\177\373\303"
+	.ascii	">\225X\243ky\013\336\226\323\371J\234\370E\230\344I\277\035\264"
+	.ascii	"\303R\022\361\372\300\344\351\306\261\023\247\216\r\020J\260"
+	.ascii	"h\352\364\327\200Tx\305b\025\024Q7G\241E=\377u\340\235\f\247"
+	.ascii	"}\3746\006_\214w$\257\313i\201\360\n\276+\334\222\004\002\357"
+	.ascii	"_\374\036\375\314\022\354\330\021\342\0317z\201\221\261\200\257"
+	.ascii	"Vh\376\321\336\365\200\022Vx\246\244\205L\t5\221\313\013\272"
+	.ascii	" \321\333Q\223{\276\333jP\241pc\013hV\346\3033\211\316\332\341"
+	.ascii	"\"\032\330It2\023\363\027\021\241\361\266\3329\375\370\0011\376"
+	.ascii	"\327C\265!\002\265\367\032\303\336\370\035\345Q\001"
+	.text
+	.section	.gnu.lto_blackboxCompressReset.12.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\003}\026"
+	.string	"6k\224I\300\224Q:p,t6\"\203#\n-\315\323\320\246$ u\001\3540\377\013\321\337\205\f\246|\377\372\004\3324\005\t\332\016\332\313(\335\277\375\027\004A\020$\254\037s\002\261\037\362\372\1773\367\237\373<\376#\211\335D\356\224\002\177"
+	.string	"y"
+	.string	"}"
+	.string	"=\035\004'\333s\264!\202\370\031\n\265.\355\253\370\212\334\215,\\\300.\021\223\322no\3050\342\247{/\200\372\024?"
+	.ascii	"\365\351\234-\344\275\242\375Q\016 \244\"\273\313\322\020n\t"
+	.ascii	"\177\277\337\357`\357\006e\356\023T\231\363\221\256`\310\307"
+	.ascii	"\216\267\363\t\206>B#\002\360|\300\030\247\246\245']\006\361"
+	.ascii	"x$X"
+	.string	"\"\303\365Iw04\356x\031.C\231\335\265\334\3610\334\250\333\266\331\246\331J 7\034\371\235S~t\307r\\\321c\345\223\335\333\221\n\302~L\221S\223\225\310V\275\367\233\274\305\237\272\321/~\274\247J\203RZAi\tJ\377$\254\301\003e\310\256\320\317\310\356\230K$>\376\366\303\023-\337\205\237\344\222\020E\313\036\355\023w.\210\343\321\217\246\335]}z&~\276\304\016C\264\224\305\217roa\037x\262=\037H(\355\356\212_\342g\n\030nh\311j[\345>\232\005\266\3533`\t\212v\367\305\270\313\210\031\370\261\2731\2376\205/\311>U \323\216\210\257\224S#\372:\250\007i\220j\242\252\377A\001^\245\376\307\004\217\374y\352u2\001\0351\031e\250\2164|x\352\325?\276\325A'\237\374\244\203)<\3101FJ\355\331a\330'\356\356\213\377\202V\003P$\342\323\267\200\372<"
+	.string	"\204\203N\376\034\032\205\222\244\347\306\201Z]T;\262\343h8\265\031\t61\331\204\324-\206c\343\252\2002\214\213K\013\f\204\007/\026\224\030\316\205\273M\303Xn\267\230\355fV\203\321\344\324^50\227\315\213E\223\271f,\230\355\306bi\340\332M\314\306\302\325j6VIo\257D>\322\305\321\306\016\235\362L\005a\222 \252R\r\"W\237\032d\333)\235:\223\243G:\351\3600UF'\237\016\356\356\202*\375\370\024\235|\262\312\247\252\364?C\f\200b\254\374\206\215\0324|`5 \240\002\031\253\261\003]R"
+	.string	"-\"\211\346\270\274j\221\333*\027\245\303\223\032\376\315t\254\024\241\003\366\345\206\316X\222\017\016\326\266\32612\r\265\356\223T\214"
+	.ascii	"\362\232\233\360\340I\273J\302B\352\025\2035n\026\267\001#\200"
+	.ascii	"\3031\004 \242\3705\302\032\356\364]\2023K\342\215l\2452\207"
+	.ascii	"\020\277R3t\246l@\023NAX8\b\007\276\227\361\211\323\226\241>"
+	.ascii	"\336\207H\347\202O"
+	.text
+	.section	.gnu.lto_blackboxCompressPredict.13.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375` \007\365&"
+	.string	"JC\334\016J\200\330U:W\n@\301\340\203\202\200xY\221\354E S\340\006l\230\2004\370\306\333\255\352k\254jH\337\330\0375m\212\347\376S\324\030\245e\216sK\375s\274{\376\252\276\317y6\325T\224\035v8J\032\t\"\204\354\235d\323"
+	.string	"\313"
+	.string	"\344"
+	.ascii	"T\271{_\205t\245\222\352\304\326\220Z!\366\264\377\004\251\337"
+	.ascii	"\344T\335>]\237TN\222n\305\234\\\204\212\001$\304\372t\005\313"
+	.ascii	"u\277\t\322\231$\255LN+\325\026\031\034\326\247\267[\330_v\253"
+	.ascii	"\246\311-\271\224\360S%V&\247\nPcb9g\005O\033C\026\233\n\226"
+	.ascii	"\273\267\373I\256Dx\245\022\200\234\\\224J\321\314Y\311\240\211"
+	.ascii	"\326\247\255\\\273\273\177\344H\204\275\204*\223H\025*\354\270"
+	.ascii	"\034\3139\343n\367Q\237\242\347Q\237\342\034_\272\232\242\370"
+	.ascii	".\365i\024\226G\271j8\233\220LW_<E\023Tu\211\272A\032\321\237"
+	.ascii	"\250\030V(.\352\342\370\006YDo9\347S\371U\201$\336K\243\220s"
+	.ascii	"\356\333\204d\361\246\275\273\215\272\373D7\rA\177a\254\261\345"
+	.ascii	"\314/}@^M\277\372m\210_\365\333\360\2225m\314e\"\346\231/Y\267"
+	.ascii	"\222x1\216\356\243\031\337\350\256\335\006\252\335\376\251\335"
+	.ascii	"\366\251\335\356\251\335\346\251\335\336\251\335\326ao\347\260"
+	.ascii	"\267q\330\3337\354m\2337\337\266c\275\333\032{\233\375\326{e"
+	.ascii	"o\323\330\333j\337F\331\333\370\312\377\006\321\316h)p\226\363"
+	.ascii	"\212\263\262\234%\315\372q\254\277\371o\375SG\273\337\227\362"
+	.ascii	"\255>\225n\3737\205\306\264\246\2103\351\374]\251\024F\334!\345"
+	.ascii	"\327\327\022\242\365{\224\020YP=L\254o\366\261\236\325m\013\205"
+	.ascii	"Hg\366\255\016\305BY{5\025\224\222S\357\257\246\202\273|'/\257"
+	.ascii	"z6:\261F\2500\261\234\225\n\236\256\001\347\262%V$\264\325\031"
+	.ascii	"\036F\207\203\261\220\216+\317\034Bm\3614\244\362\032\263\312"
+	.ascii	"3O\371{0\235[\262\263\3143c5\377\345\025<\001\341\376\227\203"
+	.ascii	"Y\227?\270\007\003\341 0\037\374\203\013\200\035a\264\330\007"
+	.ascii	"\023\260:\302\340\301;\270\207\206\r\363`\001k\214f\013\336\342"
+	.ascii	"\035\f\240\313hFT\242\203\373^\377Bi]Mcr\260\016\246\2319\232"
+	.ascii	"\341\340\033\234\203\203\326\030\201\3300\016\036`u\004\252\r"
+	.ascii	"\276\301\001\264\214A\210\367\254[l\203\003t\035\315\216\364"
+	.ascii	"\271\274k\251\317#\025S6\026T\237\022}\3010b\303o2\3703\t\227"
+	.ascii	"\324\322;\220\264]\346\220g\213\217\365\013O\303f\367\202cI\032"
+	.ascii	"\222\360f\363\316\3253\340\225s1\302\025\023\034\372<\224\324"
+	.ascii	"\247-\366\371\312\032\336\263~\326k\314\250'\224\007\"\202\275"
+	.ascii	"\035\272>\b\"\375|#z\300#6h\364\363\211\340\3714\364\200Gm\023"
+	.ascii	"=x\320\200\b\202\203\335\020\001\r\037z\276\ri\363\206\202\301"
+	.ascii	"\036\360\b\304\217\227\201\304o\347\201\247\373\260\303\031\371"
+	.ascii	"t p<`\0207\204\240\177G= N\304\357\007\304\265\312\341\321\214"
+	.ascii	"o\254cD|\244/{\243\350\212k(\276\r1\261K\2409\333\230\360\251"
+	.ascii	"_l\311=\353\360\345\322\232s\226\200b\240\257\376\226\3633\216"
+	.ascii	"f\262\f/Y\232\232z\315<*F\225W\212q4\211!f\370e~o\f\341\272\007"
+	.ascii	"\373\212U\260\230ft\262\242s\251\321\375\212\305\347\372\231"
+	.ascii	"\217\025\t%\321\350p\222\367\255\205\205t\220Y1\205!\372\334"
+	.ascii	"\323\220\211\345\346\234\2310\306\321*\306"
+	.string	"x'e\245x\325<\354d\212\316\305k\214\356Q\274T\034\200\221\250a4\305\234A\212\311T\220\202$)\244\003\260\002\031\241In\021`5t\306$\005\205I\332\f)-\251\276\217\202$\365\302\206\020\f\030\225\216\276i\t\357M'e~4\016\376GYt\2676\205\221X\037\317 \375\342'\022b&\361\245\351\r\274i\031\335\267\252\273\332o\313Q\017\302\230A\334\331v\302\330\013\031U\034\372\333+\342\374\343\256\363\231\315[\034W\333\342\036}eHM\230\362\020\205$\343\234X\305\005\223\343Bz\217\250\365f\323\200\034\3610D(\026\341=\250\277B\262O\035\006k\345-\363\267\241\205=u\310\n&\017\326\207A_\254\240\306\3150Wmg\210\303\003KJ\333\264\2509%H\\\211r\246-F5\267\217\302\334\252\302\256\203`\026O|\203\331\242\314t\037\234\"D\223\337\340\227\366A!\321\266\002\320\031'"
+	.ascii	"\276\243P@\027\013X\022\225\203\330xx\375:\264\272\276Q\236\217"
+	.ascii	"\277\272\356\222\001\203vP\260k\242\036\227i\007\226\030\361"
+	.ascii	".\241T\025\265{;\353\002<6\245\377\001"
+	.text
+	.section	.gnu.lto_blackboxCompressRiceParameter.14.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\212\001\325\017"
+	.string	"\266\037nE\360\220*\035\352\353\216\213=[Y>\331\345\036{\002j\321\252%\330\366\324\315$\342\311-\207\237B\353f\306$\232\f@\361X92^2\323\006z\003[MI'\037\346\022gSbSyR\177\211\336\233\310\235RW"
+	.string	"V"
+	.string	"Y"
+	.string	"K\340\322\f\2749B\344\361'\374\226\233X=L\361"
+	.ascii	"\260\257\232\254\305nX\300\037\357\322\241g\333'\361\022+\033"
+	.ascii	"\246\013WfW\231\020\273\321\330\335\257s\001\363\262{\200y\251"
+	.ascii	"\037\276z\\\371\277]nX\221!\233\261\0369\024\354\256\243lv\341"
+	.ascii	"\326\333\376\260Mb?&\335\356\256\325\203-\2439\247\335\233\333"
+	.ascii	"n\315\303\337\223\321sFK\031"
+	.string	"\335\311h\355\242c\027\375\216M\007\030 ,v+\314\324\330\027\362E\304i\277\355\321\276}\024+\277\366\2339\223v\263\251VH\220\305\354\206\016\274\313\211\023\261_;\r\305cY\360\\r\024bv\003*\225\003\027{Q\355t\2528\030KG\214j\223J\346e\252\235\227\262\374\233\246F\243\252\213\030\006\227\006\215\336\366N+\312X\3360\363\252\321\230\203\335p\305\031\333\340S\250\274\335W\002\337\345\004\301\013q\351\247\314\313\353\007\210\226V\234qT\221!\306F\031;dEU\261\037'\320h\301H\tD\342\245NH\241\316\237\220\020\003\037\004\007B\236\001\017J#\322\210\264\310\223J\215P&&P\324 \002\030*\021\201J\241\357D\002\231>\021*\365y@\f\232\214P\337\t\b\242>N\270\2679\332i\251\313\036G\231\033\345h\227\203\315\340\260\321\323\246v\272\321\333\200\261H\235\372\330\215\326US\023\032"
+	.string	"}\246"
+	.ascii	"\226\"2C\203\021\353&0\230\013\227\304a\220O\360\024\207\247"
+	.ascii	"\211a`\224\021\034\016w\331D\227b\326\312\243\013\006\260\fd"
+	.ascii	"\003\266\215Z/\n\303$U<\270\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_blackboxCompressUpdate.15.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\b\275+"
+	.string	"\nL\254\020HpZN:\233\022\264\001m\020\225\225Fm%l\377\333\240\001\240\001\232\306?c_\247^0\207|\233\255\t\302\314\244j\177\365\021\355+\370\313\332\"X[\225$\005\243\264\375\373\302e\246\373\277\213\225\fA\322\b!{'\031\362"
+	.string	"\345"
+	.ascii	"\004\001[a\332\220KV*$\230!=]\325\206\352}[\362cHu\013\347\006"
+	.ascii	"\024\027wT\222\375\265O\351\366\351\372\234\302F\025\274\352"
+	.ascii	"\n\362\274>]\355\206\335_K^\212\034\r\022\353\323{\263\247u\253"
+	.ascii	"n\235=\212\362h%\326\252\255\b`]w9o}\210\003\240\326\030v\227"
+	.ascii	"Q\255U[\253\332\\\215\273\2343\322\323vj\365jx\311\356D\371'"
+	.ascii	"'\320\235|\225\243E[\316\031A3\255O\203h\2127\374\355\376\222"
+	.ascii	"3Q~\f\305yr\376\032\323\2263\031\202VZ\2376\331}\324\247\353"
+	.ascii	"\177\352\323Vv\2179YX\276\231\213,3\274\234\263\020\353\270\362"
+	.ascii	"j\212\342\253\354\373\226\322\216\243\305UuU\306S\324\300\032"
+	.ascii	"\030\261\034.,\364G\254\213-\305Ec\034\347p]\241\301\234\363"
+	.ascii	"\341~YpY\335\353[\3129\367\325\342z\361\366\275\273Atw\213n\237"
+	.ascii	"\233S\305~\017\244\372\364\207}\352\334\226w\257\177\345\354"
+	.ascii	"\231\330\323\312/\003\353\206\334\325\236\346\001\210N\353n>"
+	.ascii	"\374\266\007\2277\257\331!WM\354\231o^7\231\325\305`\335G3\376"
+	.ascii	"\352no\003\333\333G\355m\243\366vQ{\233\250\275=\324\336\026"
+	.ascii	"bo\007\261\267\201\330\333?\354m\2373\337=o\276\177\001\330\333"
+	.ascii	"<w\276w\330\333:\354\355\234\227\275Y\3666\316\237\374\353\307"
+	.ascii	"~\037{;eo\243\354m\334\336\276\354\355\013`\223x1\020%g\027{"
+	.ascii	"nr\\\352\006\344\315\237\371;\377\262\037\355\375-w\366\341\272"
+	.ascii	"m).\r\226lxoaoR\037C\216\261\342\261E\252\257e\210\026\251g1"
+	.ascii	"\272\345\360\201\264b=\263\337\374\225n[\251L^\255_\345V*\260"
+	.ascii	"\035\3119\267nh\"\256\f}\367nh\""
+	.string	"\236\362\003\352S\035\f\334qf\007/-Q\f6\364\002p\326\345\346\234\2530\006\353\034\214\203\237\240p\271\272mn\346k\230\376\205NM\323\231t9\370_\234h\230\200\316\326\3603M:8\030\270\303iTax-\341\316\236\275=3\227\337\307\031\026\271\374\266\342\343\324,K\217-\362\314M\246\333\237v$/ \356\223\371\335jv\204\2130\020\023\331\031\341#|d\2275\343\207\215\260\021[\326\f\"<\204\213l\364`\"<\364\006K\357\300\177x\b\007\315a\351Y5\021\302}1\267C}sZf\202\260\020\366\245\311\322\003\302?8\b\023\275\301\n\322\203\201p\021\333\013\250>\370\007\0135\261\204X\335\275\376a\037,4\227\245\247\244O\367\272\023\375\036\251\031\266#\"\324\247Ju3\220\364\3403\021\034\f\2250l\216H \254\347\236\021y\376\360\233\277\340\265dv\037\270\034U\322\2033\333\351O\342"
+	.string	"\272\234\257\034x\t#\220\305't]\200L\032\241H\024\217S8\310\020F\250\021D(\016\305\343T\033\345\224\344"
+	.string	"\205,\036\327b2\312\211D\332J\013\026$Pb\240\340)\311\210CT\021\252C\332\304$$\262x\234\2222\022\233L\030\237@\020\235\242\236\204!\240\234\244\204\304#R\230T\240\215S\305\243p\204\321x\024\266d\313\343\257\025\317\310\217\364\3467\212\356\340"
+	.string	"\230\305\004%qKl\325%\320\234q@8\332\177\367\344\246x\305Ea>\334M\301\302\275V\007\263pU\373\\\026w_\300p\257\225\342\340\025\256\352\253\206\344\231\361\313\036D1\213\257\023\343c\024\373\314.\306\330\327\314\360\264\023k\316\371\301\305\247R\327w\276\3610\265\214\304-o\036\233"
+	.string	"\352Ms\261\2565\272\024\203\265\t\"z\370x\277_D\340\356\313|\007\263\340\301:\033\276\307t8\275\246O\341\301\207{\233\273a\002\206\3455\351\204\335w3\200\243\250a(\305\230R\312\221\031\021I\222\024\322\001\240\002\031)\272y\021`5Ud\222\202\202$\255\001P\003\251\235\036\005;\231D\201\rC\247\351\037\026\225\212\224\231\204\275Y&!\302c\n\303\355\025\334l\223y\3578\367\005\300 \212?Th\336\255\314\340#\206NiJ\273\210T\362hNp\033\212\247h8,\025\226C\023JB\2332\220P!\320(\267\353\247\202\272\213\327\361J\260\276(\224`4\234\034\266Q\026G\367\tsCe\223\037\370G\215[\327\246\364i`|\205\357\353j\013P\231\034\221\340\006\220a\360\2402\f\025\304\300g\330$\032\235}p!\254\224\332\360C;Z\333\324!wP\302"
+	.ascii	"\371\"\361\033t\306p/\346\274\025I\034\037 \3276Tg\315[\243\304"
+	.ascii	"\2664\271V\234\301\354\034E,\325\213\275j2\n\330\254\375\310"
+	.ascii	"\201Ha\367\310z\300B\020I\376\353\036Y\"\377\020\365\320o+\001"
+	.ascii	"\342\327\204V\204U\243\344\351\024fy\316\035\350\301D\214\n\200"
+	.ascii	"-\275{\262\3343\321GY\342\027g\306\rqy\223. G\256V>B\222\232"
+	.ascii	"\212\003\341s4\016a1\276\334/>\017\205{m\343\2627\266\303\374"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxCompressWriteFrame.16.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\370\021\335W"
+	.ascii	"\n\222\350\037P0\224\322\031\0165\307\023\027\242N*\"10\350\247"
+	.ascii	"f\314\240,o0\2723\3707`\205\207\224d\321[\315\2014Z\334:\364"
+	.ascii	"\333\033!?W\002\005\2029:\256uE\336\275<\353\264\240\241{\257"
+	.ascii	"w\237\307\031^D\264P\360iF\233\354\275\245L2\355\001\305\001"
+	.ascii	"\366\0017b\213\021I/b\351\354\005+T\356\266\177;\232\355\355"
+	.ascii	"\221\310\231{!>D[\245\305\265\251\r\177\020\352\360\333\324\206"
+	.ascii	"J\353\251\334\330\326|\250K\241\217\317F\344k>R*\036\0240$\350"
+	.ascii	"\224p\357\303\036\355b\016\304\203\270\231\2371a\215\3705I\305"
+	.ascii	"\263\n\343\202\265D\270e\236v\274\332\017\365\211\352\001\254"
+	.ascii	"\032\336d\315\207^\2211\222\265\331@ee\214\227\022\270~\b\262"
+	.ascii	"l\353\272\362\2060\305\035\214|!A=\212>\t\367\fE\036o\266h`\302"
+	.ascii	"\270DP{ \262/;\017*\223\207\035\214\301(\023k\324\013M\264\214"
+	.ascii	"\352Q5\215p\367e\373\345\311\210\\\007\243\372D\245.\331\234"
+	.ascii	"4\327u%\252G\203\347\201\351\307v{[\3448\354\301T\240\206k]\327"
+	.ascii	"\336^\314\t\t\352\310\216\260*\315u\365\002:\312\313A\210\362"
+	.ascii	"\305\212\374\313\251\217\354\350\001\256yt\037Vd\267w\364<\330"
+	.ascii	"\366\3167\302\335\257\017\324'*\236\024\326\225\346\272R\001"
+	.ascii	"\035]\245=\211\020\262W\b'L\254Q`Y\031\250GO5\341y\3676\334\313"
+	.ascii	"\361]#\234g]\245\310\365\260\256^/\326H=\272^\017 =\252\036\230"
+	.ascii	"\036\335\343.\334\275\262\326\207UQ\206\305\255\353:\3241,\214"
+	.ascii	"]]]]\335O\257o\217\217\337\321\361\365rx\352.E\317\346\343\036"
+	.ascii	"\354\004X\251\223\252z\372\316\223\353\234.\232fo\316\244zr\006"
+	.ascii	"\200\344\212\324\307Z`\337\2713\202\344\312\231T,\234Gr\315\263"
+	.string	"\237Aq\017\006\253\025\236\363\303\333!]Y9\271\312\244jr\346?Y\250\230\360n\311\323\263\205\016Ch\331\251R\236\002hiR\226dT\205\237;UF\316\340\232\363TU\024\367\317\216bq\255\271\262Z\341\274CZ\327uY\252\312\352[\342\273\347\331]/\273<+\002EGK8\022\201\016\262L\234R\202\t\326Gz\324\250\003@s\206\3469bZ\230C\374J\222P\330V\346\315\350\350y{\333\203H\266\007s\336\370\226n\230(Z\205(H\216\"\276\220\332]\f\030j\207\321\333\272\256G\02002\002u]\327\242\243\313O\022L0#\253\312\b\351Q\024}\242I)\371\231\337\204%\233\006#\306HU/\2200\n\222\347\366g?\267\256x\271\006\350\273\024\034l\321\266H\335\263Hw-8\030\217-\002\340\255\r\222\353\226\227i\314\225\347v\275\240\270\261v\177\224%\327\334\226\262\373\343\335\001\344u"
+	.string	"\310\253\343\307\333"
+	.string	"\2207\307\217\027\307\217\367\306\217\227\201\037\257\215\037/\322\217\267\306\217w\201\037\257\020\310\253"
+	.string	"\2207\001 /\002@\336\003\356\366=\372\333\327\250\b\310K\343\315\357\f \257\f /\021\2207\306\217\027\306\345\276C?^!"
+	.string	"x_\374x\203~\274@@^\027-\036\346\373\003\344\r~\314\327\347d\276=\237\373\252\270\327\237\342k_\024\357\372O\334\354\373\373\361\362\374xM"
+	.string	"yK"
+	.string	"yw~\274:?^\337\217\267\367\343\315\001\362\362\200\274*\220w\367\343M\201\274\350\217\367d\336\346\341e\036\336O\320\353:\343B\315\272\"\251\203\263\256\241g2\374\355w\373\233\377\334/\367\207\371\307\374d~\265\177\3557\373\277\356\333\375\036\211\313\355\347\016g{{<\366H\002=\302L\\:C\\\017f\330\021$z\354\333\374M\372\365\306M\221\314\210\324\226z4-k\323\343l\300\264Mi\251o\356\327lo\217Ig\356\325\030!\325\270\340\262\340\222\276\346\003\016\212J\232\244\rA\335eI-\026\354\242\367rG,G-\351\245\200:\370\363HU\264\213\3564e\nPK\230*\372sh\260U4\313\355q\213\273\024y_a\\5p\t\266\001S\272\340\374\201\024\230k\022\317YV\305=\210\214\343\323\037S"
+	.ascii	"\367\364\356\221\313\261\013_\312\247\237$JT?\255o9\327\323'"
+	.ascii	"\363\240\332=\315qv\215\266\332'\302\222Zi\357\372\004\232\325"
+	.ascii	"\315\330P\323\276\0304gM8\2362RI\254!y.\211\242$;v\003\245\253"
+	.ascii	"\313\226\264\261\326\203-\272\223\247\234\245l\2515?\371\214"
+	.ascii	"\236\242\3212\216J"
+	.string	"xK\361jZ\216_d\230\225\211\313\202\205F_\215\251\260\fW\312\304Y\251\302_\264\364\250\214\366\231\302fF#!\321\306\0223s\266\"\276\306\316\306Z\242\216\321J`e\242X\216\241pV\361B\274\305p\374B\243J\f\fXD}!\232/\024}\262\232{\364\302W\307/}F\214\013Qb\264\317\2244\346\272\224&\211\202\\\363\034\261 \230\253\232\337\212\230\030\266\025\356l\264\3216%\035\267\340\201Q\335\207\320\237r\202\354\024\335\375\344\226\363\033D\372\346~2\313\257\337\2736%]N\034s}s\373\317\374\324r\243\227\233\260\0235\214\201F\352\033\235\"\215\215f\240W\244Q21j\033\335S\246dR\243\027h\244'G]\243Q\304I\322\005\335\250\027\350\023mI:\250/\302^V\302K\316]\233\324\021\n\264\260wn\224t\t4\002\255@\247\210\223\324:\352\004ZE\331Y\244\0074\002="
+	.string	"Z2\013\024\327\255Q\037\320\003\264)\351\272,[q\022\033\373*\273,iqC4L\270\034\365\335^0\225q(\013I\016\336\re\\(\234p\304b[F\375\267_\020\005\351\266\033\304SF\241\267u\215:\272\333\336`\251\034<,:\304\255kTB\222\206\021l"
+	.ascii	"$\211\003\325\330DT:\233\214C\245S\003 C\342\006\250QH\221\330"
+	.ascii	"\264D\324`\3104\244\007$\311I\003\242q\310\244\372H\002\301\007"
+	.ascii	"\021\204\364\307\233\204\f\211ME'\"*\361*\221\321\251H\354`\310"
+	.ascii	"4\204\3074l\"2\025I\215C' I\035\244kDD\004\303hF\f%\241\236a"
+	.ascii	"SR\223\021\335%!\243q\3104$Hq\251\207\007E\245\037KI@\224\206"
+	.ascii	"\204\020\223\202\f-1\031\207\204Xlq\310\220i\250\251Xd\032\352"
+	.ascii	"y!\337R\026\202/k\310\206\332\017\276\276\206\334i\254e\022\361"
+	.ascii	"\216\336\217\035[8Bq\240w\364\307\316S\246\244\253;\213TG;\320"
+	.ascii	"\313J&\rt\216\326\001\007G\253\r4\212\226\324\202\312\321+\206"
+	.ascii	"l~K9\033tp\264\022\030\021\037\303\321%\320t}\354<\3260\301\234"
+	.ascii	"\207%\215m\305\341b\017\"\301\236C\346\305\327X\333#\223\323"
+	.ascii	"\242\233\b\006\372\357\327<\375.0\265(\226s\201\303,\032O\373"
+	.ascii	"L\351B\236f\256V\2363\373zA\375\\[\364\315\202\376\353\026\375"
+	.ascii	"\263\377\312r\315\217s]\257j4\277\330\247M\364\212,\024X\307"
+	.ascii	"\030\224\375d\302GF\003\347h\361\362%\232\227\367\351\022\375"
+	.ascii	"$]\357\211\211\256\253;\217\224\005\036\303h\237\036\023 \316"
+	.ascii	"\351\235>\363`N\352\221\312\321\n_j\203\311~Z\235\336\361\265"
+	.ascii	"N\357\322\222p\204\336k_\247n\222O~:\350\275F\313\222px\235\323"
+	.ascii	"O\243\244Cz\371O\363P [\222\203\332Xj\034\rWR\336\372\236\350"
+	.ascii	"\214.\352\251\022/\246?\315\004\226\346#K\362\323\017\363 \322"
+	.ascii	"\247\177\272\303"
+	.string	"\222t\276e\035\214\376\017\017\"\347\344\276d\031g\355\304\203\244C\r\243\317\266d\233&C}9\241\016\352\241~\234\244\326\213\026\352+\351\212\251\212~\321\2732\345\031P\007\003\201x\250q(\347\224R\210\204DD$I\222B\007!\005\304 \006\245\303z\021@9T\246dd\024%I\226\003\253\221T\347\323\203\006\203\003\214@\030\336\211\223\304)PG\266kN\350\324\002\313_J68\317\354"
+	.string	"\314\342\027\253,\022S\034,\004~\232`9\337\276\253\016\016\344\0170HV[\370!\"\327\260(p\256\243\332A\262\351\312\346z\t\020u\346xK\237gG!\222\224o\t\262Qc\342\021!:@\215\020x?\022\003+\367\013\346\363\013\242\221Pi\325\364\257\356I\211\214\034C!\222\233x\316\205\2367w\250\002\037\350\221V\312\333\251\312<\016\370\025\266\030\316Ri\001HF\005[7\265@\227\250\304\345:L\240\017*\343k\256\363Q\202\203\\\377\354dX\371#\020\b\334HK\371RW\376[C\037\030\234\344\223\356d\214\274@\276\360\261\037T\326\213\225\022\375x(m)\3766\021\241\350.\331L4\245\337\031b\005\006\326V\035\004\360\003"
+	.ascii	"\n\273f\311<\226\224\304\032\270\223b\355\256\304q\270\230\251"
+	.ascii	"WiE?,\227\325\334\276\020L\205\243\003H\217^\245\020\264-ar\323"
+	.ascii	"\226Si\017"
+	.string	"9\376}&\307;\r\341c\323\214\235\216\364\025\330\302J\320\254\210\244\267\226\366%\016\343\371\277\351=\223-\006\304<\201\247\354\372\205\261\260o\212\006\322\017\017R2(~\265\023\256N\217\264y}\231~\274d\024\334\344\365\314\246zhk\234\330e\206\366\361Bt\251\237\3205\tM\305\355\214] \233\365\344\020c\323\316i*\0379c\240\"\266*\261\2409W.\346\020\007\2745\211!\364830$(\211\323\2409\267\026{\315{\302\314\200\022~\273\301p\231\277\340\314@\216\367\354;\202&\343\0135\366\364\271\224\366\231\241t,{x\3222\031\023\361\273\310\217\021\360\023\235\016\331\315b\211\304\215\027D8\224G\303\362\364\232x\003\202\262\212\315I\003\214\016\267s\0325\022\3416{<\217\251I\322\2561u\030~\333\253\353r\024\321*\307\341\346\253c\306\304\324LI\037}H>\264\024\356\037n\252\215<\242"
+	.ascii	"\007\032=\002\317|\0165\033\260G\030\314\236_^H\234f\306!x\021"
+	.ascii	"\t\032\t&\262\301O\360AQb^8C\241\365u\257\016\310 ,\020o,4s\307"
+	.ascii	"\331 \327\277\325\365\035v\036j\r\353\266o\321\rx\215\262\031"
+	.ascii	"f\260\343\270\006P\205\355\314ad\260\003\033\251L\306\375\320"
+	.ascii	"M6\246\326H\031#\331\302\220P\3127c0\325s\324|\333e\020|kl\254"
+	.ascii	"\260\225\272\007\016mZJBM%]\252\332\025A6\017\202\b\242\237\351"
+	.ascii	"\323x\030\242\207\315\332\035\020\360\017\b\331\024\322J\315"
+	.ascii	"\004\212\274\376D\332S\243\362f\250.m\003\240u\307F\212\252\370"
+	.ascii	"\212E\343\314\r\2064q2\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\005\b"
+	.string	"\262\213-3PO\323\001\244\247\255EFj\204f\350u\353M,\353\234\341\370V\303F2\212%"
+	.string	"IU5v\211\f<\374o?\374IG\320\350&B\303\314\216r\247\024\276\210\366+e+9L\215\206\271\301\361hD-#\376-/\032\312\203\211\221U0/B@,\230\033\216\243\334dV\224w\251\002\322\202\202R\362<OX:>\376\362&\177g\373\254LO\n%\230\320KB\007\276\273v&&B\017\236q@\370=\250\200F\255\214V\016J\271\270$\r:Ut\266\017\203Bn\001S0x\2665\t\005\017"
+	.string	"A\357lC\033\343\216\330j\253x\374\273\273\230J\316\366a\002\036"
+	.ascii	"E\030\n6\003\245\201-\200\362]Fcu\013\030\3325t\335\206\304\261"
+	.ascii	"\256\001j\007@\347\003\331\360KAF0<\037\331\254'\206\304\201"
+	.ascii	"\317\201\357;\204\025\361\215\251\002\302\303\215\005;\007\206"
+	.ascii	"UZ\004s\327\354|\002"
+	.text
+	.section	.gnu.lto_.refs.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"\004\b"
+	.string	""
+	.string	"\002\t"
+	.string	"\001\002\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1427ec20d815a0d6,"e",@progbits
+	.string	"(\265/\375`\254\027\345n"
+	.ascii	"\372\263\264'S0\022JJ\007\273^\032\325\237\263\377\217\327\275"
+	.ascii	"\277\214#r\317J\311\346e\214\022b\323:"
+	.string	"*]+\253\245\247(\240\312I\277\265\326s\023\231\375l3\346j\251\260\233\377\037\243\256\353\356\324xj\246\375Ua\310=\274c\016Q3r\241R+\224D\270\277\224)\f\002e\002|\002Q\365<\346\315\315\246\251\205L\232[[\263\2411\031\333\362\032\2631\027\n\346\362\025\023\234G\314\272V:vC\330\251\361\242\236Q\244|\307(\324\274T\2569\250\016\350\226\b\340\270\246\326\234\270\256-e:\r\255\227E\371D\322\366\254\007'J\023+^\332\236\305\324\263\325\017T\306R\370\213\241Nk\265\005\250\214\251\260\030C\235\0368I\243\273\367\222\261\031ka..\343+\3471\306r\273\236\243\374|u.\343,\354e\200\322\275QB\b(~YZ\023\275wM\221\242'\005\357\210V\322\224j\317N*\367\334P\317b\374t\342$y\032\233k\313`l\205\271>\306al$\013\321H\333\007U\031z\037KW"
+	.ascii	"\235\253\244UW\206\240i\373\237z\376\372\031\213\263\330\253"
+	.ascii	"\231\367\036\357\275\002\264\326\r\213\266\345-\236\302\\>\334"
+	.ascii	"u^9\312o\216\353m\336\273\216\270q\033\223\203\263\355[Ps\202"
+	.ascii	"\316\316\037\020u'8\217z\366IG\260O\312M\240\263\226\2114\271"
+	.ascii	"\\\357\b\236\025,Ium\273\325C\371D\232\303&R\313&R\022l\"E\200"
+	.ascii	"O@\371\371\t[\371\360\220L\314\353\274w\345\321A\343f\254j\373"
+	.ascii	"\225O\244*\233H\353\026\370y)\213\355Bc\245G\3607\017\216\237"
+	.ascii	"e\034?\300\3374\374l,^\256\341:\177\277\3004\360\r\236\341g\244"
+	.ascii	" \257\177j\376\243y\035\247`t\236\277Y\370_\366\377\371_\313"
+	.ascii	"\177\257\377\316\377YV(\272\211\277O\320\370/\367?\3568\177\207"
+	.ascii	"\300/f\274\304s\376~\340g\337\317C?\253\360s\007?o\360s\320\317"
+	.ascii	"\030\374\314\342g\t~V\3613\003?\033\3603\001?\367\374\034\300"
+	.ascii	"\317%\376\333\375\237\373\177\366\237\313\177\023\376\207\375"
+	.ascii	"\357\3729\375\237\366\263\315\317\366\347\376\231\377\337\375"
+	.ascii	"\007\363\277\355\277\333\177\030\377\241\377\267\374G\373o\365"
+	.ascii	"\277\201\377f\377o\356\356\356\356~\336\375y\317\237\007\204"
+	.ascii	"7\334\320O\007\200\tbW\205\303\373\311\346\311s\365\321f#eF\016"
+	.ascii	",\b\265w\025\324\310Vz/}\251\235n\326\333\204c\274r\242\212\336"
+	.ascii	"e\322\347o\345\333\351s9\367Z\335{\rH\257\352\216bm{G'\325\037"
+	.ascii	"Z\200D\223\335Tb\355\207\247\263^\232$\034|h\313\325<\370\212"
+	.ascii	"\205\222\353r\325\266\231\030\312\013\242\203W\\\333\326\301"
+	.ascii	"\317\336\23141\035\332\276\f\337\244iMui\332\236GD\375\373Oo"
+	.ascii	"1y\357u\262Yo\322\230\223\262\r\263\317\257\303<V\340\277\345"
+	.ascii	"M@w\357\222)2\252\020`\305 G\340fp\211U\307\242\222\347\2567"
+	.ascii	"\211lF\021\221ZkJ\236\365\016\021\3406w\270\3105Ji\231\267\357"
+	.ascii	"z\371\036\243\224/ Wf\022\2712\211$\356\221I\274wU\222@:\213"
+	.ascii	"DF6\243\224\310&S\311s\217\227x\233\305!\352\221\251D\2361\225"
+	.ascii	"$\220\315\242\022y\214R\362PM!\311A\207T\021\216\211\310\343"
+	.ascii	"\345\261\003\252\230$\001E\256\314\013w/;\223nR\201{\241\230"
+	.ascii	"I\270\242\017\266b\204\3620~\025\231\274\336{\007\330a\224b\336"
+	.ascii	"#\024I\305\274\227\312X\343\356\220\200\270B\257\021\206\022"
+	.ascii	"w\200\272LI\367\022p\327{w\334K\344\013\275\367\022\357\275\275"
+	.ascii	"$\324z/\020\022\310\251\035;\356]\366\354\270P\304\260\244{\333"
+	.ascii	"\031gE\211lJ1\201\302\266\232S7\307J\344\251\013\027\225T\233"
+	.ascii	"D\254\3134F\235R\366\020\003\300\262\t\217$\226\263aB\202$\301"
+	.ascii	"\321G\255\245\242\217\266}|\346X\251Kzj\3433\t\217$]l\242\227"
+	.ascii	"Z\217%m\317\326\253\2521\246\276w\2742U\222\354\332\332\035S"
+	.ascii	" bqqp\352#P\303c\344\350\200\324\360\031N\263s\\/\361\306\027"
+	.ascii	"\035T\321:^\303\\\254\206\311\234\313\260\231\3335E\212\036\034"
+	.ascii	"\263\037P\234\244\366\234\346\3470,\206\321X\t-\210\264\266\034"
+	.ascii	"\005:\243ya\007\246\221\266?k\352\235\314c\227\372\276R\357\274"
+	.ascii	"|\"\275\271l\202\016\314\210\267/b\217\266s\316\034/Z`8\332\276"
+	.ascii	"\205P\317Q\342>\306P\347\006J\310\276\260\027\346b9\356\342\224"
+	.ascii	"c8\366\3329\256\n\2009QU\365\244`-A\f\001\226\332\367Q=\007l"
+	.ascii	"\335\306Y\267)\325\2423#\246\305\233\327\030.\3576\257\036VG"
+	.ascii	"\326\244_\352\315\336[\314Z\315\236\335k\204`5\302]$\224\217"
+	.ascii	"\316\224ht\r\364\255f\235\230\315\3533bi\313L\332\373\353\255"
+	.ascii	"\315,\253m\243\275\273\202\364\360Bu\326\303Y\232\230-\365i\225"
+	.ascii	"j\251\270\336T\270\272\214\347\226s\211Y\267\251\007F6\306)z"
+	.ascii	"\221K\037\034,\035XjW\336eo\262\025\023\374\213Z\305\304\255"
+	.ascii	"\330\266\263\274\261,\321\236tc\215\345\277\021!\004\221f\223"
+	.ascii	"\037\352\037\310zR*\333\266\330\277P}a\n\323\266\237\037\313"
+	.ascii	"Y\276E\213\204\245I\261\031\333v\225\006c\256\233\265\225\357"
+	.ascii	"<sp\2319\251\267\201o\226\266\327\373\353\277\271y\n!\022\265"
+	.ascii	"\244\376\335\325\345\026d\252\355S\034\352m\354T\373\324[[=\245"
+	.ascii	"\207\311\223\223\013b\027\275w\351\323\\\300\3345y\231\367\224"
+	.ascii	"5* \272\332T\336\nz7\233\354\225\201\363\026\225>e\311\271e\364"
+	.ascii	"&\311\034\340A\002mB\245\332+WW\235\245\222\270\306\266#S\320"
+	.ascii	"\2659\254w\226e\326Ui\265\355\265\217\330\\A\003\262\004:\"J"
+	.ascii	"\305\203\363\207j3\347\304IC\321j\252\"\206\215\314\352\re\255"
+	.ascii	"\2071J\333~\322\311\236[\362c\356\331\205jH\216\266\267)\252"
+	.ascii	"i\021&=\004\223\256\272\271I\"H\021\3218\270g\223w\325\307D,"
+	.ascii	")\025\223pQ\323\264\251\251\246*1\325\333\222\232\273ir\252\373"
+	.ascii	"A\2107\025?q|\334\220f\255\225$\255r8Q\322A\204!\022e\353l\275"
+	.ascii	"U\304\250\226|\251=\034E^\244\201\340%\006R\316\350\356r\351"
+	.ascii	"\303eD\2541H\336@4\220\003\034\262m\033\351#;mO\260\330\216\374"
+	.ascii	"\240\303G\335\224]\317\207U\0172>0\231\021?\236F\336\332v\017"
+	.ascii	"\fe#^\320\2500Qo\314\204\bi\")\234\355\360&\242\303\344TK\266"
+	.ascii	"mfK\245XRM\214RQi\2234\034\220\314eY\002\t2\204\273\330\224\t"
+	.ascii	"[\217m[\007\366Z\237\230\324>fq\b{\202VD\345A\tzCq5\024\273\251"
+	.ascii	"F\244z\235O8\272{\311\034\350+&4\333C\345Q\tz\003\001\3621{s"
+	.ascii	"\274Q]\246\3247 \\W\324\250<\262\240\367\222\253\227\037\313"
+	.ascii	"\300\251\336fU\034\335\275K\007z\321\034e]k\252\210\2455\204"
+	.ascii	"HE/\212\200\300 !\233\341\321\2177\024\372b\350\370\204H(\240"
+	.ascii	"\250H\003\021>\242#\337o\003a\214!\337\317\021\320\310\bH\204"
+	.ascii	"\302'\003Ht\304\001\215\241\0334~7r\206\302# \221\315\215\"\""
+	.ascii	"\241\243\337\260\350\207\024CHH\3475T\3208\372\005\207\302\037"
+	.ascii	"\237\f\244\"\242\243\337OP\210\364\023@Q\021\322\321\021\360"
+	.ascii	"\2507\024\362\335\370\t\323\030\200\301\032C\340Qo"
+	.string	"\306\220\257\310\016}B#\237QZC\210T\364B\004\023>\200\3613\364\321\b\016\r\021p\201\bX\344\302\027\004\2720\362\r\2053\300\030\361\202\200\023\002\b\372\206>\243\241\340\020\t>\242\037\tC\237\320W\302\211\035\023\276\033?\030A\337\214\031HA=\257\241\002\370S@\3077\034\222a\003\t\347D\277\240\357\310GC\275\004\024<@\001\013\031zg\321\002\202\026\020\244g\321\002\b\250\005\005@\352)"
+	.string	"\342\rm\204B\276\341\320\020\206\213\031\"\206'\032\036!\001\211l\204BA\337\360\027Da\370\213\201#\034\376b\330\241\020\213\336\3605|\016\264\341\013\376\f\201\300\340\017\216\021\022\214\242!$\031?\241/\210#\024\222Q\344\373\275p!@O\210\004\374\301\340\013\332P\207B+\"\030\036\375\220\324W\260b\005\004\025H"
+	.string	"\024C\005\212[`\201\013\004N\030\241\003\225H\205P\350\013\3320\002\022\t\311"
+	.ascii	"\214\341\002\321PQ\214\237\243\337\220\321\017QP\370\243\242"
+	.ascii	"\201 0\030\344 \b\034\022\375d\370\2026vt\020QB\245MJ\333\233"
+	.ascii	"+^\016\336\022/\007O\211\223\311{\227\027\220\315\361\220\347"
+	.ascii	")\021\223\224=I\375KM\311\330T\177^\222SS\321a\354\210\243-\007"
+	.ascii	"\355I\213\323\2724\265F\f\317\2506,\343F\245-\217\330\274\313"
+	.string	"+\236G\354\273\234\343\312#\332{\213\314\t\3540'`3\206\244(%\265\357EQ{\315N\332\233\033\234\223\316\321SN\221\322l\273%\355\342dM\230\266\352\2173\235\346L\243)\201\205\355\007\272\273LF\337h\332L\257K\b[\333\221.\323\013s\256\321\221T\233\314m\026S\207W|B\003k\253\256`z\f\230\026\323L\246\227\261\211.\314[\f\217\013\023\271\246\266M\327Jl\250\fQ\004\253\215:Q\246\336\260\264}\017\307\\\031\364\352\316H[\325\256K\177\351\322r7D\033v7xy\3135\030\0261.m;\216\237i\323*\206\356\f\334\323NTK\233\322[O\341\372\321\203T[+\204-\201\360\250\301$g 4\"2#\"\222$I:\021\005\204\030\006\255\245\035\022`55\021*\306\214\020IRPP\247Vc\240N\226cH\350\271@?\305\360M\035v\341\033XNr\030\307\312C\310"
+	.ascii	"R\370*\024\341\204\205\362\351\005U\201\033*\013,\212o-\261V"
+	.ascii	"\027\024xF\365\013Gs\017\366\342N\020\251\\\034dS%h7r\224}\343"
+	.ascii	"`At0=+\211B\0368\2269\221\272f0\004Gh/\004Yc\272\343L\340\nw"
+	.ascii	"\310\271\363\312{K\020QX\322\200\333\350\270%\245\202\013!\206"
+	.ascii	"\020\231h\254\034S\357\371i\217\312?\227?\002$\033F\201\343r"
+	.ascii	"\330x\331\316\307\336\260\224\221\210w\0015h\300~\244\244\252"
+	.ascii	"\023\004"
+	.string	"\b\267\340\326\352\352\035\345s\037\253I\0310\261\363K]\301\314L\r\204ol~&S\311\363\231\246\214\200\240\345\301}\260\213\"\270S\332\"\235\224\r>]\337\241\273\266+\236\021FB\273\317\013\003\206\255\"p\212\020\037\020\016\004\025\221\344_\334 (=-\231\213H\341v\322\224\034\266\246\204\023\337\271\003)\030L[\"0\226\032[\3161j\340\r\342\322\352\030hw/hB\005Q\002\\\332?\354\251\353;\276]\362Ly\241V\254H4\260B\352\364\334\305#=\205\316\200\212Lb\211\253\237\005\3343\354\275lt\237U\364\224\030g\342~\031wx\211\243$\235\346\247\246\273\200\340\203l\250\324\020\247\202\b\204L\025\361\005\233\212\225\237w\321\362\360\315?\205\367\373@1\357=e\334\363X_\3348s>/X\313V\f\223\367\021\267\202&\275\003\2556u\352-\006 \214J\020\247b\357\347)\255Lc\321"
+	.string	"_7\227\36465\220\r\322?\2075\214\222"
+	.string	"(\313n\tLZ\212d\276\261bu\246[\316\t\200\004DGS\346\374\007\333Z`\362\271K\003\002\275\226(\273\021$\257\274\351&\022o\335\262\272\3759\322C\260\364\226\241\256\254\351\005\023Q\301\336n\"\310\267i\213\222\210qO\314P\206\220\313\370+@Wv\201\f\264b\221>\341\003%V\232D\361\235g\311Ho\f\202~\371\004\206=\272&vk\220\307\341\237\303}L\346\311\214\024:3\342\023\201]-\315\324X\335y\346_\257\"\360\215?\225\205\313\224@\303LoW\t\240\365G\235\337\360\016\237\326\324\n\211\332"
+	.string	"H\2111F%\203h\355\231\213\342\300\316 `c?\230@8\313\004\322O\344\"\270+t\302\241Z=/\302\237\325Y\"\220\234\226\032\007\212\264\241\246D\264X\001\252\026\205\363O\300.\203\303\330#\342-j>\177\217bj$\222Q=\252\022p\004\021I\341\362\317}"
+	.string	"\367\350\274kK)\227'lUJ\344)?\340:\036j\277\f\256\316\360\215UR\263\212P''\020l\334z\002y\036\314G0\364w\266X\375\022'KU\344A\363_\306\034\311\"F\361\226i;\255~\002[\363\032\206\220\303\356\216\212\2720"
+	.ascii	"zz\353\024v\325\001{\022$\025\3374\361Q\264\244r7\312\261J\361"
+	.ascii	"3\031k\276\003\334?\305\341\002\036\b\306\307\371\306-}]x[\267"
+	.ascii	"\226\303\343x\374\3227\345=\324\250\303c\020G\376O\234\353\213"
+	.ascii	"~\260\276/\357M\332\316\270?\352\t\366\247_\322/\273\370m\273"
+	.ascii	"\tt\240|\351\335\374\034\353[O\031\207\322\251\300\243\366\027"
+	.ascii	"\347\3420\273\27467\2726J\352\322\271\034~J\376\340{z\201\207"
+	.ascii	"%\342I\330\255\2623\210\336\373_\\\204\317\200\227\264\340\034"
+	.ascii	"\346.k\337,\016'\033{\314[\340\003\337\357\023\274o\215\r\201"
+	.ascii	"\335#\340\274\373\345U\362\261!^\367\034\363.\372\215\347\345"
+	.ascii	"\270!\254\3668\357\"GV2f\312U"
+	.text
+	.section	.gnu.lto_.symtab.1427ec20d815a0d6,"e",@progbits
+	.string	"blackboxCompressReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"blackboxCompressPredict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"blackboxCompressRiceParameter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"blackboxCompressUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"blackboxCompressWriteFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"blackboxWriteBufferCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"blackboxWriteBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"blackboxFlushWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1427ec20d815a0d6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9712 @@
+	.file	"blackbox_encoding.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 5 "<built-in>"
+	.file 6 "./src/main/blackbox/blackbox_io.h"
+	.file 7 "./src/main/common/encoding.h"
+	.file 8 "./src/main/blackbox/blackbox_encoding.h"
+	.file 9 "./src/main/common/printf.h"
+	.file 10 "./src/main/blackbox/blackbox_encoding.c"
+	.file 11 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_encoding.c.c676b550
+	.weak	blackbox_encoding.c.c676b550
+blackbox_encoding.c.c676b550:
+	.long	0x74c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF1172
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1090
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1091
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1092
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1093
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1094
+	.uleb128 0x6
+	.long	.LASF1095
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.long	.LASF1096
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1097
+	.uleb128 0x6
+	.long	.LASF1098
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1099
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1100
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1101
+	.uleb128 0xb
+	.long	0x91
+	.uleb128 0x6
+	.long	.LASF1102
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xb
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF1103
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0xb
+	.long	0xae
+	.uleb128 0x6
+	.long	.LASF1104
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xbf
+	.uleb128 0x6
+	.long	.LASF1105
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0xb
+	.long	0xd0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1106
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1107
+	.uleb128 0xa
+	.long	0xae
+	.uleb128 0x6
+	.long	.LASF1108
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1b
+	.long	0x100
+	.uleb128 0x1b
+	.long	.LASF1173
+	.long	0x109
+	.uleb128 0x10
+	.long	0x119
+	.long	0x119
+	.uleb128 0x11
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1174
+	.byte	0x18
+	.byte	0x5
+	.byte	0
+	.long	0x14e
+	.uleb128 0x12
+	.long	.LASF1109
+	.long	0x30
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1110
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x12
+	.long	.LASF1111
+	.long	0x8f
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF1112
+	.long	0x8f
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1113
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0xf4
+	.uleb128 0xa
+	.long	0x98
+	.uleb128 0x1d
+	.long	.LASF1175
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1114
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1115
+	.uleb128 0x13
+	.long	.LASF1116
+	.byte	0x2e
+	.byte	0x10
+	.long	0xae
+	.uleb128 0x13
+	.long	.LASF1117
+	.byte	0x30
+	.byte	0x11
+	.long	0x18f
+	.uleb128 0xa
+	.long	0xbf
+	.uleb128 0x13
+	.long	.LASF1118
+	.byte	0x31
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x13
+	.long	.LASF1119
+	.byte	0x32
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x14
+	.long	.LASF1120
+	.byte	0x7
+	.byte	0x16
+	.byte	0xa
+	.long	0xd0
+	.long	0x1c0
+	.uleb128 0x9
+	.long	0x172
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1121
+	.byte	0x7
+	.byte	0x17
+	.byte	0xa
+	.long	0xd0
+	.long	0x1d6
+	.uleb128 0x9
+	.long	0xae
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1122
+	.byte	0x8
+	.byte	0x23
+	.byte	0x5
+	.long	0x70
+	.long	0x1ec
+	.uleb128 0x9
+	.long	0x15a
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1176
+	.byte	0x6
+	.byte	0x34
+	.byte	0x6
+	.uleb128 0x14
+	.long	.LASF1123
+	.byte	0x9
+	.byte	0x72
+	.byte	0x5
+	.long	0x70
+	.long	0x219
+	.uleb128 0x9
+	.long	0x8f
+	.uleb128 0x9
+	.long	0x219
+	.uleb128 0x9
+	.long	0x15a
+	.uleb128 0x9
+	.long	0x22e
+	.byte	0
+	.uleb128 0xa
+	.long	0x21e
+	.uleb128 0x1f
+	.long	0x22e
+	.uleb128 0x9
+	.long	0x8f
+	.uleb128 0x9
+	.long	0x91
+	.byte	0
+	.uleb128 0xa
+	.long	0x119
+	.uleb128 0x7
+	.long	.LASF1124
+	.value	0x15d
+	.long	0x24b
+	.uleb128 0x2
+	.long	.LASF1126
+	.value	0x15d
+	.byte	0x1f
+	.long	0x172
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1125
+	.value	0x154
+	.long	0x263
+	.uleb128 0x2
+	.long	.LASF1126
+	.value	0x154
+	.byte	0x1f
+	.long	0xae
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1127
+	.value	0x14e
+	.long	0x287
+	.uleb128 0x2
+	.long	.LASF1128
+	.value	0x14e
+	.byte	0x26
+	.long	0xef
+	.uleb128 0x2
+	.long	.LASF1129
+	.value	0x14e
+	.byte	0x32
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1130
+	.value	0x143
+	.long	0x29f
+	.uleb128 0x2
+	.long	.LASF1128
+	.value	0x143
+	.byte	0x26
+	.long	0xef
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1139
+	.byte	0xa
+	.value	0x139
+	.byte	0x5
+	.long	0x70
+	.long	0x2c8
+	.uleb128 0x2
+	.long	.LASF1128
+	.value	0x139
+	.byte	0x2b
+	.long	0xef
+	.uleb128 0xe
+	.string	"buf"
+	.value	0x13b
+	.long	0x18f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1131
+	.value	0x131
+	.long	0x2e0
+	.uleb128 0x2
+	.long	.LASF1128
+	.value	0x131
+	.byte	0x26
+	.long	0xef
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1132
+	.value	0x128
+	.long	0x2f8
+	.uleb128 0x2
+	.long	.LASF1126
+	.value	0x128
+	.byte	0x1f
+	.long	0x9d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1133
+	.value	0x11f
+	.long	0x332
+	.uleb128 0x2
+	.long	.LASF1134
+	.value	0x11f
+	.byte	0x32
+	.long	0x332
+	.uleb128 0x2
+	.long	.LASF1135
+	.value	0x11f
+	.byte	0x3d
+	.long	0x70
+	.uleb128 0xe
+	.string	"buf"
+	.value	0x121
+	.long	0x18f
+	.uleb128 0x8
+	.uleb128 0xe
+	.string	"i"
+	.value	0x122
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.uleb128 0x7
+	.long	.LASF1136
+	.value	0x116
+	.long	0x371
+	.uleb128 0x2
+	.long	.LASF1134
+	.value	0x116
+	.byte	0x30
+	.long	0x371
+	.uleb128 0x2
+	.long	.LASF1135
+	.value	0x116
+	.byte	0x3b
+	.long	0x70
+	.uleb128 0xe
+	.string	"buf"
+	.value	0x118
+	.long	0x18f
+	.uleb128 0x8
+	.uleb128 0xe
+	.string	"i"
+	.value	0x119
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xba
+	.uleb128 0x7
+	.long	.LASF1137
+	.value	0x111
+	.long	0x38e
+	.uleb128 0x2
+	.long	.LASF1126
+	.value	0x111
+	.byte	0x24
+	.long	0xae
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1138
+	.value	0x109
+	.long	0x3a6
+	.uleb128 0x2
+	.long	.LASF1126
+	.value	0x109
+	.byte	0x27
+	.long	0xd0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1140
+	.byte	0xf2
+	.byte	0xa
+	.long	0x18f
+	.long	0x3f2
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0xf2
+	.byte	0x2b
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1128
+	.byte	0xa
+	.byte	0xf2
+	.byte	0x3f
+	.long	0x371
+	.uleb128 0x4
+	.long	.LASF1129
+	.byte	0xa
+	.byte	0xf2
+	.byte	0x4b
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0xfa
+	.byte	0x12
+	.long	0x18f
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.byte	0xfc
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1142
+	.byte	0xca
+	.byte	0xa
+	.long	0x18f
+	.long	0x485
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0xca
+	.byte	0x2b
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1128
+	.byte	0xa
+	.byte	0xca
+	.byte	0x3f
+	.long	0x371
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0xcc
+	.byte	0x1a
+	.long	0x495
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0xce
+	.byte	0xd
+	.long	0x49a
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0xcf
+	.byte	0xd
+	.long	0xbf
+	.uleb128 0x1
+	.long	.LASF1146
+	.byte	0xda
+	.byte	0xe
+	.long	0xd0
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0xdb
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x15
+	.long	0x46c
+	.uleb128 0xd
+	.string	"x"
+	.byte	0xd1
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0xd2
+	.byte	0x13
+	.long	0x77
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"x"
+	.byte	0xdc
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0xdd
+	.byte	0x13
+	.long	0x77
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xcb
+	.long	0x495
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	0x485
+	.uleb128 0x10
+	.long	0xbf
+	.long	0x4aa
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1149
+	.byte	0xae
+	.byte	0xa
+	.long	0x18f
+	.long	0x4fe
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0xae
+	.byte	0x31
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1128
+	.byte	0xa
+	.byte	0xae
+	.byte	0x45
+	.long	0x371
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0xb0
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0xb1
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x1
+	.long	.LASF1152
+	.byte	0xb2
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x1
+	.long	.LASF1153
+	.byte	0xb3
+	.byte	0xe
+	.long	0xd0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1154
+	.byte	0x8b
+	.byte	0xa
+	.long	0x18f
+	.long	0x53c
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0x8b
+	.byte	0x2b
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1128
+	.byte	0xa
+	.byte	0x8b
+	.byte	0x3f
+	.long	0x371
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0x8d
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0x8e
+	.byte	0xf
+	.long	0x77
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1159
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x11
+	.long	0x18f
+	.long	0x5af
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x2f
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1128
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x43
+	.long	0x371
+	.uleb128 0x1
+	.long	.LASF1155
+	.byte	0x6f
+	.byte	0x9
+	.long	0x5af
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0x70
+	.byte	0xd
+	.long	0xbf
+	.uleb128 0x15
+	.long	0x589
+	.uleb128 0xd
+	.string	"x"
+	.byte	0x72
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"x"
+	.byte	0x78
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x79
+	.byte	0x18
+	.long	0xdc
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0x7a
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x70
+	.long	0x5bf
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1157
+	.byte	0x63
+	.byte	0xa
+	.long	0x18f
+	.long	0x5e7
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0x63
+	.byte	0x2a
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1126
+	.byte	0xa
+	.byte	0x63
+	.byte	0x37
+	.long	0xae
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1158
+	.byte	0x58
+	.byte	0xa
+	.long	0x18f
+	.long	0x60f
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0xa
+	.byte	0x58
+	.byte	0x2c
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1126
+	.byte	0xa
+	.byte	0x58
+	.byte	0x3a
+	.long	0xd0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1160
+	.byte	0xa
+	.byte	0x53
+	.byte	0x13
+	.long	0x70
+	.long	0x62c
+	.uleb128 0x4
+	.long	.LASF1161
+	.byte	0xa
+	.byte	0x53
+	.byte	0x2b
+	.long	0xd0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1162
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x18
+	.long	0xd0
+	.long	0x649
+	.uleb128 0x4
+	.long	.LASF1126
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x30
+	.long	0xae
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1163
+	.byte	0xa
+	.byte	0x30
+	.byte	0x6
+	.long	0x684
+	.uleb128 0x4
+	.long	.LASF1164
+	.byte	0xa
+	.byte	0x30
+	.byte	0x2b
+	.long	0x15a
+	.uleb128 0x3
+	.string	"fmt"
+	.byte	0xa
+	.byte	0x30
+	.byte	0x3d
+	.long	0x15a
+	.uleb128 0x16
+	.uleb128 0xd
+	.string	"va"
+	.byte	0x32
+	.byte	0xd
+	.long	0x14e
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0x3b
+	.byte	0xf
+	.long	0x77
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1166
+	.byte	0x1f
+	.byte	0x5
+	.long	0x70
+	.long	0x6b6
+	.uleb128 0x3
+	.string	"fmt"
+	.byte	0xa
+	.byte	0x1f
+	.byte	0x20
+	.long	0x15a
+	.uleb128 0x16
+	.uleb128 0xd
+	.string	"va"
+	.byte	0x21
+	.byte	0xd
+	.long	0x14e
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0x25
+	.byte	0xf
+	.long	0x77
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1167
+	.byte	0xa
+	.byte	0x18
+	.byte	0xc
+	.long	0x70
+	.long	0x6de
+	.uleb128 0x3
+	.string	"fmt"
+	.byte	0xa
+	.byte	0x18
+	.byte	0x28
+	.long	0x15a
+	.uleb128 0x3
+	.string	"va"
+	.byte	0xa
+	.byte	0x18
+	.byte	0x35
+	.long	0x22e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1168
+	.byte	0xa
+	.byte	0x12
+	.byte	0xd
+	.long	0x6ff
+	.uleb128 0x3
+	.string	"p"
+	.byte	0xa
+	.byte	0x12
+	.byte	0x19
+	.long	0x8f
+	.uleb128 0x3
+	.string	"c"
+	.byte	0xa
+	.byte	0x12
+	.byte	0x21
+	.long	0x91
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1169
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x14
+	.long	0x718
+	.uleb128 0x3
+	.string	"end"
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x37
+	.long	0x718
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.uleb128 0xf
+	.long	.LASF1170
+	.byte	0x6
+	.byte	0x43
+	.byte	0x18
+	.long	0x18f
+	.long	0x73a
+	.uleb128 0x4
+	.long	.LASF1171
+	.byte	0x6
+	.byte	0x43
+	.byte	0x31
+	.long	0x70
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1177
+	.byte	0x6
+	.byte	0x37
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF1126
+	.byte	0x6
+	.byte	0x37
+	.byte	0x2a
+	.long	0xbf
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 28 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 34 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 39 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 59 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF923
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF924
+	.byte	0x4
+	.byte	0x4
+	.file 62 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 63 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x3f
+	.file 64 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 65 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1028
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1035
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1052
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_encoding.h.21.6b5a7223d6e4ab47a21397b1e9a5f416,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.30.0a00ae9199efd475f4080a54886f9f0b,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1178
+	.long	.LASF1179
+	.long	.LASF1180
+	.long	.LASF1181
+	.long	.LASF1182
+	.long	.LASF1183
+	.long	.LASF1184
+	.long	.LASF1185
+	.long	.LASF1186
+	.long	.LASF1187
+	.long	.LASF1188
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x42
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1189
+	.byte	0x7
+	.long	.LASF1190
+	.byte	0x7
+	.long	.LASF1191
+	.byte	0x7
+	.long	.LASF1192
+	.byte	0xb
+	.long	.LASF1193
+	.byte	0
+	.long	.LASF1194
+	.byte	0x1
+	.long	.LASF1195
+	.byte	0x2
+	.long	.LASF1196
+	.byte	0x1
+	.long	.LASF1197
+	.byte	0x2
+	.long	.LASF1198
+	.byte	0x1
+	.long	.LASF1199
+	.byte	0x3
+	.long	.LASF1200
+	.byte	0xa
+	.long	.LASF1201
+	.byte	0xb
+	.long	.LASF1201
+	.byte	0xa
+	.long	.LASF1202
+	.byte	0x7
+	.long	.LASF1203
+	.byte	0xa
+	.long	.LASF1204
+	.byte	0xa
+	.long	.LASF1205
+	.byte	0x7
+	.long	.LASF1206
+	.byte	0x7
+	.long	.LASF1207
+	.byte	0x9
+	.long	.LASF1208
+	.byte	0x7
+	.long	.LASF1209
+	.byte	0x8
+	.long	.LASF1210
+	.byte	0x8
+	.long	.LASF1211
+	.byte	0x7
+	.long	.LASF1212
+	.byte	0x7
+	.long	.LASF1213
+	.byte	0x7
+	.long	.LASF1214
+	.byte	0xb
+	.long	.LASF1215
+	.byte	0xa
+	.long	.LASF1216
+	.byte	0xb
+	.long	.LASF1217
+	.byte	0x7
+	.long	.LASF1218
+	.byte	0x7
+	.long	.LASF1219
+	.byte	0x7
+	.long	.LASF1220
+	.byte	0x7
+	.long	.LASF1189
+	.byte	0x9
+	.long	.LASF1221
+	.byte	0x6
+	.long	.LASF1222
+	.byte	0x6
+	.long	.LASF1223
+	.byte	0x6
+	.long	.LASF1224
+	.byte	0x6
+	.long	.LASF1225
+	.byte	0xa
+	.long	.LASF1225
+	.byte	0x7
+	.long	.LASF1226
+	.byte	0x7
+	.long	.LASF1227
+	.byte	0x7
+	.long	.LASF1228
+	.byte	0x7
+	.long	.LASF1229
+	.byte	0x9
+	.long	.LASF1229
+	.byte	0x7
+	.long	.LASF1230
+	.byte	0x6
+	.long	.LASF1231
+	.byte	0x6
+	.long	.LASF1232
+	.byte	0x6
+	.long	.LASF1233
+	.byte	0x6
+	.long	.LASF1234
+	.byte	0x7
+	.long	.LASF1235
+	.byte	0x7
+	.long	.LASF1236
+	.byte	0x7
+	.long	.LASF1237
+	.byte	0x7
+	.long	.LASF1238
+	.byte	0x7
+	.long	.LASF1239
+	.byte	0x7
+	.long	.LASF1240
+	.byte	0xa
+	.long	.LASF1241
+	.byte	0x7
+	.long	.LASF1242
+	.byte	0x7
+	.long	.LASF1243
+	.byte	0xa
+	.long	.LASF1244
+	.byte	0x6
+	.long	.LASF1245
+	.byte	0x6
+	.long	.LASF1246
+	.byte	0xa
+	.long	.LASF1247
+	.byte	0x5
+	.long	.LASF1248
+	.byte	0x4
+	.long	.LASF1249
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF1125:
+	.string	"blackboxWriteU32"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1170:
+	.string	"blackboxWriteReserve"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF486:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF1103:
+	.string	"int32_t"
+.LASF1138:
+	.string	"blackboxWriteUnsignedVB"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF983:
+	.string	"U_ID_0 0"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1086:
+	.string	"BLACKBOX_TAG8_8SVB_MAX_BYTES (1 + 8 * BLACKBOX_VB_MAX_BYTES)"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1102:
+	.string	"int16_t"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF1141:
+	.string	"header"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1067:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF1010:
+	.string	"USE_UART7 "
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF473:
+	.string	"__P(args) args"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF977:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1122:
+	.string	"blackboxPrint"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1117:
+	.string	"blackboxWriteBuffer"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF980:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF943:
+	.string	"USE_SERIALRX_SUMD "
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF972:
+	.string	"VTX_TRAMP "
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1011:
+	.string	"USE_UART8 "
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1147:
+	.string	"accumulatorBits"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF960:
+	.string	"TELEMETRY_MAVLINK "
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1167:
+	.string	"blackboxPrintfv"
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF924:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF995:
+	.string	"USE_FAKE_GYRO "
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF984:
+	.string	"U_ID_1 1"
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF971:
+	.string	"VTX_SMARTAUDIO "
+.LASF1026:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1148:
+	.string	"bits"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF965:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF510:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF940:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1149:
+	.string	"blackboxEncodeTag2_3SVariable"
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF921:
+	.string	"__va_list__ "
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1100:
+	.string	"long int"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1034:
+	.string	"TELEMETRY_MAVLINK"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1121:
+	.string	"zigzagEncode"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF964:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1015:
+	.string	"STACK_CHECK"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1154:
+	.string	"blackboxEncodeTag2_3S32"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1016:
+	.string	"USE_DASHBOARD"
+.LASF1029:
+	.string	"USE_SERIALRX_XBUS"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1158:
+	.string	"blackboxEncodeUnsignedVB"
+.LASF956:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1022:
+	.string	"SERIAL_RX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1177:
+	.string	"blackboxWrite"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF949:
+	.string	"TELEMETRY "
+.LASF981:
+	.string	"SKIP_IMU_CALC "
+.LASF1120:
+	.string	"castFloatBytesToInt"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1089:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1073:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1094:
+	.string	"signed char"
+.LASF1124:
+	.string	"blackboxWriteFloat"
+.LASF1104:
+	.string	"uint8_t"
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1027:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1088:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF993:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF935:
+	.string	"USE_CLI_BATCH "
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF974:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF926:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF963:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1039:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1020:
+	.string	"USE_PPM"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1043:
+	.string	"VTX_SMARTAUDIO"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1090:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1002:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1085:
+	.string	"BLACKBOX_TAG8_4S16_MAX_BYTES 9"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1051:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF923:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1079:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1006:
+	.string	"USE_UART3 "
+.LASF1136:
+	.string	"blackboxWriteSignedVBArray"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1019:
+	.string	"USE_VCP"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1108:
+	.string	"__gnuc_va_list"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF930:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF739:
+	.string	"NULL"
+.LASF1126:
+	.string	"value"
+.LASF942:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF420:
+	.string	"__USE_GNU"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1143:
+	.string	"fieldBits"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1101:
+	.string	"char"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF978:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF699:
+	.string	"__need_size_t "
+.LASF1040:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1166:
+	.string	"blackboxPrintf"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF987:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF702:
+	.string	"__size_t__ "
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF996:
+	.string	"MAG "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1110:
+	.string	"fp_offset"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1082:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF939:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF1159:
+	.string	"encodeTag2_3S32Bytes"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF1025:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1160:
+	.string	"signedBitCount"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1161:
+	.string	"magnitude"
+.LASF941:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1134:
+	.string	"array"
+.LASF1133:
+	.string	"blackboxWriteSigned16VBArray"
+.LASF1176:
+	.string	"blackboxFlushWriteBuffer"
+.LASF932:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1070:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF911:
+	.string	"__GNUC_VA_LIST "
+.LASF695:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1095:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF928:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1130:
+	.string	"blackboxWriteTag8_4S16"
+.LASF1174:
+	.string	"__va_list_tag"
+.LASF1139:
+	.string	"blackboxWriteTag2_3SVariable"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1035:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF985:
+	.string	"U_ID_2 2"
+.LASF994:
+	.string	"GYRO "
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1030:
+	.string	"LED_STRIP"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1061:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF937:
+	.string	"USE_PWM "
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF967:
+	.string	"USE_SENSOR_NAMES "
+.LASF866:
+	.string	"__NFDBITS"
+.LASF1129:
+	.string	"valueCount"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1144:
+	.string	"fieldSizes"
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF1081:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1175:
+	.string	"SystemCoreClock"
+.LASF1075:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1068:
+	.string	"UNUSED(x) (void)(x)"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF1053:
+	.string	"_STDDEF_H "
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1052:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1042:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF988:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF908:
+	.string	"_STDARG_H "
+.LASF1012:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1062:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1119:
+	.string	"blackboxWriteBufferCount"
+.LASF1057:
+	.string	"_T_PTRDIFF_ "
+.LASF1157:
+	.string	"blackboxEncodeSignedVB"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1033:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF982:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1060:
+	.string	"_PTRDIFF_T_ "
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1074:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF931:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1021:
+	.string	"USE_PWM"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1071:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1099:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF819:
+	.string	"__key_t_defined "
+.LASF1106:
+	.string	"long long int"
+.LASF1113:
+	.string	"va_list"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF934:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1000:
+	.string	"USE_FLASHFS "
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1046:
+	.string	"USE_SPI"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1114:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1041:
+	.string	"VTX_COMMON"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF463:
+	.string	"__PMT"
+.LASF920:
+	.string	"_VA_LIST_T_H "
+.LASF1118:
+	.string	"blackboxWriteBufferSize"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1109:
+	.string	"gp_offset"
+.LASF1031:
+	.string	"TELEMETRY_FRSKY"
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF1028:
+	.string	"USE_SERIALRX_SUMH"
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1055:
+	.string	"_ANSI_STDDEF_H "
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1135:
+	.string	"count"
+.LASF1069:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF953:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1132:
+	.string	"blackboxWriteS16"
+.LASF364:
+	.string	"__k8 1"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1092:
+	.string	"unsigned int"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF919:
+	.string	"_VA_LIST_DEFINED "
+.LASF417:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1054:
+	.string	"_STDDEF_H_ "
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1084:
+	.string	"BLACKBOX_TAG2_3S32_MAX_BYTES 13"
+.LASF952:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF1058:
+	.string	"_T_PTRDIFF "
+.LASF1131:
+	.string	"blackboxWriteTag2_3S32"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1056:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1123:
+	.string	"tfp_format"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF905:
+	.string	"alloca"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1077:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF509:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1111:
+	.string	"overflow_arg_area"
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF697:
+	.string	"false 0"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1150:
+	.string	"bits0"
+.LASF1151:
+	.string	"bits1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF696:
+	.string	"true 1"
+.LASF1064:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1127:
+	.string	"blackboxWriteTag8_8SVB"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF992:
+	.string	"ACC "
+.LASF966:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF1013:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF1137:
+	.string	"blackboxWriteSignedVB"
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF999:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1063:
+	.string	"_GCC_PTRDIFF_T "
+.LASF976:
+	.string	"USE_NAV "
+.LASF547:
+	.string	"__stub_revoke "
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF1165:
+	.string	"written"
+.LASF948:
+	.string	"LED_STRIP "
+.LASF946:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1047:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1004:
+	.string	"USE_UART1 "
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF997:
+	.string	"USE_FAKE_MAG "
+.LASF1044:
+	.string	"VTX_TRAMP"
+.LASF1014:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1152:
+	.string	"bits2"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1173:
+	.string	"__builtin_va_list"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1091:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF947:
+	.string	"BLACKBOX "
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF989:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1024:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1172:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1163:
+	.string	"blackboxPrintfHeaderLine"
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1038:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF973:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF958:
+	.string	"TELEMETRY_IBUS "
+.LASF1045:
+	.string	"USE_I2C"
+.LASF1162:
+	.string	"signedMagnitude"
+.LASF1107:
+	.string	"long long unsigned int"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF389:
+	.string	"SITL 1"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1112:
+	.string	"reg_save_area"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1171:
+	.string	"length"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1059:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1169:
+	.string	"blackboxWriteCommit"
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1008:
+	.string	"USE_UART5 "
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF915:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1023:
+	.string	"USE_SERIALRX_CRSF"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF909:
+	.string	"_ANSI_STDARG_H_ "
+.LASF955:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF550:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF962:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1048:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1017:
+	.string	"TELEMETRY_LTM"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF741:
+	.string	"__need_NULL"
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF916:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1096:
+	.string	"__int16_t"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF936:
+	.string	"USE_PPM "
+.LASF1050:
+	.string	"DEFIO_NO_PORTS "
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF922:
+	.string	"_STRING_H 1"
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1155:
+	.string	"byteCounts"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF814:
+	.string	"__off_t_defined "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1128:
+	.string	"values"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF1098:
+	.string	"__int32_t"
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1009:
+	.string	"USE_UART6 "
+.LASF938:
+	.string	"SERIAL_RX "
+.LASF975:
+	.string	"GPS "
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF929:
+	.string	"I2C2_OVERCLOCK true"
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF990:
+	.string	"USE_FAKE_LED "
+.LASF969:
+	.string	"VTX_COMMON "
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1018:
+	.string	"USE_ADC"
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1164:
+	.string	"name"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1083:
+	.string	"BLACKBOX_VB_MAX_BYTES 5"
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF479:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1156:
+	.string	"byte"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF979:
+	.string	"SIMULATOR_BUILD "
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF1140:
+	.string	"blackboxEncodeTag8_8SVB"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1097:
+	.string	"short int"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF914:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF1146:
+	.string	"accumulator"
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF951:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF998:
+	.string	"BARO "
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF961:
+	.string	"TELEMETRY_SRXL "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1066:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1080:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1153:
+	.string	"packed"
+.LASF1168:
+	.string	"_putc"
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF918:
+	.string	"_VA_LIST "
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF933:
+	.string	"USE_CLI "
+.LASF970:
+	.string	"VTX_CONTROL "
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF968:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF957:
+	.string	"TELEMETRY_CRSF "
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF913:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1087:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF954:
+	.string	"USE_SERVOS "
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1005:
+	.string	"USE_UART2 "
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF694:
+	.string	"_STDBOOL_H "
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF912:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1105:
+	.string	"uint32_t"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1049:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1072:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF927:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1076:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF1115:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF945:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF698:
+	.string	"__bool_true_false_are_defined 1"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF910:
+	.string	"__need___va_list"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF959:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF944:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1065:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF1142:
+	.string	"blackboxEncodeTag8_4S16"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1145:
+	.string	"selector"
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1116:
+	.string	"blackboxHeaderBudget"
+.LASF1032:
+	.string	"TELEMETRY_HOTT"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1007:
+	.string	"USE_UART4 "
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF991:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1001:
+	.string	"USE_FAKE_FLASH "
+.LASF1078:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF950:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF925:
+	.string	"_STRINGS_H 1"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF917:
+	.string	"_VA_LIST_ "
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1003:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1093:
+	.string	"long unsigned int"
+.LASF986:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1037:
+	.string	"TELEMETRY_IBUS"
+.LASF1036:
+	.string	"TELEMETRY_CRSF"
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1231:
+	.string	"__sigset_t.h"
+.LASF1223:
+	.string	"time_t.h"
+.LASF1208:
+	.string	"long-double.h"
+.LASF1245:
+	.string	"__locale_t.h"
+.LASF1247:
+	.string	"platform.h"
+.LASF1238:
+	.string	"struct_mutex.h"
+.LASF1199:
+	.string	"target.h"
+.LASF1235:
+	.string	"thread-shared-types.h"
+.LASF1202:
+	.string	"libc-header-start.h"
+.LASF1214:
+	.string	"stdbool.h"
+.LASF1186:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1225:
+	.string	"endian.h"
+.LASF1179:
+	.string	"src/main/common"
+.LASF1190:
+	.string	"stdint-intn.h"
+.LASF1248:
+	.string	"common_fc_pre.h"
+.LASF1185:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1188:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1193:
+	.string	"<built-in>"
+.LASF1244:
+	.string	"locale_t.h"
+.LASF1178:
+	.string	"src/main/blackbox"
+.LASF1180:
+	.string	"src/main/target/SITL"
+.LASF1237:
+	.string	"atomic_wide_counter.h"
+.LASF1206:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1192:
+	.string	"stdarg.h"
+.LASF1184:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1215:
+	.string	"stdlib.h"
+.LASF1246:
+	.string	"strings.h"
+.LASF1204:
+	.string	"features-time64.h"
+.LASF1236:
+	.string	"pthreadtypes-arch.h"
+.LASF1189:
+	.string	"types.h"
+.LASF1220:
+	.string	"floatn-common.h"
+.LASF1219:
+	.string	"floatn.h"
+.LASF1249:
+	.string	"common_fc_post.h"
+.LASF1221:
+	.string	"clock_t.h"
+.LASF1187:
+	.string	"/usr/include"
+.LASF1233:
+	.string	"struct_timespec.h"
+.LASF1195:
+	.string	"encoding.h"
+.LASF1230:
+	.string	"sigset_t.h"
+.LASF1203:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_encoding.c"
+.LASF1211:
+	.string	"typesizes.h"
+.LASF1234:
+	.string	"pthreadtypes.h"
+.LASF1197:
+	.string	"printf.h"
+.LASF1222:
+	.string	"clockid_t.h"
+.LASF1212:
+	.string	"time64.h"
+.LASF1191:
+	.string	"stdint-uintn.h"
+.LASF1227:
+	.string	"byteswap.h"
+.LASF1181:
+	.string	"src/main/target"
+.LASF1224:
+	.string	"timer_t.h"
+.LASF1198:
+	.string	"blackbox_encoding.c"
+.LASF1240:
+	.string	"alloca.h"
+.LASF1217:
+	.string	"waitflags.h"
+.LASF1196:
+	.string	"blackbox_encoding.h"
+.LASF1218:
+	.string	"waitstatus.h"
+.LASF1182:
+	.string	"src/main"
+.LASF1207:
+	.string	"cdefs.h"
+.LASF1213:
+	.string	"wchar.h"
+.LASF1241:
+	.string	"stdlib-bsearch.h"
+.LASF1209:
+	.string	"stubs.h"
+.LASF1194:
+	.string	"blackbox_io.h"
+.LASF1239:
+	.string	"struct_rwlock.h"
+.LASF1243:
+	.string	"string.h"
+.LASF1183:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1229:
+	.string	"select.h"
+.LASF1201:
+	.string	"stdint.h"
+.LASF1216:
+	.string	"stddef.h"
+.LASF1210:
+	.string	"stubs-64.h"
+.LASF1205:
+	.string	"wordsize.h"
+.LASF1228:
+	.string	"uintn-identity.h"
+.LASF1232:
+	.string	"struct_timeval.h"
+.LASF1226:
+	.string	"endianness.h"
+.LASF1200:
+	.string	"stdc-predef.h"
+.LASF1242:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\237\001\375\t"
+	.string	"t\r\223\002"
+	.string	"\031"
+	.string	"\306\240\251\267\005\f\002"
+	.string	"\001\002\001\002\002\002\004\342\203\351\365\f"
+	.string	"\005\374\220\315\316\r\016\002\003\002\003\002"
+	.string	"\002\004\004\002\004\006\242\264\310\226\n\006\002\002\002\007\357\350\332\204\n\002\002\005\002\005\b\346\371\265\305\006\006\005\002\005\n\370\313\262\217\013\002\002\002\013\213\260\266\224\007\f\372\227\265\264\006\032\002\003\002\r\275\356\226\345\002\022\003\016\266\326\302\233\006\002\007\007\002\007\017\302\247\323\347\005\020\372\311\205\306\n\016\021\225\310\266\345\016\020\022\336\341\333\310\r\023\351\315\273\220\b\022\024\246\303\376\346\007\022\b\002\b\025\353\206\240\252\016"
+	.string	"\026\310\244\347\262\t\027\307\362\203\352\f\016\030\373\352\374\256\031\220\245\335\270\016\f\032\324\230\357\263\006"
+	.string	"\033\274\320\320\213\f"
+	.string	"\034\240\342\234\212\n"
+	.string	". p\002Ru\247\003\200\246\310t:\033\304\300Ru\001"
+	.ascii	"\371w\312\310\300\332\301\264\252\271\020\032\007\232\215\352"
+	.ascii	"\250\201\003\237<\250\222\017\270\247\331{\007\020\350X=\206"
+	.ascii	"e\260\r\004\267\341\356j\316\270\273|\321\246\003;\017p\247c"
+	.ascii	"\354\244\036\220*\214\\\316\343qz,LU8\n\240\001;P\303\216Sq\225"
+	.ascii	"{\341\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"5\005"
+	.string	"\"\006\022\031\220+\215\001\311\374\377\377\377\377"
+	.string	"\320\266\256o\247\367\355V\233l)eJ\001\216\306\321.\306\013S\034u#\362\304\t\361a\335\260_(=\310z\217\313\220\204\201\226&8`"
+	.string	"s\350\323\352\324\211Ve-j\335n\362H. \320\202\031\253\033\261\024\020\f\247\217\013n\363\261\325`X@\003\371\b\002\354\230Kv\3678Z\337W\350e\221\203\022\001\013\353\331(#X\242\220(\r\243\310\f:\236\001\201\2051\266c!\344\003\214T\002\272\347\314\356P3\f\227-9i\215*\004\nR(\302\023\007\270\270"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`l\005E\025"
+	.string	"6\\eE\360\220*\035\370\226\327n\025c~\366\246\203\033T\250\351}\261\3043?(3#g\177\223T"
+	.string	"\341\306r\247\312\204\334\257\253\353:\3133p\211\013]\006\227\007U\020e_\370?\246\230\0162\002\206:\373\311\226R\246J"
+	.string	"M"
+	.string	"]"
+	.ascii	"?\037@j/\210.\032\034\307\250\252\374h3\277ja6D\023\006\274z"
+	.ascii	"\275\2526\204\b\321\244@\307\035\f\365\377f)t\367\310\277\253"
+	.ascii	"\252\255\356\346.5\272_\322vwc~\323\216\350\356\316\376jb\031"
+	.ascii	")F\017\336\3579\306A\247\235\003\206\0349/b\371R\207\2266\354"
+	.ascii	"n\217\377\264+\335\335\200\333+j\025\274\253 \272hx\337\374G"
+	.ascii	"\361\207\327\354\266\271\006\fK3\265/\272\033\364\231\253?\030"
+	.ascii	"\376\312\201\321\353\211Utw\367\311\274c\371\025)\2129\274f\267"
+	.ascii	"O\006\237_j7\234\310P\f|\347'b\026-Rl\374\371-"
+	.string	"\370\374DK\222\001D\311~\206>G\\\242eUC>t\222\314D\230\260\377\001\335\254\204\345`\220@\021\016\370W\023]\266\0071T\\\266\004\367t-\310X'\246\3250#)\021Qv13\201\342\215\260\234`!\275\320ZV\001g\001%\3568-\020\377\367\270\2251\306\352<\300\207[3\306\030\013\344\236\220=m\214\261>\036r0\354N\034\036\2443\272T\025\217*c\n\002V\b\333a\365\262B\344\0372\230K\rt\017\215\336x\315n\0040\300\\j\236wH\005C\355\370\377\374B\372\371\005w\250A1c\246\244f\246\240$\225\341p\002\021)\243\363\022\340tQ\305\254\021\235@d& \t2\222\202r\2631\006R\030\331PGT(?\361\335\240\342\0251J\311\027\034\342[G\343\0167\206\243R\250^h\220i2\020g>1\035u\333\222\367\204\263^\230\"\023d\361n)\034\212\210\337\313;"
+	.string	"\360Y\t\374\013V\327\030\312;I\367\262\314\333\243\264\001\362\216\355yb i\005\247\310\372z\377\030\342\222\340\006v`.v\250,\223Z%\301\rv(^\225\026\233,\343\277\360h\316F\031\324\330\314\225\3524\354t{\001T\025\377g\026\341\355\347\346\265\314\262\327`@\320C\016-\013\177\222\3500\323&u'N}0P\307\243\304x\362\334\242g.\222n\027\365NL\007=\360\227\277`y\2138a26\217\301q\217\220M\347<\2118\231\340m\002\002\261\257\257\363\013vY\373\f\203>\021\247\211h\263O_\374"
+	.ascii	"[g\023\3010G\021\263\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\264\003\315\013"
+	.string	"\342\017.-pi\222\016\374\377\277+)\261"
+	.string	"\324\300\257\252J\236-BV4\202Q\325\t\001\347H\003\017P\375\277\255\026u\263\255mhA\020i2\311$\313\273\216\003\006\266\260\032\031\220=\275* x\220\274\312\301\033T\361\326*\026\313\r\305\001\262AJ\200\367\364\024~fbDG<\304\337\232\267\026\323!\336\215z{\317\367\241\034\322\302\002\002\221H\276u\305S\3548\363\202u\352\316\267!G\270\353\211\227\230\274uO\330O*\2152dC\302mn\n{\n\353t\350\324\373\001<\262\b\373\b\353Rk\215\351\265'}\001x{]\370\272L\326\351I%\364]d\364\230\347\203\353!Q\250AI\006\311\314ha\262l\007`\")U\272\003\022"
+	.string	"B\221\b\243I\2142\304\314\304R8\223f\211\315b\f\026\316\272\337\337^{\340\367\206\372Q\276\223L\312y\322\217\271\303n\311a\n\030N\277\226\366\177 \2323\256's\366m+\345L\004\303\226\213\016\374\027\325!\341K\022\306\322\177\243\250\206\261k\205\306z7y\030\246+\325\367~\300!-"
+	.string	"\301 ]\033A/\002\365\351\207T\210\317\245\250K\033,\346\265\035\326\210\343\357\256\232\227\254\213~\r\250\200d\211\321\2312}"
+	.ascii	"\206S\306<\203b\026\024\317H\237L\377\3226-\033H\236\317\031"
+	.ascii	"\005H8\200\221^\\\250\262\3326 \003"
+	.text
+	.section	.gnu.lto_.pureconst.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375 J\375\001"
+	.string	"\242\304\016\030\200G\351,#2\"c \232\240!0\"\001\377}o\177\367\337\344\265\003\256\340\bn\340\004\036\222\0138\200G\016\371\343\2167\316\370\342\212'\216\270\303\031^8\341\364JUe\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`d\001\245\006"
+	.string	"B\310\032$\240)\303\001\377\240~'\333\352\275*7.P\376\r\030\374\202\305\367\177\256-\337\232?\341\332\266\t\211%R\246\277\207\244\341<\343E\253*\250\t]-\027\246\362\254\230\030\301\335\324\3462\365`h\2015\363\r\341\201\364\024\273\242\326\247UAD\241T2\007\324\347{\317'P\376\021\310\252s\013\3709[\336\316V\336\332\335\317\027\022, P\0022d\312\003\fAM\004\253@\254\3102]n\200G\264\r:\264\357\306\371\n\354Qz\322;c\230\326P,\242\334PA"
+	.string	"\327\3425K@\272\027,\t\260\215K\310\210\300\005n\236\253\370\n\237\257\265\245\270\201xAC\270\216\037\203\362\267`xE\026\253\215e\361'\002\325y&qX\303W\032\bm"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_.lto.3c5477874597c0f4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.12.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`s\001\205\016"
+	.string	"\226\032`E"
+	.string	"\261&\035\343\200\207'i\2227\316\221w\221\304y\216\346\216\337\321\026X[\254{\023\273y\354"
+	.string	"!\335\352\301\375\374\216\300\254\333\322\036\315\233n\377]\t\330\260\351:$\366\035z\365`\320i[\266do)S\nL"
+	.string	"E"
+	.string	"N"
+	.string	"1'\326\335\226\0275\273_\002/"
+	.string	"\360h\226-\343\337k#\314X\201\341\330]MA\234u\250\311\362/\363\217\347j\035v\270\302\0039+n\204\\)\360\203E\204w\231\347\006W\227\351q\260\273N\317\305\341\216\267\375\3006\004\3734\001\336\243o\233\354\361j \204\007\224\214\371\243F\214\315\035\373k\245\276\330\207\253.\366c~\017M{`:\313t\3144\324\264f:3\375P"
+	.string	"\027\002P\354\262\304t\354Md1\302\366Avh&$\323f0b=\nS!\321e\314P3\375\312\216\250*\356\321@p\250Q\257\322\322\245\200\332"
+	.string	"\007\366\023&\250T*{T\005\311\001?is\027\362\236\tt\332\362\311\306_:95\252/\251W\223\t\030)\2513C\222\372\361K\374s\013\037\306%\266\311\007V0\032\231H!\244M\264\211(\250P\023\270Mu\032p*\021)e\210\256 \342P\0224p\246\324V\0221i*T\311\202\266\255H4Q\001s#\247\225\206\201\343V\032\350\333\303U\227\270s\203\242\235=\324\247\0319\001y\301\370&\331#\t\347C\246\252\036\r\037"
+	.ascii	"8\313\007K\275\231\241}\002\003\377\255\333e(Oc?\r\201\305\224"
+	.ascii	"\022\307\024kp\231\310d6\230\223\203-\2140\316\300\275\204\221"
+	.ascii	",R\001\310\250\2704\327\2401\200\205\317\0345\252\025\027F\314"
+	.ascii	"\031\273\301\324\220p\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto__putc.15.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\245\t"
+	.string	"\366\322D<0\345(\035\036p{\017?\273\211x\335\030\332\312bc)2If\242a\333\301\377X\263$H\306\336\247X_6\330\006\346C\241\034M\375\177d\337T\022\342\301\364\001\375\237\020)S\n1"
+	.string	"4"
+	.string	"/"
+	.string	"\235\343\0218\357<7\340\274sh\337<\226\354\203I\254E\300\356zJ\362\360\031\372g\371\200l\366zv v\327)\233\205\334z\333\013\266%l\003\b\013r#\260\266\356\345\304\366?6(\200I\323v\030\205\217\035\326]\021\227\332\356\206\034\341y\007\2521=\355\247\\%\374\212mN\260KC\251\355\306\220K\236\007\231j\2736\3622+|\350\313\327T\275>V"
+	.string	"\2267O\034\300\314l\016\260\343+u\304>\267\273k\245\331\217\277j:\271\3649\035M\201\314\006\337\3350\032\241H%\322'J`\335\237\310b\245\252"
+	.string	"\277U\212\202\003D]|'\f\224\267R\2352\274\257\345\362D\f\006Y\251\226\247\001\202-\357\023\367\334*\315\\\214\r\246\036\356\004\013"
+	.ascii	":S\005K\021\231x\367\027\r\\\310.DUn\007\327\200&\013s\306\035"
+	.ascii	"^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.17.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`I\002\355\022"
+	.string	"&bzJ\320\322(\035 \366v\034_\312F\360\245GQ\274\247\370\007@\304\267bv\310j\246\202\345\b\207`ew\003\332\206P`O\366\013r%u[\221\301\221\254\036\206\026\021\363\202b\037g]4\027\260=\367\267\362 \210l\262wJ\001`"
+	.string	"a"
+	.string	"e"
+	.string	"'\236\324\1778x{[\257\004\217\0344\221WW"
+	.ascii	"O\"R\237\366"
+	.string	"_\334\207|)\363\001\273;7\335n\351\300&\340\253K\320\266\357\3424\322\2661\201\306\343\361\251\001\332\355n\210\272\201\357\325{\201\357\225\2368\371I\372\267=\004\210h\2063\363\tr\262\273\2363\234\0207\275m\006\266Y\354\271\"\257\375\366\375\240\353l\223a\277\371B'\242\270\236\034\332\356\232r5\230\242T\235\317}\250\0063d\364\0316\200W\253\200\2578oG\224\013\214v\"\257\247Z\352\3638\330K\031j\263\236\220\254\244\355^\375 \230mz\275M\3721n\263\351\244\223\222q \362\265\230\023\231\315\206\324\270\335\250\300\327#\b\3644\304\025\270\033\373,\274\257[a\315\317>\nA\247Fw\n=\216\210.\241f\225\222B\024\317Qz\334Q1]\200)\362\337nkQ\360aw?\263\307\f\3633\243h\350\214\357\241\305S\334(!\355\\\262K\331\244&\354{\273\273\246;\3667\375\275\374)x"
+	.ascii	"\306\216\243\033\305Q.\210\037>b7j\021\213\342\312\345\005\265"
+	.ascii	"\342R\201*\r\263\265z\275X.\030\210\037\220\220\244\224\230\224"
+	.ascii	"\210#\t^-\027\250\305\221\225\026Ke\024[+\224\rc\n\006Q\305\222"
+	.ascii	"\022\266X\252\226Pt\275\204#\r<\272\254\\\341k\034]\241\251\214"
+	.ascii	"\335\216Q\231c\274]\022\021t\374\314\037\276\212\033\002\323"
+	.ascii	"\002J\207\235\022\322G\377\223;*6\227~\333\275$\035\001\263\""
+	.ascii	"\365\344\320h2 \200\2422\227\035\231i\201_O\b\310\303<\024\355"
+	.ascii	"a\321S\024\370q\300I\2240[\347\322\332\314\247\002U\030\256\300"
+	.ascii	"\261N?\334\243\303zWV\021\341\207\235\032nh\362v\221\202\037"
+	.ascii	"1\2221\206a\2102\354\200\370\203\017\330|\206\250\3455{U\224"
+	.ascii	"\0218d\341\376%\274F\201\242\214K\017\352\260\252\353$\025\205"
+	.ascii	"\016\230x\020O\364x+\035\241\223\001"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.18.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`T\003U\027"
+	.string	"6\251\222I\260\022Vc\310\361\r\f\361\t\271\rfx\372\245gU\377 \262\006\354v\370\0360R\307\216z\300X\356\341\237L\302fo\016Xm\1772\234]\344d\364\233@\252\001Ax\346\026\377\030\240\317-\363\220j\2656\273\367\2262\245{"
+	.string	"t"
+	.string	"\204"
+	.string	"1+\245\277"
+	.ascii	"\276h\303\"\344\271%2\220!\\^??\022\313\252\375\350.\200G\362"
+	.ascii	"`\336\3425I\370\210\"\232\3744\206\327\317\231\031\273\221\006"
+	.ascii	"\251\360\372\031\203\252\275\332'\236\005\360F7\027p\357\020"
+	.string	"\r\344\275\351\211W^?\235^\004\375\371:\001\364\247\201\266\325HN\214j')\353\336K\263&\016|\005\3727>d\350\203\363\352b\271\367\272\016}~n{\333%\266gl\273\"\276y\355\220\215V\313\236\376\260\033\375.\264\332\242\325\025\255\376\200[\013\036J\0356Gz{\266\200\004\245\316$\321\213\277}\377\370\244\r\363\357K~\323\235\354\261*\210x\357\205!\2135\311\332Y\217|\214bM\323\223\017\303\016\371i\335\353'\223y\201R\003S&?\003(\325^\317\364{zcy\256y\024\246\304\254{\323\223\237\376\361g\303~\376I7\032\026\226\004\005P\260n\031\375Q\002 \272\322Z\216T\b\021z\242\354\221~\343M,!\221zbU\005\021a\366O\023(\274\356\r~H\273\237\264p\241~(\263\t\204v\222\227\320C\351\364\006;W\013\213v\342H\230=\323gA\242\"Y5\371\227n\264\025"
+	.ascii	"1\264q\271\234\036 \255\245\002\033\261\352\262\266\016\246\306"
+	.ascii	"lFHu\361\206Bm\336L\375\320\263\017\026\307\217R^\205\220\326"
+	.ascii	"\362\326\037v*\254\266\204\003\270\234\f\315\354\245g{\3318\324"
+	.ascii	"]\316\347\323\365~._\214\2135\202\224\224\233\312\212\n\016\205"
+	.ascii	"$\027c\333\231\306\241\274\354t\032x\270].C\007\336\r\006g\333"
+	.ascii	"p\243\355t\266\030\032\256GCC9`\236L\256G\363\361x=\032,\r\336"
+	.ascii	"\274v\310\fDH\005\255\3206\346\275#\026\274\370_\035\325-[K\365"
+	.ascii	"\341\262\332[k-\224N\321\311e\266Zs\207N\220\260n\331\307\361"
+	.ascii	")\007~\n?h\251\037\266\240?\037F\250a0\213\f#H\311\210\210\004"
+	.ascii	"\243T[8\200\002!\262\353\006\021\200\261e3&\205\302pz\365\200"
+	.ascii	"\370e\213\226\204Q\213\335u\351\303W,\311\233B\213\273w\301\321"
+	.ascii	"6(\310FD\021\311A\354N\025j\260\226'\016\214Q\342a\260c\340\260"
+	.ascii	"\nx\317\235\353\021\247#I\\a\022>^\241\205U\351\245\307%\343"
+	.ascii	"\336'a\t\337$\232\340?F\320\256\343\204\326\341s\026\271\231"
+	.ascii	"]\034\227\255aB\274l<}\204Oo\214FE\005`\337\317\b?\fC\351\330"
+	.ascii	"q\031\b\250F\206\026\013\375\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeUnsignedVB.21.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\"\002m\022"
+	.string	"favG\340\360&\035\312\324\232`\007P\260\205\200\007\304\211>Me#\253\360\223\326@\274\363\200\002\244\224\025\365p\324-\336\363\372\\A;\036\360D\036\005W\210a\036\360\236\341b\235*A\370\243`\232\276\001\361-\331{K\231Rb"
+	.string	"]"
+	.string	"_"
+	.ascii	"s\366\270`1\347W\300'\246\307\223x\211\032\273\004|?;\3226\""
+	.ascii	"G\b\307\234_\312\337\003\310G\323\001\310\307\355`\250\256G\270"
+	.ascii	"\352\362Q4\f\305f6\217\260\303\321\371p\232\341@\024\334\021"
+	.ascii	"\321mW\331\354Fa\b\236\357m\207\"2\274\210\315x\256\235\312\234"
+	.ascii	"\323\032\233\355\334\362\266Yl3\260UA-pfk\275%\311\230\252d\177"
+	.ascii	"6\272>\366Q~pG\336\036\033u\362^\373?N\373=:\271\352x\332\rW"
+	.ascii	"\275\257\335\272\352\207t;1\006\254\230S'\2674aD\"\020\366Q\324"
+	.ascii	"\330 \266\367JQ\275\315\377~\242\3465\032{\314\311\001\267\300"
+	.ascii	"\3648\002An\244Xo\3424\327C\0026\202T\354i\r\325c\345\312\234"
+	.ascii	";\215\3546\201\221\005\305\371\266\037\003,I\352\252\274\340"
+	.ascii	"\234sB\324\276\326\335E\262[\324^\007l\207\304\355\372\267\326"
+	.ascii	"\214G\303\203\357\222\217*\024C\372\274\210\374.\317iO\373\310"
+	.ascii	"K\225|\340rO\373\0320\240\033\315\271\333\257\026\345\354xi\316"
+	.ascii	"\336-\307\016\005-1/+2\321\006JJT&'&+\022\021\0071\252\365\212"
+	.ascii	"\344\001\214\013\013k\005\323\322\240\002K\005a\265\362\242J"
+	.ascii	"\301\270\254DH\255Z\023R$\004\314\222\320\322JQ`\261Z)\220o\036"
+	.ascii	"v\253+3\204r\241\267\b6\274\366\306\335\205(3\243\217!\2756\356"
+	.ascii	"g\300\365\366)`@z\313\305\365\361R\220\321\242>\266[\331m7\005"
+	.ascii	"0 P\002A\316\225\035\331i\201\252Wb \216\365\311\250\001\255"
+	.ascii	"+\214\340\254\236|\024\324@9\210a\334\302`\024\350\210\241\251"
+	.ascii	"\216\3211a\021\236\324\330\035\033#\326\266\0226\3362I\370\357"
+	.ascii	"\r\317\3533\251\365\330\345\203e_\027Q*L\033]\2732\256\240\275"
+	.ascii	"\367\272\366\2623K\340\275\310\003>7\221 \314\357\004\276\023"
+	.ascii	"\b\\\252\274e\320\227M\202y\002"
+	.text
+	.section	.gnu.lto_blackboxEncodeSignedVB.22.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\025\003]\027"
+	.string	"\246*\225J\300\322Q:+\200\034\225\360t\023\341\303\b\335\020\230\032\3704\335:U\310\376\177^c'd\346\252\244\223\250\275\331n{\345\237\211\250\3402\336\355\371\364)\212\242\020 \004\260`\305\206\267\315\f\022\013\201\231-\277\221F\b\221;\245\201"
+	.string	"z"
+	.string	"~"
+	.ascii	"5/\272`U\255<7V\324ZI\234\240\3748\"\232J*\246O\361\241\332\001"
+	.ascii	"\324\332\363bE\255>\022\243\224\037\177\342(j\\\023\340\373\321"
+	.ascii	"!\177I9 \217Z}/\373\036\200\374X>\204\374\270!,\322\332Gqi\315"
+	.ascii	"\377]\024\352\340\244\353\331|\024S89#\\=\0341\345\251\211\305"
+	.ascii	"\205\247\273\336\215\212%v\276\027^4\301\001\206\256\267s\232"
+	.ascii	"Z\251\265\232\352z:7y\333\017l+\260\227%6I\r\342j\261L\222z\245"
+	.ascii	"\372y\227$u\352\301\241\177|\321\277#\365CR\037d\f\250Qk\316"
+	.ascii	"\320G\2151\262 \361\363\017\236\332\367\201\027\322n\344\037"
+	.ascii	"\035i\211j\b\325Z\315 Mi\303+O\226ME\244\017\322^Ds^\271\364"
+	.ascii	";+\216\247\302\375\222\n|4w\234\264\017\325H\236j\303M\250\251"
+	.ascii	"V\037\311G\037H\263\315\217\367\215jl\3236_\250P\372\237\357"
+	.ascii	";Q\032pN%\245P&w\305&\326Z\253h\246\356\026$\271\346\376\007"
+	.ascii	".\352\006\305\264Z_I\006\343"
+	.string	"\213\360k\344G\n\324\345x\275\b\231\332\325\216\352\300\313U\355m\340\200nthrSK[\344\242lth\326\331\203i\217\\\340\364v}\204_\235NLH?\006\034\216\031\337\007\307\375\371\021\033\205\262\212\356\3323\t\364\272/\002\0207kc\223\247R(\333w\243\353c?\345\347\251\311\333\023.31-\025F\03301\201\235\240\234\304JD\032\314\300\326\261\022\007\262\027\006\263\230\314e\201\205\031\f&\326\022\003{\311^Z \274b2\023^%\004<\213\340\"\363\2420\233\311\274L\237\355b\271\256\335Y\024\311e\265v\304\2667\333\277?C\316C\fz\324\003\201]\227cA\3664rQ-\327\266\366*p@\364\0342\215\353c\037AKk~\311\335]\370RG\220\322\252\326\"\035\267\334\235\207\247!\311eY\272\241O\017@\250!Hd\030RNI \024H \243 \331\030P\002A\310l=\021"
+	.ascii	"\276\022\253i;\331\025\240F\227\263\265\274\301\346-\005\260"
+	.ascii	"\037,\231~\365\264\374ar\216\340\227\307\022@|h\202B\275=\232"
+	.ascii	"j.\225\360\234\026,\0206\266\002\026B\331`d\360/\270>\224\025"
+	.ascii	"-?#Z\240\251ZOax|\244\r\240\032\032iz\024\003\342)T\232b\\\240"
+	.ascii	"\005b]\304\266\370\364\351\344\277O\f\364\327\257b\347\345&\276"
+	.ascii	"\341\233\371:J\220 \2260`\301$\342?"
+	.text
+	.section	.gnu.lto_encodeTag2_3S32Bytes.23.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`@\t\3254"
+	.ascii	"\272^<\024Hp\\N:\343\311\033\361\315\216 \352\241&\277\201\030"
+	.ascii	"X\265\327\263\217}\323\213\001\377\270\210\312\206\254\205\006"
+	.ascii	"\332\276<\260\255\211\247\245\234\227=d\232\213\225=\232~)\f"
+	.ascii	"z\205>\261\340R\007\2436,\221F\b!D\356$\0035\001\034\001)\001"
+	.ascii	"\307\302\327\222\006\221\233k\333\226\375\211\226e\312\312\327"
+	.ascii	"\027^\024 z\217V\365,S\327R\331\262z \370\311)\350\200|*\374"
+	.ascii	"\344Zg\345W"
+	.string	"\256~\306J\325\205\226\212,;C\245\37642\371U\252\230\331\237\315|\305/;\222\331u\fP\312\247\\\335L\205\352B\313\302\327[\\\333\266\"\300\360V5@\005\r\256Nf\245\266JR\344W\231\270\266=*\375d\017k\027\340=\262\360\355\264/\312\214\033\324\237\353\031\220\357\305\260\316\323\266B\336\320\332\366\210\200\037\250?\241<\312\025c\371\216E\270\326\257/\304)sm{\374\361\361?\350O\365>\350\317&\362\266m[u\345\276y<\233&\326\331u\247\246\350i\366\305\342\247\024\2207\237\374xS\334rq\326\334\201\323\332a6\r\357\252\343;3\205A\003\311\341\264r\230\020\350\342\322\376F\274\352\200!\\8\236\276\335\302\027\335\032/.\034GS\nl/0\267\304\213K\307Os\247m\333\336\026\f\263\351\032\267\262\256\271\244\353\375\344\223|\250\025\267\272~S\nm\333\362-nq\235yg~"
+	.string	"f.2\2537\002J\243\216\333\006\272\373\303&\346\271\r}\337\376\220I\326\255c\241~\247s\210K\341\255c\036R\255!\024\241\213k\276g%\372\263Kx\362\246\023/\345\255\320\223\035\bDx\343p\212v\221cp\355\215\303|\314\272\r\306\374\036\270%\030\267\020f\006\275\313\013\330\313\n\330\313\t\330\313M?\246\336\345\245\336e\245$\244\243\267\235\017\374\370\033 p\261\177\200\316\345\242\273\235\211\276v\036\372\331Y\350dg_\020\020{\371G\347r"
+	.ascii	"\237\336\345\036\3662\017{y\347^\006\260^\356\255\227ut.\363"
+	.ascii	"x\227Y\336\345\365b\347\035{Ye/\247\354e\224\275|\262\227\315"
+	.ascii	"{\271\327\313w\275\374\006\3512\214\2007mK\243NN\013\346LKr\267"
+	.ascii	"\277\355_\373\317~\262\337\354(\363\331\037@\376\027\376\033"
+	.ascii	"\263,\0207+etC\365'[\003\310o\343{a\273J`\311\202\303\306`c\213"
+	.ascii	"s[\336\345\204\032\027e\360\370\003\250\336s9qe\360Z*\0271FZ"
+	.ascii	"\250[N0\263Ocf\271*K/\277\fd\033FM\323\327\f\332\310\254\364"
+	.ascii	"\257\261\305\361\232\217\006+\212\325-\203\205\376|\221\215\360"
+	.ascii	"x\001(\203\346u\021\350\213%\370\200&\320O\016\233\034\371\025"
+	.ascii	"\371\345l0N\317\364\257W\204!\271\017s\2416>\371]\2210,\310\253"
+	.ascii	"n\302f\334\203\271\257\215\314\\\341\314\213K\367\346\345\273"
+	.ascii	"7\016\0135\005\341\215s\276b\204c\303\374\365\317n$\274P\377"
+	.ascii	"\212\210J\246>\331\215\212\232m\246~\362=Jb\227\332E\315\267"
+	.ascii	"\356!\320\265\331\376\320\007\332k\243h\210Ka\230\247\255\366"
+	.ascii	"\207r|\235v\313\255\241\315\314\030\216d\345O\231\266m!\3349"
+	.ascii	"E6\b~6\332B\312\341\262\251\217\316\366\241\031*\311\272u=W\251"
+	.ascii	"\371]8t@_lj\243\027\355\202\377 \272\324J}\223\304\256\245/\350"
+	.ascii	"\245>\225C9]\276\232\265\251\3756\314\324\026\364\271\240\375"
+	.ascii	"\311\277\007Q\r\214\202^\320'C\\&h\263\025t\243!\336(2;A\233"
+	.ascii	"r\303\345\323\276\232\215\301\265Z~\036C(b\314>\332\215\204c"
+	.string	"V8\251G\370,\272\003QTVOf\324\207**\021R!\234J\354\316\025\237\242\222\252\nV\210\242\262zZQ\004\251\240\242HDM\251SQU$\234R\240\334\324\240\301\223\203\007\016\240\230\004\200\250zj\206b\n!%\342C\020J*\252\303\212\340\323\b('\022O?)\021N%~P(\246~LH\0344\021\205\342G\025\f\242\370\261G\341\3155\250}|:\002\020ag\261\n\263m\275&\334\354\217#\233\303\262\355\216\372lW\347\306f\234J\037j#\233\273\335\230\2604'\201\016B\360!\266\240\276\330\320]U\240\336\035\365\327\206\372\210\355\367\201\\sw\r\306:g\322\244~\2211$\250\322\211\332\370\267\357\204\214\211\245H\315&\032\324@m$\352\237\276C\312\334^\\\272\013\352O3\231I\023\336\272\263\006P_\214\250\357f\252I}\267\245\023u\322\003\242\\\200\fV\2752/\262\351\351"
+	.string	"}\311 \0015R\337\344\260\tO\037\350\236n2\303%Q\363\264\251\0342\311B\276i\244\032\214\255\264\301\330\355\032\200\b\337n\206y!\345\016\364\333n\264\323\007\272\247\020\227\3021\036\234\324\235~\257\r4\200\303]\247{C\255\323\246\0341\200\306\250Q0\305\030c\206\210$\030I\222$\215\001\200\002\021\232\263y\021\320=\033\233$\251\321\032"
+	.string	"S\324\334\177\017b\017\360\001\\X\251\300\"c\272\211\241\2109\nU\225w\023R\"\007\003L\211\225\370Q\0352\211\335mC\027\256.\032\277\270\t\360\304(\2131\223\032\310\013d\337\246\331Eg\346\277\177\016\325\303A\204\312\261\272\261\317\250\374\330p\360\354\021D)\224\334\240T'\372\305\226j\270\240\261\367\365zC"
+	.string	"\240}\351*_^\355\316\036\031\027\277\262D\fgq\310(\301\372\333\306r\214\324\374z\365\234IIy\205\002jj7\232\270\037\201Z\213\304LS!\026a\375\0215\027\332Q\333R\370\244\3706W}\236\311\021\"o`\300\001\355\322\265g\264\036\310zY)\304\252W\334\350'\360`\366\024:\367\27038\002\2107\217=\272y\001>Y\031}\036\341\267m\234\0220\254\303\033\316a\233E\322v\205F\222\"8\t\312\264,"
+	.ascii	"=0O\317Fr~\216{\212j\017f\2068\335\342\363\023\"\345\262\034"
+	.ascii	"\025\303q\366\306I\t\250\350Xp!*\300m\224?\001d\241\245,|n\250"
+	.ascii	".F0\034W\230\253\3021{oF\022b\211\013lX\214\337\241\n\001G\227"
+	.ascii	"\211\035\020\301\007\261Wg1\362\374\016\335\243\376\335B\214"
+	.ascii	"P\204\334W\020\034-\240D\302I\371H)\0337C\223\r7#\033\331k\272"
+	.ascii	"\223\357\351\216\375\376"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag2_3S32.24.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\200\nE3"
+	.ascii	"\272[\204\023A`\350I:w\214\362\004\335\002\3228\201\260\360\310"
+	.ascii	"\353#\277g\031q~z?\215\266W\315xC2\322\303\031\354\370\bC\206"
+	.ascii	"#\274\341\237\377sh`e\022\212o\030\300B\251FH\333\215\020\222"
+	.ascii	"\244\224\001.\001\r\001\"\001\265\267w\366\232\276\336\262\366"
+	.ascii	"\222\265\367\265\267k/\253@\317\372<\005J\323$y\221R\271\022"
+	.ascii	"\356\013\257a\336\345\345#\337\361\262S\316\305\325\321Q\254"
+	.ascii	"r\325k\216\363\342::\310D\261S\374:z\355\242t\3408(z\2233e\245"
+	.ascii	"\215M\n\"\206\263\213n\017f\263\374\306\007\027\007\345\322\215"
+	.ascii	"\021\f8VL\3156l\261\243\366\350\247vU6\273\351\301F0\262\230"
+	.ascii	"\232\361\033\024Aj\217\3224\215\342r\271\270M\217]\224K\222\331"
+	.ascii	"\330m\321\023K\333\017\340\230R:\206eJZ0\355*\r\253\021\302k"
+	.ascii	"~\3240%\325\355\017\025D\\\256\214\312%\220d&\363\204r\325E "
+	.ascii	"y.*\227'\222\253m^\023\362R\232^\301\363\226\246\305\250\345"
+	.ascii	"P\271\334\335e3\254&d\205ME-KL6)D\266GiZ\224\332\"\0230\271\254"
+	.ascii	"\314dr\371,,\344\236Y\222o\341r\207.r\312\314\302\270ggZ\360"
+	.ascii	"SV\260#\331\215I0\\\370\224\2319\341\023\031\0233\225\3224="
+	.string	"\315\310\310\356\205H\323t\273\314l\to\345\335\035\262\273Bv\317\037\001\334R\356P\334\304S|\233x&\026\207\217h)\361\337\004\347\341\277\304\233\234\237\343\354!\377\246#\263\033\237b\350\274ABt\342|\024?\035\261\t\003\336\243\311?q\262\021\031\236X\347-\303\341\263\r\315\334\033\366\311\205y\203\264\210\317n\0308l\273]\306#\244\262U\273,\0031\271\344\223tF\242\f;o\333hf.m\273\335\242X\037\313.\223\351\257\354\326\336\024\265\027E\355=Q{M\324\336\022\265\227D\355\035!\342\203\007+^c\256\3425\274T\276\336\r\276^\r\2657C\355\235\342\"3\006^\343\215\372\365B\325^\013\277\336\n\265\367\351\327K\001\355\235\200\366J@{#\374z!\240\275\017\320^\007ho\203\332\013D{\031\324\336\005\265W\301\2577\001\332\353\204\366\"@{\017\374z\233\320^\003ho\001\264\227"
+	.string	"\332;"
+	.string	"\355eB{\005\324\336%\264W\t\355MB{\003\324^"
+	.string	"\265\367w\366\242\265\367\254\275\276\263\267\006?AB\223\313f+Sd\340Mw:~8\2571p\310U\377p\246#\023S\340\003n\340NG\342\3319h\022x\001\362\004\236\340\216\210\307t\245\017x\257\021\361\214\203\246\2003-]"
+	.string	"\327\361\277t\004\177\222\256t\362X\246h\330y\213\201\203f\200'\235\211O"
+	.string	"<"
+	.ascii	"\200\367\330\310\"\375\214\307A|\302\311\205\365\035\277n\371"
+	.ascii	"P\227e\fmT\227\264\024\215\320BmIK\323\364\211\005\355n]M\323"
+	.ascii	"0\246\262\273u\333e)\2213i)Z\372\304%\325\201D\032o\3338g\216"
+	.ascii	"\352\274\206\201\277\237\247:\337\241\377\231\350{G\337{?O\322"
+	.ascii	"\221Q\251\367\221\365%\235\371\336\231\210\327\374\303\234\272"
+	.ascii	"y\222\215\250&vfn\352\334\026\347+\223\341\300\251\363\035Y\232"
+	.ascii	"Rk\370\362\035,-\223\3132\0348\366\260e\326an\270\2067\034\342"
+	.ascii	"\031\024\227\337\360\362H\026\351\016\237mx\354\260\257\313\230"
+	.ascii	"4H\213\312s\034\003\373\245\200FD\274\024'\361\236\203$\322\210"
+	.ascii	"\223'A~\004\0358\362<G\2562\220\263[[3\300\276\202\\5\260p\370"
+	.ascii	"J\257\257`\026\271\243\353Kk\353\306\226W\365\332\002\273\201"
+	.ascii	"\305\303\\\fTTYU\034\252\264.(\240\001\226\365\325\272P\203+"
+	.ascii	"8\243K\213k+\206\217\256,\033ZX7\262\244\270\202X8\244\264vx"
+	.ascii	"I"
+	.string	"]\240\260]9\266vH}uu\355\220B\213C&\323_\331 qu\246\210\267 SZ\235\005 \322\303\277\216^\376\341Q7\262\273Q\267B\033^l\3350\211z\210a\333\221\275\2371O\304\200\306\360\252\357\272x\321\\&\342 \320\210<l\177\306\273@\334F;\363\021\324\267\213\264\205C\275\217V\267\262\340\250\302\323+\274\371\356\351$\034F\024&\234\2020\345\240)\341\023@p\320\214p\t\021\026\321q\033\023\225{ |\031\217\037\034\302I=\036\232\231\314\252{pp\006\177p&\346\210\033\334\001\360\rn\262\021\361\206r\300\227\177\214DYp\006'\365 b\005_pV\360\323\031\211r\346I\340\364\004'\217D\274!\233\f\302%\302\025\274\306WhC\016\232\b\356t2\211\203\346\201#\340\037x\211\247\020\267\361\016y\326i\372r#\341\022\030\001\200\324\250a8\345\030S\250f$\005)I\262\034"
+	.string	"#\021\252q\003\022\200\225=(-\243\231IA*\331\3313@(\3703\214\t\314\374\t)|\013\375\254\346(\336\200\372\360[\f\235\362\270\324\252\\\260\275\033\306\231\226W\211\2325$_6^\177X\026\227\314"
+	.string	"\3318]\216\353nY1\336h\210>@\202\330\333\365\367\2707\2774\217jYd \374\177F\205}\035\226\346\373\335QHM\344\354\220\\\336\302\204`\255?PB\005\331\365\314w\237\362xEy=\013\324\227\2002\n\007\3509\355\217\376\022x*\b\345\346\t& \257\302\341y\213\221\363\370p0\341\307\254\367\333\260\020\330\2400\002\024\272n\364\267N)He\231s/&\021\3641q\300\026Dg\003M\032\032\224I\336\361\231Xi\202\253b\022\242/\fu\350\240\020:\200A\314\264\276\313\300\232F\003\337\2344<\346\353\305O\356v\264\036P\244\177\262\2272\001\233H\322\341%\207#\374-!\375<"
+	.string	"\036\031\356]0\202\\\020\001\r~<\301%\025\211(\202`\023`9\236\023\212\345\310\031\204\307=\001\214\274\305\317b\272\261\343Q\007\341;lW\312\006\373\353\366-\200\035\226\275\327\037\360-\006\003"
+	.ascii	",\326\263\2623\271\216\371\023\\$_#\260<\222\206\341\216\230"
+	.ascii	"\002\225\322\037\260\332\367\n\217\346\3610\nT\341\271\230{~"
+	.ascii	"\002.\373\305\232i;q\376\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag2_3SVariable.25.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\004\r\035<"
+	.string	"\252j\314\026=@\350M\007w\361\347~\211\221\233^\2678\037\215\252\004\b\235\225}\241Z\340:J6\002A\220\223\333\263{\360}\311e\261\006a\032\242\020`T\232\370\027\024\343\355\275W\266\275wJ)\005k\0011\001^\001\355\342I\n\242\254e\333.Y\362\265\207\316=a\032N7s'\272;d\350\324\303\224\306\216\220\240@\247\336\245=\272\271By|\372\017\017?\312>lI+\301\367V\362\350>lh\244"
+	.ascii	"J\n\371\360`^[\017\363\312j]\207;\317\251w)M\237x\356\244\001"
+	.ascii	"\211\311\366\210\341K\036\334\036\013\027D"
+	.string	"\275\361\250\365\23543\331\036;O\224Fp{m\333f\365\311lmG\215y\355\023e\026\302=\327qzN\327\361\232\352\241\323(\215\220\2345 \021\252%\2769\022\223\203\021\335\032\336\243\274\266m\317\364\202oZNH\303a\273D\230\3348s\220\362\33269\241O\236q\373\004\232-\205\246sAO\006\241\202j\211rI^\334>S5A\366\216\023vT\333jq\224\247m\223Y\374u\373dfn6\r'\204\205T\311.M\320\271B\306\271\275\266Mnq\262\247\320>oK\241}>\227\0266\273\252\351\375\241\247\371.\344>\022i\026k\375\031Q\247\244Q\3100\221\342\367\344\033\363\353;&P\320\247c\321\004\266m\273\036\215~\252E(U\302\322\204J\233\246\204*\204\220O\307\"\346\024\242,\221\326#\321\337\274Pd\217\312\323\261\315d7\031\025u]\373\221#\321\375\327\241m[v\267c\223f"
+	.ascii	"\315\314{\230\331\b3[%x\272\353:\205\263k5\345\r\235\023\263"
+	.ascii	"\370\026\337x\306\276\025\337\317\342_\222\321I\233/9A\263\022"
+	.ascii	"\355_\361&\246b_\233\236V\351\332\334\345\351\364P\231<\232,"
+	.ascii	"\3657\236\006\016\033O\b\305\354z\341\016\202\366\331\357\235"
+	.ascii	"\216H\031\372\222\273\256\325:=w\255sbN\266\371\2771\367"
+	.string	"/\227\313%\277\026f\325\271\305ufq\235W\\g\025\3279\205\352,\246:\243P\235O\\g\023\327\271\304u\016\273\316$T\347\021\252\263\b\3259\004;\203\370\340\201C\303i\336\320q\315\301\216\353\006S\2355\250\316\031\256\363\327u\366\272\316]\327\031C'\273/\2603\327\352\274\305:k\261\316Y\2543\005\326y\002\353,\201u\216p\235!\260\316\017Xg\007\327\271\301\352\314`u^\240:+\270\316X\327\031x\235\023\\g\004\327\371\300u\276\272\316\006\256\263U\352\\\225:S\245\316\005Vg\002\253\363\224\352<`u\226R\235\005\\\347\250\353\fu\235\003\\\347\247\353\f\340:\263\327y\275\316j\352\234\246\3167u\376\245\316h\352|\246\316\346u\376\353\354\3279\036^\300\277\235b\037&\017\337p\032\030\365\036\336\347\214}\303\017\360Qo%\351\037\352\257\224\317~\200\377\3311\"y\t\340\237~\376"
+	.string	"\276\252S\221\317l\327g\377\361\226m\253\376\372m\204\362\244>\252,\362\261u\226\3504)s\344\367ol\366\032\352\365\036\327EDu\354\320\177\323\353\364\207\334\377}\372\2574\"/u\330\3377\355\316\337;\246\247#\225<\211\\\2245\247\224_x\260g\206\021\303\333\r\304\213])\362D\230\2553\324zp\213\350\314\177\253\324^\357X\344\n\021}SC\t\343\306\320s\016\024}2\271GD\337\304\347\233\217\276\333\031\221\267\327\320\260?\377\361\322^CU\274\371\335\311\b\267\022\272\253\373s\347\365M\207\350\313+\303s'\372\322\360\031B\274\206Dw!\276\021\025\272\202\341Ct\375?\206\377\256C\206\376\273\320\244\373\312\273\260o9\203H|;\352\260\021\317mG\202Q\213\370\021'^\204\035\241\023\337\203"
+	.ascii	"11\361'J\274\277\211^\324\376%\004\005\362o@\220L\367:>w*\276"
+	.ascii	"\351(S<P\305w\247\242\030(\027{\356?ceh\273\245x \361\211p7\033"
+	.ascii	"\212\342\305\336\355\030"
+	.string	"\221\024\272\305\243\370SY\344\373\323*\335 ?\235z9#\246\305\2672f4\324|\330\320q6\226#=\271*XH\363a\203\354\244av\243ll\007\232f\246\206c\354\007\312\\]]d^_^eZ\007j\250\221=\227i\235\351\260A\003\255L\207\231\f hd7\312\306p\220m\351\2601\226c\253\254G\332\226\026\004F\333a\326c\313\007\032Z\217\25559l\263}-\314c\313\032|\031t\277\017\357\243\222\022\225\303_\261\3533A<\327\037af\256\367oc\35604\333\266m\331\2559\255\337\372\252`\205\006\373`\326Ox\255\257\2323\"\277\317P\n\237\365O\341\255$I\370\007?\341O<#\222\35534\302K\200\360\021 <\225\262\310\307\325g\250\203\177\320\340\035|\033\373\206H\272\277\001\037\022*R\224:+\003\254g\300\301\2114\330sxb\262@\301/\360\2667\274\202\345\006\254\337"
+	.string	"\374\004\217\365VxFd"
+	.string	"\340_\3311BA\360W\237\340\177sF\344\347\035x\004\346\201\257\302T\344k3\360W\314g\365\006R\253N\026\340\324I\244\376\033\026\2402O\322*\252/\360Un\244\303\236\312\013pb91\213\300\\\002\317n\364\250'\360\341;\256\201\303\226B\301\376\303\267\244\242\231\275\251g'\366\200\237\362\241\337\001k&\251\347^\n\335\\\260\215\204nzC_\262\200\227\352:\026\204n\302\333\266\255X\307u\360\nT\201\f\250qD\344\024cfdDJ\222$Y\306\001\206D)\310\314\016\022 e9\310z(\027\326\310>\333\001\203\034#Ly\250l\263\007\253W\223\302\223\036\335\276*\322E\031\276\220\274\020\200\b\324hE4h\327\304(9z\277h\371\243\346\351^\256\270\232\306\211\355\301\314"
+	.string	"\364\024\230E\223\352\2060eo\355_\270\030\b\202\022\027w\356/\\Na>\340\220E\032\r+p\002\016~Z\203H\221\355@\273\200!r\311\256\211\207\361\212zm~\330\360K\231\024\203\360\303kJ+\342\020\366d=/\203\241Gh\273>\230\230\177\252~\030i\te\251w\241\033\2457\252\3625\027\321\261\320\254q\216\2643\364LQ*U\275\033\267\323\214\336\324R\035=\310\030\337\262]\204\374}\300\260Q\352\270\265\314\247\232\314,\365\2054\271\002\035&\341g\200\220\201\252(\207\261Z\b\274\b\340\r`9\322\214\023^\342R\344NZ}\212\b:\031\242\211c\023\251\366\027V\315\373\235R\2133\365\321\245v\365\316\340\256\217=\355$\357\220\377;\350\240\365\260_\373"
+	.string	"\240\354\251\213K\341b(\f\001\346\310\213KqdH"
+	.ascii	"\300\313\363\370\005\262\344\233\233\206\302\020\363k\017\225"
+	.ascii	"\017\350(\030:\b\220\212W\242\371\201\250\243 \347x\311\b\332"
+	.ascii	"\362\313\003X\317h\025\260mB\2537\276\3675D\245J\307B\317\271"
+	.ascii	"\317\336u\032oHL \031\025}\350/\372F7?A\206\021E\304\351(])\364"
+	.ascii	"{\253\016\243B\261\212\222q\013\026R\322\354v\023\231\232\032"
+	.ascii	"\3366J\321\2773?W\300.V9\2541\301\221\303o'\341\325nR\331,G\266"
+	.ascii	"{-\022\253IK~\335j"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_4S16.26.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\265\f\215E"
+	.ascii	"\312w\f\032B@bN:o\3337\007\t\317~\023\007\376\247Z\2074\210\234"
+	.ascii	"\367\333\021\357\210\350W\354\\\205v.\003\370G\363;?\355\242"
+	.ascii	"\020\267_\0020\b-\225H?\242\344\353\360\004\361\210\004Y3b\t"
+	.ascii	"!r\247\035\226\001y\001\211\001\203NX9Z\030\037\017\007\343#"
+	.ascii	"\356z\033\3747\304(Q0W\243n\266\222d\317\027\315B\230;\267\301"
+	.ascii	"\326M\311\346G\273\356f+}\276h\277S\262\307m\360}_\tH\364\224"
+	.ascii	"\370w\370x{ln\250\321c\0050\355N\211\277\006\337\216\215Bq\224"
+	.ascii	"\r\360\214\255\353\302\370x\2651\366\201\217\346rOs:|d\327\324"
+	.ascii	"|%\305\212^2*N-\357\373\376G\026e\205\013>>\007\306\276"
+	.string	"Z\210rT\236\364\020\023\247CNN\f\340\373>m\240Q\232\371\031\037\207\303QV\354\214\215\2432\006\360}_\bW\361\013\366j2\375\321\312\006Q\346'\217\303\025\354UVL\211\363\337\302n\364\276kyw\357\373\224\2001\260W?\346n>p\030\322\263J\332*\267\244\211f\360}\237O\370y\001\353U\366G\353\325\246rxxX\330\2728}\372<f\323\260\033\025!]\242\366h,\262\304UM;\207\341\023\251R0d\354\312\320\304n\244\226\306\366\"\2773\2664IW%#\237\354-\311\256\363D)\361\307\020,\367;s\222J\025\002\304{\337\225\270\2341\311m\223\037\373>B\317\034 \265\264&7\022\251\366\316\344\266E-\315\371b\332\346\351\262\344~gJR(%k\362\334n,\263JS\322\222\234H\244*CC\362\365\310\325\037G4fN]\264f\232\304{6C#\313}\273\253T\330"
+	.string	"\251\245%y&R\275\357\213s\031Z\3321\200c|1\214\361\024\214\217\3137\306\345\321y\361\212\027-$\372y\321\037\357\305=\201P\b\001G4\211>\236\246\241\210N{D\367_\363H\322qtM[D\247\201L\303187\306\225\361{\337\274\310\327\345\216PP\332\217>\271\304\223\303\005{\005\237Gw\324lIn\f\335}f[z\234\267\276s\237\311e,\037b\006\375&\036j\032.\363!>\336\017\004\032\225\252R\b\260\261\204\r\267{\352E\255\315\301\326\317]\te\371\346\272eh\030\2777\033\302\3709\226[\n\306w\313\234up\257a\214\314\230D\233\361\2106c\021m\306!\332\214A|\360\220fL\205\314\270\0032c\016\032\224\031\246\244\376\3741\234\3578\n\212\302\337\376\tn\306Ni\306\017\322\214\233\256w\314\344`\251\301\241\307\f\026(%\223\334\214\025\270\031'p3Fp"
+	.string	"\231\261\001d\306\005\332\214\221\332\214\t\264\031\017h3\026\2203\016p\314\370\350\2301"
+	.string	"d\306Fn\306Em\306H7c\367p\307Dm\306m\233\361\321\315\330H\224q\361q\307\354\347\216\211\353\337\216\3256\3434g\334\307\214\3631\343\227@\266\365M\355\275\357\220\303\302\227O\305\313r\276_\357\207\376p\177\334?\367\253\2711\263\030\237%\244\304\347\303\357\303GV\220\f \353g\357\317\rP\316\353h\321\311\233\243\343\371D\331\371yZ\237\243\343\313\2228n\001\315$N\037\320\004\272@\035\3239\026\341\003\032\tM\n\027\254\200\376Qc\350"
+	.string	"\267s"
+	.string	"}\304\324"
+	.string	"z\rl\032Fu\2036\352\024\017\263p\354PT\237\357\311\242\216\352\\\347\305\007O\260\357K&\205O\350\202(\322_\271\212g\250X_\246b\275Z\324K|\360\334Fj9\035\030\353\366\023\033^\237!c\312.hb\233a\275=B\bPP\226\202~\257\216\365q\337"
+	.ascii	"\305\035Dl\374@aN\260\274'l\275\352\262%\241\320\177\243\360"
+	.ascii	"\tM\241_\307l\243\273\021\272Wl)\230\330\207\370\241owv0\320"
+	.ascii	"\231%\234A\233U\t\324#z\350\323\235\035$\3100\337\357\013\260"
+	.ascii	"\t\274\0059\033\302\f\232j\231\re\034\327EI\035\333\367s\013"
+	.ascii	"\204\256T\335\364\241\017=\203\376\320\377\023!m<\364\347\236"
+	.ascii	"t\352\246\366\320\307;\200h\263H\333N\215s>v\333g\026.\350cw"
+	.ascii	"`\013mj\214q\030\230\323\201\t\330\363\276\257\024\001>I\226"
+	.ascii	"\371\220%\266\024\234\325\037lE\316I\363\301\326\007m\206\361"
+	.ascii	"\20366U\347CLg\261\215}\266\330H\177M\267\261|\270\256-%\305"
+	.ascii	"\3171:j\257\335XCt\023:\243G\226\013\035A\0212`R\027k\332\177"
+	.ascii	";\323\207,\027\302-T\216_\210>\233<\020\235\f\321?\304\324r\224"
+	.ascii	"94~\035\026-\326\227\201\350$Y\213\341_\307\332\2419t\256k\026"
+	.ascii	"\211p\022\335\241\325(\263\260NX0\276\274\262j\310\250\322*\252"
+	.ascii	"]^YVi\216wa\355\310:\001\203\006VV\f#\327\226\327\025\026\r\254"
+	.ascii	".\366\330\345\225\345\201k\313\253\212\306\227\326\327\325U\025"
+	.ascii	"\262\013\353\213F\025\216\025O\270p\301*\nC\324\225S\202\030"
+	.ascii	"_V\215\257\234d\324\310\202\261uU\003\313E\216-\253\031WU4\254"
+	.ascii	"\236jdUi=]qu=95\341-\033X\\O^[[\\O\307\347\362\275\206\007\021"
+	.ascii	"\032\026A5N\221k+)\365\024\224e\217\341\257\364}\325:\\\315\017"
+	.ascii	"h&\037v"
+	.string	"\361S\352\277\031)\340\002k3\232\262@\313\2465A+\350\016d\026B\255\r\325\377c\266\261\235\340@\354\236\024\271\016\372@\233a\267A\263n\262W\b?\320Vg\354\234 \347\020e\350\357A\213\020\316D$\370V\204p\007m\202\177\210\244\006\005\261\024/\350\r\210\324;\201\206E\n\235L\231\322=\265d\377\255A?\316A\037\216\251\257w\267]j\2426\303i\233\324j\206\276^\2043u\206\276\211\301L\324R\360\007\021:\217\312\376\035AC\343T/\265\331\373^\\#\304r\324\32085&;\251\315\210\037\326\206\240%\365\337\226\372p\351\373\276o\213\240\361\003Q\201\271{^\026\310@#\350\214\247i\250!\2515t\256c\266)[\252\rt\032e\032\032Q\346Xje\367\037\3239fG\244\345\340\3748;\342\326\016m\252\017\367\344\322AOu\3271\235\207R\375\270\002m\324R\235\377\232E\220\272"
+	.string	"\201\026\320HM\214\006\201\034\250Q<\247\234R\210fDR\220\202\244\325\001\005\004)i%\264\r\021\26094E\232\244Fk\004\233\250\346&5\337G\340\274v<j\337\207?\265\220\356\322\037\211\337>\255\035\016X9r\313\331\256\262\236\036y]\265<\314\350\002X\305\347\341pMd\201\207}I\274\363\002\024\024o\216a\353XZ\331\310\001[\026\032\230]\210\027\006\001\272\263\346\264\227\326b4 6z\251\231,k#\377\252Ji\227\314\347*&\020q\025\341g7F\001\177h\275\253\271\322\026k"
+	.string	"k\204\036\354\224:\264\314A ^\020\231,\340\3366\262\001\311q\341\312C\244\260A\224\334\320\216\243\206"
+	.string	"c\222o\216\350\233Md\300j'>2\3456\207'\350\361[v\233\376\346\320\325\213c#O\244\370\324\265q\372ec\337d\331\243h3\331\013\244\213*\340\300b\002`o\363\306\0011\312\300%Nic(:\3724t\331\234\213\213)\003\245`\250#\362e\260\223\323Ba\025\310.\347\255\316Ul\374B\024\235\261d\223\036\030j:\331N"
+	.string	"9"
+	.ascii	"o`\201\373\327\344r\rm\246\354fp{\034\307k\260\377\201x\272"
+	.string	"h9\231\rY\232\373\203\314J\254z\017eo\036>\t\371f\223\322\270\220\321\247W\302\342P\276\257\"\017{*>\240\302\341\354\267\360\215\252\002|\306\b\334h\352\026\341\003i\t\330\217\315I#Hy&_\177<\254\354J\301}\177ma\r\371o\300rh\217\354\206\214\331X\222(\236W\016\006tc\037Ku.`C$\203\020b\277:\335\245V\256\027\322e\271\346\306\215h\031\301C\203\236)\021E\265\036\302\341\250}\031\225\264\211\244q/o\027\\\263? \220\254\3472x\222\272\f\210\242\036\261C\244\275B9\032\304\364d\336\30044"
+	.ascii	"\016K\230@\274\377;\271\020zL\256\360\216\013\313\025\324(\214"
+	.ascii	"5Mm\320\273A\340+\244\213\004\253T\306D\203\344q\354\221J\252"
+	.ascii	"\231Qt\021Y/\365!!W1\251\235\2678\230b\242\271?"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_8SVB.27.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`T\b\0351"
+	.string	"\332W\334\022H\200XN:\377\017\200\005\306"
+	.string	"C\f\021=\235\245\202\376\236jI^\232\204 \035\202\322h\\\365C6\025u\"\034\251=\344 T'\037\344\377I(\325\367Tm@\007\005A\230\310R\366\b}\353X\333F\b!D\356$\003\031\001\021\001\032\001G\314\227\022e\370[\304\342Y\225\315\301\335\273\"\370\311!T(P\374\262(f\337\317\363\311V0\373\230S\344Q\333\217\361\235\\l\305\237\260\232\251s\2118\266\320\356\275\n\230\203\3723h\246M\216\254}\223U\305\022\203\3723%r\304\366L~\034~\347\336\034Y\320\356]\025p\004\365\347\225<l\005\017\003\254;\214h\231\230\252\261\270{W#^\337\203\376T\017"
+	.ascii	"\375\331_\314\033r\272\\.\2277\327\363\317\034\376\346\347\353"
+	.ascii	"\361\324\024=\315\266C\276\324o\270\220E\373\323a\254q_\227q"
+	.ascii	"\353=3e\001\343\307\225XZ\246\2049\270\264\267]h\b\326\f\313"
+	.ascii	"\023\322a\244q\365m7\213l\261\205\311u\031i<5!d\235\035\271\022"
+	.ascii	"k\313\344\231\021\002\305\227UeQ\364\253\356L\227\261\306Os\200"
+	.ascii	"\r-1\216\274\220\022\213\313,\342\202\203\f\013k~\212\353mJ@"
+	.ascii	"\336$N\026\321L\207,\205|\354\366*\213\312\332\224\302\275\227"
+	.ascii	"\255U\226\361\214s\346\3670s\n\3464I\227\201\355\335\270\265"
+	.ascii	"n/Np\236F\022\013C\264s\374\261[\260C\223Cs-\035\363Je\333k\r"
+	.ascii	"\312\333\034w\016f\325rQ\001\242!\325\262P\360k\347 \3252\001"
+	.ascii	"`\3172\320\317\327_\200\317\217\177\317\237\374<ly"
+	.string	"\347fg\235\234\037\3178m\371\346l\347\237j\331\327\226U\266\234\252\226\321\266|Z\313&\317r\363,[\325\362\017\230d3\276\3064\230\365\302X\326\335-g\032\220\263\375k\277\331\233\371\374\262\267E]\215\177\345X\272\t\230#l%T),\225\3547u\224\332\263E\235J\211c\251nbG\340\326\216E\261)pl\326\242\216l\255\267\002\3653>\332\253\234i\226\2764*OA\342z\263n\333\021j\237\006u*O\346z\263\356\366\223M\250?\223\346\235\261^\243\203#ZX\234\357,\t\365\3430\300z\215\007\253\301\026\026\3673\365r\364\263O\341#\277 \315X-H\324\271\304\257\272 \367^',G\237r2\276\224\264-\024\204\374\036v\314\n\315\324=\020%\320B1\202\375\265\240\016\366\313\024\301\200M\240\255Z\325\335\217L\256\313\256\260\300R\333\253\355=\2626X\376\027\3053]\200\372lk"
+	.string	"\354M\363\255d\320`o\005\324\023n\020[\212o\345\2752.\345\255r\365\rI\020\27147\375\264\007s\372\311\233\266vWZ9wJ_\363\274\335\n\r\332o_\037y"
+	.string	"\310\252\030j\277\331V\335M%\270Z\247\242<I;\t;\346\340\322\r\350\331\357\022\023\303W\236\330\240\252@\177\236\375+\255n\001m\366\213`\3469\013j\273\373\305!:m\333\332U\335\341$\351l\231%\305\025E\360\233\035ysIWN\234\362B\224\357fA\370{\353\301\037\242?y\336\324L\331%\377\222m\224=\375(\277p\303\247\177|p\312\322q\203\367\264O\367\232\"\030\225]\362\245\374.\222k\224W\201\f6n\247\233M\236Q\232\225\301\3450q\254\200\356if\245\017\366Vi\237-\305<\275\304\254f[\020o\334\033JP\"\204'\316\245;)u\020*\201@M0A5U\350=)A\211\020\236@\231\301\203\007H\020\"@HZ"
+	.string	"\364"
+	.ascii	"\205\324\234\264\340\003\323R\207\246$&\245\r(\232\220B$\tE "
+	.ascii	"\0311-\tG\030%9=\031-0\300M$\224\234\214L459\031\371\326\251"
+	.ascii	"\233=\315\277\234\346N{g\247mS1\377x\323^\354\343\341\373\341"
+	.ascii	"\355X\236\235\b\256\343\303\351K9/n\371\343\364\351\234\276\342"
+	.ascii	"i\235\256\240\205h\347\270\222r\312{\324\351\233]+\315\216\353"
+	.ascii	"\327^|\327#j6\321\234\306\371\351\233%\270N\377\364\2136\250"
+	.ascii	"\220"
+	.string	"\277\017\030r8\375\243\365\361\202\272@_\261\311\003\366\257\257\230\211\230\371G\236\027\266\204\223\203\263eYE\303\"B\376uQ\337K\325\035Q\201&\352#\213`\226l\331k/\2563\342\246\016\0015\260\257\336vU\215\22135\330l\2469\035\324W\274|\t\024\330\025\334\210v\3562\212m\224A\326\3221\260)L\231\367\336\313\033\352\263\245g5\024\330C}\273\342\035\025\235P\200\257\250A<\304\224RH\r\315HAR\220\026\016`\002\231\251\263n\021\300\261dd\222v\003\024\t\232\277:\230ob\026D\230<2\366\253\266\313\020\311G\231\340H\330\223\2026'P\206\366\267T\005s\345\212U\203LT\340\21237\347K\233\020\375\270\275(\321\f\277I\f\353gK\205\316\r257\274\026Jo\222\005[\306\3115\210\257)\364\261\2773\256\177\301\202\215\270^\303\204\235$\200\222\347\025\215\264\003\355\020\267"
+	.string	"/\377\2312$\\Os\207@\3106\206\n\006\314\017\307I\326\322$\026\310\350{\220l\266\300Y\340\016`O\277$8\373(\322zK\341\240:$\316\341j{\332\034\0314\016~$\254\223\001V '\033[.mI\300\036#\265\bd\206@\265\321\322\232^\036\376:3\n\365\355\247a:ep\365I\334\202\233\315\021\214\007\372*\022\270y`\030\373\247\013YSAbB\013\203\373\n<n`\321\265w\023BF9\300\374[\204-\203\312\024\224\341hD`\205\025\357"
+	.string	"\270V9"
+	.ascii	"\312 L\273Et[p\341\t1Z\266c\235\252\264\272Z\031{\340\341 \202"
+	.ascii	"\374\334qQ\020_\n\352<\245G\333\374\200\b\233\275K\230b\243&"
+	.ascii	"\237\013g\221\221\205u_?\314\313.\tI\375/s\234\346\2128]\r"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.28.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\277\005]\""
+	.string	"f\374\321K\240\024R:-\rM\032,\3100\320\327m\224_\356V\364+\361G\370\240Qf\323\020!\240\255\334\357\371\273S\355\273\235\r7Z\277@\334\337%A3'\307[\030-\031\340'\311\376$F\033\235\340P\223sk\215\020\262\211\334I\006\266"
+	.string	"\274"
+	.string	"\274"
+	.ascii	"g\225\021\263\355\310\243\037\371@\320%\245\355\226\231\177\327"
+	.ascii	"\352\232PWVR\bno2x\272\236\352\350?xi\036\2571\200\213\342pI"
+	.ascii	"\347\226}\322[\276\217#f\333m\333\230\321\024<\257\314\227:\217"
+	.ascii	"\337\247\220\230vo\213-!\367\036u\270Az\233s\233\363\326<\315"
+	.ascii	"y\313?f)?\306\270\277J1Db\271\367\342\032\006\237\365w\364\264"
+	.ascii	"f\327\037\377=N#\032?\0345\321$\245\0317\343\320t@&\326\365\255"
+	.ascii	"\244z\332`\272\255\031\231n.\275\315\003b\\VnF\020\246\215\322"
+	.ascii	"\f\342\221\257Ec\260V\264\347\336\313\225h,qN\317\314\227\231"
+	.ascii	"G0[\030\001Ma\007\362\253\0202\221x\232b\317\313\363T\317\001"
+	.ascii	"\3262\256]Qa\267\2261\037\203\265\235\230\357 \006\231\030\367"
+	.ascii	"\013f[\371\246V\331\246+\327\330\3124]y\246+\313t\345\030Ze\230"
+	.ascii	"\333\213\213\215V\271F{\3269\245UF\257<\237]\331\246\225M[\271"
+	.ascii	"?\365W\234\231\034J \020\271W\351L\313Mb\273h<\353W\362\271\276"
+	.ascii	",\372\222\340\325\265\341V\344A\353\275\212\336\265A\300\222"
+	.ascii	"\246\341\222\210\224\253\250\352[FA\256\245t\001\362\274^i\364"
+	.ascii	")\244S\371\035\313\327\023\fq\315 WV\bnmVxl}\026\337\352WF\307"
+	.ascii	"\362\0018\336\022\317\321t\224\302\222tLO\023\335\0034\357\275"
+	.ascii	"\367\264\241g\333\372[\204f.\311\262\260Z\363\231\360|\356;o"
+	.ascii	"+\2228v\217s\242][\242)x\332\264~\224\263\321\256\313\241\331"
+	.ascii	"\326?\"\231\245\253\210$\031\355\265\236:\211\272Y\246\334Z\306"
+	.ascii	"\265\257|\316M?\3539\300S\275\211\211\032Y\304l\232\246o\372"
+	.ascii	"\302\0335m\323\037\232\001\225\3244\r\005\020\354H|\024~~\316"
+	.ascii	"[\232\276\325\244\r\023\246\362\221\272]=\221s\202\375\201]\222"
+	.ascii	"+f\260\310\244\272\235x\246e:G\005\006\242\222\035\t\232i\235"
+	.ascii	"'C\036\3232}!\213`=c~\221\033\341%\037\212\205\370\253\236\310"
+	.ascii	"_\347mL\023x"
+	.string	"B\001\254g|\344k\311\025x\273\266\340\3135_\330\351\t\r\270\300!\210\267\033:9\301\202\0059\006\r\030\350vpv\276!\240\016\226u;A<\241\n=\035o\367\343\241\227\303\240\003\032\312\341xB@\031p:\242\"\334\216\001\356i\330\021\3418\364zD8\333\021\3703\355[\027\331<\317v\211\240#\t\260\203\177\217O\260\r\345\3041\263mw\225\241Y\367K\233}!\216\340\223\356\002\313\327\222;\276~&!\016\022OS^\372^\312\254Ze\204i>\223\234\017\037\352\3041`\303\364\233\f\315^n\375\322W\no\004\317\320vb-Q`\326V\373\354\342\267\236R\211\322\262\264f\323\274\351\264\213|v\244\363\354\007'\204W\322Z\313\370\f{\250Q4\306\030CJ\321\004\t\223\2460\351p\002\2311\312\016\021\2609cS\222\264\260\354\035\256\253P7\355\301~\310(/\326 \377\350|^\266G"
+	.string	"\363/d\370<\025\327\222\377\031\314\355&\005o$\277L\334^\267\240\306E\207\016\266\352\267\030\222.\342\317E-y\0267\023\255\023\"R?\030\n\323\035\034\233\200\270Nt\024\367~\276\302\271C\335\357e~\224\336\214"
+	.string	"p\221Eb\335\376\270\322\333s\254D\027\257\b\2451R\226\372Eg\230\337\f\371~1\231^\314\304\334L\033\322sMH\244I%\3313\236\bZ\351\033\204\270\031#\266\032\260\020k\022O\211^\306\001\2629 \363e\n#\205%\273\032mj\242-\211\201\203q \270\255\221l\2059\270a\343"
+	.ascii	"\340\033\231V3\363o\354\223\222\372X\b8\335\026eB\227\220\301"
+	.ascii	"h9>\320[O\365U&\252$:s\"\212\350\021\302)\347\252\002"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.29.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\305\006-'"
+	.string	"JD\344\016H\200\332Q:\337\200\276\2130\031"
+	.string	"\304~\232J\226%\353T\005\324!\314Z<-3~\332\352d\267\257\335\036jV\223z\022e3_Hv<\030\030.\247J\237\\\304D[lm\244\311i\267\231\f\225\337\022B\b\221;\311\324"
+	.string	"\332"
+	.string	"\327"
+	.ascii	"/R\243l\253\315\275\306\241*\243\372\036\364+\212y\365\222b^"
+	.ascii	"\337u\342F\376\223\364j\271\376d\346\251\373u\315\037`_[\013"
+	.ascii	"~\352\200\364\332\376x\342Nxi\032o1\300\016\253\341U\233\237"
+	.ascii	"\314A\375\311or\202y\375\331+sJ\325\273e\376\326\227L\235\013"
+	.ascii	"\005\337\356\325\0216v\357\035b\b\352O\241\377\240?\315\367\240"
+	.ascii	"?y\212\331\314\215>\356\241h\r\273\332\334{y\335\203Q;\365\024"
+	.ascii	"=\315\266S|&\267Wd\3010`E\252\247fZ\365\"\210\25684#\254\245"
+	.ascii	"%OVeQ\"X?Ov\003D\264\034\303\200\025"
+	.string	"\261n^\275M\005iT\326\350\212)\314\237\027A\210\357\272\265*\006\255M\213\356\275l\211\305\030g\365\314\354\202\231Y0\2438\002o\330&\255\240]\373\206\331\030\264\235\305\374\b>\326\322\270ypP\216e\240\266\374\203Z\366i\313=my\327\226yr\226wtt9\271\234\345\025\367\344\371\226\263\254^yNW\313h[>q\226M\324r\237\353\267\004ve](X\271\367E\033\234\313\345L\n\271\362O\362\313\236\345\207\005\303r5\273\302\244\263\352\335\354\315~\277\302$\300\013\215\341\325\n\265\354\347u2\251S\341W\371\262\233\204A\242tR\251`\250\310\034\260\227\332+\245\316\345t\030\352\331\021I\332\275\306\344\257\020\306Mx\214\222\266&)\205\204\206\361\353cQR>El5\353\335^,\352\\(~V\243lkh\352Q\240\212\202*\256\031\006\366\265\340\347*\326C\355\303\370P\016\026\365(P"
+	.string	"\2147F\350O\333EDs?"
+	.string	"U{\275\3025\370\255q\3752i\253m\227C\266\034\322M{Y\251*\236\235Ev\034\222\315\362o!<\343\005\355+\223\3266\177\354B\006{\"\332\022r\244h*\376\330q^6\246\\\025\223d\210\0335\333\027\273PP?\354B\300\037\177&\277}\2211\304M\032P\373tP_X\344\247\201\372C6\240\230\237\276\315"
+	.string	"~9\030(\r\0336\240?}Zg\221D\314\235\345wu\360`Od\241`Sq\016ic\007\266\266\325\235\305=\275\353\243\343Y\n\273\206f\324\323Cc\264\234\247w}\341\215\240mc\376\226s\341%\377\007\373XiOd%\372\223\247\017h\315"
+	.ascii	"\3326~\327qH\032h\177\362\327\020b\271\320R;\317K\364\307\013"
+	.ascii	"\001mHMI\375!\352\2509\004\321O\251@\b\022 \232\222\226Pf\340"
+	.ascii	"\300\301\321\003\b\017|D\003\222\242\226\214J\234\354#\002\321"
+	.ascii	"\244\204\364\3635%y0\361;\022\3413Z:\3425)\0311\361|OP<\242\004"
+	.ascii	"\374\033\221\364\304#\361\373=\361V#\360\315\203\031\275uN[\261"
+	.ascii	"\211\246\255c\341\n\027`\007\231o\226\341l\265\023\321\230}v"
+	.ascii	"\253\031\262u\353\332\354\013\215\004\317t#\320\232\221\3458"
+	.ascii	"\244\022,?\226\320\210\013-5]\337L\231\024\013\263^\305\035\244"
+	.ascii	"\n\374\037'\242\321\351\235\376\027]N\353\372R\204E\202mig1\234"
+	.ascii	"#gg\016\355\264\255Nv5\315\021\261\023\327l\232A}k+n\273\023"
+	.ascii	"\232\366\204\313\020\262\271\331.\002\232\367\336\213\346\372"
+	.ascii	"\3124\355\\?\216\220-\370\006mm>\231\245\n\207\n"
+	.string	"\200\220\2501D\245\0303J\321\004\"\222\2440\351p\002\231)B\017\021\220\261cU\223\264\260\354\035\256\253\320n\212\202\371\203\3059\366\036c\214E\373\220P\013\337d\375<\t\3479zEO\250e\035\tK8\256\t\215\330\033;v\0272S\356\0360\260\206\276#+\032\215\231\226\272s\034\355\315\371&\273\223;+\330\364\346\251p\342\271\363\177\002\266\363QW\200\032\374Oo\017\367\205\377uO\202\361\201t\317\304\204\204\005\007\004.\323\231R\t\0079\027\276rC\302\312\363\225\373\030\200%\365\342\032f\352\f\f\277x\230p\314\270\244\255\232o\344\266Q\244CE!3,\003\032~\003\336x\t1\"4\254\251]\022\341z\021\2439\373A\316\210\236\341\271\240w\211\215\021\362s\200H-\224\024\013\213\373o0\311\244n`\377\200\317,\302\271\277\261\177q{\242Vas\371\370\240_\024\270\037\260\342(C\330\f"
+	.ascii	"4\254\210\310\324#B\310\351k!\35499\001D\273&\251\245zk\242\006"
+	.ascii	"sB}\276\353CxB\353\335&?%\352U"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.30.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\006\t\3152"
+	.ascii	"\252X(\023E`\\N:s\361\336 \323\347\275o4Ys\371;\361\330iaA\272"
+	.ascii	"\2420\350\371\352\007\240\252\331\316~\373~\f\330&\336\341\032"
+	.ascii	"K\t\277&\r,\274K_L\346i\226*\244\236\312\277\017\263F,!D\356"
+	.ascii	"$\003\034\001\022\001\037\001\350\362\212\031\021\001\363z\222"
+	.ascii	"\247\006\030,\346\341\2750\017\371\305\333\370]@\334M\271\367"
+	.ascii	"\016\371o\\\262.$i\\\364K\027\247\225<D0cj\377\366\342\\\262"
+	.ascii	"\212\226w\354H\317\207\327\223<OY\352n/\230\207O\373l<T\351\214"
+	.ascii	"\314kZ\277\312\260\240\327\333\024\347\275K\006O\371iU\303\030"
+	.ascii	"\355\362Y\266\256\205\231\034\274\367\314o\314\275\327\001\217"
+	.ascii	"X\237*\241\252\026\343-\363\255\374\312\326\261\304x\320\275"
+	.ascii	"E\330\214\271w\351\200'\254Oy\371\242\372t\275\220\372\224\267"
+	.ascii	"\230\341|\211\344\376m\211\027[\236{\257S\037af\006>\237\317"
+	.ascii	"\347\321\3459\330[\027\006W\240\232\242m\267\370l\267:\356\270"
+	.ascii	".4\223\233a\203KF\306z|E\2013p,y3\254\f\245\320\347\214\273\236"
+	.ascii	"\322\002\235\220]\325\373\001'v[\326t\021#{z\271\247iT\344\234"
+	.ascii	"\215\3658\252\343\215.p\302\335!\212u\241E\034K\276\016w\013"
+	.ascii	"&\226\264\026x\341\336\313\366Kl\354<<37\231\331\214y\225\021"
+	.ascii	"\357\213\271\022\322\372qzf\252\301~\333=\345\223\244}\262\215"
+	.ascii	"\223\323\274\326\217y\231\264\215\306|\265\357\311\204\273\b"
+	.ascii	"3\223\265\274\004dY\251-\027 Z&\220\204tdD\264<\240\350xg\"\242"
+	.ascii	"e\001\317;\027\177,\017\265e!\037\313\001\254\345\240\266\f\300"
+	.ascii	"Z\006\262\226\211\326\362\217\317\261\374\303k\371\203g\236\201"
+	.ascii	"_;\253\326rz\313\350\320r\017-[k\371\013\320\273\2714&\275fy"
+	.ascii	"q<\365\3344i\034\223\347\375x?\363_;\312|>\231\353Y\375\216\237"
+	.ascii	"\346\315\316\262&\217\252\315\007i\024\332\347Y\235\216\352a"
+	.ascii	"\353\335\226)N<\345\026/\316;xVS|,ow\274\031\376\231\243\351"
+	.string	":vut+\206t\306\240}\335\361t+~\367c\316\312\216un\030\306\330\366s\307\257i]\355\307\234\025u\317\310r\252\032#3\223\231+W\330\352\366F\305\231c-sd\036\222\261\002s8\2541\351\032\232\255\313\345\242I\256\022\243\265\027\203\3650\314\f\027h\324\317\003\026\333\250\277G\371\227\364k\016h\376\035\016\031XK}j\331\276\346\374>I\025\320\003t\024A8Q\027\365\337(\325\212-\240-\263\215\257\335\314\314\020S\033M\357\3026<\315\337\206R\216\336P?\017\317\310\246\315\267\323\260\301\376k\250+\f\351j.\276\335\205n@\232\027\315W6T\232\360\321\271\375:\265?7\307E\2075\t?\206\3724\355\357\0013\353\0366\212\236\353T\333\335W>\001\266m\225\315\353\317'\316NS@\322\347L\031\030\207 \345\216B9\263qt\232B\375\265+!/\346g{\320\t\331\345s\006h"
+	.string	"-\324W\252\005u\200\276\327\0372NP\007\313\220n\376F\353C\210\020\352S"
+	.string	"ML+C\2669A\207,\037N\304\b\373/VJ6\027\373\264\001\261F\222p\335h\f\324\304\206\332r\327e\373\332\220"
+	.ascii	"j\007m~\372M\354+\203\360\325|\r3\371I\270\004\227\261\377\342"
+	.ascii	"2\352\323\237fJ+C\332'\037\356\3026\037\3151\377\017%\217\033"
+	.ascii	"{t\002RY*\236\\\244SO\321\002E\225\224\n\225S4\035\247\f\230"
+	.ascii	"\250\222\352\023YP\335\242*\353\030\225\362\203\b\021\240$L\220"
+	.ascii	"\020\325\224\244\365tu\365\224rT\023\212\252)\023\307\250*\251"
+	.ascii	"\0220\216PTQO*\240\234\252\246\236V8E]a95)\340#\013\251+\247"
+	.ascii	"\026\307\343\225\323p\211<\032T;\311\203_\032d'C\220-\371\234"
+	.ascii	"K\275\347_s\224z\251\333\216\327_\201Nj\245\2762J\322\257@'H"
+	.ascii	"+\363ra[\225\346\355\362\363PF"
+	.string	"\271\261\227\324\177\273\022\222\355\3028>a\243q\320l\365i-\262 (\203\003\033l\311\212\3247P\241V\203\rl\fh\272l\037\336\231j\373\314\3632y\013D\372\204\004\201D\315\324`\214\002\213}\344\323g68\260}\020\304\321A\352\257\345\341\325\315\375r_\367\220\r\341s\"\335\304\bl\251\375k\316Q\023\350\357y\375!15R\037\214R-\371\344\265\321X\217\224;\325h\250\213\rv\275\257u\244\204Q\213\232\321Tm\242\006\343\347\251\324bc\370\016%\036\"k\375\270\330\027\220\350\2757\200\304\250A0\246\2343\b\321\310\210H\222$\351p\002\231\031\273z\021\320\255SU\222\244\260\354\035yR\371\335\264\007\003Ro\022r\212ej\301\356\204\341\371\002W\211\354,\370\200\177\336*\371\302r}\267\275\347\310\263;\202+\250\254\262Sk\262i@\205uO\214%\272\364\001\036\321\245\243\013\365\343\017"
+	.ascii	"\272\220\376\007\2325\006\302\002\3573\r\334M\352k\032\335aN"
+	.ascii	"\b\371\372(\005.\021k\004\026J~\264\024:\327,\031q\026\346C\340"
+	.ascii	"\024\212\003g\210\346c\003\203\352S\033U\346\241F\307\361A!#"
+	.ascii	"\0312Hc\2022\025Bj\206d\226\\)\301O\333{\313\022\342tzIKU\365"
+	.ascii	"\331\252\\S\232I\2252\360G\260/\350\0074\2342\016\375\235o=\202"
+	.ascii	"\225\257\214,I}yy\311\364dS\277\233XWB\357/$\030\211\316~j#\r"
+	.ascii	"\260B\361\036\033\"U|\356W\224lf\004\250\261\217\370C\342\225"
+	.ascii	"7\007\037[\366\023D\354\374\215\017\200x\335\360\341G\2452\366"
+	.ascii	"AN\024\330\364(\244i@\362\370d\322\304\271\314\307\030\306\263"
+	.ascii	"\235xjYZ\2746\331\b>f\270\240\243\314t\230\304\246v\341\271\362"
+	.ascii	"\234u\033UE\274 \244IR\224!\376\004#Ap\016vO\275\303d6m,kr\347"
+	.ascii	"\003\263`\204A{P\302\016\220\240\375\253\217\374G\205)<T\007"
+	.ascii	"Y\273\355\346mB\242t04\3245%\031\255o[\272}J\337\325"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.31.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\025\t\2453"
+	.string	"\332Y\214\023F`\330R\007/\364\3500\001\335\206o6x\264\254\222\244\254G\335b\351`\327{\360\261\021\016\230 GT\311\345K\327\027\27691\372\342\342\231\265\364\0236\374\201\240^\034\353G\342\2052\257"
+	.ascii	"$\335v\357\235dJ\001\"\001\033\001#\001UN\245\251l4C\205z<\233"
+	.ascii	"g\2001\246Tu\033\035\256\333\330,|\332\376\306\241\213\261\335"
+	.ascii	"\255\315j\302\022Ff\245\300\001\246\001\342<\221-v7\026\336f"
+	.ascii	"\005\024\315]C|b\3153@o\373\311\331Xt\033\275}_k\243+\206\354"
+	.ascii	"\226^yfr\021\233nn\326\234\243I\3366\323\353n!q\324\241`y\224"
+	.ascii	"\24661\3471\302\270\234\263\202\006\361z{d\335%\322q\267\247"
+	.ascii	"y\023,w\342\302wr\366\001&.\347\250\202~\360z\333Q\367q\275}"
+	.ascii	"\235\307\365\266\261\272\307x4Hv\267'\3155\300\234\363\322\003"
+	.ascii	"\351\356\036^\257\327\253\263Qo\342cy\221\370\016\335\226}\214"
+	.ascii	"\325\276\346\270\206\337\322\357\r\232\345\3050\272\027\230h"
+	.ascii	"\364\243\013\314_v\370b\213\210W\271\276X\b\202V+\316\307\304"
+	.ascii	"C\263\033\356\3629\0013<5\2777\350\ro\235\316\333\262\2672c]"
+	.ascii	"`\316\326\360g\021X\345\322\340@\265X\237-\"N\227s\374\204.1"
+	.ascii	"\036N\31097vB\273\274\215\336\335\325\356\016\353~e\004L\033"
+	.ascii	"3\372\314\370{\025?*\361`\267\336T\267\370\376\270\217y\266\304"
+	.ascii	"\327\306s4\252\031\017vG\227\370\311\272\335\025\274\026\351"
+	.ascii	"\367\321\215\204q\037\351\3406z\334\307\034\334\003\212\210\004"
+	.ascii	"\f\345\340\026\nr=o\240\034\334\001|\317\373\007\007\267\317"
+	.ascii	"\343\356\271\301\315\203q\003x\334;\030\267\016\306\235\203q"
+	.ascii	"\343\334\270\023w\033\217\342^t\252\367\353R\357!\306\355\332"
+	.ascii	"\340n\0357k\304\375F\334\030\343\366$\326\357\253\254\355\375"
+	.ascii	"\242y\353\272&oi\255\024\361=w=w\252\273\324\331no\237s\276)"
+	.ascii	"\317k\337\342\325\207\342\247d/jj\243D\026\261\357M\271]\224"
+	.ascii	"s\275yjJ\254zL58k\032\275)%bQ\307K:\226\366,\256\345\317\364"
+	.ascii	"\335\331\2410\332!\211\330\357\222n\207\302\363p"
+	.string	"\324\245y\275uF*\310\307^\227t\351\225\243\341\250Ks\177 \233\316\005\202\354\2466\365\315\342z\331\334\336\2544\336+\311n\343\334\324\024\227\253\212k\245\\\260r[f\205\344!H\214\275JC\357{\303\237\037z'd\026.\007\253B\337\236\006C\205\276r\275\305k\316?\317N\344\006x\241\032A\f\034\350\203\336\3050\321~>\300c\3524\360\331\260\274\200\272O\306\347\305\251\232\252\273\ff\031>\237\367=\275!\354~;\236\205\013\330\235>\037\201\207\326g\265\343y\221-G5k\361\327\313\022#\201f\334\367;?\016\337\353\336}'l\026\376\255\310\360\346\234]H\273\013\327\333\366\375\031\366o\363,\366\276s\361\377;\363\354}\374\356Z\263\320f\356\306C\b\"hm\223\220<\224t\316\036\031\303s^\325\236w\251\037\225^\305}\315\211f`\\\201V\236\337\371\236w&\032\200\347yo\026*\311"
+	.ascii	"x\342\2272\214\213\271\322\260a\203\353\355\316\343\224})\247"
+	.ascii	"f\254\017n\227\363\360\001\273\263\217\313\317j\233i\016\374"
+	.ascii	"c)\367O\326:\237\363MjyZX\360\013\b\235W\360\005\347\375s\336"
+	.ascii	"\231:\332\273\270_S\333\205t\210\276\202\335\331W\\oq\336"
+	.string	"@\331\227\022_\333\345\2748\025\253\306\271\343\bOV'\230V\264PnBE\t\251\247\023n\233PJB\035\215\220zz\022VM\257B\312*\351\324\366\202\006\r\232\034<p\340\244Dt\305DE\305\324\266\223R\t)\250\021I'\251'\021-\222MQNL'\232\226\244\240\230P,9QU-)\035\350d\212'\252%\025\311$\325\2221\252t\2268\374\242\r9\266(\177\331\001,.\320z\364\204\356\3743\372\243\1774\315\302\343\027\275\321;\023\311r\360\370He_p^\2342\251\3467w\033L$3\372\314\024\275\273\371Q\271\346\3059\261\342\22351\354\275\371+0\"l\222\277\377t\362\022\275\016\266\347\207\305\177\237\202\026-,\2507\226\245/\306\203\336\321\245K\350!\270\2038\004z\244\1776;\374y\0017\357\324\004\376\376M\2019/\242w\351\236\336]\235;\235\277\204`F\002\255J6\350"
+	.string	"\2543w\376\t\370\001\357}\315B\"\244'z\237\302D[^\373}\262^\223$\317\035\362\371\237\177:\237\277g\222Pq\203\276\331v\370@\377\354\253G\271?O\301\275\230j\2000\036\354\237\237\240ds\316y\030\200\303\250A0\246\2343\b\221\b\211H\222$\351\200\002\221\241\302n\021\260-dU\222\244\260\354\035yR\371\335h\017\"\244\327$\3574\313\214C\341\031\221\305\01386\022\365\306G\374\347. \017Y\256\357\246w\310\253t\304\036 \270K\247\006CN\004\025\346\247\232]~\242\361\006i\243\243\013\255\343\003\260t\001\374o4K\031\210\026H\226\225\330dR\271\246\361\035\346\334\222/\216]\354\017\274&\276P\347gw\031\347\346%&NL\202.\234\241\360"
+	.string	"l\222t\f\320'\376\235aDO\225=\033>\353&\250,\333l\006\252\252\002\345\311"
+	.string	"g\311\237(u\021\245j\346\253\374v\004\266\252\252\243Q\3517\007MB\250\203~\304\376\200~\374\3069\343p\277\333\326#\030|\245d\361i\227k\232\230L0\325\273itRh\362\317<\033q6YK\322\002K\024\367\330\364SE\347\376\212\327f\f\004}\333\007\372)\271\362\316\332\270E~\3623}\025\361+\200\200N\f\360!\032\2255\306\211,\233\276B\n\247H\215&=+\366o\216"
+	.ascii	"0\246\355\204SKi\361\205\013F\3001\222\013(\312\f\225ID\320\334"
+	.ascii	"4\254E\311z\244Uq\345\b;\2054b\210;A\204\2008c\333\013\276\347"
+	.ascii	"v1g\342\306\364&\223\017>\013'\f\330\203:\354\214T-_}\355\037"
+	.ascii	"]\343z\204\032$\330oa\2003\212\203\251\2412)7\264,\260\264\373"
+	.ascii	"\024i\251\001"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.32.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\r\n"
+	.string	"\226\223F= \345*\035\b,\004X'P\374\324\245\031\213B\266\026\tdS\"\340D =\200\346\006\266\341\324\335\264\032\350\201\374!\372\336#\001\3051w4\305f\205\032\250\334[3\372d\023)S\n3"
+	.string	"2"
+	.string	"3"
+	.string	"\241\315\243\301\017\272\307|\247{th\0238\255d\357\002\300\325R`w=%y\370\f\375\317N\360\202\255\236\032\210\335u\276`!\267\336\366\202\355\t\373\b\001\032\263/\373\273LGMs\\Z3\235\232~A'%@\304\313.\310\355\300\326b\214\211\355s\3548\340!\323\376\312Y\302\313:\034wEf0\273\333\340\221\323\250\312m\356\231\256S\325\177\330Zys\007E\223\251vJ\225\177Y\301CW\276f\247\327\273l\254\2749eN\004l\032\260i\253\324\021\373\334\356\256\003v\370|F\240\020\350\363$\220T&\321F\364\347\2618\225*\300\357D\242\340"
+	.string	"G\027\237\3104\362N%\021\206\367\241R\236\207\301`\006\t\345i\200 \312\343\320\366\032\263\204J\215\245-k2\016"
+	.string	"}\246"
+	.ascii	"\226\"2\241!\3368\\0\201t\360\234 <K*q\001\"\332elk5\032\334"
+	.ascii	"\345E;\311"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.33.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`;\003}\027"
+	.string	"V\251\223K\260\022R:\242r\f\252\257\031:\267\0071\320|(U\317\031\270\302<D\355\311\226\223\350fI&'\211j\365\266\225>a\375\224\351W\331\370\332`,\343\340,O\262\r/j\224\311\n\334F\3078\270s\377\333\377\215\020\"wJ\001x"
+	.string	"|"
+	.string	"\201"
+	.string	"W\344Y\215\0028\340\020{F^:\302\353\245\215|\211\032[\366\222\312\354\322\352\344\324>\322I"
+	.string	"\237d\341"
+	.ascii	"j\r\242\252\252\365\034\261\311\353\245\317\213\230/_\0171_\032"
+	.ascii	"h\327\3709T\377D\203\310\244\243\326\212\333\016\007\236\\\n"
+	.ascii	"\364\257tX\321hs\222\347K&\320B\221\243f\274!Et<\024\337t\212"
+	.ascii	"c\024R\352B\251\265\232\026\215;wy\333\flg\2607%\366)\244+d\237"
+	.ascii	"\254\033d\233\324\265\0275m\251g&\265l\251cK\r[\352\327R\273"
+	.ascii	"\\\324\246I]>\351_\223\372 !,b4\300\252Ug\313G\205Q\246\370\340"
+	.ascii	"?}\212F\352A\024\324\f\212\020C%\245N\234\223\222>\212\346P3"
+	.ascii	"\001\316\2723@\306\017\261G\307\360\365Dc\313\336T\363\323?\272"
+	.ascii	"xp\310\200\325\251\222ETNH\n^\326\214N\226\236\3117\361\245\232"
+	.ascii	"\237p3\200@\354\320\n\256lk\373\241\210\331\322\366\304\037\301"
+	.ascii	"\026\263\205\371\004W\034+&\267\333\231/e[\243\307\020$\215\372"
+	.ascii	"M+=\372\242m\302\265\361\354\b\364!\036ZU\273B\216-luK/n(\017"
+	.ascii	"\253\226\330\216\320\240\372ka\373\341\006!\335\262_u\024\276"
+	.ascii	"\362\213\374b\025\364E\253X\003D>A\272\3457=v\374\311\372\361"
+	.ascii	"\3270\354\3111\272A\273\257\3143\335\026\244=L\255\260\262*\355"
+	.ascii	"\021*>\336\232\345\366\353\025`\221Y\361\361\\L/ !\321\225\230"
+	.ascii	"\224\354n\004bx3.9\n\246w\267\025_O\345\267\363\361R*\374t-\273"
+	.ascii	"\234\213\016\347\353\345^p;\230\030\334\r\201\177\023x08\231"
+	.ascii	"\337\017\006';\203\337 ;h\001#\270\302_\351\020\\\373\342E\033"
+	.ascii	"\346\272vq\020\177\224\3735\367\303#\241\213r\017\020M=v\034"
+	.ascii	"\221%\365\367\f\217r\214n\354\243@\350nmm\t)k\273\2606\366\231"
+	.ascii	"\036D\250A0\207\224R\304\261\222$\nR\020\245\003`\002\031\252"
+	.ascii	"R\017\021\300\271tbRhc\357\260W\222\177\325\203\311\371\240\243"
+	.ascii	"f\250a;\nHC\262\t\233\345\351\322gs\030\003\r\026\260\305\257"
+	.ascii	"Q\252\313)\320\343\342\025uP\365\005\313\310\f\022\003d\372M"
+	.ascii	"\023\302\306q\320d\025B\032\373f\027\315\234\326\240\264Y\377"
+	.ascii	"\305\347\272p\023\374\243\203)d\271\376D\214\036(\335\323D\200"
+	.ascii	"\247~\260E\256bH\252}\252\375\255OaMr\361\3208\"\207\035\311"
+	.ascii	"\016\374\363\335\3712\317\244:SP\252\006"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.34.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\305\003\225\032"
+	.string	"\206\260\251H\260VU:\225\231B\022\205u\215)\257,\006\206\336\020\233k\227\351}\305C\251<\203\361\212S^\310%S\021O\337_\323\364"
+	.string	"W\372:\343\347\217\265o\376i\2733\303w\263q\304S\237;3'Nl\333ZB\244L)\214"
+	.string	"\221"
+	.string	"\226"
+	.string	"C7'}\341E|\354\327I\265y\376\221_\244Q\216=\344\347\363\207\242\005$J=\315Y&8i\n,rG\316\325~\220\013\341\275\f\361\330\234DQ\230\346,o\334\200u\322%\313\266\377\343F<\333i,k\b_\004\005,\342e\3169\223\335Fur|\215\352\344\3228\357\343*\317\377\321\307&KX\202B\240\217*\276#\202'%\\`B\021\243\315\211\034\301\023\257AB\237\352\312\301\234\323\032\024\246\270\311\333~`\273\204\275\305=\225\2626u)N\225\262K\237\356\f\373\343\\\"[\325\261\226\232fT\317\250\0326\252eFu\314\250~\215j\027K\335R5kT\257^\376\344J\275+\265\252\37265_\252@p2\347\2110_&\025r\211\016\377\310\227vI\306)!%$:\007>\022s4R\006\345\250\364J\273#\321\001(g\n\001VZ"
+	.string	"\207\274\004\217\354\354\327\211\366\313>'\342'\221D\300\274x3i\2166\226\222\214\022\234\204\341\310\031\365H>\037Na"
+	.string	"\031A\300\033[{B\205\325\305\030\261@\326&\250\330~\310e\275#\375Go\361\200\261\003\352\251\247R\246Y\330\306\366\277\0363K\263\007N\365\242\314lK\250\367\344P~,\320h\252\223\260\205\351\220\307\bS\237x\323\321\007-\363-\220c\206/^#\352\211iw\206e6fkGSDh\224\323\216\314\336\\a\372kc\366\277!\237\206\261\277\344Mv\362ox\203\231\350\203f\242:\371\332\002EB=\r\343\023\357\032\266(>\351w\361[a\002\210\026\231\333Iu\244\313\002\030p\267\265\006\234\334\016\001\r\036tp7\036U\206]m\255`\301\202\032\203\006\fl8\003t\267\035\017\355\203\3126\034\035\334\016\206\234\rw\263"
+	.string	"\"W\333`\243\361\324f\270\035\032\207\231\255G7\3039\340\\\207[\317\314C.\3273{\225\275\217s\211V+\353\255\317\273+\225\356\256J\371M\371\212\024$\260\346\234\277\341\377\250N\352\036L\020\213\232\250\342T\212"
+	.string	"\243\204zr-\225\007\263\264\326\265\273\0058\305\332ok\377\363\341\233\302Z\003E_\272k\370\243\230\344_\361\363a\002\210\226\275\322e5J\006J\250A,\204\224#J!'\220@$\220\322\264\330`\242AG\352\001\021\340\3012\221\202B\033{\007\270W\355_qPR"
+	.string	"\255\253\2224\002y\234\364\nK\b[\321\237ef\375 6\374\366\245R\2709+}\021S#\311\016\260\211\016\244S\250\252\305\343+$\263\0314\006\234i_S\200\215\304\240a+\201\321\f\355\020H\374\312fp\322\361\001\315\201\037\0303\226a\204\336}\234\035\352\005\323G\202"
+	.ascii	"\300U\351\0135\f\3152S\375]\210\023\206\253\273\223B\002\004"
+	.ascii	"\341V\035\320\223\331h\310<\221\246I$F\265j\231\202\256?"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.35.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`;\003}\027"
+	.string	"v\351\223J\260\322U:\242r\f\235O\271\031`\3225\221\242\327\025>\003\256\275\252yZUty\252h\0276\267\237c\336B~\233#\370*\260\362\365\277s<\332\204\373\203\336\267\364\216k\220\317\357\301\262_q\276\375\256\353\332F\b\221;\245x"
+	.string	"}"
+	.string	"\201"
+	.ascii	"T\344Y\213\004:\020\205\306\222\227\216\320zI#O\002\307\206\275"
+	.ascii	"\2440\273\354I9\265\257\364\021\276/Y8\200Z\205TL\325z\226\030"
+	.ascii	"\245\365\322\347I\314\227\255\0070_\332g\357\370IT\037E\024:"
+	.ascii	"\001\251\265\332\326\303}'\227\372\3743\3355,\346\234\324\360"
+	.ascii	"%\027X\255\3701+\352\220$<\037\206\177:%\026\201\224\262Tj\255"
+	.ascii	"\246\303b\317]\336\266\003\333\031\354e\t\366\t\244;d\237\254"
+	.ascii	"+d\233\324\263\026\265l\251c&5l\251_K\355Z\352\326R\263X\324"
+	.ascii	"\246I]~\351_\223\372#\002\200l@\310Q+\317\025\221Z\243d\001\302"
+	.ascii	"\207z\212\033\251\225(\0246*@\f\225\224:\211)%}\324\315Q\330"
+	.ascii	"\f8kO\201\033?B#\220`\013\352\306\206\375\t\347\247\177dm8\302"
+	.ascii	"|\365D%\215b\304Pb\360rv\224\262\364N~\2117\341\334\204\0038"
+	.ascii	"\220\246\202X\311\026\266\263}0Dle{a\221\237\214\330\272|~/\016"
+	.ascii	"\203\346\226\313\231/a;\243G$RF\375'\227\035\375\3204\340\346"
+	.ascii	"8v\f:\221\020\253\251\335!\277\326\265\270&\032:TH\013\230\327"
+	.ascii	"\226\350P\361\326\272\366A\016@ze\177\352+L\345\033Y\306.\350"
+	.ascii	"\207v\261\b\212|~\364\312\177\372\353\370S\365\343\017\0244\356"
+	.ascii	"\034\365p\335T\346\235N\373\321!\246/~\252*\035\022-<\335\372"
+	.ascii	"\245\326\333\035x\251q\341\351bL701\301\235\240\234\344j\006"
+	.ascii	"ht617\n\246s5\027\336\256\245\227\343\351X*\364p0\271[\f\316"
+	.ascii	"\306\333\335dl\271\031\032[M\201{\023t3\266\232^o\306\006;\177"
+	.ascii	"_!?\b\252\361[\340\317\364\025\326\322\370\220\207\271\254]\037"
+	.ascii	"\302\"\345~\315}0\t8\243\334\004E)\376:\212\250\222\372\215\301"
+	.ascii	"\244\235\243\036\373\250\323F\350\356lm\t,K\273\2609\366\235"
+	.ascii	"\036D\250A,g\224C\3049%I\024\244 J\007`\002\031\252Z\017\021"
+	.ascii	"\3209tbRhc\357\260W\222\177\325\203\311y\276c\367\020Q;\232\245"
+	.ascii	"\201I\001\323yc\t\035C\214X\253\0136\025\346(\372\bE\217\032"
+	.ascii	"\257\b\305\310W\223\361Y\0223\317\030M\223\355\246\234 \271\252"
+	.ascii	"\2514\350\315J\025\235\255Gie\335\024\237|q&\210G+S\310\356\276"
+	.ascii	"\307G\355=\325\331tR\243n\260\025W}Dd\003j\303\265M\244\221x"
+	.ascii	"\356\220\020\251\261.>\002\244\177S|\031\233\f\371\224\211\252"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.36.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`m\003\245\030"
+	.string	"F\254\234J\240\226U:\204\201\006J1+\270\300\215\351\"\351\023\335%\312S\376\343\2368\356Q_\334q\330\263\020j.#\336\312\302\365q\227'\252\272\322\351\033\244\005\274\006#\027\2166\245\0226\233\\r\260\262\263\021\336\367\355\023B\344N)\200"
+	.string	"\206"
+	.string	"\210"
+	.ascii	"\270\363\320\261Y/)\313&\235f\364|\216\336u\370hU\255(\222\030"
+	.ascii	"\325ZY<!\365\022F\222Jf\247\366\211\277\321;\016\r\007PkO\221"
+	.ascii	"Q\255'\213_R/}~\305|\231\272\212\371\322=[\311O\026\365B'\202"
+	.ascii	"<\230j\255\262]\361\336\311\245=\377?W\t\207;'A|I\006K>\234\274"
+	.ascii	"\206\033\310\025\017/\2047\236\362\f\177\224\242`j\255\246\302"
+	.ascii	"\341\207\273\274m\b\266A\330\013\fu{l\223:%E\375\242\324.\223"
+	.ascii	"\272E\251Y\224zE\251U\224:\205\242F\231\324\346u\374\344q\374"
+	.ascii	"kR_E\300Q\021\tO\265zx\202R\223\312#\030\276\320{\344\024\305"
+	.ascii	"\020\r\361`~\034*9t\362\314Jz\242\234\017\361\006\234\365C\001"
+	.ascii	"#$\202D\246\241P\216\315\272Q\347;\374 T\b\244\032\265V\326K"
+	.ascii	"\333\275\032T\311\026B\226\210\r^\276\\\314(=\220\316\213>\222"
+	.ascii	"g\035\022H\301\023$2\275tK\257mm\312\036(\303\265\257}0\212o"
+	.ascii	"\210kU#|A.\344\206f\263\231/[\373\362\241\305\030\244\213\372"
+	.ascii	"F\\\216^h\330ow\334*\2328\013\247%\243]\025\254]m\355\207\310"
+	.ascii	"\006\352t\254\300Z\026$FW\355j\017<\361\243O\366\217\376\303"
+	.ascii	"G\277\205-\030\211^h$\363\245j\021\370\214\360\321'\337\370U"
+	.ascii	"\221\204\322\203\376\022@\021\035\232\230,\270\217\346\201\016"
+	.ascii	"\363\321'\246@|(U\372\304>\177tU\330'\0033\272\333\232&\266\313"
+	.ascii	"\035\240\301\301\351n5&\216\216\267{\260\262\203\226\226\232"
+	.ascii	"\313\213\213-f\340\346\306\253\241a0m\213\341t\271\231\235Mw"
+	.ascii	"\223\311\260\253U\260\321jj2]\216fAf\263\271\221\305\024xw\341"
+	.ascii	"f#\303\331\355ld\254\323\367\355\211\360#\311\267\277\377\347"
+	.ascii	"1\251M\272p\tjS\273M\202Q\314\375\242\366@\032?\"\346&\360y\217"
+	.ascii	"\257\2126\224\212~\021@\032\035\232\230\354\211\016\013@\311"
+	.ascii	"\335MY\233\202\314\302\200\273c\037\350Gf\324\246D\250!,\206"
+	.ascii	"\0243\306)&\"\"a\0266\351`\002\031\272\342\r\021\240M3QZhc\357"
+	.ascii	"\343\355\210\230\342M\365`\320|\323\207\274\215\266\027R\006"
+	.ascii	"\016>`\262\t^*\\m\324 \007\020\215\277*2+\001\372\350pi(\204"
+	.ascii	"\2764\205\31781\360\f\224\206_\365i\020X\005\263\306B\017A8~"
+	.ascii	"i\362\221R\252\017\035N\300?t\\\224kY\257P\243F\245\016\267\017"
+	.ascii	"{S\231n\326T6\022W}\t\357M\007R\220_\013H\035q'\203,NZ\003\276"
+	.ascii	"\305'\3762}\352\370\024\024\252\001"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.37.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`+\001\035\f"
+	.string	"v\226O>"
+	.string	"Q&\035\340J{\036`\375\206\036\370!`\364\311\260\344\244p\004\362\266J|\030\fjp\350?#@Q\355\r\274\035\"\002T\251\320\337\350|\023\325R\377\030\200\224\254\021\322{\023)S\n;"
+	.string	"7"
+	.string	"?"
+	.string	"\220]\326\353\304\356^\274y\034Z\036 \036n\007\020\017\375\331-\016\363\260/\361!Eb\306\356r\332\341\337\363\363\377:D\2652=7\022\354\256S\265\312p\353m\023\260\315\261\317\n\034\354o\273\273\326\226\235iJ\246'\231\226\334\365\307LCMo\232\326Lg\246\317Q\211\261\202\343b\027C\255\306\316 \n\020\266\037\2617\031\202\247\375\020\027\361\335UrQU7\023)\332\t\006e\304S)\035\371bb\340:y\334\261\030\365\252\261\013\264\212\212\230\022\265I\024\362*\377\365\334`AM~\355\245\030U\242\316\224\006T\326\234\262\024,6i\3300Sj>\220\311x4\033M\207\031\360!\205:\023\240;L\003\021\210\201\327\211>\013*x\036\007]'\344\341D\240\316\003\256\033E\3400\005\354A\370\2148\t\2367\342\"\260\275\266\254@\306\354\244(\307\204\226M\241^\004\250n\372\033"
+	.string	"}\246"
+	.ascii	"\226\"2\241\r\320qx\230=+!0A\177\206\341\030\336\202G\202  \273"
+	.ascii	"_%\005\205\201!`\037\310\030p\021B\002\032;\004\270>T\201#\252"
+	.ascii	"\013\211\3138\326j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.38.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"=\t"
+	.string	"\026\022B:0\345(\035\036\356\264\030`\266\\\305\305\017^{\204M\211\375C\003\334\203\343\330\267\f0\031\237\201\317\361b\301~v\206\206\022&\354\366\310\276\251XF\215\275\255\237\220-eJ\001."
+	.string	"0"
+	.string	"/"
+	.string	"\003\334\267x\001\356\233A\033\346\263\221\375\t\254e\"\263\273\235\212\034|\202\376e\337\204\256\325S\243\260\273\316\320\365q\353m\033\330f\260\335\022/\373\261?j:3}\r\201\207KC\314nG\r\300\3226\025\022\333\347\3301\226\360\264_r\030\370\230Q\274\331e\221\245\354\256\307\242\200o\235\007.\032K7\274\311T\373\253\310\207\356\\S=\255"
+	.string	"\254\254\231\313\250\266*#\037^\035@8t\345\\\251\275l\316\330\263Uj\210\375\270\273k\rF"
+	.string	"\201H!Q\310\373\024\224T\247\021\306f\357\023\2012A|\036\252\364\240\361\221$\274\321\211\324\241L\243\211\316KYt\237\003\177\024\245Tw\361}\251\2163\333\307\325\227\027\002\n"
+	.string	"}\246"
+	.ascii	"\226\"2\361\274/Z\\\334\004\025t\270\214\375\255F\203\273\274"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_8SVB.part.0.68.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\371\006\265&"
+	.string	"*B@\016J\220\232Q:D\020\020>f\001\024\332\336\3366\033\250\224\227o\212)6k\276\321\242\217=\001\005\215U\373l\365\307\317>f:\370(4\365\321\001\214:\304\214H\232g\262\351\237\207\2359#\334\206\023\303\307`\263\204\020B\344N2\313"
+	.string	"\326"
+	.string	"\307"
+	.string	"\2542\363Q\016\354\336\247\027:7\371B$f\365&\0271cY\023;\247{\257\002\024\311\254\2647\302\237:\025\322\203\214U\342\334\235\f\030V\367\336\035\276\220\336\314)-s\021#\"\263\266\007\0261JZ8\372\020\\\201\365\356\240=fl\277~\b\356"
+	.ascii	"\356\205zbu\357\272s\223\037\2447\231\037\344\310w \227Bb\\\201"
+	.ascii	"\265\206\2123\310Ub\252\353\336Uv\223\327\0238o\246\027p\336"
+	.ascii	"l\032\\Z\334O\263l\213\342\370\277\244\237\303#\320\215\321m"
+	.ascii	"\t\177,n\226\250R\212\0336?\245\022\202\027\362\352\306\333\336"
+	.ascii	"OgK\273\244\203\351}\343\017\350\310\002n\t\177L\267\001\216"
+	.ascii	"\242\022\356\275\234\2668\247gf\022\314l\304|\212\t\302\303\230"
+	.ascii	"\277%\013\237\353Z\212A\304\246\242\016\026+\374+\3372\301$\273"
+	.ascii	"\330W\025\344B\336\273N9\025~\025>:\376\b_\213\325,(8w\027\364"
+	.ascii	"\312\201Z\231}\312\217|)W\244Da\254\234\035\316\335\321(\223"
+	.ascii	"CDz\023u2\373\361B~\026j\2341?\013\351P*\f\261\222\352JodV\371"
+	.ascii	"v,~\223;i\"[\305\2404\311\227R\321\344f0\373\342\355J\202\356"
+	.ascii	"K\217\300($\361\227\347\203\361\200C\244\030\342-\n\306z&C?\302"
+	.ascii	"\267\372\022S7&\352\336\253\336\274Rb\313\331\255\367w\215\263"
+	.ascii	"\324\376j\350Jl\345z\177?6\025o\207\364fUy]\254W\005\003!V:7"
+	.ascii	"\325$UC\347\321T\224\352J2\304\254\"\2711\253\027\036\361\207"
+	.ascii	"\001L\350\202\237\215\366\271\360x\350l\222\3136\333b\2258CC"
+	.ascii	"EF\353v\260\211\322\257\215\217Q\215q\362\243\340y\241\322\375"
+	.ascii	"\"\321\332\3463\241\325\354\227\272#8\355:\211\317\344\261`\f"
+	.ascii	"\255\273\344)\226\0379\310\200\271\366\213m\377\352\246_\365"
+	.ascii	"\034\376\227\021\032\3706\370F\347M\333v\252\367\"g\223\374\341"
+	.ascii	"\313\035O\327\366\f\244\265_\374\340\237\263_\334h\317`>\204"
+	.ascii	"\032^Hn(\346\257\377\r[\266Q-\327\320\2501\230j9EO<\237\252e"
+	.ascii	"\263\214Y\356\322\262=\360?\201\001\007\232\356M\221,s\235\314"
+	.ascii	"+\034\237\362S\261'\376\305wY)@\t\261\222\212\272\273Ug\210q"
+	.ascii	"\247o\300\t\036p\210|\226\237\353\017@'\252a\360\251m8M\020B"
+	.ascii	"E\266\t\261[\255\310\203O\210\223\0254h\360\343\340\201\003\032"
+	.ascii	"\217\201\fE?\3154\036\rB@\030l4\241Z\217\b\333O\007\232\217\207"
+	.ascii	"\037\231\020\220O\220\214Ft\223\361$`\333\207\032\221\f\204\315"
+	.ascii	"F"
+	.string	"$S\231\331\276\241\002\230j\333\330\264m\235=\313\263c\335\343\262,\233\246{\314\245\221\333O\304\253\252\177x\230\223\031)d\220\271\340\257\206C\017\337\306\227\276\344\272\246oE\215\265\332G\302\343a\251\222Zf\317\3402>\216\r\353.\273w\343\3230>\2224\332\\\332\233>\273\227|\320Y\366\204\343\316z}\005\357\354\023\313\226\220+\357\275\267\204\365\213\350\031\353,\033\3267\303;\243\373J\233/\206\250\0077\265\364\345\336\300iv\032\200\242\250qP\204\220bJDF\244 I\322\006\200\002\231)\272n\021P\271dV\223\222d8\376\033z\016\315\246\235\374\037mJB0u\204\027\241\312\271\353l\n\335\017 \240\250=\034\362D\374d\260\311\375i\216m/\303\201\r\004P\3662\365!\325\324Z\245\315`\210\222\017\2737\242\b>\2478\230\231\304\311\017\025Nn\333b\335\372&\034s\t\2074\3014\340"
+	.ascii	"\226\317t\212;v_\234\362\223\314\320\270\350b\t\367\336\241\030"
+	.ascii	"i\001=zj\037\002\355\f\337\003\261\345\305&\277@\222/\255\216"
+	.ascii	"|X\222o\034\276\212\212\217\t\032\226A\212\271\2429\213\004\334"
+	.ascii	"\r\204\034Q4\224\2072@\211I\241Z\310\322\f\333\354\252\317\331"
+	.ascii	"\331\035\320\307)<\356\032\221\364\007\252\334t\363\021)\t\261"
+	.ascii	"\310E1<?=\032\211<\0349m)t'\037\376\371\266\277\030\350 \215"
+	.ascii	"\"\267S\321K\024\001C\r\034\307\301s\301\241]c\346\035\033?\301"
+	.ascii	"\340\321\177\202m\222\316\004<\226\233\301v\260\036\267\234N"
+	.ascii	"b\203h\363\220\351\"\342\277G\304\023\230[\256\3632\233\002r"
+	.ascii	"v\331XG!TBi\253\256\364I\024\313x>\344\245\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`2\004%\021"
+	.string	"\306\230\\C \2138\035\005\005|\264;\304\025\022\207\021bF\222 \202\034d8\314\204!\013\030\310~\237\276\007"
+	.string	"\207"
+	.string	"\020\004\330"
+	.string	"\276\276\377\217\330\302\266\210-b\210\307\322s\214\260\3074\212\377\342w\222^\202\322\2262J"
+	.string	"O"
+	.string	"F"
+	.string	"\037\307q$\365\007U\321\236QsP\242\236\360>\252\2565Y\251\203Po<Z\253\211\304DL\341zA\251\245B@\240\350\216\2540A\353\214\004yl\034\336g\243\332\335Ik\245\024v{7C\003\256PJ\251\247/rw\253R\005\272D\2401HZc@g\bh\220"
+	.ascii	"\035\302\224\322\335\016@w\360*\030\261T\"}\021\322\026 M\372"
+	.ascii	"\350\212R\217<Z\324\321\036GwS\034%ltH\243\271\214\246\220\213"
+	.ascii	"r\301\203\210\321 \371]6\321\013\221*c\360\200\203Eo\022\025"
+	.ascii	"'\035,T\230o\241\366Y!?\204y\202\312\\]\236\t//\261<\253\026"
+	.ascii	"\320\273\216}\242\353st}rx\235O\007\366\272\005z\"\353\bF\326"
+	.ascii	"\347\327\315g\246Pu>q\205V\316 \263\211\230\242\201\333\033\350"
+	.ascii	"\221\273\201^B\002\035\253\223S\333\246\371|\216\2352\217\347"
+	.ascii	"X\n\323\351\034\273p>9\237'\236\270f\222\220x&\214\370\fYFX\260"
+	.ascii	"\201\213\270\345\323>A\3260\210'\334\346\032\2509W\306(\b\224"
+	.ascii	"\251y\366e\357R\314\037\002Z\250Q$(j\027D\212\232a3\320\002\241"
+	.ascii	"\032\242\007\021\220\024\006\021T\201P \"QU\320\001\246\222\333"
+	.ascii	"\027\317!p\247\330g\002\216\240\347i\246i\024\275\2567\242\036"
+	.ascii	"\355\n\024x\241)\025\001*\373\337\304\253\310\375\234\213\200"
+	.ascii	"\3274\341\277\347\317\340\367\316:]e\324\234\364\264\035\217"
+	.ascii	"\335\260s)\325ls\231T\rHJY\241P\240t\227U\271f\221I\310\001\243"
+	.ascii	"\212\" \204\321\365\356-x\307\036|\342]\317\020\030\317 \204"
+	.ascii	"*\270\305\266\234\003\315\034\305\243\020gzLJi\306\227\017\032"
+	.ascii	"\215&\344\177\370.f\026\356\233H\027q\017\236\200U\005"
+	.text
+	.section	.gnu.lto_.refs.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\005\004"
+	.string	"\362H\031!\200)Ic\300\340\220\030\211\221\030\211\221\230\224*\206\356hQ\355\027\177\367\277YLZ\333\255\021\"S7[\346\240\251\213\255BQ\233-cPG<\024\324\020\333\016h\005\235\234k\t*\303va\240*l\023\320\312\006@#\347c\227\272A`\300\"\244]\244\027\343$h2\016\262\211m\332\t\032\235\317>^\005\t"
+	.string	"\300\313U\031"
+	.ascii	"\036\357\361x\205]\201\305~\234j\260u\243\366f\024"
+	.text
+	.section	.gnu.lto_.decls.3c5477874597c0f4,"e",@progbits
+	.string	"(\265/\375`\037#\215\220"
+	.string	"\032\337\2201P0P\322I\007oi\005\300\f\3158\3273\301T\226U\001H\234\177-\252\316 *Bj\347`^\376\n\3763q\337\034w4\033\275\"\306AI\r-\205\224\351\303\016uX\032\352\005\245\272\2506\017D\356\325\260l\365\261;\272|\244n\215l)S\214\002\003\003'\003n\224$9;\3458>s\226c3r\016<\357]\262\334\317\337\275\313\037f\004\230\021H\273\256\264\320\204\351\217\352\317e\340\330\216\2005u\312c\330\215W\001\370\355\214\205\311<\270\\\327\325'N\034\024_\247@<B\370\242z\303\275,\200\220\003\003Y"
+	.string	"1m\f\267U\004\332\351\271\355<\326\302\275\321\2365<\254N:e0B\3470\0230\301\352\352\324r\210/&~\326\037NX^\330\364\372\366\300\270\360\312l?wa\036\376\306\243\223\305\307\017&\2352\t\016!\024\022:sa1\277*_\266\254\365,\271\302\203\253\323\363\032k9[?\357U\272\367\006\240\366\251\351Iuz8\036!\344\341\020B\306\"tV\013!lN\255\327\314\256yY\372\353\2649D\032\032\261\356\f\332)\227\261\025^\317\306W\316f|\366\034\245u\215\336{\177x\356\320\310\350uz"
+	.ascii	"\217\020\246)\2502\f\371l\302\237\243d\301h[\336[\247\374\305"
+	.ascii	"c\226\331\343y\315\356]?t\234[\217\244N\031\214\303x5\301U\336"
+	.ascii	"\300\003\267\312\261\373u\357\372\323\003\310\005\350\327\351"
+	.ascii	"EPy\210\377\001\030\273\017\274\325\263\t!\007\262\t\341W\036"
+	.ascii	"!T9\204P\f\304\207\277\025\370\331\305\317Y~\316A\355:\177\203"
+	.ascii	"1\332\207\177O\371\271\347\f\205'\f\300H\202\242\304\330\325"
+	.ascii	"\0021\372\250H\264\0172$\340n\342\357\246\030dh\312\261\013\360"
+	.ascii	"w\f1~.\373\331\214\311\220\037\304\376\213%\340#\342\357\024"
+	.ascii	"?\253\3709\214($\f\003\001\374\035\203\017\305\t?\013\301\274"
+	.ascii	"~\336\032\361\367\024)\f\005\252\305\344\277\226\037\306\221"
+	.ascii	"ub\347o\020\202\177c\300N%\004t\rI~\336\201\344g\247#\214\365"
+	.ascii	"\363\325\377\273\237\205<\304\337\f\374\367\343\251\377%\212"
+	.ascii	"\324\237\345X\006\020\020<?\303\371\371\307\317Q??\375\314\374"
+	.ascii	"\331\206\237_\370\371\306\317D?\267\3603\013?\253\3603\n?\303"
+	.ascii	"\370Y\204\237=\370\231\203\2371\370\271\202\237%\370\031\202"
+	.ascii	"\237}~&\376\314\300\317(~^\340\347\023?'\360\263\211\237\t\370"
+	.ascii	"\031\200\237A\374<\374\271\177\376\177\300\377\177\377\311\374"
+	.ascii	"\377\340\177\337\177\276\377o\376\273\371\217\346\177\335\377"
+	.ascii	"\242\377U\376\317\375\227\373O\302\3773\377\317\376\303\375o"
+	.ascii	"\373\357\345?\333\377\265\377h\377\307\376\223\375\207\361\177"
+	.ascii	"\202\377b\376\223\b\f\f\f\374U\021\177\220\370\003`\026\357$"
+	.ascii	"=e\366\222\324u\332G\334\300\250\230tvR\214\354\340Sw\350\212"
+	.ascii	"\364U\221\266\"\333\332\311\"\306ii\344m%t\202\343\002\354\264"
+	.ascii	"\237L\226w\325\303\355\023\276A\375\305yS\033\016\361=d\b\323"
+	.ascii	"\245Jc\327\031\302\033TW_U\330\031\2613\225\347lj\252\251\322"
+	.ascii	"\324Y\263'\250&B\336T\252\031\257\274!\235v\020\266\273:SkB\325"
+	.ascii	"\036%)\251\376\301\227y'\246s\346\212K\234\034\336?\316&\204"
+	.ascii	"\022s\007f\327\363\245E\367fD=\017\036\035%\274\227\327'T\323"
+	.ascii	"\371\216j\016\22105T3\365\223\252\024^\271k\352\352\273SSA?q"
+	.ascii	"\224\226k\355\364~\342\301\363;\363\353\264{0\031\317\227\027"
+	.ascii	"\271\300N\273\211\3238\013\215\233\332\331\322\034\266x\271u"
+	.ascii	"z\313C}\337\251:_\255\324J\275\203\247\256\215sk\352\332\352"
+	.ascii	"\245\367\016&c\3002tT\235\266\016&\213`\312\252$\355\247O\n\022"
+	.ascii	"36\325*\021\337\313\265\227L\246&1\325k\306\245\016\357^0(Z\254"
+	.ascii	"\207\233\216*\252\225\"\276o\337\263\2459J\327\312\016\252\322"
+	.ascii	"\t9\343!K\265E\210g\300\225\001\317V\201\231z\243[wx\367N\241"
+	.ascii	"\030\366\355\b\203\326\351\273\251\372t\305\211\303\1779\353"
+	.ascii	"\205B\201\rT\227\337\371/\350\305e\0052\026\274\332K\243\205"
+	.ascii	"\f\034:\255'-\275NY\217\367x\rb\276\234\2717C\314\274\250\347"
+	.ascii	" \341OP\236\233\324\031E\263\326i\317\033\221\325\360\2323\233"
+	.ascii	"\225\331\260\233\003\335{\223\356%2DglM\232\217\276;\325\f\372"
+	.ascii	"\271\315\331\315\327\360\334\022=\201ck\330t\312xW\243\203f\211"
+	.ascii	"\020\257N\257\3079\275f\214\227\253N\317Tj\377\302\273l\336{"
+	.ascii	"\243\202\353m&\361\b9\310\034\364\367\260M\357\375o\225\334+"
+	.ascii	"U\227\247F\321\262\244\372\001\267\202\253\334RZ:?\334\3656\231"
+	.ascii	"Q+%\263\314\214\363\303z\215\004p\243X\227\271Z9\323\347\355"
+	.ascii	"\273^\276JV\316\027\230\353\263\311\\\237J\240\253\364T\336\273"
+	.ascii	":\201\230fK%3\243VNf\364\351\374p\225\256\362F\227FT\245\247"
+	.ascii	"\2239\346\351\004bF\227N\246\222\225\363\003T\335\221&&\340\030"
+	.ascii	"\021.\303T\272ONU\313&\020\034s}\336\272{\331l\3516\023\270\267"
+	.ascii	"\352\331\254[\002\341\265$\270\247$,\313'\013\340\224t\365\274"
+	.ascii	"JpL)\317{\245$\331\270N\016(W\270\233\305pJ\254\252\333c\351"
+	.ascii	"\336\001\356z\257\323\275J\276p\367^\345\275w\330\254Z\357\025"
+	.ascii	"\002\304\204:9\335;E\302\351V)\267,\335\333fwkNf\364\352)\264"
+	.ascii	"\305J\024zw\254J\206\336:\253\246\032UV\271=\336\250P\247\017"
+	.ascii	"7i\320\354\364\251\321]\276\333\tR\244MM\2477\262\253\363\222"
+	.ascii	"B\322d\375\312\331\3427%\207\033\315\372\242\314\272kS\035w\026"
+	.ascii	"D\311U\247v\211\225\262R\366\007\\\340V\337pl\013\017(6\207\333"
+	.ascii	"\037\274\324e\006\230\263\245Z/\304\346\337\264Q$\236\326\356"
+	.ascii	"\311\222\260\255\030\236\310=\261\316\333(6>)yK\330\356\207\212"
+	.ascii	"_\323\\\247\317QZ\246\333\036\226\311>\005\303\354\017+om\326"
+	.ascii	"\351\366\311\347\316\2152\251S\2550,2\235\332\2465\252\315\003"
+	.ascii	"\004\264L\021`F\220\360 L\223\304\003j\227\267\314\333\035W\232"
+	.ascii	"e\246t\330\245\245'^F\322T\233d\225\324%;\255-\265\354DN\227"
+	.ascii	" j\002u\240~Mt\350\324*\257\206G)LlH\247\366r\236N\2277\2462"
+	.ascii	"\235v \333\251JD\346\302\324\2567o\2757\375\027\004\233\n\032"
+	.ascii	"\356\345%\221\363{\377\255\331a\356`\205J\307y\331\0261{q\032"
+	.ascii	"\016O\031\035\200O\235\036N\357u\337\275$v\360\240\002\235|\177"
+	.ascii	"\316\316\032\026^\224,\365*\225\332y\357;.D\216X\325\241\315"
+	.ascii	"Q\251L\252]\211l~6\335\206\307.\224\260\f/p\313\005]\332\033"
+	.ascii	"\274w\033\356\333\361\361\325\244\207!\031\365ro4r\255&\035s"
+	.ascii	"o\322\2125\251\3562\253\202z\256\364\365\365\220\346\255\206"
+	.ascii	"-\352\031\275ALV\366\222:m\273\367\035\235\234\230\261/j\323"
+	.ascii	"\275\353\250|\240\221\302eN\311\23077X\324\017\303T\233\206\370"
+	.ascii	"\277\315\334L\307\221x\3324i\202\372\f\233@*z\35783Rt\030\036"
+	.ascii	"Q\233\f\361\r\007\307}\025\230\335\2453(L3\316T\337m\202A\361"
+	.ascii	"\301\t\034\225<5\2152fL\277\201\365\\E\221\003\343\366~\353\257"
+	.ascii	"\350\031'-S\262p\241\225Q\323\264\266\266\366j\002U\225\240\315"
+	.ascii	"\005YS\32386\266\006\203\206\210\332Fy\315|y"
+	.ascii	"\203\021\2234\245\354\264\2750\234\234=(y\200\\jpG\227.\255\226"
+	.ascii	"\326\204\347\263\227\267\345g\245\006\213h\321\322[\262\340\340"
+	.ascii	"\r\371\366\230\236k\357-lC\347\023'M\241\0165h\226\226\326jv"
+	.ascii	"\320\247\0322NX\336jh\334\364\2700\234\2360(\235\2275j\020\356"
+	.ascii	"\312\225>\003\003-\361e\312\314\354}\306f-I\032\236\363\201\346"
+	.ascii	"5Q\272\251\301\276\261\261.\023\263IL4\271\350\273\354GI\027"
+	.ascii	"\034X\247M\306e\206^l\300\230\255"
+	.string	"\252\220\n\030X\257:@\033\bsl\212\330{\345I\003\244MX\360\210*\334\343\342j/\273,h\032%Ew\244\353\355\205v\247\232\004\241\324\341\323\224)M\205\202\263 x9RK\252\204\331\341MeM\032'6W\227\362\251j\020bC\271\241\350\320Q\032\252^\250\232\345J\025\336mJ\241x\252F}ZFmh\247cN\360\310!iC\246\265\242\360\262\326x\240\240\230<;\035\272qr'\275C\275tB\240;>\360\246\234D\325\234%L\230\274e\351\3059\221\2509\200YYrTM][\255\267\344L\372\244\356\210\021\261Z\tV'Q\225\367*\201nR\\\032\324\201h\232\025$\001\311\343\215\033\310\013`82\"\031G(B\"_\f\005\223\307\027>\306\0319\222G\243\032E\017~V\020\212!\304B\020\006\032?I\243\243M\032q\200$!\211T$\nq\033G\305$\022\210\333H\201\203"
+	.string	"$$#\021QQ\270\202P\f\"\013\301d\361\306\021\222\306\020\016\032I\235\003\2162\212C0 \315\200\004T\243\230\034\032\352\231ad\034*\302"
+	.string	"t\033*\214\2207n \211L\324(\322P\343H\003O\f\310#\033I\244\321\220F\321X\224&\221\214\220DA\032\212\210\206\214\216\311\242c\016\031CC=6\220r\024e\320\001\t\034\300P\2214\3268*&\017p\201\bYt\201\361\by\301\rc\022i\006\030?\311\"\262(\003\020\r\020K"
+	.string	"\240\004\013! \026B%f(\036\035Y0\300\210\234\025)\220\222\307\0273\212\214G\032;@j\372\224\205\020\f\007\206Z\030\213d\024\217GE\023\002\200\001\300\013\023f\030\215j\034\221\214JH\032k\314\310\361B\204\321\350\330\301\221qF\321\270\001\215\244\321\361(\004\237\025)\222GE\034)^\230"
+	.string	"\243\305P\013\f\n@2&gx\321"
+	.ascii	"\021\006q\250\201\032E\022\214\"B\030i8\302\b i\224\003y\301"
+	.ascii	"\221\221\006\215\034/H\334F\n\3441\001c\362xtB\217\372\240#q"
+	.ascii	"\030\217T"
+	.string	"$\221\310#\025;D\311\0348\206\202':\036\031\215\2145\324;\300\202\001\026-d\030\276\205\213\025.V\b\337\302\205\220\220\013\026B\352Y\b\331$\322\261h\250\b\303\360\250h\203(M\016\261\020j\200\2304:\016\223C-\222F\307\034\303\257x\340\001\031, `A\224\302\304#\210\340\202\003J\370@\003\225(E\r\243\343\f$\221\221qH\006\244\f\027\210\212E2T\030\035\2137T\020\035!\251HqBK{Y\276/\\\226\262\330\037`_e\267S\233fq\370Kk\253f\261\334\246\235\031\201a\335\026s)D{\202\202'\206\257\323\236\3002{Vf\315\322\222\250\360\256\334\232Y'W\260\302\254\225+\2673nVZ\213\t,O\313S\365\031R\305F\253X\262&\250\261[\2624\036wZ:Mk\224XC\177\250\300tY\206\365\216$!x\201\235\332/\353e\301n\277\256\375\372\351(X|"
+	.ascii	"\nS\313\325v\313v\335rY*<J\\\251\0173\002A6'K2az\035\035\352"
+	.ascii	"\312\004\355\301\315\224V\223\324\233S\353\324Fi\013\305J\271"
+	.ascii	"\215\362u\265Q\f\370c\004~\204\244\201\201\"\0241E\345\251S\036"
+	.ascii	"('\026\352\304j\365\363y/t\210\026\307\004\357NI\351p\253\305"
+	.ascii	"\026lj\253\342\312\331Sy\232X&\266\211e\322mr|\222\206H\005="
+	.ascii	"gnI\267\341q\373\321\026\225e\243~\360\372\364\242J\372O\215"
+	.ascii	"#\022\345L\022&\220<&qH\354\223\320\210\017\277\263#\177\263"
+	.ascii	"\200O\246\030\351\264g\007[e\261l\225\275R\225-\266\232,\221"
+	.ascii	"\333\253[+\033e\342{\262KO\262\262\252tj\213\330\347\220\314"
+	.ascii	"\312\210[\016\334\t\2370L8_Cr\326T+\304\347\215n\256\016\213"
+	.ascii	"\372\333 \374\347\323\327&\307#\202\343\250r\331,\b\004\231Q"
+	.ascii	"fHDD\222$Ic\302\n\020\204\342\220\034\370\262\003\022`\0245\024"
+	.ascii	":\305\214\314\210\214\210(()(HI\241\320\032\342\311\310`\275"
+	.ascii	"\350\016\337q\217y]c\224\360\244\354`\001,\312\227+oN\255\273"
+	.ascii	"K\257\251\263\203/A\215Rnw|D6n$\353>\321\241\370\343\353\315"
+	.ascii	"\r\335\n\t\225AL\204\216\023@i2\203.\266\325\243\201\t\275\031"
+	.ascii	"<p\200\3558|\305\324\022\276b\234\214\313\364R\272\005\214H\263"
+	.ascii	"\367LY\224\266fi\364t\036\332dGml+\300\001'\347\316Z\356p 8\366"
+	.ascii	"BK\034\274\202*\255fE\354\323\034\005l\320\024\303\201@p4n\333"
+	.ascii	"\374b\324\035\353\031\bo\260\3579\276<\345&\027nd\314\360\006"
+	.ascii	"\375\"\207\240\275\342\003\336\210\325Q\t\327\235ZF\350\273@"
+	.ascii	"`+HTKh/\324\301\222A2Y\007M\006L\226k\"L\335\240B\277fe\305\023"
+	.ascii	"t\231\352\"\200\024\233v)\001D\037\232+\205\325\007S\312\224"
+	.ascii	"\236\03359\332y\341h\226\356\201\324C1\007\207\271\032#\327\221"
+	.ascii	",\236*\2051\305|\340%SZ\216\242lY\313==\250\321x]\3047\211\017"
+	.ascii	"\261sJ\333\220>\350sw\257\207\306x\017\335\274k\0328:Mv\"\342"
+	.ascii	"\332\331z\217\t\356>\365\313\322\254*\254\343>\232\305U\337\244"
+	.ascii	"\370\007m\221L\332\320\nC\r\360\226`\"}=\326\021Lcs\206A{\334"
+	.ascii	"\376\311\264P\265P0\247\335\334\361\021\202o\210\212s\200\316"
+	.ascii	"{\300\033e\023r\004\031\260\034\212\357|\303\254\326\260\307"
+	.ascii	")\3642\230oz\277\270\337\027\240\332"
+	.string	"\243\372B\256\036\326\216\364\036\366\220Q_\356\212\f-\265\377\205\372\330#\265\330(y\335 NNm5\216C\251\367r\362j)\256\006\317!([\3074\345\366\242\t\344\237u\r\231\001\226>:\343\210\f\034\235{Q\345T$\243\254\2544\352\034\232\252\341{hV\020\252\237v\240\033*b\371\264`\315\225.\\'q\003\365\231\320\203\034:\037\\\234\234w\316\330\206d\224\020A#\3713\030\357qtA\264\206\226\340\215(#\3065\222l{\311\335\016\355\261\021F\0378{\231&\210\275O\\\260L\245b\375\270\273Q\253Y\r\376V\324\265\301\0047\032\177\b\373\352\022\204\223\323\344\031p\215\017\230\237\340\334\364\253\253\250\341\017\371\375\365\374\2359t. \352\213\334Z\223q\037\275\366a\005\237\324Kr\330\223q\027\245\355\207\221e\203&\361\315B`5\240\225Z\3318\317\0351F\375\r\022\370\321\375\366\373F"
+	.string	"a\260SR@)\351\007\357.b\254\207j\234\212w&"
+	.ascii	"=\013\347h>'\374\\\372\227P\261*f~I\362\326\026T\260\2725\017"
+	.ascii	"\336\362\230E\224#%\205\016\246\343\360\t\b\016\236y\\\336\214"
+	.ascii	"}C\372\r\2736\336*f\315\212\367\350\201!\236\357\373\336E\263"
+	.ascii	"\240R\267(*CC\343l\3430\b\260\231 )\n\344\204\272\b)\310h\030"
+	.ascii	"\326"
+	.ascii	"\353\370\336v\031\256\346V\356F\335\245\350\2107\200\325\013"
+	.ascii	"\364\361\203\274\fI\371;\271\365[\t\256\224%n\365\360;I\335\310"
+	.ascii	"\211<\034\301+\305\b@Za5\224\353\025\375\\\256\213\255L*\221"
+	.ascii	"\210\2615\240\3151\307\251\326\260\231Tu\350\037\332[\031\260"
+	.ascii	"(a\305\260\254\342W\037,i\361\036r\327l\315\035\204\364\016\350"
+	.ascii	" k,\261FQ\020\274\031v4\257\265T\204;\206\256{\336 \361\360'"
+	.ascii	"\253\311\246\033\310\307\256Ln\236D&Q*f\327P\213&\300\265\245"
+	.ascii	"(p\314xS\004\347\246\324@\212\332\242\240p|\006\267\372\352\266"
+	.ascii	"\032\226\357\026kZ0\362+\221\255\370\021O\212yln^a\223l\351d"
+	.ascii	"\375W\022)Ji\327\253\376(\266\2737wd\301\350e\372\222\355\302"
+	.ascii	"\262\220\363~\030(\240Ly\023\252\223\374R\231p1\247bf\001\337"
+	.ascii	"\306W\325\327\fwue\341X\354\220\227\216\245q?i\214w\206\221\240"
+	.ascii	"C\201\265\256\203s\"g\240\024mn\201\360\325\304\005\237\226\375"
+	.ascii	"\2328\353a\235\366O\034\317n\243\327__Y\34173\207\3362\317J\310"
+	.ascii	"_\333\005\177\305\007\274\212\346\330\257\352@\325\205\201\227"
+	.ascii	"a\364\032\b\007\314V\037y^\251\332\220C\266\332\365\3776tKI\250"
+	.ascii	"y\025\311LO\213:|$\365\033\357\254\273\265\017\203<\302\270@"
+	.ascii	"\3668NC\361\3030\004\315\016\377\265a\367\3672\271;D\335\244"
+	.ascii	"\332\326{w\345\216<\236y\017\240]b\346g\337\001o\257x1\225\360"
+	.ascii	".\345\2178\215r\314\301\342\003/\277Ju%\301}\337t\347\271_\341"
+	.ascii	"\267\340\344{\004\233\355\200\371\354vYy\317\303\237D\273\227"
+	.ascii	"N\343\206\220oY\274\306\315e\203/\016\252\263\026_\211\004\331"
+	.ascii	"u\002\342#\371\204\261_\377\234\223w\2535\3717\225\371\246G\376"
+	.ascii	"{\346\315\376\343\210\375\370\017\361\324\367\201\374\217\345"
+	.ascii	"\251o\270\356\025\300\tv\327w\001\206x]\030\037\02097}\364\337"
+	.ascii	"\024\237\300\356<\266\305)\037\354\2134Gc\301\321\373\361\363"
+	.ascii	"{\276\350\311\342\335\221>_\277\356\373\327Nr\256\365\315p\272"
+	.ascii	"\343C\317y\346%\350\367\215\371\255\230/\327\0018.\267\025\347"
+	.ascii	"\240\332\320{)h\baE\270c~9\210f\313\307T4&h\035\336\304\346\327"
+	.ascii	"\336n\351\037E\013\206\325\221?\371\032\363\350\232\"6\244a+"
+	.text
+	.section	.gnu.lto_.symtab.3c5477874597c0f4,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"blackboxEncodeUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"blackboxEncodeSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"blackboxEncodeTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"blackboxEncodeTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"blackboxEncodeTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"blackboxEncodeTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"blackboxWriteBufferCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"blackboxWriteBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"blackboxFlushWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"blackboxPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3c5477874597c0f4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
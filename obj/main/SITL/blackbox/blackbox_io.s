@@ -0,0 +1,13956 @@
+	.file	"blackbox_io.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/blackbox/blackbox.h"
+	.file 6 "./src/main/blackbox/blackbox_io.h"
+	.file 7 "./src/main/flight/pid.h"
+	.file 8 "./src/main/target/SITL/target.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/drivers/serial.h"
+	.file 11 "./src/main/io/serial.h"
+	.file 12 "./src/main/blackbox/blackbox_io.c"
+	.file 13 "./src/main/io/flashfs.h"
+	.file 14 "./src/main/msp/msp_serial.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_io.c.12533ef6
+	.weak	blackbox_io.c.12533ef6
+blackbox_io.c.12533ef6:
+	.long	0xcae
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF1855
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1593
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1594
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1595
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1596
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1597
+	.uleb128 0x5
+	.long	.LASF1599
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1598
+	.uleb128 0x5
+	.long	.LASF1600
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1601
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1602
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1603
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1604
+	.uleb128 0x8
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1605
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1606
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x8
+	.long	0xa9
+	.uleb128 0x26
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1607
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF1608
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x8
+	.long	0xcb
+	.uleb128 0x5
+	.long	.LASF1609
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1610
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1611
+	.uleb128 0x4
+	.long	0xfb
+	.uleb128 0x27
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x19
+	.long	.LASF1647
+	.byte	0x8
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcb
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1612
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1613
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1614
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0x14
+	.long	.LASF1697
+	.long	0x30
+	.byte	0x5
+	.byte	0x18
+	.long	0x149
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1714
+	.byte	0x8
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x10
+	.long	0x1bf
+	.uleb128 0x3
+	.long	.LASF1618
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xd
+	.long	0xa9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1619
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xd
+	.long	0xa9
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1620
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xd
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xd
+	.long	0xa9
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1622
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xd
+	.long	0xa9
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1623
+	.byte	0x5
+	.byte	0x30
+	.byte	0xd
+	.long	0xa9
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1624
+	.byte	0x5
+	.byte	0x31
+	.byte	0xd
+	.long	0xa9
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1625
+	.byte	0x5
+	.byte	0x32
+	.byte	0xd
+	.long	0xa9
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1626
+	.byte	0x5
+	.byte	0x33
+	.byte	0x3
+	.long	0x149
+	.uleb128 0x8
+	.long	0x1bf
+	.uleb128 0xa
+	.long	.LASF1631
+	.byte	0x5
+	.byte	0x35
+	.byte	0x19
+	.long	0x1bf
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x1fb
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1630
+	.byte	0x6
+	.byte	0x18
+	.byte	0x3
+	.long	0x1dc
+	.uleb128 0xa
+	.long	.LASF1632
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0xa
+	.long	.LASF1633
+	.byte	0x6
+	.byte	0x30
+	.byte	0x11
+	.long	0x122
+	.uleb128 0xa
+	.long	.LASF1634
+	.byte	0x6
+	.byte	0x31
+	.byte	0xc
+	.long	0x70
+	.uleb128 0xa
+	.long	.LASF1635
+	.byte	0x6
+	.byte	0x32
+	.byte	0xc
+	.long	0x70
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x25
+	.long	0x286
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0xa
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1648
+	.byte	0x7
+	.byte	0x79
+	.byte	0x5
+	.long	0x11b
+	.uleb128 0xa
+	.long	.LASF1649
+	.byte	0x7
+	.byte	0x7a
+	.byte	0x11
+	.long	0xcb
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x3c5
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1698
+	.long	0x30
+	.byte	0xa
+	.byte	0x17
+	.long	0x3e7
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1698
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x3
+	.long	0x3c5
+	.uleb128 0x14
+	.long	.LASF1702
+	.long	0x30
+	.byte	0xa
+	.byte	0x1d
+	.long	0x43f
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1702
+	.byte	0xa
+	.byte	0x30
+	.byte	0x3
+	.long	0x3f3
+	.uleb128 0x5
+	.long	.LASF1713
+	.byte	0xa
+	.byte	0x32
+	.byte	0x10
+	.long	0x457
+	.uleb128 0x4
+	.long	0x45c
+	.uleb128 0xc
+	.long	0x467
+	.uleb128 0x2
+	.long	0xbf
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1715
+	.byte	0x48
+	.byte	0xa
+	.byte	0x34
+	.byte	0x10
+	.long	0x52b
+	.uleb128 0x3
+	.long	.LASF1716
+	.byte	0xa
+	.byte	0x36
+	.byte	0x24
+	.long	0x5c0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1717
+	.byte	0xa
+	.byte	0x38
+	.byte	0xd
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1718
+	.byte	0xa
+	.byte	0x39
+	.byte	0x10
+	.long	0x3e7
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1719
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x13
+	.long	0x43f
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1720
+	.byte	0xa
+	.byte	0x3c
+	.byte	0xe
+	.long	0xcb
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1721
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xe
+	.long	0xcb
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1722
+	.byte	0xa
+	.byte	0x3f
+	.byte	0xe
+	.long	0xcb
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1723
+	.byte	0xa
+	.byte	0x40
+	.byte	0x17
+	.long	0x5c5
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1724
+	.byte	0xa
+	.byte	0x41
+	.byte	0x17
+	.long	0x5c5
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1725
+	.byte	0xa
+	.byte	0x42
+	.byte	0xe
+	.long	0xcb
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1726
+	.byte	0xa
+	.byte	0x43
+	.byte	0xe
+	.long	0xcb
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1727
+	.byte	0xa
+	.byte	0x44
+	.byte	0xe
+	.long	0xcb
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1728
+	.byte	0xa
+	.byte	0x45
+	.byte	0xe
+	.long	0xcb
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1729
+	.byte	0xa
+	.byte	0x47
+	.byte	0x1e
+	.long	0x44b
+	.byte	0x40
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1730
+	.byte	0x50
+	.byte	0xa
+	.byte	0x5c
+	.byte	0x8
+	.long	0x5bb
+	.uleb128 0x3
+	.long	.LASF1731
+	.byte	0xa
+	.byte	0x5d
+	.byte	0xc
+	.long	0x5f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1732
+	.byte	0xa
+	.byte	0x5f
+	.byte	0x10
+	.long	0x609
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1733
+	.byte	0xa
+	.byte	0x60
+	.byte	0x10
+	.long	0x609
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1734
+	.byte	0xa
+	.byte	0x62
+	.byte	0xf
+	.long	0x61d
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1735
+	.byte	0xa
+	.byte	0x65
+	.byte	0xc
+	.long	0x632
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1736
+	.byte	0xa
+	.byte	0x67
+	.byte	0xb
+	.long	0x646
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1737
+	.byte	0xa
+	.byte	0x69
+	.byte	0xc
+	.long	0x65b
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1738
+	.byte	0xa
+	.byte	0x6b
+	.byte	0xc
+	.long	0x675
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1739
+	.byte	0xa
+	.byte	0x6d
+	.byte	0xc
+	.long	0x685
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1740
+	.byte	0xa
+	.byte	0x6e
+	.byte	0xc
+	.long	0x685
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.long	0x52b
+	.uleb128 0x4
+	.long	0x5bb
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x5
+	.long	.LASF1741
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x467
+	.uleb128 0x8
+	.long	0x5ca
+	.uleb128 0xc
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	0x5ca
+	.uleb128 0x4
+	.long	0x5db
+	.uleb128 0x15
+	.long	0xcb
+	.long	0x604
+	.uleb128 0x2
+	.long	0x604
+	.byte	0
+	.uleb128 0x4
+	.long	0x5d6
+	.uleb128 0x4
+	.long	0x5f5
+	.uleb128 0x15
+	.long	0xa9
+	.long	0x61d
+	.uleb128 0x2
+	.long	0x5eb
+	.byte	0
+	.uleb128 0x4
+	.long	0x60e
+	.uleb128 0xc
+	.long	0x632
+	.uleb128 0x2
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0xcb
+	.byte	0
+	.uleb128 0x4
+	.long	0x622
+	.uleb128 0x15
+	.long	0x11b
+	.long	0x646
+	.uleb128 0x2
+	.long	0x604
+	.byte	0
+	.uleb128 0x4
+	.long	0x637
+	.uleb128 0xc
+	.long	0x65b
+	.uleb128 0x2
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0x3e7
+	.byte	0
+	.uleb128 0x4
+	.long	0x64b
+	.uleb128 0xc
+	.long	0x675
+	.uleb128 0x2
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x660
+	.uleb128 0xc
+	.long	0x685
+	.uleb128 0x2
+	.long	0x5eb
+	.byte	0
+	.uleb128 0x4
+	.long	0x67a
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x1a
+	.long	0x6a9
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1745
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x3
+	.long	0x68a
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x20
+	.long	0x722
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x80
+	.uleb128 0xd
+	.long	.LASF1755
+	.value	0x200
+	.uleb128 0xd
+	.long	.LASF1756
+	.value	0x400
+	.uleb128 0xd
+	.long	.LASF1757
+	.value	0x800
+	.uleb128 0xd
+	.long	.LASF1758
+	.value	0x1000
+	.uleb128 0xd
+	.long	.LASF1759
+	.value	0x2000
+	.uleb128 0xd
+	.long	.LASF1760
+	.value	0x4000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1761
+	.byte	0xb
+	.byte	0x30
+	.byte	0x3
+	.long	0x6b5
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x32
+	.long	0x79b
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1778
+	.byte	0xb
+	.byte	0x43
+	.byte	0x3
+	.long	0x72e
+	.uleb128 0x1a
+	.long	0xd7
+	.long	0x7b2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x7a7
+	.uleb128 0xa
+	.long	.LASF1779
+	.byte	0xb
+	.byte	0x45
+	.byte	0x17
+	.long	0x7b2
+	.uleb128 0xb
+	.byte	0x5
+	.long	0x70
+	.byte	0xb
+	.byte	0x48
+	.long	0x818
+	.uleb128 0x29
+	.long	.LASF1780
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1792
+	.byte	0xb
+	.byte	0x55
+	.byte	0x3
+	.long	0x7c3
+	.uleb128 0x12
+	.long	.LASF1793
+	.byte	0xc
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x10
+	.long	0x880
+	.uleb128 0x3
+	.long	.LASF1794
+	.byte	0xb
+	.byte	0x6d
+	.byte	0xe
+	.long	0xbf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1717
+	.byte	0xb
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x818
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1795
+	.byte	0xb
+	.byte	0x6f
+	.byte	0xd
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1796
+	.byte	0xb
+	.byte	0x70
+	.byte	0xd
+	.long	0xa9
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1797
+	.byte	0xb
+	.byte	0x71
+	.byte	0xd
+	.long	0xa9
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1798
+	.byte	0xb
+	.byte	0x72
+	.byte	0xd
+	.long	0xa9
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1799
+	.byte	0xb
+	.byte	0x73
+	.byte	0x3
+	.long	0x824
+	.uleb128 0x8
+	.long	0x880
+	.uleb128 0x4
+	.long	0x467
+	.uleb128 0x7
+	.long	.LASF1800
+	.byte	0x1b
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x13
+	.long	0x207
+	.byte	0x1e
+	.byte	0x9
+	.uleb128 0x7
+	.long	.LASF1801
+	.byte	0x20
+	.byte	0x16
+	.long	0x5eb
+	.uleb128 0x7
+	.long	.LASF1802
+	.byte	0x21
+	.byte	0x16
+	.long	0x6a9
+	.uleb128 0x1a
+	.long	0xa9
+	.long	0x8ce
+	.uleb128 0x2a
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1803
+	.byte	0x42
+	.byte	0x10
+	.long	0x8be
+	.uleb128 0x13
+	.long	0x213
+	.byte	0x44
+	.byte	0xa
+	.uleb128 0x13
+	.long	0x21f
+	.byte	0x45
+	.byte	0x5
+	.uleb128 0x13
+	.long	0x22b
+	.byte	0x46
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1804
+	.byte	0x31
+	.byte	0xa
+	.long	0xcb
+	.long	0x8ff
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1805
+	.byte	0x30
+	.byte	0xa
+	.long	0xcb
+	.long	0x910
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1806
+	.byte	0x4c
+	.byte	0x5
+	.long	0x11b
+	.long	0x921
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1807
+	.byte	0xd
+	.byte	0x44
+	.uleb128 0x1b
+	.long	.LASF1808
+	.byte	0xe
+	.byte	0x5a
+	.uleb128 0x10
+	.long	.LASF1809
+	.byte	0xb
+	.byte	0x9d
+	.long	0x940
+	.uleb128 0x2
+	.long	0x5eb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1810
+	.byte	0x4b
+	.byte	0x5
+	.long	0x11b
+	.long	0x951
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1845
+	.byte	0xd
+	.byte	0x2b
+	.byte	0x6
+	.long	0x95f
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1811
+	.byte	0x2e
+	.byte	0xa
+	.long	0xcb
+	.long	0x970
+	.uleb128 0xe
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1812
+	.byte	0xb
+	.byte	0x95
+	.byte	0xf
+	.long	0x5eb
+	.long	0x99f
+	.uleb128 0x2
+	.long	0x818
+	.uleb128 0x2
+	.long	0x722
+	.uleb128 0x2
+	.long	0x44b
+	.uleb128 0x2
+	.long	0xcb
+	.uleb128 0x2
+	.long	0x3e7
+	.uleb128 0x2
+	.long	0x43f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1813
+	.byte	0xb
+	.byte	0x8c
+	.byte	0xf
+	.long	0x6a9
+	.long	0x9ba
+	.uleb128 0x2
+	.long	0x9ba
+	.uleb128 0x2
+	.long	0x722
+	.byte	0
+	.uleb128 0x4
+	.long	0x88c
+	.uleb128 0x9
+	.long	.LASF1814
+	.byte	0xb
+	.byte	0x89
+	.byte	0x15
+	.long	0x9d5
+	.long	0x9d5
+	.uleb128 0x2
+	.long	0x722
+	.byte	0
+	.uleb128 0x4
+	.long	0x880
+	.uleb128 0x9
+	.long	.LASF1815
+	.byte	0xd
+	.byte	0x41
+	.byte	0x5
+	.long	0x11b
+	.long	0x9f0
+	.uleb128 0x2
+	.long	0x11b
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1736
+	.byte	0xa
+	.byte	0x78
+	.byte	0x5
+	.long	0x11b
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x604
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1816
+	.byte	0xf
+	.value	0x197
+	.byte	0xf
+	.long	0xdc
+	.long	0xa1d
+	.uleb128 0x2
+	.long	0xfc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1817
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8f
+	.long	0xa3d
+	.uleb128 0x2
+	.long	0x8f
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0xdc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1818
+	.byte	0xd
+	.byte	0x3c
+	.byte	0xa
+	.long	0x122
+	.long	0xa53
+	.uleb128 0x2
+	.long	0xa53
+	.byte	0
+	.uleb128 0x4
+	.long	0xcb
+	.uleb128 0x10
+	.long	.LASF1819
+	.byte	0xa
+	.byte	0x74
+	.long	0xa73
+	.uleb128 0x2
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0xa73
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF1820
+	.byte	0xa
+	.byte	0x73
+	.byte	0xa
+	.long	0xcb
+	.long	0xa8e
+	.uleb128 0x2
+	.long	0x604
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1821
+	.byte	0xd
+	.byte	0x3a
+	.long	0xaa9
+	.uleb128 0x2
+	.long	0xa73
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x11b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1822
+	.byte	0xd
+	.byte	0x3d
+	.long	0xaba
+	.uleb128 0x2
+	.long	0xcb
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1823
+	.byte	0xe
+	.byte	0x5b
+	.long	0xacb
+	.uleb128 0x2
+	.long	0x891
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1824
+	.byte	0xb
+	.byte	0x66
+	.byte	0xf
+	.long	0x5eb
+	.long	0xae6
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x722
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1825
+	.value	0x284
+	.byte	0x1f
+	.long	0x1fb
+	.long	0xb03
+	.uleb128 0x1d
+	.long	.LASF1829
+	.value	0x284
+	.byte	0x48
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1856
+	.byte	0xc
+	.value	0x258
+	.byte	0x6
+	.long	0xb1e
+	.uleb128 0x2e
+	.long	.LASF1826
+	.byte	0xc
+	.value	0x25a
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF1831
+	.byte	0xc
+	.value	0x24c
+	.byte	0xe
+	.long	0x30
+	.uleb128 0x16
+	.long	.LASF1827
+	.value	0x237
+	.long	0x11b
+	.uleb128 0x1c
+	.long	.LASF1828
+	.value	0x216
+	.byte	0x5
+	.long	0x11b
+	.long	0xb53
+	.uleb128 0x1d
+	.long	.LASF1830
+	.value	0x216
+	.byte	0x1f
+	.long	0x11b
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1832
+	.value	0x1fa
+	.uleb128 0x16
+	.long	.LASF1833
+	.value	0x1e7
+	.long	0x11b
+	.uleb128 0x17
+	.long	.LASF1834
+	.value	0x150
+	.uleb128 0x16
+	.long	.LASF1835
+	.value	0x13f
+	.long	0x11b
+	.uleb128 0x17
+	.long	.LASF1836
+	.value	0x12f
+	.uleb128 0x1e
+	.long	.LASF1837
+	.byte	0xd0
+	.long	0x11b
+	.long	0xbb0
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1838
+	.byte	0xd8
+	.byte	0x21
+	.long	0x9d5
+	.uleb128 0x7
+	.long	.LASF1839
+	.byte	0xd9
+	.byte	0x18
+	.long	0x79b
+	.uleb128 0x7
+	.long	.LASF1840
+	.byte	0xda
+	.byte	0x1b
+	.long	0x43f
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1841
+	.byte	0xc
+	.byte	0xb2
+	.byte	0x5
+	.long	0x11b
+	.uleb128 0x20
+	.long	.LASF1842
+	.byte	0xa4
+	.uleb128 0x1e
+	.long	.LASF1843
+	.byte	0x98
+	.long	0x70
+	.long	0xbe6
+	.uleb128 0x18
+	.string	"s"
+	.byte	0xc
+	.byte	0x98
+	.byte	0x1f
+	.long	0xfc
+	.uleb128 0x7
+	.long	.LASF1844
+	.byte	0x9a
+	.byte	0xf
+	.long	0x77
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1846
+	.byte	0x89
+	.long	0xc09
+	.uleb128 0x11
+	.long	.LASF1847
+	.byte	0xc
+	.byte	0x89
+	.byte	0x26
+	.long	0xa73
+	.uleb128 0x11
+	.long	.LASF1844
+	.byte	0xc
+	.byte	0x89
+	.byte	0x30
+	.long	0x70
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1848
+	.byte	0x78
+	.uleb128 0x22
+	.long	.LASF1850
+	.byte	0x62
+	.long	0xc32
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1844
+	.byte	0x66
+	.byte	0x12
+	.long	0xcb
+	.uleb128 0x7
+	.long	.LASF1849
+	.byte	0x67
+	.byte	0x12
+	.long	0x122
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1851
+	.byte	0x48
+	.long	0xc55
+	.uleb128 0x11
+	.long	.LASF1847
+	.byte	0xc
+	.byte	0x48
+	.byte	0x30
+	.long	0xa73
+	.uleb128 0x11
+	.long	.LASF1844
+	.byte	0xc
+	.byte	0x48
+	.byte	0x3a
+	.long	0x70
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1852
+	.byte	0x3a
+	.long	0xc6b
+	.uleb128 0x7
+	.long	.LASF1853
+	.byte	0x3c
+	.byte	0x13
+	.long	0x5eb
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1857
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x13
+	.long	0x70
+	.long	0xca0
+	.uleb128 0x18
+	.string	"amt"
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x21
+	.long	0x70
+	.uleb128 0x18
+	.string	"low"
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x70
+	.uleb128 0x11
+	.long	.LASF1854
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x33
+	.long	0x70
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF1858
+	.byte	0x5
+	.byte	0x35
+	.byte	0x83
+	.long	0xcac
+	.uleb128 0x4
+	.long	0x1cb
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 33 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 43 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 60 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3d
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x4
+	.file 63 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF923
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF924
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 67 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x43
+	.file 68 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 69 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x5
+	.file 70 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1083
+	.byte	0x4
+	.file 71 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1084
+	.byte	0x4
+	.file 72 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x48
+	.file 73 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 74 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4a
+	.file 75 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.file 76 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4c
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 77 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 78 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x4e
+	.file 79 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 80 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1582
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.file 81 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x51
+	.file 82 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1592
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1028
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1035
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1052
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1109
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.30.0a00ae9199efd475f4080a54886f9f0b,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1137
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1158
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.21.42b0efe26f2c975d82840e6ab4f40d87,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1165
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1167
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1175
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1201
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1213
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1584
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1591
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF1859
+	.long	.LASF1860
+	.long	.LASF1861
+	.long	.LASF1862
+	.long	.LASF1863
+	.long	.LASF1864
+	.long	.LASF1865
+	.long	.LASF1866
+	.long	.LASF1867
+	.long	.LASF1868
+	.long	.LASF1869
+	.long	.LASF1870
+	.long	.LASF1871
+	.long	.LASF1872
+	.long	.LASF1873
+	.long	.LASF1874
+	.long	.LASF1875
+	.long	.LASF1876
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x53
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1877
+	.byte	0xe
+	.long	.LASF1878
+	.byte	0xe
+	.long	.LASF1879
+	.byte	0xe
+	.long	.LASF1880
+	.byte	0x12
+	.long	.LASF1881
+	.byte	0x1
+	.long	.LASF1882
+	.byte	0x1
+	.long	.LASF1883
+	.byte	0x6
+	.long	.LASF1884
+	.byte	0xa
+	.long	.LASF1885
+	.byte	0x5
+	.long	.LASF1886
+	.byte	0x5
+	.long	.LASF1886
+	.byte	0x8
+	.long	.LASF1887
+	.byte	0x1
+	.long	.LASF1888
+	.byte	0x8
+	.long	.LASF1889
+	.byte	0x9
+	.long	.LASF1890
+	.byte	0x11
+	.long	.LASF1891
+	.byte	0x3
+	.long	.LASF1892
+	.byte	0x11
+	.long	.LASF1893
+	.byte	0x12
+	.long	.LASF1893
+	.byte	0x11
+	.long	.LASF1894
+	.byte	0xe
+	.long	.LASF1895
+	.byte	0x11
+	.long	.LASF1896
+	.byte	0x11
+	.long	.LASF1897
+	.byte	0xe
+	.long	.LASF1898
+	.byte	0xe
+	.long	.LASF1899
+	.byte	0x10
+	.long	.LASF1900
+	.byte	0xe
+	.long	.LASF1901
+	.byte	0xf
+	.long	.LASF1902
+	.byte	0xf
+	.long	.LASF1903
+	.byte	0xe
+	.long	.LASF1904
+	.byte	0xe
+	.long	.LASF1905
+	.byte	0xe
+	.long	.LASF1906
+	.byte	0x12
+	.long	.LASF1907
+	.byte	0x11
+	.long	.LASF1908
+	.byte	0xe
+	.long	.LASF1909
+	.byte	0xe
+	.long	.LASF1910
+	.byte	0xe
+	.long	.LASF1911
+	.byte	0xe
+	.long	.LASF1877
+	.byte	0x10
+	.long	.LASF1912
+	.byte	0xd
+	.long	.LASF1913
+	.byte	0xd
+	.long	.LASF1914
+	.byte	0xd
+	.long	.LASF1915
+	.byte	0xd
+	.long	.LASF1916
+	.byte	0x11
+	.long	.LASF1916
+	.byte	0xe
+	.long	.LASF1917
+	.byte	0xe
+	.long	.LASF1918
+	.byte	0xe
+	.long	.LASF1919
+	.byte	0xe
+	.long	.LASF1920
+	.byte	0x10
+	.long	.LASF1920
+	.byte	0xe
+	.long	.LASF1921
+	.byte	0xd
+	.long	.LASF1922
+	.byte	0xd
+	.long	.LASF1923
+	.byte	0xd
+	.long	.LASF1924
+	.byte	0xd
+	.long	.LASF1925
+	.byte	0xe
+	.long	.LASF1926
+	.byte	0xe
+	.long	.LASF1927
+	.byte	0xe
+	.long	.LASF1928
+	.byte	0xe
+	.long	.LASF1929
+	.byte	0xe
+	.long	.LASF1930
+	.byte	0xe
+	.long	.LASF1931
+	.byte	0x11
+	.long	.LASF1932
+	.byte	0xe
+	.long	.LASF1933
+	.byte	0xe
+	.long	.LASF1934
+	.byte	0x12
+	.long	.LASF1935
+	.byte	0xd
+	.long	.LASF1936
+	.byte	0xd
+	.long	.LASF1937
+	.byte	0x11
+	.long	.LASF1938
+	.byte	0xc
+	.long	.LASF1939
+	.byte	0xb
+	.long	.LASF1940
+	.byte	0xb
+	.long	.LASF1941
+	.byte	0x1
+	.long	.LASF1942
+	.byte	0x3
+	.long	.LASF1943
+	.byte	0x4
+	.long	.LASF1944
+	.byte	0x2
+	.long	.LASF1945
+	.byte	0x7
+	.long	.LASF1946
+	.byte	0x7
+	.long	.LASF1947
+	.byte	0x5
+	.long	.LASF1948
+	.byte	0x5
+	.long	.LASF1949
+	.byte	0x5
+	.long	.LASF1950
+	.byte	0x3
+	.long	.LASF1951
+	.byte	0x5
+	.long	.LASF1952
+	.byte	0x9
+	.long	.LASF1953
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1573:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF1329:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF909:
+	.string	"_ANSI_STDARG_H_ "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1403:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1349:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1584:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF1849:
+	.string	"reserved"
+.LASF1093:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1220:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF966:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1374:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1117:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1304:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1010:
+	.string	"USE_UART7 "
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF1020:
+	.string	"USE_PPM"
+.LASF1737:
+	.string	"setMode"
+.LASF1648:
+	.string	"airmodeWasActivated"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF939:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1218:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1476:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"USE_FAKE_GYRO "
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1092:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1557:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1047:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1599:
+	.string	"__uint8_t"
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1716:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1614:
+	.string	"_Bool"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1275:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1011:
+	.string	"USE_UART8 "
+.LASF1422:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"FLASHFS_ERASE_POOL_SECTORS 4"
+.LASF1000:
+	.string	"USE_FLASHFS "
+.LASF1182:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF985:
+	.string	"U_ID_2 2"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1168:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1824:
+	.string	"findSharedSerialPort"
+.LASF1720:
+	.string	"baudRate"
+.LASF961:
+	.string	"TELEMETRY_SRXL "
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1658:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1564:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1150:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF1382:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1172:
+	.string	"IOCFG_AF_OD 0"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1697:
+	.string	"BlackboxDevice"
+.LASF1728:
+	.string	"txBufferTail"
+.LASF1703:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1628:
+	.string	"BLACKBOX_RESERVE_TEMPORARY_FAILURE"
+.LASF1216:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1500:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1446:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1749:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1205:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF967:
+	.string	"USE_SENSOR_NAMES "
+.LASF1856:
+	.string	"blackboxReplenishHeaderBudget"
+.LASF1569:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"__need___va_list"
+.LASF1328:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF694:
+	.string	"_STDBOOL_H "
+.LASF1408:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1541:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1516:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1487:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1655:
+	.string	"OWNER_LED"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1576:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1607:
+	.string	"uint16_t"
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF1192:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1778:
+	.string	"baudRate_e"
+.LASF1756:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1508:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1352:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF951:
+	.string	"TELEMETRY_HOTT "
+.LASF935:
+	.string	"USE_CLI_BATCH "
+.LASF1102:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1233:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1075:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1617:
+	.string	"BLACKBOX_DEVICE_SERIAL"
+.LASF1057:
+	.string	"_T_PTRDIFF_ "
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF1451:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1592:
+	.string	"BLACKBOX_SERIAL_PORT_MODE MODE_TX"
+.LASF1320:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1627:
+	.string	"BLACKBOX_RESERVE_SUCCESS"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF919:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF1235:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1853:
+	.string	"sharedBlackboxAndMspPort"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1228:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1784:
+	.string	"SERIAL_PORT_UART4"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF1532:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF1623:
+	.string	"compression"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF955:
+	.string	"CMS "
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1540:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1638:
+	.string	"PID_YAW"
+.LASF1433:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1568:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1662:
+	.string	"OWNER_SERIAL_RX"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1145:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF1175:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1095:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1194:
+	.string	"BIT(x) (1 << (x))"
+.LASF1686:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1295:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1725:
+	.string	"rxBufferHead"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1588:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF1395:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1803:
+	.string	"blackboxFrameBuffer"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF1605:
+	.string	"int32_t"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1794:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1519:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1115:
+	.string	"FAST_MATH "
+.LASF998:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1439:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1739:
+	.string	"beginWrite"
+.LASF924:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1554:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF1694:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1490:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF1207:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1615:
+	.string	"BLACKBOX_DEVICE_NONE"
+.LASF1260:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1035:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1683:
+	.string	"OWNER_BARO_EXTI"
+.LASF1817:
+	.string	"memcpy"
+.LASF921:
+	.string	"__va_list__ "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF510:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1699:
+	.string	"MODE_RX"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1021:
+	.string	"USE_PWM"
+.LASF1355:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"flashfsGetSize"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1661:
+	.string	"OWNER_SERIAL_TX"
+.LASF1029:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1186:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1269:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1649:
+	.string	"targetPidLooptime"
+.LASF1467:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1776:
+	.string	"BAUD_2000000"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1612:
+	.string	"double"
+.LASF1842:
+	.string	"blackboxDeviceFlush"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1015:
+	.string	"STACK_CHECK"
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1527:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1635:
+	.string	"blackboxWriteBufferCount"
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1603:
+	.string	"long int"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1744:
+	.string	"PORTSHARING_SHARED"
+.LASF962:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1136:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1124:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF1141:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF1282:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1443:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1543:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1684:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1361:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1696:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF1104:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF1533:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1700:
+	.string	"MODE_TX"
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF550:
+	.string	"__stub_stty "
+.LASF1106:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1810:
+	.string	"flashfsIsReady"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF1277:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1452:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1376:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1666:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1039:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF1816:
+	.string	"strlen"
+.LASF1493:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF988:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1359:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1263:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1210:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1620:
+	.string	"device"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1735:
+	.string	"serialSetBaudRate"
+.LASF1654:
+	.string	"OWNER_SERVO"
+.LASF1196:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF992:
+	.string	"ACC "
+.LASF1832:
+	.string	"blackboxDevicePrepareLog"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF958:
+	.string	"TELEMETRY_IBUS "
+.LASF937:
+	.string	"USE_PWM "
+.LASF1523:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF1017:
+	.string	"TELEMETRY_LTM"
+.LASF1848:
+	.string	"blackboxFlushWriteBuffer"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1250:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1567:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1094:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1237:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF905:
+	.string	"alloca"
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF1063:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1154:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF1600:
+	.string	"__uint16_t"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1721:
+	.string	"rxBufferSize"
+.LASF1653:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1071:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1580:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1754:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF1680:
+	.string	"OWNER_RX_SPI_CS"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1851:
+	.string	"blackboxDeviceWrite"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1189:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1727:
+	.string	"txBufferHead"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1768:
+	.string	"BAUD_230400"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1718:
+	.string	"mode"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1461:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1296:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"SKIP_IMU_CALC "
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1114:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1827:
+	.string	"isBlackboxDeviceFull"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1091:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1774:
+	.string	"BAUD_1000000"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF1160:
+	.string	"FLASHFS_WRITE_BUFFER_PAGES 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1401:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1347:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1777:
+	.string	"BAUD_2470000"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF968:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF1750:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1593:
+	.string	"unsigned char"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1167:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1096:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1064:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF991:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF976:
+	.string	"USE_NAV "
+.LASF1442:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF932:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1388:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF990:
+	.string	"USE_FAKE_LED "
+.LASF1613:
+	.string	"float"
+.LASF1717:
+	.string	"identifier"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF1069:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1331:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1738:
+	.string	"writeBuf"
+.LASF994:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1371:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1307:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1759:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1170:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1253:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF959:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1056:
+	.string	"_PTRDIFF_T "
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF1076:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1086:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1809:
+	.string	"closeSerialPort"
+.LASF1740:
+	.string	"endWrite"
+.LASF1746:
+	.string	"FUNCTION_NONE"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1535:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF954:
+	.string	"USE_SERVOS "
+.LASF1288:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1206:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1549:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1692:
+	.string	"OWNER_VTX"
+.LASF509:
+	.string	"__wur "
+.LASF1518:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1236:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1157:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF1854:
+	.string	"high"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF1322:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1822:
+	.string	"flashfsWriteCommit"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF945:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1764:
+	.string	"BAUD_19200"
+.LASF1082:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1675:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF934:
+	.string	"USE_SETTINGS_INDEX "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF866:
+	.string	"__NFDBITS"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF1190:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1775:
+	.string	"BAUD_1500000"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1108:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF916:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1424:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1385:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1820:
+	.string	"serialTxBytesFree"
+.LASF1238:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF1350:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1589:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1335:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1046:
+	.string	"USE_SPI"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1166:
+	.string	"IO_TAG_NONE 0"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF1734:
+	.string	"serialRead"
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF1559:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1488:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF1835:
+	.string	"isBlackboxErased"
+.LASF1729:
+	.string	"rxCallback"
+.LASF697:
+	.string	"false 0"
+.LASF1571:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1221:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1796:
+	.string	"gps_baudrateIndex"
+.LASF917:
+	.string	"_VA_LIST_ "
+.LASF1530:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"rxBuffer"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF1722:
+	.string	"txBufferSize"
+.LASF1802:
+	.string	"blackboxPortSharing"
+.LASF1707:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1630:
+	.string	"blackboxBufferReserveStatus_e"
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1685:
+	.string	"OWNER_USB_DETECT"
+.LASF1528:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1052:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1165:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF1550:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1445:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF986:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1828:
+	.string	"blackboxDeviceEndLog"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1191:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1051:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF698:
+	.string	"__bool_true_false_are_defined 1"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1689:
+	.string	"OWNER_INVERTER"
+.LASF1037:
+	.string	"TELEMETRY_IBUS"
+.LASF1609:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1670:
+	.string	"OWNER_SPI_MOSI"
+.LASF1542:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"uint8_t"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF1130:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1531:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1188:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1629:
+	.string	"BLACKBOX_RESERVE_PERMANENT_FAILURE"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF949:
+	.string	"TELEMETRY "
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1804:
+	.string	"flashfsGetWriteBufferSize"
+.LASF1353:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1116:
+	.string	"VERY_FAST_MATH "
+.LASF1565:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"USE_ADC"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1637:
+	.string	"PID_PITCH"
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1033:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1844:
+	.string	"length"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1394:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF912:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1326:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1419:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF1782:
+	.string	"SERIAL_PORT_USART2"
+.LASF1036:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1454:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1019:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1751:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF1208:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1098:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1785:
+	.string	"SERIAL_PORT_UART5"
+.LASF1761:
+	.string	"serialPortFunction_e"
+.LASF1066:
+	.string	"__need_ptrdiff_t"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF927:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1085:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1555:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1053:
+	.string	"_STDDEF_H "
+.LASF1498:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF997:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1505:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1239:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1513:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1138:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1325:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF1362:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1101:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1204:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1643:
+	.string	"PID_LEVEL"
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1460:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1577:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1437:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"LED_STRIP"
+.LASF1472:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF930:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1633:
+	.string	"blackboxWriteBuffer"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1176:
+	.string	"NOOP do {} while (0)"
+.LASF911:
+	.string	"__GNUC_VA_LIST "
+.LASF1337:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1763:
+	.string	"BAUD_9600"
+.LASF1028:
+	.string	"USE_SERIALRX_SUMH"
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF1821:
+	.string	"flashfsWrite"
+.LASF1111:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF1389:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1806:
+	.string	"flashfsIsEOF"
+.LASF1302:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1248:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF950:
+	.string	"TELEMETRY_FRSKY "
+.LASF1212:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1520:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1757:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1470:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1128:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1511:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1397:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1343:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1026:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1805:
+	.string	"flashfsGetWriteBufferFreeSpace"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1174:
+	.string	"IOCFG_IPU 0"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1142:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF739:
+	.string	"NULL"
+.LASF1083:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF1852:
+	.string	"blackboxOpen"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF1667:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1268:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF463:
+	.string	"__PMT"
+.LASF1797:
+	.string	"blackbox_baudrateIndex"
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF980:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1798:
+	.string	"telemetry_baudrateIndex"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1177:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1702:
+	.string	"portOptions_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1838:
+	.string	"portConfig"
+.LASF1546:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF979:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1556:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF929:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1769:
+	.string	"BAUD_250000"
+.LASF1747:
+	.string	"FUNCTION_MSP"
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1386:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF946:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1770:
+	.string	"BAUD_400000"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1515:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1319:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1089:
+	.string	"UNIT_TESTED "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF1440:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1139:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1219:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1078:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1855:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF473:
+	.string	"__P(args) args"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1099:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF926:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1280:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1365:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1448:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF915:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1529:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1001:
+	.string	"USE_FAKE_FLASH "
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF942:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1346:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1502:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF741:
+	.string	"__need_NULL"
+.LASF1067:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF936:
+	.string	"USE_PPM "
+.LASF1271:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1231:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1701:
+	.string	"MODE_RXTX"
+.LASF1040:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1743:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1003:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1373:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1032:
+	.string	"TELEMETRY_HOTT"
+.LASF1611:
+	.string	"long long unsigned int"
+.LASF1123:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1839:
+	.string	"baudRateIndex"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF1178:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1673:
+	.string	"OWNER_SDCARD"
+.LASF1161:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_WRITE_BUFFER_PAGES * FLASHFS_PAGE_SIZE)"
+.LASF922:
+	.string	"_STRING_H 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1560:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1283:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1594:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1597:
+	.string	"signed char"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF952:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF953:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1621:
+	.string	"on_motor_test"
+.LASF1013:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF1503:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1558:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1704:
+	.string	"SERIAL_INVERTED"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1113:
+	.string	"sq(x) ((x)*(x))"
+.LASF1431:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1823:
+	.string	"mspSerialReleasePortIfAllocated"
+.LASF1536:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1044:
+	.string	"VTX_TRAMP"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1156:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1484:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1016:
+	.string	"USE_DASHBOARD"
+.LASF956:
+	.string	"TELEMETRY_LTM "
+.LASF977:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1254:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1314:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1481:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF1222:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF974:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1790:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1791:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1048:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1840:
+	.string	"portOptions"
+.LASF1647:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1409:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1097:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1072:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1049:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1299:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1719:
+	.string	"options"
+.LASF1144:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1753:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1109:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF947:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1055:
+	.string	"_ANSI_STDDEF_H "
+.LASF1812:
+	.string	"openSerialPort"
+.LASF1687:
+	.string	"OWNER_OSD"
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF1112:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1475:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1164:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1632:
+	.string	"blackboxHeaderBudget"
+.LASF1226:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF940:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1391:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF819:
+	.string	"__key_t_defined "
+.LASF1241:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF971:
+	.string	"VTX_SMARTAUDIO "
+.LASF1199:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1137:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1641:
+	.string	"PID_POSR"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1642:
+	.string	"PID_NAVR"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1427:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1232:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1789:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1430:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF975:
+	.string	"GPS "
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1781:
+	.string	"SERIAL_PORT_USART1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1783:
+	.string	"SERIAL_PORT_USART3"
+.LASF1041:
+	.string	"VTX_COMMON"
+.LASF1786:
+	.string	"SERIAL_PORT_USART6"
+.LASF1787:
+	.string	"SERIAL_PORT_USART7"
+.LASF1788:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1732:
+	.string	"serialTotalRxWaiting"
+.LASF1213:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF1506:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1858:
+	.string	"blackboxConfig"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF392:
+	.string	"__REVISION__ \"665e7e0\""
+.LASF1332:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1224:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1125:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF1663:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1547:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF1585:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF957:
+	.string	"TELEMETRY_CRSF "
+.LASF1060:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1765:
+	.string	"BAUD_38400"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1274:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1287:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1059:
+	.string	"__PTRDIFF_T "
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF1149:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF1143:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1412:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1298:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1187:
+	.string	"EXPAND_I(x) x"
+.LASF1406:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF918:
+	.string	"_VA_LIST "
+.LASF1034:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1608:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1726:
+	.string	"rxBufferTail"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1421:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1278:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1159:
+	.string	"FLASHFS_PAGE_SIZE 256"
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1819:
+	.string	"serialWriteBuf"
+.LASF1281:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1132:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1736:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1121:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF1491:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF486:
+	.string	"__flexarr []"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF948:
+	.string	"LED_STRIP "
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF1031:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1843:
+	.string	"blackboxPrint"
+.LASF1090:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1290:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF1664:
+	.string	"OWNER_TIMER"
+.LASF1301:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1479:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1455:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1341:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1514:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF973:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1604:
+	.string	"char"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1050:
+	.string	"DEFIO_NO_PORTS "
+.LASF1436:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1779:
+	.string	"baudRates"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1171:
+	.string	"IOCFG_AF_PP 0"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1266:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF913:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1657:
+	.string	"OWNER_ADC_BATT"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1517:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1780:
+	.string	"SERIAL_PORT_NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF965:
+	.string	"USE_RX_MSP "
+.LASF1415:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF696:
+	.string	"true 1"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1323:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1572:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF1084:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1808:
+	.string	"mspSerialAllocatePorts"
+.LASF1772:
+	.string	"BAUD_500000"
+.LASF1708:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF928:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1022:
+	.string	"SERIAL_RX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1636:
+	.string	"PID_ROLL"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF1676:
+	.string	"OWNER_FLASH_CS"
+.LASF699:
+	.string	"__need_size_t "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1074:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1185:
+	.string	"STR_HELPER(x) #x"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1367:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1587:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1634:
+	.string	"blackboxWriteBufferSize"
+.LASF941:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1668:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF964:
+	.string	"USE_RCSPLIT "
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1660:
+	.string	"OWNER_ADC_RSSI"
+.LASF1087:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1478:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1025:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1377:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"USE_FAKE_BARO "
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1416:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1058:
+	.string	"_T_PTRDIFF "
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF814:
+	.string	"__off_t_defined "
+.LASF914:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF993:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF1522:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1458:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1344:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF1801:
+	.string	"blackboxPort"
+.LASF1147:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1110:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1368:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1742:
+	.string	"PORTSHARING_UNUSED"
+.LASF1793:
+	.string	"serialPortConfig_s"
+.LASF1799:
+	.string	"serialPortConfig_t"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1553:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1499:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1672:
+	.string	"OWNER_I2C_SDA"
+.LASF1561:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1575:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1706:
+	.string	"SERIAL_STOPBITS_2"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF1671:
+	.string	"OWNER_I2C_SCL"
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1140:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1364:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1310:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1103:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1826:
+	.string	"freeSpace"
+.LASF931:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1292:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1469:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1836:
+	.string	"blackboxEraseAll"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF1289:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1135:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1669:
+	.string	"OWNER_SPI_MISO"
+.LASF1256:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1631:
+	.string	"blackboxConfig_System"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1693:
+	.string	"OWNER_COMPASS_CS"
+.LASF1583:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1198:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1380:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1837:
+	.string	"blackboxDeviceOpen"
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF1544:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1081:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1077:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1625:
+	.string	"mode_profile"
+.LASF1521:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1601:
+	.string	"__int32_t"
+.LASF1709:
+	.string	"SERIAL_UNIDIR"
+.LASF1602:
+	.string	"__uint32_t"
+.LASF1008:
+	.string	"USE_UART5 "
+.LASF420:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF1847:
+	.string	"data"
+.LASF1482:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1586:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF1158:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF933:
+	.string	"USE_CLI "
+.LASF978:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1773:
+	.string	"BAUD_921600"
+.LASF1525:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1286:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1223:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1562:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1846:
+	.string	"blackboxWriteBuf"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1792:
+	.string	"serialPortIdentifier_e"
+.LASF1002:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1173:
+	.string	"IOCFG_IPD 0"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1407:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1795:
+	.string	"msp_baudrateIndex"
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1724:
+	.string	"txBuffer"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF1193:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1590:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF1473:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF963:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1054:
+	.string	"_STDDEF_H_ "
+.LASF1211:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1229:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1578:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1760:
+	.string	"FUNCTION_RCSPLIT"
+.LASF1579:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1563:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1815:
+	.string	"flashfsFlushAsync"
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1829:
+	.string	"bytes"
+.LASF1311:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1088:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1688:
+	.string	"OWNER_RX_BIND"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF970:
+	.string	"VTX_CONTROL "
+.LASF1813:
+	.string	"determinePortSharing"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF1691:
+	.string	"OWNER_TRANSPONDER"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1767:
+	.string	"BAUD_115200"
+.LASF1313:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1259:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1153:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF1127:
+	.string	"Q12 (1 << 12)"
+.LASF1379:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF1061:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1151:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF1834:
+	.string	"blackboxDeviceClose"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF1730:
+	.string	"serialPortVTable"
+.LASF1831:
+	.string	"blackboxGetLogNumber"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1705:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1748:
+	.string	"FUNCTION_GPS"
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF1267:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1698:
+	.string	"portMode_t"
+.LASF1234:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1195:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF984:
+	.string	"U_ID_1 1"
+.LASF983:
+	.string	"U_ID_0 0"
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1131:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1755:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF1463:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1678:
+	.string	"OWNER_MPU_CS"
+.LASF1681:
+	.string	"OWNER_SPI_CS"
+.LASF1202:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1526:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1745:
+	.string	"portSharing_e"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1045:
+	.string	"USE_I2C"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1833:
+	.string	"blackboxDeviceBeginLog"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF996:
+	.string	"MAG "
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF1818:
+	.string	"flashfsWriteReserve"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF1464:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1713:
+	.string	"serialReceiveCallbackPtr"
+.LASF1545:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF1850:
+	.string	"blackboxResetWriteBuffer"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF1133:
+	.string	"PIDSUM_LIMIT 500"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1070:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1122:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1201:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF943:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1410:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1356:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1711:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1242:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1183:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1650:
+	.string	"OWNER_FREE"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF925:
+	.string	"_STRINGS_H 1"
+.LASF1370:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1645:
+	.string	"PID_VEL"
+.LASF920:
+	.string	"_VA_LIST_T_H "
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1616:
+	.string	"BLACKBOX_DEVICE_FLASH"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1043:
+	.string	"VTX_SMARTAUDIO"
+.LASF1715:
+	.string	"serialPort_s"
+.LASF1741:
+	.string	"serialPort_t"
+.LASF1651:
+	.string	"OWNER_PWMINPUT"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1334:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1762:
+	.string	"BAUD_AUTO"
+.LASF1284:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"serialTotalTxFree"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1712:
+	.string	"SERIAL_BIDIR_PP"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1316:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1262:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF695:
+	.string	"bool _Bool"
+.LASF1062:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1068:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1539:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1814:
+	.string	"findSerialPortConfig"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1024:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF960:
+	.string	"TELEMETRY_MAVLINK "
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF1610:
+	.string	"long long int"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF1169:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1618:
+	.string	"rate_num"
+.LASF1338:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF1674:
+	.string	"OWNER_SDCARD_CS"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1126:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1227:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1225:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1023:
+	.string	"USE_SERIALRX_CRSF"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1004:
+	.string	"USE_UART1 "
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1215:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1548:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1434:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1152:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1272:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1079:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1825:
+	.string	"blackboxDeviceReserveBufferSpace"
+.LASF1073:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF1162:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1695:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1591:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF1134:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1758:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1012:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF944:
+	.string	"USE_SERIALRX_SUMH "
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF1245:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1596:
+	.string	"long unsigned int"
+.LASF1203:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1690:
+	.string	"OWNER_LED_STRIP"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1005:
+	.string	"USE_UART2 "
+.LASF969:
+	.string	"VTX_COMMON "
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1845:
+	.string	"flashfsEraseAsync"
+.LASF972:
+	.string	"VTX_TRAMP "
+.LASF1640:
+	.string	"PID_POS"
+.LASF1644:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1646:
+	.string	"PID_ITEM_COUNT"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1807:
+	.string	"flashfsJournalTail"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1042:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF923:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1570:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1129:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1731:
+	.string	"serialWrite"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1006:
+	.string	"USE_UART3 "
+.LASF938:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1450:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1265:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF989:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1100:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1155:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1639:
+	.string	"PID_ALT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1771:
+	.string	"BAUD_460800"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1677:
+	.string	"OWNER_BARO_CS"
+.LASF1383:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF1197:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1118:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1766:
+	.string	"BAUD_57600"
+.LASF1595:
+	.string	"unsigned int"
+.LASF1007:
+	.string	"USE_UART4 "
+.LASF1279:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1581:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1714:
+	.string	"blackboxConfig_s"
+.LASF1626:
+	.string	"blackboxConfig_t"
+.LASF1574:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1512:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1217:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1800:
+	.string	"blackboxMaxHeaderBytesPerIteration"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1830:
+	.string	"retainLog"
+.LASF1619:
+	.string	"rate_denom"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1449:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"OWNER_ADC"
+.LASF1598:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1682:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1841:
+	.string	"blackboxDeviceFlushForce"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1534:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1582:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1551:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1624:
+	.string	"profile"
+.LASF1497:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1622:
+	.string	"record_acc"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1038:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1659:
+	.string	"OWNER_ADC_EXT"
+.LASF1552:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1652:
+	.string	"OWNER_PPMINPUT"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF908:
+	.string	"_STDARG_H "
+.LASF1679:
+	.string	"OWNER_OSD_CS"
+.LASF1857:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1538:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1105:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1418:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1308:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1214:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1009:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1926:
+	.string	"thread-shared-types.h"
+.LASF1873:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1875:
+	.string	"/usr/include"
+.LASF1917:
+	.string	"endianness.h"
+.LASF1920:
+	.string	"select.h"
+.LASF1911:
+	.string	"floatn-common.h"
+.LASF1893:
+	.string	"stdint.h"
+.LASF1860:
+	.string	"src/main/build"
+.LASF1872:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1906:
+	.string	"stdbool.h"
+.LASF1942:
+	.string	"time.h"
+.LASF1932:
+	.string	"stdlib-bsearch.h"
+.LASF1868:
+	.string	"src/main/target/SITL"
+.LASF1925:
+	.string	"pthreadtypes.h"
+.LASF1871:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1894:
+	.string	"libc-header-start.h"
+.LASF1915:
+	.string	"timer_t.h"
+.LASF1938:
+	.string	"platform.h"
+.LASF1876:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1881:
+	.string	"blackbox.h"
+.LASF1885:
+	.string	"resource.h"
+.LASF1945:
+	.string	"asyncfatfs.h"
+.LASF1864:
+	.string	"src/main/flight"
+.LASF1913:
+	.string	"clockid_t.h"
+.LASF1865:
+	.string	"src/main/io/asyncfatfs"
+.LASF1892:
+	.string	"stdc-predef.h"
+.LASF1916:
+	.string	"endian.h"
+.LASF1867:
+	.string	"src/main/msp"
+.LASF1895:
+	.string	"features.h"
+.LASF1950:
+	.string	"utils.h"
+.LASF1866:
+	.string	"src/main/io"
+.LASF1904:
+	.string	"time64.h"
+.LASF1897:
+	.string	"wordsize.h"
+.LASF1862:
+	.string	"src/main/config"
+.LASF1953:
+	.string	"streambuf.h"
+.LASF1896:
+	.string	"features-time64.h"
+.LASF1937:
+	.string	"strings.h"
+.LASF1930:
+	.string	"struct_rwlock.h"
+.LASF1918:
+	.string	"byteswap.h"
+.LASF1901:
+	.string	"stubs.h"
+.LASF1908:
+	.string	"waitflags.h"
+.LASF1884:
+	.string	"target.h"
+.LASF1949:
+	.string	"io_def.h"
+.LASF1939:
+	.string	"common_fc_pre.h"
+.LASF1891:
+	.string	"maths.h"
+.LASF1909:
+	.string	"waitstatus.h"
+.LASF1889:
+	.string	"msp_serial.h"
+.LASF1905:
+	.string	"wchar.h"
+.LASF1898:
+	.string	"timesize.h"
+.LASF1861:
+	.string	"src/main/common"
+.LASF1874:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1914:
+	.string	"time_t.h"
+.LASF1880:
+	.string	"stddef.h"
+.LASF1888:
+	.string	"flashfs.h"
+.LASF1910:
+	.string	"floatn.h"
+.LASF1902:
+	.string	"stubs-64.h"
+.LASF1943:
+	.string	"parameter_group.h"
+.LASF1883:
+	.string	"pid.h"
+.LASF1887:
+	.string	"blackbox_io.c"
+.LASF1951:
+	.string	"io_def_generated.h"
+.LASF1882:
+	.string	"blackbox_io.h"
+.LASF1919:
+	.string	"uintn-identity.h"
+.LASF1946:
+	.string	"fat_standard.h"
+.LASF1947:
+	.string	"io.h"
+.LASF1879:
+	.string	"stdint-uintn.h"
+.LASF1912:
+	.string	"clock_t.h"
+.LASF1900:
+	.string	"long-double.h"
+.LASF1899:
+	.string	"cdefs.h"
+.LASF1934:
+	.string	"stdarg.h"
+.LASF1903:
+	.string	"typesizes.h"
+.LASF1859:
+	.string	"src/main/blackbox"
+.LASF1952:
+	.string	"msp.h"
+.LASF1940:
+	.string	"common_fc_post.h"
+.LASF1935:
+	.string	"locale_t.h"
+.LASF1869:
+	.string	"src/main/target"
+.LASF1928:
+	.string	"atomic_wide_counter.h"
+.LASF1863:
+	.string	"src/main/drivers"
+.LASF1921:
+	.string	"sigset_t.h"
+.LASF1886:
+	.string	"serial.h"
+.LASF1933:
+	.string	"stdlib-float.h"
+.LASF1907:
+	.string	"stdlib.h"
+.LASF1924:
+	.string	"struct_timespec.h"
+.LASF1944:
+	.string	"build_config.h"
+.LASF1923:
+	.string	"struct_timeval.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_io.c"
+.LASF1878:
+	.string	"stdint-intn.h"
+.LASF1931:
+	.string	"alloca.h"
+.LASF1936:
+	.string	"__locale_t.h"
+.LASF1877:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1929:
+	.string	"struct_mutex.h"
+.LASF1870:
+	.string	"src/main"
+.LASF1890:
+	.string	"string.h"
+.LASF1941:
+	.string	"blackbox_fielddefs.h"
+.LASF1927:
+	.string	"pthreadtypes-arch.h"
+.LASF1948:
+	.string	"io_types.h"
+.LASF1922:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"e\n"
+	.string	"t\017\300\001"
+	.string	"\""
+	.string	"\247\262\257\235\002\020\002"
+	.string	"\002\001\002\003\002\003\002\004\002\004\002\213\326\277\344\004\003\264\237\217\317\016\004\240\342\234\212\n\005\237\316\262\355\004"
+	.string	"\006\307\200\252\330\017\b\005\007\352\263\360\321\b\b\306\337\277\243\006"
+	.string	"\t\375\206\225\206\002\002\n\376\201\211\336\n\006\002\006\002\006\013\240\342\234\212\n\f\315\307\273\331\003\006\002\002\007\r\311\231\247\372\017"
+	.string	"\016\203\237\212\226\002\006\017\020\222\321\360\225\r\016\021\276\255\271\f"
+	.string	"\022\262\374\202\245\005"
+	.string	"\023\200\210\243\267\001\002\024\374\222\336\242\004\030\006\002\b\002\002\002\t\002\n\002\b"
+	.string	"\002"
+	.string	"\002"
+	.string	"\002"
+	.string	"\026\030\371\377\210\210\004\001\031\311\311\224\247\005\032\336\211\260\200\016\004\033\307\276\344\257\003"
+	.string	"\034\274\205\242\255\006"
+	.string	"\035\321\365\203\202\017\036\252\226\223o\037\222\252\354\340\007"
+	.string	" \367\301\221\331\006\f"
+	.string	"!\"\272\306\270\313\016\002#$\240\342\234\212\n"
+	.ascii	"$ P\002Bfw\244\bc\330\375=l\204\211\017\253\237R\305i\253\215"
+	.ascii	"Y{\306\027\303F\331ytn\260\033\200F\232\365\351\265\330\317\n"
+	.ascii	"j1\314\0046\203l\t$\002\354\231M\273H.\314X\254\313e\251\220"
+	.ascii	"\361\013\034\367>\240\371\350\001<\207\36550\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\335\004"
+	.string	"\002G\023\031pM\322\001\374\377\377\377\377u\373A\020\304Y\267*Z\206\206\037\255\334)\005\222\372\233\250dF \373\261\216\331`,\232\325\251X2\2018\227.\225i\037\312\231\335\240\205]\226@\316\332?Eg+(@\345\275:\220\221\002\2726N\t\" P\202Q\020\336I\3609\024\301\b\341\016n\202\021\002\\\320\356\310\342\305E\020\330\036\001a\332&\253\023Y\260"
+	.ascii	"j8 LD\337(\332L4\310,\267\003\312\030L'X-\\\334(e\b.@\206\321"
+	.ascii	"\022$\234p\n\254(C"
+	.text
+	.section	.gnu.lto_.inline.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\360\003E\017"
+	.string	"\206QD>\020\005+\035"
+	.string	"\020z\206\353\037B\371,\207\271\306\272\005]\265\004\376\203\254-\355b\033,\315\346\210aWU\305\303\334\001"
+	.string	"\224\002"
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\320\305\265\3248f\361\376\306\r\211dK\231\002,"
+	.string	"3"
+	.string	"8"
+	.ascii	"\007}\r\335\255\372=\274\273_r\276t7\347\001\373\375\377\231"
+	.ascii	"|V\340\356n\360O\261\214\316\3051\342\177I\276\265f\035\342\367"
+	.ascii	"\361_L\240\375\256v\270\f\bT\n\215\305U\372\247m\335\335a\233"
+	.ascii	"\2545\363\274\223\300\314\017;\333\224k\251\002p\023Q\023\027"
+	.ascii	"\346\216\006\3435\036\334\277\226\257\345\374\003\266\n\224\217"
+	.ascii	"\312\300\260\021\033\032\302G\253\031\252\311\305V\304\017\\"
+	.ascii	"\340\242\273\303\213\266\226$\367Hx1S/\367\242 ]<\253\260&d!"
+	.ascii	"\020\r\236\370\320\247\223p\361\360<w\260\b\201\005\b\217\"["
+	.ascii	"N\270\356\207\361\247\003\003\260\224\265f\364\005\246y\202\246"
+	.ascii	"\3340\033<\372\322I-WBO\352\324\274\211\230\314p>\326\022\374"
+	.ascii	"/\242g\005h\250\301\271\242\240\3044\365i\f\220\"\0212\353\001"
+	.ascii	"\022\340\262\351\nIB4\211J(\206\002%)\307:P\320\364\260\366X"
+	.ascii	":rGg\335{\242\203{\025P\270g}p\365(m\321/\350:\245\203\360@\347"
+	.ascii	"\365\322\006\f\007\246\223Xc\2675jF\246\362\301\0303\324\361"
+	.ascii	"\204\306{'\276<\335\344\266\216\214\224\264tL\240\274\253=\343"
+	.ascii	"Z\334uq;\261\214\354\350$[%.\371\006\r\224$k\302u_G\320K(\032"
+	.ascii	"!\302\336\253\216C@_;\204\360\327d+\005\325JW\\\b\202\262\212"
+	.ascii	")\237\020\322\030GU\2035\244\024\272\225\356\363\3459\203\030"
+	.ascii	"\340\341\301R=S\346\2740\024\250\275a\324Z\002\204\272{\\\253"
+	.ascii	"C\022Pt\361m\263;\\5\f-\304\324\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`P\002\355\t"
+	.string	"B\317*,`k\222\0160\fC\001\227!\001\003"
+	.string	""
+	.string	""
+	.string	"\270{g\230X\001`\017\202\b\242\257\233(\313\262\\\367\204\375\337m\376\374\330\1777)S\177l\003\303/\374\no\351\223\t\217\360\007\277\301_\220\301V\t\331m\031a}BQ\211\213I\376-\317\207\201_\240\225\266d\345\252x\244\224\022\337\260\206_)\030\344\005\313'JiS\220\221\220\225"
+	.ascii	"\317\363b\375\224\270\206\265\234\376\323kH\311\220\200#\245"
+	.ascii	"SB\310>>\362\252\376\356\256\256=\035\330'Q\024E<~e\221\236S"
+	.ascii	">d\035G\214\221\030+\267hefe\370\375\tn \002: 0\002B\220D\326"
+	.ascii	"\003F\304EC\346\262\004\341]:\337\227\013\210\021p\236\314\214"
+	.ascii	"0\220\324Z\242\3350\342\004v\211b5\017@;\307\20276\303\334\274"
+	.ascii	"\\\204\023\332\225AP \302\021sV\211\231\233\352\202\241\210\255"
+	.ascii	"?\002\026\250U\215.\371\203\240JH87\323\005\312\366\315\016\200"
+	.ascii	"\370\024\n\327\243\301\332\220\273\235\3544\b\003GZ'V2m\f\204"
+	.ascii	"\320\245\307%\310\261\222\264\035@\215,V\337\201\254g\263\210"
+	.ascii	"`M\002\200\275C_J\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 M\005\002"
+	.string	"\322\004\017\030\220U\215\001\353\371\335\335-\233\031\023/\313\262e\220$\210#A\334'\003\016\360JF\371\344\222,\222A\376\270\343\313\3268\343\213+\2368\342\207\315\360\302\t\037\\\360\300o\335] "
+	.text
+	.section	.gnu.lto_.ipa_modref.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"5\006"
+	.ascii	"R\b\032$\220)\351\377\377\363\273\273\315\235\252\277\324A\305"
+	.ascii	"\016\032A\206U\245F#\255\265\377\370Ed\305\377Mj\2232\005K\221"
+	.ascii	"\312\261\246&\nRM\3677X9\223~\306_.\"6\250uF+\376\304\bR$\207"
+	.ascii	"\207\241\005\266r\250\313\177\025\022\370\224?\355\200\202\017"
+	.ascii	"\374\225_\013x\375d\312\231N\247\334i\237My3{N\002+ \240\202"
+	.ascii	"\031\263\335\n\340\\2\241s\004O \250\233\350e*6\360\267\207\026"
+	.ascii	"\354`\261\325\223\b\001<<\364\204\024\035\310\211\021\256\223"
+	.ascii	"b\004\002,r,\\\013\212H\200U\0046''\353\021 t\3432\0318~>V\320"
+	.ascii	")`/,\210\035\316\021\266Zj\267,{\302\2066\0248"
+	.text
+	.section	.gnu.lto_.lto.bb25f15179b65d7f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.39.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\265\013"
+	.string	"v\325P@"
+	.string	"Q5\035\030\3100\203_|_\306\027\3345\377\311"
+	.string	"\271\326\337\315\243@\033\330\332\331\377\377F\004Y\202\220A,\215/b\033\340\235\302\210_\322\371\030\274^\00277\210\310\tT\375\332\332\336;\245="
+	.string	";"
+	.string	"="
+	.string	"\240M\203b\372hmXacw5j\342\340+\235\240\377\324=\3041|\rqZ\005\310\210\201\002\300X\252\026\021$X<\365\331a$\315\331\241\331]Oq\004qc\267\255\300\366f\177\022~\335\3355=\331'\357\232a4LT\273\037r\274v\205\2658q\362\267\377\224#\024\025\203\2478\n<)\322\2208,x\361\252\261[\0168f\f\344\230\313K\262c\220\007\310\2169v\205o^t\245DCs8\346\310\362"
+	.string	"\203\212\262J7*f\224f\313\022W\245'_\031M\227\261\371[\310\276\267\213\314\306\220a^\254\364\250\021&\032Zr\203\265\323e\227\341\244%\0346"
+	.string	"\201\313d\n\020\300\\&!\257s"
+	.string	"\372\032t>\007\020t8o\213\360Q\314\271t\236\007\027\272\215\004\3166a\243}<\033\005\215\343}\332\305\342\016\304yZ\250\353<-R\356\353\322S\202q5\242\244\n\231\225\006\022"
+	.ascii	"K\035\017gV`\2517\023\272\203\002\013x\213\307{+\325\002(Ta\353"
+	.ascii	"\301\264\017P\t8\227)_\335\376S\366\215\3131U\223S4\265\007"
+	.text
+	.section	.gnu.lto_blackboxWriteBuffer.41.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 J%\002"
+	.string	"\264\003\016"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\212\001\202\200\200\374\342\203\306\201\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\002"
+	.string	"g)e"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.44.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`z\002u\024"
+	.string	"V\247\212I\300RN:.T\230\345\302\003\366\"]\337\177\304\004{\231\242\346C\331\342F\031\242\254\330\\0\323\003\243[Vubm\f\366\033J\265\365\2516\360\300 \210 \241_\310\240]\244\213\303\203\232\276j\025E\215X\262\267\2242\005w"
+	.string	"l"
+	.string	"v"
+	.string	"\252b\247M\033\224\326}\264c\252\033\250r\026Q\347\201Z\013u\212J\022\352\374\356\357\241\300\244\206\031\t\375Dmu\267\215I\350Na\341\224\274\273\353\016\351\030}<\nk\031\2521\372Dh\b\300\027B\247L\311\242\0322\363\371\310Z\320\322\250P\272@>\016+K\224e\355\312\210\307\210\257G\246\020U\201\230\371z\2730\006\335\375\035}\037\364\242\376\307\371\017\341_\245\214"
+	.string	"\253\211\267\301\0178\361\343\372\321\353\365\003{\226\221~\345`0\030<\037\375\273\247i\223\352L\237Te\273\217\311\2758\3670\271\017w?\347^\312=\363^I\026"
+	.string	"\267\264\n\304\350\016\n\022i\253)\303\304\177\375\225\305\356\037\371M\\\334v\025\352\nT\247\235>\235\306c\335E]S\335\255r\007\242\316\023i\302t\323\325\025W\246\223'\313\212\240lH\236\314_?E\004,\363?\001fu\224|\322\323\027\n#\303U\351\270\\.\324\311\254\240\204P"
+	.string	")-\034\275^\277Fy\231\332\312Z*!W?)[\031\317\370\237\241Y\035?\231\347bR{\350n\2240\205\025\317~\351\322Hd\305z T&"
+	.string	"\205\325\333\256\3775\332\342F\354\356\335\256Q*\245\273*\351<\006\235\325Q\347U'\324\251\001\026vfpdl\302\337*\310\270\270\274\264\260\254\224\340vp\024\344s+:\032\030\r\272\230\232\034\316&\306\206C\203\273\261\345rtl+\t\256\273 \223c\333\321\351rl#@\236\362\321\033pY\361\270Gvw\303\030\351+e,\373\241\3500i\034c\240?\fR\333\030\317X\344?\202\204\325\361'>3D\216\001\211\261>\351\203\037o\275\344\210\020\30646\020\025\302\250B\326*\275\017\247\0339\002* \240\002\0312\363''\201\2567\013x9\344\330Q\336\315\r\371fq\005\027\037\345\315\321<\362\017/\210\212\034\302\260%\343\004"
+	.ascii	"i\344\225\313(\235\003\370\b\263#\270\352\250&a\226Ruk\373\220"
+	.ascii	"1\025\375n\b\323\252\272\256,\024\241^\346\267\0304V\230E\207"
+	.ascii	"\217\264E\230\304\307\017\277\333\245\007"
+	.text
+	.section	.gnu.lto_blackboxResetWriteBuffer.45.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\252\002%\025"
+	.string	"\366d\206J\240VN:\204%\342s\310\353\255\0278\r\262\216Qq\2667[\030\341\223\375\r\345O{\334\323\243 L\250\276\241Y\205\013L\231Qwh\224\276\2247`-x\035|\314\357\316\221X\310\033\362\245\370\340\342\037\210\020B\310\336)\005o"
+	.string	"j"
+	.string	"p"
+	.ascii	"G\037P\314\037\325\327\256o\301E\313\224\027\355{\313x\261\274"
+	.ascii	"\200\361\342U\214\263\223\334\267b\311&\035HR`\273\033\253*\216"
+	.ascii	";9\212a\2458?eGtr4wI\027E<\f\025,i\205`\331\031\205-[MG\016\324"
+	.ascii	"\321\032\316\030\201\2350\355\260;\nW\302\220\210\374\351t\303"
+	.ascii	"\256\210R\322fwM\315\035\210\273\274m!\333\021l:\025?i\276\323"
+	.ascii	"Ec\260\321\233\027}[}\361\202\312\321\240\377\364\224\323\004"
+	.ascii	"\327\322&\266\257\210V\236\375pk\n\373\275\273\024\251kHM+\365"
+	.ascii	"\001\220Y[/Bv=\004\235\354\020\321\252\305{\377\357\324\276\013"
+	.ascii	"\211\032\277\206\357;\320*.%n<\n\367\337\rF\027`uMS.v\253\036"
+	.ascii	"\224\027aB\027^\315m\034\n\367\336\3207\2672\326\004_\371\312"
+	.ascii	"TBk\255!\022\244'2\374\251S\r\371N\306\221\311\306\213\t\274"
+	.ascii	"X\316\030\b\224\230\320\b+\317\017\3766\322Z\373\005\251\003"
+	.ascii	"X\214X9a\224\365\275\303\344h\023\263\320K\0358+w\367\246\275"
+	.ascii	"\303Co\226\365\306\244\253D&\227\016\3749\234J6R\005\305T+\317"
+	.ascii	"\377\031_s~^:\032f\273\3479~\312]\035\215\217#\026\202v\200f"
+	.ascii	">\243i*\314ff\0320\220\211!@a\226\2416\263\315j\245ubh<8B\264"
+	.ascii	"\234\036\035\231ON\f\210G\366\023\323\251\331b1\007L\2730\253"
+	.ascii	"\305\202h\264ZL\305\227\273M\256\026\221to\254Q\313@\327\222"
+	.ascii	"\023\353@n\nt\355\346n\372>\376\003\202\204\233\233\361bV\335"
+	.ascii	"a&\365\250Z\\\032\316\361_Q4\b|q\026\021o\341.\n\007\377\035"
+	.ascii	"\345+jF\255>\217: `\002\231I\264\036\366\317\002\243\236< \030"
+	.ascii	"F\220\2609\033\310\234\275\240v\261n\206\006x\033\272\n\354u"
+	.ascii	"\307\272c`C\223\260.\t\234Pw\246\b]%(\365<\324\007\267L\256\366"
+	.ascii	"N\326\016l\342y\033~\226\227\006\353\312\364w\302\332\346\254"
+	.ascii	"\021\326n\026\3067\362\330\006\240Z)K\354\214:\005y\205\361\255"
+	.ascii	"\260&:\314a\213\215\225\211\347\211y\017\341[\345A\2100\371\022"
+	.ascii	"\2336F^\020[\016Z\277\n\265\301\333\003"
+	.text
+	.section	.gnu.lto_blackboxFlushWriteBuffer.46.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\224\001\275\016"
+	.string	"\326Y_F\360\260(\035\372\344\362\255\"\316\212\223!f\360M\017\226pS\231Jp\357f\272q\276\007\023\375\312\300\350\361\277\021J\342H\364C\326X\372\216\344d\023\272\231\331D\026\331\336\334"
+	.string	"n1\235\217\252/\b!D\312\224\002K"
+	.string	"E"
+	.string	"O"
+	.ascii	"\273\353i\207\237\336q\233\246y\362/sO\030\301w-\347X\276yD\226"
+	.ascii	"kZ\002\034\020\031@QE\033\200\201\006\347\023U\251\032\001V\013"
+	.ascii	"\013\240\270\322B2\0160.\363\244\020S\231\335\202\335u\206q\345"
+	.ascii	"\006p\333'\266\025\330\317\t+|\030G\260M>\374\346\333\206\373"
+	.ascii	"v\ry\270\200\312\035'\214\306\213M\034\266\013Lm\331\327vw\255"
+	.ascii	".\266\2465\323\371\364?\036,Y\201\232\335\n;9\366fK\021c\373"
+	.ascii	"\037\237\354\030w\275\354_\263\325\314,\333G^\375\023%O\3241"
+	.ascii	"3aRI>\264\001\025\005\r\202\3310\213\032\031(\264\231\022H\316"
+	.ascii	".\352\241\377z\t\023\037\346\233\277R\311\364\322q\235\304\004"
+	.ascii	"\224\224\024\356[*\210\316\007\254F~\bY2\325\026\202_E/\027\252"
+	.ascii	"\274a_\304G8\036\205|$\021\t\237\250d4\342@\344= \215\230x#\023"
+	.ascii	"\212\027r\300\337\t\211\311\203\360}&\357\343\332\253\213\031"
+	.ascii	"l\270Ai\312\002\322n \222R\320\031\323\320i\213&\3642#\326\302"
+	.ascii	"\005HU{D\242R\320W\325\257v\200b\361*B\304\254\004$ p\002\031"
+	.ascii	"*\355\001`\352\315\003\226\033\342[|\017\227\361Z9\031\t\\pE"
+	.ascii	"\222\343\002\222-\231E\242\205\233x[\247\340\242K+\204\343^-"
+	.ascii	"Hq\2535+\230b\324\306\021\022\004\213\023\222\337\206\202\362"
+	.ascii	"\364\271Ap`x\030,(It\223\251s\301\324\035\265\025Q"
+	.text
+	.section	.gnu.lto_blackboxWriteBuf.47.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`y\002\365\022"
+	.string	"V#zG\340\322&\035\"\t\362\317\240\024\027\020\020\3401\211\305\fB\312\334\246\216\206\016\303\375ah\355b(\027b\323\306J\375\361\204}MF\264\355\t\322a\306X\236PJ5\352$4\272 \265\241\241~\020i\322\310\336R\246\024c"
+	.string	"Z"
+	.string	"h"
+	.string	"\371\025~\212\253\210]\310\302\003\354\372\030\035\355\332P\254\322=\332\366\022\356\261\373"
+	.string	"\356\3211\373\307m#\366D\034v\210\232vw\245\"\036;\027\241f\314\227\235\363j<\217\035\317!d\3454u\030q\332\341\361\325pRU\265\034x\262\273\277=/\324f\231(\226\335u\322j\032n\324m\267\330f`gP\266\311R\177\354\303\335]\253\217}\241\237\344C\277*\323_\246=\230N\305t\227i\024Ls\232\216\231\206\231\326Lg\246_\342\335\320\201@i\027\303\023\221]\2124J\330\276\375\0261\373\263M\210\254d\376\346\333\316\"\366!'9\265\033\202\351hwQ\274\240{<\201&@V\036Y\244\24416,\005\211"
+	.string	"R\245$j\303\304D\225\261\230>d\200*\205\n\273\341\200\001\225"
+	.string	"\220\027\344\245=\363\312\323|2S\231G\212P\344\356\312T\177TS]n9p\322\351\305\004U\024\037*\275\246^\307\303,\237\354\023\335\205\223|\022\2561R\236\366\350\033\211{\274\036"
+	.ascii	"\352\271\311'\377v\257\350\304\216\315!\016\020l`h^d8\257<xa"
+	.ascii	"\261\024$PI1i\331\264\034@\273R^1-\025^.\021\\-\031\227\025M"
+	.ascii	"Lkf\345\202\325\254R\f\370%\341\005\266\262y\275`\253\317\266"
+	.ascii	"g\271\321\031\367i\215\323\204x\372!\325xZ\300\206\200\214J\242"
+	.ascii	")\265\033\264| tT\346N9M\351{\350\230@i7\003\245\251\236\033"
+	.ascii	"\243\313\240\320r\271\270GNSQ\277S$3 \260\002!!\263\003\247\223"
+	.ascii	"@ZO\004\374p\271\302>(\320\260\366jkle\274\322\031{Wi\032\033"
+	.ascii	"\213y\220\327\233N\030\335e\2215H\001\317\356\202\244\206WH\034"
+	.ascii	"\001\313\221\r\021\251\307v\274J\316C\31760\233\326\331\367N"
+	.ascii	"\222\214\2025p\203\275\2121\256i\314X\260L\342\363\r\032\f\212"
+	.ascii	"\032+\314\242\201/)\245\373o\257B\224%\223[K\365"
+	.text
+	.section	.gnu.lto_blackboxPrint.48.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"-\013"
+	.string	"&UNB\020o\225\016\0176\226\212"
+	.string	"J\343B\351)\2154\031\361\251@\205/\371\376\377oW"
+	.string	"\225\243\021\304+1\3367\307\225\313w/"
+	.string	"\220*\240\212\353?>\243S\247\375?\375o\265v\374\255\022M\310\226;\2458"
+	.string	"?"
+	.string	"6"
+	.string	"\266}\f\317\360\331 \246H\341t\325\312\264\341\265\273\234\345\033\332\263y\r\355\231N\370w\371\371o}\256*\230\bO\340\345\005\311\356Z\206'\t\267\336v\207m"
+	.string	"\366=\002\332D\305\210\213\207]\b\261\025+\"\373`\341\343o\177~\313\224J\210\356\343\202\r\214\260q(q\341\304\356^\236\271d\253\270\272K\373\032\316\372.2x\306n\212\345\332\025?\234\331\236Y\334\002\226\007)\246~\274\245$a\276N=\013S\213\222\214Y\223\2526\202\004\362\3415\204r\240\240e\007\024$V\302l\021\224\252\262?ww\255)\373\343=/\376\252\322\017\004H\003@\235\217f\021\001\235\256\013\001\311`*\243\233\203\361<\001\024x\233\002\034\315g\303\201<\032\003\034G4\3420\034\366\016tD\034\311\363D\034E\334\333SGP%m\340\311\013CN\365B\362\241\003\020"
+	.ascii	"4\317\001K=\231\001aX\036\202\372\274,\2251h\214\250\022\233"
+	.ascii	"\\\263U\026$(\324MTA\300\211'\325\212I\230d"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.49.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 \340\r\006"
+	.string	"\302J)3`\247\246\003"
+	.string	"\025\212\rBC\215\bTP\004\030\206\367\361\353@8V\250FC\253i\026\210\n\313\275\201E,\004\t8$\210ia\007\204c\004\326J)S\277(\211M8\322\252\\\225\305\212\030\254\272\304+\323D\252q\231\241dq#e\026\247\257\225=\311@\370\341\355\274\177\307\263\312\235\261\361\374\026\004$\3646\374\337\\\036\375\212h\366~\236\004\020\036\013\335\241\007\207\016\023\007"
+	.string	"\377u\272\366+\350Wj\005\r@ CwG&\251\246\253]\225@\027\\7u\025\221\356\376r\235H\317\372\337\361\037\362\177\006\t"
+	.ascii	"`\25173`\2513\242\205\373\\\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.50.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`j\001M\016"
+	.string	"\206\033`D"
+	.string	"\221(\035L3\3547^`>\206\306\017B\037\220\232\001\007+\367\216\205\371\007\361\250\031\374\241\340Y\330od\026U\\\275y\204\333m\333@\312\001\200\025\301\364\243\037\324\0273H\317z\265\377\021\331[\312\224\002M"
+	.string	"I"
+	.string	"M"
+	.ascii	"k\362\351\330W\204\221b\373\366WJ\266\307\f\032\224l\272"
+	.string	"G\302\344,\033\035\\b\273\236\246#nz\204\232&\237{\274\353\bN5-3.T \016?\256\250T\366\321\212)\321Q\225hz\204\354\256\263S}\270\263\333\216`{\201}\231\233\335\224\003\237\345(6\337\304\2431\220\362\335\243O\312\036S\r\324`9\345g\217\214\230\266\006\016\371\316 (\345|\327;01hl\322\330\036*\225e_\277\357\313aE\261\235\3468\r\235\326Lg\207\244\022\303\361\231\261\001\236\330\013\006H\233\202(\337\251\252r>\213\203p\271\343\255\230\226\214*\313\177\361[\250\263\333\222\033*\273+|\027\3036\177\201\354q\363`S^+'ve_\205m\030\201\327\211\210]\356'.\331\260\3546\201g\225\312\032\333#\367H\002\016}6\221\204\r\233\310H\bTAD\263 \002\221h\241\021I\373\034\360va\302H\313\260m#\315;\035\256\242\330c&\304\313\213\364M\331]\037"
+	.string	"9jU\205\352\3016\324T\224\237\342\016\201Q@*\270\r\n\345;\216BX\245\2243"
+	.string	"\030\232\267<\034"
+	.ascii	"\263\312\375\356\351\244\257-]\220pM\\W\257\355M[\340\256\244"
+	.ascii	"\327\312\326\307\rK\301\313@\227O\345\216\252\225\245\340D\212"
+	.ascii	"- \006\027\270\236\nX\317\353\332e \360\373\206PC\315\373E\265"
+	.ascii	"\001\356vny\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.51.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\313\n\r="
+	.string	"\nj\\\027A@\346M:\234pp<\221\006\231\354\237?\032\254\200\230\203\227\347P=Jl\216\177^\273\033\262h\201c\0278n\363b\027|\374\031t/\370g\336n\213W\251\337\250\001\210u\254\031\261\204\220\275\223\fe\001H\001^\001}N\272\221\244yNN\315\3264\323\372r\316\022\256FA\372\360\273\1773\362:\3754\221S\261I\307\271\263\2343\205\253}\325\344C?\255\017\347q\3566\300\211\234\317A\362\266 \317J\222\300(cgU\354\325n\262\003\250\260\ta\263\222,\334QM\036\f\366\352"
+	.string	"\261\017w\3637H\276F\204\270\325\314\312!hri\022\256\266\005\366*\361\002\326\253\351\235\326\246\221\356\2639\362\264N\301$\003K\3139\013\257\366\325\216t\013\257\336n$\335\302\276\220\001I\267o\222A\371\030\331\221\255/\347\346\024\036{{\247\246"
+	.string	""
+	.string	"\230\206KJ\302 \220\375\255j\212o\333\317\272\023\b:p\322\240M\252\231\247\335\235\233R\312\003\230\001H\225\036\035\005\235L\222,\305\220\244\017K+\250K\232]\246,hew\330T\366\245\027\026\245\313\227\332\344\224\202I\234\034\347\240aQ\260\\x%%\006_\227\264\362\274\0022I,\027\370\013\341\366\3249\247/\r\032\026\345\353,\231$\225\224\230s~]\262\312\375y}M#\200\365\2212T*I\005\004\022;t\274\352\215]\236\246\023\250\264\371\031*\223\244Nwh\304\356\366\313D\271u\261\326\303\222`\253"
+	.string	"\263g\227\240r\013\337_\210\234s_\2442\312\373\351\335\307\352\356\256n \232\314\016\262F\341\207\255\341m\335G=\204\203\326\235\310\372\265\023Y\032\371\206p\213\242\360\333N4^HM\340>_\305\332\315\302\305=2\n_m\271\205\263\372n\377\0238\275\333\235\230u%\335\354i\366\304\202\372\203\360\232\274\264\263\234\003\365\353:\021\373#X\257\262+\262\333\234\264\263\274\314\020\016\250\273\02358\003\303\222s\326\301\022]d\206 \\n\335I\335\r\343~b\2609oi\350\363y\037\031}/W{\006\r\032\353\325c)<6\303="
+	.ascii	"n7U\325=\262\211Z8\253/\\\236:\t\357\347\271\236~\366\275\264"
+	.ascii	"U\317\335#{n\275\232\200\214\317x\243}\264\277`\264\204\356\345"
+	.ascii	"\013\251\273\251u1\263\3738\032\215:j\274\245\273o3\350\333\013"
+	.ascii	"~\267\211\301\333Rg{\033x\333;\212\275\r\325\267\231\276\366"
+	.ascii	"\036\006o/\261\267\225~\267\205\301\333\301\340m`\3606\253t\373"
+	.ascii	"'\274\275\006o\253\354\355\024x\033\263\267\377\240\201 0,ce"
+	.ascii	"\370\256\231\241D#e:\325\031\346k?\333\337v\334\375~\363O#\247"
+	.ascii	"\323\207\273\235\317]m\021t\307\311u\307Y\300N)\027G\340(\027"
+	.ascii	"\327\317\264\231\225Pk\223\216s\001s\177\227\234HP\312\026\365"
+	.string	"s\375\235\t\277\234\020\377-\210\205xet\234d\344\003\342 6\300\246d\r~\353\265\262\030\210\257\204\214\326=\336%\255W\225\366\312\025\374'\036\2252\313\fa\350\034C\007|rfi\276U[\373\032\257V\253\366\325f\311\262^\325@\306\367\344\374b\311rR\2102\t\315\313\272\222:4j\022\211\305\314>\302e}\2413\215\3519\306\251\367D\326!f\202\377`\225\302Z~\230\242\321(\337\037\254\006\260\024\356\253\004L\353F[\2102C\367~\270\017\351\221r\264ZZ\261+\266^\305O\344\036\205;\304\367\355\330\252\342~[\266\376\356+\356n\273\264_\356\221?\234\346*8+\314\033\265c\244\3104\024Z\261TY\034Z]\306!\214\277B\377\332\217,\237\342\316\324\275\331\265\245Y1\263\207K\362\3332\253j\342\213\3322l\316[\034\372z\337k\317\244m\232V\315\332\252Y\257\252\030A\231\323\313"
+	.ascii	">[\212\r`\354\3478\251\273E\273\242V\215\3159k\350\033J\321\266"
+	.ascii	"a\275\\M\261\2038.\214\373\207\216H\304\b\022$\326\253\351\033"
+	.ascii	"r\317x\243}\340\376\356Q\270\373\004\212{$\306\367Z&a\371\240"
+	.ascii	"\271\031\035\252\322\247b\346\237w\210\377j\t;\026Jq:r\354\320"
+	.ascii	"\221\022)\366\300\255\243B\020\035XT>\246\256\212>|\024\253\n"
+	.ascii	"`\371\240\3029v\340\270*\216\b\026\261\272qu\302\n\213\252\305"
+	.ascii	"\r!T6\226Z\003\016+\f\0302\\\260Pa@\220\253\342\016\254\037*"
+	.ascii	"\260\200\024\177\b\273\252BqG\215\"E\033<\252\250z\330\230\272"
+	.ascii	"\332A\345c\252\nH\220\251\n\013\272\370\303\n\310\024V\261\b"
+	.ascii	"dJ\3304>\315xK\t\27439qM\177\2736\225}\035\343\226\026\340\273"
+	.ascii	"\035\305\235\232\234\270\364R9S3\341\213\265\272C\244NN\275\273"
+	.ascii	"u+\025\310\370\254\272\350\240{\205\364\376,\2330\323\231\247"
+	.ascii	"\316\215]\2353\001V\006\370h\177\332c\346f\221\235\241\016\267"
+	.ascii	"\317\246u\322B\271G2\300,\226Zs\354\242S\216\254Y\350\372\240"
+	.ascii	"\by9\002\200\231\375@\207\302Pl\032\306\225r\271\240\316\346"
+	.ascii	"\254\335^0\316W\036tQ\236\035FtLK\030\310\032\336\206\333\335"
+	.ascii	"r\265]\367\310%\354a\3314\347lC\367\243\035FW\022\2327\304\314"
+	.ascii	"\316\261\376\360\002\234\276\035\347\264\234hP.1K\230\331,\360"
+	.ascii	"\b\205\230\005\232\340e\362?\017\\\332I>\212\003N8\02139\243"
+	.ascii	"\204\237\034\271G\304Jx\035$w\242\361\355w\273P\rW\022\232g\274"
+	.ascii	"\220\224\224\334\2568\235\355\201\021b\346\2035\210\207\254\375"
+	.ascii	"YBv5\320\023\324'\210\231-\341Blc\r\357\317\007\335\224\001\200"
+	.ascii	"\324\250a$\307\030R\n\315\210\214\210&MZ\003`\002\221!+\343\006"
+	.ascii	"\021\200)eU\223$\225\016\247(\325\037|\017\336\203\342\357\230"
+	.ascii	"\270\022\266\205^\222\217\254\213\356\247\364\257\347N\023\204"
+	.ascii	"\016\376,dqx\257\350\233MHd\243\212\236yy\2364\302\202\nE7m\267"
+	.ascii	"\305\026\020\207\224\331\227\264\335D\306a\207\315\274*\332j"
+	.ascii	"\222\027\333\204\004\216\006D\327\254\355\023$\377\313\b\334"
+	.ascii	"\327\344\037\322%\b\036\021\221\226G\345\270\364\315\0265\247"
+	.ascii	"\361\"\333'\247\224\201\203\033\356\372\210,\343&!\024\346\313"
+	.ascii	"\316( \374\235\221\314cY35\2352\005\272\320\361Q`\265e\t\354"
+	.ascii	"\210\233*y\215\006\013#!\026\b\026\003\031\253&|\302\355\032"
+	.ascii	"\357\321J$\207_\3101;0^\206H\345V\336\f\005\332\343p\350k2\031"
+	.ascii	"nb\227Tgz~\327\360>\340\255%W\255\270\206:m\363\341+N\035\227"
+	.ascii	"\270S\210\312[z\346\375\"\243\277 }\205\374\2560\252bs \307\037"
+	.ascii	"A\tB4\304gX\2316\266@\201\272\361\025\003\377\374\220\301\313"
+	.ascii	"\201\222>\035\261Q\244\360\211\034`\257SK,\"6=*c\357\373x\236"
+	.ascii	"\304\367pUI\036\271\030\264\326\031\332O\245E\020\001,\025\225"
+	.ascii	"\245\344Q\377)\303R\031\237\031*1\210GWM\244\f\212\371\315rq"
+	.ascii	"\331n\";H\276%})\270\222sz*j\022^\375[\215Y\026v\272\022R\312"
+	.ascii	"\361O3Ep\200\323\244\343\305\360\303\2142s\235\227YPG\320\252"
+	.ascii	"\221\260\273\336}\214W\337\214\2445]G\2620\374K\311\270\030h"
+	.ascii	"PCMfk\013\334\251\216\204\312\221\223\377{!\234\f\234\225\032"
+	.text
+	.section	.gnu.lto_blackboxEraseAll.52.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"U\n"
+	.string	"F\022F?\020\005+\035"
+	.string	"\202s\227\235ck\270P\304\323\263[L\221eF]\303\271`S\254P\3124@J\005\033\274\035g\203\030b3\343\356\004\024\207\205E\310\226C\033\007\013!x\202\003\333\310\3362\2452"
+	.string	"2"
+	.string	"4"
+	.string	"o}Jm\371Z\223#\216\256\317\267|\262\320\020\020\307\222\3139\322\305\002\210\306p:\204\344L\fF\230*\bbw\255\342Hr{\267\035a\273\301>(/\335Ym6"
+	.string	"\253\007\354Z\250\022\305\376\\)\263\257\276G*\320#!\263+\262C\2607\357f\305\366En\331\003^\233\355gxb1\271\335\375dJ\241\331\216\354.\003\t\347\346\322\004\026`C;\221G\370\\\036\300\340`\252\263\275\372KGh\027\366\340\273\234\346\341\253\3343\bK/\336\363Y\237{\227\t8ZF\225\300\024\305\007x\262@\231.N_F\312\204\361\241T\253\257\264`P\243B\365q\200\240\352\023\325^\237+e\2360p{\311p\222v\n\324\0067\364\242\025B\351\362\310\246\023\022"
+	.ascii	"`\2517\023Z\203b\200\030\212\363{\223\3200\035\211\027\203\225"
+	.ascii	"z\246\340\312\n\003\242\016\326\270&\0220!\277\f!.\035\314\306"
+	.ascii	"\321\b\n\n"
+	.text
+	.section	.gnu.lto_isBlackboxErased.53.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"M\013"
+	.string	"\326\324M> Of8\314\b\013\212\317\370\364H\b\311\013A!\310^T\t\036cL1\023\ro\202\372\210\375f\227,\336\036\217x\202/C\245`\016\216\020'\3207\201R@jB\321\377{o)S\n<"
+	.string	"8"
+	.string	">"
+	.string	"#\013u\020\265R\214\266;z\372\341\3407M\320\017}\273\353\004H1\330F\t1u\335&\035\245\024\0221\334\020\220h\035"
+	.string	"\210\243\314\207ew\235&Q\303\315\335\366\002\333\006\354{\001\377t\347\256\0028^\242\254\371\256G26\240\330|a\217a\252\007\373\333\352\312v\272s:3\375\307[*\032\013\007\262]T\r\306jp'D\330\006\331\022\037H"
+	.string	"2\370\221\2649_\336\324i\003U\250!O28\254\200\2606\303\356\026\240\2444B\031\303\033&^*}\200\356J\201q\214\262\3036\205\223\360@vG\n\374\021\177Y\360C\234\363\205O\336t\316\001\316T\276\315\003\f\037\006B\346\022\001\343I\330\\8^\246\343\361*\003\374M\320t\274\n\337\327\361$\243\350\272\362C\005J6\313\037\354\356:\203\323\2514\323NSOj\213HCkZ\353\242\305\026\022"
+	.ascii	"`\3253C\300p\035W\264 5v\027\021\307r0\300-\2402S\341 \013[\207"
+	.ascii	"\300\330\350\032^\205\305cC\220q\327MU#\317\245\240"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.54.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"}\013"
+	.string	"f\225OA"
+	.string	"Q5\035\340a\204j1\360a\242\374\222\337D\226\313\261\305$\013j^\350w\242b\340\373\032|l\224h\334\001h\032\303\005\231i\002\264\276\027Hn%\2445\\\272\211\024P\371H\372\265\033\3312\245;"
+	.string	"9"
+	.string	"?"
+	.string	"\366\354\032\037\305\275\nq\224\242\334]n\202\270\367l\252\347\177\304?\300\360{&\362\231Q\\\243\031\2230\224\031\310Pz\b\tE\252\036\tv\327\n\206\034n\355\266\021\330.`_A'c\360J\017^\363\275\332\256\t\020s\2004\346\021\021(\0358V_\366\030\322i\262\237\355\356z\226\354\253\277=E\2267\030\254\330\325\020\333\261\244\326\"\204\355\333'\341\331\223\237D\334\r\273k\251\310 ?\205\231\006\013\025iN\223\347\001l\237\025\024-\221\272lO\370\t\217dWt\300\037o\242\202\177\272f\013\237\317v\3553@K\245/b\260\b\334/q\225]\370\001\326\\\272M\203\013]\346\201\006\003!\303E\330`8\234\246\343\341.\003\334Ip\320\341(t]\207\233\214\240g;K^\360\201\004\315\220)0:\260V_\244\265<\205*m|\n\313@\324\346tz\320s\006\021"
+	.ascii	"`\2517\023\372\211b\230q\240\266\"\307\231e\263\266\017kQ\t\214"
+	.ascii	"\360\343\302{*\217SF\376\224-\3422\266\270\3141\233|\013S\017"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.55.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 \343m\006"
+	.string	"\004\013\200"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\357\367#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\317\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307}\361\370\240\375\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\373\002\200\362\371\220\373\025\342\277\337\f"
+	.string	"\203\003\202\260\371\370\003\006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\325SC\300P\207pBT\226@]\023\363\"0\023\"\207;\367j\347\023"
+	.text
+	.section	.gnu.lto_blackboxDevicePrepareLog.56.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 \337\025\006"
+	.string	"T\n\200"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\372\317\001\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\337\177\361\370\320\223\006\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\373\002\200\362\371\300\377\025\260\223\306\f"
+	.string	"\203\003\202\340\273\342\b\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\25173\340\2473\262p\023\313H\256\341n!\214\227!\300\245[\264"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.57.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"\315\f"
+	.string	"\266VWE"
+	.string	"\2216\035X\204\021\214\305\002\275\210\203\310\177\372\372d\355\006\3779\304Y\330\311UeN`\b}Z\177S\006.\242\302\"\001\223\360\241\331\376\253o\257\372\fm\203\367\330\335\356\351\340\220\355\217\345\237F\366\226)\005C"
+	.string	"@"
+	.string	"B"
+	.string	" \221\211\275\213*\251\002(L\234\264\030wEL\222\270\367)\325\363M\237g\371Ty\310!\"\346E\310\341r\016\2309\241\301\t\277\031\3120\202 \020\242T\001x\354\256\025\f7\334\326m?\260\r\301\376G\316F\230\263\\@K\007\024\0357Vil\361S9\302\376\\\231bK\365/MFJCxp\265\233Z\325\354\213\005\343\204m\023\233cwZ\034\250~\305;p\034\343J\214]\261\201?\233[\266\035\273\313\340\372\3602\3320\351\016\307\270\250B\310#\270.;,dP:c{\373\212\220\315.j\344\213W!\342\227\270e\216D\017\336\362I\256[\227\tdT']9\253\271\324\266pA\017Z\301'M\001\036I(\205B\"\320\307c"
+	.string	"\204\373\030\331H%\245.\2005\017\267E\300\300e!\032iB\206\215l$\021L\353*`\236\005\346(\224:\254\204\343:\214#\236>W\246x\227=N\362\233\232\013\310]\314H\001\263JSc\243\262(\001\026"
+	.ascii	"y\236\005\226z2\241\275(\340\023\207\005\177/\023\032\202f\b"
+	.ascii	"\263\201\333\225h\006\300\001\036\266Vcl\313\331\026\314\005"
+	.ascii	"\\\030\005\231\345\204\261I<\333\246J\235\242V\355\001"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.58.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\335\013"
+	.string	"6\226RA\020q\\8\200\b\034\355IB\247*"
+	.string	"\025\275r\023\206\231\356P\275\254p\006+t\034\240\024\346-z/Z\373}\347S\367\336\332C\353_\225\357a\331\201x\255kP\373\t\2540\363\257\2376\2212\245A"
+	.string	"<"
+	.string	"A"
+	.string	"%o\027A>\001(\031\247\024\253]1S\021\337nin>w\353\251[$ \306\020\023\026\340\207\253\005"
+	.string	"\345\004#\003vV\202\r\253\020\001@S\246\205\263\273N\017\364p_\267\335\300\366\001\373\f\002>\t\373u-p\242\332\310\321O\035\243\242\203\243\006\215\315\024[\354R?\354[\253\036\266\323\230\323\231\351[\"\224\370:\200\377Dv\277QeK\256\026$l\337\276\211\222\2351\002\005\001!-\357a\352 \354\224\363W\274\030]\224\354\030\027\220\345\330p5XG\311j\006\227+6!Q\205\252\037?\001\354: \344\304\224(\266-\034\305\350\262kZ\340\237\270\n\203?\342\2273\220\362\336\257\376l4\320\003\r\232G\302\2473\301\223Q"
+	.string	"uB\331G4\3126\006\254U\200 \312.h\232(\313\210\033W\017?D\215\247\021\305\364\251_TP)\"#\351oX*\007M\355\322[\2159\\\256X\230\264\003\021"
+	.ascii	"`\325\273#`\3176\356j\201\020\301\306L\250\317\357uDk;\b\220"
+	.ascii	"\364\330\026\215\225\211\021\3075\361\r\023z\334\315T\225St\251"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.59.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 \343}\006"
+	.string	"D\013\201"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\317\232\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\234\2638\221\202\205H("
+	.string	"\177\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357\231\001\221\314\352\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\242\013"
+	.string	"\203\003\202\2409\006("
+	.string	""
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\251'3\340\241\243\003!,\327\360\326\210\221\205\310\303]1\265"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.60.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`9\003E\027"
+	.string	"F\353\225I\240\226U:\327[\274.\037E\022\377\002\0359'a:\244J\205%\bU\214\271-\rs\344\205$\327\016\264\336\006h\026\337\276\311\252{:]\304\353\214\361RZ/\305j\220\225v)\365\313O\201\206\262\203\353f\311&r\247\024\200"
+	.string	"x"
+	.string	"\177"
+	.string	"\323sN_\346\232\262\001x\021?j\345PV\251M4\b\213\017\177\373Or\213\245C\202\3178\222\356C\013\257\036\3523<9\212\321\244\326\372r\352\030\325\351\3542\362t|\214<\265\316~\272R\212\032\340\350\305\320R\224Z+mQ\\w:\356\324\371\005\210r\374\200\273\323\035qd|\322\025\220\020Q\376\200 \276=\037)+\"\252`\0011\354L\321\324Z=\177@\0177y\3339\266\031\330{!\347\261HF\265\346\360\231\374\244\372\007\220\247\027\326#\035FUh\177\311\366\223"
+	.ascii	"&\301Zw'\232\277j\240%\364\315(\333>\267\361\243\252\3257\343"
+	.ascii	"\323x\r\234\277\342\324\022\202\346\177\247~\020y\372mq\032\362"
+	.ascii	"f\351\236(.K\240(\251\223\212\255\324\233k\302\376\226e)\305"
+	.ascii	"[\302\216\301^\037\336.:\335\242\323,:\275\242\323*:\235\232"
+	.ascii	"\323$\235\246\343\3648N\357\006\373%\227bR\214\256kc{!\243\336"
+	.ascii	",\355\007\271\020\023\035x\210\207\220\247tW\234\202O\372S\024"
+	.ascii	"\221\\\363\306M3\322b\b\330\2700\330\264st\346\177\343\342\b"
+	.ascii	"{\273\363\231\212 p\334\245\370\241i,_\373\341g\274I\305\273"
+	.ascii	"\257\235I\206\242V\346\\\273f\233\377\355\316|\273\263\337\343"
+	.ascii	">*\370+\374\340v#O\347\2628\005y\263\364\231\226@]\307g\273\t"
+	.ascii	"\365\"b\021\221]\023\336\341\236\351\261\311\310 8\020\003\003"
+	.ascii	"\300V\333\001\262\261\331r=+\327`p7\035\n8\036\237\332\016\004"
+	.ascii	"\036Z\204\333\316\017\255\226\013\242\301\0200\016\310\226\243"
+	.ascii	"M\300\341r\264\226\022\357c\335\022&e\264\230/'a\234\030a+\303"
+	.ascii	"\341\342i_\353Z\r\266\255*\002i\342m\317\255E\262\304\237\223"
+	.ascii	"Yo\"\311\332\326\342$\211\355jY\333\002%\364D\265\251]\355\205"
+	.ascii	"\210zEn\304\302\202\232\032\362T\265\253 \271\251\375P\024\217"
+	.ascii	"x\"6\rnn\310S2@\250!@\246\0341\212\021\222\tIK\243\016p\002\241"
+	.ascii	"1\254\007\021\240\301RS\222\266\003\331\032\340\363\223P\377"
+	.ascii	"\271\314>\361\363\031\333\241\327\231(\215\304\253\212\303\303"
+	.ascii	"\236 fL\361Y2c\023k\305j\320S\305\001l*\255\243M\021l\203t\247"
+	.ascii	"\267By\033?\t\232P\265`\204\307\232\240\324\0275\224\242\034"
+	.ascii	"\232\260\223\253\277\021\240<x\021w\266\032\302nQ\243\236V\367"
+	.ascii	"-\f\325\361Z\220\025,L\314\371cx:\364\251\r\007\003[G>?"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.61.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"]\f"
+	.string	"\006XWC\020s\223\016\317\354k\363&\024\300E\350\224\310\304\210\004\035\n\315\230E\250\027\032\r4,\242\317u\267\206vv\037\261 t1M\277\006\003"
+	.string	"\nE\360\250\200\215]>\307 `\204\343\177M\213do)S\nE"
+	.string	"A"
+	.string	"B"
+	.string	"\326$t8\215\200\240\002\304\007\030<v\275\353\3009\326#|\001\353QM\\;\324\324|\rg:\314\250\256PA\211\031*\001\034\nr`Tl\274{\236p\251L"
+	.string	"\240\335un\234\210;\336v\004\333\023\354\203\002\312b_\277\357\213\261\256\330o\371-\247!L\247\246\237\031qA\t\301\375\004\216]\224\357\307\276D\031)\354{%{csv<\310|\367\026\023H`S*).\273\273\300\236\314\243m\177\305Y\224\002\006\231\022\b\334\335\205\001\322R;\323\220\337R\241\232r\245\003\206\204*\213-\275b/h\244\322\207\375\026wa\342\2430\251$\277=\372%\326\343u@\215\224S~~wM\214\325K\217\034\2331\266\207\312vPA\364\3714`\340\351\030 \211H8`\321\241N&BaC\206\215\204B,`\027\006\221\220\013WhD\272:\b\234e\020\215.\222,\033]\033\357tx]y\367\253<\254\202\244\257YPOlCME\331%\373Fn\233 \020"
+	.ascii	"8\317\007K\275\250\202X\025\206:3\f|{\246\025\320\212\241\262"
+	.ascii	"\230\270\263*c!\271\f,U\330\341\347\230\226\373h\fj\017"
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.part.0.89.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\227\001=\017"
+	.string	"\326\233dG\340\224(\035\350\305C0 \227\f\345u=K\264|\003\007\353y{\203\347\321A\323L\253\357\003\203\261\322\r\263\234\270O\353\004>\260\346\365\2220\203X\216`)W\006\2115\340L\306\374\207\226\367F%\210\354-wJ\001J"
+	.string	"P"
+	.string	"R"
+	.ascii	"\273s\301\245U\270K\317\033\330.\271\023\330.\355\347\330V\265"
+	.ascii	"\374\331?>cKr\302\246fV\333\335\356RQ\374\273\302\370\371p\004"
+	.ascii	"\017\226ku=\355Q\305\215\020\226\013\304\341\200G\022\b\273k"
+	.ascii	".\304-o\373\201\355\224}\035\001&\"|\320\344\250\355\316\356"
+	.ascii	"w\314w\2546j\260\330]\320}\232\312\006\371\264\317\006Y\025\347"
+	.ascii	"\272Z\241\035\222\302\317\374\027\207\361=\206q\270d\327\304"
+	.ascii	"\020\236\335\225\300]\236D\325udBs_\255\220\214\004\341\247\337"
+	.ascii	"\342.\276\353\310\\\300.\254\007O\272\362\025\352k\216\314\300"
+	.ascii	"\037\003\220\221\263c!\021\032\266U(\034\312e\201\025\323\007"
+	.ascii	"\310\n\032\201\212c\215q\025f\177\376\272A\303\317\376o\nd\001"
+	.ascii	"H\354~\370)\262%\344\215\024\266?\3030qmf\354\345\340f\312j\353"
+	.ascii	"a\246\330\2161Lh\306^\001f\021!`IYx9\271l&U8\215F\r\030\250\210"
+	.ascii	"\016\224R%\n\321&\221\3272\201\203\267r\301TrY\351^ZJ\030:\023"
+	.ascii	"jC'J`/\303\t\325\245<\017\325\201l\303\307U\230#\370\364\314"
+	.ascii	"h\007U\034\333\243\236Z\220\022\230r\250\252\266\247\001\236"
+	.ascii	"\345\023\232\" `\202AJ\212\007\224L8?\364\254H\274Dca\303\221"
+	.ascii	"\320W\343\315\205\326B0nK\233%eL\310\273\021\356\260\343\304"
+	.ascii	">%\f\263\370\205<jYr+\326\355C\377\212\201\034\357W\222\006\340"
+	.ascii	"\353\234\033\300$\257\233\005\267\007\013g_z\355\033\003"
+	.text
+	.section	.gnu.lto_blackboxWriteBuf.part.0.91.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\f\001U\f"
+	.string	"\346VQ?\020Q\225\016\200\237\300\n\245\" \217$H\300\306\030\312"
+	.string	"*\314\0074\241\350\017,\252\375\371H\266H\337\fRv\261\276\017&P*\004R\342\306fO\006\004\324d\363'\3427\022\311\336r\247\024;"
+	.string	"A"
+	.string	"<"
+	.string	"\330\003\\\237\366Q\330\356J\366\354\031\377H\354\301\020\034\300\032\273\233}\352\210{\327(=?\222L\242\353\303\313\023%B\222\351\303\243\344\222#\263\273\306@\334\363\266\023\330f`\237\013\216\270\223\337\232J\223\016\214\306\203\276\212\257\360\316\3020\374\330=\311h\355\356\002\354\223\"\273\263B\003\276\365P\232\320\300\304\370\317O\361\225wV\350"
+	.string	"vQ.Z\273\237\201O[\260O\177\027p}\006\321\336*\214Td\310\352\212Q\257\366\005\f\361$S6\250\310\017\257@\025c\243\215\250)\253\224\253(\373\340\037\377\375\277$\005T\273\035nt\254\210\371\302\204\355\333\017;;\342\207\236\003\021@\020>\034\317e\314\003\316\345\202\340\200\2452\321@\232\003\351Me\3534\310\260i$l4\217&\373t\264\t\331\206\263\220U\bx\243\300\3412\320\266qY\304v\274\\E9\243AG\252)\333\262\305\352\311\220\326#\033"
+	.string	"7O:\253\236\341\306`\332K@\201T\316+=[\001(\341"
+	.ascii	"Q0\314u\355\002kZb\254\200\272=C\377\023\003\301\361\340J\022"
+	.ascii	"\006\340Y\347|\006\260\231\274\323,p\355!\205\205fKO(c"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.93.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`.\001\225\f"
+	.string	"\366\026R>"
+	.string	"S\225\016X9o\354\007j\252\002\320U\240r\370\254\005\275z\227\314\207\264\265\207\200j\343\355\356'P\260g)\222\005\231\246\177\207\252.^u\227\315\377\303\003\312K7\324\322\3306\2212\245>"
+	.string	"F"
+	.string	">"
+	.string	"\333\343]\370\202\361T\266}\301\214Lz\350J\275\345\203C\r\331n\310=\352\211\223\256\251\221\374\374V\245\353\301'0\315f\360x\255@<+\327D2\273\353I\210;\336v\003\333\016\354\213\b\031\323\227( \021\240\304njd\266&bl\205\f\317\241\314\251\303\006\355\245\002\307\013\331\242B\006\341c\210\034*\020\272><`\321#\346\360\004$\217\223\013\220\374\026\035\2065\026\244\305\356n\367A\317\336|pd\007z"
+	.string	"\245%\3736~#\203\237\302\027@\371\357\321\007\351"
+	.string	"\024#L9b"
+	.string	"0 ;6\205\320\260\355\331#\373\307\304\265\252\335]\360x\360\024X\016\035\245\034\222\332\262j\327VY\266\323\352t\226`1`\216\245\353@\320\320m&p4\0246\\\205\216\306\303q> \316\202\300\235\205\b\037\016C\327}\270\355\332*\313\007_\311TU\017\266USO\257\374v\235Qm\331\246\344\325\366t\371/\003\035"
+	.ascii	"F1\003V=\265\305\270\272\202A\034\bQ3\003 \311\035\030\223\017"
+	.ascii	"+\213\026u\016\341\325X#\370\002\006\344\201\021\256\030\027"
+	.ascii	"M\370\317\270yna\260)\020=\375x\353p\256\252\211\227:\355Kj\212"
+	.ascii	"\232\367_[\306"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.97.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\274\001}\017"
+	.string	"\206\032bF\360\222(\035(\305\017\002\325\317\223^\214\375(\363$\253\nt\232\324\347\234s\304\327\236\277L\214\251\007\243\257\373k\025\035\327\032+\220\374\313\036\317L\2738\034\310\316I\252\202\214\301\0179\301\205\211LR\311\336R\246\024I"
+	.string	"N"
+	.string	"P"
+	.string	"\227oa\333\344\301'\033\310\303\326\374\215\026\314\214\331\234\263\273\334\023?=\256\312\223\177\327=+\020\365\250+\020\30472x\231\221\030\001U\361\243\003\343\343\256+\0070\245Jr\t"
+	.string	"e\316\351-\304\255\335v\003\333\016l%\t2\266TkT\177;\251\021`b\316\016;D&K\276R\3000\231\005%\265\341%\342\340\021\272\230MUx\022\376E\213Y\016\204\255\017\017V\310^\2639\303\356\322\341K\264\313\355\004\264\313\333w\313i\274;l\270\373.\223\315\371\256\223\315\0055\"\t\243\221v\251\273@\026#bq\223\203\363\025\315\206\201\226\220\0028\001\364k\253|\372\225\023\250\026e\237\306k\254\370(\214\241\244_]\372\245\365\304\270\350\216?6AzL\035\"\303\266\311d3\271,Q\021\313\271Ai\021\335\031\257|\234\033\236"
+	.ascii	"B`\017\364\215\"h\370R(x\241\n)\235\205QH\245\363H\245\016\244"
+	.ascii	"\300\337\005\021\251\313\360}\244\216\213se\f\241D\314eS\376"
+	.ascii	"\300F\274X,\205\211\210\305\001j\207\274\324\242<\002\003\367"
+	.ascii	"\376\241\203\206\265;c\275H\323%\305\220\251T\307~\216\007+ "
+	.ascii	"p\202\0313\273\030\346\230\001\2577\370\2077\304\306\274E\211"
+	.ascii	"#\307\032a7\243;\361\036K!\364\314:\215\3202/\f\356\007ei\017"
+	.ascii	"\031\006w\226\207\206\341n\364\343cU\253\325z\305\361M\331,\350"
+	.ascii	"1!\317G\370\030K\037\343\027\"{\313L\272\020\260V]\320\350\262"
+	.ascii	"\266@H\336\314=\264\032\367.<\006"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.105.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\264\004m\036"
+	.string	"F\367\301E\200\336Mc\203\351D\277\371j\005\263\005\317\364H\032SZ&\220\3614$<\322=\214\3261\006k\275\374\221M\007*\t\350\355\n+\3358\"\266\210\355\202\302\314\233\036\3202\235\025s\027\214\277\2737\331{K\231R\261"
+	.string	"\251"
+	.string	"\247"
+	.string	"\245%\234/\355GY\362\216$\n\177>\333>\224s1y\247\001\312\351\006\206\255))*m\367\022s/\201\356c\276$?\300|i\205|\367\235\024\305\2357\263$m\345\331\371\350\257\351;\365\352i\355\375p\034%\037\250\031s\343c\243H\357I|<*\256\202\023$'\331\240m\t\215\237\371v\220?R_o\236\304gUo\267\241\rOC1.8YT=n^\275$'Ly\t\362\260\0051K\177Q\225\004\360\203\"\201\356\275/\276\326\370\361\252}B\177R\246\317\3208\344Y\276\036\266\366\234\3476t\357\365\235|\334"
+	.ascii	"n\333\314\266\n\233$\n.\221T\337{\351'\331\027\317`\214\f\rV"
+	.ascii	"\224.\247z4\332&\313\353\257\"\362e\212\016\333\213\2770\215"
+	.ascii	"\311\331\255r\252\r\332\362\334\036\217G8\266@l\264\032\305U"
+	.ascii	"\343\316\352\023W};\253\315\023\377\022WM\236\325\366V]\315\352"
+	.ascii	"\367\220[h\001\260\356\265q\234s\201\345\026#V\226\374\202\274"
+	.ascii	"VD!U\2002B2\\m\227G\204@\345U`\370E\001\242\220\n\315\241\026"
+	.ascii	"\325e\342y\373\206q/_\340\001\326v\357M\357\027\227\354\324/"
+	.ascii	"2\331\251\227\210\367\347\363qc\301\326\023/E\006)\340\362~X"
+	.ascii	"\211\335{#<\025J\b\2226\245\r\226\226\264\365\314+\214\265\244"
+	.ascii	"5\301\244\352\330\33384\016!m\320!Lk\225\274\322x5\216m\020\007"
+	.ascii	"\023\342\274\367\n\371f3D\370Z,,\256\313\357r/,|-\217 \"2_V{"
+	.ascii	"\300\214\225S=\372W\322\270\234\221\035\250\251\322\261\375\207"
+	.ascii	"\306a\231\265A\333\350\227Y\262{\340\335\272:\3621\177\213\327"
+	.ascii	"\316\037\201)v\n\257\357\002\017e\207m\\M.\360:\b\263\275\366"
+	.ascii	"26XW\3676\035\313>\230\355%3\331k\265w\035\244@^\255c\273\350"
+	.ascii	"Y\216\316{yB\376\327\261 \371Z/\0036\021\224\300B$\220(P\250"
+	.ascii	"0AB\320O\013$\0272\214J\037\005\351\222\210b\350\214N\034\025"
+	.ascii	"\2410\312\251H*J\221;Rj\221\013R`\335\n$\245\234\013\235N)\227"
+	.ascii	"\332\256'\257\005b\002Q\306\"i\375\316|\361\257\2122\206\225"
+	.ascii	"\377\316Dm\r\333\250\255\366\351\214\334\261A\337Cq\272\204M"
+	.ascii	"\245\006*\204\333\0338\324\367\f\304\263M>\332\031\034\013\236"
+	.ascii	"\276t\240\270\323\342:\234p\324r<Q\303\261e\350J\203v\332\240"
+	.ascii	"o\266\264J^bL{\263U\355\247\332\036>\324\367L\273\003>\331\246"
+	.ascii	"5bo\2206\206\314-\255\272rm\226\217\226f\264\357\231\242D\213"
+	.ascii	"i\203\017X\250Q,\203\224BF!R\"\"C\232\326p\200\002\031\252*z"
+	.ascii	"\021PAsjf\232\326\331\016\304\253\2034\377\304%\016\023|\373"
+	.ascii	"E\016\005\030\022\t\350PLm.\303#\017\211Avd\0018\355\311\314"
+	.ascii	"GG\263\337\367\241\233\321w\352\313\254/\301\201\201\030\013"
+	.ascii	"\177g\230\335\023\205!d\261k\254@9e:1\302il#ML\024\021\343s^"
+	.ascii	"\255\025\357\0231\302\237\253\267\207\377%\rd\006\317\305\264"
+	.ascii	")\247\203\252H\365'\023\352\212 wx\242\2530\302\327\035\220^"
+	.ascii	"LX\351\274\372\2003\361\276Waz\334\254d\025\036\r\227m\355\361"
+	.ascii	"5c\213\215\025\351\002\356j.{=\031\tUX\200\020T\315\352\347\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`\035\006\005\026"
+	.string	"\266!\177K\300RN:P\344`-(E\b\311\020\336\035m)sv\021\200&\\\007\277\035\032FkA\212\030\205\265\020\315W\024EQppQ\024\304LUU1\3639\324\212\366\346\263\377\206\226}\2347*\271\254\255T\023Mk\223.\211L\001i"
+	.string	"j"
+	.string	"l"
+	.string	"8\274\276\261\351\036Xs\247\220\246%\234yS(d\327<]\333\310t\r\030\32340=\003\276\304\204\271\336\201%\231\344\322.Dp\375\0377\\h\353_\371Z\372;|,}\035\005n\234\246iZk\031p\245_\0052\031\313\251\300\254\217\210\366RK\271\031\376\257dY\222+\376\376\235\212\026"
+	.ascii	"I\222$\201\326\201\377](\001\267s\206\376\r\f\375\250\013}(\013"
+	.ascii	"\375\031\025\3724(\364kL\350?I\350OE\350\307\200\320\207\361"
+	.ascii	"\240\337\"u\320@i\203\016b\320gZ\320\247R\320\307\221\240/5\324"
+	.ascii	"\267\201\240/C\250\277t\240\357\302@_iI\222\374W\202\372/\026"
+	.ascii	"\210$\374I)\342\323?=\266\220\247}v\272G\247yrz\007\247un:\247"
+	.ascii	"\327\001RI*B\324\214\\\313}\216'-\247:\362\242\013\2028?T\315"
+	.ascii	"\224\360\020M\t\213\277]\244)$*\031\030\223\240\373,\021IY:\030"
+	.ascii	"\217\350\332:0\031\355`0\"W4F|\031a\241\372\342-\377b\021=\341"
+	.ascii	"R\331\365\333k)\361\300\312U\256\277\005\243\266\256\216r\225"
+	.ascii	"\027\305n\n\017%\254\302\312\353\303\205\274\346\276\007\024"
+	.ascii	"\213\243\337r\301\250\255+\0220\026v\231\272\032W_\256\306"
+	.string	"k\366T\270\376zh\254\201\306{\212\003xPv\0040\007t\003`\031\t\351\315x\003z3\343\023\023g\366- #\206\344L\351\314x\313\317\270\232;\031\3579\"c\241Q6\236\360.\305Lx&,\232\313MFVAlb\\\317\345\3710Q\364\212\361\236K4\306\330u~\334f\250a\f\007s%%e\244F\016\300\002\031\242\0327\021\220\b\347\220\022$\022\210\210\314\211<\336\001a\361\307\375C\203OSaqtH\241\246\323\003\001%\\\355d\365\372\006>\356b\311}\033\365\2063\025\t\275\266\211\263\361E4}-\231\036F\036\256\2358OA\225\247k\356\033\335w\234\357\354\377C\234\324)\361\252Q\341\n\367\271\316{\360\037\036n\272J\035\211\243\2158+\255q\0079\251\256H\006\251\337\326O\253g\353\346I\265$\013\006\2472\353r\372\327\203s\n\025\301}\003(X\246\241\013\r\003\002\240:"
+	.ascii	"\266\243\307\213a:W\344\225\220\f\206\020\3336\271\027\004\r"
+	.ascii	"\177\027\2704\334\272\324"
+	.text
+	.section	.gnu.lto_.refs.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375 \373U\005"
+	.string	"\362\f#&\220'I\007\377\277\367\357\356\356\356\356\356n\357W\035\341\243f\214\264\021!b\t;\354n\266\265\326\332&m\223-So\317\006\335y\372\300\363\315\372\225\217\370\250;\251\240\033\235\240_c\002\335z@\237a\365\027\372\n\253'"
+	.string	"<\302\352\007\330\233\305+\245\247V%\212\276\262\253\374\314g\354\021\364\207\020\370!\373qv:\333\260\267\2341\356C\371\204M\320\bGz\002\177\301?\360tg\326\027\352\352le=Q_\254[?\375\r\001\n"
+	.ascii	"9\003\332jpS\242t\rW\020\002\223\363p\322\026@X.e\031\303\252"
+	.ascii	"\236"
+	.text
+	.section	.gnu.lto_.decls.bb25f15179b65d7f,"e",@progbits
+	.string	"(\265/\375`33\005\332"
+	.string	"\312I\321IU HIK\035SH3\303\371wN\221DS"
+	.ascii	"S\244\201"
+	.string	"\215\b3\270\315*=\031Q\227\005\320\311G\013Tb &\013`?\346\330\302\353'\3449@\212\243\366\275S2Aq\344\277\310.\212,\277Iq\212$\334\227\005\300\372\351\332\037\006B\234F C\312$S\013\004o\004\265\004/\343k\274\324\323\370\250\207z\030\377\342\236}\214/\362\177\276\221\347T\367~B\231r\013\221T\001\3611\356\225\213v\261R\034\374(\004\201\370\316\007\212\240$\244\236\b:\271~XHT\0179S\022d\3621\256\341\265r\261j\n\2003\024$s\277\2001n\340\315^\254TuCa\320K\252\242{)\324\333\203\n@\376'\036Ldcc\332\351\233\256lM\255g\362o\362'0{?\200\357Z\370\262~\366)\277\224\313\276\244n|~\244\207\336\263\t>\311_\351\2729\213\263\272\253\237\343\312\332\331\347\347\241\375NP\304\211\211w\202\242c\034:W\325\360\f\3477\213jB"
+	.string	"\377\252\231G\337[\327\347\263\3377\321\335s\212A\364\264\222|v\234\244\035;\265?\241\316_kXP\016o\225)\276\261$@\355\337\247_|"
+	.string	"y!\361\363%\274T\262\3314FfI\212\215\274:\355\037\247\375\325\264\377\230\366\347\3224Y\372\t\265\313,\3603v\006\006qL\317\352\263\377\224\346\360O\332\337\251\375N\321\367\205\313w\317tn\237_\275K\304]\236\325mu\341\223B\245\006\250\375\352\024g\256N\321\357\022\235\357M\261\002l\365\336\024\361X\254I\006\361\360\320^\357\216\251\350N'\306\220\257H\354\363\275\3761\031q}\366\253\266\346\027\244\354/mH\023\267\267\273\013\342\354\210\260-Ir\353\256\335Er\215\\\272{\344\316\335\263{\275r~\253{{\b\270\213&\203\367\256RB\335\273\352\267\315\035\204\273\005!\356\365\026\271h\017\024\355]E\265\301,\221m\256p\357j\001r\nP"
+	.ascii	"\027$R<\250\330d\277W\332\257\f\355\327I\373E\3224-t\016Rs@\241"
+	.ascii	"u\"\240+\270\032\212\267z\205\3343\b\256\325-\b\341\270i\266"
+	.ascii	"\311\366\256\316\304 \372@<\374\354(h\030\036w3w\340j\207\360"
+	.ascii	"\031\355\027\202\342M\274\020\024\375\265\006WC\361\222A\200"
+	.ascii	"\241"
+	.string	"L\323\255\266w\265f\246\032\325d\343\263W\257\206\242\2767\305\275\033\200\243\005\340\rK\256\222W!\200\215\257\373\245\373\024\035\336\220\205\254\373E{\240o\335\337g\350\231\270\337\244\247\300=\202j\370\tx\003\356x\205\026\247\253gG\214;\226\200_wl\002\237\260?\361\202,\f\356\230\001\356\267\207\004\036\030\301\375#\340~\231@\3409<\300\375n\340~w\334/\r\367;\365*\270\337\003\270\273\365Sp\177\035\007\270\377\207\023R\n\004\360\204\356_\002\001\356\370\002\367\253\343-\360$j\334\237\320\263;\336Y\3616\356O\302\217\340/\356\330\203\373\213\360\036\260\360d\343\021\370@\367k\374\004\270_)\337AR\3527\3568\002\367+\302-s\277@\236\203\023\256\301\375\321\334\257\333#\300\375\036y\236\213\374\r\334}\316\375\216\360\032\270\373\004\376\200\343\270\377\222w\377\"\356\367\357\017\340~\263\237\201\273\270c"
+	.string	"\270\177\b\367\277\300\375A\270\377\216\373\023\300\375;\270\177\216\373\343\270\377\215\373k\367;\350~\005\335\257\023\367\313\347~\367\334o\236\373]\342~\357\334o\235\373\275\272\3377\367\233\346~\253\356w\314\375\372p\277J\3567\314\375\202\271_\036\356\267\313\375\356p\277[\356\027\207\373\315\200\373\315r\277X\356\327\312\375\326p\277T\356W\206\373\275\200\373\215\341~a\270\337\025\356W\352~\237\334o\223\373]r\277N\367\273\335/\006\334/\013\356w\351~\223\356w\310\375\036\335/\220\373\375q\277(\334/\007\356\336\347~9\270_\n\270\373\235\373\225\200\373}\200\273\037\272\337\031\367\353"
+	.ascii	"\367{\202\3735\301\375.\300\375\222\340~G\270\373\t\367\373\201"
+	.ascii	"\373\365\300\375v\340~;\270\337\001\270_\t\334\335\204\273\343"
+	.ascii	"\271\273\0222wO\301\335\355\334\335\201\304"
+	.string	"\304\304D\367\026\252\273\013\005\356\002\030\021\2059H\020,\0315tN\322\323\223\007;+%\346\202\255\242C\362\331_\216t\316\225\247\311q\323\347\351}\337n\270U\201\030\342'^\302O\254\244\201\217\007\033\341%l\204\225\234\306\271wY1\256\nc\203\n\305\t\0379V\302Iy\313\350\206\335g\fma\342Z\333v\030\211\255\330\244\207\025\322gw\371\241\335\005J\327|\3618vb\347\343\345\352\226bX\213jDD\274\021?\017\347\205D\274\023?\257\001\260\375\242\225C\353\371\247]\277\031\276\025\303?\244Vy+U\3760\303\335\264\250v\025\"\344\363\341\327\271x}a1\271\240]G\351)O8e\003\037\017\225'\244\362Y\335\334\273Y\335O9F\242R:-C\370\220\340>\2736\322\336\022\250k\264x\036\312})R\376*gmW=x\013V\373\375\253\242;q\362\331\342\336\267:}\212\346\360"
+	.ascii	"|A\300\317\376\236\356-%\370O\374\2631/\236vD>\177\340\257\305"
+	.ascii	"$VI\364+\214\270\261\2736\355-^\272\006\313\363}\367\233\334"
+	.ascii	"\263o\342W\022D\300j\022\334Q)\017,MVj\350\220\241\277\246\216"
+	.ascii	"\347\372\270\317\307w\3610t;\255t\274\252t\036f\306\316\360\f"
+	.ascii	"?{\213\221\306p<\376{g\277\367Jr\323lC)\003\227\020\013\367\226"
+	.ascii	"\362\360\206\331A\274\254\316y\342\371%\217u&\237w}HEu\334}\212"
+	.ascii	"\177\036K^\017.\"H\264\027\2673\272\367\206b\251\356h\021L\361"
+	.ascii	"\262\334\253\343\036s\361\225`cw\207\240\001\325\335\004\354"
+	.ascii	"1\250\277\336\23448l\026l\024j\275j~p%}^\305\200Z\257v\363\311"
+	.ascii	"\325\254\211\356\253&\324\272w\315~>\233\n\230\356\032\250uK"
+	.ascii	"\267Q\236\364\356\352Us?\247\273f?\267\223\003\364y%\205Z\235"
+	.ascii	"\322\032\250\365J\272\255W\233f?\235\321\244\347\216\326l\353"
+	.ascii	"\025\224m\235Ji\240\326\251\024j\275\232\272\201P)V\244}=\260"
+	.ascii	"\334\256\024\372\334NMS\316(\r\026Z\235n\277\275\257\332\321"
+	.ascii	"\216J\260\367\3244\352\347\214q\341\212\260NEm\316\351m\240\251"
+	.ascii	"\bk\272\237Xh\217\351\336=\212T\354&\f\232U\354\336\272\330\246"
+	.ascii	"\215\251\315t\264\267\003M{7\357\306\356\275\233{\357\226\350"
+	.ascii	"Tu\357\0314PjS\323\336R9M{\252\031w\264\367\253\375\301I\241"
+	.ascii	"V\254)\210\2704+u#U\233\227\272\375\256\242\332\332\024\262\231"
+	.ascii	"\244h\252\324E\224\3176\376\256\270\267\025\367\207\245\337n"
+	.ascii	"\356JZ\021J\177\335?\335'\361\257\3739\230\347\327\345\275\235"
+	.ascii	"\367v\220\271\267\003\313u\207\363\214\t\211_\307^\334\320\341"
+	.ascii	"\022w\b\006\343\363\313\275\021\377#\037\267\377\b\006\323\275"
+	.ascii	"\235\177d\306\312\336\316\231{;\334\333!\377\300\352\"R\314^"
+	.ascii	"D\3225n<\376og\377\366i.\320\275\2418xM\263R\205;\032\365\340"
+	.ascii	",p_\204\312\322\224\2711\335\346\327'r\267\346\232[\237\235\345"
+	.ascii	"kM\r+\001\031|\373\\%\203yz\3121\035\222\026\206mK\373\354o}"
+	.ascii	"\264\213V\201\235\003\301\270\222>\323\354\253\241\370\373\336"
+	.ascii	"\024\337\f\204\377\331M1*U\235\201QR\362\032\374|\023_"
+	.ascii	"\310s\345\2534\020\312W\277\314\315\207\330\330g/s\277\237F7"
+	.ascii	"\024_\200{\336\005\0012#\n\225\220\317d\305\272\250`\337gg\231"
+	.ascii	"j\037/\366.<\330\377\370\260{\366c\317\303\377\3532\361\fb\354"
+	.ascii	"^"
+	.string	"y\352[\021\236\340\337\350\361G\305\241u\321p\225\3322\004\253\311\217\275\327/\341*\234F:\273\023\374\255\026.\232L\223f\027\351\371Q\307>\307nB\301`L\360\217\2323\303G\250V'\223=\013j\230{S\364|\247=\303}\327\265\016\331\312>\364\353\370\035\367\354\271v\f\206,85\347g\026-~-z\306\241=\303\320\256\206\021\265\303\321}\226\215\263$?\234o\303\2613\352\356\r\353\352fE\005f\257\334J\306\2113\311\356\3634\007\037\32115\007EC\211r\375d\\\366\276J$\362\267D\326\204\211\272w\375d\2364\373\211\325D%2h\005\373G\037}:{\002\024\274Y\r\216\242.KzP(R\256\037\031\342\214\237z\252\257z\027/\rXy\313D\365\217*\346A\330\036\232\226\347\255\307\323C\264|\364}\31662\016\226/\301\2547\034\371\0066I\324\025Y\003jI\2449\353y"
+	.ascii	" \020Z\244\246I\333\b\346\031yF\266\272\302\265\314UcL\311S\317"
+	.ascii	"V@\302\314\342>\347\032O\205y\201\207\350\3669W\275\333\376\361"
+	.ascii	"c\357s\246\372\250\323\031\326\322\347<u\375\374(\016\016\306"
+	.ascii	"\347L\343ZI@\223(\225B\037\313\253\342\207\250m\226d\251,\305"
+	.ascii	"\306\304e\353*\227\226\3256\321\f#\303\310Q_B\262/\330\356\276"
+	.ascii	"\242\250 \251\262\222\2473\034\361(yv\312J\331\005\216\242\245"
+	.ascii	"\246M(\035\\\253\304\024\231\341c\372\344\331\205g(\013B`D\247"
+	.ascii	"\353\025\225\317Y*#u''\030\315F_Y\326\260\317N\2016\213\222J"
+	.ascii	"s\023\206 \327#\275\317\231\3111\341\r'l\336\022\024\035Q-\334"
+	.ascii	"i\247A\2423P\361Pq\\\205J\206b=\230\3354\333O-l?\260\020\013"
+	.ascii	"7TJGf){\225\225\233\236\241\236\221,\b\341\201\310\033ii\237"
+	.ascii	"\363\221\337-)i\320g6\362\002lC\f\323\271\210\002\252*VV\234"
+	.ascii	"Zy;\300>\177\336\036\330$\007\226\350\3316!ZS\210\030\017K\257"
+	.ascii	"\3503>\304V\356\231\333\341+.#\207\264fG\325\236\201\353vE\\"
+	.ascii	"\350\330P\256*\353JK\273cBw\227\026\"|4\250X\332i\246\264\206"
+	.ascii	"\255(Q\360`\\\366\005\313\022\224S\224\024\307\203ze|~"
+	.string	"\327\017\357\311J\225\317N\223\2445\260\005\006b\301\234i\023\n\007>\260\371n\032\247\224u,\210\213\344#Ery\237\361\223_\332\353#\323z\267\"L\322\212\fj\r?\374\374\260\2230/B1\231&\340\222\215?\307Nr\023\243$\027M\370\376\016\261M\330Z\214\252$\261\036\3217I\370\370\360\216\f^2Q\210PKf\272&qo\017\3479~\356*?\352\224\353\n\207\245k\2360a\202\363\212E\244\331\0272m_PY\237=\317\214pm&I\333h-Y\362y\007\260\"\024\023+;\324\253\272j\233.;;|\2273\007\367G\305q-$VQ\342\370\356\345\006\215&\031.\342\202\245BE\rM\337\b\316\315\341:\254\302*:\f~nhZt\216\353b\340\242Zp\333\322\031\n\343\342\360\265\202\273\221\322\316\234\b\026\357\260\222\330\2168\276\372\301d\351\351\3002\002Sm\356'F\344\\\242"
+	.ascii	":y\312\024\321\240\342\210\2413\320\251\271\032~\313\231b=\300"
+	.ascii	"*:1}\344I\206\303\315\361[\314\rC9\252\317\230\b.\362\3624\205"
+	.ascii	"\357\253\bn\243s\262\3131\3353\330\216\324a\266/\202\251\312"
+	.ascii	"\232\321\367\031\257\311@\265\006'33\234v\315\254\262/\nc\370"
+	.ascii	"\242,MAs\234&S\006W\005\373\031[\177\355o\354\270\021\366\031"
+	.ascii	"\237\351l)]Ac\016u\006 <@\200\340j\316\024g\205d_\210\355-\245"
+	.ascii	"3"
+	.string	"3\306\004n\257\314q\365\342\2650a{\016\342 )\354\345\250\022\344\372\351\265'\330%7\375M\036\307cc\333)\325\251\223:\371Q\263\003\033F\245Y\216x\034\373\360\361u\271L:&\006\002.\n\375\3541I\272\306\212\307qX\330\263\025q\260d-y22\250q\212z8\356\201\301~o\272/1\301\354\225\272.\260\230<\250&\033\211\306\251\362r/\314\303ivU\361\253:su\305l\311g\036:H\362\020\201\b\32189\2720\265\353\017u\263H5\206w#\253C\343\270\200s\340\034x\307\224\"\fl\013\f<):\254\303\361\216o3R#\254\016F\t\312H\325g\207\211\241q\214lm%\276x\371IQ!j\234$8p\374\241\241\340\224N\004X$\304>\215\003\230\225\365\207\032j\310\354\200\316)!\3218\204XX\r\320\020\264\2660GE\323,P<\216\255\254\256\337\007jS'\324"
+	.ascii	"\312\254\306\304\n\367\246\363\200!H\340\223\354\263c\230\241"
+	.ascii	"k\242x\034\3278\3035.\332\255\356\247\027$\352\013\241\236\t"
+	.ascii	"\343qL\203\006\246\372@m\272\2418\360\202\233\362\220"
+	.string	"\325f \021\342\251\233V=;\362\271j\315 \025\346\024\250q\020e8\226\361\207zg\230\202\200+\271j\022\275\201\f\307\3001:@k\023\274<\214X\215\244\351\rf.\\`\030*\024\301\364\244\210\275p\f\303\257\227\260\307`\013Hf\302\016\227\370\304tM\037\217c\251\324\257\371Y\335\322\f^\330\254T)\216@\310\244\b\231\266\347E\005\323(\264\203L\n\t%}\034@\036\215J\346\022\231\364qa\"\2178\310\210T\022%\027\320\342\307\330\242\260$\321\"\217B\312\226\331\376d@\266CI\031\231\021'\210\260$\321*\211\2062\262\rR2\227EW\361\201\271\334i\177\210\202|\220\307\035\345\222h\007'(\210\b\211L\"[\230=\255\005\216\313\"\013I\245\nf\022\331\002dl\203r\213!\037\241V\250\310<\n\t%E\330\374\264?\310#P\206\037 \022Kc\033\324\242\020\201\017\262\305\022\204\232"
+	.string	"\214\320@\317\320Rh\3312\215>\311\240 \020\206\226B8&|fZ0\207\204D`\036\205\226H\243\362\204\211\345\021"
+	.ascii	"m\253\034\301\342D\215\314N\362\270\004R\261"
+	.string	"4\006\001\335\270\212\017%\234 ab\207\303\n>\312\244\210\231\237\226i\\qd\372\200\2604\252\240<\032o\230m\212\037\"\025\313#\262\r\032jQP\266(\204\210\032\220\"Y\002\263\035!(\210h\304\017R\204\f)\222%\264J\343P\253,\221\"Y\002\362\230\242\r\341'\204\345\221&(\b\204viT\212\340*>\374\034\207v\230*R\034\203\200rZ\241d\t?\307\022\3146\205\322\310\2541*[&\te[b\3312[\204\240lY\030M\220`\351b\303D\036\225%b\230H\242\244\be\013\224\203l\207N\350Y\0221\215L\023\020p0\016\231X\241\234\240\3042\031$\"\307G\231\034\241bI\0244\"\002\032\230\n>0\225\306\241\017\np`\203P\313\\\2660\241\201yT\252\300l\227-\n9\356sT\266\3106\205v\f2\240 \003\rX\264\270\006<\025\360TPt\rx@\200\340\311"
+	.ascii	"\204\366\f@\340\266'\005\362\2504\2520\301\fJ&C\350aQ\032U\370"
+	.ascii	"d\227\240\0252*G\334\264=#2\2640m\222\307\r-\224\314V\250\rj"
+	.ascii	"\231"
+	.string	"\033lVX\032M\360A\022\001\301\264=$p\206\226B\313\241\0245,\332\037$\211\226iT\366\3400{v\226\312v\305Q\371\363\200\222Y\242]ql}Z\024r\230=\031\200X\301\307\210\"(\310(\202\205\362e\331\003\223\002S\231,\021d<*\333%M\033\204\302xbEQ\331\036\201\216Ld\373s|a\232\360\222\231='0\225\311\241\230%2yd\016%[Z\246\021\205\037\"#\n\335Z\340hB3\265\022\346\307\330\222\300\354\261\340\002\035t4\236P\266@@D!\260`\302\270\212\017\021xr\250U\3560\223I\345\016\206eO\212#\0202)\202F\210\b\251\205\222\310\366\247\247e\032\225/\255\317qE\373Sd.[f\2172\311L\n\365 \2231>>\306\236\037e\322\247U\276 \223\307\345\262U\016\t%}0\2640{4`\"\217D-\236\001P{\301\005!,"
+	.ascii	"\361a\203o\260\201\b\016\016h\300\b\332\347C\362\330\303\"\211"
+	.ascii	"b\005\037c\020\212\035\344\321(\264\343\243\\\356|\350\320\006"
+	.ascii	"\035\201\222\312\241\236\366')\004\323\344\356%\353\211\022\252"
+	.ascii	"_\235\341\365\205a_\232\006b$\312\223\357\0053\244\030.>\253"
+	.ascii	"\265,u9\363>70]\222\367\362\222\254\347\322|\211\n\\B\314zyr"
+	.ascii	"T\233+/3)\321gT\210}\273\027\243\304\303)\354\225+B\215\001\326"
+	.ascii	"\300\303J\206\322*wl]N]S>+\301`/W\270\360\n\355r\024\314\216"
+	.ascii	"\037\206\322$8\317\245*Ko\254.[\335\"0k\027\035\246\202\251\332"
+	.ascii	"2\342\233{<\261#Q\271\214$o\351\255\263\037\326|\315]C\n\313"
+	.ascii	"d|\316F0\004\346\210\263y\221\345r\234\344\266\034\227\3332\334"
+	.ascii	"\215F\243\030\240,\257+J\341\226z\241\343\236\337<\303\035\001"
+	.ascii	"\016\346}\316n~\325\207keE\374\332b\207\207U#\313\266c3Q=\211"
+	.ascii	"\374a\bQ\230\262\362Zv\001\367T\226\226\207\310\340\365\361\371"
+	.ascii	"9\321\356\031\315s\332L\224(+\032\237\363Y\266\206Q\2114y\017"
+	.ascii	"|\362\005(\027\344s\026\222\315f\264\250kF<\353\202\321\302\036"
+	.ascii	"\205\177\325\fmq\032;\274Q\366yk2\264\260\202\ff+\240\341\025"
+	.ascii	" \325\0312\260\262*\262\267\254\326\006\203p\f_\245\256p\335"
+	.ascii	"\375\310\2768I\222;\222}(i\223r\323\361Y\314\211\tUpRr\230\240"
+	.ascii	"\036\225\237\214\3176V``\237\227\343%$F\256\310\224/:mS\375\372"
+	.ascii	"\2721\342\\`\262\246m\342\274\2740\330e\363\312\276(|a\242\233"
+	.string	">\303\364MY\316\221s\344.\266,\031\2021-\300\340B\322\341\271+s\021.\305\361q\355\310J\332\226^\310B\254\313^\351\233\032X\001\204\204\250\323\202\363\211|4\345\230b\f\315\310\314$I\032\003#\025@@HP,\232Oh\367\023\300\321I\004\232\032\207\025R$\"\"\n\223\202\244\320\032\256\004T\307\312\001\351\031\322>\005\340\361RM;\250\205\036\001\361<<=\360t\304\212S\023Hs\270\345\225\205g\032Km\233\313\223\366\035\341\374\315y\324h\363x\306\3000\b\322|\275%\316%\"_\016\206\255\251\337\322gX\025\271\202\235\255\350\261\331l5\343.\026\026%\361f\035\303ga \216\350\321\344N\310\253\313\200B\211AxC\277*M\224#G\277\327\261\313\366FC\336\202\240\263\214\214!\362\t\245\252\006ab\007\006\272{\363k\315\0264'\224\305\037\235-\261[\352h\304\260\220\310e\277"
+	.ascii	"\320\236B\303\220[\006\274Wt\"\242\354\270\241\025@\202\302\001"
+	.ascii	"55^\203f6[Z\266\034K\027W8\372\t\250Mk\022\211C\276\235`N&\177"
+	.ascii	"\266Z>\351\201\224PAQ\205\177\241\207\236"
+	.string	"\231m\265\220\235\270(*\204\3151\274Vl\0016\233\261E/r6\256\310^x\\br\345\346u\207\302\n\313jv\365\332l\016\362(h\256e\006G\022\032A\336I\016\343\355\017\227f\341\250\346\030\002\233\371\304Q>n\271\326\251F\214\257\b\013&\3076\322\206_\266\370\346%%\341\006&\352\2035A\333\317@\027>\032\241t!\205\254|\265\362J\2550\323[\005FF,\330\253F;\311\033\"<\025\343\006\215\f\232\314\230o\007\234\273\026?H\006\341\336H\001\230j\306\"%\301N\355rg\021ZG&\243\371\227\226\250\270\364\303s!\027\342\360|H\311~\301\321\213V\361\347Y-\242\337\037\371\305\204]\330\375O\324@\312\255H\210\356\001F{-\n\033q\225\334\330\215\032&\355<r[\271\205\020\302\376\261P:x\273\245kh\222Wm^\213y=\222\253\t\305\352i\003U\350\002\332)cz\365"
+	.ascii	"\252\200\030\242\300\311\223\0205\323f\017\020\313GD\247nXG>"
+	.ascii	"\202\026\267%f\341\313\352\314\033\357\027~A\034\356\306\230"
+	.ascii	"\232\316*\225\323S\036\230%jh\242\217K\366M\326u\216 v\n\037"
+	.ascii	"\347g\254\232U\355\021\255\362\372$"
+	.string	"\027r\0209Y\036\003}\312`\321)\242u\003\273y\353V\352M\031\343\237\206\343\366\203\016=\334\212\276nw\266\240f2\263\222\201>Vdrd\305om;\336\347\230B4d\003\031P\312\244\032\265\234{\231h\r\217\373.#b\207\021\f\326\204\254\266\004V\031\364f\262|\240\215\275w\267\2643\037\256\333\202\300UV\"h\017l\236K\022\361\244\270\025{^\002\3168\330$KE\0053\203\\\364(9H\232\004\034O\037\213}\344L\204\205\333\025\236\375fJ\003\r.\335y?\213\327oE\362F\304\f\252R\032nz\265@\240[\234\2255G.\367\205\253W\247\315;z:\252\305\313\352\002\313;\346\346\310\306\345\247\260\263\007\007y\034\207\355\027Y\351z\212\247r\r\202\256\311\013\007\203h\250\221\270E\024&\364\333+e\320^\241\033\004\030\006%\372\177I.\337\317\036fq3Z<\363*t\031\005N"
+	.ascii	"\321\006\203\"&Y\004\352\216-\211\335\337\306\270\245Gv\366\340"
+	.ascii	"HH\223%\215\205\264\007B{\3172\240\034\311\241\237\264\314\245"
+	.ascii	"\023\366\3159\021\362\201\326q\310\207\204\332\327\342\274-\371"
+	.ascii	"\035UKX\217I\200\333\251\313\225\304\021g=\266\024\035\356l3"
+	.ascii	"\036n\320\323=\236\331\265?c{\003\226\340\206\265\027,\332LK"
+	.ascii	"XNq"
+	.string	"\361\020\324\356\302\2168\035 U\321z%\233-&\355F\301E0\312\314R\313|\376\023\246\317\250d\3125t\302\035\261\003\235\213s\007\267\355\344\316\233>\242r\254_V\243\rF\243z\332\270\247#Z\304\035N'\026y=*\206h\303\317\253\207\266%\222M\210\341\232X\2077\3212;\262\221\256\361t\031\303\303FJ\2763R\307\"+\362\033\230\323\231Ax\035#\340\235\031Q\357\313\037\036e\036\302aRn\311w\365\3554\002\203\030\310k\327@\367\b\341\200\221\216 3\001\311*\315\032t\357\220\002\255\020\030|\b\325\025d\312\030G\237I\216C\306oQE\205\274a,\260\211s\352\274XJ\331\304&\261yg\345k\373F9\"CT\232jkR\345\221'6y\200L\341\317mR>\364\021\234VL#k\231\022E\177\241\2341a\nM\335\323\333<\315\245\030&\365\2728hVF1\351#\224\253<"
+	.ascii	"M\250X0M\rq\313W\022\355\025\226dF\"\260\332\367A\360+\\\376"
+	.ascii	"z\350\3579\320\335~<uBK-\037\265\206\035|"
+	.string	"\016\377\301Q\325q\247HO\033\321\350\241-\211\260Q\206'\330\222\001\332Dn\353\"T\030\264\216\271H\333\005\230E\032m\rH\356i\221\322\022\034paU2\343n\305\226\257Nd/@\201\013\343\355\227zr\346\273\227\255\243\361[\2072\223\372\356\026\251\254\272\225\235\343x\371D\371\230S.\026\226-\n\354H6\343\025\311:\002T\337J\315\225\233\305n\341\022\030\035\327\257#\314\2273\244\013\274\017\377\206\304\027\262\337\251\303j\270b\335\371\240\tJ\030\263\332\006\277\370\234JWJ~\r<Hc\303cp\213l\274w5\266\340\003\\\264R\007N\313N\224P=\336\001r\325\202\325oJ\346\n*%\227\341\375\221qgt4\300\213\3379"
+	.string	"\311\346^y2\372Y\013O:s\361c\2436Y\003J\250\222[\3270I\232\313\273aX\373\005\355!\217\016\323\016\220e\356\232laN\023\226\277\201F\275\343\177\340[\007\216\336 |u;\246\016\342I\331\227my\332\207\267\223\026\301\310\254\226\260q\351\027m\334\306"
+	.string	"\b\347u\036\036\234>W\005L\251\313\201\367\230\326\023\361\316^\025S\375\304\347vw\022\361\013\236"
+	.string	"1\273\331W\366\207U\341\275\036Y\312sXE\326\320\333\251m\232\313k;\255\013\305u)\240\256\226\017\220_\027\005\351\260\356b\213\207\201T\351\342h[\266\243q\337z\270\262\031\367\306\270b\317\242U\354o\007\216\r\"\363\245\002\335\274\336\201\252\007+\211\335\353\034\242\223'\020\324\332\212]\271vm\307\374\231\003f\357s\306\233@\263\270\2475\324\233\"\372\365\2708\317\2236\177{\361\330\314\321\222<P;j\321\322\332\005\225\225\2564hg\311U\374Hu\331\264\210{O(\021\024Q\032\332\243D\241\312'\004Lf\263\007\021G,\2738\314\316:\347\364e\245j\314\336\b\214\033F\367\314\212Obj\303W\251,\036:\230\030\320+\337\363\242\340\220\023z\320V\243\323\217K\322"
+	.string	"\033"
+	.string	"Z\316\311\207\340{N\240\277\312\260\247\020\377\004\301\357i=\353\356\020\371\257\306\214\337\266\213\351\255;\362\037\334\220"
+	.ascii	"\215\251RkUiH\261\235D\007\367\017\326\221\031\021\304\351\213"
+	.ascii	"\274L\246\330\372/1;\334\rZ>w\326\035\t\350\307}N\002\345\232"
+	.ascii	"\024\355\321\320\253\325~\362D\323\271\226~\260\025\017\303\377"
+	.ascii	"\217\363+\361'\347_\263\243\335xn\261\373p\377\235G\315\336\276"
+	.ascii	"\353g\246\027P\266\027\220\231|g\273\233=\337E\243Y\b\274\376"
+	.ascii	"\231\036\364\352w_\253\327!;\303\346\365\235\022?\363{iv\337"
+	.ascii	"\310-\335\304\3306\216u\362\323&\210\271\231\331\375v\324\r\326"
+	.ascii	"\035\306\311iN\227Q\365O\211\r\367\020\330\006\272{\337\272\321"
+	.ascii	"\231\036\236\261\205\260)H\246\201\270|\375\354V\235#\303\227"
+	.ascii	"y'\360\003z\227\022\346$\352wVO\322\277v\232?\315\341\305/\336"
+	.ascii	"\034\332\214\013\235\2112\346\3719\355\305gs\342f\003{ \337\337"
+	.ascii	"\003\376;\355\332\207\327\357\333\307\354=\375\327\347\320\325"
+	.ascii	"\252\307\337\036\316\233\336\325\335\355\036h<\016\333\214\366"
+	.ascii	"\353>.9=s\317\254\227&{\007\206\277\032\307@]*n\022\273\357|"
+	.ascii	"\255\243\037t\201\271\322\366Fx\r\303\246\376J\272a[\257\232"
+	.ascii	"\332F\267w\257S\262}\363\317l>\201?\020\312e%\243\272g\257\336"
+	.ascii	"\035G\237y\335\321-\344\0304\265\233e\327\2720\361\262\237/\224"
+	.ascii	"\235\261\234\343\34238\246\243}\253\255\234\344\315\332\322\255"
+	.ascii	"\326U\211a\356\237Z\254-fi\374\244\370\336\363\315t\037\025S"
+	.ascii	"\225\360\325\241\215\356\306\313Q\277\024\030\260:\362\354\352"
+	.ascii	"<|.\001"
+	.text
+	.section	.gnu.lto_.symtab.bb25f15179b65d7f,"e",@progbits
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"blackboxWriteBufferSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"blackboxFlushWriteBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"blackboxWriteBufferCount"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"blackboxPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"isBlackboxErased"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"blackboxDevicePrepareLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"flashfsWriteReserve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"flashfsWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"flashfsGetWriteBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"flashfsGetWriteBufferFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"flashfsFlushAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"flashfsWriteCommit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"flashfsIsEOF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"flashfsEraseAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"flashfsJournalTail"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bb25f15179b65d7f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
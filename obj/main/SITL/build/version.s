@@ -0,0 +1,2509 @@
+	.file	"version.c"
+	.file 1 "./src/main/build/version.h"
+	.file 2 "./src/main/build/version.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	version.c.74fbb473
+	.weak	version.c.74fbb473
+version.c.74fbb473:
+	.long	0x76
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x4
+	.long	.LASF410
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.long	.LASF406
+	.byte	0x1d
+	.long	0x32
+	.uleb128 0x5
+	.byte	0x8
+	.long	0x3e
+	.uleb128 0x3
+	.long	0x2c
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF411
+	.uleb128 0x3
+	.long	0x37
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0x20
+	.long	0x32
+	.uleb128 0x1
+	.long	.LASF408
+	.byte	0x23
+	.long	0x32
+	.uleb128 0x1
+	.long	.LASF409
+	.byte	0x26
+	.long	0x32
+	.uleb128 0x2
+	.long	0x22
+	.byte	0x14
+	.uleb128 0x2
+	.long	0x43
+	.byte	0x15
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0x16
+	.uleb128 0x2
+	.long	0x57
+	.byte	0x17
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 3 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.cda5e1a8f37a08b4f46fc428ef372810,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x3
+	.long	.LASF1
+	.long	.LASF412
+	.long	.LASF413
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4
+	.long	.LASF0
+	.byte	0
+	.long	.LASF414
+	.byte	0x1
+	.long	.LASF415
+	.byte	0x1
+	.long	.LASF416
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF404:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF392:
+	.string	"__REVISION__ \"780bc8c\""
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF409:
+	.string	"buildTime"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF389:
+	.string	"SITL 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF408:
+	.string	"buildDate"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF379:
+	.string	"linux 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF400:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF401:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF411:
+	.string	"char"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF29:
+	.string	"_LP64 1"
+.LASF402:
+	.string	"MW_VERSION 231"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"shortGitRevision"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF410:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF396:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF377:
+	.string	"__linux 1"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF398:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF403:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF405:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF395:
+	.string	"FC_FIRMWARE_NAME \"Cleanflight\""
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF380:
+	.string	"__unix 1"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF364:
+	.string	"__k8 1"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF406:
+	.string	"targetName"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF378:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF399:
+	.string	"STR_HELPER(x) #x"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF355:
+	.string	"__amd64 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF397:
+	.string	"FC_VERSION_MINOR 1"
+.LASF382:
+	.string	"unix 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF412:
+	.string	"src/main/build"
+.LASF416:
+	.string	"stdc-predef.h"
+.LASF414:
+	.string	"version.h"
+.LASF0:
+	.string	"./src/main/build/version.c"
+.LASF415:
+	.string	"version.c"
+.LASF413:
+	.string	"/usr/include"
+	.text
+	.section	.gnu.lto_.profile.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\323\373\203\270\004\001\205\307\277\326\t\002\233\253\345\277\b\003\353\221\235\221\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.178b48d4205232db,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_shortGitRevision.1.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 T\241\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\233\336\350\362\t}\273\001"
+	.string	""
+	.string	"\b780bc8c"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.2.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\360\202\t}\273\001"
+	.string	""
+	.string	"\fOct 18 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.3.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\370\202\t}\273\001"
+	.string	""
+	.string	"\t04:51:58"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001\002\001\001\002"
+	.string	"\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.178b48d4205232db,"e",@progbits
+	.string	"(\265/\375`\360\0025\025"
+	.string	"v\346\213I\3000\2511\370\233\005\021\024\0224\217%t\377\213\f\222\346\352w\036?\306j\372{bO\023\364{\272\337\320c\243\317\320"
+	.string	"\32201\023\242:OS\2518Y\212\017B\221\325\321\216\017\177\375\214\217u|0\255\263\267\225Z\246\024c"
+	.string	"|"
+	.string	"x"
+	.string	"<\325\276\351N\376\360\251\031\230\330c\203\323\025\336{?,\t\272\267\346\303\232\216{kj\177\310\037b[\224@a4\255SN\032\211\277d\264\353\232\230v:\275\315<\217\232\256\247\355\245\355.\020\266\223\266\265tlc\331\276\262]\355\363\330\256\262m\264]\264M\264\235e\333\206\205\205\205\331f\261\rdW\260\227\303\275\227"
+	.string	"-J\353I\250Z\005\267\231\261\243\346c\340|(\324\314\361Io\321\006\277B\034Uk\217\2321Fc\221M\032\036\301\252\265\206\223W,\236x\220{\203F)>\202i\362\250Zc8\177$O\372\225\230\256t\"\356\336 \321LiED\002\2739H\021\323\3505T\223\316|n\240\226\252\265\377d_x\027\177\341q\203\023t\213\367\246 5\245\035!\242\264&\233\312\261\"\326O\332G^K"
+	.string	"\320Q\320D\265\346\272\315\244\321\300\371Y\261\237,\022C\325\316\216\232\366g`I\320Qa\243Z\037\253\370\261\243\350\303V\265\267\302\371W\007\240dLU\013\340\250\231#9\325_Uu\2749H\221sG\211\244\254\326\027q\372S\247Z\351aq\257\315=\310v\244\313#\325q\346ED\302\250\366\307\323\3468\t\026\334\0202U\353\037\355G]\352\303\t7:^\256\005\250\213\361\345\200\001\314\342\262\002!\266\243\321="
+	.string	"\356T\200\276\236\314o\200\016\230K1\340\336\005\235\357\006\354\365|\267\231/'\003c\335\340\244\344\345\245B\311\311\bj\024\024\007\b\"\264\250\2340#3\275\335\317\247\243\271\335fv9\336\r\306\367\273\215\024\320\361v.\024,\3542\274\310j,cM7_\306j\375\245}\345\273h'xFlU\353\342m\246L\210\363\271jK)\034F[\311\263\247C\323O\r4 \260\002\2211\253\007\325\303\312\315"
+	.string	"\f[\307V\031\\\335\336Z\207ce!\262,\006\376Y]>\025$\230\263H_\316\322r\016\334\337 K\373\2305Nl"
+	.ascii	"f\310\220\017C}\245\272\376\261\346FO\013\013\n\330\336vq\354"
+	.ascii	"\202\340~\235\221\034p_\263\334n\315\246\240\271\005[V\377\022"
+	.ascii	"VF\331\350B\264o\277\016\030\274VB\033\354d\206:ak\307\003"
+	.text
+	.section	.gnu.lto_.symtab.178b48d4205232db,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.178b48d4205232db,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
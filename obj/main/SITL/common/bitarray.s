@@ -0,0 +1,4452 @@
+	.file	"bitarray.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/bitarray.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	bitarray.c.57b62984
+	.weak	bitarray.c.57b62984
+bitarray.c.57b62984:
+	.long	0xef
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x6
+	.long	.LASF714
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF700
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF701
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF702
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF703
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF704
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF705
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF708
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF706
+	.uleb128 0x8
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF707
+	.uleb128 0x4
+	.long	.LASF709
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x5
+	.long	.LASF711
+	.byte	0x23
+	.long	0x9c
+	.uleb128 0x2
+	.long	.LASF710
+	.byte	0x23
+	.byte	0x18
+	.long	0x66
+	.uleb128 0x3
+	.string	"bit"
+	.byte	0x23
+	.byte	0x28
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF712
+	.byte	0x1e
+	.long	0xbd
+	.uleb128 0x2
+	.long	.LASF710
+	.byte	0x1e
+	.byte	0x18
+	.long	0x66
+	.uleb128 0x3
+	.string	"bit"
+	.byte	0x1e
+	.byte	0x28
+	.long	0x30
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF715
+	.byte	0x3
+	.byte	0x19
+	.byte	0x5
+	.long	0xe4
+	.long	0xe4
+	.uleb128 0x2
+	.long	.LASF710
+	.byte	0x19
+	.byte	0x1d
+	.long	0xeb
+	.uleb128 0x3
+	.string	"bit"
+	.byte	0x19
+	.byte	0x2d
+	.long	0x30
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF713
+	.uleb128 0xa
+	.byte	0x8
+	.long	0xf1
+	.uleb128 0xb
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 4 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.file 6 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 8 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x9
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 21 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF716
+	.long	.LASF717
+	.long	.LASF718
+	.long	.LASF719
+	.long	.LASF720
+	.long	.LASF721
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x16
+	.long	.LASF0
+	.byte	0
+	.long	.LASF722
+	.byte	0x2
+	.long	.LASF723
+	.byte	0x2
+	.long	.LASF724
+	.byte	0x1
+	.long	.LASF725
+	.byte	0x5
+	.long	.LASF726
+	.byte	0x6
+	.long	.LASF726
+	.byte	0x5
+	.long	.LASF727
+	.byte	0x2
+	.long	.LASF728
+	.byte	0x5
+	.long	.LASF729
+	.byte	0x5
+	.long	.LASF730
+	.byte	0x2
+	.long	.LASF731
+	.byte	0x2
+	.long	.LASF732
+	.byte	0x4
+	.long	.LASF733
+	.byte	0x2
+	.long	.LASF734
+	.byte	0x3
+	.long	.LASF735
+	.byte	0x3
+	.long	.LASF736
+	.byte	0x2
+	.long	.LASF737
+	.byte	0x2
+	.long	.LASF738
+	.byte	0x2
+	.long	.LASF739
+	.byte	0x2
+	.long	.LASF740
+	.byte	0x6
+	.long	.LASF741
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF486:
+	.string	"__flexarr []"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF711:
+	.string	"bitArrayClr"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF389:
+	.string	"SITL 1"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF702:
+	.string	"unsigned int"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF379:
+	.string	"linux 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF715:
+	.string	"bitArrayGet"
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF709:
+	.string	"uint32_t"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF698:
+	.string	"__bool_true_false_are_defined 1"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF509:
+	.string	"__wur "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF694:
+	.string	"_STDBOOL_H "
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"_Bool"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF707:
+	.string	"char"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF699:
+	.string	"BITARRAY_BIT_OP(array,bit,op) ((array)[(bit) / (sizeof((array)[0]) * 8)] op (1 << ((bit) % (sizeof((array)[0]) * 8))))"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF696:
+	.string	"true 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF29:
+	.string	"_LP64 1"
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF550:
+	.string	"__stub_stty "
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF463:
+	.string	"__PMT"
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF695:
+	.string	"bool _Bool"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"array"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF714:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF705:
+	.string	"short int"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF706:
+	.string	"long int"
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF377:
+	.string	"__linux 1"
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF473:
+	.string	"__P(args) args"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF703:
+	.string	"long unsigned int"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF380:
+	.string	"__unix 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF510:
+	.string	"__always_inline"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF364:
+	.string	"__k8 1"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF700:
+	.string	"unsigned char"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF708:
+	.string	"__uint32_t"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF420:
+	.string	"__USE_GNU"
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF704:
+	.string	"signed char"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF697:
+	.string	"false 0"
+.LASF701:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF712:
+	.string	"bitArraySet"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF355:
+	.string	"__amd64 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF382:
+	.string	"unix 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF0:
+	.string	"./src/main/common/bitarray.c"
+.LASF733:
+	.string	"long-double.h"
+.LASF735:
+	.string	"stubs-64.h"
+.LASF720:
+	.string	"/usr/include"
+.LASF739:
+	.string	"stdint-intn.h"
+.LASF740:
+	.string	"stdbool.h"
+.LASF727:
+	.string	"libc-header-start.h"
+.LASF741:
+	.string	"bitarray.h"
+.LASF718:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF738:
+	.string	"wchar.h"
+.LASF731:
+	.string	"timesize.h"
+.LASF734:
+	.string	"stubs.h"
+.LASF723:
+	.string	"stdint-uintn.h"
+.LASF719:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF721:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF728:
+	.string	"features.h"
+.LASF737:
+	.string	"time64.h"
+.LASF717:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF736:
+	.string	"typesizes.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF729:
+	.string	"features-time64.h"
+.LASF732:
+	.string	"cdefs.h"
+.LASF724:
+	.string	"bitarray.c"
+.LASF730:
+	.string	"wordsize.h"
+.LASF716:
+	.string	"src/main/common"
+.LASF725:
+	.string	"stdc-predef.h"
+.LASF726:
+	.string	"stdint.h"
+.LASF722:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 7=\001"
+	.string	"\330+"
+	.string	"\003"
+	.string	"\346\223\345\213\006\002\002"
+	.string	"\002"
+	.string	"\001\277\330\227\230\003\004\330\313\241\243\016"
+	.string	"\004"
+	.ascii	"2Ks\027\272\330\260\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 /\275"
+	.string	""
+	.string	"X#"
+	.string	"\003"
+	.string	"\002"
+	.string	"\003\001\001\002"
+	.string	"\004"
+	.ascii	"`c\227\202A&\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 \340}\002"
+	.string	"\"\304\f\026\300%\035\003\277\375\377\246?Ak\374\377\377\033\322\264f\310N;\005\n\3116\343E\252Fb\213\305\201\373YOm\033P\324'\232h\311\370\3306h\211\004\n"
+	.string	"0\301\016\302\rJ\003\242\233\204\347-]n.\203E\326\236am"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 /\375"
+	.string	""
+	.string	"\250#"
+	.string	"\003"
+	.string	"\002\001\001\017\177\002\002\177\002\001\001\003\177\002\001\002"
+	.string	"\003"
+	.string	"`k.\343o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\205\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 f=\001"
+	.string	"\250Z"
+	.string	"\003"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\004\001\002\020"
+	.string	"\002"
+	.string	"\006"
+	.ascii	"C5R\324\001rv\3729\200\335\370\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.c8062b0c29c712a3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.0.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375`\013\0015\r"
+	.string	"&Z[B\020\221\223\016\370\356\322\2602\256\255/\024\026<)b\207\t\367U8#\244+1 \261\326\032\376\263\336\325\355\206\033.w\260VU\325N\024\310\376o\267\324\rdS\374\213\276bw\333F\310\336$\311\224\002I"
+	.string	"B"
+	.string	"F"
+	.ascii	"%\f\223rLs\030@\346\013\f\213\314MAG2\273n\026\360\354"
+	.string	"2\203<\273\266\005\221\244\252\032\220\3417H\260P\354\310\334\264{\260\312\250\252}\302\227\b\0274TXN\214\030\204\314,\252\260lp\357\266\t\332Jh\275\022\305z\034cw,cs\216\335\034\233=,v\354;\3269\354ua\177a\361X\177`)@`d\256\264h\262\206k\001\242m\252\355\264\216\001\372f\023)\313\210t\223\3512#Bf\027ry\005\b\261u\b,\3628\1777`\203\325R\253\270`\222}\250-<;wk\340\360w~\335\253\021\227+\343\341\377\367X\205\360\361f\325\240`\253\316\235y\234\373\227\216UM\n\266\332qI\344\321n'\370\016\255\257\314\314\376\245\r(\222\350]\340\340\001\210\201\250\001\311'\200\353\350\203!t:\205P$\221Vb*\225L#\255\204\024*i\243S\005\355s\240&\n\023N\032\312d:i\235-]\317CP\236\322\332\344m\356\271Y/\262\273oN"
+	.string	"\007\253\005{\366>b\354\005fV4\001\025"
+	.string	"5W\214\245\213\314\325"
+	.ascii	"\305\242\351\240\324vX\203\f\217fnR\272\305fmbj\017\232\373\373"
+	.ascii	"s=\345B\0232\3269e\377S\243\340\330\002U\213&a>\001"
+	.text
+	.section	.gnu.lto_bitArraySet.1.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375`\013\001\r\r"
+	.string	"\366\330WB\020q\233\016\210&\311]$\335\321\225v\300\001@\024[e\234\331p_`\b>M\2758\362\"B\332\223\373\262\242\236j\334\274\252\252\341B\005\036\226\324\375\036\310\276T\356\366\3220d\324\310\356&eJ\001B"
+	.string	"?"
+	.string	"E"
+	.string	"\366[\334\305\366\222s\\\300.\211\205\214]o\201C\252C{\317\304\303\352\230x\350\315\326\361\241\001@\251K\341\261\273\230\226\370\366\334\374\303\270%\032\221<)\t\273\353\024\215Nn\275m\005\266)\330?\tJ\262_\372\257L_\216\362[\231\2562M\301t\3144\314\3644\245U\323\251\351\007\260>`\276]\016\037\313\252\300\031(l\377\262\237b\223\336_lG\001\261\265+\242\306\204\3520\301t\022\233g88\026\004\007\211\226B-\260\322\201\360c`\030\251N\370\027\364\033B\244^\252zn\305t\333\210\327\324s*.z}\327R\222\237\341M#ZzQM\341ZL\362sftc\263\207\355\221\244\216\260?\355\356:\241OG\315"
+	.string	"B\204\215\203\316\203\006\232\001\320\036M\006\216\246qB\237\016&\222\201@\231\007\023\371p@\230G\033\3014\007\234Y\250\240a\241,\323\260\313\333O\253$\303\016*%j\342J\r\230\270h\007\245\223V\372\261\322y\210Ji\310\243\022\b\031"
+	.ascii	"5W\214\245\213\314\276\023o\303WoB0\0237\250`\b\354\030C\235"
+	.ascii	"\231\221\224F\221\331 T\023d\25183#\371g\370\3105\314\031fs*"
+	.ascii	"\374\247F\301\261B\325t8\301\213k\222\001"
+	.text
+	.section	.gnu.lto_bitArrayClr.2.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375`\033\001e\r"
+	.string	"\266\031ZB"
+	.string	"\2216\035\330*\332\243\2749\330<-\220\230r\254\232\022\032\3543\215\372(\375h\204\f9\f\255rT\201m\252\201\317[3\364\377\357\004A\247\354\020\310Cm\273\215\252Q \0041zjdw\2232\245D"
+	.string	"A"
+	.string	"H"
+	.ascii	"\235\247}\023?\301\235\305/\017\260[*\301b\367K\340\020\353\320"
+	.ascii	"\337;\342\241u\001\361\320\234M\303"
+	.string	"\343D\263\3023\335\330\335L?\234{r\376S\374\"\241\220<+\b\273\353$\241l\270\365\266\021\330\226`\177%k-\331g\3715\231\306\336\362g2}e\332\202\351\n\246c\246a\246)*\255\232NM\037\300%c3c7\303\tf]`\013\021\266\217\331\327\320\311\357(\270\267\200\370\332]y\021\301:<@\375$!\217\372\361\322\301\0308H\314(\324\0019\274\024_\205\205\021+\204_A\217A%U\243\252\357HP7\214xM}7\002\323\353\275\230\222<\031\336.bF1US\027c\222'wp\210\261\211\303\376HR=\330\247v7\243\320G\255\300\301\203\016\203O\203\005\234\r4\210s\301\263m\236Q\350\223\211h\"\221\006\312DB\036Q\006\332F2N\001k\024&l\331H\323\266\f\373\366\324j\311\260\203K\211\232\370R\002 N\252a)\245\227z\330\360R*\265\242V\372a\362T4\032"
+	.ascii	"5W\214\245\213\314\276\031o\303W\317B0\026n\3604\004v\274A|\f"
+	.ascii	"wfZRj\305f\215`\215\221\245\354\314\264\344\237\366+\3270g\230"
+	.ascii	"\315\251\360\237\032\005\307\nU\323\341\004/\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\005\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\006\002\177\007"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c8062b0c29c712a3,"e",@progbits
+	.string	"(\265/\375`\241\003\305\032"
+	.string	"Fs\264I\260\230\321pL\221\304DvG\347\b\016\f\254\032\302w\327\271 \016:\f\037r\221\266|\363\025\346\212\203\021\263\333>\235JM\254a\257\351\357\313\f\3277\347K\002ou<E\333G\376\362\003\003(l\223\034{\022\233l\231\002\221"
+	.string	"\231"
+	.string	"\235"
+	.ascii	"+RJ\233rZ\177O\241\222\373\273\225\2177\256d\220\027\375\337"
+	.ascii	",\343\017m\201%\024\355\035b\257\217\375\261+\353,J\017\374\325"
+	.ascii	"\330X\204JPE(\356\3222\255*\333 ^!\333d\227\251~\375\325\227"
+	.ascii	"\013J\226\030\300P\244Y\002-Q\302(#\363\002\361\353\311q\034"
+	.ascii	"\216^Y\353\265\262\226\325%\320\032W@\253J)\306\336$\r\034\240"
+	.ascii	"v\206\355*\333T\266\245l7\331\006\262-d\273\201\355\325\366h"
+	.ascii	"\233\211m\361\352\352\352\312v\3176\223\315\212\020W\2777}\250"
+	.ascii	"\210SMy\247\232\222\260\233)\371\253(\354\004\226\344\236\253"
+	.ascii	"\017=\327\024\215\335<\371\265<\032\315\024=\233\244(\354\\K"
+	.ascii	"\3644}h\254\310\n\351\306\tE\210\321:9\315\257\330\365J\036,"
+	.ascii	"x\252\351\255\376"
+	.string	"\005\016\235\307\340\357\245<\253\322\305\"\321\005W\350\240\312t\325\377\007v:\244\364f\360\324\221\376:t\037\276\273!\325\340\2236H\322\350\275h\350Gp\365\337\375\344>\370\237\374\037\303\353\251\377\013\330\371\333\355~#\003\273\367\310\251\241?\004FA\202\236\001'\267\314\370\240\210|\351r##\031\253\313\213+[\236\274R\266\r\316F\311\374\t\002\364\230\302\361\024\212\033\025.\324\036\361F\255\021\333\340X\306\374\217_\335(\361/w\027\314\354.\200Y\242T6\265D\227\030\267\210\253\210\\\222\314(\241\350-\256\027\221\023\027](\032\304\030\332\255\227\274\377,`\324\363t2-{\2750\2732;\300\262\226\301Y36\376\235\225\2261\207T\t#\024m\323\334\266'\234\344a\226h\354\352y\347\352#\317!O\320\230\372\243\002_i\374T}\250\230\222a8 \0139[\006\005\276\205\260\341f\271\333\r7\003"
+	.string	"t\273U\350"
+	.ascii	"\223\263]\240\220\373\351\001`\237\037\234M\310\346a\364M\315"
+	.ascii	"A-\307D\214sv\036\354<h9g\207F\333\251\321F\327h\254\\\007\033"
+	.ascii	"\b9\241\037\022\243ortlj=\021pj\006XG\307\002\315\006\f\027F"
+	.ascii	"\237\232\023<8\034O\356\247g&t\013\n\272\371\314\204~x\202f>"
+	.ascii	"\270\021\263\232\004FQU\305\372e\030\371\271\236~G\210r\214\333"
+	.ascii	"\233\232Z\252\021v\235\024&+\257#\031^\264(\361R\231J\f\321\322"
+	.ascii	"\r4\0247\211\247\264\234\354\330\241\2645\306]\222\255\323\022"
+	.ascii	"\361\002\325\005\256\224\313(9 \220\002\021\302\252\007\277\314"
+	.ascii	"\357\006(\314\255\265\b0\347.e!_\370)\034B\027(\371\252KB\247"
+	.ascii	"\025M\333\244\013\273\277\307\252q0\277\244R2\354\b\007:\272"
+	.ascii	"\002l\207M\322\213\035s\316R\322 {\n10\016\214\340\216\202&\031"
+	.ascii	"\217\277\"a+U\227V(z\364h\002\017\263D\344\326h\207h\034l9b4"
+	.ascii	"\b\210\002\016\275\266\222pt\371\210l\231\205\275\323\273c\037"
+	.ascii	"\227\331\302-X\335\365\205-("
+	.text
+	.section	.gnu.lto_.symtab.c8062b0c29c712a3,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c8062b0c29c712a3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11491 @@
+	.file	"filter.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/filter.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "./src/main/common/filter.c"
+	.file 8 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	filter.c.94d7c939
+	.weak	filter.c.94d7c939
+filter.c.94d7c939:
+	.long	0xce2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF1433
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1321
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1322
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1323
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1324
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1325
+	.uleb128 0x6
+	.long	.LASF1327
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1326
+	.uleb128 0x6
+	.long	.LASF1328
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x15
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF1329
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1330
+	.uleb128 0x1f
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1331
+	.uleb128 0x6
+	.long	.LASF1332
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x6
+	.long	.LASF1333
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF1334
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1335
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1336
+	.uleb128 0x15
+	.long	0xbc
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1337
+	.uleb128 0x16
+	.long	.LASF1340
+	.byte	0x10
+	.byte	0x1a
+	.long	0x107
+	.uleb128 0x5
+	.long	.LASF1338
+	.byte	0x1b
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x1c
+	.byte	0xb
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x3
+	.string	"RC"
+	.byte	0x1d
+	.byte	0xb
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.string	"dT"
+	.byte	0x1e
+	.byte	0xb
+	.long	0xbc
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1339
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x3
+	.long	0xcf
+	.uleb128 0x16
+	.long	.LASF1341
+	.byte	0x2c
+	.byte	0x22
+	.long	0x198
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x23
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x23
+	.byte	0xf
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x23
+	.byte	0x13
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x23
+	.byte	0x17
+	.long	0xbc
+	.byte	0xc
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x23
+	.byte	0x1b
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x3
+	.string	"x1"
+	.byte	0x24
+	.byte	0xb
+	.long	0xbc
+	.byte	0x14
+	.uleb128 0x3
+	.string	"x2"
+	.byte	0x24
+	.byte	0xf
+	.long	0xbc
+	.byte	0x18
+	.uleb128 0x3
+	.string	"y1"
+	.byte	0x24
+	.byte	0x13
+	.long	0xbc
+	.byte	0x1c
+	.uleb128 0x3
+	.string	"y2"
+	.byte	0x24
+	.byte	0x17
+	.long	0xbc
+	.byte	0x20
+	.uleb128 0x3
+	.string	"d1"
+	.byte	0x25
+	.byte	0xb
+	.long	0xbc
+	.byte	0x24
+	.uleb128 0x3
+	.string	"d2"
+	.byte	0x25
+	.byte	0xf
+	.long	0xbc
+	.byte	0x28
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1342
+	.byte	0x4
+	.byte	0x26
+	.byte	0x3
+	.long	0x113
+	.uleb128 0x19
+	.long	.LASF1343
+	.value	0x1f0
+	.byte	0x28
+	.long	0x1ed
+	.uleb128 0x5
+	.long	.LASF1344
+	.byte	0x29
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1345
+	.byte	0x2a
+	.byte	0x9
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1346
+	.byte	0x2b
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1347
+	.byte	0x2c
+	.byte	0xb
+	.long	0xbc
+	.byte	0xc
+	.uleb128 0x5
+	.long	.LASF1338
+	.byte	0x2d
+	.byte	0xb
+	.long	0x1ed
+	.byte	0x10
+	.byte	0
+	.uleb128 0x17
+	.long	0xbc
+	.long	0x1fd
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x77
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1348
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x3
+	.long	0x1a4
+	.uleb128 0x1a
+	.long	0x30
+	.byte	0x36
+	.long	0x226
+	.uleb128 0x12
+	.long	.LASF1349
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1350
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF1351
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1352
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x3
+	.long	0x209
+	.uleb128 0x16
+	.long	.LASF1353
+	.byte	0x18
+	.byte	0x3c
+	.long	0x292
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0x3d
+	.byte	0xc
+	.long	0x292
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1354
+	.byte	0x3e
+	.byte	0x12
+	.long	0x297
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1347
+	.byte	0x3f
+	.byte	0xb
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1346
+	.byte	0x40
+	.byte	0xd
+	.long	0x8c
+	.byte	0x14
+	.uleb128 0x5
+	.long	.LASF1355
+	.byte	0x41
+	.byte	0xd
+	.long	0x8c
+	.byte	0x15
+	.uleb128 0x5
+	.long	.LASF1356
+	.byte	0x42
+	.byte	0xd
+	.long	0x8c
+	.byte	0x16
+	.uleb128 0x5
+	.long	.LASF1357
+	.byte	0x43
+	.byte	0xd
+	.long	0x8c
+	.byte	0x17
+	.byte	0
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0x8
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF1358
+	.byte	0x4
+	.byte	0x44
+	.byte	0x3
+	.long	0x232
+	.uleb128 0x15
+	.long	0x29c
+	.uleb128 0x1a
+	.long	0x30
+	.byte	0x4d
+	.long	0x2ca
+	.uleb128 0x12
+	.long	.LASF1359
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1360
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF1361
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1362
+	.byte	0x4
+	.byte	0x51
+	.byte	0x3
+	.long	0x2ad
+	.uleb128 0x16
+	.long	.LASF1363
+	.byte	0x70
+	.byte	0x54
+	.long	0x351
+	.uleb128 0x5
+	.long	.LASF1364
+	.byte	0x55
+	.byte	0x1b
+	.long	0x2ca
+	.byte	0
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x56
+	.byte	0xb
+	.long	0x351
+	.byte	0x4
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x57
+	.byte	0xb
+	.long	0x351
+	.byte	0x10
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x58
+	.byte	0xb
+	.long	0x351
+	.byte	0x1c
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x59
+	.byte	0xb
+	.long	0x351
+	.byte	0x28
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x5a
+	.byte	0xb
+	.long	0x351
+	.byte	0x34
+	.uleb128 0x3
+	.string	"x1"
+	.byte	0x5b
+	.byte	0xb
+	.long	0x351
+	.byte	0x40
+	.uleb128 0x3
+	.string	"x2"
+	.byte	0x5c
+	.byte	0xb
+	.long	0x351
+	.byte	0x4c
+	.uleb128 0x3
+	.string	"y1"
+	.byte	0x5d
+	.byte	0xb
+	.long	0x351
+	.byte	0x58
+	.uleb128 0x3
+	.string	"y2"
+	.byte	0x5e
+	.byte	0xb
+	.long	0x351
+	.byte	0x64
+	.byte	0
+	.uleb128 0x17
+	.long	0xbc
+	.long	0x361
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1365
+	.byte	0x4
+	.byte	0x5f
+	.byte	0x3
+	.long	0x2d6
+	.uleb128 0x15
+	.long	0x361
+	.uleb128 0x19
+	.long	.LASF1366
+	.value	0x1c4
+	.byte	0x62
+	.long	0x3a3
+	.uleb128 0x5
+	.long	.LASF1367
+	.byte	0x63
+	.byte	0xd
+	.long	0x8c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1368
+	.byte	0x64
+	.byte	0xd
+	.long	0x8c
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1369
+	.byte	0x65
+	.byte	0x17
+	.long	0x3a3
+	.byte	0x4
+	.byte	0
+	.uleb128 0x17
+	.long	0x361
+	.long	0x3b3
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1370
+	.byte	0x4
+	.byte	0x66
+	.byte	0x3
+	.long	0x372
+	.uleb128 0x20
+	.long	.LASF1371
+	.byte	0x5
+	.value	0x13d
+	.byte	0x11
+	.long	0x7c
+	.long	0x3d6
+	.uleb128 0x7
+	.long	0xbc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1372
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.long	0x83
+	.long	0x3f6
+	.uleb128 0x7
+	.long	0x83
+	.uleb128 0x7
+	.long	0x3f6
+	.uleb128 0x7
+	.long	0xb0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3fb
+	.uleb128 0x21
+	.uleb128 0xf
+	.long	.LASF1373
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x41c
+	.uleb128 0x7
+	.long	0x83
+	.uleb128 0x7
+	.long	0x64
+	.uleb128 0x7
+	.long	0xb0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1374
+	.byte	0x5
+	.byte	0x3e
+	.byte	0x39
+	.long	0xbc
+	.long	0x432
+	.uleb128 0x7
+	.long	0xbc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1375
+	.byte	0x5
+	.byte	0x40
+	.byte	0x39
+	.long	0xbc
+	.long	0x448
+	.uleb128 0x7
+	.long	0xbc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1376
+	.byte	0x5
+	.byte	0x8f
+	.byte	0xe
+	.long	0xbc
+	.long	0x45e
+	.uleb128 0x7
+	.long	0xbc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1377
+	.byte	0x5
+	.byte	0x8c
+	.byte	0x39
+	.long	0xbc
+	.long	0x479
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0x7
+	.long	0xbc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1378
+	.byte	0x5
+	.byte	0x85
+	.byte	0x39
+	.long	0xbc
+	.long	0x48f
+	.uleb128 0x7
+	.long	0xbc
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1383
+	.value	0x19c
+	.long	0xbc
+	.long	0x4b7
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x19c
+	.byte	0x32
+	.long	0x4b7
+	.uleb128 0x2
+	.long	.LASF1380
+	.value	0x19c
+	.byte	0x40
+	.long	0xbc
+	.byte	0
+	.uleb128 0x8
+	.long	0x1fd
+	.uleb128 0x10
+	.long	.LASF1389
+	.value	0x196
+	.long	0x4ec
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x196
+	.byte	0x2f
+	.long	0x4b7
+	.uleb128 0x2
+	.long	.LASF1381
+	.value	0x196
+	.byte	0x3f
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1382
+	.value	0x196
+	.byte	0x57
+	.long	0x98
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1384
+	.value	0x18f
+	.long	0xbc
+	.long	0x514
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x18f
+	.byte	0x2d
+	.long	0x514
+	.uleb128 0xd
+	.long	.LASF1346
+	.value	0x192
+	.byte	0xf
+	.long	0x6b
+	.byte	0
+	.uleb128 0x8
+	.long	0x2a8
+	.uleb128 0x13
+	.long	.LASF1385
+	.value	0x18a
+	.long	0xbc
+	.long	0x535
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x18a
+	.byte	0x35
+	.long	0x514
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1386
+	.value	0x17c
+	.long	0xbc
+	.long	0x582
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x17c
+	.byte	0x36
+	.long	0x514
+	.uleb128 0x2
+	.long	.LASF1355
+	.value	0x17c
+	.byte	0x46
+	.long	0x8c
+	.uleb128 0x14
+	.string	"ret"
+	.value	0x17e
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0xd
+	.long	.LASF1346
+	.value	0x17f
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0x14
+	.string	"ii"
+	.value	0x180
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1387
+	.value	0x173
+	.long	0xbc
+	.long	0x5aa
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x173
+	.byte	0x2c
+	.long	0x5aa
+	.uleb128 0x2
+	.long	.LASF1380
+	.value	0x173
+	.byte	0x3a
+	.long	0xbc
+	.byte	0
+	.uleb128 0x8
+	.long	0x29c
+	.uleb128 0x13
+	.long	.LASF1388
+	.value	0x165
+	.long	0xbc
+	.long	0x5ee
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x165
+	.byte	0x29
+	.long	0x514
+	.uleb128 0x14
+	.string	"ret"
+	.value	0x167
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x14
+	.string	"ii"
+	.value	0x168
+	.byte	0x9
+	.long	0x64
+	.uleb128 0xd
+	.long	.LASF1346
+	.value	0x169
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1390
+	.value	0x158
+	.long	0x612
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x158
+	.byte	0x2a
+	.long	0x5aa
+	.uleb128 0x2
+	.long	.LASF1380
+	.value	0x158
+	.byte	0x38
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1391
+	.value	0x14d
+	.long	0x636
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x14d
+	.byte	0x23
+	.long	0x5aa
+	.uleb128 0x2
+	.long	.LASF1380
+	.value	0x14d
+	.byte	0x31
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1392
+	.value	0x148
+	.long	0x672
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x148
+	.byte	0x21
+	.long	0x5aa
+	.uleb128 0x1b
+	.string	"buf"
+	.value	0x148
+	.byte	0x30
+	.long	0x292
+	.uleb128 0x2
+	.long	.LASF1356
+	.value	0x148
+	.byte	0x3d
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1354
+	.value	0x148
+	.byte	0x55
+	.long	0x297
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1393
+	.value	0x138
+	.long	0x6ba
+	.uleb128 0x2
+	.long	.LASF1379
+	.value	0x138
+	.byte	0x22
+	.long	0x5aa
+	.uleb128 0x1b
+	.string	"buf"
+	.value	0x138
+	.byte	0x31
+	.long	0x292
+	.uleb128 0x2
+	.long	.LASF1356
+	.value	0x138
+	.byte	0x3e
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1354
+	.value	0x138
+	.byte	0x56
+	.long	0x297
+	.uleb128 0x2
+	.long	.LASF1357
+	.value	0x138
+	.byte	0x66
+	.long	0x8c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1394
+	.value	0x130
+	.long	0x6de
+	.uleb128 0x2
+	.long	.LASF1395
+	.value	0x130
+	.byte	0x24
+	.long	0x6de
+	.uleb128 0x2
+	.long	.LASF1396
+	.value	0x130
+	.byte	0x31
+	.long	0x292
+	.byte	0
+	.uleb128 0x8
+	.long	0x3b3
+	.uleb128 0x10
+	.long	.LASF1397
+	.value	0x11e
+	.long	0x73b
+	.uleb128 0x2
+	.long	.LASF1395
+	.value	0x11e
+	.byte	0x2a
+	.long	0x6de
+	.uleb128 0x2
+	.long	.LASF1396
+	.value	0x11e
+	.byte	0x37
+	.long	0x292
+	.uleb128 0x2
+	.long	.LASF1398
+	.value	0x11e
+	.byte	0x41
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1399
+	.value	0x11e
+	.byte	0x51
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1400
+	.value	0x120
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1369
+	.value	0x121
+	.byte	0x1c
+	.long	0x73b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x361
+	.uleb128 0x1c
+	.long	.LASF1402
+	.value	0x110
+	.long	0x796
+	.uleb128 0x2
+	.long	.LASF1369
+	.value	0x110
+	.byte	0x39
+	.long	0x73b
+	.uleb128 0x2
+	.long	.LASF1396
+	.value	0x110
+	.byte	0x47
+	.long	0x292
+	.uleb128 0x2
+	.long	.LASF1367
+	.value	0x110
+	.byte	0x51
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0x14
+	.string	"i"
+	.value	0x112
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1380
+	.value	0x113
+	.byte	0x15
+	.long	0xc3
+	.uleb128 0xd
+	.long	.LASF1401
+	.value	0x114
+	.byte	0x15
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1403
+	.value	0x105
+	.long	0x7ec
+	.uleb128 0x2
+	.long	.LASF1369
+	.value	0x105
+	.byte	0x36
+	.long	0x73b
+	.uleb128 0x2
+	.long	.LASF1396
+	.value	0x105
+	.byte	0x44
+	.long	0x292
+	.uleb128 0x2
+	.long	.LASF1367
+	.value	0x105
+	.byte	0x4e
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0x14
+	.string	"i"
+	.value	0x107
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1380
+	.value	0x108
+	.byte	0x15
+	.long	0xc3
+	.uleb128 0xd
+	.long	.LASF1401
+	.value	0x109
+	.byte	0x15
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1404
+	.byte	0x7
+	.byte	0xfd
+	.byte	0xd
+	.long	0x828
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x33
+	.long	0x73b
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x41
+	.long	0x292
+	.uleb128 0x1
+	.long	.LASF1367
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x4b
+	.long	0x64
+	.uleb128 0x9
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xff
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1405
+	.byte	0xf4
+	.long	0x84b
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x7
+	.byte	0xf4
+	.byte	0x39
+	.long	0x73b
+	.uleb128 0xa
+	.string	"src"
+	.byte	0x7
+	.byte	0xf4
+	.byte	0x57
+	.long	0x84b
+	.byte	0
+	.uleb128 0x8
+	.long	0x36d
+	.uleb128 0x11
+	.long	.LASF1406
+	.byte	0xe8
+	.long	0x8ac
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0x7
+	.byte	0xe8
+	.byte	0x35
+	.long	0x73b
+	.uleb128 0x1
+	.long	.LASF1407
+	.byte	0x7
+	.byte	0xe8
+	.byte	0x40
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0xe8
+	.byte	0x4f
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0xe8
+	.byte	0x64
+	.long	0xa4
+	.uleb128 0xa
+	.string	"Q"
+	.byte	0x7
+	.byte	0xe8
+	.byte	0x77
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x7
+	.byte	0xe8
+	.byte	0x8d
+	.long	0x226
+	.uleb128 0xc
+	.long	.LASF1379
+	.byte	0xea
+	.byte	0x14
+	.long	0x198
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1411
+	.byte	0xe2
+	.byte	0x14
+	.long	0x73b
+	.long	0x8e0
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x7
+	.byte	0xe2
+	.byte	0x39
+	.long	0x6de
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0xe2
+	.byte	0x45
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0xe2
+	.byte	0x5a
+	.long	0xa4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1412
+	.byte	0xd7
+	.byte	0x14
+	.long	0x73b
+	.long	0x94c
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x36
+	.long	0x6de
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x52
+	.long	0x2ca
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x5e
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x73
+	.long	0xa4
+	.uleb128 0xa
+	.string	"Q"
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x86
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x9c
+	.long	0x226
+	.uleb128 0xc
+	.long	.LASF1369
+	.byte	0xd9
+	.byte	0x18
+	.long	0x73b
+	.uleb128 0x9
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xdb
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1413
+	.byte	0xca
+	.byte	0x14
+	.long	0x73b
+	.long	0x9a2
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x7
+	.byte	0xca
+	.byte	0x33
+	.long	0x6de
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0x7
+	.byte	0xca
+	.byte	0x41
+	.long	0x8c
+	.uleb128 0xa
+	.string	"dT"
+	.byte	0x7
+	.byte	0xca
+	.byte	0x4e
+	.long	0xbc
+	.uleb128 0xc
+	.long	.LASF1369
+	.byte	0xcc
+	.byte	0x18
+	.long	0x73b
+	.uleb128 0x9
+	.uleb128 0xc
+	.long	.LASF1379
+	.byte	0xce
+	.byte	0x15
+	.long	0x107
+	.uleb128 0x9
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xd0
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1434
+	.byte	0x7
+	.byte	0xbf
+	.byte	0x1b
+	.long	0x73b
+	.long	0x9d6
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x7
+	.byte	0xbf
+	.byte	0x3c
+	.long	0x6de
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x7
+	.byte	0xbf
+	.byte	0x58
+	.long	0x2ca
+	.uleb128 0xc
+	.long	.LASF1369
+	.byte	0xc4
+	.byte	0x18
+	.long	0x73b
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1415
+	.byte	0xb9
+	.long	0x9f9
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x7
+	.byte	0xb9
+	.byte	0x23
+	.long	0x6de
+	.uleb128 0x1
+	.long	.LASF1367
+	.byte	0x7
+	.byte	0xb9
+	.byte	0x31
+	.long	0x8c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1416
+	.byte	0xaa
+	.byte	0x7
+	.long	0xbc
+	.long	0xa2c
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0xaa
+	.byte	0x29
+	.long	0xa2c
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x7
+	.byte	0xaa
+	.byte	0x37
+	.long	0xbc
+	.uleb128 0xc
+	.long	.LASF1401
+	.byte	0xac
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x8
+	.long	0x198
+	.uleb128 0xe
+	.long	.LASF1417
+	.byte	0x99
+	.byte	0x7
+	.long	0xbc
+	.long	0xa64
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x99
+	.byte	0x2c
+	.long	0xa2c
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x7
+	.byte	0x99
+	.byte	0x3a
+	.long	0xbc
+	.uleb128 0xc
+	.long	.LASF1401
+	.byte	0x9c
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1418
+	.byte	0x83
+	.long	0xae5
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x83
+	.byte	0x29
+	.long	0xa2c
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0x83
+	.byte	0x37
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0x83
+	.byte	0x4c
+	.long	0xa4
+	.uleb128 0xa
+	.string	"Q"
+	.byte	0x7
+	.byte	0x83
+	.byte	0x5f
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x7
+	.byte	0x83
+	.byte	0x75
+	.long	0x226
+	.uleb128 0x4
+	.string	"x1"
+	.byte	0x86
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x4
+	.string	"x2"
+	.byte	0x87
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x4
+	.string	"y1"
+	.byte	0x88
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x4
+	.string	"y2"
+	.byte	0x89
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x4
+	.string	"d1"
+	.byte	0x8a
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x4
+	.string	"d2"
+	.byte	0x8b
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1419
+	.byte	0x51
+	.long	0xb90
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x51
+	.byte	0x27
+	.long	0xa2c
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0x51
+	.byte	0x35
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0x51
+	.byte	0x4a
+	.long	0xa4
+	.uleb128 0xa
+	.string	"Q"
+	.byte	0x7
+	.byte	0x51
+	.byte	0x5d
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x7
+	.byte	0x51
+	.byte	0x73
+	.long	0x226
+	.uleb128 0xc
+	.long	.LASF1420
+	.byte	0x54
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.string	"sn"
+	.byte	0x55
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.string	"cs"
+	.byte	0x56
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xc
+	.long	.LASF1421
+	.byte	0x57
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.string	"b0"
+	.byte	0x59
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x4
+	.string	"b1"
+	.byte	0x59
+	.byte	0x13
+	.long	0xbc
+	.uleb128 0x4
+	.string	"b2"
+	.byte	0x59
+	.byte	0x1b
+	.long	0xbc
+	.uleb128 0x4
+	.string	"a0"
+	.byte	0x59
+	.byte	0x23
+	.long	0xbc
+	.uleb128 0x4
+	.string	"a1"
+	.byte	0x59
+	.byte	0x2b
+	.long	0xbc
+	.uleb128 0x4
+	.string	"a2"
+	.byte	0x59
+	.byte	0x33
+	.long	0xbc
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1422
+	.byte	0x4c
+	.long	0xbbf
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x2a
+	.long	0xa2c
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x38
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x4d
+	.long	0xa4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1423
+	.byte	0x46
+	.byte	0x7
+	.long	0xbc
+	.long	0xbf2
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x7
+	.byte	0x46
+	.byte	0x20
+	.long	0x98
+	.uleb128 0x1
+	.long	.LASF1425
+	.byte	0x7
+	.byte	0x46
+	.byte	0x35
+	.long	0x98
+	.uleb128 0xc
+	.long	.LASF1426
+	.byte	0x47
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1427
+	.byte	0x38
+	.byte	0x7
+	.long	0xbc
+	.long	0xc31
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x38
+	.byte	0x24
+	.long	0xc31
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x7
+	.byte	0x38
+	.byte	0x32
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0x7
+	.byte	0x38
+	.byte	0x41
+	.long	0x8c
+	.uleb128 0xa
+	.string	"dT"
+	.byte	0x7
+	.byte	0x38
+	.byte	0x4e
+	.long	0xbc
+	.byte	0
+	.uleb128 0x8
+	.long	0x107
+	.uleb128 0xe
+	.long	.LASF1428
+	.byte	0x32
+	.byte	0x7
+	.long	0xbc
+	.long	0xc5e
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x32
+	.byte	0x23
+	.long	0xc31
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x7
+	.byte	0x32
+	.byte	0x31
+	.long	0xbc
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1429
+	.byte	0x2b
+	.long	0xc8c
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x21
+	.long	0xc31
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x31
+	.long	0x8c
+	.uleb128 0xa
+	.string	"dT"
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x3e
+	.long	0xbc
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1430
+	.byte	0x22
+	.byte	0x7
+	.long	0xbc
+	.long	0xcb4
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x7
+	.byte	0x22
+	.byte	0x1d
+	.long	0x83
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x7
+	.byte	0x22
+	.byte	0x2b
+	.long	0xbc
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1431
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x13
+	.long	0x64
+	.uleb128 0xa
+	.string	"amt"
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x21
+	.long	0x64
+	.uleb128 0xa
+	.string	"low"
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF1432
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x33
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.file 12 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 38 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1320
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1239
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1255
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.8fcd518b05545f13645854f569c3dee7,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1316
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF1435
+	.long	.LASF1436
+	.long	.LASF1437
+	.long	.LASF1438
+	.long	.LASF1439
+	.long	.LASF1440
+	.long	.LASF1441
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x27
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1442
+	.byte	0x3
+	.long	.LASF1443
+	.byte	0x3
+	.long	.LASF1444
+	.byte	0x7
+	.long	.LASF1445
+	.byte	0x1
+	.long	.LASF1446
+	.byte	0x3
+	.long	.LASF1447
+	.byte	0x6
+	.long	.LASF1448
+	.byte	0x1
+	.long	.LASF1449
+	.byte	0x1
+	.long	.LASF1450
+	.byte	0x6
+	.long	.LASF1451
+	.byte	0x7
+	.long	.LASF1452
+	.byte	0x7
+	.long	.LASF1452
+	.byte	0x6
+	.long	.LASF1453
+	.byte	0x3
+	.long	.LASF1454
+	.byte	0x6
+	.long	.LASF1455
+	.byte	0x6
+	.long	.LASF1456
+	.byte	0x3
+	.long	.LASF1457
+	.byte	0x3
+	.long	.LASF1458
+	.byte	0x5
+	.long	.LASF1459
+	.byte	0x3
+	.long	.LASF1460
+	.byte	0x4
+	.long	.LASF1461
+	.byte	0x4
+	.long	.LASF1462
+	.byte	0x3
+	.long	.LASF1463
+	.byte	0x3
+	.long	.LASF1464
+	.byte	0x3
+	.long	.LASF1465
+	.byte	0x3
+	.long	.LASF1466
+	.byte	0x2
+	.long	.LASF1467
+	.byte	0x2
+	.long	.LASF1468
+	.byte	0x6
+	.long	.LASF1469
+	.byte	0x6
+	.long	.LASF1470
+	.byte	0x3
+	.long	.LASF1471
+	.byte	0x3
+	.long	.LASF1472
+	.byte	0x3
+	.long	.LASF1473
+	.byte	0x3
+	.long	.LASF1474
+	.byte	0x3
+	.long	.LASF1475
+	.byte	0x3
+	.long	.LASF1476
+	.byte	0x3
+	.long	.LASF1477
+	.byte	0x3
+	.long	.LASF1478
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1416:
+	.string	"biquadFilterApply"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF1335:
+	.string	"size_t"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1278:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1378:
+	.string	"log2f"
+.LASF1249:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1280:
+	.string	"_WCHAR_T_H "
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1254:
+	.string	"Q12 (1 << 12)"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF1345:
+	.string	"targetCount"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1302:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1434:
+	.string	"filterBankAddStage"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1288:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1298:
+	.string	"STR_HELPER(x) #x"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1338:
+	.string	"state"
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF478:
+	.string	"__P(args) args"
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1314:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1296:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1429:
+	.string	"pt1FilterInit"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1279:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1364:
+	.string	"type"
+.LASF1262:
+	.string	"__PTRDIFF_T "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1264:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF1310:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1366:
+	.string	"filterBank_s"
+.LASF1370:
+	.string	"filterBank_t"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF385:
+	.string	"DEBUG 1"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1422:
+	.string	"biquadFilterInitLPF"
+.LASF1421:
+	.string	"alpha"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1401:
+	.string	"result"
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1330:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1241:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF1381:
+	.string	"gyroSoftLpfHz"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF1417:
+	.string	"biquadFilterApplyDF1"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1432:
+	.string	"high"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1325:
+	.string	"signed char"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF1245:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1332:
+	.string	"uint8_t"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF1406:
+	.string	"filterBankStageUpdateBiquad"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1384:
+	.string	"firFilterLastInput"
+.LASF1397:
+	.string	"filterBankApplyStages"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF1321:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1320:
+	.string	"BIQUAD_Q 1.0f / sqrtf(2.0f)"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1313:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF1423:
+	.string	"filterGetNotchQ"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1374:
+	.string	"cosf"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1410:
+	.string	"filterType"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1351:
+	.string	"FILTER_BPF"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1268:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1328:
+	.string	"__uint16_t"
+.LASF1299:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF1285:
+	.string	"__DEFINED_wchar_t "
+.LASF1392:
+	.string	"firFilterInit"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1375:
+	.string	"sinf"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1293:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF702:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1363:
+	.string	"filterBankStage_s"
+.LASF1365:
+	.string	"filterBankStage_t"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1386:
+	.string	"firFilterCalcPartialAverage"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1352:
+	.string	"biquadFilterType_e"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1305:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1237:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1357:
+	.string	"coeffsLength"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1380:
+	.string	"input"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1393:
+	.string	"firFilterInit2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1274:
+	.string	"_T_WCHAR "
+.LASF396:
+	.string	"bool _Bool"
+.LASF1247:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1327:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1255:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF1409:
+	.string	"refreshRate"
+.LASF1277:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1311:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1319:
+	.string	"BIQUAD_BANDWIDTH 1.9f"
+.LASF1294:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1306:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF1244:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1360:
+	.string	"FILTER_BANK_STAGE_BIQUAD"
+.LASF1295:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1431:
+	.string	"constrain"
+.LASF1318:
+	.string	"M_PI_FLOAT 3.14159265358979323846f"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF1289:
+	.string	"NOOP do {} while (0)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1408:
+	.string	"filterFreq"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1354:
+	.string	"coeffs"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1356:
+	.string	"bufLength"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1304:
+	.string	"PP_IIF_0(t,f) f"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1303:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1316:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1290:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1265:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1260:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1236:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1349:
+	.string	"FILTER_LPF"
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1263:
+	.string	"_PTRDIFF_T_ "
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF1407:
+	.string	"channel"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1269:
+	.string	"__need_ptrdiff_t"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1395:
+	.string	"bank"
+.LASF1329:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1251:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1270:
+	.string	"__wchar_t__ "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1275:
+	.string	"__WCHAR_T "
+.LASF1337:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1246:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF468:
+	.string	"__PMT"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1250:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1312:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1258:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1355:
+	.string	"count"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF364:
+	.string	"__k8 1"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1253:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1323:
+	.string	"unsigned int"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1420:
+	.string	"omega"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF1371:
+	.string	"lrintf"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1309:
+	.string	"BIT(x) (1 << (x))"
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1385:
+	.string	"firFilterCalcMovingAverage"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF398:
+	.string	"false 0"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF397:
+	.string	"true 1"
+.LASF1403:
+	.string	"filterBankApplyBiquad"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1382:
+	.string	"targetLooptime"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1379:
+	.string	"filter"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1240:
+	.string	"sq(x) ((x)*(x))"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1350:
+	.string	"FILTER_NOTCH"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF1266:
+	.string	"_GCC_PTRDIFF_T "
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF723:
+	.string	"__need_NULL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1272:
+	.string	"_WCHAR_T "
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1341:
+	.string	"biquadFilter_s"
+.LASF1342:
+	.string	"biquadFilter_t"
+.LASF1331:
+	.string	"char"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1405:
+	.string	"filterBankStageCopyCoefficients"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1259:
+	.string	"_PTRDIFF_T "
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1400:
+	.string	"stageIndex"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1369:
+	.string	"stage"
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1267:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1322:
+	.string	"short unsigned int"
+.LASF1389:
+	.string	"firFilterDenoiseInit"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF1292:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1433:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1427:
+	.string	"pt1FilterApply4"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1391:
+	.string	"firFilterUpdate"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1291:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF1284:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1297:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1287:
+	.string	"__need_wchar_t"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1424:
+	.string	"centerFreq"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1390:
+	.string	"firFilterUpdateAverage"
+.LASF1301:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF389:
+	.string	"SITL 1"
+.LASF1347:
+	.string	"movingSum"
+.LASF1344:
+	.string	"filledCount"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1415:
+	.string	"filterBankInit"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1315:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1333:
+	.string	"uint16_t"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1359:
+	.string	"FILTER_BANK_STAGE_PT1"
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1324:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1317:
+	.string	"M_LN2_FLOAT 0.69314718055994530942f"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF719:
+	.string	"__size_t "
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF1398:
+	.string	"firstStage"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1426:
+	.string	"octaves"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1307:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1243:
+	.string	"VERY_FAST_MATH "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1394:
+	.string	"filterBankApply"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1362:
+	.string	"filterBankStageType_e"
+.LASF1373:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1387:
+	.string	"firFilterUpdateAndApply"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1242:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1239:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF1261:
+	.string	"_T_PTRDIFF "
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1388:
+	.string	"firFilterApply"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1383:
+	.string	"firFilterDenoiseUpdate"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1256:
+	.string	"_STDDEF_H "
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1418:
+	.string	"biquadFilterUpdate"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF1368:
+	.string	"stageCount"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1430:
+	.string	"nullFilterApply"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1276:
+	.string	"_WCHAR_T_ "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1326:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1252:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1283:
+	.string	"_GCC_WCHAR_T "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF1346:
+	.string	"index"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1343:
+	.string	"firFilterDenoise_s"
+.LASF1271:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1308:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1428:
+	.string	"pt1FilterApply"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1300:
+	.string	"EXPAND_I(x) x"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF1281:
+	.string	"___int_wchar_t_h "
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF1372:
+	.string	"memcpy"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1377:
+	.string	"powf"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1425:
+	.string	"cutoff"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF1413:
+	.string	"filterBankAddPt1"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1273:
+	.string	"_T_WCHAR_ "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1353:
+	.string	"firFilter_s"
+.LASF1358:
+	.string	"firFilter_t"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1286:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1238:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1334:
+	.string	"uint32_t"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1282:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF382:
+	.string	"unix 1"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1336:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1402:
+	.string	"filterBankApplyBiquadDF1"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1361:
+	.string	"FILTER_BANK_STAGE_BIQUAD_DF1"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1399:
+	.string	"lastStage"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1248:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1367:
+	.string	"channelCount"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1412:
+	.string	"filterBankAddBiquad"
+.LASF1404:
+	.string	"filterBankApplyPt1"
+.LASF1257:
+	.string	"_STDDEF_H_ "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1419:
+	.string	"biquadFilterInit"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1348:
+	.string	"firFilterDenoise_t"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1396:
+	.string	"data"
+.LASF1414:
+	.string	"f_cut"
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1340:
+	.string	"pt1Filter_s"
+.LASF1339:
+	.string	"pt1Filter_t"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1376:
+	.string	"sqrtf"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1411:
+	.string	"filterBankAddBiquadLPF"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1453:
+	.string	"libc-header-start.h"
+.LASF1461:
+	.string	"stubs-64.h"
+.LASF1440:
+	.string	"/usr/include"
+.LASF1465:
+	.string	"stdint-intn.h"
+.LASF1476:
+	.string	"fp-fast.h"
+.LASF1468:
+	.string	"strings.h"
+.LASF1478:
+	.string	"utils.h"
+.LASF1438:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1447:
+	.string	"string.h"
+.LASF1457:
+	.string	"timesize.h"
+.LASF1443:
+	.string	"stdint-uintn.h"
+.LASF1469:
+	.string	"math.h"
+.LASF1439:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1464:
+	.string	"wchar.h"
+.LASF1449:
+	.string	"maths.h"
+.LASF1454:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/common/filter.c"
+.LASF1:
+	.string	"/root/repo"
+.LASF1448:
+	.string	"filter.c"
+.LASF1475:
+	.string	"fp-logb.h"
+.LASF1466:
+	.string	"locale_t.h"
+.LASF1441:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1446:
+	.string	"mathcalls.h"
+.LASF1445:
+	.string	"filter.h"
+.LASF1444:
+	.string	"stddef.h"
+.LASF1473:
+	.string	"floatn-common.h"
+.LASF1460:
+	.string	"stubs.h"
+.LASF1436:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1462:
+	.string	"typesizes.h"
+.LASF1455:
+	.string	"features-time64.h"
+.LASF1463:
+	.string	"time64.h"
+.LASF1458:
+	.string	"cdefs.h"
+.LASF1474:
+	.string	"flt-eval-method.h"
+.LASF1437:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1477:
+	.string	"mathcalls-helper-functions.h"
+.LASF1471:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1459:
+	.string	"long-double.h"
+.LASF1470:
+	.string	"math-vector.h"
+.LASF1472:
+	.string	"floatn.h"
+.LASF1451:
+	.string	"stdbool.h"
+.LASF1456:
+	.string	"wordsize.h"
+.LASF1467:
+	.string	"__locale_t.h"
+.LASF1435:
+	.string	"src/main/common"
+.LASF1450:
+	.string	"stdc-predef.h"
+.LASF1452:
+	.string	"stdint.h"
+.LASF1442:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\317\002\355\f"
+	.string	"\324\021\303\003"
+	.string	"\037"
+	.string	"\211\324\210\026\026\002"
+	.string	"\001"
+	.string	"\001\363\250\340\303\002\036"
+	.string	"\002\203\255\266\373\b"
+	.string	"\003\266\260\205\266\f\006\002"
+	.string	"\002\002\004\263\311\277\326\001\005\370\326\343\301\004\016\006\241\236\345\333\017"
+	.string	"\007\235\274\262\242\007\003\b\311\276\204\302\004"
+	.string	"\t\276\343\274\342\n\030\n\302\265\230\372\n\032\013\377\304\326\350\003\022\f\262\243\354\204\f\002\002\004\002\005\r\311\253\224\315\001\n\001\004\002\005\016\263\266\227\320\002\001\006\002\006\017\251\320\360\377\017\b\004\002\005\020\246\260\243C"
+	.string	"\021\232\323\3622"
+	.string	"\022\327\301\222\217\016\022\004\002\005\023\234\324\270\324\006\024\242\233\2154\016\002\007\002\b\002\t"
+	.string	"\004\002\b\025\342\377\371\206\002\026\322\342\227\340\n\f\027\364\213\236\231\b\b"
+	.string	"\004\002\b\030\370\233\266\355\004\026\002\004\002\n\002\t\002\n\002\013\002\013\002\007\002\n\002\f\002\f\031\307\252\331\263\003\032\346\306\223\235\b\033\226\255\246\372\017\004\002"
+	.string	"\034\367\252\201\351\t\b\035\207\223\351\200\017\002\002\r\002\016\036\302\324\276\264\013\026\002"
+	.string	"\002\016\r"
+	.string	""
+	.string	"8 p\002BT\272\003\247\024\273w}\204\035\204v\264\375q\021\r\214\003.3(\f.\305\033\270@\001$8`\316\034\242A\235R\004\333\242\022.\310\r4\r"
+	.string	"\2051\337\033w\247\217\017\327QQn\027`\r\234\007\300\037@O"
+	.string	"\373\325\242?p\236\013\222\r"
+	.string	"Y\367\265\356\216\004~\020Z\220\033L\220\237\375\005\346,\365Q\027\224\365\207\004p\306>\345\211"
+	.ascii	"b\2617\331\",\bY\0247"
+	.text
+	.section	.gnu.lto_.ipa_sra.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`T\0025\t"
+	.string	"\222K\037\035pi\222\016\374\377\377\367UU\035\024P\005\252\375?\"\343\307\337\315\266F\b\331R&\031\tE\350\007=&\375\242\322\230 7\350QR\261\200+A\253\301XQL\034A\022*\034\031\342B\363"
+	.string	"\033\223\261\270+\222\345Q\243\323_Dp\n\034\320\023\206\323\364z\020o\346\035\200\327\036\336\213R\303[\375I\262\305\261\031-\255\310\203?\344\340\034\327O\313\264Z\263\215|\353oSX\027\002P\250\301\245u\001U\220Vv\003\200\202\031:\233\007\022"
+	.string	"\025%\307\303\016143\264\260\365\377\f\376\220\255\002\332r\235('\376!e\230\317\215s\217.\205\245\006P\353\353\262\277\221\037\353\202\361&\206\244\321\230F\026| \b\327\262[{8\363\307MAqw\205\030\223q"
+	.ascii	"\317\246\343j;\032^\322\306\343\311O\340\213\232\374 h\240\342"
+	.ascii	"H\341(\363$\026\261\005\234\360\027\302\232\367\342y\b\337%\225"
+	.ascii	"`\271s\316Q\370\346bt8\211\n\235X\315\245A\t\225\013\362\366"
+	.ascii	"\013\363\376/\207\274\257Q\246\311\201\237\001g\006"
+	.text
+	.section	.gnu.lto_.inline.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\t\020\235/"
+	.string	"f7\256G\320\224M\032\003P\255\303?\213[{\217\200\356\275\266k\2329\277\330\356\322<\324\257p\251|6\bk\276\340(\325\210\374\250\243\031\266\235,\034\274\326\003\347\004\216\004H\004\\Y\351I\361\322\201\275\331\bI\223\266\267\224)\202"
+	.string	"\226"
+	.string	"\251"
+	.ascii	"G\031-\336m\352>\006Q\237\320\345\202\327 \240\2429s\303\231"
+	.ascii	"*\231`\216\351\256\374\351]\267\306\343\252\247\207e\367y\353"
+	.ascii	"\341*\303\032\335\230\212\327\250mw#\254\355n\311\1770\376*\232"
+	.ascii	"+\315\324\341\f\n\355\256\311\360\347\376\302\356\322^\037\306"
+	.ascii	"\340:S\034\2734\225\277\201'v\367\001\216\352\354n\202\363?\335"
+	.ascii	"\335=\346\272\326@\244]\332\352o4\310\3562\320?ESsx\003\201v"
+	.ascii	"\327\300\017\330K\022\271Z\353j\250\001K.\373\267\273\273\236"
+	.ascii	"\226\270\335]u\327\\\252\271\\\rd\3764\365\247\033\263n\2766"
+	.ascii	"\031\316^6\331\\\227\253\325\362\274\025\226\262\324'k\355G\327"
+	.ascii	"V\313\037\256\250$gxfxL\034O\027\323v\214\257c\227\266;X\367"
+	.ascii	"\272{"
+	.string	"\355\321\350zi\333\203\351.S\357\264]\243\265\327\255?\225A\224\267\201,R?\213f\274eM\b\034\213\346\304\323\360f\301\247gx\022\316\360\274j\246H]4\255(\274a\231\313\232\313%s\224\321\"\f\003<z\001B\360\325jxr\013K\252J\221^9\351\340*\251\212)%\272\335\224TDn7$\016\240\336n\267\"\nN\321t\311\033\335\260\273\254Q\270s\224N\310S\361(1\342\216\247w\372g\332\343\250\347E\t,bBD\214\032\247t\221,\235\200\243;>P\370\274\274\222i\355gwQ\277J\2016.\bN\342\253u\224\301!!Zx\250\201\265\025%tT1\345\260\363\303\007\036\273\343\247>th(*1\275\352 L\032\216\245\0236\rmT\211\004M\307e\325'\214\177\232y\2468\237\350\263\363\247\026\"\034h\265`\376\364\345\377\027h\271t]\016$\033HN~\246AG=D"
+	.string	"Ln\301S^\307\fG=D1\013\200?\272R\265\305P\320Vk\2154y\347\335\301h\272\347\t\375$Q\262\264BJ\340X\232\263\251\b\346\004B\321\\m\001\\\313\214d\352b\350\206\022\374 \020\215\016\037>\275\333\b\246\251\201;bchD\013*U\3548\222\"\306\312"
+	.string	"\340\316\213\313\245-\fIA3to\020IA2>\b\277\305\201\033\202`\030\221I\245P*<O\023\007\n\001\2214T`\227?\026?\032|\035\213\211\332;\201r\025\b\353XT[\315\344\f\201\206\250A=T43\222\244$\3110\007\321\004D\031\204\244\225\362\022`S%\207\303(C\210\210\210\210\210\210\210H\n\212RRHc\263\247\303\360\330\327\374;\257%\361\333Xp\223\313\351Jg\344\306\200\370\324\025\277`\306\340\034\224\3230\362\200C|\2339\235\347\035\311\200\237\356\254|uT\"^\025\226\276\252\371\265Z"
+	.string	"\n\\,7^9g\250\035Z\343\276\311D\214o\306G\224\235\220\355@\323\201\343\220\233\224.Z\346\374s\021\331\311KHl\324\225\202\222\314K\325[\243\002\321\177 $\333M*\034\255\211\362\232\372\3547\255\210\355d)\356\207\314\306\374*fC+\231\274\272\332V\256}\331\2345\330\302\226\225\027\223\265F\025\370\020vi\271\267\254\031\314\345\300\375\267KFd\371\277\224n\035\232\375\rw[\354\202\034v\327\210\255\245_\230\354\233\320\327:Wf\246\016\205\3733\016?\353\234\177)r\222\307\272"
+	.string	"oJZf\232Ma\232\020\003\231\363%^_\203\375h\026\342$\372)\n\367\004z\255\037Y\370B'C2\362s\022\260!\334\220\034\264\236d\321\242\212\321\273\341y\234\344O\341\270{\372rFEs\237\250\024=@\177B$\025\032\360\230_\243yH\003\323"
+	.string	"9N\333\332?\320\002\371\315\374dz\027<\334\003\304e"
+	.ascii	"Q\034\314\233\322\333%rM\200\366P\313L?\200\032\313\215X,D\036"
+	.ascii	"\030W\316l\352\360\033>8\242K\302joh#\204l\317F5Q\203#\\.T\364"
+	.ascii	"\344c\0359I:\341x\027\373\377\223\224\357\244h\235\336\026\007"
+	.ascii	"\027\001\273\300&'\035\351\216x\264_\321\227<\227\216\370]n\021"
+	.ascii	"& \264\350W\026J\211J\355\267SX1d\307\0315\202\231\350\252\354"
+	.ascii	"\017\327\276wc\372\016\267g\271b\261\22539\355\277\242\276i\305"
+	.ascii	"<\250-p\321\347\3138J\007\353s\2316[\321\270"
+	.string	":\215\317\264\200\032\274I\263hnh\233/\202\305\325\365k8\240\210\207\262\261\017\024\314\314\\={\232:\303orW\267\013\026=}\263\341\250x\347\346\263\325w\260zd#\033g\320\257\242\342\254(\314\264\203\204\222\305\224*\033_\033\b\001\037\013.j[\221=\374\310\303\213\245\216\236\276\n\3745\326\256G\277\213\301F\325'Y\226\235\337\322u\230\343\376\211[|h\3730\340\0213\302W\304\b\216b\323p\013G\301\026\326,\307\n\372\244oQa\021\322.D}\211V\247(\274x5\315\234G\336\337\2159\262\007\267D\363\347\317*\277\356\315\022\b\314~\203\375'9\005\022G\031\214Z\211D\367\370\237\250\261\321\027b\3530\"\031\226\211h\001\224\016-+5\350x\363\r\235\235\314\003\264f\027\225\262)\303%\360\355\245\357\314\316\377P\354v\302\231\364od\022$\202!E\t\020\355\333\364\243\204Cj\177"
+	.ascii	"\210&\313WQ8\3236[\335\027\345)\247\224$\244\254?pSP\364\346"
+	.ascii	"DMPq\353Rev@\362\0334DT\302\231<(\230s\233\266}jx\215\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\261\005\355\021"
+	.string	"\326\026F6`i\222t \235\004\027\360F\005G\250\264\3725\244\006=\001"
+	.string	"\211\317\217\035E\021\245\0036\020Up\362\212\320y\034 m\255\245\305Q\253\355\355o\226\020Bd\222\0012"
+	.string	"8"
+	.string	"8"
+	.string	"\275\326K=G\364r\224G\270\212\027~H\305\340y.\020TIz\022v\364\257Vs\276\252\365\234^S\353A\224\315\267Gz\354\335\253\374\211\007\310\032\004\255W\001\300dI\226\231\201\225\254\270\314\351\255\306\341\241N\245S\223[\016\032\310\025\260B\270\310\270\320\211\242(\232=u\212\274*\210+h\316S\017Jo=u\nfB\t\226\013\025bX\323$\f\3460\030\366\320["
+	.string	"y\306'`\315\352\024\001\240Y41\260\212\373\321\327D\364\226\263\322\023^\302\235\013\"\223\0073\b5\250q[\260\267`\235,l=H\317"
+	.ascii	"%\220^\245\200D\204\323{\224\004N\025\342Q\246\177\030\320z\f"
+	.ascii	"e\013_af\342\330\240cc\211\236\303Hx\212\241\303\267M\341HoE"
+	.ascii	"\236\230x\236/_\016\200\202\250\021E(\325h\222\302J\233\001P"
+	.ascii	"\0021h\314\252\003\022`\222\251\212\203id\230\241\222@$\220\362"
+	.ascii	"+\2059\320\234\213\210\304D\250m\225\022E\337\377\310Y\240\253"
+	.ascii	"pS!\310\232\243\352\230\217Yb\267a\021\n\0033\030\362`\202\036"
+	.ascii	"\302j\t\261\343\340\016\345\005\336[\222\371\361~\367B\030,\230"
+	.ascii	"A,J}l\303t\231\217\275\\A\307\005\fw#\017\023a\004O\220\236\020"
+	.ascii	"\004\036\247\237\356\330\350\357&\017\003?\375Za\003\353p\232"
+	.ascii	"\0039M\333b-\\\221\247\232\221\255+\254\367\327\254\343g\327"
+	.ascii	"9\320\252\363\274\363\341\244\353F\213+'\243\3118YD\343\2543"
+	.ascii	"\362-<=\317\r\216\f\312\246Ac\367\304T\321nP\366y\201\356\277"
+	.ascii	"\361\026\021\306\324\223\325\240d+L\274A \213\002\234b\301\312"
+	.ascii	";\250^:T\320\022\337\325\035\350\341\r\307\027\272\"mR\206u\216"
+	.ascii	"\032f\334y`\264(\231q$\372\312(\025\243\036cA\263\263\023Z\024"
+	.ascii	"\341\225\0364\022\362-Q\267\307\214,\332\007\250\002\027\351"
+	.ascii	"\342\001"
+	.text
+	.section	.gnu.lto_.pureconst.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375 a\215\002"
+	.string	"\022F\023\034\200M\032\003\r\230\376\210,$\02321v\013\204!("
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\bI\204\020\031n\361\212G\361&\236\304#^r\210?\334\341\r3\f_\270\024)\341\b?\270\301\013N\360\201\013\\\001\007\250\"\207\\\177T\2167n\0273\303\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`5\005}\022"
+	.string	"6YO:@k\223t\313\372\272\340\362\253\216\n\363<\321\362o}\345\031\346\376;\303@\265\364(z\030\345"
+	.string	"\310\251\303\200y\372\032\332\217\375\377\244\232\266\352\377I\250N-\362[kD\356\0249"
+	.string	"A"
+	.string	"E"
+	.string	",\002\240\351\340\332\364\241\326\367a\242\310c{y\006\024\235y\272<\243\320\277\337\313\274\024=\224\272\255\307\203\217.\241\326\243)s\334\322\021\257\264\277\364\301\230\3722\304K\022\001\023\026\264\215\r\035!\315\201\206N\372\351(&i\2434\340\325\313D\311C\202\260\370-]ku\306\224"
+	.ascii	"\250#\2445\340X\353\265\036\317b%\357v\230\366al\330Z'L\200\321"
+	.ascii	"\241\303\t]\342\204\t\021\352\300\013q\242h_\0139\306W[\003P"
+	.string	"\001\013l\343\273\211\346\302\351BS\020\350\307]\370\270\346\376\265V\247\323\212\002\f\033\020>\356\301\364\030\275.\325a\f\242L@^\223\220\301\002\266\006\022\201CcP!s6\034\f\215Md\016\206\306&:w\224V<\371\033\357\232b/g&\245\270\306\262&~\n=\0039\224\370J%=\023i\027M\200\340\037'\305'\225<\224\2513\027\030qE\0056\326}\250!=\005Q\325\224J\265np\002\221)3\333\022\240\322q\216%\035e\344\202\013\244\260R\217\275\003q{D\337 C\007r\tP\217\376_\222\220v\002\025\356\337z\247\232k\016\251\337\247\345\326\342j\336\212\375\207p\373#\202wtv\2507\231x'\f\003w\224f\337\247\345\253\212\350m\350\333\243\232#Cq\304B=O\016\f$\261\340\234\262\334-B\261i\246n\312\355(A\016\220I\344#\232^E\304\330or\212\330\274Z3\234"
+	.ascii	"\020{N\357\034\207\\]\276 \0135\214}\325\273\243*#\027\311\004"
+	.ascii	" f\251\310\314+\326\315\256j>\336\021\213\257\202\372Y\232\235"
+	.ascii	"\007\356\343\315\334\366\240\204h\210\326\035s\320\320\362\220"
+	.ascii	"\315\215\355\030\005\254k\340H\312\2528\n\200\257\314\022G\306"
+	.ascii	"\312h\235\250\203\213\215g7\262&\024\205\035\304\226\022b\325"
+	.ascii	"\223\332\"}\206\354\373q\322\216\2657\364\t\304\n\226\207\214"
+	.ascii	"L\340\306\221\227\204\223\032\354V\212\272{"
+	.text
+	.section	.gnu.lto_.lto.ab66d8c948c4eb5e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.4.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\005\t"
+	.string	"F\321?; \0057\035\200la\261\224\006\272\353<(\271O\207\tA\355t\004=\300\247\002\317\021\337\002\200m7\272\201\261i\t\002\304`\200\225\324\317\273C)1\031\356+\020\331\2366\331;\245."
+	.string	"-"
+	.string	"."
+	.string	"\032\032G\313\006\013\316\356\326\203{\260\323\353\004\330\351T]\274\024\375\253\034a\345\346\2042]\0068\354\256\345\t\345q\317\333N\260\035a\373%\362+\263\334\331\205\211i\355.\310\017\331\351'$ti\037\345)\342G\333\\`7u\322\332\035AV\310N=f\266\375\222\233\2106\013\"\236\234\b\306\314\360A<\0374+s\354\321$\347\210\375kg\312\376\352\377\354\324\024\310\354v\004"
+	.string	"\2603\324\205\304\366m\213\266f\177T!\031\245\013\322\310\243\346\026\270\256a\202\201\333\0060w[(*Ux\024u\004~\037\330\325\221'\361\325.\264\250\233\201A\222(\254%\020\f\253f\333\343\376\332\231\n\013"
+	.ascii	"4\211\220\326\300\254\305HB\034\225\213\\\303\205\263P\254\t"
+	.ascii	"\271A\023=JJ\347\232d"
+	.text
+	.section	.gnu.lto_pt1FilterInit.5.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`X\001U\016"
+	.string	"v\\cD"
+	.string	"\221(\035`\314$\266|\246K\277\024}m|\326\336\371\214\210\\\236\032n\201L/\023&XYm\0325"
+	.string	"\302\b\026\023CA#\274\324\325|\334\206\251\271kA1!\332p\214\256\240\021_\t\"{K\231RN"
+	.string	"K"
+	.string	"O"
+	.string	"\272\353\202#\202\366\b\262\021=\037\343\237\370\213w\030\225\007\330e\315\320\354~#F\240=\372\373'{\324> {\264g\347"
+	.string	"q"
+	.ascii	"0\203\245\305cw7\025q\357\351\371o\035d\325\262\362\374\200\260"
+	.ascii	"\273\316U"
+	.string	"\213\207[o[\304\366\004\3734\002\227\371;\207\371\265\177\177\006\323\021\246!L+L\247\246\357\361\250>7v;\304`\373\2120J\330\276\375\025\236\035b\027X\021\314\267\374\024W\341]\306.\203\354\312\310\241\331\335\021K\320\036\017@\320\016\221\346Q8\001\003\357\237\006\007oA`\304\207\027U\033\3453vi\273\333\300gQJ\361\330\220x\364U\262\307l\255nR\355:\b\330\353\265~\020\213\3016\354\242DT\257\252Ie\314\327\324\253tdzM\034\226\034T\306\3741Qc\263\207\375\255\244\206\260\017ww\255,;\024H\362\224\302U0\211\036)\030q\016H\026\214B\0022s!S\311\351\302\211\311V\352H\244\216\333J'\026H\033gB\331B\006\334a(1m\247\2563m!\337\036\256\262\342\213\027JS\216jwwq\234\325\r\324\216FU\033\252\232\216\252B\2151T.\251\230\216\332\031\002\027"
+	.ascii	"4\211H\313\224\231x\233\217vw/\245\304\223$\030\212i\016\214"
+	.ascii	"\201v7\365\003\355nC\230\244\025\037j \223p\303\213\025\262\313"
+	.ascii	"\004\034\343\204vc(\334\341\032^\b\223\f"
+	.text
+	.section	.gnu.lto_pt1FilterApply.6.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"M\f"
+	.string	"\266\027T?"
+	.string	"S\225\016\274B\025\305\237\247\226\034l\254\">\364QF\251\341\013y\021\210\300\202\324B\333\315\"\005\200(9\030\032\327P\252^\325\246\024\fm\260\"\322\356\216/\216\nQ\003\304\222M\244L)?"
+	.string	"?"
+	.string	"@"
+	.ascii	"!\273\037\306\t\262G\177\231m\377"
+	.string	"\304Qxv\013\302i\262!\207\006\220\307\356j\b^\301\036\257\023\300\036U\304\275\247\347_\305/!t\244T\244\247\304\301\356:S\252\016\267\336\366\305v\004\373\247\377~I\246c\246\257Lk\2463\323\017@\271Q\200\306.\207\320\307\326\2100H\330\366\354\211my\241\311<\210[\006\260\033c$dw1~\220=Z@\315\323>\353)\274\177\243\013\330]\271\b\036TS/\215?P&L\031\372\232\251\252\004D\2250\211\316\"\025cc\370\n\267\030\370 (C\266\273\037\361\350\217\260\307\353\201\021V)CWd\330\330\354a\177\244T\020\366\257\325\225}\220?\013!\021\350\323\211\336(\330l\r(,\330d\006`\3362\035'd\241SA\373p\036\017\267i\237\316\004\217\266u\027\264\214\001s N\247\2058\256\323&\337\336\216*\341CIM\256\314\210\332\202\202C$\265\243\224\241/\275F\275DP\001\025"
+	.string	"4\211H\313\024\231\241\301\b\246E\022\231C\260X\034\274u\002\201b\006\006\227+\212\272\245p\277\305>\327p\202Z\300\221\005_LH"
+	.ascii	"\215\365(\321\235k\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterApply4.7.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\274\002\035\024"
+	.string	"\266\245\202I\320\362&\035\n \252\304\347\274_\276\207\027\224ZY\216G\352\354!7G\242q\363\310\026\310R_\003\020fMK\310\323\3477\034\342\330\212\034\304N\362\233>\242\342\271\255\205 \234\244\277\020\305m\317\223P#\204\354-\245L\001k"
+	.string	"c"
+	.string	"p"
+	.string	"\215\264\243\250\273W\356\340\323\2112[\351\376\032\244.dz\303\321T\267\317\214\242\356\333\312\r|:\177\373\376_Yh\013\331?>\310"
+	.ascii	"rh\322!j\352\3560EM:\235R\005t:\371\204\312T\362\312\256\236"
+	.ascii	"\213<\022ac\3076S\tBy\304\226#S\272[a\350\362\330j\273\236Kw"
+	.ascii	"\177wl\036\364S\377\277\374\217\360\263*N\377m\266\374\363\253"
+	.ascii	"\354\356>\373\374*\244\252R\234jJ\207TI\364\246:\262{p\367\""
+	.ascii	"\273G\355\376\333\275\267\373n\367s\367r\367,\367\273{=Y\341"
+	.ascii	"\006\214\335\035rO\2754\215R\374\227\375\340\217\362\203\373"
+	.ascii	"(K\232\247\326\003a\304J\356\177@\201L\2070hI\327phx\331\260"
+	.ascii	"\332U\241\217Gu\334\261$\022\223R,y\362\364!\366\324"
+	.string	"\204\244\370\277\240E'@$ZN\222i\220\350\330\034;=\230?\252\211\247\245\245~\203\\\356)\247\233\246\"Y\305\244\332\346\276\314\254\"\017\022^f%\235!- \333\3353\346\237\217\377WE\031\346\005S\316\006\371o\2432>~\335\275\340\032\003\346\346C\241\363\212\323\351TV\001\005\3216w\223\0377z\003\022b6v\303\242 3c7543\363-\bZX\fb\022\264\260\004\350\316b\201\265b\026fdB\232\227\313\365b\20543\025\\!\013f\023\262\020\370\253\246\005\013c\257\027,\004o\255\262\331\007\344\t%h\\\373\342B\200\214\004@\204=\006Y*\211=(\376X\204\247\020q\205\307*F\261G$\252\250\361\361\nS\320\357\322#\217\0130\005\321p\037d\307\377K\215\224&\247\0022 p\002\231\261\263\003dD\2441E\214\347\274h\242\215\331\301\265\030\226\300]\226\020U\2400\020\362"
+	.ascii	"\360\340\226\222\006g\265\314\250D\315\342M$;#\354\025\243gz"
+	.ascii	"\030\276`\\\273\345G\206oole\206\363Vpf8Cf\350\361u#\253ML\243"
+	.ascii	"P\023\236he\321a,\220\345\230\0038\0270\004\201#\206\201\024"
+	.ascii	"C\002\033\213C\261\321\206,Rn\273\202\036"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.8.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\237\001e\017"
+	.string	"\246\335fC\020\221[8|1R\013\323\314\226B\232\221\300\013\365?\353\203\371\265\304<\036|\344@\224\367\r3k\354|\032\206\375lv\310$\\\200\212\002F\"D.y\002\247\022,5H\361\231\355\022\022\021!R\246\024S"
+	.string	"O"
+	.string	"S"
+	.ascii	"\327&\306G\246}\026o1\372\270\301\327.\312\013\031\273#\003+"
+	.ascii	"\320~\005H\333\376\212\253\214\354\026k4q\3420\0358\250p\354"
+	.ascii	"n\3079\001\354\227\365\001\330/-\361\321s\344_\365\013D\b\027"
+	.ascii	"\250\023\3223\203\260\273N\324\311\207[o;\201m\nvn"
+	.string	"\002\276\265:\302\326\264F\323\334S\367\366\225\337\343\343\257i:\3234\246\351K\323\226\246U\323\251\351\003\320bTv\030\270\261k\262\322\2614\256\031(\236\372\355\221\2572\267\211\371x\312-\032\311C\001\021\306dfw\027\374\362\004m\343\262\"#A{\267-`\312)Q\322\246\032\275\230\222\233\332\240\bv\324\245\036\224\022\026\025\233>uN\251\345\266N\273%\004\226n\372\0271\005KU\233D\003v\224\245\234\223\222\234\2322\242\213)W\366\320TL\245\351U_\304\231R\256\234,\"jl\346\260GR*\t\007#_\006\020\221\007f\237\017(\"\3610{\032x\274\007\025\034x:\002D\2760B\370\211B\237\267\331\353\204\237\350B\310\247\013\201 \020\350u\241\020\020P\347\205#]\347\200A\f_\330\211@0\354\270qos\312)\251\311\231b\312\251e#O\227f\232\251\304\024\246\\\231K\215\036F\037"
+	.ascii	"\204\223\240\314\2000\354\307\006<\315e\261j\354\252\265#\254"
+	.ascii	"\322\002\002\243a\370p\r\254\224\216`\270\r1c\b\304/XC\327C\255"
+	.ascii	"\335s\325/X\270&:\020\0331i\341|\243\330\023\002\002\303\300"
+	.ascii	"\020\024j\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.9.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"]\013"
+	.string	"f\225OD\020\311*\035"
+	.string	"_\260\030\300\374\322\240\004\240\273\034\360v\002\336\251\224\260\3578\367\363\202\200\225,\216\250\241\231\334,\030\342\365\315\200d\210\2010 U\002\031\316\"\261\271\nw40K\027\255%\215\220\275wJ\0018"
+	.string	"@"
+	.string	"7"
+	.string	"\265\335\262\343\n\357\234\313Ct\347\274?t\347L\332\021^\022\330+pI\231\335v\367\243\003N~\222\376g\317\254X\251OL\306\356z\256X+7\275m\216\355\016\373\024\001\021\022vU*PX\033\307\240\200\355k\354\215\201\017\225\225T\206E\001\360\262\341\235\333\b\370\314\362\t\310\307Lsf\267\301\255\266\273\035kx\347&\352\246\345\363i\337\365\027y\230\311\033v[\016\002\230\351\237:\323~@\345\262\255\353\256\212S)\245\223\332#$\363+\327e\241)\317\005/\b;'\330ej\322"
+	.string	"\366\353\356\256i\313\276\354\257\217\375\364\260\177v\035\354A!J\304\361q\n\307Q8jD\3021\264`\220\005\b\304\360\270"
+	.string	"y\034:\203\2361D\201\220F\237I,\225D\3603\221D\245\017\034O\237G\302bH8~(Q\034?M\271\257K[\016!\260\251\350\211\003\020"
+	.ascii	"6\207\323$,-\243e\342\245\320hp!\252\325%\343\032\333`\306\026"
+	.ascii	"Z\270\023\206\007b\200\023|\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_biquadFilterInit.10.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\267\013\345/"
+	.string	"\212PT\021GpZN:7\354\323m"
+	.string	"3\035T\332\261\260\351_\325(l+h\216\221\320\314a\262\036\220\270e\315\266r\345<\217\231\036\211\352P(.\373\f5\3275\222\333&D\245\250\257\271\273\355\213\331?\237e+!D\356$\003\005\001\350"
+	.string	"\005\001?\335\201\314\177\225[\271\363W\216\345Y\016w-\237{\035\007\205@\350\312\224G\344\204$\233\020\231\343N\f\271\206\230\375Ry;\341\305\203\210^\n,n8\262\352\240A\260\304<\225T\245i\2532\305Gdfc\347p\356Y\342w5@\027\221y\215\235\277-\030\302\033^\322\364\356\275\006\256\362\b\026\352 \246T\262\314t"
+	.string	"k\2623\375\271\313$\023\016\277\253\302\025\304\226\202\"\375\271\\<nT\370]\035\342#Z\346\237h\035\n;Y\347\3368\274\347\275\367"
+	.string	"K\370]\035\246Ch\210\267\314_r&Zo\242\342"
+	.string	"\356\035s>\357e\036\340\002\277\253\314\374\320z\365\367\240\365*k1\347\235Iv\037\005\310\212){\367^\247\376q\255\257j\332V\213o\311\234^_[_\225\324\244\271\364uO\317rp\361\372\232\361\356\342J\256?\367^\340\2272\2659\021\356\275l\275\276b\234s\316\314U\314\274d\016\022\t4\236\317\202^\203\0303[\001w\273\0031\333\\#\354\277\ru\267P.i\243iPw7\030\345Y\222\213P?NJ\250.\250/\367\263@\315\\u\265\336+\250;\210q\365\026\333\346\034P\237\356C\244\363\3202,\354.C\210F\267p\335\213\024`\033\250\255\025"
+	.string	"\375\266}\345Y\322F\371\247\337DxJ=\244\215\262mj\271\273\226\217\231\271\365\364v\017\346\247\267\307\230\337\344\037\320\3044\\RJB:2*\":\225?\300\337\316\3027\377\241\307\235\205.w\016:\335\031\350P~"
+	.ascii	"\227\362\377|\355\354s\266s\317\333\316<\177\236w\016=\007\357"
+	.ascii	"v\006Z\313:\326\362\317Z\316\261\226WkY\265\226Sk\271\255ek-"
+	.ascii	"?\0010F\027#\270{_D\341\\;\025J\344k?\333\337\366?\177\350\357"
+	.ascii	"\366\277\375q\277\\Q\226EO\377\330\3444\263\321\256\330\351\234"
+	.ascii	"5k3\213\260]\301^\255Z\032\265\231I\330$;\177\367\336\006l\221"
+	.ascii	"ZIJ\360\214)S\261^\265S\274x\032\330j[<\245\334\353\016T\343"
+	.ascii	"\002\354\273\005"
+	.string	"\373\320\235\376\223\247\337\326c-\037\373t\004\344\230?]\341\216\216\262\030\031a)*\272B4D\022\251A:\271\273L\356\256\022\275[\2654\025MI\t\t\233\221\244\244\260\"\317\035H}(\222\216\273\251\341\300\273U\263\221\356\250\321h\352\257}\210l2\223\301\324gK\307\204\232\351\fl\330o\373P\330\3030\265\257g4\355C\377$\266\323\354[\352\273-\365\301(\317\204\332r\245f;M\276\227\371\272g\267e\373\230\231[\357\356\3614|5\226.\217\217\346lfW\314\f\377\f\347\375\356\335z\030?k\275\312\326\353&\227\230\335{\t\234\f?\354Gva\\\346%p5@\017\273l\034\266M7w\027\016-E\021F)*u\352\312^E\331\342\210\243\211\242\232\340\203%~\260\n>\330\004EK,Z\005Ek<\242\300`\341F\254\342\205\021WF\253\020F\253`\225\321j\002\220\237\026<E9"
+	.string	"\301\340\t\001\320\312Q\b\254\214X&H\204p\232\242\222\222\242\212r\232\"Q\224r\212\262\272rBp\304TG\243\225\023\026\025\225\225S\220y\237\336\036\343\007>\324\243\206\362\221*\3651mH7u\227\211\271O/\037\314P\215\032jFZX3\265=\023\346=\275|\240T\213\032J\231&\3651\315E\017\333\226\2019O/\241\332\250D\375\324&\375\233\037\321\342\234\371\362\235^B\205Q\337\367\2470)R\037\321\362:\355\227yy\260\227Po\252\260\237\336\322\357\375\210\266\245\227\332\004Z\230\375\335\201\275\244"
+	.string	"f\207\354$\333\032g\316`oh\2604\326\276\300\316\274\301\312\340`cD\357\256\2133w\2600\230=\330\026HdJc\366\220}:\315\\\264K\237\326q\363k\346\200\356\250Q`\306\230\221\022\021Q\220$I\2415\340\002\221\231\032\347\022"
+	.string	"\305%\n:C\321L !)\243\240 \256\031\030l\262d(?\226Ju\303\362\300h\337\361\254\262\354Y\372\263\235\223/\237R\360\314?\235H\253\005W\311\016\3154\035\304(\272\024\372l\351/\270\231w\2646l\215\361U\306\343\251G\306W\215?\276\317\361\b\202b\034l\037I\025\277\362\343Q\242\307\207JR^ f\251\0064\0331&\252\302\363p\207\252\307!\220a\037\221H\031(\336\360\225"
+	.string	"["
+	.string	"L\262~\356\225\013f\262\023\331q\300\260i+\326:\bn\304\362\375U\023O\017\210\013\232\302\026\02639Q_fY\357\030\303g\371<6\310\333\274\271r\374kb\375\0022\223\275\310\370F\244\261\351|\244\023\f\367Y@\345\002\272\233z1\333\254r\322\270\257;;\273\226\3656^Y\204_)j\\\026\031\325\2766\007!\022\367n\230\312\315\327\t\020\2114\025\204"
+	.ascii	"\263\321\340\021\351\177\213E\231\370Q\236\272I\305]qT.\201\317"
+	.ascii	"9CL\254\336W2A\350\246\244\177 \244\270\033:\031\255:f\351\031"
+	.ascii	"G\017\340\201\356z\3435\211s\201\263\245\323L\035\226\334_\256"
+	.ascii	"\363\217\212\030\026\004\032\200\tmc\237g\306\346W\256P+\022"
+	.ascii	"\317\260\240o\330\324\304!D\320i9x\r6p\024\253\251\332\030Q8"
+	.ascii	"\2379\231\317a\272\254W\211\2406t\241i\n\303\273\270\357\316"
+	.ascii	"\367\210\202\371<*X\375\214a9.M\220`\355\007\247[7\024\177"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.11.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\\\004M\026"
+	.string	"&&\211K\260\022R: \347\234\204\2609`<\220\375|\205\257\377h\267\370.pe&\256MM\203\214 \257\332\332\336\342x\033\312\177\226\307\345'\037\253\2417g\207<X\027\362_u)L$\367\205\300\017Jc\222\320\266'\215\020\262wJ\001m"
+	.string	"u"
+	.string	"n"
+	.string	"3\236\263&\355\306\222\33511$\301<)\023rR\337m\360\216d\241_\273P[\303\335=\361\003\363\244\311(\323:O\355\033\235\006\357G8\017\260K\0245\334\365\2358\201y\322\276\317\312\223\346\007\224'\315\263\265\356+\332+\371tP\n\262\273\264\212\342\274S\236\177\247\277z\200z\247.\007\273k\332\003\024t\327\333>`{g\2170\002\300\333\365\340]~x\223'\336\343\213G?\225\301\246z \270\332\375)Bd\251H\342\212\377~\340\037\374\207?\361/\276\264\377\033\307q\341s\274\351N\216\315\212\212\036l\\\020\177tFC!\232\245 \b\231!\320B\223\235\222\365\341\020\202E\214\324i\377,4{\037\b\360X\211"
+	.string	"\262\273\nN\372\305\263\241sd\262\311\272\020\264d\341X\262>:5,\230'\0036\f\364=\036W\250\366L\1773\314\372\037\314\253L\031\256z`\314\251\\1\312\372\340\355<\312\027d\375\020\367)\262\305XO\244\271\324H\242\326\027\257R\"\3075\207\262\320\334\335\006\376\323\006\r\005\212T\234\364q\312\223\265\222`\035\345\320\"\246\277\021UK\207\330\276\036\255'\354\217[\211\3543\375#_\372cO\372aG\372_\377\335\346\003\347\rM\271\241\347\216\246\354\350\331BSZ\250mfWa\302m:\026\n/5\266\234\213-\027\243\261\345 \300\274\262`\245\246\322\302`\005E@\351\032J\316\246\313"
+	.string	"\343B\223\301\335n\270\032M\006\206\345F\253\345jh(\006\214\233\261\345h:\034.G\213\371\366\343V\242\b;\250r\252\216\315\272\245\303\216yVTY\355\333\177<a9]5Y\221\370\220\245\020\202\r\001\320\221\032\253\260\372\252\264\332\001Z\250a|\244\324\004R\n\312HI\323\006 \003\021)\251\016\021\360,T\220U)_\313\335\270\016\265*T\203S?5\025MF\312<\222\276\\\216\355$\006\270m\013\0349\361\310\016e"
+	.ascii	"WL*U\333*\320Q\021t\325\314\002\252>\230\032\273\025\326\314"
+	.ascii	"&\223\314\355\361\363\206\246\373\314Y\262\363\206\246\273s\346"
+	.ascii	"\264\374$B\331\250+\322nO~lH\252\016H\325\250\256\326\007J\365"
+	.ascii	"\240\244>\224\364\301\201`\200\227\317\023\001\271F\017J\002"
+	.ascii	">,\242~\002f\005#;\306\227)\346\033*8\360\027[\245\002"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.12.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`E\003]\024"
+	.string	"\326\345\202I\320\322(\035h\022\206\275;0\231%\354\261\204^\007t\254\f\310b\2328}(ES\013%\273\213\251\374p\333v/\035\364\213v\201\204{\354Q\256\305i\250\301\200e9\336\033P\360\013\340Z\207_\344\277\354I#\204H\231Rj"
+	.string	"b"
+	.string	"r"
+	.string	"s\242<\364\203\221\364YQ\375\216}6\315)\364\343g\316\231b\007\343C\262\\\271\332\337}E\355\245\314Us\332\f\375\314Y\2468\301\370\320\345h\333Wq\235\232\355\003\313\02287J\241\241\327c\316\311:\371J|\b\276D|\270$^\273\326\374\367\016\242\300A\312\321\314\\K\r\346\234\326\034M\207{o\373\200m\b\366\262\b?+\217\017\033S\223\354rF\367\306>8\327\306>\357^}\347'_\376%\252V\251\232D\325#\252\026QuJ\325(U\237T\035\242j\223\252GU\227T-\252:T5\250\352U\265\252\372&\247\232\032(3\346\334\360\0032\213B \023\347\375v\315\357\371D\n\255\330\274\f\343\f\207"
+	.string	"\271\033\035\0353!+\262\004^\340N\240\366\264\251-\300\003\366 \324\036\311\302\201N\373\034\246\0257d\005\004\031\267\264\24651\302\345\334b\377\031\367D\272\235Mv\030\245\275/\\]q\303#\\\r\270\273\341\226b\340rn\027\356\003\356{\272\235\r\346<\273,8\310\375\352\202G\270\234\233\376l\307\334\205}\343\234\223\305o\021\001\303\210\363\320\227\021\037~\r\350v6\r\264\226\030\230\327L\244\305\274\270\300B\267\024\264\\\f&,h\251"
+	.ascii	"\020\355R\231\275h-0\n,\027Y,&s\261\\`\022b,\327\f\206\2452\300"
+	.ascii	"\262\227\327\214E\223\311f\254S9\017\316\265Ymk\204mo\326\036"
+	.ascii	"\021E\037@\240\226\310\003\271C\244.D\017\r\2704R7\264\227\333"
+	.ascii	"\361[\355y?\261i\222U+\262\253U\222\035Y\325\"\350\275.D\262"
+	.ascii	"\032T\3412FV{\251\r9 \320\"\221\253y\264\210H\351\024Y\361\370"
+	.ascii	"\244h\2203L\f\271nh\211\266\236\310\236wS}\025\315\005\315u="
+	.ascii	"$\315b\316w\266\366*\355\242\201`\206c\21335\267\364w\315<1\242"
+	.ascii	"\304;\246\004\"\226C\214\224|G\224\030\363\362x\257a\244\306"
+	.ascii	"\302\020RbD$\363l\207I\315\2041\245\004\031\362rj\301\231\303"
+	.ascii	"-L\307Q\022\346\023\262\221\302+\306\3345\361T\245\230\256E\006"
+	.text
+	.section	.gnu.lto_biquadFilterApply.13.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\235\002\315\021"
+	.string	"\246!tG\360\320&\035\320YK\177\264\033\206t\337\366y\253\343\246#\320#c\350B\343\334\374\245\207\267\257Q\252\212\301\340\370\323\0246\331k\215v\3520u0bB\250'\351\345\027\236\241\235%\026\334\261U\262M\032\331D\312\224\002\\"
+	.string	"X"
+	.string	"`"
+	.string	"&\355\016\345\240\355.\212\025t\217$\026R\236\366{\356\363z\030s\221]\034\027\264\335\020\305\004\272G\207\235m\237\347#^v\320\026r\320\271\215\027\025f<v\027<9"
+	.ascii	"\356q\373\307=\352\206\277\236/\377\263o!<\324b52\317Q\202\335"
+	.ascii	"u\306j2\334z\333\003l3\260\325$\262\373\373\317?\362\360\027"
+	.ascii	"\311tH\246A2m\312\364G\246\275L\2272M\312t\227\351Q\246\271L"
+	.ascii	"\307Lo\231\326Lg\246_\342\321h\240\310\330\275P\353\2613\242"
+	.ascii	"\320\207\313~\373\345\317\354\221\334\244\3302\n\235\f\206\222"
+	.ascii	"X\016\f\035\273[\340\321\013:\022\r)\231\377qP\332\201\370\224"
+	.ascii	"\323\221r,`;\254\253\340\364\264iT%\202\355H8\212M\003\360|z"
+	.ascii	"\331Of\262\310\252\251\237f\n\230\315\313O\250\252\340\030\321"
+	.ascii	"k\352F\004\333\241\311\232m\230\233pP\267\273*~\211\006\023:"
+	.ascii	"\235G?\206{\274\n\350\3203\2235'\220\210\032\233Ev(\223\232c"
+	.ascii	"\177[\305\261\037.\026\230\227\225\026\347\202qiQE\243\f\240"
+	.ascii	"R\b\036\034@\235F8\247N\255\025\027\213\n\002\330\302Z\255X)"
+	.ascii	"\260E\345`\005\246Z/\340\311\304,\227\225\026\350b\261Z\240\027"
+	.ascii	"\356\355OQ73J\343\004\362\t\321!\020\375\320\020\223\202\250"
+	.ascii	"\336\302\344\351G\204\257\360H\224T\310t#g\261\035$\355\264\244"
+	.ascii	"\243\0300\233\325i$\375l\2441. \360\"\221*\333\224\211H\305\024"
+	.ascii	")40\302\202\304\357p\330\274\305\235k\007\215\031\214I/8\306"
+	.ascii	"\203\036!sV\032\231\002A!\216\345$X\224a\310)\201:c3\266\033"
+	.ascii	"\306\351\250=>l\024\351\374]{\301>\214YJ\220K^F;8\313p\211\242"
+	.ascii	"8J\204\371\200l\224\360\212\231\373M<U)\246+\223\001"
+	.text
+	.section	.gnu.lto_filterBankInit.14.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"-\013"
+	.string	"f\326PA\020Q\234\016`\351{\005\241\261\265\257g\r\020^7\263\t\220\253\227\215"
+	.string	"\352\027@\365\f!\266\246i\bc\"x\3678YU\265\023t\tH\377\225\355}\342\031T\273\341\320\333\223\216F\264\211\334)\005;"
+	.string	";"
+	.string	"@"
+	.string	"\273\244\023\212\335\260\200\007`\227\016\377q]b\237\\\227\376\354\030\017=\354M50\230R\273;\265\303\277\307\317\377\210s\200\243\317c\204\301\356:\202#\r\267\336\266"
+	.string	"\333\020\354\007\b\366\255\335]+\311~\370\313\227~\265\242\037\311l\260\230*v3\254n,J\246"
+	.string	"a\373\231=\20115\332\006\022|\017;\326\335\r/\032`\227\023\324|\264\037\342\"\276\227<\357\b\333Mt\260\335U\340\227\270\320I\\|\270\364=\327\245\232@\031\240\270\262\276sI\275\202\234\020\315\b\305\225\263T$*\211{\305E\340\252\266\206\023\017\032\200H?\216'\032-6\252\354\360\023\225C\033\216\3239\310\\8\316BA\223\270r\240\242-\220\200\240B\361\250\300Y\"X\326(\336e\223\301L\230\\\267m\23569\214e\233\232\247\231\224\020w\026.\336\334t\2357\263po\255\222\374@\205\002i\310W;\013"
+	.ascii	"\006Td\306K*\032x\344\001\254 $\352\022q\215\r\013C\200P\263"
+	.ascii	"\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_filterBankAddPt1.16.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375` \b\r."
+	.string	"\232O@\021HpZN:\355\b\007Q!9\367\241L\013h\215\217V8\201lo\211;\030\202\365am#\325\356T\321l\n\225\377\253\322\3567\300.3\214\016\225wT\034\027\200\271\371\200\246\003\0349Pc\206\242\355\233Z#d\357$\003\371"
+	.string	"\366"
+	.ascii	"\002\001`t\302$\252\265\037\013\213\372Y\033\353tF\350\300\350"
+	.ascii	"\216\362\2538\375\216\n\253\250\314\247\342t\261\251\263\265"
+	.ascii	"v\272JY\343\310e\226\342+\371\027|\2432\213"
+	.string	"M\275\215W>\033G\036q\335k\320Q\316\020\234SQ\313\374'\207\"\365(\314<w\232Fq\253\331\335\n\030Cz\024\350\f\206QO\313\314\340\201\324W\250\357t\321\313\214\n\351\321\340\232j\355\303\242\316\323\335U\246\331\275*`\004\351\32139\230\024O\375\254B\260~G\035G)t\335\253\312\353}xG\323\013yGo\020\276?\3273\317N=\355\361\320\323N\361{\024\224?\275\226\204A&\251\236\022\360\201\245\365\336\271\323\335\300\344\361\\`i$cX\036\222\254\243\177\373\231d\211\022\231\314\372y&0\223\324\001LV\235\302\033g\300\234\354\004\222\\iY\333\243\320\335l\221I\254\263\357\314\214\203\231\243\230S4\027\b\363\257\304l\210\023\276]\314\250e\037\324r\017jY\210Z\016\276y\3469-\357\374,\003\370Y\006\262e\235\234G\371q\276\376\276\207\375\351\335\316\347i\371\376,\333\323\362\005"
+	.ascii	"\325\334\206\330\272\255\356\354\272\r\305b\344\315\337\355\302"
+	.ascii	"\034*\277\361O\230\2452\273qYJu\225VQ\n9\221\236\215\371\307"
+	.ascii	"\303\243\361\325\276\345]\356\r&\035\227\"\002ZE\355\271\f1\364"
+	.ascii	"\317\352\013\032\030\335\3215 \252\265\255\322\250\247\375\032"
+	.ascii	"3x0\374\n\365\323\027.\315,\351G\214\212c\2376\274Y\322\225\321"
+	.ascii	"'\225"
+	.string	"\034h\302\031*\237!U\326\3622\251\233)\245TW\276\261 [q\335\035\"=\372\336\271\220\227e\310\374{\223O\306?\256\341\364)|+g\372\212K\257\356\376-\2570\001U\255\235\fS{\366K\247_a:\327N\362\3428\244G\307\316\326Z\033k\304W3vmm\335<\341\356\316\256\252\233X@xoT+\336\340\265n\214ql\007\301\244\313\321\261#us8\367\\n\327\316\024\210h?KJ\323|\367\367\3077ag\177\215e\223\267f\"\326\\\376\312\277\313\306W[\217\267\366\3627Y\304\3250\335\037J\2574sF\276,b^rS\274\243=cx\360\020Z\216;\257\361\202\316s\371\315\022'\354\221\fd\274Tl\227;x\356\233g\342\"6\177f\312\300\221o2\2438\034\221\220\220\356\226p\364M.\272\031\243\003b\216\362\334+\005\231\005\274;\267\007w|\003\340\222\201r \346H9"
+	.string	"\267\007g\334*\332;\356A\263\326\311uw\237\027\b\024\017xS@\351Re\331\360\233|t0PiwC\340\177Yb\301/\022\305;\n\274\3001aD{\307';\316\362\306\231\367\231a\213\253\233;\023\357\313\364~\354@D\333\206\355\362\353\255m\033\346\265h\003I\351\007\025\026:\030\360!\235w\344\002\352\351<bQ\364\344\204~Pa\237^\030\021\255@y\250\301\220Q\004\025\016\206\204\202IKE)N6\022j:zj\201\264B]\032*)\r\215\324%\244\"%\325\250\311I\025\032\300C\027GM\352\323p\330\244\376V\342o\027\367\216VGf\217\347\236\354\027\302 \225L{4\327\321\271C\\\304[d\273LK/\220\336\355b\235!h\316E\207\234A?/\215\363\336\3733\366^\346\f6Fj\257\2015\347\275\333O^\316\275\333\201\022\374\2749\367\306\255\0076\310\336\032\206-23"
+	.string	"\263\006K\334\220\232 \362\271eH\271e\226{\273\233\n\345 \020o?\233\370"
+	.string	"6\327\322\356\244\315\347\31663\201p8q\230\320sq\256\317\275_\214j\302\213s{.Zf\334\"\022\207c\347\006\311\303\211\264\325\311\335:6\314\354Y\271\212\220\370\212\003\243k\252\016b\242\024\304\317\230\311\020\216r\340\n^f\336G\200\247\250a8\206\220b\312\314\214\210hS\220tP\0021\244\314\312\003\022"
+	.ascii	"\365U\b\022\315\264\230\375?\003\020\254\336\324\347\325\023"
+	.ascii	"e\t}\224\243rO\250\\\035D\r/\322\302\017\251}n\222\325\363\266"
+	.ascii	"V{F\227G#N\3170-i\310f\371\215}\234\273\b\312\252\005\025]\037"
+	.ascii	",,\233R\3334z\377!\300\230\316y\275\347\363\312\032>\215\221"
+	.ascii	"\227D\340\202\365\257\351[\210\207V\220\021?\345\355\344>\030"
+	.ascii	"\336M-K\232\206f\260q\221\205\007\332\200\356\244\366\251\024"
+	.ascii	"\375\325\344H\320\315C\320e\271\024\203Y\332\"\362\005/d\372"
+	.ascii	"\266\246\300q>/\201\267J\305\265$U\035\323\262\336\211_B\002"
+	.ascii	"\023\030\307\305\356\213s\331\341\367\354\221U.\005\217W\353"
+	.ascii	"\312\222Dt\272D\354'\377\315\230#\275\030\276\205m\027\307\013"
+	.ascii	"\343\330-\r\240Ow>|\225U\372e\245\272\253\032\343\351E2\024E"
+	.ascii	"\007\004\007\342\204m\316\031A\255F*\357_!\271\037<\314\367\200"
+	.ascii	"\342\346\377h@\177t\240\211Yl\r\266\001\b\200\317\226\214\200"
+	.ascii	"\352b0\305Z\327p\344\377?\267\220 \243\22064`\352\335\225#1\037"
+	.ascii	"\275r\310\006\3601y@\303\025\0352 \307,\313\036)\303\307\031"
+	.ascii	"\232\026\336\220\245\236\302\300\367s\"3sXD\254G\300Vz\273\363"
+	.ascii	"`m\302Jc\252"
+	.text
+	.section	.gnu.lto_filterBankAddBiquad.17.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\214\005\255\""
+	.string	"\266=\330K\220\026R:\200\033\006\024\275\006\343\201\371\374\302\017\336\"\007qD\032\374?\r\203>?\3724\361\311\205q\320\2547\374\037\323$\377\007Cx\231\343\305<W\""
+	.string	"\336\026\201\206'\017P#^A\302\274U{\207?\226|B\210\334I\006\304"
+	.string	"\267"
+	.string	"\310"
+	.string	"J\303\034\312{W\231\237\234\263\223\241\242Z>RX Z"
+	.string	"1R\362\340\244\236Y'\232XH\177\356\206\252\351\203\273\314\334E\"2z\335{g\230B\372S\247\246\366\372\035B\347\001d\346n\021\f*\t\351\317\030S\007E\265\366\306\240\353\356\215J\363\272w\235\341\004\351\317\253c\tq\260\300:\325\204\033V\r\177,\357]U^/"
+	.ascii	"\375\231\236\207\376\354\030\374\265\233\353\031\265\301\333"
+	.ascii	"\320\323\264A\376\271nZ]\255\021\213C\267\2316\243%\032/\305"
+	.ascii	"\241YsE"
+	.string	"\tv2#\213\266\330x\372\371t\323T\340\244\250\342\245Xd\362\234\322\224\\\354\026\2518\264\326\026\341\336\313\226Xl:\247gf!3\003\231\317\244\334Q\314O\236y7\313\273\324\262.\265\234\203\271\326\357r ?\200g\375\270\373\370[\330\362\355<\376\364\306\337\366\261s\337,\333\324\362\t\3000\035\201p\274wi\r\313-;\301\252\236\374\307n\231\277[U&c\334n\207\312<\306\311t\210)\325:^)\357\275\351\223|1\306q\322\357H>\330\203\334\210\210,\357\275\270\260\230\242\365\026\215j\333\207\375\326[D\225_\346E\261\336&\r:\226XK\336\r\325\332\177\031\203\n\254\267\351\313\252%\326\314O\276\327\017\367\223\247\2452\277\353\367\255\240yQ\344n\3211\251\206e\026\342s1n\207Ce\336\n\376\0361\335\002\177\224\322\224\262\026\351\2067\001j\030G+&h\275[X\226\325Y\020\375\031"
+	.ascii	"\r\352\005jgYy\036\202\312\234\327\374d\207\017\366D\2169\352"
+	.ascii	"!\266\310\025\274~\362?\027B\253\226$x`\212\370$3\207#\271\241"
+	.ascii	"\231\272\367\326\374|\222qn\326Cp\366\223\327\375\203\370\224"
+	.ascii	"\353]\333\236\f\263\350\272\314\307\340\354D)\272\266=9bAd\327"
+	.ascii	"8@\224\325\212\224\232\251+J\263\245\372>4\327!z\024)\262W\370"
+	.ascii	"I&q\"\276\364\336\353\200?\244'\207?#\b\375\231\353\0274\243"
+	.ascii	"\320\256\361\305\336\202t2{\220\337\234\030Q"
+	.string	"Z\231\222\366\303l\375\257\307\b\255\032[\344\024\263k\325\230W\"\333R\314g\257\032PU\002\276\367H\334\374\370\234\275\036\240\013\025\336\373\271\261P\302\247\007\034\321\003\342~=\340\204\226^\017\320\217\3116\013lp\036\210``C\263\313\331\271\ta2\016\r\260\367c\3027B\335\341\321\321\341\301Qw|7:*\016\320G\2451\300<==\240\372\303\303\003Tq\253\360\035\305\266\341\322\260\013\345\365\305Na\t\361\330e\277\344\267[\333\270\0206\021[\344\232\331\265\265\024\273P\2350}R\2312\357FJk\333\037fa\256\360\264\367\001\263\312\213\356\bB\253v\363\336{Q\230\376\230\202w\303\364\033(U\031`]\032@\343\272\245\273y\315\214!\203=\221\315\233\242\207\370d\277\022\322J\367Q\210\021\323\311\026Ie+\031\366s\005m\250q,\246\224R\b\211H0\"3\3224\035`\002\231\261+\017\022"
+	.string	"\326Uf\345\266X\330\3777\370;\366\317\264\374\037(xe\232\033+\bDp\360\255mH\214"
+	.ascii	"\271k\257\001\261\304N\371\343\357\276\376T\376f\321\233\257"
+	.ascii	"\346$\2256\303r^bw\372l&\310mq\275\024\320\260\230\255\270\002"
+	.ascii	"\262\304\350E&\233\245\036\214\302Tw\0239\367\355Q;\306\225\321"
+	.ascii	"\377\"Y\220S\337\201\007\300+%?\306G{\035\272\325\341\375\305"
+	.ascii	"\212;gZ&&e\224\226\340\345\177\350\215d\234\224\243\270\254\025"
+	.ascii	"\237<xKt`z0\001\325\310'\001^\256\342T\260\273\337\320\201P\031"
+	.ascii	"\353hD\360M\265\350\364}\236hI\250\256xp4\\33eB/xG\307\t5\302"
+	.ascii	"?\201E\301\214\037\253\243:\336\206H\361\377\350\354-\023\306"
+	.ascii	"e\324Y\t\337~\3467\205\323\325"
+	.text
+	.section	.gnu.lto_filterBankAddBiquadLPF.18.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\235\013"
+	.string	"&\026RD m\225\016\260\030"
+	.string	"6\004-"
+	.string	"/n\321\253\226`?%\202\263\332\001\200\254\270\"\365\016\250\272Cq\004\232y\230\254\200\314\264\210&\241d\340\360\367\227\273\255s\335\231)\256X\035\262{\212!\226\220\275wJ\001;"
+	.string	"A"
+	.string	";"
+	.string	"\037\3345\333\376\352\254\220E\033#\206Tg\372`\202\225\330\035\253\307kl\327\270gl\327\346\205\213.E\376a\247\033X$N\250\321\345\204dw-O\250\324=o\333\303\366"
+	.string	"\373\226\273\020R\240\330\231\006\"\203\355\220\335\331^\210J_\013(e\033T\340\020\200\273\346y\250S\332\037\337!t\227c\224\262\016J\017d\273kq\tw\255B\275U\225\362-\006\367vU&d\273\243\305\001\0177\307\256\201\304\232\255\351.\251\203\3169\177\317&\247\375Q \177\332\346$\302J\230#w\024V\236\260\307\221\234\026\354\323\235*\333\322\333_?\275\353\237o\375rr1a\304\210\210 (#\300\300\007\0245\240\330y@\021\200\2051 \230O\244@\b\346\202q\240\223!@\375]D\020\204`\243\251\235\220\303\t\277\332\331d8\365\023?\365\302\3410\001(VP\030\212\265\033\367\336f\2054K\256\220\016\017"
+	.ascii	"E\ro@Efh0\202\027\256\305\253V\\\030u6\323Dc\273\320\302\353"
+	.ascii	"\204y\270\213\204\246\302OwL\302$\003"
+	.text
+	.section	.gnu.lto_filterBankStageUpdateBiquad.19.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\037\003\275\023"
+	.string	"Fc~J\300\226M:\224.\022a\264\275W\264\371H9\320D\b\243x\324.\240\314\232\242f\205$\261`\246?g\264\335\340`Z\031O\016\2401L\264N\201+\360O\350l"
+	.string	"\004\356\026x\240\275\263\246;\341\256.\265F\266m\262wJ\001c"
+	.string	"i"
+	.string	"d"
+	.ascii	"-\337\253\353)\234\273\363\300\035\310J\236kM\3048\201\264\273"
+	.ascii	"*\246\360\275\032\360\\K\341\247}\035\367\301\375\247\346\257"
+	.ascii	"\335\035$H\273;\025'\370^\275;\201\324\353w\001\251W\343\354"
+	.ascii	"$\337\365\354{\f\301\021b\262\273 \225q\334'\316\177\371\225"
+	.ascii	"N'\367\251\232\260\273\236:\035\0257\275\355\003\266ilZ\")\377"
+	.ascii	"\371\001\274\350g\235\350_}\350\377\036\364\253\350t\245\323"
+	.ascii	"\036\235\246tz\322\351\017h%5E(wSD9Y\246\232T\343G\277\375\227"
+	.ascii	"Fy\275\bot\037\270\037\331\276\\N\013\316\022\324n\216\202W\217"
+	.ascii	"\337\353dZ\360Z\021\326\"\032\236\026.\337\353KG\244D\304\223"
+	.ascii	"\320\033\032a\304aIH\203\\z\256Eq\343\"E@P\237\271\024\342D`"
+	.ascii	"s\2269Nm\273\\\210\313V\317\356"
+	.string	"B\260cW\022\203\310^Rzh\274\3725\251W*\244[b\317^\272\374v\327\301)\202\031?63\312-\034\254\311\242+\372Q\025=\322K\332\247\263\307\231y\235\275eAsn\335\230\245\r\247\235M\354]nR\036\373\336\356\256\351\216}\240?\244x\213\231\311R\242\f\t\r\027.\336`\030`l\")\023I\224\031\221\254\300\212\021k5\030LLe\026\006,\261\007.\rXV\002\210/\260\233\255:\266B\212\267\230\231\f\254\2154\332\030\003k3\030\r\214\2216p\245\200G\031\221\004o\343H\202(\273\275\267t\307\026\2000\331\320\033\333\274]\030\022\240\200f\224\353S\206\037\331P\177xN\035\336\344\301\333A\215|x?  \003\221\241j\003\2309t\206\375\221\236\212\207\270\303\225\222\342\273\030\352\270\333\304G3+\332\301\354\346`\241o\231&\360\265\r|4\273\242\035\314\260\371\204\266\234\245$C"
+	.ascii	"\2421`\275n\332 \272\032a\373c\255\246\215\254\2712\326\374\365"
+	.ascii	"\314>\247bos\320\374\266\273\345\210\342\026\033\305\234\314"
+	.ascii	"\214X\030B\013\207^\346\036!\f\2273\016O\214\235\340\323\255"
+	.ascii	"\300I^\\\214\f"
+	.text
+	.section	.gnu.lto_filterBankStageCopyCoefficients.20.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\313\002}\017"
+	.string	"\346\032`D\360\224\223\016\250\034\244\341\003&\206=t\264\3404Dk\023\311N\304\004\221\315\215\204V\374@'\024\031\003\236\036\232@Q\271s\336\242`\"\007n\367\357T]o\001m\222\256F\307\340\023\326\266I#{K\231RI"
+	.string	"E"
+	.string	"O"
+	.string	"QT\"{\3327\361\023\251\263Zn\262\2732B\263\373\031p\001\354\321\337\003\\\217\330O\256G\247l\037\377F\354gzph\025\331]ME<\365L\371Gq\217\007\243zv\030\354\256\323\203\361p\353m\023\260\355\300V\b\001\366\247J\ra\037\356\356ZW\366Y\177\350\337\017\202\351\217\246=0\215i\272\003\323\227\246#LCM+L\247\246\177R2$\307\202\037\273\035r\220\354M\214\021c\373 [\304\312\362c\021 \332\027\231\230\006\330\0032\"\220\263\270*\204A\003]\220\336BKlB\031\272k\256k\252]\232\220\367\f\002\261AU\366W`Pa\232Q\341Z\256\307\324'\361[\031\356\331\026\236\342\204\355\276$\220\221p\001#\361\350\263\\\217Wmy\037\\2\307\371\342\006\316\346\221[wR\217\016\2146\005)\bF\031"
+	.ascii	"\324)E\275e\035\tE\241\244\242\255p&\023\267i+%\024\223\266u"
+	.ascii	"'-\033`\256\002\251\323P\034\327i\240o\017WW~@\344\306E5x\364"
+	.ascii	"\303c\307GG\204\343x\204t\024\303a\203\331@yM'H\324\253\006\215"
+	.ascii	"k\306\3669 @\003\221\261\r\215\241\"\307\2136\032\303>\314\274"
+	.ascii	"\210\210\207\373\231\021\213\361\317f\233;\305\002\242\341>c"
+	.ascii	"\304b\374\333\354\346LQ@<\234\317\032Q\314\177\277Y\237\301S"
+	.ascii	"& \366p?'br\f\333\302\025\362\213E\026\216\361<\013\256A\021"
+	.ascii	"\334\301\346\327\016q\216\017\023D|\nn\231\207\321\306n\341 "
+	.ascii	"\342@\250s\213V?\001"
+	.text
+	.section	.gnu.lto_filterBankApplyBiquad.22.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`<\005\325\036"
+	.string	"\206\267\300H\240\330M:@\371\322\200\336+\375\236\257\300w\374\271\324\177\230\022\221=\t\352 #l0\343-Z_\210}\207U\271\337\235O\331V^\260\247\311Qy\216Fn\375\001\265#\375\3103\202\023\331|\376q\343\211\335\204\310\235R\250"
+	.string	"\236"
+	.string	"\256"
+	.ascii	"%\323\212\022KK\305\227Z+\320IW(O\236f\333\204\354\326\310\217"
+	.ascii	",\035\211\233\214\267\372Tc\352\253\326\252\300\023\312\223>"
+	.ascii	"\243-\307n\016\355\225\273\325\247#(\210\312\223\266\031\273"
+	.ascii	"O\373CNd\351EH\034\247V*/_\265\016\025\030Ay\322\303\353\320"
+	.ascii	"\223\345q\364\244\227l/\037V\325\231U\n\023Wcj\255\272\275\341"
+	.ascii	"\3758\274\307\271tr\334\271\344\317\206\256^@K\f\224\024\323"
+	.ascii	"\311\361Vk\275\221*1\356f\224\224\323\034y\264\370>\353\b\262"
+	.ascii	"\312\240\244Z|\316\206j\255\236PR,nz\333?\333=\233\324\020M\263"
+	.ascii	"\214\237\365\021\b\215Y\2141Vg\031{\3104\327\206\375\327\245"
+	.ascii	"\262{\276u\363\274\310/\340\\w\356\303?\300\221\374;\307\272"
+	.ascii	"qt:\207N\343\320\351\033\235\266\321\351\033:mC\247kt\232F\247"
+	.ascii	"k\3504\r\235.\351\364\214NS:M\322\351qN/9=\311\351\023\310\031"
+	.ascii	"Re\202\230ZU\224\231\251bdQ\307\267~\256\037\353k\337\366\265"
+	.ascii	"\363\265|%\3572\315\266\204K\204\317\323\255F\235p\261#C\330"
+	.ascii	"\226\210\222i\305N\224\325\013\013W;?\211\237e\332I[\222\235"
+	.ascii	"\215\345&\001Sb&\036\254\312w*\367\252\355\301j\266\\\332\222"
+	.ascii	"d\302\035<K\2635;\273\"\354\021f\"\204\016\237\322\200f!\314"
+	.ascii	"\266\334\221,\212\211?E\207\3223\333\037 <\373\255\373\320%\227"
+	.string	"g'\231p\352\211\211\022\252>\334I\204*\272\022\254r;.\271d\330\205\203\231x\340\201}t&\300\262\326\332\240H!\204\201\223>\tz@K\261V\3641\226\333s\035\203\214\246\177\2150\361'\013\016\337^\364dn'Y\024\214\271\001v\367\302\037\343-\205~\347^\330\303i\226\031\267\337\261\313\304\231\246Y\346w\375(\212<vk\255Lk\240\b2\002A%\020\277\"2h\244\224\344C\242E\017\376\224\200DF\276\337\217\347\241W\343\005y\033F\013-\020\3529\330\300@((\307\327\201\027L\"\335\013B\362\005\215\2128\350~\300\243#`O\367+\342\035\351zHI\272\240\001\006\202\360!\351\202@ \222\2166\254\177]*\377\352e\221\210X\323:\221k\3034\250\355\331\3352\201\216\333\250\235\305-\321\224\247I\206\n\r\334\0165\3152\037\307\236=V\202\343\266g/\234r\232e\307\301\"\306\r"
+	.string	"-.\204\344l\027\023u\270\340\254msn\213\243\205\367,\267\233\265a\351\375\312\315\376\004\261Y+&\352\214\331f\030(0\265\245\255\315\346\310\204\001e\25014%%Rd\250d\202\202$)\2441\240\002\021\252\251\036\021p)T\256\210\201\366\230\003\207?\214&\365\030\024zX\364?\377\233\312\002L\261}FJ\205=jV\006\275D\355\267\367\270$3\262! \223\325BU\206B\217\311\025\244i\376\227P\241\004\377\223\362`\325\251=1D\205\22540\224\2330\274\315D\337VJJ\220I\352\035\337a}H\2564_P\217\305WHz\334\214$\300fH\270\241\016\256\224\270.!\020go;\217\352i\322\234-\315\276 \216@\214WFX\242oF\032\356\005\210\323\370\031D;\327\2432\to\351\202J\314dZ3\211\bu\377\305\376Ac3*=\305\034"
+	.ascii	"\t\202\250U\317\023\033\016\265\224\351Q\337\375:\335\242\002"
+	.text
+	.section	.gnu.lto_filterBankApplyBiquadDF1.23.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`.\006\255!"
+	.string	"\366\274\321H\220\332M:\204(\n\205\220us\331\334\267,\366\001\262To\325\331\317^\373\305$\002\311\345\006\001\305j\363V\306_\310?o\354f\222\364\245\2233"
+	.string	"\242.&_\325\233\316\214G \b\342\212\226\177\263!m\023\"wJ\001\270"
+	.string	"\254"
+	.string	"\301"
+	.ascii	"92x\341\371F\374#\266\235\274}\341\331^\026+\245X\224^Hn|\251"
+	.ascii	"\265\022\2354\206\362\344m\366\255\no\207\234H\324\213Xl\314"
+	.ascii	"U*\032\\Jj\255\fL\241<)4\336\306xS\350\260\237\\\245\"\262\002"
+	.ascii	"\251<yK\302\373\264\017\344A\242.\344\304wj\325B\243\244V!\003"
+	.ascii	"+(OZ"
+	.string	"x\035=Y\276\207\236t\224\335\345\302\255Z\343\332\262\352:Sk\335\255\r\357G\341=\316\250\223\343\316(\277v\324\365\241$fWYR'\307\\\255\365\226\205b\344M\254\254\2519\362p\361\375\221+\370\032\273\312r\361Y;\252\265z^e\265\270\351m\373l\367lj!\337\021\314\212Mp\266\361\301~\025\305\261\335Z\253\324\232H\202\214\340L\363\217|\3741c\026\305\250\324\231f\013\245\346\326\260\377Zk\365j\331C\377\272\203.\344\037\360\341\rt\341/\340E\376\237{\335::\355C\247{\3504\017\235\336\241\3239:\215\243\3237:\255C\247s\350\264\215N\343\320\351\033:]\322\351\032\235\246t\232\244\323\343\234^rz\222\3237\300SfJ\005b\255+\332\250\251R\310\242\216\177\375\303\337\353k\377\226\206\347#\361\223\034\314\266[\332\260\204\020U\256b\245\300\261\203Cy\022g\365U\242\224b\001"
+	.ascii	"\213+Mxv\222\345Vgw\226\300\232\252\035\270\275mn\013\220\271"
+	.ascii	"b\342\034&\335\3124\202\3339\254b\342\327\364N\305\314m\277&"
+	.ascii	"goVg\201\300l\213\2639\033\324%\305\304\243)\335\f\213m\217v"
+	.ascii	"V\f\226\231\370([ NF\206\263\217R.\2717K\313\252b\324\226n\271"
+	.ascii	"?bOL|\330\322\235|X\333\207\235\025\203c&N\330\022\361&\022\266"
+	.ascii	"\350N\340\002\332q\311%\313.\234\211\211\t\"\330M_\362+k\255"
+	.ascii	"\017\212\024H 8\351\237\240\t\316\2129E'T\200\366\303k\220\021"
+	.ascii	"\274\022\023&\036\310\222\303w\030=\t\264\023\r\013\306\\\001"
+	.ascii	"\273\373*\037\343\r\205~\347\276\252\307\324lc\335\006@\250\021"
+	.ascii	"\276%\022\310\004\365\244\344D\227\016\364A\375\220\230\224|"
+	.ascii	"\276\244\020\275\234$`\222\207\321F\r\214z\020<80*\342Q\002\221"
+	.ascii	"\004|\"\335+rR\0022-}\330\371~MM\277\336\316\267\224\324\264"
+	.ascii	"\3539=\355\212\006\3707B\311i\007\374\375\234v6a\375\353j\371"
+	.ascii	"]/\213f\244\004w\212\334\032\266]\355\320\256\226It\335b\375"
+	.ascii	"\254n\221\310\250f\032\263\031\272=\n\316\264\217\265\326:\016"
+	.ascii	"\355\275\026\\\267C\373\347h!v\313\342s\366BL\320\0313`pd\306"
+	.ascii	"\230\001\205\001\023\200\353EYm\275\230\250\333\352\202\233d"
+	.ascii	"\256\302@\t\332\177]\310gw6h'Z\317\362\254\317\022Y\341b\342"
+	.ascii	"\304\262\341[\254\364\354\304rf\342$\353\360,3y\250Q(\346 S\250"
+	.ascii	"fD\202\302$)\2441\340\002\221)\242<\021 \251e\224H\005\256\307"
+	.ascii	"\264\031\007\177\240\200 \030\306V3\216\324/\356\353\206\250"
+	.ascii	"\200\276V\254f\207@\032\272\364\263c1\177\306\303\237\300\362"
+	.ascii	"\207\301uE\311\005f\275\027\006~\032\373\344\340\005\027 2y!"
+	.ascii	"\262{\027p\177\246\364\r{\253;j\2644yK8\264\275\341\213g#&N\204"
+	.ascii	"\2430\373)7+\034\205\355\237\220\310D\237\260~u\261\211t\t\367"
+	.ascii	"\262m\251\205\007\231\260\031,\022/!\366\255xv\332\214=\360C"
+	.ascii	"\224\222\251\t{\363\320\342B\034\t\251\303=\244\364~\301\"\002"
+	.ascii	"p\276\354\303\334rSl<\337\205\2016~\202\310J\332\204W\177V\330"
+	.ascii	"BR\235\374F\\\351s\371\203\234.M<C\376\270!\020\247~\036\353"
+	.ascii	"CH\250\005Og\372i\245cd*"
+	.text
+	.section	.gnu.lto_filterBankApplyStages.24.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\033\t\0050"
+	.string	"\352R\374\021G`^N:\227\325D5\217U\307\331V\033O\263\235g\327\260\024\276\034\024FoZ\266zy\247\311h\217m:\356\264^ng\302|\363- R\nqJ\202\037\220\b\020\006\306;r\206P\270\303\367h\204\020B\366N2\007\001\371"
+	.ascii	"\021\001\276!\355\321~\326\337\342#\322v\177\213\324\2654\223"
+	.ascii	"\245*\262eeO\272\234\263\203\247}\342gR\335\275\247\357u\377"
+	.ascii	"`e\371\002\301>\375\031"
+	.string	"\266\330\312\257L\235\254\231\250/[\031\321\241\3149C\350\r\354S#\324\247\256\275\310Nk\203\201}\3523\327\376v\177\312\251L}\354\306\001\344|\244\251\314\031\t\241\033\260O\033y!\365)\373\237\372t\252{\356H\257\374\263\261+,tr\316-V\202\261\332(\320\363\371|\036E\276y\360\324{<<vUS\024\337\251~\331\023$\347\020\215T\357\241=qbZw\026\205\240GG\264\270\247U]\2365)\t\226\326y\274\266&\354\232\304\345\033\276\330\334ta\035\277\242>g\361\210J\330a\304q\325&YO\327\244\266\337*vDc\326Q\325\327U\fr\305c\264R}\b\272\212G\024?\355\351\227\231\233.,\255\3375)\347\334\227h\304z\367\274\373hw\333\350f\213\001G\264\270&\270{\370\311_\340\022^\273~\332Q(]wit\346k\327\215\254\272\030I\234\330Q\331\370Hw\021{\373"
+	.string	"{\333"
+	.string	"{\233\210\275]\340\336&\300\273=\200w{\210\275-\200\275-\364\346;\350w\344\357\273\362\r\364\261\377\347Y~\237\223\375\275'\337,\276\275\256\267U|;]o\243\3706^o_\365\366\023\374\246\224\351\360\314\271\307\323NvK\327\230\274\371+\377\344q\367\373ho\366\333\272\327SR_\353w\271\227\203\301]\342\244\344\234{Sh6\323\220\213-\276g\373\322\314"
+	.string	"\3719\342\316d'\226\351\263j\357=SJ)\277\350T\322\335_&U\345\340p6\006D\247M\357\227RWF\251E\236\326\231;\272\247?K\332\276Z\237\013X\333\255\214z\036\026y=t\234\321\345\214l\332j\373f\375\264\237\"mw\262\231FV\276l\365e\026\226\202}\032\303\260\252?=\264Z\037\254\337i\352\323\002\370;\264\006`\037&\200?|\202\276\333\324!<"
+	.ascii	"\177\350\244\352>;\b\017\341U\314\325\035"
+	.string	";\255\206\344E\342v&zduu\004`\244\257\265f\367\210\317i5\005h\232]\342rL\254]\310\244\304\201#\204\025\310\255\255\031\257\330\021\r.u\3607\333\324\236`\376\241\316\f\306g\363\3413o$\\\336\350b\214\317\346\352N7\212\277Q\301^\214$\367\263<:3\232\377\262\334\250\356\035\032\332\246Ow\301\254\351\263yZX\346\222\353\247\35196g\252o\365\227\324\247}\211Y\307\226\260\2343\203\237\351o\261^\271\230\221\231\301\021\027\216{\247\273\201\207[J\337\340\244\274\231i\352\375x\243\343Tz\321\007\213R\237\036\017}\215\365,\2018\201\360\225\257\301%\274[\324\002/bw\007O\206\t\311+\347\\\241\305\3074\2619\347\tb\224^<@\003vC}\n\2041\0341Kx\237}.?\217\245\017\034P\301(\247\f0\230\202A\240\213\245\236\224\006\323\212 \207\031<M\007\302\3401\265"
+	.string	"B\205\200\232\361\324\304\202\007\b\005\\\201\266\205#\013K\024V Y\210\020\340E\020\250\204\366R\204'&(\030M,\332\240S\214\030NKm\260\t\030\243]z\232\321F j'\031LO-\224\223\323S\333C\n\225\307G\312\316.\251\270\tq\225\262\207\221\364\221\026\357\207q\232\333\303\254\017fq\2060L\026?y4\377\360\223,\376\001@[\032\235\271\311\306\374/\210\2330\356\277w\227\027e\375\240\342\225\250b\nrP\346\336\263\024c\177a\316\241\233b\037\006\302\335!D\334\023\333h\210\251\032\305\351\275B\361\204\257\"jNd\305H\272GL\2130N\203:x\020\336\021\2041\3160\306\352\326\221\351\n\302IB\265\b\277y\243\007\017\302E\370\017z<o\222\370\306\207\363"
+	.string	"\276V\255&T\342V\231\300oWx\251n\034\342\033\003X\b\037\300(\233\341\026\021\026\200\r`\025n\350D\b\027\300Dx\275\013\200\275\250Q,\247\234cfHFDAR\230\244\003\220\002\221\251\032\253\003\021\220\255s\214&M\215\016~,\243\257\236\251\325\027s"
+	.string	"\317@\326y\".\270I\341L\336\337\241\222\253\037\001\305[\316\323\203\221\275\201\332ys\021\342/\265\324Bi\024\264\372G\244>~\363\340\356^T>\372kt\034kc\002|\214z\177\261\322z2\355C%yV5ws*\376\204\343\272C%\303pM~\340;\267G\346\263\233\004\251\364\001\367:\255\246"
+	.string	"nb\\P8\2746EI\204c\037\323\035*\260\360\320\357\312\253 !\020\203\022\334RU\346\037S-O\321\377T\332\256\217\024\204\200\026E\327p*;\300A\b5sbe8\262"
+	.ascii	"\017\200+\320.Bs\022\330\031\202\314\351\241Wl\243\351U\304\223"
+	.ascii	"\353E\3668\002\275\303\f\037\022bd\366\b8\263\327\262\230\361"
+	.ascii	"o\356\017X\002\254\262|\n\325G\017^&\276\311\2416\336\272\357"
+	.ascii	"i\375\311\313<b\362\217AW\"\001\226\357\277\365\200\3338\224"
+	.ascii	"\214\3205\016\260<\355\234\245\203\216\335O\212t\323D\322\264"
+	.ascii	"%\2705/\321N\362\304L\237;\271\fQ9\245\030\314*\016\224c\354"
+	.ascii	"F\240\341\247\347\200\300mh\016\f\344\271\322\360\2020\020\""
+	.ascii	"*\227\210\177\246k\206\301\313|\247\003\036Q\265m\236\033\017"
+	.ascii	"\352\230\217\2653\252\263\031\017\244\t\260=\200Uc\362\f\025"
+	.text
+	.section	.gnu.lto_filterBankApply.25.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\235\n"
+	.string	"\206TKB \311(\035\307 \201A\214\331\007\210/\370\253^\bV\236SN\003\332\361\330\205\0207[_\333\267\330\272X3HI\251)\376\023\bX\026@Y\242:\330eu\205"
+	.string	"\nQT`6\216\326n\262eJ\0015"
+	.string	"8"
+	.string	"7"
+	.string	"\036Wh\227\016\017\221\271\324\336\311\\\032\264'<l\331\023\210\240zQ\330\335\031Y\016^A\377\001\316\260b\241\256\232\215\335\265\256X*w\274m\n\333\035\366#\002\261e?\374\345]\177\226\2515\252\257\3514x\340q`7%faaR\001\214\355olN\202\251\241\rH\340\320.9\257y\265\037s"
+	.string	"\340]\247;\354\266\n \330\r\0032f\321\356<\375\312\023\252\210\362\243F\217\352\202]\362\001%mw3|\001'&\332\313\245\177\312\\>N\027WJc\326\005\f \254V\260C\224\306\025\373\331\356\256\003\233i\013e\006]\2008\215\020\006\350\363 B\332@2s\237Od\032\031\205L\222\327u\0367I\243\255\233\334W\232\037\t{$\242o\232<\357\233\233p\237ml\371\303\001,\025Q\334\240\032-\036\r"
+	.ascii	"\006Td\342!8\232qA*\r\020\326\204l\256\261\2670\366P5\340^\020"
+	.ascii	"j \270s\213v>\001"
+	.text
+	.section	.gnu.lto_firFilterInit2.26.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`9\002\r\021"
+	.string	"\306\337qI\320\322(\035/3#2\257\266\220\217\247\333\216\203\201}\002\232\035_\372P%\3350\312AQ\245\366\030\343Q\023*\226\333h\001\223\242\361#\200\267!\r\255\023P\203\001\353\256m(\331\213\224\177"
+	.string	"\2579\266\365\377\306m\367N)W"
+	.string	"Z"
+	.string	"^"
+	.string	"\021J\257(\017\2539\037\243\364.\bB\351\025\204h\365y\030\276\213\277 /\303\362\324\256Ngg\2674\361\201\322\253\313\213|\257\245\007\370^M\332:^\236\330\347\b\275\330\b\355.HM\234\374$\375\343\334\204\313\331>I\017v\327\023\227\003q\323\333.\261-\3323&\245m\322\030\373\243\335]S\235\375\233\377\364\232\337\364\231\237\364\362\257\227\371G\337\364\374\246\237\032\021qC\002o\367C\357\307\376T\036\026\266o_\006i\237l\224\n\234\233\332C\366\226cW\241\304\252\316\333\324\320\006\204l\007\232\025\023`V\243y\032'`@~\246f\272K\242(&\321\323\257\347\245\310'\304}n\207\257\341\223{\355\263\305\367\210"
+	.string	"\355\350\361l\317\022\333u\036\363H\200\204\210N\324~}\247V`\310Dm\f\337\321FP\370 Q\033\366\0315\222\036\225\332\343u\274+\355n\003?\207\303\006\024P\212W\237\345{\025\0204\242e\366<i\360\300\261s\310\016*3WL<\001Yi\265\3041\374Tf\256\230x\322\242\245\230Z\264\024j\226\002V\350\340\302\002\226\n\300\347P%\023g\031^-06\302`c\b\306^(00\224\255\200*\002\0365\2102p6\2162\360T\356GKu\246"
+	.string	"\363\323BoN\315I\021\334\002\312<\316\006\\\250\315\243\333\306w:\251\211K\213\333\354\005) \020\203\2311mP\215'&7\255)\302\361\3202Z.\324v\306\263\303^-\227\341\247\003\217\245\223\370\022\037\3764\346\272XbH\270\270\204H\326\334F7\311\351\246xl\242\264#\362\t\301\334h\004\r%\230y\303\006\301:&\231\256M\3040\204"
+	.ascii	"\315-\004\366\004"
+	.text
+	.section	.gnu.lto_firFilterInit.27.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\275\003\225\027"
+	.string	"\226(\222L\220\024V:n:\304(\356\324\235\f\236\267\304\200\315\331\336\361N"
+	.string	"\337n\342\361i\321\204\033\321\366\305\023\217\017\201\242*\033\352=\356=\232\017W\342Y\370\253\031\035\373&i4\033!\3011~\315\323\265||I\017kkd\223\275\223\fv"
+	.string	"\177"
+	.string	"y"
+	.ascii	"\374\246\035s\354\3671f\031\217\363.\365\b\224\264\206\030H\022"
+	.ascii	"h\234ee~\201\371]\311\307\266;\204\026\004\250\263\242\\L>x\375"
+	.ascii	"\312`\234\257\314w\361\027\277'\361<@\267\2210\252\033ma\004"
+	.ascii	"\257_F\177b\376\276.\300\374\345\037\363\217\243%\372OE?LX\335"
+	.ascii	"=\263$\376{\375\361\317t\030\220P\317\253K\246\273\271\002\t"
+	.ascii	"\r\235\355\231y\205\231k\314\345\201\225\315/\375\367\350_>\351"
+	.ascii	"\267W\372_\202\262\302\252\306\330\335a\313HW\335\251\023\374"
+	.ascii	"\246\247\273\313\340\013\377t\250\033?5\001\252Ew\307\244\242"
+	.ascii	"\220\244\242|f\357\004\021\326\274\212\"\316[_\\\352\335\364"
+	.ascii	"\203|\020\313.r\340\341,\353\211\374\002\263\273\222/\201+\207"
+	.ascii	"pH\302\341\254\365\303\235\031\004\373pt'\231\340\206\bOEW\335"
+	.ascii	"(\313\257L\353|\275\323\356I<f\020lH\210u\365\033O\231v\253\223"
+	.ascii	"\244\220-#3\327\225\247\\;\0166\246$\261\264\216\363\033>\003"
+	.ascii	"YW\3475z(GE~\3413|)5%\202\354\224o?r\221$\331\335\f\370T;9\276"
+	.ascii	"\t\036\363w@\017\020\300\272\305O\017 \035\202\234z\214\b\210"
+	.ascii	"\216"
+	.string	"\226\272\366\305\327\232\305\267'\236eJ\373\241\265w\272\n\260fq=\252@v\315bF\203\325\216`~\331\335\315\326\210\331U\331\345\n9<\034\\mF\266\263\331j9\232\231\303\303\301\325fl\275\033\230\255wc9FA\f\255\201\205\0051.&&\323\\t5\036\006\035\333\f\227\273\335r\264\031N\307\3466\243\351v3\227\002\234\313P\323\315x\271\234n\026C\201/\333\032\321\260\250\002\332`\2218\374\231N\223\242\312\244\272,\313K\313O)T\250\007b\025\037\333\303\345\331\206iZ\227m\361A\021\264\2465\251~\216\034\211\220\177\3126\337q\024\272\317\fO\250QL\206\0242\316H \022H0\303\2449\300\002\231\271u\016\021\0209n\252&hR\355\031\320*$\027\351\366G\300\026\222\223\200\304%\221_y\341\026\262\204%(\265i\356\274Yt<\301r4\267c\271J\231\302\307\300\240\367\237\221\226"
+	.ascii	"[\241j\212\305\305|\226\207\335E\323\367\"S\250\234!p]w\237\354"
+	.ascii	"\275\300\310\026z\323\034}\356Z6\256\023\277\034\235\tp\n,\227"
+	.ascii	"=\032-Y\315\345\353\223D\344\200\327\313\231\320v\333\252\273"
+	.ascii	"\251\254O(\342\275\030\334\277\237\001hG\316\017A9\210\352\n"
+	.ascii	"z\277\330r\032"
+	.text
+	.section	.gnu.lto_firFilterUpdate.28.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\321\001%\020"
+	.string	"\206^jF\340\262(\035\"5}\f\330\341\022O\210;\213c\334\355\r\022\007\0344 \205\363\003*\004C\001(\360\244\361c\003Dv\005\270\226\373q\035\3658\206\312p1\n\"F\246\001  \322}\267\227Y\256\255\221\275\245L)S"
+	.string	"O"
+	.string	"W"
+	.string	"\376\212\263\360>[\371\200]\330\214\315\356Wb\006\240G\177?\260=\202^`{\264g\347\370\007\263\237yq\251\365\330]NM\334;\324\364\374\317I\210\353\265:\034q\025\360j\201$\273{\332\023\304\213\225\3719\331]\247\353%\342\216\267=\3016\005;\037\004>\334\335\265\302\354\313\374\241\317~"
+	.string	"0\375\321\364\026\3231\246!L+L\247\246?\202"
+	.string	"\347\206\005\036\273!z\200lN\274Aa\373\366]x\266\210\035\222\231d\236\346\177o\341]\3065\016\331\245\261c\263\273%\226"
+	.ascii	"z$\201\241\027\223\347c\002\006`|\323l\217\013d$\242^7}K\005"
+	.ascii	"\274klP\243f\255\225\202\245P\225\307%\210\352L'\322\271K\307"
+	.ascii	"\337m\251\252\312\323*\301:\035F\227*\262=\374\205i@\273\013"
+	.ascii	"\301\257mP\001\235x\364W\266\307k\200\235\031K\3668qbpl\376\260"
+	.ascii	"\277Uj\314\001\252\017)(S4\251\001\251\024!\203\003\322\210\300"
+	.ascii	"\346\322(\205\242\352`\322\300\241\272\323\251+q(\323\205\023"
+	.ascii	"WJ\251p\243\004\356RPR\234\252\353R\234\310\267\207\253\260\n"
+	.ascii	"3rX\224\0055\346n\273\031\021\351\354\b\341\310\310\335]\251"
+	.ascii	"\306>\252\212\201f\243%}\330\346p\233\217*\220\305\b\251O\223"
+	.ascii	"rM$ `\002!\242\252\016t\"R<e\036/\210\321\254/l\322\346\307\030"
+	.ascii	"b\331\215\310\231FaH\254\270\336^\253\224D\315\333DC\024\202"
+	.ascii	"\332\343\220\026JA\230b\340\251\200\253\033Ks\240\331'\264\244"
+	.ascii	"\340\207\265\t}0d\333\232p\254\2607\r&H\003\026\225\333.\245"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_firFilterUpdateAverage.29.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`>\003}\024"
+	.string	"6d}G\320\322(\035j\244QRZL8v\356Z\016x`Z\350P\007\001m\024\203\306H^\3641\2050i\f|\320#pT\272\177\360\332\261K\213\206\360\322\241.\207\206r\250\327\226\266P2\020\f\346\326\376\267F\366\2262\245e"
+	.string	"]"
+	.string	"m"
+	.ascii	"'f\220z4\201\254&\224\247}\024Oa\373O\314Gvwh\020\355\352N| "
+	.ascii	"\365h\335\005x\217\251\007\360\036m\263y\\\327\263wq\302F\210"
+	.ascii	"iwc\032\342\266{\021j\332|\224\212\352&'s/\347\021W\223\260\303"
+	.ascii	"\025@\216\006\232\354\356\203\2368\271[&Jew\2357\271\r7\352\266"
+	.ascii	"+\330n`k\206\217W\227\216\237\231|r\032-\345\330t\262u2\251<"
+	.ascii	"\366\341\356\256u\307>\320\377\372\317?\002\323.\230n\3014\013"
+	.ascii	"\246W\231Ve:\245iTL{1\035a\032jZ3\235\231\376\200\222\034\034"
+	.ascii	"\017v\273\032\236\202lR,\032a\373,\273U\203\222\272\253\260\035"
+	.ascii	"\310;\253ve0\021\355n\037\313\351\245$=\006|@\2544\306W\362\177"
+	.ascii	"\036\324\225\352\022N\347\326\244\202\241*\022\267\357\\\274"
+	.ascii	"\363=\244\307\371\340\251*J\2173q\327\360\242z\nw\340J@\215z"
+	.ascii	"\233!3\371\364\027\037T\230\317\317\f\355-<\244Z\300\347G*\013"
+	.ascii	"\227\322oz\274\364\232\232Bp:\267|\262}\341+\274K\355\256\002"
+	.ascii	"_\b\302KJ\304\243\037\343\0050\030\\Zf\321)\bRd\013$$H\201\275"
+	.ascii	"<\313`5\026\030\013\263\t\261\026\332\367\321d\261\226Y\204/"
+	.ascii	"&\253\275\304`\004Lsa\251\305`h\264Z\214\245\333\303\325\035"
+	.ascii	";\360\2204\2437\317\245H$Eo\251K\217\323\271\035q\210-e\351J"
+	.ascii	"\020\022\205\333h\251\310Q\016*\217?o\306'R\242\344\243e$$wW"
+	.ascii	"F\225\207\245+]\t\272A\223@l\317~\024D\250!<\315*D#2AJ\212\322"
+	.ascii	"\034\003\320\002\021)\252\016\021P\271c\204j\024&\205\3323$("
+	.ascii	"\322U\215l\235h\303\342\360\003\247j\224sX\260\032a\2601\200"
+	.ascii	"\230\\-\335\325/=\021\021\366jF\210\274\026\335n\257g\355d\232"
+	.ascii	"\202_\200+\020\227\270\330\266#\342o\237\023\242!xv\342/\221"
+	.ascii	"\311%\326\247\3250H\223\364(0\006\210\201\302\0379\236<\033\331"
+	.ascii	"=(!\212\371\221M\032\326\376$zV\317@\005\302\361\301\250`R^\031"
+	.ascii	"WO\312y7o\251\001"
+	.text
+	.section	.gnu.lto_firFilterApply.30.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\206\006\345\""
+	.string	"\246\377\330G\240\232M:\274_\213\362\240\302\020\r\0255o\271\241_\033R\253\214&r\242g\360\214\253\206T\245.\035\b\017\254\217\276\313\352\307\027\276\034/\254C)\207A-\267s\265\350\217\232\341\225\246\205+.\035\204\220M\222\224)\312"
+	.string	"\266"
+	.string	"\300"
+	.string	"Y\252Z\252@\275\ree\242[\312e\231\314\t\320]d\324\213\236\235\230.\260\nW\264l\205F\225SR\365\300\022\204\002\251S\326e\201f\331\n\031\365\202\004\366\310\002V\226eM\247'X\206\265@\327V,]\002\245\277\024\252S\2268\262L)\313\337\222\223H\235\376\221>M\002ew\205?\035>TL\224\025[h\312\262\274\321\224G\324\031\352"
+	.ascii	"Q\347s\214\3261\r\177\352\360PJ\216\342\f\277PV\b_\\U\275(%\325"
+	.ascii	"\313\213\031\273\035e\250\250ALUO\206\316pT\341\342\007NOE\b"
+	.ascii	"!\f\314K\271ty\275\251\r\205\304\320+\227&m\tV\365b\350\216\021"
+	.ascii	"\312\262\364V\365`\250m\324\266\021\333\027l\361D\372\275\256"
+	.ascii	"Xc\207\320':\262,\251\034X\235@\rq\"}\350\264\246\020u\352\201"
+	.ascii	"v`I\355\230gE\274\224Dj"
+	.string	"\f\204t\331^#\005\352\003\033R+\346\r\326\360R\256\230\375\213\332_\331\nAG\030\230\217\303\276\331\226\224jI\t\220\216\364\247\212\340\200Q\221f\251\211h\252\245\036\022R\240:\350k\240]\377\210k\003\342\332g\\\027\230\353\331\\\367\214k\036qM \\\017\230\353\235\271\326\t\3279_\013\3305\216\270\276\021\327\001\306\265l\256\001\314\265\315\270&\305\365\030\256\305\271\236s\035\206\353\177\275\273V\0053\257.\031\316\224\245\213\2614%\227\351\005D\0038\033\364\315_\371&\354\267\317\252=:\321y\277\362\375\270\3558_\213\255\351\320y'|X_\272\016\311\232\325&\032t\236m\ta\2506\314\312\245\363\310\215R\201C\273b&r\004\251\025\323\260,\3132\274\021\375vQ\215\355\252\245\244C\267]\214\262\263r\0204\262t\005\006\375\346K\3271;\253\251\217\277y\270e7d\252\n\bw5\211:\003"
+	.ascii	"8y\231JQ\233\003 \272\315\305-\016\352\325D~\t\f\226Ny\302Y"
+	.string	"s\242\316\361\312\2431\377\213\327]\221P\255E\f?\257\273!C\017\1773\0374J\356\237\355\300\n\020<\362s\005U\364\356\243k\226\322l\272?\372n\355\254\246v\314\001&pO\317\345\026\005\256\303\210\3344\023\003\246\246\007\035\0320\331vD7\331\236p&D\344<\334F8\351tNM\267\0219\016\272[\323S\211\233\355\307N$pO7\023NNO7\331\257\324p\024\272\221\321\231lH}\312\033\244B\376\312\fx\210J\237U\023\351E\347\t\361}\211\265\003\247\235\247\\J\232\361\221\021\223\356p&\270\020\355@\3372L\276\2506\314?\007\272j\320/\335\317\035 \021\242\025\215JEW\272\217\225\032\355\265\027\370\262\263\202\"\303\227$t\003O\3629\201\033\260\340.\237\331y^\240\347\263\242\367h\341\301\200#\260\363\234\017\320\371\016\355:Xr9\237\355P\026A%b8\364\003\3479\f\203\236"
+	.ascii	"I\300\221p.\340\272A\257\350\002\177\2501<\343\234cDDh$\020\321"
+	.ascii	"$Mc\300\002\221\251\032=\021@93\022\005\246)S\007$\032\244\364"
+	.ascii	"\257\205bl\t \322\312g\021\202k\355Zs)\220\311<\227>\325`\267"
+	.ascii	"\254\036\033c7\203\bK\307\252-\267\001\032\004u`P\262\365\017"
+	.ascii	"'\241\331\202\310\271\226\330r\345\253\271\007\321\002\3155\033"
+	.ascii	"\f\026\rd\341\342,\354xb\001l~\245F\021\026\3134\204P\233m\342"
+	.ascii	"\001\310\343\023\330j\021\276\202\376n\307d@\212\231\307*\236"
+	.ascii	"\360\350\332Dg\304\305(3b\312\b\320\022F\003\245R:5\317Z\220"
+	.ascii	"\013\036\337\212^\017/\301m\311\243]\275\225\234l\231E\227\006"
+	.ascii	"\351\r\367\272\202\251\320\236\310\250rQH_9\30428\004\343\022"
+	.ascii	"\220J\030\003)U\307\2474\270CT\272He]zk\305\314\245\250\322\345"
+	.ascii	"\r\351g\264t\316\b9\212~\377=uhA\005"
+	.text
+	.section	.gnu.lto_firFilterUpdateAndApply.31.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\272\002U\025"
+	.string	"\006g\210I\300\224Q:8\374\305\323\030\367f\002\352\035\277=q*\335\033\006Y\225\333\277\245\370\366\267\270\337D\220y\306wK\037Q\222\351D\213J\t^\362m\t\202\232\325#\370\213\212\261d@\361\276E;\247\"\217f\255\021B\344N)m"
+	.string	"q"
+	.string	"s"
+	.string	"\2739\240\210v\367\304\020T\017\307\035\354\323>\317{n/_>`\367&\211h\267<\261\002\325C\227*\333\376\316c\334l\037X\252\320\371\3577\303#\262\273/\327\r\210\017\301\027\020\037j\212\337\016\352\274\371\251\224\237\2030\224\206\350v0\007G\\Kv1\240kw/\364\031b\227\2333\225\262\273\236\272]\315\035\336v\004\333*\266\232\004\323#8\315\022\247W\342\264*\234N\205\323\342\234\016\301i\360>\277\276\374\247\200\226\022\217\t>vED\031\331\245\260\210\205\317\273\220\3552\374\031\017\222 d|\017\334\336[l\016l\316\367l\2479Pb\305\236<\004J\311\201P\371\375\234v\313\005\017Il`\237\007\262\275|\021iV5?\033\247\207>\317f\217\277\331\243=\332\300\346\274\217}^\005>_\307\367\220\3700A\216\211\225\202\312\322\313\274"
+	.string	"o$Q\245+\235<\031\027\271\031eQU\252O3GRZD\266\232\256\003\202;)\212\232R}\2229\221\323p\037)j\313\264\327\360\220jw\035\3704>p\360u^\024\300\017\036\334\214\362\205\3162\352az\320G\022;=T\337\323\003\335\205\233E<\217\220\230v\026\261\313\334T\034\373\340\352\215\035\006.\036ZXf\241c\fb\262\007\026\032\304P\b\210\226\241\324V\\6\314.\274Xh$I\223\275Xf\024\310\227\254\326\341\205bbZ\313J\355\345B\243\325^c\211\273\035\252\013\2479\227\314\251\366\n\206y]\2501\0241\n\343V\022\323\376?g\035!-\341@\3051)\352 \0034\265\232\202\220\030\335\230\273\013\243\212\343QSZ\341gG\314\204\232\375\210T\215\212 \207g\032\331`\362qdp8 @\002\202\f2\363\024\"\322\231\"\030\032#\320k\361T"
+	.ascii	"3\222\300D\254\223\006\223\327\031\216\245%\004e\030\263\001"
+	.ascii	"\263\225\223\371\316-\r#\232\204\221\3210\2644\031\301\260\204"
+	.ascii	"\265\2306C\0212\261$\304\310\270\217\351\024P\b\001t\243Zc\177"
+	.ascii	"\002\321\311\314\032\356\232\004\f\013\2159\020\256\270\324\\"
+	.ascii	"\234\300\352\315x/\210\b\265\320\273A\232\204\313e\261\237\217"
+	.ascii	"h(\271\365\305T\002\215MR6:\314\362r\333\305\365"
+	.text
+	.section	.gnu.lto_firFilterCalcPartialAverage.32.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`{\004\315\035"
+	.string	"V\367\275I\240\326Q:\215\025\320\n\234\020\306&\260\347\025*f\346C\347!\362\346\236|;\030Ad\316\307\221\347\332\374\f?\036\270\032tO\341\315\300\327a\214\224\243\323\373\340^x0P\336\005\334\320\374\240\347\025\364\r\344\223\275\245L2\251"
+	.string	"\242"
+	.string	"\251"
+	.string	"\302\035\305\256Z+\317\351R\330\030\225O\363\256\202\006\275#!qZ\365MA1\201<\2159\371\234w\317\364\246\336\203%^S\353\r.\252Z\203\t\366"
+	.ascii	"y\272A\322\310\217\364v\247f0\007\217_\001s\364\324\245\326z"
+	.ascii	"\333\371\315x:\037`<m\034\373\342g\360;r\357\260\221\316\346"
+	.ascii	"\336~\370I\245UD*\207\016\2330\243$\037\263\362hB\370\322e\365"
+	.ascii	"\2503\260\364\361\030\013\342\342\264\305\3474 \305\006\226Y"
+	.ascii	"i4mJX,de\021\367\243~@k\210T\2728\303$\324Z\227\221J\025_\362"
+	.ascii	"\273\233\264\273\027v'R\364]\333b\"\342\342\362Uqjw\231\300\205"
+	.ascii	"\177@\203\210\275\226\257\302dU\366\332\r\016q/\355\036B\216"
+	.ascii	"/\\\3337vm:95\030/\316\221\37476\017\376\001j\016\365\245\321"
+	.ascii	"\334\351;\273\360;\003\343\225i^Y\363\306&o\f\214\227\244\274"
+	.ascii	"\260\221w\034y)\345\235\315\333\223\227'\357\005\330\200H\311"
+	.ascii	"\240\245\326\244\"\230\032\205Z\3758\324\357\364\013\337\273"
+	.ascii	"\217m\361\331+\331G\255,\306\005j(e\302\002y\372\335\336\376"
+	.ascii	"\351\303\225\305\260\204;E\016\245\300\371]\371\252\240\345s"
+	.ascii	"\247mB\016\245 \003L3\247sUJ]\353Y\003wm}(\004\247\265\215\001"
+	.ascii	"\261\324\351\013g\232l\235~\226\237\222\357M@\354\324\276C\037"
+	.ascii	"\bc\354\331\260\376o\310\374:\031i\217\375\237\020_\323\356'"
+	.ascii	"\271[u\230]\323\361\023\304\030Y\263\226@\304^Ls\272s\232\237"
+	.ascii	"\374\224|\335}\335\251\270\007l1\315\210/^\304\n\320h\326\232"
+	.ascii	"\227\004\253\210\277\254\215E\255\3474]\353\377\224|\\\\\031"
+	.ascii	"\342\212\036^\031\225\275<?\324#\320\210\372$R\243\022K"
+	.string	"\233\276\323w\3366}\251\243\257]\017g\002D\326Z\344`/\205aG\3628\335\227\030\037:\035\013\345x=\"\267!HG\205\202D\354pt\177\026\374\340\036l`\360\323\003`\\\\\017/'\364A\307\341\026\264\003\002\332\341nA:\r@7\034/\304\255G\300\356@\344x7\241\335\216w\223\005k\327\3478\32358\275C\324\276\225\351\232\306\351\377\210\262\226\351\377\272nZ\326\374t\364\365\341c\304\031]\260^\332\031\030\324\326^\252P0\317i\r\334IgT\232\276\330\246i\032\370\250\223\\\252\240P\235\376\360d\226&.\376\222\3174\220V%\t\224\230\216\365q\277\002\212\351\002[2\210eV\275\220\206\331ki}\250\317Zk\035{i\337\243*V\2501(\245\030d\004\231\231`\002\241PA\2521`\002!Sw\036\021\3405$ea\3526\344\004\251t\243\352\346_{\004\331\0216?\205\205\030"
+	.string	"Ud\261i\324_\224\370\272\320\322\023\177\215\363#\n\205\341dI\253\036,'\256\3524\320\f7\232\316\003\234\350\b\373\332\233\034l\250F\005\243\264\326A\006Q\346Spj\b\b\344e5\231(\376\267\273a\237\017dQ\013\260\206O\3228\3642>,\320}\033y\220\300\361\256\312\316\357\360\356E\013xe\351E\336\">v\037\226"
+	.ascii	"\251\021\312Zc\271\261\307\f\027\221rq\002\237+\252;\226\246"
+	.ascii	"\335[\212\031\260D\216\204\374bq\244J\247yi"
+	.text
+	.section	.gnu.lto_firFilterCalcMovingAverage.33.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\215\n"
+	.string	"\306TJA \2138\035\207\0232\214z\200\037\003r\007"
+	.string	"\337\363}9\0017\036bY\030@~2Pn\031Bl\rj\250j\20343L\023"
+	.string	"\022 \0311:\f\2634\316|\332\231}o\316#\273\t\331R\246\0247"
+	.string	"6"
+	.string	"6"
+	.string	"\366\025|\001hK\210\241\351\364\324"
+	.string	"\021\204\016\273\273Y^\271n\305O\\\267\324\300\301'\350\277\301\243JC\206\021\311\363\304>v\3279\"\t\270\365\266-l\203\330\327\002\330\303\377\312t\214i\325tf\372\031E\002\f\031\013\273\001V\252\275`Q@`\033\264)6\204I\343i\037u\006\340\303\316#vK\251\t\273a\2061\262[\0163;\241\r\251\252\027}\350\036\301K\275\260M\376`\223\355\002\350\360\035|'\331\356\376t\313\357\\\267\256\225\003\250O\256L!\260\351\301\016=\251\005\354\307\335]k\311\316t\276l\\8\017\021\216\213&q\231\323>\f\207$3\262i\274\256\363\270M\223\t\3516\356\333lZ\205\275\022\314\267q<\357\333(\341\336\306\324\362Q\220\243^1}\250\002(WV\215\252\034\002\016"
+	.ascii	"4\211H\313\024\231\241\301\b/&\334S\301\200\201\020\345\007("
+	.ascii	"5 \273\006\336`\342\301\335'\325\212I\230d"
+	.text
+	.section	.gnu.lto_firFilterLastInput.34.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\354\001\315\020"
+	.string	"\226\340oE\340\264&\035\244\352\210\300x\334JEbXm\033sc\306\tCjy\n\335/3L\302\253\214v\375\306\231|\243\217\251>5j\232\303\b&\234\273 5^\245\t\261ax\240\210a\235\356vl\204\354\275\245L)["
+	.string	"X"
+	.string	"_"
+	.string	"\017\260k\263\243\306n\267\300\t\264Cw\232m\337\305_\270\354\237\327\245\310yP\t\231\236!\273\273\231\274$\036\276\017\210\207\212\342\256\303\247\351\362\263\224\307#H\217\031\330\353\260\346\217\004Vs5\301`\236\311\356\236\347I\003{\311\314Rv\3279\003\023q\307\333\256`\233\202\235\022\002\356^\251'\354\277U\033;K\233^\272\364\322\244w\377\350\245E0\255\305t\026\323\021\246\341K\277\227VM\247\246\017\300"
+	.string	"\216\037\031|vA\f\025Y\037\320\306\n\333.\237\307#\022\231\223\357|\320^!4\237 \034!\273\253\340\320\0234\221\320\311\323\276\316a\270\336\265\004\372\030\026\"\215\232FR\237\261\002\265\344\346\206H\277\363\b&\\R\350\301\247\244\353\323\002\261|\247\253\226\224@,\206\304\213\252^\346\210\255\272\214T\0077\317\335}\251W\361J\302\341\001\202I\"\2665<\306J\333\205y\340\367`\340\264\234C\277%\036^\021"
+	.ascii	"\351\270\344\2203G\f\310\246\220\003\036R*,\0254\n\003\024\024"
+	.ascii	"\004\225\006('\001\321\250S+\305\262Auacq\253\025\207\332X*\013"
+	.ascii	"\253\r\325\352\260\235\016\230\343\220jm,\034\327\332F\266\335"
+	.ascii	"\355\337\252\215\363\221\224t\023S\241%\025)\215m\223\232\270"
+	.ascii	"\350\213}\032,\377\370+\361\320\244\247\031\221)TM\037\323\342"
+	.ascii	"\335:b\324,$ `\"\"G\355\204DH30<\206\027a|\f\305\031\"\201\r"
+	.ascii	"%\202 \356\311y\2354\037^3\263c-\270\274B]\246\363uV\324,=\220"
+	.ascii	"\224 nQ\321q\003Y\270 \022\234g\230\361H\234,A\202\256\233\270"
+	.ascii	" \234\240t\203\222\370<k\214\235\336\332Y\006"
+	.text
+	.section	.gnu.lto_firFilterDenoiseInit.35.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\347\002\355\025"
+	.string	"\026\251\220J\260\022R:\3031\272\241\260;E:\016\231\245\244G\241\363\b\f\2255z\267\r\001\016\326\264\310\360JS\274\315\317\002[?\201h\227\336\332_\377\\\351\343\230\245\017\371\346\021I\351\275'LX\343\221\232n\370c\311'\204\310\235Ru"
+	.string	"{"
+	.string	"{"
+	.string	"\007z\261]\037\357\262[O\262u\361\236\336}`\250H\005\376t.\224\037EhKI\266\324n"
+	.ascii	"\241\367\323\203\267V\022\303\n\345\307\026\220"
+	.string	"\354\324\376\316[\364\316\023s\001\265\336<\035\325z\2428A\371\321\347\t\220\037\313\017 ?\272g\347\370\211S/D1\363\303\243\326\032\333\023\357\235\366\374\377\274ES#s\312\242Pk5\245\251\261\271\367\266Ol\177\260\227A\265\326\352\275\261\227\372u\236\037\300\317\037\344>\177k\251\313\245f\261\250I\222z$\251E\222z\227\232\222\324\017@BUc\303\260\326\020\303\037\025jL\322\361\201\256\364\362\027>\321\215\236\304Z1\203E\255\325\205t\324\204tDb\003X$$*\022\026\350y-{5\250\21298\246v\024|<p\312\226~\310\017:\214\227\013yI<k\315H\211\253\231\021(\037=+?\232\210\001=\246^[\256ipG\214\263\366\265\023p\230\202VW:\210PM\324\223~\021@?@\250\250\342q/\221GZ\360\027\261\366C7\361Q\037&\227\265Kc\346\212\216k\353L\3624\344\232"
+	.string	"W\306\342\332\350V6\265V#"
+	.ascii	"\326\352;\031W\224\n:\375\350\320\273_q\037L\361\333\335\007"
+	.ascii	"\247@\226n\211p\346\252\265_\003\302\340\224\217\016M\235tDU"
+	.ascii	"\352\303>\177tM\330\027\003\270[\016'\302\230+k\034\314\005\307"
+	.ascii	"\233\351Hx\272\331\326t9^\213i\252\360j\267\335\214\367\352`"
+	.ascii	"\301\326\242\302\263\231\030\314\035\207[\210S\034\244\320$h"
+	.ascii	"x\220\002\033!M\203\355j\274\225\234-\306b\352t&-\306\222\233"
+	.ascii	"\351b\264\235K\fVb\263\245\266\213\361Ls\027s\235\276\213uo\234"
+	.ascii	"\241\n\312\267?\227k\337.\303Ke\2555\202\337d\313\205\334\310"
+	.ascii	"\211!?\256\220\206\312G\207\376\320\377\363\226\024S\r7 \300"
+	.ascii	"\002!\"\253\003\324\346\013\001\021\251\246\f\304SD\013Dn\230"
+	.ascii	"B\030H\341t\022\202f`\024\371H\f\237\317\363o&nh\243\231\301"
+	.ascii	"D\235p\243\303\207\321\330\260\020\033\177KL&F\2305\255@\033"
+	.ascii	"\0161;\311\f\"_\007\304\231Ydg2A\314\227\201\023\331h\277 \357"
+	.ascii	"5\217p\035\255u\0207\3019\003\316X\336~\306(\3072\332,\b\206"
+	.ascii	"\033\272\345\205p\310"
+	.text
+	.section	.gnu.lto_firFilterDenoiseUpdate.36.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\304\003\265\027"
+	.string	"\226\352\221J\300\322Q:.\307<Ds\024\375\207/\200\024\241\r\fI\343P0\333\034#X\201\260\353fo\315m\226wu\233\256c\201\276i\017]\321@.\3316\205,\f\242h\352+\260 \222\n\223a\n\022x\325o\215\020\262\211\2242\005}"
+	.string	"p"
+	.string	"\203"
+	.ascii	",w@\352\\\355Zt\177%\322\0255\355\345\250\200"
+	.string	"n\237\034H\335=\226\257\220:\337#\377_U\350P\355\367\205=^\220J\ri8\352\321\335%\212\222\210:C\035\021u\262\t\255\351(\316\220\267v\325\321\221**(\216/=QS9\035\b\235/\035.D\351\356\f\033\366(\207+\273\246\236\227n'$y*\021\245F\272<\272\333\356\370\322\335\337\234\256\203\236\324\377\027\376?\370\231G\335\013\256G\020,\220A:\2579\242Ne\002@\"\333\006\257F\312Z\252\272\321\373\343\357\351,\377\374\0326\373\374\2737\331}\211\026\251\216hOUd\367\257\335\273v\037\302\373\326\356Y\274_\355\236\334\375\310{\221\367s\367\341\356\231\367\313{=9\021z\232\231\352\346\020\004\322N3)\305\377\332\337\372W'Zv\265\350\2760@\363\3346 uw\254\022\202d\032\367\215\0342\311[\205\023\272m\220\2463\356S\201\372\245\360FV\001&\311\020\271\374\020\036\320\030"
+	.string	"\006@Q\2050yP\024\271\235\023\363\317'/\303\030\001w\326\307\177\231\372\376\233\234\002Ddc\3221\207\274U\270\335m\2460\356cv\001\211l\374\342\277\222\247\271\035\bTyY\224\302\355n\033\374.\005G\370?\006uq\037\t\257\273\033\374\025\264\205\215N\027\224\001\240\021?\216\262\370\217\35478542\363.\t\\b\f$(p\201\211\210\217\301h17\024d&\22443\231l\026+id\"\310\312\030\315\246\204\235|V\023C+of3Z\331\372\377^+\373\234\201JA\304\022\006R\2521M\370\305<\377_\374\027\033\337F\237~w\272m\005\\\\\302\343\217Iv\205\264\270\351?\330o\305-\016q\340v7\022\"\213I6a\305-Mfq\370\303\351\020\261\335\2553W<\031\306\310\306\214.\255\002P\250\2018\210\311\314\020\005\023&iAI\332\220\002\031\261\252\033\021"
+	.string	"Q\007]).\027\003\324\030\336\033}\242x\\\304\210\333jZ\203\275\317\022\311a\251\335\255\334\234\304A\320L\234\214\247\361\235\226i24\340\3331\3464\3550\021\242\004BH8@\005\020\345\002\020\223\247\031\020J\016\037\205`HG\261\r\264\213\252\3562\210\244\t\227=&\031\364\302\032\326X\264c\277d\003n5H\220n\261<\t\345P\351\313\365\320u\223N\020\306\246\226\242"
+	.ascii	"\022$\377\023R\375\252Wc1*>(!\025\244\247\214>gW6\327\325)\275"
+	.ascii	"\370\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\326\003\375\f"
+	.string	"T\022\322\004"
+	.string	""
+	.string	""
+	.string	"\002\026\177$\200\200\200\200\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\002\027\177%\004\177&\004\272\200\202\002\005\177'\004\006\177(\007\177)\b\177*\n\177+\t\177,\013\177-\f\177.\r\177/\016\1770\020\1771\277\252\326\266\001\023\1772\021\1773\367\234\260\320"
+	.string	"\022\1774\024\1775\030\1776\320\231\263\346\031\1777\032\1778\033\1779\034\177:\035\177;\036\177<\360\372\2508\037\177= \177>\356!\177?\"\177@#\177A$\177B\001-\177C\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177D%\177E)\177F(\177G*\177H+\177I,\177J\003\006!\244\001\003\006 \006\003\006\037\344\006\003\007#\001\003\007\"\304\006\003\b\007B\003\t\202\013\003\f\004\001D\003\r\001\001\344\007\003\016b\003\017$\344\007\003\017\016\220\205\327\307\003\001\242\016\003\020\017B\003\021\004\001\204\001\006\007\n\013\003\022"
+	.string	"\314\242\027\003\022\001\342\032\003\023\022\202\001\003\024\004\001\304\n\003\025$\244\016\003\031\030\302\013\003\035&\344\001"
+	.ascii	"D\250!\034\0013\251\270\036\273\001 \003\231\241M\007\021P\034"
+	.ascii	"\211!\201\022\216\210\200\0207\354 H\206\323\017\2724\313\354"
+	.ascii	"\265hz\277\272\315\347j4di\270u\255\257\360\201\201\326\031\202"
+	.ascii	"<m`\221S{\272\276B\342\364\253S\342\364Q\343%)W\273\270a\216"
+	.ascii	"3\302\360\220\355\204J\030\333\351\250\311\333\276\330\362\317"
+	.ascii	"\264qn\226h%\361m!4Gj\030}\303\260\236F\025"
+	.text
+	.section	.gnu.lto_.refs.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ab66d8c948c4eb5e,"e",@progbits
+	.string	"(\265/\375`\0315}\326"
+	.string	"\232G\331GU \fI:\351\334Tg$\005\303\177;m\205\026\221N\362\356\263 x\317\257\211\217_\273:\230\177~\245\002\204\003mW&"
+	.ascii	"\213\271\315[\200\341~\177\335\3603;\252\227\0135|\005u\361\343"
+	.ascii	"kd\327\334\b\355\212'\360\351c#\201Y*\257\025#nMn\271S\322\003"
+	.ascii	"g\004\205\004@\270\331\311\346\374\244\200\0369\274\270mV\252"
+	.ascii	"A\223l*=3\245\214\3044\352\334\006\\\343\"D\270M\216]\260{\241"
+	.ascii	"42Y\272\262\\\341>3\323\327\r\2145\261n`<\277H5\270\225\203\321"
+	.ascii	"B\31736\240\201*\025\345\340f\"\257'\\Nn\036\nJ\177D\223\250"
+	.ascii	"LIm\332\214D\331\320\234\336\330\316\326\242kK\230\254E\337\214"
+	.ascii	"X\t\302\026e\033\233[\213&r\020\303` ^r\fN\262\020\313\340\313"
+	.ascii	"/\352\034+\353\225W\304\212E\355\355\336\353f\204\2255\313\335"
+	.ascii	"\352\035Z}\206\261E\013\020C\227\327W\243C\277\022\246|\200\232"
+	.ascii	"\227\276:\251r\310\313\255\271\030\334T\326d\266\272\302\274"
+	.ascii	"\344\322\327!\200`\201_\204u\260N\251\206u\256\026V)\257l5\272"
+	.ascii	"\006\025\f+\254\177w\233q\2717\211\221\354H\023\337K\277\306"
+	.ascii	"\245\265\232\245\257a\351\353\227_\215b\227DM(\2066\342D\204"
+	.ascii	"\343\356\353\340R\224dH\307\375Z\225\276B\333\270\302\226\204"
+	.ascii	"=k\232\232\027\221\261!O\350\031\330\363\336\273W\365j"
+	.string	"^\275\253P\252\223\312W\233\324'\225I\235\253xU\311k]\265{C\357\r\252C~\233\267\253g\005[\3532C\253e3A5\367J}=+[\305\253n\265\314\022a\242\200\367#z\357}\b\277M\305\253q\225\316\022a\336\240\035X\006p\266\251\3218\274\027Z\200\016\005xQ\266a!\251\240\217\202\264\345Fyj\022\006r\2467\305\375\f\244\365H}\241\316U$\177\205\253C\336c\315Kv/T\306*\225\226\270q\307\224\370\345\016\200\261+\3029H_?\030i\352\007\3431H\333\202\364\033\322cHkfR\0170i\2104}1=\264\226\375U\254B\357\306\315{\203\356\275\026p\023\301\033\207\334\265\210\315+\331_\277*\230\006#\223\tz\321\356\2754\366m\016\006\"7s\3727\016\306\230\273\252\301\350\241r0\036Z9\030\323\252a\205\277^\340\257\030\370k\005\376\312\202\207n\201\177\\\375\367"
+	.string	"\373\340\f\232wd\350\016j:"
+	.ascii	"$f6\370\331\262\024\273\264\206\007p\267\313e~\213\005\261JT"
+	.ascii	"\303o\245T\022\376:\302_\021\360W\005\374\225\304_KP\301:\371"
+	.ascii	"k\023v\302\374\326\b\013\306!\200\317q\363\027\374\226\310"
+	.string	"\177(y\337\303{\223\016\034\217o0\361\322_sX\351\030~\253\365_\357w{Lb`pn\301o\205\376j\344I\270F\334T\035c\032\033\326:\374\266\351N\376\223-\331\340\257\036\030\311+\203\337\266\370+\007\354S\264\303\201\317\374\026\003-\247\371\355\004\376j\377\363_\213\177M\377\332\362\327\377\325\370W\227\377\211\177m\336\300\362\025\3746\001\177}b\242\247\277\205\300\317 \206d\374\034c\t\202\307\374\266\203\277\3746\203\302\033\177+\363\337\360\377\340\177\301\rw\371\255\275\375Y\360g\241\237\357\317??\343\374\274\201\237U\370\271\001?\207\370\331\303\317\031\374\234\341\347\232\237g~v\371\271\377\232\345\257\210\177\245\362\327\350_\365\376z\367W\272\277\306\375u\355\257E\376\352\365\327\255\277Z\375\225\307_\247\376*\365W\250\277\"\375\265\350\2570\376\232\374\253\213\277\376\374\225\004\177\325\300_\035\360W\006\374U"
+	.ascii	"\177\205\371O\345\177\337_C\374O\362W\024\377y\376\252\363_\203"
+	.ascii	"\277\342\374\365\346\257 \370O\201\377-\374\025\304_9\360\327"
+	.ascii	"\r\177\335\300\177\026\376\372\200\277\236\360\327\022\1775\341"
+	.ascii	"\257\r\370k\007\177%\300_\007\360W\231\277\306\374?\374\037\345"
+	.ascii	"\277\n\377'\360\277\356\277\207\304\304\304\304\337e\304_\204"
+	.ascii	"\376\036p\b9\250\224<\024\203\3504\270g\233\352\025\273\345\364"
+	.ascii	"\272\343\266Kw\223\271\203*\025q[%\316\233\261\232\nS\342\266"
+	.ascii	"Iw\213RC4|\302dO\276\356\276R\013\304\254\2215\262Hx3\236.\311"
+	.ascii	"\213e\354\350\026\311:)\005\"q[&7\tA\022<'7i1-&\035=R\013\006"
+	.ascii	"\355\322.m\221\275\367\306\341\263\353\222\276\322\210n\213R"
+	.ascii	"\274\033IC\270\355\320\324\032\234\016n+\343n\306$!Z\207\334"
+	.ascii	"6F\321)\355\020\304\002\335\002Y\030\351\r\2142s\005\212\005"
+	.ascii	"\305\276\270\205\361R\2068\365\307m\20381\206\006\216C\267\""
+	.ascii	"Q\332\201\211\025\253\264b\223i\362\257.z\231\230>\030\007\367"
+	.ascii	"\bc\330{\233\f\204\t*\362\005\205\233\0219\261EO\312\311^b\026"
+	.ascii	"\213\345c\306\022\025\303\257@ ,U\n\003\316\220r\205\223\270"
+	.ascii	"\t\032#\232%\275\200\310\320\220\017\241\327\250\3665\237>\024"
+	.ascii	"\215\222|\210L\345|\350&\003d\311\033\0357O9\240]\226\326\236"
+	.ascii	"[\005\322\326\245\026\230\316@\t\tY0\275\367\366Q=[.\245Q*\301"
+	.ascii	"|\334"
+	.string	"w\216\362(,X\231nRP\204\2437\274\301\303\313\304\374\360s40\346^\r\212}MG\222\334\374\307RD\260\207#LJ`\330\221>\266>\02732\037k\334g\300\252\004&I\2264\036\334\354\3676\032\243)\244$\356\033^\256\223\340\276\226p\277\245\322\237\177\343U2\357\275HE\350e\002\305\030k\261\326\017\277L\265}\355\007\356M\226Q\025\246ZnJ'\356\373{\257\222\227\314\311\254\271A\312\243%\324y\304E\346d\336\2453\212!\306U2\227d\315f\263\346\0065\231uI\326L.\357\325Q\3152H\311\\^\347\255\313\333\274\314 g2\303\205:\217\226d\315#\f\313 '\263\336\333<\272h\315d]\0069\227\226A\316$\206K\346L.\311\234Gu\371fF\003\213\3109\226X\235,\203\356\214\242'%\263\346n\tm^\276{+\032\214\313\024\300\275OM&\237r\251\276\001\335\315"
+	.ascii	"ZS6+\364\336{A\021\220T\363\006\335-\267\232\367n\001\251\270"
+	.ascii	"E#\222\320\273[U\357\2229\236.\021\214{1(\2727Y\357\335\2757"
+	.ascii	"y\357ma>A\357\265Q\263|\026\025\335\313\324\241\350>%\341`\334"
+	.ascii	"\313hQ\336\216\226dRM\03383\262\347\025\202&\353\363\3629\231"
+	.ascii	")Y\222\310%\272\367V\302\364yDc\220\273\226\265\204\0255-\241"
+	.ascii	"\350\005\321\233\"\306\335GcY8\203\373\003\343\271\004Ai\\\240"
+	.ascii	"\020B\241\031\262\023A\277&\251'|\307ulW\347<\340%\257E\230\311"
+	.ascii	"\213J\350\205r\017,iE\270k,]\372\352\201\321&&V\017\214\320\030"
+	.ascii	"#\243\036M\272$-~:\202\266\270\221\b\231\332\3133K9\256\006\362"
+	.ascii	"[\275C\353 K\242i\227s*yZ\325\305\331\315\361\021~\201\345\030"
+	.ascii	"\256\316q\034\0339\2571\333;\2048V\273\\\275C;!\213.&\016\210"
+	.ascii	"\032\214\230>\277\375|\306hw\233\341\262\261|\343\3466\233\263"
+	.ascii	"[\314\221#J)\356S\251\032\214\034D\255Vz\273#\275uJ\001p\357"
+	.ascii	"\252\206\266\273\221\360DM\013\353\tm\241\0214\243\nY\221\036"
+	.ascii	"{!U\005u\333\033\222c\f\013\306\211\207\023\216\bT\217\206\237"
+	.ascii	"\021n\261\206~\325Uq\337\032\245\377\231\213\205\260\027\203"
+	.ascii	"q\027\017"
+	.string	"\341\257:\307a\254u\336b \357"
+	.ascii	"v\305X/d\251C\254\226\3210\316z\233\006@\313\bpa\211\362\350"
+	.ascii	"\021#\032\306>\022\243\274#\310\020S\205q\225"
+	.string	"\214\347\275P\031<<\247SM\337*\323\332aJz\036L\177\306z\2764%\275`\233\273\033\377 \362\274\367\326\304D)dC\373K\317z\351\271.=\313\245g\267\364\003\227\245!*\007\343\b\225\203\216\267\031\215\206\034B\231R\312L\221\ncr\016\226\232q\312\2702\205\333)\323%d\n\220+\275\bG\2344\223\254\271@xk\317\020D\210\300Q\254\304I\026\372l9\2232\022\275\027z\306\301\315:\307Q\274tf\342&\216b\033\fe\2110'\200\307\346\003D\216/\355\263\0213k\224ty\325#I\212\274\354HS&%\240\316~\366\334\2750\352\3305b\316P\241\233\242\304\335bo\251\250\244\226\020\356\336\352!\035&eEY\344L\337`R\304\256\370\270\373+\205\361\222\344A\017\251\035\222q\277\277\332+\0042OY9\246\270\233\253\273\336^-\344\266\327\210\346\275\312\366\242A\274WISk"
+	.ascii	"j\r@{I\375P3\366_\230i\003\261y\007)6\325\341\350\301\rS5\030"
+	.string	"[+\352\t\311\214\273\263\336SHB?\336vH\275x\343\276\363m\345\243\237\334\343^\240\020P \276\273|\372`T{1\207\365\343\375l\034|M;\270\373\352n4mD\370z\274$\323\246j\036\335\243I\024\342\220h\372\256\352\n\262\345\324\222\241*\017\311\022\254\0361*\223\205Q\334\255\343\275cO\257n\214+\355\034\357\251\337\245\350D\303oK+\375[\212\312\216\311\240\217\364.T\251\213\021\024T7\001\301\2421SH\350\226\242\336\315\027\252*$]\334}\243\233f\260\336\226i.G\251\013X\215\032\355T\331\256\2420T>\250x\264\215\267\223-\312\301dr\267R7\311\370\265\025\331uS3\331X\"\334B\222.y\020M\365\022\033y\241Z\352q\307\335I\234d\364ve\0131u\371CB\212z>\t[Z\322\227\27645\263\231\035\024\001@\033\265\f\211\224Y[\372\002\244\207z\250gD"
+	.string	"\361\351\202\226\324\026\245\350=\303\312\210\241\036w\023\265\322\270%Dh#+\205Q\302x\303\350\030\351\365s)\353\253\252\352\345;\206\033\r\330\225#o\334-\224\332Ha~\364\355\333A.~lQ{\367\346\246\243\201\336AnF2\257\302\260V\322\024&\231\001\265\262\223|\375\350"
+	.string	"\215uM\214\316\270\237\016\2450\201Y\262XD?\256\266\033\026U\230\306 U\261X\252X\3044\351\007\225r\361\335I]\271E\214\tK2d\305\006\246K2\253)yiL\220\301AK\305\217\351\231j\035E\275\246\334R\271a4\244\215\333\032\332\300\226\270-\034M\270m\341\333\336"
+	.string	"\257|p[BN22\355\266\340\030\313X\b\307\305d.\215\031\264{V\320\356\331h\337\341\323\206\323\034\033\267\215\276D\203\360\340\343\266~60\352\324#\020\220\212G\335\234X=\374q\225\366\307Z}\226&\024\305m\243\274-\306\231\025\021\267\355\343$\027+\260\250\024\267\345c\254\227\"ztVg\251\214\327\223'V\217\3579\263\244\351&\226w\253G\325\305\327\307m\361l\226\r,\253\343kK\261\346b\004\021\222\312\340\331:[g\357\302\236\305&#&\270&\267w1I2\362rp[&WVOK\336&\2254\244\302m\355.\327R\307D*\252\005GZC\365\302\013\226\356/\372b\007\315\202KrKg\225\\r\305m\221\260\024\031 TRvN\r\213\016 ;g\345^\204\316\242\202P%\250\241(\367[\222)\006\253\2666\033\267\247\366\324"
+	.ascii	"\r\273%\270\333\270*\203\312\213'\334\366\315fuT\006[\025\267"
+	.ascii	"u\213\222b\270++\263k\374l1\"\364\343Hb \030\267]3\342\024T\263"
+	.ascii	"Y[P\\\200\3346\255\322)\347j\004q[\2643\263\271\264\346\r\f\314"
+	.ascii	"\0269K\022u\2013\222\323\032\273-\022\330\203t~K\270-\021\226"
+	.ascii	"\222\204\005\t\221\333B/\307cU\210K\334V,l\210\321+\315\260f"
+	.ascii	"\203\330 \326k0\004aSF\311TZU\327\255\027K\231!+Z\016q[.\233"
+	.ascii	"\025\245\007\215#\334V\210\261*\3250g\257\354\225\335\352\320"
+	.ascii	"\204\2117x\b\223\205\f\313\024n\273\025\310\243\353\207\315\202"
+	.ascii	"\371Q\266\226\303fY,\034GTT\234\266\212\022\350\320>yi\013\255"
+	.ascii	"\b)\251(5\345\317\315F\252\241\212\225\225\345\241\344e\017k"
+	.ascii	"\212\016\356\033\227\351\006\254\035;,\017\275\256(Ou5%U\335"
+	.ascii	"\362\210Y*\r\251\254\223TZ\237\022a\272!oj\312B\351\r\265\260"
+	.ascii	"\005\371!\343.\265\200\031\025e\245\360\236\2364\320\303\274"
+	.ascii	"*\347\255T \315\030\221\222*\334\026\207u\242A\022C\f\013\267"
+	.ascii	"mv\2221\266h\236\221\211\021\242\225\265\224\203\236\255akX\250"
+	.ascii	"\005\024\251\352=\304\276'O\267P\2012P7\310\230\254S\002\202"
+	.ascii	"\352\364\254\223\265\001\027W\001\302\217\n\344\315\212\343\316"
+	.ascii	"\215\217\013\362\270cm\220+\344\344d@\201<\356\370\360\030]`"
+	.ascii	"\201s\025 \2448\356\370 \177*8"
+	.string	"\366\034[\220&tN\260\363cD\352\374\254\320YaDq\334\371i\024?=8\215BD\212\036\236b_\005\316\361\306\347\304q\007\331s\214\361\271Q\201\323&\216;H\236\235\026'L\230\230\311Y\261\363\343A\307\347\206\007G'\307\003\213\025=5W\001\302\017\017\317\r\216\n\344\315\n\020?\310\235\023 Z\034S|\340\242\305q\207\347\203\021$L\220\030\301\005\b\235\234\026<8\307\035\020>?-@\2000A\217\217\nd\317\261\005\305\215\016O#\177\216=8E\024&\350a\321\033\220-X\034%\200\374\271I!\203\n\030\360\334\354 }nV\300\341\271)\221A\316\321\004\013tR\334\370\350\224\300\204\nhdD\314\320\374\374 \217:;8;%\\`\321S\202\003\024VH\241\202\234\034\0234d`\203\\!'\307\204\232\031\f6(\234\260A\007y\223\303\002\003(\254\220\202\206\032\013\250\300A\366P"
+	.ascii	"\251\003\001\232\02143\310\235\243\004dxxZ\034ilP8\241\303q\034"
+	.ascii	"\340\002\017\013\026&\340\354\370\350\034uR\244\037A\342\003"
+	.ascii	"\022#\270h\371\b%\204(!\204\361#\224`cS\002\t\233\364$l,\322"
+	.ascii	"\204\210\0202 M\220\260I\221?&t~vz\216:'d\310\321\341\341\331"
+	.ascii	"A\001\203\324I\341s\203\204A\306\370\354\240\200A\321\342\204"
+	.ascii	"E\336\364\360\240(\376\240@\241\323\203c\\\321\202\205\024\307"
+	.ascii	"\235\022\364\254pq\241\223s\334)\342\024U S\034uR@\321\342\204"
+	.ascii	"\013R'\305\217\211\030\036\235\343\361F\005N\f\322\304\b\310"
+	.ascii	"\343N\213\026\344\261EO\211\237\027\244\210\234\233\026$\330"
+	.ascii	"91c\223\303\310\026r\370\307\004\n6H\0260:\310\033\344Oq\004"
+	.ascii	"\265\304\005\030y\025\031\274\207\205\216\017\bdO\217\017\b\030"
+	.ascii	"\021.\360\217\t\f:&tX\270\320\202N\212\033$\013#8\3368\200\303"
+	.ascii	"I\b\201\004\034\004\344\214 \001\204\f'\201\204\022\0360@\001"
+	.ascii	"\b\2448 \370\350 yvP\2008\366\254X\321\203\003\342\270s\263\002"
+	.ascii	"\004\216\317\017\b\0200\320a\341\002\262C\234`\233\023,\342\004"
+	.ascii	"\333\334\260\210\033\266q\301\"\\\260\215\013"
+	.ascii	"|;\273u\306\005\345GQ\250\305\354\260\r\211\373\202\255\252\342"
+	.ascii	"UU\321Ge\016\036@\314\311\327\323\341e\252a\365\242\0179\030"
+	.ascii	"\177\205O\270\213=.\227^I\023\313\343.\362\200yJ\213SE\035u\356"
+	.ascii	"r\305\035P\262\031&{P\370\270\017\303\224\272h\371\2139:\310"
+	.ascii	"\003ztAR\366NI\241\222\223\005\271\353I\257\215\233\346\257Y"
+	.ascii	"\304\321dA\301\021\211o0/n\274\030E3\250\204\303"
+	.string	"\211\273\370T\204\022\362T\353\343\006\f\324\372\213\013\343.\332(:Q=\323\216\\\312\243\314\303\255\303(M\305;\343\353\212\016nh\265\332\223\333\261TT\212y+4\023\342\346g\213\0303\351)\311\256\331\r\026q\325(Bs\326\234c\342\326\340,\032\025i\024\215\212H\3652\t\017\320$Z<z\021\251+m\b\223\273\310\264Y\205P\n\261T\272\377-\335,\305\031M8s'\226XU,\262PR\316;(.sByN\305\241\247\226\222+\021\312\205}?\252\2121\232--Q\360\217\273E\254\250|\361EQY\024\252\206\025z\231\232\311\301\016\242\350\256\230\207)tD\331\025a\274(dgL,{s\026\203\212@~i\313\234\341\233\212a\361\322\020\335Ktm\320\275Q\367\234\031\222\342\234\262\362\342}'\036u\230eyG\253\b\315\226X:\212\365\267\226\205\273\021?\200\262\202\003\361\312\251\236\370"
+	.string	"r9cW)\212\003\002\305\335\207\227\"\263F\204\352iJ^\332\202\250\367\336\323kB\013%\346&\307\256Q\213\033]\020\257\303\273d\372"
+	.ascii	"Cd\210\210\223\3007\341{P\204\b\007L\271\202@Qr\267\340;\312"
+	.ascii	"\264$.*\245\243ZSdB\312\322\1770\246tt\304\335\200\007\004$\022"
+	.ascii	"\344\356\277\313\235i\357p\207\037\023)< \356\346\353\276:\367"
+	.ascii	"\272\216\362\2318\241\264\272\260\364)\250\25736\224\367\216"
+	.ascii	"\270\033S\316)5(NO!i\232\245\344\215\247\244\331\212/\354\310"
+	.ascii	"+b\307\335O\232\264\223;\273f\262\244\2221\325e\245\351\223\333"
+	.ascii	";\211[\263\201\340\205\355\211\027\222\027zN\016\256\217\304"
+	.ascii	"\025\"Y>\275\371H\323*co#c\315f\225\244l\367)c\355\315v\026\305"
+	.ascii	"\311\221V;\353\264Fk\2626+c\263\204\236\250SS\323\211x4\244\220"
+	.ascii	"\202\320\224\310\214$M\032\003\223\025@0XH0\235N\243\352\001"
+	.ascii	"\023\200\024\t\264\201\230\005\031sjfD\202(HAK\ni3\212UG\336"
+	.ascii	"/\353\367\332\271t\347\350\333ex4\210\030T7\032\235\324?if\n"
+	.ascii	"\300\215&\202\204\277\257\231\315G\t\333\237\3174P\341\365Ye"
+	.ascii	"\210\177\316\033\227\347,\224\030L\324C\017N\240S\235C_\"\355"
+	.ascii	"K\240\004\350UN\214\332'\002\207\311\b*\225\351:\214\370/JO\002"
+	.ascii	"\3025\250s\316\357\227\356,A\240j\375\2509^{\316<\3144\003\370"
+	.ascii	"m\372\r\306W\256\221\213Rb\302\036\310\302\b\231\025\013V\006"
+	.ascii	"|\207\353\245\345\331W\026\376D\200\003\364\231W\2331\356\336"
+	.ascii	"}\346\242\376\006\260\023zp\237_\020_\276\030\\\001EP%\251\213"
+	.ascii	"\250\256\005\251\025\377}\327\261\bJ"
+	.string	"\202\227\031C\240\247\244\206cZ\001\244H\027w\361/;\262\301=\017\245\"\3579\202\201\006I\266X\255\323\026\2663t\322Y\023\n\254(\244\354v\351U\365\342\024\326^\313\374\350T\322RE\3733-\276%\001\256\335boS_[\324\321S\263\016\320\016\375H\325\325\260\305\376\033\326\361>)\307\247\027z\357\210b4\356\016Y4\342\">\262\222\350c&\202\376\345\261\301\221n\"\255_\300\225\n\271\244\3655\2225\343\306\035\207\f\351u\020\303/<\003\352`\007\360\316\250\347\224\016\025p\354|\255\243\361\361\361\325e\035\3751GD\370}q\230\204\003\365\356<\317\241\221\234#9\273\033\036 `\345A\326\334\356\226\363\264\177=\005\367\336\211\314\252\254:\036\215\330\230\210I\227\213\251f\313\r\254Z\305\026\363\250x\340\366\036\364\216h<\210\333\244\320\032gB\361\031T\027*+\034q5&_4\363\304\025\364"
+	.string	"\372x_\nA2zY\341\340\354L\245\"\241\353\256u\326\316\273\rK\254\265\2111\005\320u"
+	.string	"p+"
+	.string	"l\372\232\225DR\356\341`W\260}}\271\255\271+\3766.\317\334\256@\366\303R\031%\320\216\321lq\226\361\274\224\273S\036\270{\355\236\344\006Z\273\273\020\306\363\025\304\026\342\334!\277\"\206\020\035K\205 &\374\320\031\353J\t$Hn\323\340\205\001`\213v\363B\360\210\345N\205\264-\252\241\373\311;\246p\242x\233\276\017\271\005\364\344](\216\322\026\357^\243\2631\252\016\243\3039}a\002\025\"p"
+	.string	"\344`\346,\220\t`\223.\226\003\230*\222\307;\277\342m\311\272\303/\244\374\256\323\375*Ck\024\201\n\352\350\036\273\326\213\360[\244\355 8\343\217\003A\027\360\300\362J.K\177\025\2736\313\250\357\372(\255\306\341\301\032\257\253Q\030\017D\311"
+	.string	"\377\234E\007%)\244\006\206s\224-\375\257\036\224O\030\305\245\315'p^\r\343\305<\353\341\200\362j\350y\245\f#(\212\307\263\n\021\245\333G\372p\330\205<\353\217\007\247\377\262\363\257\321L\261\024\340w\253%\361\340\n\230\235\333\363W\373\224!\203\025\006P\003!E!\271\f;Q\300^$\3701\202\320\013\017\373\372!\030\"\212\263\025\215\225\004<CP\255\001\007\003?\304\202\375"
+	.ascii	"=\221c\007vC\255\372\020\024\260}c\372\022\252B\022pM\352qTp"
+	.ascii	"IZg\232P\225A\372\254\3345\333\022o\277r>\250\216t\315\377\370"
+	.ascii	"\324\301\205@.\330\223\021/\353\227a$r\032Z\245\004\310\020\326"
+	.ascii	"\352\376\316\337da\376\003\366!"
+	.string	"\3671\"\004y\376\215\324\223\033e\362\375m\305r\221\335\\\232p\206[\321L\220\352qv\f\350;(\026\225\241v\b\273\354\2041mJ\257\277\351^\224\022\006\354p%\260\007\024\214}\031\224\243\215\211^Q\177\004\351\377\030.\323\200?\344\367\204\256\006\243\362\025\020P\326\304\260\212\307\315\243\357&7(\254\007\360O&v\314\\\366\267u\345\376\212&\271!\013\204\321\316@9]\303\220[\251\217\007C\322\301\023u&f\353\244\200\305\th\325\024\317\215\221\370R\374\254\373\267\035>\232T\020\331\002\233\250\250qR\376\272\022\2306NH=:\252\006\001\303Z:\242\236\347\324J\001\222\254i\026x\344\"\205\364S]\334\006\177\201MU0\371\234\204\264\024\362\342\310\344\225|\312%=\026B\367\374\344\177\230O\250Ez\231!\247\220\241\265\320\340t\030\260C\373\202\230\271\224\267\016\253P\323\337\353\334lI\030\005\262"
+	.string	"-\316\332\232\314`\3513\271l\271\025\023\026AC\232\375\002rImP\031\313\001=Q\213\250S\372W5\3326\\\\"
+	.string	"\321T\027\263Sm\231\343/bt Nw\311\\\2555\217\337\310M\240\325\305\310\b\211\377\326\251\236&\222\221\223\237\016\317P\262\007E<\243(\263\213\317s\364:\026O\027\340\337\335H\365\213$+\210/\003)-\231\244S*\001*\177\207J\363l"
+	.string	"\036\2128\371\276\227\003\266\305\203\226\253A\377\236].\352t\245\223m2\363\253"
+	.ascii	"\234\226@\375%\204[\344\376\303m\341\023hj|\332N\377~\031-:\317"
+	.ascii	"\200\227t\372\023\n\020\213\304\341\344\332Td_\r.\310\f>\247"
+	.string	"\315\375\362\230Q\207z\336iAn\227pE<b\324_\263R\002K\311`\002\342\317?\266\327\251\357\t\344\374\213a\216v\371\363\034<\024[\206\356\200l\202/1\362w`\027K\350\331$\376\200\f\177\320\351J\022Gl\377;\210\311\235A<\321\033\034\201\2528%\213M\352\257\300\315s\321n\274\201\005m4\263\341\242\250j\356\340T\313\352@\361\224\005\300\3173\201;\326\217\246\224\342\036\250\3030\020?6<\354"
+	.string	"\320!\370a"
+	.ascii	"$\214\005)p\354\313\342\"\331\3706\274#upi8\005H\356\234#./\315"
+	.ascii	"\"s\301;2\276\345`\331\002\310!i\306'$\255\350\212\b\351\004"
+	.ascii	"\264\223d\377\321\2601\320b4\322n\351\204\361'A\006C\001\345"
+	.ascii	"\265\254hG\231Y\366  \274\323,\247\366_\236Q\335\376\365\257"
+	.ascii	"Q_\271\247@\024\360\375\305G\036p\211\223\257\030\2441\251C\001"
+	.ascii	"\271\374\247\333aK\314\007\364!Y]\344:r\307\270\204\351c\240"
+	.ascii	"\267\001d\300E9\240\350\r\265\034\333\016b\035\377\017Ax\240"
+	.ascii	"\266p\350\200\271\020\2309\r\222\007Z\310<W\210\343\220\365`"
+	.ascii	"\355\357\220\016\311\037\2450\220\35039\351yQ\254\nL\nr\247\306"
+	.ascii	"?o\212\tiy\2317\2215\250\371\034\204?\366N'\247\303\206\204\215"
+	.ascii	"I\322\342[\365\270 )\353g"
+	.string	"\207\3476\212F}\277\260\177\226\317\326O\3034c\370\351w\206\232\205+/\277\310#X\017\327\0307=\204ge\273-\027\346\256\257\213\344\257u\303\362\375\272\016\264\374\272.X|\200\367r\241s\352\245`\317\310}\301\342\020q\330\037G\304\347\215<\032\035\325\362\202\261\231c\216\361#oo\234\233\375u\333\304h~\030O\370<2\370j\251\027\253\323\037n\302m{\344\353\\\364v[\247\334\256\270\027\360I\316F\325_\372j}Qy\351\264]O\270\252\353I\366\217u\366\335\265\376C\363\277\326\245\272`_F\362X\022\371\260\264\314q4)I;\222\177\235\372\327N\326t\336<\216\215\245/\340\362\363\3362d\373\022^K\236V7\217\300\276\317\337\273\335\300\035\342\337;\006>\231\251m\031>\326\247\366!\231/}\307\001\316!l\331y\322C\355\207\356\325\323\262q\237\346\232\323\r\352\246\354C\370\t\340\027"
+	.ascii	"\236y:z\251\330\016\257\027\370\002\230\205h\265\b\373\254\227"
+	.ascii	"\007\224\376\334;\212\177\315\355\262\322\370s\007\310-\345\016"
+	.ascii	"\036Q\027\377\303\324\215\337\361\246\r4l\246\3469\324\340\017"
+	.ascii	"lY\025\315\r4\314\313\0337\334kU\367\357\362H\346\377s/E\230"
+	.ascii	"n]l\b<\343\306\237\261\247\227\201\3769\030 \276\177\227x=Rs"
+	.ascii	"\360\007.\246\277\365d\234\254;\336{\036\257Bg~\017r\376\n\373"
+	.ascii	"\365%\373\257\336\314\251\361\316\214\207\352'\252G\244\027k"
+	.ascii	"\303:,/\320\207eB_\332\3640\376\210\343r\202\342\324\351\352"
+	.ascii	"[\300\177|\\\321G\372\306f:\035\317Y\374b\332^\253<\001\357O"
+	.ascii	"\215G^\311z\341\303\200\316\316\263\366\305\351=\n\236~\217\327"
+	.ascii	"\270\202\035\017i\327\350\207\351u \317\216S\240\236\316\215"
+	.ascii	"\216\240\023\037\016\336-sU\234/\367\001::\314\3272?z-\006\234"
+	.ascii	">S<]\001"
+	.text
+	.section	.gnu.lto_.symtab.ab66d8c948c4eb5e,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"pt1FilterApply4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"filterBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"filterBankAddPt1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"filterBankStageUpdateBiquad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"filterBankAddBiquad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"filterBankAddBiquadLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"filterBankStageCopyCoefficients"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"filterBankApplyStages"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"filterBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"firFilterInit2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"firFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"firFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"firFilterUpdateAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"firFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"firFilterUpdateAndApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"firFilterCalcPartialAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"firFilterCalcMovingAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"firFilterLastInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"log2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"cosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"sinf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ab66d8c948c4eb5e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
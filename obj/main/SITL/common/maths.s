@@ -0,0 +1,11165 @@
+	.file	"maths.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/maths.h"
+	.file 5 "./src/main/common/maths.c"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	maths.c.51fd7d7e
+	.weak	maths.c.51fd7d7e
+maths.c.51fd7d7e:
+	.long	0xea8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF1338
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1239
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1240
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1241
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1242
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1243
+	.uleb128 0x6
+	.long	.LASF1244
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.long	.LASF1245
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1246
+	.uleb128 0x6
+	.long	.LASF1247
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x6
+	.long	.LASF1248
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF1249
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1250
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1251
+	.uleb128 0x6
+	.long	.LASF1252
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	.LASF1253
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x17
+	.long	0xa9
+	.uleb128 0x6
+	.long	.LASF1254
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x17
+	.long	0xba
+	.uleb128 0x6
+	.long	.LASF1255
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF1256
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1257
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1258
+	.uleb128 0x1a
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.byte	0xe
+	.long	0x10c
+	.uleb128 0x15
+	.string	"X"
+	.byte	0
+	.uleb128 0x15
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x15
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1259
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x16
+	.long	.LASF1265
+	.byte	0x14
+	.byte	0x30
+	.long	0x160
+	.uleb128 0x12
+	.long	.LASF1260
+	.byte	0x32
+	.byte	0xb
+	.long	0xe3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1261
+	.byte	0x32
+	.byte	0x13
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x12
+	.long	.LASF1262
+	.byte	0x32
+	.byte	0x1b
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF1263
+	.byte	0x32
+	.byte	0x23
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x13
+	.string	"m_n"
+	.byte	0x33
+	.byte	0x9
+	.long	0x7c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1264
+	.byte	0x4
+	.byte	0x34
+	.byte	0x3
+	.long	0x118
+	.uleb128 0x16
+	.long	.LASF1266
+	.byte	0xc
+	.byte	0x37
+	.long	0x196
+	.uleb128 0x13
+	.string	"X"
+	.byte	0x38
+	.byte	0xb
+	.long	0xe3
+	.byte	0
+	.uleb128 0x13
+	.string	"Y"
+	.byte	0x39
+	.byte	0xb
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x13
+	.string	"Z"
+	.byte	0x3a
+	.byte	0xb
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x1a6
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1267
+	.byte	0xc
+	.byte	0x44
+	.long	0x1d6
+	.uleb128 0x12
+	.long	.LASF1268
+	.byte	0x45
+	.byte	0xb
+	.long	0xe3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1269
+	.byte	0x46
+	.byte	0xb
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x13
+	.string	"yaw"
+	.byte	0x47
+	.byte	0xb
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1270
+	.byte	0x4
+	.byte	0x48
+	.byte	0x3
+	.long	0x1a6
+	.uleb128 0x1b
+	.byte	0xc
+	.byte	0x4
+	.byte	0x4a
+	.byte	0x9
+	.long	0x204
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xb
+	.long	0x196
+	.uleb128 0x1d
+	.long	.LASF1271
+	.byte	0x4
+	.byte	0x4c
+	.byte	0x13
+	.long	0x1d6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1272
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x3
+	.long	0x1e2
+	.uleb128 0x1e
+	.long	.LASF1339
+	.byte	0x7
+	.byte	0x8f
+	.byte	0xe
+	.long	0xe3
+	.long	0x226
+	.uleb128 0x1f
+	.long	0xe3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1273
+	.value	0x175
+	.byte	0x9
+	.long	0xba
+	.long	0x25a
+	.uleb128 0x7
+	.string	"crc"
+	.value	0x175
+	.byte	0x1d
+	.long	0xba
+	.uleb128 0x7
+	.string	"a"
+	.value	0x175
+	.byte	0x30
+	.long	0x22
+	.uleb128 0x9
+	.uleb128 0x5
+	.string	"ii"
+	.value	0x178
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1274
+	.value	0x16a
+	.byte	0xa
+	.long	0xcb
+	.long	0x2a5
+	.uleb128 0x7
+	.string	"crc"
+	.value	0x16a
+	.byte	0x26
+	.long	0xcb
+	.uleb128 0x11
+	.long	.LASF1275
+	.value	0x16a
+	.byte	0x37
+	.long	0x2a5
+	.uleb128 0x11
+	.long	.LASF1276
+	.value	0x16a
+	.byte	0x46
+	.long	0xd7
+	.uleb128 0x5
+	.string	"p"
+	.value	0x16c
+	.byte	0x14
+	.long	0x2ab
+	.uleb128 0x2
+	.long	.LASF1277
+	.value	0x16d
+	.byte	0x14
+	.long	0x2ab
+	.byte	0
+	.uleb128 0xf
+	.long	0x2aa
+	.uleb128 0x20
+	.uleb128 0xf
+	.long	0xc6
+	.uleb128 0xb
+	.long	.LASF1278
+	.value	0x15d
+	.byte	0xa
+	.long	0xcb
+	.long	0x2e4
+	.uleb128 0x7
+	.string	"crc"
+	.value	0x15d
+	.byte	0x1f
+	.long	0xcb
+	.uleb128 0x7
+	.string	"a"
+	.value	0x15d
+	.byte	0x32
+	.long	0x22
+	.uleb128 0x9
+	.uleb128 0x5
+	.string	"ii"
+	.value	0x160
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1279
+	.value	0x159
+	.byte	0x9
+	.long	0x10c
+	.long	0x30d
+	.uleb128 0x7
+	.string	"num"
+	.value	0x159
+	.byte	0x1c
+	.long	0x9d
+	.uleb128 0x7
+	.string	"den"
+	.value	0x159
+	.byte	0x29
+	.long	0x9d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1280
+	.value	0x155
+	.byte	0x9
+	.long	0x9d
+	.long	0x334
+	.uleb128 0x7
+	.string	"q"
+	.value	0x155
+	.byte	0x1b
+	.long	0x10c
+	.uleb128 0x11
+	.long	.LASF1281
+	.value	0x155
+	.byte	0x26
+	.long	0x9d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1282
+	.value	0x151
+	.byte	0x9
+	.long	0x9d
+	.long	0x34f
+	.uleb128 0x7
+	.string	"q"
+	.value	0x151
+	.byte	0x1a
+	.long	0x10c
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1296
+	.byte	0x5
+	.value	0x14a
+	.byte	0x6
+	.long	0x399
+	.uleb128 0x11
+	.long	.LASF1283
+	.value	0x14a
+	.byte	0x1d
+	.long	0x399
+	.uleb128 0x11
+	.long	.LASF1284
+	.value	0x14a
+	.byte	0x32
+	.long	0x39e
+	.uleb128 0x11
+	.long	.LASF1285
+	.value	0x14a
+	.byte	0x49
+	.long	0x39e
+	.uleb128 0x11
+	.long	.LASF1286
+	.value	0x14a
+	.byte	0x55
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x5
+	.string	"i"
+	.value	0x14c
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.uleb128 0xf
+	.long	0xb5
+	.uleb128 0xb
+	.long	.LASF1287
+	.value	0x13b
+	.byte	0x7
+	.long	0xe3
+	.long	0x52a
+	.uleb128 0x7
+	.string	"v"
+	.value	0x13b
+	.byte	0x23
+	.long	0x52a
+	.uleb128 0x5
+	.string	"p"
+	.value	0x13d
+	.byte	0xb
+	.long	0x52f
+	.uleb128 0x1
+	.long	0x3d7
+	.uleb128 0x5
+	.string	"i"
+	.value	0x13e
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x3e9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x140
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x3fb
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x140
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x40d
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x140
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x41f
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x141
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x431
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x141
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x443
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x141
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x455
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x142
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x467
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x142
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x479
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x142
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x48b
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x143
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x49d
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x143
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x4af
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x143
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x4c1
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x144
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x4d3
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x144
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x4e5
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x144
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x4f7
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x145
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x509
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x145
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x51b
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x145
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x146
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xe3
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x53f
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1289
+	.value	0x12e
+	.byte	0x7
+	.long	0xe3
+	.long	0x65a
+	.uleb128 0x7
+	.string	"v"
+	.value	0x12e
+	.byte	0x23
+	.long	0x52a
+	.uleb128 0x5
+	.string	"p"
+	.value	0x130
+	.byte	0xb
+	.long	0x65a
+	.uleb128 0x1
+	.long	0x573
+	.uleb128 0x5
+	.string	"i"
+	.value	0x131
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x585
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x133
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x597
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x133
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x5a9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x133
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x5bb
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x134
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x5cd
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x134
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x5df
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x134
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x5f1
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x135
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x603
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x135
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x615
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x135
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x627
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x136
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x639
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x136
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x64b
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x136
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x137
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x66a
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1290
+	.value	0x123
+	.byte	0x7
+	.long	0xe3
+	.long	0x719
+	.uleb128 0x7
+	.string	"v"
+	.value	0x123
+	.byte	0x23
+	.long	0x52a
+	.uleb128 0x5
+	.string	"p"
+	.value	0x125
+	.byte	0xb
+	.long	0x719
+	.uleb128 0x1
+	.long	0x69e
+	.uleb128 0x5
+	.string	"i"
+	.value	0x126
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x6b0
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x128
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x6c2
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x128
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x6d4
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x128
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x6e6
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x129
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x6f8
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x129
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x70a
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x129
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x12a
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x729
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1291
+	.value	0x11a
+	.byte	0x7
+	.long	0xe3
+	.long	0x790
+	.uleb128 0x7
+	.string	"v"
+	.value	0x11a
+	.byte	0x23
+	.long	0x52a
+	.uleb128 0x5
+	.string	"p"
+	.value	0x11c
+	.byte	0xb
+	.long	0x196
+	.uleb128 0x1
+	.long	0x75d
+	.uleb128 0x5
+	.string	"i"
+	.value	0x11d
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x76f
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x11f
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0x781
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x11f
+	.byte	0x74
+	.long	0xe3
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x11f
+	.byte	0xc6
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1292
+	.value	0x10b
+	.byte	0x9
+	.long	0xa9
+	.long	0x917
+	.uleb128 0x7
+	.string	"v"
+	.value	0x10b
+	.byte	0x26
+	.long	0x399
+	.uleb128 0x5
+	.string	"p"
+	.value	0x10d
+	.byte	0xd
+	.long	0x917
+	.uleb128 0x1
+	.long	0x7c4
+	.uleb128 0x5
+	.string	"i"
+	.value	0x10e
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x7d6
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x110
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x7e8
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x110
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x7fa
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x110
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x80c
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x111
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x81e
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x111
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x830
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x111
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x842
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x112
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x854
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x112
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x866
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x112
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x878
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x113
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x88a
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x113
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x89c
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x113
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8ae
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x114
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8c0
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x114
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8d2
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x114
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8e4
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x115
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8f6
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x115
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x908
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x115
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x116
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa9
+	.long	0x927
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1293
+	.byte	0xfe
+	.byte	0x9
+	.long	0xa9
+	.long	0xa40
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xfe
+	.byte	0x26
+	.long	0x399
+	.uleb128 0x5
+	.string	"p"
+	.value	0x100
+	.byte	0xd
+	.long	0xa40
+	.uleb128 0x1
+	.long	0x959
+	.uleb128 0x5
+	.string	"i"
+	.value	0x101
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x96b
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x103
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x97d
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x103
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x98f
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x103
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9a1
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x104
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9b3
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x104
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9c5
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x104
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9d7
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x105
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9e9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x105
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9fb
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x105
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa0d
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x106
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa1f
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x106
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x106
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2
+	.long	.LASF1288
+	.value	0x107
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa9
+	.long	0xa50
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1294
+	.byte	0xf3
+	.byte	0x9
+	.long	0xa9
+	.long	0xaf4
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xf3
+	.byte	0x26
+	.long	0x399
+	.uleb128 0x10
+	.string	"p"
+	.byte	0xf5
+	.byte	0xd
+	.long	0xaf4
+	.uleb128 0x1
+	.long	0xa80
+	.uleb128 0x10
+	.string	"i"
+	.byte	0xf6
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa91
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xf8
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xaa2
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xf8
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xab3
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xf8
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xac4
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xf9
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xad5
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xf9
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xae6
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xf9
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xfa
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa9
+	.long	0xb04
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1295
+	.byte	0xea
+	.byte	0x9
+	.long	0xa9
+	.long	0xb64
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xea
+	.byte	0x26
+	.long	0x399
+	.uleb128 0x10
+	.string	"p"
+	.byte	0xec
+	.byte	0xd
+	.long	0xb64
+	.uleb128 0x1
+	.long	0xb34
+	.uleb128 0x10
+	.string	"i"
+	.byte	0xed
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xb45
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xef
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xb56
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xef
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x3
+	.long	.LASF1288
+	.byte	0xef
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xa9
+	.long	0xb74
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1297
+	.byte	0xd4
+	.long	0xba9
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xd4
+	.byte	0x20
+	.long	0xba9
+	.uleb128 0x8
+	.long	.LASF1298
+	.byte	0xd4
+	.byte	0x30
+	.long	0xbae
+	.uleb128 0x3
+	.long	.LASF1299
+	.byte	0xd6
+	.byte	0x16
+	.long	0x16c
+	.uleb128 0x3
+	.long	.LASF1300
+	.byte	0xd8
+	.byte	0xb
+	.long	0xbb3
+	.byte	0
+	.uleb128 0xf
+	.long	0x16c
+	.uleb128 0xf
+	.long	0x204
+	.uleb128 0xe
+	.long	0xe3
+	.long	0xbc9
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1301
+	.byte	0xb7
+	.long	0xc58
+	.uleb128 0x8
+	.long	.LASF1298
+	.byte	0xb7
+	.byte	0x27
+	.long	0xbae
+	.uleb128 0x8
+	.long	.LASF1300
+	.byte	0xb7
+	.byte	0x34
+	.long	0xc58
+	.uleb128 0x3
+	.long	.LASF1302
+	.byte	0xb9
+	.byte	0xb
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1303
+	.byte	0xb9
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1304
+	.byte	0xb9
+	.byte	0x17
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1305
+	.byte	0xb9
+	.byte	0x1d
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1306
+	.byte	0xb9
+	.byte	0x23
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1307
+	.byte	0xb9
+	.byte	0x29
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1308
+	.byte	0xba
+	.byte	0xb
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1309
+	.byte	0xba
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1310
+	.byte	0xba
+	.byte	0x1f
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1311
+	.byte	0xba
+	.byte	0x29
+	.long	0xe3
+	.byte	0
+	.uleb128 0xf
+	.long	0x196
+	.uleb128 0x14
+	.long	.LASF1312
+	.byte	0xab
+	.long	0xc89
+	.uleb128 0x4
+	.string	"src"
+	.byte	0xab
+	.byte	0x23
+	.long	0xba9
+	.uleb128 0x8
+	.long	.LASF1283
+	.byte	0xab
+	.byte	0x3a
+	.long	0xba9
+	.uleb128 0x3
+	.long	.LASF1276
+	.byte	0xad
+	.byte	0xb
+	.long	0xe3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1313
+	.byte	0xa4
+	.byte	0x5
+	.long	0x7c
+	.long	0xce0
+	.uleb128 0x4
+	.string	"x"
+	.byte	0xa4
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1314
+	.byte	0xa4
+	.byte	0x1b
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1315
+	.byte	0xa4
+	.byte	0x28
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1316
+	.byte	0xa4
+	.byte	0x33
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1317
+	.byte	0xa4
+	.byte	0x41
+	.long	0x7c
+	.uleb128 0x10
+	.string	"a"
+	.byte	0xa5
+	.byte	0xe
+	.long	0x8f
+	.uleb128 0x10
+	.string	"b"
+	.byte	0xa6
+	.byte	0xe
+	.long	0x8f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1318
+	.byte	0x9f
+	.byte	0x7
+	.long	0xe3
+	.long	0xcfb
+	.uleb128 0x8
+	.long	.LASF1319
+	.byte	0x9f
+	.byte	0x20
+	.long	0x9d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1320
+	.byte	0x9a
+	.byte	0x7
+	.long	0xe3
+	.long	0xd16
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x9a
+	.byte	0x25
+	.long	0xd16
+	.byte	0
+	.uleb128 0xf
+	.long	0x160
+	.uleb128 0xa
+	.long	.LASF1321
+	.byte	0x95
+	.byte	0x7
+	.long	0xe3
+	.long	0xd36
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x95
+	.byte	0x1c
+	.long	0xd16
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1322
+	.byte	0x87
+	.long	0xd55
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x87
+	.byte	0x17
+	.long	0xd16
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x87
+	.byte	0x22
+	.long	0xe3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1323
+	.byte	0x82
+	.long	0xd6b
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x82
+	.byte	0x18
+	.long	0xd16
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1324
+	.byte	0x76
+	.byte	0x9
+	.long	0xa9
+	.long	0xd91
+	.uleb128 0x8
+	.long	.LASF1325
+	.byte	0x76
+	.byte	0x1f
+	.long	0xa9
+	.uleb128 0x8
+	.long	.LASF1326
+	.byte	0x76
+	.byte	0x2e
+	.long	0xa9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1327
+	.byte	0x6f
+	.byte	0x7
+	.long	0xe3
+	.long	0xdcf
+	.uleb128 0x8
+	.long	.LASF1328
+	.byte	0x6f
+	.byte	0x14
+	.long	0xe3
+	.uleb128 0x4
+	.string	"exp"
+	.byte	0x6f
+	.byte	0x1e
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1329
+	.byte	0x70
+	.byte	0xb
+	.long	0xe3
+	.uleb128 0x9
+	.uleb128 0x3
+	.long	.LASF1286
+	.byte	0x71
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.string	"gcd"
+	.byte	0x5
+	.byte	0x66
+	.byte	0x5
+	.long	0x7c
+	.long	0xdf6
+	.uleb128 0x4
+	.string	"num"
+	.byte	0x66
+	.byte	0xd
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1330
+	.byte	0x66
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1331
+	.byte	0x5b
+	.byte	0x7
+	.long	0xe3
+	.long	0xe24
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x5b
+	.byte	0x19
+	.long	0xe3
+	.uleb128 0x10
+	.string	"xa"
+	.byte	0x5d
+	.byte	0xb
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1329
+	.byte	0x5e
+	.byte	0xb
+	.long	0xe3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1332
+	.byte	0x40
+	.byte	0x7
+	.long	0xe3
+	.long	0xe67
+	.uleb128 0x4
+	.string	"y"
+	.byte	0x40
+	.byte	0x1a
+	.long	0xe3
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x40
+	.byte	0x23
+	.long	0xe3
+	.uleb128 0x10
+	.string	"res"
+	.byte	0x4a
+	.byte	0xb
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1333
+	.byte	0x4a
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1334
+	.byte	0x4a
+	.byte	0x16
+	.long	0xe3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1335
+	.byte	0x37
+	.byte	0x7
+	.long	0xe3
+	.long	0xe80
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x37
+	.byte	0x18
+	.long	0xe3
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1336
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x7
+	.long	0xe3
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x2b
+	.byte	0x18
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1337
+	.byte	0x2d
+	.byte	0xd
+	.long	0xa9
+	.uleb128 0x10
+	.string	"x2"
+	.byte	0x33
+	.byte	0xb
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.file 23 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1082
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1109
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1238
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF966
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF968
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF970
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF972
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF974
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF976
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF978
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF980
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF984
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF986
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF988
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF990
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF996
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF998
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1000
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1004
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1008
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1014
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1028
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1103
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1138
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1132
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1160
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1206
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1222
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF1340
+	.long	.LASF1341
+	.long	.LASF1342
+	.long	.LASF1343
+	.long	.LASF1344
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x20
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1346
+	.byte	0x2
+	.long	.LASF1347
+	.byte	0x2
+	.long	.LASF1348
+	.byte	0x2
+	.long	.LASF1349
+	.byte	0x1
+	.long	.LASF1350
+	.byte	0x1
+	.long	.LASF1351
+	.byte	0x1
+	.long	.LASF1352
+	.byte	0x2
+	.long	.LASF1353
+	.byte	0x5
+	.long	.LASF1354
+	.byte	0x6
+	.long	.LASF1354
+	.byte	0x5
+	.long	.LASF1355
+	.byte	0x2
+	.long	.LASF1356
+	.byte	0x5
+	.long	.LASF1357
+	.byte	0x5
+	.long	.LASF1358
+	.byte	0x2
+	.long	.LASF1359
+	.byte	0x2
+	.long	.LASF1360
+	.byte	0x4
+	.long	.LASF1361
+	.byte	0x2
+	.long	.LASF1362
+	.byte	0x3
+	.long	.LASF1363
+	.byte	0x3
+	.long	.LASF1364
+	.byte	0x2
+	.long	.LASF1365
+	.byte	0x2
+	.long	.LASF1366
+	.byte	0x2
+	.long	.LASF1367
+	.byte	0x5
+	.long	.LASF1368
+	.byte	0x2
+	.long	.LASF1369
+	.byte	0x2
+	.long	.LASF1370
+	.byte	0x2
+	.long	.LASF1371
+	.byte	0x2
+	.long	.LASF1372
+	.byte	0x2
+	.long	.LASF1373
+	.byte	0x2
+	.long	.LASF1374
+	.byte	0x2
+	.long	.LASF1375
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF983:
+	.string	"__DECL_SIMD_exp"
+.LASF988:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1178:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF968:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1077:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1332:
+	.string	"atan2_approx"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF936:
+	.string	"__DECL_SIMD_asinh "
+.LASF1085:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1150:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1327:
+	.string	"powerf"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF999:
+	.string	"__DECL_SIMD_asin"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1234:
+	.string	"QMF_SORT(a,b) { if ((a)>(b)) QMF_SWAP((a),(b)); }"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF803:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1097:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1279:
+	.string	"qConstruct"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1123:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF901:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF822:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1024:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF994:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF486:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF788:
+	.string	"__DECL_SIMD_hypotl "
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF1253:
+	.string	"int32_t"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF856:
+	.string	"__DECL_SIMD_atan2 "
+.LASF748:
+	.string	"__DECL_SIMD_powl "
+.LASF954:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1221:
+	.string	"Q12 (1 << 12)"
+.LASF807:
+	.string	"__DECL_SIMD_exp10f "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF780:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1193:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1252:
+	.string	"int16_t"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1106:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1048:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF751:
+	.string	"__DECL_SIMD_powf64 "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF734:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1202:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF966:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF824:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF775:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF1186:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF473:
+	.string	"__P(args) args"
+.LASF996:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1192:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF732:
+	.string	"__DECL_SIMD_logf128 "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF905:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF899:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1196:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF963:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1070:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1084:
+	.string	"__HAVE_FLOAT32 1"
+.LASF957:
+	.string	"__DECL_SIMD_tanf "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1324:
+	.string	"applyDeadband"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1113:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1109:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1044:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1226:
+	.string	"sinPolyCoef9 0"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1037:
+	.string	"__DECL_SIMD_log10f"
+.LASF1232:
+	.string	"atanPolyCoef6 0.1471039133652469f"
+.LASF718:
+	.string	"__DECL_SIMD_sincosl "
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF886:
+	.string	"__DECL_SIMD_log1p "
+.LASF1030:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF972:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF981:
+	.string	"__DECL_SIMD_logf"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1323:
+	.string	"devClear"
+.LASF755:
+	.string	"__DECL_SIMD_powf128x "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF940:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1210:
+	.string	"VERY_FAST_MATH "
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1002:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1299:
+	.string	"v_tmp"
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF1329:
+	.string	"result"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1170:
+	.string	"FP_NAN 0"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF510:
+	.string	"__always_inline"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF823:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1073:
+	.string	"__DECL_SIMD_tanf"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF1233:
+	.string	"atanPolyCoef7 0.6444640676891548f"
+.LASF1091:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1250:
+	.string	"long int"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF979:
+	.string	"__DECL_SIMD_log"
+.LASF1208:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1111:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1158:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1153:
+	.string	"__MATHDECL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1182:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1297:
+	.string	"rotateV"
+.LASF926:
+	.string	"__DECL_SIMD_tanh "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF1218:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF897:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1001:
+	.string	"__DECL_SIMD_asinf"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF1135:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1127:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1130:
+	.string	"__MATH_PRECNAME"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF786:
+	.string	"__DECL_SIMD_hypot "
+.LASF1161:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1052:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF993:
+	.string	"__DECL_SIMD_acosf"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF820:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF842:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1133:
+	.string	"_Mdouble_ float"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1045:
+	.string	"__DECL_SIMD_log1pf"
+.LASF698:
+	.string	"__DECL_SIMD_cosl "
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1152:
+	.string	"__MATHDECL_ALIAS"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1080:
+	.string	"__f128(x) x ##f128"
+.LASF728:
+	.string	"__DECL_SIMD_logl "
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF875:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1138:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1243:
+	.string	"signed char"
+.LASF877:
+	.string	"__DECL_SIMD_log2f "
+.LASF1212:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1254:
+	.string	"uint8_t"
+.LASF1312:
+	.string	"normalizeV"
+.LASF1132:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1099:
+	.string	"__f64x(x) x ##f64x"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1260:
+	.string	"m_oldM"
+.LASF885:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1179:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF893:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF871:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1136:
+	.string	"_Mdouble_ long double"
+.LASF1239:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF736:
+	.string	"__DECL_SIMD_exp "
+.LASF1183:
+	.string	"math_errhandling 0"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF790:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1204:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1031:
+	.string	"__DECL_SIMD_atan2"
+.LASF808:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1007:
+	.string	"__DECL_SIMD_exp2"
+.LASF1313:
+	.string	"scaleRange"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF945:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1064:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1201:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1105:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1108:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF943:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF976:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF785:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF1301:
+	.string	"buildRotationMatrix"
+.LASF1320:
+	.string	"devStandardDeviation"
+.LASF1035:
+	.string	"__DECL_SIMD_log10"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1325:
+	.string	"value"
+.LASF1046:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF953:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF420:
+	.string	"__USE_GNU"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF829:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1296:
+	.string	"arraySubInt32"
+.LASF1251:
+	.string	"char"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1081:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1188:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1302:
+	.string	"cosx"
+.LASF1304:
+	.string	"cosy"
+.LASF1306:
+	.string	"cosz"
+.LASF761:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF1117:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF766:
+	.string	"__DECL_SIMD_atan "
+.LASF857:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1176:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1282:
+	.string	"qPercent"
+.LASF1141:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF939:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1262:
+	.string	"m_oldS"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1247:
+	.string	"__uint16_t"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF707:
+	.string	"__DECL_SIMD_sinf "
+.LASF1311:
+	.string	"sinzsinx"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1043:
+	.string	"__DECL_SIMD_log1p"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1041:
+	.string	"__DECL_SIMD_log2f"
+.LASF1171:
+	.string	"FP_INFINITE 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1012:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1314:
+	.string	"srcFrom"
+.LASF762:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1303:
+	.string	"sinx"
+.LASF1305:
+	.string	"siny"
+.LASF1307:
+	.string	"sinz"
+.LASF700:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1168:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF937:
+	.string	"__DECL_SIMD_asinhf "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF800:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF714:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF833:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1100:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF723:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF910:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF918:
+	.string	"__DECL_SIMD_erfl "
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1172:
+	.string	"FP_ZERO 2"
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF1128:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF984:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1198:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1235:
+	.string	"QMF_SWAP(a,b) { int32_t temp=(a);(a)=(b);(b)=temp; }"
+.LASF740:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1173:
+	.string	"FP_SUBNORMAL 3"
+.LASF783:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1274:
+	.string	"crc16_ccitt_update"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF970:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1054:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1281:
+	.string	"input"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1237:
+	.string	"QMF_SORTF(a,b) { if ((a)>(b)) QMF_SWAPF((a),(b)); }"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1205:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF911:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1139:
+	.string	"_Mdouble_ _Float32"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF882:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1159:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1020:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF948:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1214:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF836:
+	.string	"__DECL_SIMD_sinh "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1244:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF770:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF898:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1294:
+	.string	"quickMedianFilter5"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1222:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF699:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF760:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF883:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1125:
+	.string	"_Mdouble_ double"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1148:
+	.string	"_Mdouble_ _Float64x"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF947:
+	.string	"__DECL_SIMD_erfcf "
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1040:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF888:
+	.string	"__DECL_SIMD_log1pl "
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF884:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1034:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF759:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF741:
+	.string	"__DECL_SIMD_expf64 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF776:
+	.string	"__DECL_SIMD_asin "
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF1050:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1318:
+	.string	"degreesToRadians"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1025:
+	.string	"__DECL_SIMD_sinhf"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF1273:
+	.string	"crc8_dvb_s2"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF974:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1089:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF861:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF825:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF797:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1177:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF851:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1236:
+	.string	"QMF_COPY(p,v,n) { int32_t i; for (i=0; i<n; i++) p[i]=v[i]; }"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF878:
+	.string	"__DECL_SIMD_log2l "
+.LASF1211:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1053:
+	.string	"__DECL_SIMD_acoshf"
+.LASF933:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1280:
+	.string	"qMultiply"
+.LASF1225:
+	.string	"sinPolyCoef7 -1.849218155e-4f"
+.LASF971:
+	.string	"__DECL_SIMD_sin"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF813:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF793:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF705:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1315:
+	.string	"srcTo"
+.LASF1063:
+	.string	"__DECL_SIMD_asinh"
+.LASF1249:
+	.string	"__uint32_t"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF806:
+	.string	"__DECL_SIMD_exp10 "
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1149:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1088:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1308:
+	.string	"coszcosx"
+.LASF1147:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1162:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF702:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF750:
+	.string	"__DECL_SIMD_powf32 "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1096:
+	.string	"__f32(x) x ##f32"
+.LASF1047:
+	.string	"__DECL_SIMD_atanh"
+.LASF1223:
+	.string	"sinPolyCoef3 -1.666568107e-1f"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF725:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1266:
+	.string	"fp_vector"
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF739:
+	.string	"__DECL_SIMD_expf16 "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1119:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1051:
+	.string	"__DECL_SIMD_acosh"
+.LASF1167:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF754:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1181:
+	.string	"MATH_ERRNO 1"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1238:
+	.string	"QMF_SWAPF(a,b) { float temp=(a);(a)=(b);(b)=temp; }"
+.LASF949:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1013:
+	.string	"__DECL_SIMD_exp10f"
+.LASF849:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1131:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF998:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF973:
+	.string	"__DECL_SIMD_sinf"
+.LASF964:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF965:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1033:
+	.string	"__DECL_SIMD_atan2f"
+.LASF757:
+	.string	"__DECL_SIMD_acosf "
+.LASF1267:
+	.string	"fp_angles"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1115:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF727:
+	.string	"__DECL_SIMD_logf "
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF867:
+	.string	"__DECL_SIMD_log10f "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1199:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF868:
+	.string	"__DECL_SIMD_log10l "
+.LASF858:
+	.string	"__DECL_SIMD_atan2l "
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1151:
+	.string	"__MATHDECL_1"
+.LASF1061:
+	.string	"__DECL_SIMD_tanhf"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1062:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF746:
+	.string	"__DECL_SIMD_pow "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1101:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF708:
+	.string	"__DECL_SIMD_sinl "
+.LASF1310:
+	.string	"coszsinx"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF850:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1190:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF1272:
+	.string	"fp_angles_t"
+.LASF879:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1066:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1036:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF909:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1185:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1189:
+	.string	"M_PI 3.14159265358979323846"
+.LASF846:
+	.string	"__DECL_SIMD_cbrt "
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF811:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF696:
+	.string	"__DECL_SIMD_cos "
+.LASF1094:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF712:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1230:
+	.string	"atanPolyCoef4 0.3099814292351353f"
+.LASF1258:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1187:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1166:
+	.string	"__MATHCALL_NARROW"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1213:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF463:
+	.string	"__PMT"
+.LASF1160:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF753:
+	.string	"__DECL_SIMD_powf32x "
+.LASF906:
+	.string	"__DECL_SIMD_acosh "
+.LASF1259:
+	.string	"fix12_t"
+.LASF873:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF955:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1143:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1038:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1029:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1217:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF774:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1102:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1000:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1015:
+	.string	"__DECL_SIMD_cosh"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF743:
+	.string	"__DECL_SIMD_expf32x "
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1286:
+	.string	"count"
+.LASF1060:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF826:
+	.string	"__DECL_SIMD_expm1 "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF900:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF986:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF364:
+	.string	"__k8 1"
+.LASF1146:
+	.string	"_Mdouble_ _Float32x"
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF1220:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF827:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1076:
+	.string	"__HAVE_FLOAT128 1"
+.LASF870:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF809:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1241:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1004:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF941:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF931:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1284:
+	.string	"array1"
+.LASF1285:
+	.string	"array2"
+.LASF876:
+	.string	"__DECL_SIMD_log2 "
+.LASF847:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF417:
+	.string	"__USE_MISC"
+.LASF1124:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1207:
+	.string	"sq(x) ((x)*(x))"
+.LASF962:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1200:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF735:
+	.string	"__DECL_SIMD_logf128x "
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF961:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1227:
+	.string	"atanPolyCoef1 3.14551665884836e-07f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF1309:
+	.string	"sinzcosx"
+.LASF866:
+	.string	"__DECL_SIMD_log10 "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1206:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF742:
+	.string	"__DECL_SIMD_expf128 "
+.LASF881:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF989:
+	.string	"__DECL_SIMD_powf"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF990:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1006:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1319:
+	.string	"degrees"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF869:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF798:
+	.string	"__DECL_SIMD_exp2l "
+.LASF509:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF747:
+	.string	"__DECL_SIMD_powf "
+.LASF1331:
+	.string	"acos_approx"
+.LASF1095:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF997:
+	.string	"__DECL_SIMD_atanf"
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1270:
+	.string	"fp_angles_def"
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1291:
+	.string	"quickMedianFilter3f"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF749:
+	.string	"__DECL_SIMD_powf16 "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF744:
+	.string	"__DECL_SIMD_expf64x "
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF731:
+	.string	"__DECL_SIMD_logf64 "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1093:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1165:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF724:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF929:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF713:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1087:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1333:
+	.string	"absX"
+.LASF1334:
+	.string	"absY"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF891:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF908:
+	.string	"__DECL_SIMD_acoshl "
+.LASF912:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF832:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF795:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF925:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1026:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF738:
+	.string	"__DECL_SIMD_expl "
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF921:
+	.string	"__DECL_SIMD_erff64 "
+.LASF817:
+	.string	"__DECL_SIMD_coshf "
+.LASF1265:
+	.string	"stdev_s"
+.LASF1264:
+	.string	"stdev_t"
+.LASF1069:
+	.string	"__DECL_SIMD_erfcf"
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF831:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1068:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1277:
+	.string	"pend"
+.LASF1184:
+	.string	"M_E 2.7182818284590452354"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF782:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1240:
+	.string	"short unsigned int"
+.LASF801:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF890:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF726:
+	.string	"__DECL_SIMD_log "
+.LASF758:
+	.string	"__DECL_SIMD_acosl "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1316:
+	.string	"destFrom"
+.LASF1195:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1338:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF694:
+	.string	"_MATH_H 1"
+.LASF1039:
+	.string	"__DECL_SIMD_log2"
+.LASF1079:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1290:
+	.string	"quickMedianFilter5f"
+.LASF872:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF729:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1065:
+	.string	"__DECL_SIMD_asinhf"
+.LASF756:
+	.string	"__DECL_SIMD_acos "
+.LASF1229:
+	.string	"atanPolyCoef3 0.14744007058297684f"
+.LASF1019:
+	.string	"__DECL_SIMD_expm1"
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF959:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF784:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF913:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF889:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1071:
+	.string	"__DECL_SIMD_tan"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF927:
+	.string	"__DECL_SIMD_tanhf "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF389:
+	.string	"SITL 1"
+.LASF769:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF935:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1276:
+	.string	"length"
+.LASF1255:
+	.string	"uint16_t"
+.LASF721:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1016:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1169:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1137:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1180:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF874:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1011:
+	.string	"__DECL_SIMD_exp10"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1074:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF839:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1197:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF838:
+	.string	"__DECL_SIMD_sinhl "
+.LASF860:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1224:
+	.string	"sinPolyCoef5 8.312366210e-3f"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF1298:
+	.string	"delta"
+.LASF1090:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF715:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1086:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1155:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1010:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF919:
+	.string	"__DECL_SIMD_erff16 "
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1122:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF967:
+	.string	"__DECL_SIMD_cos"
+.LASF1203:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF1120:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF969:
+	.string	"__DECL_SIMD_cosf"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1278:
+	.string	"crc16_ccitt"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1067:
+	.string	"__DECL_SIMD_erfc"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF550:
+	.string	"__stub_stty "
+.LASF1057:
+	.string	"__DECL_SIMD_erff"
+.LASF796:
+	.string	"__DECL_SIMD_exp2 "
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF791:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF1289:
+	.string	"quickMedianFilter7f"
+.LASF924:
+	.string	"__DECL_SIMD_erff64x "
+.LASF810:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF704:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF978:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF695:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF717:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1245:
+	.string	"__int16_t"
+.LASF992:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF828:
+	.string	"__DECL_SIMD_expm1l "
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF737:
+	.string	"__DECL_SIMD_expf "
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF719:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1107:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF1283:
+	.string	"dest"
+.LASF799:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF1140:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1075:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF765:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1003:
+	.string	"__DECL_SIMD_hypot"
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f"
+.LASF848:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF830:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1209:
+	.string	"FAST_MATH "
+.LASF1322:
+	.string	"devPush"
+.LASF1059:
+	.string	"__DECL_SIMD_tanh"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF917:
+	.string	"__DECL_SIMD_erff "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1216:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF779:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1335:
+	.string	"cos_approx"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF942:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF544:
+	.string	"__stub_chflags "
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1056:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF706:
+	.string	"__DECL_SIMD_sin "
+.LASF1058:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1271:
+	.string	"angles"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1104:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF980:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1082:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1145:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1326:
+	.string	"deadband"
+.LASF1055:
+	.string	"__DECL_SIMD_erf"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1156:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1129:
+	.string	"_Mdouble_"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1078:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1287:
+	.string	"quickMedianFilter9f"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF697:
+	.string	"__DECL_SIMD_cosf "
+.LASF720:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1021:
+	.string	"__DECL_SIMD_expm1f"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF710:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF767:
+	.string	"__DECL_SIMD_atanf "
+.LASF896:
+	.string	"__DECL_SIMD_atanh "
+.LASF887:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1144:
+	.string	"_Mdouble_ _Float128"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1246:
+	.string	"short int"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF958:
+	.string	"__DECL_SIMD_tanl "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF815:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1337:
+	.string	"xint"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1219:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1300:
+	.string	"matrix"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF922:
+	.string	"__DECL_SIMD_erff128 "
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF818:
+	.string	"__DECL_SIMD_coshl "
+.LASF787:
+	.string	"__DECL_SIMD_hypotf "
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF975:
+	.string	"__DECL_SIMD_sincos"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1116:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1072:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF821:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1049:
+	.string	"__DECL_SIMD_atanhf"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF745:
+	.string	"__DECL_SIMD_expf128x "
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF946:
+	.string	"__DECL_SIMD_erfc "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1154:
+	.string	"__MATHCALL"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF916:
+	.string	"__DECL_SIMD_erf "
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF711:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1175:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1098:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF752:
+	.string	"__DECL_SIMD_powf128 "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1121:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF771:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1110:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF816:
+	.string	"__DECL_SIMD_cosh "
+.LASF859:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1336:
+	.string	"sin_approx"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1092:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF956:
+	.string	"__DECL_SIMD_tan "
+.LASF778:
+	.string	"__DECL_SIMD_asinl "
+.LASF907:
+	.string	"__DECL_SIMD_acoshf "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1163:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1023:
+	.string	"__DECL_SIMD_sinh"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF928:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1174:
+	.string	"FP_NORMAL 4"
+.LASF772:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1118:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF985:
+	.string	"__DECL_SIMD_expf"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF930:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1027:
+	.string	"__DECL_SIMD_cbrt"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF982:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF1317:
+	.string	"destTo"
+.LASF819:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1083:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1256:
+	.string	"uint32_t"
+.LASF773:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF843:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1157:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF716:
+	.string	"__DECL_SIMD_sincos "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF880:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1028:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF1042:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF960:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1114:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF709:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF920:
+	.string	"__DECL_SIMD_erff32 "
+.LASF903:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1295:
+	.string	"quickMedianFilter3"
+.LASF987:
+	.string	"__DECL_SIMD_pow"
+.LASF1261:
+	.string	"m_newM"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1293:
+	.string	"quickMedianFilter7"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1292:
+	.string	"quickMedianFilter9"
+.LASF382:
+	.string	"unix 1"
+.LASF1263:
+	.string	"m_newS"
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1257:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1142:
+	.string	"_Mdouble_ _Float64"
+.LASF1269:
+	.string	"pitch"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1268:
+	.string	"roll"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1328:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF977:
+	.string	"__DECL_SIMD_sincosf"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF951:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF777:
+	.string	"__DECL_SIMD_asinf "
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF768:
+	.string	"__DECL_SIMD_atanl "
+.LASF730:
+	.string	"__DECL_SIMD_logf32 "
+.LASF923:
+	.string	"__DECL_SIMD_erff32x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF863:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF703:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1126:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1215:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1014:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF995:
+	.string	"__DECL_SIMD_atan"
+.LASF1248:
+	.string	"__int32_t"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF837:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1032:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1103:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1330:
+	.string	"denom"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1231:
+	.string	"atanPolyCoef5 0.05030176425872175f"
+.LASF1194:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF763:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1288:
+	.string	"temp"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF789:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF841:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1164:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF733:
+	.string	"__DECL_SIMD_logf32x "
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF938:
+	.string	"__DECL_SIMD_asinhl "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1022:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1112:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1275:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF840:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1134:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1005:
+	.string	"__DECL_SIMD_hypotf"
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1339:
+	.string	"sqrtf"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF781:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1191:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF991:
+	.string	"__DECL_SIMD_acos"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF1017:
+	.string	"__DECL_SIMD_coshf"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1242:
+	.string	"long unsigned int"
+.LASF1228:
+	.string	"atanPolyCoef2 0.99997356613987f"
+.LASF1321:
+	.string	"devVariance"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF950:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF701:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1018:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1361:
+	.string	"long-double.h"
+.LASF1363:
+	.string	"stubs-64.h"
+.LASF1344:
+	.string	"/usr/include"
+.LASF1347:
+	.string	"stdint-intn.h"
+.LASF1355:
+	.string	"libc-header-start.h"
+.LASF1371:
+	.string	"floatn-common.h"
+.LASF1342:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1366:
+	.string	"wchar.h"
+.LASF1359:
+	.string	"timesize.h"
+.LASF1348:
+	.string	"stdint-uintn.h"
+.LASF1350:
+	.string	"maths.c"
+.LASF1343:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1345:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1349:
+	.string	"maths.h"
+.LASF1356:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/common/maths.c"
+.LASF1367:
+	.string	"math.h"
+.LASF1373:
+	.string	"fp-logb.h"
+.LASF1341:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1352:
+	.string	"mathcalls.h"
+.LASF1364:
+	.string	"typesizes.h"
+.LASF1362:
+	.string	"stubs.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1374:
+	.string	"fp-fast.h"
+.LASF1357:
+	.string	"features-time64.h"
+.LASF1365:
+	.string	"time64.h"
+.LASF1372:
+	.string	"flt-eval-method.h"
+.LASF1360:
+	.string	"cdefs.h"
+.LASF1375:
+	.string	"mathcalls-helper-functions.h"
+.LASF1369:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1368:
+	.string	"math-vector.h"
+.LASF1370:
+	.string	"floatn.h"
+.LASF1358:
+	.string	"wordsize.h"
+.LASF1351:
+	.string	"axis.h"
+.LASF1340:
+	.string	"src/main/common"
+.LASF1353:
+	.string	"stdc-predef.h"
+.LASF1354:
+	.string	"stdint.h"
+.LASF1346:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\354\005]\013"
+	.string	"$\021\340\006"
+	.string	"!"
+	.string	"\341\333\245\345\002"
+	.string	"\001\237\247\223\212\n"
+	.string	"\002\337\352\303g"
+	.string	"\003\203\270\227\357\001"
+	.string	"\004\264\245\347\210\r"
+	.string	"\005\346\353\250\236\002"
+	.string	"\006\246\240\335\225\r"
+	.string	"\007\347\231\311\265\t"
+	.string	"\b\340\206\333\235\t"
+	.string	"\t\352\222\314\276\016\002\002"
+	.string	"\002\001\n\223\242\326\261\005\026\002\013\326\331\347\361\r\004\f\350\355\231\037\r\231\274\327\315\004"
+	.string	"\016\202\362\202\320\006"
+	.string	"\017\244\330\372\372\n\f\002\002\002\003\020\360\232\325\316\b\030\002\004\002\002\005\021\257\324\327\335\f \006\003\006\002\006\022\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\023\242\333\255\257\0038\t\t\002\t\024\333\332\376\205\007d\n\n\002\n\025\234\341\340\262\001\220\001\013\013\002\013\026\005\002\005\027\f\002\f\030\r\r\002\r\031\016\016\002\016\032\244\246\246\251\f\006\002\017\007\002\007\033\275\305\343\240\f"
+	.string	"\034\354\261\352\343\013"
+	.string	"\035\364\207\213\233\001"
+	.string	"\036\334\206\377\260\007"
+	.string	"\037\260\240\374\337\017\002\002\020\002\020 \276\307\307\\"
+	.string	""
+	.string	"$ @\002of\250p\315R\342\352\020\016\260\020\244\033=0\002\254\031\375\037\240\314\002\032"
+	.string	"\026e4>\300\244\001\004\003X3\222x\252;\345\272\356\246L\227\265\370\211\t\273\235\213\031C\267\263q\315-\203U\273=x4>]t\004\353'G,\347\351,\262\333S"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"5\006"
+	.string	"\262\207\027\034\260\2511\f\303\034I\222$\201\310\326\214l\315H\332^!\251X\262\345\226;\245\224R\223\330\021\310\303u4x\306B\221@\230\007\323`\026\236fS\024\226\314\226\303o|\372\2776\"\265\370t~.\301\313\300\202N\031\245\305\257\365)\257Z\247e\200"
+	.ascii	"6MeP\267\270w\353\322\233\214\2254 \340\002\"c\035\310b\033\""
+	.ascii	"\330\315l\033\263\265X\332\200\341\300\"\203\031\342qe01\306"
+	.ascii	"p\001'd\310O`\227\f#\202u4\366n\203uD\261#\211\255\231\253\307"
+	.ascii	"\340\026P8\020\215bo\b,\020E\333\207\342\213FhWH\024`{th\341"
+	.ascii	"\023\034\033\210\260 \013\303\214\234\rd\\\245\001..\356\020"
+	.text
+	.section	.gnu.lto_.inline.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`x\n\305#"
+	.string	"vt\250G\320VM:\210\202`\005\2019\374\366\264\373pW"
+	.string	"\256\020\217\237\212\b\274\220\016\376\305\016d\342\330J/\t\327\220\261\n3\2336\331\025x\005\317\022(&a\244"
+	.string	"7\343\305T\366\200C\315\312\241\2206o%v\357$S\221"
+	.string	"\224"
+	.string	"\217"
+	.ascii	"\240%nwQJCm\244;@H9\262\366;\354\356 p\3524\322:C\215\f\tMaq"
+	.ascii	"tMM-m/N\307f\264\235\272\032T\233\316/\247y9\207\325m\242\215"
+	.ascii	"S\233.\365\n\276\243,\326\030\022ZB\371\362e\031\376\326\363"
+	.ascii	"\223t\317\357uO\3203\214,\232\334\300I\203\226\033vW\307\356"
+	.ascii	"\324\366\352\232A\206\256^A!t\253[\260\311\032\373\222[\317\317"
+	.ascii	"\311z\037\347\273\273\235\235s\035\025\266\245\004\267c\316E"
+	.ascii	"\250\260-\305\330\007\314B!\2370\233\364\274\340)\273\t\"$\236"
+	.ascii	"\351\371\275<\303O\320\2377\377\021%i\205\376\363?\273b\324\215"
+	.ascii	"\031\274@\255:\215\352\306\005\252:\006w\216\2633\371\021\005"
+	.ascii	"\211\214Q+vx\305\211'\327\324\\Sk\221\2364\354\362V\331\241L"
+	.ascii	"\033v\251\264\233P\272\025\315\333V]UmJ\267\242\025\257D\022"
+	.ascii	"\2675'\236\270\345x\322\271\223\323\362\306\262\263\244g1\005"
+	.ascii	"\021\222\007\225MSZ\33600\355!vu\024\030\374\214\023W\324\bA"
+	.ascii	"\352\024T:\322\356\203\b\tD\250\235/vw\345O)\327\262\037\355"
+	.ascii	".\214\377\215E\240\335\005`\307\016\344\271\\ \25054\236\034"
+	.ascii	"sb\213\236\037\"\366\341\257\345\331\201vw<\177\23775\036\331"
+	.ascii	"\3259\331\341ND\331\005FG\034\273;,\003\320\360z\300\3003\354"
+	.ascii	"\277:\332\322d\235\275\266\273'\273H\030\307\330\267\245\247"
+	.ascii	"\310\t\\\213=\031\313\330\247\364P\022\3430i\371\371\362\363"
+	.ascii	"\345\r\216)\324\227\005G\024CB9\224Y\354K_\206\367P\342V\213"
+	.ascii	"\236\nEW\327\237\376t\266m/f\300\3257\202\216|<\203\236\332\233"
+	.ascii	"\020\223\204\330\b\322\022p\rp\375\255\023b\022!6\202\250l\300"
+	.ascii	"6-\266\b:\362\371\244m\231\030Z,\n:\362iq\001\331q\021\210\200"
+	.ascii	"\247o\261t\200\223\335\017\254\253\322\356\007\027\013\b\020"
+	.ascii	"ebLdI8\217\\\216\212*\221p\243\\\216\212\245\314\300$\331]\265"
+	.ascii	"9\331]\003i\275\334E\225\021<\021\016\243\312\b\236\006/+\333"
+	.ascii	":v\267\001\355Cv\267\345\251\324_x\r\257\021\347Y\364\331]\007"
+	.ascii	"s"
+	.string	"f&%\347\007\272t;\227\265\354\263\267\001\200\334\250\361@\245\024\032\032\221\321\322\224:\200\002\231\221\242\352\001\022\300C9\207\342\220B\312\220\314\004$\222\202$\205R\373\006Hg\207\334\215\272\210\302O\260@'\025c2\214\340\320$\307%#\027)\nE$\bh\344\226y\021\006\355\220\314\213'\036\354\347W\036\031\300lE\205\256\027\256\266f\263\034\2668A\340\301Sj\205C^\247#F\264b\227\242\235c&R<T\001\001Ua_dO\335\303\242r\256\251\276&\274\357x\332+\b\022\322\336\305}\277\350\025\376\007\315\272V\330\323a\240\004\210\350\350\001\254N\247\nrq\204i\265\017\335Mn\257\201\274\3368jn\001\352\243\252-S>\022fa\341\325{La\25576\343~\273\r\224\305.\341\3034\220a\3223\b\245\3279h\231\034J\373\333caY\270y\260\241\266\230\023\025K\223E\216o\334"
+	.string	"\313\241`\023r\300n\023\236t\314\274\3420\355?D?\177:\241U$F\t\tY\216\035\210Bu\341{\356a\007f\305\223_H\031\247d\231\276\376?\302\342\035?c\277\370B\363\322\034\3732\231\256\361;\324\017B\260.%Ak\234\013\\sS\003\232p\213\254\202A\006\016\257\343/\215\035\"\354\313\373\363\005<\037|j\334w\240\241mf\345\200\323]\335\035\260\332F9\353\366\356\324\025\335[\022#\244\004F\212\005 J\254\327\261\24682\371\377A\020\364\373\376\210uHd\222\322\016P\301C\330N\033"
+	.ascii	"\340G\372b5R0i_\361\237\024\203q\224\235\254$\264S\256\311\265"
+	.ascii	"\233\332wXn\305\322t5\376\006x\304\036\244{\343\252B\344\250"
+	.ascii	"\360\323\334j\211\366F?\360\323\376\362j\240\302\210\326x\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\365\007"
+	.string	"2\314&)\200\251\351+\tH\323v\226\223\021\031g\217u\032\300\004\255\203\230\001\310\007\360\337MD\270\261\355\242\377h\337\332\266&wJ2\330\370\221\302\343C\rmWB\343;\b\317\177\007\317g|\003&r\212\317\374Vm\233\320\3434f^\301\302\334+!\255\204\270\370\340\366\231\351.?i\335\016?\t\226\277\214\n\253z\f<\201\200\032W\2334\277"
+	.string	"m\364\211oR\330\244\232\f\307\234\357\220\243\371-\221\242\023\022\027\026\023\242#\246\t\202\301a=\355\305_|\245u\233\277Z\\\300V\004- \220\002*+\333h\243\357E\030\3322&\246\300\b\016\223\246\343{0\247y\245q\031L2mC\367\001R`\344\2756\"\026,\330\245\301\\\231+"
+	.ascii	"\366D\ts\007\203 \244;\264-h8Q\016\362\\\254\230\277lc,a+\353"
+	.ascii	"\247\031\331\002X\326\3370\307\006\001\245tQ\356P\fV\270!"
+	.text
+	.section	.gnu.lto_.pureconst.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375 h\325\002"
+	.string	"\202\206\025 pk\322\001\374\337\373\036\252\375\377\256\252\252\252\016x\256\377\377\377\377\377\377off\326\322\232\335\001\223r'S2#\0232\037\237\3436.\343.\256\342&.\342\036\256\341+|\204o0\0053p\001\267\372\250o\232\322\214&4\237\371\313y5\223\371b\0253\263\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\\\001e\006"
+	.ascii	"\302H\033\"\2209\303\001\377\217\335\260\177\324\235\252\356"
+	.ascii	"\356\364I\257\372\202%\374`\217\210\226\232`\260\250\004v\223"
+	.ascii	"2\005\377\317_\334r\313\224D\235me\2041\245Z\t\304\301\320\024"
+	.ascii	" \366\374\343\024\362\036\324\357w\203i\363\245\"\0063\037_\224"
+	.ascii	"\254\004\211\203\377-G\001'\272yk\317{\3232\r\334\032\2479w\312"
+	.ascii	"\025\245R\021 \335\345\244C\327\021- \340\202\031\252z>\032\210"
+	.ascii	"\n\362\272Q\337\262\364E\263T, |\276\031C\313\351\213Ns$\006"
+	.ascii	"\013_\232$\256\006\301.\346\362\310\r\355a\346\224vY\350\346"
+	.ascii	"\276(\355\3335H\034\250\257\245<\316\030\204(\002)\334\305%\334"
+	.ascii	"RM\023\357\230G\314[\b\222\020\023L7KZ\341\334"
+	.text
+	.section	.gnu.lto_.lto.d7bcd7278ca05642,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.2.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`1\0015\016"
+	.string	"&[aE\360\222(\035B\253\033\2378\371G\362u\332>b\f\321*\203$\271\346\367\266\325\2075\334\317\323'R\213>\350\r\r\265\375?\310\251\264\r3\026'\256c\345\272(\214\2453\356\275\323KR\261@\373{o)S\nL"
+	.string	"O"
+	.string	"L"
+	.string	"\237C\333>\315Wp6\355\001\006\220\006\032//~\354\3566z(\036\276\017\210\207*\202\343\224\373\323\344|\221W\353\357#s}\007`5d\002\274\\/\204\003D\217w\317\230WK\246\207dw\2350/\0167\274m\007\266K\354\303\002\357\261[5\235\232~\b"
+	.string	"\031\241\035\273\033j@\366\006\214a\342\263\333w\301\3715\357\f\022u\350f\027\336\332\224\250\260A\3629\024} \331\257\221\231\366\326\346'P\360\310\331]\322\241\033\2102\220\236o\361\230i\016\331\235\221\002\306\356\"\260\201\036}\332:\203\021:9*\373JL\215\320\341\264\244\216G_\211\327\324\273\300\\Y\323\324\361\022$\304\"\352g\037\261\344\216\241F\275\017\027\034\226\254\371\335!\320\344\330\334\261e\255\324\0207$nJXg\354\247=\237\335\361\261\037>\035+T\n\353)`\245QFNFN$$XP\022\300\272M%\225\t+\223\323\206J\235N)\323\206J19m&\225\312V\"\340\024\005\024\325\266J\245T\033h\2573\036}w\222\2074\315v\026x~\232\352z/\241\252\306\3301\241\332\025,\304\303\004\030"
+	.ascii	"re1C\023N\341\240\323VP[\013\263W\2456\306\260'\303\354\031\313"
+	.ascii	"\206M{@Y\333P\215\270\320\251\020l\327\231\002{\213\312\374("
+	.ascii	"\342'\225\301\250\266\005PxZ\332\243\201\251="
+	.text
+	.section	.gnu.lto_cos_approx.3.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\033\002\005\022"
+	.string	"FbwH\320\362&\035\"\031Q\0077\242\37080`\337P\326\335\365\203\347\203\277\021%9\356\356\201\034\001\005@\312\257\215|y\001\276\203aU\244A\361\216\354\n\237+h`)\352D\023L\316\3769>u\035\224 \226\354\275eJ\001`"
+	.string	"d"
+	.string	"]"
+	.string	"\036q2\271~\350B\2569d\027F\212\026\273\233\300\007\270O\333>\320\203@\273\266\202\241\343a\3129\352\261\273\237w\221\355S\236\300\366\031I\034\274\214\n\372\037zI\254\246\343\272\271\354y\224\b|d\364"
+	.string	"p\261\244\210\022\210\033\247]w\\-UT\312\356Zu\\\033\356y\333\016l\253\330\032\006\017\t0\242@lW\303\023\220M\232/L|\366\333\367\217.\363g\247\2713\b\256\376\362c#A\335'\314k\t\330\035\036&\222\f\260\325\312\177\232b4}\372G+\237\350F\356>I8\030\025]\220+SQ1#\205\373$\351`b\237hu\026\256\311\225\375\347\204\215\246\3355\371t\003\356\363\376\013\264;\007\022\212\220Z\352\303\336k\266\031\267x\031g\324\245\234 \"+d\374\354^(\343q\340 \205\372\344\323\376"
+	.string	"\210F\354\021P\324x<\354^X\373,\307)i\255\255\335\260D\343\343\227p|X\372\344\356\303\352\017\373\305\322(\302\276\334\030\302\276\232\273\032%\325\233T\317\317ny\241_\257\0164106r\201\215\372\005\305\005\305e\202\002\006'\003l\356\226\223\031\n4,\251/F\225J\251Z\276\030\030\226\324\327\"3\363\235\030\260\252\302\213\314G\243R\311|]x\031Q\361\264C(\221C]\263\255%\\\334\261\315E/\214,\373\263\303\376\241s:v$\205\022\245\217\276l\306\302v\035T\224\361F]\360P\362\020_\257\331\266\030) p\242\t\230\335rY\3646\001\274z\310>\3242\377a\226\264\201\004<\026K\272\202P\231\b\214\346mC\332j\321\2230I\030b^g\035.\\\013\347E(\n"
+	.ascii	"\020\250\334\306&\334\020\257>\206G\270\234m\343&\021cn\321\277"
+	.ascii	"\245\337]\353\026\034?>\037GQ\006pb\365\372)\305\203\002"
+	.text
+	.section	.gnu.lto_atan2_approx.4.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\214\005-\036"
+	.string	"\006t\266J\240\326Q:\216\223\221\340\206\353\031J!\250=j\004\263\254\320\2373?j\257\244\021\303:\355U\313\002:qK{NA\263\\\217\320\345\260\200/\3405\370$\3144\253\314\347\351\035\006\312\246\355\177\325\323z\320o\377'\204\310\235R\242"
+	.string	"\216"
+	.string	"\244"
+	.ascii	"M.\276x\200p?NAIj\255//\335\240\007\203i\006\203\327\313^\322"
+	.ascii	"\313\351\227\\4\254V\035.\242j\255\006\\\340\365\322\266\377"
+	.ascii	"\3420v\354\"\311t\204\342>8\370\f\263j\255>\227\337\314\227\344"
+	.ascii	"m\346\313=\361\235\307`/\227Y\222K"
+	.string	"w|W\f\311\"(H\207 \317cA\207\005\t\020\002\221\240/\001D F\334E\022\2602Q\344W@#H\236P\217\020>\324\024\361\362\224\0057P2\026\f\361\235\005\201\244K\255\365P\247?\301\036J]1\265V\323\016A\020\267\354\266\205\266!\330\345/Lz^\334\366M,{\243\304\026\266\375\323]~T\313+k\333\033\317\254\037=\332\\A\211JW\225j\331L<t\215\354\223\265\326\352-\262[x;]\016\367\246\373\366\245\237\345O\267\355L\377JM\205v\342=;u\312\251QN-;u\354\324\260S\277N\355:\265y\352\362\324\344\251\367\324\364\324\007`NY\351\212\265~8:\251U\245\r\025o\372\237~\342\327\336\361\235><\224e\275!\261\304\203\250\027\373\311E\227\243(\007<^\354)\273\300\210lQV\301\226T\320Ple\353\033\236BE[@b\013c<\205GH\206T\341"
+	.string	"\276\026\266\247r\355k\003P\235\302\3431H\232\353\332\036V\271\346\366\206\247P\304\026QuBn\271\273\341)4\333]ru\306S\270.^h*\253\352\311nIu\"\271\370\032\300\032C\325\r\216\307,`\255\277\001\263\245K\0329\205\207z\214(5\333\230\037\231\333\334R\3439u\333\022\353\\\322C\217f@T\251\326i\255\225g\327\310E\333t"
+	.string	"ng\234\210"
+	.string	"i\023Sb\f\334\236x\227\237mq{\032g:69\033A\202\316\214\f\231\341\266IP\223\240f\302\001\00405\r7\r\214\016\005\f27>\01387784>\013\025dn|49:>\030\236q.\330\344\3700\340\340\344\370dL\365d\335\242%X\313\232|\251l\255\266\n\206~\333\263\243\026kiQ\362\313\001\203:\fI)\205\213\267&M\332\252\260\344Py\361h$o\351\017\226\323xu),\253!\327\032\371B\224\204\312\335\326(y uK\333\237\025#\315\334\351d\3700\251\332\355\032O\244\334y\343\252\\#gHzB\177\224tds;\333\037\3333N=n\350R\026\266\272)\nD\331}\250AT\305\230a\246F$\005i\n\313\030\340\002\021\251\352\034\021"
+	.ascii	"=\bY\3154\311\032!0\311\222:%\234c\321\fs\274\320\020\242\335"
+	.ascii	"\214\270\223V\023\366\330]\215\214}\226yhFCo,Z0\311\221d1\352"
+	.ascii	"]\310\035\364\035\236\214\"2\336\033\240\256\363\275\205\232"
+	.ascii	"\256N\366\275\230\310\026\254\315\351\\L@:\326\364\306\247\216"
+	.ascii	"<\214s\n\f+\212k5\234a`\251\340\004\342\200\264\271W\006/k!j"
+	.ascii	"y;\275Tr\333\234\320\002O`\272\274\321\016\201\262\3541\207E"
+	.ascii	"\313\211\023\311@\034||t\246\017\030H\226\261\304_\001\325\200"
+	.ascii	"\312?\001's\247!e\271\253\031\203c-H\325\244 \205P\2047\f\253"
+	.ascii	"\034\003O\260\210\222\205\306b\265\3612\033pV\205\217\261\177"
+	.ascii	"cu\220\212\362\tF\372l\276D\f\337\275!B\r"
+	.text
+	.section	.gnu.lto_acos_approx.5.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`A\002\325\022"
+	.string	"&$~H\340\322&\035(\023.\024\006\264\372\354\344\346\270\362\002\207E|\305A(J\200\246\225\206\201g3yj\003d\251[\377z\221c\301\276m\246\203$a\206y\314\365\r!\374\271Q>V\250\203fw>\214\254m#dK\231Ri"
+	.string	"`"
+	.string	"m"
+	.string	"G>?\346\234&\357\f\201\304\203\311\365>\30695g\016\236\032s\316\006f\200zg\333\3579\f\230\215\223\243\016\213\037\365\310"
+	.string	")\3159A\326\rx\357\344\013x\357v\305a\227\2530?vy\033\n\241\231\032\315W.0R\341\003@-\224\"6C4\277]i\265\231\352)e\316i\235\251\221\270\273\333\246`{\202\255:\001\376\355\252 \246\035S\231\3541\246\233c_\316\305\261\257\016\371x\257\376s\177\367\371UW\247\256F]}\272\332\273\272\273Z^\275W\353\325\017p*a4\302cN\021\271\246Y\324\335p\361\361\377\271\3320_\306o\376HB\374\030\307\n\005L\332,\206M\002\352\035I\215\211=\032\207\212\2158 \006\250\325]\355\211f\210=N\213Z\217H\264\361\366\264' \035'R\314\246n\275E\020D\264}+\267\333\004H\342N\r\355C\321R\270+w\004\207hc\334M\274"
+	.ascii	"\021!\227K\302\371vW\001\rqG\352\327\346\320\301\373\214.+\334"
+	.ascii	"\230\2775\356\326pNY\311W\221D\333Ls\326\240 \337\376\347,\231"
+	.ascii	"2Y\265\337\236HT\222i.*1\n\223a\303K\313\313s\013\n\013\n\213"
+	.ascii	"\005\007\017N\006\304\334+'/\027`TZ\240\213\253\325r\255\200"
+	.ascii	".\030TZ\340\312\353\005<\021\261KC\313\013\204q\271^\3407\316"
+	.ascii	"\313\2718\376\rO\013]\355o'\260!\233Z\232\355\324:E\2663\271"
+	.ascii	"Z\231\244\"\031\206l\007\264\022\252\335\006\020\243\233\335"
+	.ascii	"\034\343lk\211j+\334\206B]\262\006\345V\3731) \220\202\221\200"
+	.ascii	"\3156\262e\231\243=u\245\315{\256\320\323X\315\032l8~\263H\347"
+	.ascii	"\361 \332\342\341\302[\326\303<\266\f\257\002^\336(\025b\257"
+	.ascii	"\346\224\205tD\300\231\233V\321_\337\226\257\273\232\027@\352"
+	.ascii	"\030\311h\317\206L\311\310N\031\333\033o\312'J\241t_\001\346"
+	.ascii	"8\255\221\347bP"
+	.text
+	.section	.gnu.lto_gcd.6.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"m\f"
+	.string	"\006\227SB\020q\224\016\360fX\211\243d\007\016\326r"
+	.string	"\240:d\230]5 \005#\230\203\210\203b\366\275:\324\210.s!S\t\354\245\275\277"
+	.string	""
+	.string	"\212T\274KSCl+Pa\236\233\213\334\252%do)S\n="
+	.string	"B"
+	.string	"<"
+	.string	"\006\252G\370K\365\250 |kn\217Ps\363\357\035\216\020\201\001b\302\341\261\343\020rP'\323"
+	.string	"n\004\255QH\311\275'\211\373H\275<\255\316\356:A\270\rwu\333\021l?\260\017!\372\356\316\247oY%Z H\355\206\244j,\213h\na{\263-6FFW\342\240\362\210Y\221y\276\344\024\003\330\355 \222bw3VPy\374\311Mlv\n\354H\270{@\321\200b\306\356^\t\036\352a\001\237\b\350\275@|\245\251\244{\257\234NPb\252aFU%-x\252\204\0231>\022\345\374L\\l\322\260\273\216\303\335]\325\021?9$\250\223\365\203\375\356\257^\372\343Kw\230\226\205@\321\241\rh\003\232\300\240\201\206"
+	.string	"v!S\1774\033\0248<\330\225i\030\246}\256\254\202\007\273>\242\215Ks\300\232\205\220\350\342\3204\321e\351\366NU\275\376E\006\223G\246\002|$\364S1\342\242\216\250;\030\002\030"
+	.string	"\204\311\242ck\320\302\310\254\322\272\306\031\312C\266\341\021\017\270\220\213\204\320k\242%\366\342\301]j5\234\232\305 2\340\304P\370"
+	.ascii	"*\231\237\262\017G\311\252\233j\252F\273J\036"
+	.text
+	.section	.gnu.lto_powerf.7.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\377\001\335\021"
+	.string	"\366\340tG\340\262(\035B\216\022\254\337\001\025\036m\266\213"
+	.string	"\371m]o\255\244I{h\024]\2019\202\317\265d50\374\267S\277\325\003Q#J\177\221$\314\031\302p\241X./\007\177\005\315\321_\f\036\233E\022\273\267\334)\005_"
+	.string	"`"
+	.string	"]"
+	.ascii	"_q\026*\333&a45\357\341\3410\353\261\273\337\350\004@\237\362"
+	.ascii	"\003@\237\032\302\\\030\206?.a\267\214\252O\251Q\345\313.m\\"
+	.ascii	"<-\255\325\247\344V^F\004h\255\310\221\037\237\234\323\036]Z"
+	.ascii	"*Q\226\210\271\236\366\004.[K+\346\221#\331]\307\226\226\207"
+	.ascii	"\033t\333\031lO\260cH\216\217\335\007\351n\037`\034\bw_B\037"
+	.ascii	"kc\346\220\370\354\217=\332\027\271\360\374\027>\315!Qlf\235"
+	.ascii	"n\005\323\325d9$t\237\267U\276\314!\021\n\317\216\331\326\255"
+	.ascii	"`\n\260\364\340\360\331]\005\237\216 \022\341E\230u^8$\335\247"
+	.ascii	"H\306{<\216m\006\331\245Q\023cw\027\030A\367\031\032\025B\215"
+	.ascii	"\r\361'|\255*\t+\336.wwe7\ny\324N\317\342J\361"
+	.string	"\342F,\345\024\304\203\305\204J\f\375\026\257\2157\325\332\316JK\035\362\317\376\340\264\313\023\257\235\241\372\330EdX\361\346X\223qc\343\315\206\255\242\316\330\037\241\371\361\261\202\260;n\036\366\313\343\374\372\331\003\251\223\024\2204S\030RP\245\023\bECI]\0221\0211\251\300\240\201'\240\204*\241 M\362P\026R%\246\357\0044\231@\322wr\241\304\364\221N\250\3173`\020\245t\372R x\372B\260\275\224\3279\325\201\fKU|\331\001\324v\246\3168\244B;U\035\321\345\264\207ln\\\312\351e\357v\334t\210.\266-\003, `\002\231\262\365\rY\300[s-<ZZ2A\251]J\032\341\332P\007oz\330\271\263\360o\327\205i\254\236\366\265\\\006aI\241\264C8\004\2148A8`\320\330`gh\227\2314\315U6\023\304n\237\026\322 \017\022\"\220-\276\3715\nxd\034"
+	.ascii	"\311\310\226}&\337Ta\261\032\357M\244s\231'"
+	.text
+	.section	.gnu.lto_applyDeadband.8.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"=\f"
+	.string	"\266VRA q\223\016\300\301\306\b\300\272\0030\220!\020\303HG\277\001>\201\251\021\030L\024L\242\376\255E\033\254\374\233\235H\2718D\215\003\f\344\003\0300H\025\346\027@\002\312\0375\351\206\244\221\275\245L)>"
+	.string	"@"
+	.string	"<"
+	.ascii	"S\211"
+	.string	"\032\034NRv7j>`:|\0270\035\252\211k\177\232\232o\341\274\024\":\321\006\372\243@\\\001l\"O\263\273/=I\266\221L\013gw\235\242\355\303\ro\333\201\355\007\366\033\004\357\243_?\2723\323\267\\<\314(\320\355v\350n\254\f\370\002\205}\026!6\306&\240\241\304\305`@\035fT\242\363\244\2174s\354\222 \271\330]\0046@\035\332\366U|E\210\265\307\235\330\002!\025\361K\277\240t\311\t\345\312{0\237\252\332\0270L\027A\205\nJU\023?\275z\264\2001\222*V\275\276\223\r)\241\354\234(6hl\256\330\034(\325\304\376[-\261\341\271?\226\247\362\260\252\313\242|uX\035\026\204\004\n6\001\256\n\023*\013\320\235\315G\004\220\n\213\236\f\303\262N\364H\250\260\330\371|\304M\306\031\205\353\023A\262\354\0231\334\376\255\226@\315@\n\221\007\236Jb;u\301\210\030"
+	.ascii	"\226\311\002\243=&\262\006\211\226Al\302\360\204\300\0350\246"
+	.ascii	"\250f\201\210\251b\f\027\236k8\321\004\241L<\tG\202p 30\304P"
+	.ascii	"\303\213\237\343\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_devClear.9.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\215\b"
+	.string	"\306P=60\261\032\003\200\210\034\016XD\303\n\3330\326\355AU\001I<A\222]C\322\356\\G\346r\357\260\230{)\210\004\r4\367\021\215\301\347\324\021\026\203\225\222H\231R*"
+	.string	"-"
+	.string	","
+	.string	"\005\034\313zm\214?\331M{i\320f\376\317\030b\317\320\253}\342\200\027\254e\b\360\360\277\360\005\343p\243\333\036\264uh\273\0223\033n\004<^\020j\377\306\255\3466\3312\322\326\236\026T\013\031\266.\261\211\347\031\313\237?F\302\362\177\241&t,\373\331\200c\331q\031Upk\341\224\272t\3767\324(\027\030\0032\021\313\232\305\261$\220\311\270\340\255P\245\003\346\220\246\375Z0\202\264\336\374\177c\254u=\215L#S\304\002\203\350Sq2\305\226D*\211\025\211\233\250\216\343\272\322DM\220\270YJ\251\246\b\324\216\342\224\232\253\256KM\317wo\036c\205\370\260\271b\t"
+	.ascii	"\204\231e\246=\245\254\005\226O\031\213\3432\364\267\032\r\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_devPush.10.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\013\003\225\023"
+	.string	"f\"xG\320\322(\035(\211q1\261\f;A\254\260\001x\367%\353ZjQb\366\267\003\216\037\334\021k\356\335X\375#=\300\316\364\264M\277\341\013\340K\0372W\007\031"
+	.string	"$\244$\002\221\035\204\305\351k\177\333\223F6\2212\245`"
+	.string	"Z"
+	.string	"h"
+	.string	"\255\247}\023\377\201\335Fs\221]\035\037\241\335\260e\223\357\321\341G\274\307\357"
+	.ascii	"\274G\303\354\035\017y\3667\034\013\267\037\273\013j\207\303"
+	.ascii	"\036;M\230\377\240\237f\264\232\307\234w(Z\316\2653P\253\221"
+	.ascii	"aE\273\351F\2208\350x\320\363\002-\226iR\331]\347\214\206\341"
+	.ascii	"\366n\233\201m\025[]\001=6\233\\r\342D\334\330\fb\2075\251;\366"
+	.ascii	"\273U\035\373@?\353\266\177\225\351T\246Q\231>e\372\313\264)"
+	.ascii	"\323^\246c\246\273L\253\246S\323\027\200\202\201d\242b\027gI"
+	.ascii	"\310\036\305\027>\266\237\262IX\2642<\n\330\201\234\363i7\006"
+	.ascii	"Nhw[V\360=\016\350H\302\312\322N\343M\006b\3109\325\222\036\333"
+	.ascii	"O\016\371@\332\320\351N\316v\022\260_w\261\n\220\343G\211\bo"
+	.ascii	"\261J%\226\3322\3079WR I\203\nG\342\037f\265#\325\235\223\247"
+	.ascii	"\262\004%\335$\020'nD\352\n\025\317g=N~M\275\222\254\026\313"
+	.ascii	"%\333\022\236\302E\337\356&\360o,\024>\017\217>\215\367xU\005"
+	.ascii	"\025\356\227\024\227\024\227\006\007\020\240\210LxqQ\267\240"
+	.ascii	"\3108\230Yq\2010/\227\353\325\002\302<Xq\201-12 \n\211_\020^"
+	.ascii	"b\300\231\327+\006L\205\373nU\307\013\214\216l4\026SJ\203H\306"
+	.ascii	"PJm\327\215P\372i\352\244\235\242B\230\224\245'5\341(\372N\230"
+	.ascii	"\210<U5igCV\213\332\251\247\227\315\210iTo\210\214\207\006A\250"
+	.ascii	"\221L%\005E\250\206\224\224\323\244\003\240\002\221\251:\017"
+	.ascii	"\021\20055T\023\230SP\343\034\004\372\323\001\233\270\371Z\026"
+	.ascii	"O\244\371\356\364\332K\026\020\374\222\235\220e \264\232\275"
+	.ascii	"n\030\030\240\3328\353\315p\210\213<\255_\221Y\210\022\\\212"
+	.ascii	"\357\321]\027\f\261\333Qd I\226\375A\322{u6)\242#\244\372\026"
+	.ascii	"\244\322\212[D\202\2004$\263\031\345z\342X\220\207\266\320\220"
+	.ascii	"6\335\261 \353\334<\215\n\276\354?\257o\276\037\034\326@\240"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_devVariance.11.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\005\001\365\f"
+	.string	"\026\331XC"
+	.string	"\221(\035p\f\033\021\223\260\017#\276\223\374W\306\020\207Ru \n\247,\2404\013\001\207\342J\r!t\2601U\254\004\r\347/\353\377\377w\213\350,\034C\200\213\023\345\373\372\360\272\035\261do)S\nH"
+	.string	"A"
+	.string	"G"
+	.ascii	"VA\217C\312[t\260@\202\306\356f\235\023\260\036\341\005X\217"
+	.ascii	"\272\341\334\241&"
+	.string	"\347_\006\312w\352D\0163\235\311\025rP)L\002t$\360\300J\303\213\263<K\272R&\346\301\356:O\035\206;\3366\004\333\016\354\203\004\326\364u\357\307h:j\032fZ5\235\231>\200\314\313*\301\214\335\013\337\215e\021O|\260/\202\26356\007\305\363<\213\277\362\020\334\275\220ovS*&v=\217\021\\\217\366.\333>\210\253p\016.\246\027L\255\030&T)?\333\244\227\260*\325\300\323\303\t\265R=\261\202_\025F\313\n\222\254a\233\302G\330\345\332\335\006~\213G\205+\345\321\017\261\036\257\003\\\254\214\344gM\206M\033\266'\222zb\037\256\246\034\026}B\237P\204\005\f\260\r\210(\244\006a$\t\037\034Z\326\261i\332\006\312:&ph\031hD\3120\2167\017\321(\373\330\266Q\246\361\366\232r\246U\266\263@\324\022\333Q;#Z\202\020j\352\245\030\025&\024\252Pc\025"
+	.ascii	"\204\3112y\266Uj\276\242\341OV\214\013\327{\214q4\206@\013\b"
+	.ascii	"\350\016\301\026\016\356Q\370\353\236\2325\\\030\203jl\363+\323"
+	.ascii	"\240\211HJ`\314;5Z\005\005"
+	.text
+	.section	.gnu.lto_devStandardDeviation.12.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\250\001\265\020"
+	.string	"\026\341rG\360\320&\035\262\216|\366\315\3504`\2161\317\213\2233\360\020\2564\265\301lq\323\0072z{\316\211\317Z;\327\324\021\211\254\246\337\204\353\035Nd\223\320\313|\261\037*\325\363\241ab3\332W\216l\223F\366\2262\245_"
+	.string	"\\"
+	.string	"b"
+	.string	"\377\230\323\245\205\2139C\224\021p\227\0169\333\376\211\243\210\331:1\f\001s \231\f8:\346\234\336\351\003\266\313\370"
+	.string	"\333\345\202x\354q5\346\237\3461f\204\r\220v\362X\242\261|\243\251E\006\013"
+	.ascii	"\032J<\360\363!\350\265\253\nm\246:\022\231sZAZ\207[\336\266"
+	.ascii	"\003\333\rl%\020Q\315E\365h\325[T\313\250\216\253\336\207\277"
+	.ascii	"\226JC? =s\256\024\361\230>\362\205\t\337"
+	.string	"\3465\2733\3545>\316\326\360\304\3149\273\313\033\221\231\206\007@2Bs\206 \227&\021\250\353o`\017M6\016\244\025\f$\204.}\033\230\335=fw\266\tD]\355\317<E\354\241I\243\031)0\266\035\255\334I\021J}w\333-GJ\313L\213(\234\205u\344\032\320\022`\313\317\356\213\023|wq\330\360\240\350\220_\363\353+\274\303\3159\031\370*.T\360aLV\300\215\031\231\026\371\265\227rzh\034\347]N\214\032\272\277\371I\246D\356<L%\262\303\231\356\213\3758\327\305\216jRf\205\254BV\020\024,H}X`\255\326\252\324+B\311H\313#\371Z\255O\345\221H\030iy*\327\313K\231\374M`\271\274\222\357sy\235m\207\262\257\213u\271}\355]\320N\017\265\216m-@Z\025\333qO\262\235\271\244\244\265[\337v0\356\teO~\232\177\003\270\303G\026G+\227\333\034"
+	.string	"\002\223aI8\220\207\002\034>_-4\352\271\\T\373a\325@\364\030\321"
+	.ascii	"\033\204\013\217\277Z\\5+\252K\3543CpM\254\231\025;\240\201\365"
+	.ascii	"\b\202\023\212\201\363Q\r\375d\354A\273\221\224@\232\227j\264"
+	.ascii	"\n\n"
+	.text
+	.section	.gnu.lto_degreesToRadians.13.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"M\t"
+	.string	"\006\022B:@\345h8\240\276\266\263u_\363\356\026r\246b\024=\030\245\303s\007\020\216\321H\224X\243\355v\005[\360\260mF\257\242\212\355\3705,c\346\265.\327\376a\244\355-eJ\0010"
+	.string	"1"
+	.string	"."
+	.string	"\342\210\353\261W\206\n\200\335\345:7\330\\\313^\260\271\246\"\017\237\241\377\224g/.\330\212uzr v\327\271bu\334z\333\n\266#l\313\004\3276\217\030\206\225]\216Q\300\302h.$\266C{\263\017f>\231\366Q\376\n/^X\333m\261\264\354n\203\027\004\256\r\244m\337\344'\241\r\313\002\337\030\240\321Z?\214c\r\306.*\341\252zUI*G\247^3\246\242A\345\350\355c3\200-\236RC\354g\253 \266\246\365\342\237\232\016\356@#\320H\342\343\340!(u\0358\321\2158\026yJ\024\246\220\307\221>\317\373D\034\251\"\344q\"\260\304y\020\374Yt g\372>\220\333\304\275\255\332Ai\312\206\005\013"
+	.ascii	"@3\241L\2130l\026\002\350\253\253]\023)\262 .\230 \340\304\223"
+	.ascii	"j\305$L2"
+	.text
+	.section	.gnu.lto_scaleRange.14.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`8\002\255\021"
+	.string	"\306\241tE"
+	.string	"\321f8\223\321\367\026\375\035\035\301x^\007\235\024Bd\324V\264\007\025\301\214\033Of,\346\276@\310d\334\327V^\223\237A\331\020\325\272\313\260=\332<\037\323\020\201\022\364\277\t\273-\272\221\275\367\336R\246\024b"
+	.string	"^"
+	.string	"Z"
+	.string	"=\226i\337\276\204\250`bb\247\306\002\033\235\237\004\037F\234\003\3367\324\314\310\3639\226Y\264\013\302\246\305\356\022\260"
+	.ascii	"\357\233m\037\347(Z\266L\033kdN\003\203\341\301\261\273`\352"
+	.ascii	"\"\3347\355'\356\233\216x\353\331\362\037\273\366c3\213\221a"
+	.ascii	"yv\bv\327\031#\203\341\326\333\016`\333\201\2355\001\377x\317"
+	.ascii	"\357\241i\222\246G\232\026e\332\313t\227i.\323[\246\265Lk\246"
+	.ascii	"3\323\027y\206\031)4\f\240\261ka"
+	.string	"\246ccl.H\374\365\303\236v\313\367y\314$T\ff mg\276}\341\211\3354x1\242\342+Z\177\031\350\353\272 \202\341aqcwG\276\231\301\350\375\304\241t\002\235\246\214\303\247\207=\325\2229\314\251\352\247\027r\225\330TSNQA!\272)J\bD5\355\206\364\252\252\331p\335\270\344\314\037\232\252\ry\3505a\300\354h\311\231\323g\203\214\315\034\366\310\222Jc_\333\335\265\212\260\237>\375u\233\256\363\227\016\273\277\217\177\310s~\220\357<'\177\360\320\204[a\245\240x\241\211Jdm\253PT\240\022Y\235SJPJP \0240@R\242p\253HX\021VNV\240J\270Z\205*PE\302\311\nT\211,\220\004\200\303\t)\"\270\022\206\"H\032\367\366IS-\352b\222\236F*R\222\336\325a\244\367T\244\031d\322O=\375\220\353\204\213\007\223\376\265i\247\246\233\222\006/ "
+	.ascii	"#\242\222\007|\210\244\202\223\237E\332vG\b$\24459(\031\343\217"
+	.ascii	"\3229\3361-G\215\261\327BA\302\373c\227\345\215\202Q\246\345"
+	.ascii	"\3600\204\3573qj@2y\220\327\206\341\246\353!\323\022\313\n)\t"
+	.ascii	"\270\271s\003kd\276\303\006infG\206kX\263\030\0337\200\2451\265"
+	.ascii	"\225\f"
+	.text
+	.section	.gnu.lto_normalizeV.15.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\204\002%\022"
+	.string	"\306\342vG\340\262(\035L\007Q\030\266f\003\365ZO\376\026\367\367\3442\230W\214\316[\377\320\206\365\277\303?=\002\325s\214\221Y\261<\336ai\264\201\031\246\016\211\227\240\033\"\\\t\364gq\230\004\275\002FK\b\331D\312\224\002`"
+	.string	"X"
+	.string	"b"
+	.ascii	"\221\264\221\374\204@\020\274G\022\237\322\323>\213\267h]\346"
+	.ascii	"\362\221]\231Z\315nXr\002\357\321\341\tp\217\336\005p\217n\331"
+	.ascii	"=\036\236\330\323r<\320\200\354.\250&\336\372\246\331\362\273"
+	.ascii	"\023\021,\346\3726\342*\022\213\331H\273{\332\363C\f&\263;\331"
+	.ascii	"]',&\342\216\267-\301\366\004;}\002\016]\251%\354o\273\273V\031"
+	.ascii	"\373\341\037\340\263{t\331/\222\351/\323!\231\026e\332\313t\227"
+	.ascii	"i.\3231\323[\2465\323\231\351\017\370pp\224|vA\f\005\331\235"
+	.ascii	"h\223\342\263\337\376i\376H\204J\266}\027\237i}f\032\317\025"
+	.ascii	"\242\300\253G\307\307\356*xt\004\357\001@\316\032\215\221~v\322"
+	.ascii	"K\006Y\224\236\332\251\r\334a#%\305\250\313\235F\365\364?8\345"
+	.ascii	"\264\323Nhu\031\234>\33045\352\326\363\"\241\252\272i\344\301"
+	.ascii	"\3411T\027\\\257\251\252\363R\001\223C\266;\034\206i\274\335"
+	.ascii	"u\340\277Hi\361P<\372.\334\343\325\200\016\331K\016\371\223e"
+	.ascii	"m\005\317f\220\003+\254\013,\247\f\034kuR\331|2Q1Q\261\300\240"
+	.ascii	"A\311\210I\265R\233JV+,\024\024\310\222B\241R&\220\005\003\n"
+	.ascii	"\n4\251V`\311\001\2474\234T +\225R\201_\270\337VeL!g\347Ea\266"
+	.ascii	"Omp\372\335\bQ\033\325\220\033\236\325\232\n-\"9r\006\354g\244"
+	.ascii	"W\221\352\315\013\007@\255F\356\256Kil'\002OSfv\304d, \300\002"
+	.ascii	"\031\251\261\003\004\221e\2647[s\327-4\356\n\340\215\020\255"
+	.ascii	"\f\315\365M\200~H\321bh\256\2739\270\220\302U\320&YI`\210\223"
+	.ascii	"\035U%\024\200\334\"\020\333%G\224p\250s\354\001\226\203\030"
+	.ascii	"\363t \217\317\227\030\0335\027M<Xh\032\205\200\312\330\260\r"
+	.ascii	"\001\"\017\004\335\247Q\n\324\330.Z\006"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.16.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`3\021\335>"
+	.ascii	"*"
+	.string	"k\324\026?P\344J\007\257\356U-gpde\342T\343\271\340\223\0074\356^\023N\226P\302\256\275_\374<M\223\003T\001\251A\027c\027\224\216R\013\275\224\0250\373\212\306\030\260\344\223\275\345&)\245\024i\0018\001^\001\002d\3349s\003\330u\230\221\335\206\233\316\357-J\271\367\"\321\214\227\257\233p!\204:\\Z\357@\026=\207\3774\364]!\341\024\235\n\310\202\031)\347\214\373M\307ad\243\002n\304\201\323\302x\3712P\201S\210CmT\300\217%s\2779k7{\356j\250\215\332\366\322_:L\213\351\277&\323f\032M\253i6\214\\\022\\C\367\006(\215\021\266\347\031&\335l+c\005\355\306\2300.~\370\r*d\201\244\217.E\0240J\272\262\360\361\237\362x\357\032,cB\250\2152\365-{KsA\353.\374\247\246\301\005\300A\204P\341\2757\252Q\366\2406\25246"
+	.string	"\273\024g\351\316\235e\357\005\237\r\334z\314\307F\331\202\332\350\222\231e;sWi+h}\005F#\335;\344o\314\275zS\214@m\224\365Z\3116\2526"
+	.ascii	"\333(\2431\017"
+	.string	"\266\236\335m.\204j\\\020\357\275\313/\322h\235,\"B\016\035\325\324\242\306w4\356f\323\307\266\270\264N\326uQ\017\266:'\342\321H:o\362\360\241\271>v \334\016\3059W\t\004\221\323\321\251\232\240&\340\004N\207[\034\215\306 t\272\321F\2771A\335\033\033\3118\246Qi\216\020>\255\247\335-\256\351\236f\335{\331\333\342\344\232\215\232\231\027\231\231\007\363\321\214\266\321\376\244\221+\253?\031\211\210\004\344a\f\003\257'2\3531\375\2110\267\361\376\020f\353|\301:[H\235\263R\347\n-\330L\301:O\260\316\022\254s\204\324\031B\352\374\240\007\233\261\254\363\225uv\220:7H\235\031\364a\363\002\353le\235\253\254\263\202\324y\231:Sub\363\224u\226\262\316Q\251s\202\324\031\2013\233\017Xg\003\275\327-\240\2734C5_\363S\203iv\352\276\346&_kfJ\235\227R\347"
+	.string	"\326Y\311:'\365\225n"
+	.ascii	"\326\031\311:\037Yg#\353\234\264\316E\326\231\310:#\255\363\220"
+	.ascii	"u>Zg\325:\247\326\331Zg\324:\033\255\363[g\267\316\215!Yf\316"
+	.ascii	"\322\313\2754\236\212\027\020-\303\244\005\273\007\273\017\273"
+	.ascii	"\023\333\231\355k\335]\272\371\272\301t\367\365\020s\253\261"
+	.ascii	"\2579\233;_\313\026_\331\231\336\364\313\236\366\\|-[\bq'\266"
+	.ascii	"\342\240\337{\006\342>lA\206\334\200\242\3760\263\360\363{O)"
+	.ascii	"\201}\270\007\233\220\317\357-\"\336\221\323y\270\005[\017#\031"
+	.ascii	"\355\215"
+	.string	"\233\273({\316\332\0167\036\250*\210w\224\315\243\353\366\026Qs\252\313uU\002\004\237\340\300#8\360\316l\345z\300\233\236f\340\375\376\033x.\376w!\021N7\367~qU\337e\022\021\237C\376\334\204\024|+\036\323\2509\353r}\265\244\372\345\324SM}'\266r\235Rl\255\274A\275\205\207\370\274\372>sX\250h\330\375G\265z\356@\016\276\005\245h\324\234\321\345ZB\003\006\337`\3013X\360}\330\312u\201 @V\337\206\255\\\337\332\337\352\217\037\377.\344r\0347\334\303\024\222\360\235fpO\277\271%\332~\356>\021\276\t;\253\211\032\337\302\267\236\216\232s\376+p\341\335\034\256!8\215~\360\020\260\376\001\326\367`+W,\302\326\312\343\323[x{\372\301\2175\361\302\367\032\301n6\315\001\021p\365\304\356:\255\3721\004\\\215I\237\360\334y\274L\330n\263\360\306Os2\201\346"
+	.ascii	"y\275^a\263~\204\2268M'\304\312^a+|\3267\205\257\360nGmQ\311"
+	.ascii	"\n\205o\301V\256\024\276\3738\343\254zZ+\017Oo\341M\370\276\363"
+	.ascii	"\327_\324\016\001/{\363\336\265@\377\204o;\316:\246?\271\353"
+	.ascii	"\264\226a \235\336\222C\247\277\003[\271\362\227\317\340\277"
+	.ascii	"\244\0353\n\227\001\246\336{\0354\312\356\006Bl\200]\222F\271"
+	.ascii	"a\004f]\026\366ef\2642s3\263\2633\243\221L\254\213L\254K5\013"
+	.ascii	"\373\"s\021\366E\246\232}\215\225q\201\331./\025dJ\023c\\*{]"
+	.ascii	"\221\270\"Q\242\252\001\025\022WY\n/\022(wQ\221\235("
+	.string	"\343\002[\206\211\201\201\211u-\303\276\270\300\226]cdK*'\026S\3415\266,\023\023\033[\"\3276\026}@2H\344r\235\324\301\f\340\372LFz\262\344\302_=\322?\231\243&K\236\336\350\217\352\234\336\350Q8X\222L\2260\025=\324'\377\0139\357\232\276\350Q8V\210\222\024A>\221\204G\346\r\0359~\323\017\335A\375q\212jW\204\250_X\247O_\375\357\343\254\253\372\247O\037\025\343t\302\304\033\342D\232\321\330F\225\214\350\200b\247<H\322\243o\377\3218\2350\321w;\316?\353\023\3433\263\224\377\340?#\273{/\026\273\217\f[Ey^\330F\035M\333\237\253\227z\343\277\230&P\337]\222\036\252\307\3237_+W\251\177\242s\372\006\223\364N;\002\233\276\373Z\271J}\323w \247\023\246_\216\244o?_\363\030o5\222\377\354jJ\357lE\310\250\271!\227k\251"
+	.ascii	"K\037\200\351\227\230\336\327Z\2712\261\265V\236;{\013\317c\370"
+	.ascii	"\325\220\372\036\343\314B\035\340\374v?\211\f<\373\032\365\336"
+	.ascii	"D\036\003\201`\250aL\345\034\232\032\021\221\222\202$Ikq\006"
+	.ascii	"2Re\265\r\022@\243i\030H\23542\023\024\244\240\234\222:\231\003"
+	.ascii	" y\333\336p\274N\207\373\257\321\300\211\207\262\214L\210(\201"
+	.ascii	"\372\245\272S\245\205\2253\024\377B{)\314\374\216\2338V\335\264"
+	.ascii	"\006H\001\234\365\312\027\253\354c\216\027{\260h!!h\234[\242"
+	.ascii	"\224\023n\242\245p\246\237\316\026\205:B\204\262\f\034\t\224"
+	.ascii	"1\247J\037\343T\371K\b\330t&\260\371\277@ \220\2565Ry\230\220"
+	.ascii	"v\251w>\373\203\243\232\261\024\203\027\225\001\362>\004\270"
+	.ascii	"M\\G\026\311\246\247\242\331\332\356GnNx\334\226x\"O\266A)\274"
+	.ascii	"\256`(\346\217\244\221\031\354;\202\360@)\177\211\223\251\320"
+	.ascii	"\332\236}\272\237\006/\215\361\233\216K\226g Lw\323\241\036@"
+	.ascii	"i`\377-\240\314\324W(7\027\254\263$\307@\331n{$8\206ct\2674\253"
+	.ascii	"\021\363\266\3439\203\317\f|R\201u\21643\320`o?\023:\216\207"
+	.ascii	">4\027\347\020\2761'\247\034\311\f\024\006:\360@\262\374\322"
+	.ascii	"\355);\027\321N\327\226|<\342\3474\210('\251\254\b\006\211R\203"
+	.ascii	"\343\261\020\315T\236\327\314$\3166\003`\222_t\317\373\2228\260"
+	.ascii	"d\375\315\001$\213\333\377\251\256\001\244?\032SZ%u\203\362\311"
+	.ascii	"\"\361\355\367\002>\250\034b\f\352\353/\n\307\033\0067~\027\371"
+	.ascii	"\377Y\353\242Sk\320%Zu#\204\351\354\026K[\324\022\017\271\371"
+	.ascii	"\235>&\2242\3665\307\251\305z.YRd\375p\034\034\037\212\250\367"
+	.ascii	"\234.\210\277\355\241`va\013\327\306\n\347\262_\370\264\353\305"
+	.ascii	"Ke`\311\377U\317(Mdwl6\2300N\363\210W\233Hj#\342\330\250:T\034"
+	.ascii	"\223q\224\372\243\257Dy\035\251\276@;-\201e\320\362\024+]G\225"
+	.ascii	"w\031\3451\214#cp\371-V\031x\277\220\023\346V\201\364\353\324"
+	.ascii	"\240B"
+	.ascii	"\360\n\275\025\263\214S\252\352-\225\254\215\005\001\241M\231"
+	.ascii	"\202x\324"
+	.text
+	.section	.gnu.lto_rotateV.17.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`}\005\215\034"
+	.string	"\346\262\257H\240\230Q:$\005\212\f\274\342w\224\n\326I7IdV\206\374\030\027\310\210:\323\227\243\036\340\263h\214'\340\312u\242\357G)/\225>x\2157X\003j\234\376\220\223\367trp\325\006^\f\374j\243\373K\276\224)\005\231"
+	.string	"\212"
+	.string	"\240"
+	.string	"\301R\347\013\363$\320\253\304\253lt\321\311O\375e\377\304Wyv\223a\344T\300\03791\203N\025\250zl\225eI!\213v\253\241;\221\027\001~*\305\f:M\330\022d\253,\235t'-a\236\324\033C7\027:\035\252\320z0O\372\254\321]\355\013\371\020\340\245V\334V\226OG\230\224\345\020\201\r\314\223\036\276\007vr~\007v\322@\033\314\207P\345\251\242\\\020\317\224e\271\333\035\007^\201\376\253.\023\306\b^c\021\312\262\264\nc\310\270\367\266s\266=\330\344\226Z\304\262R*\227=\f\352\352\260\377*\367\311\376\361'p\253\177\300\213\377\320\217w\356V\267\320\213w\320\207\177\200K\375"
+	.string	"\246\0327\325\267\251\366\231\352\236\251\346\231\352\235\251\326\231j\333T\347L5\316T\327\246\372f\252iS=\233j\233\251\226M\365\234\352\330T\303\246\232\234\352\327T\357T\353T\277@mM\225\006a\312\022FW\2322\213\274\362\321\344\310\201\004\023+\fs)\211}%_\002|\321F\003\321\030\336\210r*\003\261,\271\205mlqe\260\330\370\343\257\234\310\273\021Jo'\260\223\260\375\361\265\272\344\276\260Z\330h\332}-\371\245\212\215\016\240\020\234\310+\322\332u\300\343ju5K\213\037M\332e*6\376h\331>p\"O"
+	.string	"TY\226\fN~\177\270\\\241\241\351\221\234\2304$\f\2606\210\236^h \026\033t\215\214\026\305\344\366G)6&"
+	.string	"\222\023\332[E\261q\226CheA\373\342o/\260\262\230\224\313Pl$gL\tR\226e\221\377\204\302\211\037\250\250\223\376\n\330\311\240\275\361\220b\322.\007\0322`\030\212\215\350\3756\230 Q$)\375\214z0\243_\b\036\022i\336\002\244\005H\035\022( \262\231\270\217\210\226>\374\214z;\021\276^\317w\264\023\221d\324\333\035)-\355\210"
+	.ascii	"\3307\202\247\264\373\371|J\273\331\260\374\253\334'[\350\312"
+	.ascii	"b\332&\247x\225%\016\b\237\372\267\210\374hu}\361\252\\\306\255"
+	.ascii	"\231\333\366,\316go\213+C\306\207gu\266ggy\226\3742f\307\266"
+	.ascii	":[659\013\006go6\247\2668\213+\343\245F[\233\275\231-m\311/]"
+	.ascii	"f\262\265\321\222q\315\325b\343\334;\021\216\211-\271s\003d\250"
+	.ascii	"QL\305\020TAI0A\222\246Di\f\320\002\031!\262\016\021 \265c\310"
+	.ascii	"\306\026\224SjY\003@\231\034\215 \225\305?\t\017\212\364\027"
+	.ascii	"\365\3651[=\203\371\374\022|\241;bJ\024\252\222\265M\206#\246"
+	.ascii	"\n\310\355^\332\300\324ck\214!W\275z\035art\255>B\371Kw\360W"
+	.ascii	"\233*&\363\251\274\204}\270\310\306s\263x\025X\005\375%(n`\250"
+	.ascii	"\233\315\344\204E\231\337\245y\001\354\031KdE\020C\265\346\031"
+	.ascii	"\250\365\311\306D\001\234f\323\332\257(\263\262bX\335\036\177"
+	.ascii	"\234Z\357\365\310\037\213\020\207\303\375v\360D{w\326y\236\323"
+	.ascii	"0\344?K\206oN\227\313\370\210\200\b\277p\370\324oP\262\211,\200"
+	.ascii	"\360+\240\234\026H\246\002"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.18.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`I\005e\036"
+	.string	"v\364\265I\260XQ:\300a)@\001w\325\261=\250\250C\271\352C)\370\260\200\200\007\340J\215\231$N\233h\216uj\373\365u\nY;A\333\261\261\363\2610\006\206*?\245\005\027\302t\305\302\240"
+	.string	"\212IG>!\204\354-e\222\001\240"
+	.string	"\233"
+	.string	"\234"
+	.string	"\030\224\246\200\251\265\272NW\202\025"
+	.ascii	"e\013\027\363\356\207\334)\350\272\024'Pk\222\224\222Zu9\253"
+	.ascii	"@<]\235x \017\022\264\262\251\303a\003\225\242\024\355\314\324"
+	.ascii	"Z_\255\333\200\247\363\006\300\323V\332\376\324}'\313N\262F1"
+	.ascii	"\004\351l\226\355\303\235\371c\b\257f\233\235\224q\226\214\030"
+	.ascii	"<\"\300\261\270]\374\035\335\020\3608B\342\020\306\301\331*\232"
+	.ascii	"\255\035\021\3239\240\326ZcS1\031\260\221M\210\347\016\027\357"
+	.ascii	"C}6\021\362\245fsq\016wj\255\3135\033\213/\200\357\356ow-\354"
+	.ascii	"\3222\263^\327\317;\t\0334\266Z\016\270C\235\354\001\341^\323"
+	.ascii	"\257\262\325\256n\306\235\333\375k'\355\342\\\367\337,\257\315"
+	.ascii	"y_\222\362\262(\357HyE\312\033R^\220\362R\312;\231\267'/O\336"
+	.ascii	"\037\020\340\273\"\201\252\326\025Wh\252\025\352\323q\336\377"
+	.ascii	"\364\322Io\311\362\211\322\214]\222%\313\250\326\320\200:t\303"
+	.ascii	"\214\222\262\307\221%\313\246(&ET\024\304\3232\347\332\033\331"
+	.ascii	"C-Y2\271\316\223\211\263#\221\247\205\312\004\361t\356\006\355"
+	.ascii	"wK\2263\\D^$\350O(\304\331Q\274K-!\2017\260\037\204S\264\037"
+	.ascii	"\365\337l\320\216|\236\371\352j\255`\347\026l\332\"\212T\031"
+	.ascii	"\342\252\034\260\313%\037\215\257\026|'\023\273\206\213\257{"
+	.ascii	"N\277\272;\235\232\264s;25N\2075v\235l\243\n]\206\270j\255\310"
+	.ascii	"\336\241\261\325g\255\265N\234>\357-\332e \3318}\242\032B/f\357"
+	.ascii	".\210\357d\t\266\324Z#\320\251\232\230\275\357\204L\314\261O"
+	.ascii	"\3217\212\301}\323\335'\3521\277R\3007\367\211x\b\361\325\222"
+	.ascii	"\375\246Y\212\322\320\370jO\003W\331\252\273\326\032>\260\036"
+	.ascii	"\240\031\342>\337\036\b\036 x\370\320\300\201\016\001\023_\036"
+	.ascii	"\235\022 \200:\300^#b0X\214\3475\"D\007\330\213\347\247\304K"
+	.ascii	"\347\300\306|z~^@\261\330\317\213\324\325\277v\222M\267h-\264"
+	.ascii	"(f\255\270\t"
+	.string	"\177\372\301\020\311\261\341\336\222_\001\333\2063#9\366\227-Mf\tI@S\315\230\261/\365\232\246\3365\334BV\347\226\325c\3370\261\232\323,\030\233\311\220N\244\217\f;\300\221\025Fd$\n\306\260h\204}$\017\303$9\206%S\354\334\212\035v\200\252)\374\235\002O\305\276\227\260\217\205\213\257\f\025\356\002\224\016i?\200\202\250A0\213\244bfF&HA\013R\314\030\320\002\221):\007\020X\250T\223a3\362V\221e/O\221\370\255\030\211u\223\201\020^0l\246\261\341\035\226\027\302\307\300\320\313\022B\316\033\001\203]\0165\352\361i\271\201O70\267\320\333>\022t\216\330h\242\300\3140@A$\357+E*\360\242^za\345za\033\231\t\0273\035a\037\366\365\243\004\3347\215u\355\335\330\006\201r\251jm\fh\250J@\372GX\260vI*z\301Q\375\336\nm^\236\034\321"
+	.ascii	"\222\372& \323b\221$-\310\212A\270\t\252\215=\305\353\266\225"
+	.ascii	"\350e\351w\260\211\254\333\352\312H\b\225-\253\002\275+\327$"
+	.ascii	"\004\002\247\003kj\257\307\311\270\351K\374\347\241\276\246*"
+	.ascii	"\016=W\030\023\343\355\345\221\031\030\274\341\314\031\005>\261"
+	.ascii	"^\321\263\231\271\316\r\034e\202\231\n"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.19.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\201\t\205'"
+	.string	":@\360\rH\220\234M:\240n\216("
+	.string	"*\347\336\356H\031\305\256t\205\020\272\302~B\301\226\252\006\210\221\372\361\274\305\3360\364)p>/\001"
+	.string	"L\023\374\216\226\020\220\322\260T\263\215L\032\202x\3564vw\267\246\326\b!\233H\231d\313"
+	.string	"\302"
+	.string	"\306"
+	.ascii	"P\022\254\314\240\251\265\366Nw\201y\372\251\234\034-=\346\335"
+	.ascii	"\027\271\021\244\013I\\Wk\215'Pj\025\372,\217y\272B\363CN\004"
+	.ascii	"i\177\243\320F\220\264\"\323\244\025Vk\365\351\234G\236\216\337"
+	.ascii	"\221\247m\265\364\243\360;\362\357;\034]\016w\263\325N\332\314"
+	.ascii	",I:6\377\366%\320(\304\210\026\247`\322w7\216s\003\213uW\317"
+	.ascii	"]\331`\334\214\337f\310`\233\324kR1\370\204q\032\214\027<\033"
+	.ascii	"@\205\"\352\246\027T\324\200\035P.\270lq\362\026l\032u\264\230"
+	.ascii	"\230\216\264\242\023\342-Xb4\200\265C\307\267\316OA%\036u\250"
+	.ascii	"x\177\353\243\224\"m\234\202*\316%P\255u\331)\210\342\233\363"
+	.ascii	"\335\207\330]\b\273\246\220T\337\372I\304\302\304+^\225\311v"
+	.ascii	"\205I\334U\273\337\"\2162a\3335v{\027\376<\313\273\363\341wG"
+	.ascii	"yq(\257\216\362\346(/\216\362\336(\257\215\362\326(\357Iyi\224"
+	.ascii	"wFyM\312[R^\222\362R\312;2o\217\274<\362\276\007\027\306\205"
+	.ascii	"\001\230ZO\224\271\251[(W\216\017\377\254\363\276P\331\223\007"
+	.ascii	"f\254X\334\223g%\253kO\236\022\036Q\366\344\001\021CCE\334\223"
+	.ascii	"ge\025#\350dO\036\013\235\245\\]\242\021\006\205W\231\354\311"
+	.ascii	"+\261\244\253)\314\201y\232\003\326\333'\331o\355\231\303\246"
+	.ascii	"\367\341\317L\2022\207`\31640O\315]\244\275\326\2369azG\216\004"
+	.ascii	"\351Y#\314\244kv\331\266\261.\343\267\330/\363S\366\273\210\341"
+	.ascii	"j\243\205*B\225.\273\252?\374\223+\027d\024\331\007\312\"\355"
+	.ascii	"/\371\243\246\200L>\212\235\300\024\037D\310\256Z\262iw@\222"
+	.ascii	"e\211\307|\310\006p\305\005\344\262\236k\375\314\276\211\341"
+	.ascii	"j\"\230W\325:-\216\264\253v\206\325\275.\235\270\367]?\321\007"
+	.ascii	"c\226xl\311v\r\004d\262\217\265\326:\366\207\327\001\376G"
+	.string	"\356\272\327g\222\241\264b\354\335\275p\255\337N\230Zk\002ZtJ\263\267\"\342g\342\330\223\350?\275\340\346\351\3563\365\030\277W\3107\367\231v(q\331\356\372M\2754\275\001r\331^\212\2522Y7VW\n\023\275\275\177\370\017S@&[\013\001ECBG#\207\027}\205\020d@\220AC\001\003?\272\020\337\240\037\020\033\2160\f\371<\020\r\r\021\005\371<p\3000\344\0132\002\341\373\021\260DEBF\276#\"\"#\337)\254\357\032;\255\003l\245\0351\326J\325\340Y?\232#;Ll\343\325;]\353\372S\250\340\340\264\356\013G\267f\246\313u\026\005E\\_J1\227k\\\016\207\263}\335|l}\256\256\333\255m_|\363\261\265\255\346s\366\241\374QQ>\212\275\326U[\353\263;\324|N5^\270\262\nb\263s\326_\315\006\027\344\266f\326\177\362[\020\342)D\2254Z\317:"
+	.string	"\326\017\255\371M\317\254\231\315i\344\3741A\0079+\033\013w\241\201\231\315Mx\326\320\244\312~\223\227`N.!\312hvU\200\332\250qL\352\030*\021IIAJ\212\031\003"
+	.string	"\003\021\241\251m\022"
+	.ascii	"\224=G\305\306D\242\221&%\251\326;2Lr:\037\331\235\317\276\245"
+	.ascii	"\225\207&\247O\344\024\214\013\207l\020a\304\230\3522C,w\200"
+	.ascii	";\033{\t\253\236\200Y\352\261Q\252\356\320\357\216\356\270\313"
+	.ascii	"8\301\002\341H\210^iwx\224\327\006D\300w\204%<\3309\313\254!"
+	.ascii	"\301GX\322\2536tq\256t;\304b4\364\342\022^L\216\304\377:\325"
+	.ascii	"\241\022\252eu\035:\217\034\001/@ R\3740\371\230\033i\3258x\213"
+	.ascii	"\232}b\005C\200\274\210}\035\312\371\013\260\320\341HE\313k\022"
+	.ascii	"\212e\006\337\357\036\260\334B\224\341\033\357\0221\021\204\032"
+	.ascii	"\234x\240e\030^W\005,\024\241\024\335\374\257\367\026\244\177"
+	.ascii	"\200\332<pq\336\334;\201\027/\346oP\326D/E\322\177\273\240\033"
+	.ascii	"\245\230:\233M2\335W\364?\006\023Pj\202\221\302M\370x\337\013"
+	.ascii	"Q\234e\233\303\030g\363\267\273\255\241\341\315A\364\f\231\332"
+	.ascii	"8\352H\271\"J[Qy\267Z\355\337#L\034I\352)G\256\032\0056\241a"
+	.ascii	"x\b\026\376\301,i\3344W)ub9\025q;\345\0079/\001Ba\371q\222@\354"
+	.ascii	"W!\366\253\020\373U\210\235+S\bO\223\021\336\302\tl`\007=\031"
+	.ascii	"Cy'\2508\323\377P\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.20.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\364\017\0355"
+	.string	"\332S\f\022Gp\336Q\007\243\023D^A\271\221\250}\243\365fo\332\035(\267\320\0336\034a\204v.=H\002\215VF\341m;\310\221\034\324A\255`>\t\204\333N\004J\3452\017\373bA\266\256\221\315\376\022\262\367\226;\245\224\002\024\001\376"
+	.string	"\f\001NU\251\230Z\212\005i\333\0353\023w\030\253?0\241&\355\204\251\237\220H\235\252\220\266P\260\335{\205\332\262\202\264m\213\351\371\025\021rgn&\r\306\324\311\022\355\273W\213\354\312\275\311!\026\220\266\345d\332IZ\t\0237\231\311\036V'\217:'\302\342\334{\213\202:x\2665{=\333>\017F\333L6\233\336\324@?>=\306\"\221g(\f\002\327\237\257\307\333\351v\324\034.EOk\2767q\243F&\222(bSVN\r\004\326?`L\334gI\367,Q\342\306$]L\202\304\211_\315\363u\304\207BZ($\210\007\2014\020\310\017_}\364\317\007\227\373\266\272\267\325\303yX\275\303\272\341\272\253\336\271\262\341j\215\316\325\240\3418"
+	.ascii	"Y.\216\235\246U\035\001xU\315pTF\237f\320\t3(L\312\255\231\336"
+	.ascii	"{wV&L\004Ne\005\345f\027\214\376\036k3\313\230\225)+\030\355"
+	.ascii	"\250\321\275\227}\312\312EsP3\373\004fn\300\274\223\020\327\227"
+	.ascii	"\377\311{\235\236\205\272\305\332\003\216'_2\205\254\036kU\371"
+	.ascii	"\302\225Vi\327\227\314I'\177$ss\362\265\230\221:\331\335\200"
+	.ascii	"\235\217Z\254\031\310:\377Xg\037\353\334c\235\215\326\271h\235"
+	.ascii	"\211\326\231\307:\017\255\263\320:\007\2553\320:\257\326\371"
+	.ascii	"g\235}\326\271g\235y\326yg\235u\326y\307:\253\3269g\235q\326"
+	.ascii	"9\265\316\250u>\255\263\265\316\246;\277\351\354\246s?\370y\215"
+	.ascii	"Y\360vo\213\2679W\214U\ni\261\356'\r\354\"\303*\320\253\005\020"
+	.ascii	"k\f\253@-\340\2120\254\002],\301\260\n\274,\324\274\260\272\256"
+	.ascii	"\331r\306\352\372%l\013\253\253\224\025\353\0203V\327#k\016,"
+	.ascii	"\254\256;\326\026e\254\2560T\260\321\261\302\352\372\304\303"
+	.ascii	"\206\232*\254\376"
+	.string	"\330\202\242z7JG\234+\277\263)\254\376\320\244`IA\305 m\373\213\"\304\r\205{\214\325\037\231P\2135\245\001\237\2644w^\270\345\346\3521\215\367&\301\r\247\342\236\315\277\341}\345\376\321\022\230\355\332p\337d\275\373\262\322\021\216h\356\221\234{\334\017\271\332\316\334{\235!\334\373\033\025L5\002\241\353\304=\222\b\214\227\311\265I\235\212\200\266\334\025\372M\245\3216U\032\251\314L\037\311\351\243\257\223C\224~\257\241\337e\324\224p\302d98{\324~\2135\331\326\214\363x\276\001\324\314~K\351>\342x\232\322\246[\237\217\344\363\355'9A\213r9k\315fg\333\363\205[\312'\177\033\320aM\351\357\324\224\257\224\221v\303\332\232\231\366\221\214\343z\244G\247\\\250\201\236\352(M\224\313\341%\320\033=\371\262\315{\3575\221\276\305:\350\251\233N\240G\372\226\272\001\025\303|f6\352\260\246"
+	.string	"h\356\275\b\254\331\224\033\3563#\232\322\037\334%\276\251h\3707\370\377\226\"b6{9\373\375[\312\013\312\337\030\350\373\255\231\023u\236\374\215\373*+\035\2240\20407t\207f\f\007.\034\270\220\201@\001\"\237\210f\013D 4\204\250\240T\304aIIi\311B\021\207\r\025\224\212,|"
+	.ascii	"QDT\344\245\016\030>\024\205XZ\372P\244&os\362\265\216>\350\351"
+	.ascii	"\241\230\204yo\326\202~\322\315\326\304\337\370\310\225]i\017"
+	.ascii	"\364\363>\337i\335G2m\272\365\317#\371\347}>\351\347\205>X8\037"
+	.ascii	"\343\256\315\370-\246w_c:\302\021\355\351y\343\017\271z\214\247"
+	.ascii	"\221\370\305!\3427Z\243m\3024R\231Y|$\027\237\370:9\305!\342"
+	.ascii	"\023y\226\303\357/\335G0m\2725\317#\231\347\207\237\264\306\363"
+	.ascii	"\302\345\360\n7\024\006"
+	.string	"\277\273x\021\n?\330&\f\006W\242\365\233\313\031\020\370+\360{m]}m?\337\267\226-\277\337\373\332~n\276\032>\336Z\217\210\367\235\245w_f\035\341\210\366\036\311\275\347\375\220\253G\304\343\351\206t\337J,\273\335\353\206v:\235\272\334y\365\373J\367\261\254M\267\336y$\357\274\032\201Y\250\201H\350\034\242\021\221\202\024\244 \205\326q\006\"CtD\017\022`s9\206\265\312\021\211F\204DI\013Z\310vr[\311\310\237T+B\233$\237\313AK&\0369\320\017\224\305A6)2u\201\016\017nKm\\\203\260\220\323\335\372JRv^\017\313\252\024\327x\2370\371\031\346\324P]e\323s\323\2047\235\312\0328d\030\231\n\324H9\005\243\233b_-d\341\217\353qJF6\245\f\252\353 \2473\005_\231\265v\034\200C4<\207aK&QN0\"\f}\203\366\372t !\251\235"
+	.ascii	"\243xY\004e\002G\335\337t{\032\313D\001\022Q\307\017\243\022"
+	.ascii	"b\320HDV\245c7\326X9\270>\236\221\214\311\234IR\304\274\241H"
+	.ascii	"\256\332R;\327\",\244\317}\350\361\304\270<\336\204\t\275\267"
+	.ascii	"yK\243\310\310\333\"h\f2\203\273z~L[\331%[\005\020F\250\310\317"
+	.ascii	"\006\234\332](\313\231\201-w>K7H\242.\177\026\270\013$I\264\004"
+	.string	"W\247\251\263%\3279\"\"5\0079\246\210\f\313\226h\f\3422\207\021\032\376\3479\332\363\177o(\2501\302\241\030\202\237\230\304\314\026,\001\365\020e\033(\002+\365\002OZk\202g\332\302\037\001\332\fc\3260@\361-\031Z\324\245D\227\261\023\324\333\217\220\"\3447\333\320\304^jK\003\264\005\235\311A\263\2367S\372{J\321}\241L\354]\003Kj\215\204\230\357\001x \336z\277\303\234\374\346\376\006Y\022\344\306\320\032Knc\224\352\335\t|\375\274\333\332\003\245\377\324H\254\324\334f\327\017\235+\302\016>=\207\306\274\211\343\367C\243\027\341l\346|\0261\002q\227_\267\200Y\377\020:\265\274i.\0048\022a\006\020\0010\345hD\004\027mU\025\361\302\215\2201\017p\"\207\357Ip/9|O\202{\311\341{\022\334K\016\337\223\340\306\245!\016\274G`W\0139\3006\245Y$Fo<"
+	.ascii	"\267\333D\031\377"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.21.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`h\026u@"
+	.string	"\252c\220\025E`\346Q\007\007\337\251\262U\232\214\013\3016\003j)\320>U"
+	.ascii	"zvY\271\0065\3626\034\307\247+$\230F\003w\360\316gX?\354w\324"
+	.ascii	"\327\314r\354\006\017\323xX\340\rF\343\356\232lK\333\266\334"
+	.ascii	")\245\024S\0010\001@\001b\313]\212\254\235\030\333\216\005\273"
+	.ascii	"\276@\314(\270\303X]\275\224V\372\n\212\306bb\227\"+B\327\326"
+	.ascii	"\235\266m\225}Y\301\256\257\367XZ{(\335\231\233JWA\321`'\232"
+	.ascii	"m[ ]\276\264-\030\024'w}\031l\327QZ\n\n^\242`B\264\322\256\034"
+	.ascii	"-\302\332\332\266\2252\3660\355\213\2660\355\373A\230\327(X3"
+	.ascii	"\352\313V>%\235\220MLKJIG#\322\221Q\021\321\220PP\2218\004\022"
+	.ascii	"\006Y\340\372\363\375\250=\336N\227^\364}\311\255c\200B\3312"
+	.ascii	"\207\245\225\242\225i\375\224V\306\223h\355\204F\306\221^\272"
+	.ascii	"\311K\027g*\353\24522W\342\322I\\\266\370QK\033\265\2149R\225"
+	.ascii	">\252B\305\215\246t\321\024)N\024\245\207\242@q\241\257\016\372"
+	.ascii	"z\342\305#M<b\304\207E\032\250\b\021\027\016\351\340\020/g\273"
+	.ascii	"\032\330%\304W\036\375\343\261\303}[\375\263\245\303\325\034"
+	.ascii	"\335\313\201\303yG\256\031\315\336\251e5\217J\262n\270\316F\247"
+	.ascii	"?\255\026\2501\214\205_4]\322,\373i\255@\021\220\255-\351\261"
+	.ascii	"v\030Z*\034MB\243\277\307\032\r\243\205\017\226\026\215v\035"
+	.ascii	"\203\266m\331\261\264f4\003h\346\027\300\314\017\230\205n\002"
+	.ascii	"=\326\352s\212?\243\250\265\016\307\f\226\302\337\311\334\003"
+	.ascii	"\232dp\370\2010O5X7\006v\276\320b\315\312\353\374t\235\223\327"
+	.ascii	"\331\351:#\257s\323uf\272\316K\327Y\351:']\347\343u6^g\244\353"
+	.ascii	"|t\235\215\256s\321u&\272"
+	.string	"\316C\327Y\350:\007]\347\342u&^\347\341u\006\272\316\302\353\034\274\316\354u\006^\347\365:\377\256\263\357:\377\\g\365:\367\2563\357:\357\256\263\356:\247\327\371^g\324\235\037uv\324\2713\004\357\254\221\360\246me\314\305\265j\356\363H\213uc\351\240\013;\254\006_\030\331C\207U\026\256\215\034VY\266'\033\253\354\230\"`oXe\303X#nXe\227\260:\330\260\312\372 \302b\255a\225\225\321\226\206U`\237\2653\254\002\345\f\t\223\306*\020\315\n\032\253@1 \2221\254\002\233x\001w\234\261\n\374\001\214\001\206U\240\326\233\031\253\353\\\327\0358^X]\351\004\321!\246\214\3255\315x\005l\257~\264}Y\261pau\325\262\005\314\013!\rv}W&J\356,\334c\254\256_\312\016\277\337\373\342~Q\276\367\251\377\003@\375\376\322\3354k\324\255\177\336\311?\257>\025\324\017"
+	.ascii	"\025\214\332:W\301\215\247\276\363\312\316\357Y\277z\377h\022"
+	.ascii	"\234\375\364\360\276\273\364\357\313KSh\352z\275\347}\321\313"
+	.ascii	"\257v\275w9g\352x\357{\324*"
+	.string	"\252\223\tIR\236N\356\214\267\351\341\331\275\223%\365\364\266t\337d\255\303S\326\021\314\320\335;y\367\272\367\275\3115\237}\317\211Cu\337m\330\236|\322pA@{\335\375\026\353.]7\322f\372\005tg\367{Kw\263\007\223K\243n-D\266\306$}'\247\177\237\352\n\232+\177k\363\346\263\264o\372\304\256'\323\347\240:l\271\373\037\333\363\237fjmX\3373\364\276\223y^?\365:,W\266\362a8\210s\345o(\234\362\0310\035\256\321\266m[t\352[\254\215\314^\246\312\237\372f\261CE\r\364\231y)\244\303\226H8m\333\036\270gXy\270\363\224X\356\210p\237\370\206\201\303\037\303\3777\013&hsZ\332\357\337,\224\250\3609V~\377u\323B\216\351s\334[\\\255\303\375\223\255-i>+\273\305\032D\017\246\303\261\005\256\037\2524\214@;\364\207f\r\0062\030\310\260!"
+	.ascii	"\201(\226D\363T\224\b\016#0TIy\260\252\252\262\232\222\362\320"
+	.ascii	"\001C\225\324T\b\021RQCl\365AC\b\251\021VV!\244T\260\266\037"
+	.ascii	"\310\20572_\005\233@\333\226kAc\351\276c\345\202?\323\250)\237"
+	.ascii	"\222\337u\272\233v\032u\353\247w\362\323'\237\352)y\206\227D"
+	.ascii	">\362{\016\035'\247G~\321+\316\t\211djkb\372\216\323:<r:\202"
+	.ascii	"\031\332\364Nnz\246\367\2755}\317abzgs\251\200N\351\033\016\333"
+	.ascii	"\322;y\351\225\236j\351\211Ji<\245\244\266\343\367\332\233\244"
+	.ascii	"\244?~\321+\251\355xD\212C\372n\343\306h|$#\024\022\222\321\033"
+	.ascii	"}\253u7\3314\352\326G\357\344\2437z\252\254\243(#4#\242\"\242"
+	.ascii	"o5k\212\212\236\250\350]\216(%\032\222\023\372F\223fh"
+	.string	"\350\205\336\3676$'$T\374\342\267\2313AA_\214\n*\216)\016\211\303\3572\375\373Jk\nM\035\361\235L\374\341\027\275\256\210\303\241P\016\350\205\337d\320\200\200^(\007$\024\262A\366[\314\230`\360\331 \024{\306\256L`\326\372\035\346\f\b\374\225\t\314J\327\325\027\367{\337\367\023L\201\300\250\201L\007\031\"\021\021%IRPHc\221\006\"Bd\253\007\022`Ri\214m\221$#\301\210\214\210\004B\322$\333\001\362\350\207\243\002D`\321\247\340\\\270\241%\f\210\321M\321\222nm\360\013&@\2075(\352\344\321!R\t\"\207\261\223\n\260P\232~j\004e\007\3606\344J.\200tR\324e\327u=\2059\024\330\256Z5\342\313\332\243\032?\353:wK\326\007\006&M\267.\214*\rB@0Q.\017\016Le\304\262\301\342\320\303l\373\322\201\373\"\267h0O\215\024\005Fm\276"
+	.string	"\371\206\375\260'-\001\317\323A\331\361\304\027\300\316X\016S\251pt\317\340\374\017`\305\202\n\302a\245\342\350\"R\363\224\244\260\227\225\374k\304\217\200kX\275#7\177"
+	.string	"\301J\326\236\220`\205?\3677\372y\215\021\207\206\346Fl\021\204Dh\307\024s\034\262\033o\214r\037\201\030"
+	.ascii	"Sh\007\202\242\253VM\321\373u\324\"\371&\325\351?E\237\264\256"
+	.ascii	"o\236r\005!\325/.\305_\002P\207\225Y@K\316\001\246\317\036D\250"
+	.ascii	"&\236\t\344\005\032\243\363\024\0015\370C\232\322_\023\246 \236"
+	.ascii	"\332\312qI\030F\241\005\351)s\237Z\f\020\336\3423\275 \246\344"
+	.ascii	"[KN\r\377\020F\204\324\352\265\"0pM]]T\213L\251\341\320\224\337"
+	.ascii	"$I\334\230\263\223L\315V\205\334C\f\206R$\323\365\370X)\204\317"
+	.ascii	"\2275\344\250\034m\r\335\350\230\277`;\256\272g(E2]\217\217\225"
+	.ascii	"B\370|Y\034\253\331PQ\367\002?\324\236\244MC@\261\315n\265\260"
+	.ascii	"\304\205\020\317+\301\206I)\326\0042o\t\360\b\344\313\301\273"
+	.ascii	"\n\206\250u\0231r\323\345a\213\262\373^GM\367\215\005k\214O\202"
+	.ascii	"H\243\332\005\022\"\373g\375\177\222\343\375\244g\274\263\244"
+	.ascii	"\204\366M\374R\317\024N\373\366\203Y\nM\210\306Y\316h\343%K\254"
+	.ascii	"\327G\361(}#\316\216\351\233\341\251\333\230\375U\3215\023\201"
+	.ascii	"%\2746;\316\250<\204\331\203\212\350~S\002K\274Mv\354\032\376"
+	.ascii	"\361y\251\256\324#\314\036\316J\344\256\373\241\246\247\203="
+	.ascii	"\271\022&\210Y|\362\032\314\233\016G^{\240s\225\232\226\310("
+	.ascii	"F\244\301\3243\200"
+	.string	"_#1W\371\234\024\203)\016\243\204"
+	.string	"\255\f\246\f"
+	.string	"Z\031V\t"
+	.string	"\2650\254\022\002hq\030%\004he0e"
+	.string	"\320\312\260J"
+	.ascii	"\250\205a\225P\001\346\265ze\301\261P~\300J\205\r=\237\023\245"
+	.ascii	"\237\200\244c28T"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.22.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\\\005\245\036"
+	.string	"\346\364\266J\240\230Q:@\235Y\271\022\365\351\235X\2120\267\255\230vk\274\3708}\003m\f\253\260\222\262\370_uvG\333\337\355\020\245/\273ar^\232\234c\217\332\n\237\207>\265\036V\031G4S\214\376\211\026\233%\204\354-e\222\001\240"
+	.string	"\235"
+	.string	"\234"
+	.ascii	"\024\200=\250\324Z[\247\373\300\t\200RG\353\274\373\037\007\022"
+	.ascii	"\273n\231>\240V\"\245\"\265\352fVf<]\335x\036\357\021\333\355"
+	.ascii	"M\235\f\032\007\356\350\331a\251\265\272X\177\tO\347\t\204\247"
+	.ascii	"\035c\373S\367\235\034;\271R\215bHgsl/\326\314\035Dx\265\233"
+	.ascii	"\354d\213\257Z\260`\325\001\334\217\320\307\237M\350\300\r[\020"
+	.ascii	"\213+\036NV\317d\355x\230N\001\265\326\362vb*`\237\033\215\247"
+	.ascii	"\r\025\357'}\"Q\202\252\335T\234\305\232Z\353r\355\366\363\005"
+	.ascii	"\360\335\375\355\356\204]*\023\255\237\367\0200f\034\334\f\270"
+	.ascii	"'\235\364\005\331\227\345W9\270\253\223q\347v\377\332D\2731\327"
+	.ascii	"\375\005(\357\313y_\222\362\256(\257\212\362\216\224W\244\274"
+	.ascii	"!\345\245\224w\236\267'/O\336\033 \360\363\304B\223ZSLi\251N"
+	.ascii	"\250\257\306y\377\221\213\254\267\244\313\254\007\005\324\322"
+	.ascii	"\222\245\025\326\216\200\352C\233R\244\\\242\264d\371\033\262"
+	.ascii	"\275Qf\203\371\021\002$\302xZ.\265\366H\373\244%K_\353\274\022"
+	.ascii	"\243\3146\362\200> \214\247s7\266\337-Y\032\265\202\334(\366"
+	.ascii	"#\023\243\314\026@a3x\022w\265\250\231\021\332\037\362\003\301"
+	.ascii	"\230)}f\371\352j\255a\3476l\332\037\214\230\354\260\324L\330"
+	.ascii	"0E\276\031O%\030\273\004\372\3327\365\253\273\323\246I;\267\252"
+	.ascii	"\031\035\323b\215['\333G\202\224\035\226\332 \33153\016~\326"
+	.ascii	"Z\353\214\351\363\316\232\275DHvL\237\307\005\rh\366\356v\370"
+	.ascii	"n{\b\236j\255\016hS-j\357#\261\275\221\306~\231\372>,\270\013"
+	.ascii	"t\367yp\314o\222\360\315}\236\0334\236Z\262"
+	.string	"\337\024J\317\226\031O\355\207p\225\203\335\265VYo8\257\033\235\351\3418\337\233\006\033\032l\340\260\200\001\315\200\021_\033\032\021\035t4\274\\ `\257\027\314\306\005\302\203\206\227\313&G\204\213\306\300\302pnr\\:0X\216\213\324\325\2776\321K\263fM[\023\263V\034\204\037\375T\202\314\274\360\221\333\317\345\n\206%*R\325S\236\032\252(\310e\250tR\365\231^\016\365~\341&\256:\267\253V5\214\324\252YK\002U\263\0252\007\371\302\202P\250Z9\215\214$\323\264\002\022\373D.:-\275\202\2179vn\307\026;@\224\022\3766\365\243\210\375&@_\225$8\n-\322\231#}\251((\f\200\203\25014\213\244bff$HA\222\0243\006\320\002\221):\007\021\200\301$\266\262l\006\362\252\"50G\222B\250n\027{\245\223\2412j9c\331X\211\261\214\315\3705\220\351\203\333"
+	.string	"G\314\274\203\274\b\360\337U\03555>\223\322"
+	.string	"\201\003\2144\2419\212\216g\240"
+	.ascii	"\245^\355\221$\220%@\0068\320\302`\334s\232\007\227\211\b\310"
+	.ascii	"\320m\021\t\337|2\316\335\210\305\006<\316\302R\220\254\2621"
+	.ascii	"\347\360n\002\313[m\300\"l\273&\261\275\372T\244\027[\313\317"
+	.ascii	"\226Kv\200\247&\034\320\371\342\235dB\b\212A\270)\265\306\236"
+	.ascii	"\342U\263u\356\245\362\267\315Dn\234k\221%\030<\214Y\035\340"
+	.ascii	"}d\261\037\201-B0M\355\365:\031pr%\213\321R/\256\312CE\"\214"
+	.ascii	"\211\361\373p\b\r|\274\221\301%\n4\261]\320\260L]G\f<e\3522\025"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.23.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\246\t\365'"
+	.string	"\032A\034\016I\220\\Q:\304\3005\230\006\362\026&"
+	.string	"\357\221\005\210\326\354\026\241\0228\262\374\226Y\330vm\340Q@\344\307\355\030\330\032k]h\021\200\351\202\357)\033\221\345{\032\336\375\204L*\023!\336fm\237\304\330,!d\023\271\223\f\315"
+	.string	"\310"
+	.string	"\311"
+	.string	"&\221\222\203\253(3\367^\333-'0oO\003"
+	.string	",\313\366\312\374$W\242;\220\245>\273\327\006\224\224{\2017\3361o\031h\336\310\217\350\230\207#\020\207\216_A!\005\327\334{s9\017@\336\216\257\221\267}\203\355G\340y\254\272\327h3Y,Ea\347\313e\226\244\035\273\352\370\245\317X$j\013\257G\364Z\216\323r8\325Y\323eM8jl\306\323\0312*\352;\314\027\243\2360\376\202\361\242\272\0060\245pq\323J\311\305"
+	.ascii	"\037J-j\311\342d\332C\032s\202G\325\216\257b\3240\355\225\030"
+	.ascii	"{\234|\364\370\323kR\257\250\216=V\274\377\364\221J\0245\274"
+	.ascii	"\336\212\327\322\347\336\313\225\327Kq\006p\346\207`\346\006"
+	.ascii	"\314\346\226\024\230\376\364\223\350\253D\030V\267j1\003\211"
+	.ascii	"j\377\230\317E\035e\326p\333`\266\035\370\357\330\312:\027\236"
+	.ascii	"k\2662\315V\236\331\3122[9f+\247\2662j+\303l\345\323V~\331\312"
+	.ascii	".[\331\264\225K[\231\264\225\255\255<\276r\217\225\353X\371<"
+	.ascii	"5\"]\"\204\271\027\305V\233\313\305N\355\270\360o\222\362\250"
+	.ascii	"\370L\223\256\254)\362\211\272\001C\344\023%Ce\n\237hU\225\231"
+	.ascii	"%C>Q!\322\t\036Q|\242Ar\214d7\251\250\214\024T\006\024\237h\r"
+	.ascii	"(<4\211\224pR<\261\262\300\274EO\330\370N\370O|\242*l\027\216"
+	.ascii	"0\211\224L\341\225\224\002\363\326d\326\361\203|\242F\266%g\242"
+	.ascii	"{\023\022\001?6\273l\364\214\227\361\\\354\207\301\225\375-W"
+	.ascii	"Sh\26009\350\262\177\267;yTS\013r\211\354\0361e\220wf7\305\366"
+	.ascii	"\241\374K4vP\037\331\234@\025!G\310\3761\331\26670\321bT\263"
+	.ascii	"nd\3434M\355\352\026\217\331\351\325T\023{X\335\340mq\264\375"
+	.ascii	"c\227S\333\272\344U\333k\235d\031\2141\252Y\254Uk\237]\325\372"
+	.ascii	"x\357\275c_\370\234\335G\220\265\266\365\217d\024-\215\315\314"
+	.ascii	"\025\036\344\241\216\230{\357\001[\344\235\341_\021\301CS\007"
+	.ascii	"\237\245\372I/j\357t\367\217\200\214g,\344\273\366\217|\024\325"
+	.ascii	"-\256\365\333~Az"
+	.string	"\263\253[|\037\323\255Z\335ND\025&\232m\277\360\035h\354\252\026\007CA@ F\r\037:\003\031\270`\340\002\206\002=\270Y\210\363\017\356C\006\020\026\202r\034\204\202\202\204~r\0344X\b\312\375x\370\220\303\t`\241! \0179\020BB\036r'\360\276m\350t\316\256\213\230\304x/\223\2027\371\315,\321\251\304!V]\233\365\254_\205\212F\353\031\026m\026\3045\223uS!\370\022\353S)\312d\035\223\305b(VzC\373S\3044m\024\253\2467\264Q\330\355\354K\371\227\246|dsX\377\030\326go\200\335\316\037V14\023\262\270NWw\231\306\212\371\322*W_\352\251ox\t\275\362\365jW\343d\341^]\333\360\270\272\2469\207\2343 \270 ]eW\252\252\345Ue\342\252\223\235\342k\251\354GyY\025\365\007HF\263\003\200\334\250qP\312\030\"\021\221\222\202\244\240\2301"
+	.string	"\003\021\241\251m\022@\204=\2053\307D$\030\005MJRh\3372Lr\370CR&\037\027f\227\261\233\210\215\261+\370\030\346\332`\261\026\003\314\200\334\013\306q\357\357\"/\214w;\263\030\311^+\236\202\305\036\037\265\206;\205\300\273\020\034\323Y\242\260\253$\326\b\254\b\020\334\n\332\024jHpma\t]\335\013\003\255\242\030\021K\026\321\205W\353\201<\375\246V\366\"\276-=\242\3307\215o\371\344\310,\021\233\247r\023\313`LBL\025\311|\334\024+\033j\364N\242\310R\245%\213M\224\244Y\212\242\207\001\240\330\377\0130\260\355!\271\343\317-Fp\017\032a\274@\264\347\216\035\366\352\217\360\314\251'$\001\177\304\364\f\315\215G\030\217N\276A\362f\254\033\3109\3017&\225\332\352C\210\3200S\306\316\376\224\304nw=\004"
+	.ascii	"\026\260wBO=8\374\375\277\214F\361\324\366\2341\370f\337A\266"
+	.ascii	"\332\r\207\006'1\024e\343\320J\321!\353b\363%\367\024\326N?\022"
+	.ascii	"\314\236\2443MHV\313\300\024\021\031\311\0234'\304\353\324x\350"
+	.ascii	"]\223\305\222\347\304\304,\227?\344\234\004\030\205\025&\031"
+	.ascii	"'\033\253\227\215\325\313\306\352ec\324M\311z\372@0.\354\302"
+	.ascii	"Fa\360\223%\224W\202\032g\202\034*"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.24.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`5\020\2155"
+	.string	"\312T,\022H\200ZR\007q\225g7M\202\035\245\001\375fb\203\352\201>\306\301\227?\315n\2038\255\002 \352\261\251\261\244 \334\253\340V\377I^\177\013\"\354d\b\207pYgH=\371\203\366\005i\031\331fB\310n\"wJ)\005\025\001\376"
+	.string	"\r\001\351QSzUV\246 \355\272c6\342\266b\213c\366\034i$F\235\244Dz\324\324\240\214\213\230{oOWN\220v\355*9\270eO;s\027i#F\255d\255\366\335[\003\353\311\275J\037\026\220vee\332TM\304\210yy*oLu\231\230\222\325\231{\357\017O\003m]\317\376\331\272\276\rF\373T6\237n\324\305\035\235\034\342P\210s\023\004\332\374j|=\336N\227\263\270[\212\332\352\371n\304\215\002\235C\226WK\310\243.\032\351\035#E\\\247\252s\252\2108\221\252\207TC\\(\244q\204\004\361\033\036\035\344\261\303\201:\332F\307\224\377rtM\016\034\356\223\352\236\324\r\347\315\350\335\f\031\256\203\352\034T\f\2670\032\007\343\205\337"
+	.ascii	"D\255x\352\224\254\351\t\200\217&\027\216\266h\333\311\243t\362"
+	.ascii	"X%y=\323{\357\016y\342<\340LH$?{\260\350\357%}B\321Z.!Y\264\243"
+	.ascii	"@\367^\366%\344\212f\236f\366\t\314\314\200y\327\024\336\374"
+	.ascii	"W\336{\364\334\323}\325\036h\034\275\311\024\242zI\333\256.\357"
+	.ascii	"\332\"\273\336dV\036\371'\231\233\225_\203Y\250\225\335\f\252"
+	.ascii	"sP_5\027\253\363Nu\326\251\3169\325\231X\235\207\325YX\235q\252"
+	.ascii	"\363Mu\016Vg`u\266\251\316\277\352\\S\235}\325\271W\235y\325"
+	.ascii	"yW\235u\3259W\235mu\306U\347[uN\2533Z\235m\325\271"
+	.string	"V\347\263\235\377t\366\323\271\035\374\316\254@X\273W\305\032\232[\245r\361\350\253\356$9\254+lsN\302\b\261\3026W$gc\214mn*\347\024\3066\367\002L\016\t\214m\016\305\030&[kf\354\213\255\305\362%\313\213\255\345\242\352bk\225Vj\213\255\335a&\246\305\222\255\215\241\224\302\236\310bk\227xL\364.\023\222\331\023\034\031,\266\2703Mx\231\0365\005W0\361\262 \355\212\273\322\303\255\204{\t[\034\227\236\276\"\021\271\017J\245\271e\222\361\310H\b\273\331\333\277\331\207\341A\341|\376\013A\226\035\363\366\255\325;\250eG@\242\270O2\356o\037TC\263\341\336\321\370\334\336\313X v\306\203'\333\355\223\306/\027\223r\201c\246\357J\004x\341\234\320o'\2152\263Z\250\352L?\311\351\243\257;3\246\337[\320\357\2612.2`Q\r\036\255\337J:K\312\205\3156\240"
+	.string	"j\265tv\334\252\337M\272\235h\034\261\372Lk\333'\331\366\365\207\220\210\231p5\263f/[W\333\007\245\270\216\2766 \375]\031\327w}\221]\253\256^g\375$\337p\274\320\243K\336\323\305g\n\352b\302\325\316f\361\201\216\336\354\363\336{O\241\357\253\34696\t[\361\205\276\223d 9\235\317\314@m\305\313"
+	.ascii	"\\\356\275\007\252\327\322\031\267\226\021\274L\247\270Y\353"
+	.ascii	"\233\351\205?\203\377\357\244\037g3\230\255\337\277\223| \371"
+	.ascii	"\032\027\277\277fQJs\3645n\250\250\033\035\2100\20487t\207f\f"
+	.ascii	"\006.\030\270\220\201@\001\243OD\263\005#\b\r!*\020\375p(\"\""
+	.ascii	"*\262\360\303aC\005\242\037\013\037@\374\030\207\\\324\001\303"
+	.ascii	"\207\237\020EE\037~\254\3626+\277F\320\363\034\037\211K\234\367"
+	.ascii	"F)\350$\335b\216\370\032\007y\327\030\262/\356\274\3167Y\267"
+	.ascii	"\323\225>\323z\347\223\274\363:?\264\363A\235\261\233\016q\307"
+	.ascii	"$~W\351\035\224\225\216\200Dsr\236\370A\265\034\342\203'\033"
+	.ascii	"Q\370C\037\341\267X\243\314\261\026\252:\207\237\344\341\013"
+	.ascii	"_w6\364\021\276\020\247y\363M\245\333)\254\317\264\306\371$\343"
+	.ascii	"\374\315\017\231\341|\260y\023v\273\t\002\277\247\200\005\203"
+	.ascii	"\017D\013\002\201?\343\357[\n\323\306\346\1776\337[~?\037Z\215"
+	.ascii	"\357;\312WM\315\373\320j\322|`>\236Y\317\310\373\206\322;(\257"
+	.ascii	"\216\200D{\237\344\336\363>\250\3263\362x:\037\3357W\327n\367"
+	.ascii	":\237\235Ng\233\271\267\337O\272\235\266\372L\353\334'9\367\366"
+	.ascii	"\207\232g\201\\\250\201@\350\234\242\021\021\005)H\222Bka\006"
+	.ascii	"\"StD\017\022`\203q\212f*GD\202\021\021\222\222\026\246\260\035"
+	.ascii	"\262X\005\207\200\252g\243M\224\237\314\301\037M9MPG\365\305"
+	.ascii	";\213\022Au\322\211\016\304\316\b\274\356\262\315\323\013\013"
+	.ascii	"u\246\200\261(6\203\244\336\b\247\037%\212\356|\250\340\327\222"
+	.ascii	"\325\343\202\204\355\025"
+	.string	"$E\262\314Ph\224g\311\345\325\303\302\211C\366\236W\213|\270\236\016\337Up\301c\001\206\367h\b\303\262\356\307\303K\031Tj\277\303PN\202\244\214\354\320\257#\031\377\2331\375%pyG\202\345\325\233\206\350e|\n\252f\2600bng\371\237\3262\273\335\037\351\267\r\\HLJ[+\311\216V\363\234\361V\206V\311\202\362W\341\224C\317M\257\345\323{\f\327\037N\277\275\375\312r\310OU3\177(\301\362\252$8\036\002\177\301\233\016\210N\210lw\334TL\036?x\224\327\301\216gj\3174\325\353d\240\211\016\372r\262\365\034\030\\d_\005_\372\3418O\024\3233\007\001/<A\311\333\247J3\250\346\0355\034n\322*C\001n\204\022zo\222\017\272V\021z\226\031\233(1\300\034\222fp~\220\013=\240\021\003\361\203\337\255\036t\243\023\347\352\204&\237HC\206\277D\370\306\004\203\300"
+	.ascii	"\306\312\ty\263&'\306fK\345\241zrD\220\201\220\237{\212\313`"
+	.ascii	"\372\210k\364Y,\326\336\001}*\255C\214\377~\231P\247\376\251"
+	.ascii	"a\243\321\006\037|,\271n\261g\342N\213YUt\206\023\355.j\2076"
+	.ascii	"lU\023\223d\243\247\375N\t\361\270\346\341\344\261\b\304\343"
+	.ascii	"<Z\323|\351\200\364\034\250\326\343\310\206\036\300L\315\243"
+	.ascii	"\217\007\235\tq\3475r\364\356\210\314$\341\322\222\023p9u\356"
+	.ascii	"0\024\002\252*\247\275A\013\204i\372r\334\375\361\001,kue\374"
+	.ascii	"\365\303\003.\325\364e\270\373\343\003\340\322xY\257\314)\007"
+	.ascii	"\205\370\2612<\270\304&\215R\220mLx\374\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.25.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\305\026\365@"
+	.ascii	"\332d\300\025F`\236N\007\367\377\350\331\001\2139\264\242\355"
+	.ascii	"_o\307e\310\2015\220\335\342\334\023\200\213\017\204\305\021"
+	.ascii	"\206\016P\205\232=\370\213X\376%xR\031\274\005\266\222!IDV\""
+	.ascii	"\312\314\272!\210\t\202\233\354\335M\356\224R\nT\0013\001C\001"
+	.ascii	"f\313\036+\241Z5\3251\271<\005j_\"s\025\267\030\263)\330rJS\251"
+	.ascii	"\352*&T\253&\0049:p\332\266]\366\345\004j_\317\221\224\036Y\266"
+	.ascii	"37\224\216R\325a\234\245\205m\253\243LK\333\2069\261R\355\313"
+	.ascii	"aj;\351'U\314hh\030\017 -w\227B\214\256m[\250c\027{}\321\036"
+	.ascii	"\366\372\376\016^\033\rkF\275\252\227MJ\246\344\222R\022\322"
+	.ascii	"\021\362hTD4$\024\004\364\343c,\022\207=B\236 \360\267\303\372"
+	.ascii	"V5\355]\364\275\212;]\2006\361R'\313i\325K\267nr\373\342\312"
+	.ascii	"\266fj\363\342I\264^B\313\342Jg\235tf\346He}T\206\305\221W\372"
+	.ascii	"x\205\314\215\242tQ\024(N\004\326C`O\\\310I\0079i\342@L\372\207"
+	.ascii	"\311\022\367\031\322\306!B\274\030\244\211A\200\370\360G\367"
+	.ascii	"\374\360\341\302\036\315\323\203\207\007\275\032\350\205\303"
+	.ascii	"\177]\275\323u\303Y\033\355\263Q\303W\344\027\f\256V\337\232"
+	.ascii	"\\H#M\032\236\316\350\036\320\231\002=\212\241\360\213\366\216"
+	.ascii	"p\235\001\235'\320\003fh\2164Y\273\226\363\312\321\"2\372\233"
+	.ascii	"\254Q.hs\262\2342\332\323\005m\333\262g9a4\003h\346\027\300\314"
+	.ascii	"\017\230\211\r\002\025\276\232\254Y5:\256v\367\326\372\035s\230"
+	.ascii	"\225\377\223\271\007p\231\245\341\327\301\034\325a\335\027\256"
+	.ascii	"\263\205\036k^^\347\246\353\254\274\316L\3279y\235\227\256\263"
+	.ascii	"\322uN\272\316H\327\371\350:#\257\363\361:\033]\347\242\353L"
+	.ascii	"t\235\207\256\263\320u\016"
+	.string	"\272\316@\327\371\347:\373\\g\343u.^g\342u\036^\347\236\353,\274\316<\3279x\235\201\327\371w\235w\2563{\235}\327y\275\316\352uN\257s\357:\337\353\214\266\363\243\316\216:7\006#\2212\024\342\332\366E\035\274\226\314M\033\322c\335U|6\3360\353\273\341\302\267\242\r\263>\027s\3260\273\342\301\3111\273\252i\241\026\307\354\352E\n\034\263\253\225u\210\031fW$,\326\2562\314\256_\253\326\030f\327f]\030f\325<\25587fU6km\314\252_\250\2601\253\222e\251E\326\230U\223\250^j\314\252:\324\026[\230Ua\254\200s\207\306\254\332\246p!w\306l\352\346\210\305\323j]\261\321\222\262\2251\233\202\301\302h\252U\323\b\243L\005\003\265o:\266\344\266\302M\306l\032j@\340\377\360\200O\277\377\261\277\003\200\375\326\322\275\265\245\321\272\336\371'\357<\373RN;"
+	.string	"\330\030o\3018\024\302\254\354?\377\331\374\233`\227\357\237\r\001\034\260m\375\316\322\300.\264\236\340L}\276_\337h\347X\252\357\035\317\231\351\372.\207U\302zI\340\352\255i\236\263\271\030_\233\212\347V\224k\276\255\364\333\254\323\266\263\216"
+	.string	"\206\252\377d\365\323\377\315\3455\257}\307\341\241\351\367\030\271\2648n_\020>\275\337V\372\254\007\215\336V\357\t\244I\305\262\346\230[\3567\226\356\255\034\314\262F\353\032\310\f\r\222\336?\271\367\367\245\250\210\301r;:o^\353\365\355\275\261G\032\323\3538\251\017\224K\373.\316\267V\254\357\032z\377\311\253\217\217\3724\313\227\275|-\007j\260\334\016\275[\376\002\246\3375\332\266m\213F}\217\365\221\331%z\313\217\372F\201\343j\013}f\256\342\321b\214\226L\323\266\255\201\273\2265\307=G\202\321T \334\234\345[\253\206\377\205\377o\024H\320f\267^\277\177\2430r\345ux\371\375\027.E\036\323\353pw}\265~\367o\206\346\b\327\363\262{\254?\344`\372\035\007\036\2462\210@9\264\207\346\f\0050\024\300\240!"
+	.string	"\201'\341\210\346\250\247\020\033D\\\230\202\352@55E\025\005\325\201\303\205)\250(\020!\240\236\202\230\312C\006\020P\"\250\250@@\261am\277\016\013\177d\376\025\233@\333\366KAW\351\2063\305\202w\361z[6)\277\335to\275i\264\256\233\376\311M\257|\251&e\327\252L~\362\233M\033&\246O\276\321\216\251\231L*\321-)}\253\351\264mMG"
+	.ascii	"C\227\376\311K\257\364\277\271\245\3578\245WJz\244\3574rI\377"
+	.ascii	"\344\244Gz\251\2447\"\331X\221\216\350\220\337h\342\216\216\036"
+	.ascii	"\371F\273#:$\322\b\317\350\373\f\334\361\370FG'##\242'\372~\353"
+	.ascii	"\3362\323h]\027\375\223\213\236\350\245\232EOD\\DBCB\337d\312"
+	.ascii	"\f\r\275\320\320;\236PO((\017\350[\314\230\240\240\007\372\337"
+	.ascii	"\\P\036\020\220\317\373|\203\t\363\363\363>O?>3|\212\306\342"
+	.ascii	"\367\227\006v\271\365\004gj4~\361\215vX\306bqH\034~{\351\264"
+	.ascii	"\255\255#\200\241\304\1772\361\207\377\233\313#\016\207\302\036"
+	.ascii	"\341w\027\266\236\236\027\3668\t\267\204A&O3\370\315e\215\207"
+	.ascii	"\347\203L\236f/\030\374\341\001\377\367\235\026\201\303\250\201"
+	.ascii	"H\007\231\"\021\021%IRPHc\221\006\"Bd\253\007\022\200Ri\fi\""
+	.ascii	"IF\202\221@FD\002!m\n\273\001\362\350\207;\213(\231$Z\316x\357"
+	.ascii	"\232KX\025\243\246\"\342\022[\353\027'i\217Cp\360\261\256\217"
+	.ascii	"H\025\025\321\202\273\257\007\0334d\303$\266\207\332\003\253"
+	.ascii	"gR\224\246\2442(L\210:u\325\352Ye\330\316\345\371\273\261%?\273"
+	.ascii	"\234\306\215\345\301LI\221\354\024\322\375k\261%b!\364\362\025"
+	.ascii	"\333x\360\320-\333[\321\324\246#4qf\274\347\227\337\302\356y"
+	.ascii	"\305\310\365Z\212h\315\026\360\f'\344\020\267\270\202\331Q\206"
+	.ascii	"\350Xj?:hp*\005\004\261X\245\334\034\350Y\242\270\355J\215\245"
+	.ascii	"\240\327\225\374\221|'\221@\274}\2227\032\002\022\271.\334E\346"
+	.ascii	"\025\235\333\351\253\357k_<?V\204D+B\001\nE\231\2561D\022\273"
+	.ascii	"\216-\305\017 \006@(\264\003p\321U\253o\212xm\016\360\326\225"
+	.ascii	"\375E\247\346\216:#\0170f\327\332\376+\312lf7\223\233X\367\247"
+	.ascii	"\031\365z\357\321\231\017\235\222\216h!\324\300\313gA%\0015\341"
+	.ascii	"\307\314S\\\013\177I0\265\206W5\3120\n3H\264\372\320\\cA\350"
+	.ascii	"\214\017\325\0077s\036\266\351\354\300o\306H\233z\210\001\022"
+	.ascii	"\276\336)\266\253k(\324!\bQ9G\315\032\265\377$p@\313\263\222"
+	.ascii	"\207P]\033\007~H[\376\314.\233\311\t.~\r\242\256\246nB\342m\370"
+	.ascii	"q\276\212(],o#\004\272R\210\237\337}k6\273\231\260\021V\217\347"
+	.ascii	"\322\277\256\205M[\356\330x\250|R\220'\234\020\222\3650\362\356"
+	.ascii	"\366\"\213^PF\212\347s\3212\f\222\001\0266b\363e \214\b\203\254"
+	.ascii	"\200#\263\t\232\023\224M\214H\205\325\023-B\007\251\321\271\247"
+	.ascii	"\210y@?_m\357(/\301\356\211\214\352\266\210\223\376\273\313\227"
+	.ascii	"bzD\036Y\216h\343\220%\326\353\003\361\230\276\321g\307\364\314"
+	.ascii	"\360\033\370OY\365B\266\\\275\\z\325\314\350(\236\367\361\365"
+	.ascii	"\336\253\307\357\315\325[\311\214\216\362\354\322\253Z\316\376"
+	.ascii	">~\374\352\335\247V\262\375\273D\310\303r6X\\t\"\021\017\276"
+	.ascii	"\023"
+	.ascii	"\202\207\327\376\350]\245\306I*\312'R\300\365,\340\376H\314U"
+	.ascii	">\027\001\244i\321ns\360;D\277C\364;\242?#\3723\242\2771\352"
+	.ascii	"\033\243\2761\372\035\242\337!\372\035\321\237\021\375\031\321"
+	.ascii	"\337\250Q\363_\257\304r\264\226\027\260r\3308\363\361V:\022\220"
+	.ascii	"\213&\267C\005"
+	.text
+	.section	.gnu.lto_arraySubInt32.26.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\202\002\205\024"
+	.string	"Fg\210J\300\322Q:\"\300\250\020\212\342\006b`\215\240\340\264\342c\006\016~R\335\335\321\222#QBr\251\235!^\350\353\321t\036v\322\013df?Qpp\301Q$\006\034"
+	.string	"\006\303\341\266\376\267BH\265\343PM#\204\220-wJ\001p"
+	.string	"s"
+	.string	"o"
+	.string	"\237\366_\034\250\366\240\231\263j\355\001:\252\225<1\002\361\237\311\013"
+	.string	"\377\211\017"
+	.ascii	"\376s\315\326q\362\247\276h\347f\250G\255\265\265\"\034\226e"
+	.ascii	"Y\236\2227\235\265\177tg\315\337\335\300R\231\323\321\374\243"
+	.ascii	"\241M\216\211\225\316\206\252HE!\275\367\211\243\273M\232B\347"
+	.ascii	"\373\336\023,\341\310\351t>\303\225Z\253gN\307\341\006o\333\202"
+	.ascii	"m\t\366\034\021!\347\335\252\235\026?\035\35648\247\277\235\246"
+	.ascii	"sz\351\364\244\323\0070 \310\306\204\246ZsJ\037\325\351C:q\336"
+	.ascii	"o?\3140\3723\374\236AB\r\243\315s\222H\263A\334\025y\210\252"
+	.ascii	"\265\232\374s\004\361\337A\354\260\216+\343C\265\0239\211\222"
+	.ascii	"\324\232\020%\216j\255'\206 \376+\241 \017!\031\002$\265&F\207"
+	.ascii	"\007O\343$e\240V\304\177 \323\0303\340\277i\224\333\001.]q7\007"
+	.ascii	"\016\305md\303=\r\\\355\2674\207ot!F$\341\313\354qv\346\212\354"
+	.ascii	"\356q+\350]\003\374\316=N\305m\226V\355w\215n~\330f\351\020%"
+	.ascii	"\027\273;\0326\272\265\311\317{\003\020\2669\345\367NY\360L\245"
+	.ascii	"\0267\352\234\262I\232\271>\366U~\244\242\274=6\353A\377\310"
+	.ascii	"\205\376\325\311_\344D\177.\247\275\304\304^\337\002\024\f.\231"
+	.ascii	"\314\005\272%\205%\205\205\002\n\203\221E\233\265\260P\277\306"
+	.ascii	"Y\005\232\013\326z\211\301`\261W\353\305\305\005k\275d\263\326"
+	.ascii	"X\3001\230\026Y\213\026\213\311Z d\375\366\370\273\213J0\234"
+	.ascii	"l{\373\326\307\252\235e\355BM\223\253\026\307\266CV\265\016\230"
+	.ascii	"j\246T\023\217jWls\352\264\326Z)k\317{\211\202\253\226\265\307"
+	.ascii	"}8 \256\177\0043[=\0050 \220\002\031\313\361\345X\215f\021Z\363"
+	.ascii	";/.\244\317\252+\2501\347b\221W\337*VJ\271v\\\211p\251\226\217"
+	.ascii	"v\362\251y\232\002Y\321\211%,\312\261\274\307\210\314F\230\354"
+	.ascii	"<\230o\367e\205\013\013{\233k\327\220[\361\363\327J\210\251\030"
+	.ascii	"p\242\245\341\"\207\f\353\250\306\025 \036\030\\\006\363\315"
+	.ascii	"\013C\305x?\"\235K<\001"
+	.text
+	.section	.gnu.lto_qPercent.27.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\035\t"
+	.string	"\306\221@:0\345(\035\r\360\247\233\210\274\005H\027\212\352@\266Hav\314za\210'\355\356\375\257\177 \3335H\231\f\333\177)(\224\3055\003\026.`+\354A\303\316\330&D\312\224\002/"
+	.string	"0"
+	.string	"+"
+	.string	"\034\027p\326\361:\251\331\335Xp\004x.\177"
+	.string	"\317\351\306UO\225\377\222o.-,\260\330\352\031"
+	.string	"\261\273NX\f\343\326\333V\260\375`[&\2603;\314\314\256E-\300\276p*\036\266S\366\306\206&\235L\373#'I\375Cy`W\006\222\262\273\f^\0208\307\331l\373!\027IY\225_Y3\301\275\002\257\251I\343\2429\346(\250zM\024\327G+k\336\3106\001\330\337*U\303\376\266\232a;\275\375\373U\323\251\351\007\036}D\037QD\203\203\307\240\342\016yL\022'P\027I^\327y\241H\232"
+	.string	"u1T2EO\202=\212Q)\236<\257\0247\337\336\233rX\332r\352\246\177\321X\001\013"
+	.ascii	"r\311\"\3236\030\001,\334\223\246\035\256\211(Yh\023L\020p\302"
+	.ascii	"H\265b\022&\031"
+	.text
+	.section	.gnu.lto_qMultiply.28.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"=\n"
+	.string	"\266SG?0\211*\035\200g\234E\213\341x\313Qi-\342\037\225!\340\340\201\301\322v,1k\261\262\200\032F\r\362{\230\020\027\0324\314\210\b\"F\3031\304aY\354KCq\323\272\037\367&R\246\0245"
+	.string	"6"
+	.string	"0"
+	.string	"\257\023 \331\313\017"
+	.string	"H\f  \025\233\260\273\233\303+\3610\017\021\017\265u\357\351\371?p-\002\003\t\252U\351\271\200\261\273N\325*\344\326\333\226\260\235a\277\022\256?\200\260\3731\253\260\016\240\002\227m\222M\261c\353\242y\230g\270;\202\340br\030E.\231\366\013\334"
+	.string	"\351\237\207\031vY\257\004\273K\341\211\311\241E\263\355\0071UUc(\031\324\243\006\234rfM\257\331 %3\345\314\024\326&\005\373+\245\226\330\327VIl\247\343\277\037\036\366k\232VM\247\246?\271\004\243\016\320\307\003\335\311p2\034\215\n\013\314\003\307\275\301\2106F\032n\373t\034\327m\266\217G\303m\233\220h\303D\270\003uB\333\250\353B\033\345\333;\252\305\244'\253F}\303\275 \017"
+	.ascii	"r\311\"\3236\030\001\f\367kj\036\004\013f\310\256\211\321\264"
+	.ascii	"\330#\013S\tYR\250!\340\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_qConstruct.29.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\355\t"
+	.string	"\026\223D<0\305*\035\006\335\336\345\355S\251\272\315\007n\034\344\227\322\333\030\013\313\327\220\202_\203\220\200\252;\202n\303\b`\314\256JAAT^\240#\bKJp\370@\212\372\353\336D\312\224\0024"
+	.string	"3"
+	.string	"."
+	.string	"\257\222M\332\367\321\212 \"\253X\201\335\3354\317\304C\355\b\361P=nz\232\374\233\\\023\320\262\302j\235\236\004\020\273\353d\2652n\275m\005\333\021\3663\001\232\376\205\301\365"
+	.string	"\004v1f\262\005"
+	.string	"SBl\227l\214\035\027\306\362p9\204\0036\232\366I^R\372wa\270\253\361B\331\335\215\027.\207\006i\333w=PU5Vp\253\304k\352U\262T\316\254\3515OV\007P93fc\323\200\375\235R;\354k\253\034\266\323\361\260\037\376\3735M\253\2463]\b\244\016u@\035\220D\203\003\347\200\263\350\324\037\316h\202\344\341\266\316\3438\357\263u\024\036n\373\210F\033'\301^EH\264\221<O\264a\276\275\243jP\232\322\250W\215\004\020"
+	.ascii	"\204\231E\246m0\002\2143h\260\002l\351\317\361\\\303\243i\001"
+	.ascii	"G&00\f\fA\241\346\301]#\325\212I\230d"
+	.text
+	.section	.gnu.lto_crc16_ccitt.30.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`,\003\325\027"
+	.string	"\206\255\232G\260\230M:\300S\036\210\376\221\2207\342\305@\016\320\344\377H\031\303\t\214\203-\004\202M\263%\352\2367Ax\355\216\265Wz"
+	.string	"d\351\003\377\007\375\007\247\350\027\017\334P`\235\256p\320\254\t\036\354\326\b!{K\231R\210"
+	.string	"}"
+	.string	"\210"
+	.ascii	"\240\214\352{|\226c9\347Q\017!s\2022F\340]"
+	.string	"^\307w\3408G\301\030C\034\020\036?\341\2249\301\027\200\013\340.\365.\356ra\330{\004\357Ns\356u\234\214\2539\276\322#\016\247\033\320\247s/vBCK\3764d\">\200\342\004\305i\327\240\217G\273\032E\347\210.U\037\321c4\220\304\005\023\326\367!\0220r\"\261\372ztO{\002\247\032\320Wt\355h\346\234V\240O\304\235\272m\025\266)\330K\023\267\247\251Q6\250\243\213d\377\001\024\037\032\336\027\266\353\245\345\022\325\254\226\317~\226\203\377\352\341\255\372lv{\253\356V\315\251Z\252:\256zU\255\252~\200\0014\222T\2202g\210\233\225\211D\022\231\361\360\267/\217\310\274\366\245\225\264\311\330\247\371L\367\201\363\320F<\235!\257\006\344\307\2239g\314\245'x\2270\361\376\022\216\275\262e\020%3h\200s\260\200wN#(\t\336\245\f+\212\276'oiv4J\213p\255\377"
+	.ascii	"\227\332\326j\223\217\025\236\023\nb\311\306\023\371\322\355"
+	.ascii	"\313j\023\f\213{\340\270\355\366r\271\335(\n\036W\356S\033wC"
+	.ascii	"\226\255\304s\004az\212\036\270]\031\223S\217Vqjw\337\204\305"
+	.ascii	"6bkBT\206\254c\376\360\021\216N{\264\321Bm_\313~v\230\035\215"
+	.ascii	"2kY\266e\257\364V\323\017\221.k\255\336"
+	.string	"m\204\373\352n\350c\205Go^\355\367J~\256\354\350\315z$66Zs_p`\301\201\005\f\013\032\314\264`2\330\0326\303!C\207\232\233\227\206\330\315M\f\366\322`Ss\363\202\3118\274f\b8\266\341\202\354\325!\026\223\275V\340|\354R\353\342\262\020\216v\226\307W\272\312\266\302[$wP\234kO\273G%IHc\256\332 G\316\363\224\334\270\242-\233\262_\273j)@\365h\225\024)\325(\253\366\341\343\234sv\213\344'\321dk\217\224$#\276\254\267A\266k\037*\270j]{\037\243\323\376= p\002\241\252\243\007\004\263\200\265\006Z\200hi\211\004%\373n4.\342C\320\314W\232\267\n\313P\207]\241\220\343\215\314X\304;\242\2515<\344\251\365\n\324z/c\301\222W\320^\312w\240\216\222\262aZ\214\3621PU\025\340(wm\214\375*z\202?EY1>\271\006["
+	.string	"4e\177Um2v\2101\336\236\233Y\027\254m\023Fj\002\256$\001A\r\f\3779a\n\006\202\206"
+	.ascii	"l\246\216\343\345\006\331\257\361}\255\323\232'"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.31.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`H\006M'"
+	.string	"\nH`\017I\220XN:\305\2151\276w\236\215\0337\244\270\202\207\370\027\321\251\217\277\376\241\276\316\366\335\304\366\247r\312g\235[iOy\350B!\217\006\202U4\321\034\334\304\244\036d\371\307\216g\353rK\246\3628\335\032\221\266\267\334I\006\346"
+	.string	"\326"
+	.string	"\342"
+	.string	"_\"~\207R\270b\221J\332\275\307\240[\256`\203\276\232\344]M\367\032Qq\356\323\f(\n\346-P-\343k\312\374\343\2154\375\b\203\371\356^\032`\"\034\315\312\305G\351\271\234\330\336{\325D\354\336\243\217\017\230\267\337\372\220&v\242\307\033R7\244\031\261\313\314\275\307\037\316un\267\3649\267\333\266\301\346M'Z\217\347\\;]\227\303\231\345\315\326\246N|\241*\247\t#\211\353jY\"J\307\321\244\\T!\265\264'G\ni\216\t\324\230\262:\256\226PRZ\216&\325\242\n\205\001c\365\262\323\242\361\211\2325\246\252^R\375\2263R\335\326\002g3\274\334\030\207\265\007c\212\n\235\261\004\255e\017\372\352\2015U\365>\362\026\207\2250XSV\247\245\204{/S\023\306\251s\315\231y\0133g`\266m\001\374R(\306\0137\r\346\037\237\237\347^\017O\216\362N\216\262"
+	.string	"JY\207R\016\220\243\234\303\333\341(\343P\312"
+	.string	"nl\236\344\372s\377:\343\356\365\233?\362\227\007;\333s\235+\245\334&eZR\376\200\035\262\263\rV\356\215jCs\257\330';~\376\311\377\353\007{e>_\354'\277\214u\334t2f\340\231\360\237|\254\311\214\tr\357\3255\035\312"
+	.string	"\363\362(\275\230Da\006\r\200\2072@Ai\206d\f\346m\322\274b\346\020if\217>J\237\004\236\313\311\202\031\325\205H\332\255%\363]\354a|'\366\3641\337\t\360Mx\314$!e*A~\245\335{/<\f\310\254\273=s\023\177\311\221\254\263P`\"\352\255\302\271O\310)<,\230\267\266\312\307\034>\375!\f!m{\f*#\332O\331\363\033\270\361\272\247i\330\020\215\260\005=q\344G\332\215g\247y\232\206\001\311\370\207\233\200\336\351\023Y\350\264\200n2\b\036\240u\372\274\016\320\335us\256\270\020&H\316\354\207[N/!\231\362D\325\230\3279\375/D\266\024\255\004\352L\262\006\375\347!\\\005\313^\177`]\343\256\237\304\351\332\273>\331waD\026"
+	.string	"\032\247\231\022\331\202\347\261[7\200\356\256!\232\223=G\326\206v\307~\024,\326\260\334G9\245k\\[Bw?\r\221\215o\306td\346\340\213\270\335\322\256]E\253\2323I\205\302\fy4\323\263\b\256\377u\240w\331\270\246Y\206>\204\264\215\315~\367\027\"[\220\2661=\267\312>\3305\\\005\351\032\323S\013\355\3225\346\243\220v\026\007C?:\242!^\224d\024\242z`\352\220d\004\3426\3044TT\331\310A\221\203\"\016\013\032$\330\021-\0215\023%"
+	.ascii	"z`\032B\372%)!!)\021\375\222\216\206\220~DK\300_\202\036+\205"
+	.ascii	"0Z\3721))-\375t\307\340k\256\366\315M?\270\n\266\220\3519\246"
+	.ascii	";\333b\303\331\364\221\307\365\330jB\313\266]d\\Ms\245\271\256"
+	.ascii	"]\304\265E"
+	.string	"\276\022\301\272\\\266\017\366\bc\324^\344\252\311\353\032\233>\330\202\333\266\351\017}\374P\025\251\351s\235Q\016\024D\376Qg\362J\220\256\2351\030\327Y\\r)}\372e7\317hAu\320{]\344Z\376\364\311nf\001\302\326\273\346uQ\312{=\201\313\023U{q\032\321x\375d\257\177\326{\3575;\213\257\345u\353\351gi\351\260<\375\323Ef\237\376\211\340\275\016\200\200\250Q$\243\030c\310(#4\201\310l\232\306`\002\231\262\272\016\020P\251f\223\264\006\004W\331\234c\275r\202@\224Ic\276d%rB\225\006\331\021c\316!S\355T\341\200\341\330\344zW\343](\206p\273\206\206<\276\356\303BFR\2201\231\271\r\322\315\220G\270\202\243\3705o\275\017\361*\035\344\227SP\307\373\272\312{4\237><\367\325q\327B\213\202\017u\263Y\364\007\265\322\202\025\320\021\353UO\237gu"
+	.ascii	"\250\340\334[\004\223\013\037\352\t\317O\302\337\3178\241 b\274"
+	.ascii	"\300\232\274\001A\221\230\2056Y<YA\215\374\204p\352Z1\003\324"
+	.ascii	"(\212\302\366\317\347b\370\305J\n>\343/J\343Y\005\024\tb\214"
+	.ascii	"H\026L\357\002!\317\372\002w!\320\321x\253\306\322\211\314f\234"
+	.ascii	"\b\363\234#\260=\350\021\342\352\277p{\007\005\375?\271\304W"
+	.ascii	"\363\013\351c\212\031\264\243'\216\334\020h_\323\312\223\371"
+	.ascii	"\362\245s\252c\352\375\017"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.32.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\340\002]\026"
+	.string	"v\252\222K\320\360(\035\002\022Gz\323\022\240\022\356\372\220\243H4\033\007\373\341{G}\200B\004\354\tN\311\322\355{\214L\313\352u\305\\\306\346\314\177y\021\206\037F\251k\370\233\230q\214$uTHU\203\316lxZ$\204\220-e\222\001\202"
+	.string	"w"
+	.string	"{"
+	.string	"\345EJ\242\305\374\336l\273\326\233\035\025\265\376Z[\240\274\210`\004fg\377y\250\031?\034\335|\226j\375\271\272\303\226\247\277/\311\263\227\344(\322\346\331\336wZbh8\243\213yII\232\034\214\027\345,\320\222\244\031\027\016<\343t5&G\330|\334]D\351v\247t"
+	.ascii	"\021\007\031*\235\004\352q#T\301\324\311p\037x\003C?3:\2333i"
+	.ascii	"Rk]\236\321Q\370r|w3\354\356\311.\327\b\267]\215\207\313\302"
+	.ascii	"\241\242\312N\273\277\030n\336\356K\222l\"\266svY+U\312<\317"
+	.ascii	"\217z\357\347\370\371-\311\367\276c\363\212\315K\231\267\231"
+	.ascii	"\227\233\367\035\0369\"\0076j\255\031>U\027\"\213\020?\377\335"
+	.ascii	"S\240\326\376\267\007\256I\203\255\237x\017\314\317\r*cr\345"
+	.ascii	"O\212%\244Z+\310\305eP^\374x\200\361\"=\200\361\342wav\315]\332"
+	.ascii	"\303# \306\202=6n\227\325?C^6\253o\2739\360\327`3\256\t\215\235"
+	.ascii	"\270\305\250\372\t\214d\253\232\203\266\247\032\023O\350\321"
+	.ascii	"A\022Wb\257\232\203\r\3762\322\026\373\267]7\355V\n9w\367mOd"
+	.ascii	"s\267\217J\250t"
+	.string	"\023@g\021}\031\337\262SH\206\233\226\354\367\217n7h<\334\224\220F\377\3200\255\350\005\371\317+\3009\360Tg\003\013\223\314~\357\0374vZTs\264\331\017\006++\214\362U!I!Iyp`D\244\343%{\365\276DZ \270\240\300\\,1\030,\366r\261\254\240\300\\/Y\213K\304cc\021Td.\227XL\3462\177\365\235\263KI\262S\251N\200C\353\332\336w\224pX6oI\243\221\325\007\276d\362\3210\310\313\306-\035\307\276\357\345\213\235\033l6\331\270\r\032\313>1\222\341&\f\302\336\231\235\266\354\237\247\265\326J6o\357C!\252\372<\037\b\272\n7 \200\002!\253\343\006\004\311\322'k\255\255KFP\b\226\247xj\272\207\331w\240\330B\b\361N!\353\342\347\374\204\232\271~\206r\214p\227\245\325\3632\n\222\274b\346R|\343\331P\034\316i\030\n\307@U}"
+	.ascii	"\353\335\361\274\240\203\210\257\200{\270\r8\262\356j^q\317\313"
+	.ascii	"\200\025\216v=\\8r\013\256\310\306\200Qn\266\315k]\202\005\274"
+	.ascii	"\231\272\217\227\034d\267\306\337\265N+\236"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.34.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\377\004\255\033"
+	.string	"v/\246I\300VQ:\264<j\273\r\261N\033I\234\222fb\361\2218\212\bDQ\214\034z\216\0253\274\033\2262x\263\341\320\332Ye4\241i\004U\327\020\004\311\tj{\374\311\245\236\3151i\344c\251\266}B\b!do)e\n\221"
+	.string	"\206"
+	.string	"\221"
+	.string	"K\257 \\\372o\322\353\337\315\233\r\034D\033d\221\202\376\235\005\031\211B\312\020\016L\255\225\265\364fk\276\245s\003|K\273\306\373_\007m\212\034\305\020\374\350lV\005}\271D\321\210M\201-\335N\244,[\216T\314X\022\301(#\006\213`\353H\205\214\ryD0\346M\255umD/\030\034\222\361\347bi\350b\347\004e)t\254\212b\023B\024\324\222\325-\233(\202q\217=V,\007X\025\330\252\265~a4\366\253\375\377\364\237\302?\215\004\334\265\267\n\202\215(\2507\355\337\333."
+	.string	"\346\3230\177\206\3712\314_1_\305\374\024\363I\346\217\233\333\213!\370\321\331\274\267\375\nX\003H\265\246\350\211\251Ft\311\216e\332\315-\377\373o\356\365eZ\335\311\277^\233\013\372.-\356\344R\233\0268\"\"f\325Q"
+	.string	"\342\324\n\227\332\030\341\374\2734\344\273Yu\313\303\007\026\250Z+\316\322G\370k\225*\016\"\233\0238\314{[\245\357.\326\n\345G\222Z\353\202{\003\013[\354u*mB\334\273\360\204\027\222 \r\354o\214\224U\211Y\323\330\265\323B,5\3558\341\211\037\355\257\277#T\351\350"
+	.ascii	"\213\244\037\341\374\272)\307hkX\252a\302\003\273\206c\204\316"
+	.ascii	"\376\234\333=i\023\232\372\233\335\263\351S9\273\242\204\316"
+	.ascii	"\251\002\320$\020\346\3366\361\177N\230\022\343\250'\035m\013"
+	.ascii	"6\273k\275\267\275\201q\230\177\267E\206\276P\251\377\027\253"
+	.ascii	"\025\226`\233\233:\225<\204\270\367\325\355\370\244\304\253\034"
+	.ascii	"\346\275\315\364DV\024?=;@\263\001\020\237\303\203\r\0176t`\340"
+	.ascii	" \207\006h\257\223\003\302\303O\006\036V\217\213\207\307\245"
+	.ascii	"\303\352\331\311\300\303\322\361\001\301\312)p\327\007\016>\254"
+	.ascii	"\037\227\313\207E\376\347mZ\205#H\310\231\246\241\351\267`-\224"
+	.ascii	"\352\032\006-:F\260?E\332\005r\314\302\257C\231\016{\246\327"
+	.ascii	"K9[\365\3302\315cJ\333\215"
+	.string	"&2#1\252^\245ZlU\177\270\322F\342E\215J\227\030\331\251\036\340T\316\204\270'\204K\225\233\204^\317\nMl\262\t\340\304\016{lvR\332j\242\360\304\336\\o\250aP&\021\222\031\031J\222\244 \351\260\002\2311\343\006\021`1\203\310H\nRP\310\316\0326I\007r\222\004)\356?\310r\235v\304P\266\313]*'\025\252\032\270C\r\024P\304\027\320\035\366\227aMm;#k\036\255\250\351\331\016\273|k2,\352b\323\225\375\355\220\026\251\031\225\310A/3\nt\347\215\334\351,\"\352v8\346\021\242\376\356L\222\317\022\350\t\301D\257Z_\202cj\302\264\320\275[f\306\210B\3236\377\002\313\345\017\027\211\022\224\307\246\335\374\327\334\315\006\242\f\225\003 \335%Fw\240U\177\224s9~4\240\006\006k\027O\326/\217\370\222\242\200\025\2000{w<(\036\270N\355D\344\334\247"
+	.ascii	"\260\233\016\213\343\253\325\322\305ZNm\035&w*"
+	.text
+	.section	.gnu.lto_applyDeadband.part.0.36.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\265\001m\017"
+	.string	"\306\033dE"
+	.string	"\221(\035\354\031g\205\372\327\333t\2751\241\213i\021\211:{\0356\357\001\326g)\003\250\3116T\321\25721\376\n\251b\342\326\314:\377\377\357j\330\360\"\036\001B\234\203,\357\266\245\022\376\023\262\267\334)\005M"
+	.string	"O"
+	.string	"O"
+	.string	"\236\023\320>\345\007h\237\032\342\336\265)5n\236\377\360\322\304\207\231\352\323p-\252\276\325'\347K\221\236\335\335|(Q~|\253\253\354\260^p\340|'\362@\254e\306\303\307\225/\025#\310\267mdw\255\351pkn\273\263\375\300\276\215\340\377\r\304\200\207\335\r3\036\333\232-H\330\017O\366\306\017M\354\215_\n\240\300^d\034\234\376\362$\270\037KG\3069\036\374\3133\200]\020\257\230\335U\360i\004\232O\373)N,\266\375\023GabO\202\">\255\205\206J\250cw\271\317#(MJ\326\214c\310j\304Lu\255\270\f\216\312\216\263\300\021kI\325\203\367\240\342\214\243^U\337#\245D*\316\034"
+	.ascii	"&G\034\241b\305T]\266=\355\232\001&s\022e\336n\300\3308\023\325"
+	.ascii	"e\335\344\252\213=\017\336\362\340\255\207\375\361\001\242\022"
+	.ascii	"\b\202\b4\022i<\n\021\205\210\",`\360\0210\262@\001ta:\364!\221"
+	.ascii	"P\002\"q\245\216D\352B\\i\002\210\304\205L$\334\247\343\256\302"
+	.ascii	"\310\304\225t\235\211\333\330\216W\027\213\270\230REV2\3011\274"
+	.ascii	"T\250\352\324\025\333S\033\264P\232\362\303\177\300\314\246\006"
+	.ascii	"+ \340\"\242\353\006\"\317\020\002Sv\\s\256m\243W\266\347\330"
+	.ascii	" \030w:\363\203\016F\r\356\t\2077l\350\263x\201\337\003\n\257"
+	.ascii	"\306\030Y2\344>\242m\365V.\310\335\200\030\303I|\022\363\b\226"
+	.ascii	"_\307\021L\366\f]9\237[|@\231\233\022\233b\336\177\260\215'd"
+	.ascii	"<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\302\002\245\n"
+	.string	"\004\016\276\003"
+	.string	""
+	.string	""
+	.string	"\002\"\177!\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 $\177\"\200\200\200\200\004\002\177#\253\325\252\325"
+	.string	"\272\200\202\002\003\177$\004\177%\005\177&\006\177'\007\177(\b\177)\t\177*\n\177+\013\177,\f\177-\r\177.\016\177/\017\1770\020\1771\021\1772\022\1773\001\023\1774\370\354\254\024\1775\200\200\200\300"
+	.string	"\025\1776\350\314\2313\026\1777\027\1778\030\1779\031\177:\032\177;\033\177<\034\177=\035\177>\036\177?\260\206\361\037\177@\354\363\203\007 \177A\001!\177B\377\037"
+	.string	""
+	.string	"\200\200\200\003\002"
+	.string	"\242\006\003\003"
+	.string	"\241\341\365\321\002\001\202\007\003\005!\004\001\304\001\003\b\001\002\001\202\001\003\f!\004\001\244\007\003\017\344\006\003\020\302\n\022\033cnv\003\021\020\302\006"
+	.string	"6 "
+	.ascii	"\003\221*m\003\320\203\354\273\331-a_cc=\223Y\250\031\203\031"
+	.ascii	"5k+h=\314i\251\215\202\221\354E%N\035\355\003!!\232\242\370\306"
+	.ascii	"o\3407\220\323#z\370F\370\206\370oH\210i\204g\366*\274\202\361"
+	.ascii	"\033\277\361\033\277\361\033\277\361\033\371\306\376\217\034"
+	.ascii	"\002\254z\fet\224\177\201\0057|\203\177V\002\340F\035\210\b\336"
+	.ascii	"w>[g\f"
+	.text
+	.section	.gnu.lto_.refs.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d7bcd7278ca05642,"e",@progbits
+	.string	"(\265/\375`\223\036=\212"
+	.ascii	"\212\340\2701Q0R\312I\007\371\272\256\273\357\376\255\375\352"
+	.ascii	"\247\236\315\275\313\034Q\031h\331]gDH\326\271\261\227]\375\316"
+	.ascii	"\346Y\242o}\036(s[u\3258\226\266\211\360\335U]\020\227\252\210"
+	.ascii	"\210\"\210\312,\273%\240\254\210\"\312\2742\363\377\307\220H"
+	.ascii	"$[\312\024\207\002\002\003;\003xl\307`\030\356bQ\225\341;~\262"
+	.ascii	"\335\201V\2603PL5"
+	.string	"\255\373iQ\343\344(\266>\205\030\247/!\236\232r\034\346\320\236\245\237{C\t\007\035\317\361\030~\262\034\307q\264L\335\327\232\236\251\254\347\255\365\274d=k\255\347 \353\031\356\320f\016\320nf~\354u\312nB\347\267\021\352r\312y}l\332\226d_\247\375\343\013[\n\006\n\333\032\260\2655\315-{M \330\013\267\361\223\331\230\313\271\013;\277\330\370\0076\315{\257\017\022+\211\326\232\356\260\216\365\034\265\236\227\353\031\307\372\263\026\376b\037\254\262\211y\315\356u\212\370\275\201\321\242\327\251\032\0019}Jg\230tzN\256OAF\225\306`\277\320\330\241\374f\306\315-cR\374<\305\312\327\370\315\354\203&ux_b\207\366\340\334\333\305+\355\336\213\306W8\013C9\215\237\214\205\253\234\315\370\354\251\363\336\245{\357\331\371Sa0\306\302a\207\232\260qo\227+%\302\354\236\321\275{/\004\020@"
+	.string	"\001\001\020\374~\004\321%m'}\f+3\231\204\032@\n\353\316\001\310[\301\017X?\300\372\237\3658\353{\375\033\223P\021`\022j\312#\324\037'\223PW\036\241\306\b\376\214\305k\306\317$\004\340\332\371-\214\377\r\374l\326\264\300#-d\261\270\262\036X\331\fz\244\"\330\321\361"
+	.string	"\3470\220\300\332\004\3047L$\242J\0210\374\357\263<\234C\025\275\367\374\366f\356\277\334\351\376\337\375\257;"
+	.ascii	"\177\363ua\203\213A\313\001c\327\371\333\313\004(\377\255\374"
+	.ascii	"\307\362\037\372\037\3559\177/\371\237\345\351\337C~V\361T\377"
+	.ascii	"6\272\375\233\307\177\025\234~.\373y\3547\177+\275\377\346\341"
+	.ascii	"\353\337I?\007\221\231\360\337\337c?{\375\314\365s\363\347#?"
+	.ascii	"g\375|\365\263\325\317R?\353\3709\352\347\345\317M?3\375\254"
+	.ascii	"\3749\3713\362g\035~>\372y\3703\360g\031~\216\341\347\026~F\341"
+	.ascii	"g\013~.\341g\020~\356\340\347\r~\306\340g\t~^\361\263\320\317"
+	.ascii	"?\377\337\376\343\375\007\342\277\332\317\017\374'\376|\342\347"
+	.ascii	"\005\376\233\370\031\201\237\017\370y\200\377l\376\253\360\337"
+	.ascii	"\204\237\005\370Y\304\317>?\363\374\254\3633\316\317\352\317"
+	.ascii	"\377\337\346?\337\3774\377\363\376\233\371\357\345?\213\377>"
+	.ascii	"\374O\341\277\007\377\333\376+\020\215F\243\377\315\213\337\342"
+	.ascii	"\360\013p\025i?yr\346\3411\237J\267uU\243\323\333\273\276\353"
+	.ascii	"\326'I\322M\020\356e'\363iy\247t\2340\340v\320G\032\311[I3y+"
+	.ascii	"\351\246\210\273\274w\352\332\2736\251\264\275;Uub\347\251\214"
+	.ascii	"\221(\235v\363\320\235{\277\356\275&\270\312\0308-\235^\017\207"
+	.ascii	"\237\240E\261R\266\276\235\254\377Y\275\310\345\2757\352\306"
+	.ascii	"y\227J;|\303<lY\201{\347\356\315*\202fu\002ER\035\201\313\301"
+	.ascii	"=v-!\241D\\\347]*\311\202\034\225eA@\211p\336\253\001.\231\220"
+	.ascii	"\253t\006\201J\231\267\257\363\362]\n\002\025C\351d.\225N\346"
+	.ascii	"\361\347.1\217\367:\241~\224f\310#+\311\202@)\311\230P\"\356"
+	.ascii	"\322=^2\344\325\272\304\204RzaB\375(\311\220P\312\245 P\"\206"
+	.ascii	"\024\321\362b2\"v\306p\312\245\213\303\251\n\271\374yS:\231w"
+	.ascii	"\356^6K\336\245\002\367V1\227sH\036\234\246\364\206C"
+	.string	"\t\013\222\311N'%,\346]zSn1\357\335Rzq\235(8:\337\256\026\277\035\205T\335\246\344\275%\234\356=\362}\273\367\036\357\275\277e\225\363^\037?\312\246\223\323\275S\0048\335\252\243Z\362\3366\033\223\006\245$\303b\n\251=\311\232\267\206\363\310\315;\027d\271\222\035\303n\323\231\265\t\225#\357~\361\f\021e\b\276N;\253\211\360\363D\027\361\301\021\342\214\225Y\247\357\036\326\363\t\325\347\204\332A\032\213\237\016\264\220>\322\346l\254o=;\240\332h\224\035P\233i\343v\350p\202fm\252\256\342'P[\235\335\372\307o\220\316\353\314+\242\004\325\351\017\223P\317d\326\035\356e \225\243Q\006R{\312\362\320w/\262\247\272}t\217\367\324\235\314\t0'\340\363\233\353R\"\325T\3122MA\003\355\264s\264\016~\032\320;>A\005\267G1\347\327\275N\237\235\247\247#L1\353\331"
+	.ascii	"\225\243l@\024T\212\271\263\246\223lg\214\0257\275\345\223J\345"
+	.ascii	"\2421=\251ae\312/8\234\232G\023\223\023\264\tW\264\351\006\216"
+	.ascii	"\017OP\240\3348\224\247KV\227\027\223\215\234\251\252\253\261"
+	.ascii	"N\3376\314,\321\"\246S\366\022z+}\302@\365\224\324H\356\264="
+	.ascii	"\201\352\344\337K\335\203O\025\024\315T\247l\202G\250\215\024"
+	.ascii	"z+\365\224,\245\221NU\036q\354{\326\306\305\245\323\367=\363"
+	.ascii	"\255Ge\227d\247LE\350\034M\205\244yj2D\2332&$\217N\333\360\355"
+	.ascii	"\244\365%\245\372\370z\t\216%z\235\362\036\257\341\347\327\230"
+	.ascii	"\315q\226\234\227\214\265"
+	.string	"\270\034\265\274\2544~\321h4\312_S\223\206\247H\324)\326i\232\237\321\260\036\303\341\244\321E=\351\264\027\340\021g\340\2508\365Pv\372s\236\031\2358\273\251\247N\031\017\210gI\356),m\r\202\311\330\260%\ta\252\002:uf\274\302tj\205\364\225\333U\033\222\274U\335\002\002\304^\365\021-\275'1(\363\366\252\201\b\361\261d\313U\027;\256-t\253\n\265Sv\312Z]\361\201\2276\241\300<\331\252[\253\236c\223\271\254N-\025\367\235\231\333\203\353\324\372\350\250& ii\235\332\036\035\305Zu_\262\264\255?,))>\235c\222(wU\326\0340\035:\300\374\202HCF\314\311\2723\306F\331(\273\024\201\356\212\224\226d\021 k\217\026\216[\034v\211s/\235\224\2361mpL\354\323\355r\255afE\007\032\223-6\270:\375\315\215\325g\331\324DG\025\326\365C\233\275\025"
+	.string	"\"\226\3112\331\244\bC4\327\037|rzqk"
+	.string	"iVi\2256)B\235\336U\025*\037V\001\226\354\322\355\222M\002p/\0216\274\030\312L\321\262=\334&Kx&9r\037\017\225\246\334\026\260U"
+	.ascii	"4\321\250E\312!\3019\343\265\026\305\036o\221w\266L\356\251\324"
+	.ascii	"\251\275mw\263$v\247\324i\272\264\202<\241\254\003\234\345\345"
+	.ascii	"u\233\265\214\232\267\205\007\234\232w\233w\337\016^V\326\r6"
+	.ascii	"\315G\206\255-Ls\355\275^\243\n!\245fHj\304\001\234\350\361N"
+	.ascii	"MN\223\017\211\222N\373L\247\311\361\321\306\212K\032\275\021"
+	.ascii	"{Nhh\030\017\250\207j\310\020&4\027\302LY\035\237\211\343\221"
+	.ascii	"%Mj%\340K]]\343\265\231\2519w\224y\343\335\361\364\220\327\303"
+	.ascii	"\224N\373\256\355p\322\202H\326\331\341%s,\265\035\031\267\033"
+	.ascii	"=\264\220a.X\242qx7V \033a\3024\335\020,7[m\254\334\315\275\351"
+	.ascii	"~M\350\216I:m9\313|B{t\332B\350\370 \222\343J\247\035\367\265"
+	.ascii	"\225\357\fLL\247-&\275+\320"
+	.string	"\233\333\335\032n\275q`M'l\220 y{\303\361\016;\253$\220\236&\032$\3072+\020\337\227/\335&\202\224fg\221\262\023\302\266\226\240\002\242\275"
+	.string	"\321m8w\031\227DG\216HT\023\266w\033\024\247\314\223\246\022\264\265\004\327\017?4\227\270\247\346\215\363\306\231\251-o.>\027/n\257\323^\363\352\352\262\343\271\226X\313\222\245}(c\302\273SS'\230\007\233\035Qjo\037\356z\310~@\033\353\264^S\326'\225\006\025\013\262CMm\347\255\331\025\326)\032W\311\321\333bC3e-"
+	.string	"\312\314\254\257\204q\263I6vQ+\357+\320\036\263,6j\235\366\331\241\366,\356G\025\327Z"
+	.ascii	"tl\254\237<\245\001\026\032^K\311U\221\225\275\237k>_\315\263"
+	.ascii	"\270"
+	.string	"N\233\354\327\006\006\013\310Z\272C\315\353K\223\265\2004aa\335\\o\030\257&\003\331c\002%k5!\344\353_\r\266\3360\312\246\252\346jM\n\2257Xz5\327\203H\247=\345P\037\264\260\271#\266\307jBNJ{I\351&+\217\367\036\177\256\322]\031\274\036\253\261-%\034N\272\313ICQK\324u\260\325][\r\245/\363\336\346\357\211u\207\247\326\370Rf\203\353\r\205\371z\351\t\224]\007\177\201\002\251\250\b\030D2\016k\bJ\"\272\210\200F\022qX\024\001\005*\206T\254\240\021$$J*\n\022\207AE\244\244\240\240\031F\305\027F#\342\257\005PX\224\006oZ\030\2131\220n&@\032\252A\006\321\320\n\241\021Ht\2244\004\200\3218\f\006\207T\b\005\213A\035c0\251hD\"\032y\020#\347\206\242\243\241\261(\211E\f\034#Q\030,\nO\210\261\216PCR\n7"
+	.string	"\213E O\213\013,\250\240E\212\021\027XPA\212\242\320X4\004A\310\302\206\3400)\006"
+	.string	",\b\213?$$a0\bTeH\021\203\320\f74\206E#\220\205\321\b\005\242\242aR\r#X\020\3420,\002\302(\032\021s\204.\210@\024\204E\300 R\016\022\0218$\002\242`\244\002\222PXt!$\372!\032\r\215\300\241\f\341\007DE \021\021hLA\206\220("
+	.ascii	"a\220\b\034\026\201,\310\020\022\351\274@J:A\206\220\350W\004"
+	.ascii	"\n\213<\220!$Z[\024\2053\214\216T\242\240\013\013\324\231\200"
+	.ascii	"\b4\002w\220\214\2029<DD`\rD@\341\0077\024\035\035\001\003x0"
+	.ascii	"G\002\024\306\"\360\b\005\r\243\342\321\021p\2108D\022\361\340"
+	.ascii	"\260($\n]\254\247@E\004*V\320\370}\005\006\022` \201\372\025"
+	.ascii	"\030\b\ta\240Bh\275\n!\273\032\207&\020\2421l\3613\016\251\020"
+	.ascii	"Za$\016\223~\306\241\tR\030\211\303\237Q\247\205\220h\210g\006"
+	.ascii	"\360\006[TdTL_\004\215\303\243\033$a\221\013\"P\235\001,\332"
+	.ascii	"\242\2211(\2241t\324\002\307\005~\201a`\343\213\0227:\022\026"
+	.ascii	"\203\214FF\305 \035\342\020\f\2134$CHdD\372]h\001\221\005D-\204"
+	.ascii	"*@!\342\027\\\340\001\002+\230\020\302\032D\201\364\302\b\204"
+	.ascii	"\021D4\202\001\303(\030D\034\002a\004\005\213HA(\200X\260\230"
+	.ascii	"!$\022\025\031\r\301PS\230!$\016\301Po\263P\300\304b\321n\263"
+	.ascii	"\334ym\026\237\276{\221\314\t\264\023,9\206PS{\306\321h\337\231"
+	.ascii	"\217\222\214y/\322^\261Vn\317NC\023V\223j\326\346f\315WR\207"
+	.ascii	"\255\002\345K\016m\351DC\267D\313\2265\317\242f\310t\232.;\370"
+	.ascii	"o\247\334\216M\351f\343\261\363N1\217fVh\331K\303\265w\225U'"
+	.ascii	"n\216\260Q\331\321\251\r\273\025\223\213k\023\033[-\330\255\223"
+	.ascii	"*G\335\026\225\365\267T~\234\235\"^\300\344u\255W\233\254iVW"
+	.ascii	"\227\365\262\303[\263\306\236U\244\334z\265\021/Tjc:\265Q\332"
+	.ascii	"\210\n1N[\262\326\224\255I\023\313U\307f\275\342n\\yr\313\205"
+	.ascii	"\303\204\317\312F\247v\253\207\220\001ac\323\251u\3622\306\245"
+	.ascii	"\256(Z*\230\247>69\326\233\246Mb\231\330$\266ye\n\236\217\224"
+	.ascii	"\025f\227]r\333\354!OLj\356:\265Jz\210\025\023-t\006\360\324"
+	.ascii	"\241\211q\353\364j\215\365FL\221\"\366H\224\235\344\032\2559"
+	.ascii	"#\267G\256~K\364\234s\235Z\255\006\202\023\346\326\303\253oU"
+	.ascii	"\235,\226\305\262YuI\232<rN\271\272!\267Y\001\202\230\250b\321"
+	.ascii	"0H\024\0212S$\"2\222\202$\215\001\022\013\020\006CQ\242\365\322"
+	.ascii	"\003\022 %9V\"\305Fh\244I\226\003\020\224\016\236\024Dk2\373"
+	.ascii	"\240)0}\3701\364\335\331\250\366\246#Y\344\307@\370\177t\213"
+	.ascii	"\003R\026!\324\354\311\025\250q\236\367\243o\203a\275[8\322\002"
+	.ascii	"\t\353\255\265\317L-\035\362\261\262~\234\307\202\3612h)\\\222"
+	.ascii	"%\252\2774\324\352\372\331wbs?\276+\340\360\33785\270\276\346"
+	.ascii	"\332\003\341t*\272\003-2\305c+Q\323\342\205\022\223\327}\240"
+	.ascii	"yK)H\2134\237\305`_\247\352"
+	.string	"\244U\363\211\337\005L&\3248Ku\277;\2701\205S8\257z~\376e\240K\023\356R\230\036\315\002Js}\235|\256e\016)u\317\322\210s\343q\004\304l\212;^\364<h\274\b{O\255\303\333\007KW\256\335\265\016\370\305\320\372L\306\236{\263\2206Y\004\346!N5\2506\304\233\365''\235\314\037=_\326qK\320,\225pD\314u<k\310\277\356\211A\337\037\350\317\267p\374\363B\302\002\034v[\277\004T$\021\203O\213\237\313\320\177\264J\271\376;\312\t\307I\313\026'6\305_\375r\265&\024QFIk\347\232\233\376\327\002\36685\207\370\275\305\3475\313a\353J:\3270\372\301\036\266\356\357T((\302\350jj\214^\263\002\256W\200\250hO+K\237]\2655.\356T\303|\244\321\363\372|\336$\200,\256Hd\222\274\250\276\036Ps\371,H\241\263EqjU\364\213\270\""
+	.string	"\261\2048Z\274\224.\272p\265\343\265^.\356K\036(8\005\310\244*\214\204\242\260\316\311L\301v\367?\023;eELE*\316\221\212\343\2019/\303o\336l\330n,\217\333B4\306O\231\251\354hZw\244Q\241\f\2302D\251\236\203\214\232E\221,\305\213\304\203\357-r\031\021\376A\246\024\305FN\316\301"
+	.string	"\246n?U|\226\332\234\352\347?H)\303\003Q\200\356*\022s\327\221\030\177\223oM\201Q>l\203\355\245\277'\t\317\357\210\224\224Z\247\316\350\224\210\337\343\342P&\350}\210\252\035\335\323\032\005$\021\356\t\204=\201\310\204\2074\035\304\225\302[\372B\342\tj;\203\021\356\316\254\257\370RuR\323\216\301\321\203\213\234CT[\200\235L849\230\366;\347q\204\323dL\006\223\206*\205eTv\004F-)C\t\022\271\201\304!\2220s\341\360\212B\343\231b\244\215\004\3107Q|5\027\210\212\250\016\201H\017\301pJ\261\223\267\263\2428\026\376\314\241v'UP\f\217\224\021(=\3236\224\234G\002Kx\"\2309\373W\315\267\007\376\021\f'\t\217j\264\376\327\270\312\322\023\003(\352\2239\375\205<\373\354\204\"H\264\006"
+	.ascii	"t\337\237)\030\240hUM\244 [\r\272$\252\342ON}\270x'\252o\235"
+	.ascii	"\3151\202U\020\0057\177^\024Hy-\277I\f\366"
+	.ascii	"\214\336\226$\341&\332R\253xQiH\220\333"
+	.string	"5\233\207\300x!v8R\331\001\213\250\013\340\337\363\330\337\304\032\\\327)J\222\220\307\005\016\227\037\3764_\362y\206A\342\351\354\361T\246\256e\026\270\023z\264\177\375&\245\366\005\001\240\311\202\245\262v\264b%v\224+\200\3609AcT\344\334H\345\350\r\351\037\225\267.\257\003\366jt\2571|\275\343P\242W\341\336\214\021S\035j\013$H\242\250\312C;lo@\354h\215\305\205+\340\201W?\026\334\031hv\225O\330\252`\224}SH\201\004I\n\006\322\241\273\031w4w\013\361\366\256+\024\331\205\371K\324,\020\373\356\226p\207\240}:\241^I\335Q{\300\243K\276\037y\353?\236EV^\207o0\345k\370%0\276 \251\314\313F\236\265\033\314L\230rk\366\301\276\217\032\214\037\007\177a\367\331\376\251\364\2175\204zZ\374\3268\033i>\320\335\002\003`\253\026.\377\367\331\203\f\237"
+	.ascii	"\324}\220\377=:\213\221\377%\320\323\367&\226\2325z\333\363\346"
+	.ascii	"\335!\376\006d\017\027\335\270\271[\3466a\no\303{\202\237\200"
+	.ascii	"\371z\355\317\264\307\324\351\201\356\034\345\377%\335\241<\024"
+	.ascii	"6\301\033\177\354\210\037\301?\206\317\323\355\223\314\300n\306"
+	.ascii	"\021\310\317\207r-y\345W,jN\257L\231\353\314\024^\323)\017\f"
+	.ascii	"5 \232\326\256n~\372\254\001OGe\245\375\035\330\n<\021\376\254"
+	.ascii	"\333/\200\374\251\3472\333\337a\223\376m\235\306\247:^\350\366"
+	.ascii	"j\037\340\201\370J\366)\315t\316\205\030\226\\\340\\+"
+	.text
+	.section	.gnu.lto_.symtab.d7bcd7278ca05642,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d7bcd7278ca05642,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11437 @@
+	.file	"printf.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 4 "<built-in>"
+	.file 5 "./src/main/drivers/serial.h"
+	.file 6 "./src/main/common/printf.c"
+	.file 7 "./src/main/common/typeconversion.h"
+	.file 8 "./src/main/target/SITL/target.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	printf.c.07f307f7
+	.weak	printf.c.07f307f7
+printf.c.07f307f7:
+	.long	0x812
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF1660
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1526
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1527
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1528
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1529
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1530
+	.uleb128 0x6
+	.long	.LASF1532
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1531
+	.uleb128 0x6
+	.long	.LASF1533
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF1534
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1535
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1536
+	.uleb128 0xe
+	.long	0x85
+	.uleb128 0x6
+	.long	.LASF1537
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x1b
+	.long	0x91
+	.uleb128 0x6
+	.long	.LASF1538
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF1539
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x6
+	.long	.LASF1540
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1b
+	.long	0xc6
+	.uleb128 0x1c
+	.long	.LASF1661
+	.long	0xcf
+	.uleb128 0x11
+	.long	0xdf
+	.long	0xdf
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1662
+	.byte	0x18
+	.byte	0x4
+	.byte	0
+	.long	0x114
+	.uleb128 0xc
+	.long	.LASF1541
+	.long	0x30
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1542
+	.long	0x30
+	.byte	0x4
+	.uleb128 0xc
+	.long	.LASF1543
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1544
+	.long	0x7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1545
+	.byte	0x3
+	.byte	0x63
+	.byte	0x18
+	.long	0xba
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1546
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1547
+	.uleb128 0x4
+	.long	0x133
+	.uleb128 0x1e
+	.uleb128 0x1f
+	.long	.LASF1663
+	.byte	0x8
+	.byte	0xa1
+	.byte	0xa
+	.long	0xae
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1548
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1549
+	.uleb128 0x20
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.byte	0xe
+	.long	0x277
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x13
+	.long	.LASF1600
+	.long	0x30
+	.byte	0x17
+	.long	0x29d
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1600
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x3
+	.long	0x27c
+	.uleb128 0x13
+	.long	.LASF1601
+	.long	0x30
+	.byte	0x1d
+	.long	0x2f4
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1601
+	.byte	0x5
+	.byte	0x30
+	.byte	0x3
+	.long	0x2a9
+	.uleb128 0x6
+	.long	.LASF1612
+	.byte	0x5
+	.byte	0x32
+	.byte	0x10
+	.long	0x30c
+	.uleb128 0x4
+	.long	0x311
+	.uleb128 0x9
+	.long	0x31c
+	.uleb128 0x2
+	.long	0xa2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1627
+	.byte	0x48
+	.byte	0x34
+	.byte	0x10
+	.long	0x3d1
+	.uleb128 0x3
+	.long	.LASF1613
+	.byte	0x36
+	.byte	0x24
+	.long	0x45b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1614
+	.byte	0x38
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1615
+	.byte	0x39
+	.byte	0x10
+	.long	0x29d
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1616
+	.byte	0x3a
+	.byte	0x13
+	.long	0x2f4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1617
+	.byte	0x3c
+	.byte	0xe
+	.long	0xae
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1618
+	.byte	0x3e
+	.byte	0xe
+	.long	0xae
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1619
+	.byte	0x3f
+	.byte	0xe
+	.long	0xae
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1620
+	.byte	0x40
+	.byte	0x17
+	.long	0x460
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0x41
+	.byte	0x17
+	.long	0x460
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1622
+	.byte	0x42
+	.byte	0xe
+	.long	0xae
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1623
+	.byte	0x43
+	.byte	0xe
+	.long	0xae
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1624
+	.byte	0x44
+	.byte	0xe
+	.long	0xae
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1625
+	.byte	0x45
+	.byte	0xe
+	.long	0xae
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1626
+	.byte	0x47
+	.byte	0x1e
+	.long	0x300
+	.byte	0x40
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1628
+	.byte	0x50
+	.byte	0x5c
+	.byte	0x8
+	.long	0x456
+	.uleb128 0x3
+	.long	.LASF1629
+	.byte	0x5d
+	.byte	0xc
+	.long	0x48b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1630
+	.byte	0x5f
+	.byte	0x10
+	.long	0x4a4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1631
+	.byte	0x60
+	.byte	0x10
+	.long	0x4a4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1632
+	.byte	0x62
+	.byte	0xf
+	.long	0x4b8
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1633
+	.byte	0x65
+	.byte	0xc
+	.long	0x4cd
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1634
+	.byte	0x67
+	.byte	0xb
+	.long	0x4e8
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1635
+	.byte	0x69
+	.byte	0xc
+	.long	0x4fd
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1636
+	.byte	0x6b
+	.byte	0xc
+	.long	0x517
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1637
+	.byte	0x6d
+	.byte	0xc
+	.long	0x527
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0x6e
+	.byte	0xc
+	.long	0x527
+	.byte	0x48
+	.byte	0
+	.uleb128 0xe
+	.long	0x3d1
+	.uleb128 0x4
+	.long	0x456
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF1639
+	.byte	0x5
+	.byte	0x48
+	.byte	0x3
+	.long	0x31c
+	.uleb128 0xe
+	.long	0x465
+	.uleb128 0x9
+	.long	0x486
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	0x465
+	.uleb128 0x4
+	.long	0x476
+	.uleb128 0xf
+	.long	0xae
+	.long	0x49f
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x4
+	.long	0x471
+	.uleb128 0x4
+	.long	0x490
+	.uleb128 0xf
+	.long	0x91
+	.long	0x4b8
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x4
+	.long	0x4a9
+	.uleb128 0x9
+	.long	0x4cd
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0xae
+	.byte	0
+	.uleb128 0x4
+	.long	0x4bd
+	.uleb128 0xf
+	.long	0x4e1
+	.long	0x4e1
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1640
+	.uleb128 0x4
+	.long	0x4d2
+	.uleb128 0x9
+	.long	0x4fd
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x29d
+	.byte	0
+	.uleb128 0x4
+	.long	0x4ed
+	.uleb128 0x9
+	.long	0x517
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x12e
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x502
+	.uleb128 0x9
+	.long	0x527
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x4
+	.long	0x51c
+	.uleb128 0xa
+	.long	.LASF1642
+	.byte	0x34
+	.byte	0x16
+	.long	0x486
+	.uleb128 0x6
+	.long	.LASF1641
+	.byte	0x6
+	.byte	0x38
+	.byte	0x10
+	.long	0x543
+	.uleb128 0x4
+	.long	0x548
+	.uleb128 0x9
+	.long	0x558
+	.uleb128 0x2
+	.long	0x7e
+	.uleb128 0x2
+	.long	0x85
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1643
+	.byte	0x39
+	.byte	0xe
+	.long	0x537
+	.uleb128 0xa
+	.long	.LASF1644
+	.byte	0x3a
+	.byte	0xe
+	.long	0x7e
+	.uleb128 0xd
+	.long	.LASF1629
+	.byte	0x5
+	.byte	0x71
+	.long	0x584
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x91
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1634
+	.byte	0x5
+	.byte	0x78
+	.byte	0x5
+	.long	0x4e1
+	.long	0x59a
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x22
+	.string	"i2a"
+	.byte	0x7
+	.byte	0x18
+	.byte	0x6
+	.long	0x5b1
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1645
+	.byte	0x7
+	.byte	0x16
+	.long	0x5c7
+	.uleb128 0x2
+	.long	0x77
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1646
+	.byte	0x7
+	.byte	0x17
+	.long	0x5e7
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1647
+	.byte	0x7
+	.byte	0x15
+	.long	0x607
+	.uleb128 0x2
+	.long	0x37
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x23
+	.string	"a2i"
+	.byte	0x7
+	.byte	0x19
+	.byte	0x6
+	.long	0x85
+	.long	0x62c
+	.uleb128 0x2
+	.long	0x85
+	.uleb128 0x2
+	.long	0x62c
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x631
+	.byte	0
+	.uleb128 0x4
+	.long	0x277
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x15
+	.long	.LASF1654
+	.byte	0xe0
+	.long	0x64c
+	.uleb128 0xb
+	.long	.LASF1648
+	.byte	0xe0
+	.byte	0x28
+	.long	0x486
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1664
+	.byte	0x6
+	.byte	0xca
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1651
+	.byte	0xc4
+	.long	0x671
+	.uleb128 0x7
+	.string	"p"
+	.byte	0xc4
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x7
+	.string	"c"
+	.byte	0xc4
+	.byte	0x21
+	.long	0x85
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1649
+	.byte	0xb8
+	.long	0x64
+	.long	0x6aa
+	.uleb128 0x7
+	.string	"s"
+	.byte	0xb8
+	.byte	0x17
+	.long	0x80
+	.uleb128 0x7
+	.string	"fmt"
+	.byte	0xb8
+	.byte	0x26
+	.long	0x277
+	.uleb128 0x17
+	.uleb128 0x8
+	.string	"va"
+	.byte	0xba
+	.byte	0xd
+	.long	0x114
+	.uleb128 0xa
+	.long	.LASF1650
+	.byte	0xbd
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1652
+	.byte	0xb3
+	.long	0x6c7
+	.uleb128 0x7
+	.string	"p"
+	.byte	0xb3
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x7
+	.string	"c"
+	.byte	0xb3
+	.byte	0x21
+	.long	0x85
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1653
+	.byte	0xa9
+	.long	0x64
+	.long	0x6f7
+	.uleb128 0x7
+	.string	"fmt"
+	.byte	0xa9
+	.byte	0x1c
+	.long	0x277
+	.uleb128 0x17
+	.uleb128 0x8
+	.string	"va"
+	.byte	0xab
+	.byte	0xd
+	.long	0x114
+	.uleb128 0xa
+	.long	.LASF1650
+	.byte	0xad
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1655
+	.byte	0xa3
+	.long	0x718
+	.uleb128 0xb
+	.long	.LASF1656
+	.byte	0xa3
+	.byte	0x18
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF1657
+	.byte	0xa3
+	.byte	0x25
+	.long	0x543
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1658
+	.byte	0x50
+	.long	0x64
+	.long	0x799
+	.uleb128 0xb
+	.long	.LASF1656
+	.byte	0x50
+	.byte	0x16
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF1657
+	.byte	0x50
+	.byte	0x22
+	.long	0x537
+	.uleb128 0x7
+	.string	"fmt"
+	.byte	0x50
+	.byte	0x34
+	.long	0x277
+	.uleb128 0x7
+	.string	"va"
+	.byte	0x50
+	.byte	0x41
+	.long	0x799
+	.uleb128 0x8
+	.string	"bf"
+	.byte	0x52
+	.byte	0xa
+	.long	0x79e
+	.uleb128 0xa
+	.long	.LASF1650
+	.byte	0x53
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x8
+	.string	"ch"
+	.byte	0x54
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x25
+	.long	.LASF1665
+	.byte	0x6
+	.byte	0x9f
+	.byte	0x1
+	.uleb128 0x26
+	.uleb128 0x8
+	.string	"lz"
+	.byte	0x5a
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x8
+	.string	"lng"
+	.byte	0x5c
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x8
+	.string	"w"
+	.byte	0x5e
+	.byte	0x11
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xdf
+	.uleb128 0x11
+	.long	0x85
+	.long	0x7ae
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1659
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xc
+	.long	0x64
+	.uleb128 0xb
+	.long	.LASF1656
+	.byte	0x3e
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF1657
+	.byte	0x3e
+	.byte	0x25
+	.long	0x537
+	.uleb128 0x7
+	.string	"n"
+	.byte	0x3e
+	.byte	0x2f
+	.long	0x64
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x3e
+	.byte	0x37
+	.long	0x85
+	.uleb128 0x7
+	.string	"bf"
+	.byte	0x3e
+	.byte	0x40
+	.long	0x80
+	.uleb128 0xa
+	.long	.LASF1650
+	.byte	0x40
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x8
+	.string	"fc"
+	.byte	0x41
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x8
+	.string	"ch"
+	.byte	0x42
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x43
+	.byte	0xb
+	.long	0x80
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 27 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF756
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF792
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF834
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF835
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF836
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF837
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF713
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF838
+	.file 38 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF839
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF856
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF869
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF874
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF877
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF878
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF897
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF909
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF916
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF917
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF921
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x38
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3a
+	.file 59 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 60 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 62 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5
+	.file 63 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 64 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 65 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 66 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 67 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1522
+	.byte	0x4
+	.file 68 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 69 "./src/main/common/printf.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1525
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF700
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF733
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF751
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF752
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF813
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF843
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF851
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF855
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF868
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF873
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF890
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF960
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1014
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1028
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1031
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1048
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF752
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1085
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1115
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1123
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1524
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1666
+	.long	.LASF1667
+	.long	.LASF1668
+	.long	.LASF1669
+	.long	.LASF1670
+	.long	.LASF1671
+	.long	.LASF1672
+	.long	.LASF1673
+	.long	.LASF1674
+	.long	.LASF1675
+	.long	.LASF1676
+	.long	.LASF1677
+	.long	.LASF1678
+	.long	.LASF1679
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x46
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1680
+	.byte	0xa
+	.long	.LASF1681
+	.byte	0xa
+	.long	.LASF1682
+	.byte	0xe
+	.long	.LASF1683
+	.byte	0
+	.long	.LASF1684
+	.byte	0x4
+	.long	.LASF1685
+	.byte	0x2
+	.long	.LASF1686
+	.byte	0x2
+	.long	.LASF1687
+	.byte	0x6
+	.long	.LASF1688
+	.byte	0x4
+	.long	.LASF1689
+	.byte	0xd
+	.long	.LASF1690
+	.byte	0xe
+	.long	.LASF1691
+	.byte	0xe
+	.long	.LASF1691
+	.byte	0xd
+	.long	.LASF1692
+	.byte	0xa
+	.long	.LASF1693
+	.byte	0xd
+	.long	.LASF1694
+	.byte	0xd
+	.long	.LASF1695
+	.byte	0xa
+	.long	.LASF1696
+	.byte	0xa
+	.long	.LASF1697
+	.byte	0xc
+	.long	.LASF1698
+	.byte	0xa
+	.long	.LASF1699
+	.byte	0xb
+	.long	.LASF1700
+	.byte	0xb
+	.long	.LASF1701
+	.byte	0xa
+	.long	.LASF1702
+	.byte	0xa
+	.long	.LASF1703
+	.byte	0xa
+	.long	.LASF1704
+	.byte	0xa
+	.long	.LASF1705
+	.byte	0xd
+	.long	.LASF1706
+	.byte	0xe
+	.long	.LASF1707
+	.byte	0xa
+	.long	.LASF1708
+	.byte	0xa
+	.long	.LASF1709
+	.byte	0xa
+	.long	.LASF1710
+	.byte	0xa
+	.long	.LASF1680
+	.byte	0xc
+	.long	.LASF1711
+	.byte	0x9
+	.long	.LASF1712
+	.byte	0x9
+	.long	.LASF1713
+	.byte	0x9
+	.long	.LASF1714
+	.byte	0x9
+	.long	.LASF1715
+	.byte	0xd
+	.long	.LASF1715
+	.byte	0xa
+	.long	.LASF1716
+	.byte	0xa
+	.long	.LASF1717
+	.byte	0xa
+	.long	.LASF1718
+	.byte	0xa
+	.long	.LASF1719
+	.byte	0xc
+	.long	.LASF1719
+	.byte	0xa
+	.long	.LASF1720
+	.byte	0x9
+	.long	.LASF1721
+	.byte	0x9
+	.long	.LASF1722
+	.byte	0x9
+	.long	.LASF1723
+	.byte	0x9
+	.long	.LASF1724
+	.byte	0xa
+	.long	.LASF1725
+	.byte	0xa
+	.long	.LASF1726
+	.byte	0xa
+	.long	.LASF1727
+	.byte	0xa
+	.long	.LASF1728
+	.byte	0xa
+	.long	.LASF1729
+	.byte	0xa
+	.long	.LASF1730
+	.byte	0xd
+	.long	.LASF1731
+	.byte	0xa
+	.long	.LASF1732
+	.byte	0xa
+	.long	.LASF1733
+	.byte	0x8
+	.long	.LASF1734
+	.byte	0x7
+	.long	.LASF1735
+	.byte	0x7
+	.long	.LASF1736
+	.byte	0x1
+	.long	.LASF1737
+	.byte	0x2
+	.long	.LASF1738
+	.byte	0x4
+	.long	.LASF1739
+	.byte	0x4
+	.long	.LASF1740
+	.byte	0x4
+	.long	.LASF1741
+	.byte	0x4
+	.long	.LASF1742
+	.byte	0x3
+	.long	.LASF1684
+	.byte	0x5
+	.long	.LASF1743
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1495:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1604:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF814:
+	.string	"__ldiv_t_defined 1"
+.LASF1251:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1131:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF700:
+	.string	"_ANSI_STDARG_H_ "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1325:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1653:
+	.string	"tfp_printf"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1271:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF904:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1157:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1142:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF744:
+	.string	"_WCHAR_T_DEFINED "
+.LASF962:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF847:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1618:
+	.string	"rxBufferSize"
+.LASF1226:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1006:
+	.string	"USE_UART7 "
+.LASF1242:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1016:
+	.string	"USE_PPM"
+.LASF1635:
+	.string	"setMode"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF841:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF935:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1140:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1398:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF991:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF829:
+	.string	"__pid_t_defined "
+.LASF840:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1504:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF762:
+	.string	"WNOWAIT 0x01000000"
+.LASF1018:
+	.string	"SERIAL_RX"
+.LASF1043:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1532:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1640:
+	.string	"_Bool"
+.LASF1007:
+	.string	"USE_UART8 "
+.LASF1344:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"SKIP_IMU_CALC "
+.LASF981:
+	.string	"U_ID_2 2"
+.LASF1092:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1116:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1617:
+	.string	"baudRate"
+.LASF957:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1558:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1602:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1422:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1368:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1127:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF736:
+	.string	"__WCHAR_T__ "
+.LASF963:
+	.string	"USE_SENSOR_NAMES "
+.LASF756:
+	.string	"_STDLIB_H 1"
+.LASF1491:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF701:
+	.string	"__need___va_list"
+.LASF1250:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1330:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1463:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1409:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1467:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1538:
+	.string	"uint16_t"
+.LASF852:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1543:
+	.string	"overflow_arg_area"
+.LASF1430:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1274:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"TELEMETRY_HOTT "
+.LASF931:
+	.string	"USE_CLI_BATCH "
+.LASF906:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1397:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1155:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1071:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1544:
+	.string	"reg_save_area"
+.LASF1053:
+	.string	"_T_PTRDIFF_ "
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1343:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1010:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF710:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF826:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1107:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF735:
+	.string	"__wchar_t__ "
+.LASF973:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1150:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1560:
+	.string	"OWNER_ADC_RSSI"
+.LASF1454:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF809:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF951:
+	.string	"CMS "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1355:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1490:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1562:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1521:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1158:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1123:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF727:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1661:
+	.string	"__builtin_va_list"
+.LASF1104:
+	.string	"BIT(x) (1 << (x))"
+.LASF1586:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1622:
+	.string	"rxBufferHead"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1317:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF869:
+	.string	"_SYS_SELECT_H 1"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF881:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF994:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1637:
+	.string	"beginWrite"
+.LASF1472:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1476:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF746:
+	.string	"___int_wchar_t_h "
+.LASF1594:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1646:
+	.string	"ui2a"
+.LASF1412:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1129:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF984:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1182:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF854:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1583:
+	.string	"OWNER_BARO_EXTI"
+.LASF712:
+	.string	"__va_list__ "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF996:
+	.string	"USE_FLASHFS "
+.LASF793:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1597:
+	.string	"MODE_RX"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1017:
+	.string	"USE_PWM"
+.LASF1277:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1223:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1561:
+	.string	"OWNER_SERIAL_TX"
+.LASF1025:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1096:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1665:
+	.string	"abort"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1205:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1011:
+	.string	"STACK_CHECK"
+.LASF856:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1449:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"_T_SIZE_ "
+.LASF1662:
+	.string	"__va_list_tag"
+.LASF865:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF873:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF958:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1392:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1204:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1584:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1014:
+	.string	"USE_ADC"
+.LASF773:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1596:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1516:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF731:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1455:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1598:
+	.string	"MODE_TX"
+.LASF797:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1518:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF827:
+	.string	"__uid_t_defined "
+.LASF1336:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1374:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF770:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1524:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF789:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1566:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1035:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1415:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"txBufferTail"
+.LASF1361:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1185:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1132:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1507:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1554:
+	.string	"OWNER_SERVO"
+.LASF1106:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF988:
+	.string	"ACC "
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF954:
+	.string	"TELEMETRY_IBUS "
+.LASF933:
+	.string	"USE_PWM "
+.LASF822:
+	.string	"__ino_t_defined "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF851:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF737:
+	.string	"_WCHAR_T "
+.LASF1013:
+	.string	"TELEMETRY_LTM"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1172:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1642:
+	.string	"printfSerialPort"
+.LASF1156:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1506:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF844:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1159:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF919:
+	.string	"alloca"
+.LASF877:
+	.string	"__timeval_defined 1"
+.LASF1059:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1533:
+	.string	"__uint16_t"
+.LASF812:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1553:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1067:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1502:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1207:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1580:
+	.string	"OWNER_RX_SPI_CS"
+.LASF747:
+	.string	"__INT_WCHAR_T_H "
+.LASF824:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1073:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF870:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1624:
+	.string	"txBufferHead"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF887:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1615:
+	.string	"mode"
+.LASF864:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1218:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1200:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1540:
+	.string	"__gnuc_va_list"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1085:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF808:
+	.string	"__f32x(x) x ##f32x"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1641:
+	.string	"putcf"
+.LASF1091:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1323:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1269:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1652:
+	.string	"putcp"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF964:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1526:
+	.string	"unsigned char"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1115:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1060:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1347:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF972:
+	.string	"USE_NAV "
+.LASF1364:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF928:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1310:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF986:
+	.string	"USE_FAKE_LED "
+.LASF1549:
+	.string	"float"
+.LASF1614:
+	.string	"identifier"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1065:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1253:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1636:
+	.string	"writeBuf"
+.LASF990:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1293:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"setPrintfSerialPort"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1557:
+	.string	"OWNER_ADC_BATT"
+.LASF1229:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1118:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1175:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF955:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1052:
+	.string	"_PTRDIFF_T "
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF849:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1072:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1080:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1638:
+	.string	"endWrite"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF867:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF950:
+	.string	"USE_SERVOS "
+.LASF1210:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1128:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1440:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1199:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF772:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1075:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF834:
+	.string	"__clock_t_defined 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF743:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF941:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1078:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1575:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1461:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"__NFDBITS"
+.LASF819:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1100:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF775:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1346:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1160:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"__timer_t_defined 1"
+.LASF1272:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1257:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1042:
+	.string	"USE_SPI"
+.LASF745:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1114:
+	.string	"IO_TAG_NONE 0"
+.LASF1633:
+	.string	"serialSetBaudRate"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF875:
+	.string	"____sigset_t_defined "
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1632:
+	.string	"serialRead"
+.LASF839:
+	.string	"_ENDIAN_H 1"
+.LASF1481:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1367:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1313:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1626:
+	.string	"rxCallback"
+.LASF398:
+	.string	"false 0"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF1493:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1421:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1143:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1545:
+	.string	"va_list"
+.LASF708:
+	.string	"_VA_LIST_ "
+.LASF1452:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1620:
+	.string	"rxBuffer"
+.LASF800:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1619:
+	.string	"txBufferSize"
+.LASF1606:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF921:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF908:
+	.string	"__ONCE_ALIGNMENT "
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1585:
+	.string	"OWNER_USB_DETECT"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF766:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1048:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1113:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF932:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF891:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF838:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF861:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF982:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1202:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1645:
+	.string	"li2a"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1101:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF795:
+	.string	"__HAVE_FLOAT64 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF730:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF725:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1589:
+	.string	"OWNER_INVERTER"
+.LASF1033:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF850:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1570:
+	.string	"OWNER_SPI_MOSI"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1464:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF909:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF945:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1275:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1487:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1221:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF823:
+	.string	"__dev_t_defined "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF997:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF748:
+	.string	"_GCC_WCHAR_T "
+.LASF1102:
+	.string	"PP_IIF_1(t,f) t"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1029:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF777:
+	.string	"__WCOREFLAG 0x80"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1403:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1316:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF713:
+	.string	"__need_size_t "
+.LASF703:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1248:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1051:
+	.string	"_ANSI_STDDEF_H "
+.LASF910:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1341:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF835:
+	.string	"__clockid_t_defined 1"
+.LASF751:
+	.string	"_BSD_WCHAR_T_"
+.LASF1664:
+	.string	"printfSupportInit"
+.LASF1032:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1514:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF791:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1376:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1015:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1130:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF734:
+	.string	"__need_size_t"
+.LASF1552:
+	.string	"OWNER_PPMINPUT"
+.LASF1062:
+	.string	"__need_ptrdiff_t"
+.LASF853:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF923:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1079:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1049:
+	.string	"_STDDEF_H "
+.LASF1420:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF993:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1427:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1161:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF930:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF780:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1513:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1126:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF872:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF728:
+	.string	"_SIZE_T_DECLARED "
+.LASF1288:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF792:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF842:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1382:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1499:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"LED_STRIP"
+.LASF1394:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF790:
+	.string	"__f128(x) x ##f128"
+.LASF893:
+	.string	"__fsblkcnt_t_defined "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF848:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1086:
+	.string	"NOOP do {} while (0)"
+.LASF702:
+	.string	"__GNUC_VA_LIST "
+.LASF1023:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1305:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"USE_SERIALRX_SUMH"
+.LASF894:
+	.string	"__fsfilcnt_t_defined "
+.LASF757:
+	.string	"WNOHANG 1"
+.LASF1311:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF903:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1170:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF946:
+	.string	"TELEMETRY_FRSKY "
+.LASF1134:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1457:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1442:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1099:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1433:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1022:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1122:
+	.string	"IOCFG_IPU 0"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF759:
+	.string	"WSTOPPED 2"
+.LASF753:
+	.string	"NULL"
+.LASF1211:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF917:
+	.string	"__have_pthread_attr_t 1"
+.LASF760:
+	.string	"WEXITED 4"
+.LASF1567:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF468:
+	.string	"__PMT"
+.LASF749:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF976:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF907:
+	.string	"__LOCK_ALIGNMENT "
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF975:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF925:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1550:
+	.string	"OWNER_FREE"
+.LASF884:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1308:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1515:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF788:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1296:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF860:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1437:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1241:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1083:
+	.string	"UNIT_TESTED "
+.LASF1525:
+	.string	"FTOA_BUFFER_LENGTH 11"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1362:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF741:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF902:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1141:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1074:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1660:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF804:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1511:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF922:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF719:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF942:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1162:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1287:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1173:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF706:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1451:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF938:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF879:
+	.string	"__suseconds_t_defined "
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1268:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF896:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF888:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1647:
+	.string	"uli2a"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1424:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF755:
+	.string	"__need_NULL"
+.LASF1063:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1657:
+	.string	"putf"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1542:
+	.string	"fp_offset"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1656:
+	.string	"putp"
+.LASF1193:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1153:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1541:
+	.string	"gp_offset"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1599:
+	.string	"MODE_RXTX"
+.LASF1036:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1019:
+	.string	"USE_SERIALRX_CRSF"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF999:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1295:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1028:
+	.string	"TELEMETRY_HOTT"
+.LASF1547:
+	.string	"long long unsigned int"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1088:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1573:
+	.string	"OWNER_SDCARD"
+.LASF1206:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1482:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1527:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1530:
+	.string	"signed char"
+.LASF805:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1505:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF716:
+	.string	"__size_t__ "
+.LASF948:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF949:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1479:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1365:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF836:
+	.string	"__time_t_defined 1"
+.LASF863:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF855:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1603:
+	.string	"SERIAL_INVERTED"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1353:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1388:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"VTX_TRAMP"
+.LASF916:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF807:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF724:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1406:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1012:
+	.string	"USE_DASHBOARD"
+.LASF1176:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF895:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF765:
+	.string	"__WCLONE 0x80000000"
+.LASF1144:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF890:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF781:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF970:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1539:
+	.string	"uint32_t"
+.LASF796:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1044:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1663:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1331:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1217:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1045:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1197:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1587:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1446:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1112:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1148:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF936:
+	.string	"USE_SERIALRX_IBUS "
+.LASF892:
+	.string	"__blkcnt_t_defined "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF833:
+	.string	"__key_t_defined "
+.LASF1163:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF967:
+	.string	"VTX_SMARTAUDIO "
+.LASF1109:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1508:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF858:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1349:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"serialPort"
+.LASF1609:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1154:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1352:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF971:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1290:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1630:
+	.string	"serialTotalRxWaiting"
+.LASF1519:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1135:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1428:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"long int"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1260:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1254:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1146:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1563:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1469:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1239:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF953:
+	.string	"TELEMETRY_CRSF "
+.LASF1655:
+	.string	"init_printf"
+.LASF1056:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1196:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1055:
+	.string	"__PTRDIFF_T "
+.LASF878:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF818:
+	.string	"EXIT_SUCCESS 0"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1334:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1220:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1166:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1097:
+	.string	"EXPAND_I(x) x"
+.LASF1520:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1328:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1649:
+	.string	"tfp_sprintf"
+.LASF722:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1627:
+	.string	"serialPort_s"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"rxBufferTail"
+.LASF810:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF721:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF811:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF882:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1634:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF750:
+	.string	"__DEFINED_wchar_t "
+.LASF1413:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF491:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF944:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1027:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1084:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF876:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF738:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF816:
+	.string	"RAND_MAX 2147483647"
+.LASF1564:
+	.string	"OWNER_TIMER"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1401:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1094:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1263:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1436:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF969:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1536:
+	.string	"char"
+.LASF901:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF733:
+	.string	"__size_t "
+.LASF761:
+	.string	"WCONTINUED 8"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF799:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1046:
+	.string	"DEFIO_NO_PORTS "
+.LASF1358:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1119:
+	.string	"IOCFG_AF_PP 0"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1188:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF718:
+	.string	"_SIZE_T "
+.LASF758:
+	.string	"WUNTRACED 2"
+.LASF704:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1001:
+	.string	"USE_UART2 "
+.LASF866:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF961:
+	.string	"USE_RX_MSP "
+.LASF1337:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1283:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1245:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF726:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1494:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF794:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__need_NULL "
+.LASF1607:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF924:
+	.string	"I2C1_OVERCLOCK true"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF754:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1576:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1070:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1095:
+	.string	"STR_HELPER(x) #x"
+.LASF915:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1289:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1039:
+	.string	"VTX_SMARTAUDIO"
+.LASF937:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1568:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF960:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1081:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF397:
+	.string	"true 1"
+.LASF1021:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1299:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"USE_FAKE_BARO "
+.LASF874:
+	.string	"__sigset_t_defined 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1338:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1054:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF828:
+	.string	"__off_t_defined "
+.LASF705:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF989:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1380:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1266:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1212:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF802:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF830:
+	.string	"__id_t_defined "
+.LASF913:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF774:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1209:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1475:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF912:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1244:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1497:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF832:
+	.string	"__daddr_t_defined "
+.LASF1191:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"SERIAL_STOPBITS_2"
+.LASF764:
+	.string	"__WALL 0x40000000"
+.LASF1571:
+	.string	"OWNER_I2C_SCL"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF845:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF859:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1286:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1232:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF776:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF927:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1214:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"_SYS_TYPES_H 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF843:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1569:
+	.string	"OWNER_SPI_MISO"
+.LASF1178:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1572:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1593:
+	.string	"OWNER_COMPASS_CS"
+.LASF1523:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF769:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1108:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1302:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1659:
+	.string	"putchw"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF846:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF742:
+	.string	"_BSD_WCHAR_T_ "
+.LASF815:
+	.string	"__lldiv_t_defined 1"
+.LASF1466:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1077:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1443:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF905:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1608:
+	.string	"SERIAL_UNIDIR"
+.LASF1534:
+	.string	"__uint32_t"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF771:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1404:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF929:
+	.string	"USE_CLI "
+.LASF974:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1447:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1484:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF998:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF714:
+	.string	"__need_wchar_t "
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1383:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1329:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF763:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1621:
+	.string	"txBuffer"
+.LASF739:
+	.string	"_T_WCHAR "
+.LASF1103:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF732:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1395:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF959:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF952:
+	.string	"TELEMETRY_LTM "
+.LASF1050:
+	.string	"_STDDEF_H_ "
+.LASF1133:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1151:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1500:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1501:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1370:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1485:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF899:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF918:
+	.string	"_ALLOCA_H 1"
+.LASF1233:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1588:
+	.string	"OWNER_RX_BIND"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF966:
+	.string	"VTX_CONTROL "
+.LASF1389:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"OWNER_TRANSPONDER"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1235:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1181:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1301:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"__f32(x) x ##f32"
+.LASF1057:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF740:
+	.string	"__WCHAR_T "
+.LASF821:
+	.string	"__u_char_defined "
+.LASF1628:
+	.string	"serialPortVTable"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1314:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1548:
+	.string	"double"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF883:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1658:
+	.string	"tfp_format"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1600:
+	.string	"portMode_t"
+.LASF801:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1105:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF980:
+	.string	"U_ID_1 1"
+.LASF979:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1385:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1578:
+	.string	"OWNER_MPU_CS"
+.LASF1581:
+	.string	"OWNER_SPI_CS"
+.LASF1124:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF786:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1448:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1041:
+	.string	"USE_I2C"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF992:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1386:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1110:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF825:
+	.string	"__mode_t_defined "
+.LASF1517:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF785:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1612:
+	.string	"serialReceiveCallbackPtr"
+.LASF1098:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF709:
+	.string	"_VA_LIST "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1066:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF767:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1111:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF939:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1332:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1278:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1610:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1164:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF784:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1292:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF711:
+	.string	"_VA_LIST_T_H "
+.LASF831:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1651:
+	.string	"_putc"
+.LASF1373:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF889:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1203:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1639:
+	.string	"serialPort_t"
+.LASF1551:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF803:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1256:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"EXIT_FAILURE 1"
+.LASF1631:
+	.string	"serialTotalTxFree"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1611:
+	.string	"SERIAL_BIDIR_PP"
+.LASF897:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1238:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF920:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1184:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1058:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1190:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF940:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1350:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF857:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1020:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF956:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF886:
+	.string	"NFDBITS __NFDBITS"
+.LASF1546:
+	.string	"long long int"
+.LASF1643:
+	.string	"stdout_putf"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1117:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1644:
+	.string	"stdout_putp"
+.LASF1601:
+	.string	"portOptions_t"
+.LASF1574:
+	.string	"OWNER_SDCARD_CS"
+.LASF778:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF729:
+	.string	"__DEFINED_size_t "
+.LASF1149:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1147:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1445:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1000:
+	.string	"USE_UART1 "
+.LASF768:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1137:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1470:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1416:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1194:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1595:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1008:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF914:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1281:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF779:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF1167:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1227:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"long unsigned int"
+.LASF1125:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1590:
+	.string	"OWNER_LED_STRIP"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1087:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF965:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF968:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1038:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1322:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1400:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1629:
+	.string	"serialWrite"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1002:
+	.string	"USE_UART3 "
+.LASF934:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1187:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF985:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF717:
+	.string	"__SIZE_T__ "
+.LASF1512:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1650:
+	.string	"written"
+.LASF1577:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1528:
+	.string	"unsigned int"
+.LASF1003:
+	.string	"USE_UART4 "
+.LASF1201:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF868:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1503:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1496:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1407:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1089:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1434:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1371:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1556:
+	.string	"OWNER_ADC"
+.LASF1531:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1582:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1473:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1004:
+	.string	"USE_UART5 "
+.LASF1419:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF885:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1613:
+	.string	"vTable"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1034:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1559:
+	.string	"OWNER_ADC_EXT"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1616:
+	.string	"options"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF699:
+	.string	"_STDARG_H "
+.LASF1579:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1460:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1061:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1510:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF782:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1340:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1284:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1230:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1136:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1121:
+	.string	"IOCFG_IPD 0"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1005:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1721:
+	.string	"__sigset_t.h"
+.LASF1728:
+	.string	"struct_mutex.h"
+.LASF1698:
+	.string	"long-double.h"
+.LASF1733:
+	.string	"platform.h"
+.LASF1687:
+	.string	"target.h"
+.LASF1725:
+	.string	"thread-shared-types.h"
+.LASF1692:
+	.string	"libc-header-start.h"
+.LASF1690:
+	.string	"stdbool.h"
+.LASF1677:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1715:
+	.string	"endian.h"
+.LASF1667:
+	.string	"src/main/common"
+.LASF1704:
+	.string	"stdint-intn.h"
+.LASF1734:
+	.string	"common_fc_pre.h"
+.LASF1676:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1679:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1683:
+	.string	"<built-in>"
+.LASF1671:
+	.string	"src/main/target/SITL"
+.LASF1727:
+	.string	"atomic_wide_counter.h"
+.LASF1711:
+	.string	"clock_t.h"
+.LASF1670:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1682:
+	.string	"stdarg.h"
+.LASF1675:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1743:
+	.string	"printf.h"
+.LASF1705:
+	.string	"stdlib.h"
+.LASF1694:
+	.string	"features-time64.h"
+.LASF1730:
+	.string	"alloca.h"
+.LASF1680:
+	.string	"types.h"
+.LASF1710:
+	.string	"floatn-common.h"
+.LASF1709:
+	.string	"floatn.h"
+.LASF0:
+	.string	"./src/main/common/printf.c"
+.LASF1735:
+	.string	"common_fc_post.h"
+.LASF1669:
+	.string	"src/main/drivers"
+.LASF1678:
+	.string	"/usr/include"
+.LASF1723:
+	.string	"struct_timespec.h"
+.LASF1713:
+	.string	"time_t.h"
+.LASF1666:
+	.string	"src/main/build"
+.LASF1720:
+	.string	"sigset_t.h"
+.LASF1685:
+	.string	"printf.c"
+.LASF1693:
+	.string	"features.h"
+.LASF1701:
+	.string	"typesizes.h"
+.LASF1724:
+	.string	"pthreadtypes.h"
+.LASF1707:
+	.string	"waitflags.h"
+.LASF1684:
+	.string	"serial.h"
+.LASF1712:
+	.string	"clockid_t.h"
+.LASF1668:
+	.string	"src/main/config"
+.LASF1696:
+	.string	"timesize.h"
+.LASF1702:
+	.string	"time64.h"
+.LASF1681:
+	.string	"stdint-uintn.h"
+.LASF1717:
+	.string	"byteswap.h"
+.LASF1672:
+	.string	"src/main/target"
+.LASF1737:
+	.string	"utils.h"
+.LASF1714:
+	.string	"timer_t.h"
+.LASF1673:
+	.string	"src/main"
+.LASF1726:
+	.string	"pthreadtypes-arch.h"
+.LASF1708:
+	.string	"waitstatus.h"
+.LASF1688:
+	.string	"resource.h"
+.LASF1716:
+	.string	"endianness.h"
+.LASF1739:
+	.string	"io_types.h"
+.LASF1703:
+	.string	"wchar.h"
+.LASF1740:
+	.string	"io_def.h"
+.LASF1738:
+	.string	"io.h"
+.LASF1731:
+	.string	"stdlib-bsearch.h"
+.LASF1699:
+	.string	"stubs.h"
+.LASF1729:
+	.string	"struct_rwlock.h"
+.LASF1674:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1697:
+	.string	"cdefs.h"
+.LASF1719:
+	.string	"select.h"
+.LASF1691:
+	.string	"stdint.h"
+.LASF1736:
+	.string	"build_config.h"
+.LASF1706:
+	.string	"stddef.h"
+.LASF1700:
+	.string	"stubs-64.h"
+.LASF1695:
+	.string	"wordsize.h"
+.LASF1718:
+	.string	"uintn-identity.h"
+.LASF1741:
+	.string	"io_def_generated.h"
+.LASF1722:
+	.string	"struct_timeval.h"
+.LASF1742:
+	.string	"parameter_group.h"
+.LASF1686:
+	.string	"typeconversion.h"
+.LASF1689:
+	.string	"stdc-predef.h"
+.LASF1732:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375 \370\365\004"
+	.string	"\364\006\354"
+	.string	"\r"
+	.string	"\343\214\373\264\003\004\002"
+	.string	"\001\312\334\346\233\004\006\002\001\254\277\363\246\017\002\003\240\342\234\212\n\004\261\316\222\345\017&\002\003\002\003\002\004\002\004\002\005\002\005\004\006\002\006\005\306\261\236\222\002\004\002\007\002\007\002\b\002\b\006\007\b\376\220\273\353\017\b\002\t\002\t\t\252\335\206\331\006"
+	.string	"\002"
+	.string	"\n\206\273\306\320\013\226\266\306,\002\f\240\342\234\212\n"
+	.string	"\023"
+	.string	"x(HXmc\007\353\007\025&"
+	.ascii	"\237d\251\273\327\320\361\3252\340r\016l\250\025//h\345\006."
+	.ascii	"@gX \313\334\350\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\335\002"
+	.string	"\344\002\002\001"
+	.string	"\007"
+	.string	"\005"
+	.string	""
+	.string	"\003\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\002\005\001\001\004\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\n"
+	.string	"\001\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\022"
+	.string	"A\263\211K\201\2251\360|\236\244\263\206\374\200 \n\204\0022\251B\303\271\302\305b\220\204\263\3402`\0270\270\260\273\272"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\352\0015\n"
+	.string	"R\016.0Pm\222\016p\361\"P\n\370\246Q&3B\303\003\205\025s[&PT\274L\306\354\373\231\332UUUSA\303\200u\233\277Q[K\b\331[\246W\223G\256\344\275g\311@_Zo\t\222\303SA\342\360\013\017\204\016\200\fe\203l\026yzi\255\344\372Z\330T\365\247\212}\245\311\317A\214\f\205\217\233X\320\200\350C\034\211\bIh%\255\251\302\277\222\377k\330^N\202\274\2462\3075\016\3643\225\353\363\261\367nrr\247jh\003\277\030\366\324R\247\374\3268j\360\275w\320\276"
+	.string	"\031$D,\004\",\376\016\233\177;\315\241A\346\355d\203\003\305C\300C\343G< P\002A\212\354<\fbG\270\200x!\031A\233t+\224\310pw\001\2020G\200\320"
+	.ascii	"\356\001j<\200cL\301\013\026\032\356T\375X`\331\313:\310\n\001"
+	.ascii	"\241\300\210A@<+\341\n\034\274\020\306\034\351B8\201\202\216"
+	.ascii	"\024Y\b\301\200&\032\354\001\021\035\346\212\206\261\002+J\177"
+	.ascii	"\201;2\225s\f\303|\030-q\020\n^\203\202\372\204\205\"7\331\301"
+	.ascii	"\301\325]\206\270,\303\276\327Zw5Z]\234\272\256\360\272)\260"
+	.ascii	"\236v\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`2\004\005\013"
+	.string	"\222\216)*\220'I\007\313\374\037\373\001\276\037\177\273\273;^\\\231\225\260\325?\307\005\315*\177\302\260\367\243\266\310\266Flk\244m+\223\f\024\350%\236!\327\375P\377P\bh\202=\346\2530\362\232\364\376\342$\215F\002\364d\372d\204*\202\301\221z\341~\360\202X\326Z\266\206gx\351\376\360\016w^\013\206v\234\tT\311\230\246iz\271!\352!\252\037)\376\320\345}\266"
+	.string	"z\211\322T9b\306'c\363\355\3525=\306\367g\307\221z\216Tw<\363\256I\334\244I\236\031{\253\307\364\026m\323*\221\023*\230\f\004M\250\261A\241*I\013\264op\"\241\262\234\007\022\340\3610\002\216\310:\001\223\006\031q$\230\231`\202\t'\r\267\032.c\337(F\b\261\2227\236A\370Qh\"tM^+3\305\216%\330fh5C0\227\314X\265\2429\034\364\344\235hs\316\034\367\025\244\266"
+	.string	"\022g\325\201\331\347G\017\214MG\314$\274f\003\"\327\343x7v\002q\266C]DLd\246\201\370\202\236q\031\250\f\007\372\370\307T`_\232\0220)\343s\230 n7}\205SNBTm\257\310\2051j\236[\257_\212B\231p\314K\246\233"
+	.ascii	"\254\023HZV\211]\200=\277\320\277\274\200\023"
+	.text
+	.section	.gnu.lto_.pureconst.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\231\004\001\232\004\002\230\004\004\272\004\005\230\004\b\270"
+	.ascii	"\004\t\232\004\n\230\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375 \341\325\003"
+	.string	"\322\204\021\036\260%\351\300%\017\2255\f\013\032\320N\312C\266\352\330!N \3046\3226!\244I\231\002\013\n\207A\001\034\204\203\020\205\201\312Qg*OeslB\246*Wm\347\353U\006\312\371\206k\327\216]>\233?\021\025"
+	.string	"\b#"
+	.string	"\354Ub\261\017\021\214\206y\202\001"
+	.string	"og\260O\305;\025\341%F\251\003-V^l9j\020\227U\2356\354\022\257\330"
+	.string	"l\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.3a78396f8a0bdee7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.24.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`6\006\255$"
+	.string	":BP\016J\220XR\007\201\2177x\270 \t\036gZ\215T\221[g\003z\343V:~l\035\351\252A\027\356\373R?Ru\232\263\230\240Z[G\003\210\242\320&\321\277\242L\312\247\341^n]\344?\026\"\324C\326\332\275\367\3362\311\224\002\323"
+	.string	"\314"
+	.string	"\312"
+	.ascii	"\327\271z\254\327\234\257\2420s\316\b\032B\027{\267F$y\240\372"
+	.ascii	"\251\003\302\372\355v\"^\004\350\310>s\231\234\261~0sF\"h\003"
+	.ascii	"\252\237\215T=\210\013\001v\217a\244\0261h\315\251\313K\316\231"
+	.ascii	"\345\371\016\365\023\373\f\352\347\303\300\331:m6\233M\307Ho"
+	.ascii	"\024\003\035\006w\313\331V5EO\374\027\330\0364U\345\211\030t"
+	.ascii	"\230*\026\027\227\025\325\302o-<\207\323\246\0236\274\f\252\210"
+	.ascii	"\203\322\320\304\246\256m@V\024\225\257MWu!\225\247\370\267\214"
+	.ascii	"0\311\021\235\260\203!>bx\230\017\310\001\265\342\242G)?S!\334"
+	.ascii	"cE\225'\242\224\343\024\3769\342\022\346\345\234=\314oKd\272"
+	.ascii	"7\025\3129\367}\"Fy\353\274\333#tw\206\356\263)}\225(x\334\231"
+	.ascii	"\376c%\274j}\225\304\262|\325\272\221\301\373\306ngP\006EF?V"
+	.ascii	"\367\216N\016\216#\335o|\313\335\306\277\274kv432\316\345\036"
+	.ascii	"\343^\356\272\234+\335a\360m\233/\275W\325\231\336\251{y\243"
+	.ascii	"\247sy\343\277\375\177\373\342\333.\340g\211M3\347\023\315/Y"
+	.ascii	"\312)v\303\227\356_\356L\377n\357n`;\022O\342J<\254o\272,l7\263"
+	.ascii	"\307\324 \224\252|A\002C\027\260\037/\030\223"
+	.string	"\227\314J\340\270\020d\273\277~j\306\221*\223Oh9\347\n\252\2371-\333\275T\362<\204Z\207f-Z\316H\036?\233\202\252+cO/\245\233\230\314\224$1\301\211\202\005@W\376\372s.j\221\300d?\037l\333\337w\2475\241\213 (\232\276\254o\344q\374\036\346kV\222\214\351\246\371\233a\331Z\252*\2177\312\343;\337\266\212\2771\212?\367m\317H\337\330!\216`\247\314\1778\022\301\272_\277\3650W\255\034\311\316\231o\214c\036\177\353b\356\357Y\355K>\374T\032\355J\250\237\376N\245\245\022\336f\313\274/\023\370\3722\357\\\206;<\314=\205r\n\337\253\326\353\013\tq\3169\243=\363\316\345\274\036\307?\363>6,.\335f\343\224,\376H\025V\223\363\215}\237\347?\264\303\261x}\374\207\332\276\355\276\312)\335\373\322\201P\251\262\254\302\366\016\346<\341U\303\215\f\3427\336"
+	.string	"\307\032c\377Ca\336C\362\n\323M\013F\034\222\222\210|\277t\250w;\f]$\357m\270\"\334\310{@= \237\237\036\220O\017"
+	.string	"\244$%$\334C=\275$#\"\037\022ktTTt4\304\032\021i(b\207| \330\236"
+	.ascii	"}\204\304\301\307&\035\035\371"
+	.string	"\330\0332\373cuc\234\372::\337\300J\370K}\225?`\336\250\303\306\r'}\265\300\223\333\356\033\347t\217\326\274/y\245\346\375\313-X\t\257\232\357\267\323\252\371\333\265{\367B\177\367\367\314\304P\007\372\356\245\2763q8\352\343|\315?\217\333\033\333s\217e\263:\256\2559;\237\022x\262\322|\3434\367\347\267\347\373U\222\214\346|\232\367\263aqXu\246/\344\376[\270L\321\262\345\2743\017x\3729\217\273\206E\020W\371\336\277\371\266\371\3465\005|\250A0\004\235a\306\b\215\214\314\004M\2321\240\002\221\261*\017\021P\3014W\233d\331;K\037-M1\251\332h\021\007\221\276E@\247\343\036\322\351\362\307/\225.$\257\021\237_\220\007\210\217\352\337\323\301\034<U5\323\350s\364\027\203n\\\267\241;\241\205R\232\241\204\2711\230\201y\"\307\202D\200h\245xN\3611\274|u\227"
+	.string	"\027\354y\203:\005y\312\276z\372\b\354:\364\354\224\241!\224q\240\360\252|!\210n\206r>\251\024\304\370\0350\242\237\033kQ\0072\344\206\021R\026\256\216\207fz\230a~\214\301\277\2228\177\004\330uDe\340I\305\223[=\020t6\310\234#\002\352V\225\224>\264\006\220vl\t\304>\013\252X\024F\342q\300C"
+	.ascii	"l\214\300\253?\255\363\b\223>Y\021\004\0171\376\327\352Q\313"
+	.ascii	"\250\270,.\350qs\023\324\301\006Qde\035o\262Q\003"
+	.text
+	.section	.gnu.lto_tfp_format.25.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\343\021\005R"
+	.string	"\372\205\264\035P0\222\322\031\016\312\236\212\021\300{\255\347p6#\242\204\235\223=\255\016\224}\365.\035\276y\272W\243\366\021l\200\262\235\245\343~^\201\243;\023\341\005A\332\031\346\374\261\333\200\025A\340&\242\240@\005\336"
+	.string	"\242L3\263\272j\255\355\335mK\231d\314\001\247\001\276\001oT\351Z\206&\323\320\226\353\272\362H\357\313\031\242L*\241\302Az\337w\211\373\033\276\345kw[\033\265m\310\3666\342\273\374H\327\262\006\322\230,\327uK\007\335\215\nfx.\253L\253\266R5%M\226\031\3540\034\300"
+	.ascii	"\342\265P\t\253\216\353\t\005\034\241C\323\273o/X\016\177v\342"
+	.ascii	"\223{\367\225\233\350\241\235\270oe\250\310\241\311{$\026 A:"
+	.ascii	"k\220\264\022*H\257\266\373\273o\237\320\206mC\be\330\326\225"
+	.ascii	"\r\200\205\341d\310VFH.\220\336\247\2720<\357\236\312\253\020"
+	.ascii	"\177\\3\337YW02\266u=\002\260M\351}{L/\345h\304]\245y\024\343"
+	.ascii	"\272\022\261\342\025\275u]\207\302\373\234\367\231\3579\357\353"
+	.ascii	"\027V\310\304'\t\221\216\214\212\210\206\204\202\200~|\202="
+	.string	"<;:9*\316\215\r\360\227\242\247\317l&\356W\214!\263\270\252\236d\266\025\344\233R\025\274\272\255,f\002S\314\226\334\355\212\205XD\260\034\351\350VTn\344\204e\312\213|dN\210\276\f5\035\321\316\204\272,!\203\266\027\004d\366\237\030\310\330\207\305\330\320\316\202=c\347ib\n\237l1\341\235\270\233qI\216T\256\223#v\265n+\211)\\\327\325\3108Y~\303B\rhK\316`\220\322u\242C\272\316\376\2655\345g\203\344\300\327m!9\302\277\244/\"F\236\232M\3136!^\267e\304\3649\201,\353qOz\262\265\002\243*\374T\271\212\217;kqa\261\357\213H\225\233\246\217\016J\312\250\\B\314&\243\034\n6\\A\270\357vs\206#K\264\275/\"X\316\250\002\353\272.gq\021\371\216\370.O\355\356\217\335\234esH#L\334\nX\241\247\341e\205L\241\005\r\0200"
+	.ascii	"j\321<\306\327\276\356\271 \262\210\212!\300\232\234\035\266"
+	.ascii	"\001\234\352d\321\377J\343AEr\325\261\350k\371\004^Va\210P0\360"
+	.ascii	"\021\033\333\207p\336\307\242\371\212\326\221\356\333\360g\345"
+	.ascii	"\361{\316\022\335\315i\260\240\\\255Q>H&\2104u\253\334\377\246"
+	.ascii	"\252\355\325\235\352<\334-\360z\334?D\355\314\301\216`\304\370"
+	.ascii	"t\364\271\\\210\342K\255\243\3151X\306+^\263#|\345\360\033F\257"
+	.ascii	"\003\275B!]\265+\372\375\242\032+^\263\252\032\036Wa\262\303"
+	.ascii	"\030\263\303V\351T\347\212\226J\353!\b\023\2617ja\352\332\316"
+	.ascii	"\007+YzO9V\203s\"\300\313\212\321\354\211C]0\212\327^\336\312"
+	.ascii	"hv\217U\334a\273Oa6Dn\033lw\207\016\0346P^\250\0323P^\0311P\336"
+	.ascii	"\b\236P^\bn\345w\340\307\037\306\261\374\013\274p\321\202\305"
+	.ascii	"\212\277}Q\034\356\353\324t\342Z\276LK&\232W\251yK\250\274$F"
+	.ascii	"\240\274I8\274B\224\027\311\307{\204\362\032\241\274E(/\021\220"
+	.ascii	"w\b\345\025\272\341\r\372\361\002\241\274?7\274>(o\020\345\355"
+	.ascii	"Ayylxw~\274:(o\016\312\253\002yq~\2747\347\362\265i^`\363\376"
+	.ascii	"P\3364\345ES\336\263y}\315\333(\3579\240\261\245\2077\264\266"
+	.ascii	"\256'\254)b\2453\273\304p\345\377\366\303\375Z~.\177\227\237"
+	.ascii	"\273W\365\206{/{\034\376\345qk\243\356\301Q\t\253t\326+\273\032"
+	.ascii	"\312<\270\n\304)\374,\235\336\351\242\2641H.^\247sZ\310\263C"
+	.ascii	"\303\263\247w\025yf\347\007\211\367\004A/\365S\267\031,\2430"
+	.ascii	"U;\247\035\330\027\f\360\263 hs]A\371\234\376\255\340\324j\233"
+	.ascii	"W\212j~\220at\214Z\217\263\216\323\2730\036`\022\276\177\302"
+	.ascii	"\231\313\021r\213qSf\034s:\360L\347M\357N@\001?k\037\266\007"
+	.ascii	"r\356-8\027\350\335\233f\200\004\254\256\332\"\344\333\217\213"
+	.ascii	"\214\027\265\303\366ui=\374 \225U"
+	.string	"o\3031m\226zDk\355\272~\271\270\362\277\245\025^\263f\226\265\2776\210\254rw\0259\205\256\212\323\360(i\023\273\201\"\205\f\310\345w\271\243h\255\307\375\351\n\256\270\006|\321k\376NtSk\355\262\220\275\013\226\031\273\364Nu\262\325\362\325\031\343q\315\362\n\004\226\"\366i\356\230\350\355\355\211\020\223\204M\210\375\020{\227\332-\361\002b\037\304\336\261\332\227/>1\274\275\034\023:4\263\325\353\207\375\334\336\245\251\004+\013K433\273{\347C\306\330\265\256U7\356\035g\255kS\233+\022V#\245\tE\377\315\306\256F\224\027\035\274h\036\003\024\340\277\006\366\261\240\334\206\377\332\210\207.+\031\200\035\3663;\313!u\321k\242L}\242\265\312\234\352<\341\344D_\313\317\205\220\017\3468\254\027\340Wy\036\314\257\320H\263\322\336\255q\001?\313E\013\213]\265L\2356\237)\252\261Br"
+	.string	"\030\230\271\264\303\366egd\347\355~1\032\310|\227\273Sk\275\354\314x\266h\025B\370X4Sk\375\036u\242sA\230\210\250\363l\264\217ed\352\263;\"t\300\033\364\350\240\201<\207\r\356\241\301\324\324\016) \250\216\033<%\025e\003\312\007\365\001\337\320\300\307\017\341\006RP\351\024\217\034\235CE\016\025\001\020\220CE"
+	.ascii	")x|LQ\3710\367F\212\034S=vH\371\030\366\210\342\301#\352\306"
+	.ascii	"\260\307\016(\036\303\033R?\206)\2106\312\207\006R\303\251\250"
+	.ascii	"(\251\241\315q\245\273p\251\327\274\031\321;vG#\340e\325W\373"
+	.ascii	"\243\313\277\264r\003W\335\232\274\371\266\334[V\321%uX*&\n\025"
+	.ascii	"v\372\232H6\275\324Z+f\300\300gE\363"
+	.string	"\025\245\022\255T\242\201x\350\262r\373\207`\315\325\375\246\360\310D\337\355\024\\\231\025\327L\035m\323Z\335\206\304\003C2Z\352\037!0\024\327\210p\364\305(\311\206b4RX\222\342\232P\215V\303\272\212kA6\332WB\021\031\234\3219J~(\256\351<\265\211\307}\307D\237\013\247!\302B\326\361\250\314W\201\277\004\362\213\315H\306\226^\336R/\243@4[\345\301\214cc,f\204!\006\022\375\245\035\036\232\253\3110Es8p\264\357\n\226\361\252\210\022\230\345\325$\034\321\301\224e{y1\"\350\245\216\321\275E\330NO\212 \211\350\344\024\366\363\322\224j\256&\335\206\332j\324h\324\f\226\021\207n\357\t\322Q#5o)\032\365Q\037]\0251j\036\035\362\354\202\311*g\256&\247\b\005\223Rl@\365R\333\350\336B\324EPED\335c\202\311\263 \241f#\0372a(\250\205\202h"
+	.string	"\"\363\323:g:\201\200|\372\347@\274\251}\372\305.WN~\236\004\223I\362\256&\215\370$S\230!\243\227zFO\007e\004{\222E\202&8\b\236(D\032\204\254\027\236$W\017\211\245ql\247w\211R\002\201\213\250a<\004\031CC#\"\")H\2224\006\301\005\304\030\306\240\253\016\021"
+	.string	"5\251\030\223\221\222\0242\034\253\nY\024\337\342\234\214SSAY\235}\231&\221\353\233\241\220H,\216\254A\266C^M\244\202J\347\306,\257UE\246G\332hZ\263\351\260"
+	.ascii	"\313"
+	.string	" \267\203\331?Tn\204\311o\250\207\3646\374(\013\250\303\312\247\217[\325\342$\255<x\347\310\332S\256\036f\207\276W:GOxK\305t\273G\252\024\202R\350H\357\377\365\215\260\352\274t8G\371b\300|\314\306\260+T\346"
+	.string	"\300\027\240\324V:\226\212-\373\261\354\260\024\235\024\\l\227\034\255\361\236\364\303\337\245\376\301k\233"
+	.string	"\006*\332\205'V\303K\221&6w\311\365M\247\013\236I\255Yl\332R\301H\362?\225\304\345\020\312\254\2530\277\224T\225\377\nR\231.\002n\265U\231F\020z\316\236\016\330\315|\256B\376K\262\3126\301\322\347\351\303\272\247G\263\342\240\021\251\306<\224A\2670\204\360\232\r\021\363\261n>r\274pv\206\314\220\320"
+	.string	"\311\312\020\275\276V\377(\365\225\211\n\243"
+	.string	")T\003\273\270\277~\237b\027\017\3309\t\037\377\343\342u\265_\224\230CU\020)G\227T\b\3659\210A\344\3245\354S\337;_\345\r\265\351\007\237~`\2036\rb\274\260\203\017/h\207\223\013\205\225\006\377"
+	.string	"\213\252S\363\n\035\311\304\274\300\211\030\013\306\364#\211\253\022\006y>2%\234\246I\003sz\211\025\244\224K\250f\300+\nl\341E.m\207d\211\307M\324"
+	.string	"]\357\310Z\353\r\352.\2313\265\251\2222\232d\220z^\213\261X\340;\200\270hx\266\231Eij\244\223\222\"\006\371\207\241{*Q\375[\254+\315K])\026\250\257\211\307o\201\371^V\263\303\346-*\377\367\234\025O\273+\324\376\nb\247\260x\245\325\310\314\272\245s\204p}!bJp9O\263s@7\243\373\253\244\b;B\244\215J\025T\254\224\232\b\335\215\374n\315\300-\302\354\021,\347z\341w\221\342m \251\326\354#J\230rn\220<\037e\236\311L_\216V\376\300%0I\002R*\226\031CF\307\211\227\020&\227\330\317\204\242^%\317u\370\343v\304\374\336\"q\b\036\n\236i"
+	.ascii	"|vF\201\3547\031\036\256\301\357r\212\346!\035P\360\355\370\256"
+	.ascii	"\034`u\217!\225\201\214P\332\267'\001v>\244Q\035\340\034\310"
+	.ascii	"\260\363\215\024\310htqO8\373\341\302\257,\253\311\213\204j\222"
+	.ascii	"%GNf\352\310\300\024|\307L\236 B\2464<\035\216\237j&\306D\254"
+	.ascii	"A\201\355\004;\352?"
+	.text
+	.section	.gnu.lto_init_printf.26.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\355\t"
+	.string	"v\323E:0\221\322\001\200@\223g\3269\224\260N\035\025c\362>r\243\347\240<b\364\307d\373$n\320H\244\222\374a\2368\030\260\212\030\331:[\245\247\030t\347\274\367=\331d\357\224\0021"
+	.string	"6"
+	.string	"3"
+	.string	"\247\036_\300\235rN\300\235Z\264i>\206\354c2\213X\315\356\326\tr\361R\364\017{"
+	.string	"\253\245\272\004`\330]KV+\343\236\267}`\333\301\376'\277\344:\0350\t2\273\030\265\233\235\321\227\021\333\267\217\"\332\035\333sQ\245<l\244hi\340\234zT\365\362'~\311M\304\277L\273\300\256\213\304ewT0\002'\323_9\213i\022\247\023\207\234~\312UP\276\210'R\362\254S?\305\235~f6V\262f)\323\210Yic\217*9?\354o\273\273\236.\373\257\177\373\030]\210\3726\213:Qh\241\023\205@\003_\210\3726\217@]h\"\201_5y\245\2227\252&\022D\251\216\300S\005\031\330\373\"\300\032z\036X;\343~\333\351\362\203\307l5+\274\005\016"
+	.ascii	"\006Td\342a\320hq\001@h \023\300wK\265\362.x\017\225\r4!D!\004"
+	.ascii	"\327\334B\230O"
+	.text
+	.section	.gnu.lto_tfp_printf.27.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`/\002\035\023"
+	.string	"fc~I\320\360(\0350a\n\321h\270UZ\256\2603\317\004\246\344\332\270\215O\363K\032\b\305\247\230\201jZ\243_}\273<\345~\"\3551\307\3011$\274\211o\320W=\303\244\f\\*?\300\245\331\002h'|\377\221\220-eJ\001h"
+	.string	"j"
+	.string	"f"
+	.string	"?A\373\250\341\001\346\334\0012\232s4\361\201\323A\217\247\2278\020\315\346\311\261'w\236\0274BKs\316U\352$\341Ay\001\341\301\365\340U\332%\270J\363I\374\354\304\\\3552D\304\315A\331\201\253\371\361\310\335d\n\223\357\b$\207\323\375\356r\204\317O\314\335\\;\032\3149\255b\256\303\035\3366\3136\004[e\002!=\242\221^\b\0347\2466\331cM\227\307~J\017\223\317\273c_w\243>\376\247P-A\365J\265\256\372 -6K6L\220\346\254\371\345\260\301"
+	.ascii	"\217@\\\367\017\321\374\240\357\354\361\021\003\305\205h\037"
+	.ascii	"\232\221\023g\2345\005>.l\036\234\016~\300\007\r\325u\346\245"
+	.ascii	"n\343\314!\360I\002*9h\007\247\017\236\352j\337D\023VV\302\203"
+	.ascii	"\273 J*:S\233.\347\234s=\322\363\221(\013\205[\322^w\226\034"
+	.ascii	"\2336YD\027$\235\366\253k\267T\320\213\250M\321l\315\276\212"
+	.ascii	"\257p\r\027\026+<\250\013\300/z\212\027\377\203-\270\364\342"
+	.ascii	"A\337\025\036\374\222(\341\330\364\347\221\236\021JK~\242\357"
+	.ascii	"^\0068\210v\354\202^t\n\2675\007.\030\024\3662\233\271d\031:"
+	.ascii	"\214\322B9I\320B9Q\211\314^\2555K\325\232\301\\2\230\025,\366"
+	.ascii	"z\305X+\230\313\345\265b\311bV\252\002\216\301\274\310V\263X"
+	.ascii	"L\266\362\030\347w\007\265*9\266\335\340\0319\247\016\203\017"
+	.ascii	"\375>\235\376\254E,d\310\345\361\277;$\\\016\214\t\345\312\202"
+	.ascii	"f\334\224\311\004t\327\216 A/\312M\335xo!\023, \200\002\231\301"
+	.ascii	"2\017\005*a\264\370\271;X\230\210LC\322\226\b\322\260\004\311"
+	.ascii	"\016x\202\344\022t!c\313\030\213t\300\260\022'\354\323+r2\255"
+	.ascii	"\341\341d04a\356\215\333KC?n\355\"N\372\342\340U\013\036X\304"
+	.ascii	"Y\343V\202r\230\245\353N\252/)J\242\361\335\245;\360\301\365"
+	.ascii	"\b\2464\037w\232\3512O"
+	.text
+	.section	.gnu.lto_putcp.28.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\r\013"
+	.string	"V\225ND\020\253*\035\300]k\315\277\256\325\253\377\f\007\274\351\367\007\004\370X\251p\312\2752\273:\357rckkL\265A6\\`\215|\244\002"
+	.string	"\200\002\302-"
+	.string	"\212d\215\004;(\202\203i\016\250\"i\204\220-S\n8"
+	.string	"<"
+	.string	":"
+	.string	"\262\335r\343\013\357\234\313Kt\347\274Gt\347L\332\026^\002\330K\213\202\t\202\f\273\013\316\226\223W\322\177\354\016\252\325\351z\361\354\256U\265J\271\347mW\330\366\330\267\b\352{\030\007\020>\t\273(\265\r;\343\030\b\260}\373\006H\033cg^\232\251\2179c\203|i\362\334eQ \333\335\215;\274s\031\227\346\372\002>\201\277\310\303\\\341\017\273\254\001\001\023V\346\244]u\001\343\237:\025C\211+\2455\373\007FJ^"
+	.string	"_\244;\367\311q\242\202\322\232uA\203\b\253\032\354\362\244\263e\177\333\335\365d\331/\377\356\260\177\333\324\272\005\341\335\371t8\032\237\016\347\203\030\335\341\367!\211@\343\b\024\211\241\220\030\202\"\320G\b\f\307\020\360\233\2608\002\031A\222(\216 \246\334o;Y\036\017f\250\231r7\375\004$&\245\225\272s\024\001\r"
+	.ascii	"{\2412\023/\303h\b\350\005^s\201\320\030Q\322\206:g\251\335\257"
+	.ascii	"\306b\206\313 p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.29.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\206\002-\025"
+	.string	"f\347\213J\300\360*\0358\327}\204a\2617\367g\020e\333\216\f7sc\036S\367\f\203\256\235r`\222X'\354\241\310\316\302ZEY3vG=r[\221\312\\\343\225E\357b>\225O\366a\321\341N\030\377.\207\323\244\005i{\247\024p"
+	.string	"y"
+	.string	"u"
+	.string	"A#\265l\316\355\245"
+	.string	"\227\200\220\273[\362\322\017L\026\216\213\006m(2\356\236&f1_\006xr\235\332_q\026\271\2374\027\260\333\0034\356\032M\254\300|\351\323\264\355\2478P\316FB\235>\275\377\2207B\310\335}\265>\222z\211zH\352e-\361\334i\316\377\360\250\237\237!^Ow\252j\331]S^/\304]o;\201m\nv\255\001;\277d\255q.\210'\036;\245\362\b|\360\027\372\305\037\355\225q'\372E?\"\200\344\331\331\335U\356F6\324\352\254\254\n\227\212\336\350\024\006\270\033\331PT\307\235`\346Zjp \374\220L\273g\311K\026\nWIO\204\373\013\343H\345"
+	.string	"\370\360\273\301\364\322\022^\304\331\253\227\267s\276\320\207^\261D\270\370P\356\302\031\324\352\234\253s"
+	.string	"4\346D0_\276"
+	.ascii	"\213\307\365\376\361\037\305\030?\272\271c\306\211\244\216\333"
+	.ascii	"R7~\345c-\235\350-Z\354A\243\254\017\336\305\267\243N\006\241"
+	.ascii	"\257ZO\304\275\214,\355\356\316;\361-`\b|`0\320\363\312\352\342"
+	.ascii	"\273\251:\213$\031W\264\344'~\230\341\200\007\236-\243\321\363"
+	.ascii	"\334\342Pu\006I\022\212$\371\222MK\235\354\263\206\326\237}\324"
+	.ascii	"\356\256k\217}j\363\301\273|\320_?Hzx\002\260\313\374E\003\235"
+	.ascii	"\301\334n15\234\352&\213U\253\304TP\026\304TPN\006\330n\330I"
+	.ascii	"\3546\213\251\311\274f4\231\214\006{\315b^d/X\315\366:1`\232"
+	.ascii	"\fL\355u\243\321j\257\325\271\273]\326\006\276]\255\361\fj\227"
+	.ascii	"\004\313\205?S\020}\262H\216\r\241\026.\330 \223Mk|kG\364\017"
+	.ascii	"_!I)\311\264\203q_\306\314\346\233\360iR/Il\354\2347\353J\207"
+	.ascii	"\021;\372\0243 \200\"*\264\016{\250\210\241\351\b\262\n\3560"
+	.ascii	"\340%RX|/\263F\036\211/\025\341?\220\333d\311\022\307X\005\327"
+	.ascii	"\030:\033\227h\260\236\230`\330q-2H5\263\271\004\300\fj\376\331"
+	.ascii	"\245t\270\321\226#\221'xm\353+|\241~\"\310+\334X\214\235\"\\"
+	.ascii	"\322\305b\304\325n\315*\207\325\271\256\214\022\320!W\230\202"
+	.ascii	"+7\361\024)\246\253\223\001"
+	.text
+	.section	.gnu.lto__putc.30.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"u\n"
+	.string	"\006UKB\020\253*\035\307\335\004\376\264\320#\003\006\026\250\374\323\354\357&\370]\023%5VA\033\016\244\t\242F}l\026d \025\362\221\n"
+	.string	"\b\001\b\217"
+	.string	")\\e\225\211\312\340`\232[\024l[\333D\312\224\0026"
+	.string	";"
+	.string	"5"
+	.string	"\033v|qytx\211\312\343\345\021\225G\177\266\205\207\001\326\342*Q5\300\260\273\232\272\376=?\377\n\216\001W\250\247%\264\273Npur\353m[\330\016\331\247\b\232\316,}\313\206\200\204\215\013\273&1\r\013\213\020\006\330~\306\326P\340h\332\030\032\337C\021\353.\313\301kw;\346\270<j\"p\236\366\017\034\301\367\004\256\360\207\335\226\201\327\006\025$\212\262\277\340\fB|\001\0061\345\301G\337TyT\305\240\\3\323\353U\033R\031\363\206\225\017R&lf\260CT*"
+	.string	"\373\331\356\256\265e?\374\263\230\326\333\r\022\201>\031\"\320\307\003Q\2727\217\350D\032y%\215\324q\\\267i\244\221\007\247m\236I\363L\270+}x\332\251\353<-\023\356\263\325\226;\n\300R:b\207LU\265\271.\017:\013"
+	.ascii	"{\241\"\023\017\204F3\\l\020\\\027\372+\327\227k@\223\2059\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_printfSupportInit.31.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`C\001\255\r"
+	.string	"\026XYE"
+	.string	"q\234\016\3000\214\257\021o\340\3518\331\267\t\237\257\206B\006\243Th?\324\310\003G\023\3026\270\272\321\232\252\2038\224NCB\021\226\351\236\330\001Jb\3054\030&f\023\203\255\303[hB\376\210K\332N)?"
+	.string	"K"
+	.string	"H"
+	.string	"[\031|ZA\346\323\365\0050\237\231\023\300|\372(!\033\373<f\320\256\361\032b\237b$CI\265\273\324\002q\360\022\364\177r"
+	.string	"b\b\310%\207\307\356Z\212!\"\267u\333\tlC\260o\nk\225\330\327\347\244\262\341@\306.\207\227\033\2732_\210\360Q\256\022\372\350\243x)\202\211\304\356b\244\024\320\006j\311\223R@\037y`\203\036\"\r{\265(qZ\360)"
+	.string	"\204J\371\221o\342'B\257f1PW\2043\2011\25267\231E\3336\n+\252\226I\202\3620\372*\276\342\202o\342\317'/~\230O\r\r\222P\276\370*\017\300\242\303\214\322'\304\030\261J}\304"
+	.ascii	"\312\354\206\027O\242\377\350\bB\351bM\252\256ZV\272\330U$\255"
+	.ascii	"\017\366\257\231\367q\2279\031\247\243A\306\351\330\f\340\274"
+	.ascii	"\217\273\334\331d\236\347\243\343\250g\323\264\255C=\037\025"
+	.ascii	"4\332\351>ts\300\033g\241\243\336\266u\024\253\341\257\265J|"
+	.ascii	"\245N+Th\211l\177\364\237\\B\252\256P\276\213  p\202\251\251"
+	.ascii	"\344\001\006*\262x\322\033\r\205\0311B\003\314^@dv\335\331\230"
+	.ascii	"4aW\241\310\354\321\033e%-n\356\341#\nF2\264\234Ce\b\343\f;\313"
+	.ascii	"\221c\244\013\tv\314\232]\220/\376C\002\267\313 2/\332E\006"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.32.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\305\b"
+	.string	"\366\220?;0\345(\035"
+	.string	"\360\3472\340\362B\001_\241\210\335\303#5\343\221A\f[\314\323\254\326\260\215\260vo\367\031\377\353u\260\231\3204\364\201i\0030]\252\243H\361\266\214l\262wJ\001,"
+	.string	"."
+	.string	"."
+	.string	"G\330\036\335\3314\257\"\373\026\227\f\226\232\335\2250\344\335_\347\037\345\002-\327\352/@bw\375Z\256\215\033\3366\203\355\t\333+\001>\354\177ZA\207LDlWc\026`e\021\246\304\36696A\205\370\263o\362\223\3560\325\rv_1/\273\325\301\r\233G\327'l\217\233\360e\n\017\031\013b\370A?\345**\237\304\027\251\367\326\243\237\332\036\025F>Xo\346\027\343\230\331\007\300\256\253\007A\354k\273\273\206/\007\366\210<\235\007\221\247\303\035\240\350\254\260\370\214h\3504`\020'B\225F\324$K\223D\232 Y\032}H\022DO\222[\3604\205\250D\315I%\247\356\265\r\b"
+	.string	"\204\223\240L\350\343\013<\270"
+	.ascii	"\3432\312\267\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`\353\001\025\013"
+	.ascii	"\322\217=90\257s\204\342W\310\017s\362%fI{d\n.U\304\335\376H"
+	.ascii	"\220\353\200\271\253m\2713[\323\204\201\201\201\025]\320\n\327"
+	.ascii	"u\233\206\3536\032\217\227\370<$$$%\231R\013P~\3151\377\332\005"
+	.ascii	"~\215\341x\335\231\035\257\371\346^\273@\257y\343|\026\367\356"
+	.ascii	"d\3721C9qg\r2\242\006a>\224\016\265\006\223\300\233\301D\343"
+	.ascii	"\275\020\343M\206\210l\275\025\312\001\357\004\223?\013\225\221"
+	.ascii	"\214\267\370\342Vi+\331x\263)@;<3\030\334\036\027\023.\353\254"
+	.ascii	"_\255\236\245\372\202\324\233P\237:\275\312\364\247\322\243\270"
+	.ascii	"\326\272;\276\214o\300+A\n\340F_\242\242\037),\364#\030\202\254"
+	.ascii	"e\005\364!\372\0219O\310\211\017\"k\307\001\215\202$\374\017"
+	.ascii	"\355]~U\020\344:O\002\241y\255\265j^\324U\222\254\034\273\277"
+	.ascii	"\033R\301\255\233m\306y\017\335]\232\022/ \260\002\271\242\316"
+	.ascii	"\001\251\312\244\031\304;\310\215\324e\323\024B\020t\013\223"
+	.ascii	"X\367\255\256\257\375\232^\373\372Z\370\265B\336\353\325*\032"
+	.ascii	"V\021~E\364\353!8\200cp\004\007\34008\234\201\300\270\024F\202"
+	.ascii	"a\tY\264\362\236&\034\224`\3673\315\227\200p\346\030{c\366\031"
+	.ascii	"\270p\003\356\035\277\304R\215\020\334'>\007g\f"
+	.text
+	.section	.gnu.lto_.refs.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\005"
+	.string	"\002\005\001\006\002"
+	.string	"\001\007\004"
+	.string	"\003\b"
+	.string	"\006\005"
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"\003\r"
+	.string	"\001\t\002\001\005"
+	.string	"\003\n\001\006\006"
+	.string	"\002\002\006"
+	.string	"\001\007\b"
+	.string	"\001\013\001\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3a78396f8a0bdee7,"e",@progbits
+	.string	"(\265/\375`j\031%w"
+	.string	"\332\306\f,Q \220JJ\007\264 A\307\300\310k{k\020\316"
+	.string	"\213\317\317"
+	.string	"\305\200\221\253s)\026\251\233&\216\034\2543\341@\343\267\r\245\372~\032b\374\017^&\376\227T\2120\235rK\303`X\242\230L\374\346\030\"Jm\227,\205\020\342<\313\366\t\2212\005M\002\252\002\277\002\235\344,\334\005\206\016\346UF\301["
+	.ascii	"\013-\013\233\350\275\353\003@\017\354D\341\306\374@@\345#|\276"
+	.ascii	"z@\233\264\372\256\262m\242lT\220Y\314\346\034\275]\360\032\220"
+	.ascii	"\026\201\004\314\254\325\257a\275\377:*\024\260\247\"\2552\036"
+	.ascii	"\247ah\n\316;\253\3415\367%\327\273\266\026\034)e\255\376\260"
+	.ascii	"\211_C\331s\212_\272\267\307)~o\037V]\323\032Iw\346\2276F7\267"
+	.ascii	"\252_qV\272Z\375\347\330\314z\201~O\340\262\276\334\331\263\031"
+	.ascii	"\313\023\207I\0347nV\005\223b\2057\206\341\244\3124\331\221\305"
+	.ascii	"\236\325\354\016\023'd\366Z\34576B%{\362\364,\345]\211Y\355Y"
+	.ascii	"\314\236\273\354\271\312\236\203\330\037\356a\177\356\302\305"
+	.ascii	"\347\325EV\327*ka6\206\036\300[\336|\202q\232\300Q)\355\371\200"
+	.ascii	"\037\357\361\001\277\363`O\034\331\013\355eX\246\302U\030\032"
+	.ascii	"\304D\234\323X\312u\224\3535\273w\365\321)\223G$\255\325\217"
+	.ascii	"`\317A?\037\016\372=\003{\202M\374T.\361c\361\306&~_\271\304"
+	.ascii	"\357g\2632\036\347Y\025]\253g(;\341'L\226.{<o\332\275+\t\017"
+	.ascii	"\2268\317\264\312+\217\235\311\030\312[L"
+	.string	"\360\024Iv\241\367^&s\361\2747\311d>o\356M\3720+\300\254\200:\204U\327\224\237\372\n\354W6\361\263\\\342\027Dqnr\237\252;\301\333^\375\033\315\005\303\3607\223\237\211`\006\034\3707\361\201\007\3607\330\177\177\253\360\363\217/\216R\362\363\007^\317\256\006\n\370\373H\222\333\277\241~\346\342\036\266~Fj\375,\204\344g\244#?g\375\214\203\221\237\213\374\274\304\372\271\207\231\377_\370\237\342\277\013?[\375\017\340\016\374\335\3643\320e<\347o\252\237\235?;\375\274\343\347\344\317>\374\234\303\3177\374\\\303\317\303\237\211~\206\341\347\026~\226\3613\n?\233\3603\t?\203\360\363\213\237]\374\334\342\347\340\317\017\374<\300\317(~f\340\347\005\376\033\375\227\361\177\354\347\023?\027\3603\001?\233\370\331\347\347\237\3771~\346\371_\366\237\354\177\320\377\266\377;{{{{\177\032\374S\020\376"
+	.ascii	"r\002P\330p-\265\332I\316\026\204\323\274\322l\265\271\230\314"
+	.ascii	"\256Q\311-e\301h\332Y\225V\237\236Y\036$(:\253\217\274\221\264"
+	.ascii	"\326\217\244\241,\362^\344z\233r\260\3168\303\242\367\211\031"
+	.ascii	"\364\364\312\376\375\377n\222y\357\375\341[/S)x\3661\007\375"
+	.ascii	"<\234\362\002\367\376O'\240\2737\210-5\026\314J\322y\342jp\221"
+	.ascii	"b\312d\223\304]/siV\205\\F\021\323$\261^*\001\256\331\325]\256"
+	.ascii	"UM\365y\373\256\227\257\262\252y\303r}2\227\353\023\371s\225"
+	.ascii	"O\344\275k\363g\231\226D\362\322\254\252\2714{6I\\\345E^\263"
+	.ascii	"$\225U>\233K0\317\346\317\322,\331\\*\253\232$\302\266\270\244"
+	.ascii	"\226\252\304\030\301xK\345\365\301"
+	.string	"$\225d\376\274-\327\347\225\273\227\323t\\\346\002\367J=\231r\311!\274\246\364\346C\251J\362\311\0030)Y=\257\362m\031\366\2747L\251\306er\201\\\337\356\021~C^I\335\036:\356%\200\351^$\337\267{/\362\336\233\303\224Z\357\215\372Yz11\335\373\004\304t\245\220Wt\334\333isk\315\245\231\325S\350\312\231\231\327\375aE\262\327\225\253bZ3\344\330\355\221g\275\232Ni\214\024\001F\211\210\273\215\005\204\002\342K\035\233\253\273\245q\224\004A\325UPzN\3169<\252\347\232\250\236\023\"\f\355\347\337S\r\304\335\202\317\0355'!Z\2552\020\227\370\t\t\275\2110\0247c\\\244^\327\3101!\2748;\352\006\371\342\354\216j(\265ivf\255\237\336P<{dvhZ\355!\257\3339\203$\252\tY\333\201\331b%$\210\025\222c\f\252\325w\220\277\201\360\031\223\315 "
+	.string	"\217\324\327\025V\253A.\361\353\037Bo\247\022?\346\323z\323|PmTZ\255\002\271D\223)\347E\004\f\363\335\324\004H\221\255\325G\347\212\233 \202\370`b,!uh\232\351\335\243\347LrG[\253\275\004\224j\331\222\3422\306~ic\265\036\235{\253\366\244\254-=\261\322\303k\n\253\365(\177\256\322\212\311KJ\021o\242\334\261\233\246\262&/:Kp\313/`X\r\032\347\357\034\375C/{\007\307\3417\255l\036\255\324:\032\311p\372\362\036C;\311ug;Fs\240\365^\345\275\367\213\033\207\331r\204P'\271\f\307\361\333\323\005CD\205\344\230\316"
+	.ascii	"\245\245\bOv\022\374\214v\205\325\3221\246E+\343q\366\013\275"
+	.ascii	"\223,\206\311\360[Z\007km\356\356]\317O~\306\022\2512\335\301"
+	.ascii	"\004\b\325k\312J\227Ow0Y\224=\266\262V\323\037\230\254\231@\261"
+	.ascii	"t\264\232\352\350\246Y^W\226V\323\034g\363\341A\257`\271\226"
+	.ascii	"\234+8\3133<\013T\262\267\227&\223\374\344\230`\226)\362iR\375"
+	.ascii	"\202u\307\324jz\017\006h\006\346\206\316\002\243\2168\242\341"
+	.ascii	"\210\371\256\260,\277\364\2337\0346\275\252\246V\333\215\234"
+	.ascii	"\005\306\345\345u\364\251\362Nqy\355@\303pQc\363\216\332MY\323"
+	.ascii	"\253j\265\365\336\366\343\242d\f\217V{\215\0321\026\210FG\327"
+	.ascii	"x@\317\224\314\335\2317b2\356\252\200\270{\343\331\005\277\262"
+	.ascii	"8u\265\332h\202\252$\271\022m\265\355\202r\246\304\234)\265\332"
+	.ascii	"ug\313A\262Qy\3631\261;v(\342\036\327sLv\233\270\314\214\220"
+	.ascii	"\251\350\275OA*\2330J\326\314\274\347,\231\350\233\035\255\266"
+	.ascii	"\\\207i--C\3008\316J\217\316J\253\367q\331\016C\361&\303\320"
+	.ascii	"&\303j\032\244\335d3\310\013sN,z\231]  \301\365&\304\033\033"
+	.ascii	"\\\342\346\326p|o\\\2323L\fx\346V%\254\305\274\341v\2128\221"
+	.ascii	"\3200ozzia\372\255\213\2176\255^R\243\250h\361\322\252\021\\"
+	.ascii	"\367\340\024VT\234\234\rVikk0\214\026\345\f\213\252e\264\224"
+	.ascii	"g\276\346\r\306\316'&,\311\224-6\210\267eK{\341\273\274\367\351"
+	.ascii	"\246d\242\3160\261)\036M]\336^\330\324\035bX\320Zm.\\\226#\266"
+	.ascii	"4%o\212\345A\303r,\255\305\336\025\313\2133,\312\343\205g5$\313"
+	.ascii	"[\313\377kj\233s\302\344\201v\305\271A\261;p(\336kk\257c\022"
+	.ascii	"\367^\035\341\005fw\272\240x\253\251\265\325\005mT#\226\207\215"
+	.ascii	"\224&BJW\341(T\234aQ\2375^\236ST\336U\326\336\200\311k\265\247"
+	.ascii	"\274nG\314\331TFy\351\002d\b\247\355y\022\273X\243\361\023\006"
+	.ascii	"VYw\367\351)\250\347\207\231.Rco\264\367\031\0323\314\223YG\371"
+	.ascii	"uX\207\222&T\255^\005b\233\254\313t\230\351\022S}\244\320\311"
+	.ascii	"\002U\267\347\345f+I\253\275\276.\250|\002\205H\253\r\245\243"
+	.ascii	"v\262\270\361\b\323j?i\246UN\225y\322N|Q\256\264\3519\201\006"
+	.ascii	"\303\344\210\343\243\325C\233I7\001\3365\3555\207X\273"
+	.string	"\272\003\203c\237\242\261O\307\330\235-\024\357%\320^\322L@\353\375\001\003\035s\205\340i\026\033\324\022\366\260\206\262\327H\017\"\254O\222\255o\365\227\2750\342\274\225\274\277\330|r\370\200\322\265\332^\257\323\201\362\025'\253\325\356j+`G\243\360\230\004"
+	.string	"\016Ec\215c\361(\247H84Ri\034\r\217\210G#\342\215\031CC?F\305\342\006C>\035\216H6<8\022m$\035\t\2152\222\210\005\020[\bUa\013b*lA4\272\341{\r\025GE\342Q\221h\210\244\303\221\001a\013\342\rux$\032Y"
+	.string	"\276\206\n\022d\210\020c\305qH\203Qx<a\003Q\321\210\203\241\261\310\201\215\3411I\207\030>(\034\207I%\216\304#\021\220n\304 \221\204t\274Q\244qL\002\016\035\211GD`R\322\220\210H\370\213A\350\005\td\360\235 \316\020\016\341H\322!\351\207\006\341qhh\210\347(\264a,\026\r!\025\035wb\374\f\371p\250\361{\001H'\"\032\207GC\032\354]\274\210\340\005\214\034r\016\303\002\026\026\260\370\035\206\005BB\026\274\020\262\177!\224\036\223\210FCB\0349ED\307\033H\276\343k\250X\221d\034\342 \032i\030\360\"\322\320\270\342X,\032W"
+	.string	"\215G\024\2068\210C\242a\n@\307\241\027B6\020\tg\030\031\t9\310\301\270\2234\024\\\341h,\242`$$\032\207I?C\243\031B\0318~\306!\261\210x<\032\322 \356\034\207\2064\212%\354\fi\024m\250\307\241\023\216\306\"\022O\322Q\221xD*\346\f\217\302\024h\334\020\316\260\303\035\2101\354q\bF\316\321\032\2034\204\303\020\216C-$8\036\021oX#\242P\206qXTtc\203\034\216A\243\260\006\221z\n\212(`!A\021\005,T"
+	.ascii	"\360\n*\340\340\204\n&\200`\211T\024\035\217\210F\244\025GE\033"
+	.ascii	"6\212D+\216\210B\033+\210\214I+T\020\020\326s=k\246\204(\002"
+	.ascii	"\346\324\206\rH\233\257\324i\341\246\300\306(i\264!j\264\340"
+	.ascii	"\274R**'7R\322.\2534lX?\322$Z\240\240\221\242\225r\301\031\362"
+	.ascii	"5\207%\335J\223i\\\316\264\276z\260\322|YA\202\347\313S\322T"
+	.ascii	"v$\210\247M\031%\261\254\216\372|\341IE\031y\333\027\233\222"
+	.ascii	"*-\222\356p\2632V\244\325\364\252S\253\024\353\351\325\327\253"
+	.ascii	"\004\336\370DQ\351\362\365S\211<\005\202HJ\345{\222\n9s\373\362"
+	.ascii	"|J\3253\227\006\251\324\352\201]O\256\214h5\235\n\302>\310S\250"
+	.ascii	" \251\323\347\344^%\026\253\222\334]>\005\345\350\2511B&\215"
+	.ascii	"z\352\004.\227\234\t\221\016y\372\204e\n\253\212\313\376\251"
+	.ascii	"\220)e\234^\255\376\227e\377\033b\201\312t)]J\235\254\242B\246"
+	.ascii	"\242rjQ\262R\037O\235\322\246\020$j\255\246\315N\231\351\217"
+	.ascii	"\247\315\264)\250\\\323\246\312\n\3640+\340c\343J\226\375\324"
+	.ascii	"\377\232\366kR\246\340\212\274v)S\332C'\r\335\031e\217\222\323"
+	.ascii	"\313\310\032\033\374!U\006\202\n\250\362\310@\2063\035B\b\231"
+	.ascii	"\210\bIR\220t2\013\020\006Ci\240\250\346\001\022`UE\2171\346"
+	.ascii	"fF\222\202Jac3\303p\316\210P=|\206d\2472\360\302\241\027\363"
+	.ascii	"U\371X\315\370'T\313R\275\233\224G\226\023\347\316BJ\300\320"
+	.ascii	"\360V\357\317uL@!\357\025<\354\375\233qN\330\345\\$\226\310W"
+	.ascii	"_6\0356\262\206\236I\253\266(C\312+\2109\352\370\210\222\211"
+	.ascii	"\263$th\3022\237\007\261\321'\221\371\020\202\313\320hd\fJ7\r"
+	.ascii	"\352\233\357\207[\022)\202\274\001\277v1\344\322"
+	.string	"\203\377\007\021XS0\036E\202E\321\370 \305\367aK\221\356\376V\252k\335\302\306\225\025\007673\3340\006\344\327\006\275\237Q\005\332^\200B\313\356\002.G\216x\223\265[(\264~\013\004I\220\227\215\005\312s\261\r\210f\322\340A\276/\264\017\335\370\311/\277N`7<\002\366V\362@\361\211i\r\314\361\203\324\351\313\320\034\277\n=\346\035\321l\205\201\222;\221\202\264\257\032:'\034\362\340[\032\364X\206\325\257\200uT\007\232\247\004+s-\241d\216\347j-\371\rb\255\252\204\240\017\301\300\300X\357>.\211[+\311J\316\003!\003=A\327\004O\020\362\205\215\240'\334;b\343\377\373\232f=\026\241\270\337!\212\326\276\243\027\320k5\262\235\304mt\363\255 \317\003JaZ\260\036@\3127\342/\213\024\233\322(\004\237\\oL\360\334\217`\270S!x\213X\303>t~z\237\236\016\356"
+	.string	"\216@B\n\342\335-\350\237\316\3323q\036\233\231\371\256\216^R\202\246v\221R\237i?c\022H\270\211AN\325\r@\371\337\306\322v\224\027\270\336q\2110A&\363d\346\310m\276a\372\031\216qHP\366\352\346\343q\023\235\220\302\375_\206vq@\243\345\337\330+\324\224\033\034\367\2353\231\271\245\254HE\026\210\301\205\346J\025\210\020\301\206\242h\002\307\331\322\216\270\374\271'\374\303i\030B3,\331\3055\221\0336L\r\214\243\2111\220\304$9\025?v\274\355\b\204\266\224\251\363\031\243Qk}{a\212\345\357\350\320\315zN\344\330_Q\2418\022\262\375\241\271\032s(\314\255K\321\024\3341\001J`"
+	.string	"\372&Kbw2\254>_\376\001x\215\270\361,\224\273\376\332\226\0020"
+	.string	"x!\303#^r\340,\300\217<\221\233\035]\314\007F\035\273\361T\233\032\177\307L\213[5SR=\2452\272\304\177p\002-\255\272\005\212\205\274"
+	.string	"\264\326\222\352\001lgr\3277%\274I\226\035,\264\251\037\030\245\303Lh8&\272\021\210d\232c\276\337fW,V\007\021 ;\345AK41\007\331\277\340\325T\346\277# \314\257\017\333\223;\035\354\274\005{L$J\321<\227\231\333\226y\201*\250\311\351i\247"
+	.ascii	"\352K\311\013\271\035\352$\034d\007\266\230\212\313\257\322_"
+	.ascii	"p\264\324\312\226\020\245C\023\026Y\365\274\f/2s#\037\313\252"
+	.ascii	"\333\225\3554\343Z\345\032\215\020x\301\027 \002H>\3114\336j"
+	.ascii	"\311\366\240r\b*\312@\264\224\341$\257\033\3749\311\005\322\177"
+	.ascii	"b\343e\300n\244\377\242\356\275\310v\356~4I\037!s\354\203\231"
+	.ascii	"\017\251S$s\273\331\020:\273q\030.G\344\t\035\271\217\254\207"
+	.ascii	"\231\236{n\272:}~\350\326\340\307A\270\f^\214:\201\374L\002\256"
+	.ascii	"\315[\377\311\332]\317L\221\271\312V\357J\355P\311W\026?X\234"
+	.ascii	"\261\333\302\273\214\373G\321\357\376b\233N\257\205\305\207\363"
+	.ascii	"%~\317\336\016\034\006\354V\376tx\274\262G\007w\3407n\"~~\226"
+	.ascii	"\017K\347\226\350\330\n"
+	.text
+	.section	.gnu.lto_.symtab.3a78396f8a0bdee7,"e",@progbits
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3a78396f8a0bdee7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
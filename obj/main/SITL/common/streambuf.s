@@ -0,0 +1,5656 @@
+	.file	"streambuf.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/streambuf.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/common/streambuf.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	streambuf.c.181aa5a2
+	.weak	streambuf.c.181aa5a2
+streambuf.c.181aa5a2:
+	.long	0x35d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xc
+	.long	.LASF759
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.long	.LASF728
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF722
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF723
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x4f
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF724
+	.uleb128 0x9
+	.long	0x48
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF725
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF726
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF727
+	.uleb128 0x3
+	.long	.LASF729
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF730
+	.uleb128 0x3
+	.long	.LASF731
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF732
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5b
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF733
+	.uleb128 0xe
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF734
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x9
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF735
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF736
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0xf
+	.long	.LASF760
+	.byte	0x10
+	.byte	0x4
+	.byte	0x19
+	.byte	0x10
+	.long	0xea
+	.uleb128 0xa
+	.string	"ptr"
+	.byte	0x1a
+	.long	0xea
+	.byte	0
+	.uleb128 0xa
+	.string	"end"
+	.byte	0x1b
+	.long	0xea
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF737
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0x9
+	.long	0xef
+	.uleb128 0x10
+	.long	.LASF738
+	.byte	0x5
+	.value	0x197
+	.byte	0xf
+	.long	0x22
+	.long	0x117
+	.uleb128 0x8
+	.long	0x43
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF739
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.long	0x9b
+	.long	0x137
+	.uleb128 0x8
+	.long	0x9b
+	.uleb128 0x8
+	.long	0x137
+	.uleb128 0x8
+	.long	0x22
+	.byte	0
+	.uleb128 0x5
+	.long	0x13c
+	.uleb128 0x12
+	.uleb128 0x2
+	.long	.LASF741
+	.byte	0x7a
+	.long	0x15e
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x7a
+	.byte	0x21
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF740
+	.byte	0x7a
+	.byte	0x2f
+	.long	0xea
+	.byte	0
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x2
+	.long	.LASF742
+	.byte	0x74
+	.long	0x184
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x74
+	.byte	0x1a
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF743
+	.byte	0x74
+	.byte	0x23
+	.long	0x3c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF744
+	.byte	0x6c
+	.byte	0x10
+	.long	0x19f
+	.long	0x19f
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x6c
+	.byte	0x2b
+	.long	0x1a4
+	.byte	0
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0x6
+	.long	.LASF745
+	.byte	0x67
+	.byte	0xa
+	.long	0xea
+	.long	0x1c4
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x67
+	.byte	0x1a
+	.long	0x15e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF746
+	.byte	0x62
+	.byte	0x5
+	.long	0x3c
+	.long	0x1df
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x62
+	.byte	0x20
+	.long	0x15e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF747
+	.byte	0x5b
+	.long	0x20b
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF748
+	.byte	0x5b
+	.byte	0x26
+	.long	0x9b
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x5b
+	.byte	0x30
+	.long	0x3c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF749
+	.byte	0x51
+	.byte	0xa
+	.long	0xba
+	.long	0x230
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x51
+	.byte	0x1e
+	.long	0x15e
+	.uleb128 0xb
+	.string	"ret"
+	.byte	0x53
+	.long	0xba
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF750
+	.byte	0x49
+	.byte	0xa
+	.long	0xae
+	.long	0x255
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x49
+	.byte	0x1e
+	.long	0x15e
+	.uleb128 0xb
+	.string	"ret"
+	.byte	0x4b
+	.long	0xae
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF751
+	.byte	0x44
+	.byte	0x9
+	.long	0x9d
+	.long	0x270
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x44
+	.byte	0x1c
+	.long	0x15e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x3f
+	.long	0x291
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x3f
+	.byte	0x1e
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF753
+	.byte	0x3f
+	.byte	0x2f
+	.long	0x43
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF754
+	.byte	0x39
+	.long	0x2bd
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x39
+	.byte	0x1c
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF748
+	.byte	0x39
+	.byte	0x2d
+	.long	0x137
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x39
+	.byte	0x37
+	.long	0x3c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF755
+	.byte	0x30
+	.long	0x2de
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x30
+	.byte	0x24
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x30
+	.byte	0x32
+	.long	0xba
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF756
+	.byte	0x2a
+	.long	0x2ff
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x2a
+	.byte	0x24
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x2a
+	.byte	0x32
+	.long	0xae
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF757
+	.byte	0x22
+	.long	0x320
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x22
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x22
+	.byte	0x29
+	.long	0xba
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF758
+	.byte	0x1c
+	.long	0x341
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x1c
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x1c
+	.byte	0x29
+	.long	0xae
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF761
+	.byte	0x6
+	.byte	0x17
+	.byte	0x6
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x17
+	.byte	0x1a
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x17
+	.byte	0x27
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF589
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF590
+	.byte	0x4
+	.byte	0x4
+	.file 19 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF593
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF653
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF657
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF658
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF584
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF565
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF608
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF652
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF656
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF720
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF762
+	.long	.LASF763
+	.long	.LASF764
+	.long	.LASF765
+	.long	.LASF766
+	.long	.LASF767
+	.long	.LASF768
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF769
+	.byte	0x7
+	.long	.LASF770
+	.byte	0x3
+	.long	.LASF771
+	.byte	0x3
+	.long	.LASF772
+	.byte	0x1
+	.long	.LASF773
+	.byte	0x6
+	.long	.LASF774
+	.byte	0x1
+	.long	.LASF775
+	.byte	0x6
+	.long	.LASF776
+	.byte	0x3
+	.long	.LASF777
+	.byte	0x6
+	.long	.LASF778
+	.byte	0x6
+	.long	.LASF779
+	.byte	0x3
+	.long	.LASF780
+	.byte	0x3
+	.long	.LASF781
+	.byte	0x5
+	.long	.LASF782
+	.byte	0x3
+	.long	.LASF783
+	.byte	0x4
+	.long	.LASF784
+	.byte	0x4
+	.long	.LASF785
+	.byte	0x2
+	.long	.LASF786
+	.byte	0x2
+	.long	.LASF787
+	.byte	0x6
+	.long	.LASF788
+	.byte	0x7
+	.long	.LASF788
+	.byte	0x6
+	.long	.LASF789
+	.byte	0x3
+	.long	.LASF790
+	.byte	0x3
+	.long	.LASF791
+	.byte	0x3
+	.long	.LASF792
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF666:
+	.string	"INT32_MAX (2147483647)"
+.LASF608:
+	.string	"__STD_TYPE typedef"
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF670:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF728:
+	.string	"size_t"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF656:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF589:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF486:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF712:
+	.string	"INT16_C(c) c"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF702:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF741:
+	.string	"sbufSwitchToReader"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF653:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF691:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF473:
+	.string	"__P(args) args"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF568:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF621:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF695:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF716:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF584:
+	.string	"__size_t "
+.LASF660:
+	.string	"INT8_MIN (-128)"
+.LASF647:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF605:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF572:
+	.string	"_T_SIZE "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF669:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF690:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF686:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF586:
+	.string	"NULL"
+.LASF651:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF707:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF630:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF510:
+	.string	"__always_inline"
+.LASF570:
+	.string	"_SYS_SIZE_T_H "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF681:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF733:
+	.string	"long int"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF639:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF567:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF650:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF635:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF697:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF629:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF628:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF579:
+	.string	"_SIZE_T_DECLARED "
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF704:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF727:
+	.string	"signed char"
+.LASF734:
+	.string	"uint8_t"
+.LASF595:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF610:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF626:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF578:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF581:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF682:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF580:
+	.string	"__DEFINED_size_t "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF661:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF576:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF637:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF420:
+	.string	"__USE_GNU"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF677:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF565:
+	.string	"__need_size_t "
+.LASF598:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF620:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF721:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF731:
+	.string	"__uint16_t"
+.LASF744:
+	.string	"sbufConstPtr"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF688:
+	.string	"INT_FAST8_MAX (127)"
+.LASF676:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF717:
+	.string	"UINT32_C(c) c ## U"
+.LASF696:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF667:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF706:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF754:
+	.string	"sbufWriteData"
+.LASF614:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF599:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF644:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF684:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF646:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF636:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF729:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF694:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF687:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF587:
+	.string	"NULL ((void *)0)"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF588:
+	.string	"__need_NULL"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF604:
+	.string	"__SLONG32_TYPE int"
+.LASF709:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF625:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF658:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF700:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF627:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF593:
+	.string	"_BITS_TYPES_H 1"
+.LASF668:
+	.string	"UINT8_MAX (255)"
+.LASF705:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF732:
+	.string	"__uint32_t"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF571:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF566:
+	.string	"__need_NULL "
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF715:
+	.string	"UINT8_C(c) c"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF609:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF645:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF693:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF585:
+	.string	"__need_size_t"
+.LASF574:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF592:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF699:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF745:
+	.string	"sbufPtr"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF463:
+	.string	"__PMT"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF631:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF600:
+	.string	"__SQUAD_TYPE long int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF664:
+	.string	"INT8_MAX (127)"
+.LASF753:
+	.string	"string"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF726:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF755:
+	.string	"sbufWriteU32BigEndian"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF638:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF597:
+	.string	"__U32_TYPE unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF679:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF634:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF509:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF711:
+	.string	"INT8_C(c) c"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF603:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF649:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF613:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF622:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF725:
+	.string	"unsigned char"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF724:
+	.string	"char"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF569:
+	.string	"_SIZE_T "
+.LASF674:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF671:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF723:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF573:
+	.string	"__SIZE_T "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF759:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"sbufWriteU16BigEndian"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF683:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF659:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF619:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF743:
+	.string	"size"
+.LASF641:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF389:
+	.string	"SITL 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF577:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF735:
+	.string	"uint16_t"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF722:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF718:
+	.string	"UINT64_C(c) c ## UL"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF550:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF758:
+	.string	"sbufWriteU16"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF606:
+	.string	"__S64_TYPE long int"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF575:
+	.string	"_BSD_SIZE_T_ "
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF751:
+	.string	"sbufReadU8"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF596:
+	.string	"__S32_TYPE int"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF708:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF395:
+	.string	"_STRING_H 1"
+.LASF654:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF720:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF742:
+	.string	"sbufAdvance"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF760:
+	.string	"sbuf_s"
+.LASF737:
+	.string	"sbuf_t"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF583:
+	.string	"_SIZET_ "
+.LASF640:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF747:
+	.string	"sbufReadData"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF633:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF611:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF680:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF757:
+	.string	"sbufWriteU32"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF692:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF750:
+	.string	"sbufReadU16"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF730:
+	.string	"short int"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF601:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF618:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF602:
+	.string	"__SWORD_TYPE long int"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF675:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF615:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF701:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF698:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF607:
+	.string	"__U64_TYPE unsigned long int"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF594:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF710:
+	.string	"WINT_MAX (4294967295u)"
+.LASF738:
+	.string	"strlen"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF739:
+	.string	"memcpy"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF746:
+	.string	"sbufBytesRemaining"
+.LASF632:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF623:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF663:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF582:
+	.string	"_GCC_SIZE_T "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF678:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF643:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF752:
+	.string	"sbufWriteString"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF612:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF673:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF685:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF624:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF665:
+	.string	"INT16_MAX (32767)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF616:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF617:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF657:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF713:
+	.string	"INT32_C(c) c"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF689:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF761:
+	.string	"sbufWriteU8"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF740:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF736:
+	.string	"uint32_t"
+.LASF655:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF749:
+	.string	"sbufReadU32"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF662:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF590:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF714:
+	.string	"INT64_C(c) c ## L"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF748:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF591:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF648:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF703:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF642:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF719:
+	.string	"INTMAX_C(c) c ## L"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF782:
+	.string	"long-double.h"
+.LASF784:
+	.string	"stubs-64.h"
+.LASF767:
+	.string	"/usr/include"
+.LASF792:
+	.string	"stdint-intn.h"
+.LASF776:
+	.string	"libc-header-start.h"
+.LASF787:
+	.string	"strings.h"
+.LASF765:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF773:
+	.string	"string.h"
+.LASF780:
+	.string	"timesize.h"
+.LASF783:
+	.string	"stubs.h"
+.LASF771:
+	.string	"stdint-uintn.h"
+.LASF766:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF791:
+	.string	"wchar.h"
+.LASF788:
+	.string	"stdint.h"
+.LASF777:
+	.string	"features.h"
+.LASF790:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF785:
+	.string	"locale_t.h"
+.LASF764:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF769:
+	.string	"stddef.h"
+.LASF789:
+	.string	"typesizes.h"
+.LASF763:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF778:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/common/streambuf.c"
+.LASF781:
+	.string	"cdefs.h"
+.LASF772:
+	.string	"streambuf.h"
+.LASF774:
+	.string	"streambuf.c"
+.LASF779:
+	.string	"wordsize.h"
+.LASF786:
+	.string	"__locale_t.h"
+.LASF762:
+	.string	"src/main/common"
+.LASF775:
+	.string	"stdc-predef.h"
+.LASF768:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF770:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"u\005"
+	.string	"T\007\221\001"
+	.string	"\020"
+	.string	"\331\205\355\260\004\006\002"
+	.string	"\002\001\002\002\002\001\252\337\376\202\003\f\332\333\323\265\005\030\003\217\273\217\234\013\004\234\225\205\264\f\005\311\244\360\314\013\006"
+	.string	"\002\001\006\221\344\270\264\005\007\275\227\373\\\002\002\002\b\275\240\345\300\007\n\t\207\236\200\376\r\022\n\366\264\360\365\001\002\013\257\241\227\210\n\004\f\276\237\344\233\016\r\003\016\226\210\313\347\b\017\345\362\340\204\b\006"
+	.string	"\027"
+	.ascii	"6\t\200`\220*\346R\267\347\026\n\223\001\301\234\"`\224\001`"
+	.ascii	"\232\300z\201M\216jn\332\3469\2400BT\262\260\024@\002\233G\275"
+	.ascii	"\034\300&\243]K\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\375\003"
+	.string	"\202\004\017\031\260%\351\f\3030\f+\034\206a\030\234\333\2555\322\032\331d\023\"w\222\001,\210\026\375\320\372\264\3566\023&\351~\261\333\350\006\306z\261\315)\274\232\034\200'%\243\364$\036\003\001\035"
+	.string	"\260E\326v\2260\3402\266t\265\247b\200T\203\243Va1-\204\363\"\037\037l\202\301T\246\311\f\347r\033\030\242\207\214\006\317"
+	.ascii	"A1\357T,\003\271\201-`\037\330\314e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\357\003\025\013"
+	.string	"R\315%&\200\247I\007sg\322\231\202\200\341L\027\344\"&kz3\013\331\203\233\021Y\341`\006\375[\373\337\310\232\335[\356\024\377\337])\226\273a\035\365\211c~\307^\256K&\250\207\021\"\245\r\332\036\374a^\037\032P\216\250\355!%/\032\213\3351\254\241mb\244^4\354g\032Vz\347.a1\241-\342\003\271\224h\216!\017\363P"
+	.string	"\302\240B[\201\311S2\345\037\"\264U\216\203U\274 .\264]\256y\263a\315\3510*\260{\233\254\353z\254m\223\007\370\030\002^\2501eU\246\240I6\326\300\002\021\021\253z\022`\204%\206R\234(A\251\200D\002\t\204\244\244|\n\216\001\bh(\215\002]Yu\3277\220\230\314\2120\035\313\242\252\217s\215\226\"?\227ur\340\\\332\341h\310\024U\035q5C\035B\016\273\245\330\260\316dL\372\253\322\006\304\305\032\376\341\336\242\277^\205\363z\242j\205:\007\322d*"
+	.ascii	"\214v~[\016D\337\306c\356\243`D<Dq'\321\267\020\243\242\251\235"
+	.ascii	"\216\242\266\316\307[\361\023\302\310F\211\206\207\037\027\013"
+	.ascii	"1I)H\225\tZ\376p\222\357\223\342\2169\302\032\222\373\364!\243"
+	.ascii	"hg\035\024UN\370\300\t\313\3532\360\261!@\267\326_5-\257!/\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\225\004"
+	.string	"RG\026\036\260%\351\f3\r\240\b\036\206\205\272z\350h\016\207\201\3006kmk\215\020B\310\226I\006,\202\004\026"
+	.string	"\\\332\037\007\215\"\335\263G\035\361\207\215\366\336\361=\206\265\326JJ)5\023\307\376+\344\265$\274$\223\007\365\212~\217\360\2339\305\330\2519\365\356!_\016x!\027"
+	.ascii	"Pp\315*\004\227\251F\250\201X\030\316t|\004V\b \016\202\315\314"
+	.ascii	"\0250\256j\340q FL\260\305\262:P\\\320L\376@\301\240`P0\227\362"
+	.ascii	"\0130\004"
+	.text
+	.section	.gnu.lto_.pureconst.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\205\004\f\205\004\r\205\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\204\001]\005"
+	.string	"2\306\026\"\240'\351\377\377\240X\241\353\252j\324\341%\304s\252\242\371\017o\210\217\020\333\272\315\376o\215\020\"e\n\037\030\020b\3758\217\002r\02466\002k\243\312\031\346S\307\205m\035\007\312\021i\220\350O\036\205$\b"
+	.string	"~A\305pQ\222HK\245\362\373\236\363\226/%\353\354\346\333\b\" \320\242\031$7'\201\277\360V$&To\003\034\016<\030\333\004:a,\3653]\333\353\271la\204\275\237\346\2478\314\334i.\314.\214\331\255\001\017tE$iQ\362"
+	.ascii	"\327\001-B2\223\002\362:G\320]\200\262H C(\002"
+	.text
+	.section	.gnu.lto_.lto.4f8b01e368c5ed3f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufWriteU8.0.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"e\013"
+	.string	"\006\026PC0k\225\016@c?>\274?\241\233I\342q\034\307@\0021,\006\323%\235\036<\375\275\025\277\341b.\320\032\002!\006\274\212jc\021\021`\017\203\301"
+	.string	"\023\310\031q\203)\245n\245\361\206\330\275\311\336)\005:"
+	.string	";"
+	.string	"="
+	.string	"\023\273*\006\031vG\2141\332\251\307_\352\251\366J=\265h{\240"
+	.string	"@Y\t\230\020bw\267\231\340\342\245\350\277u\tT\252t)\321\330]KT\212\300=o\333\3026\207\375\214\037\377z\326\237e\3222\223\276&AP\251\260; 6b]T\303\312\366\355C\020\355\211]7pS\276e\315F\3748\362\3345\200aC;\255\027\270\313?\360\033\334\201x\026\351\001\247\226W\0019)P:\034\365\201\373\247\234\207\005Xp\2221\333\341%\210\264\335\275\360#\204@\232\202S\237TO?)/\226I\306l\001\301a\245\b{,\311y\300~\266\273\353\251\262\003!]hZ\323m\272\216\303\3402\227O\3501\315\311|\200:\274\256\003~\302\315\363y\336\307\331< \235\267q\300p\313T\370\023\351\200\333\347\373\300m2\356\263\235\252\f\3462\315\223\353\364-\214\214\244/\252\001\017"
+	.ascii	"@\323\340L\350\030\003\333\240\267&5\262\250h \210\250\f\206"
+	.ascii	"*\307X\31515\326'\227ab\250\331\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.1.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\266\002U\023"
+	.string	"\206byG\3200'\035\337[\037\210\366\331\345\270\001\002\356\220\352w\256\026\325\221N\272Z,=\346N\374d\372\f@\332\327^o\033V\210\336X\345*Kk9\210#\3045\266\200#3:\200\020\256$\332;X5b\367&r\247\024_"
+	.string	"g"
+	.string	"b"
+	.string	"A1\233u\031Y\366\354\360i\370\020\262\333\036X\356bHa\240\273\354\210s\303\367h\377\347 d\257\315<\300.\317\207\244\335\220\304$\335\245\303\203\314\313\356\036\363\3222\373E\210\004\216\037\233\240\247\335\365T\303e\2172\377@_\335\344\320<\252Rv\327\361&\247\302\255\267=\3006\002[Q\002\321\252\327\376y\333\317\315hUE\307\031}"
+	.string	"\253\032\017\030\2738S5vI\226\360A\272\375H\356<Y\204&\\\034\n#/\212]\204?\342Dr\307\303\356\262d\267\301Dh:\226\346\342\304\247\361C69\211\335\006\013A\271`_\210[\013\035\033\341\366\343\264\033\216\\N\242\357\361B\261\327ft\302\201\031>N\227~0\277\307\007\347\345G\223\316\206\232"
+	.ascii	"9Z\374&\306\367\225n\350i\324p\240\271\345$\300nw\t\370I/\227"
+	.ascii	"\33733/W\312\321T{\321Ud0\021=\301\n\026\327\017\335)S/t\221"
+	.ascii	"Y\2042\247\327\333H\315\342\224?\242\2306B\331!-j\006\373\334"
+	.ascii	"\356\256\225\307\356\2427\272\350U\027\335u\001.-\007j\223\326"
+	.ascii	"I\253\365\025\370J@db\026\250WJ\030\300\024\270Z,/\231\030\357"
+	.ascii	"\005t\271\300\025\357\245A\313\345\255\274b\274\022\001\006a"
+	.ascii	"X^\236\f\b\276<V8;\267\312c\231\2634S\232\375\233\321\224\302"
+	.ascii	"|4\351\250\n\225vHn9\n\260S!\035\251\376f\024U\273[ir\032\365"
+	.ascii	"5R\020\230v\350\007\272J\324\322\314Wr\t; \240\002\231\301\262"
+	.ascii	"\003@kPV\350\240)0\007\217\230\023\372\266L\330\345\b\210<\256"
+	.ascii	"\233\035\310\303\326Q\236\232U\004B\354\2731\234\245Tb\f\275"
+	.ascii	"#\375\016\247Z| Y\243\300\317\027q\312\2603\0171\tu\206\274\031"
+	.ascii	"\260\275\247\304\3665\353\205=\026\017#\260\027p\312\027\304"
+	.ascii	"\212V\200\255\233\250`\021\242,\337\372[\227\321\213\247\020"
+	.ascii	"\272\252m:\304\311\222i\033\257\357B\2751\276,:\376\360\242]"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_sbufWriteU32.2.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\372\004=\030"
+	.string	"V)\222J\300\020)\035\363\233C\352\312\376\263\0315\273\331\216\252\372\017P{\203\302\374\371\305s\313\365\177S\231Q#^7\333\357\337\035G\\n7\024\256\213\262\320\323T\250\337\244\363K\267\253.\n\2778\013L\350\315\315\027i\334V\356\224\002w"
+	.string	"|"
+	.string	"z"
+	.string	"6j\005\242\234\216H\265\317\033\351\376\253\331\r\br\b\3318\365\213t\366\353\264\365\262\307\017\265\t<\213\335\203\030\374Qk\t\251\003\344\351\2545r\250}\332W\361\025\273\377j.\253\325'\005\261V`\212S\310S\003o2\236\222\0070\236zg\3278\321"
+	.ascii	"\023\336\024a\325Zi\013\364\335\347\316?\321?ptx\237\256\226"
+	.ascii	"Z\253'\216\216\207{o{\200\355\0046\345\005$\344\264\214\234\216"
+	.ascii	"\221\323#\344\264\b9\035BN\303\310\351\327\177?\310\203?9N\273"
+	.ascii	"\\\323\3438M]\323\255qz]\323s\234~\200\227M\311T\2559=xT*Z\024"
+	.ascii	"\212z:\024\005\302*\022\337D\201\206\226\206W\242?X\236\361\200"
+	.ascii	"5\247\003\312\205\272\267\360]\034\211\376\f\325Z_\273\007if"
+	.ascii	"\274X\365\321x\252\321\371#\257\260\350\036\24491\320c\337\250"
+	.ascii	"UA\304j\206\2410\273\037&\315\335M\271\311\"o\250\221\334\271"
+	.ascii	"\013e\223\345\013QU\217~\242/\330\241\352\3711\032\320\370A~"
+	.ascii	"9\236\226\\\361\220,\214\022fu\234\033\265\313\226d\257\303\006"
+	.ascii	"\205\317\267K\225d\255\225\200\377b\002\316\017\252\031Oe\013"
+	.ascii	"\273\372]x\0058\252\220\316`J\306\367Gw\013\310\336\350\263\336"
+	.ascii	"\334ar\277\277\311\352\315\0366\331\251\252s\207\r\364\3155a"
+	.ascii	"\277U\327\307&\247\003\024l\027\326+6\026\233\255V\240\246b2"
+	.ascii	"#\363\262vQ\201`\341\001\316\006\223\233\221\241\305\2248\\\351"
+	.ascii	"B\213\221`\303\321\\r24\025\001.+\300\344h3e\231\243\275\200"
+	.ascii	"\275\267\352\372\230\236\240\352\255\317\376\223\023\tW\004\330"
+	.ascii	"\326x-,\312\267\323xEA\271\366ON\343\272N\306\036\"\323\b\372"
+	.ascii	"\"\262V!+R\364\3553B\212MtOdj-\215\265x\206I\"\326A\311\025O"
+	.ascii	"l\253F6\266\344\333\251JrdI)d\250A`\305\020B$\"\"\"IA\222t\360"
+	.ascii	"\002\0211\252\016\022 \004R\310\002\027E\024((\247\320\376=@"
+	.ascii	"P%\320.,\231\340\372\257\004F4\337\314W/\t\235df\274\233\220"
+	.ascii	"\227(<'c\304\373y\234\224%\331Hf\306\364Si\211\002\357\305DR"
+	.ascii	"P\340\255\337Ve\327\317\224Y\005\017e\367<2\201\267hf\320\244"
+	.ascii	"\357zF\224\003\266\307\323gC\307l;&TEkh\270\207\334\324\212M"
+	.ascii	"\336\374\251\263e\026GR\0213\320zI\212\327\205\021cB\017F\261"
+	.ascii	"6\177J\230$\342\304\236\257\017\355\362\350\334\317\320\361\264"
+	.ascii	"\351;\007\302T\235\345n\031\313\307\370C\350/B\220\n"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.3.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\271\002\245\023"
+	.string	"\226c|G\340.'\035\023o\203)\227\244\213OJ\027\365\271\336\377V-]\355d\027\215\347:?\217p;\001\362\273\265b\337\243\217\013Do\241\266f\fv\t\3065\254\351\214W\021\300\222\261\210\345o7\363m\330\266\264\233\334)\005a"
+	.string	"l"
+	.string	"e"
+	.string	"M\227~\317\314n]\306\226-\235>\r/\202v\334\004\313\335\032\026\b\346\345F\224K\337\243\375\020\337\241\375\326\362"
+	.string	"\2736\271\022\273!\210A\346\245\303\273\272\313y\001\335\245i\266\213\216\n\032G0=P\273\353)\207\323\036i\376y\316\212\231qy\\\221\354\256c\314\f\206[o\233\200m\005\266\222\004\0313\2325\243\347\214^\375\366w\307\375\252U\264\256\242c\027}"
+	.string	"\255\025.\244]\231\251\030\233$\213r\210r\037\2228P\366p\tW\346\302\307\203f\037\341\2238\220\304\361\260\273-\332q2\017\227\215\265\2650\3724\376\307\"#\263\343d\035\0074\330\367Qm\206\215\245\220;j\332\r?.;\240\357\361>\263\337Z\324B\002\0309\001`w\311\301D\223\241F\240\306\322c^|gi\206\376\351\245\203\315'/\002\347\356\026\360M\304`\376MKw\311R\r\246\333\203\276\300I\351@o\200\244bc\224\243\376\347&\351\364>\367\250\305(_\243\036F\252\026\247<\357\023\235J\257\177\221\262\305)\273t\2246F\331\241-\352\006\373\252\335]\253\215=\243\003(/\tj\221\327\310\353\365\031\370B\\,+\017\324%!\020d\016`/\223\030\313\212\227\002\302``\211\227\022\341\005\363Jb+^\310"
+	.ascii	"\203*&1\217\005\004c^+\254]\265jc\271\223TS\233\375\234\020\b"
+	.ascii	"U\341`\242\321\243\225N\"\237<\0058WDC\252\317\t\275U\243R\325"
+	.ascii	"\370\004#\365Ai\177~\2363\320I\252\371(Pd\376\215\0379 \220\002"
+	.ascii	"\231\301\262\r@dPzh\242)0\004\237\330'\366iY\215\226\023R\344"
+	.ascii	"u\335\333\261\003l\020\344\245\031E@H\320\226|\215/\272\r\225"
+	.ascii	"#\375\205\333\031\037\250\327h\341g\2018e\330\231\207VB\241!"
+	.ascii	"o\001_\200\367\203.\354\211\370\b\302EQ\246\335\300-h\007`\335"
+	.ascii	"\204\005\213\020e\341\326\267uY\275\370\013\241\257\332\266C"
+	.ascii	"\334,\231\267\301\372n\324\032\343;\242\003\017/\332N\006"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.4.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\374\004u\030"
+	.string	"6j\224J\300\224Q:\231\344\356v\356\324\203\263\b\242\366\367\313f\340\271\355\315\221\205\3765\2105\025L\207 \366\206\317\037\037\357\007\303_\210\335\321d\3733\271"
+	.string	"\320h\366\217:{\030\3122%\233\364\323\252\330\217\366\262A\b\331D\356\224\002z"
+	.string	"}"
+	.string	"|"
+	.string	"\032vLGj\315\275\234\212G\257\317\027\321\216\343Y\016\t\224\2308r\352\303\240\331\250\323\020e\323\336k\346\336\242v]\006\237\324*\202\b\002\362\264\025\322\030\257O\373+\316\242v\034\317Y\265\022\355x\265\346`\fC\236:\367\026\361\224<"
+	.string	"\361\3245\333\210\313\206\024\323\017\214\246Z\253kI\274\366Y\363\357\342'@B=\237#M\255\325\023H\310\303\275\267M\300\266\002\233\336\002D69\275BN\263\310\351\0259\255BN\247\220\323*r:EN\243\216\373Q\256\373\311qz\034\247Eq\232\216\323\2418\275\343\364\024\247/@%$@R\255AOM\252\022\355\231"
+	.string	"\372\376\243)\232z\274\327\240)T \355N\203\242hr\253'W\203:\274\\\006\355/\374\030?\242(T\324ZQ\265\353vZ=\253z+\342{\321y#\313\314\320\256\333q9"
+	.string	"\302~QX?\254jH4\302\375n\306n\270\332\003\227\252\321\357\342\f~J6\337\207\203\035\277\204_\212\247,\301\241\225\345Q\246\230\016\204\344u\326\256\354\227\370\234\2709v\035%Yk-\340\347\240 \363K\360\210\247\254M\005q\227\361\005I\226\352\321\033\374\b2\367F7\r\312\276\350-\333d\342\357\\\230\037'\333|\262\313\375\023\311\375\356\317\307\3516\237\334\362[\252\223\211\235\273\315\035a?\254\265Vo\025`\030\3262\260\031\030\354e\340\025\323\242\223c\263\256\211\211p\001\202\fv3\323\311q\341\2242YY\343\302\231"
+	.string	"\223\271jf9\256\230\001.-\334\314\\:e9s\241r\266\207u\211L{(\331\366f\337gc\307(!\265FP\233\002:\366\"(\340o\334\373l\034\025\202\334q\347\222\037'\233\016^R\016\321&e\203\252M\3519\366!\252^\rq\317K\242+\222\024\307n\306\215\360\001Kph\265ATv\205\344\330\201\224\244Jb\250Ad\305\030\032\022\021\221\202\244 \205t\020\003\021\261Q\007\022@\364I\310\")\212(PPN\241\375{@^%^?,\235\200<V\036U3\037\276w\225\334\256n\367\330:D\202\207\346\234\022\226\021"
+	.ascii	"\021x\270o%\021\335\225\215\214\001\232\037\354D\361$\022\013"
+	.ascii	"\201o\335\354*+\373\210\324\241\231\222\005W\205\222\3616\251"
+	.ascii	"\275\342\021\355\003\300!\376\213\241c\266=\036\252NF\204\271"
+	.ascii	"\004\304\345]\203\240\307\325\322\247\212\3701\234%\257Y{\324"
+	.ascii	"\377\364\n\210\b\264\321|\202|\221\252\333!\360N$'\344\274\206"
+	.ascii	"\216\372\033\022q\3501\rY\342T~\360E\377\200\244\013\217\247"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_sbufWriteData.5.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`&\001%\r"
+	.string	"\346\231ZB\020\221\223\016c\325w\321\n4I\364\351\344|\240\367\230\256\203\032\030\275\225\255\"\340\337\020\2536\242\206_\317\233\346\221\244R\3364\022"
+	.string	"\350\244\220\240\271\202,=\020\203\340*\233\360\312\037\204\232\334R\246\024F"
+	.string	"E"
+	.string	"D"
+	.string	"\027\260\343G\370+\027\301\375Dr"
+	.ascii	"\273\246\225\226\335\216cNuu\367M\346Z=@\346j\316\2361\200"
+	.string	"\202\346\006\n\nfw\257\344p\356\310\371G\335\243\224B:v,\330]c)\305\302\235\267m\300\266\003\373*\001\177\307Y~U\364St*\032\037\372\026\210\013\001/v+\244p\254\213\262\370`\373\366Op\266e+\b,\361(\277\304Mpgq\013{\354fxi\331]\216\033T\327\002O7`\210'\321\371\005\006\203\352\252\001\231\232\016\247\303|\340\263JL[\333\360%[\030N\222d{\302S\214T\273\233\300G!\"\252<\\}\222\314\025\023D\306I\363y\224\034%\230\362\306F\214\305\030\273#aj\260\377vw\235&\373\335_\375\024\240\217\204\314FY\310\363\201\fA\226a\n\260\316f$\nI{:\020F\036h\331'4\022]\240M\3236\317\005\212\220i\227'$\272:\004\274\211|B\327h\333B\227\325\355\337\246Ic\\J\322\304/WhT^\242\221\231/_\343$\204\t\246T\004\026"
+	.ascii	"@\323\340Lh\312\0076\\w`\357\033\f\206*\207T-A\270AH\r\201/\305"
+	.ascii	"=\033\313T`\331u\031\003'\242\320\fQn\200\2701\324\300p7\026"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteString.6.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`V\002\025\023"
+	.string	"&c{H\320\322(\035bR\2625\224<$\032\231H\205d$\227\037\327\317\3029@\262;X\3428\n\023g\241\321naM\270\353\035\340\013\321\315\256i\f\201rCE{\370\220\241\372i\264\352\201v\346\324\2416J>\331D\312\224\002b"
+	.string	"h"
+	.string	"`"
+	.string	"\272\331q.J\223b\304\243\350\321\337\231\331\246\307\233\354\030\223\312\034\006\031\013\302\307\257G\352i\037\305S\320\216s9\200]\034\334\213\335\334\211O\302G\347>\002>\206\017"
+	.ascii	">\232f\333 \2119\365fx\214v\027\245!N{\322\374\353\274t\253y"
+	.ascii	"y\222\020\354\256\363V\243\341\326\333\036`;\202\235@\001\244"
+	.ascii	"tHJ\223\3004x\334\037\237\373\277\230N0\375\023\270a\006\311"
+	.ascii	"n7C\317\307\016\305 \022\376\316\177fW\341"
+	.string	"\363|\305}\034\350L\264\022\233\310\332rz&\217\261D*\346y>\213\267\230\335\205\205R\022\304\330\007\341c\311G\003\221\372\362\273\036\337P\032\006'\032\204\327}\333Adm\274^\321n\316\3441zH=\037\376\317\212\225\277\331t#\243/\376\217W\036\324\022\356\256\001\037H\306\342\347\270\200\217$\r\251\201K\005\365\3779\204\035D\353s\t9h\244\236\367\351wQ\257{I-\217|M=\231\371Q\313\236A\362S\273\365\312\337\256\257\271\261\351\213\263\307\206h\363\310\316\301\244~\260\377\355\356ZqlR\272\024.V\005U\311T*\337\212\213\005&\213\201&\240*\240R\245\016\244PFd1\025\365\n\205\302\205\t-\025\013&\213\241\\\257V\353\265B\271XT-\324\n\026C\241\b\360\313\002\013\206\222\275^0\224)W\373\267\212c\005\034\206j\nc\237\267\373u\016\322c3TR\030-'\021\277\341"
+	.ascii	"5\324\222^\207\214\t\230\354\t\205z\032\2013\"\nIP?%i1 p\002"
+	.ascii	"\241\251\345\006@fPL\350j)0\nN$^\322\331~1nd\230uK\\2\314`\017"
+	.ascii	"c@\370\"\256\315;\323\244b\322\355\003:{\021\032!\020\036\204"
+	.ascii	"\232\001\202?g,\236\332\202\352\034\322\340\002\362\n1\363\265"
+	.ascii	"\336\356\203\3515\316\362l\316\203\253\205\212P6\001\013g\274"
+	.ascii	"\230K\265\347!hKZ\232A\321\215\201X\270C\033^\b\206\f"
+	.text
+	.section	.gnu.lto_sbufReadU8.7.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\245\n"
+	.string	"\266\224KB \2138\035\300\322 \231"
+	.string	"\006\206\001.\b\273\345\257?\265\004\t\362\336{\020\204\360>\356\362x\200}\375\303\237\315LK\211\331\376\350\f\020\204\304\322S\f\205\206\274\207\2619tf;)\033.i[\246\0247"
+	.string	"6"
+	.string	":"
+	.string	"\036\177\231\317\264?\314g\266\255\331\214,~\\\241f\200\221\220\006\031v\307M\016\270x\025\375\273\216!(\301pJ\221\256\224\213\335\265\236R$\267\274m\n\333\030\366%\002Re[=\337\3721\251V\251>e\236H\200\260\260\213zm\330\b\031\004\003\266o\177\034\331\025\033\233\300\251\336\345\263\236`\364\226\350\016\273*\326\203\335\021c\214\366,\362\024DLT2\260\254~\272\300\375R\245V"
+	.string	"9`\322\227m\320\027\204\264\335\255\360\025txh\005\236\371\242\371\354\322B\240U\322\227+"
+	.string	"V5\330#I\245"
+	.string	"\373\330\356\256\003\326t\233\256\343,\270\314\305\013=\322^F\003\224\361u\234\360\343\331:\340\367\201\336\326\331\350\276\315\013=[&\302 \007'\334> \030n\225q\357)'J\322d\337\301\207\250\371\241\371l\006\r"
+	.ascii	"@\323\240\314\2000l\307\234b\252SQ\213`\261\250b\203\312\335"
+	.ascii	"X7o3\0133\\\020\231\332I\006"
+	.text
+	.section	.gnu.lto_sbufReadU16.8.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\235\002\205\023"
+	.string	"\246$}G"
+	.string	"\317&\035\323\013O\263\267L\304\027\315\265O\310"
+	.string	"\363YS\332\017\324\200a\373U\022:\221\251D\3375\210Mn\233\276N\307\333\342\305\231\373\244\377_\317\364\213\230S\354p\337"
+	.string	"\242\233+\212\326F\266I#\233H\231Rg"
+	.string	"d"
+	.string	"l"
+	.string	"(~\315\336\266\203:\315\325\315\237.V\353\360bN\361\343\322\016\272\255\006\245j\177\366\032\224\213'\0070\347\313\354gN\021\304 \335\245\305\316\266O\363\023(v\251\b\303\302\325d\261\233\2429\305o\343\035\334\245>"
+	.ascii	"w\271 \356\272\272\374\327\276\311\310b\244\264\\\270\222\030"
+	.ascii	"\3149\255)-\032\356\275\355\002\266\037\330K s_l\222Z\203S\237"
+	.ascii	"8\265GR\2338u\351\264\273\333\324\244\213?'\325\233T\257T\353"
+	.ascii	"\246\376\0067[!@\305\234+G2\246\220\004\022q\332o\237ggS\370"
+	.ascii	"\024}<\307\366lr\033\037gG\370\310\3149\275\313q\302XJ\260\232"
+	.ascii	"lk\201R\375hr\361\204c)\255\274T@.\375\033\023\333\273T;\336"
+	.ascii	"\226xvt\356\021\322\330Dpu\260\323~\300%T\243\277\366g\030M\b"
+	.ascii	"\371@\022(\3701~\213\273\324\330\023a\340p\332\237\026\007\314"
+	.ascii	"S`\240\356\355i\325\005\214\304\313\253\373\264\2729g\002\277"
+	.ascii	"\007d\3711'\334\245\267\034!f\241\036\37197\215\036\216\363\253"
+	.ascii	"\2142\026s?\336#T#s2:\226\030\232jd\213/\335\017\366\267%\"\340"
+	.ascii	"\332@\nA*\205R\200\n\351P\201\255\265*d\304\002\204UJ\004,i}"
+	.ascii	"$\254\325\212\245\372H&\244V\237\nl}!\003\314\252 \002~%,\026"
+	.ascii	"\370ybx\273\333\005.\341\276\254#\212\241nO\333\266\333\325\335"
+	.ascii	"\366\261\r\032\273\244\325}Ow\007q_\322.\021L\206i\277\217\315"
+	.ascii	"\b\365\310\276N\203\231\021Si\317\343\325\203f\0364 `\242A\250"
+	.ascii	"\326\003@1(\017\210as\025\252@|\035cA\3070\026\221\3423_w(G\003"
+	.ascii	"B\f\202 (\330\002\r\311\204V4\341plL\307e\260\3138zr\216\304"
+	.ascii	"\t[\034\217\203\r\003\277/\342\220a\303<$\t[\f\013\362d\307\346"
+	.ascii	"\246M\017\306\006\020\013Zf\361\231l\r\306\372\004\250V\320\334"
+	.ascii	"\346a\232\212FH\256\001Job\215\330\204\021I1]\201\f"
+	.text
+	.section	.gnu.lto_sbufReadU32.9.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`t\004U\027"
+	.string	"\246\251\220J\300\020)\035\362\333\354\277\246V\352\377\021\375\177I\017\021UT\213\020\272\303\\\002\352\"\247\332\233\253\177\245~\375o\371\033\013\275K\222\263\323.\252\256\253(\214\331\230\302M\326\337M\376\356TV\226\257*\367\266'\215\220-wJ\001v"
+	.string	"w"
+	.string	"~"
+	.ascii	"4\253\031\236\214\311C\377\207\305n=\244\266\213\377s\213\342"
+	.ascii	"\320\356"
+	.string	"\323\215/4c\360\347\241F\255e\311C+\030\251\rmN\373=/\341\362\262\345\257Zoz\220j-Ml2>t9\332\366G\234\204\213u\264\314\251\021\177:0?R\265\2263\331c\342Cz\230\370p;\\\367\251\363\377;\345\321\020\214\251y\371T!\250\265z\306\324\\\270\367\266\005\330^`S\2518\366i\335\033\233N\217\320\351\2308\r\013\247C\302\351\2278\355\n\247A\304\351\217p\332C\234\356\b\247[\254\325x\337\255z\371\213t\232\322\351\245\323\223N\237D\214\212A\262T\353\314\024\216\352\024\236\370p\337o?\ti}\226\244\214\212\326g\211gHh}\224\244J\016d\267\314r\023~pA(\361\324Z[\017\201\265G\263\352\375t\350\023m\316\003Y^\266\210\001\261\365\fJ\300\202\201\013d?d\362M\3630\361\265 CBA\227\355\232T{\337e\260U\355\213`r\354\346\324\377\373-"
+	.string	"W8\371L\rn\376\216\237\023\037\302\366P\025lBV)'\222\363\230(\332_\033\262\223F/\004\317\344S\344\306Zk\001\037\005\216\202\277\323\">|\255\210N\317nN\371@g\0017<\370\313"
+	.string	"3\314\250{\340e\273y\303\"\323\004.\311\250\363\206]\362\346\006+(\270\365\200\032\201Z\215f\200v\022\263\341T\326\266\223\b\271\007\267\032\nnEe\226B\336n\244m\226\"\241v\233\331p*\263\223"
+	.string	"&'\240\340f+$\211\233\265\312\335m\326\036\340\260[\236'\320\006k\265tY"
+	.ascii	"F\226v\354\310\321\013\b\035\255}\222\311?]\304_\333JB:\202\261"
+	.ascii	"\332]\271\276\373\261'j\341\340\303cod\362N\353aTD\344b\234;"
+	.ascii	"b\030o\025bl\347\376w\030T\017\207k\003Z\250Ax\303\b\315\220"
+	.ascii	"\b\005%IR\350 #\221\232\035\022\240\305!\"\275DT\312\333T\337"
+	.ascii	"\001@^\025y\236\004\\m\362\006\206Q\031\245!t!\203u\177\302\307"
+	.ascii	"1S\221\364\277\2036\244A\0078*\211\021r\264\301TF\326R\234G\337"
+	.ascii	"\317\013\211\336\224\302\317\242)\322\030\225b\243g\023;\365"
+	.ascii	"!\311\373%x1=\232\037\034|\314\325\361\265\214\0041S^5\201\272"
+	.ascii	"\351Iv\200\373\f\301\203O\260\023\024\225\205\213\2346\030=\007"
+	.ascii	"\274\2612\250\033\322\370\323\017\252W0Br(\020\364\023\265\036"
+	.ascii	"\214\330\252\311\354\377"
+	.text
+	.section	.gnu.lto_sbufReadData.10.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"]\013"
+	.string	"\006\327O; 1p:\033\367\004\02628\223\205FfSCl\177\025\272\362\020Q\245.\031\210\304\377\372"
+	.string	"@\002&\335R\333\r\001\222\025\217G\201\001t\344\023H\003\324\302@\337\2036\2212\245;"
+	.string	"@"
+	.string	";"
+	.string	"\027\260\313\351\210v\303\210#\326\243\303C\252G\353\003\252G\203\366\214\207\"\366\237N&Tcw/\rq\360\t\372\017\335\241\331\\\236"
+	.string	"\032\354\256S\263\351p\353m#\260-\301>\204\240_c:\251\364\255\312\344\242"
+	.string	"\214]\016'\323\216\"\013\022\266\377\260\365\204\351\211\177\300\203\334\302\216\335\0171D\273\033q\004\353\361"
+	.string	"\2454\260\f-c\305\003\353QI\330\323~\211\233"
+	.string	"\357\261\004\033\227\327\370\341a\203^lg\270\212\212\265\273\013\374\024\237g\215x\364-\325c*\001\222G\365\372\314\rL\236\234(J/6KvxI\005a\237\332\335\265r\354\207\177u\317\037\037\224\311\005\315\276\214\002\345\004\231\202,\303\030`\022\210\326yjMR\2412a\313&\335\347]\024n\3338\355\242X\310\266K\353\274Kb\300\034\206Iw}\034\327]\217pO\255r\354\300\306\b\243\032\034 \257\251\225\332\001\020"
+	.ascii	"@\323\240\314\320\\\005>\036%\305\n\005\204\266\256\001\017f"
+	.ascii	"L \006\234xB#C\351\200vA(\204\340\232[\b\363\t"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.11.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"M\n"
+	.string	"\306\223G>@\307h8\f\0244\337L\367\262\3779\025\030\344"
+	.string	"|\201L\202\214KP\016\232P)\231\331\b\261\330\331\032\373\261G\212\332\212\303\260\261\360\033\030\311.\211\347k\254\351k\272\333\336[\312\224\0025"
+	.string	"3"
+	.string	"5"
+	.string	"G\021m\001\331(\342\372\007\f\253E\301\356v\234o\266k\331\023\266k\032r\361)\372Wy6\240\343@\313\225zf&v\327\331rm\334z\333\016\266)\3547\004\3274\255\231\316L?\223\3410\240@`W#\306`\013h"
+	.string	"Jl\213\266\306\326"
+	.string	"\237\247}\330S\304\217\250#\354\276^bv\307\216;\3345\217\234m\377$W\325L\220a\262\272\270K\352\302\210]:\013\006\267\273\021\376\212\351\304\221\\\363Q\333\265\353\001\002\230*c\326xl.\260\307T*\210\375l\365eg\351\355\343\003~\360 <\357#\361\361lF'\220:\344\031\235@\237'\nM\245\216\004~\037\030\352H\025\336\327\205\302R\347a0h!\n;\023\b\206\235f\334\333\233rT\272\262\352\246g5H\r\017"
+	.ascii	"@\323\240\314\2000\f\303\004\220*&\270\034Q\231+\275\365\321"
+	.ascii	"\330\341\232\310\225\205\276\301\004\001'\236T+&a\222\001"
+	.text
+	.section	.gnu.lto_sbufPtr.12.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\355\b"
+	.string	"\266\320>:0\345(\035"
+	.string	"\360g&\003\b\007:\003\375\310\306r\264\002\023=\003K=)5\321>\266*\350\333\230 A\272\2711)(` !\315\316N\202!\236*d\313\221F\b\221;\245+"
+	.string	"0"
+	.string	","
+	.string	"\025'/\273Sz^\243=\333>\240=S\215\203\217\240\377\221c\341\205K\265B=b\032v\327Q\265b\335z\333\b\266\035l\247\004\030\306\243\245"
+	.string	"e\327\342\025`Y\262\225\016\333';c\353G'\306\207\246\013\354\266@Tv\347\306\233\355\231m?\344\"'\203\004s\203\245\231\270\002z\220R\n\333\021/\001\267\335]\360I&$6\216g\276I\003\\\302T|9\203\261\021\200=QQ3\354c\253-\333\321\372\360\217\001N\340\0248\256\303\320\341hB%\217\372\303\t\225<\035\007\372H#)\362\272\316\373H\321\003\327\311\3177\222\034\003{\020\240O\222<\357\223\231\271\307V[\032\013"
+	.ascii	"@\323\240\314\320E\003\223\261\030.\013\330b\002pM\204\304\202"
+	.ascii	"\344!L\341gFS;\237"
+	.text
+	.section	.gnu.lto_sbufConstPtr.13.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\335\b"
+	.string	"\266P>8@\217\322\001@\375c\321O!'\343ed\347_~\336a\230\325t\200\021\242\355\325\033\301\277\245\004Y(\255\215\252\212\206\317\277x\373\n\350\\\006\033\301\240f\263\204\310\235R+"
+	.string	"0"
+	.string	","
+	.string	"\025$/\273Sz~\223\271\266} sM7\236zL\371\017y\026b\270\264\\\252GM\303\356:\266\\\257[o\033\301\266\203\355\222\231&\\)h\331\265\210\305\254\212v\342a\033es\266^xb|x\272\300.\f\305dwr\314\331\256\331\366?\016\202r\212`r\274"
+	.string	"X)\001z\260R\226m\323G\"\266]\212\005_dBb\353\270\346\2374\200%\\\305\230\271\214\2150\366TE\325\260\237\255\302lG\353\303?\006N\350\024\272\316\303\340\351lD\246\217\032\324\021\231>^\027\002K$9\372<\357\003\311\321C\347I\020H\222\035\003\177\020!P\226\276\017\224\334\334g\2530\r\013"
+	.ascii	"@\323\240\314\320E\003\223\261\030.\013\330b\002pM\204\304\202"
+	.ascii	"\344!L\341gFS;\237"
+	.text
+	.section	.gnu.lto_sbufAdvance.14.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"\346\025N>\020O5\035\303\312!\033\016\220U7\025\f)\232\321\037[\234\024\341\314\340\f"
+	.string	"\210\f\240\374\216\246\357\026\217Y\020\325\r\017\257\252\352\331\177\327\375\005\032K\204\255 1R\323nK\233H\231R9"
+	.string	"<"
+	.string	":"
+	.string	"&\f\031\273!\305\024\354\321\341%\327#\366"
+	.string	"\327\243A;\305\303\323^ub\204\261\261\273\231N8\370\004\375\253\376 \225@O\007\202\335u\222J\020n\275\355\001\266\025\330O\020\250?jZ\255tj\372\230cD\211\211\212\335\007+\027\253\021AX\260}\210\235\033Z\206\337"
+	.string	">\345\020~\354F\370\220\261\273\024[\260G\001V\242\320\236\3663\\\003x\324\347"
+	.string	"v\003zU\275\203\013\242\\\371\322\324\263\030\275\260\277s`\200\355\256\001\037\243\343\301*<\372\237\353\361\032\241\200\n\345\312\331A\204\211\315\026v\bJ\225`\337\332\335\265\232\354\247\376\353\001\231\006\233\3172\201\255\300\266i\007\264\212D\343\271\2501\025\215\347\302m\031\257\363e\234\216\343:L\306\331l\\\206\361\276\2542q\267 \343e\235\256\3632H\270\267VM\266\220\320\b\251\310\252\036\"\247\223V\004\021"
+	.ascii	"@\323\240L\350\020\007\306\005\202p\2712xk\016ChV\351\256\320"
+	.ascii	"f9uax\2061\201\030\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.15.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\215\n"
+	.string	"\266\223G=0\305*\0350\372\236\333\353\223)V\312\002\003\363v`X4RD\323J\f\003\256\314\375!\204\261\274v\303\023)\337\252\006p0\206\323\\\243\n\331\374\223\263\036V2\314\021a\267\275S\n2"
+	.string	"4"
+	.string	"7"
+	.string	"\334\251\307o0\247\334\0170\247\026\355\226\217\256=\214"
+	.string	"F\211\200\335\255\263\343\342\245\350\177\344\003+V\3522\003\261\273\226+\226\306=o[\301v\204\375\207-\373\343O\377\372\247\224~&cSI\230\355f\334lK\2432\020\333\327\330R\326\311\3614\363p\2472\326]\332\017\271\210\370\027\352\006\273-\224\224\335\221cNt\236\024xl\324>m\323M\b\\\017\260\002`S\234\344\304\355n\203\017\253\260\340>N}\024\346\364s\303\362R\311\233el\300\312\312\232=\246\344\344\260\177\331\335\365\f!\222\367\271x\301c\360\274\316\241\353lD\246\3174\250#2}>/\024\226Hu\004~\037\b\252#\t\357\253\240\220T;\b\006'Ba-\201`X5\343\376\262\263eO\001\232j^8\023"
+	.string	"@\323\240L\350\031\007\306\003\235\020\334\246\350"
+	.ascii	"\336*4CT\304C9\251tWS\263\234\2700\324\3020\240\020\\\006B\315"
+	.ascii	"\006wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\345\004"
+	.string	"\262F\031%\220)\351\377\231\317G^vw\020\334\337\217\335\335\271\377/\255=\360\017\374\003\375F\332\377\350\377\215\264\266\311\226\001\275\252A\3100\f%\f\257r\220z\272\266+3[*\023\271\035d\351q\344\230\320x\300X\260\030R\034H\f@\374\034f\206\235\302\3154\266\227\364\255IV\332[\013\345\232\314\314\350\256\266w\t\027"
+	.ascii	"`h\234<\366(\023D\232a>\365\017\251`\270\354\001\332\201\317"
+	.ascii	"\201\317\201\317\201\317\201\317\201\317\201\317\201\317\201"
+	.ascii	"\317\201\317\201\317\201\317\201\317\201w\2565\361"
+	.text
+	.section	.gnu.lto_.refs.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4f8b01e368c5ed3f,"e",@progbits
+	.string	"(\265/\375`\325\021\375T"
+	.string	"z\214(\037S@R\312I\007\013\337\\\375\032\177aX\016+\f\354\026\227X\254\252\321\345\234\347\277\331\302]\016\365.\205\342\016\322Z=\2175e"
+	.ascii	"U-\272\006\355\007\334\262\216\213Y3;\272{\016\252\252dt\265"
+	.ascii	"\241\037\232\373x\304\2540uE\343}^\220\210n+e\n\232\001\332"
+	.string	"\001\363\001\350B\331(\233\236\330\266\257\333\276]\006)\355\246L\025\275\035b\\K\354\316Y\223\350\367\304y\263'\316}\262;ljb\327\276<,\333a\214i\247\234\365e\214\311\025gwN^$\3725q\002\377\376\326\304\t\226\236pB\334\336\324\322hh\024\231{JY\313\017Phg5C\216\200\035\271\232\211X&\271'_\270~\213\250\016K\266\351\226m\3307\207\025\273\210\264\273\254\273\277^c\313\264)\346t_u-\273\323\253\370{\312\026\207e\002S#\335WT6_T\222\336\366\272S\021\013,P\217\314:\267\263\276\005\272\275;'\216\006\3503@\377m2a\232Q\262\300q\375\227\371o\327z-\030\020\251\244l\261\3564\207\347\336\224\216\\w\3112\331\224\304~\335g\305\201E\260\366\352Noj\374\224\370\361q}\004(\215\002\337&\3271\366\2123\372%q\356\337\2228\237\356\316\211."
+	.ascii	"\247OP\207KH\240\2033\230\237' +\341\350\317\016\020\365\350"
+	.ascii	"\204\370\031\201\021K\342\374yg9\030\3418?\327\374+B\013\022"
+	.ascii	"\030\310\307eD\027=\023w\\\360\022\370?\202m\346_*\377\307b\376"
+	.ascii	"m\373\267\203\1771\370\327\347_\024\377\236\370\267\304\277#"
+	.ascii	"\376\025\361\257\316\2776\377\206\370\367\374w\377\363\375\357"
+	.ascii	"\362\237\313\177,\377\357\376\243\3757\373O\364\177\356\277\360"
+	.ascii	"\377\327\377\017\376\277\375g\373\257\366?\355?\330\377\263\377"
+	.ascii	"\314\377%\376\267\375\317\371\373\373\373\373\201&\374|\363\327"
+	.ascii	"\220\020(\314_\226,\313\205l\177p\325P\332\362\345\"\343\267"
+	.ascii	"'\347\205\353j\331\030\246\204\330\301\235p8\372\274\364\241"
+	.ascii	"\247\022o\261\240\335\r\354\246\362Z\316\004\351\032B\025\304"
+	.ascii	"\027\013\f\221.fq\\7O\306\206\2720\251\036j\223#QXx\350\371\245"
+	.ascii	"\300R\331*\337\037\026\210\037\366n\273\251;\252\201vE\230\322"
+	.ascii	"\366:*\352\204\f\024\034\033\235\335\367\356@\320t\217\210\311"
+	.ascii	"\202\363\341\304u\351\366J\215\341H\237\362\212\225\231\245\224"
+	.ascii	"\336\027\263\230\247\243\0276\256[\267a;\234\264\232p\275\226"
+	.ascii	"\225\201\261\332b\207\326D\177\376\31766u\267\023L\332MG\232"
+	.ascii	"/\314\326,p\017\370_\273\377\003\005\260\353\206\322\312\202"
+	.ascii	"\036A3\352\340\332\022t\361\006$c2\247\323nB6\253\212H\034\344"
+	.ascii	"\2229i\367\020\240\233W\215L\253\222U\331\334io#U%U@\246\312"
+	.ascii	"&d\252,\3424\222\262\330\235&q\220b\306\342\"\233UIdS\231\314"
+	.ascii	"i\244.v\323\330\003ER&\221n\312$\016\262iL\"\221\252\2229OZ>"
+	.ascii	"\334j\324 \227\265A \221\232ii\312\330\204\023\207"
+	.string	"L\225M\327\275bI\335t@\367\224\262\211\316\b\265i\3078\246c\231Q\271iw\017\260t\264R6R\034\022\211\262\033\3111F/5PL\343:\310\306\025\257\246Z)\251\233\200\245\356\342v\\w\027\273;\246i*\355\226\302A.\227\226\272\243D,\365TQ-\251\233\305\254\244%\221M+e\217ZXs\3314\322\342.\233\256\252\tm\026\277ZI\017]&s`\2312w\323%\003\226Vz#\243\306\227d\006\256\033\267>|\345VJ\257\\\003\312n\343\312\335\364u\033ov\r\3305\240rY\025!;\353W*!\200\310\rI\302\225\367k'3\371\035/9I\262\203+/9^\331\027\220)\366\202\263\232;re%\314\265\351\333\270\353gST\332b6Nh\214\265\301\241\207a\337v\262\r\347-'T>\252xHBVE\307R\r=\220\f\345%E\212p\r^\226S\200(e\0319\327"
+	.ascii	"\374\313\241\367\205+/\367JM\235R\311\030\023\b\346\245\245\311"
+	.ascii	"\026\312sB\204\360\020\273\274 7/y\254u\036\302}yi\033W\316\332"
+	.ascii	"+\233\203\323\020;`\026\nD\252\252b :dG\267]#\242c\316\307\031"
+	.ascii	"\b\377p{\242\241\304?\030\013hcI\0264\032\0348\262\224|\025\203"
+	.ascii	"e\367\004\n_\261U\b.\033\342\244\322\033\274\271\034]T(0\b\025"
+	.ascii	"\025+u\320hx\214\371\200\306\343\254\\f\fX\026\272\342\023\n"
+	.ascii	"lJI\361\224\214\025Y^\335\333\001\207\020\035\347\251\257\315"
+	.ascii	"({\320\330\003\036Q\240\024\031d\340\250\215\202\200\331\225"
+	.ascii	"\307ug"
+	.string	"6\260\240\316Q'\027\ro4p\345\247\345\321G\304\211+\317\360\273Z\243h\343\306\026\264\336hz\023;\2418}\234\013\262\204\321\312\301iK\362\354\004\227%\266\247f\005\255K\245+1\023w3i@\243\214\370\340\267tf\352\241fy%w\006\207\3265$\337@\262\rne\3672&\314J)O&\031\304\f\212k\234m,X\216\272\245\037\037P\261\"\345\tZ\363\370x>r\022\332\177@6%9\"1\234\223lh\020\251A\205+#\355\025\032\035\364\346\266L\271\331\342\273Q\205\211\302$\277\260\361\013\027\321b\227%\315\035\024'S\270\317\305%\343\221\226\305u\377\366\212Y\235\031\027\327\365;\336\214\026?\345\336\327fP\353zK\202\302,\341\343[.t6Q\266\364\316x\2400p]\272DY\0229f\351q=\327\b\301\341\321\214*\f\022\r\2110\204C\301\027GDB\302!\236\241\321\021O"
+	.string	"DDGBa\2210\206\350\"\370\302\220\321\311B\3210\006\261H\030\223BP\220\250\2720CHFP\3069\f\026}\020C\2108\304\202\007A!a\320\n/&\230\031\0229 \032\t\213*\030\0229\210\201!\034\n\2660\n\022]\240@\207\306G\305O\317\f\020\b/\202\202-B\300\020\016\r\211\036\334\004\021\203,\250\361Q!\f\032z!\274"
+	.ascii	"\306\020\005?=;>*~zh.\004\004B\22084\fa\346BC\303\2400\b\003"
+	.ascii	"}\003?(~\200Z\2109\020\013\006X0p\036\210EO\017\213\237\036\364"
+	.ascii	"?=\300aP\f\241Jt\341\243\342\247\007%>F\001/\232\021\034\362"
+	.ascii	"\020\213\212\206<3/\204A\240\221\213\024\216P0:\207\304\031@"
+	.ascii	"\242\013 \242p\350(\346>A+\202\202z\200zR\354\334\001\007*(\001"
+	.ascii	"\302\006\031\240B)R8BAFPpH4\342\021\026\311\220Q$\304#\034\n"
+	.ascii	"\222\301#44\342IA\342\334\266\177\177}m7\310\246\262\333\310"
+	.ascii	"o\354vn\373\315\tJVJg\024\2653\rG\223\260\036\316Pn\260<\365"
+	.ascii	"\320\301\225y`6\340\326\222\254.\375\035\020G\354\2340\341\312"
+	.ascii	";\360\032\220\345\330\223\343=\257i\017\311\236\025~\302a1L]"
+	.ascii	"|X\\\271\305\316eb\254\006\304\"A+\305\334\025\2511\223R\242"
+	.ascii	"4;\253\235\323|V\260\027\323Z\325\026\256\214f\023\365\346$\357"
+	.ascii	"\214\231G|4\267\270\036\005\n\366\224L\262\016\347-&kIs\\\231"
+	.ascii	"\354\234\004\213)Nn,\b\255'!\\_o\240\257H(C1\222\363\rH8\f8G"
+	.ascii	"\323E\260\306\361@\233\024\256\275FF\235\260\271\201W\345\243"
+	.ascii	"\3119\354\214\203\317\212\337\t\261\302\302\270r\363\314\f\242"
+	.ascii	"\027\206\004c\246\021\2732?*(\177"
+	.string	"\241\340\035^z\364\245\001\201\206\250\2610\205 5\"\"\"\"IARH\007\261\005\204\030\006\035\232\007\021P)\243hfD\222$\245L\007\206\230H\272\373\337sy\321\301\260\320\030WI\264F\303\026\361\363'\020qJ\237/:\312\351d\032I\214\031;\341m\347\302\233\304K?\177G\314\310\004^\236rx\f\212:\322R\230T\377V\364\022\376\001\220\355\270;K\220\202\211\307\354\024\326\006\006d-\334\247^ E\355\260E\376\250 !e+\n\352x@\240"
+	.ascii	"yz\321\235\311u\f~\334\244T\025\003\216N\260\254\006\221\353"
+	.ascii	"\037.G~\265\022w\346&\312\036\256\276\2330\374\273=\023\002\370"
+	.ascii	"\316V22\251\267\357\231c\224\327\321{A\247\016\331\217\244\357"
+	.ascii	"\223\205h]\260\230 ovj\213\346\255u\243\231\245\252\245\352\340"
+	.ascii	"\303 \324\243\327\243\323\246%\371+\313)\335yd\271y\267\264>"
+	.ascii	"\336zmW8E\352;\273f\317\366<0\232\324/\002_;()s\215\277\224N"
+	.ascii	"!\233\344\321\035\300\216\371\315\274\222}5e\002\302\244\375"
+	.ascii	"\016?\3443=\253\351n\375\201"
+	.string	"IF\033\354\3632~\331\007R\027h\306\033\365i\332m|\232\267\214\220\223v\236\227\203\177k\350\237\374D\271\317\005W\256\226l?\343\270i~b\250km0\3260$y\372e\272^\205\026\"dr\223|\236\236\3568\363\335\244\035Xw\251d\2123\036,+\210\257h\260c\023\252d\016v\361\016\001\312\240\241\267\205\256\027P^\232\253b>\235\016\254\262\237N\271\300\255>'\026mg\211\222\325\362\220\002\245M\252\356<<\300\016v\r\324\327\006\225M\034\330\200r\204\227\374g\314\177\021\t&\255\351%\225g\377\302\017\374\236\246s!&\205\345\251\222\351\223D%m(\241p\320'\002Y]\ni[{dn\237\023\360\317\261\315F\2664\270sw}\003\351\276\350\3653\221\326\3653\351\311\220G!\2306\374#\004\034\177\260\367\370\032*\314~\304\021\274\220\224\327\224\214\264\026\300\377D\024\034\245\026\2018\330"
+	.ascii	"P0d\374\016z\361#\233\340\030\303E\f\341T_<J\377\275{\356\317"
+	.ascii	"2\346\341z\204\336\337\214?\342\035\320\022\037\027\326\034\235"
+	.ascii	"r\274\333\037\236x\375\356\274\217z>\272\215a\037 N\274\231@"
+	.ascii	"\033\333\367\205\354\006:\310\260\237\314\215#\335\2020f\307"
+	.ascii	"\212\177\256\317}\317H\377\210U\247\355\035\261\220\337\220\306"
+	.ascii	"\226\331\376\343!0y\321\260\261h+\306h-.uc\233c\246c\301/\306"
+	.ascii	"\030.\rk\343\031\255u\240\030\322\342\312\215\035\3364\3425\303"
+	.ascii	"]\231\346\017E\337\021\2029\360^L>\366l\276\261\270Ah\272\303"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_.symtab.4f8b01e368c5ed3f,"e",@progbits
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4f8b01e368c5ed3f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8972 @@
+	.file	"config_eeprom.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/include/stdint.h"
+	.file 5 "./src/main/config/config_streamer.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/drivers/system.h"
+	.file 8 "./src/main/config/config_eeprom.c"
+	.file 9 "/usr/include/string.h"
+	.file 10 "./src/main/common/maths.h"
+	.file 11 "/usr/include/strings.h"
+	.file 12 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config_eeprom.c.eb27b3f9
+	.weak	config_eeprom.c.eb27b3f9
+config_eeprom.c.eb27b3f9:
+	.long	0xac0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1069
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF952
+	.uleb128 0x3
+	.long	.LASF958
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF953
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	0x3c
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF954
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF955
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF956
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF957
+	.uleb128 0x3
+	.long	.LASF959
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x48
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF960
+	.uleb128 0x3
+	.long	.LASF961
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x4f
+	.uleb128 0x3
+	.long	.LASF962
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x56
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF963
+	.uleb128 0x7
+	.long	0x91
+	.uleb128 0x3
+	.long	.LASF964
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF965
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x7
+	.long	0xae
+	.uleb128 0x3
+	.long	.LASF966
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x7
+	.long	0xbf
+	.uleb128 0x3
+	.long	.LASF967
+	.byte	0x4
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x7
+	.long	0xd0
+	.uleb128 0x8
+	.long	0x98
+	.uleb128 0x23
+	.long	.LASF1070
+	.byte	0xc
+	.byte	0xa1
+	.byte	0xa
+	.long	0xbf
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF968
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF969
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.byte	0x41
+	.long	0x11d
+	.uleb128 0x15
+	.string	"b"
+	.byte	0x5
+	.byte	0x42
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x15
+	.string	"w"
+	.byte	0x5
+	.byte	0x43
+	.byte	0x12
+	.long	0xbf
+	.byte	0
+	.uleb128 0x12
+	.long	0x9d
+	.long	0x12d
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF982
+	.byte	0x20
+	.byte	0x5
+	.byte	0x3e
+	.long	0x187
+	.uleb128 0x4
+	.long	.LASF970
+	.byte	0x5
+	.byte	0x3f
+	.byte	0xf
+	.long	0xd0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF971
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF972
+	.byte	0x5
+	.byte	0x44
+	.byte	0x7
+	.long	0x100
+	.byte	0xc
+	.uleb128 0xe
+	.string	"at"
+	.byte	0x5
+	.byte	0x45
+	.byte	0x9
+	.long	0x3c
+	.byte	0x10
+	.uleb128 0xe
+	.string	"err"
+	.byte	0x5
+	.byte	0x46
+	.byte	0x9
+	.long	0x3c
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF973
+	.byte	0x5
+	.byte	0x47
+	.byte	0x9
+	.long	0x187
+	.byte	0x18
+	.byte	0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF974
+	.uleb128 0x7
+	.long	0x187
+	.uleb128 0x3
+	.long	.LASF975
+	.byte	0x5
+	.byte	0x48
+	.byte	0x3
+	.long	0x12d
+	.uleb128 0x3
+	.long	.LASF976
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xae
+	.uleb128 0x1c
+	.long	0x56
+	.byte	0x6
+	.byte	0x21
+	.long	0x1d2
+	.uleb128 0x1d
+	.long	.LASF977
+	.value	0xfff
+	.uleb128 0x1d
+	.long	.LASF978
+	.value	0xf000
+	.uleb128 0x1d
+	.long	.LASF979
+	.value	0xfff
+	.uleb128 0xb
+	.long	.LASF980
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF981
+	.byte	0x6
+	.byte	0x29
+	.byte	0xf
+	.long	0x1de
+	.uleb128 0x24
+	.long	0x1ee
+	.uleb128 0x1
+	.long	0x8f
+	.uleb128 0x1
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x6
+	.byte	0x31
+	.long	0x20e
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x32
+	.byte	0xf
+	.long	0x8f
+	.uleb128 0x15
+	.string	"fn"
+	.byte	0x6
+	.byte	0x33
+	.byte	0x16
+	.long	0x20e
+	.byte	0
+	.uleb128 0x8
+	.long	0x1d2
+	.uleb128 0x1f
+	.long	.LASF983
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2b
+	.long	0x26e
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x19f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF971
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xae
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF970
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x26e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF984
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x26e
+	.byte	0x10
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x30
+	.byte	0xf
+	.long	0x273
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF985
+	.byte	0x6
+	.byte	0x34
+	.byte	0x7
+	.long	0x1ee
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x9d
+	.uleb128 0x8
+	.long	0x26e
+	.uleb128 0x3
+	.long	.LASF986
+	.byte	0x6
+	.byte	0x35
+	.byte	0x3
+	.long	0x213
+	.uleb128 0x7
+	.long	0x278
+	.uleb128 0x12
+	.long	0x284
+	.long	0x294
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x7
+	.long	0x289
+	.uleb128 0x16
+	.long	.LASF987
+	.byte	0x6
+	.byte	0x46
+	.byte	0x1b
+	.long	0x294
+	.uleb128 0x16
+	.long	.LASF988
+	.byte	0x6
+	.byte	0x47
+	.byte	0x1b
+	.long	0x294
+	.uleb128 0x1c
+	.long	0x56
+	.byte	0x7
+	.byte	0x19
+	.long	0x2e7
+	.uleb128 0xb
+	.long	.LASF989
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF990
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF991
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF992
+	.byte	0x3
+	.uleb128 0xb
+	.long	.LASF993
+	.byte	0x4
+	.uleb128 0xb
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF995
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF996
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x2b1
+	.uleb128 0x16
+	.long	.LASF997
+	.byte	0x8
+	.byte	0x26
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x16
+	.long	.LASF998
+	.byte	0x8
+	.byte	0x27
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF999
+	.byte	0x29
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x12
+	.long	0xae
+	.long	0x326
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x5f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1000
+	.byte	0x31
+	.byte	0x11
+	.long	0x316
+	.uleb128 0x5
+	.long	.LASF1001
+	.byte	0x32
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF1002
+	.byte	0x33
+	.byte	0xc
+	.long	0x187
+	.uleb128 0x5
+	.long	.LASF1003
+	.byte	0x34
+	.byte	0xc
+	.long	0x187
+	.uleb128 0x5
+	.long	.LASF1004
+	.byte	0x38
+	.byte	0x17
+	.long	0x35d
+	.uleb128 0x8
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1005
+	.byte	0x39
+	.byte	0x17
+	.long	0x35d
+	.uleb128 0x5
+	.long	.LASF1006
+	.byte	0x3a
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF1007
+	.byte	0x3b
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x1c
+	.long	0x56
+	.byte	0x8
+	.byte	0x3d
+	.long	0x39b
+	.uleb128 0xb
+	.long	.LASF1008
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1009
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1010
+	.byte	0x8
+	.byte	0x40
+	.byte	0x3
+	.long	0x383
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0x47
+	.long	0x3d6
+	.uleb128 0x4
+	.long	.LASF1011
+	.byte	0x8
+	.byte	0x48
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1012
+	.byte	0x8
+	.byte	0x49
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1013
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xa
+	.long	0x3d6
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	0x91
+	.long	0x3e6
+	.uleb128 0x1b
+	.long	0x35
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1014
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x1b
+	.long	0x3a7
+	.uleb128 0x7
+	.long	0x3e6
+	.uleb128 0x17
+	.byte	0x6
+	.byte	0x4e
+	.long	0x43f
+	.uleb128 0x4
+	.long	.LASF971
+	.byte	0x8
+	.byte	0x50
+	.byte	0xe
+	.long	0xae
+	.byte	0
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x51
+	.byte	0xb
+	.long	0x19f
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1015
+	.byte	0x8
+	.byte	0x52
+	.byte	0xd
+	.long	0x9d
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1016
+	.byte	0x8
+	.byte	0x55
+	.byte	0xd
+	.long	0x9d
+	.byte	0x5
+	.uleb128 0xe
+	.string	"pg"
+	.byte	0x8
+	.byte	0x57
+	.byte	0xd
+	.long	0x43f
+	.byte	0x6
+	.byte	0
+	.uleb128 0x12
+	.long	0x9d
+	.long	0x44e
+	.uleb128 0x26
+	.long	0x35
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1017
+	.byte	0x8
+	.byte	0x58
+	.byte	0x1b
+	.long	0x3f7
+	.uleb128 0x7
+	.long	0x44e
+	.uleb128 0x17
+	.byte	0x2
+	.byte	0x5b
+	.long	0x474
+	.uleb128 0x4
+	.long	.LASF1018
+	.byte	0x8
+	.byte	0x5c
+	.byte	0xe
+	.long	0xae
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1019
+	.byte	0x8
+	.byte	0x5d
+	.byte	0x1b
+	.long	0x45f
+	.uleb128 0x7
+	.long	0x474
+	.uleb128 0x17
+	.byte	0x6
+	.byte	0x61
+	.long	0x4b4
+	.uleb128 0x4
+	.long	.LASF971
+	.byte	0x8
+	.byte	0x62
+	.byte	0xe
+	.long	0xae
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1020
+	.byte	0x8
+	.byte	0x63
+	.byte	0xe
+	.long	0xae
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1006
+	.byte	0x8
+	.byte	0x64
+	.byte	0xe
+	.long	0xae
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1021
+	.byte	0x8
+	.byte	0x65
+	.byte	0x1b
+	.long	0x485
+	.uleb128 0x7
+	.long	0x4b4
+	.uleb128 0xc
+	.long	.LASF1022
+	.byte	0x9
+	.byte	0x40
+	.byte	0xc
+	.long	0x3c
+	.long	0x4e5
+	.uleb128 0x1
+	.long	0x4e5
+	.uleb128 0x1
+	.long	0x4e5
+	.uleb128 0x1
+	.long	0x29
+	.byte	0
+	.uleb128 0x8
+	.long	0x4ea
+	.uleb128 0x27
+	.uleb128 0xc
+	.long	.LASF1023
+	.byte	0x5
+	.byte	0x50
+	.byte	0x5
+	.long	0x3c
+	.long	0x501
+	.uleb128 0x1
+	.long	0x501
+	.byte	0
+	.uleb128 0x8
+	.long	0x193
+	.uleb128 0xc
+	.long	.LASF1024
+	.byte	0x5
+	.byte	0x4e
+	.byte	0x5
+	.long	0x3c
+	.long	0x51c
+	.uleb128 0x1
+	.long	0x501
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1025
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x5
+	.long	0x3c
+	.long	0x53c
+	.uleb128 0x1
+	.long	0x501
+	.uleb128 0x1
+	.long	0x35d
+	.uleb128 0x1
+	.long	0xbf
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1026
+	.byte	0x5
+	.byte	0x4c
+	.long	0x557
+	.uleb128 0x1
+	.long	0x501
+	.uleb128 0x1
+	.long	0xd0
+	.uleb128 0x1
+	.long	0x3c
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1027
+	.byte	0x5
+	.byte	0x4a
+	.long	0x568
+	.uleb128 0x1
+	.long	0x501
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1028
+	.byte	0x7
+	.byte	0x25
+	.long	0x579
+	.uleb128 0x1
+	.long	0x2e7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1029
+	.byte	0x6
+	.byte	0xbf
+	.long	0x58a
+	.uleb128 0x1
+	.long	0x58a
+	.byte	0
+	.uleb128 0x8
+	.long	0x284
+	.uleb128 0x13
+	.long	.LASF1030
+	.byte	0x6
+	.byte	0xbb
+	.long	0x5af
+	.uleb128 0x1
+	.long	0x58a
+	.uleb128 0x1
+	.long	0x4e5
+	.uleb128 0x1
+	.long	0x3c
+	.uleb128 0x1
+	.long	0x3c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1031
+	.byte	0x9
+	.byte	0x2f
+	.byte	0xe
+	.long	0x8f
+	.long	0x5cf
+	.uleb128 0x1
+	.long	0x8f
+	.uleb128 0x1
+	.long	0x4e5
+	.uleb128 0x1
+	.long	0x29
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1032
+	.byte	0xa
+	.byte	0x92
+	.byte	0xa
+	.long	0xae
+	.long	0x5ef
+	.uleb128 0x1
+	.long	0xae
+	.uleb128 0x1
+	.long	0x4e5
+	.uleb128 0x1
+	.long	0xbf
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1033
+	.byte	0xb
+	.byte	0x78
+	.byte	0xc
+	.long	0x3c
+	.long	0x60f
+	.uleb128 0x1
+	.long	0xe1
+	.uleb128 0x1
+	.long	0xe1
+	.uleb128 0x1
+	.long	0x29
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1071
+	.byte	0x8
+	.value	0x21c
+	.byte	0x6
+	.long	0x637
+	.uleb128 0x2
+	.long	.LASF1034
+	.value	0x223
+	.byte	0x9
+	.long	0x187
+	.uleb128 0x6
+	.uleb128 0x2
+	.long	.LASF1035
+	.value	0x225
+	.byte	0xe
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1041
+	.value	0x1da
+	.byte	0xc
+	.long	0x187
+	.long	0x6b2
+	.uleb128 0x2
+	.long	.LASF1036
+	.value	0x1e0
+	.byte	0x19
+	.long	0x4b4
+	.uleb128 0x2
+	.long	.LASF1037
+	.value	0x1f4
+	.byte	0x17
+	.long	0x193
+	.uleb128 0x9
+	.string	"crc"
+	.value	0x1fa
+	.byte	0xe
+	.long	0xae
+	.uleb128 0x2
+	.long	.LASF1038
+	.value	0x20f
+	.byte	0x14
+	.long	0xba
+	.uleb128 0x18
+	.long	0x689
+	.uleb128 0x9
+	.string	"reg"
+	.value	0x1e6
+	.byte	0x1f
+	.long	0x58a
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"reg"
+	.value	0x1fc
+	.byte	0x1f
+	.long	0x58a
+	.uleb128 0x6
+	.uleb128 0x2
+	.long	.LASF1039
+	.value	0x201
+	.byte	0x18
+	.long	0xba
+	.uleb128 0x2
+	.long	.LASF1040
+	.value	0x202
+	.byte	0x1e
+	.long	0x45a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1042
+	.value	0x1ce
+	.byte	0xc
+	.long	0x187
+	.long	0x6db
+	.uleb128 0x14
+	.string	"end"
+	.value	0x1ce
+	.byte	0x2b
+	.long	0x35d
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"p"
+	.value	0x1d0
+	.byte	0x19
+	.long	0x35d
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1043
+	.value	0x1c2
+	.byte	0xc
+	.long	0x187
+	.long	0x704
+	.uleb128 0x14
+	.string	"reg"
+	.value	0x1c2
+	.byte	0x35
+	.long	0x58a
+	.uleb128 0x2
+	.long	.LASF1040
+	.value	0x1c4
+	.byte	0x1b
+	.long	0x704
+	.byte	0
+	.uleb128 0x8
+	.long	0x45a
+	.uleb128 0xd
+	.long	.LASF1044
+	.value	0x181
+	.byte	0xc
+	.long	0x187
+	.long	0x7c0
+	.uleb128 0x2
+	.long	.LASF1037
+	.value	0x186
+	.byte	0x17
+	.long	0x193
+	.uleb128 0x2
+	.long	.LASF1036
+	.value	0x18b
+	.byte	0x14
+	.long	0x3e6
+	.uleb128 0x9
+	.string	"crc"
+	.value	0x192
+	.byte	0xe
+	.long	0xae
+	.uleb128 0x2
+	.long	.LASF1045
+	.value	0x1a4
+	.byte	0x14
+	.long	0x474
+	.uleb128 0x2
+	.long	.LASF1038
+	.value	0x1ac
+	.byte	0x14
+	.long	0xba
+	.uleb128 0x9
+	.string	"err"
+	.value	0x1af
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1046
+	.value	0x1b4
+	.byte	0x14
+	.long	0xcb
+	.uleb128 0x2
+	.long	.LASF1047
+	.value	0x1b5
+	.byte	0x15
+	.long	0xdc
+	.uleb128 0x2
+	.long	.LASF1034
+	.value	0x1bc
+	.byte	0xf
+	.long	0x18e
+	.uleb128 0x18
+	.long	0x7b1
+	.uleb128 0x9
+	.string	"reg"
+	.value	0x194
+	.byte	0x1f
+	.long	0x58a
+	.uleb128 0x6
+	.uleb128 0x2
+	.long	.LASF1039
+	.value	0x195
+	.byte	0x18
+	.long	0xba
+	.uleb128 0x2
+	.long	.LASF1040
+	.value	0x196
+	.byte	0x18
+	.long	0x44e
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2
+	.long	.LASF1048
+	.value	0x1b6
+	.byte	0x14
+	.long	0xd0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1049
+	.byte	0x8
+	.value	0x16f
+	.byte	0x5
+	.long	0x187
+	.long	0x7ee
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"reg"
+	.value	0x175
+	.byte	0x1f
+	.long	0x58a
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"rec"
+	.value	0x176
+	.byte	0x1f
+	.long	0x704
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1050
+	.value	0x15e
+	.byte	0x1e
+	.long	0x704
+	.long	0x825
+	.uleb128 0x14
+	.string	"reg"
+	.value	0x15e
+	.byte	0x3d
+	.long	0x58a
+	.uleb128 0x19
+	.long	.LASF1051
+	.value	0x15e
+	.byte	0x56
+	.long	0x39b
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"pos"
+	.value	0x161
+	.byte	0x13
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1052
+	.value	0x135
+	.byte	0x1e
+	.long	0x704
+	.long	0x89c
+	.uleb128 0x14
+	.string	"reg"
+	.value	0x135
+	.byte	0x3d
+	.long	0x58a
+	.uleb128 0x19
+	.long	.LASF1051
+	.value	0x135
+	.byte	0x56
+	.long	0x39b
+	.uleb128 0x2
+	.long	.LASF1053
+	.value	0x137
+	.byte	0x1b
+	.long	0x704
+	.uleb128 0x9
+	.string	"p"
+	.value	0x13a
+	.byte	0x14
+	.long	0x35d
+	.uleb128 0x18
+	.long	0x875
+	.uleb128 0x2
+	.long	.LASF1040
+	.value	0x13d
+	.byte	0x1f
+	.long	0x704
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2
+	.long	.LASF1054
+	.value	0x14c
+	.byte	0x24
+	.long	0x89c
+	.uleb128 0x2
+	.long	.LASF1055
+	.value	0x14d
+	.byte	0x18
+	.long	0x35d
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"r"
+	.value	0x14f
+	.byte	0x1d
+	.long	0x35d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x4c0
+	.uleb128 0xd
+	.long	.LASF1056
+	.value	0x12d
+	.byte	0xc
+	.long	0x187
+	.long	0x8d6
+	.uleb128 0x19
+	.long	.LASF1040
+	.value	0x12d
+	.byte	0x30
+	.long	0x704
+	.uleb128 0x14
+	.string	"reg"
+	.value	0x12d
+	.byte	0x4c
+	.long	0x58a
+	.uleb128 0x19
+	.long	.LASF1051
+	.value	0x12d
+	.byte	0x65
+	.long	0x39b
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1072
+	.byte	0x8
+	.value	0x128
+	.byte	0xa
+	.long	0xae
+	.uleb128 0x2b
+	.long	.LASF1057
+	.byte	0x8
+	.byte	0xd4
+	.byte	0x5
+	.long	0x187
+	.long	0x962
+	.uleb128 0xf
+	.string	"p"
+	.byte	0xd6
+	.byte	0x14
+	.long	0x35d
+	.uleb128 0x5
+	.long	.LASF1036
+	.byte	0xd7
+	.byte	0x1b
+	.long	0x962
+	.uleb128 0xf
+	.string	"crc"
+	.byte	0xe7
+	.byte	0xe
+	.long	0xae
+	.uleb128 0x2
+	.long	.LASF1045
+	.value	0x100
+	.byte	0x1b
+	.long	0x967
+	.uleb128 0x2
+	.long	.LASF1058
+	.value	0x105
+	.byte	0x15
+	.long	0x96c
+	.uleb128 0x18
+	.long	0x93b
+	.uleb128 0x5
+	.long	.LASF1040
+	.byte	0xec
+	.byte	0x1f
+	.long	0x704
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2
+	.long	.LASF1054
+	.value	0x115
+	.byte	0x24
+	.long	0x89c
+	.uleb128 0x2
+	.long	.LASF1055
+	.value	0x116
+	.byte	0x18
+	.long	0x35d
+	.uleb128 0x6
+	.uleb128 0x9
+	.string	"r"
+	.value	0x118
+	.byte	0x1d
+	.long	0x35d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3f2
+	.uleb128 0x8
+	.long	0x480
+	.uleb128 0x8
+	.long	0xba
+	.uleb128 0x10
+	.long	.LASF1059
+	.byte	0x8
+	.byte	0xb4
+	.byte	0xc
+	.long	0x187
+	.long	0x9c3
+	.uleb128 0x11
+	.string	"p"
+	.byte	0x8
+	.byte	0xb4
+	.byte	0x2d
+	.long	0x35d
+	.uleb128 0x1a
+	.long	.LASF1020
+	.byte	0xb4
+	.byte	0x39
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF1054
+	.byte	0xb6
+	.byte	0x20
+	.long	0x89c
+	.uleb128 0x5
+	.long	.LASF1055
+	.byte	0xc7
+	.byte	0x14
+	.long	0x35d
+	.uleb128 0xf
+	.string	"r"
+	.byte	0xc8
+	.byte	0x14
+	.long	0x35d
+	.uleb128 0x6
+	.uleb128 0x5
+	.long	.LASF1040
+	.byte	0xca
+	.byte	0x1f
+	.long	0x704
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1068
+	.byte	0x8
+	.byte	0x9a
+	.byte	0xd
+	.long	0x9f1
+	.uleb128 0x1a
+	.long	.LASF1040
+	.byte	0x9a
+	.byte	0x34
+	.long	0x704
+	.uleb128 0x1a
+	.long	.LASF1060
+	.byte	0x9a
+	.byte	0x40
+	.long	0x187
+	.uleb128 0xf
+	.string	"pos"
+	.byte	0xa0
+	.byte	0xf
+	.long	0x43
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1061
+	.byte	0x8
+	.byte	0x89
+	.byte	0xc
+	.long	0x3c
+	.long	0xa31
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x89
+	.byte	0x24
+	.long	0x19f
+	.uleb128 0xf
+	.string	"low"
+	.byte	0x8b
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF1062
+	.byte	0x8c
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0x6
+	.uleb128 0xf
+	.string	"mid"
+	.byte	0x8f
+	.byte	0x13
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1063
+	.byte	0x8
+	.byte	0x83
+	.byte	0x1e
+	.long	0x704
+	.long	0xa4d
+	.uleb128 0x1a
+	.long	.LASF1064
+	.byte	0x83
+	.byte	0x30
+	.long	0x3c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1065
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x17
+	.long	0x35d
+	.long	0xa68
+	.uleb128 0x11
+	.string	"p"
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x33
+	.long	0x35d
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1073
+	.byte	0x8
+	.byte	0x70
+	.byte	0x6
+	.uleb128 0x10
+	.long	.LASF1066
+	.byte	0x6
+	.byte	0x39
+	.byte	0x18
+	.long	0xae
+	.long	0xa8d
+	.uleb128 0x11
+	.string	"reg"
+	.byte	0x6
+	.byte	0x39
+	.byte	0x33
+	.long	0x58a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1067
+	.byte	0x6
+	.byte	0x38
+	.byte	0x17
+	.long	0x9d
+	.long	0xaaa
+	.uleb128 0x11
+	.string	"reg"
+	.byte	0x6
+	.byte	0x38
+	.byte	0x35
+	.long	0x58a
+	.byte	0
+	.uleb128 0x2e
+	.string	"pgN"
+	.byte	0x6
+	.byte	0x37
+	.byte	0x18
+	.long	0xae
+	.uleb128 0x11
+	.string	"reg"
+	.byte	0x6
+	.byte	0x37
+	.byte	0x30
+	.long	0x58a
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF396
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF459
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF513
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF586
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF513
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF686
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF690
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF754
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF758
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF759
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 33 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 35 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF926
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF927
+	.byte	0x4
+	.file 36 "./src/main/config/config_unittest.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF928
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF951
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF484
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF486
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF509
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF512
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF518
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF524
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF571
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF617
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF619
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF617
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF619
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF757
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF853
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF854
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF855
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF861
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF870
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF851
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1074
+	.long	.LASF1075
+	.long	.LASF1076
+	.long	.LASF1077
+	.long	.LASF1078
+	.long	.LASF1079
+	.long	.LASF1080
+	.long	.LASF1081
+	.long	.LASF1082
+	.long	.LASF1083
+	.long	.LASF1084
+	.long	.LASF1085
+	.long	.LASF1086
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x25
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1087
+	.byte	0xd
+	.long	.LASF1088
+	.byte	0x9
+	.long	.LASF1089
+	.byte	0x9
+	.long	.LASF1090
+	.byte	0xc
+	.long	.LASF1091
+	.byte	0x3
+	.long	.LASF1092
+	.byte	0x3
+	.long	.LASF1093
+	.byte	0x4
+	.long	.LASF1094
+	.byte	0x3
+	.long	.LASF1095
+	.byte	0xc
+	.long	.LASF1096
+	.byte	0x2
+	.long	.LASF1097
+	.byte	0xc
+	.long	.LASF1098
+	.byte	0x5
+	.long	.LASF1099
+	.byte	0xc
+	.long	.LASF1100
+	.byte	0xd
+	.long	.LASF1090
+	.byte	0xd
+	.long	.LASF1101
+	.byte	0x9
+	.long	.LASF1102
+	.byte	0xc
+	.long	.LASF1103
+	.byte	0xc
+	.long	.LASF1104
+	.byte	0x9
+	.long	.LASF1105
+	.byte	0x9
+	.long	.LASF1106
+	.byte	0xb
+	.long	.LASF1107
+	.byte	0x9
+	.long	.LASF1108
+	.byte	0xa
+	.long	.LASF1109
+	.byte	0xa
+	.long	.LASF1110
+	.byte	0x9
+	.long	.LASF1111
+	.byte	0x9
+	.long	.LASF1112
+	.byte	0x9
+	.long	.LASF1113
+	.byte	0x9
+	.long	.LASF1114
+	.byte	0x8
+	.long	.LASF1115
+	.byte	0x8
+	.long	.LASF1116
+	.byte	0x7
+	.long	.LASF1117
+	.byte	0x6
+	.long	.LASF1118
+	.byte	0x6
+	.long	.LASF1119
+	.byte	0x1
+	.long	.LASF1120
+	.byte	0x3
+	.long	.LASF1121
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF706:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF792:
+	.string	"TELEMETRY_CRSF "
+.LASF641:
+	.string	"__STD_TYPE typedef"
+.LASF770:
+	.string	"USE_CLI_BATCH "
+.LASF511:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF954:
+	.string	"unsigned char"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF958:
+	.string	"size_t"
+.LASF1023:
+	.string	"config_streamer_finish"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF827:
+	.string	"ACC "
+.LASF777:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF992:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF610:
+	.string	"__stub_sigreturn "
+.LASF475:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF925:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1040:
+	.string	"record"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF587:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF993:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF548:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF674:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF745:
+	.string	"INT16_C(c) c"
+.LASF519:
+	.string	"__GNU_LIBRARY__"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF850:
+	.string	"STACK_CHECK"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1065:
+	.string	"alignToWrite"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1007:
+	.string	"deltaSequence"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF845:
+	.string	"USE_UART7 "
+.LASF899:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1050:
+	.string	"findEEPROM"
+.LASF714:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF562:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF661:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF686:
+	.string	"__STD_TYPE"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF724:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF535:
+	.string	"__P(args) args"
+.LASF1053:
+	.string	"found"
+.LASF417:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF926:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF778:
+	.string	"USE_SERIALRX_SUMD "
+.LASF452:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF854:
+	.string	"USE_VCP"
+.LASF728:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF410:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF749:
+	.string	"UINT16_C(c) c"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF433:
+	.string	"__size_t "
+.LASF693:
+	.string	"INT8_MIN (-128)"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF638:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF523:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF795:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1035:
+	.string	"attempt"
+.LASF942:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF550:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF421:
+	.string	"_T_SIZE "
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF702:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF723:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF478:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1071:
+	.string	"writeConfigToEEPROM"
+.LASF365:
+	.string	"__k8 1"
+.LASF465:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF819:
+	.string	"U_ID_1 1"
+.LASF545:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1011:
+	.string	"eepromConfigVersion"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF861:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF987:
+	.string	"__pg_registry_start"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF606:
+	.string	"__stub_fchflags "
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1046:
+	.string	"blank"
+.LASF663:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF771:
+	.string	"USE_PPM "
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1066:
+	.string	"pgSize"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF489:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF439:
+	.string	"_T_WCHAR "
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF870:
+	.string	"USE_RESOURCE_MGMT"
+.LASF474:
+	.string	"__USE_XOPEN2K8"
+.LASF800:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF572:
+	.string	"__always_inline"
+.LASF419:
+	.string	"_SYS_SIZE_T_H "
+.LASF775:
+	.string	"USE_SERIALRX_IBUS "
+.LASF789:
+	.string	"USE_SERVOS "
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF485:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF695:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF521:
+	.string	"__GLIBC__ 2"
+.LASF952:
+	.string	"long int"
+.LASF513:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF869:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1031:
+	.string	"memmove"
+.LASF978:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF490:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF507:
+	.string	"__USE_XOPEN2K8 1"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF921:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF381:
+	.string	"__unix 1"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF799:
+	.string	"USE_RCSPLIT "
+.LASF1004:
+	.string	"deltaStart"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF976:
+	.string	"pgn_t"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1047:
+	.string	"configStart"
+.LASF668:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1029:
+	.string	"pgReset"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF730:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF955:
+	.string	"short unsigned int"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF569:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF984:
+	.string	"copy"
+.LASF428:
+	.string	"_SIZE_T_DECLARED "
+.LASF537:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF937:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF851:
+	.string	"USE_DASHBOARD"
+.LASF864:
+	.string	"USE_SERIALRX_XBUS"
+.LASF593:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1055:
+	.string	"recordsEnd"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF979:
+	.string	"PGR_SIZE_MASK"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF996:
+	.string	"failureMode_e"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF558:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF737:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF974:
+	.string	"_Bool"
+.LASF1062:
+	.string	"high"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF924:
+	.string	"Q12 (1 << 12)"
+.LASF458:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF945:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF514:
+	.string	"__USE_MISC 1"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF648:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1000:
+	.string	"recordIndex"
+.LASF518:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF528:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF936:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF893:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF957:
+	.string	"signed char"
+.LASF915:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF964:
+	.string	"uint8_t"
+.LASF659:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF628:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF539:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF935:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF862:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF643:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF586:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF828:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF982:
+	.string	"config_streamer_s"
+.LASF975:
+	.string	"config_streamer_t"
+.LASF798:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF393:
+	.string	"__REVISION__ \"780bc8c\""
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF874:
+	.string	"TELEMETRY_SRXL"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF855:
+	.string	"USE_PPM"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF427:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF588:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF430:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF495:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF536:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF715:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF429:
+	.string	"__DEFINED_size_t "
+.LASF1009:
+	.string	"CR_CLASSICATION_PROFILE_LAST"
+.LASF980:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF886:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF841:
+	.string	"USE_UART3 "
+.LASF911:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF972:
+	.string	"buffer"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1036:
+	.string	"header"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF694:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF882:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1008:
+	.string	"CR_CLASSICATION_SYSTEM"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF580:
+	.string	"__restrict_arr __restrict"
+.LASF604:
+	.string	"__stub___compat_bdflush "
+.LASF425:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF453:
+	.string	"NULL"
+.LASF1017:
+	.string	"configRecord_t"
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF670:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF482:
+	.string	"__USE_GNU"
+.LASF517:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF710:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF559:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF708:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF609:
+	.string	"__stub_setlogin "
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF756:
+	.string	"__need_size_t "
+.LASF875:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF631:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF592:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF577:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF497:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF754:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF961:
+	.string	"__uint16_t"
+.LASF472:
+	.string	"__USE_XOPEN2K"
+.LASF685:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF757:
+	.string	"__need_NULL "
+.LASF473:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF822:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF575:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF620:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF973:
+	.string	"unlocked"
+.LASF416:
+	.string	"__size_t__ "
+.LASF504:
+	.string	"__USE_POSIX199309 1"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF721:
+	.string	"INT_FAST8_MAX (127)"
+.LASF709:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1016:
+	.string	"flags"
+.LASF1060:
+	.string	"replace"
+.LASF636:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF831:
+	.string	"MAG "
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF750:
+	.string	"UINT32_C(c) c ## U"
+.LASF729:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF467:
+	.string	"__USE_POSIX199309"
+.LASF700:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF902:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF719:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1027:
+	.string	"config_streamer_init"
+.LASF522:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF471:
+	.string	"__USE_UNIX98"
+.LASF774:
+	.string	"USE_SERIALRX_CRSF "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF933:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF488:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF813:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF684:
+	.string	"_BITS_TIME64_H 1"
+.LASF1032:
+	.string	"crc16_ccitt_update"
+.LASF647:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF447:
+	.string	"__INT_WCHAR_T_H "
+.LASF632:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF677:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF814:
+	.string	"SIMULATOR_BUILD "
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1068:
+	.string	"addToRecordIndex"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF717:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF767:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF544:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF679:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF669:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF890:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF623:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF398:
+	.string	"bool _Bool"
+.LASF917:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF959:
+	.string	"__uint8_t"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF442:
+	.string	"_BSD_WCHAR_T_ "
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF726:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF763:
+	.string	"I2C1_OVERCLOCK true"
+.LASF897:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF557:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF977:
+	.string	"PGR_PGN_MASK"
+.LASF551:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF727:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF658:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF720:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1010:
+	.string	"configRecordFlags_e"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF454:
+	.string	"NULL ((void *)0)"
+.LASF1021:
+	.string	"configDeltaHeader_t"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF820:
+	.string	"U_ID_2 2"
+.LASF829:
+	.string	"GYRO "
+.LASF567:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF865:
+	.string	"LED_STRIP"
+.LASF455:
+	.string	"__need_NULL"
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1052:
+	.string	"scanEEPROM"
+.LASF846:
+	.string	"USE_UART8 "
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF948:
+	.string	"CR_CLASSIFICATION_MASK (0x3)"
+.LASF508:
+	.string	"_ATFILE_SOURCE"
+.LASF637:
+	.string	"__SLONG32_TYPE int"
+.LASF742:
+	.string	"WINT_MIN (0u)"
+.LASF1064:
+	.string	"index"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF459:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1014:
+	.string	"configHeader_t"
+.LASF461:
+	.string	"__USE_ISOC11"
+.LASF512:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF802:
+	.string	"USE_SENSOR_NAMES "
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF691:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF761:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF733:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF626:
+	.string	"_BITS_TYPES_H 1"
+.LASF701:
+	.string	"UINT8_MAX (255)"
+.LASF738:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF530:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF748:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF498:
+	.string	"_POSIX_SOURCE"
+.LASF901:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF962:
+	.string	"__uint32_t"
+.LASF496:
+	.string	"__USE_ISOC95 1"
+.LASF596:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF420:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1018:
+	.string	"terminator"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1070:
+	.string	"SystemCoreClock"
+.LASF895:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF888:
+	.string	"UNUSED(x) (void)(x)"
+.LASF549:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF928:
+	.string	"EEPROM_RECORD_SCANNED() {}"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF698:
+	.string	"INT16_MAX (32767)"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF997:
+	.string	"__config_start"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF531:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1039:
+	.string	"regSize"
+.LASF460:
+	.string	"_FEATURES_H 1"
+.LASF493:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF913:
+	.string	"VERY_FAST_MATH "
+.LASF1045:
+	.string	"footer"
+.LASF456:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF689:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF887:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF801:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF923:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF561:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF877:
+	.string	"VTX_CONTROL"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF967:
+	.string	"uintptr_t"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF642:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF930:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF847:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF411:
+	.string	"___int_ptrdiff_t_h "
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF939:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF776:
+	.string	"USE_SERIALRX_SBUS "
+.LASF406:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF480:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF868:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF817:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1026:
+	.string	"config_streamer_start"
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF402:
+	.string	"_STDDEF_H "
+.LASF894:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF678:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF766:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF438:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF856:
+	.string	"USE_PWM"
+.LASF589:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF891:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF466:
+	.string	"__USE_POSIX2"
+.LASF1042:
+	.string	"isLogSpaceBlank"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF434:
+	.string	"__need_size_t"
+.LASF1013:
+	.string	"boardIdentifier"
+.LASF423:
+	.string	"_SIZE_T_ "
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF857:
+	.string	"SERIAL_RX"
+.LASF746:
+	.string	"INT32_C(c) c"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF435:
+	.string	"__wchar_t__ "
+.LASF598:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF603:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1024:
+	.string	"config_streamer_flush"
+.LASF769:
+	.string	"USE_SETTINGS_INDEX "
+.LASF405:
+	.string	"_PTRDIFF_T "
+.LASF835:
+	.string	"USE_FLASHFS "
+.LASF457:
+	.string	"_STDINT_H 1"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF881:
+	.string	"USE_SPI"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1025:
+	.string	"config_streamer_write"
+.LASF999:
+	.string	"eepromConfigSize"
+.LASF584:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF440:
+	.string	"__WCHAR_T "
+.LASF968:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF876:
+	.string	"VTX_COMMON"
+.LASF534:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF949:
+	.string	"CRC_START_VALUE 0xFFFF"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF938:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF30:
+	.string	"_LP64 1"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF565:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF529:
+	.string	"__LEAF , __leaf__"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF583:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF525:
+	.string	"__PMT"
+.LASF1043:
+	.string	"isSavedRecordCurrent"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF920:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1012:
+	.string	"magic_be"
+.LASF664:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF509:
+	.string	"_ATFILE_SOURCE 1"
+.LASF633:
+	.string	"__SQUAD_TYPE long int"
+.LASF863:
+	.string	"USE_SERIALRX_SUMH"
+.LASF640:
+	.string	"__U64_TYPE unsigned long int"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF483:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF600:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF404:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF916:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF889:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF788:
+	.string	"USE_RESOURCE_MGMT "
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF809:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1063:
+	.string	"indexedRecord"
+.LASF595:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1002:
+	.string	"recordIndexOverflow"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF837:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF956:
+	.string	"unsigned int"
+.LASF1005:
+	.string	"logEnd"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF907:
+	.string	"UNIT_TESTED "
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF781:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF950:
+	.string	"CRC_CHECK_VALUE 0x1D0F"
+.LASF479:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF476:
+	.string	"__USE_LARGEFILE"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF397:
+	.string	"_STDBOOL_H "
+.LASF449:
+	.string	"_WCHAR_T_DECLARED "
+.LASF787:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF506:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF671:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF630:
+	.string	"__U32_TYPE unsigned int"
+.LASF407:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF556:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF560:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF994:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF582:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF607:
+	.string	"__stub_gtty "
+.LASF436:
+	.string	"__WCHAR_T__ "
+.LASF712:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF667:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF705:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1067:
+	.string	"pgVersion"
+.LASF983:
+	.string	"pgRegistry_s"
+.LASF986:
+	.string	"pgRegistry_t"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF624:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF941:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF796:
+	.string	"TELEMETRY_SRXL "
+.LASF571:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF866:
+	.string	"TELEMETRY_FRSKY"
+.LASF400:
+	.string	"false 0"
+.LASF1020:
+	.string	"sequence"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF744:
+	.string	"INT8_C(c) c"
+.LASF399:
+	.string	"true 1"
+.LASF413:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF998:
+	.string	"__config_end"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF970:
+	.string	"address"
+.LASF520:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF646:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF910:
+	.string	"sq(x) ((x)*(x))"
+.LASF653:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF532:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1048:
+	.string	"page"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF538:
+	.string	"__STRING(x) #x"
+.LASF1037:
+	.string	"streamer"
+.LASF848:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF585:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF815:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF680:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF437:
+	.string	"_WCHAR_T "
+.LASF803:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF834:
+	.string	"USE_FAKE_BARO "
+.LASF758:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF412:
+	.string	"_GCC_PTRDIFF_T "
+.LASF811:
+	.string	"USE_NAV "
+.LASF1034:
+	.string	"success"
+.LASF608:
+	.string	"__stub_revoke "
+.LASF963:
+	.string	"char"
+.LASF533:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF594:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF418:
+	.string	"_SIZE_T "
+.LASF445:
+	.string	"_WCHAR_T_H "
+.LASF839:
+	.string	"USE_UART1 "
+.LASF707:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF940:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF832:
+	.string	"USE_FAKE_MAG "
+.LASF879:
+	.string	"VTX_TRAMP"
+.LASF553:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF849:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF655:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF929:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF403:
+	.string	"_STDDEF_H_ "
+.LASF1041:
+	.string	"writeChangesToEEPROM"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF422:
+	.string	"__SIZE_T "
+.LASF782:
+	.string	"BLACKBOX "
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF824:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1073:
+	.string	"initEEPROM"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF859:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF463:
+	.string	"__USE_ISOC95"
+.LASF735:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF462:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF470:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF873:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1051:
+	.string	"classification"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF573:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF540:
+	.string	"__BEGIN_DECLS "
+.LASF448:
+	.string	"_GCC_WCHAR_T "
+.LASF716:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF927:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF568:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF808:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF505:
+	.string	"__USE_POSIX199506 1"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF692:
+	.string	"__intptr_t_defined "
+.LASF683:
+	.string	"__FD_SETSIZE 1024"
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF662:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF971:
+	.string	"size"
+.LASF793:
+	.string	"TELEMETRY_IBUS "
+.LASF880:
+	.string	"USE_I2C"
+.LASF1044:
+	.string	"writeSettingsToEEPROM"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF833:
+	.string	"BARO "
+.LASF390:
+	.string	"SITL 1"
+.LASF989:
+	.string	"FAILURE_DEVELOPER"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF464:
+	.string	"__USE_ISOCXX11"
+.LASF426:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF951:
+	.string	"CONFIG_WRITE_ALIGN sizeof(uint32_t)"
+.LASF965:
+	.string	"uint16_t"
+.LASF896:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF599:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF408:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1059:
+	.string	"isDeltaBlockValid"
+.LASF713:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF953:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF947:
+	.string	"EEPROM_RECORD_INDEX_SIZE 96"
+.LASF501:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF830:
+	.string	"USE_FAKE_GYRO "
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF396:
+	.string	"SRC_MAIN_CONFIG_CONFIG_EEPROM_C_ "
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF699:
+	.string	"INT32_MAX (2147483647)"
+.LASF564:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF468:
+	.string	"__USE_POSIX199506"
+.LASF1054:
+	.string	"delta"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF751:
+	.string	"UINT64_C(c) c ## UL"
+.LASF843:
+	.string	"USE_UART5 "
+.LASF943:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF858:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1003:
+	.string	"recordIndexValid"
+.LASF510:
+	.string	"__WORDSIZE 64"
+.LASF444:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1001:
+	.string	"recordIndexCount"
+.LASF790:
+	.string	"CMS "
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF931:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF611:
+	.string	"__stub_stty "
+.LASF791:
+	.string	"TELEMETRY_LTM "
+.LASF797:
+	.string	"USE_DASHBOARD "
+.LASF1069:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF546:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF883:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF852:
+	.string	"TELEMETRY_LTM"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF639:
+	.string	"__S64_TYPE long int"
+.LASF424:
+	.string	"_BSD_SIZE_T_ "
+.LASF543:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF469:
+	.string	"__USE_XOPEN"
+.LASF441:
+	.string	"_WCHAR_T_ "
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF1015:
+	.string	"version"
+.LASF944:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF629:
+	.string	"__S32_TYPE int"
+.LASF703:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1057:
+	.string	"isEEPROMContentValid"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF656:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF885:
+	.string	"DEFIO_NO_PORTS "
+.LASF741:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF613:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF755:
+	.string	"_STRING_H 1"
+.LASF687:
+	.string	"_BITS_WCHAR_H 1"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF747:
+	.string	"INT64_C(c) c ## L"
+.LASF816:
+	.string	"SKIP_IMU_CALC "
+.LASF515:
+	.string	"__USE_ATFILE 1"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF753:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF912:
+	.string	"FAST_MATH "
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF919:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF860:
+	.string	"USE_SERIALRX_SBUS"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1022:
+	.string	"memcmp"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF605:
+	.string	"__stub_chflags "
+.LASF823:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF772:
+	.string	"USE_PWM "
+.LASF432:
+	.string	"_SIZET_ "
+.LASF932:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF673:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF844:
+	.string	"USE_UART6 "
+.LASF773:
+	.string	"SERIAL_RX "
+.LASF810:
+	.string	"GPS "
+.LASF764:
+	.string	"I2C2_OVERCLOCK true"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF666:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF985:
+	.string	"reset"
+.LASF576:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF481:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF825:
+	.string	"USE_FAKE_LED "
+.LASF688:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF566:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF853:
+	.string	"USE_ADC"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF725:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1049:
+	.string	"loadEEPROM"
+.LASF934:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF541:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1072:
+	.string	"getEEPROMConfigSize"
+.LASF739:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1061:
+	.string	"searchRecordIndex"
+.LASF602:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF995:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF960:
+	.string	"short int"
+.LASF524:
+	.string	"_SYS_CDEFS_H 1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF491:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF579:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF697:
+	.string	"INT8_MAX (127)"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF554:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF922:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF812:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF908:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF591:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF634:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF619:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF415:
+	.string	"__need_ptrdiff_t"
+.LASF1006:
+	.string	"baseCrc"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1028:
+	.string	"failureMode"
+.LASF409:
+	.string	"_PTRDIFF_T_ "
+.LASF672:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF552:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF909:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF651:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF988:
+	.string	"__pg_registry_end"
+.LASF900:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF555:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF635:
+	.string	"__SWORD_TYPE long int"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF563:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF502:
+	.string	"__USE_POSIX 1"
+.LASF734:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF731:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF601:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF450:
+	.string	"__DEFINED_wchar_t "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF903:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF906:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF768:
+	.string	"USE_CLI "
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF627:
+	.string	"__S16_TYPE short int"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF743:
+	.string	"WINT_MAX (4294967295u)"
+.LASF740:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF704:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF570:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF574:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1056:
+	.string	"recordMatches"
+.LASF446:
+	.string	"___int_wchar_t_h "
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF590:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF665:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF578:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF696:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF492:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF431:
+	.string	"_GCC_SIZE_T "
+.LASF840:
+	.string	"USE_UART2 "
+.LASF732:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF946:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF451:
+	.string	"_BSD_WCHAR_T_"
+.LASF711:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF966:
+	.string	"uint32_t"
+.LASF494:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF645:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF718:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF542:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF499:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF503:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF657:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF884:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1033:
+	.string	"strncasecmp"
+.LASF597:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1058:
+	.string	"storedCrc"
+.LASF618:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF649:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF818:
+	.string	"U_ID_0 0"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF650:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF892:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF762:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF914:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF878:
+	.string	"VTX_SMARTAUDIO"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF527:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF383:
+	.string	"unix 1"
+.LASF690:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF969:
+	.string	"float"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF722:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF621:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF780:
+	.string	"USE_SERIALRX_XBUS "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF516:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF625:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF622:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF401:
+	.string	"__bool_true_false_are_defined 1"
+.LASF981:
+	.string	"pgResetFunc"
+.LASF676:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF794:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF779:
+	.string	"USE_SERIALRX_SUMH "
+.LASF414:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF990:
+	.string	"FAILURE_MISSING_ACC"
+.LASF918:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF547:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF905:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF991:
+	.string	"FAILURE_ACC_INIT"
+.LASF867:
+	.string	"TELEMETRY_HOTT"
+.LASF1038:
+	.string	"invertedBigEndianCrc"
+.LASF652:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF842:
+	.string	"USE_UART4 "
+.LASF484:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF826:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF477:
+	.string	"__USE_LARGEFILE64"
+.LASF1019:
+	.string	"configFooter_t"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF836:
+	.string	"USE_FAKE_FLASH "
+.LASF898:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF682:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF904:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF378:
+	.string	"__linux 1"
+.LASF443:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF760:
+	.string	"_STRINGS_H 1"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF681:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF736:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1030:
+	.string	"pgLoad"
+.LASF500:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF675:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF838:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF752:
+	.string	"INTMAX_C(c) c ## L"
+.LASF821:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF644:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF581:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF872:
+	.string	"TELEMETRY_IBUS"
+.LASF871:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1103:
+	.string	"features-time64.h"
+.LASF1091:
+	.string	"config_streamer.h"
+.LASF1115:
+	.string	"__locale_t.h"
+.LASF1116:
+	.string	"platform.h"
+.LASF1098:
+	.string	"target.h"
+.LASF1101:
+	.string	"libc-header-start.h"
+.LASF1100:
+	.string	"stdbool.h"
+.LASF1084:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1075:
+	.string	"src/main/common"
+.LASF1113:
+	.string	"stdint-intn.h"
+.LASF1117:
+	.string	"common_fc_pre.h"
+.LASF1083:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1086:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1108:
+	.string	"stubs.h"
+.LASF1078:
+	.string	"src/main/target/SITL"
+.LASF1105:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1082:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1107:
+	.string	"long-double.h"
+.LASF1097:
+	.string	"strings.h"
+.LASF0:
+	.string	"./src/main/config/config_eeprom.c"
+.LASF1088:
+	.string	"types.h"
+.LASF1093:
+	.string	"system.h"
+.LASF1077:
+	.string	"src/main/drivers"
+.LASF1085:
+	.string	"/usr/include"
+.LASF1074:
+	.string	"src/main/build"
+.LASF1118:
+	.string	"common_fc_post.h"
+.LASF1102:
+	.string	"features.h"
+.LASF1110:
+	.string	"typesizes.h"
+.LASF1114:
+	.string	"locale_t.h"
+.LASF1121:
+	.string	"config_unittest.h"
+.LASF1076:
+	.string	"src/main/config"
+.LASF1111:
+	.string	"time64.h"
+.LASF1089:
+	.string	"stdint-uintn.h"
+.LASF1112:
+	.string	"wchar.h"
+.LASF1080:
+	.string	"src/main"
+.LASF1079:
+	.string	"src/main/target"
+.LASF1094:
+	.string	"config_eeprom.c"
+.LASF1120:
+	.string	"config_eeprom.h"
+.LASF1081:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1096:
+	.string	"maths.h"
+.LASF1095:
+	.string	"string.h"
+.LASF1106:
+	.string	"cdefs.h"
+.LASF1090:
+	.string	"stdint.h"
+.LASF1119:
+	.string	"build_config.h"
+.LASF1087:
+	.string	"stddef.h"
+.LASF1109:
+	.string	"stubs-64.h"
+.LASF1104:
+	.string	"wordsize.h"
+.LASF1092:
+	.string	"parameter_group.h"
+.LASF1099:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\210\001U\013"
+	.string	"r\31677Pu\032\003\203\020\274v\177\374\206\211)t\001\255\376\235\254\341\311\240$=I\226"
+	.string	"\274\177\242\315\314\314\314\314\264y\024m\204\220\037\315\310\330[\356\275\245\354&\245\224i\247\266\337($-\030\373`\251\324(\\\322\207\330\\T$8Km\250F@\276=/z\267\303\f\201(\024\b\007\006\237\177"
+	.string	".\315p\227\216\235\231\002\323\325\013\215\005\2017T\270\023\032\240%\021\035\026\001\337\327\335Y\211\023\216\210\200x\315NV\t\210\207\327m\257\257\335\271\337\337-\213\327dVo\353\345\033.\231\226\t\344\356M5\316\004\243\005\261a\307\344\314\320(Mh\231\347\236G\213s\002S\266b\364\376\374\264R\004\223\323B\177\371x\211HT1S\332o\024\222\342\357_>\275\037\312\264r\337U\312\315\311 \377!B\250QE\201d\346\264\3114\006@\002\304Pa\017\022"
+	.ascii	"t+\360\334\204\356\377g,q\024Z/\026J\273\b\377i8Yiu\223t\224"
+	.ascii	"\262[]\2371\255\366\340$;~\320\377\026sd]Gc\341\344p\300\216"
+	.ascii	"\244\337\207\177_\2561\371e\\\310\260\034\377$Is_\365\016\321"
+	.ascii	"\272\300\216FJ\343'A|\3764\243|O\t\331\350\252\270\256%\t\362"
+	.ascii	"\310H\300A\245T\022\375\316st\312\304+\027\001E\377q\223\n\344"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\345\004"
+	.string	"\342F\022\027\200\251\351303\231\201\031\rq\370\330\344\t\247\350\215m\211\2242\005\377\242+z\342G\034\266!mC\247U\206\211#'bW\330\273\017\276\024t\363$y\006\266'\215\275\356\007\\\263\264\260\306\347\341\310\337\203\235\360\030\001$ `\202a\254\356\214\210 ]\001m"
+	.ascii	"\217rP\313\r\033\270\201\302\300\177#\026,f\021!\213t\273'-\264"
+	.ascii	"\321C\035\017\026\\\333\253\304\372\030rk9`\327i\313!D,\003="
+	.ascii	"\326\345\016\"\004\226\271%\003\336\352\352Z\0221\244a\315\r"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.inline.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\034\007E\037"
+	.string	"&\354\224F\300\230I\032\003\0203\003\237a\023|W\337\356\247\365J\245d\304n\022\276!q\326<|\271\243p\037\344\""
+	.string	"@B\270 \202\240\240"
+	.string	"Qp\004\274\340\004\327\035Ew\374\202~:t\214\256@5b\037\322\366\2262\005u"
+	.string	"\177"
+	.string	"\214"
+	.ascii	"6\256g\237\276\276\340\357aa 9\202%\202\021\324\341\244H\226"
+	.ascii	"\203"
+	.string	"9\b\323\342\260i\213\244\242\307\022|a\357\317Ja!eD\177\355\305\345+\343A\020\276\361\245)\315\037[\335\033\300\r\300\276Y\325\270\016m\212#UQ^\273~\024\334w\330*TL\265\330\276vX,TL\265\001o\\h\345\373z\313\375\2109'\211\207\253\353*\004\347\234\023\300\023X\302\002+\201\366J\353\312\f\275g\017r\323\346n\331\252\342\340\254\256S\2523\004\240\0308\2355\322(\225\373\341)XX\255\351\201\265\240\273t)\234\\\243\003\234\261B\232\013\256\3719lU\030\333\322\315rX&alK5\277\236}\277\340\263\357\331\267\177M\214B\333\302\214\225-v\354\216\264\243\356\215@:l/\316!\032\333\020z\201\213-\b\"\250\303Ii\006\202i\344\031\265q\251\213g\037\374\r\033\242h\223\236\240TQ\360\215\256\2607\254\022!?\240\224\351J\253\213\313\007jy\242\261\265JY\234b"
+	.string	"m\026\247\027W*\264SCjBn\344=\360\034\034%Z2_\276@\351\\@\005\354\354\273&>\022\234^vHU\360"
+	.string	"\263\300$\241r\226\204\001\317\276\3416\256\256g\331i\330\f\260\204\325ge\331y\213Ci\305\022\317r\372"
+	.string	"\321e\307\315eG\213o\367\2637\232\236<\351Ro\313\240\270\fZ\247\233\226\031\327+u\036\377\013\330it\233\252\260\216bEp\353\307\212 9\357|\202\373\"H5\365\215A0&\005\021-\331\262\240]\250\263\215\243)5D\300\0346,1\227y\220\340uu\"\b%U\263y{\023\254$\023S9\346\255\201\207\240\2149\247\353\234\270\007o\021\252\214\233g=m"
+	.string	"W\031\307\263 \206Q\212<\241\031g\366\371D\330q\303\336\375\003yD-\271\001\301[RT\323\016-\227\255->\030\310\177gu'p;\001\200\274\250\201)3\206fdd$I\222\016P\002A\210\306\310\016\022\200u9\346D\242\251\221\244 \245a\377\f\237\305\013\013\004\354\231\234d\202x^\273\0054\373\301\032/\305T\376\0376\031\212<\260h\242\256\306\313\031\224\016\001\362\365\240\\\310\271F\200\343D\367\206\210\354om\r\1775\233\021\363\231\221\316\334\201Q\374\325I\253\322l\231*c\201\177\265\360\3426#\230C\202=6\262\311D\216M\034\375\037\261e\342\2205\274\326\341\224\332\254p\220x\212I<\266\305G\277\265\360\261N\226\371\240K|@\004\303"
+	.string	"O\240S\371\225\033\376YM'\217/\314\023\2217\306\022\304\320\016\241\205\321b\350Q)\002z\260\275\311\256}Y?\234L\033\276\304O\363\002:\364\364\210m\246\337\0047\214\373/y\356\312\360\361\342\025\211\004\243T)}HQ5@\372&\377\037\373C\257\244!\031\352 \256\316B\303z\356\255\302\272\370\244\3728\b\353'\350\304\240\0264\022\tl<\005\250}\313\007\345r\025\334\007\347\007\217,F\306:\024\326\215\256\261\246;#\335\266y\264\020\256`\220Qx\204\020g0\024\036\237\001W'\016+{\206U\235\303\0218\264\034I\030\333\004\0300n_\371\357\374\303\246>\363\322|U\314'\341\214.\344\314\\Y@\314\273\374\337\r5\220o\316\275\317Su"
+	.ascii	"\037\016\362b\300\023b\fYFk\361M\1775!%R\252/NE\237<w\275\004"
+	.ascii	"\334\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\256\b5\024"
+	.string	"fVB5@/L\322\001\217\021Q\261 \301qD,d\373\240\305\206h4\274<\222\373v\026\206aX\201\020\365\345\260\002\341\021\272i\016\343C\201\317d\271\331\335\b\221I\006."
+	.string	"3"
+	.string	"4"
+	.string	"\337\306\225\017q\247c\255\265\346\363\024\355\376FX\347U]\270\272L\366\321\246\266\361\265G/\225-\037\374\251YP\247\227\236\003h$"
+	.ascii	"\r\001\266\211/1\304\243[\304\363\351\223\304m)\247\324W\261"
+	.ascii	"^\230LJGd\316\221\365\264\322Zi\255\331\302jO\317\351\tp\002"
+	.ascii	"@k\211q\211uh\255v\004\016n\025\371 \021\260i>\020\326\222\007"
+	.ascii	"xo\200\222\002\322k\001\362\tVhqfROO\340\236\031c\240\2608\221"
+	.ascii	"\276\201\221^\006c\313\305\374\330Q\244o\001\224P\001\002\205"
+	.ascii	"\206$\204\344*&\257_X\370>\347!\025\234\3250'6\214\225\t\256"
+	.ascii	"\203\203aIZ1\213\363\3009\360>D\350\031n:]\330Mb\320\364ekpO"
+	.ascii	"]\200\254\250\321\301\242\231IR)l\254\001`\"\0312\253n\022\340"
+	.ascii	"\361@\204\202i\030\344\2242\314\310T@#ZTPX"
+	.string	"\3110\006\342\303K\212(11A\r\271\226\330\222\214uPOHp%d\013\304e\032=\202\344\230kd\275\216!\253\242\256%db\333\302\245a\234&\233\t=\207$\363r\315\231A4[6V\302\322\3206@\323ef\354+)\202L=\2357\243\307\260\025\342K\002F:\004CS^_\246\311\233\024f\365\255\205\002\025.\002Q\233\210D\320@\373_\314uAH\223E\336\212cz\310\240\224\204\271\003\265)l\322l\226fS\177vM\305Ju\020V\364\246\250\b\234sL\256\324\366\266<\177\214\357\312\bT\3649*N2R\b8\023AV\312\3459[\t\201{\305\317\277\230@7\270\035\215E|\003\236\342\344\007<\355\320\005\003\344{\261\t\202\177\024$\216O\307\"G`\017$/\353\275\231\225:\001\325\273\330\222\330D\355\0301\367\335\341\255Q\217gO\273\354\0022,\300\327U\242\007<!d\221"
+	.string	"G\275\337`~Q\323\331\0010\251h0\204\305\264rp3\351T\031\241"
+	.ascii	"k\020\177\354\342~/@WV'\205^wf%\322+\345\361\\\222i\226AH\224"
+	.ascii	"\024\373\210\327\333\374i\027&\357\265\271(\331\367\211\202\243"
+	.ascii	"\263<\341\314!\3721\245\322\3247J\037"
+	.text
+	.section	.gnu.lto_.pureconst.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\200\004\002\265\004\005\205\004\006\265\004\n\225\004\f\205"
+	.ascii	"\004\r\271\004\017\271\004\023\225\004\024\231\004\025\231\004"
+	.ascii	"\026\230\004\027\200\004\030\271\004\033\231\004\034\204\004"
+	.ascii	"\035\231\004\036\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\220\001\225\t"
+	.string	"\302\314'+\220)\031\0160\220\255\336\016\220\201\225\372\325\027[z\237\363E\020}\200\210\372#\333\2325\311\354#\264\260\337v\023d\267M\266\224)O\220iA\002aO\221)\"I`\037\275+D\203\245@M(+\204.\202\037:\214\230\254\226\026\225\245\322\346\361\277\247\316t\355\343\300\345\323\331\250\035\245@\335\243]q\003"
+	.string	"\216\312\243\276\312h\020B\342=LP84P\376\203N\246\234\351t\024{]0\214tkm\336][{\222;\332\365\326S\253l\312\235\324\t\225CU?{\354\n\274q\3732\004C\250Q\301cc\265\244\220\3450\002\203P\035\037\0210\275S\324M\2410\354\006\264)\2162\242\305\f\277r\201.\005\332\275\f\375+:\220P\372\022\005U\356\212\034\222\304O\221\032\t\256\024:\346pi\325\320\312$\314\350\345\373\321\232)\201\t\240\255\263\376`\3719\222>w\303\237]h\t\357C\275\210"
+	.ascii	"\346\033@\333\270[\036\365`\325\321_\220\bI\030q\250\202\305"
+	.ascii	">&\214:}\007\036K+\023\217b\nD\233\334r\203\274\247\215\324\r"
+	.ascii	",\367\f"
+	.text
+	.section	.gnu.lto_.lto.a791dba7baabc764,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.15.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375 \377\245\006"
+	.string	"\004\013\240"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\350\303\001\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\317\036\361\370\260?\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\362\371\260\275\024\370\300=\320\342\336\007\360\362\364\007"
+	.string	"\203\003\202\340\367G\244\003\001\200\300\013/root/repo"
+	.string	"\"./src/main/config_eeprom.c"
+	.string	"\016"
+	.ascii	"\252\244\233\261\030\302\0319\276\007\306\201a*\347@\023+8XZ"
+	.ascii	"\252\013\376\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_alignToWrite.16.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\035\013"
+	.string	"\306\325M> Q\224\016\260\203\0054\355\225\017\264\212.Qc\022\347\220\036P\372\r$\026\270\225\303\034\264\217;\356\214\322\0333R\305\261\005@\226"
+	.string	"W!I=\0021x~\215\251\016Z;{o)S\n9"
+	.string	"9"
+	.string	";"
+	.string	"\207\266\375\021'\361\261f\2003\221\250\030!\243\024 \273\\e\356\005\342a\344\222x\250\036\256=5\377%\376@L\037[\007\350\t\340\301\356:\267\016\322\255\267M\261\r\301\276\203\346@\251\035\354\277\325\222\355t\274\307\017_\372iZ5\235\231~$"
+	.string	"\t\306\201n\027Cwc_\300\026 l\177l\312&p\2628\357\241}\300n\211\006\213].\201\025D\002\252O'5F\031\364v\021SU'+D\032\256\251\3574\n\teg\037EF\231\261\033\372\346\233\370\t\n\376\207C{\262\374v\350g\361\020\352\365\235D\"8\2623\305a\323\206\003n\220\261\\\030,\270X\225I\347\306T6\027\326\261\254\b\0234\031\316\205\2518\032\t\233\n\203y\252\n\002_\035\013\253*\\\027VQ\334\376\255\226\242Z\330\020R\016?\365Ud\002L\037QU\206(\304\205Kb\017"
+	.ascii	"6\373W%\235\214\351 2L\201\332\205\342bA\312LNh\356\027_\255"
+	.ascii	"\343\302\b\"\263\235\007;\205\237\031M\355|\002"
+	.text
+	.section	.gnu.lto_searchRecordIndex.18.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`R\004\305\035"
+	.string	"\026\367\274G\240\232Qc\304\023\037ph}\227\001\201\277\351\372;\225b\370\217\355\frw'B\243;z\226\034@\032\242\315\3668\250\007w\005\217\325\342\344d\030\343\345ha\372\30536<\210#\037\322 \362\240\315\273m\271\245L)\252"
+	.string	"\237"
+	.string	"\252"
+	.string	"Jn4l\306\242\350#\255'\273=a\215\037\030\314\333Y\322\316\211>\232CH\346\022\241\215/\367\336\234[_0gC;\224\332\177:\222\335\207*l\357U\232jr\357p\201\031\230\2672z#?\262\263\217\344\220\007\320UD\343\3108\346\336[\243]@yK\036\247\274\255;\\\332\326\335]\245%\315Jw~\204\036b|\300\241\273j\200GF\"Z\312\270\365\001\211qR\006D\306Mr\202S\323\322\265\220\222\310J\204\202r\251\323\037\260G\353\215'\205,\211\361\001c\234\272(\334{M}\300\0277\200\333\326a\233\307&+\004?9z_\256\274}\215uI\342\321-\323\223H\216\003%\036-cz\016\321\272\264\214=$\242Uh\277"
+	.string	"\f\247!\256A{\206\343\242\016PR\337\310l>\374k,5\315\243\356\030\354U\276x[KM\236xWJM-\365\005\274\254`I"
+	.ascii	"\345^\027[f\356\025{\345\343Q?\361/\276"
+	.string	"\332\367\241^e\303,\364\323\247\252WN\232\356\275\260\333)&PE4fIv(\375\224\320\231\370x$sJ\321o\301\255;\350\330\361\227\370R\263`\024\212sK\216\f\346\255\017%d\303no\357\374U\350\277J\335\b>1k\3205\225\254:%Uz\224\214m\r\317\342`\336\333{\340W\331\340\301d*Q\336\222\325@\227'\036\335z\213\323\352\312M}\325\247\330\020p\271\227w\237\037\345R>\360\330l\345m\200\372-FAh\352M\317\237\2140\357\275\021|'?\336|\246[\373\340p\345-M\275q\351\212W\365\327YC\353R\3759|3\262L\235\306;\255b\365Q\247\335\307\222\326X\245YFE\312j+\2555\214\021\016\"\272\345K\375+N$5\213\027\242T5=\235^\365\304\323^_\365Gg\374&\267\032\34139)n!\200p6\004\356\247\242\310\221\250\"|p\"HK\350q"
+	.string	"\002B\003\0207\235\001@>A\3256\235\237\234.\350v\373\340\203\353\001\312\331j@8\236\237\232Mg\242\246s\300\271\240\233\256v\"\227\323\325`\346\235,m\305\301\251\022\224x\225\3107\376uf5\271\314X\265\265\251e\375\331\264\325\244\205Uk\341\306\037\206\317\311\326\027Kz\362\336{K\222\254U\364Um\352/x\304A\312\352\2157\265`=\321\234\303\352\317\017\264\250\364\260U\b\200\t\353L\215\325Y\375\231\254e\255\365g\313\352\213\247)\370\254\312*\245\2529\261\bT\335"
+	.string	"C\006W\250A0\345\2201\316\020\231\t\204FJ\333j@\002b\020t\346\001\020p8\244Ik\030\201k\202\253\267\034\006;\021N\375/\221\305\0012\366\305\212\001\023"
+	.ascii	"(B\346\360\016j@\351\306Z\200$\033\300\254\222i\217\304\204l"
+	.ascii	"T!#\f\323\250\315\033*\342z\3150\334\021\315`o\024\234_\317["
+	.ascii	"\375T\344\312\251f7\033\n\343\310\362\254j|\032=W\371\251\237"
+	.ascii	"\300>\240\035\001\341,l\021!\252)\003\\\344Y[\004\211\306\030"
+	.ascii	"\232hz\305\003\347QEV\276\301 Ms\256\017\270\017\206c\347\177"
+	.ascii	"\2626b\204\310\001\363\343KZ\204S\177\t$\240|9\002m\345{\002"
+	.ascii	"\341M\264\245\225\260\232\232\216R\003"
+	.text
+	.section	.gnu.lto_addToRecordIndex.19.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`=\001u\016"
+	.string	"\246\334eE"
+	.string	"\223\223\016\263EyBj\261\343`\030\354 \025c\3516C\370{\374\273\026Q~M\206\367cd[\263\250MxH\271t\002\302\"E\251\246\347K\377!\377\224FZy\357\0018\254\003\207@\036nB\366\336;\245P"
+	.string	"U"
+	.string	"K"
+	.string	"\003vW<f\354V\005^@?]_\340\372\244\367\\\237\366\354\036\257'\026\203Y\221\372nv7\213&\356]F\350\371\001T\245K:\342Q\"X\221\300\021\240:\311\021\0345\251\177\207\037T(\b\261\320\356\032\266\250B\334\363\266#\3306\261/\"W\204\226\023\372"
+	.string	"L\\n~\220\344\330\005\321\022\2625\223\206\n\333\267\037\303\353xl@\366?\377\305e\274\303\340@K.t\306\206\306\307\356\222|\232\002\375\034\221\236\033\240\b\357\302%\r\274\327\016\257\007^j\214\r\t\364\323#\003t\370\026~\314Yxg\261<\026\271h\374w\252Cf\007\n\3468^\344z\244\3210\365r\202-\333\334i4\320]\224\003\177\246#\321\335}\212O\237\345\372|$\200\202e\202-\377\373\204\032\025\007\310\302 v=\301\bc_\356\356:\256\354\tM_\177\354\254?$n\0247\355$\303h\3530CHa\200\362\240\004e\373\030\260\320q\332\326]\326>\"\256\033m[\205\013*)+\234\226\255\250\234\2102\255#e\237\004\346F[\227m\340\270.\353T\323C\246x\222\035(\343\025m\f\"\370\026\377{\310C,\031\213r\210\t\266\236S\242E\023\003\024"
+	.ascii	"v\366\240Jf\231\266\301\310\316\002$\021(c\366FU\217\252V\006"
+	.ascii	")4\342\252\214\t\007p\231X\226x\2707\024\222\305P\r\212\023\327"
+	.ascii	"\324\3254\006\005\005"
+	.text
+	.section	.gnu.lto_isDeltaBlockValid.20.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\306\005\325#"
+	.string	"ZAT\016I\220\232Q:$\2400oL\244C\001\\M\247UD\300P\371R\253b\263l&g\224\fV\257\362P\227\371\370+&\336\270\203\255\2769\306\323\252\237hv;\026\246/_\3515?\217\340\275\006\326\263\377m\237\020\262\211\334I\006\325"
+	.string	"\302"
+	.string	"\317"
+	.string	"\345\255\201\274F\017N\310\247\003\267\314\001M\223zJ\344\235\020\375\311\n\266\367\356\370\272\200\336\336jZ\324S+\363\237\336\204\350P,\256s\357Q\213\312\275H\004\254"
+	.ascii	"\275e\344q\346-\372\324\274]\300\200\210\201G\002!\236.\310 "
+	.ascii	"Ais/R\327?\230V\201\257\321l3Y\f=M[v\005\362\213^\343*\352\240"
+	.ascii	":\201#\305\033\225&4\346\270miVF\3002\203x\256\"\216\262\n\361"
+	.ascii	"B\363*Y\003\247(O_=\2149\036\343*\332@\037\324\361\263\304\021"
+	.ascii	"\207\f\317U\254Q\0328S\205\215iS\022\226<\367^\353\242<\232)"
+	.ascii	"!\325.\r,e\311\260)\031\225\270/>\310\234\3525I\t\251\326S\302"
+	.ascii	"\275\227\353P\311x\3169\363\0030\263\217\3312\bi\363\251\364"
+	.ascii	"hb\356\r~\310\277:\026\217\337t\313"
+	.string	"$z\365\303[~\317\274}W8\302%F5\214\353\0245\\i?\312\257\264#X\301\370T\327\240\265\365\225\346V0fdQm&\346\227\267\217\314;\227:\347\376\344\307\035\352O\271\262\316\243\316\267Z9GV\331\206V\256\311*\323d\225ghe\031Z9\026\253\214\242\225O\264\262\211V\266g\345F+\327\263\362\005\f8.\345`*\323]\310K\f{s\267\254\025\"\217\372\245\236*\351\341K\341W\361,]2e\250\205\023\225\036z{f\">\224O\235\212g\351\214(*^\034r\346\251\315\216\207\324\355\036M\021\213x@o\323\246\036\346(\026\001\375(\363\251\231\366\316\225\221\\_\352<\301\n\306\264N;\327\025\2140I\213\247\346\254imZ\t\227d=\373\"k\004A\240\316\320\214I\2221\b\304\2570c\375\223\034\223\253h\247\335aa\347,&s\206\r\365\303X\363\b\273\210k\243}+"
+	.ascii	"hv\354\034\275\204\350\337`a\226t\235g\233\347\362\254\025\374"
+	.ascii	"&\356\360\241~\370\301\274={\200W\r\020\337b~1UU\026+\263\231"
+	.ascii	"\030\327\266\203\222c8\304\265\330\266\3068\217aC\b\016{\336"
+	.ascii	"\307\254\235+s/FM\256\312\356wP2\253v\367\221\342\360\210c\361"
+	.ascii	"A\357=j\300\277\342a\207\336{\337\244\242\255\021\216\023T\260"
+	.ascii	"\206\325*k\276\360\350fb{\3162\337?I\255\243\352\206\003@?\337"
+	.ascii	"\216\3673}R\224\340\001Y !\nC@?\337\216\367\223\375\316\333\t"
+	.ascii	"\361T\240\340\r\241\374 \250\347\307\301\202\037^\002\001'\316"
+	.ascii	"\273\004&|\277\023<\336\b\022\275 !\337N'\324\3631\241\333\375"
+	.ascii	"\206t\t\n\260\357\004\357\247K\341\363\375t3\344}\037\331\354"
+	.ascii	"\0022\205E\373\201\346\251n\001L\234)\254\223\0174u:\211\231"
+	.ascii	"u\232%\004\333\250\326L\025\272\226\220\260l9\375\"j`\304v\372"
+	.ascii	"\326I\267\236\220uT\335\234\b\003\211\204`\032/[Z\264f\342\237"
+	.ascii	"\303X5\341\260\365\221s\235\3235M\262\213\255o\235\323\246U\255"
+	.ascii	"m}\236\307 \217[3\037\263\326\277\244\326\205\207\001#\002\303"
+	.ascii	"\220y[k\234\027\024\355\212\311\255?\345\300\252\377\305\225"
+	.ascii	"\022.6#E#JV\257\220\354\004j\250A0$\221bJ\225\004\"\022\264\005"
+	.ascii	"I:\220\002\221)\264\r\02101v\252j*sf>R\237\264V\240\022\234\253"
+	.ascii	"\220\256\241\201\022\203\024\262\323\333\315\030\224\242\356"
+	.ascii	"\272=I\206\n=\017\202\214t\332-\267\321A\251\037e*\340\215\344"
+	.ascii	"2\025\314\220\353\024\005\017\007\260\346!Mc\330\2354\256\021"
+	.ascii	"\r\001\262\343\350\246{\017\221o\200\213\203\276\303\320!>K\277"
+	.ascii	"V])B1c\tA\213\3024\331U\240a\226\027JLs\026\307\331`\202G{\274"
+	.ascii	"<>\002=\255^s\367\223u\344D]\253\306\347  \307\376\261\22323"
+	.ascii	"!\027(F\bd\226\325\233\316\314\2057\302\221\357\200\217\376\200"
+	.ascii	"\026\n\004\354\\A/\214L2\247C\346V\017]\n\023\224\361\311\267"
+	.ascii	"\320\360\226\233W\276\245\265A\027\210U\311F\r"
+	.text
+	.section	.gnu.lto_isEEPROMContentValid.21.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\221\016\265I"
+	.ascii	"\032z\020\033>@\344\316\030\373\033\304\212B!Q\025v:\006\357"
+	.ascii	"\032\224\004\"\"\210\241ltM\n\316\3042\321\377\371*?H#\001w\200"
+	.ascii	"\013%F\353\f62|9\006\340\226&b\202\206\020\221;\245\224\002\243"
+	.ascii	"\001\215\001\235\001D\311\326\031\311tn;\257\231]:\037\225\316"
+	.ascii	"O\344\354D\316\rBA\0305'T\260|`\335K\326x\350\325\303V\265\364"
+	.string	"_7_\367]w^\037\231\333\tx\201\273\312\r\310K\347\233\277.2\2700\375E\246\257\335\360\262Y\347\234\037\027\022\"X\b\201\344\361u\345\330#\234C\314Q\345\002\367\0367\033^:\265\254\321!\244\214\236\032\311f\2359\b\267\231>\323i\032\257\365x\211D(\257kl\232eF\262Y\244Cjx\364\030\2038\207\bc\212\246\355\202\364\235WS\264\356-\3030\207\330\"\331\354\221;\317\352~\364+-#:\"8\204\020E\262Y\247\332\205\236\3532A\232\016\310\361eR\367\236\255\310\0034\327\240Y\206\220l\226\353z\251m6\331Im\263,5!\b\273]\367F\326T\256L\323 \276o]\324Sa#Fb\344\321\355$'\322\221Q\263\210\271T\022%\221-{|w\271\277:\211\215 +\355\254\242\367\304\221\340\372\350\210\024#\313\322\326\262\267#\205D\302j\003\252\271\321s\312\331Z7\221\032"
+	.string	"\373\n.La\333\331Z\027M\355\351\231\273\266\235\3015\363\330d-s\262Djx\3423h\027\270\027\267\244\225M\210\254eh\311c\025\240\022\262f\323Ok\031\223\243[\021,l\275~r)Ks\344\222n\217LR\326\256M3\351\261\251\216\236\351\322\f\314Y\261cG\255\3647\315\302\216M\357\373\266^\373\230\031\230;R\303\373\276\354T\263\263f\245fn1f\036\302\\\344#_XH\265>\215\376\272`d\363\240Q_\227\250\357\273\266\241\370^\t\0238\262]0-\367!E\027\374\246ev\305\270d\274\251QO\345}q\326oll\257\266\357\272J\351J\310\200M\016b\333\240\377\351ls\235\266\367\372\3205\223|_iS7$\245\r\266\200\220\225\027\266a\007\036l\233e\366"
+	.string	"\302\233\372\037\201M\372_\254t\335\302U,h\356X\272&\321z\210\036\024T\202\231\324\330\374\372\266\224:bC\216\357\326\216\206\f\225\317\277\033\2575\211\266?\206]\2400Od\346\021-H\"\371\276aS\334\201\r\250\0043=)\364Rx\022Fm\356}\243<\336H\220\316\357j\370\346i?&\f"
+	.string	"2d\365j\271\367\264\325\013E\212\024J\206\330\256\206n\313}\247\361\270\334WX\005\013\026m\263\001\336\nE\275\221\235\217P\035,$X\2340tZM{9_\036k\313\3012\360\366\276\321\246r\303\3518.\270\2574\313/\260\274\251Xm\263\235\327*\330\242\256\310\255\327'\016\365\\\r_Wd\256\373\362wcn\327\373B5\343\227\302\374\341\212C\3635[UY\250@5%A*\212\235\023\364_3\324\223\323s\351\334\324tfbg\004J\347\003Kg\003K\347\002\2553\001\246\363\200\245\263\200\245s\200\2453"
+	.string	"\246\363\322\322Y\211\351\234\304tv.\235\221\226\316GJg#\245s\223\351\\\264tf*\235\227E\316\312\276k\016\325;N\337~\335hlQ7\335E\252u\254\024\336\022\t\213\336\255:\207]\315\327\272\320\3344o\252\233\3266\253\004\307\344M\025\004\267\360\314\356\232\013\305\233Z\365\021\330\302\252\177\315\247\323\242\244\360%@\205\334X\217\236{\217\243y\271n)\006\251\206\354Kv\270q\336@\332f\217\276\027\307\232D\275\021\005\022\302k\233\330\250\205\211|z\242\037\343#\362\371\354\217Y k\257\266\202W\275X8vR\313\276\205\265\ngM\365F\025\246\336\350\t]\263\250\246Y\251\372L\263O\365UR9\260$S\336.\230\226\375\346\024\3217\277\357L\031\275\212\204\375\256k/\263\027\261\350\220\021\317\362\204\342\226\253\241\204\357\274\242\177\276\204\357;R9\260/\372.c>"
+	.ascii	"8:\327\017\321\320\2017\350\3473\273p\256\225&\261\377bf\237"
+	.ascii	"!\251&\345?\177\371R\337\364\364\313\357)cT\371\2758e<\264R\265"
+	.ascii	"\321h|\001\311\360\262(\337\215\331\003kZ\354\356\204y\342\036"
+	.ascii	"13G\210|\f\013\n\220S]\260\213\005\313\037j\227\247\375\347#"
+	.ascii	"\277\027\245r`\336\310\307o\337\027\247\214Z\213\203\306@\331"
+	.ascii	"K\276\233\207\300\304i\237Rj\201\234)^\033\365O?\326l\372*pq"
+	.ascii	"\332\247\224\360\255\327\316\266\367|\310\364\371c\314\034\327"
+	.ascii	"\036\037j'\350j\36107\316\301\3349\267KRG\333\354\361\227\230"
+	.ascii	"}e\326\264\313\026e\323]\244O\214\365U\366\201y~\347\265\273"
+	.ascii	"\"?\275\206\250\037\332\302\366\206\334\363,\342\004\b\023,\264"
+	.ascii	"\261v\330\330\322b\265pt\350RjA\271\262\266\240m\216\206n"
+	.string	"iam\321h\263\240Y\017\335\332\301\305%\243\345\n2\"\304\240\222\212\261\365`@\026\324Jk\013\312\265\243\213\210\263\036\334\340\202\346\330\332z1\243\206\f\034\\YQ8j`\335\210\312\202vE=pb\256\034[\320\250\035\\\\\320\250e\335\333/\205[\3016x}N\237\353\326k\017\201tx}\337y:A\202\367\007;K:\"9}r\t\315\257\235\214\212?\264&1cL\337\364~8e\004\203\205\340\315\277$\237\351\377\215\364\013\330_\222\244\234\0217\255\t\247\3743\263:\337\315\003\034\335\264\357\350\352\267\222\2501\253\336\351\307\230\031\301[\005\242\340\007\336\311\314E\342ME\360\006\376\300\267\237)c\264J\027x\003q\005>J\220I\2620I\335\3250/C\224\3045\244+\002W\337\024\366_<\340\235\236\300\367\240TN\300\017\310\"\340\023\b.Z\003\374\225\246\032\266W\013\340\003|K\325\340"
+	.string	"|"
+	.ascii	"8&QoL\372Y\342w5<z7\206\220\330\374\360H:E\034\036\312\352\241"
+	.ascii	"\336\312N\230'\262y\332\240\276\377\372\370\276\357k\364a\351"
+	.ascii	"\241\376\303\013X\224\312)\375\022\225/n\027\245\357?\202tQ\274"
+	.ascii	"j\241\325AC5\253\207\326\fFg\204\376\361\342\210\23559|\377\265"
+	.ascii	"\235\324:=\207\377A\251\034\030`\037\313\2641\253\205V\337|I"
+	.ascii	"\357\364V\377i\244rB:\251u~\322\267\203R5\244w~'\3616(\356\030"
+	.ascii	"w\tW\333,\322G\301\321E\003\201:\250A,(\031S\206dDD\222$Ic1\005"
+	.ascii	"\304 \007\251\344\r\021@\251U\250\210$I%\035\026+\177\227>\251"
+	.ascii	"@\214\325f\314\022\336\034\023\325\025\253&uXouZ\206g\230\312"
+	.ascii	"m;%q/u\036\032\272\275\007\313a\324\177\007\207u:\027\267\033"
+	.ascii	"|F\224\244j&\003*\237_\264\242\312\245\327?\306\254N\353\261"
+	.ascii	"T\035\020\025\242\221\324`\007\032X\3455\001X\036\342\036+\301"
+	.ascii	"\202\036\256g\341\312\373\236\0334\036\276\006\251%0\312\324"
+	.ascii	"\322\205A\205\265F\302W\262\322\332\374f\220Z\3257,3\036\213"
+	.ascii	"\232\311\231\243\213\316YN\203\321\321\3422\205\204\34733\017"
+	.ascii	"\237\335\361\275\310W)1\267\245\204\0164\035\341\356>(C\311_"
+	.ascii	"\371qe\270E\314\345&f\360\224\334P\313Am1:\033A\307>\317\034"
+	.ascii	"\037pB\313A\0017\236\212\001\250C}OA\367;\002\377\362\007\037"
+	.ascii	"D\242R\352"
+	.string	"\334\020}\330_c\237\313\023\256\35769\266w\313\253\275\366\324\256\341=MA\2010\017sy\345hA\352$fF\204\355h}\330\026\f\260\315 <6\034|D\336\0276\226\035\030\202\250\325E\340\327\013"
+	.string	"}O"
+	.ascii	"D\341\310q\255f\003\311F\255\035`\271\206:)\360\016\232\314m"
+	.ascii	"\222q\035=\f\345OF<+\345\230\375Zwj\216\333\312\374\310\245\215"
+	.ascii	"\230\354#`\013\341\366\022j\205i\254\242L\357\203\323\023\221"
+	.ascii	"\023\272f\004\f;\352%&=\210\3027\202\302\3426\231\204\032\001"
+	.ascii	"\271\324\200@\217\213\001\030\260$J\235\346XoG\256\375,,\027"
+	.ascii	"\256q\213ki\"\324\372\201\302C\r\356a\372\221p=\032n\350\302"
+	.ascii	"\263\332?\271 \205\235\027=\246\231\016\212\215\"R\331\352\254"
+	.ascii	"(\031\030s\006\006H\237#/-|\236\354\243\367\372Lz\204\t\340<"
+	.ascii	"S\264\242)\346\267\f\"I\316\2238\274\331 \b\350 bq\346\256\001"
+	.ascii	"\022\3044P9\360\n\247\310\033\375!4h- \b\361FC\364\2370\313\375"
+	.ascii	"\016\311\307\215\271\200\336\277\361\225K\351\276\256\026\302"
+	.ascii	"2\222K\215\024\233\307\346l\020\221\223\021\r\177R\372\321l\033"
+	.ascii	"b$\035<O\205^\235O\256\001\2404G\026}<&\363\307\372\364<\357"
+	.ascii	"\2238W\364\332\261;g]\337Di\314\237\246F\022\364eK85"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.22.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"r\r14Po\322\001\200\276\252\025\241R\200P\377y\347O\205D\207r\232\352\034\212[C\255{t\215-\267~\002\201\030\"\\U\030\255\020Fq\334\232\313\222M\244L)\2664\234\007=\327\225\300\260Y\350<\313u6\n\034g\301\006\247!\360\363\\\3209\274\007]\025\367\323*)u@\244\020\366G\0361\237\303\017\237|\366\346\177\024`\243B\224%W\027\233.v\f\245b\330\237vw\255$\333\351\324\214\007\013\302\311\256D\351eW\032J\207m\220]\371 \017\001\031\313\2501A\225\250D\220\264\354F\027p\001\352-\237\241\3364\343\330\023\363/\362\351\303$%\033\205\236\230\203\335uf#\212[o\273\300\266\201m\213\t"
+	.ascii	"\252\244\2231Mz\303\267a\343\032,\270kH\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_recordMatches.23.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\222\002\r\025"
+	.string	"Fh\215J\300\322Q:\242\212\020\360\2070\212H\3146\246\312@\355\022\342\371!\016\343X\fvN\344;n\213\205\321\3715<\376\f\305\244\315\2152\033\204m%\b\202U\020\004\030\354\252\346M\264AY\022\177\342\"\220\200\325H#\204\310\235Rx"
+	.string	"t"
+	.string	"x"
+	.string	"\255=cLFj.\bD\204\361\241\nE\213R\373>\377\261\035H\346\252ZyKG\265\236\b\234`|\350\363%\342\303\361$\342C\333VY`\363\314\317\0217(\032$\235\357\251\326\223\265\">\363\020\\:\343\337\3670\307\350W\263\313\360\260\303Ar\247\201.h@g\006\007\221]\016,Q\342\261q\337\251\315\016G)\352A\255\325\264f\207s\213\267=\3016\215MC\004<[\244\01615\211\242\006y\357O\035\350\037Ej\324\317_LQ\203#\365\242\250\251H}"
+	.string	"$GJ\020t\324z\363\363Q\223B\030'|\241\027\325\336\302'\002\231d\324Z\311\017\2015\347\2548-\243%\237\224\207%+ZK?T;+\316\217\230t\036\236\036\372B5\233|x\333f\223\266\212\250\005\262x\220\355=\f\340H\315\361\030I\030\037\242\200\252\237?\366\003D\272 k\372\030+tY\277\211\032\235\244\335\036\207\354\227\246\b\252\221\243<l\273\376\342H\366\032k\2552\342\303\357\311\357\373x\343C\323\216\246\223\337K\021\265!k\342\244\313\301\031v\243\330Xk\216\201\357\302\264\340\227\210\021\037\242\366=\022@7\372\363\213\036\"\355\234\350)%\032\033T\344\020\367CG\271\321\036&w*\355a\2378\272=\366\367\367\373\375\274\001\256\260\242\325f&l\305,aJ\027\227\351\242\025\220\315b0\256W\254%\366\362\342\272\360\022\201\225\346\332A\213\002\226\006*,\345J"
+	.string	"\005s\366*M\321\257\225\313\314\244\225\345\n,\326\"\233\275X\262\230\313\205\3652_X+\002\236\321J\223\0053\233\231,\362\274\035\254\3133\005SN\367\300\301\265\261M.\312mq\006\227\334\213`\255\265\206\333\003no)\207\003\\^j\027dw\357{"
+	.string	"'], P\0021J\355\305j\363\234\215\036\224\231\231\355%\224eN\213\226{\27281\300\312\343\004*\376\201DY#\350s\244\257\255-\007+4\275\255\200\266\334"
+	.ascii	"\355\"\033\226\222\226\240\275\270\200\220\007\203}\274\211\177"
+	.ascii	"h\342\361\225\276\030@!\242\003\275\373\265\303n\033o\277\343"
+	.ascii	"\250\307\234\267\f\315\2230\007\311\245\267\205\253:\360\036"
+	.text
+	.section	.gnu.lto_scanEEPROM.24.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`u\b\2450"
+	.ascii	"\252T\270\022F`\034V\007_7\233\235\025\212\360\302\341\320\202"
+	.ascii	"\240\027`\377\3533*%x~\214\005\262[\036\321\313\333X\016oc#\270"
+	.ascii	"\250ob.\325\216\203\022BM\366n\357\305krz\240~\362\037\357\373"
+	.ascii	"\276\375\275\367\336I\246\024\033\001\f\001\033\001\315!oG4D"
+	.ascii	"\355d\355e\315\013\266\301R\343\254M\322\353,\356\246\321~\305"
+	.ascii	"\245\315\013f\031\203\202\241\305\216\212\327\331\340\027\242"
+	.ascii	"n\261\2475[E\363\263\304\031\332W\002g\033E\260\n\321G\275\n"
+	.ascii	"\r\267\"c\r\346%\227\227\207\327\331\342\032|B\204\261\203\315"
+	.ascii	"pa\316D\344\320r\216*h\006\257\263.\305\277h4\024\200h\327\023"
+	.ascii	"\210\305\215y\305N\316\321\241\216:\261u\366\365a\353\354\033"
+	.ascii	"\351^\377\372W(\007\376|=\336N\367\272\301\226]\037C\265\027"
+	.ascii	"\205\221N9\243\034\230%\265\302\277\"O,\367\255\356\r*/\247V"
+	.ascii	"\rY\213\252oj\256\346\004\230T\001\301=\367B\221\347\225\363"
+	.ascii	"\bl=\205\370\216Z%d-2\251\n\202uj\256\001I\226\234\255\347\225"
+	.ascii	"\277.u\026\211\0209[O,w\203Kvx\220Z\325\305s2q+\305\336X\327"
+	.ascii	"\nXbxx\231c\035\316\345\352g\270\336\270\324q\323\311\304\277"
+	.ascii	"s\356p\354^\31097\236r>\275\205\336\355\037\272\033\252\333\005"
+	.ascii	"\022\335G>\306\370\346\274|\320\276\245\204\322\233s\366'\262"
+	.ascii	"\201)\361\\\367\326\344\2608\224\226\262\314_5Yhqp.\365\335Z"
+	.ascii	"\334\360/(\273J\\\333\327?\224\314\303\034\235\344\354|q0\356"
+	.ascii	"R.J\316J\327\333\r\210\327\352P\273\034\177\272rV\372T;\027\237"
+	.ascii	".\265'q\266Y\034\261O9\333~l\235u17\221\245\345P\255\217\371"
+	.ascii	"\223\226\022\337i\342\220\2678\270\214\357tG\243\360C\273\275"
+	.ascii	"\255\316)\351'\322]\024\nr3o\240\037\267\342>\300\301\334\005"
+	.ascii	"x\2327\321\307\305\274\207=\302 p\305\375[q\373\\\334\275\026"
+	.ascii	"7\357\305\275sq\353\\\334o\213\333}q\267\354\212{uq\277\217y"
+	.ascii	"\343\026\267\023P\220\006\353\352\b\234g\023\315Tsx\262\031V"
+	.ascii	"M\211\247\271\233\271\213\271\217\371\332\355B\035D\355h\355"
+	.ascii	"j\315\023R\245Q!\311\2521'\213\2375\317\331 \035-/v4\257\336"
+	.ascii	"b\274\316\n\225fO\236\245\252t:\002 ~\3235\252\205-\037i\324"
+	.ascii	"\227v\271\341\324\005\275\247\265>l}>\350\337\315\325|\235\262"
+	.ascii	"\325\233R\001z7\323\275\317\003\375_\221rR\303\207\355\373\272"
+	.ascii	"o\335\244\260\334\177\337\231y\272A\270\333\233\021\"^\264\316"
+	.ascii	"\272?td*\305\347]\213"
+	.string	";\2203\177\3254\211\306\301\025uU\337\336\2076f\245\336\341}\315\275\3147\264\341`\236\265\303\377\261\305a\236\255\276\346\300\237w1/*\331\334\315S{\222&a\302D\353\354\317\377\216X)\361\334\024\n\360}\314u\ty\336\344\b>\021d\333~2\314M\017\036\360\002~\370\335'R`\237j\177\202\226\324Guo\372\203\na\313\347\243\0075\343;\024\266xM\333\2076\013\224\204+l\314\022W+(\2413\305>\264\323\034\017\2401:\342\365a\204\225\371\037\376\372\230\213\224\023\033x\256\375\377\235\316\346\230y\224x.\352\364b\265>TC\033\025\363,\270\276K\275\007;\231\2371Sd\244\r\326\327\360\233\335\306\326?\031\306\266\304\325\016I7rjaDb\221\23024\355\220\222\310#c\262Ebz\201Lb]8\023r\311\311\350h)i\251\251\311\250\305\321\257#$9X\001\241\301\n\343\202"
+	.string	"J\306\344\367\321\202#2\351\302hL\241\264\224\304\204<\032bZ2:\016\035%\233\206\026\024h\244\013cr\310\t\211L\016\361\242\331\327_\317\263\337\374\bZ\312\267!\207\232\201\017\235\363\204\214O\350]\352\006\312\334\237\367\371f\373\360\367\352\002\277\307\347\177\217\201\314\022W\347p\370\275\316\261|@\351\301\026\270\252Y\277\265'|,\024"
+	.string	"\373\276\333\303\007\354SB_\\~T\277\357\363\276w7\3071\rC\365=\264\031Ty\305w5G"
+	.string	"\346\rz\3427\233\027\374^\337\236\027~\023\350\211\217A\314\022W\035\312\224\212\020\343;i\276\346\234s\357\241\272)O\274v\304\357U'\374`\261\367\304/>"
+	.string	"9)'\274\357\301m\t\241\304{_\303\006\246\024J\247T\202\230GL\241\245\234rq4mV\310v\017u6\276{\337\"\356>\200\260\2501$\006\225CJ\231\221\221@DA\334\214\001\200\002\231\241\272n\020H\307h\3234\006\321\013\025-Q\275\354X\256\346V\026H\013\023\271\371\226\233\355iE<\020\355\020\274\366x\330R\264#\002\212z\020\222SZ\206\344\2523\313\210\351\031\300\347\365\310g\312\215\t:\315\221#\025\r\020\320P\264\035\356\033\027\277\333\370=\f\344\255\003\265\013\304\260\200\2338\305\220\300&\202\337s\214;|^\342\036\332A\336\304#\013d\271\b\004m\362I\335\266\355\277\022\"\332\370\306"
+	.string	"!\304*\316u\274\r\020\346b\343cs\271\266\214\346\244\177\253\263\030\305\204>\221>\340\373\312\372\3353 \254HB\315\"\376\3111h\016\r!\353\367\212N`\026\262\363 Z\310\357\365\270\366\264,\335\005_&M\312g\264\377\365\244R\300\032I\301l_\330@\006?\342\360\375I\360\370\276\340|\260\005\323\220\263R%\2216\332\037CNZ@ \026.\023\r\001\022\312\004J"
+	.ascii	"\2412\335\233?`9\002i\246vl\203Xp\307\025rf\343\004\231\b\316"
+	.ascii	"\321\236Tp\337\\\037\213 s'^\b\240\367\373C(\370\254*K$\226\263"
+	.ascii	"\331h\216Q\214qI\265\2628\201_\374\377\310\013 \334<K\261\337"
+	.ascii	"x\rq2mq\233\3205\317\017"
+	.text
+	.section	.gnu.lto_findEEPROM.25.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\335\004\375!"
+	.string	"\346~\335K\220\026R:\200\317\270\3117V}\260i\030v\313Q\013\245\256\337\021\2560\216jv4\360\311l\252\227\336\251\345\267\177\032\353\024e\214Y\324'sd\020 \203"
+	.string	"\031\004\211\371\344\245\331%1&\257Z\361dje\255\344\023B\344N2\304"
+	.string	"\300"
+	.string	"\307"
+	.ascii	"<\353\323\235\n\037\337\007\277k\007\345c\346\002\261&9\255\315"
+	.ascii	"(@\236\367^\232\247\314\341[E\314\271\247\226\371\2109\307\274"
+	.ascii	"C\372zy\255\243\367\020\201\356\256\361\305\214\013\353S\036"
+	.ascii	"\032\323\305g\355\225F\227\271w\212K\330\275\313\032F\260>ef"
+	.ascii	">\326\263\216\030if\031\343)\306Ky\334J\273w\331\343\345\005"
+	.ascii	"\250O\327\003P\2376\214#"
+	.string	"\335\246\246h[$~\322m\266\033T\307\230\023\231\204\272\212.x\266\340\221K.\241\271&3-]\362hS4A3\t\006\203c\212\215\\\362hQ]\222D.i\264\335uk\"\271\204\362\356\275g\3362%\225\254\265\335\334{\331\"\223O\347\365\314|d\346\022\314\2502w\236W\264Z\370]\177\211\"'\314\354\2757\251Y\204jk\036&\232\321f\3413\237\341\352\252Y\271V\013\363R\3116\025\363\321\333S\314ly\307\226cV\313\272\3252\314\271\316/\253\345\034\3162\356\312\377\366\036\277\215-\2537\313\351j\031U-\367j\331\252\226/s,\251\264*:k\3676\255m\271e\251\020\032\347\372\231\317\007\273\230PX\016G\2234'z\243\226\367iD\222g\026\315S\0019|\326\336)t\245\321\314\362>=\214\312\261F\r\230\020s\356_E\377\301\367\272a9\323q\3043.orD\222gVZ"
+	.string	"-\237j\337,:\020&\202.o\362a1\214d\245\335{k\236r\253\025\222\372\024m\bh\312\346\216+)\265'\256\377u\263\234\003O\356-\036\311/\373\022\013\027rr\324\247\273\376\331\322\215\\\343zN\006\\\357\275\016\370J>\206!\203\006{\244\006\365i\256\277U%\344\353\270\346\n3\257\337\322\304j\250]i\236o\212G\233\212_\272\233\310$\263\335\375#G\002\344[\361\006\035{\244\216\372\324v"
+	.string	"\264\250\227\")\314^\372\\\347\311\3307\363\316\317\036\371\322<c'1L\277;\310\261K\321\256\375]\307I\271rR{\022X;P\3255L\317`9F)q\360D|\326{\215\f\370C>\b\371VF\352S]\337G\225\262h\327\370bO\307\\\334\260\337\226\220\231Xr\345\326\001\354\301&\b\304\220\350\263C\f\022\005\177~\304_\220\201\020\301\016@\302th\030\324@C!\321\017(\354\021\016\r\375>"
+	.string	"u\374\240G\001O\203\004<A\233\001>Ab3\320\346gH\f\n\006w|\204=@C`\017H\370\373\351\001\211C=\233\002<\f\n\022{D\303!\261\227[\026\217\336\236\302a:rt\2521\215\213\002\326\345L\317\244\002\223\327\321\211\356Zm&fV\233o\212\255\204\332x\326\326\267f\216 \301\036\031\323\017\244Ht\022\226\223\232\225\336!\243\n\211\332T\374\0375m\"\023\312\223\243\375L\300\301Q\237\246\255[av\317P\274`\2216\025\3034\332\326\006\023\215\357\344\337\202JQV\374]r\2725y)\237\367.ixE\246\360\263&\034*\004Y\250A\030\204\2244\206!'\032\031\231\n\332\214\001`\2421uv\003\020hGD)\265\006\354$Q\f\201\312\353\003\025\bC\245\rB\353\034\r\214\030\221\3235\211O\001\342\326q\004-\013\264\370%\250\370Z\030\205U\324"
+	.ascii	"\276*\031\252\314\033D\024Z\032o\326\031\361\244\247h\353o\366"
+	.ascii	"\353\n\222\264}}\271\314\235<\251\333N,\243\210\306\213r\022"
+	.ascii	"\3217\317/\212II\231\213\343\233\326\222\331\031\313\212\300"
+	.ascii	"p\033\362\326\003Q\021\364\264B(Z\t\261\311\t[x\0079\"H\020^"
+	.ascii	"\031b\220\003S2\026\301T`\036\262\305d\323\325\216\353D\267\354"
+	.ascii	"\367\234\241k[\203\370\314\361\320\205/\202\005R\241w\003&\312"
+	.ascii	"\360\353\374\003"
+	.text
+	.section	.gnu.lto_loadEEPROM.26.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\355\003\335\034"
+	.string	"v\366\275H\220\332M:\303\352\037V\032\235\244\013\353\343\350\253\305|C(\017\305\236\266g\"\030:K\272c\203\336\003\177\340}\211\375B~h|\333~n\367\346\251zg[\242\316bZ\263\346\260\016\261\302\245hm\033!d\023)\223\f\254"
+	.string	"\240"
+	.string	"\251"
+	.ascii	"V\277\032\272P\306X\233\316\3124\343\313\230*\006\247\353\300"
+	.ascii	"<\335\363\002\310S\3638\362\364\273C\273\266}\3203\264\276\237"
+	.ascii	"C\226^\304+\t\nY\255g\256\205,9\345\244\0256\345\244%\346\343"
+	.ascii	"\371\245\261\3575\232Y\222tl\366\355\211^\033\313\243%$\343\004"
+	.ascii	"\"\032\256\237GL\013\302\344t\323@y\037LM'G\234\223V\030N0il"
+	.ascii	"\0206\365\364\254\263R\020\211\351\213\234>\216\013\240\272\350"
+	.ascii	"\b\363\303\314\277p<q\217\013\320\\Yc\013\376F\001KH\200\247"
+	.ascii	":\337\b\0321\227>\265\326e`\220\351k\373\356n\355n\210\335\026"
+	.ascii	"\006c7\274\013\024\304\007v\373\242\214\232\350\001\330Pa\323"
+	.ascii	">\362\375\223E\346\307\304\335Cy\024\337\336\310\256\020\342"
+	.ascii	"\003O\367B}\023k*\342\342\236\352#\254p\264IS\271l\367$\342\226"
+	.ascii	"\332\275\205&FM\266\201\354\352\034\353\213[\336\233\233\311"
+	.ascii	"k\243\274\265\222\227V\362\232"
+	.string	"$oIy\311\221\227.o_\370\345\345\375\200\234\031T\217\"cZ\314Y\227\212f\025\f\345Jr\254_x\336}\316\227\236\375\223}\326\332r\274\260b\214\265\t@\375M\031S\362\301<\315\271\322\263\257\332\237k;\315\341\352y[!*\251\211v\237\205w\340.\207c\351pj\353\006\003\356\240u\255\177&\351,\247X,\022\357\2024\233\326\024\f\t\312\210\213[\266\331O\372\360-\020e#\020\273\242M6N\026\330\360lW\304\253\2140k\375E\330S)A\302\254\265\336\310)\355\033\031\324\221+\234.5|e\266F\214\214A\342\272w\353\362\372\252}\254\357\024q\331\342xo\202\274\365\356\t\024| \256\317#\352\250\211\366Y\177\215./_=\354:\n\322\226Z\346K\371\317' \366\246\320yH\262\004\252\252V\244\003\271\225v\302\020\342\330\370\341\273\037\272]\257\227\202\n\b?\022\036\374\354x\b"
+	.string	"\355z\275:\036!^\257\305n\207\002(H\005\013\236.\307\"(\205PN\327{\221\3439\260\274\026\273^\016\006\217\327\313\331\316\372\006\262d\231\263\241\025\332\251\256\241\f\231\241\225\376\3607\255\264\2737\275>Em\344\244\326R#\223'S\247w\034\271o\255\304Eg\356\265|\213\217j\\\237\225\216\324\221\247\267\306\320\345\307\304\f9|T.\333\333\372\024q\331\377\261\326Zi:}\241\202\343\310[\353\364\221\226\374\374m\200Ym\261\271\303\0270\354\374\204J\310\322\234\306\226\033D\312\002Lv\255m\255a\003\037\030B\250!\030\006)\207\f$F\211FFd\346\244\003@\002b\220T\327\001\020hW\333BaX\003\030r5s\252\231D\303\216\300E\222]\324\t\002)\325\261\253\271m\310\036\370\233\224\205\225*\277\276\327\347&\253\226\275\275%\235\026\272\270v\0372\330{e\214"
+	.ascii	"Y\016\252q\376\016\376G\\T\031\234\233'\272\224.oSq\205#%\377"
+	.ascii	"%\341\274\213\204\216J\375`\020\267\017Z\307\314\316\027!R\310"
+	.ascii	"RSrT\333e\201+;GF\265\005\267%R\225\316\335\212F\201\342<\006"
+	.ascii	"\254\243K\337i+\250\001"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.27.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`l\017\225M"
+	.string	"\212\201\274\034R0\022\322I\007\363\025\372c\262\021b\3531SR\002L\326\236w"
+	.ascii	"Y%\362\226\317<\275\330\366>\3337\375\0356P\201'N}wE\205W:\315"
+	.ascii	"C\205\201\2318\230\252\252:~7\220\004pE\356Y\211x\356\273\033"
+	.ascii	"\314\337}\271\352\337\244\021ir'\031\265\001\232\001\272\001"
+	.ascii	"hqsD\346\212N\270\310\025\231\203\327\302\034\344\033\277\302"
+	.ascii	"\317R\001Z\016bF\356\275\301\243X\212\344\202\260\271FA{,7\276"
+	.ascii	"d\302Q\336\034w\313\333*\362st\006\314\210O\205\037\367\246\016"
+	.ascii	"+S=WB\314~\250Ggd\200{\021T\257\262\244^\263\031\\6\234\207"
+	.string	"zT\201t&\313\210/\205\317\234I.\231\200]tA\302\324)7\230\203G}\314T\374#\367\341i\007\342L\316\366!\036\345o\034\224\t#\342mTwk\372Ez\035\321\251\340\245\036\265\267\207\314\311\237P\035\312\223z\315\216\270^p\336\353\205\202z\264\350w\326\004\207\026\033\r\316{\225\317:\262\026\325cEs\261\270\326\314\356\365\252\022\"\210\013A\365%S\352u\242nqQaR\217\322\33065nS\023R\305y\357-\252Ge\254<\311\177\240\272\222\021T+/\225\t\027\022\316{\235p\240\036\355\361\321\031\035\311{\240\272\262\004\337\335\241\27494\250\223\253\241\274MzT\3750=*\223gt#'\364X)o\327\003\\\342\214 p\224U\250Gy\001\006\250x\275\262\254\353\307\205\202V\332\022\367*\203z\006\376q:$lM\313\220\2605#\356S\236}\275\036\250\376R\324\327v\345\277\275"
+	.string	"\265\247\325\201\301/\244U}\235\004\210\2677\275\302|\r\034)\002\344w\037"
+	.ascii	"\007\257\035\366\247\343\351\335m\335]\362K\307Q\337/\253\313"
+	.ascii	"\006\231\257,_\321\027'\2243o\267\276\216\326w\306\302\373\314"
+	.ascii	"[7\267\243\021K\276X\270\375\271\270\367\262M~\3458\307\234\231"
+	.ascii	"\24503\223YFH@\326v=\250\214\333\310\326\031\354\223)\232h\354"
+	.ascii	"\255\237\317\343H\337\344\016\214]Y=\266\3136\004\354\357k\r"
+	.ascii	"\351\245<\312*D"
+	.string	"H\356\206\365\314.\243\254h*\362n>\314\353\220GY\321x\b\350\205D\007\025/\206\007\2202\257;<\n\f\036\272)\303\273\"B\200\265\335\275\036Y{\b\216!\333\212\331\036\223\204\344\354U\367\337\266\177\264\366\330\336\244\267=!\b\223\364\264\262{\257\236\344\353\035\f\f~\220\243,ARRz\364\255\223\206$r\264O\326\301\201\307^\312\337(P\223\314G2\354\223\334\203\325V\254#\326\264y\022\3675\345{y\022+?\b\323@\262O\"\245GQ\224\341]\331'\333<Q\346\331]\253\307\254<\332&c\376P\223I\003\367\017\346\241e\244\241\345\013\206\226i\f-\317\220q\024ch\371\305\215e\0277rfQD$\264B\305O\212\241e\237\333\235y\256v\336\371\362\254\363&\347\034\241e\234\032\313(\204\226oh,\333\330X>QcyXc\271\246\306\262\260\3062\315\320\362\314\320\262\314\3202"
+	.string	"B\313&\204\226\203B\3131B\313@\033\313\252\215\345\337\t\313\251\3202:\264\354\253\261\334B\313\226\306\3621 \002#\006\203\220d\033\241\274]O07\016\205r\303\355\376*\377\3627\362+\371\325\376%\377\332\337\344\207\362\273=\310\374\231\263;\016\316\340`G\334\342\252s>Q\351\356T\342R\204\206\245\216G\235\322r\t:%\271\037Q\334\222@"
+	.ascii	"\264\fP\213\205c\3734[\345\177\032\200\306aC\356\251\3016\321"
+	.ascii	"G\202\371\351`\377v\370!:\362\240\230\237\025\035\323\207\263"
+	.ascii	"\314!\226\255\352\311<\363\261:\033\216\277=\206\031\326D\233"
+	.ascii	"\214\211\\`\336\347\213\005jq+\242\323[o^\r3E\254\217\372oW\351"
+	.ascii	"\332\220\330\024\235\323[l\211\254=T\264\243N\303\240\202e\277"
+	.ascii	"L\260\202\217\034k\365X\207]\\Y\275w\361b\005\006\237\214\376"
+	.ascii	"\362=\007|\230\352\264\214>2\207\243}\n\251,\247,\371\356\365"
+	.ascii	"\321\302\231\304>\371\250'm\265\201G1\032h\246\366\017\220\235"
+	.ascii	"\034\375\353_Y\301k\226\r\262j\251\367\336_\003\315!A\352\224"
+	.ascii	"\371\025\243E\331\031(C;F"
+	.string	"\367\3444\332\017\243\265w\365L\257<nEa\350\212\016\230\246\211\245^\363n=\316\005\327\343`\360\020\bwuV\336\274\362\234/\332\205\211\031\375\242q\332\220{G\347Q%\270\034x\304\t\326\245\216F\327\343\326/\340\331\333\315s\276\360\031M\243q\274h\3558\362\272\202\215amaF_\t\220#\216\302m9Z\004\230s\316\327\314\253\216\307\341\340!\250-J$\355\322\373\244H\355\353\027\331\362D\212\231X\3025\221\372V\376\346c\200\2649\311s\npA#uN\233\326\216#\257a\326\205)\365^\254!\266a\025\254/\360\2030\245G/\350\247\315!\321r\364\316\307\315r\240\025;\260.w:},\357i\376),\231\315\346a\205,\273n2\253c\355\341Sv/\362I\266-X\260\225\207o\215a\355\221\256=\226_\317\274\017\315\307\235\222\242\337\344D\001lA\006\024\324@\213KD(\037\177"
+	.string	"\0045\365d\\\342\300X\224*6\021\215D(\003\212&0\325X*\032\1776\214OJEc\272T4\266\261\330D,\032\245\242Tc\321\006\261\370A\252dTjcQ\352\351\311\203T\311\b\303\211\310d\303I\202%\246\0276\212R\306\242\bNL'\214\306b\337p\"\206\320\001*e$J\325\b\262\221\007+: Z\240\203\"PNTTQIi*\352\307J@MOF\250b\221\203%&\017\234\236\224\202\234\230\210MAJ\306\250  \002\370\t\252h\f\222zz2\006\005\225W\357\037,\332h\354\252\217<\202\222\251%QkOP\232\334\3024Y\364\215\274\3478\315\002\312\321>\273\340\364\317+\317\f\253\255\362j"
+	.string	"6\031#\360\2359,\373\305^9\"\311\022\265\311\270\351\340\366\322\242\376\031\\\035*\324<\275U\005,%\n\303\334CU\364No\3614\212\266Z~(\202\255[R"
+	.ascii	"rm(\372^\320!;}5\236\276\235\357\336{\177E*O\0279\300\254B\324"
+	.ascii	"b\354\312\207\367\264\252\273+\301#\352\026c;v7\315\323\307\263"
+	.ascii	"\351\233>\233\326\336\211f\273\226$d\231\330\364\317\013\222"
+	.ascii	"\bO\237h"
+	.string	"\2344\255\275\247\300\354\322B\360\370!%\365\371rzEo1\013\365\355\206\335-\3246\013R\214\204{bZ\323\303\336a\323\332!l\232\256\351#\305\272\177\31733\025\266N\026\244\331\221\253\274\374\2158D\323\f\314!\271c\302u_\371\r\306\230\314\347\363\371\374\001\351\225\374\246\fo\212\212\276Z\004\266*\257J\317>\251\242[\214a\365\300\244*\f\026\0173\235\264\223\351\231\266Y\264\\\360\351\201H\250A4\310\030chFDD\222$\311ra\005\304 '\241\343\003\021\0209\251T\311\210$II\245\262\314\001S\310\255\266\333f\236\215*\t\203\227\"\230\001\345\352\276u\335u+W\373ry\027H\005\023t< \025\266\320<\346d\372q\3500\317q\003{\213\0315\005\231\301\310\360\255\005\344\341\272B\367(R\371\262\302!\333\252\357\355\2350\220<\263\220\371\257n\022!\322:J\352\227\335\227\3506"
+	.ascii	"\002\037\256\023KH\374\016\005I\007n\316\377bF"
+	.string	"M\374\207\270\023\312\301\224\020\214x\027m\210@\023\222\177\375\0065\202 \301\001-\235.'\234\376A)\\\373\273\bY\230\205T\b\367\350\343w\275\253\370\305\225\303,\302C\001,\261m\203\351\037\241\260\001\006K\316)\303f'\220\001\350&\373\266.\301\017\274\230\250"
+	.string	"\241\237\250\304|\210z+\322\341\311\272\255\225\354\314$\004\270\2643\223\342B_\343\330\206\n$\016\261r\277\225J;{l\257N$\232\232JXb28l\237\223gv\317\234\260\262\310OsB\002p?,-\252Ms*;\307iQ\332?\266\023\345\035w\265Ztv\020U\320"
+	.string	"\344fO\006\240\232\244\007y\266jZ\303\371\206\214\017\347\0018\371\230\335\276=\302\352b\313\247\256\207&\216Bch\363\007\354\371\222B&S\263\201^\022\334E\275\352\366"
+	.ascii	"0r*\215\350\035d\241)\026\027\007\032:\225<\003\272t$\304\347"
+	.ascii	"+?&&D\333o\030%`^G\201\253\304\267[N\361\300[&\035\204%(@3$\275"
+	.ascii	"\216\225\305\246\200;\367\256\002\360\232?\263=\263#W7\356\264"
+	.ascii	"\277R\031\214k\253\320\002\221\fz3^\210g*\013t\222\350\375R\373"
+	.ascii	"\006<\016Bc\301\375\333\200\202\205 \020\305\333$\303@\3216\356"
+	.ascii	"dH\332\331\002\365\272\032{\2549I\271 \235\202\362\177\337&\235"
+	.ascii	"\207U\231\026\363\373_Mq+\227E\366\262\2359o!\330\267-b\230\344"
+	.ascii	"\203\361'\372C` \2410+\262\033pZ\200'\206*\017\250\260\265\307"
+	.ascii	"\211(\246|H\300\375Sz\222\265\026\377\353\261nY\340\263U\177"
+	.ascii	"\213\224\274\225\003\254\214\200`\353\025V*\276\2335\223ec\206"
+	.ascii	"\243\362\250r.\265\364\023\222F\"*\016~L|\3338\034\013<\211\365"
+	.ascii	"\213\315\230B\002\202z\376P\375^\035\362\007"
+	.text
+	.section	.gnu.lto_isSavedRecordCurrent.28.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`b\004]\035"
+	.string	"\306\365\273I\220XN:\004\257\362\300HNH\034\353\215\327\224\026\214{2wt`\370S\330\251\330\365\f\2433\237\375\263\3779\306\235\t\022\217C\342\027W\221\001$\"\003\254*_Imd^I6\205\346\334\205\r\262f\t\331DJ\231\002\243"
+	.string	"\233"
+	.string	"\261"
+	.string	"\277*\302\245_,\243\277\\\312?\322\367\352%\016\255\347?[l\375\321\260\315\370\022\303\254\326Sg\3517\324p\\z\230\377\255Z$Hku\264\271Z\243\274\200\325z2x\203\332\322\237\2133.\255m\200q\351\377\363\364 =i\317\037N\244\023\260IKX\353\271\353\251MZr\244bs\322\227g\370\005\f*-\251\253\265\226\301&\036\177Lk7V\024\025\354\250R\003\207\314G\2272\370\202[\f"
+	.string	"\345UV\023d\022\027\224Q\345\330\253e\030\301%frB\255\365\f\f>\355k\373_\351\277\213_\f\021e\357\271:\037\247\335\206\277@\243\255\177\236\020/\260\354\205\342\361\242\225\316bPX*\247\375\347\022\267\324\277b\355\250\237\344\347\316\277!\3716$\277\206\344\343F>\315\236\373\222\344\337\326j\327V\362\311\222?\336\370\324\306\027k\374&\371<\362\027\300"
+	.ascii	"\"d,\256\324\352t\206L\035\243O\206\354\271\373\357\227k\231"
+	.ascii	"\024-!\321\224\b\273tt\025M\021r\025\375\345n\375\345\2156\311"
+	.ascii	"W\253\314\342ed\263\304\212\343\254O\021\204`UB\234\332\303\274"
+	.ascii	"YFku$\340\254O\033e\0306}\376\355\310u\337\206g\225\300\231\325"
+	.ascii	"0\336:\3279aM8\266\276a\245t\270\365jm-=\323Z\033Y\230,\016\033"
+	.ascii	"\245\0037\235\362:\362\241\027.1\332R\337m.QD\304\210\035"
+	.string	"u\232\336\016\302\322\302\304cv\257\326V\006\214\331\320\f\3274\275Mfh\366acM\343Z@\330\317\314\322=,\224\017OP\200\370\0069\032\227\326\364~iY&K\321z\354\222\265!1\223q\344\314\326\333\265:\337C,\230\210Z\255L\017\276_%|j\265\326\r\262t\233N)\031Z\371\370\f\227QA9\351\267\030\313\316\251\312\202\265\205\211\307\234\305t\004/\261CT\3243\205|L\336\n\336\320\217\371Cd\200\204\331\003\342\231\343%\0049\030\001\201g\004o'G\210g\366\201v\206z&\021\217\347#d\"(E\017h\227\302\304\317\320\016\310T\261\333)\360\036\021\317\334\255\350\365\314]y\372V\254\035u\026u\226\307\005K6\214\3777\255\363\365\322\311\276\241dK]g\307\016\322q\267\330\264\177\n\025x\201cK\340\361k\245\177\307N,\360\267\260W.,\245\335M\2006\216a\255d\020\373"
+	.ascii	"\020+*+D\214j\314\327\344\0044\373\004\037\247%(b\343\306\330"
+	.ascii	"R\267i\356\275\332Z\331\270\b\306\\\007O\250q c\030t\310\320"
+	.ascii	"\210\310\310ha\222\034p\002\0311\273\016\021\2409T5S\220V\366"
+	.ascii	"\r\226\243N\3747U:\220\321Kd\223\017DD\261MM\357\220\371\320"
+	.ascii	"\254\211\250\001.\235\310V\331\212\224\355\022\374\352\300\347"
+	.ascii	"\202fp\022\310\224\024'\344p\300\220\344R4|\201\251rH\214\033"
+	.ascii	"0R\\\332Aq\214!\266\3103e\005s\257M\316c\336%\323\022\251\351"
+	.ascii	"\244\355\234\367\001\001p\216-\fnfU\031!\263Fm\033\352h\"7v\001"
+	.ascii	"\022Q\361\332\226\203Hd\226\266\346\363\t%*M_?\371@\347\316\232"
+	.ascii	"\020\324=\212C\251WY\2402\233\241\203\265\2521f\311\357\017"
+	.text
+	.section	.gnu.lto_isLogSpaceBlank.29.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`2\002\025\023"
+	.string	"\246\244\177H\320\362&\035\"<n1%\f}a\245\020\246\375\036E\2525'\022fo\034\255A\301\267\214T\335\030G\t\315\376>\013\231{\370\274\223t\346\022^d\247\304`\022G\262\317\026\0209)FqQ?\313\226\020\262\267\224)\005l"
+	.string	"c"
+	.string	"m"
+	.string	"\261\013\230\263G\251\306\234\241\002\227\200\227\016O\300\273\004?\300\2734i\315X\366\360\307\366\331xjFRs\206\254-!\323\030\336Re\377<\031We>\315\277\325\215\246\336\310\255\206s\263Q\231\"\3471:@\002a\033\271\325D5\301\004\265\272\325t\237\273&!\321z\310\270\345\\?\2249\247\365\346\346\341\006o\373\203m\n\266>\b~\356q\305\211\256#\246\006\261C\032]\037\373\013B\344"
+	.string	"\362\366\330\252\017\375\340g\265<\356\216Q\275Q\255\253>\200\003Y\222\202\332\260\233\323\266\0232\227\344\r\241\343~\373\"4Z~\350\347\274\022\321\265l\\\354\323\246\203\212\203\320\317\2179\303\004\227\236"
+	.ascii	"^\336\236\261W\266H\256\245j\277\305]\314|(>>i\212\252\375v\364"
+	.ascii	"\333\2708\340\306\205\240\243F\247$\213\270(3\r\3628\347\234"
+	.ascii	"RU\362\270\252\275\215\n\232\356|\035\217\r\215\341\203DR\\\037"
+	.ascii	"\177w\030\357\013+j\252\321)\373G\032`\300 ?\346]~\357\204\263"
+	.ascii	"\023`\007\016\036\253\264\003#j\375\355q?0\373\213\033\305\374"
+	.ascii	" \307\310\350o.}\031\357\362[\003L:3\335\005/w\203\225\223\024"
+	.ascii	"\006&).\222\002\027\\\\k\025\222\226\027\354\305\345\252\200"
+	.ascii	"\201e\305\345\245\302ra\261\320\302R\201\305\260H\020\370\365"
+	.ascii	"\342\202\2612\274^0\326\312\266\303\371\355\261z\237\361\023"
+	.ascii	"=\302\323\211#\235\374e\336s\227\360\004t\244[_\346I\271F\231"
+	.ascii	"-\355\333\325\250\242\246ow+y\272\273\237SM'\256\256gT\0332\323"
+	.ascii	"\335:\211@!\345m) P\202Q\312v\003\350^\251\222\220\327HYbu,\366"
+	.ascii	"\013k\030a\216\"!\224L\244/\307B\330)\303Bj\f\346j\254\"nZ\265"
+	.ascii	"\307-\342L\330\030Y\355\023Y\362@\305apZ\305c.A\327f\341\263"
+	.ascii	"\265\227\227\217\275\027\303\007\006\027\316j\256x\257\375\274"
+	.ascii	"m\373\274\264\211\327^\002}\002"
+	.text
+	.section	.gnu.lto_writeChangesToEEPROM.30.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\212\021\005X"
+	.string	"\212\222X P0\322\272I\007\n\037\334\225D\332\"\356\203C`\256\223@\002\212\361\331\254h\320t\235\347\201{a\352\262\177\344\266\237\375\203A\214-md"
+	.ascii	"\332\325\006\303.\317s\213s\374\232\367\331\304Y4\332F.$_\013"
+	.ascii	"\036\256X\207i\2725\"M\312$\003\365\001\312\001\357\001w\366"
+	.ascii	"x|*\220i\031\242\002\265\277a_\347v\252\340\340\344\025Y_\265"
+	.ascii	"\026&\212\226,t\246^\215\325\007\027\006\371+\275\233CQ\322\206"
+	.ascii	"\220Tukbp\267a\027\335%\207\263\227#5\266\306%v3\316\256n)\253"
+	.ascii	"V\002sp\304\340\224*\024\217\037g"
+	.string	"\311\317:`RV\255\337\020wt+\340\346/\020\324\336\315\036\355GW\303\337<\371Y\007>\254?gLz7W\331;\rKv\321\233\273\335'{4Os67[\364W6\303\313\236\274\215\007\301*e\255\032\322)\305\340\244z7\r8mP\3635ON\006\302\2531\311\343O\017n\265&\215\364nr\r\376\324\224Mz\025N\357\210&\347V\2532\203\336\315\237\037\250\213]\206'\037s\022$*k\022-F\201\023\203\253\025\216\213\233{@\357f\321\225\316\233|\244\363\346\302\220\361d\323+\301\260xX1\034\331\300\325\252|j\026\214\366\034c\245\206\035\306X\251\201\317w\312o\257\323/\211PJB:2*\002\022\r\375P!_\217w\232\273\346t_\365%\336\r\263\377\310\341\252\r\230\213\370r%/b\222_8\311\313.(&\331\205\221\226I.7+\362Q\013iW\330h\005\255-/\342\335"
+	.ascii	"\242\360\322\002;\3212\211e\027\264\303\305Ci\347\2725\2610/"
+	.ascii	"\255-\377\355Nh\301\022w1\311\024v\301;kG\242\254\"\243_&Q@\263"
+	.ascii	"\212,\264\203\341&\353\354\313\344\t\273\2412?\210\271\331Q\210"
+	.ascii	"I\202a\337\216\007\005\353\313\227"
+	.string	"I+\273\004\344\334\344\034\355|\225\005\205{+hm\235W\345'\232u\334\005k\255DYF6\217\366\026tnbq^Z[\337\235\b\346\275k\301\205g\n\232e\265Sb\313\322\303\315\316%d\025\231y7j\255\313\310,\255/\323w\377\266\273\\v\201l\001\265Z\315\330\323\245d\3223\373.\035\2347\241\372l\332\306l\270\t\310\253\312\271\217\355\r\213\r\320\212~\234\007\211\324\302<\007?j\332\234\375\345\347g\017Q\360\212\336M\321\340\340#\317f\240\313\252\253\366\247\206e\331et\240d\231\375\025\267\243\t\254V\343\221\373@\207{`\367.7W\307\216s\307\331\323.\"\317\355\321\276+\343\305jW\226f\357Jp\344\0331\b\036f\373v\275K\301\220\256\f\371\366\246\263{\3277r\025\271n\367\177\356\326\244\002\037>\316\233\335>3{\302\266zo:w\201\334\254\311\316(\321'\b\245\270\232"
+	.string	"\230\234\333\256\277\276j\224l\370\364\246\347;j\r\017V,\267\373\266\363\220\356\273l\020\013\370H\013\316\233\357_\333\026\221\353\366f\017\022H\031\367VynWY\344\376Jk!\215\313\266\226]\224W\b\312{A\020\224\027\b\312\373\303G\017\036(/\024\312\013\001\312\233cyq\330@yk \361\312@yc"
+	.string	"y[,\357"
+	.string	"\237\363ujb\361\263\357\n\224W\005\312+\300\362\246"
+	.string	"\362\242@y\203(\357\t\2247"
+	.string	" \257\t o\t /"
+	.string	"G\274$\216xG\030\3612\001y\227P^\021\313\253T\304\233\004\344E\372\361\036\r\361\032-o\321\020/\220\210\227\350\307;4\304\373\373\361\242W~\205P^\037\312\333Cyy\313{\242\274&\312\273Cy{y?\344l\372p\245"
+	.ascii	"\346L\363QV\254:\272\272f\312\001s:\377\234\377\354\037\373\225"
+	.ascii	"?\331\337\346\274\335\357u8\037\016v\340U\221\221\331se\017\007"
+	.ascii	"v\340t\340@\355K)63\r\231\013k/\254I\301\371\243&\265\213\346"
+	.ascii	"\t\306,%\220\376\321LB\034\267\212\233Ba.\351\021H\237l\313\362"
+	.ascii	"f\036\266\373\330\364\254=(\"\312\3534\331\031\3005\"\320A\276"
+	.ascii	"\021\353.\244E\364RQ\0045\023\226B\3728<H\374\235\177\031\263"
+	.ascii	"\222qn\203~A\013\311\263i\030\203}I\317\\\220\007\217S\377\316"
+	.ascii	"\203\3046K)\013\234\332\325\352\345\300\351\274\351\324\205\271"
+	.ascii	"\251\311\241N\214\253\266\327\022\251\tZV\236\273\002WaR\210"
+	.ascii	"\224\234\224\332F\327\355\374#\250\315m\020T\336\276\206X\013"
+	.ascii	"g\371"
+	.string	"\234\2648\033}\345i(\300|\345O`\233v\356\246$\244X|\244\215\246\321\305j\201\272\256\356M\316+\317@\027Q\b\032|>\225r\336\315\315R\023b\364\251\222Z9\361\006\203\221:\251\257\244X\214]\265F\235\324?j\244.\3408\310\250\227\253\fY\200\312\321\024\243~\331\t=O|7g\223f\351!w\323\257\224\005>rO\330Y*\tR\022y\241\373\363+j\226s\301@.\251\027>\262\250\203D\375k`\237iF2E\242&\361\346&\\\2402\004\332_;\324hG\255\321\363\353e\254!K}j%\036\271L\002\227\220\202\3310C\206\2347\207\372\306\027\030\311W\302tLZ\206\217L\3134\213\266-_\243}A\307A\202j\334\033\001i\270|\020z\223\323\327Qk\332\254X\316\327\300\2661!\265\260\245\257\277\226\306\t\274 \315\223\333\255\216\025}\265\feG\217\255R3;\316\025\375"
+	.string	"\036+\226\203\222\342u\203\310s\337\325Zk/H\377\354A\247#\235+:H\337H\246\210G\355\n\363z\255\324\247\326Z\243y\335\353~c\344\352\325Zg\360\372h\277\tmc\347\233N\b\272F/\307\371\321\216\226\231\253qn'\352\336\344\204j\bzD\332q\253\270i\330\0059\351\005\302\020\220"
+	.string	"9\"\034\362\214\f\247\212\b\207\347n\360B\211\007S\303#\030\f\205L\204RD\206D\224\2508\"\034\366Ph\204\210p\203s(\224\"\"\0342Y\322+2,\322[C\003\004\242h\300\210\022\276\030Qd\370@\022\"H\214$\321q\004I\016#B&C\341\007I\220$m\221\027RSC%B!\006G\220h\220d\252\310S\022$D\244\236\212\f\227<\275H\261SJ\204\303'&SS\303'TI|kY\356\022&\354\210&\002G\003\365\224\225\371\376\364\274\331w\374\221\241\f\255\357\347\003\354"
+	.string	"\2757\210]\\'c \220y\320f\251\277\226\225\\\234\223\bx\213\026\215\243\177\212\350\257\235\331vC\026\245\326\262*Z\200\346/|\246\242gl\331Z\n\004\350\006\332\306:\215\025\266\244\024\315_&\340]\2526*?|d\212\256\321U\354\252\031\252$y\3041i\220\214\232Z\250\257\\\034EG\371@\005\210\217D\321\btE\325\211\200\251\200\240\002d\225\306h\250\204\260rZ\306\t6\362\255\203\315{\216'\304\350"
+	.ascii	"\372\204\3578\305D\307\350eVs\241\016\240\231\336\030\007\025"
+	.ascii	"K\264\211\276\221N\250K4/\317q\320\301\226h\226GE>\372io\222"
+	.ascii	"\373\255\216\035>>\203`p\352\253\335\025\261\350\233\275\347"
+	.ascii	"C\335\330\317F7)\3218\22151\237H\366g\212Q\177\355\356\210\232"
+	.ascii	"\032k\006)g\300\036\315\242\257v}\364\347<H$\336\251}\030\341"
+	.ascii	"Q\213[\262\350+\271\350=\202LM\242\001\350\301\243\0018C\242"
+	.ascii	"\013\330\022\005\003S\217\350\337A\240k\227*\020\233\241\212"
+	.ascii	"\033\321"
+	.ascii	"/\332\306\2044S\337\f\017\007d\200-5\217n\352\2452w^\207jnF\237"
+	.ascii	"Z\255\216\374\2351\313j\342\334\245\022\324\013BF\357R\325\275"
+	.ascii	"N\nfO\n\306,8qn9Z\306\017H\347h\2464\343\240\"\237\233\201v\270"
+	.ascii	"O\006\267=?\252^'-R\t\201j\250a4\347\024D%\"\"\"I\n\2224\006"
+	.ascii	"\021\005\304\030()<\017\022@\225M\b\231C$2\222\202\202\202Ja"
+	.ascii	"\230\003k\205RH\351QJ\231\212\215\245\216\232\312\252\036\355"
+	.ascii	"/\360\177\272x\f \255\371\326<\f\227\226\375\n\021\306\264@]"
+	.ascii	"Xq\246>\326\\\344_\225\243+\272\314/\2410\036d\2368~\345M\331"
+	.ascii	"\206\243X\256:Zi\330\363\377\031_3\202\246qA\304\215h\371\275"
+	.ascii	"}\224\206U\247\035\345O\335\241;1~\365\0206)\200D\236\352IwU"
+	.ascii	"\356\327\262\004]\223~\255\r\030V\275\364Q\245\341\351\215X\245"
+	.ascii	"\231k\016n\273s\357\007\373\337\207\250\266i\t\002Iz\233u\363"
+	.ascii	"\327q\354n\037L?w\246j\332\305\t\271\263\217\016Rd\261\027cn"
+	.ascii	"\245X\005\206\020\310&\200N2\373\350\372\3339s\2276\307m\032"
+	.ascii	"&\005E,\221\314\343\274\rk%\016\035\270\225\223\3221\272X\321"
+	.ascii	"a_\032\252\324A\016\257\30604ca\300\036\213\210\377\205\207\277"
+	.ascii	"\310!\322\006\240(\007\347\020\253Q\001\027B6}\270\244?O\341"
+	.ascii	"\316\246\274Sl]\343\236N6+`q\255\005\023\025\r\013;#\030\211"
+	.ascii	"\222H"
+	.string	"TQ\373\306\240\244\232n\342\372\"+\377\002\005\30267\213\261$+x\016X3 \006\033\001\217D_g\207\006\214\323\2712QV\367^\233Gr\215\360\353\232e\002\301\301+8\203--j\214UF\300\243_/\020\227\306\221\203<Q\2158`s\260TV\334\030 \022\2406\327\"|,\034\244\f:\237P\227\324\304E\202\316\213\2100\025\327\245\253\225\204\275^-\302\263-*\254\247\204\313\322\r\231P=\207\341.\027WAl\210\036\271\023\243\302\376\344\244\271\334)\034\r\224\030o\b\005\214\360N\210\274\242\303\246\330f\2630\323\211\323\330\225\264\351\031g\366'\020\270\341\325\271p\2410\003\310<^*lB\340\375m\225|\243Hco\023cg-\252\002\202\007t\fKfC\303\233\305\253j\032\221\005\230,\244\223\325\224\302\210\313\347\001Oz\220(\266\277\"[.6C\344\275\3013\\Q\254-\233\347\214"
+	.ascii	"\350\300\240\006\t\0031\205\262/L\006\006Z\022\004L\347jB0*x"
+	.ascii	"\r\020\224\263 \301P7\302m|\300\\\201\334\306$\345&\314Fi\200"
+	.ascii	"\007[\002v\246\364B|\263\207A\2719!\177\002_r\3023\204\356\362"
+	.ascii	"\232\242\236V\023\367\023\016;\236s\360\202H\002\225,u\271dF"
+	.ascii	"Q_\f\377`\257\235\244\013\344\r\203\260/s\327\346\f\245\342\277"
+	.ascii	"\2713!(\271\365\031A\202\0010\354\261\374\230\020\200=\324\201"
+	.ascii	"\232so\3341\317\334\013*\t\245Os*Dp\022RL\346\250\352d[\276x"
+	.ascii	"\276\210\305S\003"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.31.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\315\002\365\025"
+	.string	"v\350\213I\340\356(\0358\321\021\332\301M:e\370\006\007\260\016\035\253\341\261\245\201GVH;\365\212\254\242\321\370\306\013\200\266\275RD\241\275\313\266\246\306\325\025q2\214a\304z\311\025Y\210\207\236\0170\274xJUDb\t\331R&\031v"
+	.string	"r"
+	.string	"u"
+	.ascii	"\341\316\214\021\257\251\273\f9\250\t\304\203:Sm\361\262\247"
+	.ascii	"Av<RDSw\257\230\203\362gy\235;\273\210\n\301\311\343\316\364"
+	.ascii	"8\332\305\327l\216J\341\310p\252\310\251\352\305,8\003tw\nGa"
+	.ascii	"\"\350\356\007}ep\266\235\032\273\334Y\314}\234\006r\216rO\252"
+	.ascii	"\271\231\037(vX\274w\002\037jlvQ&\335\255{\303U\270j\\U}T\365"
+	.ascii	"\201\352\202\bL\275N\252%mY\247\372\373\232tb\224yT;R\367]\307"
+	.ascii	"\363\256\342W\303\257\202_\235_\345\257\356W\357\001\362\342"
+	.ascii	"\247$\264\353\261\212\262i\236d4\022X\302\347\276\237\367U=G"
+	.ascii	"O\311\177\007\332\340\350\020\244\017\361rv\237\026\251`\312"
+	.ascii	"\306\241~3+\332\201xP\365\217\360\340\274Gx\360z\240\331\006"
+	.ascii	"\007\206\022\325\367tD\301\354\274\027\025\255l\232#H\242\361"
+	.ascii	"B\027YF\350 7`f\220\347\f\322F\344\311`\021y\241\266O\272\327"
+	.ascii	"\242pd\346y\202\374\001u4\210\274N:\362}\237S;\370\276\253\016"
+	.ascii	"|\344\016~L\216m\237\004\030)\341$-\233\324\326\251e\231A\320"
+	.ascii	"?3t\203\304\335Mc\326\351\377\356\356\221y\364/\341\231\365["
+	.ascii	"\202\331\030:Wu\202\313\376v&\311`c\232\276w\215!\013.`\0042"
+	.ascii	"\026\025\227Lv\202\322\022\024\022\326\202\021\226Kd@,\346j\265"
+	.ascii	"Zb(m\211\250\274`,.\027\204\b)(+\257\326j%\345De\325\202\305"
+	.ascii	"V\"\005\364\305\342\202\255d\257\027l\265Q\366Mjl#\305qU_\022"
+	.ascii	"\3667e\246\351R\316Q\016\305:\r\371\033b.\373[8Mh\331\335\341"
+	.ascii	"\234\"\247R\314\372\341x\200\301t\220u\n\340'\350b\323\216\004"
+	.ascii	"I4\206|d\031\235\274\374\336\305\024\273= `\002!S\332\003\331"
+	.ascii	"=(\315,f\233z\210H\022b\313\302&x\312\252q/G\272\200R\2161\202"
+	.ascii	"\025(ex\320VEU\003\240q\250G@\343F\020e\236\306\203\366\352h"
+	.ascii	"s\"\t\343 ]Bk\024\331\005\036\366\rQ\035\327\3640\247\221V\241"
+	.ascii	"\351\004\206<\310w\331\2618L\245n0\3234\207\340L\220\306\f5\007"
+	.ascii	"\330.M\354m\254\314\27673\2237jlL\256F[\334\271\030\240!F7l\267"
+	.ascii	"\274\r\267\366\212`k\017"
+	.text
+	.section	.gnu.lto_addToRecordIndex.part.0.54.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`w\006\025'"
+	.string	"\272E(\017F\200ZN:\275\244\201j\363\263\353\241\363\363\202\007\230%\261w\255\212p\273s\343y\230\007-\3012\375\215o\034\351\224\377\221\211\245\235OA\270e\247\234\332\307 \205\264\337\351h@\334\177\334\212\326,!\204\020\271S\n\333"
+	.string	"\320"
+	.string	"\340"
+	.ascii	"\366\305\374\260O\231:\025\030'U\360\244\302&\006Wkmp\322$\316"
+	.ascii	"\223C\243\245\352\215.F#=\230#P\230\272\024\250\027\017\354("
+	.ascii	"z\241}\220:\224\250\001\305\212#\bt\305\210\322\027\375'\377"
+	.ascii	"\232:\224\250\377\324\272\245\346\254\326\342\203\223\206p\236"
+	.ascii	"t\361B\345\311\363@\345I\373NlK\005=e\257y\221X\315a\023\254"
+	.ascii	"\2608\265\326\242\223;\344S\337\351N\263$\307\245\274)\177'\244"
+	.ascii	"\372.\201\356\301\231\027\223sD\260\005D\356kA\036\343\220\232"
+	.ascii	"\030\254w\005wP\323<\032\273\270\340\274\344\204\340\350\361"
+	.ascii	"\222\002\205Y'\177<!\r:\216\021\310\204f<J\326t\361\204Wt{\204"
+	.ascii	"X\343P\255\365d\2476\204V\224\0068\317<\252\265\372U>\356\235"
+	.ascii	"\333^b{\311.?\004\273\364\r\253N\025\235\373\226\336Y\353U\005"
+	.ascii	"_\313\214\025>WTy\222.\221\333W\025\235\363\311\036\"\255\312"
+	.ascii	"\305U:\207\356\320\313\373Xw\3136\251\005\230\324B:\352 \036"
+	.ascii	"5\320H\035\200G\375\263\243\006\260\243\366\031\251{Lj\036\035"
+	.ascii	"\365\316\301~\236I\275\243\324\272\223\3724\251\315\221\2724"
+	.ascii	"\251\311q\244^\223\232\276\370\037\301\0027\037\255Zo\314\321"
+	.ascii	"\251A\310,E>\366,\216z\375\005\203j`\r\233\300\325\253b\003\333"
+	.ascii	"O\216\032P$\342\230Q,:I\355\373U~f\363\374\3642\377\n\207\254"
+	.ascii	"--/\251a\223\240(fO\267\342-c\261\n\177FD\3632qVy\362\3751)\237"
+	.ascii	"\314<K\235\n\f\017]\025\2530\370\261)\336I 6\243\304)L\314\035"
+	.ascii	"\212\325\025\342\235\262\037%\317\032M\222\001\242\333\201q;"
+	.ascii	"\313\263\353\006\253\316\031$\fD3\337\2355\303~Kz\312x\024H\343"
+	.ascii	"\245\f\271C\037\252\344\255\017\f\315N\231\216\265J\201\013\023"
+	.ascii	"\261q\267t\251\0200\267+*\207\f\213\025\273\255\340\366e\366"
+	.string	"\223}\307\225\026\224\203;\367g\037\203\304\240\255\326\252\003\3750\027\323\301\003\022RyR\267g\373%\261\242s6\367\214\361/Ig\255\325\310W\273\027\020\"F\214(O\232\3730\"Y\316\276#\363\261\366+\327\305\301bD\216\215\331}\264\247\265V\252\335\241\313\035W\t\314\313\025\225cr\313\375\321\236\226\344s\271\004\023=\220\251<In\217\333\016Z\226c\255\3229\036\367c\037\252\242s\374Cw\355\023(\350\201\343\016]-\225\351\0062z)\\0\221OMN\333[B\301\302\251\3473}A\205\004%\013\021\224zD\004R\370\232\226z\276\322KD-\232|N\275\336\211\025L*\\4-\025\271`B\321\242h\311\367TD\244\300MN=_\321\213\246&_\021\3176\375Xw\313GUk\265\023\260>\032\255\272\200\245o?-,BsIAu\202Vh)\035$\ns\202\266\f\373-\341}\035\240"
+	.string	"\366g\201\326\316\240\201\036h^\220\337R\331\217\303\324\323F\342p\222\f\264\275\001\332\277\001\263\034|\334"
+	.string	"\273n~ZVm\230\030\020\201l\222&\020O\306\375\354\310\006\314\272\325J\237\005\260\017~]=\3533n\271=K\300\312\317\210\325\223\213\261\372\221\246K\241\026D.\356P\245\377\3665P\0338p(O\036hkS\206\344h\206\3040\347\016\035\346I%\271J``h\331\221%\013\200\200\250Q$\306\224RD)b\221\310H\322\246\003p\002\221\251\262\333\021@\301\263\210$\205i3\366\375T\225\032y\305?A@\016\360\026\253;r\377\2305}\260\260\244\002\312\346)U\326\007\264}+\224[`H\017\374\214\006y\032UeZ\023,4}J"
+	.string	"-.\312\225\265Y\032\255nx\"\313\224T\327s8\312\177`,\304"
+	.string	"[\221\361-\215\216\310|\264U\234;#.\002\302\315 H\374\034\020Y%\233d\004U\317\020\214\\4\267^\270ED\267\251e\307 _'Q\244'\275I\354\026\0307\206\\\nV\362\247\024"
+	.ascii	"\334\322h\2218\302\374t\366\222\370\247\375P\n\236!\016\307\007"
+	.ascii	"\241\203\321\374\320\025\204\322\202\2568t\037\001\301\007\\"
+	.ascii	"\032\326e\\Oh\346\007\360\242\206\240\265\033y\267\274qx\216"
+	.ascii	"}M\312\226\373\016\232\003\326\275\323\007A\237\376q\322`\254"
+	.ascii	"9\307\311p^\214=\n\345e\342D<\364\277\253\374\355\210\024)\230"
+	.ascii	"\354,Y\203\3638S\202\037"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.part.0.62.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\001\001\035\f"
+	.string	"\326\025O?\020O5\035\300J"
+	.string	"\325\244\007(\261\001j\301\341\201\300*\373s\370\367G\202d\203\363e\346\b\235\331\033l\024\260\215\326.3T\270"
+	.string	""
+	.string	"@`\r\n\267\021\030$\025\255,\233 \241M\366N):"
+	.string	"="
+	.string	"="
+	.string	")N\031\273%\202WC\032\257\007a[\fy\264]\274,m\001\323\251\202*cw\267W\332\341\343\351\264F\277s\n@t\341S\300-l\262\273n`\270\353mCl7\260\017!'}\225\007\225?\342\251\361$\214B\363\224+\302R\037\026\313\240\361\252\235\300\365j}\300\365z\237\024\375\322\231\305\2438\016\235\034\263WG\006\211\375\020\216(\030\217\342h\235rA\027\207O\327\254\337\\v\004\t\363\026\254yh\307/\377\322\n\023*v\276\230\224dj\335Z:\262\251ej\021@\303.(\006\214\335PO|8\371\257>\355\373\253\213\360K8\263\350\220\243$\371*\241\006\323\205!\005\263\304\222\240\262 R\351\036\006@\260\343\270\r\210\231{`\274O\323u\016\036\\,\031\217\3332\027\nf\343>p{\034\260\247\351\276-\364\274o\313l\317\323\221'\023(\005JI\266\003\034"
+	.ascii	"y\366 \225Lp\216\303\335\307\247\b\001\344\201\021\256\030\271"
+	.ascii	"Y\241\200\222\247\342\234\272l\252i8\206\f\273a0\361Uv$\225\017"
+	.ascii	"\251&\232\362q\227}:W\331\364\333\271\002p\342\201\034-M?\241"
+	.ascii	"\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\373\004\305\030"
+	.string	"\226\347\226K\240VR\007$\214}\031\322\024\26089\034\333+\350\372\246\225wZ\366\340\337\b\314\226\006\007N\026\021\340\005\244}\356\311\335\354J:\237\004\257\323\250\260\302\205\236\310a\306\301~\037\033\260\\\203p\375\032Y\2257\352\366\261\367K2\311\206"
+	.string	"\201"
+	.string	"\202"
+	.string	"\031\177\021\277\246(</O0\205X\312\334\365\003\206\222\204\307\345V\b$\350Q\246\b\377cBx\333\n\364;\371\347_\362\003\240\017M\351\340,\217I\210=\2576\250\361\374-\3578\205\021\031\374nG\300\202'\220\025\254\224\th\245\372+Md\222\007\202O\263'\223\311\344\201\327e\003*\245c\334A-\235"
+	.ascii	"/LYV9\337R\002\270\226\030c\223m[!\026\306\217q\021a\003`Y\226"
+	.ascii	"\305\371\001\031c\\\232\005n{\220%$2\037\352\264\025\3653\350"
+	.ascii	"C\3354\376Po\027\210\372\351v\352\216%\2555oi\333\263\210Rb\346"
+	.ascii	"\351\346\2613\313\262.\362\351Cm\363\354@>\301\246\353\332v."
+	.ascii	"$HJ\245\351\264b\373xU\035)M'\3612#~F\304\303\204\370\032\020"
+	.ascii	"\037\363\341u<\274M\207\307\341\3607\033\276\200\206\317iV\310"
+	.ascii	"b\334\313\360\276\306[\030p\331[gPI\027\276\007tute\341]*|.\r"
+	.ascii	"\024\205\204\252\245\336\342\230\272\321\220\006.u\242!N\335"
+	.ascii	"D\260\367v-\312\224%k\352.E\\\352\272\267\263\327\f\256\2525"
+	.ascii	"u\332\33346\300\316\326\324Occ#TEcM\352B49\357b7\362Fr\310\r"
+	.ascii	"\347\335\346\233\347\202\335L\216\236\302fn\216\272]c\325\344"
+	.ascii	"$c\363\240\323\346=|\247`Pg\341\372P_\361\266w=\271`?\324\213"
+	.ascii	"\334\030\324Q\274D'\334!\267\307\013\256\250\253\001\230\245"
+	.ascii	"m\334\244\206\022\246\034\017k\261,\233\362\274\207\355(\317"
+	.ascii	"\203T\236\323\214\335/\304dH\331\354\234\026\354,DJ\331\330\315"
+	.ascii	"\316\315\366\334\335\314\210\230\245;o\035\305Vi}l\245/\214\352"
+	.ascii	"\235\303\215Q\275\243^\025\257Q\n\343\252z\321\333=1\260\226"
+	.ascii	"|\252\017\035\033Ci\"\303aS\275\267\252\316s}\252\253\357Ou\027"
+	.ascii	"\267Y\250\2448\001\252\256\033\366\256GS\331\212\352*G\233\352"
+	.ascii	"=<\006X\2501\034\310\203N\315L\020%12V\003\220\002\251*\3426"
+	.ascii	"\021\260(n\234\221hd\002\242\250=d\204\347X\352\262WL!\351\004"
+	.ascii	"v\026\373\376\205\254|@\353\271\027\021\035\326\325L\372`1\350"
+	.ascii	"\"\243:b\246\357\320\347\227c\022\234\313\321r\324\314d\333\035"
+	.ascii	"WF\0166~t\302\314\250w^\373\216B2av\016\245\036\026\211\217E"
+	.ascii	"\302\307\265\313\f\242z\001\016\371\206\216\030\352\252\266\212"
+	.ascii	"\213^\364\027l-\020\353=f\177e,\332\356*\004\345\316\334\245"
+	.ascii	"E\b\240\3269+\272\b;\270\241\007\237\034\330\257\276\260\301"
+	.ascii	"\232/o\f\223\316\030A\023\211a\340+\021\371|\224z\344\252\177"
+	.text
+	.section	.gnu.lto_.refs.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"u\007"
+	.string	"&\0212.pK\222\016\220\377K\325\005E\222RUU}\376\277[UU\325\005\220&\034\037\342\252\037\253\255\255kY\324Z\263\255\331fIkt\023)S\""
+	.string	"%"
+	.string	"&"
+	.string	"P_m\t\307<\037\300N\271\217\326\221{\213\366\027\347'\326\031\333\334\024\273t\177\353\256\033\366>\037\002\n\354\b\327\017\256\023<\274r\234\260C\367lMy>\204\203\365/\250>\306\324\033g\254W\342\304\031\212\376X\003\224`gD\343\204\360\350\250\376\r\207\257Q\3613\"\236a\375\302.\300N}\344\341\316\342\215\304\n\300\f\213/\034\017\217\231\032\252\230\273\226\0078+>@\246\356\300zC\373\004\3263\355\013\250n\020}S}\245/\222I!qNXx\r"
+	.string	"\273\031^\303\231\b\326\320\002oe\202\264\204\200\314\370\254we\207\025Oh"
+	.ascii	"\265\300\003\004\211\007\216\013"
+	.text
+	.section	.gnu.lto_.decls.a791dba7baabc764,"e",@progbits
+	.string	"(\265/\375`\2151\375\323"
+	.ascii	"\212@\331FW \212A;\035S\273\360\037\030\210\n\204i\251\322\033"
+	.ascii	"\234\240\3622u\254&/\252`\023\rO\262\242yn\202\204\360BA*\035"
+	.ascii	"@\321\002\243\313]>\317\323\004\323\323\212\210\037\035\236\020"
+	.ascii	"v\364\235\003\303\373\276*|8\366\322K\333\002\310\337\345k\315"
+	.ascii	"\340\257\262}\244L)\005\341\003B\004|\0049x\026\247{\262\311"
+	.ascii	"\3125)\3211?\247\342y4H\0179c\3159??\321'\375\317\267<\322\241"
+	.ascii	"\356\347z\355Q\257\242\364s:\255\021\306\3446\210\271\333\341"
+	.ascii	"\006\035\315\215\322S, Z\242\300#J\026\327\301\2618\335\323\232"
+	.ascii	"Wh \217I\244\317\2658\324\263t\2105\3473\nf\372\240\360\361H"
+	.ascii	"\261\360\311\0209zQ\364\327\257\3703\016\t\253\311\016\016u+"
+	.ascii	"ME&g\013j\212\274\266\330\370\353{=\305\by\204"
+	.string	"\364\267w\350\267\356~\271MlbrLp{\034~\034_\303\355f\270\335\007\356v)yO\270\275\271\317k{;9\025Dd\330\306oR\f\374\346\311]\314\024\032SZ\376\272\223\263\020\3002#3\264\376\266\333\300\355B\326\274\315\256N \220+\256\250\007H\034\315>\235\270\250L+\352V\002\004_\342E\274\215\006i\223\211\354h8]\255\233\304\022W\342svu\236pu#\232s&\321\276\304\337\374\210}:\263\222\250k\003+!@\376\370r^\333\233x\235\323\271\235C}I;\234\307\271Z\373\232\227\033\204Hm\340\361\340!s\333\347\332hx\211[\223\303\372\333$\332\345`d\270E\345\375m\021\340\324o\222t\277\300\310]\201r\376\355!\334B\330\bv\022\235\232\373\333\034\300\335\203{\006\214\301\020'\342\320\013\234\255K\200\320\026\371#\217\315\370\205\371\365\375m\030p\373\005\251\377\371\005i["
+	.ascii	"\3438\210\264\003\007\021\304\323\\\360\356\274\230\374mO\353"
+	.ascii	"\366"
+	.string	"\325}8\2327sV\346\234'x*%\263\030\177\375\207\2279T\0037k\007\342g\355\222\\\363\232\363Z\363[[\320\312\376\3328\210\364O\30029\335}\223\314 \364\343v\rR\373\367\347\032\2442\331A\244\276\372M\352<H\264\367\270I\227\236\326\\C\201\024\027\364o/\361\233\324\3074\260K\025\315|\226\363\352\001+\335\202\214\375\355\325A\244\330o`v\200\335\226\330\375\351\243\300\031@\267U\273]\307\007}4L\267\r\272\243\241\305\353\320\370\031j~\003+t[\242\027\233\3455\260\025\303\267\320\355E^\206\357\240\375\376\002\255E\210\303}\f\257\001\335\277\340w\357\202\f'\276\002\317B\267\243\350~\025(\360\023\350\376\024\272\037\005\024\272-\004\272\035\353-8\241\373\013`Bw\323u\177\tL^\002\335>\365&\236\204\356\217@\001\272\355\362!`\374\007H\300\314\240\333\016\200\350\035\020\200n{\323"
+	.string	"\373r\273\255\021\324\207@|\020\272>\304\177\220\200n\337\340'\003\026|\t\007t[\033\272\273\316\205\374\210\257\351v\232n\267\241A\203\n\272-\b\335\356|\021\335mgA\313t\333%h\237\363\n\350~\234\356v\241?t?\024\t\272[\206\306\335\317\244\275\333\032\273\337"
+	.string	"\335\177A\367S\320\3751\335\337\327\355O\272\335\256\333\231t{\\\267\277u\373Z\267\237u\373W\267\233u\373\263\333}t{\217n'\353v\261n\017\353\366\035\335\336\325\355^\335\276\325\3552\272=F\2677\273\235\252\333_t{T\2677u;S\2673\273=\251\333\221\272\335\250\333\225\335\376\201n\257\241\333\217\335.\324\355/t\273\004\335~\273\333Iw\243u{\006\335\316\201n\377\351\366\236\356f\353\366\bt\373Nw\033\351n\013\272\035"
+	.string	"\335}\326\335\b\350v\032\272;Jw\317\320\355\300n\317@\267\307\320\3552t;\006\272\375\002\335\016C\267\237\350\366\017\272\335\203n/\321\335y\335\236\323\355\n\350v\016\272\035w{\210n\277\351\366\227nO\273\335\245\273\357\272;\255\273\307\272;\206\356\216\353\356\233\277\277\277\277\356\027\021t\273$\351."
+	.ascii	"N./p\232\225\323\317\007}>O\273\036rNBq\346\245%\016\332\205"
+	.ascii	"\211\323\256\234~+\320\267\342h\277\346\245\026\242,\255\034"
+	.ascii	"\364\365\3037Ur\310\341\367J8\201@n\200\212\346\247%\035\372"
+	.ascii	"\367\372\355F\265|\221\371\2214K\217&1)\370\203\220\234\227\362"
+	.ascii	"S\372\251@\237\312Gq\3169\306\316\357\251\005N\367\353\365G\215"
+	.ascii	"j\312\300\222\326\336(\346J\256\211\334\022\334\337\235\346\274"
+	.ascii	"\302e\315KD2\251\273\270\343t\317\270u\002\330\356\246 \206\234"
+	.ascii	"\221j|{\030\307\220\344\213\307 \217\220\263\2262\271\264|Z!"
+	.ascii	"=,\237\311\274\204\3221yX\256\271j\202\374\304\312\313\265\211"
+	.ascii	"\274M\344\3475+\255\230\262\262\211\024Z\256y)\257M\244MV2\331"
+	.ascii	",\327$r\371\264b\362\345\263\311\344!+32+\223UX\331dZ*i2\331"
+	.ascii	",\237I\246\245\322\212\311\363\332\314\316\304m\265B\246\310"
+	.ascii	"\317\344L\316Y\305\352D\312\344\234\\\312"
+	.string	"\310\272O\312V\321\244L\225\235.l\305\3129\347\214<\303\273j\276\254D\231n\231\243\371\223\"g\274\234\364\001\322\221k\316\271(\023!=\347\024\353R\316DM\032\236\232\336\244h)\317deR\005\321US&\005Q\263(\347\250r\246\345\363\252I\202\315\354\351\314D+\322\235\031\317j\t?\221\253\3530\363\334zR\3617\212\333`\2421\365\302\326\247\243\351\257\213\0169\375xx\336v\2552S\2559\355\322G\036Q\017'\177\007\223\366\244\005\217.'M\354\320\256\300i\375\255\223!\203rq\005\003\273\374\345\364\323A\237\316\333.\362GfZ`\b\022\016\200pXa7\376\366]\361s2J\362\246\356\374^\356Gs\235\261I\027rC\326t\216\206\0229#.\\W\177W\340\224`\346r\020K\222\004\311\213\223)\304\310\272\306\020\241Bk\361G\214\270QW\233\224\277\377\226R\231\262\267\245Wd\355"
+	.ascii	"N\036\177\177\177\315\251|\332_\364\303\272I\340\360O\247;+\301"
+	.ascii	"NE\324\003\260$\247\333\357\3507\032\245MV^)9\327\034I\2779\335"
+	.ascii	"Y\276W\313\027c`9g!O\344\331\276\355\207\274\233C\177\355\203"
+	.ascii	"\264\343\275\332\330\332\177\275\023\rr\315\314\364\212\371b"
+	.ascii	"\214O\206oiO\211\346~\226\303\017\344\317\034\332q\217\326\027"
+	.ascii	"\351\212\016%n\270G\340\035\227\256_fW'N\273:\372\347\213}\017"
+	.ascii	"\032\345\232\231`\312\220^\214A\337\314\241\377\354\273\346\374"
+	.ascii	"|q:C\252\222\336\376\262~\316P)\262r\375}\037$\372\177<`\013"
+	.ascii	"\013\207\277\326\326\300?\366d\016\305y\036\375R\356\326/\312"
+	.ascii	"5?_\356t\230\262W\270\035'\255q\234\264m\025n\033\205\233\316"
+	.ascii	"A\244m\235p[\026\270\355\221\216\270\353\365\246\254\312\201"
+	.ascii	"3\203\345\216\b\f\307{\355 \233\"\367\267\313\241\357\325\357"
+	.ascii	"\\s\316\357\3657\306\2429\257!6\230\221J\222\241w\357\237\r_"
+	.ascii	"r\231\272\246\346\270\336\352\211\231\022\264\0323\242`\340\b"
+	.ascii	"\373\333\036`=\201\3603\376\n*\252\3654~\313\241?\243?\306g\275"
+	.ascii	"\214\031\377\342\255\354\3524\241,*\232s\266o\311\2475|Ep\020"
+	.ascii	")\320o\322<\334_\207\373\255\272?\312\205|\225\314\232\0344\353"
+	.ascii	"\357\303\370f\177\325S\345\257\372\240\231s\362\253j\264\344"
+	.ascii	"\234\254q\317\300="
+	.ascii	"\203\213\303\325\21549\374R$\372\247.\226\025\246\327\337\373"
+	.ascii	"B\260\013\224\023P\314\310\325\331\337w\372w\361O\375N\337$\243"
+	.ascii	"\\\337\351\346\234t\317\200\306=\003\2277\256dYz\373\201\264"
+	.ascii	"`A\243V\304\257\351\357\257x\0251KF\276\306p\340\366\300\221"
+	.ascii	"\244\271%\331d%\221\2323\347\365\225\036\311\321h\230\326\274"
+	.ascii	"\004,\013r\364\305\267\364\314gr\350+\365\253\bQ\223U\244\351"
+	.ascii	"\013\337\376-\374V\270\373\217\214R?(\037eF\313#\262\275!\177"
+	.ascii	"\3271\031&s\253YtA\315\352\"\251?\305\337`\225Ty\356\375}\345"
+	.ascii	"\212\004\025\344\354o\177\023n\037\213\342R\360\240L\361\274"
+	.ascii	"\261%_J\034/S>\004\357y%\246\t\307\350\335\244\276K7\351BY\035"
+	.ascii	"z\030\355\310\002#$\371D\266\350\013\325\367iJ\353H\354\357u"
+	.ascii	"r\321\304\342\256@\003\342\005\365\3672\335\025\226\231\244R"
+	.ascii	"\345\256\370(5b-\262j\\\346U\252\202a\360\256\3215\272Hhl_H\370"
+	.ascii	"*P\341<\273G}\221b\216@\231?\376\311\023\246\032bg8\346\306\226"
+	.ascii	"\266\177[n\221m\342k~\302yllI\364\245\350\353h\356&\373\026\365"
+	.ascii	"MQ\002\204\2362\31423\373{o\270\312Kt\221=\345\223\332tL\375"
+	.ascii	"\275\331\372\265\245\322F\025\303JJ\332\335\013\347\212_\240"
+	.ascii	"P\332\352A\261}\266\016?5\221U:\3502\302\341\305\227\227O81a"
+	.ascii	"Q\276\212\354\265\355k\233E\r\317\251\365\327bi\3137C\007\263"
+	.ascii	"\345\025\313\327\375\362\322%E\315\257\n[+9SY\252\264\354\240"
+	.ascii	"U\307\245\343\357{\277\245V\207\326k86\276\027\177m\016\255\247"
+	.ascii	"\346CK\252\312\334\225\035\321_\033\245i+B\213\213\302vJ[*<\336"
+	.ascii	"R\330\255\3006\257\255\224\356\027\317R\242\253K\212R\245\206"
+	.ascii	"\013\032\177\033f\211\033\006\211a\2168qb\237DE\201,\\,\365\335"
+	.ascii	"\265}B\005\006\013\222\243\245\024\f\223\302\316\316\276]QE_"
+	.ascii	"\224\310\212\226\030\3010crr\226I\b\234\311\312\244\242.\025"
+	.ascii	"\275\232\242k\313\204J\212&6\374\376\332%\326\315\002)\362\324"
+	.ascii	"\361\327\316}\032~\021U\304\\1\214\324\221>b\343\334f%\262\233"
+	.ascii	"r\246{\271\306\017\270\266q3xiQ\030\177m\022\353\246\004e\213"
+	.ascii	"\312_\213\344\215\356\256\250E\241\201_\362\210\020\261o~\245"
+	.ascii	"\365b\214\257\346\t\222\311^\221\266o\330\214\353\210\322\272"
+	.ascii	"\275\233\034R\222[\033\035\023\322F]\236\371\321w\225-\333\007"
+	.ascii	"\301En\330`\361\267_X\340\230!9i\235f\327\374Gf\276P%#\n\226"
+	.ascii	"\363\023\216\013\337\237]\226\025\322v\255o\312\350\257Us4\227"
+	.ascii	"'\f\270,\177m\220\326;*\301\302\276\307\034SK\026'\330\357r\332"
+	.ascii	"\236A\355\331\367\030\341,'\231p\2220e=\361\345%$\034x\340\242"
+	.ascii	"\333\221\003\327\254ff\226\n\373\326\022\253e\205\020\271\031"
+	.ascii	"\330\203\221\2622\373D!EC\362\202\227%\t\330\337\247\243\301"
+	.ascii	"l\371H\201\233\260\314\016\037>\2308\343\024)\247m\017\333\003"
+	.ascii	"\203$@=\234\362\345\264%\263d}G_|@&\330\203\235\230\230\313\250"
+	.ascii	"\201\233\234\275E\251\341\017xaa\366\313\016\357I\n'}r\206\345"
+	.ascii	"\371\310aw\344\260_2L\035v\207\325a\27702D\327\330\023\016\214"
+	.ascii	"\026\023\267\031\177\035j\277\352r\330H\343\302\r\\\201\233\213"
+	.ascii	"\313v\2459\373\332d.\335\224\331\260^6l\027F\306\300\301\331"
+	.ascii	"\266\313r\335\300\227\374ko\330d\235\221\345\026'\231\243\025"
+	.ascii	"nT\177\033\210\304\235B\3013q3f\330-?c\036Y\032m\267\200D\305"
+	.ascii	"\322\2224\223\\\024\301.P9me\310\260Y\363\225\222\363u\334%\201"
+	.ascii	"\262b\227\0309m\255\254l\214\021\236~d$\215\035\223I\204/g)\016"
+	.ascii	"\322\275\270+R\177\203\213\231\237W\337_\254\276\222i.Q\335%"
+	.ascii	"\3718\300\n%7\0338\005\222\323\266\331\024@:\205i\214\354\224"
+	.ascii	"\235\262T8\311\250whK\325\205\343*-\302\351\224\234\376\244\244"
+	.ascii	",G_|\022Tqr\262Q\356D\312\321\027\030T\333(\240\0236\277\350"
+	.ascii	"_\373\364F5\321\256\365\212\243\335\0368\236\262v\3003^,X\330"
+	.ascii	"\246\227\247l\365\250\216\276\300Z\264mr\0026\221EQ\342\342\004"
+	.ascii	"\247c9m\231,"
+	.string	"\323;\371\232\231\"\344\261\341\032*L\2465\362\263\232 <\\\314pZ\227\3236)\351\215\034\213\263\007N\333r\332\"A-\322\033\205X\363\212\031\370\\r`\233\0306\205Ma\215\206\240M\211.\333\032\331\244\313\223*-\\\374\265E3\260\207\252,Y\254\022\005\240\221\334\321\027\237U:\275\244\220\342\007\345\357\377\331$L\231\332\332d\223\026)\245\204F\303\2358\334\031\315\234\226\231\025\233\333\341\226.Lf]F\376~\337\373\001\221\222\220e\371m1\232\221C\364\225\353[A\002\346\366W\213\353u7\315\016@\362`,\231\241\312aE\371\267\003C\242\320XTa\360\021z\021JY\360\021\262G\"\321\204\343Ph\2053<A\242\n>B)p\002\241\240\035\325\030\334\031\026\217\306\230\376\021a\034!,\362X\020\243\326@\f\nR\203\200\375#\302g(,\036\215#T\236!\240\235\241pD\32184\002"
+	.string	"@@C\303!q\b<\352\2446\020\213?G\342\020\330\023T\201\256Z\034\022\272BA;AjP\372\341\3078\004\324\003\342\307(\034\n{t"
+	.ascii	"\320?\"\214?\307`\320"
+	.string	"\210!1(\210\270S\201z\f\362\b\r\351\034\217\302\235\035\235\020H\354\024w$\350\037\021*\270\220\302\211\021G\325\247\030<b`B-\022M\004\251G#\bN\324\004\211@0G\325\347F\365\031\006\177>\250!\020\236\260\2319\016\325\343\220h\302(\374p\024\016\20507\025\330t \342X\f\n\211 \272\300\303\023\234\3408T\213\305!\023<j\r\301\023F\341\207\033\236\241Z\324\361\021\322\321\361`Ct\301\3503\024\036\217\352\t\033@\360\b\201\2020\220`\024z\350\3000\bD\202\272\023\024:\341CT\301(\254\261\201\b\324STk\250\300\r\317P\330\003\3033,\301\207\b\224\236\340\201Y\241\002-X\240\204\022\206\301\035#\214Q\375\3319\006W\230\2119\016\207\210&\2126\037Py\206)\374\354\024\203\252\321\203z\024\026c \2720\364\021\002\005ezGXT\207\252\017\356\017B\310\tA\204\017"
+	.ascii	"\217\305\340\321H\243\352\250<\304\025\324\342\020\2200\3303"
+	.ascii	"s\344\031\352\350\310\250:&\334\030u<\034u\212G\241\227\376\021"
+	.ascii	"QT\203\202j\361h\324A\341G\235\022\036\330\340E\265\247g\bEz"
+	.ascii	"\f~\261\250Z\"\320p\b\027\211\307\340P\030TT\21700\230\270QQ"
+	.ascii	"\350\354\b}\202A\270\030\374\331\271EU\330#<\016U\236\024x\212"
+	.ascii	"A\"\212\032 \"\221\004\035\227\243NQ\345\t\252(\004\217@\252"
+	.ascii	"\004nv\212&Tc\020\005P\335\031\252C\036P\215\370\330?\"\204\206"
+	.ascii	"\210E\037\235\242zT\203\202\305\240\220\001v\206C&\034Uc\314"
+	.ascii	"\260\347\217\252Q-\272\030u@P<\032\205>j\013>B2F\243Z\344\341"
+	.ascii	"\t\002A D\334\271\305\243\220=\352\360\024\211;j\0134M\200&\n"
+	.ascii	"\251\305\021G\"\2618\"\306G\350y\324\016\354\004\205R5\004B\343"
+	.ascii	"=\352\f}\204\\\206>BvH\024\032\213j\r\300\243\216\b@\243O"
+	.ascii	"\020\250\307\345\250\023\002\211\343P8\204\233\001=\036\240X"
+	.ascii	"@\t\024\252\b\n\232\001\f0\201\301\013,\234\200wD\004\021\213"
+	.ascii	"B\252\252\343#\354\031\022wF\f\205\301\240\021;E\343\b\021\031"
+	.ascii	"4\271H.yub]vE@%\261\276\254\272/4(\255+&s\317$9\364\350l\023"
+	.ascii	"\036\016\271\243%v\313n\351+;\223\211\021\266EO\316\366\325\324"
+	.ascii	"a%m(\271Af\274\346\202\264\305\331\267\253\324bu\003\234\032"
+	.ascii	"n\203k\201\225\204HJ\347\006E\005\222+\004g\271\220\002w$\016"
+	.ascii	"&\213\311\026\r#L\266\364\375 {\263O\254\244\360\230\372\013"
+	.ascii	"\"\211\355\026a\273n/KK9?=`\216/\332"
+	.string	"\326\327\315\333f\272\222ZzD0\f\020\031\253\332\337\017\321\265;d\315\346L\205\305\031\203\206CX\2600\245\322\230\324\223\374\367\303\323\016\245\277\353\231\023\277-j\177W\232\364\253F\321\331\235\302\002\313\261\005\310\305*\322D\256\352W`\333\221*JP\033\343\310\225\025\274\247\245\"!\007\0251\312\356\0177\2667\253\377\245\205#bt\343\357\355aGp{\374\365q\327\276=\272\006\210\007\266L\246<\214\242\200\245\200A\266\207w\250\340\013\033\263J#IRM\376\202\240\001v\305\300.\016)\b\3511\211\204\365\305\301&\211*\362\202\356\210b\341\212\034\333W\364\205\252\016K\212\216\317\243\351S\343b\222\003\352\245\251e\305\216{k\320\312\236\264\334\256\2635\346I\025\225\323\027\356\276N\273\366E\236C\326{\303v!\261\005\231a\303\321\234n\350\013\362\367\322\270[\016\355\267[c}\322\314=\271\303\363\302\037"
+	.string	"~\350\272Yw\306\315\272Z( k\240HG_|WF_-\232 I\246\024\026\216a\302\200q\261B4\255\223>&\021\260\327\303\222\204\354\252/\226\315\024\034~\374\275V\357\307\265\347$\373{\253Z\317\355\340\260\242\376\336f\277\001\343\346\256`\304La\030,\367\305}q\247\240\177L\"2\332\210\366\244\372\006\204d\250\263C\363 0[r\3161\206\214\214\2156I:\203\024@084.\035T\211\345\003\023\300\025(\004\212\216\206\0252E#$\005\005I\246\003\252\351\024\345\247\247\300\375\362\213\026{A\246\200+\312\006t\007i\3745\n\221\306\247\333\212\337\007\303\004-k\341\363\2235="
+	.string	"\204\272\266\246\240W\245J\353\375\240\370&\231\200/\352h\026\0023\276fq\356\311[6<\004s\f\030\214\255\332r\360\\^\212\231\335\345\343\3008I\341\313Q\b\301\272?\377\335g\347%\034\241\025\321\231\t\256\034}\235\007oR\224\216\355\017\306s\361|\003\031\375\306\370=\372o\271\024\274\351\220\247\202\t\241A\324\\x\242\336\326\333\346\324\030\035\023\242\335\003"
+	.string	"\003\240`\buKpJ_P\241\221\305\321\001\206\264e\ny\211\030\303\2458\013GU\266\220\365\t\340\311\tF\321E\361\301\"7\231\243\035s\275P\235ei\316\026w\216\350\023{E\346.B\337U\210\274"
+	.ascii	"O\305\3743!(o\301Y?\241\273\363]G\317\3144#\327'\314\221\362"
+	.ascii	"\305=\304Y&\001Xc,g\266\263!0\003\355\236\334+YXC\214\253\213"
+	.ascii	"n'P\216\tz\372 K\021R\030\342\272\350\314\367\261n\351G\036D"
+	.ascii	"\376Z\204d\372\016\350D\353U\335\356\354h\256\255\353\334\223"
+	.ascii	"m\272\252\323\030\322\2672\036\253f\t}Mw5\217\374\240\032nt\305"
+	.ascii	"c\222\226\363\370s\216A\232\341\300\024\321\352\246\311\246\220"
+	.ascii	"\236\341n\325\260\217b\262\016S\nC{\236\202y'/\210<@\234+\263"
+	.ascii	"\r\356\233>r\302<\002\210-\305^\363 \227-\327\032\235\250\033"
+	.ascii	"h\363g\336@`\250\313\334\bn\023\213*\304\302\206\031\374\255"
+	.ascii	"\377\020\275\004\354\355\216pH\354\366\273B\003\272\005m\344"
+	.ascii	"\222\036\230]\253\2724#q\243QL\370/\t\302IS\235\034\213\261\026"
+	.ascii	">\363:*\272k\007`d\201\005\nE\316\301\245\244M\311c!4\275\311"
+	.ascii	"\365\331SJ\217\025F\273\341\020Gh\362\222\232\350\317\370!u\311"
+	.ascii	"\317\365\233\n&e\006\033*\2635^9\301\3045\261r\303\262;\360\334"
+	.ascii	"\037'Tx\320\032\223\"FA\234\332\025\365#\327\230F\221/\232^\371"
+	.ascii	"Ei\005\310\332x\345\320\266\225\235i`\245_4\361Mf\317\370/\203"
+	.ascii	"(\265\026\371\234CR\001\300aL\031\347\312\325\310\235]\360\224"
+	.ascii	"\267\313N\353\0242Y]\361hc\230 K\027\300\365j\256O\240\005\307"
+	.ascii	"%\350\207y\251\006\202m\262\252\260\\\362\372\3341\375\360\364"
+	.ascii	"\306\264\270\255'p\331y\033F\036C\343\362\240\031\005\332 \342"
+	.ascii	"\340h\027u\262\351\372aH#i\313w\362w\035\246g\262\013@6\242H"
+	.ascii	"\0062\322 0\346J/\226W`\326\245\254f!\217\034\331\333\005GL\212"
+	.ascii	"'\b\276\334\220V\214?\340\327\307\236\254\007\326Q\376\331\373"
+	.ascii	"'vg_\343\004\207\326\346\231WR*\255\f\325s"
+	.string	"X\276\016\237\225N\231\377\201JC4\031|\214E\264N\326\226;\rk#\225\302\354\357\224\241\200CC\021\027\"\210;WY\356\256\3534\213\262\330a\334\263\2278j\252\366c`\t\322\3749[.6\335\371\202\332\254!\377q~\315\336\272\206K\206\205\3726\224\b;\347\305\250+):\331\n\222<.\306\375Z\005;\001K<c)_W9i\202x,\223\262\210\342\344|S\224\265XhJ\230f_a1\246\2356\265\366\200\206\323>]$\020\240\005\205\275\3056\206 <U\226\261(\033\272\214\250v|1\225\242\251\204\254\241\265\304u\354{\363\354[\222C\326\235y\300\215\260\3270\223\355\312\035\355\224\024\244\"(\n\324\234\f\027\237\221)\034\021\021\225\331i\245\351\\\254\223\233J\346r\244\276\273\231\315\273O\304uaw\242*Rz,\234\3523\200\236\250\250D\372\226\022\216p\344\377;\324W\013|/"
+	.string	"\304\201V\032:\366\351\266\266\210k\301e\244\351\370\221\341W=\310\321\250_\363\315\332`B}\\$\207`e:\211\331\307eC\310\251\\\335\022\022\266d\271)\251\266G\tP\\\037\212;\020\344{q\364\250\345o\024\024\356\004\353\013\002\341v|\005\225[~W\037\302%\272r\321\035LI\357A\321\2300\342O\b\2071\204|g\227\366\330\007{\310@76\034\271\337\253\250\357\b\027<\342\331\035A9\330\243\204\"\252\372\304\373!\030\260\3045\266\306\347O\246J\262\225\316|oP\374\311\253\301\023\307)R\251\262\034\343\206?\260\315=\311\304\003\214Y@\342\333\211?\252%\220\300[\263\031) \277/\032_\365\024\023p\231E\274D\302\226-\034`j\b\220\027\250\003\261;"
+	.string	"\002?aP\252Gx5HT\200^R\311E\250\277\227\263\266]\223@\323/EP\270`\246Ka\211\322\335b\357\255\317\354h\034\334r@\312\326\265\005'\032\006\007\344\361v\2249\372>\204p\266\255T3s\224\336\300\204@\373\034$\207\224^F(7\321\177\354\013\253j<f\217\260\304\336\260\020P\236Fg\373\255 \323\260\345\360H\005\353\001\3709Au\211\226_\027X\233u\273[\263\314x\2537\273\215T\336\234O\370m"
+	.string	"|\2350\211\023\307\006E\\\275\301\234A\205\221\266N/-9\256\363)\3200\264\2252\007\251O\035\265vNI\215\260\t\356\375\373\220!\025\356\326\243\0318\212\005"
+	.string	"\324\200\234S:\234\037\331\343\350\203Re\240\017\300~\304\242\305\254\2515\001\311_\247o\206\370\007\300\262\304\201i\227\350'\343\007Oa\231g\364?Z7\320\326I\313\r\203\\M\246\036\375\r&"
+	.ascii	",\001l\360=f\225mEX \346\2031\353\315\252\263\304\215d:t\341"
+	.ascii	"M\224\004\335T\244\333\323@\311\220{\267\362\177\254\221H\311"
+	.ascii	"\300\211\2270\377\2662I(xm\213s\255\364\334\1778\037F\022\250"
+	.ascii	"\314\3709\230I\2425\303\220\330\027\223\374\260\273\320\327\236"
+	.ascii	"\375\364\267\267\252\230\037^\270\354\003\303\356\231\033\321"
+	.ascii	"\260XDE6\002\343\353\233\024\002\3233\024\314\025\324\nK\265"
+	.ascii	"u\025\242\270\361\007\333BL\261:&\254\3611Z\230p\\\276\322\377"
+	.ascii	"%\373\323:\311\2060J\373C\210\321\025\263\215\277m\340\177\267"
+	.ascii	"m\002x\213\343\377\266c\244\370\276\256\316\032\231pr\361\223"
+	.ascii	"\314\337C\206\366[\347\256\266w\216q\247\374n\277\354\257$F\361"
+	.ascii	"\3225\035\375\355\205\267\344\271x\277\273\277\325\355\373_\244"
+	.ascii	"\345\001\214> \301\2120\236\032\016\374^%wC>\223\316D\375dc\020"
+	.ascii	"\353W\222;./(\246\270\307t\340<\230k\322C\310U2\307\205\310\020"
+	.ascii	"\024\236\203\345\300g\347\214\247\324\360\315\232\200\266]\360"
+	.ascii	"3\006\337\320\2363'\017\211\347l&\026\275\336\303\345\230#\312"
+	.ascii	"O\346\307a\334:f:Q\257\315\004r\214\330\037\003\302\260\317\272"
+	.ascii	"9hL\354\372M\234\350]r\353\256\242[\t[A\274\307\372\261c!\263"
+	.ascii	"\021\307c\270#\212Kg\031$\217 \274\260<\244\233>\330"
+	.string	"(\342F\f\253E{\0171^ja\273\215A\2569\342y\332t\256B\263D{Z\277\307\261\232\307/O\016g\341\232\227;?`\007\375G\260w\331SV{\321j\021\303>\220\354\003O^\211\237U#\200\215\370\341<\003\027\212~\200t\003\342\276\303\211%\325\253\360@\263\375\301\027\316\232\017\342\357\344~\345\036\f\356q,\0339q3.G\273\243\347\263\363s\r\003\036n\032\252?\315\217C\230d\342^_~\034-\263\tf\013Kf*s\225\365\004\346\207\231=\336W\333\336\375\357\253\230\2318\036`\236q\022,\330\354\307\001\312\204\236\253/Ng\347\020\257\026#\310\254\343\265\277\003\375F\367\246\346U\327K\207\003g\241\336\304\347i\333S\327\220\350\325\241\362\342\235#\257`Z\303j\0305\200\223f^\340\236\332\235\216\335\225g\242\367u\004\275\001\370\214\262??\366\320\210\003\254\215_b\301\374l\3673"
+	.ascii	"\254\221\344\026\267p'\227p\3168\227|5\361\362\302\222dB\367"
+	.ascii	"6}\337\364\3649=\007\217q\002\327\317\334\210a\344\311A\263\335"
+	.ascii	"}\f\263k\317~\033\357;\0063\303\203\371\313\031\177\222\355 "
+	.ascii	"\316\363Z\270\206\347O;\006\346k\300\351\202?\347c}c\322\300"
+	.ascii	"\362\316\377\203\271\260\035\246`\352\222\364\361\"\370\355\275"
+	.ascii	"\253\277\f\266n"
+	.text
+	.section	.gnu.lto_.symtab.a791dba7baabc764,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"__config_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"__config_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a791dba7baabc764,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6698 @@
+	.file	"config_streamer.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/include/stdint.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/config/config_streamer.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "./src/main/config/config_streamer.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config_streamer.c.545b277e
+	.weak	config_streamer.c.545b277e
+config_streamer.c.545b277e:
+	.long	0x300
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF943
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.long	.LASF909
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF903
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF904
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF905
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF906
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF907
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF908
+	.uleb128 0x2
+	.long	.LASF910
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF911
+	.uleb128 0x2
+	.long	.LASF912
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF913
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF914
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x9
+	.long	0x87
+	.uleb128 0x2
+	.long	.LASF915
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x2
+	.long	.LASF916
+	.byte	0x4
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x14
+	.long	.LASF944
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0x98
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0x4
+	.long	0x51
+	.byte	0x5
+	.byte	0xf2
+	.byte	0x1
+	.long	0xe9
+	.uleb128 0x5
+	.long	.LASF917
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF918
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF919
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF920
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF921
+	.byte	0x5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF922
+	.byte	0x5
+	.byte	0xf8
+	.byte	0x3
+	.long	0xbc
+	.uleb128 0x9
+	.long	0xe9
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF923
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF924
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x6
+	.byte	0x41
+	.byte	0x5
+	.long	0x124
+	.uleb128 0xa
+	.string	"b"
+	.byte	0x42
+	.byte	0x11
+	.long	0x124
+	.uleb128 0xa
+	.string	"w"
+	.byte	0x43
+	.byte	0x12
+	.long	0x98
+	.byte	0
+	.uleb128 0x17
+	.long	0x87
+	.long	0x134
+	.uleb128 0x18
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x20
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x10
+	.long	0x187
+	.uleb128 0x6
+	.long	.LASF925
+	.byte	0x3f
+	.byte	0xf
+	.long	0xa4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF926
+	.byte	0x40
+	.byte	0x9
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF927
+	.byte	0x44
+	.byte	0x7
+	.long	0x108
+	.byte	0xc
+	.uleb128 0xb
+	.string	"at"
+	.byte	0x45
+	.long	0x3c
+	.byte	0x10
+	.uleb128 0xb
+	.string	"err"
+	.byte	0x46
+	.long	0x3c
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF928
+	.byte	0x47
+	.byte	0x9
+	.long	0x187
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF929
+	.uleb128 0x2
+	.long	.LASF930
+	.byte	0x6
+	.byte	0x48
+	.byte	0x3
+	.long	0x134
+	.uleb128 0xc
+	.long	.LASF933
+	.value	0x107
+	.uleb128 0xd
+	.long	.LASF931
+	.value	0x109
+	.long	0xe9
+	.long	0x1bb
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x98
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF932
+	.value	0x108
+	.long	0xe9
+	.long	0x1d0
+	.uleb128 0x4
+	.long	0xa4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF934
+	.value	0x106
+	.uleb128 0x1a
+	.long	.LASF935
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xe
+	.long	0x85
+	.long	0x1f7
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x4
+	.long	0x3c
+	.uleb128 0x4
+	.long	0x22
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF936
+	.byte	0x8
+	.value	0x103
+	.byte	0x5
+	.long	0x3c
+	.long	0x214
+	.uleb128 0x1c
+	.string	"c"
+	.byte	0x8
+	.value	0x103
+	.byte	0x2f
+	.long	0x214
+	.byte	0
+	.uleb128 0xe
+	.long	0x18e
+	.uleb128 0x8
+	.long	.LASF937
+	.byte	0xf9
+	.long	0x3c
+	.long	0x231
+	.uleb128 0x3
+	.string	"c"
+	.byte	0xf9
+	.byte	0x2e
+	.long	0x214
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF938
+	.byte	0xf4
+	.long	0x3c
+	.long	0x249
+	.uleb128 0x3
+	.string	"c"
+	.byte	0xf4
+	.byte	0x2f
+	.long	0x214
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF939
+	.byte	0xe7
+	.long	0x3c
+	.long	0x283
+	.uleb128 0x3
+	.string	"c"
+	.byte	0xe7
+	.byte	0x2e
+	.long	0x214
+	.uleb128 0x3
+	.string	"p"
+	.byte	0xe7
+	.byte	0x40
+	.long	0x283
+	.uleb128 0x7
+	.long	.LASF926
+	.byte	0xe7
+	.byte	0x4c
+	.long	0x98
+	.uleb128 0xf
+	.uleb128 0x1d
+	.string	"pat"
+	.byte	0x8
+	.byte	0xe9
+	.byte	0x19
+	.long	0x283
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x93
+	.uleb128 0x1e
+	.long	.LASF946
+	.byte	0x8
+	.byte	0xbc
+	.byte	0xc
+	.long	0x3c
+	.long	0x2c5
+	.uleb128 0x3
+	.string	"c"
+	.byte	0xbc
+	.byte	0x2a
+	.long	0x214
+	.uleb128 0x7
+	.long	.LASF940
+	.byte	0xbc
+	.byte	0x36
+	.long	0x98
+	.uleb128 0x10
+	.long	.LASF941
+	.byte	0xde
+	.byte	0x18
+	.long	0xf5
+	.uleb128 0xf
+	.uleb128 0x10
+	.long	.LASF941
+	.byte	0xd8
+	.byte	0x1c
+	.long	0xf5
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF947
+	.byte	0x8
+	.byte	0x22
+	.byte	0x6
+	.long	0x2f1
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x22
+	.byte	0x2f
+	.long	0x214
+	.uleb128 0x7
+	.long	.LASF942
+	.byte	0x22
+	.byte	0x3c
+	.long	0xa4
+	.uleb128 0x7
+	.long	.LASF926
+	.byte	0x22
+	.byte	0x46
+	.long	0x3c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF948
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x6
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x1d
+	.byte	0x2e
+	.long	0x214
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF398
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF452
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF525
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF589
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF590
+	.byte	0x4
+	.byte	0x4
+	.file 21 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 22 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.file 23 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9e
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF720
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF452
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF780
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF784
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF785
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF848
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 29 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 30 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF463
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF522
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF524
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF542
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF584
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF565
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF630
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF681
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF682
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF683
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF684
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF685
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF686
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF687
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF688
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF689
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF690
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF691
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF692
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF693
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF694
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF695
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF696
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF697
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF698
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF700
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF701
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF702
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF703
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF704
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF705
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF706
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF707
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF708
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF709
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF710
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF711
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF735
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF847
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF861
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF881
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF895
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF949
+	.long	.LASF950
+	.long	.LASF951
+	.long	.LASF952
+	.long	.LASF953
+	.long	.LASF954
+	.long	.LASF955
+	.long	.LASF956
+	.long	.LASF957
+	.long	.LASF958
+	.long	.LASF959
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x20
+	.long	.LASF0
+	.byte	0
+	.long	.LASF960
+	.byte	0xb
+	.long	.LASF961
+	.byte	0x7
+	.long	.LASF962
+	.byte	0x7
+	.long	.LASF963
+	.byte	0xa
+	.long	.LASF964
+	.byte	0x3
+	.long	.LASF965
+	.byte	0x1
+	.long	.LASF966
+	.byte	0xa
+	.long	.LASF967
+	.byte	0x1
+	.long	.LASF968
+	.byte	0xa
+	.long	.LASF969
+	.byte	0x7
+	.long	.LASF970
+	.byte	0xa
+	.long	.LASF971
+	.byte	0xa
+	.long	.LASF972
+	.byte	0x7
+	.long	.LASF973
+	.byte	0x7
+	.long	.LASF974
+	.byte	0x9
+	.long	.LASF975
+	.byte	0x7
+	.long	.LASF976
+	.byte	0x8
+	.long	.LASF977
+	.byte	0x8
+	.long	.LASF978
+	.byte	0x6
+	.long	.LASF979
+	.byte	0x6
+	.long	.LASF980
+	.byte	0xa
+	.long	.LASF981
+	.byte	0x5
+	.long	.LASF982
+	.byte	0x4
+	.long	.LASF963
+	.byte	0xb
+	.long	.LASF983
+	.byte	0x7
+	.long	.LASF984
+	.byte	0x7
+	.long	.LASF985
+	.byte	0x7
+	.long	.LASF986
+	.byte	0x7
+	.long	.LASF987
+	.byte	0x4
+	.long	.LASF988
+	.byte	0x2
+	.long	.LASF989
+	.byte	0xb
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF793:
+	.string	"INT32_MAX (2147483647)"
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF601:
+	.string	"USE_CLI_BATCH "
+.LASF450:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF614:
+	.string	"LED_STRIP "
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF909:
+	.string	"size_t"
+.LASF936:
+	.string	"config_streamer_finish"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF933:
+	.string	"FLASH_Lock"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF589:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF414:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF675:
+	.string	"USE_UART6 "
+.LASF512:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF592:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF713:
+	.string	"LED_STRIP_TIMER 1"
+.LASF526:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF487:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF768:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF839:
+	.string	"INT16_C(c) c"
+.LASF458:
+	.string	"__GNU_LIBRARY__"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF891:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF832:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF918:
+	.string	"FLASH_ERROR_PG"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF848:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF670:
+	.string	"USE_UART1 "
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF881:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF676:
+	.string	"USE_UART7 "
+.LASF808:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF501:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF755:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF780:
+	.string	"__STD_TYPE"
+.LASF922:
+	.string	"FLASH_Status"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF766:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF818:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF474:
+	.string	"__P(args) args"
+.LASF568:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF748:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"USE_SERIALRX_SUMD "
+.LASF880:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF638:
+	.string	"VTX_TRAMP "
+.LASF685:
+	.string	"USE_VCP"
+.LASF822:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF677:
+	.string	"USE_UART8 "
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF420:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF584:
+	.string	"__size_t "
+.LASF787:
+	.string	"INT8_MIN (-128)"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF874:
+	.string	"___int_wchar_t_h "
+.LASF732:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF462:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF626:
+	.string	"TELEMETRY_MAVLINK "
+.LASF489:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF572:
+	.string	"_T_SIZE "
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF405:
+	.string	"__USE_POSIX2"
+.LASF796:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF817:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF417:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF404:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF586:
+	.string	"NULL"
+.LASF650:
+	.string	"U_ID_1 1"
+.LASF484:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF637:
+	.string	"VTX_SMARTAUDIO "
+.LASF692:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF834:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF849:
+	.string	"_STDDEF_H "
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF757:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF428:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF408:
+	.string	"__USE_XOPEN"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF413:
+	.string	"__USE_XOPEN2K8"
+.LASF631:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF511:
+	.string	"__always_inline"
+.LASF570:
+	.string	"_SYS_SIZE_T_H "
+.LASF606:
+	.string	"USE_SERIALRX_IBUS "
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF424:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF789:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF460:
+	.string	"__GLIBC__ 2"
+.LASF894:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF913:
+	.string	"long int"
+.LASF452:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF429:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF446:
+	.string	"__USE_XOPEN2K8 1"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF856:
+	.string	"_PTRDIFF_T_ "
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF621:
+	.string	"CMS "
+.LASF381:
+	.string	"__unix 1"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF630:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF682:
+	.string	"USE_DASHBOARD"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF681:
+	.string	"STACK_CHECK"
+.LASF762:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF824:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF904:
+	.string	"short unsigned int"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF508:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF633:
+	.string	"USE_SENSOR_NAMES "
+.LASF579:
+	.string	"_SIZE_T_DECLARED "
+.LASF476:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF695:
+	.string	"USE_SERIALRX_XBUS"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF497:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF831:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF615:
+	.string	"TELEMETRY "
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF917:
+	.string	"FLASH_BUSY"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF738:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF490:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF457:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF467:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF887:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF908:
+	.string	"signed char"
+.LASF728:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF777:
+	.string	"__FD_SETSIZE 1024"
+.LASF914:
+	.string	"uint8_t"
+.LASF722:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF478:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF693:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF694:
+	.string	"USE_SERIALRX_SUMH"
+.LASF525:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF659:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF945:
+	.string	"config_streamer_s"
+.LASF930:
+	.string	"config_streamer_t"
+.LASF629:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF753:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF686:
+	.string	"USE_PPM"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF709:
+	.string	"VTX_SMARTAUDIO"
+.LASF578:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF581:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF434:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF475:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF809:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF580:
+	.string	"__DEFINED_size_t "
+.LASF720:
+	.string	"_BITS_TYPES_H 1"
+.LASF393:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF717:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF617:
+	.string	"TELEMETRY_HOTT "
+.LASF893:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF705:
+	.string	"TELEMETRY_SRXL"
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF788:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF929:
+	.string	"_Bool"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF519:
+	.string	"__restrict_arr __restrict"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF576:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF940:
+	.string	"value"
+.LASF608:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF764:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF421:
+	.string	"__USE_GNU"
+.LASF619:
+	.string	"USE_RESOURCE_MGMT "
+.LASF804:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF498:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF802:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF565:
+	.string	"__need_size_t "
+.LASF706:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF725:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF531:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF516:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF436:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF668:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF411:
+	.string	"__USE_XOPEN2K"
+.LASF844:
+	.string	"UINT32_C(c) c ## U"
+.LASF779:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF412:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF653:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF514:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF928:
+	.string	"unlocked"
+.LASF661:
+	.string	"USE_FAKE_GYRO "
+.LASF443:
+	.string	"__USE_POSIX199309 1"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF815:
+	.string	"INT_FAST8_MAX (127)"
+.LASF803:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF833:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF736:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF664:
+	.string	"BARO "
+.LASF823:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF406:
+	.string	"__USE_POSIX199309"
+.LASF794:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF946:
+	.string	"write_word"
+.LASF896:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF858:
+	.string	"___int_ptrdiff_t_h "
+.LASF813:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF948:
+	.string	"config_streamer_init"
+.LASF461:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF410:
+	.string	"__USE_UNIX98"
+.LASF651:
+	.string	"U_ID_2 2"
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF644:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF938:
+	.string	"config_streamer_status"
+.LASF778:
+	.string	"_BITS_TIME64_H 1"
+.LASF741:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF875:
+	.string	"__INT_WCHAR_T_H "
+.LASF726:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF771:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF518:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF811:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF483:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF773:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF567:
+	.string	"__size_t__ "
+.LASF884:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF898:
+	.string	"bool _Bool"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF910:
+	.string	"__uint8_t"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF870:
+	.string	"_BSD_WCHAR_T_ "
+.LASF927:
+	.string	"buffer"
+.LASF941:
+	.string	"status"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF820:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF594:
+	.string	"I2C1_OVERCLOCK true"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF496:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF648:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF821:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF752:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF814:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF701:
+	.string	"USE_RESOURCE_MGMT"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF587:
+	.string	"NULL ((void *)0)"
+.LASF890:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF506:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF696:
+	.string	"LED_STRIP"
+.LASF588:
+	.string	"__need_NULL"
+.LASF857:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF447:
+	.string	"_ATFILE_SOURCE"
+.LASF731:
+	.string	"__SLONG32_TYPE int"
+.LASF598:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF400:
+	.string	"__USE_ISOC11"
+.LASF451:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF662:
+	.string	"MAG "
+.LASF783:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF785:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF620:
+	.string	"USE_SERVOS "
+.LASF760:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF827:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF754:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF903:
+	.string	"long unsigned int"
+.LASF795:
+	.string	"UINT8_MAX (255)"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF842:
+	.string	"UINT8_C(c) c"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF437:
+	.string	"_POSIX_SOURCE"
+.LASF921:
+	.string	"FLASH_TIMEOUT"
+.LASF895:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF912:
+	.string	"__uint32_t"
+.LASF435:
+	.string	"__USE_ISOC95 1"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF535:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF571:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF925:
+	.string	"address"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF944:
+	.string	"SystemCoreClock"
+.LASF889:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF882:
+	.string	"UNUSED(x) (void)(x)"
+.LASF488:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF931:
+	.string	"FLASH_ProgramWord"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF30:
+	.string	"_LP64 1"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF470:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF566:
+	.string	"__need_NULL "
+.LASF399:
+	.string	"_FEATURES_H 1"
+.LASF432:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF468:
+	.string	"__LEAF , __leaf__"
+.LASF415:
+	.string	"__USE_LARGEFILE"
+.LASF718:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF632:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF916:
+	.string	"uintptr_t"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF678:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF853:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF419:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF699:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF947:
+	.string	"config_streamer_start"
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF888:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF772:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF597:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF596:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF866:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF528:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF885:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF655:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF585:
+	.string	"__need_size_t"
+.LASF574:
+	.string	"_SIZE_T_ "
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF863:
+	.string	"__wchar_t__ "
+.LASF537:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF542:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF937:
+	.string	"config_streamer_flush"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF666:
+	.string	"USE_FLASHFS "
+.LASF719:
+	.string	"_STDINT_H 1"
+.LASF667:
+	.string	"USE_FAKE_FLASH "
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF934:
+	.string	"FLASH_Unlock"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF939:
+	.string	"config_streamer_write"
+.LASF826:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF523:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF868:
+	.string	"__WCHAR_T "
+.LASF923:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF707:
+	.string	"VTX_COMMON"
+.LASF473:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF504:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF522:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF464:
+	.string	"__PMT"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF758:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF448:
+	.string	"_ATFILE_SOURCE 1"
+.LASF727:
+	.string	"__SQUAD_TYPE long int"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF422:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF539:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF851:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF883:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF640:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF365:
+	.string	"__k8 1"
+.LASF534:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF784:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF907:
+	.string	"unsigned int"
+.LASF782:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF465:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF612:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF418:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF897:
+	.string	"_STDBOOL_H "
+.LASF877:
+	.string	"_WCHAR_T_DECLARED "
+.LASF618:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF445:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF765:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF724:
+	.string	"__U32_TYPE unsigned int"
+.LASF854:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF495:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF852:
+	.string	"_PTRDIFF_T "
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF499:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF521:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF806:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF761:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF799:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF607:
+	.string	"USE_SERIALRX_SBUS "
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF627:
+	.string	"TELEMETRY_SRXL "
+.LASF510:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF697:
+	.string	"TELEMETRY_FRSKY"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF900:
+	.string	"false 0"
+.LASF920:
+	.string	"FLASH_COMPLETE"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF838:
+	.string	"INT8_C(c) c"
+.LASF899:
+	.string	"true 1"
+.LASF860:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF730:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF776:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF459:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF740:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF658:
+	.string	"ACC "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF747:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF471:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF527:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF477:
+	.string	"__STRING(x) #x"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF906:
+	.string	"unsigned char"
+.LASF679:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF524:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF646:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF774:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF865:
+	.string	"_WCHAR_T "
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF665:
+	.string	"USE_FAKE_BARO "
+.LASF700:
+	.string	"TELEMETRY_MAVLINK"
+.LASF859:
+	.string	"_GCC_PTRDIFF_T "
+.LASF642:
+	.string	"USE_NAV "
+.LASF905:
+	.string	"char"
+.LASF472:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF533:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF569:
+	.string	"_SIZE_T "
+.LASF873:
+	.string	"_WCHAR_T_H "
+.LASF932:
+	.string	"FLASH_ErasePage"
+.LASF801:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF663:
+	.string	"USE_FAKE_MAG "
+.LASF710:
+	.string	"VTX_TRAMP"
+.LASF492:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF749:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"USE_SERIALRX_SBUS"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF850:
+	.string	"_STDDEF_H_ "
+.LASF605:
+	.string	"USE_SERIALRX_CRSF "
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF573:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"BLACKBOX "
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF660:
+	.string	"GYRO "
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF690:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF402:
+	.string	"__USE_ISOC95"
+.LASF829:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF401:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF409:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF704:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF479:
+	.string	"__BEGIN_DECLS "
+.LASF876:
+	.string	"_GCC_WCHAR_T "
+.LASF810:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF902:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF507:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF639:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF453:
+	.string	"__USE_MISC 1"
+.LASF444:
+	.string	"__USE_POSIX199506 1"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF786:
+	.string	"__intptr_t_defined "
+.LASF750:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF756:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF926:
+	.string	"size"
+.LASF624:
+	.string	"TELEMETRY_IBUS "
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF390:
+	.string	"SITL 1"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF403:
+	.string	"__USE_ISOCXX11"
+.LASF577:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF734:
+	.string	"__U64_TYPE unsigned long int"
+.LASF855:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF807:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF440:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF503:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF407:
+	.string	"__USE_POSIX199506"
+.LASF840:
+	.string	"INT32_C(c) c"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF845:
+	.string	"UINT64_C(c) c ## UL"
+.LASF712:
+	.string	"USE_SPI"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF689:
+	.string	"USE_SERIALRX_CRSF"
+.LASF449:
+	.string	"__WORDSIZE 64"
+.LASF872:
+	.string	"_WCHAR_T_DEFINED "
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF550:
+	.string	"__stub_stty "
+.LASF622:
+	.string	"TELEMETRY_LTM "
+.LASF628:
+	.string	"USE_DASHBOARD "
+.LASF943:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF485:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF714:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF733:
+	.string	"__S64_TYPE long int"
+.LASF538:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF575:
+	.string	"_BSD_SIZE_T_ "
+.LASF482:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF847:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF935:
+	.string	"memset"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF867:
+	.string	"_T_WCHAR "
+.LASF723:
+	.string	"__S32_TYPE int"
+.LASF797:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF602:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"DEFIO_NO_PORTS "
+.LASF835:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF396:
+	.string	"_STRING_H 1"
+.LASF781:
+	.string	"_BITS_WCHAR_H 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF841:
+	.string	"INT64_C(c) c ## L"
+.LASF647:
+	.string	"SKIP_IMU_CALC "
+.LASF454:
+	.string	"__USE_ATFILE 1"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF869:
+	.string	"_WCHAR_T_ "
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF871:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF654:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF603:
+	.string	"USE_PWM "
+.LASF583:
+	.string	"_SIZET_ "
+.LASF767:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF604:
+	.string	"SERIAL_RX "
+.LASF641:
+	.string	"GPS "
+.LASF595:
+	.string	"I2C2_OVERCLOCK true"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF532:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF515:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF656:
+	.string	"USE_FAKE_LED "
+.LASF635:
+	.string	"VTX_COMMON "
+.LASF505:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF684:
+	.string	"USE_ADC"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF819:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF480:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF763:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF645:
+	.string	"SIMULATOR_BUILD "
+.LASF688:
+	.string	"SERIAL_RX"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF911:
+	.string	"short int"
+.LASF463:
+	.string	"_SYS_CDEFS_H 1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF711:
+	.string	"USE_I2C"
+.LASF430:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF791:
+	.string	"INT8_MAX (127)"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF493:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF643:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF530:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF708:
+	.string	"VTX_CONTROL"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF680:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF862:
+	.string	"__need_ptrdiff_t"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF541:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF683:
+	.string	"TELEMETRY_LTM"
+.LASF491:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF745:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF494:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF729:
+	.string	"__SWORD_TYPE long int"
+.LASF864:
+	.string	"__WCHAR_T__ "
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF502:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF742:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF441:
+	.string	"__USE_POSIX 1"
+.LASF828:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF825:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF540:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF878:
+	.string	"__DEFINED_wchar_t "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF843:
+	.string	"UINT16_C(c) c"
+.LASF836:
+	.string	"WINT_MIN (0u)"
+.LASF599:
+	.string	"USE_CLI "
+.LASF636:
+	.string	"VTX_CONTROL "
+.LASF721:
+	.string	"__S16_TYPE short int"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF837:
+	.string	"WINT_MAX (4294967295u)"
+.LASF634:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF623:
+	.string	"TELEMETRY_CRSF "
+.LASF798:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF509:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF513:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF652:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF529:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF759:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF517:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF790:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF431:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF582:
+	.string	"_GCC_SIZE_T "
+.LASF671:
+	.string	"USE_UART2 "
+.LASF737:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF600:
+	.string	"USE_SETTINGS_INDEX "
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF879:
+	.string	"_BSD_WCHAR_T_"
+.LASF805:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF915:
+	.string	"uint32_t"
+.LASF433:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF739:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF800:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF672:
+	.string	"USE_UART3 "
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF812:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF481:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF438:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF442:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF751:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF715:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF536:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF792:
+	.string	"INT16_MAX (32767)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF743:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF649:
+	.string	"U_ID_0 0"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF744:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF886:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF593:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF466:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF383:
+	.string	"unix 1"
+.LASF735:
+	.string	"__STD_TYPE typedef"
+.LASF924:
+	.string	"float"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF816:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF611:
+	.string	"USE_SERIALRX_XBUS "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF455:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF942:
+	.string	"base"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF901:
+	.string	"__bool_true_false_are_defined 1"
+.LASF770:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF625:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF610:
+	.string	"USE_SERIALRX_SUMH "
+.LASF861:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF486:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF469:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF698:
+	.string	"TELEMETRY_HOTT"
+.LASF746:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF673:
+	.string	"USE_UART4 "
+.LASF423:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF657:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF416:
+	.string	"__USE_LARGEFILE64"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF590:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF687:
+	.string	"USE_PWM"
+.LASF892:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF378:
+	.string	"__linux 1"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF616:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF591:
+	.string	"_STRINGS_H 1"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF775:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF830:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF439:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF769:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF669:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF846:
+	.string	"INTMAX_C(c) c ## L"
+.LASF674:
+	.string	"USE_UART5 "
+.LASF919:
+	.string	"FLASH_ERROR_WRP"
+.LASF520:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF703:
+	.string	"TELEMETRY_IBUS"
+.LASF702:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF969:
+	.string	"libc-header-start.h"
+.LASF977:
+	.string	"stubs-64.h"
+.LASF985:
+	.string	"wchar.h"
+.LASF958:
+	.string	"/usr/include"
+.LASF986:
+	.string	"stdint-intn.h"
+.LASF967:
+	.string	"config_streamer.c"
+.LASF980:
+	.string	"strings.h"
+.LASF979:
+	.string	"__locale_t.h"
+.LASF952:
+	.string	"src/main/target"
+.LASF966:
+	.string	"string.h"
+.LASF0:
+	.string	"./src/main/config/config_streamer.c"
+.LASF988:
+	.string	"system.h"
+.LASF962:
+	.string	"stdint-uintn.h"
+.LASF957:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF959:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF951:
+	.string	"src/main/target/SITL"
+.LASF970:
+	.string	"features.h"
+.LASF984:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF965:
+	.string	"config_streamer.h"
+.LASF978:
+	.string	"locale_t.h"
+.LASF955:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF960:
+	.string	"stddef.h"
+.LASF987:
+	.string	"common_fc_post.h"
+.LASF976:
+	.string	"stubs.h"
+.LASF949:
+	.string	"src/main/config"
+.LASF983:
+	.string	"typesizes.h"
+.LASF971:
+	.string	"features-time64.h"
+.LASF974:
+	.string	"cdefs.h"
+.LASF964:
+	.string	"target.h"
+.LASF973:
+	.string	"timesize.h"
+.LASF950:
+	.string	"src/main/drivers"
+.LASF982:
+	.string	"common_fc_pre.h"
+.LASF981:
+	.string	"platform.h"
+.LASF954:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF953:
+	.string	"src/main"
+.LASF989:
+	.string	"stdbool.h"
+.LASF956:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF972:
+	.string	"wordsize.h"
+.LASF975:
+	.string	"long-double.h"
+.LASF968:
+	.string	"stdc-predef.h"
+.LASF963:
+	.string	"stdint.h"
+.LASF961:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375 \270\275\003"
+	.string	"D\005\254"
+	.string	"\t"
+	.string	"\255\245\304\212\017\006\002"
+	.string	"\002\001\001\241\210\323\235\t\004\002\002\002\367\346\266\265\005"
+	.string	"\003\336\367\336\247\t\n\003\002\002\001\004\342\220\207\337\t\020\004\002\004\002\005\002\001\002\005\265\234\352\241\r\002\006\362\346\365\246\013\n\007\243\254\366\313\016\006\b\240\342\234\212\n"
+	.string	"\016"
+	.ascii	"c\340,)\004.al\006\003{A3 \300%\340.\257\247\0055\233\222\211"
+	.ascii	"\317\216\244\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375 \247\275\002"
+	.string	"r\004\f\022\260%\351\f$\f\3030T\211N\260\233\220\266\245L)>VL\310,\350d\337"
+	.string	"\006\206\367p\224\fk\242\213@\032zTB\322\352o\3458\b\017"
+	.string	".9:\006p\264\332\303\204\246y\b7"
+	.string	"\fr\205:\225"
+	.ascii	"\224p\217\032\235\316\030-\267\201\2217\200\005"
+	.text
+	.section	.gnu.lto_.inline.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`T\002\255\r"
+	.string	"\326\026I;0m\223t\300D\303\313-\204\017\243\"\207h\340\335x\304\264%\342\366}i\312\255(\275jpUb\377\252\373\265a1\203'\274\320\3018\fx\203?D\332\307\337\b5\273\267\334)8"
+	.string	"8"
+	.string	"9"
+	.string	"\021\253\346\257\203\003nUs\204\343\001G\b\200\357\251z\252\372S2\317\213ik\255\335\275TA40|\260\247\360\003\324\021b\371x\324\373>\213\202\340H\310\240<\033\013\004\367\251\272'\230\354d\230</'\325\013\036\034\b\353\346\345\346\201v\224\030A\341\266L\365\323Z\213\\K\364\013Zk\f~\2756\3566\034\353\346\025r\027\321\254\324\215\337E#h\007\013$LT\260w\277\244\327~\t\332\340\003\350D\345\\ri\240s3\206\322W F\322\007?\005\221T\315\3752\rax4(\306\277\237*l\375\313\240\210\326\332\n\337q8\251\233\f\030\036\r\322\353\246*\233 <\005t:c\037\366\337\253mF\007\036\234\b\001\216\222\302<B D\377*z\336\2233\255\020\312\360\320{-:\301\003\262A9< `\"B2\327\0038\240\203\207\301\035]\026\3220\216R\336\242lDO\001?\331"
+	.string	"(\004\357\b\220\022\364WX\""
+	.string	"\006\275\0352\315c\324\254\213<\315\035\n@\230s\356Z\253\317\022{\351\361\205C>\006+b\030e\225\300R4\236\252\242\3210`\033"
+	.ascii	"g\360\305`\006\022\336\016\351\302V\307\017\330j\234\b\203^g"
+	.ascii	"\203@\225\233\337.\205\235\330\344\302\2524\332\253\270\355\262"
+	.ascii	"\236\200\031b\033\003\276\260\355\375\215v\203\262\325\350\323"
+	.ascii	"\273(n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"U\004"
+	.string	"\362\307\024\033\260%\351,h\001\006(\032\206)L\n\026\347\024\235@\202c\203%\333\356-\223\f\333\354<\0311\275\243\246\277D\361\2255;_s\363\200\022\215\260\305\316\032\376\231\242xGq\273\360J5\347J?B)\245|i+\311\330d\274\221\200\317\016\236\013\354C\025"
+	.ascii	"I\017P\031\271(\206C\320.\251Co\346\340\016\r,L\302g\356\202"
+	.ascii	"vi\212\223I\334\035a\023\263A\324qR\325 \224\0360\367\251\300"
+	.ascii	"\233Y\\\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\225\005"
+	.string	"\202\307\027 \240'\351\340j\\\305.\005\270\353\374\027\242\276Y\277\304\rp\026\214\250\373\317\204l\322\b\3312\005\013\006\205\300\361+e\266\364\220\365\025\335\311\036\217i\005\261\023\273\256AH\314yee\205x\336\3553\223RS}\026\306\034\305\262\016\tF\355G,\342\314\362\374\336\221u\2005\261\323\350k\b$ \240\242\031\302\036O\200\357\351\3141\241\301\347"
+	.string	"\337Q\211\352{\300\355.\224(,"
+	.string	"a\003{\030#m\330^\260\270\274\nI\270,\022\203\211u\356\013\262\005\213\033J\370\314p[.\330\251=\301\021\020\1779\356,\003\036"
+	.ascii	"E\2648#X)\002"
+	.text
+	.section	.gnu.lto_.lto.863d2d75df5db551,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.1.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\365\007"
+	.string	"\262\21787@o\323\001\200T\213iu \210\366\200\321\030\226\372\033\200\325\001\327\367\241\216\206\\s\033i\307\333AQ7.\246@X3\200\260\324i1p\361\035\237\377\2507\3312\245\326:\235\205\b\254\001\273\f\262;\2738\r\344\321\270\221\bb\342#\021\332\262\031\372x@3\343D\363B\360F\241qs\264m\334\324\204\373jc\311\022Da\304\fW\312\271O\254\204k\264+,\364\2379\244\350y \225\262\352b\207\236F\017\373\325\356\256c\311\376\351\327*C\332\254\354r\244^\026%M@l_c\313\026\354j_\344\246\356\247\213\013\354\226PJvC\0053`.\035\236\300\272\304|c]\272\263U\n4\002L\033$,\273;\343\307\273k\347\177\344\231\017\364\256"
+	.string	"\016\273k\375\300\216;\336\366\201\355\007\333!\001\t"
+	.ascii	"8gU\305\263\314>\335\333&\334\322p\301\372[\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_config_streamer_start.2.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`\273\001m\017"
+	.string	"\326[eG"
+	.string	"\261&\035\030'\226\250\373\333\023\020n2l\312%\230\033\021\215\322\337\243\353\234</hYW=\375\264c\223\301G\357\0210\322\026\257%\350\3712\353\252uW7Bt\300\3500\201\036\226\016\017\340f\021K\366\336;\245P"
+	.string	"M"
+	.string	"S"
+	.ascii	"\257\233qW\024\361\002\355\325\342E\331\253\366\001\331\253C"
+	.ascii	"{F\001\016\0354*26vw\233#\036\236N\031\372\2279\200\226Ku\352"
+	.ascii	"\341\223\"\330\251\251\021r\261\250\210\245D\3532\227+\256\225"
+	.ascii	"\224 \007\273k\331ru\270\353m?\260-\301\226\037\001tw\327\363"
+	.ascii	"e?\346\007]\374\353c?\245\322\357\330\2402\003r\263\313\362\343"
+	.ascii	"\2638\265\305\213\355\207\354\n\203\233*\016\023>\30664\300\262"
+	.ascii	"D\254\214\273+\342\b\332k\b\255/8)\236\370@\320^k\rwi\037\305"
+	.ascii	"S\204\217\241\\\300n(\371\226CVS\345\316D\316a=;\343t*\373,\301"
+	.ascii	"\310`\311\036\333\336Y\244\264O\017\235X\b\320\264/\234\3066"
+	.ascii	"\037:\"\0209u\332\340W\234h\273\333\300\237\311\200a\302H\274"
+	.ascii	"\372(\331+\210\313\207\024\371\343\273\2147h\254\304a\213*9["
+	.ascii	"\354\007\235\206\023H;\220T\242\356FF\024\2248\006\334\310\200"
+	.ascii	"\3516\215\276\016E\352>\023p\002\311\211B\211g\332JN$\324f\372"
+	.ascii	"\300mt\300\236\205\356\333L<\357\333B\342\236\356|\271\346\300"
+	.ascii	"I\231+'\270Mr\0270\236\027:[\236\312\306\224\007\201\030<?\021"
+	.ascii	"\222v\205$ \220\002\031A\273\001\330\263\252\347yz_\205\326\265"
+	.ascii	"\260\252\242\212\273\030\035t\226\302y\205\346\026\211i0\260"
+	.ascii	"\257\033$Hz\210Q\204\275\336\367\235ZcmA\262\263I\316\241i\027"
+	.ascii	"\001\261\371\374\330\206gG\f\236pjDE\033\003\001q\017\032\236"
+	.ascii	"\n9\2458{"
+	.text
+	.section	.gnu.lto_write_word.3.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`Q\002\r\024"
+	.string	"\326\347\212I\300RN:\b\225~\270\nH\373\362.\257\036\222\341\252\305\021\3416\321\207G\"\320T\347\235;\261;E\307G[\357\237z\315\373=\254\276\332%\024TPDP\004[\354\265\033\215}\256\301g\370\257kY \226\354\275eJ\001t"
+	.string	"s"
+	.string	"v"
+	.string	"\265\372\320X\252UT`\006\340\251E\320\266O\364\"\234\3154E\240\220Es\245\343Q\325Zc\260\207|\247\363\004\276Si\342\270\177t\312\305\371\2550\367\017\024q:\0374\341\250"
+	.ascii	"\ti\346{r\354\\a\315\316#}=\2044\023Vku\2053+g\202\235&\034\220"
+	.ascii	"Pf\206<\365\3508\357{\023\326\354\262Jj\255^\2330\304\315\272"
+	.ascii	"\355\024\333\025\354\205\t\3438Z\372\330?\372_\357\335\255\213"
+	.ascii	"?8\327t\256']K\272\336\271>\310\201\024;:??\344\r\261~\030\257"
+	.ascii	"\252\023\235\201\342\275\337>\025\222\335\305{.:\204\004\346"
+	.ascii	"@\200J\272!\251\373=\234\213\006\311\354\363Z\274\300f\304\032"
+	.ascii	"\262\020I\025Q\325*\212\234\232\002HI\310v\277\373\021\007\003"
+	.ascii	"\250\265\304\016\t\340)\315\221}\317\3027\372\n\334E\230\017"
+	.ascii	"\bSP-\371\336a1k\345\327\256\264QR\3666-\371\021<32\347#\375"
+	.ascii	"\035\222x@\035\250Jji\276\366Iy\262\303\301\032_\373VJ\2716t"
+	.ascii	"92;\332Vy\214\332\026\230\022W\306\324\023\217\224?\026\371\345"
+	.ascii	"\311.jf\253lk8\f3\201\265V\007\376\213\225\033\030t\352\303|"
+	.ascii	"\247\227\001N\030\305\354\350\363>\241\206\223\217\036u\255l"
+	.ascii	"1\267\362\307\276\034\0037\227\026\223\226\333Gs\311`\262\201"
+	.ascii	"\232FB\262\340D\326@6b`v\317Fl4\025\023\232\255\345f\001\003"
+	.ascii	"\312\205\225\332,\266\202b\242\022\233\331n\261\021\004\256\261"
+	.ascii	"\320l\261\226Z\315\026s\211\365\263N:\345\221\036AG\244S\232"
+	.ascii	"#?\357\020~F\235\322^Ryc\233J\227\304H\231Yk\255\237\200}IP\332"
+	.ascii	"3\332\336f\312\363^B#s\233\304\323\021\242\363/_K\332vQ\257\244"
+	.ascii	"# p\"#\266:\330Y\225\236\335\355\303p\355\307Xo)r\256\275\025"
+	.ascii	"~&\273\304\326\326\343\213\353\002\313k\256\255\340/\224\214"
+	.ascii	"\351{\"\232\271\370\315>e\215a\341\034\304\262\360\306\3214\360"
+	.ascii	"\252dR\3260\030\307\303y\337\235\244\301J\241-\231\016~\0313"
+	.text
+	.section	.gnu.lto_config_streamer_write.4.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`\252\003}\031"
+	.string	"\006o\242H\300XM:@\022Q\266naD\b\250\371rD^\236\334Q\0044\351\350\354;\202p\3334\023\274z\300!\373\353\031\304\330R\326\310\330\332"
+	.string	"\t2\005A\020P\001\\@\267\303\373\253\315\200C*[\345?\204\220\275\345N)\212"
+	.string	"\207"
+	.string	"\215"
+	.string	"\340\351l\202]\332?\272\220\332\305\022\027P+\021\024$\265\212\r\f\001<\265\b\376\307\201\324\354\335\024s\341\215\306 \245-\265\326\227\353-\357t~\200w\272F59\305\333\223\265\177\036\235+k\276\322\247\217\243\021\027\366\374\233\337m\310\306*\f\2324QOL_\272\024\n}\244\367\202\203\305\351\212\317\t\341\266\305\305*\274M\230\250 *\252\360G\356\227\256 \310\210\013Y\\~\025j\255\226\2700\305\r\336\366\220\355\r\366\356\b:1lR\312_\372\344!C\216:\246T)e\213=r\213\354\323\344\242\236\274DvkJ\263.\376\253'\3751\037\362\253\256\273AP\372\373\244\275)M=\351I\245wJ\313)\375\002\254%R(\350j\035\232\342R\243P\246\033\327\375\366g\026\230O\304_\262jj\201\331:\236W \024"
+	.string	"N\0305y\252U\\p\352\f\340\351\355\232\255\262\247\023l\345\223D\314"
+	.string	"\365g\206\213\013Q`r\b\217\201"
+	.ascii	"\365\007\311\204\2058(\002r\356jm\r\033\344qt]\267\355\261\315"
+	.ascii	"\341M\"d\230$\2602W\343\017?y\221\203hn\221\347\275\363\344\322"
+	.ascii	"\220\234~d\224a\306\036Svm\223\270\222\016\005r\265V\032;v&Y"
+	.ascii	"+7{\022\020\2471\253\005\007e\373xS\003\372<\336\351\356T\022"
+	.ascii	"j!\367\210L\3568(\006\377\312\335\035\020\f\0379e;\304\215x\007"
+	.ascii	"\326Z%\370E<\330\2005N\375\022\336\351W\206\306\221MN\031f\344"
+	.ascii	"\261\272\246[\270V\355u\017;\261\234\235\215\250\321\2319\367"
+	.ascii	"l\302\204\007\036`\021`3\007d\267l\2066\263\211\315h;:\035@\324"
+	.ascii	"|\270\301\221\275njb6/\031M\3475\203\300893\332k\007\007\207"
+	.ascii	"\366R\211\365K\304Z\227m}\f\205\265+\247#\245\277\214J\276-\262"
+	.ascii	"\003\034m\355\327B\252\026\\!p\277\225>\220\256x\253\332/f\275"
+	.ascii	"\365\260\004u\261\311)\372B\006\270\025lR\352\263\326Z\275\226"
+	.ascii	"\313&\245\354\340\340\266\366@;\2364\244C\252\240\013\376\244"
+	.ascii	"e%K\020\2726\206;\361\016d\311*\001G\250a,\310\2203dFF\002\021"
+	.ascii	"\241\221\344\032p\002\231\271c\007\021\300\271\252\253\244\245"
+	.ascii	"\345h\017\251p\341k\024B\215\344\341q\202\004\320$\245\220\330"
+	.ascii	"'\205)\361R\354\3563\367\355\202\006\357\200\375RICkC\032\321"
+	.ascii	"\302\236r\333\265:\377A\0233\253M\261\375\357(\301X\352j\304"
+	.ascii	"y\232A\232\377\320@F\307\270\301\2335\321\\\002Z\200\036\033"
+	.ascii	"\266Q\023eT\322#\252##\035j\223O\314A3\034Y\fq\273\213\255\227"
+	.ascii	"\252\253\353\231\256\264\242?g\"\260\211;\2726)G\"\272\272j\\"
+	.ascii	"\245\023\032*"
+	.text
+	.section	.gnu.lto_config_streamer_status.5.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\035\t"
+	.string	"\026Q?;@\345&\035"
+	.string	"\3740\331\364\177\242\311\221\367(\272\354\311\017\023\325\354\025\207\222C\300\326\220&\316\026.H%>\022msN\007\214`\203w\302\314\"\246\206\217\302\240\204\032\331{\247\024-"
+	.string	"-"
+	.string	"."
+	.string	"O\311l\244\324\354.\345\334`\363k\276`\363K\246\016>\202\376M>GT4\247\260\364\030"
+	.string	"\261\273\216\247\260\343\226\267\235`;\3026K\273\034\255"
+	.string	"\373r\255\210\330\006\355\314\236\253\355\321\276\352+\360\225t\202]\224\213\312nU0\003\366\313\025\263\355\223\274\004\264Y\263\202\204\001\266/\216b\026\266\273\016\376I\006\006\026\362\313'I\201\030\225)\266\234yl\004`\327R\224\037\366\347J\224\035\243\345\353\037\347@\013\314\303L\356:\235\205\211\255a\323\016\270\233\323\276\016\344\351\276\221H\242\342C\021\3628\032\372x@\224\373DTC\260g\321}t\344y\037\315\352\336\226\222c\222\032\001\r"
+	.string	"8gU\305\263\314\325"
+	.ascii	"\305S\330\330\231\301#c\201k\">\026\344\006\023\004\234xR\255"
+	.ascii	"\230\204I\006"
+	.text
+	.section	.gnu.lto_config_streamer_flush.6.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`\023\002M\021"
+	.string	"F\037nG\340\262(\035*\275$R\271|hCDzL\367\304\302\027\225\235"
+	.string	"\302rH[;\f\353\307)\202\350"
+	.string	"(\372\233\303t\253\332\240O\367\247\326D1\214\020\312\306\213\337\345\374\026P\n\001\204$\366\tF\232%{K\231RV"
+	.string	"S"
+	.string	"\\"
+	.string	"\2669C\004V\020\272t\030\262\355\233\370\t\227\215\213!\r\374\254G\246\266c\316\351\225N\352.\343\tt\227;\273\353q\325\345\337\346\261D\016\316\007\276\036;|\343\001\036\0269F@\230H\232\t\361\335\346\312\001\204\251\202\034\3149\255\037Hs\313\333~`\033\202\255\253!\020\227\276Kw\371\025\371P\363\242?\326\035\0353\246\362\260\303\227\256\314~\234\033\263U-z\370\203\250\032\324\251;\251\226Q\035W\275\253VU?\300"
+	.ascii	"\032\031\r\\\3149\363\323c\306\2207\021\266]v\210\035g\247\253"
+	.ascii	"\375\232\243p=t\271\2009c0\002$\332\n\222nI\"\037\221"
+	.string	"\356\226\\\256\215J\351?\227b\366\265\222\204\257B\303\210\366\331*\317Q\031\310]8\316\352r\224\213\253\265\317\303\306\373E\267{\235\230\0210\375\361W\027dC\346\007\200\235\236\323|xl\2732\227\374\233rS\003F}l\263\236\302\270\320\234\223\201\177c!CN\231\230$H9-8\231\n\240n\224\251\225Z\241\244Z-,'*\252\n+,\224\267\242BYy\250\026\213g\"1\013C\252\345\265\260X-/$\234\217sc\242-\275,\314-v\204\306\r\214+\273\211r8|\200\326\216p\233q!\021\232\326\276\033#\355\026dm\t\023\364\037hK\033\366e\233\302uN\002. `\002\021\251e\007\030fU\312\263\264\017B\333\346\332M]\031O\307~\220\341\001\373!\207f\002=\r\256\373\037<se\035f\r\320\260\201\023\216\353\250\027\274\236\303T\022G\3154\325\356>[\303\204\004+\216h\007\031"
+	.ascii	"\321\210\272aT\201O\262\300\336\203\345\036\250Qf\271m\264\331"
+	.ascii	"\232\310_\304\276\nAp\"\222\033\264\026iJa\240"
+	.text
+	.section	.gnu.lto_config_streamer_finish.7.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`!\001\005\r"
+	.string	"\226WWD"
+	.string	"Q5\035p\326\344\317b\350\341\325[\022\024\252#\317\250\353Sg\246B3~\203\371\177;\324{@+\260\241\022\360\035\001\330\217\273\r\202\273t\247\257^EPe\244\t\214\3526f\362\337\rM\204\354\275S\nC"
+	.string	"?"
+	.string	"F"
+	.string	"\257\024\206\217\222\335\3550\277h\317\352\005h\317(\207\213\257t\212\376;^E\240\2001\222\245\327\r\247\325"
+	.string	"\211\n\032\026\022U/*\017\343;>S\344i\316\215\301\356z\216\244\206;\273m\007\266\037\330\037\005\224e\323\351\355\345_\347\364\271\257DJb4`\261\253:\271\261\"\031\310\007\333\242M\261k\006\315\247}\330K\210/I\007\260\313Z\021\333-\0178\001\367\314%g\333\037q\022\242\035RK\027\371\001B\214p\323\246\020\232\037\2159\321\2229@@\214\334eB\022\243\036i\247\035\217\027\250ib\273\302M\214\270\335]\340{X\270\300ux\346\223\264g\247\225\027\3144O|!c5d\354\264a\227\245I[\366\353\006\3766\033\004\035\215\002M\206\200w{\231\360\373p\276P\024\202 \301\023\001\004z\035\310\303\371t^\030\3522\005\fN\370\302N\004\202aG)\367u)k\243\030\023=\331\376<\205C6jq\261\252\264\365\361\023\025\327\200\0263\002\031"
+	.ascii	"8gU\305\263\314>\337o[\261Um\214'\030n\310pX!\020\002\373\302"
+	.ascii	"4/\322\231a.\032\254\005\202Q\204@\217p\032Mp\256\341NZ\274\253"
+	.ascii	"L<\270\033I5h\225HS\n\005\005"
+	.text
+	.section	.gnu.lto_write_word.part.0.13.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`\251\002U\024"
+	.string	"\226%\204I\300\020)\035\bd~\377>@\nk\264\027\037\377w\325\255\264q\234\365\266\301h\247\334L\016d#\204\3515\377\201\275m\367\360Ois\200\375\r\024\006\315x]E\223P\353\216\246\322K@u\372\323s\203\250\326\310\336r\247\024l"
+	.string	"q"
+	.string	"i"
+	.string	"\270\027\301<@\255>-\232j\035\r\234\272\204u\352\221e\237\350vc\333\037\372\016g;\315\021H\\\321T\325\360\244j\255\256\323\326\007\204\247\363!\341\351\2168\356t\256\fq\276\324\2111\247\nv2&\203]\222N\364\360\235\013\236p\210"
+	.ascii	"\210\271\371\036\032G\367]\332\2103R\nx\270:\251\265\232\365"
+	.ascii	"\341^\335\366\003\333\020l\031#?HH\311\256V\016\301\252\272C"
+	.ascii	"W\224x\357g\272\264\3573=\205\377[\242&^gz\317_\022Zb\305\334"
+	.ascii	"\260\2005BQ\367{7\337\347\017'\271\270\225{\017\367qJ\203^\366"
+	.ascii	"\225\222\\Z\271\261\212,CQ;\251Z\307\221S;`\371v\244\2279VQ\304"
+	.ascii	"k\345yGzqG\255<5\032\334^\004C`\254\035nh\316K\312\033\371(>"
+	.ascii	"\006\323\003G\251.\217A\200\342\336C\347)g\367\307\363.\341\\"
+	.ascii	"\224\243\0319\211\303\362\027\234\373\336[2\222\312 rW\256\235"
+	.ascii	"BA^7\267E\2631\266U\256b\306\252\265&\360\2330X\360\203`\302"
+	.ascii	"S\271\"P'dd\320\367\335\343\227\003F\225Tr\177\274\341g]\037"
+	.ascii	";\224^Q\351\220J\323\367\356y\336\277TZ\336\350\001\265\026\033"
+	.ascii	"\314V\013e-\025`\027\250e&&\007P^\b^$\005bw\214\204&S\201\311"
+	.ascii	"h\266Z\204\t)\022Vf1\327J\nL\305\025\243\325\\$\"\236\261\310"
+	.ascii	"h.\333lFs}|}\3142\365\233#\277\357\035;S\0336\303\355\024\256"
+	.ascii	"\326\306\366j}\"\2633^*\201!\302e1[\240\353l\314\333EH7\\\311"
+	.ascii	"\323\2403#\203Nt\227\204\004\202\330\033/z\240\0025 p\002\031"
+	.ascii	"\273\365h\263\252<9\326\362\023\230@4\302\345F\326\306\264\255"
+	.ascii	"\004.\203,[\b\327 H\030\334\361\315\3427d\274\234\030+ \036\314"
+	.ascii	"\236m\021\235a\306\341\006\333B<0\312\332\034\323\212\250\302"
+	.ascii	"\247\306\227!@\247:\267\301]\016g\321`\311\004\331\313\027\316"
+	.ascii	"\033\245\327\270\350xC\340\325\241\033\377\335 \215\020\207L"
+	.ascii	"V\275\335\007\003y\0166\241\361\346\236\200\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"u\006"
+	.string	"2\t#,pU\323\001\316\253\177u\231\336\217\006\236\223]\332\003\313\024\214\366\341\377wU\305\372U\325\376\201\304\266m\233u\023\t\332mMn\231\002\327\313\202\013\243>\352-\364\350\003,\230K\241jWB\271\205\027u\331\247\242\271\356\273T\261M\003\230t'\322\327\301U\203%\006\007\026<i\313\376\037\n\246\224\322I<B0<\3603p\024\3016\255\300\020\201\235\213\2223`};\347\234\002^H\307(7?\377\231T\250\273\333b\313\375\327L\032"
+	.string	"`h\227\201eU>(\304\241c\250\314\340@\355"
+	.string	"\350"
+	.ascii	"\350| {~)\034\204\361\2605\013\3624\201\336\241\207\202\277\001"
+	.ascii	"\376H%\300\f\204\331\371\243*\213\\u\003\202\013\216\323\301"
+	.ascii	"t\002"
+	.text
+	.section	.gnu.lto_.refs.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.863d2d75df5db551,"e",@progbits
+	.string	"(\265/\375`T\017\265M"
+	.ascii	"\232\204(\035U@\324!\245\003\311Q7\352x\346\340_\250\017\006"
+	.ascii	"\\U>\223>\351\naY5GV\234\243AZ\206OJ\017\224\323LW\251\377\023"
+	.ascii	"\303\356\211\367\r\200YHTY\247:\230\001\341k\177\336\210\001"
+	.ascii	"p\001|\271\226e\342\254Z\210\254\026\202\007"
+	.string	"\376\017\327m\020\262e\n\177\001\262\001\322\001\314\0047\037\306aO\217\260T)\261\351\271\207{\032\370a\266s\217{n\272F\360\027\272.o\227\222\206Yw\177\202\277\005\030\027\341\"P-c\023\241\234\030`\262\305(\bZ\367\352d%\270\311`OW\026,\n\270\351\340::\263\245\347\257\263\227\013\335\003\344\250\200\255R6e#\234\0047\021\340#\327\3319\032\334\352\254\334\024AL\241\305\246\377\271_c\004l|D\2133\022+lF\344\3322\032\370\350!\204MQ\237\313C0\021\334\274\341\256\363\312C~#\256\315\354^en\317*8p\331\364-\\\334\2133\327\r\330\352\235\003p\31776\031\276\261}\346\376v?\3065\266\333\356\355My\205\315\206kl3A~\306\342\254\207\241E\244dsu\2574\351\017'\321\311\246_\271\306vy\205\355\347\004<`A\213\213\303\374\026\202.\241\237;X\361"
+	.ascii	"M\003j\007\373\177\344\277\363\277\327\177(P\374/c\016\376\003"
+	.ascii	"\360\377\201\377\007\\\200\337j\341\r~f@\003\316`\346\347,\377"
+	.ascii	"\237\374\274\203\301\177'\377\237\377\243Ly\356\2672?\353\\\340"
+	.ascii	"\362[\364g\027?W\360\363\004?7\360\263\002?\017\360s\315\317"
+	.ascii	"+~\246\3719\367\363\313\317\374_\355\377\226\377_\377\245\374"
+	.ascii	"\357\372\337\344?\013\377S8\373o\366\237\312\177\030\377\247"
+	.ascii	"\374\317\372o\300\377\260\377\267\265\265\265\265\337\272\360"
+	.ascii	"\333\376U\370\004H\367\234v\177\373\333\272m\270\254m\034\342"
+	.ascii	"\316.\3147\177\216Qf\340\177\212*\320\243\233\311\211\225KeD"
+	.ascii	"\310\3436\315Aw\024Qh,2\237\2024E\246\260\213E\306\2164\305\265"
+	.ascii	"\235\006hf\217.\256\311`\232\f\332^\233\370tlb2\030\243\270\266"
+	.ascii	"\261\327dp\246\211\307\231\342*\f\026\231OG.2\223G\232&v\260"
+	.ascii	"\211B\247KL\036\213J\222\307\231\"Sx,\022\237\216\334k\262\231"
+	.ascii	"\311"
+	.string	"\327\372\024,j\2460\327\335H\3532\210\353\026\032;\330\304&\365\223YR35\217\005\261\366\350\356\356 W\2312y[\207=V\004\222\f*\352.\353$\n\202\034\\\273\333\250\207A\356.Z\215\335\303\244\013\310$;12v\256\211B\244\2412\211+\032&\215\032\210\023ww\037\213Le\262\305\221!\230\313\036\256A^v\331\223\3612\203\\%\307\364\201D\212\202\301\262r\230\252:3Ci\004\261bd\315\302))\371HBA\366\202\245\204\362L\205\247\3044\2610\021eS)\004\340\202,\345P\"\271\374\344$\254\344\200aq\004!kfL\344o\301d0\036\343\002\201\fi+i9D\353\316\030\342L\023\2255\226OFr'\217qu\252,\032Y\271\352n'\270\214\241p\024~\302Op\223\237,v^\302M\234\200\265\233\310Y?\013\371uv\370\311cL\026\023\\[\311\246T2\262\302\202"
+	.ascii	"\02684\243\225\0321)\223Yn\302N\316d\314\004Gd\262\264[\310\274"
+	.ascii	"@\f\363\002.N)!\021[z>r\317\\\3276\327\330l\330\352\362\022\001"
+	.ascii	"V\352S,\220)Hg6\265=\334\211|\202\246\203\365\261DI6\264\251"
+	.ascii	"\345!\306\313\250\031Vu\255\016\267Q\377\355\346\305\004\365"
+	.ascii	"$u\177\233\303\177{\351z\362XF\335\247N\027\305rr\262J\236Y\207"
+	.ascii	"P\220K\023r<\211\342\351V\211,C\203R\342\"\205\313\306\022\307"
+	.ascii	"\213:\331\245%\333$\001\267\021\021\315%\263n\344\215m-\n)\342"
+	.ascii	"q\333d\231pti!mjq\260!wDa\261\351S\242\275a+\271\346Pa\0161#"
+	.ascii	"6\265;X\211\235\242\342\021\206Fqy\371\342VG\323\352\340\"R\342"
+	.ascii	"\332G[\221&\223\027Z\033\223@@#5\006\204\326E\261\340\300\001"
+	.ascii	"\345\b\006\215\210\0247\360p\323\245\0337\354\361fY\362\0215"
+	.ascii	"\232\210M\217\332p\323\037\224\224\354q\204\231\036>\221\262"
+	.ascii	"\274\025\315\300\022\032o\217\316;\204\024\022\342\226\2336g"
+	.ascii	"\334\316\260I\267Y\007#6\226\240=\237h\342\004\322m\2223W\326"
+	.ascii	"e\326dS{$S\003\212\017*6\2654\370\f\367\304bD\224'\327\245\310"
+	.ascii	"\013;\274\035Z\243\333\335h7S\327\022mR%\315\206\242[#*i\221"
+	.ascii	"\223\251)ljk \002\214YeSKd%\227\307\016#\245;S\034G\260\304\216"
+	.ascii	"\\\227\263\265\257\331 #\033\225\022\004y\243b\006\226\230\323"
+	.ascii	"\2466H\005&K\022\032\3054\373%v\224\224u\177\345\n\253\331\272"
+	.ascii	"yM*\031]\212/\270\n[9K\301[\244`\265\033\354~\251A\315\306\022"
+	.ascii	"\264F\032oX\355N\\\367\001\267\345\231\226-6e,\234\206\3320\304"
+	.ascii	"\251\226\226\005f\354\030\234\222\222\333\322\242l\2336\031\215"
+	.ascii	"\305\326\276`>L\335\260\351\257p\021\266%Jji6\275\r\252.\250"
+	.ascii	"\307\306g\327\003\342\375zD9\030z|%\300\250\360 \034\240\036"
+	.ascii	"O\005\376rv>DB==^\216\372#\312\021@H\210\250\327\363\365^\200"
+	.ascii	"<6\031>5\b\350\353\275\374\350vB)p\367\033\332\r\331v@:\024v"
+	.ascii	"?\235\n\202\f\f\234\217\352[aH\247\002\371T\024xF\200\321A\t"
+	.ascii	"!\320<\b\247\204\024H\200\221\003\334\001\251:\240\315\007;\325"
+	.ascii	"\367\301\320\016\370\223\001\206L\320\217\327\343\375\004\375"
+	.ascii	"\210\204~~D@\035\360'\200\252\003\376j\200\274\036/\200\367\300"
+	.ascii	"H\200\003Tu1p|T\237\f\236\035\220\247\312\240y\017O\335\365v"
+	.ascii	"@\367\024T\020A\005.bx\001\n\371|\036\360\270\370\354`\350\361"
+	.ascii	"\t\365\210\356\217\207\006\310\243\002c\334~\277\235\352\343"
+	.ascii	"\243{\331\315\300\373\245\017r\340\276\030;5\007\350\363\251"
+	.ascii	"9*\200<.^^` \217\316\004\300\036\217\350~g\201\005:/\354P\260"
+	.ascii	"\203c\300/\270\340\003\033\025N\020\341\366\340\250\273!\335"
+	.ascii	"N\005\376x\200x?=_ON\217\247\033\312\351Q\17798\r\310`u\367\363"
+	.ascii	"C\364\202\r\250\263\252\272C\2114\345jH\332\361e\267\276x\354"
+	.ascii	"\252ii\265\354z\2310\"\274a\207\\$\216\314\252\ba5\030\243\016"
+	.ascii	"\257\"A\2242i?h,W\\\222\"HD\213e\255\322\346R\224\322\na\251"
+	.ascii	"\306\206\254\355`St\307\325\225\265RZ\346\222fHD)\273h\022U\177"
+	.ascii	"\225\265\342\255V\342f\r&/\264\033\017R?\266\\\341\246\265ri"
+	.ascii	"\002d\252+\354\242H\240nw\200\262T\350\223\327F&Q(\222<\221W"
+	.ascii	"]D\336\250\320:\322b2uKu\373Cg\347S\256\254\236B\233\332\037"
+	.ascii	"\036\203\024\3632\363\301.\377\033\f\025\024\023\210\254\373"
+	.ascii	"\b\266r\034\2176\r\2011\250\221 g\234DDfFFD\222\244\351!\005"
+	.ascii	"\204 \206%5\017\022\240e9\021\"\207DDf\222\024\366\343Z\032'"
+	.ascii	"'\321\fe\346\221\3037@\213P\034\321\335\265W\006\005lZ\305PV"
+	.ascii	"\312e7\\6o\007RXh\336\007\362\006-\276\250\004\364\321\251\221"
+	.ascii	"p>\255\265'\333\207v\256]rt\320\255~A\320\306\244\026\215\211"
+	.ascii	"\024\374\374\2756k\\(\205\327Y\232"
+	.ascii	"]8\205\220\322\273\320\273B>?\026\034\r9\222\262\305\316r~y\207"
+	.ascii	"!\326\201\001\255\017 g\377\034\303G\023\035==\213&\0256y\344"
+	.ascii	",\273\256\342\237f"
+	.string	"\356[\352S\003\334\f\337\343.\r\373\376W\354\360E\242,-\270\n\311R(\276\0209\261\234\327`\364&T\311B(b2\271\013\002\216<\271\323Fc\220\347]\031a&#\324\237\247\266\313,G.\032\033\331A\263\336\350M\271\021\304\206\\?\0166>~V\013\300\347w\222\361\351\233\005\3416\032\254\024\r\343\276\371\254x\205@\372\312t\314&\217}j\302\305\373b\037D\367\030\365\265;\322\263\377\277\256\335\220I\n\217\217\370\367\206\213\b\221Je@\003\t\353F\222\344h\271|J\345\277\324\rM\202\373\256\026\303\200,\352\331S\314\314Y>\233:\267\371\231\263\215\313\333B\235\325\224Y\313s\367\274\320*\310 x\343?\217\340\347\220H\245\226\327\253\340\225V\342\3770\360\227\007?\334\374(\016\307{,\330\220&R\323`GL`<]\365]\312\002\220JR\342\321\240\006\001\023\236\241\222\244\322\273\032@"
+	.string	"\334g\017\350U\200\224u\366\203ur\\\002`\325\202|A;\211\003\360\035\336\025\035\002\006\332E\321}\322\203b\310_Yk\243\020\0063?#Ur\217\263X\223Ch\206\305\222_\230\222B\201EC\005\007e\237\225\3305\366S\253\231\177\202s\017\370\253\310\373\200~\0137Rv\333>\275\375W\316\r\346\266:\314\032\265\320\337\007,}\344YuH\304\355\340\247\351\247#\371\243\370\031\330$:\007\226\203\216.\341[u\2010\227e\251z\b\036\200\305\306\024jB\306ir\237\270\345p\227\260\032C\026\206\276\227\361\037\304\0056\327o\317\376\334\033"
+	.ascii	"\336\364\345\240o\362Zmo\025\303\205\250\001"
+	.text
+	.section	.gnu.lto_.symtab.863d2d75df5db551,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.863d2d75df5db551,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8128 @@
+	.file	"feature.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/config/feature.h"
+	.file 4 "./src/main/config/feature.c"
+	.file 5 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	feature.c.39e91e01
+	.weak	feature.c.39e91e01
+feature.c.39e91e01:
+	.long	0x1dc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x9
+	.long	.LASF1206
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1177
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1178
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1179
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1180
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1181
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1182
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1185
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1183
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1184
+	.uleb128 0x4
+	.long	.LASF1186
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1187
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1188
+	.uleb128 0xb
+	.long	.LASF1207
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0x6d
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1189
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1190
+	.uleb128 0xc
+	.long	.LASF1208
+	.byte	0x4
+	.byte	0x3
+	.byte	0x16
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0xd
+	.long	.LASF1209
+	.byte	0x3
+	.byte	0x17
+	.byte	0xe
+	.long	0x6d
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1191
+	.byte	0x3
+	.byte	0x18
+	.byte	0x3
+	.long	0xa1
+	.uleb128 0xe
+	.long	0xbc
+	.uleb128 0xf
+	.long	.LASF1210
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x18
+	.long	0xbc
+	.uleb128 0x10
+	.long	.LASF1211
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x11
+	.long	0x6d
+	.uleb128 0x11
+	.long	.LASF1212
+	.byte	0x4
+	.byte	0x4c
+	.byte	0xa
+	.long	0x6d
+	.uleb128 0x6
+	.long	.LASF1198
+	.byte	0x47
+	.uleb128 0x3
+	.long	.LASF1192
+	.byte	0x42
+	.long	0x10d
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x42
+	.byte	0x1c
+	.long	0x6d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1193
+	.byte	0x3d
+	.long	0x123
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x3d
+	.byte	0x1a
+	.long	0x6d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1196
+	.byte	0x38
+	.long	0x13d
+	.long	0x13d
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x38
+	.byte	0x16
+	.long	0x6d
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1195
+	.uleb128 0x7
+	.long	.LASF1197
+	.byte	0x33
+	.long	0x13d
+	.long	0x15e
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x33
+	.byte	0x20
+	.long	0x6d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1199
+	.byte	0x2e
+	.uleb128 0x3
+	.long	.LASF1200
+	.byte	0x29
+	.long	0x17a
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x29
+	.byte	0x23
+	.long	0x17a
+	.byte	0
+	.uleb128 0x5
+	.long	0x6d
+	.uleb128 0x3
+	.long	.LASF1202
+	.byte	0x24
+	.long	0x1a0
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x24
+	.byte	0x1f
+	.long	0x6d
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x24
+	.byte	0x2f
+	.long	0x17a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1203
+	.byte	0x1f
+	.long	0x1c1
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x1f
+	.byte	0x1d
+	.long	0x6d
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x1f
+	.byte	0x2d
+	.long	0x17a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1204
+	.byte	0xd3
+	.long	0x1cb
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x8
+	.long	.LASF1205
+	.byte	0x7e
+	.long	0x1da
+	.uleb128 0x5
+	.long	0xc8
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 6 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 23 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 34 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x4
+	.file 53 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x35
+	.file 54 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 55 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3
+	.file 56 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.file 57 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF967
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF969
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF998
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1000
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1004
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1008
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1014
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1017
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1176
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1213
+	.long	.LASF1214
+	.long	.LASF1215
+	.long	.LASF1216
+	.long	.LASF1217
+	.long	.LASF1218
+	.long	.LASF1219
+	.long	.LASF1220
+	.long	.LASF1221
+	.long	.LASF1222
+	.long	.LASF1223
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1224
+	.byte	0x7
+	.long	.LASF1225
+	.byte	0x7
+	.long	.LASF1226
+	.byte	0x2
+	.long	.LASF1227
+	.byte	0x2
+	.long	.LASF1228
+	.byte	0x3
+	.long	.LASF1229
+	.byte	0xa
+	.long	.LASF1230
+	.byte	0xb
+	.long	.LASF1231
+	.byte	0xb
+	.long	.LASF1231
+	.byte	0xa
+	.long	.LASF1232
+	.byte	0x7
+	.long	.LASF1233
+	.byte	0xa
+	.long	.LASF1234
+	.byte	0xa
+	.long	.LASF1235
+	.byte	0x7
+	.long	.LASF1236
+	.byte	0x7
+	.long	.LASF1237
+	.byte	0x9
+	.long	.LASF1238
+	.byte	0x7
+	.long	.LASF1239
+	.byte	0x8
+	.long	.LASF1240
+	.byte	0x8
+	.long	.LASF1241
+	.byte	0x7
+	.long	.LASF1242
+	.byte	0x7
+	.long	.LASF1243
+	.byte	0x7
+	.long	.LASF1244
+	.byte	0x7
+	.long	.LASF1245
+	.byte	0xa
+	.long	.LASF1246
+	.byte	0xb
+	.long	.LASF1247
+	.byte	0x7
+	.long	.LASF1248
+	.byte	0x7
+	.long	.LASF1249
+	.byte	0x7
+	.long	.LASF1250
+	.byte	0x7
+	.long	.LASF1224
+	.byte	0x9
+	.long	.LASF1251
+	.byte	0x6
+	.long	.LASF1252
+	.byte	0x6
+	.long	.LASF1253
+	.byte	0x6
+	.long	.LASF1254
+	.byte	0x6
+	.long	.LASF1255
+	.byte	0xa
+	.long	.LASF1255
+	.byte	0x7
+	.long	.LASF1256
+	.byte	0x7
+	.long	.LASF1257
+	.byte	0x7
+	.long	.LASF1258
+	.byte	0x7
+	.long	.LASF1259
+	.byte	0x9
+	.long	.LASF1259
+	.byte	0x7
+	.long	.LASF1260
+	.byte	0x6
+	.long	.LASF1261
+	.byte	0x6
+	.long	.LASF1262
+	.byte	0x6
+	.long	.LASF1263
+	.byte	0x6
+	.long	.LASF1264
+	.byte	0x7
+	.long	.LASF1265
+	.byte	0x7
+	.long	.LASF1266
+	.byte	0x7
+	.long	.LASF1267
+	.byte	0x7
+	.long	.LASF1268
+	.byte	0x7
+	.long	.LASF1269
+	.byte	0x7
+	.long	.LASF1270
+	.byte	0xa
+	.long	.LASF1271
+	.byte	0x7
+	.long	.LASF1272
+	.byte	0x5
+	.long	.LASF1273
+	.byte	0x4
+	.long	.LASF1274
+	.byte	0x4
+	.long	.LASF1275
+	.byte	0x2
+	.long	.LASF1276
+	.byte	0x1
+	.long	.LASF1277
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF939:
+	.string	"TELEMETRY_CRSF "
+.LASF1150:
+	.string	"PG_OSD_CONFIG 501"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF930:
+	.string	"LED_STRIP "
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1166:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1157:
+	.string	"PG_PWM_CONFIG 508"
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1127:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF492:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1090:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1209:
+	.string	"enabledFeatures"
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF965:
+	.string	"U_ID_0 0"
+.LASF1059:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1049:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF992:
+	.string	"USE_UART7 "
+.LASF1158:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1104:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1168:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF479:
+	.string	"__P(args) args"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF959:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1198:
+	.string	"featureClearAll"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1134:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF962:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF925:
+	.string	"USE_SERIALRX_SUMD "
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF954:
+	.string	"VTX_TRAMP "
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF993:
+	.string	"USE_UART8 "
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF1107:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF719:
+	.string	"__size_t "
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF942:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1153:
+	.string	"PG_PID_CONFIG 504"
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1073:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF917:
+	.string	"USE_CLI_BATCH "
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1106:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1160:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF1099:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF966:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1095:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF953:
+	.string	"VTX_SMARTAUDIO "
+.LASF1008:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF947:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF516:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF1204:
+	.string	"featureConfigMutable"
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1183:
+	.string	"long int"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1016:
+	.string	"TELEMETRY_MAVLINK"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1076:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1042:
+	.string	"_PTRDIFF_T_ "
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF381:
+	.string	"__unix 1"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF946:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF997:
+	.string	"STACK_CHECK"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1152:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1128:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF998:
+	.string	"USE_DASHBOARD"
+.LASF1011:
+	.string	"USE_SERIALRX_XBUS"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF938:
+	.string	"TELEMETRY_LTM "
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1004:
+	.string	"SERIAL_RX"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF931:
+	.string	"TELEMETRY "
+.LASF963:
+	.string	"SKIP_IMU_CALC "
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1167:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1088:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1079:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1055:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1181:
+	.string	"signed char"
+.LASF1135:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF702:
+	.string	"__size_t__ "
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1078:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1009:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1151:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF975:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1146:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1113:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF908:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF945:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1021:
+	.string	"TELEMETRY_SRXL"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1002:
+	.string	"USE_PPM"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1025:
+	.string	"VTX_SMARTAUDIO"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF984:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1119:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF393:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1033:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1210:
+	.string	"featureConfig_System"
+.LASF1123:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1061:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF988:
+	.string	"USE_UART3 "
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1001:
+	.string	"USE_VCP"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1195:
+	.string	"_Bool"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF912:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF739:
+	.string	"NULL"
+.LASF924:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF960:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1144:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1196:
+	.string	"feature"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF699:
+	.string	"__need_size_t "
+.LASF1022:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF969:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF977:
+	.string	"USE_FAKE_GYRO "
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF978:
+	.string	"MAG "
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1100:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1075:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1064:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1044:
+	.string	"___int_ptrdiff_t_h "
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1129:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF921:
+	.string	"USE_SERIALRX_CRSF "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF1201:
+	.string	"features"
+.LASF1154:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1125:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF1007:
+	.string	"USE_SERIALRX_SBUS"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1136:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF1096:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF923:
+	.string	"USE_SERIALRX_SBUS "
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF914:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1052:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF397:
+	.string	"bool _Bool"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1083:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF910:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1017:
+	.string	"USE_RESOURCE_MGMT"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF1085:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF967:
+	.string	"U_ID_2 2"
+.LASF976:
+	.string	"GYRO "
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1012:
+	.string	"LED_STRIP"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1043:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1173:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF949:
+	.string	"USE_SENSOR_NAMES "
+.LASF866:
+	.string	"__NFDBITS"
+.LASF1098:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF1080:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1165:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF1063:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1185:
+	.string	"__uint32_t"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1092:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1207:
+	.string	"SystemCoreClock"
+.LASF1057:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1050:
+	.string	"UNUSED(x) (void)(x)"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF366:
+	.string	"__k8__ 1"
+.LASF30:
+	.string	"_LP64 1"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1212:
+	.string	"featureMask"
+.LASF701:
+	.string	"__need_NULL "
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1034:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1024:
+	.string	"VTX_CONTROL"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1124:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF994:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1082:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1039:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1015:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF964:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1056:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF913:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1003:
+	.string	"USE_PWM"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1053:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF720:
+	.string	"__need_size_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF819:
+	.string	"__key_t_defined "
+.LASF1187:
+	.string	"long long int"
+.LASF1203:
+	.string	"intFeatureSet"
+.LASF1170:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF916:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF982:
+	.string	"USE_FLASHFS "
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1084:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1091:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1142:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1189:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1023:
+	.string	"VTX_COMMON"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1081:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1194:
+	.string	"mask"
+.LASF469:
+	.string	"__PMT"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1156:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1126:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1010:
+	.string	"USE_SERIALRX_SUMH"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1037:
+	.string	"_ANSI_STDDEF_H "
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1051:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF935:
+	.string	"USE_RESOURCE_MGMT "
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF956:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF365:
+	.string	"__k8 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1102:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1179:
+	.string	"unsigned int"
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1069:
+	.string	"UNIT_TESTED "
+.LASF1163:
+	.string	"PG_VCD_CONFIG 514"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF928:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1087:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1174:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF1036:
+	.string	"_STDDEF_H_ "
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF934:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1040:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1105:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1038:
+	.string	"_PTRDIFF_T "
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF905:
+	.string	"alloca"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF943:
+	.string	"TELEMETRY_SRXL "
+.LASF515:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1013:
+	.string	"TELEMETRY_FRSKY"
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1122:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF398:
+	.string	"true 1"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF974:
+	.string	"ACC "
+.LASF948:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF1177:
+	.string	"unsigned char"
+.LASF995:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1108:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1120:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF981:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF1045:
+	.string	"_GCC_PTRDIFF_T "
+.LASF958:
+	.string	"USE_NAV "
+.LASF1046:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF1139:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1184:
+	.string	"char"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF1029:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1111:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1101:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1093:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF986:
+	.string	"USE_UART1 "
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF979:
+	.string	"USE_FAKE_MAG "
+.LASF1026:
+	.string	"VTX_TRAMP"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF996:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1103:
+	.string	"PG_PID_PROFILE 14"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF1072:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1178:
+	.string	"short unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF929:
+	.string	"BLACKBOX "
+.LASF1208:
+	.string	"featureConfig_s"
+.LASF1191:
+	.string	"featureConfig_t"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF971:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1006:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1020:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF1133:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1121:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF955:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF1145:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1172:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF940:
+	.string	"TELEMETRY_IBUS "
+.LASF1027:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1188:
+	.string	"long long unsigned int"
+.LASF980:
+	.string	"BARO "
+.LASF390:
+	.string	"SITL 1"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF1115:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1171:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1041:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1140:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1180:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1117:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF990:
+	.string	"USE_UART5 "
+.LASF1086:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1028:
+	.string	"USE_SPI"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF1005:
+	.string	"USE_SERIALRX_CRSF"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF952:
+	.string	"VTX_CONTROL "
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF937:
+	.string	"CMS "
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1074:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1175:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1200:
+	.string	"intFeatureClearAll"
+.LASF1197:
+	.string	"featureConfigured"
+.LASF1206:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1030:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF999:
+	.string	"TELEMETRY_LTM"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF741:
+	.string	"__need_NULL"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF918:
+	.string	"USE_PPM "
+.LASF1032:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF1130:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF814:
+	.string	"__off_t_defined "
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1211:
+	.string	"activeFeaturesLatch"
+.LASF1141:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF970:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF919:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF991:
+	.string	"USE_UART6 "
+.LASF920:
+	.string	"SERIAL_RX "
+.LASF957:
+	.string	"GPS "
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF911:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1035:
+	.string	"_STDDEF_H "
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1205:
+	.string	"featureConfig"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1155:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF972:
+	.string	"USE_FAKE_LED "
+.LASF951:
+	.string	"VTX_COMMON "
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF1097:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1000:
+	.string	"USE_ADC"
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1118:
+	.string	"PG_GPS_CONFIG 30"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1077:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF961:
+	.string	"SIMULATOR_BUILD "
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1116:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1176:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF922:
+	.string	"USE_SERIALRX_IBUS "
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF1182:
+	.string	"short int"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1132:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1109:
+	.string	"PG_SERVO_MIXER 21"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1202:
+	.string	"intFeatureClear"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF933:
+	.string	"TELEMETRY_HOTT "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF944:
+	.string	"USE_DASHBOARD "
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1070:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1159:
+	.string	"PG_ADC_CONFIG 510"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1048:
+	.string	"__need_ptrdiff_t"
+.LASF1131:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1071:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1147:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1062:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF1137:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1065:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1068:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF915:
+	.string	"USE_CLI "
+.LASF399:
+	.string	"false 0"
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF950:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF936:
+	.string	"USE_SERVOS "
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF987:
+	.string	"USE_UART2 "
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1089:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF1114:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1186:
+	.string	"uint32_t"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1161:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF356:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1031:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1149:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1110:
+	.string	"PG_IMU_CONFIG 22"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1138:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1164:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1169:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1054:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF909:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1058:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1199:
+	.string	"latchActiveFeatures"
+.LASF383:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1190:
+	.string	"float"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF927:
+	.string	"USE_SERIALRX_XBUS "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1192:
+	.string	"featureClear"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1112:
+	.string	"PG_RX_CONFIG 24"
+.LASF1094:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF941:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF926:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1047:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF1143:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1193:
+	.string	"featureSet"
+.LASF1067:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1014:
+	.string	"TELEMETRY_HOTT"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF989:
+	.string	"USE_UART4 "
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF973:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF983:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1060:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1066:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF378:
+	.string	"__linux 1"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF932:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF985:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF968:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1148:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1019:
+	.string	"TELEMETRY_IBUS"
+.LASF1018:
+	.string	"TELEMETRY_CRSF"
+.LASF1162:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1261:
+	.string	"__sigset_t.h"
+.LASF1268:
+	.string	"struct_mutex.h"
+.LASF1238:
+	.string	"long-double.h"
+.LASF1272:
+	.string	"platform.h"
+.LASF0:
+	.string	"./src/main/config/feature.c"
+.LASF1228:
+	.string	"target.h"
+.LASF1265:
+	.string	"thread-shared-types.h"
+.LASF1232:
+	.string	"libc-header-start.h"
+.LASF1230:
+	.string	"stdbool.h"
+.LASF1221:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1255:
+	.string	"endian.h"
+.LASF1244:
+	.string	"stdint-intn.h"
+.LASF1273:
+	.string	"common_fc_pre.h"
+.LASF1220:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1223:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1239:
+	.string	"stubs.h"
+.LASF1227:
+	.string	"feature.c"
+.LASF1215:
+	.string	"src/main/target/SITL"
+.LASF1267:
+	.string	"atomic_wide_counter.h"
+.LASF1236:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1219:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1245:
+	.string	"stdlib.h"
+.LASF1234:
+	.string	"features-time64.h"
+.LASF1266:
+	.string	"pthreadtypes-arch.h"
+.LASF1226:
+	.string	"feature.h"
+.LASF1249:
+	.string	"floatn.h"
+.LASF1274:
+	.string	"common_fc_post.h"
+.LASF1251:
+	.string	"clock_t.h"
+.LASF1222:
+	.string	"/usr/include"
+.LASF1263:
+	.string	"struct_timespec.h"
+.LASF1253:
+	.string	"time_t.h"
+.LASF1213:
+	.string	"src/main/build"
+.LASF1260:
+	.string	"sigset_t.h"
+.LASF1250:
+	.string	"floatn-common.h"
+.LASF1241:
+	.string	"typesizes.h"
+.LASF1264:
+	.string	"pthreadtypes.h"
+.LASF1247:
+	.string	"waitflags.h"
+.LASF1262:
+	.string	"struct_timeval.h"
+.LASF1252:
+	.string	"clockid_t.h"
+.LASF1233:
+	.string	"features.h"
+.LASF1242:
+	.string	"time64.h"
+.LASF1225:
+	.string	"stdint-uintn.h"
+.LASF1257:
+	.string	"byteswap.h"
+.LASF1216:
+	.string	"src/main/target"
+.LASF1254:
+	.string	"timer_t.h"
+.LASF1270:
+	.string	"alloca.h"
+.LASF1214:
+	.string	"src/main/config"
+.LASF1248:
+	.string	"waitstatus.h"
+.LASF1217:
+	.string	"src/main"
+.LASF1277:
+	.string	"parameter_group_ids.h"
+.LASF1243:
+	.string	"wchar.h"
+.LASF1269:
+	.string	"struct_rwlock.h"
+.LASF1218:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1237:
+	.string	"cdefs.h"
+.LASF1259:
+	.string	"select.h"
+.LASF1231:
+	.string	"stdint.h"
+.LASF1276:
+	.string	"build_config.h"
+.LASF1246:
+	.string	"stddef.h"
+.LASF1240:
+	.string	"stubs-64.h"
+.LASF1235:
+	.string	"wordsize.h"
+.LASF1258:
+	.string	"uintn-identity.h"
+.LASF1224:
+	.string	"types.h"
+.LASF1275:
+	.string	"parameter_group.h"
+.LASF1256:
+	.string	"endianness.h"
+.LASF1229:
+	.string	"stdc-predef.h"
+.LASF1271:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375 \234\255\003"
+	.string	"\244\005\220"
+	.string	"\f"
+	.string	"\345\217\300\314\013\004\002"
+	.string	"\001\213\331\256\305\001\002\366\213\237\344\016\002\003\227\247\344\313\017\004\002\001\002\002\002\001\002\001\005\352\263\360\321\b\006\312\251\326\231\r\002\007\203\313\255\261\f\001\b\347\364\313\323\006\t\306\272\236\261\n\374\245\334\221\007\013\201\267\227\352\002\f\240\342\234\212\n"
+	.string	"\n"
+	.string	"S\020\r\267\\\2615\022\312\270\204\231f\f\020\266\314Rr\003m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375 Pu\001"
+	.string	"\330D"
+	.string	"\n"
+	.string	"\002"
+	.string	"\001\001\002\001\001\003"
+	.string	"\001\006\003\007\b\001\t\n"
+	.string	"\001\013"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"`\020\\\2462\255\345\036\260\315e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\004"
+	.string	"bF\021\030\260%\351\f9\r\303"
+	.ascii	"\314q\215`\222$y\224\265\315\022B\310\336R\2463@p(\372\0070\205"
+	.ascii	"8\371{\310_1\246\237\277S\323\020\352\004\023\274\2569\347)?"
+	.ascii	"`\333n\374O\0237\276\202\204\266\344\207W\b\" \240\242\231\253"
+	.ascii	"\036\307\004\026\016B\216\221F\371:\231e\205\r\002\330\320(\206"
+	.ascii	"\024\301LR\200\274s\2239\242\355\277\023\311`\353\246I\337\263"
+	.ascii	"\267@\212/\202\364|9\020Ynt\255\023\347\216m\230k\336\362_\217"
+	.ascii	"cjF\372\233\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375 P\245\001"
+	.string	"\024\002D"
+	.string	"\n"
+	.string	"\002\001\001\017\177\002\003\177\002"
+	.string	"\001\002\001\001\003"
+	.string	""
+	.string	"\006\003\007\b\t\n"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"`\b\030Wep\313\221\232vp\331\177\003X"
+	.text
+	.section	.gnu.lto_.pureconst.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\230\004\006\204\004\007"
+	.ascii	"\204\004\b\232\004\t\232\004\n\232\004\013\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"]\003"
+	.string	"D\003\030\001"
+	.string	"\n"
+	.string	"\002"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"  \002\001\270\006"
+	.string	""
+	.string	"\003\001\002\004"
+	.string	"\001\002\005\001\006\001\300\007"
+	.string	""
+	.string	""
+	.string	"\007\b\t\n"
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\013#\343O\016`]\317\302\005J\013qd@{B\0137_\362s\024z\001$U"
+	.ascii	"\fT``\b\214\213\242\002\033.**\003:a0\023\225\335\360\005\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_intFeatureSet.13.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\245\n"
+	.string	"\326\224K@0\211*\035`\356\367`\342\032n\305I@\325\375\346\321\177\257xq\225\241$\244j\310x\375\202\3370\206\031P\232\020\352g \002\031\301a\216\3102\260\246\270F\235m\b[M\236\246E\233l\231R8"
+	.string	"8"
+	.string	"7"
+	.string	"\003Z\017vE\013Wl\237\023\277H>\265[$\237\016m\n\021\037\r\257\224\314\302\356r\322\300\303k\350?v\212je\272N0v\327\252Z\211\334\362\266)lk\330\207\bV\251\376\204R\340\301\301n\310\210ag\023B\002\333\267\337 \264+\266T\220Q}\314\027\317 <\214t\207]V\204\214\355\323\342&\017d\256\177\371\013\336\n\357*\231\262\033R'\\U\341\244\243\247\274T\371\f)"
+	.string	"(\035\355\313<J\033\002\237$\371\274<\210\200\223\216\276\214HX\275`\213&\225\004\354k\273\273\226,\373\256\177\036\366kR\003!\017\034\211:\257\263Y\223\3614\033os\201\261p\204\272\217f\016\306\003G\242\316\353p\033\236\016\350\343p O\367\3418`\210\303H\370\353\360@N\364} W\021\367\332J\326\f0;I\2245\r"
+	.ascii	"\007Uf\306\363\032\215nN\022\325\332C\005\3735\001W.#B5\005\356"
+	.ascii	"\362\251V\302\t^\\\223\f"
+	.text
+	.section	.gnu.lto_intFeatureClear.14.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\335\n"
+	.string	"FUL?0M\225\016\314\362\206\233\022\325_\310\033U\325?\002\303\031\224\362\316G\373\340Z\253\221\265\rc\002Ab\314\270\370@\0042\202)\0164*|\320\312\301c\225R\252\233\201\206j$\222M\244L)9"
+	.string	"9"
+	.string	"6"
+	.string	"K\001\345a7\024\340"
+	.string	"\331#\307%\330\343\365\b\366h\320&\241\241\340\242\303h\205bw5\265p\360\t\372W\375A*\201\236\026\004v\327I*9\270\365\266;l\033\260\017 \232NM?{\234\310(\261\333\240\245bY\361\003\006\333\267\317\001\264!\266>\240d^\345\207\337"
+	.string	">\3459\306\256)D\201\354\321a\246\013(\317\243\374\f\327"
+	.string	"\376\364\361c\003$\023\251W\325\257\030A\020e\313\230\246&\210\221\277\372>\331\005\337\203=^\317 B([\226H\020\261\231\302\016A\251\025\354_\273\273V\223\375\323\217=\365GMk\034\316\353|\033\207\311\\\241p\025\013g\0310\211 \340l\232\313\227\t\347u\276\215\303h\0072\230Mw\3216\231M\243]<\2166\331p\227\200\363\264\257\353<\r\022\356\257US\234\300\n\251\310\2529\342\001\017"
+	.ascii	"\007Uf\342)\030\215\200\236\204\252\265\247\304\005q{\016:~\026"
+	.ascii	"g.#B5\005\356\362\251V\302\t^\\\223\f"
+	.text
+	.section	.gnu.lto_intFeatureClearAll.15.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"]\b"
+	.string	"fP<8P\305\2501"
+	.string	"\240\2579>Xe\203\312n\377%[\r\206,\226\251q\366@\327\332%;\201\330\212m\355\270\374\315,\0228\034\260*\204\034\204g\215\357\001\031[n)S\n*"
+	.string	"+"
+	.string	"*"
+	.string	"\026c4\313z-\314\300b"
+	.string	"\345Bd\345\377\214\033\366\f\275\332-\013\240R&\303"
+	.string	"\207\377\205\250T\206\033\335\026\241\355C\333U#\231\223\037#\026\340.i\322\321\326\255?\257\275\264\020\326`\350V\r\342\225gV\311\005\277\212\244\344\377\024\232`\261\354\347\214f\031\247X\321\232\244\325!\024$\370\372o\216\272\244Y\022\274TN0\326\214G\312!\200\3663\301\250\321:\373\377FUk\226\r\263K\335,l\033\316\306a\320`D\226z4[71\352l\237\t\001\372\2048\317\f\201:\021\323\323\211\246\346\240\234\304\326\315\021\307u\363\362\335\331\243J~\270\002\b"
+	.ascii	"7\013\226K\226\231\366\200Z\363\3064\375\271`\f\327\306B\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_latchActiveFeatures.16.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"}\007"
+	.string	"B\01646P\215\322\001\260\226'\002\236\263B\r\"\242\375\246\335\343z\247"
+	.string	"m\251\314q\302\244>\274\355i\272\253\207\222\344\314\314f\333\n\313\317\001\303\256c\021\277m\"eJ\001\2762X&\ni\260\r\\\340l<\361\202\036\216\246\003\257\f\0043\005\216\fX\006C1f\360\242\332n\255\232\236\310jS\222\257>\307;:\376\311\361\363\251\374\351\007gb\203\236\022\001\354B$\370\033G5\370\247?;\214\362\334\237?\252\374]\0210P[v\306\200\220l\242\330*R\252\205}k\325d?}k\240\002\323\355Nt)\273z!\031\266\177\261f\227\020D\b\214Hx\234\354.\324\213kO\315\277\306\003\270\322\303\323\242\260\273N\256Dq\353m\033\330>\260\235\n\n"
+	.ascii	"3\241\207\037\370\306\\\366T\362\203\312B\327\360\263\020\306"
+	.ascii	"\313\020\341r,\332I\006"
+	.text
+	.section	.gnu.lto_featureConfigured.17.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\235\t"
+	.string	"\246\023F: \261\322\001\260\002\033\304\027\b\025_\200G\2159\"@\004\343HP:\301\016\261\337\376\213\343\350\f2By\214\001\002\002\\@\270\334\021H!\240\031\323P\007\372\232l\262eJ\0015"
+	.string	"3"
+	.string	"4"
+	.string	"\236\017x\237\335;\336\247m+0\274\f+\260\220./\263\222\231\335\361\223\034\207]a\376C\376I\211\241\325(\256"
+	.string	"\016\273k\245\3250ny\333\b\266\037l\313\004\273\226\032\266\325\363\267\277\223j\225\352{\002+\004,\273\027\271\232U\2318\017\333/\233c+.\244j\377\343 \257\337\\\016\330\265\231\234\354\216\t\376l>\0033\224N^\252\2340\263\f\231\346l\207'\231\330\354V4\370\"\037Q\371\035\237f\265\364\264O\277\345}^\036\264\334b\2323\307\266Jc\2172\225\033\366\273\335\026\205@\321\b\034-\200:\021*\022\252s\t\004\212\254\025\t4}\020'S*,}\251\023\t\365\225D\325\0072p(\001\212\337*\f\305\2173\306\356)=1)\263\357\362TN\371\b"
+	.ascii	"\237YEfh0b\035.\0201m\034\327\3003\2078\235k\222\001"
+	.text
+	.section	.gnu.lto_feature.18.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"U\t"
+	.string	"\306\022D=0\305*\035"
+	.string	"\360~\250\n\013\375,\367\375\341o\230\315\202\f\235aJ\204\223;\034\236\241\374\337\3773l\361\304\270\370@\210\245\240"
+	.string	"\020\271\253\354\251\251\331\227\001M\345\345Z\311&R\246\0241"
+	.string	"2"
+	.string	"/"
+	.string	"\217\332/\333\243mKP\240\234Z\320\320\0032pE\266\033r\372\361\3243\345\037\345\017 \201\226K\365,\250\330]g\313\305q\353m;\330\266\260m \351\370\330\257i:5\375\r\241D\001\300\356\306,\301\026\210\002Fl\243l\213\235$\232L\373&?A=v\362\301.L$\300n\030a\b\203G\314\023\266zp\200\246\327\324\203/V\316\354\247\\\345\344\207\270d\312\267\036}\323\366xm"
+	.string	"y\255rf\013l\023\201\035\252R=\354k\273\273\326\016\333\001\336h\272\r\247\343Ld.\030\243NH\263'\323}%R\247\373p\027\240\217\310\363p\"P'\304y\276\021\227a\260\227\321}\034\311\363>\316\022\356\035\025\263R\226\375\323\226\032\003\b"
+	.ascii	"\237YEfh0\342\031.\030L\273\3075\373\231C\304\3165\237"
+	.text
+	.section	.gnu.lto_featureSet.19.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`m\001\265\016"
+	.string	"V\033aD"
+	.string	"\221(\035\240\032\314\301\255\215\210P\215\303`"
+	.string	"\361"
+	.string	"\320\300[Pcb\036@#1j\3646\265;\237-\365k"
+	.string	"\2631\037\001\002\221\221\377_\262YsE\301M#\bQ\247!EZ\277\177\024\376\275\245L)J"
+	.string	"R"
+	.string	"G"
+	.string	"\234\307s\354\354\300=\355\243\274\204\352\257\2247vA\220X\261\373!\260\307\346\261\363\016\315#<\207\346\321*[\306\200\n\001fFTh\273\273i\311UO\225\177\3307Z\256\tO"
+	.ascii	"\nv\327\331ri\270\365\266\r\330v`\037&\n\323\251\371X\020@c7"
+	.ascii	"C\255\306\276\304\026'~\312[P\377|\023g\2110\216\352+'\270\036"
+	.ascii	"\276\003#8\315\313\374\023WA}\345\244\027\026\272,\330<\372\333"
+	.ascii	"<\326\241\360\025\200\021\303\343QEp\317\307P\177\245\032,,q"
+	.ascii	"AC\241=\372)(;Y\263\237\342*R\276\211\177\322<\246\036\303\207"
+	.ascii	"U\326\374\226?\330p\226G\331,f\306Q\234\362-swI\371&\217&\231"
+	.ascii	"\362\255\307\313T\037{g\2252\356\250\275\330\224\261?Vj\b\373"
+	.ascii	"pw\327Jb\3034\374\353\017\244\3163\225@\235h\343\017\327}>\272"
+	.ascii	"\217\004\036\216\b$P\bt\310\323y\246\022\250\023m\020@D\"\243"
+	.ascii	"\320&\002\002\n\331B\036i\363\020\360HB\347m\245\321\310\333"
+	.ascii	"8\337\352p\225\304\f\\/+e\331?\354\361d\0263\203\312\242\005"
+	.ascii	"\243\232\n\3653#\034X\001  @\002c\314\312\016\237\250\"\021\317"
+	.ascii	">\243\321 \022\312e\024\223\202Z\333$m\301Y\341\361\241\221X"
+	.ascii	"\320q\353\266\241\212/\355\350\240x-F\177\t\216\270V\230\017"
+	.ascii	"\b\303\236\262\342^\035\202\241\252\204\207\244\235\"+Y\237\224"
+	.ascii	"\250\303\2136\220\001"
+	.text
+	.section	.gnu.lto_featureClear.20.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\205\001%\017"
+	.string	"\306\234dE"
+	.string	"\257(\035\334\266\271\336\001\026`\252\177\257\274P\037\301\321@ld\027\007\260\215q\247\233\340cf\326\254[U\277\0060\233}\212HFF\376'\362V\331\3772\b!\022\225\374\221\230\252\342l\241\350\357-eJ\001K"
+	.string	"U"
+	.string	"J"
+	.ascii	"v\347\361\035;G\270\247\375"
+	.string	"\327?\250\016K9c7\303+f\367+`\016\316\343\306\003l\036\34156\217V\331)\376m\330\263x\255\026\231\335\3354\345\252\247\312\277\3123\274\222\221'\306\307\356:\275\022\n\267\3366\001\333\n\354\004\0200\235\030\233\223\023\002L\354N\250q\261\265H\202\203\277r\032\352\237\317\362\331\002\231\207\335\355\250.;}\260H\026\302T\3404\357\342\203x\013\352\262\223\222,|9\300y\364\307y\f\356l\241\313$\206\343Q#p\317\307P\207\245\022,LiQ{\311<\372+\250%Z~\210\213H\371.\377\264yL\275\204\223U\326\370\2647\300\360\331#\355\233aq\230S\3363\367\227\224\357z4\311\224\367\036\357\242\372\3307VI\343\224Y@\261Ic\177\254T\r\366\341\356\256\025\305\206\351\b\323\360\260_\003\244nd*}\272\020\307\035\\\327\341\321y\030\360h< }B\240A\236nd*}\272\320\346"
+	.ascii	"$$\"\002m\" \237\220\r4\"m\236\001\026A\350F[I$\032m\235ou\270"
+	.ascii	"\212b\004\027j+e\331\277\312\031t\370fTD\035\341\255\200\232"
+	.ascii	"\032\365/Z&\254\254\261*\324\f  @\002c\320\322:\237T\221\027"
+	.ascii	"\317AF\243A<-W\226\230t\320\232&U\013f\026\336\004\033\334#\020"
+	.ascii	"1\341qm\266\261\203o\370\331\341\361\302\032\365]\343\334I\031"
+	.ascii	"\026\251\025\367\362\020,U<<$\355\024Y\311z\245@//\332G\006"
+	.text
+	.section	.gnu.lto_featureClearAll.21.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"}\013"
+	.string	"V\025N> M&\035\320\230\214\025&\362\022\212\210\353 \204\017\266\247kK$\022\003H\324\236\005\017Z2\360\207\021X\024\223\214'/\006\030\022\2011\302\3206\232\026\005\221\016\225\f\240\267\232\375\367N)7"
+	.string	"?"
+	.string	";"
+	.string	"\345\005l\257\215;\266W\037\325\261\271\327s\026m\331\313\r\373\025\310\002k\266\273\035\325p\361S\364o:"
+	.string	"RT\341\323\202\262\273\236\244\350\302Mo\333\200\355\005\366\031\004\233\207\022\003D\354\202.Vl\254\222\350\340\243\276\352\374\344\253\032\300\270W\333\342\313\220\342\371,\003\206a\366x\235\262\004s>\345\203x\210\316\313\220~\226\361*\271N\263\335\362\300\253\037\215W\007w\375\345\207\333k\200\023*\306y\341\257\376\340\303U\257#B\264\024o\205\363\244#gq|\016\257\236@a\236|}\352\005\306Y\363l\221L\354\254\331\245g\322\f\366\031KG6\r\226D<\311\304\233 \20084\r[ \036\310\331T\274K\007\001s\311|\226.\203\251D\350,\240\246\203\020\360'\301\003\273\315\367\201\035W\216\247#+(\305F\352\261\237\372Mw@\n\321P\214\234\315\001\024"
+	.ascii	"7\013\226K\026\031\333\030o\\\\\334\255n\273\262\301W\024\260"
+	.ascii	"\2728\246\232va\2244v\177\354\311h\321\307\026\016\225\324\205"
+	.ascii	"j\373E\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_featureMask.22.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"U\007"
+	.string	"\222\21645Po\322\001\200\342s\016\003p\263Pge\bLA\027\325\033\226\f\243\370M\006j=z\333\210\300V}$\355\252\252F\222\322\213<<WHi\020\332{o\231R\2462\325\005\372h\252\215\\\340l:\026%;\034\r\203\244.\217\314\024\330j\250.\371\261\254KN3\373[G\262\303dnd\333s\021P\300nD\202\037\362\351\340o\034\372!\244\327\016\375P<Tg\200R\312\364\305\323\305j\213=G\3520\354\277\335];\222m\265\272X:!H\331\235xqY\023X\322a[dO\276\307?D\306\336\324\330\342\210\205\004\t\313\356\224\230\017\304\303w\201x\3502\216]1\377 \177*\025+\332\006q\005P\330]\253\266Q\334\356\266\017l#\330\346\b\007"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"\357\232\227\205 \303]1\265\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\003"
+	.string	"\024\005\013\001"
+	.string	""
+	.string	""
+	.string	"\002\r\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\016\177\007\017\177\b\020\177\t\005\027\n`"
+	.string	""
+	.string	""
+	.string	"\005\f\013\300\204\001"
+	.string	""
+	.string	"\003\002\021\177\f\022\177\r\023\177\016\024\177\017\002\025\177\020\026\177\021\005\006\022\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"@\2171|\004\320\003|\003\276a\016\037\003\364"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	"\004\002"
+	.string	"\001\005\003"
+	.string	"\001\006"
+	.string	"\004\002"
+	.string	"\001\007"
+	.string	"\005\002"
+	.string	"\002\b"
+	.string	"\004\006"
+	.string	"\001\004\b"
+	.string	"\002\t"
+	.string	"\004\006"
+	.string	"\001\004\t"
+	.string	"\001\n\001\004\005"
+	.string	"\001\013"
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"(\265/\375`\274\b\325."
+	.string	"\nP\234\021G`^R\007s\206\203\355\206:\007\376\373\307SS\\O\0332\233\323\f+\256\205\\\267\026\201V\343gSb\027\3037"
+	.string	"\337S\221\276\233b\016\336a@\226\026\374\340}\2111\221\3638\233\215\022\302q{] \261\311N)\356"
+	.string	"\371"
+	.ascii	"\b\001U|\312\313i%\026%-U;B7R\273\323\271\370\213\300\306?\223"
+	.ascii	"\312G-\n\365\243\356?wyv\247s\251\371\237\201\201_\225k\243K"
+	.ascii	"U\273\004n\r\270\333\267\024\375\354\332\216X\351\226[\361\227"
+	.ascii	"\327J\271\317\365\237\203\260\023\356\031\225\252\236\345W<\027"
+	.ascii	"y\226v-\256\325<\310\374\357\177\376\341ik3\204+U\207|@O\265"
+	.ascii	"\200}D\355X\372G\313O\350\024\267\027\365~\274\250\327\331\007"
+	.ascii	"\364\260\013\365\350\326D\323\224\311\235\031\333\351v\265\267"
+	.ascii	"^\267\233\241\351n\236n's\276\351\351\366*\274n\207R\306\244"
+	.ascii	"\273\211\324nO\322\335v\335M\327\335\321\356\226\353\356\270"
+	.ascii	"\356~\353n\267\356^\353\3562\335\215\326\335c\272\273\254\273"
+	.ascii	"\307\272\033\254\273\277\272[\253\273\273\272{\253\273\337\356"
+	.ascii	"\026\352n2\335\355swww\327\355V\335\236\325\335\373\020s\276"
+	.ascii	"u\202M\311\233&\270;\355\356\375\353\320\311\237<\372\332u\334"
+	.ascii	"\213\272\177\316\363\005\377\004\256\376{D\243\370\211\027c\220"
+	.ascii	"T\355\356\241\277\360\217\004iL\266/\223\rj_\343"
+	.string	"\267[OeP\233\277H\201\177\255\276\315.\253\272l\372\371\221L\345#]\026F\233?\371\331e\201\036\251\004j\263\221m_\246\322\333\327U\006=\362\331G\032\213`\244\253l\317\\%P\373\032\225-\222\251\364\317\356\273\032\230\314d\237\3765\376\376_*7Y\337\2771\371\354Z:\365\314\270\251\247z\177N\311V\377\377\317rA\253\\\236|\374g{\345.=\375C\177J\002\353l\376\177\250?\262\376\377\224\223\377G7\305\322u6\250\344\377\036i\224:V\271\276\247\243\013\365WE\\\331\276U.\222\330\226\267\371\307\314z\363\241\314$~\331\374\336\346\367*YJe\001K)8R\365\313@o\311\223i\325[\277\271[\207\234\240.\252\016k\207\334\335\234\030N_\266fs7\236\17775Quu>\252%S\324R\325\335\034\372\233\333z^IU\207\246\216\306\323\264C\275\315\207\314\016U\377\215\356\n"
+	.ascii	"\270+\320!cb\324\352\251\235z\341\236\353"
+	.string	"\245\345\210\363f\nv3\"\177\272\257\255\371\253\346W\216\310J\346\006\235\032\301\355\376\366\034\214\250\275L\3662\016\246\"\265\274\022\006\025\250\260\272\377e\203\036/`\316\263T\3554\211\323\264\263>s4\374i:\3173\311g\317\265\243\351\254]5\351\212\203S61NF\214\2171kb27UK\263\3661\2740\256*\32048\275+\3630e>\206\331\177\336?\325W\323k\030\323\242f\230\347\022\271\027\017k\027s\262\354b>\346\237\374_>\357\rKT]\335/\227E=1\254!F0\355c\335\020&4\234\357\337\312\377#\340\231\343\225\211\244\252\177\361\327\333#.\233\252\035\275d\004\242\204\007\022G\305\265\005\021X\034r\021\034\n\225V\342P\351\307\205\0230\204\217P\210\301\307\242gG8\034f@\241\263b%\306\b\002\001\024z\261\026\235h\220\020\260\312`*\0061,\005\213@\241\220P\210!"
+	.ascii	"\021\270\n\225~:X\\I\024\233\230~\035d\"\256Mk\013\334\022(8"
+	.ascii	"\240Pa\306N\261\227\020\364\020\306J<*\016\207\304#\037'\024"
+	.ascii	"J?N\033V\254B\025\300\246\365\247\210\002B\204b\023S\f\334H\017"
+	.ascii	"V\244\2445)\202\221P'%)\r\231\020\301\001\007\215Vb\214\"peq"
+	.ascii	"\324\202\211E\3230x\324\304\004|q\024$:\035\031\035\200\003\246"
+	.ascii	"\336"
+	.string	"\370\232\362\221\252\016E\324ng\347\357\005\256W\2158\201\274\301\372\244\230\006AL\236R\246\260\237q\343\306\351\0024w\266h\t\211\303tM\227\007\235\277nR\236NR\265y,v6\321\250\243\345\340\221yu\tc\203\235NN\316\314\215\346\317\313\211\006\207\r\247Spp\036\207\201\376\370&'\256'+\216\f\\\252z\234j\006K\0334U\315p\200\261\250\241 \206\034TFFDFF\222$\351`\002\221\261;n\021\200\231\322\210f\202\246(\225\f\007w\225d\235\312S\240\037\260<\203\013\265\273?W_c\261\364\005\326\272\357\251L\321\370\375s\203y\335\321=\256\223~\017\357d\342\365Qs8\331\320FS[X\241)Lo\2250\225{l\034\227\n\220\016A\020@9\020+\201\261\250\350\244\020\303\260\377 :u\211&rG$\016`\306\300`\225\276\035z\301X\367\216\200=\022[\226\370.ay"
+	.ascii	"\370\213\201\206\252lc\201\026\236(\006\300\375\222\2264n\340"
+	.ascii	"\320\007[\301\fz=\022\213\331\003\352@R\254\321]\355\261\260"
+	.ascii	"\031\3627H\3507\204XLg\200\262Q\266\223;\221\231\256n#z<\361"
+	.ascii	"s$\245\202*\364\0064\361\005R\211\276\215\275s\322\266\357\225"
+	.ascii	"\336\311d\307\267\207Z#*\366\225G\200\034?Wp\375]\225x\250\312"
+	.ascii	"\377\237)\177\3073\211\347\235H\344E>\207|\352cK\031\202\201"
+	.ascii	"\232\021\300\304\031\206\242C\222\303\320At\306\343?\370+\265"
+	.ascii	"\206\254\203\306F\027\r\223~\013\200W\224{\035\301\366\352\320"
+	.ascii	"\367\357\317\212EYT\347\241\305\237\216\314\022\373\005O\211"
+	.ascii	"\377+\236\357\313\266\315%\373pN\371\021s\033\263\341\376\376"
+	.ascii	"\377~\033\334\367\363\234\275Wws\037\360(\333~\234V\001"
+	.text
+	.section	.gnu.lto_.symtab.6cf3d70b2a9df2e9,"e",@progbits
+	.string	"intFeatureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"intFeatureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"intFeatureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"feature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6cf3d70b2a9df2e9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
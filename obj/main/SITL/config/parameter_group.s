@@ -0,0 +1,7123 @@
+	.file	"parameter_group.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/config/parameter_group.c"
+	.file 7 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	parameter_group.c.d40cee75
+	.weak	parameter_group.c.d40cee75
+parameter_group.c.d40cee75:
+	.long	0x40b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF992
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF943
+	.uleb128 0x3
+	.long	.LASF950
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF944
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x3c
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF945
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF946
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF947
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF948
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF949
+	.uleb128 0x3
+	.long	.LASF951
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF952
+	.uleb128 0x3
+	.long	.LASF953
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x48
+	.uleb128 0x3
+	.long	.LASF954
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF955
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x5
+	.long	0x98
+	.uleb128 0x3
+	.long	.LASF956
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF957
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x19
+	.long	.LASF993
+	.byte	0x7
+	.byte	0xa1
+	.byte	0xa
+	.long	0xba
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF958
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF959
+	.uleb128 0x3
+	.long	.LASF960
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xa9
+	.uleb128 0x1a
+	.byte	0x7
+	.byte	0x4
+	.long	0x5d
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x116
+	.uleb128 0xa
+	.long	.LASF961
+	.value	0xfff
+	.uleb128 0xa
+	.long	.LASF962
+	.value	0xf000
+	.uleb128 0xa
+	.long	.LASF963
+	.value	0xfff
+	.uleb128 0x1b
+	.long	.LASF964
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF965
+	.byte	0x4
+	.byte	0x29
+	.byte	0xf
+	.long	0x122
+	.uleb128 0x1c
+	.long	0x132
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x5
+	.long	0x151
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x10
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x151
+	.byte	0
+	.uleb128 0x7
+	.long	0x116
+	.uleb128 0x1e
+	.long	.LASF994
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x10
+	.long	0x1ac
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xe0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF966
+	.byte	0x2d
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF967
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1ac
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF968
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ac
+	.byte	0x10
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x1b1
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF969
+	.byte	0x34
+	.byte	0x7
+	.long	0x132
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x98
+	.uleb128 0x7
+	.long	0x1ac
+	.uleb128 0x3
+	.long	.LASF970
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x156
+	.uleb128 0x5
+	.long	0x1b6
+	.uleb128 0x12
+	.long	0x1c2
+	.long	0x1d2
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x1c7
+	.uleb128 0x9
+	.long	.LASF971
+	.byte	0x46
+	.byte	0x1b
+	.long	0x1d2
+	.uleb128 0x9
+	.long	.LASF972
+	.byte	0x47
+	.byte	0x1b
+	.long	0x1d2
+	.uleb128 0x12
+	.long	0xa4
+	.long	0x1f8
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x1ed
+	.uleb128 0x9
+	.long	.LASF973
+	.byte	0x4a
+	.byte	0x16
+	.long	0x1f8
+	.uleb128 0x9
+	.long	.LASF974
+	.byte	0x4b
+	.byte	0x16
+	.long	0x1f8
+	.uleb128 0x14
+	.long	.LASF975
+	.byte	0x2b
+	.long	0x96
+	.long	0x231
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x231
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x7
+	.long	0x236
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF976
+	.byte	0x3d
+	.long	0x96
+	.long	0x255
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x3c
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF995
+	.byte	0x6
+	.byte	0x58
+	.byte	0x6
+	.long	0x26f
+	.uleb128 0xb
+	.uleb128 0xc
+	.string	"reg"
+	.byte	0x5a
+	.byte	0x1f
+	.long	0x26f
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x1c2
+	.uleb128 0xd
+	.long	.LASF980
+	.byte	0x51
+	.byte	0x5
+	.long	0x3c
+	.long	0x2b1
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x6
+	.byte	0x51
+	.byte	0x21
+	.long	0x26f
+	.uleb128 0x2
+	.string	"to"
+	.byte	0x6
+	.byte	0x51
+	.byte	0x2c
+	.long	0x96
+	.uleb128 0x6
+	.long	.LASF966
+	.byte	0x51
+	.byte	0x34
+	.long	0x3c
+	.uleb128 0xe
+	.long	.LASF977
+	.byte	0x53
+	.byte	0xf
+	.long	0x43
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF983
+	.byte	0x47
+	.long	0x2f6
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x6
+	.byte	0x47
+	.byte	0x21
+	.long	0x26f
+	.uleb128 0x6
+	.long	.LASF978
+	.byte	0x47
+	.byte	0x32
+	.long	0x231
+	.uleb128 0x6
+	.long	.LASF966
+	.byte	0x47
+	.byte	0x3c
+	.long	0x3c
+	.uleb128 0x6
+	.long	.LASF979
+	.byte	0x47
+	.byte	0x46
+	.long	0x3c
+	.uleb128 0xb
+	.uleb128 0xe
+	.long	.LASF977
+	.byte	0x4c
+	.byte	0x13
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF981
+	.byte	0x3d
+	.byte	0x5
+	.long	0x328
+	.long	0x328
+	.uleb128 0x6
+	.long	.LASF968
+	.byte	0x3d
+	.byte	0x17
+	.long	0x96
+	.uleb128 0x2
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x23
+	.long	0xe0
+	.uleb128 0xc
+	.string	"reg"
+	.byte	0x3f
+	.byte	0x19
+	.long	0x26f
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF982
+	.uleb128 0x15
+	.long	.LASF984
+	.byte	0x38
+	.long	0x346
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x6
+	.byte	0x38
+	.byte	0x22
+	.long	0x26f
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF991
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xd
+	.long	0x375
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x31
+	.long	0x26f
+	.uleb128 0x6
+	.long	.LASF985
+	.byte	0x2a
+	.byte	0x3f
+	.long	0x1ac
+	.uleb128 0xe
+	.long	.LASF986
+	.byte	0x2c
+	.byte	0x14
+	.long	0xb5
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF988
+	.byte	0x6
+	.byte	0x25
+	.byte	0x11
+	.long	0x1ac
+	.long	0x392
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x6
+	.byte	0x25
+	.byte	0x2e
+	.long	0x26f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF987
+	.byte	0x1b
+	.byte	0x15
+	.long	0x26f
+	.long	0x3bb
+	.uleb128 0x2
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x22
+	.long	0xe0
+	.uleb128 0xb
+	.uleb128 0xc
+	.string	"reg"
+	.byte	0x1d
+	.byte	0x1f
+	.long	0x26f
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF989
+	.byte	0x4
+	.byte	0x39
+	.byte	0x18
+	.long	0xa9
+	.long	0x3d8
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x4
+	.byte	0x39
+	.byte	0x33
+	.long	0x26f
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF990
+	.byte	0x4
+	.byte	0x38
+	.byte	0x17
+	.long	0x98
+	.long	0x3f5
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x4
+	.byte	0x38
+	.byte	0x35
+	.long	0x26f
+	.byte	0
+	.uleb128 0x22
+	.string	"pgN"
+	.byte	0x4
+	.byte	0x37
+	.byte	0x18
+	.long	0xa9
+	.uleb128 0x2
+	.string	"reg"
+	.byte	0x4
+	.byte	0x37
+	.byte	0x30
+	.long	0x26f
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF453
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF507
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF580
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF622
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF623
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF507
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF686
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF690
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF754
+	.byte	0x4
+	.file 27 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.file 28 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 29 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 31 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 32 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF506
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF517
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF518
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF577
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF579
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF605
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF617
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF621
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF617
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF793
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF853
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF854
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF855
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF861
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF864
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF881
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF895
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF926
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF996
+	.long	.LASF997
+	.long	.LASF998
+	.long	.LASF999
+	.long	.LASF1000
+	.long	.LASF1001
+	.long	.LASF1002
+	.long	.LASF1003
+	.long	.LASF1004
+	.long	.LASF1005
+	.long	.LASF1006
+	.long	.LASF1007
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x21
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1008
+	.byte	0xc
+	.long	.LASF1009
+	.byte	0x8
+	.long	.LASF1010
+	.byte	0x8
+	.long	.LASF1011
+	.byte	0x3
+	.long	.LASF1012
+	.byte	0xb
+	.long	.LASF1013
+	.byte	0x3
+	.long	.LASF1014
+	.byte	0x4
+	.long	.LASF1015
+	.byte	0xb
+	.long	.LASF1016
+	.byte	0x8
+	.long	.LASF1017
+	.byte	0xb
+	.long	.LASF1018
+	.byte	0xb
+	.long	.LASF1019
+	.byte	0x8
+	.long	.LASF1020
+	.byte	0x8
+	.long	.LASF1021
+	.byte	0xa
+	.long	.LASF1022
+	.byte	0x8
+	.long	.LASF1023
+	.byte	0x9
+	.long	.LASF1024
+	.byte	0x9
+	.long	.LASF1025
+	.byte	0x7
+	.long	.LASF1026
+	.byte	0x7
+	.long	.LASF1027
+	.byte	0xb
+	.long	.LASF1028
+	.byte	0xc
+	.long	.LASF1028
+	.byte	0xb
+	.long	.LASF1029
+	.byte	0x8
+	.long	.LASF1030
+	.byte	0x8
+	.long	.LASF1031
+	.byte	0x8
+	.long	.LASF1032
+	.byte	0x8
+	.long	.LASF1033
+	.byte	0x6
+	.long	.LASF1034
+	.byte	0x5
+	.long	.LASF1035
+	.byte	0x5
+	.long	.LASF1036
+	.byte	0xc
+	.long	.LASF1037
+	.byte	0x1
+	.long	.LASF1038
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF699:
+	.string	"INT32_MAX (2147483647)"
+.LASF786:
+	.string	"TELEMETRY_CRSF "
+.LASF641:
+	.string	"__STD_TYPE typedef"
+.LASF764:
+	.string	"USE_CLI_BATCH "
+.LASF505:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF703:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF777:
+	.string	"LED_STRIP "
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF950:
+	.string	"size_t"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF604:
+	.string	"__stub_sigreturn "
+.LASF469:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF942:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF755:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF481:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF542:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF745:
+	.string	"INT16_C(c) c"
+.LASF513:
+	.string	"__GNU_LIBRARY__"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF891:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF801:
+	.string	"VTX_TRAMP "
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF833:
+	.string	"USE_UART1 "
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF450:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF839:
+	.string	"USE_UART7 "
+.LASF714:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF556:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF686:
+	.string	"__STD_TYPE"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF724:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF529:
+	.string	"__P(args) args"
+.LASF411:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF446:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF977:
+	.string	"take"
+.LASF848:
+	.string	"USE_VCP"
+.LASF728:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF404:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF749:
+	.string	"UINT16_C(c) c"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF427:
+	.string	"__size_t "
+.LASF693:
+	.string	"INT8_MIN (-128)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF638:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF517:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF789:
+	.string	"TELEMETRY_MAVLINK "
+.LASF974:
+	.string	"__pg_resetdata_end"
+.LASF544:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF415:
+	.string	"_T_SIZE "
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF702:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF723:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF589:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF472:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF623:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF995:
+	.string	"pgResetAll"
+.LASF459:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF813:
+	.string	"U_ID_1 1"
+.LASF684:
+	.string	"_BITS_TIME64_H 1"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF800:
+	.string	"VTX_SMARTAUDIO "
+.LASF855:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF971:
+	.string	"__pg_registry_start"
+.LASF740:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF600:
+	.string	"__stub_fchflags "
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF663:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF989:
+	.string	"pgSize"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF483:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF463:
+	.string	"__USE_XOPEN"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF468:
+	.string	"__USE_XOPEN2K8"
+.LASF794:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF566:
+	.string	"__always_inline"
+.LASF413:
+	.string	"_SYS_SIZE_T_H "
+.LASF769:
+	.string	"USE_SERIALRX_IBUS "
+.LASF783:
+	.string	"USE_SERVOS "
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF479:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF695:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF515:
+	.string	"__GLIBC__ 2"
+.LASF943:
+	.string	"long int"
+.LASF507:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF863:
+	.string	"TELEMETRY_MAVLINK"
+.LASF928:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF962:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF484:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF501:
+	.string	"__USE_XOPEN2K8 1"
+.LASF672:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF913:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF403:
+	.string	"_PTRDIFF_T_ "
+.LASF480:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF381:
+	.string	"__unix 1"
+.LASF938:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF793:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF683:
+	.string	"__FD_SETSIZE 1024"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF844:
+	.string	"STACK_CHECK"
+.LASF668:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF984:
+	.string	"pgReset"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF730:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF662:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF987:
+	.string	"pgFind"
+.LASF563:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF968:
+	.string	"copy"
+.LASF422:
+	.string	"_SIZE_T_DECLARED "
+.LASF531:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF845:
+	.string	"USE_DASHBOARD"
+.LASF858:
+	.string	"USE_SERIALRX_XBUS"
+.LASF587:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF932:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF963:
+	.string	"PGR_SIZE_MASK"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF785:
+	.string	"TELEMETRY_LTM "
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF552:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF737:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF778:
+	.string	"TELEMETRY "
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF941:
+	.string	"Q12 (1 << 12)"
+.LASF452:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF925:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF545:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF665:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF512:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF522:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF916:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF887:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF949:
+	.string	"signed char"
+.LASF955:
+	.string	"uint8_t"
+.LASF988:
+	.string	"pgOffset"
+.LASF628:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF533:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF915:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF856:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF643:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF580:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF822:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF792:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF659:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF868:
+	.string	"TELEMETRY_SRXL"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF849:
+	.string	"USE_PPM"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF872:
+	.string	"VTX_SMARTAUDIO"
+.LASF661:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF424:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF489:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF530:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF715:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF423:
+	.string	"__DEFINED_size_t "
+.LASF964:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF393:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF880:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF780:
+	.string	"TELEMETRY_HOTT "
+.LASF893:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF835:
+	.string	"USE_UART3 "
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF694:
+	.string	"INT16_MIN (-32767-1)"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF982:
+	.string	"_Bool"
+.LASF978:
+	.string	"from"
+.LASF574:
+	.string	"__restrict_arr __restrict"
+.LASF598:
+	.string	"__stub___compat_bdflush "
+.LASF419:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF447:
+	.string	"NULL"
+.LASF771:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF670:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF476:
+	.string	"__USE_GNU"
+.LASF511:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF710:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF553:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF708:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF603:
+	.string	"__stub_setlogin "
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF620:
+	.string	"__need_size_t "
+.LASF869:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF631:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF653:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF586:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF571:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF491:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF754:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF953:
+	.string	"__uint16_t"
+.LASF466:
+	.string	"__USE_XOPEN2K"
+.LASF539:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF685:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF981:
+	.string	"pgResetCopy"
+.LASF467:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF973:
+	.string	"__pg_resetdata_start"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF569:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF410:
+	.string	"__size_t__ "
+.LASF498:
+	.string	"__USE_POSIX199309 1"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF721:
+	.string	"INT_FAST8_MAX (127)"
+.LASF709:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF739:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF750:
+	.string	"UINT32_C(c) c ## U"
+.LASF729:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF461:
+	.string	"__USE_POSIX199309"
+.LASF700:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF896:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF719:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF465:
+	.string	"__USE_UNIX98"
+.LASF768:
+	.string	"USE_SERIALRX_CRSF "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF482:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF807:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF647:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF632:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF677:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF573:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF770:
+	.string	"USE_SERIALRX_SBUS "
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF717:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF761:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF538:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF679:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF884:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF898:
+	.string	"bool _Bool"
+.LASF934:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF951:
+	.string	"__uint8_t"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF436:
+	.string	"_BSD_WCHAR_T_ "
+.LASF680:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF726:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF757:
+	.string	"I2C1_OVERCLOCK true"
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF551:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF961:
+	.string	"PGR_PGN_MASK"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF727:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF720:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF864:
+	.string	"USE_RESOURCE_MGMT"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF448:
+	.string	"NULL ((void *)0)"
+.LASF922:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF814:
+	.string	"U_ID_2 2"
+.LASF823:
+	.string	"GYRO "
+.LASF561:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF859:
+	.string	"LED_STRIP"
+.LASF449:
+	.string	"__need_NULL"
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF499:
+	.string	"__USE_POSIX199506 1"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF840:
+	.string	"USE_UART8 "
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF502:
+	.string	"_ATFILE_SOURCE"
+.LASF637:
+	.string	"__SLONG32_TYPE int"
+.LASF742:
+	.string	"WINT_MIN (0u)"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF658:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF453:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF455:
+	.string	"__USE_ISOC11"
+.LASF506:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF796:
+	.string	"USE_SENSOR_NAMES "
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF691:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF733:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF626:
+	.string	"_BITS_TYPES_H 1"
+.LASF701:
+	.string	"UINT8_MAX (255)"
+.LASF738:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF524:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF748:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF492:
+	.string	"_POSIX_SOURCE"
+.LASF895:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF954:
+	.string	"__uint32_t"
+.LASF490:
+	.string	"__USE_ISOC95 1"
+.LASF590:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF602:
+	.string	"__stub_revoke "
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF414:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF967:
+	.string	"address"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF993:
+	.string	"SystemCoreClock"
+.LASF889:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF882:
+	.string	"UNUSED(x) (void)(x)"
+.LASF543:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF30:
+	.string	"_LP64 1"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF525:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF621:
+	.string	"__need_NULL "
+.LASF454:
+	.string	"_FEATURES_H 1"
+.LASF487:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF930:
+	.string	"VERY_FAST_MATH "
+.LASF581:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF689:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF881:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF555:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF871:
+	.string	"VTX_CONTROL"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF642:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF827:
+	.string	"BARO "
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF910:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF841:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF405:
+	.string	"___int_ptrdiff_t_h "
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF919:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF521:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF562:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF400:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF474:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF862:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF811:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF888:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF678:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF760:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF432:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF850:
+	.string	"USE_PWM"
+.LASF583:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF885:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF460:
+	.string	"__USE_POSIX2"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF428:
+	.string	"__need_size_t"
+.LASF417:
+	.string	"_SIZE_T_ "
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF851:
+	.string	"SERIAL_RX"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF429:
+	.string	"__wchar_t__ "
+.LASF592:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF597:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF763:
+	.string	"USE_SETTINGS_INDEX "
+.LASF444:
+	.string	"__DEFINED_wchar_t "
+.LASF829:
+	.string	"USE_FLASHFS "
+.LASF625:
+	.string	"_STDINT_H 1"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF921:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF991:
+	.string	"pgResetInstance"
+.LASF732:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF899:
+	.string	"true 1"
+.LASF578:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF434:
+	.string	"__WCHAR_T "
+.LASF958:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF870:
+	.string	"VTX_COMMON"
+.LASF528:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF918:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF559:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF523:
+	.string	"__LEAF , __leaf__"
+.LASF399:
+	.string	"_PTRDIFF_T "
+.LASF577:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF519:
+	.string	"__PMT"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF816:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF937:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF664:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF503:
+	.string	"_ATFILE_SOURCE 1"
+.LASF633:
+	.string	"__SQUAD_TYPE long int"
+.LASF857:
+	.string	"USE_SERIALRX_SUMH"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF477:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF594:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF398:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF933:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF883:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF782:
+	.string	"USE_RESOURCE_MGMT "
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF803:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF365:
+	.string	"__k8 1"
+.LASF697:
+	.string	"INT8_MAX (127)"
+.LASF969:
+	.string	"reset"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF831:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF948:
+	.string	"unsigned int"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF906:
+	.string	"UNIT_TESTED "
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF520:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF775:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF924:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF473:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF470:
+	.string	"__USE_LARGEFILE"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF897:
+	.string	"_STDBOOL_H "
+.LASF443:
+	.string	"_WCHAR_T_DECLARED "
+.LASF781:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF500:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF671:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF630:
+	.string	"__U32_TYPE unsigned int"
+.LASF401:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF550:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF554:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF960:
+	.string	"pgn_t"
+.LASF576:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF601:
+	.string	"__stub_gtty "
+.LASF430:
+	.string	"__WCHAR_T__ "
+.LASF712:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF667:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF705:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF990:
+	.string	"pgVersion"
+.LASF994:
+	.string	"pgRegistry_s"
+.LASF970:
+	.string	"pgRegistry_t"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF618:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF790:
+	.string	"TELEMETRY_SRXL "
+.LASF565:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF860:
+	.string	"TELEMETRY_FRSKY"
+.LASF900:
+	.string	"false 0"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF744:
+	.string	"INT8_C(c) c"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF407:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF636:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF682:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF514:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF646:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF821:
+	.string	"ACC "
+.LASF795:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF927:
+	.string	"sq(x) ((x)*(x))"
+.LASF655:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF526:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF582:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF532:
+	.string	"__STRING(x) #x"
+.LASF947:
+	.string	"unsigned char"
+.LASF842:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF579:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF809:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF431:
+	.string	"_WCHAR_T "
+.LASF825:
+	.string	"MAG "
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF828:
+	.string	"USE_FAKE_BARO "
+.LASF622:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF406:
+	.string	"_GCC_PTRDIFF_T "
+.LASF805:
+	.string	"USE_NAV "
+.LASF946:
+	.string	"char"
+.LASF527:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF588:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF412:
+	.string	"_SIZE_T "
+.LASF439:
+	.string	"_WCHAR_T_H "
+.LASF876:
+	.string	"LED_STRIP_TIMER 1"
+.LASF707:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF920:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF826:
+	.string	"USE_FAKE_MAG "
+.LASF873:
+	.string	"VTX_TRAMP"
+.LASF547:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF843:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF704:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF909:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF397:
+	.string	"_STDDEF_H_ "
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF416:
+	.string	"__SIZE_T "
+.LASF776:
+	.string	"BLACKBOX "
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF818:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF853:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF457:
+	.string	"__USE_ISOC95"
+.LASF735:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF456:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF464:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF867:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF940:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF567:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF534:
+	.string	"__BEGIN_DECLS "
+.LASF442:
+	.string	"_GCC_WCHAR_T "
+.LASF716:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF802:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF692:
+	.string	"__intptr_t_defined "
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF966:
+	.string	"size"
+.LASF787:
+	.string	"TELEMETRY_IBUS "
+.LASF874:
+	.string	"USE_I2C"
+.LASF674:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF390:
+	.string	"SITL 1"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF458:
+	.string	"__USE_ISOCXX11"
+.LASF420:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF956:
+	.string	"uint16_t"
+.LASF593:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF402:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF713:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF944:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF495:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF824:
+	.string	"USE_FAKE_GYRO "
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF558:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF462:
+	.string	"__USE_POSIX199506"
+.LASF746:
+	.string	"INT32_C(c) c"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF751:
+	.string	"UINT64_C(c) c ## UL"
+.LASF837:
+	.string	"USE_UART5 "
+.LASF923:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF875:
+	.string	"USE_SPI"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF852:
+	.string	"USE_SERIALRX_CRSF"
+.LASF504:
+	.string	"__WORDSIZE 64"
+.LASF438:
+	.string	"_WCHAR_T_DEFINED "
+.LASF784:
+	.string	"CMS "
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF911:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF605:
+	.string	"__stub_stty "
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF791:
+	.string	"USE_DASHBOARD "
+.LASF992:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF540:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF877:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF639:
+	.string	"__S64_TYPE long int"
+.LASF418:
+	.string	"_BSD_SIZE_T_ "
+.LASF537:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF435:
+	.string	"_WCHAR_T_ "
+.LASF976:
+	.string	"memset"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF979:
+	.string	"version"
+.LASF433:
+	.string	"_T_WCHAR "
+.LASF629:
+	.string	"__S32_TYPE int"
+.LASF980:
+	.string	"pgStore"
+.LASF441:
+	.string	"__INT_WCHAR_T_H "
+.LASF765:
+	.string	"USE_PPM "
+.LASF879:
+	.string	"DEFIO_NO_PORTS "
+.LASF741:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF986:
+	.string	"regSize"
+.LASF607:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF451:
+	.string	"_STRING_H 1"
+.LASF687:
+	.string	"_BITS_WCHAR_H 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF747:
+	.string	"INT64_C(c) c ## L"
+.LASF810:
+	.string	"SKIP_IMU_CALC "
+.LASF509:
+	.string	"__USE_ATFILE 1"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF753:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF929:
+	.string	"FAST_MATH "
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF936:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF854:
+	.string	"USE_SERIALRX_SBUS"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF599:
+	.string	"__stub_chflags "
+.LASF817:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF766:
+	.string	"USE_PWM "
+.LASF426:
+	.string	"_SIZET_ "
+.LASF912:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF673:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF838:
+	.string	"USE_UART6 "
+.LASF767:
+	.string	"SERIAL_RX "
+.LASF804:
+	.string	"GPS "
+.LASF758:
+	.string	"I2C2_OVERCLOCK true"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF666:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF644:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF570:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF475:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF819:
+	.string	"USE_FAKE_LED "
+.LASF798:
+	.string	"VTX_COMMON "
+.LASF560:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF847:
+	.string	"USE_ADC"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF725:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF914:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF535:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF808:
+	.string	"SIMULATOR_BUILD "
+.LASF508:
+	.string	"__USE_MISC 1"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF952:
+	.string	"short int"
+.LASF396:
+	.string	"_STDDEF_H "
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF485:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF518:
+	.string	"_SYS_CDEFS_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF548:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF939:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF806:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF907:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF585:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF634:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF409:
+	.string	"__need_ptrdiff_t"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF596:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF846:
+	.string	"TELEMETRY_LTM"
+.LASF546:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF908:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF651:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF972:
+	.string	"__pg_registry_end"
+.LASF894:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF549:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF635:
+	.string	"__SWORD_TYPE long int"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF557:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF648:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF496:
+	.string	"__USE_POSIX 1"
+.LASF734:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF731:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF640:
+	.string	"__U64_TYPE unsigned long int"
+.LASF595:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF902:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF905:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF762:
+	.string	"USE_CLI "
+.LASF799:
+	.string	"VTX_CONTROL "
+.LASF627:
+	.string	"__S16_TYPE short int"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF743:
+	.string	"WINT_MAX (4294967295u)"
+.LASF797:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF564:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF568:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF440:
+	.string	"___int_wchar_t_h "
+.LASF975:
+	.string	"memcpy"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF584:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF669:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF572:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF656:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF696:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF486:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF425:
+	.string	"_GCC_SIZE_T "
+.LASF834:
+	.string	"USE_UART2 "
+.LASF945:
+	.string	"short unsigned int"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF926:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF445:
+	.string	"_BSD_WCHAR_T_"
+.LASF711:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF957:
+	.string	"uint32_t"
+.LASF488:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF645:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF718:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF536:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF493:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF497:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF657:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF878:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF591:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF698:
+	.string	"INT16_MAX (32767)"
+.LASF612:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF649:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF812:
+	.string	"U_ID_0 0"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF650:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF886:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF756:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF931:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF890:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF421:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF383:
+	.string	"unix 1"
+.LASF690:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF959:
+	.string	"float"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF722:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF510:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF985:
+	.string	"base"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF619:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF901:
+	.string	"__bool_true_false_are_defined 1"
+.LASF965:
+	.string	"pgResetFunc"
+.LASF676:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF688:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF788:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF408:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF935:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF541:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF904:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF861:
+	.string	"TELEMETRY_HOTT"
+.LASF652:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF836:
+	.string	"USE_UART4 "
+.LASF478:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF820:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF471:
+	.string	"__USE_LARGEFILE64"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF830:
+	.string	"USE_FAKE_FLASH "
+.LASF892:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF903:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF378:
+	.string	"__linux 1"
+.LASF437:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF779:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF624:
+	.string	"_STRINGS_H 1"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF606:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF681:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF736:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF983:
+	.string	"pgLoad"
+.LASF494:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF675:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF832:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF752:
+	.string	"INTMAX_C(c) c ## L"
+.LASF815:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF575:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF866:
+	.string	"TELEMETRY_IBUS"
+.LASF865:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1016:
+	.string	"libc-header-start.h"
+.LASF1024:
+	.string	"stubs-64.h"
+.LASF1006:
+	.string	"/usr/include"
+.LASF1005:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1032:
+	.string	"stdint-intn.h"
+.LASF1036:
+	.string	"stdbool.h"
+.LASF1027:
+	.string	"strings.h"
+.LASF1026:
+	.string	"__locale_t.h"
+.LASF1000:
+	.string	"src/main/target"
+.LASF1012:
+	.string	"string.h"
+.LASF1033:
+	.string	"platform.h"
+.LASF996:
+	.string	"src/main/build"
+.LASF1010:
+	.string	"stdint-uintn.h"
+.LASF1009:
+	.string	"types.h"
+.LASF1037:
+	.string	"build_config.h"
+.LASF1031:
+	.string	"wchar.h"
+.LASF999:
+	.string	"src/main/target/SITL"
+.LASF1017:
+	.string	"features.h"
+.LASF1030:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1034:
+	.string	"common_fc_pre.h"
+.LASF1025:
+	.string	"locale_t.h"
+.LASF1003:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1038:
+	.string	"maths.h"
+.LASF1008:
+	.string	"stddef.h"
+.LASF1035:
+	.string	"common_fc_post.h"
+.LASF1023:
+	.string	"stubs.h"
+.LASF998:
+	.string	"src/main/config"
+.LASF1011:
+	.string	"parameter_group.h"
+.LASF1018:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/config/parameter_group.c"
+.LASF1021:
+	.string	"cdefs.h"
+.LASF1014:
+	.string	"target.h"
+.LASF1020:
+	.string	"timesize.h"
+.LASF1013:
+	.string	"parameter_group.c"
+.LASF1029:
+	.string	"typesizes.h"
+.LASF1028:
+	.string	"stdint.h"
+.LASF1002:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1001:
+	.string	"src/main"
+.LASF1022:
+	.string	"long-double.h"
+.LASF1004:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1019:
+	.string	"wordsize.h"
+.LASF997:
+	.string	"src/main/common"
+.LASF1015:
+	.string	"stdc-predef.h"
+.LASF1007:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+	.text
+	.section	.gnu.lto_.profile.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375 t\r\003"
+	.string	"\364\004h"
+	.string	"\t"
+	.string	"\230\204\240\345\005\004\002"
+	.string	"\002\001\002\002\002\001\003\313\271\206\370\013\003\002\001\004\376\337\221\353\t\002\007\246\224\252\221\n\002\002\003\002\001\b\323\230\332\233\001"
+	.string	"\t\320\300\217\316\b\004\n\352\203\346\245\007\013\245\200\307\327\n"
+	.string	"\f\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"^\253\204\020\240\2321@\350d\216\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\035\004"
+	.string	"\262\005\016\021\260%\351H\222$I2\264\315\332\226\214\266\245L)\356\0066\005\240'\303\3574\003Q\254\307\314cJ!\225\301^A\237\231\004i[\003\241\f\336\303QtI\211\226\343\202\037"
+	.string	"0@\322\224\201\354B\306\331\247\265\231\023\366@5\204Pj\016\351\2152\022N\306\002\254\bk\0258\253\303\026\313\274\022\007\205\021\241\242\234\031\214\252\200F]\267\033\323\253t\300DP\r\001\260L\266\245V"
+	.string	"\210Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.inline.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\227\001\245\b"
+	.string	"\202\016.1`M\222\016\300adQ\370[-\025\"\353:4*\261\275\235(\007\f\353\267\303@m#\324"
+	.ascii	"\246\270\006.I2\023\246\030\303\326\216\326H#[\356\024?Y\367"
+	.ascii	"\027\365\202\021\024\031!\r92\033\rt4\271k\n/\217\206\016\211"
+	.ascii	"\201\001\236\254\243X\377\247w\247q\001\002\021\rQ\360+=v\037"
+	.ascii	"\002~d\346\363\3633\264\307\340\310\202E\211@\377\022Zi\036\256"
+	.ascii	"\311\322\022eK;\333\202x\331\255\\\333+df\365\317\006\270\323"
+	.ascii	"\373o\275.\341\2547~\227Vdf4\336\237\300\271\311\272\357\311"
+	.ascii	"\302?\200]\n33\241?\300\t\221\r\211\324?L\035*\214\215\202\207"
+	.ascii	"n&% p\002\241)\332\003\031\240\331\305\\\322\224A\3456\232\021"
+	.ascii	"\221\025\210@\360\340Lt\326\252\223\304\212\b\001\324\204\271"
+	.ascii	"a!t\035\224\273\033\313!\326\324\265\204\3050\213\215\005L_\315"
+	.ascii	"\252\211\216i{\324b\320\222\306\312of\264\253\260\237\020\272"
+	.ascii	"\373N\351%\324\035\270\333\323\356\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\027\0015\006"
+	.string	"\002J\033\037\260\247\320\001\254\020@\004P\032\3620,j\323\303$I\003Z\305\367\214\t!d\263\275e\332\001\204;\367\316u\032T\031\361\207\223\204\020\r\355:\322o_\374\033B\225y\311\214b\322\001\337c\352\365\206Q\2547Af&C\250\357\212H\003\177\025\203\211kl\303\027\276\271/I\223\342\372\222c\355\241\355\231h\264;Z\227\224/\035T%$ `\242!G\35788\343\016\f\302\200p\023\332X\007\321\022\343\366\207\006>\004\003-f\303v`qY\204a\2308[\313o\bo6\263\006\302j"
+	.string	"g;0D\004"
+	.ascii	"Y\345T\360\3560\210\001\264X\333^@\230\233\230\030\371\3526\214"
+	.ascii	"i!D`s64\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\003\231\004\004\205\004\007\231\004\b\230\004\t\231"
+	.ascii	"\004\n\231\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"\235\004"
+	.string	"\"F\026!\260%\351"
+	.string	"\3670\n\201\245,\205\201,k"
+	.string	"*\212\222\"\331\007b\273\330f\233m\215\020B\210\334)\267\205a\351\306\332\302\260\365\b2(\034\242!\034@\346I\177I\035~t,\256\261\202kL\212\353!\032\244sTSp\357W\027hf\216\343\250\035)*\335X\360'\002\027"
+	.string	"d\02061\rh5\303i\f\214\035y\301"
+	.ascii	"\332\255\0305\\\003\252V\235\252\007\233E\254\nD\251T\320\301"
+	.ascii	"\324\002 \234S34%E\250\320[n\261X2\200\""
+	.text
+	.section	.gnu.lto_.lto.774dccff93cabd08,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.6.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\020\003E\027"
+	.string	"\346\252\226H\300\224Nc\224\374X\275\035\377\323'\f\2548\334\342\304\267\354{\210\227\324\300\344\237\274x\026\334\256\033\342\260FcI\n\334 \2261Q\307\020\344r\324\324\216\342\016\303I\252\016(C\033h\353\267\253O\213\354\275\345\2262\245\201"
+	.string	"z"
+	.string	"\204"
+	.ascii	"\227z\214\234\2338\266\367\026Yi\335k\256xAy\033\200\376\351"
+	.ascii	"P9\346\245\230JA\026\236zN\261{M\232\315\243\214\267\345O\306"
+	.ascii	"\333\232\344\261i\350*H\323\320\325\327E\363\036)\357\344h\305"
+	.ascii	"Jy\276\316I\223_\317\317\323\237\237\217\216-\204n-p\350\363"
+	.ascii	"\013qQt\020\345\264d\362\353 \326)\241\216\331o\207\326\237G"
+	.ascii	")\001\374\262\372\t\235\222\266{\257\251\317/\350.o\233\204m"
+	.ascii	"\034\233\022\t>Z\221\354\267x\355@\341zd\313,uI\336\374GKmMM"
+	.ascii	"\037\274\017`B\217\360\344\353\336\017\303$\267\313\332`\361"
+	.ascii	"\340o\337\007\276\352\3463|*\002&\234\356\275\263[\341\025\317"
+	.ascii	"\033[Pb\245N\315\364\302\233\007y)\346\r\272V\021\036\256\225"
+	.ascii	"[RE\315\237\362OrE\355A\236\315\347A\302\222(\260{\315\004\267"
+	.ascii	"\246P\336\372\300\033{v{;\307\236\331\344\211Z\245vV\254\257"
+	.ascii	"\262\372c\333\f\005`\021\205\211\025\311e\035\253\016(d\207\""
+	.ascii	"\261/\374\317GH\352:\002V`x\334hkYS\214\364\210\3609\346Z\032"
+	.ascii	"\312{wZ\374,\0162>\023o\274\265\365\301%\251\036\035\372U\267"
+	.ascii	"=\214\250.\363\301\005\024\025V/\274\n\214\222\372c\310\224U"
+	.ascii	"\255H\256\261;\240t/\317}|\032\277\312\211g\272u\315n\274\317"
+	.ascii	"n\274}\360\274\242\336y\361\205\321e\274\302\230\327\245c\266"
+	.ascii	"\031\316\200\273\351\252\033\324n\267\027\005\f`X\006\314\340"
+	.ascii	"h\252_Xh6\344t\270\013\272\233\315M\306E\347BC\303\305`\230\311"
+	.ascii	"\275\320fb\\dh/\272\035\215\305\200s47\035\315&\227\323\321f"
+	.ascii	"f\357\365H\204a%\314\032\217u\213\262Ji\265\255W})\310\212\344"
+	.ascii	"\332\bKV\022\tu\315\353\217s\354J\034\267\327\007<~\036\002\b"
+	.ascii	"#[\217\216]\274\367\336\221\254\017^\005A%\353y\\\370\350\320"
+	.ascii	"?\177  c\264\212\350h+9 @\002B\220\203\347\001\030\221\312\324"
+	.ascii	"\201\021\030n\226A\224P\217\327p\024\251:\242\214\"wP\316\231"
+	.ascii	"\2454\271\360PY\fx*tU\024\312W\247\260\233Hlowuk\360\362\215"
+	.ascii	"+\017>k6MIw\200\326\272\220D\355{\006\266M-)\353\300\370\210"
+	.ascii	"\216\320\\|\345W\311\366^\231\376\210\325\326\226x\346\206a\f"
+	.ascii	"\305\357#\260\324`\347\360T\306\023\324\006[k=u\357\340\031!"
+	.ascii	"\312i\317)6\371}YA2LW \003"
+	.text
+	.section	.gnu.lto_pgResetInstance.8.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\\\003\275\030"
+	.string	"&,\235J\300TU:X\262\212N\305\365\207n\324\275x\243\225\232\2144G\037BK\327\bY\276v\273\302m\350\331\201FK\027\301\211O\025\2734H\324\270U\270\230$\030\244\215\302|\2375@\035z\037X"
+	.string	"w\f\325\215\020\262\211\334I\006\205"
+	.string	"\202"
+	.string	"\210"
+	.string	"\364$1\274)_\307\243\326\351\356}\234\350\366\237\355\002\272\207\226\220t\237\r\366A\371\272\347U\343k\371\231\361uo\273X~\372z\202\223]\260\251\273Y\\\343\267\223c\025\231\336\366\244\253\005\027^/\350\344(\316\300(\242\224\352\355D\006J:b\240zB\264r\213#\274\236\213\213\342\002\246$[T*p\360P=\035\345T\317\204\270\352\356\007OQ\364r\224\222\256\356^\312\353\261\370\226\337]\333\356\352v\331&M\277\354\2369\3124v/6\017\355\236\350\246~\3761'\272\247\377\376\262\244[I\272\"I\227G\272\264\322\275\f"
+	.string	"%\225\224n\025C0=\245\036\345\330\027}\310.j\177\036d/\204\002\016\036\335\215\272\221+w\242E\240\020\211\217&\222H\353\364F?\377\331\006\234\315\342L\272\354V4\275\356\213~vQ\257\177pQ\343R\353?\016\274\035\b\220\330>W\223'L\335'\315\353f(_\003\3201J+\247\335\035\304L^\n|\335B\347\355\227\\x#.\206\327x\336k\314\001J\321Q/\273\253\341G\033TV\226\303\223\340\274\246|\335MY\365K\222\241g\232\307\360n\314\244\347\355J\210\203\370\2730*\242\244\024\037\310\037\274\r\221\263\013\023\202\341e\343\211SL@\270{\221\333\331\215"
+	.ascii	"\225\335:\t\373\"; \3667l\343\353\211\037\\\372\341\350p?\344"
+	.ascii	"U\313\214\013\371\211J\226\0242\264\224|\243\257p\364\313\252"
+	.ascii	"z$\005\373\301\0341\273\221\2315\322\354\201\345\210\033\241"
+	.ascii	"e\2321\007\020:\324\030\220\2315\336X\r\217\bZM\206S3}L\035X"
+	.ascii	"\r\306\303\222\315<\354\320b\254\235\031L\207\025\253\365\260"
+	.ascii	"j\022,\215\307\254\261|h\264\032\013u\342.6\017U(Sp\234#\017"
+	.ascii	"\320*\362\256LT\276\021\312\"S(&\022\265!\243\312\216\261\302"
+	.ascii	"\310\\\002x\20523\013waB\b\331\306\217\"\244Z\200\236)[\2601"
+	.ascii	"\225\354\022\"\036>\221i\354\221^\0276\271\300?\340\023\035\365"
+	.ascii	"\022F\250a\030\207\024s\n)\tDFdH\n\322\001`\002\021\242u\007"
+	.ascii	"\022`7*\025l\333\365\177\003Uj\307\364\177P\215\3521i\255k\213"
+	.ascii	"\367\354\271P\002/-Z\256\362\337C\256K\332m\340hUUghJ\245\201"
+	.ascii	"\345\356\036\207%L\0010\204\300q\023\210bU\314n\fN\300\364?\356"
+	.ascii	"\366\004y\nOj\336\032&\253\230\027cS[b\334\230\004~ \274b\305"
+	.ascii	"\t\273*\237k\346\256\350\372\b1\201\320/\232\340\375n~\0354\021"
+	.ascii	"\377l@\030T\361%6\314r\266\260'&UAr\323(*"
+	.text
+	.section	.gnu.lto_pgReset.9.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"u\f"
+	.string	"\326WVC"
+	.string	"oj:\200\023@\340\216\221\313\250\n\\Wm\317c\323C+L@\237\323\241;D;\032\177F]C\204?70<\260\222\333\235\"I\024\367\002\327\035@\204\003\025\244\013\002\371q_\310\303bw\224;\245A"
+	.string	"D"
+	.string	"C"
+	.string	"\036\377"
+	.string	"/\236.`w\225\242\305\356\250\300\f,\237\036\237\301>-\037\200}\032\264c\024H\001xe0\361\332]MA\034\274\004\375\203\374\242\342@]V \354\256\245\212\203\303\255\267}\300\266\004\373[z\361\227\0233\202"
+	.string	"\213\335\r'3\3265]\210\360C\3362}\364E\346\007\211\335\315\316\242l\207"
+	.string	"\273\241\342E\262;&\370\254\2448\227g\231.\236TC\004\217\025$\237~\210\311\316>\237\331X\t\316\245\375\232\224\242~\220wJ\\a\313\243\243(Yv7\036\370'0\\\360C\234\260OU\f\f1\224'~\353\235\017#\027\371\245\303\303\013\251g]\023J\023gJFV\232\330\243\206\324\016\373\224\335]\353\312V\351v\300\351:nA\003\n\033\003\236\356Ss\033Q\311\373<\023\276\216\324\201\266o\023i\236O\205\220\307i\241\317\006\322\270o\244m\020\330\023u\237F\362\274O\313\306\360\224\325\225\247\fW\250\032\276HU\251\266gA^\345\023"
+	.ascii	"\246s\240\f\3532\272X|\307\312l,um\237Y\353\262\033\315\305\340"
+	.ascii	"\202\345\307^\016\355\353\330\260\007k\203\252QT+}+)\341\016"
+	.ascii	"/\332I\006"
+	.text
+	.section	.gnu.lto_pgResetCopy.10.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`P\001\335\016"
+	.string	"F\235hE\360r\225\016\206\232\330\242\272\364\345\252a\341\222=s\264t\202_\366y\244\254\f\037^5\360\323\276\351\373{\263\031\204:B0\217`\245\020\217\243\233P\263dBg\340\222\207\022\243\304,\321\257\267\320\337\204H\231RV"
+	.string	"T"
+	.string	"Q"
+	.ascii	"\263\031s"
+	.string	"\216\013\354`s\317\343\013\310{\233\023\220\367l\273\301\b\312)\003\256}\231y\331z\3149~{\342\251w\253)_\365nw\330L\340\200\021S\371v\tB\244\300\005\210\265:\221\0331V\334vM\211\261T5\2409\247\025\026\373p{\267Mb{\202\375\022\001\277\346\265[\236\345\357\254\326N\375\220\345\360\272\211\360\230\263C\016\310\254\341\321\230\275\366\333(\337f\216\024\361\261k'\020K\003IL\016f\316Q\301=K\330H\017\237n\274\013\324YP\354\315I\002\027asO\200J\327G\325>\213\267@\235f\035\0370\247,rm\f$=\314\035\327\252\f\240\005\204\313i*r\240\330]\361ORn\205\027/-\375am\211\271\310}\355\235\225\312x\243_;\203\211\036&\267\323Z\225\273\375\356\314+\310Js\276\355\336\f\306G\314T\031{T\351\256\330\357\346\234\323+\263O\013#P\334\322\310\264\036\201"
+	.string	"\202\"\006\017,x\016\240\230BQg\221\307t\n\305\021\005\021<\001I!1d\372F%\027J\241\350+\225\204H\237H4\371<\b\034\232@\361;\tC\361\343\214\363+\263\264\261\341&C\375\224\034q\303\355\237\222\272)\266u\rZ-\253\223*\034\325l\024"
+	.ascii	"\2673\260\306\f\243\212*\357Zv\230\275T\033N\204h] \036w\353"
+	.ascii	"\256\262\320]\003\315\026\274((t!2\247\302\177j\024\034k\240"
+	.ascii	"j\221*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_pgLoad.11.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\376\002]\026"
+	.string	"\266(\221J\320\362\2501\242\"\300\034\224\031f\243j\313n\365\340p\363\370I\236\017VI\237\223\236\237D=\306\312\t\026\006\t\251\024\001\272\001V\376\302\276R\036\016\265m\006\245\213\331\2616\307'\232k8\022kh\r6\b\331{o)S\nw"
+	.string	"|"
+	.string	"{"
+	.string	"\301{\357\211%\250>\226\210\243\317U\353\213z\336\221\343\201\352\343\250\302\365z\"_\350C\266\363j\037p\257\317R\360\336\336\211UT\037\335;\001\362\243\352#\344G\333l\035\357\221\2707\322\321!\r\357\275-;\342\266\213\266\332\374\373\276\302\331\325\\Tu\270\025Ul\206 "
+	.ascii	"\354r\"\313\207\256\306}\257\033v\270Z\313\225{\257+\316n\347"
+	.ascii	"\036o{\201m\r\2665\t_=\351/\311j\362\274_\264\325\027!y3\n\370"
+	.ascii	"\356\325\231\002re\214P'|\247?\321\202c\021\013\340\r \355\274"
+	.ascii	"\032I\357\356\034\306P\367\301\211f\233\377\321\\\311or\3603"
+	.ascii	"\317\264\202\273\271\342\317\303\360\300\307\322\206\211\346"
+	.ascii	"\274\232\275\271bS\215\033B\303\217\376\022\215m~\254\276\222"
+	.ascii	"\3156\3551\206/\311BQ\300\315\211\310a\201r\331z$\177\305\215"
+	.ascii	"l?\262\320\253{{\200\004B\322\264!\226D\230!\b\316\257\277\200"
+	.ascii	"\231\366\300\247\217=zn\360\253\241\250\034\024@2\205H%\255h"
+	.ascii	"\355\230\254"
+	.string	"\036\307%6\266\346\367\035B\020\007\251\250\333\317\027\356b\246\2727\247\300o1\203\372&j\344G\322\006\300\301\273\325)\377\367\b!h\274\351\rJ\004\245x\210\366L/\271\325\037\256IA4n\375a\367p\325\376\330\027\357\275\327\326\307~\357g\225\325fY\035\362\243\007\266\360\202\312b\322s\246<1\310b\304\031\232\272\210N\340:OX\n\202\n(\006bgj\rC\201\241\241i\254%=e\316\331+}\301\264b2\227\027\024\326z\221\275f-X\032\323B11\ns\246-\031\024M[f\357v\353\303\200H\306\315\342\304\221\272\262\254\t,\244\255qi\335b\013\353M\216\347\336\233Rm#\310\343\261\366\307\245\275\245`\204#W}8\304\336^\027\344V\247V@A@RQ\254;9 p\002\221\271\264\003\320\206t\246?p\236\341\035\007\355V>\301\333#\272\303\275\2331l?\201L\016Y'\315"
+	.ascii	" +*\230\032\266\332\275\223\371,\304\326$Wf\260*.\254d\275\214"
+	.ascii	"\205\342f\366aq={\t7\361?\324`#Bb0M`\227\250\370\241\2451\017"
+	.ascii	"\207n\234\020coZ#^\243\260\037\351K\030T~\021\321\013\227|\344"
+	.ascii	"\271y<w\243\233!\273\271\2701\304@\361\\L;40\003\005"
+	.text
+	.section	.gnu.lto_pgStore.12.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\275\002\335\024"
+	.string	"\366\346\210J\320\320*\035\362cf\347\r\300Rb\202Z\251\037\230\275C\327TQ\025\252b\030\247.\233\316\022\330\247D\325d\324\326\273\307\220k3z56\004m\037\306"
+	.string	"9\007GY\263A<|\227\274A~@g\b`\006\033\"D\356\224\002n"
+	.string	"u"
+	.string	"p"
+	.string	"\2431\220#Lj\351u\034\364\251\326\030\033\300Zk\210/\264\244h\216o\020U ?\216\267\324\251\375\233\343\320~\316>\240\326]\017\260\3263\304\017\310\217>I\333\376\212\333\320\354\240x\232\310\235\304\fn'\251\326\212\372\270\201\322G\361\005J\037\267\304i\2474\377\275\213508Xr\265S\323H\255\325\224%\367r\357m7\260\235b\257)\037\227zM\324t\251\037\240DT\224`\250\326\226!\217\032cd\221\302\377y\020\fx\312\005\223\200~@\260\237\263\003g}\271\220\020\347\362\003\263\313\373\330\245e\347\361\177cM\250\246\326Z~\364\215\334V\252\350\203\341\001\371h\372\220:\275O\366s\266+U\374\315\240a\223\364\321\357\221\331\345Gj\323\374\236\313Q&e\363:\2205\027\262'\343\304Q\255\025\344\001\273\347\2118\272\322~wMUt\334\350\320\246\375\036\327\303F\207\177\357"
+	.string	"v4*\204G\013\2067K\344\232\026A\020\027\342f\326]\264\310ZS$\370-b%>\212\331~\247\306\215\215\016\375\240\217H1\007\376T\224\003\304\b\244q\017\364\017\033\335a\312\0332\252t\207}\336\350\312\330\027\353\356\354\023u\371\234\377DR\223$\265\351:\177\351\347\003\346`\226\250b\242\351\241\005\023]1\352\b)\323\\9\200\240AD\001\313|\255W\"(2\327\213E\3622c\246\211\352\245BA\261Z\033N\\+\324IKe\202Z\275`(\021\006v\241\230/T\314\345z\241\312\323\366\335\331\366\356\004\235mo.\301 @\351\226{Z;\003\t=\213K\235\312\326N:\232Sxd\363\261\352C\253r\005\370\334\202\b\243\337)\314"
+	.ascii	"\205\276\177\330(\345\2750\n2 p\")wwU#\233i\006J\030N#\\\371"
+	.ascii	"5;k\301\371\032\206\265|\350c\251M\264r\312#[\334Y\"\375A\024"
+	.ascii	"c\320\2141.\272\315\241\244/\234\315\004\356X\005\233\\\301^"
+	.ascii	"k\342\202/6\200x\017AP7F\223\3305V|\361\3222\256\307\267\367"
+	.ascii	"Fq\221C\356\373W\311\032\217oc\326\313\332A\313\r\252\243\211"
+	.ascii	"\n\340\323\356\023\244\230\256G\006"
+	.text
+	.section	.gnu.lto_pgResetAll.13.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\206\001}\017"
+	.string	"F\\gG\360\260(\035\340\254:\rW\375\200:U\344\035\362\242\326\037\321\272*\037<\304\035h6\272\"`\264\b\375\246mo\225\006\036\224\327\274[v\262\021\233\004OBF!\033\365"
+	.string	"\272L\263\316\276\\\226\266\372\215\354-wJ\001S"
+	.string	"O"
+	.string	"Q"
+	.string	"0\373\031\023\030Z\340\330\335M=X\213Y\241\231\021\263BC\3432\274eL}J\215)_\346\005Xl|\240\352S~Z\257\020\002\300\226\374\220\355\324<|L\001YQ\216P\271>|\002\026\233\017Ty\374\200\354\256\343\007j\270\265\333\276`;\202\375\017\0013;TE}\261\377\001#\333\261\272\330\363\260\373\232&\313\351\210\261\373\352\311\2618\263F\304a\277}\2313\362Q\370\241CRg\364\024W\221:\314\302\327\225\001\300K\306\211\235\335P\301\247\031\200>\035\236\200\366\t\372"
+	.ascii	"\355\363!\247\354\032\017\003 \2538\273\334\335\225S\017\273"
+	.ascii	"\007\002\235z\027\tV\354\361ob<:\237x\265IL\342?{\240\250\312"
+	.ascii	"\001b7T]\330\264@\325\027\026\250\0030\273\256\177\376\212\317"
+	.ascii	"T\220\007\361\351\023\224\366\357\323G\301\236\352\260\2123?"
+	.ascii	"\274,\321\022c<:\033\003v0\342\270\322\202\006\023D\035&\316"
+	.ascii	"S\227D'\223\3163I\360\270\022N\204\344\221N\233)\204\302HW\332"
+	.ascii	"FBH\"[\311#\331D\006\334\2358o+\351:o\013\205{u\2219(6\303Y)"
+	.ascii	"k\352\213G\034t\352G\026}rM1\f\024\350Ew}p\203\022e\0206\264"
+	.ascii	"\254\006! `\002)F\365\246\016\f2\354\026\2032\016}E\241\020\261"
+	.ascii	"\354\216\313\311\354\342lOA\024\342\356\b\315(\215\257`\355z"
+	.ascii	"\313*\261vk\"j\374\205\355D\262j_^%uPh\345\204>\256\3502\263"
+	.ascii	"\354\006>\003\025\203\274\224;W\177\002"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.26.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\244\005\235\037"
+	.string	"\306u\274H\240\230UcRdq\201\346\263\214\220#\321S\252{\3564\034r+\033CN\013\020;\220\342\351\263\303\341\252r\022\315\362th7C=\367x\310M|\2051y\215\274.\324\217\252\fk\300\302\022S\333g\337\377{K\231R\234"
+	.string	"\255"
+	.string	"\244"
+	.ascii	"\367F8\241\222\220\2344\t\334_\215\037\244C\240?\253\3153\323"
+	.ascii	"\0334<\227ff\375\021\337\350G\275\033q\322\257{id!\357\275\036"
+	.ascii	"\320\2371\263\210\263\030\231\331\372\242\"\316Re\003\357D;\n"
+	.ascii	"\322\333bx\016\315j}\352\013\371\220\336\211v^\340^\033H\220"
+	.ascii	"\367\246\020~z\002\372\323\351\021\264~\242?\320\372i\177\310"
+	.ascii	"6o\350\236\215\345i\361\276\b(htu\357\225\375\2648\336\273\255"
+	.ascii	"f\317\377\361/\237 \236[\230 \027\257\006n\272h\356\275F_\334"
+	.ascii	"\347m\317\330\376\261\317d\007ZUlC\323#\004\376\322\030\333\266"
+	.ascii	"\261B\240i\364B)\373y\343]\366\225\270)/\245\343\017\252\251"
+	.ascii	"G\301A\031\360\344\370\203*\211\n\307\264\234\302IE\371NN\236"
+	.ascii	"#\206\"\240\252{\323'(\247\246\234c\277S9\373\323\215\276\023"
+	.ascii	"\225\231}\247\246\034\3123D\221\250dT\371\240\3117\311ar\022"
+	.ascii	"12)\231r\336t\025\214\221\314\261a_b\303\274\273\022\177IC\022"
+	.ascii	"\330O%\232\036\3415\223\b]\305\374t\001\225v'\332\261\302k&A"
+	.ascii	"Q\006\271B\356x\376\3210\333\274z\341\372`\304\374\364\215=\033"
+	.ascii	"\366\363\204\235\254\302\037\361\006=\016\361.#\320{\177\025"
+	.ascii	"|.*h\276\216\235\326\317joDe\210\257~\361\225?\255hL\371\353"
+	.ascii	"\211\226\037\037V\327^\312c>"
+	.string	"\250\237\305\021\220\251[\355\r\253\337\370Z\261|\244\333\202\257b\331\232\366\206}\363Z\033\366\213\376\027L5*\240\332eV\267~\344?\315j3@\265\rP]\237\376\007P\340A\326\275@_\262.\361\\\332\361\247k\261\204\031\236m\346\025\002Z+\022frl{Z\004\022qU\025\244\305\026\216\371\322\342p\210\205\347\233y\213@\223\205\225_\301\371V\323\342\020g\031\214A\240>5\033\232\216i\0237\271\333NWC\341\252\245\270\355L\\NW\302\364\314\254V\253\211@\201\204\f\003[Mg]#\203s\"\247\263\215\320\325tj8\232\216\206#\263\335J\334\344jd77\032NV\243\333\311d\0348\207S\323\311tr9\235\254\376x\364\210H\312g{l\202\352\262/\213Z\233C\207z\037O \256\260<\366\243^D\036\310e\225O\312\037\276\004\201\332\001R\3470c\312\3113\344@.\243\036\363\271"
+	.string	"\034\rM\335\212\345\226\375\223\311\204xZ\323\266\254\353\212-\326\232\366A/\276\224\037\3520=x\244\313\252\006_~kUk\355\202dP(z\250q8\243\214S\310\024\311\314\222\024&c\220\002\0212c\035\022"
+	.ascii	"\227\245v\254F\024\026\246\240T\254o\320\326\322R\272D\312k\363"
+	.ascii	"\021\370p\346\234\t\246\323\233\315\334\317\367&\344\377\213"
+	.ascii	"\235\036\315\355f\232\232n\322\020\266\205\017\346\366\322\212"
+	.ascii	"*#\0300\277\277\214d(\3529\213b\252\334\353\0073!A\215\003\370"
+	.ascii	"R\334\263Mf\n\177\353\276\216\240\305\371\035_\242\242\221\n"
+	.ascii	"\305\266\342\002\225\221m\210oG\202\235;\2461A\205K\261R\037"
+	.ascii	"\177\241\302\262\304\202\304I`\035<\036\375\006Z\377Q\3450\337"
+	.ascii	"a\330z3\304\273U\216\007\022\013\310\006\207\302\243\220'\036"
+	.ascii	"E\236f\266\356\207_1\351\320\241\2512Z\374\021\237\t\303\322"
+	.ascii	"\360\236\004\315\030|\016\n:\225]\304\t;\251_-\002\234l\373?"
+	.ascii	"\311\001\324\006!\342\326\340swm\177\247\322\034\272\261\277"
+	.ascii	"sz\346[j\026 \037\346\331\247z\321\227\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\245\007"
+	.string	"D\013\226\001"
+	.string	""
+	.string	""
+	.string	"\002\b\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\021\017`\022\020\002\032\177\021\224\202\202\200 \006\177\022\252\333\3426\272\220\202\002\017\023\005\016\024\002\t\177\025\002\n\177\026\013\177\027\f\177\030\r\177\031\360\372\2508"
+	.string	"\032\301\204\001\023\177\033\377\037"
+	.string	""
+	.string	"\200\220\200\001\020\177\034\003"
+	.string	"\344\006\003"
+	.string	"\r\250\270\275\324"
+	.string	"\001\244\n\004"
+	.string	"\264\345\241\253\002\001\225\016\003\003\r\204\013\003\007"
+	.string	"\342\001\003\b\004b\003\b"
+	.string	"\250\353\264\276\001\001\202\006\003\t\t\003\240\276\320\347"
+	.string	"\001\302\n\003\n\304\n\003\013\007\221\205\327\307\003\001\242\001"
+	.string	"\031"
+	.ascii	"D\310\311P[\201\241]C\013\2641>V\326|*\263\036S\244\004\303\363"
+	.ascii	"\251\315\312\b\203\030\360\r\360\215\235\237\222f@\210#I\210"
+	.ascii	"\001\002o\r\204\bdz\006z)!\200\361\264\226'"
+	.text
+	.section	.gnu.lto_.refs.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\016"
+	.string	"\002\002\017"
+	.string	"\002\004\002\005\024"
+	.string	"\002\006\021"
+	.string	"\002\013\002\005\f"
+	.string	"\002\006\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.774dccff93cabd08,"e",@progbits
+	.string	"(\265/\375`\325\023%`"
+	.string	"\212\237\020#R0R\312I\007\237S>\037?fj\353\376\357uo\"\367\177\031\211\212\213\213\213\250K\313\241\262\223e\375\216\236:ec[\037f\315\245\273\241\353p\246I\273\035Y \312\230;\3444\300\"\200\250*\273\332\n\331\252B\262J+\373\347vC\"\261\255\224)\326\001\037\002%\002m<\206\3358\f\263\261\030^\031\f\217\235\2710\021\312{\357\031\214\301\360\025\326\302jT\036d\241\315\335\253\2520\241\342\246\315\356\210Z\216U\037\207\200\321r\004)os??\005j\334\205\275\364T$\367NU\031\260\026\207\003\317y\257\372\205\327xe\265\233P\357U\241\242"
+	.string	"\2344c\234RP/i\277,8\234\216\3322\032\257fHSLf\274\362\331\313\374\356E@\347(\t^U[.{\334\r$\016\244\266\267\373\230\345\241\005\nZ\333\263Rz\276\221vO\016bi\2309\250\032\322\027S\036\202\261\360\232\202\263\234\205`\260\327$\325\253v\021\274\257\255\266'J\317)\320\336\363\311)\320\017\245\315$\320\035\036"
+	.string	"=\f\351[H\177\366\352\252Y\313\352\322\332\376\334\305\\\315\206\226d\324\226\251\260\026\257'\270\312+`\361\036R\353f\335\253\352\340\3449\311K\323\366(\244\277\237\363\326\t\320\272,\216\246\347\023(?\371\004\372Nw\230\004\212\"\312\317P8+Eo\231\324\274^\367\252<\251R\f,\253\355U\036"
+	.string	"M\231\004\n\243J\211\277O p\003\231\277\201\342\330\206\242\223\370\333\205\237q\214\377\267\212\027\340o\022\314#d\006\376\377\3766\341\277\021<\343?\030.b"
+	.ascii	"\376\346\340?\332\3172~\016\006\345\361\f\377\277\374\f\364?"
+	.ascii	"\f\257 \303Z\032\214\237c\260{\226\377mL\300\013\377a\344\374"
+	.ascii	"\355\300\317,\374L\302\317\030\374\354\363s\004?\333\374\374"
+	.ascii	"\300\317'~.\340\347\022?\007\360s\316\317\374\377\371\377\356"
+	.ascii	"\377\334\177\271\377o\377\213\376\013\377s\375\027\373\257\302"
+	.ascii	"\3772\377\343\376w\375\207\373O\346\177\326\377\023\377\315\376"
+	.ascii	"\333<\237\317\347\337j\177\257\360\3530\003}#E\362\226RS\217"
+	.ascii	"\255\322:\363\352\345\373\306N\334\023\255\266}\304\316\237\221"
+	.ascii	":\253(m\333\306\345\230\255l\352\207\266\275\303\307|fiR?\310"
+	.ascii	"\322\267\225\324.\177\336\310F\356\250W\312\311\212\231\312<"
+	.ascii	"\3455I{x?\347#\216\340\247Ej]\344\315\326\017HW\316{\237 \370"
+	.ascii	")\305m)\313c\352\202;S\263~JJE\232m\361\270f`\226H\271x0\271"
+	.ascii	"\265}G\245(\327\017\233a\272s\335\353\370.U\257\322\006eJw\316"
+	.ascii	"\333\304\354\371\331\210\363\335}iH\"dm\331\216\235\350\022\346"
+	.ascii	"\2234N477\206\230\231{S\373\f\031\226X\333\225\317\360\230zs"
+	.ascii	"\354\272\310\374\340\256\236V\226\335\224\270\364\357\037\275"
+	.ascii	"\227\251F\275L\243\337\271\206\271\347\307\341\036/\360\337\336"
+	.ascii	"\373\277\227\200\325\275Psu\251\022,I\247\243\270\036\334K\245"
+	.ascii	"L2\227k\024\222g\271&\357\262\212\332\022\317R\275@J\334u\352"
+	.ascii	".\325&\3226\221}\325\253\214Z\272\312&\222\270T/\363\252M\344"
+	.ascii	"\316U.\355,\325$r\271F-\361rm.\361\\\345E^e\022H\252l.-\317\232"
+	.ascii	"K;\3135\271\264TF-\361U\233\227\277\210\251QH\033wM\342\334{"
+	.ascii	"\223T+\344\357\336$\363\"\327:\307\215\232\313q}\\Vs\242N\335"
+	.ascii	"{\357Ez\271I5mT\243\253\266\274j\312\260q\257\333\315a\001\222"
+	.ascii	"\221\352\275\367\350\032!\371^\033*\363^\243\346\fMM\006s\304"
+	.ascii	"\274"
+	.string	"8W\231L2\222j\376l\0305\217\356\025\020^Z\256RM\n\264p\255V\327HE\262\325u\213b\246+R\275L\207\263\026iJ\022\2531\"\365D\323V- \375\301\003\253J\027\227\212\246\0219Ck\233E\275\311\342\343kG\307\251\031i2\365\324pdzgE\254um\337T\023>$\037\300\274\260\244\347,\225\275\334\246|qW\226\2270\336\302\344\214\245\220\261\032\2535\355\\\345\020psY`\330\nw\345 y\356\235J\263\n=\226b1iK\266\355-9Mhasb\355\245$\310\332\244\355%H\265z,-\265m-WqIE\264\355,\037\3735\211q\0021\2045\222Z\036\332\311;\212\223\006\353\261\375.R\353*\371\300\260\326\316\234w\331\324\223\203$\027\025d}\203\275\255T\300\342qB!\\\\m\373\353\3555\204\216k\331\325^H\340\204\310\323\2216\227\004Pw@\216\250\002"
+	.ascii	"\325\232\221%m\233?\206\366V\347\b[\002\325\266\265.\207#\004"
+	.ascii	"\025\252\247\246\222&\305f\324\266\245\364\024^o\326*\312lR\257"
+	.ascii	"WN\330\321\227Y\333\333\243\364:\360\315\320\206\362\316\372"
+	.ascii	"ml\302|\004\211z\246\177?\261\322\346du\227\276G\2272\327\317"
+	.ascii	"\033\311ym$\335\304*\325\273\204V\371\362\261\305y\231d\020\360"
+	.ascii	"\030Q\273\352%\274\3664\223w\222Vr\033\245zW\2336:(\257\257\364"
+	.ascii	"\334\203\352p\017\212\202\007@m\317Ij\307\252\252\372H\007[X"
+	.ascii	"sHxSiGp\326\230\306\334\252\324\326QQu\020lC\224\356\260\254"
+	.ascii	"\026\223\251\252\310;\2101\024G\022+!m\233\310\027'\324\231\266"
+	.ascii	"=DHZs\346\307\217\026\362\206g\201xv=\001\362\026\322S7[A\360"
+	.ascii	"\232\264\355\251n\251\016\362\236\352\250\237R\355){o\222Y\201"
+	.ascii	"\034f\005j\306\214$\267P\373^"
+	.string	"3\355\346\343j\312\324\352\242\364v\244\350\021'\247\206\342\246\333\203sViy\322=\275\241\030\213\333\212\306\331\245\231\243G\333\367\222\322\036\021?o\037|\320a\325K\332\272\214q\246\275\265\237\367\216\357\350\036<h\322\272\310\0346%\244+'Zg\206\346\211\311\324p\345%I\323=\232\307\257\311>\332rPi\373f\302\001&\035bm\251\217\211yf3\215pa@\271\211RF\361\262\364fb\247\375\361\004E\305[\320\273)<\240xIod\324:\320{Ym*1;\307[G\016\335\221\321S\333Nbg\017\351k\r\253m#]\356\306.\257\351\254A\322\312\306\321\312G!QO8$2\026\201,\004\2116G\2401F\f\024\202\304\027A\"z\002\320\030\024\022\025\217F\037\340\020\215\"!!\221O\321H\303\207\200\242\"\032B\341P\350;\002\2416\f\2132\216C\241/F\020\260\310\326 \n\315"
+	.string	"\316@/cE\t*\270x\341s\004\006\213AG\024G\240\n~h\020\032\026\265"
+	.string	"\026\207-f"
+	.string	"\217\306\032/t\212\212>"
+	.string	""
+	.string	"X\034\036_\004\211\276\242\341\020\004\240\232\032\304a\013\037\211!!\220gHH\024B\220\210\242\023\2548\026\203\210+\206\202\206%\004\2118CB`"
+	.ascii	"\307b\320\321\b\024t\f\032\002\n\022\201\200\004\270\020PH\030"
+	.ascii	"t4\n]\350\\\210\250\b\024\002\203\351-\270@\202\0132\270\301"
+	.ascii	"w\274\214\006>$\002\213>\307\341\260\350s#$\244\021\302\021h"
+	.ascii	"\274\021\306\350#\320\b,\326\030\201j\024\217F\242 0\205 \361"
+	.ascii	"w\004\022\006\2115\302 \261w\004\272\200\202\024\210\003\221"
+	.ascii	"\321\032\215\300\342\320P\220\257\006q(d\217@\031\034\205D4|"
+	.ascii	"g\201\001\020(4\201\005C+\016\270\006\032\264@\261\302\t\"\244"
+	.ascii	"B+\2104\206\305 P\021x\004\316\b*\006\021}\202D1\204C!\037!Q"
+	.ascii	"\320\f"
+	.ascii	"\037\241\242\321g\005\003\305#\261g\004\224\315\024\326\025^"
+	.ascii	"\333\266\3533\274~\254\321\250\353\275W''ML\233[Xz\203\357\357"
+	.ascii	"\272\326q\363\314\"b\245\255\217l\256\351\346\332\214\013\031"
+	.ascii	"\234"
+	.string	"HWE\274\315p\341 IR\311y\3115S\032s\207*e\370\216\311\336\274T\265E\337:\356\255\341FH\341\212\322\035\2317\\\027\312d*\2514%\rz\035u\211y\273\231\351\001\304\251m\207\351\266&VV\306\224Q\002\027&\245m\2635\030\035*\253/\261\266\237c:\257\234ok\rv}:\240\244\021\362\205\237\354\364\343\006\332\372\270\227\3519\201$\271^\270\344\250My\016i\353\203\202\326ih\275{}\030ae\261\316\272\007\035\"\244\316\270\265\365\331\221\265\031Y\227\271@\022\345\220\256\234]\336e\254\245\327\345\207\243$W\251mr\345\215\345Js\321i\2727\351\366\224\327\007\236\325\r\025$*_\302\336\\\036\201\232\250\221 \207\240D#2#\"\222$I\032\003\021\005\204 \006\261e\035\022\340\005=T\"63CA\222\354\327\001\331[1\217\263W\212)$\377\271\303\256\373\330\272_j-"
+	.ascii	"\025!\216%\264\"\t_\254\234$\205\265\035\331=\264\020\311r\311"
+	.ascii	"\036\236\26682\234\\\264\311\250v\234R\342^\312\343\247od/\371"
+	.ascii	"M\200CS\231ir\2736o\376\021\222\r\377\271\341\320\371q\321\214"
+	.ascii	"D\3719?\221\013\271*\026\033\237\230%\344(\230\200x\360\013\331"
+	.ascii	"\023\326\224\202\370\266\f\t\352pH\246\252\342\316,@\027\337"
+	.ascii	"#\375\272\305\363b\253"
+	.string	"\226\313\374\222\b\033@h\003B\342\205sU\320\354\006R\013Nz:+\235\r\t\362\270\230\036\002*\236_x\322\332\246N\236\374+y\342I\310(\232\304\371S\037Y\331\225a\376\013\204\274\350\216\230\270\216l\223b^\025\212\270r\274\220d\017o\001W\267\205&\372\336u\303\361\027\026\202\344;\231\333\304\224f\252\311\341\302\271\bN{\371)\f\\/\322\225\340\200\\\023v\257\260\036@\211\352\021\254\370\217`\271\270\267\316\314\243\252$UD\336\251\023\323q\003\n\237BXf$C\317\214ROV\205\037mX?q&IA\224z\034\021J \"\034g4Q\313U\325z\034\302h\221\344\307\272e[\213`\026\210\243x#Q\204\206\376\006R\027!b\346\225\362\250\263\201\026\255\355\307\177\332\236\334)\227\303_\215\251N\372!\356\230hx\027\361\2321Z\377\035=\321 o4\216<'\002\335\037FZ\fD\303"
+	.string	"}\373\026\346\020\233iB\242cF=2n\253\004l\345/\302\273\203G\377\217\245\254\303\246\245\204\265\026\001\217L\360\\'\331(\371s)\026\232\220Y\216Y\335:\355\004\341y\211\002\215\361.-\247\007#\235\374\036+\r\020\334\r\327\346\213\207\323\026\210\315\021\002($#i;\317\203R\003\"\256\321#\332\317\350SH\334\177'\002\345\240\274\212\273\337\303\216a\252\262\376[\001\177\017\223j\364"
+	.string	"\037]\274\362q\204\243\375(\276q\217\304\b\347Z\035\220ViD\025K\236\2304\202\224^|\341(L\203\t?\323\335\327\336]\0201\351kp<\256\314\362\2754\223\315q\250< \270,\2110\334\034\234>R@h/\201uq\257DER\025\252\213$\370Hh!\262\343\336|\224e2\2236\001\221Fx\207[0\212\225jU\0216l\250\206\205\204\2571\374\340\362\217\017pB\325\300I\365_k"
+	.ascii	"\230\204\n\344d*\301\213\346~p\200x$&\034\306\027/\025|/v\200"
+	.ascii	"\330\226\033\341\305\004\004\rS\255\007_\221\357\217\217_\377"
+	.ascii	"\032B\271\305\36158\332\374417\004l\006=\235t\303\277\357\221"
+	.ascii	"\276f\334\301\331\307t\304\232\341\250\314\331\274?;\207\fs\007"
+	.ascii	"KE|\311\030!\354\270\236\324\016Tw\210\370\343\350F\262\275\265"
+	.ascii	"\253\340\347\357\203\313\301x@L\004G\317\327\335\3169=\374\024"
+	.ascii	"\207EMg\331\234\374m`\201\260\001\263\361\n\265Q\240\262\327"
+	.ascii	"\274*"
+	.text
+	.section	.gnu.lto_.symtab.774dccff93cabd08,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.774dccff93cabd08,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10520 @@
+	.file	"accgyro_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/exti.h"
+	.file 10 "./src/main/drivers/bus_i2c.h"
+	.file 11 "./src/main/drivers/bus.h"
+	.file 12 "./src/main/common/axis.h"
+	.file 13 "./src/main/drivers/sensor.h"
+	.file 14 "./src/main/drivers/accgyro/accgyro.h"
+	.file 15 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 16 "./src/main/drivers/accgyro/accgyro_fake.h"
+	.file 17 "./src/main/drivers/accgyro/accgyro_fake.c"
+	.file 18 "/usr/include/pthread.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	accgyro_fake.c.325947f2
+	.weak	accgyro_fake.c.325947f2
+accgyro_fake.c.325947f2:
+	.long	0xa84
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF1402
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1242
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1243
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1244
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1245
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1246
+	.uleb128 0x2
+	.long	.LASF1247
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1248
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1249
+	.uleb128 0x2
+	.long	.LASF1250
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1251
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1252
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1253
+	.uleb128 0x1f
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1254
+	.uleb128 0x2
+	.long	.LASF1255
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1256
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1257
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1258
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1259
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x20
+	.long	.LASF1403
+	.byte	0x4
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x4
+	.byte	0xd4
+	.byte	0x9
+	.long	0xfe
+	.uleb128 0x1
+	.long	.LASF1264
+	.byte	0x4
+	.byte	0xd6
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1260
+	.byte	0x4
+	.byte	0xd7
+	.byte	0x3
+	.long	0xe7
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1261
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1262
+	.uleb128 0xe
+	.long	0x98
+	.long	0x128
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1263
+	.uleb128 0x8
+	.long	.LASF1268
+	.byte	0x10
+	.byte	0x5
+	.byte	0x33
+	.byte	0x10
+	.long	0x157
+	.uleb128 0x1
+	.long	.LASF1265
+	.byte	0x5
+	.byte	0x35
+	.byte	0x23
+	.long	0x157
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1266
+	.byte	0x5
+	.byte	0x36
+	.byte	0x23
+	.long	0x157
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x12f
+	.uleb128 0x2
+	.long	.LASF1267
+	.byte	0x5
+	.byte	0x37
+	.byte	0x3
+	.long	0x12f
+	.uleb128 0x8
+	.long	.LASF1269
+	.byte	0x28
+	.byte	0x6
+	.byte	0x16
+	.byte	0x8
+	.long	0x1de
+	.uleb128 0x1
+	.long	.LASF1270
+	.byte	0x6
+	.byte	0x18
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1271
+	.byte	0x6
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1272
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1273
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1274
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7
+	.long	0x7c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1275
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1276
+	.byte	0x6
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1277
+	.byte	0x6
+	.byte	0x24
+	.byte	0x14
+	.long	0x15c
+	.byte	0x18
+	.byte	0
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x20
+	.long	0x1fc
+	.uleb128 0xa
+	.long	.LASF1278
+	.byte	0x22
+	.byte	0x8
+	.long	0x118
+	.uleb128 0xa
+	.long	.LASF1279
+	.byte	0x23
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1280
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x1de
+	.uleb128 0x16
+	.long	0x1fc
+	.uleb128 0x15
+	.byte	0x28
+	.byte	0x43
+	.long	0x236
+	.uleb128 0xa
+	.long	.LASF1281
+	.byte	0x45
+	.byte	0x1c
+	.long	0x168
+	.uleb128 0xa
+	.long	.LASF1278
+	.byte	0x46
+	.byte	0x8
+	.long	0x236
+	.uleb128 0xa
+	.long	.LASF1279
+	.byte	0x47
+	.byte	0xc
+	.long	0x8f
+	.byte	0
+	.uleb128 0xe
+	.long	0x98
+	.long	0x246
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1282
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x20d
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1283
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xc
+	.byte	0x14
+	.long	0x271
+	.uleb128 0x12
+	.string	"X"
+	.byte	0
+	.uleb128 0x12
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x12
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1284
+	.byte	0x8
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x2
+	.long	.LASF1285
+	.byte	0x8
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x2
+	.long	.LASF1286
+	.byte	0x9
+	.byte	0x19
+	.byte	0x22
+	.long	0x295
+	.uleb128 0x8
+	.long	.LASF1287
+	.byte	0x8
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x8
+	.long	0x2af
+	.uleb128 0x10
+	.string	"fn"
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x1a
+	.long	0x2cb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1288
+	.byte	0x9
+	.byte	0x1a
+	.byte	0xe
+	.long	0x2bb
+	.uleb128 0x13
+	.long	0x2c6
+	.uleb128 0x5
+	.long	0x2c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x289
+	.uleb128 0x4
+	.long	0x2af
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x22
+	.long	.LASF1294
+	.byte	0x5
+	.byte	0x4
+	.long	0x7c
+	.byte	0xa
+	.byte	0x1e
+	.byte	0xe
+	.long	0x306
+	.uleb128 0x23
+	.long	.LASF1289
+	.sleb128 -1
+	.uleb128 0x3
+	.long	.LASF1290
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1291
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1292
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1293
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1294
+	.byte	0xa
+	.byte	0x24
+	.byte	0x3
+	.long	0x2d5
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1295
+	.uleb128 0x8
+	.long	.LASF1296
+	.byte	0x10
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xc
+	.long	0x341
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x16
+	.long	0x341
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1298
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xe
+	.long	0x27d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0xfe
+	.uleb128 0x8
+	.long	.LASF1299
+	.byte	0x8
+	.byte	0xb
+	.byte	0x21
+	.byte	0xc
+	.long	0x36e
+	.uleb128 0x1
+	.long	.LASF1300
+	.byte	0xb
+	.byte	0x22
+	.byte	0x12
+	.long	0x306
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1301
+	.byte	0xb
+	.byte	0x23
+	.byte	0x10
+	.long	0xb7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1404
+	.byte	0x10
+	.byte	0xb
+	.byte	0x19
+	.byte	0xf
+	.long	0x390
+	.uleb128 0x17
+	.string	"spi"
+	.byte	0x20
+	.long	0x319
+	.uleb128 0x17
+	.string	"i2c"
+	.byte	0x24
+	.long	0x346
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1302
+	.byte	0xb
+	.byte	0x25
+	.byte	0x3
+	.long	0x36e
+	.uleb128 0x16
+	.long	0x390
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xd
+	.byte	0x17
+	.long	0x3e3
+	.uleb128 0x3
+	.long	.LASF1303
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1304
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1305
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1306
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1307
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1310
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1311
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1312
+	.byte	0xd
+	.byte	0x21
+	.byte	0x3
+	.long	0x3a1
+	.uleb128 0x4
+	.long	0x9f
+	.uleb128 0x2
+	.long	.LASF1313
+	.byte	0xd
+	.byte	0x27
+	.byte	0x10
+	.long	0x400
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x13
+	.long	0x410
+	.uleb128 0x5
+	.long	0x410
+	.byte	0
+	.uleb128 0x4
+	.long	0x415
+	.uleb128 0x8
+	.long	.LASF1314
+	.byte	0x88
+	.byte	0xe
+	.byte	0x4c
+	.byte	0x10
+	.long	0x4b2
+	.uleb128 0x1
+	.long	.LASF1315
+	.byte	0xe
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x3f4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1316
+	.byte	0xe
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x4b2
+	.byte	0x8
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0xe
+	.byte	0x4f
+	.byte	0x11
+	.long	0x390
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1317
+	.byte	0xe
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0xe
+	.byte	0x51
+	.byte	0xd
+	.long	0x815
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1319
+	.byte	0xe
+	.byte	0x52
+	.byte	0xa
+	.long	0x98
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1320
+	.byte	0xe
+	.byte	0x53
+	.byte	0x9
+	.long	0x312
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0xe
+	.byte	0x55
+	.byte	0x15
+	.long	0x246
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1322
+	.byte	0xe
+	.byte	0x57
+	.byte	0x14
+	.long	0x3e3
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0xe
+	.byte	0x58
+	.byte	0x1a
+	.long	0x7d9
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1324
+	.byte	0xe
+	.byte	0x59
+	.byte	0x18
+	.long	0x721
+	.byte	0x68
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1325
+	.byte	0xd
+	.byte	0x28
+	.byte	0xf
+	.long	0x4be
+	.uleb128 0x4
+	.long	0x4c3
+	.uleb128 0xc
+	.long	0x312
+	.long	0x4d2
+	.uleb128 0x5
+	.long	0x410
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1326
+	.byte	0xd
+	.byte	0x2a
+	.byte	0x10
+	.long	0x4de
+	.uleb128 0x4
+	.long	0x4e3
+	.uleb128 0x13
+	.long	0x4ee
+	.uleb128 0x5
+	.long	0x4ee
+	.byte	0
+	.uleb128 0x4
+	.long	0x4f3
+	.uleb128 0x8
+	.long	.LASF1327
+	.byte	0xc8
+	.byte	0xe
+	.byte	0x32
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x1
+	.long	.LASF1315
+	.byte	0xe
+	.byte	0x33
+	.byte	0x1b
+	.long	0x4d2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1316
+	.byte	0xe
+	.byte	0x34
+	.byte	0x1b
+	.long	0x612
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1328
+	.byte	0xe
+	.byte	0x35
+	.byte	0x1f
+	.long	0x63e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1329
+	.byte	0xe
+	.byte	0x36
+	.byte	0x26
+	.long	0x663
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1330
+	.byte	0xe
+	.byte	0x37
+	.byte	0x1d
+	.long	0x632
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1331
+	.byte	0xe
+	.byte	0x38
+	.byte	0x17
+	.long	0x289
+	.byte	0x28
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0xe
+	.byte	0x39
+	.byte	0x11
+	.long	0x390
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1332
+	.byte	0xe
+	.byte	0x3a
+	.byte	0xb
+	.long	0x111
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1333
+	.byte	0xe
+	.byte	0x3b
+	.byte	0xd
+	.long	0x815
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1334
+	.byte	0xe
+	.byte	0x3c
+	.byte	0xd
+	.long	0x825
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF1335
+	.byte	0xe
+	.byte	0x3d
+	.byte	0xd
+	.long	0x825
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1336
+	.byte	0xe
+	.byte	0x3e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x64
+	.uleb128 0x10
+	.string	"lpf"
+	.byte	0xe
+	.byte	0x3f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF1337
+	.byte	0xe
+	.byte	0x40
+	.byte	0x13
+	.long	0x809
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1338
+	.byte	0xe
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1320
+	.byte	0xe
+	.byte	0x42
+	.byte	0x9
+	.long	0x312
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0xe
+	.byte	0x44
+	.byte	0x15
+	.long	0x246
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1339
+	.byte	0xe
+	.byte	0x46
+	.byte	0x14
+	.long	0x3e3
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0xe
+	.byte	0x47
+	.byte	0x1a
+	.long	0x7d9
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF1340
+	.byte	0xe
+	.byte	0x48
+	.byte	0xd
+	.long	0x271
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF1324
+	.byte	0xe
+	.byte	0x49
+	.byte	0x18
+	.long	0x721
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1341
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xf
+	.long	0x61e
+	.uleb128 0x4
+	.long	0x623
+	.uleb128 0xc
+	.long	0x312
+	.long	0x632
+	.uleb128 0x5
+	.long	0x4ee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1342
+	.byte	0xd
+	.byte	0x2c
+	.byte	0xf
+	.long	0x61e
+	.uleb128 0x2
+	.long	.LASF1343
+	.byte	0xd
+	.byte	0x2d
+	.byte	0xf
+	.long	0x64a
+	.uleb128 0x4
+	.long	0x64f
+	.uleb128 0xc
+	.long	0x312
+	.long	0x663
+	.uleb128 0x5
+	.long	0x4ee
+	.uleb128 0x5
+	.long	0x3ef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1344
+	.byte	0xd
+	.byte	0x2e
+	.byte	0xf
+	.long	0x61e
+	.uleb128 0x2
+	.long	.LASF1345
+	.byte	0xf
+	.byte	0x80
+	.byte	0xf
+	.long	0x67b
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0xc
+	.long	0x312
+	.long	0x69e
+	.uleb128 0x5
+	.long	0x69e
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x4
+	.long	0x39c
+	.uleb128 0x2
+	.long	.LASF1346
+	.byte	0xf
+	.byte	0x81
+	.byte	0xf
+	.long	0x6af
+	.uleb128 0x4
+	.long	0x6b4
+	.uleb128 0xc
+	.long	0x312
+	.long	0x6cd
+	.uleb128 0x5
+	.long	0x69e
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1347
+	.byte	0xf
+	.byte	0x82
+	.byte	0x10
+	.long	0x6d9
+	.uleb128 0x4
+	.long	0x6de
+	.uleb128 0x25
+	.uleb128 0x8
+	.long	.LASF1348
+	.byte	0x20
+	.byte	0xf
+	.byte	0x86
+	.byte	0x10
+	.long	0x721
+	.uleb128 0x1
+	.long	.LASF1316
+	.byte	0xf
+	.byte	0x87
+	.byte	0x1a
+	.long	0x66f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1349
+	.byte	0xf
+	.byte	0x88
+	.byte	0x1b
+	.long	0x6a3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1350
+	.byte	0xf
+	.byte	0x89
+	.byte	0x13
+	.long	0x6cd
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1351
+	.byte	0xf
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1352
+	.byte	0xf
+	.byte	0x8b
+	.byte	0x3
+	.long	0x6df
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0xa9
+	.long	0x781
+	.uleb128 0x3
+	.long	.LASF1353
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1354
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1355
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1356
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1357
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1360
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1361
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1362
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1363
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1364
+	.byte	0xb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1365
+	.byte	0xf
+	.byte	0xb6
+	.byte	0x3
+	.long	0x72d
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0xb8
+	.long	0x7a5
+	.uleb128 0x3
+	.long	.LASF1366
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1367
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1368
+	.byte	0xf
+	.byte	0xbb
+	.byte	0x3
+	.long	0x78d
+	.uleb128 0x8
+	.long	.LASF1369
+	.byte	0x8
+	.byte	0xf
+	.byte	0xbd
+	.byte	0x10
+	.long	0x7d9
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0xf
+	.byte	0xbe
+	.byte	0x11
+	.long	0x781
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1371
+	.byte	0xf
+	.byte	0xbf
+	.byte	0x19
+	.long	0x7a5
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1372
+	.byte	0xf
+	.byte	0xc0
+	.byte	0x3
+	.long	0x7b1
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xe
+	.byte	0x2b
+	.long	0x809
+	.uleb128 0x3
+	.long	.LASF1373
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1374
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1375
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1376
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1377
+	.byte	0xe
+	.byte	0x30
+	.byte	0x3
+	.long	0x7e5
+	.uleb128 0xe
+	.long	0x9f
+	.long	0x825
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0xab
+	.long	0x835
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1378
+	.byte	0xe
+	.byte	0x4a
+	.byte	0x3
+	.long	0x4f3
+	.uleb128 0x2
+	.long	.LASF1379
+	.byte	0xe
+	.byte	0x5a
+	.byte	0x3
+	.long	0x415
+	.uleb128 0x18
+	.long	.LASF1380
+	.byte	0x15
+	.byte	0x19
+	.long	0x410
+	.uleb128 0x18
+	.long	.LASF1381
+	.byte	0x1a
+	.byte	0x1a
+	.long	0x4ee
+	.uleb128 0x19
+	.long	.LASF1382
+	.byte	0x24
+	.long	0x815
+	.uleb128 0x1a
+	.long	0x858
+	.byte	0x25
+	.byte	0xc
+	.uleb128 0x19
+	.long	.LASF1383
+	.byte	0x6e
+	.long	0x815
+	.uleb128 0x1a
+	.long	0x84d
+	.byte	0x6f
+	.byte	0xb
+	.uleb128 0x14
+	.long	.LASF1384
+	.value	0x30d
+	.long	0x7c
+	.long	0x89f
+	.uleb128 0x5
+	.long	0x89f
+	.uleb128 0x5
+	.long	0x8a4
+	.byte	0
+	.uleb128 0x4
+	.long	0x246
+	.uleb128 0x4
+	.long	0x208
+	.uleb128 0x14
+	.long	.LASF1385
+	.value	0x343
+	.long	0x7c
+	.long	0x8be
+	.uleb128 0x5
+	.long	0x89f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1386
+	.value	0x31a
+	.long	0x7c
+	.long	0x8d3
+	.uleb128 0x5
+	.long	0x89f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1387
+	.byte	0x99
+	.long	0x312
+	.long	0x8ee
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x11
+	.byte	0x99
+	.byte	0x1d
+	.long	0x8ee
+	.byte	0
+	.uleb128 0x4
+	.long	0x841
+	.uleb128 0x11
+	.long	.LASF1390
+	.byte	0x88
+	.long	0x312
+	.long	0x90e
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x11
+	.byte	0x88
+	.byte	0x22
+	.long	0x8ee
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1395
+	.byte	0x7b
+	.long	0x943
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x1b
+	.long	0x8ee
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x28
+	.long	0x9f
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x33
+	.long	0x9f
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x3e
+	.long	0x9f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1397
+	.byte	0x11
+	.byte	0x71
+	.byte	0xd
+	.long	0x95c
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x11
+	.byte	0x71
+	.byte	0x23
+	.long	0x8ee
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1388
+	.byte	0x5c
+	.long	0x312
+	.long	0x977
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0x11
+	.byte	0x5c
+	.byte	0x1f
+	.long	0x977
+	.byte	0
+	.uleb128 0x4
+	.long	0x835
+	.uleb128 0x11
+	.long	.LASF1391
+	.byte	0x56
+	.long	0x312
+	.long	0x997
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0x11
+	.byte	0x56
+	.byte	0x2a
+	.long	0x977
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1392
+	.byte	0x4f
+	.long	0x312
+	.long	0x9be
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x2f
+	.long	0x977
+	.uleb128 0x9
+	.long	.LASF1393
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x3e
+	.long	0x3ef
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1394
+	.byte	0x3e
+	.long	0x312
+	.long	0x9d9
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0x11
+	.byte	0x3e
+	.byte	0x24
+	.long	0x977
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1396
+	.byte	0x31
+	.long	0xa0e
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0x11
+	.byte	0x31
+	.byte	0x1d
+	.long	0x977
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x11
+	.byte	0x31
+	.byte	0x2b
+	.long	0x9f
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x11
+	.byte	0x31
+	.byte	0x36
+	.long	0x9f
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x11
+	.byte	0x31
+	.byte	0x41
+	.long	0x9f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1398
+	.byte	0x11
+	.byte	0x27
+	.byte	0xd
+	.long	0xa27
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0x11
+	.byte	0x27
+	.byte	0x25
+	.long	0x977
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1399
+	.byte	0xe
+	.byte	0x77
+	.byte	0x14
+	.long	0xa40
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0xe
+	.byte	0x77
+	.byte	0x2d
+	.long	0x977
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1400
+	.byte	0xe
+	.byte	0x6e
+	.byte	0x14
+	.long	0xa59
+	.uleb128 0x9
+	.long	.LASF1389
+	.byte	0xe
+	.byte	0x6e
+	.byte	0x2b
+	.long	0x977
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1401
+	.byte	0xe
+	.byte	0x65
+	.byte	0x14
+	.long	0xa72
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0xe
+	.byte	0x65
+	.byte	0x2b
+	.long	0x8ee
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1405
+	.byte	0xe
+	.byte	0x5c
+	.byte	0x14
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0xe
+	.byte	0x5c
+	.byte	0x29
+	.long	0x8ee
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 19 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 35 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x23
+	.file 36 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 38 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF899
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF902
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF904
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF905
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF906
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF946
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF973
+	.file 51 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF975
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF976
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF985
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 59 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1023
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1025
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1026
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1028
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1029
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1030
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1031
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1032
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1033
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1045
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1052
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1053
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1054
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1057
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4a
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1058
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 76 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4c
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.file 77 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4d
+	.file 78 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 79 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF926
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF931
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF936
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF938
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1007
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1048
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1051
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1056
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1110
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1142
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1241
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1406
+	.long	.LASF1407
+	.long	.LASF1408
+	.long	.LASF1409
+	.long	.LASF1410
+	.long	.LASF1411
+	.long	.LASF1412
+	.long	.LASF1413
+	.long	.LASF1414
+	.long	.LASF1415
+	.long	.LASF1416
+	.long	.LASF1417
+	.long	.LASF1418
+	.long	.LASF1419
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x50
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1420
+	.byte	0xa
+	.long	.LASF1421
+	.byte	0xa
+	.long	.LASF1422
+	.byte	0xa
+	.long	.LASF1423
+	.byte	0x6
+	.long	.LASF1424
+	.byte	0xa
+	.long	.LASF1425
+	.byte	0xa
+	.long	.LASF1426
+	.byte	0xa
+	.long	.LASF1427
+	.byte	0x5
+	.long	.LASF1428
+	.byte	0x5
+	.long	.LASF1429
+	.byte	0x5
+	.long	.LASF1430
+	.byte	0x5
+	.long	.LASF1431
+	.byte	0x2
+	.long	.LASF1432
+	.byte	0x5
+	.long	.LASF1433
+	.byte	0x4
+	.long	.LASF1434
+	.byte	0x4
+	.long	.LASF1435
+	.byte	0x4
+	.long	.LASF1436
+	.byte	0x4
+	.long	.LASF1437
+	.byte	0xd
+	.long	.LASF1438
+	.byte	0xd
+	.long	.LASF1439
+	.byte	0xe
+	.long	.LASF1440
+	.byte	0xe
+	.long	.LASF1440
+	.byte	0xd
+	.long	.LASF1441
+	.byte	0xa
+	.long	.LASF1442
+	.byte	0xd
+	.long	.LASF1443
+	.byte	0xd
+	.long	.LASF1444
+	.byte	0xa
+	.long	.LASF1445
+	.byte	0xa
+	.long	.LASF1446
+	.byte	0xc
+	.long	.LASF1447
+	.byte	0xa
+	.long	.LASF1448
+	.byte	0xb
+	.long	.LASF1449
+	.byte	0xb
+	.long	.LASF1450
+	.byte	0xa
+	.long	.LASF1451
+	.byte	0xa
+	.long	.LASF1452
+	.byte	0xa
+	.long	.LASF1453
+	.byte	0x8
+	.long	.LASF1454
+	.byte	0x7
+	.long	.LASF1455
+	.byte	0xe
+	.long	.LASF1456
+	.byte	0x7
+	.long	.LASF1457
+	.byte	0xd
+	.long	.LASF1458
+	.byte	0xe
+	.long	.LASF1459
+	.byte	0x9
+	.long	.LASF1460
+	.byte	0x9
+	.long	.LASF1461
+	.byte	0x9
+	.long	.LASF1462
+	.byte	0x9
+	.long	.LASF1463
+	.byte	0x9
+	.long	.LASF1464
+	.byte	0x9
+	.long	.LASF1465
+	.byte	0xa
+	.long	.LASF1466
+	.byte	0xa
+	.long	.LASF1467
+	.byte	0xa
+	.long	.LASF1457
+	.byte	0xa
+	.long	.LASF1468
+	.byte	0xd
+	.long	.LASF1469
+	.byte	0x9
+	.long	.LASF1470
+	.byte	0x9
+	.long	.LASF1471
+	.byte	0xa
+	.long	.LASF1472
+	.byte	0xa
+	.long	.LASF1468
+	.byte	0xa
+	.long	.LASF1473
+	.byte	0x9
+	.long	.LASF1474
+	.byte	0xa
+	.long	.LASF1475
+	.byte	0xd
+	.long	.LASF1475
+	.byte	0xa
+	.long	.LASF1476
+	.byte	0x9
+	.long	.LASF1477
+	.byte	0x9
+	.long	.LASF1478
+	.byte	0x9
+	.long	.LASF1479
+	.byte	0x9
+	.long	.LASF1480
+	.byte	0x9
+	.long	.LASF1481
+	.byte	0x9
+	.long	.LASF1482
+	.byte	0x9
+	.long	.LASF1483
+	.byte	0xa
+	.long	.LASF1484
+	.byte	0xa
+	.long	.LASF1485
+	.byte	0xa
+	.long	.LASF1486
+	.byte	0xa
+	.long	.LASF1487
+	.byte	0x9
+	.long	.LASF1488
+	.byte	0x9
+	.long	.LASF1489
+	.byte	0xa
+	.long	.LASF1490
+	.byte	0xa
+	.long	.LASF1491
+	.byte	0x2
+	.long	.LASF1492
+	.byte	0x3
+	.long	.LASF1493
+	.byte	0x1
+	.long	.LASF1494
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1291:
+	.string	"I2CDEV_2"
+.LASF1292:
+	.string	"I2CDEV_3"
+.LASF1293:
+	.string	"I2CDEV_4"
+.LASF918:
+	.string	"_IOFBF 0"
+.LASF1345:
+	.string	"mpuReadRegisterFnPtr"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF941:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1040:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF949:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1227:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF921:
+	.string	"BUFSIZ 8192"
+.LASF1089:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1192:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1274:
+	.string	"__kind"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1239:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1298:
+	.string	"csnPin"
+.LASF1188:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1208:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1306:
+	.string	"CW180_DEG"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1327:
+	.string	"gyroDev_s"
+.LASF1378:
+	.string	"gyroDev_t"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1285:
+	.string	"IO_t"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1025:
+	.string	"__clockid_t_defined 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1256:
+	.string	"int32_t"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF997:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1267:
+	.string	"__pthread_list_t"
+.LASF1094:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1206:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1154:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF934:
+	.string	"stdin stdin"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1255:
+	.string	"int16_t"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF1162:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1297:
+	.string	"instance"
+.LASF1303:
+	.string	"ALIGN_DEFAULT"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1316:
+	.string	"readFn"
+.LASF1381:
+	.string	"fakeGyroDev"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF1225:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1328:
+	.string	"temperatureFn"
+.LASF1266:
+	.string	"__next"
+.LASF1281:
+	.string	"__data"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1002:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1156:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF948:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1012:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1265:
+	.string	"__prev"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1320:
+	.string	"dataReady"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1075:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1185:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1039:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1396:
+	.string	"fakeGyroSet"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1091:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1366:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF1235:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF986:
+	.string	"_BITS_SCHED_H 1"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1240:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1027:
+	.string	"__itimerspec_defined 1"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF1268:
+	.string	"__pthread_internal_list"
+.LASF792:
+	.string	"USE_VCP"
+.LASF973:
+	.string	"_PTHREAD_H 1"
+.LASF1019:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF1399:
+	.string	"gyroDevUnLock"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1189:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1272:
+	.string	"__owner"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1319:
+	.string	"revisionCode"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF978:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF975:
+	.string	"__time_t_defined 1"
+.LASF1104:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1184:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF910:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1355:
+	.string	"MPU_60x0"
+.LASF1211:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1029:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1311:
+	.string	"CW270_DEG_FLIP"
+.LASF1155:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1233:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1393:
+	.string	"temperatureData"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1331:
+	.string	"exti"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1083:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1144:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1308:
+	.string	"CW0_DEG_FLIP"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1090:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF1390:
+	.string	"fakeAccRead"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF709:
+	.string	"USE_PPM "
+.LASF1077:
+	.string	"__cleanup_fct_attribute "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1201:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1352:
+	.string	"mpuConfiguration_t"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1312:
+	.string	"sensor_align_e"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF1253:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1015:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1123:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF902:
+	.string	"_____fpos_t_defined 1"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1264:
+	.string	"test"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF935:
+	.string	"stdout stdout"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1199:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1164:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1003:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF933:
+	.string	"FOPEN_MAX 16"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1243:
+	.string	"short unsigned int"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1127:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF1377:
+	.string	"gyroRateKHz_e"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1323:
+	.string	"mpuDetectionResult"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF1350:
+	.string	"resetFn"
+.LASF1400:
+	.string	"gyroDevLock"
+.LASF1343:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF959:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1273:
+	.string	"__nusers"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF980:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1135:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1387:
+	.string	"fakeAccDetect"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1325:
+	.string	"sensorAccReadFuncPtr"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1138:
+	.string	"I2CDEV_COUNT 4"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1045:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF961:
+	.string	"__f64(x) x ##f64"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1181:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1246:
+	.string	"signed char"
+.LASF1257:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF963:
+	.string	"__f64x(x) x ##f64x"
+.LASF1141:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF909:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1173:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1289:
+	.string	"I2CINVALID"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1332:
+	.string	"scale"
+.LASF1337:
+	.string	"gyroRateKHz"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF1176:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1242:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1275:
+	.string	"__spins"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1065:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1143:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1030:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1161:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1341:
+	.string	"sensorGyroReadFuncPtr"
+.LASF1081:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF1037:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1314:
+	.string	"accDev_s"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1043:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1193:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1363:
+	.string	"ICM_20689_SPI"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF1165:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF985:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1295:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF877:
+	.string	"NULL"
+.LASF1304:
+	.string	"CW0_DEG"
+.LASF1222:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1076:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1368:
+	.string	"mpu6050Resolution_e"
+.LASF1051:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1310:
+	.string	"CW180_DEG_FLIP"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF945:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1069:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1389:
+	.string	"gyro"
+.LASF1214:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1351:
+	.string	"gyroReadXRegister"
+.LASF1001:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1338:
+	.string	"mpuDividerDrops"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF897:
+	.string	"__need_size_t "
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1330:
+	.string	"updateFn"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1359:
+	.string	"MPU_9250_SPI"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1092:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1221:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF899:
+	.string	"__need___va_list "
+.LASF1250:
+	.string	"__uint16_t"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1178:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF1088:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1016:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1109:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF968:
+	.string	"_BITS_STDIO_H 1"
+.LASF1356:
+	.string	"MPU_60x0_SPI"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1384:
+	.string	"pthread_mutex_init"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1133:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF923:
+	.string	"SEEK_SET 0"
+.LASF964:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF936:
+	.string	"stderr stderr"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1375:
+	.string	"GYRO_RATE_8_kHz"
+.LASF906:
+	.string	"__FILE_defined 1"
+.LASF1344:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1097:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1288:
+	.string	"extiHandlerCallback"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1238:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1096:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1034:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1062:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1287:
+	.string	"extiCallbackRec_s"
+.LASF1286:
+	.string	"extiCallbackRec_t"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF914:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF974:
+	.string	"_SCHED_H 1"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF858:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF976:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1150:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1382:
+	.string	"fakeGyroADC"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1082:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF930:
+	.string	"FILENAME_MAX 4096"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF840:
+	.string	"__size_t__ "
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1023:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF901:
+	.string	"__GNUC_VA_LIST "
+.LASF1008:
+	.string	"_TIME_H 1"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1021:
+	.string	"CLOCK_TAI 11"
+.LASF1093:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1247:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1226:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF1158:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1376:
+	.string	"GYRO_RATE_32_kHz"
+.LASF1111:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF927:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF928:
+	.string	"L_tmpnam 20"
+.LASF903:
+	.string	"____mbstate_t_defined 1"
+.LASF1105:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1182:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1270:
+	.string	"__lock"
+.LASF1009:
+	.string	"_BITS_TIME_H 1"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF1054:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1346:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF767:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1035:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1374:
+	.string	"GYRO_RATE_3200_Hz"
+.LASF1296:
+	.string	"deviceSpi_s"
+.LASF1212:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF1101:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF955:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1230:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1357:
+	.string	"MPU_65xx_I2C"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1157:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF953:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1354:
+	.string	"MPU_3050"
+.LASF1358:
+	.string	"MPU_65xx_SPI"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1229:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1373:
+	.string	"GYRO_RATE_1_kHz"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1205:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1210:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1335:
+	.string	"gyroADC"
+.LASF1084:
+	.string	"NOOP do {} while (0)"
+.LASF1391:
+	.string	"fakeGyroInitStatus"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1174:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1038:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1020:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1301:
+	.string	"address"
+.LASF952:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1403:
+	.string	"SystemCoreClock"
+.LASF1219:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1024:
+	.string	"__struct_tm_defined 1"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1342:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1361:
+	.string	"ICM_20602_SPI"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1087:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1142:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF898:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF977:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1309:
+	.string	"CW90_DEG_FLIP"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1146:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1000:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1159:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1110:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF794:
+	.string	"USE_PWM"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1014:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF1085:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF971:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF1120:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1006:
+	.string	"sched_priority sched_priority"
+.LASF1307:
+	.string	"CW270_DEG"
+.LASF1153:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF966:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1129:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1063:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF1168:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF988:
+	.string	"SCHED_FIFO 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1167:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1367:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1340:
+	.string	"mpuIntExtiTag"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1139:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF1364:
+	.string	"BMI_160_SPI"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF965:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1172:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1022:
+	.string	"TIMER_ABSTIME 1"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1072:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1042:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1326:
+	.string	"sensorGyroInitFuncPtr"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF951:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1252:
+	.string	"__uint32_t"
+.LASF1348:
+	.string	"mpuConfiguration_s"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF1098:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF1283:
+	.string	"long long int"
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF1070:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF1053:
+	.string	"__have_pthread_attr_t 1"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1362:
+	.string	"ICM_20608_SPI"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF938:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF958:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1131:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1198:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1347:
+	.string	"mpuResetFnPtr"
+.LASF1261:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1190:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1207:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1074:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1145:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF468:
+	.string	"__PMT"
+.LASF1191:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1047:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1284:
+	.string	"ioTag_t"
+.LASF944:
+	.string	"__f128(x) x ##f128"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1318:
+	.string	"ADCRaw"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1099:
+	.string	"PP_IIF_0(t,f) f"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1010:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF922:
+	.string	"EOF (-1)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1234:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1385:
+	.string	"pthread_mutex_unlock"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF913:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1317:
+	.string	"acc_1G"
+.LASF940:
+	.string	"__HAVE_FLOAT128 1"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1244:
+	.string	"unsigned int"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1116:
+	.string	"UNIT_TESTED "
+.LASF904:
+	.string	"_____fpos64_t_defined 1"
+.LASF1329:
+	.string	"intStatusFn"
+.LASF1180:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1071:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1282:
+	.string	"pthread_mutex_t"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1134:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1036:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1079:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF990:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1379:
+	.string	"accDev_t"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1103:
+	.string	"BIT(x) (1 << (x))"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1202:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1186:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1060:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF397:
+	.string	"true 1"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1203:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1175:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF765:
+	.string	"ACC "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1011:
+	.string	"CLOCK_REALTIME 0"
+.LASF970:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1204:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1050:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF1271:
+	.string	"__count"
+.LASF998:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF769:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1313:
+	.string	"sensorAccInitFuncPtr"
+.LASF1148:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF1353:
+	.string	"MPU_NONE"
+.LASF1365:
+	.string	"mpuSensor_e"
+.LASF749:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1055:
+	.string	"____sigset_t_defined "
+.LASF1334:
+	.string	"gyroZero"
+.LASF1254:
+	.string	"char"
+.LASF950:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1078:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF919:
+	.string	"_IOLBF 1"
+.LASF721:
+	.string	"LED_STRIP "
+.LASF1388:
+	.string	"fakeGyroDetect"
+.LASF1147:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF920:
+	.string	"_IONBF 2"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1130:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF905:
+	.string	"____FILE_defined 1"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1392:
+	.string	"fakeGyroReadTemperature"
+.LASF1405:
+	.string	"accDevLock"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1119:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1217:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF1132:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"BLACKBOX "
+.LASF1005:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1170:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1402:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1333:
+	.string	"gyroADCRaw"
+.LASF1339:
+	.string	"gyroAlign"
+.LASF1397:
+	.string	"fakeAccInit"
+.LASF943:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1294:
+	.string	"I2CDevice"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1086:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF896:
+	.string	"_STDIO_H 1"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1151:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1056:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1300:
+	.string	"device"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF818:
+	.string	"USE_I2C"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1263:
+	.string	"long long unsigned int"
+.LASF1324:
+	.string	"mpuConfiguration"
+.LASF771:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF924:
+	.string	"SEEK_CUR 1"
+.LASF1107:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1277:
+	.string	"__list"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF917:
+	.string	"__ssize_t_defined "
+.LASF1258:
+	.string	"uint16_t"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1057:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1114:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1245:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1237:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1026:
+	.string	"__timer_t_defined 1"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1068:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1171:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF979:
+	.string	"__BIG_ENDIAN 4321"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF954:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF1315:
+	.string	"initFn"
+.LASF1166:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1049:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF819:
+	.string	"USE_SPI"
+.LASF925:
+	.string	"SEEK_END 2"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1073:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1080:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF857:
+	.string	"__size_t "
+.LASF999:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1394:
+	.string	"fakeGyroRead"
+.LASF728:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1121:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF1059:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF994:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1126:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF879:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1183:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1033:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1216:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1195:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1248:
+	.string	"__int16_t"
+.LASF1236:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1197:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1336:
+	.string	"temperature"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1398:
+	.string	"fakeGyroInit"
+.LASF1218:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF969:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF939:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF916:
+	.string	"__off_t_defined "
+.LASF926:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1279:
+	.string	"__align"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1108:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1004:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1260:
+	.string	"SPI_TypeDef"
+.LASF995:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1196:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF942:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF911:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1100:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1187:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF710:
+	.string	"USE_PWM "
+.LASF856:
+	.string	"_SIZET_ "
+.LASF1122:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF1177:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF748:
+	.string	"GPS "
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF915:
+	.string	"_VA_LIST_DEFINED "
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF946:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF793:
+	.string	"USE_PPM"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1302:
+	.string	"busDevice_t"
+.LASF1404:
+	.string	"busDevice_u"
+.LASF960:
+	.string	"__f32(x) x ##f32"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF791:
+	.string	"USE_ADC"
+.LASF993:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1128:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1194:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1124:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF932:
+	.string	"FOPEN_MAX"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1209:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF987:
+	.string	"SCHED_OTHER 0"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1249:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF996:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF981:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1137:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1280:
+	.string	"pthread_mutexattr_t"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1386:
+	.string	"pthread_mutex_lock"
+.LASF991:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1140:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1149:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1117:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1220:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF957:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1349:
+	.string	"writeFn"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1276:
+	.string	"__elision"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1061:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1213:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1028:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1044:
+	.string	"__ONCE_ALIGNMENT "
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1152:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF937:
+	.string	"__attr_dealloc_fclose"
+.LASF1241:
+	.string	"GYRO_LPF_NONE 7"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1017:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF962:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1102:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1112:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1115:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF706:
+	.string	"USE_CLI "
+.LASF398:
+	.string	"false 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1048:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1179:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF1095:
+	.string	"EXPAND_I(x) x"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1041:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1383:
+	.string	"fakeAccData"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF956:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1106:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF931:
+	.string	"L_ctermid 9"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1224:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1228:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF1322:
+	.string	"accAlign"
+.LASF1007:
+	.string	"__sched_priority sched_priority"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1371:
+	.string	"resolution"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1369:
+	.string	"mpuDetectionResult_s"
+.LASF1372:
+	.string	"mpuDetectionResult_t"
+.LASF947:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1067:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1215:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1118:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1136:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1052:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF982:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1259:
+	.string	"uint32_t"
+.LASF972:
+	.string	"__STDIO_INLINE"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1360:
+	.string	"ICM_20601_SPI"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF984:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1032:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1370:
+	.string	"sensor"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF515:
+	.string	"__always_inline"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1278:
+	.string	"__size"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1231:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF912:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1262:
+	.string	"float"
+.LASF1380:
+	.string	"fakeAccDev"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1125:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1269:
+	.string	"__pthread_mutex_s"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1200:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF900:
+	.string	"__need___va_list"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1232:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1046:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF907:
+	.string	"__struct_FILE_defined 1"
+.LASF1066:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF1251:
+	.string	"__int32_t"
+.LASF1395:
+	.string	"fakeAccSet"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1160:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1299:
+	.string	"deviceI2C_s"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF967:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1013:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF989:
+	.string	"SCHED_RR 2"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF992:
+	.string	"__CPU_SETSIZE 1024"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF908:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1058:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1223:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF1031:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1113:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF983:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1018:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1163:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1305:
+	.string	"CW90_DEG"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1401:
+	.string	"accDevUnLock"
+.LASF1169:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1321:
+	.string	"lock"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF929:
+	.string	"TMP_MAX 238328"
+.LASF1064:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1290:
+	.string	"I2CDEV_1"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1473:
+	.string	"struct_sched_param.h"
+.LASF1425:
+	.string	"struct_mutex.h"
+.LASF1464:
+	.string	"struct_FILE.h"
+.LASF1462:
+	.string	"__FILE.h"
+.LASF1447:
+	.string	"long-double.h"
+.LASF1482:
+	.string	"__locale_t.h"
+.LASF1453:
+	.string	"platform.h"
+.LASF1476:
+	.string	"clock_t.h"
+.LASF1423:
+	.string	"target.h"
+.LASF1459:
+	.string	"__fpos_t.h"
+.LASF1424:
+	.string	"thread-shared-types.h"
+.LASF1441:
+	.string	"libc-header-start.h"
+.LASF1439:
+	.string	"stdbool.h"
+.LASF1417:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1467:
+	.string	"floatn-common.h"
+.LASF1471:
+	.string	"endian.h"
+.LASF1457:
+	.string	"stdio.h"
+.LASF1421:
+	.string	"stdint-intn.h"
+.LASF1488:
+	.string	"struct___jmp_buf_tag.h"
+.LASF1454:
+	.string	"common_fc_pre.h"
+.LASF1416:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1419:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1448:
+	.string	"stubs.h"
+.LASF1433:
+	.string	"accgyro.h"
+.LASF1486:
+	.string	"setjmp.h"
+.LASF1411:
+	.string	"src/main/target/SITL"
+.LASF0:
+	.string	"./src/main/drivers/accgyro/accgyro_fake.c"
+.LASF1463:
+	.string	"FILE.h"
+.LASF1431:
+	.string	"axis.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1446:
+	.string	"cdefs.h"
+.LASF1415:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1480:
+	.string	"struct_itimerspec.h"
+.LASF1485:
+	.string	"struct_rwlock.h"
+.LASF1483:
+	.string	"pthreadtypes-arch.h"
+.LASF1443:
+	.string	"features-time64.h"
+.LASF1420:
+	.string	"types.h"
+.LASF1427:
+	.string	"io_types.h"
+.LASF1450:
+	.string	"typesizes.h"
+.LASF1466:
+	.string	"floatn.h"
+.LASF1445:
+	.string	"timesize.h"
+.LASF1490:
+	.string	"pthread_stack_min.h"
+.LASF1410:
+	.string	"src/main/drivers"
+.LASF1418:
+	.string	"/usr/include"
+.LASF1470:
+	.string	"struct_timespec.h"
+.LASF1428:
+	.string	"exti.h"
+.LASF1406:
+	.string	"src/main/build"
+.LASF1456:
+	.string	"common_fc_post.h"
+.LASF1494:
+	.string	"rcc_types.h"
+.LASF1442:
+	.string	"features.h"
+.LASF1429:
+	.string	"bus_i2c.h"
+.LASF1426:
+	.string	"pthreadtypes.h"
+.LASF1407:
+	.string	"src/main/common"
+.LASF1468:
+	.string	"sched.h"
+.LASF1478:
+	.string	"clockid_t.h"
+.LASF1408:
+	.string	"src/main/config"
+.LASF1451:
+	.string	"time64.h"
+.LASF1422:
+	.string	"stdint-uintn.h"
+.LASF1412:
+	.string	"src/main/target"
+.LASF1434:
+	.string	"accgyro_mpu.h"
+.LASF1479:
+	.string	"timer_t.h"
+.LASF1430:
+	.string	"bus.h"
+.LASF1493:
+	.string	"build_config.h"
+.LASF1469:
+	.string	"time_t.h"
+.LASF1461:
+	.string	"__fpos64_t.h"
+.LASF1487:
+	.string	"__sigset_t.h"
+.LASF1477:
+	.string	"struct_tm.h"
+.LASF1436:
+	.string	"accgyro_fake.c"
+.LASF1458:
+	.string	"stdarg.h"
+.LASF1413:
+	.string	"src/main"
+.LASF1475:
+	.string	"time.h"
+.LASF1435:
+	.string	"accgyro_fake.h"
+.LASF1432:
+	.string	"sensor.h"
+.LASF1452:
+	.string	"wchar.h"
+.LASF1489:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF1460:
+	.string	"__mbstate_t.h"
+.LASF1409:
+	.string	"src/main/drivers/accgyro"
+.LASF1414:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1481:
+	.string	"locale_t.h"
+.LASF1491:
+	.string	"utils.h"
+.LASF1440:
+	.string	"stdint.h"
+.LASF1472:
+	.string	"endianness.h"
+.LASF1455:
+	.string	"stddef.h"
+.LASF1449:
+	.string	"stubs-64.h"
+.LASF1437:
+	.string	"pthread.h"
+.LASF1444:
+	.string	"wordsize.h"
+.LASF1474:
+	.string	"cpu-set.h"
+.LASF1484:
+	.string	"atomic_wide_counter.h"
+.LASF1492:
+	.string	"parameter_group.h"
+.LASF1465:
+	.string	"stdio_lim.h"
+.LASF1438:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\265\005"
+	.string	"\202I$+p\213:\b\270\">\327(R\020\240B\001z\350\217iV\222\2349\226\305\355\032PUUUUU\375Q\332n\333\334\335&I\3322l\265N\364\262\276\365\376}\277:\235\022\022\204`\335!\n\201\273\346\355\347\251\372\371\351\226z8\216\2125\317Q\275\341c\233\334\212\236\376wc\031?\3134\301\225\037\252J\227\376K\2011\200\023\327\305\030)P\251\273\273n!\343\320V\353D/\372\243\177\236\237a\245@\2038S\235\017t\231le\002\203\006\003\230\f\017"
+	.ascii	"U\241o\227\013\355b\301\231@\302\235gAk\300\tp\0070v}\241Z\323"
+	.ascii	"\212kwm\300\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375 \316\265\002"
+	.string	"t\002\302"
+	.string	"\f"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\002\001"
+	.string	""
+	.string	"\001\004\006"
+	.string	"\001"
+	.string	"\001\007\002\t\n\f\004\r\016\017\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\024"
+	.string	"I\t\001\354\326p\"G@Q\004\356\274"
+	.string	"w2\215qf\240\231e\355Tk\361$"
+	.string	"\354M\341\211i (\303*=v\313\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`t\001\245\006"
+	.ascii	"\022\211\036)p\305I\007\024\355c\017#]i\341E\270\376\020\331"
+	.ascii	"\270O\270\002\034\002Q\323_\373\377\377\377s:\232\2215\266}B"
+	.ascii	"\344N\0017o`\275\242F\230j\375z\365q\032\f\375c\256\314t?\315"
+	.ascii	"i\360%\nj\377\316c\205L\032\225\233\371\003\2632S\360\322\232"
+	.ascii	"D\2712\312@\345\341~*@\345\220D\375\2618\216\b&\020\020a\024"
+	.ascii	".~\227Wd\346\342\373\370\232\231\311\376\271\211\" `\242Q\350"
+	.ascii	"\352\006\366,p\021\312\242\013d6\214!\201\231)d\311\233w\203"
+	.ascii	"\212\220\r\204v\275\306\n\017\256[\200\273\251\333\373\365\303"
+	.ascii	"\262y\310\214\025\006\275Y\267\002\023\003,\204]8\"2\200k\302"
+	.ascii	"[\347%%3.\333eh\223\200 \316\310\231\227\340\302\243\270n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`D\001\305\006"
+	.string	"BJ#+pI\223\016\374\377\377\177\364T\006TU}\216\323#\022\004/a,\205\001\001#H\340t\201l\372\251.\272\251\2214\3627\331I\006M\323\n\212\340\036\347\034%\242y$\224\307Q@(\316Ds\034\203As@\251L\026 \3007\2763\376\023i!\214U\006LL\227\006&\035"
+	.string	"\264\320\016+\373Q\205/\230.\017L:\341\206\302v\255\"\206\231[|\305\357\266\276-\274\017s\3529\335\366\210\030\216O=\236`\307\366\261H\027Z<\002\037"
+	.string	";\317\200g:h\017|\f\200\002\374B\241\020.\336iE[\037\253g6\004\312@\b\270."
+	.string	"\336\005G\270\302\343f;}\\7\021\276"
+	.ascii	"\022\341\031\200+\r@\353\025\032\363\304\f\034v\325\360\3443"
+	.ascii	"\221-\343\017\240\b"
+	.text
+	.section	.gnu.lto_.pureconst.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\200\004\001\200\004\002\232\004\004\232\004\006\230\005\007"
+	.ascii	"\230\004\t\230\005\n\230\004\f\232\004\r\232\004\016\232\004"
+	.ascii	"\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"5\006"
+	.string	"\302\007\030!\240)\303\001\017\377\357\254_\335\227\027\365\377\377\267\327X\373\337\366\333\232\365\333\362\326H\311\357\226d\n*M#\220\001\256\203\313\240\264\244s\211D=&9llb\354\344\344\342@f\005\177\324\223\240\016\366\0244S\326\227\365J'\bU\2016z:\350\251\330q\032\214s&\236\321o\376>\316\0223 \360\202!\322n3\204-\272\370\311\002\3459\201\035B\243\021\273\270\026\033\260\267@q\021\2028\2130\301\017\353\332&\305i\030\364ZQ\333\312\0207"
+	.ascii	".\203\206\020\260s\007\022r\032\376\n{1\\m\230fa/\006\034\242"
+	.ascii	"\303\336\013\217\301\033\240\335p\260\327\032F\204\371\327\225"
+	.ascii	"\311No\3005\236K\361\206"
+	.text
+	.section	.gnu.lto_.lto.b1e376b4b4f51776,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.24.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\027\001u\r"
+	.string	"\006\032]D\360\262&\035 a\311,\017\023\353\260\350_\341bdN\231\005\237\215\337\223\326\301W\255^g\203\373\321\"B\252"
+	.string	"\312\nc\224\245\215\252k\306\342p\313V\223\021\356\361\221M\266\243i\024\005\\\210&{K\231RG"
+	.string	"E"
+	.string	"K"
+	.string	"\320\335?\326\341\365\001\326\2419[\307;\232} #\346\246\307\356bj\342\334\237&\347_\365\220\2102\375]\"\256\257d5\203\007"
+	.string	"\324\351}dP\304\253\236\037P0\231 \021v\327\031Q!nx\333\022lO\260\317\022=\376\t\020;;6}\330\235)u\306\376\333\335\265\246\354\333\374O\323\231\351\207\240\304\340|pvez~l\rH#\205\355\333\3578[\304&!\001\341y\225\277\342,\270\333\224.`7\225\243\263\333!\360\311\365+\035\325\231\003O\245\360\"\307)y<\222\376\310\272\332*+\371\230Z\240\203\232\354\307\3400\022m\3557\030\256\335m"
+	.string	"\243\205d\340FM\311:\274>'\216\370\250\260\361\324oq\027%\277\306\032\\\362\361\320w\261\016Ip\224x\3116Iq\260\340\204\201\211\002\020\201\347\f$R\t\245\240h\333\006\013Y\026\302H\233\250e\264U\300.\214B+X\266\2210P\2115\026\321\206e\320\264\r\023\351\366o5\265\332Y\275(\314\013\220v(\313G\253\232\374T\344Rz8u\273\233 O\303\023\025"
+	.ascii	"@\004Nv\276\362Ofu\340\027~\002\227\323\354eU[CE\332Xr\003\254"
+	.ascii	"\366xJ\212\t\375\276`MEW*\006\231\n\005u\231\030\356\\\314vh"
+	.ascii	"`\n\n"
+	.text
+	.section	.gnu.lto_fakeGyroSet.25.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\033\003\035\025"
+	.string	"V#\201J\260\022R: \264\333\3227\262\242\2479\201A\265[g\355\036\"\246\377OP\036\264\264G\260\007\013\274b}\321\3576\370\305\244I\244_a\327\277\340\315\351O\351\017\332\323\314p\240\"\033\362\222kH\256\226\242\356\177n\273wJ\001e"
+	.string	"m"
+	.string	"k"
+	.string	"!^\212HZ\023d\257%[.\264|\f\336\217t\\wO\340\030\356n\315\022d\257$\263\004\313\345\323>\360E\274\033\355\\\300\256P\321p\267\254\271E\366\352\362'\343\253\354%\343\253y\266V\312\207\221\036>2\210\273KR\025\347}\362\374\007\017\340\367\303\363\031\213\260\273\236\277\037\240\233\336\266\001\333=\233b\b\323\263'\375\261#\375\365G?\275\321?\003\024\340\tr\345\203\362(wD\021\"kUi\f\371M\177\262\031\256\3740\001tz\341d3"
+	.string	"\305V\223\215M\273\360\346J>S\205A{\265\375%\330\222(\017\354P\002\022w\313\225W\023\241\313\347\227nn\264\223R.\020\n\026\025\210!\304W\177\306\215M{\2354\333\304\227\2443I\266\307\027\227\3221Y\261\273\020|\033\277q\303\345\346\177\271\361\025\205E\t\251?\370\032\021\021\310\310\234Q_(33\377\263J\017\345\211\252\231Y\277\013M\363\032:\002Y\273\353"
+	.string	"*g\203\337bg|\235\321\377\202z\263\210/\374,\bu\265L\177\220\017P\204W\327\244_\272Jo~\371.\210\212\\;\277\354\3227i\n\373\260\245B\366\030\276`C\220s\234{\270Yb\0360hi\300\262\300\226\0023\316\226\233\271\305\300\350v8\026p\270\033Y\263\313u\220\331U 3\310\334hH\334\256\206\264%\260NCnGr\320\351v$\255\354\035\266T\250\026\255z\324G>\275<}\026\364\032R9]\2457DT\344\372aF\233\302\261`d#(YB\272b\264\352:\254\0345V\325\332\247r\234LQj[AJ\250aH\245\2203b\023\210\004\023\024\266\305\006\260\002\231)\253\007\021\3405\023\031\262\311~\354\033\245\325w\306\025\340G9k\370\310D\032\310\177=,\204\f\305@\273&\002\220\024\027{\177\346\317\354\337\311\370\334:=&\333y\372\2047\275\364\""
+	.ascii	"\352\251\217\017\315\250JfO\367\3278\022\210&\317\306\271\231"
+	.ascii	"\362\220b\251\335\032\271\0132\3611q\026F}i-\356\347+`\346R\207"
+	.ascii	"\372a1 \221\277\347\341\225\331i\221\246\030\251_q\266\221m\t"
+	.ascii	"\224q\245\177|\020*,\277\020\305\037"
+	.text
+	.section	.gnu.lto_fakeGyroRead.26.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\230\004}\031"
+	.string	"&*\230H\260RRc\242\376\200\310\376\315<\002\270\305]\354\222\031\274\277\272\333\3605$\346\337(\320\373A\315\206)\020\215\204\004\342\356\013\006r@\264\251\3752{\236\222\276af\213\311[E\367\247\367\265!v)w\266\263\345\2262\245|"
+	.string	"\203"
+	.string	"\207"
+	.string	"+M=0\210\235\335\372)~\266\355\266\332B\266\315>9\322Pj_\352SB\247\n\272\311\275NG\260{\215/\236\251\335\332\370\024\363\266\366\023\363\326\266ab\204\f\274\361\tI\246HQ\326\331\275\306\\\025q\340mY)\320\037\272-z5\225\325G\026\022\007\027\261\303k\331\2624\203\203\215HT\246\2205\361x\325\351\006\242\220R"
+	.ascii	"5\367^\323!1\3516o\333\201\355\013v\031\025\307\217\234,j\334"
+	.ascii	"\256_\251HJ\303\324\217Z=\327oA:\304\257z\203\342E3\273t\210"
+	.ascii	"m\024\322\032\302~y\253\223mR\227\234\352\257\231\332Z\352\322"
+	.ascii	"RWK}\223\372\241\350\\I\273\027)\215\310\035\263a&\374\255\037"
+	.ascii	"\201\272\030`Eq\035\271\200T\220b[@\266\355\324\022p\364\344"
+	.ascii	"r\254\337\215\376\225=\342\261$u\357\265\335\252F\230\341\226"
+	.ascii	"Wg\231\224\313-\n\024\r\245\267\372\235*\210\305x\223\002\227"
+	.ascii	"a#\343\303x\214\033\033GG?\324\231\267\264\026\030\021V\206f"
+	.ascii	"\326\342/H\222*I (E0\272\"\b\031\210\322T\312\252\331(2\241\235"
+	.ascii	"\273\363#g\020-\261\254\337r\212L/1\\\032\253\006\232\257\020"
+	.ascii	"\256t\020Q!\266yg\001\254\325\356\275\257\001rP\231I\177\325"
+	.ascii	"\313\342=+#\241%\325?\356\360\320\017}#\252C`?\364\303\037\335"
+	.ascii	"\363\257\336\200\344\2757\201\227\017\005\237D\220y[R?T\n\322"
+	.ascii	"4?\226\200#`\030\035\005\bfb`\016\340XJ\357p<\036\235\016N\317"
+	.ascii	"\367\213\260\333\351r?>\236\205\035_N\316gG\327\223\333\371~"
+	.ascii	"r\270\026\367&\360|\271\n\275\236/g3\006_\336\352d\023\351\341"
+	.ascii	"\374*_\365\005H\243\363\253\276\305m5\262m\253k\202Uh\243\254"
+	.ascii	"\240N\234aa]Y\375\026\324BQ\326\035:~\343I\034\364va\336\226"
+	.ascii	"P\265\332@\276\234l\254R\255\"\255b6*I?8\215\233ZU14\263m b\250"
+	.ascii	"AD(\231B2$J\222\244\2600\034\240\002\221\2513\017\021\200-Cd"
+	.ascii	"\316\024\250~\324\030\016\314\232U\354\326\376\371\307\224\361"
+	.ascii	"C)\207K\202\360\005F~\237r\227T~\272\201\222L\206\375w\017P\234"
+	.ascii	"|\236\251\276c\305\266\312\265\311#\342\212_i\364\353\267!\311"
+	.ascii	"\023d\tN\310Xx\305\216\250\345U\376\372\227\325/\375\035\f\364"
+	.ascii	"\3453W\023\306\322>J\245\210y}\341Ka\201Z\372\210\257\004g\320"
+	.ascii	"\030`\266f\273\r\r\003]\222\003\3557\263\217+\201A\367\372)\376"
+	.ascii	"\374\366X\366\244v\250\263\204\3229\216\304kl\222e\227\32609"
+	.ascii	"Y1\302\261\333\320\331\206\214]\377\247\243`\346&O\223$\306\200"
+	.ascii	"\016{p\205\036\024%P\r"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.27.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\225\t"
+	.string	"\266QC;0\221\322\001\003\352\017\203\203\363`\204\250\220\356<\006B\376\321\375f\210\237D\247\343c{8H\356\215\345Ku#w\225\205A\255\270J\313}\217\336\265X\265^t\263$vo\231\0020"
+	.string	"3"
+	.string	"1"
+	.string	"\377?\"\265\036\362\375\200y^\035\031(\266\356;\245\007\207\034\3033\237\260\001\255EfF%\346\342\350i\350\356G\215\030\007_\362\377\203\377\247\377\26597\r\303\255\200\374o\375\240?D3\311\313\302y\3700\027\232\231b\374\231\204KZlr\301\001\335\262\227Z\367Mx\351\303\334/\017t\314}8\3241\027\337g'\350\377os\247\245\354\034vr\344\026\202!_\357\\:\226\030\001\221\215[MG\233\377\272\242\234\375\334\351\356\276\224\375\221tm4\005)\335\260\024\244\016\325V\200\324VU\252\202"
+	.string	"\037\235\030\026J\244\221\202\210\240sOT'\350\t\342\263,\t\317\243se\253\005\312FL\n\024MM\317\256\246\b\341\237\252\332\t\006\r"
+	.ascii	"@\004Nv`\365\220j;La}\025\031,!\3215\357b\002\002\205\3402H\250"
+	.ascii	"\211\257k>\001"
+	.text
+	.section	.gnu.lto_fakeGyroInitStatus.28.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"=\b"
+	.string	"\342\317:90\221\322\001"
+	.string	"\352\237\016\016w\324\211\t!\367H\201\275V\342\267\024\315 wE\037\3338\2413\203\022U-A\252\f\fhT\177,\007\206`|\016Uq~\373\t!{\247\024\356H!\005\021\250K\340\0062\177\334(\302#9\200\364\002\342\373\274i\242#\213\022}\230\023%Ob~\3244\271\003\203\024#:+@\220N\217m\327}\266\262\345\207\2334\201\215d\310\2247\227L@\311\302\\\033m\354\212\212\262\303~\266\273k\331\262c\210\343UC\020\333]\305n6Fs\021\261}\262=\366G\265\020\243\375\223\243\234\236\202q\200\335\326K\313nE\260\250s\315\365\002\333\265\316?\3335\333\356@'\207\257\037+N*Dc\345\265[\247\364x\370\030\372Wy\001\t\314\f\r\013\013\365\310a\330]G\025k\343\226\267m`\273\3016H\t"
+	.ascii	"@\004Nv`\365\320e;0a\025\313Jt\341Kx0\363j'\031"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.29.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`C\001\355\f"
+	.string	"\366\026WD\340T5\035\344X"
+	.string	"\214\316\320\247\0343x\006C\350\232\236L\224)\006\321\321\221\007\216\353\213!y\327\033b(\224w\232\t\202atB\220\003\214\030cA\226\2206\261\027@[\006\3058\303\f@\312\206\366N)?"
+	.string	"A"
+	.string	"I"
+	.string	"K.\260g{f\362\004\264g\333\007h\317l\233\323AY<\351Z=\305k\304\211\271Kru\305\305S\321\277\3115/V~\254\340`\245NI&\354\256\251\212E\342\256\267\235\3006\005\3732\002\317\250\212\312\304HOc`\300bD\226\026\261\311\024\255*\354[vw][\366K~\272AXs\210\001!\273\253\323\310\302\262\036-l\243\354\213- H\004J\355\277>\003\365\222\323\003\354\266Lxlk\t\347i\212\330\0355v\205\357p\n\2464OX\270\200\240\374<GWu\224\360F\031\327\367\033!\025\024\226ht\240$\375\004\244G\250\215\323\307\206R\306\265;^ewx\215\017\333\356:\360i\2000\001(Y<\363OZ\346\200\0364\360t8\f6\005,\3666\337\250\003}\300\320\024\362\274\216+\205\237\007Q\210\201\313 \352H\234\027\226\270\215\002\203\032\276\220\343"
+	.string	"\202!w\261mro\331\332\362E\255\306\210\271\030k\bS\024\024)\217\301\200l\032"
+	.string	"@\004Nv`\365\320bw\340\332\245\270\206\246\307\266\013\ri\300\270`\020\220\021\220\020\020\006F\006\031\001z\201\303"
+	.ascii	"\023\220\021\253\022\346j\310]o\26426\3075Z\302C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.32.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\032\001\305\r"
+	.string	"\226\032`E\360\262&\035 A\230\322\243}F]\321\332\004\233\270\030\226o\321Rx3\263g\346\227\252i\250\271\037-\"\244\nh\251\023D_Y\b\316c\360\fx\235\016wi\022\327nry\316\"PGD\263do)S\nJ"
+	.string	"J"
+	.string	"N"
+	.ascii	"\241G\177G\271\036C\037p=\272\263\201\374[-\350\204\017\020:"
+	.ascii	"<\273\213)\212w\207\232\235\177\326G\274\324"
+	.string	"\3510D\342\nSZ7\206\230\244P\020\205F\205w\326SDj&\023$aw\235^j\304\035o{\202m\n\366_\002)L\310\344\217OpX\364\b\331$b\177\247T\033\373pw\327\252\262\237\363CMg\246?\022\241\206'H\201\034\2734?EvG\304\261\302\366\355\177\235Mb\013\260\001\341y\226\337\3428\335sL\017\260\253\242\261\263\373%\360J\n\362+\237\326\216\252\r\202\247Z\200\361\003\225>.I\237t]\355\026\227\274\227j\340\203\236\354\313\360P\322\303\263\267\353l\b\355\256\203\0300\245\003\253\033\323\365x}\r\257D\316\320\301\003\252\357\342/L\376\2159\304\344\275G?\346z<\tVay\300`\245\201\312\002\021\001M\313\324\232h\324\222\261T\330\270\016\0304-\303J\334\b\206\304]\3002\2202\027L\343J\230(\305\233\206\021\207\275l\033\207\221|{\270\252\202\254\232\236\226\214\316@"
+	.string	"igZ\336\263\352\311PG6e\b\324\267\273\001\024"
+	.ascii	"7\345\377\312\277\231\325\202\2670T\301O\263\214U\r\f\025\224"
+	.ascii	"c\031/\260\232\360\\\032\263O\374V8\265h\251%dj\225\324\005\243"
+	.ascii	"\270\346b\212CcPP"
+	.text
+	.section	.gnu.lto_fakeAccSet.33.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`&\003]\025"
+	.string	"\246\243\202J\240\326Q:\003\273\270'\376\026#\216\331C\360\374\310\223\022\313\300\250+b\356\2230\260H.\336WfY/\247\017/\225%\035\265\r\373\373\3730s>L\023\343\245\323\212\217\345\006{\3405\361D\250\243\337\342\302o\334v\357\224\002e"
+	.string	"m"
+	.string	"n"
+	.string	"1\234\222T\210\275\246\370`h\371\033\2737\365\270\356\262\250\022\356n\213)\304^\005\314\024\0240\237\366\177\267\261\373\222\317\007\354\372j\bw\313\026\277\304^]\276\300\370\032;\201\361\325;[\311\313\244=\216\242P\016\342\356\222\324\305w\237;\377P\007\320\033\372\371\204\305\354\256go\210\350\246\267}\300\366\217Ms\002\3668-\373\323\017\273\323_\337\364\323/\3753"
+	.ascii	"M\351\310\bi\213\036)\227D\327\326Z\325\0362|\251\017q\204\325"
+	.ascii	"\004\215\243\337\224\221)\034,\036R8\366\354A\235\353\360\243"
+	.ascii	"&p\315^m\037\030\003$b_\301\025U?\342n\251\340\225\366\004\346"
+	.ascii	"\363@\235/\371\254\224K\244\202\364\013\"\022_\375\035:\366\354"
+	.ascii	"u\316\354\024\245'.\013\001^\360 =\264\b~\325\201\330n\270\371"
+	.ascii	"\036n|Uya\004\343\272\332Y\374\241\376b\022\022\227\240L\031"
+	.ascii	"\365\20345\363=\263\204\240?T7\023I\357A\333\374G\316@\322\356"
+	.ascii	">\360\301\343\301\207\3413\276\312\350{E\274\331\345\007/{\352"
+	.ascii	"\272z\324_\024D\034\301\244\311\244\007\236\2057\213\2461\t\265"
+	.ascii	"\262v\026\355\022h\322\026\366_K}\001\336PC\300\363\235\203\270"
+	.ascii	"]f 4xq\340\302\240\266r\273\331\250o5\\\215mF&\247\333\321p\273"
+	.ascii	"\331\310\033\035.\207F\227\201\344@c\263!o\272\033\262\226\300"
+	.ascii	"\271\0168\035\371!\227\323\221\263\222\367\327R\237\004\025V"
+	.ascii	"<\n4\034^\030^\0065C\370\027\t\245\230\032\n\265\262.3\332\030"
+	.ascii	"\216%\023CQIrr\002F\211\274\210\225\251\306\022\265\345C\204"
+	.ascii	"L\340\020\245vI\250QH\245\fS\246\204\002\221\t\n\232\264\001"
+	.ascii	"\260\002\221)\253\016\021\2409$3s\223\375\3313\243\251\244[?"
+	.ascii	"~-\ro\316^\324\234\0074\f\f\245\003\007MG9jW\030\252=b?\314\341"
+	.ascii	"`\261)\323\356\235\225\322g\213`'\347\037\tN\323x\323\231\347"
+	.ascii	"\334e\203&\t\324\020\3247\022\365\254\2217\251\022\322\265D\336"
+	.ascii	"\257\007\201\214b\334\336\223i\0018\206\024cD]\031\243Z\254\233"
+	.ascii	"\361\205\313\005:\334^\230\035?5\216\221\024\"\371-t.\213#q\344"
+	.ascii	"}|p\025\254i\241\254?"
+	.text
+	.section	.gnu.lto_fakeAccRead.34.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\233\004\335\031"
+	.string	"6+\234I\260\326Qc\324u\027\355\3458\036`L\370qA\232 \n\332\\\254\021\276~\276\004\251\332\274I\345\365T\232X\225\001\355\275\245iZ\206\224_<\005/?\310\223\025\222\245\313\306\334\264\320~\327\363\244w\314\"l\313-eJ\001\177"
+	.string	"\205"
+	.string	"\214"
+	.string	"\347E\222\301\362\361\241*y\353\357\320\331\261\333j\023\3311;@\321\016\245\366\203\327At\341\356/\3672\031\245\356=m\254\363\272\365\371\030\363\366u\001\346\255m\337\340\020\231\367\023H\202\305\003\n\020O\311{OZuq\336mY)\317/\272\245A\265T\326\255\037XK\214\277\023\257%\215R\225\211\330\357\250\214\271Z\202\362\341\351\210\237\021\245,<\367^S\337\017\3516o;\202\355\235]\006\003]\376\3610\250.$\267\307\237\364!)\002\207\224W\275\361\262\036\265\342\017\377"
+	.ascii	"\271\202k\353R+\366iDk\013\373\345\275\367\2722\331&\265\313"
+	.ascii	"\205\377\313\324\326R\227\226\272Z\352\277@\320JF9\020u/\211"
+	.ascii	"\256+\327\312\006\221\341\363\370q\250\207\003\0377\214U\214"
+	.ascii	"CKA\036Cv\254\b5\300\204V\315\235t?\375&{\242\206R\360\336\033"
+	.ascii	";\261\274(\316\213\224\363\342\f\326\334\302d\355Pz\242\356\302"
+	.ascii	"\335L=9\376\220\023\361\261\177j\364\276\232yKk\201&A\246Jpm"
+	.ascii	"\t9U\013P\0068\005\006\251E\201P\271bQ\302r<\275\222 O\256\242"
+	.ascii	"\255xXq\006\324\237\004\"\305\323e@\310\3631|JV\325<\363uB\223"
+	.ascii	"\223#Z\305\366\355H\336\353u\357}\005\360B\b\263\361\017_\"W"
+	.ascii	"$\265Z\250K\365\217A\027\350}\226\035\325\")!\312\344\336{\337"
+	.ascii	"\217\306\360(\034\001\340\275w\301\217\f\033|\030;\363\326\245"
+	.ascii	"\336\227\324\243\001\26603\340\033\n\f\024\350\340\334$\230\315"
+	.ascii	"\330l\265j\333\354v\241F\341\007\227\323U\260\331j4\241\334\255"
+	.ascii	"CP\016\210\226!\250\206\201f\313\t\321f4\306i\270\345h\034p\270"
+	.ascii	"\034-v\366^\336\312d3+F1\252\374\360\r\262T\024\243\352\205\334"
+	.ascii	"\326\020\266m5O\257\032\331*\342\224T\322\311\251\211xY\317X"
+	.ascii	"\244\254O\234\\\311\231,\241\367\224y[R\325\232\004\313\346W"
+	.ascii	"V\225\032\247h=\322\003\003\264\204\033\361y\321,\337\226m\004"
+	.ascii	"/\022^\250AD\351\230R\"3\022$I\222\302p\240\002\021)4\017\021"
+	.ascii	"p133g\nT\177jt\313(\376\272??\363\230\022>\2242\341\222\f\276"
+	.ascii	"\220\3103g\351\322\334\204~ '\223\261G\356@\212\221\347g\212"
+	.ascii	"O\260`\256\022k\322\030=\205\267\034\361Jdh\306\f'S2\031\001"
+	.ascii	"\036\355\256\353\362\256?\311\313\330\227\317\016\204\361r\254"
+	.ascii	"\253\013\006k\033}\202\203Q\365\341\005\351\346\245\201\350\362"
+	.ascii	"\350l\202\301\232m\266{\326X0\2204\333\016(+\250\233\311\212"
+	.ascii	"<\376\370\355\366\262#e\233\277\276\353@>G I\204\350\331\234"
+	.ascii	"'\251E8\226\033\036\356\016\362\0138\230\325\031\375\232TIc\364"
+	.ascii	"t\330\004\256\264\203\"$\253\001"
+	.text
+	.section	.gnu.lto_fakeAccDetect.35.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"-\013"
+	.string	"\326\224NC"
+	.string	"\253L:\370}\370?hN\374\0174\376\243N\035\234\363\027\030\266\017\351\347\204~\356Z\374\351h\021\374\331\263\254 \033/*2IRPwUU!\221\323u\034x[\023\251\242\313+z\3122\310\337;\2458"
+	.string	"9"
+	.string	"@"
+	.string	">\257\371\356]\016\361\335\263mN\007e\363'\214\365\027\202\025\032n\367\004\353\200\233\247\246\177\005\2470\020A@\205Z+u\352\360\331]\323U\013\300]o\273\302\266\207\375Og\212\326\227}\313\356\256\253\313\376\354\247\337\207\005\334\205\013\333.k\247a%x\020\n\330\276m\224\215\2613\023:(\265\237\3402\324g\247gv]\262\007\273'\206=\227{\001\252\252bZ\333\360\320g\217o\020\222\270e\320\211F\244\323HZ\313Q )in\273\252\257l\2233@\271\354\356\206\277 \305\364"
+	.string	"#p\317?}\367\250\203U"
+	.string	"\025\3359\302\026\313aX\252\263\003\346\20084<\035N\306fB\024\303jq3\216B\020\bY\232B\242\030\202\245r<\021\225!\240\210($\201bY\0027\026&G\306\022,!\311\022\304\330\366\271\267lu\371\346W\017\344b\001\017"
+	.ascii	"7\345\207\325C\216\355 \266\245\304\200\235\252\322\200q\301"
+	.ascii	"\300\240 \253&\340\n\222\273\312heB\376]&\276\256\371\004"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.46.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\002\001e\f"
+	.string	"VVRD\020q\224\016\240\272\3325\216\016@\363\314\244,Y\200!\240\"\276k+\251\272!\021o\367-\266\375\3277\347\337cS=I\202\020Q\004\024\316L*\255\321\240F\304H\005\030\202\303\300\030\273\241&\262\233\354\235R;"
+	.string	">"
+	.string	"?"
+	.string	"\023\273\210\3453\332\376\t\333\245\r\366l\033\007I,\201\027\030V\334\330]\355S\216\270w\031/\317?\353\227\224\312t\351\241\342\360\030\362\253\303\300\356\032\353p\317\333\346\330\246\366\023\00486\304\214Q\342\341\355\207%\237e\214\355\322?Rf\372\200\362\351\207\236\215\371\034\231\0243\240\300\335]\031\361P \306\203>\212\247\360\376\221\016\262\273r\001c\027Tq\007\3734x\022\313\003\322\202\274D\277\005\265S\316B\202\007|\206\260\013\nL>\355\t\025\342S\316P\322\344\263\216\3250Ac\243\257\342\017\037c\313\377\356\003\247\330\262\274\244\b\373\327\312\225-\243\214\017\020\273\032r\004.\251\264\326.\003q\324A\226u\242\255\253\b2\336x\004\004\350p6"
+	.string	"4\231\313\234\246\003m\236\005\264\216\032p\334\246\205jG\341S\031h\020>\333\003\215\253!Msb\032\241\253\232\210\322\252\305\313\325\374f\234\002\032"
+	.ascii	"\220\n\002\020\201\223\035\257\376\207\266n\302plM+xw\bR\314"
+	.ascii	"3<\330k\252\245\352\200\214k\270\264\211F\027\276VY\300nVK\301"
+	.ascii	"\n\315\330t\321\271\3008q1\357\2644\375\2042\006"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.47.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\002\001m\f"
+	.string	"\326\326SB"
+	.string	"S\225\016 \312\250\201\360'\200v\252\"Gb\212\002$\350\275B#\264\020\226\201]k\021V\340~\317Rh\001Bl\\\r\005\350}+K\3320I\263\223A\252\230qd\024e\300\321\264h\223\275S\n<"
+	.string	"A"
+	.string	"B"
+	.ascii	"\237\331I(\237\321\366"
+	.string	"]\330.\215\360g\3638\310b+)v|\220\341cw\267O\271\342\337e\304>\377\255[R*\323e\210\212\304#\346X\245\301\356:+q\317\333\336\330\006\331\217\020+\"\b\220E1o\264xx\373a\311o\371b\273t\026I3\231 \360\351\207\237}\371\034\231\024A\240\300\335=\200\251\301 \306\203\376\213\303\370\316\"}dwE\303\306.h\300\234\354\323\340K(\001\020z\3448\311\016\322\022\375\031\236]\340\256\f^\360\031\312<H\020\360ik\340\020\237\262\206\222&\277\365\207p\341\320\261\321\217\361\207\217\361\345\263n\007\247\370\262\304\244\n\373\330\312\225-\003\374\0209\261\001\006P\275Z;\355C=\013\032\245\234\326\211\270\256>0\261\246\243 \001g\243A\2209\241\224\223\246\231\356\303u&xuT\201Rn\013\325n\203\247R\330.x8\320Fkh\313\f\260\207\241\253\233\310\363\352\026/W\001\030"
+	.string	"7\345\367\352\237h\353*\f\007\327\264\202w\211 \345<\303\203\275\246Z\252\016\310\270\206S\233ht\341k\225\005\354f\265\024\254\320\214M\227\235\013"
+	.ascii	"'/\346\235\226\246\237P\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\177\001e\b"
+	.string	"\204\013{\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177 \200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\034\177!\032\177\"\005\026#\200\204\001"
+	.string	""
+	.string	"\003\002\"\177$\005\036%.\177&\271\200\202\202\200 \030\177'\005\027(\201"
+	.string	"\002/\177) \177*\037+\031\177,\272\200\202\035\177-!\177.#\177/\005"
+	.string	"0\001%\1771\377\037"
+	.string	""
+	.string	"\200\200\200\001$\1772'\1773&\1774\003\002\022\304\001\003\002\021\340\236\212\256\001\001\344\007\003\002\021\241\341\365\321\002\001\244\022\003\004\004\004\006\023\204\001\003\007\024\244\001\003\007\006\320\360\372\250\001\001\202\006\003\t\n\n\t\f\022\304\001\003\f\021\204\013\003\016\016"
+	.ascii	"' \020\003\t\210L\007(\"obh\003+H\233%\357\n\031\357h\267\334"
+	.ascii	"\276\222\355Agpk7\240\363!\277\277\224,\t\006\314/eph\227\357"
+	.ascii	"\233\260t\343\3415\2341\303\326\001\300\340\247\307\001\231\216"
+	.ascii	"^P|\206a6h\224O\031\255A\263\325\t"
+	.text
+	.section	.gnu.lto_.refs.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375 e-\002"
+	.string	"RF\020\023\2405\351\377\377?L\363\020\377\223'\333\210\264\275\245\224)O\304IP\300OmS{\250\005z\231\013\3444N\302C\237n\323=t\200N3b\263\214\354\243\336\250/j\352G\337\350\027\235\375\007\001"
+	.text
+	.section	.gnu.lto_.decls.b1e376b4b4f51776,"e",@progbits
+	.string	"(\265/\375`\245.\005\312"
+	.ascii	"\3725YET \nI<\035\025\254\350\320`4V\345\307\f\376@\326\241("
+	.ascii	"h0n\320,\370\033\002\3763\217(\\\254!O\365}\027\223{\331\021"
+	.ascii	":\006\315c\322%(\332\226B7\317\347 \246v\367\346\005Z\265\373"
+	.ascii	"\031#Z\241\340\272\371\032\204\232\376\034\243G\332V\312$S\346"
+	.ascii	"\003=\004M\004B\322mv\253\344\232Uv\272E\321\341\326\337:\376"
+	.ascii	">p[\334\320!\234\216i\2737\353\357x\036wz\341\251\274%H\272\245"
+	.ascii	"W\220\312\031U\323\"\330\373^Xob\342\275\260z\313\230\366\226"
+	.ascii	"\260\217\222\256\315\335a}\216\026)\3757d\020\211 \032~\366\026"
+	.ascii	"\033\332[\214\264\2674\265S\367\256\205\365\233.\320\350\340"
+	.ascii	"\021\224\367\331s\240\226r\253X\232U\302\231T\215\3613^\306\235"
+	.ascii	">\223\353<\323\r\374\027\"\206\240\023p\"=\323\303\360:\n\234"
+	.ascii	"\317\035\224\243\003\020B\274C\302\013\0312d#Ts8t\366<D\373M"
+	.ascii	"\f\272p\251T\033\004I;#\"R\375\027w\360\"R\340|~\300$IU\310\341"
+	.ascii	"f\\\366\216B\313\002\033\362\252\252\271\310\271T4\022m`\325"
+	.ascii	"\017\377\342\237\0167#T\263\205~tU\3677\377\305;/\314\004I7t"
+	.ascii	"\255\242\272c\"t\177\350/\275\321+=\322'}\364\217\356\364_|\221"
+	.ascii	"\343H3\340\264\0309#4\244"
+	.string	"\220\035\007j\307|\332\361\235v\334D;v\323\216\247\3321\231v\334\245k\356\315\332\341ZX\263\340|\023\360N\351\263c\036\272\360\032\336\351=\274V\374\n^*\216#\335;\311\207*\227p\246i\263\267\016\277\254\013\346\256sx\261\\\302Km\222\356\245\313\364'\347\205\223!\003^\2332x\246\247\257\300 \206=!~\236\336+\327\212\373\336{\246\b\326\221\2165\355\177D\373K\365\255!\242\365n\224\013\270\201\275\205\366\336\023\264 )\242#\372|\375\356\237_\300\333\267/ \006P\2004\207{\007\321\334k\301\275\026d/)\254\351\226\276|:7+\264IJ\203]P\035-}\276\340}h\177*\3759\325{\263^\274\213g\245\260\210\306\335+\351\023ph`<\035y\026j\377\340v\343\360\030TO\247\020\253{K\353\256\223;\275vW\316\263to\277g\356:\327\3562\271tx\f\272\205x,5"
+	.ascii	"\357-\211\006\341\336\322\f8\031d\246\204\206Lk\236\273Mh\214"
+	.ascii	"|"
+	.string	"\020\365\310\232\233\322~\241\027\356\227\316\254\212\204\364Ur\227\334\351}s\277m\367\3143\031\3246\333[*\203\203\230\354\330>\373\315Yin\316\352!\320\231\003\372B\251\327\302z\217\\\264;\255\340\246\341&\031Mf\262\233\372\361\331Q\350\230\035\277H\034E\320\006\341\022h\277\025\2547\361V\260\272\326\030\256\205\365\367\265\260b\2707\353\205\2727\353\005\273b\370y\004\265\321\366\226\332\024\277\342\244\320>_\261\277E\256\324\257\330\rs\017 <Fh\203\355-\275by\357\240{-\230\271\327\202\0268\037Aek\366\327.\275\026V}oV)\032p\177\f|\340\305=C\300\375:q\367?\017\270_*\224\031\367\354\302\375\346\005\200\356n\217E\006t\001\270\333k\341\376,\2444\335_C{'\345\002\356\267\352\257\356\020\245\373\375\322\312\200\002v\317\006\230\311\356\271\002\367\273\3458^\301=\037\340\366x\n"
+	.string	"\375\n\277q\317?\356_"
+	.string	"\022\334\035\211\373\247\340\200\373\305r\2778\036\202\373#\335\306=w\340\376*\334?\003\356/\202\373\233p\377\022\356\357"
+	.string	"\367\337\300\3753p\177\005\270\177\007\367O\200\373op\377\013\334\237"
+	.string	"\356o"
+	.string	"\367\017\200\373S\340\376\022\270\177\005\367\247\340\3763\356w\211\373e\342\356\022p\277&\270_\020\270\337\016\270\337 \367\273\347~C\270{\021\367+\346~s\334\277\305\375\257\373\025t\277\204\356\227\212\373]\272\337@\367[u\277\200\356\036\001\367\373\347~\375\334o\237\373\235\342~\371\334\257\024\367K\346~\307\334\257\324\335A\270;\235\273\313$&&&\272\343Aw}\335\t"
+	.ascii	"\025nXNX\tv{\265\255\242$\270\315\261[La\235\223\030\230mF\257"
+	.ascii	"\b\333\022\314\206\327f\220\356v\024^\303j.V\366\262|\301\320"
+	.ascii	"\030\t\236\336\351\0058\355{dA"
+	.string	"R\366\331a^h\277\027\25481\361^\260:\214S\373\313\241\366\027@\355h/\270\314\237\353\211\t!\331\205\"\227\033\216\035cX\032\005\315\231\366\031\213\3518!\203\325:\355W\355\251f;\361\212\262p\327O}\225\027\242`\365\005)p>w\234\376\2527Q\307\343\230iJ\267R\021+P\253\216p\355>\271P\322\234I\270\013\017a\252\r\003\203Vt\023\301X\270\n{\341,|\205\213\340 \370\013\207a \270\007\026\202\255\260\026\376\201\207`0\354\003s\341\255;\305]\277\347X\b\2730\374,}eQ\036\260\020\260z\206\273~\310s]*U\3662\254\"b\247\225)O\004w\275\327\313)\301R\205z)\274g\365\255\256>H\263\210\225\207\273\356\336\323\0201\004\205\200\324\3215r\223`\240\325\324\252#,c\362zN\b\273\236\312\027\322\370\271i\325\021~\r\367\267\321\365NW\354R\233v3\260"
+	.string	"@\324p\327o}\220KE\313^\207\257\205\273\276\313\331\256V\300\034Zu\204w\255\353\262]\352\214\220t/\351\004j\325u\355\275c\262\230\345)% \363\300\201\311\n\213z\221\322\376\341\r1\2163\245\352\021f\0221\004uI\312k\222\302Qx\n\357\270S\254\003C\371-\273fX\007\316\3618\2604\253xd\252\006\326\201\211\260\321K\036\215\2446\302\f8\0312\024\235\206\334\236^\262\277D\265\273 \352'|\303i&\bLnK\n~\302N\031\313VP\037\266\341\330)\223\001\226\325\300QC\302\253\034\2371\215\307\021U\303\253\372\0317=\216\233D\n,\f\317\300d`U\304f8\016<\273#\347g,\343\017o\310k\t\216\201a\2740\271\222!\207\227\034\303\370(zP\244\237q\022\216\016fE\263p\024Z\305\f\020I\234OA\315X\202\225\036\355\302\002\2608_|\306H/S"
+	.ascii	"\351\224\340h\221\262\322\307\226\246\213\360\213\347\nd\257"
+	.ascii	"*1\254\350\231\221\320\240\222\362*\216\237-w[?\246B\264\273"
+	.ascii	"\350\3201R\264{\263\342 \245\220\277\034I\270\351xc\253\252\224"
+	.ascii	"\254D\307\2739%-\212\013\321a\237\213\020\031H\372\002\265k\276"
+	.ascii	"\307r\345n\031Rik#\274R\024\302B\346\304\212\377\225\373\365"
+	.ascii	"\207w\345\363Wy>\235\245\324t1\350\022\230w\002\325\240W\345"
+	.ascii	") k_d\201\277d\303\354\305g\3279\264k\031\377W\342I\323S\026"
+	.ascii	"\355\327\347\242\007\266fe\212\177\337\025\303Un\354\360\301"
+	.ascii	"w\305\232d\260=\237\024\032&t\2105>K\371\275\325\013\320\t\245"
+	.ascii	"\242\275\310\247\353p\360\021!\"\237\241\334\351\347\375\034"
+	.ascii	"\316\207\317\373&\2177s\244\r\261H\314.\302\342\226\361\356n"
+	.ascii	"RR\365\371\371\237\270\324\305\2201\367u\302\235>\325\377b6\005"
+	.ascii	"99\264\226>{\025wy\036y\200\205\357\304\337\016\272\217\320\370"
+	.ascii	"\\W\374\213\336\221U\321\375\334\347\b\202\022\335\241\275\030"
+	.ascii	"C{QI\307]\270m\315B\243\317^t\352\267\377\372#;\226<\334\235"
+	.ascii	"\376\333\243\275=\222w[KRE\300P!\333\232\375\203\333\247\375"
+	.ascii	"\332\333\264"
+	.ascii	"\355\225\334\351\273=\233\007\020\357\366\323\307q\251M\fhK\253"
+	.ascii	"\316`i}\205]\321\231K\350\210\335\253}\222-#\363\367\004\267"
+	.ascii	"\345\247}\325\323\276:\321\2766\321\276\256\375\331\033\271\323"
+	.ascii	"?\362fb_F\201\363\351A\335W\365\217<\330\027)\036\251Ra\242\227"
+	.ascii	"X\275U\255\331W*\355\376e\376d2ElZQ>\377\330\213\214&\352\233"
+	.ascii	"\223~\251\337$ .\350`h\277S\367\3730\377\313=\352\230\302>\373"
+	.ascii	"\232\244}%\322\276:\265\267$\352\016X4\227\373\013\271\211_u"
+	.ascii	"\213KocJ\376\364\332\222\247]\372A\334\277\307U{ \017\025\323"
+	.ascii	"v8\304\364\371\177<\326\235:\334g\271\004M-eV\002\361>\247\271"
+	.ascii	"\214^\340\331\024$JR.\332\244h\237y\323\227n\307\263\3314\233"
+	.ascii	"e#\033\240\355\240h\316\\\224J\034\241\215\017*\327\347\234|"
+	.ascii	"\346\242G\345\t\315J\373L\rm\263\204\214,;U\220\2339\242aE\352"
+	.ascii	"HSH\372\372\312R\0341 \227j\312\311H\314\263t5z\022l\373\234"
+	.ascii	"\213\344\0322\200J2\354>\3470\260\231\246\246PG\204H^\252\300"
+	.ascii	"5&#\344\320\360NP\337\314\005\t\222\271\256Z\264)\247\205-\213"
+	.ascii	"\n\307\020\317\\I\202\232p}\316B\362\021\214R\236\036\326\347"
+	.ascii	"\274\365U\330L\206\335\323\347\254\365Uc'\320\370\372\252\254"
+	.ascii	"\301\253\246\236\256A\334\361\234\225\205\371j\206\240.Cx'`#"
+	.ascii	"M\273'\272\252\354\243*\377\370A\241l\307*\373\260\312WwC\367"
+	.ascii	"\016\213\366\360|\225\233?\226\304\311\260i\227\001\3235~;\236"
+	.ascii	"yL3\017<\246\235O\017\272\324\252\033\312\004\001\272p\206\236"
+	.ascii	"\\\226v(\250<\265\356}\245PJ\320<U!)G\326\221#K\351\346\336U"
+	.ascii	"\201Q\236\245^\232\220\214\204\311Hi\227Q\3225\203;\236o\334"
+	.ascii	"x\256\234\275\2270|=\221qj\033*MM\331iI\023j\303\263\323\033"
+	.ascii	"\301\330\203\271\006\031\022\342`\256\221i\334\275*\026\252\275"
+	.ascii	">\272\274\257+\272\006o\3073\323\235f\246\347z\351n\276\024\215"
+	.ascii	"A7\002<f\212\276)\022#F^\302\200\320\034\217q\242)\034B\241y"
+	.ascii	"I\357\275A<\301\203vE=/\t \t\223\223|\244aHk\304H\32373v2Q~z"
+	.ascii	".\362\\\224\223n\007\255"
+	.string	"@<(\341n\212\221\343\236\221<'\335\2653(D\237\363\213|\224\261\370m\321\345\243l\204\321\244nO,\206\237l\331\220\213yj\177\367u\007A\367\336K-\322\ru\306\254\356\327o\313\225\271\370\016`o\3470\002\351\016J\004\033\324ZlA60lo\241B\237fQ\315\r\242\242BQ3\236fQ\273)\364\243i\003\335Q\315\247\331\3366[H\250I\002j\333<\315vt\273\270\213\336-\215jn!\250m\263\205v\020\206\247PT\364i\026\024\265y\232EE\267Y\324\256\331BA\320\"\241\r\265\331fQ\201\333\f*Z\3634\203\212>\315\242\260.[\221X\333\022\"\330\324\341\005\362\024\332IHNA\320\032\352S\n\265\367\366\276hC\033:\200\275\235\240\240{A3n\233\223\232\344L\022\004u\245HN)\250-D}nA\355\275\345T\261\2210hJ\251\273\352R\233:\234\366\321\320\336"
+	.ascii	"@\332\273y7u\357\335\334{\027\241N\322\275k\324<\263\220\220"
+	.ascii	"\366n\302A\332NM\267\241\275\037\215\257-\3724\223\202\322q3"
+	.ascii	"b\226\265\211\244\315\233\265\367\242\240\332\2549\266\217\250"
+	.ascii	"\350\254(\f\301\317\236\207\334q\225\354\002\205\032\222\347"
+	.ascii	"\347\333u-\254\331\251\343YH\206\352j\b\333g\trPn\252\305\351"
+	.ascii	"\230\372\234\267\324\354\357\311\020\216M?\214\264D\234\345N"
+	.ascii	"1\242c\304+\005\037F\327\"\252\230\351\r\"\2425;>4sY\243\262"
+	.ascii	"*\324ql\310\200\036:\274>c\214\305\035_\301\204\230J\316\222"
+	.ascii	"%\r\356\363\305\2717+\256\242\343\330\212\206\032\302%\365y\202"
+	.ascii	"{\263R\371\212\261\343J\n\346\342f(D\306g\301\013\370\200!6\246"
+	.ascii	"\004*\371\266)wdU,W\304z\213\203\003$\234\271\353\363Z\362\367"
+	.ascii	"~\371\020\r\257\314\257\331\342\244\364\004\251\217o\035\303"
+	.ascii	";+\2342\366\"hD\364\203OJ\213U\334\224\310\347='.\214X\031\321"
+	.ascii	"T\256oR\361\221\347\302\322\266\016\244\252\020\361\334\0077"
+	.ascii	"\255\272.+<\326E\204\272\204\201\2202*F\303I\260\264M\023\225"
+	.ascii	"QQ\337\020\277\225\335\210\202\241`;\214\207\353\360\tX\017\337"
+	.ascii	"a'\370\t\316\273SL\305j\216\233`\2722*6r\001\215\224YQ\203\024"
+	.ascii	"@\313\212\212\315\260\252\370\214*\004\b\016\202\244w\210\223"
+	.ascii	"\365}\336\233U\0163\211\323>\362\234\336\200\310\3418\264\275"
+	.ascii	"\207\341\034\307\255|\315\270B\274\304\355\220)$\360\374|\220"
+	.ascii	"\024!\346\370\222\024\201\005K\202\004\236\237\017X\260$F8\262"
+	.ascii	">\331\230D\266>H&\n\243qf\3312\2012\005W\261"
+	.string	"a\002\037\037f2\371\223,\226\360\243T\321\376$\213I\246\361\203\020vNph\331\024\312c\213\2415z\3700\202U\376\214X\301\266K\023N\320\310\264\354\211\231\226=\301\301\013\f\005\026,\211\016\033Z\345\021h\303\315\b\022\034\300\304P\360\f!L\340<H%\233dSh\307 \204\206\020\"Z\024]\204\006\0354\350\260\272\b\rtt4\b\241\243=\204\016n\215\312\266=\336\264<<\034T\320\035\350\030yx\216\353\312\366\374\214`\301*cxx\216\272u\025\033\f\320Z\300fi\244\240d\333%2\005k\242\002L\240\025\026\220\312\022\212\312\026\004\023\311\022-\273d\225\305\243\222\231\0029B\362g\004\023hE\315N\213L\"-$K\254\307\366H\342B\262\204\f\020S\271\203!Yb\311l\217\355\2116\211\204Q\266 \360$\231\"\374(M\350`\202\245\221\005K\"Y\202m\217=@L\355*6"
+	.string	"@\311\372\364$\217\036\334\264\311\021~i\344aM\220\300sD\341\343s\034a\203l[\260\271]\032Gx\330\031\341a\307e].YeO\317\261\310\343\001\211\231F\022K&\n\030&\212\013K#\022\350\004\313\203d\301\366\300\214\300\222`\201L\b\301\270\003\302\t\030\226'yl\227I\244n\215\023\330\311I$\b\311%\317\212\004Z\342%\023\005f}\216<\313\226\022\216&^~\224,\006tk\364\360a\004\t\016\212\2551\204N\233D\026Y%\263=*Y\240\025l\0133\002\220\017f\2152\036\360"
+	.ascii	"\002l{4\001\323\032E\264I$\263\270\004\372Q\222P\262=H\026H\032"
+	.ascii	"\023z\216\254\t\227\226\306Xt\025\033Z\036\246\262]zX\032[\260"
+	.ascii	"-s\205M\222\371\303c4\026\225l\262\204\037\243\261\270T\262K"
+	.ascii	"f\322h\324=I$\tF\343\272L\"\201\226Fc1\371\203\\\"}X\243\321"
+	.ascii	"\2455\326\270\212\rK\026\310\204VC\017\253<\252Xj\340\260l\221"
+	.ascii	"(80\223)4\264`&\221>\0320\ba\f!\242\005\007\266\207\351\303\223"
+	.ascii	"DrP.\231\0342h[\260I\237cR\311\266I\244\261\347\310*U\264@F\343"
+	.ascii	"\004,X%\220\321\270\266K\244\217\321\270\036\333c\217\321\270"
+	.ascii	"*\217*x2\353\001\344\322h\\I\340\371\361\311\254\361h\234I\246"
+	.ascii	"@\372p\340\322\272\212\rL\240\025\376\003\304*9\264??J\0160\254"
+	.ascii	"\321D\007\020\035B0\201V\3340}~\226\254\362ei\254"
+	.ascii	"\300\032O0\201V\300(\177\226Iv\271\266>\314%k\"\371\203ly\330"
+	.ascii	"\226%\301\004ZA\2415\2468\206\360\203,\272\207\021\024\200A\006"
+	.ascii	" <|\330\200\343\031d0\002\203\b\022\350@\363l`I8\216`\374Q\232"
+	.ascii	"\220\202\207\347\310a\251dY \225=\034\222\310\343\n\016<\312"
+	.ascii	"%\207\r\007Hq\f\001\331\266x@\233\334a\002\255\220\361\371\371"
+	.ascii	"q\200\261\345\220NF\352\024\247\304\320I\017b!\346(\274\212\371"
+	.ascii	"\2131\226\370\271\302\034a\306B\230\257\324\252\350\n\202V\362"
+	.ascii	"\025+\371\n,\213\257\312"
+	.string	"\217\301\244\226'VtrT\362R\214\261!\201Y0K\265T5\001\33190+9zQ\201\007`\256:`\226ri\356\r\230U\247+H\375\362\237_\226\272P\301\016_O\264\352\bi\332\264{\356\313SS\362\236\214\2767'\231\357i\3540\fs~\266q\261c\347\231j\227\367p\364\006#\362\224E\323dG\222\304<\317{\236\243\\\271f\322T/C\311j4Ns\2076\360\276nd\371\341y\276{\022F\344I\336\322\242\330\223\321~\222\235x>a\211\b+Mwi\227sg\222\351\262\321\336\316\016R\347\336\336M9\022(!$\233\363L\347\271\311\006\210d^\217\304\256\312 \r\227\241\221^\225v\032\035\332\246\310\233g\270\267\254\344\222m\245\342\214\252+\202]4>\350\244<\321D\265M\325\016\232\347)ZV\342Xh\337p*\002!rE\220p?\233r\276\312\327\013#k\236\225xv\363"
+	.string	"\302\341h\346\306\214l\260\3456w\227\027\255)3\256@\355\032\310\230\242\321\254\006\305\022\355S\313InL%}\203\360\250b\301@J\022\231B\210FFd\244 I:\222\n\020\006\243a\032\327\324\036\022\200$A\0162\307\020\215\210\210\210$IIJm\006"
+	.string	"m\323\201\337H%$LW\204*\005e\033\310\227\267'"
+	.ascii	"\036\365\213\325'\366\202\375#\242\272\354\337}\271\026\252\217"
+	.ascii	"\236\033O=\230<\265\b;%\206\264\267\r\263\207\f\310A\375hf\305"
+	.ascii	"\350=\036oF\336\027#\177\207j\307\353\305a\203\271Vu?B\300,'"
+	.ascii	"\366I\310\223\3431#\223\r\216a\033\317\325)\027$\203\351\243"
+	.ascii	"tM\031\026Q[\302\222\370\241"
+	.string	"\352\020H&\327\223\242<p9\030R\362\034o$V\356\227\262\330p\266v9\222\372S\243\344P\254\333\22716\241u\272\017\211\305\212\213|t\r\225\362\372\306E\262\223\341B$\004\374\205Px\020\002.\216\350nKj\315\303\006\200\374)!)\230\301\257\333Z@\364\270\026\320\313\250\347\004\224\007{.AL\243\352T\200\375\002\016b\347H#\b\223, \310\236U\211r\3713\222s&\234\351\355\323\256\367g\331\245F\376\267I\266\032\200\273IX\334\035\364\3206\332\250\263\247d\252m\214\037\033fLqY\216\311\331\337\020\364\264\025\343\003!?\235\346\315xK\234\323\036\321I\335\342\316c\032\035\212.\365\270\375\t?\203:}\265j\354\313\017vY\252[\020e1\362,\265\361\363\300J\322\3251\244\225B/\214.\336<J\314Z\020\374\304\374;@\320\310X\3041\203\036\037Y\244\322\212\324\315\234\275$:"
+	.string	"\253\005\020\202B\201\2321\366\031Q\366-\276*\367\306\270\261M\363vvq\250\005\227\244\236\250\001\354\0010x\361\022\0169\236\\-\215\3648ZLEK\205J\217\346#\025\243b\203j~\377]\205i\2540\334\342\356@H\311\364\267\317\224\006\333\352#\343\0075\354\017\201>"
+	.string	"HCmj"
+	.string	"\354B\277\324*)\027\033\270D\251\260)xh\3773g\376!B)\375\321\272\232e\021\034r\273|\200\312\333$5\315#\322\nb\2040\374\370o\340\334\3721\302s\324\230\222f\302T\211\331*\367\b\241X\350\205\346b\f&\346ZB\354\264\360r\024\371kuL\314\320\005\257\237l0)W\351\212\317\351\013\355\"\204\376\244y\366\017\376\364\006\302Z~\212u?\260\267\207\235O\333\250}\n)\364\241\r0D4\020\245 @\037b\211\263+\224[\3650\240\034\"\320\200\013\217`K;\344\277==\252\007>\243\213\227\033\235\030\177\317\221\321\330A\200\325At\215.\312D\031[5\036\314\317\237\022\354\211z\326\300\256l\023\343\373\245y\330\214(\362\373\314\341\322\275\317j\201[\027\362\304"
+	.string	"\274/\001Fk\354\305-\356\032\231e|0\253m"
+	.ascii	"\323t|\033&\340J:\321\365\251\277\t,d\342\216\222\214\263\234"
+	.ascii	"F\356\236SjI\032\352\340\230\333N\304\357\022\246\201\311!\205"
+	.ascii	"t\265!\335;\354\322\224\350\005\363\2462~\240\2630Q\343\230\212"
+	.ascii	"q\006lU\314\320\344\0208N}\241\002w\254W\3651\325\214\377\374"
+	.ascii	"an\024\303n\375\\Q\032\311\211bYNE\004\312>\343'Yn3+2;\321\224"
+	.ascii	"j\211\263\030\bi\322\323\301b\002\251\\\266\310\213\032O\311"
+	.ascii	"\032\t\030*\200-\337\243\376\317N,\021J\276H{\373i\210\272\250"
+	.ascii	"\311\336\310\274\336\003p\322\246\330\020m\273\f\251+r\342\244"
+	.ascii	"\337\216\342\263\213\013\f7:T~cA3\354\332^"
+	.string	"Z\2242\253t\004\374\267\245.\320,k!d:\246g\350\225\201mxCxl\273^d1\200g\031\221\301\364^\305~\362\242\262\272\275\354\313\037T\372}^\334\016\323\246\375F\225\233AYq\213\246^Y_\035\303\267\004\335_\206\177\350h\231\002\207,\276\360\f\272\341=O\327\261\030\316\233\315l\"\362v\242\360tm\376\242\326\311\244,e\366\306\367&\3526&\033\313\260o-\365B\322B<\277D\211Y\222}mJu.x\305V\"nv%w}\001\005\234\201\366\236\316LT@I\363{\331\tX(>9\223[\037\367_.\272\262\204\234\314\203\020\2127]\343\004'\031\343J\004\024:\304\036fo.e\313\200\341r\257\340at\323\367\270>\271<\275o]\212\340\367\333\372\233\222-\312\253\016>\n\304~\016\250A\276\223ZV\337Hv\347\237q\254\204\263\355n\222,\272\017\017Tl\b\351\251\375"
+	.string	"\371\267DRD\027n\001\336\tB\f\350\"\307\375\376<\220\307\016\002\025\310\257f\017yu\307D\234\322a}\333\215\340Hm\0037\241S\226O\023\344\023y\374"
+	.string	"e\021\273\217\270\251\370\341"
+	.string	"1h2\314\013\201\344\307u\240\322\232Kk\340\223\374\bd-"
+	.ascii	"e\021J]/,\247\nt\236g \213\230\3166J\001\264\b\311\244\2450!"
+	.ascii	"p\034\353\220\314\375O\3415\345\226\340\307\210 jp\023n\352\233"
+	.ascii	"\325\256<\017N/\265AE P\273D\227\030\006$V\204E\332MT \315\300"
+	.ascii	"c#\345 C-;\250a\tr\310\306\334\315\257X'x\021k\b>D\371\335#>"
+	.ascii	"E\377\324sk@\214@\270nlSAh\251W\206\212\335\036?\021.G\322\370"
+	.ascii	"+\342+\345\210\266\b\027\272\337\030F#\205\272\312R\376*\302"
+	.ascii	"C\341\246\331\f}\371\tO\274\304gq *\"\230|\177q\032\346\027\231"
+	.ascii	"[Q\210\030\361|\261\206\037\320\202\363r\304i\351#\272[\351\354"
+	.ascii	"\213\333\276)\030DL,\325/\b\b\232b\002\213n\225\362\370\b\031"
+	.ascii	"\331<\267\220\277\bT\326\200h\245#\031[\3608\t\321?A\371\231"
+	.ascii	"Qj\334O\nup\035r\t\264E\213\004\321\021\026jNH/\266eq\\f\336"
+	.ascii	"\202\037\274\017\030\261\264l\2626\024\326"
+	.string	"\305\016\0131\317\2026_\212;\346\343{$\032R\021\312\300\307\n\276\274\202\301\206\317\007\341\002\343\\#\300\234 \023]\271\304\3370\355\005% u\330$&/\276\346\322\270yNS\370"
+	.string	"\032\257/\3454d\204\020\270~:\367>\234\020\013l\360\374\355\354a\312^#\352\320)\376\217\216\307\233P!}\221&\212\301J\016-:;e\030\312?\260\251\332!\271pL\231g\220\236\217\253\344_\351O7\316\022Z\323s\357"
+	.string	"\276lt\274f\030\212>\006\250\361\314\342\304R\016\263\003Z\001\365\327\257\346\224\274@\351N\256Q6\024C9D\037\226\240\222fN\n\027\005\333])?\321E|A\313\030\247\214Y\346#(\177t\005\203\004\337\031\003\244\230\231\001~\327\020\302@\2658s\327\275\324(\207r\221\372\027\311\364\210=\363\202a\034\310\203\250\320eyF\274\226\343\325\016\tG\275Dj1z3"
+	.ascii	"\255\230{\221\243\036qz\363\b\360\342\331\300A\027\342\231\365"
+	.ascii	"9\323n\241i\303\202o\016$3\034)f\202G\333\307\341sz\033\271_"
+	.ascii	"\363;Y\336\325q\355\277m\363\217\300.8\374\023\017\267\336\275"
+	.ascii	"\233\272\007\353\230\373>\375u\257\027\346v\267\251\377\030\030"
+	.ascii	"gB\267\336\337\302#\271Yy\023\222\224\264$'|\355\375\225\336"
+	.ascii	"\325\374\367j^\022J\177\366\204J\303\340S\300\376\2234\013\351"
+	.ascii	"\317c\231\300\003\301s\317\331E\307\001V\237wk\006\325\316\376"
+	.ascii	"^\255\227\344\2208\224&\263\035\253\342\361\177c_\246\355\033"
+	.ascii	"~,\026\300\213\366\271\332\266{es]\274\334'.\013\266WH\246^?"
+	.ascii	"\246h\032\376\276\370\024f\034\370\221\325n\213\203\352a\334"
+	.ascii	"\334\344\321\3504\362\255\326o\203\251\016\300Z\035\301;\002"
+	.text
+	.section	.gnu.lto_.symtab.b1e376b4b4f51776,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b1e376b4b4f51776,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5868 @@
+	.file	"barometer_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/barometer/barometer.h"
+	.file 5 "./src/main/drivers/barometer/barometer_fake.c"
+	.file 6 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	barometer_fake.c.e45b4696
+	.weak	barometer_fake.c.e45b4696
+barometer_fake.c.e45b4696:
+	.long	0x1f0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x8
+	.long	.LASF929
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF897
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF898
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF899
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF900
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF901
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF902
+	.uleb128 0x2
+	.long	.LASF903
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF904
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF905
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF906
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF907
+	.uleb128 0x2
+	.long	.LASF908
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF909
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x4c
+	.uleb128 0x2
+	.long	.LASF910
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0xa
+	.long	.LASF930
+	.byte	0x6
+	.byte	0xa1
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF911
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF912
+	.uleb128 0x2
+	.long	.LASF913
+	.byte	0x4
+	.byte	0x14
+	.byte	0x10
+	.long	0xcf
+	.uleb128 0x5
+	.long	0xd4
+	.uleb128 0xb
+	.uleb128 0x2
+	.long	.LASF914
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0xe1
+	.uleb128 0x5
+	.long	0xe6
+	.uleb128 0xc
+	.long	0xf6
+	.uleb128 0x6
+	.long	0xf6
+	.uleb128 0x6
+	.long	0xf6
+	.byte	0
+	.uleb128 0x5
+	.long	0x85
+	.uleb128 0xd
+	.long	.LASF931
+	.byte	0x30
+	.byte	0x4
+	.byte	0x17
+	.byte	0x10
+	.long	0x15d
+	.uleb128 0x3
+	.long	.LASF915
+	.byte	0x18
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF916
+	.byte	0x19
+	.byte	0xe
+	.long	0x91
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF917
+	.byte	0x1a
+	.byte	0x13
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF918
+	.byte	0x1b
+	.byte	0x13
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF919
+	.byte	0x1c
+	.byte	0x13
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF920
+	.byte	0x1d
+	.byte	0x13
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF921
+	.byte	0x1e
+	.byte	0x1a
+	.long	0xd5
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF922
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x3
+	.long	0xfb
+	.uleb128 0x7
+	.long	.LASF923
+	.byte	0x1d
+	.long	0x85
+	.uleb128 0x7
+	.long	.LASF924
+	.byte	0x1e
+	.long	0x85
+	.uleb128 0xe
+	.long	.LASF932
+	.byte	0x5
+	.byte	0x33
+	.byte	0x5
+	.long	0x199
+	.long	0x199
+	.uleb128 0x4
+	.long	.LASF926
+	.byte	0x33
+	.byte	0x1f
+	.long	0x1a0
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF925
+	.uleb128 0x5
+	.long	0x15d
+	.uleb128 0xf
+	.long	.LASF933
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x6
+	.long	0x1c8
+	.uleb128 0x4
+	.long	.LASF927
+	.byte	0x2d
+	.byte	0x1a
+	.long	0x85
+	.uleb128 0x4
+	.long	.LASF928
+	.byte	0x2d
+	.byte	0x2c
+	.long	0x85
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF934
+	.byte	0x5
+	.byte	0x25
+	.byte	0xd
+	.long	0x1eb
+	.uleb128 0x4
+	.long	.LASF927
+	.byte	0x25
+	.byte	0x28
+	.long	0xf6
+	.uleb128 0x4
+	.long	.LASF928
+	.byte	0x25
+	.byte	0x3b
+	.long	0xf6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF935
+	.byte	0x5
+	.byte	0x21
+	.byte	0xd
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 23 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.file 24 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF896
+	.byte	0x4
+	.file 27 "./src/main/drivers/barometer/barometer_fake.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xa
+	.long	.LASF1
+	.long	.LASF936
+	.long	.LASF937
+	.long	.LASF938
+	.long	.LASF939
+	.long	.LASF940
+	.long	.LASF941
+	.long	.LASF942
+	.long	.LASF943
+	.long	.LASF944
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF945
+	.byte	0x5
+	.long	.LASF946
+	.byte	0x5
+	.long	.LASF947
+	.byte	0x5
+	.long	.LASF948
+	.byte	0x1
+	.long	.LASF949
+	.byte	0x1
+	.long	.LASF950
+	.byte	0x2
+	.long	.LASF951
+	.byte	0x8
+	.long	.LASF952
+	.byte	0x9
+	.long	.LASF953
+	.byte	0x9
+	.long	.LASF953
+	.byte	0x8
+	.long	.LASF954
+	.byte	0x5
+	.long	.LASF955
+	.byte	0x8
+	.long	.LASF956
+	.byte	0x8
+	.long	.LASF957
+	.byte	0x5
+	.long	.LASF958
+	.byte	0x5
+	.long	.LASF959
+	.byte	0x7
+	.long	.LASF960
+	.byte	0x5
+	.long	.LASF961
+	.byte	0x6
+	.long	.LASF962
+	.byte	0x6
+	.long	.LASF963
+	.byte	0x5
+	.long	.LASF964
+	.byte	0x5
+	.long	.LASF965
+	.byte	0x5
+	.long	.LASF966
+	.byte	0x4
+	.long	.LASF967
+	.byte	0x3
+	.long	.LASF968
+	.byte	0x9
+	.long	.LASF969
+	.byte	0x3
+	.long	.LASF970
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF908:
+	.string	"int32_t"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF792:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF915:
+	.string	"ut_delay"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF906:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF840:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF901:
+	.string	"signed char"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF793:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF897:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF932:
+	.string	"fakeBaroDetect"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF925:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF877:
+	.string	"NULL"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF927:
+	.string	"pressure"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF903:
+	.string	"__uint16_t"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF921:
+	.string	"calculate"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF858:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF396:
+	.string	"bool _Bool"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF721:
+	.string	"LED_STRIP "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF767:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF930:
+	.string	"SystemCoreClock"
+.LASF920:
+	.string	"get_up"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF918:
+	.string	"get_ut"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF933:
+	.string	"fakeBaroSet"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF794:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF905:
+	.string	"__uint32_t"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF911:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF468:
+	.string	"__PMT"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF899:
+	.string	"unsigned int"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF934:
+	.string	"fakeBaroCalculate"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF902:
+	.string	"short int"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF765:
+	.string	"ACC "
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF935:
+	.string	"fakeBaroStartGet"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF769:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF749:
+	.string	"USE_NAV "
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF907:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF898:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"BLACKBOX "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF929:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF931:
+	.string	"baroDev_s"
+.LASF922:
+	.string	"baroDev_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF818:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF771:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF909:
+	.string	"uint16_t"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF900:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF924:
+	.string	"fakeTemperature"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF819:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF857:
+	.string	"__size_t "
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF728:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF879:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF928:
+	.string	"temperature"
+.LASF709:
+	.string	"USE_PPM "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF710:
+	.string	"USE_PWM "
+.LASF856:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF748:
+	.string	"GPS "
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF791:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF919:
+	.string	"start_up"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF917:
+	.string	"start_ut"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF706:
+	.string	"USE_CLI "
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF913:
+	.string	"baroOpFuncPtr"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF916:
+	.string	"up_delay"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF910:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF926:
+	.string	"baro"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF896:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF912:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF904:
+	.string	"__int32_t"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF914:
+	.string	"baroCalculateFuncPtr"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF923:
+	.string	"fakePressure"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF954:
+	.string	"libc-header-start.h"
+.LASF962:
+	.string	"stubs-64.h"
+.LASF943:
+	.string	"/usr/include"
+.LASF946:
+	.string	"stdint-intn.h"
+.LASF969:
+	.string	"common_fc_post.h"
+.LASF938:
+	.string	"src/main/target"
+.LASF965:
+	.string	"wchar.h"
+.LASF958:
+	.string	"timesize.h"
+.LASF947:
+	.string	"stdint-uintn.h"
+.LASF942:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF944:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF970:
+	.string	"barometer_fake.h"
+.LASF955:
+	.string	"features.h"
+.LASF964:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF949:
+	.string	"barometer_fake.c"
+.LASF948:
+	.string	"barometer.h"
+.LASF963:
+	.string	"typesizes.h"
+.LASF961:
+	.string	"stubs.h"
+.LASF941:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF0:
+	.string	"./src/main/drivers/barometer/barometer_fake.c"
+.LASF956:
+	.string	"features-time64.h"
+.LASF968:
+	.string	"stddef.h"
+.LASF959:
+	.string	"cdefs.h"
+.LASF950:
+	.string	"target.h"
+.LASF940:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF967:
+	.string	"common_fc_pre.h"
+.LASF966:
+	.string	"platform.h"
+.LASF937:
+	.string	"src/main/target/SITL"
+.LASF939:
+	.string	"src/main"
+.LASF952:
+	.string	"stdbool.h"
+.LASF957:
+	.string	"wordsize.h"
+.LASF960:
+	.string	"long-double.h"
+.LASF936:
+	.string	"src/main/drivers/barometer"
+.LASF951:
+	.string	"stdc-predef.h"
+.LASF953:
+	.string	"stdint.h"
+.LASF945:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\004\004l"
+	.string	"\007"
+	.string	"\274\205\242\255\006"
+	.string	"\001\312\225\321\215\005\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\240\342\234\212\n\003\004\232\377\264\360\r\004"
+	.string	"\002"
+	.string	"\005\345\325\273\242\017\022\002\002\002\003\002\004\005\002\003\006\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"/\034\354r\221I\310\347\231\224V\256\350\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 .\355"
+	.string	""
+	.string	"\230\""
+	.string	"\004"
+	.string	""
+	.string	"\001\001\002"
+	.string	"\001\004\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	".\033\203l6\200\005"
+	.text
+	.section	.gnu.lto_.inline.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"}\004"
+	.string	"r\207\027!\240'\351\217\352\232\036Dg\005\330\211\243YD2\336,\353\026"
+	.string	""
+	.string	"<8!~\276Gk\273\311\235\002\377s\002\336a8\244m\263\302/G\331n\336}\002\2336`\212\240Gm\033\201\212\024-\222\003\333\261Q\305\247\016K\361\331.\003!Gb0\327syD\333\304\363\253\300\266M\336\216\004\023"
+	.ascii	",C\\n\200e0\353\340\n\322L\334`\230F\300\033\360nE\341\230\002"
+	.ascii	"\023$\320S\301Hi\267E\364\234\3016\303\345\346\030\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 .5\001"
+	.string	"\360\""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001\002\001\001\017\177\002\001\177\002\001\004\006\177\002\006\005\001\001\003\177\002\003"
+	.string	"\002"
+	.string	"\\\306\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\200\004\001\232\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 \225\035\003"
+	.string	"\364\003\211"
+	.string	"\003\001\002\270\006\270\006"
+	.string	""
+	.string	""
+	.string	"\001\002\006\001"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"  \001"
+	.string	""
+	.string	"\004"
+	.string	"\005\001\370\007"
+	.string	"\002\002\007"
+	.string	"\003\002\b"
+	.string	"\001\020 \002\t\300"
+	.string	"\300"
+	.string	"\200\002\002\n\002"
+	.string	"\300\002\300\002"
+	.string	""
+	.string	"\016"
+	.ascii	"3\001<\234 \323^\230\303[\216te\371M\3026\203.\265\003V3R\356"
+	.ascii	"\265\324\265\013\177\003X"
+	.text
+	.section	.gnu.lto_.lto.b7397515f47d9d54,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStartGet.3.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 \326\235\005"
+	.string	"\022\n&.pU\323\001"
+	.string	"\240\214\323\271w\001\366\370\025r'\355\337R\201l\330\346Y\265\003\337\215L\263n\274\252\216!`\341\253S\0136\002\361\357-S\267\250\211U\017F\235\333\314h\255\032\254\325)\271\252\203!W\225\261U5\246\250\323\310\254\274QZy\n{%h\230H\312\017\035\003\376\260\213\022\363\257\240%\370G\211S\bu[\006\004Z4"
+	.string	"m\376\357t\356\037m\250\351\304\247\342\001\350n\226\231\3456r\337\355\254\344}\335F\302\242\273\037\275\357\262\227\373\037\361_\361\037\013\t"
+	.ascii	"i\3312\3236\237q\013|\277k\370+\204~\031w\\\216E;\311"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.4.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375`{\001\205\r"
+	.string	"F\230YC\020s\223\016\300\366q\212\317\306h*\363\365\230\271\007\222\326\315\240\246\214\362E\342\004\334\341s\\\370\350Y_\1774b\317l\363\323]\377\370\256\252Z \322\324?`<\002\200\030:0\025\365H#\233H\231RG"
+	.string	"A"
+	.string	"G"
+	.ascii	"$[\307\273\020\313\340\005\006\026=vWS\020'\375z\226&\311?\314"
+	.ascii	"\001\224L(\277:\374"
+	.string	"]\260\220\026\207\253\005\322\342b5\300\264b!X\245<\034\346\231\301\244\222\251q\260\273\316\222i\303\255\271\355\022\333\023\354\263\004z\262\337\375\330_\376\227\351\314\364\003d&\n\360\330\3250\363cc\236\214\021\266\237\331Z\243\223\331\260?\235\361\340i\037\305S\220\3762:\201\335\023\r\030\273]\0027\300\376\334}s\375a\007\271\376\034-D\251\006D\224x\212Rq,e)J}\025w\"\340\206\313K;|\325W\234\370.\2560\312\227\376\256\033\034,)9cH\"W\251\226\030\352\321\365\264\243\312\261\222>\274\371`cS\306\356PRQ\366\255\335]\0070\212\270-B\220\007r\231E\026\210\204t\024\204@\316\001\030E\241\020\214 \314#\034X\262I\200\020!\007=\237\270u\264P\204\024Hb\004\315\204d\363h#1\244q8\376\200`\324\270\317'jY\267\267VO\357DL\212\252\\i\022! "
+	.ascii	"\003\231\241v\274PHa\365x{\026\255\201\033\f\n\271\001\233\362"
+	.ascii	"\336\203\032.K\016x.n\233\214e3o\310%\364\345N\013m\367\204\226"
+	.ascii	"\225\037P;\224a\037\002\204\03689Wi\247\236\371\326\214)\005"
+	.ascii	"\203\002"
+	.text
+	.section	.gnu.lto_fakeBaroSet.5.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"]\n"
+	.string	"\366\222GB \311(\035\300"
+	.string	"\003\n\00494\003\342?\314\252zQ\274-\2064k\342\017\242%q\177\323\020\255a[\033\261\021\033\312\035.\277\321\202\026\020`&Y\242\273(\\\323!\332\205M|\367\017\262\311\336)\0052"
+	.string	"3"
+	.string	"6"
+	.string	"\027\230O\211g\330\347u\007\354\323\240\035\001\202\204\301A\311\201\t\273\273I\226\203\217\240\177\002\317\234P\245\307\005\214\335u<\241Nny\333\023\266=\354\307\273\273\226)\373\341\177}\365G\254\001%\223\260k\322\252\260\254\271\340\305\3665\266T\205\r8\314\247\004\220\361h_u\001\340W$gvU\002$\330]\n\007_\327\325M\023\356\257\225)O\006,\223\034\361\205 \344\001\202\202(\375\0027@\362],2\212?}\372#\3543kI1\305\226\263\001\0176R\260\303R\224+\366\257\264\212>\256\322\020\210~\032s,8\233N\305\206j\021\264\212<\217\326\020\306\036\215vp\034\032\225~\024\324U\256\263y\225\202|\352\306\366\361\341@\233\247z\233\246\271\013\321\272\005\021"
+	.ascii	"|\242\220\226\3252\366\f\2505\234I\320\004\210K\324@0LJ]]\327"
+	.ascii	"\320Y\030\017\030\001\343^\250)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.6.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375`\340\001]\016"
+	.string	"\226\330\\F\340t\234\016\344\215\027\210\377f\233\300\231*C\341\226\365\374,\325\200C\254c0M\023lg\210\265\237=6\264\257Dt8\245~\230\242\373{\313Q\205\020c|3\267\331\025\200\034\307G\201\0073\t\333]\322\366N)F"
+	.string	"F"
+	.string	"M"
+	.ascii	"'\017\260\373j\201\331-\r8\301\346\233\313\177\352\267\315=\365"
+	.ascii	"\233m\037\020\261<\n\340@}"
+	.string	"\374H\211\031\331-=Z\342\343\347\350\277\345\004R\304x\320\274\270P>\001(\330]O\322\025\342\246\267]\300v\004{2\b.2\370+\326`2O~\363M\352\267\017lHk\316|\02305Av\036\261K\224II\330\327vwM_\366Y~\255C;\244\300\340hv?\314\220\354\216-\346\204m\226\315\261\251\207\005s\332_q\026\254\263\004\"$\034\307tq\221~c\366\227\333\337c\302$ \323m\364(\002V\340`\273\255\223\366\3513PS\206\034Ad\246\006\210\207\325N]F\270\331\335\221\037\243\004CG\266rR\277q0!\236\0271\025'\373\350\230\251*4n\231\352\267x\036!\030\205J\242\020\330\r\320l\352@\324G\201$\202+0\025\212_\311S\211`\311I\234\340Y8})\317$\252\274\256sx\001\024\275U\030\212\036\307\266\313\275\266\364\345\217\225\252\250A\321\242\033<]T\0328"
+	.ascii	"\311\036<\007\004 \001& \320\242\231\253\016*(^\302\221\356\302"
+	.ascii	"\257\264\241\276U\0172#\351\331^\226\331\0211\356\263\177\001"
+	.ascii	"\2030\"/11WS\214\313\02011\376\231\331\332\241\306e\336px\242"
+	.ascii	"\335\371\356\245Z\005^\244!\217)D\302\340\367\215\210la\274)"
+	.ascii	"\220\035\021_W~\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 \205\215\002"
+	.string	"\002\304\016\031\260'\035x\242\221\244"
+	.string	"\022AH\225$I\222 \335\335\215\020d\023\262w\n\377\266\2221\026\211N5!\022o84o\253\202a\220\007U)\005\371\374\345\260\323\266@\232\373O\001\007"
+	.string	";3"
+	.ascii	"7\216\bH\022\016a\031\022\320A\007\323\t"
+	.text
+	.section	.gnu.lto_.refs.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002\004"
+	.string	""
+	.string	"\003\t"
+	.string	"\002\004\001\002\002"
+	.string	"\001\003\004"
+	.string	"\007\005\001\002\002"
+	.string	"\001\003\004"
+	.string	"\002"
+	.string	"\b"
+	.string	"\002"
+	.string	"\n"
+	.string	"\002"
+	.string	"\016"
+	.string	"\002"
+	.string	"\020"
+	.string	"\002\001\022"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b7397515f47d9d54,"e",@progbits
+	.string	"(\265/\375`)\t%4"
+	.string	"z_\250\024E`\246N\007b\302\350\317M@.\324\246\227\314\213|\253+\355\021v\312\037i\341\037\007\377\354\b\241M\210k\207\357\2631\236\332=\"\364\027\024j\357\225\272\221\312y\360\275\021\370\320P\335\242\264\303\222\035\367\226)\005\027\001@\0012\001\371\201\263\265\203\361\265\376Y\363\347\377\\t\227\330\035\315\256\331\236\003\267?8\313\273;\177p\266g\341\353\003N\236\0278\333\201\270g\340~\201y>\340\364-@8\364"
+	.ascii	"q\273f\373p{\366\264\243y\364\361U\244\353\332\217\335\025.t"
+	.ascii	"\035\241\377\261\377_\360\323F\254I\3325\373\004>\362\001Y\036"
+	.ascii	"`a\230-c\327\354\366\263n\257\342c\336\226\254\226\361\321\376"
+	.ascii	"\263\321u\262\345\244\356\232N\346e\236{\214_i\307\342f\035$"
+	.ascii	"\314\337\376\177\221\203\221\001\202]\363\310\013\234f\t,\344"
+	.ascii	"\324m\245\025\254\377\027\372\342\030\377\377@\336c\316\316^"
+	.ascii	"\340\304>\340l\353n7p\272\373Mw\273uw\233cw\303\305\231\343?"
+	.ascii	"\335m\240\373\032\265\335\316\247\304\331\355p\336\355n\335N"
+	.ascii	"\324\355\270\273\355\272;\331\335y\272\233\256\273\347\272\233"
+	.ascii	"Mwo\351n\266\356\216\353n\263\356\256\323\335t\272{Nw\237uw\333"
+	.ascii	"\335P\335-\240\273\321t\367\317\335\335\335]w\367\351\366>\335"
+	.ascii	"@\f\002Gg\303\n\177k\330\265\022yH6\033\377\355\337\321\260\236"
+	.ascii	"\330\340\277\313H|[{\370\227 r+\250\266\032=\377\177\202a\260"
+	.ascii	"\210\361\205HV\314\370/\026d\361C\013\300\214|0G\002\215t\275"
+	.ascii	"\026\326\277\202\341?\320\037\371\377\300\377\007\"v\345\377"
+	.ascii	"\037<6l8\374\347B0\374"
+	.string	".\340\032\326\377E\223\363\245\310\266E\214KkY\332\260\257\221\201\036\366o^D\334\002\257\274\026\036\034V\3141g\007\231\204S\204F\2354G\203e\307\027\2359N\222\310\361\270f\034\002\023J\231q\3105\373\nq3yq5\266*o<\216\273\271\034w\343p\374\315\263\303\271\231\3663\216\246\021\344\177\341\3777S\231)Lh\256\306F\266\346p\036\306\3118\362+\303\030\025.]\\\215m\314\265\244\3616\013\202\354\007\2722\271\377\334>\326\275\004\347_\\\255\314O\376\215,!2S\263E\226\374\317\021\020D \"\033\003#\3033\221\316\246\315\337\020\317\362PA\266\riA\363c\3655\355mBy\260\372\244]\323\325\224mvH\326kv\235\007\r\225\205\305a\273f\273\023\\\276\0278)\034\301\355]\330\305\370\030\017\277\2723 rg\3603\206\311jv\232]\222\341\256\273+\r(g\214w\275@"
+	.ascii	"kjQ\356\304\r\271\305\r\331k\336w3\256e]\203Mpyd\317\036\267"
+	.ascii	"\343}p\216\032\271\347\342B\032\002\023\223SwM\267+\332\221\263"
+	.ascii	"\354\256\351|\274=o\3449\271\366\204\023#R\343\232]z\341\213"
+	.ascii	"\307\251=\231"
+	.string	"\364\266\203\376\275\312\302p\340\013\347\324\236\247={\036o?p\370B&\367\304\227\320%\r\\\242\321\321y\033\376\377\362_\b\227\260\347\"\"\365\305\203\3138'\227\363;\355s\335=\347G\234\377\306\323\221\007W\362\271t \365\205\202\273o\367\371+\361\377q\374\344'\006\205N\377qG\352\036\362\322\033t\267\371\245\203\267\177$_t\030\212\227\025\3105\273\373\350\273\2733<p\212p-\032}~\"\333z\001\331\2636E\243\374D\016|k\344\331\354U4\215\177?\277\277\320\253\370\202\315F\"\233\215@\336\013\215\300\377\\\344\261h+\320\331\326\253\310\266\306\242\321\013\037\370\355J\004\013\215E6\215\261\310c\333\265\310\n\275\212FG\276\300\252d)\301\022\315\")D\t\020PJ*\272\"\355\251GjT\005\246\026\276\337\324\0064\375mp\201\252V2\240\212\246~?\rQ?\252\017UQ\016D*\n\025"
+	.string	"M\257\324^\212V\271@K\024\241\351\225\225\025\232\222\0202\352$\025\365"
+	.string	"\365K{\032x\355\223JQ*t\005n\013M\023\2320\304"
+	.string	"j\fO\024\236(\234\215\341ii\351\251i\tw\323R\2516\213$\b\375\253BS%\365\367K\225\002l \200\252\275\251+\337T\317\027d\025\005\003\345\020\244^a5\252iI\245\222\272\3022zSh\212\250\252+\254\252iO\265\302\251J\302Gu\325\241j\304P\325U\224\212\2568\325\250\nL*\225\024P795Y@q\301\002\232\244\240\235\2346\034\231\020\341\001\373\222\320\026=\025Q)\252\242.~i\017\205\222U\212\302\220JS(QI\365\\(\371R+\245\244\t\355`N}\263n\326\3352\205\371\213\347\331QH2\371\3042\022\214\230 \245\\\363\332\270Z\236\221\3560\b\016\236 hap;\322Y\204tvi\206\257\335\335\335e\235\353K9q<\270\222BZi6n\260/{\261"
+	.string	"\254\341\361\225v\315\213u/\215[\243/\326\025\n\t\177\354?_,\363\003\200\237\250\2218e\2243DfDDdF\222\030\016\220\002\021*\253m\022\200&!\023:\311\264\205:\373g\177|\023\017\031\262<\277V\344j\350\227%\202\020\036\346-\352c\333U\017\013o\250Rq\270w\213\026\234\035\224;\255\360\331\224\271Ch"
+	.ascii	"\200z\310&\b\332\224\f\373A*\355fQS\373\226\226y\254!\326\301"
+	.ascii	"\253\305\232\200\002\303\246\347\2113\"yv\234\210\304\261\232"
+	.ascii	"O\353\f!B\300@\353\247\231c\003\202\004G\300\252\346\307\317"
+	.ascii	"\321\267\021k\325\331\025\311\220\341\021\302\206\254d\261\215"
+	.ascii	"\021jv\253$=\207Dy\"\177\254&\r\036\257\320,\001an/\232\032("
+	.ascii	"\0171\331MB\244\ff\320\235\300\253K{6A\212\246f\022\242\177\204"
+	.ascii	"\3641\345\006`\004\007t\250\003\216\354\251sJ\340\274\203\200"
+	.ascii	"\n\030M\214/j*\206\350x\3367\344K\343p\b&+[\034\236\206\305."
+	.ascii	"@0v~\353\314b\353\001\374nK\255\360axr\304`\261,\202\223N(\231"
+	.ascii	"y#QZ\266\222\2055\316\276\262\023@\270\300t\370\342K@V7.\364"
+	.ascii	"\227??\f\321\326$/;\275~\362O8\033\265\007N\307\322|\177\256"
+	.ascii	"\2223\016\276\207\373\016\276h\357\370\033\361d\220\236\200P"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.symtab.b7397515f47d9d54,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b7397515f47d9d54,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4623 @@
+	.file	"buf_writer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/buf_writer.h"
+	.file 4 "./src/main/drivers/buf_writer.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	buf_writer.c.2e42f57c
+	.weak	buf_writer.c.2e42f57c
+buf_writer.c.2e42f57c:
+	.long	0x183
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xa
+	.long	.LASF712
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF694
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF695
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF696
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF697
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF698
+	.uleb128 0x3
+	.long	.LASF702
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF699
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF700
+	.uleb128 0xc
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF701
+	.uleb128 0x3
+	.long	.LASF703
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF704
+	.byte	0x3
+	.byte	0x15
+	.byte	0x10
+	.long	0x87
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0xd
+	.long	0xa1
+	.uleb128 0x5
+	.long	0x66
+	.uleb128 0x5
+	.long	0x66
+	.uleb128 0x5
+	.long	0x58
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF713
+	.byte	0x18
+	.byte	0x3
+	.byte	0x17
+	.byte	0x10
+	.long	0xea
+	.uleb128 0x6
+	.long	.LASF705
+	.byte	0x18
+	.byte	0x10
+	.long	0x7b
+	.byte	0
+	.uleb128 0x7
+	.string	"arg"
+	.byte	0x19
+	.byte	0xb
+	.long	0x66
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF706
+	.byte	0x1a
+	.byte	0xd
+	.long	0x6f
+	.byte	0x10
+	.uleb128 0x7
+	.string	"at"
+	.byte	0x1b
+	.byte	0xd
+	.long	0x6f
+	.byte	0x11
+	.uleb128 0x6
+	.long	.LASF707
+	.byte	0x1c
+	.byte	0xd
+	.long	0xea
+	.byte	0x12
+	.byte	0
+	.uleb128 0xf
+	.long	0x6f
+	.long	0xf9
+	.uleb128 0x10
+	.long	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF708
+	.byte	0x3
+	.byte	0x1d
+	.byte	0x3
+	.long	0xa1
+	.uleb128 0x8
+	.long	.LASF709
+	.byte	0x29
+	.long	0x119
+	.uleb128 0x2
+	.string	"b"
+	.byte	0x29
+	.byte	0x22
+	.long	0x119
+	.byte	0
+	.uleb128 0x4
+	.long	0xf9
+	.uleb128 0x8
+	.long	.LASF710
+	.byte	0x21
+	.long	0x13c
+	.uleb128 0x2
+	.string	"b"
+	.byte	0x21
+	.byte	0x23
+	.long	0x119
+	.uleb128 0x2
+	.string	"ch"
+	.byte	0x21
+	.byte	0x2e
+	.long	0x6f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF714
+	.byte	0x4
+	.byte	0x16
+	.byte	0xe
+	.long	0x119
+	.long	0x181
+	.uleb128 0x2
+	.string	"b"
+	.byte	0x16
+	.byte	0x25
+	.long	0x181
+	.uleb128 0x9
+	.long	.LASF711
+	.byte	0x2c
+	.long	0x58
+	.uleb128 0x9
+	.long	.LASF705
+	.byte	0x43
+	.long	0x7b
+	.uleb128 0x2
+	.string	"arg"
+	.byte	0x16
+	.byte	0x51
+	.long	0x66
+	.uleb128 0x12
+	.string	"buf"
+	.byte	0x4
+	.byte	0x18
+	.byte	0x12
+	.long	0x119
+	.byte	0
+	.uleb128 0x4
+	.long	0x6f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF715
+	.long	.LASF716
+	.long	.LASF717
+	.long	.LASF718
+	.long	.LASF719
+	.long	.LASF720
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x15
+	.long	.LASF0
+	.byte	0
+	.long	.LASF721
+	.byte	0x2
+	.long	.LASF722
+	.byte	0x2
+	.long	.LASF723
+	.byte	0x1
+	.long	.LASF724
+	.byte	0x1
+	.long	.LASF725
+	.byte	0x5
+	.long	.LASF726
+	.byte	0x6
+	.long	.LASF726
+	.byte	0x5
+	.long	.LASF727
+	.byte	0x2
+	.long	.LASF728
+	.byte	0x5
+	.long	.LASF729
+	.byte	0x5
+	.long	.LASF730
+	.byte	0x2
+	.long	.LASF731
+	.byte	0x2
+	.long	.LASF732
+	.byte	0x4
+	.long	.LASF733
+	.byte	0x2
+	.long	.LASF734
+	.byte	0x3
+	.long	.LASF735
+	.byte	0x3
+	.long	.LASF736
+	.byte	0x2
+	.long	.LASF737
+	.byte	0x2
+	.long	.LASF738
+	.byte	0x2
+	.long	.LASF739
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF486:
+	.string	"__flexarr []"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF706:
+	.string	"capacity"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF389:
+	.string	"SITL 1"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF696:
+	.string	"unsigned int"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF710:
+	.string	"bufWriterAppend"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF379:
+	.string	"linux 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF705:
+	.string	"writer"
+.LASF711:
+	.string	"total_size"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF509:
+	.string	"__wur "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF701:
+	.string	"char"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF703:
+	.string	"uint8_t"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF707:
+	.string	"data"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF714:
+	.string	"bufWriterInit"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF29:
+	.string	"_LP64 1"
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF550:
+	.string	"__stub_stty "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF463:
+	.string	"__PMT"
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF712:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF699:
+	.string	"short int"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF709:
+	.string	"bufWriterFlush"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF700:
+	.string	"long int"
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF377:
+	.string	"__linux 1"
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF702:
+	.string	"__uint8_t"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF473:
+	.string	"__P(args) args"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF697:
+	.string	"long unsigned int"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF380:
+	.string	"__unix 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF510:
+	.string	"__always_inline"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF364:
+	.string	"__k8 1"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF694:
+	.string	"unsigned char"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF420:
+	.string	"__USE_GNU"
+.LASF704:
+	.string	"bufWrite_t"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF698:
+	.string	"signed char"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF695:
+	.string	"short unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF355:
+	.string	"__amd64 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF382:
+	.string	"unix 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF713:
+	.string	"bufWriter_s"
+.LASF708:
+	.string	"bufWriter_t"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF733:
+	.string	"long-double.h"
+.LASF735:
+	.string	"stubs-64.h"
+.LASF719:
+	.string	"/usr/include"
+.LASF739:
+	.string	"stdint-intn.h"
+.LASF727:
+	.string	"libc-header-start.h"
+.LASF717:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF738:
+	.string	"wchar.h"
+.LASF731:
+	.string	"timesize.h"
+.LASF722:
+	.string	"stdint-uintn.h"
+.LASF718:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF720:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF728:
+	.string	"features.h"
+.LASF737:
+	.string	"time64.h"
+.LASF715:
+	.string	"src/main/drivers"
+.LASF716:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF736:
+	.string	"typesizes.h"
+.LASF734:
+	.string	"stubs.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF729:
+	.string	"features-time64.h"
+.LASF732:
+	.string	"cdefs.h"
+.LASF0:
+	.string	"./src/main/drivers/buf_writer.c"
+.LASF724:
+	.string	"buf_writer.c"
+.LASF723:
+	.string	"buf_writer.h"
+.LASF730:
+	.string	"wordsize.h"
+.LASF725:
+	.string	"stdc-predef.h"
+.LASF726:
+	.string	"stdint.h"
+.LASF721:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.text
+	.section	.gnu.lto_.icf.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 _\265\001"
+	.string	"$\002S"
+	.string	"\003"
+	.string	"\264\374\222\305\003\b\002"
+	.string	"\002\001\002\002\002\001\002\003\001\215\257\275\277\013\016\356\254\210\376\004\b"
+	.string	"\007"
+	.ascii	":\rTu\225R\034@\0012\211\261\033a\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 7\005\001"
+	.string	"\270+"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\001\002"
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\020"
+	.ascii	"\031\351d\303\002"
+	.text
+	.section	.gnu.lto_.inline.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\007"
+	.string	"\262\213\"'\200)I\007\230\t\231\315aB\256\001j\b\322\035P \"+\372"
+	.string	"\234\347\212\201\f\027\020JXhQ\263\244m\"e\n3\314\254\345r\244e\226#1!\372\206\266\351\027\221A,y\ng\242M\002\363\203\207s\375"
+	.ascii	"Z\327Y\214\253Q\214Y\215\202\227\027\345&\001Le\"\2549\r\230"
+	.ascii	"9+\034\267\242#\356\r\202Nh\260E\316\203\240\204\f\243\267@\207"
+	.ascii	"6\021\274O\340\234\217\3057l\333:\177q\333{\234\210\266\312\237"
+	.ascii	"'\021( \220\002\251\243\371D>`8\220\273m>^)\203E\210W\210\031"
+	.ascii	"\335\rf\261F\304:\213\231Y\207\227\226\212i4W48\360r\330\307"
+	.ascii	"\311_t)R\343|] SZn\272\003\204q5s[\236Xa5\021\017\320\r\234\235"
+	.ascii	"\033\343(Jn\217\314\260\335\312T\270\"\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 \251\315\002"
+	.string	"\342\005\021\032\260%\351\f\243\034\300\216\345\341,9|t\030\350N\003A\331\266\2157\221I\006\033\331\206/<\341\331\361\034\331\347\035J0\377\334K})\276\225d6\231\267*v6\360\274`\t\226X"
+	.string	"\373\371\247\215\r\002\006"
+	.ascii	"E\310\200hQ\036\201\265\234\0052L^6\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 \321\335\002"
+	.string	"T\003\305"
+	.string	"\003"
+	.string	"\004\270\007"
+	.string	"\001\002\013"
+	.string	"\003\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\b\300"
+	.string	""
+	.string	"\200\001\b\020\220\001\220\001\210\001\b\177\b"
+	.string	"\002\210\001\b\b\b"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\241$I\350c%\023\323\2711\202 \202\205\240 h\345\300\212\214"
+	.ascii	"\241\216\274\364\270,\360E\004\220\341\006\332"
+	.text
+	.section	.gnu.lto_.lto.77c2e1dba6e8820,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bufWriterInit.0.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375`\264\001\335\017"
+	.string	"\026]jH\320\322(\035*\t\234\037\310\013-\252\216\362j\225\017\234\031\201e>@\355\255Q\002#\260{m\202@\271\301\227\214=\374\361\373\332\305\220eKY\017\261\324\326\0130?;\221\243\344C6\324\226&b\205>\311\347\266[\246\024Q"
+	.string	"W"
+	.string	"V"
+	.string	"\273'V\361>MH\372\003\252\376\306\303\007\354\322\304\300\355\216'\376\274O\333~\213\273\230\231V2\326\310DP\001\263\363cw\374<\336@\367\351\275@\367)Q\234v\245\371\367y\202\034\243[\314\313\265\224\262\273\326[\214\314-o[\201\355\224\255\b\002\347\371K\327\371\347o~\331\251\265S\237\244\344\203@nwD.\310\336\2303V\330\236\371>\036\321\"\320\356\241\245\330B\250"
+	.string	"\261\310\261;.\370t\005\035\002'\217\211l(\330"
+	.string	"I:\262\022\001\373!G\204\004\357S\203@\251\366\307\277\230\035\307A\026\3315A\003\267\001\007Q\302\2469\233\344%i\007f\b\220\273:\273u\234\013\200P\221QI\332-\227a\242"
+	.ascii	"6=\246\264_\377\221y\273\353\300\207\301A\003IM\212O\237\326"
+	.ascii	"}\236\206H\3244\347\023\017)\337\363\t35=\362I\007\216\325#{"
+	.ascii	"|Qy\302>i%\215}\234\337\024,\027\225d\021S\262\013;\264`+\027"
+	.ascii	"R\261W\314\344\325\203\006,\024\006!\n\352\200\352^\241\3040"
+	.ascii	"\326\022e+,\027\325\007\023\303\r-\321\302\207\241\225j\371V"
+	.ascii	"\"\354C\231\370\225!\024\277\330\353%~#\343\336\226\022\302L"
+	.ascii	"M\332|\022\242\322f9\220Kk\334v\\\350\256\356Re! \220\"1;\036"
+	.ascii	"\242C\203!C\331b\207%\0204\311\025\3533\2430\306\341\257\310"
+	.ascii	"4\034s\272\333\334\036FB\017#u\227\027fWo\327\300(0\263]0;\033"
+	.ascii	" \360\350f\327\232\357m\2308\270J\254\303\020O\034m\032\374\334"
+	.ascii	"\351\b\206\f"
+	.text
+	.section	.gnu.lto_bufWriterAppend.1.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375`\341\002\035\025"
+	.string	"v&\205G\320\362h8#\221K@d@\001e<\334\362\277\327\211\357x\021F\310\252Z\350*<F<\241\234\366\235\330\020\001\317\024\333q\310\036\335\236\254\206\013\037\022\320\313\347\327\217\202\310]\265\334\357\320\223\313F\310\336[\312\224\002l"
+	.string	"k"
+	.string	"r"
+	.string	"\316\023(\232v\212\212\356\300\234u\367'\007\003\326\305\024By\332g\361\026\272\377nN\262\013\004\203\306.\320\3043\326E\003_2^d=\300x\321:\373G\201\f/\244\235\243!\273;S\022\327}\f5u\376j\245\325\363\341|\354y\030\314I\215\371tB\331\356\236\350\271\301\307\313\\\255\354\256\263\347\343p\257n;\202m\007\266\232\004\327\221\241\337.\253\\\342\341is\312\006\362R\203\354\207\273\273V \233\225\216\255\3220M\277\306\264\353\300\277\365\337\277\022\323\241\246UL\247\230>IK\210"
+	.string	"\246]\236\252\"\353$*\231\360\213\036\304\335\205\177d`\204\353F\341~"
+	.ascii	"\2609IHR\273\300\003\027\223\007\345y#\334\1777\252\241A\207"
+	.ascii	"&\251\213~\021\316v]\274\313\001;TA\267\334\006\315.\205\325"
+	.ascii	"T<|n\354\361\340\037\244x\372\321!\240\330\261\322\033]\266\313"
+	.ascii	")\327|rwqT\203\034j\252K"
+	.string	"\221\216\234$b\273\366\032\241\226D\201h\251m\f\237\221\213\t\355\356\002\033\3462l\027\225\300P\bU\315\245\035\252\324\244\021\241\367\200\374\271\361\232\232K:?\274\254\262\035s\244\034kw\023\370/hdX%n\306\213\001\023hi\232\002\225\227\024\004\265\224\223\001.7\355\344V\263\261\335p,/\026\\f5\267\332\005\333M\302\214\202\255EfF\273\325\314Nd\236\241\251\335f633\267\231\013\270{\270\ndQ\204\323Ny\366\215~\242\263\240|\234v\243\006)\375A\307\034G\016&4\302#\310W\220\344Ka\032S\273\3242\035\305ay\223}\304\364\025\365;S\205\336\203\206\371\r\230*T\257\347\245\217\021= p\202\2319\273\0030\306P4-\t\303\220\305\334\307\243\211\3453e\200a\267\222\305\021\332r\303{k\0163\306\272\3066\001\317]\362M\t\377\226\233\275\n\333\301@\027;Y\210\321"
+	.ascii	"\3048.1Q\372(\330!\221\273x\n\226\246D\234\033\204c\343\r\025"
+	.ascii	"\214\344\342\267\013\f\261ln\232d\272h\031\351\223\211@\262\235"
+	.ascii	"\370\307\274\3618Gt\021\342\342\213\261\254\326|\310\221%X[\003"
+	.ascii	"!\b\245\346\304e\247\230\222\233\306\306&\2742"
+	.text
+	.section	.gnu.lto_bufWriterFlush.2.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375`c\001\275\r"
+	.string	"v\331YB \221\222\016sd!\361\311\027\242\004\t\036\367\006>\222\0324`\321\337Y\0016UE\f\r\007\372\004\333\326a\317 \333\003\030$\022!\200`\240\224\370\327\231\033"
+	.string	"\033<\327\372\210?\225\021D\366\2262\245F"
+	.string	"@"
+	.string	"I"
+	.string	"\273#\232\025\273\035\001G\352\320\335;\323!u\001\323\2417\233\306"
+	.string	"\n\034\027/37v7\252\206o\177\232\233\357A\362\021\022q\177\030\256"
+	.string	"D.\317\263\273/=-\210Z2=Hv\327\031\022]\270\341\255\300>\212,y\343\316\207\027\2339\354\216K\215\261\377vw\255#\373\244\237\232\322\020\246\337K\253\2463\323\257*\033\235\026\27307:\266\006\262\360`\373\366\273\315\256\354\204)\360|\311\027\361\021\333I+\017\020\234m\3534\236\301\261\021\331"
+	.string	"\225\023\203\364\023*!\373\272\t\007\207O\025F(\303U\365*^v\330\330g\036\344\005\"w\227Sg\323\025$#\303%q\3306y\211\214\332]\004>\211\223\bT\207C\177e:\274\202p \005\266\022\034(\0311p\215|D@\267\365\321\256\024L\233\260\240D\005\024Q\264K\002\2465\210'\030\003\223hi(\361\343q\006\341\322bJ\226i\261\352\366oudX\252a\321\226\24712O\221Q !65\036\"$U\237Bu\252=\0254\037"
+	.string	""
+	.ascii	"\030\316\230F\274\r\265\331\362\261;\254f\370k\354\200r\273\242"
+	.ascii	"\001\2015\333\035%S\032T\371\2726\3670\331y\270pTW^\301\341\b"
+	.ascii	"*\t\376\002\202\241\352\211\270\004,\034`\023|v\031\023\356f"
+	.ascii	"0`Q\345^\271\371\301\301\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 b\375\001"
+	.string	"\024\003^"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\r\002\177\016\004\001\001\001\225\013\004\002\201\200\200\200\002\001\265\006"
+	.string	"\004"
+	.ascii	"I\b0\240\007\370\341Zs\f"
+	.text
+	.section	.gnu.lto_.refs.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.77c2e1dba6e8820,"e",@progbits
+	.string	"(\265/\375`M\007\255*"
+	.string	"JK\240\020Gp\336\321p\341\340\246\206"
+	.string	"\357"
+	.string	"\202\002\3173/#\256\231\3600\311$\256\346@\374@\2664\027\013jy\233\235b\202\257\362+\023\246\342Vh\242db\256\370>R\252\347\221\235 ^\323\300\220\330\310\235W\302m\267L\001\327"
+	.string	"\373"
+	.string	"\364"
+	.string	"h\372\237\372\023\352K\250\017\241\262\026k\341,!\336\202[\231/ow'\312\035;hz\016\352Y(\307o,\224\273\006\265\307\004r=.\220\373\271iE\367\006\255\250\006M\317Yl\345\347)\214\305L\034\013\345\266V\367\373\303\323:\353\321\005M\177^\236\231\277\204\242\257\371tcuwPZ\266\244\343\004M\371U\223D\371\361\204\246\\\345\317\034\353\223\0164\275[O\032\3455\205\fM}\034\234\251|"
+	.string	"\263\213\216\252\177\271@Ne\002\271\021e\275\237\333\374_r\215\371/\2069\340\347\263\377b\377\277\302F\354~\226\363\277\355\377\332\177\262\377f\377\315\374w\361\237\353\377\226\377A\377G\374w\376/\363\277\354\277\225\377\274\377c\377\323\267\267\267\267\237\203~n\360\363\320\t\335\t\372\355>v\257\334\316\356^\273\033"
+	.string	"r\352\355\026\322c\253\216\307n)\240cO\255^7\272Q\255\264\256\226m*]\237\027\226fU\343xW\256j\264$Rm\256\313\206\352nnS\253Z\037o\316|\341\220\264>X3\336:C\006U4#\304{\177\034\251\234\177\242\353\362\211\030Z\346e\273e\362\210\0264%\003B\315\322DQQ\242~\202\027\356\352\202r%\214\303\360\227"
+	.ascii	"\\7\021\253j\002\027\336b\247\324\005)R\030\353\367\205q\227"
+	.ascii	"?\203\212\354\007'Q\330\272\3371\006\3431,\306d8\213\303\330"
+	.ascii	"\353\374\205\301\034\350}\321\317X8\214\263\360VP\261\273\b\021"
+	.ascii	"\001f\\\262\330\231\323\375\016\r\r\r\001\r\355\334\246\250q"
+	.ascii	"\371\244\347\257-\024\335\306\356>\3203\346\205\214\nM\357;\213"
+	.ascii	"9\201\034R\352m^\200#`\204\260A\323\323P\031\310\205\312\\\314"
+	.ascii	"\236\253*6\222\001WQ\253\221l\247L\343\261\203\r{\351p,\211Z"
+	.ascii	"\242)\257a3"
+	.string	"\245U;\006M\031\355b\322\254,Qih\312g\334\325\243\224\322\321\343\251\003S\242,\033S\217\376\271&\"\273\273\007\317\333\310\242\317\231\207w\214c\006\215\023B\322=\205\006Gm\302E\034\202\246\377\027\364\377c\350\025\212\221\330\376\364\333H\266\231\\\331+f\355\317\333F\016t\223\252\3317\331\246n\243\3756\2671\331\306`_\027\311\276\356\332k\243\273v\277m\217\325\"\256\3146\223-\333t\333\2376\366\332M\242\021\325\350\266,\031\267\355\261Mb\313\032\223\355\017\020\264#:rd1\231\260\031\326\330;\216SDd\317\311\276n\243u\263\326\215F2\350\236r\221hD \334Ut\356(r!\272\374v7\202cQ\351\266\321\311^\271\335W\305\026}\244\260\276\316N\302\316\225j\252\241n\004-\232\234\\t\020\240b)\310\304\224\201w\340Pi\t\304\356@%ap)\310B=\005\243\007FG4"
+	.ascii	"\374\b)\002R\204\334\217\220|>$#\237z#\037n\370\026\013\016\203"
+	.ascii	")($\032\302\200!$\322\375\206?"
+	.string	"\025iS\222P7L2\261\302)E\200\034\013\341\017Wc\250\004\3741\375\200\3520\351h\270\244\344\004`\370C\017\254P\264B\002\205\240\004\b\006n\301\302\206\005$DxP\201\020\204\301\241\222pF\322\n\247\024DM\302\240\f%\241\n\242%\245\337\013\"\240\260\211\b\202\202\2436\334x\216\033\313Q\327n\\w\021\261*\244\265+6q\316rtJ\202\204Y=yd\352\024\227\bQ\321\"ll\334\326\353\242\232\026\266\234\321\316\033\330\233s\3332\r\314ESv\303O\235\325\031\226 \274\305\243\214\243\306\205\246G\237T\024\313\001\243\3414g5W\303k\352\333<.0\341a5\247\245\244\032\364(\237\272\230i\3475~\242W\224[\252\236ji\200\222\250\2610\245\030D\"2\"\"R\320\202f\f\220\002\221\251\3446\021\2401sF\212$\251\354\317\001\302;\261\317\270\352\237\272)\230\204TX\325>r"
+	.ascii	"\033\0217\325\354\375\020I\013\027\233\022^q\006\236H\037\023"
+	.ascii	"\314Uk\315\361\\\242\360\3202,\325\211\345\321\253\222*\211\265"
+	.ascii	"\340\243\022U\2177\r#\233\007\023\260\357d\250/fe\024\263\244"
+	.ascii	"l\310rkQ/DF-R\356\331\326\354\342y'\260\222$\025\231\205`\341"
+	.ascii	"m\240\251\221\370\234\004\\\022Laa\030\020\201\253K\340\033)"
+	.ascii	"\216\307Mmf{\020\300yY\257\3504e\256\230\207\036\330@H\003\254"
+	.ascii	"\270\f\n\236\371\213c\ra\301:)\366xHC\300\300Z\241A\365\373\314"
+	.ascii	"K\236\030EC\354&Q\004VD\205\036\0241J\020\020@\376GI\006\370"
+	.ascii	"\016\312\370\007c\206\340U\320.\346\213\b&r\300E\371\210\301"
+	.ascii	"\005\304\200\236`\355m\211vD\023\033^\033\250\001\274\351\243"
+	.ascii	"d\200p3{\267\361\177\230\251\301\215=\272K\360\232oYt\330\211"
+	.ascii	"\225\266}\203\007\252)\272\032"
+	.text
+	.section	.gnu.lto_.symtab.77c2e1dba6e8820,"e",@progbits
+	.string	"bufWriterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.77c2e1dba6e8820,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6591 @@
+	.file	"compass_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/drivers/bus_i2c.h"
+	.file 7 "./src/main/drivers/bus.h"
+	.file 8 "./src/main/common/axis.h"
+	.file 9 "./src/main/drivers/sensor.h"
+	.file 10 "./src/main/drivers/compass/compass.h"
+	.file 11 "./src/main/drivers/compass/compass_fake.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	compass_fake.c.9b3aba0b
+	.weak	compass_fake.c.9b3aba0b
+compass_fake.c.9b3aba0b:
+	.long	0x335
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF985
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF934
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF935
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF936
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF937
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF938
+	.uleb128 0x1
+	.long	.LASF939
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.long	.LASF940
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF941
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.long	.LASF942
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF943
+	.uleb128 0xd
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF944
+	.uleb128 0x1
+	.long	.LASF945
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x1
+	.long	.LASF946
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x1
+	.long	.LASF947
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0xe
+	.long	.LASF986
+	.byte	0x4
+	.byte	0xa1
+	.byte	0xa
+	.long	0x9f
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x4
+	.byte	0xd4
+	.byte	0x9
+	.long	0xce
+	.uleb128 0x4
+	.long	.LASF959
+	.byte	0x4
+	.byte	0xd6
+	.byte	0xb
+	.long	0x7e
+	.byte	0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF948
+	.byte	0x4
+	.byte	0xd7
+	.byte	0x3
+	.long	0xb7
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF949
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF950
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x100
+	.uleb128 0x7
+	.string	"X"
+	.byte	0
+	.uleb128 0x7
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x7
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF951
+	.byte	0x5
+	.byte	0x19
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x10
+	.long	.LASF957
+	.byte	0x5
+	.byte	0x4
+	.long	0x64
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xe
+	.long	0x13d
+	.uleb128 0x11
+	.long	.LASF952
+	.sleb128 -1
+	.uleb128 0x2
+	.long	.LASF953
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF954
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF955
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF957
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x10c
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF958
+	.uleb128 0x8
+	.long	.LASF962
+	.byte	0x10
+	.byte	0x7
+	.byte	0x1a
+	.byte	0xc
+	.long	0x178
+	.uleb128 0x4
+	.long	.LASF960
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x16
+	.long	0x178
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF961
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0x100
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xce
+	.uleb128 0x8
+	.long	.LASF963
+	.byte	0x8
+	.byte	0x7
+	.byte	0x21
+	.byte	0xc
+	.long	0x1a5
+	.uleb128 0x4
+	.long	.LASF964
+	.byte	0x7
+	.byte	0x22
+	.byte	0x12
+	.long	0x13d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF965
+	.byte	0x7
+	.byte	0x23
+	.byte	0x10
+	.long	0x93
+	.byte	0x4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF987
+	.byte	0x10
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0x1c7
+	.uleb128 0xa
+	.string	"spi"
+	.byte	0x20
+	.long	0x150
+	.uleb128 0xa
+	.string	"i2c"
+	.byte	0x24
+	.long	0x17d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF966
+	.byte	0x7
+	.byte	0x25
+	.byte	0x3
+	.long	0x1a5
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x9
+	.byte	0x17
+	.long	0x215
+	.uleb128 0x2
+	.long	.LASF967
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF968
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF969
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF970
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF971
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF974
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF975
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x9
+	.byte	0x21
+	.byte	0x3
+	.long	0x1d3
+	.uleb128 0x1
+	.long	.LASF977
+	.byte	0x9
+	.byte	0x23
+	.byte	0xf
+	.long	0x22d
+	.uleb128 0x5
+	.long	0x232
+	.uleb128 0x13
+	.long	0x149
+	.uleb128 0x1
+	.long	.LASF978
+	.byte	0x9
+	.byte	0x24
+	.byte	0xf
+	.long	0x243
+	.uleb128 0x5
+	.long	0x248
+	.uleb128 0x14
+	.long	0x149
+	.long	0x257
+	.uleb128 0x15
+	.long	0x257
+	.byte	0
+	.uleb128 0x5
+	.long	0x87
+	.uleb128 0x8
+	.long	.LASF979
+	.byte	0x28
+	.byte	0xa
+	.byte	0x17
+	.byte	0x10
+	.long	0x29e
+	.uleb128 0x4
+	.long	.LASF980
+	.byte	0xa
+	.byte	0x18
+	.byte	0x17
+	.long	0x221
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF981
+	.byte	0xa
+	.byte	0x19
+	.byte	0x17
+	.long	0x237
+	.byte	0x8
+	.uleb128 0x16
+	.string	"bus"
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x11
+	.long	0x1c7
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF982
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x14
+	.long	0x215
+	.byte	0x20
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF983
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x3
+	.long	0x25c
+	.uleb128 0x17
+	.long	0x87
+	.long	0x2ba
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF988
+	.byte	0xb
+	.byte	0x21
+	.byte	0x10
+	.long	0x2aa
+	.uleb128 0x1a
+	.long	.LASF989
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x5
+	.long	0x149
+	.long	0x2e2
+	.uleb128 0x6
+	.string	"mag"
+	.byte	0x3b
+	.byte	0x1d
+	.long	0x2e2
+	.byte	0
+	.uleb128 0x5
+	.long	0x29e
+	.uleb128 0x1b
+	.long	.LASF990
+	.byte	0xb
+	.byte	0x33
+	.byte	0xc
+	.long	0x149
+	.long	0x304
+	.uleb128 0x1c
+	.long	.LASF984
+	.byte	0xb
+	.byte	0x33
+	.byte	0x21
+	.long	0x257
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF991
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x6
+	.long	0x32c
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x2c
+	.byte	0x19
+	.long	0x87
+	.uleb128 0x6
+	.string	"y"
+	.byte	0x2c
+	.byte	0x24
+	.long	0x87
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x2c
+	.byte	0x2f
+	.long	0x87
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF992
+	.byte	0xb
+	.byte	0x23
+	.byte	0xc
+	.long	0x149
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 28 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.file 29 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 31 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.file 33 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 34 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF933
+	.byte	0x4
+	.file 35 "./src/main/drivers/compass/compass_fake.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF902
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF926
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF993
+	.long	.LASF994
+	.long	.LASF995
+	.long	.LASF996
+	.long	.LASF997
+	.long	.LASF998
+	.long	.LASF999
+	.long	.LASF1000
+	.long	.LASF1001
+	.long	.LASF1002
+	.long	.LASF1003
+	.long	.LASF1004
+	.long	.LASF1005
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x24
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1006
+	.byte	0x9
+	.long	.LASF1007
+	.byte	0x9
+	.long	.LASF1008
+	.byte	0x9
+	.long	.LASF1009
+	.byte	0x6
+	.long	.LASF1010
+	.byte	0x5
+	.long	.LASF1011
+	.byte	0x5
+	.long	.LASF1012
+	.byte	0x5
+	.long	.LASF1013
+	.byte	0x2
+	.long	.LASF1014
+	.byte	0x5
+	.long	.LASF1015
+	.byte	0x4
+	.long	.LASF1016
+	.byte	0x4
+	.long	.LASF1017
+	.byte	0xc
+	.long	.LASF1018
+	.byte	0xd
+	.long	.LASF1019
+	.byte	0xd
+	.long	.LASF1019
+	.byte	0xc
+	.long	.LASF1020
+	.byte	0x9
+	.long	.LASF1021
+	.byte	0xc
+	.long	.LASF1022
+	.byte	0xc
+	.long	.LASF1023
+	.byte	0x9
+	.long	.LASF1024
+	.byte	0x9
+	.long	.LASF1025
+	.byte	0xb
+	.long	.LASF1026
+	.byte	0x9
+	.long	.LASF1027
+	.byte	0xa
+	.long	.LASF1028
+	.byte	0xa
+	.long	.LASF1029
+	.byte	0x9
+	.long	.LASF1030
+	.byte	0x9
+	.long	.LASF1031
+	.byte	0x9
+	.long	.LASF1032
+	.byte	0x8
+	.long	.LASF1033
+	.byte	0x7
+	.long	.LASF1034
+	.byte	0xd
+	.long	.LASF1035
+	.byte	0x7
+	.long	.LASF1036
+	.byte	0x1
+	.long	.LASF1037
+	.byte	0x3
+	.long	.LASF1038
+	.byte	0x5
+	.long	.LASF1039
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF954:
+	.string	"I2CDEV_2"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF956:
+	.string	"I2CDEV_4"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF961:
+	.string	"csnPin"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF970:
+	.string	"CW180_DEG"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF951:
+	.string	"IO_t"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF945:
+	.string	"int16_t"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF960:
+	.string	"instance"
+.LASF967:
+	.string	"ALIGN_DEFAULT"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF792:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF920:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF975:
+	.string	"CW270_DEG_FLIP"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF906:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF972:
+	.string	"CW0_DEG_FLIP"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF976:
+	.string	"sensor_align_e"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF943:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF950:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF911:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF959:
+	.string	"test"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF915:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF927:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF923:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF928:
+	.string	"I2CDEV_COUNT 4"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF914:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF938:
+	.string	"signed char"
+.LASF946:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF913:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF931:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF983:
+	.string	"magDev_t"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF952:
+	.string	"I2CINVALID"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF793:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF934:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF904:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF958:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF877:
+	.string	"NULL"
+.LASF968:
+	.string	"CW0_DEG"
+.LASF933:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF932:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF910:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF926:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF858:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF905:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF840:
+	.string	"__size_t__ "
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF396:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF939:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF925:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF767:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF962:
+	.string	"deviceSpi_s"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF992:
+	.string	"fakeMagInit"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF965:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF978:
+	.string	"sensorReadFuncPtr"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF979:
+	.string	"magDev_s"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF908:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF971:
+	.string	"CW270_DEG"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF917:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF929:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF794:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF942:
+	.string	"__uint32_t"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF919:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF949:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF916:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF980:
+	.string	"init"
+.LASF468:
+	.string	"__PMT"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF981:
+	.string	"read"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF936:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF900:
+	.string	"UNIT_TESTED "
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF922:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF765:
+	.string	"ACC "
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF977:
+	.string	"sensorInitFuncPtr"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF988:
+	.string	"fakeMagData"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF769:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF749:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF944:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF721:
+	.string	"LED_STRIP "
+.LASF783:
+	.string	"USE_UART7 "
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF918:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF907:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF935:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"BLACKBOX "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF985:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF957:
+	.string	"I2CDevice"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF964:
+	.string	"device"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF818:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF771:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF984:
+	.string	"magData"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF898:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF937:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF921:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF819:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF903:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF857:
+	.string	"__size_t "
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF728:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF909:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF879:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF940:
+	.string	"__int16_t"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF709:
+	.string	"USE_PPM "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF986:
+	.string	"SystemCoreClock"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF955:
+	.string	"I2CDEV_3"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF948:
+	.string	"SPI_TypeDef"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF989:
+	.string	"fakeMagDetect"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF710:
+	.string	"USE_PWM "
+.LASF856:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF748:
+	.string	"GPS "
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF966:
+	.string	"busDevice_t"
+.LASF987:
+	.string	"busDevice_u"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF791:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF912:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF941:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF930:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF901:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF902:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF973:
+	.string	"CW90_DEG_FLIP"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF982:
+	.string	"magAlign"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF896:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF899:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF706:
+	.string	"USE_CLI "
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF974:
+	.string	"CW180_DEG_FLIP"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF990:
+	.string	"fakeMagRead"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF924:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF947:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF963:
+	.string	"deviceI2C_s"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF991:
+	.string	"fakeMagSet"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF897:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF969:
+	.string	"CW90_DEG"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF953:
+	.string	"I2CDEV_1"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1010:
+	.string	"io_types.h"
+.LASF1026:
+	.string	"long-double.h"
+.LASF1032:
+	.string	"platform.h"
+.LASF1009:
+	.string	"target.h"
+.LASF1013:
+	.string	"axis.h"
+.LASF1020:
+	.string	"libc-header-start.h"
+.LASF1018:
+	.string	"stdbool.h"
+.LASF1003:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1015:
+	.string	"compass.h"
+.LASF1007:
+	.string	"stdint-intn.h"
+.LASF1033:
+	.string	"common_fc_pre.h"
+.LASF1002:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1005:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1027:
+	.string	"stubs.h"
+.LASF998:
+	.string	"src/main/target/SITL"
+.LASF1024:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1001:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1011:
+	.string	"bus_i2c.h"
+.LASF1022:
+	.string	"features-time64.h"
+.LASF1006:
+	.string	"types.h"
+.LASF996:
+	.string	"src/main/drivers/compass"
+.LASF1016:
+	.string	"compass_fake.c"
+.LASF1029:
+	.string	"typesizes.h"
+.LASF997:
+	.string	"src/main/drivers"
+.LASF1004:
+	.string	"/usr/include"
+.LASF993:
+	.string	"src/main/build"
+.LASF1038:
+	.string	"rcc_types.h"
+.LASF1021:
+	.string	"features.h"
+.LASF1035:
+	.string	"common_fc_post.h"
+.LASF994:
+	.string	"src/main/common"
+.LASF995:
+	.string	"src/main/config"
+.LASF1030:
+	.string	"time64.h"
+.LASF1008:
+	.string	"stdint-uintn.h"
+.LASF999:
+	.string	"src/main/target"
+.LASF1039:
+	.string	"compass_fake.h"
+.LASF1012:
+	.string	"bus.h"
+.LASF1000:
+	.string	"src/main"
+.LASF1014:
+	.string	"sensor.h"
+.LASF1031:
+	.string	"wchar.h"
+.LASF1025:
+	.string	"cdefs.h"
+.LASF1019:
+	.string	"stdint.h"
+.LASF1036:
+	.string	"build_config.h"
+.LASF1034:
+	.string	"stddef.h"
+.LASF1028:
+	.string	"stubs-64.h"
+.LASF1023:
+	.string	"wordsize.h"
+.LASF0:
+	.string	"./src/main/drivers/compass/compass_fake.c"
+.LASF1037:
+	.string	"parameter_group.h"
+.LASF1017:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"t\003b"
+	.string	"\006"
+	.string	"\302\316\332\366\007\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\355\305\323\306\t\f\003\265\200\315\263\f\004\205\250\203\370\013\004\002\003\002\004\002\005\002\004\005\240\342\234\212\n"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\004"
+	.string	""
+	.string	"\003\002\001\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"9k\310\fe\003X"
+	.text
+	.section	.gnu.lto_.inline.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 .5\001"
+	.string	"\360\""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002\001\001\003\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"t\203m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 \213\235\002"
+	.string	"D\003\177"
+	.string	"\004"
+	.string	"\001\002\007"
+	.string	"\001\002\006\001"
+	.string	""
+	.string	""
+	.string	"\002\001\370\007\001\002\006"
+	.string	"\001"
+	.string	""
+	.string	"\020000"
+	.string	"\003\004\b"
+	.string	"\002\002\t\300"
+	.string	"\300"
+	.string	"\002\n\300"
+	.string	"\200\001\200\001"
+	.string	""
+	.string	"\f"
+	.ascii	"-\".\001^n\251j\364\253\020`\270]M\242\"\312n\030j\236\nF\333"
+	.ascii	"@\033"
+	.text
+	.section	.gnu.lto_.lto.6dfe1ecce578d33b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.5.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\r\t"
+	.string	"\262\317::0\221\322\001"
+	.string	"\326l\024\267\331h\204\334T2\306&`\346\322\343[\025\003u~\316j\r\333\202\337\020\002\311\376\006\222 \031\026\006\\\301Pz\025}\005N\315\340\242\271\355\336)\005\356<\036\004\367\320\020r!\320\327\325\020\364&>\240C\215\370p\240\332\201a\365\030\370\013y`\225\370>\260\216\373\315\316\225/j3D\346a\232\026\356\200\034\345*_q\311\373E\373\200!\374\304\244\223\001#\330\2134\333\007/\021qX\273\273\371#'\241\360[\247\256\030\311\243N\375\221v*\300\2221\311\231\317\361\222\305\254\244\261\307\222\234\032\3667;W6e8\2718\261\335\324\254f_\324\245\3036\311\016p\202\002\311\342GVjk9\245\314\354\216un\\\274\024\375\213\\b\264`b,\252\322%\300\302\356Z\242T\027\367\274\355\002\333\233\375\201\024"
+	.string	"]\325\033\330\323\035\313\006\036\373.\366x\2765 \276\\I]\025\"\034D"
+	.ascii	"c\200qV\361\300U\r\367*@\327\360[D[B\020p\347^\355|\002"
+	.text
+	.section	.gnu.lto_fakeMagSet.6.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375`\002\001}\013"
+	.string	"\366\223KD\020\351(\035"
+	.string	"O0;\002\200_\006\300?\370Y\177A\3577o~\003\220\367\244\202\272\bQ\222\210j\337\342|$\201\232\335\354\203\243\372\263P]"
+	.string	""
+	.string	"\b\360\b\315hwW@\016<'\372\370uo\262wJ\0014"
+	.string	"7"
+	.string	"9"
+	.string	"\273\"\223<\247\017\007\325Sy\210zj\321\216\020Zip\300b\233\260\273\336\264\271x)\372\027p\006X\314u\271\240\261\273\226\260\330\313=o{\302v\207\375\224\273\353)\263_\373\353\307\277;\355\227\036\007\030\220\204\335\226\\\205\305\321\005:\266\377\261+M\355\001G\314x\333\360\234V\227\f)\355\003\370L<\255e\272;\263\223`\003\363v\004\007\334\240*\350D7P \200\234\266+N\240\025q\263\273\030\276\355\003H\374\234S\233\260\344a\247>\253\236J\340\310\274d\316\240\031\204\225\024\354\321%g\215\375n\003(g\335%\213\257\364]\224H\243\320\311m\032\235B>\020\217\325\247J\201&o\025\236JP\341\207'\202\372R\236)\\y#\n\203\252S\350\215\200`\350}\306}\267Sf\312"
+	.string	"\367\232*\256\001\033"
+	.string	"5\245\367\212>\031\323\200\3240n\310j\354"
+	.ascii	"\343\264r(Yv\300\036h\006\226\003\261L\305\001\354\315\254\032"
+	.ascii	"\024\027\206x\030\n\f\003C\300\034\b\f\030\001\343^\250)\341"
+	.ascii	"\016/\332I\006"
+	.text
+	.section	.gnu.lto_fakeMagRead.7.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375`-\001=\f"
+	.string	"F\227SA\020Q\225\016\360\024+<\214\251R\t\312\207\370(&\205\307\344\350\005\210\356\343;\003\004\351k\271j\ralW\376\223\b\"\250\273\377-\024\001\200\322\223 \n-eK@ii\030\337k\210\033I\231R>"
+	.string	">"
+	.string	"A"
+	.ascii	"\261\335/c\216\345\320"
+	.string	"\3371\331\241\345\003\262C\333^\320\340d\357\337\213\265\261\241\202\345\330\3754\rq\357\351\371?\361\354\360\361\201D\244\205zV\034\354\256s\325\342p\353m\037\260\035\301\276\207'\276\210\230I\311\246\016\373C\245\202\260O\331\335\265\272\354\203\374P\323\252\351\324\364\001hP\205\020 \331e\235\354\330\031pd\204\355\223}\261!\216\007\231\366?n\342t\020\323\005\354\272X\0041\312[\374\205\213\033Fv\2502R}\221\314|EHbb\320\270\3720\322(\300\313\3037e\207\t[\225\330Np\025#\313\356n|\024O\321\371\036\207\306P\312\257\016\375Rvx5Pc$\225\001\356(\210\235\310\240\303\321\024\210\244\b\241B\fU\354\321|,D\n\022\272(\nm\036\255\343>\031@\334\004\355\002(\2064\017\327i\032\004\336D\037N#m\033\247]l\373\333SV]\3672-aB\"\245\033\214\271\241\352\007\026"
+	.string	"w\312\365\025-IY[U\373@(\024,dP\302\306\252\320\027\024\003\367\201B"
+	.ascii	"4\260\235\023\222Q\361\316\212\225a\263S\243Z\233\\\270\243;"
+	.ascii	"X|\265\363\t"
+	.text
+	.section	.gnu.lto_fakeMagDetect.8.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"]\n"
+	.string	"\006\224JA\020\347*\035\200\255'\212p\372\312\333\004*\007%<\031K\303t=\351w\036Dbz\302\245\026[\303X\035\361\003V\b\206`\356\237\001T"
+	.string	""
+	.string	"\302\256S\260\314\205\013\200\230\355t\233\277\346F{\247\0246"
+	.string	"4"
+	.string	":"
+	.string	"\357t\257\233+t\257\266\0351\2012\351)\241\bn\253\231\202\335\322\243,'?I\377\262O\025\231\201Z\200V\352\323\300bw=Y-\224\233\336v\203\355\013\373\b\001\276fw\327\324e?\366\317JMV"
+	.string	"\030j\273'\271\005K\240\nx\331\276m\224\315\261\353\200\2129\355\307\034\206z\354\364\204]\027\214\266[>\030\264yu\031*J\342N\216T\002?\013;\270\002;ov\307\270p`Wu\226\375\361\231\220\315\356R\3702#\"\007-.\257\376\251{=\216\225\242\2329\377E\263%\330y\263\313\324\244+\016\016A|\241O\"\004\372x6>\220Z\364\031\225>\r\214\3613\201\241\310\033\305\021\bI\314\3608H\037\350\211\304\321\373884\215D\317#\fE\217c\333\345^\263\324\345\223\035\205\261\275\004\013"
+	.ascii	"7\345\377J\213\033\346\322\214\375``PPU\023l+\274R\206y\357\202"
+	.ascii	"\346\325N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 |U\002"
+	.string	"R\004\017\031\260'\035x\242\221\244"
+	.string	"\022!\255\217$I\222\344Y[\013l\226,\261{\247\377\266\024d<R\270\377T\033#\323\025\031\034\360\266J \374S\225r\230\317\177\026Cm;$\336\177\022\003"
+	.ascii	";i\337\363 4\212*\003"
+	.text
+	.section	.gnu.lto_.refs.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375 9\255\001"
+	.string	"\324\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\002"
+	.string	"\001\001\004"
+	.string	"\001\001\006"
+	.string	"\003\002"
+	.string	"\001\002"
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"\001\b"
+	.string	"\003\003\002\004\002"
+	.string	"\002"
+	.string	"\002\002\004"
+	.string	""
+	.string	"\001"
+	.ascii	"zn>\001"
+	.text
+	.section	.gnu.lto_.decls.6dfe1ecce578d33b,"e",@progbits
+	.string	"(\265/\375`\251\013\275@"
+	.string	"\212r$\031A@dN:k\245\b\005 \r\205b\201\f\033'\004\364J\265Gg@h\200\211\224\206\266.\206?\276\205\n\212\267\250\306"
+	.string	"\214\343\177\356(\026\331fr\305\007\024\320\377$'\177\336\371L A\354\226)Q\001\200\001\201\001We;"
+	.ascii	"\210\240\355\271\271\352o\260\177\235\377-\305?\256\350\240s"
+	.ascii	"\325\213\261g\351\0051\235\017\222\222W$\314U\037\203=\030\373"
+	.ascii	"\026\354W\260\334\034\265>E\255*\013X\023\260\271kB$\367f\307"
+	.ascii	"U\317R\276\263\333`\310\254\311\375\316v\177\326\026\323-u\037"
+	.ascii	"P\272\222\245\315\354\252Lwy\r\327\235\351X\315\263\266\276\304"
+	.ascii	"\354\270\356\226\351\324\356%\263\202&f\005HxT\226eV\365*\330"
+	.ascii	"\237\347\246j\223+t`\3220\232\343Z\234\277"
+	.string	"\253\236\321\374\334\262\034O\031\332\315\354n\002IA\334\310\261\271*\223\3412,\235b3g1|\346H\313\266[6\344F\366\274\352\023G\255\027\301.m\375\321\023X\366\326/\233\243\233\247V\016\f\344\2515\002G\255+\013XY\f\326y\214\200\325\211\326\266S\320\356M\231\243\253\3360?\203\341\270\251`\323\f\332\323\356\026*\t\356N\211\223\253\276\345\250\225e\001\353\001\177\206\262\373\231i\351\277)\244\330\377^8\n\017_\363\177\375\257\326\317V?W\375\314\340g\004?\033\370y\352\347\377\034\374Y\300\377\351\3773?G\375<\340\377\335\3774\377\321\374\217\373\017\365\237\316\177\244\300\300\300\300\377}\377\345\372\225\210\001^\376\353\274@n\220\373\203\245\367yu\374\226\335\035\3146\367y\233\367,\216\326}r\034nt\200\254\t\202\315\227\276\373\274\313\313\344=\264\266\203\260\350RD\314_U\225\223\236\036+o"
+	.ascii	"\324k\306y\0221\342\321\262\227\307\355\301\322\353\343"
+	.string	"-SpYD\257\216ju\242Z\177\341\330Ku\253\260\227\314\356\210\223\274Ej\354\257\221\3338x\004\002\324\301\006\002\256}A\246=\370\321\031\320i\020\234%\241\253\336\217\347\376+)\025\332c\307\355\252\277\3152\232b;%#\037\210X\376c9\274\247I\t\325\355d\372\326\335\212x\021K\371\217\371\374q\037\366kb>5\223NM\325T\325\2032Fu\253z-\366cAl\210\367\246\\n\322\364u7\"N\304R\366\343Cj\333=e\274\037\313\217\3718\020\357\241a\260\233\253\222\252j\262\222\005L\030>V\205c\236\321\273*\017bB,\345B\334wv\303xW\311@;\332\335LL\203\326\360\264\324am$\361\361\3263\034\226\375\360\037\226\"`@A%\031'&@/\200\215\352\3303\202\225\003\031\301z>\303\236\313\260g\270<\254\207\245\274\207\361\234\3370\234K\265\335j\272\373Zz|\347"
+	.ascii	"Y\363C\036\230\276\356\366\034\367c\355\3419\234\027l\257t3I"
+	.ascii	"\342\204\247N\2326\177\335\255TU\025\333&\212\033(\253z\326q"
+	.ascii	"\347\274\307\304\243.K\237\203n\236#x\314\253\336%\301(\021\275"
+	.ascii	"\265\253^(O\345\354\034\0013mzC4Ey\325\007\r\261H}\326\326\030"
+	.ascii	"\020\020\037\026\351\313\326o\232\364\2461\232\333\266\222\004"
+	.ascii	"\032g?xp\016\273N\331\272F.\332\357\221\337#l\307\266\r\204\302"
+	.ascii	"\\\232\230\277FsR=\330\306\376\367_{\351\354\356 Hm;\311\226"
+	.ascii	"VFb\246\372\2318\310\013\376\253\035\334\342\353\336\342\206"
+	.ascii	"\210\315R\267L"
+	.string	"K\360\f\255\354\302\\>\241\272mg3\312\246lJ\361<\241\332^B\240\243L\272\331\262=Uh\337n\233\233\311\366\244\321l\241\316f\013U>5\023\252\354n\237O\315\351R\311\315(\333\263\031\205>\241\232\331\312\216.\227\260L\350\263\231\007}>5\243\313g\223\311\366\204\322\342F%\315\007\033\031;|\247\311\354\037gjK\347\323^\263\2056_7O\313\332\271\240[\r\352\344[\032a;\262\275\037dj\226Pn\317\310\332\240\315\334kj\201vk!\203\321g\022\224\355^C\341=%\023\2656+\353.p\326\255\344\336\353new'9\325\332n$O\315\267\263\263n4\251\263VS\336\225u\337\351\037\273g3\332\006\305\2723\023}\353\035\255\222\337\232\217\315\311F\225rmv\210}{\n1T\204\003\227\022\301\345\231\273D~\207\004\251\270\331I\257*D\252\204r\r\031?\366\034\307\216\256\362"
+	.string	"Y\363C\235\207a\005\002E\327\211\253$\361\305q\230L\220\024fi\2611\276\302dp \036\3038\314 &\2217N8%\277\210I\"S\222x\002\30009\344\252z1\f\021\340_\305#\321H|\301^\302\004\b\023(\330H:\005\013\021,DXO\301\002\026\226\205\tX\354'`\005\223\207a\325\200(\034\n\233\214/\21224 \2055\210\\/\2063\330d\321\330\225,\032\213\3521I\342\3138\326\001lH4q\fC\032\211H(\260!\361\250&\221B\016Y]\034\262\272\224\326\244\220B\322X\034KB\"\211G0\260a\322WV18&\344B\216y\0058\f+\344\230\327\324\303\304\210\307\253dX\330\361*"
+	.string	"RX\024;A\374*\326 \202\005pA\344\"\212\335@!\354\"q\""
+	.ascii	"\361\3138L\"\215E6)\034\321\245\032\213$\214\310\257\265(\206"
+	.ascii	"\f\"\307\274\2022\302\3026\b\221\222\302\tXIc1\351^\021\206^"
+	.ascii	"C-\257\nVR\257P\201C\202\024\"<\260_V\304\030C\027B\344PlF\330"
+	.ascii	"\327\025\362H\254Q<\202]\031\213\303\031W_G\344\225\225\203\263"
+	.ascii	"\224\255\337)\322;\345V\3110\355\345\223J\2163\017\332_;\343"
+	.ascii	"<\200\242\262\007w\251.\025%f\333Q%>\207\326\246W\275\232\306"
+	.ascii	"^\365\301\"\231i\322\344F\371\323\210\321S\016\313\205\362\033"
+	.ascii	"e\311\217\027A\205\256\033\201\270Bc\334~\237\214\221\303e\216"
+	.ascii	"\020\245\035O\330\206"
+	.string	"\\'W\007\323\234\336\237\242G\354\312T\242\344\2661Z\007\003\345\241Q9M\005\001\331q\331~\333\036\200\321\250\221 \207\030DFFF$\020\032I\232\016`\002\221\261\262\332\001\021\200\245\203Hh\244I\nu\3323W;\376\237'44\366l\242\254\303.\022\332\r,p\214\247\205\357\017<\221\022RP\237X\255\034\360\353\337K1\341\2744\315\001E\246\023\305\315+\004\341y\272\346\031Z7\240<S\323\b\\\2342R\351r\323\224&\306\356\342\375\322\f\254\327>`Z\203\224\2246G!\330i\225X\300;\200\n\036\203i<\277\301DdE\202\356#\277\367^DA\232\303\250\031,vM\201\r\276\244\221\227\303\003\035\022\007\215\371?M*\017?\206\365J,\327N6\2461\301Q4}(_\216\006\223r\nL\362MzV\262p`(\001\255HG\317D\274u\322q\213\222\266\255\306\313\332%!\007\346"
+	.ascii	"V\027\221Z\214J0\021~\211\255(\373\325\t\331\277\032\035\357"
+	.ascii	"\023\001\336\204L\336\261>\327\376q5\263\205\202n\216m\3163\322"
+	.ascii	"\306\227(\367\335Bg\347\016\216;\310B\210}I\211\314\300%L\272"
+	.ascii	"U\254\2314@\231f\n\301\225\t\204[\355\267\3663~\222\016]@\354"
+	.ascii	"\017\205T\336\264\310c`9\226.\232B\213V\302\222\341V&\340\207"
+	.ascii	"~\345\311/\227\016Nz\024\036\220\372U\315A\211\310\311\314\330"
+	.ascii	"q\321L\214\314\337\245\"\341\210\017E\023\352\016\342\234\230"
+	.ascii	"\352o8@,,P"
+	.ascii	"\t\246\3503'5*AX;\030\365p$\006\005\2558\205\037\220\355\341"
+	.ascii	"\301j\367\213\032\323\357\223\344VP\222Y=\225Q\023\241C\"_b\006"
+	.ascii	"\275\033q^\003\277\304\242\355\2619\346\303\342\0131\304\355"
+	.ascii	"<\234\372\022\032\233\313a\020\026\305\204\002\352\001W\025"
+	.text
+	.section	.gnu.lto_.symtab.6dfe1ecce578d33b,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6dfe1ecce578d33b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6992 @@
+	.file	"display.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/drivers/display.h"
+	.file 6 "./src/main/drivers/display.c"
+	.file 7 "./src/main/target/SITL/target.h"
+	.file 8 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	display.c.f341bc37
+	.weak	display.c.f341bc37
+display.c.f341bc37:
+	.long	0x4b0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xd
+	.long	.LASF988
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF929
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF930
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF931
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF932
+	.uleb128 0x6
+	.long	.LASF934
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF933
+	.uleb128 0x6
+	.long	.LASF935
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF936
+	.uleb128 0x6
+	.long	.LASF937
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF938
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF939
+	.uleb128 0xf
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF940
+	.uleb128 0xb
+	.long	0x8c
+	.uleb128 0x6
+	.long	.LASF941
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x6
+	.long	.LASF942
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	.LASF943
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF944
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x6
+	.long	.LASF945
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0x10
+	.long	.LASF989
+	.byte	0x7
+	.byte	0xa1
+	.byte	0xa
+	.long	0xbc
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF946
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF947
+	.uleb128 0xc
+	.long	.LASF957
+	.byte	0x18
+	.byte	0x15
+	.long	0x16b
+	.uleb128 0x1
+	.long	.LASF948
+	.byte	0x16
+	.byte	0x27
+	.long	0x200
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF949
+	.byte	0x17
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF950
+	.byte	0x18
+	.byte	0xd
+	.long	0xa4
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF951
+	.byte	0x19
+	.byte	0xd
+	.long	0xa4
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF952
+	.byte	0x1a
+	.byte	0xd
+	.long	0xa4
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF953
+	.byte	0x1b
+	.byte	0xd
+	.long	0xa4
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF954
+	.byte	0x1e
+	.byte	0x9
+	.long	0x205
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF955
+	.byte	0x1f
+	.byte	0xc
+	.long	0x98
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x20
+	.byte	0xc
+	.long	0x98
+	.byte	0x16
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF958
+	.byte	0x58
+	.byte	0x23
+	.long	0x1fb
+	.uleb128 0x1
+	.long	.LASF959
+	.byte	0x24
+	.byte	0xb
+	.long	0x231
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF960
+	.byte	0x25
+	.byte	0xb
+	.long	0x231
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF961
+	.byte	0x26
+	.byte	0xb
+	.long	0x231
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF962
+	.byte	0x27
+	.byte	0xb
+	.long	0x231
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF963
+	.byte	0x28
+	.byte	0xb
+	.long	0x24a
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF964
+	.byte	0x29
+	.byte	0xb
+	.long	0x26d
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF965
+	.byte	0x2a
+	.byte	0xb
+	.long	0x290
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF966
+	.byte	0x2b
+	.byte	0xb
+	.long	0x2a4
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0x2c
+	.byte	0xb
+	.long	0x231
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0x2d
+	.byte	0xc
+	.long	0x2b4
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0x2e
+	.byte	0x10
+	.long	0x2c8
+	.byte	0x50
+	.byte	0
+	.uleb128 0xb
+	.long	0x16b
+	.uleb128 0x4
+	.long	0x1fb
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF970
+	.uleb128 0x6
+	.long	.LASF971
+	.byte	0x5
+	.byte	0x21
+	.byte	0x3
+	.long	0xf3
+	.uleb128 0xb
+	.long	0x20c
+	.uleb128 0x9
+	.long	0x70
+	.long	0x22c
+	.uleb128 0x3
+	.long	0x22c
+	.byte	0
+	.uleb128 0x4
+	.long	0x20c
+	.uleb128 0x4
+	.long	0x21d
+	.uleb128 0x9
+	.long	0x70
+	.long	0x245
+	.uleb128 0x3
+	.long	0x245
+	.byte	0
+	.uleb128 0x4
+	.long	0x218
+	.uleb128 0x4
+	.long	0x236
+	.uleb128 0x9
+	.long	0x70
+	.long	0x26d
+	.uleb128 0x3
+	.long	0x22c
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x4
+	.long	0x24f
+	.uleb128 0x9
+	.long	0x70
+	.long	0x290
+	.uleb128 0x3
+	.long	0x22c
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.uleb128 0x4
+	.long	0x272
+	.uleb128 0x9
+	.long	0x205
+	.long	0x2a4
+	.uleb128 0x3
+	.long	0x245
+	.byte	0
+	.uleb128 0x4
+	.long	0x295
+	.uleb128 0x11
+	.long	0x2b4
+	.uleb128 0x3
+	.long	0x22c
+	.byte	0
+	.uleb128 0x4
+	.long	0x2a9
+	.uleb128 0x9
+	.long	0xbc
+	.long	0x2c8
+	.uleb128 0x3
+	.long	0x245
+	.byte	0
+	.uleb128 0x4
+	.long	0x2b9
+	.uleb128 0x6
+	.long	.LASF972
+	.byte	0x5
+	.byte	0x2f
+	.byte	0x3
+	.long	0x16b
+	.uleb128 0xb
+	.long	0x2cd
+	.uleb128 0x12
+	.long	.LASF990
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0xc8
+	.long	0x2f5
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF974
+	.byte	0x6e
+	.long	0x316
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x6e
+	.byte	0x21
+	.long	0x22c
+	.uleb128 0x2
+	.long	.LASF948
+	.byte	0x6e
+	.byte	0x46
+	.long	0x316
+	.byte	0
+	.uleb128 0x4
+	.long	0x2d9
+	.uleb128 0xa
+	.long	.LASF977
+	.byte	0x69
+	.byte	0xa
+	.long	0xb0
+	.long	0x336
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x69
+	.byte	0x32
+	.long	0x245
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF975
+	.byte	0x64
+	.long	0x34c
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x64
+	.byte	0x23
+	.long	0x22c
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF976
+	.byte	0x5f
+	.long	0x362
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x5f
+	.byte	0x26
+	.long	0x22c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF978
+	.byte	0x5a
+	.byte	0x5
+	.long	0x205
+	.long	0x37d
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x5a
+	.byte	0x36
+	.long	0x245
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF979
+	.byte	0x53
+	.byte	0x5
+	.long	0x70
+	.long	0x3b3
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x53
+	.byte	0x25
+	.long	0x22c
+	.uleb128 0x8
+	.string	"x"
+	.byte	0x53
+	.byte	0x37
+	.long	0xa4
+	.uleb128 0x8
+	.string	"y"
+	.byte	0x53
+	.byte	0x42
+	.long	0xa4
+	.uleb128 0x8
+	.string	"c"
+	.byte	0x53
+	.byte	0x4d
+	.long	0xa4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF980
+	.byte	0x4c
+	.byte	0x5
+	.long	0x70
+	.long	0x3e9
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x4c
+	.byte	0x21
+	.long	0x22c
+	.uleb128 0x8
+	.string	"x"
+	.byte	0x4c
+	.byte	0x33
+	.long	0xa4
+	.uleb128 0x8
+	.string	"y"
+	.byte	0x4c
+	.byte	0x3e
+	.long	0xa4
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x4c
+	.byte	0x4d
+	.long	0xd4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF981
+	.byte	0x46
+	.long	0x411
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x46
+	.byte	0x22
+	.long	0x22c
+	.uleb128 0x8
+	.string	"x"
+	.byte	0x46
+	.byte	0x34
+	.long	0xa4
+	.uleb128 0x8
+	.string	"y"
+	.byte	0x46
+	.byte	0x3f
+	.long	0xa4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF982
+	.byte	0x40
+	.byte	0x5
+	.long	0x205
+	.long	0x42c
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x40
+	.byte	0x2b
+	.long	0x245
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF983
+	.byte	0x3a
+	.long	0x442
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x3a
+	.byte	0x27
+	.long	0x22c
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF984
+	.byte	0x34
+	.long	0x458
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x34
+	.byte	0x24
+	.long	0x22c
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF985
+	.byte	0x2d
+	.long	0x46e
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x2d
+	.byte	0x21
+	.long	0x22c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF986
+	.byte	0x28
+	.byte	0x5
+	.long	0x70
+	.long	0x489
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x28
+	.byte	0x2c
+	.long	0x245
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF987
+	.byte	0x23
+	.long	0x49f
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x23
+	.byte	0x27
+	.long	0x22c
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF991
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0x1c
+	.byte	0x28
+	.long	0x22c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.file 12 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 27 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 28 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.file 29 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 30 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF992
+	.long	.LASF993
+	.long	.LASF994
+	.long	.LASF995
+	.long	.LASF996
+	.long	.LASF997
+	.long	.LASF998
+	.long	.LASF999
+	.long	.LASF1000
+	.long	.LASF1001
+	.long	.LASF1002
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x20
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1003
+	.byte	0x7
+	.long	.LASF1004
+	.byte	0x7
+	.long	.LASF1005
+	.byte	0x7
+	.long	.LASF1006
+	.byte	0xb
+	.long	.LASF1007
+	.byte	0x2
+	.long	.LASF1008
+	.byte	0x2
+	.long	.LASF1009
+	.byte	0x3
+	.long	.LASF1010
+	.byte	0xa
+	.long	.LASF1011
+	.byte	0xa
+	.long	.LASF1012
+	.byte	0xb
+	.long	.LASF1013
+	.byte	0xb
+	.long	.LASF1013
+	.byte	0xa
+	.long	.LASF1014
+	.byte	0x7
+	.long	.LASF1015
+	.byte	0xa
+	.long	.LASF1016
+	.byte	0xa
+	.long	.LASF1017
+	.byte	0x7
+	.long	.LASF1018
+	.byte	0x7
+	.long	.LASF1019
+	.byte	0x9
+	.long	.LASF1020
+	.byte	0x7
+	.long	.LASF1021
+	.byte	0x8
+	.long	.LASF1022
+	.byte	0x8
+	.long	.LASF1023
+	.byte	0x7
+	.long	.LASF1024
+	.byte	0x7
+	.long	.LASF1025
+	.byte	0x7
+	.long	.LASF1026
+	.byte	0x6
+	.long	.LASF1027
+	.byte	0x6
+	.long	.LASF1028
+	.byte	0xa
+	.long	.LASF1029
+	.byte	0x5
+	.long	.LASF1030
+	.byte	0x4
+	.long	.LASF1031
+	.byte	0x4
+	.long	.LASF1032
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF941:
+	.string	"int8_t"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF945:
+	.string	"size_t"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF957:
+	.string	"displayPort_s"
+.LASF971:
+	.string	"displayPort_t"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF951:
+	.string	"cols"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF973:
+	.string	"instance"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF909:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF820:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF918:
+	.string	"PP_IIF_1(t,f) t"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF922:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF983:
+	.string	"displayReleaseAll"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF975:
+	.string	"displayResync"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF939:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF964:
+	.string	"writeString"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF974:
+	.string	"displayInit"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF991:
+	.string	"displayClearScreen"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF933:
+	.string	"signed char"
+.LASF942:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF903:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF821:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF929:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF967:
+	.string	"heartbeat"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF970:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF981:
+	.string	"displaySetXY"
+.LASF908:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF956:
+	.string	"grabCount"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF937:
+	.string	"__uint16_t"
+.LASF912:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF959:
+	.string	"grab"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF950:
+	.string	"rows"
+.LASF927:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF915:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF396:
+	.string	"bool _Bool"
+.LASF911:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF935:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF923:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF934:
+	.string	"__int8_t"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF907:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF795:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF902:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF989:
+	.string	"SystemCoreClock"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF917:
+	.string	"PP_IIF_0(t,f) f"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF928:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF799:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF976:
+	.string	"displayHeartbeat"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF822:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF938:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF916:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF946:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF468:
+	.string	"__PMT"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF954:
+	.string	"cleared"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF910:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF966:
+	.string	"isTransferInProgress"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF955:
+	.string	"cursorRow"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF931:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF963:
+	.string	"screenSize"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF921:
+	.string	"BIT(x) (1 << (x))"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF960:
+	.string	"release"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF793:
+	.string	"ACC "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF961:
+	.string	"clearScreen"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF979:
+	.string	"displayWriteChar"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF986:
+	.string	"displayScreenSize"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF797:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF984:
+	.string	"displayRelease"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF777:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF940:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF930:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF748:
+	.string	"BLACKBOX "
+.LASF905:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF988:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF904:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF949:
+	.string	"device"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF846:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF389:
+	.string	"SITL 1"
+.LASF925:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF965:
+	.string	"writeChar"
+.LASF943:
+	.string	"uint16_t"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF985:
+	.string	"displayGrab"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF847:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF756:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF737:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF926:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF982:
+	.string	"displayIsGrabbed"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF738:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF776:
+	.string	"GPS "
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF819:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF906:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF936:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF952:
+	.string	"posX"
+.LASF953:
+	.string	"posY"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF962:
+	.string	"drawScreen"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF977:
+	.string	"displayTxBytesFree"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF920:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF734:
+	.string	"USE_CLI "
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF990:
+	.string	"strlen"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF913:
+	.string	"EXPAND_I(x) x"
+.LASF958:
+	.string	"displayPortVTable_s"
+.LASF972:
+	.string	"displayPortVTable_t"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF924:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF978:
+	.string	"displayIsTransferInProgress"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF987:
+	.string	"displayDrawScreen"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF944:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF980:
+	.string	"displayWrite"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF947:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF969:
+	.string	"txBytesFree"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF914:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF948:
+	.string	"vTable"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF968:
+	.string	"resync"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF932:
+	.string	"long unsigned int"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF919:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1000:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1022:
+	.string	"stubs-64.h"
+.LASF1025:
+	.string	"wchar.h"
+.LASF1001:
+	.string	"/usr/include"
+.LASF1004:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/drivers/display.c"
+.LASF1014:
+	.string	"libc-header-start.h"
+.LASF1007:
+	.string	"display.h"
+.LASF1028:
+	.string	"strings.h"
+.LASF1031:
+	.string	"common_fc_post.h"
+.LASF995:
+	.string	"src/main/target"
+.LASF1010:
+	.string	"string.h"
+.LASF1015:
+	.string	"features.h"
+.LASF1008:
+	.string	"display.c"
+.LASF1029:
+	.string	"platform.h"
+.LASF1005:
+	.string	"stdint-uintn.h"
+.LASF1003:
+	.string	"types.h"
+.LASF1002:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF999:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1024:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF993:
+	.string	"src/main/drivers"
+.LASF1032:
+	.string	"utils.h"
+.LASF1026:
+	.string	"locale_t.h"
+.LASF998:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1006:
+	.string	"stddef.h"
+.LASF1021:
+	.string	"stubs.h"
+.LASF997:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1023:
+	.string	"typesizes.h"
+.LASF1016:
+	.string	"features-time64.h"
+.LASF1019:
+	.string	"cdefs.h"
+.LASF1009:
+	.string	"target.h"
+.LASF1018:
+	.string	"timesize.h"
+.LASF1030:
+	.string	"common_fc_pre.h"
+.LASF1020:
+	.string	"long-double.h"
+.LASF994:
+	.string	"src/main/target/SITL"
+.LASF996:
+	.string	"src/main"
+.LASF1012:
+	.string	"stdbool.h"
+.LASF1017:
+	.string	"wordsize.h"
+.LASF1027:
+	.string	"__locale_t.h"
+.LASF992:
+	.string	"src/main/common"
+.LASF1011:
+	.string	"stdc-predef.h"
+.LASF1013:
+	.string	"stdint.h"
+	.text
+	.section	.gnu.lto_.profile.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.string	"\005"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.text
+	.section	.gnu.lto_.icf.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\245\006"
+	.string	"\004\n%\001"
+	.string	"\020"
+	.string	"\337\360\372\231\b\b\002"
+	.string	"\002\001\002\002\002\003\002\004\002\001\002\005\002\001\001\312\337\356\336\007\004\252\343\367\225\006\002\007\002\003\003\254\224\272\335\r\f\005\004\371\333\346\303\005\005\255\335\207\247\016\006\005\002\001\006\320\321\356\270\017\002\002\005\002\006\007\340\337\203\343\005\004\002\b\002\001\b\231\337\216\304\r\b\t\002\003\t\256\332\234\316\n\002\003\n\301\343\227\272\003\006\002\013\002\003\013\366\332\246\320\b\f\212\251\337\324\017\001\002\f\002\003\r\360\227\267\314\r\006\002\r\002\003\016\246\345\220\276\007\n\017\240\342\234\212\n"
+	.string	"\025"
+	.string	"\"\013P\260\f\200K\300|P\253\215i"
+	.string	"\353ef=:\315\017nA\346\233vk"
+	.ascii	"\2750\330\025\346\001a\310\n\001AU\222y\311:\213+\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\235\003"
+	.string	"\342\005\017\024\240'\351\340\377\377\377\237UD\277\375~\373IkmK\231R\256\372\203C\020\220\356\267\002\244\223\254z\212\036\311\317\020q\3123V\020\263\323\bz\255s\370\213\202\\T\323\277[pC\026"
+	.string	"\370\300\333\002\020\002}84K>->\206j\340\260R\030\211J\034X\270\202\220"
+	.string	"\023nA\031h\300=\026\302\\\210\263\21240D8\311\301\274\270"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\312\003U\013"
+	.string	"\346P3.`k\222\016@\304`_/|\b\222\022\020$\300!\355\236\252\212\255\201\277\332\013V\024\300\002\004\001P\254x|\177\374\377o\277\021\262\345N\001!"
+	.string	")"
+	.string	"("
+	.string	"/\361\323\366\261\215\331\330_Q\253y@\2333s\321g\330\266J\375}\264m\3230\243m\344)+\212\006Q\301\030 \210\013\257m:\b\017\307\"\032r\274t\267n\243\255d\365\304\210\266\217C`E[\313\027\260&\027m!\223P\177\021\337\246\265\343\262\222\356\323>\254\251.S\031P\303\303\301\260\t\316\250\206\266\016\277*4\210\366\326\271\255"
+	.string	"\2420a\"O\204Xo\013\315&"
+	.string	"\222\b'\220hFS-q\235\3324\327i[\3711f\243\376\201Hr4\236D[\201\243\003B\250\321`\304L\005DSP\222L\007\300\002!\t\250\312\003\022"
+	.string	"\343Q\020\206\005\312\030(\232\370\337\3010\225\016\301\335GG\016\237=\217L\375\034\337wt%\326\340\371=\362\372\261I\330\377\236\373\3750\317\205\320\243E\037\223\311\273r/\266Q\335\017\232\267\356\312Y(8\311>\005"
+	.ascii	"\2148!%\345\337=\f\234\001\257\361SE\273\3119\237\316\212\262"
+	.ascii	":x|D\026\343\257\335O8\316\275\325\332\355\223\233Vk\206\376"
+	.ascii	"Q`\345\3414Z\266\205\343a\316\371\240MF \252\316k\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\013\001\345\004"
+	.string	"b\306\023\035\240'\351\377\377\017\300\252\252\242HUU\201\363\277\345\373[\364\333\377\377\366\344\357-\223\f\233\241\230\t\344y0\\ \fN\027\301\351\313\307\250E\004y\343\277\216\204M\330\331\305O\001c\006\324\310p\372O\267\262\224]\312{-\316\322\017\331K\037"
+	.string	"\001\213\330f\227Faa \005\256\303\333\205\021\355\272\033\202)-\002\025"
+	.string	"yh"
+	.string	"\360\226A\030\257\020"
+	.string	"\344\300h\200y\344V\r\347\320\254q\325%@\036\200\031t\203\272\261\022\022\003\311\242"
+	.ascii	"\013\310\003\027C\317O\n\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\326\001-\007"
+	.string	"2\310\031!pk\322\001`9\326'\367q\037\367\377\257."
+	.string	"\200\004\007\"\375\357G\361+\273\257\277o\253\211\224)C$\223\b\363Q\324[\224&9\237G\301\341\374$4\0063\004\216\264\240}\307\351\214\223e\005X\261!\003\230f\254tM\305S\036\365\216\224\031)\233\221J\264C\345\363P\216\350\325\325s\276\312\241v\303\315\367\0226 \260\"\0313v\225R\200!I\340\236L\"Q\356T\372\302\235X\313\316\035\230\006\201\217B\360930\3376\021\326B~\t\333 \024\265Q6\333\332\256\341,\311\267\202\2353\334\t\246\205\f\312@\242\005h\244\201D"
+	.ascii	"\r\026\300\267\333g\315~\204\371\211`%\226=\200\330\366\306&"
+	.ascii	"8\t\037\342\374\036L\370\031\340\223u\301\006\220\025\2122\260"
+	.ascii	"\007y9H\355t\232~.\214\201\""
+	.text
+	.section	.gnu.lto_.lto.6e5129071bd7da38,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\275\013"
+	.string	"\366\025QC\020mj:\260\344\246\237\245\347\007)\210J\001\314\3374\034\300z\227C\021@<\254M\370\330\276\312tjx\264\027l\277\2127XN"
+	.string	""
+	.string	"\023R$\210\307\023\341\003(\200\007\314\\\024\021\021A\2326\331;\245;"
+	.string	";"
+	.string	"?"
+	.string	"\030\273(\022\"v\313\020\203p\257.\237\261\275r\247l\257&\355\023\034\023.T%V\212\335\355h\352\344'\351\277\303#\246\223\350\323\202\300\356z\232N\025nz\333\037\266\013\330?\020tbb5\2323?\345\222\301v\252\260K\321\244\030\354k\273\273\246(\373\253_\243\323sN\2373PjQP\354R\230\255XW\035\261\301\366%v$%\340\323\276\352\034\310\257B\017\035\257X\206\225\301\376\315f\203om&\257\215W,B\211\310\324\250'\265\344\002\211\212l\207g1\340vI\027\037\004\204\021\264\275N\252a7\370\007\020\267\273\027\337\303\307\001\247\341\325\017m\257\017\036`\361\020"
+	.string	"\b`IP\241|\036\007\343\0319 g\257\362"
+	.string	"\243\2403\202\231n\024\277\017(f:\016\210Y\320y\342\330U<\034v>\261\363\204\241\330I\312\275\266\024\345j\3015\242\022L^\263\331\337Ch\002\022"
+	.ascii	"t\263\240Lh\331\013\f\027\004\250\351$\346rS\213\274\330\270"
+	.ascii	"\0139\274\032\026\r\326\201m*\235e\314\004\027.\003~\253)\341"
+	.ascii	"\016/\332I\006"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\005\n"
+	.string	"\246\323G> \3458\035"
+	.string	",\004X\326aT$\201\231\211\220\246\334\013\220\321\371\001@\200\261\004r?\321\353\217\"\340_\375\203|\332\273\007$"
+	.string	"\020%\324\216(\007\253\211\001h8\252\033D\2366\331;\2453"
+	.string	"3"
+	.string	"7"
+	.string	"\rf\340^]\276\263\275r\347l\257&m\001\t\036\0040\037\261\001\273\353\321\223\223\237\244\177\226w-\227\352s@bw=[\256\220\233\336\366\202\355\t\3733.U\223\232\330\327vwM_\366a\277F\247\347\234\376\326\325\034"
+	.string	"\330\005\231\025XY\235I\261\375\215\335\211@|\332W\371\nyX\352\006\273\257\030\231\3352\335\324\250'\365\246\204EU\266\303\3070\270]\026\310\177\341\030Q\333\353\244\bv\306]P\334\356\202\374\226\223\006\207\362\352\247\266\327\323\202"
+	.string	"\260\325\234\2713B\263\223\200\003\216\370|\024\016\017\237\n\017g\364\221B\246\221\004r\376<\033!\213\322\b\212\274Q\034\235@Q\344\221\300\320\205\367\211\243\347QpX\032\211\236)\fEoS\356\265\245/W\022\331\212v8\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263p\231\340\300e\300o5%\334"
+	.ascii	"\341E;\311"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"E\n"
+	.string	"&\324H=\020\0059\035"
+	.string	"\036"
+	.string	""
+	.string	"\200*|\257#\237\234\367k\024\347\252\365W\004\240\031\370\033\374\257\337c\340\247\374\304\276\253\247\017"
+	.string	""
+	.string	"VP\241y\372\021w\024(\034b\313v@d\324\310\336)\0055"
+	.string	"5"
+	.string	"8"
+	.string	"\266\217\362\024\323\236\031ml$5\0344\234\335\005A\377t\347\266{\272sU\344\346\251\351\177\345\0064\032X\254u\332\201\330]SX\314\343\256\267}`{d_ \2562{\243\356~\376[\245\246\224\372\235\357\344\003\263\333Q\003\2607\234\214\211m\323\376l/"
+	.string	"\303\251\375\331U\314\237\254\007\354\312lbv\317\004#x\347|z\016\264v\365\341\343U[\266'\376rr\311\0301\272s\264\026\330\025o)\275\335W\203\317\262\262\360J\316\371\254\356\334\353\300\310\314Ek\376@\226\346\330g\213\326\020\373\333\356nv\020\205\021\n\013\"\211\220\307\024\242H\252\022%z\016C\027$\212T)\226\300\2224\255D\262\004\242D\322\t\f\311\022\f\021xL\231HP5\216$\370\235{\273\253 W\325\360G\267\352\r"
+	.ascii	"t\263\240\314\2000L\204\t\031d\007\366\256t\326@\023\306\270"
+	.ascii	"f\177`\202\200\023=\252\225\2160\311"
+	.text
+	.section	.gnu.lto_displayGrab.6.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`W\001%\r"
+	.string	"\246\330WB \221\222\016\260\216\201\314'Z@\021.F\0167\330\336\020L\315\206]k\"Dl,\n\3507\334B\271j!\263\314<\302F$\006\002\b\324\302\032\013#e\326\202"
+	.string	"\213\275\241\370"
+	.string	"\261M\366&R\246\024B"
+	.string	"?"
+	.string	"G"
+	.string	"\366M\374Dw\021\312\007\354\206^`vG F\020\377<\272\006\376\305\177\300?w\266\214\002\033\002\274\370\270\324\330]KG\274{v\376[\016"
+	.string	"\304\342yR\rv\327\tb\361p\353m\037\260\355\300>)\327\216\030\242\224,Y\323\"\263i\303\036yRC\330\237vw\255!\373\242\237cJ\307\227\246^\032N\351\247\351)\323\252\351\314\364;\004\210\320\320\330\355P\272\261\244\027S\302\366+;\312,x\006J\3519|P\311\222\237B\005\371\314\\g\201=\365\210\231\"\374\005\2036\255\320\303T\311\241Nu\005bE=\266'\334\205$\356\256\210\370*4h'\360/\225\200]\341)N\342\356\212\370($p\221\304\237\217\002\377\002f\020r=H\240 \004\302\346\003\273:\034\023\256\223E_\233\f\034\n%\\6bq\033v!\333F\254N\306!\261\256\215\2636\006\254\225`\233e\242i\233U\215\366\323j\310\317\005)EU\034\265\005\346\001\343\240\031\224F\375g\346\026 \f\033"
+	.string	"t\263\240L\350\020\032\030\017\204D\300|\333\270\217\034I\230Y1\215\001\214"
+	.ascii	"? \037\330\f\266\323BiD\021\002\334\201!1\240\246\031n\006{W"
+	.ascii	":\013\243\t\216\270\f\363\255F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_displayRelease.7.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\f"
+	.string	"\226\027TA\020\221\232\016\340\023\\oL"
+	.string	"\rPh@W:-\031\200r1\340\254"
+	.string	"\364\033"
+	.string	"'\374#k\372#\274\212Z\337~\220\360\206\260\252\252z\245k6Su\265\201\n\245e,\257N\275\355w7)S\n@"
+	.string	"<"
+	.string	"B"
+	.string	"\027\261=tr\002\273\240\226\024\273\234\207\021\304?s\347\200\177\361\031\370\347\315\216Q"
+	.string	"\203"
+	.string	"\030\036\226\032\273;\251\207o\317\315\377\210\007\370\254p\236"
+	.string	"\032\354\256\363\263\242\341\326\333>`\333\201\375N\327\001/B\235\354\314\261\242\305\246\r\233\343\244v\260\037\355\356ZA\366C\177\214\322\360\245\337KGQZ5\235\231\276\204Q\351\220\261\233\241\273\261.O\005\b\333\227\354\330\262\340i?D/\335)\300H\237^e\003JvV\215\324\303\363R\375\204\210*\346,\244\214\352TK\034R\224c;\302YF\342n\n\210o\342\002f\002\377R;\354\t/a\022w\027\304'qi\361\303\237\177\002\377\002f\360A=H\240\340\003\202&SQ\327\246D\273\254hJca#\201D\263B&-\253*XY\310tY\233\221\211\312\264Ic\300\030I\225M%\030\226M\022\267\217VA~3\\:\212b\250(D0.\376\241\361\024\352=\001\024"
+	.string	"t\263\240L\350\345\013\214\007J\"`\223m\214D\016\2031\343\253\326"
+	.ascii	"#`\360\003\006k\206\353\3006\225\316\302g\202\003.\303|\253\321"
+	.ascii	"\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\365\n"
+	.string	"\266\324LC \251*\035x\313\2460\232lRs!\224\2061}\326\263\220$@\024\237\013k\210\035\354\343<\213\360P4\301\0329\300\016\302\031\002\221"
+	.string	"\211\004\260b\353"
+	.string	"3A\002\215\363HU\024HUI#\233\354\235R6"
+	.string	"8"
+	.string	";"
+	.string	"\rvK\216-\272W\227\337p\257\3355\334\253I{\202\304I\003\r%Vaw=\032\340\344'\351\377\300/-\227\352\323\262\261\273\236-\227\312Mo\273\3026\207}N\336X\200\260\363\202]\252&\005`\177\333\3355}\331\207\375\033\235\236s\372\026\207\b\021\017vSj\030VV\035\f\260}\214\335\021\310\370\264_\340\006\310\303R\177\330}1\b\006\277`\224\231M\314(\234v\231\033\365\244\306\254\260\250\312v\370XH\267\313\372\370\nJF\024\367:)\204-\362\004\250nw?>\202\323H'\340\325Oq\257\247\031\t\260\325\254\005\326\360|\035\027\030\036\217\216F\364\221@\246\221\004v\376:$\240\217\322\b\206\274Q\024\235@1\344\221@\020\210\367\211\243\327\241pX\022\211\236)\fE\017S\356\267\245/\327\f\262\0255\261?\342\034\017"
+	.ascii	"t\263\240Lh\303\013\f\017\341\213\335\274\220\016\254i\206\226"
+	.ascii	"\001\334\225\342\302e\254\003\227\001\277\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\225\f"
+	.string	"F\330XC\020\221\223\016s&\220\366\330\0304\032\361{\220\263?\225\022\204p\024,Z+\276\256\205;\247\361\320h\317Z\246W#\344\310(\336l\344\021"
+	.string	""
+	.string	"\n\024\245\006?\210\026\307\255\314\351I\2419\221\270\367\2262\245H"
+	.string	"A"
+	.string	"E"
+	.string	"\034Rhr\354v\230\222x\351\360i\226\374\317\374\331\264\314P\341N\016?\374=\002!l< \270y\271qq\033R\037\307\245\205\n"
+	.string	"wz\035\225\f\210\317<W8\224\314\217\007\273\353T\341:\334\361\266#\330\206`\037$O\375\372\322\251\351\307\330r3\300\305.\313\212\307\322\2000L\330&\331\227m\211\020\311\264\217\342)HO\231<\300.*F\315n\007\342\216u\350\356\002\342\241uN<\264\355\005\"$\227\336\225`\371K=L\271\212Pa^\fM\r\216\247\250-^\206m\341+6k\367\324\300W\221\341\202\025sx=P#e\312\325S%\343\362Bm\022U\177\202\205\215S\352\3605bs\207\335\235\244\302\330\177\273\273V\224\3554\fv\020\222IP\300 d\202\207\003\312D\237\222M\024\262\234y4|(\220l\241\021l\323@\030B\332\b&\n}*`\231\266a\236\002\036\221\2004\254d4\322\260\253\333\277U\224\363%xj\347\251+\266\241\0320)\212S\241>%\021"
+	.ascii	"tS\320\301\320;1\274\032\027\001\327\200\034\260{\b[Pc\tX!\265"
+	.ascii	"{\n\226\221k\240rY\034$\\zU\305\254`\356\001"
+	.text
+	.section	.gnu.lto_displaySetXY.10.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\325\n"
+	.string	"F\024KB\020\347*\035\007\327\206\203[)\201\227\tpJ\234\003\034\245\342S\371h4\336\223\020h\205\223\253\330\032\306z\361\030B\201\310QD\221D"
+	.string	"\210l\002\2028\201\370\362\004*T\222\037\323\260\311\347F{\247\0243"
+	.string	":"
+	.string	"5"
+	.string	"\206\350^M~\201{\355\356\341^=\332\nN\272\354i'\256\032\203\335\365h\313\307\317\321?\355\b/\030\353\223\203\261\273\236/X\312Mo\373\3016\207\375\213\227\375\223\303\321\030h(wQJ\007{\253\005bl\277cw\256Y\271\361 D\247=\021\032O\252LwW\022ht\257\234\005\241O\373"
+	.string	"\036`\274lu\205\335\330"
+	.string	"\002\273dD\225\332\342\005\314Pj\207\334\246\352v\267\302\257\225\214$ \200y\365W\334+\303\213Jk\226\2366\231\003;\033\330$kR\026\373\233\335]\323\230\375\331_O\3764\251\223\334\026\240\257C\202\002\344\361\361\220\276\222\b%\226\300\316\337'%\3728\211\340\310\023C\222\b\030\216\274\022(\002\361\276P\364>\0166\235H\241\2072\231B\257C\3567Kc\316\250\271\265\250\211\003\021"
+	.ascii	"t\263\240L\350\t\007\206\013\252)\277\200\tS\217\3356v\214k\354"
+	.ascii	":\214\007\212\200q`\030\240\202\005\241f\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_displayWrite.11.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\262\0015\020"
+	.string	"F\237mG\340\262(\035\203\002\030\226z\354\2068\371\201  .\"\351\311\021\n\261 \030\224\005\3638L\243\260\r\213\355\234B\360C\033\366y\333\013\002\307P$@h,\256\2230\270p#\305R,%\215\336\267F\b\331D\312\224\002V"
+	.string	"T"
+	.string	"]"
+	.string	"3:\032x\217\035N\352i\337\3467\340\303\226\203\354\322\270\220\261\033\"\360\001\357\321\241g\333W\361\025\240=c\013M\304|\204\314L\247\307\356~\247\007\340\036\267\233\270G-q\360\t\372\337\371\226\002\304\016-F\366\354\030\354\256\223\026\363\341\326\3336`\033\202\235\"\001\016e\251$\354o\2534\266\246K\317\371I\017\377\321q~\321k\177H\323\235\2469/\035\273\364\306\245\225KgL\037\204\363\2711`\307\256\207\240\037k#\372\240\260\r\332#\273\253\221\332j\033\004\224\026\246E\210\0074r\200\034\360\2444m\221\024x\034\026\353n\013C\342\367\250L\360P\270\307\250\005jll\325c\240x\233\206\324\330\364\220\324^\235'\244F&k7\2526\3530X\274\335%\361_\\\260"
+	.string	" \307\211G\277\205{\314\037\032\017\221\276\303\314K\006\371\232\252:3 \227\f\362(Cjc0\311\323\256\032D\300\250\314Yc\201c\323\207\003\261\257\234\303\275`dE!\201\202\221\n(\023k\345R\245\304\\-\317+\324\212*\303I\254U\362\305`,\225\026\254\344s\265T&\337\n\026\373P\004\374:a\301\276\224\327\013\366\215\302\375\266Jc\333%=\271\350\213M\031RN;\035\251\243\226\3644S\231E\332\351I\312\351\177f@\021\356#\301\333\037"
+	.string	"t\263\240Lh7_x/\203S:*\300J:\021 \026\266x*+\030\006\256\335\024\r\252l"
+	.ascii	"C\030\266\025\3173\230\300\f\3335q\031\331\210_\013\210\013\205"
+	.ascii	"\3010\020\004\224\003\203\201\021\200\n\241B\r\001'\236T+&a\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"&\035gF\360\222(\035\202vS_\037D G\016k\363\024(\004K\351\306\320IB/h\263\3472\327\023\260\326\220\240*\024Q\251_<\253\265\367h\006\212,\031x\351\330<\306\261`\317\203\3775\240j,\221\020\262\211\224)\005O"
+	.string	"P"
+	.string	"V"
+	.ascii	"\241\247}\331]\200\017e\016`\227&g\306n\210\300\007\272G\207"
+	.ascii	"\235m\237\305[\200v\r-<\001;\t\024\256\033!\273\373}\036`{\324"
+	.ascii	"~\262=\252\211\203O\320\377\213k+@\314^\260\325\223k\260\273"
+	.ascii	"\316\027\314\303\255\267m\300v\004;\007\004\2534\266\246=\307"
+	.ascii	"\371In\363{\017\377\221\327\374\234\2467MGMk[Zc:\265\364M6 :"
+	.ascii	"\004\364\330\3550#\2629\242\216\n\333\240\355\331\\\fG\004\204"
+	.ascii	"\0216\252\233l\213\307\353\301\207\220\246\255 \004\276Fe\335"
+	.ascii	"\235\371\341\240{\3448\004EH\327\241\320\355jP\361id(u0Z &\263"
+	.ascii	"+\\\006L\227\212\022\223\341\360\324ny\016J,\004\353\306\325"
+	.ascii	">=\206\252\333]\025\037\006\213\205\022\037)\036}\231\3551w^"
+	.ascii	"AX9\363\257\3328\275\352\315\206\231V\316\23486vl\016\261\303"
+	.ascii	"Uj\t\373Z\243\307\034\303\315 e$!\301\202\224\t\240\023\322\310"
+	.ascii	"$zI\231J\235G\240\030\021\213K\252\264\362\245P\244\013%\324"
+	.ascii	"\312g*\211Z\276\021*\365\201\b\370\344BB}/\247\023\352\363\302"
+	.ascii	"\275\355\321\017K[.IM\243n:\242V\365\350\307\245+s\272y\032\365"
+	.ascii	"$\252\351w\\\001  \320\"\232\343\016tPP\n\330a\260` \036y\347"
+	.ascii	"\210\325\214\nh\211\327\004\371?\024\306\276\317\254\207}\355"
+	.ascii	"&%\313E\344\030\225\304\026k\342\321A\021\273\003S\230!\317\t"
+	.ascii	"L\211\030\001\034BEC:\361\304\255\230\004H\006"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"5\n"
+	.string	"\006TI?0\345(\035"
+	.string	"x\276\017\205>\364\203\205\206q\304e\3416\254\005\031\033\273\232\302u\364\327\252\325\337\357\265\330`4f\243Q6\362\203\201S\204\240.\207\206\362\261\224J\353S \210\335\204\354\235R5"
+	.string	"5"
+	.string	"7"
+	.string	"\005\365\\wN=g\333\017\037\225W/M`\037Y\361\240\021\330-?Z\362\325\347\312\277\3137\025\220"
+	.string	"\257\030\353sC\261\273\236\257\330\307Mo{\301v\205\375.Tf{\272~\366o\333\364\244\323\337\324\002"
+	.string	"\016hva\265\003[\303\315\244\330V\331\236]\007|\346\264\317\362\026\325g\251\023\354\312\004\310\354\226\rf\350\316\271|\225N\204\270(\3136\306i\243\030\016\021U\317M\232`k\034\206\354v]\021\376\313i\243C9\347\247\352\271S\203\223Yk\326\354\211\3544`\227\254II\354o\273\273\016\226\360\200\026\016\020\236\213\016G\004\222@&\222\024v\006;(PF\211\fC\0379\212N\341\030\372H!h\364\201#\371u\020,\226D\343g\022\305\361\363\312\275+Uh\321\016{s\243\2364\013"
+	.ascii	"t\263\240\314\2000,\204\271\031d\007\366\256t\3264\023\006\271"
+	.ascii	"fKw\210h\272\346\023"
+	.text
+	.section	.gnu.lto_displayHeartbeat.14.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"5\n"
+	.string	"\366SIA \3078\035"
+	.string	"\213"
+	.string	"q\305\362Y\331\304\235"
+	.string	"\300w{\024\237\300\"c\200\001\220\314\030\204\037O\364\372\217\271\340\247\372\305\200\tC\017H"
+	.string	"\020I\345\3705\036\267\233\2109+D\206}B\"d\313\224\0023"
+	.string	"4"
+	.string	"7"
+	.string	"\016\3357\227O\340\276u\337p\337L\332\n^\252\354\003\274B`\013v\327\233)'\257\244\377\3273+\026\352\212\241\330]\353\2125r\317\333n\260ma\037\023(\235(\366\265\335]\317\226}\327\257M\265\252\372\034\246\344\300BlWd\326`e[\001\026\333\327\330\234\001\211\253\375\226\273\220w\235\216\260\333\032@`\267|p\332\264NkNT\023e;<l\243\333Uy|\001\037\243\211\373\246S\301\3468"
+	.string	"S\267\273\036\377\245\324\321\255|\363O\334\267\317\203\004\256\224\316\2541\022\004\253\f\3542\236\350|\027\020\021\035\f\316&\364\211>\244Q\004v\3768\036\237\214\321\b\202\274Q\f\225@\021\344\211\300\217\206\367\211\243\307ap8\n\211\036)\fEOS\356\265\235-W\230\310R\023\304\031\r\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263\232\231\340\302e\300o5\005"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_displayResync.15.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"5\n"
+	.string	"\366SIA\020\3478\035"
+	.string	"\327&\300\213\003\361vu"
+	.string	"\017OE4\320v"
+	.string	"a\003MY\032\200\223\026\361\320\2178K\001s\214nA\217\361_\007"
+	.string	""
+	.string	"\311"
+	.string	"A\351\364,\236@\205\r\362`\030\370\215D\310\226)\0053"
+	.string	"4"
+	.string	"7"
+	.string	"\r\3357\227G\340\276u\357p\337L\332\007^\246\354c\002\200\304\022\354\2567QN^I\377.\337\264\\\252\253fbw\255-\227\310=o\233\301v\205}M*\235'\366\265\335]\317\227}\330\257M\265\252\372\234\206\204\200\002\202\335\220\331\202\225m\003Vl\237cse\304\325>\313[\310\303R?\330}\001\020\260[:8\332\264NsLXSe;|L\243\333e\201|\031\217\021\305}\323\231`o\034\006\325\355.\310\1779qt*\337\374\024\367\355\323\300"
+	.string	"l\2453\353\314H\201U\005v\031\226\370|\026\017\020\237\013Og\364\221B\246\221\004v\376<\035!\214\322\b\212\274Q\034\235@Q\344\221\300P\206\367\211\243\347YpX\032\211\236)\fE\217S\356\265\235/S\224\310V\363\303\033\r\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263\232\231\340\302e\300o5\005"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.16.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\315\n"
+	.string	"v\024K@ o\224\016\203h!\204\200h\300Bz\371\340\035\314"
+	.string	"r\366E\017\004@\227\026&\253\277\376\372i\306\302j\314F\314\254Y\005\0010(`\260o\310\364\266m\021\315{\303oj\226L\b\267\2252\2458"
+	.string	"5"
+	.string	"8"
+	.string	"\3669\274C\310\242\214\027 \\\254\023\246\020,v\243\226\361\215\3530O\271\016\325\302EO\221\377\017\227\250$\2408\241FO\254\300\356:O\250\b\267\3366\210m\003\366?\002Nc\217?\204i\225\244S\323\3170\225\212\212\211\335\007-\027\233\002\226\330`;dO\354+C\200L\373\253{\b=\202\256\261\233ZAb7\2128$;t\314\354\t\325\251\252\004&\224td\233\373\210\004\"\032l>\332aw\007\261 \333-\t\360Y\236/\323p\350\203\256\303+\007\206\025)[\236P\330la\307Qj\005\373\222\325\224\035\036p\331\016\214"
+	.string	"\270 \260P4\033\007\343\3718\\\346\315\362\301(\350|\\F\373<\r\003\316\313h\034\016\263\3216\357\323,\025w\035\215\247y\272\316\323&qoL=H\352\300\252\230\336\364\002#\020"
+	.ascii	"t\263\240\314\2000\354\304\\\235\225\275 ;\245+\236\306\342J"
+	.ascii	"gm4a\270&Re\241_0A\300\t#\325\212I\230d"
+	.text
+	.section	.gnu.lto_displayInit.17.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`4\001=\r"
+	.string	"f\330YE"
+	.string	"q\234\016\360\354Cg-\005\246\244Pq\3665\002=\272\004\233\006Q\035\203\340^5\344\0349\237\372\265\006\357,\264\256h|T\275\215\360\377\216L\354Nh\372\002\222Mr\235d\b\004G\306\217\206v\267\275S\nB"
+	.string	"E"
+	.string	"H"
+	.string	"7\t\277\032\271\200]\025J\312\256\250\300\t\260S\213'PO\261o\352\251C\033\307E\022{\226\r\016-\\v7\233#\036^\206\376W\334#Ur\272\304<\330]\313T\311\207{\3366\002\333\022\354\247\b\234\022 H\344\350\001&\373\302\262R\207-\236\344\024a\377\332\335\365T\331\027\377\353\253\177N\351g\034\244\270\344\350\214\273\036\306\035\253Bc\234\260}\215]S )j0\020`Q\254\016\021\260S:\202.\355\253\b\333_p\007Z-(^X\376\256\332\025\216\322qZ-\230\031\0319\247?\255\t\201\232'\333\037?\361\260]T\310wa\262\200\211\324\323\317\0027V\362D\306\3125m\360,D\260\335\r\371,\f\027"
+	.string	"\264L\234\372#\3654\034I\244M0U7\370l\242\005\f>\024<\033n+i!`\251\303\274y2h$\020\260\033e\340\307\231\272o\224\225:\355#\333>0\363t\354\201p_\026\342y_\246\021\367\327N\225!\324P!\231\033\034j\207Ac\305\347\252\035\030"
+	.ascii	"t\263\240Lh\365\013\214\213\003\256yZ\001\306 \006\026\202\232"
+	.ascii	"\006\307\314p\032\2404\344\370\032x \\WU\235\251\202\240\032"
+	.ascii	"\214\251\tn\\\003ja\030P8\b5\020\334\271E;\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`(\001\235\005"
+	.ascii	"\342\007\035&\2209\035\377\377W}\003\377\257\240\210\374Hrw\327"
+	.ascii	"\352H\003\376\201\177\004\337\260)\020\364\324DDD\204\244\275"
+	.ascii	"e\n\305\315\252\250\311(\371\321\"?\033d\311\005\275\306h;\317"
+	.ascii	"\241QC\2473\263\3052\221\013\260-V&\2206\217\007\034\277\032"
+	.ascii	"\0070n-^)N%>!.\035\036e\207\f\177\nw\bo\0067%/\355[\214\005\235"
+	.ascii	"\231\211\375\271\266.\013  \200\203\2520\006C\312-\2548\345\334"
+	.ascii	"\017\302?\006p\f2f3\217\232\325\265\264`w\022\017O^\201\231\242"
+	.ascii	"\207o|\343\033\277\361\r\337\370\306o|\3037\276\341\033\341G"
+	.ascii	"\333\2221"
+	.text
+	.section	.gnu.lto_.refs.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6e5129071bd7da38,"e",@progbits
+	.string	"(\265/\375`\237\030]n"
+	.string	"\372\263\314'P \322\312I\007&G\201\030\306\032\037\3471\257\207\316\236\371\256u\324q\364\r,\004^>\371D'\307n\362F\367\036-v\320\210\355r\313\03703\"0"
+	.ascii	"\"\002\377\377\177\277\231\231A\274\310\317\r\r\200\030\347\275"
+	.ascii	"\177C.\343\327\226|B\244L\001\013\002v\002y\002g+{B.\316'&\214"
+	.ascii	"1\212\232s\334\205\336X\261\201c.\277\"\311\252\262F9\210\036"
+	.ascii	"R\212\021#\215r\232\2408t\334\304\274\375t\341\241\003\323(\237"
+	.ascii	"a7.3\301hN\242"
+	.string	"\331/D\237+}x\312\236M\244\334d\023\351\031\252\215\315\342\321\263\332\2119\2631\253\331\363CT\243\274\326L\206\313\234\327x\314\020\324\312k\350\275O\314\b\370\230\021\370Y\203\362\264%E\237\203\275\035\253\371\324\004\231\222\245\026\246\247F\f\n\237F\225k\225&[y\032=\223U\221\206\226.\275|\341}9\243\255Y\220\034\202\226d\177>[\006\365`\307C^\227\363\362\177\240\305\347\f\335;v\357-\321b\344\262\2145z\273\003q\021.Hxh\364g.?c\3411\376\3414\006I\336\345\275k\321o\t\223\270\253F\225\2761m~\fi\364&\3302\336\302f\327\250\327c\210\234\257F\037\303\016\035\235\327\2130\273-\016d\337\366k\230\225I\244\226E\244A#d\374\335\374\371\347\347\241\005~Ni\370\037\342\357:\377\273\374\\\264\004\006A\224\243\314\317=6\266\377j~\266qLc\376\323\371\031"
+	.ascii	"F^\375g\276\304\377\026>\342o0?\257\370\371\201\367\376\376\""
+	.ascii	"\200\375\233\f\b\013\220\013V~N\341c\"\377\375\375\365\377\316"
+	.ascii	"\317?\032\377\353>\364\267\017B\017\372\333\311\317H?\227\370"
+	.ascii	"\371\350_~\016r\340h\367\375\315\344\347\252\237\211?\353\360"
+	.ascii	"s\r?\003\177\316\361s\f?3\375|\343g\365\347\244\237_\370\331"
+	.ascii	"\205\237Y\370Y\205\237Q\370y\306\317$\374<\302\317\"\374\034"
+	.ascii	"\302\317 \374\374\301\317\022\374'\363\263\210\237]\374,\343"
+	.ascii	"?\234\2379\370\217\346\347\r\376\013\360\263\006?\307\3709\203"
+	.ascii	"\2371\370\371\202"
+	.string	"\237-\370\271\202\237)\370y\202\237a\374\034\301\317#~~\3613\004?\223\370\257\342\277\333\177\242f\263\331\374Q\026\377\t\301\017\200\002\001yB\356|\331r\226\032\301\322\003\304\254\355\f\331\225(er\275*N\320\256V\2563\024\205\207\03302\023\277\325JJ\211\026;\364\b\222\007\220,c>\024\217\312F\225\247\2306[z\260\030\205\210\203\367\226F\214\327\312t-\257p\332O\331\235>aamE\316\325\034\274F\225F@\313(\257\260F\337\242\213\337\304\2560w\270\0340\037\230H\222\374\346;\357\335\302\342\225\204K\f\tv\207U\244\217\204\2211{J{5\225\376j\260\206\322U:\n\227\265\0246{\367\320N\032j\213\327\030\016k\202)Z\230}\365\244\217\274X\"\301\356\244\364\222nR\242h\224\261\025\205)\245\225\360\233\217\270^!0\302\220`\326\311\230\037\204\214@\337k,\033\261\210&<"
+	.ascii	"E)\341z\362\201\231\202\332\323L\230O\210>T\342\336\354\273\214"
+	.ascii	"}\253\3317\232}w\261Df\326\250\305l\033\351,.3j\255\037\307\025"
+	.ascii	"\247\264\032}\177Y\035n\223\215\322w\023\213\202I\244*\336VM"
+	.ascii	"\004\013\236\233-M\244\207p\233>\305'\215\256P?yJ\2740cl\270"
+	.ascii	"\216\031$\330\235\0262>+Q4z\020\366\306\324\342\205\323\320 "
+	.ascii	"\301"
+	.string	"\302\326\330a\2736\244=\234\346\002\355o\251F\366\261\215\355\243\253\232\252\2034\220\376\321B\270\254\247\230\317\031\217\363n\264\336\013u\357\315\322\247{\\d\ti\220`wy\300\340\271\003\302\013I\017\247\371\210E\367*I\363Za\206\345\030\016kU\340\f\022,\354\336\365<\3663\020S\f\206\333\316U\312\275J\262\002X\223\006\246yw\357\312\200\021\003v\207#[_\214\320\277{tT:EG\267\325|G5\217T\r\r\223 \215\366m\"\227\241\350\247w\261\241\016\004\265^%P\233;G\226\215\236`\022)\212\307\236Q\244\277f\263\331d\024)\034\373\2632\211\364m\\\306\236\325\354\371\314\236\263\330\363\024KdW\207\272\335e\311s\347\\\347\223\272r\306G\243\314\244\0163\350Mn\315\032:g\346O\210\321J\243<G(m\211\332T\243,\307\327\345LX\222F\231N\b\313\2203+q~V\370"
+	.string	"i\023\007\016\226!K\236\254? 5>U\2104\312n\370\315y\216\333\\\236c\221\234\373\341\335\373\364cF\200\031\001T\254\313\007/)z\346\262\001K0;\357\273\316C\264\244J\256\321\276\323u\\\266@\333\275\361t\222\377<\255wm'yg[\032\355\237/{^ =\233M^\340'iS0:tx\211\346e\003M^\027\322\246hr\344\360\222\214\331\213\322\246\207\261\321\377\020m\032\027'\016\263\311\211e\325\205E"
+	.ascii	"\207\304\215\215M\363\346\3468N\316\211\327\f2A\244\310\330\336"
+	.ascii	"\227\0337\314\354\322b\342P\344\251\330\305\366\346\324\250i"
+	.ascii	"6\024l\231bB9\362\245\327\274\331\314\201#GH\225F[\216\271\374"
+	.ascii	"\220\240E\2355\332qb\326\036"
+	.string	"\203\b\202\331<\270\367r\2271\253\356.e\222\201B\326\304\332'oo{P$\3134tW\326\232\271\271\361\222\316\313\267\305j\0165Z\333f\306\f/\351\336~Rv\354\304\360\254\235\303\306\306uD\267\b\247\215\031D\206NK\013\216\005\362\261\266\306K\273\032\360%\253.\354G\\\341\322\332,\020\222\243Vk1cx\311X\367\244\033\313\252\273\273XX(\202~\314\361:\231\330\277\377\364>Q\335{\221?\353\245*\016\235\177\230Q\374!\370\344\004\376\243\367\376?[\334\335[%\254\316~\201y\312\372\211{\301%\206A=\035\213\356z\251\214J.\242\361\207\270c\321z\223\bp\225J\256q\345:\242\311\333w\275|\241\270\2163\030\327$\225qM\022\211.T\222x\357z$2.\237\210lTr\035\215\312\344\261\350B]\342U>%\261P\311\243\021M\362HdT>\035\215P\\\307\"*aP\220"
+	.ascii	"\3512{\303I\214PwJJ\353\211\212\b\316\270&\357\233{y\031u\251"
+	.ascii	"\022\270W+I\365\346\351\212\303\024\341\246\212hOI^\357\275\003"
+	.ascii	"H\025\273\222\027\n\316H%y/\225\"\216+\305\202\270\302\335&\f"
+	.ascii	"GT\242u\203D\335K\300]\357\225\272\227\310\027\356\336K\274\367"
+	.ascii	"\366\250\264\326{\215\020\031\275\244\244\356\3052\222\272ZD"
+	.ascii	"\265\250{{\t'\314\321\250\354J\"\251qQz\335\036+\221\275\356"
+	.ascii	"\033.*\253$\226\335 w\254\327\261\312N\007MY\221\242\345l\351"
+	.ascii	"\373\"\262dL\033\333P3\212\227,\215\306\3351N96\312\fB\263\203"
+	.ascii	"\217\274F\327\037\034\271\2549/g(\021\013\231\236^\016=\251B"
+	.ascii	"\253\232cQc\0365\305F\321\342\231*\2555Gq\211Tv\217\240\307\221"
+	.ascii	"\342\206\023Sp(<Rm\350hZrb:\n\nu\034\0050LRo`\022\246MM:\234"
+	.ascii	"\234\200N\275\035\300 \216!\320\251\007\203\222\332\204\252A"
+	.ascii	"\0352\240NjSp(L\217#E\b4d\3148\032\2527\202J\303\0231,\001\233"
+	.ascii	"b\250A`\214\034\352Ph\303\214\337\220\311I\3060\311\005\022\215"
+	.ascii	"\023<(@\005\025XXa\250\016\331P"
+	.string	"k\be\02055ap\202\257\206R\260\003\241\031\032\024})\006"
+	.string	"_b\n\252N\352\r{\026.\034p\361\242\206\336_\300P\001CE\372\0270\220\220`\270@\262w\201t\016\207N:\2001\200hH\325%&\032T\033\251p\0070\210\n\233\200K\350\n,\b\2012\2406\324^\272\003xB\020(\f\352X\002:\016\023\007\312\240\006\217\206@`\360Hh\230\364\300\n\253\252A\016\204\352\320\206\fj\030\n\t\223\324\246\032J4R\250\241\024\274\201\252B%\265I\r\366\202Jj\323\222\320\214\035JA\033A\352\rL3\234T5\270$\f\n*\341XBo81\005\2073\204\206I/\206NL:zA%\0341\324!Sp\007P\023\020\230A\322\217P\250\006o"
+	.string	"\203%8\311\b\2520\b\235\224\2024\204L#\206Jj\215aPI\305\0014\024&\r\203\300\022B\034\202\025K5\220X\254\200!\205\210G\020A\214\023(\214\320\201]Ja\203R\223\fB&\033G\302\240J\003S\320\306\221\023\223R\216\243\245\240\360(E\211%'\033\204j0\305:\253\302\b!\343\322\350i\325'\221\363\352\247\325\327\323\352"
+	.ascii	"\274\237\221/mSR\364"
+	.string	"'\315Q\361\247\217\263xV\235v\354%\256\027+I\254C\301\332\335\035\344\3355b\241\b\221f\344J\362\374\361\263\352\347\324\003-Nd\210\2515.<\215\236BN*.\273\333y|J\205\265\336\245OL\21737#\366:\360\335\322S\352>\25471L g\220\037(\350k\007\245\025\244\275\003\326\314\352x<{\3744jY\213\222\373aO\036?\243\226L\301\305\361\260\377\t\365\003\r\325yb\325C\243O\257\375\217\036\313f\216~\022\317e'\261y\\\260\274OG\024f\250\3460\357.U[\003EP\340\254,\355\217\335\236=\335Lc\211\344\335\271\351\363n\016\215\355!&i\264\363\230Ko\245*\322x[^M\252\340\361\361\235\201\262u\325K{6'wd\314\246Yu\352\364]{\365\270l1\303\354\250+\001\201\374\250\261,\245\0344#\"\"\"\"I\222\244\003q\005\204 \306$\274y\022"
+	.string	"%-\2242\310fF\222\224Q\220,\273\001oAC|=\244k`=\370YkZA\2041\026#\201\251e"
+	.string	"\021\276:\355\270\273\2709\300aJ\023\004\251\225TU \206u\222\236\372-\234\3105\005T\203\203\371\2226\232\fGz\232\375\354\367l<,\306\346\267u\324\001\214\267\023Q\346\002\345\274B-\254KE\222ycD\246\375,\204~\370\306\233\f\3310!\221.\034\207 O\330\bP\365\341\240\004Z\377\027F\256\"\311\361;\322=Guj\264\334=\374\352\b\332\227I\270\202\0179\212:s\254\341\273)C =\250\224k\312o\232\fSt\224\226\001%\344\002\016~B\2111\322[\025\004\254\324\324\021Y}\003P\260\242\311x\274\307\027r3xT\023\207l\346\tx\344\211\337\357\256\361\004\016\343aT\301\331\301\306\333\030q?\314\311 \250\360\330\342\n\314b\250h\034\242\004\364\2740\002\361\360\341\033\003\215"
+	.string	"\244\324pFm_W^JA\374\036\"\212Z\335\020`{<\267\200\221\025\0256\210\005\274\200\225s\355\345\313\243"
+	.string	"\007\234-$\300\r\"\233\341\342 \3465\305M8U\371Y\355T\372\264\245\377\220T\275E\317\232\310\031&\252@\036\216]St\265\002\002F\252\234\355\230,N\032Sl\341@\242\004zui\372\255R:\366\370j\277h\250\214\357\263aGQ\017\3231\204\267\200LIH9\034\2549\305S&7iKB\216#u\bW\026\206\265\370H\223\310>d\177B=\364,k\243Yn\273\035\373\365\235\314Kt\2433\305\027C\246\347\202\206\300bp"
+	.string	"%\013\3704\022\003)\276\325j3\372\372\306*\227\210\241\254\020\352\330\037o"
+	.string	"\360\373\211\377\034\002\b\016!\020\363\307\030\251N\33614|S\261>S\305D\313\324\313\335\214\362\021\030\200j\330\215?\256V\324\341\316\021\217)\353Xi\035<\262\234\265\013\006\260I6!?\246\204M\274\023\263]\016y\214\200\255\r\212\253bZ\303\r\374\253\252e$\321\300L\203\tf\262.\361\201\367\354(\021\212-\252~\033\361\251\022\021\225K\273\310\320\234X\346\2310\307\353m\021\235\214\236L#\240\356c\001\004|P\021v\310\241\361Q\220\371A\350\371 \206\366Hz]B\247\347=\bC\201`_\342\005\037BR\202\250\241\355:\270\214\265P\006\rh7j\2342\210v\230W\024\333\272EU\347\3476\252/x\306\311\005P\221_\252\251N@w>\254\336\323\367\300\030T\240dfU\207\0260\274\206\336u\\\356\332\251\335\032"
+	.string	"m*\377\2334}Qe\206\336\307N\346Z\223Yl\237\230\004~\246\265\302\240Q7\204\314\034\033\352V\202\025\315X;\n\311\376k/\326\343z\177\250#\240\t\352r@\326XXfW\233, \374d#\367\324\275\331\242\030\314AVt\032l\257l\273\375\341\223"
+	.ascii	"\314\265\217\367\221\\\346\276\233(6_\355+E\377d\265\311\205"
+	.ascii	"\003\307O\202\364s$\363\266p(G\232<\335\226\361\277\337\337\214"
+	.ascii	"gwx\234X\202\221Z\227D?&f\341\367d\365\317\020\2121\244+\314"
+	.ascii	"\037;\002\207\361\347o\333X\177`\332#\030\276\203\214\303F\300"
+	.ascii	"\006\354\303\277\265#\357\001\244\357\347=\366\347\207\237h\357"
+	.ascii	"\231_^,\354\300>\223\360\313\0320<\261>:\336\375\276x\301\357"
+	.ascii	"\022\233}&z\244A+\032[\363\354I\330\t\033A\336r3\357I0nZ\311"
+	.ascii	"2\344\226\005]^\230\037\336\005?\017\204GjI\204\211\037 S\005"
+	.text
+	.section	.gnu.lto_.symtab.6e5129071bd7da38,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6e5129071bd7da38,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8329 @@
+	.file	"flash_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 6 "./src/main/drivers/io_types.h"
+	.file 7 "./src/main/drivers/flash.h"
+	.file 8 "./src/main/drivers/flash_fake.c"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/stdio.h"
+	.file 11 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	flash_fake.c.4f46a7dc
+	.weak	flash_fake.c.4f46a7dc
+flash_fake.c.4f46a7dc:
+	.long	0x661
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF1123
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1027
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1028
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1029
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1030
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1031
+	.uleb128 0x4
+	.long	.LASF1033
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1032
+	.uleb128 0x4
+	.long	.LASF1034
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1035
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1036
+	.uleb128 0x4
+	.long	.LASF1037
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF1038
+	.byte	0x1
+	.byte	0x99
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0xa
+	.long	0x96
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1039
+	.uleb128 0x7
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF1040
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	0xae
+	.uleb128 0x4
+	.long	.LASF1041
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x7
+	.long	0xbf
+	.uleb128 0x4
+	.long	.LASF1042
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x7
+	.long	0xd0
+	.uleb128 0x4
+	.long	.LASF1043
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.long	0xe1
+	.uleb128 0xc
+	.long	.LASF1080
+	.byte	0xd8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x8
+	.long	0x279
+	.uleb128 0x1
+	.long	.LASF1044
+	.byte	0x4
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1045
+	.byte	0x4
+	.byte	0x36
+	.byte	0x9
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1046
+	.byte	0x4
+	.byte	0x37
+	.byte	0x9
+	.long	0x9d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1047
+	.byte	0x4
+	.byte	0x38
+	.byte	0x9
+	.long	0x9d
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x39
+	.byte	0x9
+	.long	0x9d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1049
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x9
+	.long	0x9d
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1050
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x9
+	.long	0x9d
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1051
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x9
+	.long	0x9d
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1052
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x9
+	.long	0x9d
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0x4
+	.byte	0x40
+	.byte	0x9
+	.long	0x9d
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0x4
+	.byte	0x41
+	.byte	0x9
+	.long	0x9d
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1055
+	.byte	0x4
+	.byte	0x42
+	.byte	0x9
+	.long	0x9d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0x4
+	.byte	0x44
+	.byte	0x16
+	.long	0x292
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0x4
+	.byte	0x46
+	.byte	0x14
+	.long	0x297
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1058
+	.byte	0x4
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1059
+	.byte	0x4
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF1060
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xb
+	.long	0x7e
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF1061
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x12
+	.long	0x29
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1062
+	.byte	0x4
+	.byte	0x4e
+	.byte	0xf
+	.long	0x3e
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF1063
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x8
+	.long	0x29c
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF1064
+	.byte	0x4
+	.byte	0x51
+	.byte	0xf
+	.long	0x2ac
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF1065
+	.byte	0x4
+	.byte	0x59
+	.byte	0xd
+	.long	0x8a
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF1066
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2b6
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF1067
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2c0
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF1068
+	.byte	0x4
+	.byte	0x5d
+	.byte	0x14
+	.long	0x297
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF1069
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x9
+	.long	0x96
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF1070
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xa
+	.long	0xe1
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF1071
+	.byte	0x4
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF1072
+	.byte	0x4
+	.byte	0x62
+	.byte	0x8
+	.long	0x2c5
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1073
+	.byte	0x5
+	.byte	0x7
+	.byte	0x19
+	.long	0xf2
+	.uleb128 0x18
+	.long	.LASF1124
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0xd
+	.long	.LASF1074
+	.uleb128 0x5
+	.long	0x28d
+	.uleb128 0x5
+	.long	0xf2
+	.uleb128 0xe
+	.long	0xa2
+	.long	0x2ac
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x285
+	.uleb128 0xd
+	.long	.LASF1075
+	.uleb128 0x5
+	.long	0x2b1
+	.uleb128 0xd
+	.long	.LASF1076
+	.uleb128 0x5
+	.long	0x2bb
+	.uleb128 0xe
+	.long	0xa2
+	.long	0x2d5
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x279
+	.uleb128 0xa
+	.long	0x2d5
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0xa
+	.long	0x2df
+	.uleb128 0x19
+	.long	.LASF1125
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1077
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1078
+	.uleb128 0x4
+	.long	.LASF1079
+	.byte	0x6
+	.byte	0x18
+	.byte	0x11
+	.long	0xae
+	.uleb128 0xc
+	.long	.LASF1081
+	.byte	0x10
+	.byte	0x7
+	.byte	0x17
+	.byte	0x10
+	.long	0x35e
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0x7
+	.byte	0x18
+	.byte	0xe
+	.long	0xbf
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1083
+	.byte	0x7
+	.byte	0x1a
+	.byte	0xe
+	.long	0xbf
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0xcb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xe
+	.long	0xd0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0xd0
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1087
+	.byte	0x7
+	.byte	0x20
+	.byte	0x3
+	.long	0x30f
+	.uleb128 0x7
+	.long	0x35e
+	.uleb128 0xc
+	.long	.LASF1088
+	.byte	0x1
+	.byte	0x7
+	.byte	0x22
+	.byte	0x10
+	.long	0x38a
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0x7
+	.byte	0x23
+	.byte	0xd
+	.long	0x303
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1090
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x36f
+	.uleb128 0x7
+	.long	0x38a
+	.uleb128 0xe
+	.long	0xae
+	.long	0x3ae
+	.uleb128 0x1a
+	.long	0x37
+	.long	0xffffff
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1091
+	.byte	0x30
+	.byte	0x10
+	.long	0x39b
+	.uleb128 0x8
+	.long	.LASF1092
+	.byte	0x32
+	.byte	0x18
+	.long	0x35e
+	.uleb128 0x8
+	.long	.LASF1093
+	.byte	0x3b
+	.byte	0xe
+	.long	0x2d5
+	.uleb128 0x8
+	.long	.LASF1094
+	.byte	0x3e
+	.byte	0x11
+	.long	0xd0
+	.uleb128 0xf
+	.long	.LASF1095
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0x96
+	.long	0x3fa
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x3fa
+	.uleb128 0x2
+	.long	0xe1
+	.byte	0
+	.uleb128 0x5
+	.long	0x404
+	.uleb128 0xa
+	.long	0x3fa
+	.uleb128 0x1b
+	.uleb128 0xf
+	.long	.LASF1096
+	.byte	0xa
+	.byte	0xe6
+	.byte	0xc
+	.long	0x64
+	.long	0x41b
+	.uleb128 0x2
+	.long	0x2d5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1097
+	.value	0x2a9
+	.byte	0xf
+	.long	0xe1
+	.long	0x440
+	.uleb128 0x2
+	.long	0x3ff
+	.uleb128 0x2
+	.long	0xe1
+	.uleb128 0x2
+	.long	0xe1
+	.uleb128 0x2
+	.long	0x2da
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1098
+	.value	0x2c9
+	.byte	0xc
+	.long	0x64
+	.long	0x460
+	.uleb128 0x2
+	.long	0x2d5
+	.uleb128 0x2
+	.long	0x77
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1099
+	.value	0x164
+	.byte	0xc
+	.long	0x64
+	.long	0x477
+	.uleb128 0x2
+	.long	0x2df
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1100
+	.value	0x2a3
+	.byte	0xf
+	.long	0xe1
+	.long	0x49c
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0xe1
+	.uleb128 0x2
+	.long	0xe1
+	.uleb128 0x2
+	.long	0x2da
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1101
+	.value	0x102
+	.byte	0xe
+	.long	0x2d5
+	.long	0x4b7
+	.uleb128 0x2
+	.long	0x2e4
+	.uleb128 0x2
+	.long	0x2e4
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1102
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x4d7
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0xe1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1104
+	.byte	0xab
+	.byte	0x18
+	.long	0x4e2
+	.uleb128 0x5
+	.long	0x36a
+	.uleb128 0x10
+	.long	.LASF1106
+	.byte	0xa5
+	.long	0x501
+	.long	0x501
+	.uleb128 0x3
+	.long	.LASF1108
+	.byte	0xa5
+	.byte	0x22
+	.long	0xd0
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1103
+	.uleb128 0x13
+	.long	.LASF1105
+	.byte	0xa0
+	.byte	0x5
+	.long	0x501
+	.uleb128 0x10
+	.long	.LASF1107
+	.byte	0x94
+	.long	0x64
+	.long	0x543
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x94
+	.byte	0x1f
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF1110
+	.byte	0x94
+	.byte	0x31
+	.long	0x543
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x94
+	.byte	0x3d
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	0xae
+	.uleb128 0xb
+	.long	.LASF1113
+	.byte	0x8f
+	.long	0x574
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x8f
+	.byte	0x22
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF1112
+	.byte	0x8f
+	.byte	0x3a
+	.long	0x574
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x8f
+	.byte	0x44
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	0xba
+	.uleb128 0x14
+	.long	.LASF1116
+	.byte	0x8b
+	.uleb128 0xb
+	.long	.LASF1114
+	.byte	0x85
+	.long	0x5a0
+	.uleb128 0x3
+	.long	.LASF1112
+	.byte	0x85
+	.byte	0x30
+	.long	0x574
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x85
+	.byte	0x3a
+	.long	0x64
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1115
+	.byte	0x80
+	.long	0x5b6
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x80
+	.byte	0x27
+	.long	0xd0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1117
+	.byte	0x7a
+	.uleb128 0xb
+	.long	.LASF1118
+	.byte	0x70
+	.long	0x5d2
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x70
+	.byte	0x22
+	.long	0xd0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1119
+	.byte	0x5c
+	.long	0x501
+	.long	0x5f9
+	.uleb128 0x3
+	.long	.LASF1120
+	.byte	0x5c
+	.byte	0x26
+	.long	0x5f9
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF1121
+	.byte	0x65
+	.byte	0x16
+	.long	0xed
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x396
+	.uleb128 0x1d
+	.long	.LASF1126
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xd
+	.long	0x645
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x4e
+	.byte	0x27
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF1112
+	.byte	0x4e
+	.byte	0x3f
+	.long	0x574
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x4e
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x11
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0x8
+	.byte	0x51
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF1122
+	.byte	0x52
+	.byte	0x18
+	.long	0xdc
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x40
+	.byte	0xd
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x40
+	.byte	0x25
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x40
+	.byte	0x37
+	.long	0xd0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF724
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF727
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF728
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF729
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF771
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF799
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF800
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x29
+	.file 42 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 43 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 45 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x4
+	.file 46 "./src/main/drivers/flash_m25p16.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1022
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1026
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF861
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF911
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF976
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1128
+	.long	.LASF1129
+	.long	.LASF1130
+	.long	.LASF1131
+	.long	.LASF1132
+	.long	.LASF1133
+	.long	.LASF1134
+	.long	.LASF1135
+	.long	.LASF1136
+	.long	.LASF1137
+	.long	.LASF1138
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2f
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1139
+	.byte	0x7
+	.long	.LASF1140
+	.byte	0x7
+	.long	.LASF1141
+	.byte	0xb
+	.long	.LASF1142
+	.byte	0x6
+	.long	.LASF1143
+	.byte	0x6
+	.long	.LASF1144
+	.byte	0x2
+	.long	.LASF1145
+	.byte	0x2
+	.long	.LASF1146
+	.byte	0x2
+	.long	.LASF1147
+	.byte	0xa
+	.long	.LASF1148
+	.byte	0xa
+	.long	.LASF1149
+	.byte	0x3
+	.long	.LASF1150
+	.byte	0xa
+	.long	.LASF1151
+	.byte	0xb
+	.long	.LASF1152
+	.byte	0xb
+	.long	.LASF1152
+	.byte	0xa
+	.long	.LASF1153
+	.byte	0x7
+	.long	.LASF1154
+	.byte	0xa
+	.long	.LASF1155
+	.byte	0xa
+	.long	.LASF1156
+	.byte	0x7
+	.long	.LASF1157
+	.byte	0x7
+	.long	.LASF1158
+	.byte	0x9
+	.long	.LASF1159
+	.byte	0x7
+	.long	.LASF1160
+	.byte	0x8
+	.long	.LASF1161
+	.byte	0x8
+	.long	.LASF1162
+	.byte	0x7
+	.long	.LASF1163
+	.byte	0x7
+	.long	.LASF1164
+	.byte	0x7
+	.long	.LASF1165
+	.byte	0x7
+	.long	.LASF1166
+	.byte	0xb
+	.long	.LASF1167
+	.byte	0x6
+	.long	.LASF1168
+	.byte	0x6
+	.long	.LASF1169
+	.byte	0x6
+	.long	.LASF1170
+	.byte	0x6
+	.long	.LASF1171
+	.byte	0x7
+	.long	.LASF1172
+	.byte	0x7
+	.long	.LASF1173
+	.byte	0x7
+	.long	.LASF1148
+	.byte	0x7
+	.long	.LASF1174
+	.byte	0x6
+	.long	.LASF1175
+	.byte	0x6
+	.long	.LASF1176
+	.byte	0xa
+	.long	.LASF1177
+	.byte	0x5
+	.long	.LASF1178
+	.byte	0x4
+	.long	.LASF1179
+	.byte	0x4
+	.long	.LASF1180
+	.byte	0x1
+	.long	.LASF1181
+	.byte	0x1
+	.long	.LASF1182
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF743:
+	.string	"_IOFBF 0"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF811:
+	.string	"USE_CLI_BATCH "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF766:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1081:
+	.string	"flashGeometry_s"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1043:
+	.string	"size_t"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF746:
+	.string	"BUFSIZ 8192"
+.LASF1106:
+	.string	"m25p16_waitForReady"
+.LASF786:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF748:
+	.string	"SEEK_SET 0"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF802:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF392:
+	.string	"__REVISION__ \"1ac2fba\""
+.LASF1075:
+	.string	"_IO_codecvt"
+.LASF1107:
+	.string	"m25p16_readBytes"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1031:
+	.string	"signed char"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF859:
+	.string	"U_ID_0 0"
+.LASF971:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1055:
+	.string	"_IO_save_end"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1086:
+	.string	"totalSize"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF880:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF961:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF397:
+	.string	"true 1"
+.LASF1048:
+	.string	"_IO_write_base"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1064:
+	.string	"_lock"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1080:
+	.string	"_IO_FILE"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1000:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF856:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF819:
+	.string	"USE_SERIALRX_SUMD "
+.LASF960:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF848:
+	.string	"VTX_TRAMP "
+.LASF788:
+	.string	"__f64x(x) x ##f64x"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF887:
+	.string	"USE_UART8 "
+.LASF773:
+	.string	"__HAVE_FLOAT32 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1053:
+	.string	"_IO_save_base"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF954:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF836:
+	.string	"TELEMETRY_MAVLINK "
+.LASF795:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF1013:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1057:
+	.string	"_chain"
+.LASF1113:
+	.string	"m25p16_pageProgram"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF800:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1061:
+	.string	"_cur_column"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF860:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF847:
+	.string	"VTX_SMARTAUDIO "
+.LASF902:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF929:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF812:
+	.string	"USE_PPM "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF891:
+	.string	"STACK_CHECK"
+.LASF1108:
+	.string	"timeoutMillis"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF841:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF816:
+	.string	"USE_SERIALRX_IBUS "
+.LASF830:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1036:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF910:
+	.string	"TELEMETRY_MAVLINK"
+.LASF978:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF988:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF936:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF727:
+	.string	"_____fpos_t_defined 1"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF840:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1074:
+	.string	"_IO_marker"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF758:
+	.string	"FOPEN_MAX 16"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1084:
+	.string	"pageSize"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF892:
+	.string	"USE_DASHBOARD"
+.LASF760:
+	.string	"stdout stdout"
+.LASF982:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF825:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF784:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF991:
+	.string	"Q12 (1 << 12)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF967:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1088:
+	.string	"flashConfig_s"
+.LASF1090:
+	.string	"flashConfig_t"
+.LASF744:
+	.string	"_IOLBF 1"
+.LASF1040:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF903:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1076:
+	.string	"_IO_wide_data"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF994:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF869:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF724:
+	.string	"__need___va_list "
+.LASF839:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF915:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF896:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1027:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1068:
+	.string	"_freeres_list"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1119:
+	.string	"m25p16_init"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF992:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF927:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF799:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF973:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF882:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1038:
+	.string	"__off64_t"
+.LASF1041:
+	.string	"uint16_t"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF895:
+	.string	"USE_VCP"
+.LASF1094:
+	.string	"programAddress"
+.LASF1103:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF818:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1039:
+	.string	"char"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF770:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF999:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF916:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1001:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1124:
+	.string	"_IO_lock_t"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1034:
+	.string	"__uint16_t"
+.LASF1003:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1025:
+	.string	"FAKE_FLASH_SECTOR_SIZE (FAKE_FLASH_PAGES_PER_SECTOR * M25P16_PAGESIZE)"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF863:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF846:
+	.string	"VTX_CONTROL "
+.LASF997:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF965:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1018:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1045:
+	.string	"_IO_read_ptr"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF729:
+	.string	"_____fpos64_t_defined 1"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF790:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF789:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF761:
+	.string	"stderr stderr"
+.LASF976:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF731:
+	.string	"__FILE_defined 1"
+.LASF734:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1006:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1009:
+	.string	"PP_IIF_1(t,f) t"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1118:
+	.string	"m25p16_eraseSector"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF854:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF853:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF739:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF806:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1056:
+	.string	"_markers"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF855:
+	.string	"SIMULATOR_BUILD "
+.LASF1115:
+	.string	"m25p16_pageProgramBegin"
+.LASF740:
+	.string	"_VA_LIST_DEFINED "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF797:
+	.string	"__STDIO_INLINE"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF755:
+	.string	"FILENAME_MAX 4096"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF808:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF964:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF726:
+	.string	"__GNUC_VA_LIST "
+.LASF947:
+	.string	"_T_WCHAR "
+.LASF396:
+	.string	"bool _Bool"
+.LASF984:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF920:
+	.string	"VTX_TRAMP"
+.LASF1002:
+	.string	"STR_HELPER(x) #x"
+.LASF1099:
+	.string	"printf"
+.LASF1033:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF950:
+	.string	"_BSD_WCHAR_T_ "
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1020:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF804:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF753:
+	.string	"L_tmpnam 20"
+.LASF1114:
+	.string	"m25p16_pageProgramContinue"
+.LASF728:
+	.string	"____mbstate_t_defined 1"
+.LASF1014:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1037:
+	.string	"__off_t"
+.LASF1105:
+	.string	"m25p16_isReady"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF911:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1122:
+	.string	"byteAddress"
+.LASF998:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF861:
+	.string	"U_ID_2 2"
+.LASF870:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF906:
+	.string	"LED_STRIP"
+.LASF1065:
+	.string	"_offset"
+.LASF937:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1010:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1017:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1085:
+	.string	"sectorSize"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF843:
+	.string	"USE_SENSOR_NAMES "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF981:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1024:
+	.string	"FAKE_FLASH_PAGES_PER_SECTOR 256"
+.LASF1091:
+	.string	"fakeFlash"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF993:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF975:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1059:
+	.string	"_flags2"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1109:
+	.string	"address"
+.LASF777:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1125:
+	.string	"SystemCoreClock"
+.LASF969:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF962:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1047:
+	.string	"_IO_read_base"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF785:
+	.string	"__f32(x) x ##f32"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF996:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1072:
+	.string	"_unused2"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF980:
+	.string	"VERY_FAST_MATH "
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF928:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF842:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF990:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1008:
+	.string	"PP_IIF_0(t,f) f"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF918:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1019:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF874:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF796:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF826:
+	.string	"TELEMETRY_FRSKY "
+.LASF888:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF938:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF791:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF817:
+	.string	"USE_SERIALRX_SBUS "
+.LASF933:
+	.string	"_T_PTRDIFF_ "
+.LASF1060:
+	.string	"_old_offset"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF909:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF858:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF775:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1082:
+	.string	"sectors"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF968:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF942:
+	.string	"__need_ptrdiff_t"
+.LASF807:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1121:
+	.string	"loaded"
+.LASF1089:
+	.string	"csTag"
+.LASF946:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF897:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1035:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1007:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF898:
+	.string	"SERIAL_RX"
+.LASF793:
+	.string	"_BITS_STDIO_H 1"
+.LASF801:
+	.string	"_STRINGS_H 1"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF943:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF810:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1023:
+	.string	"FAKE_FLASH_SECTORS 256"
+.LASF876:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF763:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF783:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF948:
+	.string	"__WCHAR_T "
+.LASF1077:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF917:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1050:
+	.string	"_IO_write_end"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF468:
+	.string	"__PMT"
+.LASF1079:
+	.string	"ioTag_t"
+.LASF769:
+	.string	"__f128(x) x ##f128"
+.LASF1087:
+	.string	"flashGeometry_t"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF987:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF872:
+	.string	"MAG "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF756:
+	.string	"L_ctermid 9"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF931:
+	.string	"_ANSI_STDDEF_H "
+.LASF747:
+	.string	"EOF (-1)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF983:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF963:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF829:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF850:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF738:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1051:
+	.string	"_IO_buf_base"
+.LASF765:
+	.string	"__HAVE_FLOAT128 1"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF878:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1029:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1097:
+	.string	"fwrite"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF822:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF930:
+	.string	"_STDDEF_H_ "
+.LASF1120:
+	.string	"flashConfig"
+.LASF828:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1098:
+	.string	"fseek"
+.LASF1070:
+	.string	"__pad5"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF934:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1012:
+	.string	"BIT(x) (1 << (x))"
+.LASF932:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1093:
+	.string	"fakeFlashFd"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF907:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1044:
+	.string	"_flags"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF940:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF868:
+	.string	"ACC "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1071:
+	.string	"_mode"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF889:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1066:
+	.string	"_codecvt"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF945:
+	.string	"_WCHAR_T "
+.LASF957:
+	.string	"_WCHAR_T_DECLARED "
+.LASF776:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF939:
+	.string	"_GCC_PTRDIFF_T "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF875:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF852:
+	.string	"USE_NAV "
+.LASF759:
+	.string	"stdin stdin"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF953:
+	.string	"_WCHAR_T_H "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF824:
+	.string	"LED_STRIP "
+.LASF886:
+	.string	"USE_UART7 "
+.LASF923:
+	.string	"LED_STRIP_TIMER 1"
+.LASF745:
+	.string	"_IONBF 2"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF873:
+	.string	"USE_FAKE_MAG "
+.LASF730:
+	.string	"____FILE_defined 1"
+.LASF890:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF977:
+	.string	"sq(x) ((x)*(x))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1028:
+	.string	"short unsigned int"
+.LASF815:
+	.string	"USE_SERIALRX_CRSF "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF823:
+	.string	"BLACKBOX "
+.LASF1073:
+	.string	"FILE"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF900:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1123:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF768:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF956:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF995:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF699:
+	.string	"_STDIO_H 1"
+.LASF849:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF834:
+	.string	"TELEMETRY_IBUS "
+.LASF921:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF389:
+	.string	"SITL 1"
+.LASF749:
+	.string	"SEEK_CUR 1"
+.LASF1016:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1111:
+	.string	"length"
+.LASF1127:
+	.string	"fakeFlashStore"
+.LASF970:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF935:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF904:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1030:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF871:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1069:
+	.string	"_freeres_buf"
+.LASF922:
+	.string	"USE_SPI"
+.LASF750:
+	.string	"SEEK_END 2"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF899:
+	.string	"USE_SERIALRX_CRSF"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF952:
+	.string	"_WCHAR_T_DEFINED "
+.LASF831:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF832:
+	.string	"TELEMETRY_LTM "
+.LASF838:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF924:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1102:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1117:
+	.string	"m25p16_eraseCompletely"
+.LASF774:
+	.string	"__HAVE_FLOAT64 1"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1054:
+	.string	"_IO_backup_base"
+.LASF1063:
+	.string	"_shortbuf"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF926:
+	.string	"DEFIO_NO_PORTS "
+.LASF1116:
+	.string	"m25p16_pageProgramFinish"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF798:
+	.string	"_STRING_H 1"
+.LASF794:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF857:
+	.string	"SKIP_IMU_CALC "
+.LASF966:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF764:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF949:
+	.string	"_WCHAR_T_ "
+.LASF741:
+	.string	"__off_t_defined "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF979:
+	.string	"FAST_MATH "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF951:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF986:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF901:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1101:
+	.string	"fopen"
+.LASF767:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF736:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF864:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF813:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF885:
+	.string	"USE_UART6 "
+.LASF814:
+	.string	"SERIAL_RX "
+.LASF851:
+	.string	"GPS "
+.LASF805:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1052:
+	.string	"_IO_buf_end"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF771:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF866:
+	.string	"USE_FAKE_LED "
+.LASF845:
+	.string	"VTX_COMMON "
+.LASF1126:
+	.string	"fakeFlashProgram"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF894:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1110:
+	.string	"buffer"
+.LASF742:
+	.string	"__ssize_t_defined "
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1092:
+	.string	"geometry"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF757:
+	.string	"FOPEN_MAX"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1032:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF989:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF827:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF837:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1062:
+	.string	"_vtable_offset"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF893:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF974:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF944:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF762:
+	.string	"__attr_dealloc_fclose"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF958:
+	.string	"__DEFINED_wchar_t "
+.LASF787:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1011:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1021:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF809:
+	.string	"USE_CLI "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF844:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF833:
+	.string	"TELEMETRY_CRSF "
+.LASF1004:
+	.string	"EXPAND_I(x) x"
+.LASF1026:
+	.string	"FAKE_FLASH_SIZE (FAKE_FLASH_SECTORS * FAKE_FLASH_SECTOR_SIZE)"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF862:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1015:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1095:
+	.string	"memcpy"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1104:
+	.string	"m25p16_getGeometry"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1046:
+	.string	"_IO_read_end"
+.LASF735:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF881:
+	.string	"USE_UART2 "
+.LASF772:
+	.string	"__HAVE_FLOAT16 0"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF959:
+	.string	"_BSD_WCHAR_T_"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1042:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1058:
+	.string	"_fileno"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF925:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1022:
+	.string	"M25P16_PAGESIZE 256"
+.LASF955:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1067:
+	.string	"_wide_data"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF751:
+	.string	"P_tmpdir \"/tmp\""
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF803:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF737:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF919:
+	.string	"VTX_SMARTAUDIO"
+.LASF1083:
+	.string	"pagesPerSector"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1078:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF821:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1100:
+	.string	"fread"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF725:
+	.string	"__need___va_list"
+.LASF1049:
+	.string	"_IO_write_ptr"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF835:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF820:
+	.string	"USE_SERIALRX_SUMH "
+.LASF941:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF732:
+	.string	"__struct_FILE_defined 1"
+.LASF985:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF908:
+	.string	"TELEMETRY_HOTT"
+.LASF792:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF883:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF867:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1005:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF733:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF877:
+	.string	"USE_FAKE_FLASH "
+.LASF972:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1112:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1096:
+	.string	"fflush"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF905:
+	.string	"USE_SERIALRX_XBUS"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF879:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF884:
+	.string	"USE_UART5 "
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF913:
+	.string	"TELEMETRY_IBUS"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF754:
+	.string	"TMP_MAX 238328"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1140:
+	.string	"stdint-uintn.h"
+.LASF1144:
+	.string	"io_types.h"
+.LASF1170:
+	.string	"__FILE.h"
+.LASF1159:
+	.string	"long-double.h"
+.LASF1175:
+	.string	"__locale_t.h"
+.LASF1177:
+	.string	"platform.h"
+.LASF1149:
+	.string	"target.h"
+.LASF1153:
+	.string	"libc-header-start.h"
+.LASF1151:
+	.string	"stdbool.h"
+.LASF1136:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1148:
+	.string	"stdio.h"
+.LASF1165:
+	.string	"stdint-intn.h"
+.LASF1178:
+	.string	"common_fc_pre.h"
+.LASF1135:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1138:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1160:
+	.string	"stubs.h"
+.LASF1130:
+	.string	"src/main/target/SITL"
+.LASF0:
+	.string	"./src/main/drivers/flash_fake.c"
+.LASF1143:
+	.string	"FILE.h"
+.LASF1157:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1167:
+	.string	"__fpos_t.h"
+.LASF1134:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1176:
+	.string	"strings.h"
+.LASF1155:
+	.string	"features-time64.h"
+.LASF1139:
+	.string	"types.h"
+.LASF1173:
+	.string	"floatn-common.h"
+.LASF1172:
+	.string	"floatn.h"
+.LASF1129:
+	.string	"src/main/drivers"
+.LASF1137:
+	.string	"/usr/include"
+.LASF1179:
+	.string	"common_fc_post.h"
+.LASF1154:
+	.string	"features.h"
+.LASF1162:
+	.string	"typesizes.h"
+.LASF1128:
+	.string	"src/main/common"
+.LASF1163:
+	.string	"time64.h"
+.LASF1145:
+	.string	"flash.h"
+.LASF1131:
+	.string	"src/main/target"
+.LASF1142:
+	.string	"struct_FILE.h"
+.LASF1146:
+	.string	"flash_fake.c"
+.LASF1169:
+	.string	"__fpos64_t.h"
+.LASF1166:
+	.string	"stdarg.h"
+.LASF1132:
+	.string	"src/main"
+.LASF1158:
+	.string	"cdefs.h"
+.LASF1164:
+	.string	"wchar.h"
+.LASF1180:
+	.string	"maths.h"
+.LASF1168:
+	.string	"__mbstate_t.h"
+.LASF1147:
+	.string	"string.h"
+.LASF1133:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1174:
+	.string	"locale_t.h"
+.LASF1181:
+	.string	"utils.h"
+.LASF1152:
+	.string	"stdint.h"
+.LASF1141:
+	.string	"stddef.h"
+.LASF1161:
+	.string	"stubs-64.h"
+.LASF1156:
+	.string	"wordsize.h"
+.LASF1182:
+	.string	"flash_m25p16.h"
+.LASF1171:
+	.string	"stdio_lim.h"
+.LASF1150:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 \305=\005"
+	.string	"\004\t\271"
+	.string	"\024"
+	.string	"\364\220\277\324\f\006\002"
+	.string	"\001\240\342\234\212\n\002\003\242\243\211\310\013\006\002\001\002\002\002\003\002\003\004\372\221\321\345\007\002\005\302\311\355\357\004"
+	.string	"\006\330\260\363\267\r\007\241\232\274\236\003"
+	.string	"\b\251\220\200\203\f"
+	.string	"\t\256\330\276\211\r\002\002\004\002\004\n\013\373\256\312\245\003\006\002\004\f\274\205\242\255\006"
+	.string	"\r\370\231\323\233\007"
+	.string	"\016\311\247\375\374\f"
+	.string	"\017\307\276\344\257\003"
+	.string	"\020\330\370\241\354\t"
+	.string	"\021\313\322\375\213\007"
+	.string	"\022\262\373\251\200\004\023\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"\371\036\245\320\306\232\362\243\nc%j\312\335\271\2156\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"5\004"
+	.string	"\302E\017\024\2207\351\272\273\273\273\273\013\3776\364\364{\321\220\335r\247\024\316\302>\246Q\320&\224\316Z\222\337`KY\220\021\\\007~&\326\335\200RB\206\2227\302c\230v\333\323\276:\032^\004\036"
+	.string	"f\b\n\006\013\232\265\215\361\271\204!D%0\312\f4\214\030\017\241\013\202\260\006N\301M]\004\303\270\260m\245\345\2332|\006\236\325h\020\306\316\301?\357\310$"
+	.string	".\346\254\240\022\220%\263\236\364h\006X"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.inline.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\307\002\035\r"
+	.string	"V\022=8P\305&\215\001\240h\t~%\270\240\3303\377\200\345\202\251\001\241\336]\226C\320\211\0064(\260]\230\251-v\243\302\212\252\252*\242\233>\016u\267\222!m\223-\245L\001-"
+	.string	","
+	.string	"-"
+	.string	"\230va\377\205\265?3}a\226l/dE\nEI\236\347\313\335]\367\r9\241\341aQ)\376S\3429n\024D\032}\f\336Z9\002\267\364\354n\365\364x\346\035\273k\271\345\177\321g\230\302\333\232\374\b"
+	.string	"\2054N\226.>\245\004\227\230\034\035}\004"
+	.string	"p\260\342\027\246\177\245]\354\270\247|x%\3132\354\270)\037\316Q\243\031 \"\211\314\225\327\366[\356\257\360i>:\250\210\300\b\006\302\356\366\203\330\335\210\003\027\020X\1776\305\rL\223\002'\"\325\2315\212\262\273\2251O\277L%b\310\362t"
+	.string	"7\032\2420\255Q7\205$\031@\362\344\324O\235\225\005H\250q1D\025\315T\220\226\026\226\003P\002!S\204=\022\240\304)E\031\246\224b\202\231\tfr\326spp<\002\305wW\354\323p_\240\fC\201\025\305\32724\253\021\216\277\203r3\3202$@j:\326\272f \031\226\371\246\325\024U#0\266\301\212\262\006\306\241&J<"
+	.ascii	"\354\325\330/\205\"\030\200\314\214\210\343\270!W]\225\245\223"
+	.ascii	"\n\332K\370\346n\007\341u\350a\203\275\337p\323s\323Q\r\243\212"
+	.ascii	"\342\3406\301{:\022\222S\bj\rD\206\215\226I\037_\321\203\302"
+	.ascii	"\314\317\325%\334(&\332[b\231Zc\376\3039\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\210\003\275\016"
+	.string	"\006TB7P\245(\035\fWUU{\331W\317J\2156\200\231\231\231\355\013k\212\276\370m\f\217\316\246\215'\nk(\330\003\036\304\n4\367\255#\256Uv\357\026\022%\221[\246\024,"
+	.string	"/"
+	.string	"3"
+	.string	"\212\353\032\376;gc\307\323I}\017P\274\265m\333v\377\232\342>\244\177H\361\225\275\230&?M\267\221\302\245p\255\037my\301\316\207\0279\336\332T\305\245\340)\\\206\377\216r\365\336\2633\243*U2\356 \377\307\361^\004U\245g\\\332i|\210\032\3655\212/\360NRNf\256x\277\336\274\345G\nA\t\3111\355J\323"
+	.string	"\371^j\364#\307\023x\024\256\373\007\266\355\026\240\252p"
+	.string	"\307\220\243\005Z\320U\035\235\252t\3118u\345\032\3160Qz2\302\\ M\344\271F\235\r\217\354\"a.N\207\263\321>WE\304\204\203\004\004\305\2013\214#\255\201\221%\\\2146\037\317\304\366\2052\260-\312b\026\3577}w\204\002\007X\250q\265D$4S\220\024\322\032P\"A\f\232\007\022\240\0231I\021\235@\032c\224\nh\302l\253\365;\247b\274\006\030\305\255\177\317\327\236\\8\315\324\b6\232\270\215\331\357\021"
+	.string	"\017fv\226>\231\251\343\242\307B=\016\367\335.b\024\236\334\332s\311\374f\324]{\033\205n8\350\243\343~A\204hx\026\320\357\360\013\017j~\355\331_\tN\315\336\305\220\355\324\211\324\311\300\303H?\201\254\212j\262\306\247\305w\331\303\\!|:\275\016\240\305\266+\020\370r\2644$\365\3215\001\264\222\311g\316\215?\234A7\013@:~\214\221\344-\217_\311\235\260\264\b\352mV\226S\220\237"
+	.string	""
+	.ascii	"&\211\033Nn\231\251C\257q\331\003"
+	.text
+	.section	.gnu.lto_.pureconst.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\005\003\231\004\004\230\004\005\230\004\006\230\005\007"
+	.ascii	"\230\004\b\230\004\t\230\004\013\230\004\f\200\004\r\230\004"
+	.ascii	"\016\230\004\017\200\004\020\200\004\021\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 \351e\004"
+	.string	"d\005\317"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\f"
+	.string	"\001\002\017\001\003\003"
+	.string	"\024\274\006"
+	.string	""
+	.string	"\001"
+	.string	"\004"
+	.string	"\005\003"
+	.string	"\374\007\260\304\200\370\267\004\006\001\002"
+	.string	"\200\200\200\230\003\200\314\001\b\t\001\002\005\013\0024\240\300\340\272\002\r\003"
+	.string	"4\240\304\340\272\002"
+	.string	""
+	.string	"\020\0071cO313"
+	.string	"\0051cO3"
+	.string	"\027"
+	.string	"x"
+	.string	""
+	.string	"\313\203hH\361\013\027c\257eCM\002`&\r\001va\300\270/\206$-\272\204\r\300\020g\340\246\245\213B<3\020\346\335\235\r`\361"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.e2ada49efed3daa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_geometry.17.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 :\265\001"
+	.string	"\324\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006(\001\200\200\200\b\004\005\001\006'\001\200\002?\202\210\200(\177}\275\001{\275\001y\275\001w\274\001u\273\001"
+	.string	"\002"
+	.ascii	",\371\f\240\b"
+	.text
+	.section	.gnu.lto_fakeFlashStore.20.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\261\001-\020"
+	.string	"\026_mF\360\262&\035\242\202\0348\304>\\4\376\272 \t\373\234\241\227e\205>GR"
+	.string	"\353\375\320\002\237@P\367\341\036#\226\230\241\377\2535\262%|\217\031\2703\203u\364\302\306i\307,\320+\374\307m\265\221\354\275\245L)Z"
+	.string	"S"
+	.string	"Y"
+	.string	"+\316\342u\236\013\036\315\031\002(h\316/\2015\221\307\323I\344#\374"
+	.string	"\371\350\227\275\343\237\316\314D`\260qA4\347\324\226\304_\207\253/\377=\037y1\330a\207/4\200\343F\n"
+	.string	"1\032x"
+	.ascii	"\007\304\317{\256\031b3\252\031\2039\247\325\213q\270\343m;\260"
+	.ascii	"\r\301VR\367\036\375\027\371\3705\345\270\221\321\"\217\2340"
+	.string	"\361\303\307\324 \366\007\323\035a\037\3169\2477\307\376\367\233\316\363\223T\235I\265\214\352\b\325P\325\273jU\365\003\224|D=\n\314\230sC\221\220)\024i\224\260\375\222m\252\361\361x \362h\002:\271\332\017\367\\\362\301fa\216\353\313`\215\350\314)s\317\217\361\237\224\277\363h\216\305\222\217r_\203bF\213L\332\270\020\306\356\350FA\020QI\021\\\367k\257\264\350=\237j\026f\322\352\336f\210\351\205\207!\215\ri\260\261\216\221_\n>:h\024\210}\237\267\210\361w\334z\321)0,\027\216E:\245:\331\026\230\254LP\004\\.\256S\251\266\314)\024\267\262\255PR\\\033\313Jsu\234\005\225N\245\271\250l-Z\252si\250\223[\025\270N\203i\265:\255\364\315\303\2719n\240BHfg \211fkG\220@\263\260\240lG7\022gH\200\356\302\375'H\2716\312\246\001\036"
+	.ascii	"\226\223\341L\323\020\304\206\300\332\222\331\275kk\034gd\340"
+	.ascii	"\272\002c\222\206\215\032\230\205@\226\327\023\005\211\220\001"
+	.ascii	"\355U\003\223\2456\220\243]\022\026\201/%\366\336\302,X\\\370"
+	.ascii	"da<`\004\214{\241\246\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_fakeFlashProgram.21.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\225\003\245\032"
+	.string	"f\362\255I\240\230Q:\020\366\036`\\\210\327\\\340\206\307.b\177\266\222\207.\b(\022\002FI\022O\363X{\304-\356e\332,\333\236\213\301\343[\020c\275\244\360\212YD\221$\322\353\353\324Y\200\245\021-+\306f\t!\233\310\235R\226"
+	.string	"\222"
+	.string	"\231"
+	.ascii	"\247+\021\260\331;\016\334\2178\034@\255Ce\203\361\324\275q\265"
+	.ascii	"\203}\332\257q\033\270\337\320q\252V\241\037L\265\366\f\3705"
+	.ascii	"\236\272\336\nO\301\303\204\247\306\331P\336+\252b\212\023:\244"
+	.ascii	"*\265\326\327\252\260X\226ey\260w\207\023w1\244\340N\234/\326"
+	.ascii	" }\200\211\247\035o\347\"(\372xp\321\302\323\2014QPMO\342\231"
+	.ascii	"\241\n\306\210S\021\007[x>\240k\351\023\210\3273\367I'P\342\307"
+	.ascii	"\2167\342S\254\251\265z\356x \356\361\266\203l\343\330\273\013"
+	.ascii	"2\204\246/\310\222:\255\330\275\235\271D\366i\212\242\240\274"
+	.ascii	"Cv\353G?\314\225\356\227\337\370Y\327\361\273\374w\223tZ\025"
+	.ascii	"N\247\302\351qN\213\342t\030NS:\r\322\351\245\323\223N?@8EIL"
+	.ascii	"Y\253\207\362JMB\233^\\\351\377\255f\300\374\035\376\222\311"
+	.ascii	"\025\r%\r>xX@\325\332\203\320\002\346\373\374$\223\247+#\230"
+	.ascii	"\375\263\323\270\363a\374\345X\001Uk\2259\365\203\361\364\244"
+	.ascii	"\275B\001[\035v\002Y\265'\005\t\246Z\253\001;\030\003\273(\343"
+	.ascii	"\322M-\330D\027\304s!\030pF#\237\303\036\250D\2700+\356\177b"
+	.ascii	"\204K\217<x\023m\254\265\322\370L\007B\3017:\265\205\332\374"
+	.ascii	"\356\324\257\205\247t\005\254h\312\315\322-\276\"g\362\344(\t"
+	.ascii	"\\\"\r\341\313\332r\034\351\231Q^\371\210,y\331+\335\005\356"
+	.ascii	"\367e\027I\027\242\274N\270\013n\f\025]\020k\347\356\376\347"
+	.ascii	"\004\271scz\350\262\344fi\227\262\314R\257\023\262\366K\261\350"
+	.ascii	"\202xf\351/\375\035|N\373{\362\341\255e\022\240\310M+~\322\301"
+	.ascii	"\267\333\314&\223)\230\345l\220@\322>!\007\347\302\254B\030\313"
+	.ascii	"\211\311@\333\310`1\004\007n\016\314\004\270\335f6\231,&\332"
+	.ascii	"ffF!v\023a\302-V\341\346u\263\3152\320l\262\327\005Z\314\302"
+	.ascii	"\313\306v{\315\270\\\3030\263\275rj5\333\213\354\325\357\220"
+	.ascii	"\031PI\222[\036\273\314\251Z\333f6\277\263\313gw|\036g\255j\257"
+	.ascii	"\013B\272\312'E\\\"\247X\320\326\256\223)sr\201\\\226\334\005"
+	.ascii	"Fzf\024\022!rkr\323\312\301Zk\r[\373_\201\223\333:\321O\220I"
+	.ascii	"S\373D\023P4\344\001B\250A\034\0071\247\214Aff\202\231 \303\260"
+	.ascii	"9`\002\031:\253\016\020p9\022C:\226^\345-Y\264\n\267k\006\277"
+	.ascii	"\316\327d\240\250\236U\030\375\273\205\240\212\024\277tv\254"
+	.ascii	"\215\r\273\207\334C[]\303H\324\357\205\266\222\327\312\256\021"
+	.ascii	"\221\201\265\222\224\200\215\207:\320\370CjS$$\342\327?\002G"
+	.ascii	"\300\333\007\221O\301\301p\2507\3355\240\213\177\355\245\226"
+	.ascii	"\324\270M\301\271\206\370\ti\300\326\347\345\253\236\303\rsJ"
+	.ascii	"\275\202\231\220\250\250\343\347\300SY\301M\321@BG\030?"
+	.text
+	.section	.gnu.lto_m25p16_init.22.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\210\002\335\025"
+	.string	"&\252\225I\260\224Ncr\377f\226\204\022!\344\362\243\270\"\034p,\216\324k\220p\266\003\270S\314P\0201\237\214\250\326\022\260\005_\347\021]GG\220.\244\271\321V\221R\037{\036\217}\304\335\330\254\247.\275[\210{\354\275\245L)z"
+	.string	"{"
+	.string	"\202"
+	.string	"7U9\351\016\346\311\373i\220M\263i]-\265~\350K]F\320\247\200>\340^\246,\255{S\007\266\231'\235\336@y\322|\201\362\244mC\210\020d\337S'\243/I\021Y\205\335\233\332l\213\373N\216\266\372\374\017\317"
+	.string	"\206\220\035>h\b\177'M\244\2173!\322\355h\227\240J\204C#\0052\256\253\017_\213\204B\265\222\270\334{]Q!\212\273\274\355\030\333\250]Y\0049\034+\243T\302\376\\\213)h\325\264\216\362e\367V\371\364\305\263\304\351^\340Q\337\3523r\374\247\223\3369\353\321\223\376)\242W\217\272\026\264?\223\034y\231@u\211\201\335:f\247\277j\233\354\217\367\336k\313d\237\352\236\221\325\343\247\376:V_@KWX\021\005C\3565*#\273]\344\r\027\247\372\355\323\200\264\234\370\224F\013\322b\277\212\352\3477x\004\240\210\210E\344\006'\236\353\366\342\327\211\317a\301\304\t\203\031\334\245d\3300\263\243=\321\221"
+	.ascii	"\305\0253{\252\373\224\200u\314\b\352\355\257\376s(O<\216\263"
+	.ascii	"\301\327\226c<\324\2433\353S\"\262?\277\352?QL\362\262e=x\\Y"
+	.ascii	"\333\344\373\224\2676\304\037C\325\210kQ\205\327\255c"
+	.string	"\276\365\265n\303\307\177\262\314\314Ly\262b\241`\300Zf\002\365\351\263hj\314 .\345\344\323\327\270\231\367\006\217\336\230\301\231\224\236\365Pj;'OW\353\345z~lj#Pj5\232\0131/\032*|8\261\215\no4\317\316fe\206\313\341n\247N\351\033\334\204\233\004\026\035\313\312\001\234\235\216\347\204\241\371f%\227s\323\325\200\350\335tt\266\036/Gb\307\303\331xv\267\035\333\r\257g[\251\371\f\221\343\331z\316\223g\243\245\367\343\265L\367\2256J\354\005\320\n\271\026cx\221'\325\366\r_\352Q[\013c\240jb(\275\367>\370\360.\300\004IQ\343\202\032& 0\002\202\220\262\364\205'\b\276l\213\267\003]\226\355Cd\265\t\023j\256Nd^\006e\327\263\266V9\322R`\335/(\221\031'\267fa\026\325\210d\243|\233\243]\321{\313\016\342\303\367\355\225\303\322\210\307h"
+	.ascii	"\2423\337X\310V*\275\025\2732\360\240am\204\2433z\265\317\216"
+	.ascii	"\204D\373\240"
+	.text
+	.section	.gnu.lto_m25p16_eraseSector.23.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`#\001\265\r"
+	.string	"\266\332^C\020q\224\016\003\bd\270\022D\207\215\027(pJ\264q\332\312"
+	.string	"\202_q\2637)\240i\032IX\350\177\375|\252\003\310\027m+k?\b"
+	.string	"D\n \020\317\242\205\023\260\004\250\351\264\323\372\221\220\275\245L)I"
+	.string	"H"
+	.string	"K"
+	.string	"\326>\0365\007\301\036\341\013`\217&\3319\316R\355[7P)<vWS\022'\035j\222\374\243\034\343\245J\207\037\2560\301\353\305\216\001)\022\bbb\302;\312\263C\352\224\2315\330]\247\227\362p\307\333v`\373\201\375S\273\037aP\243\036\007\n\304)?\247k\305\306\246\213\315*\245\236\330\207\273\273\326\021\366W\253\037j:3}L\366\252\201\300\305\256\311\367\262,\021\306\t\333\317\330\031\026\"O\373)\256\202\364\325\310\230]\021-TvY\n\002\367\274 D\211\226|\365SD\006T\273\246{~\353+:\277\304\2435\210\362\336\243/\302\036S_\202\342\224\237\036\325\303\224\237\003\270d\\\325\362RQ=q\366}\337GX\324\b-\032$\331\342t\305\210\372\3255\246t1\201\357%\346tD6\006!\237\220\315\201\256\363p\235\316\226\231\263\361P\330>\020&t[\205\217\326q\236\r \256\243Y"
+	.string	"m#\032\207\353\264\215\306\241\013\036N\313\020\nqZ\206\265\327\301b\322\023\024`K"
+	.string	"i8h\311\331\f"
+	.string	"\tw?\202\375\273W\260T;\204!\003\025"
+	.ascii	"\226\223\241L\2130,\260a{7\350\327\226ALK\320\005\"F\310\321"
+	.ascii	"0Ff\316|\265S\n\025\341\342&\251\253\271\306\002g\002\261V\243"
+	.ascii	"\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_m25p16_eraseCompletely.24.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\375\007"
+	.string	"\342N67@o\323\0010\366\304\3574\022\013\210\370\223\201\220\224\354h\007V\007K-:\363'\310\344h\020\013\272\036B7\231\342Q\004\256u\016\272\366\200\252\037\217hiI\333;\245\346\\\231\002\3269H\330\260\205\316\334h\026\341\241\b\223\301\203}&\207n\363\332Xk\310\350|\3204:5\337\236\332(2\210!\201b\205\003\376\221\266\346`Q\2220\343\024\371\323}\"\017\362\217\023\030\355\202^\375\220\213@\370\035\257,\301\301\327W>'_\331\023\024\360\325\233\213\350\031\226\274\260,,\331\237\007\343\206}j\243\310\246,\323\312\200\312n\306\311\264\244\312\304\303\3665\356\354\226\177\243\375\b\f\006\211\313\356\316\310\361\356\260\363\377q\200\032\362\016\255\202\3355\254!\215;\3366\201\355\3136J\016"
+	.ascii	"3C\343\004~\275\343\242:\354\226\00198\326D;cdVt!'\013v\274\f"
+	.ascii	"\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_m25p16_pageProgramBegin.25.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"\305\b"
+	.string	"\006\221?;0\345(\035"
+	.string	"\360\3472\340\362\341\302<\265?\334\224\032\216x\304K\247=N\267T\255a\033dU\003\356l\334O\02610@\260*\362\317\033\200\320\rp\224em4\262\311\336)\005+"
+	.string	"."
+	.string	"."
+	.string	"\037\310>\r\3320\017E\366,\214\013V\314\356R\031r\360\021\364\237r\315\tUz\314$\354\256\343\t\245q\313\333.\260\275`{\025\366U\177\304\0048\\\fZ\273\031\257"
+	.string	"\353\232-&\266\257\331\032\211\347\321\376\311Q\300\253H\326\354~\264Xv\303\003\323\200O\316\t\262O,+SV\350p\231\244\205\243\364U\276\"\371%\256\030\305\237>\375Q\366\271\031\3610\305\227\343\312\306\313F"
+	.string	"vX\212\022\304>\266\273k\231\n\376t\036\016\241\003\352l\233\357\363j\327q\031\1776\317\201\00314|\334\003\210~\325\243\b\325\216F\2048\b\372\251\037\3358\026Ix\225N\210D\225j\341\036\013\b"
+	.ascii	"\226\223\241\214i\3433<8\013\3432\212\265\032\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_m25p16_pageProgramContinue.26.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"5\f"
+	.string	"\006XUA\020q\233\016sJP\205\322#Qq@\366\340\033S4\341\242\033U\215>\026 \200r\0263$\246K\247\372UU\324\370P\255\333\004"
+	.string	"\210|\200\"\274\b\261>*+`\372J\230\236\236\232\020)S\n@"
+	.string	"@"
+	.string	"A"
+	.string	"\335Q$\034\300.(\206\312.\330\341h\271d\360\002\246K\226\007\230.\271\263e\034\364\260\017Q0\t\325\330\335\250\035\336=;\377(^}'\237'u`w\235\337\211\205[o{\200m\005\366A\002k\005\331O\371\251\243\374\223\246#M\253\246S\323\277\\F\274 @c\267B\210cW\244\026!l\337\262\255\013W\202?\321=\305.\\\355n\260\241\262\273\035N`\271\224\211\254\t\327\323~\211\233\b%\031H24\245\2527\311\341e\250\"\025\363\341\"\242JJ'\275\332\332\203\374\347L\211~\354\207\236\202\363A\030\302H\376\273\344\217L\227\256\025\006/C\347\n\r06o\330\340'\225\203\375hw\003\036\036\006\"Y\310\344\r\307"
+	.string	"V\340\352\\\032\f\346\3018\2217\232\f\004\353,\360\340\260\220N\344\266,\302\307\306\211\"\037X\203\270\331\270\250\311Xs\220m\321\243i[\264\300}\264\n2\002\022+\236\2228R\026\377fx\031j\244\017\022"
+	.string	"c\223\241\214\3517j\030g\b\254;\225\013\2211\006\355\315\212\211W\r\377W\002\272k\3003\214\t\304"
+	.ascii	"'\370T+\340$/\256I\006"
+	.text
+	.section	.gnu.lto_m25p16_pageProgramFinish.27.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 \312\215\005"
+	.string	"\002\n&/`e\323\001"
+	.string	"\265\211\336Q\023\004\303\231\b\030\322\2332\313)\317\377m\241\262;w\370\375(Q\f"
+	.string	"0\001T(\"\314\037v\274\035\321\3362\005\267\350\325\2500\005\203\253\034\030s\365\222du\301\217\254\322\330\252\034S\352\033\344\252\034\331\266\312\223\330;\303S\223I\271\241e\351\027=93\377\006z\206\277,tB\bQ\267%"
+	.string	"\240A\202\017\347\377N\357\376\321\212\233\336\021S\031I\335\315S\263\335\312\356\273\236%|\240\267r\220\350\356\313\017\274\354\347\376?\374\247\377\265\b"
+	.ascii	"2\003\3669\003.(\327p\262\020\306\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_m25p16_pageProgram.28.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\325\n"
+	.string	"\246\024MC\020\251j:"
+	.string	"x\002#V2\350o\016\207e\371-6}8\002+\b\370\303g"
+	.string	"4\303\240\217\3530\315n,\233\212\b\361qY\307\"!\2410\004BP\241\003\357'D\013\f*\221\322\323\351\251\221\275S\n6"
+	.string	"<"
+	.string	"8"
+	.string	"[j\\\271k\231?l\327\262;l\327L\332\020^\022\330\263VNX\021v\267\322\001'?I\377\254_L\247\322\247\205bw=M'\225\233\336v\204m\f\373\013\001\0246\246\275\n\330>\306\356\036xteX\306\260%\001P\\\273\253\361\005w\255c\340\315\362\b\310\253B\336\260\213\222`\301]s\311u/\357\323\276\201\037 \237\022\361e\027@\313\265\001\024\345\nXl\204\222x\233\031\245tR\333\003d\336\344\214\t-y\266\0248\3309\301.K\223\n\260\237\355\356\232\242\354\257\376\354\252\237>\365\317\255[\320@\"\301nJ\205\037\222\206(\fm\037\351\0033w@\357\233\340x8\033\210q\fE\020\374,\356l\302\215\317\223\361\031\277\220\247\216b\370\001\022\301*\002}\034\265#\216u\223\361\250#\024+i4\022+\246\334g\033\r"
+	.ascii	"\226\223\241\214\351\bj\0308[\3065\266\301\306\376\204j@\370"
+	.ascii	"OM\201\273s\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_m25p16_readBytes.29.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\b\001E\r"
+	.string	"6\231[D"
+	.string	"\2576\035\177=Q\tu\303\020\302Pi~\343\334\003~\326\201\304\316\347\203e\027\200\350~j\007|\305H\022\021U\347]\342\232l\251@\024T\200\346"
+	.string	"\b\022\210\0173\344\370\346\360\306\206\314\376\266&eJ\001G"
+	.string	"I"
+	.string	"B"
+	.string	"!.\242\263O\324\347\301\273\211\005\005|\261\273\227\347\003\342+\352\002\342+\355\360\356\224f\347[\036\351\024'\303\225*P\322"
+	.string	"\003\200gByP\314\240\034|\252x'\231\233\216\335u\246x\030\356\352\266\023\330f`\337A5+\f\270\330\275\020\326\354Lu\342\203}\022\235\255a[ @\232\007c|\222!\263\273\033^\300ye\261\2002\017\343\177\037\321\375\245\302\003\354\226Z(\3708\326\n\350y\227\267\224\270\263\313\301Ef\367\333\360\305ye\333\017\035\026\324\204\212\251Zi\252MB!\237\0225*\3514+a\tU\2237a\030\276$\246z\300\2508I\032\037\274e\"\005\213\315\030\366GJ5\331\247VK\266\246\343_\376\3521\277\276\345OM\277c\005\037#\017D\262\220\270e\232F\342\021\035\022\2010\004\034\032\307\207"
+	.string	"\307e\233H\204m\034\372d\0200\255\301\007\207\205h\027\267e\023@6\321%\002\202E\270B\033w}<\036I\310\266kd4\332.\215oOi\324\203\357l8\315\310\003\277\252\250\003\025"
+	.string	"\226\3030\304\026aX\204\005\360X\200SX\341\250\306\236\312\321k\202s\r\337\332\242\004X"
+	.ascii	"Q\244\013\024\032\001(P\331AcI\020K\374\234\323\324}4\006\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_m25p16_isReady.30.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 \326U\006"
+	.string	"D\013u"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\345\262#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\310\245\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\317,\361\370\260Y\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\262\371P"
+	.string	"\203\003\202\260\371\270\003\006\177\001"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	" ./src/main/drivers/flash_fake.c"
+	.string	"\007"
+	.ascii	"_\b\330\350\220C\b\214\256yL\b\022\356\334\253\235O"
+	.text
+	.section	.gnu.lto_m25p16_waitForReady.31.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\305\b"
+	.string	"\206\020@;0q\323\001"
+	.string	"E~Y99\004\213ZL\311\216\321\253\346CS\376ae\376S\030\231N\320 \001\240\2627\0175J\206\021\\\206\032\350;\275F\007\377\201\032\327\230~7\262\267L\001."
+	.string	"."
+	.string	"."
+	.string	"\013\345M>IL\234r\351hau\237\266\216\260\311\324<3\013\033\234\324\210\320\254N%\246\237\207\356>\3658\201\360+\377?\370\037\361\277$m\352\341i\031\f\306\344\177\371k?(\307\201\322\237SX\245\344\025\215\203\272CV/\335g\302-"
+	.string	"c!&\310\030\273X c\354\377\025\002\241h\265\377?\233\257\256\250\263\231U\224\226j\243r\\S\315\f\304\330\264p\232\356\374g\211\326\324\317Ww\367+\352\247\022\037\254\033\004\235\016\357F\r\034\203\350\023m\005\343\005\301\013Ab\204\036\351\222\001\3576\257\202\373&(F\016\374\354(z\031W\034Y\213\313\221l'\216v\013=\274\360DK\206\001\007"
+	.ascii	"\305\017\307\326\333\300\004S,6\3215\037\335!\314\353\232d"
+	.text
+	.section	.gnu.lto_m25p16_getGeometry.32.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 \377%\007"
+	.string	"\222\21526`O\322\001p\b\246\274\334\303\261\360a_\305XP\345Mx\331M:s\264\206\2644\251c\027\344\321(D\266"
+	.string	"\004\241a\270\265!\020\023\342\214\031id\223\275S\n\326T\027\203\265IX\310\254\206\215\314\346%\301\231\n\362\201c9H\315\314dE`\f\342\2322\002\303\246\214u\377D\266\211F\355~N\375\222\327\t\377\343\320\024\232;=\364\265\351\360@\343\363*\0347\326\275\330\325\343\036\207}i\237\310vq\264b\300\262\213\021\003\263*\020%\304v\307\216\376\310G\035o\003\325#\004`\221rq\342\262[\245\353\005\246C\352\001\323\341\353\370v\267\371'\271$\002\322BA\236\273\f\302\356\332QP\350~\267]`\273\262\235\021\b"
+	.ascii	"2\001\0138\032:\034\240kx5\242i!\bqWL\355$\003"
+	.text
+	.section	.gnu.lto_m25p16_init.part.0.41.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\270\001u\020"
+	.string	"6\337mH\360\260(\035\340\367\022\312;p\235\3204\341\204\337n\252>e?QMG_\261\203\307N.\366+\245\324\006bZ\026\344\023\305\316l\304\267\037\311\370.<C\304\376q\027-\215\3323\232\b?\006S!\006\t\342\266{\247\024S"
+	.string	"W"
+	.string	"["
+	.string	"\247\256`\227|\2710\356n\202\317\205\350\362&|\332iZ\257\271N`w&\305\212\335\021\201\253w\352\361\037\335\251w\217\356TZ\264i|\334\275\f-\003\256\306\356\326\t\342\342\247\374\210\376?;6t\270,\360\017\207\311\356\332\363p\323\333\256\266Sl\371\021#%\242[\fr\031C\300\330\366HI\313- \227\321\310\320tv\307z\372\334o\373\264\357\347~\363op6,\t2.\207\230/\206\350\271\333|\334'Cd\037g\303\372\302b"
+	.string	"h\270\341\3504\360N\357\333D\277\306\237m\3615\027h\276\354k&r\352\333Z\366\027\006I\3621\322\214\330\316K\366X\200\374\355*PP\036\254\024r\372\333qT\274]\330c,\036\314A\310\251\035J\220\217}\216d\030\246\213_s\017F\211\265\261\263r\316PH\311\343\327\376\227\344\361\374\314\231\375\317\356\256\347\214\335I\277;\320b\300\207]\230\236\033+\2439#N8>\021a}\234B\235\204:J\246\022\030\256t&\225\026\200\nHN$!\003(\250S*d\360\231\0242\251\200\247Q\312\n\\9\325\225\312D\001\245*\325\024\nd\251$\325\252\206@\016#\230TuB\030\252\352g[\336\3445-L\017\351\355\356\037t6\204\221|\314\240"
+	.ascii	"7$^\354\364Y<g\345\213\b\" `\202Q\210\262\007\202\204\320\304"
+	.ascii	"[b\r\200L\246\331\006Y*\335\n]YK!\246\365\260\355Z\273:c\225"
+	.ascii	"T\017(\335\221\266\273\3172|\2422g\236\f\361Q|\013Cdf\2569\250"
+	.ascii	"2\230\322\263\337\314\353\022e-\351Y(\033\267\337\250\233~B\030"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_m25p16_readBytes.part.0.42.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`\372\001\005\021"
+	.string	"FapD"
+	.string	"\261&\035o\230\013\256\365\006\351\264.$\"\336$\217Zm\346=\305\217\034\271\f\227\3560\\y\2322.\223\035\212\0311\365\377\215\242\371\276W\002\300`\354q/\300\377-\235}\240\306C\266\021B\366\2262\245Z"
+	.string	"Z"
+	.string	"Z"
+	.string	"\313\202\001]\be\336\273\r\213?\273\030ltv=\003\217\336\262G\373\"N0\266}\020\017\201\262w\240G\303\372L\315\013N\214\335\335\036=.\340z\204\017p=j\206\243\256\tQ~\256X-\327\177\207\0374\264X\261*<9\016\261\220\335uf\341\216\267\215\3006\003;\027\004i\3558?(K\177\260tv\245\261\267\356+\246cL\303\267~\215\351\274\367\177\203cK\261;\241g\306\306D\024\033\354\177'[\363?\224\255\371\004\362\020\202\371V\t\357\320\320\331]\005\247\337\254\f\360\226BMH\3638\376\210\223@\375f\345"
+	.ascii	"veX$\3602\237n\303\002\275*mq\246\376\211R\007\315n\352+?\347"
+	.ascii	"&J\374\232G\233\224\362\253G\277t=~\364\252\016.Q1}~0.}\353\036"
+	.ascii	"\251\344q\324K\277\002jjT\0029*\027\252P\341\316K\215\224f,W"
+	.ascii	"*\226\243\342\340\222=\376w\320\367B\305&O\352\214\025\036\356"
+	.ascii	"\356Zel\030$*#(\334\311\325q$\022\004\007\227EF!\321\001\020"
+	.ascii	"\022\310G\207\311\304u\243\221\b\263\310\007g\"\"5 1\211NH\233"
+	.ascii	"\251\343\"\224t\243\r\245DT\332D:\323\366\341\341\224\007\\\267"
+	.ascii	"\251\244\244t\233f;\017We\n|y\251\246\022lk\352\220\224\272X"
+	.ascii	"Ugl\203dl$\246\037\005\251\315\215\344W\326b\002) \200\242QU"
+	.ascii	"\036\2352T\332\260i-\363rX0q/\212a\r\242\203g\210\276\2539H\024"
+	.ascii	"\307^`\246\205&\321\031\226\030\021\255\025\365W\220\353\372"
+	.ascii	"\b\017\374\326\f\226C`\353\227y\313\362\232\177\360\351\022\005"
+	.ascii	"\303\211N\273\254\036\2275\335gt\005\345\235\256\205\310)D\227"
+	.ascii	"^\213\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`C\002\355\n"
+	.string	"fP<5`\251\322\001\200*\301\261t6\304_A\337\f|\255\360\031\250\363\004;\3620\254J\020|\3508z\250\353\272\256\353\332F\b\t\"$\320\352%\335\222\275I\332R\006,"
+	.string	"/"
+	.string	"-"
+	.ascii	"\031k\030\2130=\347'\341\020\034(\251R\021\316\240\343\021\257"
+	.ascii	"\272_C\"QUe\317\331\020\252\254J\241\260Vw\367\2031\250\252'"
+	.ascii	"\b\254\351p\207\303\236\355n\325\313j\303\237U\004M#f \021\303"
+	.ascii	"\230\013_,l\251p\005R\230\342\261\327q\307I\342\306\334\2047"
+	.ascii	"\215'pvD\235\374\222\344\017<y\211\332\342\367\263\276\247\265"
+	.ascii	"\332\272\200\203\376\027\n\323__\246_\323\302\205S\202\205\246"
+	.ascii	"\027q&\304\033\020s>\f\362\004:\332U5\254$\242\343\005\017\370"
+	.ascii	"\350\215\357T\306\r\030\227'\275.I\273%U\252\302\273\0160\267"
+	.ascii	"cx\260\344/N^\232\366\253\013\324D/ \340\002\241\231\242\007"
+	.ascii	"\030D<\264\006id\302\214\301\222\301`v\316\361\032\311x\003\222"
+	.ascii	"\273\376\215\254\331\364`\315\006\245\036\200\0038\200#8\020"
+	.ascii	"\034\356@R\270\024O\n\306\022\362\255\315\264\303\230\036\276"
+	.ascii	"\341o,?\202\036\374C\005\001@=#w6\322\303\377l\002\374\215* "
+	.ascii	"w\246-@e\210c522q\234|\304r\031"
+	.text
+	.section	.gnu.lto_.refs.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375 a\005\002"
+	.string	"\322\305\r\021\240'\351\377\377\377\201W\304L\333\366'\204\354$S\372`\301\244\232\243\364\262\214\327\002\363\247I\017\230ds\236\214\365c\216ML\302s\330\331aZ^\232>\025j!\001"
+	.ascii	"\026\301\204\002"
+	.text
+	.section	.gnu.lto_.decls.e2ada49efed3daa,"e",@progbits
+	.string	"(\265/\375`7&5\257"
+	.string	"\232\032\225>Z0JII\035\372k\265\352LN\325n\321\035\337\225y9f\350\332M\377\337\217\"\302\347}\350\352\273\273:2 \242J\266\212\037k~\232\025C\2458\204\030?\253`\270\034h\023E\242\250\242m\322\244i\253(\247L7\245)1"
+	.ascii	"\240X\221\244\272\030\223\271\325J\333D\312$S~\003\301\003\355"
+	.ascii	"\003\317\302\027\275\214o\3611\336\306\323\370\247\177\361D\217"
+	.ascii	"\3647\256\364\233.\020\177\025/\344\033Z\237\023u\324\033w\237"
+	.ascii	"|\323\215\322\001\267d\372\207\013\306~\344\275\302\344\ns(;"
+	.ascii	"\\xA\305+\227wb?.\231R\007\222\351e\273\323\"\231\275\344z\202"
+	.ascii	">\201\262\301\213-\351,\355\0369\301tE\003\024\027\275`\\<\250"
+	.ascii	".\320]\273\024\\@Z?t\320\275\333{w\253\367J\215O\323\347\303"
+	.ascii	"\204b\211\373E\362M\227\311\205\303-\264\327\245T\242\356\275"
+	.ascii	"Q\244\270W`\220\030\366\226\021\005\272\277\351\223\367\n\005"
+	.ascii	"J\246\003Z\260B\335\273\365\253\343\233\276\371,`\220\355F\256"
+	.ascii	"J\260#.\320\355\275/\330p\001o\tT]\220\003d\177\026\356\227\307"
+	.ascii	"m\2270i3\320T|~'\215\377\n\317\320\022\246f\345\306\347\ff\372"
+	.ascii	"\345\022\t\323\216wh\3078\264c&-\203\207\264c\037\315\201N\373"
+	.ascii	"\303i\r\220h\3772\355m\017}\345M\004\252#\270)\355dvu:\371C\b"
+	.ascii	"\222\272[\245\205\207\262\310\371\244\375\237\332\377\205\366"
+	.ascii	"\351;\265?\n-\305c\326h\300\365|\366Gj\277s\332\251N\364\337"
+	.ascii	"4-s\341\334A\210\270o\032\330\022\254\260TV?_\267\353\304\357"
+	.ascii	"\333m\342 D8Fnm"
+	.string	"\255\267\020\317\275\223\367-\346n\357d\314\275\026\334kA\306b\272\001\266f\277g\232\206\306o\233g\270<\354z\240\205\351\r~\331\224\\3)\"O\237=\356&q\231\340%JD\304\325j\277X\372n\265k\344J\335\310]\3331\253X\030\326\022\252?\260\253\327\215\254~\235\212\020\211q\001\t\223\226\310E\353-\241\376\370A\322~Y\350\333\274\031\326 \370'\210\250I\220k\0063\226t6\344\263\337\036\355\034\320\356\227\314\357\030f\002=1\264\210%\265\375|\226\336\261\013\244\335\033b\240\246iV\237}\003\332m\364}V@_\037\267\353J]\355~\371\315\272Z\2766\213\332-\335\273\215\2011;\361\245\366\331I\320.5\356^.\201\222-\302c\264\177\340\272\332\352Z_\350\353\374\274\032V\bn\206\365\2667\303\312\341jX\275\275\032V}3\254\356\017\302'\240\203\307\270c\237C\340\376U\036\001\177"
+	.ascii	"w\347\271c\022\260;V\300\273c\016\334o\362=(A\331\363\236;\246"
+	.ascii	"\361\353\216u\276\003gq\307\005\370\032\317\356x\002oq\307\022"
+	.ascii	"x\216\303"
+	.string	"\270c\f\356\267\003\317\201\273{\271\377\b\367\017A\001\210[\347\3764\257\201\373w\230\371\017*\270;\001\334\177\316\375\262\237\201\373\375\300\375\"\200\002w\357\340\376\006\220q\3775\367\313\365\030\270_ \177\201\373M\200\220/\300\320\335\001\340\356\027pw\fx\004\356\377\303\375Z\271_*\367{\345~\253\334/\226\373\315r\367\325\035\233p\177\017\356_\201\373kp\177\026\367k\347~\317\334\357\230\373\215\272\337\035\356W\313\3756\271_%\367{\344~\225\356\267\310\375\022\271\337!\367+\344~\203\334o\n\367\313t\277\034p\277K\367\353\001\367;t\277%\334o\320\375n\340~\177\3567\003\356\327\002\356\267\004\367K\202\373\205\200\273\177\271\337\b\270\373\t\356w\004\367\013\202\373]\200\373U\200\373\025\341~C\270;\006\356\256\346\356\030\252\325j\325\035\337\271\363\210\356\025h\005\277\244\205\\\215O:V\236\271\b\331\235"
+	.string	"\373\214\221y*\013\353\3533\336_\026\204#\351\265Ni_\221\264S\251\177\267\356}\333\247P\323\347\374\357xJ\246\242\300>\267\230\311\275\235\334\327i\344\336\310v\013AP\325\026y\340\031)\322\265?\177\335\323\275\230\ti\243\362\371\351\376_\370*\376t\357\202\313\362\351\362\265"
+	.ascii	"\346^\013xg,$\271\326\354+\221\366\271\247\3026G\266\202\312"
+	.ascii	"\024\226+B~\234D\3325\355\207\023%/\345\315|U\262\204\354>\373"
+	.ascii	"\372\243\235\367\202n\271\362\366\366q\267h#\345BHM\337\214\350"
+	.ascii	"\240\370\307i&R\332\272>\377\223\237:\207\236\237\037\356\267"
+	.ascii	"^\252u\325\250\237\345\026eYkm\272"
+	.string	"\027\255\361w\223\276\333Oa\246\003\264\354\250\273\331b\340\2744\355\342\243\346\223\274\022\1776\177\266o{h\317\213\211I\335EM&\376m\036\347B\201K\324\320\215\263\317\277\304\307f\364\326\344\263\317\275\227\273\373\326#Bwu\237\235\027\246\335\357\272\223\315\275\367\n^\273\233J\227\365\362\356\365\340\376r\361%\300\336>\201\b{#\321\334\250h\251\261\344\221s\330\316\2336\231\321%\344\007K\316\345\222\013fti#\227QH\f\315\275\204dF\367\306\260\227K$\003\236\033\0033\272\235\273G\211\363\356v\t\271\227\317\215a/w\222\003s\271\344dF\223N\f\314\350\222sG\227\266\314^&\233(\226\273\211aG\227\344v\364\351\224aF\237Nft\311\350\2461\341\2068\207\2701A\335$\314\345V\021\204\224l\312L\231\355s\273\355}\245>\273I\200\275\221\236M\267\244\213K\246\234\252P\212%\2377"
+	.ascii	"AJ\246\347"
+	.string	"^N\231S\317\275\247\224%vP\bd;\335Ow\212\224\201\264\201|\366\026\300n\367\016\332\033y\367t\357\215\334{\367\232H\355\336F2LhP\320\336E\033\2026\022\262\314g\357\227\276\2219\231Q\246'MYW\024\272O\264\310\013\335nKM\035E\366\330@S4\324\311B\312\347^T\215?\222+}$\317\303\001\355F\262\004\3557#\272\335lb\340\331N\373\037q\177#\277\326\353\241\243V??\363jX-\360\241\361W\323=\214\004Y\246\025\2612c\262\3443\021\007!\242\325zQ\"\204\215\f\212\036\362A\376\254\306go-\2540l$m;\242\333\273E\273\322\037\362f\016B\204\326\006\336\321Z\017Y\026\222\211\326fD\351\320\236\253\264\347'\355\376e;\236m\rH\371\331\237\314\243> N5\250\237\037\b\215\377\330\001l\310\300\372\214\177\210\3654\215\274\230\373\203}\330}[\2537\250"
+	.ascii	"}v\262\253ae\221\322\370\177-\207\300\242>\373\242\357\343J="
+	.ascii	"|\227\373\226\355\216\372\332\246\300\220>\265_\017kL\325\003"
+	.ascii	"\227\207*mJ\253\255\357\241\203\312X\353\"$d\343\331>\217,\254"
+	.ascii	"'U>\373\363p\377\253\307\372\035<\0372\342\224>\177\326k]i\005"
+	.ascii	"\257\343\345\312\325\025\273\"\355\267\202\365Vo\005\253\267"
+	.ascii	"{\357\f\353W\321\370[y\20645h\324\347^\265Z\245\252 \246%\n\222"
+	.ascii	"\221cJ\211L\032\375\324K\275\270\230\336I}\376\026X\234J\250"
+	.ascii	"\231\205\366\r\312\256\020\025LZ\324\035[~\006\263\224\331K&"
+	.ascii	")\315\007\371\031\214o\357%8\350\\\221\225\037\252\334\235\302"
+	.ascii	"f\264A\217\335\331\220[\204-\213\352\303\254Bu\277=\256\216o"
+	.ascii	"\272T\374\354N\245\"\260\275\030z\350\037=\323?\037\307\327x"
+	.ascii	"\030\257\364.>\351g<\324;}\324/\275Q:\013e \031vDb|\316*\034"
+	.ascii	"\277\240u\243\311\2213\335K\263\342\031i%\377`\266\333\356\242"
+	.ascii	"'\206"
+	.ascii	"\273\222\272\263\332\314\"\0170)\242,\315\310K\317?\236Q\200"
+	.ascii	"\020\341P\2064\272\272>g\246\337\247)]\314\023\370\007\216'b"
+	.ascii	"W>g\237\f`\324\305\270\353qR\302B\216\317\177\375l\315J\207\022"
+	.ascii	"d\226\003\306\347\234\364(/b=\234\220.\030>\302\304\246\374\214"
+	.ascii	"\253\236\267Y\322\214%\252+`mGP\034\332Yjh\037R\r\232\34394l"
+	.ascii	"w\231{\027=\221r\0358\237l\b\241\323M\350\346T\340:\307v[,mL"
+	.ascii	"\2243>\343*\230\316\301\220\244I\241s\231A\225\026\305\342ft"
+	.ascii	"\342\205\027\\\210\311\032\242\001\345+\263\313\321\3423V\303"
+	.ascii	"T0\021\271(\032H>c#x\n\213\216hP\365\263\2579\226\262\206\243"
+	.ascii	"\037l\344\326\026\312\300\223\r!V.;\276\256\216>\3438,\227o\250"
+	.ascii	"h:\362\031G\301\324\272\253\026\321\2437\f%\246*\344\006\365"
+	.ascii	"\031\303\341'0IO\026\300V\264a'8\t\016+\272\236\317\270\tv\343"
+	.ascii	"\221\244b\245`\303LzGT>/>\343%\030\rN\351\007\363\263\222\230"
+	.ascii	"\032L6<\305I\326\226\364\260$5>\202\221\254Ma.\224\325M\321\236"
+	.ascii	"\201\336\"r:?\343\"\216\323\270\302\222.\336\264;&Bu\265\255"
+	.ascii	"\260i\367\255i\335\226\225\3413\307\313\235\204\264N\361%\333"
+	.ascii	"\226L!\216\317\316r\027\230Z\334g\034\004o\361\224\244\212\346"
+	.ascii	">c37\362`F~d\240i}\324\325\205\307d\2066l\345r')\255j/\356\024"
+	.ascii	"&O\230\304\034\2179\006\002B\304\005;Z*\t\362\343kmN\307\230"
+	.ascii	"\306`8\314'e\313\211\314\24385\206n\212\356\3553\376\372(dY\313"
+	.ascii	"\317Xz\301`\240H\243\220\274\220$Ya\327,\2731\006'\325\272\247"
+	.ascii	"\246mqt\303\023)\247A\025'6\204\320\355]\344\201\307T\006g\307"
+	.ascii	"\3458:\275\253k\372\354sx\253\345\031twd\013\367\340\225\311"
+	.ascii	"H\261d\354[@kaX\371\354>\033\232\347\244\306\361\216\035\357"
+	.ascii	"\365\201t'\235\036\2128kL\321\355&\021\f0\2600\255\252\323\275"
+	.ascii	"\253\232{u\361\223_)~\302Z\036\332\315\002&\350)c\003\216:\273"
+	.ascii	"\"\372\354\033La)-+\252\016\0260\216;u\372\200H\026u\357\250"
+	.ascii	"c\0339\336\213\007\246\302-`)\030\336\336O,(\246\302P\357\005"
+	.ascii	"\263l\267\263\347E\326fv\205\2530\026\266\302YW\212\251\360\222"
+	.ascii	"?\n\\\303s\273\267\330\336\033\306\r\f(\311%\273\246j\327n\373"
+	.ascii	"mX\371\342*\242q\024\276q\245\0350\324y\311\266m[\310\222\276"
+	.ascii	"\206\310\264\337\016+\256Vo\207\325\265\227v\255\245}\272\265"
+	.ascii	"\224\366\241\341\0308\006n\232\302A\r\252\223|T\r5a\032+\024"
+	.ascii	"\262*\034\246\201g\240M\367\334g\031m\226\222\003E\022\223\306"
+	.ascii	"LxIC\371p\242Yh\327[\373\232\300\200\201\225,@\366fd\025\363"
+	.ascii	"\266D\312\n\234\344Xi\316\307t\307\023\315\30242\302G"
+	.string	"\020\024iA#CF\035\371pH1\001\255i\026iQ\321\307)A\273\252z|\200i\226*DD8\305\021t\027!yX\225\216\330\24684K\325\351\330\211\207\364\336PF\366fD\347;!\367e\304\302\361P\334\313\320RmE\217H\367\306j\034\013I\261\320{\345v;Yn\364N\350\226gP\020f2aB7Hk\001$\212n\241\372\371\301)\264\314V\262\325Ai\310\231\241}\306)\210\350\026-\354\203}0\023\001\\n\324U\016\211\213\034'\03433\033\2176\267\325\307\025\274\274\202\225,,\252xY\305J\n\264oFV\001G\326\250\303\352\254A\336\021\250S$\006\327\340q(,\356\340\f\205\305\bT \026K\034\211\303^\020\310\346d\023;6:\254\316\252\003d\213G\243\016\253\363\203\321au\202\372&\270\2627\027\350\035\235c\2175\022sl\202+;\024\346\f\205\304\241\266!\346\344"
+	.string	"u\326!\273C\f\362P`Yc\220\227\223\3033\034\022\207=\242\360\346h\324P\302\310\223\023\f\256^\342C\004Nx\200\t3G\026\247\b<\206\300\026\211!\350\260G\243\t\023br\200G\342\321g\354\025\331\022\2140\307\337\b\032\315r@h\202\221\005G\037\215\277\030\023\305#\253Cd\033pdq"
+	.string	"P$\216p\024\002U\310`\342\006\310N\300\bS\302(\034\nG\330\300\362\f\205\307!1\004\001\030\215l\361\346f\001;0C!\016\013\002\213\003\3341\221\303\036\331\234\035\035b\b\021\024\211G\033\326\004\326\b,\2622F\366h\002\004\tr\210D\020~\274\026\r>\034\213\300\235\017G\341P\370\033A\263#\002\204\016"
+	.ascii	"t\200E\034b\261\004\231\233\021Z\330\"\361h\002\214\333\b\213"
+	.ascii	"\354\220\305\321\036bD\006#jV\350y\215\007\032x\240\301\3525"
+	.ascii	"\036\320\320x0\202F\373\b\032\354\034F\360\035\275\304\207\t"
+	.ascii	"\234\270\303\026g\216Dbq\246\345\370\303\001\236@\024\366p\200"
+	.ascii	"'\030mx\306\037\21608$\206\360r\374\201\330@\037\1775\307\241"
+	.ascii	"\220\247\227\275\304\207\243\rO\361h\2341\262;&\2163\306\243"
+	.ascii	"\220"
+	.string	"\304\f\317\020'\203\025x\206\302\234\fB\214\370\215\250Ya\206\275\341\311\261\031\ng\212F\236\031\016@\334\260F\236!\317O\257\305\343\216\313\r\220-\302\024\217;/GaQ\205 \217K\220\207D\313\013k\004\222\370\355\360\240`\003$\021s3d\177l\n@\243\213\261\310\242P\004\352\374\364P\b,a\363[\211C6G\030\374\365@\030q\2009\301_\357\370\353\335\344\020\177-C\035\236\034\242\315\257\310c\363k9\262F6\207\004\360\230\302\017\246\b,a\223\203<$\216Eb\t\343\317w\374\261\240`C\314\371\361\216\277\020#~\276#k\f\006\211\277^\3131\005\033\366\206h\363\323/\300#\360\346\307\336\bU\370\261\210\020\201\007\214\360#\341\001?}4\ns^\202<$~F\266\310\262\305\340\317\345\370c9 4\256ns\303\001pD\210`\210\017\021x\007\035\204\300\201\002\022h\200\266\371\300\242"
+	.ascii	"\f\376J\030\2019\301\031c\221MAX\274\231\031\n\201:36E\343\314"
+	.ascii	"\207\001\210\270\001\356\374~+{C\324\371\361\266<syF\021#\205"
+	.ascii	"(\306\321\347\334#\037\341*(\230\223\317\271\305a1N\320\257 "
+	.ascii	"<~z*\262\354h\354\300Z\017\325\002\330\225\216\254\265\302\206"
+	.ascii	"\027\327\347V\314\bT\020\024YXY\224T\004\r\353\343x+\270\206"
+	.ascii	"0]\275\227\376\212\233\246\260\372\273\257\027NLT\236\253\262"
+	.ascii	"\023$S\n\235\307\200\272\261\"\307\037Y\201\236\210\365L\345"
+	.ascii	"\026bZHPY*\303\330-N\356\266\230\271\205'3\2121\343'\343\260"
+	.ascii	"\243\321\025\326B\263\023\314\224G\365\351s+ev)\235\242\276\255"
+	.ascii	"\3475\245\025\344s\033\205\240\250J\005T\324\245\210[\362*\333"
+	.ascii	"\030\333>!\322\252\273\\\343,?\2415\241|\366U)y\216\241\224\235"
+	.ascii	"p\233Ko\254\210\324\035]K\217\024=\222\310\360\354\344\271\311"
+	.ascii	"\212\252-\3719\323p\374\243h\315\214:\203EjF\264*3MA\001\222"
+	.ascii	"\373\234\227\374\314\245\250\t]S~:\321\372\005\027.2\f\307E\256"
+	.ascii	"\260\335\022; H\236a\270\253\031\351X\373\234\215\362\021Q\222"
+	.ascii	"\331\366\031J\234\324\023\263\035\237\363\213\\\304\246\365\264"
+	.ascii	"\006\3103Pn\221O\334\226\346\352\353S\200=i\021\344\271\205\347"
+	.ascii	"\2415\247\346\223\317"
+	.string	"yEf\201\177\2245\301\002\36297\263S\207QX\217\221\2032\250B\3210\211\343\030BH\251\021\221\221$I:\262\n\020\006Di \310\360\006\022"
+	.ascii	"e9NB\207ff\202&E\205\302\326v,(\020O\376\037\344\202H\fS\362"
+	.ascii	"D\234\311\335O\n\005\004x_\265-S'E\b\226B\034\204\232\223w\224"
+	.ascii	"\t\337\262:\203\030\244\226\027p\033\232It\003_|d\373v\251\\"
+	.ascii	"Z\027\fVVy8\210\200T\360\240_-\316\233\023\216n\264n\333{\263"
+	.ascii	"\021=bE\2434\b2\027\246\354\201\266>\366\304\216L\236>\315\311"
+	.ascii	"sw\257\207\032kE\330\034?\242\257\310\022\364'o\364\320\322\234"
+	.ascii	"\231\304\213\t\363\224V\307\356\002\034\216\371\016\261\263#"
+	.ascii	"\317]\371\3575q)\206\f\240B\240xO"
+	.string	"\222S\037\261](\361\306\366\225&\017\360\241'\214\371cD\223\033\220\257\273\334\r\3278.\337\211v6\337\330\004]M\325)\252\357\217\310\217#\372\0246\213\345\232\261\370\3107C\330\231\003\260K\317QV\362T\n\301#\347\221\2539\310\352w'\331\033>\005m\227\377W\273hw|\t!?k:\235CH\216\306\203\036\016\341\034\"`,\240\263-gR*\243{\204\177-}%=\343\260\262?\271\203\023\025@\256:\205k\346B\2033\261\206t\243\200`; \230\274\006\242\257\260\323\\XZ(|>La0\0022\r\001\361\260iev27\230\332n'e\265\217\267Z\213\254\301\322[O\314\216\356\217 \276\020\247\32410\234K*\277\001\247\300|6PJ\350\364\236\303\234\241)\005X\250VAZ\302\254|$\243\301\252/\330ob\320\327(\271\n\350\001\212U\260L\254\353:\314\204\316.\340^\242"
+	.string	"r\252\002>\340\271.k\344_\346\356zm/\206\267\214\254\326\356_\275\256\237\234&\300&\342\352\263\357%\260\267\204\247:8k\215\217\230o\344\022'v^\311\2231g\273\375f\3769\371\360Rsz\372]\326qN=\345.\330\323\036\277\216'\274\244u\250h\2175\b\311/\205\304\007E\217\025\035\205\326E\247\340\332\257\0136\251\374\034=\027<\311\335\335\004k-\341\275\3667\3300S\307\005lw\243\261\360\247\220\270\357\357X\006\364\306\230yb\314\271\274m\233\003d|\223Ye/\316Fp\026\264l\326\216\260\356Bg!\252\021\337\0337\204.M\016\340=\262\t\256g\363\252\361p\321\264k\243\354\276lh\020\225w(\031ji\307\301\215h\3046g\247\003\375Q\026#"
+	.ascii	"\210\322\022\307\310/\370d\206q\216\324\274\323\035\356X\215"
+	.ascii	"\241\361\203v\200\306\241\355E\363\342\037\205OF.\024p\371\240"
+	.ascii	"&i\207\240>\302\237\036\222\220\213\035;\221u=Y}\351\363\030"
+	.ascii	"a\032\366\345\246\346\326\035\226\331\224\202\367j\312`\217\003"
+	.ascii	"\302u\n\234\\\266\361\276\3701\232-\327 \340\227\033`\202\006"
+	.ascii	"t\007\362xQl\002\340@\246\3145=>J:\021\274\224.Y\t\006\373\240"
+	.ascii	"\230\016_\003\322\230\232$\305\0351|\361M\316&\022\364=\r\341"
+	.ascii	"\034>Q\271\233\310-\361\332@\001\344\322\362\364\037\213y\367"
+	.ascii	"\366:\r\006\035\221\376\377\362\205u\332\"\027\320!\252\227\312"
+	.ascii	"7\f\373\211\364\034o\253kK\025\232\246\211sP\246\244\264@\244"
+	.ascii	"9\277\243C\265\013^[\311\234\217\002\336J\333\355\n\377\376\340"
+	.ascii	"\262\334Z\220?\021\201.C\b\202\3466\321u\2128\241\016Y\343\361"
+	.ascii	"c]\250\333\002\201\250\332"
+	.string	"U\027\325`\022Y\337\310\245\337\242\341\211*\013\234Dn\323U\271\335\230d \251d\211\307\275{N\321\226\270\200\024\310\315]8\265\270\365\226\310\2303\316^\036d3~\216\227\206\315\b\b\270\270\303\345f\356\013\207\001\330i\215\2678W\326^\361\372\337\267a\256i&\220\260\272>\320\201+\346\213\357\231a\226R\343\215\357\033\003\245t\250\203M\367\255\005W\310\3448\267\275\"\363p\035\003\376:\027\244K\tVXF\3711>\b\350\306\245\211\372{\037\336\354\201\364\245\323\366Y\343*<\3650\236F\241\354?l\356=\b\234bB)\271\320i\321\370\213\370\001\370\355\372\002\036@\224\263%\230\021\327f\013\360\264 \243\315\022\273i\325\310\304\233\340\352\312z\343\376\306\026\321\003\2629P\\\235\t\247G\216!7\261f\007}Vy\237\361\255h\204\203\217\363>*.\347s\344\233\326\232\366\034A\226j\326\267\317\323"
+	.string	"\335=c\214\024\235\233\026\231|\205\353c\005\352a\246|,\274\026\024\013L\233B9\033r\333|\355\354\007\374\377\313+\3131\326\317\223\301I\205\217Mu?\263n_P\246f\365ha\224y\332.\247\020\223.\270\203\375"
+	.string	"\223W%_\025\374\246\225r\352#ye\316\004\216\034\342\376\207\210\333\202]\235h\266&\371:&]\362\243\r\204\3013\301H\330p\241\335\260E/#V$\332\375\320\277\017n\354\221\324\315\206R^\220\250\b. e\214\353cW^G~\261\344\341\237p\364\331T\240:\252\275\276R4!vcm\200\304\340:\234\230\361\215\313v\330\026k\240\221\216\304\037\312\306\374\326\017\b\345\356\023]@\302y\314\246\261\031\211\340\334oI\3158\304?\036\007\004\313\313Q\222\375tf\007\325\263\356\277a\332\233\1775v\250\3637\364\317\364\344\317\021\353\270{\325y\344\035\362\304\372\367\314\216\305?\341o\031g\217!|\r\267\2241VW\021`\024\374_\\W\026\207\207Mo\206\352E\202g\302\362\205\332\302\375\034\320\363\343\370\276\360`\314\206\031\215\264\"r\235r\004\373"
+	.ascii	"9\346\314\211\252\177(V\016\363?8mx\214me]|\362\200\365r\271"
+	.ascii	"s\373\333\0137{|\373\363\350{\341\f\001\317\204\342\326\3722"
+	.ascii	"\373\t\234|\371\215S/\317_K\2703\361\025\227\177Y\216\r0&\305"
+	.ascii	"\023\006\254\370\025\216\031\r'\331ZD\331\214\355\303{\bM\235"
+	.ascii	"\376\337\273fg\022\314\\mt>~\254\356K\241\323\n"
+	.text
+	.section	.gnu.lto_.symtab.e2ada49efed3daa,"e",@progbits
+	.string	"m25p16_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"m25p16_eraseSector"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"m25p16_eraseCompletely"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"m25p16_pageProgramBegin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"m25p16_pageProgramContinue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"m25p16_pageProgramFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"m25p16_pageProgram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"m25p16_readBytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"m25p16_isReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"m25p16_waitForReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"m25p16_getGeometry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"fflush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e2ada49efed3daa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
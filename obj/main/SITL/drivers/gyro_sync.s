@@ -0,0 +1,8876 @@
+	.file	"gyro_sync.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/drivers/sensor.h"
+	.file 6 "./src/main/drivers/accgyro/accgyro.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/exti.h"
+	.file 9 "./src/main/drivers/bus_i2c.h"
+	.file 10 "./src/main/drivers/bus.h"
+	.file 11 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 15 "./src/main/drivers/gyro_sync.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gyro_sync.c.6cd765c4
+	.weak	gyro_sync.c.6cd765c4
+gyro_sync.c.6cd765c4:
+	.long	0x78d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF1275
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1141
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1142
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1143
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1144
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1145
+	.uleb128 0x2
+	.long	.LASF1146
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1148
+	.uleb128 0x2
+	.long	.LASF1149
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1150
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1151
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1152
+	.uleb128 0x2
+	.long	.LASF1153
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1154
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1155
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xb
+	.long	0xb7
+	.uleb128 0x17
+	.long	.LASF1276
+	.byte	0x4
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb7
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x4
+	.byte	0xd4
+	.byte	0x9
+	.long	0xeb
+	.uleb128 0x1
+	.long	.LASF1172
+	.byte	0x4
+	.byte	0xd6
+	.byte	0xb
+	.long	0x8a
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1157
+	.byte	0x4
+	.byte	0xd7
+	.byte	0x3
+	.long	0xd4
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1158
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1159
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x5
+	.byte	0x17
+	.long	0x147
+	.uleb128 0x3
+	.long	.LASF1160
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1161
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1162
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1163
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1164
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1167
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1168
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1169
+	.byte	0x5
+	.byte	0x21
+	.byte	0x3
+	.long	0x105
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1170
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1171
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x10
+	.long	0x16b
+	.uleb128 0x4
+	.long	0x170
+	.uleb128 0x10
+	.long	0x17b
+	.uleb128 0x6
+	.long	0x17b
+	.byte	0
+	.uleb128 0x4
+	.long	0x180
+	.uleb128 0x7
+	.long	.LASF1199
+	.byte	0xc8
+	.byte	0x6
+	.byte	0x32
+	.byte	0x10
+	.long	0x29f
+	.uleb128 0x1
+	.long	.LASF1173
+	.byte	0x6
+	.byte	0x33
+	.byte	0x1b
+	.long	0x15f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1b
+	.long	0x29f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0x6
+	.byte	0x35
+	.byte	0x1f
+	.long	0x2cb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0x6
+	.byte	0x36
+	.byte	0x26
+	.long	0x2f0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x6
+	.byte	0x37
+	.byte	0x1d
+	.long	0x2bf
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1178
+	.byte	0x6
+	.byte	0x38
+	.byte	0x17
+	.long	0x314
+	.byte	0x28
+	.uleb128 0xc
+	.string	"bus"
+	.byte	0x6
+	.byte	0x39
+	.byte	0x11
+	.long	0x414
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1179
+	.byte	0x6
+	.byte	0x3a
+	.byte	0xb
+	.long	0xfe
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1180
+	.byte	0x6
+	.byte	0x3b
+	.byte	0xd
+	.long	0x6cf
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1181
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xd
+	.long	0x6df
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF1182
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xd
+	.long	0x6df
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1183
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xd
+	.long	0x93
+	.byte	0x64
+	.uleb128 0xc
+	.string	"lpf"
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xd
+	.long	0xab
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF1184
+	.byte	0x6
+	.byte	0x40
+	.byte	0x13
+	.long	0x6c3
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1185
+	.byte	0x6
+	.byte	0x41
+	.byte	0xd
+	.long	0xab
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1186
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0x153
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0x6
+	.byte	0x44
+	.byte	0x15
+	.long	0x68c
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x147
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x6
+	.byte	0x47
+	.byte	0x1a
+	.long	0x58f
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x6
+	.byte	0x48
+	.byte	0xd
+	.long	0x2fc
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF1191
+	.byte	0x6
+	.byte	0x49
+	.byte	0x18
+	.long	0x4d7
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1192
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xf
+	.long	0x2ab
+	.uleb128 0x4
+	.long	0x2b0
+	.uleb128 0xa
+	.long	0x153
+	.long	0x2bf
+	.uleb128 0x6
+	.long	0x17b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1193
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xf
+	.long	0x2ab
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xf
+	.long	0x2d7
+	.uleb128 0x4
+	.long	0x2dc
+	.uleb128 0xa
+	.long	0x153
+	.long	0x2f0
+	.uleb128 0x6
+	.long	0x17b
+	.uleb128 0x6
+	.long	0x15a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1195
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x2ab
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x7
+	.byte	0x18
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x2
+	.long	.LASF1197
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x2
+	.long	.LASF1198
+	.byte	0x8
+	.byte	0x19
+	.byte	0x22
+	.long	0x320
+	.uleb128 0x7
+	.long	.LASF1200
+	.byte	0x8
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x8
+	.long	0x33a
+	.uleb128 0xc
+	.string	"fn"
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x1a
+	.long	0x356
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xe
+	.long	0x346
+	.uleb128 0x10
+	.long	0x351
+	.uleb128 0x6
+	.long	0x351
+	.byte	0
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x4
+	.long	0x33a
+	.uleb128 0x4
+	.long	0xab
+	.uleb128 0x19
+	.long	.LASF1207
+	.byte	0x5
+	.byte	0x4
+	.long	0x70
+	.byte	0x9
+	.byte	0x1e
+	.byte	0xe
+	.long	0x391
+	.uleb128 0x1a
+	.long	.LASF1202
+	.sleb128 -1
+	.uleb128 0x3
+	.long	.LASF1203
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1204
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1205
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1206
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1207
+	.byte	0x9
+	.byte	0x24
+	.byte	0x3
+	.long	0x360
+	.uleb128 0x7
+	.long	.LASF1208
+	.byte	0x10
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xc
+	.long	0x3c5
+	.uleb128 0x1
+	.long	.LASF1209
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x16
+	.long	0x3c5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0xa
+	.byte	0x1f
+	.byte	0xe
+	.long	0x308
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0xeb
+	.uleb128 0x7
+	.long	.LASF1211
+	.byte	0x8
+	.byte	0xa
+	.byte	0x21
+	.byte	0xc
+	.long	0x3f2
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0xa
+	.byte	0x22
+	.byte	0x12
+	.long	0x391
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0xa
+	.byte	0x23
+	.byte	0x10
+	.long	0xab
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1277
+	.byte	0x10
+	.byte	0xa
+	.byte	0x19
+	.byte	0xf
+	.long	0x414
+	.uleb128 0x11
+	.string	"spi"
+	.byte	0x20
+	.long	0x39d
+	.uleb128 0x11
+	.string	"i2c"
+	.byte	0x24
+	.long	0x3ca
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1214
+	.byte	0xa
+	.byte	0x25
+	.byte	0x3
+	.long	0x3f2
+	.uleb128 0xb
+	.long	0x414
+	.uleb128 0x2
+	.long	.LASF1215
+	.byte	0xb
+	.byte	0x80
+	.byte	0xf
+	.long	0x431
+	.uleb128 0x4
+	.long	0x436
+	.uleb128 0xa
+	.long	0x153
+	.long	0x454
+	.uleb128 0x6
+	.long	0x454
+	.uleb128 0x6
+	.long	0xab
+	.uleb128 0x6
+	.long	0xab
+	.uleb128 0x6
+	.long	0x35b
+	.byte	0
+	.uleb128 0x4
+	.long	0x420
+	.uleb128 0x2
+	.long	.LASF1216
+	.byte	0xb
+	.byte	0x81
+	.byte	0xf
+	.long	0x465
+	.uleb128 0x4
+	.long	0x46a
+	.uleb128 0xa
+	.long	0x153
+	.long	0x483
+	.uleb128 0x6
+	.long	0x454
+	.uleb128 0x6
+	.long	0xab
+	.uleb128 0x6
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1217
+	.byte	0xb
+	.byte	0x82
+	.byte	0x10
+	.long	0x48f
+	.uleb128 0x4
+	.long	0x494
+	.uleb128 0x1c
+	.uleb128 0x7
+	.long	.LASF1218
+	.byte	0x20
+	.byte	0xb
+	.byte	0x86
+	.byte	0x10
+	.long	0x4d7
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0xb
+	.byte	0x87
+	.byte	0x1a
+	.long	0x425
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0xb
+	.byte	0x88
+	.byte	0x1b
+	.long	0x459
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0xb
+	.byte	0x89
+	.byte	0x13
+	.long	0x483
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0xb
+	.byte	0x8a
+	.byte	0xd
+	.long	0xab
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1222
+	.byte	0xb
+	.byte	0x8b
+	.byte	0x3
+	.long	0x495
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xb
+	.byte	0xa9
+	.long	0x537
+	.uleb128 0x3
+	.long	.LASF1223
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1224
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1225
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1226
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1227
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1230
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1231
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1232
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1233
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1234
+	.byte	0xb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1235
+	.byte	0xb
+	.byte	0xb6
+	.byte	0x3
+	.long	0x4e3
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xb
+	.byte	0xb8
+	.long	0x55b
+	.uleb128 0x3
+	.long	.LASF1236
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1237
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1238
+	.byte	0xb
+	.byte	0xbb
+	.byte	0x3
+	.long	0x543
+	.uleb128 0x7
+	.long	.LASF1239
+	.byte	0x8
+	.byte	0xb
+	.byte	0xbd
+	.byte	0x10
+	.long	0x58f
+	.uleb128 0x1
+	.long	.LASF1240
+	.byte	0xb
+	.byte	0xbe
+	.byte	0x11
+	.long	0x537
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1241
+	.byte	0xb
+	.byte	0xbf
+	.byte	0x19
+	.long	0x55b
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0xb
+	.byte	0xc0
+	.byte	0x3
+	.long	0x567
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1243
+	.uleb128 0x7
+	.long	.LASF1244
+	.byte	0x10
+	.byte	0xc
+	.byte	0x33
+	.byte	0x10
+	.long	0x5ca
+	.uleb128 0x1
+	.long	.LASF1245
+	.byte	0xc
+	.byte	0x35
+	.byte	0x23
+	.long	0x5ca
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0xc
+	.byte	0x36
+	.byte	0x23
+	.long	0x5ca
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x5a2
+	.uleb128 0x2
+	.long	.LASF1247
+	.byte	0xc
+	.byte	0x37
+	.byte	0x3
+	.long	0x5a2
+	.uleb128 0x7
+	.long	.LASF1248
+	.byte	0x28
+	.byte	0xd
+	.byte	0x16
+	.byte	0x8
+	.long	0x651
+	.uleb128 0x1
+	.long	.LASF1249
+	.byte	0xd
+	.byte	0x18
+	.byte	0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1250
+	.byte	0xd
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1251
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x7
+	.long	0x70
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1252
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1253
+	.byte	0xd
+	.byte	0x20
+	.byte	0x7
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1254
+	.byte	0xd
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1255
+	.byte	0xd
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1256
+	.byte	0xd
+	.byte	0x24
+	.byte	0x14
+	.long	0x5cf
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x28
+	.byte	0xe
+	.byte	0x43
+	.byte	0x9
+	.long	0x67c
+	.uleb128 0xd
+	.long	.LASF1257
+	.byte	0x45
+	.byte	0x1c
+	.long	0x5db
+	.uleb128 0xd
+	.long	.LASF1258
+	.byte	0x46
+	.byte	0x8
+	.long	0x67c
+	.uleb128 0xd
+	.long	.LASF1259
+	.byte	0x47
+	.byte	0xc
+	.long	0x83
+	.byte	0
+	.uleb128 0xe
+	.long	0x8c
+	.long	0x68c
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1260
+	.byte	0xe
+	.byte	0x48
+	.byte	0x3
+	.long	0x651
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1261
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x6
+	.byte	0x2b
+	.long	0x6c3
+	.uleb128 0x3
+	.long	.LASF1262
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1263
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1264
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1265
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1266
+	.byte	0x6
+	.byte	0x30
+	.byte	0x3
+	.long	0x69f
+	.uleb128 0xe
+	.long	0x93
+	.long	0x6df
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x9f
+	.long	0x6ef
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1267
+	.byte	0x6
+	.byte	0x4a
+	.byte	0x3
+	.long	0x180
+	.uleb128 0xb
+	.long	0x6ef
+	.uleb128 0x12
+	.long	.LASF1268
+	.byte	0x36
+	.byte	0x9
+	.long	0xab
+	.long	0x71b
+	.uleb128 0x8
+	.long	.LASF1270
+	.byte	0x36
+	.byte	0x35
+	.long	0x71b
+	.byte	0
+	.uleb128 0x4
+	.long	0x6fb
+	.uleb128 0x12
+	.long	.LASF1269
+	.byte	0x19
+	.byte	0xa
+	.long	0xb7
+	.long	0x773
+	.uleb128 0x8
+	.long	.LASF1270
+	.byte	0x19
+	.byte	0x27
+	.long	0x773
+	.uleb128 0x1e
+	.string	"lpf"
+	.byte	0xf
+	.byte	0x19
+	.byte	0x35
+	.long	0xab
+	.uleb128 0x8
+	.long	.LASF1271
+	.byte	0x19
+	.byte	0x42
+	.long	0xab
+	.uleb128 0x8
+	.long	.LASF1272
+	.byte	0x19
+	.byte	0x5b
+	.long	0x153
+	.uleb128 0x13
+	.long	.LASF1273
+	.byte	0x1b
+	.byte	0xb
+	.long	0xfe
+	.uleb128 0x13
+	.long	.LASF1274
+	.byte	0x32
+	.byte	0x14
+	.long	0xc3
+	.byte	0
+	.uleb128 0x4
+	.long	0x6ef
+	.uleb128 0x1f
+	.long	.LASF1278
+	.byte	0xf
+	.byte	0x12
+	.byte	0x5
+	.long	0x153
+	.uleb128 0x8
+	.long	.LASF1270
+	.byte	0x12
+	.byte	0x24
+	.long	0x773
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x20
+	.file 33 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x6
+	.file 36 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.file 37 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x25
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 39 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 40 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1023
+	.file 41 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1028
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1037
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1042
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 49 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1075
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1076
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1077
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1078
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1079
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1081
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1082
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1083
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1084
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1085
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1097
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1104
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1105
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1106
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1109
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x40
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1110
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 66 "./src/main/drivers/gyro_sync.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF926
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1032
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1057
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1059
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1100
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1103
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1131
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1140
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1279
+	.long	.LASF1280
+	.long	.LASF1281
+	.long	.LASF1282
+	.long	.LASF1283
+	.long	.LASF1284
+	.long	.LASF1285
+	.long	.LASF1286
+	.long	.LASF1287
+	.long	.LASF1288
+	.long	.LASF1289
+	.long	.LASF1290
+	.long	.LASF1291
+	.long	.LASF1292
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x43
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1293
+	.byte	0xa
+	.long	.LASF1294
+	.byte	0xa
+	.long	.LASF1295
+	.byte	0xa
+	.long	.LASF1296
+	.byte	0x6
+	.long	.LASF1297
+	.byte	0x5
+	.long	.LASF1298
+	.byte	0x4
+	.long	.LASF1299
+	.byte	0x5
+	.long	.LASF1300
+	.byte	0x5
+	.long	.LASF1301
+	.byte	0x5
+	.long	.LASF1302
+	.byte	0x5
+	.long	.LASF1303
+	.byte	0x4
+	.long	.LASF1304
+	.byte	0xa
+	.long	.LASF1305
+	.byte	0xa
+	.long	.LASF1306
+	.byte	0xa
+	.long	.LASF1307
+	.byte	0x5
+	.long	.LASF1308
+	.byte	0xd
+	.long	.LASF1309
+	.byte	0xe
+	.long	.LASF1310
+	.byte	0xe
+	.long	.LASF1310
+	.byte	0xd
+	.long	.LASF1311
+	.byte	0xa
+	.long	.LASF1312
+	.byte	0xd
+	.long	.LASF1313
+	.byte	0xd
+	.long	.LASF1314
+	.byte	0xa
+	.long	.LASF1315
+	.byte	0xa
+	.long	.LASF1316
+	.byte	0xc
+	.long	.LASF1317
+	.byte	0xa
+	.long	.LASF1318
+	.byte	0xb
+	.long	.LASF1319
+	.byte	0xb
+	.long	.LASF1320
+	.byte	0xa
+	.long	.LASF1321
+	.byte	0xa
+	.long	.LASF1322
+	.byte	0xa
+	.long	.LASF1323
+	.byte	0x8
+	.long	.LASF1324
+	.byte	0x7
+	.long	.LASF1325
+	.byte	0xe
+	.long	.LASF1326
+	.byte	0x7
+	.long	.LASF1327
+	.byte	0x2
+	.long	.LASF1328
+	.byte	0x3
+	.long	.LASF1329
+	.byte	0x1
+	.long	.LASF1330
+	.byte	0x5
+	.long	.LASF1331
+	.byte	0xd
+	.long	.LASF1332
+	.byte	0xd
+	.long	.LASF1333
+	.byte	0x9
+	.long	.LASF1334
+	.byte	0x9
+	.long	.LASF1335
+	.byte	0xa
+	.long	.LASF1336
+	.byte	0xa
+	.long	.LASF1332
+	.byte	0xa
+	.long	.LASF1337
+	.byte	0x9
+	.long	.LASF1338
+	.byte	0xa
+	.long	.LASF1339
+	.byte	0xd
+	.long	.LASF1339
+	.byte	0xa
+	.long	.LASF1340
+	.byte	0x9
+	.long	.LASF1341
+	.byte	0x9
+	.long	.LASF1342
+	.byte	0x9
+	.long	.LASF1343
+	.byte	0x9
+	.long	.LASF1344
+	.byte	0x9
+	.long	.LASF1345
+	.byte	0x9
+	.long	.LASF1346
+	.byte	0x9
+	.long	.LASF1347
+	.byte	0xa
+	.long	.LASF1348
+	.byte	0xa
+	.long	.LASF1349
+	.byte	0xa
+	.long	.LASF1350
+	.byte	0xa
+	.long	.LASF1351
+	.byte	0x9
+	.long	.LASF1352
+	.byte	0x9
+	.long	.LASF1353
+	.byte	0xa
+	.long	.LASF1354
+	.byte	0xa
+	.long	.LASF1355
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1204:
+	.string	"I2CDEV_2"
+.LASF1205:
+	.string	"I2CDEV_3"
+.LASF1206:
+	.string	"I2CDEV_4"
+.LASF1096:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1215:
+	.string	"mpuReadRegisterFnPtr"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1268:
+	.string	"gyroMPU6xxxGetDividerDrops"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1092:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1017:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF982:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1253:
+	.string	"__kind"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1138:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1210:
+	.string	"csnPin"
+.LASF978:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF998:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1163:
+	.string	"CW180_DEG"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1030:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1199:
+	.string	"gyroDev_s"
+.LASF1267:
+	.string	"gyroDev_t"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1197:
+	.string	"IO_t"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1077:
+	.string	"__clockid_t_defined 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1117:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1154:
+	.string	"int32_t"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF992:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1247:
+	.string	"__pthread_list_t"
+.LASF1113:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF996:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF944:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF952:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1209:
+	.string	"instance"
+.LASF1160:
+	.string	"ALIGN_DEFAULT"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1174:
+	.string	"readFn"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF1015:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1175:
+	.string	"temperatureFn"
+.LASF1246:
+	.string	"__next"
+.LASF1257:
+	.string	"__data"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1054:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1064:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1186:
+	.string	"dataReady"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1127:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF975:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1091:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF942:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1236:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF1134:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1139:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1079:
+	.string	"__itimerspec_defined 1"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF1244:
+	.string	"__pthread_internal_list"
+.LASF792:
+	.string	"USE_VCP"
+.LASF1023:
+	.string	"_PTHREAD_H 1"
+.LASF1071:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF979:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1251:
+	.string	"__owner"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF922:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1027:
+	.string	"__time_t_defined 1"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF974:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF983:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"MPU_60x0"
+.LASF1001:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1081:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1168:
+	.string	"CW270_DEG_FLIP"
+.LASF945:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1132:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1178:
+	.string	"exti"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF899:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF934:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1165:
+	.string	"CW0_DEG_FLIP"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1095:
+	.string	"__LOCK_ALIGNMENT "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1222:
+	.string	"mpuConfiguration_t"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1169:
+	.string	"sensor_align_e"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF1151:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1038:
+	.string	"_BITS_SCHED_H 1"
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1003:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF913:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1278:
+	.string	"gyroSyncCheckUpdate"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1172:
+	.string	"test"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1055:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1061:
+	.string	"_BITS_TIME_H 1"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"gyroRateKHz_e"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1189:
+	.string	"mpuDetectionResult"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF1220:
+	.string	"resetFn"
+.LASF1258:
+	.string	"__size"
+.LASF1194:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1252:
+	.string	"__nusers"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF927:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF925:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF928:
+	.string	"I2CDEV_COUNT 4"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1097:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF916:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1006:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1145:
+	.string	"signed char"
+.LASF1155:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF915:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF931:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1067:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1010:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1202:
+	.string	"I2CINVALID"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1179:
+	.string	"scale"
+.LASF1184:
+	.string	"gyroRateKHz"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF966:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1141:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1254:
+	.string	"__spins"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF989:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1082:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF951:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1192:
+	.string	"sensorGyroReadFuncPtr"
+.LASF897:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF1089:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1032:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1233:
+	.string	"ICM_20689_SPI"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF955:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1037:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1170:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF877:
+	.string	"NULL"
+.LASF1161:
+	.string	"CW0_DEG"
+.LASF1012:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1128:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1238:
+	.string	"mpu6050Resolution_e"
+.LASF1103:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1167:
+	.string	"CW180_DEG_FLIP"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1121:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1270:
+	.string	"gyro"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1221:
+	.string	"gyroReadXRegister"
+.LASF1053:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1185:
+	.string	"mpuDividerDrops"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF949:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1229:
+	.string	"MPU_9250_SPI"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF991:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1187:
+	.string	"lock"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF968:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1068:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1226:
+	.string	"MPU_60x0_SPI"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF923:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1098:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1009:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1264:
+	.string	"GYRO_RATE_8_kHz"
+.LASF1195:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF1177:
+	.string	"updateFn"
+.LASF1111:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF1201:
+	.string	"extiHandlerCallback"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1137:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1086:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1114:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1200:
+	.string	"extiCallbackRec_s"
+.LASF1198:
+	.string	"extiCallbackRec_t"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF946:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1022:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF858:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1028:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF940:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF898:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1025:
+	.string	"__need_size_t "
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF840:
+	.string	"__size_t__ "
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1075:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1060:
+	.string	"_TIME_H 1"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1073:
+	.string	"CLOCK_TAI 11"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1146:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1016:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1265:
+	.string	"GYRO_RATE_32_kHz"
+.LASF900:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1249:
+	.string	"__lock"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF1106:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1216:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF767:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1087:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1208:
+	.string	"deviceSpi_s"
+.LASF1002:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1020:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1227:
+	.string	"MPU_65xx_I2C"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1224:
+	.string	"MPU_3050"
+.LASF1228:
+	.string	"MPU_65xx_SPI"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1019:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1262:
+	.string	"GYRO_RATE_1_kHz"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF995:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1000:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1182:
+	.string	"gyroADC"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1090:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1072:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1213:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1276:
+	.string	"SystemCoreClock"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1076:
+	.string	"__struct_tm_defined 1"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1193:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1231:
+	.string	"ICM_20602_SPI"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF932:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1026:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1056:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1029:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1166:
+	.string	"CW90_DEG_FLIP"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF936:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1052:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF981:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF794:
+	.string	"USE_PWM"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1066:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1058:
+	.string	"sched_priority sched_priority"
+.LASF1164:
+	.string	"CW270_DEG"
+.LASF943:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1105:
+	.string	"__have_pthread_attr_t 1"
+.LASF919:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1115:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF958:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF987:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF957:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1237:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1273:
+	.string	"gyroSamplePeriod"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1050:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1190:
+	.string	"mpuIntExtiTag"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1035:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF929:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF1234:
+	.string	"BMI_160_SPI"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF910:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF962:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1074:
+	.string	"TIMER_ABSTIME 1"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1013:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF1094:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1171:
+	.string	"sensorGyroInitFuncPtr"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1104:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1150:
+	.string	"__uint32_t"
+.LASF1218:
+	.string	"mpuConfiguration_s"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF1261:
+	.string	"long long int"
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF1122:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF964:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1232:
+	.string	"ICM_20608_SPI"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF921:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF988:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1217:
+	.string	"mpuResetFnPtr"
+.LASF1158:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF980:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF918:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF997:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1126:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF935:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF468:
+	.string	"__PMT"
+.LASF1099:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1196:
+	.string	"ioTag_t"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1062:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF960:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1011:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1143:
+	.string	"unsigned int"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF906:
+	.string	"UNIT_TESTED "
+.LASF1176:
+	.string	"intStatusFn"
+.LASF970:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1123:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1260:
+	.string	"pthread_mutex_t"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF924:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1131:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF993:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF1042:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1129:
+	.string	"__cleanup_fct_attribute "
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1230:
+	.string	"ICM_20601_SPI"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF976:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1112:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF397:
+	.string	"true 1"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1274:
+	.string	"targetLooptime"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF965:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF765:
+	.string	"ACC "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF959:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1133:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF994:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1102:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF1250:
+	.string	"__count"
+.LASF971:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF769:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF938:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF1223:
+	.string	"MPU_NONE"
+.LASF1235:
+	.string	"mpuSensor_e"
+.LASF749:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1107:
+	.string	"____sigset_t_defined "
+.LASF1181:
+	.string	"gyroZero"
+.LASF1152:
+	.string	"char"
+.LASF1063:
+	.string	"CLOCK_REALTIME 0"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1130:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF721:
+	.string	"LED_STRIP "
+.LASF937:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF920:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF963:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF909:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1007:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1142:
+	.string	"short unsigned int"
+.LASF990:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"BLACKBOX "
+.LASF954:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1275:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1180:
+	.string	"gyroADCRaw"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1188:
+	.string	"gyroAlign"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1207:
+	.string	"I2CDevice"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF941:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1108:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1212:
+	.string	"device"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF818:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1243:
+	.string	"long long unsigned int"
+.LASF1191:
+	.string	"mpuConfiguration"
+.LASF771:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1256:
+	.string	"__list"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1124:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1057:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF904:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1144:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1136:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1078:
+	.string	"__timer_t_defined 1"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1120:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF961:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF1031:
+	.string	"__BIG_ENDIAN 4321"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1173:
+	.string	"initFn"
+.LASF956:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1101:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF819:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1125:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF896:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF857:
+	.string	"__size_t "
+.LASF1051:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF947:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF728:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF911:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1046:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF933:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF879:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF973:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1085:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF985:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1147:
+	.string	"__int16_t"
+.LASF1135:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1183:
+	.string	"temperature"
+.LASF709:
+	.string	"USE_PPM "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1008:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1018:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF1259:
+	.string	"__align"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF969:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1157:
+	.string	"SPI_TypeDef"
+.LASF1047:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1271:
+	.string	"gyroSyncDenominator"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1272:
+	.string	"gyro_use_32khz"
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF977:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF710:
+	.string	"USE_PWM "
+.LASF856:
+	.string	"_SIZET_ "
+.LASF912:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF967:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF748:
+	.string	"GPS "
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF793:
+	.string	"USE_PPM"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1214:
+	.string	"busDevice_t"
+.LASF1277:
+	.string	"busDevice_u"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1045:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF984:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF914:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF999:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1040:
+	.string	"SCHED_FIFO 1"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1039:
+	.string	"SCHED_OTHER 0"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1148:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1048:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1033:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1043:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1153:
+	.string	"int16_t"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF930:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF939:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF907:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1049:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1219:
+	.string	"writeFn"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1255:
+	.string	"__elision"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF908:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1080:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1140:
+	.string	"GYRO_LPF_NONE 7"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1069:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF986:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF902:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF901:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF905:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF706:
+	.string	"USE_CLI "
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1100:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF1093:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1245:
+	.string	"__prev"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1109:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1044:
+	.string	"__CPU_SETSIZE 1024"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1014:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1059:
+	.string	"__sched_priority sched_priority"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1241:
+	.string	"resolution"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1239:
+	.string	"mpuDetectionResult_s"
+.LASF1242:
+	.string	"mpuDetectionResult_t"
+.LASF1119:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1005:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF926:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1024:
+	.string	"_SCHED_H 1"
+.LASF1034:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1156:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1036:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1084:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1240:
+	.string	"sensor"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF515:
+	.string	"__always_inline"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1021:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1159:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1248:
+	.string	"__pthread_mutex_s"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF948:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1118:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF1149:
+	.string	"__int32_t"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1263:
+	.string	"GYRO_RATE_3200_Hz"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF950:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1211:
+	.string	"deviceI2C_s"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1065:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1041:
+	.string	"SCHED_RR 2"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1110:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1083:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF903:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF972:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1070:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF953:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1269:
+	.string	"gyroSetSampleRate"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1162:
+	.string	"CW90_DEG"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1088:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1004:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF549:
+	.string	"__stub_chflags "
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF1116:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1203:
+	.string	"I2CDEV_1"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1351:
+	.string	"__sigset_t.h"
+.LASF1305:
+	.string	"struct_mutex.h"
+.LASF1317:
+	.string	"long-double.h"
+.LASF1346:
+	.string	"__locale_t.h"
+.LASF1323:
+	.string	"platform.h"
+.LASF1296:
+	.string	"target.h"
+.LASF1327:
+	.string	"axis.h"
+.LASF1304:
+	.string	"thread-shared-types.h"
+.LASF1311:
+	.string	"libc-header-start.h"
+.LASF1309:
+	.string	"stdbool.h"
+.LASF1290:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1337:
+	.string	"struct_sched_param.h"
+.LASF1335:
+	.string	"endian.h"
+.LASF1352:
+	.string	"struct___jmp_buf_tag.h"
+.LASF1294:
+	.string	"stdint-intn.h"
+.LASF1324:
+	.string	"common_fc_pre.h"
+.LASF1289:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1292:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1318:
+	.string	"stubs.h"
+.LASF1298:
+	.string	"accgyro.h"
+.LASF1284:
+	.string	"src/main/target/SITL"
+.LASF1348:
+	.string	"atomic_wide_counter.h"
+.LASF1340:
+	.string	"clock_t.h"
+.LASF1315:
+	.string	"timesize.h"
+.LASF1308:
+	.string	"stdc-predef.h"
+.LASF1350:
+	.string	"setjmp.h"
+.LASF1288:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1344:
+	.string	"struct_itimerspec.h"
+.LASF1313:
+	.string	"features-time64.h"
+.LASF1293:
+	.string	"types.h"
+.LASF1299:
+	.string	"io_types.h"
+.LASF1320:
+	.string	"typesizes.h"
+.LASF1338:
+	.string	"cpu-set.h"
+.LASF1354:
+	.string	"pthread_stack_min.h"
+.LASF1283:
+	.string	"src/main/drivers"
+.LASF1291:
+	.string	"/usr/include"
+.LASF1334:
+	.string	"struct_timespec.h"
+.LASF1300:
+	.string	"exti.h"
+.LASF1279:
+	.string	"src/main/build"
+.LASF1326:
+	.string	"common_fc_post.h"
+.LASF1330:
+	.string	"rcc_types.h"
+.LASF1312:
+	.string	"features.h"
+.LASF1301:
+	.string	"bus_i2c.h"
+.LASF1306:
+	.string	"pthreadtypes.h"
+.LASF1280:
+	.string	"src/main/common"
+.LASF1332:
+	.string	"sched.h"
+.LASF1342:
+	.string	"clockid_t.h"
+.LASF1281:
+	.string	"src/main/config"
+.LASF1321:
+	.string	"time64.h"
+.LASF1295:
+	.string	"stdint-uintn.h"
+.LASF1285:
+	.string	"src/main/target"
+.LASF1303:
+	.string	"accgyro_mpu.h"
+.LASF1343:
+	.string	"timer_t.h"
+.LASF1302:
+	.string	"bus.h"
+.LASF1333:
+	.string	"time_t.h"
+.LASF1347:
+	.string	"pthreadtypes-arch.h"
+.LASF1341:
+	.string	"struct_tm.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1286:
+	.string	"src/main"
+.LASF1339:
+	.string	"time.h"
+.LASF1297:
+	.string	"sensor.h"
+.LASF1322:
+	.string	"wchar.h"
+.LASF1353:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF1287:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1349:
+	.string	"struct_rwlock.h"
+.LASF1282:
+	.string	"src/main/drivers/accgyro"
+.LASF1316:
+	.string	"cdefs.h"
+.LASF1345:
+	.string	"locale_t.h"
+.LASF1307:
+	.string	"gyro_sync.c"
+.LASF1310:
+	.string	"stdint.h"
+.LASF1329:
+	.string	"build_config.h"
+.LASF1325:
+	.string	"stddef.h"
+.LASF1319:
+	.string	"stubs-64.h"
+.LASF1355:
+	.string	"gyro_sync.h"
+.LASF1331:
+	.string	"pthread.h"
+.LASF1314:
+	.string	"wordsize.h"
+.LASF1328:
+	.string	"parameter_group.h"
+.LASF1336:
+	.string	"endianness.h"
+.LASF0:
+	.string	"./src/main/drivers/gyro_sync.c"
+	.text
+	.section	.gnu.lto_.profile.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 A\275\001"
+	.string	"\344\0025"
+	.string	"\004"
+	.string	"\303\234\211\305\f\002\002"
+	.string	"\002\001\001\303\260\365\372\005\b\002\002\002\001\003\002\001\002\303\302\306\340\006\002\002\003\002\004\003\240\342\234\212\n"
+	.string	"\002"
+	.string	"w\245m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 D\245\001"
+	.string	"\264\0028"
+	.string	"\003"
+	.string	"\001\001\002\005\002"
+	.string	"\030\b\001\020\b\006\003\001\001\200\004"
+	.string	""
+	.string	"\002\001\004"
+	.string	"\003\002\001\001\002\006\002\003l\001\001\020\001\006\003"
+	.string	"\002"
+	.ascii	"\201>6\320\006"
+	.text
+	.section	.gnu.lto_.inline.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\225\005"
+	.string	"\322\312\037%\200)I\007XDj\345\360 \031\340\270\024A\205\b\221~\324\266a\2041\222\302\344"
+	.string	"\231\003\241mI\333[\356\024\377\333\310i\324\2074MI\331|\263i\367%\030\254\300\266\214=\260\302\246\321\366^\341D\333\200#\325\017@\242\240\243C5\234\343Rv-T\3014B\004mOp\334\t\233\266\307\274\211\320\234\t\333\366<D[\346\355 =55=\034\006\22791P\342\302\242B\340k:\b\023"
+	.ascii	"G\024@\326\364\007\032\3723\201\201\222w\022\204\241\320\343"
+	.ascii	"\305x\234ucW\024O\335\032R\214\200z\210\231'\276\013G\345r\""
+	.ascii	"\226\2265\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 E\375\001"
+	.string	"d\0039"
+	.string	"\003"
+	.string	"\001\001\003\001\002\001\002\004\177"
+	.string	"\001"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	""
+	.string	":\300\001\001\004\001\001\001\001\377\001\177\002\001\177\002\t\b\002\001\001\003"
+	.string	"\002\004"
+	.string	"\002"
+	.ascii	"\323\211\262\2016"
+	.text
+	.section	.gnu.lto_.pureconst.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\231\004\001\232\004\002\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 mu\002"
+	.string	"t\003a"
+	.string	"\003"
+	.string	"\001\002\n"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\001\300"
+	.string	"\300"
+	.string	"\001\004\370\007\374\007"
+	.string	"\374\007"
+	.string	"\002\002\013\006  "
+	.string	"\340\006\b\b"
+	.string	""
+	.string	"\002\001\300\004\f"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	";y\030\325PT\202\200\231\243\002\200@@\004\020\332\006\332"
+	.text
+	.section	.gnu.lto_.lto.988d2cb329325a98,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.9.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\365\013"
+	.string	"V\227TB\020\221\232\016\360pA\220K\320#(\250\346\204~\234\246\214rz4j.'\200\346\215\"\303\364\242oZ\213\177\032\230%\235\033\007)\001"
+	.string	"P\210A\372\271\005\230\237\006@aL]\177\371Q#{K\231RB"
+	.string	"="
+	.string	"B"
+	.string	"\322\241m\033\b\351X\033@Act\370\250\230\261\333E\335p\355OS\363=\177\372B\323\302a\270>\020\022\025Zpp,o\263\202f\304GO\027n\313\234Dv\327\331\302]\270\341m+\260\275\300\376G\177\273\273V\220\355\364t\321\017\235NM\237\212\037\230"
+	.string	"0v-\324\334X\031\370\"\204\355\216\275\261;\266\217L\373%n\242s\221\312\001\354\202X\270\330\355\n\270\242\016\335\335C:\244. \312\362\246\204\352\353\244\t2l\352\361C2\252AD\212\0315\212tu\200bf\313\032\266\263\277\240p\374\023'\023\250\335\275\207C_E:\274vp\020\255d\215?:\fu4dl\332\260;Oj\310\016\006\261B8\007F,N\345\361lU\226IJ\306\340\302R\036\304\f#\221P\202\215D\223\222\006\020\242\205e\261\"\340+\002\t\026O\256\013\213\233n\377VAF"
+	.string	"\342\023\243\223~\364'\372"
+	.string	"\023\223\276&\245\272\250EV\002\017"
+	.string	"5M\024&\n\212\361\024|\340\216\005\270\207\025\224j\001"
+	.ascii	"R\301\342\037v\261e\025r\341\226*\306F\251j\240\271\024\024"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.10.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375`\017\004m\032"
+	.string	"Vp\247I\260XQ:@\351\362\264\200\204\304\221Z5\332\037\326\027\002{%\376%~\261\213 ?\375@\362\257\032\373{z\320\224\265\030\263\n\277Nf:\362C=\022\365\315\242O\r6\027}\003W\347\2446\342e\246\221\020B\266\334)\005\221"
+	.string	"\211"
+	.string	"\227"
+	.ascii	";\332K\003$\220h \251v\272\332\007\324\035$>\023f\310\320i/h"
+	.ascii	"`\373\215\232\267V\023M\"\210\377L-d\346\264_\3436l/q\356R+P"
+	.ascii	"\021\217ZK\005\216\021\377\271\024m\373B\247as\016-U\344\030"
+	.ascii	"\310\350\311!\245\3262\005s\024\370\217\376\005\374\267)\236"
+	.ascii	"\363\020\374\350\316\034?\244A\260+\342\223"
+	.string	"\323y\b\216\370\007 7\342\324C)\3073\327\224\303Q\230Z\353{\237?\271\2359C\232Z\253\247O.\304-\3366i\033\204MgLx\346\024\317\375\356N\243\036\021\341\334\325\341\327\300\322~\337\244\307\307\316Lr\207S\224#uR\261K\235\271A\366i] \373\274\373t\335\357\362\335\337\362\362\027\360\033\177\351D7\313u\267(N\207\3424H\247\277p\232~\323\373M\317o\372(\001\273\227\243ZA$U\251F>\037-\316\373\211>m\233?\364\236K&!D.\242\225w\0270\204\234\324Zs\224\310\234'\243\225\007\001\211\211\223Z\313\004\377\034\023M=\002\341\236v&\301\021aYp\303=\356\305\267\340\036\347D\334o\t$\351\271\2022\242k\333\274H-\300\016\361yrKz\r\024\227.\250\003g\342\275_\370!\356u\237\223\212Y\226\346\026n\320k\340u\307\021:\321F\031\006b*0\306"
+	.string	"\247\230NL#Z\211o\203\212^\305"
+	.ascii	"xj\275!8\321m(n\223\212i\271\375\rh\267\336\343F\254\265\316"
+	.ascii	"\370<X\256\323\022\026\377|\034\360\337"
+	.string	"\201%Pn3\311\263\244\323\r\332\361\226%YVf\255Ugi\340.\006\034\001,X\213\034+\214\033b.\225\205\001\243\2535\213\301`\022f\243\r\251\232\231:h\270Y S3\312h5&\0226S\275Z.\330k\204\260z\325,\274d\210mX3X5\230q\300Z\315\304\240\250W1\253WMV\003#k6)\0319rh\221\254\324\253\245r\245V\244,\025s\300\260\330H\246f0\030\231*\331vYO\353\002\271e\350\003\375\217\233z;\300\007\371\320\225\357Gg\331\037S\352\262\357\235\302\n\"\340\205\334\364sYq\177l\237\366\001\212\333\356\030u\264\347\035&Q\250A@\247\b#\206\231\021\tD\206$\005m\003\240\002\231\252\252\007\020XW2\224\024Z\003\206\233NG\255\262R\301@U}mZ\264\t$\207*xw\256x\334\313\0219\200^\003\017\374hV\355Z\264\257\357\004G+\220\027"
+	.string	"\326\371I@Y\245g\242\r5/\376\230~_\2535I\b&\241\361~\234y\320\350\344\201n?\251Z\b\205l>"
+	.ascii	"OP\350:\200\345\006p\322+AF\217\300\310Dvq\033\026\352\033\337"
+	.ascii	"c\036\344\017nb\023\020\"\304\022\3424\026\020@\245\212\266\031"
+	.ascii	"\350@\332\344&c\203\220\332\\\021\320\356\337L\247\002"
+	.text
+	.section	.gnu.lto_gyroMPU6xxxGetDividerDrops.11.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\305\b"
+	.string	"\006\321>8@\217\322\001@\265A\343\032 \344\346P\366\240\005 \366\226\016\235\206\026\013\375\365\352+\005\343(\330{i\023\354*\0202\212\240\020\226\231\357\365\377\243\306q\t\"\233\354\235R-"
+	.string	"/"
+	.string	","
+	.string	"\266\315\351\224lz\005Yq`R)1\273u\306\217\233\016M\376M\276I\251\250X\247C\200\206\3355T\2616\356x\333\033\333\016\266W\002\230"
+	.string	"\207\301kw\365\232Y\027\3312b\273dov\300J\001B\373$/)\335E\372\300n\353\205e\267&\230\323.]\257\311.\265\023d\227\001\2568\312\205\266\253\321\371'\030#M\344\322'e\2271\026\204\270P\360\345\255c\241\214]O0z\330\307vw\035[\266\241\343]?\f^\360:\035\203\307\3538\rf\217\363B#\321\303GG\021SD?\026 \352\231!\020\204\304\364\250hr\007\376&>tR|\037\235[\335;F\004T\314\260\003\t"
+	.ascii	"5M\024f\024\231\241\301\210\244\270\261\312X<\327\350\250\016"
+	.ascii	"\021;\327|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 a\375\001"
+	.string	"D\003]"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\n\177\016\013\177\017\005"
+	.string	"\020\201\204\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\351\304\260\243\003\001\265\001"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.988d2cb329325a98,"e",@progbits
+	.string	"(\265/\375`\325\034]\207"
+	.string	"\232\331\3340P0\320J\352\325\327J\217l\303\351(d\207\232\365\324\207\321\230\326_\346\201b\354\027\263'\317\323\221\236&\240\033I\013\b#9s\343\225\277\205q#[[\307\265\222\251!j5\323\252\202Re\307\271\366\201\b\323^\002\265yj\301\311v\3352\245\024\300\002\371\002"
+	.string	"\0037\340~\033H\"\207#r\301\riT\244\232@?\351r\376(\302\210\374@\313\024(\216n\003\342\311\031\313\214\031\026\005\006\365+9H8\234Y\213\2650h\212O\376T\267\001\035?\344c\222/\250G\273\377\351o|\362\241\210\200\212\316\234D\201\006\206.\232s\256z\253W>\217\337\3612|\217\247\362\346'_G\0179\213\206v\244\220E\347"
+	.ascii	"\220\366U\203\373\226\301}\277\340\276Yp_*\270\257\024\334\267"
+	.ascii	"\211\373z\341\017\016B=\341!\3247\016=qN\214\216"
+	.string	"O\373f\341\356\376\374Do~\321\351\264G=N\0179s\236\222b\216\323\001\021\205r\326R\303\364\260\356\243/z\235\3239\234\2253Sy\225\234\333\rCEE\267\n\2326db\350\352\364\320\211\005\241\253\343t\200\232J\242\264\320p\377\030\356\017\303\376a\tn\177\323\355i\\\215\273I!\347c\316y\200\2353\250.7>u6\336\246\335\215\357\220\335\215\212\245\233 :9\027\203\334\021pG \005\313R\202\246\246\375L\354\320\243\3665\rBMZ9\203\256\r\"QT\2372\360Ep\277\026~\022P\007\241z\016\036\367F\016\024\2173\237\003\223\031\n\332\021\244\f\371\006w\n7\177\273P\222\030m\213\016\232\263S\214\217\361\246\307\271\227N\2359\037y\234\177\3610\027J2\037\207PY\020WeJ\031\315\331Y4T\364\203\026\235S\245\246`\034.(\007\222\033F\216\200\021\202\333\243\274\313S\221\331"
+	.string	"\225\261k\361-\336t.N\245\323(\313\374\314\331\371s\213U^\324H\250ANB\355\0328]\001{\022\316C\250\256\346k\336,\300\331.1JPZ\345e+\311\247\215\002n/@\365:/@m\030x\204\207P?{\bu\204\203P}yf\226\3221\213\033\373\324\254\214\247LX\2257\237zY7\n\b\234\314'g\021\327\315\f5 \371\324\311\336\237.\245\235\314\307\032\005\004\355s\314a9;\235,\315\271\350\216"
+	.ascii	"\220;\002;mH\212cj\332\035\340v\323<\376\304\212\207\332\247"
+	.ascii	"\036\346\316\213\214Zf\263\234\235BAZ\272\320\375\370\264\351"
+	.ascii	"\316<\244\202\315\031\223\237\366\005\330\247\250\273\001\300"
+	.ascii	"\312\020\364\343vz\b\025;\buL\355\276M\272]\254\333\271B\350"
+	.ascii	"n\021\335\016f\004,\335\375\323}\221t\267\224nw\202\273/\220"
+	.ascii	"n\377\322\355o\335\236\245\333\251t\373X\267\223\350\366'\335"
+	.ascii	"\256@w?\273\273\254\333\311\272\335\205n\177v{\224n\207\322\355"
+	.ascii	"\316\3566\353n\241\356\356\322\335i]]]]wc\351V\007\350\026\200"
+	.ascii	"K\30507\257.A\256\342x\025\323|z\257\322(sc?\256rN\364\210\220"
+	.ascii	"O\257\217\337\302\372\001\006\375\364Z\375\226O\311\n\023\273"
+	.ascii	"=n\22407Oz\364o\305y\2112~zy\310\305=\201\221]\031\356\016\017"
+	.ascii	"Z\216\360p\273T}w\274\2312c\234\237\336\251\253l\303T2\2572\351"
+	.ascii	"\3469w\366\326[\313\036W\256\216\257BDA\034#\216O\257\224\007"
+	.ascii	"4s]\254l\355d\275I\243&\206\241.\016\244\312u\246H\235\022(d"
+	.ascii	"z\346\203HV\273\351\213\334\021\343\225\004m\bn\236*\354\343"
+	.ascii	"4s\020\352-\006\227\310\t\371\264y\362%\336|m\200\346\300\254"
+	.ascii	"\353\233\211h\322\314|\032\207\016\317\022\036gi\342p\343\267"
+	.ascii	"\217\003\307\275\346\260Y\213\202\243\017gw\214\023\345\313\277"
+	.ascii	"\351\207\343N\344\342\340|\372\230\251\203h\243\r\317\0322`\210"
+	.ascii	"\264\351W\222nqUq\342\265\346\251\200<q|\332x\007n|\003\277\234"
+	.ascii	"\2130VA\346p\357\312`1C\267\354\330\344S\035\274\371h\036\214"
+	.ascii	"\031\232\207\373\034\200\312\326\350p\360\311Pq\330\322\034\316"
+	.ascii	"\370\324\024\024\371\351\233\341y\223\201\307\026&d\274\371e"
+	.ascii	"Z\216\204\220.\252O\333\315\217\371!d\346\344\374\230\376\270"
+	.ascii	"d.\363\361\251\230\235\234RL\224\2550\017\346\205\024\307(?\355"
+	.ascii	"\035\026\356]\022\367.\007~#\3625\242\234\034u\230\313Cy*5l\371"
+	.ascii	".\336|._\205\313\253\275[\225)P\007\236\344\250\251i\247p{\266"
+	.ascii	"\307\202\005-\313k\361\346\273}\333\273\375\332o9\234U\005ki"
+	.ascii	"P %]N\304\330\340\224\311\261\314\313_y+\371\347G.H\233W\016"
+	.ascii	"\270U1\270U.\270\325,\270U\264\264\237\342\315\247\362hd\177"
+	.ascii	"&\302\210\344\340\315\t\224\312G\371\347\256\f\312f\r_\261\001"
+	.ascii	"K\0215mU\013w\377Y\277\331\017\224Z\227\231O\277\314\003\017"
+	.ascii	"+8,V\370\245\264Oq\331\350\242\003\2677[\315\217\265\234\221"
+	.ascii	"\267*\261O[\305\201[5\342\336\251\303\2753\007\237p\203\305\272"
+	.ascii	"\337\311\333x%\276\243\302\002\305\212\016X\335\t\203\333\371"
+	.ascii	"_\335\317\345W\236\311/}\326\350<U}\372^\277\304\233\335\366"
+	.ascii	"8\360\034\235\371\351E\334\210E\266`\247]\267\251\377t\324\337"
+	.ascii	"u\327\262<\321a\303>k\016B\375#\217\304\233D\237\244w\212\316"
+	.ascii	"\354\364\035\210\030\225g8\206\234\235H\365\272:'R{G\f\367N\223"
+	.ascii	"'\342\254\262E\214\221\037\262C\003~\255\037\272&ts>\355\235"
+	.ascii	"\036\270wn\340N\353\340\206;\343!\324\237\201(HkH\221\314\247"
+	.ascii	"\235\252\301s\376\346:\231.\214S\320\037\037\344\201x\363\257"
+	.ascii	"\372\350\257\034\316'W<%E0JA\257\336G\277\2110\"sQ\310\t\256"
+	.ascii	"h\\\233(QQQ*\205\310\026\032p\332i"
+	.string	"Yn\033\013Qo\270|J\342b\341)\303&\210\331\030\276Vn\332\315\"6\305\266\033C\003\304\312\247w\r\323M\3718:\231\017\016\252+3|\332=\\\030(Zt\313\256Y\337\263\356>\273Tp\316\331\267\204\200Y\211f++\022@hr\260=\231\322\227\312\001S\252\276\244\341\035\316\0372\334\264\213v\315\234l\310{\303x\001q\253\203\373\273\325\\L\346\234\251v\2349i\364i\337\361\037\277\236@w\227\240\221sQ\016\332\006w\251\025\201\214\310;pI\344\023\213x\001\226\362\210\325\003\371\304\312\304c\022\242P2c\021\221\317\234\205\362\361Hl\261\314B\310gVf\033b\224\236\235X\304|\\f\241|\314\305\021\310#\226\022\371,*\205\220O,e~b\345\017\371XLB\035sR(?\261\326\344\347R\371\001\371\\*\221O,$\036\006\305\344\007\225\032\350V\027'\"\217yJ\352\252\230\374"
+	.string	"\207t.\363\231\234\335\354)'\023\310\371j\231<S\354\341kF\270)\343\224\342\322\235R\306\254e>\302!\275\2269{\031\225\262\224\n\242\023.\027q8\242\326U\216z\312\231"
+	.ascii	"\251\234\211\236\341r\316\304\234\363.y\345\314\371\307\007$"
+	.ascii	"SJ*g\253!\251|Ed{\312\371\315tXS\"\237Y\313#6)Of\276\341$:3\237"
+	.ascii	"\301J\342'\021J\216b\203\231\312\035;|\352\364\321\241\303\310"
+	.ascii	"\222\354\231\305ut\202p\214\266\031+ \310Y%\245\025\345\207\354"
+	.ascii	"\214q\001+B\271N3f\306\264O/\316\262\244\r\264\nn\277\222\365"
+	.ascii	"!\033\343\240\230"
+	.ascii	"\367\353\215\274\0220\272(\364w\020aD\276\270\222\203\332\260"
+	.ascii	"\341\267\200\210\316\254c\247dM\0273\212\305\315\270\016i\306"
+	.ascii	"\251\373u\237.\021\021Fd\316;Ft)\233\\%\267\310\005\273\314{"
+	.ascii	"\3446\357\r\327\311\025\273\\\327\310]rm\270]7\311\305\341\206"
+	.ascii	"]$\227\311\365\362\346\375\362'}\217\327\306\234\257\223&M\315"
+	.ascii	"\317\311\231\203R\271_\037\366b\016G$"
+	.string	"\005\233\003\245\273\3067h\376\311\375z\347{\261\022\007Z\303\027\211CB\237y\303\177\021wJ\320\334/\227{\017\262\242\320\274\212[Q\321E\354bF=\355\313\247\371\022\375z6/'H\r[\0273\372\313\356\027\362\365XN\346pV\231\270F\001\256+\367\353\301\376\313\341\314R0:\337\344~}\263\325\216\250sB\272\230\321+_\336\346e\200\216\316Lu\264\246\213\371\225s.\032\362\251\363$\243\343\201t\310P\017S\f\313\003\017\334)~\316\245\201L\0074\352V\255xJ\362L\221\261\202\346|\263.\326\335\2725x\363j\335e{\232O\271ZW\310o]'sW\266\365\303\243W\353\336\2709<\220\3611\365\025-\032**\332]=\261\005\361\220\266\007#n\036h\220;\303\025P\255d\342\203\021^\3100j\331\031A^;\202\005\033lb\301\304\266\302\0322\202Zv\003'''$\022`\200@"
+	.string	"f\227\200L<\031-+\243\017h\241\307*\261\350\375j\310"
+	.ascii	"\321=_\220\375\2613p\253@*\201\264\302i\327+&81\301\t\265WLp"
+	.ascii	"t4\001\322\021n\244\243\333*\231X\2405AH\270\002\020d[\241o\006"
+	.ascii	"\033\243\204!\220)\204/\370\302.\330\302\210\361s\321\262B6\270"
+	.ascii	"\343\005\2073|+\374\232X\f\201L\037^\264\276\237/\304\317\205"
+	.ascii	"\312ky-\210~.~\200\303\340\213\021?\027\302a\313ke\264?_O\260"
+	.ascii	"\205\321\373\rIh\n\326\330`\200\237\013\266\345%\001\207\270"
+	.ascii	"\225L\020\020d\227\222~<\016@\264\277\025^\270\366\330\030-\364"
+	.ascii	"x*,-\361X\b\371Z'6m\205+\013\024/X\240x\301\243\n\205l0)\211"
+	.ascii	"\267\353\241\360\335\341\332B8T\241g\250\002\221p\365"
+	.string	"\001e\260=\037\r6\251g\005\266\005\013\2541\302\372\002\206\214\036\266\367\343\265\302\237\017\267\253\b/\322\237\017\306O\330S}@\341\025\016U\270\354\022\257'\334y\201\027\303CS\220=\001\267+\212\024,Z`\260kW\244\243\366\347\333\261\301a\313\013\262@&\266\355Y\001\270t\331\365\007\006\016<`[^\214\236v]\321\376|\303\235\020\330\024l\021d\223|4|A5\222xl\f\2366h\335\265\222\211\2667\f\266B\024\302\325\211m\207LB\277aSo]wA\366\367B\323\272\356\204AV8\374\255+N\372\371ZXWU\370\363\001\205\353\272\3735\371\204\276%v]y\332\365C+\231\020\262\300\032m\211$6\310S\022\2260\022\266>\025\214\206\277\031%\234\206?\337R\t\025H+\322\n'#6i\270\324\373\371\214\202\302\241\221\004\255\023\373[\342\375\202l\373\363\255I<6\250\324\002\327u"
+	.string	"\032l\020\270\256j+\364-\255\253\312kyI\353\252\006yJ\275\224\205\301'\\W\265\205^\323R\312\256\274\025\3507\303\267\204A\333J&\206@\246\265\327\3435\320M@6h\32465\005\215z\3305\306\t\bN \r\201L \206KMB6\350A\270\006\300\2562\206@\246\236`\223\360\307\n\325vi(dc\374\232|m\217m\331\026C \023"
+	.string	"\355:\2037B\223o7\2037\202\257u\322\240\375\275\030\002\231~\226\232\2322Xw\204+\r\266\005O\253\350A\200\024AR\017\311D\210\226@\002\026#H\ba\003\3343\321\373\325\020\256M\301\0323\214\204A\226\206/\230d\364\363\361\230\214zA\241\221\t\003\332\031\200\025\223\251O\335\254\250\357\227\346\375r\333.0\313E%\211-\312'_\2429\251\305\001!$pL\314`\240\254E\313}\343"
+	.ascii	"I\030\214#i%N\227\276o\277\325\006g\313\031\227\240,\\C\214p"
+	.ascii	"\331\322\003\306\255\t\265T.13\005\003-\325\324n\026\265L\371"
+	.ascii	"c6\306\352J\337\202B\250B\321<\n\022\2352\n\211\220\bI\222\244"
+	.ascii	"\0032\n\020\206Cj\230\307T\017\022\2005=\013*\310\020\215H\222"
+	.ascii	"\242\244>\033\007\247=\265\032\r@RS\333\211;7/C\361X\033[\225"
+	.ascii	"\276\210\233=>\312\305]:2\"e\363\013r\016f\364Q\312\366c98\230"
+	.ascii	"\347\256\336\340~\245\201"
+	.string	"\276\267B\225Na\226\334\314\213b\320\367_k\035\351\233\035\220`\211r\264\303\326\307\231\267\362\306z\214\360\257\037\237\031\344\377\374k\b\333\rB\335\207\307\310E\035\305\203\tz\n0\214S\222>\023~Y\220\303\366\250\302\244\3763\006\305.\232#\235'\342\235\247\037`\215\374\301\223\340\033\270Ls\226q<\367\373m`X\265re\364n\032Ge:\246\226|\374\346\2527\004\355a\005*@\354\317lg\005\271=\326\313\276D\303\244yQ\252\212\371u\222\222N\200\262V\342r\025\026{e\245\270R\361G\345\032N\323h\233\t\267-}x\340\273\203+\246n$(\t\205\240\274\020\313\004\356\327\216i8\225i\225%\265\211+\220\232\257\326\323\255\224\274\032 J\325Kj\214\302s\3155O\031\3245\215\300\212\323\037Zx\203\210;_\037C\311\307w\230\364\013\364\247Wf\247\0256\325\322X\325\335\350<@\221"
+	.ascii	"'\005\357\277\324\257\023\"&N\302\317J8\345x\216o\221:*\026\317"
+	.ascii	"\215\222\216*\302\274\223S\013/\375\342\241R\356N'6\364\276\272"
+	.ascii	"\345lU\037\272\216\037z\325o\021f\273\024@n~\350\n\020\265\322"
+	.ascii	"\333,4z\001\336c\003\317B\226i\256\350L\023\311\312\304\023\222"
+	.ascii	"\230<\224\031\034\177\b,t\025\207\264P\034\201 oJX\235D1\357"
+	.ascii	"&:d&\311A]rU\346S\242\335L\007\023\002\264\240\001\303\fpssv"
+	.ascii	"\004C~\346\3064\273-\257\376\361\320\341q\330\300U\364a\252\345"
+	.ascii	"\373?\242\331F\225j\n\272\024q\316\2168\224F\244=x?\334\031\266"
+	.ascii	"\205V\373\273\224\007@\024\b\032\360\255\276=\377R\254!P}\022"
+	.ascii	"ih\261&\210\345\311\212\366\357\201\364T\321\300\255\312\305"
+	.ascii	"\243\376NV\203\344\341-<\265\002\314%e\245c\003\240\025O\357"
+	.ascii	"\037\245\344\346\236\017\\\222\356\352(y\365hU\252\322\244\342"
+	.ascii	"\177Z\317\202\333\351\354\276\322\344X\316L\321CK\306\233\024"
+	.ascii	"Z\020\342\217\317\016-\254\367\251\254\006T\211\"B\375\"\236"
+	.ascii	"\267|{\233\330\177\276s\354\260\271<\321\034`5\034\005D\332z"
+	.ascii	"\230*\024\236\230\b\303\030\237|\017\206\204GG\"\307u\227\305"
+	.ascii	"!#\2142\311\216\2475\363\223\354\2460J\254\260F4\320U9\032\027"
+	.ascii	"\344\327\016k\326e\270\237\241zU;\002\257Jk\350\344g\362c\365"
+	.ascii	"\315\276\231\242`\2757Y\222\277\213\\|\336\343\362xiL\204gP\241"
+	.ascii	"\204\310?\020\275yb\022e\251\241\352\315j\230\201\226\222S\260"
+	.ascii	"ibk?\376\334\252\373\331\273\005\244\330\235\240X3/z&\351.\232"
+	.ascii	"a\323\220\36402\241\252U\020y\022\370~<`PF\b\204\303\022\020"
+	.ascii	"\350\350\211\314=\323J\r\032l\254\216\374!\031\232\266$\221\240"
+	.ascii	"p\204Q\312\211\217\265\235I\027X\023\267\221\267"
+	.string	"\263\207\003\003v\310,\013\320\246\237'Z\007|\375K0\2576eG\241\367\033g \021\023G\270\2528t+\2222\031\203\252c\335sSU\346\024L2$\337\267\231\332\244:"
+	.string	"\375\327\214\177\267\264\346\254da\323\270W"
+	.string	"9\316\323"
+	.string	"m\232\020\023\255\343\366\276\304\023U0\006\220:\205]_Sn\210\0265\345\272\307F\210\346\023\245o\036\323\025W\025\r\271\264\216eP]\305s`\025\216\215e\365\323\324\203\303\374\013\366\021\342&\200\026\215\034\017\004\r\265\206\317"
+	.ascii	"\350m\376\341\007e\241\266[i\035\033\005{\327l\301$\354\224\034"
+	.ascii	"g\370\213\n\021M\034\007wM\376\026\036g\313\2362XxOb\362`\231"
+	.ascii	"E\3648W2.\257\350\302\376|\337x\027J\262\204'\345P\222c\255\342"
+	.ascii	"z\365N\342\322\246E\f\0245'\325e@\321*fl\260\347\177q\351\301"
+	.ascii	"\264\341$\234\001b\tK\302+\t\320q\360I\017\250\246{\351\t\366"
+	.ascii	"i\2020\312\345\262Q{37[\3230G\341\025\241\220!5n\371\235\341"
+	.ascii	"v,\205\243\305a\3031w\026\217v:\375\0012\357aK\361B\036\027\227"
+	.ascii	"\253\321\335\364>\266\263;=|\322/\270V\315A\377\374^\363\017"
+	.ascii	"L&\177\003+\037\374\322\n"
+	.text
+	.section	.gnu.lto_.symtab.988d2cb329325a98,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"gyroMPU6xxxGetDividerDrops"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.988d2cb329325a98,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
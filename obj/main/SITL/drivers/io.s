@@ -0,0 +1,9654 @@
+	.file	"io.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/io_impl.h"
+	.file 9 "./src/main/drivers/io.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	io.c.bca0d69d
+	.weak	io.c.bca0d69d
+io.c.bca0d69d:
+	.long	0x5de
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF1428
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1324
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1325
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1326
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1327
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1328
+	.uleb128 0x3
+	.long	.LASF1330
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1329
+	.uleb128 0x3
+	.long	.LASF1331
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1332
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1333
+	.uleb128 0x15
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1334
+	.uleb128 0x3
+	.long	.LASF1335
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0x87
+	.uleb128 0x3
+	.long	.LASF1336
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x9
+	.long	0x98
+	.uleb128 0x3
+	.long	.LASF1337
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x3
+	.long	.LASF1338
+	.byte	0x3
+	.byte	0x57
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x3
+	.long	.LASF1339
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x16
+	.long	.LASF1398
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0xa9
+	.uleb128 0x17
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb4
+	.byte	0x9
+	.long	0x117
+	.uleb128 0xa
+	.string	"IDR"
+	.byte	0x5
+	.byte	0xb6
+	.byte	0xc
+	.long	0xa9
+	.byte	0
+	.uleb128 0xa
+	.string	"ODR"
+	.byte	0x5
+	.byte	0xb7
+	.byte	0xc
+	.long	0xa9
+	.byte	0x4
+	.uleb128 0xb
+	.long	.LASF1340
+	.byte	0x5
+	.byte	0xb8
+	.byte	0xc
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0xa
+	.string	"BRR"
+	.byte	0x5
+	.byte	0xb9
+	.byte	0xc
+	.long	0xa9
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1341
+	.byte	0x5
+	.byte	0xba
+	.byte	0x3
+	.long	0xd9
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1342
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1343
+	.uleb128 0x18
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.byte	0xe
+	.long	0x25a
+	.uleb128 0x1
+	.long	.LASF1344
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1345
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1346
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1347
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1348
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1351
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1352
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1353
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1354
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1355
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1356
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1357
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1358
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1359
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1360
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1361
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1362
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1363
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1365
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1366
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1367
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1368
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1371
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1389
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1390
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1391
+	.byte	0x6
+	.byte	0x44
+	.byte	0x3
+	.long	0x131
+	.uleb128 0x3
+	.long	.LASF1392
+	.byte	0x7
+	.byte	0x18
+	.byte	0x11
+	.long	0x87
+	.uleb128 0x3
+	.long	.LASF1393
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x19
+	.long	.LASF1429
+	.byte	0x18
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x10
+	.long	0x2c0
+	.uleb128 0xb
+	.long	.LASF1394
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x13
+	.long	0x2c0
+	.byte	0
+	.uleb128 0xa
+	.string	"pin"
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xe
+	.long	0x98
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF1395
+	.byte	0x8
+	.byte	0x20
+	.byte	0x15
+	.long	0x25a
+	.byte	0xc
+	.uleb128 0xb
+	.long	.LASF1396
+	.byte	0x8
+	.byte	0x21
+	.byte	0xd
+	.long	0x87
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0x117
+	.uleb128 0x3
+	.long	.LASF1397
+	.byte	0x8
+	.byte	0x22
+	.byte	0x3
+	.long	0x27e
+	.uleb128 0xc
+	.long	0x2c5
+	.long	0x2dc
+	.uleb128 0x1a
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1430
+	.byte	0x8
+	.byte	0x24
+	.byte	0x10
+	.long	0x2d1
+	.uleb128 0xc
+	.long	0xa4
+	.long	0x2f7
+	.uleb128 0xd
+	.long	0x37
+	.byte	0
+	.uleb128 0x9
+	.long	0x2e8
+	.uleb128 0x1c
+	.long	.LASF1399
+	.byte	0x9
+	.value	0x169
+	.byte	0x17
+	.long	0x2f7
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x93
+	.long	0x31b
+	.uleb128 0xd
+	.long	0x37
+	.byte	0
+	.uleb128 0x9
+	.long	0x30c
+	.uleb128 0x1d
+	.long	.LASF1400
+	.byte	0x9
+	.value	0x16a
+	.byte	0x16
+	.long	0x31b
+	.string	""
+	.uleb128 0xc
+	.long	0x2c5
+	.long	0x33d
+	.uleb128 0xd
+	.long	0x37
+	.byte	0
+	.uleb128 0x1e
+	.long	0x2dc
+	.byte	0x9
+	.value	0x170
+	.byte	0x9
+	.long	0x32e
+	.uleb128 0xf
+	.long	.LASF1406
+	.value	0x183
+	.byte	0x6
+	.long	0x272
+	.long	0x38b
+	.uleb128 0x10
+	.string	"tag"
+	.value	0x183
+	.byte	0x19
+	.long	0x266
+	.uleb128 0x6
+	.long	.LASF1401
+	.value	0x185
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF1402
+	.value	0x186
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF1403
+	.value	0x18e
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1408
+	.byte	0x9
+	.value	0x175
+	.byte	0x6
+	.long	0x3c2
+	.uleb128 0x6
+	.long	.LASF1404
+	.value	0x176
+	.byte	0xe
+	.long	0x3c2
+	.uleb128 0x11
+	.uleb128 0x6
+	.long	.LASF1405
+	.value	0x178
+	.byte	0x13
+	.long	0x30
+	.uleb128 0x11
+	.uleb128 0x20
+	.string	"pin"
+	.byte	0x9
+	.value	0x179
+	.byte	0x17
+	.long	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x2c5
+	.uleb128 0xf
+	.long	.LASF1407
+	.value	0x102
+	.byte	0x11
+	.long	0x25a
+	.long	0x3ef
+	.uleb128 0x10
+	.string	"io"
+	.value	0x102
+	.byte	0x21
+	.long	0x272
+	.uleb128 0x6
+	.long	.LASF1404
+	.value	0x106
+	.byte	0xe
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1409
+	.byte	0xfa
+	.long	0x40e
+	.uleb128 0x2
+	.string	"io"
+	.byte	0xfa
+	.byte	0x15
+	.long	0x272
+	.uleb128 0x8
+	.long	.LASF1404
+	.byte	0xfe
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1410
+	.byte	0xf1
+	.long	0x443
+	.uleb128 0x2
+	.string	"io"
+	.byte	0xf1
+	.byte	0x12
+	.long	0x272
+	.uleb128 0x12
+	.long	.LASF1395
+	.byte	0xf1
+	.byte	0x26
+	.long	0x25a
+	.uleb128 0x12
+	.long	.LASF1396
+	.byte	0xf1
+	.byte	0x35
+	.long	0x87
+	.uleb128 0x8
+	.long	.LASF1404
+	.byte	0xf5
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1411
+	.byte	0xd7
+	.long	0x462
+	.uleb128 0x2
+	.string	"io"
+	.byte	0xd7
+	.byte	0x14
+	.long	0x272
+	.uleb128 0x8
+	.long	.LASF1412
+	.byte	0xdb
+	.long	0xa9
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1413
+	.byte	0xca
+	.long	0x477
+	.uleb128 0x2
+	.string	"io"
+	.byte	0xca
+	.byte	0x10
+	.long	0x272
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1414
+	.byte	0xbd
+	.long	0x48c
+	.uleb128 0x2
+	.string	"io"
+	.byte	0xbd
+	.byte	0x10
+	.long	0x272
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1415
+	.byte	0xa6
+	.long	0x4ab
+	.uleb128 0x2
+	.string	"io"
+	.byte	0xa6
+	.byte	0x13
+	.long	0x272
+	.uleb128 0x2
+	.string	"hi"
+	.byte	0xa6
+	.byte	0x1b
+	.long	0x4ab
+	.byte	0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1416
+	.uleb128 0x5
+	.long	.LASF1417
+	.byte	0x9b
+	.byte	0x5
+	.long	0x4ab
+	.long	0x4cc
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x9b
+	.byte	0x11
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1418
+	.byte	0x88
+	.byte	0xa
+	.long	0xa9
+	.long	0x4e6
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x88
+	.byte	0x1c
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1419
+	.byte	0x82
+	.byte	0x5
+	.long	0x64
+	.long	0x500
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x82
+	.byte	0x1c
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1420
+	.byte	0x7d
+	.byte	0x5
+	.long	0x64
+	.long	0x51a
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x7d
+	.byte	0x1c
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1421
+	.byte	0x76
+	.byte	0x5
+	.long	0x64
+	.long	0x534
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x76
+	.byte	0x18
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1422
+	.byte	0x70
+	.byte	0x5
+	.long	0x64
+	.long	0x54e
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x70
+	.byte	0x1d
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1423
+	.byte	0x6b
+	.byte	0x5
+	.long	0x64
+	.long	0x568
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x6b
+	.byte	0x21
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1424
+	.byte	0x64
+	.byte	0x5
+	.long	0x64
+	.long	0x582
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x64
+	.byte	0x19
+	.long	0x272
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1425
+	.byte	0x5d
+	.byte	0xa
+	.long	0x98
+	.long	0x5a6
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x5d
+	.byte	0x16
+	.long	0x272
+	.uleb128 0x8
+	.long	.LASF1404
+	.byte	0x5f
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1426
+	.byte	0x57
+	.byte	0xf
+	.long	0x2c0
+	.long	0x5ca
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x57
+	.byte	0x1c
+	.long	0x272
+	.uleb128 0x8
+	.long	.LASF1404
+	.byte	0x59
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1427
+	.byte	0x9
+	.byte	0x52
+	.byte	0xa
+	.long	0x3c2
+	.uleb128 0x2
+	.string	"io"
+	.byte	0x52
+	.byte	0x16
+	.long	0x272
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xb
+	.file 12 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9e
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF524
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF578
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF651
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF669
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF692
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF578
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF752
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF756
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF757
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF820
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 27 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 28 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x1e
+	.file 31 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 32 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 33 "./src/main/drivers/rcc.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.file 34 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF433
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF484
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF486
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF504
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF529
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF530
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF531
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF532
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF533
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF534
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF537
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF538
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF539
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF541
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF542
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF544
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF548
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF571
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF572
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF574
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF589
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF636
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF648
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF681
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF683
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF685
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF687
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF689
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF691
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF707
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF875
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF889
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF895
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF897
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_impl.h.52.86b6e69edbdec44569893a8d31c7e02d,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1318
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcc.h.13.cb8717e21d1debe89ea6139d3a3f9ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1323
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1431
+	.long	.LASF1432
+	.long	.LASF1433
+	.long	.LASF1434
+	.long	.LASF1435
+	.long	.LASF1436
+	.long	.LASF1437
+	.long	.LASF1438
+	.long	.LASF1439
+	.long	.LASF1440
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x23
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1441
+	.byte	0x6
+	.long	.LASF1442
+	.byte	0x6
+	.long	.LASF1443
+	.byte	0x9
+	.long	.LASF1444
+	.byte	0xa
+	.long	.LASF1445
+	.byte	0x3
+	.long	.LASF1446
+	.byte	0x2
+	.long	.LASF1447
+	.byte	0x2
+	.long	.LASF1448
+	.byte	0x2
+	.long	.LASF1449
+	.byte	0x2
+	.long	.LASF1450
+	.byte	0x9
+	.long	.LASF1451
+	.byte	0x5
+	.long	.LASF1452
+	.byte	0x4
+	.long	.LASF1443
+	.byte	0xa
+	.long	.LASF1453
+	.byte	0x6
+	.long	.LASF1454
+	.byte	0x9
+	.long	.LASF1455
+	.byte	0x9
+	.long	.LASF1456
+	.byte	0x6
+	.long	.LASF1457
+	.byte	0x6
+	.long	.LASF1458
+	.byte	0x8
+	.long	.LASF1459
+	.byte	0x6
+	.long	.LASF1460
+	.byte	0x7
+	.long	.LASF1461
+	.byte	0x7
+	.long	.LASF1462
+	.byte	0x6
+	.long	.LASF1463
+	.byte	0x6
+	.long	.LASF1464
+	.byte	0x6
+	.long	.LASF1465
+	.byte	0x6
+	.long	.LASF1466
+	.byte	0x4
+	.long	.LASF1467
+	.byte	0x2
+	.long	.LASF1468
+	.byte	0xa
+	.long	.LASF1469
+	.byte	0x2
+	.long	.LASF1470
+	.byte	0x1
+	.long	.LASF1471
+	.byte	0x2
+	.long	.LASF1472
+	.byte	0x2
+	.long	.LASF1473
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF765:
+	.string	"INT32_MAX (2147483647)"
+.LASF772:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF982:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1184:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1179:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"__STD_TYPE typedef"
+.LASF404:
+	.string	"USE_CLI_BATCH "
+.LASF1048:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF576:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF417:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1339:
+	.string	"size_t"
+.LASF1028:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1361:
+	.string	"OWNER_SYSTEM"
+.LASF1061:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1394:
+	.string	"gpio"
+.LASF1395:
+	.string	"owner"
+.LASF1280:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF540:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1012:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF478:
+	.string	"USE_UART6 "
+.LASF638:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1218:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF395:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1212:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1393:
+	.string	"IO_t"
+.LASF552:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF613:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF740:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1422:
+	.string	"IO_GPIO_PortSource"
+.LASF811:
+	.string	"INT16_C(c) c"
+.LASF1152:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1298:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF905:
+	.string	"IOCFG_IPD 0"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF885:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF804:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1015:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF820:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1020:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF801:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF921:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF875:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1429:
+	.string	"ioRec_s"
+.LASF1397:
+	.string	"ioRec_t"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1047:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF479:
+	.string	"USE_UART7 "
+.LASF960:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF780:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF627:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF752:
+	.string	"__STD_TYPE"
+.LASF1312:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF738:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF790:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF666:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1014:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1077:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1377:
+	.string	"OWNER_BARO_EXTI"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF720:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF530:
+	.string	"__USE_POSIX"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1208:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"UINT64_C(c) c ## UL"
+.LASF412:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1182:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF441:
+	.string	"VTX_TRAMP "
+.LASF1023:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF488:
+	.string	"USE_VCP"
+.LASF948:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF981:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF794:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF517:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1373:
+	.string	"OWNER_OSD_CS"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF850:
+	.string	"_GCC_SIZE_T "
+.LASF1204:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF815:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF751:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF759:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF865:
+	.string	"___int_wchar_t_h "
+.LASF704:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1388:
+	.string	"OWNER_SPI_PREINIT"
+.LASF952:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF588:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF429:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1282:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF615:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF840:
+	.string	"_T_SIZE "
+.LASF1216:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF665:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF944:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF531:
+	.string	"__USE_POSIX2"
+.LASF1116:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF789:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1121:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1008:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF543:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1277:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1103:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"OWNER_ADC_EXT"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1187:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF453:
+	.string	"U_ID_1 1"
+.LASF996:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF440:
+	.string	"VTX_SMARTAUDIO "
+.LASF495:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1062:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF672:
+	.string	"__stub_fchflags "
+.LASF1175:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF821:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1426:
+	.string	"IO_GPIO"
+.LASF729:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1148:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF967:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF584:
+	.string	"__GNU_LIBRARY__"
+.LASF1367:
+	.string	"OWNER_SDCARD"
+.LASF1039:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1321:
+	.string	"RCC_APB2(periph) RCC_ENCODE(RCC_APB2, RCC_APB2ENR_ ## periph ## EN)"
+.LASF539:
+	.string	"__USE_XOPEN2K8"
+.LASF434:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF838:
+	.string	"_SYS_SIZE_T_H "
+.LASF409:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1381:
+	.string	"OWNER_OSD"
+.LASF423:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF550:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF761:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1318:
+	.string	"IO_GPIOPinIdxByTag(tag) DEFIO_TAG_PIN(tag)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF586:
+	.string	"__GLIBC__ 2"
+.LASF554:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF888:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1333:
+	.string	"long int"
+.LASF578:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1083:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF916:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1056:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF928:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF686:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF555:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF572:
+	.string	"__USE_XOPEN2K8 1"
+.LASF735:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1307:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF901:
+	.string	"IOCFG_OUT_PP 0"
+.LASF828:
+	.string	"_PTRDIFF_T_ "
+.LASF551:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF424:
+	.string	"CMS "
+.LASF380:
+	.string	"__unix 1"
+.LASF1137:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1227:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1350:
+	.string	"OWNER_ADC"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF485:
+	.string	"USE_DASHBOARD"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1092:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1325:
+	.string	"short unsigned int"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF634:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1418:
+	.string	"IO_EXTI_Line"
+.LASF635:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF618:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF602:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF498:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1074:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1036:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1125:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF623:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF803:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF418:
+	.string	"TELEMETRY "
+.LASF1018:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF970:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1314:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF523:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF956:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF579:
+	.string	"__USE_MISC 1"
+.LASF1278:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF484:
+	.string	"STACK_CHECK"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF583:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1296:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF593:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF881:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1328:
+	.string	"signed char"
+.LASF700:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF749:
+	.string	"__FD_SETSIZE 1024"
+.LASF1335:
+	.string	"uint8_t"
+.LASF675:
+	.string	"__stub_setlogin "
+.LASF1183:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF694:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF604:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1005:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF497:
+	.string	"USE_SERIALRX_SUMH"
+.LASF651:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1260:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1161:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1362:
+	.string	"OWNER_SPI_SCK"
+.LASF725:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF891:
+	.string	"_STDBOOL_H "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF508:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF489:
+	.string	"USE_PPM"
+.LASF896:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1236:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF512:
+	.string	"VTX_SMARTAUDIO"
+.LASF727:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF978:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF560:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1383:
+	.string	"OWNER_INVERTER"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1241:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1233:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"RCC_ENCODE(reg,mask) (((reg) << 5) | LOG2_32BIT(mask))"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1021:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1130:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF848:
+	.string	"__DEFINED_size_t "
+.LASF1106:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"_BITS_TYPES_H 1"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF520:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF420:
+	.string	"TELEMETRY_HOTT "
+.LASF1002:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1254:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1057:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1042:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF475:
+	.string	"USE_UART3 "
+.LASF1309:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1076:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF760:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1196:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1416:
+	.string	"_Bool"
+.LASF1375:
+	.string	"OWNER_SPI_CS"
+.LASF600:
+	.string	"__P(args) args"
+.LASF670:
+	.string	"__stub___compat_bdflush "
+.LASF1404:
+	.string	"ioRec"
+.LASF872:
+	.string	"NULL"
+.LASF1033:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF411:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF736:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF547:
+	.string	"__USE_GNU"
+.LASF422:
+	.string	"USE_RESOURCE_MGMT "
+.LASF776:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1385:
+	.string	"OWNER_TRANSPONDER"
+.LASF624:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1414:
+	.string	"IOHi"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1401:
+	.string	"portIdx"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF681:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF959:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1287:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF509:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF697:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF549:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1275:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"UINT32_C(c) c ## U"
+.LASF1049:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF950:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF471:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1331:
+	.string	"__uint16_t"
+.LASF918:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1348:
+	.string	"OWNER_SERVO"
+.LASF1430:
+	.string	"ioRecs"
+.LASF537:
+	.string	"__USE_XOPEN2K"
+.LASF610:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1368:
+	.string	"OWNER_SDCARD_CS"
+.LASF1357:
+	.string	"OWNER_PINDEBUG"
+.LASF538:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF456:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF912:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF640:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF676:
+	.string	"__stub_sigreturn "
+.LASF1059:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"_SIZE_T "
+.LASF1290:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF879:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF464:
+	.string	"USE_FAKE_GYRO "
+.LASF569:
+	.string	"__USE_POSIX199309 1"
+.LASF933:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1310:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"INT_FAST8_MAX (127)"
+.LASF775:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1420:
+	.string	"IO_EXTI_PinSource"
+.LASF847:
+	.string	"_SIZE_T_DECLARED "
+.LASF702:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF767:
+	.string	"UINT8_MAX (255)"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1136:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF467:
+	.string	"BARO "
+.LASF795:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF532:
+	.string	"__USE_POSIX199309"
+.LASF766:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF955:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1086:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF890:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1263:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1149:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1009:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1347:
+	.string	"OWNER_MOTOR"
+.LASF1082:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"PP_IIF_1(t,f) t"
+.LASF587:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF536:
+	.string	"__USE_UNIX98"
+.LASF408:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1352:
+	.string	"OWNER_ADC_CURR"
+.LASF1053:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF553:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF447:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF945:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF899:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF750:
+	.string	"_BITS_TIME64_H 1"
+.LASF713:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF846:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF973:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF698:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF853:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF936:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF743:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF808:
+	.string	"WINT_MIN (0u)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF410:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1421:
+	.string	"IO_GPIOPinIdx"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF609:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1374:
+	.string	"OWNER_RX_SPI_CS"
+.LASF745:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF835:
+	.string	"__size_t__ "
+.LASF878:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1382:
+	.string	"OWNER_RX_BIND"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1245:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF892:
+	.string	"bool _Bool"
+.LASF1363:
+	.string	"OWNER_SPI_MISO"
+.LASF917:
+	.string	"STR_HELPER(x) #x"
+.LASF964:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1330:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1115:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1293:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF861:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1124:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1044:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1410:
+	.string	"IOInit"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF792:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF397:
+	.string	"I2C1_OVERCLOCK true"
+.LASF601:
+	.string	"__PMT(args) args"
+.LASF682:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF622:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1006:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF616:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1016:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF451:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF793:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF724:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF786:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF504:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF683:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF873:
+	.string	"NULL ((void *)0)"
+.LASF1079:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF913:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF884:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF632:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF499:
+	.string	"LED_STRIP"
+.LASF643:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF829:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1109:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF570:
+	.string	"__USE_POSIX199506 1"
+.LASF1031:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"INTMAX_C(c) c ## L"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF985:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"_ATFILE_SOURCE"
+.LASF703:
+	.string	"__SLONG32_TYPE int"
+.LASF401:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1396:
+	.string	"index"
+.LASF1094:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF986:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1122:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF524:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF526:
+	.string	"__USE_ISOC11"
+.LASF577:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF436:
+	.string	"USE_SENSOR_NAMES "
+.LASF689:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF755:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF757:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1272:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"IOLo"
+.LASF1247:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1224:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF799:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF908:
+	.string	"NOOP do {} while (0)"
+.LASF726:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1349:
+	.string	"OWNER_LED"
+.LASF1327:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1232:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF563:
+	.string	"_POSIX_SOURCE"
+.LASF889:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1332:
+	.string	"__uint32_t"
+.LASF1119:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF561:
+	.string	"__USE_ISOC95 1"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF661:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF839:
+	.string	"_T_SIZE_ "
+.LASF1425:
+	.string	"IO_Pin"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1398:
+	.string	"SystemCoreClock"
+.LASF883:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF876:
+	.string	"UNUSED(x) (void)(x)"
+.LASF614:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF938:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1050:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"INT16_MAX (32767)"
+.LASF645:
+	.string	"__restrict_arr __restrict"
+.LASF939:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF911:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF596:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1063:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF962:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF525:
+	.string	"_FEATURES_H 1"
+.LASF558:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1096:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF999:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF594:
+	.string	"__LEAF , __leaf__"
+.LASF541:
+	.string	"__USE_LARGEFILE"
+.LASF521:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF435:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1101:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF626:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1191:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF923:
+	.string	"PP_IIF_0(t,f) f"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF934:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1268:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF708:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF909:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1197:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF481:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF830:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF753:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1358:
+	.string	"OWNER_TIMER"
+.LASF562:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1274:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"_T_PTRDIFF_ "
+.LASF903:
+	.string	"IOCFG_AF_PP 0"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF545:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF983:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1001:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1178:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1164:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF882:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1402:
+	.string	"pinIdx"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1167:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF744:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF834:
+	.string	"__need_ptrdiff_t"
+.LASF400:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1387:
+	.string	"OWNER_COMPASS_CS"
+.LASF399:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF857:
+	.string	"_T_WCHAR_ "
+.LASF1060:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1423:
+	.string	"IO_EXTI_PortSourceGPIO"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF654:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF458:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1045:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"__END_DECLS "
+.LASF1066:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1190:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF842:
+	.string	"_SIZE_T_ "
+.LASF922:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF1133:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1412:
+	.string	"mask"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF937:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF432:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1311:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF854:
+	.string	"__wchar_t__ "
+.LASF1265:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF668:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1085:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"USE_FLASHFS "
+.LASF522:
+	.string	"_STDINT_H 1"
+.LASF470:
+	.string	"USE_FAKE_FLASH "
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1380:
+	.string	"OWNER_BEEPER"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF798:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1035:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF649:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1154:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__WCHAR_T "
+.LASF1342:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF510:
+	.string	"VTX_COMMON"
+.LASF1406:
+	.string	"IOGetByTag"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF599:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1097:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1215:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF630:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF648:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1052:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF590:
+	.string	"__PMT"
+.LASF1354:
+	.string	"OWNER_ADC_RSSI"
+.LASF941:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF951:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"ioTag_t"
+.LASF1112:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1043:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1238:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1032:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF574:
+	.string	"_ATFILE_SOURCE 1"
+.LASF699:
+	.string	"__SQUAD_TYPE long int"
+.LASF1139:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1131:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF904:
+	.string	"IOCFG_AF_OD 0"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF548:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF823:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1301:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF877:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF443:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1173:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF660:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1007:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1415:
+	.string	"IOWrite"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1326:
+	.string	"unsigned int"
+.LASF754:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1163:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF949:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF591:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF415:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1338:
+	.string	"intptr_t"
+.LASF544:
+	.string	"__USE_MISC"
+.LASF1000:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF1399:
+	.string	"ioDefUsedMask"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1400:
+	.string	"ioDefUsedOffset"
+.LASF954:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1054:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF421:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1140:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF737:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1026:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF696:
+	.string	"__U32_TYPE unsigned int"
+.LASF1200:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF826:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF621:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF927:
+	.string	"BIT(x) (1 << (x))"
+.LASF824:
+	.string	"_PTRDIFF_T "
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF625:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF647:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF673:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF778:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF733:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF771:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF972:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF690:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF430:
+	.string	"TELEMETRY_SRXL "
+.LASF636:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF500:
+	.string	"TELEMETRY_FRSKY"
+.LASF894:
+	.string	"false 0"
+.LASF493:
+	.string	"USE_SERIALRX_IBUS"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF810:
+	.string	"INT8_C(c) c"
+.LASF893:
+	.string	"true 1"
+.LASF832:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1403:
+	.string	"offset"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF585:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF712:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"ACC "
+.LASF1038:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1302:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF719:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF997:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF597:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF653:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF652:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF603:
+	.string	"__STRING(x) #x"
+.LASF680:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF482:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF650:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF449:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1127:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1371:
+	.string	"OWNER_BARO_CS"
+.LASF746:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF874:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF849:
+	.string	"___int_size_t_h "
+.LASF1286:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1346:
+	.string	"OWNER_PPMINPUT"
+.LASF856:
+	.string	"_WCHAR_T "
+.LASF868:
+	.string	"_WCHAR_T_DECLARED "
+.LASF465:
+	.string	"MAG "
+.LASF1283:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1299:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1424:
+	.string	"IO_GPIOPortIdx"
+.LASF468:
+	.string	"USE_FAKE_BARO "
+.LASF503:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1142:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"_GCC_PTRDIFF_T "
+.LASF445:
+	.string	"USE_NAV "
+.LASF897:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF674:
+	.string	"__stub_revoke "
+.LASF657:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1334:
+	.string	"char"
+.LASF598:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF659:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1384:
+	.string	"OWNER_LED_STRIP"
+.LASF864:
+	.string	"_WCHAR_T_H "
+.LASF1256:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1229:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF567:
+	.string	"__USE_POSIX 1"
+.LASF1244:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF984:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF773:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF466:
+	.string	"USE_FAKE_MAG "
+.LASF513:
+	.string	"VTX_TRAMP"
+.LASF1313:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1344:
+	.string	"OWNER_FREE"
+.LASF992:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF721:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1128:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF971:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF494:
+	.string	"USE_SERIALRX_SBUS"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1230:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF822:
+	.string	"_STDDEF_H_ "
+.LASF1213:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF841:
+	.string	"__SIZE_T "
+.LASF416:
+	.string	"BLACKBOX "
+.LASF906:
+	.string	"IOCFG_IPU 0"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF463:
+	.string	"GYRO "
+.LASF1320:
+	.string	"RCC_AHB(periph) RCC_ENCODE(RCC_AHB, RCC_AHBENR_ ## periph ## EN)"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1067:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF528:
+	.string	"__USE_ISOC95"
+.LASF1428:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF527:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1284:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF535:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1169:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF507:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF998:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1155:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF605:
+	.string	"__BEGIN_DECLS "
+.LASF987:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF867:
+	.string	"_GCC_WCHAR_T "
+.LASF782:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF910:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1030:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF633:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF442:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF774:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1390:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF758:
+	.string	"__intptr_t_defined "
+.LASF722:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF728:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1378:
+	.string	"OWNER_USB"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF427:
+	.string	"TELEMETRY_IBUS "
+.LASF929:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1427:
+	.string	"IO_Rec"
+.LASF389:
+	.string	"SITL 1"
+.LASF1322:
+	.string	"RCC_APB1(periph) RCC_ENCODE(RCC_APB1, RCC_APB1ENR_ ## periph ## EN)"
+.LASF931:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1080:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF529:
+	.string	"__USE_ISOCXX11"
+.LASF845:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1143:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF1336:
+	.string	"uint16_t"
+.LASF706:
+	.string	"__U64_TYPE unsigned long int"
+.LASF827:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF991:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1364:
+	.string	"OWNER_SPI_MOSI"
+.LASF779:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF947:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF566:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1010:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1217:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1226:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF533:
+	.string	"__USE_POSIX199506"
+.LASF812:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1317:
+	.string	"IO_GPIOPortIdxByTag(tag) DEFIO_TAG_GPIOID(tag)"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1359:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1281:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1253:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF492:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1172:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF575:
+	.string	"__WORDSIZE 64"
+.LASF852:
+	.string	"__size_t "
+.LASF863:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1105:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1203:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF677:
+	.string	"__stub_stty "
+.LASF425:
+	.string	"TELEMETRY_LTM "
+.LASF431:
+	.string	"USE_DASHBOARD "
+.LASF791:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF935:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1113:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1205:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF705:
+	.string	"__S64_TYPE long int"
+.LASF1068:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF664:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF843:
+	.string	"_BSD_SIZE_T_ "
+.LASF608:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF534:
+	.string	"__USE_XOPEN"
+.LASF819:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1316:
+	.string	"IO_PINBYTAG(tag) IO_Pin(IOGetByTag(tag))"
+.LASF1004:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"OWNER_SERIAL_RX"
+.LASF858:
+	.string	"_T_WCHAR "
+.LASF988:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF695:
+	.string	"__S32_TYPE int"
+.LASF769:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1104:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF405:
+	.string	"USE_PPM "
+.LASF519:
+	.string	"DEFIO_NO_PORTS "
+.LASF807:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1017:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1025:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"OWNER_SERIAL_TX"
+.LASF1013:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1145:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF813:
+	.string	"INT64_C(c) c ## L"
+.LASF450:
+	.string	"SKIP_IMU_CALC "
+.LASF880:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF580:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1134:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF860:
+	.string	"_WCHAR_T_ "
+.LASF1022:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF932:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1091:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF836:
+	.string	"__SIZE_T__ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF980:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF907:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1315:
+	.string	"IO_GPIOBYTAG(tag) IO_GPIO(IOGetByTag(tag))"
+.LASF671:
+	.string	"__stub_chflags "
+.LASF457:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF406:
+	.string	"USE_PWM "
+.LASF851:
+	.string	"_SIZET_ "
+.LASF963:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF739:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF407:
+	.string	"SERIAL_RX "
+.LASF968:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF444:
+	.string	"GPS "
+.LASF1259:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF398:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1027:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"OWNER_USB_DETECT"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF685:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1003:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF658:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1071:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF641:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF546:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF459:
+	.string	"USE_FAKE_LED "
+.LASF438:
+	.string	"VTX_COMMON "
+.LASF1188:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF487:
+	.string	"USE_ADC"
+.LASF1235:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF805:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1360:
+	.string	"OWNER_SONAR_ECHO"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1405:
+	.string	"port"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF448:
+	.string	"SIMULATOR_BUILD "
+.LASF491:
+	.string	"SERIAL_RX"
+.LASF942:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1110:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1329:
+	.string	"short int"
+.LASF589:
+	.string	"_SYS_CDEFS_H 1"
+.LASF975:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF514:
+	.string	"USE_I2C"
+.LASF556:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF644:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1417:
+	.string	"IORead"
+.LASF957:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF763:
+	.string	"INT8_MAX (127)"
+.LASF515:
+	.string	"USE_SPI"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF619:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1146:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF446:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1089:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1376:
+	.string	"OWNER_MPU_EXTI"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1040:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1160:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF511:
+	.string	"VTX_CONTROL"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF483:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1408:
+	.string	"IOInitGlobal"
+.LASF1064:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF667:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF486:
+	.string	"TELEMETRY_LTM"
+.LASF617:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF940:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1292:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1351:
+	.string	"OWNER_ADC_BATT"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF620:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF701:
+	.string	"__SWORD_TYPE long int"
+.LASF1389:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF902:
+	.string	"IOCFG_OUT_OD 0"
+.LASF855:
+	.string	"__WCHAR_T__ "
+.LASF454:
+	.string	"U_ID_2 2"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF628:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF961:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF714:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF462:
+	.string	"USE_FAKE_ACC "
+.LASF1159:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF797:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF844:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF473:
+	.string	"USE_UART1 "
+.LASF869:
+	.string	"__DEFINED_wchar_t "
+.LASF953:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF926:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1157:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1341:
+	.string	"GPIO_TypeDef"
+.LASF402:
+	.string	"USE_CLI "
+.LASF439:
+	.string	"VTX_CONTROL "
+.LASF693:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF809:
+	.string	"WINT_MAX (4294967295u)"
+.LASF437:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF426:
+	.string	"TELEMETRY_CRSF "
+.LASF1407:
+	.string	"IOGetOwner"
+.LASF919:
+	.string	"EXPAND_I(x) x"
+.LASF770:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1073:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1206:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF979:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF455:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF930:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF977:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF655:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF731:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1011:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF762:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1369:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1295:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1034:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"IOToggle"
+.LASF1305:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"_DEFAULT_SOURCE"
+.LASF433:
+	.string	"USE_RCSPLIT "
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF474:
+	.string	"USE_UART2 "
+.LASF709:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1409:
+	.string	"IORelease"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF403:
+	.string	"USE_SETTINGS_INDEX "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF870:
+	.string	"_BSD_WCHAR_T_"
+.LASF777:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF993:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"uint32_t"
+.LASF559:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF711:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1370:
+	.string	"OWNER_FLASH_CS"
+.LASF1046:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF784:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF989:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF564:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF568:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF723:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF518:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF866:
+	.string	"__INT_WCHAR_T_H "
+.LASF662:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF480:
+	.string	"USE_UART8 "
+.LASF684:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1176:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF637:
+	.string	"__always_inline"
+.LASF715:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1051:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF452:
+	.string	"U_ID_0 0"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF716:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF976:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1391:
+	.string	"resourceOwner_e"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF396:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF592:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF756:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1343:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1386:
+	.string	"OWNER_VTX"
+.LASF1262:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF687:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF414:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1084:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1323:
+	.string	"RCC_AHB1(periph) RCC_ENCODE(RCC_AHB1, RCC_AHB1ENR_ ## periph ## EN)"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF581:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF691:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF688:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF895:
+	.string	"__bool_true_false_are_defined 1"
+.LASF742:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1194:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF582:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1365:
+	.string	"OWNER_I2C_SCL"
+.LASF966:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF428:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF413:
+	.string	"USE_SERIALRX_SUMH "
+.LASF833:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1248:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1029:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1419:
+	.string	"IO_GPIO_PinSource"
+.LASF669:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1166:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF501:
+	.string	"TELEMETRY_HOTT"
+.LASF718:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF476:
+	.string	"USE_UART4 "
+.LASF1220:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF460:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF920:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1223:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__USE_LARGEFILE64"
+.LASF1098:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1041:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF490:
+	.string	"USE_PWM"
+.LASF886:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1366:
+	.string	"OWNER_I2C_SDA"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1095:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1345:
+	.string	"OWNER_PWMINPUT"
+.LASF915:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1202:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1308:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF419:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF678:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1289:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF747:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF946:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF802:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF969:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1340:
+	.string	"BSRR"
+.LASF565:
+	.string	"_POSIX_C_SOURCE"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF741:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1372:
+	.string	"OWNER_MPU_CS"
+.LASF472:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF783:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF477:
+	.string	"USE_UART5 "
+.LASF710:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF646:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1193:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"TELEMETRY_IBUS"
+.LASF505:
+	.string	"TELEMETRY_CRSF"
+.LASF974:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF925:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1269:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1453:
+	.string	"libc-header-start.h"
+.LASF1461:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/drivers/io.c"
+.LASF1439:
+	.string	"/usr/include"
+.LASF1465:
+	.string	"stdint-intn.h"
+.LASF1468:
+	.string	"stdbool.h"
+.LASF1432:
+	.string	"src/main/drivers"
+.LASF1466:
+	.string	"common_fc_post.h"
+.LASF1434:
+	.string	"src/main/target"
+.LASF1464:
+	.string	"wchar.h"
+.LASF1454:
+	.string	"features.h"
+.LASF1472:
+	.string	"rcc.h"
+.LASF1457:
+	.string	"timesize.h"
+.LASF1473:
+	.string	"rcc_types.h"
+.LASF1442:
+	.string	"stdint-uintn.h"
+.LASF1438:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1440:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1448:
+	.string	"io_impl.h"
+.LASF1463:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1446:
+	.string	"resource.h"
+.LASF1469:
+	.string	"io_def.h"
+.LASF1470:
+	.string	"utils.h"
+.LASF1436:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1449:
+	.string	"io.c"
+.LASF1452:
+	.string	"common_fc_pre.h"
+.LASF1437:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1444:
+	.string	"stddef.h"
+.LASF1455:
+	.string	"features-time64.h"
+.LASF1460:
+	.string	"stubs.h"
+.LASF1447:
+	.string	"io_types.h"
+.LASF1445:
+	.string	"target.h"
+.LASF1458:
+	.string	"cdefs.h"
+.LASF1462:
+	.string	"typesizes.h"
+.LASF1467:
+	.string	"io.h"
+.LASF1471:
+	.string	"io_def_generated.h"
+.LASF1451:
+	.string	"platform.h"
+.LASF1433:
+	.string	"src/main/target/SITL"
+.LASF1435:
+	.string	"src/main"
+.LASF1459:
+	.string	"long-double.h"
+.LASF1456:
+	.string	"wordsize.h"
+.LASF1431:
+	.string	"src/main/common"
+.LASF1450:
+	.string	"stdc-predef.h"
+.LASF1443:
+	.string	"stdint.h"
+.LASF1441:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\275\005"
+	.string	"\244\b\t\001"
+	.string	"\026"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\001\002\006\002\001\020\311\256\332\347\002\002\021\324\314\220\352\022\234\253\215\342\007"
+	.string	"\023\024\240\342\234\212\n\025\240\342\234\212\n"
+	.string	"\022"
+	.string	"\0303\270\313h2\321\026\016"
+	.ascii	"\340\f8\212\315S9\t\264D\231\032\203\030\256\202}.\233=5\036"
+	.ascii	"\330\342\262\2279\333\323\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375 \264\375\002"
+	.string	"\024\003\250"
+	.string	"\024"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022"
+	.string	"\001\023\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\025"
+	.ascii	" \340\234\003s\024@\3001g\200\300V/v\003\021\020\003\202\003"
+	.ascii	"\034\203\311\rX\001\343\300``\b\030\007\006S\231\366\022\334"
+	.ascii	"\006\332"
+	.text
+	.section	.gnu.lto_.inline.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`y\006\005\016"
+	.string	"V\021<4Po\322\001U\226ao\2046"
+	.string	"Q\023"
+	.string	"\213\335\\U\005\277X)\177\004\001d\301b\254\330\321\244\321\246\032a\273\231Y\335\3053\370\330\260\204l\262\211\2242\245'"
+	.string	"0"
+	.string	"2"
+	.string	"V\277\243#\037\021\350Y5\352j\235Z~m\365\346}\177\323\365\355t6\003\204\260\301N\373[B\b\241\332\006\256<\001\022\027$\227/\353U>\260\370\317\311S\250\024\242\032\317\216\032}\027\363n)R\222\002A9\027sn\246-*\024\033\367\363\266\324\313?\301\275\\\b$\223\225\020\306\001\030l\337>\003\034\036n\274Zz5^\316b\227\225\277\307Y\251p\007\na\230.\276d2;\"}\2408\016\017\222\351\255\217\220\017\001.\3304\306x\332t\2141R&\260\375\215\372\312[\007\262g\027\201L\2348c\271\316\364;Yb\371dT\026\350dDE\207\303\245i\\\250AU4EbA\n\n\225\345\320\"\231\241\232\007\022"
+	.string	"t\025\004\222\220b\004!&\210B\211H\242\222$Qb\220<\206H|\230\034M9\202\223\371\263\271Ia\204|\261\003\342\225\354\212"
+	.ascii	"\3662\373G\022\255{\223\303\200\353\333\245\230\275&\332Bf\333"
+	.ascii	"\003\263\204\201M\253\206t\305K\2453\002bl\250\225\247\267\334"
+	.ascii	"\tt7\n\026\340x\205\267+\376\223\352\335xcU\265r'\377\233\306"
+	.ascii	"Q\017\0372\220\245\025\"\0025\323\3000\352\302\252\241\r\247"
+	.ascii	"\004\255\206\346\216B9\006TM[\232\223IMr\276\335l\\\363\204\277"
+	.ascii	"\2619\024\362\203\031UL\203a+\213vro\317\b-\236]\231\345b\247"
+	.ascii	"P\031\307\313h\326M*\310)\205uy"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375 \350\315\003"
+	.string	"\022\006\024\036\240'\351\377\243\377\342L\252\252\306\375\377\337\374\367\342\263\377\377\375mk\215\266%\215l\231dLJ\276\201,\020\006H\357@\374\245\b\002I\352YO\371\"\207\225\374d+>1`A|A\275\232\346\303\360\303L\026\031\247je\375\326\253\347\201\213\020"
+	.string	"`\b\240F\023u\013\214S\031\254\346\240G\r\021(f\211R\346%\b0\004\214S\031\f\347\020T\306\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\027\240)\035?\360Os\377\377\307U\005\321\376\267\377\355\177\373\177\"\204\354\237s\324L\346.W\271\311E\356q\215Y|\304\034\2460\203\t\314\347\232j\246\317\0363\203\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`U\001\275\005"
+	.string	"\202\306\024\035\240'\351\377\347J\374\377\277\253\252F\216\252+#v[KZ\2235\362\t5\273\211\224)'-|\"$\256G\210\210\227\345E:a\220\036J\341\200\327P(\025<R~\264\253\362\230\030@\347\030h"
+	.ascii	"\314\314\254\365\235~\337sn\345\252\374\355\310\344\036\002-"
+	.ascii	" \320\302\262\271\rf\262\261\326\310p\003u\335\2708#c\374r\200"
+	.ascii	"\f\253N~\254)\202i*A|\230\n\006\026\0260\034\201\tS\020aF%\214"
+	.ascii	">\2171wV\232\004\266R\031\340\f\023\251-Q+\360\013\353]\022'"
+	.ascii	"\360\336\306\3058\334\323\320^9k\312p1\307\202Q\333\373\230\325"
+	.ascii	"\342\342\271\001"
+	.text
+	.section	.gnu.lto_.lto.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"}\007"
+	.string	"\222\01656Po\322\001\200\276\2325\350"
+	.string	"\031&\304\345!\260\f>\221\271]\365\342(\217\206\362\343\303\026#\220\320B\357\314\214\033\270\037\306\004\301t\306\271\316Mb\t![\246\024\3266\nZ\002'k\300"
+	.string	"\342\246\316\260\270A\217\354HlR\203\017\033\307\001f\322\0031\215#DG\302\210\030%\274\346~\332\327\371m2(^\205/\215\325\027{\202\364m\330\237\366u\366I\377_\225\302B\240\262{\021\003\263+\324\t\210\355\333\237\037\373\262/\224\003\325\227N\232x\300n\367a\262;\021l`\235\262\355\213|\344cN3;F\025\211\207E\211\313\356\204\236\037\250NY\027\250N=\216sW\316\177\351S\bFKH\004\272f\030v\327\032\022\215\356w\333\005\266\027lw\001\b"
+	.string	"aE\001X<\224\205#\204"
+	.ascii	"\\\023\r1A\013?'\232\256\371\004"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"}\n"
+	.string	"\206\223IB \307*\035\200\344\305\023\004\021\301\215\301\315(p\334\337\341\273\3277\245UP%\tA\273\230\"\307\235D\214-\270e\230\"7\021\002\013\325\t\200%q\247\\\241\345\205\210\256\322\240\006\027\330\020!{\247\0245"
+	.string	"6"
+	.string	"6"
+	.string	",\222IM]Ia\024\254L\004 \354\326\317\365\r\227s\335\027.\347\250\312\311O\322\377\353\233\354\344\300\t5\362\211\261\330]\317\023*u\323\333\206\260]a?\023[R\213\260\b8\331\312\366\355\013 y\236kc\377UG_\022\223\214\t\006\200\301n\2258g\217\327\262\231\363\256\267D\256\260\253b\031\330\255\023\216\350\316\331\366\003<\273\333\361a! \035\3139\177D\031\026\264\312Y\363\2149\230-}=\006J9i\236\261\006\263\2354\273\226&M\261\277-U\331\236\246o\375s\273<H\340P`\003`\350B\f9\203<\035\020\305\007\314\340$\210\3414\310\021\303O4\206>\302\021\364m\204\037\215\017\034E\037Gc\221#4~\035\2428~^-\277-UQ\372P\322\222m\217\017 \273\016"
+	.ascii	"a\211\"3^\321hX-\360\332\002\236\232\370A`\256\341\326\231x,"
+	.ascii	"\201O*CQm\205\237xL\355$\003"
+	.text
+	.section	.gnu.lto_IO_Pin.5.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\265\n"
+	.string	"\026\324JB\020mj: \312Ha\002\343\031"
+	.string	"\024\001 ^\364\3413\200vj\337Wd\240\237\246l\375\023\320\031e\374\2566l\215\361\372\212X\021"
+	.string	"\n\001\034\207\350\364\350\206\bbH4Y\203\204+\006i[\246\0246"
+	.string	"8"
+	.string	"7"
+	.string	"~\206k\350\030\324Y!\024\0317|N$v\347V\361I\344\230\376\"rLR8x\005\375\217\277T\021R \261\301U\002`w\255 Qt\313\333\346\260\035b\177\022%\366\003\246\302`\373\366;t4\r\002\305\376h\342|\035\204&>cI\304\356\3648\346K\246\211\024\325s\360I/u>\031\334bwt\301\303\356\374pGv\3143\263\035\273k\361O\013\024d\026\216\371\034\211\021\202\024j\313\232\022W+o\272"
+	.string	"\t\241\262\254\250\326j\225eO\217\312\t\366\257\225#\333j\371\371\353%\021\201\320\030\261\373\240\025\234&\200\327a\316\\,\031\020\f7\240B\341uj\256\342u\333\346\323$\350\276\314V\240\303\020\330\270o\263U2\354\031\320|\333\001\317\3736m\206\277V\216\244\334\b\245\3076\202\243\300,\017"
+	.ascii	"a\211\"3^\321h\214-\360\335\002\376\232\370A`\256\3416\232x,"
+	.ascii	"\201K*\231\244\262\007\355\032))\246k\222\001"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\350\001\255\021"
+	.string	"FbwG\360\320&\035\273p^\236\343\225F\320\321\233\t~\210];\250\274no\"\257\363\350\324\344\321\255\205}\263&\264~|X\211\004C'}lq|\264,4}\031\334\273\302d\021\270\202\3171\345\025\324\255\021\262\267\224)\005a"
+	.string	"c"
+	.string	"d"
+	.ascii	"0\037\3479\340\303\224\003\230s\306F\305\234a\002\037 ]:$\331"
+	.ascii	"\366o~\002\264}b\030\342u\031\232+Fc\316\351u|\300v\031\037`"
+	.ascii	"\273\\\020\007\037WA\377\302\343\211`f,\257\r\337\310\340\347"
+	.ascii	"E\202\343\325\212\006`\320\016\273\266\274TT9\324\234\323\312"
+	.ascii	"\362\322p\313\333n`{\201\255\020\002\227R\035\243z\243Z\243\372"
+	.ascii	"%nDP\201\030s\272\324lL \271\202\306\217\235\307\357qg\360\344"
+	.ascii	":\376L\006\27501\347\354.e\250\026\006\0072\264\256\204,L\331"
+	.ascii	"^J.-\032\242K?v\322]v9\036\366Q\234|\007\345s\345\245\344\332"
+	.ascii	"\261!\2323Dpi\020\322\345}\035\320\356l\323\f\217\353\003\256"
+	.ascii	"#\226\326~\330\317\301U\003\304\343\357)JHs\316\017\237fR\301"
+	.ascii	"\027\201\262]r+`\b\207\2455\253\254H\210\347\021bX=7\311d\b}"
+	.ascii	"\366\273\310Z\270\220{\331;Xjd\235\325\354\r\026-\036\326)\233"
+	.ascii	"\\\221\235!\025\255\341\303n\232\301\bM5\262\303\226\356\007"
+	.ascii	"\373q\356\214-\325\244M\315=|)\222\007\237Jz\004\344cDAHJ\344"
+	.ascii	"\304\361\251\324\251\323\247\362JV$\026T\253\021o\202*D\202\227"
+	.ascii	"Z\225x'\002\376(\220\254<\223\357[y\235m\207\254\307\2713^\240"
+	.ascii	"\233\f\260\227bl\216\364\364\270-\266\343\032\305\332V\334%\355"
+	.ascii	"M\267\317\246\273\313\305V\216\300\373g\373\352F\237\225\016"
+	.ascii	"-\255\231\333\357\213\002\" @BE\330\321\003\302\022P\3150\\\207"
+	.ascii	".w/\357\246\305\207\037\212\271\020\355\334\3560\306\005\212"
+	.ascii	"\375\271\013\177c\217\353\323b\260\3338;\334\211Ag\354\3570-"
+	.ascii	"\004[sE\205k\253\024\205\304,\313\326)\263\030\364\326Dt;\212"
+	.ascii	"\210\344BI\r4\327\201\002"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`o\002\355\023"
+	.string	"\326\344\201H\360\360\2461{n\250\355\327\212\243&\301\021\223\341@\320Sd\377r\347\327f\371\226#8\303\235Nl\354\222\321\355j\200\356c\3566\365\270>K\036>>\016\304\304\225\351\361h\247\232\213\220\307E\360%m\357-\245\224)\005j"
+	.string	"o"
+	.string	"o"
+	.ascii	"\036\237\366{\3563\276\\9\200{ml*\356-\023\370\300w\353\362\263"
+	.ascii	"\355\357\234g\264\213j9B\366\232\\lf\343\336\033\252>\240\273"
+	.ascii	"\255\017\320\335R\021\037_\351\034\375\237\327\234\231\031.\262"
+	.ascii	"\013\257_\232\251\271\3104\234V\0069Y\211\016\031\254\032P\302"
+	.ascii	"\335\366\371\"c\231\323\013\271\367z\272\3102\334\366\266\035"
+	.ascii	"\330^`\317\026\001\323\325N\323\227\377Dy<G\005b\334\033\363"
+	.ascii	"\204\343\032Y\242\033\177v!\177\310\240\307\327S\3708{$#\347"
+	.ascii	"\206\003M\334^1\260\233\333\354\224\237\360\203\350\217\022x"
+	.ascii	"[\013\201ahP\223K\325\360\370|-\345\345J'"
+	.string	"\203\202\251\301-\321R\354\317^\340-\350\343a\037\305\353@*\277-2\250\030\220\316\322\275%\202[\203|\037m\320N\271\bL1'\377\366\333\376\r1\034#!\237\234\210\302w\357\375\360WX\020}\022*T@R\0179\237<iLHB\207@C\016=E\243\201\373ch/nW\2215\034$\232\203\305\313\007\352\225nR\022\240$\226y\303\267]\244\003\322\203.\302\001\306\244\257]E\316&\203 \356l\262K\330\244!\354\327Kmlo\372\363\246\275n\272\353\246m\027,\223\007b\313\272\004\344\243D\301\b\213d\325!\266\246Y+\261\025\242\270L*\264\\%a\204\326\310I\310r\241\204+\002\026%\230\270\302\t\242\350\n\301\222|\275\324\306\324h\007\306v\024\215\216\323\\\375\243/\266?\252\")\314~\355\377\371ab;Fd\355\250G\237\272\213:K;\352\315Z\234\306;\327Uji-j\361"
+	.ascii	"\233O\246\264\322\0072 \200\"\2423\333aD1\220\361\300\025{=\301"
+	.ascii	"\373\313\227G\323\"\340\217\264\201a\364\226\266\235r\205\212"
+	.ascii	"V*\351\332-\235\024\227\003\"\335a@U4n\236\261\212Q\216C\360"
+	.ascii	"O\214i\305\226\020\246\013!%\241\333)\331\336^Bq\031\303\252"
+	.ascii	"%\244\035\342mR\265\267\277\224\2514l\007c\003\333\321%~\241"
+	.ascii	"\317\322\256*~w#\251A\"z4\255\200\002"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`o\002\365\023"
+	.string	"Fe\203I\320\360(\035\373'"
+	.string	""
+	.string	"\252BQ\317\374\230U\013~\372\354\337\216 t\"\272pb\226\231\360O{\300'\245\3600\211\033\t\016co\337'\002<'^dn[CD:\026\342\032M\205h\3622\006\251\203f\255\221\275\367N)k"
+	.string	"n"
+	.string	"o"
+	.string	"7\220K\373>\377\231}l9\200]\034\024-v\307\004>\200z\365\210\262\355\367\374\304\314\356\321q\204\3557I5\\\216\335m\255>"
+	.string	"|\245\017"
+	.string	"\276N\021\237\235N9\363\201Nwj`\300\330.\234~\311\203\016\306\246\341\22320\262\225\370\260\321\250\001\033\274\357.cl.R\236Fv\327\022\306\226\341\256\267\355\300\366\002[\312\b\246Uz~\374e\352\364\342\250"
+	.string	"\213\335\231\037\217\365\325\242\034\037\367!\237\310\241g\262\257\360y\365\250\206\020/4!$\233\241\345|g\257<\205\0374\201\230vv7|\325\215\32004\270IR\341"
+	.ascii	"\271\274n\345c\013H\223\222\271\341-\345V\354\343d\341k\370\003"
+	.ascii	"b_\205\3547\226\357\013M\252v\343Y\332\035\021\274Z\004\365\231"
+	.ascii	"\035\332\252\362\367\357\376\r5\035\337\220S^D\001\265\273!\276"
+	.ascii	"\013\0130\237\004\313\024\240\344#\312\237e\216\ti\350\020lD"
+	.ascii	"\242\253r7x\377Ln\206\320W\242N\007i\366\210\021\363a\272\005"
+	.ascii	"\224\323\344\246\344\"u\370\273\223t@z\320I8\320\220\363\272"
+	.ascii	"\257D\271\303!\210\225;\354\221&g\b\373tw\327\023\307>I\243N"
+	.ascii	"\322'P\032\004\245+(\003.\224\007\260W\365\211H\310\211\202\022"
+	.ascii	"\227\t\353\003\366\222v\261`\257\226J\f\245\302+v\322\212\360"
+	.ascii	"*Ii\271b*-\026\001\303$\240\304Z\023`\260X+\034\305\323\2358"
+	.ascii	"\236\276\036\231\335S6<M\222u\324\214\261\215\232+q\322\354\353"
+	.ascii	"~\240_\246\326\363\211\024\234\247y\325\335\003\353\004\347\t"
+	.ascii	"\367\3224\273\215@:\353\244\275\227\032\232\374yN:\317Tk\022"
+	.ascii	"\0030 \240\"\"\263n\241E1\220\361\300%\366\372\203\367\223/\217"
+	.ascii	"\246E\307\017\2119\035\331\271\241C\347^\241\"+\225\273\366\227"
+	.ascii	"N\306\345\b\221N\030\242*\216\233\217Xu\224\263\020\332\235-"
+	.ascii	"9\314\027Bj:\215K2\336X\262\270\032\303\332\0224\333T\355\355"
+	.ascii	"/e*\215\332\301m\340;\272\304_\350\273\264\253\210\347n\244l"
+	.ascii	"\220D\217\246\315P"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\330\001m\021"
+	.string	"\006\242vF\340\360&\035\276\207\274#\200\361\217\364\201\231\320;\232oC\2069\301\324\207\354\234\t\3150\210\347@Fpj;\352A\336\253\0346\t1\375\204\030\b\201\323\232\001\230\361\216_\002\2116.\313|#\034\315\222M\244L)`"
+	.string	"b"
+	.string	"d"
+	.string	"1\177\3470\326\303\227\007\330\315\321a\261\033.p\202\323\243\303\223m\037\305S\260l\241-\f\001\036\307h\246\207\306\356z\037'\300=n\027\300=*\210\263\276i\262|\230o#6.h\300\r\327\255\001\f\360\204\007\350\332\020\030\001=\366|\2011\231&\222\335u\322\200\032\356x\333\016l\217\330Y\022\017\377-\2465\246sK\377d\232\021\303@m7C\315\306\016\305\026%\374\236\373\370?\356\314j9\217O3!-\351\354n\3678#q](\3011\352\300Y\370\302\325p\274d*\216\036\375\236\226\356\261\343"
+	.string	"b\177E\313e._\231\032\216\031\031\354h7T\360h\221\323\343}\036\226\335\331\035\"@\236\017\0314s\243\225\265?\366\333\320\222\206|\254\362\240\357\264\273!>\020\013\005\177\204\013\367\310\351\200\242\235V\326\2344\220\310\347\020nZ?\357\230\325\210N\3731\310(\311\330\364\263\177\264R\311IK\322\245\027/\017\352\027n\323\023YQL\326\360c\357\240!\021m*\331\241+\365\203\375m5\307\216i\023\227\346\002\251\224\007\237*\032E$\004\205\201I\352\004\345\361\251\322)\324\247\362VV),\252\025\212'Ae\242\342\245V+\036\252\200\277\t)+\257\302\367\255\274\316\266\303\3265\307\026`$\324\244\217\235\343\006\326!QW}\331V5IK][\352\201[\2103\351\227dL\270\262f"
+	.string	"y\265U\021\270\323\244~\304(\2149\275\006\037"
+	.string	"g\t%N\007\331\332\n\313\254K\307Z\362V\261[V"
+	.ascii	"E\345s1\370b\261W\366\203*\246q\373B\030\256\211}[\241\277\n"
+	.ascii	"\023\n\301\216\\\221\205kG)J$f\301\262\245)\263`\320\305\232"
+	.ascii	"\210\252\035 \"\222\2720\252\032W.\005\005"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375``\002\255\023"
+	.string	"\326d\201I\320\360(\035\266\307\022r*v\224/\274\310\330\370\341\223\324\216R\250<\001\332B\273\322\340\302Y\201\223<\346\231E\364\322\340\370{';\205\030n\301R\017\037\036\b\221\306\213\0308\301\273qd\252C\325\002\026\033!\204l\231Ri"
+	.string	"o"
+	.string	"m"
+	.ascii	"!_\373<\237\271n\276<@\2559;.j5\023\370\200\351\236M\223m?\305"
+	.ascii	"w\\6Qg\212(\217\223\203\371\340\250\265\212\250\023\370\356u"
+	.ascii	"\027\360\335\243!\356zG\327\345\277\347\235\216\315\031+a\336"
+	.ascii	"\221\330\300\210\225\033N\273\0052J\024\037\345\2533\200t\273"
+	.ascii	"\355++cv\301\222Z\2537Vj\270\275\333n`\233\304\336[\353\316["
+	.ascii	"\323\233\377\232N54@n\324Js\352\250E\336\220\t\337\3478_\310"
+	.ascii	"\241]\255\267\360o\240\215\234N\020RX\006\265d4\025\267\331-"
+	.ascii	"_\341\003\321\2363\274W+ya`\200\223;\215\b\371\276\326r\363\345"
+	.ascii	"\253\361\230y!%\375\264\330\367i\205\367B\016!\366Y\264Nsy\225"
+	.ascii	"\251\361\200\321fI\265\232\b\356y\304t\227\035\332'\232\264\243"
+	.ascii	"\213\203\355 \367\374m\277MM\251\b\347\b\037Z1\325ZE\374\027"
+	.ascii	"\026F\237\204\013\035p\304C\356\351\255\225F\270?\270!\205~\372"
+	.ascii	"9o\177\006\231\245\240\243\310\232\222\021\315\305\220y\240~"
+	.ascii	"\371\226\242\320\216b6\207o\273I\222\321\201n2\243\306\322\327"
+	.ascii	"\216\"w\311\341\207\272K\266\371Z\n\302~Wi\216\r\256Ap\375\201"
+	.ascii	"k\357\013*\025\007\343\312s\312\210H\212\202\023\025J\352c\\"
+	.ascii	"\255U\251q%\262\260T*\254X)\242\204\325\311\212\250b\261\210"
+	.ascii	"\251\002\036'\250\260D\n\343\310\022C\223|Wi\216/\314J\320\217"
+	.ascii	"\336v\217\233Y\207M\035\2442\333 E\221\364e\277\366\367\3743"
+	.ascii	"\260\263\210\354<\nr\023}\037}N\346\304kO\003\330\216\3726\b"
+	.ascii	"\253\3571\217\242b(\214i/ \260\"\2322\333\241Q\370?^\245%\320"
+	.ascii	"uX|\366]l\266\344\355b3w\b\023\t\251@jku\242Q\216\020\351\205"
+	.ascii	"a\252\342\270\361\212U\213r\024\202ib\235\027ZR\230\025BjB\267"
+	.ascii	"#\331\336.A\\\217a\315\022\322\016\3216)\330\333_\312T\032\265"
+	.ascii	"\203\333@vh\211\273\320giO\025\237\273\221\256A\222\244+\327"
+	.ascii	"\201\002"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375``\002\305\023"
+	.string	"\026\345\202J\320\362&\035.\241B1\026\016q\232Q!\f\232_\333\f\032\217i\236\374\220lS:\352\332!\026\376L\270\3340\231\353\343\036+AT\"m\322Y\017\260\253\245\223\252'\321\007\200\227\2018\243\207m;z\232\326\b!d\313\224\002j"
+	.string	"q"
+	.string	"n"
+	.ascii	"M\"_\373>\237\301~\302<@\2559=1j=\027\030\001\352\236O\224m\277"
+	.ascii	"\305{`\366Qw\356\230\327)i\202x\324ZE\325\t|\367\272\013\370"
+	.ascii	"\356Q\023\207\275\243\013\363\377\363\216gGGi\306\274+\271\231"
+	.ascii	"Q\232\036N\273\0065L\026!f\254;\260t\273\355+3evA\223Z\253\267"
+	.ascii	"4;\334\336m?\260]b\357-\235\267\246?\377E\201\200\300\221\340"
+	.ascii	"F\255\034r>*\222g\244\302\017:\316/rh\330\3530\374\033\270\343"
+	.ascii	"\211\250\304Rh\022\275d4\027\267\331.\007\362\207(\220\020O\255"
+	.ascii	"5\274W3\211ip\240S\202\234\020\371\276\346\362\023\346\263I\325"
+	.ascii	"\304\226\230\204\\\354\007\275\302{a\b\021\373/^\247\275\274"
+	.ascii	"\316\330\244hh3\246ZO\005\367L\202:\314\016\355T\035]\034\315"
+	.ascii	"\017rs\277\355\277\2515!\341<\341F,\250Z\353\210/\003\303\350"
+	.ascii	"\243x\241\003\224|\310\315ykf\022\356\021p\310\242\203\b\345"
+	.ascii	"n\377\206\031'\242\253\310ZS\022}\242!\033A\r\363-M\241)\311"
+	.ascii	"l\017\337\366\023\246\244\017\375\304F\216\245\257]E\256\223"
+	.ascii	"C\022u\235\3543\266T\307~Wi\216\r\256Ap\375\201k\357[\007\254"
+	.ascii	"\025\bc\313\263\n\311\210\n\003\024V\312*dl\255Y\253\261%\266"
+	.ascii	"\270V.\264\\*\"\205\026\n\213\310r\265\210\253\002\036+\254\270"
+	.ascii	"D\013\343\350\022\303\223|Wi\2163\314R\320\217\336\366\024\316"
+	.ascii	"L\304\256\016R\231m\220\252H\032\263_\373\177\376\232\362\003"
+	.ascii	"\022\331y\324\300}\364}\364O3+b\2333\200\355\250o\223\320\372"
+	.ascii	"^zT%CcLi. \220\242\232:\333\241Q\370?^\245%\320uX|\366]l\266"
+	.ascii	"\344\235b3w\b\023\t\251<\265\265:\351(\307\210t\303\200\252H"
+	.ascii	"\334\370b\325\242\234\205\340\237Xg\205\226\020f\205\220\236"
+	.ascii	"\016\343r0\211\030\243\t\342a\361\0224\333\024\366\366-e:\r\355"
+	.ascii	"`6\220\035_b,\364E\332S\305\353n\244k\220&\351\312u\240"
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\245\007"
+	.string	"\362N670q\222\016"
+	.string	"\311\003\341`0\271\202\353\034x\336M\310\355\350%\305\254\261\364\373\335&\027\365\312\356\026\346\373\027\324\302@-\026f\330\330$\252:\251\237-\352f\033\221)\217\"\036F\016!\021\305g`\323\336\242\317\246\301\022G\312\320\270\021\264\320B\025P\304\225\340\347\340\355\202\304A\214m\343\240'\236\332e\203N\027\352\256T\342E\204f&_\315G\324\273F\276\234\314\314/\3257\266\275&>Z2\013,\231\03676\031\203\271\230\374\375M\357\371"
+	.string	"\030\206\367\276)U15j\224 S\265j\311\214\r+t\212\035;\377E\351\312t\307\211%\251\214\025\302\301jeF\230P\203\254\030\247\005Y\261\213\244]_w\005R\033}"
+	.string	"\240\314\374u\244@\372\325\037\341\207\370O\002\t"
+	.ascii	"a\211\"340B5@%\204\246\\\306\200\023F\252\225+\224<"
+	.text
+	.section	.gnu.lto_IORead.13.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\n\003u\025"
+	.string	"\206\346\211I\300\020\25312W*\220I\240\212"
+	.string	"\r\205C\376x\347=\351\\\357Hh,\364)\035\030He\326\267\013\020\2155\352j\016\227\264\357\017I\251f\b\202"
+	.string	"A\346\275\025\003\346c:\2107\213~7DW\360s\223-\267\224)\005n"
+	.string	"w"
+	.string	"t"
+	.string	"\tn-b\336R\233f\263l\025\320\007\245\366y\377\241\275\367\362"
+	.string	"\367\346\220(\272\367T\340\003\346\255\317\017(o\315\013(om\233\201\003\232k?uh\276K\201\013z\272\367l\325\021\257\235\254\264\346s8\371`\007I&\367\341\225lp\"\306\310\221\273\221\254!\r\023\367\235\316\344`(M\215\334{Mer5\267\275m\t\266#\330uC\357\375\326\324dI]KjZR\177E\240\007'\304\216Wa\234\227\346h\343\276\260F<>\361F\177h\3704\023\242P\314\025g3\277\037\342\314\037\336\fg"
+	.string	".\314\317\327\363\240/4\313\264\226\237~\020\002\020:8\274{/\353\300\221[\314%\211%\\\260|>(=\260\367RzP\321\334x\232n\375_\013\353\226\345\373\260\257\242\345@.\344\2659o\r\204\233\025\274\367\260\371\365\026'G)0\225\362\366\325\300\357\273J\227\244\203j\n\032\303\215T\314{o\210\317\202\005\305\337q)oS\265\203\251g\243G\323\340\f\245\340/\350l\302\257\202NJ\017\272i\303\247\t\312\311\326\003\357a\243Q\356H\322U\021=@\246\352\227\322\326\222\037\023\f\255\341\373n\001\251\bJ\306\245Q\366y\243ug\237\2745\3076\265\312\2446S\324\251\256W\205\030\314\332D$\304d\001\211\253\004\204#\006\243v\201\304`\255\025\331K\003Lf\322\312"
+	.string	"#Ai\271d+-\220\002\216\245\274d-\226XL\326b\235\266\223\267\3468\325\201\210#\362}\302ROHD\375ZI\326\031\333d\365\210\255\336\310\272;)kU\325/\341\216n\365\265V\322\210\263\271\321\243\315J\353q7\212\253\035\243I\216\3442\2059\343\320W\301\243\320\315\030(\212\212\001> \260\242\221\263z\241\243\350)\336\326\021\253\n\270L\326\365\260'/\353B\261\305-\352A\277\nNX\3620`\345\225\221\017\232\237#\261\240\261\f\007\2361tC\207\341,`\300\237\373B\340\312"
+	.ascii	"\353\007\325\306\327u\326\260\301\210\022b[\234\215\007y^eXM"
+	.ascii	"Y\332\315X!\030\303\322\3076i\273#`q\033\310k,\215\345\367\225"
+	.ascii	"\204\326\362udJ\3662OVV\\C\342\255\237\245e\344\352\320\264p"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_IOWrite.14.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`e\003=\027"
+	.string	"\246\251\223H\300XM:\202\365\314\024\301\007\235\b\034\323\206D\336\307\367L\245m \300u]\2255_'\024\252\025xG\333]\375+R\202\312]y\333\003hR\210\242(\246\005\211P\323\224\3126G\341clYj%\221\220-eJ\001z"
+	.string	"\203"
+	.string	"\177"
+	.string	"j3p"
+	.ascii	"\373\b\302\300\221\212jE2\337;\223\n\324\325~\355>`\267\331\\"
+	.ascii	"\300\234\263\032Ds\216\n\214\340{\347\361\004\274w\337\007x\357"
+	.ascii	"\f\263\251|\2441\277#Db"
+	.string	"'i\316\231\332\031\207\335\353\344*\314\017q\357$\252x\227\342\362E\274\221\007\346\234\240(BW6\340Q\"\350E\224I\320\347J\216\353\\q\304\021\252.3sN\253\t\021\305\355r\333*\333\021\354\355\021\367V-]\324\273j]\365\001\024\230\362\302\005mh\241\214\363Dni2\351\206\334\360\201>\344\023\375$\275\204d\202\304\240\027\316\315\007\320\313\377i\361\363\n0on?p\274\307\3671hX\315\201\370<\335\n'/j\307\315\310JL\td\343\b\334\201\272\036g\263\361rL'd7\216\336\371;5\340;\360\007\312~\220\232\337>\310\311b\234( \264\350\251%\3159&xg\b\337;\005m\023\f\324\006B\212b\350\220;\363Ax\246\325-7)\247\375\236\304\226\230\346~\235\233\234,\311Q:\032\362\205\027i}s\316\007>\021W\006\337\306\007\357\335ia\214l1\315Yy\304&C\247"
+	.string	"#F\364\023.\327\344B\377\242\364 RB\362\366A?\020\323,\206Y\222\2632p\0041Z\333x\336Z\270\031\335(\026_\347\023\224L\245*S\263\330\243L\227f_\316\235\331&\365\351\343o\372\324\337m\017+\226\204\260\325\2650\250id\036\320,P\255,\304\274\204-\365*&l\245^.\226\207\226\213&\265\241\245\322\220Z\271^\251\030\003\0169\260\\\251\016a\350J\201c\354r\356\3143\261\225yK\263\312"
+	.ascii	"\267\021\017\304\262\t.\027\307\336\265+<\211\n\311\206\025\f"
+	.ascii	"\2159g\350\275S-&\252\354\256|\202{\217Y?\022~8+=>?\341\220x"
+	.ascii	"\376-\3558\302\311\375\352\312'#\226d\232\223\335\322\364\001"
+	.ascii	"D\250A<\206\210c\304\024I \022\244\240I:\300\002\031!\273\r\021"
+	.ascii	"`\275S\225\213R\2306\003\341\302Q2t\243S]\347\306\343\214\264"
+	.ascii	"\215\335\364\263\202\351\f\223\277\025\333\260XE\032\005\263"
+	.ascii	"\316\273\316,\245@\2030\300\310\373}H\305e\316\234xm \035p\205"
+	.ascii	"\275\241\"\313\031\257:\227T\305\316\370\277\251\231R\f`\210"
+	.ascii	"*U>\337\250\004n\220\213E[\3365\025\013@\304\025K\303\020ne\255"
+	.ascii	"+0\2077drm\035\004\274\002\255\251\024\001\3737\227=\232V\001"
+	.text
+	.section	.gnu.lto_IOHi.15.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\275\002\265\023"
+	.string	"\266\"}I\340.'\035\016I\315\b\021\321\213a\206Gy\321\265\372\272\273\274\223]`c\306\313B\355p>8D\013\377V\214\024\373E\177\270\207\004gr\327E\210\267\0073\330\340\r/\336\t\225\006#\030<\002i\320 \225l\262wJ\001a"
+	.string	"m"
+	.string	"f"
+	.string	"\036\001_gho\270||\332\367\371\217\353\261\226\007\330\305\321\031\332-\017\270"
+	.ascii	"\370\352\362\003\276W\360\002\276W\273\354\026/u\366\265'\230"
+	.ascii	"\332\322\356\212\264\303]\367\350t\371(\230\313\275\f\247\036"
+	.ascii	"\002\0201:\016\330\313\013q1>\\\3669\003{\231S\203dw=e`5w\275"
+	.ascii	"\355\005\266\025\3304$\007i\220M\316\f\312\242\\\232\235\323"
+	.ascii	"\026U\242\035\037\350:_\bg\242\025\324 \327\223k\321\274v\200"
+	.ascii	"Z>N\206k\001\330\227\331\b\236\333\374\233C\273V^\3725\r\f7\021"
+	.ascii	"\273\033\236F\362\212Y/h\347(\204}|\236\026k\371.l\314\314~\222"
+	.ascii	"^\375\331J\370\032\336|\330/\261r\022,\336\332\224[\223\340f"
+	.ascii	"\311gi\2674\360\032\033+\\\0241%\331\034\341D(\340\356\212\370"
+	.ascii	"',\214\276\007\226\357\265\322\016\244\0309w\2367\230\221\355"
+	.ascii	"\0176\220\267\243l;\243\327\016\036\205\030bR\242\364\264{\220"
+	.ascii	"\263\311SH\003\345\300CC\242n\371(5\231!\275L\031\276\354\250"
+	.ascii	"\334\316hg\223]\276&\315\261\357\355\356\232\342\330\032\323"
+	.ascii	"\3377]\037\373i\235\016)\025\203qU}2\"r\022R\2222\001\341\030"
+	.ascii	"W\323)\220q%\252\260T\025V\254\023Q\302\252\004EL\261TD\020\002"
+	.ascii	"\036'\250X\"\205qd\211aI\336[\212c\022\222\276<\232C\355\324"
+	.ascii	"U\250R\260 t\350\354n\312\367:\237d^TzJu03\310\271s\240\363\352"
+	.ascii	"(R>\033\f\235\320Q6\245\240\203N=I\271{\220\247\375\262\007;"
+	.ascii	" \320\002\0311\353\241\2102\211wa4\350\276#Y\027\"\273Y\316\034"
+	.ascii	"e\303\277\341~\2118\207\353\242\320\375*\030a\310\333\200.*\177"
+	.ascii	"\032\351\276\013\227c\201\271|\026\006!&{\354\247\2125n\031\206"
+	.ascii	"1\326\354\257\020\017\322<+\013\261ZN\262\303\330B\030C)\307"
+	.ascii	"\232\274]Q\261\266\r\3406Nc\367\277\"\255\341<\2323 f\235'{+"
+	.ascii	"\236\241\343m|{\321\302\313\217\355M\321\316\036"
+	.text
+	.section	.gnu.lto_IOLo.16.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\275\002\245\023"
+	.string	"v\"|H\340\356(\0352\221\247\027T\006\3108\f\354\325\330\255\324\277\375\317i\257R\220-M:s\256\210\203\224S\276\252'\347\216\352\037\216\231)\\Z\252\b\302+\"\206\021\262\003&\f\"<\271\314E\007-eZ\220F6\331;\245a"
+	.string	"l"
+	.string	"e"
+	.string	"!\340\353\fmpE\307\247}\236\367\270\036[y\200]\232\233\240\335\362\200\013\200\257.?\340{\005/\340{\265\313f\361\362f\177\333\320R[\332]\221\332\334u\217N\227\217\202]\270\227\341\324C"
+	.ascii	"\302%\247\001{y!\316\305\207\313>a`,s\236Dv\327\363\005&s\327"
+	.ascii	"\333^`[\201M?\002\323\007\351\020\n\233\031\232\242\334\230\035"
+	.ascii	"\214-\252B8\276\317s\276\016G\242\005\324\340G\347\247\025\363"
+	.ascii	"\302\361i\3718\031\256\005`Yf;9\267\3717\207v\245\274\364k\247"
+	.ascii	"\327\211\3604\221\227\313z@;A!\254\343\363\264\330\312\207!\003"
+	.ascii	"f\326\203\364\352\317R\302\327p\246\303\376\210\224\213P\361"
+	.ascii	"VC\2712\tf\226x\226vK\003\257\016\317(R\312aB\2629\302\205L\300"
+	.ascii	"\335\005\361KX\030}\017*\337k\245\033G1r\356<o0#\333\037p oG"
+	.ascii	"\331vF\257\035T\021\"\210)\211\322\323\316A\316&O\035\021\355"
+	.ascii	"\220C;\242^\371(%\231\035\261\314\027\276\354(\335\216\321\316"
+	.ascii	"&\273|MZc\337\333\3355\245\261O\323\3377]\037\373i\r)\025\203"
+	.ascii	"qU]\022\002R\3621\222\"\361\320\030W\323)\217q%\242\260T\025"
+	.ascii	"V\254\022Q\302j\304DL\261PD\017\002\036'\250X\"\205qd\211aI\336"
+	.ascii	"[Jc\021\222\276<ZC\355\324\211TC,\b\0337\273{\362\275N\245\227"
+	.ascii	"\026\225\236\322ZK\fr\356\034\344\274\272\211\223\317\246\224"
+	.ascii	"\323\035eK\002:\bC\007\351\347\034\344i\277,< \320\002\0311\353"
+	.ascii	"\241\2102\211wa4\350\276#Y\027\"\273Y\316\034e\303\277\341~\211"
+	.ascii	"8\207\353\242\320\375*\030a\310\333\200.*\177\032\351\276\013"
+	.ascii	"\227c\201\271|\026\006!&{\354\247\2125n\031\2061\326\354\257"
+	.ascii	"\020\017\322<+\013\261ZN\262\303\330B\030C)\307\232\274]Q\261"
+	.ascii	"\266\r\3406Nc\373_\372f\202\264\206\363h\316\200\230u\236\354"
+	.ascii	"\255x\206\216\267\361\355E\013/?\2667E;{"
+	.text
+	.section	.gnu.lto_IOToggle.17.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`<\004\335\032"
+	.string	"\366\255\244I\300\226Qc\302\202\341+\256Clu\315\226\332\217.\211\235\207\310\025\206\261*\317|\017\020\243\324\001\224\1770h\304~y3/O*g\224\021\n\372\337 \212\242\372\233\363\255U\374"
+	.string	"f\321\257\210>\005k\311\336[n)S\n\207"
+	.string	"\216"
+	.string	"\224"
+	.ascii	"\307\271$\203\264\374\274\216\330o7d\016\215\314\345n\364\356"
+	.ascii	"=\027\334\032\002y\313\022\222\272\226S\373D\307\021\273\r\347"
+	.ascii	"\001\356\375"
+	.string	"\201\301\273\367d`\005\344\255\317\017\020o\311\013\020o\035\263\233\374tq\237\003\232\361\360\335{W\265\305c\027mXi\314\317\271\250\252\235\2705\361P\245\366!d\271\367\2265\035ZC\0073B\350Tj\262\260<\202\212q\334\351N\r\004\245\343\313\275\327TD\255\304=\3366\313\366\004;\034\021\267\376\330$\265*5R\223\277\331~\373\333]Ej*R?\005\201\317\007E\213\241\252\344\274$\202Q\367\210]\002\372\355\267\357']\311_\322\031\325\360\016\370$\361!\332\t\355jH\310\200\222j|]\016]\r\200\253\203\253\021t$\277\207K\307n\211\b=\266\371\016\377\310\376(\342\363\215^d!n\350\303\206\217\310W\326ZNod\303\021i\251\035\034\216\336\255\237\263)o\313\236\026\373E6\347\341!\274<g\202\036\037\321\220\004\362\226\006L3\036\231['r3\004\203\314K\274}%\360\302\266#\223"
+	.string	"iJ\276p!/U\321\223\322\322UEOx'\243\204z\273\025 \355\347d\254\277\221u\254\177\232E1i\360\307=%\003*\350\327C\262\353@2\220\367\336\007>\023\207\031\037\206\207\272\342d3i\3204WkB\272\205\024f\217\253\212\202M?:\271\204\006\357\367\304\326\033\235\305\244@\323$\250\246\272\"h\207S5\216h+\f\316I\207B\361q\257"
+	.ascii	"E\3739\271\024h\2372ZY\330\017\003"
+	.string	"-\031\n/\227\315@\303\232\t\035\003\341AL\003V\013\306E\345\345\242n\271\274\\+\032\230L\007\027,f\245\301\305\232Y\265`4+\027\003~m\220\201\2558\274^\260Uy\232\017o\375\361\213Yebe\341q\310,\027\246\352\230\2731\333\325\261\326\272c\327j\263\216d\305E\001'\036\363F\016<u,9\001\356\375\361\34195D\203\366\353\231;\325\256F\255/\246M\001\270\231\304\261\246\352\237@D\311h\320);\241+\tQ!#\274\021i\205\3011\321\241P*\2555^\250aD\304\020c\246\206$)IA\322\001\260\002\031)\272\016\021\220)t(%\225\302\316\032!\2452\264\231\251\037?e.M\024\227K8\025\3254\201\342\025\2561\302Ll+oi\241\210q\033Wf\371\f\333{\246\205\351\217c\316\336\205\321\264\303\004\244\016\201\216l\333\366\"\033|\363\016\2636\205\\\327hX\201\035"
+	.ascii	"\024\275\234i2\272\345\362n\264\t\210\2713\215a\355?!\263e\315"
+	.ascii	"'r\232\2520\242\260\345#E\367\236o7\372\350\251\277\276\320\b"
+	.ascii	"v\021Pdvc\214\333\316\273\373\265Lw\002!y\363\264\304\272\341"
+	.ascii	"\026\300a\266)\346Ghw`\2559\035!p1\n\253\300\360%z@\357\336\351"
+	.ascii	"\236G\253"
+	.text
+	.section	.gnu.lto_IOInit.18.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`O\001\205\016"
+	.string	"\026\333bF\340\264&\035\020\0360>F\370\035\n\342*:6\216\262:\242\265(\212\006\036\260\213\243\f\253\355.\253\226a(\024)\023&\264\202{j\207\201\361\206s\007\037\344\327\033G\340\006\326p\016\035\367\032\271!\331{\313\224\002L"
+	.string	"Q"
+	.string	"L"
+	.string	"=v=\00460/\355=\345\272\234G\271.\335\331D\356\335\354\277\026\r\016#\273\213\301\025\357\036\241v\276\211\212\303#\211\303\270"
+	.string	"\307\003\317\211*\025C9\212\310\370w\005\241\232Q\005\300\262\273\326\017\252\021\267\274\355\007\266#\330\307\t!\222 Y!\322\007\f\333\377\347\320\234!\262w^\276\035D\224\320|?@\273\336\201KC\360|!\212j+`\320}\005c\270{\342\307\301\274\2345\"\365n\243\273N\214Kvkx\254\314\313\002\361(%DW\3734^\243{\216\314\007\354\332\264\b\273{\027\227\376\313u\231\302\302\004J\223XY@|\026~\347\023P\2404\310\312\372\001S\304X\265\240e.\205.7Z3z\304\377n\302\352\361Y\r\262\275\224B\025\366\343\356\256\241\215\375\325\177]\347\217\317\371u\n"
+	.string	"\032\322\240g7\244L\302\246I\rY\311\244I.3e\330\244K+*\245\004-$\227\321\311\246\251I\243M\303N\\\206A\343J\230Ik\241\200\221\270\0236\"\340\255B\306a\027\266\215\303B\036\352,(\230\212\027\264\267\363\300\004\211\320\266\360\0351swU|\035\033N\001n\002\032"
+	.string	"a\211\"34\030QZ"
+	.ascii	"\212\005B\331\336?\264\334\324\214\251\361\366\rR\272\204\017"
+	.ascii	"\252\230\306\255\na\214k6\312\256\f\007Yl\bW\250\211A\370N\215"
+	.ascii	"~\352\306\222\262\"\256\345\247\304\233R\250="
+	.text
+	.section	.gnu.lto_IORelease.19.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\365\013"
+	.string	"V\026SC"
+	.string	"q\234\016\317E\232\322 \337\237\007U\026\2317^7-4T\025\376`\264'\372=\230J\337\256\243V\352G\200\201\241P\207\302\254\306U#\002,\332#b\263\007\330\354\377K\261\241\243\350\204h\223-S\n?"
+	.string	"A"
+	.string	"="
+	.string	"\004\256K{6\215O\324\336D\345\243\004\307\356fq\304\275[Q=\377\022f\270\005\342\321R\220b\203\213L\bZ\230\0267P<u\355\020z\250Z>\273k\345\020~\270\345m;\260\315\300\376\202*\007\200\314h\020c\327\303*\307\312\2200L\330\376S\306`\340\306\236\246\257\006\020"
+	.string	"\037&;j\354\316\003\227\366\330\222\262\271\332W\361\025\336GN\027\260\033R\342\305\356D`\003\330\245\3475\327%\366\273{\022\227\276\351\272\324\240l|\272\262\252V'\033?\017!\304\247+V\225\216(\342\004\tJ\364\351\322\030b\201\342\241*~\352\027U\312\311\352\212=A\215\"\366\255\335]\307\020\373#\177\332\350\001\267I\213<\035Q\002\220\026\342d\270M\255q\270-#u#\013['\312$l\240\b\231\326\2212N\001s\023F]F\201\343\272\f3\277\177\276\bZQ\244t\331\025^R\302v\267\343\223`\270\020"
+	.string	"\025\022"
+	.string	"a\211\"34\030\021Y"
+	.ascii	"6\002\001\330\216f\241K\227\365\201\026S\273-\301\216\270F\203"
+	.ascii	"\341\312H\221-Q\241\305]~\252\275)\232\332\003"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\375\f"
+	.string	"\306\030ZC\020s\223\016\303\366a\001\005\f\034\321\205y\203b\370\356s`\356\242M\207\233F\344\242\213h)\373,D{\314"
+	.string	"1}^(\320\335p\023"
+	.string	"\221\025"
+	.string	"\001E\016\314\267\234\026H\377\021Xcwk{K\231RG"
+	.string	"G"
+	.string	"D"
+	.string	"#o/\236\340BP\230\\b\370\330\215\227\201\023\320\034\276\013\320\034\252\211o\177\232\233\217\341\357\204F\313\304}\270\276\005,4\324\020\341J\317\223\352\261\342\335\363\205k\311\334\230\354\256\323\304y\270\341m7\260\315\300\276(\351\303"
+	.string	"0;\034\344\330\345\320\002\262:\240J\205\355\333\036\371\235=\233\325\210-\263\362\315\320\241\343\222\332\300c7\"8t\tgsc$\323~\314_\214\036Y\016`\367\224\262\261\033\023\370"
+	.string	"\347\320\221c\333oq\027\00136\022_\306\005\013\234\335}\212C\177E\007\260bH\331r\252D\254V/\363\007#H9\343T\205\320\02200Xj\026MjJ\307j\311\037~\367\020\025\210\325\346\214\035K\251(\373o\365d;\375\036\377t \321I\206A\207JHB\nP@)\037\221\fK\203>\031v\251h\242\n\230\026\272\"`(\020.\220\246r}\n8\223 \322\256\tY\246]\236H\372[=\371(.\210>}\367\016\t\016G\372\233\346\372\2426!i\351)\312\024\036\024"
+	.string	"aE\t\"^K\004v#\300>6O\301\310\226-\003\313>\027\373A\025\323\270M!\f\327\3049\233\260!E7Q\005\001'"
+	.ascii	"\251\006\245\322\201\246UP"
+	.text
+	.section	.gnu.lto_IOInitGlobal.24.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`\333\001E\020"
+	.string	"&\335iH\340\2228\035@\325\240\214\b-\nEA\210\353+\213\343}\270E\342\030@)\367\345\004\322\034=\237.\255\330\021\355#zE\211I\266rt\206_"
+	.string	"\324qb4\344+E\"\234JB\230\300Q-2\201\325\020\241M\366N)Q"
+	.string	"X"
+	.string	"R"
+	.string	"\001\266\327\356"
+	.string	"\266W\213v\316\313\227\275lG\312\314\316\356zT\204h\215\212\257\032\235\242\317\215\\'\301Q3\262R\257\332gwGX\032\264\317Ta\255\246\026\373\034aXN\017{\201\032\261\221\305\362\311\215v\327sdu\270\267\333\376l?\260'I.1($\360\330\3450D\310\336T\033\022\177\375\3669\230\220?\343\307\354\341J\264\220\341"
+	.ascii	"i\320\275r\255\220_\3720{^9r\305Y\210\177\201\272\324JG\203\263"
+	.ascii	"\263\240{\375h\277\313\036\356C\3501W!^\006\303w\303\212H\212"
+	.ascii	",\247\307ni\340\325\004\272W\227\017\273\273\032%c\177\210\026"
+	.ascii	"\0375\250z\343\307\t\030\036\251\346\354\224\222\240\355\257"
+	.ascii	"G8\354\232\t\227\325\271\f%\340eW\365\321wq\032\013\376\210W"
+	.ascii	"_@\315\217\257>J\346\f@\250\346\314S\006\r\033;gv\271\232\224"
+	.ascii	"\264?w7e\332\262\377\272_=\001&\337\211\242\204\340IsI\001\202"
+	.ascii	"\322\201\022\322\004\321\b\311\004\001\374\252I\"\360\363NBS"
+	.ascii	"\205/,y&_\t\005\217\024\236x\242\001\006O\246\320C\001\301\320"
+	.ascii	"\363\224\252\323\226]\357fx\270Q\321\225+%\235@\007\375A[M1U"
+	.ascii	"\374\342\247\016rd\230AN\266\350\330\304\230\364/-) p\002\031"
+	.ascii	"\263=|Q\204\241\375&?]$F\245\372\360&;\241Y*\273e\0065\302\205"
+	.ascii	"\315A\007\252\226#\254\242\341j\355\2608x\265bRG\263V\004\304"
+	.ascii	"~/\360\347\225Q\b\352\306\326\004\357(AB\375P\333\244\035\343"
+	.ascii	"\266\b\274&\362UL'\"PV\306\276\270\304\207w.\363\004"
+	.text
+	.section	.gnu.lto_IOGetByTag.25.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`k\001\355\016"
+	.string	"6ZcH\360\222(\035B\030\t\207\202\314D\213$\003\220T\211r\003\236S\374s\333\031\330\236\332\b\\\275\231\322\264\265P|lM4\354\206\t\253Z\371M\342{F\204\310\257\323[\030\360\032g\371\021\356\332\226%\232\350\275\311\336)\005H"
+	.string	"P"
+	.string	"Q"
+	.ascii	"\240)\355\023\005\253\313\260x\356\302\264\230\355\212\b|\240"
+	.ascii	";\265\355\273xleV\211h\342\3456<p\240\271\355\212\236\305\023"
+	.ascii	"\250\247\335I\352\351,"
+	.string	"q\326%\313\027y\271\\\206\210v\327\262\303\353\345\236\267]\300\266\004\3738\001\366\271\235#\354\313\374\237\037a7\034\013;vA\004\371\2617\024\007\n\333+?\306i.\363H\325Q3`]'>\244\200\2203c\200\207-\306\342AwZ\201\200\304\277X\035\206\307\217K\334\327I\017[\354\266\273\240S7\350N?\334Ij\245\0059lntl\255\317Z<\276 \340,\026IZ\210\332z\257\341\261\333\335\b\257y\002\330\f\217\337\340\361.N\304G\306i\264x\034\304\304\300\304v\327\304\335c=\265\212=w\315\232\217\231\211\n\254%w|\331'\330\314trV\356\330\242\213\234$\002+\037\212*\004Q!+\037J\312\tUU\245\224\311\004V\177\f\026|&#\022\205P\200\n#\3254)\004\236\274TX\312p\n?/\3454\302\340\221\302\224\027*1\210*\205\236\n\004CoD\334\263\252E\255\251\301"
+	.ascii	"h+j\253\242\2667<v\237\371e\357\002! \220\242\031\264\033\352"
+	.ascii	"G\021Ck\304\337\001T$\276\363\035\215\016q~\277\225uTX\037\246"
+	.ascii	"\241\242\226]\233\264y\206\022\022f\256\375\261C\267\255\031"
+	.ascii	"\221K smlf\227P\344a\031&\314W\243\245\021\2729$!Fx\230{\341"
+	.ascii	"<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`4\001\265\005"
+	.string	"\002H\036(\200k:&\332,\027#Cs\220\226\034\031\021\217\221\030\211\201"
+	.string	"\266ms\035\263n\"!\021\221@b\263\275\311\336r\357\024\206tn\246\316\356)GS\271X\217\332\266\267\216\344\332\213X\332~\035\007\271\344\343\031\334]\316q\254\361\212qj\373\264\270\244x\224\270\001\361\202vB\366\001v\301\365\200u\300\341P\365I\375\231.\245G\312b\354\333\031\313\213\273\273\321\025\332\206\223\032"
+	.ascii	"\240\020\256\\T\030\346\257\306p\356\2610\272\274h\007\220\b"
+	.ascii	">\007>\007>\007>\007>\007>\007>\007>\007>\007>\007>\007>\007"
+	.ascii	">\007>\007>\007>\007\336\265\355\304\003"
+	.text
+	.section	.gnu.lto_.refs.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"(\265/\375`D\023\315Z"
+	.string	"z\226p!R0\022\322I\007^V\3529R\375=~t\245{?g7\361\244\321\316\314L\2544\037\231\241\240c&G\n\2321\260\326f\376\303%K\303\240\307_H\302a\347\303\234a\313\273\206F\252\021UG\205\252\003\210\215\200\262\030)\376\036\351\006\357&M\332\226)\263\001\367\001'\002UX\356\301\345\332\253\245\301\217\355\fz\317#T\340\337\037\217P\317Z\227\207}T\313 T\236b3\327\254\341\213\212\245<]\002\315\001.s\\y\263\3519\352\376\274C\224\273,S\003\020\233\376\034\345g\035\230\214\241"
+	.ascii	"\233T\320^\353^{t\316\244\351QfS\206\3739\362\225U\261\351g\334"
+	.ascii	"\263\02251M\330\t?a7\216\362\333\317l\334\366t\355v\353\3563"
+	.ascii	"\331\272\307eL8M\207\311\323L/>\260\356\365\016\374D\3477^\343"
+	.ascii	"4\240\231\263\231\\K&0\233\213\312a\257{%\361C\202\004\211+\207"
+	.ascii	"\346\366\264I_t\271\331G\345aq\177\301e3^\302\321 F;'a%\257a"
+	.ascii	"\256\035\355^wj\270\220\341\261f\323Gpq\202\316g\337\251k\b."
+	.ascii	"\274\347 u\207\203\324\333+\202}\324\224\216}\324\257\354\243"
+	.ascii	"^\006\241\376?\233\372\271H\204\007\177\013e\201\013)b\374\307"
+	.ascii	"\373\017\006\205\noh\305\377n%\222\024\370\316oI\370\337\004"
+	.ascii	"\n\322{~\373\001\0231P\022\340\371\355\006+\200&\270\316o#\370"
+	.ascii	"9\004\020\024x\316o\035\b1t\233\3372\200\364\177\204\327\374"
+	.ascii	"\366\313\216\001\377\305\250\277\r\001\374\355\007?o\360\363"
+	.ascii	"\360\347\f~\306\340g\013~N\3613\212\237M\374\\\342g\241\237I"
+	.ascii	"\374\234\300\317\007\374\f\3643\001?\013\360s\210\237}~\006\361"
+	.ascii	"\363\316\3177?\013\377\243\375\207\373?\346\177\232\377^\376"
+	.ascii	"O\371\217\346\377\336\177,\377\317\3747\363\037\312\3772\377"
+	.ascii	"\311\374\327\373\037\345\377\210\377V\376\373\374\375\375\375"
+	.ascii	"\375i\t\277\005\341\317y!\275tv\367\215\340\332N(\034\365\347"
+	.ascii	"s\2209\350\317a #\360?\355N\240\207n\257\2562\327\206\267e\326"
+	.ascii	"E\364\005\255\034c.\237=\275\266\263\031\335R6\321\352\236=k"
+	.ascii	"\377\b\321\321\256n\256[\317\024\332\266\327\346fn=Uh\256Pgs"
+	.ascii	"\205*y\232\tUv\257O\236\346\332R\311\315\350\326\263\031\205"
+	.ascii	">{\232\331\312\216.\177\\&\364\331\234\203>y\232\321\345\263"
+	.ascii	"\311\334z\366tu\t\331!\265\265\245\204\341\232\314\266\252\322"
+	.ascii	"Z:y\350\232+\264\357\272y-\252\235\btkA\235wK\035\374\004\212"
+	.ascii	"\316\n\312m\t\025\240\n\212\013\332L\272\246\030\264[\f\352E"
+	.ascii	"W=\240\\\351Z\b\323)\273\264\232*\252{\200\252n%7]w+\273[\350"
+	.ascii	"\324Z\273w\3604\301\252\252\272\261~\252ZK\t\027\325m\327\274"
+	.ascii	"<y6\243\\P\"\270\264(X\327X\225\f\326w[\316\033U\2325Uw3\231"
+	.ascii	"\013\366\274\322\263i\322\034W\274\276\314\\\356\263\214\206"
+	.ascii	"\375\316}\374\003\016\223\373\322\356%\363\001:\314\007\004\343"
+	.ascii	"\212,\317\324\364,\346\236\243\017"
+	.string	"\303{\307Ki\230\313Q\346\305\007\240\2355GU\327\031)\30139$K3A9|\\\240\306\312\214`FaBFF\017'\013\225\333\232M\307\374\004\343\334\210\254\325]<\246c-\005@5\213\244$\311\373M@\300xl\307_\230\016\213\002$lb8\f\203\341<\2162\036\367p\336\302\\\376\263v3\273\033\217\343\230\n\323\255\261\220[\313\353^\031\217\255p\026\235\345\332N\n\224Xa\355\310\220u\344\314&\345;\356\302Q \366r\023\020\034\250\\\322d9irH\203\206\354\236\201T\376c \365|\344\362\017\177i\251\003\276\365\361\230b\270\033\276(X\017\233F\231\207\177\355n\266\252\201\206\025!\227\347\370\nGG0\226sC\330l\364\026\215\371tbp\022\351\362\247\332\351\021\351\212\341\n\247\326\325\232q\223I\230\253\260=\225\306\\\2226\233Z\263:\261\2576\233>\255q\205jdd6\t"
+	.ascii	"mB\244\362r\244 )bWv\233\204\251,\300\004\232\244\357\n\305 "
+	.ascii	"A\362C\212\345\315\357K\357^+11;f\327\345*l\f'\b\\\225.\034n"
+	.ascii	"\307j\372\204,\317lj\2170\237\215\026\035Y\332\246\366\006\246"
+	.ascii	"\002\274\323a\326\367%\310u\006\314\333\227{\317\302\302\354"
+	.ascii	"\214\330\264\241\331R\245\356\336:00\373u\355v\354\024)\342\243"
+	.ascii	"\307\225{} B\304~1V\003\267\370]\205\215\251W\232\313\254\310"
+	.ascii	"\355\327\315\033W\020\032Tn\r\025\020 v\310Esr\025\266\307T\216"
+	.ascii	"\370\251\t\271\035r\274'\331R\314\2466\310\016\232*F\210\364"
+	.ascii	"\341H\335\210\322\343\311\255\t\343:\227\365*j\366\322\341*l"
+	.ascii	"/L\330\024\227\256[\257>\033)-jUl\267\306\315\307}\330\037\266"
+	.ascii	";\r\r+\317f\311A\231\002\275\375\221\006\2142\205\313\016\262"
+	.ascii	"[\303\205\007\217-R\302\264\271) C\256Mge\3711\230f\031\034X"
+	.ascii	"\327f\207\fv\207\f\366\252H\211\027|\246\301\001\305\246\007"
+	.ascii	"J]\0331\035:\356n\240\342\322t\370pm\234\3408\016{U\304\323P"
+	.ascii	"Z\254\200\345\260\211M\225\321]\233\273\247\215\341i\257j\332"
+	.ascii	"\331\215U\001\227\233\225\313\342g\344\306\355\325\343\330\016"
+	.ascii	"M\0329\270{\263\254\262\316*k#\355\254\fhe\004K[\335\332\310"
+	.string	"\2623\306K\226e\333\275\231\001\006K\005\203\235\002\240\241\335`B5-F\362\032\013+(8\006\207\031)\251\333)\326r\263\004\356\251\303\222{\323\026d\333*o\227\266\271\2645\256\262[\271\266\r\365l\310U\330^ci\005\351\214u\341QeS[\303F\341t\223uw\001A:\276'Hl\224\245Q\365\365\003\331\030\241\231\034\266\330\260L\356!(\007\203\223 6\275\031\346\253\251!\365\267e\323\333\255\373\333_\r, \235^$\221G\341\tI\305\2464\371tD*\005[hR\"\036\215\311&c\f\023\210\304\034\024\224\220M+\212N\310\025)\024\223O3\\\354<\251LIH3T4%\231\200lj\201\223,\2660\032\332\024\237\222\212M5I\343q\330\304\304\204D2\032^$\007F\303\324Xd4L\213I\243S\bFC\341RR\361\310h\250\026\217F\016pz\216\306\036\031K\303\2431\007"
+	.ascii	"\027\304!\222\b\031\020\215\206\001\310X\032&\235\220\036\350"
+	.ascii	"\034\215\036\020\215\206\302+\t\375(\025\217\210FC\365JF\247"
+	.ascii	"\342\261\310t\377\300\211\006N\240\220!<\212\024%R\224P\217\""
+	.ascii	"\005\021Q\212\023D\367'\210\200I\"S\022\022\322(lB\"U\020\203"
+	.ascii	"I\242\3210M\376\205P\023\214\024\214D\240$\021\205PFq\351h\f"
+	.ascii	">\021\225\212GH\243\020i\204\301\224&\211'\210\216F\030\300\""
+	.ascii	"\321\250\250\344\024\003\371Tt\332q*\036Y@\006O(\262(\302\230"
+	.ascii	"\201D4\032z\320\002\347/\2048@\032\272\030J\026\231\234\222\222"
+	.ascii	"\"\216\204Qt\032J\"\221NC7GG*\200G,\206\300#\026F\300$\321\204"
+	.ascii	"\003\311\2431\306\375\222\004'\226J$)\231 \244s\t$X!\342\203"
+	.ascii	"\016Z\\%!\244q\350\311\251\270\202\321ii\350hLJaH\311\351iH("
+	.ascii	"\304\321\221\013\025i\025\266\232\247\362\317k\005J\201\371\351"
+	.ascii	"M\211K\232\341\322\304\246\266\311m\224&6.\235\353\206*\261B"
+	.ascii	"\335uS+(Gmo\317o\207\333\270\364\0064\332ARig\240lj\341n\241"
+	.ascii	"\3745B\273-V\226\274]\373v\373$\353\352\213X\333\375\255\223"
+	.ascii	" sX\364\242\367\351\221\313M\202n\231D-\023NK\231k?U4\266\250"
+	.ascii	"\274\275vRa\240\247\b\035\0163\\\265,\350V-j\325,\033\217\224"
+	.ascii	"S\003\032\356\362\332\211\305\200z\244/\f\0166\275e;\353\341"
+	.ascii	"@C\250YuIl\260)\021\321\355\332A\250N"
+	.string	"\254\265wX\t\032\263)>\256\332vvf\321\302L\201\001\267\312\002\201\223\250\3014d\2344\"\"\"\"\"I\222\244\003\201\005\204 \350 l\007\022\240%-\227\232\252\031!)H\352_\313\001t \267\363\374\210\203\0230\034\266\324\346hV\316\260\244\250e\242\375\222\323F\315I\027H%\354f\3069\231]\272>gM\006(\251\336\207\201\265\370%\005\304t\262\254\203\360N\017\016\221\022\250G\212\346K\020\337B\240\3433\340$\351U\215\320\022>\217\267\225\r\323O\204u\344\30588\225,\223\023DU\262W\004\245\275\235\350\364t^\036\220\232\343;l\251\b\\H\205\320\2402\254A\023w\304\226&\201\017E\007\026l\004%\f\262\031\031\033\301\177\323\3006\312R\220\343\267P5\345u#]\036>\240,\037\267\335\305\215\2069\263TXU\231}\327\203\255\270\344\2024AmH\342\b\242\264 \022\204V\234"
+	.string	"J\271p\253\031nd\r\310\376J\366R\006_\237\030(g\242\026\251K\217ce\352\302\254\376\2664-!\375\266;\321\352\2255\030\00113\034\371Q\334v\346{\006*9J\362\356chU3K\241Q!\0347\303M\016\251\"\207\002\335T\343\240Ko4\221\307\326\347WYT2\2332#\0266\261\245\001\272y7\245\252H\225\226\330\303bF\026$\274\035\302TX\020\331\342\315\216\330\305\373S%\222\366\361\036@67\001U\027\033\f\371\200\354\373 \254\224\371\245\002d\222\265T\233.|pM\330\345{\262\330\017'\234'\302\311\304\224\266\031^\224"
+	.string	"PI\2724\315=M\224?\3413\223\375\037\311\001\\V\231e\034p\230\232\371\323\245\317;\200k\001\033\241\201\t\260L(\257>W\255S\212\377\250/\006\364H\013aA\243\311x\374\347w\021\n<\263\007g-%\362\275\t\366:\2334\300\fg[E\207\035\320\212\3037\215\205n\365*\016\311S\026\213\273_\030\274\324\375\034\t\243\241\204\346\206\251\241\2116\0358'v~3\206&4\321\223o'\bl\245\244B\004\221\363\341\264\235@@\254\231\t\005{\315\336\353W`*\330\350*\207n9\210\n\032\361\303X\033\210w??\335z\307\350\236cV\3609;L\360\350\215a\2209\362{\017B~\304\213\207\241ynG`\336\334]\r\263\034!\017U\013g\037\366\017V\241"
+	.ascii	"\277\216\"+j\337{L\322\027\257\257\b\334=)\3672j\316\tk\006\321"
+	.ascii	"\031\024\0063>\273\262b\t\224\266\312\213\023#\300\370\343f\306"
+	.ascii	"\322\201\033\337>\260\374i4J\3703`\177\\\037\342]\372\324\377"
+	.ascii	"\370`\225\257\263\274\033\306/\307\023\220<4\233\370\033i\201"
+	.ascii	"x\311P\303\321\334\177\377A\363\257\331\247\271\327\241\017\305"
+	.ascii	"M\362\302\375?\177\225\334\2631\244~\013\243\342\342\034\016"
+	.ascii	"\274xW\275J~\370W\351\243L\327\256bS\005"
+	.text
+	.section	.gnu.lto_.symtab.ba6b92f7bef3e5d8,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ba6b92f7bef3e5d8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
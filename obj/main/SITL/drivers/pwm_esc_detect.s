@@ -0,0 +1,9040 @@
+	.file	"pwm_esc_detect.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	pwm_esc_detect.c.444eb73b
+	.weak	pwm_esc_detect.c.444eb73b
+pwm_esc_detect.c.444eb73b:
+	.long	0x9e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3
+	.long	.LASF1506
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1492
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1493
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1494
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1495
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1496
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1497
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1500
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1498
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1499
+	.uleb128 0x2
+	.long	.LASF1501
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1502
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1503
+	.uleb128 0x5
+	.long	.LASF1507
+	.byte	0x3
+	.byte	0xa1
+	.byte	0xa
+	.long	0x6d
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1504
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1505
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 4 "./src/main/drivers/pwm_esc_detect.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 22 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 33 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x4
+	.file 53 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.file 54 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 55 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.file 56 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 57 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x39
+	.file 58 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1072
+	.byte	0x4
+	.byte	0x4
+	.file 59 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3b
+	.file 60 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 61 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 62 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x3e
+	.file 63 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 64 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x42
+	.file 67 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1491
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF967
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF969
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF998
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1000
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1004
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1008
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1014
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1017
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1076
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1110
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1122
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1490
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1508
+	.long	.LASF1509
+	.long	.LASF1510
+	.long	.LASF1511
+	.long	.LASF1512
+	.long	.LASF1513
+	.long	.LASF1514
+	.long	.LASF1515
+	.long	.LASF1516
+	.long	.LASF1517
+	.long	.LASF1518
+	.long	.LASF1519
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x44
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1520
+	.byte	0x8
+	.long	.LASF1521
+	.byte	0x8
+	.long	.LASF1522
+	.byte	0x4
+	.long	.LASF1523
+	.byte	0x3
+	.long	.LASF1524
+	.byte	0xb
+	.long	.LASF1525
+	.byte	0xc
+	.long	.LASF1526
+	.byte	0xc
+	.long	.LASF1526
+	.byte	0xb
+	.long	.LASF1527
+	.byte	0x8
+	.long	.LASF1528
+	.byte	0xb
+	.long	.LASF1529
+	.byte	0xb
+	.long	.LASF1530
+	.byte	0x8
+	.long	.LASF1531
+	.byte	0x8
+	.long	.LASF1532
+	.byte	0xa
+	.long	.LASF1533
+	.byte	0x8
+	.long	.LASF1534
+	.byte	0x9
+	.long	.LASF1535
+	.byte	0x9
+	.long	.LASF1536
+	.byte	0x8
+	.long	.LASF1537
+	.byte	0x8
+	.long	.LASF1538
+	.byte	0x8
+	.long	.LASF1539
+	.byte	0x8
+	.long	.LASF1540
+	.byte	0xb
+	.long	.LASF1541
+	.byte	0xc
+	.long	.LASF1542
+	.byte	0x8
+	.long	.LASF1543
+	.byte	0x8
+	.long	.LASF1544
+	.byte	0x8
+	.long	.LASF1545
+	.byte	0x8
+	.long	.LASF1520
+	.byte	0xa
+	.long	.LASF1546
+	.byte	0x7
+	.long	.LASF1547
+	.byte	0x7
+	.long	.LASF1548
+	.byte	0x7
+	.long	.LASF1549
+	.byte	0x7
+	.long	.LASF1550
+	.byte	0xb
+	.long	.LASF1550
+	.byte	0x8
+	.long	.LASF1551
+	.byte	0x8
+	.long	.LASF1552
+	.byte	0x8
+	.long	.LASF1553
+	.byte	0x8
+	.long	.LASF1554
+	.byte	0xa
+	.long	.LASF1554
+	.byte	0x8
+	.long	.LASF1555
+	.byte	0x7
+	.long	.LASF1556
+	.byte	0x7
+	.long	.LASF1557
+	.byte	0x7
+	.long	.LASF1558
+	.byte	0x7
+	.long	.LASF1559
+	.byte	0x8
+	.long	.LASF1560
+	.byte	0x8
+	.long	.LASF1561
+	.byte	0x8
+	.long	.LASF1562
+	.byte	0x8
+	.long	.LASF1563
+	.byte	0x8
+	.long	.LASF1564
+	.byte	0x8
+	.long	.LASF1565
+	.byte	0xb
+	.long	.LASF1566
+	.byte	0x8
+	.long	.LASF1567
+	.byte	0x8
+	.long	.LASF1568
+	.byte	0x6
+	.long	.LASF1569
+	.byte	0x5
+	.long	.LASF1570
+	.byte	0x5
+	.long	.LASF1571
+	.byte	0x1
+	.long	.LASF1572
+	.byte	0x3
+	.long	.LASF1572
+	.byte	0x2
+	.long	.LASF1573
+	.byte	0x3
+	.long	.LASF1574
+	.byte	0x3
+	.long	.LASF1575
+	.byte	0x3
+	.long	.LASF1576
+	.byte	0x3
+	.long	.LASF1577
+	.byte	0x2
+	.long	.LASF1578
+	.byte	0x3
+	.long	.LASF1579
+	.byte	0x3
+	.long	.LASF1580
+	.byte	0x3
+	.long	.LASF1581
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF939:
+	.string	"TELEMETRY_CRSF "
+.LASF1371:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1355:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF1224:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF930:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1331:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1237:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1489:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1456:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1276:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1394:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1388:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1328:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1474:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF965:
+	.string	"U_ID_0 0"
+.LASF1059:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1174:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1196:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1393:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1049:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1223:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF992:
+	.string	"USE_UART7 "
+.LASF1136:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1361:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1325:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1488:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF478:
+	.string	"__P(args) args"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1229:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1092:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF962:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1210:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF925:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1396:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF954:
+	.string	"VTX_TRAMP "
+.LASF1199:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1157:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF993:
+	.string	"USE_UART8 "
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1427:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1128:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF942:
+	.string	"TELEMETRY_MAVLINK "
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1104:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1357:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1292:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1297:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF917:
+	.string	"USE_CLI_BATCH "
+.LASF1117:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1184:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1279:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1363:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1306:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF739:
+	.string	"NULL"
+.LASF966:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1172:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF953:
+	.string	"VTX_SMARTAUDIO "
+.LASF1008:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1238:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1246:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1143:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1351:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF947:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF922:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1197:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1498:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1415:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1016:
+	.string	"TELEMETRY_MAVLINK"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1346:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1483:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1042:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF1313:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1472:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1403:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF946:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF997:
+	.string	"STACK_CHECK"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF998:
+	.string	"USE_DASHBOARD"
+.LASF1011:
+	.string	"USE_SERIALRX_XBUS"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1250:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1309:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1004:
+	.string	"SERIAL_RX"
+.LASF1301:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1477:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF931:
+	.string	"TELEMETRY "
+.LASF963:
+	.string	"SKIP_IMU_CALC "
+.LASF1194:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1146:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1490:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1132:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1077:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1055:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1496:
+	.string	"signed char"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1378:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1181:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1436:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF908:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF945:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1021:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1002:
+	.string	"USE_PPM"
+.LASF1073:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1154:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1417:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1412:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF984:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1282:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1033:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1439:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"TELEMETRY_HOTT "
+.LASF1178:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1061:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF988:
+	.string	"USE_UART3 "
+.LASF1485:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1252:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1001:
+	.string	"USE_VCP"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1445:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1083:
+	.string	"IOCFG_IPU 0"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1089:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1204:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF924:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF960:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1091:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1471:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1135:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF699:
+	.string	"__need_size_t "
+.LASF1022:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1451:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1216:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1126:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1095:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF969:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF1375:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1235:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF977:
+	.string	"USE_FAKE_GYRO "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1109:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1486:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1435:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1502:
+	.string	"long long int"
+.LASF1186:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF978:
+	.string	"MAG "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1312:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1131:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1262:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1310:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1098:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1258:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF921:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF1121:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1076:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1337:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF912:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF1007:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1454:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF923:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF914:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1052:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1183:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1094:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1291:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1469:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1300:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1220:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF1075:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF910:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1105:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1192:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1017:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1090:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF967:
+	.string	"U_ID_2 2"
+.LASF976:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1012:
+	.string	"LED_STRIP"
+.LASF741:
+	.string	"__need_NULL"
+.LASF1043:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1207:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1270:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1162:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1448:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1107:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF949:
+	.string	"USE_SENSOR_NAMES "
+.LASF866:
+	.string	"__NFDBITS"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1423:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF1424:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1400:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1085:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1408:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1063:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1500:
+	.string	"__uint32_t"
+.LASF1295:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1507:
+	.string	"SystemCoreClock"
+.LASF1057:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1145:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1050:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1114:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1226:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF1115:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1088:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1190:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF1175:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1034:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1277:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1367:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"PP_IIF_0(t,f) f"
+.LASF1024:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1110:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1444:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1086:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1373:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1480:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1044:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1450:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"_T_PTRDIFF_ "
+.LASF1080:
+	.string	"IOCFG_AF_PP 0"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1159:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1015:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF964:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1177:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1354:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1340:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1112:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1343:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1387:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF913:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF1236:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1003:
+	.string	"USE_PWM"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1053:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1366:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1099:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF819:
+	.string	"__key_t_defined "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1113:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF1487:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1397:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF916:
+	.string	"USE_SETTINGS_INDEX "
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF1261:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1130:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1330:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1504:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1023:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1120:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1273:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1391:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1384:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1134:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF468:
+	.string	"__PMT"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1233:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1127:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1288:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1208:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1010:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1307:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1081:
+	.string	"IOCFG_AF_OD 0"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1037:
+	.string	"_ANSI_STDDEF_H "
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1051:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF935:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1372:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF956:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1349:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1494:
+	.string	"unsigned int"
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1069:
+	.string	"UNIT_TESTED "
+.LASF1125:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF928:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1036:
+	.string	"_STDDEF_H_ "
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1230:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF934:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1316:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1259:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1202:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1376:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1103:
+	.string	"BIT(x) (1 << (x))"
+.LASF1038:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF905:
+	.string	"alloca"
+.LASF1339:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1148:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1430:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"TELEMETRY_SRXL "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1013:
+	.string	"TELEMETRY_FRSKY"
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF398:
+	.string	"false 0"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1285:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF1046:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF974:
+	.string	"ACC "
+.LASF1214:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF948:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1478:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1492:
+	.string	"unsigned char"
+.LASF995:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1360:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1462:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF1294:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1459:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1475:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF981:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF1318:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"_GCC_PTRDIFF_T "
+.LASF958:
+	.string	"USE_NAV "
+.LASF1074:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF1082:
+	.string	"IOCFG_IPD 0"
+.LASF1499:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF1432:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1405:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1420:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1160:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"USE_UART1 "
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF979:
+	.string	"USE_FAKE_MAG "
+.LASF1026:
+	.string	"VTX_TRAMP"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF996:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1168:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1390:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1147:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1406:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1493:
+	.string	"short unsigned int"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF929:
+	.string	"BLACKBOX "
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF971:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1006:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1506:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1460:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1426:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1020:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1163:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1087:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF955:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF1315:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF940:
+	.string	"TELEMETRY_IBUS "
+.LASF1027:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1503:
+	.string	"long long unsigned int"
+.LASF980:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1256:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1319:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF1385:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1041:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1067:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1495:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1232:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1402:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1441:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF990:
+	.string	"USE_UART5 "
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1028:
+	.string	"USE_SPI"
+.LASF1141:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF1005:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1348:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1281:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1379:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF944:
+	.string	"USE_DASHBOARD "
+.LASF1111:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1289:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF999:
+	.string	"TELEMETRY_LTM"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1244:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1180:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF1164:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1169:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF1322:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF918:
+	.string	"USE_PPM "
+.LASF1032:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1333:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1189:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1321:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1481:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF814:
+	.string	"__off_t_defined "
+.LASF1198:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1108:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1267:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1156:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1234:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF970:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1101:
+	.string	"PP_IIF_1(t,f) t"
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF919:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1139:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF991:
+	.string	"USE_UART6 "
+.LASF920:
+	.string	"SERIAL_RX "
+.LASF1144:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF957:
+	.string	"GPS "
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF911:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1035:
+	.string	"_STDDEF_H "
+.LASF1466:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1381:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF972:
+	.string	"USE_FAKE_LED "
+.LASF951:
+	.string	"VTX_COMMON "
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF1364:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1000:
+	.string	"USE_ADC"
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1411:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1421:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF961:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1118:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1286:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1497:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1370:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF1268:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF1129:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF959:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1265:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1070:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1336:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1048:
+	.string	"__need_ptrdiff_t"
+.LASF1240:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1071:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1116:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1468:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1345:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1062:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1151:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1079:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1453:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1137:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1491:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1065:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1187:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF915:
+	.string	"USE_CLI "
+.LASF952:
+	.string	"VTX_CONTROL "
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF950:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1096:
+	.string	"EXPAND_I(x) x"
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1327:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF1106:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1124:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF936:
+	.string	"USE_SERVOS "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1442:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1153:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF987:
+	.string	"USE_UART2 "
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1171:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1501:
+	.string	"uint32_t"
+.LASF1222:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1165:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1031:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1352:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1078:
+	.string	"IOCFG_OUT_PP 0"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF1365:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1054:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF909:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1025:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1505:
+	.string	"float"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF1438:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF927:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1260:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1142:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF941:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF926:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1047:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF1119:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1205:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF1264:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1342:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"TELEMETRY_HOTT"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF989:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF973:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1097:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1399:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1274:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1217:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF983:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1060:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1271:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1066:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1072:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1484:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF932:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1465:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1122:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1193:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF985:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF968:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1369:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"TELEMETRY_IBUS"
+.LASF1018:
+	.string	"TELEMETRY_CRSF"
+.LASF1150:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1102:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1243:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+.LASF1358:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1556:
+	.string	"__sigset_t.h"
+.LASF1563:
+	.string	"struct_mutex.h"
+.LASF1533:
+	.string	"long-double.h"
+.LASF1568:
+	.string	"platform.h"
+.LASF1510:
+	.string	"src/main/drivers"
+.LASF1580:
+	.string	"timer.h"
+.LASF1560:
+	.string	"thread-shared-types.h"
+.LASF1527:
+	.string	"libc-header-start.h"
+.LASF1525:
+	.string	"stdbool.h"
+.LASF1512:
+	.string	"src/main/target"
+.LASF1550:
+	.string	"endian.h"
+.LASF1509:
+	.string	"src/main/common"
+.LASF1539:
+	.string	"stdint-intn.h"
+.LASF1522:
+	.string	"target.h"
+.LASF1569:
+	.string	"common_fc_pre.h"
+.LASF1516:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1519:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1534:
+	.string	"stubs.h"
+.LASF1511:
+	.string	"src/main/target/SITL"
+.LASF1562:
+	.string	"atomic_wide_counter.h"
+.LASF1531:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1532:
+	.string	"cdefs.h"
+.LASF1515:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1574:
+	.string	"resource.h"
+.LASF1540:
+	.string	"stdlib.h"
+.LASF1529:
+	.string	"features-time64.h"
+.LASF1520:
+	.string	"types.h"
+.LASF1570:
+	.string	"common_fc_post.h"
+.LASF1544:
+	.string	"floatn.h"
+.LASF0:
+	.string	"./src/main/drivers/pwm_esc_detect.c"
+.LASF1546:
+	.string	"clock_t.h"
+.LASF1518:
+	.string	"/usr/include"
+.LASF1558:
+	.string	"struct_timespec.h"
+.LASF1548:
+	.string	"time_t.h"
+.LASF1508:
+	.string	"src/main/build"
+.LASF1555:
+	.string	"sigset_t.h"
+.LASF1581:
+	.string	"rcc_types.h"
+.LASF1545:
+	.string	"floatn-common.h"
+.LASF1536:
+	.string	"typesizes.h"
+.LASF1559:
+	.string	"pthreadtypes.h"
+.LASF1542:
+	.string	"waitflags.h"
+.LASF1547:
+	.string	"clockid_t.h"
+.LASF1528:
+	.string	"features.h"
+.LASF1576:
+	.string	"io_def.h"
+.LASF1537:
+	.string	"time64.h"
+.LASF1523:
+	.string	"pwm_esc_detect.c"
+.LASF1521:
+	.string	"stdint-uintn.h"
+.LASF1552:
+	.string	"byteswap.h"
+.LASF1538:
+	.string	"wchar.h"
+.LASF1577:
+	.string	"utils.h"
+.LASF1549:
+	.string	"timer_t.h"
+.LASF1565:
+	.string	"alloca.h"
+.LASF1561:
+	.string	"pthreadtypes-arch.h"
+.LASF1543:
+	.string	"waitstatus.h"
+.LASF1513:
+	.string	"src/main"
+.LASF1572:
+	.string	"time.h"
+.LASF1579:
+	.string	"pwm_esc_detect.h"
+.LASF1517:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1575:
+	.string	"io_types.h"
+.LASF1573:
+	.string	"io.h"
+.LASF1566:
+	.string	"stdlib-bsearch.h"
+.LASF1564:
+	.string	"struct_rwlock.h"
+.LASF1514:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1554:
+	.string	"select.h"
+.LASF1526:
+	.string	"stdint.h"
+.LASF1571:
+	.string	"build_config.h"
+.LASF1541:
+	.string	"stddef.h"
+.LASF1535:
+	.string	"stubs-64.h"
+.LASF1530:
+	.string	"wordsize.h"
+.LASF1553:
+	.string	"uintn-identity.h"
+.LASF1578:
+	.string	"io_def_generated.h"
+.LASF1557:
+	.string	"struct_timeval.h"
+.LASF1551:
+	.string	"endianness.h"
+.LASF1524:
+	.string	"stdc-predef.h"
+.LASF1567:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.7b0488d466c17434,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\013"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7b0488d466c17434,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"E\b"
+	.string	"\364\016x"
+	.string	""
+	.string	""
+	.string	"\217"
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	"\006\023\001\004\006\025\001 \b\022"
+	.string	"5\200\302\033"
+	.string	"\276"
+	.string	""
+	.string	"?\f\006(\001\017\006(\001"
+	.string	"\bZ"
+	.string	"\004\002\310\235\363\346\t\017\300\200\200\304\200\300\204\t"
+	.string	"\275\001\274\001"
+	.string	"\302\001(\277\001\301\001\300\001\004\002\267\340\255\021+\330\220\200\370\227\307\357\2412\242\243\204\200\220\201\001\303\001\273\001\277\001"
+	.string	"\273\001"
+	.string	"?\207\001"
+	.string	"\017SystemCoreClock#./src/main/drivers/pwm_esc_detect.c\bGNU C99"
+	.string	"\032.444eb73b"
+	.string	"\buint32_t\013/root/repo"
+	.string	" target/SITL.h"
+	.string	"\b"
+	.ascii	"\257\354\001\006\343\215\236h\b\247.ne\206(#p\315\330Z\306"
+	.text
+	.section	.gnu.lto_.symtab.7b0488d466c17434,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7b0488d466c17434,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
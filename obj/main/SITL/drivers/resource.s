@@ -0,0 +1,2668 @@
+	.file	"resource.c"
+	.file 1 "./src/main/drivers/resource.h"
+	.file 2 "./src/main/drivers/resource.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	resource.c.4ae1a67c
+	.weak	resource.c.4ae1a67c
+resource.c.4ae1a67c:
+	.long	0x196
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x7
+	.byte	0x4
+	.long	0x14b
+	.byte	0x1
+	.byte	0x14
+	.byte	0xe
+	.long	0x14b
+	.uleb128 0x1
+	.long	.LASF397
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF398
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF399
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF400
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF401
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF404
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF405
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF406
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF408
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF409
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF410
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF411
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF412
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF413
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF414
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF415
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF416
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF417
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF418
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF419
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF420
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF421
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF422
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF423
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF424
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF425
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF426
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF427
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF428
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF429
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF430
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF431
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF432
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF433
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF434
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF435
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF436
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF437
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF438
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF439
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF440
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF441
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF442
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF443
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF444
+	.uleb128 0x6
+	.long	0x174
+	.long	0x162
+	.uleb128 0x7
+	.long	0x167
+	.byte	0x2d
+	.byte	0
+	.uleb128 0x3
+	.long	0x152
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF445
+	.uleb128 0x8
+	.byte	0x8
+	.long	0x180
+	.uleb128 0x3
+	.long	0x16e
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF446
+	.uleb128 0x3
+	.long	0x179
+	.uleb128 0x9
+	.long	.LASF448
+	.byte	0x1
+	.byte	0x46
+	.byte	0x1b
+	.long	0x162
+	.uleb128 0xa
+	.long	0x185
+	.byte	0x2
+	.byte	0x14
+	.byte	0x14
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 3 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x3
+	.long	.LASF1
+	.long	.LASF449
+	.long	.LASF450
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4
+	.long	.LASF0
+	.byte	0
+	.long	.LASF451
+	.byte	0x1
+	.long	.LASF452
+	.byte	0x1
+	.long	.LASF453
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF437:
+	.string	"OWNER_LED_STRIP"
+.LASF355:
+	.string	"__amd64 1"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF406:
+	.string	"OWNER_ADC_EXT"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF409:
+	.string	"OWNER_SERIAL_RX"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF443:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF389:
+	.string	"SITL 1"
+.LASF431:
+	.string	"OWNER_USB"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF444:
+	.string	"unsigned int"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF430:
+	.string	"OWNER_BARO_EXTI"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF379:
+	.string	"linux 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF403:
+	.string	"OWNER_ADC"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF408:
+	.string	"OWNER_SERIAL_TX"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"OWNER_OSD_CS"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF417:
+	.string	"OWNER_SPI_MOSI"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF440:
+	.string	"OWNER_COMPASS_CS"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF424:
+	.string	"OWNER_BARO_CS"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF398:
+	.string	"OWNER_PWMINPUT"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF413:
+	.string	"OWNER_SONAR_ECHO"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF441:
+	.string	"OWNER_SPI_PREINIT"
+.LASF399:
+	.string	"OWNER_PPMINPUT"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF436:
+	.string	"OWNER_INVERTER"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF420:
+	.string	"OWNER_SDCARD"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF422:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF415:
+	.string	"OWNER_SPI_SCK"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF446:
+	.string	"char"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF410:
+	.string	"OWNER_PINDEBUG"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF29:
+	.string	"_LP64 1"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF412:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF411:
+	.string	"OWNER_TIMER"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF439:
+	.string	"OWNER_VTX"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF404:
+	.string	"OWNER_ADC_BATT"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF428:
+	.string	"OWNER_SPI_CS"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF402:
+	.string	"OWNER_LED"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF429:
+	.string	"OWNER_MPU_EXTI"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF447:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF396:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF401:
+	.string	"OWNER_SERVO"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF395:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF434:
+	.string	"OWNER_OSD"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF377:
+	.string	"__linux 1"
+.LASF448:
+	.string	"ownerNames"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF418:
+	.string	"OWNER_I2C_SCL"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF438:
+	.string	"OWNER_TRANSPONDER"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF445:
+	.string	"long unsigned int"
+.LASF397:
+	.string	"OWNER_FREE"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF380:
+	.string	"__unix 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF419:
+	.string	"OWNER_I2C_SDA"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF364:
+	.string	"__k8 1"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF416:
+	.string	"OWNER_SPI_MISO"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF400:
+	.string	"OWNER_MOTOR"
+.LASF407:
+	.string	"OWNER_ADC_RSSI"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF425:
+	.string	"OWNER_MPU_CS"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF421:
+	.string	"OWNER_SDCARD_CS"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF427:
+	.string	"OWNER_RX_SPI_CS"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF442:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF405:
+	.string	"OWNER_ADC_CURR"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF433:
+	.string	"OWNER_BEEPER"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF414:
+	.string	"OWNER_SYSTEM"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF435:
+	.string	"OWNER_RX_BIND"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF382:
+	.string	"unix 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF432:
+	.string	"OWNER_USB_DETECT"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF423:
+	.string	"OWNER_FLASH_CS"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF453:
+	.string	"stdc-predef.h"
+.LASF452:
+	.string	"resource.c"
+.LASF0:
+	.string	"./src/main/drivers/resource.c"
+.LASF451:
+	.string	"resource.h"
+.LASF449:
+	.string	"src/main/drivers"
+.LASF450:
+	.string	"/usr/include"
+	.text
+	.section	.gnu.lto_.profile.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\346\347\335\365\t"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.f34da47fa20b4e1c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.0.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375`a\006\r\""
+	.string	"F\277\3417@\356\250\003\003<\317-\376|]\327\345\243\325\025\270\360\007\203\366\004tD\201\355\005\3135&[\026T0\265\177\331\273d\005\374\333y\212\267{\370\200\265%\224FR\222\001\327"
+	.string	"\326"
+	.string	"\323"
+	.string	"\nd\035\301hi\317\013^\275\330\261e\353\245\264g\006\254\214\273M\332s\203TE\020\256K\322\236\035\230\"\202x\027i\317\017F\021C\f\322\236\277@\035C\274y\264g\b\235\210\"\3348\332s\004MF\021\257\237\321\236%\\:\216p\235\213\366<\201\022r\304{E{\246\020\351\254\2043\321\236+<\"\226 +['\242=[`\2044\341:\020\355\371B\242\242\211WF\331\352\320\236\265!\343\twF\331\"\265g\f\203\216'\336\262\262\215\241=g"
+	.string	"\224\003\205;\246=kHC\242x\315\312v\325\2367\3549\3634\027G\331\252\320\2369\340\311\341i\257\216\262%\241=w\360\0037\317\330\353\354\320\271\211`\211\241\205\206\326z\021\317<\312\366\265g\354\2140\316>\002k\276\315\273y8\037\347\347<\235\267\363w>\017\210\337\363agThC|\240\300\257G\210\240E\331\326\016i<\310\004\256 \355\371\353 \023\274i\332sM\316\230\003\367\216\366l{3\346\340\255\301\321\2363\033\344\003w\215\366|\3734\310\00753\3323\316\017\334\314\030\277\\.\232\214\361+\027\246\b\301\255\351\274\030!\274\265 \3323\327\226c\005W\226\366\334\365X\216\025\376\224\366\f\240\312\230\005\027\224\366\354\365\356\230\005\027e\373\231\264\347"
+	.string	"\017\345\305\205_\244=\013\370&g\027\336\377\243=\017x%D\215G{&p\244\250\3377\332s\001\"F\016n\031\355\331\300\267F\016\277E{>\360\243\330\301u\265g\004\217V\354\360\276\022\3559A-\"\330\013\321\236\003\301-\306S\327.<\\Y\330\3606\331\275y\301\037\320\344\302k*\226\242j\220M\203\273\013\223\201\025\311\222gef\305\344\316,Y\274aL\302\330\3210\022\217;\262\244\331\016\354\013\227\325(&w6\312\312\222;.\034&\364\005\331S,\355\261C\025"
+	.ascii	"v;~\307\363\270\036\347\343}\334\217\377\361@.\310\ty!?\344\210"
+	.ascii	"\\\221/\362F\356\310!\371\353\222|\222WrK\216\3113\371&\347\344"
+	.ascii	"\236\374\223\207rQN\312K\371)G\345\252|\225\267rW\016\313c\371"
+	.ascii	",\247\345\266\374\326\367x\037\017\344\203\274\220\037\362E\336"
+	.ascii	"\310#\371$\277\344\231\274\223\177\362Q^\312Oy*o\345\257"
+	.string	"|\226\327\362\\\276\313\177y0/\346\307|\231\020\177\346\321\274\232\017\030E\325\024\031\377Z\004m\370\027\f\332\260\n\\\201\277\033\006\262P\321}\303'\352\263a\363\344\331\360\272\362z\252*4\327!Z\342to\2255O^\016\017\327\241\312\372x\251\212n\035\016\023\366\320\363\227\2567\254\242aa\251\272za\240\n\023eU\236\030ps\341\037\272\356\261\215\303+\314]b\340N\323\r\374\345\260\317\344\235\2335=\244%\306\341m\352N\225g\236\333K\305\346\371R\344\3606K\274M\334\271\2018v\250\352\3606q\302\340/\207\323u\210\262@\225\327\323\341\336\026\332\360j\242+z\262\275-\344\302*\032D\321\036\016\237\033h\303%V\321UEY\210\2459\034L\325u\263'\352\323a\025=\305\200\001q\250!\020\2021\2714DIAA\251\320\034\360\"\252a\035\020(\2024\021\335Uh\027V(>k\251"
+	.ascii	"S'\234\002\025!\231\216u\345o\211\301])\356\241\241]\273c\260"
+	.ascii	"\371q\201\233U\036\036\275\016O\234\316\307(bs6\033\256k\256"
+	.ascii	"\024\362x\225}\321y\356\220\rh:\005\023s\320\354\033\310\267"
+	.ascii	"5\0371\230\313*\317\324\036\201a\201@\325\301\245\035@\271\233"
+	.ascii	"+[J\\\346\262\321\024\274\333bf\343\226\250[\272\211eA \367G"
+	.ascii	"7\237\021\365o\ni\347\267\201\361\261\020\365\345\356\257\013"
+	.ascii	"\207u\271\016\364\f\214\034=4\253\373\345\024\302\342r,;\207"
+	.ascii	"74\237\233="
+	.text
+	.section	.gnu.lto_.symbol_nodes.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f34da47fa20b4e1c,"e",@progbits
+	.string	"(\265/\375`f\005%\035"
+	.string	"\3465\272I\240\024R:\017\362\307)<-\244\037\fG\301\251\035\235Z\340\371\224\223\256\001\315[\305\227\216a\023\r}+g\377y5*\215\317\240\247zb\205q\025F\017V\203\337\206\274p\333\213\327\206\274\004\375\204\356\355\375I\355&S\n\212"
+	.string	"\253"
+	.string	"\257"
+	.string	"\225x\246]\227Z\211\273\037\301\217\200\032\325 r2\251-\334\216<\375\"\366\223'\3023uz\220UYk\335\351z|\261PZj\344{\346\355<s\301yf\216\306\026b\002Z\325\201u7\231\372\236\271b\347\231\336\233\355#\366\327\376\232m5\333h\266\317l\223\331\326b;\3146\026\333`\266\277lw\331\246b[\313\266\024\333VT\266\247lK\331\216\262-c\337\3076\022\333\267]e{\227\313\345\322\266\b\333&\354\027\017\001>\225\375\247O\351d\360"
+	.string	"\262\261\324Y\357\231gr\372M^|\252f\b-\305\371K\244p\307%'\343R_\312>\324\243\316\244\341\304Rm\313R{\275g\352\3163\377t\372JpQ\246\304\206,\315\235g\332vh\036\344?\032\362\243#\371N\255\304!\234\315U\212\244\263\252#CA\f\231q,\305\221\025P\250\212\220\270\236b\022!K}'\373HOzS\356\247\326\233Z\253\314\255\b\305\220\320R\373MW\332\2129?H\001\273#\027\307!$\022LT\332\017\343\322/\335\210\317t%7p`\233\r\221\212Tk=\023\315O\rc8\226F\310r\372c\233t,\006-5\305\3022\354\024q-\365\303\2241j:X`-\375\225\323\307b I\223\250\245"
+	.string	"\254\200\275$\213fNK}0\373[\377\312\005\031y\260\226Z\231<\375*\273)J\312vxu\341\350X\341,\365\273\354?9\025sID\226\263\324P[\247\317\205\273q\341\264c)\314\024-\0303l\254X\352k\331\317\272\024%\230'\034AbK\017\274g\322(\247\2175A\b\310h\251\355\312*\227l\301\343c\251oe\237\311\253\032\344\344\270\261\324N\236\234>\024\023H1\315hi"
+	.string	"'T\267\0278I\237\245\0016`a\210\340\320'B(\034\372p\303\037\007 5\020\302\203\337\031\374\321\314\f\260\004\t\024\016`\270P\341\006\234\t\002\207#\2045\301\241\257f\030$\321a\270\301\007\242\303\357\203\0178\254\361\315\024\250\t~\370]\030\006A\224\020\006@\261\304.#VMK\275D\373ik\223{\272Z:.M\220uz+\0052k\301c\271\246+\373\252\241b\251\277f?\313\325\314\342\r\r\037K\031\244\235~\027\233\327N\224q\351\013\027\264\232u\324Z\352\243\331\337\362\263\315\211\321\023\266\324b\357\2311P\247oF\244\254\252*#\243e[W<K}2\373W\256\205\353)]\250!HC\f$\016U\220\024\245 \325\006\240\002\t\344\220u\021P\231\223\"F\031\361\372\031@#:g\326\273\242\003u\017\305A\340;\240\007\3605\344t\310\276\306\003i\315^\013E\024L\240\362"
+	.string	"\274B\301\252"
+	.ascii	"&\222\367\201\254\037\030\360\352\233\220\306\236\253\343\304"
+	.ascii	"?2\274\203\fI\356\341\263\tMh\366p\304v\214\037\300\227\005\306"
+	.ascii	"\004\025t\267w\251\264\212]\005\345\002\251\275\255\302\241\250"
+	.ascii	"\247\bI\3624\221\033x\345\312\2270*\245r\216\276\3504\321\354"
+	.ascii	"6q\031\351}\363g\244\31140\257s\243}\320(\301\251\271\222\345"
+	.ascii	"\002\370X\255\302\252@:\342h\216\235\252\263\210?"
+	.text
+	.section	.gnu.lto_.symtab.f34da47fa20b4e1c,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f34da47fa20b4e1c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9163 @@
+	.file	"serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/serial.h"
+	.file 4 "./src/main/drivers/serial.c"
+	.file 5 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial.c.642875d1
+	.weak	serial.c.642875d1
+serial.c.642875d1:
+	.long	0x532
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF1411
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1340
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1341
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1342
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1343
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1344
+	.uleb128 0x7
+	.long	.LASF1346
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1345
+	.uleb128 0x7
+	.long	.LASF1347
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	.LASF1348
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1349
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1350
+	.uleb128 0xb
+	.long	0x80
+	.uleb128 0x7
+	.long	.LASF1351
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0x8c
+	.uleb128 0x14
+	.long	0x8c
+	.uleb128 0x7
+	.long	.LASF1352
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF1353
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x15
+	.long	.LASF1412
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0xae
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1354
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1355
+	.uleb128 0x3
+	.long	0x87
+	.uleb128 0xd
+	.long	.LASF1359
+	.long	0x30
+	.byte	0x17
+	.long	0xfa
+	.uleb128 0x5
+	.long	.LASF1356
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1357
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1358
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1359
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x3
+	.long	0xd9
+	.uleb128 0xd
+	.long	.LASF1360
+	.long	0x30
+	.byte	0x1d
+	.long	0x151
+	.uleb128 0x5
+	.long	.LASF1361
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1362
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1363
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1364
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1365
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1366
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1367
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1368
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1369
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1370
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1360
+	.byte	0x3
+	.byte	0x30
+	.byte	0x3
+	.long	0x106
+	.uleb128 0x7
+	.long	.LASF1371
+	.byte	0x3
+	.byte	0x32
+	.byte	0x10
+	.long	0x169
+	.uleb128 0x3
+	.long	0x16e
+	.uleb128 0x9
+	.long	0x179
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1386
+	.byte	0x48
+	.byte	0x34
+	.byte	0x10
+	.long	0x22e
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0x36
+	.byte	0x24
+	.long	0x2b8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x38
+	.byte	0xd
+	.long	0x8c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x39
+	.byte	0x10
+	.long	0xfa
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0x3a
+	.byte	0x13
+	.long	0x151
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x3c
+	.byte	0xe
+	.long	0xae
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x3e
+	.byte	0xe
+	.long	0xae
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0x3f
+	.byte	0xe
+	.long	0xae
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x40
+	.byte	0x17
+	.long	0x2bd
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x41
+	.byte	0x17
+	.long	0x2bd
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x42
+	.byte	0xe
+	.long	0xae
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x43
+	.byte	0xe
+	.long	0xae
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x44
+	.byte	0xe
+	.long	0xae
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x45
+	.byte	0xe
+	.long	0xae
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x47
+	.byte	0x1e
+	.long	0x15d
+	.byte	0x40
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1387
+	.byte	0x50
+	.byte	0x5c
+	.byte	0x8
+	.long	0x2b3
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x5d
+	.byte	0xc
+	.long	0x2e8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1389
+	.byte	0x5f
+	.byte	0x10
+	.long	0x301
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1390
+	.byte	0x60
+	.byte	0x10
+	.long	0x301
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1391
+	.byte	0x62
+	.byte	0xf
+	.long	0x315
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1392
+	.byte	0x65
+	.byte	0xc
+	.long	0x32a
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1393
+	.byte	0x67
+	.byte	0xb
+	.long	0x345
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0x69
+	.byte	0xc
+	.long	0x35a
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x6b
+	.byte	0xc
+	.long	0x37a
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0x6d
+	.byte	0xc
+	.long	0x38a
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1397
+	.byte	0x6e
+	.byte	0xc
+	.long	0x38a
+	.byte	0x48
+	.byte	0
+	.uleb128 0xb
+	.long	0x22e
+	.uleb128 0x3
+	.long	0x2b3
+	.uleb128 0x3
+	.long	0x9d
+	.uleb128 0x7
+	.long	.LASF1398
+	.byte	0x3
+	.byte	0x48
+	.byte	0x3
+	.long	0x179
+	.uleb128 0xb
+	.long	0x2c2
+	.uleb128 0x9
+	.long	0x2e3
+	.uleb128 0x4
+	.long	0x2e3
+	.uleb128 0x4
+	.long	0x8c
+	.byte	0
+	.uleb128 0x3
+	.long	0x2c2
+	.uleb128 0x3
+	.long	0x2d3
+	.uleb128 0xc
+	.long	0xae
+	.long	0x2fc
+	.uleb128 0x4
+	.long	0x2fc
+	.byte	0
+	.uleb128 0x3
+	.long	0x2ce
+	.uleb128 0x3
+	.long	0x2ed
+	.uleb128 0xc
+	.long	0x8c
+	.long	0x315
+	.uleb128 0x4
+	.long	0x2e3
+	.byte	0
+	.uleb128 0x3
+	.long	0x306
+	.uleb128 0x9
+	.long	0x32a
+	.uleb128 0x4
+	.long	0x2e3
+	.uleb128 0x4
+	.long	0xae
+	.byte	0
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0xc
+	.long	0x33e
+	.long	0x33e
+	.uleb128 0x4
+	.long	0x2fc
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1399
+	.uleb128 0x3
+	.long	0x32f
+	.uleb128 0x9
+	.long	0x35a
+	.uleb128 0x4
+	.long	0x2e3
+	.uleb128 0x4
+	.long	0xfa
+	.byte	0
+	.uleb128 0x3
+	.long	0x34a
+	.uleb128 0x9
+	.long	0x374
+	.uleb128 0x4
+	.long	0x2e3
+	.uleb128 0x4
+	.long	0x374
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0x379
+	.uleb128 0x16
+	.uleb128 0x3
+	.long	0x35f
+	.uleb128 0x9
+	.long	0x38a
+	.uleb128 0x4
+	.long	0x2e3
+	.byte	0
+	.uleb128 0x3
+	.long	0x37f
+	.uleb128 0x8
+	.long	.LASF1400
+	.byte	0x64
+	.long	0x3a5
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x64
+	.byte	0x23
+	.long	0x2e3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1401
+	.byte	0x5e
+	.long	0x3bb
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x5e
+	.byte	0x25
+	.long	0x2e3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1403
+	.byte	0x59
+	.long	0x3e7
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x59
+	.byte	0x1f
+	.long	0x7e
+	.uleb128 0x2
+	.long	.LASF1404
+	.byte	0x59
+	.byte	0x38
+	.long	0x3e7
+	.uleb128 0x2
+	.long	.LASF1405
+	.byte	0x59
+	.byte	0x42
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0x8
+	.long	.LASF1406
+	.byte	0x54
+	.long	0x40d
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x54
+	.byte	0x22
+	.long	0x2e3
+	.uleb128 0x2
+	.long	.LASF1374
+	.byte	0x54
+	.byte	0x37
+	.long	0xfa
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1393
+	.byte	0x4f
+	.byte	0x5
+	.long	0x33e
+	.long	0x428
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x4f
+	.byte	0x35
+	.long	0x2fc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1392
+	.byte	0x4a
+	.long	0x449
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x4a
+	.byte	0x26
+	.long	0x2e3
+	.uleb128 0x2
+	.long	.LASF1376
+	.byte	0x4a
+	.byte	0x39
+	.long	0xae
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1391
+	.byte	0x45
+	.byte	0x9
+	.long	0x8c
+	.long	0x464
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x45
+	.byte	0x22
+	.long	0x2e3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1407
+	.byte	0x40
+	.byte	0xa
+	.long	0xae
+	.long	0x47f
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x40
+	.byte	0x30
+	.long	0x2fc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1408
+	.byte	0x3b
+	.byte	0xa
+	.long	0xae
+	.long	0x49a
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x3b
+	.byte	0x33
+	.long	0x2fc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1409
+	.byte	0x2c
+	.long	0x4d1
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x2c
+	.byte	0x23
+	.long	0x2e3
+	.uleb128 0x2
+	.long	.LASF1404
+	.byte	0x2c
+	.byte	0x3c
+	.long	0x3e7
+	.uleb128 0x2
+	.long	.LASF1405
+	.byte	0x2c
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x17
+	.uleb128 0xf
+	.string	"p"
+	.byte	0x31
+	.byte	0x1d
+	.long	0x3e7
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1388
+	.byte	0x26
+	.long	0x4f1
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x26
+	.byte	0x20
+	.long	0x2e3
+	.uleb128 0x10
+	.string	"ch"
+	.byte	0x26
+	.byte	0x32
+	.long	0x8c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1410
+	.byte	0x21
+	.byte	0xa
+	.long	0xae
+	.long	0x50c
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x21
+	.byte	0x2a
+	.long	0x2e3
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1413
+	.byte	0x4
+	.byte	0x19
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x19
+	.byte	0x20
+	.long	0x2e3
+	.uleb128 0x10
+	.string	"str"
+	.byte	0x19
+	.byte	0x36
+	.long	0xd4
+	.uleb128 0xf
+	.string	"ch"
+	.byte	0x1b
+	.byte	0xd
+	.long	0x8c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 6 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 23 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.file 24 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.file 27 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.file 28 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 29 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x1e
+	.file 31 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 32 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 33 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.file 34 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1339
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF897
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1338
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1414
+	.long	.LASF1415
+	.long	.LASF1416
+	.long	.LASF1417
+	.long	.LASF1418
+	.long	.LASF1419
+	.long	.LASF1420
+	.long	.LASF1421
+	.long	.LASF1422
+	.long	.LASF1423
+	.long	.LASF1424
+	.long	.LASF1425
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x23
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1426
+	.byte	0x8
+	.long	.LASF1427
+	.byte	0x8
+	.long	.LASF1428
+	.byte	0x4
+	.long	.LASF1429
+	.byte	0x4
+	.long	.LASF1430
+	.byte	0x5
+	.long	.LASF1431
+	.byte	0xb
+	.long	.LASF1432
+	.byte	0xc
+	.long	.LASF1433
+	.byte	0xc
+	.long	.LASF1433
+	.byte	0xb
+	.long	.LASF1434
+	.byte	0x8
+	.long	.LASF1435
+	.byte	0xb
+	.long	.LASF1436
+	.byte	0xb
+	.long	.LASF1437
+	.byte	0x8
+	.long	.LASF1438
+	.byte	0x8
+	.long	.LASF1439
+	.byte	0xa
+	.long	.LASF1440
+	.byte	0x8
+	.long	.LASF1441
+	.byte	0x9
+	.long	.LASF1442
+	.byte	0x9
+	.long	.LASF1443
+	.byte	0x8
+	.long	.LASF1444
+	.byte	0x8
+	.long	.LASF1445
+	.byte	0x8
+	.long	.LASF1446
+	.byte	0x8
+	.long	.LASF1447
+	.byte	0x7
+	.long	.LASF1448
+	.byte	0x6
+	.long	.LASF1449
+	.byte	0xc
+	.long	.LASF1450
+	.byte	0x6
+	.long	.LASF1451
+	.byte	0x4
+	.long	.LASF1452
+	.byte	0x4
+	.long	.LASF1453
+	.byte	0x4
+	.long	.LASF1454
+	.byte	0x4
+	.long	.LASF1455
+	.byte	0x2
+	.long	.LASF1456
+	.byte	0x4
+	.long	.LASF1457
+	.byte	0x3
+	.long	.LASF1458
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1380:
+	.string	"txBuffer"
+.LASF1371:
+	.string	"serialReceiveCallbackPtr"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF1195:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1179:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1048:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF721:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1028:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF909:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1155:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1061:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1373:
+	.string	"identifier"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1280:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1100:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF942:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1218:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1212:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1152:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1298:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1015:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF998:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1020:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1402:
+	.string	"instance"
+.LASF1331:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1047:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF960:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1253:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1149:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1312:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1014:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1077:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1053:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"rxBufferSize"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF915:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1208:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1034:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1220:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1182:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF1023:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"USE_VCP"
+.LASF948:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF981:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF924:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF1204:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1251:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF952:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1334:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF928:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1181:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1116:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1407:
+	.string	"serialTxBytesFree"
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1008:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1277:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1103:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1187:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF996:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1062:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1175:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1148:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF967:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1039:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1021:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1400:
+	.string	"serialEndWrite"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF1349:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1239:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF916:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1056:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1170:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1307:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1325:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF840:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF1137:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1227:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF1151:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1329:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1074:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1133:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1036:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1125:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF1018:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF970:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1314:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1321:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1337:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF956:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1278:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1296:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1328:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1344:
+	.string	"signed char"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1351:
+	.string	"uint8_t"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1327:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1005:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1121:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF793:
+	.string	"USE_PPM"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF978:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1241:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1233:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1236:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1130:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1106:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF1002:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1254:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1042:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF1309:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1076:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1361:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1196:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1399:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF906:
+	.string	"IOCFG_IPU 0"
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF877:
+	.string	"NULL"
+.LASF1033:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1098:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1030:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF914:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF1389:
+	.string	"serialTotalRxWaiting"
+.LASF1370:
+	.string	"SERIAL_BIDIR_PP"
+.LASF959:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1287:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1275:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF950:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1347:
+	.string	"__uint16_t"
+.LASF918:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF912:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1059:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF933:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF968:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1393:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1136:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF955:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1086:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1413:
+	.string	"serialPrint"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1385:
+	.string	"rxCallback"
+.LASF941:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1082:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1013:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF945:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF899:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1161:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF973:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF858:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF910:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1112:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1384:
+	.string	"txBufferTail"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1403:
+	.string	"serialWriteBufShim"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1069:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF396:
+	.string	"bool _Bool"
+.LASF857:
+	.string	"__size_t "
+.LASF917:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1346:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1115:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1293:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1124:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1044:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1006:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1367:
+	.string	"SERIAL_UNIDIR"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1016:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF913:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF767:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1109:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1031:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1257:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1094:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF986:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1272:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1358:
+	.string	"MODE_RXTX"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1260:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1247:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF957:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1379:
+	.string	"rxBuffer"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1224:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF908:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1232:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1395:
+	.string	"writeBuf"
+.LASF1119:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1412:
+	.string	"SystemCoreClock"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF938:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1050:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF939:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1383:
+	.string	"txBufferHead"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1063:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF962:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1096:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF999:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1101:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1191:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF923:
+	.string	"PP_IIF_0(t,f) f"
+.LASF1408:
+	.string	"serialRxBytesWaiting"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF934:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1268:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF771:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1197:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF1304:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1318:
+	.string	"UNIT_TESTED "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1274:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF903:
+	.string	"IOCFG_AF_PP 0"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF983:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1001:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF1178:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF936:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1167:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1211:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF1060:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1382:
+	.string	"rxBufferTail"
+.LASF794:
+	.string	"USE_PWM"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1045:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1348:
+	.string	"__uint32_t"
+.LASF1066:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1190:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1071:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1311:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1390:
+	.string	"serialTotalTxFree"
+.LASF1265:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1085:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF954:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1269:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1035:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1010:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1387:
+	.string	"serialPortVTable"
+.LASF1354:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF944:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1097:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1215:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1052:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF468:
+	.string	"__PMT"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1057:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF951:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1043:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"portMode_t"
+.LASF1199:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1238:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1032:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1131:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF904:
+	.string	"IOCFG_AF_OD 0"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1405:
+	.string	"count"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1173:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1007:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1342:
+	.string	"unsigned int"
+.LASF896:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1163:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1330:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF949:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1397:
+	.string	"endWrite"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1336:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1000:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1054:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1140:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1083:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1026:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1200:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF927:
+	.string	"BIT(x) (1 << (x))"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF972:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1391:
+	.string	"serialRead"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1410:
+	.string	"serialGetBaudRate"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1154:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF765:
+	.string	"ACC "
+.LASF1038:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1302:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF997:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1127:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1378:
+	.string	"txBufferSize"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF1286:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1079:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF1118:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF769:
+	.string	"MAG "
+.LASF1283:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1299:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1142:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF749:
+	.string	"USE_NAV "
+.LASF897:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF905:
+	.string	"IOCFG_IPD 0"
+.LASF1350:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF1256:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1229:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF984:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1332:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF1366:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF992:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1214:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1128:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"serialSetBaudRate"
+.LASF971:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1230:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1341:
+	.string	"short unsigned int"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"BLACKBOX "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1339:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1411:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1284:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1122:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF987:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF1369:
+	.string	"SERIAL_BIDIR_OD"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1139:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF818:
+	.string	"USE_I2C"
+.LASF929:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF389:
+	.string	"SITL 1"
+.LASF931:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1080:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1376:
+	.string	"baudRate"
+.LASF1352:
+	.string	"uint16_t"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF991:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1316:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1343:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1217:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1226:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1324:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1335:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1281:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF819:
+	.string	"USE_SPI"
+.LASF965:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1172:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1409:
+	.string	"serialWriteBuf"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1105:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1203:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF728:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1323:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF935:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1113:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1368:
+	.string	"SERIAL_BIDIR"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1068:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"serialPort_s"
+.LASF1398:
+	.string	"serialPort_t"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF879:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1004:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF1388:
+	.string	"serialWrite"
+.LASF988:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF993:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1104:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF709:
+	.string	"USE_PPM "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1157:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1025:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1263:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1145:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1134:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF1022:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1333:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF932:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF980:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1058:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF907:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1365:
+	.string	"SERIAL_PARITY_NO"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF710:
+	.string	"USE_PWM "
+.LASF856:
+	.string	"_SIZET_ "
+.LASF963:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF748:
+	.string	"GPS "
+.LASF1259:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1027:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1290:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1221:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1003:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1049:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1401:
+	.string	"serialBeginWrite"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF922:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF1188:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1235:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1245:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"SERIAL_INVERTED"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1326:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1396:
+	.string	"beginWrite"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1110:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1345:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1374:
+	.string	"mode"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1194:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1146:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF953:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1356:
+	.string	"MODE_RX"
+.LASF1089:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF982:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF964:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1406:
+	.string	"serialSetMode"
+.LASF1160:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF1064:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1320:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF940:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1292:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1169:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF975:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"IOCFG_OUT_OD 0"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF961:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF921:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1360:
+	.string	"portOptions_t"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF926:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1317:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF706:
+	.string	"USE_CLI "
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF919:
+	.string	"EXPAND_I(x) x"
+.LASF1073:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1206:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF979:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF930:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1011:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1091:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1295:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1305:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF977:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1381:
+	.string	"rxBufferHead"
+.LASF1313:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1357:
+	.string	"MODE_TX"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1338:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF1012:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF995:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1046:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF989:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1176:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF901:
+	.string	"IOCFG_OUT_PP 0"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1051:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF976:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1394:
+	.string	"setMode"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1262:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1084:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1143:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF966:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1363:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1364:
+	.string	"SERIAL_STOPBITS_2"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1248:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF943:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1029:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"options"
+.LASF1166:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF1205:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF920:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1223:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1372:
+	.string	"vTable"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1041:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1095:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1315:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1202:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1308:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1289:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF946:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF969:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1017:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1193:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF974:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF925:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1067:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1453:
+	.string	"io_types.h"
+.LASF1451:
+	.string	"io.h"
+.LASF1447:
+	.string	"platform.h"
+.LASF1430:
+	.string	"target.h"
+.LASF1434:
+	.string	"libc-header-start.h"
+.LASF1432:
+	.string	"stdbool.h"
+.LASF1423:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1446:
+	.string	"stdint-intn.h"
+.LASF1448:
+	.string	"common_fc_pre.h"
+.LASF1422:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1425:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1441:
+	.string	"stubs.h"
+.LASF1458:
+	.string	"build_config.h"
+.LASF1418:
+	.string	"src/main/target/SITL"
+.LASF1438:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1456:
+	.string	"io_def_generated.h"
+.LASF1421:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF0:
+	.string	"./src/main/drivers/serial.c"
+.LASF1436:
+	.string	"features-time64.h"
+.LASF1426:
+	.string	"types.h"
+.LASF1443:
+	.string	"typesizes.h"
+.LASF1417:
+	.string	"src/main/drivers"
+.LASF1424:
+	.string	"/usr/include"
+.LASF1414:
+	.string	"src/main/build"
+.LASF1435:
+	.string	"features.h"
+.LASF1450:
+	.string	"common_fc_post.h"
+.LASF1415:
+	.string	"src/main/common"
+.LASF1428:
+	.string	"serial.h"
+.LASF1416:
+	.string	"src/main/config"
+.LASF1444:
+	.string	"time64.h"
+.LASF1440:
+	.string	"long-double.h"
+.LASF1427:
+	.string	"stdint-uintn.h"
+.LASF1419:
+	.string	"src/main/target"
+.LASF1455:
+	.string	"utils.h"
+.LASF1420:
+	.string	"src/main"
+.LASF1452:
+	.string	"resource.h"
+.LASF1445:
+	.string	"wchar.h"
+.LASF1454:
+	.string	"io_def.h"
+.LASF1439:
+	.string	"cdefs.h"
+.LASF1433:
+	.string	"stdint.h"
+.LASF1429:
+	.string	"serial.c"
+.LASF1449:
+	.string	"stddef.h"
+.LASF1442:
+	.string	"stubs-64.h"
+.LASF1437:
+	.string	"wordsize.h"
+.LASF1457:
+	.string	"parameter_group.h"
+.LASF1431:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\f"
+	.string	"\r"
+	.text
+	.section	.gnu.lto_.icf.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375 \351\235\005"
+	.string	"\242\311$,pm:\200<\020z\315\254\001\323C\022\241\207\254\260\325\n\251\313\303\022\257!,UUU\021PU\325\037\241%mw\333{oIm\007\361\022\266\214\270\372W\005\351H>\334\277>\357\202\244xX\261\036.\032X\365\361'\316lF\332\355[\237\254I\267q\266_\321@\230?T\377~J\256\344\211T,\363\274\216Ji\3110\337\354\333D!\203$\300P\021\365<\365\333\020(`\274\276\236\342\374Q\302\251O?\037//\337\377\247\307_;h88\021\213\232\f"
+	.string	"0^\025\"\200\230 H0\023\004(S`\206I\367*kO\0256\231\344m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"]\004"
+	.string	"\302\005\020\025\240'\351~\373\377\377\377M \231\375\366[#\215\220\275eJ\001\036\370\2438\016Dx$\200\031\305\314D\031\235=\321\021\225\305\234\215\216\366\210J\235\213`6\330o\367\3723\374j\251\244\300\013\001\036"
+	.string	"8\t"
+	.string	"f`\270\005\343\330g\203Es\254\247\337\t]\245*\004\300@%h\236\030d\201A !\f\006\306\241\210y\314\250@<\231\310\201\025\242Z"
+	.ascii	"TG\2476\200Us9#&\312\231\212\\\230Ap^T\200!"
+	.text
+	.section	.gnu.lto_.inline.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\017\003\365\b"
+	.string	"b\r,1Pm\222\016H\243AD\220\355!\234yR\367\307b}\t\253)\304\fk\247\241\201\211n\2211\273\252\252\252\252\b\363\375\271\3456\373\355\223\275\345N\001_2\023\025\035#\321"
+	.ascii	"\007\027\222\231\320\221\245B9\310\232Y\232\311Su\377\005\251"
+	.ascii	"C\023\311\344H\343T\255\342\257\251\331\337WC\250GfZ\276\307"
+	.ascii	"K`T'\317\220\231\234\307\315\342\016\330\250\303\373\006\327"
+	.ascii	"@\222\321\201~s\017\231\020Q\302%\305E\tf{\252\256|\364MZ\233"
+	.ascii	"\204}\245\365\005\315\314\034\355\336MA:\021\030\224W(\207\203"
+	.ascii	"\347#\320_\252\325\266\205\323\360|6\006\0363^, \200\242\031"
+	.ascii	"\302\333\001\347\b\022\177\2727^D\262\006\361@\327\022\230\027"
+	.ascii	";\216\\\030\320\273s \226\314\265\031eX\022\312w\216\030\335"
+	.ascii	"\353b\n\221\t\274Zx\335\302\243\203\341pc\342y\016p\3047$W\240"
+	.ascii	"\213\035f\351\300\374\027g&\026\314_G[b\264\326Q\323\330\214"
+	.ascii	"o[\320\005\275\233\247\257cr\030\341\261\222\035L1\335"
+	.text
+	.section	.gnu.lto_.jmpfuncs.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`e\001U\005"
+	.string	"\222\b\031 \240%I\007\377\377\017VU\325\244\252\031\340\005F\216#\307\377\267\247Yk\233\265\266\021\262\211L2;\030..\300\007\214\200\002\001uGJ)\335\252\203\033n<\007\2468\250\234\2277\250+[\267\316"
+	.string	"\305p\345\211z\0329\217\034^|<G\335\351B\335\312Jv%ok1\301\026kH\202\277\f1\026\004\033"
+	.string	"=\213`\337r\207`\237e\261\360\304\211\342\242\261\216\313l#($A\036\270X\317\305q\205\364\246F\314\262m\b\341\030\251\310\261LBaX"
+	.ascii	"p`\261_i\327\351\t\"\260\034J\003\264\211^\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\230\004\f\231\004\r\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"u\004"
+	.string	"R\305\022\036\2407\303\001\340\277xVUUUU\367\354\376\377\377\377\377k\210\210\210\210\bm\262\267\224)\377\317\3264fA(\207\304\200\024\216E\200\312\007\206@\035(\007\364\367;59G\305\234?\345Q\371\253\307\262\313\376Z\260\323\316L\004\036"
+	.string	"Q\240"
+	.string	"\360\301\300\366\306\nN"
+	.string	"\204\203\201\323@\r`\006\006\001\366"
+	.string	"\306\200\025\300nah"
+	.string	"\354\300`"
+	.string	"\023\240+\030\f\f\242\250\305@\020\007\307x\266\240\354\335\325j/O\337\024\247"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.lto.80da78188702ee93,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.8.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\256\002\305\025"
+	.string	"\226(\216J\300\322Q:K\211\020\327G}\240\003\032\205\202\326\260y\b7Ds\200.p\276\0220\304_\351<p\002\340/\253GS\0251{\300\272\002\327\023\233]T(\025GE?K\016b\006\366o\262\346\301\215\203\311flv\023\271S\ny"
+	.string	"v"
+	.string	"v"
+	.ascii	"\021\374\"\021\233e\016\325\203\361\364\005\024\373\264\377\342"
+	.ascii	"0r\377\351\\@\255BJO\265\226\013\2142\236\272|\001\326\351\370"
+	.ascii	"\022\326\251s6\225\t\017\200Q\317\221\220Z+lMX\234\271Sqg\316"
+	.ascii	"\337a\317\267s*\266x?)F|<\321\245J\b\365\340\247\217o7E\246O"
+	.ascii	"\020N\275\"\240\357\203O\260BG\317\007\364\331z\251\265z\366"
+	.ascii	"|\037n\326mW\260-\301\236>\002w\035x\217\255\227?}y/kz\322\351"
+	.ascii	"\007h\001)\211\252\365\347\212H\225\242P*\016\374\355\373Gg\262"
+	.ascii	"I\343\036\303O\372\322\201\021\244\322\311\016I\335\365\310\021"
+	.ascii	"\243\363J^a\301\035\210c\342\200\206}$\261\006\221T\236&#\227"
+	.ascii	"\215\330\347\221p\377\351l\007\b\036f\bO\375#\234M\236\376A\223"
+	.ascii	"/\0241\333^a\311\035\210#\326\240\006-\\\bk-QN\035/\377\340G"
+	.ascii	"\034C)\235Xk\255\342\310\374\272\326"
+	.string	"\344\232,\301\333\035\332\237,\214\265\362\264\370N\030j5\254Sr\r8\303e\324\214\265\326\026\277)F\306'\322a\235\276vd\307\357L\237P\364\245S\020q\243*\335/\256=\322Ots\350q\277\357\261\322\315+\303\f7)\212\347[\337\020\b2U\347\320.ws\207\354\273\234\250\022z\205\354q\232lM\277\376{\027f\323fs[\253\300\2600pY\211\265\244\f\240\315fd6\267\231\332\350YJ\214\254f\243\335`7\033mC\315\006\003\233\251\311d`3\333\r\226\202\3004\032h6\230\r\r\215\rF\226\272\257\320\225\224nwt\207\024Tmk-N\272\273>6\016k\334\377\b\362\340\231U\036\367\300\271\343\316\243\036+\037\352Fv\"?\207u:w\326\360\t\321:Q\371nkg\021\016,v\301\273\204C\246v\0035 `\002\231\2722\017c&\030\016\254\346\216u\031\032\2555\270\214J\267"
+	.ascii	"h&z\343U9\264\2218c\260\263\230\032\004$\344H\023M\013 \371\300"
+	.ascii	"\235\354)\213\323\273\366R8\003\355CQ+o\326K,6\366\220Uh\377"
+	.ascii	"*\376\201\325\241\\?\256\026\bZ\314\006\013\201s\221-\213\257"
+	.ascii	"\220\007\n_\230\006f\243\230\233\260s\337\300\245Q|c \304\355"
+	.ascii	"6\313 \255(\362\247w.\374\004"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.9.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\035\t"
+	.string	"\026\321?;@\345&\035"
+	.string	"|\256(h{4\274\222O\371r\304fO\235\262\003P(\021D\263H\233'\202]\243\313\355B\233\366\f\217%Qlx\234Q\356W\317\374\300\231\037\032\215\220\275S\n."
+	.string	"."
+	.string	"."
+	.string	"\")\256\205c\245f\267N\316\0216\307\256\033l\216\311\220\207\217\241\377\224wX3\250\224\3511@bw\035Q)\217[\336v\307\366\204m\230,\0071\273\035\255"
+	.string	"K\203\275\224\330.\331\232=\260\\\214\366WG)\275\222N\260\253\222q\331\255\f^\310\216\271f\266}\223\237\224\034^5\222s\222\033\2661\316\n\263\335\365\370*\032\031\031\3111\237$\023FV\247\330\262\366\261\021\200]MQ\202\330\277V\252lG\313\327?^\002\001n"
+	.string	"=@D8p\236\255\300\373\204\272\021\030\3722\1776\212\356\243\0368A\352]|\0244C_W1?\024\234\233\202E\026\036\235#\221\210N\255\356-\003\f"
+	.ascii	"c\223\240\314\2000,)\016\343\314`\220\261\3005\361\215E\376\300"
+	.ascii	"\004\001'zT+\035a\222\001"
+	.text
+	.section	.gnu.lto_serialWrite.10.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"-\013"
+	.string	"\266VP> Q\224\016\263\002\210\327:\344"
+	.string	"\331\340C\325\303\344Z\245\301<\002\264&\342\315\214\365\033n\322\245\0320\362\366\030D\260\027"
+	.string	"*\002\005\232\331:&\213"
+	.string	"\316\2650\233y\n\273\021\267\2252\245="
+	.string	";"
+	.string	"?"
+	.string	"\250\320\005\354\236\\\300\330\375(^\020\017\375}R\035\306\023\250\016\355\3317\016\220"
+	.string	"\274(\255\300\261\273\227\202\270\367\364\374\203\\b\372\020==\034\354\256\323\364\301\341\326\333V`\033\202}M\366\277\277:\352\207\232V\230\316H\372\321\352P \265\273!\245cC`\f\021\266o\037\205g[\266\204\306E\363 \266`\274\177\027\254\273\036l<\210\207\022\031\227\347O\370%n\302{$\025\271RUJi\207\204\267\350\304]\r\031\237\005\206\rT\035\246\032\260+\\\005(\356n\306O\361\351b\210C?T\035^\003\324@\2152\345\311\210\031\2339\354O\224\372\301~dw\327z\n\021\2604\003\016F\323\300r\311T\006d\230g\363\351<Z4V\231\260\321\270\254\273:.\263\240q\234\313\243m:\027\306uW\005\2017\n\031w}\266\215\273\254o\037Y=\031\222\b\031i\006[\251\n\325\251N\020\f"
+	.ascii	"c\223\240L\350\023\007\026\027\0340\024\330\246\322Y\\M\360\313"
+	.ascii	"e\230\030jv\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.11.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\262\001\r\021"
+	.string	"\346\241wH\340\322&\035*\001d\237\341s\340\204\201\020\210\bbK\036\2575h<\327v\017)Z\211\202\313\213@=\020\272\323\030\332\3268\354a\373\366\301\030\224\321\372\312\023R\214\212\363\005\301\247\261\242*`\020\333 \207\354-wJ\001`"
+	.string	"b"
+	.string	"`"
+	.string	"\367\361Y\234\007|\217\314\t\354\322\210\212vC\024\237p\237\016O\262}r\037\331>\r\3329\020t\b`\343C\315\307\356zz\002\004\025\374\224\032A\377\265w5\263\231O\356\346\3224\273\271\312\021\234\030G!3\231Lp\244\242\304k\2176\263X\214"
+	.ascii	"Vv\327\261f6\342\336n\233\3056\005;>\236\007\272\345\214\216"
+	.ascii	"2\372\002\006\220 \321\261+bIi\215&\215\235\013\375\366\273\332"
+	.ascii	"\367\027\017:uA\237\375!\241\230\225\030\210\bIH;v\303\223"
+	.string	"O\263p\237\367\203@\373dw+>\215\257\371.\376\003\036\3105\244\310\312L\204(\332]\024K\340>Md\267\363\305\370\026a\214\022\004\356\263\243}\217\001\235r\352\2506\361\2403V\371\210\344\004\371Q\325\361]\266\250\025~p\310b\222\355\013\237\341\302\355\312T|\031\034Z0\333g\324\022;\303\211`\270\335U\361a\260^\034\212O_f\373\274\032@\352\241\211K&\341\271\261\361\207\035\306\242\352\330?\200\003\204\207\225f\037\3507=\374\273\367\374\334\205\036/\207\2614\264R\023\005C\265H+ha\320\300\301\202O%\245\200*\305B\301^\254\025\347T\n\006\324\312\245zy/\227j\303\312\325\342\261V(\027/\345zy)%n\275\250\\\036\254\325ry\247\220\346J\253\375A\017#\032\215M\325\361\207>!EN\354t\252\215e4\251T\033;\304*\013\3615\336t\346[\322\322\216<E\223\006\031"
+	.string	"c\223`\314\300=w\3508\370\321WFQ4A\274I\257\255\243\"i\353f\260w\245\263(Z\341M\313\031\226\215"
+	.ascii	"\0372\2401(\210\r\022Ac1\024nq-\357\024\262\251\3115.\005\005"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.12.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"]\n"
+	.string	"\306\323H> \005)\035"
+	.string	"\211\213\220\220\333#D\223\200\216\313\253\202`&\243\345\001\b#\347Z\253V\177_\363\250\001#oO@6\001\200\004C1\232lD@\204\201\023N\326c\027L\362\t!{\247\0246"
+	.string	"4"
+	.string	"7"
+	.string	"~\313]T^m5\005\006\242\205\314\b\330\255\240\347\b\335\271\355\006\3359\212\362\325\347\312?\314\033f\001^0\326g\347bw=_0\222\233\336\266\203m\f\373\007\001\366t\367\372o\333\364\244\323\357\f\340(\344\354\216\324\006\354\rg\303b[e\177\266\200\bhN\373\262\277\250^S'\330\215\001\250\331\255\020~\360\316\271z\266\003\035\265(qQ\226\355\214\317J4\037\243GwnR\006\233\3432\245\267\353\n\3711\250\016o\345\234\237\352\316\235&\250\310Z\263\346\317d'\315\256\254IO\354oKc\016\216 MPTH\200B\237\202pd\022\235J\223\350y\364\321\020\211dX\202%\031\242D\222\004\232DQ\t\034\221%\370Y\360\270\021\222\340i\034I\360\253{w\324\323\242 \376\346F=i\016"
+	.ascii	"c\223\240\314\2000,\204\271\031d\007\366\256t\326@\023\206k\342"
+	.ascii	"G\026\344\003\023\004\234\350Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.13.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\245\n"
+	.string	"\306TLB0\251(\035\300\346\334\n\307\347\fy\302\004\322\275\354W\355\321\200\310U\3342\301\026\265e.=\332\353^\261:>9F{$"
+	.string	"\331\r\003\003-\300D\372\202\206g\360^\230\205i\243\034\020\273\311\336;\2458"
+	.string	"7"
+	.string	"9"
+	.string	"\266_\340\006L>\315\n\200Ea'&\n*\354VN\363\007\372l\336\201>\223/?=\236\374\277>\t\254@X\261P\217\030\216\335u\\\261Rny\333\023\266;\354g\002\216\246\257\377\234\321QF\037CU$d\032\354\242\304.l\204\354\301"
+	.string	"\333\267\217\300do\266F\201\023\343_\276\353\007L\257\2453\354\266&8\330\255\025\246\320\236\271j\016r\203E%Q\266=\316 \264\200\344\033\241\317\242\224\260C\236 \324vU\035\037F\022\321\004<\363K\364\331%D"
+	.string	"W*\306\274\265l\264`WT\224.\366\347\356\256e\313\016\266"
+	.string	"adh\\p:\233\206\356#\362\214B\221\247\371\263\371\360x`\027r!\330\221<\020\304\211<O\210\373\200!\267\211\360\007\322\201\334\350\373@n\253\373\271\262E\245&%K\274\305)\035%\r\f"
+	.ascii	"c\223\240L\350\r\003c~\301\201<\3006\225\316\232h\302\b]&\300"
+	.ascii	"1#\325\264I\230d"
+	.text
+	.section	.gnu.lto_serialRead.14.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"=\n"
+	.string	"f\024J?0\345(\035"
+	.string	"p/\3770\f\371\307\036\207(q\025q-t\331\330\3305\300\262\2407\232\266\372\373\275\026\033\304`\274\202\222\33500\200\001>\332\3768\306 Y\032\242\230\033\275\355&d\357\224\0026"
+	.string	"6"
+	.string	"8"
+	.string	"\343\021\350\271\372\003z\316\266;\037\225W\037M`t\304\243\203V`w\354f\311W\227+\377.\337V@j\257\030\353RS\261\273\226\257\330\307=o\333\301\266\205\375\032\273\353)\263-M?\373\267MZN\351k\250\312"
+	.string	"\005\002\273\260\332\201\025\300\001H\261\255\2627v\r\340\221\322>\313[T\237\245^\260+\223\231\331\035!\374P\3179\223\"\3045Y\266I\247\201u\327\005\362c62P\364\234\234\f\266x\030T\335]\220\377r\322\250(\347\374\024=\367\231p2k\311\2327\"+\r\330#KN\022\373\333\006\216\030}$&:\036\020\307\300\023\225B&\261\364U\2138\027\241/\364\304N\f\275\323\027\216\272\322\027\"u\242P\3548\013\0061\274\2603\201`\330m\306\275\351lhM\016\023\310mZN\032\n"
+	.ascii	"c\223\240\314\2000\354\bs\t\330\273\322Y\323L\030\344\232-\335"
+	.ascii	"!\242\351\232O"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.15.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\235\013"
+	.string	"f\026RD\020\215*\035\260d \225C-W\035\215b\024^\233\005\236!\314\313\256\007\222\">\022\377&\232\305\301\223\213\032x\363\230\b\263\250\f@\004D\017\n\034\332\377\353P8!v\034\346\005=\344\307\367'\233\354\235R;"
+	.string	"="
+	.string	">"
+	.string	"\273)\017\037vG\020\177\324S\217\317\320N\3531\332\251E\273\304\307\t\373\226\203\005.\023\273\273M\t\027/E\377\255[N\250\322e\345dw-O\250\006\367\274m\017\333"
+	.string	"\354\233\004\273\353\231\262\317\372\351W\177\226I\313)\375\212\206A\304F\210]\006\261\024\013\243 *\330\376\305\256*\215\034\277A<\313\200-\273\020N\244\324\323\216\354\030\013\232K\373\032\256\022\277\"\375\"3\233\226\323\227\007\nf\311\266\347\035\276\272\233`\343s8P`\244\235\312\251a\207\177\215\352\356n|\227(T)\234\372$\355\364\323\202\304\312$c\226\257\013#V\242\260\307\222\234\021\354g\033\035\210\013\320\tq\002\252C:#$%\"\232M\006\243\343|8P\370\361\2529\231\001\234\007v\341\026\202\235\310\003;\333\307\343<\033\007\f\267\f\207?\002\035\270\201\276\017\334.\343>\333\2312J\006\230i\"p\205\244\001\017"
+	.string	"c\223\240L\350\016\007\006.\024\260w\245\263\032\233\340\3145\240\031\306"
+	.ascii	"\341;5\372\251\033K\312\n\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.16.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"%\n"
+	.string	"\366\323H> \005)\035"
+	.string	",\004\240\b\300$lx\r~\210\313\f@/'Mc\246hA\305\031\333\353?\315\353\006\214\274=\001\331\004"
+	.string	"\022\f\305hj\353\230Dd!\022P\243"
+	.string	"\b\261\233\220\275S\n5"
+	.string	"5"
+	.string	"7"
+	.string	"\005\365\\w\202z\316\266= \225W/M`\037\001\341\240\005\330-?Z\362\325\347\312\177\3137\025\017\231W\214\365\311\221\330]\317W\254\343\246\267\275`{\302~\027Tf{\272~\366o\333\364\244\323\347\324\232\233\203\230]Xm\300\332p4)\266U\266gw\037\2379\355\257\234E\365Y\352\002\2732"
+	.string	"3\273e\203\031\272s.\037\225F\204\270(\3136\305i%\030\r1\243\236\2334\301\276\370\013\331\355\272B\276\013\n\243C9\347\247\352\271S\203\223Yk\326\354\211\354\024`\227\254II\354o\273\273\016v \201\036 <\237Pg"
+	.string	"\034\231D'\322\024v\036u*D\341\b\222\0379\202\250p$}\246PT\372F#\371u\020,Z\200\343w\022\305\361\363\312\275+Uh\321\r{s\243\2364\013"
+	.ascii	"c\223\240\314\2000,\204\271\031d\007\366\256t\3264\023\006\271"
+	.ascii	"fKw\210h\272\346\023"
+	.text
+	.section	.gnu.lto_serialSetMode.17.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"e\013"
+	.string	"\026\226PD \253(\035\300\362 \246\305H\337\f,\301\274\247\316\033\306\206\344\254\310\362FB\363\202\225\373?\226\340-\264\f5r\214v2\230\354\002"
+	.string	"K5\242>\200\327\032\245="
+	.string	"\307\r:ldt\374nd\223\275S\n:"
+	.string	"<"
+	.string	"="
+	.string	"\213\2220aw\344\360F=\365\370\n\355\264\236B;uho\370\270`\317J\021hu\330\335m*xx\031\372g\375b:\211\227\226\221\335\2654\235\f\334\363\2665l\233\330\027\t\273\236(\373\253\237^\365g\231\264\234\322\267h\0260\\\300v\013\304>\354\213R``\373\030\273\212\0329\376A\370\325\212/\273\b`%\3654#\263p\320\\\332op\007\341U\244Kl\323r\032s`\300\024m\177\036\301\253\273\0026>\004"
+	.string	")#\355TN\013\033\274kTww\343\267D*5u\352\223\264\323\317\b\r\252\222\214Y\272*dX\351\301\036E9\023\330\317v\003\234\307\373d\356\360|\200\204xh6\231\t\256\003\342\204@PW\335\311\234p\272\217\0037\360\343D\335\347\331@\035\347\263u>p\313`\330C\341\276-\344y\337\206\031\367\331N\224I.\274J3\200!$\235Y\017"
+	.string	"c\223\240L\350\016\007\006.\024\260w\245\263\032\233\340\3145\240\031\306"
+	.ascii	"\341;5\n\216\361\251\246\301I^\\\223\f"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.18.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\215\n"
+	.string	"&TJ@0\3076\035"
+	.string	"\313\235\237a\237\340\376\367\n\372_h\331\363\tV0DD\177\027\006\334\202\210\210\361\266\001\331(\246\324\314\234P\205\001\032\004aB\016\305C\335\030t\202\350\037\312\214MD\310\336)\0053"
+	.string	":"
+	.string	"7"
+	.string	"\216\310n\371|\303u+;\303u\313\245\215\340g\313\236\364rbJ\355\256VY^\236\226\376M?0C\240S\fcwM\315P\312]o\033\3026\207}\204\f\026e\005p\261}\215\215\021\330\352\314I\345K\026P%l\211\212y\332]\2167\262[\233\n;m\364\024Iid\2670\323vj\037\3461\345G>p\205]\221\314i\367\344\004\316P\200\032\251$\276hUk\245\325\376\204\320\233\336\230T\220)\200\004\006\226.\260O\020\255+\366\253\335]W\221\375\322_\375\374\353G?\275\256T\001\207\001\273(\r\002$\370\t;\213#9Oe\t\017\205\305\305\304V\321Y\360:\220#G\360\313\334u:\270O\364Fm\024=\220O\364h\340\307yh\2358j\235\007\207\037\236\250\221a(j\232s_m\025\005\016"
+	.ascii	"c\223\240Lh\t\032\030\270P\3065\366\301f\347\204\030p\342\t\215"
+	.ascii	"\b\245\b\032\213\241p\203ky!L2"
+	.text
+	.section	.gnu.lto_serialBeginWrite.19.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\335\013"
+	.string	"\266\326RA\020Q\234\016p&\200rr\376\tHUW\"\361XS0`=\315\256\364\201^i\016\331>S\361_\177\nV\326\276\"\332\232\267\022\001"
+	.string	"\360\\\254c\201\277\327"
+	.string	"*=\337\326\303\361O\2156\3312\245?"
+	.string	";"
+	.string	"@"
+	.string	"\323\237=\343\343\210\275\210\270a\204\306\356fR\304\277WR?\377!\237\224B\321+\323eU9\251@\001\b\301\n\001\n$\304C\256\034B\222\352\005aw\255\245\320\303=o[\202\355\b\366\037\004~\265\273k\331a_\374\247T\253\252\177]\246\027\005R\273\035R7\266d\272\370\260}\212}}`\256\366K\334\304w1\364"
+	.string	"\273\035+X\354\216\t|"
+	.string	"\373\364x\002\326'\366\212\365-\244\364\260\355\261TN\020\221\001j\r\333\334G<\330.\230\361Sh\360@\326\247J\213}\341(@\330\356f\374\023\237\f\030\211O?d}^\016\210!\2164e%\ta\254\332\260G\221J\017\007V\300a\320\300\301\002L\346\"@\333t4\037\257\263a\336\\(h\266N\3632\257\3230l\035'\353l\232\n\331\246\363\262\213\305\234\005\255\313>\034\327e\224q\017\242d$I\325D\247\264J\033"
+	.string	"\245\310\034$\037\024\005r\n\021"
+	.ascii	"c\223\240\314\2000\354\263\260u\033tc\2269\332\300\035:\367\030"
+	.ascii	"\213\301\336\225\316\252f\202\013\227\001\277\325\024q\227\247"
+	.ascii	"jr\212\246\366"
+	.text
+	.section	.gnu.lto_serialEndWrite.20.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\335\013"
+	.string	"\266\326R@\020Q\234\016p&\240\365\344\374\023\220\332}\021\215\345Z\356`\347\313\371}\226i~\032\262sj\037q\243`e\355+\242\255y+\021"
+	.string	""
+	.string	"\317\305:\026\370{\r\240\242|\266\316\260O\2156\3312\245?"
+	.string	"<"
+	.string	"@"
+	.string	"\323\240m\343#\211\275G\310\206\017\034\273\253\311\021\007oI\005\375\253.!\211\241[\037.-J)d\025@\f-\004+\024\210\253\256\034\304\221*\006aw\255$\321\303=o[\202\355\b\366\037\004\276\265\273ki\262\237\372\247T\253\252\217a'dTn\354v\030\331\261\"3\206\t\333\237\330X\351r\265\237\342*\300\247@\027\260kr\361bwL\340\003\331\247\307\027\270>\263S\256\0070\244<\331\356\\*'x\324\b5\207\355\356\037\235l7\304\370-4|\237\353Se\305\276p\026\237lw1\376\nO\206\254\304\247\017\272>/\t\320H\211t\304\n\022b\306\252\016{\f\251<9V\260a\320\300\301\202\013\3062`\323p2\236\217\303e\326X(d8o\373\264\317\3330p\336F\343p\231\n\232\306\3734K\305\235\205\315\323<]\347i\223q\217BD$G\226D\247\264J\033\be\310"
+	.string	"@D\350\nU\n\021"
+	.ascii	"c\223\240\314\2000\354\263\260u\033tc\2269\332\300\035:\367\030"
+	.ascii	"\213\301\336\225\316\252f\202\013\227\001\277\325\024q\227\247"
+	.ascii	"jr\212\246\366"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.24.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`<\005]!"
+	.string	"\346|\321H\220\332Qc\004\310Q\323S\237\221\373\360\343\036\321\231\366\034\231\200\350gxt\035\264\360\020\367\023\335\376\300D\240-\367\220\353\027\341h\002\232\0021]\366\304F\313$\320\214\366\002\021"
+	.string	"\320Mt\3731\214\244\333\356\275\245L)\266"
+	.string	"\276"
+	.string	"\272"
+	.ascii	"\305K\034\322\210\344\314\372+\277\352V\300+\361\2269s\205:Z"
+	.ascii	"\034\357\275\026\322\2376f\222_T\316\326S%\371}\231P\364)\242"
+	.ascii	"\232\342}1\2449\345j}\321?r$\300O\021\035\300\275NK\216\367\026"
+	.ascii	"\023\374\364M\372\323\305\023@\177\246\027\200\376\264_\304v"
+	.ascii	"\221\275\345E\036wh\240\275\245\006\351\366\245T\345\345\336"
+	.ascii	"\213\373iw\330z\266\\.\2277\2137j\201\237\241\247ik\n\364o<m"
+	.ascii	"\005\321\3503\245`EkR2~\316H\301\270i\316\220\\\370\220!\"\231"
+	.ascii	":J2\344\217\257LDa\265\002^i\236\316v\356\275~p\306M\273m\034"
+	.ascii	"\266=\330\247\203\325\263\230j\364\274U\233\266j[\253\256/\376"
+	.ascii	"\037p\004F\356u\261\374r\233Nd\324\263\036\305@6\302\231\025"
+	.ascii	"B\250/\262+,\336\330\0262\320\207\003\226\254\250\226p?\277u"
+	.ascii	"k\337\347\372\227\220W\202 ^\272v)\227\\Z\337%\364\251\035:\244"
+	.ascii	"\3218Z\342\022\262mO\372\356\304\177r(\007\204\f\271\367\332"
+	.ascii	"\212\256\325\2631\232\271GY\254ly\001\003\337\265z5\017\2648"
+	.ascii	"\244H\363\316\230\271B&_d^H\337\247\210\354R\205!\026Y\326\227"
+	.ascii	"\370\307&\277J\253\312=\353F\037\213f\225\263\217\325\344\267"
+	.ascii	"s\264DA9Fvo\361\346\2475\234\211\257\372\306\"\333\346\033\201"
+	.ascii	"\266\355\247\355\2427\307\037S\221\201\310\312\214%\337AJ\354"
+	.ascii	"B9\210\032S\356\267\356\235 \022\2653{-Ja\374+C\033|(\377\207"
+	.ascii	"\376D\255\t\306D\303\007\366\343:\255\222$\022\3214\020j\332"
+	.ascii	"\377\240\032\023V\345\177<-H2,X\313L\240\336\332Z\323:h\022Z"
+	.ascii	"\243\017\247\002bJ\212\020%\320\237\326\"\260\210K\031\221\336"
+	.ascii	"+\314\361\303T\350|\250\035\372\263Z\232\036H\202u\351\177\275"
+	.ascii	"f\025C\314\353g\221D\234r\355\273n\023\224J\376\370\264\013\227"
+	.ascii	"\330\255e\2667\357\275\327\332'\333\353\360P\222U\353d\233\242"
+	.ascii	"\312e\224\255\223}\252_\346W\177"
+	.string	"\314\315\366\253\273&SM\253U\247f$x\352\211\017\005\371v<\247nH\327cZA\017\203\006:\013r98\001|x\202tC\275\240\237\324<8&t?<\237\036\256\307\363A\361\303\353\301\005\375\350\200p<\274\036\016\307\200w'|x\270\241\335\216\207\263\331\256\267N\306K\340\022\026\264G\2663\373\344YW*c\177<\316x\336\354i\231l\24616Fy\332l\3152\335\274f#D\021V\345Y$\307\255e\256\325Z\346\323>\013\202\016\345\r\324>\331\276\331g)\370iovV%\t\210\315\376\n\3475k\263(\230$\033Gui[\345\211\330\335\272\215\217<XX\201:\263\267\246Y\333\232\220\254\321\205g\301\020\024\202fi\306\222\026q,%\322{\003p\250\201(\307\224Q\306LI$33M\213\001\200\002!\2629\017\020`\251\250i\016g\263\266\301\302\355\313\220\244\234j\220\027\274\205\322"
+	.string	"Dk8i\347_h\341\241\364\324\r\016@\023\272\237c\210C\251lk]?t[2\\\344\343F\031\233\355q/,\255\343?\372t\214\323\316\220B\212lp\231\204\337\027\320=\226X\377cq\233;\361k\316k\t\237"
+	.ascii	"\317\035\257\030\222S\366\270,\022\324\033\355\225\007\3039\300"
+	.ascii	"\276:\214W_\246\310y\332\357\235\355\257\343\255%\007TP\024\351"
+	.ascii	"<\027\341\212\006\024U\017\362\352,\031\263\223\324|`Y\320\033"
+	.ascii	"\3629[$\376D\036-0\331]\375\237\002\252\\\202\376\233\037X\213"
+	.ascii	"]\267\341\252\313\304y\337\305f!\260\254\004\037<\376\370\025"
+	.ascii	"\321YdA0=W\036\353\230\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"\335\006"
+	.string	"4\t\356\001"
+	.string	""
+	.string	""
+	.string	"\002\030\177 \257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \b\177!\360\372\2508\272\200\202\002\t\177\"\200\200\200\200\004\n\177#\013\177$\362\375\231\027\f\177%\r\177&\016\177'\017\177(\020\177)\021\177*\022\177+\023\177,\024\177-\005"
+	.string	".\201\204\004"
+	.string	"\265\013\004"
+	.string	"\225\006\004\001\221\205\327\307\003\001\365\006\004\003\265\001\003\004"
+	.string	"\242\006\004\004\303\376\236\020\001\325\001\004\005\225\001\004\006\007\b\t\n\003\013\004B\004\f\321\231\263\346\002\r"
+	.string	"\036"
+	.ascii	"-\022S\b\334\2521\200\034(\f\024\001\345\266\024\002\350\374"
+	.ascii	"\300u\265\233\241F?\004h\017o-K\003z\200o\200o\200o\200oL\365"
+	.ascii	"\r\370\206\030\276\001\276!\025b\300\237\235\004PE\\g \200\314"
+	.ascii	"\034\3141"
+	.text
+	.section	.gnu.lto_.refs.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.80da78188702ee93,"e",@progbits
+	.string	"(\265/\375`\221\030\205k"
+	.string	"\252\257\234&R0RBJ\007\207\341\343\326j\307$\0072O\217\374\206\271{\241r\035\205FD\217\001\r\230\274]=\270\224M\255>\337\264~\353\356\256\376\372\302\241\334u\0213\"V3\"\"\342\001r\314\335\225\224\215\007\241"
+	.ascii	"\205\224\025\222\025\024\352\212\375\326\b\2212\005\376\001U"
+	.ascii	"\002g\002\255\362X3\031.s\036c)x\304\225\307\324{\207\314\t\354"
+	.ascii	"0"
+	.string	"'\220\373Jb\250\245S\317D\354\241\034\005o\025\336\264(\306\334\250A;#\256;HC(\215h\365<\330\026abr\326\326\226Ya\316bre\234\244\216\264\312`\274\205C\\\353\202\002\303\003\247v\206J\245\272\"\245\326*{\361\023\274\362\027\356r\366\302_W\263\220wy\357\252\263\023\345\254Rj\265\005\253\320\251;\354\371G\307?\272\347\260?wm\331\241M\371\320r\342\274\205\347\f\232$U\253\254\205\267rT\216\f[\345,O\223\003\215C\266\375K\r\302\253J\254\325\017Y\b\316L.\234$iP(\255\234\271\376\027\023<\215w\257\325\275\227\005\316\324\020B\253V\017\375\315Ms\315\032f\253?o\375\\\305V\274L\213L\310\313\274w\365I\301\200\204-iUK\205\312\342%L\253\237a9\213\261\326\273\202w$\tTY\253\347\300\362^\234\253|\200\344\235\340:\366m\277\256\254Bg9"
+	.string	"\035\177\300c\361\237\001\242\033\360w\230\033\245"
+	.ascii	"\376[\371\331r\035\347Oyl\370\356Os\376\207\371\031G\314\227"
+	.ascii	"\037\242\377\313\374\274#;\2316\377shn\377\331~\316\201\346\374"
+	.ascii	"\315\206\267\003\364\177\333\317\272\273\251\375\\\003\323\177"
+	.ascii	"'~\336\331\3627\030\336\337h~\316\340\271\277\317~F\341\177\334"
+	.ascii	"\317:\025DOx\317\337c?/\375\254\364\363\217\237\223~\376\341"
+	.ascii	"g\037~\356\341g\036~\336\341\347\036?\333\3603\016?\363\370\371"
+	.ascii	"\206\237\211~\256\361s\357\347\031~\036\372Y\206\237c\370\231"
+	.ascii	"\203\237a\370\371\205\237y~\016\341?\321\377/\377\327\376\273"
+	.ascii	"\360\337\314\317-\374\314\302\317+\374\254\302\317)\374L\343"
+	.ascii	"g\241\237g\374<\302\317\"\374\f\302\317=?{\360s\007?\373\374"
+	.ascii	"\007\372\037\366\237'\032\215F\377\264\314\237.\360\003\220C"
+	.ascii	"F\330\314*\356\271vVk\365\262\245t\224\256\322[M\245\261\332"
+	.ascii	"\252\233\350\252\236\302k_1\326\373\210F\202\210N~y{\366U#a6"
+	.ascii	"n\036/\230\322\366L\322JX \025A8\246=\211\260Y\212e\264\\Z@<"
+	.ascii	"\357]\337B\372\252\245\030\f7\231\033pq\203\342\252\217\r\225"
+	.ascii	"3\246\204\3236V&\b\002jC\241\342y\302dUuf\227h\252\334W\026\241"
+	.ascii	"\222~\362\246J\305\220\240Z\266"
+	.string	"\022U\250\216S\2556\223N\202W\006\272\311\333I+\237\033\256w\355%S\\\321j\265\207U\350:%c\317\f\350\322h\224\031\320=\005c\325\225\311\001(1B\307\304B;\243>)\353r\322S-\324Q\031S\"\206\213}\272e\237\256\026G\312\025Y\264\213h\344\322\032\0222\255>}b\237\"a\237\026a\237\016\261O\177\3307T\221\234\322I\026\232&\017/\256j\254\210V\337P\3736c\337a\366\275\305\276\261\354\233\357 O:@\253\326~jc+\251\322\304\331\352J\2741\343\303M\n+,\334\305\002\251xU\2550!\307&\202\340\372^=\323\3300\323\322\360\232\335\030\026!\307\266+\314\205\303\302(\233\310Ln\036{.Qk\214\362\212\n3\177 \211=\305\330\311\315\343z\203\350\306\272\204\034\333\330\352\017j\303o1|\030o\200@\252\362\214\340g(:\211\313\030M\f\037\306K\324\302\212"
+	.string	"\2113\210Z\333\275\353\377\006\242\225\332\251\227\272\330>\232\251\233\372G\003\341\265\223Z\370\0366\322W\254\367\022\357\275\r\254\310y\222\004,k"
+	.string	"\365\355ds\227U\350\316\205\343\354\3377\272\003=\022e*\356\034\265dmpJ\255\362\024\274\325K\274\020\241b\313I\255A\353Rc\317bon\307)\232\210\265\235\335\314xI\306\230H\265\232e\r\364\205S\331\364<C\231mH\230\254\251VY\215\325\360z"
+	.ascii	"\257\245\302\254k\245\023'%\256\215\226=\037\240\343(\037\240"
+	.ascii	"\343&l\017\032\264\364\t\361\230tvF\333=\273\\\261j\225\317\354"
+	.ascii	"\272\306\210A3\323\215q\202{\373a37\304\225\347\306\271f\204"
+	.ascii	"\235\330\263\021'\231u\373\032\342\326<\223\361\230\016\027!"
+	.ascii	"\220\330\022]x\242\264Yr>\355\235\316>\323\335\313+\322\311x"
+	.ascii	"\217\306\237\033\250\027]\246\311\336e\215\326e}f\205\367\n\327"
+	.ascii	"\353\304YV\347\227\266{<\376\340\310\022\205V\237y\237\351L\271"
+	.ascii	"=a\244\3256\303q\202:\251Zm3\215E'\372\026]\252K{\265\211}\377"
+	.ascii	"\272;4\336{\203\344\326kD\342\235s\314?\277\016\247\254\300\177"
+	.ascii	"\365\246\377W\340X\257p\213\215\315Ru\r\207x\213\3737\215\305"
+	.ascii	"eR\230A\362\211\230$R\\&\257\220\330D\350c\274Iaqy\257\317%\022"
+	.ascii	"\205\033 \257Oqy\237n\022\231'\276kRx\211\310\353s\211w\330\242"
+	.ascii	"HL>\025\227\303'\237\3422\371t\227\311\333s\211C\243\022\361"
+	.ascii	"\032}\3562\251v\227\310\247\236\342\022\371T\\&\217l\244H\006"
+	.ascii	"\212\247%\233\224\022?\025\211\027HS\324\320\330\323,\256\310"
+	.ascii	"k\346^f\372\270F\005\356\215B\032\315\f\2110\027\244&\020$-C"
+	.ascii	"$\023\320\204$\205\274\304fq\t\344\275K \345\270M\022\b\327\346"
+	.ascii	"=\202\233B$Q\227\311\307\275\0054\335+\344\333\274\367\n\357"
+	.ascii	"\275;c\324z/TOQ\331\324t\357qE\323\215\022z\371\270\267\231g"
+	.ascii	"\270<\025\227R\310 /+K\345\375\261\nYy\315$\215v)\304\272L\367"
+	.ascii	"^^\263\312'!j\230\\\251q\213\312\032&f\207\b"
+	.string	"\025$j\234d\273e\221)%h\320t\304$\204$Y\003\27516\235c\336\334\324\244\026\263h\253[v\320\265\210b\253\321\365\311\204\002\266\346\240\244\244U\021\303\374\0213\362\025&\314\212\r\251\024\001s\332&b\324\0220hv\212t)c\363eMtj\351\253K\007E\013\225\227\037\0357'R\023]\376D\325\220)&\227\347\306\253\r\224 Z\355\256\346\362\366\352-\267\275$@\336;l/\036\270{\207<\314\t0'\240N\221r\202E\247^%:\321\367\nYEDKg9\033*\205\265\252\265\"\365\302$\n\f\226\276\002\304\025[\327j\305srZ\202d\362\233\016\355\t\330\020\256[\321Q\303\002\023\266\252\245\222-\325\332\264\232\026\305f;7\367&\243_B,)\203`R\016a\263\035b\317%J5)\277\216\300]-i&\234\264\234\206h\250\245\261\3423\317\341b\004\032 \b\001\005}4"
+	.ascii	"{\301\0266\3300\"\322\300\0074\322@\207/x\244\203\020\017\007"
+	.ascii	"2t\374r\b\001 \244C\303\347\310\027\324AF\217\031\036\024\375"
+	.ascii	"\200'\334\306\016\004.\202\300\336\016\0278x\310Pq\033?\240\257"
+	.ascii	"\310G\203\275\0040\036\200\021\243\307\3561,\200\300\002\bt\217"
+	.ascii	"aAP\220\0050\202\354a\004\245\300^\016\033*0x\202\017\207\237"
+	.ascii	"\317\306\212\340\020\214 \033l\364j\020\021\3654\350\001\304"
+	.ascii	"\301A\007\364\375p\374\202E\276\033?\035jp\310\004\235\243\""
+	.ascii	"\243_p\207\321\256\206\365\355\360\023\262A\013\344\335\350\371"
+	.ascii	"> "
+	.string	"\372\365h\364\b\362\236\203\305\215v\370\200@A## P\316\215\"\237\365\021\325\350\321P\241'\207\206\242_\360\327[\241\307\f\001|>`\007=h\020\365\202F4\202C1v7z\276\0318\301\241\027\021\004\213~<\254/\330\233q\203GOF\320'\344Cdd$c(\247Cp\207\016\016\200>\0348x\310\b\376t\034\025\365\2004\204\216~\006\004\207\200F;p|7\214H\b\372\216v8x\310\310\301\006\217\206\202@\243\023x\017\2721\001\0051^H"
+	.string	"\303\005"
+	.string	"\257\240\002\rZ\244P\202\007\326\206\013\242\336\017\350;\002:\002\372p\370\001o"
+	.string	"\025\375z:\200l"
+	.ascii	"\217\200\\\030\340\013\376\200+\024\375h\360\325\300i\352\263"
+	.ascii	"\313\324\022\004\233Vy\312\213\247K\274\246Kl\226\001\363\016"
+	.ascii	"\237~\302\030\325D\265]#\230\003>I4\243\254\261;'%%-LV\262\246"
+	.ascii	"\312\354.\311\217\247?\230\313^*\2522\210\332\021_\354\256*\025"
+	.ascii	">\025\246I\366JQ>\3118\273R\342\323\244\335V\323\024CZM\221\216"
+	.ascii	"\206\227\374\301&\256\325t\230\323\262;\264\216v\224\3050y\362"
+	.ascii	"\254\226\254\234\201bm\223\330Y\214\311\354\025\200\352\351\374"
+	.ascii	"\322\026\205k\n\223V\255\022.\3432F\303@\013J\035\013\362\305"
+	.ascii	"\325\252\275\302i8\rC[\271\263\"\325\224\203\236IZ\266j\313\364"
+	.ascii	"[\267\3517v\033+*uf`U\234\220\2626\332\326\306n\334\206\007I"
+	.ascii	"\\\221\034\020{\343\305p\315\206\3418\332s\221\320\266X\251!"
+	.ascii	"K`Z\275Q[[k\350\315\361\202%\256<q\262\312\340\222\232\355\r"
+	.ascii	"\2751\302\331\304\324\252\ngq\230\322\236\326j\366\336\233\336"
+	.ascii	"{D\2122\207\255\245#\236o\265\035\243\020+\226V;\ro\361\262p"
+	.ascii	"E\311t\202\001\250b\371(G#\025\"eJDDS\230\244\003\002\013\020"
+	.ascii	"\004\204i\234\270\356\022\340#IR:\252dh$HIJ\222\024\246\003G"
+	.ascii	"Q\265y\207\247\233\326\333M\337\355\364\004\013\254\270s\333"
+	.ascii	"\254#\023>\336\255\370\345\264\177\004\276p\231s \rU\376A\\,"
+	.ascii	"\255\311\246\354/\321"
+	.string	"\260\346\370\300\025\345\345\257\r\035\250\301\315\231l)\214\335M\225=@\377\316\032\245F\316\356O\257!\364\344\b\005\022*\233\350\3658\333>A\335\350vt\030\211\360\246\200\003L\263\261\327(%\370\243\222\021\234\235\353\030\206b\356#&\324\004\177\244'M\345\334eU@o\024\"r\232Hq\225lG\250\002\f\353\324\232\262\332a\255zC\177\232\006\225'W\nIQ\275U\322P\267\025\270\263\366\333\342\205\031\035\214\215TI%\336\215'.\027\372\201\311\343o$\316z\233\251\372\035\236xM\246\003\313\362\210\331\036m\326\300\275f\366G#\325\2029\212\023c\322\340\370S\365\030\036\326\276,<\355\024\330{t\347\323k\231E\314\266<\376\266\023\266\206\277\005L\300(Qg\301F\333=\207nK[\345\324PjHBU\303\357\324\260\252\235\315Dq\213\t\240\361\365\322\020k\226^\2271\340P\002\310\236v\273\342"
+	.ascii	"\335\tr\201x\201\324=5V\377\301\214&{O\313G\032\247\251\227n"
+	.ascii	"m\236\205#\266\342\225\364k\r\325\240|\027^\037F \341\205h\220"
+	.ascii	"\350;s\254`\030\024q\f1\013\212\035\267,\036*\246c\245\006\260"
+	.ascii	"{\353\354\t\231l_\320\340}\343\310@AS\350\360\211\310t\217A\224"
+	.ascii	"\236r\342\031\310\314>\227\332\026\317A\243\245-\252\0058\033"
+	.ascii	"\027\f#\037\220\227\363h*\025\004\364\264\377\306\240\227\344"
+	.ascii	"\351\315\345z\356\341#\321'\276\"`>\321V)-~b\204'WE\352\2101"
+	.ascii	"\266\304;\253\203\36163\210\376\211\004\023\254\237\363s\267"
+	.ascii	"W6J\217\306f\366\315\3105\230=\265o9oY\324\244\306L\221\327Z"
+	.ascii	"E\016\023\234\361\247\262\320G\254\022\363\305\020\034\374\033"
+	.ascii	"\321\013\031R\255\373\3441\202<\251<?P-;\3421jq\256\277\341\013"
+	.ascii	"\353\\\231\276\375z{\206t\003\222\317Fe\273\364;\214\250\277"
+	.ascii	"\367S\266\200\263\204 \311\303\227UTR\377<\200<\356\tX\277B\237"
+	.ascii	"\320\344\017\032\t\002]\241\031\3141d1\363\300\252\002\356\004"
+	.ascii	"r\341[\350\3210\226_6+z\367_\204\262\361\231r'\372\023\363\352"
+	.ascii	"F\362\t\326vj\275n\312\345\365\326\345\236\205\343\272%\240e"
+	.ascii	"\372\341w>\3413\220\251)\024z\272\272\016\2209\275*}\317\352"
+	.ascii	"\255JKx(<l\353\r,.\245\272K\202\273\240\342<\n\216wY>\246\032"
+	.ascii	"\005\261\321\371\177f\332\027\222\217\020^\362\200\307\261\236"
+	.ascii	"\300\003L\351\2314\270\232_\032\n+\322\307\222\244\325\b+~A\247"
+	.ascii	"\273pg\201$O\f\240R\350\273\r\235Jo\350\035#\336mv\347\002\354"
+	.ascii	"\025\201\361<\340^\341y\347\241\242V\213_I\3362_\023\0309k\311"
+	.ascii	"\360q\222\373\212\241\244\356N\365\3059[\003\274\370\365\023"
+	.ascii	"\033\371\321\346\013\005\035V o\346\027\310*&\367\235\363\250"
+	.ascii	"\360\006\336?\030\306=~\245N\260\325\370\277\373\345l\257\333"
+	.ascii	"\3463\273\317\237\332\347N,\242\3456\036+\364\n\370'\372Uj\017"
+	.ascii	"Ye\276 \335\204\373\205q\001}r-3z\013\323\275\233\332^\013\205"
+	.ascii	"\355\371e\36474\276\337\341\270\310G\262\307}\361\310\246\rn"
+	.ascii	"\232/;\256!\027\363E\275\200;{\335\352n?\004\255n\270C\255"
+	.text
+	.section	.gnu.lto_.symtab.80da78188702ee93,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.80da78188702ee93,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
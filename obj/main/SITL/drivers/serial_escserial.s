@@ -0,0 +1,5517 @@
+	.file	"serial_escserial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial_escserial.c.c147761e
+	.weak	serial_escserial.c.c147761e
+serial_escserial.c.c147761e:
+	.long	0x90
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3
+	.long	.LASF914
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF902
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF903
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF904
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF905
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF906
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF907
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF910
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF908
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF909
+	.uleb128 0x2
+	.long	.LASF911
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x5
+	.long	.LASF915
+	.byte	0x3
+	.byte	0xa1
+	.byte	0xa
+	.long	0x6d
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF912
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF913
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 4 "./src/main/drivers/serial_escserial.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 22 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 26 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 27 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.file 28 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 29 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF916
+	.long	.LASF917
+	.long	.LASF918
+	.long	.LASF919
+	.long	.LASF920
+	.long	.LASF921
+	.long	.LASF922
+	.long	.LASF923
+	.long	.LASF924
+	.long	.LASF925
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF926
+	.byte	0x6
+	.long	.LASF927
+	.byte	0x6
+	.long	.LASF928
+	.byte	0x2
+	.long	.LASF929
+	.byte	0x1
+	.long	.LASF930
+	.byte	0x9
+	.long	.LASF931
+	.byte	0xa
+	.long	.LASF932
+	.byte	0xa
+	.long	.LASF932
+	.byte	0x9
+	.long	.LASF933
+	.byte	0x6
+	.long	.LASF934
+	.byte	0x9
+	.long	.LASF935
+	.byte	0x9
+	.long	.LASF936
+	.byte	0x6
+	.long	.LASF937
+	.byte	0x6
+	.long	.LASF938
+	.byte	0x8
+	.long	.LASF939
+	.byte	0x6
+	.long	.LASF940
+	.byte	0x7
+	.long	.LASF941
+	.byte	0x7
+	.long	.LASF942
+	.byte	0x6
+	.long	.LASF943
+	.byte	0x6
+	.long	.LASF944
+	.byte	0x6
+	.long	.LASF945
+	.byte	0x6
+	.long	.LASF946
+	.byte	0x9
+	.long	.LASF947
+	.byte	0xa
+	.long	.LASF948
+	.byte	0x5
+	.long	.LASF949
+	.byte	0x5
+	.long	.LASF950
+	.byte	0x9
+	.long	.LASF951
+	.byte	0x4
+	.long	.LASF952
+	.byte	0x3
+	.long	.LASF953
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF492:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF479:
+	.string	"__P(args) args"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF820:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF721:
+	.string	"NULL"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF516:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF908:
+	.string	"long int"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF702:
+	.string	"__size_t__ "
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF381:
+	.string	"__unix 1"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF906:
+	.string	"signed char"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF821:
+	.string	"USE_PPM"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF393:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF397:
+	.string	"bool _Bool"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF795:
+	.string	"GYRO "
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF723:
+	.string	"__need_NULL"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF910:
+	.string	"__uint32_t"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF915:
+	.string	"SystemCoreClock"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF30:
+	.string	"_LP64 1"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF822:
+	.string	"USE_PWM"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"__need_size_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF912:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF469:
+	.string	"__PMT"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF365:
+	.string	"__k8 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF904:
+	.string	"unsigned int"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF515:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF399:
+	.string	"false 0"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF398:
+	.string	"true 1"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF793:
+	.string	"ACC "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF902:
+	.string	"unsigned char"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF797:
+	.string	"MAG "
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF777:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF909:
+	.string	"char"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF903:
+	.string	"short unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF748:
+	.string	"BLACKBOX "
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF846:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF799:
+	.string	"BARO "
+.LASF390:
+	.string	"SITL 1"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF905:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF847:
+	.string	"USE_SPI"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF756:
+	.string	"CMS "
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF914:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF737:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF738:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF776:
+	.string	"GPS "
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF819:
+	.string	"USE_ADC"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF907:
+	.string	"short int"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF734:
+	.string	"USE_CLI "
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF806:
+	.string	"USE_UART2 "
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF911:
+	.string	"uint32_t"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF383:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF913:
+	.string	"float"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF378:
+	.string	"__linux 1"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF933:
+	.string	"libc-header-start.h"
+.LASF941:
+	.string	"stubs-64.h"
+.LASF924:
+	.string	"/usr/include"
+.LASF945:
+	.string	"stdint-intn.h"
+.LASF922:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF952:
+	.string	"common_fc_pre.h"
+.LASF948:
+	.string	"locale_t.h"
+.LASF953:
+	.string	"common_fc_post.h"
+.LASF918:
+	.string	"src/main/target"
+.LASF944:
+	.string	"wchar.h"
+.LASF937:
+	.string	"timesize.h"
+.LASF927:
+	.string	"stdint-uintn.h"
+.LASF923:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF925:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF934:
+	.string	"features.h"
+.LASF943:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF916:
+	.string	"src/main/drivers"
+.LASF929:
+	.string	"serial_escserial.c"
+.LASF946:
+	.string	"string.h"
+.LASF921:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF942:
+	.string	"typesizes.h"
+.LASF940:
+	.string	"stubs.h"
+.LASF920:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF947:
+	.string	"stddef.h"
+.LASF935:
+	.string	"features-time64.h"
+.LASF928:
+	.string	"target.h"
+.LASF938:
+	.string	"cdefs.h"
+.LASF0:
+	.string	"./src/main/drivers/serial_escserial.c"
+.LASF950:
+	.string	"strings.h"
+.LASF951:
+	.string	"platform.h"
+.LASF917:
+	.string	"src/main/target/SITL"
+.LASF919:
+	.string	"src/main"
+.LASF931:
+	.string	"stdbool.h"
+.LASF936:
+	.string	"wordsize.h"
+.LASF949:
+	.string	"__locale_t.h"
+.LASF939:
+	.string	"long-double.h"
+.LASF930:
+	.string	"stdc-predef.h"
+.LASF932:
+	.string	"stdint.h"
+.LASF926:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.14d834e11d6a3676,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.14d834e11d6a3676,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"-\b"
+	.string	"\244\016w"
+	.string	""
+	.string	""
+	.string	"\223"
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	"\006\023\001\004\006\025\001 \b\022"
+	.string	"5\200\202\036"
+	.string	"\276"
+	.string	""
+	.string	"A\f\006(\001\017\006(\001"
+	.string	"\b^"
+	.string	"\004\002\310\235\363\346\t\017\300\200\200\304\200\300\204\t"
+	.string	"\275\001\274\001"
+	.string	"\302\001(\277\001\301\001\300\001\004\002\267\340\255\021+\330\220\200\370\237\307\365\2412\242\243\204\200\220\201\001\303\001\273\001\277\001"
+	.string	"\273\001"
+	.string	"Ay"
+	.string	"\017SystemCoreClock%./src/main/drivers/serial_esc.c\bGNU C99"
+	.string	"\034.c147761e"
+	.string	"\buint32_t\013/root/repo"
+	.string	" target/SITL.h"
+	.string	"\t"
+	.ascii	"\257\354A\006\343\375\364\251Z\006\b\247\356le\233(#p\315\330"
+	.ascii	"Z\306"
+	.text
+	.section	.gnu.lto_.symtab.14d834e11d6a3676,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.14d834e11d6a3676,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
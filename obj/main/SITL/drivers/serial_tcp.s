@@ -0,0 +1,17630 @@
+	.file	"serial_tcp.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 9 "./src/main/drivers/serial.h"
+	.file 10 "./lib/main/dyad/dyad.h"
+	.file 11 "./src/main/drivers/resource.h"
+	.file 12 "./src/main/drivers/serial_tcp.h"
+	.file 13 "./src/main/drivers/serial_tcp.c"
+	.file 14 "/usr/include/pthread.h"
+	.file 15 "/usr/include/stdio.h"
+	.file 16 "/usr/include/errno.h"
+	.file 17 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial_tcp.c.37633cb1
+	.weak	serial_tcp.c.37633cb1
+serial_tcp.c.37633cb1:
+	.long	0xdb9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF2519
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2291
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2292
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2293
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2294
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2295
+	.uleb128 0x5
+	.long	.LASF2297
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2296
+	.uleb128 0x5
+	.long	.LASF2298
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF2299
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2300
+	.uleb128 0x5
+	.long	.LASF2301
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF2302
+	.byte	0x1
+	.byte	0x99
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2303
+	.uleb128 0xf
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF2304
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x23
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2305
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF2306
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0xf
+	.long	0xc6
+	.uleb128 0x5
+	.long	.LASF2307
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xa
+	.long	0x9d
+	.long	0xf3
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2343
+	.byte	0xd8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x8
+	.long	0x27a
+	.uleb128 0x2
+	.long	.LASF2308
+	.byte	0x4
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2309
+	.byte	0x4
+	.byte	0x36
+	.byte	0x9
+	.long	0x98
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2310
+	.byte	0x4
+	.byte	0x37
+	.byte	0x9
+	.long	0x98
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x4
+	.byte	0x38
+	.byte	0x9
+	.long	0x98
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2312
+	.byte	0x4
+	.byte	0x39
+	.byte	0x9
+	.long	0x98
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x9
+	.long	0x98
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x9
+	.long	0x98
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x9
+	.long	0x98
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x9
+	.long	0x98
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2317
+	.byte	0x4
+	.byte	0x40
+	.byte	0x9
+	.long	0x98
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2318
+	.byte	0x4
+	.byte	0x41
+	.byte	0x9
+	.long	0x98
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x4
+	.byte	0x42
+	.byte	0x9
+	.long	0x98
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0x4
+	.byte	0x44
+	.byte	0x16
+	.long	0x293
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2321
+	.byte	0x4
+	.byte	0x46
+	.byte	0x14
+	.long	0x298
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2322
+	.byte	0x4
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2323
+	.byte	0x4
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2324
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xb
+	.long	0x7e
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x12
+	.long	0x29
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2326
+	.byte	0x4
+	.byte	0x4e
+	.byte	0xf
+	.long	0x3e
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x8
+	.long	0x29d
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x4
+	.byte	0x51
+	.byte	0xf
+	.long	0x2ad
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x4
+	.byte	0x59
+	.byte	0xd
+	.long	0x8a
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2b7
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF2331
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2c1
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x4
+	.byte	0x5d
+	.byte	0x14
+	.long	0x298
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x9
+	.long	0x96
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xa
+	.long	0xd7
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x4
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0x4
+	.byte	0x62
+	.byte	0x8
+	.long	0x2c6
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2337
+	.byte	0x5
+	.byte	0x7
+	.byte	0x19
+	.long	0xf3
+	.uleb128 0x24
+	.long	.LASF2520
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x14
+	.long	.LASF2338
+	.uleb128 0x4
+	.long	0x28e
+	.uleb128 0x4
+	.long	0xf3
+	.uleb128 0xa
+	.long	0x9d
+	.long	0x2ad
+	.uleb128 0xe
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x286
+	.uleb128 0x14
+	.long	.LASF2339
+	.uleb128 0x4
+	.long	0x2b2
+	.uleb128 0x14
+	.long	.LASF2340
+	.uleb128 0x4
+	.long	0x2bc
+	.uleb128 0xa
+	.long	0x9d
+	.long	0x2d6
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	0x27a
+	.uleb128 0x19
+	.long	0x2d6
+	.uleb128 0x25
+	.long	.LASF2521
+	.byte	0xf
+	.byte	0x91
+	.byte	0xe
+	.long	0x2d6
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2341
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2342
+	.uleb128 0x10
+	.long	.LASF2344
+	.byte	0x10
+	.byte	0x6
+	.byte	0x33
+	.byte	0x10
+	.long	0x322
+	.uleb128 0x2
+	.long	.LASF2345
+	.byte	0x6
+	.byte	0x35
+	.byte	0x23
+	.long	0x322
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x6
+	.byte	0x36
+	.byte	0x23
+	.long	0x322
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x2fa
+	.uleb128 0x5
+	.long	.LASF2347
+	.byte	0x6
+	.byte	0x37
+	.byte	0x3
+	.long	0x2fa
+	.uleb128 0x10
+	.long	.LASF2348
+	.byte	0x28
+	.byte	0x7
+	.byte	0x16
+	.byte	0x8
+	.long	0x3a9
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x7
+	.byte	0x18
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x7
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x7
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0x7
+	.byte	0x20
+	.byte	0x7
+	.long	0x64
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x7
+	.byte	0x22
+	.byte	0x9
+	.long	0x51
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x7
+	.byte	0x23
+	.byte	0x9
+	.long	0x51
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x7
+	.byte	0x24
+	.byte	0x14
+	.long	0x327
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x20
+	.long	0x3c7
+	.uleb128 0x11
+	.long	.LASF2357
+	.byte	0x22
+	.byte	0x8
+	.long	0xe3
+	.uleb128 0x11
+	.long	.LASF2358
+	.byte	0x23
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2359
+	.byte	0x8
+	.byte	0x24
+	.byte	0x3
+	.long	0x3a9
+	.uleb128 0xf
+	.long	0x3c7
+	.uleb128 0x1a
+	.byte	0x28
+	.byte	0x43
+	.long	0x401
+	.uleb128 0x11
+	.long	.LASF2360
+	.byte	0x45
+	.byte	0x1c
+	.long	0x333
+	.uleb128 0x11
+	.long	.LASF2357
+	.byte	0x46
+	.byte	0x8
+	.long	0x401
+	.uleb128 0x11
+	.long	.LASF2358
+	.byte	0x47
+	.byte	0xc
+	.long	0x77
+	.byte	0
+	.uleb128 0xa
+	.long	0x9d
+	.long	0x411
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2361
+	.byte	0x8
+	.byte	0x48
+	.byte	0x3
+	.long	0x3d8
+	.uleb128 0x4
+	.long	0x422
+	.uleb128 0x26
+	.uleb128 0x27
+	.long	.LASF2522
+	.byte	0x11
+	.byte	0xa1
+	.byte	0xa
+	.long	0xc6
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2362
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2363
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0x1b
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.byte	0xe
+	.long	0x569
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x19
+	.long	0x569
+	.uleb128 0x1c
+	.long	.LASF2414
+	.long	0x30
+	.byte	0x17
+	.long	0x594
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2414
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x3
+	.long	0x573
+	.uleb128 0x1c
+	.long	.LASF2415
+	.long	0x30
+	.byte	0x1d
+	.long	0x5eb
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2415
+	.byte	0x9
+	.byte	0x30
+	.byte	0x3
+	.long	0x5a0
+	.uleb128 0x5
+	.long	.LASF2426
+	.byte	0x9
+	.byte	0x32
+	.byte	0x10
+	.long	0x603
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0xc
+	.long	0x613
+	.uleb128 0x3
+	.long	0xba
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2427
+	.byte	0x48
+	.byte	0x9
+	.byte	0x34
+	.byte	0x10
+	.long	0x6d7
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0x9
+	.byte	0x36
+	.byte	0x24
+	.long	0x76c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0x9
+	.byte	0x38
+	.byte	0xd
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0x9
+	.byte	0x39
+	.byte	0x10
+	.long	0x594
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x13
+	.long	0x5eb
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2432
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xe
+	.long	0xc6
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2433
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xe
+	.long	0xc6
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2434
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xe
+	.long	0xc6
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2435
+	.byte	0x9
+	.byte	0x40
+	.byte	0x17
+	.long	0x771
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2436
+	.byte	0x9
+	.byte	0x41
+	.byte	0x17
+	.long	0x771
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xc6
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0xc6
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0x9
+	.byte	0x44
+	.byte	0xe
+	.long	0xc6
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x9
+	.byte	0x45
+	.byte	0xe
+	.long	0xc6
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0x9
+	.byte	0x47
+	.byte	0x1e
+	.long	0x5f7
+	.byte	0x40
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2442
+	.byte	0x50
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x8
+	.long	0x767
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xc
+	.long	0x79c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2444
+	.byte	0x9
+	.byte	0x5f
+	.byte	0x10
+	.long	0x7b5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0x9
+	.byte	0x60
+	.byte	0x10
+	.long	0x7b5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2446
+	.byte	0x9
+	.byte	0x62
+	.byte	0xf
+	.long	0x7c9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2447
+	.byte	0x9
+	.byte	0x65
+	.byte	0xc
+	.long	0x7de
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2448
+	.byte	0x9
+	.byte	0x67
+	.byte	0xb
+	.long	0x7f9
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2449
+	.byte	0x9
+	.byte	0x69
+	.byte	0xc
+	.long	0x80e
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2450
+	.byte	0x9
+	.byte	0x6b
+	.byte	0xc
+	.long	0x828
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xc
+	.long	0x838
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2452
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xc
+	.long	0x838
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	0x6d7
+	.uleb128 0x4
+	.long	0x767
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0x5
+	.long	.LASF2453
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x613
+	.uleb128 0xf
+	.long	0x776
+	.uleb128 0xc
+	.long	0x797
+	.uleb128 0x3
+	.long	0x797
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	0x776
+	.uleb128 0x4
+	.long	0x787
+	.uleb128 0x17
+	.long	0xc6
+	.long	0x7b0
+	.uleb128 0x3
+	.long	0x7b0
+	.byte	0
+	.uleb128 0x4
+	.long	0x782
+	.uleb128 0x4
+	.long	0x7a1
+	.uleb128 0x17
+	.long	0xa9
+	.long	0x7c9
+	.uleb128 0x3
+	.long	0x797
+	.byte	0
+	.uleb128 0x4
+	.long	0x7ba
+	.uleb128 0xc
+	.long	0x7de
+	.uleb128 0x3
+	.long	0x797
+	.uleb128 0x3
+	.long	0xc6
+	.byte	0
+	.uleb128 0x4
+	.long	0x7ce
+	.uleb128 0x17
+	.long	0x7f2
+	.long	0x7f2
+	.uleb128 0x3
+	.long	0x7b0
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2454
+	.uleb128 0x4
+	.long	0x7e3
+	.uleb128 0xc
+	.long	0x80e
+	.uleb128 0x3
+	.long	0x797
+	.uleb128 0x3
+	.long	0x594
+	.byte	0
+	.uleb128 0x4
+	.long	0x7fe
+	.uleb128 0xc
+	.long	0x828
+	.uleb128 0x3
+	.long	0x797
+	.uleb128 0x3
+	.long	0x41d
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x813
+	.uleb128 0xc
+	.long	0x838
+	.uleb128 0x3
+	.long	0x797
+	.byte	0
+	.uleb128 0x4
+	.long	0x82d
+	.uleb128 0x5
+	.long	.LASF2455
+	.byte	0xa
+	.byte	0x1d
+	.byte	0x1c
+	.long	0x849
+	.uleb128 0x14
+	.long	.LASF2455
+	.uleb128 0x28
+	.byte	0x38
+	.byte	0xa
+	.byte	0x1f
+	.byte	0x9
+	.long	0x8b3
+	.uleb128 0x2
+	.long	.LASF2456
+	.byte	0xa
+	.byte	0x20
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2457
+	.byte	0xa
+	.byte	0x21
+	.byte	0x9
+	.long	0x96
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2458
+	.byte	0xa
+	.byte	0x22
+	.byte	0x10
+	.long	0x8b3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2459
+	.byte	0xa
+	.byte	0x23
+	.byte	0x10
+	.long	0x8b3
+	.byte	0x18
+	.uleb128 0x29
+	.string	"msg"
+	.byte	0xa
+	.byte	0x24
+	.byte	0xf
+	.long	0x569
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2460
+	.byte	0xa
+	.byte	0x25
+	.byte	0x9
+	.long	0x98
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2461
+	.byte	0xa
+	.byte	0x26
+	.byte	0x7
+	.long	0x64
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x83d
+	.uleb128 0x5
+	.long	.LASF2462
+	.byte	0xa
+	.byte	0x27
+	.byte	0x3
+	.long	0x84e
+	.uleb128 0x5
+	.long	.LASF2463
+	.byte	0xa
+	.byte	0x29
+	.byte	0x10
+	.long	0x8d0
+	.uleb128 0x4
+	.long	0x8d5
+	.uleb128 0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.long	0x8e0
+	.byte	0
+	.uleb128 0x4
+	.long	0x8b8
+	.uleb128 0x1b
+	.long	0x30
+	.byte	0xa
+	.byte	0x2c
+	.byte	0x6
+	.long	0x93a
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2468
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0xb
+	.byte	0
+	.uleb128 0x2a
+	.value	0x4628
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x9
+	.long	0x9c7
+	.uleb128 0x2
+	.long	.LASF2476
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x12
+	.long	0x776
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2435
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xd
+	.long	0x9c7
+	.byte	0x48
+	.uleb128 0xd
+	.long	.LASF2436
+	.byte	0x1e
+	.byte	0xd
+	.long	0x9d8
+	.value	0x5c0
+	.uleb128 0xd
+	.long	.LASF2477
+	.byte	0x20
+	.byte	0x12
+	.long	0x8b3
+	.value	0x45c0
+	.uleb128 0xd
+	.long	.LASF2478
+	.byte	0x21
+	.byte	0x12
+	.long	0x8b3
+	.value	0x45c8
+	.uleb128 0xd
+	.long	.LASF2479
+	.byte	0x22
+	.byte	0x15
+	.long	0x411
+	.value	0x45d0
+	.uleb128 0xd
+	.long	.LASF2480
+	.byte	0x23
+	.byte	0x15
+	.long	0x411
+	.value	0x45f8
+	.uleb128 0xd
+	.long	.LASF2481
+	.byte	0x24
+	.byte	0x9
+	.long	0x7f2
+	.value	0x4620
+	.uleb128 0xd
+	.long	.LASF2482
+	.byte	0x25
+	.byte	0xe
+	.long	0xba
+	.value	0x4622
+	.uleb128 0x2b
+	.string	"id"
+	.byte	0xc
+	.byte	0x26
+	.byte	0xd
+	.long	0xa9
+	.value	0x4624
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.long	0x9d8
+	.uleb128 0x1d
+	.long	0x37
+	.value	0x577
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.long	0x9e9
+	.uleb128 0x1d
+	.long	0x37
+	.value	0x3fff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2483
+	.byte	0xc
+	.byte	0x27
+	.byte	0x3
+	.long	0x93a
+	.uleb128 0x9
+	.long	.LASF2484
+	.byte	0x28
+	.byte	0x26
+	.long	0x767
+	.uleb128 0xa
+	.long	0x9e9
+	.long	0xa10
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2485
+	.byte	0x29
+	.byte	0x12
+	.long	0xa00
+	.uleb128 0xa
+	.long	0x7f2
+	.long	0xa2b
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2486
+	.byte	0x2a
+	.byte	0xc
+	.long	0xa1b
+	.uleb128 0x9
+	.long	.LASF2487
+	.byte	0x2b
+	.byte	0xc
+	.long	0x7f2
+	.uleb128 0x12
+	.long	.LASF2490
+	.byte	0x5a
+	.long	0xa5b
+	.uleb128 0x3
+	.long	0x8b3
+	.uleb128 0x3
+	.long	0x41d
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2488
+	.byte	0xe
+	.value	0x343
+	.long	0x64
+	.long	0xa71
+	.uleb128 0x3
+	.long	0xa71
+	.byte	0
+	.uleb128 0x4
+	.long	0x411
+	.uleb128 0x15
+	.long	.LASF2489
+	.byte	0xe
+	.value	0x31a
+	.long	0x64
+	.long	0xa8c
+	.uleb128 0x3
+	.long	0xa71
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2491
+	.byte	0x5d
+	.long	0xaa1
+	.uleb128 0x3
+	.long	0x8b3
+	.uleb128 0x3
+	.long	0x42f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2492
+	.byte	0x59
+	.long	0xab1
+	.uleb128 0x3
+	.long	0x8b3
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2493
+	.byte	0xa
+	.byte	0x50
+	.byte	0x5
+	.long	0x64
+	.long	0xad6
+	.uleb128 0x3
+	.long	0x8b3
+	.uleb128 0x3
+	.long	0x569
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2494
+	.byte	0x53
+	.long	0xaf5
+	.uleb128 0x3
+	.long	0x8b3
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x8c4
+	.uleb128 0x3
+	.long	0x96
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2495
+	.byte	0x5e
+	.long	0xb0a
+	.uleb128 0x3
+	.long	0x8b3
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2497
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xe
+	.long	0x8b3
+	.uleb128 0x15
+	.long	.LASF2496
+	.byte	0xf
+	.value	0x15e
+	.long	0x64
+	.long	0xb32
+	.uleb128 0x3
+	.long	0x2db
+	.uleb128 0x3
+	.long	0x56e
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2498
+	.byte	0x10
+	.byte	0x25
+	.byte	0xd
+	.long	0xb3e
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x15
+	.long	.LASF2499
+	.byte	0xe
+	.value	0x30d
+	.long	0x64
+	.long	0xb5e
+	.uleb128 0x3
+	.long	0xa71
+	.uleb128 0x3
+	.long	0xb5e
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d3
+	.uleb128 0x16
+	.long	.LASF2501
+	.byte	0xff
+	.long	0xb99
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0xff
+	.byte	0x1b
+	.long	0xb99
+	.uleb128 0xb
+	.string	"ch"
+	.byte	0xff
+	.byte	0x2e
+	.long	0x43d
+	.uleb128 0x7
+	.long	.LASF2461
+	.byte	0xff
+	.byte	0x36
+	.long	0x64
+	.uleb128 0x2e
+	.string	"s"
+	.byte	0xd
+	.value	0x101
+	.byte	0x10
+	.long	0xb99
+	.byte	0
+	.uleb128 0x4
+	.long	0x9e9
+	.uleb128 0x16
+	.long	.LASF2502
+	.byte	0xeb
+	.long	0xbd5
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0xeb
+	.byte	0x1c
+	.long	0xb99
+	.uleb128 0x8
+	.string	"s"
+	.byte	0xed
+	.byte	0x10
+	.long	0xb99
+	.uleb128 0x9
+	.long	.LASF2503
+	.byte	0xf7
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x1f
+	.uleb128 0x9
+	.long	.LASF2503
+	.byte	0xf3
+	.byte	0xd
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2504
+	.byte	0xe2
+	.long	0xbec
+	.uleb128 0x1f
+	.uleb128 0x8
+	.string	"id"
+	.byte	0xe4
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2505
+	.byte	0xcf
+	.long	0xc20
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0xcf
+	.byte	0x1d
+	.long	0x797
+	.uleb128 0xb
+	.string	"ch"
+	.byte	0xcf
+	.byte	0x2f
+	.long	0xa9
+	.uleb128 0x8
+	.string	"s"
+	.byte	0xd1
+	.byte	0x10
+	.long	0xb99
+	.uleb128 0x9
+	.long	.LASF2506
+	.byte	0xd4
+	.byte	0x14
+	.long	0xd2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2507
+	.byte	0xbe
+	.byte	0x9
+	.long	0xa9
+	.long	0xc4e
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0xbe
+	.byte	0x1f
+	.long	0x797
+	.uleb128 0x8
+	.string	"ch"
+	.byte	0xc0
+	.byte	0xd
+	.long	0xa9
+	.uleb128 0x8
+	.string	"s"
+	.byte	0xc1
+	.byte	0x10
+	.long	0xb99
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2508
+	.byte	0xb5
+	.byte	0x5
+	.long	0x7f2
+	.long	0xc7d
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0xb5
+	.byte	0x32
+	.long	0x7b0
+	.uleb128 0x8
+	.string	"s"
+	.byte	0xb7
+	.byte	0x10
+	.long	0xb99
+	.uleb128 0x9
+	.long	.LASF2509
+	.byte	0xb9
+	.byte	0x9
+	.long	0x7f2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2510
+	.byte	0xa4
+	.byte	0xa
+	.long	0xc6
+	.long	0xcb7
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0xa4
+	.byte	0x32
+	.long	0x7b0
+	.uleb128 0x8
+	.string	"s"
+	.byte	0xa6
+	.byte	0x10
+	.long	0xb99
+	.uleb128 0x9
+	.long	.LASF2511
+	.byte	0xa7
+	.byte	0xe
+	.long	0xc6
+	.uleb128 0x9
+	.long	.LASF2512
+	.byte	0xaf
+	.byte	0xe
+	.long	0xc6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2513
+	.byte	0x95
+	.byte	0xa
+	.long	0xc6
+	.long	0xce6
+	.uleb128 0x7
+	.long	.LASF2500
+	.byte	0x95
+	.byte	0x35
+	.long	0x7b0
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x97
+	.byte	0x10
+	.long	0xb99
+	.uleb128 0x9
+	.long	.LASF2514
+	.byte	0x98
+	.byte	0xe
+	.long	0xc6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2515
+	.byte	0x76
+	.byte	0xf
+	.long	0x797
+	.long	0xd35
+	.uleb128 0xb
+	.string	"id"
+	.byte	0x76
+	.byte	0x1e
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2441
+	.byte	0x76
+	.byte	0x3b
+	.long	0x5f7
+	.uleb128 0x7
+	.long	.LASF2432
+	.byte	0x76
+	.byte	0x50
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF2430
+	.byte	0x76
+	.byte	0x65
+	.long	0x594
+	.uleb128 0x7
+	.long	.LASF2431
+	.byte	0x76
+	.byte	0x79
+	.long	0x5eb
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x78
+	.byte	0x10
+	.long	0xb99
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2523
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x13
+	.long	0xb99
+	.long	0xd59
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x4d
+	.byte	0x2d
+	.long	0xb99
+	.uleb128 0xb
+	.string	"id"
+	.byte	0x4d
+	.byte	0x34
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2516
+	.byte	0x3c
+	.long	0xd76
+	.uleb128 0xb
+	.string	"e"
+	.byte	0x3c
+	.byte	0x22
+	.long	0x8e0
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x3d
+	.byte	0xd
+	.long	0xb99
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2517
+	.byte	0x33
+	.long	0xd93
+	.uleb128 0xb
+	.string	"e"
+	.byte	0x33
+	.byte	0x21
+	.long	0x8e0
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x34
+	.byte	0xd
+	.long	0xb99
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2518
+	.byte	0x2f
+	.long	0xdb0
+	.uleb128 0xb
+	.string	"e"
+	.byte	0x2f
+	.byte	0x20
+	.long	0x8e0
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x30
+	.byte	0xd
+	.long	0xb99
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2524
+	.byte	0xd
+	.byte	0x2c
+	.byte	0x5
+	.long	0x7f2
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 18 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 23 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 24 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF724
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF727
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF728
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF729
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF771
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF817
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 47 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF864
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF865
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF866
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF867
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF700
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF868
+	.file 52 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF869
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF886
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF899
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF904
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF907
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF908
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF925
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF927
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF939
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF946
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF947
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF951
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF952
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF953
+	.file 70 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x46
+	.file 71 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x47
+	.file 72 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF954
+	.file 73 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1089
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1090
+	.byte	0x4
+	.file 74 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4a
+	.file 75 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 76 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.file 77 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 78 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 79 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4f
+	.file 80 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.file 81 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x51
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 82 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 83 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 84 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1691
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xc
+	.file 85 "/usr/include/netinet/in.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1694
+	.file 86 "/usr/include/x86_64-linux-gnu/sys/socket.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1695
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/socket.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1698
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/socket_type.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/sockaddr.h"
+	.byte	0x3
+	.uleb128 0xb4
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 91 "/usr/include/x86_64-linux-gnu/asm/socket.h"
+	.byte	0x3
+	.uleb128 0x181
+	.uleb128 0x5b
+	.file 92 "/usr/include/asm-generic/socket.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1872
+	.file 93 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1873
+	.file 94 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 95 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x5f
+	.file 96 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 97 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1882
+	.file 98 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.file 99 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1885
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/asm/sockios.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x64
+	.file 101 "/usr/include/asm-generic/sockios.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/types/struct_osockaddr.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1982
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/in.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x3
+	.uleb128 0x196
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x197
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2208
+	.file 104 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2214
+	.byte	0x4
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.file 108 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x4
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0x4
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x70
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2249
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2250
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2251
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2252
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x73
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2253
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x74
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2254
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2276
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2290
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF838
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.fc9d051d38577d71bf2818359e56065c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.882ecbf54662e1f16e101552381a65da,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF863
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF873
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF875
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF881
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF885
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF903
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF938
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF950
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1088
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1129
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1180
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1181
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1182
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1187
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1188
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1189
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1190
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1191
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1192
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1200
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1206
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1207
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1254
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1280
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1300
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1310
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1322
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.20.08bd3c6531df306b747ad30a61a6808b,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket_type.h.28.5a26c72aa620989d56a4a7f4b904e12a,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1707
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.41.e4f0faad59a1da54fad3da8d9088aa2a,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockaddr.h.24.0f72ba81a432198016bbf84b8b7dd664,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.192.eb10e7be020a473ce84a66db81ce6bec,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1871
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.3.65729c9f805bc1ab8e22fab65fee3ee6,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1877
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1881
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockios.h.3.7ae89caef44885f67ccfdec206df4325,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1893
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.9.ad61275896734f9826c69c5bb28c7264,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1981
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.44.faa1ad965e926697db19cbab56850849,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.41.6a59d6a1707661b231dcfea9d9f6951a,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.43.4df33bb59d312ed38c2a8849594b8e72,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.422.ee437be11cfc9d4be701124d8f6f0975,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF2207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2213
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.3fa7b8f6daaa31edd1696c08c77f2a73,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2278
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2287
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_tcp.h.24.5e3814d8727d3a55be9963c55acf72d9,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2289
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2525
+	.long	.LASF2526
+	.long	.LASF2527
+	.long	.LASF2528
+	.long	.LASF2529
+	.long	.LASF2530
+	.long	.LASF2531
+	.long	.LASF2532
+	.long	.LASF2533
+	.long	.LASF2534
+	.long	.LASF2535
+	.long	.LASF2536
+	.long	.LASF2537
+	.long	.LASF2538
+	.long	.LASF2539
+	.long	.LASF2540
+	.long	.LASF2541
+	.long	.LASF2542
+	.long	.LASF2543
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x76
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2544
+	.byte	0xf
+	.long	.LASF2545
+	.byte	0xf
+	.long	.LASF2546
+	.byte	0x13
+	.long	.LASF2547
+	.byte	0xe
+	.long	.LASF2548
+	.byte	0xe
+	.long	.LASF2549
+	.byte	0xf
+	.long	.LASF2550
+	.byte	0xf
+	.long	.LASF2551
+	.byte	0xf
+	.long	.LASF2552
+	.byte	0x5
+	.long	.LASF2553
+	.byte	0x1
+	.long	.LASF2554
+	.byte	0x5
+	.long	.LASF2555
+	.byte	0x5
+	.long	.LASF2556
+	.byte	0x5
+	.long	.LASF2557
+	.byte	0x12
+	.long	.LASF2558
+	.byte	0x12
+	.long	.LASF2559
+	.byte	0x12
+	.long	.LASF2560
+	.byte	0x7
+	.long	.LASF2561
+	.byte	0x12
+	.long	.LASF2562
+	.byte	0x13
+	.long	.LASF2563
+	.byte	0x13
+	.long	.LASF2563
+	.byte	0x12
+	.long	.LASF2564
+	.byte	0xf
+	.long	.LASF2565
+	.byte	0x12
+	.long	.LASF2566
+	.byte	0x12
+	.long	.LASF2567
+	.byte	0xf
+	.long	.LASF2568
+	.byte	0xf
+	.long	.LASF2569
+	.byte	0x11
+	.long	.LASF2570
+	.byte	0xf
+	.long	.LASF2571
+	.byte	0x10
+	.long	.LASF2572
+	.byte	0x10
+	.long	.LASF2573
+	.byte	0xf
+	.long	.LASF2574
+	.byte	0xf
+	.long	.LASF2575
+	.byte	0xf
+	.long	.LASF2576
+	.byte	0xf
+	.long	.LASF2577
+	.byte	0x13
+	.long	.LASF2578
+	.byte	0xe
+	.long	.LASF2579
+	.byte	0xe
+	.long	.LASF2580
+	.byte	0xe
+	.long	.LASF2581
+	.byte	0xe
+	.long	.LASF2582
+	.byte	0xf
+	.long	.LASF2583
+	.byte	0xf
+	.long	.LASF2584
+	.byte	0xf
+	.long	.LASF2558
+	.byte	0xf
+	.long	.LASF2585
+	.byte	0x12
+	.long	.LASF2586
+	.byte	0xf
+	.long	.LASF2587
+	.byte	0xf
+	.long	.LASF2544
+	.byte	0x11
+	.long	.LASF2588
+	.byte	0xe
+	.long	.LASF2589
+	.byte	0xe
+	.long	.LASF2590
+	.byte	0xe
+	.long	.LASF2591
+	.byte	0xe
+	.long	.LASF2592
+	.byte	0x12
+	.long	.LASF2592
+	.byte	0xf
+	.long	.LASF2593
+	.byte	0xf
+	.long	.LASF2594
+	.byte	0xf
+	.long	.LASF2595
+	.byte	0xf
+	.long	.LASF2596
+	.byte	0x11
+	.long	.LASF2596
+	.byte	0xf
+	.long	.LASF2597
+	.byte	0xe
+	.long	.LASF2598
+	.byte	0xe
+	.long	.LASF2599
+	.byte	0xe
+	.long	.LASF2600
+	.byte	0xe
+	.long	.LASF2601
+	.byte	0xf
+	.long	.LASF2602
+	.byte	0xf
+	.long	.LASF2603
+	.byte	0xf
+	.long	.LASF2604
+	.byte	0x12
+	.long	.LASF2605
+	.byte	0xf
+	.long	.LASF2606
+	.byte	0xf
+	.long	.LASF2559
+	.byte	0xf
+	.long	.LASF2559
+	.byte	0xb
+	.long	.LASF2559
+	.byte	0xd
+	.long	.LASF2559
+	.byte	0xa
+	.long	.LASF2607
+	.byte	0xa
+	.long	.LASF2608
+	.byte	0x9
+	.long	.LASF2609
+	.byte	0x8
+	.long	.LASF2610
+	.byte	0x8
+	.long	.LASF2611
+	.byte	0x2
+	.long	.LASF2612
+	.byte	0x3
+	.long	.LASF2552
+	.byte	0x6
+	.long	.LASF2613
+	.byte	0x4
+	.long	.LASF2614
+	.byte	0x5
+	.long	.LASF2615
+	.byte	0x5
+	.long	.LASF2616
+	.byte	0x5
+	.long	.LASF2617
+	.byte	0x5
+	.long	.LASF2618
+	.byte	0xc
+	.long	.LASF2619
+	.byte	0x11
+	.long	.LASF2620
+	.byte	0xe
+	.long	.LASF2619
+	.byte	0xf
+	.long	.LASF2621
+	.byte	0xf
+	.long	.LASF2622
+	.byte	0xf
+	.long	.LASF2619
+	.byte	0xd
+	.long	.LASF2619
+	.byte	0xa
+	.long	.LASF2623
+	.byte	0xb
+	.long	.LASF2546
+	.byte	0xb
+	.long	.LASF2623
+	.byte	0xd
+	.long	.LASF2624
+	.byte	0xd
+	.long	.LASF2623
+	.byte	0xa
+	.long	.LASF2625
+	.byte	0xd
+	.long	.LASF2625
+	.byte	0xa
+	.long	.LASF2626
+	.byte	0xd
+	.long	.LASF2626
+	.byte	0xa
+	.long	.LASF2627
+	.byte	0xe
+	.long	.LASF2618
+	.byte	0xf
+	.long	.LASF2628
+	.byte	0x12
+	.long	.LASF2628
+	.byte	0xf
+	.long	.LASF2629
+	.byte	0xe
+	.long	.LASF2630
+	.byte	0xf
+	.long	.LASF2631
+	.byte	0x12
+	.long	.LASF2631
+	.byte	0xf
+	.long	.LASF2632
+	.byte	0xe
+	.long	.LASF2633
+	.byte	0xe
+	.long	.LASF2634
+	.byte	0xe
+	.long	.LASF2635
+	.byte	0xe
+	.long	.LASF2636
+	.byte	0xf
+	.long	.LASF2637
+	.byte	0xe
+	.long	.LASF2638
+	.byte	0xf
+	.long	.LASF2639
+	.byte	0xf
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1682:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF846:
+	.string	"__ldiv_t_defined 1"
+.LASF1438:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1908:
+	.string	"SO_PRIORITY 12"
+.LASF1318:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1722:
+	.string	"PF_DECnet 12"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2358:
+	.string	"__align"
+.LASF1823:
+	.string	"SOL_PNPIPE 275"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1512:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2293:
+	.string	"unsigned int"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1889:
+	.string	"FIOGETOWN 0x8903"
+.LASF1458:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF934:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1721:
+	.string	"PF_ROSE 11"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2336:
+	.string	"_unused2"
+.LASF1967:
+	.string	"SO_PREFER_BUSY_POLL 69"
+.LASF2214:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF1820:
+	.string	"SOL_RXRPC 272"
+.LASF1282:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1848:
+	.string	"MSG_DONTWAIT MSG_DONTWAIT"
+.LASF2178:
+	.string	"INADDR_ALLHOSTS_GROUP ((in_addr_t) 0xe0000001)"
+.LASF1329:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF808:
+	.string	"_WCHAR_T_DEFINED "
+.LASF984:
+	.string	"ESPIPE 29"
+.LASF2322:
+	.string	"_fileno"
+.LASF2348:
+	.string	"__pthread_mutex_s"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF877:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1866:
+	.string	"CMSG_ALIGN(len) (((len) + sizeof (size_t) - 1) & (size_t) ~(sizeof (size_t) - 1))"
+.LASF1651:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1708:
+	.string	"PF_UNSPEC 0"
+.LASF2134:
+	.string	"IPPROTO_AH IPPROTO_AH"
+.LASF1413:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1175:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2146:
+	.string	"IPPROTO_HOPOPTS IPPROTO_HOPOPTS"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2029:
+	.string	"IP_PASSSEC 18"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1891:
+	.string	"SIOCATMARK 0x8905"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF2230:
+	.string	"sched_priority sched_priority"
+.LASF1185:
+	.string	"USE_PPM"
+.LASF2140:
+	.string	"IPPROTO_SCTP IPPROTO_SCTP"
+.LASF1916:
+	.string	"SO_RCVTIMEO_OLD 20"
+.LASF2290:
+	.string	"BASE_PORT 5760"
+.LASF2449:
+	.string	"setMode"
+.LASF1712:
+	.string	"PF_INET 2"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF871:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1104:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1327:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1585:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2185:
+	.string	"IN6ADDR_ANY_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } } }"
+.LASF1999:
+	.string	"IP_ADD_MEMBERSHIP 35"
+.LASF1160:
+	.string	"USE_FAKE_GYRO "
+.LASF1415:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1896:
+	.string	"SO_REUSEADDR 2"
+.LASF860:
+	.string	"__pid_t_defined "
+.LASF870:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1281:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2159:
+	.string	"IN_CLASSB_NET 0xffff0000"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1947:
+	.string	"SO_CNX_ADVICE 53"
+.LASF2189:
+	.string	"IP_MSFILTER_SIZE(numsrc) (sizeof (struct ip_msfilter) - sizeof (struct in_addr) + (numsrc) * sizeof (struct in_addr))"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2151:
+	.string	"IPPROTO_DSTOPTS IPPROTO_DSTOPTS"
+.LASF823:
+	.string	"WNOWAIT 0x01000000"
+.LASF1187:
+	.string	"SERIAL_RX"
+.LASF1212:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1764:
+	.string	"AF_IPX PF_IPX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2297:
+	.string	"__uint8_t"
+.LASF2474:
+	.string	"DYAD_EVENT_TIMEOUT"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1942:
+	.string	"SO_INCOMING_CPU 49"
+.LASF2428:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2454:
+	.string	"_Bool"
+.LASF1384:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"IPPROTO_TCP IPPROTO_TCP"
+.LASF1176:
+	.string	"USE_UART8 "
+.LASF1531:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"SKIP_IMU_CALC "
+.LASF1150:
+	.string	"U_ID_2 2"
+.LASF1261:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1303:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1087:
+	.string	"ERFKILL 132"
+.LASF2216:
+	.string	"__CPU_SETSIZE 1024"
+.LASF1126:
+	.string	"TELEMETRY_SRXL "
+.LASF970:
+	.string	"ENOTBLK 15"
+.LASF1332:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2372:
+	.string	"OWNER_ADC_CURR"
+.LASF1884:
+	.string	"__BITS_PER_LONG 64"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1673:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1978:
+	.string	"SO_SNDTIMEO SO_SNDTIMEO_OLD"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2246:
+	.string	"TIMER_ABSTIME 1"
+.LASF1987:
+	.string	"__CONST_SOCKADDR_ARG const struct sockaddr *"
+.LASF2111:
+	.string	"IPV6_PMTUDISC_PROBE 3"
+.LASF1491:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF733:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1307:
+	.string	"IOCFG_AF_OD 0"
+.LASF1047:
+	.string	"ENOPROTOOPT 92"
+.LASF2440:
+	.string	"txBufferTail"
+.LASF2416:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1089:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1898:
+	.string	"SO_ERROR 4"
+.LASF2172:
+	.string	"INADDR_BROADCAST ((in_addr_t) 0xffffffff)"
+.LASF2404:
+	.string	"OWNER_LED_STRIP"
+.LASF996:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF2292:
+	.string	"short unsigned int"
+.LASF2144:
+	.string	"IPPROTO_RAW IPPROTO_RAW"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1874:
+	.string	"_LINUX_STDDEF_H "
+.LASF1060:
+	.string	"ENOBUFS 105"
+.LASF1314:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF800:
+	.string	"__WCHAR_T__ "
+.LASF1007:
+	.string	"EBADE 52"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1132:
+	.string	"USE_SENSOR_NAMES "
+.LASF817:
+	.string	"_STDLIB_H 1"
+.LASF1678:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2412:
+	.string	"MODE_TX"
+.LASF725:
+	.string	"__need___va_list"
+.LASF1437:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1755:
+	.string	"PF_XDP 44"
+.LASF979:
+	.string	"EMFILE 24"
+.LASF2136:
+	.string	"IPPROTO_BEETPH IPPROTO_BEETPH"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1517:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF955:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF2470:
+	.string	"DYAD_EVENT_READY"
+.LASF1650:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1031:
+	.string	"ENOTUNIQ 76"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF734:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF2369:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1685:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1366:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1818:
+	.string	"SOL_NETLINK 270"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1983:
+	.string	"SHUT_RD SHUT_RD"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2305:
+	.string	"uint16_t"
+.LASF882:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1386:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2220:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1617:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2193:
+	.string	"htonl(x) __bswap_32 (x)"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2024:
+	.string	"IP_RECVTOS 13"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2308:
+	.string	"_flags"
+.LASF1596:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1116:
+	.string	"TELEMETRY_HOTT "
+.LASF1100:
+	.string	"USE_CLI_BATCH "
+.LASF1744:
+	.string	"PF_RXRPC 33"
+.LASF752:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1342:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1815:
+	.string	"SOL_NETBEUI 267"
+.LASF1240:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2509:
+	.string	"isEmpty"
+.LASF973:
+	.string	"EXDEV 18"
+.LASF2132:
+	.string	"IPPROTO_GRE IPPROTO_GRE"
+.LASF2278:
+	.string	"_ANSI_STDARG_H_ "
+.LASF1988:
+	.string	"__USE_KERNEL_IPV6_DEFS 0"
+.LASF1222:
+	.string	"_T_PTRDIFF_ "
+.LASF2126:
+	.string	"IPPROTO_UDP IPPROTO_UDP"
+.LASF978:
+	.string	"ENFILE 23"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2473:
+	.string	"DYAD_EVENT_ERROR"
+.LASF732:
+	.string	"__struct_FILE_defined 1"
+.LASF1560:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF739:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1179:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1429:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1023:
+	.string	"EADV 68"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF748:
+	.string	"SEEK_SET 0"
+.LASF2181:
+	.string	"INADDR_MAX_LOCAL_GROUP ((in_addr_t) 0xe00000ff)"
+.LASF1075:
+	.string	"EISNAM 120"
+.LASF1935:
+	.string	"SO_PEEK_OFF 42"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1040:
+	.string	"ERESTART 85"
+.LASF740:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF858:
+	.string	"__nlink_t_defined "
+.LASF1039:
+	.string	"EILSEQ 84"
+.LASF1276:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1798:
+	.string	"AF_CAIF PF_CAIF"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF799:
+	.string	"__wchar_t__ "
+.LASF1142:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF981:
+	.string	"ETXTBSY 26"
+.LASF2328:
+	.string	"_lock"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1337:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2192:
+	.string	"ntohs(x) __bswap_16 (x)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2068:
+	.string	"IPV6_MTU 24"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1747:
+	.string	"PF_IEEE802154 36"
+.LASF1641:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2484:
+	.string	"tcpVTable"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF753:
+	.string	"L_tmpnam 20"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF788:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1793:
+	.string	"AF_IUCV PF_IUCV"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1120:
+	.string	"CMS "
+.LASF1725:
+	.string	"PF_KEY 15"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1542:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1677:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2376:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1298:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1616:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1345:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1609:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1284:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1765:
+	.string	"AF_APPLETALK PF_APPLETALK"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1273:
+	.string	"BIT(x) (1 << (x))"
+.LASF2400:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2465:
+	.string	"DYAD_EVENT_DESTROY"
+.LASF1404:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1788:
+	.string	"AF_IB PF_IB"
+.LASF2437:
+	.string	"rxBufferHead"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2337:
+	.string	"FILE"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1193:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1981:
+	.string	"SCM_TIMESTAMPING SO_TIMESTAMPING"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF899:
+	.string	"_SYS_SELECT_H 1"
+.LASF994:
+	.string	"ENOTEMPTY 39"
+.LASF766:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF911:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1163:
+	.string	"BARO "
+.LASF2194:
+	.string	"htons(x) __bswap_16 (x)"
+.LASF1953:
+	.string	"SO_PEERGROUPS 59"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1729:
+	.string	"PF_ASH 18"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2079:
+	.string	"IPV6_RECVPKTINFO 49"
+.LASF1659:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF2463:
+	.string	"dyad_Callback"
+.LASF907:
+	.string	"__timeval_defined 1"
+.LASF2408:
+	.string	"OWNER_SPI_PREINIT"
+.LASF972:
+	.string	"EEXIST 17"
+.LASF1599:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1316:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2051:
+	.string	"IPV6_2292HOPOPTS 3"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2280:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1369:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2183:
+	.string	"s6_addr16 __in6_u.__u6_addr16"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"USE_RESOURCE_MGMT"
+.LASF796:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1209:
+	.string	"VTX_TRAMP"
+.LASF2169:
+	.string	"IN_EXPERIMENTAL(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xe0000000)"
+.LASF2483:
+	.string	"tcpPort_t"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2397:
+	.string	"OWNER_BARO_EXTI"
+.LASF2287:
+	.string	"__va_list__ "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF1064:
+	.string	"ETOOMANYREFS 109"
+.LASF1165:
+	.string	"USE_FLASHFS "
+.LASF772:
+	.string	"__HAVE_FLOAT16 0"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2411:
+	.string	"MODE_RX"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1186:
+	.string	"USE_PWM"
+.LASF1464:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1325:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1838:
+	.string	"__SOCKADDR_COMMON_SIZE (sizeof (unsigned short int))"
+.LASF2122:
+	.string	"IPPROTO_IPIP IPPROTO_IPIP"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1011:
+	.string	"EBADRQC 56"
+.LASF2078:
+	.string	"IPV6_HDRINCL 36"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2375:
+	.string	"OWNER_SERIAL_TX"
+.LASF1986:
+	.string	"__SOCKADDR_ARG struct sockaddr *__restrict"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2057:
+	.string	"SCM_SRCRT IPV6_RXSRCRT"
+.LASF1265:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1850:
+	.string	"MSG_WAITALL MSG_WAITALL"
+.LASF1719:
+	.string	"PF_X25 9"
+.LASF2158:
+	.string	"IN_CLASSB(a) ((((in_addr_t)(a)) & 0xc0000000) == 0x80000000)"
+.LASF2524:
+	.string	"tcpIsStart"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1378:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1780:
+	.string	"AF_ECONET PF_ECONET"
+.LASF1949:
+	.string	"SO_MEMINFO 55"
+.LASF2202:
+	.string	"IN6_IS_ADDR_MULTICAST(a) (((const uint8_t *) (a))[0] == 0xff)"
+.LASF1948:
+	.string	"SCM_TIMESTAMPING_OPT_STATS 54"
+.LASF2244:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2314:
+	.string	"_IO_write_end"
+.LASF1700:
+	.string	"SOCK_DGRAM SOCK_DGRAM"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1821:
+	.string	"SOL_PPPOL2TP 273"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1392:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2351:
+	.string	"__owner"
+.LASF1724:
+	.string	"PF_SECURITY 14"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1180:
+	.string	"STACK_CHECK"
+.LASF886:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1021:
+	.string	"EREMOTE 66"
+.LASF2468:
+	.string	"DYAD_EVENT_CONNECT"
+.LASF895:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2459:
+	.string	"remote"
+.LASF1730:
+	.string	"PF_ECONET 19"
+.LASF1055:
+	.string	"ENETDOWN 100"
+.LASF903:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1395:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1127:
+	.string	"USE_DASHBOARD "
+.LASF1946:
+	.string	"SO_ATTACH_REUSEPORT_EBPF 52"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1579:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1881:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1391:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF2213:
+	.string	"SCHED_RR 2"
+.LASF2247:
+	.string	"__struct_tm_defined 1"
+.LASF1652:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2398:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1470:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1943:
+	.string	"SO_ATTACH_BPF 50"
+.LASF1183:
+	.string	"USE_ADC"
+.LASF728:
+	.string	"____mbstate_t_defined 1"
+.LASF2522:
+	.string	"SystemCoreClock"
+.LASF834:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2410:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1906:
+	.string	"SO_OOBINLINE 10"
+.LASF1961:
+	.string	"SO_TIMESTAMP_NEW 63"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF795:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF998:
+	.string	"EIDRM 43"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1642:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2349:
+	.string	"__lock"
+.LASF776:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2310:
+	.string	"_IO_read_end"
+.LASF797:
+	.string	"__STDIO_INLINE"
+.LASF1960:
+	.string	"SO_TIMESTAMPING_OLD 37"
+.LASF1344:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1767:
+	.string	"AF_BRIDGE PF_BRIDGE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF2133:
+	.string	"IPPROTO_ESP IPPROTO_ESP"
+.LASF1295:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2188:
+	.string	"INET6_ADDRSTRLEN 46"
+.LASF1877:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF1853:
+	.string	"MSG_CONFIRM MSG_CONFIRM"
+.LASF1956:
+	.string	"SCM_TXTIME SO_TXTIME"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1792:
+	.string	"AF_BLUETOOTH PF_BLUETOOTH"
+.LASF2248:
+	.string	"__itimerspec_defined 1"
+.LASF1038:
+	.string	"ELIBEXEC 83"
+.LASF2347:
+	.string	"__pthread_list_t"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF859:
+	.string	"__uid_t_defined "
+.LASF1073:
+	.string	"ENOTNAM 118"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1944:
+	.string	"SO_DETACH_BPF SO_DETACH_FILTER"
+.LASF958:
+	.string	"ESRCH 3"
+.LASF2503:
+	.string	"chunk"
+.LASF1561:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1059:
+	.string	"ECONNRESET 104"
+.LASF1984:
+	.string	"SHUT_WR SHUT_WR"
+.LASF1507:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"__FD_SETSIZE"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2190:
+	.string	"GROUP_FILTER_SIZE(numsrc) (sizeof (struct group_filter) - sizeof (struct sockaddr_storage) + ((numsrc) * sizeof (struct sockaddr_storage)))"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF831:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1784:
+	.string	"AF_IRDA PF_IRDA"
+.LASF1701:
+	.string	"SOCK_RAW SOCK_RAW"
+.LASF2173:
+	.string	"INADDR_NONE ((in_addr_t) 0xffffffff)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1693:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2200:
+	.string	"IN6_IS_ADDR_V4COMPAT(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && ntohl (__a->__in6_u.__u6_addr32[3]) > 1; }))"
+.LASF2487:
+	.string	"tcpStart"
+.LASF768:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2096:
+	.string	"IPV6_ADDR_PREFERENCES 72"
+.LASF2380:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1204:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2007:
+	.string	"MCAST_BLOCK_SOURCE 43"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2472:
+	.string	"DYAD_EVENT_LINE"
+.LASF1602:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1153:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1801:
+	.string	"AF_VSOCK PF_VSOCK"
+.LASF1468:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1372:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1695:
+	.string	"_SYS_SOCKET_H 1"
+.LASF1319:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2466:
+	.string	"DYAD_EVENT_ACCEPT"
+.LASF1929:
+	.string	"SO_MARK 36"
+.LASF2447:
+	.string	"serialSetBaudRate"
+.LASF2368:
+	.string	"OWNER_SERVO"
+.LASF1275:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF2502:
+	.string	"tcpDataOut"
+.LASF1157:
+	.string	"ACC "
+.LASF2229:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1968:
+	.string	"SO_BUSY_POLL_BUDGET 70"
+.LASF1962:
+	.string	"SO_TIMESTAMPNS_NEW 64"
+.LASF1795:
+	.string	"AF_ISDN PF_ISDN"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1006:
+	.string	"EL2HLT 51"
+.LASF1123:
+	.string	"TELEMETRY_IBUS "
+.LASF1102:
+	.string	"USE_PWM "
+.LASF1715:
+	.string	"PF_APPLETALK 5"
+.LASF1632:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF881:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF801:
+	.string	"_WCHAR_T "
+.LASF1182:
+	.string	"TELEMETRY_LTM"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1359:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"EBADF 9"
+.LASF1343:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1676:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1283:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2456:
+	.string	"type"
+.LASF874:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1841:
+	.string	"_SS_PADSIZE (_SS_SIZE - __SOCKADDR_COMMON_SIZE - sizeof (__ss_aligntype))"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2168:
+	.string	"IN_MULTICAST(a) IN_CLASSD(a)"
+.LASF1727:
+	.string	"PF_ROUTE PF_NETLINK"
+.LASF949:
+	.string	"alloca"
+.LASF1996:
+	.string	"IP_MULTICAST_IF 32"
+.LASF851:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2187:
+	.string	"INET_ADDRSTRLEN 16"
+.LASF1228:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1858:
+	.string	"MSG_WAITFORONE MSG_WAITFORONE"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1770:
+	.string	"AF_INET6 PF_INET6"
+.LASF2153:
+	.string	"IN_CLASSA(a) ((((in_addr_t)(a)) & 0x80000000) == 0)"
+.LASF2298:
+	.string	"__uint16_t"
+.LASF791:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2239:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1887:
+	.string	"FIOSETOWN 0x8901"
+.LASF952:
+	.string	"_ERRNO_H 1"
+.LASF2433:
+	.string	"rxBufferSize"
+.LASF2367:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1826:
+	.string	"SOL_CAIF 278"
+.LASF2027:
+	.string	"IP_IPSEC_POLICY 16"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1236:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1689:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF364:
+	.string	"__k8 1"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1849:
+	.string	"MSG_EOR MSG_EOR"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2394:
+	.string	"OWNER_RX_SPI_CS"
+.LASF811:
+	.string	"__INT_WCHAR_T_H "
+.LASF856:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1810:
+	.string	"SOL_X25 262"
+.LASF2073:
+	.string	"IPV6_MULTICAST_ALL 29"
+.LASF2061:
+	.string	"IPV6_MULTICAST_IF 17"
+.LASF1890:
+	.string	"SIOCGPGRP 0x8904"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF900:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2439:
+	.string	"txBufferHead"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1032:
+	.string	"EBADFD 77"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1696:
+	.string	"__iovec_defined 1"
+.LASF2430:
+	.string	"mode"
+.LASF894:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1570:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1405:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1299:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2360:
+	.string	"__data"
+.LASF1645:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1750:
+	.string	"PF_NFC 39"
+.LASF844:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1773:
+	.string	"AF_NETBEUI PF_NETBEUI"
+.LASF1930:
+	.string	"SO_PROTOCOL 38"
+.LASF2048:
+	.string	"IP_MAX_MEMBERSHIPS 20"
+.LASF1979:
+	.string	"SCM_TIMESTAMP SO_TIMESTAMP"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1726:
+	.string	"PF_NETLINK 16"
+.LASF2321:
+	.string	"_chain"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2030:
+	.string	"IP_TRANSPARENT 19"
+.LASF1254:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2165:
+	.string	"IN_CLASSC_NSHIFT 8"
+.LASF1720:
+	.string	"PF_INET6 10"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2157:
+	.string	"IN_CLASSA_MAX 128"
+.LASF787:
+	.string	"__f32x(x) x ##f32x"
+.LASF1816:
+	.string	"SOL_LLC 268"
+.LASF2255:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF1940:
+	.string	"SO_MAX_PACING_RATE 47"
+.LASF2010:
+	.string	"MCAST_JOIN_SOURCE_GROUP 46"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1808:
+	.string	"SOL_RAW 255"
+.LASF1754:
+	.string	"PF_SMC 43"
+.LASF1260:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1510:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1147:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1456:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1133:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF2269:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1328:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2291:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1736:
+	.string	"PF_WANPIPE 25"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2102:
+	.string	"IPV6_RECVFRAGSIZE 77"
+.LASF2233:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2091:
+	.string	"IPV6_PATHMTU 61"
+.LASF1997:
+	.string	"IP_MULTICAST_TTL 33"
+.LASF1302:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1285:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1229:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1921:
+	.string	"SO_BINDTODEVICE 25"
+.LASF857:
+	.string	"__mode_t_defined "
+.LASF2361:
+	.string	"pthread_mutex_t"
+.LASF1156:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1141:
+	.string	"USE_NAV "
+.LASF1551:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2520:
+	.string	"_IO_lock_t"
+.LASF1097:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1363:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF962:
+	.string	"E2BIG 7"
+.LASF1155:
+	.string	"USE_FAKE_LED "
+.LASF2072:
+	.string	"IPV6_LEAVE_ANYCAST 28"
+.LASF2363:
+	.string	"float"
+.LASF2429:
+	.string	"identifier"
+.LASF1756:
+	.string	"PF_MCTP 45"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1819:
+	.string	"SOL_TIPC 271"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2257:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1350:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2489:
+	.string	"pthread_mutex_lock"
+.LASF1882:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF1735:
+	.string	"PF_PPPOX 24"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1234:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1440:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2450:
+	.string	"writeBuf"
+.LASF1159:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1480:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2023:
+	.string	"IP_RECVTTL 12"
+.LASF1728:
+	.string	"PF_PACKET 17"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF961:
+	.string	"ENXIO 6"
+.LASF1293:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1416:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF977:
+	.string	"EINVAL 22"
+.LASF1362:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2094:
+	.string	"IPV6_TCLASS 67"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1124:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1221:
+	.string	"_PTRDIFF_T "
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF879:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF2067:
+	.string	"IPV6_MTU_DISCOVER 23"
+.LASF2521:
+	.string	"stderr"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1966:
+	.string	"SO_DETACH_REUSEPORT_BPF 68"
+.LASF1249:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2452:
+	.string	"endWrite"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF2249:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2265:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1044:
+	.string	"EDESTADDRREQ 89"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2092:
+	.string	"IPV6_DONTFRAG 62"
+.LASF897:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF2143:
+	.string	"IPPROTO_ETHERNET IPPROTO_ETHERNET"
+.LASF1119:
+	.string	"USE_SERVOS "
+.LASF2260:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF2288:
+	.string	"RX_BUFFER_SIZE 1400"
+.LASF2505:
+	.string	"tcpWrite"
+.LASF1694:
+	.string	"_NETINET_IN_H 1"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1658:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2406:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF2086:
+	.string	"IPV6_RECVRTHDR 56"
+.LASF1627:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2464:
+	.string	"DYAD_EVENT_NULL"
+.LASF2353:
+	.string	"__kind"
+.LASF1483:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF833:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1598:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1794:
+	.string	"AF_RXRPC PF_RXRPC"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2071:
+	.string	"IPV6_JOIN_ANYCAST 27"
+.LASF2090:
+	.string	"IPV6_RECVPATHMTU 60"
+.LASF2045:
+	.string	"SOL_IP 0"
+.LASF864:
+	.string	"__clock_t_defined 1"
+.LASF1431:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2262:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF807:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1552:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2495:
+	.string	"dyad_setNoDelay"
+.LASF1758:
+	.string	"AF_UNSPEC PF_UNSPEC"
+.LASF1835:
+	.string	"SOMAXCONN 4096"
+.LASF1247:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2389:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF2513:
+	.string	"tcpTotalRxBytesWaiting"
+.LASF1648:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2106:
+	.string	"IPV6_RXHOPOPTS IPV6_HOPOPTS"
+.LASF910:
+	.string	"__NFDBITS"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1697:
+	.string	"__BITS_SOCKET_H "
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1269:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1994:
+	.string	"IP_RECVRETOPTS IP_RETOPTS"
+.LASF836:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1309:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1963:
+	.string	"SO_TIMESTAMPING_NEW 65"
+.LASF382:
+	.string	"unix 1"
+.LASF1885:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF1043:
+	.string	"ENOTSOCK 88"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1533:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1903:
+	.string	"SO_SNDBUFFORCE 32"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1787:
+	.string	"AF_LLC PF_LLC"
+.LASF2256:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF2497:
+	.string	"dyad_newStream"
+.LASF1910:
+	.string	"SO_BSDCOMPAT 14"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF2040:
+	.string	"IP_PMTUDISC_WANT 1"
+.LASF1782:
+	.string	"AF_RDS PF_RDS"
+.LASF867:
+	.string	"__timer_t_defined 1"
+.LASF990:
+	.string	"EDEADLK 35"
+.LASF1459:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF988:
+	.string	"EDOM 33"
+.LASF2504:
+	.string	"tcpDataOutAll"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF724:
+	.string	"__need___va_list "
+.LASF1036:
+	.string	"ELIBSCN 81"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF777:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1211:
+	.string	"USE_SPI"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2313:
+	.string	"_IO_write_ptr"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2060:
+	.string	"IPV6_UNICAST_HOPS 16"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF750:
+	.string	"SEEK_END 2"
+.LASF2492:
+	.string	"dyad_close"
+.LASF2515:
+	.string	"serTcpOpen"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1976:
+	.string	"SO_TIMESTAMPING SO_TIMESTAMPING_OLD"
+.LASF905:
+	.string	"____sigset_t_defined "
+.LASF1143:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF869:
+	.string	"_ENDIAN_H 1"
+.LASF1668:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1026:
+	.string	"EPROTO 71"
+.LASF1597:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2166:
+	.string	"IN_CLASSC_HOST (0xffffffff & ~IN_CLASSC_NET)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2097:
+	.string	"IPV6_MINHOPCOUNT 73"
+.LASF2197:
+	.string	"IN6_IS_ADDR_LINKLOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfe800000); }))"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF2441:
+	.string	"rxCallback"
+.LASF398:
+	.string	"false 0"
+.LASF2491:
+	.string	"dyad_setTimeout"
+.LASF1680:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1330:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF965:
+	.string	"ECHILD 10"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2258:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1864:
+	.string	"CMSG_NXTHDR(mhdr,cmsg) __cmsg_nxthdr (mhdr, cmsg)"
+.LASF1008:
+	.string	"EBADR 53"
+.LASF1706:
+	.string	"SOCK_CLOEXEC SOCK_CLOEXEC"
+.LASF1639:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1897:
+	.string	"SO_TYPE 3"
+.LASF2435:
+	.string	"rxBuffer"
+.LASF841:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1739:
+	.string	"PF_MPLS 28"
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF2434:
+	.string	"txBufferSize"
+.LASF1746:
+	.string	"PF_PHONET 35"
+.LASF2120:
+	.string	"IPPROTO_ICMP IPPROTO_ICMP"
+.LASF2420:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF951:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF938:
+	.string	"__ONCE_ALIGNMENT "
+.LASF2059:
+	.string	"IPV6_AUTHHDR 10"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2399:
+	.string	"OWNER_USB_DETECT"
+.LASF827:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1217:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1305:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1300:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2015:
+	.string	"MCAST_EXCLUDE 0"
+.LASF2461:
+	.string	"size"
+.LASF762:
+	.string	"__attr_dealloc_fclose"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF868:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2039:
+	.string	"IP_PMTUDISC_DONT 0"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2156:
+	.string	"IN_CLASSA_HOST (0xffffffff & ~IN_CLASSA_NET)"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1717:
+	.string	"PF_BRIDGE 7"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2206:
+	.string	"IN6_IS_ADDR_MC_ORGLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x8))"
+.LASF891:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1151:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2013:
+	.string	"IP_MULTICAST_ALL 49"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2203:
+	.string	"IN6_IS_ADDR_MC_NODELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x1))"
+.LASF1270:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1216:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF2281:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2277:
+	.string	"_STDARG_H "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1056:
+	.string	"ENETUNREACH 101"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF731:
+	.string	"__FILE_defined 1"
+.LASF774:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1842:
+	.string	"MSG_OOB MSG_OOB"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1831:
+	.string	"SOL_XDP 283"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2403:
+	.string	"OWNER_INVERTER"
+.LASF2467:
+	.string	"DYAD_EVENT_LISTEN"
+.LASF2307:
+	.string	"size_t"
+.LASF2243:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF880:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1872:
+	.string	"__ASM_GENERIC_SOCKET_H "
+.LASF1017:
+	.string	"ETIME 62"
+.LASF989:
+	.string	"ERANGE 34"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1052:
+	.string	"EAFNOSUPPORT 97"
+.LASF2350:
+	.string	"__count"
+.LASF884:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2304:
+	.string	"uint8_t"
+.LASF2055:
+	.string	"IPV6_CHECKSUM 7"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF756:
+	.string	"L_ctermid 9"
+.LASF2009:
+	.string	"MCAST_LEAVE_GROUP 45"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF939:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1267:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2115:
+	.string	"SOL_ICMPV6 58"
+.LASF1745:
+	.string	"PF_ISDN 34"
+.LASF1114:
+	.string	"TELEMETRY "
+.LASF1865:
+	.string	"CMSG_FIRSTHDR(mhdr) ((size_t) (mhdr)->msg_controllen >= sizeof (struct cmsghdr) ? (struct cmsghdr *) (mhdr)->msg_control : (struct cmsghdr *) 0)"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF2026:
+	.string	"IP_FREEBIND 15"
+.LASF1461:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1462:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1674:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2501:
+	.string	"tcpDataIn"
+.LASF855:
+	.string	"__dev_t_defined "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2147:
+	.string	"IPPROTO_ROUTING IPPROTO_ROUTING"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1166:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1974:
+	.string	"SO_TIMESTAMP SO_TIMESTAMP_OLD"
+.LASF812:
+	.string	"_GCC_WCHAR_T "
+.LASF1271:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2240:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1198:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF838:
+	.string	"__WCOREFLAG 0x80"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2209:
+	.string	"_SCHED_H 1"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2317:
+	.string	"_IO_save_base"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1590:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1057:
+	.string	"ENETRESET 102"
+.LASF1503:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF2279:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1435:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2119:
+	.string	"IPPROTO_IP IPPROTO_IP"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2113:
+	.string	"IPV6_PMTUDISC_OMIT 5"
+.LASF940:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF953:
+	.string	"_BITS_ERRNO_H 1"
+.LASF1528:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF865:
+	.string	"__clockid_t_defined 1"
+.LASF815:
+	.string	"_BSD_WCHAR_T_"
+.LASF1201:
+	.string	"TELEMETRY_CRSF"
+.LASF1699:
+	.string	"SOCK_STREAM SOCK_STREAM"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1291:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF770:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1860:
+	.string	"MSG_ZEROCOPY MSG_ZEROCOPY"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1563:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2222:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1184:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2084:
+	.string	"IPV6_HOPOPTS 54"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1905:
+	.string	"SO_KEEPALIVE 9"
+.LASF1317:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1822:
+	.string	"SOL_BLUETOOTH 274"
+.LASF1287:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1308:
+	.string	"IOCFG_IPD 0"
+.LASF1231:
+	.string	"__need_ptrdiff_t"
+.LASF883:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1001:
+	.string	"EL3HLT 46"
+.LASF2327:
+	.string	"_shortbuf"
+.LASF2215:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1248:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2451:
+	.string	"beginWrite"
+.LASF1218:
+	.string	"_STDDEF_H "
+.LASF1607:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1162:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1614:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1799:
+	.string	"AF_ALG PF_ALG"
+.LASF2104:
+	.string	"IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP"
+.LASF1348:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2271:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1622:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1099:
+	.string	"USE_SETTINGS_INDEX "
+.LASF2128:
+	.string	"IPPROTO_TP IPPROTO_TP"
+.LASF1867:
+	.string	"CMSG_SPACE(len) (CMSG_ALIGN (len) + CMSG_ALIGN (sizeof (struct cmsghdr)))"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1434:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF2334:
+	.string	"__pad5"
+.LASF1471:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2331:
+	.string	"_wide_data"
+.LASF2008:
+	.string	"MCAST_UNBLOCK_SOURCE 44"
+.LASF2012:
+	.string	"MCAST_MSFILTER 48"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1013:
+	.string	"EDEADLOCK EDEADLK"
+.LASF1774:
+	.string	"AF_SECURITY PF_SECURITY"
+.LASF1836:
+	.string	"_BITS_SOCKADDR_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2053:
+	.string	"IPV6_2292RTHDR 5"
+.LASF1290:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF902:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1760:
+	.string	"AF_UNIX PF_UNIX"
+.LASF1714:
+	.string	"PF_IPX 4"
+.LASF1398:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1807:
+	.string	"AF_MAX PF_MAX"
+.LASF2485:
+	.string	"tcpSerialPorts"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2160:
+	.string	"IN_CLASSB_NSHIFT 16"
+.LASF872:
+	.string	"__BIG_ENDIAN 4321"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1569:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2500:
+	.string	"instance"
+.LASF2508:
+	.string	"isTcpTransmitBufferEmpty"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1519:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1786:
+	.string	"AF_WANPIPE PF_WANPIPE"
+.LASF2345:
+	.string	"__prev"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1686:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1546:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"LED_STRIP"
+.LASF1581:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1766:
+	.string	"AF_NETROM PF_NETROM"
+.LASF1095:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1876:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF769:
+	.string	"__f128(x) x ##f128"
+.LASF1879:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF923:
+	.string	"__fsblkcnt_t_defined "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1825:
+	.string	"SOL_IUCV 277"
+.LASF1769:
+	.string	"AF_X25 PF_X25"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF878:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1868:
+	.string	"CMSG_LEN(len) (CMSG_ALIGN (sizeof (struct cmsghdr)) + (len))"
+.LASF1255:
+	.string	"NOOP do {} while (0)"
+.LASF956:
+	.string	"EPERM 1"
+.LASF1351:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF2512:
+	.string	"bytesFree"
+.LASF1446:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1886:
+	.string	"__ASM_GENERIC_SOCKIOS_H "
+.LASF1301:
+	.string	"IO_TAG_NONE 0"
+.LASF1192:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1492:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF924:
+	.string	"__fsfilcnt_t_defined "
+.LASF1748:
+	.string	"PF_CAIF 37"
+.LASF818:
+	.string	"WNOHANG 1"
+.LASF1789:
+	.string	"AF_MPLS PF_MPLS"
+.LASF1498:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1800:
+	.string	"AF_NFC PF_NFC"
+.LASF1115:
+	.string	"TELEMETRY_FRSKY "
+.LASF1899:
+	.string	"SO_DONTROUTE 5"
+.LASF1321:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1131:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2004:
+	.string	"IP_DROP_SOURCE_MEMBERSHIP 40"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2241:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1644:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1629:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1015:
+	.string	"ENOSTR 60"
+.LASF2211:
+	.string	"SCHED_OTHER 0"
+.LASF745:
+	.string	"_IONBF 2"
+.LASF993:
+	.string	"ENOSYS 38"
+.LASF1268:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1620:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1506:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1452:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1917:
+	.string	"SO_SNDTIMEO_OLD 21"
+.LASF1191:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1698:
+	.string	"__socklen_t_defined "
+.LASF2046:
+	.string	"IP_DEFAULT_MULTICAST_TTL 1"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2496:
+	.string	"fprintf"
+.LASF1797:
+	.string	"AF_IEEE802154 PF_IEEE802154"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF754:
+	.string	"TMP_MAX 238328"
+.LASF2518:
+	.string	"onData"
+.LASF1768:
+	.string	"AF_ATMPVC PF_ATMPVC"
+.LASF820:
+	.string	"WSTOPPED 2"
+.LASF2510:
+	.string	"tcpTotalTxBytesFree"
+.LASF721:
+	.string	"NULL"
+.LASF1933:
+	.string	"SO_WIFI_STATUS 41"
+.LASF1062:
+	.string	"ENOTCONN 107"
+.LASF1924:
+	.string	"SO_GET_FILTER SO_ATTACH_FILTER"
+.LASF2210:
+	.string	"_BITS_SCHED_H 1"
+.LASF921:
+	.string	"__blksize_t_defined "
+.LASF947:
+	.string	"__have_pthread_attr_t 1"
+.LASF821:
+	.string	"WEXITED 4"
+.LASF2381:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1078:
+	.string	"ENOMEDIUM 123"
+.LASF1707:
+	.string	"SOCK_NONBLOCK SOCK_NONBLOCK"
+.LASF1092:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1377:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"EPROTONOSUPPORT 93"
+.LASF1534:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1331:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1843:
+	.string	"MSG_PEEK MSG_PEEK"
+.LASF813:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2031:
+	.string	"IP_ORIGDSTADDR 20"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1145:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1805:
+	.string	"AF_XDP PF_XDP"
+.LASF937:
+	.string	"__LOCK_ALIGNMENT "
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1977:
+	.string	"SO_RCVTIMEO SO_RCVTIMEO_OLD"
+.LASF967:
+	.string	"ENOMEM 12"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1813:
+	.string	"SOL_AAL 265"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1144:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF830:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1665:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1880:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF1094:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2077:
+	.string	"IPV6_XFRM_POLICY 35"
+.LASF1862:
+	.string	"MSG_CMSG_CLOEXEC MSG_CMSG_CLOEXEC"
+.LASF914:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF963:
+	.string	"ENOEXEC 8"
+.LASF1993:
+	.string	"IP_RECVOPTS 6"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2014:
+	.string	"IP_UNICAST_IF 50"
+.LASF1495:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2043:
+	.string	"IP_PMTUDISC_INTERFACE 4"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF767:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2186:
+	.string	"IN6ADDR_LOOPBACK_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1 } } }"
+.LASF1111:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1054:
+	.string	"EADDRNOTAVAIL 99"
+.LASF885:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2089:
+	.string	"IPV6_DSTOPTS 59"
+.LASF1731:
+	.string	"PF_ATMSVC 20"
+.LASF890:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2371:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1817:
+	.string	"SOL_DCCP 269"
+.LASF1624:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF822:
+	.string	"WCONTINUED 8"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1428:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF992:
+	.string	"ENOLCK 37"
+.LASF1252:
+	.string	"UNIT_TESTED "
+.LASF2457:
+	.string	"udata"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1834:
+	.string	"SOL_SMC 286"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1549:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1703:
+	.string	"SOCK_SEQPACKET SOCK_SEQPACKET"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1751:
+	.string	"PF_VSOCK 40"
+.LASF805:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2098:
+	.string	"IPV6_ORIGDSTADDR 74"
+.LASF932:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2201:
+	.ascii	"IN6_ARE_ADDR_EQUAL(a,b) (__extension__ ({ const struct in6_a"
+	.ascii	"ddr *__a = (const struct in6_addr *) (a); const struct in6_a"
+	.ascii	"ddr *__b = (const struct in6_addr *"
+	.string	") (b); __a->__in6_u.__u6_addr32[0] == __b->__in6_u.__u6_addr32[0] && __a->__in6_u.__u6_addr32[1] == __b->__in6_u.__u6_addr32[1] && __a->__in6_u.__u6_addr32[2] == __b->__in6_u.__u6_addr32[2] && __a->__in6_u.__u6_addr32[3] == __b->__in6_u.__u6_addr32[3]; }))"
+.LASF2182:
+	.string	"s6_addr __in6_u.__u6_addr8"
+.LASF1296:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1243:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2204:
+	.string	"IN6_IS_ADDR_MC_LINKLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x2))"
+.LASF2519:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF783:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2052:
+	.string	"IPV6_2292DSTOPTS 4"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1288:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1091:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1018:
+	.string	"ENOSR 63"
+.LASF1049:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF1389:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1957:
+	.string	"SO_BINDTOIFINDEX 62"
+.LASF1474:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2195:
+	.string	"IN6_IS_ADDR_UNSPECIFIED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == 0; }))"
+.LASF735:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1995:
+	.string	"IP_RETOPTS 7"
+.LASF2282:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1888:
+	.string	"SIOCSPGRP 0x8902"
+.LASF1638:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2184:
+	.string	"s6_addr32 __in6_u.__u6_addr32"
+.LASF1045:
+	.string	"EMSGSIZE 90"
+.LASF936:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF2227:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF2076:
+	.string	"IPV6_IPSEC_POLICY 34"
+.LASF1975:
+	.string	"SO_TIMESTAMPNS SO_TIMESTAMPNS_OLD"
+.LASF1972:
+	.string	"SO_TXREHASH 74"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2003:
+	.string	"IP_ADD_SOURCE_MEMBERSHIP 39"
+.LASF2175:
+	.string	"IN_LOOPBACKNET 127"
+.LASF1107:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2038:
+	.string	"IP_RECVERR_RFC4884 26"
+.LASF2319:
+	.string	"_IO_save_end"
+.LASF909:
+	.string	"__suseconds_t_defined "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1455:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2138:
+	.string	"IPPROTO_PIM IPPROTO_PIM"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF926:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2346:
+	.string	"__next"
+.LASF1081:
+	.string	"ENOKEY 126"
+.LASF918:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF2020:
+	.string	"IP_PMTUDISC 10"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2268:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF699:
+	.string	"_STDIO_H 1"
+.LASF1051:
+	.string	"EPFNOSUPPORT 96"
+.LASF1824:
+	.string	"SOL_RDS 276"
+.LASF2002:
+	.string	"IP_BLOCK_SOURCE 38"
+.LASF1611:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF901:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF1232:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2359:
+	.string	"pthread_mutexattr_t"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1734:
+	.string	"PF_IRDA 23"
+.LASF1101:
+	.string	"USE_PPM "
+.LASF1380:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1927:
+	.string	"SO_PEERSEC 31"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1340:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1058:
+	.string	"ECONNABORTED 103"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2413:
+	.string	"MODE_RXTX"
+.LASF1205:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1188:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2032:
+	.string	"IP_RECVORIGDSTADDR IP_ORIGDSTADDR"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1083:
+	.string	"EKEYREVOKED 128"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1168:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2237:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1482:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"TELEMETRY_HOTT"
+.LASF729:
+	.string	"_____fpos64_t_defined 1"
+.LASF1833:
+	.string	"SOL_MCTP 285"
+.LASF2342:
+	.string	"long long unsigned int"
+.LASF2017:
+	.string	"IP_ROUTER_ALERT 5"
+.LASF1909:
+	.string	"SO_LINGER 13"
+.LASF2198:
+	.string	"IN6_IS_ADDR_SITELOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfec00000); }))"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2065:
+	.string	"IPV6_LEAVE_GROUP 21"
+.LASF2118:
+	.string	"IPV6_RTHDR_TYPE_0 0"
+.LASF2455:
+	.string	"dyad_Stream"
+.LASF2355:
+	.string	"__elision"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF755:
+	.string	"FILENAME_MAX 4096"
+.LASF2217:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF2049:
+	.string	"IPV6_ADDRFORM 1"
+.LASF2387:
+	.string	"OWNER_SDCARD"
+.LASF1749:
+	.string	"PF_ALG 38"
+.LASF1393:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2011:
+	.string	"MCAST_LEAVE_SOURCE_GROUP 47"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1669:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1061:
+	.string	"EISCONN 106"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2469:
+	.string	"DYAD_EVENT_CLOSE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1915:
+	.string	"SO_SNDLOWAT 19"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2199:
+	.string	"IN6_IS_ADDR_V4MAPPED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == htonl (0xffff); }))"
+.LASF1781:
+	.string	"AF_ATMSVC PF_ATMSVC"
+.LASF2295:
+	.string	"signed char"
+.LASF784:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2208:
+	.string	"_PTHREAD_H 1"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1684:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1003:
+	.string	"ELNRNG 48"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1117:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF2261:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1118:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1666:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1846:
+	.string	"MSG_PROXY MSG_PROXY"
+.LASF809:
+	.string	"_WCHAR_T_H "
+.LASF1612:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1950:
+	.string	"SO_INCOMING_NAPI_ID 56"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1667:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF866:
+	.string	"__time_t_defined 1"
+.LASF893:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF917:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1873:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF747:
+	.string	"EOF (-1)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1540:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF2514:
+	.string	"count"
+.LASF2021:
+	.string	"IP_MTU_DISCOVER 10"
+.LASF1733:
+	.string	"PF_SNA 22"
+.LASF1575:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF946:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF786:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2022:
+	.string	"IP_RECVERR 11"
+.LASF2493:
+	.string	"dyad_listenEx"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1593:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2273:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1181:
+	.string	"USE_DASHBOARD"
+.LASF1121:
+	.string	"TELEMETRY_LTM "
+.LASF2377:
+	.string	"OWNER_PINDEBUG"
+.LASF1423:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF826:
+	.string	"__WCLONE 0x80000000"
+.LASF2302:
+	.string	"__off64_t"
+.LASF1310:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF920:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1932:
+	.string	"SO_RXQ_OVFL 40"
+.LASF2311:
+	.string	"_IO_read_base"
+.LASF842:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1139:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF954:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF775:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1213:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2329:
+	.string	"_offset"
+.LASF2478:
+	.string	"conn"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1829:
+	.string	"SOL_KCM 281"
+.LASF1518:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1286:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1923:
+	.string	"SO_DETACH_FILTER 27"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1237:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1214:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1408:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2431:
+	.string	"options"
+.LASF2251:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2150:
+	.string	"IPPROTO_NONE IPPROTO_NONE"
+.LASF2316:
+	.string	"_IO_buf_end"
+.LASF2162:
+	.string	"IN_CLASSB_MAX 65536"
+.LASF1845:
+	.string	"MSG_CTRUNC MSG_CTRUNC"
+.LASF1027:
+	.string	"EMULTIHOP 72"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1613:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2275:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1220:
+	.string	"_ANSI_STDDEF_H "
+.LASF2145:
+	.string	"IPPROTO_MPTCP IPPROTO_MPTCP"
+.LASF2401:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF2264:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2170:
+	.string	"IN_BADCLASS(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xf0000000)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1553:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1584:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1907:
+	.string	"SO_NO_CHECK 11"
+.LASF1633:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2036:
+	.string	"IP_BIND_ADDRESS_NO_PORT 24"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2108:
+	.string	"IPV6_PMTUDISC_DONT 0"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1000:
+	.string	"EL2NSYNC 45"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1335:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1802:
+	.string	"AF_KCM PF_KCM"
+.LASF2335:
+	.string	"_mode"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2149:
+	.string	"IPPROTO_ICMPV6 IPPROTO_ICMPV6"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2312:
+	.string	"_IO_write_base"
+.LASF1105:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1315:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF863:
+	.string	"__key_t_defined "
+.LASF1041:
+	.string	"ESTRPIPE 86"
+.LASF1136:
+	.string	"VTX_SMARTAUDIO "
+.LASF1278:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1990:
+	.string	"IP_HDRINCL 3"
+.LASF1065:
+	.string	"ETIMEDOUT 110"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF749:
+	.string	"SEEK_CUR 1"
+.LASF2121:
+	.string	"IPPROTO_IGMP IPPROTO_IGMP"
+.LASF888:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1959:
+	.string	"SO_TIMESTAMPNS_OLD 35"
+.LASF2471:
+	.string	"DYAD_EVENT_DATA"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1536:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1738:
+	.string	"PF_IB 27"
+.LASF2423:
+	.string	"SERIAL_BIDIR"
+.LASF1844:
+	.string	"MSG_DONTROUTE MSG_DONTROUTE"
+.LASF2164:
+	.string	"IN_CLASSC_NET 0xffffff00"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF2486:
+	.string	"tcpPortInitialized"
+.LASF1922:
+	.string	"SO_ATTACH_FILTER 26"
+.LASF759:
+	.string	"stdin stdin"
+.LASF1066:
+	.string	"ECONNREFUSED 111"
+.LASF1341:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1914:
+	.string	"SO_RCVLOWAT 18"
+.LASF2019:
+	.string	"IP_PKTOPTIONS 9"
+.LASF751:
+	.string	"P_tmpdir \"/tmp\""
+.LASF2129:
+	.string	"IPPROTO_DCCP IPPROTO_DCCP"
+.LASF1539:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF758:
+	.string	"FOPEN_MAX 16"
+.LASF1140:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF2050:
+	.string	"IPV6_2292PKTINFO 2"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2148:
+	.string	"IPPROTO_FRAGMENT IPPROTO_FRAGMENT"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1206:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2444:
+	.string	"serialTotalRxWaiting"
+.LASF1322:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1869:
+	.string	"__CMSG_PADDING(len) ((sizeof (size_t) - ((len) & (sizeof (size_t) - 1))) & (sizeof (size_t) - 1))"
+.LASF2042:
+	.string	"IP_PMTUDISC_PROBE 3"
+.LASF2300:
+	.string	"long int"
+.LASF1900:
+	.string	"SO_BROADCAST 6"
+.LASF1447:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1441:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2124:
+	.string	"IPPROTO_EGP IPPROTO_EGP"
+.LASF737:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1778:
+	.string	"AF_PACKET PF_PACKET"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1333:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF925:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2338:
+	.string	"_IO_marker"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF974:
+	.string	"ENODEV 19"
+.LASF1656:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1034:
+	.string	"ELIBACC 79"
+.LASF1426:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF930:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF999:
+	.string	"ECHRNG 44"
+.LASF1980:
+	.string	"SCM_TIMESTAMPNS SO_TIMESTAMPNS"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1783:
+	.string	"AF_SNA PF_SNA"
+.LASF1122:
+	.string	"TELEMETRY_CRSF "
+.LASF1225:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1233:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1383:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1396:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"SO_SECURITY_ENCRYPTION_TRANSPORT 23"
+.LASF1402:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"__PTRDIFF_T "
+.LASF2226:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF908:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1958:
+	.string	"SO_TIMESTAMP_OLD 29"
+.LASF850:
+	.string	"EXIT_SUCCESS 0"
+.LASF2409:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF2225:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1014:
+	.string	"EBFONT 59"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1521:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1407:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1467:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2379:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1918:
+	.string	"SO_SECURITY_AUTHENTICATION 22"
+.LASF1911:
+	.string	"SO_REUSEPORT 15"
+.LASF760:
+	.string	"stdout stdout"
+.LASF1266:
+	.string	"EXPAND_I(x) x"
+.LASF1297:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1515:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2177:
+	.string	"INADDR_UNSPEC_GROUP ((in_addr_t) 0xe0000000)"
+.LASF757:
+	.string	"FOPEN_MAX"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1936:
+	.string	"SO_NOFCS 43"
+.LASF2285:
+	.string	"_VA_LIST "
+.LASF1199:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2306:
+	.string	"uint32_t"
+.LASF1902:
+	.string	"SO_RCVBUF 8"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF2035:
+	.string	"IP_CHECKSUM 23"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2339:
+	.string	"_IO_codecvt"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2034:
+	.string	"IP_NODEFRAG 22"
+.LASF2438:
+	.string	"rxBufferTail"
+.LASF2163:
+	.string	"IN_CLASSC(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xc0000000)"
+.LASF789:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1530:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2344:
+	.string	"__pthread_internal_list"
+.LASF2221:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1387:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2179:
+	.string	"INADDR_ALLRTRS_GROUP ((in_addr_t) 0xe0000002)"
+.LASF2087:
+	.string	"IPV6_RTHDR 57"
+.LASF1390:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2135:
+	.string	"IPPROTO_MTP IPPROTO_MTP"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF790:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF912:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1557:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2448:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1615:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF814:
+	.string	"__DEFINED_wchar_t "
+.LASF1600:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"IP_TTL 2"
+.LASF2219:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF2232:
+	.string	"_TIME_H 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF792:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1113:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1196:
+	.string	"TELEMETRY_FRSKY"
+.LASF1827:
+	.string	"SOL_ALG 279"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2238:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2506:
+	.string	"nextHead"
+.LASF1253:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF906:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1705:
+	.string	"SOCK_PACKET SOCK_PACKET"
+.LASF2259:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF802:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1904:
+	.string	"SO_RCVBUFFORCE 33"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2064:
+	.string	"IPV6_JOIN_GROUP 20"
+.LASF1718:
+	.string	"PF_ATMPVC 8"
+.LASF1939:
+	.string	"SO_BUSY_POLL 46"
+.LASF2482:
+	.string	"clientCount"
+.LASF848:
+	.string	"RAND_MAX 2147483647"
+.LASF2378:
+	.string	"OWNER_TIMER"
+.LASF1347:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1852:
+	.string	"MSG_SYN MSG_SYN"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2494:
+	.string	"dyad_addListener"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1588:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2498:
+	.string	"__errno_location"
+.LASF1564:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1450:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1623:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF793:
+	.string	"_BITS_STDIO_H 1"
+.LASF1138:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2303:
+	.string	"char"
+.LASF931:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1732:
+	.string	"PF_RDS 21"
+.LASF1989:
+	.string	"IP_OPTIONS 4"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF2054:
+	.string	"IPV6_2292PKTOPTIONS 6"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1215:
+	.string	"DEFIO_NO_PORTS "
+.LASF1790:
+	.string	"AF_CAN PF_CAN"
+.LASF1545:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2384:
+	.string	"OWNER_SPI_MOSI"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1306:
+	.string	"IOCFG_AF_PP 0"
+.LASF2354:
+	.string	"__spins"
+.LASF1606:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1375:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2085:
+	.string	"IPV6_RTHDRDSTOPTS 55"
+.LASF2155:
+	.string	"IN_CLASSA_NSHIFT 24"
+.LASF726:
+	.string	"__GNUC_VA_LIST "
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF819:
+	.string	"WUNTRACED 2"
+.LASF1969:
+	.string	"SO_NETNS_COOKIE 71"
+.LASF2315:
+	.string	"_IO_buf_base"
+.LASF1170:
+	.string	"USE_UART2 "
+.LASF896:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2352:
+	.string	"__nusers"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1077:
+	.string	"EDQUOT 122"
+.LASF1626:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1004:
+	.string	"EUNATCH 49"
+.LASF2252:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1964:
+	.string	"SO_RCVTIMEO_NEW 66"
+.LASF1194:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1130:
+	.string	"USE_RX_MSP "
+.LASF1524:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1973:
+	.string	"SO_RCVMARK 75"
+.LASF397:
+	.string	"true 1"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF976:
+	.string	"EISDIR 21"
+.LASF1432:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2357:
+	.string	"__size"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF2205:
+	.string	"IN6_IS_ADDR_MC_SITELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x5))"
+.LASF2516:
+	.string	"onAccept"
+.LASF991:
+	.string	"ENAMETOOLONG 36"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2167:
+	.string	"IN_CLASSD(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xe0000000)"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1681:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2141:
+	.string	"IPPROTO_UDPLITE IPPROTO_UDPLITE"
+.LASF1952:
+	.string	"SCM_TIMESTAMPING_PKTINFO 58"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF773:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2343:
+	.string	"_IO_FILE"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2100:
+	.string	"IPV6_TRANSPARENT 75"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF2421:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1093:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2340:
+	.string	"_IO_wide_data"
+.LASF2207:
+	.string	"IN6_IS_ADDR_MC_GLOBAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0xe))"
+.LASF2161:
+	.string	"IN_CLASSB_HOST (0xffffffff & ~IN_CLASSB_NET)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2101:
+	.string	"IPV6_UNICAST_IF 76"
+.LASF1037:
+	.string	"ELIBMAX 82"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF2263:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF1931:
+	.string	"SO_DOMAIN 39"
+.LASF2390:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1239:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1812:
+	.string	"SOL_ATM 264"
+.LASF1264:
+	.string	"STR_HELPER(x) #x"
+.LASF945:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1476:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2245:
+	.string	"CLOCK_TAI 11"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1985:
+	.string	"SHUT_RDWR SHUT_RDWR"
+.LASF1208:
+	.string	"VTX_SMARTAUDIO"
+.LASF2422:
+	.string	"SERIAL_UNIDIR"
+.LASF2382:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1129:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2374:
+	.string	"OWNER_ADC_RSSI"
+.LASF1250:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF971:
+	.string	"EBUSY 16"
+.LASF1587:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1486:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2224:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF1164:
+	.string	"USE_FAKE_BARO "
+.LASF904:
+	.string	"__sigset_t_defined 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1938:
+	.string	"SO_SELECT_ERR_QUEUE 45"
+.LASF1998:
+	.string	"IP_MULTICAST_LOOP 34"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1525:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2235:
+	.string	"CLOCK_REALTIME 0"
+.LASF816:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1223:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1030:
+	.string	"EOVERFLOW 75"
+.LASF741:
+	.string	"__off_t_defined "
+.LASF1752:
+	.string	"PF_KCM 41"
+.LASF1857:
+	.string	"MSG_MORE MSG_MORE"
+.LASF1809:
+	.string	"SOL_DECNET 261"
+.LASF2236:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1010:
+	.string	"ENOANO 55"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2462:
+	.string	"dyad_Event"
+.LASF980:
+	.string	"ENOTTY 25"
+.LASF1158:
+	.string	"USE_FAKE_ACC "
+.LASF1803:
+	.string	"AF_QIPCRTR PF_QIPCRTR"
+.LASF1085:
+	.string	"EOWNERDEAD 130"
+.LASF377:
+	.string	"__linux 1"
+.LASF2058:
+	.string	"IPV6_NEXTHOP 9"
+.LASF1631:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1567:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1009:
+	.string	"EXFULL 54"
+.LASF1453:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1513:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1399:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1741:
+	.string	"PF_TIPC 30"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF861:
+	.string	"__id_t_defined "
+.LASF1072:
+	.string	"EUCLEAN 117"
+.LASF1965:
+	.string	"SO_SNDTIMEO_NEW 67"
+.LASF1410:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF835:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1477:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1053:
+	.string	"EADDRINUSE 98"
+.LASF1855:
+	.string	"MSG_ERRQUEUE MSG_ERRQUEUE"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1804:
+	.string	"AF_SMC PF_SMC"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2139:
+	.string	"IPPROTO_COMP IPPROTO_COMP"
+.LASF1662:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"EAGAIN 11"
+.LASF1608:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF942:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1670:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF969:
+	.string	"EFAULT 14"
+.LASF862:
+	.string	"__daddr_t_defined "
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1002:
+	.string	"EL3RST 47"
+.LASF1925:
+	.string	"SO_PEERNAME 28"
+.LASF1591:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"EBADSLT 57"
+.LASF825:
+	.string	"__WALL 0x40000000"
+.LASF2385:
+	.string	"OWNER_I2C_SCL"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF875:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF889:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2511:
+	.string	"bytesUsed"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1711:
+	.string	"PF_FILE PF_LOCAL"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2517:
+	.string	"onClose"
+.LASF1473:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1955:
+	.string	"SO_TXTIME 61"
+.LASF837:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1854:
+	.string	"MSG_RST MSG_RST"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1202:
+	.string	"TELEMETRY_IBUS"
+.LASF1096:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF761:
+	.string	"stderr stderr"
+.LASF1401:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2006:
+	.string	"MCAST_JOIN_GROUP 42"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1578:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2362:
+	.string	"double"
+.LASF1832:
+	.string	"SOL_MPTCP 284"
+.LASF1354:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"EKEYEXPIRED 127"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF892:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF794:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF2250:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF873:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2383:
+	.string	"OWNER_SPI_MISO"
+.LASF1365:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2386:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2407:
+	.string	"OWNER_COMPASS_CS"
+.LASF1692:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF2107:
+	.string	"IPV6_RXDSTOPTS IPV6_DSTOPTS"
+.LASF1277:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1489:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2276:
+	.string	"DYAD_H "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF876:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1796:
+	.string	"AF_PHONET PF_PHONET"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2001:
+	.string	"IP_UNBLOCK_SOURCE 37"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2289:
+	.string	"TX_BUFFER_SIZE 16384"
+.LASF806:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2174:
+	.string	"INADDR_DUMMY ((in_addr_t) 0xc0000008)"
+.LASF2274:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF763:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF847:
+	.string	"__lldiv_t_defined 1"
+.LASF1653:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1246:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1242:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1859:
+	.string	"MSG_BATCH MSG_BATCH"
+.LASF1630:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1851:
+	.string	"MSG_FIN MSG_FIN"
+.LASF738:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF985:
+	.string	"EROFS 30"
+.LASF2099:
+	.string	"IPV6_RECVORIGDSTADDR IPV6_ORIGDSTADDR"
+.LASF2299:
+	.string	"__uint32_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF832:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF2460:
+	.string	"data"
+.LASF1090:
+	.string	"errno (*__errno_location ())"
+.LASF1042:
+	.string	"EUSERS 87"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1098:
+	.string	"USE_CLI "
+.LASF2093:
+	.string	"IPV6_RECVTCLASS 66"
+.LASF1028:
+	.string	"EDOTDOT 73"
+.LASF1636:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1033:
+	.string	"EREMCHG 78"
+.LASF1634:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF987:
+	.string	"EPIPE 32"
+.LASF2110:
+	.string	"IPV6_PMTUDISC_DO 2"
+.LASF2432:
+	.string	"baudRate"
+.LASF1740:
+	.string	"PF_CAN 29"
+.LASF1671:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2081:
+	.string	"IPV6_RECVHOPLIMIT 51"
+.LASF2283:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1050:
+	.string	"EOPNOTSUPP 95"
+.LASF1771:
+	.string	"AF_ROSE PF_ROSE"
+.LASF1167:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF798:
+	.string	"__need_wchar_t "
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1106:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1516:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF824:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF2436:
+	.string	"txBuffer"
+.LASF803:
+	.string	"_T_WCHAR "
+.LASF1272:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1582:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2016:
+	.string	"MCAST_INCLUDE 1"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF982:
+	.string	"EFBIG 27"
+.LASF1086:
+	.string	"ENOTRECOVERABLE 131"
+.LASF1840:
+	.string	"__ss_aligntype unsigned long int"
+.LASF1128:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1219:
+	.string	"_STDDEF_H_ "
+.LASF1320:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2088:
+	.string	"IPV6_RECVDSTOPTS 58"
+.LASF1338:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1687:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2499:
+	.string	"pthread_mutex_init"
+.LASF744:
+	.string	"_IOLBF 1"
+.LASF1688:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1005:
+	.string	"ENOCSI 50"
+.LASF1022:
+	.string	"ENOLINK 67"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1672:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1257:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF929:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF948:
+	.string	"_ALLOCA_H 1"
+.LASF2075:
+	.string	"IPV6_RECVERR_RFC4884 31"
+.LASF1420:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2131:
+	.string	"IPPROTO_RSVP IPPROTO_RSVP"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2047:
+	.string	"IP_DEFAULT_MULTICAST_LOOP 1"
+.LASF2242:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF2116:
+	.string	"IPV6_RTHDR_LOOSE 0"
+.LASF727:
+	.string	"_____fpos_t_defined 1"
+.LASF2402:
+	.string	"OWNER_RX_BIND"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1135:
+	.string	"VTX_CONTROL "
+.LASF2477:
+	.string	"serv"
+.LASF1576:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2405:
+	.string	"OWNER_TRANSPONDER"
+.LASF2041:
+	.string	"IP_PMTUDISC_DO 2"
+.LASF1753:
+	.string	"PF_QIPCRTR 42"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF810:
+	.string	"___int_wchar_t_h "
+.LASF1422:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1046:
+	.string	"EPROTOTYPE 91"
+.LASF1713:
+	.string	"PF_AX25 3"
+.LASF1368:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1870:
+	.string	"_EXTERN_INLINE __extern_inline"
+.LASF1488:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1742:
+	.string	"PF_BLUETOOTH 31"
+.LASF785:
+	.string	"__f32(x) x ##f32"
+.LASF1226:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF804:
+	.string	"__WCHAR_T "
+.LASF2130:
+	.string	"IPPROTO_IPV6 IPPROTO_IPV6"
+.LASF1941:
+	.string	"SO_BPF_EXTENSIONS 48"
+.LASF1548:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2417:
+	.string	"SERIAL_INVERTED"
+.LASF853:
+	.string	"__u_char_defined "
+.LASF2218:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2442:
+	.string	"serialPortVTable"
+.LASF1806:
+	.string	"AF_MCTP PF_MCTP"
+.LASF2333:
+	.string	"_freeres_buf"
+.LASF2196:
+	.string	"IN6_IS_ADDR_LOOPBACK(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == htonl (1); }))"
+.LASF852:
+	.string	"_SYS_TYPES_H 1"
+.LASF1761:
+	.string	"AF_FILE PF_FILE"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2191:
+	.string	"ntohl(x) __bswap_32 (x)"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF913:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2418:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2419:
+	.string	"SERIAL_STOPBITS_2"
+.LASF2142:
+	.string	"IPPROTO_MPLS IPPROTO_MPLS"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2414:
+	.string	"portMode_t"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1274:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1934:
+	.string	"SCM_WIFI_STATUS SO_WIFI_STATUS"
+.LASF1149:
+	.string	"U_ID_1 1"
+.LASF2005:
+	.string	"IP_MSFILTER 41"
+.LASF1148:
+	.string	"U_ID_0 0"
+.LASF854:
+	.string	"__ino_t_defined "
+.LASF2284:
+	.string	"_VA_LIST_ "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1762:
+	.string	"AF_INET PF_INET"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2325:
+	.string	"_cur_column"
+.LASF1828:
+	.string	"SOL_NFC 280"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1863:
+	.string	"CMSG_DATA(cmsg) ((cmsg)->__cmsg_data)"
+.LASF1572:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2392:
+	.string	"OWNER_MPU_CS"
+.LASF2395:
+	.string	"OWNER_SPI_CS"
+.LASF1311:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2267:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF765:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1076:
+	.string	"EREMOTEIO 121"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1635:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1210:
+	.string	"USE_I2C"
+.LASF2356:
+	.string	"__list"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2095:
+	.string	"IPV6_AUTOFLOWLABEL 70"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1161:
+	.string	"MAG "
+.LASF2254:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2125:
+	.string	"IPPROTO_PUP IPPROTO_PUP"
+.LASF1573:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2018:
+	.string	"IP_PKTINFO 8"
+.LASF1279:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF2330:
+	.string	"_codecvt"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF764:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2426:
+	.string	"serialReceiveCallbackPtr"
+.LASF1654:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1074:
+	.string	"ENAVAIL 119"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1945:
+	.string	"SO_ATTACH_REUSEPORT_CBPF 51"
+.LASF1894:
+	.string	"SOL_SOCKET 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1235:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF849:
+	.string	"EXIT_FAILURE 1"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF960:
+	.string	"EIO 5"
+.LASF2080:
+	.string	"IPV6_PKTINFO 50"
+.LASF828:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1070:
+	.string	"EINPROGRESS 115"
+.LASF2063:
+	.string	"IPV6_MULTICAST_LOOP 19"
+.LASF1954:
+	.string	"SO_ZEROCOPY 60"
+.LASF1982:
+	.string	"__osockaddr_defined 1"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF2475:
+	.string	"DYAD_EVENT_TICK"
+.LASF2318:
+	.string	"_IO_backup_base"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1280:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1108:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1500:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"_IO_read_ptr"
+.LASF1901:
+	.string	"SO_SNDBUF 7"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1465:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF746:
+	.string	"BUFSIZ 8192"
+.LASF2424:
+	.string	"SERIAL_BIDIR_OD"
+.LASF986:
+	.string	"EMLINK 31"
+.LASF1262:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF2364:
+	.string	"OWNER_FREE"
+.LASF1779:
+	.string	"AF_ASH PF_ASH"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF2446:
+	.string	"serialRead"
+.LASF845:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2523:
+	.string	"tcpReconfigure"
+.LASF1479:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2286:
+	.string	"_VA_LIST_T_H "
+.LASF742:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1088:
+	.string	"EHWPOISON 133"
+.LASF2332:
+	.string	"_freeres_list"
+.LASF730:
+	.string	"____FILE_defined 1"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2481:
+	.string	"connected"
+.LASF919:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF2037:
+	.string	"IP_RECVFRAGSIZE 25"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2427:
+	.string	"serialPort_s"
+.LASF2453:
+	.string	"serialPort_t"
+.LASF2365:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2479:
+	.string	"txLock"
+.LASF2062:
+	.string	"IPV6_MULTICAST_HOPS 18"
+.LASF1443:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"PF_IUCV 32"
+.LASF2488:
+	.string	"pthread_mutex_unlock"
+.LASF2445:
+	.string	"serialTotalTxFree"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1772:
+	.string	"AF_DECnet PF_DECnet"
+.LASF2231:
+	.string	"__sched_priority sched_priority"
+.LASF1837:
+	.string	"__SOCKADDR_COMMON(sa_prefix) sa_family_t sa_prefix ##family"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2171:
+	.string	"INADDR_ANY ((in_addr_t) 0x00000000)"
+.LASF1251:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2212:
+	.string	"SCHED_FIFO 1"
+.LASF2228:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF2425:
+	.string	"SERIAL_BIDIR_PP"
+.LASF983:
+	.string	"ENOSPC 28"
+.LASF927:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1861:
+	.string	"MSG_FASTOPEN MSG_FASTOPEN"
+.LASF1425:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF950:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1371:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2324:
+	.string	"_old_offset"
+.LASF1871:
+	.string	"SCM_RIGHTS SCM_RIGHTS"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1227:
+	.string	"___int_ptrdiff_t_h "
+.LASF1710:
+	.string	"PF_UNIX PF_LOCAL"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"ENOTDIR 20"
+.LASF1912:
+	.string	"SO_PASSCRED 16"
+.LASF2082:
+	.string	"IPV6_HOPLIMIT 52"
+.LASF2301:
+	.string	"__off_t"
+.LASF995:
+	.string	"ELOOP 40"
+.LASF1675:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2223:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1537:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1951:
+	.string	"SO_COOKIE 57"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1776:
+	.string	"AF_NETLINK PF_NETLINK"
+.LASF1791:
+	.string	"AF_TIPC PF_TIPC"
+.LASF1704:
+	.string	"SOCK_DCCP SOCK_DCCP"
+.LASF887:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1189:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1125:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF916:
+	.string	"NFDBITS __NFDBITS"
+.LASF2341:
+	.string	"long long int"
+.LASF1019:
+	.string	"ENONET 64"
+.LASF1759:
+	.string	"AF_LOCAL PF_LOCAL"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF2476:
+	.string	"port"
+.LASF1304:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1716:
+	.string	"PF_NETROM 6"
+.LASF2323:
+	.string	"_flags2"
+.LASF2415:
+	.string	"portOptions_t"
+.LASF1913:
+	.string	"SO_PEERCRED 17"
+.LASF2176:
+	.string	"INADDR_LOOPBACK ((in_addr_t) 0x7f000001)"
+.LASF1067:
+	.string	"EHOSTDOWN 112"
+.LASF2388:
+	.string	"OWNER_SDCARD_CS"
+.LASF839:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1928:
+	.string	"SO_PASSSEC 34"
+.LASF2480:
+	.string	"rxLock"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF736:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1336:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1875:
+	.string	"__struct_group_tag(TAG) TAG"
+.LASF1334:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2152:
+	.string	"IPPROTO_MH IPPROTO_MH"
+.LASF1035:
+	.string	"ELIBBAD 80"
+.LASF2033:
+	.string	"IP_MINTTL 21"
+.LASF941:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2253:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1169:
+	.string	"USE_UART1 "
+.LASF829:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1324:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2025:
+	.string	"IP_MTU 14"
+.LASF1657:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1830:
+	.string	"SOL_TLS 282"
+.LASF1543:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1029:
+	.string	"EBADMSG 74"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF959:
+	.string	"EINTR 4"
+.LASF2056:
+	.string	"IPV6_2292HOPLIMIT 8"
+.LASF1020:
+	.string	"ENOPKG 65"
+.LASF1991:
+	.string	"IP_TOS 1"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1381:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2234:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF1244:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2112:
+	.string	"IPV6_PMTUDISC_INTERFACE 4"
+.LASF1238:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1024:
+	.string	"ESRMNT 69"
+.LASF1084:
+	.string	"EKEYREJECTED 129"
+.LASF1554:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1177:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF944:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2266:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF1109:
+	.string	"USE_SERIALRX_SUMH "
+.LASF840:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF957:
+	.string	"ENOENT 2"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1414:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"long unsigned int"
+.LASF1312:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF743:
+	.string	"_IOFBF 0"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1256:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1134:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1137:
+	.string	"VTX_TRAMP "
+.LASF1063:
+	.string	"ESHUTDOWN 108"
+.LASF1080:
+	.string	"ECANCELED 125"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2070:
+	.string	"IPV6_V6ONLY 26"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2272:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF2083:
+	.string	"IPV6_RECVHOPOPTS 53"
+.LASF1847:
+	.string	"MSG_TRUNC MSG_TRUNC"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1207:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1509:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1679:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2069:
+	.string	"IPV6_RECVERR 25"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2137:
+	.string	"IPPROTO_ENCAP IPPROTO_ENCAP"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1971:
+	.string	"SO_RESERVE_MEM 73"
+.LASF1814:
+	.string	"SOL_IRDA 266"
+.LASF2443:
+	.string	"serialWrite"
+.LASF2320:
+	.string	"_markers"
+.LASF1892:
+	.string	"SIOCGSTAMP_OLD 0x8906"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2066:
+	.string	"IPV6_ROUTER_ALERT 22"
+.LASF2180:
+	.string	"INADDR_ALLSNOOPERS_GROUP ((in_addr_t) 0xe000006a)"
+.LASF2490:
+	.string	"dyad_write"
+.LASF2028:
+	.string	"IP_XFRM_POLICY 17"
+.LASF1723:
+	.string	"PF_NETBEUI 13"
+.LASF1811:
+	.string	"SOL_PACKET 263"
+.LASF1171:
+	.string	"USE_UART3 "
+.LASF1079:
+	.string	"EMEDIUMTYPE 124"
+.LASF1103:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1559:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1937:
+	.string	"SO_LOCK_FILTER 44"
+.LASF1374:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1920:
+	.string	"SO_SECURITY_ENCRYPTION_NETWORK 24"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1856:
+	.string	"MSG_NOSIGNAL MSG_NOSIGNAL"
+.LASF1154:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1289:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1025:
+	.string	"ECOMM 70"
+.LASF1313:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1775:
+	.string	"AF_KEY PF_KEY"
+.LASF1970:
+	.string	"SO_BUF_LOCK 72"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2391:
+	.string	"OWNER_BARO_CS"
+.LASF2154:
+	.string	"IN_CLASSA_NET 0xff000000"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2044:
+	.string	"IP_PMTUDISC_OMIT 5"
+.LASF2127:
+	.string	"IPPROTO_IDP IPPROTO_IDP"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1702:
+	.string	"SOCK_RDM SOCK_RDM"
+.LASF2103:
+	.string	"IPV6_FREEBIND 78"
+.LASF2507:
+	.string	"tcpRead"
+.LASF1069:
+	.string	"EALREADY 114"
+.LASF1172:
+	.string	"USE_UART4 "
+.LASF2117:
+	.string	"IPV6_RTHDR_STRICT 1"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF898:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1690:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1763:
+	.string	"AF_AX25 PF_AX25"
+.LASF1016:
+	.string	"ENODATA 61"
+.LASF1110:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1683:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1594:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1757:
+	.string	"PF_MAX 46"
+.LASF2458:
+	.string	"stream"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1258:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2109:
+	.string	"IPV6_PMTUDISC_WANT 1"
+.LASF1621:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"_SS_SIZE 128"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1326:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF2270:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1558:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2370:
+	.string	"OWNER_ADC"
+.LASF2296:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2396:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1777:
+	.string	"AF_ROUTE PF_ROUTE"
+.LASF1643:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1691:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1660:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1173:
+	.string	"USE_UART5 "
+.LASF2326:
+	.string	"_vtable_offset"
+.LASF1737:
+	.string	"PF_LLC 26"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1785:
+	.string	"AF_PPPOX PF_PPPOX"
+.LASF1883:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF1709:
+	.string	"PF_LOCAL 1"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF915:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1895:
+	.string	"SO_DEBUG 1"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1203:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1357:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2373:
+	.string	"OWNER_ADC_EXT"
+.LASF1926:
+	.string	"SO_ACCEPTCONN 30"
+.LASF1504:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1661:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2366:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1245:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2393:
+	.string	"OWNER_OSD_CS"
+.LASF2105:
+	.string	"IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1068:
+	.string	"EHOSTUNREACH 113"
+.LASF1647:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1294:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF843:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1527:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1071:
+	.string	"ESTALE 116"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1417:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1893:
+	.string	"SIOCGSTAMPNS_OLD 0x8907"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1323:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF968:
+	.string	"EACCES 13"
+.LASF2114:
+	.string	"SOL_IPV6 41"
+.LASF2074:
+	.string	"IPV6_ROUTER_ALERT_ISOLATE 30"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1663:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF2000:
+	.string	"IP_DROP_MEMBERSHIP 36"
+.LASF997:
+	.string	"ENOMSG 42"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2624:
+	.string	"posix_types_64.h"
+.LASF2549:
+	.string	"thread-shared-types.h"
+.LASF2559:
+	.string	"errno.h"
+.LASF2540:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2542:
+	.string	"/usr/include"
+.LASF2582:
+	.string	"stdio_lim.h"
+.LASF2584:
+	.string	"floatn-common.h"
+.LASF2563:
+	.string	"stdint.h"
+.LASF0:
+	.string	"./src/main/drivers/serial_tcp.c"
+.LASF2639:
+	.string	"pthread_stack_min.h"
+.LASF2625:
+	.string	"bitsperlong.h"
+.LASF2526:
+	.string	"src/main/build"
+.LASF2539:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2578:
+	.string	"__fpos_t.h"
+.LASF2631:
+	.string	"time.h"
+.LASF2567:
+	.string	"wordsize.h"
+.LASF2630:
+	.string	"cpu-set.h"
+.LASF2531:
+	.string	"src/main/target/SITL"
+.LASF2551:
+	.string	"pthreadtypes.h"
+.LASF2614:
+	.string	"io.h"
+.LASF2564:
+	.string	"libc-header-start.h"
+.LASF2591:
+	.string	"timer_t.h"
+.LASF2637:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2608:
+	.string	"platform.h"
+.LASF2543:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2579:
+	.string	"__mbstate_t.h"
+.LASF2629:
+	.string	"struct_sched_param.h"
+.LASF2621:
+	.string	"socket_type.h"
+.LASF2554:
+	.string	"resource.h"
+.LASF2605:
+	.string	"stdlib-bsearch.h"
+.LASF2536:
+	.string	"/usr/include/netinet"
+.LASF2589:
+	.string	"clockid_t.h"
+.LASF2611:
+	.string	"build_config.h"
+.LASF2561:
+	.string	"stdc-predef.h"
+.LASF2572:
+	.string	"stubs-64.h"
+.LASF2592:
+	.string	"endian.h"
+.LASF2553:
+	.string	"dyad.h"
+.LASF2565:
+	.string	"features.h"
+.LASF2556:
+	.string	"serial_tcp.c"
+.LASF2548:
+	.string	"FILE.h"
+.LASF2530:
+	.string	"src/main/io"
+.LASF2574:
+	.string	"time64.h"
+.LASF2636:
+	.string	"setjmp.h"
+.LASF2555:
+	.string	"serial_tcp.h"
+.LASF2627:
+	.string	"struct_osockaddr.h"
+.LASF2535:
+	.string	"/usr/include/linux"
+.LASF2633:
+	.string	"struct_itimerspec.h"
+.LASF2566:
+	.string	"features-time64.h"
+.LASF2603:
+	.string	"struct_rwlock.h"
+.LASF2594:
+	.string	"byteswap.h"
+.LASF2571:
+	.string	"stubs.h"
+.LASF2586:
+	.string	"waitflags.h"
+.LASF2560:
+	.string	"target.h"
+.LASF2616:
+	.string	"io_def.h"
+.LASF2609:
+	.string	"common_fc_pre.h"
+.LASF2587:
+	.string	"waitstatus.h"
+.LASF2575:
+	.string	"wchar.h"
+.LASF2568:
+	.string	"timesize.h"
+.LASF2527:
+	.string	"src/main/common"
+.LASF2541:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2620:
+	.string	"struct_iovec.h"
+.LASF2590:
+	.string	"time_t.h"
+.LASF2628:
+	.string	"sched.h"
+.LASF2546:
+	.string	"stddef.h"
+.LASF2632:
+	.string	"struct_tm.h"
+.LASF2583:
+	.string	"floatn.h"
+.LASF2525:
+	.string	"lib/main/dyad"
+.LASF2602:
+	.string	"atomic_wide_counter.h"
+.LASF2613:
+	.string	"parameter_group.h"
+.LASF2638:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2580:
+	.string	"__fpos64_t.h"
+.LASF2617:
+	.string	"io_def_generated.h"
+.LASF2626:
+	.string	"sockios.h"
+.LASF2623:
+	.string	"posix_types.h"
+.LASF2595:
+	.string	"uintn-identity.h"
+.LASF2607:
+	.string	"errno-base.h"
+.LASF2635:
+	.string	"__locale_t.h"
+.LASF2619:
+	.string	"socket.h"
+.LASF2593:
+	.string	"endianness.h"
+.LASF2545:
+	.string	"stdint-uintn.h"
+.LASF2558:
+	.string	"stdio.h"
+.LASF2588:
+	.string	"clock_t.h"
+.LASF2547:
+	.string	"struct_FILE.h"
+.LASF2570:
+	.string	"long-double.h"
+.LASF2569:
+	.string	"cdefs.h"
+.LASF2577:
+	.string	"stdarg.h"
+.LASF2612:
+	.string	"utils.h"
+.LASF2573:
+	.string	"typesizes.h"
+.LASF2534:
+	.string	"/usr/include/asm-generic"
+.LASF2622:
+	.string	"sockaddr.h"
+.LASF2610:
+	.string	"common_fc_post.h"
+.LASF2634:
+	.string	"locale_t.h"
+.LASF2532:
+	.string	"src/main/target"
+.LASF2557:
+	.string	"pthread.h"
+.LASF2618:
+	.string	"in.h"
+.LASF2529:
+	.string	"src/main/drivers"
+.LASF2562:
+	.string	"stdbool.h"
+.LASF2597:
+	.string	"sigset_t.h"
+.LASF2552:
+	.string	"serial.h"
+.LASF2606:
+	.string	"stdlib-float.h"
+.LASF2585:
+	.string	"stdlib.h"
+.LASF2581:
+	.string	"__FILE.h"
+.LASF2600:
+	.string	"struct_timespec.h"
+.LASF2599:
+	.string	"struct_timeval.h"
+.LASF2576:
+	.string	"stdint-intn.h"
+.LASF2604:
+	.string	"alloca.h"
+.LASF2596:
+	.string	"select.h"
+.LASF2538:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2528:
+	.string	"src/main/config"
+.LASF2544:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2550:
+	.string	"struct_mutex.h"
+.LASF2533:
+	.string	"src/main"
+.LASF2601:
+	.string	"pthreadtypes-arch.h"
+.LASF2615:
+	.string	"io_types.h"
+.LASF2537:
+	.string	"/usr/include/x86_64-linux-gnu/asm"
+.LASF2598:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`4\001\325\t"
+	.string	"\362L26P\215\322\030\300E\301\317\236\221\0161J\276\220V\b=F\266\370\002\256\356\241\216\343\001\030\200\231\252\252\252\252\252\212\252\242\335u\333\222\317m\271-\331{\023\262e\332$\025\326\371t \315\366\246\315P\211\023\312\\9#\245\321\266/\034"
+	.string	"\351P\030y"
+	.string	"\021\202\240\325\035\243\275\327\313\001+\342&R\227-\t\022\206)\203"
+	.string	"\221\201\363\024PJ9\"\036H\226\354l:\335\016\025\013\016\203T\304\200@c\312\272\342\260`\"w\313W\035\211NR\342\033\373=\257\232qJ\241\256\367\206\233\330\225xTX\362\003\205\342\004\261\316\247\003m<^\322\232O\271\365fz\022\032H\342\361\375z\267\336\341\376\357\352\355)\\\2306*M\265@1 P\002B\251\254\003\023\002p^4\306\224\261?\320\246\\\n\263\221\007\327\265\021`\205a\202\340p\230dv\b\b\203\301\302\202q|\305\246\2519p\013\300\304\266-\360\021\3228bb\020 \"\306SP\270\273X\334\357\225\314fSB\204\bX\310\225"
+	.string	"\005V#\300#\220\022\300y\016,\034\333\305\002[\347\324\353\321\202S\253\236"
+	.ascii	"\205s\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\005\005"
+	.ascii	"\202\206\023\033\220)\351\377\377\177|@\273\273\273\273\370\306"
+	.ascii	"\376\217\376\003\377\b5\022\333\b\3312\245\356\256\265$5\217"
+	.ascii	"\037\0221[\354\021\007W\207P\016\004/\240$T\002\352\323HSl\304"
+	.ascii	"P\226X\235\354\314F\317\376\232r\333\023d\030!\267\354-\270#"
+	.ascii	"% \260\202\261!\363v\354s\225A\254\001\327\021\354\016;V\223"
+	.ascii	"\205\rD\240\021\005\002\272Y[L{\361\206\241\361\326l\240?6\254"
+	.ascii	"4\301g\304\002F\027V\214{\257<\243\354\202\001F\321\027\016i"
+	.ascii	"5\033\1775\215Yy\013\227\361y\230Y1\207"
+	.text
+	.section	.gnu.lto_.inline.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`^\004\005\023"
+	.string	"\266YZC\020\221\223\306PX\240\276\367\2510OX\255\363\217\360\220\233j\021#0>\334?uo\224\302\275#\270\237m"
+	.string	"\024Wt\265\215\004"
+	.string	"\371|"
+	.string	"\021@\021\212\214c\007\032\353\252\275Y#F\024\004\021\262\267\224)A"
+	.string	"C"
+	.string	"M"
+	.string	"!\\h\340\212\f\227\223\246\202\243\205\212\003\360\207\232\037\315\324\323\244\035\b\216\344\227U\204\372E(\353\337\\\361\2706\310u\335tw\367z\222\332\330\335P<\001\334\243y\236%\270bwA\277\331Z\020c\036?R\224\335\325B`vws\007\207\263b\030\205\335\265\360\330\372\301\001\300\205\303\263\244&\273\373\361\365HEZbT\332\223\240\247*a)`\242[\245\020l\245j1S\37530\343\257\2616\215I\021o\361L\311\217J8\200V\310;R\301\365\321\b4j\220\220\b\255\371\035\250~np-\207\307u\035\025\217\3730"
+	.string	"\336P\225\264\0308\303u+\016\331\210\307u\236\324\210\307y\316\262/\004\362\007\366[D\361\200y\004Q<P\f\273\333\t\217eI_\270\244t\310\274\t\232\234\210\001C\200*\004=a\221\341%dO\334\364\333]+A\330\352\203'\203\013\244\023\326\223\0047\234R\037v'3\025\271\336\244'\0274\314"
+	.string	"\231\240\210\225\022,\234A\026\241b$\351\b\017\252\023\2019\001p\250\201\275A3SA\244Ia\2265`\002\231\031\263\362\022`UI\"!\222\210dFK\3131\fsL\300\002^N\342\245\257O\251D\203\351\221\201\326\335\007\362\332rbcfs!\232U\t\3527\220\215\222\274M\214\211Y\032\366!Qo\227S\b\334\267_\210\311\004ZB\356{"
+	.string	"\276T\234\004\243\273\217\322\tp\240\370\006\022\371'F\365\022\330?"
+	.string	"\242\237\231\323\367\366\213\003R`4\327T\277\257\210\006$H\315\252+\013\030p'U\210+}\001e-\373\312\2444`\211\315\252\327\b\300@P\253}&\240\201"
+	.ascii	"{\344\251-f\373\351\343\020\231\020\f\320\001\357\201\r\2413"
+	.ascii	"\207\365\037pg\344D8\331\240\371\276\220\3566D\310%*n\3373r\317"
+	.ascii	"\205\265\270~D\214&\326=\306\264E\235\376\220*E\354\326`\356"
+	.ascii	"Y_\246\356TV\212G\371\234\327\366\342\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\225\006-\024"
+	.string	"FZ]C\020\2176\035"
+	.string	""
+	.string	"\002"
+	.string	"\210\200BPm`\2742"
+	.string	"\222\004"
+	.string	""
+	.string	""
+	.string	"d\261W\341\363s\373\177<\315w\202$\\\327\271\217&\354@\201\214\264A\025\372\2356\003\374^\240\315\214ml\366\003\361\335k\333\226)\005B"
+	.string	"I"
+	.string	"J"
+	.ascii	"\037#\356\030Qd\262A\n\022uC\244'!\363}\337\367\257\370W\256"
+	.ascii	"7IDz\006\344F\027\352f~U\303\357\273\341\367\375H\374G\242\336"
+	.ascii	"\202\364~A{u*\371S\351vu5\374\235q\213\035Q\004\235\215)\321"
+	.ascii	"u$\026L\026E\255\213\277\305\031\\.\362\322\321qM\324\bW\025"
+	.ascii	"\322\273\211\013J\033\364\342\267l\351\270]\211*e\224\344d\257"
+	.ascii	"\227\205\364L.\030\355\316u\332i\377e\021\241\t\024"
+	.string	"\252V\025E\352\272\024\372\375\003\035\314\232\023F\326II\005\f\033L.\200\240h\274\321\325\240\360\037\026\360N\n\365\360\327 \340\375\004A\367\201\256\003\335Kw\243K}\277`\354\001\336\037\nh\240\273\021`\243\002 \257\007t\341Oycd\271\240\236\260a|F\2560kv6nn\234&J\311\266\215K\231\0372\022\217\f!$(\032W\034,\013\241}<\032\b\314\223\205>\236\351A\3638\341\230\037S\244m\332$e\242Q\207\251\241\204\303\025\002W\034\016\226}4\217\312\234!Ne\216\254)\nq\240\211m\032\007\005\2560+x\2501M\243\330\210\210\220\244 \231\306\200\002\221\262\"z\022\300\341A\212\002I\f\001\231affdd\302\362J\361Z\310\237\245\222\340;[A\3372g\337\260\263QF\236@\300+o-\207\302\304\206\202\204J\325\032\211h\225t\213\026\303`\354\177\002\370\t\341Vw"
+	.string	"'\333kzgC:\270\330\251\223^h\032\210{\bw\303K\026\225\341\374\202V_\207zV\202\230l\316\235\310\271\017\320\211p\227v]\243A\023\231\361\024\335)\006\r7\261\234_\033\236_\256}\245\260\233\266$|I\234\236\026\313\252\312Ks\177\0049L\327~\273\253\214\340\026\301&\277:\244\313\rr\274\t\220\026\270\364\333\0359\251\200u\352]\321m!\030\342\322"
+	.ascii	"P#\r\\\206\317\210Y\265\321\n\264\216\352:\212\330}\304\033C"
+	.ascii	"\311u\234\224u\021B(QZ3\211}\347=\220\020U\224\361\343\f\323"
+	.ascii	"\266\023'\247z\205@\323\303\261\201\216^;\022\365\252\275\271"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.pureconst.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\232\004\013\232\004\f\232\004\r\204\004\016"
+	.ascii	"\232\004\021\231\004\022\231\004\023\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\243\001\025\t"
+	.string	"2\215%'\200)I\007:#a\037\031\030"
+	.string	"\2145!2\"#\312\3777ki\0212\034\320\326j\037\366\321\177\004\362\211\265[\312\024\243'\202X6\306\177\b\277z\260\320\251\320\231\320\251t6:\033\212.P\226\234\021\240\247\322\016\240\225\262\210\300\317"
+	.string	"\311%\245x\247\2547J\200\336R\245\354alG\211~:\274*\236&\362b\221&\016\220\246\224&\211\227S;E<M\371\352d\312\231r\206&~:\235M'\244\366*\237\217\362G\347\352\3159\243\334Q\373\027np\037\002C\2501Q\346\250\250\240F\2515\220\202\031\252\353\006\021\200\261\201\260\244ia\231\003P\"W<\304\006%k4\2469\304\016\360\212\216\316 \017d\334G\2573\3633\241\242b\246\027\255\302\036\305)\2370\335G\031\027\366y"
+	.ascii	"L\362~\207\020\024\314\344\353\217\265\212\353z\016\022:A\235"
+	.ascii	"\220F\004\002.B\2424\232\274\320\025V\370I\315\353W\005/*\241"
+	.ascii	"\272\233\227\216\347\323\275o\274\267*:\322N{3\037\341\250W\002"
+	.ascii	"?\272O"
+	.text
+	.section	.gnu.lto_.lto.f77dd2d6946c2cc6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.34.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375 \300\375\004"
+	.string	"\204\b\206"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{\212\001\202\200\200\374\342\303\327\204\013ywu\274\236\264\245/sq\270\326\344\007om\370\325\224\tok\270\325\204\007ig"
+	.string	"?\202\210\200\320\001ec\303\001a\302\001_\301\001]\300\001[\277\001Y\276\001W\275\001U\274\001S\273\001Q\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\t"
+	.ascii	"\200\224\230\244\310$\006\352\312\031\017\202\201\023)V\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_tcpIsStart.38.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375 \357\245\006"
+	.string	"\222\214.3`O\322\030p \273\262\307\025\025\270\240\b\r\027o\031\345\245\037^\300h\ri\233Q\264}\343TW\222\344\020\004\b\262\353U\306K"
+	.string	"\364\035'HJ\231\002SS\206\322(0`\254Wa\016{\325\203\365\026\234\203\205ip\324\303\334t\371\312T\317i\256\3539i[TP\352\305\243\021\217\037\b\222\215\034Cl\0225\214\306M"
+	.string	"F\251\003'\030\236\f\035el\262\374\326I\325x\004X\005\375yj\222\240\211\312.E\250eK\"\221\216\237\363\322\007\b\2343\002\tE\031\231\bY\331\335\234n`\206\231\215\350\201\005\027)\332\247\203)\220\260\273\247\366\261\300\025\177\203\177\372+\002\b"
+	.ascii	"2\001\0038\003Z\034\240k\370\\\304@B\344q7:\355$\003"
+	.text
+	.section	.gnu.lto_onData.39.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\365\013"
+	.string	"\006\227RC\020o\225\016\300\003ZS_\r\214\022\246Ig\370]\377\f\251\260\237\323\320\031\200\221\350S\240\2069\267\231\205\020\226\313+)3"
+	.string	""
+	.string	"\210\222"
+	.string	"\352\377_M[\023R4k\251s\255\370xw~\264\311\336)\005<"
+	.string	">"
+	.string	"B"
+	.ascii	"\244"
+	.string	"c\354\256^ v\253\210\351\366\351z\215\311\347\366\214\311\247C;\305+kIH4\360\260bw\251\244\360\3601\364\357z\005\225*=R8\273\353\210JA\270\345m\177\330\006`\237@\273k\271\262_\357\371\326\257i\321QF\2372a&\216a\266\373`\326bcS\304\205\327\337\016}\227-\227\t\031\273.\340\234\034t2\310T\354\326\220Ow|\211\220y\264\257\341\033\302\267\002*\006\262d\333\373K\301\026%G\005\033\301?\030v\026\310ee\304\224\257/Q\231\f\276\203Ql\273\273\3619\214\022t\310,|\372\244\311\347\224\027'Z\2468s%D\211\215,\354Z\212R\202}m\003\340\235\021\300i4\233\021\rf\243\2739L\210\023\0050\340\371|\035H\301\257\033}\276\001\364\300\307\003\242\334\007R\214\207\275P\367Q\221\347}\324R\367\332\312\225',f\222'[\342e\224S\332\005@\361(\317\023"
+	.ascii	"0\223\241\214i\3123L\334\276\026\366=*\211Q\355\200\276W\221"
+	.ascii	"\001s\275:n\252\005\272\306\346t\315\276\2300\033E\240D\205\036"
+	.ascii	"wx\321N2"
+	.text
+	.section	.gnu.lto_onClose.40.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\266\002}\024"
+	.string	"&\346\204F\320Rg8\"\206\372\217\2115Jn\273r\267s$\236\325\230DK\3151\017\326c\334\373Q\201\307\244O\0022\017\016 \244\006\260C\322\235\034\212i\2274\036U\221\210\370t\007R\346\371T]\330\272\t\331{K\231Rm"
+	.string	"f"
+	.string	"s"
+	.string	"M\036A\341\320b\217>1\273\r2&zT\355\216\005\016Z\306(\333\362\264\177\342(rg\3729\200\335\243\025/vG\003\026]\007=>@x\320\365\222\360\240s\366\217\217I\013\303c\350I\310\356\212*\342\271\177\2329\277\025\363\342\021\351\376\201\270\306\210\202\276\224\335}\323\263\003\321.\263\025\263\273N\036\321\207\033\274\355\005\266)\330\n\006\327\277lH\305\364\343\021\204"
+	.ascii	"\262\316U\330\207kw_|\247\231m\300\224\322A\377'<\030\323\030"
+	.ascii	"\025\023P\366\354`\304\262\332\314\262G]*\222\375ow\327zd\177"
+	.ascii	"\274cg\372I4\rk\245__\332\365\245[a:\374\322 \230\376\276\264"
+	.ascii	"j:5\375\022q\t\353\352P9v=\364\210\254\0160\006"
+	.string	"\211\217\277\375\007FJ\273B\347\315\270\204\030\020\260i$\344y\376\266Hu\366e|F\006_\311\023j\362\274\232\360\340K_E+o\251\013*\324\226~\310\3460nB\315\251OA\375nGT\021 \234\273\350\371TK\030\215`JU\375P\221*,\253=-\264eoA#I\272\302\221\312\342\347Yi\257\367ZxM\315'!\243]\366lWxT\r*\307\202\313'<\030\206\315TVf*)0=*\021 $\240\261\231i\240\240\306\004w\267\344\310\\\\^\016\270\260\234\320n\031\313\216\214\347\346\002N\355F\303\211\270\033MC\3556\0231\324ptD\331\r'\262\244\330\266C\273\211<6\333M\034\031\367\337\352\221\270\204U\005\244\273O\221z\302\033\231d\222tE\022D*wW\247\212\344\327B\230\2368Q\005\345\220\0325\230*\020\251\315,\013HU0\305i<\370Q3 `\002\021aU\036"
+	.ascii	"\030N0\335 \206-\326\f\206p\374\n:0\203\232v0\035'\326yK\212"
+	.ascii	"\354\250\225\332\026\264w\\\312\251\311l\352\226\207h\021h\317"
+	.ascii	"\323\304\324\255\344\022<\231O\204F\030\021\370\334\350/\303"
+	.ascii	"\214\220\215\301a\347\360n\251F\027\253\212\342\375\003\316\032"
+	.ascii	"}\227\321\306?\343\013\2162B#2\344\315\232\350qO\203V\t\2152"
+	.ascii	"\273\371\200\005\227\333.\245\007"
+	.text
+	.section	.gnu.lto_onAccept.41.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\026\005\315\035"
+	.string	"\3263\270G\220\234Qc"
+	.string	"\206 c@`\326\022G\026(E'x\363=\231\212P\2432Q+\351\340Mv&`\207\263\305\303p\230L\031\333\201"
+	.string	"\200\346\270\223\223\230\332\033'(\322\007\210\013\033-K-\312\276\3046\331{K\231R\234"
+	.string	"\227"
+	.string	"\253"
+	.string	"d5YV[\262\272\332\352\033 \203\244j\304n%\314\275.\306\332\334-\345\024\037O\177\373\307rM\300\230 ;U1\364\304\202\202\0217f\356M\023\2744\005\013\350\022\364j\377\310\221\240?6}\347\336)'R\356M\025\230w\276t\372\036\363\345y"
+	.ascii	"\346K\2436\231\247T\267A\233(\2554\367^\236\335q\364%i+\352\323"
+	.ascii	"\212N/\245N\006ie\205qR\224\272%\177\214Xb\330\212Pd\017\227"
+	.ascii	"\034c\216\365\332\242\370T\253l\350\336\353J,\302\270\315\333"
+	.ascii	"&\262\335d\227\016\002\304\"\363\245ig3v'm\271e|\252c\266\226"
+	.ascii	"\264\2172z\223\236\265\366\207\321\312V\373\247/L\336\330\276"
+	.ascii	"3A\332\"\372\235*\314\227\267\266\215"
+	.string	"\321j\346\246\013g\237\336\301\r\241G|\211\301\316{\357\002?\213C\211\002^\367\336W\275\364\233\314\2278k\373:\n\353\230\217u2\212\0245a\267\262\261S\247ju\330'\257\235\262\237\336\270\037\377\036Y5\317Y\275#\253\3269\253o\262j\233\254:\307\254\306!\253kd5\255\254\236\311\252O[-3\253M\262\272\fuw\024\t\232d\205u\362\207W9\326\216p0J\257B\f\023\3261/Jg\216\265}\035m\354\276{\255K\302\204s\370\363y\211C\336\031Zph\2666\263\264,3[\275\2065\272|\314+HU\213\0306\244Q\271\316p\301A\2322\272\006\324\323\332\025.@\031\303\255(\335\353v\332\331qK\252\353=\210\306-\326\352\360\221L\231\305e\211\201\252k\250 \311\254\375:\236W/\376\r\246\255\341\\\033~\363\022\033\026kU\362(\035>e\254\272wx\242\207sh\301\307\376"
+	.string	"\242\236\350\\\224u\262\377\344P\226\374*\207(\252\017\246\035\351vG\272\\\203\020\036&d"
+	.ascii	"\021\300\264#]nwB\307\201(B\207\\\0220\227\004\3741"
+	.string	"\365|II\300^.\205/\003\201\245;HDOHh\001\003! \234\357\356\001\231\3501\025\2210\372\005}K\274\245\240\017\305/x\304K\372\031\225\340\365\202K<\240\234\201&|A\036\023\020\030\344\325\322{\362\332){Hh\237\312\237\272\303\243\344A\303#\006ag\310O\275\331+A\255P\037\347\275\302\023ew\025S\307\332\350\025\032$\252\214\322\251pT:`\006{@u\023\242\253\346\272\031\333\240\356\025\"\260\021A\213|)\235\252\307fgG\023\310\201f\250Q8'\241Bc\")Jq\241\r\240\002\021)\253n\021\020=\245\244\033\232\032\351Q])\230\376K\007=\310\326L\002^\310\177F\227\216d\255nq/i\256Y\3651#\344\206\314\317\273\216\251I\244\r\310\004'>\023*\22048\260&+\213*\345\036\b\310\r\370\237\372\300\212\033\330\026\363\005K280\345gM\300\220f\224\375"
+	.ascii	"\021\334\207K\004\247}\350\035lN\022}\203\266I\224\023\362\026"
+	.ascii	"\212\223\201\np9\351\215\022\367\274\221D\317\300+\331b+\t\236"
+	.ascii	"@@E\313\\\355\323\241\327\023Q\334\2506\f\232$\2363\215\346\212"
+	.ascii	"^5\231\235!\242q0J~r\001\350\375\364\341\300\303b\325&\202]\240"
+	.ascii	"\362|\276\211hI\206\312;\263\260\231|\236.\253\001"
+	.text
+	.section	.gnu.lto_tcpReconfigure.42.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`V\b\215,"
+	.string	"zM\f\021C`^N:1\251\0341\007v\230A\343@\257W\230>\323\302f\370\305\030\313\275\355\316W\365\032\201\002m\370~\316\341\352\317\017T\342+Ami\212%\016\016.\255/\r\035\034\206hm\033\221F\b\3312\311\363"
+	.string	"\355"
+	.ascii	"\006\001\301n\006\242\315\277nV\317\346\324l\366u3\2126\237\335"
+	.ascii	"l\236\315\327l\356\333|\b\030\222\204\3740\rj\333\261D\207\332"
+	.ascii	"8\347\335\024f\316\301\fdn\"S\325\315\374\344\273\344\270\027"
+	.ascii	"\306c\265m\225\350\261k\333V\212=\244?W\263i\256\212\373q\354"
+	.ascii	"\215\332\226\211\033\273\266MJ1U\372\223\231\371o\207\313\301"
+	.ascii	"\354R\222\355\307o\016\232\330\034\241\266MRq\362I\350\317\364"
+	.ascii	"G\350\317\333\344\354\205A\340OM}\350i\336f\371^\027\232=\370"
+	.ascii	"+3;pIv\304\\\255\220\031\351\337\337,\231\243\026\201\262BF\244"
+	.ascii	"S_Y\2329v\300\224\r9jB\350\203\306\345K\2623\0238\266\354r\354"
+	.ascii	"\363_h7o\0224J;`\312\314~M\005im\314\212\312\302\314$9K\364\\"
+	.ascii	"\371\346Q\006\326\355\313\320\266-7\262\354\307\271\350\314\314"
+	.ascii	"\206\231\3370\373~\004X\354\366\364,\270IfA\357\032/\270y[45"
+	.ascii	"?\004z/\263\210\021}\244y\327\2603\\\301<$s\211\337\235\220`"
+	.ascii	"\206\205Ca\200\255m\333\267\261\367c\220B\232nM\233\t$'\311\371"
+	.ascii	"k\006GNi\3365\2723\313\243\356K\340Hh\325/w2*\316\226\326\326"
+	.ascii	"\266\307#W\244G\020Q,\254\372H^\305\256\027\363\301<\214\r~\033"
+	.ascii	"_\r\207\350\317\276\352\031\235\231\345\245 \323\342\\\356B\177"
+	.ascii	"\225\224xtt!6\356u]i\333\266\024\370s\247{\301o"
+	.string	"\373\311\304\030}\344O~\f\364\347\357\223\223\273\257N\304W\336\303\225>{zm\033bNz\365]c\276\331^&\314\217\373\241\356\345_\271\371\311lvR\233\233\324f&\265y\311l\036\2406+\251\315Ij3R7\037\245\315\002\272\331(m\016\2206\027\371\232\205fs\3535\272\021\216i`p\023\032\352^\216\005\302\006I\333\366\353\310>\343\241\001\206\260D\022\025\317\246\024\340\252q\276,\016\232\301\321X$\027s+J\362CE<\244\336T3\263kl\223>\262\350VPK\337\324\366\364\212NN\250(d\003dd)\274\314,\224\013b\243\034\251\267^\341\375\234\030\"1\"\313\263UPfv\312\377\260U\220\250|93{\345~\272\236\007@M\317\371t)\261\355y\322\322\376](\037\317\363t\261XX\267>\322\r\375)\314\003\224\272\365\331\323\253\203\267\266\374\271%\201y?F\375\f\322\t\302"
+	.string	"\376\334\324\032x1tT\325\343=U\343\260Z\016'Er#\333\323\033r\246v'\345<joq\276 \226>{z\007\032\275\227\273\033v\013\313%=\302\210b\326\260\341\310\306w\3253\276\232-\306K\371\214\006\375\211\336+\351\204)B\240\231;|@\217<\2570\313\036\025\260\353\305\301\374\203\202:\300?.\004&Hh8\261\032\213.V.\004+\326\fb\013&\022N\374\303B\260J\255X\303,\242\225\213\365\306p\213K\306\232\302\204\023\377\240\260\2068\210YV\304-\342\f\342\332\205e54fY\255Z\304u\313X\244Q"
+	.string	"\213\330\\\325\342\352\301\003\t\023\036L)i\235\257\246h\\m\261\310\262\"\032\207ZTZ\306a\r\242\021\213j\006\321J\006\325\225Q\213jj\345\"\215\241\221j\253X4R\001\223\355\315\3662at\311\224\2722\276\333\375\312sP:\021+cB\335\247\313\203\231\237.g\370\272`B\246\333d\306z\201\245\307\303E\375t*sB~\3516\365\216/]\246\245{4\312\2723\313\340\201N\222\35316L,=^I\324\317\001b\335c\300U\317\224\356\217i`O\200\"\335$\27240\244{1`t\352\020\005\337\370\317\223;?\300\243\253\244\274s\241\177F\227\317\362@\005\370`\307\372\310\243\333a\305\233'@\312+\200\236\250A(\005\035d\206fD\202H\n\222\024s\240\"\0312*\017\021 \255cL\225\220\244$\311\260\006\260"
+	.string	"Z\311\347\033\343\273\262\266\215\302\364)T\002$Y\251Bd\200\003a\206\252\177\024\006w\030\300\201h\375\007\017>,\b\233o\r\230\233jO\225\035\262\354\367z3\255\330\306bL\337\030e\223"
+	.string	"\225R\260\034\034@\303\275\031\220\217.\330e\256\n\241XT\307"
+	.ascii	"AB\220\321\3746a\227\340\017!\007\373\200\006\356\333k,\350\326"
+	.ascii	"\216\f\200f6\344u\243\252(+\260\004E\343Cb\321&\374\034y\224"
+	.ascii	"1@\303\005\211mQ\327g \240\340\"\034\343\335u`j\361\005\022;"
+	.ascii	"\216\032*\300D\272s \272?\270!\036@\370\204Vp\252\276\244($\340"
+	.ascii	"<\033\323\026\345!\332)\211/\002P!\242\2630g\375\212\b/\343S"
+	.ascii	"  #\346\240\361\277ma\243 8\007\3163\025\314\231\255\343\333"
+	.ascii	"\312\226\f\251\255\235L 2\357?`\261\n\035.\240(\\\033\275\206"
+	.ascii	"\037\021@\327>&\357#\007B{\300\275AK~\271\0036\253g\371x@\356"
+	.ascii	"a\363fJ\207\314\030\007\332\361u\237A>4\246\367\nA\n\301\222"
+	.ascii	"IP\212\020A\005"
+	.text
+	.section	.gnu.lto_serTcpOpen.43.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\356\005\335\036"
+	.string	"\246\364\275K\220\330Q:$\323s\370\022\203za\235lGp\r\004\374\230\231'a\303\370\352\231\0339gH[x\b\3427\332\376\t\242.\353\250\340\357k\333\023L\220\223\001$\"H\340z\026\265\230\327\"HS\211\374\2051m\215\020\262e\222\001\250"
+	.string	"\232"
+	.string	"\255"
+	.ascii	"A\261\035\215\034\312\304\350\212\004\355\350M\315\235U\3023"
+	.ascii	"\300-\362@\202(\313\331\376\324\212\013\270\327\211,\353\336"
+	.ascii	"\265\001g\240\035-0&\327\315\374$O\036}\345%\323\334\273#I\326"
+	.ascii	"\275\267\001\343hGuNf\346G\035\311\021\017sV\244\214\231\026"
+	.ascii	"0\343\222\346\275"
+	.string	"+\216\327\023H\217\322> =j{|\370\024=m\017\371HO\247\226D\3242\253xtQ\036\231~\236\024\252Lq\331\034Y\234\350\223T\216\232c\261\3559`\006X\227\315\261x2\370r\254q\253\367\322\221\330=\353\271\367r\253G\031\347\331\031\2109\005\020&|}\365(\337\227\036m\013Ae\272Q\214\253\273\262\270\320\262\366\211g\377\245\267;\252\255b\217\361\314\336\366\225\361LR\227\361MR\310\211\322+\337\241)\251\311\370V\007\221\274b\314\333d\314+R\333'\346\237\327:1\337\311\177{\325\237s&\277\355S\377\315\225\347\332\327\177\306\315h\255\371\244i\266\263\346\2465\377@\b!M1\b\312\356\205QV\346bA\243\004\271\362g>3\037\361\255\270\346\366#\307\254$\372U\212A\243\022\233a\356]\027\034\345\023\264[S.u\022\027c\001\3076\030\225\t\352\336\013\007\0033\244\211\341^\204"
+	.ascii	"\276\216sUG\206w\351\322\360-Zpp\335+g\336\360,B,v\2512\371\302"
+	.ascii	"\224\231\303\267\204\t\274\254 \360z\340\025\326J\033U|p\220"
+	.ascii	"\367*]\345O9\225\016\347\007\237\364\252O\032\342R|l\220\314"
+	.ascii	"\"\276\034A\273\367F\270:\301k.7ZMb\314\333O\226\240V\364/\224"
+	.ascii	"\307\027\t\203\242\344\264O\f\3455\273\243\372*\366X\255I\031"
+	.ascii	"W\315\366\b\350\231m\313\\B\327WkV\207\205Eb~\024\"{\225\231"
+	.ascii	"\207\256\305S\200\274\367N\300zV\217\017\344(\007\301\007Q\374"
+	.ascii	"|EC\277Y\357\347't\366\212t\036~\214t;\032\020O\267\013\n\322"
+	.ascii	"YP\001\254\261\203\035\217\207'\202\004\236\035\333\217\257\231"
+	.ascii	"\2673\304+*\021\244\363\001{A\\\020\330K\341\003\376\340P\370"
+	.ascii	"tB8\0360\210\333\321\341\337P\017\210+\372\375\200\270\232\365"
+	.ascii	"\376\274\326\211OU\306\210\205\326\354\255\216\201K\213&X'\177"
+	.ascii	"\230\242v\211\231Q\313=I\226\230\266ry\013\322\306\240\222\355"
+	.ascii	"K+gH\027\205D\234\244\r\252\221\214\372\022\220\272!\3623+\314"
+	.ascii	"\030\360q#\3524r\262\261&\320\360\310\311\f\243N\"\3262\017\245"
+	.ascii	">f\230\f\353-\246\220\315\253Br\250QT'\241\241`DR\222\202\202"
+	.ascii	"d8\300\002\021)2n\021 \255d\312j\244\240\234\326\032\016A\233"
+	.ascii	"\"/\352\225\274u>\322\004,\324.[\314\332aq\227\nD\315\336\246"
+	.ascii	"\374:H\t0\272A\017L\275\t\343\212\336.\207}\226\337\365\023\274"
+	.ascii	"\360E\2672@\366\023\231Q\274I\357\220\362\037R\036\201R\302\247"
+	.ascii	"\362\205D;\367\b\006\304\204\347\023\\~\274\355N\275\024\354"
+	.ascii	"\232f\016yN-3\362\220\035\263\347\262\351\324\324\216\013}\343"
+	.ascii	"\366n*\024\342\306\241\2449-\332\t\220\216\225\216Q\300F\200"
+	.ascii	"#\316\033\030\217E\224\201\335\275m\364i,Ql\261\036\306\247\344"
+	.ascii	"\331#\242\346\245d\302\344d\271J\341{\253\353wU\271\200\202\337"
+	.ascii	"c\002\245\2748;\264\224\3355I\254\252\267\250L\032\240\017\353"
+	.ascii	"\257\357\001"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.44.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\221\002}\023"
+	.string	"\326c~H\320\322(\035H\215B\210\240\374\254(\220\271&9FY\374\022I\nC\205\225\214W\361Uf\026t\241\324\314\366G\fkv}\365TE\363\312L:h\343\001\326zaST4\031\240i\033~\334 s\332\211%\233H\231Re"
+	.string	"h"
+	.string	"j"
+	.string	")RT\355\337\216\"\346\343\206\017\2303\247F\321\234\243\002\213\340\245G\320\266o\342'b\034\363\306\035\333\227#\341!\307c\316Q<]\344\273\364N\340\273\334\021\217]z\2531\277\244\342\375\364\020\325l\262\313\233{&\333\315W\200M\306;\3159\237\273\322\330h\252%\2259\247\265f\263\271\277\333^\261\r\301\326\243&\034I\363Fi\037\364\00783\325Y\207\220\222\246\352\354Q\246\253c\337\233\233c\207\246\217\177\351\270\373\223j)\325\236T\257T\253\247>H\bb\006\202\035s~\330\371\2302\244\221\317q\277\035\343\003=\347p\304E\212\035\004\3639S\003\240\326\301g\005\274\0349J9.\006\312j@\241\334\217\2159\307\004\227v"
+	.ascii	"\216\004\"\336\222\360\334f:/\334\343~\232\251.\334\377\230)"
+	.ascii	"A\323\235\003\f\355\3209\247lW\307\273\272-@H2\332\3036\352E"
+	.ascii	"\261\022\242\003\273%<7;\365\026\261\220\035[u\026\024@tCxn9"
+	.ascii	"B\375\332\025\\\3645\237dVf\177\205\006\245Q\263[Wq\001\234s"
+	.ascii	"\242\b\275\274\f\354\364\\\3720\337\345\367\265\0203\3359\257"
+	.ascii	"\303X\030Z)\351\005-\251\223\023\024\006'&\005T)\026\n\366b\255"
+	.ascii	"@\247L^R0\026\013\250\225K\365\022_.U\206\225k\202\310Z\241\\"
+	.ascii	"\304\224\353%\232\234\334zQ\271DX\253\345\022\303q\336\233\233"
+	.ascii	"\343\b0<\323r\210q\333p\277\245\261\375m\003\234\331\322\034"
+	.ascii	"\332Hx\356\246\241\335g\225\2314\3115y\253+\327\3231#\202\306"
+	.ascii	"\362\0271\022\2432 p\002\2419\253\003\2472\024\230i\017\263N"
+	.ascii	"s\223\272\325\302\276\n\254\243\b\337\032#:X:mo/Mv\256\301T\\"
+	.ascii	"\247d2\"\253\337\357F\305c\b/\204s\347H\003\022\274\"(\362\253"
+	.ascii	"\224\024\342\261\330\264`[\032\356C\264%J\004\363m\376p\034\006"
+	.ascii	"\341q\253\b\250\377\360\225\022T$\006\244b\211\307\357\356 \033"
+	.ascii	"\224\343\363Xc\350\364\326\2762"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.45.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`8\003m\026"
+	.string	"\346h\220J\300\224Q:\250\346\323\206\223-s\312N39bm\001\305\214\252\315\272#`L\007\320\003\2415\233 \313\366\377\341\315\341\226\213\236^)\214)y\273*\212 \201dpW\265(\313\332\346\326W\327\316\310\332\037%\237l\"wJ\001w"
+	.string	"x"
+	.string	"|"
+	.ascii	"GdH\333\t\225\222v\f\251\265<p\352\006\341\211\006\2279\355\357"
+	.ascii	"n\224\363\362\302\003\324\372\003$F\255%\002\267\302S\227\241"
+	.ascii	"m\277\350)rL~e\220\016Lr\221!\251H\255e\213\365\001\340\351w"
+	.ascii	"\001\340\351\2068y\372\355$}\323\313\207b\304\215\234\216v\312"
+	.ascii	"\363\217D\307\363]\351n\037\253\326z\245O\035\235mN\323K\255"
+	.ascii	"\3253\247\343p\203\267\rc{\306\3361\337\347:\324f\317\250\022"
+	.ascii	">*\210\323~\305\035\370\324\346\222'\357\203\217:\227\354\222"
+	.ascii	"6\027\310\376W\367\307\376\321\275R\245^\376\247#\335!\2356\321"
+	.ascii	"i\220NS:\375\321\351\245\323\363\233~\t\312F\017\025!\265n\350"
+	.ascii	"\035\251<\350\f\022?\372\221>\355\034_\305\223\256d\324\211\007"
+	.ascii	"\027{\005\316+n\347\224\303\360b\310\313\007\211d\335J\352\r"
+	.ascii	"\b\006\321\203\360\364D\204\313\003$<\243p_j4E7\365\355\\\272"
+	.ascii	"\264\006\256\307\026\363\032$\n\215\002\337\242\b\355jE\237j"
+	.ascii	"\217tVm.\251v\352\300\021\331f\317)\336\211Yk\245\355\002yw\256"
+	.ascii	"\214\212\035\267i\304\266\3533H\025\031)\273*B;\373u\030\244"
+	.ascii	"I\220-\376\205\004\325\\\023\241\235\t\324\374\332\023j\346s"
+	.ascii	"f\335\226f\237ga\376\310\331\261\267\240\020\326Z[X\320\214\006"
+	.ascii	"\202\206N}\034\3604\343g\304\021F\024e\fFq\206#sr\002\231\027"
+	.ascii	"\013K\213\002\226\025\002\342\313\3065\033m`\241_+7\257Y\f\215"
+	.ascii	"\013&\023\307\326(\023+\300d3-\033\230\253\246\365\222\215\255"
+	.ascii	"\025\226c7\242\2545\213\305d-TY\377\325\3751\004\033_j?\224c"
+	.ascii	"\267\252\rW\307\366j\027\370\324\326f\024\215\b\223'c\265?\002"
+	.ascii	"\320\353\365z'A\323\256\366Dp=\341\202kZ0\b\216\b\007\231r\003"
+	.ascii	"\005\334\224+=> \240\242\0313\036j\003;%C4L\317\256u\315m\365"
+	.ascii	"\016\225\215\210\217\353\026\371\220\2518\207\201\270\200\006"
+	.ascii	"\266\370Z,VS\224\305v\213\003V\3656\232\326\030\036a\200\352"
+	.ascii	"u\220LNd\245\373\335\251c\235\020\024\202s\347H\003\036\274*"
+	.ascii	"(\363\253L\n\351X\254Zp/\215\356\203\327\022!\202\321m~8\333"
+	.ascii	"\306\341\343\200\032g\210Be!\263\024\366\302\240\262l@\027K$"
+	.ascii	"^w\007\331\240\004>\357\032#Oo\355+\003"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.46.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\211\001]\017"
+	.string	"\306\234gF\360\220*\035\360\253\304^\2376\t\331\335\236J7L\231\213\215\277\t5pz\345\327\357\005\316T\251r\336\207\222V*|H\264\026\273\017\203\216yW\037>\266N\260\307\213\203\246\206\323iW,\216@%A\233\354\235RN"
+	.string	"O"
+	.string	"X"
+	.ascii	"\337\306\005$\245}\224\227X}\266\341\002vM\\\260\330\255\b\f"
+	.ascii	"~\247\256/\2209\375> sj\333\035\237\225Y\2571\330O^\204\254\340"
+	.ascii	"v+8?\234u\311\362\257\362\216\204\354\345%\322\272\364\030\354"
+	.ascii	"\256\345Kd\344\236\267m\300\266\004\373\271\222\206]["
+	.string	"r\236\330\357vw=M\354\327\333\373\354\357\250\364\244\322\262\223>\200P\305\335:3va\271\032\333\202\266\310^\177{\345\233\270\2125\033\033\310NQuKRw\344\301\b\\\204\357ts\003\275\2628\255\272\260\016Y\n\224\003\247v\020+\302\017Kg\316\017\b[tZ\310\021\263GWaaC\316\333<\210\230\005x!\211\201\321\310O\373BI\376e\016\207\331\262\217B\203\264\275\354\323Od\370v\327c\345c\344\210\2058\365U\231\323\317\277:\270d\316\222v\253u\363)\207P\342\2224L\300\005F\f\314\006\343U)T\251\301H\362\234\200B\350\361x(\360t6F\241I\224\032M\244\317a\007\025\246B\030D$q4\202\2438\372 \211\025@\023IT\002Cq\004;\034\237P#\021L\235N\"\250\251{\333\233\013J\\\023\304\032\031\265\t\222\026\243\346\315\327s\346\224\323\233g\ti\001\t=\036"
+	.ascii	"\247\223\241L\2130\354\312\n\017\233}l\263\301\254T\215y\320"
+	.ascii	"\024h\f\0341\025\221\252\307\263`\025\360\353\004\031)B\217B"
+	.ascii	"4\236\221bB\363\240\321\336\f\255]\003\t-|&\020_\264\030(2=\301"
+	.ascii	"\212\211\312\214\251\235d"
+	.text
+	.section	.gnu.lto_tcpRead.47.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\335\002\365\024"
+	.string	"\346%\207I\300\224Q:\261f\241\320F\031\242\215\337\351p\326\005i\223\254\301\037\022R\317\313\246\035K\031\235\030\332\376\370V\037\247\036\377\352\007\343\262&s\270\f\305*\333\024\255\243\377\234\220\030I\001\212B\324\017[\375\3145K6\221R\246o"
+	.string	"l"
+	.string	"s"
+	.string	"\036\212t\227\013t>\202\n\345\310e\367\327\026\352BG\2258\250\200\356\241\027N\335%\203\217*\235/\225\200\250S\245\003D\235\377\337\300\201\316qZ\372~D\242\250\036\246$\335\345\310E\212\323\031\362\342\256\251\227\020\211\205\020^/\2473HC"
+	.ascii	"\275 \345Vo'L\351n]\322\365\351\355vS/\335\375\345\365\200\364"
+	.ascii	"\242\376\217\371/\341g\005\001SYy t\033\374\002\203LXK\205\021"
+	.ascii	"\322-\324[@\013\354\005\351\205\372\313\3342\321\257aw\367y\350"
+	.ascii	"\327\237~\245J\252&\342>%\356\305\271\237\251}(\356y\3567\334"
+	.ascii	"k\200V\022\2201\330\375\023\\\322?\246\215#\375\251\376:W\030"
+	.ascii	"\272\364\023\224$\027\375\341T\215\"\325T\324\001F\245\023%\206"
+	.ascii	"\313_\346h\363|0\341\365\004\374R\205\211\314\"3\022\236\022"
+	.ascii	"\273\021+\326\237\256\b\351\324\351F\301\204\032]qD"
+	.string	"\235+V&\037\021\277\r>\344\345\311\234\203G\305n\203g\016Y{\242*(\020\246\342\253q\300\307\254r\342\227Q\0328\256\247?\2463H\326\323\262k\210R+\004k\225\377\013\263U\336Sv8\367k\323\206}\342\375\031TF\215\252\273[\230hh\006|F:\2579\242\006\030\310\265\351WfH\026\226\226\007,\257\0022\322&v\263\331\314T'_7\344M\206&6\253\311l\243\255&\3230\253Y\030mf\261\232\221\254\331\306W\312i7\262\332x\243\321j\343I\331\0326\017\255\030\202\220\216wo!\305,p\305\024\271\007\314\305\203E\204g$E\2500q\007\314\345\323A\262\020\370\216\254\200$\266\273s\314DO\261\3103K>vV\311\377\t\212\003\366\272\221 \0257 \220\002\231)+\017\247\304Pj\032]\206\007Z\274\271\270m\233\003\221wY0a(\216\303N,\356A,/3\034]X\322"
+	.ascii	"\201qFer\327\301\331\355\212!\330\013\371\\\223a\221y\274\216"
+	.ascii	"\251\336\361@\233\201t\2251\234\020\036\254$s\315\253\327\002"
+	.ascii	"\307JSC\033\036y7\356M\321\325ed1\325\362\367\327\031{N\033a"
+	.ascii	"\306\313\335\210\034H\304QT0RC>\225\033rok\215\036"
+	.text
+	.section	.gnu.lto_tcpWrite.48.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`C\003\215\027"
+	.string	"Fk\230E\300\330*\035\3001)"
+	.string	"a.\344\352\371;\016\022UQp\315\277\313\324V\n\301\352\026Rd\224\035\351\346\366\217='\254\242\335R-!\236\n\2047G\021-9u\314\020\274'\267\211\341\334\342\342\023B\b\2212\245\177"
+	.string	"\177"
+	.string	"\201"
+	.string	"\2536\005\013\264\003ix\347\364)\362P^L`&u\265o\344Gh\377\325\370\2009yG\240\314\t\224`Ty\321\300\037\030/\226/0^4\315\016s\340\317\374P\217\234\020\2329'j\203\234\366Q\fWi>\271\201\244\333\325>\352\270\030\036\330\002\344\213i\207\013!\370\020\365\224v64\004\260\353\371\232v;\341i\316\371\241+\317\356\246Jn\230sZu\273\0347y\333,\333&\354\215\021\2071^\374^\247\303\246G\326 \225\322^\311?\370\260\351\032kp\n\227\251kl`M\267g?\234\313\263\017\374M\377\375%"
+	.ascii	"jR\251.Ij\262T\217\244Z$\325!\251^R\255\243\372\004Lh\266d\030"
+	.ascii	"\232\363\306\021\233\251E\224\"\344B\037r\t\207'e+\201\361\211"
+	.ascii	"\303A\322\345|%\312\2138=\251#y\020\355Id\2245\034e\223\034\220"
+	.ascii	"\2309\201\021.\032Dy\361\024\342\324R\001=\253\372\256\361\206"
+	.ascii	"H\231\340\356\222\226\307\266I+n\212 /\"^\305\305\340\207\312"
+	.ascii	"\211\004\3422\360\375\212H\373$'\021\206\333\273\3169k\273<\207"
+	.ascii	"\273{S$\210hG\325\330\036\361)\256\013I\321\020\356\205~\327"
+	.ascii	"\250\273;\202\301\371\334\364\3106\211?q=0\262K<x\302\201\221"
+	.ascii	"\356\203.?\223\025\001\372\265U+\275\316\247\235\255\331o\"S"
+	.ascii	"#\235\315:\223\025\345\234\363\302\022\026\255\005?@\027\035"
+	.ascii	"\262\253P\2618\314f\260^%\213\225zB\212\225\216\316\005\f:9\b"
+	.ascii	"X\253\227j&{\265J\257r^\254f(Z\250Z1\226\f%\213\261b\264b*P\257"
+	.ascii	"\226\312\005j\025\223\241rN\206\275`\305P3\030,\206*\001\347"
+	.ascii	"\303\271<wH\243\305\2667\017\032<3n\257\310\225\245\201o\007"
+	.ascii	"\031\323\372D\257\017\n\214\346\374q \0376^\254\340\343\201D"
+	.ascii	"\217L\356\270\345\256\023\334\220\333\222\033:\311\265\261\205"
+	.ascii	"8\026\230\201+7\343\032\360\005\b\216\211Rf\313\017q\003< \200"
+	.ascii	"\002\221\2314\017\247\306p\214\351\005\261\201\337V\371\212\277"
+	.ascii	"\243\244\001\023\351$\321 \220\205\302\314]9G\030\346\275\321"
+	.ascii	"\306-lJ\215q\304)\021\253n*l`?\342\301\030E\006\201\346,?y\215"
+	.ascii	"\320\325\177{\017\\D\2178\362\blq\036F@2\0033*\0028o\n\371 \254"
+	.ascii	"\215\240\005\377\322p\337\315]\227=!\214\211\302\231D\344Fhu"
+	.ascii	"\375\f\004\225\310\240;\234{;\222\003\b:[tI\003\016\256\356\240"
+	.ascii	"\367\266\026\353\001"
+	.text
+	.section	.gnu.lto_tcpDataOutAll.49.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\301\003\235\032"
+	.string	"f0\253H\260\230Qc@\307\273\321W\177(\337\023zI\321\"\326$\2471#j\004\364\"\251\013\017\221\307\332\277X\373Kf\217\204\004\3647(*\353\260\315\2401#\317\241\013]$\375\212\3123\201\322\007'\324:\254l\"\267\224)\005\222"
+	.string	"\217"
+	.string	"\236"
+	.ascii	"\244\277t\246\236\013\261\024\354\207\274\276\006L\\\224f^\035"
+	.ascii	"\263\257\260\023h\275\212\037\320z\375\3139;\313I\033\367%\020"
+	.ascii	"\310\211\313\2757Fk\330^$o;sw\331\261\212t\346\374\244\037X\022"
+	.ascii	"\362|>w\211cP\317\312\207\275\"\361\346JK\213\227\273ii\f\021"
+	.ascii	"}d\361** z\222\022\343;!\016\240\002\022\343P\237*|@S\214\361"
+	.ascii	"\001\211\260{\357\313\3673\351\313\327\032\301\253\243!\242\317"
+	.ascii	"\021\347\336\353\311\363\r\3350\267\215\3036\006\233\366\b(t"
+	.ascii	"\230\312\260\305i;\376w"
+	.string	"\3239=\351\364a\004\364\240\002a\312\275BY_\356T\215\332\361\337o\337wz\320Gr(\277\234\313\365\334\210\177\204.\241Bz\265\235\373\023\016g\227bB\t\264\222\261a3\347\201O\270V\317%\004\004\305\352^r\301\253/\330W\231)6\276\222_N\331\330\316\375g)\353\323\263e\031\264\272\367V\270S\217O\276\210_\2572>\212\370CN\244\347M8\361\022\221w\310\302R\025I\301\276\232\2642J6\366\003\225D\313R\rMW\0364\207K!AchA\272\367:\210Bsm\241Bzr(\270\326\253\245\001n0M\341\322\020\311/\300\320A\035F\2304\274G\376\022\nR\205\036x\230\356Np1U\274&\264\004URg\342\001D\255\326z\235\364\274\0251B\243W)\225\252D\023\255S[\023\226\237\351\245\304\243L\330{\357\215\237\344JD\3709^}\343\231\347\361P\003W\242t3\313"
+	.ascii	"\204.h\031\324E\t\365\314\377{\004\030\272\211\345\227\027\177"
+	.ascii	"\034Ma\321\360N,\233\334M:\303\376\315U3\231N\316\316M\207f7"
+	.ascii	"\320\346\355f\240AVS\343\340A\rM\001\017:<\035"
+	.string	"d\3252\232\020\262\235\f\037rh\266\331-v\263\315F\320l\033b:\264\034\0201\231\355\026\243\201\271\026bf\213\355\324j\266\330\213\324\235\312H\272\025\372\230\322\321\035\017\027\235a\027o\034)\3052gN\251\n{K\265(\225\260\345\210R\034\335\304\272x\357\275v\244\377\035\246\340\224\216\364(^\354f\226\021\b\025\r}\340_\376AB\243)\335\304\232KF\001sR?(\233\315\363,R\037\243\036\021*\001K\250Q \205\220\203\210\220\241@D\210\030\2501\200\002!1+\017\021\300\271ct\n\373\006t\375\212Nz\013)E\332}\317\271\265nw\251<\302\3559\023|7\216!\250\016\2472\351\333NH\241\366\203\206\376\002\362\275\244\215\t\222\231FT\276%o\307\317\211\"\323\316\262\002u\263\223\306C\277^\007\023\323E\244\334\371\366\177Z\216<s\277w\n\200\302\243\023\215\345\020\247\035\313\016\204<"
+	.ascii	"2\211\373\223G\347\354\326\345\350`\017\256YE/\271o\244Z\220"
+	.ascii	"\307\3019*\361\220\253\360t\210\353\317\244\233\354\256\006"
+	.text
+	.section	.gnu.lto_tcpDataOut.50.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`#\001\365\r"
+	.string	"\206Z`E"
+	.string	"\221(\035`\351\254\005O\nN|\274\362\364\n9\263zWC&\221\035\367\2128\b\f\350:\001\213\326\220\005\234@\037\033\346\233\030r\266,{EK\357\031rt\246\016\361"
+	.string	"\251\224\354\300\245i\221O\366\336;\245I"
+	.string	"L"
+	.string	"K"
+	.string	"\007\254e\247\256\037\200\235f\017\301N\375\3318^_\366026\204\256\335\325\244\210\177\2372~\376\007X\372\314<\\N\003--f\004"
+	.string	"UfH\314\t\020\017\0379\200\247\0305$\273\353\270\002\262\334\364\266\031\330\226`\177\003\333a\246\307\322\2400J\330\276\375\025\237\277zh\220\215\211\220E\232\333R\227\305AJ\246F\310N7\250\021\373+\277>\305w\025\216\3019\325\005\023\250\\\250\002\247n\220\235r\346\346e\344\361(|\324S\337U\244\013\330uA\265vk\262du\343\024y\330\316p\026)\">\f\212\206lwO\342\324'a\247\227"
+	.string	"F\250Lq\306\361E\312\306\224g\375\301\007S|\371\341!\274Z;tl|\331\265\024e\b\373sw\327\322\305\276\352\2371\372\330\327r\345X\020\263\001\336-\204N*l\324\bJ6\217GD\201\247C\200\333B\237\221\027\002e\336:&\333h\302\205\017\250\343<\315\3538\024PGA\013\201>\030\264\255\363\264\016\307\"\023\256\323F\"Q\247\201\324=\211I\252LM\234\322\366N\342W<e)\326`\271\220\221N\301\036\027"
+	.ascii	"\247\223\241L\2130\2142a\257\0062\230\275\204j\025\004\236\021"
+	.ascii	"\342\302\304JK<u\206\301.\263\223\006\321\205t`\314\244\226\273"
+	.ascii	"`\0224Q\251\\\021'\271\251\373h\fj\017"
+	.text
+	.section	.gnu.lto_tcpDataIn.51.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`l\004\215\034"
+	.string	"Ft\264H\260XQ:\300\241\222\254[\026?X\200D\300\232$\355\230\355\370h\274\371\371Pm\n\314\264!h\322i\262ZzD#*\032\336\336,\006\017\303\305\373\221>\203>\364\251\355\\\036I\246\3706K\275\374\337\b!\204\310\235R\235"
+	.string	"\225"
+	.string	"\246"
+	.string	"TNj\2558\236`~\224\2117eh\364Lq%\202\371\361&\f\355\324\376\220\023\t:\020\350\002j]\022\342\244\326\023\3073\363\243\317\303\310\217\346m\310\217\016\262\251~\376\352\203C\025F\312\324Zg\253\303\345p8\034^<\357\025\r\272\271*Gqi\220O\223\fy>\241\233bY\324\202\307\265\270\230!\322\314T\t\037<\355\371\206\350\212D\242\361R\306G\226O\306\305\227\257H\224\325Z[>\"\272\017\376\301\321\n1JH4NK\007\265VS\236\017\351f\335v\222\355\013\266\030\"6\356JD\230\265V\006I4\220\210M\355\370\350\003\221\037\277\347\305\330\321\241\217\004#\300\376\310%\340\330\3213\246\302\027Z*=c\237Bt\231\354\323~f\252\274Kv\354P7\354P?\201\237\277\315\201\177\200\227\353\347\335:\324\315\"\251W$\265IR\227&59R\217%\265HR\357HME\352\033\030"
+	.string	"\314\002!Xk\213!\232*5\n{\330\376\203n\305X\320\354#@\257F.V\274\243\243\252ZO\005\037m\301\261\035m\235\376\024t(G\361\252V\245"
+	.string	"\020\374\310\354\204>\276\005\214\023\022q\231\274Zs\013<a!\242flSxT\r\307J\202\325\3424\001w\257\221\345\232\273]\214\222\206\252\324j\250"
+	.ascii	"(\267\246\t\270\273A\256/\305\247\002l\252\326\034?\344\3071"
+	.ascii	"\no\214\323\241t\260`\372)\310\217\344\216]z5\304\245;.\215\332"
+	.ascii	"\025\367*\322`\270\260v`\352\311\315\324\356\001/v\2067\371q"
+	.ascii	"\375\354\rg\262C\177t]M\300\330\376\274l\301]\033[\322\210\021"
+	.ascii	"\220!\241\215\rN)\362\3552\331\0360\343E\277\366\355\003=\317"
+	.ascii	"2\242\025\262\277\344\304\177\274\272\337P\340t\"\b\033\365\002"
+	.ascii	"\0166\035\035\006\rtrnn6\236\035\037\035\017\316\264-\247\204"
+	.ascii	"\315g\303\210\035\\\356\246\233\351r7\023\270\\\207\031\017n"
+	.ascii	"\207\304\314\226\323\315rd\356)q\313\315|zzr\263\326Y\277K\023"
+	.ascii	"\212H\355vH\302\203_!\t1)\201u\311\332\327\366Lm\326b\331Z\327"
+	.ascii	"\366\024\374\265\036\236\276\300d9\177-l\037\306(\351\301\213"
+	.ascii	"?\224\\t\017u;\370\305Zk]-\223\351\b\333\037\037\023\021\266"
+	.ascii	"\254\355\3211\266\233\303G%\306\266\265=\373\245\271\\\266D\361"
+	.ascii	"\306\004\031\227\3115R\252V\203%W\250!8\247\220r\306\214\bM "
+	.ascii	"\301\314&\351\220\002\031\"+\036\020PhfH\322\034\247K\245+\253"
+	.ascii	"o\325\243\352\270\366\357\227/m#{\006\253\023\304\2033\226\""
+	.ascii	"\326HX\370G^\202`\365\370\274\305%\2206h\230p\346\274c\314\035"
+	.ascii	"I\322*\346\303\355\252\016\310\350>\263\034y\251\264\226\207"
+	.ascii	"b'X\265\240\n\033\312\0163\215.\255?^\277A\006\2560dl\bN@F\024"
+	.ascii	"\023\232\250\004o\274+\277\3746D<:\211\242\037\034U\210\367G"
+	.ascii	"\233\3023\311H\264\337\fyY\336\001\276\256\220\356<\361\226j"
+	.ascii	"\266\351\274AB,\020\254\272\035\254\007\217\377\3113G\317\023"
+	.ascii	"\376]\315@\246N\251"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.66.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\255\005\265\036"
+	.string	"\026\266\274I\240\330M:@\265>\360Lj\232\370\234\"\317\211\331\340{\217\237<\005< S\002\257\201\013\blv\211\236\373\334g\242|\270P4Dy.+\264\343\345\200\307\333\017b\212N\310\344\013 \212+\246f\217!\215l\"wJ\001\240"
+	.string	"\227"
+	.string	"\254"
+	.string	"\344\351\016\226\220\375-\237\307\265x\357a1\237(`\255b\360\373\202\205\340\324\022\310S\037\321\273g5\361"
+	.ascii	"+\013\252\035\237\320\234\007\372;\376\343=\253\3517\265\312"
+	.ascii	"\300\372\252\025\250\340\3248\362\324\300\353\214\247\344s\306"
+	.ascii	"S\373:l\357\250\314\263\253\034\350\253\347B2\265\365\245\326"
+	.ascii	"\212;\335\031\347]6Rq'\311\363\235.\223\r\325Zi\252^|tq*\205"
+	.ascii	"b\212\263W\325\342+\036\270\002\326\245\246*J\324YQ\243\367\256"
+	.ascii	"\317\024UPs\342\234\224\r\325Z\375'\030\367\314m\233\260}\301"
+	.ascii	"\246`\001\247s\337s\3614\313\370]\247\361\312rR\247\230\271V"
+	.ascii	"^\362b]\031\2668}\223M\347\320i\234q\372\206N\333<x\333\304\351"
+	.ascii	"\032q\272&N\323d\3233:M3N\317\320i\362\302[&N\217\3424\025\247"
+	.ascii	"Eqzwz\036\370\277'\007\002V\255"
+	.string	"+\312\214\2511h\230\215\377\370\203\277\360k\337\027\036\210/\3043\357L\265\303%t\341\203~\220`\020\336\203_\221\373\301\235\377\343]\236y\267{\220\347o\235\313\263\323\035\034\\>\232\304\n\003XYL\3301\004Z\bGx\246liv\2666\205\nR\353d\333\302\233\214 gK\233Yri\226*\221\312\0015\263<P\246\310<a8\023\246\240\341\222\362gHn\320\330\217\346eD\266\027\336\347i\212\361\270\262=\225)2\342\322\035\227\212I\335\200\312\360$\271\036$\345\016\335\236\253\237\220_\205\027\221\375}a\256|\355Z\211\273[\244\225$j\206\261\255\341Fr\006\206EJ\002Cq\r\214\331\033>$w\263\211.V\326voW?[Xm\316\265;\034\315\367\354\023\265N\366\303J\314a\255\365=\373\303\301B\b\360\325Z\033|\235H\362i4\215\001J\377\200\304\344\241\244^PT\002\0015p"
+	.string	"\364\003\300\250D\"ZRB:\"]\376\210(\227r \210\216tFJ8%\235\021\211#\035\007\034\322\021Q\b\\\251S\302\375\3708I\204\221\016\267\224\224\244\303\315>\364\264P\262\b\323\013\314m\277\344j\274\224+\326\313\302%W`\270\245\354\031\336\266\300\330\364\3422\362L\333\342l\016\226\234\245\215\375n\326fqr@\335,\217\022+LA\276*\345\217\317f\203\256\264P\004\267m\221V\224\351\205\305\266\017\326\254m/\254-mkV\3442%\207\223R&\250-n,\027`X\352\3206\300\325\217\211\270V\317\215Pr7\337\223\262\346\033\340\333\022p\250a0\243%3$\"#))(L:\300\002\021\031#\333\021"
+	.ascii	"A\306\230#-r\326\247\013\355*\207c\364\r\227\"PcA\t\254\2529"
+	.ascii	"\216\361\n\314\356\301)u\032\033\366\226h\323\323\350\027c\245"
+	.ascii	"7g\013\371\347;l\030\257\204\b\036e\346\264G,AK~]d@\224\323\274"
+	.ascii	"\331\207\324\230&\306\227\340\356\200\311\241Km\f\0132]X+\250"
+	.ascii	"\223U\271B:\226\n\341\332\337\316<8\317\020> \210\"\345E\200"
+	.ascii	"\036\004\2439\271_\232e\355\340\275,L?a\326\301\273f6D\336_\232"
+	.ascii	"g\222\0013\324\344\321\353X\352\005\016\315H\3464&\351\363~l"
+	.ascii	"+\256q\324\343\320v\035\273\270&\357\322Q\341L\322W\324\362K"
+	.ascii	"\225\227\327\373\371\242l\311]\256\2447Uh\3134\225\224N\313&"
+	.ascii	"\206P?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375`\310\003\315\020"
+	.string	"\366ZeF\360\262&\035(\235\255\024\240\242T\276E\345)&z\2656J\204\001\363\316\366\357w\310t\216\330\0201d\"\233\b\313\201\3473\"\"\"\025(\327\373\372\277\253\252\332\257\367\204\271\312\321Z\343f\306\222\210\255;&)eT"
+	.string	"V"
+	.string	"O"
+	.ascii	"=57\023Z\002\323\030\2003\007\240L7\2101\215\200\213]'s`ZY/}"
+	.ascii	"\342\322\021R\r\241\245\037p\267\212\301\322\016L:\001o\275\200"
+	.ascii	"WL\340UWF\225\222\230\223\322\f8\024\025\250\252\237\330u+\034"
+	.ascii	"\325V\245a\263 1\306X\322\nXUAf\230$\361A\336\276\340X\341\234"
+	.ascii	"\370\237\271\254\323\243\345\002\305\337\271{\203"
+	.string	"\202E\216\001|l\222\364#Ze\210h\232\020\255+\020-\363\241g<\364J\207f\341\320-\033\332EC\277dh\030\f\035\2631F\325\355\307\205N\255\232\260P\202\252\227\253B\247Ph\024N\005\3176\320wr\240\357\216\366\271\251d\202\327$\001\370\2217\002\017@\222\340\261\217\004\376\363\301\223\360H\276U\0360l\364\220\370\250\022\377$M|\2237\302/\315]\236\033/v\004\360E\223\304\317\276=a\371\2509\3613\271\234BE\213\035(~\252\311M\251^\256MK\251^.N\373\262\226[s\206\216\320\350X\267\273\302\206\325\n\005\370\247[\346i\235\320a\321K\204\216\215\346\256\352\345\252Q t\355\013]$\267\354\353q\331\263o\303\276\223\303\016\222\233\310\327\343D.\372\266\220/\027\022I\250a\020Bj\217\202\222\244\244Tl0\003\241m\033\021P\020\224*2QM0\022\222\364!\233\264z\300"
+	.string	"\212\271AZ.\314\354\314vn\024\317\220\344\242\310\264\231\375+\3166\325\214\266\314\315|\254\r\312~J0m$\bJ\227\n\225\253\372\262\326\227\345\341O2\t,\037n5\262\215\316\336\001,)\216\006\352\273$L\3153-\236\263\b8\327\231\324n\177\222\216~\310\274Ih\206\034\215"
+	.ascii	"_\r"
+	.text
+	.section	.gnu.lto_.refs.f77dd2d6946c2cc6,"e",@progbits
+	.string	"(\265/\375 n\225\002"
+	.string	"\342\206\023\033\240'\351\377\377\377\237U\325\330%\212\321\376\357Wk\373\371\023BH\333dK\231\002\177\334\237\353V'\205\232zj\n(b\037\322\315\365\350-\007\370\341n0\372\200\237\270\225_\360\023|\204\365BqB\341\002\376\361\215\337\272\350\204\317_\021"
+	.text
+	.section	.gnu.lto_.decls.f77dd2d6946c2cc6,"e",@progbits
+	.ascii	"(\265/\375`\210?\355\023\001\232\332)gW LI9\351\277\356\326\305"
+	.ascii	"lLDV\355\376\354\374\317\356m\235v\327\314\314"
+	.string	"\276\230\231\331\272\233js\177g\327\335\377\357s\20693\324*r\322\213\202j\266[\234`\3702_o\361z\272\244\022<|\340!k\005h\3752\213\366__1=w\r\333\226\220\275\345N\001\227\005_\006\223\006H:\311u\373\241\005\331\267\227\b\275\231\370\224yi\375\350\2333\003\025\374.\311\032t\346\330U\240\363\311&\322@:H\037\361Ic\245L\356\333E\332HUb\3202$}x\364\236\350\305\351\373\353\205_18\353^\305\340\354!Bo\":Ymav\364\375\336\336\022\214s\256Ag\315\271\002\235:Z\370\227\b\256N\311\nt\376\366\300\325\311\254\002\235\275\343\203O\017 Hd\372\376R\341\272zg\223Z'$\311X\342h\253\316Q\225\255\343\255\243\302i)\023K\310\024\222\240\226:\372\306\277\370\222\242\302L\331\345\234C|\b\021\342R\t\242\266\003\337[5\374\206\301\364\241\272\005y"
+	.ascii	"\0222\031OZ\252\342\365\322\005IL(x\271\262l\342\202\202\322"
+	.ascii	"NO \252\233X\tf\\-\325QN\222-\3251>\364 %3\262\204\025\266\034"
+	.ascii	"v9\347\377m\243c\350\251\256\321TM\243\253zFU\266T#C\204\b\341"
+	.ascii	"\301\2442\305.\016\005\367\226\n\337B\341\333\027\370\235\207"
+	.ascii	"\337n\360\335j\320\371\226\303o2\370\315\206I\324\240\263_\034"
+	.ascii	"\255y\213\352\373\266\202\3777R'Ue+U\275W,5\316\225\232\327\271"
+	.ascii	"\347HC\316=\344\264\204Z\251\217:W\267\252d\236\2525\346\320"
+	.ascii	"\314\354rNz\b\021\302fI\343f\312y\3371\360\337yOG\257K\207\336"
+	.ascii	"^\325\363:\362\324\243\357+\033\374\032\207_\341p\3155\350|\375"
+	.ascii	"\202\353\335_\351\252\233*\026\202\016\346X\f6\030}\353\fB\257"
+	.ascii	"v@'\262*\231\305r\316>\366E\220\247\251\276\033T\240\3635\r\277"
+	.ascii	"f\301\235\254A'\210\ntV\247e\005:\353\262\353\232\312\346uY\347"
+	.ascii	"^\002\204\357(e\256\234\223uysF\252U\203\236Z50\323\214 \205"
+	.ascii	"\235\367U\f\277z\341\212\246\306U\345\0065\315\253\231Z\346&"
+	.ascii	"R2'sN\3724\221\274\261\260\276\257K\360\353\006\247\335\333\253"
+	.ascii	"\033\234\257BpW\240\363\247\006\235\365\351j\314\006XI\013\031"
+	.ascii	"W\337\277\302\275U)\\lA\372V1\036|X2^W\337W"
+	.string	"+,\264\345rc\313\234\223`V\352\025\257+\177e\253k5LU\253m\325\255~\251\312\n\346\257\\j\227{H\346\254\204EKE3\263\342\301/\224\366\264\236_\316XbZ\036\374\325\353\257_5Y\301T/O\353Q\372\311J2dY\346\234\301\244\324\261\013\222\230$\200\004\3132\347\344+\327_\261\200\251Y*\232Mn\345\334#\b\005oU`\274\261\3139\031\"\204\207\020!B\204\bQ\301\310p\242\345\347\336\b\333d\r:MT\240\363E\370\"\300\027\342\277\242\235\231TUjbzv \321\340\365\375_\225\325\254\226%\263\207N>U!\322\367\033\300W\001\377\\!\363\211B\365\243H\222+\347\354\363;\213\263\204F\337\243\200_\225u\254\212\231\300\004G\232\276\225J\255\362*V\247\274\004\b\267GR2W\316\271\212}p\2253R\025\363\301\313\031\311\247V\rj\325\340B\311:b\345\274\217"
+	.string	"\336!\361\032v\240\267\f\302}\370\2153\250@g\0065\350\274\025\350$Q\201\316\277v\3755J\345\272\234ez\272\312b9'5\364\021X\023\265\276O\326\240\023W\240\323Z\213\201\007\034\360\263\316\025\374f\005\301\005$p$\240\004\307\377\335\373\333\004\366\202\277\032\317j\t\376\363\233\034\214\300\302\212\026\325\001\337\300ZPE\300\360f\204\277\016\207(\250$\2708\207\377\262Y\341\200\257\221\023\301\212\026)\232*\254 \200c+\370+\f\235\2006\236\202\377\222\371k\360\257*\376\372\201\277\242\177\365\300__\370\353\210\277\016\271\360\327\020\376*\202\277\n\377\272\342\257,\374\025\004\177\035\376\035\242\002\215\376J\364w\013\366C\224\365\360\333\016\277\345PK\340\364\003\374f\207\337\006\331\rM\376\223Y\240\t\024\375-f)\370\253\361Xa\320\360\267\n\366\307\372\374\355\3667\007l\317_[\3745"
+	.string	"\035gyj\\\023\277\301\377\263\025\3204\321\003\376\253\226\244\200\335\371{\215\325\371{\212\315\371\253\221\316\376\376{\371\032\3747\b~\206\200\377\322\370[\353\267\276\277\212\331\363\357\241\264\036\377j\254# \301/\370\277\306"
+	.string	"\377\360_\260\277oX\363\277\332\377\265\377a\376\213A\361\366\235\377N\371\273\250\223\356o\372\376&\300\337\003\370\373"
+	.ascii	"\177\027\340o\001\374\235\301\337\006\370{\203\2775\370\033\304"
+	.ascii	"\337!.\370\333\310\201\202\277{~\177\333\277\352\375\325\356"
+	.ascii	"\277\207\337,\300o\357\337z\177\307\371\333\315\337\313\277\323"
+	.ascii	"\374-\346o\264\277\307\376\246\3627\330\337N\376\336\372[\307"
+	.ascii	"\3378\376>\301\3374\376\236\372\033\371\267\323\337I\177\347"
+	.ascii	"\277a\370\333\305\337-\376N\3776\376]\3647\361o\242\277\207\376"
+	.ascii	"\346\340\257r\377\327\374O\363W4\177%\301\1771\177\235\300_-"
+	.ascii	"\360W\007\374\265\003\177\025\361w\212\277C\3607\b\376\346\300"
+	.ascii	"\337*\374M\201\277'\360\237\354o\b\374-\302\337\t\370\253\330"
+	.ascii	"\337\037\374\355\301\337%\376\237\375G\361_\354?\321\337$\376"
+	.ascii	"\036\361\267\210\277;\370\033\001\177%\341\257l\376\272\374\353"
+	.ascii	"\232\377+\374u\356\257q\177\315\177=\301_M\360\327\022\374\207"
+	.ascii	"\373\377\366\237\353\377\005\376\263\375\327\260\267\267\267"
+	.ascii	"\367\373\306\3748\371\217\330\022\311\337\231\245;1}\341\330"
+	.ascii	"=\006h\321q9\2711\\\035]K,TbX\220w\206\bO\256\350\270\354\362"
+	.ascii	"UR\323\332a\357\300X:{gb\t\371\203\221\324\366\3426!\340\311"
+	.ascii	"\222\216\313\256\352\3320\261\204\3745%}\335\253\353t\243x\220"
+	.ascii	"xbF\307ew}\334\036w\310\375q\263.\217\013\344\006\271XWHU\336"
+	.ascii	"\253F\273mr\255t\220\370\360\"\205\303\275N\030l\346\253#G\317"
+	.ascii	"\033\253&?p\374\346\300d\354\360b\364\2757\232\310\026\033I\216"
+	.ascii	"d\325\251)\353{\035-\370:^\370\2776n\215\252<\031\332\372\336"
+	.ascii	"\032\375\265\343\003\256H\226N\021\374\337\031w\252D\031-\250"
+	.ascii	"+\365;\325G\250\324\244\374\320"
+	.string	"\341\021%\303\"Q\252z\001\365+\303\267\3242\306\325\367>\331:_\031\23055\375u\202\211\302\203\323\367:Q\370\277M7\006\276K\243\272\273L\2771\352\222\307\254\306\220,\027\306N\362(\317]\030w\351\327FM\032\245\236$\034Z@\350\360\177\225n\222\016\035\235R\312E\372M2\307DeY\365\275G\266.G\211\256\354F\227\371\340\261\211K\222fO\317\247\346\307RX\336\255\236O\234\034V\222\276\026\317\364\262B\352k\343\374t\336\350]\331=\215\306Y\224\266\276\317y\303\277\275\263v9>\346\276h\331\031n\355r~\3408\342\352\3737\266\356\377\357\347VW'V\367\306\213\f6\"j\356\r\262-jn\232\313\216\225\217\033f\372>\247\013\376m\233V\236]wzul@\334\225Ir\262\254c<8\250`\251Y3\327#%\212\016+r\267s!\310Y\314\"\031[\312\353k\325\b\335\312\001"
+	.ascii	"K\332Y__\2328"
+	.ascii	"\236\244#\244\033qhxl\270\341%\351{&G\352m\311\245\357s\3200"
+	.ascii	"\324\224\245ab\t\371\223\221\305\205\364\342ibZaOK\243\245U\265"
+	.ascii	"t\322D\244\210\225\001\356\306\262+N\r\033\366\206\023\\\224"
+	.ascii	"\257;\"\267m\366\310\323\252\233\230\tp1,\255\025[\306\236Y5"
+	.ascii	"\313\305\232\261nV\213M\263X\354\026\313f\337,\030;\306z\261"
+	.ascii	"f\026\316f\261k\226\314v\261b\354\027\033\306\226\331+\026\315"
+	.ascii	"\222\251J\333f\243n\225v\n\230\027\234\345\225m\263C6\260I3\334"
+	.ascii	"\024\246\003J\035cZz\272\234\327\026\022\031^\\xP2\254TR\327"
+	.ascii	"\025\017\333\243\272U\375d\2450!ZB<T\201\263\2625p\330\035&\226"
+	.ascii	"\220?\030YO\226Bsv\t\206u\n\373Zn%\261L\302\236\226\\I;\255\234"
+	.ascii	"\223\266\311\223:\266\224\025\303\372\370\355\325_\002\004\333"
+	.ascii	"f\177\330 6\251\345\243\222\264c\tV\307\326h\3316\033\245\216"
+	.ascii	"\345--\222m\263T\354Xu\253\312Y*\203'B\220\270\2613\307\024\201"
+	.ascii	"\243E\204\373[\261\333\261\337&Y\245*\326\263\346\243\213\214"
+	.ascii	"\276\266\212\320\255\030\031[\336\221\276@R\230'Y\203\316\352"
+	.ascii	"\245\002\235\317i\302\377\345\341\377\226\370\2777\374\237\026"
+	.ascii	"\374\337\024\374_\023\374\337\020\374\237\025\376\017\211\377"
+	.ascii	"\313\370\230\016\337\214\311\022\214\204eK\230%V\211\316WR\225"
+	.ascii	"T\337\3433\3708\f>\366\202\357f\206\217\305\260\221\267\375H"
+	.ascii	"\363\242\357q\022\037+\301_V\240\3638\b>\216\001\377\026\310"
+	.ascii	"m\220*\026\202\016.\224\222\366\372\n\t\335\0029P\375\212\003"
+	.ascii	"\326\245\357q\024\366P\203zdU\264$^\204(?g\261\376\177\307\002"
+	.ascii	"\036e\215\032a}\217\225\360}z\270\346\nt\332\034VGU\376\213\265"
+	.ascii	"\372y\205\f\212R\337\373\334\340\023\344\1779\357S\203\177{#"
+	.ascii	"\006\237\2720d\2221\330*\337\230%\226\246\276\367\271\341\373"
+	.ascii	"\272\340\212\244a\251l\023T\r3\226\312\316(\263J\343\322\367"
+	.ascii	"\2761|\237\027\376\255\224E^\261*\323d\2216\312\247\210\333\232"
+	.ascii	"\223\276\367-\301\367\001\301\365\352\006\266L6FU\236\3156=\351"
+	.ascii	"\323\203\006c\214\255\357}3\360\353\331\316\023\324\263\235\367"
+	.ascii	"=\341\252U\201\316\373\226p\275\252A\347\206\ntV{\204\201O\262"
+	.ascii	"\006T\017\233\227Q\270d\211\355U4\037\r\345\0332}\363\254\021"
+	.ascii	"&>\310\364m\274\346zRW\243\357O<\334\246\276!\373q\327BZ\253"
+	.ascii	"\307\346\214\344\245\365\246\333\264\233\216\32334]\263i8m\327"
+	.ascii	"uU\331w\177\317\365\232\336\272k%\335\244\272U]("
+	.string	"]\315\343\256\261\372\352\202$\246\273f\245\357\032J\313\035\345TI\326\325\331\221\271\353e\0262wU\256.{\216\2229\352\024\222\344\352\201\254\253\263+\363W2w\365LU\343\0333\253\253\263\313\272k\037\025-g,\327\325\235r0h\314q\270?\275`\374\226\fR\201N5vK\221\034]\372\376$\303o\247)\375\265\227\004s\322J>i\265\323_\275\242\364W\026\224V\262\n^ou\351/&\226\220\277\250\260(%\2554\261\204\3749\3011Q\351\257\352&V\002\227^\227\3513\215\246\343:L\2675\231N\323c\332L\2775\230\026\323nU\331p\315\345\355\244\237`\021k\262\352&V\002\0278\313\022 4\\\233\365\221\352V%\002\024\273\263N\273 \211\351D\325\234\224\376\262`H\\%\254i\231s\022\256\257t\331\035\030\\\013i\345\005IL\031\tK\204-$\035\227]\316\311\0209vpc\246"
+	.ascii	"p\233\r\311\023W\224\276?i\364Z\253\231idGA\372\376\355\345\255"
+	.ascii	"\366\271\235|\201m\033\222D\331\367o\252\232\377\277\373\225"
+	.ascii	"\244\352G\337\237M\370f^\332\226S\fLM\\\362\"1Sv\244\2654\332"
+	.ascii	"\351\005\027d\255\357M5\370&\031|s\r\337$cYl\2624\226\034e\242"
+	.ascii	"\304\350{\263\f\337\264\202s\236t\221\331\353\333Vz\354J\271"
+	.ascii	"\342\351q\242\353\361\326\367&\027\276\251\004\337$\202oZ\341"
+	.ascii	"\233R\370oe\207i\035\221\"\347\346\263\243\027\005\216G\337\233"
+	.ascii	"J\370w\006\374\033\207\233\253\273\252\022D{\375\247\224\314"
+	.ascii	"\312\234\223>\2772t:\304\372\376\212\301\257 N\237\275\275\275"
+	.ascii	"\275\n\342\374\335\202\177\313\360M\326\240\363bL:7\263\374\277"
+	.ascii	"\337\024\214#Q\3707\257\374?\033\225\365\302\254\357\177`\340"
+	.ascii	"\373\324a\016Mbb\346\030\211\232aT\t\263\262e>\274\314\030\253"
+	.ascii	"hqU\324\336\314\340\2407aa&\225\372\223L\202\363\322\342\221"
+	.ascii	"\202Bg5\345&\225.\267)M\372\232\312\212\246\263\326\305\206\225"
+	.ascii	".8\210\013\024(&\230\007\234\273\302\210,s\256\002\221S\005\211"
+	.ascii	"$y\023\314\227\205,\216U_\363\253\242\345\261\331\373\352kz="
+	.ascii	"\r\211\223\250\255\276f\024\263\353K\024\224\224\276\257\312"
+	.ascii	"{\305\344\262\"\003\034\032<\372\336g\f\377\315\345t\272\f\311"
+	.ascii	"\002\343\004\007m%Ib:\251RrT\315\n\322\224\303g\257\013]\222"
+	.ascii	"&7\235\374=<\306DY\353k2\251hD\324\362\356\372\232K\352\225\235"
+	.ascii	" 1\222\214\351k*y\232\217\rL\326\016\237!\230C\r\022\377\315"
+	.ascii	"\035;\314-\213W\223\271\352\352\210\215P\0234U z\274P-\211\371"
+	.ascii	"\270\271uS\253"
+	.string	"\004\bO\313Jv\341\3655\213\2302\230G\376\237Y$\007\336\213\276\367\301\302\246\221\016t\300\341\201\327\367&\220 oF\226\364\2759\304$\362\377x\304\242\2628\365\275\017\016l\0061\205\324P\216\321\353{\037*l\3760\201\374\377U\244'!\312\276]\237v^D^\220+3\372\232<\314\036n<\354^\350\234\035)K\223eb\231g=\234\306\234\351\222\324\221\327\367\346\025\217\"G\246\372\"\317\334\2001C\337\373<a\234E\342\246\016\245\251\243\277\036 \226\221\244@\250I\315\300\304.#\275p\240\301\210[\223\276\357a\303\034\340L\033\246\r\023\307\t\330\274}q\322\304\f\tf\336\270\211C\214n\006\035}\315\030n\034\330\025\225\226\276f\325\335\342\201\332B\252r\206;\244QQ\2314\260\207;\036\226\212[\021:\032oJd\260\322\367=a\030\350\r\211\372\244\232S\257Js\352\022\3711\345L\245"
+	.ascii	"\032T\034\274\347\t\336\200$q\023\252*M(\023)\201d>\312!\223"
+	.ascii	"2\221\277)\303\214\352\274\235\253;5-#}O\205*\327\240\023\277"
+	.ascii	"%+\320\371\236!\370C\031\363\205\371\302t\022\241\313\266\355"
+	.ascii	"p\242e6\335t\262uF`\310\001\351k\306x\232\315e\276\326\372\232"
+	.ascii	"L\375EFX\226S_\023F\177\371\226\316\314h\3645\227\034\200\006"
+	.ascii	"Y\327dQ\336\340\234\351\373\236\035\330\002-\023\311D2\223$P"
+	.ascii	"\211\200\355$Q1\255\375\315\315\244\337V\222\254\247\276\357"
+	.ascii	"\241\302\30733\336\335;s\256\311\253(d\256B\202\350`\225g\346"
+	.ascii	"\274\273\207\217\314\260iU\331\310+\323\373\3353\212\205\315"
+	.ascii	"\270qR\244\260x\365}O\f|\236\031p\0075p\340\334\034\r\250\262"
+	.ascii	"c\311C\265d\2264\207=\\\331\331\335)\002\204\021\363\366\305"
+	.ascii	"\216lM\236^\337\363\224\301\036\262\324\325\335\030\033\332\256"
+	.ascii	"TS\330\225\276\347\301\202=\344\271qsk\374\344$2W\264rU\025\b"
+	.ascii	"\235,z[h}\317\363\004\177h\322\246\315\255\301\006D\332Y\025"
+	.ascii	"\2103\356\215MI\337\363`\341\rLH\324e\275"
+	.ascii	"K\345]\326\245\207l\323l\275}q\222\221I\016\316\023\003\336@"
+	.ascii	"\204\304\357\334\234\235\363\220\314S>'\036o_\3542\022\311\301"
+	.ascii	"y\226p\005K\312\224\271jj\3169W\345\2436\bHr\226\346W\315\215"
+	.ascii	";\225f\224Y\322\367\232\271q=a\256\270\235\211C\203g\344\311"
+	.ascii	"(s\246\361\354Q\2140Lgvf\300\246\033\211\3371\312;\306\306\341"
+	.ascii	"$\246+$\036&\322b03e\227\263\027\016r\304T-\205\364\375\316\032"
+	.ascii	"\266`"
+	.string	"\306\333\233\315\331*\214\226\026\\A\235\233\233\221\255\0352\374\337/\277a\376\333v\301\264\334\r\257e\r:\001\300&\364\373\245\347\311\221\016\031\372b\260v\325\260p\351\341\243\357\365\222T\346\234?\3249\035q\322\372~\247\t\356\033d\267\313M\253\312\313\345\311\234\225\227K\255\273[z\216\222Y\212\204\225\035+V0`h\371\335\242\314\022d\310\262\357E\023\372\325\"\002\221\036P\372\332,\277g\377-\273f?\036fI,}\253\227\032tZP\201\316\213E\3507\313\016\335\031\345\223\276\025(\357\225k\245\214\207\027\260\276\025\250\221\270aW\371;\345S\256\025\234s>J\346(\337\021\260\267/v\271\n\t\342\277c\277V\354\220)1/1\037dYL\304n\225*py;\252\230\271'\"p.\225W\031[/\330\372~\007\n\377\257\357\377\314H\310\234\363\224\231\314\310\244\235\363\257\257f\255 ~\236j\253"
+	.ascii	"\376\337\337\304\t9#\355-s\316\325\rNR\206\204#\203l\272!\231"
+	.ascii	"\224XG\017\300\222R\302\262\301\244\304\222\322\300\244\304\312"
+	.ascii	"GJ2\034i@f\254#&e\316\032\224\224\216J\270\222bR\"e\rL\312,\225"
+	.ascii	"_\274I\325\234\304:\312JWYCV\312HYy%\225\001\223\022\226\024"
+	.ascii	"\223\022IJ\003\223\022K*+\261\362OVBB\306P\312H\rY\211\305&+"
+	.ascii	"\257\244~\230\224WRLJ\254#\365K\214\257\265)\275\245\217\274"
+	.ascii	"z\304\244\224e@\345@B\376\2701%\257\362\231\234\253\330RFf\267"
+	.ascii	"\234\005\220s\216+\344\031$\033\325,\311MF\322\025\244\253\232"
+	.ascii	"\3149\177\200J\312\272\312JnG5\2731)\271\312YI\322\212\f\225"
+	.ascii	"s\316\037\034%\335\262\220\352v\324#G~Z\312\271\202\234\314\031"
+	.ascii	"*\347\243\232\335"
+	.string	"r\316G9g\0372G2\347\033?LZPP9Wy\200\3129\216\316\226rn\26183)&e\326\225\320\031\025\245V\206\221<\252LOWY+\237\301Bb\345\021X~\3129W:\254%5\243\315\327\257\224\377&/\330\316\033\322\220!}\253X\r:?x\t\375~\355h\231\222\322\245\257\007(\277]\377\215r\271\316\262(\\3\3726\262\006\235\002\250@\347}\"\364\013\305\214\213\243\203\353\253\301ur\365#NWR\337\273\304\236`ooo\017/g\244\273\244o\223\313\344w\311}|g\2340!\235\367\277J\344z\322 \305`\273I.\0226`^\216\372^2J6q\266\2164\\\333S\222\226\025\235)\037jiG\2624\311\303\001'\303Z\220)l\250\030)\362\302\233(\311\"\227H\220/\031\312\364\rh:4\272\320\202\260H\324\202\260HD4\332\200\036\213D\302\234\324\250\210\262\030\242"
+	.ascii	"\022\207)\321\320(\005\020\370\243\342\374\n\021\035\322!q\b"
+	.ascii	"\244\340+D\244GbQh\252\b\242D\327\205\242qEZ$\372\210\305a\032"
+	.ascii	"\024\026\211\200E\242\321\210\002\201?.\240\304\236\027\202D"
+	.ascii	"h\tE\013\244\350\321\207\307\210\24204\024\374qa\002\021M\217"
+	.ascii	"C\"\036\"\"#\"\261H\364\245A\026\306\242\212SEJ\034\032\213T"
+	.ascii	"\370\276B\004\n(N\2540\"EY0\006\323\026\204E\"\022Pc\221\004"
+	.ascii	"\026hz|a\005\037\342\211\037\021\021\004x\212\204\351\357\270"
+	.ascii	"B\2210\355!\242E)\024\tQ\030\321c\316\361D\2210\315\311!!\"5"
+	.ascii	"\006\213D\244F)\004\323`\tE\302TC\320W$Dq\034z@Q\343\t(\200\216"
+	.string	"h\372\302\bE\302\224Cj\f\246+\024\tS<\204\3020$\n\016\323!\361\004\005\250\321\210\205\241\nbQ\210b\240H\230\366|\205\210\342p(=\006\031\215\350Pz<\203i\260\004b\361D\217E\"\022\210E_\n4\246i\020\350\302\264\b\025\n!@,\342\013\207F\224\210\262\200\377A\b\035\204`\302\205\357&\026@b\001$\316\233X\200\220\320\002B\020\302\017A\310\016\021Q\035\026\210\303t\030\334\200\013\fl@Q\343\t.P\020\005\323\"\212\241`\316\b)\272\202\206\027\322\"\026&\244C\026Gb\320\210b\205\343\320\002\364\350Sa4\002F\323\241q\003\304!\013h\212\373\025\"L@\341\304\t\t(1\204\036\215\210F@|\032\323\"\364\030L\321cL\213x\322\241\321\205\235!\"\nTa\224\002=\006S\360\240\307`\n`\221Q\013\302`\n`\n'\200>CD\024\210\266\b\036\201)\234"
+	.string	"\356\034\215h\013\306 \013 &\016\203+\204\300\263HD\211\206*\200\276\022G\026\202D*\200\276\024\350\033\"*\002u\210,\214\210\212B\240\321H\b\324A\211R\004\323\026\300\036\025F)Rcq\305\021\370K\201)\234"
+	.string	"\346\230)\360\203\020T\250(\002\201\277\024=\252PQ\004\372R8\001\324I[\b\321\241\242\020\210S8\001\344A\207\206."
+	.string	"sL@\341\304\t\300\024N"
+	.string	"qz\034\022\361\2500J\001<\242F\0245\252"
+	.ascii	"\356\244@\024\206\341\361\004a(X\004\004\236\350P\221\005\320"
+	.ascii	"L\201\251\261\250B\2210\375}E\006C\303N\277B"
+	.string	"\304\005\306T\005\264\305\020\025\242\030\360\320\2020\230\202\210(H\202\013c\316\021\270\243\201\324XT\341\007%J\021D\321\3424\242C\025\303\224\210\016\rsR :T\254@j,\026\345\240CE\0267\005\246\220\032\213E<Gbq\230\026\025}h\032\304\300\220Q0\005Fa\030\256\220\022\r\203(v\206\202\250\004\200%< \032\006Q\354\244\306b\3215\342\024h\"%\016\215|FT\205\n\243\021\\\244\270\205\021=^\"\261(\274\351\231\372\020Y\030\022\005\201@\337W\210H\205F\306\364X\342\bt\201\246F,4\264 ,\022\001\201gJ4*\n\201@\237\021%\272P\004\002}G#z4\"\002\201x\2108l\001\b<\217\304a\321\021\b\364\021\213\303\343\220\b\005\002\177)0=\016\211~\276B\304\021-z!\355`\b5\006W\034;\030qL\207)F\030\021Y\350\300\205\021qH\324\301\007!"
+	.string	"C0\341b\004:dD$$\016G\030\217F#\024\220\272@\211DA\242\021M\211C\340P\0205\256H\213\200\300\016-Pc\021\020x\246\307!\021\020x\006\323\340\020\020x\2420\f\217@\340\331\202\260\210\202\013\343IT,\216"
+	.string	"4\207\320T\210\022\211E\341/\005\206 \224\022\207F8%\032\025IH\211\350\220H\250\223\022\321\026&\344|\205\210\241\340\013C#\206\202/\244\030\022\215\020\321\341\305\"\3248\"-\026\215#tP\030\206\307\213\026\275\220\336`\032\03422\217'\213 jLW"
+	.ascii	"\016\005_\030\322A\323\"\013\324x\262pda\215\301\025\302{\241"
+	.ascii	"\024B\017<\b!\001\036\210\340p\005(\200\204\f2`\201\b`\241\210"
+	.ascii	"\"a\n$\n\016\215\350q\304\321\210\266\030\032\207F\020\207A\026"
+	.ascii	"#\204\306\343\b\021\001"
+	.ascii	"\b\246\301\241\373\377\264:\225\342\326\264\354N\035wO\316\215"
+	.ascii	"\322\222\276\311\rUMd\340\210\343{jR6\271q\325\360t\221S\002"
+	.ascii	"\022\203\211<\303\021\266\246\252\265\262\246\240ic\243\233\230"
+	.ascii	"\035aCU\343v].w8\244\320\270R\356\325\325\0163TN\252\020);\364"
+	.ascii	"f\214\335\215Y\222d\352\236\275X\263\007%YeF\217\315\2114\321"
+	.ascii	"\342\350\310\222\316(S\f\017\r5[\300\2342\31449Nr\370\350rB\231"
+	.ascii	"`Ms[OK\233\225\f)s\242r\036a\241mi2\335\334%%s4b\3340En\272\342"
+	.ascii	"\230\354\330\231\033J\334\2340\266\224\\\211\343d\311\3041\002"
+	.ascii	"\214\007\223\276\033\300\316|\346S\t\n\206\343\205\324;\223~"
+	.ascii	"*\375\342L9\342\322\367D\252h\035\354\336\354\372\236G\032\230"
+	.ascii	"\340\ruy7\365\362\31486\206\374\250\341\304\b\033\032\035Yx\003"
+	.ascii	"[\335\315\031\352\3148[P\372M\224&*v7\343\334\204\343\243\006"
+	.ascii	"\346\204\343\256\ry'\245F\203\f\034\304\243M\033\323\315\023"
+	.ascii	"\255\234\253@\324\274/RH\223\356\246\033\2368K7l\320\322\230"
+	.ascii	"\t\351{\rI8\350IN\316\\\206u5\345\330aR\002\302\304\\ss\231\345"
+	.ascii	"L\212\254\2579W\321~f^2\220\263&OlX\372\376\207\316\204\373\307"
+	.ascii	"\230i\356\213\234\223H$\223\316\344\\\005\342\007\2664\203\004"
+	.ascii	"\315\31547\343J\200p6\2358\257\"X}\377\036k{\323\325\327<\363"
+	.ascii	"5m\210\214\371\322\3274s6\2720[\230\372\232e\316v\204\b\036\231"
+	.ascii	"\377\277!$->.\3679\265\243\244%}\377\363\206\377\303\2069\204"
+	.ascii	"m\271\311e\213)\346V)[\345\360\315X\373Q\303.3U\201\360Y\373"
+	.ascii	"qe\017\314M17\335J\200\360\264\332\345H\206\225\2767\303\344"
+	.ascii	"$\361\241l\322\367\035\374\377a)5\244\244\372\232kf\233O\016"
+	.ascii	"5<\034m\346\027+\0372\330zG6\303\352\330\300\261\375\215\251"
+	.ascii	"\026\305JKN\315\364\202$\246\353\311\365\362\301\367\245\303"
+	.ascii	")\367}\227\177\340)\303fJ\232\276f\232\026\346\200\204\354\346"
+	.ascii	"\031\231\211V\245\344(\237\2205,7v\231)\007\210\2352P\306\266"
+	.ascii	"\320\266\374`*k\353k\226\3354\373\177}fw\203J\337\377Pa\023K"
+	.ascii	"\204R\250\303\301#\202X6\nA\024\n2e\214B3D\264\351\363\025@0"
+	.ascii	"@D*\027K\273\256\017\023@\305\r\2534M\326\"\307\214\314\210\210"
+	.ascii	"H\n\212JRIcV\207\266=\\\241\013\021\371L{\252\336/\230#Z2%\302"
+	.ascii	"\237LVH\"\257+\313y\321\344\025\262\275R\204DzcQ\326\036f5\021"
+	.ascii	"\350\353\2202X\311=2\352rI$p\345\227\007X[X\314$\236X\031\371"
+	.ascii	"8\202\226\211\244\n0\275?!\0273\rqBS\272\311&d(m_\373\235M\001"
+	.ascii	"\234Z\225Ps~\003\004=J\007\317\371>\332\302\274\220\026>\362"
+	.ascii	"\024\026N^\346\264\244o\357\232\251qxz\240\330 \374\303Z1\036"
+	.ascii	"If\315G\323Y\005\260x\"@\246\246D\3238N\020\036) \226\357\035"
+	.ascii	":uO=\360\246\344\256\"\022\327\317)\310\366\276\020<?\235\304"
+	.ascii	"\220\341\357*}\t\244\342\242\334JeS\337L\201L/*q8\375%\261\370"
+	.ascii	"\266\230\177\356v\245\303\244hq\2361^\031ZX-\243\221\263|\026"
+	.ascii	"\260]s\273\361\210\200^\"\252\240P\031\bC\240\301\277r\273\002"
+	.ascii	"\241\313\005\024\373U\340\b\tH\027!\340sQ\202i\355)}@G\342\024"
+	.ascii	"~T\203\240]\3779\304`\244q\223\336l.\235\323\320?-!l\321J\373"
+	.ascii	"\032z\220>\251\002\323\345\256\307\bT,D\255S\313\034R\036\fF"
+	.ascii	"\337\217B\327%\034\246\333U\311\207"
+	.string	"ad\231F \207\210\347\0077\224`\336\266\265\001\2004\314\341\352\2001K\030N\252\304|&\037\276\n\265/O\2379\213\225;\221\220\264\330}s\205r\346\260\036\352\271\213\367\001\034H\373\035\007K\022\257$\006\\\013\2727\372\302\\KA\350\212\236W\247\241\372F\027:\333r\353\002\"V\215_\323O*\201\021+\212\366L[\236\220)7J\035\021+\331\220\332\201\251B\375\365\023v\321!\226z\005\212\"Ix\347\322\263M\314\201\317\325\313\223rA\b\3337IO\241\370G)\302J\334\030\351C\306b<\200m['\373*\023\226\345\326\337\303\234\177\"O`\203\340:\300\335WJT\241- y\304\260\251U\350%\275\207\007\340\235v\227 \240(\260D\246\206\347\031\013\3113^w%sX\210%\026\3274\263'=\366\262r\360\260\251\373\037\206\216r\027:SF\345b\242\211i\332\362\033\237\302,\361`"
+	.string	"\206\247O\301\"\334\271\336~\177\376\221\013*\362\356F\262\305\013\004\203\366\f\201\346\220\277>\212UN\247\261\001(I\203\311\243\306\020U\370\204\211\\\301\362\001\376\341\245\036BB\331\225"
+	.ascii	"g\313\356\266\353\236\363XH%\231_\016\356=\257\275\341\310\003"
+	.ascii	"\317l%c\031\013\234\236\267_\263\036\r\031r?\"\277N\300V\020"
+	.ascii	"\375\234\312b\273\2412A\305\"\007$d\007\013\316\312\225\260\013"
+	.ascii	"xG\332\b\221\177l\353\324\027v\266\337\032\b\266\026b\237\026"
+	.ascii	"\003\241WQ\334\323\022\271>y\220&\323\371w\017Q\354\027\205\340"
+	.ascii	"t\206\356F\306\266\217\274\224\353\306A\324~M\017\r\304xr\203"
+	.ascii	"\026\237\233\0233\223\251\t\304\201\324"
+	.string	"\204\354j\301\301\241\226\361\\(UT\322\337\342>\306\344I\265\023\023\3203\347k\213\202\345\214\017\251\035<V\177\362x#\305Y\314Q\026\340~\023\365En>\351\2556\035gX\277\326I6\003\211\256\210\205\221\205\nZ\256AS\007\340\362e\266\355\315q\357++\322\t\216\201\222\232\345\370\237h\3303\230\212\217\371\372\3567\bX\340\316\021Lwr\240\343\272\026\033\3534\\\330\367\332\262;u\231^\262D\026\020\335\233]`\005>\300<#\303\004\340pGf[q\335c\346^%!\365\307\032\212\346\360\354_\302\261\220T\364\343\"\n\275\377I\035\237\321\326\304Q\002\001\202\364\2169.\370\304\t\214br,\371\221%\340\004\263\230\3763l\332\016\024\020T\005\f\346\316\\\227Ok\025<\035\310q-\3502\371\274XD\337?\342\n\020\004\2548\252\272\300\261\305\371t\005\377\t\360\305G\244\306\006\273%\373%"
+	.string	"'J\272\205\267\330\366\013\360\265\t\257\306>3\"4i\306\234\222\263H\342\256\274l3aG\370~\320\301\332@"
+	.string	"\214o\353\241\203\330AI\301T'\321\327L3A\311\003y+j\273\205v\246O\226@\026\350~\013\004G\223/\204\031\320\"\216o\343\344\030\367\031\\\343\032\316\205\314\033'\261X3\306\335)\347Vq\213V\312\344=\264\237Vh\032\342\210\324\013\234c\243\213\016\350i\351\360JjY\bP\340\024\242\377"
+	.string	"N\365:\001\f\324\tE8\2078\247\353\250-\0058\250\256\270V\300\013+\373)\250\244\346\030\351\036\322?\004I\027\032\334\005g\236s\bf]\217\0212\343\253\243&\237Sg/\035\023\007\225\034Q,\310Y(\362\242\266S:j)c\372\034y\317(Z\005\225\353\243w\304\254cq\r\310\352\310E|\330C5\317\030\357\024h\213\312Z\367<\271aD\205Q4\nj\236\306\004\331\273\024\207\342\341\2776\257b\356\234\265"
+	.string	"^\231\330\331'\373?\317\036\225\240\033\333\306\370\004"
+	.ascii	"?|"
+	.string	",a\0222\312\222\3436\304\224b'\220\357\273"
+	.string	"\233\321\024\205\224\006\255\bz\227\337\032\204r\013\377\244\252\277\255\214\364\217\030\322mkB>\2156-\275\207\245N|\267'\373t\253\200df|\230\210\"=d(/pB\243{l\235G}\nN4\272\303\305B\307\177\007=\320z$p\264Vj\313Y\274\351zEH\353O\n\365\272\001\250\217\275\362\321\215\330\267-\355\371\030\370aS\223Y\332\357\0175\374do;\354\037xz\377\210\020\317Wgg\007e\340\324\373n\266i\257@\0353\223\320q\234A\032SB\023\363\334\3624E\030P]\026\223\251c\236"
+	.string	"\023\255A\273\233\317\001u\374\361\022\026 \034-\331\331P\204\273\021!\f\373\274m\034\031f\256\037\267\025Cm\322\n\3378\021\373\233\265\274w\307pv\217\234\030\2719\034M\202\t\313\266f\204m3\207#\271\030\020\331I\003\203\336\200r\031\234\363\222\372\306(\316KC\355\024\270\257r\232"
+	.string	")98w,K&\316\316\340F\256/\247\006\211f\3075\202"
+	.string	"\277\030\227\006Q\265\317\327g"
+	.string	"Z\300\tZ\020\272TD\301@\327\016(y"
+	.string	"\004^\305\b\ns\357\251\0012\250D\2030\272 \3210,\3553"
+	.ascii	"\027\370\256\036\020\005\376\257`\303\205\337R`\033\360\313\334"
+	.ascii	"\261\337k\002\376=\300Il\032\026\306\215\224uZ\221$Wy\247\361"
+	.ascii	"\200\003\023\"P\207\233\276!2ih3\235\356+V\352\365\035Jtk,\337"
+	.ascii	"\247\346\312:\226^\315 \201\306c\353\343\273#\241\256\350r=\360"
+	.ascii	"V\273\"y\353\321\341'\266\351\222\210\227\344A\243\260swK\207"
+	.ascii	"s\221\225\037\220\036;\205\231<J\007h\005\261\330nL6\001\364"
+	.ascii	"\004\252\235\016\257\r?\357\215g\302[\b5!\205x\210\303\252\212"
+	.ascii	"\213\373\0230\300\345\2752\004\225\375\234Z\3653\243fh\020\257"
+	.ascii	"\211\237\213\3014\035A`\326X4\371V\245\203_\201\333\271\315\321"
+	.ascii	"\350\2233\321\003\2622`\202V\3201\005\nH\305\t\334/Z\346\301"
+	.ascii	"\210P\301QsA\333\243\347\256%1\245P\300\205;C\232T\367\221\210"
+	.ascii	"\213@'\206|\221\237\344\337r/\215\337\254\333\213|\226\320~\327"
+	.ascii	"W\347\005!_\206\350W\004\353\325\341f0>\374\216\023n\233J>/v"
+	.ascii	"\275\rQ\272\016_\330\377\005\256\3008\003\024\3145\235\355#\273"
+	.ascii	"\0274\307rWL\213'\020S\352\342(T\322\to\272\273\376S\364\204"
+	.ascii	"\327\372\250E\022.\005//\220\277\213\323H\002\213\370D\177fQ"
+	.ascii	"\376`\3728\305\177;t:7O\363\332|\357\215\020\243\233-\3708\275"
+	.ascii	"\250\331@N\333\356\223\021\2407Pv\257\300\257>9\261\347\362\226"
+	.ascii	"\177.\264O\303r\007\3431N\226\351\3415\373#y\304\246\343f\352"
+	.ascii	"Xa\232\246\324\0071W\277\217\212\006\351\370\236T\246\377\273"
+	.ascii	"\235\310b\\W_&'r\355\211\242\235\243\216\224\315\212ky\307\367"
+	.ascii	"}^K\246f\024\350\265\336\370\347\036C\036\221\274}\017s\3656"
+	.ascii	"\341\235\335{#\177\264\277\374\300\035\016\253\2369\366\204\242"
+	.ascii	"\227S\037\346\236\272\277\233\241+"
+	.text
+	.section	.gnu.lto_.symtab.f77dd2d6946c2cc6,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"tcpDataOutAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f77dd2d6946c2cc6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
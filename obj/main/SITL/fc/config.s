@@ -0,0 +1,21840 @@
+	.file	"config.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/common/color.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/config/feature.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/sensor.h"
+	.file 10 "./src/main/drivers/resource.h"
+	.file 11 "./src/main/drivers/pwm_output.h"
+	.file 12 "./src/main/drivers/system.h"
+	.file 13 "./src/main/drivers/vcd.h"
+	.file 14 "./src/main/drivers/flash.h"
+	.file 15 "./src/main/fc/config.h"
+	.file 16 "./src/main/flight/pid.h"
+	.file 17 "./src/main/fc/fc_core.h"
+	.file 18 "./src/main/fc/rc_modes.h"
+	.file 19 "./src/main/flight/mixer.h"
+	.file 20 "./src/main/target/SITL/target.h"
+	.file 21 "./src/main/flight/servos.h"
+	.file 22 "./src/main/io/ledstrip.h"
+	.file 23 "./src/main/io/serial.h"
+	.file 24 "./src/main/sensors/sensors.h"
+	.file 25 "./src/main/sensors/acceleration.h"
+	.file 26 "./src/main/sensors/gyro.h"
+	.file 27 "./src/main/fc/config.c"
+	.file 28 "./src/main/config/config_eeprom.h"
+	.file 29 "./src/main/rx/rx.h"
+	.file 30 "./src/main/io/beeper.h"
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 32 "./src/main/flight/imu.h"
+	.file 33 "./src/main/flight/failsafe.h"
+	.file 34 "./src/main/flight/navigation.h"
+	.file 35 "./src/main/fc/rc_adjustments.h"
+	.file 36 "./src/main/fc/rc_controls.h"
+	.file 37 "./src/main/fc/fc_rc.h"
+	.file 38 "./src/main/fc/controlrate_profile.h"
+	.file 39 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config.c.ede58924
+	.weak	config.c.ede58924
+config.c.ede58924:
+	.long	0x1839
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF2974
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2451
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2452
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2453
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2454
+	.uleb128 0x3
+	.long	.LASF2456
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2455
+	.uleb128 0x3
+	.long	.LASF2457
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2458
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2459
+	.uleb128 0x3
+	.long	.LASF2460
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2461
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2462
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2463
+	.uleb128 0x3
+	.long	.LASF2464
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF2465
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF2466
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF2467
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2468
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2469
+	.uleb128 0x7
+	.long	0xe0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2470
+	.uleb128 0x16
+	.long	.LASF2791
+	.byte	0x14
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x197
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x16
+	.byte	0
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2494
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x15
+	.byte	0xe
+	.long	0x1c3
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2505
+	.byte	0x4
+	.byte	0x5
+	.byte	0x34
+	.long	0x1f1
+	.uleb128 0x9
+	.string	"h"
+	.byte	0x5
+	.byte	0x35
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x9
+	.string	"s"
+	.byte	0x5
+	.byte	0x36
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x9
+	.string	"v"
+	.byte	0x5
+	.byte	0x37
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2498
+	.byte	0x5
+	.byte	0x38
+	.byte	0x3
+	.long	0x1c3
+	.uleb128 0x3
+	.long	.LASF2499
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x232
+	.uleb128 0x10
+	.long	.LASF2500
+	.value	0xfff
+	.uleb128 0x10
+	.long	.LASF2501
+	.value	0xf000
+	.uleb128 0x10
+	.long	.LASF2502
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2504
+	.byte	0x6
+	.byte	0x29
+	.byte	0xf
+	.long	0x23e
+	.uleb128 0x27
+	.long	0x24e
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x28
+	.byte	0x8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x5
+	.long	0x26f
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x1a
+	.string	"fn"
+	.byte	0x6
+	.byte	0x33
+	.byte	0x16
+	.long	0x26f
+	.byte	0
+	.uleb128 0x5
+	.long	0x232
+	.uleb128 0x6
+	.long	.LASF2506
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2b
+	.long	0x2cf
+	.uleb128 0x9
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1fd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2507
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2508
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x197
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2509
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x197
+	.byte	0x10
+	.uleb128 0x9
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x30
+	.byte	0xf
+	.long	0x2cf
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2510
+	.byte	0x6
+	.byte	0x34
+	.byte	0x7
+	.long	0x24e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x197
+	.uleb128 0x3
+	.long	.LASF2511
+	.byte	0x6
+	.byte	0x35
+	.byte	0x3
+	.long	0x274
+	.uleb128 0x7
+	.long	0x2d4
+	.uleb128 0x6
+	.long	.LASF2512
+	.byte	0x4
+	.byte	0x7
+	.byte	0x16
+	.long	0x2ff
+	.uleb128 0x2
+	.long	.LASF2513
+	.byte	0x7
+	.byte	0x17
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2514
+	.byte	0x7
+	.byte	0x18
+	.byte	0x3
+	.long	0x2e5
+	.uleb128 0x7
+	.long	0x2ff
+	.uleb128 0x4
+	.long	.LASF2515
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x18
+	.long	0x2ff
+	.uleb128 0x4
+	.long	.LASF2516
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x45
+	.long	0x2ff
+	.uleb128 0x3
+	.long	.LASF2517
+	.byte	0x8
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x17
+	.byte	0xe
+	.long	0x378
+	.uleb128 0x1
+	.long	.LASF2518
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2527
+	.byte	0x9
+	.byte	0x21
+	.byte	0x3
+	.long	0x334
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2528
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2529
+	.uleb128 0xf
+	.long	0xab
+	.long	0x3a2
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x14
+	.byte	0xe
+	.long	0x4ca
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2534
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2536
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2538
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2557
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2558
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x40
+	.byte	0xe
+	.long	0x4fc
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2583
+	.byte	0x12
+	.byte	0xb
+	.byte	0x8e
+	.long	0x54a
+	.uleb128 0x2
+	.long	.LASF2584
+	.byte	0xb
+	.byte	0x8f
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2585
+	.byte	0xb
+	.byte	0x90
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2586
+	.byte	0xb
+	.byte	0x91
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2587
+	.byte	0xb
+	.byte	0x92
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2588
+	.byte	0xb
+	.byte	0x93
+	.byte	0xd
+	.long	0x54a
+	.byte	0x5
+	.byte	0
+	.uleb128 0xf
+	.long	0x328
+	.long	0x55a
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2589
+	.byte	0xb
+	.byte	0x94
+	.byte	0x3
+	.long	0x4fc
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x19
+	.byte	0xe
+	.long	0x59e
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2596
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2597
+	.byte	0xc
+	.byte	0x21
+	.byte	0x3
+	.long	0x566
+	.uleb128 0x6
+	.long	.LASF2598
+	.byte	0x3
+	.byte	0xd
+	.byte	0x16
+	.long	0x5de
+	.uleb128 0x2
+	.long	.LASF2599
+	.byte	0xd
+	.byte	0x17
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2600
+	.byte	0xd
+	.byte	0x18
+	.byte	0xc
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2601
+	.byte	0xd
+	.byte	0x19
+	.byte	0xc
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2602
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x3
+	.long	0x5aa
+	.uleb128 0x6
+	.long	.LASF2603
+	.byte	0x1
+	.byte	0xe
+	.byte	0x22
+	.long	0x604
+	.uleb128 0x2
+	.long	.LASF2604
+	.byte	0xe
+	.byte	0x23
+	.byte	0xd
+	.long	0x328
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2605
+	.byte	0xe
+	.byte	0x24
+	.byte	0x3
+	.long	0x5ea
+	.uleb128 0x7
+	.long	0x604
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x22
+	.byte	0xe
+	.long	0x6f3
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x80
+	.uleb128 0x10
+	.long	.LASF2613
+	.value	0x100
+	.uleb128 0x10
+	.long	.LASF2614
+	.value	0x200
+	.uleb128 0x10
+	.long	.LASF2615
+	.value	0x400
+	.uleb128 0x10
+	.long	.LASF2616
+	.value	0x1000
+	.uleb128 0x10
+	.long	.LASF2617
+	.value	0x2000
+	.uleb128 0x10
+	.long	.LASF2618
+	.value	0x4000
+	.uleb128 0x10
+	.long	.LASF2619
+	.value	0x8000
+	.uleb128 0xc
+	.long	.LASF2620
+	.long	0x10000
+	.uleb128 0xc
+	.long	.LASF2621
+	.long	0x20000
+	.uleb128 0xc
+	.long	.LASF2622
+	.long	0x40000
+	.uleb128 0xc
+	.long	.LASF2623
+	.long	0x80000
+	.uleb128 0xc
+	.long	.LASF2624
+	.long	0x100000
+	.uleb128 0xc
+	.long	.LASF2625
+	.long	0x200000
+	.uleb128 0xc
+	.long	.LASF2626
+	.long	0x400000
+	.uleb128 0xc
+	.long	.LASF2627
+	.long	0x800000
+	.uleb128 0xc
+	.long	.LASF2628
+	.long	0x2000000
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x4000000
+	.uleb128 0xc
+	.long	.LASF2630
+	.long	0x8000000
+	.uleb128 0xc
+	.long	.LASF2631
+	.long	0x10000000
+	.uleb128 0xc
+	.long	.LASF2632
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2633
+	.byte	0x15
+	.byte	0xf
+	.byte	0x46
+	.long	0x741
+	.uleb128 0x2
+	.long	.LASF2634
+	.byte	0xf
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2635
+	.byte	0xf
+	.byte	0x48
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2636
+	.byte	0xf
+	.byte	0x49
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2637
+	.byte	0xf
+	.byte	0x4a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2638
+	.byte	0xf
+	.byte	0x4e
+	.byte	0xa
+	.long	0x741
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0x98
+	.long	0x751
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2639
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x3
+	.long	0x6f3
+	.uleb128 0x7
+	.long	0x751
+	.uleb128 0x4
+	.long	.LASF2640
+	.byte	0xf
+	.byte	0x59
+	.byte	0x17
+	.long	0x751
+	.uleb128 0x4
+	.long	.LASF2641
+	.byte	0xf
+	.byte	0x59
+	.byte	0x42
+	.long	0x751
+	.uleb128 0x4
+	.long	.LASF2642
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x16
+	.long	0x604
+	.uleb128 0x4
+	.long	.LASF2643
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x3f
+	.long	0x604
+	.uleb128 0x4
+	.long	.LASF2644
+	.byte	0xf
+	.byte	0x5f
+	.byte	0x15
+	.long	0x5de
+	.uleb128 0x4
+	.long	.LASF2645
+	.byte	0xf
+	.byte	0x5f
+	.byte	0x3c
+	.long	0x5de
+	.uleb128 0x6
+	.long	.LASF2646
+	.byte	0x4c
+	.byte	0x10
+	.byte	0x4a
+	.long	0x923
+	.uleb128 0x9
+	.string	"pid"
+	.byte	0x10
+	.byte	0x4b
+	.byte	0xc
+	.long	0xd4d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2647
+	.byte	0x10
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2648
+	.byte	0x10
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc8
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2649
+	.byte	0x10
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2650
+	.byte	0x10
+	.byte	0x50
+	.byte	0xe
+	.long	0xc8
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2651
+	.byte	0x10
+	.byte	0x51
+	.byte	0xe
+	.long	0xc8
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2652
+	.byte	0x10
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2653
+	.byte	0x10
+	.byte	0x53
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2654
+	.byte	0x10
+	.byte	0x54
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2655
+	.byte	0x10
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2656
+	.byte	0x10
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2657
+	.byte	0x10
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2658
+	.byte	0x10
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2659
+	.byte	0x10
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2660
+	.byte	0x10
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2661
+	.byte	0x10
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2662
+	.byte	0x10
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2663
+	.byte	0x10
+	.byte	0x60
+	.byte	0xe
+	.long	0xc8
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2664
+	.byte	0x10
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2665
+	.byte	0x10
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2666
+	.byte	0x10
+	.byte	0x63
+	.byte	0xe
+	.long	0xc8
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2667
+	.byte	0x10
+	.byte	0x64
+	.byte	0xe
+	.long	0xc8
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2668
+	.byte	0x10
+	.byte	0x65
+	.byte	0xe
+	.long	0xc8
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2669
+	.byte	0x10
+	.byte	0x66
+	.byte	0xe
+	.long	0xc8
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2670
+	.byte	0x10
+	.byte	0x67
+	.byte	0xe
+	.long	0xc8
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2671
+	.byte	0x10
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2672
+	.byte	0x10
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2673
+	.byte	0x10
+	.byte	0x6a
+	.byte	0x18
+	.long	0xd07
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2674
+	.byte	0xf
+	.byte	0x63
+	.byte	0x1d
+	.long	0x92f
+	.uleb128 0x5
+	.long	0x7aa
+	.uleb128 0x6
+	.long	.LASF2675
+	.byte	0x4
+	.byte	0x11
+	.byte	0x1e
+	.long	0x95b
+	.uleb128 0x2
+	.long	.LASF2676
+	.byte	0x11
+	.byte	0x1f
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2677
+	.byte	0x11
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2678
+	.byte	0x11
+	.byte	0x21
+	.byte	0x3
+	.long	0x934
+	.uleb128 0x7
+	.long	0x95b
+	.uleb128 0x4
+	.long	.LASF2679
+	.byte	0x11
+	.byte	0x23
+	.byte	0x23
+	.long	0x95b
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x18
+	.byte	0xe
+	.long	0xa6a
+	.uleb128 0x1
+	.long	.LASF2680
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2682
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2689
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2692
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2700
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2704
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2705
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2708
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2709
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0x25
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2756
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x13
+	.byte	0x24
+	.byte	0xe
+	.long	0xb19
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2721
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2723
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2724
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2725
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2726
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2727
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2728
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2729
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2730
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2731
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2732
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2733
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2734
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2735
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2736
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2737
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2738
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2739
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2740
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2741
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2742
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2743
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2744
+	.byte	0x13
+	.byte	0x40
+	.byte	0x3
+	.long	0xa6a
+	.uleb128 0x6
+	.long	.LASF2745
+	.byte	0x10
+	.byte	0x13
+	.byte	0x43
+	.long	0xb66
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0x13
+	.byte	0x44
+	.byte	0xb
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x13
+	.byte	0x45
+	.byte	0xb
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2748
+	.byte	0x13
+	.byte	0x46
+	.byte	0xb
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x9
+	.string	"yaw"
+	.byte	0x13
+	.byte	0x47
+	.byte	0xb
+	.long	0xe0
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2749
+	.byte	0x13
+	.byte	0x48
+	.byte	0x3
+	.long	0xb25
+	.uleb128 0x7
+	.long	0xb66
+	.uleb128 0x6
+	.long	.LASF2750
+	.byte	0x10
+	.byte	0x13
+	.byte	0x4d
+	.long	0xbab
+	.uleb128 0x2
+	.long	.LASF2751
+	.byte	0x13
+	.byte	0x4e
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2752
+	.byte	0x13
+	.byte	0x4f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2753
+	.byte	0x13
+	.byte	0x50
+	.byte	0x19
+	.long	0xbab
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xb72
+	.uleb128 0x3
+	.long	.LASF2754
+	.byte	0x13
+	.byte	0x51
+	.byte	0x3
+	.long	0xb77
+	.uleb128 0x7
+	.long	0xbb0
+	.uleb128 0x6
+	.long	.LASF2755
+	.byte	0x2
+	.byte	0x13
+	.byte	0x53
+	.long	0xbe8
+	.uleb128 0x2
+	.long	.LASF2756
+	.byte	0x13
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2757
+	.byte	0x13
+	.byte	0x55
+	.byte	0x9
+	.long	0x19c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2758
+	.byte	0x13
+	.byte	0x56
+	.byte	0x3
+	.long	0xbc1
+	.uleb128 0x4
+	.long	.LASF2759
+	.byte	0x13
+	.byte	0x58
+	.byte	0x16
+	.long	0xbe8
+	.uleb128 0x6
+	.long	.LASF2760
+	.byte	0x1a
+	.byte	0x13
+	.byte	0x5a
+	.long	0xc4e
+	.uleb128 0x9
+	.string	"dev"
+	.byte	0x13
+	.byte	0x5b
+	.byte	0x16
+	.long	0x55a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2761
+	.byte	0x13
+	.byte	0x5c
+	.byte	0xe
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2762
+	.byte	0x13
+	.byte	0x5d
+	.byte	0xe
+	.long	0xc8
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2763
+	.byte	0x13
+	.byte	0x5e
+	.byte	0xe
+	.long	0xc8
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2764
+	.byte	0x13
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2765
+	.byte	0x13
+	.byte	0x60
+	.byte	0x3
+	.long	0xc00
+	.uleb128 0x7
+	.long	0xc4e
+	.uleb128 0x4
+	.long	.LASF2766
+	.byte	0x13
+	.byte	0x62
+	.byte	0x16
+	.long	0xc4e
+	.uleb128 0xf
+	.long	0xbbc
+	.long	0xc76
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x7
+	.long	0xc6b
+	.uleb128 0x4
+	.long	.LASF2767
+	.byte	0x13
+	.byte	0x68
+	.byte	0x16
+	.long	0xc76
+	.uleb128 0xf
+	.long	0xab
+	.long	0xc97
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x25
+	.byte	0xe
+	.long	0xce7
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xe
+	.long	0xd07
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2780
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2781
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2782
+	.byte	0x10
+	.byte	0x42
+	.byte	0x3
+	.long	0xce7
+	.uleb128 0x6
+	.long	.LASF2783
+	.byte	0x3
+	.byte	0x10
+	.byte	0x44
+	.long	0xd41
+	.uleb128 0x9
+	.string	"P"
+	.byte	0x10
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x9
+	.string	"I"
+	.byte	0x10
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x9
+	.string	"D"
+	.byte	0x10
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2784
+	.byte	0x10
+	.byte	0x48
+	.byte	0x3
+	.long	0xd13
+	.uleb128 0xf
+	.long	0xd41
+	.long	0xd5d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2785
+	.byte	0x10
+	.byte	0x6b
+	.byte	0x3
+	.long	0x7aa
+	.uleb128 0x7
+	.long	0xd5d
+	.uleb128 0xf
+	.long	0xd5d
+	.long	0xd7e
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2786
+	.byte	0x10
+	.byte	0x6d
+	.byte	0x15
+	.long	0xd6e
+	.uleb128 0x6
+	.long	.LASF2787
+	.byte	0x1
+	.byte	0x10
+	.byte	0x6f
+	.long	0xda4
+	.uleb128 0x2
+	.long	.LASF2788
+	.byte	0x10
+	.byte	0x70
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2789
+	.byte	0x10
+	.byte	0x71
+	.byte	0x3
+	.long	0xd8a
+	.uleb128 0x7
+	.long	0xda4
+	.uleb128 0x4
+	.long	.LASF2790
+	.byte	0x10
+	.byte	0x73
+	.byte	0x14
+	.long	0xda4
+	.uleb128 0x16
+	.long	.LASF2792
+	.byte	0x10
+	.byte	0x79
+	.byte	0x5
+	.long	0x19c
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x19
+	.byte	0x6
+	.long	0xe35
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2794
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2795
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2796
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2797
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2798
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2799
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2800
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2801
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2802
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0xe
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2808
+	.byte	0x15
+	.byte	0x29
+	.byte	0x3
+	.long	0xdcd
+	.uleb128 0x6
+	.long	.LASF2809
+	.byte	0x7
+	.byte	0x15
+	.byte	0x4e
+	.long	0xea9
+	.uleb128 0x2
+	.long	.LASF2810
+	.byte	0x15
+	.byte	0x4f
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2811
+	.byte	0x15
+	.byte	0x50
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2812
+	.byte	0x15
+	.byte	0x51
+	.byte	0xc
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2813
+	.byte	0x15
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x9
+	.string	"min"
+	.byte	0x15
+	.byte	0x53
+	.byte	0xc
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x9
+	.string	"max"
+	.byte	0x15
+	.byte	0x54
+	.byte	0xc
+	.long	0x9f
+	.byte	0x5
+	.uleb128 0x9
+	.string	"box"
+	.byte	0x15
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2814
+	.byte	0x15
+	.byte	0x56
+	.byte	0x3
+	.long	0xe41
+	.uleb128 0x7
+	.long	0xea9
+	.uleb128 0x6
+	.long	.LASF2815
+	.byte	0x10
+	.byte	0x15
+	.byte	0x5f
+	.long	0xee1
+	.uleb128 0x2
+	.long	.LASF2816
+	.byte	0x15
+	.byte	0x60
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2817
+	.byte	0x15
+	.byte	0x61
+	.byte	0x19
+	.long	0xee1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xeb5
+	.uleb128 0x3
+	.long	.LASF2818
+	.byte	0x15
+	.byte	0x62
+	.byte	0x3
+	.long	0xeba
+	.uleb128 0x7
+	.long	0xee6
+	.uleb128 0xf
+	.long	0xef2
+	.long	0xf02
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x7
+	.long	0xef7
+	.uleb128 0x4
+	.long	.LASF2819
+	.byte	0x15
+	.byte	0x64
+	.byte	0x1b
+	.long	0xf02
+	.uleb128 0x6
+	.long	.LASF2820
+	.byte	0x6
+	.byte	0x16
+	.byte	0x7c
+	.long	0xf2d
+	.uleb128 0x2
+	.long	.LASF2821
+	.byte	0x16
+	.byte	0x7d
+	.byte	0xd
+	.long	0xf2d
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0xf3d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2822
+	.byte	0x16
+	.byte	0x7e
+	.byte	0x3
+	.long	0xf13
+	.uleb128 0x7
+	.long	0xf3d
+	.uleb128 0x6
+	.long	.LASF2823
+	.byte	0xb
+	.byte	0x16
+	.byte	0x80
+	.long	0xf68
+	.uleb128 0x2
+	.long	.LASF2821
+	.byte	0x16
+	.byte	0x81
+	.byte	0xd
+	.long	0xf68
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0xf78
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2824
+	.byte	0x16
+	.byte	0x82
+	.byte	0x3
+	.long	0xf4e
+	.uleb128 0x16
+	.long	.LASF2825
+	.byte	0x16
+	.byte	0x99
+	.byte	0xd
+	.long	0xf90
+	.uleb128 0x5
+	.long	0x1f1
+	.uleb128 0x16
+	.long	.LASF2826
+	.byte	0x16
+	.byte	0x9a
+	.byte	0x1b
+	.long	0xfa1
+	.uleb128 0x5
+	.long	0xf49
+	.uleb128 0x16
+	.long	.LASF2827
+	.byte	0x16
+	.byte	0x9b
+	.byte	0x17
+	.long	0xf78
+	.uleb128 0xa
+	.byte	0x5
+	.long	0x7c
+	.byte	0x17
+	.byte	0x48
+	.byte	0xe
+	.long	0x1008
+	.uleb128 0x2a
+	.long	.LASF2828
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2840
+	.byte	0x17
+	.byte	0x55
+	.byte	0x3
+	.long	0xfb2
+	.uleb128 0x6
+	.long	.LASF2841
+	.byte	0xc
+	.byte	0x17
+	.byte	0x6c
+	.long	0x106f
+	.uleb128 0x2
+	.long	.LASF2842
+	.byte	0x17
+	.byte	0x6d
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2843
+	.byte	0x17
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x1008
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2844
+	.byte	0x17
+	.byte	0x6f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2845
+	.byte	0x17
+	.byte	0x70
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2846
+	.byte	0x17
+	.byte	0x71
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2847
+	.byte	0x17
+	.byte	0x72
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2848
+	.byte	0x17
+	.byte	0x73
+	.byte	0x3
+	.long	0x1014
+	.uleb128 0x6
+	.long	.LASF2849
+	.byte	0x64
+	.byte	0x17
+	.byte	0x75
+	.long	0x10af
+	.uleb128 0x2
+	.long	.LASF2850
+	.byte	0x17
+	.byte	0x76
+	.byte	0x18
+	.long	0x10af
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2851
+	.byte	0x17
+	.byte	0x77
+	.byte	0xe
+	.long	0xc8
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2852
+	.byte	0x17
+	.byte	0x78
+	.byte	0xd
+	.long	0xb7
+	.byte	0x62
+	.byte	0
+	.uleb128 0xf
+	.long	0x106f
+	.long	0x10bf
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2853
+	.byte	0x17
+	.byte	0x79
+	.byte	0x3
+	.long	0x107b
+	.uleb128 0x7
+	.long	0x10bf
+	.uleb128 0x4
+	.long	.LASF2854
+	.byte	0x17
+	.byte	0x7b
+	.byte	0x17
+	.long	0x10bf
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x14
+	.byte	0xe
+	.long	0x1108
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2860
+	.byte	0x6
+	.byte	0x18
+	.byte	0x1e
+	.long	0x113c
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x18
+	.byte	0x1f
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2748
+	.byte	0x18
+	.byte	0x20
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x9
+	.string	"yaw"
+	.byte	0x18
+	.byte	0x21
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2861
+	.byte	0x18
+	.byte	0x22
+	.byte	0x3
+	.long	0x1108
+	.uleb128 0x1e
+	.long	.LASF2866
+	.byte	0x6
+	.byte	0x18
+	.byte	0x24
+	.long	0x116d
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0x18
+	.byte	0x25
+	.byte	0xd
+	.long	0x392
+	.uleb128 0x1f
+	.long	.LASF2862
+	.byte	0x18
+	.byte	0x26
+	.byte	0x1f
+	.long	0x113c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2863
+	.byte	0x18
+	.byte	0x27
+	.byte	0x3
+	.long	0x1148
+	.uleb128 0x6
+	.long	.LASF2864
+	.byte	0x4
+	.byte	0x19
+	.byte	0x35
+	.long	0x11a0
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x19
+	.byte	0x36
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2748
+	.byte	0x19
+	.byte	0x37
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2865
+	.byte	0x19
+	.byte	0x38
+	.byte	0x3
+	.long	0x1179
+	.uleb128 0x1e
+	.long	.LASF2867
+	.byte	0x4
+	.byte	0x19
+	.byte	0x3a
+	.long	0x11d1
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0x19
+	.byte	0x3b
+	.byte	0xd
+	.long	0xc87
+	.uleb128 0x1f
+	.long	.LASF2862
+	.byte	0x19
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x11a0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2868
+	.byte	0x19
+	.byte	0x3d
+	.byte	0x3
+	.long	0x11ac
+	.uleb128 0x6
+	.long	.LASF2869
+	.byte	0x14
+	.byte	0x19
+	.byte	0x40
+	.long	0x122b
+	.uleb128 0x2
+	.long	.LASF2870
+	.byte	0x19
+	.byte	0x41
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2871
+	.byte	0x19
+	.byte	0x42
+	.byte	0x14
+	.long	0x378
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2872
+	.byte	0x19
+	.byte	0x43
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2873
+	.byte	0x19
+	.byte	0x44
+	.byte	0x1b
+	.long	0x116d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2874
+	.byte	0x19
+	.byte	0x45
+	.byte	0x19
+	.long	0x11d1
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2875
+	.byte	0x19
+	.byte	0x46
+	.byte	0x3
+	.long	0x11dd
+	.uleb128 0x7
+	.long	0x122b
+	.uleb128 0x4
+	.long	.LASF2876
+	.byte	0x19
+	.byte	0x48
+	.byte	0x1e
+	.long	0x122b
+	.uleb128 0x6
+	.long	.LASF2877
+	.byte	0x18
+	.byte	0x1a
+	.byte	0x4c
+	.long	0x1325
+	.uleb128 0x2
+	.long	.LASF2878
+	.byte	0x1a
+	.byte	0x4d
+	.byte	0x14
+	.long	0x378
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2879
+	.byte	0x1a
+	.byte	0x4e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2880
+	.byte	0x1a
+	.byte	0x4f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2881
+	.byte	0x1a
+	.byte	0x50
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2882
+	.byte	0x1a
+	.byte	0x51
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2883
+	.byte	0x1a
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2884
+	.byte	0x1a
+	.byte	0x53
+	.byte	0xd
+	.long	0x19c
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2885
+	.byte	0x1a
+	.byte	0x54
+	.byte	0xd
+	.long	0x19c
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2886
+	.byte	0x1a
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2887
+	.byte	0x1a
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2888
+	.byte	0x1a
+	.byte	0x57
+	.byte	0xe
+	.long	0xc8
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2889
+	.byte	0x1a
+	.byte	0x58
+	.byte	0xe
+	.long	0xc8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2890
+	.byte	0x1a
+	.byte	0x59
+	.byte	0xe
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2891
+	.byte	0x1a
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc8
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2892
+	.byte	0x1a
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2893
+	.byte	0x1a
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2894
+	.byte	0x1a
+	.byte	0x5d
+	.byte	0x3
+	.long	0x1248
+	.uleb128 0x7
+	.long	0x1325
+	.uleb128 0x4
+	.long	.LASF2895
+	.byte	0x1a
+	.byte	0x5f
+	.byte	0x15
+	.long	0x1325
+	.uleb128 0x12
+	.long	0x923
+	.byte	0x66
+	.byte	0xf
+	.uleb128 0x4
+	.long	.LASF2896
+	.byte	0x1b
+	.byte	0x73
+	.byte	0x1e
+	.long	0x30b
+	.uleb128 0x12
+	.long	0x310
+	.byte	0x73
+	.byte	0x4d
+	.uleb128 0x12
+	.long	0x31c
+	.byte	0x73
+	.byte	0x73
+	.uleb128 0x4
+	.long	.LASF2897
+	.byte	0x1b
+	.byte	0x73
+	.byte	0xa1
+	.long	0x2e0
+	.uleb128 0x1b
+	.long	0x1363
+	.byte	0xcc
+	.uleb128 0x1c
+	.long	0x1349
+	.byte	0x75
+	.byte	0x17
+	.uleb128 0x4
+	.long	.LASF2898
+	.byte	0x1b
+	.byte	0x79
+	.byte	0x1d
+	.long	0x75d
+	.uleb128 0x12
+	.long	0x762
+	.byte	0x79
+	.byte	0x4a
+	.uleb128 0x12
+	.long	0x76e
+	.byte	0x79
+	.byte	0x6e
+	.uleb128 0x4
+	.long	.LASF2899
+	.byte	0x1b
+	.byte	0x79
+	.byte	0x9b
+	.long	0x2e0
+	.uleb128 0x1b
+	.long	0x1396
+	.byte	0xc5
+	.uleb128 0x1c
+	.long	0x137c
+	.byte	0x86
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF2900
+	.byte	0x1b
+	.byte	0xa5
+	.byte	0x1c
+	.long	0x610
+	.uleb128 0x12
+	.long	0x77a
+	.byte	0xa5
+	.byte	0x47
+	.uleb128 0x12
+	.long	0x786
+	.byte	0xa5
+	.byte	0x69
+	.uleb128 0x4
+	.long	.LASF2901
+	.byte	0x1b
+	.byte	0xa5
+	.byte	0x95
+	.long	0x2e0
+	.uleb128 0x1b
+	.long	0x13c9
+	.byte	0xbe
+	.uleb128 0x1c
+	.long	0x13af
+	.byte	0xac
+	.byte	0x15
+	.uleb128 0x12
+	.long	0x792
+	.byte	0xbe
+	.byte	0xe
+	.uleb128 0x12
+	.long	0x79e
+	.byte	0xbe
+	.byte	0x2e
+	.uleb128 0x4
+	.long	.LASF2902
+	.byte	0x1b
+	.byte	0xbe
+	.byte	0x59
+	.long	0x2e0
+	.uleb128 0x1b
+	.long	0x13f0
+	.byte	0x81
+	.uleb128 0xd
+	.long	.LASF2905
+	.byte	0x1e
+	.byte	0x3f
+	.long	0x1413
+	.uleb128 0x8
+	.long	0xb7
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2907
+	.byte	0x19
+	.long	0x19c
+	.uleb128 0x17
+	.long	.LASF2903
+	.byte	0x1c
+	.byte	0x1b
+	.uleb128 0x17
+	.long	.LASF2904
+	.byte	0x1d
+	.byte	0xad
+	.uleb128 0xd
+	.long	.LASF2906
+	.byte	0xc
+	.byte	0x25
+	.long	0x143c
+	.uleb128 0x8
+	.long	0x59e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2908
+	.byte	0x1a
+	.long	0x19c
+	.uleb128 0x17
+	.long	.LASF2909
+	.byte	0x1d
+	.byte	0xac
+	.uleb128 0x2b
+	.long	.LASF2911
+	.byte	0x1f
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0x1464
+	.uleb128 0x8
+	.long	0xe0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2910
+	.byte	0x17
+	.byte	0x8f
+	.long	0x1475
+	.uleb128 0x8
+	.long	0x1475
+	.byte	0
+	.uleb128 0x5
+	.long	0x10bf
+	.uleb128 0x21
+	.long	.LASF2912
+	.byte	0x17
+	.byte	0x86
+	.long	0x19c
+	.long	0x148f
+	.uleb128 0x8
+	.long	0x148f
+	.byte	0
+	.uleb128 0x5
+	.long	0x10cb
+	.uleb128 0xd
+	.long	.LASF2913
+	.byte	0x7
+	.byte	0x20
+	.long	0x14a5
+	.uleb128 0x8
+	.long	0xd4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2914
+	.byte	0x7
+	.byte	0x1f
+	.long	0x14b6
+	.uleb128 0x8
+	.long	0xd4
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2915
+	.byte	0x7
+	.byte	0x1d
+	.long	0x19c
+	.long	0x14cb
+	.uleb128 0x8
+	.long	0xd4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2916
+	.byte	0x20
+	.byte	0x43
+	.long	0x14dc
+	.uleb128 0x8
+	.long	0xc8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2917
+	.byte	0x19
+	.byte	0x51
+	.long	0x14ed
+	.uleb128 0x8
+	.long	0xc8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2918
+	.byte	0x19
+	.byte	0x50
+	.long	0x14fe
+	.uleb128 0x8
+	.long	0x14fe
+	.byte	0
+	.uleb128 0x5
+	.long	0x1148
+	.uleb128 0x17
+	.long	.LASF2919
+	.byte	0x21
+	.byte	0x4e
+	.uleb128 0xd
+	.long	.LASF2920
+	.byte	0x22
+	.byte	0x39
+	.long	0x151b
+	.uleb128 0x8
+	.long	0x92f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2921
+	.byte	0x23
+	.byte	0x69
+	.long	0x152c
+	.uleb128 0x8
+	.long	0x92f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2922
+	.byte	0x24
+	.byte	0x77
+	.long	0x153d
+	.uleb128 0x8
+	.long	0x92f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2923
+	.byte	0x23
+	.byte	0x64
+	.uleb128 0x17
+	.long	.LASF2924
+	.byte	0x25
+	.byte	0x1a
+	.uleb128 0xd
+	.long	.LASF2925
+	.byte	0x10
+	.byte	0x85
+	.long	0x155c
+	.uleb128 0x8
+	.long	0x155c
+	.byte	0
+	.uleb128 0x5
+	.long	0xd69
+	.uleb128 0xd
+	.long	.LASF2926
+	.byte	0x26
+	.byte	0x2a
+	.long	0x1572
+	.uleb128 0x8
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2927
+	.byte	0x6
+	.byte	0xbd
+	.byte	0x6
+	.long	0x1580
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2928
+	.value	0x285
+	.long	0x1598
+	.uleb128 0x15
+	.long	.LASF2931
+	.value	0x285
+	.byte	0x29
+	.long	0xd4
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2929
+	.value	0x27c
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x13
+	.long	.LASF2930
+	.value	0x273
+	.long	0x15bc
+	.uleb128 0x15
+	.long	.LASF2931
+	.value	0x273
+	.byte	0x20
+	.long	0xd4
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2932
+	.value	0x26a
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x14
+	.long	.LASF2938
+	.value	0x263
+	.uleb128 0x13
+	.long	.LASF2933
+	.value	0x25a
+	.long	0x15e7
+	.uleb128 0x15
+	.long	.LASF2931
+	.value	0x25a
+	.byte	0x1e
+	.long	0xd4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2934
+	.value	0x251
+	.long	0x15ff
+	.uleb128 0x15
+	.long	.LASF2935
+	.value	0x251
+	.byte	0x1e
+	.long	0xb7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2936
+	.value	0x248
+	.long	0x1617
+	.uleb128 0x15
+	.long	.LASF2931
+	.value	0x248
+	.byte	0x1c
+	.long	0xd4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2937
+	.value	0x23d
+	.long	0x162f
+	.uleb128 0x15
+	.long	.LASF2634
+	.value	0x23d
+	.byte	0x1f
+	.long	0xb7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2939
+	.value	0x235
+	.uleb128 0x14
+	.long	.LASF2940
+	.value	0x22d
+	.uleb128 0x14
+	.long	.LASF2941
+	.value	0x227
+	.uleb128 0x14
+	.long	.LASF2942
+	.value	0x21a
+	.uleb128 0x14
+	.long	.LASF2943
+	.value	0x1fc
+	.uleb128 0x13
+	.long	.LASF2944
+	.value	0x1af
+	.long	0x16a2
+	.uleb128 0x18
+	.long	.LASF2945
+	.value	0x1b9
+	.byte	0xb
+	.long	0xe0
+	.uleb128 0x18
+	.long	.LASF2946
+	.value	0x1d5
+	.byte	0x11
+	.long	0xe7
+	.uleb128 0x18
+	.long	.LASF2947
+	.value	0x1d6
+	.byte	0xb
+	.long	0xe0
+	.uleb128 0x2e
+	.long	0x1693
+	.uleb128 0x18
+	.long	.LASF2948
+	.value	0x1ee
+	.byte	0x17
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x18
+	.long	.LASF2949
+	.value	0x1f4
+	.byte	0x12
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2950
+	.value	0x14f
+	.long	0x16ba
+	.uleb128 0x18
+	.long	.LASF2756
+	.value	0x156
+	.byte	0x11
+	.long	0xb19
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2951
+	.value	0x139
+	.uleb128 0x14
+	.long	.LASF2952
+	.value	0x127
+	.uleb128 0x19
+	.long	.LASF2953
+	.value	0x121
+	.byte	0xa
+	.long	0xc8
+	.uleb128 0x19
+	.long	.LASF2954
+	.value	0x11c
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x30
+	.long	.LASF2971
+	.byte	0x1b
+	.value	0x113
+	.byte	0xd
+	.long	0x16fa
+	.uleb128 0x15
+	.long	.LASF2634
+	.value	0x113
+	.byte	0x23
+	.long	0xb7
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2955
+	.value	0x10e
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2956
+	.byte	0x1a
+	.byte	0x5f
+	.byte	0xbb
+	.long	0x1712
+	.uleb128 0x5
+	.long	0x1325
+	.uleb128 0xe
+	.long	.LASF2957
+	.byte	0x1a
+	.byte	0x5f
+	.byte	0x6f
+	.long	0x1723
+	.uleb128 0x5
+	.long	0x1331
+	.uleb128 0x31
+	.long	.LASF2958
+	.byte	0x19
+	.byte	0x48
+	.value	0x103
+	.long	0x1735
+	.uleb128 0x5
+	.long	0x122b
+	.uleb128 0xe
+	.long	.LASF2959
+	.byte	0x19
+	.byte	0x48
+	.byte	0x9c
+	.long	0x1746
+	.uleb128 0x5
+	.long	0x1237
+	.uleb128 0xe
+	.long	.LASF2960
+	.byte	0x17
+	.byte	0x7b
+	.byte	0xcb
+	.long	0x1475
+	.uleb128 0xe
+	.long	.LASF2961
+	.byte	0x17
+	.byte	0x7b
+	.byte	0x79
+	.long	0x148f
+	.uleb128 0xe
+	.long	.LASF2962
+	.byte	0x10
+	.byte	0x73
+	.byte	0xb3
+	.long	0x176f
+	.uleb128 0x5
+	.long	0xda4
+	.uleb128 0xe
+	.long	.LASF2963
+	.byte	0x10
+	.byte	0x73
+	.byte	0x6a
+	.long	0x1780
+	.uleb128 0x5
+	.long	0xdb0
+	.uleb128 0x32
+	.long	.LASF2975
+	.byte	0x10
+	.byte	0x6d
+	.byte	0xe2
+	.long	0x17a2
+	.long	0x17a2
+	.uleb128 0x22
+	.long	.LASF2964
+	.byte	0x10
+	.byte	0x6d
+	.byte	0xf9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0xd5d
+	.uleb128 0xe
+	.long	.LASF2965
+	.byte	0x13
+	.byte	0x62
+	.byte	0xc3
+	.long	0x17b3
+	.uleb128 0x5
+	.long	0xc4e
+	.uleb128 0xe
+	.long	.LASF2966
+	.byte	0x13
+	.byte	0x62
+	.byte	0x74
+	.long	0x17c4
+	.uleb128 0x5
+	.long	0xc5a
+	.uleb128 0xe
+	.long	.LASF2967
+	.byte	0x13
+	.byte	0x58
+	.byte	0xc3
+	.long	0x17d5
+	.uleb128 0x5
+	.long	0xbe8
+	.uleb128 0xe
+	.long	.LASF2968
+	.byte	0x11
+	.byte	0x23
+	.byte	0xb5
+	.long	0x17e6
+	.uleb128 0x5
+	.long	0x967
+	.uleb128 0xe
+	.long	.LASF2969
+	.byte	0xf
+	.byte	0x59
+	.byte	0xcb
+	.long	0x17f7
+	.uleb128 0x5
+	.long	0x751
+	.uleb128 0xe
+	.long	.LASF2970
+	.byte	0xf
+	.byte	0x59
+	.byte	0x79
+	.long	0x1808
+	.uleb128 0x5
+	.long	0x75d
+	.uleb128 0x33
+	.long	.LASF2972
+	.byte	0x27
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x23
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x23
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x22
+	.long	.LASF2973
+	.byte	0x27
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 40 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 42 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.file 43 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 45 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 46 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 49 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 51 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x33
+	.file 52 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 56 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 57 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 60 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3e
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 70 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x46
+	.file 71 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 72 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 73 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 74 "./src/main/blackbox/blackbox_io.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 75 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4b
+	.file 76 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4c
+	.byte	0x4
+	.file 77 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1426
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 78 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 79 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1462
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.file 80 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 81 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x51
+	.file 82 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x52
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.file 83 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x53
+	.file 84 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x54
+	.file 85 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x4
+	.file 86 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 87 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1666
+	.file 88 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1668
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1669
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1678
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1683
+	.byte	0x4
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 96 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1716
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1717
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x64
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0x4
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1721
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1722
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x68
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1723
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1724
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1736
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1743
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1744
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1745
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1748
+	.byte	0x4
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x70
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1749
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 114 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1780
+	.byte	0x4
+	.file 115 "./src/main/drivers/inverter.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x73
+	.file 116 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x74
+	.file 117 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x75
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 118 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x76
+	.file 119 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x77
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 120 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2197
+	.byte	0x4
+	.byte	0x4
+	.file 121 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x79
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 122 "./src/main/drivers/light_ws2811strip.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 123 "./src/main/drivers/max7456.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x7b
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 124 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x7c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xb
+	.file 125 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7d
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2222
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 126 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 127 "./src/main/drivers/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x7f
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2231
+	.byte	0x4
+	.file 128 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x80
+	.byte	0x4
+	.file 129 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x81
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 130 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x82
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0xd
+	.byte	0x4
+	.file 131 "./src/main/drivers/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0xf
+	.file 132 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2269
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2270
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.file 133 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 134 "./src/main/flight/altitude.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x1e
+	.byte	0x4
+	.file 135 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x87
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2347
+	.byte	0x4
+	.file 136 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x88
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.file 137 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x89
+	.byte	0x4
+	.file 138 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x8a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 139 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x8b
+	.byte	0x4
+	.file 140 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x8c
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2402
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.file 141 "./src/main/rx/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x8d
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x4
+	.file 142 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x8e
+	.file 143 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8f
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2437
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2438
+	.byte	0x4
+	.file 144 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x90
+	.file 145 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x91
+	.file 146 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x92
+	.byte	0x4
+	.byte	0x4
+	.file 147 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x93
+	.file 148 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x94
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x4
+	.file 149 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x95
+	.byte	0x4
+	.file 150 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.file 151 "./src/main/telemetry/telemetry.h"
+	.byte	0x3
+	.uleb128 0x63
+	.uleb128 0x97
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2446
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2450
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1417
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1422
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.30.0a00ae9199efd475f4080a54886f9f0b,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1425
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.3217b4575ccf3c370ae0b5186c11b495,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1432
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1441
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1480
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1665
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1735
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1742
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1747
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1782
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1816
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2196
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_ws2811strip.h.22.ee1db0714b5acb451d4c66fa4bc6339a,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2214
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.max7456.h.21.59264cd1e20507bb3a63ba829e3208aa,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2221
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2230
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2238
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.transponder_ir.h.23.b50bed893bc0dbf7b1e0fb37ef14e2d7,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2268
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2281
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2316
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2346
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2355
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2427
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_spi.h.64.fd2df210de894f8eb89a02c524951c8f,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2433
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2445
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x19
+	.long	.LASF1
+	.long	.LASF2976
+	.long	.LASF2977
+	.long	.LASF2978
+	.long	.LASF2979
+	.long	.LASF2980
+	.long	.LASF2981
+	.long	.LASF2982
+	.long	.LASF2983
+	.long	.LASF2984
+	.long	.LASF2985
+	.long	.LASF2986
+	.long	.LASF2987
+	.long	.LASF2988
+	.long	.LASF2989
+	.long	.LASF2990
+	.long	.LASF2991
+	.long	.LASF2992
+	.long	.LASF2993
+	.long	.LASF2994
+	.long	.LASF2995
+	.long	.LASF2996
+	.long	.LASF2997
+	.long	.LASF2998
+	.long	.LASF2999
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x98
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3000
+	.byte	0x14
+	.long	.LASF3001
+	.byte	0x14
+	.long	.LASF3002
+	.byte	0x14
+	.long	.LASF3003
+	.byte	0x2
+	.long	.LASF3004
+	.byte	0x4
+	.long	.LASF3005
+	.byte	0x5
+	.long	.LASF3006
+	.byte	0x5
+	.long	.LASF3007
+	.byte	0x9
+	.long	.LASF3008
+	.byte	0x9
+	.long	.LASF3009
+	.byte	0x9
+	.long	.LASF3010
+	.byte	0x9
+	.long	.LASF3011
+	.byte	0x9
+	.long	.LASF3012
+	.byte	0x9
+	.long	.LASF3013
+	.byte	0x9
+	.long	.LASF3014
+	.byte	0xa
+	.long	.LASF3015
+	.byte	0xb
+	.long	.LASF3016
+	.byte	0xa
+	.long	.LASF3017
+	.byte	0xa
+	.long	.LASF3018
+	.byte	0xb
+	.long	.LASF3019
+	.byte	0xf
+	.long	.LASF3020
+	.byte	0xb
+	.long	.LASF3021
+	.byte	0xc
+	.long	.LASF3022
+	.byte	0xc
+	.long	.LASF3023
+	.byte	0xe
+	.long	.LASF3024
+	.byte	0xe
+	.long	.LASF3025
+	.byte	0xe
+	.long	.LASF3026
+	.byte	0xa
+	.long	.LASF3027
+	.byte	0x5
+	.long	.LASF3028
+	.byte	0xd
+	.long	.LASF3029
+	.byte	0xc
+	.long	.LASF3030
+	.byte	0x14
+	.long	.LASF3031
+	.byte	0xb
+	.long	.LASF3032
+	.byte	0xb
+	.long	.LASF3033
+	.byte	0xb
+	.long	.LASF3034
+	.byte	0xa
+	.long	.LASF3035
+	.byte	0xa
+	.long	.LASF3036
+	.byte	0xa
+	.long	.LASF3037
+	.byte	0xa
+	.long	.LASF3038
+	.byte	0x4
+	.long	.LASF3039
+	.byte	0x17
+	.long	.LASF3040
+	.byte	0x18
+	.long	.LASF3041
+	.byte	0x18
+	.long	.LASF3041
+	.byte	0x17
+	.long	.LASF3042
+	.byte	0x14
+	.long	.LASF3043
+	.byte	0x17
+	.long	.LASF3044
+	.byte	0x17
+	.long	.LASF3045
+	.byte	0x14
+	.long	.LASF3046
+	.byte	0x14
+	.long	.LASF3047
+	.byte	0x16
+	.long	.LASF3048
+	.byte	0x14
+	.long	.LASF3049
+	.byte	0x15
+	.long	.LASF3050
+	.byte	0x15
+	.long	.LASF3051
+	.byte	0x14
+	.long	.LASF3052
+	.byte	0x14
+	.long	.LASF3053
+	.byte	0x14
+	.long	.LASF3054
+	.byte	0x17
+	.long	.LASF3055
+	.byte	0x18
+	.long	.LASF3056
+	.byte	0x13
+	.long	.LASF3057
+	.byte	0x13
+	.long	.LASF3058
+	.byte	0x17
+	.long	.LASF3059
+	.byte	0x17
+	.long	.LASF3060
+	.byte	0x14
+	.long	.LASF3061
+	.byte	0x14
+	.long	.LASF3062
+	.byte	0x14
+	.long	.LASF3063
+	.byte	0x14
+	.long	.LASF3064
+	.byte	0x14
+	.long	.LASF3065
+	.byte	0x14
+	.long	.LASF3066
+	.byte	0x14
+	.long	.LASF3067
+	.byte	0x14
+	.long	.LASF3068
+	.byte	0x12
+	.long	.LASF3069
+	.byte	0x10
+	.long	.LASF3070
+	.byte	0x10
+	.long	.LASF3071
+	.byte	0x2
+	.long	.LASF3072
+	.byte	0x1
+	.long	.LASF3073
+	.byte	0x3
+	.long	.LASF3074
+	.byte	0x9
+	.long	.LASF3075
+	.byte	0x4
+	.long	.LASF3076
+	.byte	0x4
+	.long	.LASF3077
+	.byte	0x4
+	.long	.LASF3078
+	.byte	0x5
+	.long	.LASF3079
+	.byte	0x6
+	.long	.LASF3080
+	.byte	0x9
+	.long	.LASF3081
+	.byte	0x9
+	.long	.LASF3082
+	.byte	0x9
+	.long	.LASF3083
+	.byte	0x9
+	.long	.LASF3084
+	.byte	0x6
+	.long	.LASF3085
+	.byte	0x17
+	.long	.LASF3086
+	.byte	0x17
+	.long	.LASF3087
+	.byte	0x13
+	.long	.LASF3088
+	.byte	0x13
+	.long	.LASF3089
+	.byte	0x14
+	.long	.LASF3090
+	.byte	0x14
+	.long	.LASF3086
+	.byte	0x14
+	.long	.LASF3091
+	.byte	0x13
+	.long	.LASF3092
+	.byte	0x14
+	.long	.LASF3075
+	.byte	0x17
+	.long	.LASF3075
+	.byte	0x14
+	.long	.LASF3093
+	.byte	0x13
+	.long	.LASF3094
+	.byte	0x13
+	.long	.LASF3095
+	.byte	0x13
+	.long	.LASF3096
+	.byte	0x13
+	.long	.LASF3097
+	.byte	0x13
+	.long	.LASF3098
+	.byte	0x14
+	.long	.LASF3099
+	.byte	0x14
+	.long	.LASF3100
+	.byte	0x14
+	.long	.LASF3101
+	.byte	0x14
+	.long	.LASF3102
+	.byte	0x14
+	.long	.LASF3103
+	.byte	0x14
+	.long	.LASF3104
+	.byte	0x14
+	.long	.LASF3105
+	.byte	0x13
+	.long	.LASF3106
+	.byte	0x13
+	.long	.LASF3107
+	.byte	0x14
+	.long	.LASF3108
+	.byte	0x14
+	.long	.LASF3109
+	.byte	0x8
+	.long	.LASF3110
+	.byte	0x9
+	.long	.LASF3022
+	.byte	0x9
+	.long	.LASF3111
+	.byte	0x9
+	.long	.LASF3112
+	.byte	0x9
+	.long	.LASF3113
+	.byte	0x4
+	.long	.LASF3114
+	.byte	0x9
+	.long	.LASF3115
+	.byte	0x9
+	.long	.LASF3116
+	.byte	0x9
+	.long	.LASF3117
+	.byte	0x9
+	.long	.LASF3118
+	.byte	0x9
+	.long	.LASF3119
+	.byte	0x9
+	.long	.LASF3120
+	.byte	0x9
+	.long	.LASF3121
+	.byte	0x9
+	.long	.LASF3122
+	.byte	0x9
+	.long	.LASF3123
+	.byte	0x9
+	.long	.LASF3124
+	.byte	0x9
+	.long	.LASF3125
+	.byte	0x9
+	.long	.LASF3126
+	.byte	0x9
+	.long	.LASF3127
+	.byte	0xa
+	.long	.LASF3128
+	.byte	0xb
+	.long	.LASF3129
+	.byte	0xc
+	.long	.LASF3130
+	.byte	0xc
+	.long	.LASF3131
+	.byte	0xc
+	.long	.LASF3132
+	.byte	0xc
+	.long	.LASF3020
+	.byte	0xc
+	.long	.LASF3133
+	.byte	0xc
+	.long	.LASF3121
+	.byte	0xd
+	.long	.LASF3134
+	.byte	0xe
+	.long	.LASF3134
+	.byte	0x7
+	.long	.LASF3135
+	.byte	0xe
+	.long	.LASF3136
+	.byte	0xe
+	.long	.LASF3137
+	.byte	0xe
+	.long	.LASF3138
+	.byte	0xe
+	.long	.LASF3139
+	.byte	0xe
+	.long	.LASF3140
+	.byte	0xe
+	.long	.LASF3109
+	.byte	0xe
+	.long	.LASF3141
+	.byte	0x11
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2188:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2286:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1690:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF2914:
+	.string	"featureSet"
+.LASF1444:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1440:
+	.string	"HSV_VALUE_MAX 255"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2018:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1822:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1964:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1844:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2811:
+	.string	"inputSource"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2367:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF2496:
+	.string	"RGB_GREEN"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2963:
+	.string	"pidConfig"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2942:
+	.string	"writeEEPROM"
+.LASF1881:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2347:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF1931:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF2314:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF2716:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF2625:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1450:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1904:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2208:
+	.string	"WS2811_LED_STRIP_LENGTH 32"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2852:
+	.string	"reboot_character"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2645:
+	.string	"vcdProfile_Copy"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1699:
+	.string	"sched_priority sched_priority"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1614:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2820:
+	.string	"modeColorIndexes_s"
+.LASF2779:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2606:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1671:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1423:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1655:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF2091:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1637:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2256:
+	.string	"TRANSPONDER_CARRIER_HZ_ILAP 460750"
+.LASF1678:
+	.string	"__pid_t_defined "
+.LASF1670:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1426:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1463:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2172:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2886:
+	.string	"gyro_to_use"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2712:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2457:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2810:
+	.string	"targetChannel"
+.LASF1700:
+	.string	"__sched_priority sched_priority"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1536:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF2295:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2092:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2494:
+	.string	"_Bool"
+.LASF1890:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2923:
+	.string	"resetAdjustmentStates"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2274:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF2037:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF1797:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1685:
+	.string	"__CPU_SETSIZE 1024"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2538:
+	.string	"OWNER_ADC_CURR"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF700:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF2179:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2052:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2232:
+	.string	"SONAR_GPIO GPIOB"
+.LASF2152:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2125:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF1715:
+	.string	"TIMER_ABSTIME 1"
+.LASF2450:
+	.string	"SECOND_PORT_INDEX 1"
+.LASF2787:
+	.string	"pidConfig_s"
+.LASF2789:
+	.string	"pidConfig_t"
+.LASF1997:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1525:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1787:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2745:
+	.string	"motorMixer_s"
+.LASF2749:
+	.string	"motorMixer_t"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2524:
+	.string	"CW90_DEG_FLIP"
+.LASF1709:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2493:
+	.string	"DEBUG_COUNT"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2722:
+	.string	"MIXER_GIMBAL"
+.LASF2426:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2253:
+	.string	"TRANSPONDER_TOGGLES_ILAP (TRANSPONDER_TOGGLES_PER_BIT_ILAP + TRANSPONDER_GAP_TOGGLES_ILAP)"
+.LASF2115:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2015:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2061:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2741:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1612:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2526:
+	.string	"CW270_DEG_FLIP"
+.LASF2302:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2184:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1518:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF2023:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF2007:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1657:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2131:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1482:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2217:
+	.string	"BWBRIGHTNESS ((BLACKBRIGHTNESS << 2) | WHITEBRIGHTNESS)"
+.LASF2535:
+	.string	"OWNER_LED"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1855:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2160:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1872:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF2133:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2615:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2497:
+	.string	"RGB_BLUE"
+.LASF2467:
+	.string	"uint16_t"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2353:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF2938:
+	.string	"beeperOffClearAll"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2874:
+	.string	"accelerometerTrims"
+.LASF1689:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1791:
+	.string	"NOOP do {} while (0)"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2123:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1893:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1967:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2372:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF2102:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2238:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1473:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF2604:
+	.string	"csTag"
+.LASF2803:
+	.string	"INPUT_RC_AUX3"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2076:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2373:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1817:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1645:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2412:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1582:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1514:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2887:
+	.string	"gyro_fusion_mode"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF2415:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2766:
+	.string	"motorConfig_System"
+.LASF2144:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2429:
+	.string	"RC_CHANNEL_FLIP RC_SPI_AUX2"
+.LASF2918:
+	.string	"setAccelerationTrims"
+.LASF2161:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2796:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF2931:
+	.string	"mask"
+.LASF2219:
+	.string	"VIDEO_BUFFER_CHARS_PAL 480"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2850:
+	.string	"portConfigs"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2936:
+	.string	"beeperOffSet"
+.LASF1499:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1734:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1779:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2366:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2805:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2443:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2380:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2957:
+	.string	"gyroConfig"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1506:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2540:
+	.string	"OWNER_ADC_RSSI"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF2282:
+	.string	"AIRMODEDEADBAND 12"
+.LASF2147:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1453:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2289:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2702:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2926:
+	.string	"setControlRateProfile"
+.LASF1522:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2333:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1265:
+	.string	"CMS "
+.LASF1626:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF2225:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1620:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2155:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2644:
+	.string	"vcdProfile_System"
+.LASF2770:
+	.string	"PID_YAW"
+.LASF2048:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2111:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1963:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF2183:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2542:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2561:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2409:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF2046:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF2919:
+	.string	"failsafeReset"
+.LASF1445:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF2901:
+	.string	"flashConfig_Registry"
+.LASF1790:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1809:
+	.string	"BIT(x) (1 << (x))"
+.LASF2566:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2229:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2732:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF2228:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF2853:
+	.string	"serialConfig_t"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2842:
+	.string	"functionMask"
+.LASF2220:
+	.string	"VIDEO_LINES_NTSC 13"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2134:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1448:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2912:
+	.string	"isSerialConfigValid"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1422:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1798:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1638:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1630:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF2574:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF2105:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1835:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF2788:
+	.string	"pid_process_denom"
+.LASF2906:
+	.string	"failureMode"
+.LASF1875:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2300:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1581:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2563:
+	.string	"OWNER_BARO_EXTI"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF2360:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2234:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1527:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2759:
+	.string	"mixerConfig_System"
+.LASF2197:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1815:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2418:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1970:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1831:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2862:
+	.string	"values"
+.LASF2905:
+	.string	"beeperConfirmationBeeps"
+.LASF2363:
+	.string	"LED_POS_OFFSET 0"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2541:
+	.string	"OWNER_SERIAL_TX"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2685:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1519:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2266:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ERLT 22500"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2909:
+	.string	"suspendRxSignal"
+.LASF2956:
+	.string	"gyroConfigMutable"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2502:
+	.string	"PGR_SIZE_MASK"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF1728:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1935:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2218:
+	.string	"VIDEO_BUFFER_CHARS_NTSC 390"
+.LASF2121:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1898:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2598:
+	.string	"vcdProfile_s"
+.LASF2602:
+	.string	"vcdProfile_t"
+.LASF2724:
+	.string	"MIXER_HEX6"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2593:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF2142:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF2948:
+	.string	"maxPidProcessDenom"
+.LASF1725:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF2515:
+	.string	"featureConfig_System"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2327:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF2481:
+	.string	"DEBUG_VELOCITY"
+.LASF2613:
+	.string	"FEATURE_FAILSAFE"
+.LASF2236:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF1703:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1968:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1616:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF2915:
+	.string	"featureConfigured"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1592:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1682:
+	.string	"SCHED_RR 2"
+.LASF2695:
+	.string	"BOXLEDLOW"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2564:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1976:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2939:
+	.string	"saveConfigAndNotify"
+.LASF2750:
+	.string	"mixer_s"
+.LASF2754:
+	.string	"mixer_t"
+.LASF398:
+	.string	"false 0"
+.LASF2576:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2746:
+	.string	"throttle"
+.LASF1475:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2098:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF2148:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1579:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF2279:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF1735:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF2682:
+	.string	"BOXHORIZON"
+.LASF2970:
+	.string	"systemConfig"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2954:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1585:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2251:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ILAP 11"
+.LASF1477:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2653:
+	.string	"pidSumLimit"
+.LASF2660:
+	.string	"horizon_tilt_effect"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2523:
+	.string	"CW0_DEG_FLIP"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF2280:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF2337:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF1892:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2273:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2029:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1773:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2067:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2630:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1494:
+	.string	"PG_PID_PROFILE 14"
+.LASF2648:
+	.string	"dterm_lpf_hz"
+.LASF1991:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1758:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2617:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2205:
+	.string	"LED2_TOGGLE NOOP"
+.LASF2377:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2216:
+	.string	"BLACKBRIGHTNESS 0x00"
+.LASF2041:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF2792:
+	.string	"airmodeWasActivated"
+.LASF2696:
+	.string	"BOXLLIGHTS"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1801:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2546:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2331:
+	.string	"PIDSUM_LIMIT 500"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2108:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2614:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2417:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2603:
+	.string	"flashConfig_s"
+.LASF2605:
+	.string	"flashConfig_t"
+.LASF1511:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1555:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2870:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1570:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1799:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2534:
+	.string	"OWNER_SERVO"
+.LASF1811:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1302:
+	.string	"ACC "
+.LASF1763:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF2815:
+	.string	"mixerRules_s"
+.LASF2818:
+	.string	"mixerRules_t"
+.LASF1586:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2255:
+	.string	"TRANSPONDER_TIMER_MHZ_ILAP 24"
+.LASF2430:
+	.string	"RC_CHANNEL_PICTURE RC_SPI_AUX3"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF2961:
+	.string	"serialConfig"
+.LASF1806:
+	.string	"PP_IIF_0(t,f) f"
+.LASF1771:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1919:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2231:
+	.string	"RX_SPI_MAX_PAYLOAD_SIZE 32"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1462:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF1849:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1953:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2304:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2182:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1429:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF2474:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2247:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ARCITIMER 4500"
+.LASF1674:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1469:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2252:
+	.string	"TRANSPONDER_GAP_TOGGLES_ILAP 1"
+.LASF1443:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2305:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF2739:
+	.string	"MIXER_ATAIL4"
+.LASF2731:
+	.string	"MIXER_AIRPLANE"
+.LASF2151:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2519:
+	.string	"CW0_DEG"
+.LASF2250:
+	.string	"TRANSPONDER_DATA_LENGTH_ILAP 6"
+.LASF2747:
+	.string	"roll"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2436:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF2861:
+	.string	"flightDynamicsTrims_def_t"
+.LASF2403:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2458:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2083:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2651:
+	.string	"dterm_notch_cutoff"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1830:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2479:
+	.string	"DEBUG_NOTCH"
+.LASF2460:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1708:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2533:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2195:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2003:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1653:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2222:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2560:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF2522:
+	.string	"CW270_DEG"
+.LASF2881:
+	.string	"gyro_lpf"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2275:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1636:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2237:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF2345:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2669:
+	.string	"crash_gthreshold"
+.LASF2267:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ERLT 5000"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2626:
+	.string	"FEATURE_AIRMODE"
+.LASF2760:
+	.string	"motorConfig_s"
+.LASF2765:
+	.string	"motorConfig_t"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2159:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1911:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1946:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2103:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1447:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1950:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2592:
+	.string	"FAILURE_ACC_INIT"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2223:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2964:
+	.string	"_index"
+.LASF2857:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2856:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2761:
+	.string	"digitalIdleOffsetValue"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF2368:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1666:
+	.string	"_PTHREAD_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2158:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2016:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1972:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF2320:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1559:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1796:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1556:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1837:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1764:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2451:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2387:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF1850:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2609:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1702:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1979:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2608:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1566:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1569:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1605:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1562:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1778:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2040:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF2397:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1512:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF364:
+	.string	"__k8 1"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1869:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1495:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2932:
+	.string	"getBeeperOffMask"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF2235:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF2585:
+	.string	"motorPwmProtocol"
+.LASF2469:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1490:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1752:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1856:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2674:
+	.string	"currentPidProfile"
+.LASF1686:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF2004:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1761:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF1596:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1546:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2447:
+	.string	"RX_SPI_DEFAULT_PROTOCOL 0"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2233:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1922:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF1785:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1732:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2740:
+	.string	"MIXER_CUSTOM"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2697:
+	.string	"BOXCALIB"
+.LASF2506:
+	.string	"pgRegistry_s"
+.LASF2511:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2611:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1412:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2393:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1600:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2489:
+	.string	"DEBUG_ALTITUDE"
+.LASF1760:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF2518:
+	.string	"ALIGN_DEFAULT"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1434:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2693:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1599:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF2582:
+	.string	"PWM_TYPE_MAX"
+.LASF1755:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1583:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF380:
+	.string	"__unix 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2164:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2428:
+	.string	"RC_CHANNEL_RATE RC_SPI_AUX1"
+.LASF2572:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2101:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1640:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2066:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2325:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1667:
+	.string	"_SCHED_H 1"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1557:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1497:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2632:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2973:
+	.string	"high"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2441:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1774:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF2180:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1937:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1757:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2819:
+	.string	"servoMixers"
+.LASF1609:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2058:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2416:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF2240:
+	.string	"TRANSPONDER_DATA_LENGTH_ARCITIMER 9"
+.LASF2022:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2580:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2555:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1615:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2823:
+	.string	"specialColorIndexes_s"
+.LASF2824:
+	.string	"specialColorIndexes_t"
+.LASF2446:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1848:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2928:
+	.string	"setPreferredBeeperOffMask"
+.LASF1805:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1915:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2661:
+	.string	"horizon_tilt_expert_mode"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2039:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1751:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1597:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1853:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1959:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2080:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1454:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2483:
+	.string	"DEBUG_ANGLERATE"
+.LASF1884:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1441:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2500:
+	.string	"PGR_PGN_MASK"
+.LASF2703:
+	.string	"BOXSERVO1"
+.LASF2704:
+	.string	"BOXSERVO2"
+.LASF2705:
+	.string	"BOXSERVO3"
+.LASF1649:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2248:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ARCITIMER 10000"
+.LASF2628:
+	.string	"FEATURE_RX_SPI"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2960:
+	.string	"serialConfigMutable"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1746:
+	.string	"____sigset_t_defined "
+.LASF2633:
+	.string	"systemConfig_s"
+.LASF2639:
+	.string	"systemConfig_t"
+.LASF2174:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1517:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF2584:
+	.string	"motorPwmRate"
+.LASF2408:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF1573:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2186:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF2904:
+	.string	"resumeRxSignal"
+.LASF2845:
+	.string	"gps_baudrateIndex"
+.LASF1553:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2591:
+	.string	"FAILURE_MISSING_ACC"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1840:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2277:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2284:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1594:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2348:
+	.string	"LAT 0"
+.LASF2379:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF2245:
+	.string	"TRANSPONDER_TIMER_MHZ_ARCITIMER 24"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF2383:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF2921:
+	.string	"useAdjustmentConfig"
+.LASF2382:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1578:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1659:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF1866:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2421:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2319:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2565:
+	.string	"OWNER_USB_DETECT"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2135:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2317:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1632:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1782:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1619:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2507:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF2165:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1883:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2283:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1537:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1417:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1660:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF2947:
+	.string	"motorUpdateRestriction"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1824:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF2249:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ILAP 10"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2738:
+	.string	"MIXER_SINGLECOPTER"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2178:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2621:
+	.string	"FEATURE_DASHBOARD"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1465:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2260:
+	.string	"ERLTBitQuiet 0"
+.LASF2486:
+	.string	"DEBUG_STACK"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2569:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2309:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1712:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2226:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF2342:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2324:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2550:
+	.string	"OWNER_SPI_MOSI"
+.LASF1952:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2157:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2504:
+	.string	"pgResetFunc"
+.LASF2843:
+	.string	"identifier"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2466:
+	.string	"uint8_t"
+.LASF1780:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2975:
+	.string	"pidProfilesMutable"
+.LASF1432:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2136:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2328:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2398:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2138:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1833:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2882:
+	.string	"gyro_soft_lpf_type"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1996:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1736:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1878:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2858:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1986:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF1993:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1617:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF2781:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2028:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"VERY_FAST_MATH "
+.LASF2728:
+	.string	"MIXER_OCTOX8"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2935:
+	.string	"beeperCount"
+.LASF2378:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF2281:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF2769:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2214:
+	.string	"WS2811_CARRIER_HZ 800000"
+.LASF2244:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ARCITIMER 155 * TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER"
+.LASF1618:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1564:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1437:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF2422:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2096:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1766:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2009:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2607:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1737:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1962:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF2034:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2892:
+	.string	"dyn_notch_window"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2019:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF2562:
+	.string	"OWNER_MPU_EXTI"
+.LASF2291:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1691:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2757:
+	.string	"yaw_motors_reversed"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1823:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2532:
+	.string	"OWNER_PPMINPUT"
+.LASF2517:
+	.string	"ioTag_t"
+.LASF2806:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF1788:
+	.string	"IOCFG_IPD 0"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2742:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF2658:
+	.string	"levelAngleLimit"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1684:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1411:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2170:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1515:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2577:
+	.string	"PWM_TYPE_STANDARD"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2800:
+	.string	"INPUT_RC_THROTTLE"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2120:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1633:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2110:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2719:
+	.string	"MIXER_QUADP"
+.LASF1543:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1940:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF2720:
+	.string	"MIXER_QUADX"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1977:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2404:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2050:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2139:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1541:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1880:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1505:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1941:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1551:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1472:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1510:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2922:
+	.string	"useRcControlsConfig"
+.LASF2911:
+	.string	"lrintf"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2258:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ILAP 10000"
+.LASF1574:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2586:
+	.string	"motorPwmInversion"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF2056:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2775:
+	.string	"PID_LEVEL"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2369:
+	.string	"LED_POS_BITCNT 8"
+.LASF1672:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2315:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2711:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1838:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2043:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1957:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2192:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF2952:
+	.string	"resetConfigs"
+.LASF2718:
+	.string	"MIXER_TRI"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF2087:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2401:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1784:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF2958:
+	.string	"accelerometerConfigMutable"
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF2132:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2635:
+	.string	"activeRateProfile"
+.LASF2476:
+	.string	"DEBUG_MIXER"
+.LASF1857:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2709:
+	.string	"BOX3DDISABLE"
+.LASF1568:
+	.string	"IO_TAG_NONE 0"
+.LASF1756:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1466:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2624:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2290:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1724:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2322:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2916:
+	.string	"imuConfigure"
+.LASF2356:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1424:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF2898:
+	.string	"pgResetTemplate_systemConfig"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2798:
+	.string	"INPUT_RC_PITCH"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2365:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1827:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF2074:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2254:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ILAP ((TRANSPONDER_TOGGLES_PER_BIT_ILAP + 1) * TRANSPONDER_BITS_PER_BYTE_ILAP * TRANSPONDER_DATA_LENGTH_ILAP)"
+.LASF2213:
+	.string	"WS2811_TIMER_MHZ 48"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1580:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1552:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1419:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2545:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2340:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1680:
+	.string	"SCHED_OTHER 0"
+.LASF2508:
+	.string	"address"
+.LASF2085:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2012:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2072:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1974:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1958:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2287:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1591:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2826:
+	.string	"modeColors"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2374:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1789:
+	.string	"IOCFG_IPU 0"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF2680:
+	.string	"BOXARM"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF2794:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF2310:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2966:
+	.string	"motorConfig"
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1679:
+	.string	"_BITS_SCHED_H 1"
+.LASF2627:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1744:
+	.string	"__have_pthread_attr_t 1"
+.LASF2748:
+	.string	"pitch"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1526:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2547:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2376:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF1943:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2896:
+	.string	"pgResetTemplate_featureConfig"
+.LASF1913:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF468:
+	.string	"__PMT"
+.LASF2846:
+	.string	"blackbox_baudrateIndex"
+.LASF2394:
+	.string	"LED_XY_MASK 0x0F"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2772:
+	.string	"PID_POS"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF2667:
+	.string	"rateAccelLimit"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2646:
+	.string	"pidProfile_s"
+.LASF2785:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1601:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2917:
+	.string	"setAccelerationFilter"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1529:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2171:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1545:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF2677:
+	.string	"throttle_correction_value"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF2124:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF1330:
+	.string	"USE_PPM"
+.LASF2001:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2241:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER 4"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2503:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2354:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2118:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1487:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2166:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2681:
+	.string	"BOXANGLE"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2410:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2330:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF2130:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF2473:
+	.string	"DEBUG_BATTERY"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2581:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF1415:
+	.string	"UNIT_TESTED "
+.LASF2396:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF2588:
+	.string	"ioTags"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1731:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF2395:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2055:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF2442:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF2944:
+	.string	"validateAndFixGyroConfig"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2629:
+	.string	"FEATURE_SOFTSPI"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1642:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1729:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2264:
+	.string	"TRANSPONDER_TIMER_MHZ_ERLT 18"
+.LASF1947:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1478:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2974:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF2272:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1481:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1588:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF2953:
+	.string	"getCurrentMinthrottle"
+.LASF1470:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF2863:
+	.string	"flightDynamicsTrims_t"
+.LASF2866:
+	.string	"flightDynamicsTrims_u"
+.LASF2263:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ERLT 200"
+.LASF1895:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2721:
+	.string	"MIXER_BICOPTER"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2655:
+	.string	"dterm_average_count"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2903:
+	.string	"writeConfigToEEPROM"
+.LASF2899:
+	.string	"systemConfig_Registry"
+.LASF2265:
+	.string	"TRANSPONDER_CARRIER_HZ_ERLT 38000"
+.LASF1733:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2638:
+	.string	"name"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2301:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF2210:
+	.string	"WS2811_DELAY_BUFFER_LENGTH 42"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF2440:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF2464:
+	.string	"int8_t"
+.LASF1834:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2355:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2075:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1961:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1723:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2656:
+	.string	"vbatPidCompensation"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2204:
+	.string	"LED1_ON NOOP"
+.LASF1718:
+	.string	"__clockid_t_defined 1"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2762:
+	.string	"minthrottle"
+.LASF2959:
+	.string	"accelerometerConfig"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1845:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1810:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2782:
+	.string	"pidCrashRecovery_e"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1433:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2370:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF2698:
+	.string	"BOXGOV"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1905:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1886:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1846:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2386:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF1652:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1625:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1706:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2299:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1988:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2510:
+	.string	"reset"
+.LASF2734:
+	.string	"MIXER_VTAIL4"
+.LASF2676:
+	.string	"throttle_correction_angle"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1488:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1859:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1622:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2945:
+	.string	"samplingTime"
+.LASF1793:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2207:
+	.string	"LED2_ON NOOP"
+.LASF2553:
+	.string	"OWNER_SDCARD"
+.LASF2878:
+	.string	"gyro_align"
+.LASF2920:
+	.string	"gpsUsePIDs"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF2795:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF2801:
+	.string	"INPUT_RC_AUX1"
+.LASF2802:
+	.string	"INPUT_RC_AUX2"
+.LASF2763:
+	.string	"maxthrottle"
+.LASF2804:
+	.string	"INPUT_RC_AUX4"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1528:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1665:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1420:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF721:
+	.string	"NULL"
+.LASF2465:
+	.string	"int16_t"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF1427:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2736:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF2452:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2444:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2455:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1464:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2471:
+	.string	"DEBUG_NONE"
+.LASF2190:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF1832:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1438:
+	.string	"HSV_HUE_MAX 359"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF1907:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1496:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2297:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2873:
+	.string	"accZero"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1668:
+	.string	"__time_t_defined 1"
+.LASF2619:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1587:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1446:
+	.string	"sq(x) ((x)*(x))"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1813:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2081:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2298:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1743:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2962:
+	.string	"pidConfigMutable"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2099:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1768:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF2175:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2884:
+	.string	"gyro_isr_update"
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1929:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2411:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1722:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2688:
+	.string	"BOXCAMSTAB"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2423:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2636:
+	.string	"debug_mode"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF1639:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2187:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2288:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1504:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2838:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2839:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1727:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2791:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2024:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2708:
+	.string	"BOXAIRMODE"
+.LASF2516:
+	.string	"featureConfig_Copy"
+.LASF2875:
+	.string	"accelerometerConfig_t"
+.LASF2776:
+	.string	"PID_MAG"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1508:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2227:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1721:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF2294:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF2951:
+	.string	"activateConfig"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2940:
+	.string	"ensureEEPROMContainsValidData"
+.LASF2725:
+	.string	"MIXER_FLYING_WING"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1876:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF2854:
+	.string	"serialConfig_System"
+.LASF1949:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2900:
+	.string	"pgResetTemplate_flashConfig"
+.LASF1563:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2567:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1425:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1960:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2090:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2173:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2501:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2764:
+	.string	"mincommand"
+.LASF1513:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1631:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1547:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2686:
+	.string	"BOXHEADFREE"
+.LASF2890:
+	.string	"gyro_soft_notch_hz_2"
+.LASF2597:
+	.string	"failureMode_e"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1841:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1985:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2306:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2242:
+	.string	"TRANSPONDER_GAP_TOGGLES_ARCITIMER 0"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1821:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2032:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2726:
+	.string	"MIXER_Y4"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF2723:
+	.string	"MIXER_Y6"
+.LASF2285:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2335:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1435:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1467:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2663:
+	.string	"itermAcceleratorGain"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF2671:
+	.string	"crash_recovery_angle"
+.LASF2774:
+	.string	"PID_NAVR"
+.LASF1730:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2042:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2448:
+	.string	"FLASH_CONFIG_CSTAG IO_TAG_NONE"
+.LASF2116:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2371:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2278:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1847:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1868:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2837:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1644:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1560:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2045:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF2622:
+	.string	"FEATURE_OSD"
+.LASF2437:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1533:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2509:
+	.string	"copy"
+.LASF2753:
+	.string	"motor"
+.LASF2438:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1491:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2829:
+	.string	"SERIAL_PORT_USART1"
+.LASF2830:
+	.string	"SERIAL_PORT_USART2"
+.LASF2831:
+	.string	"SERIAL_PORT_USART3"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2834:
+	.string	"SERIAL_PORT_USART6"
+.LASF2835:
+	.string	"SERIAL_PORT_USART7"
+.LASF2836:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2202:
+	.string	"LED1_TOGGLE NOOP"
+.LASF1828:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1507:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF2462:
+	.string	"long int"
+.LASF2713:
+	.string	"BOXCAMERA2"
+.LASF2714:
+	.string	"BOXCAMERA3"
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1500:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF2013:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2334:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1839:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2733:
+	.string	"MIXER_HELI_90_DEG"
+.LASF1458:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1777:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2543:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2729:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF2162:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2730:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2673:
+	.string	"crash_recovery"
+.LASF2513:
+	.string	"enabledFeatures"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2432:
+	.string	"RC_CHANNEL_HEADLESS RC_SPI_AUX5"
+.LASF1932:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2699:
+	.string	"BOXOSD"
+.LASF2303:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF2871:
+	.string	"acc_align"
+.LASF2641:
+	.string	"systemConfig_Copy"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF2485:
+	.string	"DEBUG_SCHEDULER"
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1558:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1889:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2707:
+	.string	"BOXFAILSAFE"
+.LASF1902:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1719:
+	.string	"__timer_t_defined 1"
+.LASF1908:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2059:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF1695:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1669:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1694:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1717:
+	.string	"__struct_tm_defined 1"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1710:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1851:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2701:
+	.string	"BOXGTUNE"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF2122:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1955:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2359:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF1794:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2388:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2578:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF1802:
+	.string	"EXPAND_I(x) x"
+.LASF1479:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF2021:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2860:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF2413:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1775:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2872:
+	.string	"acc_hardware"
+.LASF2358:
+	.string	"LED_MODE_COUNT 6"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2321:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2468:
+	.string	"uint32_t"
+.LASF1663:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF1476:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2057:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1716:
+	.string	"__clock_t_defined 1"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2684:
+	.string	"BOXANTIGRAVITY"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF2036:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2100:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2634:
+	.string	"pidProfileIndex"
+.LASF2215:
+	.string	"WHITEBRIGHTNESS 0x01"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2035:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2239:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ARCITIMER 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1753:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2145:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1747:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2537:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2691:
+	.string	"BOXGPSHOLD"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2063:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2439:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1451:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1544:
+	.string	"PG_PID_CONFIG 504"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2106:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1701:
+	.string	"_TIME_H 1"
+.LASF2590:
+	.string	"FAILURE_DEVELOPER"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2706:
+	.string	"BOXBLACKBOX"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF2454:
+	.string	"long unsigned int"
+.LASF1707:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2687:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF2888:
+	.string	"gyro_soft_notch_hz_1"
+.LASF1523:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1754:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1483:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1554:
+	.string	"PG_VCD_CONFIG 514"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2877:
+	.string	"gyroConfig_s"
+.LASF2894:
+	.string	"gyroConfig_t"
+.LASF2020:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1664:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2690:
+	.string	"BOXGPSHOME"
+.LASF2654:
+	.string	"pidSumLimitYaw"
+.LASF2544:
+	.string	"OWNER_TIMER"
+.LASF1916:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1524:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2141:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2094:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1430:
+	.string	"CMS_EXIT (0)"
+.LASF2665:
+	.string	"dtermSetpointWeight"
+.LASF1783:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2070:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF1956:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2129:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2869:
+	.string	"accelerometerConfig_s"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1576:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF2827:
+	.string	"specialColors"
+.LASF1486:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2463:
+	.string	"char"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1641:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2601:
+	.string	"v_offset"
+.LASF2809:
+	.string	"servoMixer_s"
+.LASF2814:
+	.string	"servoMixer_t"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1285:
+	.string	"GPS "
+.LASF2668:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2191:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF2051:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1786:
+	.string	"IOCFG_AF_PP 0"
+.LASF2643:
+	.string	"flashConfig_Copy"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2505:
+	.string	"hsvColor_s"
+.LASF2498:
+	.string	"hsvColor_t"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2876:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2694:
+	.string	"BOXLEDMAX"
+.LASF2868:
+	.string	"rollAndPitchTrims_t"
+.LASF2867:
+	.string	"rollAndPitchTrims_u"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2579:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1590:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1567:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2828:
+	.string	"SERIAL_PORT_NONE"
+.LASF2000:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2659:
+	.string	"levelSensitivity"
+.LASF2556:
+	.string	"OWNER_FLASH_CS"
+.LASF1745:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF2030:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1795:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF397:
+	.string	"true 1"
+.LASF1770:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF2821:
+	.string	"color"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2361:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1938:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2276:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2402:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF1661:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2683:
+	.string	"BOXBARO"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2893:
+	.string	"dyn_notch_peaks"
+.LASF2949:
+	.string	"maxEscRate"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2435:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2478:
+	.string	"DEBUG_PIDLOOP"
+.LASF2199:
+	.string	"LED0_TOGGLE NOOP"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1965:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF2490:
+	.string	"DEBUG_FFT"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1598:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2212:
+	.string	"WS2811_DMA_BUFFER_SIZE (WS2811_DATA_BUFFER_SIZE + WS2811_DELAY_BUFFER_LENGTH)"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF1607:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2198:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2270:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1421:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1516:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2768:
+	.string	"PID_ROLL"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2206:
+	.string	"LED2_OFF NOOP"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1726:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2525:
+	.string	"CW180_DEG_FLIP"
+.LASF2640:
+	.string	"systemConfig_System"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1800:
+	.string	"STR_HELPER(x) #x"
+.LASF1742:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF1982:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1714:
+	.string	"CLOCK_TAI 11"
+.LASF2610:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2385:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF2203:
+	.string	"LED1_OFF NOOP"
+.LASF1521:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2548:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2449:
+	.string	"FIRST_PORT_INDEX 0"
+.LASF1413:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2616:
+	.string	"FEATURE_3D"
+.LASF2927:
+	.string	"pgResetAll"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1992:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1693:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2307:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2793:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2031:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1704:
+	.string	"CLOCK_REALTIME 0"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1819:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF2434:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1705:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2799:
+	.string	"INPUT_RC_YAW"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1825:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2425:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF2259:
+	.string	"TRANSPONDER_DATA_LENGTH_ERLT 1"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF2807:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF377:
+	.string	"__linux 1"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2137:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2073:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1696:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2675:
+	.string	"throttleCorrectionConfig_s"
+.LASF2678:
+	.string	"throttleCorrectionConfig_t"
+.LASF2672:
+	.string	"crash_recovery_rate"
+.LASF2832:
+	.string	"SERIAL_PORT_UART4"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2833:
+	.string	"SERIAL_PORT_UART5"
+.LASF2338:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF2679:
+	.string	"throttleCorrectionConfig_System"
+.LASF1989:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2482:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2743:
+	.string	"MIXER_QUADX_1234"
+.LASF1740:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2520:
+	.string	"CW90_DEG"
+.LASF2841:
+	.string	"serialPortConfig_s"
+.LASF2848:
+	.string	"serialPortConfig_t"
+.LASF1720:
+	.string	"__itimerspec_defined 1"
+.LASF1865:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1635:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2168:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2406:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF2527:
+	.string	"sensor_align_e"
+.LASF2114:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1852:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1739:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2176:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1934:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2865:
+	.string	"rollAndPitchTrims_t_def"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2308:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2097:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF1498:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2477:
+	.string	"DEBUG_AIRMODE"
+.LASF2929:
+	.string	"getPreferredBeeperOffMask"
+.LASF1675:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF2737:
+	.string	"MIXER_DUALCOPTER"
+.LASF2117:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF2700:
+	.string	"BOXTELEMETRY"
+.LASF2341:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2002:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2343:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF491:
+	.string	"__flexarr []"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1925:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1534:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1807:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1474:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1814:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2767:
+	.string	"mixers"
+.LASF2384:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2472:
+	.string	"DEBUG_CYCLETIME"
+.LASF2487:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF2150:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2512:
+	.string	"featureConfig_s"
+.LASF2514:
+	.string	"featureConfig_t"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2934:
+	.string	"beeperOffSetAll"
+.LASF2084:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2470:
+	.string	"double"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1829:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1860:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2885:
+	.string	"gyro_use_32khz"
+.LASF1604:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2312:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1624:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2910:
+	.string	"pgResetFn_serialConfig"
+.LASF1914:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2551:
+	.string	"OWNER_I2C_SCL"
+.LASF2549:
+	.string	"OWNER_SPI_MISO"
+.LASF1871:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF2268:
+	.string	"TRANSPONDER_PROVIDER_COUNT 3"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2573:
+	.string	"OWNER_COMPASS_CS"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF2311:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF1995:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1634:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2336:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1484:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2618:
+	.string	"FEATURE_RX_MSP"
+.LASF2650:
+	.string	"dterm_notch_hz"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2816:
+	.string	"servoRuleCount"
+.LASF1769:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2612:
+	.string	"FEATURE_GPS"
+.LASF2652:
+	.string	"itermWindupPointPercent"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2813:
+	.string	"speed"
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2817:
+	.string	"rule"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1561:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2717:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1603:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2552:
+	.string	"OWNER_I2C_SDA"
+.LASF2427:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2461:
+	.string	"__uint32_t"
+.LASF2897:
+	.string	"featureConfig_Registry"
+.LASF1456:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2913:
+	.string	"featureClear"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1610:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2230:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2620:
+	.string	"FEATURE_LED_STRIP"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1501:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1460:
+	.string	"Q12 (1 << 12)"
+.LASF2883:
+	.string	"gyro_soft_lpf_hz"
+.LASF2323:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1428:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF1243:
+	.string	"USE_CLI "
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1643:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2140:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1901:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF2293:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1503:
+	.string	"PG_RX_CONFIG 24"
+.LASF1530:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1468:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2744:
+	.string	"mixerMode_e"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1854:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF2825:
+	.string	"colors"
+.LASF2637:
+	.string	"task_statistics"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2844:
+	.string	"msp_baudrateIndex"
+.LASF1677:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF1808:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2177:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF2088:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2420:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF2925:
+	.string	"pidInit"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1896:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF1826:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2193:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1910:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2780:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF2194:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF2965:
+	.string	"motorConfigMutable"
+.LASF1973:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2071:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2587:
+	.string	"useUnsyncedPwm"
+.LASF1738:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF2243:
+	.string	"TRANSPONDER_TOGGLES_ARCITIMER (TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER + TRANSPONDER_GAP_TOGGLES_ARCITIMER)"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1572:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF2851:
+	.string	"serial_update_rate_hz"
+.LASF2156:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1926:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2126:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2201:
+	.string	"LED0_ON NOOP"
+.LASF1711:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2849:
+	.string	"serialConfig_s"
+.LASF2568:
+	.string	"OWNER_RX_BIND"
+.LASF1535:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2082:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2571:
+	.string	"OWNER_TRANSPONDER"
+.LASF2907:
+	.string	"isEEPROMContentValid"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2445:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF2790:
+	.string	"pidConfig_System"
+.LASF1629:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1662:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1928:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2971:
+	.string	"setPidProfile"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1874:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF2044:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2664:
+	.string	"setpointRelaxRatio"
+.LASF1452:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF2054:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2756:
+	.string	"mixerMode"
+.LASF1687:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2710:
+	.string	"BOXFPVANGLEMIX"
+.LASF1688:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1713:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2318:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1882:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2433:
+	.string	"RC_CHANNEL_RTH RC_SPI_AUX6"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2053:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2364:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2528:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1538:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2879:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF2924:
+	.string	"generateThrottleCurve"
+.LASF1602:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2329:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2078:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2558:
+	.string	"OWNER_MPU_CS"
+.LASF2499:
+	.string	"pgn_t"
+.LASF1549:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1762:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1673:
+	.string	"__PDP_ENDIAN 3412"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2405:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1608:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2200:
+	.string	"LED0_OFF NOOP"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2349:
+	.string	"LON 1"
+.LASF2480:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1306:
+	.string	"MAG "
+.LASF1749:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF2431:
+	.string	"RC_CHANNEL_VIDEO RC_SPI_AUX4"
+.LASF2209:
+	.string	"WS2811_BITS_PER_LED 24"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2864:
+	.string	"rollAndPitchTrims_s"
+.LASF2755:
+	.string	"mixerConfig_s"
+.LASF2758:
+	.string	"mixerConfig_t"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1803:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2657:
+	.string	"pidAtMinThrottle"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2313:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2735:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2880:
+	.string	"gyro_sync_denom"
+.LASF1571:
+	.string	"I2CDEV_COUNT 4"
+.LASF1485:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF2257:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ILAP 4500"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF2727:
+	.string	"MIXER_HEX6X"
+.LASF2967:
+	.string	"mixerConfigMutable"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF2010:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1455:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF2955:
+	.string	"getCurrentPidProfileIndex"
+.LASF1816:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2773:
+	.string	"PID_POSR"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2006:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2025:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1980:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1971:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2751:
+	.string	"motorCount"
+.LASF1418:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1542:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2530:
+	.string	"OWNER_FREE"
+.LASF2262:
+	.string	"ERLTCyclesForZeroBit 10"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1862:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1623:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF2596:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF2647:
+	.string	"dterm_filter_type"
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2400:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2777:
+	.string	"PID_VEL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2599:
+	.string	"video_system"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2484:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2495:
+	.string	"RGB_RED"
+.LASF1436:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1933:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2211:
+	.string	"WS2811_DATA_BUFFER_SIZE (WS2811_BITS_PER_LED * WS2811_LED_STRIP_LENGTH)"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1595:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1843:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2937:
+	.string	"changePidProfile"
+.LASF1917:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2531:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1765:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1772:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1577:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2786:
+	.string	"pidProfiles_SystemArray"
+.LASF1899:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2221:
+	.string	"VIDEO_LINES_PAL 16"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2271:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1606:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1983:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2047:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1681:
+	.string	"SCHED_FIFO 1"
+.LASF1697:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF2969:
+	.string	"systemConfigMutable"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF2038:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2352:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF2246:
+	.string	"TRANSPONDER_CARRIER_HZ_ARCITIMER 41886"
+.LASF1698:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1877:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1646:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2316:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF1584:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2332:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1575:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2670:
+	.string	"crash_time"
+.LASF2154:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2930:
+	.string	"setBeeperOffMask"
+.LASF1836:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2181:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1509:
+	.string	"PG_GPS_CONFIG 30"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1804:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2292:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2529:
+	.string	"long long int"
+.LASF2069:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1781:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2424:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2475:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2950:
+	.string	"validateAndFixConfig"
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF2840:
+	.string	"serialPortIdentifier_e"
+.LASF2908:
+	.string	"loadEEPROM"
+.LASF1489:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2554:
+	.string	"OWNER_SDCARD_CS"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1647:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2941:
+	.string	"resetEEPROM"
+.LASF2594:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF2488:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1416:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2104:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1459:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2079:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1648:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2344:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1842:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1627:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2326:
+	.string	"ALL_MOTORS 255"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF2583:
+	.string	"motorDevConfig_s"
+.LASF2589:
+	.string	"motorDevConfig_t"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF2889:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2891:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF1650:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2163:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2049:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2109:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1750:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1776:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1658:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2715:
+	.string	"BOXDSHOTREVERSE"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1887:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1628:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1550:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2575:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1683:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF2933:
+	.string	"beeperOffClear"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2346:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF2600:
+	.string	"h_offset"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2399:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1741:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2351:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1920:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF1818:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2570:
+	.string	"OWNER_LED_STRIP"
+.LASF2077:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2357:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF2752:
+	.string	"useServo"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2350:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2778:
+	.string	"PID_ITEM_COUNT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2017:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF1767:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF2362:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF2296:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF2391:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2062:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2185:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1593:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2859:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2093:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1493:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1994:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1621:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2666:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1944:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1531:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1651:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF2456:
+	.string	"__int8_t"
+.LASF2060:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2407:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2649:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1471:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2847:
+	.string	"telemetry_baudrateIndex"
+.LASF2771:
+	.string	"PID_ALT"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1656:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1589:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2339:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2557:
+	.string	"OWNER_BARO_CS"
+.LASF1998:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2946:
+	.string	"pidLooptime"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1532:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2797:
+	.string	"INPUT_RC_ROLL"
+.LASF2943:
+	.string	"readEEPROM"
+.LASF1540:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2381:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF1812:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1439:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2027:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2375:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF1611:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2390:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF2453:
+	.string	"unsigned int"
+.LASF2855:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF1492:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2196:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2189:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2895:
+	.string	"gyroConfig_System"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1820:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2392:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2089:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2492:
+	.string	"DEBUG_FFT_FREQ"
+.LASF1613:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1676:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF2631:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF2127:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2389:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2692:
+	.string	"BOXPASSTHRU"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1548:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1502:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2064:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2536:
+	.string	"OWNER_ADC"
+.LASF2459:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2261:
+	.string	"ERLTCyclesForOneBit 25"
+.LASF2808:
+	.string	"inputSource_e"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2491:
+	.string	"DEBUG_FFT_TIME"
+.LASF2149:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2662:
+	.string	"itermThrottleThreshold"
+.LASF2224:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF2689:
+	.string	"BOXCAMTRIG"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF2112:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2623:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2414:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1792:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1863:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2539:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1897:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF2167:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1539:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2902:
+	.string	"vcdProfile_Registry"
+.LASF2812:
+	.string	"rate"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2521:
+	.string	"CW180_DEG"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2026:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2559:
+	.string	"OWNER_OSD_CS"
+.LASF2972:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2153:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2783:
+	.string	"pid8_s"
+.LASF2784:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2033:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2968:
+	.string	"throttleCorrectionConfig"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1923:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2146:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2822:
+	.string	"modeColorIndexes_t"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2169:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2642:
+	.string	"flashConfig_System"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2595:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF2269:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3120:
+	.string	"rx_pwm.h"
+.LASF3099:
+	.string	"thread-shared-types.h"
+.LASF3010:
+	.string	"pwm_output.h"
+.LASF3061:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2998:
+	.string	"/usr/include"
+.LASF3067:
+	.string	"mathcalls-helper-functions.h"
+.LASF3139:
+	.string	"voltage_ids.h"
+.LASF3063:
+	.string	"floatn-common.h"
+.LASF3041:
+	.string	"stdint.h"
+.LASF3108:
+	.string	"pthread_stack_min.h"
+.LASF3128:
+	.string	"altitude.h"
+.LASF2977:
+	.string	"src/main/build"
+.LASF2995:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3134:
+	.string	"barometer.h"
+.LASF3040:
+	.string	"stdbool.h"
+.LASF3013:
+	.string	"flash.h"
+.LASF3075:
+	.string	"time.h"
+.LASF3045:
+	.string	"wordsize.h"
+.LASF3004:
+	.string	"color.h"
+.LASF3081:
+	.string	"bus.h"
+.LASF3033:
+	.string	"navigation.h"
+.LASF2990:
+	.string	"src/main/target/SITL"
+.LASF3030:
+	.string	"mathcalls.h"
+.LASF3130:
+	.string	"gps.h"
+.LASF3016:
+	.string	"fc_core.h"
+.LASF3124:
+	.string	"sound_beeper.h"
+.LASF3095:
+	.string	"clockid_t.h"
+.LASF3027:
+	.string	"config_eeprom.h"
+.LASF3140:
+	.string	"boardalignment.h"
+.LASF3078:
+	.string	"parameter_group_ids.h"
+.LASF3105:
+	.string	"__sigset_t.h"
+.LASF3111:
+	.string	"io.h"
+.LASF3042:
+	.string	"libc-header-start.h"
+.LASF3096:
+	.string	"timer_t.h"
+.LASF3032:
+	.string	"failsafe.h"
+.LASF3036:
+	.string	"fc_rc.h"
+.LASF3068:
+	.string	"platform.h"
+.LASF2999:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2982:
+	.string	"src/main/drivers/barometer"
+.LASF3009:
+	.string	"resource.h"
+.LASF3101:
+	.string	"atomic_wide_counter.h"
+.LASF3020:
+	.string	"servos.h"
+.LASF2986:
+	.string	"src/main/flight"
+.LASF3121:
+	.string	"rx_spi.h"
+.LASF3031:
+	.string	"imu.h"
+.LASF3003:
+	.string	"debug.h"
+.LASF3107:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF3039:
+	.string	"stdc-predef.h"
+.LASF3079:
+	.string	"accgyro.h"
+.LASF3034:
+	.string	"rc_adjustments.h"
+.LASF3059:
+	.string	"math.h"
+.LASF2994:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3077:
+	.string	"filter.h"
+.LASF3043:
+	.string	"features.h"
+.LASF2993:
+	.string	"src/main"
+.LASF2987:
+	.string	"src/main/io"
+.LASF2983:
+	.string	"src/main/drivers/compass"
+.LASF3104:
+	.string	"setjmp.h"
+.LASF3094:
+	.string	"struct_tm.h"
+.LASF2980:
+	.string	"src/main/config"
+.LASF3097:
+	.string	"struct_itimerspec.h"
+.LASF3044:
+	.string	"features-time64.h"
+.LASF3058:
+	.string	"strings.h"
+.LASF3006:
+	.string	"feature.h"
+.LASF3026:
+	.string	"config.c"
+.LASF2981:
+	.string	"src/main/drivers/accgyro"
+.LASF3029:
+	.string	"beeper.h"
+.LASF3103:
+	.string	"struct_rwlock.h"
+.LASF3090:
+	.string	"endianness.h"
+.LASF3014:
+	.string	"config.h"
+.LASF3049:
+	.string	"stubs.h"
+.LASF3025:
+	.string	"gyro.h"
+.LASF3052:
+	.string	"time64.h"
+.LASF3054:
+	.string	"string.h"
+.LASF3019:
+	.string	"target.h"
+.LASF3098:
+	.string	"pthreadtypes.h"
+.LASF3112:
+	.string	"io_def.h"
+.LASF3069:
+	.string	"common_fc_pre.h"
+.LASF3115:
+	.string	"light_led.h"
+.LASF3038:
+	.string	"maths.h"
+.LASF2985:
+	.string	"src/main/fc"
+.LASF3053:
+	.string	"wchar.h"
+.LASF3046:
+	.string	"timesize.h"
+.LASF2979:
+	.string	"src/main/common"
+.LASF3117:
+	.string	"max7456.h"
+.LASF3138:
+	.string	"voltage.h"
+.LASF3133:
+	.string	"vtx_control.h"
+.LASF3028:
+	.string	"rx.h"
+.LASF3136:
+	.string	"current.h"
+.LASF2997:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3083:
+	.string	"rcc_types.h"
+.LASF3109:
+	.string	"compass.h"
+.LASF3087:
+	.string	"time_t.h"
+.LASF3024:
+	.string	"acceleration.h"
+.LASF3055:
+	.string	"stddef.h"
+.LASF3066:
+	.string	"fp-fast.h"
+.LASF3080:
+	.string	"exti.h"
+.LASF3062:
+	.string	"floatn.h"
+.LASF3082:
+	.string	"bus_i2c.h"
+.LASF3021:
+	.string	"ledstrip.h"
+.LASF3074:
+	.string	"display.h"
+.LASF3076:
+	.string	"axis.h"
+.LASF3050:
+	.string	"stubs-64.h"
+.LASF3122:
+	.string	"sdcard.h"
+.LASF3005:
+	.string	"parameter_group.h"
+.LASF3037:
+	.string	"controlrate_profile.h"
+.LASF3015:
+	.string	"pid.h"
+.LASF3114:
+	.string	"io_def_generated.h"
+.LASF3137:
+	.string	"current_ids.h"
+.LASF0:
+	.string	"./src/main/fc/config.c"
+.LASF3072:
+	.string	"blackbox_io.h"
+.LASF3113:
+	.string	"utils.h"
+.LASF3091:
+	.string	"struct_sched_param.h"
+.LASF3018:
+	.string	"mixer.h"
+.LASF3023:
+	.string	"sensors.h"
+.LASF3092:
+	.string	"cpu-set.h"
+.LASF3012:
+	.string	"vcd.h"
+.LASF3084:
+	.string	"accgyro_mpu.h"
+.LASF3060:
+	.string	"math-vector.h"
+.LASF3106:
+	.string	"struct___jmp_buf_tag.h"
+.LASF3017:
+	.string	"rc_modes.h"
+.LASF3002:
+	.string	"stdint-uintn.h"
+.LASF3089:
+	.string	"endian.h"
+.LASF3073:
+	.string	"cms.h"
+.LASF3093:
+	.string	"clock_t.h"
+.LASF3065:
+	.string	"fp-logb.h"
+.LASF3118:
+	.string	"pwm_esc_detect.h"
+.LASF3126:
+	.string	"adc.h"
+.LASF3048:
+	.string	"long-double.h"
+.LASF3035:
+	.string	"rc_controls.h"
+.LASF3135:
+	.string	"battery.h"
+.LASF3047:
+	.string	"cdefs.h"
+.LASF3064:
+	.string	"flt-eval-method.h"
+.LASF2988:
+	.string	"src/main/rx"
+.LASF3051:
+	.string	"typesizes.h"
+.LASF2976:
+	.string	"src/main/blackbox"
+.LASF3125:
+	.string	"transponder_ir.h"
+.LASF3123:
+	.string	"sonar_hcsr04.h"
+.LASF3070:
+	.string	"common_fc_post.h"
+.LASF3056:
+	.string	"locale_t.h"
+.LASF2991:
+	.string	"src/main/target"
+.LASF3085:
+	.string	"pthread.h"
+.LASF3008:
+	.string	"sensor.h"
+.LASF3011:
+	.string	"system.h"
+.LASF3116:
+	.string	"light_ws2811strip.h"
+.LASF2984:
+	.string	"src/main/drivers"
+.LASF3022:
+	.string	"serial.h"
+.LASF3127:
+	.string	"runtime_config.h"
+.LASF3110:
+	.string	"inverter.h"
+.LASF3132:
+	.string	"osd.h"
+.LASF2978:
+	.string	"src/main/cms"
+.LASF3071:
+	.string	"build_config.h"
+.LASF3088:
+	.string	"struct_timespec.h"
+.LASF3129:
+	.string	"gimbal.h"
+.LASF2989:
+	.string	"src/main/sensors"
+.LASF3001:
+	.string	"stdint-intn.h"
+.LASF3131:
+	.string	"motors.h"
+.LASF3057:
+	.string	"__locale_t.h"
+.LASF3000:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3102:
+	.string	"struct_mutex.h"
+.LASF2992:
+	.string	"src/main/telemetry"
+.LASF3119:
+	.string	"timer.h"
+.LASF3141:
+	.string	"telemetry.h"
+.LASF3100:
+	.string	"pthreadtypes-arch.h"
+.LASF3007:
+	.string	"io_types.h"
+.LASF3086:
+	.string	"sched.h"
+.LASF2996:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\t\001e\n"
+	.string	"\264\017\375\001"
+	.string	"-"
+	.string	"\374\307\212\272\b\004\002"
+	.string	"\002\001\002\002\002\002\001\240\342\234\212\n\003\004\321\211\300\200\002\002\005\350\223\272\372\005\006\240\270\375\251\005\002\002\003\002\004\b\250\225\215\302\b"
+	.string	"\t\353\236\302\346\003\n\002\003\002\005\002\003\002\006\f\307\271\240\303\006(\002\003\002\007"
+	.string	"\b\t"
+	.string	"\004\002\n\002\013\003\017\273\203\325\342\t\020\320\241\257\210\004 \002"
+	.string	"\002\f\002"
+	.string	"\002\r\002\016\002\r"
+	.string	"\002\017\003\002\020\025\270\357\263\342\017\001\026\304\225\207\302\002"
+	.string	"\027\257\323\300\356\004"
+	.string	"\030\336\310\256\264\f"
+	.string	"\031\335\350\233\312\r"
+	.string	"\032\316\323\201\371\t\033\354\301\314\336\005"
+	.string	"\034\035\036\274\205\242\255\006"
+	.string	"\037\222\252\354\340\007"
+	.string	" !\"#\374\336\245\336\r$%&\355\314\246\334\007'\301\323\366\230\016()*\255\234\260\234\r+\315\203\320\202\003,-\363\256\213\304\r.\240\200\360{/0123456\240\342\234\212\n"
+	.ascii	"' \220\202\223'c\210pGc\210p\027\033\243\b]\334\347\306\226\362"
+	.ascii	"\251cx\266\025\263\370\020\276Q\035B7\270\200*~L\327\030+\377"
+	.ascii	"\003\013\2265`\n(\217n\031?\304)\335#x\357\215\355\223\332\353"
+	.ascii	"\277 1\266\033zk\017\242\025j\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \342\255\003"
+	.string	"\264\003\326"
+	.string	"\026"
+	.string	"\001\001\001\001\004"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\003\b"
+	.string	"\001\t\f\020"
+	.string	""
+	.string	"\025\026\027"
+	.string	"\001\030"
+	.string	"\031\032\033\001\001\034\001\001\035\036"
+	.string	"\001\037"
+	.string	"\003 !"
+	.string	"\003\"\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\031"
+	.ascii	"0\207Q\23113\006\304\261\"\254\020\227\022\302L\302\340\016\013"
+	.ascii	"9\232\204\231\016\006\004\316\270\314\300\344\025a`X\315\023"
+	.ascii	"\254\254\003<X\310\225\233\257\022\370%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\343\003u\n"
+	.string	"\242\313)0`m\n\035"
+	.string	"\032Lm\021\264\336E%\003\231\006W4\206\001\307\312\021\240\250\265I\235+\230"
+	.string	"\024"
+	.string	"h\274\252\r\314t\267mcK\323\032\331r\24770,($x:7\002u\327\301m\264\305l\260I\320\003C$\245\272`\204\263\001\235F\333\016I(,8<\023\214:N\025 \242\020CP.T>-\2409\213&%\023)\304?\213+%\023\311a\315G\360\243mf\3422\332r\306d\314\026\265\035\275\305\253muu\261@\220o\237\233\372\341\262?\200\234\227\377\260m)\376\003\264m\003\335I[\200\337L\225\004H\250\321\301\242@\202\022gk\r\200\"\232+\353\022\240\321x\214\312\b\fJ\250\250@\t\214`\tfj\342^\317\270j\234\234\206\376:\036\n\332\275o\2422\005\230\216\273r\324\033y\323\034\354oz\027Z\276$\026\221\311\377RJ&C\223\ni\225)\375\252\245\347u\271\234\346\203\355\f\035A\203OG\240\023\"\257\335\360\333\\{\254"
+	.ascii	"]p\372\327\233g\377!\023\225\341\310\247\343\236\243`dF\302\330"
+	.ascii	"\021\352\332\261\231\357VzMI!]\206uX9V\230\001,\352 \203\332"
+	.ascii	"\317\024\025\352O\r\232\273\002\316="
+	.text
+	.section	.gnu.lto_.jmpfuncs.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\373\001\215\t"
+	.ascii	"\262\215)+\200K\322\030\363\0064\001\273\255\255\307\270\ffR"
+	.ascii	"\203\217\366\035#@X\376\030\330\225\023\236o\032\216\226\261"
+	.ascii	"\340\363'k\223\275eJ\001>\247\337\240\f\317\202*h\302\003M\020"
+	.ascii	"\236\323?HC\353\241u\247\r\036. \360\321Q\245\206X\367e\007:"
+	.ascii	"B\376\360\030\344\267\260`\214\261fi\232Va\214\335,7\306$\025"
+	.ascii	"f\261\265#\326\235s\374\306\316\245S\211\nht\321\224\365\224"
+	.ascii	"u[q\252\335\031kH8\206\023\024\367\305L\300\212\254\231\224."
+	.ascii	"\227\025\300\035\276\323F\2272\2524:\325\\\265\365&\027\245\327"
+	.ascii	"\361F\002A\250A\271w$Ij\025\2061\200\002\241\263\323\006\021"
+	.ascii	"\2604\347\230I\245\005m\232\003'\256\f=\370S\311\351v\303Q\234"
+	.ascii	"\201s\300]l\377\215+\320\261\217\335\224\320\024\276\327h\b\361"
+	.ascii	"\020\n\001\255\224\301J\221\236\303e/\341\222cp\323\223\350\027"
+	.ascii	"\314\310x\374\023\332o*\036\355%\004\270p\234\267t\345\252\300"
+	.ascii	"\037\345\277\r\365\354\270A&5\250\370\226\202\244\221 \374\373"
+	.ascii	"r\r\001K\241NJ@\371C\n)\361\313\332\024="
+	.text
+	.section	.gnu.lto_.pureconst.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 G\345\001"
+	.string	"r\004\016\026\220+\035\272\246\251\273\273\313\334\235\241m\333\266\255@y\340\315\005;3\232\320|\2463\233\311\314e*7\271\310=\256q\327-\236\210;\\\341\006\037\360\251\357k\313\314\244"
+	.text
+	.section	.gnu.lto_.ipa_modref.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"}\004"
+	.ascii	"\262\004\017\025`U\r\0070\f\303p\240\243m$I`@\356\242\271\335"
+	.ascii	"R\246?\327X\271\324\351e\345\004y\363\004=\310\225Su\006:\001"
+	.ascii	"5F+\253)\210U\256\006\201\007\225\243\316\324~\314A& \260\002"
+	.ascii	"!;z\266\274\257\233\231[\220A\214B\035\030x\202K0\211`\207\204"
+	.ascii	"\201\222-\213=\351\002\201\001\375\270\021\231\247\212-:\263"
+	.ascii	"4\356\365\200\004\227\205\373\262\361\331\300\305\210e\205\340"
+	.ascii	"\200\366\016\2062\260\350\304\001'\356\301\3020\037\255Pn"
+	.text
+	.section	.gnu.lto_.lto.c7c0bf2bd364e706,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.142.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\365\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\004\023?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.144.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\213\001?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.148.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \2215\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\374\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\025\022?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.150.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\035\001\001\005\001\006\035\001"
+	.string	"?\202\210\200(}{\275\001y\275\001w\275\001u\274\001s\273\001"
+	.string	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_flashConfig_Registry.154.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\242\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\336\006us\250\367\005uq"
+	.string	"\005\001\006'\001\001\372\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flashConfig.156.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.160.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \204\335\003"
+	.string	"\324\006S"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\377\322\027\005yw\350\367\004yu"
+	.string	"\005\001\006'\001\003\202\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.161.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \366\345\006"
+	.string	"\002\21506@o\222\016@\355\307\350\017\020\220\302B\243\030q\344\021]\202\221>t\271\220\333\330\354YG\313i\201\027Ta\212\002\341O\200\347M1\344xf\215\243m\215\020\231\002[\230\007MfsY\321\312\304\215\246\001\"Z\030'b\006\276\"\034\260(q]X\2548\255P4,\320\340\347\347\224d\" \363B\341\216\224DqAJ]\321y\335J\335\316\245\324\203\004#\222\366\272+\216|,\317}\036\354\370N\tE\377\373A\201R\nC\227\t\352Z\022\205*\205\374\236\257FH\360\234\225\373"
+	.string	"]F\032\030%+\231\\\204\036\315\372\262[\221N*'&[\310\242\017`!3\177[(\243\303\376\007\277\301\277\021\b"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.163.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \366\325\006"
+	.string	"B\21505@o\222\016C\375c\321o=D\346\242q\231\311\230=\233t{&\220(\34066{\326\265\212\026xA\025\246\250:\272\004x\336\024\200\305I\360Mt\033d\313\024[\032\b\316\246sY\317\332\274\016\307!\342Y\330\304\323\020|I<`\217\342\272\260WmZ]iW\2409\320_\321\222L 3\027.IM\026\027\244\324\027\036l\250\324\365dJ\2413X1ix\272\332H|\371\r\204\216\343\013\220\231\271+\3758\272\201\030\225\006\226L\321\t&S(\224\220\377\363\325\t\n\237\263n\036\242\314\307H\206\211K\346\366\\G\263bv+R\212t\322\022\032a\024\003\0302s\f\215H\335\365G\370\017~\215\007"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.164.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"=\007"
+	.string	"\302\21525Po\322\001\200~\024\206@r\r\230\353\007\"\364\200\033\364\216\3523u\302\217|\324z\254\b+\260U\207NT5\202HR\372\206R9f]Lm\311&R\246\024\206\234\006O\347s\301\007;\357\343Ypx\020\003=\316\200\257\007\006\354A\\\027\366\254\250\235Z-Y\0134\035\331\006\375$\002`\267\002\3017y\224\360?\356<\021\312ow~H\t^J\264<\331\332\330\224\261\343(\225\303>\265Z\262\235N\335h\270(\254\354^\234f\266\305\251\204\330\026\331\226/\362\021\221\263\214\036\030\225\311d\201\022\263\033_\300\005\252\273\374\246\272\323\216g\317\314?\311)\230\024\226\215D\361\324$\354\256s#e\334z\333\007\266\rl\203\004\t"
+	.ascii	"\t\013\035\263\030\277\"\3365\204\345\032~\0331\262\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_resetConfigs.165.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\265\013"
+	.string	"&\225PE\020mj: r\2161\221|l\276P\305kK\252"
+	.string	"\006\256>\246`\341\016\260RC.\262\026-a\274{>\320\320\314W\027BW\235n\346\035\t8\006k\224|\211\261\214\217\005P\030[ \025\212om\357\224\0026"
+	.string	"?"
+	.string	"<"
+	.string	"\273f\346\233;.\276\371*\222\315};\347\321Fq\363\302\336\365\202\320a\305\356v\325\302\307\323\321\177\352\225\362D\236RJv\327\264<M\270\353ms\330\006`\177$\366\265\255({\263\210 !\300\303\256\204\026,6\266\235\031|\325[6g\3229\370&\001\025\033v\227\373f{\374j\244-\005\022\327\013\363-s\002\244\322\263\274\341\220\276\032yPN\023\030R\004\266\2342\326\237z\007\026\253P\314\375V(\242/\255U\322o\035\343\fq\363\217p\202(\361\321\344\254_Jtf\013lBm\006\r\350K_L\2254\375\240A\266tf\233&Z+\004\376\330\210\204p>\317\247\321p\360y@\001>\004\340'\024\007x\300P\206=\215\001\360\003\n\275\316\373t \260@\202\316\023\025t\232\r\207\241O\354\026\204\241\330qf\351\332V\224;#b\245j\362\001\321\203J\006\023"
+	.ascii	"\325\223\240L\350\037\032\030\027L\322\031b\270&\253\341\257"
+	.ascii	"\212&\324qM\265\257N1\\\023\311L\334\177\006\366y\235=\255\274"
+	.ascii	"4\001\316\271\2050\237"
+	.text
+	.section	.gnu.lto_activateConfig.166.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\217\001E\r"
+	.string	"F\327R@"
+	.string	"S\225\016\303\204\377\344\262\235\223\273[-V\n\0204\366\035O\234\210\353\357\023D\3735\332ZJ\337\233C\006w\264\230D\267\214Od$\031B_\020R\377\260\370\262\241\017b\213do\"eJ\001>"
+	.string	":"
+	.string	"D"
+	.string	"{\265^\375"
+	.string	"\333\212\036\027\036s\206\210\301\246+\3368a\373\023\1776\220\207&\346a\274H.\202\3149\271-\361\357\372\371_]\002\226@Wm\301\234\323\n\226L\367\336v\001\333\006lU\020~\353!\b_\345\216\247\007\037}O>~%\247\220\306\274\211\330 "
+	.string	"&\325\366\360A\017\232\200hAV\034/\037S\205\330\241H\227\204\375l.\312^\265\246j\271\352\250\352\354\352\007HCl\b\267q\021\231s\224\300\247\361\032\0210\3621[\004)V\212M\375\031\022\036\3432(\370\252GW\300\214\334?\344\243m\341\302\206\"\263\215\330\265\273\027{\322\2655-\324\004@\2776'\303hA\016\356*\0308\033\217\327q\335\206\363p2\035\256\373p\340*\003\354i\320|\270\016\236\367\341&a\350\331\\\324\204\225+\264\"ST[\373c!W\373Z\337\221\343:\0304\260X\344\243\334J\212\245\202\242qm\007\017\262\215\033' \240\002\031\";\007#\241\177d`\024\272\265\355(w\236\020\r<\315\343\355\nLp\271e\272\030\266\202"
+	.ascii	"5y\262\332U\212\277\343\037\270~RA\013\223\271\233\331K\026\374"
+	.ascii	" \354\354I\026\232\374\364\304 _\254S#\326\"i\261*mX\214T\273"
+	.ascii	"\335\357C\300\323-Z\372\004"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.167.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\304\f\2056"
+	.string	"\332W\260\023EP^R\007+Lz\263`\030y\036\b<v\262\334E>\025\313\377\372\267\234\375\231\b\331\265)\243\241\275\314\021\234\344I\207\005l\032"
+	.string	"D"
+	.string	"\b\210A\200\2148\253"
+	.string	"/\240\245\362\276\324\b\320\032w\333{\313\224d(\001\026\001*\0019{\236\341\325\254\217\330\365e\032^\315BM\234\200\265\355\275\207\357\324<TP\266\300\333\334-\366i\r\230\352\tg\0313\323\333\273\212\300\335\\"
+	.string	"v\367\310\223\257\273\255#_ws\234s\033\257J\267\277A\257\250\364\355\275\227\032\211\307>@"
+	.string	"\322\221Q\021Q\200!"
+	.string	"BAJ\240\344\017\362\350c,\366\360\020\207\302 \f|\335V\177\234\035X!\350\334\242\362\001o.\340-\313#a\361#,W\336\210\352E\324\351\023\271y"
+	.string	"\267\266\037\202\342"
+	.ascii	"\240<y!6\017bs\362\3123\007\302>\317\314>Y\346?d\217\034\373"
+	.ascii	"c\222\367\301>\305\336\330\036\320\213\223\343h\317\2626\251"
+	.ascii	"e\346\304>\245_\204z\017\024\354y\240_O\364\362\241\227\220\027"
+	.ascii	"\266\007\300\310\364p\354\323\253M\236)\302\306\251\216\204\366"
+	.ascii	"\354\372 \022\221\035\\\016\243=\203<\360\352\337\037\356\266"
+	.ascii	"\t\354\322\272\220\\Z\354\206[6\276\355\331\2721\334j\276\306"
+	.ascii	">\271\332\243\275\267S\375\263\266\254\376\201\025\366\336\371"
+	.ascii	"\235[;<\023\360\234?H\316yD\316\302*\001`\230\004\356\276(\335"
+	.ascii	"\301\211\261\026\346\267W \215K\213\253\243\331_\274\255\376"
+	.ascii	"<+\336\007\217\003A\201\013\211\007[ZMA\314\367\336\273ez\265"
+	.ascii	"\236\262\346\345,\302\2650\031I\367nB`\342o$\222w{7#`\361,%Z"
+	.ascii	"\023Mo\323\353\256\326FbS\242\034\037\326\265\216\346w\003\357"
+	.ascii	"k'k\231\346\377\345b6\233\305s\003o\222~\355p7\300\254>\233_"
+	.ascii	"\356\r6I\373\324\217\252\236Nv\235\244\037\356\352N\316ON\205"
+	.ascii	"\t\357\275!d\267\372\224\024\331\311\334\315P+\336\235\356f_"
+	.ascii	"\361\272\353\332\001\336\264\352\2639\251V\347\267\267\237N\316"
+	.ascii	"U\253\327\321\234]g\263\331l\326Fr\366\251\347$\370\263\022\370"
+	.ascii	"\031\b\3709\031\374\374\003\177F\302\237\217\360g\037\370\263"
+	.ascii	"\021\376\\\204?\367\300\237y\340\317D\370\363\020\376,\004~\016"
+	.ascii	"\002?\303\355g`\373\371m?\273\357\347\266\375\254\335\317\337"
+	.ascii	"~v\n\020\364\300\274\306\244ZMuke\353\354:\267\313\231O\335\003"
+	.ascii	"E\335\200\332&\225\376\233\236s\034\215\221\274;\363\221\322"
+	.ascii	"\311o7\036?=\032\205q\357\335\243\207k\355\213\3255\004\311\243"
+	.ascii	"\177\314\366\346\321\302/}L\363\221v$j\23660Q\277v~\251\316M"
+	.ascii	"\232\217\337\361\241\326O|\250\235\317\245\177z\\\214:\232\245"
+	.ascii	"^\241v\262\346!\370\\\335\036\217\225\305g\357N\241^\nkj\252"
+	.ascii	"\374\327\265\242\216\376\305jI\322\275\267_\274\304\335>\007"
+	.ascii	"R8\327%[\327\0055\021\315Z&\315\343\304lN\007'\246\272\034_P"
+	.ascii	";\035\017P;\375\025\212%\352\350\235\307j\257^\254V\344F\201"
+	.ascii	"\224x\345\272\332\320R2\324\321\fT\3431\333\013k\242\231\225"
+	.ascii	"n\315\331\304l\360\032X\273\234\2339\301\352\204\2553\275@\355"
+	.ascii	"\024C\361;\246\242\330\315\325\304T\345]\032\267\263\220/`x\f"
+	.ascii	"\257\273@]\364W :\030\204=\323#G\007\233\253{o\370\325\217\265"
+	.ascii	"\342ep3L>\345\256\214\206%)\031\247\333\300\241\303\353\316\016"
+	.ascii	"\257\273\257\366)x@\035\205s\327\203\213a2\232#\221\f\343\372"
+	.ascii	"\275Jg\276\001Y\205\022\213&\250)\346\213\245\024\224\003\006"
+	.ascii	"\022\"<`\236`*\035\231'\2448L1e@E\005\363\223R\n(\024-\244\236"
+	.ascii	"\226O(\226-\240\232\242\226OS/\226J\312,\345\2029\265\204!%5"
+	.ascii	"\265\034V\253\274\335\332Hv\307T\375\364\252\264\325\200\n\357"
+	.ascii	"Q\276,\316\322Cg\310\250b\2534suEh\325\221p\3041_\002\224\332"
+	.ascii	"\255iC\370\320\344Mx\227\362bq\326'\343\354X\263\332\366\256"
+	.ascii	"rg~$/\215\257b\2548++\326\021k\275;\225\332\251\016\343\315q"
+	.ascii	"\361\323\023\272\021\331Q\334\247\216\02599\312\370\206\272\260"
+	.ascii	"K\237s\314#\366a5\306\007\222\216\022!\222*\270\023\223\335\233"
+	.ascii	"\352HG3\220Nj'\253\231\346\377\001\3710 \355T\360\270\036,V\203"
+	.ascii	"\377+D,\004\336{;Y\324\353nR\007\247\337\365B\242\262\223\345"
+	.ascii	"\370+\206\306\320\327\335\037M$\026\344Z\347\267g\224\253\356"
+	.ascii	"%\254oo?\235\215%f\253\b\351v\220Y\"\367\013p\274q\2343D\365"
+	.ascii	"\006\200O\225\217\031\241]\305\232\01326\215W\245\221\252\212"
+	.ascii	"c\b\361\032\007T\324N\277=\201\f\250q4\245\235\232!\021IARRH"
+	.ascii	"c\321\005\204\030\345$\354\006\021\360\244S\2149\n"
+	.string	"\306\024\024\322\030xE\364S\377\210\334\372Ea\371!\024\234\356?\222 6\261\231\372R\365\336\023\205\017rg\232u&\232\013\223\270\251\231\350\267\221N\365\231\363f\021\225\351J\020\024\323\3260\034:54S\205^\205\334\337\tN\330O&\235&_Rv>\001[d\232Y\257\022\377G\275s\210\035\004\374\347\336\251\177V~\335b\035\376]I{\260\337\305\257`@pa\323_\027\363\341Is\354\254\234\372{\006>o0\267D\275\317\007\363\347\017\\\375\005\371\231^\333xpD\224\025O4n\001\"\250=\275\222\336x\360\336\322l[\312\t<\223\341\205\201r|8cBF\302t%\357\242=\272\374jX\342Qv.\2307N\327sh\264\277\325\211\326\263\375\214\234\256d\267y\036m\004=37\211X\0376\317\322\364&\254\212\340B\210\f@\034\216X\206(^}\372\n\237]\006\312\035\251\257\336|\345"
+	.string	"\016\234\256\357M\223\376\313\037\367MF\320\257zSI\321\310>\027\355Y\002\273RZ\303\213\307{\276\377\337\022\200\367\377\205\364\263\342\252\034\220\252\200\013\235\341\243\214\362\361\364n\f\216\350\317\37786\370xf\337;-\371V\3367\310\334\320\2739(\223'?\331\263\253\231\312\363\226\\\243l\224tA\274l\327\205\2114\354M\240<\227\237\320\216J\361_\025\n\372\253\376\267\b\365\220\324\025w\032K\254H\002\312TX\\\200$8"
+	.ascii	"\340\336\"\270\267\b\356-\0164{\\v\325\211\334X\251\323MZ?\366"
+	.ascii	"\211\033A=\022w\263\023\234E\03345\230\002\345\221\307\207\177"
+	.ascii	"\225\273Y5\333\247\230\242|\234\277?"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.168.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\352\fe<"
+	.ascii	"Za\210\025AP\246\326\030\023]u\245p\227\003ZND\304J\244\342\213"
+	.ascii	":\324\t\372qe\031\r\215\362C\300\240\250\337Tu,\371\234\210~"
+	.ascii	"\232\210&\261\265\347\030\320\210\203\t+5\024\344wlw\023)eJ)"
+	.ascii	"\005L\0011\001E\001p\314D\256\321g\270\323\364\232f\223\202m"
+	.ascii	"\020\232\227\367}\211o\325\265\267*\023\035$nj\232\270\251I\242"
+	.ascii	"\366Y\260\333\266\367\314\313N\3313H\001\021\n\254w[\215F\303"
+	.ascii	"q\354\364-;2\361\203F\247\272e\033\301n\247\274(p\217\34163%"
+	.ascii	"\306\300\301\263\313t=yM_\037+\nM\231\301n\271\311\324`&v\353"
+	.ascii	"\r\246\3034\225\211Rsb\372\234\3612(\305\335\364F\320+\232\004"
+	.ascii	"]S\303\003\021\354V\n\020\205\366\322_\236\315\306\325\247\260"
+	.ascii	"\351;\345\001\037\236\227\250n\331@\260\333\247F\272\335\262"
+	.ascii	"}\344v\313Of>=M{\333\315:Ff\320\373\276\311\177\322\317F\"\035"
+	.ascii	"\035\215\212\210\214CE\342P\030\004\272-\373\376\344\006V\t\241"
+	.ascii	"e^\215Tk$\265+\321)~$\305\217Q\334\210}\212k\250kT\r\212\027"
+	.ascii	"\2455Q\032\0227\0169Z\027\217\321#\354\323\3235j\304\211\300"
+	.ascii	"\252%?\316zx\006u%Z\304\205PK~"
+	.string	"\020\351 \213\234\303DO\00249f}%:\304\201\327(\2211w\205t+\206\303Y\263~cY\030\373\364\276oS\333\311\312\300\334\201U\357\373\262C\313~4'5sC\231\231\n3\321I\311\275N\343\303{\013\002]\0135O\230\363\001\273\313m\277\0055O\211\336\323\245\247\025t\2556\230\216\263\272\227+\374\375\331\205\275\357\027\201\026\323\020\222|y\037\273\334\037\367\245u}g7\327\262\377&\372\216\035\366D\323\271\276\313\311]\331\2272\n\327\212B@\332\373\276t\016\354\364\212rn\256\376\276\257\327\277\224\375\373[P\255a\316\307\314*Z\216\234\177\005f\026\rG\031|\337\260\007\334n\372\215\025\367\224nyy\345\r\275r\273\355O\272c\373\362?F\316%\331\313{\275\217y\n\326\354\373R\346f\337o\302\234\3546\315T]\246Y\252\247\315Q\2543\024\320\331\251)@\213ifr\235\227\210\316"
+	.ascii	"\\g\245\241s\222\320\031\ttFb\235\217\204\316\307fk6\002:\027"
+	.ascii	"\001\235\211\204\316F\326y\b\350\\\024:\023\205\316C\326"
+	.string	"Y\bt\016\006\235\201\254\263\013tn]g\326u~\327\331]\347^P\241\016\232\0215\273\3073}}\374\021z\353Z\270\265n\323]\246\233\255{\332-\246\247\200\3041q\312\254\215\214\240W4\330V\325\203\327\244\003n\277Iu\273\035}\267\035\377\210\216\370M\177\374\245=bq\332L\367\016\353\227+Q\321\350\231\035J~\323\223E}\323\267\240\322\2059_\211\276\267\275\274\246o\266v\3573bp!\\\345\b\354f\036\344i\205\305\362\314\342>\263\270\335&\277\341z\250\216\321\323\370\362?\207\276\b\270\312\313\013q\027_\312Mm\016U\262\261\352\320\337f!\323\007\360vr\235\376\347\210\336\351\331\241y\317-\336\243k\200\035?\2718\217g\027\247\264n\331\311|\307\363\313\023\214\005\013n\267D?\340\216\215\356\372\322\315]\243\276\247\375d|\342G\275\273\r\275\361\227\212?\304\301ux\216\342\267\234;\266"
+	.string	"?|\342\267\330\0250\377c\341\017\277\265#\206\027|\341\367\230\337\006\027\353\302\021|\nP"
+	.ascii	"\2751_p0g\223\177M\245\351\t\200\373\022\200X\307O\225\341K\331"
+	.ascii	"\355<Mt\373\033\253\006\233P\273{\366\306\252\300\316\323LO\326"
+	.ascii	"\327\300\277\f~\300\246\366\220.\b\323W}\t\371\250XZ\361\366"
+	.ascii	"\362\332\3512kh>\347\036\225]!\275f\336\320\202<\004J\246\365"
+	.ascii	"u{p\2319\364\037\017Nv~:\357C\210\021#\334n\003K.\245\b\253\255"
+	.ascii	"\f4\224\315!\214+&\fv\2063\3063\f\252-\030\\\312f\022\313\331"
+	.ascii	"l:\255\230\270\232\312o:\261\226\030\266\266\226VN-\020.\230"
+	.ascii	" h(\233\307e\223I\342\n\213\031#\253\251\334*.\233L\256,\247"
+	.ascii	"\263\203\013f\026\221\0330\220\020\301\301\322\305\222\352\210"
+	.ascii	"\345drY1\265\270\266\226\"\226\\J\027Y%\264\234\\\316f\022[Q"
+	.ascii	"]1_`9\255\222V/\222XLe3i\245\265\225\244Rbg\326R+\311\345tj%"
+	.ascii	"\211\323\257\376&A\353\237\272\257\007C.\275\024\024\007\242"
+	.ascii	"<\245\005\24044/\351\227\336\2653\346g\264Z\221^\312T\017\340"
+	.ascii	"\265\250tJ\017\340\211?Q:\221*\315Q}\267Iz\252\367\2701\277("
+	.ascii	"G>\363S\312S\315mh\322?\205\275\0277=W\333\221\377\205"
+	.string	"\342\340\360\364}\337#\2427^\337\356r\211\336\371P\347\302\234\317\350\245|\032\351[\254y\222.'$\317.JhH\357duST\364F\316\326\356\206H}\361\213\364\300\254`\256\357w\031\367\245\336\013\215\371}\371\237[\267\231\036\372\351\253\333\303\203z\367\331\305\002\201\021\351\243\207\372\tin\304\364\340z\330Vvm6\335A\314\0202S\362\247\2509.\201\026\250\221(&\0312D3\"\"I\222\024\032\003Q\005\304\030F%<\017\0210\255dJ\212$J!\313\001[+T&t\225\356?2\340\330\347\277\230\023\202\253m\r'\205\330\251\261/\303\304fnA\202\254'\321\326\257\026\374V\364\236\2044W\305\356\357\267\023\302g\342X\225\316\223\307n\340\355\307\177\212\232\005^\315\217v%\005\020\354\273[\354\367\027+X\277|\217\033\240\031\373\277[d\201o+\264\b\332\272WP\246:\330\247\013\317\352"
+	.string	"1\310\310\310\302~\242~\367$\266pB"
+	.string	"|\022\036\377\376\367\324\210\211\200\034\024\360X\313\327\204\271\202\"z\373nH\253\024\275\350\027\372R"
+	.string	"\320oolI\227\035\363\311mv\234U\bf\325_T\213\305W\361\252F\020\354\241\256\016KHa\310\316i\305|\243\221\211x\372>\372y\\> \017\207?\222\377\361\bky!?\264( I\346\303\2051]\230\310 \017r_\370\221\001\232\n\376&\327\234\214"
+	.string	"&\276\343x\007\305|\\\340\030La\370\306\200\353\036v\222W\316\277U\2207k[[\251RE\212\026\363\255{\0205\024\331\224\022\031\007L\315\267\316E:\2273\314U@d\373\263\b\351|a\024\370\377\352!x\017\002\222\t\213"
+	.ascii	"\200Td{\033 \025FLo\r\001\277}\231\206\002\037\302v+\276lq\237"
+	.ascii	";\327\004\331\304\232(L(\335%H\343\376|\225m\210\214\361)/c\365"
+	.ascii	"T\2702\327\364\236`\202;@\305\303\2455ZQ\254f2\360SH\\\352\253"
+	.ascii	"\221q\017\344[d:c\340\325[6H\365\376\255\023\301m}Y!)\027\360"
+	.ascii	"\034Y\267\026~)\302\345e\\u-\261\301v\344\215\344\260\203N>\323"
+	.ascii	"\322vg\023,,\020\027\304\323\340\255p\345\031\255xel\243\317"
+	.ascii	"!\023\005\351\236\002\252^\024\373\237\213Kh\t\256\3368\006\250"
+	.ascii	"k\022\335\274\333\033\357r\r\024\327\013\325\243r\374\022\237"
+	.ascii	"\250\367q7\376\332\0344H\345\321\374bm\344\222\366\266\371\370"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_readEEPROM.169.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\303\003U\027"
+	.string	"\006(\220K\240\324U:h(\360\035\346>\025p8N\"\223\340\036\007\321\207\2357\335<\301\254jfH\333\351\311\317\264\354\375\275\355\357[\335\341d\f\270?o\361Js\274\261\226\360\"0\031<<\301\233\241\005\0365\345\325\315\022\262\211\224I\006y"
+	.string	"r"
+	.string	"{"
+	.string	"E\224\323-\260:\335\027\351\354\272N\357\332\334n\220\027\205\365JHv^H\325Zam\342\271\267X\253\323\244esn\177\266\f\317\362\375to\005\235\365cO\220\361',z\200xuR\302\007\370\363\330\003\334a\363\347\024\300\257CiRk\365\360\343\300e\210wy"
+	.string	"\271t\304\365\353\225\002xP\370><\177\370\361\230\317\226Z\353\262\357\347\363u}w\207v\267\301n\273\bT\353\342]\0136|\337;FB\366\263\342]\f9|\337\232\360Z\267\274#y\254\\\265[\344q\007w_\326\026\332m\336\223\362\232\224\2276oIy\233\362r\311\373\227\f\311#'\244V\236$\222\032E\231R\354\213n\3249\321\276\330\002*\271Nw7w#\\Y\201\265\177$\243\020\234\242"
+	.string	"ai>qUb:7\302\275Xy\376\223\344D$Uk\035T:\016\247\225\341\331\301\225q\372\362\246\033T\326\342\305e\357F\200\351.\033e'\311\216\223LK\335\t\206\314\016\342L\032\270\001\302Z\353\214\230\260\310\216\223+\270\326\252\243\374\030\223[v\244cW\302\223bV\265\366X\366H\2171a\177\342t)\310\320\275\214y\312\375\352a\264\343\344\0328\216(K\270\374\314\334\245\325\364Z\267G:\002]H\205\254\321\253\301|\313\216|\3648\273\242\262@A\2146CK\t\260\2016s\343B\273P\243\261\335 \314\324pJv\226RS\243\271\261\315`3\032\330M\255\202\rlv\313\201\245\274\326\206C\273\3012\330l7\230\253\270{\013\255\216C\242v\315c"
+	.string	"\345\222\323\344@fcO\374\207o\301"
+	.string	"\201\234B\356Z/>{o|"
+	.string	"\303\367m\331:\026\3164[v\224\343\306\267\230\236\216/~eD\204\212)\"\365\304o\313\216\253\326\354\363\345POf\023 \256\002Q\2501LF\215Q\310f\302\202\202\224\026\306\240\002\231\241\263\r\020@jDjR\034\325[\315\362\nP\037\357\211H\346qT\031i)!jJ\322G\027\303a\352\326\256 \230\313A|\261\003\372\270\357\270Pi\232\326\222\361<p9\022)\333\030L\327\\\360\260ar1\206-\276\351\303m\222^`\264w\303@*2C\332\314OF6\023\266)"
+	.string	"iWu?\315!GS\324\320X\f\037%yT\022r\377 `\255@\331\310\341\272\270;\004\321\233\200\231\375\200\243\306~\245#"
+	.ascii	"\265@\0164{E\312|\303w\n\203j"
+	.text
+	.section	.gnu.lto_writeEEPROM.170.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\215\006"
+	.string	"\242\013,3pM\322\030"
+	.string	"e\257=M\323\205s\260\330\220b\301j\360\005\232\t\203i\213\304\274\265u\304_F\003\220\371\377\267\376\206\326\334\202\234,\374-\023\"\267L\001\277\211\001Ce\340s\217r\031\214B\203{\325\203\233\006\206\016\013\225\203\200\260rR\266\t\255n"
+	.string	"R8:\025\252\211\330\220x\031\332~\202\242\345u\201F\255\021<\037\317\266\317gV\323\216Ohu\363\221\200\b\b\226\027(\273\030-,\333\211NB\376\374,\211/\035_%\263\217%\340\214X\230\254\354\256S\217\214\331\342\231$\031paV\266K\302\356\336.L#\327\374\r\376\203\237\023\f"
+	.ascii	"3\241k\037Xa\316@;\020\031\320\"\347bu\266\341\302(.X\002.\363"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_resetEEPROM.171.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"5\b"
+	.string	"b\01657Po\322\001\200z\025\217\231\264Z\\8&Yz\215\205\247\265D]\253\202y\340\263\3116\224\207\031\305\217\021\252C'\252\252\032\261\202\016\334\316\002\205\017j\266\311\336)\005\246\032\007\316\246S\351\244\233\331\3410<LZy\246\246\300\025\242\241\232\022\265VSn\241S\013E6\351\277\350LL!xEpx\250\306\265\211k\377\210;=\204\203\351(\t\365l\212\212w\314\007\027\004Y\241\033\341\366\235\354\355z\320\303>\265Pd\003\020\224\264d\307P\331\315\230\221YSd\001\261}\277t\355s\024\017t\270\234\354\256|\364K\037[>^\332\262_\276\215\326@d\305\"%fw'\374\270\365g\371']"
+	.string	"\313@\177\001\013\273\353\207e\0337\274m\004\333\t\366c\023"
+	.ascii	"2\241\023(H\354\005\004\343\200a`\013\235\033KEFTkM\rt\301\264"
+	.ascii	"\212au\266\341\302\370\036,#\224\341\227&\3009\267\020\346\023"
+	.text
+	.section	.gnu.lto_ensureEEPROMContainsValidData.172.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"%\b"
+	.string	"\322\31667Po\322\001\300\364b\307\325\361\357K@\r\376\243g\321Y\"\342\355\036\371\"\273\210|\2028\315(\"\260U\207\30613\rh\212\210\037P\376&p\341N\333\266\245L)\276@\r#\021\t\273\342%\212\244\221\202C\274\262R\004\r\030{`\310\"\004\206e\321\363\355C\025\312\301N\332\245\210|\347\017\247\233\017X)ou\324\230\250)8\327\005\222\026S\266\f\323\226\230\310wW\004\016N7_\365\247X#,\2333\366\267\245z\330\207\253(\373\351s\002D\\\274_\300\354b\324\320\354j\203\002b\373\036k\366\313\277\324\022\204\254\234Jbv7\352\307\265CM\315\007\360\266C\215+,@m\310\bx\034\374\250\254NW=-<Sf'\264\273\316\316\313\2707\267\235`\333\300\366I\017"
+	.ascii	"2\003\302\260\301\204\365\032\210\f{%\325\002P\350\325\304\274"
+	.ascii	"`\213k\242\177\b\371e\bq\351\236jz\212\246\240"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.173.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\b"
+	.string	"\302\21668@\215\323\001\240\371\031\375\255\030\253\2062v\236\304\243\265ZO\"e\351\324Pu\314\376WOS\025\035[\204A\303\\\024E\205Ew!?\317\240\315\264\"l\023i{\247\024\246\031\206\215\246S\351\244\232\331\331(p&\315<3\023\340\332\260\220\315\207Z\263\211}\241W+E\266\204'SHn\306D\204\333\234:\201b\007\322-\341\211'\003\202^T\321\367\"$\3429\023l\022\344{\377\bL\335\003<\205\007!\t\2701e\177[\224\033\366\253\225\"\373\002\360D\272W\240v-VT\326d\215t\330\276_\272\3679\2101\032(\354\226_\372\330\330\255c\326l\223\177\243\025\370(\241\bI\331\335)9\256=j\376I\277p\035\350\361J\330]G\256\303\270\345m\027\3306\260?\020\026"
+	.ascii	"2\241Ch\340\270Xp\007\226-A\032\023\314\003[\2009\260\231\316"
+	.ascii	"m\177\266\334\254=\360\352\225\345]\310\337\2039\241\314x\312"
+	.ascii	"\376\2451p./\204I\006"
+	.text
+	.section	.gnu.lto_changePidProfile.174.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\351\001\255\022"
+	.string	"\226\"|I\3200'\035\237\251:$\321\256\277\253^5d\357\020\351;:\225\361\020"
+	.string	"\017\223\\\240\226bnG\305l\361#\265\345\300\276\366\336\371s6$\240\305hj-2+\261\207\227~\210x"
+	.string	"\265\340\352\027\323!\351[\262\311\226)\005b"
+	.string	"a"
+	.string	"m"
+	.string	"5\037\341$\007\225\264\320@\003\013\234#\220S\233p\234\262>\340;\365\356\361\235\372D5\366\352\364+[\301\317\310\256\035\"\"\373-\346Y\253\017\321Q\2558\020\037\3408\265\314~q\234\255~\bA\321t5j\255\340\344p\331W\346\177\350"
+	.string	"\312\232\3157URk\365\226\265\n\367\274m\003\266Y\354=\t\252\371\333]B\356\223\367\261\317\233\252y\035\316\214\331\356\214\200i\267T\367\311\306\315vn\260\357\325\td{k\025]\247~\373\275]Oo\275\273\376*"
+	.ascii	"SP\35594j\315\331\335\250J\024\311\203Ot]\315C\370E0\036\335"
+	.ascii	"\352\324\266\214u\203\253\265\347rZ\334\022\234\202:#\273\317"
+	.ascii	"\371\270\213\b+\216D\343\0079%\334\227\341w\272Pe\f?\367\036"
+	.ascii	"\022B\037l\300 \367I\005\215gd+'<\205\3505\221\240\270\321\312"
+	.ascii	"\330\322\362\235\246\246IRyA\367\223\235\237\242{4\321@P\310"
+	.ascii	" \343\363\271\263\3109\215hQ\244\323\216\375\362\023\261\002"
+	.ascii	"\266Z\353\210_\342&^~\320\251#\310\354K\231\357\264\325\241\207"
+	.ascii	"\334\235?\364\333\234t\002fi\271\306\030p\206eet\371\030Q>/\b"
+	.ascii	"a@\"\"\272\304V\207\004\321\005c\"\272\214*/\330\003\327\030"
+	.ascii	"#\300akeT\201y\205`\250\002\302\214)/`\b\223\001[\004\374\212"
+	.ascii	"\021a\340\314\353\005\003W8\362^\235@\034N\030\224\3109s\307"
+	.ascii	"\316iC@\331\227f\335L\033\357\234\023\204\026\365\330\247\232"
+	.ascii	";\251\013\034\237\031\317Rj\372\001' @\002B\224\203\347\001\305"
+	.ascii	"X\260\375\325\"8\206.\350\300h\321\275\207Zj%\370\343\261\202"
+	.ascii	"\203\353\022\304F\034\002B\251\031\254\302\200lB\030\006\302"
+	.ascii	"\300\352\211N6\035\312\t\004\023y\nx\300\365\323\221\313\202"
+	.ascii	"\215i\304\214\361\005\230\006\333\263kr\310BS\224\032\212h\316"
+	.ascii	"\016s`\275=\250\270\305\025\236"
+	.text
+	.section	.gnu.lto_beeperOffSet.175.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"U\007"
+	.string	"\002N46Pu\032\003"
+	.string	"`\330\336hD*1\345c\260\264I\013\300\372\275\265,\211\203\034\304\377\304lMe\331\366WU\265\267\341\002p\202\t\357n)E"
+	.string	"1\"\267\224)\005}p\220\210\200\310*\262K\340\242\004\032Y\305.\013Q\210\244a\023\013M\222\b4\232\330V\232WA5\214l\233\031\232\266\315\317w\307S;\253\224j#rTa\225\002sX\323~&\030IZ[\377\337xja@\214\214\347\220\226\337\343\306\346*\371r\322\326\237\226\241[0l\215\262\n\347\025\215z\376\021\224\313\37754\241cy`\002\216\245\345\001\216e\271v\306\237\311\rP@:Xh\376\317Xb\316\220\253\235\262\247\363L\206"
+	.string	"\024\377\013;\357\303\215n\213\320v\242\255H\b"
+	.ascii	"\002Td\206F\3248\270p\3552\210\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperOffSetAll.176.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"M\007"
+	.string	"b\r36Po\322\030\200~\320+kv\366l\023`\004\200\350\261_\220\372\374\214\030uC\303\267H\264\t\252\337>\312\314\264"
+	.string	"\211\374\337<\362\021\264J\205\200hb\333\3362\005+\\\f\013\036)!-\001Qf1\0354\031\2222\242\032\263&@\237lb\021\373\304\f\004A\0211\255\"Z\003\317\220\324\242hN-V\335\252f\241\251\203r9a\300\214\017P,-\373b\276\033=\370\361\252Yh\372\027\220\332\340\264ce\227cFfO\033\225\221_\253Gx\271\336\373\313\263i\311\305p\327\343$e\267K\330\240\243\233\267Oi\027\262\004$\"\032(0\273\033!\210n\372\266UM\024\200\304\215\364q\032v\367G\342J:\324\277\340\177\370K\001\t"
+	.ascii	"\221\223\340Lh\313\007\336\206\033\\\023\305C\300`j\b\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperOffClear.177.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"e\007"
+	.string	"\"\31646Pu\032\003"
+	.string	"\340Y\306\301RO\224\356Zo\316\3211\232\224\331P\212!#\007\361?1[SY\266\375UU\355m\270"
+	.string	"\254G\237\330\323\nz\211\b\331R\312\224\002eXxph\320$4,\200\342$*\311f\330\004id\332\262\231\215\246\211$*\315\214;M\214\240[\205\306M\213m\343&\350\273\345\243\252\036\231\016\026F\314hBL\013\346\320\246\375P0\206\264\226\377\337\250j!"
+	.string	"\r\211g\217\227\177\243us\326\325R\322\326\2406\344\0222l\215\342\224\316\253\213~~\220\025\313\377)\024\301\343\313\300\003\034_\322\002\034_\355\332\031\177#/09\321X\251\371?\243\210;\303\256\266\212?)\017e\330\211\370_\230\3628\334\350\266\007m!\332~\004\b"
+	.ascii	"\002Td\342\221^4\270p\3552\210\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperOffClearAll.178.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \303]\005"
+	.string	"\202\211$/`e\323\001"
+	.string	"\324C\\&FTB\240\375\254\206\302\023X\310\326<\377\267\205b\037N\005\334\036P\024\021]\001O\rD@A\005"
+	.string	"\305\275S\n\226U\344\262\260)UZ\212]\017\211\312\214\242\025\302s\002\311\2642g\246\324\267\217\236\302\022/^,\034\260\277\r\306\216\375\301F\317\206\207\200Lw\316iWS@\260&B\td\373\2245\033\340\337g\023!\022f$\260\273\032=\327\0165\377\242\033\270n;,8v\327\220\3536w\274m\206\355\206\355\031\b"
+	.string	"3\003\366\231\001\301\367\273\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_getBeeperOffMask.179.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \330\035\006"
+	.string	"\"\213*2`M\323\001 \261\202\304\220\021,g\241\312\204\231\036\261V6\273\2535!\366\021L\371]\261\307\223\242\2001\372\016l\341/\316\262p@\001\214\032\331;\245\226\220\202\024MSF\031\305IBX\210\222j\210\320\305\223!\201\212\016sR\361\341\366p\263\251C0qA\314\017\305>\022\233\263\036\254\260\317,\334\354G\031\271\250\327@v#\272\222\ri<0lW\366\343k|\2432=x\270\352@\306\007D\207\310.\027\001nq\3360\2578o\240\305\351\037\365\317q\003L\353\262j\375M\nv\327/\253\0227\274m\001\333\001\266\255\b"
+	.ascii	"2\003\036::\020\302r\ro\215\030Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_setBeeperOffMask.180.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"U\007"
+	.string	"\"N45Pu\032\003\003h*\204{\335\312y\f\033Snf1\304\315\253\265\212!#\007\361?1[SY\266\375UU\355m\270"
+	.string	"\254G\237\330\323\nz!F\266\2242\245m`\200xp\310&\262K\240\302\024\"\311b\027\305HT\322\260\211\211fi\024\"Ml3\315\253\240\232E\266\315\013M\333\346\307\273\345c\252\235Of\225\0215\252\360\305\270\034\322\264\336\t\306\220\326\362\377\033S-\f\260Y\351\354\361\375\03475_Y-\252\266\376\264 \025\310\260u\211M8\237`\324\363\203\250\260\374\336B\023:\266\016L\300\261%=\300\261U\256\205\2617r\003\222\227\215\224\231\3773\212\2303\344j\243\330\203\352N\206"
+	.string	"\022\377\013Q]\207\033\335\026\241mD\333\217\b"
+	.ascii	"\002Td\342\221^4\270p\3552\210\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_getPreferredBeeperOffMask.181.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 \330%\006"
+	.string	"\"\313*3`M\323\001\200[\274\241\311bP\322$\267\223\365\t\234\270lvWkB\354#\230\362\273b\217'E\001c\364\035\330\302_\234e\001\230\202\0305\262wJ\001\226\220\202\024MSF\031\305IBX\210\222j\210\320\305\223!\201\212\016sR\361\341\366p\263\251C@qA\314\217\266\217\304\346\254\007+\3543\0137\373Q\264\220\372\t\221\335\210\222nA\232\017\f\333\225\375\370\032\337\250L\017\036\256:\220\321At\214\354r\021\340\026\347\r\363\212\363\006Z\234\376Q\377\0347\300.<\262j\375M\nv\327/\253\0227\274m\001\333\001\266\255\b"
+	.ascii	"2\003\036::\020\302r\ro\215\030Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_setPreferredBeeperOffMask.182.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"]\007"
+	.string	"\"\21646P\217\032\003\200\362)\267V\301@\264w\300\017\335v2\211(<*@\226\303\036h\306\t,\006\025\331wbf\032@\330]\240\273\034\217\225\311\255l$mK)S\neXxph\320$4,\200\242\004\032\311f\330\204(D\332\262\231\205&I\004\032\315\214+M\214\240[\205\306M\213m\343\246\347\273\345#\252\234\026\t\013#f4\241\265j9\214i?\023\214\"\255\345\3777\242Z\b\220\342\360\254z\371=fd\316\272VF\332\332\323~6>\206\255Kl\322\371\344\242\235?\204E\345\377\024\212\300\361e\340\001\215/i\001\215\257v\255\213?\325\013V\035\032)0\377gL\2713\354j\243\270s\362L\206\233\210\377\205'\357\303\215n{\320\026\242-H\b"
+	.ascii	"\002Td\342\221^4\270p\3552\210\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_setPidProfile.part.0.220.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\260\002]\025"
+	.string	"\246\345\207J\240RR:B\310*\3216\2127\3207\270\357l\0213\321\311'\262B\234C\020#\030|\230\256\256a\305U5\267\236\256\250\177e\244\307\277\231\204\371\024\326\216\0279\276\017\373\323\003p\017\034\257\204\261?\267\345W[k\204\354\235Rg"
+	.string	"v"
+	.string	"x"
+	.string	"6Wr\375\251:\332\335\031\365\317\237=\363O\240=\363\357H7?w\207\247D\013\245\322'\331\344\004x\244\033\327\335\240\250\251\335\263\344\244Gd'\355\237\260\375\3431\320\306\361\223\270\261\020\"\204L_\273[\236\254 \016|\245#\320\377y"
+	.string	"\303\036\234\327"
+	.ascii	"=>\247\"\037c\013v\327\262\237\233\274\355\023\333k\323\034\001"
+	.ascii	"\216Q\327JM\237\364_&\3006cw\347G\217\365@"
+	.string	"\026G\260\330\371\2743Y\272\322\231\222\372\2717\356\206\223\210!\347$q\324W\330\270W+P\b\016\215\330(!$\361\265{\226'}\312\250}\177\351P\276+\371O\261\027U\277Z\316\271=\tTX\241 9Y\0029\371)\316\344{\223\251\030l\320G\301\320\225\316\224\212\354d\355\003`'\307\323`'\375%_[;\266\202P\267\332\215R\304\241\204W\335\306\254\024\252\303\310\275\230&\354d\255*T\303\f\207\372\212\006\241\247\323\262\204&,|\350\242\365N\257\005i\255ZB\037 E\032X\325\206p\0277\006\210\273\213\342\267xQ\3067:i]\217~\330\203\235\374yz\243\350(\b\211C\220\376pH\007\241+\235&\325\304u!\253\013\244x\205\265\224\007\255E\256\343\307\335]W\"\007\206\201\261\341L\232\262\006\346\305\214)`\262\300|\300\004A\312I\016\227\263\211D\310\341fTr1\246\213\216\327"
+	.ascii	"g\322\204\370f{1]ft\267\362\346R\316\230-2\345\215\327+m\004"
+	.ascii	"\254\243\311\361\312\032\235\216W\316l\323\217[\211\274\342U"
+	.ascii	"#X'\270\326Zd\233Fk\265\035<\240\037\272\226Sq\fR\324\201U\253"
+	.ascii	"\037\3432v\276\221YZZ\256\206\\\276\323\275\200\002= p\002\031"
+	.ascii	"3\335\006\336\265\0273k\373\271%X\243\300h8\353\310\214\216\202"
+	.ascii	"\222w\332F\365\215t\312\212\303\314\n\245]@\255\330\332\265-"
+	.ascii	"y`\325\211\342V\236}\272/sK\001\022\304\177\347r\311X\254\241"
+	.ascii	"e\215Dy\230\215 \005Yv\251\303B\267\031 v\373v\314\220\204\324"
+	.ascii	"\006M\304#g@\2340\300\376\001\345\235\035\262i3\032\2030\240"
+	.ascii	"\205e\007g\350\004\241\317\003\326\026k\312>\003@\355\205\311"
+	.ascii	"i\234~m\030\003"
+	.text
+	.section	.gnu.lto_CSWTCH.31.246.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\006\b\355\030"
+	.string	"F\346\212Dp\350\312p\240\246\234 \b\215\013\f\032\222B'oq\350\266\330\031\257\300\300[\017"
+	.string	"%\253\035\\\336I\235b\200\320\r\261+\017[\003\006j\240BU\033!d\320\212n'\203\260\327\302\026h\023\302nr'\031w"
+	.string	"}"
+	.string	"r"
+	.string	"]4\364\271d\350o\301\320\327r\241\237\005\251\217\345\250\177e\264\320\2672\376>W\341l\024\2766\341r$\027\213\305\242\204~\0254\302\357@\270\032\362\301\323\220F\375\260\321\301\325H\240\247\221\r\372T\030\364\247\214\013>\206T\320W\023\364\245\214B\224\fA\377k<p!\006^\346\351\217\0027B\356\356"
+	.ascii	"T(D\307v{W\256\353<(\212\242\004\372u\343\356\226cf9\372g8\372"
+	.ascii	"\303\033}4\033\375\265F\237\f\215\376\330Q\024\335-\232\321'"
+	.ascii	"\273\214\215\261p06\356\305\326\271X9-v\016\213\023Y\361!*^$"
+	.ascii	"\305\273P\374\310\211'1\361%%\336\204\304\231\214\270\027\271"
+	.ascii	"\333\304\325\004\305\025\265%\342NB\034\n\210?!w}hqmQMEi1Me\031"
+	.ascii	"\355S K\217B~\350\213Q\352\207\361\320\007\323\241/\226\324\377"
+	.string	"\302\241\357eC?\277\364Gt\352\210\255\177\330\235\035:\240\364\274k&_\251_34\037\016\240\226\f@-\271G-\271G,\271\247&\225|\242Y\311O\317\312\035\226\314[}|\273\363\240>^\362qo]\316\352\307\301\352\303\271\352\277\351\321_\303\243\317\306\252\337\246\252\357\206\252\357\266\243\3376\325\177\223\352\303E\365\343\240\372tO}3N\375\262\246\376\031\035}4L\375\333\243\316\tq/\235\0132ox\006\231\227\006\371k\220\237\006\371`\377\335W\221\r\030$\027\304< \363\200\254\344\003\362\327_\334\357\307@m'\377\f\313\223\177\204\346\311\002\300N\356I\221N>\321\355|;y\t\356d\254\325d\2534\223\253\354|L\226Z\245\322'\325\211\350\224\026\255DD\"uh\035J\325L\026R\201\304\217h\031\222e3\031\230\236\027\304\353k\375\217\230\222\200\217\250Q\b\007\243\251\024\224\244\264\214\001"
+	.string	"\003\231)J\016\021\200\024\246\225\201\"\t$\024\272\240\007D8&\245H\221>\025e\205\305Q\027i\001\252d\274d\022\017\365\020:N\"2\3154\263\2102\232\276x\301%M\tC\301\265\347\205\215\232\277N\315_/e\037\307\037\370\b0\025\310\367\303\335p\032<\274\234\253\035\275k%i\223@\"Iwd\255\214@\214\360\340\032<\220\030=I\316\302\026\362\221\007\022\231\227\b\222\226\262\226\262\226\262\226\262\226\262\2262\324\257\302\340m\321\356\r&\337\270fQhh\013\350i\306\003\333\361\334\375\031)b0\357t\233D<"
+	.ascii	"\365\321\224\024zH\351\264g\242{\\\3475\336#V\\\261\227\016d"
+	.ascii	"\207}\272\203-\354\262\337\336dL\205\375A\3730$\013\030\334\202"
+	.ascii	"\n\257\335\230\260R\033\274P\265\343\r`\025"
+	.text
+	.section	.gnu.lto_.refs.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"m\006"
+	.string	"\366\320/+pK\222\016\366@\202\006UUUUUUUU]"
+	.string	"=_\276\276\275\257\311\021\276\266\325\266\331\326\232m\273\265\266H\232\265[\312\024 "
+	.string	"#"
+	.string	"%"
+	.string	"\334\356{C\325\223\347#\316ON\207\354\033{\306n\230\273f\036\274\334\301!\343N\273\203\334\236\224\213\257q\261~\213\210S@~b\375%z\313}\345x\301=\345x\300\361*\342\322=t\274\271\007\270g.\\\302|\006F\325\257\260?X\334`=\301\342\002\353'\353%\023\247\"/Q\037M\374\241\276\241\276\323\022\3447\002?T\242\021\205\260\206^\312:X\245\f\265t\301\024\232P\204~\306\237\366\0079`O\370\022r\212\037\361!\362&\003"
+	.ascii	"\002\210HQ\342\230\253\340\001"
+	.text
+	.section	.gnu.lto_.decls.c7c0bf2bd364e706,"e",@progbits
+	.string	"(\265/\375`\276[M\212\001\372\2252\221V LI:\215\001\252\\\233Yw\235(\221\"\b *\342\210\346\237fF\360\335\231\361*E\b`3\267\261\250*keW\252\b\333V\f\315\221\314\266\036\025"
+	.ascii	"\331\355Jz\350\277[\374\374=\320\354\003\r\241\f0\f\310J\024"
+	.ascii	"\0049#MgV\253\334{K)e\n\356\007\007\tW\t)\236\360\n\036|A\310"
+	.ascii	"\234d\232f\370t\276\r\025}\0332}\033\035\372\307O\307(~\334d"
+	.ascii	"\361.\237\325J\257\242\234A\271\331n\371p\374\204\337\246@\245"
+	.ascii	"\271\3716Y\032\265?(\336\032r\346\270\264\355\233o\243B\257\271"
+	.ascii	"j,\363\006\3361~7\215\265\3532\341L\232\300\373\345\366\355\234"
+	.ascii	"{o\241\371\332{k\030\032\272\351\3531\003\315h\202txh\201\335"
+	.ascii	"\270\371\232O\337\302\225\271|;\347\336Zb\276\356\231\013h\231"
+	.ascii	"\327\314%s\227{\247\231\271\177\227/\005\222eGY\320\0206\223"
+	.ascii	"F\327D\363\365\232\2766\242\257\205\350\353.}\375B\377\027\314"
+	.ascii	"o\037\237\325\332;\315\205\235\236\214\233o\230+\30625\334\346"
+	.ascii	"\346\261}]NV7_Ki\022\354m5\24060\320j@C\370\360\013\006\025\213"
+	.ascii	"\202\303\314\315\327Q\372\351\237\376\357^\227\026[\214\335\315"
+	.ascii	"\267fjI\226(\311\273\\\256\336\335r\265X\346\355r\263\374\336"
+	.ascii	"]<<&fh]\356Z\331\355r\335\256\235\265\353\332\373\n\304\221\257"
+	.ascii	"5~\200{\357!\2353X\266\264\345d\373f\201\320\rM4\026\re\315\306"
+	.ascii	"\217\233\237\222\351[3f\217/+\267\356^\271s\267\212e^\272\013"
+	.ascii	"\345\227\355\266\375\262=\361\372@w\337\266t}\355\275\374@w\343"
+	.ascii	"\256\034^~9@\207\217\346\336\233\356\302\331\275\235\246\345"
+	.ascii	"\256\032\321<\34374\264\363E\325\307\226\223\377+\345W\356\277"
+	.ascii	"Nl\363R\301A#\345\351\354\346;%\307\240\323\021\344\346\247W"
+	.ascii	"\372F\371\360+\345\2241\207\303\307\3158\366\007}\312B\037=\243"
+	.ascii	"\217\202\321G\257\350\243m\372(\231\316\261?\250\220\005B\217"
+	.ascii	"\036\321\266\312\002\241\030\354\017zTK\037}\241\217F\351\237"
+	.ascii	"j\364\177\3238\350\2478\267\262\027\320r\316\352\3044o\376/\332"
+	.ascii	"=\333\371\"\307,r\363\022uj\n\201\272\371gS\207)\243\244\271"
+	.ascii	"\346n \\\236\204I#\344\013O\213\334\027ZT\026\226/N\232Y~\213"
+	.ascii	"\305\336Ui\356\275\264a\254\230&lf\310\320\210\255\271N=\232"
+	.ascii	")l|\301A\3350\003,k\342\375v\315}\362j\366\270b\227\354&\271"
+	.ascii	"?.\222{\344\356\2709n\220\253\343*\271Cn\330\365\272`\267\354"
+	.ascii	"r]\263\013\344v]#\367\353\362\270Dn\221;v}X\346\025rg\374\322"
+	.ascii	"\2705\236\375\376\330\232L?\276\260xa6\205\\\026W\006^~9\300"
+	.ascii	"\211Fs\357\215\345\n\271Yw\013\237Ui\246\223\025\2703H\232{/"
+	.ascii	"\327\334&\037_v\315E\321\325\344\263{;M=\373\311\311\355\253"
+	.ascii	"\354\n\261d\354\036^\276\351\024/\2545\373~\033fL\333\327\336"
+	.ascii	"\3135W\210\r\f\362\265\3672h\bm\322%K\311\001\362\305\201\203"
+	.ascii	"\245\t^\213\233\177\322\351k\343\336\260\314\253\365[;k\366\214"
+	.ascii	"\246\265\323\366^\352\340\246\030tOn\276\025By\002\003\003\003"
+	.ascii	"\255\020\372\223\251\263\235\005B\337\344L\377w\352W\306\177"
+	.ascii	"U\334\025\027\353r\215q\202\273\331\205 \2331\2758$7\377\034"
+	.ascii	"\323'\241E\213\377\276\2701\256\013\313\2740n\325\257\225e\273"
+	.ascii	"\205\273\242\022\341\302\270T\366m\207i\271\251>\274y\271\022"
+	.ascii	"\333{9\02444d\303EG\226>\235\177\336\320\030K\377\214\241\177"
+	.ascii	"\276\320W\352\303\357\024\316\323\213\266 7\333\330\037\364g"
+	.ascii	"\225\266M\013\204b`\177\320\3475\372\231O?s\321\317T\364s\232"
+	.ascii	"~\376\241\237\265\364\263\225>V\243\217\365\264\006\366\007="
+	.ascii	"\240\005B\217\345\364\361\232>>\242\217\271\364\361\n\375;F\377"
+	.ascii	"\326\351_7\375\267#\372r:\364\355bh\020\354\017\372\246\005B"
+	.ascii	"\177Q\350[?m\273\330<\313\344`\365n\267X\270\237M\313\275\334"
+	.ascii	"{"
+	.string	"\311s}\250a{\341\346[/\372\226\003\212\003\003-\007\364\326N_7\r\202\005Bo\217h\020\026\b\315\366\007\375\262\316\312\351\334\271\270\233r\363E\210B\305\3266\343\013\016\212}\333a\352\331Nx2\276\366^\236\204\377\303\037\002\tV\316\306\3317\274\374J\325\270\260\232{/o\315\376\017r\366\314\256\341\345\327\336\\88\240ai\243\002\270\367\376o\253\330+v\316Z\261t\226i\345\254\224\333)\226\312\355rhhhh(\bGi\301\202IN\266]\026\b\005\262?\350\355\223\376\252OB\377\002\272\307\002\241\326\3156\261\314\013\354\223%\217\316\032$k\320\334|\n\350\234\242['\337p\267I\270\005\372\366\002\324\006\332\013\320\347\350\240\027\224\330\245U\353\300\336O{o\nv\354\302\302\270\334l\227X&\267j6\355!\220p\314\204\266\313\366\336Vm\004\255\275\233\254\032O\232\275\233x\254\005\200\265"
+	.string	"\310c\\B\332\320\374T[\264\017\267/\374\240UX\313\275\266\367\346\271a6\311\250n\356\261?\350\257\266Q\026\b\365\261?\250\006\026\b\375m\222\337\222\331\262\013p\224\224\326^\333{\351\303\263\2141\225\343\346/-\020\252\355\017\372[+\031\314\217;\300\207\301ps\205g\370\263\027\016\021EY\b(*\300\355\177~\210\361\3019\200+\001\330\022\376\253\001\274\367\377\212\r\241\367\237\377\274"
+	.string	"\017\271O\330\207\324\251!\nw\335\335\025@\330\307\365\300\365\177\372"
+	.string	"\271P\247\3165\256pU(\303H\260\216\377*"
+	.string	"\357\307]w\377-&\261`\277\340?mp\026\273\337r\340\267V\354\234}\341\307X~\273\366\333%\277\245\002\001\\\367[\267\337\276\375\226-\355\267h\017\300t\033\370?\201\337\202\275\203\257\200\257\374x\312\211\376\234\345\307VQ~\354\302\177\013\020w\225l\007\277\365\360[\242k\005\345\307Y\377-\202\373m\360\267\030\260GV\003\277\035\376\370-\375\357\376/\023~\362\3330\277\005\363c\346o\305\210\340\277#\300N~\213E\002\270\211\005K\363\237\303\177\013~\354\366\343\265\037/y\210?\363\331\035\377m"
+	.ascii	"F\373q\361\354\267Y\3775\001\203\340\307K%'L\230\331\005\334"
+	.ascii	"b\222\016~\033\342\033\374\271\312U\001\227\375X%\373\277\302"
+	.ascii	"\035q\234?K\371-\022\036\273\236\333\377*$\216\376y\t\222\377"
+	.ascii	"\206\300`\177\222\317\262`\261\353\374'\327\177\373\376\353w"
+	.ascii	"z\371\021\034v\242\371/g\345\177\225\377W~|\363_\355\177\372"
+	.ascii	"\243\024\\\013\200\031\341\360c\r~\274\301\377\373\243\016\370"
+	.ascii	"\257\333\177\231\377u\362\337\266\377\256\375\267\311\177\337"
+	.ascii	"~LT\344\277`\377U\373\357\022\"\377y~\364\002?\036\362c!?\006"
+	.ascii	"\362c\037?\366\372\361\216\037o\375X\353\3076~<\343\307X?\276"
+	.ascii	"\3721\213\0373\375\270\004?\036\301\217C\360\343\023?^\177\234"
+	.ascii	"\374\261\361\307\036\370\261\321\217\207?\026\376X\003?\306\300"
+	.ascii	"\217-\360\343\021?n\300\217\021\360c\020~L\364\343\016?\016\300"
+	.ascii	"\217\201~\374\363c\234\037\337\037\377\277j\376\373\367_\274"
+	.ascii	"\377f\371/\334\177q\374\367\306\177\263\376K\343\277X\377\215"
+	.ascii	"\361\337\027\377\275\372o\213\377J\375w\305\177\243\376\013\365"
+	.ascii	"\337\247\3776\375\227\004\377m\341\277&\376[\342\277\353\177"
+	.string	"\223\377U\372\357\361\277\306\377z\340\277G\377U\377K\342\277\035\370/\007\376\273\201\377Z\340\277+\374\226\350\277\022\370\257\367_\b\374\367\001\377m\300\177w\376k\302\177E\3747\304\177\025\360\337\242\377\036\340\277 ~{\365_\237\377\362\374\177\362\333\020\377\315\371\255\232\337\372\375\366\356\267s\377Q\370m\225\337\312\3756\356\267^\277\335\372m\361\267\"~\273\200\377t\377\313\376\203\340\377\334\377\f\002\003\003\003\177m\3743T\360\227\300!M\332)Jk\273\360"
+	.ascii	"\311Y\240\037\340\3365:\360Pi\221\002\315\311\224\372\321=A\223"
+	.ascii	"\247\364\274\244n>\005\\:\bM\321s\2324yM\tX=\313\315%\367\265"
+	.ascii	"w\215\016)\22542\260\324\2348\306\250\371qs_P\216\024\r\246\224"
+	.ascii	"\233OA\rM\201_\321\363\031\313\314g\262\223\022\260\264\232\232"
+	.ascii	"@\034\331k\374r\232Sj4\271\371\024\250\320\037l\001\002\026\261"
+	.ascii	"[Z\206\344\270\371\023\370\351[$6\223\271ef"
+	.string	"2x.h\331\305\004\364\327\007\325\341\023\354\351\n\300\212\236\375\230\331/\273\225\200\245\305\324\007B\222//W;eQwr7\177\202*\272\203\260\242\347\276[f\356\313lG\370\372\306l\217\2632m7\177\0025\355\001\224fs\256O+!\303\373\273\371\023\004\321\030\276\024=\207\271e\3460Y-7\241m+\fzC\310\326\234\205\205\315\270\371\023\264\320\037\214}\371\222\367\264\031\236+M\352\356\002\365\007gzzyO\357\275\231\226\233J\203\214\276\035.oWY\226\231\367\356\214\004i\273\371@}:\bK\321s\227[f\356\222\323J\350\322\332W \220h\255\361\343\331\"\347$\n\213\376`M\213\226\274\005\303\336{\177\245L\330\330\2326K\266 b\266\354\335\3708\203\302\301\246?\210r\367\273l\367\200\2757S\317v\322+\373\332XXB:0\364t\370\270\371@<\364\007g\260\034K\266\263\331["
+	.string	".\356\260\204\362\223\227/;\376\236\355\354\033\216\236\225X\222\233\0174\245;@+z\246cf\272\213\246\235\242v\023\216\"$wr\035\354\223\037X\334\315\317\200FoXS\364,g\231Y.\317]\215@\366\346\345*\277\340\304e\355\346<\367\347*\331\312=\273Zfi\302<\335\274c3\340i\016QE\317Sn\231yJF\323N{7\311\020Rr\205W\007\270\253\260:\344\034\2311c\356\346gx\242\377\366\226\343\320\275\355R\213\252jcU\t}`W\224\231\371\3113\\\216\002\227\343\354\256\332\033k3\361\221"
+	.ascii	"\203\b^\035\340\306\252\022\3723\024\313\314q\017\223c\301I\006"
+	.ascii	"e\351\302\315\377\263o\377mN.2_\236\334\374\f^\372\031^\350\337"
+	.ascii	"\356\246\252\275\367\325\271\334UN9\350ooOk\205~\035\213\355"
+	.ascii	"\006\377\363\336\030@a\271Q\244\375\330{[?]\344I\023\r\r\366"
+	.ascii	"iW\025\225\266\305T\302\226\325\323\226\013Qi[V>Qi[\233\351)"
+	.ascii	"\b\223O\325\336b\212J\333\333\347\351\211\311\004-\253\250\264"
+	.ascii	"\246\355\023\225\266\2556\212;+\273\227[L\373Ik\373\354\247\335"
+	.ascii	"\264\323\264\2544\210z\332\262\212Jk\262\362\211J\333\262\332"
+	.ascii	"i[\273g?5U\251x\332U>;m\213o\247iY\365D\245iYE\245m=\261^V(\001"
+	.ascii	"|\021\370\303K\215\345\213z\332-\246j4U\365\330E-\265v\336\336"
+	.ascii	"v\rjWm\273\2757\330\273\206VU^\223\013\366\315\311\256\205S\223"
+	.ascii	"&-\273\334{k\230r\342\322\332OvLv\333E\031\321\332\333\210\023"
+	.ascii	"\322\236\332{\357\021\230\226v\333\313\3321\345\250\261\245\240"
+	.ascii	"\366\336\260\227{O\355\315d\267\335\336\233i\357\235V\325X\356"
+	.ascii	"=\243'\352kjjo\254\240\251]\203\t\016j\357"
+	.string	"\273\266\367f\025\225\306\245\365\001\216I\332\327N\261d\262QRZ\373k\347mU\3514\246\263-\265\367\266c\364\227\225\213\276\334$\bg\216K\216\0367\377'\213\316mA?i\310\216\334\374\037):\257\t\031\302\367u\363\177\326tf\"\006\304\005\217\233\377\003d\211\363f\203\355\305\315\371\205\033\250\266\265\271\233\377sC\347\263\234\242\255\305\216\252\254\344\246\255\313\013\263\233\377\323\224\315\204r\231\315\323\222\307\206\313\230\254\265\233\217\301\214\006\300[\321\363\330-3\217e1\313Te\367v\303C\323\274\001\363\002\274q\3631lA\"v\265\320\322\240\270\371\210\215Q\267u\346\346c\230\242\301r\214\034\004\237UM\300)L3\027\311Fr\230ef\260,\344\371+\017y\316.\300\362\0131\315\354\002,\023\001l\336\354\341\235\331\241\3631,\321\250\226\005B\257\305\376\240\307\020\246\377\214\365\034\344\317.2\214\fD"
+	.ascii	":\324\224\271\371G\225\252f\227\233\217\201K\377\317^\271+\357"
+	.ascii	"\310:r\217\314\3032\263\217\314e\226}\344\032\031\007>\253\322"
+	.ascii	"O\234\352\232}9\366\276d\350e\037y\213\2569#\317G\246A\326G$"
+	.ascii	"\214\207K\231\265*;\371>c\364}\354\364}\342\262\226MS\363Bs\363"
+	.ascii	"}\312t\316\3126,3\337\370\326\301\321\361\266\326t\263\211\275"
+	.ascii	"\367\266\227\202\246\227\202\336g\210\276\317\r}\237)\375\036"
+	.ascii	"2:\273\360\341\031\013\003'R\340nN\355\017\372\236=\215\366D"
+	.ascii	"\321\267\263?(\007eE\317V\267\314l\225\251JX\323\332.@\024a\302"
+	.ascii	"\352\220^\371\262\265\334\374\036$\372\317U\231\n\013\207\031"
+	.ascii	"\222\233s\013\020\260\225\005\336\374\036.\375\347)\251\264\034"
+	.ascii	"L*n\226\372\377\314\"G\253\212\212Z\224\233W\334$LQ\1777\277"
+	.ascii	"'\206\316)2S\206\002\001Ue\323\202\213\255\231S\340@$L\201~\200"
+	.ascii	"YE\216\262\314\234\"o\255\305F\345\206\346?Ce\024i\262V\210\335"
+	.ascii	"\374d\263cG\227\r&;\345\246\314\244\332^"
+	.string	"7\237\307N\237gN\237\207\251\317\243D\377x\215\032\354#\217\307\0265i\214\270\375\205\335\354e\331d\357\035\224B\211kN\335|\021\310H\001\3422\330\fFc\231\370\f\326kbv\377\246\2328\352Ov\236z6\013'\252\2573\267\314\237\340\263\252\t\240\360Z4\367\336\227nF\235\324M>O\330\237\337\031%h\210\334\354\367\377xL\216V\225\356\353\242\267\344\346\276.2QN7\237'\210\376\217\303`1\270i\231\230\017s\271E\303]\036\264\334\273\311\336\373\"l!\201\017k\271\321\344\303y\030\214\005NQ\273\211\213\003\260\275\306\017phG+\f\333\026\235\177\f\346\013\206\262\246\217\357f/\313m\244\253/\356\346\363\340\320\377-\023\357a\275\345\016\272.\364\274\302\334|\236\027\372<-\264\335\026\b=\017\224\376\016\032\375\235>\274;\236\034h\250nd\301v\226\211\3570\026\273\334'\201\016\207q"
+	.string	"\366\266\306\357\016\327-\327\370\211\245dy`=\320\374\035-\372;V\364w\230\350\037_\2313\233\222\021u\363\334\237\\-,|6"
+	.string	"\255\204\245dS\270\326n\376q\025Le\214\006\224\0257S\301R\022\260\275\\\311Y&\246\202\247<\004\022n\227{\227\361\364\325\360s\221\363w\306\364w\272\242\250\331\300\240\332\202v3\232\217\002\234e!\263\352\033\003\fb\3257\006hff\343\253l\fG\337\230\030\021\373\006\3277\006\250\206\225`,|V\245\335\234\262\232\037\312H`\352\033\023k\016\t\002d\254\b\016\373\361\205\366\243"
+	.ascii	"C\372\306\304p\034^\303"
+	.string	"m\030\016\277\200\227`7\314\304l8\r?\301Pp\023\314\004\277a'\226\211\325\360\362\370\f\243=\337&I\354[\021\276\2761\300\017_`|\307bj\030\t\016\263vX\233\211o\004\260!}c\200hjX\210\335\263v]\273\211\t\304\021\246\2761\300\275\227CCC7Clh\365m\220\355\322\002\241A\366\007\375\316\326\327\371\323\327\211\242\257\223\246\257C\246\257\323\245\257\343\202\276N\n\3755\013\204\342\260\213\301\360\221\3430l\344!\220\360\234'\034\226\367n\262\026"
+	.string	";\326\002\340\224\002\244\351\0054_\207I?\247O?\207\213~\216\024\375\234\245~\016\017\375\234+}\0343\3728y\3728r=\2742\235\022\275\0367\377\307]\230\207eb/\274\003\316\013\347\260o\326\016\253hl\255\271\367\322\013\353\260{j|dk"
+	.ascii	"\367^\006\r\r\345"
+	.string	"\004\022)SC\363qr\350\343\254\320\277i\352\037sa\0348n4aq3\332\365\202\231\360\362M3\271\246\266\360\r\254\205\263\260\r\313\3048\360\214c\032\270\306\363r\357\247\017\030\007~\301\242\351\207\003;a\027x\3716\001<\251&\306\201e\250\30080\f\214e\355\326v\323\025\bCp\354(\003\314\341b\206J/'[-\013\204f\260?\350o\254\350\337<\301.X<2gT\334\374\233%\216q\023\246\177\343\245\2574\240A\266\234\221r\363o\\h?\334\302\332u\3455\314\246\025\246\262L\\\205\241p\325\375\202Q\354\234{79\371\332{\017i\030\302\271\221\303J\005\232\247\2360`\2257\267\233ocf\355\313\fG\261a\026X\n\253\260L\274\002\007gR\257!E\270\244n~\007PZ\310G\216\034\351\016;CJ\314\006\251\257\265T\307\323\0358T\226P\241-\377\333\340.V?\310n\276"
+	.string	"\350\264P\216t+\335\312{8cRa\210\024\227d\330\306\364"
+	.string	"thi\251\215\261s{\177-\204\350\001\204\325\250\221\332\260<\342\304X\301\251\372rF%\353\251\r\235\277%vf\002\310\322\003x\221\316Hg\234WlNb\254"
+	.string	"\302\031Y\321t\363\005P\245\205\316\274x\221bY\264M\225\001\356\216H\030 \225\021,l\251\013O\261p\330\351V%\216\231\306\270^\304\270\240%\215\221\302\320\202%\253Lw\031\241\222q\3639H\243\205\264\244S\351Tz\025\024\327G$\fp'\315\030Z\230\324\352\351\025\366\261\"\211TZeC\243\312\213\226\264*\2452\2465\345\216\350(\035~Xi\213,D'\006\324\230\332\315\347`\213\026r\342\364T\205S\312\"\215\022\264\235\236\266\r\257\0374RxV"
+	.string	"wT\r\241\243\0357\256\334\374\247+\236\262\270\202\006.y\333\272\371\1776\026\214\211\244\355\3464\305\323\250\337&\355\262e\016\355\346s"
+	.string	"D\247(\236B\3756'\r\027^\214\334|\016\272\364\237>\37569]W\352\372n>\007[\372\034\320\320Ci)S\312\264J\335a\335\032)\242"
+	.string	"\303\350\241$\201\201y\017Kj\314\006\316\026\261%7\344\364\320\0175j\352\244\310\3104=aar\363\003\300C\017\321@\203\0065\223\022\221\032\263q3\003\007\030\255\233\277\301\030=\264\202\f\031\324L\237T\330\0241\036\034M\250\352"
+	.string	"\217\232\311\311\273r\222U\346\006\257\212.M\031\224\256\307\037\325\327\315\337`M\0179\371\371\3452\251\"F\316\031Utz7\177\203\032z"
+	.string	"`\302\204A\373l\317\322\t\257\353+\007\206\227\330\017\276\243}9\215W\r'\315\3776)\2220U^MTLSL\222\245\030\f\245!\275\262\243\222\342\346o\220B\017\340\312\227/$X\355(K\3356\225\026\237\036@^\036\272\207\306\220\n\322\024\303\351aU\367B\357\350\036\246\353Q$mOI\021\254\035nz\250o\313\026\224\213E\333T\301\270\"/\304\366\306\022\262\351kQ\006\207r\321\271\273\322\333K=\224\005\017/\307Y#R=\310\210\2211\211\224\271\371"
+	.ascii	"@\241\207\334\212\376\243W~\005\315b\3216U\020\334\233"
+	.string	"\020\356\263\242#\207\335\321,\267\001\362\007\330\343\346\377\241X\376\333\340\324\315\270\312\303\202\326\345\301h\021dy\002\230$TnF\351\356\fl\005\210\334\0305\332\216):j\305JN\242U\354\2755\003\347Jj\007\240\017\020\273#7_\203&\272\202\263\242\243rr8,3-7U\006%U^\256>\274UE\335|\r\304\264\005`EG\245HA\247\344\247\345\266\372\200U\240\337\016\233\2242PnF\247h\320Cg\360Tttm\r\215+\001k\271\257.\340\342L\230\030\033\330\324\216\203r\223b\352E\330\315pXm\n\02147_\203\033\372\226\255\211}\333\301{\333\020\363\205:A\331\302\240N\3206\003X\221\332\302zC\237\240L\313D\235\240n\271\331B\211\237\316\327\240I?\2032\372\031\374\351g0F?\203/:\003\030EG\223\240IP&=PU6-\266\2145w\225\\\007\233\276\0271"
+	.string	"o\376Q&\350\222\2520xw7\247]\036i\320\272n~\006U\364E@\321P#\350\031^~9\200KM\023}\3012Q4\324,(\347/\213\211\306\362\350\231MV\326\235\323\315\250\222\017G\2278\317\n\016\306\315'\023\375\f\310t\006;\212\216\022a\242DP2\273\277\"\260\205\254\271\253\260:\354\230aF}\335<\266\003v\205J\335\315\317@\207\376\217\212Y&\212\004-\362\204\"A\215\240G\254\035\326\336V#\300\2718\023\006\270\367\016\032\312\361\242\002I[\316?\032v\364\310\177\243\330>\373\226\202\031\"e7\243`\037\216\206E\241\031\273\371\306\376\240\317"
+	.string	"\205>\006b\3641\310\242;\270Rt\364\353\313\213\016[\032\026Sw \245\350(\020\024\b\032$?\365\354'\256,\275\037B\252\334\274\205\376(B&v\3631@\242;\020\203\3528\352\003\325\321\305\311K3}Qf\306\227\233Q/\264G\027\217\035\030l\351\016\376\\8\232\205\272\200r="
+	.ascii	"\253\351\252(\t\224t\f\212I\337\315[\313\264\030]j|\334|\f\256"
+	.ascii	"\364E@\265\320\0339\311\316\323r[\245K\306\210\261\202\342\260"
+	.ascii	"LT\013\265\221\246\303\245\245\242-\347_\260E\377\002)\032\245"
+	.ascii	"\201\326\230!\003\353\202#\232\003U\321Q\030(\214\214\266\271"
+	.ascii	"\352p\242\302\312\024\271\371\027\350\320\034\266\320\251\243"
+	.ascii	".\320)\261\021\316+d\254\274\334\214Z\241Wh\025J\205\266\270"
+	.ascii	"\200Js\350*\262H,\372tt\005\372\204\262\020\302\332W \340v\376"
+	.ascii	"\344p|\271\331FG\224\022\0257\243Q\250\n4\005\n\205\242\350\323"
+	.ascii	"\034\320\212\2166\241MUx\356\254\314m\335|\013\262h\016dE?\003"
+	.ascii	"\377@tg4*\r[\223\333\344\".\306\315\267\200\2519H)\363SM\231"
+	.ascii	"\023\216\004\224\215\222%N\232PQ\264\226\334|\2429\323\234gN"
+	.ascii	"3'\240\005H4\207\271-?\305\204@\202e\236[\316?!,\246\276\021"
+	.ascii	"\346\320.\337\030Z\212\233\375\226ewQ\360\336n\276\005>\364E"
+	.ascii	"\350;\371.\025\257\"wf\200\347\030\313<\373\316\346I\203\016"
+	.ascii	"\305[\316\267@\205~\005h\364\371\345\fc\023'\205W\343\346\237"
+	.ascii	"`\376\333\334t\335\001\001\273\371zI\313\252\236\330n\376\271"
+	.ascii	"\207\325\\\211Sq\363O\275\3776%\360\202\003\311\315g\236\206"
+	.ascii	"\252\340\013\007\233=40>\270\374\314\373\317.\026\214"
+	.ascii	"U\353\200\024\r,17\357\330\037\364\324\361\341'\227+dmn\356M"
+	.ascii	"s\320+\372\211\207wf\311x\357\246\272\267]\205\325\301\346k,"
+	.ascii	".\357\346W\260\324\034\356\212~\306\3352\317\2703K\tX{[\201\300"
+	.ascii	"rwS\003\205Z\225\233\355x\304X\264\br\363+(\242o\341\346N9k\207"
+	.ascii	"U$\206\244YEH\363\274rF9\345\322\024Nc}\200'\226\223\356\254"
+	.ascii	"\263\314\363\312i%H\347M\315\371\351\374\n\252\364+p\322\337"
+	.ascii	"@F\237R\316)\226\031tR\271sjQ\343\346o\020\243K\260m\020\372"
+	.ascii	"@\033\204~\003\027\375\rQ4\2074E\026\211=\271~\0169\211\234E"
+	.ascii	",\363\344:\341>8\355\246.\016\260\334\325\350`\353\240\3445o"
+	.ascii	"~[>\261\220\341\266v\3637\250\351\3332#gX\036\332\221\023\254"
+	.ascii	"\f\313\330Yf\355\272J\b\273\322\\cv2\261vX=\373\211\371\245\331"
+	.ascii	"v\212\235`;L>{\347\250\373jr>9\231\247\333\311v:\261\314\263"
+	.ascii	"\355L\362\223\310Y\344\351l;\221\224PF\327\334{\211\303\345O"
+	.ascii	"\210\335N6r0\0268E=\300l\357dr*9\227X;\254\345\276\302qR\244"
+	.ascii	"\310\213S\355\\\263\314\223\311\232\006\0354z\200fh\376\317%"
+	.ascii	"g\332\333\n\032)n>_\260is,r\334\374\r1\364\177\236Y\346\211\306"
+	.ascii	"\223\202\210\232 7\237\313\203Q\301\264\202\305\315\377\273\224"
+	.ascii	"\3776\031\006\034\031\335\315\337\340B\177\303\224\376\206}\222"
+	.ascii	"\351-\315\254\272\233\257\341\214\276\0062\372\032\370\3645\350"
+	.ascii	"\351k\320\242\3773\354\004;\323\254\370\325\201\3317<:)\247\233"
+	.ascii	"\257\301N\337\245\005B\205\354\017z\0029\205\234_\277\r\317\330"
+	.ascii	"\333\016\267\233\257AN\377\f\362\337f\002=\260\270\335\234\355"
+	.ascii	"\245\240\247\217\237?~\233;'\344k\352\346k\210\323?\275\316\036"
+	.ascii	"\277\315N^\020\266\263\233\257\301M\377\354r\013\364\223q\363"
+	.ascii	"\311CCiH\302\341&\213y\203F\216\237<\376S\307\271\303\252u\240"
+	.ascii	"\205\300<\013\204\352\330\037\364"
+	.string	":\371\3603G\335\224\246\222\233\257\301Kw\3308p\200MY*L\360\244n\276\006*\335\001\353\306\2154=\236\370\bs\363\203\376t\207\034g\326\231u^]\271\"^\232\033\253\206\020z\345\213\007\363\346\007i\321\035\312f|\306IC\203\2757\3246\221W\304J\023\205\221\035d'\215\234\004\357\035\261\023\022\247;\254aa\345=7\2350iXX\235\351\016Ob\3048\257\306\260\0304S\230\020\321\035\272\274x\221\343\274P\230\2215\266\245;\004VU\235WE\260\2766V\r\241\364*\013\220\356\346\377\264\372y\225\361\224p\311\273\371\1779\311\177\033\264\216*\315\231\233\037\004C{\340B\213\0269NM\032\305\304B\310\315\017z\322\036\b\221\222\002\343\301\23248\232\332\203\260\025+\350vV\230ij\202\242=H\022\365\250\375\344\013\315\223\277\0377\237\002&\332\203\264\023\352LqB\345\275\242!c_,"
+	.string	"\303\354\306\264\007n\347\323\371\024\210\206n3*\257\233O\201\020\215A\212\242\237\373\334g\252\221\204p]B\001\303\221\210\224H\2530\351X\024&mV!\322ht\222\020\256K(\250A\234#\021y@\026\225J\252\272\200\244$\t\n\326\243\252,f@\256@<\252J\312%%\317\221\210\222\220I%U\r\"\2157G\"\3029\022\221\211\244\007\023\311\037\243\360xT\034aB\0055iI\251&wVu\304\r1g\204\262\370\023<N`\024\016\221Va\222\007\345Z$\341a\351x\364\201\211\245c\321\370\301\b\004\b\022"
+	.ascii	"\204\t\017*q\3118<\026=$\225K\036<\260\200L\"\255\310cj$T\215"
+	.ascii	"yU\036\221\303\323h=\026\223F\364HD\303dph\244\226H.\211PW!\220"
+	.ascii	"R]\205\353\b\240#\021)\207\026(\207*(\205\301a\322\303pU.y\200"
+	.ascii	"\030BU.\375\034\025K\b\217\031(M8!\005UY\001\245\322\321\315"
+	.ascii	"\221\210T#\2412C\003\216\310\342\252.%\025\325\344\322RR1\307"
+	.ascii	"h\fqs$\"\245\240\272\n\223Fdr\005Z\213\307\023\210E\245\364H"
+	.ascii	"D\022X\341\204\021\036V\365()\\?0D\032E\250I\244\b\036b\b\245"
+	.ascii	"\360\002*\021\231\224,\n\177\324\240:L.!G\254KJ\307\242\316z"
+	.ascii	"$\"\017GdR\022rX\302*\203%\224H7HVi\225\350\212A%\"\223n\326"
+	.ascii	"#\021)\025\223\253\222\250\032= \213I\244\0219<\225A\245\n\244"
+	.ascii	"L\"\215H\021Faq\250*)uN(!E`\3100\301z$\"\013\224\r \252F\022"
+	.ascii	"\302\243\312\243\f\362$\227V\241jt\301\t%\244\b\037%\220\005"
+	.ascii	"'\224\220\"z0dX\221\210\216\204+(\207\2472\250s\341*$\256\252"
+	.ascii	"r\007I)4\032\005\325UhTJRW\250\340\204\022R\004\317z$\"\342\260"
+	.ascii	"\204\206"
+	.string	"\022Z\231\023D\252\304b\211\034\024\031D\322>\353\221\210\224\226\220\311\243\2400)T\362\300\301\360\270\324\200UU\252*\034)\341\034\215\356\251\f\036)\345\254\301\343\221\322y<R\302j\013EeV*\325$\221(LO(!\2079\271*a\242\232\022U\345RV\246O\006\217\224\210tN$We\361HU!8,\361\243$\252\311\244j\244&SX\325#\r\312\236\017(\205(,`U\217z\214\306\020>I\241j\024\261c4\206\340Y\325\021FF\024H\252J\252J\"G=:\n\221\206='\214\212+r\002\304c\210\022B\345\217p\025\232@,\032\205\026P\036\213\302\365\210\024\221\\R\036\325\013\324\265\230d\001\007\005\n\250\220\002\003\030@\024\252\311\033%\216\022\305\220\341\203\bD\017\020\261\302\005F\210\260\351\361q\200\211b\003\210\307\020\352*$\026\215\302\022A\031\250\253pGU\252\311\034\f("
+	.string	"\031\221\311\365\210\024\001"
+	.string	"\021\253z\244\341\250&\223KC\237\023\302d2\204\222\202\237\353\200@\264&\205JD)\254\2522\303\207\305\244zT\217\364G \300\007\004"
+	.string	"a\"=\210\003\200p"
+	.ascii	"\020\320\2038\300\207\017\007 \300\007}\002|\300\353\272\256"
+	.ascii	"\253\032T\211H\024\324\344\222\261(4\322Y\203!\210\360\263&\325"
+	.ascii	"u(L\n\221\206\301\025\211$\241&{v\326#\021y@\026O$W5I5\252+\005"
+	.ascii	"\030>\240\024\242p\\2\312Q\203'\254Id\n\023$\325\242Qq=\252\304"
+	.ascii	"\342\215\2222I\251t\344\263\n\223\304%!\211\240\t$\211\017\f"
+	.ascii	"\205F\022\023(\327$R\t\247\005\244\240QXL\252J\240\021\033\326"
+	.ascii	"\365HDJ\017\025\2549\252q)\231\225A\245j\\R!G5.\251\200,\221"
+	.ascii	"T\225;z\315A\341T\006\323\365\270\204\024q\203,\221TG\250\312"
+	.ascii	"%\255\243\022\221(\330\020UeR-\241&\203\312 \013\302\023?\304"
+	.ascii	"\242\022\216R\251\016\221I\245 \261\250\344s$\"d\362\304\321"
+	.ascii	"\006d\362\304Q\316M\222D\321(\024\261\036\325$\265\004\022\005"
+	.ascii	"\r\222\220G\225\030\034\036O(\215\224\214ZU:\261b\350QW!Qi)\230"
+	.ascii	"T\026y\214H\344\002\202g\013H\037\bA\204\240\252\\\332Q\225K"
+	.ascii	"A\344\212sD\026\225KF=\037>\204\020l\001)C\b\301\325\b\251\f"
+	.ascii	"\"\223'\216\202X@\022\217E\026z\224\037\020\252J\307\023D\236"
+	.ascii	"#\021\251I\344084\3620\024\261!xD\026\327\241"
+	.ascii	"\232L\"\207A\r@\303\241\360F\r\356\034\217\212Fap8\024\332\250"
+	.ascii	"I!\013\304\244\020)8\034\ns\3265h\244\0225\034\211\350\002\026"
+	.ascii	"\204'\260\262\002\345\260\230$<\2360\001\b\231T50\034\n\323\325"
+	.ascii	"H%\006W\n\216DtD\026\205\036\224I\244\362\250*7@\032\256E\245"
+	.ascii	"Si4\"\223Y\251.\031\205%\320\245 \322p-\246@<\2060\032\221\311"
+	.ascii	"\237\224\005a\022+\223\212\311\025\222\352\252&!\205\030\216"
+	.ascii	"D\224TM\024\2236\350\254G\"Z\227\224\326%d0\211\005%\017\312"
+	.ascii	"\244Z\242\230$j\260\006S\345\221p\005d\021-\241\232\240\256B"
+	.ascii	"\025r\214\310!rE&S\3509\"\213\312\244Z\342xB\022\013)$\221+2"
+	.ascii	"\311'\211\205\024\210\352\360xBy\254\200\252\\\332)\241\022\261"
+	.ascii	"\272d\024Z`U\225FF\024P\215\304\023\214\302\265xT$Np,&\341\254"
+	.ascii	"&\204I8\304\2430)\t9<\026\223nVU\005$\2450)\202XT\302\260\243"
+	.ascii	"\f\346\254G\"\"\026\225<\254HGEc\220\tV\031\004A,*\241)\330\023"
+	.ascii	",\261\250\204U\245\023k0\251\256\306\242\221ON\013HA#%c\220\005"
+	.ascii	"\341\211\233\026\220v\214\214\220\353\3220\2104\\\221\307 \206"
+	.ascii	"\365\250\016\223j\n\353\261\210LAi\211x,^\200\002\034\026\204"
+	.ascii	"\031HZ\032A,*\355\254\307%\3440\250\036\t\223j\ta\360\210,\256"
+	.ascii	"B\345QUJB\212 \026SX\205$J\374\034\213(\254!\210E\245\036\325"
+	.ascii	"xt\f\301sb-\226(\256E\345Q\035aTK\250\306\236u\250\032\031\375"
+	.ascii	"\254IU\311\204\032\\\215\3055xD\266PL\"\221\202V"
+	.string	"P\215\353\212L\"\2550\301\261(t@\022\271\n\223jRR]\213\031\220\305U\250\202\t\241QUA\211aE:*\252\027X\217E\244\322\252\216HJ\252+\361G\005\026\204'|\326bRQ\002Fu8\f\241\256\302\344\016\221hD\")\325$\322z\324\263\006\t\360a=\026\227\264\232T\\oT\343\321Q\230A]\205\311\340\211\244Z\0029T\223A$\24509\3749\022\005G*\251I\017+\022\231\364\200\243\f\212HRW\345\t\345\216\t\225x<\201XT\342Q\215E#d2\005u\025\252\240\226(\256C\241\217JD&\005\217\226H\250\304\2335\bb=\026\227\322\217\020\202\001@\220\240\022U\"\f7\200\001DhP\201\t8@\017\211\216\212FG\344\320\303\320\310\303\261(L\3620L*=\020M\240\034\026Weq\025\256\312\340\007\224\302\225')D\032f5Ix\314\377\323\276,6\374\316"
+	.ascii	"\336\354\301\313\227\224/\375\2226mU\325\230\016\360\220\254"
+	.ascii	"X\003\330L\305\234\225\2710\226\212I\303\240]\231\251\311g8w"
+	.ascii	"U_SR0V\212\215\220:\"^n\276P\224\376S/sZ\306\227\024\0367{@\261"
+	.ascii	"%\335\333\222\352\225\t\221\275y\271\342\362T/\315\273P\274\002"
+	.ascii	"\365\322\274\264\313\215\013\275%RN/4.\232\374\351?\325\222\356"
+	.ascii	"8\275\334\221\r\301\363Z@\237\224\216\245\02151.i\226\224\005"
+	.ascii	"\023@\346\325\315\313\262\275\227;h\330\217\024pX\262\333)\247"
+	.ascii	"e\305\254.\263\005\306\370\003s3\bSr)\235\\z\305G\232F"
+	.string	"j\215_:\367\364\312\245@}\361\273\2739\265\242\321\260)\321rsZ\345R\322\271:\256\033\034\336\364o\231\177\222N9\373\332{\367\344\354\3719Y\273\371\034\332\364\237JI\257\262\244\351\272\213\222b\241.\276x\231\022w^\245}1\243\006Jj#OK\207\324\315\347\023?%\200og\223\034\027\272/K3'!s\3145T\276\312\2348a\342}\ts3\021\225\266\264I[\352f\303\264\267\2317\2674\306\034\331\262\314\315\347\220D\023\271\245j)\233Z\272v\fM{;\355m\003\211\007J\210\020\t\003\334X/\204\326\322\252\025\266\302\340\274\322%<F\250rT\271\371\034\262t\232\206\353\320(B\342^\310j9mQ\320P\241\241{\247\0247\246\2563\354\"'y\242Fo\331\307\323\206\367f\246\0045\023\007\303\354\346[fj\226\3672\233\214.\256$9n\007\320\312\026\025e(\227\0335A\352"
+	.string	"\311r\032N\237\226&\261\233\2279TT>\264\220\234Y\356\\^\030\024b\350\346\221\223\3329\216\234\177:bP\266h\t\313hv\313T\233\0230\026bR\330\3103\202\006Y\321d\312\205\"(\327\0235f\332n\026jJ\207\244Cr\234\2065Rgf"
+	.ascii	"\35683`\264\220\013!B\372l\276\376jL\335\374\016\344\264P\026"
+	.ascii	"\020 %\244\372\240\210\245a\351\300r\363;H\323BL|\370\310{AZ"
+	.ascii	"Ldp\304\244\302\020\001\254\353\302\243\311\315\357\300\210\026"
+	.ascii	"*\353\352J\2752\370I\365A\241\"c-\206O\250\363ATZL\252\305 \214"
+	.ascii	"S\2141\303\030\3154i1c\025@0pP$\224J\313\346\036\023\300\203"
+	.ascii	"\314\313\324a \007!T2\"\"\222$)dg3\274)\340\254\213\312\230J"
+	.ascii	"e\277Y,\n\b)\b>\341\037\211.\033\221\3034\200F\345\367\004\230"
+	.ascii	"6Cce\202\371\270p\247\024h(\016\215\333\030|L+!\037\204"
+	.string	"acsH\353/Z0\323\315\275\307\270D\257\330\367HDU\356li\006\310/\223\213\212~j\352\310f5dH*\216\255\201@\370\353!83@T\315\327\026\225\305\231\204\307\274K|\203\373kt\375\264\2226WH\255\353\215\252w\005\355\240\217\3554*\254@M\212\373-C:\367kF=O\275\3759F\224\037\305\247\206\341\260\002\216]k\036\2371\340(\003d\317<H\276\031C;EPF\336\271\314|1u#\270\350\215\262)\313'-\255\321\207\217\375\n\365\255\3030\177\325\001\013Is\017=\037O\352\217\355\342\"\217(@\250\360o\326\260\227S7\221/PQm\334\272\264i\376A\022\035X\357\366\r@D\225k\262^qFRd\033\204\310%\2530\330\376\177\305DF2:PbVT/\344\320/\206\333\275\016\223\201J3\237\365z\022.\304)D@\226\322M\326^\227A\202\311B\244\202"
+	.string	"\211\360\274\006\\\003g%\356>iJ\317\326\307\035\266\224\f\307F|\205\227\276\324\034u"
+	.ascii	"\237h\236\242\220\315d\"\314\022/\024\351\332\031\\\203\370`"
+	.ascii	"QV\205/&3\f\2716`x\245\271\027,\215Z\377j\313\276\004@\022\205"
+	.ascii	"\266;\254\306\311\025\204\f\335Q\372?N[\335\367\307\316\235A"
+	.ascii	"e%#\334\022\306\017\301*|@t!\373\246\244z+1Q(%\204\016Y\235\206"
+	.ascii	"\327n_\333s/$\225\207j\361\222\312\027CoS9<@b\362\364\3602F\204"
+	.ascii	"\001.Yw\270\361\220=#Q\200\022\224\005=>\244^u\201\002.\006,"
+	.ascii	"\3607z\003\213\377R%\224\310c\222\255\003\216\240|u\321oR\032"
+	.ascii	"\216\001\361\031\241\322\347~v.b~k4\221\013\263\347\266\b\024"
+	.ascii	"r\365\256\364\301\260\220\345S\252\244\262\201ed\205_\027\216"
+	.ascii	"\220\3533{\025Z\333BU*D\337\177\271x\213\037w\235\201!\360\331"
+	.ascii	"\2366%\354\237\365Q\234\207\337\273\354\334\022\ry v\310\200"
+	.ascii	"H[\254\204\324B4\257am\310b\273\\\372\327\230ZK&w#/\232\034E"
+	.ascii	"\360>\343g+T\016\267\220\310J\321X\321\332\352\230\002\346\006"
+	.ascii	"\314\027\\.Ge\242\021M"
+	.string	"5\337"
+	.string	"\005g\240J;*\036\327\267\0040\360\007\220\265\340s\224i{\226.\207o\006\330[\034\3406\006\204\350\2717!G\t\206K3r\252\225N\360`2tGz+\036\230\231"
+	.string	"\315|\336T5l\337.\302\203\242\301\240\256\004\351\265\251\345OR^V"
+	.string	"\204\006\272\006\005\261\262\325\271\002\r\277\200S\373@b\335\020\242\037\257\203r\337#\263%\371\236\327?l\332Gb\024\306\n\"q~#0\214>L\377\226$\342\324\333\274I\311\274\033\300>\256o\210\270\206@\036\323\247\030\327\351@\241\255EI\320w\200v\337\021 \220\374\355Ujv \330\204\304]?J\036 \003\260}\324\217\253\342%\321[w\253\321k\254\035\0025\024\222\367\374\241\024I(\255\325\255h\273\371\273\"\375A\261\363\344\322\202y\034\377\240\313\234^\340\244W\263*V\315q-x\344@:|\314n\242\241k\311\356\200\374"
+	.ascii	"\020"
+	.string	"\326\2113k\231!`\260\355d\360\253;e\252s\207\274,W\202\3100u2\311\314\274\340*\277ib\023#}\277\0164\3343b\241.\265P\203\342\307\356c\311\324\306aL\227c\347p-\366\355\326\306=\006\242LN\212\023sQ\234g\267A\307k4\027\240\202\013\306l4.U\264Bk\350\037\253\305\f\026\367\367<,\256Z\211UI\3711\341r\230I\330\313\031\327V\363\\\362\246\026y \f\237\251\343,Z\260'\274\256\304-N\220)\310u\324\b\233V\210\232\220\036\364\246P\034\b\263\366\314\001\"\253n\251\244=q\222c\375\210L\026B\217\234\351\306H\005\335\021\247\262\2105\025\227\003\r\324\215x\177iC\271\033Y\027\341\307Q4\364\223\025\310F\230<\036\306\242\2477vQey(2\224\223n\217V\231\204\020\004\333b\"F\033\2200\003L\204\327\213\223\013\037*KG!%w\202v\306R"
+	.string	"\253z\032\002X\265p\274U\336\227\227\323\257\031\r\333\224a\217\246h\022`\305\032j\022`]8\253\363m\367\211\332\220\321U\376|l\002\251}\234){\342\263f\303\300\b((+\271\316Zk\020\254\034\230\360\331\240\202$k\263 ~\254\314\373\263\025\376\330(QO\022\233\301}\315\344\217\365\321V\342\025\315+\263\206\363\355\002c\355\327\355\007\n:\224~w\235\251\224\362G!.0\201\013{=`q\353$$~F\376\346\214\244\364\204\3512\205\304(\020koz\252T\233\304k\002\n\037\223\244e\252vh\325"
+	.string	"H\r\306\202\374\376\002\210\244\367\256=\254uO\273\350\bb\300\346Kh\366\323s\027*d\2038\254~\201\270\340\335\265u\344\242\217\243,w\320fH)&\342\214)CG\301M]\030^\272Y\264\"tNha\353\206[!\253\021\347\307{\025\242Xk3\374\243\356\267\013\031\031\320"
+	.string	"u\211\310-\333\0041\003\301\004g\214\\\237\247&\315Dy\341=}\335\025\243\331$n\317\013E'\001\276\364yVl\351\367\017\021\024l\222/\225\336\365\370\344\326\232\245K\252B\245\0364\321D\365\267M\235\236\202[2\311A`\205\350\352\305n\355\205\005\235\311\220q\203>\327_\030\345\265\031:Au\214\277\232#\200\341\301E\374\220\0014\371\335\026\306\302~\212\377\030=}\375\312\001\347>l\320'\374\311\007\215\341\304}h\342\345\254\207\201|S\271\350*\202qu\317\300\032E\221\365U\307\244\315\f\300\203f\322\317Uy\272\226\357\224Pf]N=\004\n\215z\324\326"
+	.string	"*\274\301t\342Az\261\326u\340q[gL\254ha\375\206\205\265\032\216\037=\304\026\233\354\253\343\334\261a}\311\2430\332H\245M\027]\312\016\035V\241\331\230\344N\267(x\372"
+	.string	"2\252+}\363v]V\320_L\202\342}\330\356S\250\322\254\324\005\305P}\222?\307b\007\201\227\304+e\331\270\305\221[\311U\323\247>\303\303\315\325\350.n\031\356\200\020\224T7\201\362\n\b\212+\322\373\205A \233K\327\334c\231\376'mE1\215O\210\263\0200\252)\\?8\320\016X+\372\303\205x9\377\232]\r9c\366G{\311\027\013\022,\023\006}\203\211]\254\017!F\2323j/V\177\276If\302\326\321\330c)lD\300\362`j\210\201\253\003D\2727\370\214\360"
+	.string	"\215W\333\311\033\3509L\023[{\235$8\231\334f\357\036\360\b\367[s9`e\205)>\310\347\257\353"
+	.string	"R\240p\340\244\254\365\021pe\224P\005Qq\311\226\007\266!\274\306\375\242\r^f4c:%J\364T\331\361\362PU\351\303\203\321\003\301s5\220\362n\254\004\256\n\240dO\264J~9\201b\204.\352JGf\td\220\351\234P\271\253B\364V\2278\236\233\236\363\016\373\2608\003\356\215Rm\025q\263z\363\315\341\255\204\302\277\233\237\361c\270\345\303\2078\270\n\001!L\247\314\375\2571Z\277y\007\027\030\204\271p\226{GC9\276\n\302]e\3675d\270\242\316+gR*\232s\216\331\225}\2323\273"
+	.string	"O\360\321\341\030/\307\222\334\315\343\235hJ\"\225\224\212 \360M\025)\226C\334\231-R\224\333\350\314\232\337\f\031\234Y\373\241\327\217j\330\3557RqfU\013\026\006\347\305\026\306\311:-^\357\263X\260\370U\255$\241#}\\\3015\346\204)\255\035\212vq\346\315\356\240{\275\240Pq\352I\271\246\263s#\3166\327\306M\231+K>\256\374p4S1\315 L,\311z]\027\031>\270\206\221f^{\033\324\274\2438\252z\035\031\235\275^\037\206\354B\032\357\215\355=9P\274s>\217\332gt\024/d\201\372\220\340\256\307\n\205\201\347\334\200\n\255H\250\304E\2501\271\375\252\214\245l\b\353\034\204r\225W\005\302u\344u\322\314C\007K\212%6\214Wf\rf\020\341\t\t\351\212\023(\205`\237\032\203G\253\016o\254\337\337"
+	.ascii	"\bd\036\246S\021\301P\274\364\245\0357j\310d\023\214\242\030"
+	.ascii	"\320\220\271N\344\210\270\322\242W\177\324B\202\034\006\nuFG"
+	.ascii	"\227E\333bd\374Rl/\313O\375\bBL\256X\331(\276\321zS\226\356D"
+	.ascii	"\304\020@|\260GA[\351\323\310\365\337(D\256\365\206\243X\230"
+	.ascii	"\302\005\r\363\217\200B\233\t`_\234\001\b\2054\234\302\177\\"
+	.ascii	"\377\260\bJ`\276\323?tL\337\033$_VW%A\013L\222d\177e\027\356"
+	.ascii	"\335j9\251$\256qXz\351\321\352\324\266\352\231\356T\347\217\247"
+	.ascii	"\205\367k\361>aO\252\332\224r\272z#\\R\357h?\321\247K\03194_"
+	.ascii	"\322[\302\372\003\034W>\365\376\033\215\337\223\3018H\204#3\263"
+	.ascii	"\244\363\350\302\264_8\217\257\347l\235\267|\371\257H\0068\t"
+	.ascii	"\331\332\254\270\001\251\24685\220\276\260:\315\376\251\353\307"
+	.ascii	"\271\177\261\374\206\254\306\026\212\326\034\375\221^+\375v["
+	.ascii	"p\332\262t\246\236\322/\024\205\2629\204\340f\256\257\351r\373"
+	.ascii	"C\265\2415c\003J@\332\266\263W\207D\246\214\370\247e\236[l\016"
+	.ascii	"\264\350B^*\032\355\203`'\377\025\311\261E\355\370i\002#\253"
+	.ascii	"o\244zN\340\205\376\311\3555\001\343\354\336\352\350K\363#2:"
+	.ascii	"|]\303\232\304R\2165D\373\222\357\253\202\026\241\024F\002\362"
+	.ascii	"\023\304\323\001wCB\244\322?3\016\313\f%\313\324\324\372D\310"
+	.ascii	"\344\305\362Q\315\367\023\r\361\022U\317\336\343(h\037"
+	.string	"\257\260X\361U\t.\204\2246(xAF\020\366p\264\330\226P\337"
+	.string	"^\007g\034\234G\311\376\365\036'\354\226u\321\214\0050g~@\247\373a\364\240\215\235\304&\001C\362\026\350\365G\302b\313=\310\214\251\016ypV4\265a\255\272\217\024\034#\336\344Ks\206\261\036\300\2041\221u\3365(\226T\021\001\257\263\340w \320\341\267V\376Y\334a\314T\255v\310\317F\233\334\323\242\007S\217&[\3421w?\350\317\350P\211\n\273\216\f\332\255n\203oD\233#a@u\371\b\355\025\241\3651\221+-#}\003|\275Cy\215\230\312n\211J\257\216\241\335\250l\371Q\342\252\321\004"
+	.ascii	"mg\342H}\264_\236\253\315\270\351\342\314\306)\017\315\314\363"
+	.ascii	"\343~\013\221;x\330p\025\322\372\205\323\r\300g\336Q\327]P\235"
+	.ascii	"\231\271\313\364\314\363\303\202.0\365\373\271\341\bY\\\222\206"
+	.ascii	"\242\033\353\242O\rH\007\006\272h\320\367J\365E<{\273\032\032"
+	.ascii	"\027g,#\013`u\370\252\343_\216`F/\247\347\346\313\320S\\:\336"
+	.ascii	"\035F\003\355B\007\206@\372\f\271 \021\227\007\027\357\024\r"
+	.ascii	"/\317\034\357\004\373\335\245ik\301\201|\331\277q\337\b\233'"
+	.ascii	"5\344\306s\334\366\310\277\213\r\352\262\356?\202\277\232c\016"
+	.ascii	"\005\247\017\243\212\273\363\3632m\227\243\177e\325\031\246,"
+	.ascii	"\033\301\367\216w\357\275\246\345\310c\377\301R\334uw\246\364"
+	.ascii	"_D\0377q\222O\273\037\204+d\221#\361\271\354}\030jmyj\3046\337"
+	.ascii	"gc\034p\374\240\365\371\210\301\303\352\233\254\271\310\377="
+	.ascii	"8w\210a\022\376;}u\302vk\270>)\342Q\027_?\"\177g\200\241\335"
+	.ascii	"\221\364\227!\254\023z7\334\0272\301\031*nr\301\257s\331Fdr\361"
+	.ascii	"\260\256N\314\310xV\230W\341`i![\2140\026\346q\305`\256\347="
+	.ascii	"\323\205\333xs\264\247\261\254\3601O\333\374K\3433Q\354\205\213"
+	.ascii	"Y5\036-\223\333x\207\352\366(\257\001~\251{\250\304\022\254\037"
+	.ascii	"\025_\213\017\016{\344\304\213\274\274\200\367\f\377\332I\007"
+	.ascii	"i\f\023\375\205\256#\362\216\270}/=\026\273t0\b\325\360\334\374"
+	.ascii	"\327\322\213\207$\022\374u\366\354j{\356\215\265\0227\b\346u"
+	.ascii	"\211\035\260\213q\277S\212k\320\243?E\372\006P\260+"
+	.text
+	.section	.gnu.lto_.symtab.c7c0bf2bd364e706,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"activateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"validateAndFixConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"beeperOffSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"beeperOffSetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"beeperOffClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"beeperOffClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"setBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"getPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"setPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"pgResetTemplate_flashConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"flashConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"flashConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"flashConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"setAccelerationFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"gpsUsePIDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c7c0bf2bd364e706,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10123 @@
+	.file	"controlrate_profile.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/fc/controlrate_profile.h"
+	.file 9 "./src/main/fc/controlrate_profile.c"
+	.file 10 "./src/main/target/SITL/target.h"
+	.file 11 "./src/main/fc/fc_rc.h"
+	.file 12 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	controlrate_profile.c.3d05ae32
+	.weak	controlrate_profile.c.3d05ae32
+controlrate_profile.c.3d05ae32:
+	.long	0x533
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF1565
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1455
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1456
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1457
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1458
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1459
+	.uleb128 0x3
+	.long	.LASF1461
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1460
+	.uleb128 0x3
+	.long	.LASF1462
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1463
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1464
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1465
+	.uleb128 0x3
+	.long	.LASF1466
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1467
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF1468
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x3
+	.long	.LASF1469
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x17
+	.long	.LASF1566
+	.byte	0xa
+	.byte	0xa1
+	.byte	0xa
+	.long	0x9f
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1470
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1471
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x5
+	.byte	0x1d
+	.long	0xef
+	.uleb128 0x1
+	.long	.LASF1472
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1474
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1475
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x93
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x122
+	.uleb128 0x9
+	.long	.LASF1476
+	.value	0xfff
+	.uleb128 0x9
+	.long	.LASF1477
+	.value	0xf000
+	.uleb128 0x9
+	.long	.LASF1478
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1479
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1480
+	.byte	0x4
+	.byte	0x29
+	.byte	0xf
+	.long	0x12e
+	.uleb128 0x18
+	.long	0x13e
+	.uleb128 0x6
+	.long	0x7e
+	.uleb128 0x6
+	.long	0x64
+	.byte	0
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x5
+	.long	0x15d
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x10
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x15d
+	.byte	0
+	.uleb128 0x5
+	.long	0x122
+	.uleb128 0xa
+	.long	.LASF1534
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2b
+	.long	0x1bb
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1481
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0x93
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1482
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1bb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1483
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1bb
+	.byte	0x10
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x1c0
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1484
+	.byte	0x4
+	.byte	0x34
+	.byte	0x7
+	.long	0x13e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x87
+	.uleb128 0x5
+	.long	0x1bb
+	.uleb128 0x3
+	.long	.LASF1485
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x162
+	.uleb128 0x12
+	.long	0x1c5
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1486
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x303
+	.uleb128 0x1
+	.long	.LASF1487
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1488
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1489
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1490
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1505
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x308
+	.uleb128 0x1a
+	.uleb128 0xa
+	.long	.LASF1535
+	.byte	0x15
+	.byte	0x7
+	.byte	0x46
+	.long	0x357
+	.uleb128 0x2
+	.long	.LASF1536
+	.byte	0x7
+	.byte	0x47
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1537
+	.byte	0x7
+	.byte	0x48
+	.byte	0xd
+	.long	0x87
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x7
+	.byte	0x49
+	.byte	0xd
+	.long	0x87
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1539
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xd
+	.long	0x87
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1540
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xa
+	.long	0x357
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x80
+	.long	0x367
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1541
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x3
+	.long	0x309
+	.uleb128 0x7
+	.long	.LASF1553
+	.byte	0x7
+	.byte	0x59
+	.byte	0x17
+	.long	0x367
+	.uleb128 0xa
+	.long	.LASF1542
+	.byte	0xc
+	.byte	0x8
+	.byte	0x19
+	.long	0x401
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x8
+	.byte	0x1b
+	.byte	0xd
+	.long	0x87
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1545
+	.byte	0x8
+	.byte	0x1c
+	.byte	0xd
+	.long	0x87
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xd
+	.long	0x87
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1547
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xd
+	.long	0x87
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1548
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xd
+	.long	0x401
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1549
+	.byte	0x8
+	.byte	0x20
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1550
+	.byte	0x8
+	.byte	0x21
+	.byte	0xd
+	.long	0x87
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1551
+	.byte	0x8
+	.byte	0x22
+	.byte	0xe
+	.long	0x93
+	.byte	0xa
+	.byte	0
+	.uleb128 0xb
+	.long	0x87
+	.long	0x411
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1552
+	.byte	0x8
+	.byte	0x23
+	.byte	0x3
+	.long	0x37f
+	.uleb128 0x12
+	.long	0x411
+	.uleb128 0xb
+	.long	0x411
+	.long	0x432
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1554
+	.byte	0x8
+	.byte	0x26
+	.byte	0x1c
+	.long	0x422
+	.uleb128 0x7
+	.long	.LASF1555
+	.byte	0x8
+	.byte	0x26
+	.byte	0x5b
+	.long	0x422
+	.uleb128 0x7
+	.long	.LASF1556
+	.byte	0x8
+	.byte	0x28
+	.byte	0x1d
+	.long	0x456
+	.uleb128 0x5
+	.long	0x411
+	.uleb128 0xd
+	.long	0x44a
+	.byte	0x22
+	.byte	0x16
+	.uleb128 0xd
+	.long	0x432
+	.byte	0x25
+	.byte	0x57
+	.uleb128 0xd
+	.long	0x43e
+	.byte	0x25
+	.byte	0x8f
+	.uleb128 0x7
+	.long	.LASF1557
+	.byte	0x9
+	.byte	0x25
+	.byte	0xcb
+	.long	0x1d1
+	.uleb128 0x1b
+	.long	0x470
+	.byte	0xfc
+	.uleb128 0x1c
+	.long	.LASF1567
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1568
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.long	0x7e
+	.long	0x4aa
+	.uleb128 0x6
+	.long	0x7e
+	.uleb128 0x6
+	.long	0x303
+	.uleb128 0x6
+	.long	0xab
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1558
+	.byte	0x42
+	.long	0x4c0
+	.uleb128 0xf
+	.long	.LASF1560
+	.byte	0x42
+	.byte	0x27
+	.long	0x87
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1559
+	.byte	0x3a
+	.long	0x4d6
+	.uleb128 0xf
+	.long	.LASF1560
+	.byte	0x3a
+	.byte	0x24
+	.long	0x87
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1561
+	.byte	0x27
+	.long	0x506
+	.uleb128 0xf
+	.long	.LASF1562
+	.byte	0x27
+	.byte	0x39
+	.long	0x456
+	.uleb128 0x13
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0x9
+	.byte	0x29
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x13
+	.uleb128 0x1f
+	.long	.LASF1563
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x30
+	.long	0x41d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1569
+	.byte	0x8
+	.byte	0x26
+	.value	0x11e
+	.long	0x456
+	.long	0x525
+	.uleb128 0x21
+	.long	.LASF1564
+	.byte	0x8
+	.byte	0x26
+	.value	0x13d
+	.long	0x64
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1570
+	.byte	0x7
+	.byte	0x59
+	.byte	0xcb
+	.long	0x531
+	.uleb128 0x5
+	.long	0x367
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 33 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.file 34 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 35 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 36 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.file 39 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.file 40 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 43 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2c
+	.file 45 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 46 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x2e
+	.file 47 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 48 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1443
+	.byte	0x4
+	.file 49 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x31
+	.file 50 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 51 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 52 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1453
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1454
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF905
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF935
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1062
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1452
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1571
+	.long	.LASF1572
+	.long	.LASF1573
+	.long	.LASF1574
+	.long	.LASF1575
+	.long	.LASF1576
+	.long	.LASF1577
+	.long	.LASF1578
+	.long	.LASF1579
+	.long	.LASF1580
+	.long	.LASF1581
+	.long	.LASF1582
+	.long	.LASF1583
+	.long	.LASF1584
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x35
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1585
+	.byte	0xa
+	.long	.LASF1586
+	.byte	0xa
+	.long	.LASF1587
+	.byte	0xe
+	.long	.LASF1588
+	.byte	0x3
+	.long	.LASF1589
+	.byte	0x2
+	.long	.LASF1590
+	.byte	0x4
+	.long	.LASF1591
+	.byte	0x5
+	.long	.LASF1592
+	.byte	0x5
+	.long	.LASF1593
+	.byte	0x5
+	.long	.LASF1594
+	.byte	0x6
+	.long	.LASF1595
+	.byte	0x5
+	.long	.LASF1596
+	.byte	0xd
+	.long	.LASF1597
+	.byte	0xd
+	.long	.LASF1598
+	.byte	0xe
+	.long	.LASF1599
+	.byte	0xe
+	.long	.LASF1599
+	.byte	0xd
+	.long	.LASF1600
+	.byte	0xa
+	.long	.LASF1601
+	.byte	0xd
+	.long	.LASF1602
+	.byte	0xd
+	.long	.LASF1603
+	.byte	0xa
+	.long	.LASF1604
+	.byte	0xa
+	.long	.LASF1605
+	.byte	0xc
+	.long	.LASF1606
+	.byte	0xa
+	.long	.LASF1607
+	.byte	0xb
+	.long	.LASF1608
+	.byte	0xb
+	.long	.LASF1609
+	.byte	0xa
+	.long	.LASF1610
+	.byte	0xa
+	.long	.LASF1611
+	.byte	0xa
+	.long	.LASF1612
+	.byte	0xa
+	.long	.LASF1613
+	.byte	0x9
+	.long	.LASF1614
+	.byte	0x9
+	.long	.LASF1615
+	.byte	0xd
+	.long	.LASF1616
+	.byte	0x8
+	.long	.LASF1617
+	.byte	0x7
+	.long	.LASF1618
+	.byte	0x7
+	.long	.LASF1619
+	.byte	0x3
+	.long	.LASF1620
+	.byte	0x1
+	.long	.LASF1621
+	.byte	0x3
+	.long	.LASF1622
+	.byte	0x4
+	.long	.LASF1623
+	.byte	0x4
+	.long	.LASF1624
+	.byte	0x4
+	.long	.LASF1625
+	.byte	0x4
+	.long	.LASF1626
+	.byte	0x4
+	.long	.LASF1627
+	.byte	0x4
+	.long	.LASF1628
+	.byte	0x4
+	.long	.LASF1629
+	.byte	0x4
+	.long	.LASF1630
+	.byte	0x2
+	.long	.LASF1631
+	.byte	0x4
+	.long	.LASF1632
+	.byte	0x4
+	.long	.LASF1633
+	.byte	0x4
+	.long	.LASF1634
+	.byte	0x4
+	.long	.LASF1635
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1190:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1264:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1210:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF919:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1081:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1020:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF734:
+	.string	"USE_CLI "
+.LASF1165:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF1181:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF950:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF821:
+	.string	"USE_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1438:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1079:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1337:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF918:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1461:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1486:
+	.string	"_Bool"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1283:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF1043:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1029:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1555:
+	.string	"controlRateProfiles_CopyArray"
+.LASF1495:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1558:
+	.string	"changeControlRateProfile"
+.LASF1243:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1033:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1361:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF933:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1066:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF1430:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1189:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF973:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1402:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1348:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1492:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1118:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1467:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF958:
+	.string	"PG_RX_CONFIG 24"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1267:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1213:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF1452:
+	.string	"BEEP_ON do {} while (0)"
+.LASF928:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1336:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1094:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1063:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF969:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1058:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1552:
+	.string	"controlRateConfig_t"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1089:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1559:
+	.string	"setControlRateProfile"
+.LASF977:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1357:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1429:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1499:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1518:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1097:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1055:
+	.string	"BIT(x) (1 << (x))"
+.LASF1523:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1025:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1256:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF799:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1415:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF1531:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1351:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1068:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1121:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1520:
+	.string	"OWNER_BARO_EXTI"
+.LASF954:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF822:
+	.string	"USE_PWM"
+.LASF1216:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1077:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1054:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1498:
+	.string	"OWNER_SERIAL_TX"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1047:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF974:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF987:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF988:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1478:
+	.string	"PGR_SIZE_MASK"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1144:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF1547:
+	.string	"thrExpo8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1444:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1450:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1331:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1566:
+	.string	"SystemCoreClock"
+.LASF1006:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1533:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF930:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1394:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1096:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1138:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1568:
+	.string	"memcpy"
+.LASF1313:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1237:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1001:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1503:
+	.string	"OWNER_SONAR_ECHO"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1354:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF1300:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1124:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1010:
+	.string	"PG_VTX_CONFIG 515"
+.LASF921:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1491:
+	.string	"OWNER_SERVO"
+.LASF1057:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF793:
+	.string	"ACC "
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF738:
+	.string	"USE_PWM "
+.LASF1384:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF1453:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1111:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF920:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1098:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1462:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1490:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1441:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1517:
+	.string	"OWNER_RX_SPI_CS"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF907:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1451:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1157:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1397:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1139:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF917:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1014:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1042:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1262:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1011:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1208:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF1455:
+	.string	"unsigned char"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1021:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1024:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF922:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1286:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1550:
+	.string	"rcYawExpo8"
+.LASF994:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF777:
+	.string	"USE_NAV "
+.LASF967:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1303:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1249:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF1471:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF945:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF795:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1232:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1168:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1031:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1114:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1026:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF1534:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF912:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1192:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF903:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1446:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1067:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1529:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1379:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1304:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1512:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1400:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1051:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF934:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1562:
+	.string	"controlRateConfig"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1099:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1476:
+	.string	"PGR_PGN_MASK"
+.LASF1196:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"USE_SPI"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1023:
+	.string	"IO_TAG_NONE 0"
+.LASF1551:
+	.string	"tpa_breakpoint"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1420:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1349:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1252:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF972:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1432:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF982:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1082:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1008:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1117:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1378:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1522:
+	.string	"OWNER_USB_DETECT"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1028:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1481:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF992:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF935:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1405:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1052:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1569:
+	.string	"controlRateProfilesMutable"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1083:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1526:
+	.string	"OWNER_INVERTER"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF1469:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1507:
+	.string	"OWNER_SPI_MOSI"
+.LASF1403:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1466:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1049:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF908:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF986:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1104:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1214:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1274:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1426:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF1053:
+	.string	"PP_IIF_1(t,f) t"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1019:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1342:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1255:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1187:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF1280:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF1564:
+	.string	"_index"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF756:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF820:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1069:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF924:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1473:
+	.string	"FD_PITCH"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF911:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF970:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1100:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1186:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1223:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF984:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF960:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF927:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1546:
+	.string	"thrMid8"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1448:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1298:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF1333:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF1315:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1107:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1535:
+	.string	"systemConfig_s"
+.LASF1037:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1103:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1244:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1393:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1109:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF1073:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1396:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1502:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1482:
+	.string	"address"
+.LASF1050:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1372:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1258:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1035:
+	.string	"IOCFG_IPU 0"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF721:
+	.string	"NULL"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF1150:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1544:
+	.string	"rcYawRate8"
+.LASF966:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF719:
+	.string	"__size_t "
+.LASF1504:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1129:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1159:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1561:
+	.string	"pgResetFn_controlRateProfiles"
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1359:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1071:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1487:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1247:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1479:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF942:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1235:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1376:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1180:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"UNIT_TESTED "
+.LASF941:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1301:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1080:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1565:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF925:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1141:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1101:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1226:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1112:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1390:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1540:
+	.string	"name"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1007:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1321:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1207:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1556:
+	.string	"currentControlRateProfile"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF936:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1363:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF902:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF737:
+	.string	"USE_PPM "
+.LASF1132:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1092:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF959:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1234:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"reset"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF943:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1039:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1510:
+	.string	"OWNER_SDCARD"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1421:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF983:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1456:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1459:
+	.string	"signed char"
+.LASF1541:
+	.string	"systemConfig_t"
+.LASF1563:
+	.string	"_reset_template_42"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1113:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"__size_t__ "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1418:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF1364:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF951:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF980:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1292:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1327:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1044:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1345:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF1115:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1538:
+	.string	"debug_mode"
+.LASF1036:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1472:
+	.string	"FD_ROLL"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1324:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1270:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF923:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1156:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF963:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1136:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1524:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1477:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1385:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF968:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1002:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1087:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1102:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF1060:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF965:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1288:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1093:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1116:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1291:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1483:
+	.string	"copy"
+.LASF776:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1229:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1074:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF962:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1367:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1474:
+	.string	"FD_YAW"
+.LASF1464:
+	.string	"long int"
+.LASF1199:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1085:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1500:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1408:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1178:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1013:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1135:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1273:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF946:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1219:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1105:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1048:
+	.string	"EXPAND_I(x) x"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1468:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1560:
+	.string	"controlRateProfileIndex"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1282:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1536:
+	.string	"pidProfileIndex"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF981:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF999:
+	.string	"PG_PID_CONFIG 504"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1352:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1542:
+	.string	"controlRateConfig_s"
+.LASF491:
+	.string	"__flexarr []"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF916:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF978:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF938:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1009:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"OWNER_TIMER"
+.LASF1162:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF979:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1340:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1370:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1316:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1202:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1375:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1465:
+	.string	"char"
+.LASF1545:
+	.string	"rcExpo8"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF1297:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1032:
+	.string	"IOCFG_AF_PP 0"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1127:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF806:
+	.string	"USE_UART2 "
+.LASF1548:
+	.string	"rates"
+.LASF932:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1110:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1022:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1246:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1485:
+	.string	"pgRegistry_t"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF1276:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1041:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1222:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1184:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"__need_NULL "
+.LASF904:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1454:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF971:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1513:
+	.string	"OWNER_FLASH_CS"
+.LASF1553:
+	.string	"systemConfig_System"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1046:
+	.string	"STR_HELPER(x) #x"
+.LASF1228:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF976:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1505:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1306:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1497:
+	.string	"OWNER_ADC_RSSI"
+.LASF913:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1339:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1238:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1277:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF1554:
+	.string	"controlRateProfiles_SystemArray"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1319:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1205:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1151:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1148:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1183:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1436:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1130:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1225:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1171:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF989:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF929:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF991:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1153:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1000:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1330:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1470:
+	.string	"double"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1508:
+	.string	"OWNER_I2C_SCL"
+.LASF1506:
+	.string	"OWNER_SPI_MISO"
+.LASF1091:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1530:
+	.string	"OWNER_COMPASS_CS"
+.LASF1059:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1241:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF397:
+	.string	"true 1"
+.LASF939:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1016:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1509:
+	.string	"OWNER_I2C_SDA"
+.LASF1463:
+	.string	"__uint32_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF906:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1343:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF956:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1549:
+	.string	"dynThrPID"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1388:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1147:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1423:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF964:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1034:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1322:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1539:
+	.string	"task_statistics"
+.LASF910:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1268:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1154:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF1353:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1334:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF1072:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1090:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1439:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1440:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1309:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1424:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1294:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1172:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1525:
+	.string	"OWNER_RX_BIND"
+.LASF990:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF1328:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"OWNER_TRANSPONDER"
+.LASF957:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF909:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF1174:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1120:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1240:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1253:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1095:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1056:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF993:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1567:
+	.string	"generateThrottleCurve"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1557:
+	.string	"controlRateProfiles_Registry"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1515:
+	.string	"OWNER_MPU_CS"
+.LASF1475:
+	.string	"pgn_t"
+.LASF1004:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1387:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF846:
+	.string	"USE_I2C"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF797:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1325:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1061:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF953:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1406:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1015:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1445:
+	.string	"I2CDEV_COUNT 4"
+.LASF940:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1062:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1271:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1217:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF997:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1494:
+	.string	"OWNER_ADC_BATT"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1231:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF905:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1366:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1142:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1195:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1145:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1543:
+	.string	"rcRate8"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1570:
+	.string	"systemConfigMutable"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1177:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF955:
+	.string	"PG_SERVO_MIXER 21"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1449:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1427:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1289:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1411:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1027:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1030:
+	.string	"IOCFG_OUT_PP 0"
+.LASF944:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1511:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1088:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1086:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1447:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1409:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1295:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1133:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1005:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1532:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1382:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1220:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1106:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"long unsigned int"
+.LASF1064:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1527:
+	.string	"OWNER_LED_STRIP"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1038:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1261:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF948:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF975:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1126:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF926:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1065:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1514:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF995:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1537:
+	.string	"activeRateProfile"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF1457:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF1442:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1435:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1373:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1078:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1003:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1310:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"OWNER_ADC"
+.LASF1460:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1519:
+	.string	"OWNER_MPU_EXTI"
+.LASF1285:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1443:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1412:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF1358:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF949:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1496:
+	.string	"OWNER_ADC_EXT"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF996:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1489:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1516:
+	.string	"OWNER_OSD_CS"
+.LASF1391:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1399:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF931:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1279:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1017:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1075:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1623:
+	.string	"io_types.h"
+.LASF1606:
+	.string	"long-double.h"
+.LASF1614:
+	.string	"__locale_t.h"
+.LASF1616:
+	.string	"platform.h"
+.LASF1574:
+	.string	"src/main/drivers"
+.LASF1625:
+	.string	"rx_pwm.h"
+.LASF1600:
+	.string	"libc-header-start.h"
+.LASF1582:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1615:
+	.string	"strings.h"
+.LASF1572:
+	.string	"src/main/common"
+.LASF1612:
+	.string	"stdint-intn.h"
+.LASF1594:
+	.string	"target.h"
+.LASF1589:
+	.string	"axis.h"
+.LASF1581:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1584:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1607:
+	.string	"stubs.h"
+.LASF1576:
+	.string	"src/main/target/SITL"
+.LASF1633:
+	.string	"rcc_types.h"
+.LASF1604:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1592:
+	.string	"controlrate_profile.h"
+.LASF1580:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1591:
+	.string	"config.h"
+.LASF1632:
+	.string	"bus_i2c.h"
+.LASF1595:
+	.string	"fc_rc.h"
+.LASF1602:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/fc/controlrate_profile.c"
+.LASF1634:
+	.string	"sound_beeper.h"
+.LASF1585:
+	.string	"types.h"
+.LASF1617:
+	.string	"common_fc_pre.h"
+.LASF1598:
+	.string	"stdbool.h"
+.LASF1583:
+	.string	"/usr/include"
+.LASF1571:
+	.string	"src/main/build"
+.LASF1618:
+	.string	"common_fc_post.h"
+.LASF1593:
+	.string	"controlrate_profile.c"
+.LASF1601:
+	.string	"features.h"
+.LASF1609:
+	.string	"typesizes.h"
+.LASF1613:
+	.string	"locale_t.h"
+.LASF1627:
+	.string	"serial.h"
+.LASF1573:
+	.string	"src/main/config"
+.LASF1624:
+	.string	"flash.h"
+.LASF1610:
+	.string	"time64.h"
+.LASF1586:
+	.string	"stdint-uintn.h"
+.LASF1577:
+	.string	"src/main/target"
+.LASF1630:
+	.string	"utils.h"
+.LASF1578:
+	.string	"src/main"
+.LASF1590:
+	.string	"resource.h"
+.LASF1619:
+	.string	"config_reset.h"
+.LASF1611:
+	.string	"wchar.h"
+.LASF1629:
+	.string	"io_def.h"
+.LASF1575:
+	.string	"src/main/fc"
+.LASF1628:
+	.string	"io.h"
+.LASF1579:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1596:
+	.string	"string.h"
+.LASF1605:
+	.string	"cdefs.h"
+.LASF1626:
+	.string	"sdcard.h"
+.LASF1599:
+	.string	"stdint.h"
+.LASF1620:
+	.string	"build_config.h"
+.LASF1587:
+	.string	"stddef.h"
+.LASF1608:
+	.string	"stubs-64.h"
+.LASF1603:
+	.string	"wordsize.h"
+.LASF1631:
+	.string	"io_def_generated.h"
+.LASF1635:
+	.string	"vcd.h"
+.LASF1622:
+	.string	"adc.h"
+.LASF1588:
+	.string	"parameter_group.h"
+.LASF1597:
+	.string	"stdc-predef.h"
+.LASF1621:
+	.string	"parameter_group_ids.h"
+	.text
+	.section	.gnu.lto_.profile.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 W=\002"
+	.string	"\244\003K"
+	.string	"\t"
+	.string	"\354\271\370\203\t"
+	.string	"\001\274\200\265\260\006\002\276\230\226\205\004\004\002"
+	.string	"\002\001\002\002\002\002\004\240\342\234\212\n\005\006\304\242\217\252\r\007\330\270\370\330\016\b\t\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"@\030\237U\230r\337\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 3\025\001"
+	.string	"\260'"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\001\006\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"@F\314Kl\026\264\001,"
+	.text
+	.section	.gnu.lto_.inline.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 \304\235\003"
+	.string	"\302\306\023\034\240'\351\017\276x\253\352Y\204\245\242\345\326\354\377\340PUU^\266\227%yo)S\377'SH{\006z\230/\345\324\200k\321\366<qS\030bb\276\002\033m\221\371\373\301B?A\375s\022\330\266\346\017\\\332&\374!\310\321\236\300\323\214\r"
+	.string	"X\215\200\353"
+	.ascii	"\217\247\344\016\221\245\t=\226.\326b)\024\030+\302\355\246b"
+	.ascii	"\n\244\202\331@\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 []\002"
+	.string	"\244\003O"
+	.string	"\003"
+	.string	"\001\001\003\177\002\004\006"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\003\002\005x"
+	.string	"\001\002\006s\001\001\006s\001\177\002\006\333"
+	.string	"\001\f\f"
+	.string	"\002\003\006\001\001\003\177\002\003"
+	.string	""
+	.string	"\005"
+	.ascii	"A\020\024*\030\237\327&\263\340\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\230\004\002\230\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 S\325\001"
+	.string	"\324\002?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\003"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002"
+	.string	"\002\002\007\001"
+	.string	"\002\004"
+	.string	"\001\002\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\0071cO313"
+	.string	"\004"
+	.ascii	"r\376\002\215\003\\\006P\004"
+	.text
+	.section	.gnu.lto_.lto.bf29d835d6243bc9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.31.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\b`"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\375\007us\307\007uq"
+	.string	"\005\001\006'\001$\f?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.32.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375`\377\001%\022"
+	.string	"\326c{G\340\320(\035b\017\353\301`\364\312\032X'\352\032r\005\376\353\320pn\200\307,\037\004\023\220\324\331k\204\177\253\347^p\253u\t\332^{)\214\301\302\220P%$P\224\007\004\247\202\020-R\225++ZK\310\2262\245g"
+	.string	"`"
+	.string	"g"
+	.string	"\317\271\t\331u4\034d\227\006\311\305n\256\304(\246{\316]\344\273g\372\200\357\236e\366\r\002.\037-^zt\354n\250 \254\217\271;\246\354^\324\224\371\245\224\235\203\344\324\210\200p\263{Q\300\356\006\300\271\304\223\204\301\3252\216\210\271\236\347\"6:\" \\\314\263\224\262\273\316\033\316\303\375\335v\3146\313\316\002\001\21783\027\321\001\t\307\346\316\316\315Rk\354\177w\327Jc\203\327\371K\327\335\361i\325tj\372"
+	.string	"0\274\374\210\374\354rH\342\261B\336\213\233\314\353\300#\224\337c\237\300\032(?\347\363\370t\017\264\201\262\355\2378\n\331u\206\0217\005\203\234 \243\335%\271\347\225\351\336H\374\311\006\205PO;\b\036\025\324\333>\3242\351\301\307B\310\224\367\371}\276\002\026\217B\354\332~\363U\034\250B\274\315=g\200}\277\335\363a\337=U\333\302\205\374\315!A26\2359\265\244\252\r\206l%>n\031\3375\3656\022\265Lr\324\253\203\034/=h\231\344\220\240\231\355\271i\b\207\306\346Nuwgj\222_\367\00524\236\255;\001\312*\245\340D\002\212\211\201\t-\026\213Ke\025KA"
+	.ascii	"\261\312d\265\322b\271^-\021V\261\324k\305\365\212\261\270T\241"
+	.ascii	"\212\025\262\264R\024B\325\013\026\232\034\260\253e\365\nc.\327"
+	.ascii	"+<\345\366J\343\357<\336,\222\021Mk\236\326\270\024CA\325\242"
+	.ascii	"$yT\030\333.yT\225\242\r\271c\306L\324\024Z\356\036#\250\327"
+	.ascii	"}\204\226;\007# `\0021\206\363\354\357E\223p\260\030xH\233\340"
+	.ascii	"\005\311\27225NpqAVY6\336\022l\226V5.F\004\2061P\036\2039\bB"
+	.ascii	"\364\242@\306i\241\371\220\270Y\353GI\f\267i\202\227\373\315"
+	.ascii	"+@\263\f\213pC\256\275\315\200\300\224M\027}\002"
+	.text
+	.section	.gnu.lto_setControlRateProfile.33.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375`\373\001\245\021"
+	.string	"\226\337rI\340\360&\035:]\327\304\016!\346\214X\223\217\036\315Gh\210K\230\f\275\221\252 \340\217C4\250*S\373\250\2356c\217\br_\341'\272l)}\310\ru\210\323\221Q<`2\224\253G\207\361eN\336\020\331d\357\224\002X"
+	.string	"["
+	.string	"c"
+	.ascii	"3\033\365z\377G\264Q6\310\320\2039\357c\023\226\370\036\232\351"
+	.ascii	"\256\b\242\243\335\262\304\253\323\253E{\006\001\016\001\230"
+	.ascii	"f\204r\354\256GK\\<G\247\350\177\234\200\214d\3149\020\247\002"
+	.ascii	"H\031.\265\273\367\371\364@\332\346\3748\331]\317\221\374p\327"
+	.ascii	"\333n`\273\306\236\003\0020v6\331\245mR\034\373\334\322\033\233"
+	.ascii	"\233\356\336\363\3239\375S\202\016#/viz\350X\245\212\304\343"
+	.ascii	"\003]h\366\037?\b\002\220\211\335E\275\332\026S2e\201\030G=\007"
+	.ascii	"^\001\204\270\371\345O\314\216\302.\270r\311\020\246\242\231"
+	.ascii	"\026%\257^9\275\246.\322\275r\017\351^}\240\263\311\b\246\032"
+	.ascii	"\345\214\033^t\241\322X@\364\025\257\025\030\254{\355h\005\034"
+	.ascii	"c\315\205Na\004\211\240\037g\311\206F\347\306\351oO\325N9\031"
+	.ascii	"3<vPj\203\037\242\221\344\354\256\002?\305Ud\360w^\355\3622?"
+	.ascii	"\276t\257,\035\233\332\354\341\257i\356n\f\2458\363\264\216R"
+	.ascii	"\013\267$\231\311d\221\245\306\360B\351l\262\372Z,\004)+\025"
+	.ascii	"\211\206/%\346 \302'kI\030\261K\365\261\274T\300\260\005\345"
+	.ascii	"\223\265B\0260\224\305@\227\347R\361b\257\026\314s\205.\236\312"
+	.ascii	"\200\301\226/\364d \030z\250\262vn\351\r\003R\251Fm\\G}\026G"
+	.ascii	"\202\361w\354\372\346\307/i\264\341\337~\237O\340QZ\252Q\013"
+	.ascii	"* 0\002b\030\224;\316\tP\256_\356\227lh\321%\034Mw0l@\253\211"
+	.ascii	"\205\267\373\262\337\270\205\306@\025\225H<\360\204\020 j=\256"
+	.ascii	"a \017\234\226\310\254\225\260\017\3002\246\024\346\356]\264"
+	.ascii	"\303\375\372H\224o[k&rT\324\336g\332<6\220Bh\206l\032\202q\301"
+	.ascii	"!3\341-\203a\261r\333U\364"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.34.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375`?\002m\023"
+	.string	"\206\"}I\300RN:\212\321\330\3764(\265_ \373\347\022\203\372\325\237O\300\307\234\251\021r\340\263y\t\311\305\300\324\376\306\213\322\232j\234\265d\3216\020\030|\204\277\230\327h\342\361S\341\203\202\344\322\211\310\364eh\313d\223-S\nb"
+	.string	"g"
+	.string	"k"
+	.string	"\225\007EGR\325Z\222\234\266\230Tvod\023X\315s5\021\024\036+\252\262\306/\262\261]\247w\331\255\022*\273\266\t\314\366\\\315\263V\017NO\265\226\006|\302:\265\315\266\361\022\250^G\342\034\361\250\265\2023\304m_\233\177\242\267H\235\233/\200\224Z\253\227\324\331p\317\333&`{\307^\f\001:p{\345E\3520Uwg\227\270\235?\366\275:}\354o\375\355\232\322\265\367\334\377\3267B\206H\214Zs\256zT)\n5\344\027\235\311\346)\374%\006E&l\257\f\345"
+	.ascii	"\032O9\222S\020\016J\376\321\221l\236\344\026^YuB\254\232p\242"
+	.ascii	"\\X\247\257\007\370N\275\207|\327\3315?\341\243p\220\344\272"
+	.ascii	"\221\027\272C\030\222\252\242\272\355.\212\206:\001\221\264\263"
+	.ascii	"\210\321"
+	.string	"\033\tV\034J\254 \223}\247\337\224\260\203\334az\204\017 \276\364\377T\365\344\004\345\240\363J\177\335\350\364j\340\374\020}x\363:\273\334\2516\002TkE\340\253x\023\214/t\352qfO\316|\247\260\240\236\333^\371\272\263f\354\236\273Sn\273\363\276\366}z\363G\032\002\266 [\371lr\"\206\260\003,'%#\027D\226\230\005\rDZ\370@\200c%\342\213\254e\234\311\254\210\264p\3662\316h1c\f\214\265\2001\262\020\006\214\315h\300\222\002\036e\304\031H\033\307\031\350*o\367\352\364Q@B\3526q\016Y{\002\205=\351\027n\336\370D\007A\0221\365M\337\305_\320\370B^\t\367d\b\203\304\341+\375\0011 0\002B\034\244\363\316\tP\256_\376KbhQ\023\016\246\321j\270*\265\373\277\373\267\227qw\020\270\225\210\3732dE\302[l\367Z,\002c\325D\247Z\207\213"
+	.string	"\226\261\244d\003\343\333\2757\332\305\222\307s\207\227I\361>B\037\013\307b\001\362\n\315\220MC7v\033"
+	.ascii	"n\352\271\311\374\362\241\305ZDCt\022^\263\3000k\bl\311\003\317"
+	.ascii	"-Z\376\004"
+	.text
+	.section	.gnu.lto__reset_template_42.0.36.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 Y\225\002"
+	.string	"T\004H"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\005\001\006'\001\362\f\005\001\006\035\001\035\001\n\005\001'\002\002\1772\344"
+	.string	"?\202\210\200\310\001}{\300\001y\300\001w\274\001u\277\001s\274\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003FFF\004"
+	.ascii	"@D\315;0m\032@\021"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 \343\315\004"
+	.string	"D\007\337"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002 \177\b\200\200\200\200\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005$\005\200\204\001"
+	.string	""
+	.string	"\003\002!\177\t\004\200%\n \034\013\201"
+	.string	"\005\033\f\002\"\177\r\037\016\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\035\017\005"
+	.string	"\020\001#\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177\022\003"
+	.string	"\n\201\200\200\200\003\001\244\006\003\006\013\344\007"
+	.string	"\016"
+	.ascii	"\0023(\237\"62\305<\301p\371\261\f7\253AP\3653\313\020\020c\251"
+	.ascii	"0`\034(&\022(="
+	.text
+	.section	.gnu.lto_.refs.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\t"
+	.string	"\003\002\001\003\004"
+	.string	"\002\004\n"
+	.string	"\001\005\f"
+	.string	"\003\006\001\003\005"
+	.string	"\002\004\013"
+	.string	"\001\005\r"
+	.string	"\003\007\002\004\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bf29d835d6243bc9,"e",@progbits
+	.string	"(\265/\375`\250\023\315e"
+	.ascii	"\032\261\314&U@PBJ\007\256\206\253X\210\320m\322\277\342\356"
+	.ascii	"\355\214\330-\266{@\360.\336\275\251\315\263\274\222\257\312"
+	.ascii	"<\t\362.\332\265\265\003\245;\203\304\261\272\316\031\023\273"
+	.ascii	"\370\300FX\336-\316\352PT\273A\033\321\024\013HA\373 %m\360\240"
+	.ascii	"P\213\374\244\344I\2232\005\n\002c\002a\002\355\212\025?+V\254"
+	.ascii	"\310\231U\361\352\n\340d5\036\303K\025L\346\334\344\260\343\210"
+	.ascii	"\355m\233\0076\257 \372|c\245g\025\350\255\255\215U\240o\"\351"
+	.ascii	"\233\354\203\336\034\323\2671}\307\220\236\331\322s\231\364\034"
+	.ascii	"&=\233\375\354\205\275\230\271\032\351\261\325'7\207\316H\334"
+	.ascii	"\230V\230\324\364y.Ko\334\203\002\261\226\364\034\226\276\213"
+	.ascii	"}\320f\216\361\025\034\262\035dV\372\274\013\"tx}\335\220\f\243"
+	.ascii	"\302\314\234\341\316U\352\322#\371\242\305\013\276\302C0\363"
+	.ascii	"\326&s\\U\307\264{\333\263\223\177\350\nC\341\256[\233\274\267"
+	.ascii	"\212J\205\226\0320\254\265{/\026\326\302b\234\205\267\360\222"
+	.ascii	"\257p\225\263\025.\342\334\256\370\271\021\221\303i\353\346d"
+	.ascii	"+\366A}\030\207\364\234#\375\013\351SHw\330\007e0\216\302K\024"
+	.ascii	"<\245\325\301Y\303"
+	.string	"dM\232>\357Ko\210~)?\201x_\374DzF\201r\033\243@\177\223\376p\327\317O\270e.\023\356]\272\367\016\220\323\274\272*\353\223\205\340\2553\027+\337\342\305oC\255\233u\357e\256\007\220\367\022\231KG\315\275D\035f\004\230\0218\233T\031\371B\317\347R\326\032:\007\321\203\032\217\355\3251\261L\303\322\321\347N\247\\d\037\224\207{\320\024\354\203\376\f\304\317X\234\205\342V|B\336\256{[\036\235\226\007T\220>\337\262\017\232r\017\372\237\355\377\022\377\321\374O\363\177\355\377\232\377g\376\227\371o\346H\374\267\371;\205\341O<\200\277g\360\211c\271\f\303\177\032\r\374\354\302\3179I\377I\270\356o\002~\326\340\347\016~\346\340\347\f~&\372y\203\237?`\177\206\361\363\005?[ \374\257\363\267\220\237\327\237\201?\227\3603\215\237A\370\031\201\237\017\370\031\305\317??\013\360\363\315\317"
+	.ascii	"\374\274\363\263\316\317\374\177\312\317\375\177\313\377\254"
+	.ascii	"\377=\377\305\376\243mmmm?\037\377\223\201?'K,n2(\025\221C\237"
+	.ascii	"=\365\267\217\226\352!#g\330J\353\263\221\354\203.pn\245\350"
+	.ascii	"\030\242\367\361\274\354c\3578\207Zwh\323\205\211\223\332\332"
+	.ascii	"\275G\0269\252#\020h>\244\272\226\206\266\201\206\346\301\327"
+	.ascii	"\210\346\234R%K\252\2067\017,*\255\r\314\2542\023f\212T\3323"
+	.ascii	"\234M_9\206\364\371\023*J\207\316kH\333U\237\2723D\314\204{\351"
+	.ascii	"\r\3259Z\207\f\245\"\216\231%\355\032i`\321.\235Rg\31144\251"
+	.ascii	"\316\nQ\307\320L\357\2467\365\023\037\357-\314\024\034\262\254"
+	.ascii	"\335\343\021\310F\206\036clN\357\247\213\271"
+	.string	"\271'pMYQ~\350\363e\032\007N\t+'#\016\031X\252H\023S_\233\030\226\306\224\365\271\354\"\2131\341\204\007#G\372\374MI\372\367\217^\242\361\336;\003\256\275F\245\033\224q\314@?\016\3378\201\377\347\r\306\332\275WK\310\244?L!\372x\212+\343\016\227,\021\243xn{\215E%\220aQ\b\262(\236\366R\rp\225An\261\005\022u\"o\337\366\362]\002\022\225B\261E\032\213-r\270s\227\220\303{\333\250\235b\027q\310E%\220\250\242\022\031\305s\227\356\360*\211T\351\0222\252\250\005\031\265ST\022\243\212K@\242x\222,)\362\304\211\007-0LU\\\2729\240\244\210\306\235f\261E^\263{\271\213\351\032\023\270W\ni4#\332\300L\245f\016\245(D$\267\367^\002\240\224\252\220w\251YD\202\274\027\211\322\321\205z`\3306\257\016\334\034\006\221\272OL\367\026"
+	.string	"u\357\220o\363\336;\274\367\346\214R\355\2757\354\024\223PP\367\036\177\240\256\3240\214\351\336\356\002\303\214**\253\220Ca[\312\344mj\207\234\274f@\214\251r\b\345>\215I\223Q;\324\330\322\277\225\2107Dv\234\225\365\3717\261\207\235$M\022\250>\373\376\334\242\230Q\362\343Kz\366\002\303Ln\036%h\002D\032\027fc%\270\f7\255dd}\255a4\234\206\325\360\022\334\306kl\206\317\360\222\331X\314\031\215\323\336\355\275KG\374Cl\\\306f\304'I\316\352\322e\004\231W\362\213\223$\262\\\23413\347v/\016M\3308Lk"
+	.ascii	"\026\217\343\222{\003K\326$\327n\361\b\224\343\204\006DH\233"
+	.ascii	"\275\321\336bZ\274\370\331o\310\326V\237}v\326a\314V1\211\016"
+	.ascii	"s$L\2245m\332`\032\230BC\245\306\204\025Y\221$}6\022?;\024\225"
+	.ascii	"$S}v\331\321p\242@\261\222j/\267\261\252.J}6Yw\341\345\305\372"
+	.ascii	"\210\347Pi\362\022c\222\036\006\276\030\332\\\336\315_\247\243"
+	.ascii	"\202\203\020 G\322\277\307~]\356\253\314G\262\317\347\210\244"
+	.ascii	"\317\tIY\t\321\333\312y\331VZLF\327%F\001a1\2429\256\361\024"
+	.ascii	"i*\351\263\2574\026^\002u\226w\021\354\344\272\245\366*uec\246"
+	.ascii	"\272\322\244g T\207\201\320\023M\"M\277\020\275\211 b\347^!?"
+	.ascii	"\2309\250%m\016)i\252\246\352}\204\227]\325T~\240\264C\2355)"
+	.ascii	"\0267XtP3\366\031\226s\352\001\326\325\246\347\254$\255\304\214"
+	.ascii	"\265\226\364U\026\027\254\006\342JK#y\322\\\334<\356\334\245"
+	.ascii	"e\2304\260f\322W9C\236{\203\214%\2454\263\247t\224\376\352%/"
+	.ascii	"\033\254\235\274}\350\037\376\023\326`\335dK\332\n\233\2622F"
+	.ascii	"\2329g\222\237\235P*b\340\004L\032W\267\275\305\315c{g\260\221"
+	.ascii	"\222T3\263\326]\355\305\313\346\372O{o\027\0018i\276\2549A\267"
+	.ascii	"\204`\342\360\321\324g+Y)\346\024D\207\026/;\b\235&\037\330z"
+	.ascii	"\350\263\241\374L\206!\016\247W9k\b\303\332\322\347\321\247\364"
+	.ascii	"(Sz\334\022ig\245^"
+	.string	"\322\246\306\306\244\307\241\245\307\201I\217#K\217\333\242\344\n\247\314Bf\354\212\231]\266<)aIS\264\354\203\002q\017\332E\332H'\177\235N\023\346\020\260\260\364\335\003\007;p\001\353\363\344WA\233\2077\221_\327bF\222PQ\322\267\016\275\303\257\3131\353\301\013\2122}[\201\265\221\351\321g\347\2202\341\256T\230\230Z\376\360\321\347;\207\036\302\\-\264\261\235\351\363f\354\203\342p\017\312hC\357 6cV\322\236\364Hu;PQ5\217\264\275:8\b\0348TP\210L\365y\334MS1\242\367\017^\366\217&\246JE\f\264|\245]\343\025\0267G\224f\272\224\245)\031\321\373\006^\366\r=%\303\252\275CtL\212\361\030*\322\t<6i\203\002~\024\324[w\275\032B\275\032\002\250*\254I3T$\226\005\256G4T\226\347\363\363\255\254PH-JB\352\375|B\2530IH"
+	.ascii	"$\244\244\337\017\370\313\261;t\005\340z\304\002\177\271\032"
+	.ascii	"<\025\351\274\021\354\331Pm\240?\n\322\200\006Q\bB\254j\264\362"
+	.ascii	"\330\024\354\256\205\013\024z@\244\031\352\n\234\241s#\b\234"
+	.ascii	"\201\202\375QP0\t\270\032\355V\225Um\360V^P\250\327\373%\331"
+	.ascii	"\374j4N\270\273aw?\243 \356g\024\274\251-\370"
+	.string	"\204\247P\250\256EE\274\334\215 \260w\256l\360V\244\376\214|H\274\\\221*L:\177@\037\333S\205\271\257;\243`\020\316\215\225\025\372\214T\020N\250F?\336Q\357\347\247\256kR\217\200\033\274u\235@\030B\317\fV\025\372\260"
+	.string	"\274'\334\375,"
+	.string	"\301(\210\342=\337\252\376T\243\364\017\300h"
+	.string	"F\f\026r\217\021\201\003\0218\200>F\004CC\021\300\030J\017c\350\346@P\213\007\220\2026Tv\307\252Bu\335\005\300\376h\001v\007c(e\177>`\020\005\236\272\236\260\343\005\331\234\236\336\232\213Q\344\333`=bs\353\021\233\nq\024\020y\260\036\321\370\335(\322\305"
+	.string	"\006Y\250`\005\336\b\275\325\304\217\202\214|5\00680\250\256B,\020\270\n\331\bwF\276\032?\340\f\033*+\274!\314aA-\372\021\025\371\202:\036\250,\017\004U\005\037\333\343\361\250E@\033;\243\244\023\324\"\023\354.\006\373\363%\345\336\302\205\312{\341@\221\213\240\003\016\001\0043R\210\300\301\005i/HE\362\325"
+	.string	"\256\301\235\312\362V$\340\312\376\200=\241^\r\241\237\217gC\250\267\n\205\202\024\020\366|\254\320\307\362X\341\016\005!\217\325YyG\275S\265\301\373\235D5\257\036VU\267\341\016/P_R\3724\301\304v\273l\335\246\033\002\240f\311\343\270v\2174"
+	.string	"\375\275\346\335\3268rvPbCW\372\224\346\255F\215\007\225\217>{\211F\243$\371\365e\37131?\204\241\342\244\317>\323k\267Jz\r\201\3664\343\032\22250f\320r9\260\322\f)35$\313\213X\223y:\257\316H\215\351SGT\342W\242\325X\353\352`.d[\026\240\226j*\256\365\331jdHz\370\342\222\352p\020my\033\261\245\321n]n\356P\353\352\310\201\005\201^\250\221 \207\230CDffD\204$M\322\001\301\004\3040\007\245\204=\022\30055\320!\247ff\002IR*\3541\007\302\355\262\313CCdE\264\2044\260\377\021\t5$\272\227\315\021*\310-\016W!\251\020\256L\232\312V\351\213\265\"\306^QF\005\361\326\032\307\300B\213h\246.5g\006"
+	.string	"\254P\301\021\265\247pU\3442:\300\321\202b\315'\023l\261\253\357_\213\344\245\270\275\222\027\216\177UO\nlA\232\024\350\3733\267\305\266\333]S\023\257\002\016y\032P(\371E2\025\366G\004\252LIqU)\204\240\333Z(\224\336\362S\327\3262\211\f\364\303\374i\317\020\006aC\2525@\342YVG=\250]\204<>C\005\265~+F\332\322\271\375\226\265\260\377\374 \024\314\306\266\320\240\231'$\222\203\241<g\031\245u\3635k_\0068\320\026\360\007J\217\023S \277\007\022\032)k*\252'\035\266\rE\"\367PA\335E\332\374gw9<\207\303\207\301\002@=\350\310\300\322\265\247LF\377\243\365\361\032\240\313Xu\002\341`\3265wB\337\201K\222\f\242\370\326\242\363c\275\240\200\030\027Y\355\373\246\263\357\276;\347\206\325W\202\253\035r\350\243e\243\206I\216\t\2372\316\275\330\027\262"
+	.string	"<\230\r\322\203u\003\227\1774\344\007\026\336\311\333d\233c$\022\365\327"
+	.string	"!\224G\351m\342\240\227\035\211%\\\022`\202-\333\263\317g}Qd\366\215\257TI!]\266\243?\367\373-)\\\006H\331\311AFF\304\025\272\316d\336NA\231\370\275zFN{^e\\3\371\217\022\032W\215\316|\b\247^O1\005\025\204\033v6\240\235\031Cj\220\037\351m\311^\212\177\276\367A\331s\3026\005\037\f\346\313\2007B\371\256#\233\211I\314Z\024YN\247W\t\"\314G-\347\334\256u\201u,O\316A\247>\334W!o\312\340 &~\277\361l\200\223\224kGR8"
+	.string	"a\201\b,\310\022?2\334E\332\310\340-49\273\235\256\024T\303\203I\312\222\346(\t\0168J\340\253\24525\314\261\313(\017\230z\301!\300\221\345\177\200\016\020\004_\254(#\245\313\355h\312R\345\213# \220\327JPU\254\227\230"
+	.ascii	"\351{x8h\340\007\220\265\022\364\312\2536$\326%\367\366p1q\304"
+	.ascii	"\325\357\037\267\240\3444v\300\200\371P\373\213*\322$\020\211"
+	.ascii	"\224\214\231\2405\313(J\200>f\325\257%\372\316\2209\233\027\035"
+	.ascii	"\351\3260\271\206\367\n\347\365\264\266\373\260\205\003\330J"
+	.ascii	"\032\237\360\336\311Q\226\003A\352\200\204\351\342\272\352\344"
+	.ascii	"\034\303\222:\363\255\244\274\240\210\377\311^\306q\354\340j"
+	.ascii	"yz?w\241\255\375\221\007\004\2167\375\035\023\177\231Q\ff\272"
+	.ascii	"\215\345k\272\0176\253\335yL\204\211@\361\026wU"
+	.text
+	.section	.gnu.lto_.symtab.bf29d835d6243bc9,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bf29d835d6243bc9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
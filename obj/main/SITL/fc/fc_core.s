@@ -0,0 +1,20384 @@
+	.file	"fc_core.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/blackbox/blackbox.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/sensor.h"
+	.file 10 "./src/main/sensors/sensors.h"
+	.file 11 "./src/main/sensors/acceleration.h"
+	.file 12 "./src/main/sensors/gyro.h"
+	.file 13 "./src/main/fc/cli.h"
+	.file 14 "./src/main/drivers/resource.h"
+	.file 15 "./src/main/fc/config.h"
+	.file 16 "./src/main/flight/pid.h"
+	.file 17 "./src/main/fc/controlrate_profile.h"
+	.file 18 "./src/main/fc/fc_core.h"
+	.file 19 "./src/main/fc/rc_modes.h"
+	.file 20 "./src/main/fc/rc_controls.h"
+	.file 21 "./src/main/fc/runtime_config.h"
+	.file 22 "./src/main/io/beeper.h"
+	.file 23 "./src/main/io/gps.h"
+	.file 24 "./src/main/rx/rx.h"
+	.file 25 "./src/main/scheduler/scheduler.h"
+	.file 26 "./src/main/telemetry/telemetry.h"
+	.file 27 "./src/main/flight/imu.h"
+	.file 28 "./src/main/drivers/pwm_output.h"
+	.file 29 "./src/main/flight/mixer.h"
+	.file 30 "./src/main/target/SITL/target.h"
+	.file 31 "./src/main/flight/servos.h"
+	.file 32 "./src/main/fc/fc_core.c"
+	.file 33 "./src/main/flight/navigation.h"
+	.file 34 "./src/main/fc/fc_rc.h"
+	.file 35 "./src/main/flight/altitude.h"
+	.file 36 "./src/main/drivers/time.h"
+	.file 37 "./src/main/msp/msp_serial.h"
+	.file 38 "./src/main/flight/failsafe.h"
+	.file 39 "./src/main/fc/rc_adjustments.h"
+	.file 40 "./src/main/config/feature.h"
+	.file 41 "./src/main/sensors/barometer.h"
+	.file 42 "./src/main/io/statusindicator.h"
+	.file 43 "/usr/include/strings.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_core.c.a87f385b
+	.weak	fc_core.c.a87f385b
+fc_core.c.a87f385b:
+	.long	0x1dde
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF2559
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1888
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1889
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1890
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1891
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1892
+	.uleb128 0x3
+	.long	.LASF1893
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1894
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1895
+	.uleb128 0x3
+	.long	.LASF1896
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1897
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1898
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1899
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1900
+	.uleb128 0x3
+	.long	.LASF1901
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1902
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1903
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1904
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1905
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xa
+	.long	0xcf
+	.uleb128 0x1b
+	.long	.LASF2423
+	.byte	0x1e
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1906
+	.uleb128 0x13
+	.long	0x103
+	.long	0x103
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1907
+	.uleb128 0xa
+	.long	0x103
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x11f
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1908
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0x10f
+	.uleb128 0x4
+	.long	.LASF1909
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1ce
+	.uleb128 0x1
+	.long	.LASF1910
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1911
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1912
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1913
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1914
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1918
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x16
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1933
+	.uleb128 0x3
+	.long	.LASF1934
+	.byte	0x5
+	.byte	0x19
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF1935
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF1936
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF1937
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x22d
+	.uleb128 0xb
+	.long	.LASF1938
+	.value	0xfff
+	.uleb128 0xb
+	.long	.LASF1939
+	.value	0xf000
+	.uleb128 0xb
+	.long	.LASF1940
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1942
+	.byte	0x6
+	.byte	0x29
+	.byte	0xf
+	.long	0x239
+	.uleb128 0x28
+	.long	0x249
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x5
+	.long	0x26a
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x17
+	.string	"fn"
+	.byte	0x6
+	.byte	0x33
+	.byte	0x16
+	.long	0x26a
+	.byte	0
+	.uleb128 0x6
+	.long	0x22d
+	.uleb128 0x9
+	.long	.LASF1948
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2b
+	.long	0x2ca
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1f9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1944
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x2ca
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1945
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x2ca
+	.byte	0x10
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x30
+	.byte	0xf
+	.long	0x2cf
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1946
+	.byte	0x6
+	.byte	0x34
+	.byte	0x7
+	.long	0x249
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x2ca
+	.uleb128 0x3
+	.long	.LASF1947
+	.byte	0x6
+	.byte	0x35
+	.byte	0x3
+	.long	0x26f
+	.uleb128 0xa
+	.long	0x2d4
+	.uleb128 0x9
+	.long	.LASF1949
+	.byte	0x8
+	.byte	0x7
+	.byte	0x2a
+	.long	0x35a
+	.uleb128 0x2
+	.long	.LASF1950
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1951
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1952
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1953
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1954
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1955
+	.byte	0x7
+	.byte	0x30
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1956
+	.byte	0x7
+	.byte	0x31
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1957
+	.byte	0x7
+	.byte	0x32
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1958
+	.byte	0x7
+	.byte	0x33
+	.byte	0x3
+	.long	0x2e5
+	.uleb128 0xa
+	.long	0x35a
+	.uleb128 0x4
+	.long	.LASF1959
+	.byte	0x7
+	.byte	0x35
+	.byte	0x19
+	.long	0x35a
+	.uleb128 0x6
+	.long	0x10a
+	.uleb128 0x13
+	.long	0x103
+	.long	0x38c
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1960
+	.byte	0x8
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x17
+	.byte	0xe
+	.long	0x3db
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1970
+	.byte	0x9
+	.byte	0x21
+	.byte	0x3
+	.long	0x398
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1971
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1972
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x405
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x14
+	.byte	0xe
+	.long	0x430
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1978
+	.byte	0x6
+	.byte	0xa
+	.byte	0x1e
+	.long	0x464
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xa
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0xa
+	.byte	0x20
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0xa
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1981
+	.byte	0xa
+	.byte	0x22
+	.byte	0x3
+	.long	0x430
+	.uleb128 0x22
+	.long	.LASF1993
+	.byte	0x6
+	.byte	0xa
+	.byte	0x24
+	.long	0x495
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0xa
+	.byte	0x25
+	.byte	0xd
+	.long	0x3f5
+	.uleb128 0x1c
+	.long	.LASF1982
+	.byte	0xa
+	.byte	0x26
+	.byte	0x1f
+	.long	0x464
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1983
+	.byte	0xa
+	.byte	0x27
+	.byte	0x3
+	.long	0x470
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xe
+	.long	0x4d8
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1991
+	.byte	0x4
+	.byte	0xb
+	.byte	0x35
+	.long	0x4ff
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xb
+	.byte	0x36
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0xb
+	.byte	0x37
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1992
+	.byte	0xb
+	.byte	0x38
+	.byte	0x3
+	.long	0x4d8
+	.uleb128 0x22
+	.long	.LASF1994
+	.byte	0x4
+	.byte	0xb
+	.byte	0x3a
+	.long	0x530
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0xb
+	.byte	0x3b
+	.byte	0xd
+	.long	0x535
+	.uleb128 0x1c
+	.long	.LASF1982
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x4ff
+	.byte	0
+	.uleb128 0xa
+	.long	0x50b
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x545
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1995
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x3
+	.long	0x50b
+	.uleb128 0x9
+	.long	.LASF1996
+	.byte	0x14
+	.byte	0xb
+	.byte	0x40
+	.long	0x59f
+	.uleb128 0x2
+	.long	.LASF1997
+	.byte	0xb
+	.byte	0x41
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1998
+	.byte	0xb
+	.byte	0x42
+	.byte	0x14
+	.long	0x3db
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0xb
+	.byte	0x43
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0xb
+	.byte	0x44
+	.byte	0x1b
+	.long	0x495
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0xb
+	.byte	0x45
+	.byte	0x19
+	.long	0x545
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2002
+	.byte	0xb
+	.byte	0x46
+	.byte	0x3
+	.long	0x551
+	.uleb128 0xa
+	.long	0x59f
+	.uleb128 0x4
+	.long	.LASF2003
+	.byte	0xb
+	.byte	0x48
+	.byte	0x1e
+	.long	0x59f
+	.uleb128 0x9
+	.long	.LASF2004
+	.byte	0x10
+	.byte	0xc
+	.byte	0x47
+	.long	0x5e3
+	.uleb128 0x2
+	.long	.LASF2005
+	.byte	0xc
+	.byte	0x48
+	.byte	0xe
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2006
+	.byte	0xc
+	.byte	0x49
+	.byte	0xb
+	.long	0x37c
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2007
+	.byte	0xc
+	.byte	0x4a
+	.byte	0x3
+	.long	0x5bc
+	.uleb128 0x9
+	.long	.LASF2008
+	.byte	0x18
+	.byte	0xc
+	.byte	0x4c
+	.long	0x6cc
+	.uleb128 0x2
+	.long	.LASF2009
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x14
+	.long	0x3db
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2010
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2011
+	.byte	0xc
+	.byte	0x4f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2012
+	.byte	0xc
+	.byte	0x50
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2013
+	.byte	0xc
+	.byte	0x51
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2014
+	.byte	0xc
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2015
+	.byte	0xc
+	.byte	0x53
+	.byte	0xd
+	.long	0x1ce
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2016
+	.byte	0xc
+	.byte	0x54
+	.byte	0xd
+	.long	0x1ce
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2017
+	.byte	0xc
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2018
+	.byte	0xc
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2019
+	.byte	0xc
+	.byte	0x57
+	.byte	0xe
+	.long	0xc3
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2020
+	.byte	0xc
+	.byte	0x58
+	.byte	0xe
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0xc
+	.byte	0x59
+	.byte	0xe
+	.long	0xc3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0xc
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2023
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0xc
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2025
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x3
+	.long	0x5ef
+	.uleb128 0xa
+	.long	0x6cc
+	.uleb128 0x4
+	.long	.LASF2026
+	.byte	0xc
+	.byte	0x5f
+	.byte	0x15
+	.long	0x6cc
+	.uleb128 0x4
+	.long	.LASF2027
+	.byte	0xd
+	.byte	0x14
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x13
+	.long	0x38c
+	.long	0x705
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xe
+	.byte	0x14
+	.byte	0xe
+	.long	0x82c
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xf
+	.byte	0x22
+	.byte	0xe
+	.long	0x909
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF2082
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF2083
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF2084
+	.value	0x400
+	.uleb128 0xb
+	.long	.LASF2085
+	.value	0x1000
+	.uleb128 0xb
+	.long	.LASF2086
+	.value	0x2000
+	.uleb128 0xb
+	.long	.LASF2087
+	.value	0x4000
+	.uleb128 0xb
+	.long	.LASF2088
+	.value	0x8000
+	.uleb128 0xf
+	.long	.LASF2089
+	.long	0x10000
+	.uleb128 0xf
+	.long	.LASF2090
+	.long	0x20000
+	.uleb128 0xf
+	.long	.LASF2091
+	.long	0x40000
+	.uleb128 0xf
+	.long	.LASF2092
+	.long	0x80000
+	.uleb128 0xf
+	.long	.LASF2093
+	.long	0x100000
+	.uleb128 0xf
+	.long	.LASF2094
+	.long	0x200000
+	.uleb128 0xf
+	.long	.LASF2095
+	.long	0x400000
+	.uleb128 0xf
+	.long	.LASF2096
+	.long	0x800000
+	.uleb128 0xf
+	.long	.LASF2097
+	.long	0x2000000
+	.uleb128 0xf
+	.long	.LASF2098
+	.long	0x4000000
+	.uleb128 0xf
+	.long	.LASF2099
+	.long	0x8000000
+	.uleb128 0xf
+	.long	.LASF2100
+	.long	0x10000000
+	.uleb128 0xf
+	.long	.LASF2101
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2102
+	.byte	0x4c
+	.byte	0x10
+	.byte	0x4a
+	.long	0xa82
+	.uleb128 0xe
+	.string	"pid"
+	.byte	0x10
+	.byte	0x4b
+	.byte	0xc
+	.long	0x1633
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2103
+	.byte	0x10
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2104
+	.byte	0x10
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2105
+	.byte	0x10
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2106
+	.byte	0x10
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0x10
+	.byte	0x51
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2108
+	.byte	0x10
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2109
+	.byte	0x10
+	.byte	0x53
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2110
+	.byte	0x10
+	.byte	0x54
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2111
+	.byte	0x10
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2112
+	.byte	0x10
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2113
+	.byte	0x10
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2114
+	.byte	0x10
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0x10
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0x10
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0x10
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x10
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x10
+	.byte	0x60
+	.byte	0xe
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x10
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2121
+	.byte	0x10
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2122
+	.byte	0x10
+	.byte	0x63
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2123
+	.byte	0x10
+	.byte	0x64
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2124
+	.byte	0x10
+	.byte	0x65
+	.byte	0xe
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2125
+	.byte	0x10
+	.byte	0x66
+	.byte	0xe
+	.long	0xc3
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2126
+	.byte	0x10
+	.byte	0x67
+	.byte	0xe
+	.long	0xc3
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2127
+	.byte	0x10
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2128
+	.byte	0x10
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2129
+	.byte	0x10
+	.byte	0x6a
+	.byte	0x18
+	.long	0x15ed
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2130
+	.byte	0xf
+	.byte	0x63
+	.byte	0x1d
+	.long	0xa8e
+	.uleb128 0x6
+	.long	0x909
+	.uleb128 0x9
+	.long	.LASF2131
+	.byte	0xc
+	.byte	0x11
+	.byte	0x19
+	.long	0xb15
+	.uleb128 0x2
+	.long	.LASF2132
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2133
+	.byte	0x11
+	.byte	0x1b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2134
+	.byte	0x11
+	.byte	0x1c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0x11
+	.byte	0x1d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0x11
+	.byte	0x1e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x11
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb15
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2138
+	.byte	0x11
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2139
+	.byte	0x11
+	.byte	0x21
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0x11
+	.byte	0x22
+	.byte	0xe
+	.long	0xc3
+	.byte	0xa
+	.byte	0
+	.uleb128 0x13
+	.long	0xb7
+	.long	0xb25
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2141
+	.byte	0x11
+	.byte	0x23
+	.byte	0x3
+	.long	0xa93
+	.uleb128 0x4
+	.long	.LASF2142
+	.byte	0x11
+	.byte	0x28
+	.byte	0x1d
+	.long	0xb3d
+	.uleb128 0x6
+	.long	0xb25
+	.uleb128 0x4
+	.long	.LASF2143
+	.byte	0x12
+	.byte	0x18
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2144
+	.byte	0x12
+	.byte	0x1b
+	.byte	0xc
+	.long	0x1ce
+	.uleb128 0x4
+	.long	.LASF2145
+	.byte	0x12
+	.byte	0x1c
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x9
+	.long	.LASF2146
+	.byte	0x4
+	.byte	0x12
+	.byte	0x1e
+	.long	0xb8d
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0x12
+	.byte	0x1f
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0x12
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x12
+	.byte	0x21
+	.byte	0x3
+	.long	0xb66
+	.uleb128 0xa
+	.long	0xb8d
+	.uleb128 0x4
+	.long	.LASF2150
+	.byte	0x12
+	.byte	0x23
+	.byte	0x23
+	.long	0xb8d
+	.uleb128 0x4
+	.long	.LASF2151
+	.byte	0x12
+	.byte	0x23
+	.byte	0x66
+	.long	0xb8d
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x13
+	.byte	0x18
+	.byte	0xe
+	.long	0xca7
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2159
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2190
+	.byte	0x13
+	.byte	0x3f
+	.byte	0x3
+	.long	0xbb6
+	.uleb128 0x23
+	.long	.LASF2366
+	.long	0x30
+	.byte	0x14
+	.byte	0x18
+	.long	0xd0b
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x1
+	.uleb128 0x29
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x14
+	.byte	0x27
+	.byte	0xe
+	.long	0xd24
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2204
+	.byte	0x14
+	.byte	0x2a
+	.byte	0x3
+	.long	0xd0b
+	.uleb128 0xa
+	.long	0xd24
+	.uleb128 0x4
+	.long	.LASF2205
+	.byte	0x14
+	.byte	0x4f
+	.byte	0xe
+	.long	0xf3
+	.uleb128 0x9
+	.long	.LASF2206
+	.byte	0x5
+	.byte	0x14
+	.byte	0x51
+	.long	0xd8f
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x14
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x14
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x14
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0x14
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x14
+	.byte	0x56
+	.byte	0x9
+	.long	0x1ce
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2212
+	.byte	0x14
+	.byte	0x57
+	.byte	0x3
+	.long	0xd41
+	.uleb128 0xa
+	.long	0xd8f
+	.uleb128 0x4
+	.long	.LASF2213
+	.byte	0x14
+	.byte	0x59
+	.byte	0x1b
+	.long	0xd8f
+	.uleb128 0x9
+	.long	.LASF2214
+	.byte	0x3
+	.byte	0x14
+	.byte	0x64
+	.long	0xde0
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0x14
+	.byte	0x65
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2216
+	.byte	0x14
+	.byte	0x66
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2217
+	.byte	0x14
+	.byte	0x67
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2218
+	.byte	0x14
+	.byte	0x68
+	.byte	0x3
+	.long	0xdac
+	.uleb128 0xa
+	.long	0xde0
+	.uleb128 0x4
+	.long	.LASF2219
+	.byte	0x14
+	.byte	0x6a
+	.byte	0x17
+	.long	0xde0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x15
+	.byte	0x15
+	.byte	0xe
+	.long	0xe16
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2222
+	.byte	0x15
+	.byte	0x1a
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x15
+	.byte	0x24
+	.byte	0xe
+	.long	0xe74
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF2231
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF2232
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF2233
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2234
+	.byte	0x15
+	.byte	0x30
+	.byte	0x3
+	.long	0xe22
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x15
+	.byte	0x3c
+	.byte	0xe
+	.long	0xed2
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF2243
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF2244
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF2245
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x15
+	.byte	0x48
+	.byte	0x3
+	.long	0xe80
+	.uleb128 0x4
+	.long	.LASF2247
+	.byte	0x15
+	.byte	0x4a
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x15
+	.byte	0x58
+	.byte	0xe
+	.long	0xf15
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2253
+	.byte	0x15
+	.byte	0x64
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x16
+	.byte	0x17
+	.byte	0xe
+	.long	0xfb2
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2276
+	.byte	0x16
+	.byte	0x31
+	.byte	0x3
+	.long	0xf21
+	.uleb128 0x9
+	.long	.LASF2277
+	.byte	0xc
+	.byte	0x17
+	.byte	0x4f
+	.long	0xff2
+	.uleb128 0xe
+	.string	"lat"
+	.byte	0x17
+	.byte	0x50
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0xe
+	.string	"lon"
+	.byte	0x17
+	.byte	0x51
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0xe
+	.string	"alt"
+	.byte	0x17
+	.byte	0x52
+	.byte	0xe
+	.long	0xc3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2278
+	.byte	0x17
+	.byte	0x53
+	.byte	0x3
+	.long	0xfbe
+	.uleb128 0x9
+	.long	.LASF2279
+	.byte	0x18
+	.byte	0x17
+	.byte	0x55
+	.long	0x1059
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0x17
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0xe
+	.string	"llh"
+	.byte	0x17
+	.byte	0x57
+	.byte	0x13
+	.long	0xff2
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0x17
+	.byte	0x58
+	.byte	0xe
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x17
+	.byte	0x59
+	.byte	0xe
+	.long	0xc3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0x17
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2284
+	.byte	0x17
+	.byte	0x5b
+	.byte	0xe
+	.long	0xc3
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2285
+	.byte	0x17
+	.byte	0x5c
+	.byte	0x3
+	.long	0xffe
+	.uleb128 0x4
+	.long	.LASF2286
+	.byte	0x17
+	.byte	0x76
+	.byte	0x1a
+	.long	0x1059
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x1081
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2287
+	.byte	0x18
+	.byte	0x4f
+	.byte	0x10
+	.long	0x1071
+	.uleb128 0x9
+	.long	.LASF2288
+	.byte	0x2c
+	.byte	0x18
+	.byte	0x75
+	.long	0x11df
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0x18
+	.byte	0x76
+	.byte	0xd
+	.long	0x11df
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0x18
+	.byte	0x77
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0x18
+	.byte	0x78
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0x18
+	.byte	0x79
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x18
+	.byte	0x7a
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x18
+	.byte	0x7b
+	.byte	0xe
+	.long	0xcf
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0x18
+	.byte	0x7c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0x18
+	.byte	0x7d
+	.byte	0xd
+	.long	0x38c
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x18
+	.byte	0x7e
+	.byte	0xd
+	.long	0x38c
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x18
+	.byte	0x7f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x18
+	.byte	0x80
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2300
+	.byte	0x18
+	.byte	0x81
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2301
+	.byte	0x18
+	.byte	0x82
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2302
+	.byte	0x18
+	.byte	0x83
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2303
+	.byte	0x18
+	.byte	0x84
+	.byte	0xe
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2304
+	.byte	0x18
+	.byte	0x85
+	.byte	0xe
+	.long	0xc3
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2305
+	.byte	0x18
+	.byte	0x86
+	.byte	0xe
+	.long	0xc3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2306
+	.byte	0x18
+	.byte	0x87
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2307
+	.byte	0x18
+	.byte	0x88
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2308
+	.byte	0x18
+	.byte	0x89
+	.byte	0xd
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2309
+	.byte	0x18
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2310
+	.byte	0x18
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x18
+	.byte	0x8c
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2312
+	.byte	0x18
+	.byte	0x8e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x18
+	.byte	0x8f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x28
+	.byte	0
+	.uleb128 0x13
+	.long	0xb7
+	.long	0x11ef
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2314
+	.byte	0x18
+	.byte	0x90
+	.byte	0x3
+	.long	0x108d
+	.uleb128 0xa
+	.long	0x11ef
+	.uleb128 0x4
+	.long	.LASF2315
+	.byte	0x18
+	.byte	0x92
+	.byte	0x13
+	.long	0x11ef
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x19
+	.byte	0x3e
+	.byte	0xe
+	.long	0x1297
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2337
+	.byte	0x19
+	.byte	0x8f
+	.byte	0x3
+	.long	0x120c
+	.uleb128 0x4
+	.long	.LASF2338
+	.byte	0x19
+	.byte	0xbb
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0xe
+	.long	0x12c8
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2341
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x3
+	.long	0x12af
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x1a
+	.byte	0x23
+	.byte	0xe
+	.long	0x12ed
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2344
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x3
+	.long	0x12d4
+	.uleb128 0x9
+	.long	.LASF2345
+	.byte	0x18
+	.byte	0x1a
+	.byte	0x28
+	.long	0x13a2
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x1a
+	.byte	0x29
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x1a
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x1a
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x12c8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0x11
+	.long	0x12ed
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x1a
+	.byte	0x30
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0x1a
+	.byte	0x31
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x1a
+	.byte	0x32
+	.byte	0xd
+	.long	0xb7
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x1a
+	.byte	0x33
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x1a
+	.byte	0x34
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2357
+	.byte	0x1a
+	.byte	0x35
+	.byte	0x3
+	.long	0x12f9
+	.uleb128 0xa
+	.long	0x13a2
+	.uleb128 0x4
+	.long	.LASF2358
+	.byte	0x1a
+	.byte	0x37
+	.byte	0x1a
+	.long	0x13a2
+	.uleb128 0x2a
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x22
+	.byte	0x5
+	.long	0x13f0
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0x1b
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0x1b
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0x1b
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x21
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x20
+	.byte	0x9
+	.long	0x1412
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0x1b
+	.byte	0x21
+	.byte	0xd
+	.long	0x3f5
+	.uleb128 0x1c
+	.long	.LASF1982
+	.byte	0x1b
+	.byte	0x27
+	.byte	0x7
+	.long	0x13bf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2359
+	.byte	0x1b
+	.byte	0x28
+	.byte	0x3
+	.long	0x13f0
+	.uleb128 0x4
+	.long	.LASF2360
+	.byte	0x1b
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x1412
+	.uleb128 0x9
+	.long	.LASF2361
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x98
+	.long	0x145e
+	.uleb128 0x2
+	.long	.LASF2362
+	.byte	0x1c
+	.byte	0x9a
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2363
+	.byte	0x1c
+	.byte	0x9b
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2364
+	.byte	0x1c
+	.byte	0x9c
+	.byte	0xd
+	.long	0x6f5
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2365
+	.byte	0x1c
+	.byte	0x9d
+	.byte	0x3
+	.long	0x142a
+	.uleb128 0x23
+	.long	.LASF2367
+	.long	0x30
+	.byte	0x1d
+	.byte	0x24
+	.long	0x1516
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2394
+	.byte	0x2
+	.byte	0x1d
+	.byte	0x53
+	.long	0x153d
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0x1d
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2395
+	.byte	0x1d
+	.byte	0x55
+	.byte	0x9
+	.long	0x1ce
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2396
+	.byte	0x1d
+	.byte	0x56
+	.byte	0x3
+	.long	0x1516
+	.uleb128 0xa
+	.long	0x153d
+	.uleb128 0x4
+	.long	.LASF2397
+	.byte	0x1d
+	.byte	0x58
+	.byte	0x16
+	.long	0x153d
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x10
+	.byte	0x25
+	.byte	0xe
+	.long	0x15a9
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0xa
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x10
+	.byte	0x39
+	.byte	0xe
+	.long	0x15c2
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2411
+	.byte	0x10
+	.byte	0x3c
+	.byte	0x3
+	.long	0x15a9
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xe
+	.long	0x15ed
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2415
+	.byte	0x10
+	.byte	0x42
+	.byte	0x3
+	.long	0x15ce
+	.uleb128 0x9
+	.long	.LASF2416
+	.byte	0x3
+	.byte	0x10
+	.byte	0x44
+	.long	0x1627
+	.uleb128 0xe
+	.string	"P"
+	.byte	0x10
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0xe
+	.string	"I"
+	.byte	0x10
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0xe
+	.string	"D"
+	.byte	0x10
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2417
+	.byte	0x10
+	.byte	0x48
+	.byte	0x3
+	.long	0x15f9
+	.uleb128 0x13
+	.long	0x1627
+	.long	0x1643
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2418
+	.byte	0x10
+	.byte	0x6b
+	.byte	0x3
+	.long	0x909
+	.uleb128 0xa
+	.long	0x1643
+	.uleb128 0x9
+	.long	.LASF2419
+	.byte	0x1
+	.byte	0x10
+	.byte	0x6f
+	.long	0x166e
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0x10
+	.byte	0x70
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2421
+	.byte	0x10
+	.byte	0x71
+	.byte	0x3
+	.long	0x1654
+	.uleb128 0xa
+	.long	0x166e
+	.uleb128 0x4
+	.long	.LASF2422
+	.byte	0x10
+	.byte	0x73
+	.byte	0x14
+	.long	0x166e
+	.uleb128 0x1b
+	.long	.LASF2424
+	.byte	0x10
+	.byte	0x79
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x4
+	.long	.LASF2425
+	.byte	0x10
+	.byte	0x7a
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x1f
+	.byte	0x19
+	.byte	0x6
+	.long	0x170a
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0xe
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2441
+	.byte	0x1f
+	.byte	0x29
+	.byte	0x3
+	.long	0x16a3
+	.uleb128 0x9
+	.long	.LASF2442
+	.byte	0x10
+	.byte	0x1f
+	.byte	0x71
+	.long	0x1757
+	.uleb128 0xe
+	.string	"dev"
+	.byte	0x1f
+	.byte	0x72
+	.byte	0x16
+	.long	0x145e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0x1f
+	.byte	0x73
+	.byte	0xe
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2444
+	.byte	0x1f
+	.byte	0x74
+	.byte	0xd
+	.long	0xb7
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0x1f
+	.byte	0x75
+	.byte	0xd
+	.long	0xb7
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2446
+	.byte	0x1f
+	.byte	0x76
+	.byte	0x3
+	.long	0x1716
+	.uleb128 0xa
+	.long	0x1757
+	.uleb128 0x4
+	.long	.LASF2447
+	.byte	0x1f
+	.byte	0x78
+	.byte	0x16
+	.long	0x1757
+	.uleb128 0x18
+	.long	0xb42
+	.byte	0x6b
+	.byte	0x9
+	.uleb128 0x18
+	.long	0xb5a
+	.byte	0x6e
+	.byte	0x9
+	.uleb128 0x1d
+	.long	.LASF2448
+	.byte	0x70
+	.byte	0xc
+	.long	0x1ce
+	.uleb128 0x1d
+	.long	.LASF2449
+	.byte	0x71
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x18
+	.long	0xb4e
+	.byte	0x73
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2450
+	.byte	0x74
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF2451
+	.byte	0x20
+	.byte	0x76
+	.byte	0x29
+	.long	0xb99
+	.uleb128 0x18
+	.long	0xb9e
+	.byte	0x76
+	.byte	0x6e
+	.uleb128 0x18
+	.long	0xbaa
+	.byte	0x76
+	.byte	0xaa
+	.uleb128 0x4
+	.long	.LASF2452
+	.byte	0x20
+	.byte	0x76
+	.byte	0xe3
+	.long	0x2e0
+	.uleb128 0x2b
+	.long	0x17c4
+	.value	0x119
+	.uleb128 0x2c
+	.long	0x17aa
+	.byte	0x78
+	.byte	0x22
+	.uleb128 0x19
+	.long	.LASF2453
+	.value	0x110
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x19
+	.long	.LASF2454
+	.value	0x111
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x19
+	.long	.LASF2455
+	.value	0x112
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x19
+	.long	.LASF2456
+	.value	0x113
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x19
+	.long	.LASF2457
+	.value	0x114
+	.byte	0xa
+	.long	0xc3
+	.uleb128 0x7
+	.long	.LASF2458
+	.byte	0x21
+	.byte	0x3a
+	.uleb128 0x7
+	.long	.LASF2459
+	.byte	0x22
+	.byte	0x13
+	.uleb128 0x15
+	.long	.LASF2467
+	.byte	0x1b
+	.byte	0x47
+	.byte	0x9
+	.long	0x9f
+	.long	0x183e
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2460
+	.byte	0x22
+	.byte	0x19
+	.uleb128 0x7
+	.long	.LASF2461
+	.byte	0x23
+	.byte	0x22
+	.uleb128 0x7
+	.long	.LASF2462
+	.byte	0x22
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF2463
+	.byte	0x1d
+	.byte	0x7c
+	.uleb128 0x7
+	.long	.LASF2464
+	.byte	0x1f
+	.byte	0x81
+	.uleb128 0xc
+	.long	.LASF2469
+	.byte	0x1f
+	.byte	0x80
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x10
+	.long	.LASF2465
+	.byte	0x1d
+	.byte	0x7a
+	.long	0x187e
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2466
+	.byte	0x10
+	.byte	0x76
+	.long	0x189e
+	.uleb128 0x5
+	.long	0x189e
+	.uleb128 0x5
+	.long	0x18a3
+	.uleb128 0x5
+	.long	0x377
+	.uleb128 0x5
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x6
+	.long	0x164f
+	.uleb128 0x6
+	.long	0x530
+	.uleb128 0x15
+	.long	.LASF2468
+	.byte	0xc
+	.byte	0x67
+	.byte	0x5
+	.long	0x1ce
+	.long	0x18be
+	.uleb128 0x5
+	.long	0x18be
+	.byte	0
+	.uleb128 0x6
+	.long	0x5e3
+	.uleb128 0xc
+	.long	.LASF2470
+	.byte	0xc
+	.byte	0x68
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x15
+	.long	.LASF2471
+	.byte	0xc
+	.byte	0x66
+	.byte	0x5
+	.long	0x1ce
+	.long	0x18e5
+	.uleb128 0x5
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2472
+	.byte	0xc
+	.byte	0x64
+	.uleb128 0xc
+	.long	.LASF2473
+	.byte	0x24
+	.byte	0x1b
+	.byte	0xa
+	.long	0x1ed
+	.uleb128 0x15
+	.long	.LASF2474
+	.byte	0x19
+	.byte	0xc1
+	.byte	0xd
+	.long	0x1d5
+	.long	0x190e
+	.uleb128 0x5
+	.long	0x1297
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2475
+	.byte	0x25
+	.byte	0x5a
+	.uleb128 0x7
+	.long	.LASF2476
+	.byte	0x1a
+	.byte	0x40
+	.uleb128 0x7
+	.long	.LASF2477
+	.byte	0x1a
+	.byte	0x45
+	.uleb128 0x7
+	.long	.LASF2478
+	.byte	0x21
+	.byte	0x3b
+	.uleb128 0x15
+	.long	.LASF2479
+	.byte	0x15
+	.byte	0x67
+	.byte	0xa
+	.long	0xc3
+	.long	0x1940
+	.uleb128 0x5
+	.long	0xed2
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2480
+	.byte	0x15
+	.byte	0x66
+	.byte	0xa
+	.long	0xc3
+	.long	0x1956
+	.uleb128 0x5
+	.long	0xed2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2481
+	.byte	0x26
+	.byte	0x55
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x10
+	.long	.LASF2482
+	.byte	0x27
+	.byte	0x67
+	.long	0x1973
+	.uleb128 0x5
+	.long	0x1973
+	.byte	0
+	.uleb128 0x6
+	.long	0xa93
+	.uleb128 0x7
+	.long	.LASF2483
+	.byte	0x27
+	.byte	0x65
+	.uleb128 0x7
+	.long	.LASF2484
+	.byte	0x13
+	.byte	0x6d
+	.uleb128 0x10
+	.long	.LASF2485
+	.byte	0x14
+	.byte	0x70
+	.long	0x1997
+	.uleb128 0x5
+	.long	0xd24
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2486
+	.byte	0x16
+	.byte	0x3d
+	.uleb128 0xc
+	.long	.LASF2487
+	.byte	0x14
+	.byte	0x72
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x10
+	.long	.LASF2488
+	.byte	0x10
+	.byte	0x80
+	.long	0x19bb
+	.uleb128 0x5
+	.long	0x15c2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2489
+	.byte	0x10
+	.byte	0x7f
+	.uleb128 0xc
+	.long	.LASF2490
+	.byte	0x13
+	.byte	0x69
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x7
+	.long	.LASF2491
+	.byte	0x26
+	.byte	0x51
+	.uleb128 0x7
+	.long	.LASF2492
+	.byte	0x26
+	.byte	0x50
+	.uleb128 0xc
+	.long	.LASF2493
+	.byte	0x26
+	.byte	0x54
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x10
+	.long	.LASF2494
+	.byte	0x18
+	.byte	0xa9
+	.long	0x19f9
+	.uleb128 0x5
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2495
+	.byte	0x18
+	.byte	0xa5
+	.long	0x1a0a
+	.uleb128 0x5
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2496
+	.byte	0x16
+	.byte	0x40
+	.long	0x1a1b
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2d
+	.string	"ffs"
+	.byte	0x2b
+	.byte	0x68
+	.byte	0xc
+	.long	0x7c
+	.long	0x1a31
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2497
+	.byte	0x15
+	.byte	0x3a
+	.byte	0x16
+	.long	0xe74
+	.uleb128 0xc
+	.long	.LASF2498
+	.byte	0xc
+	.byte	0x70
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x15
+	.long	.LASF2499
+	.byte	0x28
+	.byte	0x1e
+	.byte	0x5
+	.long	0x1ce
+	.long	0x1a5f
+	.uleb128 0x5
+	.long	0xcf
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2500
+	.byte	0x24
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1e1
+	.uleb128 0x10
+	.long	.LASF2501
+	.byte	0xc
+	.byte	0x6f
+	.long	0x1a7c
+	.uleb128 0x5
+	.long	0x1ce
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2502
+	.byte	0x16
+	.byte	0x3c
+	.long	0x1a8d
+	.uleb128 0x5
+	.long	0xfb2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2503
+	.byte	0x7
+	.byte	0x3c
+	.uleb128 0xc
+	.long	.LASF2504
+	.byte	0xc
+	.byte	0x71
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0xc
+	.long	.LASF2505
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0xc
+	.long	.LASF2506
+	.byte	0x29
+	.byte	0x34
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x15
+	.long	.LASF2507
+	.byte	0x15
+	.byte	0x69
+	.byte	0x5
+	.long	0x1ce
+	.long	0x1ace
+	.uleb128 0x5
+	.long	0xcf
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2508
+	.byte	0x2a
+	.byte	0x17
+	.uleb128 0x7
+	.long	.LASF2509
+	.byte	0x2a
+	.byte	0x15
+	.uleb128 0x7
+	.long	.LASF2510
+	.byte	0x2a
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF2511
+	.byte	0x15
+	.byte	0x39
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0xc
+	.long	.LASF2512
+	.byte	0x14
+	.byte	0x6f
+	.byte	0x12
+	.long	0xd24
+	.uleb128 0x10
+	.long	.LASF2513
+	.byte	0x15
+	.byte	0x38
+	.long	0x1b0c
+	.uleb128 0x5
+	.long	0xe74
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2514
+	.byte	0x15
+	.byte	0x37
+	.long	0x1b1d
+	.uleb128 0x5
+	.long	0xe74
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2515
+	.byte	0x13
+	.byte	0x66
+	.byte	0x5
+	.long	0x1ce
+	.long	0x1b33
+	.uleb128 0x5
+	.long	0xca7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2516
+	.byte	0xf
+	.byte	0x74
+	.uleb128 0x2e
+	.long	.LASF2517
+	.byte	0x20
+	.value	0x2a4
+	.byte	0x5
+	.long	0x1ce
+	.uleb128 0x1a
+	.long	.LASF2522
+	.value	0x294
+	.long	0x1b6b
+	.uleb128 0x16
+	.long	.LASF2520
+	.value	0x294
+	.byte	0x1f
+	.long	0x1ed
+	.uleb128 0x11
+	.long	.LASF2518
+	.value	0x296
+	.byte	0x12
+	.long	0x5e3
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2519
+	.byte	0x20
+	.value	0x28b
+	.byte	0x5
+	.long	0x1ce
+	.long	0x1b95
+	.uleb128 0x16
+	.long	.LASF2520
+	.value	0x28b
+	.byte	0x23
+	.long	0x1ed
+	.uleb128 0x16
+	.long	.LASF2521
+	.value	0x28b
+	.byte	0x3e
+	.long	0x1d5
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2523
+	.value	0x274
+	.long	0x1bb9
+	.uleb128 0x16
+	.long	.LASF2520
+	.value	0x274
+	.byte	0x18
+	.long	0x1ed
+	.uleb128 0x11
+	.long	.LASF2524
+	.value	0x284
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2546
+	.byte	0x20
+	.value	0x26a
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x1e
+	.long	.LASF2527
+	.value	0x24d
+	.long	0x1bf8
+	.uleb128 0x11
+	.long	.LASF2524
+	.value	0x24f
+	.byte	0xe
+	.long	0xcf
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF2525
+	.value	0x252
+	.byte	0x19
+	.long	0xcf
+	.uleb128 0x11
+	.long	.LASF2526
+	.value	0x253
+	.byte	0x18
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2528
+	.value	0x216
+	.long	0x1c1c
+	.uleb128 0x16
+	.long	.LASF2520
+	.value	0x216
+	.byte	0x2e
+	.long	0x1ed
+	.uleb128 0x11
+	.long	.LASF2524
+	.value	0x218
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2529
+	.value	0x20d
+	.long	0x1c4c
+	.uleb128 0x16
+	.long	.LASF2006
+	.value	0x20d
+	.byte	0x2f
+	.long	0x377
+	.uleb128 0x16
+	.long	.LASF2520
+	.value	0x20d
+	.byte	0x42
+	.long	0x1ed
+	.uleb128 0x11
+	.long	.LASF2524
+	.value	0x20f
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2530
+	.value	0x148
+	.long	0x1c94
+	.uleb128 0x16
+	.long	.LASF2520
+	.value	0x148
+	.byte	0x19
+	.long	0x1ed
+	.uleb128 0x11
+	.long	.LASF2531
+	.value	0x14a
+	.byte	0x10
+	.long	0x1ce
+	.uleb128 0x11
+	.long	.LASF2532
+	.value	0x14b
+	.byte	0x10
+	.long	0x1ce
+	.uleb128 0x11
+	.long	.LASF2533
+	.value	0x160
+	.byte	0x1c
+	.long	0xd30
+	.uleb128 0x11
+	.long	.LASF2534
+	.value	0x1af
+	.byte	0x9
+	.long	0x1ce
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2535
+	.value	0x137
+	.long	0x1caf
+	.uleb128 0x1f
+	.uleb128 0x31
+	.string	"dif"
+	.byte	0x20
+	.value	0x13a
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2542
+	.byte	0x20
+	.value	0x126
+	.byte	0xd
+	.uleb128 0x33
+	.long	.LASF2538
+	.byte	0x20
+	.value	0x116
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF2536
+	.byte	0xd3
+	.long	0x1cda
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF2537
+	.value	0x105
+	.byte	0x11
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2539
+	.byte	0xc4
+	.uleb128 0x20
+	.long	.LASF2540
+	.byte	0x97
+	.uleb128 0x20
+	.long	.LASF2541
+	.byte	0x92
+	.uleb128 0x34
+	.long	.LASF2543
+	.byte	0x20
+	.byte	0x85
+	.byte	0xc
+	.long	0x1ce
+	.uleb128 0x24
+	.long	.LASF2544
+	.byte	0x7d
+	.long	0x1d0f
+	.uleb128 0x35
+	.long	.LASF2545
+	.byte	0x20
+	.byte	0x7d
+	.byte	0x3f
+	.long	0x1d0f
+	.byte	0
+	.uleb128 0x6
+	.long	0x545
+	.uleb128 0x12
+	.long	.LASF2547
+	.byte	0x1f
+	.byte	0x78
+	.byte	0x74
+	.long	0x1d20
+	.uleb128 0x6
+	.long	0x1763
+	.uleb128 0x12
+	.long	.LASF2548
+	.byte	0x10
+	.byte	0x73
+	.byte	0x6a
+	.long	0x1d31
+	.uleb128 0x6
+	.long	0x167a
+	.uleb128 0x12
+	.long	.LASF2549
+	.byte	0x1d
+	.byte	0x58
+	.byte	0x74
+	.long	0x1d42
+	.uleb128 0x6
+	.long	0x1549
+	.uleb128 0x12
+	.long	.LASF2550
+	.byte	0x1a
+	.byte	0x37
+	.byte	0x88
+	.long	0x1d53
+	.uleb128 0x6
+	.long	0x13ae
+	.uleb128 0x12
+	.long	.LASF2551
+	.byte	0x18
+	.byte	0x92
+	.byte	0x65
+	.long	0x1d64
+	.uleb128 0x6
+	.long	0x11fb
+	.uleb128 0x12
+	.long	.LASF2552
+	.byte	0x14
+	.byte	0x6a
+	.byte	0x79
+	.long	0x1d75
+	.uleb128 0x6
+	.long	0xdec
+	.uleb128 0x12
+	.long	.LASF2553
+	.byte	0x14
+	.byte	0x59
+	.byte	0x8d
+	.long	0x1d86
+	.uleb128 0x6
+	.long	0xd9b
+	.uleb128 0x12
+	.long	.LASF2554
+	.byte	0x12
+	.byte	0x23
+	.byte	0xb5
+	.long	0x1d97
+	.uleb128 0x6
+	.long	0xb99
+	.uleb128 0x12
+	.long	.LASF2555
+	.byte	0xc
+	.byte	0x5f
+	.byte	0x6f
+	.long	0x1da8
+	.uleb128 0x6
+	.long	0x6d8
+	.uleb128 0x36
+	.long	.LASF2556
+	.byte	0xb
+	.byte	0x48
+	.value	0x103
+	.long	0x1dba
+	.uleb128 0x6
+	.long	0x59f
+	.uleb128 0x12
+	.long	.LASF2557
+	.byte	0xb
+	.byte	0x48
+	.byte	0x9c
+	.long	0x1dcb
+	.uleb128 0x6
+	.long	0x5ab
+	.uleb128 0x12
+	.long	.LASF2558
+	.byte	0x7
+	.byte	0x35
+	.byte	0x83
+	.long	0x1ddc
+	.uleb128 0x6
+	.long	0x366
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 44 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 45 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 46 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.file 47 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 49 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 50 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 53 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 55 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 60 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 61 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 64 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x40
+	.file 65 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 66 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.file 67 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF907
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF908
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.file 68 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 69 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 70 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 71 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 72 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x4
+	.file 73 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 74 "./src/main/drivers/gyro_sync.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x4b
+	.file 76 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4c
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 77 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4d
+	.file 78 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x4
+	.file 80 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 81 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1169
+	.file 82 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1171
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1172
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1181
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1186
+	.byte	0x4
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 90 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1219
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1220
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1221
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1222
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1223
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1224
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1225
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1226
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1227
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x64
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1239
+	.byte	0x4
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1246
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1247
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1248
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1251
+	.byte	0x4
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6a
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1252
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.file 108 "./src/main/drivers/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 109 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 110 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x6e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x29
+	.file 111 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1326
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1327
+	.byte	0x4
+	.file 112 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x70
+	.file 113 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x71
+	.file 114 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x72
+	.byte	0x4
+	.byte	0x4
+	.file 115 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x73
+	.file 116 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.file 117 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0xf
+	.file 118 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x76
+	.byte	0x4
+	.file 119 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x77
+	.byte	0x4
+	.file 120 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 121 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x79
+	.byte	0x4
+	.file 122 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7a
+	.file 123 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7b
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 124 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 125 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x7d
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1727
+	.byte	0x4
+	.file 126 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 127 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7f
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1731
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1732
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x25
+	.file 128 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x80
+	.file 129 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x81
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 130 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x82
+	.file 131 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 132 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x84
+	.byte	0x4
+	.file 133 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x85
+	.byte	0x4
+	.file 134 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x2a
+	.byte	0x4
+	.file 135 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x87
+	.byte	0x4
+	.file 136 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x88
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1809
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1839
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.file 137 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x89
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1848
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1887
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF937
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF941
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF983
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1072
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1078
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1168
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1176
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1185
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1201
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1238
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1242
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1245
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.transponder_ir.h.23.b50bed893bc0dbf7b1e0fb37ef14e2d7,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1312
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1322
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1325
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1336
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1338
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1346
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1358
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1730
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1740
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1798
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1808
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1834
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1838
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1847
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1864
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1873
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1884
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1a
+	.long	.LASF1
+	.long	.LASF2560
+	.long	.LASF2561
+	.long	.LASF2562
+	.long	.LASF2563
+	.long	.LASF2564
+	.long	.LASF2565
+	.long	.LASF2566
+	.long	.LASF2567
+	.long	.LASF2568
+	.long	.LASF2569
+	.long	.LASF2570
+	.long	.LASF2571
+	.long	.LASF2572
+	.long	.LASF2573
+	.long	.LASF2574
+	.long	.LASF2575
+	.long	.LASF2576
+	.long	.LASF2577
+	.long	.LASF2578
+	.long	.LASF2579
+	.long	.LASF2580
+	.long	.LASF2581
+	.long	.LASF2582
+	.long	.LASF2583
+	.long	.LASF2584
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x8a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2585
+	.byte	0x15
+	.long	.LASF2586
+	.byte	0x15
+	.long	.LASF2587
+	.byte	0x15
+	.long	.LASF2588
+	.byte	0x2
+	.long	.LASF2589
+	.byte	0x3
+	.long	.LASF2590
+	.byte	0x4
+	.long	.LASF2591
+	.byte	0x1
+	.long	.LASF2592
+	.byte	0x7
+	.long	.LASF2593
+	.byte	0x7
+	.long	.LASF2594
+	.byte	0xf
+	.long	.LASF2595
+	.byte	0xf
+	.long	.LASF2596
+	.byte	0xf
+	.long	.LASF2597
+	.byte	0x8
+	.long	.LASF2598
+	.byte	0x7
+	.long	.LASF2599
+	.byte	0x8
+	.long	.LASF2600
+	.byte	0x9
+	.long	.LASF2601
+	.byte	0x8
+	.long	.LASF2602
+	.byte	0x8
+	.long	.LASF2603
+	.byte	0x8
+	.long	.LASF2604
+	.byte	0x8
+	.long	.LASF2605
+	.byte	0x8
+	.long	.LASF2606
+	.byte	0xb
+	.long	.LASF2607
+	.byte	0xb
+	.long	.LASF2608
+	.byte	0xd
+	.long	.LASF2609
+	.byte	0xe
+	.long	.LASF2610
+	.byte	0x12
+	.long	.LASF2611
+	.byte	0x9
+	.long	.LASF2612
+	.byte	0x7
+	.long	.LASF2613
+	.byte	0x9
+	.long	.LASF2614
+	.byte	0x10
+	.long	.LASF2615
+	.byte	0x9
+	.long	.LASF2616
+	.byte	0x8
+	.long	.LASF2617
+	.byte	0x9
+	.long	.LASF2618
+	.byte	0x8
+	.long	.LASF2619
+	.byte	0x9
+	.long	.LASF2589
+	.byte	0x7
+	.long	.LASF2620
+	.byte	0xc
+	.long	.LASF2621
+	.byte	0x9
+	.long	.LASF2622
+	.byte	0x8
+	.long	.LASF2623
+	.byte	0x4
+	.long	.LASF2624
+	.byte	0xf
+	.long	.LASF2625
+	.byte	0xb
+	.long	.LASF2626
+	.byte	0x18
+	.long	.LASF2627
+	.byte	0x18
+	.long	.LASF2628
+	.byte	0x19
+	.long	.LASF2629
+	.byte	0x19
+	.long	.LASF2629
+	.byte	0x18
+	.long	.LASF2630
+	.byte	0x15
+	.long	.LASF2631
+	.byte	0x18
+	.long	.LASF2632
+	.byte	0x18
+	.long	.LASF2633
+	.byte	0x15
+	.long	.LASF2634
+	.byte	0x15
+	.long	.LASF2635
+	.byte	0x17
+	.long	.LASF2636
+	.byte	0x15
+	.long	.LASF2637
+	.byte	0x16
+	.long	.LASF2638
+	.byte	0x16
+	.long	.LASF2639
+	.byte	0x15
+	.long	.LASF2640
+	.byte	0x15
+	.long	.LASF2641
+	.byte	0x15
+	.long	.LASF2642
+	.byte	0x18
+	.long	.LASF2643
+	.byte	0x19
+	.long	.LASF2644
+	.byte	0x14
+	.long	.LASF2645
+	.byte	0x14
+	.long	.LASF2646
+	.byte	0x13
+	.long	.LASF2647
+	.byte	0x11
+	.long	.LASF2648
+	.byte	0x11
+	.long	.LASF2649
+	.byte	0x1
+	.long	.LASF2650
+	.byte	0x2
+	.long	.LASF2651
+	.byte	0x3
+	.long	.LASF2652
+	.byte	0x3
+	.long	.LASF2653
+	.byte	0x3
+	.long	.LASF2654
+	.byte	0x3
+	.long	.LASF2655
+	.byte	0x4
+	.long	.LASF2656
+	.byte	0x7
+	.long	.LASF2657
+	.byte	0x5
+	.long	.LASF2658
+	.byte	0x7
+	.long	.LASF2659
+	.byte	0x7
+	.long	.LASF2660
+	.byte	0x7
+	.long	.LASF2661
+	.byte	0x7
+	.long	.LASF2662
+	.byte	0x5
+	.long	.LASF2663
+	.byte	0x18
+	.long	.LASF2664
+	.byte	0x18
+	.long	.LASF2665
+	.byte	0x14
+	.long	.LASF2666
+	.byte	0x14
+	.long	.LASF2667
+	.byte	0x15
+	.long	.LASF2668
+	.byte	0x15
+	.long	.LASF2664
+	.byte	0x15
+	.long	.LASF2669
+	.byte	0x14
+	.long	.LASF2670
+	.byte	0x15
+	.long	.LASF2589
+	.byte	0x18
+	.long	.LASF2589
+	.byte	0x15
+	.long	.LASF2671
+	.byte	0x14
+	.long	.LASF2672
+	.byte	0x14
+	.long	.LASF2673
+	.byte	0x14
+	.long	.LASF2674
+	.byte	0x14
+	.long	.LASF2675
+	.byte	0x14
+	.long	.LASF2676
+	.byte	0x15
+	.long	.LASF2677
+	.byte	0x15
+	.long	.LASF2678
+	.byte	0x15
+	.long	.LASF2679
+	.byte	0x15
+	.long	.LASF2680
+	.byte	0x15
+	.long	.LASF2681
+	.byte	0x15
+	.long	.LASF2682
+	.byte	0x15
+	.long	.LASF2683
+	.byte	0x14
+	.long	.LASF2684
+	.byte	0x14
+	.long	.LASF2685
+	.byte	0x15
+	.long	.LASF2686
+	.byte	0x15
+	.long	.LASF2687
+	.byte	0x7
+	.long	.LASF2688
+	.byte	0x7
+	.long	.LASF2689
+	.byte	0x7
+	.long	.LASF2624
+	.byte	0x6
+	.long	.LASF2690
+	.byte	0xf
+	.long	.LASF2691
+	.byte	0xf
+	.long	.LASF2692
+	.byte	0xf
+	.long	.LASF2693
+	.byte	0xf
+	.long	.LASF2694
+	.byte	0xf
+	.long	.LASF2695
+	.byte	0xf
+	.long	.LASF2696
+	.byte	0x7
+	.long	.LASF2697
+	.byte	0x7
+	.long	.LASF2698
+	.byte	0x7
+	.long	.LASF2699
+	.byte	0x7
+	.long	.LASF2700
+	.byte	0x7
+	.long	.LASF2701
+	.byte	0x7
+	.long	.LASF2702
+	.byte	0x7
+	.long	.LASF2703
+	.byte	0x7
+	.long	.LASF2704
+	.byte	0x7
+	.long	.LASF2705
+	.byte	0x7
+	.long	.LASF2706
+	.byte	0xc
+	.long	.LASF2707
+	.byte	0x3
+	.long	.LASF2708
+	.byte	0xa
+	.long	.LASF2709
+	.byte	0xa
+	.long	.LASF2710
+	.byte	0xb
+	.long	.LASF2615
+	.byte	0xb
+	.long	.LASF2700
+	.byte	0xb
+	.long	.LASF2687
+	.byte	0xb
+	.long	.LASF2711
+	.byte	0xb
+	.long	.LASF2712
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1718:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2217:
+	.string	"auto_disarm_delay"
+.LASF1748:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1193:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF940:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1354:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1548:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1352:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1494:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF948:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1325:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1289:
+	.string	"TRANSPONDER_TIMER_MHZ_ARCITIMER 24"
+.LASF1186:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF2193:
+	.string	"THROTTLE"
+.LASF2548:
+	.string	"pidConfig"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1845:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1068:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2188:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF734:
+	.string	"USE_CLI "
+.LASF2094:
+	.string	"FEATURE_TRANSPONDER"
+.LASF946:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1449:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2242:
+	.string	"UNUSED_MODE"
+.LASF1862:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1780:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1202:
+	.string	"sched_priority sched_priority"
+.LASF821:
+	.string	"USE_PPM"
+.LASF1117:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2412:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2075:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1174:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1363:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1621:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1587:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1108:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1300:
+	.string	"TRANSPONDER_CARRIER_HZ_ILAP 460750"
+.LASF1181:
+	.string	"__pid_t_defined "
+.LASF1173:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF916:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1841:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1702:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1437:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2017:
+	.string	"gyro_to_use"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2184:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1893:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1203:
+	.string	"__sched_priority sched_priority"
+.LASF1736:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1039:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1757:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1622:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1933:
+	.string	"_Bool"
+.LASF2298:
+	.string	"spektrum_sat_bind"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1727:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1855:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1567:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF964:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2520:
+	.string	"currentTimeUs"
+.LASF1794:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF2471:
+	.string	"gyroSamplePush"
+.LASF1188:
+	.string	"__CPU_SETSIZE 1024"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2036:
+	.string	"OWNER_ADC_CURR"
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF700:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1709:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1372:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1682:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1739:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2419:
+	.string	"pidConfig_s"
+.LASF2421:
+	.string	"pidConfig_t"
+.LASF2263:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1527:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1343:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1967:
+	.string	"CW90_DEG_FLIP"
+.LASF2468:
+	.string	"gyroSamplePop"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1932:
+	.string	"DEBUG_COUNT"
+.LASF1361:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2372:
+	.string	"MIXER_GIMBAL"
+.LASF1092:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2488:
+	.string	"pidStabilisationState"
+.LASF2216:
+	.string	"disarm_kill_switch"
+.LASF2315:
+	.string	"rxConfig_System"
+.LASF1318:
+	.string	"LED1_OFF NOOP"
+.LASF1115:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1969:
+	.string	"CW270_DEG_FLIP"
+.LASF1764:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1056:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1283:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ARCITIMER 8"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF2302:
+	.string	"rssi_invert"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1714:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1866:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1021:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1553:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1686:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2324:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1160:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1661:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1632:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2033:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1721:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1690:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2084:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1904:
+	.string	"uint16_t"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF2292:
+	.string	"halfDuplex"
+.LASF2001:
+	.string	"accelerometerTrims"
+.LASF1192:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1653:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1497:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1441:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF1080:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1730:
+	.string	"BEEP_ON do {} while (0)"
+.LASF926:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1620:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2476:
+	.string	"telemetryCheckState"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1606:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1347:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2467:
+	.string	"calculateThrottleAngleCorrection"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1148:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1819:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1085:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1017:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2018:
+	.string	"gyro_fusion_mode"
+.LASF1110:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2208:
+	.string	"yaw_deadband"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2429:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2450:
+	.string	"lastArmingDisabledReason"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1025:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2531:
+	.string	"armedBeeperOn"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2438:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF2250:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF2131:
+	.string	"controlRateConfig_s"
+.LASF2141:
+	.string	"controlRateConfig_t"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2555:
+	.string	"gyroConfig"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1285:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER 4"
+.LASF2038:
+	.string	"OWNER_ADC_RSSI"
+.LASF1564:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1299:
+	.string	"TRANSPONDER_TIMER_MHZ_ILAP 24"
+.LASF2151:
+	.string	"throttleCorrectionConfig_Copy"
+.LASF949:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1830:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2174:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1955:
+	.string	"compression"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2501:
+	.string	"gyroStartCalibration"
+.LASF2285:
+	.string	"gpsSolutionData_t"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1129:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1851:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1123:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1731:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1685:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2400:
+	.string	"PID_YAW"
+.LASF1578:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1713:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2040:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2059:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1247:
+	.string	"__have_pthread_attr_t 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF1652:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1874:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1381:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1645:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1831:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF976:
+	.string	"BIT(x) (1 << (x))"
+.LASF2064:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1335:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1440:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2382:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF2286:
+	.string	"gpsSol"
+.LASF1774:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF1540:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2463:
+	.string	"writeMotors"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1024:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1902:
+	.string	"int32_t"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1758:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF944:
+	.string	"FAST_MATH "
+.LASF799:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF906:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1141:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF2072:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1635:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1365:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF2420:
+	.string	"pid_process_denom"
+.LASF2547:
+	.string	"servoConfig"
+.LASF930:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1405:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1762:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2061:
+	.string	"OWNER_BARO_EXTI"
+.LASF1002:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1274:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2397:
+	.string	"mixerConfig_System"
+.LASF1450:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2493:
+	.string	"failsafeIsMonitoring"
+.LASF822:
+	.string	"USE_PWM"
+.LASF904:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2474:
+	.string	"getTaskDeltaTime"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1982:
+	.string	"values"
+.LASF2448:
+	.string	"reverseMotors"
+.LASF1636:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1367:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2039:
+	.string	"OWNER_SERIAL_TX"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2157:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1022:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1414:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1036:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1940:
+	.string	"PGR_SIZE_MASK"
+.LASF2425:
+	.string	"targetPidLooptime"
+.LASF1886:
+	.string	"GYRO_WATCHDOG_DELAY 80"
+.LASF2006:
+	.string	"gyroADCf"
+.LASF1465:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1651:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1428:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2374:
+	.string	"MIXER_HEX6"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1836:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2136:
+	.string	"thrExpo8"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1208:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1073:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF968:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1920:
+	.string	"DEBUG_VELOCITY"
+.LASF2082:
+	.string	"FEATURE_FAILSAFE"
+.LASF1728:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF1206:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1119:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1615:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1781:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF2275:
+	.string	"BEEPER_PREFERENCE"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"SCHED_RR 2"
+.LASF2167:
+	.string	"BOXLEDLOW"
+.LASF2288:
+	.string	"rxConfig_s"
+.LASF2314:
+	.string	"rxConfig_t"
+.LASF2062:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1506:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2516:
+	.string	"saveConfigAndNotify"
+.LASF1054:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF2074:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF928:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1678:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1624:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1741:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF1238:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1380:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2154:
+	.string	"BOXHORIZON"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2235:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1879:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2297:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF2109:
+	.string	"pidSumLimit"
+.LASF2116:
+	.string	"horizon_tilt_effect"
+.LASF1549:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1934:
+	.string	"timeDelta_t"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1761:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2300:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1875:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF1422:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1276:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2338:
+	.string	"averageSystemLoadPercent"
+.LASF1597:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2099:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2104:
+	.string	"dterm_lpf_hz"
+.LASF1521:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"rx_spi_rf_channel_count"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2086:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1986:
+	.string	"SENSOR_BARO"
+.LASF1320:
+	.string	"LED2_TOGGLE NOOP"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1598:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2424:
+	.string	"airmodeWasActivated"
+.LASF2168:
+	.string	"BOXLLIGHTS"
+.LASF1378:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF2044:
+	.string	"OWNER_SONAR_ECHO"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1869:
+	.string	"PIDSUM_LIMIT 500"
+.LASF1936:
+	.string	"timeUs_t"
+.LASF1638:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2083:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1824:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2310:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1014:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1058:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1997:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2483:
+	.string	"updateAdjustmentStates"
+.LASF2279:
+	.string	"gpsSolutionData_s"
+.LASF966:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2032:
+	.string	"OWNER_SERVO"
+.LASF978:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1004:
+	.string	"PG_IMU_CONFIG 22"
+.LASF793:
+	.string	"ACC "
+.LASF1266:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1089:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2502:
+	.string	"beeper"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF2246:
+	.string	"flightModeFlags_e"
+.LASF2540:
+	.string	"updateArmingStatus"
+.LASF738:
+	.string	"USE_PWM "
+.LASF2255:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1668:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF2265:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1767:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1688:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2541:
+	.string	"resetArmingDisabled"
+.LASF1395:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1483:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1712:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2291:
+	.string	"sbus_inversion"
+.LASF1913:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF918:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1827:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1291:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ARCITIMER 4500"
+.LASF1177:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF922:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1296:
+	.string	"TRANSPONDER_GAP_TOGGLES_ILAP 1"
+.LASF1887:
+	.string	"AIRMODE_THOTTLE_THRESHOLD 1350"
+.LASF939:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2504:
+	.string	"isGyroCalibrationComplete"
+.LASF2389:
+	.string	"MIXER_ATAIL4"
+.LASF2381:
+	.string	"MIXER_AIRPLANE"
+.LASF1962:
+	.string	"CW0_DEG"
+.LASF1979:
+	.string	"roll"
+.LASF2465:
+	.string	"mixTable"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2303:
+	.string	"midrc"
+.LASF820:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF1981:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1810:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1894:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1613:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2107:
+	.string	"dterm_notch_cutoff"
+.LASF1865:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1918:
+	.string	"DEBUG_NOTCH"
+.LASF1896:
+	.string	"__uint16_t"
+.LASF1211:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2031:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1575:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1725:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1430:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF953:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1156:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1848:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2058:
+	.string	"OWNER_RX_SPI_CS"
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1224:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF1965:
+	.string	"CW270_DEG"
+.LASF2012:
+	.string	"gyro_lpf"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2346:
+	.string	"gpsNoFixLatitude"
+.LASF1729:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1310:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ERLT 22500"
+.LASF2492:
+	.string	"failsafeStartMonitoring"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1242:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2125:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2479:
+	.string	"disableFlightMode"
+.LASF2095:
+	.string	"FEATURE_AIRMODE"
+.LASF2293:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF1301:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ILAP 4500"
+.LASF1681:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1796:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF1530:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2341:
+	.string	"frskyGpsCoordFormat_e"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF943:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1480:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1159:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF2202:
+	.string	"THROTTLE_LOW"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1735:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1975:
+	.string	"SENSOR_INDEX_BARO"
+.LASF915:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1974:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1989:
+	.string	"SENSOR_GPS"
+.LASF934:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1476:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"_PTHREAD_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1838:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF2354:
+	.string	"hottAlarmSoundInterval"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1858:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1209:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF963:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2394:
+	.string	"mixerConfig_s"
+.LASF1546:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1059:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF2236:
+	.string	"HORIZON_MODE"
+.LASF1267:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1364:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1888:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2078:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1205:
+	.string	"_BITS_TIME_H 1"
+.LASF2451:
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+.LASF2077:
+	.string	"FEATURE_RX_SERIAL"
+.LASF2542:
+	.string	"updateInflightCalibrationState"
+.LASF1072:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1533:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1332:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF1570:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2413:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF2139:
+	.string	"rcYawExpo8"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF777:
+	.string	"USE_NAV "
+.LASF1015:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2268:
+	.string	"BEEPER_READY_BEEP"
+.LASF364:
+	.string	"__k8 1"
+.LASF2294:
+	.string	"rx_spi_id"
+.LASF998:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF1751:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1907:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF993:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2552:
+	.string	"armingConfig"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2130:
+	.string	"currentPidProfile"
+.LASF1189:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1534:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1099:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2245:
+	.string	"FAILSAFE_MODE"
+.LASF795:
+	.string	"GYRO "
+.LASF2304:
+	.string	"mincheck"
+.LASF1049:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1323:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2466:
+	.string	"pidController"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1452:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF1341:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1235:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF2169:
+	.string	"BOXCALIB"
+.LASF1948:
+	.string	"pgRegistry_s"
+.LASF1947:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF2080:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF910:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1742:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1103:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1928:
+	.string	"DEBUG_ALTITUDE"
+.LASF1263:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1961:
+	.string	"ALIGN_DEFAULT"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF935:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1030:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2165:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1102:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF1258:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1086:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF2511:
+	.string	"isArmingDisabled"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1694:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2070:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF749:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1766:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2336:
+	.string	"TASK_SELF"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1143:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1311:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ERLT 5000"
+.LASF2194:
+	.string	"AUX1"
+.LASF2195:
+	.string	"AUX2"
+.LASF2196:
+	.string	"AUX3"
+.LASF2197:
+	.string	"AUX4"
+.LASF2198:
+	.string	"AUX5"
+.LASF2199:
+	.string	"AUX6"
+.LASF2200:
+	.string	"AUX7"
+.LASF2201:
+	.string	"AUX8"
+.LASF1000:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2101:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2305:
+	.string	"maxcheck"
+.LASF1333:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2264:
+	.string	"BEEPER_RX_SET"
+.LASF1219:
+	.string	"__clock_t_defined 1"
+.LASF1467:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2260:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2211:
+	.string	"yaw_control_reversed"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF902:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1284:
+	.string	"TRANSPONDER_DATA_LENGTH_ARCITIMER 9"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2390:
+	.string	"MIXER_CUSTOM"
+.LASF2053:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1118:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2506:
+	.string	"isBaroCalibrationComplete"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1255:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1839:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1630:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2526:
+	.string	"currentDeltaTime"
+.LASF1771:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF972:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF2254:
+	.string	"BEEPER_SILENCE"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2326:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2273:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1835:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF1028:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1445:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2117:
+	.string	"horizon_tilt_expert_mode"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1569:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1383:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF950:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1922:
+	.string	"DEBUG_ANGLERATE"
+.LASF1495:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1294:
+	.string	"TRANSPONDER_DATA_LENGTH_ILAP 6"
+.LASF2190:
+	.string	"boxId_e"
+.LASF1938:
+	.string	"PGR_PGN_MASK"
+.LASF1775:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF2175:
+	.string	"BOXSERVO1"
+.LASF2176:
+	.string	"BOXSERVO2"
+.LASF2177:
+	.string	"BOXSERVO3"
+.LASF1152:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1737:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1292:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ARCITIMER 10000"
+.LASF2097:
+	.string	"FEATURE_RX_SPI"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1249:
+	.string	"____sigset_t_defined "
+.LASF2470:
+	.string	"gyroSampleCount"
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1170:
+	.string	"_SCHED_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2454:
+	.string	"AccInflightCalibrationMeasurementDone"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1633:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1090:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1908:
+	.string	"debug"
+.LASF1852:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1076:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF1716:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2345:
+	.string	"telemetryConfig_s"
+.LASF2357:
+	.string	"telemetryConfig_t"
+.LASF1277:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1370:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2231:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1746:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1097:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2337:
+	.string	"cfTaskId_e"
+.LASF2524:
+	.string	"startTime"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1680:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1935:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2237:
+	.string	"MAG_MODE"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1797:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1081:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1396:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1828:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF2204:
+	.string	"throttleStatus_e"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1857:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF2477:
+	.string	"releaseSharedTelemetryPorts"
+.LASF2063:
+	.string	"OWNER_USB_DETECT"
+.LASF1384:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1837:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1135:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1338:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1122:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1943:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF2299:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1040:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2238:
+	.string	"BARO_MODE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2313:
+	.string	"rx_max_usec"
+.LASF933:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1710:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2276:
+	.string	"beeperMode_e"
+.LASF1093:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1425:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1144:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2445:
+	.string	"channelForwardingStartChannel"
+.LASF2145:
+	.string	"headFreeModeHold"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2353:
+	.string	"frsky_vfas_cell_voltage"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF973:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2356:
+	.string	"report_cell_voltage"
+.LASF1293:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ILAP 10"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2388:
+	.string	"MIXER_SINGLECOPTER"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2144:
+	.string	"isRXDataNew"
+.LASF2090:
+	.string	"FEATURE_DASHBOARD"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1833:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1304:
+	.string	"ERLTBitQuiet 0"
+.LASF1925:
+	.string	"DEBUG_STACK"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2067:
+	.string	"OWNER_INVERTER"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF1870:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1215:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1820:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1880:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2048:
+	.string	"OWNER_SPI_MOSI"
+.LASF1687:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1942:
+	.string	"pgResetFunc"
+.LASF2022:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF1362:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1903:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2342:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF2355:
+	.string	"pidValuesAsTelemetry"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1676:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2013:
+	.string	"gyro_soft_lpf_type"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1239:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF970:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2230:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1408:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1976:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2481:
+	.string	"failsafeIsActive"
+.LASF1516:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF1523:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF2220:
+	.string	"ARMED"
+.LASF1034:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1120:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2414:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF2192:
+	.string	"PITCH"
+.LASF1558:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF945:
+	.string	"VERY_FAST_MATH "
+.LASF2378:
+	.string	"MIXER_OCTOX8"
+.LASF819:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2319:
+	.string	"TASK_ACCEL"
+.LASF2399:
+	.string	"PID_PITCH"
+.LASF2352:
+	.string	"frsky_vfas_precision"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1616:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2453:
+	.string	"AccInflightCalibrationArmed"
+.LASF1288:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ARCITIMER 155 * TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER"
+.LASF1121:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1067:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1539:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1882:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1471:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2076:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2267:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1200:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1212:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF1492:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1295:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ILAP 11"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF2233:
+	.string	"ARMING_DISABLED_BST"
+.LASF2543:
+	.string	"isCalibrating"
+.LASF2023:
+	.string	"dyn_notch_window"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2365:
+	.string	"servoDevConfig_t"
+.LASF756:
+	.string	"CMS "
+.LASF2508:
+	.string	"warningLedUpdate"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1409:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2060:
+	.string	"OWNER_MPU_EXTI"
+.LASF1753:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1194:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2395:
+	.string	"yaw_motors_reversed"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1353:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF2459:
+	.string	"processRcCommand"
+.LASF2030:
+	.string	"OWNER_PPMINPUT"
+.LASF1960:
+	.string	"ioTag_t"
+.LASF2363:
+	.string	"servoPwmRate"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF2392:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF2114:
+	.string	"levelAngleLimit"
+.LASF1453:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"LED1_TOGGLE NOOP"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1069:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1187:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF909:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1700:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1854:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF1018:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF1643:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2433:
+	.string	"INPUT_RC_THROTTLE"
+.LASF2287:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1650:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1282:
+	.string	"GYRO_LPF_NONE 7"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2409:
+	.string	"PID_STABILISATION_OFF"
+.LASF1269:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2458:
+	.string	"updateGpsStateForHomeAndHoldMode"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1658:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2449:
+	.string	"disarmAt"
+.LASF2369:
+	.string	"MIXER_QUADP"
+.LASF1218:
+	.string	"TIMER_ABSTIME 1"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1778:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1470:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF2370:
+	.string	"MIXER_QUADX"
+.LASF1507:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1811:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2505:
+	.string	"isAccelerationCalibrationComplete"
+.LASF1044:
+	.string	"PG_OSD_CONFIG 501"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2301:
+	.string	"rssi_scale"
+.LASF1008:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1861:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2534:
+	.string	"canUseHorizonMode"
+.LASF925:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2135:
+	.string	"thrMid8"
+.LASF1013:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1077:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF2462:
+	.string	"updateRcCommands"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF2340:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2405:
+	.string	"PID_LEVEL"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1175:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2183:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1722:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2223:
+	.string	"ARMING_DISABLED_NO_GYRO"
+.LASF1057:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2368:
+	.string	"MIXER_TRI"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF1617:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1744:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1599:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2556:
+	.string	"accelerometerConfigMutable"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1662:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2306:
+	.string	"rcInterpolation"
+.LASF2415:
+	.string	"pidCrashRecovery_e"
+.LASF1915:
+	.string	"DEBUG_MIXER"
+.LASF1387:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1482:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2181:
+	.string	"BOX3DDISABLE"
+.LASF1071:
+	.string	"IO_TAG_NONE 0"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF919:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2093:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1752:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1860:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1281:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2486:
+	.string	"beeperSilence"
+.LASF1398:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2431:
+	.string	"INPUT_RC_PITCH"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF1357:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1298:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ILAP ((TRANSPONDER_TOGGLES_PER_BIT_ILAP + 1) * TRANSPONDER_BITS_PER_BYTE_ILAP * TRANSPONDER_DATA_LENGTH_ILAP)"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1083:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1055:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1985:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF2444:
+	.string	"tri_unarmed_servo"
+.LASF1665:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2043:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1183:
+	.string	"SCHED_OTHER 0"
+.LASF1944:
+	.string	"address"
+.LASF957:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1656:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2529:
+	.string	"subTaskPidController"
+.LASF1542:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1602:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1504:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1488:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1749:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1435:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1094:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF1978:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1047:
+	.string	"PG_PID_CONFIG 504"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2461:
+	.string	"applyAltHold"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF2152:
+	.string	"BOXARM"
+.LASF1782:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF2497:
+	.string	"getArmingDisableFlags"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1489:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2427:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF907:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2248:
+	.string	"GPS_FIX_HOME"
+.LASF1182:
+	.string	"_BITS_SCHED_H 1"
+.LASF2096:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2133:
+	.string	"rcYawRate8"
+.LASF1980:
+	.string	"pitch"
+.LASF2045:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2158:
+	.string	"BOXHEADFREE"
+.LASF1443:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF2244:
+	.string	"SONAR_MODE"
+.LASF2460:
+	.string	"resetYawAxis"
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2307:
+	.string	"rcInterpolationChannels"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2402:
+	.string	"PID_POS"
+.LASF1237:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2123:
+	.string	"rateAccelLimit"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2102:
+	.string	"pidProfile_s"
+.LASF2418:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1104:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1691:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1032:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1701:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2512:
+	.string	"calculateThrottleStatus"
+.LASF2213:
+	.string	"rcControlsConfig_System"
+.LASF2148:
+	.string	"throttle_correction_value"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2222:
+	.string	"armingFlags"
+.LASF1654:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1770:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1531:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1941:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1805:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF990:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1696:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2153:
+	.string	"BOXANGLE"
+.LASF1765:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1660:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF1912:
+	.string	"DEBUG_BATTERY"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1464:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF913:
+	.string	"UNIT_TESTED "
+.LASF2499:
+	.string	"feature"
+.LASF2364:
+	.string	"ioTags"
+.LASF1596:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2283:
+	.string	"groundCourse"
+.LASF1279:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1585:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1331:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2098:
+	.string	"FEATURE_SOFTSPI"
+.LASF1420:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1779:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF1145:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1232:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1308:
+	.string	"TRANSPONDER_TIMER_MHZ_ERLT 18"
+.LASF2270:
+	.string	"BEEPER_ARMED"
+.LASF931:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2559:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1734:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF984:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2225:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1091:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF923:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF1983:
+	.string	"flightDynamicsTrims_t"
+.LASF1993:
+	.string	"flightDynamicsTrims_u"
+.LASF1307:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ERLT 200"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1385:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1065:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2455:
+	.string	"AccInflightCalibrationSavetoEEProm"
+.LASF2371:
+	.string	"MIXER_BICOPTER"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2111:
+	.string	"dterm_average_count"
+.LASF2456:
+	.string	"AccInflightCalibrationActive"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1498:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1674:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"TRANSPONDER_PROVIDER_COUNT 3"
+.LASF2535:
+	.string	"updateMagHold"
+.LASF1236:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF2411:
+	.string	"pidStabilisationState_e"
+.LASF1112:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF2536:
+	.string	"tryArm"
+.LASF1261:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1763:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF2027:
+	.string	"cliMode"
+.LASF1509:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2530:
+	.string	"processRx"
+.LASF1605:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1324:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1226:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2112:
+	.string	"vbatPidCompensation"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1319:
+	.string	"LED1_ON NOOP"
+.LASF1221:
+	.string	"__clockid_t_defined 1"
+.LASF2142:
+	.string	"currentControlRateProfile"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2443:
+	.string	"servo_lowpass_freq"
+.LASF2557:
+	.string	"accelerometerConfig"
+.LASF2249:
+	.string	"GPS_FIX"
+.LASF2316:
+	.string	"TASK_SYSTEM"
+.LASF1322:
+	.string	"LED2_ON NOOP"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2205:
+	.string	"rcCommand"
+.LASF2320:
+	.string	"TASK_ATTITUDE"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1233:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2170:
+	.string	"BOXGOV"
+.LASF2274:
+	.string	"BEEPER_ALL"
+.LASF737:
+	.string	"USE_PPM "
+.LASF1416:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1376:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2509:
+	.string	"warningLedDisable"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2240:
+	.string	"GPS_HOLD_MODE"
+.LASF1155:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1128:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2550:
+	.string	"telemetryConfig"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2221:
+	.string	"WAS_EVER_ARMED"
+.LASF1518:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1946:
+	.string	"reset"
+.LASF2384:
+	.string	"MIXER_VTAIL4"
+.LASF967:
+	.string	"STR_HELPER(x) #x"
+.LASF2147:
+	.string	"throttle_correction_angle"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF991:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF952:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1125:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2262:
+	.string	"BEEPER_BAT_LOW"
+.LASF960:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF847:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2241:
+	.string	"HEADFREE_MODE"
+.LASF2051:
+	.string	"OWNER_SDCARD"
+.LASF2009:
+	.string	"gyro_align"
+.LASF2428:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF2434:
+	.string	"INPUT_RC_AUX1"
+.LASF2435:
+	.string	"INPUT_RC_AUX2"
+.LASF2436:
+	.string	"INPUT_RC_AUX3"
+.LASF2437:
+	.string	"INPUT_RC_AUX4"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1031:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1168:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2525:
+	.string	"previousMotorUpdateTime"
+.LASF2480:
+	.string	"enableFlightMode"
+.LASF721:
+	.string	"NULL"
+.LASF1901:
+	.string	"int16_t"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1705:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"ERLTCyclesForZeroBit 10"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2386:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF1889:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1892:
+	.string	"signed char"
+.LASF917:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1910:
+	.string	"DEBUG_NONE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1259:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1885:
+	.string	"VTX_IF_READY "
+.LASF1953:
+	.string	"on_motor_test"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF2396:
+	.string	"mixerConfig_t"
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF1648:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF999:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1759:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2000:
+	.string	"accZero"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2317:
+	.string	"TASK_GYROPID"
+.LASF1171:
+	.string	"__time_t_defined 1"
+.LASF2361:
+	.string	"servoDevConfig_s"
+.LASF2088:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2251:
+	.string	"SMALL_ANGLE"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF942:
+	.string	"sq(x) ((x)*(x))"
+.LASF1576:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF980:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1611:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1760:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1246:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1816:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2258:
+	.string	"BEEPER_DISARMING"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1629:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF2015:
+	.string	"gyro_isr_update"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1399:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1459:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1818:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1225:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2160:
+	.string	"BOXCAMSTAB"
+.LASF1309:
+	.string	"TRANSPONDER_CARRIER_HZ_ERLT 38000"
+.LASF1379:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2333:
+	.string	"TASK_RCSPLIT"
+.LASF1346:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1142:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1717:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2272:
+	.string	"BEEPER_USB"
+.LASF1750:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1007:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1987:
+	.string	"SENSOR_MAG"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1230:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2423:
+	.string	"SystemCoreClock"
+.LASF2532:
+	.string	"airmodeIsActivated"
+.LASF1554:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2180:
+	.string	"BOXAIRMODE"
+.LASF1996:
+	.string	"accelerometerConfig_s"
+.LASF2002:
+	.string	"accelerometerConfig_t"
+.LASF2290:
+	.string	"serialrx_provider"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1011:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1784:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF2544:
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2143:
+	.string	"magHold"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2375:
+	.string	"MIXER_FLYING_WING"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF748:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1273:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF1286:
+	.string	"TRANSPONDER_GAP_TOGGLES_ARCITIMER 0"
+.LASF1745:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1066:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1456:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1262:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2503:
+	.string	"blackboxFinish"
+.LASF1257:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1703:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1939:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF997:
+	.string	"PG_PID_PROFILE 14"
+.LASF1669:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1016:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1134:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1050:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2019:
+	.string	"gyro_soft_notch_hz_1"
+.LASF2021:
+	.string	"gyro_soft_notch_hz_2"
+.LASF1371:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1768:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2533:
+	.string	"throttleStatus"
+.LASF2234:
+	.string	"armingDisableFlags_e"
+.LASF1351:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1084:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1386:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2347:
+	.string	"gpsNoFixLongitude"
+.LASF2376:
+	.string	"MIXER_Y4"
+.LASF2373:
+	.string	"MIXER_Y6"
+.LASF1747:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1873:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF936:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2119:
+	.string	"itermAcceleratorGain"
+.LASF1808:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2127:
+	.string	"crash_recovery_angle"
+.LASF2404:
+	.string	"PID_NAVR"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1572:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2485:
+	.string	"processRcStickPositions"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1500:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF903:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1740:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1377:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1545:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1147:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1063:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1172:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF2091:
+	.string	"FEATURE_OSD"
+.LASF1326:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1813:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1945:
+	.string	"copy"
+.LASF776:
+	.string	"GPS "
+.LASF1327:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF994:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF982:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2349:
+	.string	"telemetry_inverted"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2253:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2332:
+	.string	"TASK_BLACKBOX"
+.LASF1358:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1785:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF1010:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2558:
+	.string	"blackboxConfig"
+.LASF1783:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF1899:
+	.string	"long int"
+.LASF2185:
+	.string	"BOXCAMERA2"
+.LASF2186:
+	.string	"BOXCAMERA3"
+.LASF1003:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1477:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1543:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1872:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2478:
+	.string	"updateGpsWaypointsAndMode"
+.LASF1369:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF380:
+	.string	"__unix 1"
+.LASF2383:
+	.string	"MIXER_HELI_90_DEG"
+.LASF954:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1280:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2041:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2379:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1692:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"SCHED_FIFO 1"
+.LASF2380:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2129:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1198:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1814:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1462:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2171:
+	.string	"BOXOSD"
+.LASF2350:
+	.string	"frsky_coordinate_format"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1998:
+	.string	"acc_align"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF1924:
+	.string	"DEBUG_SCHEDULER"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1061:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1419:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"SENSOR_GPSMAG"
+.LASF1432:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"__timer_t_defined 1"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF1804:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1197:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1220:
+	.string	"__struct_tm_defined 1"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1213:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1557:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2173:
+	.string	"BOXGTUNE"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1591:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2322:
+	.string	"TASK_SERIAL"
+.LASF1389:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1251:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1105:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF969:
+	.string	"EXPAND_I(x) x"
+.LASF932:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF2484:
+	.string	"updateActivatedModes"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1278:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1999:
+	.string	"acc_hardware"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2472:
+	.string	"gyroUpdate"
+.LASF1859:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1905:
+	.string	"uint32_t"
+.LASF1166:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2281:
+	.string	"GPS_altitude"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF2362:
+	.string	"servoCenterPulse"
+.LASF1355:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1666:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF2156:
+	.string	"BOXANTIGRAVITY"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1566:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1754:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2224:
+	.string	"ARMING_DISABLED_FAILSAFE"
+.LASF1423:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1952:
+	.string	"device"
+.LASF2219:
+	.string	"armingConfig_System"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1256:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1675:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1250:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2500:
+	.string	"millis"
+.LASF2035:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2163:
+	.string	"BOXGPSHOLD"
+.LASF1029:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1868:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF2214:
+	.string	"armingConfig_s"
+.LASF2218:
+	.string	"armingConfig_t"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1302:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ILAP 10000"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2482:
+	.string	"processRcAdjustments"
+.LASF2229:
+	.string	"ARMING_DISABLED_CALIBRATING"
+.LASF1204:
+	.string	"_TIME_H 1"
+.LASF1582:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2178:
+	.string	"BOXBLACKBOX"
+.LASF2282:
+	.string	"groundSpeed"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF1891:
+	.string	"long unsigned int"
+.LASF1210:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF2179:
+	.string	"BOXFAILSAFE"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2513:
+	.string	"unsetArmingDisabled"
+.LASF2159:
+	.string	"BOXHEADADJ"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1026:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1909:
+	.string	"debugMode"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF1951:
+	.string	"rate_denom"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF986:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1139:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF2212:
+	.string	"rcControlsConfig_t"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2321:
+	.string	"TASK_RX"
+.LASF2008:
+	.string	"gyroConfig_s"
+.LASF2025:
+	.string	"gyroConfig_t"
+.LASF1167:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2162:
+	.string	"BOXGPSHOME"
+.LASF2110:
+	.string	"pidSumLimitYaw"
+.LASF2042:
+	.string	"OWNER_TIMER"
+.LASF1446:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1789:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1027:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1846:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1671:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF2334:
+	.string	"TASK_COUNT"
+.LASF2121:
+	.string	"dtermSetpointWeight"
+.LASF1339:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1290:
+	.string	"TRANSPONDER_CARRIER_HZ_ARCITIMER 41886"
+.LASF1600:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF1486:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1659:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1799:
+	.string	"LAT 0"
+.LASF1079:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF989:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1900:
+	.string	"char"
+.LASF1231:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1815:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2134:
+	.string	"rcExpo8"
+.LASF1075:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2124:
+	.string	"crash_dthreshold"
+.LASF2318:
+	.string	"TASK_PID"
+.LASF1832:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1297:
+	.string	"TRANSPONDER_TOGGLES_ILAP (TRANSPONDER_TOGGLES_PER_BIT_ILAP + TRANSPONDER_GAP_TOGGLES_ILAP)"
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF1581:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1342:
+	.string	"IOCFG_AF_PP 0"
+.LASF1755:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2003:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2166:
+	.string	"BOXLEDMAX"
+.LASF2137:
+	.string	"rates"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF2546:
+	.string	"pidUpdateSampleCount"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1100:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1070:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1491:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2115:
+	.string	"levelSensitivity"
+.LASF2054:
+	.string	"OWNER_FLASH_CS"
+.LASF1248:
+	.string	"_BITS_SETJMP_H 1"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF1560:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF962:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1127:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1392:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1468:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1738:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1809:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2507:
+	.string	"sensors"
+.LASF2228:
+	.string	"ARMING_DISABLED_LOAD"
+.LASF1136:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2155:
+	.string	"BOXBARO"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2024:
+	.string	"dyn_notch_peaks"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1330:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1917:
+	.string	"DEBUG_PIDLOOP"
+.LASF1314:
+	.string	"LED0_TOGGLE NOOP"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF908:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1929:
+	.string	"DEBUG_FFT"
+.LASF1821:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF2447:
+	.string	"servoConfig_System"
+.LASF1101:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1856:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2191:
+	.string	"ROLL"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF2475:
+	.string	"mspSerialAllocatePorts"
+.LASF1850:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF1313:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF1305:
+	.string	"ERLTCyclesForOneBit 25"
+.LASF1732:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF905:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF929:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1019:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2398:
+	.string	"PID_ROLL"
+.LASF1321:
+	.string	"LED2_OFF NOOP"
+.LASF2358:
+	.string	"telemetryConfig_System"
+.LASF1229:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1968:
+	.string	"CW180_DEG_FLIP"
+.LASF2549:
+	.string	"mixerConfig"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2239:
+	.string	"GPS_HOME_MODE"
+.LASF1245:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1512:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1217:
+	.string	"CLOCK_TAI 11"
+.LASF2079:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1773:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2487:
+	.string	"isUsingSticksForArming"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2046:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF911:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2085:
+	.string	"FEATURE_3D"
+.LASF1623:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2328:
+	.string	"TASK_COMPASS"
+.LASF1522:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1769:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2426:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1561:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"CLOCK_REALTIME 0"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2323:
+	.string	"TASK_DISPATCH"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1434:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF2271:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2432:
+	.string	"INPUT_RC_YAW"
+.LASF2489:
+	.string	"pidResetErrorGyroState"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1227:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2446:
+	.string	"servoConfig_t"
+.LASF1639:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF2440:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF377:
+	.string	"__linux 1"
+.LASF1667:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1603:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2256:
+	.string	"BEEPER_RX_LOST"
+.LASF1140:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF2146:
+	.string	"throttleCorrectionConfig_s"
+.LASF2149:
+	.string	"throttleCorrectionConfig_t"
+.LASF2128:
+	.string	"crash_recovery_rate"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2343:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1876:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF2150:
+	.string	"throttleCorrectionConfig_System"
+.LASF1519:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1921:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF1510:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1234:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF2393:
+	.string	"MIXER_QUADX_1234"
+.LASF1243:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1963:
+	.string	"CW90_DEG"
+.LASF1626:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"NOOP do {} while (0)"
+.LASF1223:
+	.string	"__itimerspec_defined 1"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1698:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1677:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1970:
+	.string	"sensor_align_e"
+.LASF1644:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2457:
+	.string	"InflightcalibratingA"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1631:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1720:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"rollAndPitchTrims_t_def"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1551:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1863:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1627:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1001:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1916:
+	.string	"DEBUG_AIRMODE"
+.LASF1178:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1095:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF2387:
+	.string	"MIXER_DUALCOPTER"
+.LASF2172:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1881:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1455:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF974:
+	.string	"PP_IIF_1(t,f) t"
+.LASF927:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF981:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1911:
+	.string	"DEBUG_CYCLETIME"
+.LASF1926:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1825:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2280:
+	.string	"numSat"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1048:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1614:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1906:
+	.string	"double"
+.LASF1359:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1390:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"gyro_use_32khz"
+.LASF1107:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2339:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1843:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF977:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1444:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2232:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF2049:
+	.string	"OWNER_I2C_SCL"
+.LASF2047:
+	.string	"OWNER_SPI_MISO"
+.LASF1375:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1959:
+	.string	"blackboxConfig_System"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2071:
+	.string	"OWNER_COMPASS_CS"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF1842:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF1525:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1137:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1179:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF987:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2087:
+	.string	"FEATURE_RX_MSP"
+.LASF2325:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF2106:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2308:
+	.string	"rcInterpolationInterval"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2366:
+	.string	"rc_alias"
+.LASF1272:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2081:
+	.string	"FEATURE_GPS"
+.LASF2108:
+	.string	"itermWindupPointPercent"
+.LASF1689:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2206:
+	.string	"rcControlsConfig_s"
+.LASF1957:
+	.string	"mode_profile"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1064:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2189:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1897:
+	.string	"__int32_t"
+.LASF2551:
+	.string	"rxConfig"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2050:
+	.string	"OWNER_I2C_SDA"
+.LASF1834:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1898:
+	.string	"__uint32_t"
+.LASF2209:
+	.string	"alt_hold_deadband"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1133:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1113:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1336:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2089:
+	.string	"FEATURE_LED_STRIP"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2391:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF2329:
+	.string	"TASK_BARO"
+.LASF956:
+	.string	"Q12 (1 << 12)"
+.LASF2014:
+	.string	"gyro_soft_lpf_hz"
+.LASF1772:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF1798:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF2515:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2138:
+	.string	"dynThrPID"
+.LASF1411:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1672:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1670:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1431:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1368:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1006:
+	.string	"PG_RX_CONFIG 24"
+.LASF1033:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF921:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1840:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2528:
+	.string	"subTaskMainSubprocesses"
+.LASF2252:
+	.string	"FIXED_WING"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1060:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1552:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1438:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2522:
+	.string	"taskMainPidLoop"
+.LASF1180:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1303:
+	.string	"TRANSPONDER_DATA_LENGTH_ERLT 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF975:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1479:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1704:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1776:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF1618:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2330:
+	.string	"TASK_ALTITUDE"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1329:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1176:
+	.string	"__PDP_ENDIAN 3412"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2514:
+	.string	"setArmingDisabled"
+.LASF1356:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1374:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1723:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1647:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2344:
+	.string	"frskyUnit_e"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1593:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1817:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1708:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2439:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF1790:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2261:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1287:
+	.string	"TRANSPONDER_TOGGLES_ARCITIMER (TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER + TRANSPONDER_GAP_TOGGLES_ARCITIMER)"
+.LASF1009:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1966:
+	.string	"CW0_DEG_FLIP"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1316:
+	.string	"LED0_ON NOOP"
+.LASF1214:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2066:
+	.string	"OWNER_RX_BIND"
+.LASF1038:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF2519:
+	.string	"taskMainPidLoopCheck"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF1612:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2069:
+	.string	"OWNER_TRANSPONDER"
+.LASF1005:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1334:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF2422:
+	.string	"pidConfig_System"
+.LASF1132:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1165:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1849:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1458:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2510:
+	.string	"warningLedFlash"
+.LASF1124:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2247:
+	.string	"flightModeFlags"
+.LASF1404:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2296:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF2120:
+	.string	"setpointRelaxRatio"
+.LASF1524:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1707:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1791:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF1584:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"tpa_breakpoint"
+.LASF2367:
+	.string	"mixerMode"
+.LASF1190:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2182:
+	.string	"BOXFPVANGLEMIX"
+.LASF1191:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF1157:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1216:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1971:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1041:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF1138:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2010:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1867:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1608:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2056:
+	.string	"OWNER_MPU_CS"
+.LASF1937:
+	.string	"pgn_t"
+.LASF1052:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1265:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1812:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2452:
+	.string	"throttleCorrectionConfig_Registry"
+.LASF1111:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF846:
+	.string	"USE_I2C"
+.LASF2523:
+	.string	"taskGyro"
+.LASF1315:
+	.string	"LED0_OFF NOOP"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1800:
+	.string	"LON 1"
+.LASF1919:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF2266:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF2518:
+	.string	"sample"
+.LASF797:
+	.string	"MAG "
+.LASF2257:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1786:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2410:
+	.string	"PID_STABILISATION_ON"
+.LASF1609:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1991:
+	.string	"rollAndPitchTrims_s"
+.LASF1995:
+	.string	"rollAndPitchTrims_t"
+.LASF1994:
+	.string	"rollAndPitchTrims_u"
+.LASF1822:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2553:
+	.string	"rcControlsConfig"
+.LASF2113:
+	.string	"pidAtMinThrottle"
+.LASF2351:
+	.string	"frsky_unit"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1844:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1254:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2385:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2521:
+	.string	"currentDeltaTimeUs"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2011:
+	.string	"gyro_sync_denom"
+.LASF1074:
+	.string	"I2CDEV_COUNT 4"
+.LASF988:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2377:
+	.string	"MIXER_HEX6X"
+.LASF1743:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF951:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF2277:
+	.string	"gpsLocation_s"
+.LASF2278:
+	.string	"gpsLocation_t"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF983:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2403:
+	.string	"PID_POSR"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1536:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2335:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1501:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2538:
+	.string	"handleInflightCalibrationStickPosition"
+.LASF2226:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF1045:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF965:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF2028:
+	.string	"OWNER_FREE"
+.LASF2527:
+	.string	"subTaskMotorUpdate"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1126:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2103:
+	.string	"dterm_filter_type"
+.LASF1515:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2407:
+	.string	"PID_VEL"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1923:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1793:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF937:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2312:
+	.string	"rx_min_usec"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1098:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1373:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1426:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2029:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2495:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1268:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1275:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF2004:
+	.string	"gyroSample_s"
+.LASF2007:
+	.string	"gyroSample_t"
+.LASF1461:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2132:
+	.string	"rcRate8"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1733:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1109:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1513:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1106:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF912:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2442:
+	.string	"servoConfig_s"
+.LASF941:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1568:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1803:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1201:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1788:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1407:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1149:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1847:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1087:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1413:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1078:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2126:
+	.string	"crash_time"
+.LASF1684:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1588:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1366:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1711:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1573:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"PG_GPS_CONFIG 30"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1328:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1988:
+	.string	"SENSOR_SONAR"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1695:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1972:
+	.string	"long long int"
+.LASF2005:
+	.string	"timeUs"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1337:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1340:
+	.string	"IOCFG_OUT_PP 0"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1950:
+	.string	"rate_num"
+.LASF1914:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF1878:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF992:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2052:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1150:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1927:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF914:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1634:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF955:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2360:
+	.string	"attitude"
+.LASF1151:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2289:
+	.string	"rcmap"
+.LASF1984:
+	.string	"SENSOR_GYRO"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF2227:
+	.string	"ARMING_DISABLED_ANGLE"
+.LASF1130:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1864:
+	.string	"ALL_MOTORS 255"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2269:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1241:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF2020:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1360:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1153:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1693:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1579:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2537:
+	.string	"armingDisabledReason"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1253:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1792:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1161:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2187:
+	.string	"BOXDSHOTREVERSE"
+.LASF2469:
+	.string	"isMixerUsingServos"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2491:
+	.string	"failsafeUpdateState"
+.LASF1417:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1131:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF2210:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1053:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2073:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1777:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF1590:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1884:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF2539:
+	.string	"disarm"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1244:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2327:
+	.string	"TASK_GPS"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2203:
+	.string	"THROTTLE_HIGH"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1264:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1802:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1756:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2284:
+	.string	"hdop"
+.LASF2359:
+	.string	"attitudeEulerAngles_t"
+.LASF1348:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2068:
+	.string	"OWNER_LED_STRIP"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2406:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1801:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1823:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF2408:
+	.string	"PID_ITEM_COUNT"
+.LASF2517:
+	.string	"isMotorsReversed"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1724:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1270:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF2348:
+	.string	"telemetry_switch"
+.LASF920:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1715:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1977:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF392:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF996:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1023:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2122:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2498:
+	.string	"isFirstArmingGyroCalibrationRunning"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1154:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1853:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1410:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2215:
+	.string	"gyro_cal_on_first_arm"
+.LASF2105:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF2496:
+	.string	"beeperWarningBeeps"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF924:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1795:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF1349:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1806:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2401:
+	.string	"PID_ALT"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2331:
+	.string	"TASK_TELEMETRY"
+.LASF1877:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2055:
+	.string	"OWNER_BARO_CS"
+.LASF1528:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2430:
+	.string	"INPUT_RC_ROLL"
+.LASF1043:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF979:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF947:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2490:
+	.string	"isAirmodeActive"
+.LASF2311:
+	.string	"airModeActivateThreshold"
+.LASF1114:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1890:
+	.string	"unsigned int"
+.LASF1973:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF1046:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1726:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1949:
+	.string	"blackboxConfig_s"
+.LASF1958:
+	.string	"blackboxConfig_t"
+.LASF1719:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1883:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF2026:
+	.string	"gyroConfig_System"
+.LASF1826:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1350:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2545:
+	.string	"rollAndPitchTrimsDelta"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1931:
+	.string	"DEBUG_FFT_FREQ"
+.LASF1116:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2100:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1163:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1657:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1162:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2164:
+	.string	"BOXPASSTHRU"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1051:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1594:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2034:
+	.string	"OWNER_ADC"
+.LASF1895:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1199:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF2207:
+	.string	"deadband"
+.LASF2441:
+	.string	"inputSource_e"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1930:
+	.string	"DEBUG_FFT_TIME"
+.LASF1679:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2118:
+	.string	"itermThrottleThreshold"
+.LASF2161:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1956:
+	.string	"profile"
+.LASF1642:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1252:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2092:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF2243:
+	.string	"PASSTHRU_MODE"
+.LASF1954:
+	.string	"record_acc"
+.LASF959:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1393:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2494:
+	.string	"updateRSSI"
+.LASF2037:
+	.string	"OWNER_ADC_EXT"
+.LASF1062:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1697:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1042:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1871:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1964:
+	.string	"CW180_DEG"
+.LASF2473:
+	.string	"micros"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2057:
+	.string	"OWNER_OSD_CS"
+.LASF1829:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1683:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2416:
+	.string	"pid8_s"
+.LASF2417:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF2464:
+	.string	"writeServos"
+.LASF1563:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2554:
+	.string	"throttleCorrectionConfig"
+.LASF1474:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1345:
+	.string	"IOCFG_IPU 0"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1158:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1344:
+	.string	"IOCFG_IPD 0"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1699:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF971:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2698:
+	.string	"rx_pwm.h"
+.LASF2708:
+	.string	"asyncfatfs.h"
+.LASF2677:
+	.string	"thread-shared-types.h"
+.LASF2612:
+	.string	"pwm_output.h"
+.LASF2695:
+	.string	"boardalignment.h"
+.LASF2583:
+	.string	"/usr/include"
+.LASF2694:
+	.string	"voltage_ids.h"
+.LASF2668:
+	.string	"endianness.h"
+.LASF2629:
+	.string	"stdint.h"
+.LASF0:
+	.string	"./src/main/fc/fc_core.c"
+.LASF2619:
+	.string	"altitude.h"
+.LASF2561:
+	.string	"src/main/build"
+.LASF2580:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2624:
+	.string	"barometer.h"
+.LASF2628:
+	.string	"stdbool.h"
+.LASF2697:
+	.string	"flash.h"
+.LASF2589:
+	.string	"time.h"
+.LASF2633:
+	.string	"wordsize.h"
+.LASF2670:
+	.string	"cpu-set.h"
+.LASF2659:
+	.string	"bus.h"
+.LASF2616:
+	.string	"fc_core.c"
+.LASF2575:
+	.string	"src/main/target/SITL"
+.LASF2602:
+	.string	"fc_core.h"
+.LASF2704:
+	.string	"sound_beeper.h"
+.LASF2627:
+	.string	"stdc-predef.h"
+.LASF2686:
+	.string	"pthread_stack_min.h"
+.LASF2664:
+	.string	"sched.h"
+.LASF2655:
+	.string	"parameter_group_ids.h"
+.LASF2711:
+	.string	"vtx_control.h"
+.LASF2701:
+	.string	"io.h"
+.LASF2630:
+	.string	"libc-header-start.h"
+.LASF2674:
+	.string	"timer_t.h"
+.LASF2621:
+	.string	"failsafe.h"
+.LASF2618:
+	.string	"fc_rc.h"
+.LASF2646:
+	.string	"platform.h"
+.LASF2584:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2687:
+	.string	"transponder_ir.h"
+.LASF2565:
+	.string	"src/main/drivers/barometer"
+.LASF2591:
+	.string	"blackbox.h"
+.LASF2598:
+	.string	"resource.h"
+.LASF2679:
+	.string	"atomic_wide_counter.h"
+.LASF2615:
+	.string	"servos.h"
+.LASF2568:
+	.string	"src/main/flight"
+.LASF2611:
+	.string	"imu.h"
+.LASF2705:
+	.string	"vcd.h"
+.LASF2569:
+	.string	"src/main/io/asyncfatfs"
+.LASF2588:
+	.string	"debug.h"
+.LASF2703:
+	.string	"io_def_generated.h"
+.LASF2597:
+	.string	"cli.h"
+.LASF2657:
+	.string	"accgyro.h"
+.LASF2622:
+	.string	"rc_adjustments.h"
+.LASF2672:
+	.string	"struct_tm.h"
+.LASF2579:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2652:
+	.string	"filter.h"
+.LASF2702:
+	.string	"io_def.h"
+.LASF2571:
+	.string	"src/main/msp"
+.LASF2625:
+	.string	"statusindicator.h"
+.LASF2631:
+	.string	"features.h"
+.LASF2578:
+	.string	"src/main"
+.LASF2570:
+	.string	"src/main/io"
+.LASF2640:
+	.string	"time64.h"
+.LASF2682:
+	.string	"setjmp.h"
+.LASF2563:
+	.string	"src/main/config"
+.LASF2675:
+	.string	"struct_itimerspec.h"
+.LASF2632:
+	.string	"features-time64.h"
+.LASF2626:
+	.string	"strings.h"
+.LASF2623:
+	.string	"feature.h"
+.LASF2564:
+	.string	"src/main/drivers/accgyro"
+.LASF2606:
+	.string	"beeper.h"
+.LASF2681:
+	.string	"struct_rwlock.h"
+.LASF2605:
+	.string	"runtime_config.h"
+.LASF2599:
+	.string	"config.h"
+.LASF2637:
+	.string	"stubs.h"
+.LASF2596:
+	.string	"gyro.h"
+.LASF2642:
+	.string	"string.h"
+.LASF2614:
+	.string	"target.h"
+.LASF2676:
+	.string	"pthreadtypes.h"
+.LASF2610:
+	.string	"telemetry.h"
+.LASF2647:
+	.string	"common_fc_pre.h"
+.LASF2688:
+	.string	"light_led.h"
+.LASF2653:
+	.string	"maths.h"
+.LASF2620:
+	.string	"msp_serial.h"
+.LASF2641:
+	.string	"wchar.h"
+.LASF2634:
+	.string	"timesize.h"
+.LASF2562:
+	.string	"src/main/common"
+.LASF2693:
+	.string	"voltage.h"
+.LASF2608:
+	.string	"rx.h"
+.LASF2691:
+	.string	"current.h"
+.LASF2582:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2661:
+	.string	"rcc_types.h"
+.LASF2607:
+	.string	"gps.h"
+.LASF2665:
+	.string	"time_t.h"
+.LASF2595:
+	.string	"acceleration.h"
+.LASF2643:
+	.string	"stddef.h"
+.LASF2567:
+	.string	"src/main/fc"
+.LASF2660:
+	.string	"bus_i2c.h"
+.LASF2712:
+	.string	"timer.h"
+.LASF2638:
+	.string	"stubs-64.h"
+.LASF2699:
+	.string	"sdcard.h"
+.LASF2590:
+	.string	"parameter_group.h"
+.LASF2601:
+	.string	"controlrate_profile.h"
+.LASF2600:
+	.string	"pid.h"
+.LASF2573:
+	.string	"src/main/scheduler"
+.LASF2692:
+	.string	"current_ids.h"
+.LASF2669:
+	.string	"struct_sched_param.h"
+.LASF2613:
+	.string	"mixer.h"
+.LASF2658:
+	.string	"exti.h"
+.LASF2594:
+	.string	"sensors.h"
+.LASF2684:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2673:
+	.string	"clockid_t.h"
+.LASF2662:
+	.string	"accgyro_mpu.h"
+.LASF2709:
+	.string	"fat_standard.h"
+.LASF2603:
+	.string	"rc_modes.h"
+.LASF2587:
+	.string	"stdint-uintn.h"
+.LASF2667:
+	.string	"endian.h"
+.LASF2685:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2671:
+	.string	"clock_t.h"
+.LASF2609:
+	.string	"scheduler.h"
+.LASF2696:
+	.string	"adc.h"
+.LASF2636:
+	.string	"long-double.h"
+.LASF2604:
+	.string	"rc_controls.h"
+.LASF2690:
+	.string	"battery.h"
+.LASF2635:
+	.string	"cdefs.h"
+.LASF2683:
+	.string	"__sigset_t.h"
+.LASF2572:
+	.string	"src/main/rx"
+.LASF2639:
+	.string	"typesizes.h"
+.LASF2560:
+	.string	"src/main/blackbox"
+.LASF2706:
+	.string	"msp.h"
+.LASF2593:
+	.string	"sensor.h"
+.LASF2648:
+	.string	"common_fc_post.h"
+.LASF2644:
+	.string	"locale_t.h"
+.LASF2576:
+	.string	"src/main/target"
+.LASF2663:
+	.string	"pthread.h"
+.LASF2651:
+	.string	"axis.h"
+.LASF2689:
+	.string	"system.h"
+.LASF2566:
+	.string	"src/main/drivers"
+.LASF2700:
+	.string	"serial.h"
+.LASF2654:
+	.string	"utils.h"
+.LASF2650:
+	.string	"build_config.h"
+.LASF2666:
+	.string	"struct_timespec.h"
+.LASF2574:
+	.string	"src/main/sensors"
+.LASF2586:
+	.string	"stdint-intn.h"
+.LASF2707:
+	.string	"streambuf.h"
+.LASF2710:
+	.string	"motors.h"
+.LASF2645:
+	.string	"__locale_t.h"
+.LASF2585:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2680:
+	.string	"struct_mutex.h"
+.LASF2656:
+	.string	"gyro_sync.h"
+.LASF2577:
+	.string	"src/main/telemetry"
+.LASF2649:
+	.string	"blackbox_fielddefs.h"
+.LASF2678:
+	.string	"pthreadtypes-arch.h"
+.LASF2592:
+	.string	"io_types.h"
+.LASF2617:
+	.string	"navigation.h"
+.LASF2581:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`+\002u\016"
+	.string	"\224\022\037\003"
+	.string	"*"
+	.string	"\262\304\261\307\013\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\243\322\333\212\005\b\006\002\006\002\002\007\017\320\334\251\376\007\024\b\002\b\t\020\240\342\234\212\n\022\252\346\210\307\004\004\004\002\004\025\243\262\274\213\017"
+	.string	"\026\317\371\300\336\r\022\n\002\n\002\001\002\013\f\002\f\001\002\r\030\032\033\035\363\364\341\332\005"
+	.string	"\036\234\276\301\203\013\f\002\016\002\017\002\020\002\020\037\233\304\365\321\002\002 \214\233\312\236\001!\230\264\354\335\f\006\001\002\021#\333\311\367\353\b\013\f\002\f$\245\254\200\255\013\n%\317\300\260\312\002\026\002\022\002\023"
+	.string	"\002\024\t(*\263\347\363\371\006\034\001\002\025\002\001\002\026\002\001\002\027\002\002\007-.\365\212\251\307\tF\005\030\002\030\031/04\222\332\233\374\016\016\002\002\007\002\002\0075\231\263\215\253\f\032\002\001\002\0338\310\216\246\237\003\004\002\0349\350\300\306\254\005\002:;\202\321\330\342\013<\374\202\331\242\r=>?@A\240\342\234\212\n"
+	.string	"P\250\221\265\340\214\00453\013[X\306@\002\203T\331y\0208m\244\0264k\210!\003\265t5\346b\240\343M\027\002\\W\333%N\220\204v\234\303\231\002G\211k\312(\3131\254\225F\334\2569\375\310+\306#\250H\343\315\021F\231\002\254bZF\220\304=\241,"
+	.ascii	"\317\002\261\036\022\352\n#\3317k\202\330\\\025\210VX-?`\315"
+	.ascii	")\376\211<6CN\316g\327\300\226vS\004P>W\265\034\003V\b\033\363"
+	.ascii	"?^\226\303n\365&0h\322\264p\267\304t\001(B\363\276V\346i=p\336"
+	.ascii	"Zw\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\215\005"
+	.string	"R\206\022\033\240)\303\001\377?\374\377\3771u\366\325l\377\326&\377\366\277H\b!no\231R\036\037\357\230g\r\237\261/\024\233X\304a\r\205%\354\tJo\317\264\265=X\002\265\007\324\005,\216 \253H_UL\256\321#\243\312#\0010 p\0021y\363e-\370\026\f\t[\006\022\203F\036\240\245\272\204)\274A\025\007f7\300x\200\373\202\026\0248\264\013@\n\0046\324\b,\021"
+	.ascii	" \344\242\260`\347\360\230@\345\252\354\005\035\301\030\201b"
+	.ascii	"\320\270\004\342\253\3001n\275h\354\213\026!\006!a@;\224\022"
+	.ascii	"hKa\n\3562i\204w\024n\b"
+	.text
+	.section	.gnu.lto_.inline.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`j\006\375\024"
+	.string	"\306\230[F\340\224(\215\001\220\3644:\220>\022]+\024F\24785\305e\307\233\300\321iR\345dN\313lF}\002\223B\fa\200\004\376A=1\306{\334?\314\365\203h\224\365\260\032 )U\375\341\017\231\210\330-\345N\001E"
+	.string	"E"
+	.string	"L"
+	.ascii	"(\227\312\003H\252\237\244\212\177\311\207G\221\224\216\350E"
+	.ascii	"\017V\317hN@\276\250\212S\212e\222\017a\362\310\214\024\313\300"
+	.ascii	"\001 \374A\372\237\247K\356\356j_R\0273\330\t\n\371\320\244;"
+	.ascii	"\262\326\252\301\217\006`!\217!\323E\343(\333v\306\343\331\002"
+	.ascii	"W;\244\237$<\207\246|\355.\350\356\304\313\331\215\315\020\226"
+	.ascii	"\230\215\030\214\224\013t\330]\357KJbw?\217|\354n\227!?\354z"
+	.ascii	"\016\026A\016\246\270\0211bEk\350\004\253\006\225\331 ^\322\314"
+	.ascii	"\"\243\275I\211\350\310q\203C\214\366\240j`\357x\005\305\356"
+	.ascii	"V\310\327\222\002\331]\006/0a\261"
+	.string	"\353\205Vy\b\341$\025\214a\202\006\222\216G\206\020\027\312)\242\230\254\265*Y\301\313\22668d+\266\023\034K\200 \315\234\357\373\266\030\375\221b\241\b\204\"|\213\313W-\232\035n\b\373\302\231i\201 g\346d\344\300\017b\204\361x!yf\260\232\370v\213~\337\367\305\223\3660\232$\204\313C\226\210\177\227\020\007\304\013N\320\272\334p\006\200\211\250A\"\032!!I\nJi\016P\002A\250\312\350\001\022@\222T\001\021c\020SL9U2\"c\241>\303\030\036\311-\027RG\340rP\240\306y\327T\367\306)\261K^|\376\033J\0371\031fn&\024\0330RY\b\0217\346\277\265H\036\2458\245\321\017!\217Kn\232\377\3163N\213LZ\252;\034\303YN\323wI\234\027P\262\263\256\206\034\0366}\017Y\270\330\231\016(y4ZJ\305\353\340H\206\r\254X\374\363H\243n\021q"
+	.ascii	"\274\235\nF\250\377\275FhQ\270\346\315\001EI\246\013\363\221"
+	.ascii	"\356\344\025\245\253I\340Q4\335\370\177\215\220\340\300\030\201"
+	.ascii	"\242\n\337\371\032s\2366\201{ot\224M\376\235\341}\362\3473\257"
+	.ascii	"\235\303\265p\204\342\276\360!1\272)\347\232\222\251\270\357"
+	.ascii	"/s\373\004\302\005\023\211\323T#\237t\341\266=\302@\205\341\215"
+	.ascii	"j\351\360|\244q\003$\250C\213\337\255T\352\003\250\244P\250\302"
+	.ascii	"A\304\034\263\216\220\2449\005p\372\332\273\202\314\300\275\322"
+	.ascii	"\247\304B\357\307\331\343\355})\177\227\177\333\327\211{\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`d\005\245\021"
+	.string	"f\224A8PM\223\3410K\322\201\376\316\001\276!\013(\034\324'\366\326\265\310\314\230\201\346\007\231\231A\314\364pr\340\340\336\376\377\264\344\323\312\275Y\373f\311\226}b7\221&\223\f0"
+	.string	"3"
+	.string	"4"
+	.string	"\016Z\247\202=c\356\001o@\007\301u\372\202\243i\226hG\r\322Ub\3251\375\361}@P\273\363L\220C\330d\b\233\223\257\326\222\264\260%\bS\331\370\n\002\241\242\250\265\337\253\330X\316p\213a\026\006\313\232.L\223d\341V\222v\234+\334r.\227/\n\222WBJ\262,\313v\020\351\350 \367.\037n5W\353\260\303ai\270\232\207\373\3724\357U*_\256\361\003(I\022n\247\211j\237U\003 3\030\211`\220\002\266\246\032\247ZGp\201!i\221\026\f$\017L\341'\fUm\337"
+	.string	"\003\264\005(\224\035\203\326'0\342\316!&q&\323\332\r\277'\342Mky\265\177\376\264\3574\005\321\036a\016Q\024\200\245\250!iF5%I\241\322\034\220\002\021\252\252n\021p@\213 \032\252a\220\244\003\350\262\244\267#\2511q\002\213\314b\234\375\226\313U\034\315 \005\215\n\276Q\310*"
+	.string	"y/\005\024\236GF\234\3435\3761\031\020BMX\306\202\270\324\005H\366\335#mm\2236\001I\272-I\334Y\373[!)6Z \265\fE\324\033\323\277k\204\371\252"
+	.ascii	"\260\3455\013\356\240P8\025\261QC\373\036\"$Ej9\206\360\265\262"
+	.ascii	"w\337\316\224`\b\315M\240\311\315\346G\376\355\316\331\241\031"
+	.ascii	"\tB\242\b\301\242*R\243_O\"\216\317\001K\322m\006)[\315\324\245"
+	.ascii	"1 c\361\223\361:Z\246\213\006\250(\314\231/|\340=SB\016\0349"
+	.ascii	"D\246Bmn\247>\376##j\006\247uW\274C?7\f\322\313\\\t$j\225/\n"
+	.ascii	"\034\3511\227}\020\202\034\310sF\277\215@\020@\302P,B.\006\023"
+	.ascii	"#\020\203\241g#8-\266\325N\254\004\202b\26156\347\247\323\023"
+	.ascii	"\2477\361;\275\366\225\301\244\256\303\253\0250\021G\272\244"
+	.ascii	"\252r8\024"
+	.text
+	.section	.gnu.lto_.pureconst.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"B\204\r\026\240\2531\377s\362\265\252\252r09\310\305<IZ\372s\007\372dR\222U\344\220?\236\343\215\307\370\342\212'\216\370\341\031^8\341\313\007O\360\300\001\267efS"
+	.text
+	.section	.gnu.lto_.ipa_modref.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"u\005"
+	.string	"\362\206\023\031\200M\206\00330\0033\351=\374\207\264}\347\307\315n<\"d\246P\222)\252\224'\332\354\230\277a"
+	.ascii	".\327s\234\235\344\031\371\206\214\005\202<\205\022\346\262["
+	.ascii	"\236\017\017KxD\024\320\023=8\317\365\004j@=\325.=\323\353\f"
+	.ascii	"\256\022* \200\202\0313\363)\"1@~\344Xz<A\034\005\026MG!\002"
+	.ascii	"m\030\213\300\002]\357\214\270\276>\216\020\377|`\277\343\007"
+	.ascii	"\201\347q\317\022\223\310\255\270\303\260\027\006\355\230]\302"
+	.ascii	"\261]H\r\357v\342-\211`%\244\020\315\355\206*f\310\244\373\006"
+	.ascii	"s\032\304\271\nD\340A\024s\b"
+	.text
+	.section	.gnu.lto_.lto.b0db4eceedba0355,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.129.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375 \222=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\367\201\031\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\337\030us\355\007uq"
+	.string	"\005\001\006'\001\004'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/fc/fc_core.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.131.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_applyAndSaveAccelerometerTrimsDelta.132.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`R\002\225\020"
+	.string	"\366]jE\360\2244\034\350J1X\243V\\LS\240\277%\031><\255NdrS\246.\017<\272\231\306c\004\f$|\266\377Z@t\026D\233\362\314\233\233Y\345\361\037\n\274\230H\224\305\375\300ci\273\355n\"eJ\001Q"
+	.string	"K"
+	.string	"_"
+	.string	"E\366\206\263\235\260\375\220\375\300Uz\332G\361\024\255\323V.`Wv\243\331\255-\260\002\357\234k'\320\235\363N\322\235s\313\006\362\332l\017c\244%f\310\356~j\342\255g\313\277\212\177`1\226\247\007\302\356:a1\020\267\3366\002\333\025\354\264\005,V\376\3139wP\311\303\316\371*\335\271k\311\205\346\312\233S\346\326c\223\210]{\245\226\260\337\331\335\265\312\354\323~"
+	.string	"\231\026i:\244iP\246?\232\3662\355\311t\247iN\323\235L\253\2463\323\037"
+	.string	"\022\301\303\200\220\335\017\267#\233\217\202l\204\3671\253\3311\373\350}\270\320<\352\235^\303F\203\3063\023\353t\206\214\0300\016\013\302i\327\321TNG5\036H\274\362f\325\316\213\36089.T\236\314I\312mr^V\272s\252\307\371A\273\246\276\345\210\235\3411aifox\013U\211\305\303\244$\310\331\335\222\025\017>i`\302"
+	.string	"\345\300\304D\"1\261R'\t+U8Z\320"
+	.ascii	"\262B\n\030P\"\244R\342X\300 \3514\212\340\005\020\365\201\250"
+	.ascii	"\017%4\251>p\\}\244\221E\016\247\361c\211\342\370\205j\256wV"
+	.ascii	"e\2360\342\306\245/\007H\333\004\346a>\360R\026\347L\b\221\352"
+	.ascii	"\310\201\343FHE \3654\244\001. \320\002\231\222\353]ZP24\252"
+	.ascii	"\f,\214Q\367\265\264\025\306u0\207\370\017\020^g\030A\\\021L"
+	.ascii	"\262\325\333\241\265\334\rtc\3518\017\026%\005(\016\330\370b"
+	.ascii	"cq\034\016\326Z\\\314\005\363\202c\376\fF\276\033V2*Fq\215\t"
+	.ascii	"d\3034\f\336\b&B~\346\241d^#~\327)\300\313\2136\223\001"
+	.text
+	.section	.gnu.lto_isCalibrating.133.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\266\001]\017"
+	.string	"f\233bE"
+	.string	"\223\223\0163\367\223\366U\304\302/\217U*\330X\310\255\321l]5t{g`\177!&x*\310\314\017\263\226d\275\345\230\206\277<\020\270T\033"
+	.string	"\005Q\253?3\210H@\240\352\216\275\255\033\331\233l)S\nQ"
+	.string	"L"
+	.string	"O"
+	.string	"\357`2^p\225\363\273w$\b\253a\265\340\214P9\035\373\210\345\022E\n\213\247\321\304\323\313\363\231\224(\204\bD\320\254x\276\022\034P\203\004\216\333H9\351\n\370J\260\300\234\363\252\353\311GR\225\2409\247\325\364\251\334"
+	.string	"n\033e\333\200\375\031\001_\006.\245\355|\325!\314\314\0359\246\362\260W\235.\312>\234\373b[\375Q5f\265\264:Z}Y\r\325\007\2110sp\016\350\230\023\345G\217I\343\202q\3026\211\355\361\202\006$\346\276J\241\310\022\020\036+g\316U\266%\316\0055)d\034\211\033W@\215\241Y\201\211\327\256\t\275\3662\376\0300*R\027\334"
+	.ascii	"6\025\340:0\310\314\315\246Z7/\340c\256\373VG\355-\203\336\244"
+	.ascii	"\373\020.\244\355\356Uw\235sv\273\\\374R`aS\322\226\243\302s"
+	.ascii	"\210v\007\017zS\326BDD\233&A\013eZ(\27302\301B\246\2114d!\004"
+	.ascii	"\274a\020\021e\033\266M\224yV\363\373\342\020\253\305\223\301"
+	.ascii	">{\325\037\3348\265\220\331\237\213\322r\r\032-\251\263(kLp\225"
+	.ascii	"\n\216\355\211\215\355g\357\371\030\351\017\f[\324\365\203\213"
+	.ascii	") \200\202)\261\363\020\t\330\351\f\223!\002\244\235Y\225\023"
+	.ascii	"\024\226\215u\342L\220y\334B\271\336\004\271\237-y\264K[\330"
+	.ascii	"\324\336m\033\034\226\344\007\024\212\262i\312\370S\001\3367"
+	.ascii	"\024s\"\220\216\274N(\3272A{\fk-?\220\313\320\225\306h\317\323"
+	.ascii	"\313\267\317\261\267\001\310\265M0e"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.134.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375 \352e\006"
+	.string	"\362\213,3@o\222\016@\355\024S\016\224\017\335\365\355M\320\322\235\201C\003^\226\332\246\372\177\264\327q\341\376\261\220dY\330\031\307\200\nL\360\270\316\347\032\355\223-S;\315\206z\216\301q\232\3434\b\207\206\207\346(\211\246!\370El\2506\361\036\3252W\226\201\026NH\036VqB/HC&\271\035S<\302Z\235\356#\200N\005!\026\017\226F\221\022\225D\227\277:\3104\276\230d\240g\003&)\b(\231\027\245\227$M#\036\1773W\277\322+\224\025qX\210Z2\263\261\215V\305\352\366\243\002\326\247S\fP\310\314\321\372`t\326\337\340?\3703\002\b"
+	.ascii	"3\001\0338\243\\|\241k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateArmingStatus.135.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"=\t"
+	.string	"\026\322@9@\305j8"
+	.string	"\264#\314\310\227U&p\313C\306\222\364\223&\217\312\336\002\232\t\214\227'_p\334hs\034%\264C\255s\302\237,"
+	.string	"Q\"\037Jt\246\036!{o)S\n0"
+	.string	"."
+	.string	"0"
+	.string	"\235b<\274\246\031\372_=@\034?\327,\245\253&@\332\0201cH3\210\215\240|\365\254\030E\231\025\204\335u\212\243\305\275\335v\202\355\002\333\260\233"
+	.string	"l\326'\025e_[=\331OoO\237\303\224J\016@vI\263"
+	.string	"\353\332HT\266o\237#\264/\016m\223\263R\373\226j\324J\331\335\252(\333\031n\323\257ny}\300D)\363\237\341\256\233:G\246P\316\354w\334c\302\3270\205'/~\363=\334\267\353@\206\t\2243g\310\311+\3664\033\360\363\026<N\347q\272\207\006\006\207\316\003;\235\206\300\037\304\006\354\"\276\017\354.\254\275\266z\262\302\205\013\244!\255\222vG\"/Z\365\363\224,&\022\f"
+	.ascii	"3\241\341/\306\325Pz\330\013h\373]\210+\177\b\3075\021d\bZ\\"
+	.ascii	"\346\250\232\244\201\251="
+	.text
+	.section	.gnu.lto_disarm.136.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`3\001\375\f"
+	.string	"\026\230UA\020\221\232\016s\246\275w\035\367e\202\337K\365\303\2741\360^IO\237/\364C\266R\366i X7\242V\343W\202\352'?\2461"
+	.string	"\240\b\240P\bs\305\310\256\207\357hBz\304\332\275\267\224)\005D"
+	.string	"="
+	.string	"E"
+	.string	"2\025Nbb\354.\245\034\216=\302\247\211\371\233\217\210\353\262\307"
+	.string	"\207\027\376\236\201\026%`L\235\204\007"
+	.string	"\305\003'u\236\324\251\233\360:v\367-O\n\335\226\271\371\330]'\327Y\2707\267]\331.`?Cy\356\3207\211\207W\001\035R\264\f9A\030j6g\330\237-u\203\375\267\252b?\035=\r\237~O_\232fP `\261\213\022\242\2614p\346\203\355\333\037\201\331\2221{\305?+\373\236\003~\314I<\360Y\016=BB\022\017\241\022H\361\242\201x\ns\316\305k\274$^\237\346\213\r\220\206\334\335L\315\021#}\313950*<)\303?G\274F\352<I\3312d\337\345/%>\213#\230\004\256<:\227U)\250@\250\n\204j\020\262@\204\252\256\021\312c\200-\007\235\213\202`Y\027%}\264\277U\225\004&h4\335bG5\203\033i\2070\310s\356\3304\363\004\n\341\023.\"V\236\025\241^\266\310e,\316n\034"
+	.ascii	"3\241\305)\260\207\267L\350>P\f\250\353`\205\227i\0014LXy5l`"
+	.ascii	"\210\311\266\332\030\304H\203@\230\301\303\r\326w5\006Tu\021"
+	.ascii	"\247\034L8\256\211\2402a\013\227\t\030\370\325u\257\252\273]"
+	.ascii	"E\017"
+	.text
+	.section	.gnu.lto_tryArm.137.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\243\003\255\031"
+	.string	"\246.\244G\260XQ:\300\216\235\324\203 Gp\235\254\207\347\236\351\260\355\373\227\351:\305>\214,\346M\227W:\260\377z\372\303\367\344\331\226^~\005\016\324\323\373\301\310\265\306\376\036\234\343\24407X\306\036\270\206\366\t!R\246\024\217"
+	.string	"\205"
+	.string	"\224"
+	.string	"0.4\271\203\013\017\341\234\263u\322O\002\303n\235T_\230\263[\316\331aN\0042\357DHo\t\315\234S\266?\236{\213e\263R\225\344\270\232\363Y\300\240\267t|\324\b\2365\306\2648\365\376\364\013\216\007\212zH\035\351\227Cm\224\256\203\364\013\352<\375p\350\352\272\340UH\277!\032\300\236\2267N\336"
+	.string	"c|(CG\033\337q\001T\02537@\336\b\023\032\342;\222\353\f\340NUua\316i\365\001k\334"
+	.ascii	"n\373\211m\017\366\316\2539y\021\374\2457\261\371G'\335\002\247"
+	.ascii	"\367\341\312\223\337\234/C\235\026}$\017Q\206\212T\324\324)\233"
+	.ascii	"\270\3235\262\277\305b\261\350-\262I5L\325\257'\335.U\267H\365"
+	.ascii	"\212T\253Fu\271\352q\325\252\352\347$ \303C\307\217\243\355B"
+	.ascii	"\234BE5\323\211d\"\362\244\337>\205(\025\316\344\302\026\005"
+	.ascii	")\025\354+\371\304/\311=\311M1\036q\002A<\361\"d"
+	.string	"p\322\nV'c\207\225'\307\277\312\017\003\276r\177\344J?\r\246\240\004'1Fl\326\250\312\307\275y\030\327B\rH\224\212Z\371\203^\211!DD\365\242T\001j\213\030\241\367\351B \332m\320\231\"\345K\375a\t\023\273Ad\201\262\265\037~\365\364\027(_\333Zkoh\247E\373Q.\345\204\177\344\031\215V\236|mN\220\241\341YP\306<M\235\"\321\004%5\006\347\314o\f\240\rn\247\360\321\373\034\343m\220\001L\331\362t i\240\250\354\032\371?\345\227G\t\fO\323\330Vq'?\001\346\2010\341A\217\204\t\263\235\027\220\r7\253\201@Q[\3013\303\371dH\001\344\363s\233\341\230\266S\273\331h'h=2Z\217\f\310g\366#\243\335p\262\235\001\266\261\250\335d.l\266\233\254E\324\375\202nw\037'\002\205\255\235K\222S\242\367)\221kak\365E\031\311\202\303\324\203"
+	.ascii	"\021\261\210\265F\256]\355}\374\312\261\270\t\203\255\330Jyr"
+	.ascii	"\265\016\202\f\3350\355p\355\223\036\323\351\224\r\250jm\r\033"
+	.ascii	"\312\373\\[\256j\311\245\336\032\235\026M@m\016\035\364\001F"
+	.ascii	"\250a g\005\216)R\022I$\"\242M\007p\002\221\2613\017\020H\251"
+	.ascii	"hT\351;$\225\027\365\261V\271uT\310\332\230\t\340\303-\236\302"
+	.ascii	"\023\344\361r\313P\036@R\236C\256\303\303\336\212\022\020\250"
+	.ascii	"\202\251F)\177Z\353\302\235'\371\305C\312\202Q`\202\355\255A"
+	.ascii	"\356v\024\032a\027&\241E\232\211\216\2222P:\362#\223\032&\213"
+	.ascii	",\031\341\002@\004'\\\\\326F\007\304\376@c}\315\341\232\325\313"
+	.ascii	"\200,| \013\251(\262]\355\004F+\226H\257P\023\360\201c1\266\376"
+	.ascii	"\215\225\216)\277\253\001"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.143.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`k\001\205\r"
+	.string	"\246\226RB\020\2176\035\f\235xT\257\342a\200\b\300\253\222\260\370\340\233@Z\3459W\334\261\312\310lO\325#\"\324\262\037G\034Pl};^\004\bT\004\250\252\352\036T\202\272X \343\222\332w#[\312\224\002>"
+	.string	":"
+	.string	"F"
+	.string	"%2\214\210`\331\335\250\027\256\235\232$\250\251\371\024\007\303u\333\251\311\027\357R\204\252\203\220P\243\363\256\231\356\0035\273{\016O\t\235H&\305\331]'\327Q\270/\267\355a{\200}\023\001>\310t\351j\251 \t\311\221\003x\333\"\332\214a\177[*\310>\\5\261\237\206O\347\323\257^\362\261\270 0\332\2350\222\261)RH\203\355\333\357\240\331\2255\273\305\277\223} \250\231\025\232\241\002\225\004d\301\211R\241~\304\302\210\006\251\030\222\023-\"\250\240{&\024\007\233\223\225\216\267\341 \036\"\246X\261B/Trw7\265g\272\"@Y\361I\030\366=\374\203\307\307\340\007 y\356R\2766\235\f\273\f\\\033\361\332\210\036\034\007:\342\225}\304\215"
+	.string	"c\n:Yd\200aY\254\276=\274\232\270@IJ\210\212@\312J"
+	.ascii	"\347\230\354\004\035\232\217n\316\240\250\260\323%\355\005\037"
+	.ascii	"y\316\252\333%\r/ \260\002\231\271\036#Hq\220\320(\3572\326\320"
+	.ascii	"=]\346\n\200\025#\327\2360\370p\017;\3110\220\r\371\005\"`\207"
+	.ascii	"9\233\314x\003vk\f\217\363m\030Z7\272b\306\355\262s\034\301\265"
+	.ascii	"\2163\020\001<\022\226@\245\030\367\344\b\320\r\367\255C\031"
+	.ascii	"f\222<`\242D]}Iv\2667@\336vu="
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.144.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\234\004\315\031"
+	.string	"f*\226K\300\322Q:\242\0028\320\300\234\271I\007\200\274\345\200\337\373\206\017\214\217\221\205XI\220h\3556!\223\362v$\260\232\246d\321\0258\374J\312A&eQ\302iF\001 \020 u\357\214\230\301\213\301\201\025\355'\3156B\b\2212\311\205"
+	.string	"p"
+	.string	"\203"
+	.ascii	"5\247H\244\352 \227N\354\356\317\275\331\225\2720X\315 \032\272"
+	.ascii	"\027V\265\326\264K\374\346#\260\027z\272Z,\263$\307\346\233}"
+	.ascii	"k\307\303\371\b\214\207_=?FM\025\223\237\235\236\237&?;\276\273"
+	.ascii	"FpkH\307'\202YO:$L\206tzl\206x\251\363\300\344\2102\245\024$"
+	.ascii	"\226cbw\362:\360x\362r\3340\236n<Pk=\321\371\003\017\307l\252"
+	.ascii	"\324Z\227w\274\235/\200\357>\266\273'\273cK/)\271IzY\327\303"
+	.ascii	"qq\367,\336\002\303L\255V\236\344N9\327Zqzm\3127\3140*\307Bv"
+	.ascii	"_t#\233\275\320\322\324\360w'\3675\345\3117J\354\335\270\270"
+	.ascii	"1_\275\242\252<dW\210\343\006\356~\254\r\264\313\274$\314\373"
+	.ascii	":/z\336\363\274\256\363\266\316\313\032yM\222\267d^r\344\035"
+	.ascii	"\233\267\231\227\317\373\002\377\t\255\200@(\326'P)\024|\245"
+	.ascii	"\334"
+	.string	"\327\270\322J\004\026\226\362\244\201`\025\312\204\342\251l\340\376\350\254\206I\r\243\006\360^B\271\3332\201\277c\265y\344\223k\234F\341i\002A6p\315\036\033\375\031:\345X\310\226mRxR\005V\255\271\224\275\214\317\260\340\362\362R\236,\373=\202\214\272\307\276\256\310mW\366\0303V\255\225\301\036\306\221h{\241\223{AF\246<\331\375$\342\322\215\213\374\261\244$\351\023\335\245\342\001;\223\321l\265\231\313,&\235\305\244\031d^f\322\231\255&\225\021\330\232\006\232-\335P\253\331\322Sx{\003\221?\341\325\324\255q#\r\314\361\243\201,XE\373\371\370H\241\230`\rtq\362\\1$~\370W\223<^}$\342\013m\016;\320\026\020\324\243\371\325+*\3646\245S\202`\325\321\331\300\2457!\bV\301\230\212VXku\235\315R8\034\234\235\006\265\\m\273\361\300\3250b\217\210\325j\230"
+	.string	"\255^\2601\237\320l\240\215o\250qP\244\021\225\320\024\245(\225\016\200\002\0311\273\016\020He4b\2304\006c\250e\230\035\333\007Lv:\376\244\341\3617 \3202\264\b3\200\216\363\207B\211\3059\231\022\310b)\333\342\301YQ\343\336R&\271c.\264v\247J\3035\013\203\353;YH6\321\001v\260\007\236\325\3640\355\213m\242\025\214eqa>\231<\b&\326uJ\006\304\255y`\003\247\356$ \273j\177\264\0347\205\266\342\004\362M\t\331\013n\233\245K\334\221\324\221VFd\001>?\336K\272\242f\210\"a\212\362\247\234"
+	.ascii	"WQ\275h\222Nl\203C\2012\303y\214\312 \222@\350\376D\204\352\343"
+	.ascii	"\026\326LM\317\254;\222\363\223`B\253g\221/\361\227\234BL\333"
+	.ascii	"\332\353%\322\341\263\227\361\331\314\373\003"
+	.text
+	.section	.gnu.lto_updateMagHold.145.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\212\006\235%"
+	.string	"\232B,\016G\220XN:\301\365u\034`\177\254\257\002\343\0350\341#\312)\231\310\217l\201\231nm\2404\266\337\225\275\273N\220u\312DC\277@\022]A\f \261\301\037\013\006\235\314\026\303\307\376G\325#\035m\315\210\335\233H\231d\307"
+	.string	"\302"
+	.string	"\324"
+	.ascii	"\276\311{3y{\223\227\327\274\273\311\253\233\274%\311\233\233"
+	.ascii	"\274\224\344\235$/\331\274\315\274\314\274\037\340C\314\"\205"
+	.ascii	"\244V\024G6\025\313t\222\343j\377\356\021\2205\355\203\354\215"
+	.ascii	"\313C@\243\351B>$x5\256\2622)\301\316\324\210\251\2656}.S\371"
+	.ascii	"\231\363\036\372\311\347\241\237\347mp\027\356F\263z%a\276\214"
+	.ascii	"\240\251\265\002\373\306\203\277\351\361v\2722G'\331\034\334"
+	.ascii	"\347\242t`c&~\223\213\352\3118O\006\f\336\275\270\316\205\200"
+	.ascii	"\035)^p)\300\206\n\342sD\343\027S\026\237\276\261\241\361\004"
+	.ascii	"\223\2741/n-)b\220\001j\255O;\207\215u1\347\242j\255\313`c*\276"
+	.ascii	"\276\357.\334\356.\330\245\024\002\031\222\314j\255\007\330\276"
+	.ascii	"D\303\206\251)\372I6\223\227!7\376bnfN\236\211\356\372i\277\030"
+	.ascii	"\231\265/\344\231h\367\256\227\277\210]|\334}\222+\241\332\243"
+	.ascii	"m\225\225\025\375\354\376\2263\242\220\217\347Z\253\211\356\342"
+	.ascii	"\266]\314\226^\265\n\221\2709\254Q\361b5\373\346\246P\206h\204"
+	.ascii	"|$r#\333V\326Z\241\366k/\342a\217\366\271X\037\370`\237\373\017"
+	.ascii	"\013\245}\316\234\b\371\270\354VFK\3455\273\306.\356\342\356"
+	.ascii	"\311\332e\273K9^\245$\244\243\222\327\250\350j"
+	.string	"\337\037\311KD\362\0161\257\020\363\006\225\274@%\357O\311\353\223\343\355\321\361\002(yyr\274;\223Wg\362\346L^\034\312\033\016\034\320\317\235&\362B\354E\031[\322\351\245\234\306i\235\376pGQ\347\0305N'h;\222\273.\262\256\313tE2\270\\R/I\177]\324a+\202\372\3726\326\276\354>8\025\be\255^\007\366R>%\202\004))\372\351\353\245cQ\231t\323I\335\206x\022\264\3277\375_\367\332\344\272\270';2\221\372E2\034\344Q\377:\214\307\271\350\257\267\326\254x\261\2325\277\216\022R$^#\361\333IP]\363\232\331\2063|ni\326Xk\235%\330\316E\217zk\215J\317\355\314Q_\355\001\204\274fu}\324\314\366\025W6m]\177\250#\327\245\333\237pM\250\300\007\253@?s\255#\316\246\375\257\270\335\203(\331\023H\227\2053\341bz\333\305\360\266\313\301"
+	.ascii	"T\201\253'(*'\236+\254\016\275UNV[ZUSUW\300\252+ \b,\252,`\325"
+	.ascii	"\226\b\240\023\320j\205\260\332\002\216\320\322\332\002\362\214"
+	.ascii	"\302\223\265\313\366\202\013,\302\356\272!j3M>\324D\315le\270"
+	.ascii	"\224\310d(\0323\324Ji\277X\224\026\335\023\3520\333\366c\006"
+	.ascii	"w02A\375\026\002\352\240n.C1E?\r\324@m\206@|\232\247\177\232"
+	.ascii	"\254\322\323>}\036\007\303\340G\314\272\374K\260\207\202\267"
+	.ascii	"Z+\324\347n\320"
+	.string	"\307\275\004\177\224o\027\202iOG\313\242\237\345\027\n\375\354\351\0379\033\"\334r.Y{\264\r\n\t\252\005\325\350'\200~:[j\236&\253|\305\371\242\254\340uqY\347\364\327 \213+\t\334\350G\225\372\306\227\345\177t\247\225\256\034\013\203\006\001\200\215\250a,f\2212\212\215\210HA\222$\255\001\220\002\031\031\263z\021\200\271cg\222b\315\002Tj\b}\006\316\312(\376^\202;\267\034\007]D\233x\234C\002sy$\235\310\002V\310\204\270\027{\340\211\352b\340Dc=\177\262\032'|<*:\362\314\0207\227\302\013\227\325\t\360|l\353\244M#P\2324\307\355\336\\\223\325\261d\355\266\021%O\257\217\203\261A@\001\354\207\332\355j\342\333!\315\257\310\225\242=\212\236\301\235\t\220\333G\345\337kp\201c1\306\263%\021\263\217\215\244\375\222\247z1\354\223\023D\221*e\251\001q\2700"
+	.ascii	"\2161\357\333\344W?\205\242\266\355%\023\200\r\351\035\"\362"
+	.ascii	"v\220\200\2230 \371\314\343!\223\255\305\277\334\0325\203Q\234"
+	.ascii	"\355H\200\206\234o\270\334\211\bQ\356\t\357\317\003@\360\214"
+	.ascii	"S\\\330\2470\333\t3\372\222\303V\2433\306?Zf\003\253\202\335"
+	.ascii	"t\323W\200u\230\311\270\335S\202\335$\031\260\316,W\366N\300"
+	.ascii	"\343?\t6\246\243\255\200\326\272\214\314S\003"
+	.text
+	.section	.gnu.lto_processRx.146.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`F\035-u"
+	.string	"\032\262\240'K \220\342\031\003U=\341\255\335z\0275\025\006\030:C\332\221U\242\331G\216m.<\031o\017+\330g\365F,\221b*\235\301\375\004B\025<*\002\201\230\352\377<\226a"
+	.string	"\032\032p\0057\311U\312\265\243FF\233\210\334)\245\024v\002\032\002y\002\335I\372\2050C\204$Q\373\034\242\256\331k\306\025\\\265\304u\264{J\257nt#s\267\224\226\262\262JQ\212y\312\007EaQ\027\315\003\277\250\004\310^\255\310\244\236\244\232\035\325Q\364\025u\315\236\304 BAt\335\350R\257l"
+	.ascii	"\262W\346\252\251T;sC\351(\315\266\013\201\223\256\373\244\303"
+	.ascii	"\342\272Q&NB\366Z\324:l\257\306\306a{\345&\263\016\035us\373"
+	.ascii	"J\032\331\035\242\353\272N\217\244\233\315[X\217\265p\026\306"
+	.ascii	"\302y<\003\343\261\f|\205\255p\025\216\201\2510\f|\307/\260\224"
+	.ascii	"\247\260\024\216\262X\241\002\353*\205U\025\325\224T\024\324"
+	.ascii	"\023\212\023NML&\226\224J\220H\032\201t$\"\204Q\021\321\220P"
+	.ascii	"\020\320\217O\017\317\216N\016\016\210\033\233\017\314\232\245"
+	.ascii	"\222&\211<\262\253\361\275\311}"
+	.string	"\314\n\221\206'\315\301\n\332W\363\026\275c\234\"Y\036\n\317\"J\232\265dI\362\346\214%\005\347<\267\235\247\223\315y\006%C\234\361\326\232e0*\r\361C!\350\351\\3\352\320P$\314\316\025#\224\030\242\220\240\2473\210q\231Hf\203\020g+U\2004\307\240\226\346L\305\254\031\006\263\023\234\357Lh~\241\004gi\316\024#\n\317\"$4K\tz:I\330y:Gp\216\006=\235e\3226\372x:Ep\026+\336V\361\236q\254E3~\025\364t\232\220\"Q\321\255\252\252MU\335\301\247\020up)D1\036\025\246\241<L?\0216\n\302A?\361\305\235\3004\201\001t\246\277@7\341\327K~}\256\344\245Kx\341s\022Iy>\002i\006<?\022\321\345\212\207\260\322FV\252x\021\3211\313\307\027A(\325\347\216.=dt\232\212\231\331\270%\216\351\2713;\027r!\212\007\305"
+	.string	"\305\201d\250\363\237'\356\323\205\316{\346\316Zp\236.q\276\323e\211\353\344\340\3005\210$)\370\215\2227\267Q\342\346\037\230l]\303\266\346\313\2713!\256\034b,\222\266\321\334Y\020\2479f=w"
+	.string	"\351\244\321s\207Z#\347\316\324\250gi~l\352\231\232\022\215\314Y\352\031\020c\221\353\272c\276\366h\243\222\211\026\346oT*\314\322\003\023M\314\250c\266\244\254\245\355$\2409\335\217Y\256\353\262\227\241\355h\206\321\314,\001\314\\\203\231\247,\217|/i\240\362\227o\304\033+\244y\3457\331b\223\255\005\233D\220\256\0336\305\r\330\201\315\"\320&\022$l\2574\357\364f\007\346oS\373q\036\322u\335*n/\335\327|\343V\322+7\2234\341\340\330^\221\317\363\246\005\314_^N\177\360\373\276\213K!\266\217|K;\251C\267\020{\374>\362\354diN\177\231\233K\3575\343\270\225pS\256\331d\345n6a{=>\323`\032\230\277\255d_\253\351\204}\250\0364\276\247t\021\230+\362\021]\263\316\273\214\306w]\233s\212F\023E1\331t\201\fP!\013|\310\365}QJH\344\314"
+	.string	"\b\340]\266~O\333\234\377\325\274%J\013G\216.\347#\332!\260\023\274\227\024p\271w\370\276\257\"kt# \001\276\327G]\201\234\031\201\027\316\377b\346\036\027*\225\340\016s\306\207Ri\177\257\036\347n\200e~"
+	.ascii	"\206w\231\277\212\345\236\036\265\335\022\013\361\276u\260\375"
+	.ascii	"ZR\3020O\344\034/r;\006\313,\001\005\336e\375Pm;X\2506>\3013"
+	.ascii	"\313\330\362.\343\242\260\377\342n\202\005\261\2330A4t]\221u"
+	.ascii	"\232\264U\r]Wd\216:\373\337\367-\343\017e\356\177\337\267\f\277"
+	.ascii	"\021f\326\271\217\260\316\rE:\367\023\351\334DX\347\036\353)"
+	.ascii	"\3154\332\256{\202\2166\273p\347\026\254s\026\353\314\302\235"
+	.ascii	"W\260\316*\334\031\313\235\257j\234S\3248[\271s\025\322\231\312"
+	.ascii	"\235\247j\234\245j\234\243\220\316P\356\374\344\316(\334\371"
+	.ascii	"\004\322\331\311\235\233\220\316L\356l\302\235\227\334Y\311\235"
+	.ascii	"K,\235I\260\316I\356<\302\235\221\334\371H\351,B\351\034\"\351"
+	.ascii	"l\224t.b\235\211\224\316C\254\263\020\3229(\351\f\244t\376Q:"
+	.ascii	"\373(\235{Xg\036\244\363\216;\353\270s\216;\343\260\316 \334"
+	.ascii	"\371\206u\266a\235?\32083\335\271\346\350\274L:+\221\3164\254"
+	.ascii	"s\362\350\214d\235\217\356\314\272\363\352\316Fwvw\016l\337\244"
+	.ascii	"\364\376\004\257\225\276\2358S\211\327\352\022/\325\366wV\355"
+	.ascii	"h\377Y\225\311M\037b\325\320D\004NB\257\345\"\347s4\246-\037"
+	.ascii	"\037\333"
+	.string	"+\211O\266\320\307\302\322\230Nz-_\322\214\373k6I\372\345`\032\220\n\201\336'GUz(sKC_\220\022#^\3138\342\241\332\200\322\024p\032\317\334\336\320\346\240\303\327V5$\201\204(\261\252\2248&\t\351\333NJh\004\351\203\336\322\344\246L\032\354\207\221\021O\"\036\374\204\316\361r\0305\203\"\345\230\272U\303#\266\275v\360\005\027\021GB\216~g0\315\213\0365\204\210\007\362d\312\fC\374\320\213\370\025ol\210\321\2078~i\346\302\026\275\321\373\210\031\233#\372\242\357\037>\210\036k\320\016l\350\033\255\315\351%\n\265\210L\213\221X\013\361\330!\324P\275h\325\260\310\2063&\007\270M\267bX\346v\207v\214\223,\205U\303-4\330@\344%\350\350\240\271\206\364\205\207\2374\004~|P]W\\\312E\207\226\032\350{\005\251\337\317\003\375\337\221-\372|\317\377\374\3727\306d"
+	.string	"gn\311\264e\274\313|\330\311\\\204\030m\265U\364.k\025\331^{^\271\302\013t'\252h\021z(w\373\262<\337s\355\031\017k_\007sg\363\313\331\024\023c{\345y\244A\273\234\351K\003\017#A\017\345\316\241i|?\245\203\314\351\231\236r$\006 \235\367\"\323\371\2536gb\030\036\332O\316\317\310y\346\264\214\240\363\277\222jV\370|p\032\206\306y\346\224LOCq\220\016\332\264\020\013\342\033jf\004\020\177\354a\246\312s\3633ln\236\371c\214`\330\177\355t\351$\222:m\233O\"\332<\317[\232O\003\251:\207\035\246G\375\023nX\374\313a\036;\234\024\336\3354\201en\2325\321\230\323\272*<\027\017\304C\271\233q\354\207\367\342\321\205\315\270)\356\035\264\232=\220J2`{\375\360I;\2600-&\203\037M55\266W\346\023\275\245\361\264"
+	.string	"\024d9e\201\307"
+	.string	"\371\nrS\363N\225\022\016\326L\305\314R\260\351\017X\032\257%\035\324\251k\253\032~x(\016Cn\\tX\252\206\376\276o\"\363\241\255\203\345\246v\r:r4\327\326\330^\033\360\013\017\254\223\247\353\212\315\342}\337\232\207\36227r\340\220\201\343\001.\rp\340\350\362\302"
+	.string	"\007\223\353\202\256\0276\272@\250\341\325U"
+	.ascii	"\327\r\0306dl\335\260\226T\025\324\f\252*\031M87`pmP\003\002"
+	.ascii	"\0346\270\274\274rl\325\360V\023\227W\327V\005[3\234\266f8\331"
+	.ascii	"\250!c\003\247-\257\033NM=\334\305\001\227\227\023\216\256./"
+	.ascii	"'e\024\254\215"
+	.string	"\356\033\341\001x0\251\026\202\275\223\215\020\240-\362 2s\346\272\356\003m\217\3002\\\350\272\256\003-\376\237\344\264x\254\300CA\026t]\267\201\345\242\364e`L\271$\353{\354\305\262\276\357\332u]w\001\026\357\365\343\235\377\365`\255Z\033\244]k\327\330^Y\374\321\233]\340\230W\201\025\310\025\201\357\213\033\246m\b\005\207\273\004\230o\227\026'\005\020\001\244\n6OD\364jK\244H\013\205\262\275\252x\2367\273@.\007\220!\2623\300\r\254[,"
+	.string	"\353\265\226Xtg\b@\022(7\303"
+	.ascii	"W\035\203\275\nd\243\272\212\002\244\320\341\255\205\363.s/m"
+	.ascii	"\365)\376\311\204i\345\242\334\300\264NL|!\264\372\2507\273@"
+	.ascii	"\036\355\302\373\236\t\240\352X\025\210\006\300\rg\\p\264L\213"
+	.ascii	"\035\216v"
+	.string	"\022K\365;T*2YS\354\324!\213-\177\274\350\207\302\223\025R\317\356\347\177\255\\\222\026\256\205+3l\0376\352\245\376\361\306\2368\375\215s\276V\216\351\013\267M\274K\353d\204[\257\354{>mYh\351\332\272:\266\327\250g\032\264\333\263\300\215\200\\\250\207Q\036T\020I>\215\235\304B}\023\311\002\365H\203L@\275\257\"`\244`=\224\237\336k}\372\253\266,T\305+\024\337= ;\006\213\342\033\255\315\2448\361Zt}\0020\n\325\352y\365t\001\2358 [\325\252\n\240Z\225\003\362@\202\343{\251\334\256\373\351\235\304:}?apz\242\301\241\263\260\2763SFE\027\276\016k\220z(\263p\201dyPmC3\305\200!\313{j*\355\342Ih\362\246\207j\2236M_\225\352\342\263\300\242<\332\314m\224\366\256\357\220JX\230\245\020\352\241O\026xw+E\332\336\365\375\241"
+	.string	"B8\002\212$6\bi(\035Lb\231>\310\353\034JK\245J{\345\n\333+\323\023\r\246\375a\241\322A\333\262oJ\355\036fK\310N\230\370\032\303\026\317\304\037\321\214\236\302\020?3\247\245_\316\265yK\317\006\202}\250\002\t1\324\222\016)\032\021\021I\n\222B:\342\n\020\006#Y\"\310\362\006\022`C)\t\245\240\225Q\222\341\304\t\rW?E\231\341Q\214\002\0045V\354\350\230\3502\303\022\200\016\3267\350<\001\315\257;J\rJ\376\345"
+	.string	"\210u\nL\314?_\243w\222\b\362\376\001\031=\336\017~b\350\330\206\036=\217\203\301\235\250 \032\325h(\343\374\031\274\260\223\361\345\\C\276\200\352\261Z\361\266agX\0361\013\025\337\262\312\231\301\362\006\025(\201{,\251Z\225\327\003A\255\270]q\244\277\351\f\260.c%$\350hT\314\252EV\t\257\355\002\227+\017GWy8K\267\207~\271T\325\276\220\203\355\277\241x\034\227\307\2164\335\310\276\022\006\252s\332\252%\303\356?\306\362\265\200r\236\333\332\021vT;x\r=\366M\306\220?\2677\2248l\202j\367\231\222\220\311\311\314g\025u\267,\222:!S\245p\270\204\177\370\034\327\364H\374JH<*\301\336)\362~3\372t,\037\r\306E\312"
+	.string	"\322\016w\355<\310 ;F\320\334\310\340\313Q\277\371T\213\013z\253\332\372\336\300\210\352G \313ST\217\304[\243\2540\345\361#]\"#\025\3509\360TBW\"I\347\336\r\004\372P\231\003'`\205\207z\225f9\203yU(g\rI\210\254?\257\226+\361T\317\264\n\205{+\356*{;\333\321\313\234\326\252@0\304\256`\016\207\037zH\375\037\242\355\215}a\274E\"n\353\274<4\241\301\213\2428\243\n\345\001\345&T$\255\256K\265\273\256\2250\300T\0377_JH\005q\016i\207\362yO\237\360\363\273\264Z\f\301\345\241\b\3745\365\272\037\353\300HTGmJ\312"
+	.string	"\256\373LxT\234\323B\351\307\013\341vY\233w\315\262G{#\327\262k\345`H\220\212\2604%\206\036\007/\342\240\236\\&`\227\245\234\351/\325S\332\"\216\2532\257\346\300\232E\215\337a\277\375"
+	.string	"\367\215\274\332\356Ir\336\033y\205)\200\025\311\034&@\262~dZ\341\313\364\363\341\304>gflah\024\202\005E\275\353\274\265\b\301['X\255Z\221\376R\006?\357b\022\321/\345\3463"
+	.string	"\317CA\006,\327\321\340\272\002\223w\317\320\346c\020\007\274\232\352\312w\304\005\374\273\216\025\224%sO\254\021*>jM\251\306,\374P\021\372R\340[p2\030\002R-el+\233\354\261t\321cQl\2506_\373\323\001pJ\031Xp\3058\303\202\367uB\3427\374\260\034\341c,d)\227\032\f\342\201\244\345\301X\313\036\324\276\346\362'hH\007{?D\350\022A`\213I\023\034\020\244\t\201\377Bd\360J\260<\007\322\230g+\032\3161\306\2033\204L\231%\325\272X8\327b\252L\276\031/\323\002\336\247\222C\301s\234\314\335\207z?o\277\310\2750|\233\304\250-\002J\336\232\026\245M\025\t*\320\210^\225\376\003\353\301\226\222\013\371\017\304hc]\200|\315Tv\300\241\344.\204\221\355\210=\277mX8>\366\217\255\200\031K\267\301\030\270i8\303a\360"
+	.string	"\201t\357\030}1%z\233\226+v\005\367\307\016\357\267\201}\206\334\031_\361g\020\234P"
+	.string	"\260p{\255\007\017-w.s-\207\322j\345\r\214\034\315f\376"
+	.string	"e\335>\223f\031\002\325V\203\242\302\364\006\017N3\262\261J\334&\2114\210\360\032\275\235\035\02763b\363'i\022\321fH\276F\300\363\273xD>\264\240*\236*\337v\241\366\036E\333\225\325\"\260\306e\032*\201\004\201\030>\024\270jo\242\016\353\220\024\246|\206e\245\305\275\200\222\023!\250\302\007&\204\357\277c\205\351\377\327i\344\235\330\201D\212\240\367\003v\303P\001\261\300\023-\362BV\2212F\013zG\335\006\234\347\260\006/\205\037\210\221\333\n\210\361\320N]Z\007[W5`;\377g9\274Ab\225\336\201\037;Z\227\214\364\303\255l\202\233\201\336\177\252\314IA\267$\035c\006\030+\204\205\336)\322\244\270\301\370p\244"
+	.ascii	"!\023M\273u\314\273\252<\211\271-\"\323\357aM \f\347XWD\274\032"
+	.ascii	"?\344\364\215\202M\034\325\301.\031]\370U\016\201JS\370u\352"
+	.ascii	"*+'I\271\335Ps\311mu6|p%dz\211\346\340\351\353:k\347<c/\036\373"
+	.ascii	"`\002@`\247\201t9KyS\026\233`z6=Xr\005\271\224*\247\215\026"
+	.text
+	.section	.gnu.lto_subTaskPidController.147.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\315\002\365\025"
+	.string	"Fj\222I\300VQ:\220XI\002_\344\224\366\244\030\374C\270\361{\305\262A\245\340\201~\033\314\244\233\350\267#\332\376\334]l\345\214\306\217\332\376\016Y\002\0359\337M@zw\021\341\323\272L \203EV\307,\004n\204\220M\344N)}"
+	.string	"v"
+	.string	"}"
+	.ascii	"~`\225\214\324\334\275\306\3546.\200\250*\224\"w3\236\302\200"
+	.ascii	"*\025\251O\3733Nc\366#\f\017Pk\221\021\037\265\356d\\`<\365\356"
+	.ascii	".\341\351\370\226\360\3243\273\311\313P\245\035\210a\002\327"
+	.ascii	"S\252\265\222\253\342\263\207\024\3349\363\337\273)\247\243="
+	.ascii	"\034qz\033\232`\210/H3\244T\342\244\023\002W\242\340\220\274"
+	.ascii	"\367\271Ag\233S\264\251\265z\346t\037n\361\266\177l\357\330\363"
+	.ascii	"\027/\337\205\177`\363\271S"
+	.string	"\037\026\236~]\226\220\250\315%\307\370~<(<\357\t\210j\363\347\030\037\222\257\316\237\275\263\3155\262\017\326Z\253\267\310\276\215\037\365\243\237\345t\336m\032\247GqZ\024\247Cq\232\206\323 8\275tz\202\323\027\260\322\202\203\356\032\240\324\352aIJ=B\201\2748\357\267\377\236UTH)\233\027\364\372\241>\203R\214\023Nj\335\0318\r9|B|t\215\\s\023\321aO\313r\0031e\036\307M\273\301\266\277\343\273\256\244\335\001,R>!\004&jY\326\017\002\341?\016D\307wq\352\b\022P7\023{g\302|\3160\270\245\331\347\361\036\026xV\253\360t\256\351\275\177\205/\311\26465\360\264\347\035\3464\355\226\317|\356\264O\"\262-\3157\201\242\316\337\255\304\307\021\321\256\221\305\277\302o\317\215%B3\212\375\034\327\021-\330+GV\256d@& \235\026\354\225#\243\320*K\013,"
+	.string	"\356\251Q\321\270\020\250V3-\256\0057\nbe\220\317h\326L\253\214\261xX.\222\345\")\274V0\222U\002\2213/\216Uh\225\244,\026+I\225]\355`\335\"\333G\344Hmm\016\2216\034\327\266\314\2130 W\324ZU\376\220\023i\340"
+	.ascii	"\007'<\r\223\344\236\210;\206KW\334\337`\330\346\222M\033\356"
+	.ascii	"\301\245\373\322\303M\251\315%po\204\0060 p\002\241\271j\007"
+	.ascii	"?\253\"&\336\300\"\007\032\267\247p\240\330$\357e:\332\\3:\254"
+	.ascii	"\263&\366\217\311f\372\255\206\374\347\333n\030L@\266A\"\210"
+	.ascii	"I|\365\221\t\035X-\201\333\n\304l:\314\313B\210\231U5\354\335"
+	.ascii	"bol\ft\355h,\364\007?\210\315\330\225\322\351>\307k\370.\243"
+	.ascii	"\035\343\203M\003\t\251\270\222\305\225\305\314\230R\b("
+	.text
+	.section	.gnu.lto_subTaskMainSubprocesses.148.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\035\n52"
+	.string	"JV\300\022Fp\\R\007\313%S\344\317\230s;\032\020\204\236\f\020zP\252\254{\3723\031B\257HgQb_\312{\235Rv:\265\303L\027;\327@X\306\377\367\265\203a\363\345\002\177`\001\251\342;+\261M\344\336)\245\024 \001\372"
+	.ascii	" \001Ym\035VL\272\366\243\235\335\314\335j\314[\31222;O4\373"
+	.ascii	"\202m\025s\202\024ycY\347\201N\231\202\332)\363\222\322\330\316"
+	.ascii	"\334H:\311\332i(X\307\2627\300XaY'\002FR;=\352\340\355\024m\340"
+	.ascii	"\355\224W\3465\303*\026\271 \210\217+'sX\226%\376\216^\233hH"
+	.ascii	"h\030$\f\002\001\177|~=>\236\036o\247Ss7E\337W\356\034\004\335"
+	.ascii	"\222\211l\242#=\324O\255#F\\\b\255\207hE<\b\355\207\013\321|"
+	.ascii	"x\320\254\201\314z8\320\214\207\377\224\265\017z\324E\314U\200"
+	.ascii	"\034ap}\246E\346\2771\357\361\2059\017\032\034\203#M?\265\300"
+	.ascii	"P\003`^\266\372L\353\313{e5\234W\346\345;\0017^\320h\335\231"
+	.ascii	"\326\fW\237Z4\320#\226e;\347c^\265Z\0138\323\352\362+\243S\324"
+	.ascii	"\300\333\2258>\246\025\032\314\362\261\254rt\253\037-V\315\251"
+	.ascii	"\341cR\241=:WdZ\255\235\005S\351\236\203\300\262,\373\222\371"
+	.ascii	"\242\271\250\231}\307\314\031\230\325!\001|\244\214\362\214\353"
+	.ascii	"1:oT\322o\262\321\212\013\354\223\276\307\212\313\205\367\222"
+	.ascii	"6z\026\334&\256\177\023\0234@W\373\304e\356\340\301{\351_\024"
+	.ascii	"\243z$\267Z\367\330\023\316\350!$\321\244og\037\375\234\231\351"
+	.ascii	"\350\275L\372\326\"\246|$\367\327\r\326\343\232\315XI\013\373"
+	.ascii	"o\346\332\351\36671q\243r:\314\335\244\2358q\367`\020P\336\313"
+	.ascii	"N\271\241n\247\375A\267\256\244\267\\\340\371\246O\334v\366\003"
+	.ascii	"\261\244\307q\201g\233'\353q\314N\245\177\223\271\277m[8\376"
+	.ascii	"\034\314\327\331\230:\027\337YAR\352L\240\235\315F\327\271h\347"
+	.ascii	"L\264s\036\3329\013\351\234\207\357\034\364\316\302\3249\210"
+	.ascii	":\003\251\316@\325\371Gu\366\3119\377R\347\236w\366\2753\317"
+	.ascii	";\367r\316\274\324y\227:\353r\316\352u\316\241\3167uNQg\024u"
+	.ascii	"~\324\331\337\271\035\364\332\3220{\331\262l\375\266r\315X\275"
+	.ascii	"\274n\247\276\037\340\226\306&\307\316\317\372\305\326\306h\r"
+	.ascii	"Y\346\243B\031\342\340J\033(?_\312\204\"\244\313\033\221-=\314"
+	.ascii	"\363}\306\304-\254\335\314\364\231\325\006\216\265\331\274\235"
+	.ascii	"\362|\267diIo?J\230\326\024\237\320\307\341,I\212\354\340\351"
+	.ascii	"\225\354\366\276u\354h\266\225lL?W\036f\353\217\037\267\323\336"
+	.ascii	"wW\027\0344n\333\266\355\361^}/c\362e\367\2745H\207Y\205\250"
+	.ascii	",K\305\200\373K\203Y\207\020Y\321V\264\333\351\356\333\211[Z"
+	.ascii	"\356\325\357\253;Io\225\272\313zDeYv\211{KsY\223p\367\350\224"
+	.ascii	"W%\021\"\334Ns\217\300m-\351mw\333\266vx\027\2003K\230\340\275"
+	.ascii	"\274_\024S\022\267\243p\206\355\013kY\004\216\356\233\214t\t"
+	.ascii	"|\253\265\352\006U\321H7}\002\317~\325\245\364\226\271\327\032"
+	.ascii	"K\005\013\027.\334N\323W\352(l^\317c\t\2245\025\375\246\363C"
+	.ascii	"\277at\356\233R\372\321?va(\300\306\365d\257\320\2317p\360^\006"
+	.ascii	"N!\2404LI1M\221\320q\223q\251\370\324`\211I\tHb\203S\b(\rS\""
+	.ascii	"\234\244\244J\034y\370\250\344$\025u\374p|\"\036\237\210\"\240"
+	.ascii	"\230B\020\217R$\210JC\216\032\341$E\234\212\212\222\"\362\234"
+	.ascii	"\311\376\034mD\304$_\311W\311\023\025y\013\317Z\217\020\307\034"
+	.ascii	"\313]\244\260\223\242]\221\310\333\2517k\271\235\3362K7D_4\364"
+	.ascii	"BO\364m\005\304\350\207\276\207/\364\303\341w\030!bCO:\350\237"
+	.ascii	"|E\320\013\023\264\ry\262mBP!\345\231\266\031\006\300\274l\r"
+	.ascii	"\215\256\202\307B\323mt\205\257\300\251\326*(\341w\232n\226e"
+	.ascii	"\331 ]\202F\272\301\32792\370F\2626\256V\b\364MG@_\024{\332\272"
+	.ascii	"j\333 \360\353p\225\340X\\/\335\374\274\317\003\277\255\300\214"
+	.ascii	"\377\363\257\306\352\r\216\253\310\3519\353\n\026+\026\326\355"
+	.ascii	"\324\347\203dkK\376{\346\225\271\302\360^\032\377\310\367\277"
+	.ascii	"G\235\300\215\001}SK\027yw\276\221n\317\027\337\364|\267\221"
+	.ascii	"u\335\001~\023M\373bt\0336\001\200\323\250\201 h\025S2$\"\222"
+	.ascii	"\244 \251t\340\002\021\031\252u\0200\306\250h\222\326\304\031"
+	.ascii	"/I\003(+\223X8\034/t"
+	.string	"z\371_+-{\307\276\026\367M\227\252\213\2535qe\017\f\356\314\030\3109\020\236\362\376TU\213:$\024\346\035}\\\231\323\032t$*\265\24405\222\016]\027\372\004\375\360\201\337|\016\263\3763\301\202\004\213@\226\321Z\020\224S\230\245\313\3425.\344\363\301b\"\377\223\006\251-\300\310\033\356(\303Fa0\240\017]\324\016%\274\323sPd\0242 4M\242\222\036O@\314{A8\256\003\255_\214i\210u\264\236\307\r\243\t\330m\347\375y\320\223Gt\r\370`\266\013\211\254\260\364\200C\271s\003A~\276g\364\332\024oH\007$\364\235\305)\370q\364\376\021G\325M\b\t\352\351\260\316gv\007\240\315\362\310&\370\217\200!\262L\305\351\214\2770\362\346\203\236\276e\033\321\330_\341\375\036[\306\260\316\205\205\006m\005\013\356\374\372\350\b\324\361S['\337a\363\2631\273B\006\236\251\325q\r"
+	.ascii	"#\333\233\255R\f\361\027n\262\371R\b\t\272\002\360^:y\216\016"
+	.ascii	"h\177\177\314\372X\224\232P.\260\262\023\t\256\036\367tP\021"
+	.ascii	"\177}\301\365\226\204A\356\340gQ\030\0264\361\325>_Vy\352\341"
+	.ascii	"\336\374\\\257\232\222\200\"^\361p'\036X\375\330\224\032\t=!"
+	.ascii	"t\3510LAAd\226\006\201\335K\005\2332E\237?"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.149.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`;\005\345\037"
+	.string	"F\270\305I\220VN:\301\367\303>\3072\024\201`L~X\215\305\377\345\033\f\034\035\274p\201\006\335w3t\345\314\267\337\365,\314\225\212E\2456\362\b\220\341&-\220f\223`XA\237\220w\rwTbU\3777k\t!\204H\231d\257"
+	.string	"\241"
+	.string	"\263"
+	.ascii	"o>\362\275\373\037(\f\366\\{\257\325\375\254u\245`q\246\205\243"
+	.ascii	"Bz\363\337Z\335\317\030\203\3778\220\341\221I\257R\365+\332\264"
+	.ascii	"f\260\325\312\225\340\346\036Ho\356\374\346\274Y~w\336\334\341"
+	.ascii	"\356\025\234\246\252\324@+\306\023X[\255\265\3276>|\016\227\242"
+	.ascii	"\247Y6\017\367\337:\256hTz\356\305qG\213z1`G\024\025\247\003"
+	.ascii	"hH\035\217\226\b\330\306\266\034-\352X\336@\345(>\3619u\323I"
+	.ascii	"gl\3422g\234z\227>Mm0d\214L%L\227\247)\337:\2670.1\243\021j\255"
+	.ascii	"\313E\243\324W\367\335\315\332\335\240]3A\274>\362;4\274K\344"
+	.ascii	"\343\027y-T\265\324J{\257\327\bI\"\33141dU\267\325\376w\276\213"
+	.ascii	"\276\324\230\270\313\356\301\036\366\333cm\b#~\361\346\336\350"
+	.ascii	"\274\371\276Q;\022\371my\222cO:\217<\204*\"{Y\236\344\026Ze/"
+	.string	"\273\\J\334V\273/k\327\330}\327W\207\227s\344ww\362\332\240\2745(/\r\312;c\362\312\224\27419^\030\034\257\256\344\315\245\274\270\2237EyQ\224\3674yM\224\267<y\333\344\345\222\367\006`\264T1\236\212K\255Po_\352\231I\226\365\256\272\336\265p\201_\334\035\246V\332\\\353Z\301b\270\331/\255\265>\330G\031\221!\305\n\2367s\215C\022\235\374IP\303\206\r\347M\\\013\370U\222\313n#\020\317\234\034,dH\316\202\230\250\212o\275\346,i\326\307\254.)%\257\227\024P;BI{w{^\226\204\313\212Y\320N\317.\033\355\233}\366\237\334\210dI\034\206\314\306\035\313.\2558\351.r\261\240\231\253Z+\320\336\310\217x\330c\335\334\017BB\337\262b\026\235\356\346\262'7\"\2775\321\351wq\363Z\247\033\314I\307\022\277\355~\310\211$\241\030\032:or?"
+	.string	"*\271\220dY\277#\243\016DH#~\024\220H\374\204\302\023>\232-r"
+	.string	"\344\003\374\001\"\352\331\375\216\214: \t\211\220L\340\326\327\363\023\006} |\300\236\017\330#aDt\324\363\tM\364zp6X\342'\354!\005\203\302\236\216\253\276kl\2326\343\214\330K{nu\316f-\250\247vR\251i\033\232\236\351\232]\323\364ez\246q\300d\372fUZ4*{9\216\311c\032\230\214i"
+	.string	"7\216\013\322b\364\340I\243B\253)\001\336\035\372\030\002I3\376\252\013\233\030\332V\013 \254\207\0133\247\241\234\264\334\312\177\375^\377T\030\017\031\315\353]\267\330\025q\302t\321\327\332\016\357J\230\300/\302\264\017\320-"
+	.string	"\007p\250a8\350\034C4#RT\220\026\322\001\260\002\031\031\263\016\020H\310H\224\fs\200\013\315\222\372\312\214\206\004\0313\367\367\251\035}\350\025[%\203O\fa\230+*!\200\004\224\031\213AK\215\271\346\177\216\303\241\313\227 \320{\374]:-\347\030\224\016j\371Wz\312G\255\310\211\271\tO\333\3139\341\221\203\032\365l\256\0162+\021\237\225B#2\300\242\214$\367\264\005\355\321\266*\313\022\274f \034X\241&\215\363\323\221\374\301\375\331\334\371\035"
+	.string	"\230\005\244\332J\273\\\201"
+	.ascii	"\377\001p\340\216\262rUq\017\347\356\270\002g,\r#\341\361\032"
+	.ascii	"\354\241\220\0353\225\274\337\374\007\361\217\233i\006\227<U"
+	.ascii	"\313\201\252\020\226A\033A\371$f\375D\321\332\025\023\247\244"
+	.ascii	"s!\221\002\017\tb.\377U\254a\204\032"
+	.text
+	.section	.gnu.lto_taskGyro.151.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\231\003\005\030"
+	.string	"\366k\230H\260XQ:\300\363\321 \321:7\032\037=\263.D\276h\250o'\227\361r8\340\245\031\233a\254\246m\354\362\034\325\037\365<\263_\020\311.\t';\255\f\rT'\352\202\210?U?\332\367?\\\177l\204\220M\244L)\202"
+	.string	"w"
+	.string	"\205"
+	.string	"\017\361dc\204\2249\307\002\227f ^\3327<\330\325>\216\347\350y\322\007\247\346,\272\2614\347Hc\002\342\245\314a\300\313\357/\340\245{l(\037\217\246\253\306\223\\\217\2479\347k_\274\347b\b\312o\265\307\277\322S\272\235\317\305\001ECD\017\277\244\004QN\301\023\227B \3643\361\375l@<\251"
+	.ascii	"\260\013\372VWrL\256t\025\261\003R\r\023\3149\255\272\335\320"
+	.ascii	"\235\272\355\022\266!\330\033#U\354\264\224\304\3335\372i\340"
+	.ascii	"\367\302\016'Az\305\376\216\363\240\371H\326P\323\353.\375\032"
+	.ascii	"x\371\205qB\364\243Q\236q\242\262d*\224=\372\350\032\331\377"
+	.ascii	"\346\266\260\237\364\273Z\037o\226T\257D\265JT\267\210\352T\250"
+	.ascii	"\026W\035\256\032\224j\t\252?\251\336O\255\253~\f\313\005\322"
+	.ascii	"\356,"
+	.string	"\242\314I\"\n\313T\"\211\310\370\370\333\277\222U7H0{\364\36094\003\256\265\025,\310\300\"Fm\006\r\364:\313(\375G\275\025,'\370\001[\373\3612\001\324v\360@\257k\355\233x@+\212\246B]\206\247\201`\021\260\227\342\036\300\217G\300\373Q(\317\364P|\222\346LK\337\312}.\213/\344C\"L\240@\001\274\374\026\006\206\225]\333\006\036$\307\345h\316\211\343\3778\220\n>\322\245-\350\350\350\246\350\356jS.\213\213\276<\006\3322\fz\235n\016/h}|\037N\001\262\032M\002\356\266\203\343I\371\002\f\307fv\203\263S\363\3023AV\243I\300m\220\335n\035b,\307jd7[L'6{\305f\257\r\264\235\332+v\343y\325\270l\343 \273\275p6\333\355\245\032\347\277\271-,\366j(\371Y \203:V\\!\311y\035\001\233\350\246\250v\325\262\251U\355\205f"
+	.string	"i\224Y\333\262\0277\265\256\036\342>\211\364\321\243\361p\215\f\023bB\"[\353\"\3044\344;\221\263VD\323\303\235\031\t\267\005\203\350@\217\206"
+	.ascii	"\rG\250Q8%\225b\304H$NP\220\244\330\240\002\031\022#\037\020"
+	.ascii	"`8\243\222\026\003\304B\263`\355 f\336\321uZ1P>\236\177\234\370"
+	.ascii	"6\356\354j_\317]\302\332\033c\353\362\026d\0366\375\263\r\002"
+	.ascii	"\362\245?\rs\240\341\224\013>\300\276\261xS\354\246}\033\303"
+	.ascii	"\361\235\222w4\031\2617\335\275\016H\244\364 \321\200\0130\275"
+	.ascii	"\036\305'D\215D\016d\023%\023J\201_\363>`\022x\210`@\256\277"
+	.ascii	"E\314\003\251@/ \221\262*qSp\340\032\271\013\001\362\200b\237"
+	.ascii	"\2022\025"
+	.text
+	.section	.gnu.lto_taskMainPidLoopCheck.152.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\237\001\305\020"
+	.string	"\246\037sI\340\320(\035\322\tP\031\325z\366@\002V\206\361\353|VI\363}\311\265\264&\024\332\371\bF\253\242~\215\246\332kH\262\342\353_:H\002\033\002\256<\016b\202C\035\325\005\202\312\007\344g\nc\263.\256Y\262\311\336)\005]"
+	.string	"W"
+	.string	"b"
+	.ascii	"\273\345\210\013\230^E>\300{\355\376\341\275\3326\202T\314\262"
+	.ascii	"\227:4\002Bh\2109Qc\267\374h\207\313\336\321)\363_\342\035\322"
+	.ascii	"M\321\230\013\"a\336U\250\315\270\345\202H\233\323\016\304V\033"
+	.ascii	"\002@\322\272\003BF\266\343>g\310q\316\322\202\335\365\224!k"
+	.ascii	"\356z\333\016l\247\330?\n~\267\273k\232c\327\351R\235\366<]\353"
+	.ascii	"tW\247o\362\370\260C\336Cn\227&\tia\324\026"
+	.string	" l\337\277\035\367r\023~\315M\221\210\335=\275\372\267\027\373\364\230}\262K2\244hi!\007\321\356\216\270\201\351\225\004)5\247\375\236\223\210\335\347\202;v7\250 \n3\251{\360\025B\037RQ\201\240\367\352\321\020\240\334\0242\262\325\250Y\274\216\256\334d\320\346\r\037\347\360)XL\2734\022\377\347@,\177\347\325\020Z\325oQ\220#\237\331L\362q\277Nn\304m0\360\340\330\240a\232\366\204\327\274\314\251\002\234\221\302\270\205\250\245\307\200\f\236\030;q\330\3458)\007\007/\224\260\305:Q\301\"\204\f\002x%e\222`Ub\242B}\274P\302\026\353\004\346\022\212\"\005\320\303 *\024]\240\n\270\372\300\325\347\302R\265>P|}(\002vI\b\305\017\346r\211\337\251\234\275[\232\343\020\024<.\250G\217{\007\216\355E\f\2139\237\342\225\350\214\355JEftt\211\236V\372\3433\006\035"
+	.string	"EeO<\0059\037z\357\033\312\360\226g\265\225$\030"
+	.string	"v"
+	.ascii	"B\300\300\220\r\0262\206-\210\331-\320\330\273j\204\337Xa\265"
+	.ascii	"\305\007\333wZPimE\314w\231}h\210\236\t\035\024bB\335i\263)E"
+	.ascii	"\202\202\002"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.153.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\r\002\365\021"
+	.string	"\246 vH\340\322&\035\250\232\360\025\030\301\264\253\243\374)\326\337\031\372\376\n\224\315\363X\262\004@\347\267\224[\262bQ&\305\023S-\360\256LfK\032\004\216\n\305\031\275"
+	.string	"\2402\270\340uuD\307\325O\320\013j\t!\204l\231Ra"
+	.string	"]"
+	.string	"b"
+	.string	"\347\354\262s|&\333\223!\0228,z\354.8ExS\327;\356\333\274\251.\177|w\362\034\211\t\236\177\233\367\312\t\032\211\2756\224R\355\350\344\005\b\351x\320\315c\331]"
+	.string	"\367:|n\006>\314\340\t\211\341l&6B\3408y\345\020\263Q\365Xv\327\n\213\355\334\246\333\336`\333\201\255\004\002?H@H#<}\354\023\375\337T\353T\177DD\310(v \035\2739K@\266\006wT\342\264\337\376I\207\254$\235l\373\263\257p\235V\363\335Y\223l(\250\266\253s\340\234\033|\347\276$+G\247\253}\024O\341:Q\006\233v{T\300\330\235!p\201\357\034\312M\272s\333K\272\207\031\3455G\247\224A\270\351\"\306K\347\233>-\256\223\201N\224\327(y\244\224>\276\355\356n\363\307?J\246T\363\\\263\355\366,8\355\246\032M\227\374\027\345\216"
+	.string	"\243\214\023\023C\367\331B\2267\252dO_t\262\365\301l\232\013z\330\347\t\304\315\034]!\351\344/+i\334X\375a\317F\235\001*\0132\253T\253s\313\t\225\300E\001*\245R\322\202\240Z\275<\230\211Q\211\"M(\342PE%\262\302\t\241\013\030\272\2001/\251\025\030\212-P\345\304,\031\225\b\316\260X\"\0302\333\263h\2306\357\346\317K\364\233v\004\t7s4\314\016\211\332\251\320fID\277\371\242\033Qx9\t3@\266\273+\347\354\025K\003) P\0021\310\326\003\304)(\017\250\030\256;l\250\203\216J1\361\365~\343\031)\372\253\332\325\204\375\271\222iI\032\320\002=a\3218\017\246\373;\374\202\360\270\261]T[\002[\366P\n!\302\006]"
+	.ascii	"\221f_[\265\320}2\0356M_\210Ag\t\332\r\260\032Q'm\016'\304\234"
+	.ascii	"\2147\2450P"
+	.text
+	.section	.gnu.lto_isMotorsReversed.154.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"2\214-3`O\322\001p\001`0\300P8\264U]\211\376T\271'\0252\321(\320Z\263\333\016\307\025Fg'\007\270d\344\206:\252r\210\007\\\373C\223&eJ\001n\322\364\\ch\024k\024\203phx`\355I0\251\300.bzl\302\271\307\242\270WO\252\301F9\366E>\002\375\313\024\230|u\310\307"
+	.string	"\034J\035\350\300\330\344\307Q\306&\213\0355\251\032\366/\253\036\333\351T\201\017\024\353W\312n\347\323\262'\220\211\207\355\333\316\330\221\021\0222\206\217\034\035\002\220\222\n\222\225\335\310t\343\360\t\375\207|\201s\251T\226\346\031\240\260\273\316\312\262\270\365\007\266/\002\b"
+	.ascii	"2\001\0038\003^\034\240kx\303\020/\3349i\266\261\353\336"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.244.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\237\004\215\025"
+	.string	"vc\177I\320\322(\035bAs\320\316 e\332\242\303\322\233_\032\323\003\3036\207\270\322\336\022+,\026+2]\331G\374I\030D@\220\300\f\303)\302\367\264\234\210\3764\230A\305k]\236\224|\035\361\355\257\366Y\373\311\336{\313\224\002n"
+	.string	"a"
+	.string	"i"
+	.string	"#1\330\313%\322b\255@U\n\365\321)\343\226\330\374o%\225\323\335\234\344\304GbB\207\231(\261/W\320E\200Dl\213\025\342+\020\037\026TyxJ\312\230txPT\350tX\024\312\367\255\214\330\260s\232\203a\347\346t\273K\225n\367\330\322\341\244\254\326z\3367\203\356\266\013{\311\267Rk\365qP\334"
+	.ascii	"n\337\201m\002\266\214\005\261v\264\003\267MN\255\311i\324\256"
+	.ascii	"P\263\317=\252\364\340\342\215WIA\230\352:m\374q,\271\254\321"
+	.ascii	"\307\336\365\267k:\327S\256\245\\\307\270\336]_\026\033p\243"
+	.ascii	"V\rOBj\317T\032\262\315\263\261A\237g\263\301\317\023\331\266"
+	.ascii	"\321\261\315\346q#\240z\244\241\034$ \265\326\3603\222\270\355"
+	.ascii	"$\001<0\006\310B\345\352\255H\235P\031\317;\252\307\221\016\334"
+	.ascii	"6\031\365\023\032\243\214\336\234\235\333>\331Oz\217\201/\344"
+	.ascii	"\006/\323\177\241\2371\236\004\355\340\354\223W\275\024\250\027"
+	.ascii	" \317\207\352q\240\017\350\276\326\206\211\331\3476\252\364\334"
+	.ascii	"z\273y\027\267g\252!\222\265\362\020\250M\023a\237\263\254\225"
+	.ascii	"\344\264\265\326\233\030\177l_\240\017\236\245\310\324h3\230"
+	.ascii	"\331L8\233\t'\320\304H\bg\265\232"
+	.string	"0%\200i\024dj\241\005\032\255\026\202\266\367\262F\037\005;\0348\361F\322\202\005\206n\204\210\345\326\024CY\333V\304r\373\001\373\004\254m\340\300>\367\371x\325Xr\331\250gC$\376\030\235\232\254\215 \301>Gi\264f(\261dE\253\034o\2413\326\216\226|\245\313hY\340\342B?g,\020k\250QlH\005S\022$%IJ\351 \003\031)m\016\020(e\352D\262\220\341-$TA\002\213\306\242\241\370\345\227l\234#\242y\020\034\326h=0d@\341\263\f.\033!\230Z\226\202\350\276Y\357\027\301\314\nh\271d\226\316e\336\\\333\244\246 \n_?\241\026\217e\251\266X\357I|\335d\213\311\r\214\271\n\267R\026\324\331\361\262\325\016\037\353\277\357/\t\332\237\207\332\272\002\335Ee`\314\264\f+qQ\037tH\355Z~0\270z+?\030\\\275\225\037\f\256\336\312=\212QM\304"
+	.ascii	"\"\350z\"\264Y>i^a\017\324\037}\306=\025"
+	.text
+	.section	.gnu.lto_disarm.part.0.245.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"u\n"
+	.string	"\266\222E; \261\322\001\260H\320\"\230\nf\0221\312\021\203$\t\016\300\212i\200\235\315\007\345\205\3320\326\244c2\204b\361Kl\200\013(\201\034\305\332k\302\207\307\317\320!t\263\204l\222R1"
+	.string	"1"
+	.string	":"
+	.string	"\254\020\227\266\315O\332>\346\243\003f\267\273\365 Eyy\352}\245\177\363"
+	.string	"\260X\3534 6rO\340\237\207\264\273\376\220\334\340m'\330f\260O\020'\302y\227\225U\242\223&\342\240RS\262\333=\353A\237\037\350\034\374<\3249x\373^\235\305\0247S\333\335\360\276\311\262C\337,\355\360\340Wl\007\336\367T\307\306\310\360\016\263\301\213\266\f\272\265\350\024\026N@7S\267\336\215Gg\246\337\277\2452\233\206\016l\273 98k\002\322\244\274\260\254\"\271<8>\231Z\316\266\333W\206\030i\214&\t\2614a*\2608:\221\243\370 \242\252\210\252\025\021%\212*\222\251:\022y\2648\221\365b\034\311\032\332\366\376-\225\271\001\227\333\240.SJg\266=\001\026"
+	.ascii	",\205\227\307\212\b\215\206\007Y\025&\203\020)\207W\254\001D"
+	.ascii	"\3010W8Z\023\366g\210<\267\004\203\333\350\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_tryArm.part.0.249.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`!\005\355!"
+	.string	"\026\374\322B\200jQcK\314_\220\242\020{\210_-\374DX\271\322u\034\365.K\304#\360L\016\344up\317h%\234\347\345z\\\374\030\265|b-\337\312\032A=\223NZ\227\227\273,\314\bw\333rK\231R\271"
+	.string	"\264"
+	.string	"\310"
+	.ascii	"C\337\210\241k\203}\243\377\345`\316\207\361\327\021\260x\205"
+	.ascii	"'\270\304\266\220n\355\300\274=:\201\362\226\274\200\262\200"
+	.ascii	"\020\277\370.6N\264\025R\347E\0337Nt\207!V\262\266H\177(e\333"
+	.ascii	"\374\341i\333n\277\305\266\024\226O{\317\213Z\367F'W`\006\335"
+	.ascii	"{w\267u\311\317\323\314Yi\311Jk\247_\023\3428M\201\331a\316V"
+	.ascii	"\226\231MxE\313\243{\257MhE-I\200G\224\340\303\260~\220\020\372"
+	.ascii	"\234\td\023VQ2\303\026\261-2#=\200\274\222\t\220\f!\303\t\201"
+	.ascii	"\344\021\2349W\037\236\352\020RQ\032\340\265Y\322\275\327\237"
+	.ascii	"\nr\333n[\211m'\333\3265\211m\243\222\3261/x\200"
+	.string	"\264\314\277Q\371J\253\351\325\017*z\264o\346g\226\374'fj\242\0176\225\267\257FL~L\321\243?\274YGP\221l\354RB\264&q\255\275\036\217\307\243+\022\333R\347,5\316R\023\321\250o3j\333\214\272fR\323Lj\323R\317f\324eImKj\322RWKM-\365\r<\020\222\313\272\227\307\261\320%b\321H9\327iQQ\253\007\026\031)\327H\242\312QEvii\2635\350\002\213Hc\336u\3035j\216\252\251\"\034\216\274\26123\350\336\342\356\326E\263\332\367\271N\364\305\330f)ca\030\263\341\\\017_\347\320j\254\246\274e\240\365\347\346%'\314V};\027;\271x\370\360\241\274\245_\301\261ZV[\255z\254\262h\2656\023\273\277J\263\322j\021\031+*\263j\326_\035\232\n\361:\"\314{\201\025\374\260\323\031A\242D\211\362vV\343\f\261\2225$\016\215\234x"
+	.ascii	"\205\214Vv\024\361SDm\023(\350\203e]A\204\252\342\360\315\013"
+	.ascii	"\216\255>\330\345\260H\241\202>\250\242\254\275@IV[\353\227\225"
+	.ascii	"\026\2578\034\026:-\273\305\337\270h v\357\255\320\346nx\376"
+	.ascii	"\223[\367|\276\257\352\230\020o^l\302\352\232\007\307j\255\024"
+	.ascii	"\320\225\217\234\032\030\206"
+	.string	"\260\310\306^V\344h$I\256[\215\030W\206P\030\255\002\273Xj\216\241\213r\202\372\321x\372!\360\013\n\027$(Y\270\300\323\tx\202\212\342\371N\300\3609\275\340E1\201Xzb\222\361\343\rpO\347\373A\365\\\364\224v=\245\335\023\023O\306\256\367\213\332\351\212\f5\303\367\333\321\200\202\372\355l\266\351\311\2334U\251\\O\336{/\315\346\n\201u\235qcF\240\345\317%LN'\364A\037\341\274\310~\340\013\n\237\331\227\312\\\255e^\300\200\264\f\312\001-\231\367\363?\247\224s\312Y\345\254R\336\346\352\215w\210N\223g\n\235\262&Is\\\255\t\275QITq}\226\2564\021\325\tw\226\254\241c\2642\312[\375-\240\277?\271\224\366\231\345\334B\037\274U\rD\200\202\220\356\343y\036\007p\250q \207\230c\206ffD$I\323jP\002!\345\352\270\001\021\320I4\255\244\315"
+	.string	"D\261\202\204A-Ry\265*\240\326\221Gkp\3121}\323^1\262/\237\261-\321\016lv3#e\332p?\250\217\005\300\237\213\361\270\206\262:\364\274\016_\345\037\233\251I\362\336\200\346\375\322\023\023\275\323-\340\350\336B\342\311U\232\321\372\374\340"
+	.string	"\312\035\312\251\374G\202U\203&zGd%\340\301\030\241\300z\005mR\3423\314X|\267\355n\315\353)\205\270KH\322\200p\\\275y\335G{\270<\366\300\2036\221\275\252\364\332y'\220\310<\267\364\317\365\257\260\2542\262\316w\333\256\273\257\330IN\262vp\237\204\333\025\343\313UV\217[\024\236\337\220\250:\023\\\325\032\246\t\313"
+	.ascii	"\031z\n\310\322%\345\364\013\262\341\270\260\241@\035\2251\223"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.250.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"%\007"
+	.string	"\"\r/3PO\222\016\200~\354ZWe\351\257\227m\373\302"
+	.string	"\\\t\335\320\\{\217\314n=t1\374\034\205\331=\322\210j$Ae7^\223\006\200{\206\032\331D\246S\232\215UQ\016\024\347Q\234'\001\361\020\361(\213\342i\016\256&6\326\253\250*\353M\177\253K\004\335\020\342\222\201\032\210\241_j\003\265"
+	.string	"\370\013\214Vl\204\r\364L \032\275d\223i\030\032]]\"\350Q\241\245@$\263c4\223#\222\350\344\233u~\272\331\365S\245\246\374\035\217\257\207\251JI\226\305\204c%&3_%$\351Ul\356\272\330\307Sl\326\206}>\332\f\352\002\0302s\001\220.\365_\370\023~\224\017"
+	.ascii	"@\023\030\027\f\226\"\017\020\005\303\\\3416L\3309\003\350\f"
+	.ascii	"\320f\312N\003\300\265\347\202:f;O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`!\020\2153"
+	.string	"\332Q\254\021;0\246J:\236s\265\be\b@N\177\334\324\003\017x9E\007\340\021\350bT\311-\202\272\022\225R|\361\311*\026\316|t\340\372 \314\026\324\201\377WS\032\205\2164\255\310\226v\022\001\372"
+	.ascii	"\020\001\375\263\037\271F.%\260[X\344z*~\335g\361^%_`Exx\021"
+	.ascii	"yX\361^\033`6r\200\351(\242\343\213\206\327\020\364^\025\033"
+	.ascii	"r(B\2563H\337\354\356\261\355\265\001\351\207\371q@\037oT\354"
+	.ascii	"\321\007\303\243\377\205\270\343}^\257\353\272 \035\247\313q"
+	.ascii	">\305M8\372[\2107\356\241\215W\252\361C\2064\372e\304\031\307"
+	.ascii	"#\343r*\3068\\\021\306\355\274\350kq\321\037k\321\247\302\342"
+	.ascii	"l\212+\372ST\364\245\244\350G!2S8\024}\365D\337I4q8%\356\247"
+	.ascii	"\"\247$n\247\021\257#\342\032\206\270\233\"?\237\317'\210\276"
+	.ascii	"!\361C?\023\321\303\317tx\032V\312d\252\034\372\2306<\260\310"
+	.ascii	"\251\206?\342\352w!f\270\237\362c0\374\316\205#*Z\350s!V\350"
+	.ascii	"\213\021)\374\312\204[\221p,\021\236\005\302\371\036\334\020"
+	.ascii	"\326\326\311\\\rs\360*\305{/T\312d\246v\356\355{\355\310\016"
+	.ascii	" M\323\264A\237\214x\357\025p\025\277y\205\376\350\336\"\371"
+	.ascii	"\310\032\327?\307+x\027\207v\351\216\f\325\236\030\347W\226\347"
+	.ascii	"\362\211b\250\365\327\313Sg\355\355y\315\331\304\273}\242\370"
+	.ascii	"\352\303\256\237(\346b\243\370\330\032\325/\317\374\312\356\334"
+	.ascii	"\345\267\276\2437\375?7\375Dm\372\213\330\364\031\271\365\363"
+	.ascii	"\254\351\307\265\365\365\260\365\345\324\364\367\254\365\331"
+	.ascii	"4\375>j\37594\375?k\037\320\231~\240\264\376 3};\264>\2412\375"
+	.ascii	"\274\263\376\035\231>\336\230~!1}=\263\376^\230>!\230\276\244"
+	.ascii	"/}?^\372\223\272\364)\225\365\013\271\364\233[\372m\264\364\343"
+	.ascii	"\220\365\345\214\365\347d\351\323\301\322_s\245/\306J\377\255"
+	.ascii	"J\377\r\225\276\333\224~\032)}\265(}4b\375U\355\233\201\322G"
+	.ascii	"c\366\313<\254/\370\264\017\251\373\221\236\364\007\235\364\333"
+	.ascii	"&}EL\372j\226\364\331\224\364\327\222\364\333\236\246\351\275"
+	.ascii	"\007\220\004\250U\223N\337\315\204\262\224\252v5\241|T\215\233"
+	.ascii	"P62\337\262P\206Z\353\356\034\312g\371P\376\246\313\te/\026\255"
+	.ascii	"k\321\222\017\260\317\003*\243%[\261\177K&\260\376*/\214\355"
+	.ascii	"6Z2\222\355t\001\227X\252\324\311t\035-Yjm\217k\273d#\240]\202"
+	.ascii	"%\033U\303\313.\313\\\272%\037\325\037\001\033\347\376+\004\234"
+	.ascii	"To\205&\267\336>%K\265\210\224,\265\336\301_!\234\233H\311G?"
+	.ascii	"%\037\231'\032\022\033kS\245d#{\276wJ62\225\374U\221\222\215"
+	.ascii	"i\003\262\356\241,~Z\022\213\217\206\f0\327\025\037\367\252\030"
+	.ascii	"\251\376N3O\272\313We\265\347Vx\365\252\276h\020^\337\325\253"
+	.ascii	"\342\353\r`\256$\177}\013E(\311F\243\224*\305N"
+	.string	"\265\310\025\t\030\225\344$[\227d*\325.\311T\354]\222\253V\274$W\265yI&P(\311\005V\002* $W\261\377\232\263yw\003!\231\252\025\204d\252AHF\256\001\367\310\\n\261q\016\271\265\265\346l\036\267r\334O[|\325\023\003FN\031j\261\224S\213\217Z\374\265\223\026\023\323\326G\355O\026\210\362\237\353oS\020\345\037\262\277\177i\232:\327M\355o\tO`\037M+\244\303K\352'K\354 \312/l\317\224TB\226P\025\\\003\333\337C\27728G\353\257\336%9Lz\330\023\347ZOqk\013\267>\201[\337sN\013\247mO\034l\3425/$\224\377\266~\201\331 \225\033\t\345\263QOd;\363\033\273,K\210\362\333T\2664\254$\224\257\326N\242\204\362\3170Q~\332\332\205(?i\277tVb\242\376\312\215\241A\3026Q\376j\217%EH\243\366\352\241\034\204\371"
+	.string	"o\344\262P\356\321^\001\240\274\273\207rW{V\353\264\\@\224\273\324G\205\t\324\207\203\275\301\207fyt\250\2105\240~\253.\255\273\226P.\300\376V2\013\023s/\241\214d+\241<\325\022Byj\3751\005\201\035\250a\034\350\304C#\")HRI\007\221\005\2041\347\240\325\001\021\260(E\031!#\"\201H$\"2\017\300\235\310\230\224\245\003\351m\317Zn\223V<\214)E5'S\340\016\351/\360kO\344\347ah\202\030\261\321k\016\204i:\024G\202\034\317)\007u\344\200\275\345\261\346\260~=\332(G\241bQ\3474PB\026"
+	.string	"\330\007\233"
+	.string	"@\321\020\026$\022\362u\254\215\345\322p-\003D,E\205\202\030\241\226\310\2349\341\372vh\215\005j\265]"
+	.string	"Y\035\013\036n\304/\016="
+	.ascii	"G\271B@\324& \332\255\340R\211"
+	.string	"\262?N\273\006\261j\034\303\315\237<\366\321\312\026\342\004;\004\326\215\305\025a\340W\230\202\373\036p\301q`_\270\361\316\332J]\217\354\220\363\270\033\020\356P9\355M!\265e\357\031l*3+>\270\b\201\244i\276\237'\223r\352\361$\326,se\036\376z\231tE\027\022\363\266\201\247\031' \032\334k\206K\256@-\336\377#zf\340\320\367b\27371\203\275\004N\375O\347\344\037\334\016\361i\275P\263;x\302=[l>\3535My\267\216\364\033\006\203\255\246\367\350\254\253X\263zprY\226\312\262T\226\245\262,\225e\251,KeY*\313RY\226\312\262T\226\245\262,\225e\251,KeY\272$\240\314\235\001\224\351>\347\312\315\315\225;\256\257\244\032t\213\372C0\030\373\f\374\325qz\375\372w\275:1S\327\235&v_\320jHVF|\317QPH\377_I)\031\3020\023"
+	.ascii	")\346\035cc;\024\001.\345;\321\345\245\016\265\317}k \333%\n"
+	.ascii	"\231Cj\305\201\224\217B\300E\326K\371\217\026V[Uo\300\222x\337"
+	.ascii	"m\001b\360\316\021\314\306\223z\213\202p\203\310\376\327y\tm"
+	.ascii	"\374\004\231\337 7\363h\243q\234\275\244\200\203\t\027\323/@"
+	.ascii	"\253\001"
+	.text
+	.section	.gnu.lto_.refs.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`A\001\205\f"
+	.string	"\226\237X<0\253&\255\001`\347\2032n\206\355n\216\223\300G\341\020\t\203\2240t\r\005\005\005\005\005\005\364\362\355\337\267\377\276\376w3[\345\353\17773\323\277\036\253\304\022)\t\351&m\313\024F"
+	.string	"F"
+	.string	"E"
+	.ascii	"\255\255\260z(\336p\002hK\262\033r-\302\376l\2163\361&\273\327"
+	.ascii	"F\302\332\311\256\304\265F\323"
+	.string	"b\330\3245\203Y\212\270\243\352j\2641\252- n\bs=\325\025\020O\334\225\300\\\213\272\272L\265\333\235\335R\0021\323VgL\351F:\312\274\356Zw\025q1\325mU\016L\213\320\005\205\266\332\355s\203j\211\256\332i\\2n\013\035\306\335hnFs\204\3466\315\013\252F\200/8\203B\327\003\272\234\317\231\347b\2353\355\006\240\257|\356\200s\2026\t\366\351\364\307\351v\234\356\210\232\203tF\033\"\232BvK\270\376\200s\225\322'\244kBz\244\364\td\323\307#\217E\324\031\227=\245\216,\212\351\236t6@\272#\330\037\2347\004\f\021\264\224\006\322P.\333\311\0037crU\262@\273\221\335\320\365\312\256Eq\225\335v%\251^K\373:\020\370X<\276\013\236{\026V\"\230\356A\350|*\r\030\224\276\005\003>\005#\377\340\241\205\003\213\3107\200n\r\0310T\020\271'\004\021"
+	.string	"\230^Rd\206\270\031\016\202A\t"
+	.ascii	"Bd\306\241\004\343\031\023%\344f\334\212\212\303]\315\305\224"
+	.ascii	"\241\026\004;\240\265\225\302<\003"
+	.text
+	.section	.gnu.lto_.decls.b0db4eceedba0355,"e",@progbits
+	.string	"(\265/\375`'w\215\372\001\032@\327\267S \na:\215\001\300%\307E\255\237h>\304\003LG\254\031\221\271?R}\250sY\363:\223-{b\373\225\357\273d\333]o\b\273\210\274\032D\262\020,\313c\030\372\272\243\334t\262m;\255\255\272\024\246k\231_\"[\227\235\271\251$\311\336rK\231\002\002\n\234\013\361\013q\200\362u^\013j\321\237>\217\032]\244\250$\016\024\234\317\223\247\223P\"(XX_\030z\002:\344\306\241DP!G\177\3343\317 \202\240_@QB;\352k\310\030J\004\005\202~\001E9\367\225\210\253&J\312x\216"
+	.string	"\001RF\347\363D\321\347q\242\317C\246Q.\264\353\306=\013\352EdK\223\b\316\347)\242]\354\275\367}\0265\370,\352yN\320\347\371\322>\227H=\217\016}\036\032\372B;\372\302g\026\21631gJp\276\210+9\2539\024\007\212eV'\006\370Du\240;\320\0347\016\305\201\336\350\320\241CQ\217\223\036J\232:_XE_\330D_\370\245/\274\322?j\003\245\352\201\033\373\223\303\271\211\312"
+	.string	"z\022\332[l\256\257\n\235\272q(\025J\205\316@k\\\275!\371\214J\337\336\273\003\206\016\031\356\371u\247\346\037\245q\264FT\020\013\013\333\025\234\257\225\244\2434P:-1\352\340|!\225\376\225\203\262\362\2431P)\024\306\215Ce\374\350\276]\216\361\236\356\034P\2727\227\334\330\336\033\225\201F\3359\240'\347\266\342!\302v\002\227\347\336\273CQ\207\016\254\232\020::_\267\321\327g\3645\237\276\316\323j \207\0379d\240\312\356\330a\221\225\245V\347\330\316\334\345\002\272\021\245\254\007\316\270.\351\270\216\001\212\0049\2433GJ\027),\234\177<\347\f\352\004M\222<\2341\231\331Z\237\235\363\310\330\034\231\032\222\261.H\270\214]\276\267\037\230\210\022+}l~LD\254K\037&[R\245\017\rm,\255llo'\224\260\276)[cR\240"
+	.ascii	"9\373z\342F\244o\fv\203\341\3408\230\f\376\303~X\017\347a3\030"
+	.ascii	"\f\226\203\323\340>\274\207\333`@\374\005?q\031,\006\263\301"
+	.ascii	"hp\030\254\006\257\301o0\337\215\303g\360\3351\036\366\362\234"
+	.ascii	"\306\t\2253lF\306\210$\221\353;\203\343p\027\3249&\002\224\017"
+	.ascii	"L\344\f\016\303G\344\240\356\236|\231\331\265\025\031\2132\344"
+	.ascii	"\f\023\2508Lv\006\227Ay\353\303dM\340\306\354\316\3405\261\261"
+	.ascii	"\275\235\035\212\324*e~\254\021 g\275kA}\225:\375c+T0\034\346"
+	.ascii	"\262\001\374\365\007U\207\363\226\"\341\331\031;3\234\257\341"
+	.ascii	"\364E\310\355Ua\301Z\260\335\215\303Y0\335q\335}\363+w\305F\026"
+	.ascii	"<w\303\\\275\254\335\364\013\221\244\356\353JQ\207\016B2B\302"
+	.ascii	"\270\321\371\032\211F\207\350k0}\035D\343*I\307Vz\242p\300\211"
+	.ascii	"\341,\344\322\267\357ZP/\270D\352u\225\276n\352\007\001\365\203"
+	.ascii	"e\364\203X\364\203O\364\203c\372\301.\375 \225\276*G_5\243\257"
+	.ascii	"r\321W\247\350\253d\372j\017}\025J?e\243\237\342\351\247S\364"
+	.ascii	"S&\372)\230\366p\211\324\2479\364\323(\375,G?\217\321\317t\330"
+	.ascii	"H\017\230*{U8?\247i\\\344\271\215\353\007}\322\361e\016\347g"
+	.ascii	"1}'\036\002\324U&\306\031\234\371\326L%\035w\335:x\243lVz\n\024"
+	.ascii	":v\367\013\237\017\034\365'a\030\3179{u\256\335\036\217\037\337"
+	.ascii	"\300?0\017,\004\373\300^X\013\347\300X\030\b>\001s\341*l\205"
+	.ascii	"\267\360\016\234\205\257\360\027\006\303:p\017\034\004\333\300"
+	.ascii	"8n\034\356\3025\216\2470\325\263\363\227M\233\032}\227O\r\025"
+	.ascii	"\337\375\023\"\325\345n\253o\314\177\371\310d\215\331\211\341"
+	.ascii	"\353q\323@\3350\250s,8\345KN\037\336\177\355\274h\365\311\001"
+	.ascii	"\336y\363_\276\013'p\f7\377$\374t\303\314)c\306\006\210?\twa"
+	.ascii	"\031\230\006\352\034\023\312\370b\323\267\367\276vX.\027\240"
+	.ascii	"'\241\035\005\003\310\031\334u\321\\.\250\223N\313\210R\325\267"
+	.ascii	"\267\363\"\344\334\347\236\035\277\377\362]7|3\236\374I8\306"
+	.ascii	"\r\003\324\024\332P{m\306\366v\376v\371 \002w\335\276\033&\270"
+	.ascii	"\365\266\214)Bh\2405\350\304\244=\367vv(\352\220\342\341\235"
+	.ascii	"\031\023\"c\275kA\025\300%R\237\241\364\217g\034\323\b\263\201"
+	.ascii	"}!H\026X\345\006g,\225t<\343\002+Y\352p\016\332\321G\323\350"
+	.ascii	"\243^\364\337\320:}\224M\237\313\265\240^;\367\316\215\343p\003"
+	.ascii	"\177\351\\\274\013\243\234\333mog\220\220\314\337\2177\234\217"
+	.ascii	"\226\351_\016jP```\340\345\240\036\025\323\371\022\251Gu\350"
+	.ascii	"c8q\262\216/B\304p>^\243\217\261\350\3436]\004\246\217yh\016"
+	.ascii	"\327\202z\\\245\217\237\364\210:\372\367O\237\016\215\276\336"
+	.ascii	"\235~_\233\026\272D\352\237\327\202\372\033\246\177w\350\233"
+	.ascii	"w\301\3348"
+	.string	"\013\256\336?\2108\332l\013\372\271cv\207\016\316\2776\364\257\005\352\r\274\026\250\037\201\276\222\316p-\250\277\200\366p-\2507\313\325r\3436\334-\316 \\\304\016\025(8?\002\372w\203\212\006\006\336\r\352\027\2403\\\331\240\243\354\342\236\324\321]'\227\231\235(\277t\377\225r\247\334\271\313\265w\324\336\373\302\205\301\206j\016\316\367\355R\271q\030n\225_+W\356\351\223s;\367\336A\327\315\020\250+\234\205\256\005\025_\"\365\007\320>F\277p\247\360\264E\\k\021\354}1\25070\360bP1\327\265\240j\270D\352uK\372\215B\244Ze9\367\333\336;\b\350\312,\n\034\316C\227H\375/\024\fA'u@\300\332,\br\352\240\n\202\363\177\331\376\213v\237\3345Tj\212k\277\355\355\034\n\242i\371z\303\371\256\341\253v\235\277k7\355\037D\334'j?\331\333y\327\362\336O\367b"
+	.ascii	"t/\006i\226#OP\324|\254\357\274\026T}\211\324!\365W5\270I~\324"
+	.ascii	"'\013A\223<\360J\371\206\034$"
+	.string	"{\375\230\316\321\237\306\311Z\177\356\001\330F\357\317F.\031\207\037zg\367\343\"\371\3067\340\322F\303\237\202\371Q\f\240\027\310\277\312\344G;\310/0\231/\177\306\372q\326\217\257\362\325\2373\360\343!V'\374\030\307+\374*\222\252\037\247e\033?\206\201\321r\325\237'@\225\247~l\026\001\242_\375\372\363\t\032?f3n\311L\024?v2c\203\024\317\360\253<0[6V\371\263\022\335\305\300\177\231.\007\202\253\275x\005Y\352\177\340\003\360\247V2\217O\016\222\201~\2207\2007\370Q\0219Ff\312\025\262\004\271(\003\232dC\n\265+\340W3\360_\016\217A\243\374\031\306\217\205\240R\376\034\205\226e\250\377z\350\316\305\np\340\2744\255\002\254\342GI\310O?\006\372\321\244\334D\357\3450\370q\222\215*\351`\004?\032B\366\220?d\021\"\370\363\bTM\016A\006\301\177s\344\n\371"
+	.ascii	"?^\362\201\377:e\020n\021\212\227=`\342G-\240\204\331\262\261"
+	.ascii	"\r\332\301\013\034\302\377\rh\002\262\013\214\343.~\365\305\177"
+	.ascii	"M\370/\005\376k\374o\005\376\313t=\340\247\377\334\342G\2152"
+	.ascii	"\213\354\364_\030\377\245\372o\214\037\337\311-\252\341\322\271"
+	.ascii	"u\236\342\033\\\356\033~\225\304\267d\346\217\026\371\261Vf\377"
+	.ascii	"{\301\237;\360\343"
+	.string	"\270\274\374\334\351\260\333\006/\272\332/\370S\030?Z\0065\363g%:\204\335\324\376\363\253\030\374\350\\N\346\246\037\r\3743\362\3177\257\370sF-\220\225r\220\003\377\305\221\363\221\310\177\265k\360\247p~\034\347\017\316\237\231~\324\202\274t\240?]\203\333\\\017\335\377+\270\376\323/?*<\376U\021?*f\201\254\364\243I\376\007\346\025w\361\371S\262\037\263\375\250\337\237\215\377E\373\257\331m\373o\332\177\307\344\342\377\242\377\222\371\320\257&\375X"
+	.ascii	"?\346\340G"
+	.string	"\227\377\321_\335\373\321\035?\332\343Gy\374\250\216\037\305\361\243Y?\252\365\243\004\310\033\370\321\346\217\336\370\321\253\037\355\300\237\207\377\203\376`\001\376\254\201?S\340\317)\376\\\302\237\037\360g\006\374y\204?\207\360g\023\177V\300\237A\3703\002\376L\200?\217\370\263\007\177\376\360g\017\177>\3723\207?o\360g\r\177\316\340\317\027\374\271\202?O\360\347\242?K\360\347\n\177\246\360g\241?\373\374\231\347\317\372\317\371\317\370G\003\177\024\316\217\376\375\250\337\217\266\371\3215?j\346G\307\374\250\230\037\325\373\321\274\037\365\362\243Z~\024\313\217\322\375h\225\037\205\373\321\267\037\225\362\243f?\332\344G\227\374\250\222\037\025\373Q#?:\344G\301~4\310\217v\375(\220\037\375\361\243\035\370Q\f\374\350\005~\224\002?*\201\037E\361\243\021\370Q\007\374(\003~4\204\0375\361\243\n\370\321\004\374\250\001~\224"
+	.ascii	"?\352\301\217~\370\321\243\037\355\360\243\033\374\250\206\037"
+	.ascii	"\315\340G3\374\250\320\217\347\374\350\005?\006\3741\233\037"
+	.ascii	"\235\340G\213~t\350G\177~T\370\243\301\037M\177\364\3768\360"
+	.ascii	"\307t~\034\347\307\177?\366\373q\233\037\247\371\361\231\037"
+	.ascii	"\223\371\361\230\037\213\371\261\336\217\363~\334\345\307Y~l"
+	.ascii	"\367\343\272\037\317\375\270\312\217\337~,\345\307n?n\373q\332"
+	.ascii	"\217\321\376?\340\277t\376\247\370\357\224\037w\375\027\004\377"
+	.ascii	"\325\376o\371\261\331\217\235\374x\311\217\223\374X\354\307E"
+	.ascii	"~<\344\307B~\034\344\307^?\006\362?\360\307Z?\306\361_\356\307"
+	.ascii	"<~l\343\3074~\274"
+	.string	"\364c\021~|\364\343\r?\036\3721\317\177\353\374?\361_9\377%\363_\276\377\272\375\327\311\177\024\377\335\361\337\252\377\276\370\257\b\376\033\202\377z\340\277\033\376\327\375\247\373\337\366\237\355\277\363?\331\177\274\377E\201\201\201\201\377O\321O\001\207\037\002[\002vh\200e'\024\001\004\263\343jV\220\f@+9\234\017G\325\361_x\237\242T\365\251:\324\034\016\230\322\345o\212\317T\0321sp\306\201\262\375?\223\033^b\340\374\fd\2506\324+\325F\231j\245^\251V\030r\354\335?\"\201s8\037\003=}\f\224\350\f|FWk\374\306\2515T*\016ia\232(\t\252\033\363\321\005gu\352g\216\330\034:\234\217\001\227>\006<4\022\020#\016\256:c\306\263\214\260\237\256<\244A\331\034\034\203\255\221\250\214\256\312Pe\340=\302~\302\322\220v\003\r\360\231!\216\246\300\317\350*T\234\n\245\302"
+	.string	"!\213kc\031"
+	.string	"\255K\f0\237\241{\223\203\263\032%f\314.\214\031\375\fX\364\021\035\243\253M\265y\347@\030\262\237\232\032\320\366\2628\320bl\354\352p~\006(\232\303\226\321S;q\251\2354\260\031\024\327u\002\227\353\005p\207\r\234\323;<sqYW8?\303\021\375\fA\344\244t\344\260\315I\351\314\021\332Pe\212\214\355\254,\016AntG\376p~\206\037\372\031l\300I\343\300\271\003L\343"
+	.string	"\372A\301?\352\334\201\303\371\031\244\364\0010G\007\340\313\350\351\337\337\345\002\302\020\256\247'\r`\310\356\364\265MA\002\2005}A\016\243\247~~7\f\bY\\M7\031\314\240\254=S/\3008f8\037"
+	.string	"K\364\327\254I\333\324\275\257\223\313\206\325\316\262\342\360\201\036\233\264\r\233\264M7\367n:\267\215\242,\177Y\034\200\354\304\300\260p>"
+	.string	"\272\364\001 Cw\260\303\350i\232\2704\r\336 \274q=aiX\353\372\272\322\243\266&\352\t\316\277"
+	.string	"\216\036@\236\321S3e\3223x\337\215\265\357\2141da}\333\312\311\301/\370\242\177\001\024="
+	.ascii	")d\310\244mdv\027\214i\f\304\350\351\2301\330N~j\333X<0\354\332"
+	.ascii	"h\361\250\255m\261\202\363/\b\323\026\236\214\236\212\211K\305"
+	.ascii	"\3409\032J\212\353\351+\204\031\231\033,@Wl[~\340\374\013\266"
+	.ascii	"\306E\214\236\352\351\301\330k\243\345#\207M\316\031\234o\201"
+	.ascii	"\027=B\013\017/\315\273\320\336\033j\357\255\037\352\2154\017"
+	.ascii	"{\365=\361\3009\365\222r\375\027\252s\240\254\005\342|8i\216"
+	.ascii	"\377\302a\226\260'\316\267`\212\376@\315\226-i\027\017uv<\317"
+	.ascii	"+\275\277\224\313]C\001\265l\3251\323H\200Y\262|\251'@\215\231"
+	.ascii	"\341|\013th$4vv7\307\r4\3002!\177Sy8\277\202>\355\341\251\256"
+	.ascii	"\216L\030\246#\315\030\316\257\300N{\2502J\255\334t\356\306\245"
+	.ascii	"s\227\013\207\375\3244\312\001%\315\3121\304\f\347W\240\246\177"
+	.ascii	"/\027U\3036z\n\367\033\227\302\245Un\323\352\356\r\307\027\326"
+	.ascii	"\267w\026\007?Z\312x\274\3019\215\353\261\321\226\347\207\363"
+	.ascii	"+ \323\257\340Kc\3204z\372\026\227\276]\272\374\324\266\233 "
+	.ascii	"\372\304\274)\333;\213\003\237f\f;>p~\005Z\272\002\035FO\245"
+	.ascii	"H\271ar\263m\333\340\221\361\265\366|\356\315\205\0034\007\035"
+	.ascii	"\333\033\316\247\240O#\345\031\335\265\233\272\375\037D\334\270"
+	.ascii	"\324\355\256]\347\266a!\007\024\032\340s[q\341\240'N\217/_p>"
+	.ascii	"\005X\364\007H\214\322\265\324\371\224-.eK\333\356\336{g\355"
+	.ascii	"\246\237\b\036{h\200\317\235e\305\341?\234\033\227\266\235\215"
+	.ascii	"O\005\251\230%bp8\237\002-\375\377\356'\253\2757V\352\334VP>"
+	.ascii	"\352\177\177\323{9\374?\027\275\031\374\317{'%\340\3341\336\250"
+	.ascii	"\331{\3377\232l\356\311G\206\235\352YI\271y5A\360\272\212\362"
+	.ascii	"\332!\345\346u5$\345\346\265\233Qb\315!\253\355\325\224r\333"
+	.ascii	"{(*\252i\202\353J\312\355i\017I\271\355\253\rC\314\325\335N\257"
+	.ascii	"\346\216\342\332C;j?m7\256\253\fRQ^WRnOWCRn^W\333\315k\013\355"
+	.ascii	"\250'\253\031Q\333jh\273y\371m7\256+!)7\256+)7\2575\227N\215"
+	.ascii	"\263,\035m\324\034\311\273~RQ\273\212J\353\311JHO\312\311\265"
+	.ascii	"\315\354}\337bl\253\255\267w\006{kqY\231y\332q\351\240\364\252"
+	.ascii	"\240\252<q]\347\336\033\003\025\324\027\327\216\322k\336\255"
+	.ascii	"'\265\204k\357%PL\233j\357\275C4\235z\233\310\325k\006\321\332"
+	.ascii	"S1\366\236`;\367\246\332\273y\267\336\336\273\271\367\016Zi9"
+	.ascii	"\367\356!$5FE\265wV\021\325\326j\326\305\330\033\277\241\241"
+	.ascii	"\273\222r\373\342J\252\223\3426\266e8\233Wj\212k\217m3^V\332"
+	.ascii	"\255\311\266\247\366\336\367O\217]\335p\203sZ\021Q\0354'8\177"
+	.ascii	"\2024:EC\222\304o\f\347O\220\227\232\005m\201\003\204\356J\352"
+	.ascii	"\244\205\233\260\273)M\310\322%\330\212\016\2762$dci\022\037"
+	.ascii	"\252.S\370~\214\035I\305\360\216\032J\260p\376\004VG\302\322"
+	.ascii	"\"zO\216\020<:aD\206\344!9\233\303\371\204\340"
+	.ascii	"\0177X\1778\037\003\033'\312e\313\221)\234{\306\214\236\006\371"
+	.ascii	"\215K\203\244^ \274q\355\033#\310\232gn\236{gq\020\364\242f\217"
+	.ascii	"\301\371\030\354\364\237~y\345\254.53\234\323\256\016Py\022\210"
+	.ascii	"\3631\244\351?\345J\201\360\360\310\001\303\312\347\322-\266"
+	.ascii	"\261\275\267\220\017\2327V\336\234\244ZB\256\036P\236p>\006$"
+	.ascii	"\251\217\247=\322,\270-\260<\234\323\254\364*\305B\331\254B\330"
+	.ascii	"\343\221\362Hw\334\2704+\325\221f\2457\322\034W#\310\240\300"
+	.ascii	"\350\202`t\021\223\241\346c\360\322)\016\237'\035rap>\006\036"
+	.ascii	"\372\030\260R\254\317a.0~[O\234\217a\206\376S\253\264\352\314"
+	.ascii	"\307\025\0328\247U\351\324\001\232_Wl\334\270\264*\245\372\007"
+	.ascii	"\021\277\316\275\237\004\271\321zs#\347\027\331\321/J\243\377"
+	.ascii	"\264\306\035a\016\033|m8\377\2629\003\005\214\256\354\315\r0"
+	.ascii	"\272\247\232\033`tO\2748[cO\376\276\300\350\312\232}7\214\035"
+	.ascii	"\030\335\363N~\242x(\233\225\216\203\372\321\327\005\016\024"
+	.ascii	"\030]\331\2316i\316"
+	.string	"\374\356\232\0214\003 \003\243+Ki\344\300\264\231J\3459\271N\372\224\302Hw\246\223\306Hg\244P\331N*#\215\272q\371N\226\003H\366\007F\367Lb\303\344\017\214\356y'\273\271kd`t\317;y\215\023(0\272\016<I\266\270\334d\220_\004E\277\250L\277h\207~\221\f\375\013w\364/\244\321\277p\247\177\001N\377\002\232\376\005$\372\027\266\364/\314\320\227\240O_\002<}\t\332\364%H\242/A\227\2311\251\225(J\304\340\374\213GE\r\237\0253qe\362\227\314\227\301d29L\316\313b\262\227\274\227\361\262\336\215\313c\362\035\336\026<\f\365\345\214\\\256\273zo&\256\200\351\353\322e\254\312\231'yL\276\222\263\\\2757\023\200y}pi\306\374\362\230\254EnL\346r\347\256\336\220\235kx\265\271S\266\367\306g4\262\322L\220oa\215\276\005/\372\026\340\364-\230\351["
+	.ascii	"\313X\262\237\232X\r\234o\301*\333=3\035\217\035\250+Y8\277\202"
+	.ascii	"\232<W!\214~\205*\372\025\226\350W\370\241_AJ\237\350\215\376"
+	.ascii	"\363\333\024\037#7\326\220\301\371\317S\244`&t\230P\341\034\245"
+	.ascii	"\n\240\023 8\237HO\377\276a\222\226\246-\237\201\360\004\016"
+	.ascii	"J^\313\316\314\226\325\262[N\313h\371\311\215\313m\331,)\267"
+	.ascii	"e%\231\f\b\335\373im,\311\333\030\225\261%jM\236\200(;\023\221"
+	.ascii	"\333\262\023\264\214\0224\300\262\016f\262"
+	.string	"Py\253\220OdD\237(K\237\310J\237\b\206>\005;\372\024\340\350SP\2433\331o\030\026\t\017)8\237\002\031}\n^\364)\324!\021\313_\326\316\204\035\311Fn\\\026\313E\334\262X&b\200\263\267\276\275\235Y,\207].S\334\220\365\371\004*y2E\315\247\360C\237\002\224\376\320\031\375\347!\031\254\207\016:Pp\376-\203CM_\376\312'd!9\310\215\313`\331\353L\006\3139\322\364e\260\254#w\241N\272\006@A3\006,\337H\273\"v\006D\244N\221)\236\374\2415\315\205/\234\"I\356\340\374!1}\020Yg}\371G\356\221}\by\322\227\267\262V\006r\343\362\217\314\003\347\037y\307\345r\365\206\354\247\346\210-J\302\316\236{;\255~\360\345\351\234}<uV\324\224\016\234?\024C_\b\216\276\320\030}\241-\372Bv\372BN}!1}!+\254\253\240 tl"
+	.string	"\261\3126n\\\276\312U\316\251\272\300\273g\276\312TL\330\002\357\236{;\213:t\b\242\231a\022\246\346\007\225\321\017\372\242\037DE\377\271F\246\321\023\005\255\b_\236\221\245r\214,#\303\270q\231F\206z\216\272~\277w\356\232\006&a\304"
+	.string	"\237h\340\221f\221m$\323\310O\"\272\304"
+	.string	"\313\366v\006\341\232\224\351\362\311\351%R\037\324D?\350\210~\020\227~P\225>\220\034}\2401\372G\355\324Qe"
+	.ascii	"q\003\203\326\371/\037J\347s\230k\357*{\357\013z\006\034;sp\276"
+	.ascii	"\373ZP\177t\316\037\232)\030b8\377\372\2411\303\306\f\232.g\316"
+	.ascii	"\254\371\322\006o,\r\230\261'\032\007\225\203\276A\375P@\324"
+	.ascii	"\r\n\347\306\241\177h\337\257\363\"\330\3340@\350\336[^\306\376"
+	.ascii	"P57\fP\323\271m\004\213\204\001\314z\356\355\024j\311R\002H!"
+	.ascii	"\037\210L\037(L\037\b\210>P\226>\020\r\375\237@\375\237?\375"
+	.ascii	"\2374\372?ye\336\340\214\241r\207\363\217\222\031\323\005\244"
+	.ascii	"J\r\234\371\244\240o\250\223N\313}Q\361\241b\320=T\017\rs\343"
+	.ascii	"\3201\350\227\243y(\230$t\f\272\345k\fJ\005\325\202:\351\036"
+	.ascii	"\2607\3257\006\3652c\f\312\005\305\273zo\373\t\313C\222\2563"
+	.ascii	"7O\0372rl\234\361\311\227\353ZP+\\\"\365?o\372?i\350\335\335"
+	.ascii	"\003\2343\003\347\377\210\241]~\202\350\377\354\320Y0\250b|s"
+	.ascii	"\262\340\374\237\246n\242uWoH\276#\207\005\275r\343P;\024\316"
+	.ascii	"\016(\335\373\311\312X\017\220 W3\324L\027\205>\273\320\305\341"
+	.ascii	"|\2372V\336\306\236\250\310\241sh\225\033\207ZA\343\242\254\234"
+	.ascii	"\340GF\311\263\250C\n\330'\307O\347\373\034\321\367\331\241\357"
+	.ascii	"cCO\301\340\203G\006n\343\374\036:\372=f\364\217FA\335\262\330"
+	.ascii	"\341r\005g(h\333\215C\335P\266&\252v\365\206\230\230S\247\317"
+	.ascii	"\r\235\201:\201\322\275\275\350\214\355\2751t\350\300\343&\254"
+	.ascii	"\207\232\337\203E\377\350\332Q\347\357\334\345\272\320sC\357"
+	.ascii	"\f\017\234?$\035]S\313\260t\311\3019\255\350\347\004.&@p~\317"
+	.ascii	"\023\2646O\320\263\033\207\242\241fnh\301#a\316\334\240r\334"
+	.ascii	"\276\364\251\371=0\312\232\260I-\201\303\371W\316\207\331\022"
+	.ascii	"4\t\352\004%C\231\240Jn\034\332\004\025;\212\004\035{v\356\035"
+	.ascii	"\2056A\267P#(\233\025\003\366\220\364u\341\2016\246U\2066A\217"
+	.ascii	"\210\241M\320\036gc?\316&e\002Ol\330(\302eF\335\302U\262\344"
+	.ascii	"\214\224Q\357\024\340fJ\b\231\240\0223\\B\246p\376\215\323|m"
+	.ascii	"Tx\f\371\302Y\213\321{\327c\256\307`=\006\r\fT\323\306L\321a"
+	.ascii	"\32438,tl\350\251~F\304\230\361\3029iH\227.:\257H\357\264\257"
+	.ascii	"\271>\0376auv_\256\363\3205`_g^\376\013{\216l\351\361y\301\353"
+	.ascii	"Q\223R\247v\202\017\231/k@\356R\035\370\315\232)Rp\276\b4:\t"
+	.ascii	"\212\026-z\013\032\024\030\335\255\002\205\315\337\226\033\346"
+	.ascii	"\314UY\032\316\027q\247\223\236W\256h,E\\M\277\020~7\356\364"
+	.ascii	"my!S\306\356\032Kz\326\263\265'\366\244\354\277\360B`\021\031"
+	.ascii	"Tt\022\037\035]\332f\006\005\214\356\231\247\027GM'\315U\251"
+	.ascii	"\242\345\314\366\300\350x\340\340\300\301\320V\256\345\356xq"
+	.ascii	"\322C\004\022\rB\016\034\234*\306g\245\f\236\331\026\234/\202"
+	.ascii	"\206\006a\346\355M\025+\302\263\022\363\346\271\005\306n\t\316"
+	.ascii	"\017\021\250Ax\221\"\205KU\223\347\323G\t\026;\037h4\210,nnC"
+	.ascii	"\306\200\336\264%I\202\363C\\\321 \344\332\332\324+UM\236eA?"
+	.ascii	"n\\\211\202\363C\250i\020hNg\332\0268\226\345\326\314\264p~\210"
+	.ascii	"\0234\210\260'O\264Z]\363\353\n\236\202\342\303K"
+	.ascii	"\273V\373\211Q\305-I\312\204m\310W\021\234\037\342J\203h\323"
+	.ascii	"g\372L\275S2%\215\226\030\316\017\321\324 v\3502]\226\266\335"
+	.ascii	"9Y\n\035-Mp>\210?\r\"\206^\242\227\350&M1\3002 #Q\250\324ar\335"
+	.ascii	"$M\016\315\024\316\207\023\304\373/\324m3\310\356\340|\020x\372"
+	.ascii	"C\240\022%\3013*$\200e\350\234\023,`p>\b)\372\303sl,m\263\202"
+	.ascii	"by\302\360\202\363A \321\037\304\204=L\213\025q5\001\203[Ugj"
+	.string	"O\254\264\215\245\217\\\213\361T\321a\022\005\347\303\321F\262\254\355\031\321E\330\314\232\274\341\254\213d3\036\265\"H\222\314\321\037\264\f\031\242\336\025q5\341\250wUM\236O\214W5W\207\363?\304\351\017_``\200T\201X\317f\337\316J\242?8\203\004\321^W\310\t\265'7\026GKX\016\234\377\201K\177\b\323\\\232K{\231\375\255=\203s?\306\250\272\256\275.\027\034\226eN/U\222\306\253\206\030\234\377\241J\177\320\332\332J\272\322\346\216Z\247\3455\304\215\376\220CK+\351\251\315\23524-jK\025\234\237\224\247?T\365\350\221\266\251o\252\304\260\312\326\350\354m\341\374\2440\355\241JV\326R\203\271\263\343\304\371I<\264\207(:t`\300Qu\002\340\223m\212O\f\347{`\243Al\341\300\321%\006\370\274lC\332\310m\321\036\324\260\260\212\334Tyayf\266/a6\316\367"
+	.ascii	"\247=\f\251\252\322VE\\M?\rI\374N\340\0024g\3466g\343\332\352"
+	.ascii	"\316\215\221\271\321\345\201\210\366\320\245\247\364\324\004"
+	.ascii	"\252\274\260d\201\2031\006\347{hj\017=4\rM#m{C\025\210\365\263"
+	.ascii	"\305L\340\036\316Gr\352\020it\f\035CK\241\375\201\321=1\231\031"
+	.ascii	"\277-Z\306\265T&\242&G\232\273F\003\313\256\210\016\221\246\243"
+	.ascii	"t\224z\227\006\005F\367\254\263\353\332\302\371H2t\210$\272\251"
+	.ascii	"\233\372\351\266m\033=s_kOt*\007\226%\372)5\022d\223\007\346"
+	.ascii	"\016\347\037\371\351\020>\342<h'N0\220HM\321\206\212\332[Z\301"
+	.ascii	"$T\200n\236[J\213C\312\005\007\337\326\235\007\003\237\305\207"
+	.ascii	"\220\253\250 \235\007\353\374\302`\031>\274:\035\224\363\340"
+	.ascii	"\234_\230\372\270\221f\t\316?\252\242\377\340\363\027\372\f\361"
+	.ascii	"\222\347\006\347\037I\321?j\323!h\300\201\243ZQ\245\271S\006"
+	.ascii	"GEJ\033\316?B\242EP\375\375\245mE\\h\0336\300\254\237&[?\234"
+	.ascii	"8\377\210K{@\346\347\227\266Aq\203\005\255\f\325\034\316?\232"
+	.ascii	"\322!\250\264i\023TR\241\016U\033\265\0370XsW8\277\2032:\004"
+	.ascii	"\0304h\202k\346\344\023\346\244\241\t\256\t\252\221\303\203\313"
+	.ascii	"\016\316\3014F!S\260\340\374\016\362\364;\330\242C\324!C&h\346"
+	.ascii	"I\225\346\016\356\361\227\027V\346A3<wb\370\305!\371/\364\200"
+	.ascii	"\246\210\030\316\357\240L\213\220"
+	.string	"\0333&mC\242\206A9\277p~\007'h\021Y\304\210I\333\216\2141I\323\246\207\363;\310\241Ex\321\323K\333\372\250\312p\221\342\006o\b\316\027\300\030-b//\017\311\215\265\347\323\310\336\336\202\363\005`\247E\264\341\302%\350\245\210\253\351\206\003\232\237\030\240PK\336\024\021/A<\037cU\320p\016\336\371\004\226\331[\303\371\002h\013v\t\323\"\350h\321\022\304r4jo=\307\366\316\342\300\223\345E\316\f\316\027\200\016\355\301\324\225+A,E\\\350\232\277\265gY\332\004\253.\212\335\203Xn`\230(^\214\220y\301\370\303\371\002\210\322\036\326\310\311\005\351\326\272\002\357\260\r)\"e\346n\\\220\016\355\212s\007\316\207s\303|\001\252\231\303\371\034\320\321\036\302Ty\025\365\256H\3574!R}Ab\366\254<\315h\017wpp\021\300\022;\323\312\333y8\237\003/\332\203\335\333[\332\226"
+	.string	"\266\300;\237\0351\330\266p>\007t\332\303\0354\264\240\224\333\266m\024\245\205\371\272\002\201\264 rQ\036\224r/Z1\350p\016:\203nAsh \001\343\006\305L\216*1\234\203mE$\254I\333\202\3639\200\242\331\360\335\377}w\204\313\037\316\301\264\340\332\177\241\317\232@\036WkA\265\274\346\0271\0300\225\"T\\8\007\237p\300D'\251)+\013\232\025q5\3758"
+	.string	"R\235\275y\356 3\233\0214Ksd5Z\002\353\340|\016nh\021F\2324\271\\\250\234h\t~\325\371\002\325E\213\340Z\262\004D\22237ym\207\221.'ZD\331\330XP\311m\3336\npc\355Y\206\236\315 \003$\311\203J~\340D\321S\303\371p\360\376/T\363l\324\231\203D\213\300!&\246\336\335\266m\343"
+	.string	"7\300\350\312\366\316\342\240\247X\241\235\341\374\0169\264\007?\214\376\007\303\202aA#E\\M8A-*$\034\200\366\300h\324\b\026y\320\b\024\023#V~\374\027\376\224\255\341\343qF_=\243\007\207\f\301[\317\330\333\253G\017\026\225\330\330\320\021='e\272\203\032F\017\202\201\335\265\334tn\033\025\326\256\276\256$\321YI\005\321G4\214\036\374\372\n\006\311Q\316}\265\002K\354\354I%K\234+8\007\203\030\351\320HYF\017v\005\273\356\032\bY\007\370J\323\267\255\270p"
+	.string	"t\247\245\346\f\3167\242\241\221\322\214\036\004\022\004\242\236\345'\241\035%\344\216n[eq \304\353!%\006\316\347\240F#\321\375]\265\243\336Q\003o\234\372\027\374\221\004\265\237\3424\244\355i3\275*l8k9k\360\210{\303\371\034\300\350\337';\370d\206\017*\330\254"
+	.string	"Jj\204'`\372b\004\245\256\336\020\020\232x\351\243\021\304\272zYB;JNM\237\216`T\260\t\324\034\332;H\336XV\320G\260GpG0G\220\307\215\013\352\b\316\270zG\r|QPG\020\306\227\276\0362p\220\350\001\345\3755\025@I\215\240\206\246/\210\025\254\021\274\252"
+	.ascii	"Jj?y}\240\205\352\353\3153x#\210\343\306\005\261^\344\334\373"
+	.ascii	"\r\303\017\2353O55\377\301\253\240\025\035\r\0372p\016\332\270"
+	.ascii	"nx5\202\340|\016b\372\017R\335\270`\225\022;b8\007\247\276fF"
+	.ascii	"\223F\r\234\017\347Y\376\013s\216:\264/8\237C\021}\016B\3649"
+	.ascii	"d\351\240\f\315\327\367#\017\347s\300\322\347P\245\317a\206>"
+	.ascii	"\207\246\376\206:\372\017>\005\233nw\301\346\336\227)(\234\277"
+	.ascii	"\341\251\261\363ZP9\\\"U\235\243\326\t:\243\003\213\303\371*"
+	.ascii	"\235\377\302\007\204\201\211\3039\313\301xH\306\250p\276\372"
+	.ascii	"\0042#F\205\r\347\253q\376\013\323\270\3007<pV\001u\214\rh6\360"
+	.ascii	"\374\220\003\342\343\315U\300_\005\243\302\361@\240\23588\337"
+	.ascii	"\314\265\240\242?\222\256\276\311\323\322\267\206\3637\274i\244"
+	.ascii	"-F\327\354\252yW\373\362T?\016YO88\254Aiq\220i\240y\nR\024d7"
+	.ascii	"\006\304\ngU\215\312Fm\363\013\205vS{Z8\177\203S_]3D\314\021"
+	.ascii	"&8\343\373,\252\212\346j\232_\030|b\025E\005\347o@\323W\315\250"
+	.ascii	"g~!j\307\213\335\f\234\277\201L_-\363_8\2024]f8\253dt\214\rA"
+	.ascii	"6\b\321\264\255)\242w\225\314\257\206\271eT\276\rL\371\310j\203"
+	.ascii	"\263\272\247\216\271\312\247\212\331*_\b\256\275\237T\276\240"
+	.string	":{?\005\335\213\301\275\030\344\263/$pj\376\006 \032\350\022\251*\230\244\253z\030\311\033\036\036\316?\227H\375\006\200\032\351\311\213\227\273V\264\233~\036\322\24060\243=8\353\322E\275\023v\201\242\226\251\261\025x8W\357\204I\310\276\246\266h\017\246l\331\222\245'\213\034\232/8\177\203)Z"
+	.string	"\201FW\263\250YR5\017iI\276\256"
+	.string	"=\221\022\303\245\211\376\371bt\325\316.}\002\302\033\327\306\n\341\344\017\214.\214-\016\\\020\355A\03299\265\016\216jG\206\006\370\344\301\343;\323Gw\265\356\256Y@\n\231\033\234\325\2714\007\320\224\327\225\255\263\377B\036&A\212,\301\371\033\330\320\003\310\241VQ\253\250b\200j\032\224\277M\243\f\347o\020Co 3\272\372\366\246\302\345\250\266\335\004\262\342\246\315\035\037D\366\346\340\254Ry"
+	.string	"\227/v8?"
+	.string	"o\364\003\360EK\220\304\350\252\024)y\n\bYm\033+\250\310\023\032\240\372d\013\024(\234\037"
+	.string	"(\372\347\214\321U7\325\255\002Si\236\224\361X\262\344\t\316\017"
+	.string	"\230\036\261gt\327\256\312\326v\32724\235\333\306%\373B\003,\013@\226~"
+	.string	"\244\364\2106FW\325\376\017\"\3244u\355\256\345\235\265\233n0 #\323"
+	.ascii	"G_\203\236\036Q\345\311\237\250bz\223A\2519\246\220\311\302\371"
+	.ascii	"\032\264h\244&FW\313\312\3243\rco\257\037#\322\320,Ux\334\251"
+	.ascii	"f\302\262#7N\300\371\032\320\3645\370\320Gf\214\256.Y\2426I\300"
+	.ascii	"\223\330Y\332\034\003\226\205\263\312\0047\331\204p\301\371\032"
+	.ascii	"\250\3645\230\243;\310\031]\035\033S\225\200\220\305\365\364"
+	.ascii	"4\302I3\360\356\331\247E\253\212\232\004\217L\2200\234\257\201"
+	.ascii	"\032}\r\272\350\001<U#\252\021U,\307\236z\344\252\030\320\223"
+	.ascii	",}r4`\323"
+	.string	"\024p\031]\035\362\033\247\016Q\303@\310\342\3327\004\340\344J\f\360J/lL%\362\363\354\332\302\202\3635\020\323\327@\207>zct\025\f\214,\005\023BF\006\347kP\245-\3103\272\032D\rB\206\231\234\271\031\301\371\031\334\321\02301\272\352\365\033\247z\241u@x\343zJ2\202\314O\f\260\207\315\2142G\336\350\017pp]\345J\333\364\306\360\203\216\f9?p~\006d\264\232\306\350\252\226\252\245n\345f\333\306\002:R\007\230\205\345\264y\223\207\263\372\343m\213\035)n8?\203,\372\031\254\351\017\310\364\350\221\266I\340+\373\210\233Z\202\3633(\242?x\032\335\270zC\315\322;\001\001>\307e\205\245\262\204\2376\351\244,\021\2646\035S\254`\022S\264\353\222\020\023\323\251\004\240\020\222$\\\230\240\201\004\024(L\340a\222Pa)yd\225\3551\251<q\201hmE`\225,\273"
+	.string	"\343q)\201\205\225\004\363\030\264\026\223+\362\210\342\207y\201\271\032\225'*0%8\323\021\221\331&\327\246\226\351\304\001#\211\ng:Z\225\210L\344\221\250$\224$\301|A\244"
+	.string	"\206\344*d\0342\256,\221\t\305\312$\256\310\225\245`Eqe\032.\231MHKf\023\263e\225%\254-\261\250D\"I\240X2\233$`\n\235\351\310\210T\216\320\"}Xe\b\314\025\305c\313<J\300<\272 \321\202h\001\237\fg:*\262\022\b-\035Y\020\223HF\345\t#R9\2021IbmR\216\300*C`.E\310\260\224<&\223N&\260\307\020\230G\r\226,\234\351\210\271\224<\262-\023i5:!\213\311#\022\313tB\272\320B\3112\265\312dP\211\270\"s\313L*\213)SI\te.\327U\001\024\240\300\304<&\217!"
+	.string	"\275P:\266\312\007\030\223$X\020\231Dg:ZY\247\226\270*\005\333!\363\304\021\211DR\036U\250BCg:b\225-\261x4&\217L$\345\221\211ID\206`\\\035\260\224<&Yb\213 \346Qh\035\n!\235\212Hb\361B\322\211hhE\252 \246pql\322K\311#S\002\354\352\342x\202y\244\300T\262`W\024\355\221m\321\323.\177\316t\2646\035[%[<6\251g:\"\252 *\200y\304\220T\036\231G\f\202k\273\"\227M\312\022J\366\205\b\314\343jT6-`\002$\244(Ab\270"
+	.string	"\023\02081,a\302\020\005\tCg:r@\n\022P \255(*\221%VVY\"\210H\001\242u\270\026Y'%\212\326i\231<\376\264X\037@l\211&*`\002\363\330\363b\251,aA{\246\243\245\223\222]\032\022Y\342\022\251\230t\n\241'\251\204S\346pi\351\323\016\223K\3134\271\264DW\017\034\231\231\311\\Y\243\221\030|\261T\0263\333.\321\377\274`[\346qi5a\210\201q\r\032W\246Sf\006Ol\211\306\341\322\362\b\210%2\025\363pm\211\310e\323\232\242]\231\253\tKK\016\314\037\023\230G\241 \241\241\025\305\225\251D\362H<\261\202Il+(\331\027\"\254`\022[\335JP\002\303\231\216\216\310\"RQi5*O\034\221\305\340O\322Q\022\002\n\b\242\360\341\310\310$a5*\233\330#\261\202\013\023\204-"
+	.ascii	"Z\n-\005\346"
+	.string	"\252\302\tE\362H\274\320^h\n\006\031\223\304\246&e\211\"+4\"\225#,\021O\374\264\026\210X\020Q\030\223$^ \227K\242\006\033\034\231\312\022V\024\217-\212\244\262\304\2124&\211L\035\264jR\311$\256&\030I\264L\"\262\250%\241[\"#R9\302jT\236XW6\004#qe\022j\207LvE:-\300BK\324$^\260\355\217\372s\246#vE:\031W\246\"\323HT:\240\250%\266L\036\n\036\216Z\226\270<b:\265\304\026\005\t\fk\323\261]*\225\0160\036Kh\327%\226\330\016]\360p\2646\035S0\235\224G\026+\273\304 \001V\331*OPHKh\223+\313:\025\207\316t\264\344\244b5\"\031\221G'\025\030V\243\362\304\222\223\212\325(dW\344\n&1\205\n'f\205\245$\363\370\323\244dKX\300\002\224\355\312\202\210\"\2035\2514\301:1\211\353\211"
+	.string	"\254,\216m\261\002\022K\311b\2056\210\330\022M\024Y\365LG\305\341\332tl\223N,RQ\251\307\2706\261$\212E\022\024\274\230$\341\202\027\217\354\232\\\227\364Cx\320\201\007#\\\004?\202"
+	.string	"\036\b\340A\375\b\002$%\021\300\203$}\017\222\320\266%\266\310\325\304\332tl{\326\241\221\204\025Lb\n\245\"\317:\\[b\213\342\210<\252 \266(\214\307\345\005\243\362\304\320:\\\256\253\n\237u\310\\\"\"CX\221*\210\314\243\211\nm\323\3322_\240\230\240m\211J\244R\272\016\215$\270P\252\b2\207+r\331DD\321\0165S\002k\323\261U\225J\230 a<.{\230\314\265\250d\227C\343q9t\246#%\373bi\002%\373b\311\207\207UqD\022K\264\311\265ie\241<\241d_,e(&_0\225\226H\275._\264\024\204\326\226h\\:\rY\3461\310\003L+>\200\030\256L'\240\225\3514T\266=\253\361\310tR\022JJ\3720\364"
+	.ascii	"S\205\017\303VI\311,j\2414&\217-\204\230+\210\3532\371\302\030"
+	.ascii	"t\246#\f\206\210BKI\245\003\\\034CP>\200\271\\\032\0222\256-"
+	.ascii	"\205u\030\202\221U*K0\227\"Xh"
+	.ascii	"\211M\254Ri\270\266\304\344\321\310*\225\305u\330\036\223\022"
+	.ascii	"\350i\217I\247cqe\227L\242\022\213\341\213\025LV\311\230tR\242"
+	.ascii	"hb\211H\022m\253d\222\340\005\333\256M+rM\301$1\001"
+	.string	"\343qYa]\"\266H%\213!\022\271\026\207-\253\\\256,Q{\246#\244\242\206\025\304\225U1$.[\240\265%\232@Td\203#\326\226hB\221\r\2160\036O\260Lm\220ej5sm\211lj\202\204\022X\246\024\311\027F\341\b\345\322\305\002Z\020-Pdy\316TTb\202aRyl\213+\313*\213\303\226\202\237\366LG\255\323\262uR\016\233Z,\221\230\354\312\342\310\03230U\026\253\t&\322\251\004vm\223k\t\241\265%\232\320\324\242\004\037\026\253\021\355\300\312*\r\231L\342\262\205\0229\244\240d\301\256\314\241qmb\211I\247\341\221m\207Z\226\330\242XJ\036\215,\261\005\253\f\301\2023\035!M\360\263\27286\t\231-\210/\210\230%\212,\005\335\202\370\302\307\230$\2520\022W\343\320\272\3242\211JC#R\3114l\221\304\n\306\225\311\256,Vv\330\202\370\242\302\231\216"
+	.string	"\240T\261\242HD\252\020jrJ\352&er5\016\327\226\310\362\254\305#\213\325\250\266\314\265\035\262\312V\3314L*\177\212E\342\320\310*\213+\313\223T\036\231\314\225]6)\213=\301\345p5*\233|,\024\213D\236u\b\224\\:\"\211\303b\221(\\Yb\013#Kd\032\026\213D\237\266\035*\255F\fg:\262\200I\201\323\220Y<6\021\223/LXP\262\353\005\212Eb\260e\327vmRRpRZ\215\303\366\302\231\216\222\312#\021\211\311*\231\311\225\231\001s\310l:\262)\230\212\355\261\004c\222\004\022\251d\211\230CbK4\221T\036['\244\022\005s\2714\324\022Q49%\325\366LG\314\345\022\222\362X\241E\022Q\346\260\250t"
+	.ascii	"s\271\364\323\022\221h0\251D\242LH$\272\032\235\332c\213$\016"
+	.ascii	"Q\224 \202\217q]\227(zV&\353\244,aL:)\331%\237\245\322\310\224"
+	.ascii	"\317t\304D*\3316\251,\016\213,R\261\202\245\344\261\211%\002"
+	.ascii	"5\261\304a\313d\217J\303\244r\210$\026\207J\366\305\222\005\246"
+	.ascii	"b{l\301\034\"\221\307\025\024^\020\221\253q\330\304\022\231G"
+	.ascii	"\343P\331:\021\207Z\020Y\364LGNMG$R\311f"
+	.string	"\246b{\\\246-\210/P\346\352\204$\262P\231\303\025yTR\262%\030\217K\237\366LG\306\343\022\251eZ:\"\225\212L\\\346p\204\361\270TK\270$\\\343q\211\256\313\027\355\220][\344Qi\310\307\003LC\245%r\330\202\370\202\307\003L@JJ\312\326\2518d*\266\312\344\220B\233\\\213\354ZB\233<*KX:\031\223G\n\\\350iA\264@\223\023\n\343q\t\264.\021\331\225\005q\310L\256\313&e\t\343\261\204\226\250\202\005Q\362x\242%a<.\205\202^\264G\026\307\366\310L\256(\220+\213\025)\324\026W%%\242\325\250l\032\266\354\272t\261\016[\344\261\035&\225\0368\262J\246\"d\333*Y\246\024\022$\217D\021XeKd\327&vm\217\025\224\307\226h\202\013\"r5\201I\241eZ:\256\024h\223G\345\262]Q4\261kk$2\241\005\361\305P{l::"
+	.ascii	"\271\026\213$\326\226\310\002\031\333%\241\265\351\330\362\254"
+	.ascii	"\310\245$\261\302\332\022\331!\321:4\201\211IdK\030\217K\n/\330"
+	.ascii	"\225\205\262\270\262C&&\221-\002\235\351\310\005\213\344\202"
+	.ascii	"%\272r\271\262H\255R\311\"\3650\207KG\245\244\262\204\013\226"
+	.ascii	"gIl*\262)\273\032\217,\224\354r\350\202E\022\217\354\312\034"
+	.ascii	"J*\217L\246\223\n&\220\213\025\271t2\241\204$2\361 \225Ee\253"
+	.ascii	"d\227A\355\360\003\b\343Q\330&\235\224\305\241\022;<.\231C\027"
+	.ascii	"\354\205\325xd\331"
+	.string	"\225\205r\230<fh\207\301%b\n\345q\270\344\204\\\026\r\265+se\225\255\023qhL\036U\f[\"s\330\344\304\266+\326%\223\002\237\025I,2yZve\221<\016\217L&\333Sd\215\307\2464yl\322+\212+S\321\005\261I\0071K \211,\222\312cKD*\227\354\332&I(\262\027\230\353\312.\255&V\344R\222D\023\261\004\213\245\022\205v8\242M\036\235\202\3105\231$2\025\207.\234\210C\027\304\246 #R\311\304\\Y\246\024kKdql\213$V\243\362\004{$\026%\217N\272\2702\235\206.\210MC\027lO;\364 \251M\036\203W!b\004\b\245\001\214 \036\021\375\203\017Jd\220\300\003D\320\305\243\225U\026\207E%\244\242\022R\362HlB*\262L\244\243\013H\245R\001\303\364\277\020L\245\262r\363\205\216P\2100\b\025\"_>\242\202\2124\231\243\302\231"
+	.string	"g\266\204_[B\257S"
+	.string	"\242\001\255K\f\320\253\253\353\357\216\225.!\227\033/=:@\324\250\037\030pL\204"
+	.string	"Ao\004\225\374qq\203\363=\320\322\277\360\207P\253M\306\216\033\3167$Obp."
+	.string	"\235\016\241\017\241\016a\217ke\345&\2035u\200Y\317\235\205\203\203\260\207\220\307\225\037[\214\2070\253\20420\236\352\017\036\030\201t\264\204;\320>\025\013M\215\020\234\357\001\225\376\2059\322.B\2701l\326p\004\261\304\305\200{s#\305R\243\342!%\304J\363\200\320y\026\271\322y\026\314\251\013\023Z\245j\\\270\356\324\2046\322'h\240\0168k\204U[\304\234W`\340<"
+	.ascii	"3\341\224\220J8\245\267\374Z=\rQ\321\276D<\365/\254\241\345t"
+	.ascii	"\027\330\234(!\r\215%\312V\032"
+	.string	"\033\234\235\025\262\234TIi+\2559$5d\250MH\350s\302\305H\301\370\240\312\300\220\342C\005\313\030\221\250\240\3315\023\304\254\006\024\\O\333\234?\"O\252\022\271=5l\232^@:~\350\345\020n\261`\034\0266Y\002u\023]\004l\210\217;\3015(\336\034\023'v\360\246\302F\257F\035\255\326\245I\237\034\035/\273\215\032\326\034U\354\216\233(uN::UTp\006R\233\030\221Q\027G\r\023\263\345\247\0078\227\205$\221C\203\223\006vx\202\265\275\271\\\324\0350\350\304\351\277\240\021\2773@#8;{\350\266\250\340\360K\253\3440\373\001\246\373\202f\2448I\363\246\333\320=\357\370f8\237\244\211\363\264&\030\350\363\244\rpK\215~\362\222\303\251$\215\2262\262c\r\0204*\214\030G\306\330\341\354\f\210~\250\024\344O\024\206J\311\2620\022\ba\2323\0202\305\352\306\002s\025"
+	.string	"@h<\034\023I\006\3365\024"
+	.string	"\016i\304\246`\037\020\326(K\215B4\0033P@"
+	.string	"( \001\267bC \017\370+\314\026^^\300sU\006\030\034\210\273\346\320?P\242\177&\256n\257\246\362e;N\216\221Y\302\0136L\005\353\341*\264\347\016\262\210\271\224L'3R\270?*a9\303\00542]\3671?\344\310)E\006\017If\345cUT5+\220\037\260\343\226*'\304r\221\317\020\003c\223y\350\273K\266\225\177\361\267\320\351\264\024\270\346s!\bfhv\274[3\023\275\332\013\bd\260\033\336\\\375\305\3056\017\215\354\270\204\333MP\035\254\265F\212\324>i\\\222\333T\242\320\354\2167\f"
+	.string	"\323 "
+	.string	"\251\333\b\206N}i\212k\231\215$\251qVA\216S\343\205n\272\334\232\034\207\310\337`\212\261\006\bS6\034\355\0308\n\032Wvj\316\224Msn\352\3035x\007\214\313b\363B|B\022\230\243l\207\271\204}\352Bn\274\001(\266\241\231\222\250Iyq\241\274*4J\035I\210\354\263\253&5\025X\r.6\373\333\241k3\036\233s/\3114\216Y\0278\027u\231\205\250\314\\S\272v\036j\223\214]\3573\376\303W\254\311\377I\262\261\327`S/0\277\020z#\260d\213\341Au\204\260\306D\037\202\337K\004\t\362\\\206\027\340i\375A\371u\314\rP\212\227\240P\262\203\0320\372\223\327\030\322\223\250\211\026\3275\034\273\203\305\025\240\265\3339M=\241k\177\265\216C\212\240\255o]\344\241s\360\374rBn\f\374\274I)@\233\212\266b^\310\371\274\355\340\266\361\211\216h\245\232C"
+	.string	"\230\311\225Hcd\251\376\007?\005\211+$\027\342`& \342\327\342L\302\354\223\223\200 \302\301\025_\237\362\307\002\234\322\274\267\037Z\222\2302\236a\313\305\244\205\f\364\3102\377\022\221h\311e\352iI/\256\374\025\223\376M\227)H-\363\221G\300\205J<\262\261\275\334'\273\202\231\nR\326\035\217\261q\331\227}n\210gdvq\347\203\223\360)\325Ps"
+	.string	"\201Z\342F\365\211\326\252\311\332on\300}\300\242\235\026/Tu\245\027\374mK,\362\334\335\341\3226z\236\202\330\376\261\337l\363\"\362@\303\353\310\271B\364\333\270\026\352\033\325\032\361)\352\023'\034\342(:\025\350\037\005\307\331\325\223\317\260[\244B3\302\243q\226\245])\307\201\207\2370\301\375\250!\017s\372T\204\251xJg\316/\236Iy\023\362+2\266Q\260 3\022\263x\323\232\fD$\017's\2764\n\277P\361b#L\2163\347\272g*WW\334\265Q\301`F\240\3076$W\374.)<\244\001H\327\226\f\301\203\277\025PH\026-\300\343\2210\200\342\256]\2433\272^\346\bXw\204\036\315\366C\"\247?\270\"\n`\321\221qVU\\\264\346\362\256\345y\233\272pg\231Y\326\030\326\3620\234.\306\340Xx\327G\315\225}\311."
+	.string	"\037\333\321\272H\245\2609m/\364\333\031J\245\024\225x\374\tm\007\360\316zE\200\233 \257\272\033\233\013kn&\233\002\347*a\217j\361Su.\333R\242@\223wXH\354\021\370\226\227A\275\312{\303\003\366\271\2026\177\216\307\224\362~\004\260\201\356\247\211\351\364\327X\243\257\367\300\240\301\031e\032\220\217H\005\204\357Q\317H\207T\021\034O\272e\255\rz\007\277K\365\202\340\317lL\344\276}\376\201\232\223@\313h\341\037n$\0255 \005\343'\367:\036\210K\025\325z\233+s\017\334\255\202g\375\221w\352\035$5\273\354\235W\251-;\005}\360)\311?\276\226Qy\331/|\362\340V\222W\234os]\363\272\005\223AzUi\017\320dn\001\344?\032\250\265XV\322"
+	.string	"\277"
+	.string	"i\3326\250\246\330C \362\002\277\344\031\242>\333[J\322 k\235\374Z\310\026e\3303\233L\371\262\206\342\351{\342\372\303\354\020\304J@\t\372N#f\360!.\036\265\306\357v,\327+\244\250\024Ux\377t[c\206\325\250k'\204#\306f33\t\237\247|\263we\t\335\233\250\331\375.\217_\250N\004\263fM\271\346=.)\270\032j"
+	.ascii	"\227\240\327\224\nDf\036\212\346\212\027\316\321O\030\355h\336"
+	.ascii	"E\260C\203\250\277{\355\023\311>\244\226o\324\360B\355v9\265"
+	.ascii	"\260N]\032\b.\211\334\0223\321\205't\337 X\336\016 \326\005\006"
+	.ascii	"\001\323w\0010Z\312\360\013\005\346\023\256l\013\375c\313\262"
+	.ascii	"\331\001\332\365Jz\342\257\350_)1\270|\204k\320*\324\023\271"
+	.ascii	"\255c\222\346\311td\302.\005"
+	.string	"\270O\343\247\322S\207\021\t\204\013Dqw\306\214c\210O\222\242\376\274^+\211\024O!\be\227'\036d\260`\361\263\337\2154\372-(4G\221\373~\002/\244\001J\366a[(\301\270\302\235=\332|,\005!\2236r\277\302\271\275\351B\350\247\270\323\026\306\223E&\266\341\n\266\264\360\026\240\347\300u\213-\213_/\030x\210\371%@\210\324\357\b\366w\222\237\365\315;\301\337\363\216SF\3478\017c\344\272\365\321z\250O\307SZ\324\255Av*\r\020\336\034~8\002YH,o\275\361\f\337\375\021\265\277*\200:A\240N\346\\u\242\344!;\202p\343\245\351\200\355\223\037!\027\3560jAPu\307tj\006\220\347\221\0300\241P\260\274\021\270\177@\3261?\254\357\222\2277x\312l\356\312\323Kh\\\242\007\247.\342\266j\004p\"\006\226P\233\261\317\225J\250Zl\374]\025\370D\250Q"
+	.string	"\244\346\365\234Y\206\352\247W\233Q\362r\252\005ok\252\370.\245t\3668'2\210L+\207\346\246\241v\350N\212]\001K\271\002\001\353\324\245\274Z\254V0H\360,\223\n\214\351>\371\\\360\370\002\373\277o^"
+	.string	"\204\251P\334\221\313\331\266\307\354\003\313\214e\001\306\271\r\322\277'\352\260\256\234\rg\221\310\245J\bEx\300\232\202\20308\312\032\242o%'c\347\371.\356\237K_\216D%#\240\236\260\020\347\274\026h\235i\177\020\254\240N\264\302"
+	.string	")\317\261\245u\277\032\227\373\003\304\016\262\333+\256/C*\366\217\216\224\313\020\2448\276\344Zz;\361\222\240\n\331(\"?\251\272\326\252\016\036\342T_5!\346w\023\b\314\351!\265\343\201\034!\271\002\b\317\301\326\2712\242\032\267\210\032\330Z/\274Qr\221\307\254\265\037\007\247A\rK\216\345\243\235\241\342\226A\002\023\221\274\204\257\212WB\241\027M\036\372\034`\263&'N\277\346\216\370\232\256\332\373\3468f\b\242>\013\204\033o\366\240\241\207/\216n26\201o\223\306w\227\305\313==\261\264\373C5{\212\307\210\340\026\225\313\275|\016r\265qA\226\313s\030\022q\r#\312\343Q\001OV\001U:`\340J$\333*\257\252\230`\n\216x5+\265\306L%rN\206,\336\214\034\270\240\213\240n{\330\231\225\347r0v\251\262\002\236\2606\351K\356\240%zEH\311\262Z\255"
+	.ascii	"\253\340E\034,\333\273\002\307\371\bb\316\232\367\337\302\364"
+	.ascii	"@\340\204\226.\232;/\244\371-\340\006\034\013\260\265\234FA\203"
+	.ascii	"\232\323\203\267\206\326\351\264\255\016\273|\256\302\212\336"
+	.ascii	"JxES\361\002VH\306\b,a\367\342\033F\275\001/kt\374r\0205\254"
+	.ascii	"\024\362\222\323\326\316>\0378\265\376\246u\252\016b\013\217"
+	.ascii	"\252y\237\275kK\233\321\244d\240\027\177\307\361\206\bO \263"
+	.ascii	"\261\313\006*\026\344\372\371\266\031=a+\2271\257l\225\225\346"
+	.ascii	"C\367mK\215k\371(\215\241w,%j\006\245b\355Z\376\n\022o\321\n"
+	.ascii	"Q\\\"\325l\344\276E\0339=De\256\257\323W\366$\311\245>\020\256"
+	.ascii	"~\177\235>&/\327\255\344O\274\313\321\255V\003\266R-\004\344"
+	.ascii	"M\235!\351\207r\002\331Q+\247Q\023\261\337\351F\235FW\026\334"
+	.ascii	"*\370+A\275\037\315\242tgR\026\236\205\276\264K\222\301v\346"
+	.ascii	"+t\300\225C\376\256\362\314\215\\C\334w\243[w\267h\313\2006\006"
+	.ascii	"5V\na3\367\271\2225c\017"
+	.string	"\t\335v6e\245z\013\310\2220\252\304\3307\b\317v\356\364\235\325\021x\307\003\300\264\222\265X\211U\232\3751\r\310N\256\317ATA3\036\026\005\350fn_\374\3165\333G\323k\031B\310\363\275,X^E\346\331\030\n\024\231\346\022,F#\022\006\227k\362\220d\217"
+	.string	"\375.\005\266R\3155\274\274\213,1E\360\217\276\231\032\215\276\372\201\250\246@ `\302`Q\340Lo\303Q\035\274\347\305\"\020gi\230\240\230f\271\t\327\210\302\305a\313Q\331sE\273\023O\366\332\375y\367\364\272p~i\244yCy\240\254lX\240@\233\035t\003\036\365\260\354$\232"
+	.string	"3.u0\021\307\3168\325t\b\247\227\252%\223\320A\323&\004L\316\004\206@\351&H\315\263\215\254(%'\f\262\034\217v9\242\273\237\207,\361\235b\032\312\267i\244K/\221(`\232\342\371\300'\221\205\003r\326\3305\001"
+	.string	"\246\267\005\016\373q\226tM\253\276*\236^(_\247>B\302\237\275\023\207j\247^;\340l\317\207x\036\247|\230\240\324\213a\0321d\006\261J\377\370\336#\310\360\016\245v\213\r\2501l\224 \262\315'\220g..\362'\037\227\274\314\312H\320R.\004ywgD\311\001\356/YT\f\"\337-\332|\t\200\251\335\227\032\313n\230\314b\316\211\b\372~\017\177\273\366\345C\243\366\331\022K\366\242\215\225\336L\037\341P\340\202\221{\211}Q\363]\364"
+	.ascii	"^{m\312?\017R\263F\271\334eI\245\022\364$s\206\301\203\204\303"
+	.ascii	"\t\334\207\252\225TN{m\261\306\310\340*\316FV\346\210\306S\302"
+	.ascii	"\030\255\216W\311\341\321\322\230\266\2719\351\356(\212\232i"
+	.ascii	"\374O\252`:\221|\211\276\303W s\310\321\200\244\241Wyh\204\003"
+	.ascii	"o\356\370p\031/\215\205\007\350\211\313LC\2428pF\307=\005\353"
+	.ascii	"\r\331^\2033\024\235\205\273gA=\bR\013$\264\213o\332V\257\013"
+	.ascii	"\202q\3359\367\373\344\030\201\003\324Y#%=\266\322P\036\332\325"
+	.ascii	"\335\236R\177\305\331\370\033\030%\016%\032\031\236\225\221\225"
+	.ascii	"y\021\214,\254R^\222\004{\230\277\2300\222m\005zzB\344\334\252"
+	.ascii	"\220$\311\240\003\246\013\312\343\216\017\257C/\210\227\222\240"
+	.ascii	"\341fx\307\271M\257\273kxE\377\214\277t\203K\357!\216\300\016"
+	.ascii	"\206d\267(\\\275Xl\210\234\327\024\377\323\b\2435zq\214\250\r"
+	.ascii	"\370\fF<\271WZ\365w*S/\223gp\244\361\227q\333\217\374p\303B\005"
+	.ascii	"\264Z\2266TiwH{\375\302\364\004\357rY!6\265D\254\241\212}\205"
+	.ascii	"\272\324\214xu\214\361\213\21042.Ph\241\033\025\244>\342\"\237"
+	.ascii	"u\264\233F\314\256GD\365'\241\316\031\200\f\272\364J'\274\263"
+	.ascii	"\321\262i"
+	.string	"\361^\017?\034\002w\357W2\262\265\273wCS\364\\f\244\336\333a'S\267\221|T_\"\235\343\341\357\253\3346\252\247\2765\255\304\235\227\222|\243\357\245L\202\311\255$\362Q$gB\266/C\325m\354J\261\372Xl\262\016\326\"\201l\b\247\306\331\340\352\265\313<\306\357\021.V\037]S\223z \021\357\316j\232\206eA>[\376:\rC\3619\257\256\002\315\224\246\303\205\220\005m\264U\242D\255\007\002\007p\337!\307e\227\252{l\210\346\210\202\341 p\267*\351 \233c\f\2026F\222\b,A\021\362;N\3266m-KP\037d\265i\250WV\261\235\tM\b!\n\315\216\257 \242Etsm\372\004\323\004\"\212ayo\321\365j\3363\350e\204\360\235\036\262\330\311\024P\331\301GQ\021\264\302;-\001\237 \360+\215@\323\3628I\031\nk\267h\323\"\350\276\221y\270q\031V"
+	.string	"\314\272\233\336\003\272\203\322\217\f\353\342\3561b:F\200\204\346\246b\232\302\270\220\311\025\254\364\235\235m\303'\0214\022\243"
+	.ascii	"\247\f\211\r\177.X\276\r\301S=\037\256\247t\351\266"
+	.string	"7\220\256\034\320k\227\330w\344\357\345\231i\325\f|yY\267\"\222v \352\316\260sU\276\324\032xZ\305\215S\262'\364V\265/m\366\260\311\035<x{~\307tF\\4\317\316\2320\206%$\244\262\004\376\275\311\242\035\301}\234\334\nA0\361\036\336\37203\326\277sI\260\241?\314\265\265g~\016\353\211\324\304\215\337'A\234\262^x\337\243\t12\254\371\002\374\334W\232\215\t\210\355\"3\237;\247$NX=\200p\265I)\320\353\324\352\t\344\320\363\313\001,\036\217\244\344m\221.Q\240\t\266Fh\332\201\b\305\202\351$\374\233e\234\021\001\251&\202\007\307c\2432\031\030\b\267J\237\323S\350\363~s\374E\276\346\005\210?IGK\027\362\f\316\357\264Ijf\022\304\313\224\365\t\324\241a{\264N\024h\323\306(`\260\r\235J\020aK\036\331\216w\365\276\236\313C\240m\341\315\217\027"
+	.string	""
+	.ascii	"\255\336\202\370\325\312I\365\342\004\005b\323\006h\t\240\025"
+	.ascii	"\371\023\301\201\205\265}\r)\257_\224\316\362n\315\315j\215\304"
+	.ascii	"\274PK\317\320\307\262h\016\311\333c\201\260O\253\275\350\036"
+	.ascii	",\001\222VM6\346\352\b*\235\tA\363I\003\2738M\2028\253@\333\332"
+	.ascii	"\331\273H,K\326\301\211\334&#\272Fu@\n\201\024\035\200j\252 "
+	.ascii	"\204\b\t\301\251\323\336\275\2012\201\306\236\"\324\025V\023"
+	.ascii	"\234\347\230\254\364\310q\313\"\373\227\311"
+	.string	"t\314\353\365~M\261X30\325\035D\r\262\026\247H\374\215#\030\025I%\017\030r\350\201,\201\032\260\244\227\321@E_)@,\215\355\375\212`C\327{\274\265Hp\200\"\232\3461\267\375'q\002\0166\220x1~\312\030\233\220\r\004=\273Z\215\207\241N\215'\201\255MeP\320rS\376\366\366\030\354\t\336\242sc\r\214\375\2479\215\007\253n\242\006\225\013\334\330#\364\004\266\037-\031\315\275\253|\034\263P*\221\317\312\351e~\267\342a\016N%`\032y\313$\345\354\363\255K'Mh\223%,\2046y&\211\344z\315u\t\314\016\312!\375\237\237\340\247\354`\n\3672d\"\3270\376J\247\177\353RF\002\336\377\004\3473\252\263+\250m\314\256)W\322(\361\377\365\213\216\263\n\216D\350\201=\366\227D\320uPKI\261\214\304m'9\206De\235\344\007>b\376n\001\372\353\301\2667"
+	.string	"y\307\205\272\203\346\375\020\266\3071\fw\347\313\350\013\364\227.\226\376\261\222\026\307\020\206\365\324\251K\253\035\004\220\0370\034=\347\303\272\210\237"
+	.string	"\325x\326\377\370\roG\306\320\267Wx\206\236<\244\371h\2007\263\032?z\234*\301\353\324\333\355\037\002\360\356\264\254f\327\204\336\311\035S\320x\347/\247\302\177\231\373\177B\267m\212^\202\264"
+	.string	"\246\216\215<\340o\347\252\327\247l\317\376S\214\267\362\203y\311\177\336H\237.\335\322a\257c8\004\331\tP\330"
+	.ascii	"\2159\033\220\246\n\356\252\3473T\362kV\235\300\376\016q\037"
+	.ascii	"<^\260\330Cp\374\003\356\272P\272\006\205\243\234\017v\232\261"
+	.ascii	"{K\302\326\245\230\235\360\324?>\341\343\276.-\330\252j\267\236"
+	.ascii	"7\373\347\374D\330\037\\\274e\350#\210\207\033{\223\335\300\001"
+	.ascii	"\267Gj\t0\271\250e[\261/\311\26629\334k\272\311\323\016\377\360"
+	.ascii	"\314\232,e\203\035w\244\211+\353SQ\323y\355\362\373z/u?\242["
+	.ascii	"\333\342\377\260\315Cea\356"
+	.string	"\345v\306\030=L\240\334\262d!>\357-G\247\231\262Q\351\030R4\3373\356\026f\263\210F\312\320gw\203\315\233\200\374?\177=\370\373\222\237"
+	.string	"\353+(\257\276]N7m\271\320\252\232\335\231Q\362&}\346\342\202\223\260\272\007\t\273\327\2313D\306\030\267G\032\301^\342\035\224\356u\366\205\364+=\267\324>\001\215\337\301\362\034\304}n\321\024I\333\005\217\220\217\335\240\007\177\221\300)\353#\254\370\tfz"
+	.ascii	"\305\327\355\307\310i\353\210;\330mN\362\224\216\255\"\327\024"
+	.ascii	"\354\2060\317\030N\020r\004?\224\366\007\301\267w\313\352jz\241"
+	.ascii	"}\n\332\260\216OJR=\237\343\035\026\337x2F\360\356\303^\021\237"
+	.ascii	"F\376\205&;\266\236s\220-2\212[\342\016\035\177\377\033<\001"
+	.ascii	"\217\334?"
+	.text
+	.section	.gnu.lto_.symtab.b0db4eceedba0355,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"taskGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"taskMainPidLoopCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"isAccelerationCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"updateGpsStateForHomeAndHoldMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"updateGpsWaypointsAndMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"pidResetErrorGyroState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"gyroSamplePush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"gyroSampleCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"gyroSamplePop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b0db4eceedba0355,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
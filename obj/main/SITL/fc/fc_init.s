@@ -0,0 +1,18745 @@
+	.file	"fc_init.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/common/color.h"
+	.file 6 "./src/main/drivers/system.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/serial.h"
+	.file 10 "./src/main/drivers/pwm_output.h"
+	.file 11 "./src/main/drivers/flash.h"
+	.file 12 "./src/main/fc/config.h"
+	.file 13 "./src/main/flight/pid.h"
+	.file 14 "./src/main/fc/fc_init.h"
+	.file 15 "./src/main/fc/rc_modes.h"
+	.file 16 "./src/main/fc/rc_controls.h"
+	.file 17 "./src/main/fc/runtime_config.h"
+	.file 18 "./src/main/rx/rx.h"
+	.file 19 "./src/main/io/beeper.h"
+	.file 20 "./src/main/io/serial.h"
+	.file 21 "./src/main/io/ledstrip.h"
+	.file 22 "./src/main/target/SITL/target.h"
+	.file 23 "./src/main/scheduler/scheduler.h"
+	.file 24 "./src/main/sensors/sensors.h"
+	.file 25 "./src/main/sensors/boardalignment.h"
+	.file 26 "./src/main/flight/mixer.h"
+	.file 27 "./src/main/flight/servos.h"
+	.file 28 "./src/main/build/debug.h"
+	.file 29 "./src/main/fc/fc_tasks.h"
+	.file 30 "./src/main/sensors/battery.h"
+	.file 31 "./src/main/drivers/timer.h"
+	.file 32 "./src/main/sensors/barometer.h"
+	.file 33 "./src/main/sensors/gyro.h"
+	.file 34 "./src/main/sensors/acceleration.h"
+	.file 35 "./src/main/blackbox/blackbox.h"
+	.file 36 "./src/main/telemetry/telemetry.h"
+	.file 37 "./src/main/flight/navigation.h"
+	.file 38 "./src/main/io/gps.h"
+	.file 39 "./src/main/flight/failsafe.h"
+	.file 40 "./src/main/fc/cli.h"
+	.file 41 "./src/main/msp/msp_serial.h"
+	.file 42 "./src/main/fc/fc_msp.h"
+	.file 43 "./src/main/flight/imu.h"
+	.file 44 "./src/main/io/rcsplit.h"
+	.file 45 "./src/main/sensors/initialisation.h"
+	.file 46 "./src/main/config/feature.h"
+	.file 47 "./src/main/drivers/serial_uart.h"
+	.file 48 "./src/main/drivers/time.h"
+	.file 49 "./src/main/rx/spektrum.h"
+	.file 50 "./src/main/drivers/flash_m25p16.h"
+	.file 51 "./src/main/drivers/io.h"
+	.file 52 "./src/main/common/printf.h"
+	.file 53 "./src/main/io/flashfs.h"
+	.file 54 "./src/main/fc/fc_init.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_init.c.3b74166f
+	.weak	fc_init.c.3b74166f
+fc_init.c.3b74166f:
+	.long	0x151d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF2585
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2068
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2069
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2070
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2071
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2072
+	.uleb128 0x3
+	.long	.LASF2074
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2073
+	.uleb128 0x3
+	.long	.LASF2075
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2076
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2077
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2078
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2079
+	.uleb128 0x3
+	.long	.LASF2080
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2081
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2082
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF2083
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x13
+	.long	.LASF2406
+	.byte	0x16
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb5
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2084
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2085
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2086
+	.uleb128 0x3
+	.long	.LASF2087
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x12
+	.long	0xb5
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x15
+	.byte	0xe
+	.long	0x10e
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2148
+	.byte	0x4
+	.byte	0x5
+	.byte	0x34
+	.long	0x13c
+	.uleb128 0x10
+	.string	"h"
+	.byte	0x5
+	.byte	0x35
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x5
+	.byte	0x36
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x5
+	.byte	0x37
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2091
+	.byte	0x5
+	.byte	0x38
+	.byte	0x3
+	.long	0x10e
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x19
+	.byte	0xe
+	.long	0x180
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2099
+	.byte	0x6
+	.byte	0x21
+	.byte	0x3
+	.long	0x148
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.byte	0xe
+	.long	0x2b4
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2147
+	.byte	0x8
+	.byte	0x18
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF2149
+	.byte	0x1e
+	.byte	0x9
+	.byte	0x54
+	.long	0x2f4
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0x9
+	.byte	0x55
+	.byte	0xd
+	.long	0x2f4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x9
+	.byte	0x56
+	.byte	0xd
+	.long	0x2f4
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0x9
+	.byte	0x57
+	.byte	0xd
+	.long	0x2f4
+	.byte	0x14
+	.byte	0
+	.uleb128 0x11
+	.long	0x2b4
+	.long	0x304
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2153
+	.byte	0x9
+	.byte	0x58
+	.byte	0x3
+	.long	0x2c0
+	.uleb128 0xa
+	.long	0x304
+	.uleb128 0xb
+	.long	.LASF2210
+	.byte	0x9
+	.byte	0x5a
+	.byte	0x1a
+	.long	0x304
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2154
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2155
+	.uleb128 0x11
+	.long	0x2b4
+	.long	0x33f
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x40
+	.byte	0xe
+	.long	0x371
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2159
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2162
+	.byte	0x12
+	.byte	0xa
+	.byte	0x8e
+	.long	0x3bf
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0xa
+	.byte	0x8f
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0xa
+	.byte	0x90
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0xa
+	.byte	0x91
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0xa
+	.byte	0x92
+	.byte	0xd
+	.long	0x9d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0xa
+	.byte	0x93
+	.byte	0xd
+	.long	0x3bf
+	.byte	0x5
+	.byte	0
+	.uleb128 0x11
+	.long	0x2b4
+	.long	0x3cf
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2168
+	.byte	0xa
+	.byte	0x94
+	.byte	0x3
+	.long	0x371
+	.uleb128 0xa
+	.long	0x3cf
+	.uleb128 0x6
+	.long	.LASF2169
+	.byte	0xc
+	.byte	0xa
+	.byte	0x98
+	.long	0x414
+	.uleb128 0x2
+	.long	.LASF2170
+	.byte	0xa
+	.byte	0x9a
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2171
+	.byte	0xa
+	.byte	0x9b
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0xa
+	.byte	0x9c
+	.byte	0xd
+	.long	0x32f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2172
+	.byte	0xa
+	.byte	0x9d
+	.byte	0x3
+	.long	0x3e0
+	.uleb128 0xa
+	.long	0x414
+	.uleb128 0x6
+	.long	.LASF2173
+	.byte	0x1
+	.byte	0xb
+	.byte	0x22
+	.long	0x43f
+	.uleb128 0x2
+	.long	.LASF2174
+	.byte	0xb
+	.byte	0x23
+	.byte	0xd
+	.long	0x2b4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2175
+	.byte	0xb
+	.byte	0x24
+	.byte	0x3
+	.long	0x425
+	.uleb128 0xa
+	.long	0x43f
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x22
+	.byte	0xe
+	.long	0x52e
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x80
+	.uleb128 0xf
+	.long	.LASF2183
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF2184
+	.value	0x200
+	.uleb128 0xf
+	.long	.LASF2185
+	.value	0x400
+	.uleb128 0xf
+	.long	.LASF2186
+	.value	0x1000
+	.uleb128 0xf
+	.long	.LASF2187
+	.value	0x2000
+	.uleb128 0xf
+	.long	.LASF2188
+	.value	0x4000
+	.uleb128 0xf
+	.long	.LASF2189
+	.value	0x8000
+	.uleb128 0xd
+	.long	.LASF2190
+	.long	0x10000
+	.uleb128 0xd
+	.long	.LASF2191
+	.long	0x20000
+	.uleb128 0xd
+	.long	.LASF2192
+	.long	0x40000
+	.uleb128 0xd
+	.long	.LASF2193
+	.long	0x80000
+	.uleb128 0xd
+	.long	.LASF2194
+	.long	0x100000
+	.uleb128 0xd
+	.long	.LASF2195
+	.long	0x200000
+	.uleb128 0xd
+	.long	.LASF2196
+	.long	0x400000
+	.uleb128 0xd
+	.long	.LASF2197
+	.long	0x800000
+	.uleb128 0xd
+	.long	.LASF2198
+	.long	0x2000000
+	.uleb128 0xd
+	.long	.LASF2199
+	.long	0x4000000
+	.uleb128 0xd
+	.long	.LASF2200
+	.long	0x8000000
+	.uleb128 0xd
+	.long	.LASF2201
+	.long	0x10000000
+	.uleb128 0xd
+	.long	.LASF2202
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2203
+	.byte	0x15
+	.byte	0xc
+	.byte	0x46
+	.long	0x57c
+	.uleb128 0x2
+	.long	.LASF2204
+	.byte	0xc
+	.byte	0x47
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2205
+	.byte	0xc
+	.byte	0x48
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2206
+	.byte	0xc
+	.byte	0x49
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xa
+	.long	0x57c
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	0x8a
+	.long	0x58c
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2209
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x3
+	.long	0x52e
+	.uleb128 0xa
+	.long	0x58c
+	.uleb128 0xb
+	.long	.LASF2211
+	.byte	0xc
+	.byte	0x59
+	.byte	0x17
+	.long	0x58c
+	.uleb128 0xb
+	.long	.LASF2212
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x16
+	.long	0x43f
+	.uleb128 0x6
+	.long	.LASF2213
+	.byte	0x4c
+	.byte	0xd
+	.byte	0x4a
+	.long	0x72e
+	.uleb128 0x10
+	.string	"pid"
+	.byte	0xd
+	.byte	0x4b
+	.byte	0xc
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2214
+	.byte	0xd
+	.byte	0x4d
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0xd
+	.byte	0x4e
+	.byte	0xe
+	.long	0xa9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2216
+	.byte	0xd
+	.byte	0x4f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2217
+	.byte	0xd
+	.byte	0x50
+	.byte	0xe
+	.long	0xa9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2218
+	.byte	0xd
+	.byte	0x51
+	.byte	0xe
+	.long	0xa9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2219
+	.byte	0xd
+	.byte	0x52
+	.byte	0xd
+	.long	0x9d
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2220
+	.byte	0xd
+	.byte	0x53
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0xd
+	.byte	0x54
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0xd
+	.byte	0x55
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xd
+	.byte	0x56
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xd
+	.byte	0x57
+	.byte	0xd
+	.long	0x9d
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0xd
+	.byte	0x58
+	.byte	0xd
+	.long	0x9d
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0xd
+	.byte	0x59
+	.byte	0xd
+	.long	0x9d
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0xd
+	.byte	0x5b
+	.byte	0xd
+	.long	0x9d
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0xd
+	.byte	0x5c
+	.byte	0xd
+	.long	0x9d
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0xd
+	.byte	0x5f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0xd
+	.byte	0x60
+	.byte	0xe
+	.long	0xa9
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0xd
+	.byte	0x61
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0xd
+	.byte	0x62
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0xd
+	.byte	0x63
+	.byte	0xe
+	.long	0xa9
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0xd
+	.byte	0x64
+	.byte	0xe
+	.long	0xa9
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2235
+	.byte	0xd
+	.byte	0x65
+	.byte	0xe
+	.long	0xa9
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2236
+	.byte	0xd
+	.byte	0x66
+	.byte	0xe
+	.long	0xa9
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2237
+	.byte	0xd
+	.byte	0x67
+	.byte	0xe
+	.long	0xa9
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0xd
+	.byte	0x68
+	.byte	0xd
+	.long	0x9d
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0xd
+	.byte	0x69
+	.byte	0xd
+	.long	0x9d
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0xd
+	.byte	0x6a
+	.byte	0x18
+	.long	0x107c
+	.byte	0x48
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2241
+	.byte	0xc
+	.byte	0x63
+	.byte	0x1d
+	.long	0x73a
+	.uleb128 0x7
+	.long	0x5b5
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x14
+	.byte	0xe
+	.long	0x771
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x80
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2248
+	.byte	0xe
+	.byte	0x1d
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x18
+	.byte	0xe
+	.long	0x86f
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x25
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2287
+	.byte	0x8
+	.byte	0x10
+	.byte	0x5b
+	.long	0x8b0
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0x10
+	.byte	0x5c
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0x10
+	.byte	0x5d
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0x10
+	.byte	0x5e
+	.byte	0xe
+	.long	0xa9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0x10
+	.byte	0x5f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2292
+	.byte	0x10
+	.byte	0x60
+	.byte	0x3
+	.long	0x86f
+	.uleb128 0xa
+	.long	0x8b0
+	.uleb128 0xb
+	.long	.LASF2293
+	.byte	0x10
+	.byte	0x62
+	.byte	0x19
+	.long	0x8b0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x24
+	.byte	0xe
+	.long	0x920
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x80
+	.uleb128 0xf
+	.long	.LASF2302
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF2303
+	.value	0x200
+	.uleb128 0xf
+	.long	.LASF2304
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2305
+	.byte	0x11
+	.byte	0x30
+	.byte	0x3
+	.long	0x8cd
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x58
+	.byte	0xe
+	.long	0x958
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2311
+	.byte	0x11
+	.byte	0x64
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x2f
+	.byte	0xe
+	.long	0x9ba
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2324
+	.byte	0x2c
+	.byte	0x12
+	.byte	0x75
+	.long	0xb0c
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x12
+	.byte	0x76
+	.byte	0xd
+	.long	0xb0c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2326
+	.byte	0x12
+	.byte	0x77
+	.byte	0xd
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x12
+	.byte	0x78
+	.byte	0xd
+	.long	0x9d
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x12
+	.byte	0x79
+	.byte	0xd
+	.long	0x9d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x12
+	.byte	0x7a
+	.byte	0xd
+	.long	0x9d
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x12
+	.byte	0x7b
+	.byte	0xe
+	.long	0xb5
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2331
+	.byte	0x12
+	.byte	0x7c
+	.byte	0xd
+	.long	0x9d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x12
+	.byte	0x7d
+	.byte	0xd
+	.long	0x2b4
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x12
+	.byte	0x7e
+	.byte	0xd
+	.long	0x2b4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x12
+	.byte	0x7f
+	.byte	0xd
+	.long	0x9d
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x12
+	.byte	0x80
+	.byte	0xd
+	.long	0x9d
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0x12
+	.byte	0x81
+	.byte	0xd
+	.long	0x9d
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0x12
+	.byte	0x82
+	.byte	0xd
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2338
+	.byte	0x12
+	.byte	0x83
+	.byte	0xd
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0x12
+	.byte	0x84
+	.byte	0xe
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0x12
+	.byte	0x85
+	.byte	0xe
+	.long	0xa9
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0x12
+	.byte	0x86
+	.byte	0xe
+	.long	0xa9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0x12
+	.byte	0x87
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2343
+	.byte	0x12
+	.byte	0x88
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2344
+	.byte	0x12
+	.byte	0x89
+	.byte	0xd
+	.long	0x9d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2345
+	.byte	0x12
+	.byte	0x8a
+	.byte	0xd
+	.long	0x9d
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x12
+	.byte	0x8b
+	.byte	0xd
+	.long	0x9d
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0x12
+	.byte	0x8c
+	.byte	0xe
+	.long	0xa9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x12
+	.byte	0x8e
+	.byte	0xe
+	.long	0xa9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x12
+	.byte	0x8f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x28
+	.byte	0
+	.uleb128 0x11
+	.long	0x9d
+	.long	0xb1c
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2350
+	.byte	0x12
+	.byte	0x90
+	.byte	0x3
+	.long	0x9ba
+	.uleb128 0xa
+	.long	0xb1c
+	.uleb128 0xb
+	.long	.LASF2351
+	.byte	0x12
+	.byte	0x92
+	.byte	0x13
+	.long	0xb1c
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x17
+	.byte	0xe
+	.long	0xbcb
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x15
+	.byte	0
+	.uleb128 0x8
+	.byte	0x5
+	.long	0x70
+	.byte	0x14
+	.byte	0x48
+	.byte	0xe
+	.long	0xc21
+	.uleb128 0x19
+	.long	.LASF2374
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2386
+	.byte	0x14
+	.byte	0x55
+	.byte	0x3
+	.long	0xbcb
+	.uleb128 0x6
+	.long	.LASF2387
+	.byte	0xc
+	.byte	0x14
+	.byte	0x6c
+	.long	0xc88
+	.uleb128 0x2
+	.long	.LASF2388
+	.byte	0x14
+	.byte	0x6d
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2389
+	.byte	0x14
+	.byte	0x6e
+	.byte	0x1c
+	.long	0xc21
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2390
+	.byte	0x14
+	.byte	0x6f
+	.byte	0xd
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2391
+	.byte	0x14
+	.byte	0x70
+	.byte	0xd
+	.long	0x9d
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2392
+	.byte	0x14
+	.byte	0x71
+	.byte	0xd
+	.long	0x9d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2393
+	.byte	0x14
+	.byte	0x72
+	.byte	0xd
+	.long	0x9d
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2394
+	.byte	0x14
+	.byte	0x73
+	.byte	0x3
+	.long	0xc2d
+	.uleb128 0x6
+	.long	.LASF2395
+	.byte	0x64
+	.byte	0x14
+	.byte	0x75
+	.long	0xcc8
+	.uleb128 0x2
+	.long	.LASF2396
+	.byte	0x14
+	.byte	0x76
+	.byte	0x18
+	.long	0xccd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0x14
+	.byte	0x77
+	.byte	0xe
+	.long	0xa9
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0x14
+	.byte	0x78
+	.byte	0xd
+	.long	0x9d
+	.byte	0x62
+	.byte	0
+	.uleb128 0xa
+	.long	0xc94
+	.uleb128 0x11
+	.long	0xc88
+	.long	0xcdd
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2399
+	.byte	0x14
+	.byte	0x79
+	.byte	0x3
+	.long	0xc94
+	.uleb128 0xa
+	.long	0xcdd
+	.uleb128 0xb
+	.long	.LASF2400
+	.byte	0x14
+	.byte	0x7b
+	.byte	0x17
+	.long	0xcdd
+	.uleb128 0x6
+	.long	.LASF2401
+	.byte	0x6
+	.byte	0x15
+	.byte	0x7c
+	.long	0xd14
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0x15
+	.byte	0x7d
+	.byte	0xd
+	.long	0xd14
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x9d
+	.long	0xd24
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2403
+	.byte	0x15
+	.byte	0x7e
+	.byte	0x3
+	.long	0xcfa
+	.uleb128 0xa
+	.long	0xd24
+	.uleb128 0x6
+	.long	.LASF2404
+	.byte	0xb
+	.byte	0x15
+	.byte	0x80
+	.long	0xd4f
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0x15
+	.byte	0x81
+	.byte	0xd
+	.long	0xd4f
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x9d
+	.long	0xd5f
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2405
+	.byte	0x15
+	.byte	0x82
+	.byte	0x3
+	.long	0xd35
+	.uleb128 0x13
+	.long	.LASF2407
+	.byte	0x15
+	.byte	0x99
+	.byte	0xd
+	.long	0xd77
+	.uleb128 0x7
+	.long	0x13c
+	.uleb128 0x13
+	.long	.LASF2408
+	.byte	0x15
+	.byte	0x9a
+	.byte	0x1b
+	.long	0xd88
+	.uleb128 0x7
+	.long	0xd30
+	.uleb128 0x13
+	.long	.LASF2409
+	.byte	0x15
+	.byte	0x9b
+	.byte	0x17
+	.long	0xd5f
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xe
+	.long	0xe25
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x14
+	.byte	0xe
+	.long	0xe51
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2436
+	.byte	0xc
+	.byte	0x19
+	.byte	0x16
+	.long	0xe85
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0x19
+	.byte	0x17
+	.byte	0xd
+	.long	0x91
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0x19
+	.byte	0x18
+	.byte	0xd
+	.long	0x91
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0x19
+	.byte	0x19
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2440
+	.byte	0x19
+	.byte	0x1a
+	.byte	0x3
+	.long	0xe51
+	.uleb128 0xa
+	.long	0xe85
+	.uleb128 0xb
+	.long	.LASF2441
+	.byte	0x19
+	.byte	0x1c
+	.byte	0x19
+	.long	0xe85
+	.uleb128 0x1a
+	.long	.LASF2470
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x1a
+	.byte	0x24
+	.byte	0xe
+	.long	0xf51
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2463
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2468
+	.byte	0x1a
+	.byte	0x40
+	.byte	0x3
+	.long	0xea2
+	.uleb128 0x6
+	.long	.LASF2469
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x53
+	.long	0xf84
+	.uleb128 0x2
+	.long	.LASF2470
+	.byte	0x1a
+	.byte	0x54
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0x1a
+	.byte	0x55
+	.byte	0x9
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2472
+	.byte	0x1a
+	.byte	0x56
+	.byte	0x3
+	.long	0xf5d
+	.uleb128 0xa
+	.long	0xf84
+	.uleb128 0xb
+	.long	.LASF2473
+	.byte	0x1a
+	.byte	0x58
+	.byte	0x16
+	.long	0xf84
+	.uleb128 0x6
+	.long	.LASF2474
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x5a
+	.long	0xfef
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x1a
+	.byte	0x5b
+	.byte	0x16
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2475
+	.byte	0x1a
+	.byte	0x5c
+	.byte	0xe
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2476
+	.byte	0x1a
+	.byte	0x5d
+	.byte	0xe
+	.long	0xa9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2477
+	.byte	0x1a
+	.byte	0x5e
+	.byte	0xe
+	.long	0xa9
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0x1a
+	.byte	0x5f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2479
+	.byte	0x1a
+	.byte	0x60
+	.byte	0x3
+	.long	0xfa1
+	.uleb128 0xa
+	.long	0xfef
+	.uleb128 0xb
+	.long	.LASF2480
+	.byte	0x1a
+	.byte	0x62
+	.byte	0x16
+	.long	0xfef
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x25
+	.byte	0xe
+	.long	0x105c
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0xa
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x3e
+	.byte	0xe
+	.long	0x107c
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2495
+	.byte	0xd
+	.byte	0x42
+	.byte	0x3
+	.long	0x105c
+	.uleb128 0x6
+	.long	.LASF2496
+	.byte	0x3
+	.byte	0xd
+	.byte	0x44
+	.long	0x10b6
+	.uleb128 0x10
+	.string	"P"
+	.byte	0xd
+	.byte	0x45
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x10
+	.string	"I"
+	.byte	0xd
+	.byte	0x46
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1
+	.uleb128 0x10
+	.string	"D"
+	.byte	0xd
+	.byte	0x47
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2497
+	.byte	0xd
+	.byte	0x48
+	.byte	0x3
+	.long	0x1088
+	.uleb128 0x11
+	.long	0x10b6
+	.long	0x10d2
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2498
+	.byte	0xd
+	.byte	0x6b
+	.byte	0x3
+	.long	0x5b5
+	.uleb128 0xa
+	.long	0x10d2
+	.uleb128 0x13
+	.long	.LASF2499
+	.byte	0xd
+	.byte	0x79
+	.byte	0x5
+	.long	0xdb
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x1b
+	.byte	0x19
+	.byte	0x6
+	.long	0x1157
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0xe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2515
+	.byte	0x1b
+	.byte	0x29
+	.byte	0x3
+	.long	0x10ef
+	.uleb128 0x6
+	.long	.LASF2516
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x71
+	.long	0x11a4
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x1b
+	.byte	0x72
+	.byte	0x16
+	.long	0x414
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2517
+	.byte	0x1b
+	.byte	0x73
+	.byte	0xe
+	.long	0xa9
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2518
+	.byte	0x1b
+	.byte	0x74
+	.byte	0xd
+	.long	0x9d
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2519
+	.byte	0x1b
+	.byte	0x75
+	.byte	0xd
+	.long	0x9d
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.byte	0x76
+	.byte	0x3
+	.long	0x1163
+	.uleb128 0xa
+	.long	0x11a4
+	.uleb128 0xb
+	.long	.LASF2521
+	.byte	0x1b
+	.byte	0x78
+	.byte	0x16
+	.long	0x11a4
+	.uleb128 0xb
+	.long	.LASF2522
+	.byte	0x1c
+	.byte	0x16
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x1b
+	.long	0x771
+	.byte	0x36
+	.byte	0x91
+	.byte	0x9
+	.uleb128 0x14
+	.long	.LASF2542
+	.byte	0x2c
+	.byte	0x31
+	.byte	0x5
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2523
+	.byte	0x1d
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF2524
+	.byte	0xa
+	.byte	0xc2
+	.uleb128 0x4
+	.long	.LASF2525
+	.byte	0x1e
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF2526
+	.byte	0x1f
+	.byte	0xb6
+	.uleb128 0x9
+	.long	.LASF2527
+	.byte	0x20
+	.byte	0x35
+	.long	0x120e
+	.uleb128 0x5
+	.long	0xa9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2528
+	.byte	0x21
+	.byte	0x6f
+	.long	0x121f
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2529
+	.byte	0x22
+	.byte	0x4c
+	.long	0x1230
+	.uleb128 0x5
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2530
+	.byte	0x23
+	.byte	0x39
+	.uleb128 0x1c
+	.long	.LASF2571
+	.byte	0x35
+	.byte	0x49
+	.byte	0x6
+	.long	0x1245
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2562
+	.byte	0x32
+	.byte	0x19
+	.long	0xdb
+	.long	0x125a
+	.uleb128 0x5
+	.long	0x125a
+	.byte	0
+	.uleb128 0x7
+	.long	0x44b
+	.uleb128 0x4
+	.long	.LASF2531
+	.byte	0x24
+	.byte	0x3d
+	.uleb128 0x4
+	.long	.LASF2532
+	.byte	0x25
+	.byte	0x35
+	.uleb128 0x4
+	.long	.LASF2533
+	.byte	0x26
+	.byte	0x84
+	.uleb128 0x4
+	.long	.LASF2534
+	.byte	0x12
+	.byte	0xa1
+	.uleb128 0x4
+	.long	.LASF2535
+	.byte	0x27
+	.byte	0x4d
+	.uleb128 0x9
+	.long	.LASF2536
+	.byte	0x28
+	.byte	0x17
+	.long	0x1293
+	.uleb128 0x5
+	.long	0x1293
+	.byte	0
+	.uleb128 0x7
+	.long	0xcc8
+	.uleb128 0x4
+	.long	.LASF2537
+	.byte	0x29
+	.byte	0x57
+	.uleb128 0x4
+	.long	.LASF2538
+	.byte	0x2a
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF2539
+	.byte	0x2b
+	.byte	0x4a
+	.uleb128 0x4
+	.long	.LASF2540
+	.byte	0x1b
+	.byte	0x87
+	.uleb128 0x9
+	.long	.LASF2541
+	.byte	0xd
+	.byte	0x85
+	.long	0x12c5
+	.uleb128 0x5
+	.long	0x12c5
+	.byte	0
+	.uleb128 0x7
+	.long	0x10de
+	.uleb128 0x14
+	.long	.LASF2543
+	.byte	0xc
+	.byte	0x69
+	.byte	0xa
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF2544
+	.byte	0x11
+	.byte	0x37
+	.long	0x12e7
+	.uleb128 0x5
+	.long	0x920
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2545
+	.byte	0x6
+	.byte	0x24
+	.long	0x12fd
+	.uleb128 0x5
+	.long	0x180
+	.uleb128 0x5
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2546
+	.byte	0x2d
+	.byte	0x14
+	.byte	0x5
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF2547
+	.byte	0x19
+	.byte	0x1f
+	.long	0x131a
+	.uleb128 0x5
+	.long	0x131a
+	.byte	0
+	.uleb128 0x7
+	.long	0xe91
+	.uleb128 0x9
+	.long	.LASF2548
+	.byte	0xa
+	.byte	0x9f
+	.long	0x1330
+	.uleb128 0x5
+	.long	0x1330
+	.byte	0
+	.uleb128 0x7
+	.long	0x420
+	.uleb128 0x14
+	.long	.LASF2549
+	.byte	0x1b
+	.byte	0x80
+	.byte	0x5
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2550
+	.byte	0x1b
+	.byte	0x85
+	.uleb128 0x9
+	.long	.LASF2551
+	.byte	0xa
+	.byte	0x96
+	.long	0x1363
+	.uleb128 0x5
+	.long	0x1363
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x5
+	.long	0x9d
+	.byte	0
+	.uleb128 0x7
+	.long	0x3db
+	.uleb128 0x1d
+	.long	.LASF2552
+	.byte	0x1a
+	.byte	0x6d
+	.byte	0x9
+	.long	0x9d
+	.long	0x137a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2553
+	.byte	0x1a
+	.byte	0x76
+	.uleb128 0x9
+	.long	.LASF2554
+	.byte	0x2e
+	.byte	0x20
+	.long	0x1392
+	.uleb128 0x5
+	.long	0xb5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2555
+	.byte	0x1b
+	.byte	0x86
+	.uleb128 0x9
+	.long	.LASF2556
+	.byte	0x1a
+	.byte	0x72
+	.long	0x13aa
+	.uleb128 0x5
+	.long	0xf51
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2557
+	.byte	0x14
+	.byte	0x82
+	.long	0x13c0
+	.uleb128 0x5
+	.long	0xdb
+	.uleb128 0x5
+	.long	0xc21
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2558
+	.byte	0x2f
+	.byte	0x4a
+	.long	0x13d1
+	.uleb128 0x5
+	.long	0x13d1
+	.byte	0
+	.uleb128 0x7
+	.long	0x310
+	.uleb128 0x4
+	.long	.LASF2559
+	.byte	0x1f
+	.byte	0xb5
+	.uleb128 0x9
+	.long	.LASF2560
+	.byte	0x30
+	.byte	0x19
+	.long	0x13ee
+	.uleb128 0x5
+	.long	0xe2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2561
+	.byte	0x31
+	.byte	0x1b
+	.long	0x13ff
+	.uleb128 0x5
+	.long	0x13ff
+	.byte	0
+	.uleb128 0x7
+	.long	0xb1c
+	.uleb128 0x16
+	.long	.LASF2563
+	.byte	0x2e
+	.byte	0x1e
+	.long	0xdb
+	.long	0x1419
+	.uleb128 0x5
+	.long	0xb5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2564
+	.byte	0x2e
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0xc
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF2566
+	.byte	0xc
+	.byte	0x72
+	.uleb128 0x4
+	.long	.LASF2567
+	.byte	0xc
+	.byte	0x6e
+	.uleb128 0x4
+	.long	.LASF2568
+	.byte	0x33
+	.byte	0x73
+	.uleb128 0x4
+	.long	.LASF2569
+	.byte	0x6
+	.byte	0x17
+	.uleb128 0x4
+	.long	.LASF2570
+	.byte	0x34
+	.byte	0x76
+	.uleb128 0x1e
+	.long	.LASF2572
+	.byte	0x36
+	.byte	0xf2
+	.byte	0x6
+	.long	0x1471
+	.uleb128 0x1f
+	.long	.LASF2573
+	.byte	0x36
+	.value	0x17c
+	.byte	0xe
+	.long	0xa9
+	.uleb128 0x20
+	.uleb128 0x21
+	.string	"i"
+	.byte	0x36
+	.value	0x1ff
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2586
+	.byte	0x36
+	.byte	0x93
+	.byte	0x6
+	.uleb128 0xe
+	.long	.LASF2574
+	.byte	0x1b
+	.byte	0x78
+	.byte	0x74
+	.long	0x1485
+	.uleb128 0x7
+	.long	0x11b0
+	.uleb128 0xe
+	.long	.LASF2575
+	.byte	0x1a
+	.byte	0x62
+	.byte	0x74
+	.long	0x1496
+	.uleb128 0x7
+	.long	0xffb
+	.uleb128 0xe
+	.long	.LASF2576
+	.byte	0x1a
+	.byte	0x58
+	.byte	0x74
+	.long	0x14a7
+	.uleb128 0x7
+	.long	0xf90
+	.uleb128 0xe
+	.long	.LASF2577
+	.byte	0x19
+	.byte	0x1c
+	.byte	0x83
+	.long	0x131a
+	.uleb128 0xe
+	.long	.LASF2578
+	.byte	0x14
+	.byte	0x7b
+	.byte	0x79
+	.long	0x14c4
+	.uleb128 0x7
+	.long	0xce9
+	.uleb128 0xe
+	.long	.LASF2579
+	.byte	0x12
+	.byte	0x92
+	.byte	0xab
+	.long	0x13ff
+	.uleb128 0xe
+	.long	.LASF2580
+	.byte	0x12
+	.byte	0x92
+	.byte	0x65
+	.long	0x14e1
+	.uleb128 0x7
+	.long	0xb28
+	.uleb128 0xe
+	.long	.LASF2581
+	.byte	0x10
+	.byte	0x62
+	.byte	0x83
+	.long	0x14f2
+	.uleb128 0x7
+	.long	0x8bc
+	.uleb128 0xe
+	.long	.LASF2582
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x74
+	.long	0x125a
+	.uleb128 0xe
+	.long	.LASF2583
+	.byte	0xc
+	.byte	0x59
+	.byte	0x79
+	.long	0x150f
+	.uleb128 0x7
+	.long	0x598
+	.uleb128 0xe
+	.long	.LASF2584
+	.byte	0x9
+	.byte	0x5a
+	.byte	0x88
+	.long	0x13d1
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 55 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 56 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 57 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x39
+	.file 58 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 60 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 61 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x3d
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 64 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x42
+	.file 67 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 71 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 72 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 75 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4c
+	.file 77 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 78 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.file 79 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x4
+	.file 80 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x50
+	.file 81 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.file 82 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 83 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x34
+	.file 84 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.file 85 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF968
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x4
+	.file 86 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 87 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x57
+	.file 88 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 89 "./src/main/cms/cms_types.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 90 "./src/main/drivers/nvic.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 91 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x30
+	.byte	0x4
+	.file 92 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5c
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 93 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x5d
+	.file 94 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 95 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 96 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 97 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x1f
+	.file 98 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1561
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1562
+	.byte	0x4
+	.file 99 "./src/main/drivers/serial_softserial.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1563
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1564
+	.byte	0x4
+	.file 100 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x64
+	.file 101 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x65
+	.byte	0x4
+	.file 102 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x66
+	.file 103 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.file 104 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 105 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1661
+	.file 106 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1663
+	.byte	0x4
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1664
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1673
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x70
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1678
+	.byte	0x4
+	.byte	0x4
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 114 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x74
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1712
+	.byte	0x4
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x76
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1714
+	.byte	0x4
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x78
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1715
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1716
+	.byte	0x4
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1717
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1718
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x7b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1719
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 124 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x7c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1731
+	.byte	0x4
+	.file 125 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x7d
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 126 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1738
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1739
+	.byte	0x4
+	.file 127 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1740
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 128 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x80
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 129 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x81
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1743
+	.byte	0x4
+	.file 130 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x82
+	.file 131 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x83
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1744
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 132 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x84
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1775
+	.byte	0x4
+	.file 133 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x85
+	.byte	0x4
+	.file 134 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 135 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x87
+	.byte	0x4
+	.file 136 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x88
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1784
+	.byte	0x4
+	.file 137 "./src/main/drivers/buttons.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x89
+	.byte	0x4
+	.file 138 "./src/main/drivers/inverter.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x8a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x32
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1785
+	.byte	0x4
+	.file 139 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x8b
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 140 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x8c
+	.byte	0x4
+	.file 141 "./src/main/drivers/usb_io.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x8d
+	.byte	0x4
+	.file 142 "./src/main/drivers/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x8e
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 143 "./src/main/drivers/max7456.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x8f
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 144 "./src/main/drivers/vtx_rtc6705.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x90
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 145 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x91
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0xc
+	.file 146 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x92
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1833
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x2a
+	.file 147 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x93
+	.file 148 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x94
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1842
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x13
+	.byte	0x4
+	.file 149 "./src/main/io/displayport_max7456.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 150 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x5a
+	.uleb128 0x96
+	.byte	0x4
+	.file 151 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x97
+	.byte	0x4
+	.file 152 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x98
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1922
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 153 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x99
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 154 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x9a
+	.file 155 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9b
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.file 156 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x9c
+	.byte	0x4
+	.file 157 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x9d
+	.byte	0x4
+	.file 158 "./src/main/io/osd_slave.h"
+	.byte	0x3
+	.uleb128 0x62
+	.uleb128 0x9e
+	.byte	0x4
+	.file 159 "./src/main/io/displayport_msp.h"
+	.byte	0x3
+	.uleb128 0x63
+	.uleb128 0x9f
+	.byte	0x4
+	.file 160 "./src/main/io/vtx_rtc6705.h"
+	.byte	0x3
+	.uleb128 0x64
+	.uleb128 0xa0
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.file 161 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x65
+	.uleb128 0xa1
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1993
+	.byte	0x4
+	.file 162 "./src/main/io/vtx_smartaudio.h"
+	.byte	0x3
+	.uleb128 0x66
+	.uleb128 0xa2
+	.byte	0x4
+	.file 163 "./src/main/io/vtx_tramp.h"
+	.byte	0x3
+	.uleb128 0x67
+	.uleb128 0xa3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x69
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x20
+	.file 164 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2001
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2002
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6d
+	.uleb128 0x1e
+	.file 165 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa5
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 166 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa6
+	.file 167 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa7
+	.byte	0x4
+	.byte	0x4
+	.file 168 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xa8
+	.file 169 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6e
+	.uleb128 0x19
+	.byte	0x4
+	.file 170 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x6f
+	.uleb128 0xaa
+	.byte	0x4
+	.file 171 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x70
+	.uleb128 0xab
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x71
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x72
+	.uleb128 0x2d
+	.byte	0x4
+	.file 172 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x74
+	.uleb128 0xac
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2017
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x76
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2018
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x79
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7b
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7c
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7f
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x86
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.file 173 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x87
+	.uleb128 0xad
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF937
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF953
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.3217b4575ccf3c370ae0b5186c11b495,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1061
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.66.d76eedfe5c71cf0694c9c8244006861c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.nvic.h.6.aa2a88eb51660ed9c913c1e963af648e,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1120
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.113.4d5d0c05ce1a76c3b97be0da5de43ba3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1131
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1167
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1179
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1557
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1560
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1570
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1670
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1672
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1710
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1730
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1742
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1774
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.transponder_ir.h.23.b50bed893bc0dbf7b1e0fb37ef14e2d7,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.max7456.h.21.59264cd1e20507bb3a63ba829e3208aa,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_rtc6705.h.29.3457fa22ea54f4c15a3f9e01ce1c3b5f,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1832
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1858
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.7eabd3dc96720430f10f642c53b6edaf,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.21.42b0efe26f2c975d82840e6ab4f40d87,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1913
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dashboard.h.22.499b1990b01ce2b674fe8b48758244f0,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1990
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_rtc6705.h.32.2cce3244327e41cc25c532c7afa6de4f,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2000
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2006
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.37.6498376d1e1396b14288709c9edf6d99,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2056
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcsplit.h.35.60cb2b54a6da895dfd971417785ff508,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2059
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2067
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1c
+	.long	.LASF1
+	.long	.LASF2587
+	.long	.LASF2588
+	.long	.LASF2589
+	.long	.LASF2590
+	.long	.LASF2591
+	.long	.LASF2592
+	.long	.LASF2593
+	.long	.LASF2594
+	.long	.LASF2595
+	.long	.LASF2596
+	.long	.LASF2597
+	.long	.LASF2598
+	.long	.LASF2599
+	.long	.LASF2600
+	.long	.LASF2601
+	.long	.LASF2602
+	.long	.LASF2603
+	.long	.LASF2604
+	.long	.LASF2605
+	.long	.LASF2606
+	.long	.LASF2607
+	.long	.LASF2608
+	.long	.LASF2609
+	.long	.LASF2610
+	.long	.LASF2611
+	.long	.LASF2612
+	.long	.LASF2613
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0xae
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2614
+	.byte	0x17
+	.long	.LASF2615
+	.byte	0x17
+	.long	.LASF2616
+	.byte	0x17
+	.long	.LASF2617
+	.byte	0x4
+	.long	.LASF2618
+	.byte	0x4
+	.long	.LASF2619
+	.byte	0x9
+	.long	.LASF2620
+	.byte	0x9
+	.long	.LASF2621
+	.byte	0x9
+	.long	.LASF2622
+	.byte	0x9
+	.long	.LASF2623
+	.byte	0x9
+	.long	.LASF2624
+	.byte	0x9
+	.long	.LASF2625
+	.byte	0xa
+	.long	.LASF2626
+	.byte	0xb
+	.long	.LASF2627
+	.byte	0xa
+	.long	.LASF2628
+	.byte	0xa
+	.long	.LASF2629
+	.byte	0xa
+	.long	.LASF2630
+	.byte	0xa
+	.long	.LASF2631
+	.byte	0xf
+	.long	.LASF2632
+	.byte	0xd
+	.long	.LASF2622
+	.byte	0xd
+	.long	.LASF2633
+	.byte	0xd
+	.long	.LASF2634
+	.byte	0x12
+	.long	.LASF2635
+	.byte	0x10
+	.long	.LASF2636
+	.byte	0x11
+	.long	.LASF2637
+	.byte	0x11
+	.long	.LASF2638
+	.byte	0xb
+	.long	.LASF2639
+	.byte	0xb
+	.long	.LASF2640
+	.byte	0x2
+	.long	.LASF2641
+	.byte	0xa
+	.long	.LASF2642
+	.byte	0x11
+	.long	.LASF2643
+	.byte	0x9
+	.long	.LASF2644
+	.byte	0x11
+	.long	.LASF2645
+	.byte	0x11
+	.long	.LASF2646
+	.byte	0x11
+	.long	.LASF2647
+	.byte	0x1
+	.long	.LASF2648
+	.byte	0x14
+	.long	.LASF2649
+	.byte	0xb
+	.long	.LASF2650
+	.byte	0xd
+	.long	.LASF2651
+	.byte	0xb
+	.long	.LASF2652
+	.byte	0xa
+	.long	.LASF2653
+	.byte	0xe
+	.long	.LASF2654
+	.byte	0xa
+	.long	.LASF2655
+	.byte	0xb
+	.long	.LASF2656
+	.byte	0xd
+	.long	.LASF2657
+	.byte	0x11
+	.long	.LASF2658
+	.byte	0x5
+	.long	.LASF2659
+	.byte	0x9
+	.long	.LASF2617
+	.byte	0x9
+	.long	.LASF2660
+	.byte	0xf
+	.long	.LASF2661
+	.byte	0x9
+	.long	.LASF2662
+	.byte	0x9
+	.long	.LASF2663
+	.byte	0x4
+	.long	.LASF2664
+	.byte	0xd
+	.long	.LASF2665
+	.byte	0xa
+	.long	.LASF2666
+	.byte	0x1a
+	.long	.LASF2667
+	.byte	0x1b
+	.long	.LASF2668
+	.byte	0x1b
+	.long	.LASF2668
+	.byte	0x1a
+	.long	.LASF2669
+	.byte	0x17
+	.long	.LASF2670
+	.byte	0x1a
+	.long	.LASF2671
+	.byte	0x1a
+	.long	.LASF2672
+	.byte	0x17
+	.long	.LASF2673
+	.byte	0x17
+	.long	.LASF2674
+	.byte	0x19
+	.long	.LASF2675
+	.byte	0x17
+	.long	.LASF2676
+	.byte	0x18
+	.long	.LASF2677
+	.byte	0x18
+	.long	.LASF2678
+	.byte	0x17
+	.long	.LASF2679
+	.byte	0x17
+	.long	.LASF2680
+	.byte	0x17
+	.long	.LASF2681
+	.byte	0x1a
+	.long	.LASF2682
+	.byte	0x1b
+	.long	.LASF2683
+	.byte	0x16
+	.long	.LASF2684
+	.byte	0x16
+	.long	.LASF2685
+	.byte	0x1a
+	.long	.LASF2686
+	.byte	0x15
+	.long	.LASF2687
+	.byte	0x13
+	.long	.LASF2688
+	.byte	0x13
+	.long	.LASF2689
+	.byte	0x1
+	.long	.LASF2690
+	.byte	0x5
+	.long	.LASF2691
+	.byte	0x2
+	.long	.LASF2692
+	.byte	0x4
+	.long	.LASF2693
+	.byte	0x4
+	.long	.LASF2694
+	.byte	0x1b
+	.long	.LASF2695
+	.byte	0x5
+	.long	.LASF2696
+	.byte	0x5
+	.long	.LASF2697
+	.byte	0x3
+	.long	.LASF2698
+	.byte	0x9
+	.long	.LASF2699
+	.byte	0x3
+	.long	.LASF2700
+	.byte	0x9
+	.long	.LASF2701
+	.byte	0x9
+	.long	.LASF2702
+	.byte	0x9
+	.long	.LASF2703
+	.byte	0x9
+	.long	.LASF2704
+	.byte	0x4
+	.long	.LASF2705
+	.byte	0x9
+	.long	.LASF2706
+	.byte	0x9
+	.long	.LASF2707
+	.byte	0x9
+	.long	.LASF2708
+	.byte	0x9
+	.long	.LASF2709
+	.byte	0x9
+	.long	.LASF2710
+	.byte	0x6
+	.long	.LASF2711
+	.byte	0x9
+	.long	.LASF2712
+	.byte	0x9
+	.long	.LASF2713
+	.byte	0x9
+	.long	.LASF2714
+	.byte	0x6
+	.long	.LASF2715
+	.byte	0x1a
+	.long	.LASF2716
+	.byte	0x1a
+	.long	.LASF2717
+	.byte	0x16
+	.long	.LASF2718
+	.byte	0x16
+	.long	.LASF2719
+	.byte	0x17
+	.long	.LASF2720
+	.byte	0x17
+	.long	.LASF2716
+	.byte	0x17
+	.long	.LASF2721
+	.byte	0x16
+	.long	.LASF2722
+	.byte	0x17
+	.long	.LASF2617
+	.byte	0x1a
+	.long	.LASF2617
+	.byte	0x17
+	.long	.LASF2723
+	.byte	0x16
+	.long	.LASF2724
+	.byte	0x16
+	.long	.LASF2725
+	.byte	0x16
+	.long	.LASF2726
+	.byte	0x16
+	.long	.LASF2727
+	.byte	0x16
+	.long	.LASF2728
+	.byte	0x17
+	.long	.LASF2729
+	.byte	0x17
+	.long	.LASF2730
+	.byte	0x17
+	.long	.LASF2731
+	.byte	0x17
+	.long	.LASF2732
+	.byte	0x17
+	.long	.LASF2733
+	.byte	0x17
+	.long	.LASF2734
+	.byte	0x17
+	.long	.LASF2735
+	.byte	0x16
+	.long	.LASF2736
+	.byte	0x16
+	.long	.LASF2737
+	.byte	0x17
+	.long	.LASF2738
+	.byte	0x17
+	.long	.LASF2739
+	.byte	0x8
+	.long	.LASF2740
+	.byte	0x9
+	.long	.LASF2741
+	.byte	0x9
+	.long	.LASF2742
+	.byte	0x9
+	.long	.LASF2743
+	.byte	0x9
+	.long	.LASF2744
+	.byte	0x9
+	.long	.LASF2745
+	.byte	0x9
+	.long	.LASF2746
+	.byte	0x9
+	.long	.LASF2747
+	.byte	0x9
+	.long	.LASF2748
+	.byte	0x9
+	.long	.LASF2749
+	.byte	0x9
+	.long	.LASF2750
+	.byte	0x9
+	.long	.LASF2751
+	.byte	0x9
+	.long	.LASF2752
+	.byte	0x9
+	.long	.LASF2753
+	.byte	0x9
+	.long	.LASF2754
+	.byte	0xe
+	.long	.LASF2755
+	.byte	0x4
+	.long	.LASF2756
+	.byte	0xd
+	.long	.LASF2757
+	.byte	0xd
+	.long	.LASF2639
+	.byte	0xd
+	.long	.LASF2758
+	.byte	0xd
+	.long	.LASF2759
+	.byte	0xd
+	.long	.LASF2760
+	.byte	0xc
+	.long	.LASF2761
+	.byte	0xc
+	.long	.LASF2749
+	.byte	0xd
+	.long	.LASF2762
+	.byte	0xd
+	.long	.LASF2763
+	.byte	0xd
+	.long	.LASF2764
+	.byte	0xd
+	.long	.LASF2751
+	.byte	0xd
+	.long	.LASF2765
+	.byte	0xd
+	.long	.LASF2766
+	.byte	0xd
+	.long	.LASF2767
+	.byte	0xd
+	.long	.LASF2644
+	.byte	0x7
+	.long	.LASF2768
+	.byte	0x4
+	.long	.LASF2769
+	.byte	0x11
+	.long	.LASF2770
+	.byte	0x11
+	.long	.LASF2771
+	.byte	0x11
+	.long	.LASF2772
+	.byte	0x11
+	.long	.LASF2739
+	.byte	0x11
+	.long	.LASF2773
+	.byte	0x11
+	.long	.LASF2774
+	.byte	0x11
+	.long	.LASF2775
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1539:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1730:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1847:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1295:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1837:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF936:
+	.string	"HSV_VALUE_MAX 255"
+.LASF955:
+	.string	"_ANSI_STDARG_H_ "
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1369:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1315:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF944:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2017:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1934:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF2089:
+	.string	"RGB_GREEN"
+.LASF1825:
+	.string	"VIDEO_LINES_NTSC 13"
+.LASF2343:
+	.string	"rcInterpolationChannels"
+.LASF1186:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1340:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1922:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1053:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2285:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF2195:
+	.string	"FEATURE_TRANSPONDER"
+.LASF942:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1270:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF2398:
+	.string	"reboot_character"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2034:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1694:
+	.string	"sched_priority sched_priority"
+.LASF821:
+	.string	"USE_PPM"
+.LASF1582:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1577:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF2401:
+	.string	"modeColorIndexes_s"
+.LASF2403:
+	.string	"modeColorIndexes_t"
+.LASF2176:
+	.string	"FEATURE_RX_PPM"
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF2539:
+	.string	"imuInit"
+.LASF1184:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1442:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1563:
+	.string	"SOFTSERIAL_BUFFER_SIZE 256"
+.LASF1632:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1600:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1807:
+	.string	"TRANSPONDER_CARRIER_HZ_ILAP 460750"
+.LASF1673:
+	.string	"__pid_t_defined "
+.LASF1665:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF911:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2020:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1103:
+	.string	"NVIC_PRIO_SERIALUART8_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2281:
+	.string	"BOXCAMERA1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2074:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2436:
+	.string	"boardAlignment_s"
+.LASF1695:
+	.string	"__sched_priority sched_priority"
+.LASF1085:
+	.string	"NVIC_PRIO_SERIALUART2_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2548:
+	.string	"servoDevInit"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2086:
+	.string	"_Bool"
+.LASF2334:
+	.string	"spektrum_sat_bind"
+.LASF1241:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1562:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2027:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1388:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF1148:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1134:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1986:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF1680:
+	.string	"__CPU_SETSIZE 1024"
+.LASF2246:
+	.string	"SYSTEM_STATE_TRANSPONDER_ENABLED"
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1737:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1704:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2108:
+	.string	"OWNER_ADC_CURR"
+.LASF700:
+	.string	"__need_size_t "
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1530:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1193:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2581:
+	.string	"flight3DConfig"
+.LASF1564:
+	.string	"USE_UART "
+.LASF1082:
+	.string	"NVIC_PRIO_SERIALUART1_TXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1840:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2245:
+	.string	"SYSTEM_STATE_MOTORS_READY"
+.LASF2361:
+	.string	"BEEPER_GPS_STATUS"
+.LASF954:
+	.string	"_STDARG_H "
+.LASF1138:
+	.string	"IOCFG_AF_OD 0"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1769:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2525:
+	.string	"batteryInit"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF1650:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1018:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2446:
+	.string	"MIXER_GIMBAL"
+.LASF1900:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1804:
+	.string	"TRANSPONDER_TOGGLES_ILAP (TRANSPONDER_TOGGLES_PER_BIT_ILAP + TRANSPONDER_GAP_TOGGLES_ILAP)"
+.LASF1466:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1366:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1412:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2351:
+	.string	"rxConfig_System"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1607:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1863:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1171:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF2338:
+	.string	"rssi_invert"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1535:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"deadband3d_throttle"
+.LASF2439:
+	.string	"yawDegrees"
+.LASF1294:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2586:
+	.string	"processLoopback"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1939:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1006:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF1374:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1358:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1507:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2418:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1652:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF970:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1822:
+	.string	"BWBRIGHTNESS ((BLACKBRIGHTNESS << 2) | WHITEBRIGHTNESS)"
+.LASF2105:
+	.string	"OWNER_LED"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1206:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1223:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2185:
+	.string	"FEATURE_TELEMETRY"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2090:
+	.string	"RGB_BLUE"
+.LASF2082:
+	.string	"uint16_t"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1873:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF380:
+	.string	"linux 1"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF2295:
+	.string	"ARMING_DISABLED_FAILSAFE"
+.LASF991:
+	.string	"PG_RX_CONFIG 24"
+.LASF1684:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1142:
+	.string	"NOOP do {} while (0)"
+.LASF1474:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2059:
+	.string	"RCSPLIT_PACKET_TAIL 0xaa"
+.LASF1949:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1553:
+	.string	"LED1_OFF NOOP"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1068:
+	.string	"CLR_PRINTVALUE(p) { (p)->flags &= ~PRINT_VALUE; }"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2041:
+	.string	"PIDSUM_LIMIT 500"
+.LASF1560:
+	.string	"BEEP_ON do {} while (0)"
+.LASF2508:
+	.string	"INPUT_RC_AUX1"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF2174:
+	.string	"csTag"
+.LASF2510:
+	.string	"INPUT_RC_AUX3"
+.LASF1821:
+	.string	"BLACKBRIGHTNESS 0x00"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1427:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"NVIC_PRIO_BARO_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF1640:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1886:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1417:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF974:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1286:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2480:
+	.string	"motorConfig_System"
+.LASF2503:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2396:
+	.string	"portConfigs"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1010:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1919:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1906:
+	.string	"SRXL_FRAME_SIZE_MAX (SPEK_FRAME_SIZE + SRXL_FRAME_OVERHEAD)"
+.LASF965:
+	.string	"_VA_LIST_DEFINED "
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2512:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF2308:
+	.string	"CALIBRATE_MAG"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2366:
+	.string	"BEEPER_READY_BEEP"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF1678:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2004:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1973:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF1792:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER 4"
+.LASF2110:
+	.string	"OWNER_ADC_RSSI"
+.LASF1843:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1498:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF945:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1897:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2271:
+	.string	"BOXSONAR"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2544:
+	.string	"setArmingDisabled"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2528:
+	.string	"gyroStartCalibration"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1408:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1780:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1615:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1506:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2483:
+	.string	"PID_YAW"
+.LASF1399:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1931:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1534:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2112:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1798:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ARCITIMER 4500"
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1739:
+	.string	"__have_pthread_attr_t 1"
+.LASF1679:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2046:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1202:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2576:
+	.string	"mixerConfig"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1160:
+	.string	"BIT(x) (1 << (x))"
+.LASF2136:
+	.string	"OWNER_BEEPER"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1776:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2527:
+	.string	"baroSetCalibrationCycles"
+.LASF2456:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF1783:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF2399:
+	.string	"serialConfig_t"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1548:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF2080:
+	.string	"int32_t"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2388:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1485:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"FAST_MATH "
+.LASF799:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2064:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1633:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF2144:
+	.string	"OWNER_SPI_PREINIT"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1456:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF1173:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2574:
+	.string	"servoConfig"
+.LASF925:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1226:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1175:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1905:
+	.string	"SRXL_FRAME_OVERHEAD 5"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2133:
+	.string	"OWNER_BARO_EXTI"
+.LASF987:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF967:
+	.string	"__va_list__ "
+.LASF1927:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1766:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1788:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF2060:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF516:
+	.string	"__always_inline"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2473:
+	.string	"mixerConfig_System"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1892:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF822:
+	.string	"USE_PWM"
+.LASF1321:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1182:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1095:
+	.string	"NVIC_PRIO_SERIALUART5_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1159:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1930:
+	.string	"LED_POS_OFFSET 0"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2111:
+	.string	"OWNER_SERIAL_TX"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2254:
+	.string	"BOXMAG"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1007:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1090:
+	.string	"NVIC_PRIO_SERIALUART3 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1235:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1021:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1108:
+	.string	"NVIC_PRIO_USB NVIC_BUILD_PRIORITY(2, 0)"
+.LASF1088:
+	.string	"NVIC_PRIO_SERIALUART3_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1969:
+	.string	"DASHBOARD_I2C_ADDRESS 0x3C"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1823:
+	.string	"VIDEO_BUFFER_CHARS_NTSC 390"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1249:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1541:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1968:
+	.string	"DASHBOARD_I2C_INSTANCE I2CDEV_1"
+.LASF2448:
+	.string	"MIXER_HEX6"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2095:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF1493:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2026:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF1700:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1565:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1063:
+	.string	"PRINT_LABEL 0x02"
+.LASF1152:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2183:
+	.string	"FEATURE_FAILSAFE"
+.LASF1558:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1611:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1436:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF1587:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF2373:
+	.string	"BEEPER_PREFERENCE"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1677:
+	.string	"SCHED_RR 2"
+.LASF2264:
+	.string	"BOXLEDLOW"
+.LASF2324:
+	.string	"rxConfig_s"
+.LASF2350:
+	.string	"rxConfig_t"
+.LASF2134:
+	.string	"OWNER_USB"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1327:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF399:
+	.string	"false 0"
+.LASF2146:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF923:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1499:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1445:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1183:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF995:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF2251:
+	.string	"BOXHORIZON"
+.LASF2583:
+	.string	"systemConfig"
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1580:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1802:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ILAP 11"
+.LASF2333:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF2220:
+	.string	"pidSumLimit"
+.LASF2227:
+	.string	"horizon_tilt_effect"
+.LASF2537:
+	.string	"mspSerialInit"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF2319:
+	.string	"SERIALRX_IBUS"
+.LASF1715:
+	.string	"__itimerspec_defined 1"
+.LASF2336:
+	.string	"rssi_channel"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1991:
+	.string	"RTC6705_POWER_COUNT 2"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF2047:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF1243:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1768:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1418:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2200:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2215:
+	.string	"dterm_lpf_hz"
+.LASF1342:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2331:
+	.string	"rx_spi_rf_channel_count"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2013:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF2051:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2151:
+	.string	"ioTagRx"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF2187:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2290:
+	.string	"neutral3d"
+.LASF1555:
+	.string	"LED2_TOGGLE NOOP"
+.LASF1944:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1348:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2066:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF1908:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2499:
+	.string	"airmodeWasActivated"
+.LASF2265:
+	.string	"BOXLLIGHTS"
+.LASF1199:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF2116:
+	.string	"OWNER_SONAR_ECHO"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1590:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF1459:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2184:
+	.string	"FEATURE_SONAR"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1891:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2346:
+	.string	"max_aux_channel"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2173:
+	.string	"flashConfig_s"
+.LASF2175:
+	.string	"flashConfig_t"
+.LASF999:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1043:
+	.string	"PG_VTX_CONFIG 515"
+.LASF914:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2104:
+	.string	"OWNER_SERVO"
+.LASF1162:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF989:
+	.string	"PG_IMU_CONFIG 22"
+.LASF793:
+	.string	"ACC "
+.LASF1693:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF2057:
+	.string	"RCSPLIT_PACKET_HEADER 0x55"
+.LASF1261:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1581:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1963:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF1806:
+	.string	"TRANSPONDER_TIMER_MHZ_ILAP 24"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF738:
+	.string	"USE_PWM "
+.LASF2353:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1489:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF2363:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF393:
+	.string	"__REVISION__ \"1ac2fba\""
+.LASF1833:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1967:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF968:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1200:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1304:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2327:
+	.string	"sbus_inversion"
+.LASF1594:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF913:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1527:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF917:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1803:
+	.string	"TRANSPONDER_GAP_TOGGLES_ILAP 1"
+.LASF1203:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1866:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF2463:
+	.string	"MIXER_ATAIL4"
+.LASF2455:
+	.string	"MIXER_AIRPLANE"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1796:
+	.string	"TRANSPONDER_TIMER_MHZ_ARCITIMER 24"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2339:
+	.string	"midrc"
+.LASF820:
+	.string	"USE_VCP"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2000:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1877:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2218:
+	.string	"dterm_notch_cutoff"
+.LASF2037:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF2150:
+	.string	"ioTagTx"
+.LASF2075:
+	.string	"__uint16_t"
+.LASF1703:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2103:
+	.string	"OWNER_MOTOR"
+.LASF1727:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1396:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1546:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1251:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF949:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF1648:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF1561:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2130:
+	.string	"OWNER_RX_SPI_CS"
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1716:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1844:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1952:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1155:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1559:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1817:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ERLT 22500"
+.LASF2535:
+	.string	"failsafeInit"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF2542:
+	.string	"rcSplitInit"
+.LASF2585:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF2236:
+	.string	"crash_gthreshold"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2196:
+	.string	"FEATURE_AIRMODE"
+.LASF2329:
+	.string	"rx_spi_protocol"
+.LASF2479:
+	.string	"motorConfig_t"
+.LASF2538:
+	.string	"mspFcInit"
+.LASF1510:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF1262:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1086:
+	.string	"NVIC_PRIO_SERIALUART2_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF939:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1301:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2094:
+	.string	"FAILURE_ACC_INIT"
+.LASF1836:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2433:
+	.string	"SENSOR_INDEX_BARO"
+.LASF910:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2432:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2475:
+	.string	"digitalIdleOffsetValue"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF929:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1935:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF1661:
+	.string	"_PTHREAD_H 1"
+.LASF1910:
+	.string	"FLASHFS_WRITE_BUFFER_PAGES 2"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1997:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1954:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF2030:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1701:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1147:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1367:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1044:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF356:
+	.string	"__amd64 1"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF1188:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1759:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1185:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2068:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1201:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2179:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1697:
+	.string	"_BITS_TIME_H 1"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2178:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1054:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF2517:
+	.string	"servo_lowpass_freq"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1354:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2014:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF1391:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF777:
+	.string	"USE_NAV "
+.LASF1964:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1000:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF976:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF365:
+	.string	"__k8 1"
+.LASF2330:
+	.string	"rx_spi_id"
+.LASF983:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF2543:
+	.string	"getBeeperOffMask"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF1789:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF2164:
+	.string	"motorPwmProtocol"
+.LASF2085:
+	.string	"float"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF978:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF1747:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF2003:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF2241:
+	.string	"currentPidProfile"
+.LASF1681:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1355:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2345:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1297:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF795:
+	.string	"GYRO "
+.LASF2340:
+	.string	"mincheck"
+.LASF1034:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1770:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1998:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1787:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1273:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1136:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1219:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2464:
+	.string	"MIXER_CUSTOM"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF2266:
+	.string	"BOXCALIB"
+.LASF1602:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF2181:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF905:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1960:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1775:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF1595:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2058:
+	.string	"RCSPLIT_PACKET_CMD_CTRL 0x01"
+.LASF1755:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1123:
+	.string	"DMA_OUTPUT_INDEX 0"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF930:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1015:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2262:
+	.string	"BOXBEEPERON"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF2161:
+	.string	"PWM_TYPE_MAX"
+.LASF1750:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1578:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF381:
+	.string	"__unix 1"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1073:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF1515:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2142:
+	.string	"OWNER_VTX"
+.LASF515:
+	.string	"__wur "
+.LASF749:
+	.string	"LED_STRIP "
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1865:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2430:
+	.string	"TASK_SELF"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1176:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1818:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ERLT 5000"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1662:
+	.string	"_SCHED_H 1"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1045:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF985:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2202:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2010:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1987:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF2341:
+	.string	"maxcheck"
+.LASF2009:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2362:
+	.string	"BEEPER_RX_SET"
+.LASF2572:
+	.string	"init"
+.LASF1925:
+	.string	"LED_MODE_COUNT 6"
+.LASF1288:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2358:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1409:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1890:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1791:
+	.string	"TRANSPONDER_DATA_LENGTH_ARCITIMER 9"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2159:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2125:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1610:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2404:
+	.string	"specialColorIndexes_s"
+.LASF2405:
+	.string	"specialColorIndexes_t"
+.LASF1111:
+	.string	"NVIC_PRIO_MPU_DATA_READY NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1571:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1451:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1156:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF2352:
+	.string	"BEEPER_SILENCE"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2420:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2371:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1994:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF1140:
+	.string	"IOCFG_IPU 0"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF962:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF2228:
+	.string	"horizon_tilt_expert_mode"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1390:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1503:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1204:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF946:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2465:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1316:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1801:
+	.string	"TRANSPONDER_DATA_LENGTH_ILAP 6"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1874:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF2272:
+	.string	"BOXSERVO1"
+.LASF2273:
+	.string	"BOXSERVO2"
+.LASF2274:
+	.string	"BOXSERVO3"
+.LASF1644:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1838:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1913:
+	.string	"FLASHFS_ERASE_POOL_SECTORS 4"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2198:
+	.string	"FEATURE_RX_SPI"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF943:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1741:
+	.string	"____sigset_t_defined "
+.LASF2573:
+	.string	"idlePulse"
+.LASF2203:
+	.string	"systemConfig_s"
+.LASF2209:
+	.string	"systemConfig_t"
+.LASF1525:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1454:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1133:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1005:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF2163:
+	.string	"motorPwmRate"
+.LASF1781:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1568:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF1537:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1465:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1187:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2391:
+	.string	"gps_baudrateIndex"
+.LASF1041:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2093:
+	.string	"FAILURE_MISSING_ACC"
+.LASF1191:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2302:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1845:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF963:
+	.string	"_VA_LIST_ "
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1589:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1946:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF1092:
+	.string	"NVIC_PRIO_SERIALUART4_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1501:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1685:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1074:
+	.string	"NVIC_PRIO_MAX NVIC_BUILD_PRIORITY(0, 1)"
+.LASF2087:
+	.string	"timeMs_t"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2170:
+	.string	"servoCenterPulse"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1573:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF2547:
+	.string	"initBoardAlignment"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1217:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1895:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2135:
+	.string	"OWNER_USB_DETECT"
+.LASF1494:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"NVIC_PRIO_SERIALUART3_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1113:
+	.string	"NVIC_PRIO_CALLBACK NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1556:
+	.string	"LED2_OFF NOOP"
+.LASF1120:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1614:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1091:
+	.string	"NVIC_PRIO_SERIALUART4_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF2335:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1025:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF2571:
+	.string	"flashfsInit"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2349:
+	.string	"rx_max_usec"
+.LASF928:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2545:
+	.string	"indicateFailure"
+.LASF1585:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1636:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2519:
+	.string	"channelForwardingStartChannel"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2558:
+	.string	"uartPinConfigure"
+.LASF1924:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1157:
+	.string	"PP_IIF_0(t,f) f"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1800:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ILAP 10"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF1093:
+	.string	"NVIC_PRIO_SERIALUART4 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2462:
+	.string	"MIXER_SINGLECOPTER"
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2191:
+	.string	"FEATURE_DASHBOARD"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1309:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1784:
+	.string	"SPIDEV_COUNT 4"
+.LASF1811:
+	.string	"ERLTBitQuiet 0"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1985:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF2139:
+	.string	"OWNER_INVERTER"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF2042:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1707:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1947:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF2120:
+	.string	"OWNER_SPI_MOSI"
+.LASF1508:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2389:
+	.string	"identifier"
+.LASF2564:
+	.string	"latchActiveFeatures"
+.LASF2081:
+	.string	"uint8_t"
+.LASF1061:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1609:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2038:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1067:
+	.string	"SET_PRINTVALUE(p) { (p)->flags |= PRINT_VALUE; }"
+.LASF1965:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1497:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1166:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1731:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1154:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2301:
+	.string	"ARMING_DISABLED_CLI"
+.LASF2434:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1337:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF1344:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF1019:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1612:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1107:
+	.string	"NVIC_PRIO_I2C_EV NVIC_BUILD_PRIORITY(0, 0)"
+.LASF1126:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1318:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2494:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF1319:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF941:
+	.string	"VERY_FAST_MATH "
+.LASF2452:
+	.string	"MIXER_OCTOX8"
+.LASF819:
+	.string	"USE_ADC"
+.LASF2529:
+	.string	"accSetCalibrationCycles"
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2413:
+	.string	"TASK_ACCEL"
+.LASF1945:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1118:
+	.string	"NVIC_PRIORITY_SUB(prio) (((prio)&(0x0f>>(7-(NVIC_PRIORITY_GROUPING>>8))))>>4)"
+.LASF2482:
+	.string	"PID_PITCH"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1795:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ARCITIMER 155 * TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER"
+.LASF1613:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF1052:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1360:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF383:
+	.string	"unix 1"
+.LASF2054:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF958:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1292:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF2177:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2365:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1692:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1313:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF2304:
+	.string	"ARMING_DISABLED_BST"
+.LASF2570:
+	.string	"printfSupportInit"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF921:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF756:
+	.string	"CMS "
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2382:
+	.string	"SERIAL_PORT_USART8"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF2132:
+	.string	"OWNER_MPU_EXTI"
+.LASF1852:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1686:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1174:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF2102:
+	.string	"OWNER_PPMINPUT"
+.LASF2147:
+	.string	"ioTag_t"
+.LASF2171:
+	.string	"servoPwmRate"
+.LASF1139:
+	.string	"IOCFG_IPD 0"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF2466:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF2225:
+	.string	"levelAngleLimit"
+.LASF1552:
+	.string	"LED1_TOGGLE NOOP"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1779:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF904:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1521:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1003:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2156:
+	.string	"PWM_TYPE_STANDARD"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF2507:
+	.string	"INPUT_RC_THROTTLE"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1471:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1584:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1774:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1205:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1761:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2443:
+	.string	"MIXER_QUADP"
+.LASF1710:
+	.string	"TIMER_ABSTIME 1"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF1970:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1291:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF2444:
+	.string	"MIXER_QUADX"
+.LASF1328:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1878:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1490:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1649:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1029:
+	.string	"PG_OSD_CONFIG 501"
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2337:
+	.string	"rssi_scale"
+.LASF993:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2033:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2318:
+	.string	"SERIALRX_XBUS_MODE_B_RJ01"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF998:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1809:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ILAP 10000"
+.LASF1255:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2165:
+	.string	"motorPwmInversion"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF1909:
+	.string	"FLASHFS_PAGE_SIZE 256"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2488:
+	.string	"PID_LEVEL"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1667:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2025:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2280:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2312:
+	.string	"SERIALRX_SPEKTRUM1024"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1543:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"ARMING_DISABLED_NO_GYRO"
+.LASF1042:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2442:
+	.string	"MIXER_TRI"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF1438:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1420:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1941:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF2328:
+	.string	"halfDuplex"
+.LASF1483:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1831:
+	.string	"RTC6705_FREQ_MAX 5950"
+.LASF2342:
+	.string	"rcInterpolation"
+.LASF2205:
+	.string	"activeRateProfile"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1208:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF2278:
+	.string	"BOX3DDISABLE"
+.LASF2533:
+	.string	"gpsInit"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1349:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2011:
+	.string	"ESC_DATA_INVALID 255"
+.LASF2194:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1851:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1903:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF1785:
+	.string	"M25P16_PAGESIZE 256"
+.LASF2032:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1773:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1923:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF2530:
+	.string	"blackboxInit"
+.LASF1268:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2505:
+	.string	"INPUT_RC_PITCH"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1932:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF1178:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF2189:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1099:
+	.string	"NVIC_PRIO_SERIALUART6 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1805:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ILAP ((TRANSPONDER_TOGGLES_PER_BIT_ILAP + 1) * TRANSPONDER_BITS_PER_BYTE_ILAP * TRANSPONDER_DATA_LENGTH_ILAP)"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF1575:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1040:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1083:
+	.string	"NVIC_PRIO_SERIALUART1_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF2518:
+	.string	"tri_unarmed_servo"
+.LASF1486:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2115:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1675:
+	.string	"SCHED_OTHER 0"
+.LASF953:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1477:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1363:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1423:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1656:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2149:
+	.string	"serialPinConfig_s"
+.LASF2153:
+	.string	"serialPinConfig_t"
+.LASF1256:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF1586:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2408:
+	.string	"modeColors"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1110:
+	.string	"NVIC_PRIO_SONAR_ECHO NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF2249:
+	.string	"BOXARM"
+.LASF1627:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF2501:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF902:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2575:
+	.string	"motorConfig"
+.LASF2306:
+	.string	"GPS_FIX_HOME"
+.LASF1674:
+	.string	"_BITS_SCHED_H 1"
+.LASF2197:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1531:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2117:
+	.string	"OWNER_SYSTEM"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1829:
+	.string	"RTC6705_RF_POWER_COUNT 2"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1264:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__PMT"
+.LASF2392:
+	.string	"blackbox_baudrateIndex"
+.LASF1961:
+	.string	"LED_XY_MASK 0x0F"
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2485:
+	.string	"PID_POS"
+.LASF1729:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2234:
+	.string	"rateAccelLimit"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2213:
+	.string	"pidProfile_s"
+.LASF2498:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1596:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1512:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1635:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1017:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1522:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1711:
+	.string	"__clock_t_defined 1"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1475:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2534:
+	.string	"rxInit"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1869:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1352:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1920:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF975:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1517:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1115:
+	.string	"NVIC_PRIORITY_GROUPING NVIC_PriorityGroup_2"
+.LASF2250:
+	.string	"BOXANGLE"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1937:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF2437:
+	.string	"rollDegrees"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1117:
+	.string	"NVIC_PRIORITY_BASE(prio) (((prio)>>(4-(7-(NVIC_PRIORITY_GROUPING>>8))))>>4)"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1481:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF2029:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1069:
+	.string	"IS_PRINTLABEL(p) ((p)->flags & PRINT_LABEL)"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2160:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF908:
+	.string	"UNIT_TESTED "
+.LASF2563:
+	.string	"feature"
+.LASF2167:
+	.string	"ioTags"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1771:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2568:
+	.string	"IOInitGlobal"
+.LASF1962:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1406:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF1950:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2199:
+	.string	"FEATURE_SOFTSPI"
+.LASF1971:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF1637:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1724:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1815:
+	.string	"TRANSPONDER_TIMER_MHZ_ERLT 18"
+.LASF2368:
+	.string	"BEEPER_ARMED"
+.LASF926:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF479:
+	.string	"__P(args) args"
+.LASF1835:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF969:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2296:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1583:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF918:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1814:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ERLT 200"
+.LASF1246:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"NVIC_PRIO_TIMER NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1982:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF1749:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1050:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2445:
+	.string	"MIXER_BICOPTER"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2222:
+	.string	"dterm_average_count"
+.LASF2012:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF961:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1495:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1816:
+	.string	"TRANSPONDER_CARRIER_HZ_ERLT 38000"
+.LASF1303:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF1604:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF1868:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2208:
+	.string	"name"
+.LASF1753:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1862:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1058:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1820:
+	.string	"WHITEBRIGHTNESS 0x01"
+.LASF1754:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF1330:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2526:
+	.string	"timerStart"
+.LASF1921:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1426:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1312:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1718:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2223:
+	.string	"vbatPidCompensation"
+.LASF1629:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1554:
+	.string	"LED1_ON NOOP"
+.LASF1713:
+	.string	"__clockid_t_defined 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2476:
+	.string	"minthrottle"
+.LASF1758:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2307:
+	.string	"GPS_FIX"
+.LASF2410:
+	.string	"TASK_SYSTEM"
+.LASF1557:
+	.string	"LED2_ON NOOP"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2414:
+	.string	"TASK_ATTITUDE"
+.LASF1462:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2293:
+	.string	"flight3DConfig_System"
+.LASF1124:
+	.string	"DMA_OUTPUT_STRING \"DMA%d Channel %d:\""
+.LASF2495:
+	.string	"pidCrashRecovery_e"
+.LASF934:
+	.string	"HSV_HUE_MAX 359"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF2152:
+	.string	"ioTagInverter"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2267:
+	.string	"BOXGOV"
+.LASF2372:
+	.string	"BEEPER_ALL"
+.LASF737:
+	.string	"USE_PPM "
+.LASF1237:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1197:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2023:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1647:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1860:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1339:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1861:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2458:
+	.string	"MIXER_VTAIL4"
+.LASF1098:
+	.string	"NVIC_PRIO_SERIALUART6_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2569:
+	.string	"systemInit"
+.LASF948:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1617:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF2360:
+	.string	"BEEPER_BAT_LOW"
+.LASF1144:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1992:
+	.string	"VTX_RTC6705_DEFAULT_POWER 0"
+.LASF847:
+	.string	"USE_SPI"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2123:
+	.string	"OWNER_SDCARD"
+.LASF1940:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1911:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_WRITE_BUFFER_PAGES * FLASHFS_PAGE_SIZE)"
+.LASF2502:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF2468:
+	.string	"mixerMode_e"
+.LASF2509:
+	.string	"INPUT_RC_AUX2"
+.LASF2477:
+	.string	"maxthrottle"
+.LASF2511:
+	.string	"INPUT_RC_AUX4"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1016:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1660:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2062:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF721:
+	.string	"NULL"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1526:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1813:
+	.string	"ERLTCyclesForZeroBit 10"
+.LASF1056:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2460:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF2069:
+	.string	"short unsigned int"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2015:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2072:
+	.string	"signed char"
+.LASF912:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1096:
+	.string	"NVIC_PRIO_SERIALUART5 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1411:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF1751:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF2536:
+	.string	"cliInit"
+.LASF1523:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF1469:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF984:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1858:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1013:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF2411:
+	.string	"TASK_GYROPID"
+.LASF1663:
+	.string	"__time_t_defined 1"
+.LASF2169:
+	.string	"servoDevConfig_s"
+.LASF2172:
+	.string	"servoDevConfig_t"
+.LASF2309:
+	.string	"SMALL_ANGLE"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF938:
+	.string	"sq(x) ((x)*(x))"
+.LASF1397:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1112:
+	.string	"NVIC_PRIO_MAG_DATA_READY NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1164:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1432:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1738:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF1883:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2356:
+	.string	"BEEPER_DISARMING"
+.LASF2440:
+	.string	"boardAlignment_t"
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1105:
+	.string	"NVIC_PRIO_SERIALUART8 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1763:
+	.string	"__cleanup_fct_attribute "
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF1914:
+	.string	"LAT 0"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1220:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF1717:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2257:
+	.string	"BOXCAMSTAB"
+.LASF2206:
+	.string	"debug_mode"
+.LASF2427:
+	.string	"TASK_RCSPLIT"
+.LASF1141:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2552:
+	.string	"getMotorCount"
+.LASF2370:
+	.string	"BEEPER_USB"
+.LASF1849:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF1828:
+	.string	"RTC6705_CHANNEL_COUNT 8"
+.LASF2559:
+	.string	"timerInit"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2384:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2385:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1722:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2406:
+	.string	"SystemCoreClock"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1325:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2277:
+	.string	"BOXAIRMODE"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2326:
+	.string	"serialrx_provider"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF996:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1857:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1106:
+	.string	"NVIC_PRIO_I2C_ER NVIC_BUILD_PRIORITY(0, 0)"
+.LASF1855:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF2248:
+	.string	"systemState"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2566:
+	.string	"ensureEEPROMContainsValidData"
+.LASF2449:
+	.string	"MIXER_FLYING_WING"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"BLACKBOX "
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1765:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF2400:
+	.string	"serialConfig_System"
+.LASF1832:
+	.string	"RTC6705_BOOT_DELAY 350"
+.LASF2242:
+	.string	"SYSTEM_STATE_INITIALISING"
+.LASF1051:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2137:
+	.string	"OWNER_OSD"
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF1229:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2546:
+	.string	"sensorsAutodetect"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1441:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF982:
+	.string	"PG_PID_PROFILE 14"
+.LASF2478:
+	.string	"mincommand"
+.LASF1001:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1626:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1603:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1035:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2255:
+	.string	"BOXHEADFREE"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2099:
+	.string	"failureMode_e"
+.LASF1192:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1867:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF2005:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1403:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2322:
+	.string	"SERIALRX_SRXL"
+.LASF1793:
+	.string	"TRANSPONDER_GAP_TOGGLES_ARCITIMER 0"
+.LASF2305:
+	.string	"armingDisableFlags_e"
+.LASF1172:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1576:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1207:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF2450:
+	.string	"MIXER_Y4"
+.LASF2447:
+	.string	"MIXER_Y6"
+.LASF1846:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2045:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF931:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2230:
+	.string	"itermAcceleratorGain"
+.LASF2238:
+	.string	"crash_recovery_angle"
+.LASF2487:
+	.string	"PID_NAVR"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1393:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1938:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF379:
+	.string	"__linux__ 1"
+.LASF1566:
+	.string	"I2CDEV_COUNT 4"
+.LASF2565:
+	.string	"readEEPROM"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1841:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1198:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1996:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2383:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1639:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1048:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1104:
+	.string	"NVIC_PRIO_SERIALUART8_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF2192:
+	.string	"FEATURE_OSD"
+.LASF2001:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1880:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1549:
+	.string	"LED0_TOGGLE NOOP"
+.LASF776:
+	.string	"GPS "
+.LASF2002:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF979:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2375:
+	.string	"SERIAL_PORT_USART1"
+.LASF2376:
+	.string	"SERIAL_PORT_USART2"
+.LASF2377:
+	.string	"SERIAL_PORT_USART3"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2380:
+	.string	"SERIAL_PORT_USART6"
+.LASF2381:
+	.string	"SERIAL_PORT_USART7"
+.LASF2311:
+	.string	"stateFlags"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2426:
+	.string	"TASK_BLACKBOX"
+.LASF1179:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1977:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF2317:
+	.string	"SERIALRX_XBUS_MODE_B"
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF1472:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF2078:
+	.string	"long int"
+.LASF2282:
+	.string	"BOXCAMERA2"
+.LASF2283:
+	.string	"BOXCAMERA3"
+.LASF988:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1298:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1364:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1721:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2044:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1504:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1993:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF1190:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1062:
+	.string	"PRINT_VALUE 0x01"
+.LASF1127:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1916:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2457:
+	.string	"MIXER_HELI_90_DEG"
+.LASF950:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1772:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2113:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2453:
+	.string	"MIXER_OCTOFLATP"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1513:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1676:
+	.string	"SCHED_FIFO 1"
+.LASF2454:
+	.string	"MIXER_OCTOFLATX"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2240:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1283:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2268:
+	.string	"BOXOSD"
+.LASF1864:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF1870:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF390:
+	.string	"SITL 1"
+.LASF1046:
+	.string	"PG_I2C_CONFIG 518"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF920:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1240:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2276:
+	.string	"BOXFAILSAFE"
+.LASF1714:
+	.string	"__timer_t_defined 1"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF1690:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1664:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1689:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1712:
+	.string	"__struct_tm_defined 1"
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1705:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1378:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2270:
+	.string	"BOXGTUNE"
+.LASF1324:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2416:
+	.string	"TASK_SERIAL"
+.LASF1210:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1926:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1955:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF1743:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF2157:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF1153:
+	.string	"EXPAND_I(x) x"
+.LASF927:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1372:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1887:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2031:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2083:
+	.string	"uint32_t"
+.LASF1658:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF1077:
+	.string	"NVIC_PRIO_SONAR_EXTI NVIC_BUILD_PRIORITY(2, 0)"
+.LASF1487:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF2253:
+	.string	"BOXANTIGRAVITY"
+.LASF1728:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1387:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2584:
+	.string	"serialPinConfig"
+.LASF2204:
+	.string	"pidProfileIndex"
+.LASF1087:
+	.string	"NVIC_PRIO_SERIALUART2 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1244:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1790:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ARCITIMER 8"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF992:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1748:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1496:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1742:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2107:
+	.string	"OWNER_ADC_BATT"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2260:
+	.string	"BOXGPSHOLD"
+.LASF1014:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2040:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2577:
+	.string	"boardAlignment"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF1032:
+	.string	"PG_PID_CONFIG 504"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1457:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2049:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2300:
+	.string	"ARMING_DISABLED_CALIBRATING"
+.LASF1696:
+	.string	"_TIME_H 1"
+.LASF2092:
+	.string	"FAILURE_DEVELOPER"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2275:
+	.string	"BOXBLACKBOX"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF2071:
+	.string	"long unsigned int"
+.LASF1702:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1942:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF2256:
+	.string	"BOXHEADADJ"
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1011:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2522:
+	.string	"debugMode"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF366:
+	.string	"__k8__ 1"
+.LASF1132:
+	.string	"IO_TAG_NONE 0"
+.LASF971:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2550:
+	.string	"servoConfigureOutput"
+.LASF1631:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF2415:
+	.string	"TASK_RX"
+.LASF1936:
+	.string	"LED_POS_BITCNT 8"
+.LASF1659:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2259:
+	.string	"BOXGPSHOME"
+.LASF2221:
+	.string	"pidSumLimitYaw"
+.LASF2114:
+	.string	"OWNER_TIMER"
+.LASF1267:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2553:
+	.string	"mixerConfigureOutput"
+.LASF1981:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1012:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1071:
+	.string	"CLR_PRINTLABEL(p) { (p)->flags &= ~PRINT_LABEL; }"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2428:
+	.string	"TASK_COUNT"
+.LASF1059:
+	.string	"CMS_EXIT (0)"
+.LASF2232:
+	.string	"dtermSetpointWeight"
+.LASF1799:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ARCITIMER 10000"
+.LASF1797:
+	.string	"TRANSPONDER_CARRIER_HZ_ARCITIMER 41886"
+.LASF1421:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1150:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1307:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1480:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1725:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1509:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2409:
+	.string	"specialColors"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2079:
+	.string	"char"
+.LASF1723:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1882:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1567:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2235:
+	.string	"crash_dthreshold"
+.LASF2412:
+	.string	"TASK_PID"
+.LASF1542:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF1402:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1137:
+	.string	"IOCFG_AF_PP 0"
+.LASF1854:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1081:
+	.string	"NVIC_PRIO_WS2811_DMA NVIC_BUILD_PRIORITY(1, 2)"
+.LASF2148:
+	.string	"hsvColor_s"
+.LASF2091:
+	.string	"hsvColor_t"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1232:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1953:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF957:
+	.string	"__GNUC_VA_LIST "
+.LASF1859:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2263:
+	.string	"BOXLEDMAX"
+.LASF959:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1168:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2158:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1055:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2374:
+	.string	"SERIAL_PORT_NONE"
+.LASF1351:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2226:
+	.string	"levelSensitivity"
+.LASF2126:
+	.string	"OWNER_FLASH_CS"
+.LASF1740:
+	.string	"_BITS_SETJMP_H 1"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF1381:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2315:
+	.string	"SERIALRX_SUMD"
+.LASF2402:
+	.string	"color"
+.LASF1213:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"SERIALRX_SUMH"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1928:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1289:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2299:
+	.string	"ARMING_DISABLED_LOAD"
+.LASF2562:
+	.string	"m25p16_init"
+.LASF1628:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2252:
+	.string	"BOXBARO"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1760:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1605:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1538:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF903:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1888:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF2521:
+	.string	"servoConfig_System"
+.LASF1593:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2028:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1958:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1824:
+	.string	"VIDEO_BUFFER_CHARS_PAL 480"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2531:
+	.string	"telemetryInit"
+.LASF1812:
+	.string	"ERLTCyclesForOneBit 25"
+.LASF2063:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF2065:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF924:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1004:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2481:
+	.string	"PID_ROLL"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1065:
+	.string	"OPTSTRING 0x08"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2211:
+	.string	"systemConfig_System"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1151:
+	.string	"STR_HELPER(x) #x"
+.LASF2540:
+	.string	"servosFilterInit"
+.LASF1850:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1333:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1709:
+	.string	"CLOCK_TAI 11"
+.LASF2180:
+	.string	"FEATURE_SERVO_TILT"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2578:
+	.string	"serialConfig"
+.LASF1872:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1009:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2118:
+	.string	"OWNER_SPI_SCK"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF906:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF398:
+	.string	"true 1"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2422:
+	.string	"TASK_COMPASS"
+.LASF1343:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1688:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1100:
+	.string	"NVIC_PRIO_SERIALUART7_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1122:
+	.string	"DMA_MOD_OFFSET 1"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1070:
+	.string	"SET_PRINTLABEL(p) { (p)->flags |= PRINT_LABEL; }"
+.LASF2500:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1382:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1699:
+	.string	"CLOCK_REALTIME 0"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2320:
+	.string	"SERIALRX_JETIEXBUS"
+.LASF1966:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF2417:
+	.string	"TASK_DISPATCH"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1732:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF960:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2369:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2506:
+	.string	"INPUT_RC_YAW"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1899:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1460:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF2514:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF956:
+	.string	"__need___va_list"
+.LASF378:
+	.string	"__linux 1"
+.LASF1488:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1424:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2354:
+	.string	"BEEPER_RX_LOST"
+.LASF1310:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2239:
+	.string	"crash_recovery_rate"
+.LASF2378:
+	.string	"SERIAL_PORT_UART4"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2379:
+	.string	"SERIAL_PORT_UART5"
+.LASF2048:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF1450:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2471:
+	.string	"yaw_motors_reversed"
+.LASF1125:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f,i,r) {.dma = d, .ref = c, .irqHandlerCallback = NULL, .flagsShift = f, .irqN = i, .rcc = r, .userParam = 0, .owner = 0, .resourceIndex = 0 }"
+.LASF1331:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1979:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1726:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF2467:
+	.string	"MIXER_QUADX_1234"
+.LASF1735:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1114:
+	.string	"NVIC_PRIO_MAX7456_DMA NVIC_BUILD_PRIORITY(3, 0)"
+.LASF1447:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2387:
+	.string	"serialPortConfig_s"
+.LASF2394:
+	.string	"serialPortConfig_t"
+.LASF1253:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1519:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF1734:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1285:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1097:
+	.string	"NVIC_PRIO_SERIALUART6_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF2035:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF2024:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1060:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF986:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1670:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2461:
+	.string	"MIXER_DUALCOPTER"
+.LASF2269:
+	.string	"BOXTELEMETRY"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2053:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1848:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__flexarr []"
+.LASF2061:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1276:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1022:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1158:
+	.string	"PP_IIF_1(t,f) t"
+.LASF922:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1165:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2438:
+	.string	"pitchDegrees"
+.LASF1951:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF2323:
+	.string	"SERIALRX_TARGET_CUSTOM"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1024:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1258:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1033:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF1435:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2084:
+	.string	"double"
+.LASF1211:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1620:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1599:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2492:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF1619:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1161:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1265:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2303:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF2121:
+	.string	"OWNER_I2C_SCL"
+.LASF2119:
+	.string	"OWNER_SPI_MISO"
+.LASF1222:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2143:
+	.string	"OWNER_COMPASS_CS"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF2021:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF1346:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1671:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF972:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2188:
+	.string	"FEATURE_RX_MSP"
+.LASF2419:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF2217:
+	.string	"dterm_notch_hz"
+.LASF2579:
+	.string	"rxConfigMutable"
+.LASF1102:
+	.string	"NVIC_PRIO_SERIALUART7 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2344:
+	.string	"rcInterpolationInterval"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1764:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2182:
+	.string	"FEATURE_GPS"
+.LASF2219:
+	.string	"itermWindupPointPercent"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1856:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1072:
+	.string	"IS_DYNAMIC(p) ((p)->flags & DYNAMIC)"
+.LASF1049:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2286:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2076:
+	.string	"__int32_t"
+.LASF2580:
+	.string	"rxConfig"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2122:
+	.string	"OWNER_I2C_SDA"
+.LASF1901:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2077:
+	.string	"__uint32_t"
+.LASF2321:
+	.string	"SERIALRX_CRSF"
+.LASF2441:
+	.string	"boardAlignment_System"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2554:
+	.string	"featureClear"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF1625:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1448:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1777:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2190:
+	.string	"FEATURE_LED_STRIP"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF2423:
+	.string	"TASK_BARO"
+.LASF952:
+	.string	"Q12 (1 << 12)"
+.LASF1989:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF1871:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF1990:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF1057:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF734:
+	.string	"USE_CLI "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1621:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1638:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1491:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1252:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1189:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1943:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF1528:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2532:
+	.string	"navigationInit"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF916:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF2386:
+	.string	"serialPortIdentifier_e"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF2019:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2310:
+	.string	"FIXED_WING"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF2407:
+	.string	"colors"
+.LASF2207:
+	.string	"task_statistics"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1373:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1259:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2390:
+	.string	"msp_baudrateIndex"
+.LASF1672:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF1079:
+	.string	"NVIC_PRIO_MPU_INT_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2244:
+	.string	"SYSTEM_STATE_SENSORS_READY"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1875:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF1439:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1894:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF2541:
+	.string	"pidInit"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2424:
+	.string	"TASK_ALTITUDE"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF2008:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF1177:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1066:
+	.string	"IS_PRINTVALUE(p) ((p)->flags & PRINT_VALUE)"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1544:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1468:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2493:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF1414:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2067:
+	.string	"TRACE_END(event,arg) {}"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1884:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1529:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2513:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF2166:
+	.string	"useUnsyncedPwm"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2359:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1794:
+	.string	"TRANSPONDER_TOGGLES_ARCITIMER (TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER + TRANSPONDER_GAP_TOGGLES_ARCITIMER)"
+.LASF994:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2397:
+	.string	"serial_update_rate_hz"
+.LASF1277:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1551:
+	.string	"LED0_ON NOOP"
+.LASF1706:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF2395:
+	.string	"serialConfig_s"
+.LASF2138:
+	.string	"OWNER_RX_BIND"
+.LASF1023:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF810:
+	.string	"USE_UART6 "
+.LASF1433:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2141:
+	.string	"OWNER_TRANSPONDER"
+.LASF990:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2016:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF1624:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1657:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1778:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1279:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF1616:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1225:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2332:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF2231:
+	.string	"setpointRelaxRatio"
+.LASF2567:
+	.string	"initEEPROM"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1983:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF1405:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2470:
+	.string	"mixerMode"
+.LASF1682:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2279:
+	.string	"BOXFPVANGLEMIX"
+.LASF1683:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF1698:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF1902:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF1708:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2289:
+	.string	"deadband3d_high"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2154:
+	.string	"long long unsigned int"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1026:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF1630:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1786:
+	.string	"SONAR_GPIO GPIOB"
+.LASF1597:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2039:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1429:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2128:
+	.string	"OWNER_MPU_CS"
+.LASF2131:
+	.string	"OWNER_SPI_CS"
+.LASF1037:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1757:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF2561:
+	.string	"spektrumBind"
+.LASF1668:
+	.string	"__PDP_ENDIAN 3412"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1879:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1492:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF846:
+	.string	"USE_I2C"
+.LASF1550:
+	.string	"LED0_OFF NOOP"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF2364:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF797:
+	.string	"MAG "
+.LASF2355:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF2582:
+	.string	"flashConfig"
+.LASF1978:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF1430:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2469:
+	.string	"mixerConfig_s"
+.LASF2472:
+	.string	"mixerConfig_t"
+.LASF1889:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1511:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2224:
+	.string	"pidAtMinThrottle"
+.LASF1084:
+	.string	"NVIC_PRIO_SERIALUART1 NVIC_BUILD_PRIORITY(1, 1)"
+.LASF964:
+	.string	"_VA_LIST "
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF1669:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1746:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1912:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2459:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1195:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF973:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1995:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF1808:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ILAP 4500"
+.LASF1827:
+	.string	"RTC6705_BAND_COUNT 5"
+.LASF2451:
+	.string	"MIXER_HEX6X"
+.LASF947:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1167:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2486:
+	.string	"PID_POSR"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1357:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1376:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2429:
+	.string	"TASK_NONE"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1322:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF1030:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1149:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF2100:
+	.string	"OWNER_FREE"
+.LASF1116:
+	.string	"NVIC_BUILD_PRIORITY(base,sub) (((((base)<<(4-(7-(NVIC_PRIORITY_GROUPING>>8))))|((sub)&(0x0f>>(7-(NVIC_PRIORITY_GROUPING>>8)))))<<4)&0xf0)"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF1618:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2098:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF2214:
+	.string	"dterm_filter_type"
+.LASF1336:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1907:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2490:
+	.string	"PID_VEL"
+.LASF966:
+	.string	"_VA_LIST_T_H "
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1810:
+	.string	"TRANSPONDER_DATA_LENGTH_ERLT 1"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF2088:
+	.string	"RGB_RED"
+.LASF932:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2474:
+	.string	"motorConfig_s"
+.LASF2348:
+	.string	"rx_min_usec"
+.LASF2287:
+	.string	"flight3DConfig_s"
+.LASF2292:
+	.string	"flight3DConfig_t"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1194:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2101:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1300:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1767:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1572:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1533:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1250:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1834:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1601:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1334:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"DYNAMIC 0x04"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1598:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF907:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2516:
+	.string	"servoConfig_s"
+.LASF2520:
+	.string	"servoConfig_t"
+.LASF2006:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1719:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1918:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1282:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1980:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1228:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2556:
+	.string	"mixerInit"
+.LASF1641:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1830:
+	.string	"RTC6705_FREQ_MIN 5600"
+.LASF397:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1121:
+	.string	"DMA_MOD_VALUE 7"
+.LASF1579:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1234:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1570:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2237:
+	.string	"crash_time"
+.LASF1505:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1532:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2524:
+	.string	"pwmEnableMotors"
+.LASF1394:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF997:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1634:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1666:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1999:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1988:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF2007:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1516:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1853:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2155:
+	.string	"long long int"
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1119:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1135:
+	.string	"IOCFG_OUT_PP 0"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1898:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2186:
+	.string	"FEATURE_3D"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF2050:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF977:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2124:
+	.string	"OWNER_SDCARD_CS"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1642:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2096:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF909:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2022:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF951:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1643:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2325:
+	.string	"rcmap"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF2298:
+	.string	"ARMING_DISABLED_ANGLE"
+.LASF1622:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2036:
+	.string	"ALL_MOTORS 255"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2367:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1733:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2162:
+	.string	"motorDevConfig_s"
+.LASF2168:
+	.string	"motorDevConfig_t"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1181:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1645:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1514:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2243:
+	.string	"SYSTEM_STATE_CONFIG_LOADED"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1745:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1984:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1653:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2284:
+	.string	"BOXDSHOTREVERSE"
+.LASF2555:
+	.string	"servosInit"
+.LASF2549:
+	.string	"isMixerUsingServos"
+.LASF2210:
+	.string	"serialPinConfig_System"
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1238:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1101:
+	.string	"NVIC_PRIO_SERIALUART7_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF1038:
+	.string	"PG_ADC_CONFIG 510"
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2145:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1876:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2056:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1736:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2421:
+	.string	"TASK_GPS"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1756:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1917:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1271:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2140:
+	.string	"OWNER_LED_STRIP"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2313:
+	.string	"SERIALRX_SPEKTRUM2048"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2489:
+	.string	"PID_MAG"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1078:
+	.string	"NVIC_PRIO_TRANSPONDER_DMA NVIC_BUILD_PRIORITY(3, 0)"
+.LASF2491:
+	.string	"PID_ITEM_COUNT"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1545:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1762:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1929:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF1933:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1842:
+	.string	"LOOPTIME_SUSPEND_TIME 3"
+.LASF915:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1536:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1588:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1976:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF2435:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1444:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF981:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1345:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2233:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1826:
+	.string	"VIDEO_LINES_PAL 16"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF1687:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF2496:
+	.string	"pid8_s"
+.LASF1646:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1782:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1231:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1881:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2216:
+	.string	"yaw_lpf_hz"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1130:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF919:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2551:
+	.string	"motorDevInit"
+.LASF1915:
+	.string	"LON 1"
+.LASF1170:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2393:
+	.string	"telemetry_baudrateIndex"
+.LASF2484:
+	.string	"PID_ALT"
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1651:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2425:
+	.string	"TASK_TELEMETRY"
+.LASF1080:
+	.string	"NVIC_PRIO_MAG_INT_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF2127:
+	.string	"OWNER_BARO_CS"
+.LASF2357:
+	.string	"BEEPER_ARMING"
+.LASF2560:
+	.string	"delay"
+.LASF2504:
+	.string	"INPUT_RC_ROLL"
+.LASF2288:
+	.string	"deadband3d_low"
+.LASF1028:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1948:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF1163:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF935:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1972:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF2347:
+	.string	"airModeActivateThreshold"
+.LASF1606:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1957:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF2070:
+	.string	"unsigned int"
+.LASF2431:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF1031:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1547:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1540:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2055:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF1893:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1959:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1608:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2201:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1904:
+	.string	"SPEK_FRAME_SIZE 16"
+.LASF1655:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1478:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1956:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2261:
+	.string	"BOXPASSTHRU"
+.LASF1216:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1036:
+	.string	"PG_PWM_CONFIG 508"
+.LASF2557:
+	.string	"serialInit"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1415:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2106:
+	.string	"OWNER_ADC"
+.LASF2073:
+	.string	"short int"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1691:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1974:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF2515:
+	.string	"inputSource_e"
+.LASF1094:
+	.string	"NVIC_PRIO_SERIALUART5_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1131:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1819:
+	.string	"TRANSPONDER_PROVIDER_COUNT 3"
+.LASF1500:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2229:
+	.string	"itermThrottleThreshold"
+.LASF2258:
+	.string	"BOXCAMTRIG"
+.LASF2018:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF30:
+	.string	"_LP64 1"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF1463:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF980:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1744:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2193:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1143:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1214:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF2109:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF2523:
+	.string	"fcTasksInit"
+.LASF1361:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1518:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1027:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2043:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1591:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2129:
+	.string	"OWNER_OSD_CS"
+.LASF1896:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1109:
+	.string	"NVIC_PRIO_USB_WUP NVIC_BUILD_PRIORITY(1, 0)"
+.LASF2314:
+	.string	"SERIALRX_SBUS"
+.LASF2497:
+	.string	"pid8_t"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1384:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1274:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF1180:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF2247:
+	.string	"SYSTEM_STATE_READY"
+.LASF1128:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1520:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2212:
+	.string	"flashConfig_System"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2052:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2097:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2618:
+	.string	"color.h"
+.LASF2711:
+	.string	"exti.h"
+.LASF2599:
+	.string	"src/main/io"
+.LASF2709:
+	.string	"serial_softserial.h"
+.LASF2645:
+	.string	"gyro.h"
+.LASF2679:
+	.string	"time64.h"
+.LASF2702:
+	.string	"dma.h"
+.LASF2615:
+	.string	"stdint-intn.h"
+.LASF2633:
+	.string	"ledstrip.h"
+.LASF2755:
+	.string	"streambuf.h"
+.LASF2685:
+	.string	"strings.h"
+.LASF2656:
+	.string	"rcsplit.h"
+.LASF2592:
+	.string	"src/main/drivers/accgyro"
+.LASF2704:
+	.string	"utils.h"
+.LASF2710:
+	.string	"accgyro.h"
+.LASF2705:
+	.string	"io_def_generated.h"
+.LASF2669:
+	.string	"libc-header-start.h"
+.LASF2668:
+	.string	"stdint.h"
+.LASF2630:
+	.string	"runtime_config.h"
+.LASF2590:
+	.string	"src/main/common"
+.LASF2728:
+	.string	"pthreadtypes.h"
+.LASF2635:
+	.string	"scheduler.h"
+.LASF2667:
+	.string	"stdbool.h"
+.LASF2736:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2666:
+	.string	"stdc-predef.h"
+.LASF2730:
+	.string	"pthreadtypes-arch.h"
+.LASF2662:
+	.string	"io.h"
+.LASF2673:
+	.string	"timesize.h"
+.LASF2623:
+	.string	"pwm_output.h"
+.LASF2631:
+	.string	"rx.h"
+.LASF2654:
+	.string	"fc_msp.h"
+.LASF2612:
+	.string	"/usr/include"
+.LASF2719:
+	.string	"endian.h"
+.LASF2761:
+	.string	"fat_standard.h"
+.LASF2735:
+	.string	"__sigset_t.h"
+.LASF2697:
+	.string	"cms.h"
+.LASF2742:
+	.string	"adc.h"
+.LASF2651:
+	.string	"failsafe.h"
+.LASF2665:
+	.string	"fc_init.c"
+.LASF2619:
+	.string	"system.h"
+.LASF2627:
+	.string	"fc_init.h"
+.LASF2610:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2715:
+	.string	"pthread.h"
+.LASF2765:
+	.string	"vtx_control.h"
+.LASF2713:
+	.string	"bus_i2c.h"
+.LASF2749:
+	.string	"transponder_ir.h"
+.LASF2637:
+	.string	"boardalignment.h"
+.LASF2653:
+	.string	"msp_serial.h"
+.LASF2733:
+	.string	"struct_rwlock.h"
+.LASF2768:
+	.string	"filter.h"
+.LASF2753:
+	.string	"vcd.h"
+.LASF2606:
+	.string	"src/main/telemetry"
+.LASF2639:
+	.string	"servos.h"
+.LASF2688:
+	.string	"common_fc_post.h"
+.LASF2601:
+	.string	"src/main/rx"
+.LASF2644:
+	.string	"barometer.h"
+.LASF2659:
+	.string	"serial_uart.h"
+.LASF2660:
+	.string	"spektrum.h"
+.LASF2762:
+	.string	"osd.h"
+.LASF2724:
+	.string	"struct_tm.h"
+.LASF2763:
+	.string	"osd_slave.h"
+.LASF2658:
+	.string	"feature.h"
+.LASF2699:
+	.string	"cms_types.h"
+.LASF2732:
+	.string	"struct_mutex.h"
+.LASF2642:
+	.string	"battery.h"
+.LASF2629:
+	.string	"rc_controls.h"
+.LASF2687:
+	.string	"common_fc_pre.h"
+.LASF2725:
+	.string	"clockid_t.h"
+.LASF2621:
+	.string	"io_types.h"
+.LASF2754:
+	.string	"msp.h"
+.LASF2657:
+	.string	"initialisation.h"
+.LASF2587:
+	.string	"src/main/blackbox"
+.LASF2650:
+	.string	"gps.h"
+.LASF2772:
+	.string	"voltage_ids.h"
+.LASF2634:
+	.string	"target.h"
+.LASF2624:
+	.string	"flash.h"
+.LASF2605:
+	.string	"src/main/target"
+.LASF2774:
+	.string	"sonar.h"
+.LASF2727:
+	.string	"struct_itimerspec.h"
+.LASF2594:
+	.string	"src/main/drivers/compass"
+.LASF2703:
+	.string	"io_def.h"
+.LASF2714:
+	.string	"accgyro_mpu.h"
+.LASF2700:
+	.string	"nvic.h"
+.LASF2721:
+	.string	"struct_sched_param.h"
+.LASF2677:
+	.string	"stubs-64.h"
+.LASF2751:
+	.string	"vtx_rtc6705.h"
+.LASF2766:
+	.string	"vtx_smartaudio.h"
+.LASF2591:
+	.string	"src/main/config"
+.LASF2707:
+	.string	"sound_beeper.h"
+.LASF2752:
+	.string	"vtx_common.h"
+.LASF2640:
+	.string	"debug.h"
+.LASF2682:
+	.string	"stddef.h"
+.LASF2643:
+	.string	"timer.h"
+.LASF2607:
+	.string	"src/main"
+.LASF2632:
+	.string	"beeper.h"
+.LASF2636:
+	.string	"sensors.h"
+.LASF2626:
+	.string	"pid.h"
+.LASF2689:
+	.string	"blackbox_fielddefs.h"
+.LASF2597:
+	.string	"src/main/flight"
+.LASF2603:
+	.string	"src/main/sensors"
+.LASF2775:
+	.string	"trace.h"
+.LASF2678:
+	.string	"typesizes.h"
+.LASF2588:
+	.string	"src/main/build"
+.LASF2770:
+	.string	"current_ids.h"
+.LASF2737:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2649:
+	.string	"navigation.h"
+.LASF2708:
+	.string	"rcc_types.h"
+.LASF2646:
+	.string	"acceleration.h"
+.LASF2613:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2641:
+	.string	"fc_tasks.h"
+.LASF2771:
+	.string	"voltage.h"
+.LASF2726:
+	.string	"timer_t.h"
+.LASF2747:
+	.string	"sdcard.h"
+.LASF2722:
+	.string	"cpu-set.h"
+.LASF2655:
+	.string	"imu.h"
+.LASF2739:
+	.string	"compass.h"
+.LASF2746:
+	.string	"sonar_hcsr04.h"
+.LASF2748:
+	.string	"usb_io.h"
+.LASF2611:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2647:
+	.string	"blackbox.h"
+.LASF2676:
+	.string	"stubs.h"
+.LASF2595:
+	.string	"src/main/drivers"
+.LASF2596:
+	.string	"src/main/fc"
+.LASF2598:
+	.string	"src/main/io/asyncfatfs"
+.LASF2758:
+	.string	"gimbal.h"
+.LASF2764:
+	.string	"displayport_msp.h"
+.LASF2614:
+	.string	"types.h"
+.LASF2695:
+	.string	"config_eeprom.h"
+.LASF2692:
+	.string	"axis.h"
+.LASF2712:
+	.string	"bus.h"
+.LASF2744:
+	.string	"buttons.h"
+.LASF2760:
+	.string	"asyncfatfs.h"
+.LASF2696:
+	.string	"parameter_group_ids.h"
+.LASF2731:
+	.string	"atomic_wide_counter.h"
+.LASF2617:
+	.string	"time.h"
+.LASF2616:
+	.string	"stdint-uintn.h"
+.LASF2602:
+	.string	"src/main/scheduler"
+.LASF2773:
+	.string	"esc_sensor.h"
+.LASF2729:
+	.string	"thread-shared-types.h"
+.LASF2684:
+	.string	"__locale_t.h"
+.LASF2743:
+	.string	"bus_spi.h"
+.LASF2738:
+	.string	"pthread_stack_min.h"
+.LASF2720:
+	.string	"endianness.h"
+.LASF2759:
+	.string	"dashboard.h"
+.LASF2723:
+	.string	"clock_t.h"
+.LASF2701:
+	.string	"sensor.h"
+.LASF2604:
+	.string	"src/main/target/SITL"
+.LASF2600:
+	.string	"src/main/msp"
+.LASF2675:
+	.string	"long-double.h"
+.LASF2661:
+	.string	"flash_m25p16.h"
+.LASF2769:
+	.string	"current.h"
+.LASF2589:
+	.string	"src/main/cms"
+.LASF2745:
+	.string	"inverter.h"
+.LASF2609:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2638:
+	.string	"mixer.h"
+.LASF2681:
+	.string	"string.h"
+.LASF2691:
+	.string	"build_config.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2671:
+	.string	"features-time64.h"
+.LASF2670:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/fc/fc_init.c"
+.LASF2628:
+	.string	"rc_modes.h"
+.LASF2690:
+	.string	"parameter_group.h"
+.LASF2750:
+	.string	"max7456.h"
+.LASF2767:
+	.string	"vtx_tramp.h"
+.LASF2622:
+	.string	"serial.h"
+.LASF2693:
+	.string	"maths.h"
+.LASF2674:
+	.string	"cdefs.h"
+.LASF2718:
+	.string	"struct_timespec.h"
+.LASF2620:
+	.string	"resource.h"
+.LASF2663:
+	.string	"printf.h"
+.LASF2740:
+	.string	"pwm_esc_detect.h"
+.LASF2741:
+	.string	"rx_pwm.h"
+.LASF2706:
+	.string	"light_led.h"
+.LASF2683:
+	.string	"locale_t.h"
+.LASF2652:
+	.string	"cli.h"
+.LASF2756:
+	.string	"displayport_max7456.h"
+.LASF2664:
+	.string	"flashfs.h"
+.LASF2593:
+	.string	"src/main/drivers/barometer"
+.LASF2717:
+	.string	"time_t.h"
+.LASF2648:
+	.string	"telemetry.h"
+.LASF2694:
+	.string	"stdarg.h"
+.LASF2680:
+	.string	"wchar.h"
+.LASF2734:
+	.string	"setjmp.h"
+.LASF2757:
+	.string	"motors.h"
+.LASF2672:
+	.string	"wordsize.h"
+.LASF2716:
+	.string	"sched.h"
+.LASF2608:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2698:
+	.string	"display.h"
+.LASF2625:
+	.string	"config.h"
+.LASF2686:
+	.string	"platform.h"
+	.text
+	.section	.gnu.lto_.profile.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \222\335\002"
+	.string	"\344\003\206"
+	.string	"\t"
+	.string	"\233\364\343\336\006"
+	.string	"\001\347\304\205\206\004&\002"
+	.string	"\001\002\002"
+	.string	"\002\003\002\004\002\005\002\004\002\006\002"
+	.string	"\002\005\007\002\007\352\263\360\321\b\020\240\342\234\212\n\021\022\023\024\025\240\342\234\212\n"
+	.string	"\f"
+	.ascii	"@\004\334\201\306R\004\345\310\316${\324\035@\300\242\312\256"
+	.ascii	"\344;W\326\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \204]\001"
+	.string	"\230x"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\n"
+	.string	"-\034@>\220\f\264R\024\003\260"
+	.ascii	"\324\013J`9\0067\320\006"
+	.text
+	.section	.gnu.lto_.inline.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"M\005"
+	.string	"\322\304\020\033\240'\351\377 \266\276\212[\021\275\3310v\377\002\006\252\252\276\267\346\264\322\266\224)\177\256\347\276~\244h\3414\375\334Q4-\201\026P:$}\n*A0 x\363k\374\300\314\020\00153\253\357L\001, @\002\242\240,\017\017\bZr\260@\302|\020\177`\013C\205\200\322\222\266\201a\032"
+	.ascii	"\227\020\365B\013\006\326\242\210\204\331`\020\302\016*\001\355"
+	.ascii	"8\3717\204\023\bA !1\250\205\032\030 \303\201\001\3622\2346\210"
+	.ascii	"ql\032q\" \347\001\344[\025\300\002L7\334\302\215\2366\331\275"
+	.ascii	"\221\303\233\327\356\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375`]\001\005\b"
+	.string	"\022\212 *pI\223\016\374\037\373\273\002\303\2004@\001\200\234\270S\345\257\036\003\251\242\242\242^U\271\243H\\\2046\334\354k`\277%2\311$I>\216ijT1v\263\326\002W\216\334f\2163\327o\267\3132Uk\022\003\004\005G2"
+	.ascii	"\034a\300\035x\200\320\033V\2502\332\204+\362\n\327\316V\224"
+	.ascii	"\027\026!\376\341\316gQ\365\t\004\335\254\235{\347:W\223\252"
+	.ascii	"\222*R\021\037K#l.\315\211k\311\331\200@\250!](')(\025\016\260"
+	.ascii	"\002\021;\361\021\300D\253\034e\303~\006\331H{n\\|\267\312u\275"
+	.ascii	"b\277\021\263;\352#yg\371\333n97\322\337\315\f\274\024\324c\363"
+	.ascii	"\243\0279(\244K\346\233\341\253\031\025\320\016x\005\257\247"
+	.ascii	"\361\274\305?\311\013h\327)\250hK_Q\r\020\254\266\311\222#8\200"
+	.ascii	"\021$\347\205\0078~\276\024\312\371(\f\253e\223\177P\001\375"
+	.ascii	"K7\232O\017"
+	.text
+	.section	.gnu.lto_.pureconst.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.141.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \303M\005"
+	.string	"\202\t$-pU\323\001"
+	.string	"\240\371\272\345\370\275\202\253\027s\005\226\252\3021b\0025\237\022\032R.D\363\365\252\036 @\314c\322\002V\f\373\367N)\236\022FU\224cN:'\255\250GD\3475Q\311`K\002\271\024\263\254K#o/\273\003EV\214\330\030`{Z\224\031\373\202\225\235\035\033`\b\260"
+	.string	"\355^\006\004\026\034|:\266\0379\263C\3676\373\217c\371\302\335U\251y\366\230\371\367\274\260q\332#\201\261\273\216\033\207\271\345m'l+lW\001\b"
+	.string	"3\003\366\231\341\300\367\273\206\247\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_init.142.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375`\330\021\035P"
+	.string	"*|\354\033@0bR\007W>J\326\257\304\206\001\377\n\370\227#\371V`\303\250\211|i\030\256\016\314\252\367\256\273\003\363J\267\r\367D\"\021\017"
+	.string	""
+	.ascii	"\250\002\211\352(\213/T\273\273\377\217mv\357&R\246\024\232\001"
+	.ascii	"\234\001\264\001G\355\314\243\366&\245\366\345\253\235\351\325"
+	.ascii	"\276t\324\256\364jOz\265#\035\265\037!\265\033!\265\027\275\332"
+	.ascii	"\211^\355\312\243\366dR;\362\325~Dj\177\217\332\335W{{\324n|"
+	.ascii	"\265\357W"
+	.string	"\273~\265\377\215\267\023\250\206F\305\317\026\264\312d\213\206\344\300\366\215\226\317\373\247{\355\376Py$\370[\375\365\\\t\245\347\314\343\305\237\347}O`Vy\252a\021+\2078~\373d\354\352\253\023\246\307[=jN\r\355\307[\375E l\220\267\372\336\273\233s!ou\025m\002\325\346\334\257s%\224\237\204\237\3731\361\323=\237\276\254\262T\003`\340\034V\226\255\016\276\365\005\307o\221~\351~\253\177\311\375\326cw\303\267V\221\037\217p\354\016+\313\262\324\246\342\3117Z\337\217t\374MK\246%\245$\244#\243\"\"e\022y|\335\326\270u\354\177\340\254\016T\020\315\324\353\233\262\3742\213\233fj\373\2456,Z\351\312']\261\242\221\214m\037>\274\237\245U\214\030\314\332\342^OM\037MI\262\366Fz\337`\021;\227\245&Y\373\242\264'\352\"M\233\245hZy\366\311\237\245gO4\322"
+	.string	"5\211\223?\032\247\302\260h?K\235\030\211\b\215\351\371\2727\320E\332D\277f\357\216)\247b\272}= \350\253c'\210fZ\366F\343\222,K49\00536"
+	.ascii	"\264'(Lo\243i\230\361I\226\345\257{]d\n"
+	.string	"\325\372\365 \313\262\353\3504\311;\363\335\377\213\273\253qG*\021:\376X\211\373n\367\270,6\013\333^\356\356wC\030;d@\273\325\335*\306X\247\364\233yA\361\232\016ph\007*\027\350\023\343\263\264xm\315\205\022Gi\021\007H9\245\332\275\222\032\261@G\n\021\231jq\225)\235\037h\327\363\261\025\327=\306\022\273\201\371)\316z\376\265b\333\003N\232\275B\351\277{\303Xn/Q\373\240ds\262\374\365\321B\217\271\304^\364G\217\211pr\026\220\221\031\325\314+\025\242\201cd\f\342\327\375#\361;\234\371\274{\360\322\212\257\037\326\214\321\237\320\r[\277\3447]\301\207\363}\334\260\355k\"\313^\257\346\255\216\272\377\036\177\265c\025Y*[e\006\337\266\372\320\333\347\301\363s\f\027\307\305r\261\234\373m\273\233D~|3\223\312\006mo\271\306]eG\b\246\t\271\001}\374\270\316u\377"
+	.ascii	"B\177\324\270\247\330\300\266\227/\337\344\354U\302\024\365\317"
+	.ascii	"Bh\276\263MG\204b\364\372\345#^\016\211\243,\203U\360\377\373"
+	.ascii	"8&\374\333\276u\024*T\270\337\356\3554H\247\371\312\364\356\373"
+	.ascii	"\350\365\233\356o\275\177l\tT/\272\377\336\277a\341\337\346-"
+	.ascii	"^\350\217~\353\377\302\375\3667\323`\223/\275\350o\026\bcn\226"
+	.ascii	"!f\306+\331\202\275\322PJBu\024h6\322\356WY\372\243\376\004\335"
+	.ascii	"^\316\264(g\257\262.\344n\205\352]u\377\250;\2640\276\245\270"
+	.ascii	";7d\370\274w\247\002O\367\336|\265\023x\265\017x\265\013x\265"
+	.ascii	"\007x\265\003\b"
+	.string	"O\364\227w2{ys\323\250]gpZ\007\266*&\001\312\224\314\027\250\2377O\367\236\230<zF\016\376\363\364\336\370\266X(;k\300A3S\027\375Mwi3iY\322\200\210^\264C\377\303P\242\300U\247:s\016\255\337\373\334\177\030\306\002\273\205\001\322!\332UW\322\242\264)\260A\025\267d\257Y\372\3554\025\030\256\325S\203buUO\201\275\300o0\034\f\007\307\301r\212\322,\240d\"\365\313\374/i\303\222\341A\\*J\263\327$M5~\323E\332Iz\ri\371\347&{\245\316\341{%\225v\235\006\327\241\301d\354\340;<XO\356\310\355pHrW\221n{tG=}7\276\315]`\0279\212\261\006n\243?z\264\247\330\300\300{\002\276\270\320E\333h\2736\203\373\"h&p\241\303\177\260\034\261\355\345\005\266\321~\242]\264\302\016\f\250?J\264\277\217M\200\032\214'\255"
+	.string	"rW\237\256"
+	.ascii	"&'\264\026{wx\017,H4\247\f\371v'{\334U\177\267:Cw\303\016R\307"
+	.ascii	"\246\315\260\233\273\210\361I\270\312]e7\b\246\t\rj$$\232}\334"
+	.ascii	"a?\372\b\\\310\254\362\255\021\345n\016&\347("
+	.string	"in\017_\272\320\273\341\305\037\035\205\263\n\372\350!\232\b|\b#\302\211p\242\373\355\206\275\374Stw\025\360\223OrrO\261\375\025\312\260\237\3567\260}9<H\203\301\331\005}\364\227\206\302\205`Ex\021^t\277\315\260\217\260^W\016\032\031\026\217\0357\222\310\0372\364\212q\221#1\031\231\373\355q\027\260B\307\2743[\bn#*\313\211\245\265e%e\205\305\334r2\335F\024\017\255+\035ZY\316\034T5\270\250\266\252\244\272\270\266\272\264\256\272\022\270\215\250\034TN\256\253.\251.\256+\037N\256\032\004\334F\024\020.) \\K\316w\254\n\025$L\260P5\025\265t\325\225\243G\212\253\0345\234H\267\212\342\341\324r\322\260\302\222\262\302\222\322rR\351\220\262\342\352\222\212\002\340[;\256\270\244xlmqI)\255_\277\245\370\321\3600\360kC\235\200.\224\277\351\016\330\0044\341"
+	.string	"\255;1\354\3406q\356\334\340i\201\231\021\331\260W=\300\235\347\370M7\300\026\020\310\342\231&"
+	.string	"\0161k\262\240t\266|^\233'\0350>3\355\340\335\237|\317>(\302\270\271iW\227\350-u\177\312y\322!|[\356\252\267O\302\005\240\377\264\037\200\315\264r\243\213\035w/\020{\225\342y\346\251;\242\237\214~\363\364\243\227\016\357\204\025\272\321{O\301\301\247\237\247\237g\341\363O\235\314\205j\375$AbX\2637\3043u2\323\241\340t\211yd\236\201\003\224\275*=\021\261\340<\023\363\370\360%5}\323\236bs\337d\354\3659\b\373\314\3523fl\331\353\227\3762\332\f\354\245\227{\212wc\312h\273\247\342s\021\366\362\202\302a\372\243g\312"
+	.string	"\215!\363I\206\360\004\225%\"\336\031\213C\244\312\257HV\325\233#Us3\020\275\334\356\360\024V\342:N\213q\302e\260\231\231\373\355r#\241f8\250\231\313\\e^\233e\244]\365\227\320\310\2717a\221\203wJ:m\020\200T\247\375y\332x\344\334\237\367O_\357\264\235\373\305\324\234\326\026\253\002\201\222\250Q<I\225\"#\"\"\"\222$I\032\003a\005\304(\305\234t\036\021"
+	.string	"1c\214YM\n\222\016\b\001\001\206\210\304\007J\372\033)yI\0048JF"
+	.string	"\252\333\365\212\261N\334\352@n\270\005\020\217\3121IN5Cqa\246J_\306\314\376Z\021\322\365\354"
+	.ascii	"\205T\314\004\273\032\026p\365d\252\244yaR\234k\230~,\21252P"
+	.ascii	"\352\264\343\234\260a!6GP\353\220'\241\330D\212s4\236\367\325"
+	.ascii	"\320u_\2200d!u1\375n\213rJ\371\227\026\277<\330\311\021\006C"
+	.ascii	"\364C\322;d\025X\277t\246\371\f\3732\212\337\02004H_\273\205"
+	.ascii	"\275`{Ln\034\016\322q\213\363\310\257\215\001\006\213\334\301"
+	.string	"\021p\331\303\214\316\206@\226O\226%\242\257\bx\303L4\340]\2060=C\032\304\360\324\"-x\226\201dk\034\241\006m0\330\332\f\"\202L\305(/\257\234+\211\370\340\246q\nE\303\234\332\331ab>\226\265\311o\004\225\2030$\374;\260~\323\277\2155O\250?=C1VJrl\001\304\273\354\240\006\216}\206\336T\304\306\305\001~qe\r\024\021Dd\322g\373\n\214\017\231\265\353\312\210\373V\013X\2508\250r\362=\372 \252w\324\303\311\351D;\252R\310iH\006\275\001\003m\321d\321s\376\242'\250\3332\274\fDG!\327[\0247\303po\002\f\007\n\245@\300\245\327\322\3173f\013L\002\373\253EB \270(A\360\020&8\331\261\216\335\342\252\334\307!\212j]\335z\204\336\230h\203\313\271\3546\205\200\345\031|\216|\335\027M\303\3720]3\t/\037'"
+	.string	"\210\271s\262w0\331w\245\344\030\223u\212F4\335\263\177<L\027\314\303C8:\\\270\bE8\243+\333\250\236C**_Uq\320K\301\236\221\373}\222\275\204\r\022+\354\345\204b&i\035\310\364*\266\214sn5\305\343\026\027\3714\320\037\205\r \377RkeH\200\321\007\267Mz\242\301\2718\355;r\006&\234\216\304:\005\003VN\037\2305L\033\027\207i\220\327\035N\342\334\002"
+	.ascii	"\307\246O\245V$\023\247p\033b\n\202\327\213\327K\211\204F\307"
+	.ascii	"\224\2166 b\247&Yu\375\346\031O\t\005\212\370\304\034!T\353b"
+	.ascii	"\016\264\241\301cP1\360\353\215o.6\330t\227\316beju\026\021U"
+	.ascii	"\004\316$\023\362\344b\020\220)b\b\251\357\227\342.\016\223\251"
+	.ascii	"\024_H\267\365\007\216\242c_\221m\201B\317\314}/\302o\263\244"
+	.ascii	"D\007n'\017\241X\001\220\234S\231\177[\322\027@\324\357H\311"
+	.ascii	"\326\003\341\013\347`{\"\345\337\026\034\177\205\002\245\023"
+	.ascii	"!\245\356\214\343\333(\326\3147o_\375U\305\030\021\034\316\231"
+	.ascii	"|\2746\262F\313\332d\222fRg\304\354\3047\367\367\316\3073>+\377"
+	.ascii	"\312vt\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375`\225\007\225\024"
+	.string	"6\344{F\240\224J\032\003\300\3540j\365\256h$\205\363\366\304\333\020w\016\335^05\216\205i\314\215\233\256!\3011Ve\n\237*\364mx\256\302\277R\360OA\377\277jUU+\"\"\242\022\214`D\023\262uF\310\232vp"
+	.string	"i"
+	.string	"h"
+	.string	"lI{\333o7\202\264\0379\332\337\214\366\027E;\034\321\03670\b\224\322\227eh\227[H\006I8 \031\367#\345|\366\352\271\004\317n1/\221Y\311\316?f\266\033p\022\337u\006F\2423\023\336t5\2139\273\370\200\363\234\213\224\362\031\327\373\204\313\217\016l\355fO\321\342\025d\223r\245l\022\034"
+	.ascii	"\020\b\004\332\354(Z\244\2241_\001\263\310\260\267\300\260\307"
+	.ascii	"\270\260\317\260\260\323\250\260\203Q\330kL\330mH\330oD\330q"
+	.ascii	"@\330s<\330\303\034\354b\r\366\220\301\256c\301>\246\265\357"
+	.ascii	"P\260\363H\260\367@\260\3738\260\313\310\332\201`\355dW{\020"
+	.ascii	"\253\275\254j\027B\265\017\231\332\315\244\366\263\250\235\b"
+	.ascii	"\324\216\366\264\303p\332\323\232v5\246}mi/\242\264\007\"\302"
+	.ascii	"g\310\254\230pZ\271\304\247\225kB\255!\304\250uKj\335\232ZA\214"
+	.ascii	"\007@\203\202\205j\365\315\336X\265\366B\253\365\346j\345\215"
+	.ascii	"\274\020k\245\t\263\326\002\343o%0\016\363\344\212(\341V\001"
+	.ascii	"\242\317*\023\332\25403n}\021\345\326\2279\267.\212\353\223n"
+	.ascii	"\325\222u\253\207]E\207=\310a\377\332\260\257\320\260\001\362"
+	.ascii	"*!\315\310[\247\022\326\214O\to\306\336\272\224\020g\314Y\277"
+	.ascii	"\013u\326\243L\237\270\263\3766y\326\335f\317z[8\376\254\263"
+	.ascii	"\205@\342j3H\024ZO\033Z?\233Db\321\272\3314\022\217\326\313&"
+	.ascii	"\322\372X\270\330LZ\017\023W'lwv\277\265KTZ\273\346\322J\"dZ"
+	.ascii	"G\214Mk\200\206\250!(B\331\362B\255\346`\203H\223\306\021p\\"
+	.ascii	"\207\f\211\223x\344\003\n^\b\215.\327)\036_\200\216\374\354*"
+	.ascii	"\242\366\234\227}\330x=y\002;\026e\253\021\343\375\222\363\350"
+	.ascii	"mcE\026;\256\202 \335\357\373@U\n\006\227\274\017p\232\342\037"
+	.ascii	"\324\177\335\235\336}\215\254\335\267^\236XY-\236\212\033\255"
+	.ascii	"@\021#\266]\240\002\025\224\240\004%\250@\005%(A\t*PA\tJP\256"
+	.ascii	"\376s\310{\233[\315X\257\256\203\262\016i\344\325Y\260:f\313"
+	.ascii	"\303\3036c\232\375\367#5\007\277\n"
+	.text
+	.section	.gnu.lto_.refs.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375 \177=\003"
+	.ascii	"2\307\026!\220+\303\030\247ADD!\332\223\311\311\231}UU\325\021"
+	.ascii	"\206\206\277\344\326\262h[#\001\033\3322\005\257Z\273\316z\032"
+	.ascii	"j\227\241\336Ez\226\312a\035\305\360\020\350SX{\326\256\3269"
+	.ascii	"\204\365fZc\246%\203#\323\020\351\207`uDk#z\021X\005\340\304"
+	.ascii	"Z\304:\306'\001\003\004\001\\p\300\024\231Q"
+	.text
+	.section	.gnu.lto_.decls.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"(\265/\375`\247I%C\001J\037BxU \fQ:\035\034\364"
+	.ascii	"\317\005\367?\247_\206y\030\373\206\031\325\371\305\203\003\232"
+	.ascii	"\025\307C\032\265\273\343\341i\306\2572\017\301\213\335\255&"
+	.ascii	"\"Q0v\226\346\336R\216;"
+	.string	"\276\242W>\254M\343\203~\354&\220,\342\315\377\3048\243\222H=\261\242b\311\272\267\224R\246\314\006`\007\346\007R\374k^\360\247\001\303\237\246\n\177\2327\3764f\374i\202\360\247i\362\247a\301\177&\312\177&\n\377\2313\3763A\370\317T\361\237y\342\007\300;\352\317\030\361\347\\\370\363*\3749\033\177\016\226\265\324\314-\261{\221\367\363\035<g\371=\326\264\321F1\244\250\345\375\274\006\377g\306\243\"\3341\004)\357\3770\305\310\2219\271\273\\%\333e+\030\232\251\344\27236*\231.\367@\300\250\336\237*\022.Wh\320\354\227\331\302_F\216\277\f\224\277L\031\177\031'\377\317R\342^t=\272\274\037\037\001\003+\022\026%C\311)d\270\374\004Cs\\v\373\374\226\235T1rt\204-.\037!3\022\315qY,\267a:\254\336\235<\030\342\354\036l\300\314\335\245\0057^\303<j"
+	.ascii	"\360\216\3722U\274I\017or6\325#\357\227i\342\217\217\220\355"
+	.ascii	"`\222\331\262Z\206\346%\030\232\327r\222\317a\371\371\031\255"
+	.ascii	",\313\t\264\226\315\360\332\035\026P^\313gY\211~:G\310\301#\332"
+	.ascii	"{_\313H\360\035\246\303\352FL\017\332\242^\326\376z\177z\350"
+	.ascii	"\361\340\301\203\207\033\347\322\036Zpg%\377y\fG\361\230\017"
+	.ascii	"\364\216T\023\346\rI,\357\214\006\3649-\235\021\345\006\217\274"
+	.ascii	"k\256\360W\341\370\253J\370\253_\374U,\376\352\f\036\304;\352"
+	.ascii	"\253P\0343a\036\265\002\336Q?\035\303?\335\343\237V\341\237F"
+	.ascii	"\371\342\300\221\332\224\030\311\373?\023\361\302\021f\211*\357"
+	.ascii	"\377\317C\262\020\f\315^\271\013?{\177\366\336\037\304V\346\332"
+	.ascii	"\320\265\226\307\364\347\225\203\3405L\027\325\231\\8\350z\346"
+	.ascii	"1\375\365\376\354\361\340A\246\b^\327\016u\177"
+	.string	"\312\305?\305\342\231+\347\037\031\310g\256\354\374\r@|\020)s\355\336\2150\316p\203q\206\364M\313\210L\335\237V\361O_\360\377\354\343\346\206\225\025W\362\036\353S\002\372\254#\033\345\025Z\214\211'!\0133\207\257\334\325\310-\376\201P\370\313\335\016\020\317e\301kw3\376\363\214l\225\2512\217|#c\345\252\\#G\345\034Y+_e\0309F\306\221\245\362T\226\221\263r\217l#7\363\216\f\225i`h\326\221\233>;\345\247\337\217\375\272\240\020\305c|.\3060\230\034IU\254LE\265l\271\213\302sX\356h\340\275\023\276\3409<\033Q\3001ha\002\235\231\305?PN\302k`\362\364\226>\374\003e\035\331Ef\322O\347\f\013\253\274h\357\035\317M\301w7F9\035I\005U4\353\300\\\360\235~\256q\026f/\242\201x\214\235\230\277\177<\206\277\334\235`\344\037(+\351U\331"
+	.string	"D\326\201\275\340\265\033\346\263/]\240i\245\317\253\367\247\007\017i\224(W\250p\2603\035\346Q\013\240\307\377\363\322g\246\265\017\364\0132@\002_\354\345\235_"
+	.string	"}^\262\200\311\033[\3362W\370\357'\374\367\031\3773\314\243\376\006\343\277\265\370\303a\0365\037e$\f\355\220U|f\342#?\203\364\354e\275?qf\252\360I\235\345\375\033\007\177\334A\305\t\f\f\f\304\035\324\3374\370\306;\352o#\376z\n\027\263cH\311\341#\357\327P\370\353'\177\355\203\277v\342\257U\360\016`\370\347<\356\001\036\377<\307\177\315\t\177:$\374\243>\370\377a\036\365s\f\376\371\210?\346\343\217\343\370c(?"
+	.string	"\346Qq\035\266\303P\016\230\312c:\314\366\251\321\263?{\177\342d\036b\320\310\362~l\306\037sPu` \346\240>&\302\363\216\372\217\3450\234M\335S\235\223\274\377\203\333\022Z\032\r'[\023\274v\303\314\351Gv3\234\275?\037\304?\320\377\006 0\034n\303k\372\351\224Ib\025\025\355\375\371\370\310?\020\034\026\303g\372\351\354\335\352\006\2071*iQ\376z\357\377\217\241\340\024p\024\034\207\245`(\206\303o\217\235\340'\217\237\036<x\360\340\241G\273\275@\001Ipc,\314\243\362\340\035\365\361\n\376&\370\023\371o\200\347`\036\025+\301K0\264\002\254\366\304\261\031CdL\230\274\377\002<\030\364\230\311S`\324A\274"
+	.string	"\370\343\nT\034\210+P?\310{\310\036\237\375\3430\374\304I>\320;R\357\375\302\r\235\020!U\362\306f\030\311\343$\270\3547"
+	.string	"\361\2329\326\215\364\336q\022\016\232\275\033\341$8\200\275\033\341`\234\001\343\f\373\313j+M\335/\303\361\030\320c\262\035\225)\352\331\317z\35784\320h\221\245\274s\360\216\372\231\343$\314\243\352\340\035\025\003\346Q\3771\330?.\202\215T\240\223\224\232\375\254\367\247\016\3163\206\013\034y\377\023\363\250\034\357\250\"0BBA\223\360\237Y\350\0138\351\021\377y\306?\026\323\026\320\025\250\272\362\361\217\261h\021\232\002\377\371G\327\021=\201\377<\201l\246%\360\237\321\376qT\013\375g\350?\346\323\021x\362\237_\217\240E\370\317r\377\032\002:\204\377\234B\207\310\362\257\037\240A\370\317y\372\203>\355\200\177,\342\037g"
+	.string	"\263\3779\002\272\001\377\230\003\377:\350?W F3\340\037\203\370\317!\350\005\374\353\374\217\337\264\002\376\365\314\177\366\321\t\360 \217\375\343-\032\001\377\272B\007\377\330\302?.\373\317@\231\352\037\247\032\304\177\356\037\367\2579\370\317\r\320\037\376_Mop\201\202\f\002\350\037\023\371\317_\376\277\204\177\f\364\377\002\370\327\007\370\327\006\370\327\036\3765\207\177\215\301\377Sy\252\377\r\202\307\377\373\370\257/\370\327\025\374k\n\3765"
+	.string	"\376\365\205\177\315\363\257w\376u\360_\323\374k\375\237\307\374g/\377\331\357?s\371\317z\377Y\313\177\266\373\317S\376\363\334\177\206\373\317l\377Y\355?\247\375g$\377\231\354?\207\375\347!\377\271\353?\003\371\317?\376\363\326\177\306\372\317W\377\031\307\177\256\372\317\315\377l\343?\323\370\317O\377\231\351?\277\370\317J\3779\351?#\375g\243\377\334\3773\t\376\263\b\376s\b\376\363\211\377\\\364\237\213\377\271\003\377\231\204\377<\342?\213\370\317\023\370\317B\377\031\002\377\031\204\377\354\200\377\274\200\377\354\301\177\356\340?\003\375\347\237\177\374\366\2373\374g\f\377\331\202\377L\301\177\016\300\177\356\371\317\370\037\363\375\343\350?\336\362\217\263\374\343\364\037\233\375\343\261\177\374\365\217\211\376q\007\376q\002\376\261\007\377\330"
+	.string	"\377/\345\377\215\374\377\006\376?\312\377\353\300\300\300\300\377\375\377\025\006\360\317\0012y\377\004m\374'"
+	.ascii	"\343?\301\026\317`\027\364\273I\223\314\265\231\317\276d!\254"
+	.ascii	"\251\016\020h\215))\357\237\240\006\307\340I\320o5\f\335j{m#"
+	.ascii	"={\223\tN\\n7ho^\232\344\275\327&p\301+\300\005\375f\302\004"
+	.ascii	"\257}\020\325d\356a 2\246\367\225Vu\361B\244\216\337\370\b\372"
+	.ascii	"\255D\211\376\372 j\254;\341X)A\301\351\246I\354\211T\336\317"
+	.ascii	"\263\306u\304\202~'\201\356$\033\355\003\254\246\221\325\006"
+	.ascii	"\"\315@\300?\0361\270\216\362\336gg]\236,\331\312"
+	.ascii	"\373y\302\370\363d\361\013\240\202~\223a\350&\333f\037D5\215"
+	.ascii	"\214<\030\322\363\230\202Q'6\226\354\262(Up\354\310\373yj\360"
+	.ascii	"\347I\342\032\304\202~\213m1\274F\243\242\316\212\221\277\336"
+	.ascii	"\341\b\020\374\"\366\345J\336o\201\n\257\221\n\372\r\366\030"
+	.ascii	"\272\301v\330f\216uf\215\035\021\024\234dnD\201\351\345\275\217"
+	.ascii	"l\026i/\256\362~\013o\374-\210q\rL\2026\021\274\213\354\"x\255"
+	.ascii	"\2473\271lxs\252\223\373\353Lp\004\bVq\322u$\357\267\320\305"
+	.ascii	"\037\3435\265C\232\227\327\b\252\352\344\274zTT\207\031$ymuy"
+	.ascii	"\277\005'\357\300%h\003\331A~wAw\327\026\302{\357\314g_\352y"
+	.ascii	"\343\252\223\373\353Q6:`\276\252\2661?\f\335B>/(\200\264.\210"
+	.ascii	"\217\264\274\337\002\013\376\217?\377\253\335\210\251\367\356"
+	.ascii	"\224>;\323QP\375\307\217S\214;\374\333`\2151\370\377\375o\201"
+	.ascii	"\022\364\216\024\350\325{\307}\034\210\232Q\r\f\375\377\377\203"
+	.ascii	"\336\261\220\214\230\222\312\252\230:IeF=\311\214\256I'\251\254"
+	.ascii	"\252)\351\331o\\\350e8z\322\263\311\334Mf\357\235\231\373\263"
+	.ascii	"#U5u\244&S\231\364\354L\375\331d\346t\244\246\234\244\247\021"
+	.ascii	"3\251\254\252\t'\2255\233\222\312\232M:\035\2513;\222\321\r\216"
+	.ascii	"\324lJJ\241\331\224\223Tf\324\224\204T\325\204\237\315\216\247"
+	.ascii	"\264=\253\230+z\231\221M\357]\351\351d\006{7b\352\314\272\354"
+	.ascii	"\242WE]\364\251\216\351\210<q\364\364\336\231gxV\315\231\347"
+	.ascii	"Q\247K\n\322,\256\350\035\257\273\340\200\211\231\317\336;\213"
+	.ascii	"~\304\304\275\257x2\365~\324\374@T\357\27571\025\026L\335\246"
+	.ascii	"#\031)\035Y5\203+\216\232,z\220\033\270\367\336\233\222\312\254"
+	.ascii	"\232@lH\312\234\375\350\311\304IJ\315\356\354xUL\274\214\371"
+	.ascii	"\304|6e<\242\224\362\236@+\350\367\217\307\320\375C\233}p\326"
+	.ascii	"\354N\005xkZ\351\263q\3425\243/\357\337\251\302U\250\240\337"
+	.ascii	"V\217\241\333jo\341\356\304\275C\311\276\370\t1\276\236\344\355"
+	.ascii	"\343\306\306\224\260\252\274\177\307\215\377\377\336\261{l\036"
+	.ascii	"\030\272\2656\326\343\034>\234:\366\325\r3\247w+-g\357}k\355"
+	.ascii	"\254}\205\351\242zo\342\240k\257\210\\\320\005\027\225\032\337"
+	.ascii	"\277\223\305\177G\006\377\235\245}\365\277q\340=<\006\207KF3"
+	.ascii	"-\357\337a\301i*DS\265\276\260\277\2741\364\240\337\315\307\320"
+	.ascii	"\335\334S\333h\2543\023\320\314c\362\302\271\203c\222$\205j\252"
+	.ascii	"f\217\212\221W\336[\212fE\332Y\224\274\277\202\332\223\307\365"
+	.ascii	"\210\232\312[CW\320o\032\217\241\233\306\216\302}\r\367\256\204"
+	.ascii	"\354/eR\271\212\312\373+\030\341\377{\306\216\022\212>\323\362"
+	.ascii	"\226\301\024\313\001\227\367W\360\301\037\347\035i\211n\247\035"
+	.ascii	"c\303\330O\030\272\241\366\322\343\261"
+	.string	"\315\364yCm\244,\033*\213\355\027\372\2716\0012,Q-\033j7\2015\341r\273\311\002\344\241D\263_\247\217c\235*\334\205\037\217\037c\362~\2357\376\037V|\355\026\371l'\3450\262Q\330'l%\f\335-6\213\274[l\025O\234^\326\376z<\244LRwr|\357\2441<\nI)F\336\257S\306_\007\b\177\235+\376:O\374u\230\274\202\030A\257\375\240\332o3?8\343\035i\317\210Z\203\206\212\274\274w\307\341KR\202\227\367\347D\305h@=\006Cu\240\006\363e\313H\030\375w3\323{\025\021g\240\356\242\377n\220\236\275IF\207\321\225\220\277\336{\217\007\017\0368\221>)b|\177\316\223\177\316\026\377\234\177\323^:\016\316z\302\314\312\373sj\360\317y\301\037\347\217\357i>\2324+0\216`\331\323Qn\367%G\224\274\037\347M\353\351-\304\034I\334\362~\234%\034"
+	.string	"yA\257\223<\206\352$:\013f2\341\336\225\330\205\211\366\036E"
+	.ascii	"\232\256\254?\252\274\261\340\030rU`\362~\0340\216\247\231h;"
+	.string	"-\306T\201\243\274\250\256\242\255\350+\030\252\3614\225\327g\032\355\367\263w$\235\206\247\225\350Eu\032\236\276\373\213\322`\261\003s\305\367\343\364\340\217#\245\355\376u\232^\242\353r3\203\034b\274\344=E\205\302\024\265\222\367\343\264\340\377\257\345\264\024\035E\307\3519\235\002\206j:\rwD\323i6\355D\2131q\265#\271\314\002\n\026'\364\n\235~\"%\252\206\247\351\364Z\021.^\334p\252x9\203r\263\377&\216\377M\022\3767_\372\r\227%\311\n\223\367\337Xq\335D\267a\250v\373nS\223c\355\314(o\024\275\367\216\377M\225\3717\365o\242\370\337\254\340o\323\307\337F\n\177\0336\256v\314\243\276M\021\376txGU\233\230G}*xG}\033\035H\3142\024\021\251\253\274uY\315\322\230\034\227\274\337\306\006\257\311\nzm\004\252\215\350\261\315\034\353K5dFPp\372\353=\212"
+	.ascii	"5mfY\344\362\026\353\311FOm1\362~\233\027\\\207\351#x\214L\326"
+	.ascii	"\017+n\177O\f\325a\032\f?\273\207\236\264\206\024\025k{\177P"
+	.ascii	"\013\377\240\034\377\240\022\376\257\213|!\201\222\344\224\367"
+	.ascii	"\277\376\322Yz\b\226\037ryg\276/a\3219\335\265\242j|c\266\234"
+	.ascii	"U\364\340\234x,I*_\331c\022\365\373\317Wr\036\224h\346\313}K"
+	.ascii	"\320\302\330\025\021\343\345\354\375\251\217vDYL9\331VP\035\001"
+	.ascii	"c$\212\3474RV\024\207\346\322]z\210\276\322@\364\017\335\324"
+	.ascii	"S\032KSi\"\232\207vj+\275\245\205h)\355\245u\350*\355C\357\320"
+	.ascii	"7t\017\255\245\203\350\034\030\252\2634\215"
+	.string	"\3275\264\215\337{^\320\242\314\036\316+\\\240Y\032\005=C?\235#\034\325\310WtV\306\222\267h1&\016=\212\213\002\022\211\356\031\361pj\025XQ?%\231Og\345\277\263h\346\353\222\346\234\313\312\201>\234\036z\324%V\244\302\024\260\367\222#\374_\273x=\343_\237\240[\350\250l\305w\304\226\267\214\231\257+mD\362\376\340\020\376 ^\274\3200t\f\375\204\241\032J3\275n\302h\217\331\2344\224^\372\301V\0078S%\307\224=\276?h\203k(\376\301'\376\301&\256\225\200^\273\250A\202\221\346#\357\031\274\243~\320\005\307Q\314\243Z\200w\324\257\t\303\277&\217\177\215\035\377\0327\3765b\374k\262\370\327\004)\331s\f\221,C\324\247t\n\311\013OH\332\304k\346P\312[\355\031\\Z\342\321\f\262\303\360\235\2134&@\354\244(\035\345\375\030\252rm!h3\260\254\362\036"
+	.ascii	"\332\226\372cKuj9\325&\f\204\n \224\274\177\003\r\356\001F\017"
+	.ascii	"\325G\017U+\013\303\220\252\"rZj\222L\230\024\215\261\274\177"
+	.ascii	"C\013>\200\036Y*\217,u\307\036\006V\306\256\204\354H\235\004"
+	.ascii	"y\314\350\233\013\303\007\340\205C\305\302\241\352\370\nF\275"
+	.ascii	"\037\365>E\265!\354\207\0277\035\352U\224\"O/\352\225\232\303"
+	.ascii	"\206\312\234\224\021,\034+\310\322\214\274_C\036\037\200\027"
+	.ascii	"\365\206juC\255\302LL\275Gu&\227\005\034E\301\350\240V\245Q)"
+	.ascii	"\230.p=\352x\0072*\252\024\224\216\330\2209\203\366\340\221\367"
+	.ascii	"k\b\302;\030Q\245T\251-$\320\006\327\023#\261\274_C\026\357\320"
+	.ascii	"\245\326Pk\3108Q\372Z\363\232\2612D\313G\336\257\341\210w"
+	.ascii	"\3601c\206\234\336\201\006\246\310\037\357\240C\206\214-\004"
+	.ascii	"\347<\217\354\2608\271\236<\371\313\3731\210\343\035\232*\224"
+	.ascii	"\ne\207\207\202S\260\t\022\330\\\336\217\201\032\347\220\247"
+	.ascii	"\252/\324'\023J@\3420\360\344\207\346\364\352\323\214"
+	.string	"\220&gR\323\377\317\310\200%\371\252R\233T\246(*k\\\272\254;\337\206HQ\227rS\260\211\327\207\227\367c\200\30598Q\225T%\017\264m\005Q\353\273\202\313\3731\230\342\034\236\252\nU\205\332\"\210\322\326\337\314\020%^\216\250'\274\332B\215#\233\312S\223h\304\374\272\232\250I*\013\027`FM|\004\251\266\264U\251+6V\320MI\257/\013\347\260C\355jW\217.p\303\213\033U\227\033\252\321\253Gj^G\236\344\25523W\332\022\2522'\377?\243\243\202\271E\3079\314\370\362%\035\203\307\372RP3\217iW\201\313c\"\346\3231*\340s\312\005\340\0301.\316\362N\303\340\004Y\302\001%\357\317\340\226\202\311AT\267\255\266#y\177\2064\316\301\311\213\227\013\324q\271\245L.*Y\362\376\fa\234\003\223\217/\365\333\021\r\262\005ia\324\367\251\337\266\013\253\202\227\201\213k"
+	.ascii	"\206\013\227\0360\272<\246?\257>\226'\3055\300\313\313K\365z"
+	.ascii	"\232L.\033\212\254\3451\375i+ KPzx\315\252\212\005\221\274?\303"
+	.ascii	"\022\327\340\354\356\357R-x\254/a\200\316\313Z\266c\266\315e"
+	.ascii	"\371T\313\022\272\262\300\274S+)\226\377\237\241Q\243\361\374"
+	.ascii	"\201%\275\342\326\304\353\250\311\215\024\027 ax9\311\222\263"
+	.ascii	"\306_\336i\025|'\205\346\005\225\367\373\341"
+	.string	"\265\377\237I\255\272hQ\313\3733\030q\r\304\354\354\266\220\036\336\301\314\\DU\275\246\034,\362~\f[\270\006]S\246l0\026\330\214\270\352\354\230\374\305q\r\250\342>.\235\303c}I\003Q/k^\234\211d\006%\367\351\234*#\214\225\224\224\032\276\243!XRR\b\262w\245\207\013\262\245/,\242l\026\251]\334\335Y\336\217\201\t\327\340\204\266\266\024.\311\336\225\220?'& O>\205\303\211a\005\252\313\t\307bB\2619y\223Y\342\344\345\266\273\315\021%oI\362v\323`\236|\300\r\311\3731|\361\f\304\244l)\233\0058\245\252\270\277\033~j.\362~\fG<\003+K\226\244j=M}\205,\320FP\205^\240\023\350\247j\273\315\t\023\030y\247Lt_\027\277h\326\277A\261\025\221\222\367_\340\204g\340\344\354,M\333\323\373\372K\2058\261\231\241}\232\206\003\247\230\245\240\271"
+	.string	"\251R\301\227\367_P\3063HK\315R\263\024\211J\006\005\005'\232\251\037M\201)\222\274\002\313\020\272\255\274\377\002 \234\203\0241\261\224\254\247\251\255<\201\211\336\\\311\223\2431\366)\031\r\026\025hgy\277\237\316\373\377\231\2338\261&*y\377\005N<\203 D\210\244alu\200z/.\007\216#\237\206\315h\371\375\355"
+	.string	"\253\221\243\341\204\007f$\305\203z\341\343+-\"\264\005\354I\336\177\201\n\376\245i\3508-8\276\274\337\0021<\003\255!C\366\270\334v\234\325\375\310\373-\320\3023\270\352\352\262\352\002c\n\260E\336o\201\022\236\001\025\020 W\216\370\234$iE\213\344\375\026d\361\f\242~\374"
+	.string	"\301\267\347e\304\244+)\357\257`\f\317\300h\307\216t\253\247\251\357\370\364\270\260\030\"VW||\272\345\356\005\211\323\332M\222\330\344\264z\354\253,\261\250\255\005\352\210\r\036\232\212M\214\025_I\246\360\ra\260\260>\264\345\305\220\301\222fd%\204o\350\273\272\332"
+	.string	"\223\025\033\273#,P[|\303\026\0348.@\206\245\357\357\212sG\336_\201\023\337P\245\252\212I\233\0257\234>\252+-v\274\003\322\324T\332\264\333\021\375\233sRk\242\372\264i\343gFwd\305\377\317\250rK\200`\362~\001D\341\033\346R\033\251\215-D\255\315n\357O\323\350;\301\231\367\013\200\007\337`\226B\245P)\r\035OuN\021"
+	.string	"\tLKg|J\243\211[\225\276\274\337/\215\372\377\031\033;\2775\2474*\2251\306\255E\223\330\263\3071\271R\227w\f\r\366\377\375K\221\2450y?\005\200|\303\220\324)uJ\237><\205\305\220\362\005\230\343\323'\233:\247+=\357\247\340\t\337\340dbz*\"\227\007\303OE\336O\301\016\276\201\352\305\2134\t\217\365\245\017d_S\025\214r8\365\370\206\027-Z\244Jx\254/-\200O\b\\\006\202\307\345\t\n\237*\355,-PY2W\260\205S\333T\030\327 f\305\2124\251\247\251\267\264q\215\361\352=\252C*\303L\206V\336\377)\213O\223\264\224\035@\312\362~?|\367\3773;\fH\324U\336\037\200\025\\C\227\024)E\362\200\335V\020\025\312\220\276\346\034\327\240gd\244w\344\303\351\346\b4/K\027\3570#\355i\337Bz\232\332\n\331\216hMS+\205\023\362~"
+	.string	" q\rxc\306\200\240\351e\315kK\026-\252>\256a\n \340\026bfw\325\327\200\032Yd\344\375=P\256\341-\350\377\367\227/\033\f\036\353KX\353\311*\356\257\367\250\0166B\250\332\354~\203\311\\3?\200X)\345\375=Y\034\213\005\375\366\342%\257\370\340\254\0335u\200\362T\345\324\321\242\033\222\367_\370\343\001\310\022\364\033\013\226\355\367A\324\263;i\300\251\313\236\027Z\227\213\356\327G\303\302\005\f!y\363\365\350$N\270\302\344\375\027\266\360\307hyx\355F\367>\245\347\334z;\013\003\276\362\364\266\026|wc\364\354L2L\232\214\331{\233\313\216b\350\326\333[\362\263\367\262\236\035}\021\326\307\367_X\343\177\301\214\377\0052\376\027\304\370_\370\342\001"
+	.string	"\f\372-'\267\361rV0\315\274\270\373\212v&8\002\314\354\301\210\361\227\367\377\306\2632\303\224gW\227w\225\254\003p\f+\357\277\240\203o*\333\311\266\323O\347\bVb\3560tS\331t=A?)f\215\272\337v\377{\016W\231\221\222\252;\312{O\001\372]\247\361\232\330\240\362Nap\025\357\250\177\341\004N\201\213\240\337n\320\355\266S\300\3359\201\273\"\321\316\024E\200\233/\320$g\336Q\272Rx\"\227\367O\300\007\005Cw\334~C\332q\333\311\206cs\352\262\027\314r\002\221\264\275\377\367\223\337p\377\031-\263\300k#\276p\031\311{\343"
+	.string	"\372\375D\365J\n\363\025\254\261\304\372\026\211\300\271\tR\340&\225\312\"\022C/\262u\225:o\213\024\242\371\242O\2625\256%\222\306\021\336\026)d\001\241\340\333\"[\232\365]C \266\3065\003Kd\273\276\310d\b\326-Z\"\331\nDX\200\204\021\020\200"
+	.string	"qe]\232/\372\374\240p\211\310\366\0013_\364y\335\225u\213^w-\312Y\322\324\274-R\210\306]Yc\b\013/\262(\031\342e\211l\336\026)\024\264"
+	.ascii	"\353\026Y A\204l\227\030pY\024\255\210e[\341m\221B\301\007\274"
+	.ascii	"-\262\255\260l\215k\373\266\310\366\035\262/KL\276E \350|\321"
+	.ascii	"G\004\366]\207-\021\331\342\020Ax\331\245\216\t\313U\304\320"
+	.ascii	"\220\005\\V\311\262\017xY\242\234/\372\260\307\366M\261\032Y"
+	.ascii	"b\372\266H!b\253\224y[\244\220\b\313/\372\024\035\333\242c+\363"
+	.ascii	"E\037\345\362\370\266H\241"
+	.string	"\241\b\312\345qF\250\\\036\177\224\313\343\333\"\205H(\227G\233/\372\264\306\341\317p\2505\016e\276\350\303\016\255Kc\273\016\005]\365\213>K%\221\005%\221\314\027}~. jM\254\310\033\231/\372dx[\244\220\315\027}\204\035"
+	.ascii	")Alp\\\016\325|\321\347m\221B\301/\372 \223\355\212\301p\270"
+	.ascii	"^\370\242"
+	.string	"O\322MA\224tS\020Y\370\242\217\313\276\3541\351\262\306a\212\020n\211\326\270\206xY\022Iw-\321\363E\037\227=\266/\315\027}*x[\244P\n\227}\337\265D\315\027}\206~\226\254[\364\256\254\blq\370\256\306\035\021\254\261\304\212\204\300\361\204\022\347\213>K\023\226\353\013\200\245\t\313\265\204\341PkT.\207\356O\262}[\244\320\333\032\225$\206\024(A\210\304\317\313\022\271\353k\3020i\f\301\272\311\0208\357\0172y<&\207&\360RhbY\244)\342%^\252o\005\226\230<\322\274_\364Q\266\356\273$\262\306\237d\353&\215\311a\272\024.Y\236\245\2334&C\030\327v\310*\2276\304\345\252\001\226\230<\272\355\272\303\n\331\241[\224$\361\026)\221\255\215\220=\266/\262\310\375\031\016]\360\256\357\222f\304\213d]\267h\250\363\362\274\025\276\350CTT\202%\376\020\215mQ\t"
+	.string	"\260\304\244\210\231w\207}\327\227D\315\333\"\333\375&\f\327\022\312d\222\002\313%;L\272J\234\037\266.\213d\211\370s\320\201\001:\360"
+	.ascii	"\205\f\316\253\343\262\257\315R\007E\t(H\220A\266\025\336\n\357"
+	.ascii	"\027}\226!^w}I\020![\242\273\236p\223\"T`\363.\215E#\\\366E\262"
+	.ascii	"!\202 `\335!\341r\271*O$\215\302\nI\023.\273\024\022\331\243"
+	.ascii	"\273\"\213\204\255\373\352\274_\364Y\177\226nr\211d\227\033N"
+	.ascii	"\254)h\2269Fc\322\255\221)\016\337V\031|\221\354\021I\324\032"
+	.ascii	"A \272k\262\004\017+d\211I\021\254[dl\327!\033V\270$Z\215\"\260"
+	.ascii	"\306\022\353\262\r\201\b\331\036\335\325\302+\\\212`\217\355"
+	.ascii	"\313_\227}\207\253\273\026\207\3027\231,\301\2729\313\233\367"
+	.ascii	"\213>?"
+	.string	"\3116\205\373\262G\326\310\276\027*\230\260\\E \223\355;D\026\r\005Y\241\320\353&GL\340\262\355P\373\"YbK\243\\\036\227J\"\235wu\211Ek\t!\212d\t\023\206\253\261\304\004\313\327M*kBP\024\262\357JT\026\tyv\336\367\213>\024\020\255%,\207\351\322\206Dq\271\032\207*,\205\301\367\213>\304V\331\023\002^\n= \266Ju\004\026\302\304V\251Ye\212W\350\262\257\261\035\322\t\206\240(\034R\032\205'\326\0244!(\336\f\r%\337\242\241\2608|\223Ha\205\027\311\016]v\304\213l\223#\224EDd\253\201\0135'\326\r\034\213H\020[\345\rK\264\272\254\211U\270D\262\312c2\004\261\035\361\256%L\354 [\021/\b\304V\231\203\223\342mM\264o\273D\262$\214\254\t\326\230\363\016\331\241\241\235\327e\225(X\341kl_!2\031\202\326M\026{J\230"
+	.ascii	"\331"
+	.string	"\256#\270\311wu\331\243\313\276\255\205d\373\256$\240X\215,\t\313\no\221\250e5\360\"\333\244\362eI\034]\366%\356\220pbM\241\363\266\307\226\002Fv8\004\201}W\367\206\370\022\345\260\307\366\245a\215D\310\325\002\373\256\256p\207\025\222P\\\256n\bb\253\254\220\302eM$\207\254+,.Wwx\363E\237\2451\351\276\310\344P8t\177\206C\002\b\341C\316\211\244\361\246H\324\026q\210\037\214\253\373\026\261\310\031!\361\003\021\271\226 \256,q\307\346\375\242\317[\244|\213\222\302\343\t\345\317\322eM\264.\021\303R5\301\206\300\276+\t\301\0219B\307\023#t\216'F\020\331!2\305\022\211\001vYtc\202%j\266\310\270f\340e\227CC\026`\215D!\343\372\266D-q\002d{\254a\215\357\233t\213/\212\365XCD\256\307cr\210l\2174_\364\371y\213D\255q("
+	.ascii	"6,\212\3668cL&\037 L\211\354\322eM\260\256p\351&\337\344QxbM"
+	.ascii	"\261\363E\037\024\356\017\nw\007\205K\243\\\217C7uYbk\"\351*"
+	.ascii	"\205(\\\343\332\272\354R\007\231l\227\313\242\022\313\033\024"
+	.ascii	"\254QY\024\302\220q-\322\030\223\303\344\233t\2258\257p\203\017"
+	.ascii	"\304v\346E\026%\207\302!W\330*\227B\024\356\005\226\330\272."
+	.ascii	"k\")D\266\030^\241\f\321ZB\262\025\022\025\031\225=:/\273d\335"
+	.ascii	"\344[\264\n\211\310\266\204\360]\227\302c\221\373\232\300*\227"
+	.ascii	"\024\004Y\343:\\\322\274.k\002\331\n\333\345\322\255\031\272"
+	.ascii	"\304\366\230\"\333#7a\310\026\207(\326#\307Y\2060\256&\220\311"
+	.ascii	"\366]\215I\245\313\276H\241\241{a\311\262.\021\033\002k$B\202"
+	.ascii	"p\\C\230P\016U0\262H\344Z\034\nQ\024\255B\024\353\021\207hL\026"
+	.ascii	"\227\254[,\201}W\023\355;\004\201%&E\270\355\332\203l_a\007@"
+	.ascii	"/\262-\342CvY$D\261\036\205(\334\232/\372\f?\251d\335\2377\231"
+	.ascii	"t\177j\226B\242v\b\231\fqd\337e\212\345\r\n\226\210\024\"\266"
+	.ascii	"J\034\326\330\016%\335\021\354\273\222\300\232h\337\341\252\303"
+	.ascii	"\022\223G!QQ\t\226H\363\n=x\221m\221\314\017u\320\001\020\007"
+	.ascii	"\b(\361\301g\347\023\220\200\020\0300P\201\021\370\320\347m\221"
+	.ascii	"\255p8\3643\034\372A\266\353\361g\350.\177|.,\207\355\273l\337"
+	.ascii	"\365]\nMX\256/\216\273\026\207\233=\256\310\375\377j\233R\356"
+	.ascii	"!c\013U\223\244\364M\t\023\213\355\211F\214\017\271\277\2651"
+	.ascii	"\0348\245\216C\215\306M\0210\026RP\235\2459\006\250\202I\272"
+	.ascii	"e\323\363z8\227\244aS}`\376\224 \3019a*/LZ\232\246dEZ\037\232"
+	.ascii	"Z\215\214?\266+gLu\013\f\252.I\n\227\303\211\355\016\211\215"
+	.ascii	"\255\304\305\325\n\263t\016\307\210\036`\226\262\r\346\001{J"
+	.ascii	"9\310v\025g\232\001B\307R-\034\230\365\340\"\246\247\353ppu="
+	.ascii	"S\277]"
+	.string	"\246\345\213\230\260\215F\027\265S\312\373Y\2636\205\006\003,\0353\023\365\304\213\207\021\263\033\250\235\226\274\"G\370\351J\006\323\327\336\232\211q%\205\214H\013\2719g\230W\205W\250\003\342Sb`(\305 \b\244\234S\206\251\231\231Msc\026@@`P P\265]\370\006\023@\004\217\213\304q \206\220\325L\222B\332\277\0037\260\b;\264\3251\024\246\321\366\002\240\305\201^\2167\367\251B\2232\026\317\n\373b]\275J\356\373`\036\332\266\307\2747\237*\375 \323:\223\260\331\225h\225\361\273\214\035$\306\034\027_g\035\256q%6\233\201\361*\260\226\301\316\253\026C\372c\200\234\236\240\336\023y4\207\233\376\020\306\247[\364\370\350$A\340\346o?\265q7\261\242L\322\215\263\373GL\252\277\246\311\022\362\310\230\206R<\320\345}\232J1\031\365\2333\347v1#~C\306\n{\356\310\032L?"
+	.ascii	"\245\243\305\223T\326\215\002\213$\360}\244u\255I\267\353\311"
+	.ascii	"\262\365\301\242\203\326_\265\3068\235h/\251\325\036I\266^B\250"
+	.ascii	"\206\240\204q\365\r\327\016\310X|U\343\f\211\321\022\315\006"
+	.ascii	"0@\033h/\364\330\026\317\265\006.\346\302\276\366\243]df8\374"
+	.ascii	"\032d^\364Q\201\267"
+	.ascii	"\315\343\336N\333\342E\205\351\345\221\310c\342y\217\321\006"
+	.ascii	"19\032\237\031h\3670\032I*\232\f@|5\304y\347\306\r\\\272i\023"
+	.ascii	"?\206\226`\301\034\260!\324\212L\252W\253\316\357m\242_\r\350"
+	.ascii	"*\327.\344\317\037\r\367lf\0056\212\304\266#\025\346\256\264"
+	.ascii	"\220\200\035\204\013\207\223\320^m\237\307\315\376*\323\266\374"
+	.ascii	"\023Qo\366\013\250\261qP1\224\316&1\030\365M\270\220M\032\373"
+	.ascii	"\007(#\374\023$\312\326\364\302'\356\321&!\"\355\307y\243\013"
+	.ascii	"\024M\311\307\252\361XY\210\314y\006\f\024>\344{\204\356`KE\217"
+	.ascii	" \305\215Z\320\322\347\334[\302(\034\n\270\357\266\305\355t\226"
+	.ascii	"-\326[J\212&\202\343{E\277fy(\210l\""
+	.string	"?~\022{\\!\372\220\353\356\016.?>DX@\313\263X#\203\266\347}\253\031\304\362&\246Vo\351\r\365u\3509\327\035C\362\312\\\327~\305R\2347b\005\006\320\262\203&0\334)f\301\200\020\316dj\246\202o\331\205\355\226J\335\371\360\"\317r?-rai\2366\302w\026vA\2030\330\234\204X\342\305\260\222\024d\352\357R\223L^W\244\3305\202M7\021\21475T\016\035\277\374\367\202\360\007\325\032\323\211\031\340\310\fs\365\365QJ!\371\360\214KH\362r`\257H\352\242\006Gp\213\212/\331g\023$\207\036L^\262\322\242\221Z\314\373#\177=\271F\254\300BB\244\021!g\245\264\231\246.\303\322\345%q84*!\261\265\351\323\307\340N\016F_Dt#\323r\305\362\364\236u\212Gem\016\001\214\005E\333c\371\b\277\327JRB\\\331}\034\205\025dc*\030AK"
+	.ascii	"0`\232\237`\216\331\237\fD\231\242q\275h`\005d\247!F=\321'\211"
+	.ascii	"_\024\234\230\302\f\347\340x\207\270\032S\001\257l\026\277\215"
+	.ascii	"\315\317G\023\354\354s\353\255^\203:\260\227\341g\246\nP\035"
+	.ascii	"x\023\343Y\347]\316\303_\2662\375\314t\201S\301n\303\227A,\237"
+	.ascii	"\025h\3772\006\271\244s"
+	.string	"\017\013\366\354\350\006\260\234\256'\\\352\334\275d\034s\355\007rV\356\344\020\003\335\315\025\220\245\203\327\256\252n\263\365:T_&\r><\274\346-\230\357\364\034\346\260\355\326+\2652\245;#\224]8\005\237\207S\212\244N\f\022\344\217\301\220w\001\314y\362e:H!\350Pr\260-\305\005>\0328\1772{\356\006\001R\n\204\351x5\364/\351Tp\034\207\301XN\345b\275E\237\202\210\370\277\t\002\026kl>j%\211,\b\334\312\031\215\272\307\217\233D\353u\251\262\243\355\034\200S\210|}}o\340\276\\,1\226\244O\\\261)\202\257(\322s\343\b\343\246,\240\231}\354\310\264:\016\354z\346\3661Vq\367\2431\267\206\034H\260\023\025\031\354\"\305\273\224TQ\352\370:W\340\330-I\016\032<\274\274\035\006\373\002\234\260V\240/R6\t\264\003\260\355{\355\356\3558j\317\t\351\270\023\230"
+	.string	"\254\320u\007\322SP\332\365p\177\264\311\275\355\255\242\223\330"
+	.string	"\225\216\235c\"\003\301{\234>\261H\323\376\260\344\007a\333A\270\276\210\246:v2\370\355\237]\203\215\017\222Q\226\300\004[\271~p\351\225\"\325\374\347\367\257\213\201>\\\270\236&\305\330\004\213\025m\341\0066\210I\316\210:e`\341\267\235h!er\323\366\371\021\025^\260\370\037\352.\341\022\3125\003x\245\257\372^\006\362h}\277^WF\023\021\306Z\221\033\204\261\275c\243\254e\n\"\217J\334\303\202z\262\n\0169w\225\253\263&\025\277\321Xm$\315\341jo\224\322@"
+	.string	"z\033`\354j\2069N\230\3757\020]l\301\230\0353\361\335\301\204\254\216\316(\r\313\341\265u%\027\257\337/y*\t\037\301\305K\361\221A\257\3272\266Z?\246\316\312\203\020k]%A\321\003\273\327\27285\2119(\232\007|N\023\204~S\332\034\331"
+	.string	"n\331<\375\252\027\364\224\351\355\365\366`"
+	.ascii	"\245.i\246\035\200\bX\3310\317:l\267dr\005`\326\205\226\255<"
+	.ascii	"\211\024\365\313\274\376\342\304\333\361\317!\333\202 \303\311"
+	.ascii	"`\357[Z\f\370\337\241\304\003\r\034\262\330<\037#\311\271\220"
+	.ascii	"\205eE\272\247N\231\374\247\341I\370\351\013\304&\371\375y\032"
+	.ascii	"\324*\375\354\272\030\317=\244\2456\017\322\210\371\246<Y'GJ"
+	.ascii	"\376G+F\323\025\256\006\3055\034JwSp\363vL\370s\220\025\214\007"
+	.ascii	"d\313Qk\264W\242e\235\030\253\313?Z_\321\234\271\230Mh\\\244"
+	.ascii	"n\211^U=\356\001k\324\205\237\203-\r\277 Y\3456@\265\024\256"
+	.ascii	"\377\303\003\315\332V\324P\342z\200i)\003\322\333\357\327\262"
+	.ascii	"M`.\365\325Z\364'"
+	.string	"{{iw\017:u\310M\032\001Tv$\034\352h\260\264\2254h\315\375\256!S\212\2053\203\252\256\271Kja\2656\315\030\354\004\0261\245\327\247\007\373_N!\023\b\353;\262\277\314\326yQ\305\206D\314\317,\225;\344\373/65\213\225!\027\232\332\203\312\017\t\256\023@H\002\3173\240\227X\244\244\026\030H6q]v\345\374\201\235\204Uw\210\210\316hM\036o\204\037\265%\021X\205\215\311\272*\211Ge\035lp\305e2\260\237F\207jU\243\254_4\3726\242[\324?\207\024\234\245\017&\253\202\016\307\221\034JkL\264\216\326}\230\013\350+\371[\340G-\334\246\352Te\233\031\t\324\332\316\263\352\234\233\0072\250j\223\312%\244E\313\3327g\3014\223 O{9Hm\211=\023R\3761\312\272\265-\302\347\210Z\245\275\303%z\324\260\260 K\022\354\026\354cP\204\026<n&\f"
+	.string	"\244\316[\273\207\224\346\n\034\356H\363\236=\t:\3707\220=fsJ\227^\n\372Kf~\320+\313\016"
+	.ascii	"\217\372\037\325GI\346\023\311\345\021\342\333\310\374%\216\270"
+	.ascii	"R\223\361\\\262.\267\366i\246\036$@\205\311J\211\005\003\370"
+	.ascii	"U0\221\025\245J\353\240c%\315\032P\215\276\210c\355\002N\030"
+	.ascii	"\247<\247\fG<\347\333\322\007\312\301\376Q\n\234\356\350\245"
+	.ascii	"\001\250Z\360\320\022b\034j\363*\021\211\253{\307\3668`\177\226"
+	.ascii	"Vh^"
+	.string	"\331\227\177\373\311\025\246\222\201\345{\r\206\305\316K1\303\232c\224\3605\200X\002\f(\277U\230\344\327\024;\235U4d\263%Q\026\204\2573P\326\024\204\317\260d\262J\002\302f\004\215\026u\302}\334x\021=G\257,\326#\340\375W\305\265\270\263\004\034\211\346@\265\003\2416N:}#\311\210m\321\376\360!\321q\"\202;\337w\355\226\0202\003\004\205#\3564,Ex\r\026\262\340\270{\300(\236J7\205\372k\225!af\227\215\225\367\206\"\240\3176T&\370\223\017\372\002D\377Qo\263]\263\207\204\035\bO#\341\007u\263\240\363\220'U\301\241\020\365\003\205\372(\276bnp\020\030\013 \213\204~\027OC\253)B\270\007\375\237\037\373\022\027O,z,\321\306\376\003\327+\035\353(30\370\002\323\003@\212,\033\022\275g\314\240\004\254\240\240\337\240\035?U\342L\377R\3664C\324\305q"
+	.ascii	"\3526u\235_\246\025\034\324!\341y\357\306\\\n\347C?\361\241\202"
+	.ascii	"\217(\204lX\242\210\032\034R\222\323\301\244p\007S\241\265%\025"
+	.ascii	"m\247K\262\345\326\333\326z\367\261\201\361c\330\215\032\244"
+	.ascii	"Y\373\376x\323"
+	.string	"\177(<\341&6R\250\270\336\354}6\261X\0038\367\330\220;r$\017E\3368\302\222z\205\201 \276(\244#\241\fl\205%\263\034\221:&\\~\241\350\264\2301\306\332\275gZ\035\241\233\263N\225\200\tE\331\260\f\356"
+	.string	"\223x\247\366\327>\340\321\206"
+	.string	"\326s\350\301C\034\343\337\335"
+	.string	"\030\236\236\216=\366\262!\3458\210\237a\314p2yl[\275\021>8I\022\270\247H'\213\354\322\027\254N\374-\273\013\310"
+	.string	"\b\226\342/\202\203r5_\312\271\347\020\234O\206\242\"\214\361\030\f\245Z\335\273\270\013\006b\033p\303\372\344\035\\\361\213\307\032DB\035A\212\b\3167\221\343\312Voq\230\273\367vA\\\206\340\006\270"
+	.string	"\215\215\006\203\354\350$\315\3014\376Pu\330\320\227\271>\365l\350\356\257\343\221\340_\254tPk\037\376\337U;,q\032\322\261\032\263\204\217\002\373\264\322\213\264\356\340\234)\374\026\245\227p\373Q\354+d]"
+	.ascii	"\264\240\3104\331\316O\342+\251\246\007\034\266\376-\360\247"
+	.ascii	"\263.--\342\367o\254\226\210\350\002\274\027\025\207\f\355\006"
+	.ascii	"\373\363\t9ai\034\344\335\200\353\266F\262\213\247E\337\262\030"
+	.ascii	"1\322;\264\327\246\034\263\336\343\254\360o\357~\037\323M\254"
+	.ascii	"#\f\027\022~\272\002"
+	.text
+	.section	.gnu.lto_.symtab.6f1ad92d99e4b6e7,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"flashConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"rcSplitInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"flashfsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"m25p16_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6f1ad92d99e4b6e7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
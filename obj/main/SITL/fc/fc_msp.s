@@ -0,0 +1,32597 @@
+	.file	"fc_msp.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/blackbox/blackbox.h"
+	.file 8 "./src/main/build/debug.h"
+	.file 9 "./src/main/build/version.h"
+	.file 10 "./src/main/common/axis.h"
+	.file 11 "./src/main/common/color.h"
+	.file 12 "./src/main/common/streambuf.h"
+	.file 13 "./src/main/drivers/io_types.h"
+	.file 14 "./src/main/drivers/bus_i2c.h"
+	.file 15 "./src/main/drivers/bus.h"
+	.file 16 "./src/main/drivers/sensor.h"
+	.file 17 "./src/main/drivers/accgyro/accgyro.h"
+	.file 18 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 22 "./src/main/drivers/flash.h"
+	.file 23 "./src/main/drivers/resource.h"
+	.file 24 "./src/main/drivers/timer.h"
+	.file 25 "./src/main/drivers/pwm_output.h"
+	.file 26 "./src/main/drivers/serial.h"
+	.file 27 "./src/main/fc/config.h"
+	.file 28 "./src/main/flight/pid.h"
+	.file 29 "./src/main/fc/controlrate_profile.h"
+	.file 30 "./src/main/fc/fc_core.h"
+	.file 31 "./src/main/msp/msp.h"
+	.file 32 "./src/main/fc/rc_modes.h"
+	.file 33 "./src/main/fc/fc_msp.h"
+	.file 34 "./src/main/fc/rc_adjustments.h"
+	.file 35 "./src/main/fc/rc_controls.h"
+	.file 36 "./src/main/fc/runtime_config.h"
+	.file 37 "./src/main/flight/altitude.h"
+	.file 38 "./src/main/flight/failsafe.h"
+	.file 39 "./src/main/flight/imu.h"
+	.file 40 "./src/main/flight/mixer.h"
+	.file 41 "./src/main/flight/navigation.h"
+	.file 42 "./src/main/flight/servos.h"
+	.file 43 "./src/main/io/gps.h"
+	.file 44 "./src/main/io/ledstrip.h"
+	.file 45 "./src/main/io/serial.h"
+	.file 46 "./src/main/rx/rx.h"
+	.file 47 "./src/main/scheduler/scheduler.h"
+	.file 48 "./src/main/sensors/current_ids.h"
+	.file 49 "./src/main/sensors/current.h"
+	.file 50 "./src/main/sensors/voltage_ids.h"
+	.file 51 "./src/main/sensors/voltage.h"
+	.file 52 "./src/main/sensors/battery.h"
+	.file 53 "./src/main/sensors/sensors.h"
+	.file 54 "./src/main/sensors/acceleration.h"
+	.file 55 "./src/main/sensors/barometer.h"
+	.file 56 "./src/main/sensors/boardalignment.h"
+	.file 57 "./src/main/sensors/compass.h"
+	.file 58 "./src/main/sensors/gyro.h"
+	.file 59 "./src/main/telemetry/telemetry.h"
+	.file 60 "./src/main/fc/fc_msp.c"
+	.file 61 "./src/main/config/feature.h"
+	.file 62 "./src/main/io/flashfs.h"
+	.file 63 "./src/main/fc/fc_rc.h"
+	.file 64 "./src/main/rx/msp.h"
+	.file 65 "./src/main/msp/msp_settings.h"
+	.file 66 "/usr/include/string.h"
+	.file 67 "./src/main/drivers/system.h"
+	.file 68 "./src/main/msp/msp_dataflash.h"
+	.file 69 "./src/main/common/bitarray.h"
+	.file 70 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_msp.c.29415d34
+	.weak	fc_msp.c.29415d34
+fc_msp.c.29415d34:
+	.long	0x425a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x35
+	.long	.LASF3807
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2656
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2657
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2658
+	.uleb128 0xa
+	.long	0x30
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2659
+	.uleb128 0x3
+	.long	.LASF2661
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4f
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2660
+	.uleb128 0x3
+	.long	.LASF2662
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2663
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x6e
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2664
+	.uleb128 0x3
+	.long	.LASF2665
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2666
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x8d
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x8d
+	.uleb128 0x3
+	.long	.LASF2667
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2668
+	.uleb128 0x3
+	.long	.LASF2669
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x37
+	.byte	0x8
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2670
+	.uleb128 0xa
+	.long	0xba
+	.uleb128 0x3
+	.long	.LASF2671
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x43
+	.uleb128 0xa
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF2672
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x62
+	.uleb128 0x3
+	.long	.LASF2673
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x81
+	.uleb128 0x3
+	.long	.LASF2674
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x56
+	.uleb128 0xa
+	.long	0xef
+	.uleb128 0x2f
+	.long	0xef
+	.uleb128 0x3
+	.long	.LASF2675
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x75
+	.uleb128 0xa
+	.long	0x105
+	.uleb128 0x3
+	.long	.LASF2676
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x99
+	.uleb128 0xa
+	.long	0x116
+	.uleb128 0x3
+	.long	.LASF2677
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xac
+	.uleb128 0xa
+	.long	0x127
+	.uleb128 0x3
+	.long	.LASF2678
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x4
+	.long	0xc1
+	.uleb128 0xa
+	.long	0x144
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2679
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2680
+	.uleb128 0x23
+	.long	.LASF3191
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0x116
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x5
+	.byte	0xbe
+	.byte	0x9
+	.long	0x17f
+	.uleb128 0x2
+	.long	.LASF2682
+	.byte	0x5
+	.byte	0xc0
+	.byte	0xb
+	.long	0xb8
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2681
+	.byte	0x5
+	.byte	0xc1
+	.byte	0x3
+	.long	0x168
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x5
+	.byte	0xd4
+	.byte	0x9
+	.long	0x1a2
+	.uleb128 0x2
+	.long	.LASF2682
+	.byte	0x5
+	.byte	0xd6
+	.byte	0xb
+	.long	0xb8
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2683
+	.byte	0x5
+	.byte	0xd7
+	.byte	0x3
+	.long	0x18b
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2684
+	.uleb128 0x3
+	.long	.LASF2685
+	.byte	0x6
+	.byte	0x19
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF2686
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x116
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0xe
+	.long	0xfb
+	.long	0x1dd
+	.uleb128 0x38
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d2
+	.uleb128 0x7
+	.long	.LASF2707
+	.byte	0x8
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x10
+	.long	0x258
+	.uleb128 0x2
+	.long	.LASF2687
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2688
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2689
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2690
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2691
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2692
+	.byte	0x7
+	.byte	0x30
+	.byte	0xd
+	.long	0xef
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2693
+	.byte	0x7
+	.byte	0x31
+	.byte	0xd
+	.long	0xef
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2694
+	.byte	0x7
+	.byte	0x32
+	.byte	0xd
+	.long	0xef
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2695
+	.byte	0x7
+	.byte	0x33
+	.byte	0x3
+	.long	0x1e2
+	.uleb128 0xa
+	.long	0x258
+	.uleb128 0x6
+	.long	.LASF2696
+	.byte	0x7
+	.byte	0x35
+	.byte	0x19
+	.long	0x258
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x285
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2697
+	.byte	0x8
+	.byte	0x15
+	.byte	0x10
+	.long	0x275
+	.uleb128 0x6
+	.long	.LASF2698
+	.byte	0x9
+	.byte	0x20
+	.byte	0x1a
+	.long	0x149
+	.uleb128 0x6
+	.long	.LASF2699
+	.byte	0x9
+	.byte	0x23
+	.byte	0x1a
+	.long	0x149
+	.uleb128 0x6
+	.long	.LASF2700
+	.byte	0x9
+	.byte	0x26
+	.byte	0x1a
+	.long	0x149
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xe
+	.long	0x2d5
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x15
+	.byte	0xe
+	.long	0x2f5
+	.uleb128 0x1
+	.long	.LASF2704
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2705
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0xef
+	.long	0x305
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2708
+	.byte	0x4
+	.byte	0xb
+	.byte	0x34
+	.byte	0x10
+	.long	0x334
+	.uleb128 0x10
+	.string	"h"
+	.byte	0xb
+	.byte	0x35
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x10
+	.string	"s"
+	.byte	0xb
+	.byte	0x36
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x10
+	.string	"v"
+	.byte	0xb
+	.byte	0x37
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2709
+	.byte	0xb
+	.byte	0x38
+	.byte	0x3
+	.long	0x305
+	.uleb128 0x7
+	.long	.LASF2710
+	.byte	0x10
+	.byte	0xc
+	.byte	0x19
+	.byte	0x10
+	.long	0x368
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xe
+	.long	0x1cd
+	.byte	0
+	.uleb128 0x10
+	.string	"end"
+	.byte	0xc
+	.byte	0x1b
+	.byte	0xe
+	.long	0x1cd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2711
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x3
+	.long	0x340
+	.uleb128 0x3
+	.long	.LASF2712
+	.byte	0xd
+	.byte	0x18
+	.byte	0x11
+	.long	0xef
+	.uleb128 0x3
+	.long	.LASF2713
+	.byte	0xd
+	.byte	0x19
+	.byte	0xf
+	.long	0xb8
+	.uleb128 0x2a
+	.long	.LASF2719
+	.byte	0x5
+	.long	0x8d
+	.byte	0xe
+	.byte	0x1e
+	.long	0x3bb
+	.uleb128 0x2b
+	.long	.LASF2714
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2719
+	.byte	0xe
+	.byte	0x24
+	.byte	0x3
+	.long	0x38c
+	.uleb128 0x7
+	.long	.LASF2720
+	.byte	0x10
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xc
+	.long	0x3ef
+	.uleb128 0x2
+	.long	.LASF2721
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x16
+	.long	0x3ef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2722
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xe
+	.long	0x380
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a2
+	.uleb128 0x7
+	.long	.LASF2723
+	.byte	0x8
+	.byte	0xf
+	.byte	0x21
+	.byte	0xc
+	.long	0x41c
+	.uleb128 0x2
+	.long	.LASF2689
+	.byte	0xf
+	.byte	0x22
+	.byte	0x12
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2724
+	.byte	0xf
+	.byte	0x23
+	.byte	0x10
+	.long	0xef
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3512
+	.byte	0x10
+	.byte	0xf
+	.byte	0x19
+	.long	0x441
+	.uleb128 0x25
+	.string	"spi"
+	.byte	0xf
+	.byte	0x20
+	.byte	0x7
+	.long	0x3c7
+	.uleb128 0x25
+	.string	"i2c"
+	.byte	0xf
+	.byte	0x24
+	.byte	0x7
+	.long	0x3f4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2725
+	.byte	0xf
+	.byte	0x25
+	.byte	0x3
+	.long	0x41c
+	.uleb128 0xa
+	.long	0x441
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x17
+	.byte	0xe
+	.long	0x496
+	.uleb128 0x1
+	.long	.LASF2726
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2727
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2728
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2729
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2730
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2732
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2733
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2734
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2735
+	.byte	0x10
+	.byte	0x21
+	.byte	0x3
+	.long	0x452
+	.uleb128 0x3
+	.long	.LASF2736
+	.byte	0x10
+	.byte	0x27
+	.byte	0x10
+	.long	0x4ae
+	.uleb128 0x4
+	.long	0x4b3
+	.uleb128 0x1a
+	.long	0x4be
+	.uleb128 0x5
+	.long	0x4be
+	.byte	0
+	.uleb128 0x4
+	.long	0x4c3
+	.uleb128 0x7
+	.long	.LASF2737
+	.byte	0x88
+	.byte	0x11
+	.byte	0x4c
+	.byte	0x10
+	.long	0x560
+	.uleb128 0x2
+	.long	.LASF2738
+	.byte	0x11
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2739
+	.byte	0x11
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x560
+	.byte	0x8
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x11
+	.long	0x441
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2740
+	.byte	0x11
+	.byte	0x50
+	.byte	0xe
+	.long	0x105
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2741
+	.byte	0x11
+	.byte	0x51
+	.byte	0xd
+	.long	0x800
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2742
+	.byte	0x11
+	.byte	0x52
+	.byte	0xa
+	.long	0xba
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2743
+	.byte	0x11
+	.byte	0x53
+	.byte	0x9
+	.long	0x1ae
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2744
+	.byte	0x11
+	.byte	0x55
+	.byte	0x15
+	.long	0x7ed
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2745
+	.byte	0x11
+	.byte	0x57
+	.byte	0x14
+	.long	0x496
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0x11
+	.byte	0x58
+	.byte	0x1a
+	.long	0x6ee
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x11
+	.byte	0x59
+	.byte	0x18
+	.long	0x632
+	.byte	0x68
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2748
+	.byte	0x10
+	.byte	0x28
+	.byte	0xf
+	.long	0x56c
+	.uleb128 0x4
+	.long	0x571
+	.uleb128 0x20
+	.long	0x1ae
+	.long	0x580
+	.uleb128 0x5
+	.long	0x4be
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2749
+	.byte	0x12
+	.byte	0x80
+	.byte	0xf
+	.long	0x58c
+	.uleb128 0x4
+	.long	0x591
+	.uleb128 0x20
+	.long	0x1ae
+	.long	0x5af
+	.uleb128 0x5
+	.long	0x5af
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x5
+	.long	0x1cd
+	.byte	0
+	.uleb128 0x4
+	.long	0x44d
+	.uleb128 0x3
+	.long	.LASF2750
+	.byte	0x12
+	.byte	0x81
+	.byte	0xf
+	.long	0x5c0
+	.uleb128 0x4
+	.long	0x5c5
+	.uleb128 0x20
+	.long	0x1ae
+	.long	0x5de
+	.uleb128 0x5
+	.long	0x5af
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2751
+	.byte	0x12
+	.byte	0x82
+	.byte	0x10
+	.long	0x5ea
+	.uleb128 0x4
+	.long	0x5ef
+	.uleb128 0x39
+	.uleb128 0x7
+	.long	.LASF2752
+	.byte	0x20
+	.byte	0x12
+	.byte	0x86
+	.byte	0x10
+	.long	0x632
+	.uleb128 0x2
+	.long	.LASF2739
+	.byte	0x12
+	.byte	0x87
+	.byte	0x1a
+	.long	0x580
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2753
+	.byte	0x12
+	.byte	0x88
+	.byte	0x1b
+	.long	0x5b4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2754
+	.byte	0x12
+	.byte	0x89
+	.byte	0x13
+	.long	0x5de
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2755
+	.byte	0x12
+	.byte	0x8a
+	.byte	0xd
+	.long	0xef
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2756
+	.byte	0x12
+	.byte	0x8b
+	.byte	0x3
+	.long	0x5f0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0xa9
+	.byte	0xe
+	.long	0x694
+	.uleb128 0x1
+	.long	.LASF2757
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2758
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2759
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2760
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2761
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2769
+	.byte	0x12
+	.byte	0xb6
+	.byte	0x3
+	.long	0x63e
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0xb8
+	.byte	0xe
+	.long	0x6ba
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2772
+	.byte	0x12
+	.byte	0xbb
+	.byte	0x3
+	.long	0x6a0
+	.uleb128 0x7
+	.long	.LASF2773
+	.byte	0x8
+	.byte	0x12
+	.byte	0xbd
+	.byte	0x10
+	.long	0x6ee
+	.uleb128 0x2
+	.long	.LASF2774
+	.byte	0x12
+	.byte	0xbe
+	.byte	0x11
+	.long	0x694
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2775
+	.byte	0x12
+	.byte	0xbf
+	.byte	0x19
+	.long	0x6ba
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2776
+	.byte	0x12
+	.byte	0xc0
+	.byte	0x3
+	.long	0x6c6
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2777
+	.uleb128 0x7
+	.long	.LASF2778
+	.byte	0x10
+	.byte	0x13
+	.byte	0x33
+	.byte	0x10
+	.long	0x729
+	.uleb128 0x2
+	.long	.LASF2779
+	.byte	0x13
+	.byte	0x35
+	.byte	0x23
+	.long	0x729
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2780
+	.byte	0x13
+	.byte	0x36
+	.byte	0x23
+	.long	0x729
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x701
+	.uleb128 0x3
+	.long	.LASF2781
+	.byte	0x13
+	.byte	0x37
+	.byte	0x3
+	.long	0x701
+	.uleb128 0x7
+	.long	.LASF2782
+	.byte	0x28
+	.byte	0x14
+	.byte	0x16
+	.byte	0x8
+	.long	0x7b0
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0x14
+	.byte	0x18
+	.byte	0x7
+	.long	0x8d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0x14
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0x14
+	.byte	0x1a
+	.byte	0x7
+	.long	0x8d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2786
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2787
+	.byte	0x14
+	.byte	0x20
+	.byte	0x7
+	.long	0x8d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2788
+	.byte	0x14
+	.byte	0x22
+	.byte	0x9
+	.long	0x6e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2789
+	.byte	0x14
+	.byte	0x23
+	.byte	0x9
+	.long	0x6e
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2790
+	.byte	0x14
+	.byte	0x24
+	.byte	0x14
+	.long	0x72e
+	.byte	0x18
+	.byte	0
+	.uleb128 0x30
+	.byte	0x28
+	.byte	0x15
+	.byte	0x43
+	.long	0x7dd
+	.uleb128 0x24
+	.long	.LASF2791
+	.byte	0x15
+	.byte	0x45
+	.byte	0x1c
+	.long	0x73a
+	.uleb128 0x24
+	.long	.LASF2792
+	.byte	0x15
+	.byte	0x46
+	.byte	0x8
+	.long	0x7dd
+	.uleb128 0x24
+	.long	.LASF2793
+	.byte	0x15
+	.byte	0x47
+	.byte	0xc
+	.long	0xa5
+	.byte	0
+	.uleb128 0xe
+	.long	0xba
+	.long	0x7ed
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x27
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2794
+	.byte	0x15
+	.byte	0x48
+	.byte	0x3
+	.long	0x7b0
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2795
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x810
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x820
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2796
+	.byte	0x11
+	.byte	0x5a
+	.byte	0x3
+	.long	0x4c3
+	.uleb128 0x7
+	.long	.LASF2797
+	.byte	0x10
+	.byte	0x16
+	.byte	0x17
+	.byte	0x10
+	.long	0x87b
+	.uleb128 0x2
+	.long	.LASF2798
+	.byte	0x16
+	.byte	0x18
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2799
+	.byte	0x16
+	.byte	0x1a
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2800
+	.byte	0x16
+	.byte	0x1b
+	.byte	0x14
+	.long	0x111
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2801
+	.byte	0x16
+	.byte	0x1d
+	.byte	0xe
+	.long	0x116
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2802
+	.byte	0x16
+	.byte	0x1f
+	.byte	0xe
+	.long	0x116
+	.byte	0xc
+	.byte	0
+	.uleb128 0xa
+	.long	0x82c
+	.uleb128 0x3
+	.long	.LASF2803
+	.byte	0x16
+	.byte	0x20
+	.byte	0x3
+	.long	0x82c
+	.uleb128 0xa
+	.long	0x880
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x14
+	.byte	0xe
+	.long	0x9b9
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2849
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2851
+	.byte	0x18
+	.byte	0x31
+	.byte	0x12
+	.long	0x116
+	.uleb128 0x2f
+	.long	0x9b9
+	.uleb128 0x4
+	.long	0x17f
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x19
+	.byte	0x40
+	.byte	0xe
+	.long	0xa01
+	.uleb128 0x1
+	.long	.LASF2852
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2853
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2854
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x5
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x28
+	.byte	0x19
+	.byte	0x84
+	.byte	0x9
+	.long	0xa65
+	.uleb128 0x10
+	.string	"ccr"
+	.byte	0x19
+	.byte	0x85
+	.byte	0x18
+	.long	0xa65
+	.byte	0
+	.uleb128 0x10
+	.string	"tim"
+	.byte	0x19
+	.byte	0x86
+	.byte	0x12
+	.long	0x9ca
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2858
+	.byte	0x19
+	.byte	0x87
+	.byte	0xb
+	.long	0x14e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2859
+	.byte	0x19
+	.byte	0x88
+	.byte	0xb
+	.long	0x14e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2860
+	.byte	0x19
+	.byte	0x89
+	.byte	0x9
+	.long	0x1ae
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2861
+	.byte	0x19
+	.byte	0x8a
+	.byte	0x9
+	.long	0x1ae
+	.byte	0x19
+	.uleb128 0x10
+	.string	"io"
+	.byte	0x19
+	.byte	0x8b
+	.byte	0xa
+	.long	0x380
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x9c5
+	.uleb128 0x3
+	.long	.LASF2862
+	.byte	0x19
+	.byte	0x8c
+	.byte	0x3
+	.long	0xa01
+	.uleb128 0x7
+	.long	.LASF2863
+	.byte	0x12
+	.byte	0x19
+	.byte	0x8e
+	.byte	0x10
+	.long	0xac5
+	.uleb128 0x2
+	.long	.LASF2864
+	.byte	0x19
+	.byte	0x8f
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2865
+	.byte	0x19
+	.byte	0x90
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2866
+	.byte	0x19
+	.byte	0x91
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2867
+	.byte	0x19
+	.byte	0x92
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2868
+	.byte	0x19
+	.byte	0x93
+	.byte	0xd
+	.long	0xac5
+	.byte	0x5
+	.byte	0
+	.uleb128 0xe
+	.long	0x374
+	.long	0xad5
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2869
+	.byte	0x19
+	.byte	0x94
+	.byte	0x3
+	.long	0xa76
+	.uleb128 0x2a
+	.long	.LASF2870
+	.byte	0x7
+	.long	0x30
+	.byte	0x1a
+	.byte	0x17
+	.long	0xb04
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2870
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0x3
+	.long	0xae1
+	.uleb128 0x2a
+	.long	.LASF2874
+	.byte	0x7
+	.long	0x30
+	.byte	0x1a
+	.byte	0x1d
+	.long	0xb5d
+	.uleb128 0x1
+	.long	.LASF2875
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2876
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2874
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x3
+	.long	0xb10
+	.uleb128 0x3
+	.long	.LASF2885
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x10
+	.long	0xb75
+	.uleb128 0x4
+	.long	0xb7a
+	.uleb128 0x1a
+	.long	0xb85
+	.uleb128 0x5
+	.long	0x105
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2886
+	.byte	0x48
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x10
+	.long	0xc49
+	.uleb128 0x2
+	.long	.LASF2887
+	.byte	0x1a
+	.byte	0x36
+	.byte	0x24
+	.long	0xcde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2888
+	.byte	0x1a
+	.byte	0x38
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2889
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x10
+	.long	0xb04
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2890
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0x13
+	.long	0xb5d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2891
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0xe
+	.long	0x116
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2892
+	.byte	0x1a
+	.byte	0x3e
+	.byte	0xe
+	.long	0x116
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2893
+	.byte	0x1a
+	.byte	0x3f
+	.byte	0xe
+	.long	0x116
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2894
+	.byte	0x1a
+	.byte	0x40
+	.byte	0x17
+	.long	0xce3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2895
+	.byte	0x1a
+	.byte	0x41
+	.byte	0x17
+	.long	0xce3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2896
+	.byte	0x1a
+	.byte	0x42
+	.byte	0xe
+	.long	0x116
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2897
+	.byte	0x1a
+	.byte	0x43
+	.byte	0xe
+	.long	0x116
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2898
+	.byte	0x1a
+	.byte	0x44
+	.byte	0xe
+	.long	0x116
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2899
+	.byte	0x1a
+	.byte	0x45
+	.byte	0xe
+	.long	0x116
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2900
+	.byte	0x1a
+	.byte	0x47
+	.byte	0x1e
+	.long	0xb69
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2901
+	.byte	0x50
+	.byte	0x1a
+	.byte	0x5c
+	.byte	0x8
+	.long	0xcd9
+	.uleb128 0x2
+	.long	.LASF2902
+	.byte	0x1a
+	.byte	0x5d
+	.byte	0xc
+	.long	0xd0e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2903
+	.byte	0x1a
+	.byte	0x5f
+	.byte	0x10
+	.long	0xd27
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2904
+	.byte	0x1a
+	.byte	0x60
+	.byte	0x10
+	.long	0xd27
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2905
+	.byte	0x1a
+	.byte	0x62
+	.byte	0xf
+	.long	0xd3b
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2906
+	.byte	0x1a
+	.byte	0x65
+	.byte	0xc
+	.long	0xd50
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2907
+	.byte	0x1a
+	.byte	0x67
+	.byte	0xb
+	.long	0xd64
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2908
+	.byte	0x1a
+	.byte	0x69
+	.byte	0xc
+	.long	0xd79
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2909
+	.byte	0x1a
+	.byte	0x6b
+	.byte	0xc
+	.long	0xd99
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2910
+	.byte	0x1a
+	.byte	0x6d
+	.byte	0xc
+	.long	0xda9
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2911
+	.byte	0x1a
+	.byte	0x6e
+	.byte	0xc
+	.long	0xda9
+	.byte	0x48
+	.byte	0
+	.uleb128 0xa
+	.long	0xc49
+	.uleb128 0x4
+	.long	0xcd9
+	.uleb128 0x4
+	.long	0x100
+	.uleb128 0x3
+	.long	.LASF2912
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x3
+	.long	0xb85
+	.uleb128 0xa
+	.long	0xce8
+	.uleb128 0x1a
+	.long	0xd09
+	.uleb128 0x5
+	.long	0xd09
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x4
+	.long	0xce8
+	.uleb128 0x4
+	.long	0xcf9
+	.uleb128 0x20
+	.long	0x116
+	.long	0xd22
+	.uleb128 0x5
+	.long	0xd22
+	.byte	0
+	.uleb128 0x4
+	.long	0xcf4
+	.uleb128 0x4
+	.long	0xd13
+	.uleb128 0x20
+	.long	0xef
+	.long	0xd3b
+	.uleb128 0x5
+	.long	0xd09
+	.byte	0
+	.uleb128 0x4
+	.long	0xd2c
+	.uleb128 0x1a
+	.long	0xd50
+	.uleb128 0x5
+	.long	0xd09
+	.uleb128 0x5
+	.long	0x116
+	.byte	0
+	.uleb128 0x4
+	.long	0xd40
+	.uleb128 0x20
+	.long	0x1ae
+	.long	0xd64
+	.uleb128 0x5
+	.long	0xd22
+	.byte	0
+	.uleb128 0x4
+	.long	0xd55
+	.uleb128 0x1a
+	.long	0xd79
+	.uleb128 0x5
+	.long	0xd09
+	.uleb128 0x5
+	.long	0xb04
+	.byte	0
+	.uleb128 0x4
+	.long	0xd69
+	.uleb128 0x1a
+	.long	0xd93
+	.uleb128 0x5
+	.long	0xd09
+	.uleb128 0x5
+	.long	0xd93
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0xd98
+	.uleb128 0x3a
+	.uleb128 0x4
+	.long	0xd7e
+	.uleb128 0x1a
+	.long	0xda9
+	.uleb128 0x5
+	.long	0xd09
+	.byte	0
+	.uleb128 0x4
+	.long	0xd9e
+	.uleb128 0x4
+	.long	0x105
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1b
+	.byte	0x22
+	.byte	0xe
+	.long	0xe91
+	.uleb128 0x1
+	.long	.LASF2913
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2914
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2915
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2916
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2917
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2918
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2919
+	.byte	0x80
+	.uleb128 0x19
+	.long	.LASF2920
+	.value	0x100
+	.uleb128 0x19
+	.long	.LASF2921
+	.value	0x200
+	.uleb128 0x19
+	.long	.LASF2922
+	.value	0x400
+	.uleb128 0x19
+	.long	.LASF2923
+	.value	0x1000
+	.uleb128 0x19
+	.long	.LASF2924
+	.value	0x2000
+	.uleb128 0x19
+	.long	.LASF2925
+	.value	0x4000
+	.uleb128 0x19
+	.long	.LASF2926
+	.value	0x8000
+	.uleb128 0x17
+	.long	.LASF2927
+	.long	0x10000
+	.uleb128 0x17
+	.long	.LASF2928
+	.long	0x20000
+	.uleb128 0x17
+	.long	.LASF2929
+	.long	0x40000
+	.uleb128 0x17
+	.long	.LASF2930
+	.long	0x80000
+	.uleb128 0x17
+	.long	.LASF2931
+	.long	0x100000
+	.uleb128 0x17
+	.long	.LASF2932
+	.long	0x200000
+	.uleb128 0x17
+	.long	.LASF2933
+	.long	0x400000
+	.uleb128 0x17
+	.long	.LASF2934
+	.long	0x800000
+	.uleb128 0x17
+	.long	.LASF2935
+	.long	0x2000000
+	.uleb128 0x17
+	.long	.LASF2936
+	.long	0x4000000
+	.uleb128 0x17
+	.long	.LASF2937
+	.long	0x8000000
+	.uleb128 0x17
+	.long	.LASF2938
+	.long	0x10000000
+	.uleb128 0x17
+	.long	.LASF2939
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2940
+	.byte	0x15
+	.byte	0x1b
+	.byte	0x46
+	.byte	0x10
+	.long	0xee0
+	.uleb128 0x2
+	.long	.LASF2941
+	.byte	0x1b
+	.byte	0x47
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2942
+	.byte	0x1b
+	.byte	0x48
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2943
+	.byte	0x1b
+	.byte	0x49
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2944
+	.byte	0x1b
+	.byte	0x4a
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2945
+	.byte	0x1b
+	.byte	0x4e
+	.byte	0xa
+	.long	0xee0
+	.byte	0x4
+	.byte	0
+	.uleb128 0xe
+	.long	0xba
+	.long	0xef0
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2946
+	.byte	0x1b
+	.byte	0x4f
+	.byte	0x3
+	.long	0xe91
+	.uleb128 0xa
+	.long	0xef0
+	.uleb128 0x6
+	.long	.LASF2947
+	.byte	0x1b
+	.byte	0x59
+	.byte	0x17
+	.long	0xef0
+	.uleb128 0x7
+	.long	.LASF2948
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0x4a
+	.byte	0x10
+	.long	0x1087
+	.uleb128 0x10
+	.string	"pid"
+	.byte	0x1c
+	.byte	0x4b
+	.byte	0xc
+	.long	0x1a12
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2949
+	.byte	0x1c
+	.byte	0x4d
+	.byte	0xd
+	.long	0xef
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2950
+	.byte	0x1c
+	.byte	0x4e
+	.byte	0xe
+	.long	0x105
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2951
+	.byte	0x1c
+	.byte	0x4f
+	.byte	0xe
+	.long	0x105
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2952
+	.byte	0x1c
+	.byte	0x50
+	.byte	0xe
+	.long	0x105
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2953
+	.byte	0x1c
+	.byte	0x51
+	.byte	0xe
+	.long	0x105
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2954
+	.byte	0x1c
+	.byte	0x52
+	.byte	0xd
+	.long	0xef
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2955
+	.byte	0x1c
+	.byte	0x53
+	.byte	0xe
+	.long	0x105
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2956
+	.byte	0x1c
+	.byte	0x54
+	.byte	0xe
+	.long	0x105
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2957
+	.byte	0x1c
+	.byte	0x55
+	.byte	0xd
+	.long	0xef
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2958
+	.byte	0x1c
+	.byte	0x56
+	.byte	0xd
+	.long	0xef
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2959
+	.byte	0x1c
+	.byte	0x57
+	.byte	0xd
+	.long	0xef
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2960
+	.byte	0x1c
+	.byte	0x58
+	.byte	0xd
+	.long	0xef
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2961
+	.byte	0x1c
+	.byte	0x59
+	.byte	0xd
+	.long	0xef
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2962
+	.byte	0x1c
+	.byte	0x5b
+	.byte	0xd
+	.long	0xef
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2963
+	.byte	0x1c
+	.byte	0x5c
+	.byte	0xd
+	.long	0xef
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2964
+	.byte	0x1c
+	.byte	0x5f
+	.byte	0xe
+	.long	0x105
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2965
+	.byte	0x1c
+	.byte	0x60
+	.byte	0xe
+	.long	0x105
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2966
+	.byte	0x1c
+	.byte	0x61
+	.byte	0xd
+	.long	0xef
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2967
+	.byte	0x1c
+	.byte	0x62
+	.byte	0xd
+	.long	0xef
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2968
+	.byte	0x1c
+	.byte	0x63
+	.byte	0xe
+	.long	0x105
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2969
+	.byte	0x1c
+	.byte	0x64
+	.byte	0xe
+	.long	0x105
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2970
+	.byte	0x1c
+	.byte	0x65
+	.byte	0xe
+	.long	0x105
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2971
+	.byte	0x1c
+	.byte	0x66
+	.byte	0xe
+	.long	0x105
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2972
+	.byte	0x1c
+	.byte	0x67
+	.byte	0xe
+	.long	0x105
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2973
+	.byte	0x1c
+	.byte	0x68
+	.byte	0xd
+	.long	0xef
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2974
+	.byte	0x1c
+	.byte	0x69
+	.byte	0xd
+	.long	0xef
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2975
+	.byte	0x1c
+	.byte	0x6a
+	.byte	0x18
+	.long	0x19cb
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2976
+	.byte	0x1b
+	.byte	0x63
+	.byte	0x1d
+	.long	0x1093
+	.uleb128 0x4
+	.long	0xf0d
+	.uleb128 0x7
+	.long	.LASF2977
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x19
+	.byte	0x10
+	.long	0x111b
+	.uleb128 0x2
+	.long	.LASF2978
+	.byte	0x1d
+	.byte	0x1a
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2979
+	.byte	0x1d
+	.byte	0x1b
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2980
+	.byte	0x1d
+	.byte	0x1c
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2981
+	.byte	0x1d
+	.byte	0x1d
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2982
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2983
+	.byte	0x1d
+	.byte	0x1f
+	.byte	0xd
+	.long	0x2f5
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2984
+	.byte	0x1d
+	.byte	0x20
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2985
+	.byte	0x1d
+	.byte	0x21
+	.byte	0xd
+	.long	0xef
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2986
+	.byte	0x1d
+	.byte	0x22
+	.byte	0xe
+	.long	0x105
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2987
+	.byte	0x1d
+	.byte	0x23
+	.byte	0x3
+	.long	0x1098
+	.uleb128 0x6
+	.long	.LASF2988
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x1d
+	.long	0x1133
+	.uleb128 0x4
+	.long	0x111b
+	.uleb128 0x6
+	.long	.LASF2989
+	.byte	0x1e
+	.byte	0x18
+	.byte	0x10
+	.long	0xd7
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x8d
+	.byte	0x1f
+	.byte	0x17
+	.byte	0xe
+	.long	0x116a
+	.uleb128 0x1
+	.long	.LASF2990
+	.byte	0x1
+	.uleb128 0x2b
+	.long	.LASF2991
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2992
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2993
+	.sleb128 -2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2994
+	.byte	0x1f
+	.byte	0x1c
+	.byte	0x3
+	.long	0x1144
+	.uleb128 0x7
+	.long	.LASF2995
+	.byte	0x18
+	.byte	0x1f
+	.byte	0x23
+	.byte	0x10
+	.long	0x11b8
+	.uleb128 0x10
+	.string	"buf"
+	.byte	0x1f
+	.byte	0x24
+	.byte	0xc
+	.long	0x368
+	.byte	0
+	.uleb128 0x10
+	.string	"cmd"
+	.byte	0x1f
+	.byte	0x25
+	.byte	0xe
+	.long	0x105
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2996
+	.byte	0x1f
+	.byte	0x26
+	.byte	0xd
+	.long	0xd7
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2997
+	.byte	0x1f
+	.byte	0x27
+	.byte	0xd
+	.long	0xef
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2998
+	.byte	0x1f
+	.byte	0x28
+	.byte	0x3
+	.long	0x1176
+	.uleb128 0x3
+	.long	.LASF2999
+	.byte	0x1f
+	.byte	0x2b
+	.byte	0x10
+	.long	0x11d0
+	.uleb128 0x4
+	.long	0x11d5
+	.uleb128 0x1a
+	.long	0x11e0
+	.uleb128 0x5
+	.long	0x11e0
+	.byte	0
+	.uleb128 0x4
+	.long	0xb85
+	.uleb128 0x4
+	.long	0x11b8
+	.uleb128 0x4
+	.long	0x11c4
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x20
+	.byte	0x18
+	.byte	0xe
+	.long	0x12e1
+	.uleb128 0x1
+	.long	.LASF3000
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3001
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3002
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3003
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3004
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3005
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3006
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3007
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3008
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3009
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3010
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3011
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3012
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3013
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3014
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3015
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3016
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3017
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3018
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3019
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3020
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3021
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3022
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3023
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3024
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3025
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3026
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3027
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3028
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3029
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3030
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3031
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3032
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3033
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3034
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3035
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3036
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3037
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3038
+	.byte	0x20
+	.byte	0x3f
+	.byte	0x3
+	.long	0x11ef
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x20
+	.byte	0x42
+	.byte	0x9
+	.long	0x1304
+	.uleb128 0x2
+	.long	.LASF3039
+	.byte	0x20
+	.byte	0x42
+	.byte	0x1b
+	.long	0x1304
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x116
+	.long	0x1314
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3040
+	.byte	0x20
+	.byte	0x42
+	.byte	0x44
+	.long	0x12ed
+	.uleb128 0x7
+	.long	.LASF3041
+	.byte	0x2
+	.byte	0x20
+	.byte	0x53
+	.byte	0x10
+	.long	0x1348
+	.uleb128 0x2
+	.long	.LASF3042
+	.byte	0x20
+	.byte	0x54
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3043
+	.byte	0x20
+	.byte	0x55
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3044
+	.byte	0x20
+	.byte	0x56
+	.byte	0x3
+	.long	0x1320
+	.uleb128 0x7
+	.long	.LASF3045
+	.byte	0x8
+	.byte	0x20
+	.byte	0x58
+	.byte	0x10
+	.long	0x1389
+	.uleb128 0x2
+	.long	.LASF3046
+	.byte	0x20
+	.byte	0x59
+	.byte	0xd
+	.long	0x12e1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3047
+	.byte	0x20
+	.byte	0x5a
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3048
+	.byte	0x20
+	.byte	0x5b
+	.byte	0x14
+	.long	0x1348
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3049
+	.byte	0x20
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1354
+	.uleb128 0xa
+	.long	0x1389
+	.uleb128 0xe
+	.long	0x1389
+	.long	0x13aa
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x13
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3050
+	.byte	0x20
+	.byte	0x5e
+	.byte	0x22
+	.long	0x139a
+	.uleb128 0x7
+	.long	.LASF3051
+	.byte	0x18
+	.byte	0x21
+	.byte	0x17
+	.byte	0x10
+	.long	0x13eb
+	.uleb128 0x2
+	.long	.LASF3052
+	.byte	0x21
+	.byte	0x18
+	.byte	0x13
+	.long	0xfb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3053
+	.byte	0x21
+	.byte	0x19
+	.byte	0x11
+	.long	0x144
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3054
+	.byte	0x21
+	.byte	0x1a
+	.byte	0x13
+	.long	0xfb
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3055
+	.byte	0x21
+	.byte	0x1b
+	.byte	0x3
+	.long	0x13b6
+	.uleb128 0xa
+	.long	0x13eb
+	.uleb128 0x7
+	.long	.LASF3056
+	.byte	0x6
+	.byte	0x22
+	.byte	0x46
+	.byte	0x10
+	.long	0x144b
+	.uleb128 0x2
+	.long	.LASF3047
+	.byte	0x22
+	.byte	0x48
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3048
+	.byte	0x22
+	.byte	0x49
+	.byte	0x14
+	.long	0x1348
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3057
+	.byte	0x22
+	.byte	0x4c
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3058
+	.byte	0x22
+	.byte	0x4d
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3059
+	.byte	0x22
+	.byte	0x50
+	.byte	0xd
+	.long	0xef
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3060
+	.byte	0x22
+	.byte	0x51
+	.byte	0x3
+	.long	0x13fc
+	.uleb128 0xa
+	.long	0x144b
+	.uleb128 0xe
+	.long	0x144b
+	.long	0x146c
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xe
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3061
+	.byte	0x22
+	.byte	0x62
+	.byte	0x1a
+	.long	0x145c
+	.uleb128 0x7
+	.long	.LASF3062
+	.byte	0x5
+	.byte	0x23
+	.byte	0x51
+	.byte	0x10
+	.long	0x14c7
+	.uleb128 0x2
+	.long	.LASF3063
+	.byte	0x23
+	.byte	0x52
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3064
+	.byte	0x23
+	.byte	0x53
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3065
+	.byte	0x23
+	.byte	0x54
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3066
+	.byte	0x23
+	.byte	0x55
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3067
+	.byte	0x23
+	.byte	0x56
+	.byte	0x9
+	.long	0x1ae
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3068
+	.byte	0x23
+	.byte	0x57
+	.byte	0x3
+	.long	0x1478
+	.uleb128 0xa
+	.long	0x14c7
+	.uleb128 0x6
+	.long	.LASF3069
+	.byte	0x23
+	.byte	0x59
+	.byte	0x1b
+	.long	0x14c7
+	.uleb128 0x7
+	.long	.LASF3070
+	.byte	0x8
+	.byte	0x23
+	.byte	0x5b
+	.byte	0x10
+	.long	0x1526
+	.uleb128 0x2
+	.long	.LASF3071
+	.byte	0x23
+	.byte	0x5c
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3072
+	.byte	0x23
+	.byte	0x5d
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3073
+	.byte	0x23
+	.byte	0x5e
+	.byte	0xe
+	.long	0x105
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3074
+	.byte	0x23
+	.byte	0x5f
+	.byte	0xe
+	.long	0x105
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3075
+	.byte	0x23
+	.byte	0x60
+	.byte	0x3
+	.long	0x14e4
+	.uleb128 0xa
+	.long	0x1526
+	.uleb128 0x6
+	.long	.LASF3076
+	.byte	0x23
+	.byte	0x62
+	.byte	0x19
+	.long	0x1526
+	.uleb128 0x7
+	.long	.LASF3077
+	.byte	0x3
+	.byte	0x23
+	.byte	0x64
+	.byte	0x10
+	.long	0x1578
+	.uleb128 0x2
+	.long	.LASF3078
+	.byte	0x23
+	.byte	0x65
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3079
+	.byte	0x23
+	.byte	0x66
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3080
+	.byte	0x23
+	.byte	0x67
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3081
+	.byte	0x23
+	.byte	0x68
+	.byte	0x3
+	.long	0x1543
+	.uleb128 0xa
+	.long	0x1578
+	.uleb128 0x6
+	.long	.LASF3082
+	.byte	0x23
+	.byte	0x6a
+	.byte	0x17
+	.long	0x1578
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x24
+	.byte	0x15
+	.byte	0xe
+	.long	0x15af
+	.uleb128 0x1
+	.long	.LASF3083
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3084
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3085
+	.byte	0x24
+	.byte	0x1a
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x24
+	.byte	0x3c
+	.byte	0xe
+	.long	0x160e
+	.uleb128 0x1
+	.long	.LASF3086
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3087
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3088
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3089
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3090
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3091
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3092
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3093
+	.byte	0x80
+	.uleb128 0x19
+	.long	.LASF3094
+	.value	0x100
+	.uleb128 0x19
+	.long	.LASF3095
+	.value	0x200
+	.uleb128 0x19
+	.long	.LASF3096
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3097
+	.byte	0x24
+	.byte	0x48
+	.byte	0x3
+	.long	0x15bb
+	.uleb128 0x6
+	.long	.LASF3098
+	.byte	0x24
+	.byte	0x4a
+	.byte	0x11
+	.long	0x105
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x24
+	.byte	0x58
+	.byte	0xe
+	.long	0x1652
+	.uleb128 0x1
+	.long	.LASF3099
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3100
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3101
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3102
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3103
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3104
+	.byte	0x24
+	.byte	0x64
+	.byte	0x10
+	.long	0xef
+	.uleb128 0x6
+	.long	.LASF3105
+	.byte	0x25
+	.byte	0x16
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x7
+	.long	.LASF3106
+	.byte	0xa
+	.byte	0x26
+	.byte	0x20
+	.byte	0x10
+	.long	0x16c6
+	.uleb128 0x2
+	.long	.LASF3107
+	.byte	0x26
+	.byte	0x21
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3108
+	.byte	0x26
+	.byte	0x22
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3109
+	.byte	0x26
+	.byte	0x23
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3110
+	.byte	0x26
+	.byte	0x24
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3111
+	.byte	0x26
+	.byte	0x25
+	.byte	0xe
+	.long	0x105
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3112
+	.byte	0x26
+	.byte	0x26
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3113
+	.byte	0x26
+	.byte	0x27
+	.byte	0x3
+	.long	0x166a
+	.uleb128 0xa
+	.long	0x16c6
+	.uleb128 0x6
+	.long	.LASF3114
+	.byte	0x26
+	.byte	0x29
+	.byte	0x19
+	.long	0x16c6
+	.uleb128 0x1f
+	.byte	0x6
+	.byte	0x27
+	.byte	0x22
+	.byte	0x5
+	.long	0x1714
+	.uleb128 0x2
+	.long	.LASF3115
+	.byte	0x27
+	.byte	0x24
+	.byte	0x11
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3116
+	.byte	0x27
+	.byte	0x25
+	.byte	0x11
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x10
+	.string	"yaw"
+	.byte	0x27
+	.byte	0x26
+	.byte	0x11
+	.long	0xd7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x27
+	.byte	0x20
+	.long	0x1735
+	.uleb128 0x25
+	.string	"raw"
+	.byte	0x27
+	.byte	0x21
+	.byte	0xd
+	.long	0x800
+	.uleb128 0x24
+	.long	.LASF3117
+	.byte	0x27
+	.byte	0x27
+	.byte	0x7
+	.long	0x16e3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3118
+	.byte	0x27
+	.byte	0x28
+	.byte	0x3
+	.long	0x1714
+	.uleb128 0x6
+	.long	.LASF3119
+	.byte	0x27
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x1735
+	.uleb128 0x2a
+	.long	.LASF3120
+	.byte	0x7
+	.long	0x30
+	.byte	0x28
+	.byte	0x24
+	.long	0x17fa
+	.uleb128 0x1
+	.long	.LASF3121
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3122
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3123
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3124
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3125
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3126
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3128
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3129
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3130
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3131
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3132
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3133
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3134
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3135
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3136
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3137
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3138
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3139
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3140
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3141
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3142
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3143
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3144
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3145
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3146
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3147
+	.byte	0x2
+	.byte	0x28
+	.byte	0x53
+	.byte	0x10
+	.long	0x1822
+	.uleb128 0x2
+	.long	.LASF3120
+	.byte	0x28
+	.byte	0x54
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3148
+	.byte	0x28
+	.byte	0x55
+	.byte	0x9
+	.long	0x1ae
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3149
+	.byte	0x28
+	.byte	0x56
+	.byte	0x3
+	.long	0x17fa
+	.uleb128 0xa
+	.long	0x1822
+	.uleb128 0x6
+	.long	.LASF3150
+	.byte	0x28
+	.byte	0x58
+	.byte	0x16
+	.long	0x1822
+	.uleb128 0x7
+	.long	.LASF3151
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x5a
+	.byte	0x10
+	.long	0x188e
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x28
+	.byte	0x5b
+	.byte	0x16
+	.long	0xad5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3152
+	.byte	0x28
+	.byte	0x5c
+	.byte	0xe
+	.long	0x105
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3153
+	.byte	0x28
+	.byte	0x5d
+	.byte	0xe
+	.long	0x105
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3154
+	.byte	0x28
+	.byte	0x5e
+	.byte	0xe
+	.long	0x105
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3155
+	.byte	0x28
+	.byte	0x5f
+	.byte	0xe
+	.long	0x105
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3156
+	.byte	0x28
+	.byte	0x60
+	.byte	0x3
+	.long	0x183f
+	.uleb128 0xa
+	.long	0x188e
+	.uleb128 0x6
+	.long	.LASF3157
+	.byte	0x28
+	.byte	0x62
+	.byte	0x16
+	.long	0x188e
+	.uleb128 0xe
+	.long	0x14e
+	.long	0x18bb
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3158
+	.byte	0x28
+	.byte	0x69
+	.byte	0xe
+	.long	0x18ab
+	.uleb128 0x6
+	.long	.LASF3159
+	.byte	0x28
+	.byte	0x6a
+	.byte	0xe
+	.long	0x18ab
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x29
+	.byte	0x17
+	.byte	0xe
+	.long	0x18f3
+	.uleb128 0x1
+	.long	.LASF3160
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3161
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3162
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3163
+	.byte	0x29
+	.byte	0x1b
+	.byte	0x3
+	.long	0x18d3
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x190f
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x1
+	.byte	0
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x191f
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3164
+	.byte	0x29
+	.byte	0x2d
+	.byte	0x10
+	.long	0x190f
+	.uleb128 0x6
+	.long	.LASF3165
+	.byte	0x29
+	.byte	0x2e
+	.byte	0x10
+	.long	0x190f
+	.uleb128 0x6
+	.long	.LASF3166
+	.byte	0x29
+	.byte	0x30
+	.byte	0x11
+	.long	0x105
+	.uleb128 0x6
+	.long	.LASF3167
+	.byte	0x29
+	.byte	0x31
+	.byte	0x10
+	.long	0xd7
+	.uleb128 0x6
+	.long	.LASF3168
+	.byte	0x29
+	.byte	0x33
+	.byte	0x19
+	.long	0x18f3
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1c
+	.byte	0x25
+	.byte	0xe
+	.long	0x19ab
+	.uleb128 0x1
+	.long	.LASF3169
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3170
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3171
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3172
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3173
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3174
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3175
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3176
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3177
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3178
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3179
+	.byte	0xa
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1c
+	.byte	0x3e
+	.byte	0xe
+	.long	0x19cb
+	.uleb128 0x1
+	.long	.LASF3180
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3181
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3182
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3183
+	.byte	0x1c
+	.byte	0x42
+	.byte	0x3
+	.long	0x19ab
+	.uleb128 0x7
+	.long	.LASF3184
+	.byte	0x3
+	.byte	0x1c
+	.byte	0x44
+	.byte	0x10
+	.long	0x1a06
+	.uleb128 0x10
+	.string	"P"
+	.byte	0x1c
+	.byte	0x45
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x10
+	.string	"I"
+	.byte	0x1c
+	.byte	0x46
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x10
+	.string	"D"
+	.byte	0x1c
+	.byte	0x47
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3185
+	.byte	0x1c
+	.byte	0x48
+	.byte	0x3
+	.long	0x19d7
+	.uleb128 0xe
+	.long	0x1a06
+	.long	0x1a22
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3186
+	.byte	0x1c
+	.byte	0x6b
+	.byte	0x3
+	.long	0xf0d
+	.uleb128 0xa
+	.long	0x1a22
+	.uleb128 0x7
+	.long	.LASF3187
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x6f
+	.byte	0x10
+	.long	0x1a4e
+	.uleb128 0x2
+	.long	.LASF3188
+	.byte	0x1c
+	.byte	0x70
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3189
+	.byte	0x1c
+	.byte	0x71
+	.byte	0x3
+	.long	0x1a33
+	.uleb128 0xa
+	.long	0x1a4e
+	.uleb128 0x6
+	.long	.LASF3190
+	.byte	0x1c
+	.byte	0x73
+	.byte	0x14
+	.long	0x1a4e
+	.uleb128 0x23
+	.long	.LASF3192
+	.byte	0x1c
+	.byte	0x79
+	.byte	0x5
+	.long	0x1ae
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2a
+	.byte	0x19
+	.byte	0x6
+	.long	0x1adf
+	.uleb128 0x1
+	.long	.LASF3193
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3194
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3195
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3196
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3197
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3198
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3199
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3200
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3201
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3202
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3203
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3204
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3205
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3206
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3207
+	.byte	0xe
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3208
+	.byte	0x2a
+	.byte	0x29
+	.byte	0x3
+	.long	0x1a77
+	.uleb128 0x7
+	.long	.LASF3209
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x4e
+	.byte	0x10
+	.long	0x1b54
+	.uleb128 0x2
+	.long	.LASF3210
+	.byte	0x2a
+	.byte	0x4f
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3211
+	.byte	0x2a
+	.byte	0x50
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3212
+	.byte	0x2a
+	.byte	0x51
+	.byte	0xc
+	.long	0xc6
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3213
+	.byte	0x2a
+	.byte	0x52
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x10
+	.string	"min"
+	.byte	0x2a
+	.byte	0x53
+	.byte	0xc
+	.long	0xc6
+	.byte	0x4
+	.uleb128 0x10
+	.string	"max"
+	.byte	0x2a
+	.byte	0x54
+	.byte	0xc
+	.long	0xc6
+	.byte	0x5
+	.uleb128 0x10
+	.string	"box"
+	.byte	0x2a
+	.byte	0x55
+	.byte	0xd
+	.long	0xef
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3214
+	.byte	0x2a
+	.byte	0x56
+	.byte	0x3
+	.long	0x1aeb
+	.uleb128 0xa
+	.long	0x1b54
+	.uleb128 0xe
+	.long	0x1b54
+	.long	0x1b75
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3215
+	.byte	0x2a
+	.byte	0x5c
+	.byte	0x15
+	.long	0x1b65
+	.uleb128 0x4
+	.long	0x1b60
+	.uleb128 0x7
+	.long	.LASF3216
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x66
+	.byte	0x10
+	.long	0x1be2
+	.uleb128 0x2
+	.long	.LASF3217
+	.byte	0x2a
+	.byte	0x67
+	.byte	0xe
+	.long	0x116
+	.byte	0
+	.uleb128 0x10
+	.string	"min"
+	.byte	0x2a
+	.byte	0x68
+	.byte	0xd
+	.long	0xd7
+	.byte	0x4
+	.uleb128 0x10
+	.string	"max"
+	.byte	0x2a
+	.byte	0x69
+	.byte	0xd
+	.long	0xd7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3218
+	.byte	0x2a
+	.byte	0x6a
+	.byte	0xd
+	.long	0xd7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3212
+	.byte	0x2a
+	.byte	0x6b
+	.byte	0xc
+	.long	0xc6
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3219
+	.byte	0x2a
+	.byte	0x6c
+	.byte	0xc
+	.long	0xc6
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3220
+	.byte	0x2a
+	.byte	0x6d
+	.byte	0x3
+	.long	0x1b86
+	.uleb128 0xa
+	.long	0x1be2
+	.uleb128 0xe
+	.long	0x1be2
+	.long	0x1c03
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3221
+	.byte	0x2a
+	.byte	0x6f
+	.byte	0x15
+	.long	0x1bf3
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x1c1f
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3222
+	.byte	0x2a
+	.byte	0x7e
+	.byte	0x10
+	.long	0x1c0f
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2b
+	.byte	0x1d
+	.byte	0xe
+	.long	0x1c45
+	.uleb128 0x1
+	.long	.LASF3223
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3224
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3225
+	.byte	0x2b
+	.byte	0x20
+	.byte	0x3
+	.long	0x1c2b
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2b
+	.byte	0x22
+	.byte	0xe
+	.long	0x1c7d
+	.uleb128 0x1
+	.long	.LASF3226
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3227
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3228
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3229
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3230
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3231
+	.byte	0x2b
+	.byte	0x28
+	.byte	0x3
+	.long	0x1c51
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2b
+	.byte	0x34
+	.byte	0xe
+	.long	0x1ca3
+	.uleb128 0x1
+	.long	.LASF3232
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3233
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3234
+	.byte	0x2b
+	.byte	0x37
+	.byte	0x3
+	.long	0x1c89
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2b
+	.byte	0x39
+	.byte	0xe
+	.long	0x1cc9
+	.uleb128 0x1
+	.long	.LASF3235
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3236
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3237
+	.byte	0x2b
+	.byte	0x3c
+	.byte	0x3
+	.long	0x1caf
+	.uleb128 0x7
+	.long	.LASF3238
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x40
+	.byte	0x10
+	.long	0x1d17
+	.uleb128 0x2
+	.long	.LASF3239
+	.byte	0x2b
+	.byte	0x41
+	.byte	0x13
+	.long	0x1c45
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3240
+	.byte	0x2b
+	.byte	0x42
+	.byte	0x10
+	.long	0x1c7d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3241
+	.byte	0x2b
+	.byte	0x43
+	.byte	0x15
+	.long	0x1ca3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3242
+	.byte	0x2b
+	.byte	0x44
+	.byte	0x13
+	.long	0x1cc9
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3243
+	.byte	0x2b
+	.byte	0x45
+	.byte	0x3
+	.long	0x1cd5
+	.uleb128 0xa
+	.long	0x1d17
+	.uleb128 0x6
+	.long	.LASF3244
+	.byte	0x2b
+	.byte	0x47
+	.byte	0x14
+	.long	0x1d17
+	.uleb128 0x7
+	.long	.LASF3245
+	.byte	0xc
+	.byte	0x2b
+	.byte	0x4f
+	.byte	0x10
+	.long	0x1d69
+	.uleb128 0x10
+	.string	"lat"
+	.byte	0x2b
+	.byte	0x50
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x10
+	.string	"lon"
+	.byte	0x2b
+	.byte	0x51
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x10
+	.string	"alt"
+	.byte	0x2b
+	.byte	0x52
+	.byte	0xe
+	.long	0x105
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3246
+	.byte	0x2b
+	.byte	0x53
+	.byte	0x3
+	.long	0x1d34
+	.uleb128 0x7
+	.long	.LASF3247
+	.byte	0x18
+	.byte	0x2b
+	.byte	0x55
+	.byte	0x10
+	.long	0x1dd1
+	.uleb128 0x2
+	.long	.LASF3248
+	.byte	0x2b
+	.byte	0x56
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x10
+	.string	"llh"
+	.byte	0x2b
+	.byte	0x57
+	.byte	0x13
+	.long	0x1d69
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3249
+	.byte	0x2b
+	.byte	0x58
+	.byte	0xe
+	.long	0x105
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3250
+	.byte	0x2b
+	.byte	0x59
+	.byte	0xe
+	.long	0x105
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3251
+	.byte	0x2b
+	.byte	0x5a
+	.byte	0xe
+	.long	0x105
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3252
+	.byte	0x2b
+	.byte	0x5b
+	.byte	0xe
+	.long	0x105
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3253
+	.byte	0x2b
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1d75
+	.uleb128 0x6
+	.long	.LASF3254
+	.byte	0x2b
+	.byte	0x76
+	.byte	0x1a
+	.long	0x1dd1
+	.uleb128 0x6
+	.long	.LASF3255
+	.byte	0x2b
+	.byte	0x78
+	.byte	0x10
+	.long	0xef
+	.uleb128 0x6
+	.long	.LASF3256
+	.byte	0x2b
+	.byte	0x7b
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xe
+	.long	0xef
+	.long	0x1e11
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3257
+	.byte	0x2b
+	.byte	0x7c
+	.byte	0x10
+	.long	0x1e01
+	.uleb128 0x6
+	.long	.LASF3258
+	.byte	0x2b
+	.byte	0x7d
+	.byte	0x10
+	.long	0x1e01
+	.uleb128 0x6
+	.long	.LASF3259
+	.byte	0x2b
+	.byte	0x7e
+	.byte	0x10
+	.long	0x1e01
+	.uleb128 0x6
+	.long	.LASF3260
+	.byte	0x2b
+	.byte	0x7f
+	.byte	0x10
+	.long	0x1e01
+	.uleb128 0x7
+	.long	.LASF3261
+	.byte	0x6
+	.byte	0x2c
+	.byte	0x7c
+	.byte	0x10
+	.long	0x1e5c
+	.uleb128 0x2
+	.long	.LASF3262
+	.byte	0x2c
+	.byte	0x7d
+	.byte	0xd
+	.long	0x1e5c
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xef
+	.long	0x1e6c
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3263
+	.byte	0x2c
+	.byte	0x7e
+	.byte	0x3
+	.long	0x1e41
+	.uleb128 0xa
+	.long	0x1e6c
+	.uleb128 0x7
+	.long	.LASF3264
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x80
+	.byte	0x10
+	.long	0x1e98
+	.uleb128 0x2
+	.long	.LASF3262
+	.byte	0x2c
+	.byte	0x81
+	.byte	0xd
+	.long	0x1e98
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xef
+	.long	0x1ea8
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3265
+	.byte	0x2c
+	.byte	0x82
+	.byte	0x3
+	.long	0x1e7d
+	.uleb128 0x23
+	.long	.LASF3266
+	.byte	0x2c
+	.byte	0x99
+	.byte	0xd
+	.long	0x1ec0
+	.uleb128 0x4
+	.long	0x334
+	.uleb128 0x23
+	.long	.LASF3267
+	.byte	0x2c
+	.byte	0x9a
+	.byte	0x1b
+	.long	0x1ed1
+	.uleb128 0x4
+	.long	0x1e78
+	.uleb128 0x23
+	.long	.LASF3268
+	.byte	0x2c
+	.byte	0x9b
+	.byte	0x17
+	.long	0x1ea8
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x8d
+	.byte	0x2d
+	.byte	0x48
+	.byte	0xe
+	.long	0x1f38
+	.uleb128 0x2b
+	.long	.LASF3269
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF3270
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3271
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3272
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3273
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3274
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3275
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3276
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3277
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3278
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3279
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3280
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3281
+	.byte	0x2d
+	.byte	0x55
+	.byte	0x3
+	.long	0x1ee2
+	.uleb128 0x7
+	.long	.LASF3282
+	.byte	0xc
+	.byte	0x2d
+	.byte	0x6c
+	.byte	0x10
+	.long	0x1fa0
+	.uleb128 0x2
+	.long	.LASF3283
+	.byte	0x2d
+	.byte	0x6d
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2888
+	.byte	0x2d
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x1f38
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3284
+	.byte	0x2d
+	.byte	0x6f
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3285
+	.byte	0x2d
+	.byte	0x70
+	.byte	0xd
+	.long	0xef
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3286
+	.byte	0x2d
+	.byte	0x71
+	.byte	0xd
+	.long	0xef
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3287
+	.byte	0x2d
+	.byte	0x72
+	.byte	0xd
+	.long	0xef
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3288
+	.byte	0x2d
+	.byte	0x73
+	.byte	0x3
+	.long	0x1f44
+	.uleb128 0x7
+	.long	.LASF3289
+	.byte	0x64
+	.byte	0x2d
+	.byte	0x75
+	.byte	0x10
+	.long	0x1fe1
+	.uleb128 0x2
+	.long	.LASF3290
+	.byte	0x2d
+	.byte	0x76
+	.byte	0x18
+	.long	0x1fe1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3291
+	.byte	0x2d
+	.byte	0x77
+	.byte	0xe
+	.long	0x105
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF3292
+	.byte	0x2d
+	.byte	0x78
+	.byte	0xd
+	.long	0xef
+	.byte	0x62
+	.byte	0
+	.uleb128 0xe
+	.long	0x1fa0
+	.long	0x1ff1
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3293
+	.byte	0x2d
+	.byte	0x79
+	.byte	0x3
+	.long	0x1fac
+	.uleb128 0xa
+	.long	0x1ff1
+	.uleb128 0x6
+	.long	.LASF3294
+	.byte	0x2d
+	.byte	0x7b
+	.byte	0x17
+	.long	0x1ff1
+	.uleb128 0x6
+	.long	.LASF3295
+	.byte	0x2e
+	.byte	0x4b
+	.byte	0x11
+	.long	0x105
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x202a
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3296
+	.byte	0x2e
+	.byte	0x4f
+	.byte	0x10
+	.long	0x201a
+	.uleb128 0x7
+	.long	.LASF3297
+	.byte	0x2
+	.byte	0x2e
+	.byte	0x67
+	.byte	0x10
+	.long	0x205e
+	.uleb128 0x2
+	.long	.LASF2889
+	.byte	0x2e
+	.byte	0x68
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3298
+	.byte	0x2e
+	.byte	0x69
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3299
+	.byte	0x2e
+	.byte	0x6a
+	.byte	0x3
+	.long	0x2036
+	.uleb128 0xa
+	.long	0x205e
+	.uleb128 0xe
+	.long	0x205e
+	.long	0x207f
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3300
+	.byte	0x2e
+	.byte	0x6c
+	.byte	0x22
+	.long	0x206f
+	.uleb128 0x7
+	.long	.LASF3301
+	.byte	0x2c
+	.byte	0x2e
+	.byte	0x75
+	.byte	0x10
+	.long	0x21de
+	.uleb128 0x2
+	.long	.LASF3302
+	.byte	0x2e
+	.byte	0x76
+	.byte	0xd
+	.long	0x21de
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3303
+	.byte	0x2e
+	.byte	0x77
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3304
+	.byte	0x2e
+	.byte	0x78
+	.byte	0xd
+	.long	0xef
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3305
+	.byte	0x2e
+	.byte	0x79
+	.byte	0xd
+	.long	0xef
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3306
+	.byte	0x2e
+	.byte	0x7a
+	.byte	0xd
+	.long	0xef
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3307
+	.byte	0x2e
+	.byte	0x7b
+	.byte	0xe
+	.long	0x116
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3308
+	.byte	0x2e
+	.byte	0x7c
+	.byte	0xd
+	.long	0xef
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3309
+	.byte	0x2e
+	.byte	0x7d
+	.byte	0xd
+	.long	0x374
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3310
+	.byte	0x2e
+	.byte	0x7e
+	.byte	0xd
+	.long	0x374
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3311
+	.byte	0x2e
+	.byte	0x7f
+	.byte	0xd
+	.long	0xef
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF3312
+	.byte	0x2e
+	.byte	0x80
+	.byte	0xd
+	.long	0xef
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3313
+	.byte	0x2e
+	.byte	0x81
+	.byte	0xd
+	.long	0xef
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3314
+	.byte	0x2e
+	.byte	0x82
+	.byte	0xd
+	.long	0xef
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3315
+	.byte	0x2e
+	.byte	0x83
+	.byte	0xd
+	.long	0xef
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF3316
+	.byte	0x2e
+	.byte	0x84
+	.byte	0xe
+	.long	0x105
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3317
+	.byte	0x2e
+	.byte	0x85
+	.byte	0xe
+	.long	0x105
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3318
+	.byte	0x2e
+	.byte	0x86
+	.byte	0xe
+	.long	0x105
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3319
+	.byte	0x2e
+	.byte	0x87
+	.byte	0xd
+	.long	0xef
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3320
+	.byte	0x2e
+	.byte	0x88
+	.byte	0xd
+	.long	0xef
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF3321
+	.byte	0x2e
+	.byte	0x89
+	.byte	0xd
+	.long	0xef
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3322
+	.byte	0x2e
+	.byte	0x8a
+	.byte	0xd
+	.long	0xef
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF3323
+	.byte	0x2e
+	.byte	0x8b
+	.byte	0xd
+	.long	0xef
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3324
+	.byte	0x2e
+	.byte	0x8c
+	.byte	0xe
+	.long	0x105
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF3325
+	.byte	0x2e
+	.byte	0x8e
+	.byte	0xe
+	.long	0x105
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF3326
+	.byte	0x2e
+	.byte	0x8f
+	.byte	0xe
+	.long	0x105
+	.byte	0x28
+	.byte	0
+	.uleb128 0xe
+	.long	0xef
+	.long	0x21ee
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3327
+	.byte	0x2e
+	.byte	0x90
+	.byte	0x3
+	.long	0x208b
+	.uleb128 0xa
+	.long	0x21ee
+	.uleb128 0x6
+	.long	.LASF3328
+	.byte	0x2e
+	.byte	0x92
+	.byte	0x13
+	.long	0x21ee
+	.uleb128 0x3
+	.long	.LASF3329
+	.byte	0x2e
+	.byte	0x95
+	.byte	0x14
+	.long	0x2217
+	.uleb128 0x4
+	.long	0x221c
+	.uleb128 0x20
+	.long	0x105
+	.long	0x2230
+	.uleb128 0x5
+	.long	0x2230
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x4
+	.long	0x2277
+	.uleb128 0x7
+	.long	.LASF3330
+	.byte	0x18
+	.byte	0x2e
+	.byte	0x98
+	.byte	0x10
+	.long	0x2277
+	.uleb128 0x2
+	.long	.LASF3331
+	.byte	0x2e
+	.byte	0x99
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3332
+	.byte	0x2e
+	.byte	0x9a
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3333
+	.byte	0x2e
+	.byte	0x9b
+	.byte	0x18
+	.long	0x220b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3334
+	.byte	0x2e
+	.byte	0x9c
+	.byte	0x18
+	.long	0x227c
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	0x2235
+	.uleb128 0x3
+	.long	.LASF3335
+	.byte	0x2e
+	.byte	0x96
+	.byte	0x13
+	.long	0x2288
+	.uleb128 0x4
+	.long	0x228d
+	.uleb128 0x3b
+	.long	0xef
+	.uleb128 0x3
+	.long	.LASF3336
+	.byte	0x2e
+	.byte	0x9d
+	.byte	0x3
+	.long	0x2235
+	.uleb128 0x6
+	.long	.LASF3337
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x1a
+	.long	0x2292
+	.uleb128 0x1f
+	.byte	0x40
+	.byte	0x2f
+	.byte	0x28
+	.byte	0x9
+	.long	0x22ce
+	.uleb128 0x2
+	.long	.LASF3338
+	.byte	0x2f
+	.byte	0x29
+	.byte	0xe
+	.long	0x22ce
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3339
+	.byte	0x2f
+	.byte	0x2a
+	.byte	0xe
+	.long	0x22ce
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0x105
+	.long	0x22de
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3340
+	.byte	0x2f
+	.byte	0x2b
+	.byte	0x3
+	.long	0x22aa
+	.uleb128 0xa
+	.long	0x22de
+	.uleb128 0x1f
+	.byte	0x38
+	.byte	0x2f
+	.byte	0x2d
+	.byte	0x9
+	.long	0x2395
+	.uleb128 0x2
+	.long	.LASF3341
+	.byte	0x2f
+	.byte	0x2e
+	.byte	0x12
+	.long	0x144
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3342
+	.byte	0x2f
+	.byte	0x2f
+	.byte	0x12
+	.long	0x144
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3343
+	.byte	0x2f
+	.byte	0x30
+	.byte	0x11
+	.long	0x1ae
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3344
+	.byte	0x2f
+	.byte	0x31
+	.byte	0xd
+	.long	0xef
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3345
+	.byte	0x2f
+	.byte	0x32
+	.byte	0x11
+	.long	0x1b5
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3346
+	.byte	0x2f
+	.byte	0x33
+	.byte	0x11
+	.long	0x1b5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3347
+	.byte	0x2f
+	.byte	0x34
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3348
+	.byte	0x2f
+	.byte	0x35
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3349
+	.byte	0x2f
+	.byte	0x36
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF3350
+	.byte	0x2f
+	.byte	0x38
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF3351
+	.byte	0x2f
+	.byte	0x39
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF3352
+	.byte	0x2f
+	.byte	0x3a
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3353
+	.byte	0x2f
+	.byte	0x3c
+	.byte	0x3
+	.long	0x22ef
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2f
+	.byte	0x3e
+	.byte	0xe
+	.long	0x242d
+	.uleb128 0x1
+	.long	.LASF3354
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3355
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3356
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3357
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3358
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3359
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3360
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3361
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3362
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3363
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3364
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3365
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3366
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3367
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3368
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3369
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3370
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3371
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3372
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3373
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3374
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3375
+	.byte	0x2f
+	.byte	0x8f
+	.byte	0x3
+	.long	0x23a1
+	.uleb128 0xa
+	.long	0x242d
+	.uleb128 0x6
+	.long	.LASF3376
+	.byte	0x2f
+	.byte	0xbb
+	.byte	0x11
+	.long	0x105
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x30
+	.byte	0x18
+	.byte	0xe
+	.long	0x2518
+	.uleb128 0x1
+	.long	.LASF3377
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3378
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3379
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3380
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3381
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3382
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3383
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3384
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3385
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3386
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3387
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3388
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3389
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3390
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3391
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3392
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3393
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3394
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3395
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3396
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3397
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3398
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3399
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3400
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3401
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3402
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3403
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3404
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3405
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3406
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF3407
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF3408
+	.byte	0x5b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3409
+	.byte	0x30
+	.byte	0x48
+	.byte	0x3
+	.long	0x244a
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x31
+	.byte	0x17
+	.byte	0xe
+	.long	0x2556
+	.uleb128 0x1
+	.long	.LASF3410
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3411
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3412
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3413
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3414
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3415
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3416
+	.byte	0x31
+	.byte	0x1e
+	.byte	0x3
+	.long	0x2524
+	.uleb128 0x7
+	.long	.LASF3417
+	.byte	0xc
+	.byte	0x31
+	.byte	0x20
+	.byte	0x10
+	.long	0x2597
+	.uleb128 0x2
+	.long	.LASF3418
+	.byte	0x31
+	.byte	0x21
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3419
+	.byte	0x31
+	.byte	0x22
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3420
+	.byte	0x31
+	.byte	0x23
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3421
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.long	0x2562
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x31
+	.byte	0x31
+	.byte	0xe
+	.long	0x25c9
+	.uleb128 0x1
+	.long	.LASF3422
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3423
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3424
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3425
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3426
+	.byte	0x4
+	.byte	0x31
+	.byte	0x43
+	.byte	0x10
+	.long	0x25f1
+	.uleb128 0x2
+	.long	.LASF3427
+	.byte	0x31
+	.byte	0x44
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3428
+	.byte	0x31
+	.byte	0x45
+	.byte	0xd
+	.long	0xd7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3429
+	.byte	0x31
+	.byte	0x46
+	.byte	0x3
+	.long	0x25c9
+	.uleb128 0xa
+	.long	0x25f1
+	.uleb128 0x6
+	.long	.LASF3430
+	.byte	0x31
+	.byte	0x48
+	.byte	0x21
+	.long	0x25f1
+	.uleb128 0x7
+	.long	.LASF3431
+	.byte	0x4
+	.byte	0x31
+	.byte	0x53
+	.byte	0x10
+	.long	0x2636
+	.uleb128 0x2
+	.long	.LASF3427
+	.byte	0x31
+	.byte	0x54
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3428
+	.byte	0x31
+	.byte	0x55
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3432
+	.byte	0x31
+	.byte	0x56
+	.byte	0x3
+	.long	0x260e
+	.uleb128 0xa
+	.long	0x2636
+	.uleb128 0x6
+	.long	.LASF3433
+	.byte	0x31
+	.byte	0x58
+	.byte	0x25
+	.long	0x2636
+	.uleb128 0x6
+	.long	.LASF3434
+	.byte	0x31
+	.byte	0x89
+	.byte	0x16
+	.long	0xfb
+	.uleb128 0x6
+	.long	.LASF3435
+	.byte	0x31
+	.byte	0x8a
+	.byte	0x16
+	.long	0x1dd
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x32
+	.byte	0x18
+	.byte	0xe
+	.long	0x2733
+	.uleb128 0x1
+	.long	.LASF3436
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3437
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3438
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3439
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3440
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3441
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3442
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3443
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3444
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3445
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3446
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3447
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3448
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3449
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3450
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3451
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3452
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3453
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3454
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3455
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3456
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3457
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3458
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3459
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3460
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3461
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3462
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3463
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3464
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3465
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF3466
+	.byte	0x77
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3467
+	.byte	0x32
+	.byte	0x47
+	.byte	0x3
+	.long	0x266b
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x33
+	.byte	0x1a
+	.byte	0xe
+	.long	0x275f
+	.uleb128 0x1
+	.long	.LASF3468
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3469
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3470
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3471
+	.byte	0x33
+	.byte	0x1e
+	.byte	0x3
+	.long	0x273f
+	.uleb128 0x7
+	.long	.LASF3472
+	.byte	0x4
+	.byte	0x33
+	.byte	0x22
+	.byte	0x10
+	.long	0x2793
+	.uleb128 0x2
+	.long	.LASF3473
+	.byte	0x33
+	.byte	0x23
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3474
+	.byte	0x33
+	.byte	0x24
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3475
+	.byte	0x33
+	.byte	0x25
+	.byte	0x3
+	.long	0x276b
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x33
+	.byte	0x2c
+	.byte	0xe
+	.long	0x27b9
+	.uleb128 0x1
+	.long	.LASF3476
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3477
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x33
+	.byte	0x3f
+	.byte	0xe
+	.long	0x27df
+	.uleb128 0x1
+	.long	.LASF3478
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3479
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3480
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3481
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3482
+	.byte	0x3
+	.byte	0x33
+	.byte	0x47
+	.byte	0x10
+	.long	0x2814
+	.uleb128 0x2
+	.long	.LASF3483
+	.byte	0x33
+	.byte	0x48
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3484
+	.byte	0x33
+	.byte	0x49
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3485
+	.byte	0x33
+	.byte	0x4a
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3486
+	.byte	0x33
+	.byte	0x4b
+	.byte	0x3
+	.long	0x27df
+	.uleb128 0xa
+	.long	0x2814
+	.uleb128 0xe
+	.long	0x2814
+	.long	0x2835
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3487
+	.byte	0x33
+	.byte	0x4d
+	.byte	0x21
+	.long	0x2825
+	.uleb128 0xe
+	.long	0xfb
+	.long	0x2851
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2841
+	.uleb128 0x6
+	.long	.LASF3488
+	.byte	0x33
+	.byte	0x61
+	.byte	0x16
+	.long	0x2851
+	.uleb128 0x6
+	.long	.LASF3489
+	.byte	0x33
+	.byte	0x63
+	.byte	0x16
+	.long	0xfb
+	.uleb128 0x6
+	.long	.LASF3490
+	.byte	0x33
+	.byte	0x64
+	.byte	0x16
+	.long	0x1dd
+	.uleb128 0x7
+	.long	.LASF3491
+	.byte	0x14
+	.byte	0x34
+	.byte	0x1b
+	.byte	0x10
+	.long	0x2917
+	.uleb128 0x2
+	.long	.LASF3492
+	.byte	0x34
+	.byte	0x1d
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3493
+	.byte	0x34
+	.byte	0x1e
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3494
+	.byte	0x34
+	.byte	0x1f
+	.byte	0xd
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3495
+	.byte	0x34
+	.byte	0x20
+	.byte	0xd
+	.long	0xef
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3496
+	.byte	0x34
+	.byte	0x22
+	.byte	0x1a
+	.long	0x275f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3497
+	.byte	0x34
+	.byte	0x25
+	.byte	0x1a
+	.long	0x2556
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3498
+	.byte	0x34
+	.byte	0x26
+	.byte	0xe
+	.long	0x105
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3499
+	.byte	0x34
+	.byte	0x29
+	.byte	0x9
+	.long	0x1ae
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3500
+	.byte	0x34
+	.byte	0x2a
+	.byte	0x9
+	.long	0x1ae
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF3501
+	.byte	0x34
+	.byte	0x2b
+	.byte	0xd
+	.long	0xef
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3502
+	.byte	0x34
+	.byte	0x2c
+	.byte	0xd
+	.long	0xef
+	.byte	0x11
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3503
+	.byte	0x34
+	.byte	0x2d
+	.byte	0x3
+	.long	0x287a
+	.uleb128 0xa
+	.long	0x2917
+	.uleb128 0x6
+	.long	.LASF3504
+	.byte	0x34
+	.byte	0x2f
+	.byte	0x18
+	.long	0x2917
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x34
+	.byte	0x31
+	.byte	0xe
+	.long	0x295a
+	.uleb128 0x1
+	.long	.LASF3505
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3506
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3507
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3508
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3509
+	.byte	0x34
+	.byte	0x36
+	.byte	0x3
+	.long	0x2934
+	.uleb128 0x7
+	.long	.LASF3510
+	.byte	0x6
+	.byte	0x35
+	.byte	0x1e
+	.byte	0x10
+	.long	0x299b
+	.uleb128 0x2
+	.long	.LASF3115
+	.byte	0x35
+	.byte	0x1f
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3116
+	.byte	0x35
+	.byte	0x20
+	.byte	0xd
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x10
+	.string	"yaw"
+	.byte	0x35
+	.byte	0x21
+	.byte	0xd
+	.long	0xd7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3511
+	.byte	0x35
+	.byte	0x22
+	.byte	0x3
+	.long	0x2966
+	.uleb128 0x2c
+	.long	.LASF3513
+	.byte	0x6
+	.byte	0x35
+	.byte	0x24
+	.long	0x29cc
+	.uleb128 0x25
+	.string	"raw"
+	.byte	0x35
+	.byte	0x25
+	.byte	0xd
+	.long	0x800
+	.uleb128 0x24
+	.long	.LASF3117
+	.byte	0x35
+	.byte	0x26
+	.byte	0x1f
+	.long	0x299b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3514
+	.byte	0x35
+	.byte	0x27
+	.byte	0x3
+	.long	0x29a7
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x35
+	.byte	0x2d
+	.byte	0xe
+	.long	0x2a10
+	.uleb128 0x1
+	.long	.LASF3515
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3516
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3517
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3518
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3519
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3520
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3521
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3522
+	.byte	0xa0
+	.byte	0x36
+	.byte	0x2c
+	.byte	0x10
+	.long	0x2a52
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x36
+	.byte	0x2d
+	.byte	0xe
+	.long	0x820
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3523
+	.byte	0x36
+	.byte	0x2e
+	.byte	0xe
+	.long	0x116
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF3524
+	.byte	0x36
+	.byte	0x2f
+	.byte	0xd
+	.long	0x810
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF3525
+	.byte	0x36
+	.byte	0x30
+	.byte	0x9
+	.long	0x1ae
+	.byte	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3526
+	.byte	0x36
+	.byte	0x31
+	.byte	0x3
+	.long	0x2a10
+	.uleb128 0x31
+	.string	"acc"
+	.byte	0x36
+	.byte	0x33
+	.long	0x2a52
+	.uleb128 0x7
+	.long	.LASF3527
+	.byte	0x4
+	.byte	0x36
+	.byte	0x35
+	.byte	0x10
+	.long	0x2a91
+	.uleb128 0x2
+	.long	.LASF3115
+	.byte	0x36
+	.byte	0x36
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3116
+	.byte	0x36
+	.byte	0x37
+	.byte	0xd
+	.long	0xd7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3528
+	.byte	0x36
+	.byte	0x38
+	.byte	0x3
+	.long	0x2a69
+	.uleb128 0x2c
+	.long	.LASF3529
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3a
+	.long	0x2ac2
+	.uleb128 0x25
+	.string	"raw"
+	.byte	0x36
+	.byte	0x3b
+	.byte	0xd
+	.long	0x18ff
+	.uleb128 0x24
+	.long	.LASF3117
+	.byte	0x36
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x2a91
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3530
+	.byte	0x36
+	.byte	0x3d
+	.byte	0x3
+	.long	0x2a9d
+	.uleb128 0x7
+	.long	.LASF3531
+	.byte	0x14
+	.byte	0x36
+	.byte	0x40
+	.byte	0x10
+	.long	0x2b1d
+	.uleb128 0x2
+	.long	.LASF3532
+	.byte	0x36
+	.byte	0x41
+	.byte	0xe
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3533
+	.byte	0x36
+	.byte	0x42
+	.byte	0x14
+	.long	0x496
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3534
+	.byte	0x36
+	.byte	0x43
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3535
+	.byte	0x36
+	.byte	0x44
+	.byte	0x1b
+	.long	0x29cc
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3536
+	.byte	0x36
+	.byte	0x45
+	.byte	0x19
+	.long	0x2ac2
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3537
+	.byte	0x36
+	.byte	0x46
+	.byte	0x3
+	.long	0x2ace
+	.uleb128 0xa
+	.long	0x2b1d
+	.uleb128 0x6
+	.long	.LASF3538
+	.byte	0x36
+	.byte	0x48
+	.byte	0x1e
+	.long	0x2b1d
+	.uleb128 0x4
+	.long	0xe3
+	.uleb128 0x7
+	.long	.LASF3539
+	.byte	0x8
+	.byte	0x37
+	.byte	0x21
+	.byte	0x10
+	.long	0x2b8e
+	.uleb128 0x2
+	.long	.LASF3540
+	.byte	0x37
+	.byte	0x22
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3541
+	.byte	0x37
+	.byte	0x23
+	.byte	0xd
+	.long	0xef
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3542
+	.byte	0x37
+	.byte	0x24
+	.byte	0xe
+	.long	0x105
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3543
+	.byte	0x37
+	.byte	0x25
+	.byte	0xe
+	.long	0x105
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3544
+	.byte	0x37
+	.byte	0x26
+	.byte	0xe
+	.long	0x105
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3545
+	.byte	0x37
+	.byte	0x27
+	.byte	0x3
+	.long	0x2b3f
+	.uleb128 0xa
+	.long	0x2b8e
+	.uleb128 0x6
+	.long	.LASF3546
+	.byte	0x37
+	.byte	0x29
+	.byte	0x1a
+	.long	0x2b8e
+	.uleb128 0x7
+	.long	.LASF3547
+	.byte	0xc
+	.byte	0x38
+	.byte	0x16
+	.byte	0x10
+	.long	0x2be0
+	.uleb128 0x2
+	.long	.LASF3548
+	.byte	0x38
+	.byte	0x17
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3549
+	.byte	0x38
+	.byte	0x18
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3550
+	.byte	0x38
+	.byte	0x19
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3551
+	.byte	0x38
+	.byte	0x1a
+	.byte	0x3
+	.long	0x2bab
+	.uleb128 0xa
+	.long	0x2be0
+	.uleb128 0x6
+	.long	.LASF3552
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x19
+	.long	0x2be0
+	.uleb128 0x7
+	.long	.LASF3553
+	.byte	0x10
+	.byte	0x39
+	.byte	0x23
+	.byte	0x10
+	.long	0x2c25
+	.uleb128 0x2
+	.long	.LASF3554
+	.byte	0x39
+	.byte	0x24
+	.byte	0xd
+	.long	0x810
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3555
+	.byte	0x39
+	.byte	0x25
+	.byte	0xb
+	.long	0x14e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3556
+	.byte	0x39
+	.byte	0x26
+	.byte	0x3
+	.long	0x2bfd
+	.uleb128 0x31
+	.string	"mag"
+	.byte	0x39
+	.byte	0x28
+	.long	0x2c25
+	.uleb128 0x7
+	.long	.LASF3557
+	.byte	0x10
+	.byte	0x39
+	.byte	0x2a
+	.byte	0x10
+	.long	0x2c8b
+	.uleb128 0x2
+	.long	.LASF3558
+	.byte	0x39
+	.byte	0x2b
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3559
+	.byte	0x39
+	.byte	0x2d
+	.byte	0x14
+	.long	0x496
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3560
+	.byte	0x39
+	.byte	0x2e
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3561
+	.byte	0x39
+	.byte	0x2f
+	.byte	0xd
+	.long	0x374
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3562
+	.byte	0x39
+	.byte	0x30
+	.byte	0x1b
+	.long	0x29cc
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3563
+	.byte	0x39
+	.byte	0x31
+	.byte	0x3
+	.long	0x2c3c
+	.uleb128 0xa
+	.long	0x2c8b
+	.uleb128 0x6
+	.long	.LASF3564
+	.byte	0x39
+	.byte	0x33
+	.byte	0x18
+	.long	0x2c8b
+	.uleb128 0x7
+	.long	.LASF3565
+	.byte	0x18
+	.byte	0x3a
+	.byte	0x4c
+	.byte	0x10
+	.long	0x2d86
+	.uleb128 0x2
+	.long	.LASF3566
+	.byte	0x3a
+	.byte	0x4d
+	.byte	0x14
+	.long	0x496
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3567
+	.byte	0x3a
+	.byte	0x4e
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3568
+	.byte	0x3a
+	.byte	0x4f
+	.byte	0xd
+	.long	0xef
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3569
+	.byte	0x3a
+	.byte	0x50
+	.byte	0xd
+	.long	0xef
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3570
+	.byte	0x3a
+	.byte	0x51
+	.byte	0xd
+	.long	0xef
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3571
+	.byte	0x3a
+	.byte	0x52
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3572
+	.byte	0x3a
+	.byte	0x53
+	.byte	0xd
+	.long	0x1ae
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3573
+	.byte	0x3a
+	.byte	0x54
+	.byte	0xd
+	.long	0x1ae
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3574
+	.byte	0x3a
+	.byte	0x55
+	.byte	0xd
+	.long	0xef
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3575
+	.byte	0x3a
+	.byte	0x56
+	.byte	0xd
+	.long	0xef
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3576
+	.byte	0x3a
+	.byte	0x57
+	.byte	0xe
+	.long	0x105
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3577
+	.byte	0x3a
+	.byte	0x58
+	.byte	0xe
+	.long	0x105
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3578
+	.byte	0x3a
+	.byte	0x59
+	.byte	0xe
+	.long	0x105
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3579
+	.byte	0x3a
+	.byte	0x5a
+	.byte	0xe
+	.long	0x105
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3580
+	.byte	0x3a
+	.byte	0x5b
+	.byte	0xd
+	.long	0xef
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3581
+	.byte	0x3a
+	.byte	0x5c
+	.byte	0xd
+	.long	0xef
+	.byte	0x17
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3582
+	.byte	0x3a
+	.byte	0x5d
+	.byte	0x3
+	.long	0x2ca8
+	.uleb128 0xa
+	.long	0x2d86
+	.uleb128 0x6
+	.long	.LASF3583
+	.byte	0x3a
+	.byte	0x5f
+	.byte	0x15
+	.long	0x2d86
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x3b
+	.byte	0x1e
+	.byte	0xe
+	.long	0x2dbd
+	.uleb128 0x1
+	.long	.LASF3584
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3585
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3586
+	.byte	0x3b
+	.byte	0x21
+	.byte	0x3
+	.long	0x2da3
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x3b
+	.byte	0x23
+	.byte	0xe
+	.long	0x2de3
+	.uleb128 0x1
+	.long	.LASF3587
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3588
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3589
+	.byte	0x3b
+	.byte	0x26
+	.byte	0x3
+	.long	0x2dc9
+	.uleb128 0x7
+	.long	.LASF3590
+	.byte	0x18
+	.byte	0x3b
+	.byte	0x28
+	.byte	0x10
+	.long	0x2e99
+	.uleb128 0x2
+	.long	.LASF3591
+	.byte	0x3b
+	.byte	0x29
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3592
+	.byte	0x3b
+	.byte	0x2a
+	.byte	0xd
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3593
+	.byte	0x3b
+	.byte	0x2b
+	.byte	0xd
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3594
+	.byte	0x3b
+	.byte	0x2c
+	.byte	0xd
+	.long	0xef
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3305
+	.byte	0x3b
+	.byte	0x2d
+	.byte	0xd
+	.long	0xef
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3595
+	.byte	0x3b
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x2dbd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3596
+	.byte	0x3b
+	.byte	0x2f
+	.byte	0x11
+	.long	0x2de3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3597
+	.byte	0x3b
+	.byte	0x30
+	.byte	0xd
+	.long	0xef
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3598
+	.byte	0x3b
+	.byte	0x31
+	.byte	0xd
+	.long	0xef
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3599
+	.byte	0x3b
+	.byte	0x32
+	.byte	0xd
+	.long	0xef
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3600
+	.byte	0x3b
+	.byte	0x33
+	.byte	0xd
+	.long	0xef
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF3601
+	.byte	0x3b
+	.byte	0x34
+	.byte	0xd
+	.long	0xef
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3602
+	.byte	0x3b
+	.byte	0x35
+	.byte	0x3
+	.long	0x2def
+	.uleb128 0xa
+	.long	0x2e99
+	.uleb128 0x6
+	.long	.LASF3603
+	.byte	0x3b
+	.byte	0x37
+	.byte	0x1a
+	.long	0x2e99
+	.uleb128 0x26
+	.long	.LASF3604
+	.byte	0x79
+	.byte	0x1b
+	.long	0x149
+	.uleb128 0x26
+	.long	.LASF3605
+	.byte	0x7a
+	.byte	0x1b
+	.long	0x149
+	.uleb128 0xe
+	.long	0x13f7
+	.long	0x2edc
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x24
+	.byte	0
+	.uleb128 0xa
+	.long	0x2ecc
+	.uleb128 0x26
+	.long	.LASF3606
+	.byte	0x7e
+	.byte	0x14
+	.long	0x2edc
+	.uleb128 0x26
+	.long	.LASF3607
+	.byte	0xa8
+	.byte	0x15
+	.long	0x1314
+	.uleb128 0xe
+	.long	0xc1
+	.long	0x2f07
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2f
+	.byte	0
+	.uleb128 0xa
+	.long	0x2ef7
+	.uleb128 0x26
+	.long	.LASF3608
+	.byte	0xaa
+	.byte	0x13
+	.long	0x2f07
+	.uleb128 0x3c
+	.long	.LASF3609
+	.byte	0x3c
+	.value	0x12b
+	.byte	0xe
+	.long	0x2f24
+	.uleb128 0x1a
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x2f39
+	.byte	0
+	.uleb128 0x4
+	.long	0x368
+	.uleb128 0x4
+	.long	0x13f7
+	.uleb128 0x12
+	.long	.LASF3612
+	.byte	0x2d
+	.byte	0x87
+	.byte	0x15
+	.long	0x2f54
+	.long	0x2f54
+	.uleb128 0x5
+	.long	0x1f38
+	.byte	0
+	.uleb128 0x4
+	.long	0x1fa0
+	.uleb128 0x13
+	.long	.LASF3610
+	.byte	0x3d
+	.byte	0x1f
+	.long	0x2f6a
+	.uleb128 0x5
+	.long	0x116
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3617
+	.byte	0x3d
+	.byte	0x21
+	.uleb128 0x13
+	.long	.LASF3611
+	.byte	0x29
+	.byte	0x38
+	.long	0x2f87
+	.uleb128 0x5
+	.long	0x2b3a
+	.uleb128 0x5
+	.long	0x2b3a
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3613
+	.byte	0x24
+	.byte	0x67
+	.byte	0xa
+	.long	0x105
+	.long	0x2f9d
+	.uleb128 0x5
+	.long	0x160e
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF3614
+	.byte	0x3e
+	.byte	0x2b
+	.long	0x2faa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3651
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x5
+	.long	0x1ae
+	.uleb128 0x32
+	.long	.LASF3615
+	.byte	0x1b
+	.byte	0x71
+	.long	0x2fc3
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3616
+	.byte	0x36
+	.byte	0x4c
+	.long	0x2fd4
+	.uleb128 0x5
+	.long	0x105
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3618
+	.byte	0x1b
+	.byte	0x70
+	.uleb128 0x1b
+	.long	.LASF3619
+	.byte	0x1b
+	.byte	0x6f
+	.uleb128 0x13
+	.long	.LASF3620
+	.byte	0x1c
+	.byte	0x83
+	.long	0x2ff3
+	.uleb128 0x5
+	.long	0x2ff3
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a2e
+	.uleb128 0x1b
+	.long	.LASF3621
+	.byte	0x3a
+	.byte	0x63
+	.uleb128 0x1b
+	.long	.LASF3622
+	.byte	0x1b
+	.byte	0x76
+	.uleb128 0x13
+	.long	.LASF3623
+	.byte	0x1b
+	.byte	0x7c
+	.long	0x3017
+	.uleb128 0x5
+	.long	0x1093
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3624
+	.byte	0x2a
+	.byte	0x83
+	.uleb128 0x27
+	.long	.LASF3625
+	.byte	0x28
+	.byte	0x6d
+	.byte	0x9
+	.long	0xef
+	.long	0x3030
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3626
+	.byte	0x28
+	.byte	0x80
+	.byte	0x7
+	.long	0x14e
+	.long	0x3046
+	.uleb128 0x5
+	.long	0x105
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3627
+	.byte	0x3f
+	.byte	0x1a
+	.uleb128 0x13
+	.long	.LASF3628
+	.byte	0x23
+	.byte	0x77
+	.long	0x305e
+	.uleb128 0x5
+	.long	0x1093
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3629
+	.byte	0x1c
+	.byte	0x84
+	.long	0x306f
+	.uleb128 0x5
+	.long	0x2ff3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3630
+	.byte	0x40
+	.byte	0x17
+	.long	0x3085
+	.uleb128 0x5
+	.long	0xdae
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3631
+	.byte	0x1d
+	.byte	0x2b
+	.long	0x3096
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3632
+	.byte	0x1b
+	.byte	0x7a
+	.long	0x30a7
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3633
+	.byte	0xc
+	.byte	0x2e
+	.long	0x30bd
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3634
+	.byte	0x3e
+	.byte	0x3f
+	.byte	0x5
+	.long	0x8d
+	.long	0x30dd
+	.uleb128 0x5
+	.long	0x116
+	.uleb128 0x5
+	.long	0x1cd
+	.uleb128 0x5
+	.long	0x30
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3635
+	.byte	0xc
+	.byte	0x2c
+	.byte	0xa
+	.long	0x1cd
+	.long	0x30f3
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3636
+	.byte	0xc
+	.byte	0x27
+	.byte	0xa
+	.long	0x105
+	.long	0x3109
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3637
+	.byte	0xc
+	.byte	0x28
+	.byte	0xa
+	.long	0x116
+	.long	0x311f
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3638
+	.byte	0xc
+	.byte	0x24
+	.long	0x3135
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x144
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3639
+	.byte	0x2f
+	.byte	0xc5
+	.byte	0x1a
+	.long	0x314b
+	.long	0x314b
+	.uleb128 0x5
+	.long	0x242d
+	.byte	0
+	.uleb128 0x4
+	.long	0x22ea
+	.uleb128 0x13
+	.long	.LASF3640
+	.byte	0x2f
+	.byte	0xbe
+	.long	0x3166
+	.uleb128 0x5
+	.long	0x242d
+	.uleb128 0x5
+	.long	0x3166
+	.byte	0
+	.uleb128 0x4
+	.long	0x2395
+	.uleb128 0x12
+	.long	.LASF3641
+	.byte	0x41
+	.byte	0x17
+	.byte	0xd
+	.long	0x116a
+	.long	0x3186
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3642
+	.byte	0x41
+	.byte	0x16
+	.byte	0xd
+	.long	0x116a
+	.long	0x31a1
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3643
+	.byte	0xc
+	.byte	0x26
+	.byte	0x9
+	.long	0xef
+	.long	0x31b7
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3644
+	.byte	0xc
+	.byte	0x2b
+	.byte	0x5
+	.long	0x8d
+	.long	0x31cd
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3645
+	.byte	0x3e
+	.byte	0x2f
+	.byte	0xa
+	.long	0x116
+	.long	0x31df
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3646
+	.byte	0x3e
+	.byte	0x2e
+	.byte	0xa
+	.long	0x116
+	.long	0x31f1
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3647
+	.byte	0x3e
+	.byte	0x4b
+	.byte	0x5
+	.long	0x1ae
+	.long	0x3203
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3648
+	.byte	0x3e
+	.byte	0x34
+	.byte	0x1f
+	.long	0x3215
+	.long	0x3215
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x4
+	.long	0x87b
+	.uleb128 0x12
+	.long	.LASF3649
+	.byte	0x20
+	.byte	0x66
+	.byte	0x5
+	.long	0x1ae
+	.long	0x3230
+	.uleb128 0x5
+	.long	0x12e1
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3650
+	.byte	0x2d
+	.byte	0x85
+	.byte	0x5
+	.long	0x1ae
+	.long	0x3246
+	.uleb128 0x5
+	.long	0x1f38
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3652
+	.byte	0x25
+	.byte	0x20
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x18
+	.long	.LASF3653
+	.byte	0x25
+	.byte	0x1f
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x12
+	.long	.LASF3654
+	.byte	0x28
+	.byte	0x81
+	.byte	0xa
+	.long	0x105
+	.long	0x3274
+	.uleb128 0x5
+	.long	0x14e
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3655
+	.byte	0x19
+	.byte	0xbf
+	.byte	0x12
+	.long	0x3280
+	.uleb128 0x4
+	.long	0xa6a
+	.uleb128 0x3d
+	.long	.LASF3656
+	.byte	0x42
+	.value	0x197
+	.byte	0xf
+	.long	0x138
+	.long	0x329c
+	.uleb128 0x5
+	.long	0x144
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3657
+	.byte	0x3a
+	.byte	0x74
+	.byte	0x9
+	.long	0xd7
+	.long	0x32b2
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3658
+	.byte	0x1b
+	.byte	0x7e
+	.byte	0x9
+	.long	0xef
+	.uleb128 0x18
+	.long	.LASF3659
+	.byte	0x1b
+	.byte	0x79
+	.byte	0x9
+	.long	0xef
+	.uleb128 0x12
+	.long	.LASF3660
+	.byte	0x2f
+	.byte	0xc1
+	.byte	0xd
+	.long	0x1b5
+	.long	0x32e0
+	.uleb128 0x5
+	.long	0x242d
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3661
+	.byte	0x43
+	.byte	0x28
+	.uleb128 0x1b
+	.long	.LASF3662
+	.byte	0x28
+	.byte	0x7e
+	.uleb128 0x13
+	.long	.LASF3663
+	.byte	0x31
+	.byte	0x8b
+	.long	0x3304
+	.uleb128 0x5
+	.long	0x2518
+	.uleb128 0x5
+	.long	0x3304
+	.byte	0
+	.uleb128 0x4
+	.long	0x2597
+	.uleb128 0x13
+	.long	.LASF3664
+	.byte	0x33
+	.byte	0x65
+	.long	0x331f
+	.uleb128 0x5
+	.long	0x2733
+	.uleb128 0x5
+	.long	0x331f
+	.byte	0
+	.uleb128 0x4
+	.long	0x2793
+	.uleb128 0x18
+	.long	.LASF3665
+	.byte	0x34
+	.byte	0x3c
+	.byte	0x10
+	.long	0x295a
+	.uleb128 0x18
+	.long	.LASF3666
+	.byte	0x34
+	.byte	0x48
+	.byte	0x9
+	.long	0xef
+	.uleb128 0x18
+	.long	.LASF3667
+	.byte	0x3d
+	.byte	0x22
+	.byte	0xa
+	.long	0x116
+	.uleb128 0x13
+	.long	.LASF3668
+	.byte	0xc
+	.byte	0x20
+	.long	0x335e
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x116
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3669
+	.byte	0x34
+	.byte	0x4a
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x18
+	.long	.LASF3670
+	.byte	0x34
+	.byte	0x4c
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x18
+	.long	.LASF3671
+	.byte	0x34
+	.byte	0x46
+	.byte	0xa
+	.long	0x105
+	.uleb128 0x13
+	.long	.LASF3672
+	.byte	0xc
+	.byte	0x1f
+	.long	0x3398
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x105
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3673
+	.byte	0xc
+	.byte	0x23
+	.long	0x33b3
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0xd93
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3674
+	.byte	0xc
+	.byte	0x1e
+	.long	0x33c9
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3675
+	.byte	0x41
+	.byte	0x18
+	.byte	0xd
+	.long	0x116a
+	.long	0x33df
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3676
+	.byte	0x44
+	.byte	0x17
+	.byte	0xd
+	.long	0x116a
+	.long	0x33f5
+	.uleb128 0x5
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3677
+	.byte	0x44
+	.byte	0x16
+	.byte	0xd
+	.long	0x116a
+	.long	0x3415
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x2f34
+	.uleb128 0x5
+	.long	0x11ea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3678
+	.byte	0x45
+	.byte	0x14
+	.long	0x342b
+	.uleb128 0x5
+	.long	0xb8
+	.uleb128 0x5
+	.long	0x30
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3679
+	.byte	0x45
+	.byte	0x12
+	.byte	0x5
+	.long	0x1ae
+	.long	0x3446
+	.uleb128 0x5
+	.long	0xd93
+	.uleb128 0x5
+	.long	0x30
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3680
+	.byte	0x19
+	.byte	0xa3
+	.byte	0x5
+	.long	0x1ae
+	.uleb128 0x12
+	.long	.LASF3681
+	.byte	0x24
+	.byte	0x69
+	.byte	0x5
+	.long	0x1ae
+	.long	0x3468
+	.uleb128 0x5
+	.long	0x116
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3682
+	.byte	0x3d
+	.byte	0x1e
+	.byte	0x5
+	.long	0x1ae
+	.long	0x347e
+	.uleb128 0x5
+	.long	0x116
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3683
+	.byte	0x45
+	.byte	0x13
+	.long	0x3494
+	.uleb128 0x5
+	.long	0xb8
+	.uleb128 0x5
+	.long	0x30
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3684
+	.byte	0x42
+	.byte	0x3d
+	.byte	0xe
+	.long	0xb8
+	.long	0x34b4
+	.uleb128 0x5
+	.long	0xb8
+	.uleb128 0x5
+	.long	0x8d
+	.uleb128 0x5
+	.long	0x138
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF3808
+	.byte	0x3c
+	.value	0x95a
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF3685
+	.value	0x90c
+	.long	0x3513
+	.uleb128 0x14
+	.long	.LASF3688
+	.value	0x90c
+	.byte	0x25
+	.long	0x11e5
+	.uleb128 0x9
+	.string	"src"
+	.value	0x90e
+	.byte	0xd
+	.long	0x2f34
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3686
+	.value	0x915
+	.byte	0x15
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3420
+	.value	0x916
+	.byte	0x16
+	.long	0x105
+	.uleb128 0x8
+	.long	.LASF3295
+	.value	0x917
+	.byte	0x16
+	.long	0x105
+	.uleb128 0x8
+	.long	.LASF3418
+	.value	0x918
+	.byte	0x16
+	.long	0x105
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3687
+	.value	0x8d9
+	.byte	0xd
+	.long	0x116a
+	.long	0x3578
+	.uleb128 0x15
+	.string	"cmd"
+	.value	0x8d9
+	.byte	0x2e
+	.long	0x11e5
+	.uleb128 0x14
+	.long	.LASF3688
+	.value	0x8d9
+	.byte	0x40
+	.long	0x11e5
+	.uleb128 0x14
+	.long	.LASF3689
+	.value	0x8d9
+	.byte	0x5c
+	.long	0x11ea
+	.uleb128 0x9
+	.string	"ret"
+	.value	0x8db
+	.byte	0x9
+	.long	0x8d
+	.uleb128 0x9
+	.string	"dst"
+	.value	0x8dc
+	.byte	0xd
+	.long	0x2f34
+	.uleb128 0x9
+	.string	"src"
+	.value	0x8dd
+	.byte	0xd
+	.long	0x2f34
+	.uleb128 0x8
+	.long	.LASF3690
+	.value	0x8de
+	.byte	0x14
+	.long	0x111
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3693
+	.value	0x824
+	.byte	0x14
+	.long	0x116a
+	.long	0x35d7
+	.uleb128 0x14
+	.long	.LASF3690
+	.value	0x824
+	.byte	0x37
+	.long	0x105
+	.uleb128 0x15
+	.string	"src"
+	.value	0x824
+	.byte	0x47
+	.long	0x2f34
+	.uleb128 0x8
+	.long	.LASF3691
+	.value	0x826
+	.byte	0x18
+	.long	0x37
+	.uleb128 0xc
+	.long	0x35c9
+	.uleb128 0x9
+	.string	"id"
+	.value	0x84f
+	.byte	0xd
+	.long	0x8d
+	.uleb128 0x8
+	.long	.LASF3692
+	.value	0x854
+	.byte	0xd
+	.long	0x8d
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"id"
+	.value	0x867
+	.byte	0xd
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3694
+	.value	0x5f1
+	.byte	0x14
+	.long	0x116a
+	.long	0x3732
+	.uleb128 0x14
+	.long	.LASF3690
+	.value	0x5f1
+	.byte	0x33
+	.long	0x105
+	.uleb128 0x15
+	.string	"src"
+	.value	0x5f1
+	.byte	0x43
+	.long	0x2f34
+	.uleb128 0x9
+	.string	"i"
+	.value	0x5f3
+	.byte	0xe
+	.long	0x116
+	.uleb128 0x8
+	.long	.LASF3695
+	.value	0x5f4
+	.byte	0xd
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3691
+	.value	0x5f5
+	.byte	0x18
+	.long	0x37
+	.uleb128 0x8
+	.long	.LASF3696
+	.value	0x5f7
+	.byte	0xd
+	.long	0xef
+	.uleb128 0x9
+	.string	"lat"
+	.value	0x5f8
+	.byte	0xd
+	.long	0xe3
+	.uleb128 0x9
+	.string	"lon"
+	.value	0x5f8
+	.byte	0x16
+	.long	0xe3
+	.uleb128 0x9
+	.string	"alt"
+	.value	0x5f8
+	.byte	0x1f
+	.long	0xe3
+	.uleb128 0xc
+	.long	0x367d
+	.uleb128 0x8
+	.long	.LASF3331
+	.value	0x617
+	.byte	0x15
+	.long	0xef
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3697
+	.value	0x61b
+	.byte	0x1a
+	.long	0x3732
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x61c
+	.byte	0x1a
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x368d
+	.uleb128 0x9
+	.string	"i"
+	.value	0x631
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x36ab
+	.uleb128 0x9
+	.string	"mac"
+	.value	0x63c
+	.byte	0x28
+	.long	0x3742
+	.uleb128 0x9
+	.string	"box"
+	.value	0x63e
+	.byte	0x1a
+	.long	0x2f39
+	.byte	0
+	.uleb128 0xc
+	.long	0x36bd
+	.uleb128 0x8
+	.long	.LASF3698
+	.value	0x651
+	.byte	0x20
+	.long	0x3747
+	.byte	0
+	.uleb128 0xc
+	.long	0x36cd
+	.uleb128 0x9
+	.string	"i"
+	.value	0x666
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x36dd
+	.uleb128 0x9
+	.string	"i"
+	.value	0x691
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x36ed
+	.uleb128 0x9
+	.string	"i"
+	.value	0x7d2
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3725
+	.uleb128 0x8
+	.long	.LASF3699
+	.value	0x7d9
+	.byte	0x15
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3700
+	.value	0x7df
+	.byte	0x15
+	.long	0xef
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF2888
+	.value	0x7e2
+	.byte	0x19
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3701
+	.value	0x7e4
+	.byte	0x25
+	.long	0x2f54
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x817
+	.byte	0x1b
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x105
+	.long	0x3742
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	0x1389
+	.uleb128 0x4
+	.long	0x144b
+	.uleb128 0x1c
+	.long	.LASF3705
+	.value	0x5d6
+	.long	0x37a0
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x5d6
+	.byte	0x2f
+	.long	0x2f34
+	.uleb128 0x15
+	.string	"src"
+	.value	0x5d6
+	.byte	0x3c
+	.long	0x2f34
+	.uleb128 0x8
+	.long	.LASF3691
+	.value	0x5d8
+	.byte	0x18
+	.long	0x37
+	.uleb128 0x8
+	.long	.LASF3702
+	.value	0x5d9
+	.byte	0x14
+	.long	0x122
+	.uleb128 0x8
+	.long	.LASF3703
+	.value	0x5da
+	.byte	0xe
+	.long	0x105
+	.uleb128 0x8
+	.long	.LASF3704
+	.value	0x5db
+	.byte	0x9
+	.long	0x1ae
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3706
+	.value	0x5bf
+	.long	0x37e8
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x5bf
+	.byte	0x24
+	.long	0x2f34
+	.uleb128 0x15
+	.string	"src"
+	.value	0x5bf
+	.byte	0x31
+	.long	0x2f34
+	.uleb128 0x8
+	.long	.LASF3696
+	.value	0x5c1
+	.byte	0xd
+	.long	0xef
+	.uleb128 0x9
+	.string	"lat"
+	.value	0x5c2
+	.byte	0xd
+	.long	0xe3
+	.uleb128 0x9
+	.string	"lon"
+	.value	0x5c2
+	.byte	0x16
+	.long	0xe3
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3707
+	.value	0x575
+	.byte	0x14
+	.long	0x116a
+	.long	0x388f
+	.uleb128 0x14
+	.long	.LASF3690
+	.value	0x575
+	.byte	0x3b
+	.long	0x105
+	.uleb128 0x15
+	.string	"arg"
+	.value	0x575
+	.byte	0x4b
+	.long	0x2f34
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x575
+	.byte	0x58
+	.long	0x2f34
+	.uleb128 0x14
+	.long	.LASF3689
+	.value	0x575
+	.byte	0x72
+	.long	0x11ea
+	.uleb128 0xc
+	.long	0x383a
+	.uleb128 0x8
+	.long	.LASF3708
+	.value	0x57c
+	.byte	0x17
+	.long	0x94
+	.byte	0
+	.uleb128 0xc
+	.long	0x384c
+	.uleb128 0x8
+	.long	.LASF3708
+	.value	0x582
+	.byte	0x17
+	.long	0x94
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3709
+	.value	0x58d
+	.byte	0x1e
+	.long	0x2439
+	.uleb128 0x8
+	.long	.LASF3710
+	.value	0x591
+	.byte	0x1a
+	.long	0x2395
+	.uleb128 0x8
+	.long	.LASF3711
+	.value	0x593
+	.byte	0x26
+	.long	0x314b
+	.uleb128 0xc
+	.long	0x3881
+	.uleb128 0x9
+	.string	"i"
+	.value	0x59a
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x59d
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3712
+	.value	0x39b
+	.byte	0xc
+	.long	0x1ae
+	.long	0x3a2e
+	.uleb128 0x14
+	.long	.LASF3690
+	.value	0x39b
+	.byte	0x2c
+	.long	0x105
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x39b
+	.byte	0x3c
+	.long	0x2f34
+	.uleb128 0x14
+	.long	.LASF3689
+	.value	0x39b
+	.byte	0x56
+	.long	0x11ea
+	.uleb128 0xc
+	.long	0x38ed
+	.uleb128 0x8
+	.long	.LASF3098
+	.value	0x3a3
+	.byte	0x1a
+	.long	0x1314
+	.uleb128 0x8
+	.long	.LASF3713
+	.value	0x3a4
+	.byte	0x17
+	.long	0x94
+	.uleb128 0x8
+	.long	.LASF3714
+	.value	0x3b9
+	.byte	0x11
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x392b
+	.uleb128 0x8
+	.long	.LASF3427
+	.value	0x3c3
+	.byte	0x1b
+	.long	0xfb
+	.uleb128 0xc
+	.long	0x390e
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3c4
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x391e
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3c7
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3ca
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3949
+	.uleb128 0x8
+	.long	.LASF3715
+	.value	0x3d2
+	.byte	0x17
+	.long	0x94
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3d3
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3959
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3de
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3969
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3e9
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3979
+	.uleb128 0x9
+	.string	"i"
+	.value	0x3f6
+	.byte	0x17
+	.long	0x30
+	.byte	0
+	.uleb128 0xc
+	.long	0x3989
+	.uleb128 0x9
+	.string	"i"
+	.value	0x401
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3999
+	.uleb128 0x9
+	.string	"i"
+	.value	0x42b
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x39a9
+	.uleb128 0x9
+	.string	"i"
+	.value	0x437
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x39b9
+	.uleb128 0x9
+	.string	"c"
+	.value	0x43f
+	.byte	0x1a
+	.long	0x144
+	.byte	0
+	.uleb128 0xc
+	.long	0x39e3
+	.uleb128 0x9
+	.string	"i"
+	.value	0x449
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"mac"
+	.value	0x44a
+	.byte	0x2e
+	.long	0x3a2e
+	.uleb128 0x9
+	.string	"box"
+	.value	0x44b
+	.byte	0x1a
+	.long	0x2f39
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3a01
+	.uleb128 0x9
+	.string	"i"
+	.value	0x454
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3698
+	.value	0x455
+	.byte	0x26
+	.long	0x3a33
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3a11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x485
+	.byte	0x11
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3a21
+	.uleb128 0x9
+	.string	"i"
+	.value	0x4b2
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x4c1
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1395
+	.uleb128 0x4
+	.long	0x1457
+	.uleb128 0x22
+	.long	.LASF3716
+	.value	0x269
+	.byte	0xc
+	.long	0x1ae
+	.long	0x3b25
+	.uleb128 0x14
+	.long	.LASF3690
+	.value	0x269
+	.byte	0x30
+	.long	0x105
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x269
+	.byte	0x40
+	.long	0x2f34
+	.uleb128 0x14
+	.long	.LASF3689
+	.value	0x269
+	.byte	0x5a
+	.long	0x11ea
+	.uleb128 0xc
+	.long	0x3a7c
+	.uleb128 0x9
+	.string	"i"
+	.value	0x2a9
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3aa5
+	.uleb128 0x9
+	.string	"i"
+	.value	0x2c9
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3717
+	.value	0x2cb
+	.byte	0x1c
+	.long	0x2793
+	.uleb128 0x9
+	.string	"id"
+	.value	0x2cc
+	.byte	0x15
+	.long	0xef
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3ace
+	.uleb128 0x9
+	.string	"i"
+	.value	0x2d6
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3717
+	.value	0x2d8
+	.byte	0x1c
+	.long	0x2597
+	.uleb128 0x9
+	.string	"id"
+	.value	0x2d9
+	.byte	0x15
+	.long	0xef
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3aec
+	.uleb128 0x9
+	.string	"i"
+	.value	0x2e8
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3718
+	.value	0x2e9
+	.byte	0x1b
+	.long	0xfb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3b16
+	.uleb128 0x8
+	.long	.LASF3719
+	.value	0x2fb
+	.byte	0xd
+	.long	0x8d
+	.uleb128 0x8
+	.long	.LASF3718
+	.value	0x302
+	.byte	0x17
+	.long	0xfb
+	.uleb128 0x8
+	.long	.LASF3720
+	.value	0x30a
+	.byte	0x16
+	.long	0xd2
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3721
+	.value	0x33f
+	.byte	0x11
+	.long	0xef
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3722
+	.value	0x242
+	.long	0x3b91
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x242
+	.byte	0x31
+	.long	0x2f34
+	.uleb128 0x14
+	.long	.LASF2724
+	.value	0x242
+	.byte	0x3f
+	.long	0x116
+	.uleb128 0x14
+	.long	.LASF3723
+	.value	0x242
+	.byte	0x57
+	.long	0x111
+	.uleb128 0x14
+	.long	.LASF3704
+	.value	0x242
+	.byte	0x61
+	.long	0x1ae
+	.uleb128 0x8
+	.long	.LASF3724
+	.value	0x246
+	.byte	0xe
+	.long	0x105
+	.uleb128 0x8
+	.long	.LASF3725
+	.value	0x247
+	.byte	0xf
+	.long	0x94
+	.uleb128 0x8
+	.long	.LASF3726
+	.value	0x258
+	.byte	0xf
+	.long	0x94
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x25d
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3727
+	.value	0x22f
+	.long	0x3bc1
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x22f
+	.byte	0x34
+	.long	0x2f34
+	.uleb128 0x8
+	.long	.LASF3728
+	.value	0x232
+	.byte	0x1c
+	.long	0x3bc1
+	.uleb128 0x8
+	.long	.LASF3729
+	.value	0x233
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x4
+	.long	0x88c
+	.uleb128 0x1c
+	.long	.LASF3730
+	.value	0x1fe
+	.long	0x3bde
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x1fe
+	.byte	0x31
+	.long	0x2f34
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3731
+	.value	0x1c7
+	.byte	0xc
+	.long	0x8d
+	.long	0x3c65
+	.uleb128 0x14
+	.long	.LASF3732
+	.value	0x1c7
+	.byte	0x2e
+	.long	0x3c65
+	.uleb128 0x8
+	.long	.LASF3733
+	.value	0x1cd
+	.byte	0x12
+	.long	0x1314
+	.uleb128 0x8
+	.long	.LASF3734
+	.value	0x1d2
+	.byte	0x19
+	.long	0x3c7a
+	.uleb128 0x8
+	.long	.LASF3735
+	.value	0x1d3
+	.byte	0x17
+	.long	0x160e
+	.uleb128 0x8
+	.long	.LASF3736
+	.value	0x1e0
+	.byte	0x14
+	.long	0x133
+	.uleb128 0x8
+	.long	.LASF3737
+	.value	0x1f2
+	.byte	0xe
+	.long	0x30
+	.uleb128 0xc
+	.long	0x3c46
+	.uleb128 0x9
+	.string	"i"
+	.value	0x1d4
+	.byte	0x13
+	.long	0x30
+	.byte	0
+	.uleb128 0xc
+	.long	0x3c56
+	.uleb128 0x9
+	.string	"i"
+	.value	0x1e5
+	.byte	0x13
+	.long	0x30
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3052
+	.value	0x1f3
+	.byte	0x12
+	.long	0x12e1
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1314
+	.uleb128 0xe
+	.long	0xd2
+	.long	0x3c7a
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0x3c6a
+	.uleb128 0x33
+	.long	.LASF3738
+	.value	0x149
+	.long	0x3ca5
+	.uleb128 0x9
+	.string	"ena"
+	.value	0x14c
+	.byte	0x12
+	.long	0x1314
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3052
+	.value	0x1bd
+	.byte	0x12
+	.long	0x12e1
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3739
+	.value	0x13a
+	.long	0x3d06
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x13a
+	.byte	0x27
+	.long	0x2f34
+	.uleb128 0x14
+	.long	.LASF3708
+	.value	0x13a
+	.byte	0x30
+	.long	0x8d
+	.uleb128 0x14
+	.long	.LASF3740
+	.value	0x13a
+	.byte	0x46
+	.long	0x3d06
+	.uleb128 0x8
+	.long	.LASF3741
+	.value	0x13c
+	.byte	0xe
+	.long	0x30
+	.uleb128 0x8
+	.long	.LASF3742
+	.value	0x13d
+	.byte	0xe
+	.long	0x30
+	.uleb128 0x8
+	.long	.LASF3743
+	.value	0x13e
+	.byte	0xe
+	.long	0x30
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"id"
+	.value	0x13f
+	.byte	0x12
+	.long	0x12e1
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x2f17
+	.uleb128 0x1c
+	.long	.LASF3744
+	.value	0x133
+	.long	0x3d2f
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x133
+	.byte	0x2f
+	.long	0x2f34
+	.uleb128 0x15
+	.string	"box"
+	.value	0x133
+	.byte	0x41
+	.long	0x2f39
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3745
+	.value	0x12d
+	.long	0x3d53
+	.uleb128 0x15
+	.string	"dst"
+	.value	0x12d
+	.byte	0x28
+	.long	0x2f34
+	.uleb128 0x15
+	.string	"box"
+	.value	0x12d
+	.byte	0x3a
+	.long	0x2f39
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3746
+	.value	0x122
+	.byte	0xc
+	.long	0x1ae
+	.long	0x3d70
+	.uleb128 0x14
+	.long	.LASF3052
+	.value	0x122
+	.byte	0x23
+	.long	0x12e1
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3747
+	.value	0x118
+	.byte	0xe
+	.long	0x2f39
+	.long	0x3da7
+	.uleb128 0x14
+	.long	.LASF3054
+	.value	0x118
+	.byte	0x2b
+	.long	0xef
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x11a
+	.byte	0x13
+	.long	0x30
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3748
+	.value	0x11b
+	.byte	0x16
+	.long	0x2f39
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3749
+	.value	0x10e
+	.byte	0xe
+	.long	0x2f39
+	.long	0x3dde
+	.uleb128 0x14
+	.long	.LASF3052
+	.value	0x10e
+	.byte	0x25
+	.long	0x12e1
+	.uleb128 0x11
+	.uleb128 0x9
+	.string	"i"
+	.value	0x110
+	.byte	0x13
+	.long	0x30
+	.uleb128 0x11
+	.uleb128 0x8
+	.long	.LASF3748
+	.value	0x111
+	.byte	0x16
+	.long	0x2f39
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3750
+	.value	0x100
+	.long	0x3df6
+	.uleb128 0x14
+	.long	.LASF3751
+	.value	0x100
+	.byte	0x27
+	.long	0xd09
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3752
+	.byte	0x3b
+	.byte	0x37
+	.byte	0x88
+	.long	0x3e02
+	.uleb128 0x4
+	.long	0x2ea5
+	.uleb128 0xb
+	.long	.LASF3753
+	.byte	0x3a
+	.byte	0x5f
+	.byte	0xbb
+	.long	0x3e13
+	.uleb128 0x4
+	.long	0x2d86
+	.uleb128 0xb
+	.long	.LASF3754
+	.byte	0x3a
+	.byte	0x5f
+	.byte	0x6f
+	.long	0x3e24
+	.uleb128 0x4
+	.long	0x2d92
+	.uleb128 0xb
+	.long	.LASF3755
+	.byte	0x39
+	.byte	0x33
+	.byte	0xd3
+	.long	0x3e35
+	.uleb128 0x4
+	.long	0x2c8b
+	.uleb128 0xb
+	.long	.LASF3756
+	.byte	0x39
+	.byte	0x33
+	.byte	0x7e
+	.long	0x3e46
+	.uleb128 0x4
+	.long	0x2c97
+	.uleb128 0xb
+	.long	.LASF3757
+	.byte	0x38
+	.byte	0x1c
+	.byte	0xdb
+	.long	0x3e57
+	.uleb128 0x4
+	.long	0x2be0
+	.uleb128 0xb
+	.long	.LASF3758
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x83
+	.long	0x3e68
+	.uleb128 0x4
+	.long	0x2bec
+	.uleb128 0xb
+	.long	.LASF3759
+	.byte	0x37
+	.byte	0x29
+	.byte	0xe3
+	.long	0x3e79
+	.uleb128 0x4
+	.long	0x2b8e
+	.uleb128 0xb
+	.long	.LASF3760
+	.byte	0x37
+	.byte	0x29
+	.byte	0x88
+	.long	0x3e8a
+	.uleb128 0x4
+	.long	0x2b9a
+	.uleb128 0x2e
+	.long	.LASF3761
+	.byte	0x36
+	.byte	0x48
+	.value	0x103
+	.long	0x3e9c
+	.uleb128 0x4
+	.long	0x2b1d
+	.uleb128 0xb
+	.long	.LASF3762
+	.byte	0x36
+	.byte	0x48
+	.byte	0x9c
+	.long	0x3ead
+	.uleb128 0x4
+	.long	0x2b29
+	.uleb128 0xb
+	.long	.LASF3763
+	.byte	0x34
+	.byte	0x2f
+	.byte	0xd3
+	.long	0x3ebe
+	.uleb128 0x4
+	.long	0x2917
+	.uleb128 0xb
+	.long	.LASF3764
+	.byte	0x34
+	.byte	0x2f
+	.byte	0x7e
+	.long	0x3ecf
+	.uleb128 0x4
+	.long	0x2923
+	.uleb128 0x28
+	.long	.LASF3765
+	.byte	0x33
+	.byte	0x4d
+	.value	0x13e
+	.long	0x3ef3
+	.long	0x3ef3
+	.uleb128 0x29
+	.long	.LASF3766
+	.byte	0x33
+	.byte	0x4d
+	.value	0x160
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x2814
+	.uleb128 0x1d
+	.long	.LASF3767
+	.byte	0x33
+	.byte	0x4d
+	.byte	0xbb
+	.long	0x3f15
+	.long	0x3f15
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x33
+	.byte	0x4d
+	.byte	0xd6
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x2820
+	.uleb128 0x2e
+	.long	.LASF3768
+	.byte	0x31
+	.byte	0x58
+	.value	0x13b
+	.long	0x3f27
+	.uleb128 0x4
+	.long	0x2636
+	.uleb128 0xb
+	.long	.LASF3769
+	.byte	0x31
+	.byte	0x58
+	.byte	0xbf
+	.long	0x3f38
+	.uleb128 0x4
+	.long	0x2642
+	.uleb128 0x2e
+	.long	.LASF3770
+	.byte	0x31
+	.byte	0x48
+	.value	0x11b
+	.long	0x3f4a
+	.uleb128 0x4
+	.long	0x25f1
+	.uleb128 0xb
+	.long	.LASF3771
+	.byte	0x31
+	.byte	0x48
+	.byte	0xab
+	.long	0x3f5b
+	.uleb128 0x4
+	.long	0x25fd
+	.uleb128 0xb
+	.long	.LASF3772
+	.byte	0x2e
+	.byte	0x92
+	.byte	0xab
+	.long	0x3f6c
+	.uleb128 0x4
+	.long	0x21ee
+	.uleb128 0xb
+	.long	.LASF3773
+	.byte	0x2e
+	.byte	0x92
+	.byte	0x65
+	.long	0x3f7d
+	.uleb128 0x4
+	.long	0x21fa
+	.uleb128 0x28
+	.long	.LASF3774
+	.byte	0x2e
+	.byte	0x6c
+	.value	0x14c
+	.long	0x3fa1
+	.long	0x3fa1
+	.uleb128 0x29
+	.long	.LASF3766
+	.byte	0x2e
+	.byte	0x6c
+	.value	0x170
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x205e
+	.uleb128 0x1d
+	.long	.LASF3775
+	.byte	0x2e
+	.byte	0x6c
+	.byte	0xc4
+	.long	0x3fc3
+	.long	0x3fc3
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x2e
+	.byte	0x6c
+	.byte	0xe1
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x206a
+	.uleb128 0xb
+	.long	.LASF3776
+	.byte	0x2d
+	.byte	0x7b
+	.byte	0x79
+	.long	0x3fd4
+	.uleb128 0x4
+	.long	0x1ffd
+	.uleb128 0xb
+	.long	.LASF3777
+	.byte	0x2b
+	.byte	0x47
+	.byte	0xb3
+	.long	0x3fe5
+	.uleb128 0x4
+	.long	0x1d17
+	.uleb128 0xb
+	.long	.LASF3778
+	.byte	0x2b
+	.byte	0x47
+	.byte	0x6a
+	.long	0x3ff6
+	.uleb128 0x4
+	.long	0x1d23
+	.uleb128 0x1d
+	.long	.LASF3779
+	.byte	0x2a
+	.byte	0x6f
+	.byte	0xe2
+	.long	0x4018
+	.long	0x4018
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x2a
+	.byte	0x6f
+	.byte	0xf9
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x1be2
+	.uleb128 0x1d
+	.long	.LASF3780
+	.byte	0x2a
+	.byte	0x6f
+	.byte	0x81
+	.long	0x403a
+	.long	0x403a
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x2a
+	.byte	0x6f
+	.byte	0x91
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bee
+	.uleb128 0x28
+	.long	.LASF3781
+	.byte	0x2a
+	.byte	0x5c
+	.value	0x106
+	.long	0x405e
+	.long	0x405e
+	.uleb128 0x29
+	.long	.LASF3766
+	.byte	0x2a
+	.byte	0x5c
+	.value	0x123
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x1b54
+	.uleb128 0x1d
+	.long	.LASF3782
+	.byte	0x2a
+	.byte	0x5c
+	.byte	0x99
+	.long	0x1b81
+	.long	0x4080
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x2a
+	.byte	0x5c
+	.byte	0xaf
+	.long	0x8d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3783
+	.byte	0x1c
+	.byte	0x73
+	.byte	0xb3
+	.long	0x408c
+	.uleb128 0x4
+	.long	0x1a4e
+	.uleb128 0xb
+	.long	.LASF3784
+	.byte	0x1c
+	.byte	0x73
+	.byte	0x6a
+	.long	0x409d
+	.uleb128 0x4
+	.long	0x1a5a
+	.uleb128 0xb
+	.long	.LASF3785
+	.byte	0x28
+	.byte	0x62
+	.byte	0xc3
+	.long	0x40ae
+	.uleb128 0x4
+	.long	0x188e
+	.uleb128 0xb
+	.long	.LASF3786
+	.byte	0x28
+	.byte	0x62
+	.byte	0x74
+	.long	0x40bf
+	.uleb128 0x4
+	.long	0x189a
+	.uleb128 0xb
+	.long	.LASF3787
+	.byte	0x28
+	.byte	0x58
+	.byte	0xc3
+	.long	0x40d0
+	.uleb128 0x4
+	.long	0x1822
+	.uleb128 0xb
+	.long	.LASF3788
+	.byte	0x28
+	.byte	0x58
+	.byte	0x74
+	.long	0x40e1
+	.uleb128 0x4
+	.long	0x182e
+	.uleb128 0xb
+	.long	.LASF3789
+	.byte	0x26
+	.byte	0x29
+	.byte	0xdb
+	.long	0x40f2
+	.uleb128 0x4
+	.long	0x16c6
+	.uleb128 0xb
+	.long	.LASF3790
+	.byte	0x26
+	.byte	0x29
+	.byte	0x83
+	.long	0x4103
+	.uleb128 0x4
+	.long	0x16d2
+	.uleb128 0xb
+	.long	.LASF3791
+	.byte	0x23
+	.byte	0x6a
+	.byte	0xcb
+	.long	0x4114
+	.uleb128 0x4
+	.long	0x1578
+	.uleb128 0xb
+	.long	.LASF3792
+	.byte	0x23
+	.byte	0x6a
+	.byte	0x79
+	.long	0x4125
+	.uleb128 0x4
+	.long	0x1584
+	.uleb128 0xb
+	.long	.LASF3793
+	.byte	0x23
+	.byte	0x62
+	.byte	0xdb
+	.long	0x4136
+	.uleb128 0x4
+	.long	0x1526
+	.uleb128 0xb
+	.long	.LASF3794
+	.byte	0x23
+	.byte	0x62
+	.byte	0x83
+	.long	0x4147
+	.uleb128 0x4
+	.long	0x1532
+	.uleb128 0xb
+	.long	.LASF3795
+	.byte	0x23
+	.byte	0x59
+	.byte	0xeb
+	.long	0x4158
+	.uleb128 0x4
+	.long	0x14c7
+	.uleb128 0xb
+	.long	.LASF3796
+	.byte	0x23
+	.byte	0x59
+	.byte	0x8d
+	.long	0x4169
+	.uleb128 0x4
+	.long	0x14d3
+	.uleb128 0x28
+	.long	.LASF3797
+	.byte	0x22
+	.byte	0x62
+	.value	0x10c
+	.long	0x3747
+	.long	0x418d
+	.uleb128 0x29
+	.long	.LASF3766
+	.byte	0x22
+	.byte	0x62
+	.value	0x128
+	.long	0x8d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3798
+	.byte	0x22
+	.byte	0x62
+	.byte	0x9c
+	.long	0x3a33
+	.long	0x41aa
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x22
+	.byte	0x62
+	.byte	0xb1
+	.long	0x8d
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF3799
+	.byte	0x20
+	.byte	0x5e
+	.value	0x14c
+	.long	0x3742
+	.long	0x41c9
+	.uleb128 0x29
+	.long	.LASF3766
+	.byte	0x20
+	.byte	0x5e
+	.value	0x170
+	.long	0x8d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3800
+	.byte	0x20
+	.byte	0x5e
+	.byte	0xc4
+	.long	0x3a2e
+	.long	0x41e6
+	.uleb128 0x1e
+	.long	.LASF3766
+	.byte	0x20
+	.byte	0x5e
+	.byte	0xe1
+	.long	0x8d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3801
+	.byte	0x1b
+	.byte	0x59
+	.byte	0xcb
+	.long	0x41f2
+	.uleb128 0x4
+	.long	0xef0
+	.uleb128 0xb
+	.long	.LASF3802
+	.byte	0x1b
+	.byte	0x59
+	.byte	0x79
+	.long	0x4203
+	.uleb128 0x4
+	.long	0xefc
+	.uleb128 0x1d
+	.long	.LASF3803
+	.byte	0x46
+	.byte	0x7e
+	.byte	0x13
+	.long	0x8d
+	.long	0x423b
+	.uleb128 0x34
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x8d
+	.uleb128 0x34
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x8d
+	.uleb128 0x1e
+	.long	.LASF3804
+	.byte	0x46
+	.byte	0x7e
+	.byte	0x33
+	.long	0x8d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3805
+	.byte	0x7
+	.byte	0x35
+	.byte	0xdb
+	.long	0x4247
+	.uleb128 0x4
+	.long	0x258
+	.uleb128 0xb
+	.long	.LASF3806
+	.byte	0x7
+	.byte	0x35
+	.byte	0x83
+	.long	0x4258
+	.uleb128 0x4
+	.long	0x264
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 70
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 71 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 72 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 73 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x49
+	.file 74 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 76 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 77 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x4d
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 80 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 82 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x52
+	.file 83 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 89 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 90 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5b
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 100 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x64
+	.file 101 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 102 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.file 103 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1411
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1412
+	.byte	0x4
+	.file 104 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x68
+	.file 105 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 106 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xc
+	.byte	0x4
+	.file 107 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1482
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3d
+	.byte	0x4
+	.file 108 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x11
+	.file 109 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6d
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.file 110 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 111 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1668
+	.file 112 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1670
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1671
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1680
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x75
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x76
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1685
+	.byte	0x4
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x77
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 120 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x79
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0x4
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0x4
+	.file 124 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x7c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0x4
+	.file 125 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x7d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1721
+	.byte	0x4
+	.file 126 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x7e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1722
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1723
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1724
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1725
+	.file 127 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x7f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1726
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 128 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x80
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1738
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 129 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x81
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1745
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1746
+	.byte	0x4
+	.file 130 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x82
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1747
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 131 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 132 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x84
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1750
+	.byte	0x4
+	.file 133 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x85
+	.file 134 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x86
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1751
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 135 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x87
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1782
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x16
+	.byte	0x4
+	.file 136 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x88
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.file 137 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x89
+	.file 138 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 139 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x8b
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 140 "./src/main/drivers/max7456.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x8c
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2204
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 141 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x8d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2211
+	.byte	0x4
+	.file 142 "./src/main/drivers/serial_escserial.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x8e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2212
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x43
+	.byte	0x4
+	.file 143 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x8f
+	.byte	0x4
+	.file 144 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x90
+	.byte	0x4
+	.file 145 "./src/main/drivers/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x91
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x1b
+	.file 146 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x92
+	.byte	0x4
+	.file 147 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x93
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 148 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x94
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2248
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2249
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 149 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x95
+	.file 150 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x96
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x4
+	.file 151 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x97
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 152 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x98
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2352
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.file 153 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x99
+	.byte	0x4
+	.file 154 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x9a
+	.byte	0x4
+	.file 155 "./src/main/io/osd_slave.h"
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x9b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.file 156 "./src/main/io/serial_4way.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x9c
+	.file 157 "./src/main/io/serial_4way_impl.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9d
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 158 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x9e
+	.byte	0x4
+	.file 159 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x9f
+	.byte	0x4
+	.file 160 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0xa0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2420
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x44
+	.byte	0x4
+	.file 161 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0xa1
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.file 162 "./src/main/msp/msp_serial.h"
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xa2
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x62
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x64
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x66
+	.uleb128 0x34
+	.file 163 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa3
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x68
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x69
+	.uleb128 0x37
+	.file 164 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2636
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2637
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6a
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.file 165 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x6e
+	.uleb128 0xa5
+	.file 166 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa6
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2645
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x70
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2646
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF2649
+	.byte	0x2
+	.uleb128 0x1bb
+	.string	"BME"
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2650
+	.byte	0x2
+	.uleb128 0x1eb
+	.string	"BM"
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2655
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1437
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.cda5e1a8f37a08b4f46fc428ef372810,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1667
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1679
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1684
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1702
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1717
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1772
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1781
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1816
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2196
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.max7456.h.21.59264cd1e20507bb3a63ba829e3208aa,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2203
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2210
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.transponder_ir.h.23.b50bed893bc0dbf7b1e0fb37ef14e2d7,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2242
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2247
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2257
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2287
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2325
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2346
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.21.42b0efe26f2c975d82840e6ab4f40d87,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2360
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2406
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_4way_impl.h.35.bea0096e583bd744c4600d9fb7b88c62,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2412
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_4way.h.23.140f97ae73637ff558cf2c22b49f54ce,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.59.465b2f7532a4846ee89798d0d344cbd1,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2635
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2644
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.long	.LASF1
+	.long	.LASF3809
+	.long	.LASF3810
+	.long	.LASF3811
+	.long	.LASF3812
+	.long	.LASF3813
+	.long	.LASF3814
+	.long	.LASF3815
+	.long	.LASF3816
+	.long	.LASF3817
+	.long	.LASF3818
+	.long	.LASF3819
+	.long	.LASF3820
+	.long	.LASF3821
+	.long	.LASF3822
+	.long	.LASF3823
+	.long	.LASF3824
+	.long	.LASF3825
+	.long	.LASF3826
+	.long	.LASF3827
+	.long	.LASF3828
+	.long	.LASF3829
+	.long	.LASF3830
+	.long	.LASF3831
+	.long	.LASF3832
+	.long	.LASF3833
+	.long	.LASF3834
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0xa7
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3835
+	.byte	0x16
+	.long	.LASF3836
+	.byte	0x16
+	.long	.LASF3837
+	.byte	0x16
+	.long	.LASF3838
+	.byte	0x1a
+	.long	.LASF3839
+	.byte	0x11
+	.long	.LASF3840
+	.byte	0x3
+	.long	.LASF3841
+	.byte	0x1
+	.long	.LASF3842
+	.byte	0x2
+	.long	.LASF3843
+	.byte	0x2
+	.long	.LASF3844
+	.byte	0x3
+	.long	.LASF3845
+	.byte	0x3
+	.long	.LASF3846
+	.byte	0x3
+	.long	.LASF3847
+	.byte	0x8
+	.long	.LASF3848
+	.byte	0x8
+	.long	.LASF3849
+	.byte	0x8
+	.long	.LASF3850
+	.byte	0x8
+	.long	.LASF3851
+	.byte	0x5
+	.long	.LASF3852
+	.byte	0x5
+	.long	.LASF3853
+	.byte	0x16
+	.long	.LASF3854
+	.byte	0x16
+	.long	.LASF3855
+	.byte	0x16
+	.long	.LASF3856
+	.byte	0x8
+	.long	.LASF3857
+	.byte	0x8
+	.long	.LASF3858
+	.byte	0x8
+	.long	.LASF3859
+	.byte	0x8
+	.long	.LASF3860
+	.byte	0x8
+	.long	.LASF3861
+	.byte	0x9
+	.long	.LASF3862
+	.byte	0xa
+	.long	.LASF3863
+	.byte	0x9
+	.long	.LASF3864
+	.byte	0x9
+	.long	.LASF3865
+	.byte	0xd
+	.long	.LASF3866
+	.byte	0x9
+	.long	.LASF3867
+	.byte	0x9
+	.long	.LASF3868
+	.byte	0x9
+	.long	.LASF3869
+	.byte	0x9
+	.long	.LASF3870
+	.byte	0x9
+	.long	.LASF3871
+	.byte	0xa
+	.long	.LASF3872
+	.byte	0xa
+	.long	.LASF3873
+	.byte	0xa
+	.long	.LASF3874
+	.byte	0xa
+	.long	.LASF3875
+	.byte	0xa
+	.long	.LASF3876
+	.byte	0xa
+	.long	.LASF3877
+	.byte	0xc
+	.long	.LASF3878
+	.byte	0xc
+	.long	.LASF3860
+	.byte	0xc
+	.long	.LASF3879
+	.byte	0xe
+	.long	.LASF3880
+	.byte	0xf
+	.long	.LASF3881
+	.byte	0x10
+	.long	.LASF3882
+	.byte	0x10
+	.long	.LASF3883
+	.byte	0x10
+	.long	.LASF3884
+	.byte	0x10
+	.long	.LASF3885
+	.byte	0x10
+	.long	.LASF3886
+	.byte	0x10
+	.long	.LASF3887
+	.byte	0x10
+	.long	.LASF3888
+	.byte	0x10
+	.long	.LASF3889
+	.byte	0x10
+	.long	.LASF3890
+	.byte	0x10
+	.long	.LASF3891
+	.byte	0x10
+	.long	.LASF3892
+	.byte	0x13
+	.long	.LASF3893
+	.byte	0x9
+	.long	.LASF3894
+	.byte	0x4
+	.long	.LASF3895
+	.byte	0xc
+	.long	.LASF3896
+	.byte	0x9
+	.long	.LASF3865
+	.byte	0xe
+	.long	.LASF3897
+	.byte	0xd
+	.long	.LASF3898
+	.byte	0x19
+	.long	.LASF3899
+	.byte	0x8
+	.long	.LASF3900
+	.byte	0xd
+	.long	.LASF3901
+	.byte	0x3
+	.long	.LASF3902
+	.byte	0x3
+	.long	.LASF3903
+	.byte	0x19
+	.long	.LASF3904
+	.byte	0x1a
+	.long	.LASF3905
+	.byte	0x1a
+	.long	.LASF3905
+	.byte	0x19
+	.long	.LASF3906
+	.byte	0x16
+	.long	.LASF3907
+	.byte	0x19
+	.long	.LASF3908
+	.byte	0x19
+	.long	.LASF3909
+	.byte	0x16
+	.long	.LASF3910
+	.byte	0x16
+	.long	.LASF3911
+	.byte	0x18
+	.long	.LASF3912
+	.byte	0x16
+	.long	.LASF3913
+	.byte	0x17
+	.long	.LASF3914
+	.byte	0x17
+	.long	.LASF3915
+	.byte	0x16
+	.long	.LASF3916
+	.byte	0x16
+	.long	.LASF3917
+	.byte	0x16
+	.long	.LASF3918
+	.byte	0x15
+	.long	.LASF3919
+	.byte	0x15
+	.long	.LASF3920
+	.byte	0x19
+	.long	.LASF3921
+	.byte	0x19
+	.long	.LASF3922
+	.byte	0x16
+	.long	.LASF3923
+	.byte	0x16
+	.long	.LASF3924
+	.byte	0x16
+	.long	.LASF3925
+	.byte	0x16
+	.long	.LASF3926
+	.byte	0x16
+	.long	.LASF3927
+	.byte	0x16
+	.long	.LASF3928
+	.byte	0x16
+	.long	.LASF3929
+	.byte	0x16
+	.long	.LASF3930
+	.byte	0x16
+	.long	.LASF3931
+	.byte	0x14
+	.long	.LASF3932
+	.byte	0x12
+	.long	.LASF3933
+	.byte	0x12
+	.long	.LASF3934
+	.byte	0x1
+	.long	.LASF3935
+	.byte	0x4
+	.long	.LASF3936
+	.byte	0x2
+	.long	.LASF3937
+	.byte	0x2
+	.long	.LASF3938
+	.byte	0x4
+	.long	.LASF3939
+	.byte	0x4
+	.long	.LASF3940
+	.byte	0x8
+	.long	.LASF3941
+	.byte	0x8
+	.long	.LASF3942
+	.byte	0x19
+	.long	.LASF3943
+	.byte	0x19
+	.long	.LASF3944
+	.byte	0x15
+	.long	.LASF3945
+	.byte	0x15
+	.long	.LASF3946
+	.byte	0x16
+	.long	.LASF3947
+	.byte	0x16
+	.long	.LASF3943
+	.byte	0x16
+	.long	.LASF3948
+	.byte	0x15
+	.long	.LASF3949
+	.byte	0x16
+	.long	.LASF3840
+	.byte	0x19
+	.long	.LASF3840
+	.byte	0x16
+	.long	.LASF3950
+	.byte	0x15
+	.long	.LASF3951
+	.byte	0x15
+	.long	.LASF3952
+	.byte	0x15
+	.long	.LASF3953
+	.byte	0x15
+	.long	.LASF3954
+	.byte	0x15
+	.long	.LASF3955
+	.byte	0x16
+	.long	.LASF3956
+	.byte	0x16
+	.long	.LASF3957
+	.byte	0x16
+	.long	.LASF3958
+	.byte	0x16
+	.long	.LASF3959
+	.byte	0x15
+	.long	.LASF3960
+	.byte	0x15
+	.long	.LASF3961
+	.byte	0x16
+	.long	.LASF3962
+	.byte	0x16
+	.long	.LASF3890
+	.byte	0x7
+	.long	.LASF3963
+	.byte	0x8
+	.long	.LASF3964
+	.byte	0x8
+	.long	.LASF3965
+	.byte	0x3
+	.long	.LASF3966
+	.byte	0x8
+	.long	.LASF3967
+	.byte	0x8
+	.long	.LASF3968
+	.byte	0x8
+	.long	.LASF3969
+	.byte	0x8
+	.long	.LASF3970
+	.byte	0x8
+	.long	.LASF3971
+	.byte	0x8
+	.long	.LASF3972
+	.byte	0x8
+	.long	.LASF3973
+	.byte	0x8
+	.long	.LASF3974
+	.byte	0x8
+	.long	.LASF3975
+	.byte	0x8
+	.long	.LASF3976
+	.byte	0xb
+	.long	.LASF3977
+	.byte	0xb
+	.long	.LASF3978
+	.byte	0xc
+	.long	.LASF3979
+	.byte	0xc
+	.long	.LASF3980
+	.byte	0xc
+	.long	.LASF3981
+	.byte	0xc
+	.long	.LASF3982
+	.byte	0xc
+	.long	.LASF3983
+	.byte	0xc
+	.long	.LASF3984
+	.byte	0xc
+	.long	.LASF3876
+	.byte	0xc
+	.long	.LASF3972
+	.byte	0xc
+	.long	.LASF3985
+	.byte	0xc
+	.long	.LASF3986
+	.byte	0xd
+	.long	.LASF3987
+	.byte	0xd
+	.long	.LASF3988
+	.byte	0x3
+	.long	.LASF3888
+	.byte	0x6
+	.long	.LASF3989
+	.byte	0x10
+	.long	.LASF3990
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2899:
+	.string	"txBufferTail"
+.LASF3005:
+	.string	"BOXMAG"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF3017:
+	.string	"BOXCALIB"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF3634:
+	.string	"flashfsReadAbs"
+.LASF3591:
+	.string	"gpsNoFixLatitude"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2385:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2896:
+	.string	"rxBufferHead"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF2498:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF3701:
+	.string	"portConfig"
+.LASF2408:
+	.string	"ESC_IS_LO isEscLo(selected_esc)"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF3130:
+	.string	"MIXER_HEX6X"
+.LASF2147:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2466:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF1855:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1835:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF2505:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF1997:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2315:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF2861:
+	.string	"enabled"
+.LASF2179:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2098:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1459:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2454:
+	.string	"MSP_SET_BATTERY_CONFIG 33"
+.LASF3106:
+	.string	"failsafeConfig_s"
+.LASF3113:
+	.string	"failsafeConfig_t"
+.LASF2025:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1538:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF3359:
+	.string	"TASK_RX"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF2545:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF2337:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF2705:
+	.string	"RGB_GREEN"
+.LASF3552:
+	.string	"boardAlignment_System"
+.LASF2752:
+	.string	"mpuConfiguration_s"
+.LASF2756:
+	.string	"mpuConfiguration_t"
+.LASF3304:
+	.string	"sbus_inversion"
+.LASF2659:
+	.string	"long unsigned int"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF2575:
+	.string	"MSP_DATAFLASH_READ_STREAM 153"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1992:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF3218:
+	.string	"middle"
+.LASF1304:
+	.string	"GYRO "
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF3741:
+	.string	"boxIdx"
+.LASF3092:
+	.string	"HEADFREE_MODE"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2196:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF3010:
+	.string	"BOXGPSHOME"
+.LASF2060:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2925:
+	.string	"FEATURE_RX_MSP"
+.LASF2939:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF1771:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2704:
+	.string	"RGB_RED"
+.LASF1579:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF3788:
+	.string	"mixerConfig"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2711:
+	.string	"sbuf_t"
+.LASF2556:
+	.string	"MSP_SET_MOTOR 214"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2800:
+	.string	"pageSize"
+.LASF1615:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF392:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF2956:
+	.string	"pidSumLimitYaw"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1473:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2354:
+	.string	"LON 1"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2589:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF1673:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2300:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1561:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF2404:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF3339:
+	.string	"startLatency"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF2699:
+	.string	"buildDate"
+.LASF2984:
+	.string	"dynThrPID"
+.LASF3746:
+	.string	"activeBoxIdGet"
+.LASF3066:
+	.string	"alt_hold_fast_change"
+.LASF2043:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2650:
+	.string	"BM(x) (1ULL << (x))"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF3627:
+	.string	"generateThrottleCurve"
+.LASF3282:
+	.string	"serialPortConfig_s"
+.LASF3288:
+	.string	"serialPortConfig_t"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1942:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF3068:
+	.string	"rcControlsConfig_t"
+.LASF2600:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF3311:
+	.string	"spektrum_sat_bind"
+.LASF1886:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF3684:
+	.string	"memset"
+.LASF2389:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2304:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2528:
+	.string	"MSP_BOXNAMES 116"
+.LASF3343:
+	.string	"isEnabled"
+.LASF3138:
+	.string	"MIXER_HEX6H"
+.LASF3091:
+	.string	"GPS_HOLD_MODE"
+.LASF2204:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF3654:
+	.string	"convertMotorToExternal"
+.LASF1731:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1626:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF2723:
+	.string	"deviceI2C_s"
+.LASF2386:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF1878:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2094:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2485:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF2283:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2962:
+	.string	"horizon_tilt_effect"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2615:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF3447:
+	.string	"VOLTAGE_METER_ID_12V_2"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF3264:
+	.string	"specialColorIndexes_s"
+.LASF3265:
+	.string	"specialColorIndexes_t"
+.LASF3029:
+	.string	"BOX3DDISABLE"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF3556:
+	.string	"mag_t"
+.LASF2640:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF1600:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF3084:
+	.string	"WAS_EVER_ARMED"
+.LASF2306:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1974:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF3550:
+	.string	"yawDegrees"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF2336:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF2609:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1905:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF3774:
+	.string	"rxFailsafeChannelConfigsMutable"
+.LASF2945:
+	.string	"name"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF3012:
+	.string	"BOXPASSTHRU"
+.LASF3207:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF3465:
+	.string	"VOLTAGE_METER_ID_CELL_2"
+.LASF1632:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF3386:
+	.string	"CURRENT_METER_ID_9V_10"
+.LASF2967:
+	.string	"dtermSetpointWeight"
+.LASF1815:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF2200:
+	.string	"VIDEO_BUFFER_CHARS_NTSC 390"
+.LASF2633:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1633:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF2850:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2621:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF1603:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF3174:
+	.string	"PID_POSR"
+.LASF1489:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1895:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1863:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF3632:
+	.string	"changePidProfile"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2996:
+	.string	"result"
+.LASF2975:
+	.string	"crash_recovery"
+.LASF1427:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2214:
+	.string	"TRANSPONDER_DATA_LENGTH_ARCITIMER 9"
+.LASF2164:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2549:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF1477:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF3089:
+	.string	"BARO_MODE"
+.LASF2302:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1471:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1518:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1647:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2569:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2382:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF3600:
+	.string	"pidValuesAsTelemetry"
+.LASF1890:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF3249:
+	.string	"GPS_altitude"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF3771:
+	.string	"currentSensorADCConfig"
+.LASF1751:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2736:
+	.string	"sensorAccInitFuncPtr"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF2642:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2546:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF3240:
+	.string	"sbasMode"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1413:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF3728:
+	.string	"geometry"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2963:
+	.string	"horizon_tilt_expert_mode"
+.LASF2384:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF3296:
+	.string	"rcData"
+.LASF3451:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_1"
+.LASF2460:
+	.string	"MSP_SET_BOARD_ALIGNMENT_CONFIG 39"
+.LASF3804:
+	.string	"high"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF2233:
+	.string	"TRANSPONDER_DATA_LENGTH_ERLT 1"
+.LASF2819:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF3043:
+	.string	"endStep"
+.LASF1819:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF3462:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_12"
+.LASF1937:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1940:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF3223:
+	.string	"GPS_NMEA"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2126:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1965:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2497:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF3622:
+	.string	"validateAndFixGyroConfig"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2252:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2997:
+	.string	"direction"
+.LASF2350:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF3507:
+	.string	"BATTERY_CRITICAL"
+.LASF1683:
+	.string	"SCHED_FIFO 1"
+.LASF3751:
+	.string	"serialPort"
+.LASF2015:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF3312:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF2177:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2330:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF3072:
+	.string	"deadband3d_high"
+.LASF2464:
+	.string	"MSP_SET_MIXER_CONFIG 43"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2089:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1487:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1494:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2770:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF3098:
+	.string	"flightModeFlags"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2574:
+	.string	"MSP_TRACE_READ 152"
+.LASF3143:
+	.string	"MIXER_CUSTOM"
+.LASF2257:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF2586:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF3651:
+	.string	"blackboxMayEditConfig"
+.LASF3310:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF3740:
+	.string	"serializeBox"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2332:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF3742:
+	.string	"pageStart"
+.LASF1988:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF3350:
+	.string	"maxStartLatency"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1654:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF3682:
+	.string	"feature"
+.LASF2076:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF3114:
+	.string	"failsafeConfig_System"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1690:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF3706:
+	.string	"mspFcWpCommand"
+.LASF3683:
+	.string	"bitArraySet"
+.LASF3580:
+	.string	"dyn_notch_window"
+.LASF1529:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1809:
+	.string	"BIT(x) (1 << (x))"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF3666:
+	.string	"getBatteryCellCount"
+.LASF2345:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF2886:
+	.string	"serialPort_s"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2912:
+	.string	"serialPort_t"
+.LASF3241:
+	.string	"autoConfig"
+.LASF1993:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF3195:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF2167:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF3331:
+	.string	"channelCount"
+.LASF2581:
+	.string	"MSP_UID 160"
+.LASF2103:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1768:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF3118:
+	.string	"attitudeEulerAngles_t"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1593:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2024:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF2788:
+	.string	"__spins"
+.LASF3608:
+	.string	"pidnames"
+.LASF2708:
+	.string	"hsvColor_s"
+.LASF2709:
+	.string	"hsvColor_t"
+.LASF3662:
+	.string	"stopPwmAllMotors"
+.LASF2244:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2277:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF3007:
+	.string	"BOXHEADADJ"
+.LASF2296:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF3719:
+	.string	"currentMeterCount"
+.LASF3793:
+	.string	"flight3DConfigMutable"
+.LASF3647:
+	.string	"flashfsIsReady"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF3173:
+	.string	"PID_POS"
+.LASF3523:
+	.string	"accSamplingInterval"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF3759:
+	.string	"barometerConfigMutable"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2482:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF2552:
+	.string	"MSP_SET_WP 209"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1713:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF3148:
+	.string	"yaw_motors_reversed"
+.LASF3131:
+	.string	"MIXER_OCTOX8"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1540:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF3779:
+	.string	"servoParamsMutable"
+.LASF1616:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF3703:
+	.string	"readLength"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2202:
+	.string	"VIDEO_LINES_NTSC 13"
+.LASF2117:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2175:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1676:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF3353:
+	.string	"cfTaskInfo_t"
+.LASF2813:
+	.string	"OWNER_ADC_EXT"
+.LASF1929:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2090:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"HSV_VALUE_MAX 255"
+.LASF2993:
+	.string	"MSP_RESULT_CMD_UNKNOWN"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF2494:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF514:
+	.string	"__wur "
+.LASF2287:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1526:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1941:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2873:
+	.string	"MODE_RXTX"
+.LASF1790:
+	.string	"IOCFG_IPD 0"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1596:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1982:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2137:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1630:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF1701:
+	.string	"sched_priority sched_priority"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF2201:
+	.string	"VIDEO_BUFFER_CHARS_PAL 480"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF2192:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF1659:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2802:
+	.string	"totalSize"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF3433:
+	.string	"currentSensorVirtualConfig_System"
+.LASF2418:
+	.string	"imSK 3"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF3723:
+	.string	"size"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF2582:
+	.string	"MSP_GPSSVINFO 164"
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF2120:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1959:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF3510:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF3335:
+	.string	"rcFrameStatusFnPtr"
+.LASF1557:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2357:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF3636:
+	.string	"sbufReadU16"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1560:
+	.string	"PG_I2C_CONFIG 518"
+.LASF3224:
+	.string	"GPS_UBLOX"
+.LASF3059:
+	.string	"adjustmentIndex"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF3643:
+	.string	"sbufReadU8"
+.LASF1956:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF3407:
+	.string	"CURRENT_METER_ID_MSP_1"
+.LASF3408:
+	.string	"CURRENT_METER_ID_MSP_2"
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF3229:
+	.string	"SBAS_MSAS"
+.LASF3309:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1877:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2986:
+	.string	"tpa_breakpoint"
+.LASF3344:
+	.string	"staticPriority"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF1952:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2503:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF2225:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ILAP 11"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1549:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1551:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2259:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2388:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF3805:
+	.string	"blackboxConfigMutable"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1785:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2895:
+	.string	"txBuffer"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF2836:
+	.string	"OWNER_MPU_EXTI"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF3032:
+	.string	"BOXCAMERA1"
+.LASF1869:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF3034:
+	.string	"BOXCAMERA3"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF3058:
+	.string	"auxSwitchChannelIndex"
+.LASF2588:
+	.string	"MSP_SET_4WAY_IF 245"
+.LASF3783:
+	.string	"pidConfigMutable"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2486:
+	.string	"MSP_REBOOT 68"
+.LASF2678:
+	.string	"size_t"
+.LASF3267:
+	.string	"modeColors"
+.LASF1570:
+	.string	"IO_TAG_NONE 0"
+.LASF2161:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF3637:
+	.string	"sbufReadU32"
+.LASF2108:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF3318:
+	.string	"maxcheck"
+.LASF3614:
+	.string	"flashfsEraseAsync"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1838:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2397:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF721:
+	.string	"NULL"
+.LASF2754:
+	.string	"resetFn"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF1555:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF3676:
+	.string	"mspDataflashStreamAckCommand"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2807:
+	.string	"OWNER_MOTOR"
+.LASF1609:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2406:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF3446:
+	.string	"VOLTAGE_METER_ID_12V_1"
+.LASF1774:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1439:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF3200:
+	.string	"INPUT_RC_THROTTLE"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2910:
+	.string	"beginWrite"
+.LASF3732:
+	.string	"mspFlightModeFlags"
+.LASF723:
+	.string	"__need_NULL"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF3440:
+	.string	"VOLTAGE_METER_ID_5V_1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3314:
+	.string	"rssi_scale"
+.LASF3624:
+	.string	"loadCustomServoMixer"
+.LASF1492:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF2761:
+	.string	"MPU_65xx_I2C"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2152:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2628:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF2812:
+	.string	"OWNER_ADC_CURR"
+.LASF1652:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1973:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF3499:
+	.string	"useVBatAlerts"
+.LASF2535:
+	.string	"MSP_MOTOR_3D_CONFIG 124"
+.LASF3504:
+	.string	"batteryConfig_System"
+.LASF2496:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF1516:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF3087:
+	.string	"HORIZON_MODE"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF3086:
+	.string	"ANGLE_MODE"
+.LASF1505:
+	.string	"PG_RX_CONFIG 24"
+.LASF3159:
+	.string	"motor_disarmed"
+.LASF3737:
+	.string	"mspBoxIdx"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF2440:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF3603:
+	.string	"telemetryConfig_System"
+.LASF3483:
+	.string	"vbatscale"
+.LASF1691:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1629:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF3023:
+	.string	"BOXSERVO1"
+.LASF1837:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3025:
+	.string	"BOXSERVO3"
+.LASF3573:
+	.string	"gyro_use_32khz"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2378:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF2029:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2958:
+	.string	"vbatPidCompensation"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2247:
+	.string	"BEEP_ON do {} while (0)"
+.LASF2772:
+	.string	"mpu6050Resolution_e"
+.LASF2998:
+	.string	"mspPacket_t"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2311:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF1735:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF3619:
+	.string	"resetEEPROM"
+.LASF2624:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF3721:
+	.string	"osdFlags"
+.LASF2465:
+	.string	"MSP_RX_CONFIG 44"
+.LASF2058:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2286:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1697:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF2512:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF3670:
+	.string	"getMAhDrawn"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2644:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1483:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF3246:
+	.string	"gpsLocation_t"
+.LASF2703:
+	.string	"FD_YAW"
+.LASF2141:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2817:
+	.string	"OWNER_PINDEBUG"
+.LASF1976:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1742:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2396:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2859:
+	.string	"pulseOffset"
+.LASF3494:
+	.string	"vbatwarningcellvoltage"
+.LASF2806:
+	.string	"OWNER_PPMINPUT"
+.LASF3560:
+	.string	"mag_hardware"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF3449:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_1"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1761:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF3136:
+	.string	"MIXER_HELI_90_DEG"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF3631:
+	.string	"changeControlRateProfile"
+.LASF1531:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2502:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF2866:
+	.string	"motorPwmInversion"
+.LASF3183:
+	.string	"pidCrashRecovery_e"
+.LASF2391:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1545:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1689:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1743:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2909:
+	.string	"writeBuf"
+.LASF2154:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1887:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF3147:
+	.string	"mixerConfig_s"
+.LASF3149:
+	.string	"mixerConfig_t"
+.LASF1719:
+	.string	"__struct_tm_defined 1"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1784:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1688:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF3380:
+	.string	"CURRENT_METER_ID_BATTERY_10"
+.LASF2075:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2566:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF3297:
+	.string	"rxFailsafeChannelConfig_s"
+.LASF3797:
+	.string	"adjustmentRangesMutable"
+.LASF2687:
+	.string	"rate_num"
+.LASF2785:
+	.string	"__owner"
+.LASF1698:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF2638:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF3221:
+	.string	"servoParams_SystemArray"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2210:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF2127:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1964:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF2188:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF3410:
+	.string	"CURRENT_METER_NONE"
+.LASF1662:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF2781:
+	.string	"__pthread_list_t"
+.LASF3111:
+	.string	"failsafe_throttle_low_delay"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3320:
+	.string	"rcInterpolationChannels"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF3792:
+	.string	"armingConfig"
+.LASF2102:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2067:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF3601:
+	.string	"report_cell_voltage"
+.LASF1938:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2446:
+	.string	"MSP_API_VERSION 1"
+.LASF1826:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF2697:
+	.string	"debug"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1517:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF3596:
+	.string	"frsky_unit"
+.LASF1980:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF3442:
+	.string	"VOLTAGE_METER_ID_5V_10"
+.LASF1723:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF3415:
+	.string	"CURRENT_METER_MAX"
+.LASF1642:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1840:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2577:
+	.string	"MSP_DATAFLASH_STREAM_ACK 155"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2906:
+	.string	"serialSetBaudRate"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2272:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF3125:
+	.string	"MIXER_GIMBAL"
+.LASF2461:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF2662:
+	.string	"__uint8_t"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1780:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF2587:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF2790:
+	.string	"__list"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF3046:
+	.string	"modeId"
+.LASF2518:
+	.string	"MSP_SERVO 103"
+.LASF1734:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2270:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF3798:
+	.string	"adjustmentRanges"
+.LASF1732:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF2289:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2744:
+	.string	"lock"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1752:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF2948:
+	.string	"pidProfile_s"
+.LASF3186:
+	.string	"pidProfile_t"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF382:
+	.string	"unix 1"
+.LASF1846:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1664:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF3496:
+	.string	"voltageMeterSource"
+.LASF3145:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF3620:
+	.string	"pidInitFilters"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF3609:
+	.string	"serializeBoxFn"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF2989:
+	.string	"magHold"
+.LASF2689:
+	.string	"device"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF3356:
+	.string	"TASK_PID"
+.LASF2880:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF2845:
+	.string	"OWNER_TRANSPONDER"
+.LASF1782:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF1949:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF3100:
+	.string	"GPS_FIX"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2917:
+	.string	"FEATURE_SERVO_TILT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF3726:
+	.string	"bytesRead"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF2235:
+	.string	"ERLTCyclesForOneBit 25"
+.LASF1733:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF3003:
+	.string	"BOXBARO"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF2533:
+	.string	"MSP_NAV_STATUS 121"
+.LASF3485:
+	.string	"vbatresdivmultiplier"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2044:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1562:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1617:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1539:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1807:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF1955:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1773:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2760:
+	.string	"MPU_60x0_SPI"
+.LASF2294:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF555:
+	.string	"__stub_stty "
+.LASF2622:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF2839:
+	.string	"OWNER_USB_DETECT"
+.LASF2197:
+	.string	"WHITEBRIGHTNESS 0x01"
+.LASF2062:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2292:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF1830:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2346:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF3549:
+	.string	"pitchDegrees"
+.LASF3285:
+	.string	"gps_baudrateIndex"
+.LASF2560:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2827:
+	.string	"OWNER_SDCARD"
+.LASF2046:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1799:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF3002:
+	.string	"BOXHORIZON"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2290:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2844:
+	.string	"OWNER_LED_STRIP"
+.LASF2882:
+	.string	"SERIAL_BIDIR"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1983:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2992:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2928:
+	.string	"FEATURE_DASHBOARD"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF3677:
+	.string	"mspDataflashReadStreamCommand"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF1789:
+	.string	"IOCFG_AF_OD 0"
+.LASF2849:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF2769:
+	.string	"mpuSensor_e"
+.LASF3080:
+	.string	"auto_disarm_delay"
+.LASF3124:
+	.string	"MIXER_BICOPTER"
+.LASF3615:
+	.string	"writeEEPROM"
+.LASF2169:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF3248:
+	.string	"numSat"
+.LASF2234:
+	.string	"ERLTBitQuiet 0"
+.LASF3030:
+	.string	"BOXFPVANGLEMIX"
+.LASF3206:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF3470:
+	.string	"VOLTAGE_METER_ESC"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1509:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2980:
+	.string	"rcExpo8"
+.LASF2410:
+	.string	"ESC_SET_LO setEscLo(selected_esc)"
+.LASF3139:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2173:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1648:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF2898:
+	.string	"txBufferHead"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF3663:
+	.string	"currentMeterRead"
+.LASF3744:
+	.string	"serializeBoxPermanentIdFn"
+.LASF2750:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2611:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2041:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2885:
+	.string	"serialReceiveCallbackPtr"
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF3686:
+	.string	"batteryVoltage"
+.LASF1544:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1860:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF3536:
+	.string	"accelerometerTrims"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2686:
+	.string	"timeUs_t"
+.LASF2526:
+	.string	"MSP_RC_TUNING 111"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3639:
+	.string	"getTaskHistogram"
+.LASF2538:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF3019:
+	.string	"BOXOSD"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2205:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2603:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF3194:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2438:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF3021:
+	.string	"BOXGTUNE"
+.LASF2804:
+	.string	"OWNER_FREE"
+.LASF380:
+	.string	"__unix 1"
+.LASF2172:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2511:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2801:
+	.string	"sectorSize"
+.LASF1817:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2630:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF3650:
+	.string	"serialIsPortAvailable"
+.LASF2353:
+	.string	"LAT 0"
+.LASF2437:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF2355:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1675:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2220:
+	.string	"TRANSPONDER_CARRIER_HZ_ARCITIMER 41886"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1995:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2416:
+	.string	"imSIL_BLB 1"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2523:
+	.string	"MSP_ATTITUDE 108"
+.LASF3354:
+	.string	"TASK_SYSTEM"
+.LASF1643:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1814:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF2403:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2017:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF3168:
+	.string	"nav_mode"
+.LASF3302:
+	.string	"rcmap"
+.LASF3182:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF3329:
+	.string	"rcReadRawDataFnPtr"
+.LASF2193:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2070:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2032:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1781:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2401:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF3437:
+	.string	"VOLTAGE_METER_ID_BATTERY_1"
+.LASF2911:
+	.string	"endWrite"
+.LASF3581:
+	.string	"dyn_notch_peaks"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1812:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2652:
+	.string	"OSD_FLAGS_OSD_SLAVE (1 << 1)"
+.LASF3378:
+	.string	"CURRENT_METER_ID_BATTERY_1"
+.LASF3379:
+	.string	"CURRENT_METER_ID_BATTERY_2"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF2230:
+	.string	"TRANSPONDER_CARRIER_HZ_ILAP 460750"
+.LASF3534:
+	.string	"acc_hardware"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2118:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1695:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2960:
+	.string	"levelAngleLimit"
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF2325:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF1850:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2595:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF3553:
+	.string	"mag_s"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF3090:
+	.string	"GPS_HOME_MODE"
+.LASF3484:
+	.string	"vbatresdivval"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF2821:
+	.string	"OWNER_SYSTEM"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF2685:
+	.string	"timeDelta_t"
+.LASF3790:
+	.string	"failsafeConfig"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF3780:
+	.string	"servoParams"
+.LASF1511:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF3219:
+	.string	"forwardFromChannel"
+.LASF3595:
+	.string	"frsky_coordinate_format"
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF3420:
+	.string	"mAhDrawn"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF3753:
+	.string	"gyroConfigMutable"
+.LASF1580:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF3328:
+	.string	"rxConfig_System"
+.LASF3493:
+	.string	"vbatmincellvoltage"
+.LASF2599:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF3222:
+	.string	"servo"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2594:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF3064:
+	.string	"yaw_deadband"
+.LASF2176:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2559:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF3623:
+	.string	"resetPidProfile"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2567:
+	.string	"MSP_RESERVE_1 251"
+.LASF2947:
+	.string	"systemConfig_System"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF3720:
+	.string	"virtualSensorSubframeLength"
+.LASF2462:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF1714:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1568:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1444:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2145:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1985:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF3680:
+	.string	"isMotorProtocolDshot"
+.LASF1650:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1436:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF2163:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2935:
+	.string	"FEATURE_RX_SPI"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1818:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2066:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF3135:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF3109:
+	.string	"failsafe_throttle"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2305:
+	.string	"ALL_MOTORS 255"
+.LASF1816:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF3658:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF1639:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF3604:
+	.string	"flightControllerIdentifier"
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF1841:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2808:
+	.string	"OWNER_SERVO"
+.LASF3544:
+	.string	"baro_cf_alt"
+.LASF1565:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF3319:
+	.string	"rcInterpolation"
+.LASF3270:
+	.string	"SERIAL_PORT_USART1"
+.LASF3271:
+	.string	"SERIAL_PORT_USART2"
+.LASF3272:
+	.string	"SERIAL_PORT_USART3"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF3277:
+	.string	"SERIAL_PORT_USART8"
+.LASF2467:
+	.string	"MSP_LED_COLORS 46"
+.LASF1813:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF3054:
+	.string	"permanentId"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2228:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ILAP ((TRANSPONDER_TOGGLES_PER_BIT_ILAP + 1) * TRANSPONDER_BITS_PER_BYTE_ILAP * TRANSPONDER_DATA_LENGTH_ILAP)"
+.LASF2424:
+	.string	"API_VERSION_LENGTH 2"
+.LASF3692:
+	.string	"voltageSensorADCIndex"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF3699:
+	.string	"portConfigSize"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2919:
+	.string	"FEATURE_GPS"
+.LASF1433:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2320:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2660:
+	.string	"signed char"
+.LASF3231:
+	.string	"sbasMode_e"
+.LASF1979:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2520:
+	.string	"MSP_RC 105"
+.LASF1971:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF3756:
+	.string	"compassConfig"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF3525:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF3119:
+	.string	"attitude"
+.LASF2400:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF2221:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ARCITIMER 4500"
+.LASF3425:
+	.string	"CURRENT_SENSOR_MSP"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2313:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF3146:
+	.string	"MIXER_QUADX_1234"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF3162:
+	.string	"NAV_MODE_WP"
+.LASF2430:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF3540:
+	.string	"baro_hardware"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF3501:
+	.string	"consumptionWarningPercentage"
+.LASF2617:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF3587:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2879:
+	.string	"SERIAL_PARITY_NO"
+.LASF1893:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1756:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF3008:
+	.string	"BOXCAMSTAB"
+.LASF3439:
+	.string	"VOLTAGE_METER_ID_BATTERY_10"
+.LASF2080:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF3709:
+	.string	"taskId"
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1519:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF3033:
+	.string	"BOXCAMERA2"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF2224:
+	.string	"TRANSPONDER_DATA_LENGTH_ILAP 6"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2436:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2203:
+	.string	"VIDEO_LINES_PAL 16"
+.LASF1634:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2870:
+	.string	"portMode_t"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2087:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1727:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1884:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF3640:
+	.string	"getTaskInfo"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF3016:
+	.string	"BOXLLIGHTS"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2892:
+	.string	"rxBufferSize"
+.LASF2745:
+	.string	"accAlign"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF3082:
+	.string	"armingConfig_System"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1606:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF3094:
+	.string	"PASSTHRU_MODE"
+.LASF3787:
+	.string	"mixerConfigMutable"
+.LASF3286:
+	.string	"blackbox_baudrateIndex"
+.LASF1412:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1618:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF3142:
+	.string	"MIXER_ATAIL4"
+.LASF2530:
+	.string	"MSP_WP 118"
+.LASF1744:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF3178:
+	.string	"PID_VEL"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1898:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2092:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2864:
+	.string	"motorPwmRate"
+.LASF2180:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1911:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2702:
+	.string	"FD_PITCH"
+.LASF2837:
+	.string	"OWNER_BARO_EXTI"
+.LASF2539:
+	.string	"MSP_VOLTAGE_METERS 128"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF3717:
+	.string	"meter"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF3557:
+	.string	"compassConfig_s"
+.LASF1657:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF2733:
+	.string	"CW180_DEG_FLIP"
+.LASF2694:
+	.string	"mode_profile"
+.LASF3750:
+	.string	"mspRebootFn"
+.LASF2605:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2665:
+	.string	"__uint16_t"
+.LASF3696:
+	.string	"wp_no"
+.LASF2651:
+	.string	"OSD_FLAGS_OSD_FEATURE (1 << 0)"
+.LASF2680:
+	.string	"double"
+.LASF3169:
+	.string	"PID_ROLL"
+.LASF2050:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF2506:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF1443:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF3071:
+	.string	"deadband3d_low"
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1507:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2319:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1442:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF377:
+	.string	"__linux 1"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2830:
+	.string	"OWNER_FLASH_CS"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF3474:
+	.string	"unfiltered"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2195:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2653:
+	.string	"OSD_FLAGS_RESERVED_1 (1 << 2)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF3001:
+	.string	"BOXANGLE"
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF2083:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1649:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1564:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1472:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2231:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ILAP 4500"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF2639:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2199:
+	.string	"BWBRIGHTNESS ((BLACKBRIGHTNESS << 2) | WHITEBRIGHTNESS)"
+.LASF3492:
+	.string	"vbatmaxcellvoltage"
+.LASF2368:
+	.string	"LED_POS_OFFSET 0"
+.LASF2833:
+	.string	"OWNER_OSD_CS"
+.LASF3781:
+	.string	"customServoMixersMutable"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF3284:
+	.string	"msp_baudrateIndex"
+.LASF2677:
+	.string	"uint64_t"
+.LASF2393:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF2216:
+	.string	"TRANSPONDER_GAP_TOGGLES_ARCITIMER 0"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF2768:
+	.string	"BMI_160_SPI"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF3565:
+	.string	"gyroConfig_s"
+.LASF3582:
+	.string	"gyroConfig_t"
+.LASF3733:
+	.string	"boxEnabledMask"
+.LASF3244:
+	.string	"gpsConfig_System"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF3177:
+	.string	"PID_MAG"
+.LASF2262:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2189:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2949:
+	.string	"dterm_filter_type"
+.LASF2728:
+	.string	"CW90_DEG"
+.LASF2616:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF1859:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF3333:
+	.string	"rcReadRawFn"
+.LASF396:
+	.string	"bool _Bool"
+.LASF2643:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF2457:
+	.string	"MSP_FEATURE_CONFIG 36"
+.LASF3317:
+	.string	"mincheck"
+.LASF3372:
+	.string	"TASK_COUNT"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1833:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1578:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF2786:
+	.string	"__nusers"
+.LASF2000:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF3260:
+	.string	"GPS_svinfo_cno"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1498:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF2077:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2022:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2887:
+	.string	"vTable"
+.LASF720:
+	.string	"__need_size_t"
+.LASF3166:
+	.string	"GPS_distanceToHome"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1757:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2232:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ILAP 10000"
+.LASF1702:
+	.string	"__sched_priority sched_priority"
+.LASF2208:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF2115:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF355:
+	.string	"__amd64 1"
+.LASF3755:
+	.string	"compassConfigMutable"
+.LASF3414:
+	.string	"CURRENT_METER_MSP"
+.LASF2903:
+	.string	"serialTotalRxWaiting"
+.LASF2564:
+	.string	"MSP_SET_GPS_CONFIG 223"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2111:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2351:
+	.string	"FLASHFS_ERASE_POOL_SECTORS 4"
+.LASF3524:
+	.string	"accSmooth"
+.LASF1435:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF2684:
+	.string	"_Bool"
+.LASF2023:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF2779:
+	.string	"__prev"
+.LASF2757:
+	.string	"MPU_NONE"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2706:
+	.string	"RGB_BLUE"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF3287:
+	.string	"telemetry_baudrateIndex"
+.LASF3648:
+	.string	"flashfsGetGeometry"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2358:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF3340:
+	.string	"cfTaskHistogram_t"
+.LASF3235:
+	.string	"GPS_AUTOBAUD_OFF"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2596:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF3078:
+	.string	"gyro_cal_on_first_arm"
+.LASF2439:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF2284:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF3076:
+	.string	"flight3DConfig_System"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF3056:
+	.string	"adjustmentRange_s"
+.LASF3060:
+	.string	"adjustmentRange_t"
+.LASF3259:
+	.string	"GPS_svinfo_quality"
+.LASF1594:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1776:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF3180:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF3760:
+	.string	"barometerConfig"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF3653:
+	.string	"getEstimatedAltitude"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2171:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF3037:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF3102:
+	.string	"SMALL_ANGLE"
+.LASF2312:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF3617:
+	.string	"featureClearAll"
+.LASF1787:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1514:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF1447:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2553:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF3718:
+	.string	"adcSensorSubframeLength"
+.LASF2953:
+	.string	"dterm_notch_cutoff"
+.LASF2256:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF515:
+	.string	"__always_inline"
+.LASF3315:
+	.string	"rssi_invert"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF2074:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF1852:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF3424:
+	.string	"CURRENT_SENSOR_ESC"
+.LASF1824:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF3486:
+	.string	"voltageSensorADCConfig_t"
+.LASF2602:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2109:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1635:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1684:
+	.string	"SCHED_RR 2"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2116:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1575:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2625:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF2749:
+	.string	"mpuReadRegisterFnPtr"
+.LASF2411:
+	.string	"ESC_INPUT setEscInput(selected_esc)"
+.LASF3154:
+	.string	"maxthrottle"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF3775:
+	.string	"rxFailsafeChannelConfigs"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF3347:
+	.string	"maxExecutionTime"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF398:
+	.string	"false 0"
+.LASF3278:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF2513:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1682:
+	.string	"SCHED_OTHER 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2452:
+	.string	"MSP_SET_NAME 11"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2591:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2174:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2013:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2470:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF3645:
+	.string	"flashfsGetOffset"
+.LASF2775:
+	.string	"resolution"
+.LASF3712:
+	.string	"mspFcProcessOutCommand"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2030:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF3396:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_5"
+.LASF1709:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF3397:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_6"
+.LASF1935:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF2435:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF2601:
+	.string	"PWM_PULSE_MIN 750"
+.LASF3242:
+	.string	"autoBaud"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1485:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2101:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2291:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3516:
+	.string	"SENSOR_ACC"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2681:
+	.string	"TIM_TypeDef"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2883:
+	.string	"SERIAL_BIDIR_OD"
+.LASF2352:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF1527:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF2057:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF3678:
+	.string	"bitArrayClr"
+.LASF2509:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF3807:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF2508:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF1762:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF2071:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2236:
+	.string	"ERLTCyclesForZeroBit 10"
+.LASF2942:
+	.string	"activeRateProfile"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF3346:
+	.string	"latestDeltaTime"
+.LASF1834:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2039:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1986:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF3693:
+	.string	"mspCommonProcessInCommand"
+.LASF2348:
+	.string	"FLASHFS_WRITE_BUFFER_PAGES 2"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2333:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF2162:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1739:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF2049:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1811:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF2623:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF3387:
+	.string	"CURRENT_METER_ID_12V_1"
+.LASF3388:
+	.string	"CURRENT_METER_ID_12V_2"
+.LASF1827:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF3011:
+	.string	"BOXGPSHOLD"
+.LASF3473:
+	.string	"filtered"
+.LASF3671:
+	.string	"getBatteryVoltage"
+.LASF364:
+	.string	"__k8 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1970:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1962:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF3800:
+	.string	"modeActivationConditions"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2398:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1476:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF3360:
+	.string	"TASK_SERIAL"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2584:
+	.string	"MSP_ACC_TRIM 240"
+.LASF3026:
+	.string	"BOXBLACKBOX"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2504:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF1883:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF3428:
+	.string	"offset"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF3337:
+	.string	"rxRuntimeConfig"
+.LASF2793:
+	.string	"__align"
+.LASF3252:
+	.string	"hdop"
+.LASF3691:
+	.string	"dataSize"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1572:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF2308:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2267:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2037:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2570:
+	.string	"MSP_DEBUG 254"
+.LASF3105:
+	.string	"AltHold"
+.LASF1461:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2480:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF1468:
+	.string	"FAST_MATH "
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF3107:
+	.string	"failsafe_delay"
+.LASF1854:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1764:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF1875:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF3502:
+	.string	"vbathysteresis"
+.LASF1646:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2441:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2442:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF3612:
+	.string	"serialFindPortConfiguration"
+.LASF3097:
+	.string	"flightModeFlags_e"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF3539:
+	.string	"barometerConfig_s"
+.LASF3545:
+	.string	"barometerConfig_t"
+.LASF3685:
+	.string	"mspFcProcessReply"
+.LASF2714:
+	.string	"I2CINVALID"
+.LASF1510:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2191:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2194:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF3070:
+	.string	"flight3DConfig_s"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF2414:
+	.string	"USE_SERIAL_4WAY_SK_BOOTLOADER "
+.LASF1910:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2820:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1586:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF1844:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF2554:
+	.string	"MSP_SET_HEADING 211"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1577:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2576:
+	.string	"MSP_DATAFLASH_STREAM_DATA 154"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3710:
+	.string	"taskInfo"
+.LASF2583:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2612:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF3799:
+	.string	"modeActivationConditionsMutable"
+.LASF2168:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1899:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2932:
+	.string	"FEATURE_TRANSPONDER"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF3487:
+	.string	"voltageSensorADCConfig_SystemArray"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1619:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2951:
+	.string	"yaw_lpf_hz"
+.LASF2478:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF2153:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF2874:
+	.string	"portOptions_t"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF3341:
+	.string	"taskName"
+.LASF3083:
+	.string	"ARMED"
+.LASF2088:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2139:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1821:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF3257:
+	.string	"GPS_svinfo_chn"
+.LASF2149:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF3554:
+	.string	"magADC"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2613:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2907:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF2937:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2922:
+	.string	"FEATURE_TELEMETRY"
+.LASF2568:
+	.string	"MSP_RESERVE_2 252"
+.LASF1456:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF2936:
+	.string	"FEATURE_SOFTSPI"
+.LASF1725:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF3122:
+	.string	"MIXER_QUADP"
+.LASF1499:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2105:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1950:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF3123:
+	.string	"MIXER_QUADX"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF2261:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1583:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF2026:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2818:
+	.string	"OWNER_TIMER"
+.LASF1791:
+	.string	"IOCFG_IPU 0"
+.LASF3015:
+	.string	"BOXLEDLOW"
+.LASF3427:
+	.string	"scale"
+.LASF3585:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1573:
+	.string	"I2CDEV_COUNT 4"
+.LASF1797:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2738:
+	.string	"initFn"
+.LASF1521:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF3735:
+	.string	"flightModeCopyMask"
+.LASF3571:
+	.string	"gyro_soft_lpf_hz"
+.LASF2730:
+	.string	"CW270_DEG"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1754:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF3708:
+	.string	"page"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2190:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF2387:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF1582:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1585:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF2243:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2521:
+	.string	"MSP_RAW_GPS 106"
+.LASF1667:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2160:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF3141:
+	.string	"MIXER_SINGLECOPTER"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2488:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2934:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2341:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF3757:
+	.string	"boardAlignmentMutable"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF3236:
+	.string	"GPS_AUTOBAUD_ON"
+.LASF3027:
+	.string	"BOXFAILSAFE"
+.LASF3401:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_10"
+.LASF3402:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_11"
+.LASF3403:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_12"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2759:
+	.string	"MPU_60x0"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1602:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1836:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF3506:
+	.string	"BATTERY_WARNING"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF2657:
+	.string	"short unsigned int"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF3258:
+	.string	"GPS_svinfo_svid"
+.LASF1576:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF2515:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2159:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1438:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1759:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF1302:
+	.string	"ACC "
+.LASF1687:
+	.string	"__CPU_SETSIZE 1024"
+.LASF3088:
+	.string	"MAG_MODE"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF2481:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF3461:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_11"
+.LASF2999:
+	.string	"mspPostProcessFnPtr"
+.LASF3228:
+	.string	"SBAS_WAAS"
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2073:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2890:
+	.string	"options"
+.LASF2661:
+	.string	"__int8_t"
+.LASF1704:
+	.string	"_BITS_TIME_H 1"
+.LASF3216:
+	.string	"servoParam_s"
+.LASF3220:
+	.string	"servoParam_t"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2585:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF2663:
+	.string	"__int16_t"
+.LASF2847:
+	.string	"OWNER_COMPASS_CS"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF3758:
+	.string	"boardAlignment"
+.LASF3633:
+	.string	"sbufAdvance"
+.LASF2654:
+	.string	"OSD_FLAGS_RESERVED_2 (1 << 3)"
+.LASF2380:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF1805:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF2747:
+	.string	"mpuConfiguration"
+.LASF3450:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_10"
+.LASF2281:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF3576:
+	.string	"gyro_soft_notch_hz_1"
+.LASF3578:
+	.string	"gyro_soft_notch_hz_2"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2683:
+	.string	"SPI_TypeDef"
+.LASF2597:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF3365:
+	.string	"TASK_GPS"
+.LASF2104:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2771:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF3515:
+	.string	"SENSOR_GYRO"
+.LASF3357:
+	.string	"TASK_ACCEL"
+.LASF2431:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF2610:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF3687:
+	.string	"mspFcProcessCommand"
+.LASF2426:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF2114:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2279:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1718:
+	.string	"__clock_t_defined 1"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF3660:
+	.string	"getTaskDeltaTime"
+.LASF2966:
+	.string	"setpointRelaxRatio"
+.LASF1448:
+	.string	"FC_VERSION_MINOR 1"
+.LASF2469:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF2923:
+	.string	"FEATURE_3D"
+.LASF3649:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1418:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2908:
+	.string	"setMode"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF3305:
+	.string	"halfDuplex"
+.LASF1493:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF3546:
+	.string	"barometerConfig_System"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2021:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1767:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF2042:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF3332:
+	.string	"rxRefreshRate"
+.LASF2724:
+	.string	"address"
+.LASF1306:
+	.string	"MAG "
+.LASF2712:
+	.string	"ioTag_t"
+.LASF2444:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF3081:
+	.string	"armingConfig_t"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2969:
+	.string	"rateAccelLimit"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2674:
+	.string	"uint8_t"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF2053:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1741:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1753:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1699:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF2737:
+	.string	"accDev_s"
+.LASF2796:
+	.string	"accDev_t"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF3659:
+	.string	"getCurrentPidProfileIndex"
+.LASF2516:
+	.string	"MSP_STATUS 101"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2713:
+	.string	"IO_t"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1685:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2253:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1285:
+	.string	"GPS "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2033:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF3762:
+	.string	"accelerometerConfig"
+.LASF3598:
+	.string	"frsky_vfas_cell_voltage"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2527:
+	.string	"MSP_PID 112"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2458:
+	.string	"MSP_SET_FEATURE_CONFIG 37"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF3490:
+	.string	"voltageMeterIds"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF2641:
+	.string	"SONAR_GPIO GPIOB"
+.LASF1926:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF3476:
+	.string	"VOLTAGE_SENSOR_TYPE_ADC_RESISTOR_DIVIDER"
+.LASF1775:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2301:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1706:
+	.string	"CLOCK_REALTIME 0"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2854:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF3073:
+	.string	"neutral3d"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1563:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF3338:
+	.string	"executionTime"
+.LASF2374:
+	.string	"LED_POS_BITCNT 8"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2632:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2811:
+	.string	"OWNER_ADC_BATT"
+.LASF2726:
+	.string	"ALIGN_DEFAULT"
+.LASF1765:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1953:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2970:
+	.string	"crash_dthreshold"
+.LASF1558:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF2019:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2219:
+	.string	"TRANSPONDER_TIMER_MHZ_ARCITIMER 24"
+.LASF2679:
+	.string	"float"
+.LASF2084:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF3369:
+	.string	"TASK_TELEMETRY"
+.LASF1491:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2059:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2732:
+	.string	"CW90_DEG_FLIP"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2390:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF2635:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1874:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF2784:
+	.string	"__count"
+.LASF2656:
+	.string	"unsigned char"
+.LASF3435:
+	.string	"currentMeterIds"
+.LASF2331:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF3673:
+	.string	"sbufWriteData"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3103:
+	.string	"FIXED_WING"
+.LASF3179:
+	.string	"PID_ITEM_COUNT"
+.LASF1724:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1607:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF2268:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1431:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF3471:
+	.string	"voltageMeterSource_e"
+.LASF3190:
+	.string	"pidConfig_System"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1663:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1591:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2897:
+	.string	"rxBufferTail"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2487:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF2407:
+	.string	"ESC_IS_HI isEscHi(selected_esc)"
+.LASF1866:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1989:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1644:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2868:
+	.string	"ioTags"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1628:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF3770:
+	.string	"currentSensorADCConfigMutable"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2979:
+	.string	"rcYawRate8"
+.LASF2135:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF700:
+	.string	"__need_size_t "
+.LASF3452:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_2"
+.LASF3453:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_3"
+.LASF3454:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_4"
+.LASF3455:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_5"
+.LASF3456:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_6"
+.LASF3457:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_7"
+.LASF3458:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_8"
+.LASF3459:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_9"
+.LASF2338:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2170:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2274:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF379:
+	.string	"linux 1"
+.LASF3588:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF2927:
+	.string	"FEATURE_LED_STRIP"
+.LASF2924:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2755:
+	.string	"gyroReadXRegister"
+.LASF3151:
+	.string	"motorConfig_s"
+.LASF3156:
+	.string	"motorConfig_t"
+.LASF2767:
+	.string	"ICM_20689_SPI"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1474:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1946:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2690:
+	.string	"on_motor_test"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2238:
+	.string	"TRANSPONDER_TIMER_MHZ_ERLT 18"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF2848:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3785:
+	.string	"motorConfigMutable"
+.LASF2241:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ERLT 5000"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF3274:
+	.string	"SERIAL_PORT_UART5"
+.LASF2327:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF1693:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1504:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2415:
+	.string	"imC2 0"
+.LASF2324:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF3505:
+	.string	"BATTERY_OK"
+.LASF1574:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1655:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF1968:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF3672:
+	.string	"sbufWriteU16"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2417:
+	.string	"imATM_BLB 2"
+.LASF2791:
+	.string	"__data"
+.LASF2419:
+	.string	"imARM_BLB 4"
+.LASF2915:
+	.string	"FEATURE_RX_SERIAL"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF3316:
+	.string	"midrc"
+.LASF2608:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2299:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2846:
+	.string	"OWNER_VTX"
+.LASF3782:
+	.string	"customServoMixers"
+.LASF2593:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF1788:
+	.string	"IOCFG_AF_PP 0"
+.LASF1901:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1769:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF3593:
+	.string	"telemetry_switch"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1588:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2344:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF1420:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2902:
+	.string	"serialWrite"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF3574:
+	.string	"gyro_to_use"
+.LASF2269:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1481:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2517:
+	.string	"MSP_RAW_IMU 102"
+.LASF2394:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF3050:
+	.string	"modeActivationConditions_SystemArray"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1707:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF3610:
+	.string	"featureSet"
+.LASF1640:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF3217:
+	.string	"reversedSources"
+.LASF2719:
+	.string	"I2CDevice"
+.LASF1559:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF3730:
+	.string	"serializeSDCardSummaryReply"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2124:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1556:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2627:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF3349:
+	.string	"averageExecutionTime"
+.LASF2740:
+	.string	"acc_1G"
+.LASF1896:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF3251:
+	.string	"groundCourse"
+.LASF3160:
+	.string	"NAV_MODE_NONE"
+.LASF1798:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF3795:
+	.string	"rcControlsConfigMutable"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2715:
+	.string	"I2CDEV_1"
+.LASF2716:
+	.string	"I2CDEV_2"
+.LASF2717:
+	.string	"I2CDEV_3"
+.LASF2718:
+	.string	"I2CDEV_4"
+.LASF2893:
+	.string	"txBufferSize"
+.LASF3698:
+	.string	"adjRange"
+.LASF3443:
+	.string	"VOLTAGE_METER_ID_9V_1"
+.LASF3444:
+	.string	"VOLTAGE_METER_ID_9V_2"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1550:
+	.string	"PG_PWM_CONFIG 508"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF3165:
+	.string	"GPS_hold"
+.LASF2151:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF3613:
+	.string	"disableFlightMode"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF3375:
+	.string	"cfTaskId_e"
+.LASF2125:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1783:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1715:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2367:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF2607:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2239:
+	.string	"TRANSPONDER_CARRIER_HZ_ERLT 38000"
+.LASF2072:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1502:
+	.string	"PG_SERVO_MIXER 21"
+.LASF3761:
+	.string	"accelerometerConfigMutable"
+.LASF3500:
+	.string	"useConsumptionAlerts"
+.LASF2843:
+	.string	"OWNER_INVERTER"
+.LASF3674:
+	.string	"sbufWriteU8"
+.LASF2383:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF2834:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2490:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF3227:
+	.string	"SBAS_EGNOS"
+.LASF2310:
+	.string	"PIDSUM_LIMIT 500"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF3164:
+	.string	"GPS_home"
+.LASF3326:
+	.string	"rx_max_usec"
+.LASF1417:
+	.string	"UNIT_TESTED "
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1601:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1677:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1729:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF1847:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF3669:
+	.string	"getAmperage"
+.LASF1856:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF3727:
+	.string	"serializeDataflashSummaryReply"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2867:
+	.string	"useUnsyncedPwm"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF3716:
+	.string	"mspCommonProcessOutCommand"
+.LASF3611:
+	.string	"GPS_set_next_wp"
+.LASF2218:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ARCITIMER 155 * TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF3481:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF3201:
+	.string	"INPUT_RC_AUX1"
+.LASF3202:
+	.string	"INPUT_RC_AUX2"
+.LASF1831:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF3204:
+	.string	"INPUT_RC_AUX4"
+.LASF3488:
+	.string	"voltageMeterADCtoIDMap"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF3022:
+	.string	"BOXSONAR"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1839:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2667:
+	.string	"__uint32_t"
+.LASF2842:
+	.string	"OWNER_RX_BIND"
+.LASF2099:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3695:
+	.string	"value"
+.LASF3769:
+	.string	"currentSensorVirtualConfig"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF2725:
+	.string	"busDevice_t"
+.LASF3512:
+	.string	"busDevice_u"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF2955:
+	.string	"pidSumLimit"
+.LASF2823:
+	.string	"OWNER_SPI_MISO"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF3561:
+	.string	"interruptTag"
+.LASF3000:
+	.string	"BOXARM"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1645:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF3362:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF2858:
+	.string	"pulseScale"
+.LASF1977:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1428:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2471:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF3345:
+	.string	"desiredPeriod"
+.LASF3778:
+	.string	"gpsConfig"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1522:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2379:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1535:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2405:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF2459:
+	.string	"MSP_BOARD_ALIGNMENT_CONFIG 38"
+.LASF3052:
+	.string	"boxId"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF3621:
+	.string	"gyroInitFilters"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF3772:
+	.string	"rxConfigMutable"
+.LASF2544:
+	.string	"MSP_COMPASS_CONFIG 133"
+.LASF3806:
+	.string	"blackboxConfig"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2012:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2004:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2710:
+	.string	"sbuf_s"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF3134:
+	.string	"MIXER_AIRPLANE"
+.LASF2472:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF2483:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF1512:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2212:
+	.string	"ESCSERIAL_BUFFER_SIZE 1024"
+.LASF2805:
+	.string	"OWNER_PWMINPUT"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF3323:
+	.string	"max_aux_channel"
+.LASF2881:
+	.string	"SERIAL_UNIDIR"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2692:
+	.string	"compression"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2240:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ERLT 22500"
+.LASF2399:
+	.string	"LED_XY_MASK 0x0F"
+.LASF2477:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF2359:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1722:
+	.string	"__itimerspec_defined 1"
+.LASF3115:
+	.string	"roll"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1620:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF3417:
+	.string	"currentMeter_s"
+.LASF3421:
+	.string	"currentMeter_t"
+.LASF2427:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2537:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1820:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1801:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1917:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF3292:
+	.string	"reboot_character"
+.LASF2748:
+	.string	"sensorAccReadFuncPtr"
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2035:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF3731:
+	.string	"packFlightModeFlags"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF3541:
+	.string	"baro_sample_count"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF3704:
+	.string	"useLegacyFormat"
+.LASF3041:
+	.string	"channelRange_s"
+.LASF3044:
+	.string	"channelRange_t"
+.LASF2034:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2558:
+	.string	"MSP_SET_MOTOR_3D_CONFIG 217"
+.LASF3480:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF3269:
+	.string	"SERIAL_PORT_NONE"
+.LASF2421:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF1569:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF3367:
+	.string	"TASK_BARO"
+.LASF1665:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF3075:
+	.string	"flight3DConfig_t"
+.LASF3784:
+	.string	"pidConfig"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF3230:
+	.string	"SBAS_GAGAN"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2894:
+	.string	"rxBuffer"
+.LASF1772:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF2994:
+	.string	"mspResult_e"
+.LASF1750:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF3794:
+	.string	"flight3DConfig"
+.LASF1865:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2941:
+	.string	"pidProfileIndex"
+.LASF3592:
+	.string	"gpsNoFixLongitude"
+.LASF2682:
+	.string	"test"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF3193:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF2295:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2362:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1804:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF3358:
+	.string	"TASK_ATTITUDE"
+.LASF1621:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2492:
+	.string	"MSP_RXFAIL_CONFIG 77"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF3112:
+	.string	"failsafe_procedure"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF3197:
+	.string	"INPUT_RC_ROLL"
+.LASF3626:
+	.string	"convertExternalToMotor"
+.LASF2693:
+	.string	"profile"
+.LASF2921:
+	.string	"FEATURE_SONAR"
+.LASF2982:
+	.string	"thrExpo8"
+.LASF3368:
+	.string	"TASK_ALTITUDE"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF1868:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF3096:
+	.string	"FAILSAFE_MODE"
+.LASF1453:
+	.string	"MW_VERSION 231"
+.LASF2249:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3268:
+	.string	"specialColors"
+.LASF3153:
+	.string	"minthrottle"
+.LASF1712:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF3409:
+	.string	"currentMeterId_e"
+.LASF2863:
+	.string	"motorDevConfig_s"
+.LASF2869:
+	.string	"motorDevConfig_t"
+.LASF3117:
+	.string	"values"
+.LASF2085:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1515:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1823:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1857:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF3129:
+	.string	"MIXER_Y4"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF3126:
+	.string	"MIXER_Y6"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF2158:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2856:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1356:
+	.string	"USE_SPI"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1692:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF3495:
+	.string	"vbatnotpresentcellvoltage"
+.LASF3061:
+	.string	"adjustmentRanges_SystemArray"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF3509:
+	.string	"batteryState_e"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1426:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2254:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF2519:
+	.string	"MSP_MOTOR 104"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2524:
+	.string	"MSP_ALTITUDE 109"
+.LASF3558:
+	.string	"mag_declination"
+.LASF1763:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF3468:
+	.string	"VOLTAGE_METER_NONE"
+.LASF2213:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ARCITIMER 8"
+.LASF1463:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF3376:
+	.string	"averageSystemLoadPercent"
+.LASF3477:
+	.string	"VOLTAGE_SENSOR_TYPE_ESC"
+.LASF3665:
+	.string	"getBatteryState"
+.LASF1636:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF3577:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF3085:
+	.string	"armingFlags"
+.LASF3579:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2322:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF2136:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF3514:
+	.string	"flightDynamicsTrims_t"
+.LASF3513:
+	.string	"flightDynamicsTrims_u"
+.LASF2734:
+	.string	"CW270_DEG_FLIP"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2122:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1462:
+	.string	"HSV_HUE_MAX 359"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF3416:
+	.string	"currentMeterSource_e"
+.LASF1534:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2954:
+	.string	"itermWindupPointPercent"
+.LASF3802:
+	.string	"systemConfig"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2618:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF3256:
+	.string	"GPS_numCh"
+.LASF3618:
+	.string	"readEEPROM"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2314:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF491:
+	.string	"__flexarr []"
+.LASF2933:
+	.string	"FEATURE_AIRMODE"
+.LASF1947:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1671:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2321:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2562:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF1822:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3330:
+	.string	"rxRuntimeConfig_s"
+.LASF3336:
+	.string	"rxRuntimeConfig_t"
+.LASF1746:
+	.string	"__have_pthread_attr_t 1"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF3187:
+	.string	"pidConfig_s"
+.LASF3189:
+	.string	"pidConfig_t"
+.LASF3630:
+	.string	"rxMspFrameReceive"
+.LASF3028:
+	.string	"BOXAIRMODE"
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2123:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1705:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF2590:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1779:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1452:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF1710:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1658:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF3563:
+	.string	"compassConfig_t"
+.LASF2187:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1728:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF3313:
+	.string	"rssi_channel"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1597:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF3289:
+	.string	"serialConfig_s"
+.LASF3293:
+	.string	"serialConfig_t"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF3192:
+	.string	"airmodeWasActivated"
+.LASF2904:
+	.string	"serialTotalTxFree"
+.LASF3116:
+	.string	"pitch"
+.LASF3355:
+	.string	"TASK_GYROPID"
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF3392:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_1"
+.LASF3393:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_2"
+.LASF3394:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_3"
+.LASF3395:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_4"
+.LASF3590:
+	.string	"telemetryConfig_s"
+.LASF3602:
+	.string	"telemetryConfig_t"
+.LASF3398:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_7"
+.LASF3399:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_8"
+.LASF3400:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_9"
+.LASF2722:
+	.string	"csnPin"
+.LASF1998:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2366:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1543:
+	.string	"PG_OSD_CONFIG 501"
+.LASF3047:
+	.string	"auxChannelIndex"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF2913:
+	.string	"FEATURE_RX_PPM"
+.LASF2522:
+	.string	"MSP_COMP_GPS 107"
+.LASF2701:
+	.string	"FD_ROLL"
+.LASF3583:
+	.string	"gyroConfig_System"
+.LASF2028:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF2529:
+	.string	"MSP_PIDNAMES 117"
+.LASF1747:
+	.string	"_BITS_SETJMP_H 1"
+.LASF2636:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF2360:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF3411:
+	.string	"CURRENT_METER_ADC"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF3479:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF2209:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF2134:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2860:
+	.string	"forceOverflow"
+.LASF2096:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2794:
+	.string	"pthread_mutex_t"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1328:
+	.string	"USE_ADC"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF3266:
+	.string	"colors"
+.LASF3527:
+	.string	"rollAndPitchTrims_s"
+.LASF3530:
+	.string	"rollAndPitchTrims_t"
+.LASF3529:
+	.string	"rollAndPitchTrims_u"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF3700:
+	.string	"remainingPortsInPacket"
+.LASF2698:
+	.string	"shortGitRevision"
+.LASF2297:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2961:
+	.string	"levelSensitivity"
+.LASF3668:
+	.string	"sbufWriteU32"
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2051:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF3572:
+	.string	"gyro_isr_update"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF3715:
+	.string	"nameLen"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2186:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2178:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1786:
+	.string	"IOCFG_OUT_PP 0"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2055:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2606:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2565:
+	.string	"MSP_SET_COMPASS_CONFIG 224"
+.LASF3679:
+	.string	"bitArrayGet"
+.LASF2237:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ERLT 200"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1627:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1694:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF3306:
+	.string	"rx_spi_protocol"
+.LASF3434:
+	.string	"supportedCurrentMeterCount"
+.LASF1611:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2323:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF3262:
+	.string	"color"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF2573:
+	.string	"MSP_TASK_LATENCY 151"
+.LASF2148:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1546:
+	.string	"PG_PID_CONFIG 504"
+.LASF3436:
+	.string	"VOLTAGE_METER_ID_NONE"
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF3307:
+	.string	"rx_spi_id"
+.LASF3426:
+	.string	"currentSensorADCConfig_s"
+.LASF3429:
+	.string	"currentSensorADCConfig_t"
+.LASF3707:
+	.string	"mspFcProcessOutCommandWithArg"
+.LASF2181:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF3531:
+	.string	"accelerometerConfig_s"
+.LASF3537:
+	.string	"accelerometerConfig_t"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2016:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF3522:
+	.string	"acc_s"
+.LASF3526:
+	.string	"acc_t"
+.LASF2664:
+	.string	"short int"
+.LASF3181:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF1679:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2990:
+	.string	"MSP_RESULT_ACK"
+.LASF2003:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF3441:
+	.string	"VOLTAGE_METER_ID_5V_2"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1749:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF3199:
+	.string	"INPUT_RC_YAW"
+.LASF2146:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF3150:
+	.string	"mixerConfig_System"
+.LASF2614:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF3301:
+	.string	"rxConfig_s"
+.LASF3327:
+	.string	"rxConfig_t"
+.LASF2131:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1808:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF3644:
+	.string	"sbufBytesRemaining"
+.LASF1881:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF2242:
+	.string	"TRANSPONDER_PROVIDER_COUNT 3"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1897:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF3095:
+	.string	"SONAR_MODE"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2578:
+	.string	"MSP_SETTING 156"
+.LASF2746:
+	.string	"mpuDetectionResult"
+.LASF1794:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2500:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1842:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2938:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1637:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2140:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2531:
+	.string	"MSP_BOXIDS 119"
+.LASF2207:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1800:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1916:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2489:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF2412:
+	.string	"ESC_OUTPUT setEscOutput(selected_esc)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2081:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2198:
+	.string	"BLACKBRIGHTNESS 0x00"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF478:
+	.string	"__P(args) args"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF2064:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1501:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF3776:
+	.string	"serialConfig"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1286:
+	.string	"USE_NAV "
+.LASF2409:
+	.string	"ESC_SET_HI setEscHi(selected_esc)"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF3566:
+	.string	"gyro_align"
+.LASF2285:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1440:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1892:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF3431:
+	.string	"currentSensorVirtualConfig_s"
+.LASF3432:
+	.string	"currentSensorVirtualConfig_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2888:
+	.string	"identifier"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1908:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1700:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1478:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF3208:
+	.string	"inputSource_e"
+.LASF2002:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2476:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF3250:
+	.string	"groundSpeed"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF3739:
+	.string	"serializeBoxReply"
+.LASF1445:
+	.string	"TRACE_END(event,arg) {}"
+.LASF2132:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF3348:
+	.string	"totalExecutionTime"
+.LASF389:
+	.string	"SITL 1"
+.LASF1425:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF3294:
+	.string	"serialConfig_System"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF3625:
+	.string	"getMotorCount"
+.LASF3638:
+	.string	"sbufWriteString"
+.LASF3559:
+	.string	"mag_align"
+.LASF2891:
+	.string	"baudRate"
+.LASF3247:
+	.string	"gpsSolutionData_s"
+.LASF3253:
+	.string	"gpsSolutionData_t"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF2432:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1943:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2619:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF3020:
+	.string	"BOXTELEMETRY"
+.LASF3690:
+	.string	"cmdMSP"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF2052:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2266:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF3013:
+	.string	"BOXBEEPERON"
+.LASF3533:
+	.string	"acc_align"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1796:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2929:
+	.string	"FEATURE_OSD"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2668:
+	.string	"long int"
+.LASF3170:
+	.string	"PID_PITCH"
+.LASF3564:
+	.string	"compassConfig_System"
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF3605:
+	.string	"boardIdentifier"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF2758:
+	.string	"MPU_3050"
+.LASF3390:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_1"
+.LASF3729:
+	.string	"flags"
+.LASF2731:
+	.string	"CW0_DEG_FLIP"
+.LASF2816:
+	.string	"OWNER_SERIAL_RX"
+.LASF1755:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1592:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2666:
+	.string	"__int32_t"
+.LASF1745:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2183:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF3074:
+	.string	"deadband3d_throttle"
+.LASF2303:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2976:
+	.string	"currentPidProfile"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF2264:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2774:
+	.string	"sensor"
+.LASF2931:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2423:
+	.string	"API_VERSION_MINOR 36"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2142:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2835:
+	.string	"OWNER_SPI_CS"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF2223:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ILAP 10"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF3210:
+	.string	"targetChannel"
+.LASF3281:
+	.string	"serialPortIdentifier_e"
+.LASF2952:
+	.string	"dterm_notch_hz"
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2456:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF1994:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2038:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2079:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF3254:
+	.string	"gpsSol"
+.LASF3570:
+	.string	"gyro_soft_lpf_type"
+.LASF3694:
+	.string	"mspFcProcessInCommand"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1802:
+	.string	"EXPAND_I(x) x"
+.LASF2493:
+	.string	"MSP_SET_RXFAIL_CONFIG 78"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF3384:
+	.string	"CURRENT_METER_ID_9V_1"
+.LASF3283:
+	.string	"functionMask"
+.LASF3371:
+	.string	"TASK_RCSPLIT"
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1523:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF3562:
+	.string	"magZero"
+.LASF3764:
+	.string	"batteryConfig"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF2166:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF3517:
+	.string	"SENSOR_BARO"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF3099:
+	.string	"GPS_FIX_HOME"
+.LASF2547:
+	.string	"MSP_SET_PID 202"
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF3038:
+	.string	"boxId_e"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2877:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2878:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2815:
+	.string	"OWNER_SERIAL_TX"
+.LASF1711:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1547:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1422:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2981:
+	.string	"thrMid8"
+.LASF1532:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF3738:
+	.string	"initActiveBoxIds"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF3093:
+	.string	"UNUSED_MODE"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2045:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"Q12 (1 << 12)"
+.LASF1920:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2688:
+	.string	"rate_denom"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF3803:
+	.string	"constrain"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF3161:
+	.string	"NAV_MODE_POSHOLD"
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF397:
+	.string	"true 1"
+.LASF2875:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2968:
+	.string	"yawRateAccelLimit"
+.LASF2971:
+	.string	"crash_gthreshold"
+.LASF3547:
+	.string	"boardAlignment_s"
+.LASF3551:
+	.string	"boardAlignment_t"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF3749:
+	.string	"findBoxByBoxId"
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2448:
+	.string	"MSP_FC_VERSION 3"
+.LASF1622:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF2211:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF3616:
+	.string	"accSetCalibrationCycles"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1680:
+	.string	"__pid_t_defined "
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF3423:
+	.string	"CURRENT_SENSOR_ADC"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF2091:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF3628:
+	.string	"useRcControlsConfig"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF3789:
+	.string	"failsafeConfigMutable"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF3184:
+	.string	"pid8_s"
+.LASF1612:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2275:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF2106:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2672:
+	.string	"int16_t"
+.LASF2182:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF3713:
+	.string	"flagBits"
+.LASF1541:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2317:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1829:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF3642:
+	.string	"mspSettingCommand"
+.LASF2027:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF2792:
+	.string	"__size"
+.LASF3714:
+	.string	"byteCount"
+.LASF2453:
+	.string	"MSP_BATTERY_CONFIG 32"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF425:
+	.string	"__USE_GNU"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2450:
+	.string	"MSP_BUILD_INFO 5"
+.LASF2542:
+	.string	"MSP_MOTOR_CONFIG 131"
+.LASF2563:
+	.string	"MSP_SET_MOTOR_CONFIG 222"
+.LASF1589:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1795:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF3196:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF2862:
+	.string	"pwmOutputPort_t"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF1610:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF3472:
+	.string	"voltageMeter_s"
+.LASF3475:
+	.string	"voltageMeter_t"
+.LASF2773:
+	.string	"mpuDetectionResult_s"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF2420:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2229:
+	.string	"TRANSPONDER_TIMER_MHZ_ILAP 24"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2822:
+	.string	"OWNER_SPI_SCK"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2534:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF3279:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF3280:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2429:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF2592:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1770:
+	.string	"__cleanup_fct_attribute "
+.LASF2255:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2433:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF2901:
+	.string	"serialPortVTable"
+.LASF3535:
+	.string	"accZero"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2776:
+	.string	"mpuDetectionResult_t"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF3325:
+	.string	"rx_min_usec"
+.LASF3641:
+	.string	"mspSettingInfoCommand"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1932:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2647:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF3209:
+	.string	"servoMixer_s"
+.LASF3214:
+	.string	"servoMixer_t"
+.LASF2598:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF3404:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_20"
+.LASF3508:
+	.string	"BATTERY_NOT_PRESENT"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF3211:
+	.string	"inputSource"
+.LASF2604:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1849:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2271:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1730:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF2006:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF701:
+	.string	"__need_NULL "
+.LASF1678:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF3057:
+	.string	"adjustmentFunction"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1967:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF3448:
+	.string	"VOLTAGE_METER_ID_12V_10"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF3226:
+	.string	"SBAS_AUTO"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2328:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF3773:
+	.string	"rxConfig"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF3255:
+	.string	"GPS_update"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF2551:
+	.string	"MSP_RESET_CONF 208"
+.LASF3646:
+	.string	"flashfsGetSize"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1548:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1717:
+	.string	"TIMER_ABSTIME 1"
+.LASF1496:
+	.string	"PG_PID_PROFILE 14"
+.LASF1961:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF2691:
+	.string	"record_acc"
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF2540:
+	.string	"MSP_CURRENT_METERS 129"
+.LASF3768:
+	.string	"currentSensorVirtualConfigMutable"
+.LASF3791:
+	.string	"armingConfigMutable"
+.LASF2445:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF3176:
+	.string	"PID_LEVEL"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2876:
+	.string	"SERIAL_INVERTED"
+.LASF3065:
+	.string	"alt_hold_deadband"
+.LASF3657:
+	.string	"gyroRateDps"
+.LASF1880:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF1872:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF2056:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3796:
+	.string	"rcControlsConfig"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2369:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF3042:
+	.string	"startStep"
+.LASF1571:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF3528:
+	.string	"rollAndPitchTrims_t_def"
+.LASF2347:
+	.string	"FLASHFS_PAGE_SIZE 256"
+.LASF2363:
+	.string	"LED_MODE_COUNT 6"
+.LASF2288:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2514:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1736:
+	.string	"__LOCK_ALIGNMENT "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1525:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF3766:
+	.string	"_index"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF3520:
+	.string	"SENSOR_GPS"
+.LASF2950:
+	.string	"dterm_lpf_hz"
+.LASF1907:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2227:
+	.string	"TRANSPONDER_TOGGLES_ILAP (TRANSPONDER_TOGGLES_PER_BIT_ILAP + TRANSPONDER_GAP_TOGGLES_ILAP)"
+.LASF1495:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF3736:
+	.string	"rcModeCopyMask"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF3351:
+	.string	"startLatencyP50"
+.LASF3203:
+	.string	"INPUT_RC_AUX3"
+.LASF1424:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF3722:
+	.string	"serializeDataflashReadReply"
+.LASF2251:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF3752:
+	.string	"telemetryConfig"
+.LASF2031:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF3497:
+	.string	"currentMeterSource"
+.LASF3053:
+	.string	"boxName"
+.LASF1766:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1902:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF3385:
+	.string	"CURRENT_METER_ID_9V_2"
+.LASF1720:
+	.string	"__clockid_t_defined 1"
+.LASF3705:
+	.string	"mspFcDataFlashReadCommand"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1793:
+	.string	"NOOP do {} while (0)"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF3748:
+	.string	"candidate"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2764:
+	.string	"ICM_20601_SPI"
+.LASF2063:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF3763:
+	.string	"batteryConfigMutable"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF3745:
+	.string	"serializeBoxNameFn"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2743:
+	.string	"dataReady"
+.LASF3120:
+	.string	"mixerMode"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF3291:
+	.string	"serial_update_rate_hz"
+.LASF3303:
+	.string	"serialrx_provider"
+.LASF2381:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF3521:
+	.string	"SENSOR_GPSMAG"
+.LASF2475:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF2082:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1845:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1669:
+	.string	"_SCHED_H 1"
+.LASF3743:
+	.string	"pageEnd"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1590:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF2851:
+	.string	"timCCR_t"
+.LASF2370:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1721:
+	.string	"__timer_t_defined 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF3599:
+	.string	"hottAlarmSoundInterval"
+.LASF2215:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER 4"
+.LASF3363:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1825:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1613:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF3198:
+	.string	"INPUT_RC_PITCH"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2871:
+	.string	"MODE_RX"
+.LASF3635:
+	.string	"sbufPtr"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1631:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF2753:
+	.string	"writeFn"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1740:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF3519:
+	.string	"SENSOR_SONAR"
+.LASF1552:
+	.string	"PG_ADC_CONFIG 510"
+.LASF3482:
+	.string	"voltageSensorADCConfig_s"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1708:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1470:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2293:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2422:
+	.string	"API_VERSION_MAJOR 1"
+.LASF2425:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF2356:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1661:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF3342:
+	.string	"subTaskName"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2853:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF2133:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2165:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF3158:
+	.string	"motor"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2783:
+	.string	"__lock"
+.LASF3245:
+	.string	"gpsLocation_s"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2428:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF1605:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF3445:
+	.string	"VOLTAGE_METER_ID_9V_10"
+.LASF3567:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF2561:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1758:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF2536:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF3352:
+	.string	"startLatencyP99"
+.LASF2965:
+	.string	"itermAcceleratorGain"
+.LASF1486:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF1944:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF3036:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF2669:
+	.string	"__uint64_t"
+.LASF2629:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1851:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2157:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2872:
+	.string	"MODE_TX"
+.LASF3239:
+	.string	"provider"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF2671:
+	.string	"int8_t"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1528:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2978:
+	.string	"rcRate8"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2920:
+	.string	"FEATURE_FAILSAFE"
+.LASF2840:
+	.string	"OWNER_BEEPER"
+.LASF3300:
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+.LASF2078:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF3543:
+	.string	"baro_cf_vel"
+.LASF2184:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF3299:
+	.string	"rxFailsafeChannelConfig_t"
+.LASF3079:
+	.string	"disarm_kill_switch"
+.LASF2451:
+	.string	"MSP_NAME 10"
+.LASF2995:
+	.string	"mspPacket_s"
+.LASF2054:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF3532:
+	.string	"acc_lpf_hz"
+.LASF2637:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1457:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1996:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2373:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF1542:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF3711:
+	.string	"histogram"
+.LASF3110:
+	.string	"failsafe_kill_switch"
+.LASF3767:
+	.string	"voltageSensorADCConfig"
+.LASF3466:
+	.string	"VOLTAGE_METER_ID_CELL_40"
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF3290:
+	.string	"portConfigs"
+.LASF2825:
+	.string	"OWNER_I2C_SCL"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1686:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF3383:
+	.string	"CURRENT_METER_ID_5V_10"
+.LASF1803:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1934:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2250:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1604:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF2468:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF2782:
+	.string	"__pthread_mutex_s"
+.LASF3018:
+	.string	"BOXGOV"
+.LASF2675:
+	.string	"uint16_t"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3295:
+	.string	"rssi"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1537:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1449:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF3460:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_10"
+.LASF1423:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2365:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1716:
+	.string	"CLOCK_TAI 11"
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF2097:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3629:
+	.string	"pidInitConfig"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1599:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF2852:
+	.string	"PWM_TYPE_STANDARD"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2777:
+	.string	"long long unsigned int"
+.LASF2729:
+	.string	"CW180_DEG"
+.LASF2260:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF2495:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2620:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2018:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF3491:
+	.string	"batteryConfig_s"
+.LASF3503:
+	.string	"batteryConfig_t"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2007:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2571:
+	.string	"MSP_RESERVE_3 255"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2826:
+	.string	"OWNER_I2C_SDA"
+.LASF3575:
+	.string	"gyro_fusion_mode"
+.LASF2447:
+	.string	"MSP_FC_VARIANT 2"
+.LASF3463:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_20"
+.LASF2926:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF3584:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF3412:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF3225:
+	.string	"gpsProvider_e"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF1748:
+	.string	"____sigset_t_defined "
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF2676:
+	.string	"uint32_t"
+.LASF2814:
+	.string	"OWNER_ADC_RSSI"
+.LASF3031:
+	.string	"BOXBLACKBOXERASE"
+.LASF3467:
+	.string	"voltageMeterId_e"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2634:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF3067:
+	.string	"yaw_control_reversed"
+.LASF2263:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1931:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1554:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF1923:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF2824:
+	.string	"OWNER_SPI_MOSI"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2865:
+	.string	"motorPwmProtocol"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF3498:
+	.string	"batteryCapacity"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF3175:
+	.string	"PID_NAVR"
+.LASF2727:
+	.string	"CW0_DEG"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF2700:
+	.string	"buildTime"
+.LASF2276:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2443:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF3172:
+	.string	"PID_ALT"
+.LASF2543:
+	.string	"MSP_GPS_CONFIG 132"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF3373:
+	.string	"TASK_NONE"
+.LASF2150:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1958:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1656:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF3234:
+	.string	"gpsAutoConfig_e"
+.LASF1524:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF3104:
+	.string	"stateFlags"
+.LASF2735:
+	.string	"sensor_align_e"
+.LASF2645:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF2983:
+	.string	"rates"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF2491:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1696:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2550:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1925:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1437:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1553:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF2991:
+	.string	"MSP_RESULT_ERROR"
+.LASF3786:
+	.string	"motorConfig"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF3555:
+	.string	"magneticDeclination"
+.LASF2766:
+	.string	"ICM_20608_SPI"
+.LASF3430:
+	.string	"currentSensorADCConfig_System"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2371:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF3464:
+	.string	"VOLTAGE_METER_ID_CELL_1"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF3039:
+	.string	"bits"
+.LASF2631:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1871:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2532:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF1670:
+	.string	"__time_t_defined 1"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF3014:
+	.string	"BOXLEDMAX"
+.LASF2349:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_WRITE_BUFFER_PAGES * FLASHFS_PAGE_SIZE)"
+.LASF1460:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF2944:
+	.string	"task_statistics"
+.LASF3366:
+	.string	"TASK_COMPASS"
+.LASF2307:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF3137:
+	.string	"MIXER_VTAIL4"
+.LASF1595:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF3478:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF1482:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1777:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF3233:
+	.string	"GPS_AUTOCONFIG_ON"
+.LASF1484:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF2548:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1889:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF2222:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ARCITIMER 10000"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF2010:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF3747:
+	.string	"findBoxByPermanentId"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1832:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF2832:
+	.string	"OWNER_MPU_CS"
+.LASF2335:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1928:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF3389:
+	.string	"CURRENT_METER_ID_12V_10"
+.LASF3157:
+	.string	"motorConfig_System"
+.LASF1475:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF3024:
+	.string	"BOXSERVO2"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2278:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF3664:
+	.string	"voltageMeterRead"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF2762:
+	.string	"MPU_65xx_SPI"
+.LASF2155:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2129:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2900:
+	.string	"rxCallback"
+.LASF3232:
+	.string	"GPS_AUTOCONFIG_OFF"
+.LASF3334:
+	.string	"rcFrameStatusFn"
+.LASF1479:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF2918:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1598:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2339:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF2670:
+	.string	"char"
+.LASF3652:
+	.string	"getEstimatedVario"
+.LASF1508:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2739:
+	.string	"readFn"
+.LASF2810:
+	.string	"OWNER_ADC"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF2479:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2797:
+	.string	"flashGeometry_s"
+.LASF2803:
+	.string	"flashGeometry_t"
+.LASF1451:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF1450:
+	.string	"STR_HELPER(x) #x"
+.LASF2829:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF2185:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF2047:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF3045:
+	.string	"modeActivationCondition_s"
+.LASF3049:
+	.string	"modeActivationCondition_t"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2721:
+	.string	"instance"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF3725:
+	.string	"bytesRemainingInBuf"
+.LASF3006:
+	.string	"BOXHEADFREE"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF2787:
+	.string	"__kind"
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1624:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF1703:
+	.string	"_TIME_H 1"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF3569:
+	.string	"gyro_lpf"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF3040:
+	.string	"boxBitmask_t"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2206:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF3765:
+	.string	"voltageSensorADCConfigMutable"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF3405:
+	.string	"CURRENT_METER_ID_VIRTUAL_1"
+.LASF3406:
+	.string	"CURRENT_METER_ID_VIRTUAL_2"
+.LASF2988:
+	.string	"currentControlRateProfile"
+.LASF1513:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF3121:
+	.string	"MIXER_TRI"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2329:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF2905:
+	.string	"serialRead"
+.LASF3391:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_10"
+.LASF2364:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF1434:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1991:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2121:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF1490:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1429:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2930:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF3191:
+	.string	"SystemCoreClock"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF3422:
+	.string	"CURRENT_SENSOR_VIRTUAL"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3322:
+	.string	"fpvCamAngleDegrees"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF2541:
+	.string	"MSP_BATTERY_STATE 130"
+.LASF3035:
+	.string	"BOXDSHOTREVERSE"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF3377:
+	.string	"CURRENT_METER_ID_NONE"
+.LASF3069:
+	.string	"rcControlsConfig_System"
+.LASF3607:
+	.string	"activeBoxIds"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF2778:
+	.string	"__pthread_internal_list"
+.LASF3273:
+	.string	"SERIAL_PORT_UART4"
+.LASF1421:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF2040:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2156:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF3538:
+	.string	"accelerometerConfig_System"
+.LASF3237:
+	.string	"gpsAutoBaud_e"
+.LASF1432:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1848:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF3754:
+	.string	"gyroConfig"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF2648:
+	.string	"RATEPROFILE_MASK (1 << 7)"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF3801:
+	.string	"systemConfigMutable"
+.LASF3381:
+	.string	"CURRENT_METER_ID_5V_1"
+.LASF3382:
+	.string	"CURRENT_METER_ID_5V_2"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1536:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1672:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1853:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF3370:
+	.string	"TASK_BLACKBOX"
+.LASF3324:
+	.string	"airModeActivateThreshold"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF2580:
+	.string	"MSP_SET_SETTING 158"
+.LASF2940:
+	.string	"systemConfig_s"
+.LASF2946:
+	.string	"systemConfig_t"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2646:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF2957:
+	.string	"dterm_average_count"
+.LASF2449:
+	.string	"MSP_BOARD_INFO 4"
+.LASF3586:
+	.string	"frskyGpsCoordFormat_e"
+.LASF2273:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2138:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2473:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF2226:
+	.string	"TRANSPONDER_GAP_TOGGLES_ILAP 1"
+.LASF3140:
+	.string	"MIXER_DUALCOPTER"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF3213:
+	.string	"speed"
+.LASF1681:
+	.string	"_BITS_SCHED_H 1"
+.LASF2110:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1455:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF2507:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2741:
+	.string	"ADCRaw"
+.LASF3108:
+	.string	"failsafe_off_delay"
+.LASF468:
+	.string	"__PMT"
+.LASF1467:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2572:
+	.string	"MSP_STATUS_EX 150"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2484:
+	.string	"MSP_RX_MAP 64"
+.LASF2069:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2318:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF3101:
+	.string	"CALIBRATE_MAG"
+.LASF2061:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2343:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF3361:
+	.string	"TASK_DISPATCH"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2413:
+	.string	"USE_SERIAL_4WAY_BLHELI_BOOTLOADER "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF3469:
+	.string	"VOLTAGE_METER_ADC"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2809:
+	.string	"OWNER_LED"
+.LASF3697:
+	.string	"frame"
+.LASF3205:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF1638:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF1843:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF3171:
+	.string	"PID_YAW"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF2334:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF3734:
+	.string	"flightMode_boxId_map"
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2093:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1415:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2985:
+	.string	"rcYawExpo8"
+.LASF2395:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF2245:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF2655:
+	.string	"OSD_FLAGS_OSD_HARDWARE_MAX_7456 (1 << 4)"
+.LASF3048:
+	.string	"range"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF3548:
+	.string	"rollDegrees"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF3489:
+	.string	"supportedVoltageMeterCount"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2889:
+	.string	"mode"
+.LASF3542:
+	.string	"baro_noise_lpf"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF3418:
+	.string	"amperage"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF3188:
+	.string	"pid_process_denom"
+.LASF2340:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF1904:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2455:
+	.string	"MSP_MODE_RANGES 34"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2375:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF1651:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF2557:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF3589:
+	.string	"frskyUnit_e"
+.LASF3275:
+	.string	"SERIAL_PORT_USART6"
+.LASF3276:
+	.string	"SERIAL_PORT_USART7"
+.LASF3152:
+	.string	"digitalIdleOffsetValue"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF2751:
+	.string	"mpuResetFnPtr"
+.LASF2696:
+	.string	"blackboxConfig_System"
+.LASF2943:
+	.string	"debug_mode"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1530:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2626:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1533:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF2009:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF3689:
+	.string	"mspPostProcessFn"
+.LASF2001:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1828:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2144:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2780:
+	.string	"__next"
+.LASF1581:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF2795:
+	.string	"long long int"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF3518:
+	.string	"SENSOR_MAG"
+.LASF2463:
+	.string	"MSP_MIXER_CONFIG 42"
+.LASF1465:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF3661:
+	.string	"systemReset"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF1806:
+	.string	"PP_IIF_0(t,f) f"
+.LASF3062:
+	.string	"rcControlsConfig_s"
+.LASF1584:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF3688:
+	.string	"reply"
+.LASF2765:
+	.string	"ICM_20602_SPI"
+.LASF1778:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2973:
+	.string	"crash_recovery_angle"
+.LASF3702:
+	.string	"readAddress"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF3144:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF1760:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF1641:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2280:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF3594:
+	.string	"telemetry_inverted"
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1469:
+	.string	"VERY_FAST_MATH "
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2217:
+	.string	"TRANSPONDER_TOGGLES_ARCITIMER (TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER + TRANSPONDER_GAP_TOGGLES_ARCITIMER)"
+.LASF1500:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2501:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF3568:
+	.string	"gyro_sync_denom"
+.LASF1454:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF2065:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1922:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2342:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF3051:
+	.string	"box_e"
+.LASF1914:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF3185:
+	.string	"pid8_t"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2361:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF3655:
+	.string	"pwmGetMotors"
+.LASF3055:
+	.string	"box_t"
+.LASF1446:
+	.string	"FC_FIRMWARE_NAME \"Cleanflight\""
+.LASF2828:
+	.string	"OWNER_SDCARD_CS"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2377:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2499:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF3374:
+	.string	"TASK_SELF"
+.LASF1441:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF3004:
+	.string	"BOXANTIGRAVITY"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF3413:
+	.string	"CURRENT_METER_ESC"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1913:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3419:
+	.string	"amperageLatest"
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF2402:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1411:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF2914:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2036:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2763:
+	.string	"MPU_9250_SPI"
+.LASF1265:
+	.string	"CMS "
+.LASF1567:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1738:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2510:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF2841:
+	.string	"OWNER_OSD"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2265:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1737:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF2246:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF3667:
+	.string	"featureMask"
+.LASF2720:
+	.string	"deviceSpi_s"
+.LASF2579:
+	.string	"MSP_SETTING_INFO 157"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2838:
+	.string	"OWNER_USB"
+.LASF1862:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF3077:
+	.string	"armingConfig_s"
+.LASF2972:
+	.string	"crash_time"
+.LASF2392:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF2959:
+	.string	"pidAtMinThrottle"
+.LASF1614:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF3777:
+	.string	"gpsConfigMutable"
+.LASF1623:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF719:
+	.string	"__size_t "
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF3321:
+	.string	"rcInterpolationInterval"
+.LASF3656:
+	.string	"strlen"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1587:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2884:
+	.string	"SERIAL_BIDIR_PP"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF3438:
+	.string	"VOLTAGE_METER_ID_BATTERY_2"
+.LASF1520:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF3597:
+	.string	"frsky_vfas_precision"
+.LASF3212:
+	.string	"rate"
+.LASF1458:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3681:
+	.string	"sensors"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF3808:
+	.string	"mspFcInit"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1416:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2916:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1666:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1466:
+	.string	"sq(x) ((x)*(x))"
+.LASF1674:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2649:
+	.string	"BME(boxId) do { bitArraySet(&ena, boxId); } while (0)"
+.LASF3261:
+	.string	"modeColorIndexes_s"
+.LASF3263:
+	.string	"modeColorIndexes_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2474:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF2434:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF2282:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2964:
+	.string	"itermThrottleThreshold"
+.LASF3238:
+	.string	"gpsConfig_s"
+.LASF3243:
+	.string	"gpsConfig_t"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF2831:
+	.string	"OWNER_BARO_CS"
+.LASF2673:
+	.string	"int32_t"
+.LASF2258:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF1653:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF2326:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2020:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF3155:
+	.string	"mincommand"
+.LASF2048:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF3364:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF3167:
+	.string	"GPS_directionToHome"
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF2298:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF3163:
+	.string	"navigationMode_e"
+.LASF3298:
+	.string	"step"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF3308:
+	.string	"rx_spi_rf_channel_count"
+.LASF2857:
+	.string	"PWM_TYPE_MAX"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF3511:
+	.string	"flightDynamicsTrims_def_t"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2372:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1506:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF3063:
+	.string	"deadband"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF3724:
+	.string	"readLen"
+.LASF2525:
+	.string	"MSP_ANALOG 110"
+.LASF3009:
+	.string	"BOXCAMTRIG"
+.LASF2100:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF3127:
+	.string	"MIXER_HEX6"
+.LASF1608:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF2974:
+	.string	"crash_recovery_rate"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2855:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2376:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2799:
+	.string	"pagesPerSector"
+.LASF2248:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2742:
+	.string	"revisionCode"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF3215:
+	.string	"customServoMixers_SystemArray"
+.LASF3128:
+	.string	"MIXER_FLYING_WING"
+.LASF3675:
+	.string	"mspSetSettingCommand"
+.LASF3132:
+	.string	"MIXER_OCTOFLATP"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1430:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF3133:
+	.string	"MIXER_OCTOFLATX"
+.LASF1726:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2555:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF2658:
+	.string	"unsigned int"
+.LASF2130:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF2707:
+	.string	"blackboxConfig_s"
+.LASF1308:
+	.string	"BARO "
+.LASF2695:
+	.string	"blackboxConfig_t"
+.LASF2789:
+	.string	"__elision"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF1668:
+	.string	"_PTHREAD_H 1"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF2112:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1792:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2798:
+	.string	"sectors"
+.LASF2977:
+	.string	"controlRateConfig_s"
+.LASF2987:
+	.string	"controlRateConfig_t"
+.LASF3606:
+	.string	"boxes"
+.LASF1810:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3974:
+	.string	"rx_pwm.h"
+.LASF3976:
+	.string	"asyncfatfs.h"
+.LASF3853:
+	.string	"thread-shared-types.h"
+.LASF3859:
+	.string	"pwm_output.h"
+.LASF3923:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3833:
+	.string	"/usr/include"
+.LASF3929:
+	.string	"mathcalls-helper-functions.h"
+.LASF3883:
+	.string	"voltage_ids.h"
+.LASF3893:
+	.string	"fc_msp.c"
+.LASF3927:
+	.string	"fp-logb.h"
+.LASF3925:
+	.string	"floatn-common.h"
+.LASF3905:
+	.string	"stdint.h"
+.LASF3867:
+	.string	"fc_msp.h"
+.LASF3981:
+	.string	"osd.h"
+.LASF3962:
+	.string	"pthread_stack_min.h"
+.LASF3871:
+	.string	"altitude.h"
+.LASF3810:
+	.string	"src/main/build"
+.LASF3830:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3904:
+	.string	"stdbool.h"
+.LASF3856:
+	.string	"flash.h"
+.LASF3840:
+	.string	"time.h"
+.LASF3969:
+	.string	"serial_escserial.h"
+.LASF3909:
+	.string	"wordsize.h"
+.LASF3845:
+	.string	"color.h"
+.LASF3849:
+	.string	"bus.h"
+.LASF3875:
+	.string	"navigation.h"
+.LASF3825:
+	.string	"src/main/target/SITL"
+.LASF3930:
+	.string	"mathcalls.h"
+.LASF3983:
+	.string	"serial_4way.h"
+.LASF3855:
+	.string	"pthreadtypes.h"
+.LASF3975:
+	.string	"sound_beeper.h"
+.LASF3890:
+	.string	"compass.h"
+.LASF3938:
+	.string	"config_eeprom.h"
+.LASF3889:
+	.string	"boardalignment.h"
+.LASF3939:
+	.string	"parameter_group_ids.h"
+.LASF3959:
+	.string	"__sigset_t.h"
+.LASF3843:
+	.string	"version.h"
+.LASF3888:
+	.string	"barometer.h"
+.LASF3953:
+	.string	"timer_t.h"
+.LASF3872:
+	.string	"failsafe.h"
+.LASF3931:
+	.string	"platform.h"
+.LASF3834:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3972:
+	.string	"transponder_ir.h"
+.LASF3814:
+	.string	"src/main/drivers/barometer"
+.LASF3988:
+	.string	"filter.h"
+.LASF3841:
+	.string	"blackbox.h"
+.LASF3857:
+	.string	"resource.h"
+.LASF3956:
+	.string	"atomic_wide_counter.h"
+.LASF3864:
+	.string	"fc_core.h"
+.LASF3818:
+	.string	"src/main/flight"
+.LASF3955:
+	.string	"pthreadtypes-arch.h"
+.LASF3947:
+	.string	"endianness.h"
+.LASF3873:
+	.string	"imu.h"
+.LASF3970:
+	.string	"vcd.h"
+.LASF3819:
+	.string	"src/main/io/asyncfatfs"
+.LASF3842:
+	.string	"debug.h"
+.LASF3966:
+	.string	"io_def_generated.h"
+.LASF3903:
+	.string	"stdc-predef.h"
+.LASF3851:
+	.string	"accgyro.h"
+.LASF3868:
+	.string	"rc_adjustments.h"
+.LASF3921:
+	.string	"math.h"
+.LASF3829:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3940:
+	.string	"exti.h"
+.LASF3968:
+	.string	"sdcard.h"
+.LASF3964:
+	.string	"io_def.h"
+.LASF3865:
+	.string	"msp.h"
+.LASF3907:
+	.string	"features.h"
+.LASF3828:
+	.string	"src/main"
+.LASF3937:
+	.string	"trace.h"
+.LASF3820:
+	.string	"src/main/io"
+.LASF3815:
+	.string	"src/main/drivers/compass"
+.LASF3958:
+	.string	"setjmp.h"
+.LASF3989:
+	.string	"sonar.h"
+.LASF3951:
+	.string	"struct_tm.h"
+.LASF3846:
+	.string	"streambuf.h"
+.LASF3908:
+	.string	"features-time64.h"
+.LASF3821:
+	.string	"src/main/msp"
+.LASF3894:
+	.string	"feature.h"
+.LASF3813:
+	.string	"src/main/drivers/accgyro"
+.LASF3978:
+	.string	"beeper.h"
+.LASF3957:
+	.string	"struct_rwlock.h"
+.LASF3870:
+	.string	"runtime_config.h"
+.LASF3861:
+	.string	"config.h"
+.LASF3913:
+	.string	"stubs.h"
+.LASF3891:
+	.string	"gyro.h"
+.LASF3916:
+	.string	"time64.h"
+.LASF3898:
+	.string	"string.h"
+.LASF3839:
+	.string	"target.h"
+.LASF3892:
+	.string	"telemetry.h"
+.LASF3932:
+	.string	"common_fc_pre.h"
+.LASF3979:
+	.string	"gimbal.h"
+.LASF3902:
+	.string	"maths.h"
+.LASF3917:
+	.string	"wchar.h"
+.LASF3910:
+	.string	"timesize.h"
+.LASF3811:
+	.string	"src/main/common"
+.LASF3967:
+	.string	"max7456.h"
+.LASF3884:
+	.string	"voltage.h"
+.LASF3985:
+	.string	"vtx_control.h"
+.LASF3879:
+	.string	"rx.h"
+.LASF3882:
+	.string	"current.h"
+.LASF3832:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3941:
+	.string	"rcc_types.h"
+.LASF3984:
+	.string	"serial_4way_impl.h"
+.LASF3877:
+	.string	"gps.h"
+.LASF3944:
+	.string	"time_t.h"
+.LASF3887:
+	.string	"acceleration.h"
+.LASF3838:
+	.string	"stddef.h"
+.LASF3928:
+	.string	"fp-fast.h"
+.LASF3986:
+	.string	"msp_protocol.h"
+.LASF3895:
+	.string	"flashfs.h"
+.LASF3897:
+	.string	"msp_settings.h"
+.LASF3924:
+	.string	"floatn.h"
+.LASF3926:
+	.string	"flt-eval-method.h"
+.LASF3848:
+	.string	"bus_i2c.h"
+.LASF3878:
+	.string	"ledstrip.h"
+.LASF3858:
+	.string	"timer.h"
+.LASF3914:
+	.string	"stubs-64.h"
+.LASF3963:
+	.string	"io.h"
+.LASF3935:
+	.string	"parameter_group.h"
+.LASF3863:
+	.string	"controlrate_profile.h"
+.LASF3862:
+	.string	"pid.h"
+.LASF3823:
+	.string	"src/main/scheduler"
+.LASF3881:
+	.string	"current_ids.h"
+.LASF3971:
+	.string	"vtx_common.h"
+.LASF3965:
+	.string	"utils.h"
+.LASF3948:
+	.string	"struct_sched_param.h"
+.LASF3874:
+	.string	"mixer.h"
+.LASF3912:
+	.string	"long-double.h"
+.LASF3886:
+	.string	"sensors.h"
+.LASF3949:
+	.string	"cpu-set.h"
+.LASF3952:
+	.string	"clockid_t.h"
+.LASF3852:
+	.string	"accgyro_mpu.h"
+.LASF3977:
+	.string	"fat_standard.h"
+.LASF3900:
+	.string	"msp_dataflash.h"
+.LASF3960:
+	.string	"struct___jmp_buf_tag.h"
+.LASF3866:
+	.string	"rc_modes.h"
+.LASF3837:
+	.string	"stdint-uintn.h"
+.LASF3946:
+	.string	"endian.h"
+.LASF3961:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF3950:
+	.string	"clock_t.h"
+.LASF3880:
+	.string	"scheduler.h"
+.LASF3973:
+	.string	"adc.h"
+.LASF3896:
+	.string	"fc_rc.h"
+.LASF3869:
+	.string	"rc_controls.h"
+.LASF3885:
+	.string	"battery.h"
+.LASF3911:
+	.string	"cdefs.h"
+.LASF3919:
+	.string	"__locale_t.h"
+.LASF3822:
+	.string	"src/main/rx"
+.LASF3915:
+	.string	"typesizes.h"
+.LASF3809:
+	.string	"src/main/blackbox"
+.LASF3817:
+	.string	"src/main/fc"
+.LASF3987:
+	.string	"msp_serial.h"
+.LASF3850:
+	.string	"sensor.h"
+.LASF3990:
+	.string	"sonar_hcsr04.h"
+.LASF3933:
+	.string	"common_fc_post.h"
+.LASF3918:
+	.string	"locale_t.h"
+.LASF3826:
+	.string	"src/main/target"
+.LASF3942:
+	.string	"pthread.h"
+.LASF3844:
+	.string	"axis.h"
+.LASF3920:
+	.string	"strings.h"
+.LASF3899:
+	.string	"system.h"
+.LASF3816:
+	.string	"src/main/drivers"
+.LASF3906:
+	.string	"libc-header-start.h"
+.LASF3860:
+	.string	"serial.h"
+.LASF3901:
+	.string	"bitarray.h"
+.LASF3945:
+	.string	"struct_timespec.h"
+.LASF3936:
+	.string	"build_config.h"
+.LASF3922:
+	.string	"math-vector.h"
+.LASF3824:
+	.string	"src/main/sensors"
+.LASF3836:
+	.string	"stdint-intn.h"
+.LASF3982:
+	.string	"osd_slave.h"
+.LASF3876:
+	.string	"servos.h"
+.LASF3980:
+	.string	"motors.h"
+.LASF3812:
+	.string	"src/main/config"
+.LASF3835:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3854:
+	.string	"struct_mutex.h"
+.LASF3827:
+	.string	"src/main/telemetry"
+.LASF3934:
+	.string	"blackbox_fielddefs.h"
+.LASF0:
+	.string	"./src/main/fc/fc_msp.c"
+.LASF3954:
+	.string	"struct_itimerspec.h"
+.LASF3847:
+	.string	"io_types.h"
+.LASF3943:
+	.string	"sched.h"
+.LASF3831:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001R"
+	.text
+	.section	.gnu.lto_.icf.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\276\006\215\026"
+	.string	"\226\036nI\260\226Q\032\003\\\303\004K\362\334\372c\350\340\302\241t\301s\003\315e\323sdD8\263\236\232o:\357\355\377A\377A\377A\313q\f\030\225\201\210\204o\221GM\020\016[\303\211\004\224\244\325\026\221\231\t\373M~\313\326\211\310W"
+	.string	"P"
+	.string	"\\"
+	.string	"\257\253\"I\254f\242\3504\224\362\331\324\232\353\265\305\004\352\250WC3\375\227\024$\253,\232-\211\350x2\322r\r`\3273{lz\254|\224\031\266\257\353\344\306L'\337]\323[\217\323\3510\303\234\223\251\252\342\324\344}\t}@+\242\370\376LU\275-k\256+\030;\204w\231mJm7\232\363\376\340\335\366\256sm\331\265m\327\034\274\r\246\f\026\254\340\004\353<n\216`\363\003\233\033\330\274@\316\224\022x\307\031g\300\315\342\"\355}\366\314\346\225- \300\364\361\361\275\022\221\262$\375n\226t\262\303\307\020\332\006\037\366\360\336\341\221\303\267\r\032\316P\3070]\267\356\341S\300\250(\335X\364\343\bS\220n\335\205\203&a5r$]\001\252F?*\245\334\306\246P\351M\375"
+	.ascii	"\r\013\"\024F\301\265x`AY2s\377\354\270\351\270},\320\no\317"
+	.ascii	"\322)\274Ox%\\\347\231\347Zi=\302N[\215~TJ1`\274p\321\202\305"
+	.ascii	"\216@\031_\202+\256XO\226\370T\360\036y\344\214\036@\270\244"
+	.ascii	" Q\2264lx\301\201\242l\302\"\344\306\211\246.DD&\316\317\021"
+	.ascii	"\323\236\317\353\347\267\317\317g\312\341\221TV\211c\224,\025"
+	.ascii	"!\341\221OPA-\273\235}h:\264\217\210\r1\202\020Z\350\335\273"
+	.ascii	"iK\003\200\214\250\241=A\201\b\t)IA!\215\001\240\002D#i\035\022"
+	.ascii	"\240\303)\230\345\bEB\206D\002\221\251Q\230\362)\024\326\f\234"
+	.ascii	"\227\2370&\361\302L\330@\033\205X\256\377(\273\263\275 a\002"
+	.ascii	"\272@\265\314p.Q\3648\205\2506q<Jd\213\021\211aA\202\307\b\033"
+	.ascii	"\207bu\233\035\322?d?\206\234\254\262+\301\237U\326MU\\A\335"
+	.ascii	"\323\323KB\235\354\316s7\037\215\367\346\245\375a\3729\344\205"
+	.ascii	"\026\201\232\355\204H\266k\332 \324~-!g\374\200\352\214\223\344"
+	.ascii	"\237\366\273L\341\007\270_\\n\027I=l\210\376\365\326-\233\215"
+	.ascii	"s8\320\024\177\243b\344T|=\026\321PpibYi[H\327\3263\342(\216"
+	.ascii	"\257\321\177\0244\267\\\327&\356\356B?\350\356\340\030,Zy_~\215"
+	.ascii	"m\362\032g\210H)\254\316~9\345\271\320\271.\201\373\3152\273"
+	.ascii	"\001\323\230fx\237\023J\266\361\317\nF<\373\322<\215E\341e\262"
+	.ascii	"W\341yR\017\366\357\224\245\350\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375``\023\r\024"
+	.string	"\342\216\"\034`M\222\016\252a\230\372\034\215\022\302\b&\b\002\221\325D\205\005C\362\007\262wJ\001\356N\274Di\250\"|!\352\207JN\005\234eY\226\251\214B)\207\363\345)\232\266\367\336o\357\275\337\336\364\367\333{\337\260\272,\006R_\230\036\244\260\372\277\372VQ\202\031a*s`\034\344s\210\022\332\340\350\261\370\201\243*\002\273"
+	.string	"\243\353\370\216\276\367\336b1\225!R\264\303(\377\364\365P\246\215\221G$\005m\210H\026H\220\004\201\030\250\361\351M*\313~\006\261\005F)\311\212\270\003\022@\302,\204\2224\211)C\020!\2040C\201\210\004\022\211\210\004\"\243I\332\227"
+	.string	"\253   \205I(`\216\034\032\227\243\274\216\274}`\343U*\254\313\\x\364\244\026:\372}\3723A\225\227H~\212D>jK\277\016\264j<\n\022\037D]~\243\323\316\367C\245\036\306\007t\202\365\267{\226\345?\277-\002Z"
+	.ascii	"`O\332.W_GI-\247\016}*~\350\2441(\005X`\343\302\321\037t>0?b"
+	.ascii	"\375\fZ \233\341\222\254\377,\0244x\305\2713\t\313\352\035\271"
+	.ascii	"\303\3579\020"
+	.string	"C,Xi~\037\345\340\"p\006\303p\220-\006\233\2767\351\013@\263\0312\004\217}\331\354>?\3405\351\315z\"\275h\261\202D\301\247\263\246`\234\340<\371vG\372\bm\036\006\335-\024\031z}\255B\377\341?\354@\274\221t\242B\227y\301\313\032g\211W\260\326\244\305\004u\323\232\001\310\223\264\206\240b\"\307\237\201\005O\357\224#}\3002\007/a\354CP-\016H\251a\005B\2204\273\005\243\324\036\226*\210\225\2756;=\241\"h}$\226\006\314\2033|@\033\240\220\267\317\252\013\304\344\367\026\365\n\255\224;'\271\202\203\351 \301\004\206YZ\333\330\321\260\264A\004\\\263).\260\255\307D\316\236\252\320\354x\330^\334,\035\017/68\370\236\325\304\r\3120\321\267\213\206\211\201\3345 \300\333\236,\357\321\347a\326\243K;|V\025_\234\326F\225\004MC\340\021\376\005\030\bR\016"
+	.string	"R\316\361hC\315\nSD\374-\322*\016\261\212\037UI\367\207r\367,\222Fy\214i\210\341\300\262\303F\032\375\203/?\200\270\001\252\025\223\331\3262\310\350-\205\374z\207\302"
+	.ascii	"\225\2518\001\274\312\215\247"
+	.text
+	.section	.gnu.lto_.inline.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\350'EM"
+	.string	"\312Lt\020@`\236J:3`+\363o\207T\036\242\352\020\307\002\326\263P5d\236\343n\3141\355\017H_\312\3603\002\347()\037\270._\246\r\377\024A\330\300"
+	.string	"\307:\022\2527 \330\032d2\366\2262\005\326"
+	.ascii	"\002\001\003\001S\224\337\325\335JG\"n\265\342\270\356\256\037"
+	.ascii	"\267\326W\262,K\223\376\374\003T\263\344\003\3403s\223[__\353"
+	.ascii	"2\211\255y\366\371\023\212\311\264\021Q\033\277\375\255P\344"
+	.ascii	"\311>\331e\364\262\317\356\030L\005\320\257\270/\233\313\226"
+	.ascii	"Qg\260\240\264\275\275\243s\367\024\235c\242\006V\276vS\361 "
+	.ascii	"\226.]J'\273g\3206\"f_\345\315n)\216\342\306"
+	.string	"\007\216\370\355\356W\245\360\022\300\333\304\373\034#\345\254CK\270\266\266\013\331\254y\231\020\024\226L\242J\371\337\325*\216M\214\365\002\337+*\244\317\310 \177)y\317\377\322\240{\272\033\351{&\2613\211\361\177#\372\327s\324\236\317S\334\335=\376Z\335\275\365\327o\323\257\340\335\375V\3219\335]\364\0338\0059\0017\237\352\317(j8V\007\b\021*\316\350\365H\\\207I:y\026\b\305\217\370\022\356lm\315\274\3115W\327\267\364\263\310\245\243\320\203o\222?4\270\361\314\224\213\035@lH\257ntZ\252\230'\247\270\220\254\017\231\322\313\356(^\2026G\357\304\315>O\257A;\356\216\276+\203<3\036\336\031\036KP\2546\205\356\217\001C\\\206\016qq\374\253\270P \301&\274\266\340_\2755yxj\354\352\350\320\354\034\035\277\363=\316\363\256\246nN\314\211\022 <p\310paB\004\b"
+	.string	"\030\234^Q\263vKS\304\266\244T\271Y\317\236W\030\201'\330#\2423\211\021\200\302'\311\223U\324\t\233\\\341\370\363T$-\022\306\006vT\377;\361\272\340m\301k\267N\234E\265\364F'\306\242D\337\032\034&LpO\303\021\234\364,\254h\225\356&\376\300\231\304\226\212\213t\232\020\"%a\003S\262t\002\177\257S\034\327E\306\b\205zg\364z\304\312\240$(\232\347\245,\316"
+	.ascii	"\233\\\340\241\322W.\220\257\212\202s\031\023C5\343I2\220\357"
+	.ascii	"\007"
+	.string	"\230\004)\372\346\326\367$iJ\037(jFP\245\214!\244!\233\2311!\343oE\251\360\370\323\243o\t\376\023~\360y\216\347\202\017<\340\357\334\316\347\364\311\201\203wg\227\306L\234\t\022#>t\330\200\301\202\204\007D\033\374\245Fx\245\350\217<\3517@U\033\177\033\364L\026)\200(n\3205\277;g\037C\2328\223\030\211\222<\267\271\242\350Zq\355M\322\313\227SLF\t\236\217$\252rk,$\034\334&\316\372/\242\202\203\242\272/\037yw\363\021\265\326\257i\222K.\331\337\006\300eY\232\246i6sY\226\346r\355s\277\257U\212\257\354\361\032b$\305hdZ\220X\270ys\241h\233\024\035\215\341\334g&k\213\2033OJ\321 fc\2120\b\377\177\342\302\230\":\227\205;a\204\301X\247`\fM1r\364\027\002\306\2224On\262\313\256\035\203\346\341z\262U\267\373\211\261"
+	.string	"\342\321\251'M\363\211n\371\341\023SO\222O\264\316 \241\264\372(~\342\247\007\022\242\363v\223{\250\354\341:\"\233T\360.\031Z\0213\"{d\310\031\036\333\026\234\365?\253\2257\266`\254\007\260{\373\nC\342.\026\007\217\371\360\"\245\006\016\032\230f\210g\343H\247\246\377;\306\377\212\213mm\362\216\256\230\257\255M\036\361,*\371\005[\370\345\f.\256\025\317\252\025\225\0334\024\\\372\"\220\242\207\207\207z\222\234m\031 \303\221G\232\332\335\355\204X!"
+	.string	"o"
+	.string	"\021\334\370\337`<l\207\204K/p\260\02783@\r\256bwwon\255\375\355\177\267\277&\237\275k\236\273\273\035E\013\271\302\276\2104\370\357\315\n\032\tTLW\326\304\213A\202\325\250\342+\321\214\210\311H\222$\313\032\242\n\020\022&QR:\251\371\022\300\322\034\006\243@\212\0242\204\210\210\210\210H \"\201H\020I\222$\035\255s'\370\027\337J\027\324=1I\324~\276\036\fg\211V\035C\350\321\234c<\345\364\243A]\311\336`"
+	.ascii	"\332\250\374~\231\237X\037\246\246Pd\333\250\217\f\301<;c\357"
+	.ascii	"\027\374\251y\336\335\025x\233\305\224p\003X\374\023J\027\314"
+	.ascii	"\033\350K\342T\031\241\213\003bd\3208\321Ow\304S\024\213G\371"
+	.ascii	"Q\332\t\377cn\364\030\240\214\246\027J\277\253\330 B\355\036"
+	.ascii	"\331n\362%\323\210\3723\377\2752I\273S\036\370)9\271\357\302"
+	.ascii	"\202\325PX\021\320\3008\350\241O\377b\177T1\001\023\234c\357"
+	.ascii	"rYm\372\024f\260\345\027y\330\r\252\005"
+	.string	"\007B\371\362x\343\236\004\033\276\027\026V\252\202]\322,\304?a\241W\275+\274\006]y\221\0033\277\321\343}\007\245\211\250\377f4\213M\376\257\007\357z\244\350\313\021\342\024\202j-a\326\276\205\212\224\007G\201\245:)\270V#\331\027\304\226D\331/\325\254\312\364e-\326\204&\270\373\001\222\002\353\256\277zU\372\326!\271\026Z\264\310\030\341\202\260*\260)\320\251\030\3648S\325\n\356Z.\331\3622\376\377Z\236\211\215\t.\300;J\231\247\301\247\023\305)\373\034\371 P\036\023'w\203\325\200\244R\311Z\216\201@\372\026\360\276\372\253\027uL\3571G\267\032^\227\202\253\252\374\0312\001\245\276G\361\366X\371\225\353Ma\006%^\002|\213\200\250.\352\205\020\311\351\035\177\240\r\266>\327&\224|(~zCY/\264W%.\304\271\232@Zfv\302$\331\300\271\326\036\220\206Pz\347}\035\205"
+	.ascii	"C\376\335T\257\021\321\020b\270\222\306\233 \240\004\272\262"
+	.ascii	"\375\343@Y\331\211\351Q33\007\022\2373\bIO\253\nk\354\0254@L"
+	.ascii	"\344(\313\231 ]\225\214\202\267e\312];U\306\320I$\352\206\302"
+	.ascii	"\267E\272\337\230&\016S!vs\256`\216\344\362\002\236<\246/\027"
+	.ascii	"\213\220\274\370\327X8S\312{\3406\251N\340\361.\353\250\300<"
+	.string	"\350X\201\352\224\221Is\227\366\333\177z\353\332\203 Eq\200\345\"J\343\264{\272:|c\232\2017\321(E\374qqr\037\226\223\350\354?\230h\266\264u\003\227\244\r\247\303\262\213u\276p\206.\200@\264s\203\177$\354\300s\304\"\022\016\246J\235M\001w\377w\270G\001D\265M\374'\254\362X2`\266\336\267\265Ls\223H(?3l'\016\346\356\365\325Y\335GO\036\204\027\302\336\032\241\021\211\245\220\274\332\212y\337\237 \263\035\302 +}L\323\034\246\232R\267x\263\325\326\026q\223\274\245q\336\254JA\t\237!e\356\256\271\343T\037\2477\276\314\013\362_@\353\235\310\376t\335\003/\304\b\264\257LQ\213\207\351_\004\001\206\276\247&\237\302;c-$\316Fu\0238N\320\374\245x\363\252\030\311\267+\016\016\bV\251\351\362t\220\027\262^\223\270\020\322\375\347\257\356\f\020~7\277\t"
+	.ascii	"CwG\021pA\370\304o\227\256\370\271\036\023,\020s`\3406,\035="
+	.ascii	"V,\003\242\320\263\023l\005g\234o!oz\002[\002\267\252\365\220"
+	.ascii	"\bs\350~#\026{\"\223!\307\0049\260\325M\226\267\265L\375\224"
+	.ascii	"T\224\026X\240\376\271d\034\356J\372\b\355\363\360\357\205\275"
+	.ascii	"\270"
+	.ascii	"s\217\320|\350\261\0269\272\006\254\313us\027\372Z\n;3\322aC"
+	.ascii	"\3379\223\337A\247\032W$\233w\177\234\330\204l\333'-\006"
+	.string	"*\333zJ\336$A\255\305#\250\032s\202\257b>\337w[\323\334\351\370\230\00219\314I\3367\227\204\236\277\222\275\337\305\023\377\317\036\226\360\367Oe\214\253\201\ng\0230\324\250u&8\001t[\330\202\333~w\013\305\324\006  Vq\376N$4\220E\310 \207E\335\005&?Sn\265\2259\207'\361S\001Z\335Z\240\277c\336\016U\002\302\207\357\256\323\337\221\001D$ \337\251}\205\344\362d\t\372\232@y\013\\\354W\n\266\263\200G=\245R\005B\213\033F\017\r&x\203\"O\310\27097*x\204\301X\302?\260\333\373}y\361_\270\271\327 bL\340\315\246?\207\307\200\306\331\025\034\211f=\023M\222D/\364\256\227\216y\220D\261]A\213\003\035a\223\236'\322UVs\225\031G\314\214\233\030\354{\035\347\034\272\326Y\251\026\275JQ\300\t\230\304~Uz\223\307\374`\213m\240"
+	.string	"\210\330\242\025\266\026\252\222(\312\254\025\275\356\351\257<)\333\021\317\256K\"0\212P\252Y\246\357eA\230\2016\267\342,^\317\374\013\373\024\240\374\314f\227\212\311%ns\327\324{KX')\007\005>\356\341\002\022X\300\2219\r\333\007J=\023\243\341\331\223\032\004\263\206\311\321\351\302\236\001"
+	.ascii	"e\307\334\274D\232\264H\242\274\226\273\222u\027Nv\224\301Gy"
+	.ascii	"\262\352Dw\325?n\202R\354Q\321\n\263\212\2673F\2652\212%\362"
+	.ascii	")/\242^\316q\331\301\351>0\276\t>\204\347\027\205<\"4X\376b\020"
+	.ascii	"\202\211\217\007m\202ks\"\300R\347{\275t\322\206(\213"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\311:\265;"
+	.string	"\026\256\207B\320\030%\351 \322\274\230\016\b6\r;\375\241\2405f\b\032Q\016\340(\265z\004\373\263*\2310\343\024\364"
+	.string	"\025\345\372\024\351\354\313\310\f8\376|\023k\314/\025x,\222\352l\265\241\331\335\b\221i\007h"
+	.string	"r"
+	.string	"t"
+	.string	"\207x\234\343\234{\305\204X+>\265\034\215\266\254\f\205\022\361\377V@\226\265l \377\343\216\230\217\377\371=6$;\252\350M\3427\331\035~U\265\257\343\212D\347\334\314\221 \031\201\022o\331\377\234k}W'\370\364\241\376\326qp\214\370\330\221,^\255\372\343\331\257\356\007w?\343\370\234\273x\365"
+	.ascii	"_,\200$DT\215\343\325\222\204\017\332\3108\240f|m-Z\213\"\242"
+	.ascii	"\213\313\230\215lur\260"
+	.string	"\033X\016\214\320\034\236\341\334\317.\225\306\240l\222\225`;p\031\210\365\300|t\026Wn\234\222W-\257\356\302\247o\364\235\331\272\332\256.\372\312\264\027\371\275\241\217C_\207\320[\376]\f\n\205\205)\376\325\220\350\373\202\330h\262\267\2265t\375\001\210!\212\370\351ll\034\221)Z\242{\270A\317\030\214l\220\235\263,\223\311\305\245\013\271\335\371\224Ky\362)\361S\323\271Y\226iy\251T*\365Rg\234(X\214VG\242-CtE\374\317\232\334G\304w\035o2\216\343\020\200>eE\345S\366\235\037\354\004\233A\003\253\321\036\021\213\035\0372M\036\3648\215\n\026\223\323\262r\213\253\212_2\203\235A\264}\n):\242\315\211(*\310s\201\307B\205<\0320d\250>\334\343a\313\215V\326ju=}=}\016:d\017\034H\245\234\37363\024j\255\312mU\275H4\032\265\006\f\220H"
+	.string	""
+	.string	"\314\314\330\330\324\324|\223\b\020\230L44\013\026\230\250\334Z\226\333\312}y\261R)\002\004``bbddL\246\004\t\024(p\033P\370\210\350k\257!\313c\371D\337\330\213\027i\242m\240\363\257\\*\325\264\035\312mIW-\237>\234\f\246\"\006\202\224\250\342kmh$I\222,k\242\n\020\204bi\242\206\016\356\001\022@!1\210\002)\f\203 \204\242\020D\fB\304\020B\020CFfDD\2046i\003\004\374J\001\fO\245\305\236\242\244\262\203\220\346F\020\301Y!\214\333Z\223\020Hph\365\022\345\257\366\t\032\202\316/\340\226|\201\027l\213\372\230\233\003\200\273O\261\b\364\225}oM\232)\301e\004\215\206\223\254\306T\003\327\324\246\322IHD\260U\003Z\245\255M\316\305\0353\360R\307\216{V\204\017T\006\215RL["
+	.ascii	"\351\360\235\023K\242\023\0074lm5\357\"\f\035\222\021\213c\237"
+	.ascii	"!\350(N}\261\332(\035>h\217R\303\3600Z>\t2\206\242<\271\b\304"
+	.ascii	"\236&\335o\027\203u\345\365a\370B\3323\021\322\034\357\215\226"
+	.ascii	"'d\323U\\D\003pOm\007 R a"
+	.string	"\032\332\003\331a\317,\255\201\206\347\225o\225\364]\t\375\361:M\001\377\367\323\304kU\325\325\"!\271\312\231\352N\212\013I\217\235\376B.b\3339jA\342r\025\270\353mT\3408t\262\230N\341\237\205\373,\232\241b#\301i\002\372T\213\304Bk\315\234\246\030\013\002\275\316L\235\274Z`E\335\250\250\373\036\362q\016\331\233<\243\324\034K\2632\024<AW\254\225\322\026\306\351h\037\307v)cT\364\226\020\214\370?\225\020h\"VG\270\276\333\205\2205\267\216\372\377\020K\020\267Z\322o\375KP\231\016r\235\251\214\355\266\314\345\351D\235\362S\351\b\333\033\271\360n\244\321\236.f\024\234\262G\224O\361\nN\376I=\376^\214\222\232\370\353:B\327v3|\305\037\276\013J7\022t\315)\275\272\241.&\032\037\324J\214=\255D-\t\033\250\332AW\274r\347J\252c\365\351\217\252\257b\340"
+	.string	"\336\202\221\235!d\337\243\371\2426 \331/,Y\3149\221\351K(\t\202\031\256\370\260qM\241yy\322\037-\304\354\272\313\210\341\250\221\205\324\3573\273\332\3367~\027\205\177\266b\364\304\303^\332\373>\234\3619\326\343Lx\210Q\201\226<.x-\236g\367\307\270_uRV\2172\234\247\007\324\257sZH]f$\305\200\257`\373\004\210\310C\201\036\320\342\342\363\242d\032\277\374\232\305K\204\301\025QF\202\020^\206<\002\256\237'\365\205\275\340\232:D\311_3\321\352\374h6\216L\263\026\316\031_\231q\223\203}t\306\243ZX\nY-\016\254\206\272\rB\230\273\257\357\023!s[\0233\274#"
+	.string	"\346\227\344J\177\006\256\fS\260\273\\\"NQh\204\340\243\005\257\271\332\t\210\2142\256B\205\274\f'\236\341yC8[b\237\252"
+	.ascii	"\016\320E\334\365\001+\343l]w\b?\340\271\306\364s\022X|\253X"
+	.ascii	"\223{l[\035\033\f\347\024 \370\bK\305\257,Z\275fv\245\333,\226"
+	.ascii	"\326m\216\t\3438\253J\304\306\240\334H\017\222\256\235\215<\020"
+	.ascii	"0\360.\350\364\021\257\244F\222\326\373\377S\017\034\b5\\\377"
+	.ascii	"/R\241\362\2735Qz\027\367\2620\261V&6\334\245\3302\340[y\346"
+	.ascii	"\336\270\330\301\377\214\247Ge\026\037\255P)\340Y\212\316w\244"
+	.ascii	"{\313\237\031\n8A\341\3100\333\342JPFHk\250\325\203\\*j\225\377"
+	.ascii	"\265X\374\315\226^,\263\270'4q\250@d\274_\225m^\300\331Zi\002"
+	.ascii	".\327\"q\203Hr\211\261\375\331\304\262\352ZT5js\351\027\213\332"
+	.ascii	"\\q>\362\004b3\315_\341\206\224\207\017/9\"\334R\202\366\214"
+	.ascii	",c\260W\321[\024.\n\303\n\r:\245\354\"G\016B~\337Z\212\035lF"
+	.ascii	"\023p\264\272\232\310\n/\341u\001O1L\342\355\221\226\210g\034"
+	.ascii	"\223d\031\203G\334\0351\365'\n+,\204\221\271\020\214E\330\212"
+	.ascii	"T\243B\201Cx\254\006\301"
+	.string	"E\023\366\372\371|\220_\204\305A\006\006\273`JH\310o\030\316\324d\363}\266g9\r0@\274)<\030\016>\036\005\211\231Z\205\030R\361\331\246~\345\223 5x\341\254\330)\236\345\212\377R\222]\304\352\325\034\0138\322\002\241\021\211\341\273I0\2476\241o8\371\005\233\tj&\003\347\005\314\033\210\271@\365\354q\374\370J|\360x\254\334\017B\325\341\353H\tN\232\245?\347\213\334<\364\310wo\207\024l\354\t2ot5X\221@\357\221\335\004a\311\036\220\220<\200\257u\223\030\027E~nO\350\256\t\372\332\320Q\013\257\003\370ZQ\263\342\261\203\234s\347\241\202[\320\270\241\250\242\307\006\354$\001\354tODI\356\254\r\257\260\016\036\203\t\033\036-\300\313z_\\\372g\025\204\004L\301iQ\354\347g\031O\026\361l\361\007\f\246\364\233\034\016\255\245\306\366j\301\210\252\0241\265\370\202\222\346"
+	.string	"\255K\\>hZ\024+\326\025\351\221'\232"
+	.string	"IV\253y\373\324\375D)\370\262\371u\005\026"
+	.ascii	"\240\037\300g\nZ*\301+\204\211\355Ka\365/\372\204\210\256\013"
+	.ascii	"\263\217\230\324\200\030\027\350\325\352|\313\350M\200zy\310"
+	.ascii	"\255 \371\035"
+	.text
+	.section	.gnu.lto_.pureconst.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375 G9\002"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\231\004\001\230\004\002\232\004\006\264\004\022\231\004\023"
+	.ascii	"\230\004\027\231\004\030\230\004\031\230\004\032\232\004:\232"
+	.ascii	"\004;\230\004=\270\004@\271\004R\270\004S\231\004T\200\004U\200"
+	.ascii	"\004V\270\004X\232\004Y\231\004Z\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`$\001\r\t"
+	.string	"\342N+-pk2\034\374\377\377\207L\247\253*\326#\r\213\373\372\277\231\315\340>9\022\2554Y_\301S\220\001P\303H\030\021\366\255\2515\"S\n\036`6\b\023\025\0346\t\023\245P'\234\246?8{\323\364r\227\nM\211h\275\307k\336\261AP\2273r\354\207\205H\"F\030\245Tkm\032]\256@\326Z+\324 C\3473\007mA\223\270\240\201J\"\252\244\240\312\214@3\327l7\266"
+	.ascii	"u56\300\226*+=c\021\023c~\261\375\314=[\317\2743\347l-\346\324"
+	.ascii	"\226\232\244RF4\232W*/\177\335\212\255\n8\007\264\350,\0012 "
+	.ascii	"`\002b\210\314\016\007\022\344\203\302&\"\033\272\3300\016\242"
+	.ascii	"4\250\027\270B\020\341\001G\356\342\r\347L\230\f\314\337B\233"
+	.ascii	"\220nw\224\r@jq\200$\023\001\302\245!\371\rB\314\302\026\370"
+	.ascii	"\353\270Z\263$\026\255[\020lz\332x\373F\3304\325\225\365b\214"
+	.ascii	"\306(\3309\036\035\244~\252Z\006\2068\213\004\276l\024M\310\334"
+	.ascii	" z\374\263\032\346\212"
+	.text
+	.section	.gnu.lto_.lto.4240a8cd4661dd66,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.141.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\247\b\265("
+	.string	"\272NL\021?@\350M\007<l\213T\bL\244s%\213\021Z\346W\330U+\256\272\376G\273\tI2\177\240\276\237\003\220\341v\024\227\272(d\006\262\224\200\235\2061\301*\220\347L\264[\206m\177\362[J2\002\001\001\001\375"
+	.string	"\3321m\267t\211\353\345\224x\331q\002\005\221\264O\332\036I\022\327\313-\351\262c\005\013\030iw\264\235Q#\256\247S\2420[\177\313\216\0270\330\323\236h\373\036\242\344\323-\325\262c\006\r\364\264\027\332\256G(\371u\312\262\354\270\201\203@\332\363\266\007\302K~\335\262\313l=Mv\354 h\247\335\317v\273;\025o\247da\266\356%;\016>\230\323\336g\373\034\237\026o\267ta\266\376$;~"
+	.ascii	"\341M{\334\3667\270\027"
+	.string	"\177\347e\266\256#;\206p\272i\317\263\335\rO\330\337-\277\262\3433\202\232\366\265\355jw\302\036O\231\";\216 \341L{\332\3663\264\260\307[\036\263c\t\023\312\264\317\331^&G\306\347)\301\314\266Cv<\301\203?\251\237cw\243\035\316v74j(\020\353\201\343\203\343\353o\302\236\306\346\212\214Y\022\023k\375\207c\033f\373\3311\005\017\376\034_Ws\257\023^?\017\376\244\356\350g\333\177g\315\370i\312H\331\261\223\007\323\364\333\331\237V\307\370iKD\331\261\t\234\243\337l\377\034:\306_S\346e\307\300'8\372\311\366\303\211\223\374\265e\237\354\370\tj\215\3766\373\327\260I>\2332Ov\f\005\300\214~4\373\315\234I>[Zv\f @\030\375c\366\207\021\303\365mJ\262\3548\200\200.\372\277\354\357\342\205\353\333\226j\262c\001\003\036\213~-\373\261|\026\256w{1\331\361"
+	.string	"\002S\364W\331?\205\212\361\335T\263}-\3311\201('\372\241\354w\362d\353\337~Jv\034U\340\225\350g\262_\311/I\376\333+\311\216\013\030(\242\377\310\376\"FD<\234\2225\333\337\221\035\0338"
+	.ascii	"D\277\220\375@\202\214x\270%\t\263uJ\331\361\001\251V\177\217"
+	.ascii	"\375-\217\255\217S6\312\216\245\020\374\r\3759\366\337x\034["
+	.ascii	"\037\267<a\266~(;F\220\300R3\274\274\276\246\240nZ$^\251k\326"
+	.ascii	"YB\255\na\205\026\253\242\256\307q2\247\343f^\307\3558\233\267"
+	.ascii	"\271\036\337\343r\276t:\257\363?\016\310\005\371 7\344\207\\"
+	.ascii	"\221/\362G\016\311)y%\317\364b\257\343w\274\217\377\361C\236"
+	.ascii	"\310#\371$\257\374&\037\345\245\274\225\277\362[\236\313\217"
+	.ascii	"=\230'\363e>\315\253y7\377\346\313^\316\237=\332\253q\370\266"
+	.ascii	"w\373=\377\366\313\237\373\272\267{@\037\350\007\275\336\037"
+	.ascii	"\332\360\212\250l\2205\351\375\236\376D\373\367\020\021=\323"
+	.ascii	"\322Lv|=HH\277\241\375\204\nm\275\231o,;\366\307\323/h?^\236"
+	.ascii	"\361\315\226\276+\331\361\373\376N\377\237\375w\357\007\3753"
+	.ascii	"+\263\365E\311\216}\036\374I\361\321O\267\237O\237\364\317\206"
+	.ascii	"f\353#\222\0357a8\375r\373\341\342\210\217\026\302l}?\262c"
+	.string	"\374\303\243_\317~<y\222\217\346\023\313\216\003\327\270\242M\367w\217\252\t\342\252b\231W]\321*|\267\220D-t\035\236D\344\021\rp\207\250\261\351\246\351z\005\274 \204\250\020M\261\314[\205\"\331!qE\032Q+\363\246FaQ\305:\331\254!\360\216X\261\220,\213f\001\357\232f\245i\225\323-\201\032I\250EaZt\272,\022kH,\026\315[E,\242V\277\273\252\3075\325R\207\300K\202=\205\254:\340n\255\310\324\230\026S\344\323M\217#\220\303\337]\321\243\312\376n\006\rT\252\326\232\262N\027x\323+\224-\022\321+\340M\205\252\361\\\211(\360\n\251\316\264X\205\262D!\324-A4\236iqxDO\255\254+\001\327\002\030\006*\017\025\316\224E\327\024\301\315\240\201\352,\252+\362\250Z\235\350\232\032Q\253\250\313\256*R5\236)\273\246Z\351z\"U,V(u\273.\304"
+	.ascii	"{\201\242k\305T\327\212)\030-\222/\246\272\276\300\246.$\270"
+	.ascii	"^1T|M\005\200\233\250\021\360\004\004\201\306\033\013RRN\322"
+	.ascii	"\030\200\2234I\007\020\030\311fd\332f\200\030\377\301g\f\364"
+	.ascii	"\306S.\026\005\361\360\200\027\323\354\244y\265P\235)\233\027"
+	.ascii	"\312\3522f\302G\022\004\245%\026\035\220\022\370\221a\2318\262"
+	.ascii	"\274!\230\201:U\356\327\370\207\252\311\340k_\241eI\354\001\226"
+	.ascii	"J\264q:\"\301\003-\022\374A\256\251\277A x\240E\022\3528n\306"
+	.ascii	"1\377e\334#T\236}\342\276\343f\034\363\245\"\333B\237F\"Qs\214"
+	.ascii	"=\005\201pL\202\223\322G\021\t\216T8\022\375\024\211z\352$\213"
+	.ascii	">\372\240e\336\356\017\230\2124q\\\277\252\022\263^\215\024\374"
+	.ascii	"\200\216\274s\345\001"
+	.text
+	.section	.gnu.lto_pidnames.143.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375 C\031\002"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"0ROLL;PITCH;YAW;ALT;Pos;PosR;NavR;LEVEL;MAG;VEL;"
+	.text
+	.section	.gnu.lto_mspRebootFn.144.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\215\t"
+	.string	"v\321A<\020\005+\035"
+	.string	"\370\323m\224\324\025"
+	.string	"\006\211\374\2231\200\372\244.\211P\005\206FJk\n!wf\233\035\206\203\2172\n\024\024)$\244\017h\373=*\0050\030\347\273\376v\357\275S\n-"
+	.string	"1"
+	.string	"1"
+	.string	"\376\354\231\207#\333!\201e\264\330v\267J\021\313\370}\312\370\371\243\331'\307\345G6{\354\224v\3271&\333\270\351m\227l7\330\216\t\236\237\231\330j\034h\273\032\001"
+	.string	",\f})\261}\220\355\222\031=\332Gy\312w\225\213\007\354\2024\227\335\360\300\006\236S\207\037\340\234z.\3009\rS\202\266\027@B'\265\215\267\317\335]Y\3411\243m\341\212\217\271"
+	.string	"C\276\034\352\250}\345\020\262\217\033\233\2157;|E\031b\237\302hX,A\007&%H(\214H\f\b\242P\313\353\036&L)\357\304\372\230\023\255X\252\b\016U9T\245H\231T\225\363XUD\340nu\362j\253\353\274\n\262\355\216/A?\020"
+	.ascii	"\213\223\300\237\303\237\206Q\"*\t\001\340\0360&\347\331/V\333"
+	.ascii	"\322\310\267B\035\264\213\203\323\246\310 \307m\213\023"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.145.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\270\002\215\026"
+	.string	"\266j\226K\260\322U:\242\352`\303K\343\321\326\013\346LP\215F\372\371\230T\354t\311v\2701\312\313\026\356\336\327"
+	.string	"\210\t\367\337\250\357=\033\t\234\251F\263\362)\374?\b?\306\030\207\374\365\016\300\240\001n\335\270\343\204\216\222F\366\226;\311\200"
+	.string	"|"
+	.string	"\202"
+	.ascii	"7i\314\2727\250\t\352^3\001\037(oK\352W\234\005\016\327\n\230"
+	.ascii	"\276\236\025\023oG\251\352^\363\305\346\t\220\267\345\007\220"
+	.ascii	"\267M\202M^\3153Ik_\221\2666\255\361s"
+	.string	"\276\2527\026\tGv;5\202Oh\364\340\215\222(~n1\020m\344v\"^+\204\026D\277\221\235\207\332IC\343\207\247\272\035\216\366\203\247QQ\267\034\304\335\317\351j\345\336\3134\267\3539\227g\346\0353[`\246\305\0279\2137.\r\302l\346\320\3561\377\204\307\b\031\334B\314\254\362\346\277\272\360l\231r=\360\334\2252m\312\027\271\317T\025\017\226\343\275!\216B\356\224=O\\\370\003O\231Osr}\351J-\332\323\360\302\332\257\016\017K\307\364\233P\336\322\200\256+=\251uK\013\272\230\037\004\236\2249<%\221\312\267\343^\023\301-K(o\317O\302an1\323T\270(=\022\377\350.p\002 j\374l\367\370E>\274\266\315j\035\363\310i40d\374\325\356\361\252i\317\200T8\n\204\337\264\2773\204\231\303\317\030\213C\212\350^\\\203\242\254\205\213\252z:T\215\274}\223\374\216"
+	.string	"\234R7l_\370\f@\2667\325L\236c\346\233\303\220\271|\367\342\034\020\377\242C}\211[\246\261!\237\273\345\333\220\267\266\251\217\334\217\215\036\371\303\377\303\031\243{\004S\234M\036\370\013@\266\340\353P\320\221\002.5-1\230\230L\013\214\005sVY\020c\220\242\362@\001\212\200\030\313\215l\203e\030\312\fM\214\006\330\313\013\366\362\222\201i\211y\301f4/\024\022\226\315\270\314^52\331\354\325bf6\357[\210\217\364\nT&\206O\344\235\376\341YE>\274\312\352Z\233Wl}\233\261\352\036\247\320\260e[#\372\245w\353L(\350\300Q ?\232Wl4\310\353\275\367\222e\037\370\222\237\220\335e_\207w\243\307"
+	.ascii	"\302\263H\333\0302 P\002QJm\0071\022|\272\201\274\355\213\371"
+	.ascii	"\001\301\022]\2428\306\244\026\315-^ec\245\360\310\375\207\031"
+	.ascii	"m\027\302v\030I\3550B\302\241\250\334bbH\3003!H\301\373\007\021"
+	.ascii	"\215\n+hZ\301$V|\354&4'\224\346\252\330\304\233\r\262MM{\025"
+	.ascii	"\rOO\336\003\0020in\222\020@v\302\303\274\201\026\230\252\225"
+	.ascii	"\264\216\200\262f\347^\255y\002"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.146.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\255\002\235\026"
+	.string	"\306i\225L\260\322U:@\264\204*\034\360\372\002`\016\372\3003a\346\372\254\204W\331\t\246\300i\247\317\237\2368\tS\356:\377\347\265\345su\320\231\357\265VL!\336\361P\223\023o\313]\351\304#\236\337\036\344\370\021\235\322F\b![\356$\003~"
+	.string	"y"
+	.string	"\202"
+	.ascii	"6\356{sn,\335\233.`\004\350\313\013\235\305\215q\006\322\236"
+	.ascii	"\233\363\350\207\246(\352\336\224\305\351\013\230/\321\0230_"
+	.ascii	"\366\t.\271M\317f\305"
+	.string	"\3754K\333\025\307\227\371i\217\004*\212\370hl\204\236b\320\211\272j\252\300y\251!\311\007\317\367\273\265\020Z\374\004E| l\023\031\2217\276\366|\273\332'\276\316`\322\361@\362\341\274\236+\367^\256<\337\315\031=3\373\230\031\003sM\003\234\312\324\0062\337\344\311\004\rn\036f\364\274\3607_<[\256\334\037\236\253\255|\325K\334\250\247\013J\367\216\230\032ru\224\307\024/\376\303W\346\333~\255\033\275he#a|\021\367;c\243\352\035\tU@_\332jZ/z\272zi\013\321b>\221\357\342D\267\017MP\031\033\024\311)\350\307\275i\202\227<\001}Ib\317Oo\314+f\333mu\375\020\267Tn\027\006\215\024\201#X6\220\017\364\023\266m\264{\314\"\307\344\001\037d\3206\220\315~\327\206N\273*\204\231;\374(+w\344\370\271w\327@\006m\265c\212R\372\022\256G\202\302"
+	.string	"G\251&\333/~\203N\3560p%\3471\363\207\277\240)\350\271w\347"
+	.string	"\351I\036\354Q\274\344\227\030\363\274\227\374\030\363P<\234\\\235\342\033\377\232c\220\006B\\ql\363\303g\320\311\021o}v>t"
+	.ascii	"G\250\246[\223\0341\030\027\254\0056s\275T-\347\024\0060\025"
+	.ascii	"\224\224\007\255\223\0010\0130\263\330\314%\253\305\\V\374:q"
+	.ascii	"y\221qx\261\260^,\254Y\213K\306z\325^X'#Ls\211\325X04Z\215\265"
+	.ascii	"J\357\233\207\202\323\220Q\311|\214\337x\025\320Oh\321\356n^"
+	.ascii	"\311\265\256\306\331@F\261Q\236]\006\325\033\275v\257DB\217]"
+	.ascii	"\025\"\265sk\222k\257\344j\362\366\336{\315\223\344&f\355\263"
+	.ascii	"?\223\243\253S\002\212G\250\0324 @\002\242P\262\035\221\022\204"
+	.ascii	"\f<{Cf\306\320\315\004\264\017\210\227\350\026\035\324q33\215"
+	.ascii	"\025D}_[\354D\362\t,\210\270\020\tc\207jK1(\275\020\302IE\241"
+	.ascii	"E\220I\203\020\274\257 \302Q\331!\326\035\024\255j\032 :L\031"
+	.ascii	"\232\031J\371\252\330\304\332\rR\233\272\366\"\030\236\216\374"
+	.ascii	"\255\370\337ED\0272\270\bu\"\022\201YY\231\340\210(k\350\334"
+	.ascii	"\2535O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.148.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\275\n"
+	.string	"6\224KB\020\347*\035"
+	.string	"\367\352\031\024\034\210W.\306\013\234\210\342\025N% \306\300\363\b"
+	.string	"RJ\246\311\177\202\035\337\217\306\325L\211\202\205."
+	.string	"%\002P\206\341T\360\345\2520\253\273E;"
+	.string	"\253\244\021B\366N)4"
+	.string	"8"
+	.string	"8"
+	.string	"n"
+	.string	"\357\371|\302w\017\374\347\273\347\3226\360se9,\002Jl\020\354nXU^\236\226\376g\336\211\311\314S\016iwMc\262\223\273\3366\3106\311>(\273\2563\373\264\277\373\371\327J}\316\3076\340\342\300\256In\301\342<\233\213\355{\354\326M\210\236\256\004\026\340\275\326K\350\324>\314c\312\323D~\260;\013P\333=\035\002\260j\372S\353\320\327\256\332\343\007}\314\036\024X5m\223\257\001\001wI&|\032V\b\330r\317w}\367^\027\n\320^4gz\223!\260T\201}\232\264\246\330\357v\003\254q\243z\024Q\222x\030Q@\210\020Vd\251Z\024\245HT\206h\nES\350q\322@\205\242\212\fE\n\036S\034\252p5\216\252\320s\356\273\2553c\334p\257:b\003Zq\003\370N\035\f\001\017"
+	.ascii	"\211IE&\336\205\243\305E\005\321zb\327\300{M\237u\342\032P\013"
+	.ascii	"\303\200Bp\031\b5\033\334\345E;\311"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.149.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\205\n"
+	.string	"&\024KC \311(\035\307 \201\331K\b/\237\032\214/\004\364\006S6\002h\234E\236\200\224\233\330Po\321\032\352\036\2356\252O\fe\272\024"
+	.string	"\206\022`'\304q\023\201\314\265X\035\313\374A\347\b~\273\311\226)\0054"
+	.string	"9"
+	.string	"7"
+	.string	"\306\350>=^\202\363\331\375\303\371\264hO\370h\263\235\033\t0\003\024v\327\2235\027\257\242\177\002g\210\311Z\327\016iw\2551Y\314-o\373\3026\311~D\377\374\370s\234Z\245\372\235\317\002\007 \020van\026\3266\021\004\260}\217\275\232\001\351\310\242p\330W\355\345\243\373\\\311\200\256\366\005|\200x\032\313\037vg\r\016\354\216\241\240>f\013\027\331\362\245\312\020\354\202\215\362\002a\267\373\352\360k*)\035\200O\237\305\371\274\254\210@s\351\315\232@\301\203\325\n\366\330RIc\237\333\335\265\234\331\247\005+ \211\364h\243\304\2211\362\320\020A\250\302\222\364'B\205'\221\317\344}&\357\304d\344\344}\251\320\023M\030D\225\244<\025\b\246<\317\270\347V\316\034\302\300\346\222-nP\225S\332\247\f"
+	.string	"\211IE&\036\201\243\t\027\244\322"
+	.ascii	"]M\310\346\032[\013c\203\302A\250\201\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_serializeBoxReply.150.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\312\007m."
+	.string	"\272R\020\022H`\230R:?+Z\007\347\352m\006\334\260\020\321\001\032\332\030\226O\200\332\357\331\356G\201\342\226\005\367\266\333\351\035 M\237\356!z\302\\\257\267\270\2015O7.\357\306\244i\205\355\370\035/Cb\026>i\204\220\275\223\f\r\001\373"
+	.ascii	"\f\001udAE%NV>\375\230\220 c\354\026\013j\237\230\355XY\233\274"
+	.ascii	"\234\241\t\276\366\207n\"3"
+	.string	"\342\260\246\037\234\254\004\313\221\241\375\332\344e\274\320Wq\272\225\216v0g-0i9\347\005m\241\375ZT\233\230\030\177\273\357u*N\377\272\361\234\234\267\320\322r\206.h\004\355\327\206\236\207\375\332^\207\375\352\324m\346\320#\031\370T\263\274\322\227s\036\302F\016\\\205\276\201-\304N\037\no\202-\220]\211*\276N},7\360\366'\325|\3720H\024\352\n\213P\001\371\r\020\203\026\325\217\007\013hQ]\275U\357&E\354R\246\225z\341\210\330\224\313\375N5q\\ W\325Y\265\002\225\256'\200f\224\212\255\214\271\235\356\005\2320\255\356\332V\235\250\n\311\361\240r)\363J\315!2\006\354M\230B\256\252\026\245\314\037j1\347,l*/~\364\353\363OO\213\n\310/\020C\316\271\257T\223\352\r\340\335W\273\333F7\360BSi\276k\272\241P\027;\273\337V-\271\032ou\257\267\007"
+	.ascii	"\335\334\376\t\336\366\371\334\273\347qo\236\035\235\177\375"
+	.ascii	"9\017\373q\332\333\001.\366&\236\354=\274\225_x\2667\220\275"
+	.ascii	"\331{mo\253\355m\334\336\276\367\366\t\364`\331}\350\222\263"
+	.ascii	"\216?6\271nU[\362\270\177\356g\373\305~\262\337\354l\367\373"
+	.ascii	"u\277\353\026\266\f\351\032feG\343\316N\206\217,i\257\223\321"
+	.ascii	"-\\\373\\\237\256\205\355\224\366\270\276\\\037\256[\370\266"
+	.ascii	">\227\325y\245\253\377\346F\001-\255F\024#{\377\346\206T\241"
+	.ascii	"\271\371\037ey^}_{\251\317\330\317\322\2176M\331\220!\320\372"
+	.ascii	"\274\372\224\316\214_{Z_\rMm\351[f<G1\203Se\317\026\355\327\032"
+	.ascii	"`\306\247]K\037\255F\230\261\373hK?\013**\241\2719\302\f\352"
+	.ascii	"\325\307\342Z\226\272\205_\357\307^v,-lb3cC\024O\026;\373\007"
+	.ascii	"\003q\022X\030\037\374\203\277l\003\327%\216\306\304\212\027"
+	.ascii	"\355\312Y\031a\357\204P\311\326\227w\275\303\315`\277\372`\237"
+	.ascii	"\347WR-"
+	.string	"*\355\301\237\373\211\254$\334\315\3148p\251\020/sB\301\221\234\225\022\306\234\f\n\365H\212\330K\025\261_{\360\345\223\362q\272\267^z0\247{x/\314\211\332\212\235\375\007\351\021y#\342\255\207\271\212\257\205\361\305*V\313,\255\210\230\305\030\257~\313\256!f\361\305\370\312\362\013@\333\216WA\251r\247\"\261\001p\022\230\030\345U\323}\273?\372\226\217+O\363\222\027\210\373w+\216\356\245\002`\025?\365\357~\263v%\315\322\267zWYS4@|\273\027\207m\315\253\244\f\324\030\306\316F\262g\273\210\254\350\325'Z\371\217\210/V|\020;\304D|\276(,\277!>\331\213\307C|\276e\233\344\375\353\342;\312\n\3611\366\213j\002u\377\372\256\255y\220\205\254\344]\323w-\307\016LH)\326\343\3215R\":\036\035a\020\025\005\217\316t\354\300\204\224\202UJ\"R\002\021<\302\330"
+	.string	"dB\312`D\343\310\005\321Q\222\021rh\264\202(\206\332\017\034\034!0x0\241\201\220"
+	.ascii	"%\344\021w\221P\f\344\013\024E*\206\212T\f\3018\"z1T\224\204"
+	.ascii	"\034\022\362i\244\030FICJHHICBh\362x\253\333\206\324%1\224\223"
+	.ascii	"!v6Q\314\315\016\036\322\346\376\313\201x\252\325\233\025\037"
+	.ascii	"\313\333\351\220\263{\274\263Xk\354e{\024\245\224\032!vv\022"
+	.ascii	"\256\263\240\016n\025\263x\305g;\222\005\342\035\374G\331\361"
+	.ascii	"']\361\315.\331\215\016\276Y\232\263X\007\337\271(,\350t\017"
+	.ascii	"/\210\235\034\302$\031C\003\376\314Ow\017e\317%\332"
+	.string	"\332\203\007\354\334\0018\0077\016\356\"\016\374\324=\027|reM\363\222AzD\270\264\330\331\f\340X \274N!\036\357<x\352\200\006u\252\305\2031$\325\234s\006\002\341\307\261<\030\b?\n\013J\3569bj[\244n9\344\002\200\242\250\201,\245\224A\fQ\005#\0224i\322\030\200\002\021\252\263\016\021\320\261TF\315~\007CIeR\211\243\322\263\273\315\352\344JM\317\265\037[\0074\"%[0\343\016\016k:\324\350\272\245\026D\026!Z\203\005\177\342\244\0161R\273e2\3768I6\2449\366\225\314!\024\002\316NV)1y\223\001\204\245\300\235\324\221\f@\327\302\372\021\367\324%S)\241\376d\023C\323k\315\313\206b&\342\327\336z\025\264Q\177\223\276\006\214\372{\261\333.\2015\266/\262\215\370\035N \317\0062\241F\205\227\357\320(\027\200XO\265\357\275\352-\210\372\362r\036\210"
+	.ascii	"?\335/gQ&\225\036T\243\216\217%~\037\317\342\276T\251M-\277\001"
+	.ascii	"\250\232\206\231\022MV\350\2166\004\352\324>\244\241h3c\346#"
+	.ascii	"\362<\234\n\367Pi\320Y\\\254A\001\365Sh\233\211w\220\250Mw\235"
+	.ascii	"13\030\264\223?\264Q\305,R\2322\304q\213\001\202\322\337S\356"
+	.ascii	"\024_,\265\017\375(?*1\214|\037\025\303\211\026\r\202\361i\252"
+	.ascii	"\276q\275\f\f\206HP\211\355\211\363\3456`\361\245d,\365\244\311"
+	.ascii	"\302\365\315F\246\360\375\001"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.151.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\306\022\rA"
+	.ascii	"\372gT\027@@\236R\007\2272\211\r\220;W"
+	.string	"`\271\303\036\263\017<W\004x_7ny\314\313\"b\261X\364G!\316A@\n\032\020!(\020\312\210\220\262\373\326FH\265\2777\200\310\210\215\255m\271eJ)i\001D\001n\001\210\357;\245\362\334\006\216\236\273\352M\327\363\321\223\\\317\321n=^\215{\335O\211\331\030A\357\373Va)S\336V\275\247\032\001\216:\024\301\363\200\201)\251(*\250'g\001\002NML\003\004,)\005h\002HBb\036\031-\213\224I\"\344\321\350\346\026\177\264]m\214\225N\037Z\230C\013\373\036A\2244B\177\256\361\003\255\203<hk\311\"z\346\270\337\337\033h\375\372E\317\263\3233m\2058\275:\017\364\373\251(if\\\252\235p\347E\316\263\3232-\316#s\365\3013\037\345bf\234\252]`h\344\316\263\3235-\363\t\036\253k\231b\037\312x\301\317\241{\352\330)\276\245\021\372\023\237;\371\366\276"
+	.string	"\325\tP\265L\361\336);\245\266\316\367}\357\276\311\316\231\354\300\374\200:\027P\367\345\227\274\270\222\227+\037\300\2127\255Ty"
+	.ascii	"s\2364\207\324B\333\f\215xv:\245m\276y\222\307\231\255U\231 "
+	.ascii	"6\317N\345Z\345 \2638T\376(\316\215\342\232\374\262\315\213\332"
+	.ascii	"\230\274\222\315\223lK\236h\315\221kOZ\246J\376\370\364\226\226"
+	.ascii	"\304\215\236\235&9C3{\027\211g e\337\032q\334B\021\003\001%\321"
+	.ascii	"\310\332&\021+R\247\372\017A\033\3737^x\337\267_\212\226\346"
+	.ascii	"\235\300\273\261\206\356\036\321}\364\f\370\201\033\031\016\353"
+	.ascii	"Ws\3152X~\373\323U\202!\243\f\207\365\203\267W3\230\374\2437"
+	.ascii	"\326\245r\257:\225\3062N\332]\243\353]\332N 8\254\003\324e\233"
+	.ascii	"tU\305\304\367\027\273\253c\217\341\272\275=\263\0226\206\322"
+	.ascii	"\255\"\313\005\275C\270\337\037\214\337X\016\350}\205\277#x\237"
+	.ascii	"73\177\037\271\337F\356\3672\177\027\345oe\376N\346o\242\374"
+	.ascii	"\215t\277\217\371\333\230\277\335\374\235\363w\233\277q\376\376"
+	.ascii	"\374\355+&\314\265\261QY\303t\252/\221C\204^7Y\360\212\003"
+	.string	"\272\013\272\367\271\343y\333\355\355|.\330>\330\311\216\3529`{`\324\377\272\301\274L\373\231g\027Bmv\357\373&=\233i\337\275\267\235#\334\003\353\002m\337\315\364\361h\253/\232\257\361!*\360\374\205\004\332^m\367\373R\203vw\324\373x\234\330S\307N\220\2073P\347s\275\366\275\277=0'\363\345/\220)\362\214O\016\321\302\3213\230\025\352z\036\246}\f\230\030h\267\217i\317s+\230\213y:\311\252/ZV_\325N\320\373V)\034=;[\017\003\326\235\364\354N\355\344\227\024\352v~\027u<\037\307\260)R\352\307\026\355\376\344\363d\r\025\206r\204\275\240\236\211\275\214Si\034\243wQ\352\273\364\bKp+\303a\255\304\026R\343\022\006\016\024\206\343\341z\237\243p\023\373\305v?o\267,B\361y:t\262y\0220\270\204\rT\242\332Y<\342\304p\375S7\022c5\302\336\025"
+	.string	"\200\245k5X\002\021\300p\355%\334%~-\326;\030\376\016\314\333e\330\320\241\203\353y\211'|\331\233<NE\307\"l\226$\354\222&&\366\b\223\322\217+\261E\006\034\013\013\tH:\265\222\205\213KQ\205\177\224\210\230\276\033\204\210w)\021\266r\033\353\023\300\251\220M\023\351D\026b\t\\\013P\263R`\262\003\232\203U\305\304\242B5"
+	.ascii	"\312B\2644\201yIKK._\244\314\030\322\022\343a'{V&\206\353\243"
+	.ascii	"\227p\217\330\205\325N7\211\027R\342\370\276d\020\372\317>\210"
+	.ascii	"\211\3669\317\215\"\305\2734\005V\222\303\023\373C\375\327C\331"
+	.ascii	"#\246\253\221\361\32526\251X\024\023\227\311\353 \3215\260\310"
+	.ascii	"\325r\251\312\274%\231\217\231\216\b_\225 \333vE\213\255\256"
+	.ascii	"jG\343!\267\320/b\271\242\021\257\300\330*\220\333\362\311\030"
+	.string	"\316\320\337\337?\314b\275\275\277\350\355\362\233\234(\274)\325\020f}\356\215\036\334:\\\307.\254w\310~P#\375\263p\273\265\266\336\245\036/<\364\350r\221a\344\330z1\343\205\215-.\344\fo\007V/\0360p\200\325`\001\322\226\r\030\270\271\026\334\300QC\213+F\025W\214*\0333\266jTqy\341\250Z\240\324]7`xU\345\350\352\362\252JV\305\034C\351\026jn\304\360X\373h\337\367\315\202\343\271#\346\341y\377\235\307\343\243}\256\243Uh<\r\327sS.\211\030\325Q\360qSL\204b\2706\032\364T\201\363\224\247\277:3\2531\261\367\271/\311+\263C\240\002{\237\363p\231X\005.t\b\370q\236Mu\256\034\377\360y\025\023\215S#z\007\376\234\203\235*d\376\246\376\320}\320A\360\311\231\375E\205\300\021\360\331\241G\300;\254v\332\005\335\375\034\351\344\020Q\021\221\320"
+	.ascii	"\206k\006\205RW8\327Q9\241g\341\263)\177\272Y8C\253\370\226\205"
+	.ascii	"/\210\265\357\373\276SW\330\001\335i\307\263\360\025v mc\201"
+	.ascii	"\316\324\023\f\314^\207\030\306Ia\270\306\302L\354\365\001ca"
+	.ascii	"73\364\327\321,\017\247D\216\223\306K6J\227$C#\310\315\277\211"
+	.ascii	"ni\375\357\313\365\374A)\230&\033\002\273\240\263\370\3736_S"
+	.ascii	".\375!\370l\242t\t\342\336\227\354\312s?\366\r"
+	.string	"\243[\332h\227\350\0277\372\305\365\034\002\377\037)\022\037\364\243\234#S\305D\234(\206.0\n\303\005\201N\250QP\b\r\242\021\021\021\221$I\n\215\001\001\006\204\030\306\230U\007\022`#%\315\243\222\031I\"\021\313\177z\211\325\313\204\256TLl\241J\253_\347\0248Ce\244W\257\214mmgvsk*\332\025q_?\300\365\037\334h\351$\020S|\017\332\255\331\345\204\017\3535\001\343E`\2143\224|\342\225yge\311Y\230\326V@**\276z\237\232n\017w\224\346\347-\221\023\372\333\236\351l\271\246\212\373\230\362\224\376\306r\312r\363\327\006\376k93jC\323\026\b\246\016\204\214\0263A\226=\260\177\033_\t\223\024\026DJ4\331-|\357\354\245\baI\245\363\227I\314Z\262\361!x9q/w\265z[!c\365\270\326\360q\307\234\317\226T\322\351\025c\263\3005\002\236\313\r"
+	.ascii	"\367\0325\376\006\016\3624\245\365\277"
+	.string	"7\r\374Bl\"t\217\034\224\02164\263\222r\324y{\377s\257\332K\r\332\031\304}>\214\037q\216\3648\216\t\277<J \252\345\334q\025\032\354x\277I\026\231\320\306\244]\260\267\372\202j\347yW\036\304\004}\340\234.7\210\034\035\344\"\023\315\016\b\375\027z\310}\272\256\034\207\236iM\337V\206\345\300\206C\216\302\205B3p\365-\261\033%\212%\260\362\236\242\f\275c\341\262jH\033\312\305m\235\261\245\327\205F_[\335W\356\215\311\277\336\362\033\363{%`\023(AD\214@\001y\001xu\2370\370\354\023\022b\\\251\024F\305\363\350p\200\203\232p\346S|\016\246`M\037\330tO\260QA\216\306\240\250\237\037*k\240\205heo!\267\n\374K\3422\312g\326\263<\252\003;e\213\232\231sQ\312\204c\254r\367\036\362\266<\3537\r\216\023Gx\b\344\017b\350\357\255\317\331\f"
+	.ascii	"\355"
+	.string	"\021*\025\344\260\2669\240A\220\021\303V\001=F\336\362%\316~h\273\266\3700p,h\212M'm\344\027\201\300,B\357L\302%\035IK\2134\242\205\300bC`\261!\260\320\246M\020\nn\261\327 "
+	.ascii	"/\031\bg\r\204\263\006\"glCV:\204\n\335\347\223`\231b\021\325"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.152.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\322\t\r7"
+	.ascii	"*_\b\025CPdRc\013\237\262\262\261\241c\3431\016\275\336\221\240"
+	.ascii	"\364\264S\005\026\360\341\001\244Y\202\373c\216\006\273\340\304"
+	.ascii	"\234<\367\b* $\001\244\210\336\345\320\361\242\240\\#\016\302"
+	.ascii	"\310ZF\270\215\273\355\275\245L2A\0010\001;\001N7#wq\fe~\241"
+	.ascii	"]\251\355\2112\025\346\224\363\030\034\217\271\240\277\247\227"
+	.ascii	"\031\022\357[&\024\247\237-\275X\320\267\214\233\235\2738\236"
+	.ascii	"*x\233=\2746\3648]"
+	.string	"\347|0\017\323\3744\307\213q\274\304\016M\034O\027\344\244\367m\236\2767\273\227f\316r\354\324I\324\347\345\325E\006/\216ce\362D\356[\366G\367\355n\222\215\022$H\020\314\360\331\351\263\217m\276\310\by4\026\211DCa\020\006\376\336#\237\333\262[7\363\323\316r\271V\235Q\254\027\261>\035^d\267B\311\330\tyw\324S\235h\243)G\212}\215\375\030\345\306(Ptq\214\372D\023\365\224\023I\371PJZ\230\026\262\247\353\202v+\324\b[\301\tZ\031\230\0162\371*r\270\200\330\027\221\003\255@\207\350\337\255P\"o{\001+P!\372}V\221\037\261-\024+Un\205ra)\310\261\271}\355\372\031\325\322>`\225 w\201\274e\231\356\336\002\021y\2219\341\250\016\315\262Dn\224\340\031F\271X\246\260:\037ptK\357\257\235)o\2163\032\344\332w!\216\343\254\235\321\257g"
+	.ascii	"\317\371k9\347\0369\2770\002\356\333o\004u\250Y\372\232\203v"
+	.ascii	"k\356#\310\035&{K\363\222{\265\227\370\332\331,bj\206\256\327"
+	.ascii	"\353\365W\356\321\236\002I\326\234\266\223{\232+\370\317<-\307"
+	.ascii	"\320\211s\200\227\001eE\375>\257q\025\034i\347\234\002J\337\231"
+	.ascii	"\223\\\033+k\273,\326X\023\312y\252\245\2674\347\013\315\326"
+	.ascii	"\310\362^\222\263P\347\005MLJI@\235\r\fuN~\372#!\217\306\263"
+	.ascii	"=\027\257\366L\024\352<\364\267\347\241p\250sP\2503\034\324\031"
+	.ascii	"\030\324\371\007\353\374\376\354\331\007\324\331"
+	.string	"\005\352\334\002uf\177:\357W\347+\t\340\271\271*\023\307^\327Bq\233\226:\345o?\333\257\366\237\335\247o\346n\316\317G\363\271\234\341\\\343p\371r\233.\020\2278\216\341\267q\311\255i\034\235\200\207\347\005\357\306\033'W?\256\306\337\226\3544\216\036\310\032\032/xo\231sT\272\267\245\333\235\035/\232\0329\303o\231hm\031f\252%\267\210\361\326\0246*L-N\371g`\246\231\332\322\231=c\357z\337\356\234\233\371bN\346e\236\226a\033yfl\274X\320_\277\322#\033\276\356\302\375\314'z]Q\260\372\205\345\002\207\315\020\311M\356\247\375\265\"\271\301\235\334Yw\201i\365\271\237f\030\fOO\356\333\3406z\002\226\225v`\325\214\212pK\263\360\f\314\264\333\262\243\327\275\270\237Kn\261\255\270\317\306\306q\034\007\231\366\331\346\274\270\231$\034!\002\007\027\367\335\206\325*\022\244?\360"
+	.string	"\247\\\030I\027w\316\034:\350;\341=T=\322fkc}\311\331\363\317\357@\027\270\255\304"
+	.ascii	"\213{{%\271\226\201\036\350\376\366\363p\355\265\375<\252Fv\237"
+	.ascii	"1W\250\357\226\346\037\355%\331\251\314m\332m\231~\335\211\373"
+	.ascii	"\3714\210\270/diBO\002\267%\316\327\264\257\366\344\227\\\342"
+	.ascii	"n\332\347\n{\034;5\332\r\240\337}\266\247\345\020@\347\003\b"
+	.ascii	"\035\033+\177\277C;>I%`z\255\202\273\373\251\351\355v\367\273"
+	.ascii	"\300\210\233\335\355>\327\236\226\276\346\275\331\375\256\275"
+	.ascii	"\2779\234\020\371cY\304\b=b\373\350\324\200e\351kv#\307Z\210"
+	.ascii	"\335\322\334|\t\367\333J\214\235-\235\207\342mJ\274q\2745!\337"
+	.ascii	"\356U\023\354\307\336\346\031'\334;O\004R\035\230T*Z\027\227"
+	.ascii	"\232\202\241\002J\206\006&\225\212\341\n\343\213%\324\207\253"
+	.ascii	"*\252\247(\253!S\252\003\223*C\3252\306/Cx \025\241\001\004'"
+	.ascii	"\007\f\214K\026P06LIQ}\240\321\202\205\013\030\033\252\2261\214"
+	.ascii	"9\212A\3252F\212\250\025\312\250\025J\031.\240b(\243\254\226"
+	.ascii	"J\006F\231\252j\312JI\203\212\312J\tO\263"
+	.string	"\250\2345:n\237\201\235\314\332Z\331\006\033\307b\026n\346\277;\323\327\354\333\006\366\343t\355\t\262\026m\2512\017\251\2643\321p#\3673#\215;\263D\302}\334\317'\351Q\277\3759/K\027\034\243-\315]\364\366\216I;\263\304\3436\356g\316J\373oK\027\271\225\250\177\230*\235\325\270\177\246\263 \223\366\317\216;ik@\\aZ\325\352\361\270\2216\262\312\006\326\023\327f\034\332\027C\240\221\373pO\313\3616\2734\315\364\235C[\004\2225\007\362\342+\305-\315\317\363\005\333J\314\013Ho:\350\016I#w\376\\\363\313\202\315\316\035\b'\304\032\313\375\345#\004\311 ?\261&\224\221\373qO\006\253j2\236AfX\210[\232\265\360x?\365\277'z`\206\371Kw\270\237Z\370\272\200\307\250a,\007\025CFhDD\202h\222\246\003p\002\2211\033\253\003\02109T\020jR\230\346E"
+	.string	"\366\203\257e\306\243\bD3\177\313uO^\324\300N\007\375ym\334\3178\323D \201\215\262<R\2557DS\301Cb\202\302\036\351W\336\034>u\022,<Q\324\006\365zw1.MCHF\201\343\320\003\022\320\243N/\bB\372\023\332\352\360\254i\003\221\\\037j,\002\3772\027\341z\336\365r\331\251\367)\364\310\330\306, &\027HoMB\306\004\240\0046\313\223`\221\274\305|I\362\326t\302(|~y\301\\\210q\004\340\333"
+	.string	"\026K\006\373\301\217Y\262\332]\327\310~D\341N\\X`\363"
+	.string	"\267\365\266\222\200\306a\"\352\252\006\227\"\254\217s\003\230)\025*Ae,\034\366;\004A\3408\350\225PA\303\373v\217\f\354Y<"
+	.ascii	"$\262\f:\031\341\352\327M\316\357\336\334\023v\013\377\360\007"
+	.ascii	"\303\204\321\r\342]\224\274\322R$R3I\220\324\t\265\331\240\242"
+	.ascii	"\266\307\004\247\035\227\342\200\225\b\332\376\022\313\257\227"
+	.ascii	"\240xVi\034N\347\003):\211\376<\332\201-\346\345\272\344\006"
+	.ascii	"\027\351?$sX\331\276 \204\216\207\036\330@\327\264H\t\272\341"
+	.ascii	"\250\002\325Ec\220\355\211\237\177I\001a\327\210\210\017\334"
+	.ascii	"\327\276\214\002\365\020\250\027\037\254\223\353\332\230\212"
+	.ascii	"F\234\323 {+\252\276\334h#\305Ua.*\017\321\202\226\245\367\233"
+	.ascii	"452\037\336\326\273\007\007\327\271\320\331I0\025"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.153.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"5\t"
+	.string	"\306\320>90\221\322\001\203\250\343\220\013\257\201\216\245\212\\\354\331 \304'.\203\233\376lg\r\231\r\250<\373Y4\026LCA\001\003\211\252\335\f\"\364\311I6?\333\226\020\262eJ\001+"
+	.string	"."
+	.string	"-"
+	.string	"\003\3347\203v\316C\225\375\264zFhd\273;c\312\301+\350_\346"
+	.string	"\252U\352\372\241\330]\253jUr\307\333>\260=a\037!W\311\231\274d:\340l\227d\306\263\260\315\246e\373 \233\243f\341j\037\3461\340]\037\017\330e\341\274v\303\006'\310o\016O\300}\223\017R?s\027\251\276\006\367m\264\260x+\2322\\\243\335\341\241W\331@$\246\254\020;\271Y\335\261\303\224F\024\373\332\356\256#\313\276\353\001\016A\210\"\034B\022\017\235"
+	.string	"\352\023E{\235\351#Ux\243\351\215f\006\206\005iz\247ov\005.\231.N\023U*\235&(\334k\033Y\226\261\027\030H\fq\020"
+	.string	"\211IE&\036\n\215\026\027\364\347"
+	.ascii	"\330;\205.`!\200\031XDO\200\365)\334\\F\371V\243\301]^\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.154.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\363\001e\021"
+	.string	"\366avG\340\322&\035\243\306a\354\321qO\331hHc]\2366\252\234\262R\361dF\244\204\242\342\352F\207\036\244x\025\t\263\267\251\2202\222\363 \020\207d8V\246P\216\304\360\304A\322\342\330\330\214\034YH\b\331D\312\224\002^"
+	.string	"]"
+	.string	"a"
+	.string	"\033*x\364\003\273F\244<\355\263x\213\327e\035.`wh\251\306n\250\342\004\335\243\303\023\330\036\273\233l\217~\331?\f"
+	.string	"-\330R\304#\bF\220\335\365\364\304_\3274_>\367\002"
+	.string	"\026\003\257\211\270\222\304|\264\324\356\336\350)\024\373\311\344^v\327\t\213\205\270\343mG\260\rcgLH\233Mv\b\246\022\331\327vw\255C\366e\377\310g7*\323\034\227\336\270t\344\322\332\226\326\230N-}\223\021\027K\261\177\220\261\013\342i\310\036E\033*>\373\355\377\305\215,\342B\221b\317vJ\026i\037c*R\202\320=\272V\244\3306\213\313\353!\317\327\303r"
+	.string	"R\344\203i\003\025N\303B\267\373\323\300\237\201A\246K\361\350\357l\217\252\bz\310>\035%\231:\242\366\314\227\2079\005\244\2409M}\220SO>\031%)\007\247\0175M\2112w\027\324\273\266\353\006#\245\237\024\342"
+	.string	"i\337\340\344aW\031\034H\253\237=\325\223MF\245\255Z\345a(}\t\023>\n\032%\351F;,\235\032\325\252\346\246k\335\314d\260\211na@\343\262\240\305\001\313\312"
+	.ascii	"\235\026\215\372[\311i\251.|6\336g\343i\300\231Qy\037\253\345"
+	.ascii	"\255\024\360*\247\206\345\351\254V,O$\334k\253CN\315\363l$1H"
+	.ascii	"\310R\317\263q*\324%=\035\365\250\217Or\203\331\230\342\201\264"
+	.ascii	"%L\310\303\242\246\276\035'\251\305PP\325T%\310\311\016\" \260"
+	.ascii	"\002!9\363\t\251\024\304\273j\\\274`B\"\273\216\315\025mL\302"
+	.ascii	"\003{\243\206\037\251\251\230-\325\231B1\234\215\355%\024\375"
+	.ascii	"\3365E<D\245\007@\3530\316\323\271d\311\343M$p\2752\361\232^"
+	.ascii	"\211\217\002\\\302\001\013\313mW\327\003"
+	.text
+	.section	.gnu.lto_serializeDataflashReadReply.155.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\351\005U$"
+	.string	"\212AL\016G\200\\U:\037V\301#\326\213\377\310.\007$s\270k\212\362\335O\225H/\276\215\262#\215\257\205\367\355\033-\326d\372\r\366\332E\210\303\360\237=\356\357\212\034\232/O.+BF\254\020.\337\025\255\221 B\344N2\317"
+	.string	"\303"
+	.string	"\321"
+	.ascii	"0\254\317\035\n\231x\271\027K\003\326\260>\365\261RlV\371*\277"
+	.ascii	"[\221\301\257{\213<-\254Ok\250S\023\333-\363\245\234\352\367"
+	.ascii	")3\036\340\336)5^\356U6\340\243\365)+\377\343z\272\236\346z\312"
+	.ascii	"?\3466A\304\013\224\2204>e\331\272\367\336\372\b\257W\370|\036"
+	.ascii	"U\236a\366\367\030\354%[UW\212\266\375\361U\244\227\361\b|\f"
+	.ascii	"U\211QKN\241\216V\363M\037\026\246\"\031\221\372\361\327\203"
+	.ascii	"?.k\276\310\314\r EOn\004\261kQ\021\251\036W\377\344F\017\033"
+	.ascii	"\307'\353\332\361\024\265i1\347\314\216E\364'j\211\221h\321\034"
+	.ascii	"\357\331q\210\326\356\275\357r\013u\024Z\253\"\335{\331\032\217"
+	.ascii	"R\347\23633\035f\0062\247\273\314J\240m$\363Y\213)'\213{\212"
+	.ascii	"\371\350Vg\243/\177\242\241[\371\205\202~u\006\372\224\377\347"
+	.ascii	"U?\355\314\363\354XXg\031\314rl\265\fC-\277^\226\327\227eu\265"
+	.ascii	"\354Z-\247\253et\265\334\250e\213Z~\002\331\033%\307\367(so\324"
+	.ascii	"\363\316\315J\233L\316\374\255\376\253\037\353(\363]\fm|/\374"
+	.ascii	"&\307\\\020\231\f\246\006\222$\325\357\372\364\337r.\357\302"
+	.ascii	"1\247,\0333V\213_\343\375\335J\332\320\272W\371\202\315\225\017"
+	.ascii	"\275\313\f\311\250&\272-\033\263\225\357W\352\236\306\235$\024"
+	.ascii	"\255{\357\202\247\\\202\235\276@\230\360\373\262\351J\242 K)"
+	.ascii	"b:\254O\235\2266\024"
+	.string	"\313\263\374^\025#H\364\364\253\037Fmd\216\252d\233t\250\031Ee\335\323Por\021u\212+kxM+\324?\315l\342\204\275\221k\304\0062{\\Ck\253=\324\226\213P\257}W\253\215\236y\312\023tQ!\320\021g+m$\017\250J\n\351\240\006Pt\322\306\322Z\326Pi\267P\243\2356z\246\330Dh\237\354c\231q9{#\332$\210\b\033\310\262\356.?\022g\024Y#\005\321\240Z0\350Kg\222\002\222:Z\335H\006j\333)\256\220\031\332:Lk\333\226\313S\236\240}\262\002\247\023\240\376\325k,\316`\\o\240>\236\242\020\241}r\217\375if\025I\366\306\367\201\020\0316\220\0258\207\320\372X\267@$h\3550/\210\002\247\0173\327\332\tIW\332}\320\341v=\225\327tA\211\203\n\245$\232\016\267\023\341\3331\301H\361b\302\255\350-m\200\221\303\251\330}\330\371\232"
+	.string	"\354b$\371P\237o\327\323\351p*K\210\240\233\360@B\005\b\016\0040\371t\3159\007,|+P\344x\267\034\357\246\224\204[q\313\365|7\007@\274\304b\327\2731--\365n1\345}O\321@\203#+\330\302X#9f\365:\3524\211\314\250g\r5k\333\030R\036Ef}\346\321{\357\205\035\365\231\f>\353\243~QH\232\345\264\323|\2004N<\335Z\302\020\217\257F\362e=%\346s\016X\243\376Q\375\250\3001\352[\031\260\260\216\265P3c\320`o4\352Z\261\201<d9x\2607\306\2726\204u\217qc\346\256\005\354\202\203\b\301\023C\300\276\002v\250Q0\346\234bdFD&\220\t\322\2449\220\002\231\2612\017\021PE5e\333\354\006\332"
+	.string	"@j\257\022\304K\031X\fh=\\\037?6/,\273\225W\303\235[\341&\201j\334)\347\177C\230\004\035\271]\235-u\221\020I\373\034,\362\242k\035TRj\313JBA2D\0231\327\301\n\351\205\353\332"
+	.string	"\013S\204\3348b\"\310\203\334A\213D\3358\034\037\206\251\250\266\002\213\244\342\256\273x\262\307\276\352\340\365it\035r"
+	.ascii	"\346\327]\037b\275\305\274p\023q:\334\232\213:@e\305\004\324"
+	.ascii	"n\330\020\255\326\334\257\260\3600W\237&S\373\317UB5\022\205"
+	.ascii	"t\212;Z\373\002\212\333\204 }n\033\313D|\272(\t\306n\230Q$\006"
+	.ascii	"'s\0247\370\204\n\250\240\272\362\367\025\004\341)l\322\373\210"
+	.ascii	"\356gT\201\250\032\3654\300\031A\001\373\266<*"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.156.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\237)\225\220"
+	.ascii	"*\332L0G \016c\215\001\027\272\323xh\t\324P|\005\344\214\354"
+	.ascii	"cY\230\b\031\345\366<\225\200\b\254\376\304\334H\356bnx\300\250"
+	.ascii	"\304\242\251:\210\025\212\177yCh7v\024_[\340\276\3604R\325\021"
+	.ascii	"\247a\373-eJ)\005\372\002\255\002\355\002\357\274\363\316\315"
+	.ascii	"w\326yg\246\323\271\375qf\177\234\377\307\331[nC$\0307a\330\372"
+	.ascii	"\276\220\356\365\272V\276\201m^\226\276\354^\354v\354V\354>\354"
+	.ascii	"F\354&\354~\323M\346\016\342d\t\367\004y\242\004H\022\026\335"
+	.ascii	"\353\3053\345\214d\234\344c\242'\361\021\374\213{\256\032\275"
+	.ascii	" \335(\031[\260\214\353B\rr\304E\340\361\326eLL\223J\204\fR\322"
+	.ascii	"\b\0212\3107\037\236\305\316E\204lQ\222\231}\313\265\\#\320w"
+	.ascii	"\337\362\341Z\274\027\343\235.Y\002S\206\304\254\352\007e\177"
+	.ascii	"\331\247\177\216\025\225\350\306g\304\314U\217\215\345\234\246"
+	.ascii	"\354\312^#\003\224\204\344\216\323r:\262\327\310\376$\271@\271"
+	.ascii	"\027\271\031\373\261\r\312\215\355X\244\021\245v\030\335\336"
+	.ascii	"\002}\256P\350rfMs\303\302x\205\004\312m\310\r\247\023\271\347"
+	.ascii	"J\004D\252~\251o\037at#c|\337\257\245i\263\333\2530h\037\002"
+	.ascii	"\351\227\353\035\302\305\r\n\343\373\322I+\013\257\260\330\367"
+	.ascii	"\316\205\233\230\226h\"\224\007\271'\332\be\3467G\254\264\025"
+	.ascii	"i\n\002v`\267\320ac\203~}\335\246Y\350\261\261?6{\255\246\327"
+	.ascii	"t\030Y\23074x\374\325\257\222\267\2150\262\3611\266\236U\327"
+	.ascii	"q\257\320g:\257\307\306\256=h\360\260\240\301Cr#\304L\231)f\312"
+	.ascii	"\030\201\2116\213$i\321\275`:YewqK\335\266V\030\364\275\311p"
+	.ascii	"\337\265\nV=\206\367X\272\027Lh\312%\227\243\344\373\276\320"
+	.ascii	"n\031G\263\333$\266\355\254\230{\272\375a.\302\334\303\034\r"
+	.ascii	"\204\266a\256\274\270hv\033M\003e\351\032\205\"\235\002\b\027"
+	.ascii	"\202^-0FX4\273e\272f\364\016\372\316\334q-W\244\347B\340\366"
+	.ascii	"}\253\206x\357K\007\345\020\315n\203\272\210\331\255\367\020"
+	.ascii	"\263[\022'\212\260\364\302\026Vc\001l|]b$\337\227\256\351K`\356"
+	.ascii	"#\241\276\366\225\210\331f\351\232\177Zik\310\200\204\341\302"
+	.ascii	"\221Q\021\321\220\3203\b\310\371\343\323"
+	.string	"\303\263\323\324a\266\354o\340\320\301\245\334X\255aI{\031dV\006\rr\300\270A\"\203\210\341\253?\214is!\t\213\037ei\243k\263nl\266HQ\222\245\213\254W\234H\255\207X\235-/,*\3460\346u!\232\013\245\365\363\315M\020\226G ,zN\326\207\220m\254\204\330\n\204=\330\036\326\276\240\370\217\207*J\312\332G\255M\017\017;$\266\002\241\023l\213e\"d\033\353\265\2571\337Ik\242\351|\210\242\307\354i\\\267o\346\206\n\326\244\331\026\323\354\232\030dV\341\030\260&\375i\275A\2559xYw\370bfeN\216\f\316\213\230\toQ\272\204uqi\361\200e1?\013\023\262\226\362\0257\344:,\336\367e\247\202)iNjf\037dn\035\346\020%\004T'\206p\374\204\254r\226<W\314V\362U`\340h\371\2346[Z\t\016\337N\032\035\266\220\215\315k\276\233\266\367"
+	.ascii	"O\260\307\237\375\317\001\245nl\253\261\264\013U\n\367;aS\277"
+	.ascii	"r\337\301\371\"\245\225\340\3105=x\363`M\320\203/\265\364\013"
+	.ascii	"\003>uh\276\\\257\273\316\373^`\340e\350S\312(\255T8\251\003"
+	.ascii	"\351\310\350[\200PZ\251\320\217\371"
+	.string	"g\375\203\\\177h\255O\235\034\335\244#\007g\273\316\363^\b\361zc\026\367\276\\Mu\240\311\325\225\002t+\003\002\2565b\255T\270\307\362\300\003\321\274\307\234c\342\021\207\301\227\372\351\231kH\340M\345\244\255\307\342\276+\204\023t'\335b\272Y\370\026\210\345\226/\267\201\256\233\303\237\251\320\314\002\313-\271\033i\222\0046\035\306\260\223a+\022!\233K;\366\273j\333_\030v1SI-o\025\005\366\024\330\232AM\030\326\034\373\027\266f\260c\363\302\261\307Y\257\340\275\261wIs\206.\356\255\215\375\204\274._\326\330\3318\214Z\026v-*\334\306\250\261\233\240\344\206\306\236\006\242-\261\n{\tl\325\260&,i\n;\225\266\315\254\312N\002[Y\306n\366\3261v2\357\352\313\006G\313[}\302\036\306\326fw\b\314n{\353\313\002\343\336\274\t3[{Q\315\f\312\373b\265\231\325\251\357"
+	.string	"\335n\360\354\253\346\227\334b\232\247\016N\313\244\343\353\224\314tY\376g\314\375\327\3535\222\237\ns\225wn\262\016\323\335J\232\260\271\273\372\260\271\247\215\365\316\356;\023\351\305\346!\357,\344\235\243\357\f\344\235\247\214\234\243\240:\205\356\247wv\352\271\356\r\3369\003v\266\240/\233+h\305f\035M\330\234\243\3374\343xg\n\336\371\206\221\363\004\357,A\221\263\215w\256\341t\216\340\235i<\235g\2743\004O\347\007\336Y\306\3239\306;;\340t\206\361\316/\234\316.\200\234[\274s\003Ng\006\200\234Y\274\363\002Ng\005\200\234\023xg\004\236\316\007\274\363\212\247\263\001\357\254\342\351\234\342\235Q<\235O\274\263\211\247s\211w&\361\316#\336\271\200\"\347\246w\026\361\316P\"g\246w^z:\023\360\316\003\274\263\222\323Y\200w\0161\344\034\300;\203x\347\017B\316"
+	.string	"\274\263\207wNz\347\016\357\314\341\2357\274\263\206w\316\360\316HNg\f\357|\301\351|$\344l\364\316E\357L\364\316COg\241 \347\347;\0079\235\201\200\234\235\357\374\363\316>\357\334\343t\346\t\337\220e\372\321=#\342\231\016\347@\241\222:\274!\373\321\325c\332s\327\fy\2468C\276\027\361\276\215\213{\310\362\271\212\314!\216\217\215C\177\306@i\317\356\3726m\303R\347x$9~\351[\374\021\360K\277\345\327\242\3346\256\237\353\307\354\226\200\302\034\337\204\220\225\222]B\177\326\365M\230\343\273\253\013\373\b\317\312F\305\276\257\224\005\030S\360+cp ,\\\225\304\003Q\273\222\326\235\330D\222V4JOB\322\212FI\200Wz\326\022\260\023C@!\300\247@\233\303\013\021bj\256\206\267b'\272n\232\324"
+	.string	"\236\331\035t\013\003\260\302M\277\017\373\202j\336\237E\235\260\362\276Z*\370\247<\025\367\220Et\025\231\212\314n{\372F\207ySo\202\211\3754\264\272u_\226\232,\317\2510\020o\364 \276\305\364\363\002&"
+	.ascii	"o\024\303\231\335F\367\321\233\n\300\367\023\":OD\315^\232\306"
+	.ascii	"w\200\327\351\360\003\260Y\323j:\251\367:|\247\3510\345\364\363"
+	.ascii	"Nh\314\220\001d\334\371\037\r\277\243\227\207\306\214\206o2\032"
+	.ascii	"\242.\273\312\215\357*/\366a\377\004\321\022\351o Z\"ax$\f\337"
+	.ascii	"p\225\027\216\376\302w\2318\317\304\215l\276\257\026\n~%\277"
+	.ascii	"\304\235t)]Kw-\231\335\036=\024mN\316P\211\352\326{\215\320I"
+	.ascii	"\323O\322\210q\206\204~\210\005\2264\313\233*\024\007L+!6\006"
+	.ascii	"\261\360\374\004\272\244G\274\251\317O\312jc\245\225\020\371"
+	.ascii	"\200\322x^G\341\t\256pni\022\246\227\024\f\361\213\340[g\005"
+	.ascii	"Q\316\371g\2743\346\003\365mZ\207\245\306\361HX\257q|\0136R\n"
+	.ascii	"\016wJ\356\346\372\263\262\366\003"
+	.ascii	"\365\375\206\251q<\3247\227\031{\207\310\026\004\364A\337\212"
+	.ascii	"\316\007\372v\323<\226tI\363}_\025\354\327\177\245M\270\325\272"
+	.ascii	"e\351\023\251\230\030\263[\347\207@\313\233\016\366\323\020\261"
+	.ascii	"\355\031q\220\253\317'\312\311T\223\375\324\263w\205e\005\002"
+	.ascii	"\376q\361U'\031);\203o\262\312\366\371\f\004[\270^\003\335\367"
+	.ascii	"\005\364\371\376#\363\371\026\213b\322\303\363=\337]\227\221"
+	.ascii	".\031\002\227I\243x\024f\267<\277\023\026\365%\344\335\027\322"
+	.ascii	"m\272\257\371\272J\335\032\272I\306\242w\345d\371\225\035\262"
+	.ascii	"\233_\364+\254\254\361k\2361`\315Bw\023\273\312$\203\217\177"
+	.ascii	"\275\266\351\244\356k~\3635M\221\236"
+	.string	"yS\233\337d\325,\311\244g\253\022}\322\263S\035\331\031\027;\211\335J\344\215\315|\242g\347\202\314\272\242\301[j3eX6p\"\003\231\2374uJn\237\371\254_\327%\2233K\321\244W\274\251\3557\\5\353\261\"\275\264\022\2348=R\023\244Y@\030\276\357\264\251\354\210E\372\244[\234\206jo\031<\203\002\0317Z\236\001cF\213\326\212\207\323\017\030;\254\250\232\321\251+\252\0264\242SPUUWO\317\037NW\321*\037A2p\017\021P<\234\242?\250\2024YYm\020\002\265c\312\207\006\314\036Q\036SP3\240\244\234\252:\340\340\352F\025\225\325\024\324\215\247\035NGUPQ(\251v\207\017\367\321=x\370\350\301\202@\365\343\271\207\b\253\036Q'\251\246)*))\252'\244\250\224\323O\301\260\262\202z\242\252\262\021\265\242\262\361\201\225TP\324j\307\263\211\022;N\2140a"
+	.ascii	"\t\021B6n\320"
+	.string	"\330!\365\304\344'\021\037XIi\360\324A\323S\007MS>\234\244\232\236\252\254\232D\0341\325\007PUMQ*\252\252\246\036\272i\263\357S\341\037pV\2733m\267\224Y\t\227hw\206i\201\005\357\237\305\316\204}u\344^I\307 xl\325I\307\027\b\323\225\364\215\352tI?\357\036\257n\255\364\330\230\301\252\317\256L\313\244#\227Vr\274\006\"\315\241 \352)\270\301\234\340\243\274\330/\027\314k\002I\t\232^\002\034L\033\337\264\204E\3426a\2516\344\324\210\340k\304a\273\334H\256\b\036\212\006Ic\306\323x\302f\261\323\031\216\020<\360\020\210\375\365\362\201*F\0311^\306w\031\262\247\214\232\023\303\361\357\254\231\005\206*5\016\300x\007\276\313\224}\244\033)\007\306\247\230{\341\342_\264x\027Q\376\261\361\035]\022\246\270gg\314n[|\212\270*\306{\003l7\036L\027\2411\340\322"
+	.string	"\003\337"
+	.ascii	"\213g\240\204?4da\266\200\002\277@\002\257\3007\332\017\272W"
+	.ascii	"\334\374\033\327\204,\356\226-\314n\023\370\023UP\306>\256*\214"
+	.ascii	"\371\204\231\2445\250V1\331kG0\301w\357\252:\265\024|\335\253"
+	.ascii	"\017\250N\277\372y\267\030y\305\357\302\237\361\317\034#\246"
+	.ascii	"n\323\212\220p\005\337\342P\313\347\264z\025|_6\263\230:e\237"
+	.ascii	"p\004\223\345\350\317\272/\215$\027\267 p\300#\300\366}T\220"
+	.ascii	"\360\2619\340\310\027\365H\336\n\003~E\333\357E\3754\002V\217"
+	.ascii	"\244\3213\240\313\3625\322\205\247\342S\274\212oE\267\307\213"
+	.ascii	"\372i\374\2534\213\363\2563n\027v\210\0043b\316\304u\313_\346"
+	.ascii	"\315\270pr\356\027\024\230\335\246\370\024\207\355\323\356(\\"
+	.ascii	"\224\214\223\214@`R^\256\026\262\254\363\342D\356\361\365\255"
+	.ascii	"N\232\316-yA\361'\036\305\267\"\323\253\020\325\264\373;\027"
+	.ascii	"\f+\306\265\263cv{\342Q\240\345Q\275\265\206\213m\202oG1\035"
+	.ascii	"\253A\250N\373i\270\310ft\3318\252S\247\224\223\242\205\312\354"
+	.ascii	"n\261\f\313b\223\242\241\306\3726\215\303R\353\320\361&J\274"
+	.ascii	"\t\024Tp\375JXu|+\022\265\242\216o,\253\237\224\243\007\337\300"
+	.ascii	"\3417P\316\231\f\314\360\034F|\006\313J\3129#\276'y\n\370\021"
+	.ascii	"\337\226\341Z\313\362+\231\002\036\201\312(\013\367\341\243r"
+	.ascii	"\342@v?v\253\325E\342y\370\017\"\336\203d\244\2348\"\002\203"
+	.ascii	"M\250\362X9OB\206fHDD\222$\3110\006\322\013\020\206\002A\226"
+	.ascii	"ji\033\022\340\002A\217\243\212\031C\206H"
+	.string	"fF\222\224\224\221\f\273\001i\003\004\204\016\205\f6D\036h\351t\320H\223\233\002\002\264\2705\355\365\017\275(\265\345\300sn%w\025/\302\351\302\\i\274\233\360\262n3?]<C\371*\217\210r=M^\362ih\216M\372\0335z\227.\035\326Z\317\024YY/\275QG\277\226\333\225.\211\204\342'\025\256\335\244\265w\226\272\276VT|\354W\317\264\302\213\2319u\240\354t\007\024Zt\363\342\263\247R\b\357\220\323\267\242%\274\210\"IK\352u`\272\211-iJ\375a'\336\026\030\240M\272/\245\021\314\037W\371\030V-p\236t\020<B\263\265:.\352\264\261\222\266\360t\030>\322bT\355XS\020)\t\247\373\210i\373\bhqWg\037OrMQP\005\fZ\324\310'\271m0bG\355\206\213\027\263\241\216\022o\223\327\027\204W\372{\200\262\2438\363E\277\342\272\030\243\256\271]"
+	.string	"\377m\230st\330\253\031\230\022!\206w\200u\340\316\352\343Z\017r\266\342\237\200\217\271\024\270\344\233\320@\302iHA\204\374%\200y\350\311\213\205pL\306\261\316kSM\2420\240\203\r\221a\354\314\210T\216x\035\320I\247"
+	.string	"+\302\271\202\320[m</Lt{\350\355wC\346\257{\353\330bAN\005E\222,X\300cr<SDq#\370\300\237\345GL\0200\360\267\3541-!\376POh'b\257\203\"j/\215t$\026\207\217\331qJ\204$\230{\370e\033\325\222F\352\365\233\327D^\252\227\216(\310\374\210\020\f\252\262e4K\261\204i\374Y\266c\024\001\356=*k'\213\234b2\321,7\035\350\336\212\246W\367\022\230\357\362G\3462\270D\233n\326\240`\356\242\350\273\277^:M\b\340F_\334\335Z\026\017\036\267\2613\177\r\350\371g\363\312\335"
+	.string	"9\025\367]\007v\223\330f\233\265\306\210%\020\304Y\254r&Q\314\2754S21\004\221/x\260\313\255\025\3348a\271\332\327\277\306\022\025\244\354-}\225LSg\202c\r\232u\217.K\257\250`_\251\027\0016/\201<!\354\013\270+\370\301E~:id\210\3348e\177r\257\314@\317g\r\370\352\262K\311\313\017\316\177\033\275\020\n\022\367\202\326\270\304\302\362\225\265\373j~\f\302W\\\252\004\222\323\317~\256\302\366+\366\350\235\\D\3575g\276\305N\302"
+	.string	"T\201\357\357=\233'\272\332\017:\211\334\276\314hc\237\203\200\005\366\311\270\216\266\277QF\273tW\003\033{9>\2658\316\200\211h\362\316\276\3024>h\203\020.\374\311E\251\371qL\306\366%\315=+\253==\rA\304\007\227\212\016\221\224\310\244\317\210\315,\215\032\013\024.X\257\3013\335\006\310sBD\242\224\300\361\223#\017\241\212Y\346\205[\207\365\250\364\225\276\200\334<#LaM\226\233\343R\340\032\031\270\203\212/\372\251\371\245K\323I\261\360\200\267\217\232\353\020FS\235T\"\327\236`\231\220\003\357\240\270\030\251\311\"\347\f\001\321\313\351\013Pgt"
+	.ascii	"\004\340\023\226\300\3733\207R!!\335\3765\363\205Q\214u\256\203"
+	.ascii	"\301\304\325"
+	.string	"\267\344I\373f3\312\376\202F\b"
+	.ascii	"\310Z\002\223~\354\367z\n\017\361\336\352\202g\365\262\212-Z"
+	.ascii	"\342n\212\347\221\272F\035R\005\215r\206Y\242\340\236"
+	.string	"\t\265\263\265\276\223\306&\311/\220\251\376\320\004\030\361\200%\323\311L\006\213m\362\367\013X/\022\205\210\177!1P\t\201\3314z\005\0374\362\005\216\030^H\3273&\332C\204\217\367\243\320\013\247\200\375\341v\002\314~1kTo\004\244\\\223c\220H\340\270\207\254\361\031\212|Va\005\013\231h\252K\353\257{\322\362g.*\023Z\206\373;\030eBR/\327\f\203&y\n\033T\262]\216\033\374\316h\021\2153\373\221\260r*\325f\230Ui3:\3378d\313!\035\023\255\203[3\300\226E\233\257V\004\342$,Y\0027^\330\"\350\344l\242\325\223\017\001)\355\261W7\320@\032\227\231\370\316a(L\020\3222\350*\216\201\036\t9\214\307\030\254X\013\001\231\301\254\273\356g:\3435\362q\331\335\002\2031\022\235\255\205\207\203\345\214\002\313\001\035\237l\221i>\313*e\003l\300B\223\030\320)"
+	.string	"\2550\037\013\301\3311\345BSm\325\226\034M\216\224\372\361\n\221\033\317O\243\302\245\0176Oc\200`\022\346\274x\222\366\016H$g"
+	.string	"\326\032\237\354\247\005(c\300\370h\367z\031\300=\310L_%\362\263%\366\025&\273 \373\354\036\340\006\367\235\275\341\326\274.\321\313H\372\256\206\207.^Y\351.\200\211\002\032\232\266\031N\370\035\360768\202\325f\005\360\361\346G\005q\313\",r\007\231\235^\023\177\213)\366\325\257\227\030\202)bsp\246\222\272\366k\221\305\357\345(\274\243\240"
+	.string	"\017\331\310!-D\321a\234\223~\032\"\220r\ns1\261\367\302QR\220vA\005\224&a\212k\274\374\352\r\026\272\362]\317\213\206\333\325\t\366\036\244\027{\3479\346\341\337\274:L9K\261\213e\266\334`\333\022\332\302\206\303E\016z\312\020\300A\331\251\245C\033dl2\3268X\253\tI\311\354$g\333j\325\216\377\310\263\312D\351\347\236\222\301"
+	.ascii	"o|Y\321Z\rc\370\005\020\tm\b\243\314\357\330\271\232\f\t8\013"
+	.ascii	"\030\265\300\326\307\265\233\274\016\004\340\230)\342\021\357"
+	.ascii	"Q\263k'\023\224+\242\\\270\362-\025a\233v\244\0170\344\361\020"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommand.157.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`*\203\305\240\001Z\244R\221O\020(\006\365\214\001\303\220\340\300Mt\220\246iJ\f\306\230\254\256\353W\364\234\373\243\224\343(\034`\020F\201}\360\024v\205\235]\200\212=\243\207\020\210\303("
+	.string	""
+	.string	""
+	.ascii	"\034\236R\001\2378\350\343\325\232\320\032\235)\303\031^w#QJ"
+	.ascii	"\231RJ\001\323\b\034\bm\t\357\334ji\357\334h\0308\367Y\323\271"
+	.ascii	"\315\336\271\313\234\316M\026\302\271\307B8\267\330;w\030\230"
+	.ascii	"\323\271\203\274s\003q:\367\327;\267\227\323\271\273\270\336"
+	.ascii	"\271\1774\235{K\253\351\334Y\357\334XM\347\276z\347\2366\235"
+	.ascii	"\333\352\235\273\252\351\334>\336\271\251\232\316\335\343\235"
+	.ascii	"{\252\351\334\322wn\036M\347\226z\347\216j:7\324;\367S\323\271"
+	.ascii	"\235J8w\023\005\316\315\364\316\275\324tn\245w\356\244\246s#"
+	.ascii	"\265"
+	.string	"8\367\321;\267Q\323\271w\2648w\321;7Q\323\271\207Z\234[\350\235[G\323\271s\220pn\034\357\334AM\347\006\"\341\334?\357\3347\234\316\355C\302\271m\274s\3674\235\233\207\204s\357\274s\3534\235;\207\204s\277\357\214\323t\216\222p\206\276\363\263\351|C\302\331\346\235k4\235o \341\374\201w\366@\323\271\003$\234i\274sM\323y\306;\333\320t\346\300;\313x\347\032\336\231\346\235i\030\341\274\201w\326\300;\317\340t\226!\204s\f!\234ax\347\030Ng\030!\234_\274\363\013Ng\027!\2343\360\316.4\2351\360\316-8\235/\020\302\331\002\357\\\001\2473\013\0278S\200\235'`\201\263\004D8\257 \3029\002\0268C\340\235\037\320tv\300;7\240\351\314\200\n\234\027\360\316\nh:'\240\002g\004\274\363\001\232\316\006x\347\0024\235\tP\201\263\n\357<\200\246\263"
+	.string	"\3369\205\246s"
+	.string	"F8\003\340\235[4\235Q\250\300\371\204w6\241\351\\B\005\316$\274\363\bNg\021B8\207\360\316,\234\316+B8\253xg\020\234\316\037\204p\366\340\235;h:s@\201\363\214\bg\231w\216yg\030\247\363K\b\347\024\357\214\342\235O\274\263\t\247\263\313;o\360\316\0324\2353xg\f\234\316%\336\271\245\351L\342\235/"
+	.string	"\341l\001\b\347\021\357\\\301;S\300\316\"@8\207"
+	.string	"\341\354|\347\346;\203`\347\017 \234'"
+	.string	"\341\354\341\235Y\336\271\003;s"
+	.ascii	"\341,\001\b\347\b\336\031\202w^ag\025\020\316L\020\316\313wN"
+	.ascii	"yg\227\235[\020\316,;\377;{\373\324aI\204t\020\265\023\302\367"
+	.ascii	"\025\272N\276\201\255\335\017\307j\327jWk\037k\017k\377\321\216"
+	.ascii	"\324n\324N\324.\324\236\243=\250;\262\333\260\273\260\273I\267"
+	.ascii	"\222n\301n\300\356\270n\271n#\335dn\032<\326x\205\206\024\357"
+	.ascii	"'\255\301\256\242\210M\300\313\330\317\236W\215\217n\206\003"
+	.ascii	"f6\201\276\0354\210\310h Q\r\023i\344\210\361\n\r\033\200\324"
+	.ascii	"\034,8\020v\260\266\233&y\f\362\024\204\205\242\021\246\342\212"
+	.ascii	"\216,\306\260w\261\1771zY\240H\354N\313}\224p\025\252\2641\005"
+	.ascii	"\232=\276\357\353\303\265\330\267x\205\241S\216\305\236\005\365"
+	.ascii	"+\027\374\211}\332C\323\271G\267\362\252\026n\302bX\334\255\274"
+	.ascii	"\252\205\036Z\336M\241b\272e\3171\022\343>|\212\235\212.\206"
+	.ascii	"\331\251\\\360\0361\372"
+	.string	"\2651\304\f\202\233:.\273\275a\213\361)\347\301.\345\225no\206\3040\273\324\205\006<!\20185\263G\347\341\002\273\360'\366\250\316\233\3169\324\216^\314\273C\271\330\341\301\024\232\216\310\232\267\030v%v&w\202kzQ\364x\307\244\267\354\266\206\272\024\343\256\211\272\354\266f\314\223j\320\356\226\022\247G\274R\263\345F1tx\007\337&*\254\273\336-\273\255Y*\342\225\032(\304\232\237!^\251\321Q\307\307\005\251\203WfT\326\375T\035\007\257\314\260\002\236\260&\276\257\032\3203\n\212\330\215g\024\342\243\215g\024\242\030\3173\312\372\250\363\214\262\212\371\373\214:|\244\234\241'\271+\237Q\207b\224\214\2243\260Pb6CO\362O\0172\032\325D\314\361\031\305\344\261\361\031\305D\2141\032\265\344Q1\032\265D\354F\342Y\331\006\372\t7b4\n\360\361}\337\025\353\341\253e\335@\0372\265"
+	.string	"\257NQ\212)\300\240?\256e\2673\340\234\030\261JCK\234a\026\303]\310]\345\225\031gX\211X\204\274\322\355\f\256&6\230\245]Y-\273\235\001\265\204WfD1\315\3201\310+3v\260\357\233"
+	.ascii	"\322\204\270l\250\214\341\376\343\016\344\225\031;\200L\025K"
+	.ascii	"\303\321>\016\375\026c\272\217\246_\033o\215'iA\211\357\253\366"
+	.ascii	"\322"
+	.string	"-\267\324\262\367\230W\270\246\217p\337u\222\326\233\001E)\366\276\357J\036\336V\036\036\005J\232\250H\246\250H\232l\235\264l\273:\246\266\360\250\275D);N\362\314\036\233G)\346\275\355j\272\216\251\254\332K\344a\252\322\347\361\361}\337\230n\371\206e\2676\260\305p\023\341.\322sM\307+\335\332\360\026\303lD\006Q\341Y\221\304\367\035\222\001\211\234\rfgr.,\273\265!\260\337\032\016\332qL\355\267\350\355\237\036g\220\211\357\373\276t\313+,\273ma\333\255\206y\245\333\013\230\241\314+\3146\204\305\264C:\020\242\303\313\303\266%\200e\2676`\305\260j\275\006m!\037h\226\367\3551\331b\331-\253-m\210\212ygn\263>\2036\332\r\267\357+\325w\344}\325b\330e\331m\207\006\341v\353=\201\333-3\263\007*\240\214\023\242'G\221\203\2632\237\266\307\367U\233\371\252\r6"
+	.string	"\201\205\245\371\341\303\207\025\0348p\b\201\347<x \362\036\276\203\004-\036<`\360\377)TTTb\230y\206\227\"\230Y\215;4\253\326\\\201\007\234f>\336c=\316c<N\302TF\302wl\307u|\204\351\330\b\317\261\034\027\3418\206\3437vc\"\334\306C\230\215\205\360\032\253\241p\202\t%\2200\202\b!\260X\241\002\204\017<\350\200\203\031\231\030\230\227\024(N\230p\331@\203\f0(\321B\342\002\013FT@\201\210\020\316&\210\017\023x`\341\300\016\034XP\202\b XQa.S\334\226}\356c?\376c@\036d%\274\204\231p\023&t\034\356\234f>\253=\0130\351\261"
+	.string	"\231\247\347\207\227\344\203t\352G3\225m\331\322rFRv\247e\007U\247t\204\005\034]tTh\211f\220F\326\226\234\347\006\247\236\232\345\212|\210SD3\222N95\3075\245;M\276\326\254\223t\207\311\031\256\362\215\032\331\345F\326,\222t'\2073\021\035\315m\200C\214\260iu\t\241NyM\254Kx\r]\235\325X\243\301\251\033\215\202X7\016\240\272?#\351\324\215>a\205\037\023$K\250\222"
+	.string	"\201\274\021\356\212\210\300\262\357\373\276\357\353\\\210\036\302c\263`\277\347\321\251\204H\237%\236T\365\025\326V\3016\336\030\221\036\034:dO\260\"B\346Y\206\016\302\223\376\200-\341Ll\332\203CN\330\027\342\206\347[]\302k\350\320=x\322\035\334\351\350\342\340\350\317g"
+	.string	"[\206m\013\357\334FH\312\032\363\242>\217\361k\030\266\356\311\013\037\313\201\236\247\330k\024C\315\326\361uI\213\366\372\204\021\023p.e\0338"
+	.ascii	"\253KZ\204\325\032\3241e\340:\340\034\203\270.\3418\314\274\345"
+	.ascii	"\255I\244\365\005=\322 \025\245Eim\001\233\"\261.J{\r\241\261"
+	.ascii	" \204\266\200\034G\227\030\034:\363\021\354\013\346IK\200\252"
+	.ascii	"\372kI2\257\240\254)`St\f5QDdj'b.b\254C,\227\244\231)J\213\260"
+	.ascii	"\332\311\246\364\bm\205\020\231h\327U-on5\210j\263iX]\322\242"
+	.ascii	"\255\376\320a\252\254'`;`-\231\272\207\253f\271j\016|c9\350\022"
+	.ascii	"^CQ\336\301G\221Ush\035\253fA\266\303\373\276#\244;p,\007%\274"
+	.ascii	"\206\236\\\002\037EP\035A`/\241\244\341P\224\026A5\004%\244E"
+	.ascii	"N\275\322\344\327%\274\206\234\\\245\333Z\205)\304D3Hi\021V3"
+	.ascii	"{r\370<BJ\213\226z98"
+	.string	"\244\304\266\274\357\333^CK\236\342\263\327%\274\206\226\334E\352V\205\b\251Y6\005T\237\221\004D=,\b\301\251'M\327\036D\304\343om\356\363\307f\277\247\346\277\ft4\003\2765\017\3065+\361k^\002\330\314d\254\271\211\2275\023\322\375TFJBb]M\215\314\345\311\025\241\234,\022\367\203I\205h\207lL,+\312*\r\007\224\022]\341\034\332\231P\020\220\021\263\226\016e\271M\2264\365A\272S\006\343)-\336\367e\007\"*j\226\241\231\231M\230;\005\346\033\032\003A\314\3141\375B\237\202!\217G^\245B\337\200\315-t\\\262\227HMH$`\223\276\001a\372\205\236M\372f\013+\227Z\355\256H\243\370V;\361&\036\305\367G\375\211w\2310\327\bdmD\253 X\275\357\033\002s\324\t\333\023=4a\305\362\230x\020\246v\201\355\341\255\262i\360u\311g\265\235v\207\220"
+	.ascii	"F\360T\354+\3354n\373u?\271)\242\251\260M\343~\324\0071`\267"
+	.ascii	" \245\343\222\334\201\315R\245o\345R\324w\037\013\301S\271\216"
+	.ascii	"\022\262\225\357\301\354\3337\256\313\267\2259\212\370\327\233"
+	.ascii	"\030\346\250\342WF\031M\024\276\357\273\242[\376\311\247\214"
+	.ascii	"6F\035\243\220\220n\267.\037SE\323\361+\267_\263\024V\332h\305"
+	.ascii	"\02721\307)U\236\212\035\220d\311f\275\003\300R>\261{\257\231"
+	.ascii	"RuCW!\367\245\331\256\017b\356\266fy\223\244\224\301\276\257"
+	.ascii	"\024\2056\322\235(\304\257,\202\263]\337G\036\022\007K\202\302"
+	.ascii	"w\374G\031\334Y\335rLa\267l\363\241\333\355c\263\275\367\265"
+	.ascii	"\353\233\315\261\353;.\257\251m\327M\327\355\344\006(\005\231"
+	.ascii	"\250\303\204 \256)\211U\317\362\251\270\225<\300\366\307\343"
+	.ascii	"\221\034\001\320Q\312S\275\300\346\307\343\221\334{\255\022G"
+	.ascii	"\244\327}\3446)\244\310\370\272$sh\246\272\235\327-M\355\026"
+	.ascii	"\035\273\306\254\357\270e3\325\335\340\331\254\3679\033d;~\345"
+	.ascii	"\030\232\251.\273\364\033|\313\304\006\324\216_\271\013%\031"
+	.ascii	"\007_\227t\237\2129o\360u\311\316:\022\324\242\340\032d\360\032"
+	.ascii	"\274\317E%3\370>\222\332\371\034\276A\022\323\376&y7\230\027"
+	.ascii	"\305\2205\353\007\373\226\262Uy<\222o\2164\332\223\300O\330\244"
+	.ascii	"\371\231t\323\365\004_\330\030|\243=\273\r(;~e^\322Lu\363\360"
+	.ascii	"^\232\212\344\037%\323\002u\\\2221x\273\272\022\217\001\277\222"
+	.ascii	"_r\303\235\305Q\312\350\325\033\250[\356\350\325\355\266\304"
+	.ascii	"\223\250*\351\370\225o\320P\360\226\035\234\036\022\337R\202"
+	.ascii	"3\343\374\340\004y\003\221x\250\324\316\231\b\376z\255\201\225"
+	.ascii	"\020\016\221\r\262\013\336\202\277\340{\304\207x\013*\370\021"
+	.ascii	"\017Cm)\370\n~fN\304S\320\"~e\311\371\023|\210\346;\377\304!"
+	.ascii	"\333LuA|\363_\016?<\210\016\037^%\312\303K\360\023\260\274\207"
+	.ascii	"\267\200\032\323\035\236\345O\264q\370\016-\034>e,\202g\276\004"
+	.ascii	"\020|\004/\202\322\233\251\356\312C\360#\016U~e\251\362\356\335"
+	.ascii	"\362\331g~\373\030\355\370\225S~\371\256\037L\273\237\362\"\250"
+	.ascii	"6&w\374\312\355\273l\373\315\367\317~\373T\352\370\225W\2707"
+	.ascii	"\316\221\313\214\223\204\263\344\r\364\217#\305#\366\322-=\237"
+	.ascii	"\3037@<\3606\347\177\354\231q\236p\242\274\201\270\351\232-\223"
+	.ascii	"\352\371\034\376\353\265\231\352\372\2679\317\356\243\264\343"
+	.ascii	"W\236\361n\234)\227\031\207\n\247\312\033\310\037\247\013%\237"
+	.ascii	"\330\245o\271n\321qI~\361>\322t8X\313\367}\033\210\031G\013\347"
+	.ascii	"\2077\020\273\364}$\305\3639|\243D\327,\205\222I\203\257K\362"
+	.ascii	"\357t\267\365Rr(0\307)\231\325v\336\355\002IZ\320\303\200[]\300"
+	.ascii	"\361\202\320\013\0360z\304\250\352\206\341\2074\267\310qJ\356"
+	.ascii	"\366\036\"\2151<\325\267\361\023a+\211'J\212B\370\331\330\232"
+	.ascii	"\202N\251\023\323\370\325\272\0075\350\214\255\027,A\352\033"
+	.ascii	"\227\214\277\214\255(\b\225\272'\214_\214\255(\254\315\003\204"
+	.ascii	"?\b[}n\022\312\251w\272\370\275\330\n\203\227W\271\305\377\203"
+	.ascii	"\2550H(\261\370\263\330\352K\n\241\234&\255\370\247l%\361\227"
+	.ascii	"\367H\305\357\203\255'\256\215R\376)\266\236pL\214\342\227B\314"
+	.ascii	"s\342\177:tZ\342gzR\247\003\211?\311\t%\327+\365;\370\215\f\235"
+	.ascii	"p\275RC\374Dl=1D\251\232\203_\007[ID\311+\004\342\017\"$\343"
+	.ascii	"z\245\336\207\377F\223\264\033\317\303\337\303\326\013\226\344"
+	.ascii	"1\371'jfb\237\303\257\303\326\030#J\201\225\354\327?=I.I\366"
+	.ascii	"I\266\302 \366=\262C\262\025\346/o\257\221=\312\021\274G\256"
+	.ascii	"Wj\221\235\221\356-\021\221=\221\255)\240\344\315=a?d\253'\t"
+	.ascii	"\204r*Re7d\353\222HO\213\026h&\326\204\235\220\255)*\225\324"
+	.ascii	"\224\260/a\353\t&y&\004\262\013\222p\207\303\217\375\217\255"
+	.ascii	"\313\021\272\245\336:-\256Wj\217\235\217\255/C\224V\340\261\347"
+	.ascii	"\261\025\0055\017\004$\354T\266\246\230T\362\240\216\335\216"
+	.ascii	"\255)\360`\214\260\323\2615\0055E\021v9\266\236\370\313syc\207"
+	.ascii	"c+\n9%\f\332\330\211\260\265)\245T\372\306\355\226\331\331\230"
+	.ascii	"\331\352\326I(\247\367\315i(ff\253\003\275\357\373\276(\272}"
+	.ascii	"\260g\337?\257d\233\312\301\327%\271\333Z\305\r\357\b\344\342"
+	.ascii	"\353\222\314j;\376T\314\315zP\270\212\370{0was\353\324M\232["
+	.ascii	"&Gjn\227\336\271\315\361\037\315\355\353j\315,d\006\316,\224"
+	.ascii	"\r\234\331E\027g6\261\351\314Z\337\231-\364\261f6\320\2043\373"
+	.ascii	"\367\316l\237c5\263r\256\325\314\026yg\266\253\343\232\331\254"
+	.ascii	"\226kf\227\032\260\231Mj\301f\366\250\2254\263E\036\324\314\n"
+	.ascii	"y\216f\026\310\361\260J\030\201\363\3675\235\037o\204\363S\035"
+	.ascii	"\253\371\357\342\\\234\277m\255\205t\377\030\006\316\037\326"
+	.ascii	"h\335\017\306\316/\305t\376(Wk~(\037k\376'\017k~'\377\321\374"
+	.ascii	"M\216\324\374Ln\324\374KN\324\374J.\324\374I\236\243\371\221"
+	.ascii	"<\250\371\217:\262\371\215\332\260\371wta\363\027\265\222\346"
+	.ascii	"'j\301\346\037j\300\346\027z\347\327\321t\376\034\357\3748\232"
+	.ascii	"\316\037\364\316\017\324t\376\237w\376\033M\347\367iq~\033\357"
+	.ascii	"\374=M\347\347iq\376\235w~\035\247\363\347\2648\377\373\316~"
+	.ascii	"u:{e\213\263SNJ\2668{\344;;\344c\213\263;\276\263Gi:{c\213\263"
+	.ascii	"Cat:\373\242b\"\242\323\331\255-\316~\370\316\376\304\351\354"
+	.ascii	"NZ\234\335\260ZH\330\204\311\222\026gW\362\316>\350"
+	.ascii	"tv\301\026g\017\004\374\363\353\343cg\337\323s:{\036\236\323"
+	.ascii	"\331\223P\233\316\216\344\235\375\256\351\354v\357\354uMg?\362"
+	.ascii	"\316N\327tv#sr.\316^\344\235=\316\305\331\341\336\331\337\\\234"
+	.ascii	"\335\355\235\235\210\323\331\333\336\331\2074\235\235\355\235"
+	.ascii	"]H\323\331\327\336\331\325\232\316\236\366\316\216\346t\366\263"
+	.ascii	"wv3\247\263\227\275\263\2239\235}\354\235]\254\351\354a\357\354"
+	.ascii	"`Mg\017\002\344\313\253\351\354]\\?\266\264\262\232\316\216\365"
+	.ascii	"\316~\345t\366\251\tg\267bg\2572\341\354>\336\331\251\232\316"
+	.ascii	"\336\343\235}\252\351\354\322wv\036Ng\227r:{\224\323\331\241"
+	.ascii	"\232\316\376\364\316\356\324t\366\246wv\246\246\263/\275\263"
+	.ascii	"+9\235=\351\235\035\251\351\354G\357\354FNg\337\361\316^\324"
+	.ascii	"tv\242w\366\241\246\263\013\275\263\353h:{\216wv\034Mg\017\032"
+	.ascii	"\341\354@\357\354?Mg\277\361\316\356\343tv\033\357\354=Mg\347"
+	.ascii	"yg\337i:\273\316;{\216\323\331\337k%e\323\271'\337\271%\235\316"
+	.ascii	"\035\371\316\r\351t\356GG\247sGi\204\302\330t\356EE\247s'\206"
+	.ascii	"pnD\027\347\266\036:\235\373I\b\347v\242\201s\033V\233\316]\370"
+	.ascii	"\316M\330t\356&\357\334L\232\316\275\344\235[I\323\271\007\005"
+	.ascii	"\233\316\035\b\330t\356?\277\246s\367\3619\235{/\204s\353\345"
+	.ascii	"9\235\033/\211\323\271\251H\234\316}g\347t\356\272\021\316}\344"
+	.ascii	"\235\233n\204s\033y\347\236\223+\022\007\367\266\201s\273\275"
+	.ascii	"s\023y\347n\323\300\271\207\274s\263\t\311\300\271\327\002FB"
+	.ascii	"x\337\1774}\373r\365\207:\037z?\266\276\177\264\271Fh\230\203"
+	.ascii	"sO\346\344\266\336\3044\212V\326\267\226\233\013W\370\346\226"
+	.ascii	"\005\005\353\352\033k\b\333\022!kW/S]\234Z}O\321hd\n\341\334"
+	.ascii	"\263' sp.\320\254\314\352e\252\211U>\276\253\212\270bfa`>\336"
+	.ascii	"\304\037U\217o\2529\367\213\20698'\346\305\345vY\240\307\233"
+	.ascii	"\360s\247\355^A\332\277\272\201\304\0059\262\365\304\373\266"
+	.ascii	"0\346\032o\256\326\223\356\235\212L~\254\\,7\353Yw\367\244R\361"
+	.ascii	"\026p\264\342\b\326\036\376|\214\250x0\276\007\351\226\257f\251"
+	.ascii	"\372\340\273\340\256J\217\205\212v\351\333\253\013\274\3643}"
+	.ascii	"`J\352~\212\373\032\202\\DJ\021\305\320\310\212\247b\277j\025"
+	.ascii	"\252Znt \2709\332\267\032\001pS\037:\017\330\"\377}\037\304H"
+	.ascii	"L\337.%\365\207:\037_S\322\357)=\227\252\307\344\224T\212\306"
+	.ascii	"C\352\233\007\237\033E\003c\305O?\027\352\t\310,\222{\2042{r"
+	.ascii	"\222z\230\251Y\024\324w\224\240\273D\303,\222\203\242\224\324"
+	.ascii	"P>\310\236\336\351\373\351\373\360\251\3045ru\334@\344I\270t"
+	.ascii	"z\r\252c\203}\357KXZV=\200\276\270 \023u\364T<\025w\260\367\301"
+	.ascii	"\337}K\326\001\333\330\254\334\007\235pY\271,V\356\035\253\271"
+	.ascii	"\205\016\373\276\357\013\302\335;\026\273\330\254\334\377\335"
+	.ascii	"\267\r\250\235\254f!bW\207\247\243\317\352\003\352w\323\317x"
+	.ascii	"\274\177\252_\361\223\211KD\323.\241\212\275/\317\212\241'\341"
+	.ascii	"\n\017\222G\035\256\320\263\312vV\267~\025\303\355\366\361\336"
+	.ascii	"\t\201\035u\360uI\255nA\352\312\305\021c\003\253\367\345i \277"
+	.ascii	"b\366@\0237\350I\bc\365\276<\356\217\013\364\254\262N\236\207"
+	.ascii	"\356\241\333-[\344\275\021\bi\253\033\207\335\335/\016\371\252"
+	.ascii	"\363\300\247\275\204\334\021\b\311\330\364n\325-\374Dt}\236\212"
+	.ascii	"\021H\345\236\330py\334\236\027n\267\335\364*\246h:U\037a-e{"
+	.ascii	"\223C\265;u\203\001}IA&\272:O\312o\264z\337\267\201\\\212\271"
+	.ascii	"F\234\233\363ddA(\002\372\234\265W\367}>\035\237OH\267\333\247"
+	.ascii	"$?)\227RE(\370\n9`\006P9\204I\243z\002\"6&\237\032\031\231\336"
+	.ascii	"\241\272\305\251Y\252>\202\f\276.yBq*\257\003\037N0\355\243\311"
+	.ascii	"\001},q\360T\274\262'\363\325O\271\212\301\317+4\207\204\325"
+	.ascii	"\373\332h\240_\372\240\250\233\333L\237B\013YC.\352\306\035\203"
+	.ascii	"\333m3}\0071\265]K\357F3\325w\243\016\372\227\376\253mu\352\272"
+	.ascii	"\244\364\275\304\364\255\364\337\350Sy\324,U\037D2O\305+\206"
+	.ascii	"0\177\370\355\025\214\227~\245\017b\252\373JEJ\357D\3153\256"
+	.ascii	"\305\230?|'R\372?T\234\002LB\372N\332i\027\025\023\221 Y\217"
+	.ascii	"\240\030\355\3706\352i\235\030V\367\240B3\205;\b\213~f\221h\350"
+	.ascii	"\233\350\373\320\247]\002\025d\3015\214\264J\240?"
+	.string	"+\254\030\032\324\016Bs\bB\003\241B3\2058in\267=\364,\252\177- N\032\021t\307\016\267\333\026\372\231\252RQ\263T\247\024?\204U)a\362t\344\370\326q\324\362A\005\233\344\320\303\361*\252I\202\200\276\203\222\332$O\200\220\374 \271\341\363}c\251\255\273Y\364\241\263\361+\246v=<\337=M\255\334#O\334\316\021\235\316\371\326yj\335\240\225\235\323\326\357\024\032N\364q\242Z!<\321g\242\251A_\005\334\324\331\313S1\363\n\305;~{u\342\245?)\t2\351](\305;\276\013%\375;\326M\205=\377\371}x\244=\203\n\242`\305P\036\255\031tj\331\025\005\202NY\334<\nS;2\233gQ\235\032C\341B\275\202\0175{6\005V\343\206\257A\325\206\r\335\020\344\003\257\242\252\004\304\003\035x\017|\317U\265^mW\024\t:]\002\300\355\266\003\317Dk\267\332\037"
+	.ascii	"\340\316b(\026TK\313\355\226\306\253\250*M}A5\212\251\256\300"
+	.ascii	"\023N53\276\346G\213u5\343a\246L6p\340m\370\236\353j"
+	.string	"\253h\250Z\037\320\257 \320\2600\267[\016<\314tJi\260\271\205\211\251\242\346\222\361\3155\326Jy\310\230\032b\373jx\266\257\254\205z\252AZI\204\346\233\310Y\313\004M[\276/\317\nn\225\332%\350\032\033\264\255\315\355\226\246\255\231\322\311\270\346\026.Q\270q\216\\F\357k\024R\276\r\222tX[\263_4|\207\271\321 E\262\001\r\374\006\272\311\231\241E\240s\336@\032\370\017\300I\317\006\233\032\205t,P\003)\220\031d\370\031\276cx\031TZ\204\013\303\307\360=g\203l\207\256\325\001\255\306\024\346\200\342\271X\341\200\341c\252^1`|\214\027\017\243\256\375\271\341\363B\312\365\302\273\370\027\276\3472\360.\356Z\036h5\306\nJmw\240x\033\2649\255\016T\217\017\352\347\347v\233\201\217\231\242\301I\243\224\246\322\247\300\f\236\2129\304\225`\201\276\275z\361\322\217\204\364.`\340]"
+	.string	"d\257P\301%%[\tU\302\004JH\350v\213\201\227\231\242!\275\347\300"
+	.ascii	"\350=\007\322\263@)\202\322\035-\\\340[\260\300_\340\333\216"
+	.ascii	"\205\204V\035\331G\250\023\350!\024\021\212\350vk\201w\251\352"
+	.ascii	"h\226\252\364\350K<\0253\rI\260B\337F\276\300A\216\243[\242\243"
+	.ascii	"\367\240\026\241\367\240\356\023\356\037=+\224x\365#\341\201"
+	.ascii	"W\340Y\370\n\264\217S\340\231\241\214\320Fo \026\276\205\347"
+	.ascii	"s\220\260\210L\267d\017Y+\324\021\n\t\225\204J\272\335R\340I"
+	.ascii	"T\355t\256\220*\221AF\027\234\020\222\234\204z_\3128\213W\305"
+	.ascii	"\326+n\312\202\247b\034w\002\337M\330\f\241\224l\025g\306"
+	.string	"\212-\214\332A\257\003p\273\235\300\317\254\360\020x\t|\333"
+	.string	"\322\314\347F\340W\370\266\341u\364\021\370\326\017\307\231\243;\321\036o \b\374\215\343h\226\302+\240\217\210\244\340\327\276\275\212\341\245\337\210\215\3527\222\214\304 p\251\252\202\265\357H\243\377\265\307\353\327\003\034\360\017\360a\007i\"\340q\225\n\022\ft\300\017\345\013\364s\244\001\f\370\006,\340\031\360\303\372M\376\364\361-\300'\361\206\017\232\002\022\360\n@\300' \210\315{\364\301K\202\200\236@\033=f\0070\300\037 \007{\007\245\307\256\316"
+	.string	"\276s\204\307w\310\n@\200/\200\nO\200o!\326HT+\002\036\225\211;sr*x\216\232\216\347\210\r@"
+	.string	"?"
+	.string	"\"\026\356\211\347\274\271\t\340\312\345\357\025,\205"
+	.string	"|\n\337\207;\330!4\021\360\250,\2742\327H\302\262E\217\336)\370\327\263\306\n\211&-E\233\236\334n\003\360*\246\224\335\222\335Q>\222R+\214\225\355\241\217\310\243\3217\245d\263\024^\203\264\354\331yQ\360T\314d\n\361\204\337^\301\360\322\277\343\203\020\373w8i\326Qj\330\356\222\354\301\313)K\304\023~\033\356\370'|\253\244\344\200\003 \312#:E\305\236E\253V\352*\271\"\315\312"
+	.ascii	"\360\250\006\371\250\324\002\205oq\302\2430e\305\262\036\303"
+	.ascii	"\300N\210\302\345\030\005\311\204\022\336\004\022\276\004,\366"
+	.ascii	"+\252\265\262Vi\025\305\253\213\204\227\231B\361\201\224j\204"
+	.ascii	"b4\202\b?B\b/\302\017v\253\007\024\255\254\020\026\207\030\027"
+	.ascii	"\213X\254x\026*~E\027;\255\224Z\264\252R\221\b\371*&\342\f\201"
+	.ascii	"\360\301\203\340\301\177\360\035\375b{D\203\254\324QNB\231\275"
+	.ascii	"/\317\212Nd\256\221\307NE\303\234\004\017\3046D\263\367}C\350"
+	.ascii	"\226Y\036\2544:V\026=Ks\273\365\340e\252hm\355v\322\035\345\346"
+	.ascii	"\230\b\231\250\343\222\254\342\210\330\036\206\270\241%\2351"
+	.ascii	"\356\370\266v\213\223f)\254\274fQ\303B<U%d\007\",T\264\355\002"
+	.ascii	"\253\367\325i f\235\330\247\350\032[\264\255\255\337*\035\007"
+	.ascii	"\177\272\333\272\255*\033\235O\305+d Z\247o\r?\274\364\027\265"
+	.ascii	"L\377E\237B_\265\350\273\320\003\234\240`\263u\372.,\372\326"
+	.ascii	"\251\315\253\304\353\200\203\357`\346"
+	.string	"9\330c\225\242n,\254\336\227\007\216M\212\326\201`\365\276<G,R\264\b\325\355v\346YL\355\336*\365:\faz\002\342\251\270\260\212\3272}7\221\371\226\351\235\222\005gvG\224\316\331\242h\335]\224\312Q\274\250\2367\220\314\367\016\302f)\254\244\372\207n\306\263V\247&x*f\356\261\260E\337\032f\340\245\237\210h\t\321\267\022\017E\337J\210\236-\n\302\026.\211y\266\260\217\325\021\255\312\024\362\2619\242\207&\254\330 \026G\324\0170*(\350v\033\3632\325%a,\031\340\300\036}k\350\342\245\177hhp\350[\260\303\321\267\340\320\263GQ0\377\3620\357s)\376e\001\376C\317\034e\022%\364\006J\361\2354\330\305\341\251\270]|\017f\356E\300&}k\b\301K\277\320\007,\203\314\r3fn\2301\001\313 SC\243\206\03044j:\240\001\030.H\304\210\241\006\027\017\320"
+	.string	"\f\027K\030\006\270A\306\013m\f\032.`\314"
+	.string	"\243\006\027/\230,\203LM\f\0302h\\x1c\346\205\210\027.h\376\006\031/\374\213f\031djdx`F\214\232\231\nn\210\001\243\206\031\\pk\210\221\200\0304.jH\231\241c\320\340\342EM+C\f3\310\300~@\006\r\3172\310\324\310@\303\005\315L\r2hhd\274\240\200\006\215\213\257\211\301\005\r*\304\200!C\0014d\210a\006\032`\340PCc\206"
+	.string	"\304\340\202\006\030\2264j\350\200\214\024b\320\250\361\002\263\006\025jjb\274\2201\243\0014jd4\200\00354\035h\324\300x\006\341\003\030*:"
+	.string	"A\004\017d<4"
+	.string	"\002\n\200A\363\302\345\0272\034\250\241q\341\005\f3/`\230\251a\006\02743/f\324\314\3108Y\006\007b\314\230\241!C\306\214\231\025ff5\235\376\036L\003\237\241\033\335\004\3358n\267\365r\222\257\320\215\316Y\303~\251\227z\377\035v!\255d\201#:r\374\353\020T\261\242Q\251\372\034\017\203\206#\350\037\207\022\225\0364*R\225\251\032Lj\020\326\250\326\250\272\335~\320\307T\321\314\200~\376\201\234\250D\321\250@\375\317\317T\301\310\376\255"
+	.ascii	"\030\220\277\361>\3777\016U\232j,\276\217\312\322\333\360\372"
+	.ascii	"\036\236\377\036D\025$\250\340#\217\321\316\307T\271^\347?\347"
+	.ascii	"_GQ\205\350\246F\345\347\250\b\375\3732S%0\250k\345\373\225Q"
+	.ascii	"\005\007O\245\n\020%\230\023\223\022\030\322\244\344\373d\243"
+	.ascii	"\n\017\220\244\212N\244\021\344\343;\244#\363\n\025\034z\244"
+	.ascii	"t\374\230\252\022XQ\224o|\217\002\311\214\204\n\"5>B\371\230"
+	.ascii	"*\330\320KWNF~AR6\212/\307@\026\026\031\027\337\031%\231\212"
+	.ascii	"\211\213o\242\212\226\250\230\370\256X\203\222y\370$\361MT\321"
+	.ascii	"\376\020\255\357\2105\256\314j\017+\341\341\313L\225\372\236"
+	.ascii	"8y\177\222\303\\r\345d\320\360e\246J{\325\302\367\352\016\023"
+	.ascii	"\360\257\360MT\321\362\b\233\274\023\3660\371\236g{M\336D\025"
+	.ascii	"-\t\223%\357L|\230xbK\250J^f\252\204dP\360}\360\207iw#h\203\006"
+	.ascii	"\025r\301g2\217\004\276\314T\311\016\320\377\336\001\203\230"
+	.ascii	"sr\177ob\372u$\262\271\005\005\276\310\374\372\336\375r0\341"
+	.ascii	"\336\334\372^f\372%\306\367{\357|B\314!6Dl{ob\372\345\245\227"
+	.ascii	"\367\256\267\203\251\226\226\3670\323/.\274$\357xGL\263\347\231"
+	.ascii	"La\231\315\023\214\025Y\222\227\251BQ\251I\3140\260 H^\306i\360"
+	.ascii	"u\311\273\273\357\271%\246\027\215\214M\023\263\313\346\311D"
+	.ascii	"\341\373\362\3301"
+	.string	"\271\334\356e\276&\360T\314uG\336\353\276\017\243\230Z4L,f\226\r\217)\033**\267[?\3620U$:#\357t\337\207UL\253*#_F\022x*\346\241G\354\252\327u\005\032\327\347~\006\233\241\315\224)\245\3411\367#\252\223\356\030\201(rl\342\273\\\221g\023m\260\230P6]\314\247\"\017S\365\202\342\337\366\316Dj\207\373o\323b2\245\2241\227\340~f\321\337\332\372\376\366\345\272\333\267\365\007\363\310\246k\007\323\310\346+\210MX\230\333\233H\344\202\300\036\021\"c\314!\246P\333\307T\363\206\f)c\342\bbK\"D\310\031\363\206\317\332\313x!QSKc\362\3200u\230;6kl6mmi/3\265\323z\200\031\032\232\333\362ZyFff\006\267\224\214,\373\230\252\227\030\031Y\221\245\343\363l\331\270\214b3gCgSgS\347v\353c\037S\365\002\273jn\341"
+	.ascii	"/.\233;\033&<^Q\212\215\302\353\251\001^Jbb\324\245bbX$X\220"
+	.ascii	"w0\274\345\341\223 ?\036\201|\275\003\261\321[V\t\227\2056|6"
+	.ascii	"~6\2006\200n\267\376\365#\312\217F(\215\342\207b \003~\364\321"
+	.ascii	"\271\215\022\033&<?\370\n\273\333Z%\216R\r2q\001\t`!\277\275"
+	.ascii	"\302\300K?\024\324Z\263\216P\357j\n`!\337\325\240\236\205\204"
+	.ascii	"\333\332\341\tx*f\257\256w/\302\245` \340_\027\020\256"
+	.ascii	"\037\357\\\325%\337\236^\336\017\257-\255\367-'K*\222;;\255?"
+	.ascii	"a\312\345YY\207K:\032#srX[PW\323\367\253\357C\237J\035\304%\334"
+	.ascii	"\363\354\204\3027\033I\023\254\334l\2562\205D\246\177\302\226"
+	.ascii	"\023\373\347k]\256[=\373'\304\006\362\2045\033\311\022\324l\256"
+	.ascii	"2iV\177\302V\323\340\326\022\002\216\006\373\034n+i\360\275\352"
+	.ascii	";\300S1k\330^"
+	.string	"\365-ess\367\361\3146\2146\215\336@^\365+H\361\3308.\315l \333\315\352}y\204,\313l$\273\255\360}yl(\227d6W\026b\313\261\233\234\235\233\236\036\267[\367\361\355\266\326,\325\255#6\300$b\363\022\354\306\307\033\2109X\006\271\371\211t&\005\200BE\025\264\354Zr\365x\227)\026\343\340]s\013\002\f\200\r\374\366\312\205\227\376\247\251\251\345\326RKJ6\246B\340\373\330\323\263\201XT\036.\365\316\243\265\366\215\353Q\357R\"\372\306u\250\367\250o\033^O\357P\3172\311\261\254\242i\226A<.5\037TO\337nS4\2558?\26544\254<wr\272\021ZJi8\024\341e\2411\327\030\262\344qC\304\202P\264\376\024.\243\226R7;\216n\222\226\334n\275\351K\250\232\265\223uG\001\371qA&\236\365\004D|\304\252x0>\275\2339Y\263T\261\360x"
+	.string	"hLLMK\247\246%3%\245\247\245RR\022\031\022R\324\322h\307\321\307\210\031\031\361X\016=\317\204v|L\025\254\250hj\211#\210\350c\200\370\320\020\325\362\306\322\306\322\347\246jz\203\205\345v\353B\0373\305\362r\322\334B"
+	.ascii	"XN:th-wh\226:9\336e\312"
+	.string	"\204#\350\035\307\217\224+M\245\007\275\313\024K\311\201\376\003\251\236\317\351J\221\214VE:\020\026\222\377\334x\377\371Jq\244\211\3427\336e\212e\344>>AR\030\237g\2136\336\245Z\324\323\023\226\202Hcu\236w\231b\r\371\316\316X\212\023\032C\327y\227i\245\347\370\373\236S\226B\330\304\337\311k\345\367\365,E\311`e$\345\3447eZ\n \315\337\344\273L\037%#\277%\327R\370\366\"\243@>~C\262\245\340%y|\027(\216Q\276\035\333R\356\236gvQ\336e\261\021\312w\243[\n\335\\\212\221\033\270\"7ssP\336e\232x$\205=\306\305o\306\3579\272\2248\232\224\267\024\270\233\272\233\273\033\352\ru\361M\\\345\r\3165\267\b\200\235b\342\267\"\342w\"^J\333\0206!\210\337sWG\016\237|\037~;\371~\362\255\227\222\026\r\322s7|)h7~M\204o"
+	.string	"S\316n\004S\312R\314n\2240\271!$t\273m'\337s\325\253\2645"
+	.string	"<\025\257"
+	.string	"\241\360q\3372\235\360\322\357\344\364]\375\024\376\n\277\253c\215\205\317T\022k\266\321\351=\254E\334{\230\323\177\334\332U\023a\223oB\260 \325&\037\343\305d\3117\023\257.'K~\246\312\245d\360[\311\226\326\341\r\343\340\313L\355\240\004\003\277\005\277\231\020I\271\202\n.S\254R\2467\2107\2127\214\214n\267\035\3701U;\301\253'\024\302\032\002Rb\315\226I\327\256\232"
+	.ascii	"\377\276\001\277}*u\250\240\202\215\317\244\277\253%\264Fq\225"
+	.ascii	"\024x\302U\221\037k\375\366\353\276g\255)<\240\202\216\317\244"
+	.ascii	"\276w\251*]\r\361\355}\363\351}\357\245<\245@A\253\22077\222"
+	.ascii	"n\267\255\367L\245\312<\274\357\274\024\246\033\356,\276\241"
+	.ascii	"\214^\361\236Iy\324(\252$M\210\222\204\372\235\344\346\232\222"
+	.ascii	"\204D\205\202\344\356\033IN\312\216\233\242\273\327`\321\256"
+	.ascii	"\356\333n'E\350FG\216\272\304#t\337GzR\200~n\320\375\265\221"
+	.ascii	"\237\3736\362=\367\364I\351\211V]\n\237?)<\317 \r\334\312\224"
+	.ascii	"\235\271w\251\366\311\025\371\226{\346Hy\335J\367\372\024\"z"
+	.ascii	">\213\274\006\323\275\2706\373\216\263\300m\270o3\027\322\215"
+	.ascii	"\204\n"
+	.string	"rg\361\363\350\231\224\344v\333pobZ\2457\330(\252\360\002K\260{c\027\277\337\202\270\355\366\354\342\222\333\370l\202\342v\244\255\r\277\333\302\334\036\362m\370\344&>\243\020\207\240\ta\241|\013\031s{\355Y(<\\'\317)\303\265w\2512K\373\017\373N\373nk\226k\343\224\271}\366\037F\3456yV-q\231<\247XO-\255\263w\251\222\201\221\300UF\366]\326c\337d\255P\267\330\367\330\017W0\032\004\320\r|v}=\203\004q\273m\261\217\231VA\215\215P\205\004\026\344\033,\314\355\343\013b\004\344\353\033\310\230\233\207\367\3650S\264\252\"\257\256o\257\357\2712\027\311\363\314\316\275{\246\255=\331\330\334n\273\353a\246hUD_\315-D`\321\276\337^\265\360\322\337\364A\211\375M\\?Z\362\254\001\211\234\250\344b\030\013\fnt5\tc\320 #43\244\r\b\243\031"
+	.string	"\f\004\3428\220\303T\332\001\024"
+	.string	"\021F\226l\212ZF\226Pr \206\301\2646"
+	.ascii	"\200 \246H\301\303HJ\267\f\350'\365;\234\025\004o\371\377\210"
+	.ascii	"[\372\027\272\375?o\024\003\301&\265ohA\244<\341F\224A\032\227"
+	.ascii	"\020\231Hs\311\212\2667\006.\030\026\254\356\323\264\r\334\207"
+	.ascii	"R~H;\324\314\301FH\357\232\305\3720^g\342M\3621\213\206J\342"
+	.ascii	"lr\023\372\215{\345\2604V\003\321\253\304\213Cc`E\304E\004u\254"
+	.string	"\212l\360\300\253UftC\350[\343\004\336^\326\006\312!*\364*\2229\202x-\006\003\366\240\255E\031 \367@\334\331\251\205\267\026\352.\370\227\t\3472\006\\\004\235\315\314\302\031\202\016\303\260-\247\252f\322\225x\321t\033\355\244O:ND\f\005z\213p\347\002P\330y\334k/7\271\331\336R\254\317\250q \223\227\353\177t\265\250\277\343\344D\324\314qIfXA\300\357\326\203 \352mp,\267\355\035\225\005S\253]\221\007\035\272\214\303\027\234\006PEE\235\232\006-\316\027\033]v\240C\241\006\275\206\257\030\376\346\330G\030\331\013\202\177\363\201\200c\337\300\226\035/\352\266Y!\031\271+p\355\022\357TQ\035W;A-f\n\226?O\\\\\312(\214\2423\246~\252maR\302;W5\351\277\034\240\345\264\031\377Nbw\274\336\206P\346\030\226\376\3024\303\274\234A\370\232\327\245\360\317J\003"
+	.ascii	"jJ\346\036\252M~6k\b\201X\260\214\005yZ\003[y/N\330\345\002\226"
+	.ascii	"\031<'Rg\340v\022=\301v\246\021<\211\250\366r\247O\232INPy\237"
+	.ascii	"\002\2245~\223:\2273\201A\305O\206\"sf}\363;\024\316\232\217"
+	.ascii	"&\216|J\032\374\346WdU\002\302yi6\201\306S\210\016J:\235\221"
+	.ascii	"x\02785f\327e\013\275~\313\310\204\256\364d\3071\3077\003\215"
+	.ascii	"\324\035\263!<\214\373\244\313\261\tV\204\364'\326\356\034W*"
+	.ascii	"\026\274i{\035\035\266\006\334O\260l\336g\237/\370\310\3655\252"
+	.ascii	"\001\277k\0135\2368&~\224\303K\225\3562\203\2211QG\260\33579"
+	.ascii	"2@\224\252\314\r\264\277K\2255\225\235\317\226\246\352\026\331"
+	.ascii	"\320\340\306O\270\236\314b\"\257\302\305q\032\252\220\n\376F"
+	.ascii	"\324$\353!\321M\362g\343C\251\020\355\026\211\242\262\350\267"
+	.ascii	"J\002\3477\311\272\224\300\b\022Y\275\235\2536\312#yq\376\360"
+	.ascii	"<\373\\"
+	.string	"\230\200YP5\037QF\"EZ\b\345\027\261\\\200\024\031Z\237\324\007\355'\234\256\321o\336?\320\327\330"
+	.ascii	"5F\332\274\363\207_<J\2352T\bt\271A\360\374\n\332\0031\364\220"
+	.ascii	"a\211\007\352\bA\027\354\335m\033\037y\210\256\f\256\257\026"
+	.ascii	"S\254\334f\032\365u\023\372\226h\336\306\003\032\007L\333\373"
+	.ascii	"\230\365~\2353\350\f\234\341b\322Z<\244\013\362{0T\366$2\347"
+	.ascii	"*l\251\240*hk\330\033>\370e/\020\215\210\311\364\266\2369\264"
+	.ascii	"\313\204\207\276\275\367qZ:\345j\324\335\230I\031\222\227\003"
+	.ascii	"a\253W\325*\310\313M?\350\246~[\031\257\265\377\254\365\263\003"
+	.ascii	"q\210\360\275\235y\001T\214%s\264=\362\305\224w\021\202\221*"
+	.ascii	"f,e[\253\355\n\367\370\022A1\305\305"
+	.string	"\"K{\255\362\225S\306s#\232\265U\006\267\227 \305O\311\227\373\242WQ\036LC\016\n<]\314\023\"\b\021&\267\234\263\210\237\221\270\216\304\340X \350\360\240\026\230\274\315;\274\335lIo\234\2024*][\243\0358\315\255\243&n\217\216\206\212\376\033\356\fr\343\004<\033\316\314\303\267=0\204F\031v\240\366*\355\024F\254\030}\301%\362\275\262s\221\246\"\301AG\216/\204.y\204\005R\\Z\334\242F\2678\314\037\223;x\3523\300\025\264\343\316C\226\376\353|\347\363*\253\341hE\317qB\355\026\265K+\025T\216\005\201\321V\211\267\325\372P\375\361\210>\200\n\004\253%\026f\337\213W\b\212>G\321`5\316}\272\302`x\306;>\221\310>\034I_\363\370\334\240#\307Jnj\027\260A\002\324\324;\335\005\036\332\365\3669\304\300:\344\222m\\R%\31610/\310\240\236G"
+	.ascii	"\326\355\366n\303\337\034h\006\244.\304\023i\332=y\023S.<F|\303"
+	.ascii	"\234[\274\271;\255\356\034\323\203\370~\\\302SDN\2224\204pE["
+	.ascii	"]\021\355\f\261\372<.\2663\373\f\021\277\037v@&\200\t1\336z\332"
+	.ascii	"\350C\n\235\374>`+t%HU\342\211\262v\031=\241\344N\262\304\322"
+	.ascii	"\275\304\302"
+	.string	"\3234\226e\311ty\207\302R8-\026\316\017\211\037\fz&\210K\017W\334#\350I(\251\234l\363c|'M\205\001\3731\352\333\332\240\224\330<U\240N'\343\253\251%i\2764\365\"?X\017\265\312.E\345\006\026\272\027\365\306o\344\272\006\214\020\017*\003\207kp\030S\2766\302~Ch\260E\036\330\3326\235Eqw\272\307\3450\027\332\264J\240\271X^w\261\234\334\222T\345\331\247\232\244\253 \270l\342\250$\024\361\263\254\f,*F\260@\374\315\257\022\276;D\313HQ\327\352\230\007\222\215 \2258{\035\t\001\274\205\367Nr\335\013\271xY\335q\326\013\374pQ\375\273i\252@\313r\2537\212\203\331\016\337\250\023\251\2614\013v\302\321\355c\251\033(\301\233\243P4W,H@H\005\264\230?\310\307e\271,\256b\323\351\006\327\264\006j\007\243>\301\375\331O\230\024\246\266\f\377D\327"
+	.string	"\332l\n\343\364\247\223\257\377\264\006\244!\032)\321\302{6j\004\211Y\363m\320k\232#\021\260\347B\377=\001&nhL\374\273\036\344q\275\271-\b\300\\;\022\307\024\354Q\225\271\013^\202\006\323MNE\236A0V\334$\373\177\314aq<\345g\247\032\205#\030@\177\t\252\316\317\r_\245i"
+	.string	"\301\221EWS34\347\300\220\254[\352\306*D\351\356 \227c\b\267\224^~0\032\340\034\375'\331\266\320\260\303T\331\246\013\303m\227\361BL\327YYu\364y\036\332\230G\032Cn\201\212\205\034\261\342\312G\360\2417N\\\031A\b \360\rJ\313J)_VX"
+	.ascii	"jHa\321\343_8\335\212u\365k`I\227\340F\377\375\340p\350E\356"
+	.ascii	"\376\311\316 \302W\260Yl\345\n\313\376\025o\205\031\n\351\027"
+	.ascii	"Q?\007\232\007\035\313\036\304*k\2362\020\007\301\255\274}\177"
+	.ascii	"/\003\007\372\225\205{\216\201\025\334\303\346\f\f\351X9e1\205"
+	.ascii	"W\300\226\361\347\261\214F\016lv\016`\335I\246}\240\202\310\260"
+	.ascii	"\250P\251\352z\266`\243\273\220L\313n\023ZW\003\233@\221\235"
+	.ascii	"\226\2334E\304%\026\241\361\327\005&\214p\033C\262db?\367\333"
+	.ascii	"\347\210\242\030NPq\330X)\032S\300\366\027\\\212]N\246\225E."
+	.ascii	"\036\024c\253\205H\202\332T\324F\203\233\201<\346\277\343\223"
+	.ascii	"\347\270Uc\031ML\317\t\306\023\020'\244\005(\\\300\353\252\025"
+	.ascii	"X\030\352\020\207\321\031\223rJ\211\341\034\037\247\373\274\323"
+	.ascii	"\3630xo\332\266\350Z\006!\213\201\307\022\3235K<]\241\332\314"
+	.ascii	"\212KO_\251/\254\350\271\360RL\031\377\203b\304A\245\n+\002\354"
+	.ascii	"n+\244X\221\207\001\177\200\205C\027l\247?:\2731\231\036n\222"
+	.ascii	"\254\316MS?\324D\307\355x\333\240\302\225A\355{\007\246/\307"
+	.ascii	"\305#\356\201u\355\271I\b\233c\266V\251\245\360\321\314Q\316"
+	.ascii	"\364K"
+	.string	"\371Rz~}\212\004\254\255\233\212\367\230N\240\252\200\242ic\306N\264\363/\233\021g/F\375=\357\341\311\215l\016\030\036T\264hNgQ\216\0353\342\035QJ\223^\305yo\353X\273eL2Q\341(o\265A\241\bz3\006\f\t\273\266a\023\236Zk\270\331\341\220O\3502a\212\305y\0031\323\225\307\347hz\356XI\364c#\220\232\344W\021=\243\356\323\277\\\363\240\301|\234\021I$B\261`\234\366\225\225\266\270\343=\335\277\006E+\350\225\236\354\244\025\304\003\025l`\fTR\263\026\254\260\352\275\222He=\231\225`d\007\366V\253y\337\235\326\021\003\324\321\201\266\226\342\252hM\370X\001\362(\006\243\335\ne_\303\"7\207\272\204_\342\206v\223\201!\nT\374\\q\255^\036HA\353`\032\210\366m\325\254rC4x\310\310\364\377\342:\363f!\003\025\3649:Kz\244\205\273"
+	.ascii	"x\305^A\240\234\312\374,Nr\345S\376w\233;\215\310j\337\301f("
+	.ascii	"\230\304:\367\210\222v\262;\316UO\013k\2712h\017\362F$\317\371"
+	.ascii	"\006u\025\220\245\211K~s\230\300@7\007\266\n\221m\0132\317&\\"
+	.ascii	"\214D\324\235p\325\260\035\022N\025\331\253\301\002\254!\002"
+	.ascii	"\330\244\235\271\216\223\t\274dj3\333\017\222\031\377Y\273\331"
+	.ascii	"\n\307mK\200\206\304\347\204\357vJ\223\220\212\003\203\275\323"
+	.ascii	"\235\226\024\007w\276\265\025\004\004\240}\354\212b\006\334\017"
+	.ascii	"fA\364\337\343s\310\033\335\005\275\263\3562\f\303\327\300+\324"
+	.ascii	"\235\271\016\325\252\370\224p3d\0070\221\320\345\322u\272\210"
+	.ascii	"\335k\202\357\321j\221\300\313\255\264J\"\032\311\265\263X\351"
+	.ascii	"~\356?\226\177\024\312\007%\303\032D0PO\240\035x\253\226\340"
+	.ascii	"\225\214\325\217\344\355\004\312\243\374\027\331b\336\b\302s"
+	.ascii	"n\324\214\266y\233\352'\215\025\006\205\264\264\372SfW\330\351"
+	.ascii	"\260\222:\305j6L\222EW\211%\242\253\250\201\206\234\325\270\276"
+	.ascii	"\213\202\316\374M2F\200\006\326\311e[\f\313\311XmJ\254.\276x"
+	.ascii	"\251Q\203s\211\237oc\326\245\355\251\244B7\3169-\rv\240O$\004"
+	.ascii	"\312\354\350\234\2168\240\253\374\225\024\315\226\205gU\003\330"
+	.ascii	"\357\211>LV,\240\304\216\263>\251\tV\327y\f\301\020\2778\026"
+	.ascii	"\353\030b\225\253\374\236fi\346\n\005\256\332@\251\204PFt\250"
+	.ascii	"\032"
+	.string	"\341\376A(\207X\241R\2006L\022\300\327\031\236\224)\3227\242n\251m\327\2352\220\t(\241\305\315\013D=\022\227 \307\322\020\202\017\366\255\025\2216?@B\301\361\314?D<\347?\032\3739\270\206{\004\267f\202"
+	.string	"B!\315f4\213\245Rp\347,\320>\345\304\017\230["
+	.string	"\n\206\234\275\n\300J\325"
+	.string	"y(v\300\203G\312|."
+	.string	"\231\300/\246I\252\326\n\310\235\222hL\210\225\215\317\254X\350[\343\334`"
+	.ascii	"\037\216\223H\244\216\026S\366/\201\336\250\302\260\031\"^\016"
+	.ascii	"\246\0067\370\340\327\215zdjs\020\272\241n\230y\226v\202\253"
+	.ascii	"\207k\3562\355\320K\207\033K/[\f\233E\275"
+	.string	"k\001\245\267:n\254Q&\246/N]\346\243\206SL#\236S\330S\032%\027\256\226\276uY\200WfD\322M\377\202ohn\365\261\017\255\022\201\276\353\037%\022\344\221g\217\013D\225\224\250\344\333\365|\221Givj\246\275b\200|,\353\3247\252\224\241\370\f\275\276L\215KKC\235\354\364G\033k\210\023\250t\177&7`\266\272\212\310\275\256\255)\313\276\346\322\204\035\002\227)\253O\261'\320\200J\277%8\234\377f@\300~\362s\244\347\336T\334\361p\013\001\034z\371o\211d\3341\204\221E\3101$\254as\327\366\210\324D\266\026w\250\326@\031v>I\256`\360\352\004\306!\201!m\240f\034\003AY8\352\305*\236\225\204\222X\343\346jN7k\256P\004\333\"\205\003\2223\242\207w\005\022\234\324\223\226\034!,}N\332]<)\023\233\177\031\022\343l83\252cP+\233p\306"
+	.string	"\f\271\376"
+	.string	"#\244pj<\027\313O\376\b\2107\200b\234\347N\272\262{\305rA2\240\302\366 _\036\215\211\274y\006\227\367L\350\264\316\0032\324\320\323\\\350\377/L\320\344\3406\307fS\202\020\n\3157L5a\254Iow\302\214L\241\352\226S8aaE[\027\345N\226b\b\373\f\005\r\312\256@\244\222\302 \361m\\\205S\260\177\006z`\006\311\220s\214\320\221\034n\365n\216\255\004\303vJ\017n\332\354"
+	.string	"\031\363\323\324\224\224\\:\231\311\325\353\342}\206\305:<\267\254\204A_\033\240\271\025\334@\be\002W\324\355\323\342\366\245\345i{\017\370\201\213\203O\327Ho:\332\232\353Z6|\377\255\273 \037\352\204\036R\212\356\216\235\220\033\331\247\236\036\377\370\373\031\320\343\r\300\221\242o-zM\202{n\2642q\223\313Z+\344\027\375\204\004\311\250\320\274\255\375m\262C7\\\227VX\003\236\245\265\304\210\375[\264=\301~\225\315y\"\036\033~\276\366\340.'q\340\316\236j\232\315\263X[\317\354I\266\2603\002(z\0045\027\025'\026\233\001,"
+	.string	"\214\274\260>\0053R\3200\371p\346\304*\355@5\316\375@\340[\253\315\316\230\245\036\320q\f\321\305Q\200\342mZ\002\r3C\230(\2608L\251\026.\257\245\321\326xU\002\311\r\257J5DL\333\004\352\355\206p,,[\373FY\035(\273~.\227k\367)\221H\222\t9\255\332\302nz\206\236\251\367\232^4\216\275Q=P\017\260\277z\2462\025a\233\177\345\204^\253g\364\314\247\177,\026\355\2749\306`\027\355C\324\203\201\355=\355\036\250\274\013\263\337\311c[\364\017:<Hx\205\250\361\244}\254\001\251\313\026\201\254<"
+	.ascii	"\343"
+	.string	"#&\267\2508`\240\340\024#\020\262\025\211Y\241>=\026\037\f\355~\321\232\213\374\017\360$F%u\320\005|kr\361&\337\203\rEh\342z~J\004w\341\337Y+X\013~\277\331=F8\326\336k\275U\245F~\\\023^\257\205\032\312Y{\n\034I\334x\232\350\276\331\252 \216\363om\213\354\244\016\362f\266\243k\240\034\326 \032\204R\027\230\340\375(g\367$L\365\374;\365\006\013\375\232\034uP\005J\r\017\275q\b/u,!\343\373F\217y\\6\213l&\364\2758\"\316\312\003/\002\244\fh\267\021\217\273\377i\330Qi\215f\206|\rrp\004\f6p\202)\204\346\211\205\346a\357\254\270\023wn\273/\316W\313E\007\t\311\266a\312\325\"h\375\215@U\222\001\020\333\372\357\273 <q\025:\241\214vs\274\235b\254l\033\037\321\370\022\245\362\002}\013\252\270\307\022+\017\310\213"
+	.string	"\332\261H\233\036N\237&\t\306-\026\202\371\350k\276\230\245\374o\263R\375m9\016x\354\3729\373\366\241'\353\032mX\rb\333q\204\230\022\346\340\342\241i\310\327\360|\202\206\231\314#\327\250`#\375\331\315\317D\013\354[#\23001\247 5\262\233p\224G\306\315\035\311\203(\252 \361Y\036\b\330\376\003&i\rb\025}=\316\326\023\315\343\242;\265\2374Me\027\246\004\331\006~\273/\270\363\f\001\220\334s\377e\264\234E\"xd\277\344{G\364\2728\277\fW\360"
+	.ascii	"|Xw\361\205x\326\364\006"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.158.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`<\f\215;"
+	.string	":eT\026BPdR\007C\257h\n\";\006>\345\316s\300S\336`o>\370\251\372\036=\224\002\255\324&\325\360X'\236\374\bTE\005\306"
+	.ascii	"E\220 \tpu\366\2432\261\252+B~\254\322J\333\337{'\231RW\001?"
+	.ascii	"\001S\001\036\254\317,K2\246\3663\355n\035\\\23219\032\246\347"
+	.ascii	"h\366!jt\207\360r\316Io\233\205\317[\266;\253;\330\275\374bj"
+	.ascii	"\315\344\270\206\200\226\351\342\301\347\355\322\311\304\206"
+	.ascii	"q1Y>FG\200bv\212\361\222\362y\333l>%!\246\307\335\016\306\327"
+	.ascii	"\262\234\255G\2679\213\351\301\345\314\306\324\f|\336\026\261"
+	.ascii	"\247\271ZV\277!\2004\243\021\350\372l\221!\224svRr$\327[\326"
+	.ascii	"\217\256\267?v\354\242\263l\336\306\177\035\ty<J2\026\215\210"
+	.ascii	"Ca\020\370\363\025\271-\373\370m\327r$\237\035k[\036\322J\034"
+	.ascii	"*\370X$5%Z\305\217\252x\022\373t\340H\335\016z\205\315\0206V"
+	.ascii	"\347sd\3308%Z\346\3059\367\001\262R\363\244\32127B@d\243\250"
+	.ascii	"\340\321\223\302I\023\327\002\r\303C;(\024V\351\215#\320\002"
+	.ascii	"\005\303B\027N\316\202?1\353\221<i\324\314\201\3364\363\037k"
+	.ascii	"-r\346\223F\233x\221\333A\233\244\331\302\256\267\371\207\251"
+	.ascii	"\034Bj\205\244Q'\336\002\273\2248\313>\300[#\210\330\005\204"
+	.ascii	"E:r\345\351n\216\271\272\234\370\275\236|\005\001v\375p\201U"
+	.ascii	"*U\227B\315\\\\$\225sn\374\354\212z\003\360n\257v7\217n\240]"
+	.ascii	"n\274C+$\307\035\r\320\034-\214\310@\2248\264\377i\363i\357\003"
+	.ascii	"\326\344\256\375\372e\004O{\036g\342U\247\335\316 \027\313V!"
+	.ascii	"Y\262\330\234v:\355\307\007\310{\270\336:\220V\016\234Z\227n"
+	.ascii	"\257\353Aja_9ky\230\037\374\314\016\274-\360J[8Q;\332\037os/"
+	.ascii	"C\223c\227\261^7\233\026\376i\267;\2276Cl\372\245t\023qG=\356"
+	.ascii	"\r\217\033\003\324\223\303y'\177\270\227\032\267\202\306\235"
+	.ascii	"\300\307\270+y\031\367\003\316\346^\240q\003x\334I\217\033\311"
+	.ascii	"\351\274\221.\347}|\334GC\334\306\307]\034\3426\022\342&\nq\017"
+	.ascii	"\205\270\205\217;\370\270\201A\334\277\307\355\003\342.z\334"
+	.ascii	".\020w\373\270Y \356\177\334\230\203\247\t:b$\352u\203r>\262"
+	.ascii	"w(\317i\331`q:w9w8\3678g\273\335J+N\007\255\232_\362\230\332"
+	.ascii	"\341\264\317up)H\256\253]\254\324\035nk\274\352o:\350\355\362"
+	.ascii	"\315M\025!+\230\225\034\033o\223\345q\312\237\036k\031^\316\320"
+	.ascii	"\032>o\337\302\362\016S7\234U1\333e\217v\261V\301\313\231\355"
+	.ascii	"\0055M\007\227kl6\023C(^}\243\f\377W\327\204\205\323w,\370\302"
+	.ascii	"2\257\276U\202\337\340.\016\360\367\300\367>\335\257\231Wm"
+	.string	"\370r\316P\277oP\006\206:\207}\357\331\273%\352}\357r\311w8WZ\200\321^/\330\237\311\367\252\230\323M\002\354p\274\372~\361=\243\276\373]\343@\215k\343n\374\363\250is\232X\257H\030\250\221\222\315Y\032\345qN\240\f/\f\336k\334F]CF\307\210F\257r\227\336\245b\352\234\330\320\227\245w7\236\325E\277\364\003\336\212\336Eb\004\275~\r\335\037Nq\337\241\274I\273\343\016\250h\302\016\t\266\354q\007\324\263`\001\254\004B\004\366\247\202?!\006\244\215\nE\017\030\360\247\335sp\327\275\237\233tO\263\346J\021\206O\242z\251\031\221De\222\364\376\346k\037C[\304\262i\334xGUb\347\324.\367\247\215?\351n\\ki\330\r\217\364\\mlC\333\023\200\375\255\304\t&\262\234\233\376D\372\003\337\215\"\005\366g+\005\271C\323CzG\3430\304\232X\217m\3777\274"
+	.ascii	"2[\211\232x\257\221,Z`\177\376{\236\377\022\215\235\261?\355"
+	.ascii	"\244\343\027\332\211\271:\261\2416b\245\357\2061\205\375\211"
+	.ascii	"?K\314\371Z\355n\0016<\206\210\033\314),W9\003\207\210\033\314"
+	.ascii	"),_\325\324\025\r%\026\323F\215\237\f\032SK\026\307\007&S\006"
+	.ascii	"\225\362\312\004\026Sib\311\254*b1c<\215\253\251\357'\n1*Hx\272"
+	.ascii	"0\241\351\310\004\n\0221\252\250\334\246jZ2\253`P\315p\242\232"
+	.ascii	"\341\204\303\306T\225\023\325\025\323\251\t@+\2272\256\234\260"
+	.ascii	"\224\312+\247 [\366\227\322D.9W~\356\257KhK\r\366\341\257\177"
+	.ascii	"q\265ID|\375u\203m\226\004\023|\022\2565\211\200\n\036\300\377"
+	.ascii	"h\267zKiaDnH?\3554"
+	.string	"$\310\237\366\357z\364\364\3555)\351Hd\034\344;\335\361\351\235\016\371OzG\306?R\201\243\257\022\rz\212\340.\343k\270\213\203\350\350\247\355I/\245\177\327\"\324\267W\243\244\037\237\013\017\361\343w\270:\261\241=\351\361\245\232X\317Y#\324\273\034\004?>\324{\220\260\037x\257\331<j \013\270\330\365\"1\372\342\343\267^\201\215\274J4\220\345\354\264\320\3752\301E^'\276\234\235P\3366&\362\222\275^MdV\274m\267r\2755z\rel\232x\357\250\215:\350\237\316\237/yE\241{\225\353o\334\030\207\246M\335p\351\243\222.\304\232s\316V\245T@E\357\252\373\207\bF\304\013\200\371\250Q@\345\230C3\"\"\"\232\024\244Y\003\300\002\0211\"\316\001\021\3404\253\034\033\221$I!\303\030\244\245}\377X\033E\360e\211\022\244~\275\2545\355\225\004i;\274\324\226N~[\035"
+	.string	"4\003g\003<\357"
+	.string	"\360"
+	.ascii	"\364O\362\233_\0374\310\271i\332\035YD\327&\316\3721\2265E$\233"
+	.ascii	"\202W\301f\024[\225\337\240\271R~4\253\325>\205\243\022;\bc\376"
+	.ascii	"\300\275\273\376\024\377\301\311\357\025\277\227\240\362\226"
+	.ascii	"\276\301\252\020|t@\033\266\346\335\363\253\201\025N\225\021"
+	.ascii	"\320\370S\246\327D.#tY\317\205\241\200\031\201\332\353\222n,"
+	.ascii	"\224\225w\325\343\267\255M[\271w\357h\251\263\311\247\270-\351"
+	.ascii	"\237u\007Z\202\324\335\2705A\266\351\366'\201\214\374-\245\317"
+	.ascii	"\332Q=\020w@\344\376u\016\375\nv\210\252\222\227\322\3148\255"
+	.ascii	"\244\303\344\004\357O\224*\3448=\267\233\321E\207y\034\243\006"
+	.ascii	"+\371\022\032\2034@\341\354Q:\300\263\201+\260]\025\003a\345"
+	.ascii	"q\301\315\376\277\233\253\323-\251wsB\264h\346$\214%C\033\341"
+	.ascii	"\277\314\257\314\364\232\334\376c\232\206\236\244\024\020\017"
+	.ascii	"}cO\361<h\310\314r\f\241tb\256\305y\306\316L\217?\325\211i~\333"
+	.ascii	"\0205\225bK?\332\261\222\306C .\326\300\030\036f\346EJ\013\204"
+	.ascii	"u=yd\252\322\2225<\030\022\221\263\022\220\0353S\020\331\036"
+	.ascii	"^a\373\253\215\032\210\032NX\277\343\tG\300\021\037\221\016\023"
+	.ascii	"\330\312.A\367Y\240\340_?:%+\227\320\204^\264\033\023\023\343"
+	.ascii	"u#$\321\213\261L\213\034[*R\231\317\203\025\326\242\001\r\252"
+	.ascii	"\314\354\214m\025x\267\376\262\207\264M\376\254\271\244\244\236"
+	.ascii	"\323\\\003VP5"
+	.text
+	.section	.gnu.lto_mspFcWpCommand.159.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`4\004\r\031"
+	.string	"\326\253\234L\220\024V:h\202\031\027\004\023\350X\001\300SE`]\357\310\"\376ti\276\230\bl\333\277\374\341\036\002%\336Y\034;\223\316ZuO\350\301\245\006\006\001;wm\035\373z\264vl\353\"f\310\210\354\266\240\317\017\r\324\310&r'\031\206"
+	.string	"\203"
+	.string	"\207"
+	.string	"B\"\367^\333-/x\335\326J\035T\021K\301\353VGB\345\225\371RW\341{z\341\001\356mrauoq\205\007\274n\271\370\023\363\366u\001\346-\373\230\207\240\004\357\317E\307\326\020\225\221{\357\255E\334w\323\226]}|W\fLH\374\335D\272-U\226r\034\241D\241\362\244\307\007!'1XK"
+	.ascii	"D\2447J\f*k\367\336W\275\016\211@\265\272b\356\275\\\205D\243"
+	.ascii	"\263\353\314|\303\314\016\230\313\n\001\375\343\224T\203\217"
+	.ascii	"k\374\214\r\206\tX\265\370\351QJ\232\301\307\255Z\314\305_m\020"
+	.ascii	"\314/o71?\375Kf\250,v\344\371|\361\207\335x<\233\266\262-+\227"
+	.ascii	"\266r\333\312\265\254|\024Z\020\027F7\302\342\336\242-$\227\207"
+	.ascii	"M\232\270\361?\376\3107\363Ou\026\257\342S7\325\362\342;\362"
+	.ascii	"\247\274I\t\256\210\236\356-6\210q\354\325`\367zP\262b\200C\345"
+	.ascii	"+>\345\273\261\367ktO\024u\025u\206\306\354\232F\315\352\273"
+	.ascii	"\244\231q7\365B\256\005\373\327\037J\362\217H\241\314\376\361"
+	.ascii	"\265j\261\253c\200\246\354\206\215\034\031\212\030\215\0319\261"
+	.ascii	"\023\\#X\364dK0\274G\332\241\234\365\215+O\312\230)\241M\340"
+	.ascii	"1z4 \367\336\003\374\027\207\241\303w\272\345\t\271z\341-?g\336"
+	.ascii	"\242\215b%\201u\213_\225r\250\367\336_\377\230gK\230\302\n\252"
+	.ascii	"G8%\335p\366\221\257\275*\254\231)\360\352\205g\3030\005\005"
+	.ascii	":\036\232\036\013\326\247f\247yt;\215\333\361\232]\f\330\274"
+	.ascii	"\024pA\320\302b\342\303\263i"
+	.string	"\306\261\364\360r48\234\033\016\347\306\243S\223\273\341v\274\033\013\215u=7\273\233\217N\267\273\235\305\373\362v\023\243-\212,YY\323\206Y%J\333\317\254\037=kW\017\317\"B6\326gV\210\322v\264E\326\216F\333\354!,\235\301\003\330@<\253\266'\255h\325\366\007\020\236\246\266l\313\337\361\253\036\337\211#\310\3104,I\252]\335)LjX\2501`\346\220\241@FfDAR\220\244\003\320\002\031!c\035\021\360<\351L\315)l\353\035\211H\201h\303.A\025nL\031|d\211\303{\257\314~\005\334\245\312\255\365\3248\030|\357\205\320~K\360\247\335>\3310s\264\211\002\360\0278\213\245%\361U\b\26734\253\332\315S\025\2506'8>\211F\2028\300\336\250\307r'\316\005H2\005\216\256\200\027v\f\315!\335\306\274\316\342y[@\326\0045\362\332X\371R~\203\264\202\372\322"
+	.ascii	"\240W\b\3303LIO?\244\006\205\253.Ax*\001R\345\fJh\234\370\206"
+	.ascii	"\b*"
+	.text
+	.section	.gnu.lto_mspFcDataFlashReadCommand.160.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\276\002e\026"
+	.string	"\006\252\224K\300\016+\035j\250\362U\343\253"
+	.string	"\312 \037\223\251\357\305\275\263\3110\343\177U\203\244\033!'\233\354\"8\305\275\261\336\374\270\030(\275gi\214\240t\031\244\r\357\227\323?\033M\n\235\321\363\261\310\325\207\305\255\263\"\203\020\"e\222\001~"
+	.string	"x"
+	.string	"~"
+	.string	"+Bb;P\206uK+\317\364\035O\354,\325\232\026x\271&\033K\221:)8_\306L\200\234w\277s\036\333\177\025\316Q\353M\261\250\326\324\300\0228_nz\017\363\345\371"
+	.ascii	"\346\313\265\355\256\030`\241\336F\2128\271\340R\255\265\325"
+	.ascii	" n;\331l\333_\327\273\235D\3656\274I\020c\211\027\252\036\r\351"
+	.ascii	"\301\303\321}\350\274\353\3150g\224\324Z\227u\275\232o\371\335"
+	.ascii	"]\260\273/\273\275\001\273\351\215\333\267{\262\326Z\267ov\377"
+	.ascii	"\373W\252\017\277\251\023\277\250\247\377y\240\360K\232\274m"
+	.ascii	"\362\262\311{"
+	.string	"\216\367x\340a\250y\323S\255\274'\247zT\032\2118\360\027\376\303\237xr\367\367\371\317\205>\264\0331\026D\230\243\242\216\221\345\b\364 \333\207\023^k\352/\344\024G\030\037\234/Yd\356$\036\264]\030\303\302\2455CF\360X\324\340|\t\200e\032@v7)|\335\262r}[\262\273l\356\177\350(!\246\224)\211d>n\331%8\262}2\346\201\247\331\340\370\bC\325\027\256^(_\247j\224\007\375\216H\017\321d,\352\366my\030\023\325\020|P\320pS\312;%\035\246\244\217\237\213T\177\230j\211\300\327\245\372\034>~-\220P}\342Y8>\356\033\325\035\314\305\300\361\323j\360\331\2732\t|\335\373\035lh\372\266,\244T\231\222*\037\003(\205\026\007\256\232\013v\322h\350\f\0063\331`\251\255\304\320\023\230\013\235\241j.\227\231\214A\314\313\265\202\236\2404\230\325kF\353\035A"
+	.ascii	"#90\222@$\244\243F\203\365\276B^h.)/\225\326K\245\025kq\271\264"
+	.ascii	"^3Z+D\300\312^\320Y\253&\223\315Z\033i}\337lJP\356\207\257\242"
+	.ascii	"\370\313\021\365\215^\366\3569E\240\034\021\277>\306\274N\221"
+	.ascii	"'G\324\252&{\247\321\363\341\b\3273\333\301\334\335\251^\365"
+	.ascii	".J3 \220\002!\301\262\003\262\t%A\322AB\303`:+\304S\355\303\263"
+	.ascii	"D\227\237c\\\256(\035\n\260\030<\360\326\230\\\027\202\306\347"
+	.ascii	"V|\234L\323\027\374\341\332\346\253\353V,q\0335J\343\255\235"
+	.ascii	"\272\220\273\020`\233a\230\"\320eb+|\351\246\035\217\304\224"
+	.ascii	"\f\225\025gc\235jc\242HiK\246\372\3060G\310Pp\032q\\\020p\240"
+	.ascii	"\3409\333J\raA\001"
+	.text
+	.section	.gnu.lto_mspFcProcessInCommand.161.4240a8cd4661dd66,"e",@progbits
+	.ascii	"(\265/\375`ex\005\214\001\332w*\211O\020 &\365\214\001\fu1\216"
+	.ascii	"\343b\321D\004:\364\002\270\253K{T\343nc\303\024f\251\3616I}"
+	.ascii	"r\023\332\205D\221\314\320\237\204\366\206\332w\300s\324\276"
+	.ascii	"\203\031jg#\035mLL\207O"
+	.string	"\0213\333K\220k\312\230z\023m\"\245L)\245w\b\263\007\333\b\316=\244tn!\031\347\376\341:\267\017\327\271\203\336\271{\244pn \327\271\177\336\271}\224\316\335\363\316\315\243t\356\327u\336yg\247\353\334t\235u\\g\246\353\234C\201s\006\\g\033(p\256\301u\246\201\002g\036\256\363\016\031\347\245\322Y\207\353<\203\353,\203\353\234C\351\214\243t\276Q:\343p\235c\230\300\031\003\256\363\215\t\234m\270\3160\270\316/L\340l\343:\327p\235i\274\363\005\\\347\031\"\234-\360\3162\\\347\n\210pva\002g\n\270\316-L\340<\001\327Y\002!\234#\240t\206@\b\347\007(\235\035\020\302\271\001\357\314\202\322\231\001\256\363\002\336y\005\327Y\001(\234\023\360\316\bP:\037 \204\263\001N8\027@\351\254\202\t\347\024\\g\002H\340\214\202\353<\200\031g\001\270\316'\224p\016\200\353\f"
+	.ascii	"\245s\f\245\263\tJ\347\022\\g\022H8\217\340:\303 \341\374B\351"
+	.ascii	",\002\t\347\020\\g\020H8\177\340:{\340:w@\302\231\003\327y\003"
+	.ascii	"\022\316\032\274s\006\357\354\302unA\302\271\306u\306\200\204"
+	.ascii	"3\013\327\371\002\327\231\306u\266\300u^\341:W\340:\253x\347"
+	.ascii	"\024\2563\0052\316\023\270\316(\\\347\023\256\263\211\021\316"
+	.ascii	"\022\270\3163\256s\211w&\341:\217\220q\226q\235E\3108\207p\235"
+	.ascii	"\2252\316\256\353\034\201\2143\b\327\371\203\353\354!\204s\007"
+	.ascii	"\2453\004!\234\037P:;\360\316\r(\235cD8s\b\341\234T:#\337\371"
+	.ascii	"\370\316\355;\263\256\363\032\201\363\277s\257\323\024\272\224"
+	.ascii	"\345Q\261\363\373\275\261\227\250\032\346\275c\337\234\270R\373"
+	.ascii	"R\273\223v%\355L\332\217\264S\265\033i\217j\177\273\251\335a"
+	.ascii	"\272\023\273\253t\237u_\351N\353^\353nk\020\314\215\363\304\342"
+	.ascii	"\030\234#5\314\334|\240OH\021G\250\206=\t\373\022o\30218C\316"
+	.ascii	"\244K\365\na\031\262Y\234%%\022\200RM\343\nD\342W\206nU\355\302"
+	.ascii	"\272B6{C\365#U\261#d\2637\321*\216\271\221\276+\022\30660.\265"
+	.ascii	")\216\271yC\274\"\274\t\223\342\230\233)5\314\374\306u\270\326"
+	.ascii	"\202;\261C\365\r]Y\024\237z\252O-$}\340s\205(\213\222&\254\""
+	.ascii	".\254/\323\330{\364!\250\310\031\230b\037\262Y\366\"_bg\342\030"
+	.ascii	"n\006q%\366!MO\222\341A\354H]\304U\345z\3377\246\351F\313\023"
+	.ascii	"<c/Q\f\020\365\214\371\326\274\373\021o\340\201\f7Zfp\324\322"
+	.ascii	"\307E\370\276c5\315rG\221\3152\227j\274\310\203\260\0231\231"
+	.ascii	"j\230\235\210{J\227\311p!6\375\366(J\016\241}\301!\233e\002\251"
+	.ascii	"\361 >\304\016\204c\232e\006\251av 2\372\315\202\007`i\003S\364"
+	.ascii	"!\031\3141\315\362\f\017b\377\321`\\T.\367\341\363U\363\356>"
+	.ascii	"fH\0312\274\t\362\343=8\246\331\233# \032Gw\205a\242 \233\275"
+	.ascii	"\201\252av\037\233\016\257\364m#\276Bj\026\262Y\034\215\316\303"
+	.ascii	"17=5\314\374fU\210c\260\206\233\312]\345\030\034\204\f]\3373"
+	.ascii	"\001\024\202a\341\220\326p/r7\346\3250\366\264\331a`\350W\350"
+	.ascii	"M\362\025~\021\276o\221\022d\263.\225\002\207[\rw\026nE\216i"
+	.ascii	"\026\207\226\304\f@)t\322PH\304\027^^\270\016_x\351)\026\276"
+	.ascii	"\360\322\343\032|\341\325E1\360\205W\027\256\033\177/\274\354"
+	.ascii	"\374\206\374n \225@e\307\367\302\013\214\242\227\027^`\270\272"
+	.ascii	"\274\360BT\224\276\360B\344\272{\341\365E\261\356\205\327\027"
+	.ascii	"\2569,\273\276\030:\0137\335\013\257A\305\271~\333\346bH\332"
+	.ascii	" \017L(\251F\356\341\302\200\361Mg\341\216{\2700\\P`\357\373"
+	.ascii	"\3060sk\2012\364\304\317\330k\024\003D=\003S\334A\252yo-7\re"
+	.ascii	"h\no\217\322\013\037\272 0\305\367}k\232e\030\220\315\31207\271"
+	.ascii	"\2554Zci\265fk\267\206\343\230\030\252o9|(\332\375\331\374h["
+	.ascii	"\366\333\343\265\341\213\035 \341\373\216\311PZ\233\341\316."
+	.ascii	"\220\360\001\310fq\030\251af\336\300\203f\247-\327\227i\004\273"
+	.ascii	"A\254\367\035[\201\311\225\247\003t\235\3618\221|\337\251&m)"
+	.ascii	" \233\305aV\323Ux\364{\364\366\2170v\212\204\357\373\262h\226"
+	.ascii	"\005\200l\2269\206\303\232uJ\2275\233J\r\":\274?eC1\220\315\362"
+	.ascii	"\0302\206\275\232w\346\226\322b\315\036c2\373\276R\177m\357;"
+	.ascii	"V\303\025 \233\355\340_\r\326\344\235\024\200z\2162\260\353\013"
+	.ascii	"2S|\337\327\305\211v\333f\327\006\3216\373HT\250 \341\301\203"
+	.ascii	"aW\007\221H$\373}\370\320\201\003\007\016.\363W\300\r\364:\326"
+	.ascii	"\354\"\271\323|\310\206\\\310\204<\310\202\034\310\200\374\307"
+	.ascii	"~\334\307|\274\307^X\217\273p\036K\031\217\357\330\216\3538\312"
+	.ascii	"t<\307\\X\216\267p\034ka(ga8~c7nc6^c5Nc,|\205\321\370\214\255"
+	.ascii	"p\0256c*\\\306S\230\214\307L(\201\204\021`\274\020!\004\020>"
+	.ascii	"\360\240\003\0166\320 \003\027-j0`q\001\215\005+*P\221\202\202"
+	.ascii	"\tP\2340!\301L\t\022#dD\204P\272\021\200\370\340\241\003\004"
+	.ascii	"\0170\242\003\r\304pH\"\217-\273>\177a0\234\350;\334<\315\207"
+	.ascii	"X}\316\206~\315\205\216"
+	.string	"\325\036T\0309\tbK\232\242\362k&\364\253\250\363\240]\263`\211)\237\272&\201.\333\"T\322\024\225]3 \235_\375\255G!E^B(\034,\342Ur\316~R*.\315}Q|;M{\312)\0376g/\325\037Yz]\322\234\363\2608K\2578\343\2419\337\211\3315\235\3245^eE\351\300\232\347\300\276\234\271x9\313m\341r\216\353r\342\254e\352\007\315\022\301\024\025\223f\270\022S>K\224S>J\234\337V\320\265\201u\271\265Y9\263\371e\255\225\230\362\201b\2654'g,W\2128\243\361\031\223\263\225\ftUYTb\026\244\231J\020 \316e\211U\236\262&MQ\t5\223)\247|~8\217\225\230\362\021Z\207L\371\370p\023Jp\242:\t\215=\202\264\2501\214\303\230\366\213UE\027\243\226\226\026M\327\021U\200\222\364\223\"F\027!*\204\" \324 \344\203\252\007\213\035"
+	.ascii	"r\300\266\201\264\310\357I\021\224k\260\272DM\204ZZ\324\267^"
+	.ascii	"@\350\006\246\3412p\362\251:wa\327-\236jx\020a\260\254\262@v"
+	.ascii	"9\\,\234:r\352\013\2704\r\0279\267\200\313\026_\261v`[3\300\342"
+	.ascii	"\025\254\265\n\265N\261j\300&\325\330\322\242\264\365\001,;\237"
+	.ascii	"~R\244\346\024H5\362\313\341Z\341\324\321ZOp\305Q\234\360\246"
+	.ascii	"F\361\244\350\314M\210\271\004(\246\216\234zf\005\261w\003\025"
+	.ascii	"\006LhQ\357\321(\236\024\205y\211\265\343\272\252\264\264\bl"
+	.ascii	"-\301\252\212\227\017\351r\022_=b\035!\214\353\252\245E^\353"
+	.ascii	"O\261\022\347L\215\342I\021\230\313|\265\210\365\304\334]PK\213"
+	.ascii	"\240V\023UQ\213\375"
+	.ascii	"\244\210\313C\f*W\226\017\316JK\213\232\254/\226\226t9O\243x"
+	.ascii	"R\264\304\335#GL:\2029\0203\260}X\013\261dM\0359\265\207\365"
+	.ascii	"\bD\324\244\245EWk\b\214\204o]m\024O\212\242\274\303\221#\253"
+	.ascii	"\206\340\257\037\350\036\253f\304\365\002(\272\244\022S>\201"
+	.ascii	"\253\213G\005\330\212\215\342I\021\224;\320\201\352\257\0338"
+	.ascii	"\306@\001\211\320\031\330\342\324\221S\307p@1uT\244\223E\340"
+	.ascii	"\032\305\223\"\"\216\354\251#\247>.u\373\200QP\017g[Z\344\264"
+	.ascii	"\236x\3377\306"
+	.string	"\b\310\327u\004\024]RK\213\230V\025xT\200\r\327>d\364\343O\001\227\346/L\232\301\270]s\342\323_\222(\335\234\342\240`\340 _\023\007#\237&DMD\320\004\223<\t\031\252.F\255\251]\001*q\232\223\262\345LLJ\230\223\b\246|\370\332\226B&\326SEP,\374\030\343}_v!\243\243f\033\232\231\003\032s\363`\276!\021#\236\304\263\210A\324\036\355\241/o\221\345k\354\021\361O\006\3213\355\210\327Q\026E\313K\224f)@\016\344\373\276\335\243\337\032\004\251\036\237\216x\030\210[M\223wx\307\343\215!\362\352\036\3402\317\354\204:\343\026e>\311\324\343\325\250\364\365\251\362\237\034\343\027\301\037y6\t\r,\272\031\177\210\241m3\376\t~<\275&N1\276\277\355>\345\356\241\312iq\217\274\277\214\377G\330\302<8\021r\217\370\345p\005\021\204!\344\224s/\030\b\330"
+	.string	"e\237\373&\256\362\342\"xfg\364\367\226+XG\350\2758\355T\204\200\367z\316<d\227\b8\365\032\001m\263\254Z\004\337[\374w\217\207"
+	.string	"\356%\354\334s\366\365\265\315\202x\023WL=^e\347i\017}y\320D!5i\004\377d\336\372\360\367u\3216\372\341{.\212\207gv\006>\227\245\211\337\362r\316Ag\241\363\320y\3306\333B=|\313\301u2\357\311[s\f\020\377d\216\352\200\370\320,po\"\020!\370\016\020|\233\365\364\3003;\023\237m\207\250\251X\275\357\373\001\263s\361\327\234\323\021\330\331\370j\316j\005|\357\373~\320,?\226O\333\341\341^\322,\357\370\354"
+	.string	"\001\265\315\212ht\340\037\370\016\242:\360\255V^\323_\345\021\371\360O\356j\367smi\255C\003\177\201\037b\264\274%\030\326\367\2352\241\303t\023N\361*\217\340\027\370\246v\343\316\017\025|\357\373\266\020\363\316\320N\020\240\347\341n\354\017h\322\252\207\177\262\003W x\257?&\341\301\242{\361\207\026\277\201?\241\356\307\031\331\002\337\300w\265\223A\324\036\013Z\016o\201\2566\2734\265\370Mm\036\363i\266\302e\205\253\3037\265{\361\337\353\273\007\224\217W\271\305\223.\306<3\353"
+	.ascii	"\351F\346\214\325\373\276!<\242\220a\314\267Q\265?\364I\247\322"
+	.ascii	"\327\247o\302\225,> x\302X\202XQz\340\237\334}\f<\304\342\361"
+	.ascii	"U\313\366\243\024~\224\357D\016\377Q0hOz\016\357\201=\250\212"
+	.ascii	"\355\241Oj\347\204\335p\335WR9\007\234\355\241\030r\3755\320"
+	.ascii	"hR\270\344\363\217=\331\016\221\321\016\022R\333\254\253\t\031"
+	.ascii	"\366x\225\221\237\364`i\207\210\267\020\362! u\033j\032\251X"
+	.ascii	"\314?9\304\032\222\220\344{\265\273fT\207\364\300o\305c\223\342"
+	.ascii	"\037=\364I\243(r\360\352nk\031h\322,\347\342*\222\354j\017\374"
+	.ascii	"\236*\253\353\223F\005r\325\003\337\243AL>\322\246\225\220P\013"
+	.ascii	"\371O\236Y3\022\322\276W\307T\253\260\016\370\235\370C\314\032"
+	.ascii	"x\373\314;Q;F\274\205\370D\342\267\337AT\270\376\200&U\352\304"
+	.ascii	"\357\266\346\030=\307\177.\333n\353\032\244z|\312\336'5\352;"
+	.ascii	"/\204\255\367\262u\300\357'euhb\325'S\273cgZ\037\362\r\327\311"
+	.ascii	"\251\262\276\037g\344\356\231v}\037\362\354AL>^e\376(\177\303"
+	.ascii	"\222{\t\357P\355<\275\205\232\345\336y\266\315\256o\242\217\251"
+	.ascii	"O\254Q\372\372\364\350\323D\266\376\223\031\002\355\277\2162"
+	.ascii	"\273\037gd\007\374\377\265\321\304\246\200\337m\030\270\037="
+	.ascii	"\363\316\325\216\022o!\007|\026\244~\236\207\033Ml\361}t\303"
+	.ascii	"uR\f\314\035\21772\217\371<t\207\203\351\246\341\237\314\374"
+	.ascii	"F\3151x\274\221\273c\276\f}\251\341\237X\374Y\214\213tL\370\233"
+	.ascii	"\030\"\312%\341W2X\230\206\204\337\352\256\t\353\225\252\342"
+	.ascii	"\177\332\ta\275RF\370\247XP\204\306-uP\374QtMX\257T\023\277\323"
+	.ascii	"\\\"\023\326+\305\304O\204\005aP\341\242\304?\204\005_4n\221"
+	.ascii	";\342Gb\301\027Y\230\264\020\361\027eAl\202\365@\370\203\300"
+	.ascii	"Ea\275R?\370\205\336\330\352\0260\256\367\355\301\037Tw\007\306"
+	.ascii	"\345\303\377\323\366\365/?\317\032\033\326+\325\310Nm\265+X\257"
+	.ascii	"\024#\373\264\323\016\257$\262+\262\340[\221\202r\352+_\330\021"
+	.ascii	"\321\350\n\331\r\373\254p\211 \373 \013\216\240e\013\336\037"
+	.ascii	";\240\335\342\017>\366>\026\204!\310\024\325c\367\302\2020\262"
+	.ascii	"l\231\223\262\347\271\255\361\201q\275Rv\354wk\325!:\366(\013"
+	.ascii	"\226\320\310\224&\307\316\205\317\246gXZ\330\343X\360\033\253"
+	.ascii	"\310\340\330\263\260`\b\200L%\264\261\273\261\340W\371\002\345"
+	.ascii	"4\202\032\373\032\b\214\212`\\W\330\261x@\204\020\214\353\225"
+	.ascii	"\262\302~\306\202&\254q@\205\335\214\005K\350RC\306>\205\005"
+	.ascii	"K\240\333\302B\n\273\330\212\226z\033\225`}\261\203\251\350#"
+	.ascii	"\344b\357bA\344\373\3624\024\005\315l\233m\240#\321\031\030\327"
+	.ascii	"+\365\3224\313\354Q\330o`\301\024\264ly_\236\206\212if\333,3"
+	.ascii	"3s\223Y\320\205\336\367}_\232f\231]\213\231\005W3B(\247\367\345"
+	.ascii	"i(ff\346&\263\240\013\275\357\373\2764\315:\323\257/\235S\231"
+	.ascii	"F\fQ\372\372\224YtW\351\035\251\036\2372\213\356\263vA\252\307"
+	.ascii	"\247\314\242\373J\303\220\352\361)\267\030\241\364\365)\323\210"
+	.ascii	"\331I_\237\262'}\257\365\211\036\237r\277'\375\233\005Q{\274"
+	.ascii	"\3124\356G\317\274\343d'\313[\250\277\227\244~\236\207[\214\213"
+	.ascii	"\364\365)\267\330\026\351\353Sn\270\346\200\245\021k\321\360"
+	.ascii	"\365)\363\230O\177\265J\215\363\1772\367W\253\3248\376*fw\322"
+	.ascii	"\2742\272R\363\n\306u^\251\270\316+\231+i^\255\234I\363z\304"
+	.ascii	"\2174\257U~\244y\245r\252\346\025\312\227\232\327&Wj^\2018\340"
+	.ascii	"\274\0165\265\371\275:\261\371\243\370\333\374G<\252\371\241"
+	.ascii	"\272\255\371\235\272\255\371\205t\225fO\354\263fG\354+\315~\330"
+	.ascii	"i\315^\330m\315\036\330m\315\016\370\316N\347F\232\235\313;\373"
+	.ascii	"\223\353\354M=\326\355L\256\263/\271\316>\304uv\245^k\366\244"
+	.ascii	"\246\322\355G\357\354<\354\354\257;i\356\252\037in\252S5w\243"
+	.ascii	"\033i\3560\036\325\334S\177\233\233\261\251\315\275\330m\315"
+	.ascii	"\255\330m\315\235(\302\271\301T\340\334\210\256s\177q\235\373"
+	.ascii	"\320unC\327\271\013]\347&T:\367\240\n\347\026\024\341\334\201"
+	.ascii	"\"\234\033\320u\356?\327\271\375\\\347\356{\347\346{\347\336"
+	.ascii	"{\347\366\242tn=\327\271\273\274s\347\271\316-u\235\033O\351"
+	.ascii	"\334w\256s\333)\235\273\316u\356\250\353\334t\256s\317\271\316"
+	.ascii	"\315E\204s\313\271\316\275E\351\334q\256skq\235\033\252t\356"
+	.ascii	",J\347\206s"
+	.ascii	"\235\373M\351\334nJ\347nS:7\233\353\334k\256s\253\275s\247)\235"
+	.ascii	"\033\313;\367\025\245s\243\275s\237)\235\333\212\b\347\256\342"
+	.string	":\267\231\353\334TD8w\231\b\347\236\"\302\271\311\\\347\036s\235[L\351\334R\224\316\035\366\316\r&\302\271\277\336\271\275D8w\227\353\334\\\256so\271\316}\203\353\334Q\\\347\206\342:\267\226\353\334O\\\347\316r\235\033+\205s;q\235\233\211\353\334K\\\347V\342:w\022\327\271\257\\\347\266r\235\033\211\353\334G\\\347~\3128w\225\353\334T2\316=\345:\267\021\031\347\226R:w\224\214sC)\235\373I\306\271\235\\\347n\222q\356\"\256s\023\221qn&\327\271\227d\234{\210\214s+)\235;I\351\334HJ\347>\222qn#\245s\027\31187\221\322\271\205(\235;\210\322\271\201\310\0043\254\232\320\367\226T\033\330?~\346j0\314\307V\373\347\327\350\343\033\016m\360k\257M\b\352j\367\226+\274\350`I\301\247\247&d\330\023\364\2358\230UB\217\036\203P:_\203M$"
+	.ascii	"=\263NX{\267\263\225\302\356\271\272\177\276\201\276\203\262"
+	.ascii	"\370x\365\347;\256:B\373\274\2162?\237\207!\b\243\347\231u\304"
+	.ascii	"\3329f\n.Gh\317\367\242\324\217\340\342\252\310\264\367\002\203"
+	.ascii	"n\236\327\301\3630\022\245/Y\253\205\t\315b\326\3577\024q\247"
+	.ascii	"\254ukck\366w\276\325k\323\320\332*\335p\255,\024,\274k\325\332"
+	.ascii	"\371\354\263\367\370\322\fm\323\2604I\3032\"\257\020\355\214"
+	.ascii	"\n\355LY\026\210l\266-\024,\274\353\361);\237\231\333*\255\331"
+	.ascii	"\017S\315{[E\307\2545c\350:\366\032}\240\242\016\311\342k\310"
+	.ascii	"f\233\357\374\0261\210\332\374\326\250P\347\231u\254\264S\226"
+	.ascii	"*t\320Z2\035,\022\260G\355\230\316\267\234\034\363\231u\324\332"
+	.ascii	"\260\345\f\337W\013\246\303\346\246\003\007\3272\277\341\342"
+	.ascii	"r\236"
+	.string	"Y\007\332r-\267r\276\335\262ti\216!\202\240X\006\236Y'\256\205\242\023m\265\330\250\r\237\001\033\276\277\302jxf\035\271\026K'Z\001\037\226\326IK\303\327@\303w\334\027\217g\326\231k\227\350D%H\322*\321\261\303\323\311\313kw<\217\357 \352\216\357-\301\256\177j\032\301\255\020\004\241\340\360\3453\353\3509\225\264G\226h\202ZE\232F0\353\016\004\301'\035{m\025\225\216\246\031\372Z\251(\304\031\276\013\211\310\360\327:5\251\311\360\035'\270\224#\260eZ\252\030\322.\351\f\026\352\034\036\266\315\262\2019\276\305\004\223\226\232c|P\305Al\221\216X=\234\357\260\306\233\304\226HH\013\275\371\226\373\303\361\314:\213\355\0203\205U\373\243\025\322\231\3524\352Tu\252m\263\255\032\216\357\270\277$\017\376x\2421<s\323\247\005Z\306\370\304A\351k\177Z\237\030\276\335\366\332\370\366\3460"
+	.ascii	"\324\276X{U*\342\215\307\300\267fzc^\364n\310\331\bb\247K\364"
+	.ascii	"\030\027\021ax\033\337\232\345au\311\203\341\333-\356\205\037"
+	.ascii	","
+	.string	"\030\253<\304/f/|C\361\244\244xP\233gn\016\261\205M$1>qUx\204\203lc\215\267\371V\315\256\350\316\256\3067\234\324\317\363\300\321\b\302\002.c|\342\244\354\376\374\020i|\027F\243o]\324m\30637\211\330\275e\214\217\226(\263s\214\365\3224b]#u@]X\275&\222Rs\211H\333\354\321l\3067\342\334\034!\210/\272\216\300J\017E\031\337s\025x\031}\177b\035\314\264\025\370\353\232R\201\277\255%M\363\247\305\301_\224\013\317\334lb\353r$\251\264`\201\211\322\351\t\031f5\243\232F\274\205\\\370\216\366\2271\304/D(@\305\312-\371\262%\256ml\341)\360G5C\254C\303\026\276\017\227&\360d\2634\221$\251\264X\031\302\275\251I\340'\360l\224P\252\220\260aH\340{K)\002W,[\025\341\232Z\024\002\037\201g\003\005\213\006\005!\360\375\205\364"
+	.string	"%\354\025-R\202hg\016\370\007"
+	.string	"\312\275\201\200\rC\252\307\247\016\3703j\30037\231\260f;DI*h\230\006dvna\2514\235\2542F\006\315\204\330)lY3K\253\031e\253e\3007\340Yh\020\265\375\204\254\305\021~X\232\372k\020zAR\222\256X\370\366[\300\263\360\035\310\200\357(R?~\325F\374\343\333\340\3303\355\002^GY\235\337\242\223n\001\017#\361\301,n\321"
+	.string	"\002?\277\302\027\342\027\315\340\237\034\303\330\302\271<\233\244\006\026\335a\302\374\n\337\202\n\370\025\250\234\271\371\325\f\363\026R\3003\245|\302\274\033\001\214z\362\303\005\227w#a\336\271\260\213~p\t\350\301v1\333\f\273\305r5\305\310\232eem\263\337(d\370\344\bx\346\246\225&\232\267P\002\376"
+	.string	"\217\200_\325\202\250=\007\370.\234j\017}~wJ\216(\265\370'\363\227\001\236\271\211\205\325\332!2\221\305>i\2525\331\232nM\267\266\331.\300\033\200C\357\210\265*|\001\276U\353\361\304G\205\357\270\256#M\343\267U\363O\346\250\024\340X&M\350\022\002|\n\004\370\316zB!\216\275j\312Y\261f\003x\024\006\360\035\245I"
+	.string	"s\354\263\031\255:\341\005p\302w\226\037\221"
+	.string	"<s\323\2165\322\304\233\211b\245\232yz\315\275\275\266\331\025"
+	.string	"\037"
+	.string	""
+	.ascii	"|\373-Q5\215\237\322\035\006\377d\256\306\350c\235\232\2401\276"
+	.ascii	"\273\032M\370c\231\226L\370\376\332\233\226\360\314\315@6\211"
+	.ascii	")\001\037{\304\"5\007\233\205\315\303\346a\t\337_{\212R\3151"
+	.ascii	"X\354\035\0029s3\261\271\3503w\001\tSVH\017\022\206F\210\353"
+	.ascii	"\254\252\023M\f\024\30637\033Y\037BN\242\232F\030\337\207,\320"
+	.ascii	"\213\257\271b\332s\263\200\203\230\b\317\334\254\262=L!\215B"
+	.ascii	"\206\"|\037VC\b\003\201gm<R\003\341;N\352\347y\030?\370\025_"
+	.ascii	"\036\370\254\212f\036|C\245~\236\247\253\003\240\025\221\251"
+	.ascii	"K/\333\027\362\035\274L\243!\007[B\204|\013R?\317\263\027e\305"
+	.ascii	"?9\311E\305C=\3537\001\213\356iM\367T\252A,\356=I{\372\036\025"
+	.ascii	"\202\352KP\005\377dO\301]\264\254}\t\241\240\253\315\320\326"
+	.ascii	"y~\210\371\241\336\243\246\377Pk\337\336\323\006>\326\300e\007"
+	.ascii	"\314\316\240\025\320\371\003\351\344$\252\351\f~\203o\003\375"
+	.ascii	"4\370\232w\361\031|\367\370\342\343U~\247w\361%V\025\377t\036"
+	.ascii	"\363i\007\250\324\021\246\370*\366\351;pCY\337^\326;\275\323"
+	.ascii	"/\367<x%\002Q\300\242=J\252W\350\324\353\323\247\026C\253\227"
+	.ascii	"*'\321\212\026y5M\030<\2633\310\212\267D\256w;VN\242\025*\264"
+	.ascii	"\315\266f\030|CW\2725\252\202\221\023\t\251m\226\305\257\330"
+	.ascii	"#\"}'\370''{\206\326\223^GY\335\336\322\342\236\022\212\013\224"
+	.ascii	"V\271.[\342Z\265\013\276\343\016i\236\331\271\264fY\036\221\324"
+	.ascii	"\356\340\336\020i\276\335\n-`[\003SKc\325,\370\336\262[\201\266"
+	.ascii	"LaEd=sj\035\221\324\270\254TY\021\255\240i-\2032\205\214\215"
+	.ascii	"V\360\3755\247\342\231\235O\253\224\345\021I\r+\354k\005s\241"
+	.ascii	"m\226\215\n\031\312\001\036\221\235\370'\177\317\264*\242^\342"
+	.ascii	"\234v\240\250\360\002]\263\332\213<\2657u3Y\213Rt\203\013k\230"
+	.ascii	"(\346\235"
+	.ascii	"\033\326(\316(\326\305\323\013\362\323Z\2418\215P9\237O\027X"
+	.ascii	"8\004\001\205\352\b\326\202\222\242\256R\274?Q\360)\236\2156"
+	.ascii	"\265\207>/p&\036\350\231\226\002/n;\\\024x\021\223\276^\302$"
+	.ascii	"\300\341\023\\9\225\254K&hB\301dMr\265\304\n\211\036\212\357"
+	.ascii	"\247\245\023\317\354t\262V-g\370\262V*\247\026[\226f\005\005"
+	.ascii	"6e\344\204\222\211gvFY\241\226lYZ\325\223\323\212h\342;\313\321"
+	.ascii	"\274 I\360\314\316\255\225\210\263\213-K\223\372\200i\310\272"
+	.ascii	"D\243m\366\003g^\002f\347\327\232\344\024C\276\357\317\007\274"
+	.ascii	"\002\251\201\317I\206\234y\025WR:i-\353]4\354\201\3223\363O\366"
+	.ascii	"\244F\241O\314\n\033\211u\250\235\251\r\200\366\025\304&\263"
+	.ascii	"6\375:\364CC\275\016\371\345U\245C\357>JKGUB\242\356\026\t{J"
+	.ascii	"\374\2235\3402b\005\362\254\227\b\036\032\322\353\342\024\230"
+	.ascii	"w\245\346\030=g\205O)$V \357J}\242-hW0\277\002\031\322\036\252"
+	.ascii	"\274!\226\371\260\002\033\261\222}\211\327Q\326\227\304\316\260"
+	.ascii	"\225\310)\306v\251\343z\337\237\017\2048\311b~\242\212\357\373"
+	.ascii	"\003d\r\342,[{I\263\236d\3236\273\222}\210+)=^\345\006\336\026"
+	.ascii	"\327\246\367\245v!i\025\262"
+	.string	"Qa\365\276?-\344I\3144\034\255?\234d\030X\275\357O\320\352\303Y\266\2329\255\264V\332f\327\246wD\241!L\335@\336\022\271\3124\261\211\fR#\027\227\336\305\022\357G\3151\372\362\032=\b\005\023J<\013}ySj;P\237p\037\355=\272\235\b\211\032[$\\}h\264T\\\2109\205\265\307\211\326\312\340\331\001-\202\255\357\312\343\304\242\346dck\233u\2721\r\244\324\021\315\034_\006<\001\244\020\210S?\332]\353\021fI\357\360\365)\223x\367\0216`\270ac\255!\007\216g\033-\2266v\314\270q\201\223\343\346&\007\215\021;nf\274\016\233\033/\334\330\201cS\343\006\007\016697X\200\341\306\01389N\330\241#\207\f\017\354\260\211\201\306\214\025pTX\356\320\221c\005\030pn\340\334\230qc\243C\3116Z,w\340\330\334\354X\362\300@\215\031&l`\300\231\301"
+	.ascii	"\f\324\230\201\254\241\302\016\034\033\234\0317:ld\210\261\331"
+	.ascii	"1\243\306\215\03283h$\331F\213\245M\215\03472h\350pAC\206\306"
+	.ascii	"\214\233\267!\307\005\336\346f\206\216\027\330\0358<r\234\200"
+	.ascii	"\303\006\007g\206\r\032\r\260\215\026\313\0344\350\260Y\272\330"
+	.ascii	"a\003\206\0338^ \3016Z\330\240\303\205\r:@\330`S\003\347\206"
+	.ascii	"\214\366F\333\360\3001\203\006\326&\347\006\0133v\314\250\201"
+	.ascii	"\314\201#C\206\032\330\0353p<N\016\034\277\003\307\214\247\241"
+	.ascii	"c\371\334\001\0075<\320\240\003\0216h\361a\005\026\020P\343\206"
+	.ascii	"F\3134Z\310\260\274\221A\343\005\0274^p\201sc\306\215\013\032"
+	.ascii	":\226.Z\204\340\0342\330\350p\261#G\016\035.b\230\231\307z\372"
+	.ascii	"\253\270\341\032Yht\026\304\326@\367N\333\212\235\274+\354\n"
+	.ascii	"b{`\247wZ\177\177\350\375}\336\367}\227\377d\017\204fX\031\377"
+	.ascii	"\350%\303z\324]\375\241\256~\203y\177\222\024jO\372\006\363\""
+	.ascii	"\314z|\301j\226\310T\365\335\211\016\306w'kQw\365W\306\021S\246"
+	.ascii	"\354\244o2qG\013\003+#I09W*\222_\222\2109TL\332f\331/\337\210"
+	.ascii	"\337A\324/~S\2053\374\323\235`\365\03265U\347\036\232\347Z\026"
+	.ascii	"\315I\302\034$\336B\234\024L\016\346\\\345(\311a\322\034\330"
+	.ascii	"6\313\234\343$'\253G\003yS\272[4\204"
+	.string	"\322\034C\206\177r\r\321\"\024\316Z\365J\266D*\216\225\352\233\372C\324\357'kU\265\227mS\177\255z\026\352W\375\001\257\212D}?\322\034\243\007\355\353hJ\216C\255\244\237\336\341w4\3140Jr\257\r4\374\266\373*\334Jv)\354\"\354J\342-\t\277\341\266\244\317\234\363\225\254cB\007\277\273\252Q\302\222s9bI.54\311!\233\3413\253j\221\251E\035\341H\240]\255\276\2374Y\275+\351\023=\336\202\317\234c\226c\305[h\265\372\365\310\267\340\267\320 j\225\310\221w&\353\221\357\247&\375\001\255\252d\026%L\326M_\025\211\352\375H\237\350\371\225\352=0\251\245\003\277m\354\341\205\343\237\353Q7\340\261-h=\351\033\360\037\332\343\315'\361\330\313\326\255\272\205\253\366\320G=\3644\252\335]\f\377\344d\221\033+\324\263Iv\260\350n\374\241\306\252\306w\252\277!E\270`"
+	.ascii	"\352\235\252\361W4*T\372\223|[V\220\203\226t\313\301b\302\n/"
+	.ascii	"\331\246\366\347U\355\241\217\032'}\355\246\204x\271!\346\247"
+	.ascii	"\226T[\316\244\371Q\301\2524\307\260\261\325\307\226D\003\343"
+	.ascii	"rf\205\357\273\357[\304-\204r[\032\206\314\3367\337\317\230\365"
+	.ascii	"\360\362\361*\347\034\321}\357}\t\265\036P>\311)\311\261\244"
+	.ascii	"XX\222\254\375\351\235\356[0>^\345dY\267\227\367'\017W\322\260"
+	.ascii	"\260\202\315\320\026\355\214\004\242B\302E\302\036\275o/\177"
+	.ascii	"\204\006Q\365\276%B\215\222>s\216[2l\031s\030\206k\013\263\016"
+	.ascii	"W\022,\007\256\225\301\023\364\251Kz%\277r\240q9rsm\027-l\205"
+	.ascii	"w\213\204\355\256\005q\tY<\314\373\326\322'z\276\363\250O0\374"
+	.ascii	"\223=\364L\333\322\327Q\026\2456\351xI\037\006\221\272\246\241"
+	.ascii	".\335\275@E\302\213&\241h\005\342}\333Q\215\356\354\222XN\216"
+	.ascii	"\210w\337\032U\355\360\222K\226J\032\355\276\017\033\353\362"
+	.ascii	"\222VL$zu\337\321iT/YE\325\006F\277\355\246\213t\317\234\263"
+	.ascii	"\227\224Z\246\260JB%\243r\372r\376r\002s\002\351\276\343\246"
+	.ascii	"\211s6\377\034L6\025\211\316}\317E?\3740\253\241\234\343R\230"
+	.ascii	"\034\242\304%N\3560y\224\303H\356\273\013\272\0051)$H\273\345"
+	.ascii	"\033\n\367\2014J\243\203[\\b\362\007\323\207Z\334wb\230\226\305"
+	.ascii	"$\320\317Q\3137\342\027\364\231s\246I\236\245\211\344\013\375"
+	.ascii	"\206N\273.\320\300V\226Fd\230i\026"
+	.string	"-\270g\316\251\"\025\231&\022\341\276\303\244~\246Y3\220Qo<\310\303\245\341\333\267\333\223\233\017rP0\320\355;\252\251\r\b\371\347\007m\373&B\204-\b\271\307\364\022(d\310\366\0355]Z\373\201\314[\316X\341!\245\314\241 L\"\"\304\265o\267iR\231\005\376\311\\U3B\326-%\340\243CF\231HJ\314\245%\265\357-F0c\3151d\374\223\331.\215\bRnK \226\3574,\337b\321+MHh\026\264\357+h\214sgOH7\036)\220l\3106f\224\021&\025Uk\345\373\354;\210jE.\254i\030\343*\360\3177&\336U\236\231\211\204yU\345O\3740\2661\2250\212\271W\3230\206\271p\345\235\005\211v\306\343\003+\235\005i\306\f{\200\357}{Z\210\n\217\025Ve]\314t\302\314\352c\324j\246V\313H)H1\246V\024\346\326V\333l\b\253/Y\024"
+	.ascii	"\213b\222\026\324\302?\221X\375\344\325\325\305\330\264uC\027"
+	.ascii	"#\021\237c\"\232@\207^\266^\370\335\244\254\217\214\361\330x"
+	.ascii	"\344$\201\304g\344\023\244\026\217/fXX\333l\211>F\245\236\202"
+	.ascii	"\001F\200G\353\211\214HfN\032\251|"
+	.string	"\2331\241\362\214E\322\327;4\223\254ef\2261\315\252\2105\310+\253Ff\306"
+	.ascii	"y\204\207\022Y\205|2\255\2401\261`i\233\235B\300\013;Q1\021L"
+	.ascii	"\342\227\303\304\357*e\357\211e\205\210\337gS\336\021\277\003"
+	.ascii	"\247\274\tv\337W\310\336\017\277\003\311\336\204h\341wZ\341\263"
+	.ascii	"0\367@M\223(\367\200\1772C\307\220MjG\305n\261\3571$\221%Sm\347"
+	.ascii	")\366J8)\317\314dC.1\207\350I\371\246[\230\033\022\211yd\024"
+	.ascii	"&\006\006\207\024\022\004\310\3277\330W\230\32733"
+	.string	"\241\310\037<\\>f\034\322\007S\016\202\2407\353\372\366\372\016\242v=\217/\2569\344\317\022\002>d\017\322\207\031\265c\342\341\265\315z\243\220as\3752\321\001[\325n\354e\3337|o}\0071\205\271!J\003\2420:\224\357(\211P\022\263X\370'\263\226\326\303\220\372\211:l\232\304\247;\006$&\3451\247\211H[\332\331\272\336E\302\005<\321;\036\032>\371\216C\314\332;\016\nf}\303a=3\263\357\370\267\254\340\330w\364c\3761\003\231\203\314A\254o1\251\237\303\302\025\376\311\275\263\325\266\023\017rf\346!\023\321[\250\235<\f)\237\347\261s\274\2469\234S\300\341\341\233\37783s\2219=tK\200\222\037\223w%)\223\237\271:\374r\3224\207]\bX\362w3m+\371^\362\035\224\024e6*\371\022}L=^\325b\031\201\030\017\340MI\336\233\346\222dU\233\3460\312"
+	.string	"\257\177Q3\264e\326\341\321\361\3719$R\200\225\312\325\257T\342\256\016\227\3024\315\241\322\235\n\377d\0062\f2\234\246\360\317\347j_B\032\376V\267\325\373\322\021\256\255~\246o\261\247i\f\023\357\b`x\330H\236Y\347\307\321mylCD\362\355Vxd\350\250\266L\301w\304rL\323\tB\244cdt\344;\316\320\256\237\317\254\203t<[\036\255\350=\277\243\206t\3151P0\324RUV\365I\350"
+	.string	"\250\224\216d^jT\337qR\246\334\214,\035\301\226R\314\214|C\273\244\f\305\004\340!,\212\310\361\206)\210Q\337nZP_OM\307,f\0256\372\364\375\325\304\211\353\006(ZMO\307\253+M\337\320#E\262\210D\035\253\226kN\275\031\"\337pG#L\206QKF\216Q\3137\247\336\314\3227\364\3504\304\320\251\b\223\341\020C%\277\2461D:a\220\332J\317\254C\345\214SR\032\f\363T\034\f@\022\222\243\321\261(\251\020\351\352\030\344\b\004\311\256\237a\336"
+	.string	"\340@\364H\311\321\007\235S\317D\033=\372\236;\002\031\275\211\276A\271\"&G\237;\247\236\211\306\242o\270\343K\364&\342\2048i\251\215\307\250\220\357)4\3103\353d\265\214\314\305 \337\207\203p1X7 Z-\"\337\332\b\344[\313pHL\350\231u\242\264\204\314\357\322\004t\352\005\210\342\250dc\330\314\312Nc-\2122h\f\"\232\231a\002\n\003\031"
+	.string	"\f\005\342D\021\344\030\372\024"
+	.string	"\030_\226^\200B\224\211\205I\234BQ\024R$\002\220\001\020\220\320"
+	.string	"\306G\254\224p\332\177\371\n\275\250\343\334_j\221\034\361\371\027\262\366\247\324%\201f\035\221\022\330\023\r\t\351\246\331\274\322|\262\210Q\005\202\356\333\317\233W\245\373\2525ICw\246\352\334\3633\220\032\216&;*\225\311\266y\231\232\236-\207\313K\002\r#\3773\372\311\235\350\366N-\273\344\030\276\267\370\326\324\306\3554\3048\021\343\217\322\271U@\r\t\377\233a\333\337\250\242\246\375\244\025c\270]\302\303\255i\350\024\271=\274\377c<\035C\361\332\004\240\\\312\273\233g\026\271h\223\"\027\246E\201\327\303l\374c\222dc\355\200\241]sU\252B\377sqx8B\036\256"
+	.string	"\271\f9\252b\246-\027\303X\2759\rE5\206Y\216\314\035\246N\240\204[B\237\254\240;\227\b\r<\216\\wT\363O\013\246\375\317\375\225`\313E\341\035{\305\206z\007r\216\272\314\305G\256\233\021\277\275\271w\245\366\337\205\261\"\022\275&q\252\277N\033\214\003\211G\267Y\261\324\206\304\242\024y\311\313\244\213\345L\264\320\206\377r\246\013l\034~\360\3229\247\375\305\253}\"\250\273p!\243\306Ye\223\022\261\354\026\266l\353\302\025\300\217hj}CR\303\0166\024\277\320B\217h\177F\2757]h;0\310\261\235\262r\\\351\323\023\275\207\231\241g\304\230\326:\247\303]o\376gG\325=\bdb\232l\203\262(\361\202{<$\005Y]\350\342\003\242\023\314"
+	.string	"j\313\013J)\327Ebt\005\305\220\006u(\314\305B:\260\354\327\320%\3568_5\212E?w`1'\271up\222g\n\021\030NH\024GC9\334\370\035\337\032\177$*\240i\251\317o\246\230IF\227i\305\3651\333F\224\236\003\356<\020_\367"
+	.ascii	"\021\213B\364%\370\252\377^ey\310^\214\3303\025\277\017\003\300"
+	.ascii	"+f\025\341\025Q\261\366\261\311\320\245\316\020\316\367G'"
+	.string	"\324\352\374\333\205\td\361Q\262B\265\244Y\222\213\325@}R\322\210\r\306\260\032\302\354\263\017\211@a\341\266\365\f\344\201`\272\365\035\351\210YZ\315\223@S8\2478\214\226\307\370Q\361\375\203\324_u\343+\304\336oC\2602`.b\017\355\024\301y,9\007f`Z\342%\261\221\231\361\300\243'0?\024\365\246a\253\257\240\265;6\354-\353\354\314\203\247=v\006\336t\247\276\262$\320\034m\240\214\271!\005\\\262\250\311\276a\251\227\303}lR\004\234\2326\250\306F[t\0173\315\230\235&>\255E\024o\374?\277\300\337\314v\365\253\366\225d\005V0\017\341\b\267&\200\373\264\225\241\212\311\2756\204\223f$\037\365\272\207\300yS\f.\006\360\032\357\301\367\261c\013\266Pj\331\204\242L\361^^\267.\371\372\326\365K\002\220\035\257f\203\215\336!\233}\25493l\372\366\022Z\217\350Q!\267"
+	.ascii	"\202\270\313\254Z\037b\376\336\360Y\245\364\272\253\f\265"
+	.string	" \322\245h\300\3161\214\r\244\277\351\316\t\f+\030\343YF/\300\340\273$5f\341\323\2271\344i8o|\333\232Fl^V`\226\366U7\276Z\375,\266\336\352\305\362\233[E]8\013# A\205\373\030\024HC&\273L9\232\303\034\351\337A\316\2252N\342\363\026L\311\177\365Pa\241D\254j\233\247J\303\215\033S(?u\033\362x\373\302z[\221\315\357\272\221M\013\177]F8\274\377by\363\320\256\310!\207\364`\326\276\341\336\262(V\002\202\352\333 ,\352Eor}O~.\252\240J\017\004\272\221\215\336B\203T\313:\211\224L)\320\355k\234\355a\032\323\215C\201\246\250\332\177\207h\301\027\226\306b\222CIzZ\2347\315\275\347\2562\246\244\364\316H\320\024\322p\261c%\367dt\363\330h\360\304Z\023Tu\221M\303\236INP\0251z\237U\213\024\203\276\031\376\006\027("
+	.string	"\352$\023\301\233\274\3350z\303\247\326\236\214"
+	.string	"H\346\335\325\207\265\030;\275\320\020<Or\333\244\242\271\202{8\304Q\331\265"
+	.string	"v\331A\330_1\206\224\322R\355)<\365|\356\276Vz\371\310~\035\364\007\205\006\257"
+	.ascii	"\225\304o\303.\305\334[\255{\315\233\231\311C\202<\027\332\235"
+	.ascii	"\001\254\333\200\"\244\013.\224\300`^"
+	.ascii	"7\232\372\342\374\" \342\225\236]I\255\206\267e@\357\361\346"
+	.ascii	"\215\3642\030-\204\201\324\304\324\277\002b\337\2764\352\243"
+	.ascii	"+\263(\276M\321\363ni[\261\"\315\f\266hb\212\351\223\016E2&\306"
+	.ascii	"\325\324\"(\233xA)"
+	.string	"\310\247\250a4\n\367_I\020,+\311\206\336\233Q\334\351\246\032#\245;h\265\257\242\324\300o\216R\311.\r\357\235\276\267\260\334\356M%\222\300\341o>\307\026\256\372)3E\217\0257\362\234\372\216,f`\301\004\n\307\217\235\323u\355\365\370tZ\322#\335\353S\367\373\324D\307\007\262\344Y\361\034\f\003|\236,\341W\373\\\032\007\271\361\214^\2251\224\225v;G\002\2501\240!\251\323w\205\350\312\271\022\373,%\312\347U\004\026N\346\261\301\224\205\263!\364c\r\310S\262\301fC\275^*\351G\272\213\213\241\354\240\301\016y\356\"\037\237\0347\263\331\271\206\310\220G\234\274!B\314\327\271\357\034z!g\265\031\344\305\250@\243\316'))\265\016\b,\002\t\303#_\004x\274\364\334\034\252\022z\271\325\275 x>\220\251\2607\252&\253\304\371\340\231\240\246\215\003\345\216\0347\330\272\252\227\357\371z"
+	.string	"X\325w\256\0362lS\317X\256G\274\206\265\364\021\246\261q\316\025|\254\007\265`\354\333\364\347%4\225\027iw\332\271\034\232\273\021\222p\"(+\3662\275\353\r\037L:*$L\336L\217\345J1o\204M\365\235'H\300\2436\254\373\302\260\007h\311\032!\372\341\037\020(\240m,\367FF\nOb\217Mi^\315oT\346\345\377\3661\r\210-uUT\022\221P\270\230\227]\346Et\266\373\261?\265\310!l\375\354\346\275w\2009\235\r\031Q!wP?y\337\370\030*\345c\b7\215\207\t\032A\215\254\025u\222\023\374s\316\335\020\237\233\305"
+	.string	"1\0033\t\301\211[\343\374\342\304\270\026"
+	.ascii	"\302\234\0039\030\023\032A#&,\321\265\337\2155^\203\t\315\366"
+	.ascii	"\0354\236\020CBQ\027\340M\355a\267\356\0317r2\250#KU\314\314"
+	.ascii	"N'\221\026\325|\255-\205\275\263ylP\033\024\032#v\214\r\306\376"
+	.ascii	"\371\240l\\W\345F\004P\305\307\343P\375Uul!(\016L\036\216R\003"
+	.ascii	"+\267rk\234\241K\\\231m\372\305A\251 N\362<tm\005\232\245Z\""
+	.ascii	"\2316\375\303\207f\024\037@\344\005\373\224\271\250\215P8\273"
+	.ascii	"\204\223\375\344za5J6\254\017\247\370\376V?\251\004\343.\221"
+	.ascii	"\342\336\037\234?a\"{\215\2542Ok\r\fv\033\263\223\017\207y\332"
+	.ascii	"p J\226\024\223\220y\363\306"
+	.string	"\346<\255@\256x:\303\221\004`\215y\007\301g\016r8\212\315pe3\302\230!\026\377\276B\241\n\275\254k1\036K\205\013\317\370G\32102K\310IjDPi\201vWr\375s\022\t\246e\211\201\212\266p\t\344\204\026\0134\"\357\207'\246\203=\237\352\262\256\332\037\331S\337\215\357\220\254d/b\204\026(\232gJ1}r-\222\035\330E\030=o\214b\177\t\033\326\314h\210\217\021\2538\017\006\326\031\332\301\272\355\350\347\2463\363c]2\276\266T\252%\2371\304T\276f\315\213\203\"\302Qr\027\362\276 \017\3030\224w\226\"\"4\220I\3071#\354\"Z\333\243-\253g\205\331u\2568\200\367>\371;\231\264\306?%$\255vJO\205]U!X\026\332\030;\330\201\311\036E\221\2050\207\002V7\376\006\335\007/ymy\334\215\233(\215d\274;\006Q!\224'\226\330\361It\326"
+	.string	"\n\024%\240\031\244\353nNG$:\276\006O\245H\314`\205\f\034\027T\035\365 &\271\240\355`\3740S\230\347\205\261\332>\1771\262\272B\036\004\034*_\377\237\t\332G\227\006\251\277e\031R\003\215|\037\221@n\274W\b\032`J\032\210\030\243\006\267p\0300\302\326f\\\007\323\341\312>\217\215;\020\346\247\215^j\220\004\320\263"
+	.string	"\221z \274\036d"
+	.ascii	"\373\341\220\207TM7\347\355#:\273\362\324\3448-\305\345\311\300"
+	.ascii	"\246\031%\335&%kL\223JV\364\332'U\226#6\300B\256<U\222\343\021"
+	.ascii	"\320\357/\327\005R\332\233\231\003\235Y\332\332\350'\214\234"
+	.ascii	"\021t\003\3206\262+\347i\204\217\317\271X"
+	.string	"\257\313\256n|\233U\256\025\335V\342\347\322\212\367\004\177\005\351U\006W\023\362\037\310\300zY\320\033\253\205#\377\255\370ux\261]2\036\255\373\354\312\222d\357\2143\200\250\252\302\2410\2711\035\016/\"\027t\314~o,\004G\255\225\034\263\323\324\323\0333\272\004'.X\243i%R\327s\356\220\rD\277uFeh\222\013\237\315#.\"|i\302\246TZ\351\264\013m\364n\017qo\334o\2045>|\300\267\0370\003`\345\211\tQ\002\031\262f\246|<\310\352\023\357\253\304i\226W\212\307\321\217\260\021\247V\376\203\253_XS\026\261\n\326\004s-b\235\2345\344\323\033e3\274e\242\3033n\217\355@\025\272$\370\025\240\324\345|W\222\267\202}\355/Y\003\326b\250.\314y|\366\364]\212\270\314\3617\247\355\335\334\244\344W\205\350|\341Y\265\247\354^=\311\314<\020\363\313\304\336\0249\341"
+	.ascii	"\300\363\210\276s\333\b\032\2614\254\200\205~(\247t&\245\200"
+	.ascii	"\372*a8\247\b-\257\177\035\003\216{SZ\366\276G\245\221\210\024"
+	.ascii	"\fl\247\034QAM\n\247\200\353y\r\302\207\271Y\013\330D\357\212"
+	.string	"\325\257\370\201\007\217B\213m\2705y\362\006\312\342\313\020qD\356\326\231+\316\2055\263\022\f\257\021\022\357\206\352\004\274g\201\307G\214%\201\372\311\323i\335\364\225\023\307]\227\303!\210\233\217\222\216c\240\303\217.\354G\377\354\001w\227O\336\304\202\301\241\f\\\2745Q\345\bB\233%I-\326\177\363\2714z\204\232\245@\355\027\315-|%{\306PT\242\257\354\330\255\267\327\261\310\216\301i8\351\350\243\303<\374\343\225\244lx\361\314T9*m\031\257!Rw\t\207qN\241\372J\022T`H\261\022\231\001\361a\300Z\213B2\315\214\032\214\233[\367\217\346\322\343\210zB\022\352.\017=F\356\365\035\251n>\243\346\303\357\344n\210\371\205\204?\003\327\361\223\322\323\231~K)\353[\3741\336\244\"~s\263\222w\331`\301>\262\023\367\370\200+\272\f\226n\201\245-r\305\360s<5\024w\354\026"
+	.string	"\025W\231\245]\177\251a*\276\234\322\245f\211\230*oPp\037\372\346x\341x\362k\216\313\344\360\020,.YrS\246\222h\253%\020E\363\365\242\031\262oa~\226\034\030\002\253P\301\266i"
+	.string	"\367'\247\352Y\250\316\322>\222St\323\311|yF\230\364;\002\020\315z\273%o\362\345,1f\013\257\025*\353\240\242?@\373&\3410~\223@\036\376\034\315\250\261\270\007\215G\r5\237h\013\332=\t\214\216v\353K\205W\214$"
+	.string	"\264\341G%\r\301\\\240\302b\304\3608\204m\007\233\0011\337\324\"\263p\370-C\334l\321a\303\271\262\272\334\232\340\300\334\373D\\\336t\036\310\311+I\231\220H\032~m+\247\214mZ\":\207\317]\263\305\220\"5Jv\213\003\232\331^H\270\234wdF\037\376\252\334\353V\365m\254z\236G@G\031LW\030\204\362\217\323"
+	.string	"\355M\006L\220\273\340\255>i\030\267-"
+	.ascii	"\216\300\007qs\251\027\201r\202=\340\236\207\262\342\270b\316"
+	.ascii	"\213\367\203\250\327\267\013\222\343\273x\341T\\\250\377o\303"
+	.ascii	"u\236\332zGI\337T\263\004\310\273\266uYaF\223\370\320\335\030"
+	.ascii	"%\273\276Io\266\0134\326<\251\303c9\240L\374\001\247B+I\303\344"
+	.ascii	"\274\276\363\344\023\225D\214S\002\263\221n\346\017m\t+\335\240"
+	.ascii	"\364\250)\274\272\225\232\266\020\276\300\"\260\0277\372\200"
+	.ascii	"\001\316\301\353t\004\026\304\345^ 8\005\033\004\346\016\221"
+	.ascii	"\207#\312\312\232Q4bD\344xx\013R02\241\367c\021\030\337\344V"
+	.ascii	"\232\005\r\303\340\240\305\227a\335!\263x\301\373d\0323\256\242"
+	.ascii	"\247\350=zT\325^\274\206\2455\363b\021ZG\274T\317\250\267\364"
+	.ascii	"\200\241\307E\341\324Zo\226\254\255\177TZ\354H\201\001\"\367"
+	.ascii	":\244J7"
+	.string	"\335\b\016B\3343\t\363\350\336G\311\215\021\306BC\203\330\312\265\220N\220a9\017\"\371\344\216\037P{\375\207\n/\355(\341\336\215\320r\254k7\244\337\344\370|\b\237\2458\2152\276UW\301\277\207QD\371\362\362\362:y?~kg_\374\201v\007\350\3746\001\253\020\223\372\357\230\305\364\201_+\236X\365*\235\2328J\256z\224\330\322<\301Pm.\374\335\264B\352\357\342_L\225\261\252\304\257\234\261\231D\0340E;\237F\217\035\3143\272!\3651Ph]\3154\305\032\223aX<\201 \241\224\242w\335IM\351\"\"\325Yg\3441r\263\224\276\330\311\204\242\361 \262\275y\026\200\314\332r\323\342:\271\227\306Q\264H\345\027=d\275\264O\331\347\005\370\242\334I\226m\025]\253<Z=\306\231|v\312\2639\327\r\301h\266\267\001f\216\352\035\307FG_)1\230y\007\230.\033\337\344"
+	.ascii	"\237\256\016C2ZV\346\321}n 5\306\241SF\304\237\257x\375$*\023"
+	.ascii	"k\217\201\013\257\220\330=W\205\364\306`\310P\274>\354\325\226"
+	.ascii	"P\023\243c\211\205\b!\207\031\013\004\231\243\005-\21083l[\271"
+	.ascii	"\261G?qi\226\3142\344\225\300>.\220\336WA\027&v^\250\243\356"
+	.ascii	"\005s\215b\201q\030\363\316:\315\214\321\312]\361\005'\374G\246"
+	.ascii	"\350g\213\211\215\277\370\365\006\236\207n\253WVM\215\366%\036"
+	.ascii	"\214b\031iK_\277h\263DF'ZG\372\310\035\276\204\271\252\233{\036"
+	.ascii	"\335\177\241\207mA\235P\216\275\\\307\301\330:\337\201\273\032"
+	.ascii	"\222\205\236\262Y%\264\314'\216\2020\372<eMa)\224\322\320+"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.162.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`{\f\2459"
+	.string	"\272]\334\024CP\236J:{\215\211a6^\037\2673\333\370\216L}\fXx\301l)\223Q\326\257c\233\261V\307;\360\330G\r\342\374\006"
+	.ascii	"\b\032@\034#\342\300<\344\311.\320/6\320\252\265\265F\b!d\357"
+	.ascii	"$\0034\001%\001>\001\375\346\351\372\370T\312\215L\363\241yL"
+	.ascii	"\b03)O\354S\251\267\271\346K\312bf\345\312v\004\360\315\004\373"
+	.ascii	"\024\355\266\352\313\365Qj\251t19\236\277\362\201\260Q\326\021"
+	.ascii	"\346\314t\360\264A\264T\021%\364\313\343\254\016f\007\001\242"
+	.ascii	"\234\025G\244\211}\332LV\352\207\022\276\335\357r8\2533}t\232"
+	.ascii	"\363\322\316]\316L\245^\300>%\272[\376f\325\355\b-\344\027\004"
+	.ascii	"%\035W\030\303\2343S\322\215\324\247\350\003\250O\361Z\377(\363"
+	.ascii	"\235\336\366BA@Gc\221]\325t\b\305\267\355_]hm\002\242\205\371"
+	.ascii	"vx\366U\366 \271\263\202a]w\200\344\270\035\373^L\003\373\273"
+	.ascii	"cDrD5j\343k\3623/#\270xd\331\331\265\t\214\214\333\331\227\221"
+	.ascii	"\257h\222\037 \327\003\275\214\240Hhf\207G%\327U\321\244\234"
+	.ascii	"\263\220r\013M\272]\312\254\233\022\271\205}\b\335\300\005\013"
+	.ascii	"\333\003\275\314P\374E\256\314Q\271u\321\265\211\356\350\224"
+	.ascii	"\271\276\2707Me\330\261Q\2115\226D%\3129\377\314\213\f\275kS"
+	.ascii	"\316\271oR\371\365&z\3671tw\262\373\350$N\367\311\213W\320\275"
+	.ascii	"\250\251\006w\300']\335\304c6\375@\feR\324\364\327\364 \313\340"
+	.ascii	"\313+\260:)y\351\327O\323\203\250\035aY\022\005\367\241>\275"
+	.ascii	"\311\314\340g\272{\220\315\371\352e=x\255b\026\3007,y\231\031"
+	.ascii	"<E\302IZ\367O#\341\343s\375A\336g\337%S\032,1\013\024\272\bp"
+	.ascii	"wT\214\373d_l\231\205\257\372r7\346\215\001\036\026\346\213\330"
+	.ascii	"\315\304\2728\255\373\370\371|>\033\243u\367m\016g\376H\007\363"
+	.ascii	"#\350\333\005\b|\356}t\274=`\275md\274-`\275\035\200\275\r`\275"
+	.ascii	"]\264\336&Zo\017\261\267\205\212\267\203\330\333@\305\333G\366"
+	.ascii	"\266\261x\273\310\336f\327\333\353z[]o\247\353mt\275\215\327"
+	.ascii	"\333\027\337~\207\022}Xm\302(\235\370\r3\023y\372\311\200i^\224"
+	.ascii	"\317]j\256\257\217RM;){x\317i\230\207\367\234y\252\356\354\337"
+	.ascii	"\341='a\331[\316\371hWw\004\022\304JP\t\337\333U\275\256\371"
+	.ascii	"FddX\004,2.-JO\033\206\023\245\376\230\367I\026_\317m\256]I\374"
+	.ascii	"]\253\002\330\200\257\255\317x\325\027y\367\004k\376\364\237"
+	.ascii	"\306'@\323\247\273\0073\314\3551\\1z\377P)s\203o\355{Qs\315,"
+	.ascii	"0\377\375r\177\333\032\031\340\325M,v\323\217s\316W,Nk\256\211"
+	.ascii	"\251\270\373\303\r\r\371\370\3549\020F\305\252\036=\300=\275"
+	.ascii	"\304\024w\2078\236<z\205w\f8S\254\226\301\273\313\303C\fDq\267"
+	.ascii	"\210\017\222xQ\021'aY\205\343\325)\241\032y\251\213\373\2730"
+	.ascii	"\347tL\364\211\024W\205\372\264@\235d!\362>Q\254\302\375t\377"
+	.ascii	"\220\274+\314CB\244\225\263\273\013xni\031\242\007\317\021\276"
+	.ascii	"\335\223\220\027Q\216\332a\2071p\205k\372\340\215\242\016~t"
+	.string	"\204\251\342\370\2508\255-\034\031z\360b\023w5\001\374\341\250\217\232\037\001\334\204\274\210/\324\363\243KqZ\377]\250\347\347\034\302h\215\361\305?\213\213\223u\373<8\234\025l\316Y\027\372n\376\206\005z'O\273\205\013\365\311\247}\027x)N\036\362>\373r\324\376\372\220\255\216\033\324\301\307\256\032\232\246\332\031g\217\346c\267N\346\032\226\310\213\330E/\002-c\211\251\252*\301\214\027*\324\214\313#\n\312\006\211\017 <PMU\331\210R\021\025\303\t\007\215)\035FQ=f\250p\302\341\004\305>QU\341\236 \001\212\002\204\t\030\",\001@\241\302\004T\215'\265\237\226nT\325x\361\004\203\351\t\006\223\215\031N5\230\236\250\252\230\226\216z\352F\024\025\023\216\251)*\246#\023y4c\264\242\0221&\\vA\034\360\351^t\003\233\343\262c\333\267j\001\334\325\335\005\360\305X\250P\206\213"
+	.string	"_HK\344>\311\001\247XjA\3013\363\233\207\207yH\030$6@y\237\264`N\214\360"
+	.string	"\243\2660\001a\227\255\025c\"\030"
+	.string	"\013\b\200\377\007\006`\354\246\371@S\235\311B"
+	.string	"\370e\332\224EH\256\222e\021\276\236'\021\331%KB\204\377\2278dv\307H \301\021\273FZ%K\332\2644\365\251*8\204\377'\207\210\346\335\004\304'\264v\213\370"
+	.ascii	"\253\223,\024\302\177\352\005\261]\257\326J\205!\227H\333\344"
+	.ascii	"I\033%\212 \020\016\002\302O\304\013\314\371"
+	.string	"\227\263\006w\334rt\273]\311\325i\304G#>\237,E*\227\253\2652\201I_\255\273\325^\3516K\273\345>\331nQ\237\256a\222\205,.*h\341<\004\201\004\250q@\346\230B3\"\"\242 )H\323\001\221\005\304\030\350 \343\003\022\240\205-h\025C33B\244)M{\007V~\356 \342\304t\262J\242\237\207\022\325\377]h\204\314i\2463\373\037\267&gT\017\035\360\325{\200\270\237]\177~g#\204/\276\302\321\013+\246\362Z\337\302Wd1\303$\235f\260#\316\032e\255u\343\342\361\271Alx%&\375\262\346FL\025\356\342\027\221Tq7\021\232*g\274\t\342\344T3\302\322\344\301\001>\r\235\277\311`Y?tC\255hC|\275\234\260\365m=\371\236X\217}$\377ti\245\265v\233\027\232,\277\034\204's\267\213\361\352\314\002\274\223\226\344\260+\356|b\177\212\345\204"
+	.string	"\244\242\353\327\312I\367O\315\375q\363\325\232 \217\373hs\216\003\177\247@pr\r,\3019\227hy\262"
+	.string	"\245\314\203\211\026\207B\\\207B\375\315\261cE\225|4n\357\ru:W\212\035\257HA\311\007\343\366^\227\306\3605\004k^>\344gD\002\271\324\367\332\370J\n\306\346&v1\314\256\332\335@\362\3008\240\204\001\206\tE=\236\303"
+	.string	"UF\377\315J(3\213p\006\007\227\230\205\301\314\224m\035|\026\237t\366\022\346.\310\027\340\217\301\232V\361\353?\240\272\342\344[%\032\340\215\240\013\366\316\353\367C\025D\177b3\324\f\372\314I.p=C\203\212X\302\307\254\004\227\332"
+	.ascii	"\273;\224\200\027s\320r\226m\204\244\362L\325\230\212\244rd~"
+	.ascii	"\213n\0371,-\244\321\001V\366d@\223G\335o\344\225\323\306\215"
+	.ascii	"\326\225\212\312N\267\216\f\234J\001($\3557\222\270\013\376\306"
+	.ascii	"m\340:(h`r_\006\312\035\316\307 \213U\302\036\025A\337K\203\n"
+	.ascii	"\224~\347^p\202\246X\340W\246\244\367\314\315\320t\324\271C\275"
+	.ascii	"\305<yT"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.163.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\346\006\225%"
+	.string	":A\310\016Gp\234U:\277\252`\221j\314\016\356W\036\236\257$\"s\023\266\317DV\253b\004\234k0\200\220pe7$\210jrdEjK\017f\272\371ODL/\b<?\324\342\207e_\315\367\210\266\315\3026B\310\336I\006\326"
+	.string	"\312"
+	.string	"\340"
+	.ascii	"WI\313\207\273\340\300\302!\213K\016\001\272\034\2655\205\241"
+	.ascii	"vUI\211\357\336\356k\371\026\342\2359>\224\363\2226crv6h\005"
+	.ascii	"\265\253\355\254uw_\353X\210]\004!eLNP^9z\351\223s\376\035\235"
+	.ascii	"\267^M\277[\257b&/~H\227\303\335\204\330 [\215\266\252)\276\305"
+	.ascii	"\376\363\037x\204y\266I\250\017\031\320\345\240\310&o\"\221\\"
+	.ascii	"\334\315\352\310\025z\222*\254\263F\212\334 \033\2217\221\313"
+	.ascii	"[\013J\3768-\215 \325\307\310\241\310!\251\320\3311\016\233<"
+	.ascii	"\3365\345\301Qr\007\227\334\221\372\254\304\200\274\211\304\272"
+	.ascii	"\252Tz#\326q\312\243\202\322\342\222Q\251o\214L\331\237\277="
+	.ascii	"\222:\356\245i\3109\367m\223Uo\242w\037Aw\303\350^M\004\3352"
+	.ascii	"^fF-\347L\201L\215\340\2009O\256\366s\254Wm\370xZ!\306\033m\037"
+	.ascii	"\0243(\203\bL\343\365\323\267\f\237(fd\371\372\351vB]"
+	.string	"|\325}\034\215F\243\215\227t\033\025\365x\273w\371s\347z\337\336\365f\357\374\203\356\365\266\235\313_;\330{\255\335Vi\267S\332m\274\336\276\005n\223\n\225\017 \327B\2233U\364O~\243\226\311:\327\337\365{\375`O\273\337\335\304~\230\213\371\327\237\315*\201\361\035\254\317<W\345O\311Qj\215\345\234\201f\274\2344\350\230\n\241\304\022\245\205\033_w\227\223.C\363\221{\224YV\330\361}9\030\342\271n<\267\371PR\224Z\306rv.\270\332(jWu\001/\002\310\366\264\332\02222\2729,b\304}k\20430w\370\271V\254Pa\2774\023:\206\225\005\225\221\330s\024+\263\201\321\003\315QM\301S\273\220%\326\273,\266\341\356\023)\356\333>\222\352\312Z\003\305v\220oh]\366\033\353\r?m\321\301U\001r\232\221\021\235u\371Z\361U?\275\317\254;\374\264\303\007\373\021"
+	.string	"V\305\212\373v\207[0\217H*\274\3113E\305WbO\361\023\213\024\233`\036\232U\004\372&gccR|u\374L\006R\202m\254\030\277\330\252\023u\317Zws\330\206/\356v\001\274o1>\332\201\241\372\206/\376\3271P\0205\267\353\245%\313J\336\360\271\256\242\223\236&F\202&7\034"
+	.ascii	"K\013 \026\277+\354\214R\260\307\372\261\341{\375\002\323"
+	.string	"x3N\2746MIB\3344D\302@\341\020\22781\002)\b\\kx\030\016\223\200K\302\022M\303\245\022L\303\240\016\007\r\246$\241\332\022\" Mx \301\002\004\007DHA n\240\003\246a\260\005\020\306\017\b\343WC\206\213\340\017(\034\376\034\364z\211)I\370kZZ\022\376Xg~\232\361\222&\212\206\261F\230(Zv+\302\304e\217\3433\327\303\317\242|\036\237\352\016\023\227>\216O\035\017;)\305\034\237\230\301W\334\243\273Wl\201i\304:\332\327\234\242V\371\235\342\225\267d+V\361es\f\364\347\357\244)em\r\3064\347\234\207x\007.[\314R\334r\337\362p\006\246\324\021u\252J\212\256\267\241\327T\336/\262e\316\252\031\204\026\026\325\205+\"pY\334\335\341\303}[\20430\243\2427[\366\271\005\200\216\250A\\\206\024DB\"R\234\202\202\244\003\360\"\221*n\003\021"
+	.string	"5\252 \324$\311p\211\364-\032M\240C\374q\234\201\265\316\035\270\f\275\224\013\357h\210\034\360\312u\026L\241%\270\003l\244p\356Xq6\223\205\306\323\036\334\021O\311\214_\337i\302\346b\260\216x\212\t\325\276>\223\223v\262p\217\311\215\206YBH>\221\206\261\225\217\027\276\316on\fXL[\373\214\225\223\016\373\333\037\3779\204\rGd\221\241I\nS\013d\210\215E'\247j<_\356\r?S\374\264AVNa\325l'\247\021\030\365W\231\260V\334\346\274\"\031S\330\210\t\026\2030\331\370~\205\312Ts\251\r\004\377n\004\370\364Y\341\005\370\201\234\2039\016\362\324\353\026"
+	.string	"U\213`V\200\0277*U/6\024\305\032\026W`Lp@W\220i\r"
+	.ascii	"Ds\023pZ@\344\324\374\206:(B{5"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.164.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\265\002E\025"
+	.string	"\226%\213K\220\026R:\006W\372\031\254\330\304\261q\023\b\367QS8#\361\203W/\275\310\002\025\204\261\306\300\017G\210\241\261\336\305\367\241\311\371\256\0013\310hO$\0307\301\214$!C\310f\001\352;\335\0040\256\006yP\314c\311\336;\311q"
+	.string	"s"
+	.string	"v"
+	.string	"*\212\335\251\203\217L\201\317\251\227W\346\327\270\r\336\205>g\351V\262\272\352N\037\360\002\362#\247o\221}$O@\366\221y\314J\23625\002 \322\220\324Ww\227v\305y\277\266\362\370PW`\225\325\373\375\360\227\306\360\b\320V\325\357\350\366\246\204\r\031\231\375\200\256\214\320\027\222\312/\250V"
+	.string	"5\335\315\325\3673q\036\317\314\030\2309\207\271:\t\335\335l\225\230\237\236\357\205\277\035+?@\215\021\204\250\304\321\251\226t\023E\201\322\304\021\313\351\351\317\374\223\370\302\307\301\327\361\251W}\310\263\263H\f\r\357<x\336$z\367\004lQ\344\320E\345\"\003\371\361\004\333\261\273\315d\003tzq\201\374\bB(\3529x\227\332\275}\375\336\f\240\214\n\344\307\225\372C\361\354\004\362\302\234\366\254\264V\277\310\013\030CR\352\265\314g\210z\037?ER\220\355\361\207g\341\n\n!\231\272\250\273]j0\213\330\253c\274u%L\262v\211\201\354\326@T\222\240\032\306\314\266c\355\310\333\226&a\020\253A\360\206\326\265O?!\351\247\2121\377\252\247\305\307|\273\017\021dwG\3501\"\227"
+	.ascii	"\t\213\217|\037\331\307k\337\345C\361S\243p\375aD\004k\322U\214"
+	.ascii	"9\355U\273\304\374\033&\016M\247s\333\260CM\235\216\346Ae\207"
+	.ascii	"\207\206Z\310\261\261\221g.\207^\023\207\206\2328\033\215\254"
+	.ascii	"\2419\31332\037h \314H\210\201\031\260\323\301\231\350\3105\030"
+	.ascii	"\\\316\326\241vS\326n\312\235\223f+kh\256\2049\3007\234\211\226"
+	.ascii	"\272\333\r-gi\377\266Ub\rO)X\361\307\002\325\002}\002\330T\354"
+	.ascii	"\264]\016\365\232^\035\273\025\306Q\330W\r>\361b\322CD@\3154"
+	.ascii	"\342\n\0067 \260\002\2312\333\001\003\225Q\274,\t\327\357\020"
+	.ascii	")i\254\230\2548\326\246\273ql\025\037\fS\300z\262\023\314\231"
+	.ascii	"\362\035\302\274\226&^\034\212\266)CX\371\271\325C:\360\256\326"
+	.ascii	"Z\240D\214\311eM\362Q\321\332*\231\343X\214K\001\246\241\230"
+	.ascii	"\366\0313\246\267J\331^\303\030\302\244\220\3159\345Bc\361\244"
+	.ascii	"?\346\245E\230u\244\237\225\370U\304\"\227\346\231\341\024]u"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_mspFcInit.165.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375 \330\375\005"
+	.string	"\022\013*2`M\222\016"
+	.string	"\346\320\203\264\251L\260y\357\016Z\337\025\262\241\323.5\006;\232^\230HSm\207\363\340/\212\312\202E\017\002?\033\312\354\205\0307\331)?\210\272H\r/r/r\021\020\016\222{\325\305A\005O\324C\345$\246\251rOVL\r\301\246\303\251H\314\331~\202\242!\366\001&\257\0276+'m\235\317\256\226\034\217"
+	.string	"m{j>\025R>4\260\304\244\305ha)'\200\004\344\307g\353Q0\363\250\301F\310\305\210J[\227\035ha\263F\024\301\001,sa\023`h{\3032\031x\342\217\360'\374\026\001\007"
+	.ascii	"3\003\236:C]\270\317.\343_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.307.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"M\013"
+	.string	"\366\225NC \251*\035\300"
+	.string	"\003\300,\004Y\321R\203y\b$\374\327\030r\310:\377^\002\2612'\\}\221o\356\231\026E\262\243D\0250J\023"
+	.string	"\t\004\262<\311\0053\2613\235\330\237\317\024F\240o\177\023\271S\n;"
+	.string	";"
+	.string	"8"
+	.string	"_\340\316\007\345\262\355\316'e\325EZ\353\"\340\026\300\206aW\354>\365\300UW\311\251|\031\276V\327\217\347\024H\270\020\276\b\\n\316]B\273kL\201{\3366\207\355\016\373\240\0334,lVH`\373\366G\224\255\361\307\224\255\371\264\215z\355\304\211\373r\251X\300Py\321g\360\006\251\327N\316\354\306\"P\330\0253>]\201\371\2348\204\345\223\373\203\345\323\016\022\264]\326C\337\366\007\237\217\340\323%\240|\370\351\203'(\362\241T\020\f\200\256\374\361\027\261\225\031\244\316\254\334\271\335]\253\314\266\264ZZ^\374o\261\230\340``\267\025\366l\210>\032\036P\207\263\021y\244|!\323\036\247\004\222>\274Q\347\215:\222\021\020R\347\231\300\216\023\341\257$b\352L\276\317\324i\2562\212\233\224\252:@\035b\351\212Uuf;#\257wp\b`\021"
+	.ascii	"\233\241\252\274`\211\316\360\"\370\313\002\347\031S\326\314"
+	.ascii	"\275\200<0\342]\002\344Y\307|\006\2509\214:\003Aj \315\243\257"
+	.ascii	"-x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\356(\345k"
+	.string	"\n\237\250!X\220\314Y\245\003k\350\006\262\343\323\360\335\304\354\377\027\213\322\267\337\006\\\343\203\0353\037\037_?8\375\037\316\377\307\363\200\356\263l'~a\261\334\317\3777\272\247\255\301m\230\215\3053\211"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\274\305\363\232E"
+	.ascii	"\370W\345v\201*;k\003\375\342\331V\271\323\016\006\002\367\001"
+	.ascii	"\377\001\225\3268Q\251\r\023\225\342(Qi\214D\245\262\021\225"
+	.ascii	"^\021\225\346\260\225\316BT:\003V)\rD\245;\350\253\322Z\262R"
+	.ascii	"\035S\225\332\266T\312CK\245\036 +\3759V\332C\252R\240\250Jq"
+	.ascii	"\306\372Y\261\322\026Y*\345\201\252\324\004\261\322\236a\245"
+	.ascii	".\260T\372\342\251\322\025\302JO8\325k\271R\277\245\251~*X\237"
+	.ascii	"\004\326\217`\245\276H\225\372\334\257~\210\251\236\210J=\220"
+	.ascii	"\\\377\201\257^\250W_\304\2537\232R/DJ\275\217\023\352C\370\353"
+	.ascii	"\365\232\323B\224z\334\241\314'\263\210\223idi.)M'\252\t\342"
+	.ascii	"M\346\023UR}\016&\365wI\275\214\"\335\003\225K\216\bK?\252\177"
+	.ascii	"\241\244~\207\302^;\004\260\310\224\236\244\236\305\177\0249"
+	.ascii	"\036\335\204\372\032\024\200\027$\200\216\244\336\005=rd\t\007"
+	.ascii	"\222p+F^\245\310\177#\234\211\310\263j\310}B\276\002\037\212"
+	.ascii	"\b\177bt'A\256"
+	.string	"\304\341IE_B\364\243\241'Q-A\365\330y\b\3654(\b\277\"\364&\325J\250\204\333w\365>\224\202\253P}Pi\216&\017\244>F%\370\223\356RA\217\252\340\307\037\277\37181Go\270S\001z\257\007}\375\234w\243$<\240!xP\0216\n\242Fa;>\324q,4zcFK\344\270\361R+\273\224\330\2138\236E\325s\336\276~\343)l|\212\252\306\241T4\350\210\0314\206\214\013\247\232<F=\016\n\243\376\306|R\222e\312}\352e`P\317C_\320\035\225\006\312\302\005\325Q\365\324\333\340\251\217A[\274\204\235\223\300\342FtNd\305\207\2508Nq\021P<H\316\217\250N\034\004\023\337\251@\250J\b\361K\324\353P\022\327\215x\220j\316Y\300E\374\207\252\223\311\244\361\266~\306\353\203\207\250\207\361\362\202\301\212\200\314Y\347D\242s\227\327\353\365\262\240\276\207\3169\023"
+	.ascii	"\006\237M6p&\236\"_E\331\224\350~N\261\315z\204\362N\027Ds\024"
+	.ascii	"g\177.\265\341\257(\233\326\362\017\224\234AiTFc\311<E\304\037"
+	.ascii	"`g\0241\024\332\340\005\342\314tO\233v\202\364v\327)\373:\234"
+	.ascii	"\203\354]`>TU\266\300\352\207{\022eo\240\201\207\373i<q\244\227"
+	.ascii	"\201\275\340v\340\260\001\037\346\n\261\307Y\224\235\341\376"
+	.ascii	"\001#KJH\225.OO\271\357\224\035\344\310\224\267(;&_\006*\007"
+	.ascii	"j\022\313\276\235Qe\263`7\024\032\346\376:\216OI\246\024\205"
+	.ascii	">>R\210\242\320\245}\023i\"\202\205\215\315r\3235\305\233\256"
+	.ascii	"\261\306\233\246\271\274\233ve\337M\267p\357\346\200\036\250"
+	.ascii	"\250\030\3744\243n\372\327\246'\200\262i\033\033\213}4]Cc]\267"
+	.ascii	"G\323-\314\243\351c\"M\313\\\031+tu\f\216\271O\256\206\311\256"
+	.ascii	"~\311X\\CW\377^y\351\t\246\323K\367"
+	.string	"\f\317l\307p\022O!\355\321\032m\321\016\261\020;\335`\016^\340\375Y_\366\335\036Q\336\005\341\360\315f)-\211\215yx\2058\323\376\257g\211\356\357$D\322\317\244B\373Bw\207\231h\177gs\3668l\303\267Y\036\376\314^f\253\005\322\376`;\b\322\346 sp7\310=\332\036\354g\220\312\b'\027`\016\370G\233\203\335`3T\241m\001W\260Vh\327\344\032Ks]\266\205}\264[,\213eb\232h\303Xl_J\341P\232<\332/\370\245\367>\216\340}{\227\027o6\255\376gV\337#G=\320\255\257\311\352u\304\352y\340\2504\347F\245(lT\232\242F\245*h\324#\231Q\277CF\275\t1\352\225\300\250G\362\251g\362\242\276\211\213\372\245\236\372(<\365'\264\250\017\356\324;\261\250\247\351\324\333VT\352\243\242R\030)*\225\201\242R\0329\001\302\033\264<\246<t/"
+	.string	"\017&\272\351\323\345\334\275"
+	.string	"8F\323\344\335\362\214\332\225=\226Oc\026\365\007\374\027\235%R4\270\0362\207\373\363H\2223}\033\356k\314\242\246 \177*\025\201\032\262\005;y\330\306,j\034;\233fQW\300\245\255\3114\330u[\026\377\306,j\226\305\3237\213Z\306\036\307,\352\230\330\251\210!Y0\314\242\316`/\343\264\004\211\205{\003\216\257\334y04N\354\263IJ\310G\003\030\272\304w\001\222\243\274\007\303\0029z\232\\\370\277F9Pw\201\241"
+	.ascii	"\231\317\226\367`\350\337\211\304\320\0214\320\031\300\312\013"
+	.ascii	"m\001\356\2009d\016v\003\005XC\206\213S!_\001&\265\244)u\241"
+	.ascii	"\313\232Lc[\367\016\214@4|\271\377\205\216\340=\243.t\013\370"
+	.ascii	"\303\310\262[>\333\273D8\017\331\317 Gl\354\264vZ\312n\351\356"
+	.ascii	"\247\220\037Z\200l\371SJL\005S\253\226YI\314\232\312\254\343"
+	.ascii	"5\332\342%\342\341\320\n\257\323\275\313\204\220\240\005\336"
+	.ascii	"\037\376\002\275(L\227\345\303=\"<\224\205vygu7\b\347.\353\347"
+	.ascii	"f\313[0\2536U6\213vO\237\370\254\230\311\262W\310W6\336\"q\230"
+	.ascii	"\205Yh\211\031hW?&\273\362\335!!\f\242\354\325\016g\235]\005"
+	.ascii	"]X\331\253\334\305e[\366\252\226/\242\354\025\315>D\331\253\331"
+	.ascii	"G\224\275\212\335$\236B\346\231\2431\027/\361\342\241\025b\247"
+	.ascii	"`\006Z\"\376Y&\037.q\023e\317\364\210\360P\376sh9\022\332\351"
+	.ascii	"\360LP\016\207g~\360\314\r\333\262\355\236({\246vghx\226\357"
+	.ascii	"\022\345\363\233\231\331\031\331\235\272H\234\217\266\210\211"
+	.ascii	"x(\304\317)\273\235l\360\002\361/3\341\334>\333={\024e7\321."
+	.ascii	"\350\346n\330\226k\266e\270c\307\262)\322H\024\336\240\375\263"
+	.ascii	"\004\253\374\362\273(\245"
+	.string	"\304d\003\023\202\273$M'\035c1\214\225\232K\363\227d\350\306$\316\245\256\020\273\252\304\016\320\205\251D\217\fa|\307Tj\233\373K\301\210zm*Q @|\3346\225\332e\364&\001\245Ha*u\013\366\016\352L\241\231J-ct\006\246\bs\023\251W4\225:\006\366\236J\375^>\214\016\317\220\317f\322_\004\005\361\235g&\365\344p\366\3476\255 {h\3673\251\207\361=Y\366\230\255\366\303\355\340r\2007\300:fRk\340!\203\013,\260\035,e\242\304HC\316\2203X\0138\025nymp\r\246q\2652+\313\344\0333\251el\214\205\3419\275\\\332L\352\343\236\231\324\023L\344L\352\016\271y\303\020\260L\337Dj\r\227\2273X\013\275\211\3248\025&o\"uyc\023\251m\362qR\030\351\\6\221Z:\300\031\256|'R\267\354sL\244f\301br\314\205\211\035M\244"
+	.ascii	"\246h@\2238\221pp,\321\315\250\211\3245L\216\\nWB\020i`\0365"
+	.ascii	"\001A\340/3]\237%\312C\330't\363\356\352r\020\316]\234\345\341"
+	.ascii	"\037{\263\325hxve\004\304\222\310|\304\306\"\2178\364\t\235l"
+	.ascii	"\020\370\263L\370\207\371v\275\334\032\272;\237.(\207y\270\237"
+	.ascii	"\233m\325\214h3\334\222\341V,i\344:"
+	.ascii	"\032\213D\336\320'\314\007\300E\r\312\344\005\363\013\340/\263"
+	.ascii	"zV\350\352\202r\226\205\263?\366fk<\032f\311X1_r\212\207<\372"
+	.ascii	"\214\274\242o\350t\177DCB\253]^\3450"
+	.string	"\356\376X[\r\257hx&\303\253\330\021\033o\321\362\206NA\240\257G4$\264\263\307A\242\375\334l3\265\273d\304A\f\274?{\002tV\266\370zDBy\207u\270{\2736K\233\335\216%\247\220\275\343\315\3671\336\331+\036\0061\017\257\320\346\230c\016\317c\f\331\253pFd\227\221\373\3114*\273I\244}\001N\216p\223G\264\275\203{\250\"\341\200\3163D\"\"\222$I\241\003\322\f\210\264\016\272\332\270\001\022`\002\231\020\003\241\034\022\221@D\002\t\242\007\026nNv\300\363\250\353=\t\323*M\030@w\006TI\227M\313\321\020h\215\266\255\203\006\256\022\r\323\363\201h\334\nC-pFO6\270\020\231h\210|\270\254\215I\361;:\204\236\343\277\025\345\214\377\035?\037\223\022\003\020\376\2608\312\265?\314\240\335R~\317\361U\373\307\243si\221\362\017\341\305\274[|\237E\013\222X\264"
+	.string	"\001EC\324\245N/923\367\317\201<\213\234<f1v\275\336\r\366"
+	.ascii	"\274A\304ixx\004"
+	.string	";\307\261p#\264\232\220m\003o\202B\214z\200\321\"\247\247\264#\0050\214\2049\221A\256Yj\022@\250:\260\212o\265\217\320.\242\210 \322%\276\312\003\322\022\024nuo\0358\210\021W\004f\276\216\031\355\003\350*\365|[@\215\302\020xT\341\254\250/\270\360+\213\033\001a\325\200a\220W5a\357\254\334(AB\216L\304n\354*#\375\356\207\244\260H\202\005\340&\240\016}\314\335\313\">\302\2460\033\367$\267\207\024\301$\244\371zE\310\316\362\2366E\022*\233Q\204\244\001\333\362\252\013t\274@_\272<\256x\324\217\t\264\211K\315\2212l\222e\023\214\307\241\021\214\224\013\302\202\3631\257\021\314hq\371\320t\325\370\026\004\037\207F\331\257Y\351Mx\373\340\266\331\377\016\376`\203 w\242T\006\214X\345\022-o;|u\304\344\341Mor\026e\312\352\367\225\300\215\035\346\231C\274"
+	.ascii	"\321G\361\313\tm\365\217(t\343\247\301\232X\243e\343\361EEYp"
+	.ascii	"#z\0030\026\333\301\310\255M6\232\005\364] \213o\322\347~\375"
+	.ascii	"x?\377R\216\2621\352\273\257\030Sm\364x\212\306^c\305\314@\030"
+	.ascii	"\366\273\017}\b\032\b\250\004\024\326\253\223\323\240P\n\313"
+	.ascii	"\377\243\006\346\260\372\300\344>\205\021\023\211\262H9>.\364"
+	.ascii	"T\317x+>\334n|\323Y\035\246!\216\263\204.\215I3\364\254\373^"
+	.ascii	"\306f\3410\257X\313\031\265\177\203{\337\005N!\365\334\337\017"
+	.ascii	"m9\007\362\274Iqw\320\331\361w\t\354Z\n4L\340\234\266\301\372"
+	.ascii	"^E\357\352\272B\256\220\037\350\367\262\362\f]r\352L\373\016"
+	.ascii	"\337-\3057\310\245\342o\253\365~\256\374\247p\223K\250\217\365"
+	.ascii	"C\257\234\350/;\352S\352\237\370g~\230\2171\3258=\006o\210\003"
+	.ascii	"\\\364\362\032\023\020s@\211W\217\324W\221\235\344Xx\307!Z\026"
+	.ascii	"}\214\251\342\356-\277>\211;\212\306\263n\343\336\236\021\007"
+	.ascii	"\232\274mg\244\2244\274O\006\377\340\202{\271fg\026}\006\334"
+	.ascii	"i\346\355\027\236v\2100^\360\306\324\177\226\366\2537\224\224"
+	.ascii	"0\031\371qmR\324'$\327\316\341h\017My\370\2201y\257e;\365\245"
+	.ascii	"G\246\273z\304*H\300\252\264+\256\203L\262\214\f\276{\330<\312"
+	.ascii	"\212[b\033{\034w\351\272e\214\261\016\362\216L\322\265\\\251"
+	.ascii	"\237\007\230\324jcnf)\254\372\273S\215-\222\303\302\326s\226"
+	.ascii	"\357\357k\336\315D\344\270\240\020\007\003~\037\206\023\274Y"
+	.ascii	"\327A\034I\333-\220~\361|\240\037^B\205P\021j\231\355\236\023"
+	.ascii	"\203\234\303\362)\364-C\357\243hMf\256"
+	.string	"B\340\305\f:\037\374\t\267(\227\341\226\351\351\0179!J\354\"\261\377\336`\333\216>S-\313AY\206*\246>\001\246\377S@\365\253$\202\370\237?\355\303\277\271^h`_\245\002:\364\363\276?5\022\034\346\243\253\224\356\370\226\260\003\360\201\005\333\221\325\237\327\334d7\270$\337\255c\203\026h\341'\007i%\306\240\r\333l^\303pB\351hh\263\201\323\316\267q\363f\253\224|\333X\275\nL;\244\256\200\f6\343\037\252e\302\252\301g\370o\n\016\323\374A`\3507\177\n\212qD\036\305\206\237P'\200\300\247\354q\020\354\203i\030\024\375'\031E \235Y\247\341(\374\177\004~\345\236\243@/H\323\240\320w\312(\004\320M:\032\017\371R\f\202Q\257\351#X\210'Q\300\024\365d\327\327\2042Kn\343f]\n>\345\036\\/\247\331\324~!\317\262\"\0265\2456I\262\340\351\373\306g"
+	.ascii	"\260\020\344\242\261\277\2178\270\210\237\325\343B}\331%\261"
+	.ascii	"\330\327\271ka\353v\216\223\216.\231\223*\222\r|[\206>%N\321"
+	.ascii	"\256\312\200MU!ap7@w{\355\022\222\004\006\337\366w\227\225\237"
+	.ascii	"\314x\210y.=\353a\022}\334\274KI\361\221\354\322\247-\357o\251"
+	.ascii	"+\323\304\303\353z\311\301\234\337Z\202,\302c\370(\016F*\006"
+	.ascii	"\314\370\217\023\324w\274u\302Vzj\bKh|X\360!c\311\346\316\036"
+	.ascii	"!\254C\356\357\222\374\0268\004"
+	.text
+	.section	.gnu.lto_.refs.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`b\006\005\037"
+	.string	"\252@\004\rF\200\326J\032\003\343$|\325/\301\003\250\227'+\324\202\361\262\033\224\302\351\207\253\tB\312\017\003\302\355t\237\3030\335\3470L\327]\016\215\317a\230\356o0\353\257\334\326\373^k+a\212A\341\332\b!\215l\231\002\267"
+	.string	"\313"
+	.string	"\267"
+	.string	"tqn\013vs\r\255lg7\303\274\260\252\\\2508\241\263\233D\211K\216\360\341\345\354\225\207\202\275\346P\356u\013\213F\025\316^\245\242\236n\366\212\002\251\310\346+Q\242\240\020<\233_\272876\265\263\004\373j!\177\261\256fP\325\354\273\224\374UJ\326w\202\004\371\003\"\377>\244\036\315\276\335q\177\356\270\007!\330\r\314|`\235V\312\274L\314\017\210y\026\230\017"
+	.ascii	"\363\200\363\232xX8\030\370\247\362u\b\336\313\327e\232\313\327"
+	.ascii	",\031.Z\2766\261|%\261\362{'\340w.\300\357\027\200\337\"\225"
+	.ascii	"\177\317\370/\323\007B\353;\347+(\376\215y5\360\251\207d/{\005"
+	.ascii	"\227}\310e\347i\331qZv\232\226\275\205e\t,\247sC{\272\034\252"
+	.ascii	"\247*\230\204\3664\tJ\204\035\025\f,\322\267\247\007aG\357\346"
+	.ascii	"\340\332\324\316|\210\201yqi\331\240!\264\243TA;*\305b\305\203"
+	.ascii	"5\021SG\217\034\354\250\221\314\216\216\210\331\321\0201\373"
+	.ascii	"9Ef?\023\021\231,\201\331O \r\366\223\256\301\237roK53\240\375"
+	.ascii	"$\033\023\333\261\225U\343g?[@\371\354\247\223\317\237MIE3\177"
+	.ascii	"\022)\367\342\224\236\275\b\345\270\027\017\013\007\001\373\356"
+	.ascii	"\350\340\312\304\300pha]\305\220B~\261\305\323\022\317^D*\272"
+	.ascii	"\331\213!\232\334\354\246!\203\335$D\242\334M\300\343n\366\361"
+	.ascii	"\354f\036\362M\273\313?\265f\373\323\352\037\177\276\210z\355"
+	.ascii	"O\247\325\376dRB*!\002\350\317\017@_L\364\371\242a\222@?\234"
+	.ascii	"/\346)\277X\027\327v\363\305\036a9\272n\330H\360\305\247\024"
+	.ascii	"5_\\\232\222|\023J\262n:\251y\363\357\264\272\031\267LC\276I"
+	.ascii	"\026\366\305\205e\025\325t\302\346\315#\0224o\202\210\202\370"
+	.ascii	"\340+\237\236\335h_\345>\333\354+\330e_c@-\351|=\322yR\250\363"
+	.ascii	"\313w\367\206&\226\363\333\225\263\217\372N\r\375>\r\3257i\262"
+	.ascii	"\377\360\301{\274\205\307\306\260P"
+	.string	"\367\314|\313\205_\261p\005\363J\241N\330\017\002D\356m\271\246\262o\366\262\037\277?(\354\313\225\374\325J\326W)\350\327\350\272_-\350\016(\207\2721\371g\262n\250\027\270\276B\240j\250\037\223\177 Y3\324\215s\3127\276\365\274\221\355\370F\26310\257\253\252)&%\2367\036\025!\337H$\005\321\020\371\251\222\300?\"zwt7\237\3021\370ty\306C\371\251\216\343\247]<\237f]\311\200\261\340\323(\247\246\235O\221J\374|*\342\347QBA#~{yt\277=\032'TG\331\320P\035[\021\036\265\242\232\212rj\202\360\250\022\222\321\b\241GADAdB(h\304o/O\350\317\272\240?\335\216\177\256\035\3774\333\261\333\237_\267\375\211\343\200\322\250!\230\"\321\222@\302HiA\n\031\016PSM\222\016\020\360\f\007\002K\263\003\022B.\250j\376\301W#`\362\007\347\345"
+	.string	"\337\356\333\326\315$V\264\342\265\202\243v\214\225\030\316?\330T+9\351\004\347\333\320\235<\035\343{\240\177[a#\013B\201a\232d\343\032\332TS)\363\271\251L43\244\236X\210fd\264T\313@\213\017n\260f\330p%0\201`\002p\0010A \345\b\300a\316\202\004\3173\252\253\314rghB\270i\002\223.@\004\001\325k"
+	.ascii	"<\252"
+	.text
+	.section	.gnu.lto_.decls.4240a8cd4661dd66,"e",@progbits
+	.string	"(\265/\375`\242\372]\004\004nW\206\205\026T\020(e%5\006;\302\304\210\301\003\207\3648\304\037=b\373\250\220\311\320\360\334\357\340\001t5\017C\324\003\352\372\375v3\216%@F3\"_L\351\333-"
+	.string	"\340\226\242D\300\220\177"
+	.ascii	"\300\260\235\337\314\231\346\031\034AQ\251'}\2625#D\356&r\313"
+	.ascii	"\235\002c\023\315\026\245\027\232H\021*Q\254\260,\260\250\326"
+	.ascii	"\223\035\355\245\223\270E\266\226\360U\343X\352\236a\243r\226"
+	.ascii	"A_'\272\257\343c_\007\307\276N\322\276\316\320~\316\233\375\034"
+	.ascii	"\252>\362\265\356\251\265CJ\326\317\231\333\317y\333\317a\333"
+	.ascii	"?\033\242\205\024\021\302v\226\265\325\006\212@\251\313\3729"
+	.ascii	"Q\366w\200\354(\362a\204JO\351\037\272J\007Y\247\032\210\356"
+	.ascii	"\261\343GT\003\321<\310\260\242\272\342X:4K3\343\307P?\007j?"
+	.ascii	"gh\377H\267\177\354\262\177-\245u,\251Y\022\313:\212\3325f\225"
+	.ascii	"\365\217a\373#4\016m\244i\024\215\216\261\221\225WT\337\320P"
+	.ascii	":\307:\32584\322\231\306\241\213\236h\"\215C'\351'V\032\3356"
+	.ascii	"\212\276\250\036v\335\017&5\266v\222F\221\261\211\312\372G\255"
+	.ascii	"\375_3\351\245u\252\233\264\r\251R\226n\3225\232\220U\265U\343"
+	.ascii	"X\272\301\203\207_\224.\250\276V\377\270\264o\344\3337\336\355"
+	.ascii	"\033\351\366\215Z\364\021\220\212G\024\242\254oD\3233\214f\373"
+	.ascii	"\306&\273\303\252\241\375\365\220\216\245xA\272\241c\266\216"
+	.ascii	"kN\211\230\254\273\304\304\314\246d5\301\322U\246\0255b\322%"
+	.ascii	"\272\206a\371\221\305e\205\312n\375l\326\022/\3248\226\262]^"
+	.ascii	"hc_\321(]f\323#\324+SV\200P\245`\3248\226\232U\271\242\316\261"
+	.ascii	"UV\217\215\303\252a\337\260nX9\226\fK\307\226a\373X6l\036\213"
+	.ascii	"\206\305c\367\3308\226\217]\303\236a\357X*k\206\265c\333\260"
+	.ascii	"p\3304\353\224\255c\337\316\216a\341\256Y\"(T\250fg+_\226\223"
+	.ascii	"+u\254\032\353\306J\243(\024\365\240\262Yul\022V\t;\346\264\257"
+	.ascii	"\024\265Q\311\274X3*XQ\326\f\315\310\233'+_\225h\034K\331\256"
+	.ascii	":6\354\214\312~\375l\027\3304\312\232\325\261R\222D\343X\352"
+	.ascii	"\001\315\314\0171\022\264~[5\264G[1\2647\032\331?\253\345\254"
+	.ascii	"\333\317\246\261YX1-d\2536EY\262\016\023?A\263\346\225\365\215"
+	.ascii	"A\366w\330\230\3306\026\f\353e\235\262_X.]\232\330/\354\226\020"
+	.ascii	"Y\340D\273\200rC\306\330m}\343\321~\261o\277\030g\277\250\267"
+	.ascii	"\331\265\020g\265\b\215pL\223d\rt\263W\352\252\241\255`\305\320"
+	.ascii	"\276Xf\277\330e\277he\277\030\266_\304\332/B\355\027i\354\023"
+	.ascii	"\253\373D2\373\304\264m\301\212\241=Ql\237\250\265O\234\332'"
+	.ascii	"\326\330\037\262\331\037\266\355\017\315\366\207[\373\303\251"
+	.ascii	"\375.\253\206\366C\245}a\234\375\301\212\241\275P\315\276\360"
+	.ascii	"\313\2760m_\370\265/,\262I\254\032Z-6*tC\213c\312\372B\034Z\302"
+	.ascii	"\031\373R\026\211\221'pO\266\262\376\316\220+B\260DG\260FX\""
+	.ascii	"\361\020\033\020\274\262pE\253\354\021\026\213\275Z\247\254\021"
+	.ascii	"\266\210\220\213\307\326\320\326\017z\331\017F\331\017F\367\203"
+	.ascii	"S\373g\255\330 A\200\240\331\310:\367\261C\2544m_\261Z\252b\201"
+	.ascii	"\260T\354\017vj\235\262AX\037`l\0206j\255c\245Qw\212\225\r\226"
+	.ascii	"(\b;\203\315\301J\323V\210Sb\203\260=\222\330 \254\016\226\307"
+	.ascii	"\372v\026\023\335\370@\t\025\237Z5\216\245C\2717Mh\206\372A\244"
+	.ascii	"}`\034v\307\032\227\007')\353\003\351X) \231} \227\215\203C\233"
+	.ascii	"\244\f\034\266\254\017\034\333u\254\323\372fD\363]\241B\261O"
+	.ascii	"\353\224\275\301\"\2617r\225\245Q\374\3051\221\225h\034\307\036"
+	.ascii	"8x\020\002\021\362\224\324\352&#\266\352%\255J\326\007\0269c"
+	.ascii	"kPa\227X&\326\306:e\225\330$#V\251\b\233#[\325\r\036~y\3247l"
+	.ascii	"\266>p\306\376F\263\277\327\366\317\036\025\261Fk\032\367\206"
+	.ascii	"\2261\265\254W4!\316\036\261i[\216\366\262\376\256\262?X5\264"
+	.ascii	"\355\212\241}\332\252\241ec\016\303/r\3238\353o\256\375-d\377"
+	.ascii	"\231/\016[\234.jY\357e\275u\232\343d8u\331\315\372f\004\005\234"
+	.ascii	"=j\234\\\315o\212\2778\256\322\213\306q\314\301\203\207\240\335"
+	.ascii	"\021\036\255\376v\332o\312\240\336\320\354\310\372[i\347\025"
+	.ascii	"\241j\002$\353\273w\373\353\234\335\232\246.\032\3071^n\263N"
+	.ascii	"\363]fs\227\251k\232\2547>\017\033<\260o\312\302P[}\267\312\276"
+	.ascii	"\313\265\357n\355\273Xtk\352\312\360\331\230\313i\262\232\225"
+	.ascii	"o\245\212\177ma\266\314e\235\251V\r-\006+\2066\243\t\361<W|\362"
+	.ascii	"2\233f\235\223\317\230Y\241F\r\272\254\263\231\254L\025\307g"
+	.ascii	"B\255(6\272\254E\204x\226k\273"
+	.string	"\264\004y\223\313d2qlW\321\254\343\244hq\034oh\363\240\304y\313\372n\217\375\021^V\276\365\315H\t\260\256-\231\313\372f\244D\227\2577`2\233X4\216\245ar\227'\3218\226\206\311k\231m};\213u\22147|]oYL\036\223\3352\334:\315ar\333\327\260\374\345Z\032\307hq\034\027\317L\225\246\206\372-\336^\343UC\373\266\314~\033f\277\275\262\245\302\264)*8\262~k\266;d-R#P\256\315\217\263\254\337\202\355\267J\366\237\325\214\262 \375\242\264=!J\303B\\\303U\206\310\225le\235f,\031\315l\345c\245i\233F\224,*\226,\005I\324\355\333\232\021\327\352\2678\252L\203\321\030\313[\326T\362\331:\315\323<\305lMS$:\306FEK\321i\226\262\246\t!5\243\326\025\307\361\006\017\036&\360E\315\233V\377\247\267\377\303\333\377\321\225E\371\315"
+	.ascii	"\263;\2235\031\320F\224^\234\254\377c\333\337y\262#\372\265\326"
+	.ascii	"\025\207\216qQ\234TX\036\313\322u\232\3052\330W2\331\306Wi\034"
+	.ascii	"B,C\031A\005\227\327\025\307R\017\0366x\370)K\022d\353\377\244"
+	.ascii	"\373\277\"\373\277\037\373\277\246\375g\257.\315\264&\266\226"
+	.ascii	"\271\236\273\326\272\026 0\262\305v_\262\016\021\342\231k\025"
+	.ascii	"\323\033\343\342d"
+	.string	"\013(}sj\312\372#\264\250\254`W9\253\b\214\343\252*\3218\216\237\343\255\234$g\025\215\244\361\223{EeF\255\032\307\361\377\314$/\311M\326i\336\312\321g%\353\233k=E\325J\332z\270bh\257\341\366\265\227}=\335\371H\306Z\247g\313H\200F\322\270\354\212\313\320U\326\327d;F\034\307\361z\266\326=[{\355\265\377l$\0239\013Cd\256j\345+\376\342\230\n-Z$\017Y\247\231H\026\222\245q\\\026\307\361G\020\311V.\225(\\\336\006\017\3055tG\336Z}\255\264\257\213\366\331\352\376s\220L\225\2630U\331=S\325\265\340\004\301\226\222\343\306\231\254\377\f$\353\030\363D\347\346\017Q]\361Dx\331a\n\243\346\230F\2561\035\321\264\326A\211\256sKk\335\372&U\200'b\3247\177\210g\035+\234\225\257H$\215\235\npe\352\256\272\262Y\355V\274\365M\252"
+	.ascii	"[m\324\034\225sd\251<\225wd\034\331G\206\312<\362\217\334c\235"
+	.ascii	"f\035\331\351\371)\337\270\376\016\335Z\007&"
+	.ascii	"\032\307\322\225\372%\353\310C\371h};Cqg\205\032\307\322g\033"
+	.ascii	"\177\210_\304N\326\221\225\326\272\342\2204n\"\341l\352\256\032"
+	.ascii	"\307R\017\033<x\360\340\241\275\243\021\304\315\006\275R\255"
+	.ascii	"\032\332\f+\206\366\354t\237\345\332g\205\354\263K\373\271\315"
+	.ascii	"\336\260jh\221r\022\361M\007\232\251\030\244*y\306\272t7\304"
+	.ascii	"I\326\317Nv&\312E\353\264/\307\327dTqY\034K\211,QT\030,Y\177"
+	.ascii	"\355\320\032\373\372\372\372\326\016\355\263\325\266`\325\320"
+	.ascii	"\352\025C\273\352\255{\353T\2035\216\324\230\261\342P\211\222"
+	.ascii	"\3653\217\375U\203\226\355\353[5h\237k\354\277\355\355SW\r\355"
+	.ascii	"\212\227\327\2735\357+\336\332\346\"v>4\212\301\342X\272\342"
+	.ascii	"\3518&Z\327\013\212\353z\301\217-\213(J\253\277\346\355\257c"
+	.ascii	"\366\253\253\206\366kYL\344\363\342\323\313\372k\223\375\257"
+	.ascii	"k\324\274\220\222\n\313zU\263\246Y\251b\b\212Pf]<\262^\345V3"
+	.ascii	"\353\224\303z\346+\232u\356?\"i,\215\343\330\270\332\031)z\312"
+	.ascii	"\372\270jh\363\212\241\375\232\2659\020\307+\207v\355\353[9\264"
+	.ascii	"+\231\020_\313`h\235\244\244\361Y\034\307\306\002`\ty\2225\033"
+	.ascii	"\307\301\345\312\002\204\b\234\006FkU\300\306\274\021!B\345,"
+	.ascii	"\353\325m3\3059\342\222\365\327\035\373\353t\025\023F\205\251"
+	.ascii	"\2646`\276\2069\3350\236@\243\231\221\004\225\365\361\326/\377"
+	.ascii	"\201A\2719\275\267/m\356\f8meY\377_\247k\333\352E\032o\030N\r"
+	.ascii	"\341a&\353\257J\373_\273\230\255g\242?\300p\331\302V!K\313\222"
+	.ascii	"5\233\324(\216\343\rD8Xp\212\262\376z\264?\342\017!eE+\262q"
+	.string	"<\325\025\215\343\262\217\370\327\260_\304\316\232eM[\321\3267\251\002lyB\215\343\262\257`\177\210,\253\330j\306J\225\304\261\220\253b\220:\0329\252q,\375\277\256\255j\253\226u\272fY\255|\275\262b\371\006i\034\033\305q\354\301\203\207\r\301\350\233\250\351\326w\300^\245\253\206v\303\212\241\275\212\275NY\317\326)\005k\025\251q\330\324\204E\225\365\023\260\207;_\251\034\002\242x\347\032\366W\n\332\265o\245\240\275q\377\253\331Z\366\205\203\b\022)X\034\307F`\026\275&9\262^\307V\262\257QV\351E\354\234\035\"\213\301\3428^\243\200@\025\307Dk\024\343^\034\023\031\327\365\202u\275@?\261\322\232\266\372\301\375\274\217+\206\366_\241\374\353\327\nF\001\213\244D\025\237\305\2614\307(\215Z\022\222\365\245\253\206v\257\030\332\237\b?\022\271E\006\377\341\330\257Kh\023\327?\261\351\367a"
+	.string	"\2173\342\307\237h\343\377}\240\006\270\201\005\300\017\377\356"
+	.string	"\364\340\307\005\330\301\337b\0019\370a\001=\374\277\017\036\374\277\r\376\237\210\273\325\001\277\021\2774\304\242\377\247\006\270\301\372[\201\377\272\341s\247{\225\016\377\256\223"
+	.string	"\001\376a\023!\326\307\317\032\371]\r"
+	.string	"\003\360\263<?K\001\026G\f\274"
+	.string	"\351w\223~\240\005\177\253\200\277]\300\017\004\300\377{\272J\356\322\017\254\240E\301ur\241\334\246\337\325\361\003)\3709\340\367\200\036E\334\253\375\223!\260\356p\223\270\321\251|\303\335\002N"
+	.string	""
+	.string	"\327\311\357r\375@\t\262O\376\311A\031\352\365k\023n\326\357~\375\300\b\362\361\317:\271\255\342V\0019\254/\326\330\225\376+\020p\303\377\271\215\245\354w\247\374@\b\310~w\b\200\017\030\340\032"
+	.string	"u\200\307?c"
+	.ascii	"\f\376\031\202\365\347\007\352\177\363\375\273\372\257\2775k"
+	.ascii	"\320/\374\362\377\340\266\335\357\"7\233\337Un\352\256{\234\337"
+	.ascii	"\3161\374\302*\356\214\337\363_y\326\236k\260v\320E\250\344\327"
+	.ascii	"o\264\336\277\327\350\271_\263\3715\027m\346\327n\277>\263\333"
+	.ascii	"\177\273\377V\363o\343\277\323\374\373\370\357\271\fhZ!\373\314"
+	.ascii	"\357\236\330f~Dwr\377.\263\223\2774\377I\370\211\021\370\363"
+	.ascii	"\321\237\373\376\226\204M\346_\201\374\353\231\177\275\373\327"
+	.ascii	"2\377\232\367\257q\377\272\346_\341\376,\367\3475\377Z\367\257"
+	.ascii	"r\177v\373\363\230\177e\363\257v\177N\363\347\026\177.\363\357"
+	.ascii	"\270?W\340\317\f\3703\213?;\340\317\024\3707\334\237\357\376"
+	.ascii	"6\204\277\025\341\337c\376\f\367\3473\1776\372W\037\177F\363"
+	.ascii	"\357\267\277\025\261\335\376\374\365\347)\177>\373\263\224\277"
+	.ascii	"\375\260"
+	.string	"\305\374\031\354\317^\177\206\362\267\036\376\226\203\177\207a\213?\233\363\263:\177[\342oM\374\033\314\377\033\262\277\374\254\325\317\n\371\331 ?K\365\263U\277\273e\267\375\354\220\177{\3717\227_\257\375\273\313\337N\355-\377fc]\374\254\323\3176\375,\324\337>`\263I?K\343g\217~v\306\317\032\375l\215\277m\361\267\r\370\367\332\317\002\375\254\320\317\306\370Y\237\237u\341g\341\237\355\371\331\367g\235?\313\374Y\f\374\254\214\237]\376l\362\377\311`\017\260>\377\025\376\327\f\374[\355_\203\374;\313\377\273\333i\272L\233\241\260\261\260\035~\366\303\317\n\340g-\370\331\013~\266\203\237\315\340g7\370[\024\373\312\337\032 \307\370\267\225?\013\375\033\355\317/\376]\345\3172\376=\375\333\r\233\312\237\223\376v\202}\366\347\026\376l\201?'\333\f\177\253\341\337S\376L\301\237'\370\363\005\177\266\340\317"
+	.string	"\370\263"
+	.ascii	"\376\266\270\245\020\377<\374s\316\277\315\376\254\363_-g\370"
+	.ascii	"w\331\237\037\370[\367o\367\277\243\374\247\362g\b6\331\277z"
+	.ascii	"\371\327/\377\332\345_\303\374\353\334\277\212\371W\272\377\247"
+	.ascii	"\227C\374y\347\317#\374\031\204?\223\360\347\020\376,\302\237"
+	.ascii	"7\370\363\210?\213\370s\001\3766g=\362\257W\377\257\372\377\336"
+	.ascii	"\374{\354gE\370\331\020~\226\304\277\245\177\273\302\026\373"
+	.ascii	"]/_4\327\257\275~\355\344\327`\277\356\372\333\243\035\366k&"
+	.ascii	"-\321\206\362\177\356\327>\376\266\003\256\230\337u\3737\330"
+	.ascii	"\237\225\376v\003\032\307\257y\374.\231\375\365\347\350\237\263"
+	.ascii	"\376\234\344\317Z\177>\362\347\253?#\371\363\326\337\016`?i\335"
+	.ascii	"\344\251\177{\375"
+	.string	"y\307\237yd \177\366\361\347\0379\310\337^\260\273~\035\330\\\377\243\374,\327\377\003\372\335\272\177;\371\177C\273\311\2573\360\267/l&\277\333\346w\357\376\275DC\177\026\355\327=\277~\361\353\346\337\276\330[\277\233\347\206U=\330-\372\376\237\321V\362\267<;\372\2639\376U\307\237y\376|\201?7\377\254\374\263\376\327\276\257\360\353\036d\377%\260\263\376\215\344\337C~=\266\247\266l\035\377v\372_e'1\340\364\017\343\376\025\303\277\223\376U\202\177#\375+\207\177\215\340_'\370W\025\3765\205\3777\265i\374k\002\376\025\205\037\226\177\037\375\253\001\376\265\304\277\"\340g\241\374?\264=\343Ge\033\375\277)\377\n\302\277\216p\367\277\2136\321\036\372W\f~7\303\277\343\335\201\377'\375\177c\377\346\300\357F\2607\360\257\033~;\266\006~\rDS\375\256\006;\003W\363{\342R\260_\370\335"
+	.ascii	"l\031;\306\1777\0206\f\327\203\375be\377\325\375]\375\273\307"
+	.ascii	"\337\205\340\377\004\033\312\266\320n\376\033h\377\374\177k\361"
+	.ascii	"C\"\343\027F\340wU\330<\277\313b\277\277\373\200\275l\367\266"
+	.ascii	"\322\235\300v\361k\0264\330\311\026-\342\376\013\340\027N\001"
+	.ascii	"a#\377\326\315\232\\\225#l\013\374.\002v\005\376k\320"
+	.string	"b]\356\\\202_X\344o\335\374k\213M\001\"B\025\332\026\352~\315\302\337Z`3\340q\334\260\277\365\371[\346\277'\360\273B\007\266\200 \267?\021\266\004\376\037\211g\360\017\261\374?\030_s\253\374.\332\277!\360\3778\374\277\252\375\200\337\275\361o\n\376\355\200\237="
+	.ascii	"\325n\200\336\226\340\337-~7\355w\263\374\233\305\357\n\375?"
+	.ascii	"\022{\205\b\367\360\023\201\376_\323\377\265\326\002\177\333"
+	.ascii	"\302\277\031\320\"\377\334\266\321\267\270\206\237\270\200\253"
+	.ascii	"\275\005\016\341\006\177k\267U\374n\0026\013?\020\312~;'\376"
+	.ascii	"B\020\377\325\336\242e\302\254\322\346\275\302\177\r\376O\320"
+	.ascii	"F\205?1\251Kh\023\377\317\205\267\277\020\003\177\253\364\177"
+	.ascii	"\375\211\022\374m\376\267\n;\205\177/\340\337\t\3707\n\377>\341"
+	.ascii	"\337&\374\033\305\277O\374\273\204\177\233\370w\211\177#\340"
+	.ascii	"\337\007\370\267\001\376M\200\177\223\360o\022\377\026\341\337"
+	.ascii	"!\374{\347\337\"\376\035\342\337\036\374\273\203\377j\377\263"
+	.ascii	"\374_\333\036~6\311\377\013\376\241\373\357\r\376-\200\177_\360"
+	.ascii	"o\n\376-\301\2779\374\033\202\177k\370\367\361\337\356\277\377"
+	.ascii	"\273{\277[\375\335\274\337\275\373]\352\357\226\371]\267\337"
+	.ascii	"\375\362\273^~\227\313\357\256\375n\226\337E\373\335)\277k\366"
+	.ascii	"\273c\277\373\365\273^\277\313\365\273"
+	.string	"K~7\372\273I~\367\352w\213\374\356\220\337\265\372\335\036\277\273\343wu\374n\216\337\205\372]\247\337]\372\335\244\337-\372\335\241\337\335\300\357\276\370\335\345\357\266\360\273\024\370]\b\374n\213\337]\341wS\374.\212\337-\361\273$\374\256\b\277\273\363\273\"~\367\203\337\375\360\273\035~7\203\337\025\300\357Z\360\273\025\374\256\004\277\253\341w\201\177\033\347o\253\177\333\346o\351\376V\315\337\316\375\255\231\277m\373\333\264\277\235\362\267f\177;\366\267]\177\353\344o\231\374m\364o\221\374\355\220\277\005\362\267=\376v\307\337\352\370\333\034\177\013\365\267O\177\333\364\267K\177K\343o\213\376\266\003\177\273\201\277\315\300\337\302\370[\350\337b\340o\235\177\013\364\267=\177\333\302\337J\340o!\360\267\r\370[\006\374-\013\177\273\200\277E\341oM\370[\023\177k\200\277%\300\337\212\360\267#\376\026\304\337r\360\267\032\374m"
+	.string	"\376\026"
+	.ascii	"\177K\301\337r\370[\r\177\233\363\267\306\277\335\177\313\376"
+	.ascii	"?\275\377\367\346\377\341\375?6\377\257\356\377\255\371\177e"
+	.ascii	"\376_\334\377\003\363\377\332\376_\227\377\267\366\377\262\374"
+	.ascii	"?,\377\317\312\377\233\376\277)\377\317\354\377E\371\177c\377"
+	.ascii	"/\354\377\201\375\277'\377\257\353\377m\375\277\350\377K\362"
+	.ascii	"\377\220\374?\"\377O\304\377\023\341\377U\375?\252_\307\371Y"
+	.ascii	"(\377\312\363\257\312\377n\377o\352\377\371\370\177=\376\265"
+	.ascii	"\204\377\267\343\377\334\3774\377\331\376\323\375?\035\377/\307"
+	.ascii	"\377\303\361\377\234\376\237\321\377\033\372\177\361\377\333"
+	.ascii	"\300\377\323\300\377{\341\377\301\370s\373\377\204\376\337\363"
+	.ascii	"_;\370\331$\377/\350\3775\377\237\013\377\217\204\377G\342\377"
+	.ascii	"\355\374\037\300\377\026\377\332\342_\035\360\377\356\177\234"
+	.ascii	"\377\007\302\377*\377o\304\377\253\340\327|\277\276\373\265\226"
+	.ascii	"_O\371\265\331\257\307~-\366\277\354\327P~\335\344\327?~\335"
+	.ascii	"\343\327D\277\216\177\315\201_\303\370\331)?K\366\263b?\033\366"
+	.ascii	"\263`?{\344g\257~6\352gq\374\254\215\237\315\300\317\276\360"
+	.ascii	"\263&~\226\204\237\r\361\263 ~\366\201\237e\377\234\367g\274"
+	.ascii	"?S\377l\345\317h\177\016\373\363\222?W\375y\351\277\n\177\256"
+	.ascii	"\361\347\r\374Y\003\177\316\300\237_\370\363\362\317.\376l\200"
+	.ascii	"?\037\340\317\030\374\031\202\177\355\373\363\377\025\353_\253"
+	.ascii	"\376u\003\377\n\364\257=\377\272\374W\006\374\253\212\177e\341"
+	.ascii	"_\025\360\257'\376\225\304\277\356\374g\361\257\032\374\253\005"
+	.ascii	"\377Z\301\1775\377\341\376\217\371\377\366\237\313\377-\377\301"
+	.ascii	"\376\265\303\377/\3779\364\365\365\365\375\021\274\375 J\374"
+	.ascii	"J\236\001\307\270,\326\201TF4\264\"\031\305Oq\\\025\037c$\242"
+	.ascii	"\247\270L\352\224\203TV\345\204TV\365\224\203TF\364\204\024S"
+	.ascii	"\305G$\251\020\247XZ5\224c\243\214\350).\243z\312\211\313\252"
+	.ascii	"\236\220\364\330\262T\200W\265\242\333R\006en}B2\212\231\226"
+	.ascii	"|\0209\035\337\220\244T\361\2318^\317\216b\247\370-\216\003\020"
+	.ascii	"\307>\250\234\316\020\351X\323\212\336\230\212\320\210\2508,"
+	.ascii	"\025YQ\305FoCk\374\206\304\204*\216\231\024\371\304Kq\034\307"
+	.ascii	" \fI\337\342\253\365mH\210\217X\351(\216#\210\245q\274\024\307"
+	.ascii	"Ck\374\026\307\361P\034\307\256\223\017i\034\3638\"E\227\226"
+	.ascii	"\342Xj\303R\354c(\313Q\034\347\263\271\264'\2442+\252\020Y\244"
+	.ascii	"\224Ec\032\322\241\025I\211*\216\306g\252\234v\331\320X\254\024"
+	.ascii	"\307\361\332fG\237\240\354\236\204Nm\266jDe-l\002ba\303\245."
+	.ascii	"\353\023\200h\377\302\245u*dZ\243njrY\013\223\204J\377\201\300"
+	.ascii	"788;\204JB\033Q\036m\342\\\375\217\213\340p\251\021\024\362\343"
+	.ascii	"\006\022\261\254\217'D\372\017l\231@uA\223\365/D\022\322\220"
+	.ascii	"\362#\211\r\033\036\233\330\230\360h\2652\365EK\224\254\205F"
+	.ascii	"0\354\216\264\271\021\026\225\001\301\223R\2235\t ;\017\366M"
+	.ascii	"\203}\302\270\204\021*\242-\013\304\340\364\242\336v\340\030"
+	.ascii	"\223\2650N\263R\031\361\206\316\344\262>\tlV\264\026 8\241\007"
+	.ascii	"\324Z\326'\372v\036\334\373:\r\356\005\341\354$\243\230\b+\250"
+	.ascii	"E)\354\006qK\327\216\273\254O\302\230\375\007\365\202prx\375"
+	.ascii	" \222u\360M\023\231\0306Y\237\204-\273\002jv\036t\343&\330\025"
+	.ascii	"\"\216\205d\t\243MK\366\252\261\223\023\007'A\311]\020o\270\344"
+	.ascii	"eJ\231\254O\002\220;\021X;\017\332M\203v\331L\2113*\242\252\013"
+	.ascii	"\300\232\264\370\332#\261\251\251\254?B\336\256`h\347A\352\327"
+	.ascii	"i\220\032\244\333EF1\221Vk\247\304\347\244\032\307R\034\270A"
+	.ascii	"\244F\200\333\177\260.HWfij%\353\340\032Mc\312\264\266\377\240"
+	.ascii	"\232`\2324DI_\262\016\316iA\342\203K\326\037A\312.\313l}a6\300"
+	.ascii	"\240(u\201e\266\245\250\224\275,\266`\033\211#'`S\224&j\224 "
+	.ascii	"\031\211#'\240\2158$\263\314\026$\023\224\013\232\t\236\t\206"
+	.ascii	"\t~\t\306\005\321\004\341\202e\202oA0A\267\240\230u\032\034\263"
+	.ascii	"zyp-\250eJp\272\276\235\241\330\002g\214\333\243z%\2506A\021"
+	.ascii	"R\n):jWP\254\306\030w)h\345\r58&(\r\222i\2657\232\260\266\202"
+	.ascii	"\325827*\320A/\\\266\224\300\276\262\376\bN\373\3534\330\205"
+	.ascii	"\013[\225!#\301-\017r9\035\033\346\310\2222\276\377@-\266D\212"
+	.ascii	"H\326\037a\306\326\322UC\373\263\240Z0\313\331\230\2329\275e"
+	.ascii	"\006\213V0-\210\245\r\2133\322\226\365I\334\355\223X\263\365"
+	.ascii	"\022*Vl\320\202U|\310}%e}\022p\333\013J\231\276\254\251\004\317"
+	.ascii	"\2126\332\b\201\313\372$\264\354\223@\333'\021e\237\204\223}"
+	.ascii	"\022W\373$\250\310\306\242Zdk\262~3\016\371\276\342\202d}\022"
+	.ascii	":\366I\324\330\027!\316\276\b\324}\021\342\366\037|\362\340\327"
+	.ascii	"\207W\302\230\021\311z\355\013\361\340\023-$\257i\313+\330e\324"
+	.ascii	"\001%\027\027\344\002\003\204\317M\326\027a\313\376\203N"
+	.ascii	"\202G\262\226\220\025e-\225B\262\022\226\365\037d\022\\\302\347"
+	.ascii	"\244\216\232\365\226\033\345\366fL\326\027a\272\277\316Q\005"
+	.ascii	"\263\202X\250\301\254`\220`V\260*xDI\b)&\275.\301hPIP+\230d\235"
+	.ascii	"\006\263\202X\304\261:+GA}\021\216\354\2130u\005\267\026'\353"
+	.ascii	"\213\240c\377\017\026\t\022Y\247A#A!hCv\332W4h$h\265\323\356"
+	.ascii	"\230\334PuQ\0244`Z\375\020\356\366CX\263\037\002\232\375\020"
+	.ascii	"\312\354\2070f?\204\266\375"
+	.string	"\007\201\004{\374\254\230m\301\305j\242Fg\210\202SA\034A\037\301\250\340\217\240T0GpG\020*\310#x#\250c\235\006{\004\237\230\332.a\336\314\b\"\271Q\235\274D\213\320P\203=\202IA\245\365\355\fE\236\030\352P\232`\217\340R\260G\260iMC\002S\033j\227\374\244\206T\232\b\364C \262\037B\216\375\020\212\366w\354\366w\334\20264\233\260$6\262\376\016\225\035\254\241$H#\030\247HM*\353\357\f\t\036\355\360\330\337\231\261\017\302\232}\020\266\354\2030\266\017B\326\376\201}@\2762STnd\r\214\363\303\001Fg$\353\203\320c\277\001\272!j\333\003\302Y\247@\275\237\315\002V\237\201z\300<\240\233\"\2214\036Z\267\230\302\366\272\212DQen\264\372 0m\035\257\032Z7+\337\330U\331\232\254\017B\274\177 ^\023#6\200d\275\005N\364\016H\005\332\001\331"
+	.string	"\347\200i\200t\3003\3005@4@5\300\272u\nl\363\003\345\200f\332\252\321/tQ/\300.O#\330\215(\003\006&\006\370\266\276\235\241PKC\205Sc\n\333\253\266\001\222Y\3156\bc\n\333\253\206\001vQ\023\005\003\354\262\006\330\006\030\267\342\001\333"
+	.string	"\307"
+	.string	"\3372\320\302\024\266WDz\025$\002\315JW\r-\211\025C\373\021l\373#\250\354\217\020\333\037\021\335\037Q\005t3r\301\003\222\226\365GD\355\2178\332\027\201\267/\002n_\204\225}\021P\366Ed\001\271\f\211\242\256\214\311\372\"\204\354\213\300\261\177 \333\2321\252,\216\022\340\032\020\rh\205\035sZ\241\210.\013P\r\250e\235\002\327\200W\016\304\002L\273v\263"
+	.string	"\327\200\323:7\013p\rH\305\245*\345\205\005\347\342\340\020\331\272\245Z5\264'#b\006\320\312\357f\001Vq\257r\006C\342\270\311\372!\336\3546D\334~\b\265\375\003\317\200S\202]oDm\244R\242\026\265\311\bP\n\320l\316\253K\331\201fGco\240Ei\22250J\210\003\313\370\336\3308\313\332\b$\033\333\221\244%I\326VR#M\345\207\221\232\024(\3062i\232\252q6G\243\251)\fl\032ms%\353:\240W\221\350\030\307I\260P\241"
+	.string	"\277\326)\020\f\b\226\253,\215\365\315\210~B\205\252\247U\253\266V\177\235\263\022\355\002>\001r\255S\240\3273[cM\003\364\312\3245\rQ\006RLXv\325g\330\020\275\255\177\240\0237\257*\252\254\201L\200Q\340\022\240\022\340\026\260\311:\0052\001\022\001\002\264\002\243\002\231"
+	.string	"\265\236"
+	.string	"\231"
+	.string	"\205"
+	.string	"\223t\005\363\224\302nT\201{{mO\202\372!\220\354\207\230B\002\314\302r\217\240\241\321\226\365C\330@\202\345\303\206t\006<r \026\237\221\tN\f\216\254\201C\200W\377\201\256\326\324\027\330\225\2216*S/\252\2753y\300\"@\"z\315\f\214W\326\377\340\315^\003\254\332_8\272\336\262\376\007m\300 @*a\022\251\332\214\003\251\352\204h\236\272\240d\375\017\246\373\007N\001\177\254R*\2578\300\037\020\2543\350\226\340\370"
+	.ascii	"\366\250\202\351\221\2245\220\307\226(z8\262\376\007O\366G\320"
+	.ascii	"8\026v\314\351\201\2432MK@\247\031KT$\240RU\207,ppmU(\340\323"
+	.ascii	"\326A\342\310\txd\326\303\250\n\256\255\n\204\002\036\3053\306"
+	.ascii	":X#\202k\253\002\243\2009\2007\2008\200;\200:\200R\353\024\b"
+	.ascii	"u \024p\306\332\r\270\266j0\r\016\035@\216\372\037p\355\037\350"
+	.ascii	"\004l\252\"\265g#k \323\233\3617\304,H5\353\177\220d\377\203"
+	.ascii	"#\373\007*\001m`\021\303\301\2265\260\206PI\311\332S\326\377"
+	.ascii	"`\n\230\364\001\217\375\017\232\366?(\332\007\201\267\017b\315"
+	.ascii	"\376\201E@\"7\215\310\310\214!\031\036wY\200C\300\330\305W<\r"
+	.ascii	"z\211;\302\321\3678wX\276\340\310\372\353\2338\373\315\261\254"
+	.ascii	"ogk\324\211\025\276\275\267Nw\234\255\027g\303\271\"ksWm\221"
+	.ascii	"\222\232h\265\372 \314\354\203x\333\007\201\266\377]\335m\344"
+	.ascii	"\246\354\310z\267\321Rv\335\220[%\215O\215\312n\343NW\2746+\346"
+	.ascii	"S\253\272Uv\033\367\n\n01\324*\273\215\213\346Z)\032I\343!\027"
+	.ascii	"\213\312\247\226\267\3576\336v\263Nw\233M\375f\263\355\212^_"
+	.ascii	"nfA\035\214W\r\355J\265bh\017B\312\246[\305\314\220r$\353\203"
+	.ascii	"\200\262\263|\313m\261=\246\253\265[\202#\246\312\232m\271\375"
+	.ascii	"\304\322`\245i(X]y\355\260\365MJ\032\337h\237,\301\021\323\345"
+	.ascii	"\256\271Z\\8v\314\t\310\024\245\213\332%\347\312m&\242\254\266"
+	.ascii	"m\313\355\033F\344vtwE\231Z\263\347v\334F\263\341v\231\255f\237"
+	.ascii	"\331d\266\231\235f\235n\271\255\344.\0267\315i\215\302J\243\256"
+	.ascii	"\224(G\250[nCm-V\252$\216\211\\\265aKp\304T\335\265-\347\306"
+	.ascii	"i\261f[n7\255x;\332-Kp\304\260[Kr{\033\364\2330\n\245\n)\353"
+	.ascii	"\2030\332\037\021\335]\314\232\250f\033\013\211#' S\031\251\r"
+	.ascii	"f\177\331b\266\333:\335a\266\227\263f\256\3327\3540\273\215\007"
+	.ascii	"5\314\226\3562\254\340\326R\221;\327\307Q\226\037A\375\017v\373"
+	.ascii	"\037\334\266l.lE\"0.L\246[\330\3360!R\223\365f#\253\213\262\266"
+	.ascii	"\247?\275*\222 Yo\265]\305\343\t5\353\235e\255C\263\002\203\222"
+	.ascii	"\366\037\310\222\201\341\211\245\205Q*\312\332\312\276\202f\244"
+	.ascii	"\213;z\302\304\312F\353\202$\007\227\2547Z6#GF\232\365\236\262"
+	.ascii	"\247\377\201\353]\364)\272\247\233\n^Y\035\225$\322x\b\225\216"
+	.ascii	"\265\263\035\204\003\001\336\024\325\310zKY\353\322\324}Q[\353"
+	.ascii	"~Vyj\260d\375\017H\310v\224\261V\311\231\253\276\254\377a\212"
+	.ascii	"l\217i*;\214X\341\255\323=\366\203c\222d\232\365?D\355\177\230"
+	.ascii	"\001\266\241|\355\2542>\264P\301\276\342\316\3423Y\357\257vn"
+	.ascii	"h\013\0344\233\253\311^T\026\255\254\357\201\226\375u\272\235"
+	.ascii	"\354&V\230$\241e\275\233\254xC8`\304\340\310\372x{\311\177`Q"
+	.ascii	".\f\313Z\326\377^\262U\\\202\213\253\266\266\022`\336\2318_Y"
+	.ascii	"\337\203*\373\036\224\355$\034\326\264!86\262\276\007]{#\331"
+	.ascii	"86\025\221\263h\034\307X;k\235n$;\b\222]\265\257\256\240Q98\202"
+	.ascii	"\203\245\325\037\261\257\332\032\233\310\372v\206B\313\324\310"
+	.ascii	">\262N\367\325.\262\257\266UZ\025\252\326\222/(\255\276\007H"
+	.ascii	"\266\3462\232\022&\353=d\013!\322\375`c\222\365=\250\332\367"
+	.ascii	"\200\307\276\007Q\373\036\324\330S\033\310:\335T\373\207\324"
+	.ascii	"\3661A\021R\002\300|Q7\325\316\261u\004!\301\267d&m\257\035\321"
+	.ascii	"r\325\352w@f\377\333G\217$,K\314d\275y\004sH"
+	.ascii	"\275i\311\372\035t\331{\307W&%3\276d\375\016\260\354\257\323"
+	.ascii	"\257\331Q\247\303\002\023\005%\353w0\335\357 \312~\007b\373\035"
+	.ascii	"|\355w\300d\277\203\254\375\016"
+	.string	"\250\366;\210\332{\311(\244\bQ\231\254\337\301\3216\343\316\261\322\350\tEL\324\244\255\264k\254\323m\343\333\206\233\306\355#q\344\304B\321\022u\333\330H\007\343\243\005\262\024\266\245\352AK1\342\005\310\326\347\240\312>k\344\206\303\372f\244\304V\225=/\252\333\347\252q\363&(BJ\241\013\332\233\263\235\351=\241\276\201\323a};C\221\346\366\271q\316\226\244\213\352\366\271U\016\031\344XzB\33536\215\035o\243M\264\213\366\321\036Z\247n\237\313\367\223bV\325\323\321\347\340h\337C\337\276\0077\373\036\352\366=\310\355{p\333\367\300e\337\203\025\274<T\007\327\224\365=\200\331\271m\326\251{\347\322m\030\261\306\245\026\207r\342X\310\232;\227\215K\235\240\b)&\022\342A\230\245-\034U\366J\232;\263V\177\003\275\375\273T\267N\310\007\345\007\237[\347\322\025\303\264\224\204d\375\r\342\3667"
+	.ascii	"\263\277\001\333\376\006W\366\357\242\271;\367\273d\3342k\224"
+	.ascii	"\026~T\222\276\320\310\332=\023\342.\232\031F\224nd\255\301\224"
+	.ascii	"\375\r\310v\226\256\032\332\016+\206\366\033x\3551\033\214P?"
+	.ascii	"\246 e\375\r\204\354\217`s\273\f\341\023\343\276\255S\327\315"
+	.ascii	"\365r\346\346\266\271a&H\212\343*/!\337R\221;\342\264"
+	.string	"\252\027\325\352/.\030\243\215,\032Xr_\276\354w\220\342r\3117\314\216$e\375\016O\266\273\245\303\222\375\016T\373i+\2066\307\253\206\366o+\206vKW\r\355\212\264bh\337A\311\265\362\234\225\251\322\366\216\242\262~\007\242\275\306g\366\352\344\236\351\310\302\262#\353\377\256\224u\352N\271;\305-s\315\326\267\263\230\310\252\003%UUmU\"\221-1JZ\377Y\356\256Yf\313y\211\210\031\244\254\257A\334\376\335(dK~<\3312v\227\354\327V\330\257\037\324\020M\227\032&Y\273F!\356\216!\351=\221nH\263\027F\214XX\017\02277\303.([\316@\341\202\203\202\333\222\365G,Y\353\232\242<\242Jv\270\334-)\227\313\315r\265&(\212c\"\036-\230\022\237\223\252\333\345~\271O\\/\027l\235\272\\.\223\273M\\'\254\026&\033R\206z5\262jh5\254\030\332k"
+	.string	"\266\257\001\222}\rx\354k\320\264?\200\276\355j\375\031\215\213d\215\322B\034\033\025\337\2348\221\313z\r\013q7I\360\n\365\253)\353\017"
+	.string	"\316^\221\246.\326\032\305\004'=\322\034\271jy\330\375\030\313\332H\353\305\211j&\353\017\300\314\020W\210[\345\006q\211\270V\353\324-\342\002q\213\270=\334\037\354\230\323\306R$\206J\0257'\205\306-\342N\205\241\3568S\304\345\021\246\224\027&\347\346\314KQ\177"
+	.string	"\\\373\003\020\262?"
+	.string	"\035\333\365\261\226M\271\322\313\372\003\210\3673\300\333\317 n?\203,\373\031<\331\277\253\303\215b{Z\303&k7\3521Q8$\355\314\315\341\342h\302d7\2275\224p\306\2202\270\254\237\001\325\376\357>\271N\353\324\275\34125y\031\341\336p\227\242Ja7\214A\266\312\344h\3653\350\261\237\301\320>\006{\373w\225\334\244%\255!9\262\376\b\2428W\250n\r\027\311\245\341\036\2713\\\033\353\324Mr\213\356\032\261D-\237\225\266\017\315Mr\343*T7\311\035\332\301\241$\267W\215c\251\021\n_\033TQ\007W\f\3551\260\262\217A\330>\006X\373\030\354\330\307\300h_"
+	.string	"g\366\005\300\266\377v\257\303\033\271\242.\275\273 f\216\320d\275\206YQj\357\332-zRzD\275\304U\331\366\242fg;\344Zj\253\246\255\266t-^[\327\236i\313\264v-\234\266M;\246\215k\331\264sm\232\226L\233\327\276i\321\264kZ7-\\kf\235\266w\255\230\267n\355\333\365\326\025\033\3245\fm)\313\020$j\331\024\225J\031)\326l\n\217h\2277T3\037\3245\235\306\267\206\251\365E\271\254upV7\323\246h{\327~i\303\260\322(\220\206\025\235Y\224\031@\242kX{\327\2321Q\265\350\2648iI\321\266\272\366\256\305\262\326MP\024\307S?\2028\224\302n\374\276|AC\006\004\235\337V\rm\007+\206\366\002p\262\377\026\314\3330u-\304\361\331\222>&\273\254\177FB\274\005S\201\025\266,Y_"
+	.string	"\321}\001L\355\013\240i_"
+	.string	"F\373\001\270\333\017\300\334~"
+	.string	"\324\366\003\240d?"
+	.string	"R\373\0018\332\277`n\377\2020\373\027\250\355_ e\377\002\351\376\005\\\373\027$\331\277`j\377\202\243}\013\350\366-\370\262oA\225}\013\266\366- \262o\001\017\2621\243\020\275& \322Vl\235\266cm\030\230\232\\[\265\035k\241\220\311\265u\271_g\232\034i\365-P\332\267\200h\037"
+	.string	"t\373o\277\332'6\306\342\262\254\273Z\256\326k\235\266OZ'M\264\226x\265OZ&E\212\370\266\252\036\266\327]\230\261\255\017\200\256}"
+	.string	" \331\007"
+	.string	"\220}"
+	.string	"\340\330\177\273\325*i\225\274\215\266I\204cHL\246<\274\220\264W\255V\213\325f\265G\326i\233\2445\322&i}\264D\3301'\005\304iQ\245\276\242=\272\250m\222\266\310\032\326&iw<\211z J\235\230qS\324\007"
+	.string	"\321~\005z{\210r\313M\224\254_\301\232\035\242\265j\251\216P\205\264A\332\252u\332Z\265@\246r\226\221hk\325\376\310Y;7\350\354\272\202Y@\200\230\331\372\025\240\331\257\340\313~\005\\\366+X\333\257"
+	.ascii	"\313~\005d\373\0258\331\257\340j\277\002!\373ou\264NsJ3\222d"
+	.ascii	"}MD\343\314\326\214\271\350\021\232h\2150Q\245/Hn\3216G\213\243"
+	.ascii	"\215j\237Z\246\026\252mjo\254\323\326\251]Zm\264Nm\022\233&\316"
+	.ascii	"Nj\213\324V\236\216>\005m\366)\230\333\247\300m\237\202.\373"
+	.ascii	"\024L\367)\020\333\247`\311>\005X\373\024L\355\2775j\213\212"
+	.ascii	"Y;n\264\365\375\370\332\241\226\250\215\327i[\364\213\263\243"
+	.ascii	"W\205\n\007\215\332\026\375\366\326\272iu\345\273\022m\213~o"
+	.ascii	"\326\314\354\025\361\276\250\340\f\365'P\263?\201\230\375\t\320"
+	.ascii	"\366'\200\262?\201\222\375\t\206\270Y\361\334\257-VgywOz\250"
+	.ascii	"\325\310\372\356gg\200!8Q\274u\372\273\373\265\271\210\0350\243"
+	.ascii	"\235\217;(\255?\301\216\375\th\354\377\307\346G&GS\031\262\254"
+	.ascii	"\3270,\"D\331j\203\022\353\252\252A\211uU\303LEW0/Vb]][\326\272"
+	.ascii	"5\261\256j\034K\311\374\304\260<\3301\247]\245\350\0075\304\227"
+	.ascii	"\235\"\261\256.\266$\324,OX.+\336\032\226&\302\022\261\256.\352"
+	.ascii	"\257\314\317\314\217\356\367\366\203\373\235\371\245\371\311"
+	.ascii	"\375\306\374\324\374\352~h~q\2775\277\271u\372#\363s\323`\226"
+	.ascii	"\264\021\353\252\206\320\322\244\215XW\365G\346\327e\305[\"\326"
+	.ascii	"U%\363[+\022\353\n*\231\242\262\013\200\276\004n\373\022h\331"
+	.ascii	"\227`\311\276\004V\373\022\360\330\227\200\306~\004y\373\021"
+	.ascii	"\310\355G\300e?\202*\373\021<\331\217`\310~\004J\373\034\334"
+	.ascii	"\354s\020\263\317\301\312>\007(\373\377]a\245~V~hB\263/\254"
+	.string	"2\277*\277\351\357\354G\3457e\235\376\320~f\377I\321D\322\025\017\203&c\270\242\325\261\235(XdH~h\277\262 \\\321\251\0233A\206\372\267bh\317\341\310>\207 \373\034p\354s \332\337\260f\177C\027\261/\344\021.\243\254?\242\013,\352\244\311\017\354\007\345\367\344\027\266N\177_?\257\263\337\327\217\213+\013W\264\332Ja\203\206GP\177\303\224\375\r]\373\033\214\354o\230\332\337Pc\377?&\277%X\210\336\320\262\336\252\213r\322\224\365!\210\263\317\032]\331\020\022\205\025\315\201\204\b\020%\277$?\255_\364\207\365;\362\313Z\247?$\277\"\377\031a\267\232~PEW\324\037\222\337\020 \223\031Q\321Q\037\2027\333]1\264\207@\315>\004b\366!P\333\207"
+	.ascii	"m\377?\253_\0255\212\f\233\254\203\374\330\314x\034e}\b\304\366"
+	.ascii	"W0\034m\3248\216\177>~:2\033;\346\264\247D\301B\215\352\022\365"
+	.ascii	"\361\313\261\246\241a\345\345\307\343\327\343G\365\373\361\233"
+	.ascii	"\372\001Y\247?\037?)\242\246\037\324\227\350\327\317\307o\307"
+	.ascii	"\017\352\203/2\275\250\252\033\366t7\246\250\017\201\323>\004"
+	.ascii	"E\373\017\264\331\177\240n\377\2014\373\017\220\331?\247\337"
+	.ascii	"\323:\335\360\273a\\\341\212\230|d\375\007\302\354\016\304\353"
+	.ascii	"\206\366}\353\206\366\017t\331\377\217\351\267DT\203\215S\376"
+	.ascii	"-\375l\327O\351Xr\214&vuY\263\361\317\306\357hm\310\312\220\254"
+	.ascii	"?\342w\364+\372\022\325Db\235\346\366;\322}l\216\365\315\210"
+	.ascii	"\316;C\375\035\375\206\304P\177H\277\244\037\215\337\214_\215"
+	.ascii	"u\372;\372\031\031\375\216~D,\017\241\r\2656?\2653?\346\206\372"
+	.ascii	"\017\034\331\177\200\307\376\003N\373\017\024\355k\310\333\327"
+	.ascii	"@\267\177\315g&N\232=]\247\365t\265\316F\\\217\254?\302N\337"
+	.ascii	"%E\3454\2328\2457:O\273\321p\326\251\256j<:\315\206\035s\332"
+	.ascii	"\323\242\032T]\325sz\r\bJ\266\350\354\252q,e\271\340\200\213"
+	.ascii	"\006\3655X!\243\333X1\241\372\221\3655\210\355kpR\247\251;\313"
+	.ascii	"\f\214\024\254\272\2524ZM\017\023*dY_\303\2154\032h\3503?2^\246"
+	.ascii	"\260e\375\fo\266\231\f\324\375\3532\232\214&\243\343\364\033"
+	.ascii	"S\\\367\226\365sL\006E*6F\273i8-F\207Y\247\372M\267]\177\321"
+	.ascii	"`\236\215\306\302\3260\375\246\243\200\3517-E{Y\337\214\304\361"
+	.ascii	"\r\022\\[rm\3258\216\211p\334\312L\207zM[5\264\021L\331]\266"
+	.ascii	"\332\331\024\222\254\237\301\311~\216\247\2249\262\246\271h6"
+	.ascii	"\255E\253\255S\275EW\271.\323f\3176\316\256\266h*e\214l\321h"
+	.ascii	":\013+\215\2420\004k\213\236\306DC$\326\354\340\332\212\321&"
+	.ascii	";*C\375\353+\327Y\256\323\204zlFcYk,:*\314\220$Y?\303\322\326"
+	.ascii	"VB\\_\371\355\370\022\004+k\341\212\241}\206\243}\fx\373\030"
+	.ascii	"\316\354c\340\262\217\301l\037\203\223}\f[{uZ5\264:+\206\366"
+	.ascii	"\030z\354ch\332\307P\264\257S\335\277\026\013\033\"\201Z#\027"
+	.ascii	"\246\2414\321k\262\2245\030Z\036\027\220\254\257Cf?\333@\002"
+	.ascii	"E{i%S\352\023\355Ds\351.\335D\177i&zK/Y\247\332K\207\320^\372"
+	.ascii	"J\037)\262qL$\0265r\026D\216\344\200r\313z\375\n\361\343\223"
+	.ascii	"8,xI"
+	.string	"\274\216]\303\261&(&\307\256\213P\272*\302\345d\030\277\021\201k\362\243\223\177\270\264\272\311J=\244\352\262>2\t\361c\223\254u\366\345K\326\304\343\222\343\326\020!4\264~\334\372\217\321\243\2225\312\230\333\236W\326kt\325\320>\260bh\335&!~\3242\376H2$\225\344\230U\354\322\301v\206\344\307\254(D)fDd\262\316O!~D\302\267\205\351\352\210\245%D\255L\326=xC\206\034\2574\024\021\247.#?^ip\267\245$\353c\221#\221\tLw\217\333\321\352hu\f\242\343\213\311\016\222\226\255\254?\201\245\335C\005\b\220c\020*[\2254w\204\352\307 }?\266\336$P\335>R\216?\216?\"\260\005\327\326U\243\n\033Y\326\227@\334\3669s\354q\354a\334\333\213*rW%\272\335\300\362\224\365%\360e\373\3448\3568\3560f\351\022\305\327\245J\007'HQ\326\227"
+	.string	"\226\255<\322\241\343\230#IT\215\236\036\027(\333E\232\0337\21696P\r\261\001A\214\216\255\237\232/G\250G\034?\346`\300\224\267\261\254\217P\022@\332.\322\222\222\216N\033\250\206\362\204{La{Uc\024\034\274)\307\246\037\235\212\\\340\266\340\262>2\tgh(\250)\307%\035ifcK?*\335\245\245\251q\264Q<\213S\324&\353G@o\327\250\333.\232\034\211\216DG\032O\212<\230\302\366\252}OYE?\322\370E\354\034\217h"
+	.ascii	"\271C:\036\035gTi\320\b\003\306\221\016u`\025Q:\032\211\331\357"
+	.ascii	"\224\217\357\030\377(\336`\n\333\313S`\344\314\364\375\030\003"
+	.ascii	"\337\246\342\222\200\315\370\017\204\240\017\213F\326\217\200"
+	.ascii	"\225\355\243\006\007\216qo\003\325\020\236\273\205\343\b\265"
+	.ascii	"\312>I\222\003\242w\343\036\021\317\354-,\002f\373\r\253V\201"
+	.ascii	"To\242i\266$\271e\375\b`\355w+/\017H\265'\206E\216*\353G i\277"
+	.ascii	">\354\354\214wP\242\210u\r\313\272\354\331\031\333\334x\267\246"
+	.ascii	"\251\200\r\250\034q\366;\303\314\215i\314\030\251\306\2635\216"
+	.ascii	"\245\342\"\243x\nH\004nD+<\274\250\214jn\244\336X'b\247HGdb\253"
+	.ascii	"\312\313\332Hg\\c\234\023\206\261\035\305emD\263\022az\203;\363"
+	.ascii	"\003\207l\220D\035\311\372\020\250\356C\200\315^\336\215\031"
+	.ascii	"c,\263\201j\310\256\203\233\035\\[1J\022\"xe\214d0\324`\302a"
+	.ascii	"$c\214\3033\223\365%k8 \017\342\226(\250\261\254\215pd\366RL"
+	.ascii	"\2300F\267\rTCl:d\271!\327\246\257\334\226j\210\271\321m\355"
+	.ascii	"M\215\033\226&W\274\246Y\037\002V\366"
+	.string	"R\315\370\305\370\2458\265\341\276\270\244e}\bt\355\245\024\243\027\243\227\342\224\023\216*0oB\354\240d}\b\020\331\313(\033\233\221K\220\207R^XW\336q\305hn\313\215\\\312\310d\rA\300i/y\254\255\r\335\274\340\252\332\212qDj\330\310\372\017\340\333>|\306+\306+\306,X\3247FUi\322n\314R\003\n\326S\326F,_\323\216\341\342\312\262\333>XT\250\030\321V\262\270)\203\226(\276.U\226\013\030\016\034UnD\303\363\312\202d\232\265q\372:\235we4\367\200\263\235\214\2322\305hv\247\217\254\232He\375\007p\355\344\214(Q\214f\033\250\3304[K\3706\026\262\265\264\262uj4\373R\223\352x\300\324n\241\016\n\024\343\230\005\242\340lm@K\025\243\364\306\261LW\305\214W\326\3060\243\030\322\2238R\304V>\0353\364\2528\300\315n\301\212\361\313\370e4"
+	.string	"\033\256h\027\221\221\233\224\254\357\200\270\335\202\024/\257\rwQy]\325\354\203\006R5\353;\300\311n!\332\244\211\221k%\213\233&\310B$\327V\025Z\t\263\007\307\350\344F.,^\274`\311r"
+	.ascii	"\220\335\302\324\326\226q\311\006\252!6\030|\251\311\265\261"
+	.ascii	"VK\232r,\261\252\242\341\225\365\035\360\264[\320\021\215"
+	.ascii	"\356\261-\275\250\256\27354c\262~\003\366v\013GXX\306${\321`"
+	.ascii	"\237\032\271\252\254\033\223\f\317\334\260\362\003I\234S\230"
+	.ascii	"=$7N\3415E\325ld\337\325\025\030a\025\034P\220d\375\006\254m"
+	.ascii	"d\325X\304Xd\217-\021\353\352b\323\353R\022e#\341\206\f1Z\255"
+	.ascii	"GiQ\031\033Q%\033#m\262~\003\230\354\026\304\374\370\017\243"
+	.ascii	"\325J\02671`\fN\264\313,N\027\242\252\033\255\262\360\252G\202"
+	.ascii	"\210\341q\343\2141\210\221\352L\016\246$Y\033\201\244X\003\205"
+	.ascii	"K\326o@\221m\234b\337\330\266\254.mvl\344\227\036=\366\330J\306"
+	.ascii	"\347\304\b\213\307X\326o\300\322FF\331\261#\310e%\213\233FH\371"
+	.ascii	"t\210\206D\263~\013\274\215tb\324a\324atB\023\235\252\021?e\375"
+	.ascii	"\026h6R\2131\2071\307\036\333@5\224\347\246)\3619\031\252\031"
+	.ascii	"Aq\023\263\221Gn\3340Bi\255\331I\t\321\274\025\2513B)Yb\245\224"
+	.ascii	"\365[\234m\344\017c\223\261\311\350\344$\250\324\205\312\310"
+	.ascii	"\350\004w\003M\354d#i\330\260a\\\342\341N\3418B\255\272X~D\227"
+	.ascii	"\214J7.\035a\303\013\346\245\251\262\001'd[\200\215q\206q\206"
+	.ascii	"1i\2456i\361ue\251\2721\034H7&\345\035\355M\2636\3220\036\271"
+	.ascii	"\305!Bd<\"\206E\315l1\036\345,-&-\274\254\337\002\307\266\300"
+	.ascii	"\234\261\310X\264\307\250D\251\304lTe\375\026F\333\002^\212}"
+	.ascii	"\305>\343\020_T\221\273\352\372e\016\217\311\030\3378\024'&w"
+	.ascii	"\206\305\233m\201\260j\265\030'+8\245\224\027\266\206\214\r\336"
+	.ascii	"\233\027\343\354\351\250\220*\215\275\242\036\0304\033e\214\304"
+	.ascii	"\303!|^\352\340\270@$X\203\344\376\370\017\314\2311\244\225\365"
+	.ascii	"Y\204\331L\034r/\316\311\025\363X\271U\032KQ\r\261\031A/*\314"
+	.ascii	"G5F\222\352 \034\26316\206\315\213y/\342\211\330\371\232\335"
+	.ascii	"\345D\216(\353\342\335\213Ra\324\250Y\277hWl\363\003\203K\206"
+	.ascii	"\224qe}\026a\373\036l\262\250\247\247\254\213\324\257a\262F\211"
+	.ascii	"M\326\305\272\263I\231\251\026\241\023c\025W\224u1MQ\315:\375"
+	.ascii	"\227\342\232K\215E5\032T\276d}\026\\\373\353\277\264\035X\377"
+	.ascii	"\245-\236y\021\315\017\004\252M\r\251\312\372,\264\366_4\363"
+	.ascii	"\003\335\251\\\217h\326gqd\237\205\325v\221\004\007W$\323%\272"
+	.ascii	"Z\3119M\211{\221\f\326Y5\213\216\235l#FL\361m\303\216\301\230"
+	.ascii	"`1\202)\242\345Tt{\361\215\030\025\002w\205\205\215\255\344j"
+	.ascii	"k+\202Y\217\322\242\271/T\"aI\262\276\274\bFH\025\204F\265\272"
+	.ascii	"\223a\266l)v\331\240\013\030\206\f\032\024./v\331i.\331\335\231"
+	.ascii	"!\352NBIK+jY\311\342&\r|G\242<\263\265\027\265\260I\223\306l"
+	.ascii	"d]T\313l\30668@\276d]\314\262\323b\035z=\262>^\207\032R\362\212"
+	.ascii	"\306\354d\221*U\212W~N\234l\211\261\362\342\225=\252\364K\326"
+	.ascii	"E4\241\322:\345F\226\032\266\355\002\210\024)E*\353QZ\244\006"
+	.ascii	"\215\032\307R\035:\340fCZ<{\221J\221F\222\2442Y\027\247\f\253"
+	.ascii	"\264\211\313[\315\214\\z6\344\262\376\n\263\255\fR$+\222\025"
+	.ascii	"\3136P\r\261\311\300\207\360i\257G\225b\224\027\313\240\320,"
+	.ascii	"\025y\262\227E``E\351\006\252\2416\006\350\302\226\351\312\243"
+	.ascii	"\223\026\305\316\264\221B\"V\f\233s\272\261!x\366\304\355\251"
+	.ascii	"\b%\267!1C\023\246\310V\262\361\362*>\331@5\204\327:Yudq2\346"
+	.ascii	"I\336\226\251\275\254\277Bj+\335\212\\E\256b\0231\321+65)Y\177"
+	.ascii	"E\322VZa\302\244\330$,J+\255\252dVlB\346\206\nR\326g\200\333"
+	.ascii	"~\315lm\3551\004\300\311\265\215\301yQ\263>\003\256\354\367\255"
+	.ascii	"\030-F\367\330\032\215\302R\353*j\333\343\032\262{\244\216\034"
+	.ascii	")&Y\311\342&\016QLn\250U\366\356\313\231\244\254\027\223L\201"
+	.ascii	"\244ae]D\"T\262\202\306\312\223\254\213X\257\303\343\243\252"
+	.ascii	"f}\274\263\345\310\362\025&\3533@\307\346\001+R\244hd\003\325"
+	.ascii	"\020\233\rpD\025\271\253\262I\326XQ3\222\331\346\270\336\264"
+	.ascii	"\3506Ot\310\020 \225\024\225%\n\023\347\252m\363\344UU\025\255"
+	.ascii	"\2420Q\177Lwd\261\302\032;\n\222\365U\234m\236\271\"U\221\252"
+	.ascii	"8\265\036\245Eq>\200bT`D\3006\217\230\037?\212S\037\2541\r)V"
+	.ascii	"<\250q,\325a\003\\:\306L\345\254\031aF\274\242\233G\210\016\035"
+	.ascii	"\305\036+Y\334\244bo\352.km)Q)\366(\362X\323\013\023%U\334!\374"
+	.ascii	"\242\306\244/\353\253\b\"\245\342i\363$\025m\024m\024s\214\220"
+	.ascii	"\006\227\247\211\234\310\004\301\361b\216\3146\004\013*\353\242"
+	.ascii	"S\021j\253\341\270\021\346\251x\203Er\243\216F\326W\021?5\261"
+	.ascii	"5\224d\021\322\304D\234N=\305)\025\2274\023-Uhl\224\262\020*"
+	.ascii	"m\364\316\336\366K\327\327WLZ\311\342&\026Q3j]F;\247/P\212H/"
+	.ascii	"&\265U\252F\302d]4*\322\020RFG#\353\342\321oN\353jI\326g\001"
+	.ascii	"\313.\316\300+\026\375\007\n\255\244Eo\305\242\"\221\226\031"
+	.ascii	"\270\257\254\213C}xN\330\262>\013\322]\214s\324\013\024 pZ\273"
+	.ascii	"\207\b\016\034b\034\261h\034Ku\020\n\251R\226\267wb\234$o\254"
+	.ascii	"\274eM\324\023*9A#\205G\325\3469\303\303#V\317\032\305Sg\321"
+	.ascii	"\035\367\330;\343\346\304*\220\257\n\007'kb\336:\303\307\021"
+	.ascii	"5Y\037"
+	.string	"OL\323\036\234\254\317B\216\335\263d\347?\221J%\266Y\311\342\246\r{Ln\250\3258\226\352\260\332Uy%\331\235\330\006K\314\220\033Y\023\331\b\225f,\331\243b!ig0;'\322\321e\266\235\024\307U<\2047r\270\311\311z\343\312\372+t\331 \244\3319Q\215\232\025O\017I\343\246\fbOp\242!\322\234\220\262\376\ne{\307m\347D4D4\3049m$\215\237\\\270\241\027U\215\235\272pP\244\302\346F-k\342\334\nN\266\001\230\354\234\b\006\f\321L\t)i|#h\227cNL\027\225&K1\321\fQ\216\306\022\016'Y\227\231\262eK/\353\257\200\265\237m\274\325E\347\210c\210a\350\210c\210bFh\313a\227V%\222!\306\021\341\326)q\f\321\215\312$v\267\365W`\332_\241h\177\205\241}\025\372\366U\250n\003\230\355\234\250FT#\266\035\237Pc\247.\034"
+	.ascii	"\355pDU\211mD/NtqpYw\311E\366\310\214d}\025\312l\342\026b\025"
+	.ascii	"\"\033+\215\242`\025\207\032\023\271\254S\342\026\342\332\272"
+	.ascii	"a\210\367c\250\207\326?Q\313\211lu\300\037?\340\212\262\376I"
+	.ascii	"\tq\242\2263OYrd}\025\324\366U\230\262\r\260e\347D*S\"\025b\332"
+	.ascii	"\032G\027P\346\213\032;IqP|s\005)\2325\226&`\270\210\311\372"
+	.ascii	"*(\331\377\211V\326)\361\nq\372\225x\205X\205\210\366#x#\307"
+	.ascii	"\234\230a\232$\257\251&\242\255u*\336l\201e}\025\236\366S\320"
+	.ascii	"\333Oa\315f2\2312\345.\204;\251\016\272\210H\222\223\254\237"
+	.ascii	"B\334fB\211\022\205hFFD\327\003\324\366\242\224\235hf\334\203"
+	.ascii	"C\206(\353\343\255^q\314"
+	.ascii	"\034e\375\024\262\354\013@\021\237\020\237\020\307\264|\260\263"
+	.ascii	"\200\211\222\024\351\211cj\242pJS\262&\212\021\303\264\224Xa"
+	.ascii	"\312\232\370E\fK\213#\346H\330\211P\274\276\334"
+	.string	"\371\330\272\200U\2320D\260 \326\276A&FJ\001\312\256\300\221\235\023\273\210]B\253\r\3040\265\241\366\270\212\203\223\365S \262c\364\021\235\020\235\354\261\274\007\266\244:\374\336j\210E\311\261_\240n\021\233\020\267\210L\366\220\016\265i\311^\227\021J\021&YKNd\262\025&I\233\254S\210w\006\212$!*!&!F\177$\232\322\001\363\321!\030'K\222\027\255\023\243H!\234\342\352\002\330l\347\031b\021b\021\"\022\021\332\210X'\"Y\200\226\223\032Y\023\217\254|c\252\300\361\310\232x%T\312d\220Di\2235\321\310\002\326\266\214!\304 \304 \304!wD!'\016Qb+\243\313\232h%T\332s\2222\2225\261\352l4\224\210y\212q\304\221\311\372\013\030\333%\210vN\374\361uJ\374A\004\242\345\346)\345\205U\233\\U\201dM\234\212\022S\005'\353/`k\177\001S\273"
+	.string	"MvN\354\321\243\257\235\013S+\312\372\013h\332\005\270\3329q\307\016\276\340Z\030\217\252\275]\200\037;'\352\320\021'\372;\322B\375\221\365\025\240f\027\340i\347\304\034\304\034@3=t\224\032\305\355E\301@\031\353\221\365\025\020f\023"
+	.ascii	"o\347D(\"\324Z\207\200-:\273\2568\356\302\201\246s+b\265\266"
+	.ascii	"ED\3319\361\351iMS\302\310\216\245ih\250\\i\234pe}\005\210m\021"
+	.ascii	"\\;'6\021\233V\276\022F\250\210\2102H\333teS\316d}\005 \331\026"
+	.ascii	"P\332Y\275Vb\0221\211\270\204%dR\266\371\262\304i\2235Q)\nP-"
+	.ascii	"\211))kb\215\020'\332\300\200\020\252\253\254A\254\030\332+\300"
+	.ascii	"j\177\030\3339q\306\2248\203H"
+	.string	"c\004&LXvU0y:\232\262&\036\005\261T\221z\312\372\nX\332W\200\3216aj\347\304!\342\020\261\350x\344\264\306\361\02531\252ZWV\216\254\211DL\366\312\304Y?\205\335~\n\270]\342\310\316\207}}\300\037{\206QLd\244\rS\n\2731t\024\347\313\016\361\265\363a\2348\277%\002\334\220k\353\002Z\351\021\246*\353\247`\333\020P\262\363\341\2337C\275\022gT\034\020\265\271\353\342;\322R$\353!\034%\242\"FY?\005\226\375\024Uv\0131;\037\342\341\r\335\224\220\"\213\207\\+Q\2733]5\262\036\346}\003\323R\n\263\375\024c;\001a;\037\266i#\314c\n\333#\233\242\325#\353\2470\2621\3204d3dCB^\212\247\335\001\217\235\017\353\206uLr\223'eH\262~\212\241\035\343hg8\267\016\325\234\031\256\031\316\255\361\221\323\nZG\250\tP\263\237"
+	.string	"\266=\234\313\t\240\242\001Q\356\214K\327\020\r\327Z\rj\326\272\250\r\312G\3260\304\f\341\206pC3\025L\r\345>4s\266\"\226\2463\"Y\037oX\346H\225\2432C2FR>v\004\271\274t\321\233f=\214K@\223}0`\206nm\034\257R\252&\247X\312\251\303\013ka\206o\3030C\267\037\211|`\3001\024\363\241[Q\023$V\262>\236\246\361\037H\354ZSfG\326O"
+	.string	"\221\375\0048\355\013T\207m\303\2662\001H\241\220\267K\364\355|\310e:\3442\3542u\273\214J\320\230x\f\273\2708Z\250\243\021\225\313\372(d\331\036p\331\371p\355w\215X\242u:\\\033\262\2250B\025Ce\260\245$\267\247\306H\031)Y\017\265\024\215b\260\036Y\037\005\351>\nG\366\007Kv>\3142\314\"\fRB\212\212\210\210\004\027\221\\\333\220\272\305\007Z\326GA\307~"
+	.ascii	"\233\235\017\255|\235\016\255\f\261\2248\243\322 \n\337VW\017"
+	.ascii	"\0363\350\206W\214m\220\252\234\311\372(\034\355\237@\335\"\260"
+	.ascii	"\354|HeHeX\245\304\031\025\021T\006[\232\264\370\352\306\346"
+	.ascii	"\326\f\247h}m\206\334\366O\330\262\t\200f\347\303)S\326:\032"
+	.ascii	"\323\242*5\216\273p\260\251\342\234Pe\023 \314\316\207Q\242\f"
+	.ascii	"\315:@\201\243\263\313\022\355\341%\353a\031\234$p\322\262\376"
+	.ascii	"\t^\373'lm\215f\347C1\261\341\215b\326\232\235T\365M\335\235"
+	.ascii	"\230\254\207\322\225\345\022GJY\326?!\310\376\t6v\007j;\037B"
+	.ascii	"\201\262\326\355\"\243x\312\210+\365\253\312s\343\225\365O\210"
+	.ascii	"\367\003\200\354|\350\3455\374\322Dd\361\215b\025(3{E=\220\220"
+	.ascii	"\r\237\270=\212\330\001\311\372&\320\355\233\300e\203\340\266"
+	.ascii	"\363a\223a\223!\327\007P\224\300)\202!\301u\311z\350d\003\206"
+	.ascii	"\275/\256\254oB\225}\023\236\354\t\350\330\371P\311\327\351P"
+	.ascii	"\311p\tW\033\261\256\352\22117\323\254\207[\254\226\0226\321"
+	.ascii	"\254oB\326\276\t=\366\006]v>\314\232\016\263\206ZW\342\274\250"
+	.ascii	"OoG\242\303$\304j\220)-Y\337\004\244}\024\324\355\201k\347\303"
+	.ascii	"\253\253!V\t#TDV\030x\375\260\242\266\212\262\036\036\311\301"
+	.ascii	"<.hZY\037\205\333>\n*;\004\274\235\017\205\254\323\241\220a\021"
+	.ascii	"=t\224\306V`\3218\226\342`h\324D&6,\362\017\207\f\211\374\226"
+	.ascii	"h#emX\262v\251+\206\366(\2606\211\242\235\017\203\254\323a\220"
+	.ascii	"aU\2113\252\370\006\b_vxX\321,\303\252_U\006S\346\006\230\254"
+	.ascii	"\217\002j\207\230\262\363!\220u:\004\362[*qF\025?\221\370\252"
+	.ascii	"\222k3F\005Aa\264#\340c\347\303\036=\206?\212K[m\356(8\202\022"
+	.ascii	"'\353\241\017\"\333\221<%Y\377\304\335\376\t\267M\202\221\235"
+	.ascii	"\017u\fu\fw\2248\243\"\332\372@\211\035\235]\225\214\314\224"
+	.ascii	"-\353\241\224fu\304Rj\262\376\211\265\375\023d;\004\220\235\017"
+	.ascii	"\241\276N\207P\303\034%\214T\311\265U\313t\261\202\224\365\020"
+	.ascii	"G\360hz\366%\353\237`\262\177\"\310\016@\221\235\017\237\206"
+	.ascii	"O:\254\204\024Y|\303\210E\264\204\257\005\343\022\245(\353\237"
+	.ascii	"\240\261;\250\331\371\260\306:\035\326\0306\225\220\242\212\241"
+	.ascii	":xUaEU\351\222\300\332\206L\0376\375C\033C%-\244\210\265E'$\353"
+	.ascii	"\341R\210\017\231v_\337\332U\326\305\025C\373k\233\333\032\034"
+	.ascii	"\331\371p\306:\035\316\030\"\2258\243\212qt\340\202\253j[\303"
+	.ascii	"\264\314\241\321\370\020\351\337l\266\235\326\2211\300\367dK"
+	.ascii	"\326\303\243\020\037\322\250\362%\216V\326\030\314v\005\306\354"
+	.ascii	"\254^\2530\316T\030gX\264>\3051\021\022w\017\007\007\353\226"
+	.ascii	"\241\335W\017$Y\377\303\370C\242_\310'\354\033\016\r\341D\275"
+	.ascii	"i\2235\333\0069\27260Y\3474!>\214\221j !\311Z\004\351\252\241"
+	.ascii	"m\253+\206\366%\210\355\013h\354\\\250\247\247\3435Vb\024\013"
+	.ascii	"\201\342F)\3619)>\215q\371\221\365K\310\332\034$\355\\\350\306"
+	.ascii	"\215\360M\001\276\202pE5\232\264\2637Y\013\253_\341\242kc\262"
+	.ascii	"~\tS\373%\324\330\016H\262sa\2336B\274\022gT1\024\211%1\237\032"
+	.ascii	"\03051\231\254\205w\030\240\002\326\227\365M\334\355\233\360"
+	.ascii	"\262\003\320\265s!\0336k\032MD\026;\005\341H\342\324\005\205"
+	.ascii	"dnM\3267\321\2659\320\332\271\260\256n\255+!E5dg\301\035\216"
+	.ascii	"#T"
+	.string	"6G\332\330Y\3267\241\264]\340b\306\214pM\0312\004\250\241\271p\215P\215\222\"\271\260\254\205i\212Vf\324\275\311\372&\342-\234\023\236\201\253\332\243\232\333M\2642e\016"
+	.string	"\246D\332~1D\214\030a\334"
+	.string	"p4-\331\253\302]\030\347\036Y#\365#k\341\030\241\022\0344(gY\013\3372[\353\206\211\323U\326B\267\225\317HcI\2330\274\377\300a\215\033kSY\277\004\223\335\201\230\235\013\301\200\311Y\332\210,~\242"
+	.string	"\216*0\371\t\231\217\031Y\277\004\323\026\001d\347\3026a\333\023vo\257\312\233\254_b\306vR\261\261\t\273\254q\034\307R\361\220\035\001\370\270\\\330\345t{9\270\326\262\026n\021*\351\030B\275\202\200\274\r\343imMH$\213"
+	.string	"\302\020\300e\2470e\347\302,Y\204@\3268m\215\221\326\254\272\214^\246\330\240e}\0044\331)\020\355\\\210e\235\n\261\b}h\"\262\370iDlF\255+\216\2458`\345\210\330x\313\372\b\320\261U4\331\271\020m*D\023ZY\343\350\032\307jV?\250q,\305\001\320\013\027\2518\241\225\177%\223m\270a\3012\034s<\356\266\212-;\027R\241\"\234\352!\262\270i\004'\037\034\354\265-%@\320\\\032a\364r\204\331)\254\355\\8eJ\231\035E;\"\361\033\331N\301m\347B33\341\230\036\"\213\207XP\231Q\353z\222\206fk\253\200\333\2710\312T\030eE\323CGiQ\\\225\266+\rN\231\254\177"
+	.string	"\035[\005\335\316\205R\251p\254\204\024U|\203\204\227\024.\257\032\307>8\310Q\2160\341C\2731E\r\230\254\177"
+	.ascii	"\032{\205\221\235\013\303\276N\205"
+	.string	"aB\036\332\210,\036\nr\233\272\243j!\272\263\333\277\031;\027\202\201\255jJ\030\241\"\252\262\240\255\211\216\032\f\023\343b%\353\033@m\227`\332\271\360\311:\025>Y\371\366\f\243\230\352\252u\322\205\203\274\307#\252L\3267\200\225\235\0011L\230\b\273t\234\242\\\027v\005\211\364\030\002s\222\227w&t\"l\302va\372\202\025\234\343QE\213\227\261\375{\332\271pk\353\214\3652\305\212.\272\177W;\027F\243\301&z(\307(\026r%\032\307`8\310]\340\340Te}\003\020\331\277\037;\027&\021&\t6\331EHTDV\033D5\3151\251\3061\030\016~;\216\\Q\222\365\r\020o\270\313\210\021!\222\365\203\270(nL\203\255\246%{U\254\013\221\254x\277%WhL\262\026\0361\202\262\322\225\265\360J\250D-\"\303f\314\0265[\242d\375\002\224\3310\244\b\021\"$\"\215\233"
+	.string	"\260\327\264d\257\353\302!\027\0221V\245\210Q\313\372x-\312\314\271e\375\002P\331\302\252\025\272\204Y\313\372\005\340\332B\252/rB\216d\375\002\\m\341\024\213\206\317hJ\326/\200\322\206\023\327\344F\330cCQM\213\033\233\254O\2006[\270c\353\213"
+	.string	"q\373\005-\035:\204L;\216\343\241c\\\204&L4m\377\302\250\013\231\310\322\230\274e\375\202\215\035\341\r!\324\2058\216C\310\364c\034\307\030\266H9u8\001\234\354\177}\376\333\230\310)\216\343\033?i\354T4l\377\365\353o];\374\304\225]\003\360_\2637\300\032\2378\236\312c\022\307\361z\267\227`!\352aA\374\377:\216!\210\245UOHF\361\320\212TV\365\204TV\345\224\203\004\246\352)6z\3522\252\242Z\221\214\252\234\234\214\342\241\234\270\254\312\t)\256z\n\357\217\213$,\244\002\005\020"
+	.string	"@g\303\373\343\"\t\013\251"
+	.string	""
+	.string	"\270\311\264`\3716{\230\320\246\320p\303qC\216\360>\037\240>p\022\250\311L>ah\323\251\004\302M&\013#A\b\001n2\205\226\311w\005\005\367\371\260tAi\202E\020\024h\202\f\260\323\007\212\002\312\314\340>\177N@\221\0258y`\370e\021\004\005\322"
+	.string	"#\235<\315\241\223\247\231B\350\0024\331\002~{\216P\227\303\t\370\355\271"
+	.string	"\032\204\342\205\223+\236BA\272\371\376<ah\013E\001\bF\320\320\331\302D\006'\363\231t\300\362\205\223@L\030j\002\374\366\344\274?.\222?\314\344\013\023\360\323\251\002\232\302\004\007\244hq\302\004\322\004\024,\250\200<\261\002\311\"E\016\374\262\220\221|>\2230\323\005\374\242"
+	.string	"3]\b\217\033b<_\240\344\363\204 \250\n1\2369+^\250\020\206\373|P>\337\027O\241\023\032\234-b\230\340T>"
+	.string	"\277=\304\023\313\244\363'\203\021\205\030\314\023\226M\023/\234\\2\177\222/6@\233)\226\314 \242\020\372\376(e\234xY(\225I\b^\230\371\204!T\201\205\025*L0a\231|\237A\346\322\004\031I\025\224M\031P\023/4\3714!\347\375q\221\2042\2279A0\220\360\373\363c\342\231|\177N\030\341\227EP\305\262\311<\001\372\300\317\217P\263\351l\2720\362}\201\tma8\237>\260\263\351\362$\337\037\r\277P\240\027\250\0251B\030B\210&3\t\364\256\200\276\260\214\022x\204\\@u\236\260\n\036!\027P\027\352\302\3042\371\256P6\223/\226&z\232\314'\314\302H\242\001\313\344\273\202G\310\0054\250\003M\301\343d\302/\nP\236\243\n??&\200`\250\br\302\320\343}>\b\223p\022\005\361>\037@\270"
+	.ascii	"M\252\360>\205\340\344\313#\374\371yO`\310Q\001~{\204&\340\267"
+	.ascii	"G\370\"]\024_8\t\263(\001~{\214/r\231\002F\036_\3442\005\274"
+	.ascii	"L\276+\216!\204\0201bH\242\001<B.\240\302\373|H\241E\n\026 \\"
+	.ascii	"P:\177N\274O\347\t"
+	.string	"\343\022\232|\300\273t\002=\231I\f/\222\b\337\347\303\213\025\212|\001\365\t\372\254\320\025\332\302:\357\322\t\024\204\357\363!\210\371\204\241\313\367\007\204\223\371t\3768\225?(\022\372j\200>\235?\316\023?I\246\362\r\202\022af3\0050\007\303\003P\0230\263\311<f\220QB\fg\t\313&\223\247\330\3634\341\0033\037@A\fg\t90\006gS\006\314\374I\na@g\311|\00156}\224H'O\223\371\002\212d\241\002\205\242\317\t \241&\020\303\013\344L\200\263\005s\211d\241\002\005\035\350\013\224l.\231A\033FB\237\357\217\220\t\032\340\344\206\215\317\366\007\367$\201XX\251L\262\313\2443\205\r\017\0303|\360!(\t\204|@\202\007\206}\2550\310\376\362*<\301\005e2\bC\361\203\017\3603\031\364\001~Q\320\300\001\003X\203\016\254\341=\276H67\013\025(\004\341\026\326"
+	.string	"'ah\020~"
+	.string	"\316\201!\2005\260"
+	.string	"r\302P!%\005\020,\337\"\234\001>\302:'8L"
+	.string	"\305"
+	.string	"\372\306p\272\370\251\310\2011\300\032\"\270\317\207\367\351T.\177\234\t\350I\002\271\310'\b\245\360E\006AO4ShX&\1778\310\370\tz\357\363a\371\343L"
+	.string	"\374c\302}\201\226\315\344\003\224'\004A\201\212I8\211\242\202\013(\220\221|>M\004 (\251\002\212\024N\370\004\n\023\017\2340\302M!\347\t\007,_\370\351\f\n\022\202F"
+	.string	"]\2460f\270\317\207\037\023\n}\352\346\t+\202\240@\302\0250\023\005\370\351\364\201\036_ f\213\373|"
+	.ascii	"\001'Q,\177\230B.\200'`!\026N\004A\201\"\220\361\023\364\256"
+	.ascii	"\220\361L"
+	.string	"\002\001\t\261X>\223'P\260\220"
+	.ascii	"\206a\030n\236\360\002%W\320i\236\240\202\303\225\314\347\333"
+	.ascii	"|{\366A\b\301\203\020H\304pO\202\204\017H\370\240=\t\022B\204"
+	.ascii	" !\204\020\373!\204`\233'\304p\226\360\276\300|\221\313\024\301"
+	.ascii	"\237\021\3762E\fg\t\303"
+	.string	"\027\t\355I\376\234\360.\235*\344\3640_$\233,T\240\260Y`\200a\344\360\t\253x_0_\345\273b\203\013\312\244\213\237\237\344\211\030\317\240\003\216\357\217\213d\213\027-\214|\227N\025\340\2473(\b#Y\200\237\316 \"\324\351\276pr\305R(\351\342}\201\311b\303\3739\\&\337\004\3740\223-\236/\017\217P\t1\340!\214t\001\232\004\202\231%\304p\272\030\302\367\371\020\004\005\002\021\004\005\322\360d.\201P$\374\272\240L\252\b\202\002\t\341\373|\340\021r\001\224|\2370\024D\323\t\004\344TV\260l\276,\024\311#\344\002\332>\341 \226G\310\005\273\004R\262\317\366>\037r\222\307\236\2463\205\030\314\023\234+@\203zr\216\313W\347E\236\260|:\235'\240A(h\200\223@O'\017\362\205\223M\346\362\351t*_$\314l6@\b3\233BA\345\373\f\202&y^ e\270"
+	.string	"}\362@\260l\n9Y"
+	.string	"=\223?&`\330\351\363@\013\250\t\350\222\031\224\001\371\363\363*\221\360\323\031\364>1\300H\240\344\263\307\tC\231\tp\001\232l\301\243\314\031\276\304\373|x\276?B\313\327G\t\275"
+	.string	"\336/Pr\005\027\240\311\026.\204\240B\023\240L\240\f\230\371t2\237*\224\305\245\223\371|U,\337'\023\372.\2110\362\005b\302\302\027\210\331\"\t\377\274(~\2141\222@G\235\027\210\331B\371\3060!\003\213\030I \343\007;0\022\332\200\027\210\t\357\021FP!C\331|\341d\n\306\"4H\370\202\017R\303\363\205\225\311\247\323\351\342}\036\357\363A\b\210\t7\205\224\303\027N\256\360\201\276O\236wE\214'1\t'Q\350"
+	.string	"1\341\246\320\212\030\317\234\346\t0\222+\236\302'\254B\247y\002T\bN\302,^\240\344\363\004\345\323\b\263"
+	.string	"\004#\310\350df\030\271\342\304\t &\274\237J%\253B\212\026B &\314\276?I%\213 \364G(H\b\303\371\303\363|_\260\360*\237N\036\342\362\375q\221\354I\002\375N\2400\321\223\004jQ(\231\360\333\354I\002a\200\"\225\312\344\017\316"
+	.string	"\206\3002\371\256p>e\364\344@\221:\313d\206\347\013C\231=\357\212\007\b\005\001ih\236\360\302\314'\f\367\t\253X!\024\004Dl\236\340\n\t\005\001\035af3E\363\004\230\331d\266OX\205\262)t\3022\371\256P*Md\200\"_\274(\224\312\344n\236\260L\276\317\026\206\"O\210HqBD\n \024\372>\227\313\244\253\024\301d\205\220(\240B.\204\367\371"
+	.string	"\025r\001E2\203X\by^\024o\220\214\026\310\024*X\b_e3\tC\233\314\r#YH\241\233L\025M\250\262e\006AY\250\220\013\026\205\020H\2452\331\302H\2568\201\302D\373.\235'^\274\317\241\214e\362]\221\204\223K lD\272\367\371"
+	.string	"+\205\2360T\004\024\031\343\205\205\200r\\P:\177\220\310\026\351>\337&\f'\022\351B\237/T\250\211D\356e\223\351\002\022\331B\233\314 (\022\3516\235L(\363\347E\"\2010\022\2062\177\216A2`\017\226\3573\351\003\365"
+	.string	"\004\024f\272"
+	.ascii	"!\324\354\361 "
+	.string	"\206P\223\371\343\001\b! C \021\003\304\273\024\372Q6\231 \236P!\020#\3001\336\346O\262\211\\&\337\247\017\034\204DB\360\342}\006!\221-\fe\376 \221m\022N.\221\310\366}\201\tE\"[\027\224\316\037\255T&7|\237\017BA@H\347SF\217R\231\334\340E\256\370`\347\203\020\204\202\2000@\337g\020\212\314\360\"\205\202\200\204-\374#\004}W\274\360\213B(\bH\247\247\311\374\t\002J\262P*\223\030|`\247\023\210\205\262\311\002\fM\276)\300&\226\r\20029@a\246\013}\237\017J\020J\036\240\027\206\312\200\026\215/\234\\\361\276`\302\312dN\217\220\213w\031\204*\2310\224\t'a(\322\005h\0226\276@\311\246\206\357\363\001\204\223\371\376\2740\004:.@\223*\360\f_d\212\007\236/\223\207\t7\337%3\030\004\005\202\006\365\344\274p\362\271\024J\272@>"
+	.string	"\007\2750T\237\020\343\311\341]:\201\364}>\200\240\340X\344\341q\346d\200\341\374AJ\360>\205\226\257\222'\t\375a&yt\356\363!\306\023D\214'\206g0(\t\244|\376\2201\2369M'\023\n\025r\001-\306x\177\202\204P\360\374$}\202A\306%\023\310\363D2\203\240\310\030O\b\336%\363\371|_8\221M\246\005\310\036\241\237\240\r9\360\013}\237NX(\211\\6\231.\220p\022\212\004\022z\302.\274AP\t\206A\370\371\276h2\221L(\364)T>\227L\240_\223\t\264]P\276>\312\030I\240m\204\376$_\3748\203\236/\334L\241|B"
+	.string	"\224<\361\"\210G\347\347m\306\020J\"c$\201\214\314\344\206&S\371B\205\2201\222@\310\030O!\361]:U"
+	.string	"Ba$e`\270\317\207\344\362\231tb"
+	.string	"E\302\315\027\250\331\303\3741\261|&\235.\216??\316\247p\b}\337g\317\213\002FRF\020\212L\302I\024M'\023\026\372q\262\200\006\365\344\300I\026@B\315\026\376I\262P\244\322\231\0024\250\207\b'\177\330\246\363\207\365\371\371a\337\245\020\314\204\177\222H\026*P\030.\3377\210\205\360\205>\205\234'\226M!\347\263g\030\344\\\372\350\373|\210\341t\341\2022\371\343\342\b$\324\334\301W\311|\361.[\030\372\302\310\247\023&*\225I\344\362\351T\276\317`\323\311\204B\337g\020\220S)t\227N\240\341}>\020\177\202\200\222\320\034\236\240\037\344\013e:\233\305\237\367\005\374\223D\362(\221\316g\322\205p\311\f\022\006!\227\314\240\234\373|p>e\3648\2372z\206A\027\314\237\344\t\270\371\002\275/\234*X"
+	.string	"\344l\276K\244\262)\003\312\023\364\263\337 \031\260\316\361\205\223\313 !\344\023\3124\276\340\343\202\210\021\310\027*T|\241BH',l:\231P!\236c\210\020\"\220/\370d\020\201\204y\234\320\r0\234\313&\023\306\021\352B\362\rj\312X\032O(\237:\033FR\3060\347\355i&}\224H\030\232\344A.\177\234>H\370'\231\001\t#)#\003\212\021G\030\316\237\242O\017\323\307\270\034\361\223|\302Bo\023\210\\\216X6\223.\226\311w\211\001\216\341t\301B\221\3177\006S\005\370\355y&a\",\024\324d\n\227\357\033\004\375\301\367\371"
+	.ascii	"=\001\344|\236\260|&a<\235<:P$P\362\231T\341|\361|\241C\350\362"
+	.ascii	"\205>\337\027\357\323\330d\002\2611\222@\354\373\263\\2\201\332"
+	.ascii	"\366\205\223O}\237\017\024@\223A@N\245\261\311\374Q\276KdO\022"
+	.ascii	"\310\330\223\004\352I\002\r{\222-\340 \241\347\363\205\233\314"
+	.ascii	"\241\363\371J\240'\t\344\336\347\0034\250\007\204\223\231\001"
+	.ascii	"\032\324#|\221*\240A=\304\347\273d\276p>\203\366\213\f\276K\247"
+	.ascii	"\n\320\244\013\350~\221F',\224\f\276H\023\320\240"
+	.ascii	"\036\342R(Y\202\023\026J\356\373|x\2761\230@\021\020\341\373"
+	.ascii	"|\200\205\202`!'\022\bF\220\0050\322\205\366$[8\231\355\213\027"
+	.ascii	"\305\013'W\f\177\234J'\354|\25286\235L\350\363}\321L\001\004"
+	.ascii	"C\305\323\t;\201r\200`\250X\276\312\246\fh\263\001/T\250\370"
+	.ascii	"\342]\262\257\320O\322\001,\274?\313\024?I\230\331\303\\>\320"
+	.ascii	"d\002\t\341\030I \341\262\231\004\002r*\233L\240 |\237\017A\310"
+	.ascii	"\027N>1p!\371>] \223Ap\361\205\223+0(\237.\211\027N\256P>]\022"
+	.ascii	"K\246\nO\037\330}\372\300\033\372\302\311\347\017E\n\025O\237"
+	.ascii	"\026M\031K \tgP\f\023`$#\240|\006\341\373|\200\002\300\230\323"
+	.ascii	"t2aeS\350\004\270\371\002\301P\241\013,\223:,b\b%5\300\360\273"
+	.ascii	"t\002q\bza\026\313\346\353B\221oO3\271BY\fza\026\3603\tC\201"
+	.ascii	"oO"
+	.string	"3\371\374A\221M'\023f.\233\316\023/\230\260\322\304\273t\002qx\221\3562\305\273t\002\2651\336e3\305\317\333l&}N\304\020J\032\241\310\367\207\311\343|\252X2\203\206\360}>,\231A 6\240X\241H\022KfP\253bM\261.\231A\354\033$\003F\346\fa$e\004_\360)\362\3608a!%\322G\t;\233H\035\270\311t\252\b\022Z6\231\017\200@\b#\031\001 !\026KfP\021n\n9\225\310\027I$\264\371\006\0019O,\231*\340\244\213\027\030\232L\025`\023Kf\320\361\375\351i\2320\312\200\231/\2300\023\332|Y\374\274/\336\237#\254|yx0\274K'\020\022~\276A1^$\374\303\204\221M\347\013\314\247\323gC\213\367\007\206\235O\237\026\0174\231I\024\236N\023@\317\027ffp2\341\344\212\030\311\237w\005T\007\366\351a\276\017\200\233Lg\020\374\262"
+	.ascii	"z\276\360\022\303\n\030I\03190\023\210\231\302\317\253T\232x"
+	.ascii	"\341\344\263\270\\\3768}\240\357\323\007\3569\276@L8\370\376"
+	.ascii	"\3644\223\031^8\371Dbx\221+|\240\311\347\211%3HG\306\363}\341"
+	.ascii	"T\276O\244\0174\371T\026\357\363\001\372\343|\302M\247\022\251"
+	.ascii	"|\202P\362L\320\323d\002=\223E\240g\022\tC\237L\036d\323\211"
+	.ascii	"\374I*\221\316\247\214\036\r>J\230\t\003\212\374\371a\272\240"
+	.ascii	"##\371\363.\221@\317$\224\271D:a\241d\216\206\027|\220<A?H\245"
+	.ascii	"2\031|\221\305f\017\363'\211T*\223\300\367\231\204\261|&}\220"
+	.ascii	"Jer\b\303"
+	.string	"H\236w\311\341>\037`$e\260P\t\204\220P%\023(\331\224\201\002\366\351a\376\360hp>_\t(\225I\027~\276\360\013\344\324\021\202\221|\262<\357\022\tCp\237\017M'\023N>\337\237W\251L\006\300G\t3\203~P$\024\210\371l\341\243\204\231*\226M\023??\316'\206\237\037\347SC_\241\237\344\213\026\276\317\007\020\320\347\373\202\371\\J\360\276\300d\361\223\204\2350\020\212\224\361\204_ \347\213\202\0174\371\303c\204\272,\236\257\n\350\333\223\f*\276/0Y\274=\311\240\r#E\214x_`\262x:a\345\013\r\376$\205\340'\323\001\023\374\340\027\312\303\343l\341\347\313\374\tb\302?B@\031N\2400\301b\303\373\223TB\341\244\213\027\300\237\344\213\027\314%\364}\302I\027/\210\367\371P\3340\364\205\223)\274=\311\347\033\004\224,\302H\021#\340&\323m\302H>Q\370\230"
+	.string	"\332\367\371P\334\313\367\371\302?L\236\246P\360>\037@@\237Nh\363\205R"
+	.string	"E\3660y\232\316\030\311&\023H\007\006\234t\361\342\201\237\237W\t7_\350\373\f\202\235M8\351\342\005\207\027\371\366$\341\037\347\013\235\027\231\341U>\205\234,\236/\374\252"
+	.string	"7\337\347SH\251#\264e\300Le2(yB\306\363\205\341\244\013#\234,\301\001/T\210\370\343t\226\200\374A\341\347\373c\342\304\013\025\312\360\366$\341\346\253|\276*z\232\314\3463\371\200\246\223\t\007\001\tA\233N\345\004P&\364}\2760T\206\017\234t\361\242\b#C\b\0017\231\356\023V\321<\001\n}\225\316\247\n\030\352T\021\004\005\302"
+	.string	"E\302O\247\212\237$\363\371B\207\360} \2703\350}\202\200\235\316'\b\3412\005\334|\233I\240\347\033$|\2211\234.~0\222\004\334d\n\271\007a\304r'\004\b#\210\370\240\363\021F8aA\003V@a+?\004A\201\220J\036\020J\036\020Mf\022\b\204\362\t\005\361\341\201e\212\030N\027\277g\322G\251_\240\344\n1\234.\334\377:Z\307 E WK?\222\034\257\204>\220\2049\223%\354\362cH\352F\007\t\021\211\361\312\0300,:XB$\256\330Y\234&:G\204k\214RV\220\314d\275\001-:Bt\256t\204\350\030\301BBg\310u\214\350\024\311g\270\320x\322)\242C\3048EDl\356\247$\312\226.\253\375\353X\025\343"
+	.ascii	"\021\273\262R5\244\313\324\274\211\023\304\230D\234\362\205\007"
+	.ascii	"\021\325\260\212\021\r\223&x:@\214K\305\250\037o9t\246\214N\301"
+	.ascii	"8I\304Tu~\030\227\260pB\266\232\350\3700re\201;J\322\351aL\262"
+	.ascii	"\226#L\207\207\321j\352\016NUg\207q"
+	.string	",\no\313\032)\243Y\265\255LR\326:9t\242\256\243\343::\262\216\016\266\257\257\205BfJ\253u\240@\240\212c\"\235\033:8\256\003u\251\016\224q\317\270\256\027\344%hP|\255^\211\350t\224t\236t\224t\234\250,]\307I\247\211\206\331\226,\235&\035&\033yT+!\224\271/2\013\330\330k\321\021\235#\035\033:G:5\274\350\320\270N\r\235\244\366\207\331\223:\235$\035$\242X\222,_\330\2700F\316\322\354\016\350\351\304:3tb\035#\273(nT\235\241\353\030\351\024\255XD\210\354\351\024\351\020\025\351\330\210\334\354$*@\236*\320e\257\261\030\234\234>89|g$\270\310\364\242\252z\317\341\213\363B\210\321\2168{;I5\352I\256\321\244\332Dlw\200\350.\347M\316]N\0258\224\306G\032\336s\2529n\310\364\340\362\345&\257\311\r\013\025(\250\266\271\262\n"
+	.ascii	"\331\177N\033a\234\022\037Hv\305\267\335\226\004\007\0176E2Z"
+	.ascii	"\216J\205\225S\267\277\25249\313\372\025\270\2613\227\225\352"
+	.ascii	"H\230\"\2435G\032^_\262\360\324\344\310\241\205\261\241\224\346"
+	.ascii	"\350$\224\373Bwf\356\230c\213\245A\361@C\034\002\306\315\026"
+	.ascii	"\365L\261\314\213^\233!2q\234\264e}\264\201\206O-Zf\370\325\343"
+	.ascii	"MT^\326R\2608\226\026['Hhd\311\032\313\235X\025n\310\325\205"
+	.ascii	"\252-,\353`\2246^:\336\206K\330\276(\2745nZ\031n\212\315\233"
+	.ascii	"\030\2547j\234R\230\261\214&u\005\t\030!\221aZX\233\032_\214"
+	.ascii	"\\\262\024I\203&\353\230\350\216\325\245i\311:\247K\246b3%E["
+	.ascii	"\315\242zO\270\020\201d*\262\275\031[\202|A\2639=\266\017\273"
+	.ascii	"\024\205\201\3212dK[\n\2235\022\262)A\262\226\262]\270d)e\021"
+	.ascii	"\342I\005\t\363J\323C\224\\\371\302b\346d\027F/\353\"\352^\216"
+	.ascii	"\254\177kQ~|\251\323\324\325\211\312\207R\326:\236\260i2\035"
+	.ascii	"\356\3301\264vEe\370\203\310\203"
+	.string	"L\0177g9\204vd\210\246\f\233\252\224\352\234\262\024l\350H\222\254\213YLW?\312\206H\304\2761wTQ\210K\277\032Hj\356\310\204o\216\262\310\254e=\234\233\272\341I\207X\264\240\344\200\023\243\341\241J\204,\214X\224\003\212\224!P\334"
+	.ascii	"\320c\311Z\016\230\261L\225\273\276\242\257a\021\264\262:3YK"
+	.ascii	"\215\031\244\270\230\274\206UXZXF]\302x\035\323w\243\n\227\220"
+	.ascii	"\b\312\326\345\212\023#\265Mk\022\223\322d\250\367\245\214F\027"
+	.ascii	"\023\343\3350\312\307\231\032K\206n\332\2535\256\032[\307\330"
+	.ascii	"l\n\n\235\222\241\0317Y\366\230d\235\223d\355\353\333\213c\242"
+	.ascii	"\234$F\2442\2528&\312\211\346h='\311\215-(Y)\265\272\003D\212"
+	.ascii	"\344d\025\311A\262Z@\025\307\321\270\310\214\222\333\245\024"
+	.ascii	"v\243j\3449H\260rYU\222\027\254#dJA\236@\255W`\332T\271r\231"
+	.ascii	"\206n\254\274\365\275\331k\321\022U\016\021\252\234!X\037xUa"
+	.ascii	"E\005y\316\220\034!B\316Py\t\311\261"
+	.string	"\3322\205\n\214\025\026\242\"@\262\316\251\322=\252Z\312`\235\331k\021\225\0359@v\344Lu}\300\005W\325\306\3439S9?\236\304\354\264\344\374\310\361\301c\212\223i\324:\204\013\215\033=4\322\352\344\006\252\f\226\275\306q7r\244n\344\350\300\300(\216\217b\031I\254\300\2509P\317\321\221\023\265\245\013\025\255\234\250\234\034{?jtm\001\211\0201\023\343\370\025\321W\232\342+({\215\177\344\330\310y\312\261\221\343d\004\203/;\275\250\034\245\3478\3454u}U\3454\3450\r\001\361R\r\222\221\244m\301\222\263\364\223*>\321\322\232\241ds))\242\227\265t\312\003L\221\034$!\020):\274rh\b}\\\2312vdE\323]=\221\231!\234f4p\325#\243c]\260\n\027\351YQ1i\343 c&\216\210\255\001\345\016K\316\320\221\316j\316LN\\\314\241\025\346\253O8\266\366"
+	.ascii	"\222\024\206\257G\360\t\025\221\032q\204<\206{V\352\372\366\212"
+	.ascii	"F\214IStzz\305)\2455(\\p\212V\003\240\241\224\366F\3305\204\016"
+	.ascii	"L\264\032l\"G\335\263\342&\311\326\021\033Z\326\033\250R\217"
+	.ascii	"y\324#\236V\007K\322\340\362\330\374\210w\274\223\312E\345\216"
+	.ascii	"w\3076N\340\320\360\221\271f^t\323\243]\006\343\222\244E\n\005"
+	.ascii	"x\354\342P\224\207\024\220\254\213KA\25179\252\254W#\244\343"
+	.ascii	"\231\343\232\343\231\243\232\353\020a\271{:\304\370\252\261\024"
+	.ascii	"\216\016\3771\315\217j\330~Gj\356\340\262>\316\235m\353Q\021"
+	.ascii	"#\223\365\021\215\373E\214\025\220\t\340\355\377h\246x\205\250"
+	.ascii	"\025\246H\221\234\026w\256z\244\256L\027\235E\345\355\216\f1"
+	.ascii	"\016\313\304UG#\016L\206\241:+Y\037\307H\213b\314\310\235\311"
+	.ascii	"\372\023`\263\377\343[\223\251!q_nO\262\236\274y\022S\224Z\341"
+	.ascii	"\212\206!V\357\304\244\201\031\316=])3ul\223\266rVg\320d\375"
+	.ascii	"\t\234\331\377\321\213\021\255\355SC\212\273\b\255\310\340\264"
+	.ascii	"\271\312\372\353\364\310"
+	.string	"\305\bU\202\235\322\220-\302 W\342\324\320\261\031\367\316P\rQ:j\311R\206)I\335Z^\361M\254\357J\315\215\310\346I\036\222,\3046y?\264\322\212T\206I\304\230\205\3012,\322e\244Oo\256\004\277\314H\001C\345h\345\210F\304l\232c\372#\332\177dr\254\262Fi\341\205\2763\253\2066+\t\361\343T\314\026\252\030\2253\036A\206\324\310\372_\313\374xV\006\274b\344\bu\312Q\312\223\2222G)-\304\311\262\341fVf\345\204f\310\261\354\007FY\331|\361\022\247\027\345H6\303\t\f\253\345G\262>\255;\245\261\243\024o\316\212F>J\337\"\031U1\021\013\323xd\302@A\3711\354\377\031a\267\206e\256\330\031\311\232-\n\361#\024(D\220\216\034\301\216_cHy\323'?~\375\354\232\016\222\024\250$\005\315T\207\013*\223\034\211\223(\311)\310\234*\262!\005S\025"
+	.string	"0X@\036\017\310\223qu=\024"
+	.string	"\017^\300\204`D\245N\3240\252\030C\003"
+	.string	"\003\b"
+	.string	"\200\004"
+	.string	"A\002\fmw\307\232<\035\322\255\317\250\246\017\025\027\274N\277\340\023\324$z\257j\372\007\364J4\324\364VP\215\020\nP\221\345\272\200\255\240\021y\311\233W\344\004 \003FAf\037\376\\\321\354\203\240\204X\250U\325\004\221\330&\361\214t\034l\371\017\2465\215\212o\244\2312\034\270\217\200O\002\266\005\320M\027@k\020\177t\356\341\327\225\270\216\305\220DV/\2152}\325m\241\335sUd4\347\201\023aV\255\371\330g\211\031'\351\004\2001\330\003Z\016\271\352\244\303L\037Z\200\327\352\314c"
+	.string	"*x\317\365\320\346\263.L\330\f\021b\362*\327\037r\263`k\335=z\f\207\232\256\263\240\272\033\246"
+	.string	"v,cO\276s\036\343\005Kq\321\272\323\217\357\022\033q\3009R,\350\335`\236#=\322\322\022\243\262\3409\364\357XJ\201Qc\314\013\307Q\364f\356\3762\245\373\377\372\205K\240\327\304\362\307\372\334\020)\242\257\302\361\231\023\234\214\346B\251x\340\2175\"\b\270o\333\0179\201/P\016\324y\210`\226\361L\334\307$\244\\\214\rh\nc\272\320\267\271\024\241\275\351\006\246\336J\302f\240\227\321#\372CU\245#\276\264\021,\360\355\364\351\306\240g\274\347\301\343\r\354\264\377:\251\227\224\"\177\224\367\232\340\245k%\301\224\270\354\305"
+	.string	"\0011B\243\211\030\020 \005\251\2606\304RF\250\022V\300\031 \262"
+	.string	"\255\256\263d\026\f\001\177`\356C\325\252\345-\021\240\030G\251\263\245\326\005]K\332\\\2229\311\302\363"
+	.string	"\325\270\311Pz\345\b?G\003\b\372\354?\205\027\237Z\324\204\f\013\271\311pNSD|\370J\344\220#\362\257~\373?\225\220?Q6\215\021\226m\223\207\033\326%\310B"
+	.string	"KI\177\214\305Iop\335\372\323\377*\3515\\W\316\264\036k\204\344\356\237\227\344\030\337}\3239\371\350\026l\234Y\204\0205\321\326)-PA0\037f\"\367\275f\251\025\241T\201\210\277\304`\201]\375\275\344\036*\347\343\356x\201g\226\022W\243'\2778eN\f\033\277=\025\2447Q\236H\265'\274t\222\022\227W\210\036\236\033\251\333\235J\203\311\212\0227\362\305E\323y\322\035\332f\207\220\304\020\2363Z\251"
+	.ascii	"\002\337\275}!\031@\210\315\215\034\223YK\274\332\025w\377U\177"
+	.ascii	"4UG8\374\222\355\f/\025Y\001'\227B\273a\025\270T\026\230\030"
+	.ascii	"\005W\344\306\306\377\004w\3228+\205\212:\307m:\201f[#\266\r"
+	.ascii	"\327\350O\2703\"r|\273;\334\305S\275\335u3\224/\266\340\350\335"
+	.ascii	"\223\201\253T\305\251Y\353\032E!\331,\366\345\275\260\203\274"
+	.ascii	"\304\355\327\322.\221\351r@~\336\240\336t]A\021L\001ob\323y\027"
+	.ascii	"\f\027\347>l\353\266\331\306Z\024#\300\021A\240q\307\321^S\254"
+	.ascii	"\367\210\307a\227\343}\325\301%t\347U\016\206\035v\253\016\211"
+	.ascii	"d\212\271\377\224\201T1q\"\225\313q\2232_\2048&\342<\033#;vp"
+	.ascii	"\250\334&\312\276\2231\367\310\205\351\316\3074\263{X\271\375"
+	.ascii	"9#3\215\220\200R+\242\352\255\201o\033mu}|\267\211b\233\002\236"
+	.ascii	"\351\",\b;,=\200"
+	.string	"\272/\2725Ct\302\361\2248\212o\2038\\S\377\373\252:s0\031\326\210\277\365\341#_\332\001q\375Z\301o\024\372P\212o\215\016q\215n\266\355\"A\2329\206>\346\222|\244R)\241\2573\002\031\217\344\262]\215"
+	.string	"\312$\226n\363h\273D\347\313&]x\247\b`\205H\260\340_a\270?\n\251\020z\034\234Td#m\336< \002\006\"\376\330\376\017W\305=\312\206\324\304"
+	.ascii	"\0343\376TN\003\207u\tyB\266KI{\263\224,J\336\320p\341z\353\013"
+	.ascii	"QI\254\216e\317e\201w\264\002\346\206?tt\375\365\301\034W\024"
+	.ascii	"\224\372a|\273M\350\323+\017\215\310\325x1\362\261oF)\325\343"
+	.ascii	"[\270\256\341\027\267A\341\355\346(\023\2116k\001\276\266L\347"
+	.ascii	"\200\231\220\310\r/g\336\030\211\3551n\027\336Hw\3473\366\373"
+	.ascii	"M\036\022c+\214\025\363hB] \021\304\253R\204\344\341\365,+\027"
+	.ascii	"\3400O\332k{Sx\345"
+	.string	"'\363\324\237\032e\006\334\370\017\361\\\026R\237\f\325\004\0059\246\252\344*\304\225\333H\240\333`\\\372\006\r\250\311 \214\221/gXq\212\323\222\002Jr\337\031@\212Q\342\305K\003\260e\212\273\330\363;\315\313A\f~\234\374W\253\211\300\370\246p\261\341r\317\335\375\307\250\0018\224\221\2724\306\021\202A\3709\274C\324]\203\300pBX\244~\366\013\304\\S\310}1r\321\324\376d<i-\3366'k\212\346\023\006\336\232\325\t\261\035u\026i\310k\037\324\241\243u\222DB\375\233\370E\325\235\327\001\2556\377\024\032R\222XF)\371\002\220K2t\025D\177\264\317\022\036\004\2422+\372\025wB\"\021\274\n\035\243\262\224\276}&\222\t$\221\031\212\331|\363\\\242\277\021 \214\026*Hij\324}\311\334G\207\205\205d\263\311_\362\232-\374\316O\261\310\302gE\036\007,k\350\365S\021\376"
+	.string	"s\343\363\215\261\334\337\373:A*\006\031G\252\201\035\016Y\251m\\\365\006\252\177k\013x\371\\y\261\f\377A\312\327XAh\361\322n\f@N\032\320\346\352\0176\273e;\303\356\030$C\271c\342\201t.2\004N\t=\323*\314\037\201B\325\211\334\025'\036\345\037\203"
+	.ascii	"\370zcE\311\365\002\341t\2038N~\377\211\374\2114\363k\235:pl"
+	.ascii	"IA\021&Fq\232\322_\224\177E#\357&\313\2218\322\316\b\352W\332"
+	.ascii	"\005c\332^\247\016\nW\377l\034d\2326\267\272T+qj\366\275\f\005"
+	.ascii	"d\344\272}\263%\243;\024\374\034@k\243S\344_\242\202\207\332"
+	.ascii	"\"Y\331\234\317\344}$u\353(=F\3509+\231n?\356\371\0047M&\023"
+	.ascii	"\023\303\006S\356\340\303A\214\254\265\004\\DwQs\337\206\214"
+	.ascii	"\315\271\207\306\027\t/\332\020S-\035\200\330\236A\235\257\031"
+	.ascii	"\374Iu\265(+>\301\246\376-\265\362$\307\272X\201&\021\333*W\b"
+	.ascii	"\231\342\225\246\013uz\261\317\375\036t\366\374C"
+	.string	"\220?B\004n\306\202\253\177g\025Z\f\003\215\222|bL*\302\230L\343av\207\2467\315.\030\360\nE}Y\221\372\256\021\204\177\373*{5\013\016\305\206\2435\371\351\352\007\235Zn\203i\252\325\336\277\240:\032+\2709,\034HF\225\b\227\260\266\025\315\304|\304t$\213O\221\306\36668\250\031[i\303J\217\007a\200\226d_`~\030\370u-\373Ws\235=\302~\255\215\340*\030v}\355S*\304\f=\004\355@\271\235\327!\244\341\"^\213r\235\024i\355\r\220\265\244lL=\255\277!W\271\273\t\307\0322\215f\2248\250T\336'EN\277\177CA\260k\226\305_[t}q\222\027M\343\035\n\201\017\340=\233\017-x\225;\341x\376\177'7\324p\333Pox\274\242\332^\314PD\3050\016n0\322\301\361\325\013\330B\237\3227\252 \227-\013<\356\0045\372\325:\021\333\224"
+	.string	"\255\323bbC\211\252w\3715\247\330\230:U\223\264\nf\036\002\337i\031\270\312\326\357\205\254\241hS\344\242\022\342\217Im\313oa\336\275\274\r<\334\027\027\260\272k\320{\027\023\363j\246\022\341R\354\304\266{\361\314t$\304\266\301n\036\024B\004\267\377?k\216\276N\344\213\344q\343\267\324\026\236{\013\277,s\373\240y\022 R\352\001\306\3066o\027\271\351\327\245\340^\324\n\003\203n\013\344P"
+	.string	")\221\237*\353\3456\355\320~V\233+N\016\311\177\240\024\232\371\255\034\314\212\274\236tjU\223\037\250\177r\022\374\007\256\352r-\236\253\353KV-\260,m\325U\375S\346?\315=t\205\246>\331\033LU\245aST\022\211\360\302u#\242\225h+\314\324\206;|@2 7[8\254\027\246\023\300e\024\254\275!)\333\306\375<\323,\350\371(\224\376"
+	.ascii	"\201\270\370!\032oa\313\220-\234Bt\357C\031]rE:\325-\270\020"
+	.ascii	"L\300\240\201\317\241\364\311\270N\r\367d\254\254\215\234;\242"
+	.ascii	"w\202M8jRS\347\253\304\025\373\242\330.\354\317P\350"
+	.string	"\364\232E}vU\222\332V\202\266\243c\251\005\316],\007\"p\002\232\273\002\264`\030h-S\216,\312\315cc\352\222\3217\243\323\207b\231\256\324\355]E\3133]\024\223\247\300;\250p\351\333\277\033\007`\004\205bo\332\336\301\257\362\310\366Y\327\257\322\3151c\243|w\f5\244)\2773ML\0068\225\261\033\347\322u\005\232\330\251\033\024\303\300\212\232\220h\027\271hM\377\032\243\205k\3161Gy\246z\3605\250\356\222\334\363!\305\330\200\037}\2272v#\272d\303Ly\207\350\374\365\f-\243\322A>\2247o\013\013\"\300\240\027z5\336F\213Cii8\370\371\321\221\016t]\333\222\340\321\345\007\026ff\241<\334j`\347\324\202J9O\245_\347\220\315l\304\016\242\2637MnM\231\327n\204\177\255\001\234G\235\257\023\356\260\032\273i\212\203!\257\206k\352\325\005 \331\t\212\303\021\377\212"
+	.string	"\227l\026\312\350\207\371\275\214\227\215"
+	.string	"[+\334=r\021\032\035\215IPW\254\260Q\347'\214\227Y\024v\257\274\332\233\003\300\201m\316?K-\234\026\345Q\306f\267\353\275\204\314\220\016\320 \003\022\220\0278\357\312_\210\302\247Q\021U\274\374 \234Gf\344\265i\030>\300@\345\345\351\335\351w\255\013\205\236\3271\253\005=\314\223\364}\300x\332$Ho\237\021m\251\311\374|\203 \257\276[\2249A\300\007p\320\202\240\272a\237Clz\323<\037fI\266M\317\310\302M\023S\353(GA?\033"
+	.ascii	"T\366M\266\273\201;\324*\365e\367\270\002\t\2768\350?(\332\230"
+	.ascii	"\346\207;\317\2450\177\013j-\336L\377\3423\301\342\212_\261\313"
+	.ascii	"eR.t\020\375\334,-\237\317\b\265l\365\225\b\242\206\020\005\302"
+	.ascii	"\305\376b\277!\237\367\b\256P\205\203H\002\240\212\354\"\005"
+	.ascii	"\233/\305(\024^\226j+\375\335r\326\217\237r\271;\226Ne\317`\202"
+	.ascii	"\346Q\365\026%\242\f\264\311\200\r-\232\311\276\351'i\031\026"
+	.ascii	"\254c\353\0168\033P\203\b\253\201\2765\251\351\324\250\022B\274"
+	.ascii	"}B\261\202\256\234\271\334C3\370\013\365\r\351\227\326\353.\027"
+	.ascii	"\007\0304\273K\t\315\300^\341\352,l\352wJ]h\017\002z\2176\251"
+	.ascii	"\273GQ\304?\fZ\273\275N\306\232\211&\332\214\230\332\t"
+	.ascii	"\207Y0um\003\222\274\356\016\263\315\272\300h8"
+	.string	"=!\217\327(\350\345\370\315\264\023oqx\261l3hj\253\267\366^\213\321\306\333J\342\304s\263,^\353\025\021\rZ\352\242\357-M\036\352\001R{\373ao\217B\n\254\361\036\353F\355K\t$\370k\342h\257o\265\002AD\n\357\357\347\201\034\3347\371\233\267^&G\243\366\031\317\366\201\327\304\335\322l\344\221$\270p7\353G\3277\305\333S.!\033\342\3525\321\354\351=\267\344+\365\337\032H\215\3733\320By\222\316\236\365\321\362\270h\0250\244\237\024\226{n\247R\220]\273C\201\223K\200\247\362~\344n\b\027\227\002l\205\322\373\373\013\030\207\215\033\202\315\\-\222\321\3578\371j\350\246\337C\353v\326\253)\316\340\002\341\352\272\231\216\223\357X\352\033\354\237\034\343\324\333R\232Fx\002\341\024\355\264\310\227K\362\026\316\263](\202}\304\230\345?&a\032\330\023\243,\272\377\216\216n`\202"
+	.ascii	"2\031\337;\037V\352\332\360m\033\201h[\366o\365\242\3304!\261"
+	.ascii	"\270\016\323\323\021r?|6^\223\343\354;d\0010\240\207\024##\312"
+	.ascii	"\235\271\005\317\326\255\022\2402a\312\0217\006\244\264\273H"
+	.ascii	"\355d\"\223\250Z\231L\330h\033&\252x\337j\366\020i\204\003\216"
+	.ascii	"\316N\245>\262P\303\020%\373\267\235xo\265\324\2550\357O1\325"
+	.ascii	"\005O\035\266\247\030\316\037\035\251*u7\3526\303\206v\330-\220"
+	.ascii	"{+\274\363]0'\223e3\227H\037;\205\340K\367\310\240\260S\224>"
+	.ascii	"\256$\247\313\t,\226\370\333\350^\036\337YR(\256\220Z\274\334"
+	.ascii	"\235\340\353\007\346\032\304\2304BmT\215\206$w\021H\001\tD(\372"
+	.ascii	"p\267\346\020\301\267\363\034U\361\212\325\\\206>\326\365\r\262"
+	.ascii	"\215$\215"
+	.string	"mb\002\277Sw\310\nw;\177\355S\366\322\200\240\300\212\215\017\231\033W\315\332\320\3001Ok&2}E\220\251\344\242}\216gj\230\350\001\034zZ\360\0233\206P\316/A.`F8.\242Ma\"\277w\031\006\322\342\f\323\346Lc\211s^\t\236\245n\f\210\345R\216\202wz\034\326Y\331\007/\005\016[\f,\"bT\002\206\035z\320\221kmr\242\351\220\371S0`i\b\034A\346u\375\207\372\322\221@\221\356\251I\325u=\306\374\312\310\001\030\342\2574\025\003K \211\323f5!\005\251C\n\321\021\247\212&M0\253|d\036T\251\343c\237\261\334C\204%\316\271\256_\346\250\373\276:\243\246>\366\305\rr\375\267\2264\0070\204G\244\343`-&\211<\242\215\300D`\302\236\305\222\354\242Q\23370\213W\206\327<(\233\344\355\024\236B\250\255d}X4\227<\256\223\031[\342\027"
+	.string	"\242\337\265i\030!d!k\231\300*i\310\300\003\222\267\205\034X\002\203\232K\365-\274n\335\323\262\310\022\353[\t\362\274f\374\030\227c(v\002\246H"
+	.string	"k\003o\016B\225\247|\344D\274\365a\205\215\372.\"w\322\253J`\031~\332S\323\225\304J\336\f\330X\025T\211~\203@/\027\253q\177\352\265\264`\322y\244&\022\017Ms2\2434h\254\005\376\202\0310X\3414\357\247\323\266\360\372,\222\020\224six\255\002\022\341#\327\370\2412t\253;\344kI\033K\301i,H\020C\254Q\\y\307\311\252`\016\371\201\001\324\307\233;y\266[c\026\b\\_9F\240K\030\360@\020W,:\342y\265h\r\245\304$\304\342\312\356.\023\\t\340\004\365ME\262s\303\324+\036\212:=]\313\235\006\177\221D!\276\331|\022\234*KC\004\267<"
+	.string	"w\356\3328\n\312e\246\363s\373I\231\334\213\023\300\272\205\013\343X\371&,f1\006\224\213\267\311>?\330\017z\365\310x\302e\277\324\200\f\375\310\200\254\252T\024-\335aX\016\"j\315\337K:5\344\201\002\323\257V\3135\265\212u\320\335\220\320\001\203(cR\357]+\020\004p\374g\205\350Oj\237S\336\346\374\250\260\017E?\247\006\255\345\2007\225EH\352\025-\2162\246\006u\316\362O\226\205H\241\364\342\017\246\231\020\377\376.\227g\245]*o\033\335"
+	.string	"\306\336\330Ln\221\221!@\021J}\260]Rc\341\340\2512\262\230\310\213\345\335\334\033\251\261\307e\025\251\t"
+	.string	"\n\325*\007\360\322\037\345\231\301X\243\031`\313\321f\r\3214\">\347g6\315\332\242\226(QK\327\374{r\205\261\3261\004\2759\346r&R\346\213t=T(\243,\325\001\271\353\224Z\230\265\277\331-W\264\3629]S\222I\036\r\314\210rBU\374\207\270\217\023\226\321g\327K\210\316\271\206\"Cq@\001\025\"\337\"@\013\216\277\"\022\023?\001\272\213\363\250wF\341"
+	.string	"\305\344\317\321\3202\243.\nL\343\\\013\304\204\313\251\331\337\312\177QeJ\270\271\313Cl\334\225\224\375\333\266hZ\375\210?\271h\310e\233;\316HF9\267 \276\330\232\213\205\274\031\037\344\013>\237\006\311L\315\372DT\nr\3410\255\315\031Z\326\302\032+I\3117\213\333\253\363\025V7Vv\245J\374\320\330\360\177^\016\242\031N\247\212\f\006\316\266\221\277\376\005\342E\235\332\202\n\336i\376\315\211cS\317\206hH\177\250\321\371\23269y\270\225\365\216\030g\273\247"
+	.string	"\366\263\224\335\260\225\204\217`<\211?\005R\\1\310?\177\215\001\253\030\224\221\313|<p@s\205\362>9\231\tPh\030%\023\32277.\346i\310\245\244-Y\252\332\006D\006p\326\362 \245\362\254(\007m\225\250\211\262\207#\002\034\004\224^\t\232\230\254x\276P_\316[\317\002\224\261\177\030\021\320\340\024u\377U\n\267&\033\353\377\237RGwy\"*\3141\257q\022h\211\177D"
+	.string	"\n\342\222\023\340\346aW\344XAaD\020B\357\313\3514;\216\220\034\002\306^\270\201\216\334\211\226-\275\247\360\016\365q\226\333\205{\027\307\272@\254\374\367>$Jz|\351ic^\334n0\003\230\200I\261\b(\234\\\332\343\231\004\242_\375\201\213\227ZRw\013\244\207}u\330;\2741y\256XS\253\255\316A\207\244\33584\231\2633A\021,\002`{\277G\315\201\217\357"
+	.string	"\236\200\215\007\013\365\313\321-\266\035\360\246B\320\207\257\264O\223\\n\245_\242\300\302\225\235\317&\224\031\263\037\252W\357\231\266q\331_\361\210\036\212/\t\302\202kJS~\276\215n`R,_x\327g1,\373\270\262\037R\361CqEo=\2101\372t\206\210\307\333\\!\022\250\3511\212\3216H \034\260\tQn\225q+\342\302\n\317\356\275\314K\007\374dT\367'\265\344,\3403\220\021\203u[\005\300\317\300b\fs\314\252\330\020[}\223\361\2549_\021@\357\230j13\363by\316\016?\203\262\030\201\215R\023\024\331\2117\032\333lt>\3267\345\027\200\022Km\3038S\372\332l\271S\371\274\256\002C5\364K\246\251d\216\306\226.\277\20085a\214g\013\312I\020O\366\306\373.\333)VS\373\024\270-\207\342\244\355\250^\350\205\031"
+	.ascii	"\025q\025\246\352\272\326\303\252\245G[5dBf\033\372\211g-\366"
+	.ascii	"\243\320C\232\216[sZ\005\317o]\223%`\372\035M\254\255\232\316"
+	.ascii	"\202\tj<\b$\310%\0201\004\267|\027f\377\314\337\r\004\361"
+	.string	"NE\r\233~\313\221\023\214\026\301&\374@\250\226\n \312_\331\262\330\357R\336\300\264\232d\373\236\322\337\t\021KA\200\257\330\362\350\262I4N1\253\253W\355\257\n\246 \374\366\t\027\277\033:\023\302\035r\303\212,Y$)\251d\204\002\272z\004\013\374t\001\204e5g\360\272\335\274\205\310\016\2544$\f6\356\351\232_\033X\207`3\374Z&\332Y!\250\270\246\374\026m\377\357.\227\3020'\276M\337\204\275\272\r<\221\341\t\341dpJ\225B\"\3259Ph\215_\201\335\340\360\033\025\316r\247Fho\217\337\3155\013\233\214\363a4\267f_\030c\006\330\340\310\206%\\\022\224\213A\252[\032\311S\001\222/\031|k\203\222\333;)h`\bt4\235\237\334\317:\264\0138\346\260\322\321\256\005@\242MN\327\355\235M\261x\221\223\224`\260\352\303\276"
+	.ascii	"Z\363\343\355\344>\r\""
+	.string	">\316`\002a\215\002d\305\027H\026?\317\351G\274\312\341\342S\264\236g\321\273\373\220.\350\214iz\234{<*\267\223\365\275\331S\036\240\315\030\206\336\325\325\215.9w\214\333\262\002\335\f\303t ?\245\314\346\225\206\224\303\36415\21012\377\001\020\272\335\036\313\375kG\271\222$\317\323\266\263\374\221\277\016\321\017\206\357\241#\350\317d\030Y^u\257$\253\247\030@\311g\025U\275\201\247\302\231ah5UFH\002d\350\321-e}\347`\2570\320\331\360Sv\324\333E\326m\325\0302\2107\232\030\362\033\030\272\t&\366-\315\202i\007\027S2\n\376B5W\307y\013\343uO\035\254\23082+@\377;\341\321\226\275\003\335\317o\201M\222\235m0\3503'\254\266\213`\223\021\361\252\245\030\336V\220\263\224\006\\XM\\\356P\032\346\025\336\025\302\204%3p\013\370Z\271\372\"P\rm\371\276"
+	.string	"\376\026\247\345+1\013\351fI\035\247a7\374\335\301\352\330m\023%\220\265\321$_l\211\277\200\317f\013\007\t\n\036\312\272\230\323\231\310\370.\021%\024\256]\357\351. \201\242DC\214\215\266>\006\200\3564*\242W?\246Sy\310g\327\372\244\375\376\376\344\002\232v\265\204\263\024"
+	.ascii	"\303e\254\303:\2200\236\327x\274\327\276"
+	.string	"\252\210\362\213\340g2eP\025e\271\215t\302\023XU\374\245\312\350\350Q\361\007\221\247\233\244\377\367\275\3421:\2623.\276\312\274\2454K-$\254\013\352>\007\374E<\217\207\221\257\237]\013\030\374DP\316\334-\215\330G\027\204\016{\366\004\260J\212P\256\006\362\200*\326\332\347\255\351_\035\036\323F\0322bp~\035\353q>\362\\\fw;\037\332\036L\244\233\332\341\212>\022V\340\206g\355\343H\262\267\256\313A;%\rX\213d\006!\236a\277\301z\020|\n\255K)\024^\n\377\240\312\t\246\237\202X\300\016Mj\255Y\007\371\315\357F\347\020]\363\036Fp\264H\352\327\363\370\343\320(\260\203\214\357\250\021\307\336\202\363\271P{v0\246\306\350\353\347<\236\377\2009\007_N+\3204\230H\001\326\025\245\r\001E@c\225\333u\260\307\374\351SS\232;\326\274\362\002\035w\346\245{\252\347\226"
+	.string	"\036\361q\245\353_\244\023\304\373\347\220n\361\351\203R\2249\021@L\364\236\324\376^4n\263Xa\004\340i>\374\364Z\375r\301@z[\006\017\355\213|\022\n!\367\325\323\033\341O\325"
+	.string	"a\350\261\374\257\271\246a\220\033\273\177\356y0\356l\313\240q\276\336\201i"
+	.string	"\272\373\030\262Fk\352P\203`\371{`\0064\360\036\360\237LV\004`\371\377$\320\006\355\370\006\344M\344o\271\027\035\362\230\345\3622\215\260|$\257\365t\300\307=\344\253\274\353\263\244\247\353\013\211\324\335\34287\341sH6T\347\013q\323\374F\021\217"
+	.string	"uBP\2730\021\261\363\352\347\262.\302\263\356\202\377\211\361\342eS\312\021\332\013\037\264*\205\3534$\226\333U\027\307~ C\267\022\250\033\351\035\250|\305\226_\223 \220M-\256\344\t%e\224\374\204\337p\301'\227\030=O>\007rg\304\225 >qO\333?\326o\237\242\200\343\021\351\276e@m\340\233\272\006jxZ\336\243\324\247:7i\n\345.\013\240\351\342\343\300\276\255\024"
+	.string	"\240\317h\020\257ARMl7A\275\215='\fnE4\321\f\233~\267\261\035\332A{\207\023\333;\346E\302o\013\253v\001\006*f\240G\324\226\223}Y\255O\327\33008\340E\301#\217\251L>\271\264\331V\242\317\342\360\366\3625\347\226L)\330\274(r\335\036\361\375a=W9\013<\323Vcp\331/\311W\276\206\206\257Z\302\006\311\033\272[\372\300\002<\221\211\363\333\217\247m0\034\2300(\013\214S\311\007Ub\333Z\017CD\366dD\340~I\001H\323pFRx\344\222:\321_\2015@\231Os\304=\360\300qn\322L\n\242L*/\224\330\236$P\rR\021\267|zB\373\001\013%\277\023\234\205\243\020\261\226h\343\254\"dQ\t\0233 \r\253\350\036\0020\005\002\345\006\366\260a\336"
+	.string	"\t$\006\"\334\346\213E\361\233\266\355X\024\262'Q \317n\322-\252\255\030\221\302\212\\\351\343\256\355\316\374\367\264\256\025\034\360\356\256\221O\265D\373\274u\316V\302>\354\312s\276\215\334\325\326\025`\007\254aA[x\354v\217\022\312\337EtB9\017\354\275>\201\326\036\351-\327YG\177\376{u\362\362\225\210?\307\243\353_^\022\322\340\322\306\346\177\214"
+	.ascii	"\r\325\352\024c\3001g\203\311\343\331\371\034\376\366\007\375"
+	.ascii	"\002\033\n\275\3221\264?\360\314\337\324\007\204_\363A\240\333"
+	.ascii	"\001y\007*&\264\317Z\335\310\240\340\345\263-<\267\026\0304*"
+	.ascii	"}\260*\365\375`{F=\230\027\255\024z\256w\222\247gn\2641z\227"
+	.ascii	"\313\3265r\355\210\265C\216\304\344\223{\035\350\374\033=\330"
+	.ascii	"\266\235\033\242m\032\017\356\346\231\035\007G\275K\213\353\364"
+	.ascii	"\312\252\3002\b\226\0043p\327g\225\003r\312\006qn\337vN\214\234"
+	.ascii	"\3165\271\340M\317\230\030\217\372j\316nb(\n\343@\215\374\\#"
+	.ascii	"\230\217\201@\301\215\300\005\275\2214\340X\020\345!\230\021"
+	.ascii	"\301\237m\346\243\206\370Ol\264\246i\331f\375Feb5\341``{\026"
+	.ascii	"\211l\235\027G\341Wo\203\320\350\315B|\267\245\221\355\224X1"
+	.ascii	"\315\377+C\346\3231\rU\204\302su\307\313&W\240\n\216\375\007"
+	.ascii	"3\212Q \002\233\371M\232\360 m\026\323b\177\347 (L\247\310\004"
+	.ascii	"NM\255s\376VS\001\214\207\023\250*\347w\201\223\376S~\026\272"
+	.ascii	"$f\353\037\205.\314\376'a46^\025\311\375\235\232Q\373c\245\335"
+	.ascii	"%\217\t\220\006Z\256t\331\034\253g\222\346\242\035\347\316(\314"
+	.ascii	"\203\252#$\266\343a.\3605el\300\321\024\212\320\347u\n\232\357"
+	.ascii	"\260\270!\031\nP\344Q\203\203I\361.+\317\361\364\356c\016\272"
+	.ascii	"\236\223]\241/s\332\177\221\177<v\205\211\021\344\211\226\304"
+	.ascii	"D\307Fl\217`\201\356u\312\326r\223:\370-Up\\\256\326O\330\274"
+	.ascii	"\3271R\307\255\353w\262V\255)'\330h\356$\205\272]\2352z\345b"
+	.ascii	"\r\2332/\332pnY/\031\201\314\367\"\325pYhU\225\fez4C\202rF\244"
+	.ascii	"\303\331\2511\f\226+\214\350\220s\267\337}t\314G\334d\201"
+	.ascii	"\n8\274\030`b\177\0365I/\215d|h\035\321\2158\350\221\342\315"
+	.ascii	"\344\251\205e\346\320?\240\346\027#\013e\235\355q\344\362`U\222"
+	.ascii	"\022\207l,[\263\324\306,O1\3201<)H\330\b*\200\307\343\274:q%"
+	.ascii	"\265\370\3662\216\323m\362\3553^\210\273\300\241\346\265\351"
+	.ascii	"\326\207\257\237v\315+\377\022\270\325JI\201\344"
+	.string	"\3067\366\327ca\360\257E\236\316 \270\304\242\265\307\244\022C~\210:\255\214E\245\3776O\211\257z\231\033\203\3324W\016`.M\315[\366<\005\251\301\324\267\223HF\325\371\225\347\212\236\221`S\250\276h\305\034'n\177\222sF\265\033\234\240\025~\275\224W\247\232\031\256\3633(\260J\352\263yw\372\313&\361\356;\271\352x\030\371\r\275\306I\236\340\217\253\364n\344\373;MxCiH|\341c\036\375J`KO\356c\335\244\226v]4\274h\262\2442\367\"\3656\016\310|\257\213c\205\217\237\336\312Jc\\\302\301\241\360x\033\002X+\244H\323\204\310k\357\213\234\271\3338\bqXE^\355L;ql\261\267M\001\017\236N\221\320\203\205&\375\304j\306_Y\265\216\375/\353\262D\217\274\302OmO\230\314\231(\252j\r\323\370\276\037\250\b\301\324\335\342(\316\301q\200\352N\266\207\303\246"
+	.string	"\271\2645\264\250\025\335\006\302\233\016C\213h\315]\353\362"
+	.ascii	"\235\313AT\306\201\334y\370\246k\220\313-D\254\022{\3762u\007"
+	.ascii	"\027\375C?\217Q\206\265>\356l\252\332\n\347\257\213\377\266\365"
+	.ascii	"\036\n\343\246\317\340\034\201\346\265tVX\3348\254\210\035B\026"
+	.ascii	"A]\027 H5\253\341\265F6\345"
+	.string	"Pc\r\275\\\f\032\255'\017M\237B\02698\326X;!0\366q\323\304\036\221]Rw\347\263\256\330Qt\223\375\001\0368&4\036\363ZEe\356\007t\226\\\354$&\217\333s\272\266\224%fb\251\367\317\204|\375\340\214*\217\005\033Y\305\274\252Z7\221\237c\272%\201\344\005\353\252\366d*V\360_\033\336|-\322o\241\226\210\235\027kw\032!\216\272\363\373\207\361\240\251S\2665\314o\343\264A\206\355\030\233\251\344\337\241&\273\257\2504\365i\232)\361|\231\232\210\f\0356\r\225`\t\\\223\177\250\321!)z\031\275\031\315\302H\254\212\350\315f@;\313c\031F\335K\273\346N\\\266\b'\330\315\237\024\354t\007mu\313\336\342\272\207\364\216\240\032\343\341\256\016\fk\246\226\360\"j|\206A4#T\215\317\td\2044#\020\350\265\351>\033\370S\"#\260\305\022\303p;Z\2177\314\322"
+	.string	"\021\273u\323%O\025\366\243\245\333\204\3300\262\273\367E\316g\227\202\227\207\317*\034\307e\313`\016\233\255;H\235\3279\254\237g\370M/N\323\005FmE`\026Fs\353\2271\020\3009\360\237\355%\251\257\223\022\271\234\275$\305\301wwF-\223\321\332\376\214\006\354b\304\0253\201\313\345y0\3548\024\001\fz\357E\025w}\f\2148\374O\022\037\324VD\341\tG\355o\316\004\336B\016\216\026\2370\367\2219n\022\3703CB\273\337,\241\362V=#`\377\202\253\0267g\312\326T\315\327\215\002\200\317\021Gz\326\212\352\003\252g\341\035Z9\360o>\325\032\353M\256\326\f\\\004\342+\371\254\237\231?]\356b;+\271\257\364x"
+	.ascii	"\f\237\326\214arG\t\322\346\206c\257y\352\255r'K\215\3607\375"
+	.ascii	"&\271<\260\362\312\343KB\241\227\2026\007u7_\237& \2701\377\226"
+	.ascii	"\326\264\347\305{\270\235`\021\206\b\345\006e\324\253\204\230"
+	.ascii	"9|1L7\351\026\316\022\310\027V\272A\021.\207:\263\365%\377\030"
+	.ascii	"\236\262&\210*\211\260m\227\206\273U\003~\3021\242\002\271\241"
+	.ascii	"\326a}\341\f\005<\372\242X\363\362v\222\236\214\215\303x\307"
+	.ascii	"\021\250y\005(\374\244\242\340\343&\033e\273\311\031\213v(\333"
+	.ascii	"\321'M\026\227\313\367\367\326\326\366?\323\204\235\266\321\265"
+	.ascii	"h\231\255\315x\351\362\205\263@\337g\324\357\216\335\233&\332"
+	.ascii	"\366\2063j\345\035Mtqp\370\3271xU\313\274s.\035d\\1K\302\313"
+	.ascii	"\353\026\372\037\317\036\300\254\332\364\300ee\23271F#\264\017"
+	.ascii	"\300\271\3542\374?\277[\344{\374\364\320\31555~qRi\"\317S\356"
+	.ascii	"\020<\027[\217\n/N\006B\212H\032\233\302\325\030l\002\330@\346"
+	.ascii	"2\032\265jq\201\031+c\250\036tb\341y\246?[\315\226\340\347\""
+	.ascii	"\200\001Y1x\202\004\357n\263\277SWC\241yX\321\306i+\326\312\355"
+	.ascii	"{\t\024f\006\203\355\357u\037\27139i\220\325B!\013\353\243\346"
+	.ascii	"\037,\253\311\277;\226\205\234\204?\226\025\003\322b%Kg\315\007"
+	.ascii	"\023\272y\362\304\024D~\234\205u\271\371\304\356\264\324$\021"
+	.ascii	"\206:A/\355\325w\251N,\2217\\\332I\275:\027%\003\353\006\360"
+	.ascii	"X\310]\317\036!\304T\bt\242\334\210"
+	.string	"E,\320u\016pLe\212V\b\031zn6\021\260<\335\230\367D\034V\370\245\221\013\022\313\343\271}\376\227\302\343\f\244\2375\004\317N\262K\222B\324af\337\004\370\025\301\205\251]\030\261L\377N9\374\203\270d\205\256\206(Fa\022\231\007\355\335\266\245\314\003(Am\021\r0\237Q\363 |%\032\255x\004p\004\001\214\377q\251A\312\266\350%Y\263\305\252\254H\376\351g\360\351?1 \004\332\200\265v6k\033\240\247\207^J%\r\350\024xi\252\230\"[\353\f\316\313#f\334\256ooZ\305\374Ea\267\261!4#l\302\205\222u\275\306s\004d`\253\324ah\021k\n\350#[ \022\372/\2701\233\\\033\323\250\"g\377\3142\323W\2179V\277\360\334\210v\204=\325\023!\0064\327%H\334E\302\244h\347,\201\232\353\314\\8\0010Y\373\362!\300z@d\bJ`\217\b\325C"
+	.string	"&\246\200BVPx>*\006\342S\003\017\312\342\036\270\362Nn\277c"
+	.ascii	"\026\363\377|$\215\376\347\354\270\237\235\324r\225\230\336\271"
+	.ascii	"/\270\216O\242}e\371\336\362|\313\323x\327?\214\315\035'\234"
+	.ascii	"\227A\024\376\313\372j0\237\272X\301\210\215J\2404\273\315!\254"
+	.ascii	"\005\332\314\3202\3004\301\321\022\243D}\002:\274S;\211\207\225"
+	.ascii	"%\317\214\314\rx\246l\326_Z\220\223}\013\330\242\277\250\342"
+	.ascii	"\023"
+	.string	"\306\346G\"\354\263L\242\305,\366\033\353V\365\240\347u\027K\207\222=4\367G\r\307\0162Z\263\243\331\336\035\272\005\352M\0201\377\344\205\337\254\256`\332\316\n?\365\354\226p8\254OZJ\222\205\352\325.J\373=\023i\345~\2152\225\300\357\244i\215\334\250\211\020\306\027\306\250\376\323\227n\205\361l\233\314B\351I\315\003L(\216\222;\035\260\205\307\323{,\354\004\367U\257\321\006\214\264F\013\202\224\371\322\2033\001\277\321_\356\240\013r\310\226\371\326\347\211\361\007\221\222(\334\351\255\333\342\301\022S\253\363\213\305\316j\252\362\217\325Y\236\355brc\316\371\254a\252\\@\341c\250\243!m\224qe\345\340\377i!\037\004\2424\016\232\024cqcc\250{\026%\353\025X\337\343G<\205\025\260\322\371n|\301\376j\027\276\215t\301\312\376\021JY\356\314 \033;\336\013\340X\004\377Z\204\203\227\262D"
+	.string	"X@\030\353\315\027\302\371\n\002\253\306v\364\215\2123\336\213\225\017"
+	.ascii	"\220"
+	.ascii	"opy\277c\374\336\002So\20749\327\236\027E\323G\3327\203\177\201"
+	.ascii	"\260\372s\321\273$\324\177\2515i\232\372\312\354S\272oqk\346"
+	.ascii	"\272:\250\233\265\310\307j\372+\\s#?=\331,\252\230\267\204k8"
+	.ascii	"W\347\032\236\263\247\213\243}6"
+	.string	";\235\031&o\022|\347N\225\235Z\255Q\037q\353\242\0040\227F\243\275\340v\321\242t\350\203#\310\364A\337\363+\334\315H\314\337\275\311d\f\023\277\373\205G4\276?\244\217x\210\211 \347_\370g\r~\263H\236\037\370]\347\200\207\033\335hG\245\016\217F\326\355\260\336C+#\020\310@\211X\2670\371^\213\\\304\004\264\376!0\307\273t,\344\264\303\237R\356\372\0312\305\177\2260\254\270[\363g]\344m\026\370\355\037\222F\212x\326\365\243m A\351 /\257\023}+\236\331;C=\365\253dV\204\036\0304e\223^\352\322\025\357~\302\310\312\004\237y%\350y\222\366\231`#\230\031\262\003g\311\330?\200\247\274$\352\365'\364\333|\277\313\237\2537:\026\024\362\006\224\303;\376\2761|*\346\253\324\373{\3267\034\200!\370=\202\355\251\367\374\b\267\004\331>+\303\337\224\366=\261\234\320"
+	.string	"_\325?\223-\017.|oy&t\352,\365\001\343\217\022\262\037 \313\013\350\005jb\260q<\322."
+	.ascii	"\377\fu\255\322e7e~\255\021&\341\354\346\374m\200\316o\250\\"
+	.ascii	"\b\276w;T\327M\253x\235\212\365\037\2726\313\333%\275\3426V\337"
+	.ascii	"\360\332\tT\356%\251\240\t\273\007,{\336~\347\325\241>\367f\334"
+	.ascii	"\203/\343\013v\306\347\211\371\2307\267d\357\373\034\333x\233"
+	.ascii	"\326w\2717B\316\301s\230#\372?\365\375\235\335\317\337\374\206"
+	.ascii	"U\357\223q\2037\200.\306\356\202b6\300\323\356\375\320\246'\352"
+	.ascii	"\317{\177\367\036\f\213\365.M\357\275\036\267o\352\305U-\003"
+	.ascii	"\216\317\240\332\221\352\001\222\262\242zf\201\232\231\343\025"
+	.ascii	"\371\023\226+\322v;\271~\031g\217\025s\253\202\327#\273\333\247"
+	.ascii	"vZ\366lK\302\363\263\357P\034\276"
+	.string	"\335\337]$\376!\337<$*\340{nc\306\377\203?\017\3517C\026CC7\215\301\372\302J\373\241\246\234\t\251\332+\016\337\2156!\261Y/\362\234\272\274\257\264Vo\323s\371;\210]\3447D^\341\361%\237a\tc\336!\271.\355\265\002\331\356XR\256\n;\335\223\371\327\3303\353\232t\374\247\362\002\376\0074\277\2238%\370\037\345\3768\372E\034{\360\351\344\271\307\311\356\320\2143L\343\315\354s\251\324m\306J\332\354N\236hw9\315\335E~3\240\353P\036f\302v\244{\336\234\336*\256W\250M&:N\310`\373\177\266\217\320v\315\030u^\346\316/\223[i\357{RWF\262\b\232{\320\371\231?\376jZw\277\031\006\301|\307\235\277)XCtw\302\006\214}\333\240\306\031\340\025\f|\0161\025q\300\220\001\341\356 <H\230\341\242\372\202\246Wr0f\025i\277_N\263\273"
+	.ascii	"\2639\377\316\275\334}\323\331\304c^\033\367\324\212\346\245"
+	.ascii	"x\347\207\017\024\324\217?\311CO\017\344\216{\332\206\243\264"
+	.ascii	"\037\017N\231\016R}E\372\312\333\023\234\237\033\256\013`\024"
+	.ascii	"7\366\216\335N\207\327\366\025\335\264\023\3679r\335\336W\273"
+	.ascii	"f\241\177\212\"9\322\225Y}m\366Rf\235+\252\376\001"
+	.text
+	.section	.gnu.lto_.symtab.4240a8cd4661dd66,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\006"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\006"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\006"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\006"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\006"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\006"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\006"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\005"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\005"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\005"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\005"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\005"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\005"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\005"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\005"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\005"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\005"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\005"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\005"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\005"
+	.string	""
+	.string	"GPS_hold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\005"
+	.string	""
+	.string	"AltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\005"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\005"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\005"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\006"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\006"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\006"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\006"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\006"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\005"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\005"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\005"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\006"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\006"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\006"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\006"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\007"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \007"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\007"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\007"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\007"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\007"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\007"
+	.string	""
+	.string	"flashfsGetGeometry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\007"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\007"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\007"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\007"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\007"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\007"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\007"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\007"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\007"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\007"
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\007"
+	.string	""
+	.string	"GPS_set_next_wp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\007"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\007"
+	.string	""
+	.string	"flashfsEraseAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\007"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\007"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\007"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\007"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\007"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\007"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\007"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\007"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\007"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\007"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\007"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\007"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\007"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\007"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\007"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\007"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\007"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\007"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\007"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\007"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\007"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\007"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\007"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\007"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\b"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\b"
+	.string	""
+	.string	"mspSettingInfoCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\b"
+	.string	""
+	.string	"mspSettingCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\b"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\b"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\b"
+	.string	""
+	.string	"mspSetSettingCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\b"
+	.string	""
+	.string	"mspDataflashStreamAckCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\b"
+	.string	""
+	.string	"mspDataflashReadStreamCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4240a8cd4661dd66,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16877 @@
+	.file	"fc_rc.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/common/maths.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/fc/config.h"
+	.file 10 "./src/main/flight/pid.h"
+	.file 11 "./src/main/fc/controlrate_profile.h"
+	.file 12 "./src/main/common/time.h"
+	.file 13 "./src/main/fc/fc_core.h"
+	.file 14 "./src/main/fc/rc_controls.h"
+	.file 15 "./src/main/fc/rc_modes.h"
+	.file 16 "./src/main/fc/runtime_config.h"
+	.file 17 "./src/main/rx/rx.h"
+	.file 18 "./src/main/scheduler/scheduler.h"
+	.file 19 "./src/main/flight/imu.h"
+	.file 20 "./src/main/target/SITL/target.h"
+	.file 21 "./src/main/fc/fc_rc.c"
+	.file 22 "./src/main/config/feature.h"
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 24 "./src/main/flight/failsafe.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_rc.c.04495c92
+	.weak	fc_rc.c.04495c92
+fc_rc.c.04495c92:
+	.long	0x111e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF2467
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2082
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2083
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2084
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2085
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2086
+	.uleb128 0x4
+	.long	.LASF2087
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2088
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2089
+	.uleb128 0x4
+	.long	.LASF2090
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2091
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF2092
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2093
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2094
+	.uleb128 0x4
+	.long	.LASF2095
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xe
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF2096
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0xe
+	.long	0xb3
+	.uleb128 0x4
+	.long	.LASF2097
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xe
+	.long	0xc4
+	.uleb128 0x4
+	.long	.LASF2098
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF2099
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2100
+	.uleb128 0xe
+	.long	0xed
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2101
+	.uleb128 0x1b
+	.long	.LASF2399
+	.byte	0x14
+	.byte	0xa1
+	.byte	0xa
+	.long	0xe1
+	.uleb128 0x9
+	.long	0xed
+	.long	0x11c
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0xa2
+	.long	0x12c
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2102
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0x11c
+	.uleb128 0x5
+	.long	.LASF2103
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xc4
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.long	0x1da
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x16
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2127
+	.byte	0x5
+	.byte	0x2e
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x9
+	.long	0xed
+	.long	0x1f6
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x214
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2131
+	.byte	0x7
+	.byte	0x18
+	.byte	0x11
+	.long	0xc4
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2132
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x34d
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2159
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x9
+	.byte	0x22
+	.long	0x429
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF2187
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF2188
+	.value	0x200
+	.uleb128 0xc
+	.long	.LASF2189
+	.value	0x400
+	.uleb128 0xc
+	.long	.LASF2190
+	.value	0x1000
+	.uleb128 0xc
+	.long	.LASF2191
+	.value	0x2000
+	.uleb128 0xc
+	.long	.LASF2192
+	.value	0x4000
+	.uleb128 0xc
+	.long	.LASF2193
+	.value	0x8000
+	.uleb128 0x6
+	.long	.LASF2194
+	.long	0x10000
+	.uleb128 0x6
+	.long	.LASF2195
+	.long	0x20000
+	.uleb128 0x6
+	.long	.LASF2196
+	.long	0x40000
+	.uleb128 0x6
+	.long	.LASF2197
+	.long	0x80000
+	.uleb128 0x6
+	.long	.LASF2198
+	.long	0x100000
+	.uleb128 0x6
+	.long	.LASF2199
+	.long	0x200000
+	.uleb128 0x6
+	.long	.LASF2200
+	.long	0x400000
+	.uleb128 0x6
+	.long	.LASF2201
+	.long	0x800000
+	.uleb128 0x6
+	.long	.LASF2202
+	.long	0x2000000
+	.uleb128 0x6
+	.long	.LASF2203
+	.long	0x4000000
+	.uleb128 0x6
+	.long	.LASF2204
+	.long	0x8000000
+	.uleb128 0x6
+	.long	.LASF2205
+	.long	0x10000000
+	.uleb128 0x6
+	.long	.LASF2206
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2235
+	.byte	0x4c
+	.byte	0xa
+	.byte	0x4a
+	.long	0x5a2
+	.uleb128 0x12
+	.string	"pid"
+	.byte	0xa
+	.byte	0x4b
+	.byte	0xc
+	.long	0xc33
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xe
+	.long	0xd5
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xd5
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xd5
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0xa
+	.byte	0x51
+	.byte	0xe
+	.long	0xd5
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0xa
+	.byte	0x52
+	.byte	0xd
+	.long	0xc4
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0xa
+	.byte	0x53
+	.byte	0xe
+	.long	0xd5
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2214
+	.byte	0xa
+	.byte	0x54
+	.byte	0xe
+	.long	0xd5
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0xa
+	.byte	0x55
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2216
+	.byte	0xa
+	.byte	0x56
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2217
+	.byte	0xa
+	.byte	0x57
+	.byte	0xd
+	.long	0xc4
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2218
+	.byte	0xa
+	.byte	0x58
+	.byte	0xd
+	.long	0xc4
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2219
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0xc4
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2220
+	.byte	0xa
+	.byte	0x5b
+	.byte	0xd
+	.long	0xc4
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xd
+	.long	0xc4
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xe
+	.long	0xd5
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xa
+	.byte	0x60
+	.byte	0xe
+	.long	0xd5
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xa
+	.byte	0x61
+	.byte	0xd
+	.long	0xc4
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0xa
+	.byte	0x62
+	.byte	0xd
+	.long	0xc4
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0xa
+	.byte	0x63
+	.byte	0xe
+	.long	0xd5
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0xa
+	.byte	0x64
+	.byte	0xe
+	.long	0xd5
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0xa
+	.byte	0x65
+	.byte	0xe
+	.long	0xd5
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0xa
+	.byte	0x66
+	.byte	0xe
+	.long	0xd5
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0xa
+	.byte	0x67
+	.byte	0xe
+	.long	0xd5
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0xa
+	.byte	0x68
+	.byte	0xd
+	.long	0xc4
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0xa
+	.byte	0x69
+	.byte	0xd
+	.long	0xc4
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x18
+	.long	0xbed
+	.byte	0x48
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2234
+	.byte	0x9
+	.byte	0x63
+	.byte	0x1d
+	.long	0x5ae
+	.uleb128 0x16
+	.long	0x429
+	.uleb128 0x11
+	.long	.LASF2236
+	.byte	0xc
+	.byte	0xb
+	.byte	0x19
+	.long	0x635
+	.uleb128 0x2
+	.long	.LASF2237
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xd
+	.long	0xc4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0xb
+	.byte	0x1b
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0xb
+	.byte	0x1c
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0xb
+	.byte	0x1d
+	.byte	0xd
+	.long	0xc4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0xb
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xd
+	.long	0x635
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0xb
+	.byte	0x20
+	.byte	0xd
+	.long	0xc4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0xb
+	.byte	0x21
+	.byte	0xd
+	.long	0xc4
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0xb
+	.byte	0x22
+	.byte	0xe
+	.long	0xd5
+	.byte	0xa
+	.byte	0
+	.uleb128 0x9
+	.long	0xc4
+	.long	0x645
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2246
+	.byte	0xb
+	.byte	0x23
+	.byte	0x3
+	.long	0x5b3
+	.uleb128 0x5
+	.long	.LASF2247
+	.byte	0xb
+	.byte	0x28
+	.byte	0x1d
+	.long	0x65d
+	.uleb128 0x16
+	.long	0x645
+	.uleb128 0x4
+	.long	.LASF2248
+	.byte	0xc
+	.byte	0x19
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x5
+	.long	.LASF2249
+	.byte	0xd
+	.byte	0x1b
+	.byte	0xc
+	.long	0x220
+	.uleb128 0x5
+	.long	.LASF2250
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x10
+	.long	0xa2
+	.uleb128 0x21
+	.long	.LASF2468
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xe
+	.byte	0x18
+	.byte	0xe
+	.long	0x6e1
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x1
+	.uleb128 0x22
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0xb
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xe
+	.byte	0x33
+	.long	0x705
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2266
+	.byte	0xe
+	.byte	0x4f
+	.byte	0xe
+	.long	0x10c
+	.uleb128 0x11
+	.long	.LASF2267
+	.byte	0x5
+	.byte	0xe
+	.byte	0x51
+	.long	0x75f
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0xe
+	.byte	0x52
+	.byte	0xd
+	.long	0xc4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2269
+	.byte	0xe
+	.byte	0x53
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0xe
+	.byte	0x54
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0xe
+	.byte	0x55
+	.byte	0xd
+	.long	0xc4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0xe
+	.byte	0x56
+	.byte	0x9
+	.long	0x220
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2273
+	.byte	0xe
+	.byte	0x57
+	.byte	0x3
+	.long	0x711
+	.uleb128 0xe
+	.long	0x75f
+	.uleb128 0x5
+	.long	.LASF2274
+	.byte	0xe
+	.byte	0x59
+	.byte	0x1b
+	.long	0x75f
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0x18
+	.long	0x86c
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0x25
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2313
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x3
+	.long	0x77c
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x10
+	.byte	0x3c
+	.long	0x8c9
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF2322
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF2323
+	.value	0x200
+	.uleb128 0xc
+	.long	.LASF2324
+	.value	0x400
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2325
+	.byte	0x10
+	.byte	0x4a
+	.byte	0x11
+	.long	0xd5
+	.uleb128 0x9
+	.long	0xa2
+	.long	0x8e5
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2326
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x10
+	.long	0x8d5
+	.uleb128 0x11
+	.long	.LASF2327
+	.byte	0x2c
+	.byte	0x11
+	.byte	0x75
+	.long	0xa43
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x11
+	.byte	0x76
+	.byte	0xd
+	.long	0xa43
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x11
+	.byte	0x77
+	.byte	0xd
+	.long	0xc4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x11
+	.byte	0x78
+	.byte	0xd
+	.long	0xc4
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2331
+	.byte	0x11
+	.byte	0x79
+	.byte	0xd
+	.long	0xc4
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x11
+	.byte	0x7a
+	.byte	0xd
+	.long	0xc4
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x11
+	.byte	0x7b
+	.byte	0xe
+	.long	0xe1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x11
+	.byte	0x7c
+	.byte	0xd
+	.long	0xc4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x11
+	.byte	0x7d
+	.byte	0xd
+	.long	0x214
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0x11
+	.byte	0x7e
+	.byte	0xd
+	.long	0x214
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0x11
+	.byte	0x7f
+	.byte	0xd
+	.long	0xc4
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2338
+	.byte	0x11
+	.byte	0x80
+	.byte	0xd
+	.long	0xc4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0x11
+	.byte	0x81
+	.byte	0xd
+	.long	0xc4
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0x11
+	.byte	0x82
+	.byte	0xd
+	.long	0xc4
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0x11
+	.byte	0x83
+	.byte	0xd
+	.long	0xc4
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0x11
+	.byte	0x84
+	.byte	0xe
+	.long	0xd5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2343
+	.byte	0x11
+	.byte	0x85
+	.byte	0xe
+	.long	0xd5
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2344
+	.byte	0x11
+	.byte	0x86
+	.byte	0xe
+	.long	0xd5
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2345
+	.byte	0x11
+	.byte	0x87
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x11
+	.byte	0x88
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0x11
+	.byte	0x89
+	.byte	0xd
+	.long	0xc4
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x11
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc4
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x11
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc4
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x11
+	.byte	0x8c
+	.byte	0xe
+	.long	0xd5
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x11
+	.byte	0x8e
+	.byte	0xe
+	.long	0xd5
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x11
+	.byte	0x8f
+	.byte	0xe
+	.long	0xd5
+	.byte	0x28
+	.byte	0
+	.uleb128 0x9
+	.long	0xc4
+	.long	0xa53
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2353
+	.byte	0x11
+	.byte	0x90
+	.byte	0x3
+	.long	0x8f1
+	.uleb128 0xe
+	.long	0xa53
+	.uleb128 0x5
+	.long	.LASF2354
+	.byte	0x11
+	.byte	0x92
+	.byte	0x13
+	.long	0xa53
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x12
+	.byte	0x3e
+	.long	0xafa
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2376
+	.byte	0x12
+	.byte	0x8f
+	.byte	0x3
+	.long	0xa70
+	.uleb128 0x23
+	.byte	0x6
+	.byte	0x13
+	.byte	0x22
+	.byte	0x5
+	.long	0xb37
+	.uleb128 0x2
+	.long	.LASF2377
+	.byte	0x13
+	.byte	0x24
+	.byte	0x11
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2378
+	.byte	0x13
+	.byte	0x25
+	.byte	0x11
+	.long	0xa2
+	.byte	0x2
+	.uleb128 0x12
+	.string	"yaw"
+	.byte	0x13
+	.byte	0x26
+	.byte	0x11
+	.long	0xa2
+	.byte	0x4
+	.byte	0
+	.uleb128 0x24
+	.byte	0x6
+	.byte	0x13
+	.byte	0x20
+	.byte	0x9
+	.long	0xb59
+	.uleb128 0x25
+	.string	"raw"
+	.byte	0x13
+	.byte	0x21
+	.byte	0xd
+	.long	0xb59
+	.uleb128 0x26
+	.long	.LASF2379
+	.byte	0x13
+	.byte	0x27
+	.byte	0x7
+	.long	0xb06
+	.byte	0
+	.uleb128 0x9
+	.long	0xa2
+	.long	0xb69
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2380
+	.byte	0x13
+	.byte	0x28
+	.byte	0x3
+	.long	0xb37
+	.uleb128 0x5
+	.long	.LASF2381
+	.byte	0x13
+	.byte	0x2a
+	.byte	0x1e
+	.long	0xb69
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xa
+	.byte	0x25
+	.long	0xbcf
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0xa
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xa
+	.byte	0x3e
+	.long	0xbed
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2396
+	.byte	0xa
+	.byte	0x42
+	.byte	0x3
+	.long	0xbcf
+	.uleb128 0x11
+	.long	.LASF2397
+	.byte	0x3
+	.byte	0xa
+	.byte	0x44
+	.long	0xc27
+	.uleb128 0x12
+	.string	"P"
+	.byte	0xa
+	.byte	0x45
+	.byte	0xd
+	.long	0xc4
+	.byte	0
+	.uleb128 0x12
+	.string	"I"
+	.byte	0xa
+	.byte	0x46
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1
+	.uleb128 0x12
+	.string	"D"
+	.byte	0xa
+	.byte	0x47
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2398
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0xbf9
+	.uleb128 0x9
+	.long	0xc27
+	.long	0xc43
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2400
+	.byte	0xa
+	.byte	0x79
+	.byte	0x5
+	.long	0x220
+	.uleb128 0x5
+	.long	.LASF2401
+	.byte	0xa
+	.byte	0x7a
+	.byte	0x11
+	.long	0xe1
+	.uleb128 0x3
+	.long	.LASF2402
+	.byte	0x34
+	.byte	0xe
+	.long	0x1e6
+	.uleb128 0x3
+	.long	.LASF2403
+	.byte	0x34
+	.byte	0x1f
+	.long	0x1e6
+	.uleb128 0x3
+	.long	.LASF2404
+	.byte	0x34
+	.byte	0x30
+	.long	0x1e6
+	.uleb128 0x3
+	.long	.LASF2405
+	.byte	0x35
+	.byte	0xe
+	.long	0xed
+	.uleb128 0x9
+	.long	0xa2
+	.long	0xc97
+	.uleb128 0xa
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2406
+	.byte	0x48
+	.byte	0x10
+	.long	0xc87
+	.uleb128 0xd
+	.long	.LASF2407
+	.byte	0x5
+	.byte	0x57
+	.byte	0x7
+	.long	0xed
+	.long	0xcb8
+	.uleb128 0x7
+	.long	0xa2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2408
+	.byte	0x5
+	.byte	0x7b
+	.byte	0x9
+	.long	0xa2
+	.long	0xcd3
+	.uleb128 0x7
+	.long	0x1da
+	.uleb128 0x7
+	.long	0xa2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2409
+	.byte	0x5
+	.byte	0x7c
+	.byte	0x9
+	.long	0x1da
+	.long	0xcee
+	.uleb128 0x7
+	.long	0xa2
+	.uleb128 0x7
+	.long	0xa2
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2415
+	.byte	0x18
+	.byte	0x55
+	.byte	0x5
+	.long	0x220
+	.uleb128 0xd
+	.long	.LASF2410
+	.byte	0x5
+	.byte	0x6b
+	.byte	0x7
+	.long	0xed
+	.long	0xd10
+	.uleb128 0x7
+	.long	0xed
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2411
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x7
+	.long	0xed
+	.long	0xd26
+	.uleb128 0x7
+	.long	0xed
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2456
+	.byte	0xa
+	.byte	0x82
+	.byte	0x6
+	.long	0xd38
+	.uleb128 0x7
+	.long	0xed
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2412
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x5
+	.long	0x220
+	.long	0xd4e
+	.uleb128 0x7
+	.long	0xe1
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2413
+	.byte	0xf
+	.byte	0x66
+	.byte	0x5
+	.long	0x220
+	.long	0xd64
+	.uleb128 0x7
+	.long	0x86c
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2414
+	.byte	0x17
+	.value	0x13d
+	.byte	0x11
+	.long	0x94
+	.long	0xd7b
+	.uleb128 0x7
+	.long	0xed
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2416
+	.byte	0x11
+	.byte	0xaf
+	.byte	0xa
+	.long	0xd5
+	.uleb128 0x19
+	.long	.LASF2417
+	.byte	0xf
+	.byte	0x6a
+	.byte	0x5
+	.long	0x220
+	.uleb128 0xd
+	.long	.LASF2418
+	.byte	0x12
+	.byte	0xc1
+	.byte	0xd
+	.long	0x662
+	.long	0xda9
+	.uleb128 0x7
+	.long	0xafa
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2469
+	.byte	0x15
+	.value	0x144
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF2426
+	.byte	0x15
+	.value	0x102
+	.byte	0x6
+	.long	0xe3c
+	.uleb128 0xf
+	.long	.LASF2419
+	.value	0x105
+	.byte	0xd
+	.long	0xb3
+	.uleb128 0x1c
+	.string	"tmp"
+	.value	0x12a
+	.byte	0xd
+	.long	0xb3
+	.uleb128 0x13
+	.long	0xdf7
+	.uleb128 0xf
+	.long	.LASF2420
+	.value	0x112
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x14
+	.uleb128 0x1c
+	.string	"tmp"
+	.value	0x115
+	.byte	0x11
+	.long	0xb3
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xe09
+	.uleb128 0xf
+	.long	.LASF2421
+	.value	0x136
+	.byte	0x11
+	.long	0x1da
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.long	.LASF2422
+	.value	0x13b
+	.byte	0x15
+	.long	0xf4
+	.uleb128 0xf
+	.long	.LASF2423
+	.value	0x13c
+	.byte	0x15
+	.long	0xf4
+	.uleb128 0xf
+	.long	.LASF2424
+	.value	0x13d
+	.byte	0x15
+	.long	0xf4
+	.uleb128 0xf
+	.long	.LASF2425
+	.value	0x13e
+	.byte	0x15
+	.long	0xf4
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2427
+	.byte	0xb0
+	.long	0xece
+	.uleb128 0x3
+	.long	.LASF2428
+	.byte	0xb2
+	.byte	0x12
+	.long	0x10c
+	.uleb128 0x3
+	.long	.LASF2429
+	.byte	0xb3
+	.byte	0x12
+	.long	0x10c
+	.uleb128 0x3
+	.long	.LASF2430
+	.byte	0xb4
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x3
+	.long	.LASF2431
+	.byte	0xb5
+	.byte	0x15
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2432
+	.byte	0xb6
+	.byte	0x13
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF2433
+	.byte	0xb7
+	.byte	0xe
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2434
+	.byte	0xb8
+	.byte	0x9
+	.long	0x220
+	.uleb128 0x3
+	.long	.LASF2435
+	.byte	0xb9
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x13
+	.long	0xeaf
+	.uleb128 0x3
+	.long	.LASF2436
+	.byte	0xd4
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0x13
+	.long	0xec0
+	.uleb128 0x3
+	.long	.LASF2436
+	.byte	0xe4
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x3
+	.long	.LASF2420
+	.byte	0xf3
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2443
+	.byte	0x9d
+	.byte	0xe
+	.long	0xf28
+	.uleb128 0x10
+	.long	.LASF2433
+	.byte	0x15
+	.byte	0x9d
+	.byte	0x37
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2437
+	.byte	0x9e
+	.byte	0x10
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF2438
+	.byte	0x9f
+	.byte	0x14
+	.long	0xf28
+	.uleb128 0x3
+	.long	.LASF2439
+	.byte	0xa0
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF2440
+	.byte	0xa1
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF2441
+	.byte	0xa2
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x3
+	.long	.LASF2442
+	.byte	0xa8
+	.byte	0x13
+	.long	0xae
+	.byte	0
+	.uleb128 0x9
+	.long	0xa2
+	.long	0xf38
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2444
+	.byte	0x88
+	.byte	0xd
+	.long	0xf7b
+	.uleb128 0x3
+	.long	.LASF2445
+	.byte	0x8a
+	.byte	0x14
+	.long	0xc4
+	.uleb128 0x3
+	.long	.LASF2446
+	.byte	0x8b
+	.byte	0x12
+	.long	0xed
+	.uleb128 0x3
+	.long	.LASF2447
+	.byte	0x8c
+	.byte	0x12
+	.long	0xed
+	.uleb128 0x3
+	.long	.LASF2377
+	.byte	0x94
+	.byte	0xb
+	.long	0xed
+	.uleb128 0x17
+	.string	"yaw"
+	.byte	0x95
+	.byte	0xb
+	.long	0xed
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2448
+	.byte	0x64
+	.byte	0xd
+	.long	0xfe8
+	.uleb128 0x10
+	.long	.LASF2420
+	.byte	0x15
+	.byte	0x64
+	.byte	0x27
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF2449
+	.byte	0x66
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x3
+	.long	.LASF2450
+	.byte	0x67
+	.byte	0xb
+	.long	0xed
+	.uleb128 0x3
+	.long	.LASF2451
+	.byte	0x73
+	.byte	0xb
+	.long	0xed
+	.uleb128 0x3
+	.long	.LASF2452
+	.byte	0x75
+	.byte	0x11
+	.long	0xf4
+	.uleb128 0x3
+	.long	.LASF2453
+	.byte	0x7d
+	.byte	0xb
+	.long	0xed
+	.uleb128 0x13
+	.long	0xfda
+	.uleb128 0x3
+	.long	.LASF2454
+	.byte	0x79
+	.byte	0x15
+	.long	0xf4
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x3
+	.long	.LASF2455
+	.byte	0x7f
+	.byte	0x15
+	.long	0xf4
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2457
+	.byte	0x5a
+	.byte	0x9
+	.long	0xa2
+	.long	0x100f
+	.uleb128 0x15
+	.string	"tmp"
+	.byte	0x15
+	.byte	0x5a
+	.byte	0x22
+	.long	0xb3
+	.uleb128 0x3
+	.long	.LASF2458
+	.byte	0x5c
+	.byte	0x13
+	.long	0xbf
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2459
+	.byte	0x4a
+	.long	0x1039
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x4c
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x14
+	.uleb128 0x17
+	.string	"tmp"
+	.byte	0x4f
+	.byte	0x11
+	.long	0xa2
+	.uleb128 0x17
+	.string	"y"
+	.byte	0x50
+	.byte	0x11
+	.long	0xc4
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2470
+	.byte	0x15
+	.byte	0x43
+	.byte	0x7
+	.long	0xed
+	.uleb128 0x18
+	.long	.LASF2460
+	.byte	0x3f
+	.byte	0x7
+	.long	0xed
+	.long	0x1061
+	.uleb128 0x10
+	.long	.LASF2420
+	.byte	0x15
+	.byte	0x3f
+	.byte	0x1e
+	.long	0x7c
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2461
+	.byte	0x3b
+	.byte	0x7
+	.long	0xed
+	.long	0x107d
+	.uleb128 0x10
+	.long	.LASF2420
+	.byte	0x15
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x7c
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2462
+	.byte	0x37
+	.byte	0x7
+	.long	0xed
+	.long	0x1099
+	.uleb128 0x10
+	.long	.LASF2420
+	.byte	0x15
+	.byte	0x37
+	.byte	0x1b
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2463
+	.byte	0x11
+	.byte	0x92
+	.byte	0x65
+	.long	0x10a5
+	.uleb128 0x16
+	.long	0xa5f
+	.uleb128 0x1e
+	.long	.LASF2464
+	.byte	0xe
+	.byte	0x59
+	.byte	0x8d
+	.long	0x10b6
+	.uleb128 0x16
+	.long	0x76b
+	.uleb128 0x2c
+	.long	.LASF2471
+	.byte	0x5
+	.byte	0x88
+	.byte	0x15
+	.long	0xed
+	.long	0x10f0
+	.uleb128 0x15
+	.string	"amt"
+	.byte	0x5
+	.byte	0x88
+	.byte	0x26
+	.long	0xed
+	.uleb128 0x15
+	.string	"low"
+	.byte	0x5
+	.byte	0x88
+	.byte	0x31
+	.long	0xed
+	.uleb128 0x10
+	.long	.LASF2465
+	.byte	0x5
+	.byte	0x88
+	.byte	0x3c
+	.long	0xed
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2466
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x15
+	.string	"amt"
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x15
+	.string	"low"
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x10
+	.long	.LASF2465
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 25 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.file 28 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 30 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 31 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 34 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 36 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 41 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2a
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 50 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.file 51 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 52 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 53 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 54 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 55 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x16
+	.file 56 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.file 57 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.file 59 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.file 60 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 62 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 65 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 66 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1966
+	.byte	0x4
+	.file 67 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x43
+	.file 68 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 69 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 70 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1976
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1977
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1978
+	.byte	0x4
+	.byte	0x4
+	.file 71 "./src/main/fc/fc_rc.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 72 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x48
+	.file 73 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x49
+	.file 74 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2060
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2081
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF989
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF993
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF995
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1300
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1317
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1384
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1425
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1429
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1573
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1994
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2038
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2042
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2059
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2076
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2472
+	.long	.LASF2473
+	.long	.LASF2474
+	.long	.LASF2475
+	.long	.LASF2476
+	.long	.LASF2477
+	.long	.LASF2478
+	.long	.LASF2479
+	.long	.LASF2480
+	.long	.LASF2481
+	.long	.LASF2482
+	.long	.LASF2483
+	.long	.LASF2484
+	.long	.LASF2485
+	.long	.LASF2486
+	.long	.LASF2487
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2488
+	.byte	0xc
+	.long	.LASF2489
+	.byte	0xc
+	.long	.LASF2490
+	.byte	0xc
+	.long	.LASF2491
+	.byte	0x1
+	.long	.LASF2492
+	.byte	0x2
+	.long	.LASF2493
+	.byte	0x2
+	.long	.LASF2494
+	.byte	0x4
+	.long	.LASF2495
+	.byte	0x4
+	.long	.LASF2496
+	.byte	0x5
+	.long	.LASF2497
+	.byte	0x6
+	.long	.LASF2498
+	.byte	0x5
+	.long	.LASF2499
+	.byte	0x2
+	.long	.LASF2500
+	.byte	0x5
+	.long	.LASF2501
+	.byte	0x5
+	.long	.LASF2502
+	.byte	0x5
+	.long	.LASF2503
+	.byte	0x5
+	.long	.LASF2504
+	.byte	0x7
+	.long	.LASF2505
+	.byte	0x8
+	.long	.LASF2506
+	.byte	0x6
+	.long	.LASF2507
+	.byte	0x9
+	.long	.LASF2508
+	.byte	0x5
+	.long	.LASF2509
+	.byte	0x3
+	.long	.LASF2510
+	.byte	0xc
+	.long	.LASF2511
+	.byte	0x6
+	.long	.LASF2512
+	.byte	0xf
+	.long	.LASF2513
+	.byte	0x10
+	.long	.LASF2514
+	.byte	0x10
+	.long	.LASF2514
+	.byte	0xf
+	.long	.LASF2515
+	.byte	0xc
+	.long	.LASF2516
+	.byte	0xf
+	.long	.LASF2517
+	.byte	0xf
+	.long	.LASF2518
+	.byte	0xc
+	.long	.LASF2519
+	.byte	0xc
+	.long	.LASF2520
+	.byte	0xe
+	.long	.LASF2521
+	.byte	0xc
+	.long	.LASF2522
+	.byte	0xd
+	.long	.LASF2523
+	.byte	0xd
+	.long	.LASF2524
+	.byte	0xc
+	.long	.LASF2525
+	.byte	0xc
+	.long	.LASF2526
+	.byte	0xc
+	.long	.LASF2527
+	.byte	0xf
+	.long	.LASF2528
+	.byte	0xc
+	.long	.LASF2529
+	.byte	0xc
+	.long	.LASF2530
+	.byte	0xc
+	.long	.LASF2531
+	.byte	0xc
+	.long	.LASF2532
+	.byte	0xc
+	.long	.LASF2533
+	.byte	0xc
+	.long	.LASF2534
+	.byte	0xc
+	.long	.LASF2535
+	.byte	0xc
+	.long	.LASF2536
+	.byte	0xb
+	.long	.LASF2537
+	.byte	0xa
+	.long	.LASF2538
+	.byte	0x10
+	.long	.LASF2539
+	.byte	0xa
+	.long	.LASF2540
+	.byte	0x2
+	.long	.LASF2541
+	.byte	0x2
+	.long	.LASF2542
+	.byte	0x3
+	.long	.LASF2543
+	.byte	0x1
+	.long	.LASF2544
+	.byte	0x3
+	.long	.LASF2545
+	.byte	0x4
+	.long	.LASF2546
+	.byte	0x4
+	.long	.LASF2547
+	.byte	0x4
+	.long	.LASF2548
+	.byte	0x4
+	.long	.LASF2549
+	.byte	0x4
+	.long	.LASF2550
+	.byte	0x4
+	.long	.LASF2551
+	.byte	0x4
+	.long	.LASF2552
+	.byte	0x4
+	.long	.LASF2553
+	.byte	0x4
+	.long	.LASF2554
+	.byte	0x4
+	.long	.LASF2555
+	.byte	0x4
+	.long	.LASF2556
+	.byte	0x4
+	.long	.LASF2557
+	.byte	0x5
+	.long	.LASF2558
+	.byte	0x6
+	.long	.LASF2559
+	.byte	0x4
+	.long	.LASF2560
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1957:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1061:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1729:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2357:
+	.string	"TASK_PID"
+.LASF1459:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1593:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF732:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF937:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1787:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1733:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1724:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1281:
+	.string	"USE_FAKE_BARO "
+.LASF1057:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1007:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF948:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1604:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1377:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1248:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF841:
+	.string	"__DECL_SIMD_sinh "
+.LASF2311:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF1215:
+	.string	"USE_CLI "
+.LASF2199:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1414:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1688:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1639:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1242:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1961:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF769:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1302:
+	.string	"USE_PPM"
+.LASF2073:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2393:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2180:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1807:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1602:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1860:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF905:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF885:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF742:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1998:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1978:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1467:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1941:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1201:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF946:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1329:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2307:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2087:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2458:
+	.string	"tmp2"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1030:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1540:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1005:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2132:
+	.string	"_Bool"
+.LASF2337:
+	.string	"spektrum_sat_bind"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1966:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF700:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2067:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1806:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1267:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1152:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1119:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF909:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1243:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2141:
+	.string	"OWNER_ADC_CURR"
+.LASF837:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1660:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1065:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1611:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2449:
+	.string	"rcExpo"
+.LASF2001:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2415:
+	.string	"failsafeIsActive"
+.LASF1766:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1582:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2126:
+	.string	"DEBUG_COUNT"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2037:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1884:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2083:
+	.string	"short unsigned int"
+.LASF2354:
+	.string	"rxConfig_System"
+.LASF2454:
+	.string	"expof"
+.LASF2007:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF746:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1369:
+	.string	"__WCHAR_T__ "
+.LASF2341:
+	.string	"rssi_invert"
+.LASF1394:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1953:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1530:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF717:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1522:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF921:
+	.string	"__DECL_SIMD_erf "
+.LASF1792:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1776:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1925:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1900:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1183:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1486:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2138:
+	.string	"OWNER_LED"
+.LASF705:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1624:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1929:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1902:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2189:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2098:
+	.string	"uint16_t"
+.LASF2279:
+	.string	"BOXANTIGRAVITY"
+.LASF917:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1023:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1559:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1446:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1066:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1892:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2079:
+	.string	"RC_RATE_INCREMENTAL 14.54f"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2461:
+	.string	"getRcDeflection"
+.LASF994:
+	.string	"__DECL_SIMD_powf"
+.LASF1233:
+	.string	"TELEMETRY_HOTT "
+.LASF724:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF863:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1032:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1975:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1477:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1182:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF699:
+	.string	"_MATH_H 1"
+.LASF1824:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1397:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1845:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1586:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1339:
+	.string	"_T_PTRDIFF_ "
+.LASF1333:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2023:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF713:
+	.string	"__DECL_SIMD_sinl "
+.LASF1835:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1518:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1296:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF715:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1704:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1197:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2269:
+	.string	"yaw_deadband"
+.LASF1871:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"__DECL_SIMD_atan "
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2234:
+	.string	"currentPidProfile"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF961:
+	.string	"__DECL_SIMD_tan "
+.LASF1452:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2442:
+	.string	"rcCommandSpeed"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1368:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2246:
+	.string	"controlRateConfig_t"
+.LASF734:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2422:
+	.string	"radDiff"
+.LASF1612:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1979:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1916:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2034:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2297:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1104:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1526:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1237:
+	.string	"CMS "
+.LASF2063:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF790:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1924:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2384:
+	.string	"PID_YAW"
+.LASF1817:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2417:
+	.string	"isAntiGravityModeActive"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF733:
+	.string	"__DECL_SIMD_logl "
+.LASF1952:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2145:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2020:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1078:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1064:
+	.string	"__DECL_SIMD_tanh"
+.LASF1484:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF970:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1620:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1585:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1449:
+	.string	"BIT(x) (1 << (x))"
+.LASF2169:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1574:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1679:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"__DECL_SIMD_exp "
+.LASF2066:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF951:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1076:
+	.string	"__DECL_SIMD_tan"
+.LASF816:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1134:
+	.string	"_Mdouble_"
+.LASF2096:
+	.string	"int32_t"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1412:
+	.string	"FAST_MATH "
+.LASF1280:
+	.string	"BARO "
+.LASF1180:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF991:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1437:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1052:
+	.string	"__DECL_SIMD_atanh"
+.LASF925:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1934:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1938:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"___int_wchar_t_h "
+.LASF2177:
+	.string	"OWNER_SPI_PREINIT"
+.LASF743:
+	.string	"__DECL_SIMD_expl "
+.LASF1874:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2051:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1439:
+	.string	"STR_HELPER(x) #x"
+.LASF2201:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2433:
+	.string	"rxRefreshRate"
+.LASF1644:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1003:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2005:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1326:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2166:
+	.string	"OWNER_BARO_EXTI"
+.LASF996:
+	.string	"__DECL_SIMD_acos"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1666:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__always_inline"
+.LASF807:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1088:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1983:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF840:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1303:
+	.string	"USE_PWM"
+.LASF1739:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2418:
+	.string	"getTaskDeltaTime"
+.LASF1956:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2379:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1606:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2144:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2280:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1523:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2401:
+	.string	"targetPidLooptime"
+.LASF876:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1773:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2423:
+	.string	"cosDiff"
+.LASF1536:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1040:
+	.string	"__DECL_SIMD_log10"
+.LASF1145:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1024:
+	.string	"__DECL_SIMD_expm1"
+.LASF1167:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF808:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1009:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1138:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1890:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"prop"
+.LASF2187:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1667:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF976:
+	.string	"__DECL_SIMD_sin"
+.LASF740:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1122:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1245:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2450:
+	.string	"rcRate"
+.LASF1911:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2241:
+	.string	"thrExpo8"
+.LASF801:
+	.string	"__DECL_SIMD_exp2 "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1967:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF913:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1171:
+	.string	"__MATHCALL_NARROW"
+.LASF2114:
+	.string	"DEBUG_VELOCITY"
+.LASF899:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1973:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1737:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2018:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1854:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1048:
+	.string	"__DECL_SIMD_log1p"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1156:
+	.string	"__MATHDECL_1"
+.LASF1049:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1708:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1919:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2290:
+	.string	"BOXLEDLOW"
+.LASF2327:
+	.string	"rxConfig_s"
+.LASF1033:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2167:
+	.string	"OWNER_USB"
+.LASF2437:
+	.string	"index"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10"
+.LASF1745:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2179:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1479:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1364:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1917:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1092:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1601:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1026:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2277:
+	.string	"BOXHORIZON"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1440:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2336:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF2213:
+	.string	"pidSumLimit"
+.LASF2220:
+	.string	"horizon_tilt_effect"
+.LASF1046:
+	.string	"__DECL_SIMD_log2f"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2004:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2339:
+	.string	"rssi_channel"
+.LASF1123:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1661:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2168:
+	.string	"OWNER_USB_DETECT"
+.LASF819:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1798:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1836:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2204:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2208:
+	.string	"dterm_lpf_hz"
+.LASF1760:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1135:
+	.string	"__MATH_PRECNAME"
+.LASF1165:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1130:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2191:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1837:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2400:
+	.string	"airmodeWasActivated"
+.LASF2291:
+	.string	"BOXLLIGHTS"
+.LASF1084:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2149:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1321:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2055:
+	.string	"PIDSUM_LIMIT 500"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1877:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2188:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2028:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2349:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1515:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2278:
+	.string	"BOXBARO"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1438:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2137:
+	.string	"OWNER_SERVO"
+.LASF1451:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1505:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1274:
+	.string	"ACC "
+.LASF975:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1497:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1297:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2428:
+	.string	"rcCommandInterp"
+.LASF1240:
+	.string	"TELEMETRY_IBUS "
+.LASF1219:
+	.string	"USE_PWM "
+.LASF826:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1299:
+	.string	"TELEMETRY_LTM"
+.LASF2010:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1634:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1722:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2009:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2330:
+	.string	"sbus_inversion"
+.LASF2107:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF760:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1945:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1458:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1848:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2451:
+	.string	"rcCommandf"
+.LASF2377:
+	.string	"roll"
+.LASF1345:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2342:
+	.string	"midrc"
+.LASF1301:
+	.string	"USE_VCP"
+.LASF2432:
+	.string	"interpolationChannels"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2014:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2088:
+	.string	"__int16_t"
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1852:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2211:
+	.string	"dterm_notch_cutoff"
+.LASF2021:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2112:
+	.string	"DEBUG_NOTCH"
+.LASF2090:
+	.string	"__uint16_t"
+.LASF1107:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1991:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2136:
+	.string	"OWNER_MOTOR"
+.LASF827:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1401:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1393:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1964:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1772:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1421:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2060:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2163:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1270:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF872:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1188:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1999:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF797:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1443:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1974:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1193:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1600:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1399:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF766:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2229:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1249:
+	.string	"USE_SENSOR_NAMES "
+.LASF2200:
+	.string	"FEATURE_AIRMODE"
+.LASF2332:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF828:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1034:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1282:
+	.string	"USE_FLASHFS "
+.LASF1680:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1920:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1662:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF2421:
+	.string	"throttleScaler"
+.LASF936:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1411:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1719:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2363:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF729:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1041:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1997:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1396:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1185:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2029:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1103:
+	.string	"__f32x(x) x ##f32x"
+.LASF815:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1155:
+	.string	"__MATHDECL_1_IMPL"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2042:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1785:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1137:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2070:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1435:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1161:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1169:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1560:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1731:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1250:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF2315:
+	.string	"HORIZON_MODE"
+.LASF1603:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2082:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1619:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF758:
+	.string	"__DECL_SIMD_powf32x "
+.LASF889:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2331:
+	.string	"halfDuplex"
+.LASF1570:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1573:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1471:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1071:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1346:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1809:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2244:
+	.string	"rcYawExpo8"
+.LASF1273:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1258:
+	.string	"USE_NAV "
+.LASF2439:
+	.string	"rxRefreshRateMs"
+.LASF2182:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1826:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2333:
+	.string	"rx_spi_id"
+.LASF1638:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2092:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1272:
+	.string	"USE_FAKE_LED "
+.LASF1986:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2100:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1494:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1625:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2275:
+	.string	"BOXARM"
+.LASF379:
+	.string	"linux 1"
+.LASF2348:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1391:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1715:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2324:
+	.string	"FAILSAFE_MODE"
+.LASF1158:
+	.string	"__MATHDECL"
+.LASF1276:
+	.string	"GYRO "
+.LASF2343:
+	.string	"mincheck"
+.LASF1550:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF923:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1436:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1691:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1323:
+	.string	"VTX_COMMON"
+.LASF1580:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1637:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF784:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1338:
+	.string	"_PTRDIFF_T "
+.LASF2292:
+	.string	"BOXCALIB"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2183:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF973:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2185:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1398:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1461:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1051:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2122:
+	.string	"DEBUG_ALTITUDE"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1427:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF849:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2288:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF2441:
+	.string	"throttleVelocityThreshold"
+.LASF1672:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2175:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1230:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2375:
+	.string	"TASK_SELF"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2125:
+	.string	"DEBUG_FFT_FREQ"
+.LASF2254:
+	.string	"AUX1"
+.LASF2255:
+	.string	"AUX2"
+.LASF774:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2257:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2259:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2261:
+	.string	"AUX8"
+.LASF1561:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1501:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2206:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2465:
+	.string	"high"
+.LASF2344:
+	.string	"maxcheck"
+.LASF1179:
+	.string	"FP_NORMAL 4"
+.LASF1706:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2251:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1376:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1488:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1827:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1227:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2027:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1404:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2158:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1923:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1617:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1444:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2365:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF822:
+	.string	"__DECL_SIMD_coshf "
+.LASF1113:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2039:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF903:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1744:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF2221:
+	.string	"horizon_tilt_expert_mode"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1808:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1622:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1177:
+	.string	"FP_ZERO 2"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1711:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1728:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1849:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2116:
+	.string	"DEBUG_ANGLERATE"
+.LASF1653:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1734:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2298:
+	.string	"BOXSERVO1"
+.LASF2299:
+	.string	"BOXSERVO2"
+.LASF2300:
+	.string	"BOXSERVO3"
+.LASF1093:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1857:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1132:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2245:
+	.string	"tpa_breakpoint"
+.LASF2453:
+	.string	"angleRate"
+.LASF1657:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2411:
+	.string	"cos_approx"
+.LASF1943:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1872:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1521:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF710:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF873:
+	.string	"__DECL_SIMD_log10l "
+.LASF2102:
+	.string	"debug"
+.LASF398:
+	.string	"false 0"
+.LASF1970:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1207:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1955:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1883:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1605:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1557:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1712:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF750:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1981:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1914:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2376:
+	.string	"cfTaskId_e"
+.LASF1095:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2431:
+	.string	"currentRxRefreshRate"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF701:
+	.string	"__DECL_SIMD_cos "
+.LASF972:
+	.string	"__DECL_SIMD_cos"
+.LASF1186:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1047:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF966:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF860:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2032:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2069:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF879:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1904:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"__DECL_SIMD_asinf "
+.LASF1334:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1577:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1218:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1351:
+	.string	"_SIZE_T "
+.LASF1652:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2338:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1541:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2446:
+	.string	"cosFactor"
+.LASF2317:
+	.string	"BARO_MODE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2352:
+	.string	"rx_max_usec"
+.LASF1466:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1162:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1268:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1664:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF974:
+	.string	"__DECL_SIMD_cosf"
+.LASF1146:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1020:
+	.string	"__DECL_SIMD_cosh"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF749:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF906:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF702:
+	.string	"__DECL_SIMD_cosf "
+.LASF2196:
+	.string	"FEATURE_OSD"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2249:
+	.string	"isRXDataNew"
+.LASF1947:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2195:
+	.string	"FEATURE_DASHBOARD"
+.LASF735:
+	.string	"__DECL_SIMD_logf32 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1469:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1199:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2119:
+	.string	"DEBUG_STACK"
+.LASF2172:
+	.string	"OWNER_INVERTER"
+.LASF1196:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2056:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2024:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2064:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF2074:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2153:
+	.string	"OWNER_SPI_MOSI"
+.LASF1926:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"MAG_MODE"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2097:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2052:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2152:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1714:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1136:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2416:
+	.string	"rxGetRefreshRate"
+.LASF1755:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"TELEMETRY "
+.LASF1762:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF767:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1627:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1055:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF2081:
+	.string	"THROTTLE_DELTA_MS 100"
+.LASF1073:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF959:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF941:
+	.string	"__DECL_SIMD_asinh "
+.LASF2252:
+	.string	"PITCH"
+.LASF1797:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"VERY_FAST_MATH "
+.LASF1949:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2358:
+	.string	"TASK_ACCEL"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2383:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1381:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2295:
+	.string	"BOXTELEMETRY"
+.LASF1363:
+	.string	"___int_size_t_h "
+.LASF969:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1315:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1568:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1865:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2313:
+	.string	"boxId_e"
+.LASF1778:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2425:
+	.string	"rcCommand_PITCH"
+.LASF1176:
+	.string	"FP_INFINITE 1"
+.LASF1166:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF821:
+	.string	"__DECL_SIMD_cosh "
+.LASF1168:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF711:
+	.string	"__DECL_SIMD_sin "
+.LASF1803:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_"
+.LASF2054:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF979:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1072:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1086:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1356:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1988:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF995:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1367:
+	.string	"__need_size_t"
+.LASF1077:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2427:
+	.string	"processRcCommand"
+.LASF2135:
+	.string	"OWNER_PPMINPUT"
+.LASF2131:
+	.string	"ioTag_t"
+.LASF1583:
+	.string	"IOCFG_IPD 0"
+.LASF1348:
+	.string	"__need_ptrdiff_t"
+.LASF754:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2129:
+	.string	"FD_PITCH"
+.LASF2218:
+	.string	"levelAngleLimit"
+.LASF785:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1111:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1209:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2062:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF823:
+	.string	"__DECL_SIMD_coshl "
+.LASF1448:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2420:
+	.string	"axis"
+.LASF1150:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1519:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1335:
+	.string	"_STDDEF_H "
+.LASF2227:
+	.string	"rateAccelLimit"
+.LASF908:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2326:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1889:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"__DECL_SIMD_sinf"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1623:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2408:
+	.string	"qMultiply"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1971:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1216:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1547:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2075:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1709:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF739:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1746:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF2015:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1819:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1545:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1139:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1649:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2340:
+	.string	"rssi_scale"
+.LASF1509:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1710:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1476:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2240:
+	.string	"thrMid8"
+.LASF1514:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2026:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1673:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2452:
+	.string	"rcCommandfAbs"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2426:
+	.string	"updateRcCommands"
+.LASF1361:
+	.string	"_SIZE_T_DECLARED "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1087:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2049:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2306:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1607:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1142:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1726:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1717:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2395:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF2123:
+	.string	"DEBUG_FFT"
+.LASF1558:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1312:
+	.string	"LED_STRIP"
+.LASF1856:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1039:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1579:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1085:
+	.string	"__f128(x) x ##f128"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1141:
+	.string	"_Mdouble_ long double"
+.LASF714:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1630:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1901:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2345:
+	.string	"rcInterpolation"
+.LASF2396:
+	.string	"pidCrashRecovery_e"
+.LASF2109:
+	.string	"DEBUG_MIXER"
+.LASF1626:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2304:
+	.string	"BOX3DDISABLE"
+.LASF1572:
+	.string	"IO_TAG_NONE 0"
+.LASF1309:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1470:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2198:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1987:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2072:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF796:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF997:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF783:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1232:
+	.string	"TELEMETRY_FRSKY "
+.LASF1596:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF962:
+	.string	"__DECL_SIMD_tanf "
+.LASF1843:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1556:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1406:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2148:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1148:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1781:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1841:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1984:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1308:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF703:
+	.string	"__DECL_SIMD_cosl "
+.LASF1359:
+	.string	"_SIZE_T_DEFINED "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1584:
+	.string	"IOCFG_IPU 0"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1124:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1271:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1386:
+	.string	"NULL"
+.LASF2044:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2202:
+	.string	"FEATURE_RX_SPI"
+.LASF2238:
+	.string	"rcYawRate8"
+.LASF2378:
+	.string	"pitch"
+.LASF2219:
+	.string	"levelSensitivity"
+.LASF2150:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2436:
+	.string	"channel"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1532:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1682:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF2323:
+	.string	"SONAR_MODE"
+.LASF2469:
+	.string	"resetYawAxis"
+.LASF1382:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1395:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2346:
+	.string	"rcInterpolationChannels"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2265:
+	.string	"RC_SMOOTHING_MANUAL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2235:
+	.string	"pidProfile_s"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2443:
+	.string	"checkForThrottleErrorResetState"
+.LASF929:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1261:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1533:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1211:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1192:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2274:
+	.string	"rcControlsConfig_System"
+.LASF882:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1893:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1153:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF931:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2013:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1770:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1343:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1178:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1083:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1491:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1935:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1044:
+	.string	"__DECL_SIMD_log2"
+.LASF1228:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1314:
+	.string	"TELEMETRY_HOTT"
+.LASF772:
+	.string	"__DECL_SIMD_atanf "
+.LASF2470:
+	.string	"getThrottlePIDAttenuation"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1899:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1022:
+	.string	"__DECL_SIMD_coshf"
+.LASF1059:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF2106:
+	.string	"DEBUG_BATTERY"
+.LASF1310:
+	.string	"USE_SERIALRX_SUMH"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1703:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"UNIT_TESTED "
+.LASF2412:
+	.string	"feature"
+.LASF1490:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2263:
+	.string	"RC_SMOOTHING_DEFAULT"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1499:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF780:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2203:
+	.string	"FEATURE_SOFTSPI"
+.LASF1659:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF999:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1482:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF779:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2467:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1996:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1099:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1485:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1474:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1208:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1352:
+	.string	"_SYS_SIZE_T_H "
+.LASF831:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1170:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1149:
+	.string	"_Mdouble_ _Float128"
+.LASF1566:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2456:
+	.string	"pidSetItermAccelerator"
+.LASF1635:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2215:
+	.string	"dterm_average_count"
+.LASF950:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2445:
+	.string	"lastFpvCamAngleDegrees"
+.LASF1913:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1721:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"USE_FAKE_FLASH "
+.LASF897:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1042:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2006:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1748:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1844:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1759:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1730:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2216:
+	.string	"vbatPidCompensation"
+.LASF893:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2402:
+	.string	"setpointRate"
+.LASF2247:
+	.string	"currentControlRateProfile"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF820:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2355:
+	.string	"TASK_SYSTEM"
+.LASF725:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2403:
+	.string	"rcDeflection"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1388:
+	.string	"__need_NULL"
+.LASF898:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2266:
+	.string	"rcCommand"
+.LASF2359:
+	.string	"TASK_ATTITUDE"
+.LASF1880:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1151:
+	.string	"_Mdouble_ _Float32x"
+.LASF1426:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1067:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF1164:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1674:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1655:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1615:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF755:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF886:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1322:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2319:
+	.string	"GPS_HOLD_MODE"
+.LASF1992:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF817:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2353:
+	.string	"rxConfig_t"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1285:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1157:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1757:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"TELEMETRY_IBUS"
+.LASF1036:
+	.string	"__DECL_SIMD_atan2"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1492:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1432:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1328:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2320:
+	.string	"HEADFREE_MODE"
+.LASF788:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2156:
+	.string	"OWNER_SDCARD"
+.LASF1203:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF891:
+	.string	"__DECL_SIMD_log1p "
+.LASF1668:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF963:
+	.string	"__DECL_SIMD_tanl "
+.LASF818:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1944:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1187:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1407:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2095:
+	.string	"int16_t"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1035:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2086:
+	.string	"signed char"
+.LASF1100:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1468:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF736:
+	.string	"__DECL_SIMD_logf64 "
+.LASF719:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2104:
+	.string	"DEBUG_NONE"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1349:
+	.string	"__size_t__ "
+.LASF1234:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1173:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1235:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1266:
+	.string	"U_ID_1 1"
+.LASF1070:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1295:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1378:
+	.string	"_WCHAR_T_H "
+.LASF1887:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1500:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1994:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1050:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2356:
+	.string	"TASK_GYROPID"
+.LASF1027:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF2193:
+	.string	"FEATURE_RSSI_ADC"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF919:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1410:
+	.string	"sq(x) ((x)*(x))"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF887:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1017:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1453:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1850:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2003:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1001:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1102:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1357:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1868:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1298:
+	.string	"USE_DASHBOARD"
+.LASF1238:
+	.string	"TELEMETRY_LTM "
+.LASF1259:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1204:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1698:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2022:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF2108:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF2283:
+	.string	"BOXCAMSTAB"
+.LASF2372:
+	.string	"TASK_RCSPLIT"
+.LASF883:
+	.string	"__DECL_SIMD_log2l "
+.LASF2019:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1360:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1985:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2128:
+	.string	"FD_ROLL"
+.LASF1508:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF984:
+	.string	"__DECL_SIMD_log"
+.LASF1256:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1091:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1330:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2399:
+	.string	"SystemCoreClock"
+.LASF1000:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1793:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2303:
+	.string	"BOXAIRMODE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2329:
+	.string	"serialrx_provider"
+.LASF1331:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1512:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1143:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1126:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1645:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1337:
+	.string	"_ANSI_STDDEF_H "
+.LASF1495:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1567:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2170:
+	.string	"OWNER_OSD"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1647:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1859:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1498:
+	.string	"PG_PID_PROFILE 14"
+.LASF1908:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"__DECL_SIMD_expf"
+.LASF859:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1551:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2281:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1195:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1610:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1754:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2011:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1121:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1222:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1590:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF728:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1140:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1801:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF2262:
+	.string	"RC_SMOOTHING_OFF"
+.LASF1253:
+	.string	"VTX_SMARTAUDIO "
+.LASF2264:
+	.string	"RC_SMOOTHING_AUTO"
+.LASF1101:
+	.string	"__f32(x) x ##f32"
+.LASF1982:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2059:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1428:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2223:
+	.string	"itermAcceleratorGain"
+.LASF2387:
+	.string	"PID_POSR"
+.LASF2231:
+	.string	"crash_recovery_angle"
+.LASF2388:
+	.string	"PID_NAVR"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF890:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1811:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1968:
+	.string	"I2CDEV_COUNT 4"
+.LASF744:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1481:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1616:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2041:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1564:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1814:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1004:
+	.string	"__DECL_SIMD_asin"
+.LASF1537:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF888:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1257:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1025:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1045:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF775:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2371:
+	.string	"TASK_BLACKBOX"
+.LASF1597:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1511:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2068:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2130:
+	.string	"FD_YAW"
+.LASF2093:
+	.string	"long int"
+.LASF2308:
+	.string	"BOXCAMERA2"
+.LASF2309:
+	.string	"BOXCAMERA3"
+.LASF1008:
+	.string	"__DECL_SIMD_hypot"
+.LASF2440:
+	.string	"indexMax"
+.LASF1716:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1782:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2058:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF884:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1549:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1608:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1422:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF920:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF847:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2146:
+	.string	"OWNER_PINDEBUG"
+.LASF1989:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1931:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF833:
+	.string	"__DECL_SIMD_expm1l "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2233:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1701:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"BOXOSD"
+.LASF2008:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1239:
+	.string	"TELEMETRY_CRSF "
+.LASF2118:
+	.string	"DEBUG_SCHEDULER"
+.LASF1342:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1562:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1390:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1658:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2414:
+	.string	"lrintf"
+.LASF1341:
+	.string	"__PTRDIFF_T "
+.LASF1723:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF848:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2424:
+	.string	"sinDiff"
+.LASF1125:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF2046:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1796:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1317:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1830:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2361:
+	.string	"TASK_SERIAL"
+.LASF1628:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF851:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1441:
+	.string	"EXPAND_I(x) x"
+.LASF2366:
+	.string	"TASK_GPS"
+.LASF1790:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2448:
+	.string	"calculateSetpointRate"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2061:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2460:
+	.string	"getRcDeflectionAbs"
+.LASF2134:
+	.string	"OWNER_PWMINPUT"
+.LASF1131:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2071:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2099:
+	.string	"uint32_t"
+.LASF1355:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF980:
+	.string	"__DECL_SIMD_sincos"
+.LASF1614:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1905:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"U_ID_0 0"
+.LASF1053:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1063:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1105:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1198:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1805:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1869:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF881:
+	.string	"__DECL_SIMD_log2 "
+.LASF1389:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1804:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF869:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2033:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF900:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2140:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2286:
+	.string	"BOXGPSHOLD"
+.LASF1106:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1160:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1832:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1418:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1548:
+	.string	"PG_PID_CONFIG 504"
+.LASF939:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1875:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2236:
+	.string	"controlRateConfig_s"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1993:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1821:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1108:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF751:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1313:
+	.string	"TELEMETRY_FRSKY"
+.LASF2085:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1194:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2282:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1527:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2103:
+	.string	"debugMode"
+.LASF1371:
+	.string	"_T_WCHAR_ "
+.LASF2210:
+	.string	"dterm_notch_hz"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1487:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1262:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2360:
+	.string	"TASK_RX"
+.LASF720:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2250:
+	.string	"headFreeModeHold"
+.LASF1191:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2285:
+	.string	"BOXGPSHOME"
+.LASF2214:
+	.string	"pidSumLimitYaw"
+.LASF2147:
+	.string	"OWNER_TIMER"
+.LASF1685:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1528:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1212:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2373:
+	.string	"TASK_COUNT"
+.LASF2225:
+	.string	"dtermSetpointWeight"
+.LASF1578:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1839:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"USE_FAKE_MAG "
+.LASF1725:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1898:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2457:
+	.string	"rcLookupThrottle"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2094:
+	.string	"char"
+.LASF1163:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF877:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1366:
+	.string	"__size_t "
+.LASF2239:
+	.string	"rcExpo8"
+.LASF1969:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2228:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1948:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1383:
+	.string	"__DEFINED_wchar_t "
+.LASF1094:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1820:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1581:
+	.string	"IOCFG_AF_PP 0"
+.LASF1990:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF874:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1650:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF791:
+	.string	"__DECL_SIMD_hypot "
+.LASF1116:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1815:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF839:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2289:
+	.string	"BOXLEDMAX"
+.LASF2301:
+	.string	"BOXBLACKBOX"
+.LASF747:
+	.string	"__DECL_SIMD_expf128 "
+.LASF2242:
+	.string	"rates"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF706:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF878:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF770:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1642:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1571:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1823:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1769:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2159:
+	.string	"OWNER_FLASH_CS"
+.LASF2302:
+	.string	"BOXFAILSAFE"
+.LASF1311:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1247:
+	.string	"USE_RX_MSP "
+.LASF1799:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1434:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF708:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1707:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2000:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF762:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1774:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"__DECL_SIMD_expf32x "
+.LASF945:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2111:
+	.string	"DEBUG_PIDLOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2025:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1089:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF757:
+	.string	"__DECL_SIMD_powf128 "
+.LASF850:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1021:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1210:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1304:
+	.string	"SERIAL_RX"
+.LASF1977:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1408:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2207:
+	.string	"dterm_filter_type"
+.LASF2296:
+	.string	"BOXGTUNE"
+.LASF1520:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2382:
+	.string	"PID_ROLL"
+.LASF957:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF786:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF731:
+	.string	"__DECL_SIMD_log "
+.LASF1387:
+	.string	"NULL ((void *)0)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1305:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2318:
+	.string	"GPS_HOME_MODE"
+.LASF1751:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2404:
+	.string	"rcDeflectionAbs"
+.LASF2184:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1525:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1325:
+	.string	"VTX_SMARTAUDIO"
+.LASF1223:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2151:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1246:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2143:
+	.string	"OWNER_ADC_RSSI"
+.LASF1462:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1043:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1862:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2367:
+	.string	"TASK_COMPASS"
+.LASF1761:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1011:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF716:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF812:
+	.string	"__DECL_SIMD_exp10f "
+.LASF745:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2012:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2276:
+	.string	"BOXANGLE"
+.LASF2314:
+	.string	"ANGLE_MODE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1800:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2002:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1385:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1588:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2362:
+	.string	"TASK_DISPATCH"
+.LASF1110:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1340:
+	.string	"_T_PTRDIFF "
+.LASF776:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF968:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF911:
+	.string	"__DECL_SIMD_acosh "
+.LASF1075:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF967:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2197:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2036:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1275:
+	.string	"USE_FAKE_ACC "
+.LASF1736:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF377:
+	.string	"__linux 1"
+.LASF1172:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1842:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1205:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1788:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2232:
+	.string	"crash_recovery_rate"
+.LASF1175:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1097:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1758:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2115:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF868:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF824:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2409:
+	.string	"qConstruct"
+.LASF2447:
+	.string	"sinFactor"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1752:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1430:
+	.string	"NOOP do {} while (0)"
+.LASF1671:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2406:
+	.string	"lookupThrottleRC"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1654:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1937:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2017:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1324:
+	.string	"VTX_CONTROL"
+.LASF1621:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF737:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1058:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1959:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF956:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1037:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2048:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1502:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2253:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2110:
+	.string	"DEBUG_AIRMODE"
+.LASF983:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1886:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1771:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2455:
+	.string	"rcSuperfactor"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1694:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1538:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1478:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1454:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1812:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2105:
+	.string	"DEBUG_CYCLETIME"
+.LASF2120:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1213:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF926:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1676:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF993:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1810:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1225:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1217:
+	.string	"USE_CLI_BATCH "
+.LASF1853:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2101:
+	.string	"double"
+.LASF1629:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1450:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1683:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2154:
+	.string	"OWNER_I2C_SCL"
+.LASF998:
+	.string	"__DECL_SIMD_acosf"
+.LASF1640:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2176:
+	.string	"OWNER_COMPASS_CS"
+.LASF1374:
+	.string	"_WCHAR_T_ "
+.LASF2045:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1277:
+	.string	"USE_FAKE_GYRO "
+.LASF1764:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2462:
+	.string	"getSetpointRate"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2192:
+	.string	"FEATURE_RX_MSP"
+.LASF2364:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2347:
+	.string	"rcInterpolationInterval"
+.LASF1375:
+	.string	"_BSD_WCHAR_T_ "
+.LASF809:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2186:
+	.string	"FEATURE_GPS"
+.LASF2212:
+	.string	"itermWindupPointPercent"
+.LASF1928:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1403:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2267:
+	.string	"rcControlsConfig_s"
+.LASF2273:
+	.string	"rcControlsConfig_t"
+.LASF1190:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1565:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2312:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2091:
+	.string	"__int32_t"
+.LASF2463:
+	.string	"rxConfig"
+.LASF1184:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2155:
+	.string	"OWNER_I2C_SDA"
+.LASF2038:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2293:
+	.string	"BOXGOV"
+.LASF2270:
+	.string	"alt_hold_deadband"
+.LASF1420:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF2434:
+	.string	"readyToCalculateRate"
+.LASF949:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF2430:
+	.string	"rcInterpolationStepCount"
+.LASF1866:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2194:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2368:
+	.string	"TASK_BARO"
+.LASF1424:
+	.string	"Q12 (1 << 12)"
+.LASF2413:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF2243:
+	.string	"dynThrPID"
+.LASF1062:
+	.string	"__DECL_SIMD_erff"
+.LASF1260:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1909:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2248:
+	.string	"timeDelta_t"
+.LASF1670:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF763:
+	.string	"__DECL_SIMD_acosl "
+.LASF1507:
+	.string	"PG_RX_CONFIG 24"
+.LASF1534:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1513:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1472:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF989:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2043:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1779:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1791:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1433:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1677:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF752:
+	.string	"__DECL_SIMD_powf "
+.LASF2035:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1128:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1372:
+	.string	"_T_WCHAR "
+.LASF1447:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1365:
+	.string	"_SIZET_ "
+.LASF1946:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2031:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2369:
+	.string	"TASK_ALTITUDE"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1665:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1336:
+	.string	"_STDDEF_H_ "
+.LASF1595:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1347:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF781:
+	.string	"__DECL_SIMD_asin "
+.LASF1962:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2394:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1963:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF971:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1159:
+	.string	"__MATHCALL"
+.LASF875:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1742:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1510:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1695:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2389:
+	.string	"PID_LEVEL"
+.LASF1206:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2171:
+	.string	"OWNER_RX_BIND"
+.LASF1539:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF928:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1252:
+	.string	"VTX_CONTROL "
+.LASF901:
+	.string	"__DECL_SIMD_atanh "
+.LASF2256:
+	.string	"AUX3"
+.LASF1851:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2174:
+	.string	"OWNER_TRANSPONDER"
+.LASF1506:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2258:
+	.string	"AUX5"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2260:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF813:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1697:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2078:
+	.string	"SETPOINT_RATE_LIMIT 1998.0f"
+.LASF2325:
+	.string	"flightModeFlags"
+.LASF1643:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1813:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2335:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF2224:
+	.string	"setpointRelaxRatio"
+.LASF1416:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2468:
+	.string	"rc_alias"
+.LASF2405:
+	.string	"throttlePIDAttenuation"
+.LASF1079:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1006:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1068:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2030:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1028:
+	.string	"__DECL_SIMD_sinh"
+.LASF2305:
+	.string	"BOXFPVANGLEMIX"
+.LASF830:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF792:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1031:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF726:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1236:
+	.string	"USE_SERVOS "
+.LASF777:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1651:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1663:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1181:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1822:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1054:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1542:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF870:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2459:
+	.string	"generateThrottleCurve"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF756:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2053:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1847:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2161:
+	.string	"OWNER_MPU_CS"
+.LASF2164:
+	.string	"OWNER_SPI_CS"
+.LASF2435:
+	.string	"readyToCalculateRateAxisCnt"
+.LASF1553:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1081:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2016:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1910:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1327:
+	.string	"USE_I2C"
+.LASF778:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2272:
+	.string	"yaw_control_reversed"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1278:
+	.string	"MAG "
+.LASF2113:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF718:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1455:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1109:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1480:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1636:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1080:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1292:
+	.string	"USE_UART7 "
+.LASF1442:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2217:
+	.string	"pidAtMinThrottle"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1354:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2047:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2464:
+	.string	"rcControlsConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1392:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1144:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1074:
+	.string	"__DECL_SIMD_erfcf"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1613:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1489:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2040:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2080:
+	.string	"THROTTLE_BUFFER_MAX 20"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf "
+.LASF977:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1419:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1456:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF829:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF836:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1775:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1794:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1749:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2374:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1740:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1405:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF940:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2133:
+	.string	"OWNER_FREE"
+.LASF811:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1631:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF825:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF799:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2391:
+	.string	"PID_VEL"
+.LASF916:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2117:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1429:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1702:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2351:
+	.string	"rx_min_usec"
+.LASF964:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2410:
+	.string	"sin_approx"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1686:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1569:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2334:
+	.string	"rx_spi_rf_channel_count"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1098:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1718:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2237:
+	.string	"rcRate8"
+.LASF759:
+	.string	"__DECL_SIMD_powf64x "
+.LASF709:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1995:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2407:
+	.string	"degreesToRadians"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1816:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1463:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1460:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f"
+.LASF773:
+	.string	"__DECL_SIMD_atanl "
+.LASF1293:
+	.string	"USE_UART8 "
+.LASF1700:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1332:
+	.string	"DEFIO_NO_PORTS "
+.LASF1646:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1940:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2050:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1344:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF871:
+	.string	"__DECL_SIMD_log10 "
+.LASF904:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1370:
+	.string	"_WCHAR_T "
+.LASF1504:
+	.string	"PG_SERVO_MIXER 21"
+.LASF927:
+	.string	"__DECL_SIMD_erff128 "
+.LASF810:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1972:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2230:
+	.string	"crash_time"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1950:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF765:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1029:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1633:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF753:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1838:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1576:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF730:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2190:
+	.string	"FEATURE_3D"
+.LASF935:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1380:
+	.string	"__INT_WCHAR_T_H "
+.LASF1264:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1493:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2157:
+	.string	"OWNER_SDCARD_CS"
+.LASF1147:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1863:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2121:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1465:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1358:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1423:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2381:
+	.string	"attitude"
+.LASF2328:
+	.string	"rcmap"
+.LASF1154:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1362:
+	.string	"__DEFINED_size_t "
+.LASF1220:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2076:
+	.string	"ALL_MOTORS 255"
+.LASF1609:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1594:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1907:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1286:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1599:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1932:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1818:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1516:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2310:
+	.string	"BOXDSHOTREVERSE"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF922:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1656:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1980:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2271:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1554:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2178:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1829:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1294:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF793:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF704:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1226:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1689:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2380:
+	.string	"attitudeEulerAngles_t"
+.LASF1587:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2173:
+	.string	"OWNER_LED_STRIP"
+.LASF1846:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1287:
+	.string	"USE_UART2 "
+.LASF1251:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1254:
+	.string	"VTX_TRAMP "
+.LASF2386:
+	.string	"PID_POS"
+.LASF2390:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2392:
+	.string	"PID_ITEM_COUNT"
+.LASF1060:
+	.string	"__DECL_SIMD_erf"
+.LASF861:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1786:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF712:
+	.string	"__DECL_SIMD_sinf "
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2321:
+	.string	"UNUSED_MODE"
+.LASF723:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1784:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1115:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1112:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2089:
+	.string	"short int"
+.LASF1763:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2226:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF803:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1288:
+	.string	"USE_UART3 "
+.LASF1127:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2397:
+	.string	"pid8_s"
+.LASF1535:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2065:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1373:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1546:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2209:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1284:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1038:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1350:
+	.string	"__SIZE_T__ "
+.LASF1475:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2429:
+	.string	"rcStepSize"
+.LASF992:
+	.string	"__DECL_SIMD_pow"
+.LASF2181:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2385:
+	.string	"PID_ALT"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2370:
+	.string	"TASK_TELEMETRY"
+.LASF2160:
+	.string	"OWNER_BARO_CS"
+.LASF1767:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2127:
+	.string	"fix12_t"
+.LASF1544:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1415:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2350:
+	.string	"airModeActivateThreshold"
+.LASF2084:
+	.string	"unsigned int"
+.LASF1289:
+	.string	"USE_UART4 "
+.LASF795:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1965:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF2438:
+	.string	"rcCommandThrottlePrevious"
+.LASF960:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1958:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1316:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1589:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2205:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f "
+.LASF721:
+	.string	"__DECL_SIMD_sincos "
+.LASF1517:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1896:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2287:
+	.string	"BOXPASSTHRU"
+.LASF988:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1552:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1833:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2139:
+	.string	"OWNER_ADC"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2165:
+	.string	"OWNER_MPU_EXTI"
+.LASF1483:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF2268:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF987:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2124:
+	.string	"DEBUG_FFT_TIME"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2222:
+	.string	"itermThrottleThreshold"
+.LASF2284:
+	.string	"BOXCAMTRIG"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1290:
+	.string	"USE_UART5 "
+.LASF1881:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF2322:
+	.string	"PASSTHRU_MODE"
+.LASF1431:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1320:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1632:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2142:
+	.string	"OWNER_ADC_EXT"
+.LASF953:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1713:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1543:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2057:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1795:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1402:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2162:
+	.string	"OWNER_OSD_CS"
+.LASF2466:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1922:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2444:
+	.string	"scaleRcCommandToFpvCamAngle"
+.LASF2398:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1802:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1189:
+	.string	"M_E 2.7182818284590452354"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1692:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1598:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1789:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF947:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2471:
+	.string	"constrainf"
+.LASF2077:
+	.string	"THROTTLE_LOOKUP_LENGTH 12"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1291:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1976:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2494:
+	.string	"io_types.h"
+.LASF2535:
+	.string	"mathcalls-helper-functions.h"
+.LASF2527:
+	.string	"math.h"
+.LASF2521:
+	.string	"long-double.h"
+.LASF2536:
+	.string	"platform.h"
+.LASF2478:
+	.string	"src/main/rx"
+.LASF2475:
+	.string	"src/main/drivers"
+.LASF2529:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2515:
+	.string	"libc-header-start.h"
+.LASF2520:
+	.string	"cdefs.h"
+.LASF2485:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2528:
+	.string	"math-vector.h"
+.LASF2489:
+	.string	"stdint-intn.h"
+.LASF2501:
+	.string	"rc_controls.h"
+.LASF2537:
+	.string	"common_fc_pre.h"
+.LASF2484:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2487:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2522:
+	.string	"stubs.h"
+.LASF2518:
+	.string	"wordsize.h"
+.LASF2480:
+	.string	"src/main/target/SITL"
+.LASF2560:
+	.string	"timer.h"
+.LASF2507:
+	.string	"target.h"
+.LASF2493:
+	.string	"axis.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2497:
+	.string	"pid.h"
+.LASF2483:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2511:
+	.string	"failsafe.h"
+.LASF2496:
+	.string	"config.h"
+.LASF2506:
+	.string	"imu.h"
+.LASF2557:
+	.string	"fc_rc.h"
+.LASF2517:
+	.string	"features-time64.h"
+.LASF2556:
+	.string	"vcd.h"
+.LASF2555:
+	.string	"sound_beeper.h"
+.LASF2488:
+	.string	"types.h"
+.LASF2558:
+	.string	"mixer.h"
+.LASF2531:
+	.string	"floatn-common.h"
+.LASF2530:
+	.string	"floatn.h"
+.LASF2503:
+	.string	"runtime_config.h"
+.LASF2539:
+	.string	"common_fc_post.h"
+.LASF2513:
+	.string	"stdbool.h"
+.LASF2486:
+	.string	"/usr/include"
+.LASF0:
+	.string	"./src/main/fc/fc_rc.c"
+.LASF2472:
+	.string	"src/main/build"
+.LASF2509:
+	.string	"feature.h"
+.LASF2554:
+	.string	"rcc_types.h"
+.LASF2491:
+	.string	"debug.h"
+.LASF2477:
+	.string	"src/main/flight"
+.LASF2524:
+	.string	"typesizes.h"
+.LASF2553:
+	.string	"bus_i2c.h"
+.LASF2525:
+	.string	"time64.h"
+.LASF2549:
+	.string	"serial.h"
+.LASF2546:
+	.string	"flash.h"
+.LASF2505:
+	.string	"scheduler.h"
+.LASF2508:
+	.string	"fc_rc.c"
+.LASF2519:
+	.string	"timesize.h"
+.LASF2502:
+	.string	"rc_modes.h"
+.LASF2490:
+	.string	"stdint-uintn.h"
+.LASF2481:
+	.string	"src/main/target"
+.LASF2540:
+	.string	"utils.h"
+.LASF2482:
+	.string	"src/main"
+.LASF2474:
+	.string	"src/main/config"
+.LASF2510:
+	.string	"mathcalls.h"
+.LASF2532:
+	.string	"flt-eval-method.h"
+.LASF2495:
+	.string	"resource.h"
+.LASF2500:
+	.string	"fc_core.h"
+.LASF2499:
+	.string	"time.h"
+.LASF2544:
+	.string	"parameter_group_ids.h"
+.LASF2534:
+	.string	"fp-fast.h"
+.LASF2504:
+	.string	"rx.h"
+.LASF2516:
+	.string	"features.h"
+.LASF2551:
+	.string	"io_def.h"
+.LASF2476:
+	.string	"src/main/fc"
+.LASF2550:
+	.string	"io.h"
+.LASF2547:
+	.string	"rx_pwm.h"
+.LASF2492:
+	.string	"maths.h"
+.LASF2533:
+	.string	"fp-logb.h"
+.LASF2473:
+	.string	"src/main/common"
+.LASF2548:
+	.string	"sdcard.h"
+.LASF2514:
+	.string	"stdint.h"
+.LASF2543:
+	.string	"build_config.h"
+.LASF2526:
+	.string	"wchar.h"
+.LASF2523:
+	.string	"stubs-64.h"
+.LASF2559:
+	.string	"pwm_output.h"
+.LASF2498:
+	.string	"controlrate_profile.h"
+.LASF2538:
+	.string	"stddef.h"
+.LASF2552:
+	.string	"io_def_generated.h"
+.LASF2479:
+	.string	"src/main/scheduler"
+.LASF2545:
+	.string	"adc.h"
+.LASF2542:
+	.string	"parameter_group.h"
+.LASF2512:
+	.string	"stdc-predef.h"
+.LASF2541:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\232\001\255\n"
+	.string	"D\f\216\002"
+	.string	"\034"
+	.string	"\316\351\342\317\r\034\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002\004\002\003\002\005\001\002\006\002\007\003\240\342\234\212\n\004\007\b\264\340\323\243\002\032\002\b\002\b\002\t\002\n\013\006\002\f\n\013\f\320\212\353\303\016\030\002\001\002\r\002\001\003\002\003\016\352\263\360\321\b\017\315\343\301\244\013\020\021\377\341\234\356\013\002\022\023\024\354\206\342\366\006\003\025\026\313\310\317\346\002\b\006\002\016\027\030\302\216\353\377\t\004\031\216\264\330\345\nF\017\002\017\002\t\020\002\020\002\006\002\006\006\017\002\017\033\035\036\356\302\274\235\f\037!\231\232\305\342\r@\002\006\002\021\t\002\003\t\022\017\t\002\023\002\023\003\002\004&\232\214\265\246\f\005'(\240\342\234\212\n"
+	.ascii	"M\250\361\255\241!\311\240\240X8`\202r\252\310\003\020PI\210"
+	.ascii	"6i\016+j\224\"z;\311\276\205\243hN\020_\313S\327A\367\275~\037"
+	.ascii	"\264nx\353\256\346\013\013#\215^\233lnX\231\234\311H\n\031\234"
+	.ascii	"\177\317\3451\334L\357a\214\357\334I^\320v\254\2310Y\367\266"
+	.ascii	"\256\201)h\314')u\240F-b\254dD\375\306\352\350\212R\214\tj\270"
+	.ascii	"\324\325\035/\007\357\242\274=1\274\205\005L\n\231\3507>\217"
+	.ascii	"7a<\367\227\313\3727\017"
+	.text
+	.section	.gnu.lto_.ipa_sra.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375 x\355\001"
+	.string	"\320l"
+	.string	"\f"
+	.string	"\001\001\b\021\003\022\023\024"
+	.string	"\003\026"
+	.string	"\001\030\031"
+	.string	"!"
+	.string	"&"
+	.string	"\001"
+	.string	"\017"
+	.string	"`"
+	.string	"\204\223Y\330\n\311\356\302T\343\336\034\006\306U\031\274y\031'Y\356\006\225\301/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\023\002\345\013"
+	.string	"F\221>:@\305(\215\001\344\204k)it\037\034\017\213\337\370\236\210\272\\>\304\244\271\263<\374\b+\331*<\314\332\361\251\270\3068\016\036\020\361q\202\036\177A}\n\330\330@>\221R\246*"
+	.string	"0"
+	.string	"/"
+	.string	"+\250\226\315\272z\032c\214\332\1774\245\262\301\232\270\374\234\346\237 \311i\305\257\371K\343\324\342}?KZu\204\217\374\366\n\004\373Q\017p"
+	.string	"K\303\333\266w\240F=K\261`\214Qb\177\004\3153\026\343\305\303\230\354\314\333\224\212T\222\0313\246\263*\222I,\363\346o_\001\273}\273q\322\263\"1F\202\023\376\221\366\242\3450\265B\b\375\024-\312\324\n\027\346x\233\315\035\030t\224\373.\027\334\201\032\272X"
+	.string	"\"\364\003{\252\237\016w\240\376\003YHG!$)\031 \244\260\217\025,K3h\264\003S\243\237I\f\355A\232q:)\245\013\264(\247\222\306\002V\370\0025 `\2421\225\346\001\267\210\331|i\271\211\233Ba\242\002\362f\340\362\013W\20009D\013\340\371\270\353"
+	.ascii	"\351r\324\325\016\274=\220#B\231\271\356j\303\0369\005\266\350"
+	.ascii	"\203\005L\375k\307\204\024\227\333\356\307Q\305\324\355p\n\330"
+	.ascii	"\004.\230\360\274\340\036\346\205\260\203\b \357\n\307l\345\360"
+	.ascii	"\334\233n\341\026\274\016D-Pq\031\b\361o\262;\002\3064\350\257"
+	.ascii	"\300\341\226HX\207\"\230\242\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\245\005"
+	.ascii	"\002\007\031#\240)\303\001?\252q,D\\UU\254\305\370\367\261\177"
+	.ascii	"U\034\370\007\311\326\355\304\266\017>\177\357\275\211\224)\177"
+	.ascii	"\202\021\326q\332\324\246\252\243\003%\\*\225\327\342\202\265"
+	.ascii	"\213S\230\202e\243\222\276\317C\206\241)|\363n p\001\346\251"
+	.ascii	"$\350QI\034zl\260v\302\367\205\274\367@\264\004\200k\264\220"
+	.ascii	"3\323\021! `\002)\250\326\003$f\220\020N\314\335e\032c\371\016"
+	.ascii	"\0275\002X\231w\330\345\002\300\207S\003&\3447m\003j0\217\347"
+	.ascii	"\022\3040w\241\255\035\213@\270#i\360\345\232\307\225\203H\216"
+	.ascii	"\263\266\217\002t\3421\213\031%\375\236\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\231\004\b\231\004\f\230\004\021\204\004\022\204\004\023\204"
+	.ascii	"\004\024\204\004\026\231\004\030\204\004\031\230\004!\231\004"
+	.ascii	"&\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\245\005"
+	.string	"\022\b\027\036\200k\206\003\310\220\t`<2\"#2\302 \323\320!\223\311\330\240\355\022*\353\361\nI\2462\217\244;=\247\310NzB~\254\240\350\031\355,\n\225,\341\030\264\373\371#\232\267\016\206\251\202\312\n\336\330\255\347zv\313\223\261SO5\300\201\363\\\354\232'\363:\rP&\301M\002% P\002\021\230\204\017 B^o\241\324N\r\001C\b^\331:\266\204\031\f\031|5`5\347\334n>[q3\034/\0203\356G\3621\263"
+	.string	"\333)\013\330\0323\233\356Hd\035n\177\007\336:\022v3\005\006\020N\\=o\305\035\r\216_\271\235\207Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.lto.881d92c916c245b9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.72.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\325\b"
+	.string	"\346\220>; \005)\035"
+	.string	"\\$\310\204&8\253\305\260\001\275n\bf\016\\\007BPQ\316-\330\317\273\264\373(\210\\\216+I"
+	.string	"\330$`r\331s\314\360\034\355\335(Q\230\326\277\311\226)\005-"
+	.string	"-"
+	.string	"+"
+	.string	"\033HM\252\305fw\245\347\005\234G\355\004\234GH\362\357\372\371OyB\312E\265:]\003\"v\327\252Z\211\334\360\266?\266!l\307\004\257_5\2759\315\313n\310,\300\316D\331\211\355\317\336l\204\017\205\353_\226\261\300.\313\005\263\273\013\376t\036m\373\256\243|vL\302#6\307Y\034\353\354\356\203\257\362\225\f\337\344\321\032&\275\352\3217\301\203\022\031Jg\336X\253"
+	.string	"l\330I\341\210}ma\313V5|n\bM\207\020\b\304\300\r\224H\033\"\315\223\233\336\304\034\3119\222\026$Q\205\234^Ir\006\356.(<\211\321u\236\334`{ma\013B\017\nv\330\001\n"
+	.ascii	"\211\231E\306\336\365YS\313\364\212\261\30051\210\211<\252\240"
+	.ascii	"\001Pi:\355$\003"
+	.text
+	.section	.gnu.lto_getRcDeflection.73.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\245\b"
+	.string	"\346\020=6@\223\032\003\314\340/I\221\222\031cIS\345\356\200\3453g\t\325N@E\310\360S\217\326C}\230\205\260\252\020!\304l\342Uc\310\302\2408\367\r\021\271\245L),"
+	.string	","
+	.string	"+"
+	.string	"\\\007M\2452\363\177vL\260\261\334<\260\261\214!\376\f\277\332&>P\305\254X(C\200\207\377\205+\326\207\033\335\326\323\326\241mK0\033n\260\3060+\277G\215\346/rF\322\366k\271\266#\203`hX]\032\360\267^,\377\023\352\341X\266\255_.\371Z\031\004G)\225q\3767\324'F\271\250G,\213q\202^Y\326\247h 2K\301Z\271\326!\255\215\241`\004i\275\375\177\243\253\205\260\321\001]\bu\f!\020H\341#`\"e\210\266v\237\316\213\350F\263\033M\n\222hbv\236i~\nZ\252\220\360\246E\251\344M.vo\217\256\030;\251\270\241\341\n"
+	.ascii	"\211\231E\306\336\365Yk\031\004\306\214\254\030\013\3422zTA\003"
+	.ascii	"\240\322t\332I\006"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.74.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\335\b"
+	.string	"\266P>:0%'\035"
+	.string	"\360_**\247"
+	.string	"\255\3369\244\262\224R\001N\226NQ{w\3440\2661\304wj\f\304\0163\353\2720\340\201\021w\375\214!\252\274\243E\265\240tm{\357\235R,"
+	.string	"."
+	.string	"+"
+	.string	"/\020\230\235\335\245\331\013<\237\362\004\236\317x\362\356\260\363\317r\251S\022\343\245N\207\001\022\273k\350\245H\356x\333\n\266#l\317\004P\"\204\374\006gw\344\025`m\246+\305vgcvF\263p\370\3175\026\330U}2\273\313\340\204\317\247m_\345+\235\335\232\370\300D\002/n}v\027\302o\271\213\206\217\362\351\r\023\274\367\351\233\342A\216\013\005_\306T\013\001\330\254\023\214&\366\345\306\225\r\241\343\277?v\b\325\207\020\b\324\240\r\224H\034\"\351\252U\216\242\216h\035\321\013\222\310\202V\256D5\003o\030\025\034\315\3306\216b\254\275\334\270\2121CE\217\216\007\013"
+	.string	"\211\231E\306\336\365Yk\031\004\306\214\254\030\013\\\023\213\230\310\243\n\032"
+	.ascii	"\225\306\324N2"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.75.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375 \372\305\006"
+	.string	"B\215/4PO\222\016\214\276\232\373U\363\200\227\265q\364\255\370\361t\314\254\363Y/\026\262\366\242G\275\347(@{df\226\310\n\255\006\201R\211\224T\254\265F\266L\001W\230\352J\2502\257\312<\007\006\205\206W]\020\017C\260\365\260p\275\b\313\272\036\265e\235\206\356\262q\023\337\221n\203\256g\211?\330\254\322\3753UB\027\320\321\331`h*#q\3457\r:\215o\224N\373\342\350\n,\212\322\222y\021bI\023\251\304\343\307\236\272 \r\301\036\024m\034\236\236TP\220\250d\346\273t`\252\024U`\252\3446\212\025\261[\221F\037\235\224\214\243)\002 d\346\230q0\272\353\177\360\033\374Z\b"
+	.ascii	"2\001\0178c`\034\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_generateThrottleCurve.77.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\350\004} "
+	.string	"\246\374\316H\220\330Q:\301s\203\332\304vr\023k\314\332\376\256\326\252\207\361\\2\006\360At\306\363\215\347@\332\353?\024\230\013\212V\241\300=\003"
+	.string	""
+	.string	"T\253"
+	.string	"\204:a \313s\006 \200\364\333\315e\201\266\273\241\222\277\tI;\311\301"
+	.string	"\252"
+	.string	"\276"
+	.ascii	"\273\326\3050Z\177\255\213\016\333\232.\313`\346\021e\343\223"
+	.ascii	"\256\227s\376|/\270\316\363\\`\272\314\261OuI\315S]\352n\020"
+	.ascii	"\203d\321@2]\332\303\255\351T\030\031@\020e!\224yr\315|d\265"
+	.ascii	"\bs\236\305\001.W\200\351r\243v\277\270H\343\264qE\260\207\231"
+	.ascii	"\363<w\237\2616\223E\257I\243L3g\265$O\243\326\224\205\217\251"
+	.ascii	"*)\323H\222\f\032\242\251\224PA.\230\372\201y\350\243\246\f\253"
+	.ascii	"+\317R\270\336\252\202@Z\2360I\346\260\234\230\270U\201 \005"
+	.ascii	"L\311\362\3420S\252\252\037\275\207.\263\260\304\304\260\272"
+	.ascii	"2\235=8\317s\351T\225\225\327\306\273\233cw\033\354\222X\002"
+	.ascii	"k\033\273\304D=\345r\315T]\376\f\266\\\331\330\251\372\364\006"
+	.ascii	"v\371\350\232\305\335?\231`Y\217\256Y\207\331\"\216\304/)\242"
+	.ascii	"\025\342\337\202\252\026\032\tF\217\242\331*\244G\035TN\212f"
+	.ascii	"\267(E\277\265k#\034M\312\354\265v\213\210l\364\016\t\231\350"
+	.ascii	"\315Y\350\305\315\350\006\235.P\245\373s\272>\247\333S\351\362"
+	.ascii	"T\272;\225\256N\245"
+	.string	"\233S\351\342T\272\267J\367\246\322\265U\272\265J\327\246\244K\253t\315\323\235\235n=\335\262\244K\222t\177\272\364t\035\240\206\231\202\213r\236$\326\2449\245\224Gp\230h\033m\241\0379\257]\347Dc@,\234\337<\347\273\036\300\035\277\035G\350\267\357\310\202e\266\333\374\346\004\306\314\233\267\375H\f\330\345\333\261Z{\356\n\3556\027l\204v\203\331\3625t\3638\262`\231\217.?{\220\232&BtF:\200q;21X\025a\227\372\255\375\340u\203$\272\265\274F\334b\316\235\212\210\235\374\350\031%\271}\320+\211n\242u\344\327\212\241*\321\255\346v\034\243(\274dqA>\325\2417\031\241\374\350\231\265\035\221\230\350\t\266\243\221\241\333h\335\207N\305\202e\345\351\353O\006\310E\276\274\203e\253\344!P\t\326B<`0\317\363\264\215\016\325%y\332\327\372\207\201t\b\032\2268\334\311k"
+	.string	"\211\207"
+	.string	"\351\300\201\002G:J^\336\021\257\211\002\317\302\216ga\227A\251\302\322\216\327\264aw\364\263L\032\222\232v\034\230\230\232v\265\342\351km\0041Rz\367\355\026\245\314\320\276\265\263\032\263\242?\bu\017\343vm\206\252\270C\340\362\243gN\034\207B\223\347y\236\346\267\3144^D*\371%\313\334\205N\265[t\013\255\353\211\031\367\"\017m\027\300a\320wW\202\227<\001\320r\236\247\202u\022+\251\260\313KJ\"\233\032\003\364\240{\246\305N\325\347@'\257"
+	.ascii	"\261|\307'\270\377\374b=\237\335\347\006b\361\274\347Aj\202e"
+	.ascii	"\275\235\363\\\301\023\340\016\235\233\3379\216\f\330\025c\250"
+	.ascii	"Q,D\rR\210\031\032\021\221$Qs`\002\0312d\007\021\340\305\243"
+	.ascii	"\231a;v*\371E1\021)#\226\224\310L\277KA\001E\355\210m\223O$\033"
+	.ascii	"r\345e\350\232\035`3\255#\330\"\215\224\023R\225Y\0136\342\230"
+	.ascii	"\263\255=\277%\374\375\025\235\006\247\257z\t\257\276\275{\321"
+	.ascii	"\021\004\362\377h\271}\270\350)\007\030\273-\316\271j\002]\351"
+	.ascii	"\201\352$\241\250o]\220Mz\303\232avE}\334S\367\320F#0W,$B\034"
+	.ascii	"\206\217\t\321\306>\b\377\361C\352J\305\204\035F\372\345Z]\347"
+	.ascii	"\220\221\270\030j\234\0375.\027tU\333\336+\352\002A\226>\322"
+	.ascii	"M\214\250\340\300<W8\302F,'\261^\004-\2676(\275\314\222\224)"
+	.ascii	"7j"
+	.text
+	.section	.gnu.lto_rcLookupThrottle.78.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\240\001%\020"
+	.string	"f_mF\340\222*\035XT\340\214\b\252\252\t\330\260\251\274\032\266a\250N\340\221\313\215+s"
+	.string	"\301*h\236\335n\336\325\020\361&s\260\027\364\303\f3\314P\220\241DM\005?\201R#\342A5\250\357\373K\332\336D\312\224\002X"
+	.string	"S"
+	.string	"Y"
+	.ascii	"s&x\364\003\317@\315\210\352Y\370*\276b\365\231\006s\346\004"
+	.ascii	"!\023c\316\271"
+	.string	"\300\007\274GRg\333Oq\227\225Y:#\221\"C\310`\265\035s\316\017\344\002\344\243>\200|\334\021g]Y\376_\036;x\250\211\251\264\256\233\bsNkL\205\303\275\267\215\3006\004[\277=\354YKW\204\375n.\213m\365\350\264[\364\331\037\212jPT\177\244\332#\325\035\251\346H\265'\325\233N-\245:Ju'\325\033\325\332\251\017@\342h\020\2201\347\206\234\2179#\336N\234v\3730+\017\3515b\377\205\226\301k\245x26\\r\314r7\252\303x!\3676\0347\005\027m\334\020[hw\273\2153\341\n\353\203hw\245-l\371\352\036\206si\316\266'\334\005\313\233s:\360c\336\302\344\233x\364\tE\037{\364Q\344\343W\244\304\315\365C\264\247\235\344\272q\317\310\320\212ViB\331Ks\326\030\0365\246\006$(\223\2523\211\t\330\300\244\244\204Ai\2042\251\326`\tLI"
+	.string	"O>\360\344\273`\201\202\351\003S\030\276\322"
+	.string	"\237P\025R\237\352tJ}\236\331\374\262\214\226\344\332\227A;\372\254.h\037\256x\366\263\035\r\f\347\202yg=+R\013e\234\355\266\263\233Z\330\342\355f9\033\242#D\341m\201\032\f\027\037"
+	.ascii	"\200\231E\3066\036\032W\375\320\201\206\016\3238\034\023\b\004"
+	.ascii	"\212\t(\306S\256\n\003\230\201\355\226A\nW\214\307DT\3230\030"
+	.ascii	"70\030\200\306\216\222M\317\340\\\303\031\300\212\243\213\307"
+	.ascii	"\022b\244\322&*#\240\t#%\305tM2"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.79.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\242\rE@"
+	.ascii	"Jh\364\026?@\244\326\030\377\337I\205\026\005G\363q1+\340\345"
+	.ascii	"]~3\276D\220h\205<;\017\bB\003]\037\223\246\323b\027\375\315"
+	.ascii	"\350c\323\307\346\327/\365iY\037<\235\330\365d\273\233H)SJ)b"
+	.ascii	"\001;\001`\001\334\334b:\220\371\3108\272\217\273L\233\3514\307"
+	.ascii	"\276\353\021\315\0318h\316(y<\001\3743\003\370\307\324\266\306"
+	.ascii	"M\306\257\372\276QX\"\310%\320\023\037\263\365&\203\243\375\330"
+	.ascii	"\312V\3377\244\2733\252\222@ai\306\004Zu\\\341\272Z\f\016\346"
+	.ascii	"c\267\312/L\356=n0|T\212\341#c\023\004%v\353\355\245\353\372"
+	.ascii	"\256\363\372\013\037\225f\314)+\260\326\373\"\276p\303<61\205"
+	.ascii	"\357[\315J\303c\353R\314\350%\223Z\341Z\270\331\3311q\205N\007"
+	.ascii	"\225\215\220\003\261[\245\034\223\271\312Vb\330\220\245)\034"
+	.ascii	"C\205\357\373Fu\313\026\210\3352+\247\314v\346\346\322]\300Z"
+	.ascii	"\216\377\270\370\276N\254c\336\367m2\002b\267\313Vr\273e\033"
+	.ascii	"\311\355\226\301\230\361t\325\355\035\262\201\031\273\013\364"
+	.ascii	"\276\257\363\2434X\033\025\021%\221Gc\2218t[\366\035\214\333"
+	.ascii	",O:g\257,\254\215\334\272\310\215\211\023\251u\222\007\023\252"
+	.ascii	"\022AN\314\322\032\271\344\370f\bZ\007\246\271QM\211\027\237"
+	.ascii	"\234\230%i\342\233!I\236\342\206\234\371\020I\273Dec\354\362"
+	.ascii	"}\337\251\267F\2325\226\031\351g\225\334\260\335!*\023c"
+	.string	"\231jj\212\364\227v\2622\251\373\020\303\373\276\354\3242\263\346\243fn\005\314\354\306\214\314\013O\274j;^\303-\013\236=\350\265`N\253\245\251P\325\004\331\250o\274^Z\233\315\016]\365\345\013\327k\037\261\367\215B\261\037\365~7\215\223\372\225\377\331w\t\247\205\376\377=v\210\261:\016\321\2779(\207\205\371\255\327#\326\242\f\243\337|\021\337\367\205\300\355f\207V\223\316[\227\333-\363\223\244\310q\263\3516]\334o,\003\352M\205\272\335\3667\007\317\242~ed\336\025\357\363\343\246\311\177\033{\363\237\233\340]\324\325\021\363A<\204\033\252y^\332\233\327\t1W\245\376m\314\315\276\377\204\271u\216`\325\326\346*\252\251\346k~\320t\315\316\246T\024\223\301\202\226\353N\320:\037\350j3T\3335\033xj\274\346e\3535+\211\316\005\206\316N\255sS\353L\240ufj\235\007\264\263\200\241s"
+	.string	"\327y\251uVj\235\223Zg\244\326\031@\353|\324:\033\265\316E\2553Q;'[gd\353|l\235\215\255s\261\235\211C\347a\353\354\272\316m\353\314\266\363\017\235\335u\356\t\306%n\232\362\274\257\220k\241W\260\365\253\322\326n\276\356j7]\267]7^\267^\0179|\032M\0036}\223!\320\364-!\323\023\370\036\360L\337\002~\300\017\360\023\340\005|\2010c\256F0]\204\233\243B\234\372\031]\344\206\3157\360d\205:\200\213}I\261\b\227\216pCB\013\201[\200\227\032\364\363\260\245G`\210\352\273\252g\244\364T\006\376\351\225\23654\215\223\0222\360mW\374\266o\273\244\007\360S\357r\246jH\237\364N\177\3238Gz'?S\270\007\177\364"
+	.ascii	"\236\211\320\350\217\236\r\343\374\2427z\001\315o~\321\273~\036"
+	.ascii	"|\363\365!\372\007\357\204\311'\372\236\026*?\371\254\234\261"
+	.ascii	"C`\272\177\344\361!~[q\255K\020W\352\231m\227\377\364d\375\345"
+	.ascii	"*=O\217\223\020[\227\334\006\225p\032<[\343\374\246\353e\324"
+	.ascii	"\371\036f\032(0\020[\223\350\374i@'P\250P\341v\333$\345,\017"
+	.ascii	"M\363\333N\352\003M\260\020\371\315\3575q\315\207\255\022\270"
+	.ascii	"\365\364\236\025\314\242E\013\267[\344\037\030\364\213\372\325"
+	.ascii	"\314\323P\352\370RjR\277\322\351\363#H4\376\361\377\317\370\254"
+	.ascii	"\234)\234\264\357}\3370\367\333\270\002 \313\340+@\371\250_>"
+	.ascii	"Y\005<v\301\367\332\026\265g\276\362\311\230\231]\276\213:6\375"
+	.ascii	"\245\215ysJwB\274|\f\321\226A\361\031\020\277\370\303\273a1`"
+	.ascii	"h\305`ql\315x\216\321\240+\206\327\025\324Ic\013\n\335z2yA\257"
+	.ascii	"\236k\313\353y\225\305\205U\303F\211'W2k\253F\016\254v\253F\216"
+	.ascii	"\rO.\367\311\345\032\273\\d\310zA\343\n\n\335\322\360\344Jby"
+	.ascii	"]\221\300\232\001\203\306U\221\247&<\255&TU9hp\324\245\225\343"
+	.ascii	"\212\345g\203'W\213g\226\363\231\345\244\241u\005u>\271\272\234"
+	.ascii	"\r\226x\253\006\026\227\323kk\213\313y\254F\373\237\360\2074"
+	.ascii	"\301\350K\331u4Wr\"\203\212\277\243\356\211:\022#\275\364\"\235"
+	.ascii	"FE\023<\322\007\336}\367\217\364\254\241\376\300\263O\373H\375"
+	.ascii	"*\206\346\214 \301\245'\200\177\276\207&\030e\277160\313\350"
+	.ascii	"\036\232{\305\311\353\204\336\250\300\023\321P\345en\266\241"
+	.ascii	"\203\007\017\324=P_\340\207a\246lz\312\036\222.\372\266\342["
+	.ascii	"_\220\244\325\317\230cS\244z\250'C\366\227\353\364Yu\203\354"
+	.ascii	"@<\310\027\210\020\336\324\020n\267N\277\224\242\017N\320\036"
+	.ascii	"\250\357*\321\267q\211?\310\246/\001x\364\036\335\201]\\#c\205"
+	.ascii	"\255\212\321\307:\202\025\325[\275\357\225U}[#|\325;\3414\215"
+	.ascii	"\324\257\200\335c\332\330g\256PPa4\211\334\233\3432]\262\270"
+	.ascii	"!\241\b\374\215:5I\252\333\240\3021\307oc<\"\246\3006\356ay\323"
+	.ascii	"i\272\217\354\301\025\301\022\201,\250q4\007\225R\206FD\024$"
+	.ascii	")I\322\001\201\005\304\030\247\240<\017\021\3408\352T\315\214"
+	.ascii	"\024\224$\205\366\f\320Y\006\230^\2604\221\340\344A\002\255c"
+	.ascii	"\277U\303S\256!%\220\277\tsO$&\247\025h\275\006\b,\255\037\r"
+	.ascii	"\301\274^\200\250\344\021@\351\"\346QA\350\246:\264\230\220\330"
+	.ascii	"V\345:h|\"H\341V\226\221\267\354=\221\207qL\355T\311\006\036"
+	.ascii	"\264\255\005-\373\240\250\273\001\331\004\036\235\376\257\222"
+	.ascii	"9\303H\2026\331\263\245U\262kJt\206\3342\033\366\260%Sc\003\373"
+	.ascii	"R\fvPa\204\273\211X\265(+_\337\350\036\262\"#\005\243\267:<:"
+	.ascii	"\262#7V\335\347A\037#\333\0172\020'l\211\202\231 \353>\301\213"
+	.ascii	"\036\350\373\027\374\241\362]\310\325\335W\247}\f\202 \351\316"
+	.ascii	" f\256\205\231\333\344\307\301\206\024\022v\200\027~P\363\f:"
+	.ascii	"PF\350\267\327\320\3735\322<\252\303\215\242\005\205Hg\376\362"
+	.ascii	"Ar\340-n\b\372\357\266C\"\246\022\332\351\016}\325@'\235C\354"
+	.ascii	"*\212\311\327\273\f\351)\241T0\362y\210\3209$\220y\366Ta\"\341"
+	.ascii	"O\027\033\210\027\355<!\2459fHi$\323i\333o\024T\317\220\364\252"
+	.ascii	"|\003\234\355s\272\335\242\205\322\261\026\212\333\356\347\231"
+	.ascii	"\336\276I\337\025\020\026\027M\205\246q\261O\037\341\0166\005"
+	.ascii	"\203\302\221\346&\226\214\333\204x\335\216@N[\261\243J\321J\315"
+	.ascii	"\312\345w\007\345@81\350Du\316\016\325Z\277\305\224\324/\360"
+	.ascii	"O\313\217\310\027BX\217G\226 \351\021X\003\370\342\241AK\034"
+	.ascii	"l:\246w\257\346-\364c\2500ZC@=\322\345\315\177\270\357\007S\177"
+	.ascii	"\017J}\022b\316u_o\340\247\007\275\022\257\315\363\305|x\223"
+	.ascii	"\033\265\373\001\301\366)\244\244\225J\002\303\344\200\205=\337"
+	.ascii	"\301\214\201a\2434\211\365\332Y\035q\350\r\307\245\332\365"
+	.string	"5 K\244\337a\f\220\346\371\016\005\212\005\231;D\240ZU\024\236\231\225\307X\363a\245D\306R\310#&IGf!7\3256\205\322"
+	.ascii	"\177u\003\221y>\035\264\003Jj\251\351^\013\363\036Rc\256\377"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.80.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`;\006\335 "
+	.string	"\206x\304I\240\326Q:\324\243\340(z\222d\034\272\310\200\254h?\261\372#_\275\364\312,a\305\007\3424\036r\376\331\276fv\234a\336a\241)\364\020\256\307S\330\003~\201'G?\026\274\301\355;\212\373\344\202v\263\226l\"wJ\001\245"
+	.string	"\242"
+	.string	"\266"
+	.ascii	"3\344\264\f\235\246\321\351\031\235.\313iJ\247I:\275\344\364"
+	.ascii	"$\247O@FG\f. \"\265\2668\206\251F\232\265\343\303\237\370\235"
+	.ascii	"s~R\373\017r*\323\374t\021]\304\375jUE\212(\036\021h\247?V\200"
+	.ascii	">u J\037\272"
+	.string	"H[ra\003z\345 \253\265\0368\265\001\332)\356=\345)\371\235\362\324Jv\225\023q\324\331\223\220\251\252K\2555\2677\256tr\247\222\177\252\313\004\233\226N\302\370\2228'F\246\233\246\037ys\242\341\345T\237*\232|s\316(\324Z=\203M/nz\333\025l\023\331\345R\023\216\307-\277Z{\004\312\235\355\201R\276y4\335r'\025 \331\227.\325b\032s\344{EV\005\313j\256\202\374\213\215\243\325\356\223\347~;\b\231\362\233_\354\023\271\225\007?\312(\210\210\312\323\271\005\240\204\266\321\253@\320j\3755\360\205|\310\316\217:5o\304|\360\324\037Q\236~\205\302\206\275y\364\314\324\217\031\037\363\252G\224:\301\330D\337\334'\373d]'\373\303\033w\342}\243\323>t\332F\247{\3504\017\235\336\241\323:t:\207N\327\3504\016\235\276\241\3236t\272\206N\323\224\323\001_J\300\276"
+	.string	"<q\240\235\n\bn\031u\326\253ZQ*\260\251%\003\212"
+	.string	"\321y\257\013\357r\221$\326\250\235*!P\030tj\n9\213\263:\273Z@\036\270\255mN\224\332J\200\022\336\366fq\2147\033\004%\334\302\355\207\177r(.\376\200m\315[\253<\3059\271\355\211wP\2437\301 x\023\027o8j\255\017\374%g\202!\203\006\r\345\351mm\302\262\346\025\023\322&\211\tc\315\007k\326\336`C\26353K#\2633{\2461YGd6\bj\210\204\266>\326\213.\2360\226\261\266\202e\2659[{H7\037\244-\356\267Kv\361,\304\254\250Q\035EDFEd\t\336\321\272H\210DQ\322\320.\027\202\267\333\361t"
+	.string	"\222vC{t\304C\"\255"
+	.ascii	"\202\216\001\204\005\013\022\b\345\224\0302\261\326\t\351\220"
+	.ascii	"8\350>\344t\037r!\214\206v9\035\022\211\234\220\315<\021\036"
+	.ascii	"\220rI<\036R\216\206\330;Y\327\311\026\256\030{\3533\271]\270"
+	.ascii	"L1Y\312\256\304\270\342\302\362]R\313}v\177cb`_\001\256\270\214"
+	.ascii	">\353.\246'!\231my\326g\327\bp\206\257\266\266\235m\001\245n"
+	.ascii	"\226gi\025P\312\307\325\263d.\362X\331*\260\343z\023\314O\365"
+	.ascii	"\313\b\373\316\366l\271\305G\345:\273\263\236\300,\276y\374\215"
+	.ascii	"\211I\031\023\273\245\320y1\326js\002\013\200\204\250\201@\246"
+	.ascii	"\0203C%\023\244\240 I1c\300\002\021\241*z\0210-\204nf\024J\262"
+	.ascii	"\307\034\2628\002\254\177\326rh<\327}\013\331-\037\323+U\215"
+	.ascii	"\324\241\344\242sz\036\346\032~R%\260\347\241l\213\bd|#\243\022"
+	.ascii	"\244\330\2229O\376x\311\004\302\rB$\3410\300\340\005\372-]\036"
+	.ascii	"\201\244\265s\371*/)\344\320\354\314\034\263\r\273W3\037\210"
+	.ascii	"\207\027\035\321w\370k\243\t:EE\347\320r\342\315\316\013\022"
+	.ascii	"\367\2349\262%\351N\t[\204]\334`\t\313\275\236^\021\237\323\252"
+	.ascii	"7\374\312\025<T\221r\363\216{\214\273e\017\263\242\241k;\257"
+	.ascii	"\242\272i+?&*!ZS\351N\bK\3104t\377\201\330\004A}\373\001\375"
+	.ascii	"\325xMmi\207\327\317>J'l\364-\365\002\200\203\226\300A\360\t"
+	.ascii	"PnZ\243\312a\271y\242\222\243\344&\236\205QW%'\343\334\300\003"
+	.ascii	"P\354\227^N!}\n\004\325"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.81.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\260\007e*"
+	.string	"\232J0\020Ep\\N:\007\244E`yA\230$\005r\264Y5\325\354\250+OLk\2425`+^\221\274\354\023\306=zE\037\250\332B$\226\304\363Z\232e\256;\237\201\001\220f\024:R\365P\327L\267&\215H\2232\311\363"
+	.string	"\331"
+	.string	"\357"
+	.string	"kjHdG\322\255\240W\2632%0\221\273\242\307\251\017\003\346\247\2658\230u\3435+\263\250\210\335\222J\202\257\243\265\330\005\376\374\265\234\354^\376e\201LtfZA\257\241\3525f\246\245\344\362\262\255w\321J\271\300R/l\276`\245?\203\274&\346\026\030\301\344P\365\222q\006\345C\372\263\t\b\203\335&\214\264\256\245K6d\346j\255\007~\356\205\364\347.S\031\006\314\273\277r,[\317\022c\317Z\207\320Y\253\265\231`\t\244?\207\016"
+	.string	"\375\3117B\177\356\326\356\2347\223\324^\031\226\2572=\265Va#\371\326\177\276\264\207\236\274\346\255}\257\202o\311\344\372\317\311\327\253@\004\207\217\247q`=\234\244\200\211q\217\307\321/%\237a\347\375\230a\357 \246\027/Xk\375\227s\rf\027s\257B\255uy\311\304\361\005~w\221\354\256\223\335\336\206\265\355\017\363\322G\207\234;G\037\203\340_{0\331O{0\271k\276n(w\2731Z\216\246\276\331\203I\246\333wS\277\356\313.\311w\333\223{\001\224\251\337g\235\322J\027\337-\020\354g\307guq\225\351v\233]\334c\273\347\3256\262\373\346\027\252y\237\232\327\351f\337\246g\371\231\232w\t\310\253\004\344Mb\336"
+	.string	")/\322\217\027"
+	.ascii	"\363\0361\257\021\020o\021\220\227\b\310;\364\303+\304\274A\314"
+	.ascii	"\013\364\303\373\303\274@\346\375\001y})o\372\343\355\245\274"
+	.ascii	"h\312{\376xy>\336f^Nyo\340;\350\310l\034\240S\353\215\273>\025"
+	.ascii	"\356d{\362\346o\366\036\243\314\333\375\036\355n\273\300m\361"
+	.ascii	"\263}\230\213y[\217\310\032\340\0306\035c\330\226\324,YS{\232"
+	.ascii	"\021Qz\007\216GH\016\317\017Z\020\264\307\226yN\375&e\234\364"
+	.ascii	"S/u\r\240\006\266\t24\214\366\343\247w7\305\355d\020\220d\356"
+	.ascii	"u4\260\220\222B}\375\323g\231\362-\331s\276\264\363k`_)\244\013"
+	.ascii	"\316\343\254[\326\266m\033\372\363\327PQw\263j\020\366m.\267"
+	.ascii	"a\227\203\007\376\322\003\372\323\327\016\334\260%{,\365\267"
+	.ascii	"\360\316\264\235\232\317|\331%\331\254H\325\364\232\3010\017"
+	.ascii	"\355\247\376\227\035"
+	.string	"\202\237\2156\237Q\332u-\210\247\211\221\326Z\037\354\341\\\210H\233\250@\177\236\355\313\262?\3637\025\373&;\202\004\177I\242oF\211X\222\357\316\265V\256\336\"\332}'do\274\230\317\022q\260\276\004\272;5\344/\273/f\210Ws-\243\205\305\001\365\273\354>\355re\300\366\314%\311\234\033\250/G\211\007h\031\346\366\337\0313.U(\254\252xZ\306\253\336\252\250\254*\344TQ\210e,\026\215\303%dq\252\263\244\204^LI\275 RaY\245TW\306\252\0170\220VC\343\0251\004\361\n\2114\036\253\220JTD\342\n\017TXS\305\242\321\302\360\030\264\013\"\f\035Dh\320@A\024\021\0219\325\241*\213x<A\354\360\342\b\264\303\250\341\261\304\360\204pxB\210e5U\024\016\217Y\302(\2445\256 \036\205H\243\361(\0046\223o#\253\001\013\\\262\273\366\267jg\240\025\237"
+	.string	"V\352]\013\027\370\313\r\256\332\273h\374\200\253K\341\356n\216W\255\311\001I\255\324WJ\t\320I\3754\345\034R\007\350cx\335\007$:"
+	.string	"=\301\215X\225\264\307\366\250\215\332\004\331\333R\037uR]Q\033AuQ\243nJ>S\240\372M\242\206z\033j_\023\365\225P\204z\250{e\312\271$\337\231\370\236\f\251\036\241\366\261\345\t\352\273\271\021\013\200\241\250Q@\346\024B\210hF\222\244\214\244\003\220\002\0311+n\021`\261t\312\302\246\245\003"
+	.string	"\240Nu\022?-%\332\377\351\353\355u\177ol\032\207\020\300\013\323\316\235)\246=z\002\214\022\264\322|\023q\214\221\361\227\325\210\304"
+	.ascii	"\345\023\255/\340\273:7\260\210\177\361\205\300\261?\003\207"
+	.ascii	"\"\023\276N!\241\334CPh7\240@\240'\0235\241\265M\347\301\240"
+	.ascii	"\260\247`\260\347+= \314=\b|k\376\240\217\267Q\020\242^@R\316"
+	.ascii	"\333\250\005mt2\234\027\f\025\350\217\231\320\227\205e\240\220"
+	.ascii	"\2176]$*\346\fD\377m\227\331\244.\274\231y}\330m\035\221\\\306"
+	.ascii	"\335\274$\034A<\2419DK \331R.\334-H\370h4\301\023\320T\363\342"
+	.ascii	"\306\257Y\211\320\336\213\225\226a9\036\337Y\271\353\301\261"
+	.ascii	"\266nL\002$qG2\317La3\317\255\322=\005\257\311,Q\313\3028\034"
+	.ascii	"Hbt\346\004N\312'B\251A\b\023\025\234\200\312\017\314\315+\227"
+	.ascii	"V\225S@t\201\005}R\260\2469Q\270\213\016\t\207\242\032\230\356"
+	.ascii	"\376u\354\026\246\271I\220B\020W\355\247\351 \230M~T"
+	.text
+	.section	.gnu.lto_processRcCommand.82.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\035\025ue"
+	.ascii	"\032\243<$M0L\323\032\003\337>\251\370\0341%d\241\317\024]\337"
+	.ascii	"\362)\300\023\312\323\270)\bP\262|\230}1\200\030\355\250\021"
+	.ascii	"\3145\fn\303\311\276\316\032\200\301\034f\036\3749\277M\030o"
+	.ascii	"\007\233\350t\310\237\231i\"R\247F\200l)eJ)\005:\002\374\001"
+	.ascii	"1\002\324nh\367\226n.\355\343=.\364\240\373072Z\206\207H-x\321"
+	.ascii	"\227,\001\270;h\037\324\355\216\207\310\016\222a@o\230\332\027"
+	.ascii	"(\310\263\022L\206\207\310$%\230\231\312T!\230SH\327\245m\257"
+	.ascii	"\003a\217a\036\362\215\006\201\373KO\273\016\305\006{g\320\367"
+	.ascii	"}\207b\302\b\021\023&\251\0047)\230\247\036R0EqM\334\327\313"
+	.ascii	"\273\266=\211\276S\315:\345)\321z\323q{\351\020n\364\034S\327"
+	.ascii	"\350"
+	.string	"K&\224\004\260\031F\303\005\302f\223+w\227\033\314\303f\327~\353,\035\327r<\\\342\343\202C\370B\t\316\255\201\263G\201\260\331\245\277\216\266\026\267\267\344H*\243\257s\304\223\276\030\302f\201\372\3306\353=\3246\213\354\001gA\007\267(\013a\263\310 %:\\\271\r\325\221\004\213\276?D\270y\201\366\275ot\252Y\216\0226\3532\303\351\350\332\333rm\304\344\372\336\367\255z5\226U\"\342\265\327hsqu\273\302\223S\262\211\t\271\244\224\204tdTt$\032\202\022\n\0022\026\177\210C\237\036a\260e\327w\227\333\205pY\262\231#\003\353\nt\3754\327NR\234!xr\316\2137u\3259\227\305\231\340\032\271b\200[\217$$q\363\346K\253\017\025\314\264\253N\350z\305DJ\224.\203\305\225>\350\2442\275J\201\273\373\240\221\256\364\321\025+nD\347\346EO\372\350v\327\304\211\226"
+	.string	"i\353\241V\2665\324\232tfFHW\235O\326(\022\222\270\371\342BAL\032h\365\300\243\317HW\235LV\342\03515kn\\\211&L!\322U'\222\325\303\220/&4\231#^\\\002\344\254\177\202$\310\364\t\265\2668i@\316\232(\305i\304\207lk\322I\212\263\210\3738\365\004\211D\021\006I\310\365Zg\245\017\352\227\006\204H\007;\315i\346C&\326\036\231P\233\260S\232s\310\267U\247\2235\371\276/\323\331\262^\207da\376+\206=1u\212d<\326\343\217'\315\226k\037#[\272\007I\274\357\313\336$\003\322\034\325\314n\206\231\243\314B7\002O\306\321\n\257\264\034>\341\037\365\340\244eU\366\311\203\317\354\276\271Y\274\233\234l?\370-\006\230B\373=fE\272\277\242\223)BV\366\275\232\234\331\204"
+	.string	"\336M\366\263\320\226x\252\353s\243\320nrDp\342D\223\357\303\257\377t\304"
+	.ascii	"\225\036(\355\244\222\256[\256}\320\362\242~{\3126\355\363\037"
+	.ascii	"\236\235YG\257\377}^\304\232\035sN\217i\2379\262j]wY\227<e"
+	.string	"\034\310i#hb\202m\232\251mK\377\233\256\223J\316v\001-\263\001)\274\233\377M\206\026\366`L\244\363\253Ne\331k{\022\332\337\201\270\023\302\374\016s\253\3515\026p\267\361\n\026,\236\250g\346tv\252:\332\206v\026\2322\317\331\026\264\r\327\357\364\203\002\224\327\303\217\357\245\313C\361\315\245\223J\307\303\3368\332~\024\357g\230gK\017df\005:\017\207\360}\303>p\237i4\013p\2675\313-\030\360n2\3206\333\377A\017N\351\201<4\203w7$S%:\203\346\307\367:\036\346\350\322\377\311\334\275l\343\204\312\257\204\231\353\205\213\2466\267`\261B\005\3219EC\233\th.\315(\032\257yD\3335g5\265YDC\233C4\264\031Doi\306j\235?\020\235\257\334\331j\350\354\241\350\334\301\350\314\241\350\274a\350\\\325:S\271\263\006w\316\320:O\265\316\030\214\316\027\214\316"
+	.ascii	"\030\235\245\212\316\026\212\316QA\316PA\316\025\212\316OEg'"
+	.ascii	" \347\244\321\271\251ufj\235\221E\347% g%\243s\322\320\031\251"
+	.ascii	"u>2:\033\031\235\213\214\316G\2433\221\321y\250\350,\364\343"
+	.ascii	"\034\364\343\f\364\343lt\347\"\321\371g\350L$:\017[g\237\241"
+	.ascii	"\263\260u\016\022\235[wf\211\316k\353\374\356\354C\347\206\001"
+	.ascii	"\205vf\344\251\367l\242\357\217\300<o\032\266\316\255\361\272"
+	.ascii	"\355\272\003O\356\266\020\247\215\b\324+q\325Z\013\357\025\347"
+	.ascii	"\304\302K\261\231)\247\033T_\241\250o\002\365Q\037\030\330.\332"
+	.ascii	"\n\017\365\364\025\326\236\336\202\236Y \207*ddAN\032|\3113\371"
+	.ascii	"NM\237\374f\242a\372\246\3775\310g\372\340\033&\226\2457\233"
+	.ascii	"F~o\200\026Fg\351\323\\5\24354\347\300%\013\342\226\225)\375"
+	.ascii	"\322?U\f\320\312\223\206\270E\332n*}2\354\3012\370\021#I\317"
+	.ascii	"\304&\347\231\244`\005\350\237\334\323:Z\244\357\2648=7\363!"
+	.ascii	":\216\270H\220\264\315\"=2\003i\034\343?\331\303\334O\213gO "
+	.ascii	"N\265\210\037\023\361Go\002\r\212?\372f\257\244\211\370\246v"
+	.ascii	"]\024#\\\212-\276\251\031Z\304\267\370f\236-\245\031\214P5z\r"
+	.ascii	"x\212lS\326\265\276i\362\025\375\361\215>\351\217\211'\364E\257"
+	.ascii	"\004\206\271\367C\177\374\340\031&\224e\020 \023\270O\242o)["
+	.ascii	"\323\235<\025\276\357\013\202=\003\377\341r\340&q\237\317\266"
+	.ascii	"\331\241\267\322\253+\363z?S.\320\224dz\245\246\025\245#\b=\373"
+	.ascii	"\230_\340\252\321p\331\330\202^\350W:b\200@o\374\240o&\226\245"
+	.ascii	"\367p\037n\023\327\211\353\346\272\265\315\002}\217\031\326\033"
+	.ascii	"\277\245#\006(\245\002\275\361(C\354\034-\326\2078\242\326\034"
+	.ascii	"]v\362\316\030\225\341?\331\225\310\201\323\303\342mh T\361\235"
+	.ascii	"'\016\234\340\212\307\372\261\342{9\217\342\027\365\314\372\002"
+	.ascii	"\351"
+	.string	"\030\254'\241t\343\303B\312\231\335)\256\007\336M\026\337A\210\244o\325\227N\027\245U\322\364x\240\"\260\177^\3057S\n\361\177\376\377\252\270\322\301\210\177\305\006\247\224\353\003\244\334i&!$\222\"Y\361\275%G;\374\025\377\177\314\263%\340\360\261\330\314\210\244G\252\257\235.\022I\003\346\177\307<b\323 \036\356<\f\347\277\230}\363}\373\270\375\030\216\320\033\3316\313\336|\3050\200\362\276\357\205\256\303\314p^z\367\276`}\346D\257\230Z\221\275\027\355\275\220\fs@&J\207\260\2269\032\240\320~6dT\240\265n\005c@ #\306\212\243k\306s\f*\0331\276\264hT\325\350\242A\243k+\351\213\206\326\333\230\301U\243\206V\f\0235\272d|i\315\350\222\300\213\353\253\206\214c\f\033\\^0\270\020\250\300\353\207\210;\204\330\272\nae\265\201*\350\253\206\t\0332*(\301\365\245\205"
+	.ascii	"\327\227\326\214\033[3\264Lt%\220\343\001-./%\336\242\332\362"
+	.ascii	"j`\013F\325\026\214\252\0322\264hTmy\331\250\242*\342.\t\270"
+	.ascii	"\274\252\276\272\272\274\252\206Qe\277\022\226\354\365\333S\376"
+	.ascii	"\322\256\302?\317\024\265\231\363\3674\2003\357\240\263\303N"
+	.ascii	"q\352\267\326\275q\343$\325\246x\f\226\304\351E[\252\275\372"
+	.ascii	"\024\317.f\346w9v\370\235\270\372f\343\305\346\2277I\253w\276"
+	.ascii	"\270\023\002p\246\336\361\3272\357\bt\301\274\233V\337Yz\251"
+	.ascii	"lH\231\246\177\316i\017\357\265t\021|\214\2077\322\203\263\303"
+	.ascii	"\364O*\027\023"
+	.string	"\206\303wx\247\303D#\345\251\360\213\203qy\210\271>|\264\315rx\013luq\252\033\036\352s\256\3321\204.\033\336\210\315\2548\315C*\257\304!\211t\325{\311U\275\321\231\352\273\364O\346\200\227\304\365,\023\244\251\036\361c#\236\352M\344\205x\252o6\310\210o\274\365}\337W\211\353\033o\304s\2010\265\253\372\b\f\334\037]f\204\037\023\304G\322?\325\374\235\035\371\226\346\325\210\200\017\361cx\255\300\233]\210G\362\326\321N\231\216\301@\206\n\364\250\250\253\315+\021\210'@\203\026\rS1\32467}F\031\336\204g\311\320H\330\314\332\214\035\260\267\242i\226\206k\257vC\237\364[\324\332\0345x\242~|\307\241\027\337V\374\244PS\235\365c}\327>s\374"
+	.string	"\207\\|\313\265pN\336\031TW\033D\326OM\335\201p\307\303Y\337v\275\205\212\231;D/\276\355\262\376\305\217!.\276\241\030\336\305\263o\304"
+	.string	"\263\036\303'\201a\326Y\"\301\302S\344\332\2255M\276\351\221\013_\205\247PkT"
+	.string	"x\251\277\360,\225y\266\354\200\247\302)"
+	.ascii	"<\226^\235\262\207G\201\"\365Pluw\335B\246E\276\213\310AI3\364"
+	.ascii	"\001\201\311\250q8%\025CB\"\"\"\222$I\2411!\005\304"
+	.string	"\030\346\240\204\346\001\021\0201T\314\315\220$\2054\007R$\377B\363\377\020Pt\335\001\204\3249M\277\323\376}\033_\327\272#\373\335\033m>\027\350\027\365P\215&aP\236e\204-#\266`\335\3132\007=E1\272~\366\355\206w\224ZB5\251@r\363\024\241]\356N\252R\346\343\250J8\364\273\016\005\033<\336\351\360\357\026\235u\032\034z\035Z\242&\252\252\020\326&A\326\373`\266\303\254\025\020\305\362%0\235*!d\235\312\026Y\242k:\376\013\245{^2V\343m/(\r\324\233\334\227Fiet\304\326\331ix\202\243K\357\203\252\247\216)\212\223\231s\220\3106h\n\035<kHL\303\360\354\336_*3\021g\313\240\230-a\354$\021\225\266\227c\233\357\322~\300\373'\241\rJ(A\254\223@A\322AG\265\002\023q\307D\273\331\344%\211\021J\302\337\r\031m(Hj(\"\207"
+	.string	"\320l\300\3628:qv\002\216\017\262\r\007tZ\364N\335\2142\006\304\034\031D\202n7\256u\r\352:\r\304\201b\007Zl\356\355\260\001.D\305\316\275\327\316\003\355\276\261\003h[\357\023\354f\004\232\303Z\336S&\r3\337\2271\320\273_r\0045\266\260<\244$\325\005\374\340}\302\304\317\f\344\312\223\362\247\030\262\013\002\363l\351N\256\350Ai\363\005\323\247H\247\3779\b\304p\313\217-\234\\'\246E\005*\236\216c\221t\232q\225\031\375\263\234\360\240\310\034H\017\237\334C\332D\367\263A\277v\341\207\320\001\230\"&4\234\360\350\210\023\354\364\353!\312\025\373\317\350\324"
+	.string	"\021l[l\f/\022\"TO0\033\202\260\212\177\021+.\030\202\n;}\023`\021\270\320\372\242\314[\257*\357\242\023>\310\245\261\320\310\232\206\244;d\033\323\204\037\314\027\314\355\325>\247wss\317g6 wQae\177\020\312\004\376\316\320\313\2602c\241#\027\003\244T\3255o\3032O\331\254}n$\034,\366mb(\340\230\254\355d+'\342\305\257\365\224%\020\360\f;\327\346G\345\247\207X\037\251A}J\037m\357E\210\272]\026YY9\215|\244nvT\0130\331\231\024\344M2t\356(\270s\345\231g2\335O\362\200\256U\332\323\220A\3076\275\002\257\245\312\341"
+	.string	"\260\250q\242\024\223!C7bA\031@\331?\336\t\001\222\237[*\352\247\253\205\271\271\217\233\375\034\021\364\226*7\333\f\032\266\327\305y\3602\244\027.\316\276~T\276<\255Cm"
+	.string	"\371\302FD\252"
+	.string	""
+	.string	"\304uM~\337\361\b\201s\260\256l\321\377\237\341\024J\223\001\241\241\311&\222\312-\253\326\340Z\232gjE\226\024\324\206\t\017\006\024\3353y\301\276\022\252VjDk\036\375\033K`|{3\223\177jv\033\276\224\326=\371\035"
+	.ascii	"\211\337\b\347\306tY\252\023}\327\013\255$f\035A\214\253~\222"
+	.ascii	"\210v\3642\227&\237\200\276\203\301\312\201\316;^\366\r\200\367"
+	.ascii	"\217w\221s\224\003PV~\313\340&\026X&\257\373d \016\277@\347\344"
+	.ascii	"Jt\313y<4\035\335\023\201\004g0s\217\354r\r\342\002\266\3562"
+	.ascii	"IcGT\275\207\212\205Q*B\337\364B\315\233\267{\367\214/W \\Z\300"
+	.ascii	"\365\202\005\373\311\224\005\243\301E\037\246\357r{\231T\241"
+	.ascii	"\307\037"
+	.text
+	.section	.gnu.lto_updateRcCommands.83.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\345\031\265w"
+	.string	"\312\303\230*J \322\322\031\016\036\276\030\302\360\022E\267\234\316\207\224y\371\327:\024\361\356J\317\303\243\230m\220>q\231<Bp)\253.\236\352\370<G\n\261\302\225\256\016\346\315\002.\234\217A\206\275\020a\266\330\261d\024iko\"e\222\001\222\002b\002\240\002\274\311#\257\324\2217*\345\205B\362>\245\274NF\336\246#/S\312\273d\344\0251\304\253\224\362&\245\274H)\357Q\2217D\312k\244\362\026\035y\211\216\274\310\224w\310\310{Ly\215)o1\345\025Jy\325\2247\310\310KLy\323\"\357P\210\267S^Vy\3774\2454:8\374\326uJa\020\353\2344\372\345w\277\337O\347\257\363\333\371\371\3767\177\233\177\356\247{q\367OP\346\374\3578<\2075>=\355"
+	.string	"2A\204:A`\311B'\2032(\204pg\352\323'/~\031\250bfJeo\201.\326\247o\215NA\360)\351!\354\316\325\376\315\036\316\032\235"
+	.ascii	"ix\353\"\350\324\346j\3358\361\265\331=4)|}o\327\270\033\244"
+	.ascii	"\371\232\337\320{|\320\213\246\351E\233\352t\251\311\033\361"
+	.ascii	"DM\236R]\005\352r*\210\253\224\217\267\301m\330\275!\335z\026"
+	.ascii	"BK g\234\237\033j\r\033\354\032\177\267G\263\306]vp\031\366g"
+	.ascii	"\202Z\340c|jf\270\336\255C.wj\244\372\\\235of\016\204\233\251"
+	.ascii	"\321:9\024O\367v\035\030\237&\233W\273\237\241\203\327}\220\034"
+	.ascii	"\243[\317\200\250\315\031\343\207\206\3724=\231\227Y\243\023"
+	.ascii	"\031:\020\222cE\353\330[\024\270\030\352S\247\032\256>\3461,"
+	.ascii	"?\007\202*f\246\236y\203#\270\256+\326\323\255R\237&\237D|:\374"
+	.ascii	"\021\361\351.w{8\235\333z4O2;?\353\272n5\n\333\037\322}\235x"
+	.ascii	"y\253\022UT$FL%\245\242\240\236\234\232\230\226D(%!\035\2050"
+	.ascii	"*\"B\016\035\215E!5\210\230\016\233\227\373 \032B\3173\261[\345"
+	.ascii	"\275D^\032\256\302;U\334\237\231\rL\"\316\254\006\0361<!\270"
+	.ascii	"\006\210\377\231\341\r\223\246xy\322\300S\311\273K\rO\220\031"
+	.ascii	"&\355\335q\024\232C\315\225\211\201\237\206Ec\206)\334`a\247"
+	.ascii	"\023\250\210y\223\334\231\344\302\360\222\210/W\362\362\205\223"
+	.ascii	"\272\034\251\013\027>\202\341!R\270Q\nqfo\\4D\302\3715\377g\246"
+	.ascii	"\302\020\200\2746B7&*\341H\2668\263\022x\350\317\254\2045>\032"
+	.ascii	"Ixq\330\304\306\227\366?3\265a\025\035-<\034\316\247\342\314"
+	.ascii	"F`!u*(\210F\026*WN$srz\246\230\017\213gio\344\231\223ar]\327"
+	.ascii	"\2279\227\2355\231\203h\254\353\272\374<\243\3625\361]\006\263"
+	.ascii	"\273n\273\"\232\004\215\364\247N\316Q\0335R\247vN\270f\037-c"
+	.ascii	"`'K2\352\272\216\265Xn\362X\0015n\334 >\r\321-\336\346\212\332"
+	.ascii	"H\t\207\305x-j*\300(\2348\275\256\253\230PC\367hl\202\210\364"
+	.ascii	"\337\320\346\210\\\275\243\313v\211:\320\320\356\231\207\311"
+	.ascii	"\205Zv\220\201\216\200\302\302=\310&\352;\343v4\262\207\204N"
+	.ascii	"A&\027\222\331\3214\230*\221!\"\315=\324\007tl\026b\202\270\372"
+	.ascii	"tO\032\373?\234\253\271\330Bm\354\253=\247\034\221\232b\237\330"
+	.ascii	"s\302\251\035\324B\315\204\347\214kr\241\332N\201N\270&\027."
+	.ascii	"\261\203\272\367\020\270\237\034\304\236\0018\207\214\276\220"
+	.ascii	"\\\327\225\330\320%\312{\020\342;\254\256\357e\376\020\242`\322"
+	.ascii	"\206.7\326\357\346\352`\025/*\326Ut\331~\330\320\274/\217\255"
+	.ascii	"+\223\304^\317\367l\236\002\233\206\377\3344\304\247Tn~\216\321"
+	.ascii	"\025p\370\356\021Ow\031mL\006\264\307h\tK\267\256k7t\323\346"
+	.ascii	"&R\3077\306\177v\330)\003\027\324\321b\357\003\007;T._-4w\036"
+	.ascii	"\036\370\265\347\262=~\374 "
+	.string	">\355n\001x\345\315}\262@L.\324:\236 \352\272\256/\366w\016(d\317\345\351F \001\377)\001\361\351\233\b0\312\344\302\rA\002G\325\376V\006\264K\327\344\206\356\376ko\331=\332\331\024)Q\312\376\204\362\204,\345\275\263\210\367NT\336\2175\221\274g\336\357\273<\235\257\362u\276Mn\347\353A\312\253\301\371\276L~\367\005C\222\362~\035Qy1(\342\275 \345\365Jy\273\212\274E\270N\367%\222\362N\220\362B\220\362\nIy\037@\362\006Iy\201|\356\373\303\307\337|{\3608\335w\307\221\327\201#\257\216#o\003G^\006\216\274\013\034y\0258\362&\220\362\346Pyq\024\361\"P\304{\200\312{\243\210\327\206\312[C\3455\240\310K\343\310K@\312;#\345\225\241\362\016\220\362\306Py\005(\342\205\221\362\276(\362\272Hy[\250\274,\216\274+\216\274\001\274\315W\005\222\027"
+	.string	"$o\n$\357\326\221W\213\210\027\005\021oV\312\213E\304{\202\210\367*\3455\221\362Z\251\274%R\336\252\"/U\312KB\345\035\201\344\235:\006\030t\324[\224\315\020\376\201\365\357\236d\376\360\037\r\326\334w4/\232\031\374[\317\\\305\341\205\266A=f\236d\376X\203\033\314\363\243?7\325\320\335\341\202\324\004\375\275\013\265\2551\313\341KTUkp\004E\037\351\007f\365\211F\321A\201N9\254\316\352\177\360X\275\024h\202x\325'\232\310\307\031g\242\257\252Z\2036\321\315\307\t\267F\203\335\343\375e\256\022\252\t\016\n2\223V=\301\320\263\312\t6\2764\251\206\256UW5\221:9{/\322p\366w\303_\345L\020!\330\321\2632\240\353U\365\325X\365\361^\242\255V\200+A\325U}\3025\366\322\205\252["
+	.ascii	"\316\221\211B\302\301\025!\215\244\037\350dk\212\021\322\237"
+	.ascii	"K\301\355I&\243\360)o\207\240\2054\021\b\022\rA/;\367\f^/\032"
+	.ascii	"tGM\036\221^\2309$\372\006\232\347\210&\321'\344\023\240#Z\n"
+	.ascii	"0\312\324\013\363\267B5t\247\232H]\nN\256_\232@\334]jYB\371\317"
+	.ascii	"\251\016\240m\254\305\366\310\205\242\036\230\247\206^\341i:"
+	.ascii	"Z\357p\250\242yt\031\212\363\350\032C@Yx\364\333\374\037:\265"
+	.ascii	"\311:\217>Z\337\311\326t\363\243@e\217\233\222&\264u\240T'\273"
+	.ascii	"\t\235y\3306O]\223\352,\300\250\336\032SC\303\352\370\216zjK"
+	.ascii	"JZ\027\202\223\224\365\007\242\030\013\253\215\300\337=\250\216"
+	.ascii	"z\240}4T_\004\033\374\206\"\032\312J\275e\217E\204\243@H\177"
+	.ascii	"\266\217.c\262?5\273\200\002[Y\276\211\360\3242\336\346\364\254"
+	.ascii	"\370Hz:=\013\261\250\254AArjj'\0258\r\255\211p\331l\221\243r"
+	.ascii	"d\345\204\"\254\037\214\025)F\237\322=\272l\227\251\3176O\204"
+	.ascii	"\033Oa\263e\227/\313\025Vx\346\351\321L\335\201NA)\321\301\036"
+	.ascii	"\3757!\032:\245\377f\251\201\364\2474\007\"E\177H\013\374\353"
+	.ascii	"c\324\320\005\322K\375,u|\"z\211\005\216\262\004S\306!,_X\206"
+	.ascii	"Y\212Y\212!>\025\321Y~\374\026\307\316\207\242\206n\007x\206"
+	.ascii	"\220\372hx\216\275'*L\0259\310;\033H\227\361\213\020\225:\254"
+	.ascii	"\016\017\217V\352\003\322\177\363\036G\242;\373N\270M\303\227"
+	.ascii	"6\006\031%\227~\310xf\367\300S|\263\203p\021\2034\325\237:<c"
+	.ascii	"\374gxd\347\223\372\314\276\342C&"
+	.ascii	"g\324G\235\324PvN\2705\030\334\374\030\033\252\007\251\337\354"
+	.ascii	"\223\3115\271\360\377;\323\346I\261\241\213u\244F\214x\331\250"
+	.ascii	"`H\230\0220"
+	.string	"\256 #F\274l \361R\022\204\243\206\217\034\016PP\001\222!__`5\270\302\210\302\212\034\031\302\325\243\310\221%K\300\302\272\226 \225xq0d\330e\201W\327p\003\260#\275]ZJ\272\226\f\371\332B\002\366\365\005\306\325\264\344kH\253H\362\265d\230\004,,\311pU\300\340b\001c\305\212\024ZFI\276\226\364riq\205Q\300ed\213\313\310\026\022\257!_[\\aJ\266\264\224\026,I\221\260\255%``a[F:\346{\213\312\246\312\034f7\255\032\332;\340as\346@\337\331\274$\035\360\236ytt\003\355@\023\003\235p\t\264\216fZ\240\033\350\264\317\031\327,\\\366\375\030h\005z\311\246\354\005\232\201n\262\223\305v6O\305a\201~\032\300&\235@+\300\177\233\247\322I\240W\274E\t\225}:q\224\200\232\364\353\354`\017\374\224t\370\317&\275l;\352\rz\320\267\323"
+	.string	"\347\260\243\324\201\377\364\240\2238:G7!Y \004\032\307\001m\243\021\270\321\007\304a\276 \200\312\035v >\275\321BWj\264\215\342\231\210\006t\215f\352\013d7A>\203\333*}\3406\312\037\006\270\363ty\217\331(\365(\371(\373\364!>5\240?\303\333\\\016}JX\021\213\364\337\322\335\212H\243\213\3642\331\225&\253\3415:\224\203J@J@\304\2474\032\352\355\n\223\013\371\374\255U\004t\232\315Kr\303\233\321\004\310\350\027=\203m\200\226Q"
+	.ascii	"\307h&\275\253,\\\212\361\237\003\b\3201\232\330G\026\bF\013"
+	.ascii	"\340\202\002\"\214n\332s\321/\320\334\271\350,\3009\246\037\223"
+	.ascii	">\337\f\346\267\267\350\335\245\223%\031\377\311\244\223NZlY"
+	.ascii	"t\213\025\315\242\207{N9L.\374\203\024@\257\350%<'\\s\206\315"
+	.ascii	"S\353\002h\027o\321\276?\004\275\276\241\rv\272P\001\320\307"
+	.ascii	",1xwY\266\214\302\177\002\320D,m\315\026\343!?j\201$R\364\201"
+	.ascii	"\250{\301P_\236\241-\253\360\237)\232\n-\316\234\261\026\373"
+	.ascii	"\2105g\362H3Q\223\003\205\244\177t\331\026k\371\026\353\305\321"
+	.ascii	"\352\0306\217h\314\307Z\253\033\317)xg\346\201kp\203\202d\375"
+	.ascii	"1'}A\237,J\337I\017\373.\245\037\245\243\354\234r\315'\335\325"
+	.ascii	"\227\322Av\316\270&\224'\335\304\307\tw(\reG\026\250l\013\313"
+	.ascii	"\205\371Y\037\0170z\260\376\352&<\257\376\321]\235\3569\331\226"
+	.ascii	"$\200\265W\023\361\234q\030\364\005\277\333U\266\261\013A\324"
+	.ascii	"\026\030\314\322\n\226\245\232\032\361i\2021\250\322\b%\221\242"
+	.ascii	"\2149\245FdD\222$Ic\222\n\020\212\202i\"\327\324\003\022@e9I"
+	.ascii	"[e\244I\223\016\310,\332<\277\035\240Gr\353\207\020\220Q\266"
+	.ascii	"\030Ul\350\035!\222\304\\\374\214\212\327\354\020\262\03521\017"
+	.ascii	"~\302C"
+	.string	"d\343\343\3526cw0W\016\231=U\310\226i6\036i\036\032\204\335U\337\343\341\323\300\213 \262\225\231?Sp\310\317\306M\345A\n%\315D1\003\241K$4\317\301!\206\310?\n \277a?\304\340!\317\030\204\022v\276\ni\206\360vs\n\247\374)\362\263RFLg\246}pm@!\351\245\034\325M\306R\326&>2\243L+*\251s\367>\300w\201Ai\256\304.}IF\317C\b4\360f\320\240\217\240\364!\036S\016\236f\304\004\020\214O\326c\240}e\2448\234&\234\250}\345\236g\242\306>\035\3106]a\3124\327o\n\333ki\225<\317\243(\226J\227\247Hr\325\3325\024\315\236w\342\22247\302\231\261'\243I\033\247\3210\3504c^\r\306\307\371g1LaH\246P\212;\341c*\312I#\346&\315~T\305\002\264\301rz\205\005I\017\306\273=\254DRF\332"
+	.string	"\353\te\224nrd#H\2723pv\307\203\345F\313\"ptt\377\203\341\324\216\220\027O\356!\270Q\177\304\306\007\306\276\2435\0259\243\373\372iM\374\373\355\220gG\377m\346\255\371\340\232@\005v=\250h\233\020\315\327(}\354\265\f\236F"
+	.ascii	"]d\255\026\030\376\335Tk\211\304!\255J\270\226.\030\362o\356"
+	.ascii	"\271\313q9\024\304\353\367\347a\222\202\273\276$3\031\376\334"
+	.ascii	"\b\321\200\026\003;cJ\202\030Q\222\313TP\271k\303\te\266\350"
+	.ascii	"\237\274d\350^NJ\311\3571\360;\367\202q^\0262.E\326\032\025\226"
+	.ascii	"E\335\221\326\254\r\020\243n\331z\317"
+	.string	"\027\356\241\250\034\343\244\314\361\3364\n{\231\242\361\212r\215Lv\272\237g\0234d\275x\013\255\365\332\206\n\340\332Co\275;\372\3317mq\024\325\031s\340\021\\KV\025\255Vn\222,\216\240~%\036\376f\277\020+l\370\33190\374\222\226\001b\360s\362\274=\243\347`Wx\272\217RgyO\377\201\026pRz\205Bx\350!\307\245\006\330\245\322L_\223\271\032\230\0021\315\220\315b\212qb\262\031_,\3448k\244[ba\352N\264l\340b\036\005\004\371\257\201\202SI\231\304\321\256\352,\265E'\304\253\315\\Ez\023\357\216P\363.\203\324{Y\221\265p7]&\267\260W\t\267\346?\205=\260F\f\030\350NL\220\255 \341|\347\205(\t\3131{\270.\332S\275?\277\320\037\324\026\223\306\004%\212v\340\362\003d%t\344&.\035\245R#\222)\270\321e\351X@\237D\271\204"
+	.string	"\305\326\236\306\357\246K\260\330x\\\366z#\"\212\376\351\030\321\352\027D<#\004\342%\016\200\263\314\272.\202\370\033\213\2560\201\006\020lD\237G\016H\214\"\323\203\372\3732a\332\237\226\207\353\262=iT\305\225\260\223\223\230\231]\366\272\254\342n\351\215\240`\263[\327\305-V\035\362\3628\214"
+	.string	"\3762fY\304u$\347\216\310\372SIo`E\334\235~\225\345\002\246\206\027\210\264 F\032G\316\276\347\0367v$\2233$\306\201\020\271M\240`L\330u\234+\030\017!\003,\334\362\322\344OMzg/\275X\227\351\355h\214\004\024\352\352\235X\303 k\217\261\321\2237\372,\007\371\243\220\230M\004\231vJ"
+	.string	"\270\240"
+	.ascii	"H\374\235^P\320'\312\215\017\2078\353\\,\364\002\320\033\203"
+	.ascii	"C\004%H\310y\204'\200/\350tx\205#\031\030l\n\311\005\357g\006"
+	.ascii	"4\032\354\200\330\315\207\362\0355\001_]@\363\025\207\f\306\370"
+	.ascii	"\237:o\314#'\320\302h\224h\322I\021\007\r\207\201ZNq'\357\263"
+	.ascii	"\205\316\224\343\373\035\225\277\350\345\275\326K\266`\"\035"
+	.ascii	"X\020\210\213\346\232\220r\207.\022B\241\354!Xi\371>\367ylv6"
+	.ascii	"T\234\026"
+	.text
+	.section	.gnu.lto_resetYawAxis.84.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\325\007"
+	.string	"b\21646Po\322\001\200\374\311#bU\252\316\324\3157\316\331+\300\311\037\247a~4\024\266\206\362\230\037\331\002\233\025\217LF\0251\307\330\177\316\233\352\363\022\336\222M\266L)\226\0339\023$'JNt`Ph\210rv\342&c\354aaF\b\f\233\361\342\366\325>\222\0214L\241GQr'p\0329I'\302\343\261\016\007N\031\235m\325\200\234s\027\260\355\256\201\037r\021\t\277\343\320\023\037\275v\350\177\254C\275Q\254\303\314\206\ni\312\232\202\241\262\352bs }\033\366\253}$\273*\020}\305dW\224zY\023<\361\260\375\313\231\335rn\333\227XT\224P\273\033\037\307\263k\346\377\343"
+	.string	"\332\bt\305\034\354\256U\033]\334\357\2665\266\tl\263\004\017"
+	.string	"2\241\343/0.0@j\200\t\f\034\204\\\220/\022SZ\r\001\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_rcCommandInterp.6.94.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\264\002D"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\003\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\004"
+	.string	";3"
+	.ascii	"\343\222)+\006\340"
+	.text
+	.section	.gnu.lto_rcStepSize.5.95.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\264\002D"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\003\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\004"
+	.string	";3"
+	.ascii	"\343\222)+\006\340"
+	.text
+	.section	.gnu.lto_.symbol_nodes.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\242\003m\021"
+	.string	"&[hH\300XM:`\304\361G6i\203e\234\\\n\377\330~\270FB4  '\232\020F\242\t\274\311\263 \237\324\320\272m61EQD\270V"
+	.string	"\256\025\200m\315\337\326\326\326\266\251p@\022\272\357\206\300\365\266\306M$\221)O"
+	.string	"W"
+	.string	"X"
+	.string	"}%\020\372I<\\%\362\240\017\344\340N\263\301w\f\316\264\340K5\375&\336\355J\266'\325\316\205\326w\342\315N\312\256%v,\260\037\231\374\257X_7\022\276J\002\327\215\346\177\232\212\303\325!\177\377B7\366\253\265\326V\177\310\373\377\351\004\367r\242\217\264\265\326\237\025e\242\337eK|\036\207\204\315\034\321\177\342\211\370\230\020\027\003\342d\346\207?\315\365\320/\362:\274\344\360+\033nE\303\2172\\71\\\312\205C\231KC)gd\241OT\241/D\341AS\001\217\016jB\237\211\204#\231\021\372Kl\002\224\021\220k\340L\215\241\031\345\002=v@\356GN\2122\001\221F9"
+	.string	"\271\241\317\223\217\030e\325\030\256\030"
+	.string	"\271k\206G\024\320k\305\254\2225.N+\305\252\321\225b\031\375/1\372``\364\303\274\350C\271\350Oi\321\247\302\242\237eE?\212\212\376\226\024\375&\024\035_\2461\004y\227\310\027\310\233T\326@^\037\033\310\3333\356\027\204\224\273\221+\240\314\216]\r\310\033D\\\227\316Q\016\f\344\005rC\356\202\274E~\366#\3325\255(o\217\270\007r\350\320\301(/\317\317\362N\021\016\033\247|\023\243<\243\\\336q\022\"\013H\250A\f\001\t;\nR\222\202T\252\003\340\002\251\241\332\001\021\2408I\221HD\301\304\214\004z8,\37194P"
+	.string	"Xb\213\321\232\371;\276{\371\3264\001\230\361\027\234\"9\312\221\034-\375\212\261\345\007\260\031\214\363\241# \027O\200\345!o\022RG\245\261J\376"
+	.ascii	"\250\212\016\233\253$\034t\3350j\177\221\360z\265\2022q\020\273"
+	.ascii	"\212\311a\360\333\2009\021\361\311J-\336Pe/<G\255\376g\013\345"
+	.ascii	"Eu\355Q\003"
+	.text
+	.section	.gnu.lto_.refs.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\025\013"
+	.string	"\306\031J;0\217\222a\f,~h\034Xu;Z\224\227\3531\355lQ8\265\205\201<\236:\030\030\030\030\030\030 \322\322~#\233!\324\376G5_\375\023k\264\337\300oi\225\264\375\266e\n7"
+	.string	"8"
+	.string	"="
+	.string	"w:\313\351\330M\307\032*\007\307\026\316+\033\037\23060-\312\306\232L+\232.Y\1778W\234"
+	.string	"\246cH\233\205\n\3159l\026\215U\311l\312\332co6\347\275\b\324+\237S\250G\237C\237\355x\336P\t\214N\325\232\252\310\312R\255\264!\353\0029`\227F\001\2732\003\354\222~l\213\264*\322\222x\034\352\374\221\026\221\016\361\330\017*%\240\303\340\331Y y\025\2507A\202\364\"lv\020@\357\201\3461X\340y\nf\254-#\264cF\016\303E\013\020\350+L\224 \001bd\177\b\335\303\372\013h\273\0248\201g\004\001kH\273\326P\326\24181\002f\275\016'\357\305\344m y\031.PXk\347\240z\r\252\313\210\241\236Bt\030\021\353!\226\313\350\032\326\266\214ND\217@\226\003d5;#\032\026"
+	.string	"(!A\305\215\022,\0237\306\300"
+	.ascii	"/j+\246\035\261#\023\001\025\374af\336\226`\250(\234\020\013"
+	.ascii	"U\334V`\262\tE\005\323\232\220\233\270\311\352\013)\020\250'"
+	.text
+	.section	.gnu.lto_.decls.881d92c916c245b9,"e",@progbits
+	.string	"(\265/\375`;7-\367"
+	.string	"\232\201\355UU \na:\215\001\245\300u\004\210O\271\344\352}\353\f\0078a\246\313&\246J.\252o\313\364Af{\324\231\\<?\301\350l^J\203\263\321\274\032D\302\201Vu\321\272\024\245X\207\313AK\241\336\202\223\346\212F\354\370\360\006\352\214\356\317`\241F\244\2242\005\253\004M\005\222\005\027\312s\225)4/>\2220e\250=\307n\327u\202\233\314\020\236|<\357\230\225s\235\260\030\225V{\n\363\274\262f\270\311\f\232qIyV\371\201$H\021/6\254\233\217\022hC=aaZ\260;v\251\254\033n\262i\031W\316\236R7\322\230w\307\330\345\261D\204\220\b`\2269 a\035\344\374\226\005\230\245\177\235\\!\267\311\006\270\334<\265\335\314\324\231\222f\213\224\233\017\334\241\277A\221\033\314\253\3442\271I\254\363.\271Gn\303\220"
+	.string	"\355\2473S\032\334%\327\2105\363qj\356)#6;9_B\"D\350\310u\231\301\323\371?9\372\277<\375\237\033\375\337\235\276C\214~\211\360@]\245-\271Y\247\215\266\023\374\304\350\377\324\364\177W\364\177^\372?-\375\337\f\375<G?\327\351\3470\372\271L\203\330\313P\364s\227~\276\322\317[\037\317\351c6}LE\037\027\321\307W\372_\260R\377\272\321\030<\341\364o\233\376-\323\277M4\006\027\210&a5"
+	.string	"\357\346)\223\345\314\215\233\177ih;\307\256`\235\266\317\256=\217-7\331\336M\013X\251c\314Z\b\240\r\001\274\345\323\331b\300"
+	.string	"g\317\005\026\226\225==\273\334\373\314\007\207\363\253\307\315\366\215\315\263\316\016V\005\213W\344\251\312\215\006\301\336\266\003\320\366\365\331\016n:Di\0132\004\357.hE\212G\324\315w\207\272e\356\262\366\236v@\031A\310\312\334|\333\306\326}\355.\367\316\242g\344\315\211s\263\335\030\2006\315\350\226M\002\220\b\231\262F\202\237\246\016)!j\322\364$\301\321F\356\346\337\246\261t8\312\306\262\031t\241\360A\221\272yN\bgQ!J\2202\372\026K\2335\263oX\t\230R\345Y\305\306\331/\326\315\276\025\361"
+	.string	",\355\271w\023\2155c\341\354\031\373f\345l\031;\306\222\261N\033g\273\334\246`\275\3746\367\206B\373\215\342l\026\253\246\fc\356\275o\301\316\316\232bhklVl\030\n`\032p\261f>x\357\254)\314\275\233\337\3407\3723\330\300\306\331-\326\354\303\323\336Y@|\340\346\324\250\262\267wS\204\b!\021A\272.hg\031\262\005c\303X\247\005V\314\255\025\033\366\237\262\271\233\027\311\034\264+7\337v\351[\013\200\270\257\317Z"
+	.string	"\274\325\241\377f5"
+	.string	"{\254R\337\004}\244>\222\276P\277\002\032\304\255\2264\213\305\232m`o\250\2757\007\225\t\217\262\233\255\025\243[-\277\245b\3010"
+	.string	"\251\260\232\373l\357\375\203\331R\210!\347\346\247\320BV\003\020[\f\300\020 h;f\257X\247\004\266\354\031lp\3544\266\301\366n\376XXA\312\n|7\177\001\272g\350'\373\005\270\275\301-\350[\t\200\266\317J"
+	.string	"\374\325?\263\032\200@V\003\360\262Y\r\3007\255\006\240\266\030\200\303\333?g\340\301?\177\340*%\t\373m\331o\233H\326#\377}a\304\003v\312\236\360\337\"\277\365rB\344\267;\314\304\251p\205\\u\202\0219\375m\234\313\265\342n\3311W\353.\203\334, \377=\372\361[\253\337\302\370\255\335\365\361\337\264\307\177y\374w\004,\033\031\260\340!\374\271\304\177?\330\361\333\003\330\t\\\024:N\200\233\343\277S\377\2252sE\260ak\374\267\306\245\361\r?\326\2633\376\303\375\327\022\347\366\377\355\377\230\377d\036\245<\210\037Wa\261w\376\254\200\227\371\217F\350\037n\b\312\016\364g\243\343?\027@N"
+	.string	"q?"
+	.ascii	"\370\177\340\237#\370\257\007\376k\302\177\231\376{\374/\007"
+	.ascii	"\376\213\364\337\342\1771\360_\026\377M\361\337\b\374\327\001"
+	.ascii	"\377\005\341\277\f\370\257\007\377]\300\177\023\360\337\016\376"
+	.ascii	"K\342\277\034\374w\304\1773\370/\006\3775\300\177E\374\327\202"
+	.ascii	"\377\016\340\277\001\370/\210\377N\360_\017\377\025\372\357\206"
+	.ascii	"\377f\370o\320\177\177\376k\341\277:\377\375\375\327\376v\316"
+	.ascii	"o\371~\273\367\333\274\337\342\375\226\315o\325\374\226\356\267"
+	.ascii	"r\277\215\373-\334o\337~K\346\267_~\233\302o\271\374v\313o\215"
+	.ascii	"\374V\353\267@\376\317\375v\204\377u\277-\361_\205\377z\377#"
+	.ascii	"\360\377\371\333\266\337\252\375V\375-\026\263\337~\375\366\310"
+	.ascii	"o\205\374\226\353\267Y\277\305\372-\006\376\257\370\255\212\337"
+	.ascii	"\262\370\355\212\377{\377\361\376\337\375\267\373/\302\177\272"
+	.ascii	"\377j\376\247\371/\374/\346\377O___\337\017\304\372y\356\376"
+	.ascii	"\001l\005XC\260h!1C\307l\330\004\265X\260\242o\222\241c5j\354"
+	.ascii	"^\376Am!J\230;V\302\274h\371\322\367k\350\230\316\211\351\254"
+	.ascii	"Yv\032\333S;0\314\250\221\323\003G\fN\232\233o\341J\013\335\r"
+	.ascii	"\035\313\311\331;\033\264\267\222\216\315\002\224\026\222\033"
+	.ascii	":\216\263N\034g\357\204\232\333\351\247\r\025\325\005\357\321"
+	.ascii	"\323>0\206\216\341\254\023\303Y;\017\316\226\312&$\236\334a]"
+	.ascii	"\300S7cNI"
+	.string	"\033\335\3236t\374\346\304o6\215\007Xc\333\312\204/5\336\354\355\375\345\002 \230\227+O[\364\004|C8\f\026s\354\346\304n\230\214\225\"vfoocQ\205\370\361\230c2\257\353\331\373\303\345S!\r\312\315\317{\227\377:9G\033\22517\277g\210\376\375\201[I\265\367\266\37257\325S\017\320\376\254\r\361[\260\330\006\340\177\336\373$4\320\334ON\2577\372\311\232\322\307\315\373\2777\252(\262-'\017\266\252\240\266vD\221mm'\250%NAT{\313)\212l\357\240\r\005\345tb\271\203\242\310v\325\206\001Wews\313iC-w\320\206\332J\020QP[UQd\312\252\240(\262\255\252M\266\265\2016\224\222j\006\324\246\n\332d[w\233lY\005\024E\266\254\212\"\333\372\262R3\340\300p\220y\021\211\262UQP\373\206\324\017%\025\320[Ts\271\351\366\266g16U"
+	.ascii	"\366\376\261\244\242S\356\260lOo7"
+	.string	"\236\262(\227\266)\365\304\265\334PoQ^\313\275\275\236\222\266\324\b\247\346\3336b\337\234\204\374\3306b\354\355Ajo'\273\337\366\336N{\357 \325\217\346\336=\200\242\230RR{c\tI\355\037Nm1\366\276gj\330\252\242\310\270\226Fmed\314-\243\351d\243l,7s\323mQi2'\261m\303\215fV\341\300\273\031\177\351\260\263\206\005\253j\215N\301\302\236V\026\227/\272\331\334\273\371\303\303\226\205vu3\336\30235F\346N\213f\303m%\340\035\t3\306\206\325t\226=\256(\247`-\030\r\247Y\347\273`,F\2748\031q\242\233\202\357rV\226\306t\243v3\025,\266\227\254=\315\260\323:q\031.\303W0\231}+\222\247\240=;\210\310i{\\a\200\230,h\305E\f\205\233\317\263D\337\206U\321\322\304c8\314:\261\330\217\247\\\250_0\253\347\363\333{\251\306\324"
+	.ascii	"\213a+V\317G\331\334T;F\304\246\204\331\333{\253V\272\370t>\017"
+	.ascii	"\225>\017\r}\236\030\372;}\032(\345\213\307I\005\t\232\233\243"
+	.string	"\340\023\260\027\206\202\237X'\376\302M\216\235X\264\333\265$x\253\002(f\242\\\355aQrF\t\023$\314%g\222|a&\024\255(WBi'\314i\365\344\337\316\232\376N\231\376\216\024\375\035\"\372;V\372:s\220\034i.\245\314\271\371\370\310\217\213`#\026F\235T\234\233\357\322j"
+	.string	"V0\304\350\230\210O\225\024g\332\315A]!,\300\221{\372\022\262E%\005\256\263\233\361\326\305Z\230\353x\013/{\240\360V\336[i-\005>\326R\360\353\242Dy\005\230\257\243\247\177\034$\313\316\201b\302\271\3718\353\307?0\020<\206j\r\214\233\255\220\305"
+	.ascii	"\304=\214\216}\374x\210\321Br3\017\346\341\2435\027#\r\230\234"
+	.ascii	"\r#lu\357\256\033\263+|e|\250\260\307|\312ab\231\341\001\205"
+	.ascii	"o`\032X\007\266\201q`)\034\003?a*\214\205\253n\037v\302S8\n\317"
+	.ascii	"\300J|\205w`\031\270\006\316\2017\206a\235\330\352\312\371\235"
+	.ascii	"sW\270\312\271\032U\320H\251\351\212z\216\311z\302a1\337z0\363"
+	.ascii	"\340\220\371\361d\263\002\2265}\3147q\316L1\261\325\335\273|"
+	.ascii	"\270\311\324\221\301U\347\006#\b\023[\3358\347\215\247\335\255"
+	.ascii	"\233c\321\322\240\231a\244g\007\205\255.\335v\272\033\321\246"
+	.ascii	"\305D\307O\214\2304q#\362}\263\032\200C_\364/\337Y\360I\337\r"
+	.ascii	"\274\233/\034\243\3378\023h\351\322vsP\007\005}\235\246\276N"
+	.ascii	"\023}\235!\372::B\\<\035\250\346&\323\221s\003\344\354\346\353"
+	.ascii	"H\351\353<\351\3535\372:\355\266\311:\306t-\271\371zL_\033\321"
+	.ascii	"\327;\364\203|\372\301:\375\340\031\375\240\027\375`\233~\360"
+	.ascii	"L?\030\246\037d\242\037\334\241\017\354\323\007\262\321\007\272"
+	.ascii	"\351\003\257\350\003\243\350\003\221\210\t\223\321\234A\366\315"
+	.ascii	"\277a\376\373\345\202\261z\266'j\205\0359n\276!,\006\340M\301"
+	.ascii	"\350\327\013\0261s\230\334\214\341\267\213\005P[\260\200q\331"
+	.ascii	"\242\313\300DY\335\374\337-w\fGQ\323\204\fTU\030V\017%1\326t"
+	.ascii	"0aB\301\370\302\334\002\022\245\345y\225O`\236wF\215,O,8\250"
+	.ascii	"\344\370\302\002r\344\251\225\265\f\262f\005v\241\262\214<\253"
+	.ascii	"\\,W\355\262\335\260\233\345\246])7\312\025\273_\027\205Kv\321"
+	.ascii	".\330=\273k\367\204\333v\233\227\3125\273W\356\224\353\274eW"
+	.ascii	"\313\265b\235w\354>\371\365\na\2623\253J\035V\231\020,>\264\035"
+	.ascii	"i?t\313.\0337S\360\374U\375t\374\252~9\3562\355\314\n\317\253"
+	.ascii	"\377rt\211\301\346\r\216w\321|haq7\377\254\336\345b\310p\005"
+	.ascii	"\241\373M\371\220\231\223\243\213"
+	.string	"\323q\316L\351Ie\265\035\264\276;677\301z\246\246\220,\17750\227\233C\n\220!?\032fg\306\330x\272\231\002*?\250\337\214\377\240~Q\226\212j\217\330\242\234\343\262\267\261\256B\374?\031\377E\351\023\256\264i\273\371\027\343k\027\353j\203\273\371\007\343k?jbtH8\200\321_\373)\305\200z\324\274\321r\266E7{\324\244\225\311\2739\257\220\373\376\333\377\355\373\333\270\257O\316\336\312\037k)\260\226\002`\22583`\356P'G\016\024\024\370\302\210\271\261\326&Dw\330\242\367\353\3458\026\250\311\263D\341\212\r\234\3478\331M\220I^\223\356\346\274g\365t\304\312\360\240r3\017\335\341\353\371\314y\025\204\005\355\226\324h\362\3469\217g\315\035\22537\347\273\354\346\226\321\022\223\004\017\243\311q\365\244Js\220\241;l\261a\223\353\240\340\315q\371=\265\330t\265y\256[\2639\332"
+	.ascii	"\211\241\347\303|\223\304I\005\035\201\2144i\262\032*[k\274v"
+	.ascii	"\224H-)\242F\247\311\023.\033d\264\007>9\271<\027B\314\035\023"
+	.ascii	"\035\030\216\026\257\031s\326m\007\211X\f--\332C\234\3333\234"
+	.ascii	"[\216\263y\266\271\261\226Nx\003\b\022\006/\316\336\216\372\021"
+	.ascii	"\002iH\020\2673\317qn\300>'\333V~{6\363\353\004\347\320\210\031"
+	.ascii	"\313\2413\231\3472\277\316\317\007\2165^T\372\317c~\235\236\""
+	.ascii	"nd6\320\320\337\360\244#\300\221B\n9\214\320\322\351n\304\235"
+	.ascii	"\225\235\325\336\315r\223\233\313^\236\303d0<Yg\226\200\345/"
+	.ascii	"?^\362\202\260u\321\317\303(p\350C\"\203L{PC\001\205\314%\203"
+	.ascii	"\024\2705>g\206\320\250\261\345\231\313\317\023\224$Z\260\205"
+	.ascii	"\2576hx`i\017TllY\315\0025\237\316\2701\265\223\330\225\327\315"
+	.ascii	"\327 \245;\304\311\222%\253}\240\342d\216\313\bcK\360\264<\253"
+	.ascii	"\255Y35f\266\314i\017_gg9\315\022\201\223\363\262P\306j\255\n"
+	.ascii	"\3559\roY\310s\276Y\271n\200d\246\344\304\031\323\036\206\f\221"
+	.ascii	"\221\3452;\266\247\204\332\226vrB\364\320\260\2333\306\371\\"
+	.ascii	"v\301\310\342\244\276f\241\250I\311\200D\337=\364<6\266\225U"
+	.ascii	"!\300X\301y\005)y\213\022G\013]\031znf\b\243\262\223\263\267"
+	.ascii	"\251\276\\`\304F\025%\247#0b\305J\023\261\030\317$U\300\350\236"
+	.ascii	"8C\317``V\217jG\306\330\2217\026\312\204Y"
+	.string	"\305\235\351\ryC\317S\234y\n\006\223\225c\333\351\007\213\326\2240n*\354\230\n\323>\317\241\347\257[g\376\302^<\300Zn\034CQ\252\242\\\331\252\267#L\":\b\315\320\363\t\316|\002>\342A\221\345\266\002\361\344\256\307)\306\034\037K\035\201\223\354\225\2750_\207\252\237\024\240\200a\230\322AhC\317N\234\331\211u\363\240\310R\251\254\340\311V\024+\027\312\024\262$7\377B\031\375\241\215\t\323\332\345]\004hC\241Y\303\344\242\177\301L\177(\033\262RlN\222\265\262\022kg7\r*\2354\247\232\013Q\364/t\351\017nC\317F\216X=\f\306\210]\260\241\037t\247\205\326\206\236\211\020\271n\254*\b[\332\311\341\261\322\006\n\254\214\37607\364,$k\345.\353\226w\221\255T\216\030\323\026\224\246\037\364D\367\324\r=o\345-\274\025\224\341\344\310\233\340\224-8o7?\350\206\376"
+	.string	"\266\\:\351\236\026\210\354\350\342c\216\006"
+	.string	"\335\217\034$\377\310Y\027\366\262\214kJp\215T\0344 \317YVO\207\013\23456p\026`\032/-\031lt\207\035C\317=\234\271\007\316\332\241r\300\023\026\220\030\rb*ce,\314\247\200+=\236\270\306\333\2243\247\026\2223\364\254\303:\263\216\2575\3002\301\332"
+	.ascii	"-\321 \244\340\300\221\257\316\324\370\r\211b\266\2719_\255\351"
+	.ascii	"`!\241\272\322 \234UU}\372\306\022\035\312\233\017\344\244A\230"
+	.ascii	"\231\232\302{g\3611y\256\244\342\260\3564\2109\271F\256\221\245"
+	.ascii	"\032\260\367\256\263{n,\254\020\232\215\2311P\262\215g\251\265"
+	.ascii	"\236\264*}_~\314\350\t\300\f\345\0306G\315\370\032\b(\240]\003"
+	.ascii	"\306\017\246\027\375\037,\372k\002\260c\364f\244\271y\002\265"
+	.ascii	"\241\254\264\031JN\206\3615\355D\265\201\206\323\307\363GL\377"
+	.ascii	"\007\212\376\232\275P{+\005\360\323U\205.\307\315\023\\\031\302"
+	.ascii	"+\330\274\345d'k\226\3610\330\242\325\274\340?Y\372?0\364\255"
+	.ascii	"5\003f\210\033:\236\3639\230\213\007g\313m5\324\305B\n_<\336"
+	.ascii	"\344\351\t\276\342\304\301|\027\353\371\274c\276\037\234\327"
+	.ascii	"\222\264\233\357\003FK\360\034:\326\303wx\357\206\261\333\212"
+	.ascii	"\352"
+	.string	"\0010\302\236>a\372>\\Z\0024C\307o\356p\336\273\344}\266\225V \274\230\331\027\334\007\210\276O\016\315\2635t\214\207w\267\350\247\250\245\222k\204\224&vq|\252\304\274"
+	.string	"Y\243%P\253\253\303O\275\367\256\302\264;~\3421G\236\220Y\267\260'\001:\3531\305G\307t\250\356\254C\244\361\250H\002\024\005z4L\032\323\341\021\320JdRMt`g\025f`\324\224\036\005_\030\227\322\325\310$B\007t\222\307aZ\034\252@\262(\002\241C5\204t=\226H\246\034V4\204&\025\3108$&\327\264E\021\323\021\311"
+	.string	"ML\307\324h\200\021\034\b9 \321T\204\026\231\214\304cZ\244&\231\212\212J@\036\203GC\324\230\327\344\021I\374\035\255\307T5\002\237DTD\223\210I\nV!\017\252\224\262\030\256F\364\004\t\311!\320\007\025@\301\302D\t\341\007'$ \202\320\204\n\341\n\024AI$q'i\035*\025\035\221JJ\036\232\220\352\322\322PxL\223;O\"*BU\246u\210\036\005Q\254\350\206'\021A\200\005\212\025E H \"\215&P\025i\342\247\230\034Z@M\207\030\222iS\211\022\206#\364\024\215\310\006\240\250\nBq\210&\001i\016D\025\230D\327aq\211\tHxdR\001\220D\032\032A\370\331\331\200\b5!]AT{~8 \n\022:"
+	.string	"\221\211%t]\341a\t\211\204"
+	.string	"\212\244\016\327\240\f$\210\216P\025M*6\250Hb\th\004\206\353\360\304\005T$S\236d\022%\"\325% \b\020U \023*\226\230H@\"\215@\250\013\225\311\204\206u\003\323\021]\327\022'P\254(R\207d\213\022\027T\254(\322\217\016\006\3074\311\243cD\244\"W\342\020\204$\222\310\263!\003\242594\n)\241k\362\305\212\037\020\220*\"\350\240\001Q\222\t\231\272@\325\024\021\374F\0205\241\305c\032L\2178\244\bB\327\341\272B\205\212T\325\017T$\b"
+	.string	"@\327aOQ\321\2302\265\350\200\304\324\002-\352$[\224\3709\"\323\225\210\032\217\320\023DUII\307\304zDU\225\211\330\341\033\320uhd\"\032\207D\r'\246*zD\221\364Gp`"
+	.string	"\016H4\005O\242\003\f:\300"
+	.ascii	"x\022\035\030\031u\300\201\221>\007Fx\025&U\324\310\364\001Z"
+	.ascii	"dZ\323u\035jXW\022\222C\026G\304\035TXD\321\204l\021\f\2260T"
+	.ascii	"\361\223\210\230\224R\243\021\251\346$\342\232.\375J\030\276"
+	.ascii	"\300I\224\3118t\221$\252E\304\243\017I\023D\365\202\356)\036"
+	.ascii	"\207-\212C\264\030\204\"\255\311\341\221P\270\032\207\031\212"
+	.ascii	"hRE]\240\2520\203\021\211d\200\360\367$\242&\265\250I\305\320"
+	.ascii	"\244\356,\r\225\210\352OE\213\251\213&\3258LU4\031tD\246\311"
+	.ascii	"$S\213\244O\023j\\b:qd\034&\355\030\221D\344\212T\227~Va\006"
+	.ascii	"\032\024S\235#U\230.%\205M*\007\264\230\252\302c\nb\025\006\221"
+	.ascii	"\206,\220\251\020\211\311\270$\024\264\242ITE\256LCa\361\230"
+	.ascii	"\266\020\256\303\244P\211I]I@\227\222\021\364\240\306!1\271\263"
+	.ascii	"\252\250\213c*L\223I\225\207\250\026S\245\3371U\322$\020\321"
+	.ascii	"$b\323PI\377$M\030\207.\214\310%\025]\217(\210*\207$\212\252"
+	.ascii	"H\350\t\245\241\t\027KG\027\214\350\3618L\"\n\233\230\206?\353"
+	.ascii	"\320E\272\022K\240E\244\bj:\024:\246D4\311$l\032*\t\233T\236"
+	.ascii	"\2440E1]\352Y\237DTL\227\212\214B'lRH\242\230.\001SX\024\266"
+	.ascii	"\230.at\351\305*T\321\325\230\036\005\365\230\220$<Z2\nK\030"
+	.ascii	"\276\3301!\311\347\350\b\2712\021\205I\304\025y\024^X\217(QE"
+	.ascii	"S\244Xb*\036S\013p\340)a8\202\022\323\212b\272\344\263\036\231"
+	.ascii	"\220D!\2124TQ\027C\3411yD\227\224"
+	.string	"\220&\212i\212u\330\302\005\206c*\302Z\242\230.\001\225\370y\261\246.\3225M\036\321\025F\324\005j\004Z\211\350\321\021\006\264\210T\022\256*\272\324\204\nWc\272\n\217H\023R\025\231$\304\0025\256+RMb\261\341\230\016CP\221\353PE\323\f\310t\035\252h\032\032Q\025\311\013k\022R\212Z`EW(\251\350Z\304\360\"hM\225R\b\030Q\"\261\204O\261hD&%Q5iE\002B\225\322u\0075\"\035\207\031\204\030P\241\n\023\305t\351\302\013\025u\201$\242\2520)9T\211>\301\365ID\2501=B\252K\302\n\216\\B\325\242\025\211T\213xV!\007Fz=\246\310%\022\206\250\332B8\\Z}\222B\244\364\350\2104aD\252\353\021I\304\200\256C\025D5H\242\230\212\240&\255A5i\325It\035\252\277\023(R\250I,\216/\212:\253\220\304zL\231\202\317"
+	.string	"\001\304\r\0200b\004\006DAG"
+	.string	"\002L\200\240@\004B\320D\"\242*$\036\025\021\217\212\216\351P\251\210\250&\213\2104\220@.5}P\302p\004\242\272\363\377\247$\3279\277\324\355%\301`D\354\r\031C\222\207FN\033\036\367H\216\243\327\243\212\353f\037\340\tId\264\025\361\002\227u\367v\363\257\013\207\240\257\357\327u\177D~C\376\353\372O\220\356+J\t\024\202\371x\024\341\342\342b\341n\212\nI\266\31001\013R\246\351e\366%\267\314q\301\262=5\253 ]M\324\250d]7\032\255\356\255\006\2209\002\310\260\301v\363\017\374\374u\301\342T\304\207\032\006\340\331\350\352a\335\200;`\360a\341\021\204\252\250#c\224aL\224b\244b\n9D4\322&\351S\024@P\200L,\234\017x\265\033\023\200R\t4\262\032\266\310\224\311\214$I\332\177\003rI\272\345\321\313\246\230\314c_\317%8\205\234\324\227"
+	.string	"D\r\005\335\255\024!e*\353\350H5\376R\024v\235\240\230"
+	.string	"\264\017\364)Q\005\026=\013F\333W\345,\265\b\351\001<'\252\217\210\357\302\302\336n\246c\364:]\236<\260\214\335w\377!\307\024\367\020,\330S\252\263\211\337\323\345\304\323\rz]\256\007\316J?0Q\350\024\365\367\251{\371kbg\317D\262D#\202\024L\274_\365\007\350\351\025\344\275\250\"4,\n\312\321\207\331\233/h9\200\027\320\346,\177y\3751\314\344S\204\203G\212\247\262\271i\323\213\350\342O\303\n|\242zX\024\247\303\335$c\305\\\373\364-\\Vx\231\245\n\264cP18 \b\t\303\306U\016"
+	.string	"\300\242\210D7>\362\377\301u\316\331\321\366\030De$\375\342\223\327\257\261y M)3\221a\240\341\031\255\206U\304\244\347\225\312=[\035\234\207\317\240~H\351\321\260\352\227\267d\224\232\312dl*\201d\342\272\022e%C_<\026\251\361\366$\035\264jJ\257A\260\206\326HP\340:dI\231@S~\353G\266\256'\346\335\200\007A\352a\013\275\216\203b\017\037Z\241\313+\353Y\217j\3730\234M\212\362\262\357J\021\021\344n\231\302\226\231rU\245?'\231\f\226\034?\246\234/\350^\025\177\331\313\036\b\030\234\205ki&\322s<\251\217\226c\001\212\302(\2135\331\270\216|\251"
+	.ascii	"\234\272O\361\233E Z\206\337\343a\fQ8D\264\223\b\033\302\264"
+	.ascii	"k\244\r\336~\366%H\212\344/z?<\362\252\335CA\215\270$"
+	.string	""
+	.ascii	"\005\253>((\025[$\213\274\316\305\214\3158Bp\320/\233\004\201"
+	.ascii	"W\327C\317\023\201\t\202\314\311\034$\214@Q9\002X\334#\354\036"
+	.ascii	"~x\303\007u\025\210\006\362\027\247\344k\221!\376\225\177\315"
+	.ascii	"\201\304HP\022\351-:8d\365CE\317\273\2323\374\356.\354\3503N"
+	.ascii	"\243u\236\025\300\252*\005\\>\314^a/\023X\275/] \213\340\f;\214"
+	.ascii	"\267\301*\006\004\355\016\213\302\336\177\261.7\341\035\373+"
+	.ascii	"\327*\020\325P6E\233\327\031\253r_i\005\360\350\304-\352(\037"
+	.ascii	"\263\026\025\275^j\357\340|\006\372<_9\001\362\213\257\277\310"
+	.ascii	"\036\243p]x\305\300\223\237\367"
+	.string	"\277\362itD\304L\373C,\002\321&\370\023\275\235k\207\306\377\353\353M8\346\326Y\370\227H\370/\337M\235$\244\013\200Hn\"V?p\023{\t\020\302\253\277\275\305+\247\253\030\210\276u\026h\351\337\276\375\bI\244\034\016\351\267L\233\\\231\375\277\367\214b\020\255\001\031\262\r\b\006\030\3237\305\034]O\254\225\261]I\350i\265\252aV\001\300'N\352\023zyaL\001\306\224\347GE\260\330k\247q\034J\240N\303(J\336\332\034\347\335\204Z\"\300\331\235\245\225\201c\034Xqh\353\"\361=\204p\366\265\372e\265\331\013\227\376\177:\2551\006\330\202\032\036\0335U\243\261\270\031\022\303\200\2367'k\003\371u,\006k/Z\326)\272\261W\342\003\256wf%\037\177a\303\224pA\023Ye{\302\204f\017Nx\226\220\307|)c\024\365|,\2451\030\213\203\031\337\027\"@\312\260K\204\363"
+	.string	"^\354\323\233#.\333pu\365n\207\254\271\036F/\251\326j\352^=\300\0070\204\365z\216F\204"
+	.ascii	"\202\260&\035bF\013\016\202\211\354\036\034\013\353\213;\353"
+	.ascii	"2~K~\355o\364\236\300\314\004DY\272\217e`\024\314\"\256]J^\335"
+	.ascii	"\246\350\346\346\227\346\341\204v\r\230\220\f=\321\234\303,\257"
+	.ascii	"\277T\024\361\231\272\265zg_\237IU\t\033\205\262\221[]P\b\201"
+	.ascii	"g\271N,\264\r,\253D\374V\224\231\325\253F\263\372._1\305\026"
+	.ascii	"\356\nO\203\231\340b2b\"\366\332?\204!\202p\366\216\b\243\315"
+	.ascii	"\202\345\r:@X\235?*_\253\200\274f#\006\247E\270\033\203\217\200"
+	.ascii	"\003\353\243\345\367\235\371\220\255\351\210j\035\031j\371\201"
+	.ascii	"B\212\260\231\f3)x\202\017\371!t\240\274\342b1\364\034\0369\253"
+	.ascii	"aL!AB\313\364\216\345\354J\351\202\263\370\016\"\005G\023g\256"
+	.ascii	"\241\376\021\245zA5\321\317\210\317Ss\333$\257\222\323\376h\230"
+	.ascii	"\t\212:\t\302\234\020\263`\210]\024/\274\t\303\2162\213\224L"
+	.ascii	"\221\035\r\224L\002m\245c3n$\250\201WdHk\016/-()/\324\027\021"
+	.ascii	"\354\244\225O\274\217F\241\035)\006$\031XX @\177\016\352\222"
+	.ascii	"\330?4z\r\257\305\3159\004\001\246\026\214\261_d\037\327R\200"
+	.ascii	"\033\256\202JJNw\260\323c\241U\272\314\357\024\227\220\017\240"
+	.ascii	"\376\351tGp\321"
+	.string	"\265\024\247\201\241\203.\3647\323\300K8\326\337\214\353LA(\003\004\033\3322\226\022{\324M\306`\361\322=\344\364\3414n\001\033\227\033a\336\224h\b\352\336h\331\013F\203\340\274}\006d\310\326t\352E\254\244\257A\241\362\034^\375\236\354\232\375/\335]/\316\317xgA\252\351[\020O\327u\234\246\203\275mL\305z\213g\236\027]\317\312\r\217_V\211F\246\261\255AO\202\225\313\033\245dhJ>\274\346F\244\205W\177\301\330M\214s\210L\247\312J\333FXZ8\317\3251\333kn\206E\226S\245~\031\240\016\201M\245\"\210O\352]c\344\241!5fg0\n-\322Bc-\216\274\350\002\222qc\352 \257+\355p\"\327\006\206\205\304\364\005A\205\326E\310\300\213\241k|\f\356h\231gl\325\376K=o\3056\311Qy\266\257z\310j\304\305+{\033T\220\306\323\231\345\232\342\2424"
+	.string	"\210\361\t3\305\344\362Is)t8\031[\257\324%V\222%\020\275}\277\306C\331d\001\335\353\3225\251"
+	.string	"\270\035U\330\346\262@\353\210\006\242s\3720\\\322\340\017F\305\022\noGKT\243\310\202\302%\211"
+	.string	"m~Z\226\2419V\234r\345\022\313\bc\310\021,H\342\360\313L\335gA\220\245\027qNDD\303\303\250J\247\036n}"
+	.string	"\332\322\326\216\322\326<s\367\007\371\244f\362q\027\210\226\033\252\355\243\362iv!t,\223dL\353{\226\310\f\315:-\036\310\212\372W\345\277\330\022\233\230\363\360\312\251\241\255\211\200\333g'Z\034\213/\241\335\311\037\002!D6g(\254\273`\215\025i\221HQ\3359\216\216\352\273(\202t\222\357!\255\337\013\347\277\204\216\233HT\217+!\244@\b\007\242O\213\037I\311C\313\345\205uB\tL;\002O\221\225:\214\201A\224\371\275\025\337q1H\205\373\276\237\343\203\266|\212\202Y\367\by\017\277V\203\247\317\013D\371g\212\354#\006CM"
+	.ascii	"\006\331\262D\215\367\b\210<T\r\032\253\330\227\226\227D^k\032"
+	.ascii	"d\263i#@\267 \245U\031*\362\353\372\226\357\317;q\337Z ?\222"
+	.ascii	"\221\203\261\301\270\234l\3602}\205*\333#\352\355!\325\231&9"
+	.ascii	"l\017\240h\203\271\234e`\3134\241\264\324\213-|\361=lMc\007\202"
+	.ascii	"\234D\221\273(\\N+\250d\304\266\377\335\002\363=X\374n\026\275"
+	.ascii	"\307J\344"
+	.string	"\375\270\233\230\005\266Z\306\336\207\343\004\363_\210\023\221\323\330/d;\320E\200\240\341\223\364}\222\256\007\027)*\261\3500\377\210db\321,\244\333\212_\033\362\027\351\205\377\234\"\261-\207\363\333\375\256\351?l.+\035\210\353\217r\265a\334\304\366-mwa\315\005\023\302\3150h\220\226k|\374\221>\367|\031H>\212\316&\232>3~\037\\\036\261\177\365\237#\365N\371\357)\227\3348\004\366\270\274\201\377\2606\267Di\005E\346\341V]\373$5\306\354\035\244\234\341|\274\032\234\266w\3001\3210H#\320\034T\270\353}\261qes\205\372\207yd\360\260\327\252\032G\226\f[\271k\004\376\337Y\336z\bw\021\330\2555=\226p\005\321\2665\236\322=\303\330gr\317\350\034\335\334\271]\334\337\350]7/\367<\326:\320\314\253\377\341\271\230\236f\235\315\036\261\264)\036\230\366\t\277\303\032w\332"
+	.ascii	"/\376\246\333$\365;\333q\3416\205\213\316\216\373\241\240\307"
+	.ascii	">}\200=\223\372m\311\301\373\237\333K\342\213O\373\354}r\353"
+	.ascii	"\202y\030\351\024d\0328\233}\ti->Q5\013\262#\035\367\317\024"
+	.ascii	"\322\245Z\264a\b\356G]\300\374S\177\304\216N\240\266>\270#\375"
+	.ascii	"v~\020\263i\364\376\346\275\304~,.\310\233Q \354'c\320\277q\030"
+	.ascii	"\344\376X\237w0\355M\303+\313\274\371Pm\203\360\3251\343\204"
+	.ascii	"\373\302g\331]sCW\327D\003\004\037\335\370\007\337\037\277\363"
+	.ascii	"\315/\277\013\025\343\310\320\016\241\327\362\237g\244\273S5"
+	.ascii	"\366>\324\225~\364\t\031\3513@\320\r"
+	.text
+	.section	.gnu.lto_.symtab.881d92c916c245b9,"e",@progbits
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"rcLookupThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"isAntiGravityModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.881d92c916c245b9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
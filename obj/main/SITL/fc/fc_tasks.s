@@ -0,0 +1,19970 @@
+	.file	"fc_tasks.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "./src/main/target/SITL/target.h"
+	.file 8 "./src/main/common/time.h"
+	.file 9 "./src/main/blackbox/blackbox.h"
+	.file 10 "./src/main/common/color.h"
+	.file 11 "./src/main/drivers/sensor.h"
+	.file 12 "./src/main/drivers/accgyro/accgyro.h"
+	.file 13 "./src/main/drivers/io_types.h"
+	.file 14 "./src/main/drivers/bus_i2c.h"
+	.file 15 "./src/main/drivers/bus.h"
+	.file 16 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 17 "./src/main/drivers/resource.h"
+	.file 18 "./src/main/drivers/serial.h"
+	.file 19 "./src/main/fc/config.h"
+	.file 20 "./src/main/common/streambuf.h"
+	.file 21 "./src/main/msp/msp.h"
+	.file 22 "./src/main/fc/rc_modes.h"
+	.file 23 "./src/main/fc/fc_core.h"
+	.file 24 "./src/main/fc/runtime_config.h"
+	.file 25 "./src/main/fc/cli.h"
+	.file 26 "./src/main/flight/pid.h"
+	.file 27 "./src/main/io/ledstrip.h"
+	.file 28 "./src/main/io/serial.h"
+	.file 29 "./src/main/msp/msp_serial.h"
+	.file 30 "./src/main/rx/rx.h"
+	.file 31 "./src/main/sensors/sensors.h"
+	.file 32 "./src/main/sensors/acceleration.h"
+	.file 33 "./src/main/sensors/current.h"
+	.file 34 "./src/main/sensors/voltage.h"
+	.file 35 "./src/main/sensors/battery.h"
+	.file 36 "./src/main/sensors/compass.h"
+	.file 37 "./src/main/sensors/gyro.h"
+	.file 38 "./src/main/scheduler/scheduler.h"
+	.file 39 "./src/main/flight/altitude.h"
+	.file 40 "./src/main/fc/fc_msp.h"
+	.file 41 "./src/main/sensors/barometer.h"
+	.file 42 "./src/main/telemetry/telemetry.h"
+	.file 43 "./src/main/io/flashfs.h"
+	.file 44 "./src/main/io/rcsplit.h"
+	.file 45 "./src/main/io/gps.h"
+	.file 46 "./src/main/fc/fc_dispatch.h"
+	.file 47 "./src/main/flight/imu.h"
+	.file 48 "./src/main/config/feature.h"
+	.file 49 "./src/main/fc/fc_tasks.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_tasks.c.3099a532
+	.weak	fc_tasks.c.3099a532
+fc_tasks.c.3099a532:
+	.long	0x1c93
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF2623
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2043
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2044
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2045
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2046
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2047
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2048
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2049
+	.uleb128 0x4
+	.long	.LASF2050
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF2051
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x72
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2052
+	.uleb128 0x4
+	.long	.LASF2053
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF2054
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2055
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4c
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2056
+	.uleb128 0xc
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2057
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x66
+	.uleb128 0x4
+	.long	.LASF2058
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x85
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2059
+	.uleb128 0x6
+	.long	.LASF2063
+	.byte	0x10
+	.byte	0x3
+	.byte	0x33
+	.byte	0x10
+	.long	0xf2
+	.uleb128 0x2
+	.long	.LASF2060
+	.byte	0x3
+	.byte	0x35
+	.byte	0x23
+	.long	0xf2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x3
+	.byte	0x36
+	.byte	0x23
+	.long	0xf2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xca
+	.uleb128 0x4
+	.long	.LASF2062
+	.byte	0x3
+	.byte	0x37
+	.byte	0x3
+	.long	0xca
+	.uleb128 0x6
+	.long	.LASF2064
+	.byte	0x28
+	.byte	0x4
+	.byte	0x16
+	.byte	0x8
+	.long	0x179
+	.uleb128 0x2
+	.long	.LASF2065
+	.byte	0x4
+	.byte	0x18
+	.byte	0x7
+	.long	0x29
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0x4
+	.byte	0x19
+	.byte	0x10
+	.long	0x4c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x7
+	.long	0x29
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x10
+	.long	0x4c
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2069
+	.byte	0x4
+	.byte	0x20
+	.byte	0x7
+	.long	0x29
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2070
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9
+	.long	0x72
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2071
+	.byte	0x4
+	.byte	0x23
+	.byte	0x9
+	.long	0x72
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2072
+	.byte	0x4
+	.byte	0x24
+	.byte	0x14
+	.long	0xf7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x25
+	.byte	0x28
+	.byte	0x5
+	.byte	0x43
+	.byte	0x9
+	.long	0x1a7
+	.uleb128 0x17
+	.long	.LASF2073
+	.byte	0x5
+	.byte	0x45
+	.byte	0x1c
+	.long	0x103
+	.uleb128 0x17
+	.long	.LASF2074
+	.byte	0x5
+	.byte	0x46
+	.byte	0x8
+	.long	0x1a7
+	.uleb128 0x17
+	.long	.LASF2075
+	.byte	0x5
+	.byte	0x47
+	.byte	0xc
+	.long	0x30
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x1b7
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x27
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2076
+	.byte	0x5
+	.byte	0x48
+	.byte	0x3
+	.long	0x179
+	.uleb128 0x5
+	.long	0x1c8
+	.uleb128 0x26
+	.uleb128 0x4
+	.long	.LASF2077
+	.byte	0x6
+	.byte	0x18
+	.byte	0x13
+	.long	0x5a
+	.uleb128 0xc
+	.long	0x1c9
+	.uleb128 0x27
+	.long	0x1c9
+	.uleb128 0x4
+	.long	.LASF2078
+	.byte	0x6
+	.byte	0x19
+	.byte	0x14
+	.long	0x79
+	.uleb128 0x4
+	.long	.LASF2079
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x91
+	.uleb128 0xc
+	.long	0x1eb
+	.uleb128 0x18
+	.long	.LASF2354
+	.byte	0x7
+	.byte	0xa1
+	.byte	0xa
+	.long	0x1eb
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x7
+	.byte	0xd4
+	.long	0x21e
+	.uleb128 0x2
+	.long	.LASF2080
+	.byte	0x7
+	.byte	0xd6
+	.byte	0xb
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2081
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x3
+	.long	0x208
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2082
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2083
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2084
+	.uleb128 0x4
+	.long	.LASF2085
+	.byte	0x8
+	.byte	0x19
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2086
+	.byte	0x8
+	.byte	0x21
+	.byte	0x12
+	.long	0x1eb
+	.uleb128 0x5
+	.long	0x1c9
+	.uleb128 0x6
+	.long	.LASF2087
+	.byte	0x8
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x10
+	.long	0x2d2
+	.uleb128 0x2
+	.long	.LASF2088
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xd
+	.long	0x1c9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x9
+	.byte	0x2e
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x9
+	.byte	0x2f
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2093
+	.byte	0x9
+	.byte	0x30
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2094
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2095
+	.byte	0x9
+	.byte	0x32
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2096
+	.byte	0x9
+	.byte	0x33
+	.byte	0x3
+	.long	0x25c
+	.uleb128 0xc
+	.long	0x2d2
+	.uleb128 0xb
+	.long	.LASF2337
+	.byte	0x9
+	.byte	0x35
+	.byte	0x19
+	.long	0x2d2
+	.uleb128 0x5
+	.long	0xa6
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x15
+	.long	0x313
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2100
+	.byte	0x4
+	.byte	0xa
+	.byte	0x34
+	.byte	0x10
+	.long	0x342
+	.uleb128 0x10
+	.string	"h"
+	.byte	0xa
+	.byte	0x35
+	.byte	0xe
+	.long	0x1df
+	.byte	0
+	.uleb128 0x10
+	.string	"s"
+	.byte	0xa
+	.byte	0x36
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x2
+	.uleb128 0x10
+	.string	"v"
+	.byte	0xa
+	.byte	0x37
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2101
+	.byte	0xa
+	.byte	0x38
+	.byte	0x3
+	.long	0x313
+	.uleb128 0xd
+	.long	0x231
+	.long	0x35e
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0xb
+	.byte	0x17
+	.long	0x3a1
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2111
+	.byte	0xb
+	.byte	0x21
+	.byte	0x3
+	.long	0x35e
+	.uleb128 0x4
+	.long	.LASF2112
+	.byte	0xb
+	.byte	0x27
+	.byte	0x10
+	.long	0x3b9
+	.uleb128 0x5
+	.long	0x3be
+	.uleb128 0x11
+	.long	0x3c9
+	.uleb128 0x3
+	.long	0x3c9
+	.byte	0
+	.uleb128 0x5
+	.long	0x3ce
+	.uleb128 0x6
+	.long	.LASF2113
+	.byte	0x88
+	.byte	0xc
+	.byte	0x4c
+	.byte	0x10
+	.long	0x46b
+	.uleb128 0x2
+	.long	.LASF2114
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x3ad
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0xc
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x46b
+	.byte	0x8
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x11
+	.long	0x558
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0xc
+	.byte	0x50
+	.byte	0xe
+	.long	0x1df
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0xc
+	.byte	0x51
+	.byte	0xd
+	.long	0x6e1
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0xc
+	.byte	0x52
+	.byte	0xa
+	.long	0x9f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0xc
+	.byte	0x53
+	.byte	0x9
+	.long	0x238
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0xc
+	.byte	0x55
+	.byte	0x15
+	.long	0x1b7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2121
+	.byte	0xc
+	.byte	0x57
+	.byte	0x14
+	.long	0x3a1
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2122
+	.byte	0xc
+	.byte	0x58
+	.byte	0x1a
+	.long	0x6d5
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2123
+	.byte	0xc
+	.byte	0x59
+	.byte	0x18
+	.long	0x61b
+	.byte	0x68
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2124
+	.byte	0xb
+	.byte	0x28
+	.byte	0xf
+	.long	0x477
+	.uleb128 0x5
+	.long	0x47c
+	.uleb128 0x13
+	.long	0x238
+	.long	0x48b
+	.uleb128 0x3
+	.long	0x3c9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2125
+	.byte	0xd
+	.byte	0x18
+	.byte	0x11
+	.long	0x1c9
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0xd
+	.byte	0x19
+	.byte	0xf
+	.long	0x9d
+	.uleb128 0x1e
+	.long	.LASF2132
+	.byte	0x5
+	.long	0x29
+	.byte	0xe
+	.byte	0x1e
+	.long	0x4d2
+	.uleb128 0x1b
+	.long	.LASF2127
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2132
+	.byte	0xe
+	.byte	0x24
+	.byte	0x3
+	.long	0x4a3
+	.uleb128 0x6
+	.long	.LASF2133
+	.byte	0x10
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xc
+	.long	0x506
+	.uleb128 0x2
+	.long	.LASF2134
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x16
+	.long	0x506
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xe
+	.long	0x497
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x21e
+	.uleb128 0x6
+	.long	.LASF2136
+	.byte	0x8
+	.byte	0xf
+	.byte	0x21
+	.byte	0xc
+	.long	0x533
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0xf
+	.byte	0x22
+	.byte	0x12
+	.long	0x4d2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0xf
+	.byte	0x23
+	.byte	0x10
+	.long	0x1c9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2443
+	.byte	0x10
+	.byte	0xf
+	.byte	0x19
+	.long	0x558
+	.uleb128 0x1c
+	.string	"spi"
+	.byte	0xf
+	.byte	0x20
+	.byte	0x7
+	.long	0x4de
+	.uleb128 0x1c
+	.string	"i2c"
+	.byte	0xf
+	.byte	0x24
+	.byte	0x7
+	.long	0x50b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2138
+	.byte	0xf
+	.byte	0x25
+	.byte	0x3
+	.long	0x533
+	.uleb128 0xc
+	.long	0x558
+	.uleb128 0x4
+	.long	.LASF2139
+	.byte	0x10
+	.byte	0x80
+	.byte	0xf
+	.long	0x575
+	.uleb128 0x5
+	.long	0x57a
+	.uleb128 0x13
+	.long	0x238
+	.long	0x598
+	.uleb128 0x3
+	.long	0x598
+	.uleb128 0x3
+	.long	0x1c9
+	.uleb128 0x3
+	.long	0x1c9
+	.uleb128 0x3
+	.long	0x257
+	.byte	0
+	.uleb128 0x5
+	.long	0x564
+	.uleb128 0x4
+	.long	.LASF2140
+	.byte	0x10
+	.byte	0x81
+	.byte	0xf
+	.long	0x5a9
+	.uleb128 0x5
+	.long	0x5ae
+	.uleb128 0x13
+	.long	0x238
+	.long	0x5c7
+	.uleb128 0x3
+	.long	0x598
+	.uleb128 0x3
+	.long	0x1c9
+	.uleb128 0x3
+	.long	0x1c9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2141
+	.byte	0x10
+	.byte	0x82
+	.byte	0x10
+	.long	0x5d3
+	.uleb128 0x5
+	.long	0x5d8
+	.uleb128 0x28
+	.uleb128 0x6
+	.long	.LASF2142
+	.byte	0x20
+	.byte	0x10
+	.byte	0x86
+	.byte	0x10
+	.long	0x61b
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0x10
+	.byte	0x87
+	.byte	0x1a
+	.long	0x569
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0x10
+	.byte	0x88
+	.byte	0x1b
+	.long	0x59d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2144
+	.byte	0x10
+	.byte	0x89
+	.byte	0x13
+	.long	0x5c7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2145
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2146
+	.byte	0x10
+	.byte	0x8b
+	.byte	0x3
+	.long	0x5d9
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x10
+	.byte	0xa9
+	.long	0x67c
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2159
+	.byte	0x10
+	.byte	0xb6
+	.byte	0x3
+	.long	0x627
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x10
+	.byte	0xb8
+	.long	0x6a1
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2162
+	.byte	0x10
+	.byte	0xbb
+	.byte	0x3
+	.long	0x688
+	.uleb128 0x6
+	.long	.LASF2163
+	.byte	0x8
+	.byte	0x10
+	.byte	0xbd
+	.byte	0x10
+	.long	0x6d5
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0x10
+	.byte	0xbe
+	.byte	0x11
+	.long	0x67c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0x10
+	.byte	0xbf
+	.byte	0x19
+	.long	0x6a1
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2166
+	.byte	0x10
+	.byte	0xc0
+	.byte	0x3
+	.long	0x6ad
+	.uleb128 0xd
+	.long	0xab
+	.long	0x6f1
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0xb7
+	.long	0x701
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2167
+	.byte	0xc
+	.byte	0x5a
+	.byte	0x3
+	.long	0x3ce
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x11
+	.byte	0x14
+	.long	0x834
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2215
+	.byte	0x7
+	.long	0x4c
+	.byte	0x12
+	.byte	0x17
+	.long	0x857
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2215
+	.byte	0x12
+	.byte	0x1b
+	.byte	0x3
+	.long	0x834
+	.uleb128 0x1e
+	.long	.LASF2219
+	.byte	0x7
+	.long	0x4c
+	.byte	0x12
+	.byte	0x1d
+	.long	0x8b0
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2219
+	.byte	0x12
+	.byte	0x30
+	.byte	0x3
+	.long	0x863
+	.uleb128 0x4
+	.long	.LASF2230
+	.byte	0x12
+	.byte	0x32
+	.byte	0x10
+	.long	0x8c8
+	.uleb128 0x5
+	.long	0x8cd
+	.uleb128 0x11
+	.long	0x8d8
+	.uleb128 0x3
+	.long	0x1df
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2231
+	.byte	0x48
+	.byte	0x12
+	.byte	0x34
+	.byte	0x10
+	.long	0x99c
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0x12
+	.byte	0x36
+	.byte	0x24
+	.long	0xa31
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0x12
+	.byte	0x38
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0x12
+	.byte	0x39
+	.byte	0x10
+	.long	0x857
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2235
+	.byte	0x12
+	.byte	0x3a
+	.byte	0x13
+	.long	0x8b0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2236
+	.byte	0x12
+	.byte	0x3c
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2237
+	.byte	0x12
+	.byte	0x3e
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0x12
+	.byte	0x3f
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0x12
+	.byte	0x40
+	.byte	0x17
+	.long	0xa36
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0x12
+	.byte	0x41
+	.byte	0x17
+	.long	0xa36
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0x12
+	.byte	0x42
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0x12
+	.byte	0x43
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0x12
+	.byte	0x44
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0x12
+	.byte	0x45
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0x12
+	.byte	0x47
+	.byte	0x1e
+	.long	0x8bc
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2246
+	.byte	0x50
+	.byte	0x12
+	.byte	0x5c
+	.byte	0x8
+	.long	0xa2c
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x12
+	.byte	0x5d
+	.byte	0xc
+	.long	0xa61
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0x12
+	.byte	0x5f
+	.byte	0x10
+	.long	0xa7a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0x12
+	.byte	0x60
+	.byte	0x10
+	.long	0xa7a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0x12
+	.byte	0x62
+	.byte	0xf
+	.long	0xa8e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0x12
+	.byte	0x65
+	.byte	0xc
+	.long	0xaa3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2252
+	.byte	0x12
+	.byte	0x67
+	.byte	0xb
+	.long	0xab7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0x12
+	.byte	0x69
+	.byte	0xc
+	.long	0xacc
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2254
+	.byte	0x12
+	.byte	0x6b
+	.byte	0xc
+	.long	0xae6
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0x12
+	.byte	0x6d
+	.byte	0xc
+	.long	0xaf6
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x12
+	.byte	0x6e
+	.byte	0xc
+	.long	0xaf6
+	.byte	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	0x99c
+	.uleb128 0x5
+	.long	0xa2c
+	.uleb128 0x5
+	.long	0x1da
+	.uleb128 0x4
+	.long	.LASF2257
+	.byte	0x12
+	.byte	0x48
+	.byte	0x3
+	.long	0x8d8
+	.uleb128 0xc
+	.long	0xa3b
+	.uleb128 0x11
+	.long	0xa5c
+	.uleb128 0x3
+	.long	0xa5c
+	.uleb128 0x3
+	.long	0x1c9
+	.byte	0
+	.uleb128 0x5
+	.long	0xa3b
+	.uleb128 0x5
+	.long	0xa4c
+	.uleb128 0x13
+	.long	0x1eb
+	.long	0xa75
+	.uleb128 0x3
+	.long	0xa75
+	.byte	0
+	.uleb128 0x5
+	.long	0xa47
+	.uleb128 0x5
+	.long	0xa66
+	.uleb128 0x13
+	.long	0x1c9
+	.long	0xa8e
+	.uleb128 0x3
+	.long	0xa5c
+	.byte	0
+	.uleb128 0x5
+	.long	0xa7f
+	.uleb128 0x11
+	.long	0xaa3
+	.uleb128 0x3
+	.long	0xa5c
+	.uleb128 0x3
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x5
+	.long	0xa93
+	.uleb128 0x13
+	.long	0x238
+	.long	0xab7
+	.uleb128 0x3
+	.long	0xa75
+	.byte	0
+	.uleb128 0x5
+	.long	0xaa8
+	.uleb128 0x11
+	.long	0xacc
+	.uleb128 0x3
+	.long	0xa5c
+	.uleb128 0x3
+	.long	0x857
+	.byte	0
+	.uleb128 0x5
+	.long	0xabc
+	.uleb128 0x11
+	.long	0xae6
+	.uleb128 0x3
+	.long	0xa5c
+	.uleb128 0x3
+	.long	0x1c3
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x5
+	.long	0xad1
+	.uleb128 0x11
+	.long	0xaf6
+	.uleb128 0x3
+	.long	0xa5c
+	.byte	0
+	.uleb128 0x5
+	.long	0xaeb
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x13
+	.byte	0x22
+	.long	0xbd8
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF2265
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF2266
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF2267
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF2268
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF2269
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF2270
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF2271
+	.value	0x8000
+	.uleb128 0xa
+	.long	.LASF2272
+	.long	0x10000
+	.uleb128 0xa
+	.long	.LASF2273
+	.long	0x20000
+	.uleb128 0xa
+	.long	.LASF2274
+	.long	0x40000
+	.uleb128 0xa
+	.long	.LASF2275
+	.long	0x80000
+	.uleb128 0xa
+	.long	.LASF2276
+	.long	0x100000
+	.uleb128 0xa
+	.long	.LASF2277
+	.long	0x200000
+	.uleb128 0xa
+	.long	.LASF2278
+	.long	0x400000
+	.uleb128 0xa
+	.long	.LASF2279
+	.long	0x800000
+	.uleb128 0xa
+	.long	.LASF2280
+	.long	0x2000000
+	.uleb128 0xa
+	.long	.LASF2281
+	.long	0x4000000
+	.uleb128 0xa
+	.long	.LASF2282
+	.long	0x8000000
+	.uleb128 0xa
+	.long	.LASF2283
+	.long	0x10000000
+	.uleb128 0xa
+	.long	.LASF2284
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2285
+	.byte	0x10
+	.byte	0x14
+	.byte	0x19
+	.byte	0x10
+	.long	0xc00
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x14
+	.byte	0x1a
+	.byte	0xe
+	.long	0x257
+	.byte	0
+	.uleb128 0x10
+	.string	"end"
+	.byte	0x14
+	.byte	0x1b
+	.byte	0xe
+	.long	0x257
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2286
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x3
+	.long	0xbd8
+	.uleb128 0x8
+	.byte	0x5
+	.long	0x29
+	.byte	0x15
+	.byte	0x17
+	.long	0xc31
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF2288
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2290
+	.sleb128 -2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2291
+	.byte	0x15
+	.byte	0x1c
+	.byte	0x3
+	.long	0xc0c
+	.uleb128 0x6
+	.long	.LASF2292
+	.byte	0x18
+	.byte	0x15
+	.byte	0x23
+	.byte	0x10
+	.long	0xc7f
+	.uleb128 0x10
+	.string	"buf"
+	.byte	0x15
+	.byte	0x24
+	.byte	0xc
+	.long	0xc00
+	.byte	0
+	.uleb128 0x10
+	.string	"cmd"
+	.byte	0x15
+	.byte	0x25
+	.byte	0xe
+	.long	0x1df
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x15
+	.byte	0x26
+	.byte	0xd
+	.long	0xab
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x15
+	.byte	0x27
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2295
+	.byte	0x15
+	.byte	0x28
+	.byte	0x3
+	.long	0xc3d
+	.uleb128 0x4
+	.long	.LASF2296
+	.byte	0x15
+	.byte	0x2b
+	.byte	0x10
+	.long	0xc97
+	.uleb128 0x5
+	.long	0xc9c
+	.uleb128 0x11
+	.long	0xca7
+	.uleb128 0x3
+	.long	0xca7
+	.byte	0
+	.uleb128 0x5
+	.long	0x8d8
+	.uleb128 0x4
+	.long	.LASF2297
+	.byte	0x15
+	.byte	0x2c
+	.byte	0x17
+	.long	0xcb8
+	.uleb128 0x5
+	.long	0xcbd
+	.uleb128 0x13
+	.long	0xc31
+	.long	0xcd6
+	.uleb128 0x3
+	.long	0xcd6
+	.uleb128 0x3
+	.long	0xcd6
+	.uleb128 0x3
+	.long	0xcdb
+	.byte	0
+	.uleb128 0x5
+	.long	0xc7f
+	.uleb128 0x5
+	.long	0xc8b
+	.uleb128 0x4
+	.long	.LASF2298
+	.byte	0x15
+	.byte	0x2d
+	.byte	0x10
+	.long	0xcec
+	.uleb128 0x5
+	.long	0xcf1
+	.uleb128 0x11
+	.long	0xcfc
+	.uleb128 0x3
+	.long	0xcd6
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x16
+	.byte	0x18
+	.long	0xded
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x25
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2338
+	.byte	0x17
+	.byte	0x1b
+	.byte	0xc
+	.long	0x238
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x18
+	.byte	0x15
+	.long	0xe12
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2341
+	.byte	0x18
+	.byte	0x1a
+	.byte	0x10
+	.long	0x1c9
+	.uleb128 0xb
+	.long	.LASF2342
+	.byte	0x19
+	.byte	0x14
+	.byte	0x10
+	.long	0x1c9
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x1a
+	.byte	0x25
+	.long	0xe79
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0xa
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2355
+	.byte	0x1a
+	.byte	0x79
+	.byte	0x5
+	.long	0x238
+	.uleb128 0xb
+	.long	.LASF2356
+	.byte	0x1a
+	.byte	0x7a
+	.byte	0x11
+	.long	0x1eb
+	.uleb128 0x6
+	.long	.LASF2357
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x7c
+	.byte	0x10
+	.long	0xeac
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x1b
+	.byte	0x7d
+	.byte	0xd
+	.long	0xeac
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1c9
+	.long	0xebc
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2359
+	.byte	0x1b
+	.byte	0x7e
+	.byte	0x3
+	.long	0xe91
+	.uleb128 0xc
+	.long	0xebc
+	.uleb128 0x6
+	.long	.LASF2360
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x80
+	.byte	0x10
+	.long	0xee8
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x1b
+	.byte	0x81
+	.byte	0xd
+	.long	0xee8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1c9
+	.long	0xef8
+	.uleb128 0xe
+	.long	0x22
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2361
+	.byte	0x1b
+	.byte	0x82
+	.byte	0x3
+	.long	0xecd
+	.uleb128 0x18
+	.long	.LASF2362
+	.byte	0x1b
+	.byte	0x99
+	.byte	0xd
+	.long	0xf10
+	.uleb128 0x5
+	.long	0x342
+	.uleb128 0x18
+	.long	.LASF2363
+	.byte	0x1b
+	.byte	0x9a
+	.byte	0x1b
+	.long	0xf21
+	.uleb128 0x5
+	.long	0xec8
+	.uleb128 0x18
+	.long	.LASF2364
+	.byte	0x1b
+	.byte	0x9b
+	.byte	0x17
+	.long	0xef8
+	.uleb128 0x8
+	.byte	0x5
+	.long	0x29
+	.byte	0x1c
+	.byte	0x48
+	.long	0xf87
+	.uleb128 0x1b
+	.long	.LASF2365
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2377
+	.byte	0x1c
+	.byte	0x55
+	.byte	0x3
+	.long	0xf32
+	.uleb128 0x6
+	.long	.LASF2378
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x6c
+	.byte	0x10
+	.long	0xfef
+	.uleb128 0x2
+	.long	.LASF2379
+	.byte	0x1c
+	.byte	0x6d
+	.byte	0xe
+	.long	0x1df
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0x1c
+	.byte	0x6e
+	.byte	0x1c
+	.long	0xf87
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2380
+	.byte	0x1c
+	.byte	0x6f
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2381
+	.byte	0x1c
+	.byte	0x70
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2382
+	.byte	0x1c
+	.byte	0x71
+	.byte	0xd
+	.long	0x1c9
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2383
+	.byte	0x1c
+	.byte	0x72
+	.byte	0xd
+	.long	0x1c9
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2384
+	.byte	0x1c
+	.byte	0x73
+	.byte	0x3
+	.long	0xf93
+	.uleb128 0x6
+	.long	.LASF2385
+	.byte	0x64
+	.byte	0x1c
+	.byte	0x75
+	.byte	0x10
+	.long	0x1030
+	.uleb128 0x2
+	.long	.LASF2386
+	.byte	0x1c
+	.byte	0x76
+	.byte	0x18
+	.long	0x1030
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2387
+	.byte	0x1c
+	.byte	0x77
+	.byte	0xe
+	.long	0x1df
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2388
+	.byte	0x1c
+	.byte	0x78
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x62
+	.byte	0
+	.uleb128 0xd
+	.long	0xfef
+	.long	0x1040
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2389
+	.byte	0x1c
+	.byte	0x79
+	.byte	0x3
+	.long	0xffb
+	.uleb128 0xc
+	.long	0x1040
+	.uleb128 0xb
+	.long	.LASF2390
+	.byte	0x1c
+	.byte	0x7b
+	.byte	0x17
+	.long	0x1040
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x1d
+	.byte	0x34
+	.long	0x1076
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2393
+	.byte	0x1d
+	.byte	0x37
+	.byte	0x3
+	.long	0x105d
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x1e
+	.byte	0x2f
+	.long	0x10d7
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2406
+	.byte	0x2c
+	.byte	0x1e
+	.byte	0x75
+	.byte	0x10
+	.long	0x122a
+	.uleb128 0x2
+	.long	.LASF2407
+	.byte	0x1e
+	.byte	0x76
+	.byte	0xd
+	.long	0x122a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0x1e
+	.byte	0x77
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0x1e
+	.byte	0x78
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0x1e
+	.byte	0x79
+	.byte	0xd
+	.long	0x1c9
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0x1e
+	.byte	0x7a
+	.byte	0xd
+	.long	0x1c9
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2412
+	.byte	0x1e
+	.byte	0x7b
+	.byte	0xe
+	.long	0x1eb
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2413
+	.byte	0x1e
+	.byte	0x7c
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2414
+	.byte	0x1e
+	.byte	0x7d
+	.byte	0xd
+	.long	0x48b
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2415
+	.byte	0x1e
+	.byte	0x7e
+	.byte	0xd
+	.long	0x48b
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2416
+	.byte	0x1e
+	.byte	0x7f
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2417
+	.byte	0x1e
+	.byte	0x80
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0x1e
+	.byte	0x81
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2419
+	.byte	0x1e
+	.byte	0x82
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0x1e
+	.byte	0x83
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2421
+	.byte	0x1e
+	.byte	0x84
+	.byte	0xe
+	.long	0x1df
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2422
+	.byte	0x1e
+	.byte	0x85
+	.byte	0xe
+	.long	0x1df
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2423
+	.byte	0x1e
+	.byte	0x86
+	.byte	0xe
+	.long	0x1df
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2424
+	.byte	0x1e
+	.byte	0x87
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2425
+	.byte	0x1e
+	.byte	0x88
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2426
+	.byte	0x1e
+	.byte	0x89
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0x1e
+	.byte	0x8a
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0x1e
+	.byte	0x8b
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0x1e
+	.byte	0x8c
+	.byte	0xe
+	.long	0x1df
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0x1e
+	.byte	0x8e
+	.byte	0xe
+	.long	0x1df
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0x1e
+	.byte	0x8f
+	.byte	0xe
+	.long	0x1df
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x1c9
+	.long	0x123a
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2432
+	.byte	0x1e
+	.byte	0x90
+	.byte	0x3
+	.long	0x10d7
+	.uleb128 0xc
+	.long	0x123a
+	.uleb128 0xb
+	.long	.LASF2433
+	.byte	0x1e
+	.byte	0x92
+	.byte	0x13
+	.long	0x123a
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x1f
+	.byte	0x14
+	.long	0x1282
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2439
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x1e
+	.byte	0x10
+	.long	0x12b7
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x1f
+	.byte	0x1f
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0x1f
+	.byte	0x20
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x10
+	.string	"yaw"
+	.byte	0x1f
+	.byte	0x21
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2442
+	.byte	0x1f
+	.byte	0x22
+	.byte	0x3
+	.long	0x1282
+	.uleb128 0x1f
+	.long	.LASF2444
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x24
+	.long	0x12e8
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x1f
+	.byte	0x25
+	.byte	0xd
+	.long	0x6e1
+	.uleb128 0x17
+	.long	.LASF2445
+	.byte	0x1f
+	.byte	0x26
+	.byte	0x1f
+	.long	0x12b7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2446
+	.byte	0x1f
+	.byte	0x27
+	.byte	0x3
+	.long	0x12c3
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x1f
+	.byte	0x2d
+	.long	0x132b
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2454
+	.byte	0xa0
+	.byte	0x20
+	.byte	0x2c
+	.byte	0x10
+	.long	0x136d
+	.uleb128 0x10
+	.string	"dev"
+	.byte	0x20
+	.byte	0x2d
+	.byte	0xe
+	.long	0x701
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2455
+	.byte	0x20
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1eb
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2456
+	.byte	0x20
+	.byte	0x2f
+	.byte	0xd
+	.long	0x6f1
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF2457
+	.byte	0x20
+	.byte	0x30
+	.byte	0x9
+	.long	0x238
+	.byte	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2458
+	.byte	0x20
+	.byte	0x31
+	.byte	0x3
+	.long	0x132b
+	.uleb128 0x29
+	.string	"acc"
+	.byte	0x20
+	.byte	0x33
+	.byte	0xe
+	.long	0x136d
+	.uleb128 0x6
+	.long	.LASF2459
+	.byte	0x4
+	.byte	0x20
+	.byte	0x35
+	.byte	0x10
+	.long	0x13ad
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x20
+	.byte	0x36
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0x20
+	.byte	0x37
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2460
+	.byte	0x20
+	.byte	0x38
+	.byte	0x3
+	.long	0x1385
+	.uleb128 0x1f
+	.long	.LASF2461
+	.byte	0x4
+	.byte	0x20
+	.byte	0x3a
+	.long	0x13de
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x20
+	.byte	0x3b
+	.byte	0xd
+	.long	0x13de
+	.uleb128 0x17
+	.long	.LASF2445
+	.byte	0x20
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x13ad
+	.byte	0
+	.uleb128 0xd
+	.long	0xab
+	.long	0x13ee
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2462
+	.byte	0x20
+	.byte	0x3d
+	.byte	0x3
+	.long	0x13b9
+	.uleb128 0x6
+	.long	.LASF2463
+	.byte	0x14
+	.byte	0x20
+	.byte	0x40
+	.byte	0x10
+	.long	0x1449
+	.uleb128 0x2
+	.long	.LASF2464
+	.byte	0x20
+	.byte	0x41
+	.byte	0xe
+	.long	0x1df
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2465
+	.byte	0x20
+	.byte	0x42
+	.byte	0x14
+	.long	0x3a1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2466
+	.byte	0x20
+	.byte	0x43
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0x20
+	.byte	0x44
+	.byte	0x1b
+	.long	0x12e8
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0x20
+	.byte	0x45
+	.byte	0x19
+	.long	0x13ee
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2469
+	.byte	0x20
+	.byte	0x46
+	.byte	0x3
+	.long	0x13fa
+	.uleb128 0xb
+	.long	.LASF2470
+	.byte	0x20
+	.byte	0x48
+	.byte	0x1e
+	.long	0x1449
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x21
+	.byte	0x17
+	.long	0x1492
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2477
+	.byte	0x21
+	.byte	0x1e
+	.byte	0x3
+	.long	0x1461
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x22
+	.byte	0x1a
+	.long	0x14bd
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2481
+	.byte	0x22
+	.byte	0x1e
+	.byte	0x3
+	.long	0x149e
+	.uleb128 0x6
+	.long	.LASF2482
+	.byte	0x14
+	.byte	0x23
+	.byte	0x1b
+	.byte	0x10
+	.long	0x1566
+	.uleb128 0x2
+	.long	.LASF2483
+	.byte	0x23
+	.byte	0x1d
+	.byte	0xd
+	.long	0x1c9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0x23
+	.byte	0x1e
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x23
+	.byte	0x1f
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x23
+	.byte	0x20
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0x23
+	.byte	0x22
+	.byte	0x1a
+	.long	0x14bd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2488
+	.byte	0x23
+	.byte	0x25
+	.byte	0x1a
+	.long	0x1492
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0x23
+	.byte	0x26
+	.byte	0xe
+	.long	0x1df
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0x23
+	.byte	0x29
+	.byte	0x9
+	.long	0x238
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2491
+	.byte	0x23
+	.byte	0x2a
+	.byte	0x9
+	.long	0x238
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2492
+	.byte	0x23
+	.byte	0x2b
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2493
+	.byte	0x23
+	.byte	0x2c
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2494
+	.byte	0x23
+	.byte	0x2d
+	.byte	0x3
+	.long	0x14c9
+	.uleb128 0xc
+	.long	0x1566
+	.uleb128 0xb
+	.long	.LASF2495
+	.byte	0x23
+	.byte	0x2f
+	.byte	0x18
+	.long	0x1566
+	.uleb128 0x6
+	.long	.LASF2496
+	.byte	0x10
+	.byte	0x24
+	.byte	0x2a
+	.byte	0x10
+	.long	0x15d2
+	.uleb128 0x2
+	.long	.LASF2497
+	.byte	0x24
+	.byte	0x2b
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2498
+	.byte	0x24
+	.byte	0x2d
+	.byte	0x14
+	.long	0x3a1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2499
+	.byte	0x24
+	.byte	0x2e
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0x24
+	.byte	0x2f
+	.byte	0xd
+	.long	0x48b
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0x24
+	.byte	0x30
+	.byte	0x1b
+	.long	0x12e8
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2502
+	.byte	0x24
+	.byte	0x31
+	.byte	0x3
+	.long	0x1583
+	.uleb128 0xb
+	.long	.LASF2503
+	.byte	0x24
+	.byte	0x33
+	.byte	0x18
+	.long	0x15d2
+	.uleb128 0x6
+	.long	.LASF2504
+	.byte	0x10
+	.byte	0x25
+	.byte	0x40
+	.byte	0x10
+	.long	0x1612
+	.uleb128 0x2
+	.long	.LASF2505
+	.byte	0x25
+	.byte	0x41
+	.byte	0xe
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2506
+	.byte	0x25
+	.byte	0x42
+	.byte	0xb
+	.long	0x34e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2507
+	.byte	0x25
+	.byte	0x43
+	.byte	0x3
+	.long	0x15ea
+	.uleb128 0xb
+	.long	.LASF2508
+	.byte	0x25
+	.byte	0x45
+	.byte	0xf
+	.long	0x1612
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x26
+	.byte	0x16
+	.long	0x1661
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x40
+	.byte	0x26
+	.byte	0x28
+	.long	0x1684
+	.uleb128 0x2
+	.long	.LASF2516
+	.byte	0x26
+	.byte	0x29
+	.byte	0xe
+	.long	0x1684
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2517
+	.byte	0x26
+	.byte	0x2a
+	.byte	0xe
+	.long	0x1684
+	.byte	0x20
+	.byte	0
+	.uleb128 0xd
+	.long	0x1df
+	.long	0x1694
+	.uleb128 0xe
+	.long	0x22
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2518
+	.byte	0x26
+	.byte	0x2b
+	.byte	0x3
+	.long	0x1661
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x4c
+	.byte	0x26
+	.byte	0x3e
+	.long	0x172b
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2534
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2535
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2536
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2538
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2540
+	.byte	0x26
+	.byte	0x8f
+	.byte	0x3
+	.long	0x16a0
+	.uleb128 0x1d
+	.byte	0x88
+	.byte	0x26
+	.byte	0x9a
+	.long	0x1810
+	.uleb128 0x2
+	.long	.LASF2541
+	.byte	0x26
+	.byte	0x9c
+	.byte	0x12
+	.long	0x2ef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2542
+	.byte	0x26
+	.byte	0x9d
+	.byte	0x12
+	.long	0x2ef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2543
+	.byte	0x26
+	.byte	0x9e
+	.byte	0xb
+	.long	0x1824
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2544
+	.byte	0x26
+	.byte	0x9f
+	.byte	0xc
+	.long	0x1834
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2545
+	.byte	0x26
+	.byte	0xa0
+	.byte	0x11
+	.long	0x23f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2546
+	.byte	0x26
+	.byte	0xa1
+	.byte	0x13
+	.long	0x1d5
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2547
+	.byte	0x26
+	.byte	0xa4
+	.byte	0xe
+	.long	0x1df
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2548
+	.byte	0x26
+	.byte	0xa5
+	.byte	0xe
+	.long	0x1df
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2549
+	.byte	0x26
+	.byte	0xa6
+	.byte	0x11
+	.long	0x23f
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2550
+	.byte	0x26
+	.byte	0xa7
+	.byte	0xe
+	.long	0x24b
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x26
+	.byte	0xa8
+	.byte	0xe
+	.long	0x24b
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2552
+	.byte	0x26
+	.byte	0xb0
+	.byte	0xe
+	.long	0x24b
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2553
+	.byte	0x26
+	.byte	0xb1
+	.byte	0xe
+	.long	0x24b
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2554
+	.byte	0x26
+	.byte	0xb2
+	.byte	0xe
+	.long	0x24b
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2555
+	.byte	0x26
+	.byte	0xb4
+	.byte	0xe
+	.long	0x24b
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2556
+	.byte	0x26
+	.byte	0xb5
+	.byte	0x17
+	.long	0x1694
+	.byte	0x48
+	.byte	0
+	.uleb128 0x13
+	.long	0x238
+	.long	0x1824
+	.uleb128 0x3
+	.long	0x24b
+	.uleb128 0x3
+	.long	0x23f
+	.byte	0
+	.uleb128 0x5
+	.long	0x1810
+	.uleb128 0x11
+	.long	0x1834
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x5
+	.long	0x1829
+	.uleb128 0x4
+	.long	.LASF2557
+	.byte	0x26
+	.byte	0xb8
+	.byte	0x3
+	.long	0x1737
+	.uleb128 0xd
+	.long	0x1839
+	.long	0x1855
+	.uleb128 0xe
+	.long	0x22
+	.byte	0x11
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2558
+	.byte	0x26
+	.byte	0xba
+	.byte	0x11
+	.long	0x1845
+	.uleb128 0x2a
+	.long	0x1855
+	.byte	0x31
+	.value	0x19d
+	.byte	0xa
+	.uleb128 0x7
+	.long	.LASF2561
+	.byte	0x20
+	.byte	0x4e
+	.long	0x187b
+	.uleb128 0x3
+	.long	0x187b
+	.byte	0
+	.uleb128 0x5
+	.long	0x13ee
+	.uleb128 0x12
+	.long	.LASF2559
+	.byte	0x27
+	.byte	0x23
+	.uleb128 0x12
+	.long	.LASF2560
+	.byte	0x17
+	.byte	0x2f
+	.uleb128 0x7
+	.long	.LASF2562
+	.byte	0x17
+	.byte	0x2e
+	.long	0x189f
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2563
+	.byte	0x28
+	.byte	0x23
+	.long	0x18b0
+	.uleb128 0x3
+	.long	0xcd6
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2581
+	.byte	0x28
+	.byte	0x22
+	.byte	0xd
+	.long	0xc31
+	.long	0x18d0
+	.uleb128 0x3
+	.long	0xcd6
+	.uleb128 0x3
+	.long	0xcd6
+	.uleb128 0x3
+	.long	0xcdb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2564
+	.byte	0x1d
+	.byte	0x59
+	.long	0x18eb
+	.uleb128 0x3
+	.long	0x1076
+	.uleb128 0x3
+	.long	0xcac
+	.uleb128 0x3
+	.long	0xce0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2565
+	.byte	0x19
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF2566
+	.byte	0x24
+	.byte	0x37
+	.long	0x1908
+	.uleb128 0x3
+	.long	0x1eb
+	.uleb128 0x3
+	.long	0x1908
+	.byte	0
+	.uleb128 0x5
+	.long	0x12c3
+	.uleb128 0x19
+	.long	.LASF2568
+	.byte	0x29
+	.byte	0x36
+	.byte	0xa
+	.long	0x1eb
+	.uleb128 0x7
+	.long	.LASF2567
+	.byte	0x27
+	.byte	0x1e
+	.long	0x192a
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2569
+	.byte	0x29
+	.byte	0x37
+	.byte	0x5
+	.long	0x238
+	.uleb128 0x7
+	.long	.LASF2570
+	.byte	0x2a
+	.byte	0x41
+	.long	0x1947
+	.uleb128 0x3
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2571
+	.byte	0x25
+	.byte	0x72
+	.uleb128 0x12
+	.long	.LASF2572
+	.byte	0x2a
+	.byte	0x40
+	.uleb128 0x7
+	.long	.LASF2573
+	.byte	0x9
+	.byte	0x3a
+	.long	0x1966
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2574
+	.byte	0x2b
+	.byte	0x43
+	.long	0x1977
+	.uleb128 0x3
+	.long	0x238
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2575
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x5
+	.long	0x238
+	.uleb128 0x7
+	.long	.LASF2576
+	.byte	0x2c
+	.byte	0x32
+	.long	0x1994
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2577
+	.byte	0x2d
+	.byte	0x85
+	.long	0x19a5
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2578
+	.byte	0x23
+	.byte	0x4e
+	.long	0x19b6
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2579
+	.byte	0x23
+	.byte	0x39
+	.long	0x19c7
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2580
+	.byte	0x2e
+	.byte	0x1f
+	.long	0x19d8
+	.uleb128 0x3
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2582
+	.byte	0x1e
+	.byte	0xa2
+	.byte	0x5
+	.long	0x238
+	.long	0x19f3
+	.uleb128 0x3
+	.long	0x24b
+	.uleb128 0x3
+	.long	0x23f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2583
+	.byte	0x2f
+	.byte	0x46
+	.long	0x1a04
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2584
+	.byte	0x17
+	.byte	0x34
+	.long	0x1a15
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2585
+	.byte	0x17
+	.byte	0x33
+	.byte	0x5
+	.long	0x238
+	.long	0x1a30
+	.uleb128 0x3
+	.long	0x24b
+	.uleb128 0x3
+	.long	0x23f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2586
+	.byte	0x17
+	.byte	0x32
+	.long	0x1a41
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2587
+	.byte	0x25
+	.byte	0x65
+	.byte	0x5
+	.long	0x238
+	.long	0x1a5c
+	.uleb128 0x3
+	.long	0x24b
+	.uleb128 0x3
+	.long	0x23f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2588
+	.byte	0x26
+	.byte	0xcc
+	.long	0x1a6d
+	.uleb128 0x3
+	.long	0x24b
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2589
+	.byte	0x2e
+	.byte	0x1d
+	.byte	0x5
+	.long	0x238
+	.uleb128 0x16
+	.long	.LASF2590
+	.byte	0x30
+	.byte	0x1e
+	.byte	0x5
+	.long	0x238
+	.long	0x1a8f
+	.uleb128 0x3
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2591
+	.byte	0x26
+	.byte	0xc0
+	.long	0x1aa5
+	.uleb128 0x3
+	.long	0x172b
+	.uleb128 0x3
+	.long	0x238
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2592
+	.byte	0x26
+	.byte	0xbf
+	.long	0x1abb
+	.uleb128 0x3
+	.long	0x172b
+	.uleb128 0x3
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2593
+	.byte	0x18
+	.byte	0x69
+	.byte	0x5
+	.long	0x238
+	.long	0x1ad1
+	.uleb128 0x3
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2594
+	.byte	0x26
+	.byte	0xc9
+	.uleb128 0x12
+	.long	.LASF2595
+	.byte	0x23
+	.byte	0x40
+	.uleb128 0x12
+	.long	.LASF2596
+	.byte	0x23
+	.byte	0x3f
+	.uleb128 0x12
+	.long	.LASF2597
+	.byte	0x23
+	.byte	0x3a
+	.uleb128 0x19
+	.long	.LASF2598
+	.byte	0x1d
+	.byte	0x58
+	.byte	0x5
+	.long	0x238
+	.uleb128 0x2b
+	.long	.LASF2610
+	.byte	0x31
+	.value	0x12d
+	.byte	0x6
+	.long	0x1b28
+	.uleb128 0x20
+	.long	.LASF2599
+	.value	0x145
+	.long	0x238
+	.uleb128 0x20
+	.long	.LASF2600
+	.value	0x147
+	.long	0x238
+	.uleb128 0x20
+	.long	.LASF2601
+	.value	0x14a
+	.long	0x238
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2602
+	.byte	0xed
+	.long	0x1b3e
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0xed
+	.byte	0x23
+	.long	0x24b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2603
+	.byte	0xd6
+	.long	0x1b54
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0xd6
+	.byte	0x24
+	.long	0x24b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2605
+	.byte	0xc7
+	.long	0x1b6a
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0xc7
+	.byte	0x2c
+	.long	0x24b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2606
+	.byte	0xb9
+	.long	0x1b8d
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0xb9
+	.byte	0x25
+	.long	0x24b
+	.uleb128 0x2c
+	.uleb128 0x21
+	.long	.LASF2607
+	.byte	0xbe
+	.byte	0x18
+	.long	0x1f7
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2608
+	.byte	0xb0
+	.long	0x1ba3
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0xb0
+	.byte	0x28
+	.long	0x24b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2609
+	.byte	0x96
+	.long	0x1bb9
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0x96
+	.byte	0x27
+	.long	0x24b
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2611
+	.byte	0x31
+	.byte	0x88
+	.byte	0x6
+	.long	0x1bd1
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0x88
+	.byte	0x21
+	.long	0x24b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2612
+	.byte	0x76
+	.long	0x1bf2
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0x76
+	.byte	0x27
+	.long	0x24b
+	.uleb128 0x21
+	.long	.LASF2613
+	.byte	0x81
+	.byte	0x9
+	.long	0x238
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2614
+	.byte	0x31
+	.byte	0x6f
+	.byte	0x5
+	.long	0x238
+	.long	0x1c19
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0x6f
+	.byte	0x1e
+	.long	0x24b
+	.uleb128 0xf
+	.long	.LASF2615
+	.byte	0x6f
+	.byte	0x39
+	.long	0x23f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2616
+	.byte	0x67
+	.long	0x1c2f
+	.uleb128 0xf
+	.long	.LASF2604
+	.byte	0x67
+	.byte	0x2e
+	.long	0x24b
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2617
+	.byte	0x24
+	.byte	0x33
+	.byte	0xd3
+	.long	0x1c3b
+	.uleb128 0x5
+	.long	0x15d2
+	.uleb128 0x1a
+	.long	.LASF2618
+	.byte	0x23
+	.byte	0x2f
+	.byte	0x7e
+	.long	0x1c4c
+	.uleb128 0x5
+	.long	0x1572
+	.uleb128 0x2f
+	.long	.LASF2619
+	.byte	0x20
+	.byte	0x48
+	.value	0x103
+	.long	0x1c5e
+	.uleb128 0x5
+	.long	0x1449
+	.uleb128 0x1a
+	.long	.LASF2620
+	.byte	0x1e
+	.byte	0x92
+	.byte	0x65
+	.long	0x1c6f
+	.uleb128 0x5
+	.long	0x1246
+	.uleb128 0x1a
+	.long	.LASF2621
+	.byte	0x1c
+	.byte	0x7b
+	.byte	0x79
+	.long	0x1c80
+	.uleb128 0x5
+	.long	0x104c
+	.uleb128 0x1a
+	.long	.LASF2622
+	.byte	0x9
+	.byte	0x35
+	.byte	0x83
+	.long	0x1c91
+	.uleb128 0x5
+	.long	0x2de
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 50 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 51 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 52 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 54 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 55 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF455
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 58 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF528
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF546
+	.file 60 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x3c
+	.file 61 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF612
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF648
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF528
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 67 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF676
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF677
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF455
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF737
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF753
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF754
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF569
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF755
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF756
+	.file 74 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF757
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF774
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF787
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF795
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF796
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF814
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF815
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF827
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF834
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF835
+	.byte	0x4
+	.byte	0x4
+	.file 88 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF839
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x59
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x4
+	.file 91 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5b
+	.file 92 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF844
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF907
+	.byte	0x4
+	.file 94 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5e
+	.file 95 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 96 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.file 97 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1065
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1066
+	.byte	0x4
+	.file 98 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x62
+	.file 99 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.file 100 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x64
+	.file 101 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 102 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 103 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 104 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 105 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x69
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 106 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x30
+	.byte	0x4
+	.file 107 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.file 108 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6c
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.file 109 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 110 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1330
+	.file 111 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1336
+	.byte	0x4
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 115 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1369
+	.byte	0x4
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x76
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1370
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1371
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x78
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1372
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1373
+	.byte	0x4
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1374
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1375
+	.byte	0x4
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7b
+	.file 124 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1376
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 125 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x7d
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1407
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x12
+	.file 126 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7e
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 127 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x7f
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 128 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x80
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1798
+	.byte	0x4
+	.file 129 "./src/main/drivers/stack_check.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x81
+	.byte	0x4
+	.file 130 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x82
+	.byte	0x4
+	.file 131 "./src/main/drivers/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x13
+	.file 132 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x84
+	.byte	0x4
+	.file 133 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x85
+	.byte	0x4
+	.file 134 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 135 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x87
+	.byte	0x4
+	.file 136 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x88
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 137 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x89
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1834
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x4
+	.file 138 "./src/main/fc/fc_tasks.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x8a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1843
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x17
+	.byte	0x4
+	.file 139 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x8b
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x2f
+	.byte	0x4
+	.file 140 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x8c
+	.file 141 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8d
+	.file 142 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8e
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1871
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 143 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x8f
+	.file 144 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x90
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x4
+	.file 145 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x91
+	.byte	0x4
+	.file 146 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x92
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.file 147 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x93
+	.byte	0x4
+	.file 148 "./src/main/io/osd_slave.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x94
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 149 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x95
+	.byte	0x4
+	.file 150 "./src/main/io/vtx_tramp.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x29
+	.file 151 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x97
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2015
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2016
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.file 152 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x98
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x22
+	.file 153 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x99
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 154 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x9a
+	.file 155 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9b
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2028
+	.byte	0x4
+	.file 156 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x9c
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2036
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2042
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF466
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF545
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF566
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF647
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF736
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF773
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF786
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF808
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF812
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF830
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF838
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF566
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF843
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF967
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF969
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF998
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1000
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1004
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1008
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1014
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1017
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.3217b4575ccf3c370ae0b5186c11b495,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1105
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1109
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1140
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1233
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1239
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1329
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1353
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1368
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1406
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1417
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1429
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.transponder_ir.h.23.b50bed893bc0dbf7b1e0fb37ef14e2d7,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1830
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1842
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1877
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dashboard.h.22.499b1990b01ce2b674fe8b48758244f0,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.21.42b0efe26f2c975d82840e6ab4f40d87,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1986
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2011
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2014
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2027
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.37.6498376d1e1396b14288709c9edf6d99,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2031
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcsplit.h.35.60cb2b54a6da895dfd971417785ff508,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2039
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1c
+	.long	.LASF1
+	.long	.LASF2624
+	.long	.LASF2625
+	.long	.LASF2626
+	.long	.LASF2627
+	.long	.LASF2628
+	.long	.LASF2629
+	.long	.LASF2630
+	.long	.LASF2631
+	.long	.LASF2632
+	.long	.LASF2633
+	.long	.LASF2634
+	.long	.LASF2635
+	.long	.LASF2636
+	.long	.LASF2637
+	.long	.LASF2638
+	.long	.LASF2639
+	.long	.LASF2640
+	.long	.LASF2641
+	.long	.LASF2642
+	.long	.LASF2643
+	.long	.LASF2644
+	.long	.LASF2645
+	.long	.LASF2646
+	.long	.LASF2647
+	.long	.LASF2648
+	.long	.LASF2649
+	.long	.LASF2650
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x9d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2651
+	.byte	0x17
+	.long	.LASF2652
+	.byte	0x17
+	.long	.LASF2653
+	.byte	0x17
+	.long	.LASF2654
+	.byte	0x17
+	.long	.LASF2655
+	.byte	0x17
+	.long	.LASF2656
+	.byte	0x17
+	.long	.LASF2657
+	.byte	0x12
+	.long	.LASF2658
+	.byte	0x4
+	.long	.LASF2659
+	.byte	0x1
+	.long	.LASF2660
+	.byte	0x4
+	.long	.LASF2661
+	.byte	0x9
+	.long	.LASF2662
+	.byte	0x6
+	.long	.LASF2663
+	.byte	0x9
+	.long	.LASF2664
+	.byte	0x9
+	.long	.LASF2665
+	.byte	0x9
+	.long	.LASF2666
+	.byte	0x6
+	.long	.LASF2667
+	.byte	0x9
+	.long	.LASF2668
+	.byte	0x9
+	.long	.LASF2669
+	.byte	0xa
+	.long	.LASF2670
+	.byte	0x4
+	.long	.LASF2671
+	.byte	0xe
+	.long	.LASF2672
+	.byte	0xa
+	.long	.LASF2673
+	.byte	0xa
+	.long	.LASF2674
+	.byte	0xa
+	.long	.LASF2675
+	.byte	0xa
+	.long	.LASF2676
+	.byte	0xb
+	.long	.LASF2677
+	.byte	0xd
+	.long	.LASF2668
+	.byte	0xd
+	.long	.LASF2678
+	.byte	0xe
+	.long	.LASF2679
+	.byte	0xf
+	.long	.LASF2680
+	.byte	0x11
+	.long	.LASF2681
+	.byte	0x11
+	.long	.LASF2682
+	.byte	0x11
+	.long	.LASF2683
+	.byte	0x11
+	.long	.LASF2684
+	.byte	0x11
+	.long	.LASF2685
+	.byte	0x11
+	.long	.LASF2686
+	.byte	0x11
+	.long	.LASF2687
+	.byte	0x10
+	.long	.LASF2688
+	.byte	0xb
+	.long	.LASF2689
+	.byte	0xa
+	.long	.LASF2690
+	.byte	0x11
+	.long	.LASF2691
+	.byte	0x14
+	.long	.LASF2692
+	.byte	0xd
+	.long	.LASF2693
+	.byte	0xd
+	.long	.LASF2694
+	.byte	0xd
+	.long	.LASF2695
+	.byte	0xa
+	.long	.LASF2696
+	.byte	0xb
+	.long	.LASF2697
+	.byte	0x5
+	.long	.LASF2698
+	.byte	0xa
+	.long	.LASF2699
+	.byte	0x1a
+	.long	.LASF2700
+	.byte	0x1b
+	.long	.LASF2701
+	.byte	0x1a
+	.long	.LASF2702
+	.byte	0x17
+	.long	.LASF2703
+	.byte	0x1a
+	.long	.LASF2704
+	.byte	0x1a
+	.long	.LASF2705
+	.byte	0x17
+	.long	.LASF2706
+	.byte	0x17
+	.long	.LASF2707
+	.byte	0x19
+	.long	.LASF2708
+	.byte	0x17
+	.long	.LASF2709
+	.byte	0x18
+	.long	.LASF2710
+	.byte	0x18
+	.long	.LASF2711
+	.byte	0x1b
+	.long	.LASF2712
+	.byte	0x17
+	.long	.LASF2713
+	.byte	0x17
+	.long	.LASF2714
+	.byte	0x17
+	.long	.LASF2715
+	.byte	0x17
+	.long	.LASF2651
+	.byte	0x19
+	.long	.LASF2716
+	.byte	0x17
+	.long	.LASF2717
+	.byte	0x17
+	.long	.LASF2718
+	.byte	0x16
+	.long	.LASF2719
+	.byte	0x16
+	.long	.LASF2720
+	.byte	0x16
+	.long	.LASF2721
+	.byte	0x16
+	.long	.LASF2722
+	.byte	0x1a
+	.long	.LASF2722
+	.byte	0x17
+	.long	.LASF2723
+	.byte	0x17
+	.long	.LASF2724
+	.byte	0x17
+	.long	.LASF2725
+	.byte	0x17
+	.long	.LASF2726
+	.byte	0x19
+	.long	.LASF2726
+	.byte	0x17
+	.long	.LASF2727
+	.byte	0x16
+	.long	.LASF2728
+	.byte	0x16
+	.long	.LASF2729
+	.byte	0x16
+	.long	.LASF2730
+	.byte	0x16
+	.long	.LASF2731
+	.byte	0x17
+	.long	.LASF2732
+	.byte	0x17
+	.long	.LASF2733
+	.byte	0x17
+	.long	.LASF2734
+	.byte	0x1a
+	.long	.LASF2735
+	.byte	0x17
+	.long	.LASF2736
+	.byte	0x17
+	.long	.LASF2737
+	.byte	0x1b
+	.long	.LASF2737
+	.byte	0x1a
+	.long	.LASF2738
+	.byte	0x17
+	.long	.LASF2739
+	.byte	0x15
+	.long	.LASF2740
+	.byte	0x13
+	.long	.LASF2741
+	.byte	0x13
+	.long	.LASF2742
+	.byte	0x1
+	.long	.LASF2743
+	.byte	0x5
+	.long	.LASF2744
+	.byte	0x2
+	.long	.LASF2745
+	.byte	0x3
+	.long	.LASF2746
+	.byte	0x9
+	.long	.LASF2747
+	.byte	0x2
+	.long	.LASF2748
+	.byte	0x2
+	.long	.LASF2749
+	.byte	0x4
+	.long	.LASF2750
+	.byte	0x4
+	.long	.LASF2751
+	.byte	0x4
+	.long	.LASF2752
+	.byte	0x5
+	.long	.LASF2753
+	.byte	0x9
+	.long	.LASF2754
+	.byte	0x9
+	.long	.LASF2755
+	.byte	0x1a
+	.long	.LASF2756
+	.byte	0x1a
+	.long	.LASF2756
+	.byte	0x17
+	.long	.LASF2757
+	.byte	0x16
+	.long	.LASF2758
+	.byte	0x17
+	.long	.LASF2658
+	.byte	0x1a
+	.long	.LASF2658
+	.byte	0x17
+	.long	.LASF2759
+	.byte	0x16
+	.long	.LASF2760
+	.byte	0x16
+	.long	.LASF2761
+	.byte	0x16
+	.long	.LASF2762
+	.byte	0x16
+	.long	.LASF2763
+	.byte	0x17
+	.long	.LASF2764
+	.byte	0x16
+	.long	.LASF2765
+	.byte	0x17
+	.long	.LASF2766
+	.byte	0x17
+	.long	.LASF2685
+	.byte	0x8
+	.long	.LASF2767
+	.byte	0x9
+	.long	.LASF2768
+	.byte	0x9
+	.long	.LASF2769
+	.byte	0x9
+	.long	.LASF2770
+	.byte	0x9
+	.long	.LASF2771
+	.byte	0x9
+	.long	.LASF2772
+	.byte	0x9
+	.long	.LASF2773
+	.byte	0x9
+	.long	.LASF2774
+	.byte	0x9
+	.long	.LASF2775
+	.byte	0x9
+	.long	.LASF2776
+	.byte	0x9
+	.long	.LASF2777
+	.byte	0x9
+	.long	.LASF2778
+	.byte	0x9
+	.long	.LASF2779
+	.byte	0xa
+	.long	.LASF2780
+	.byte	0xa
+	.long	.LASF2781
+	.byte	0xb
+	.long	.LASF2782
+	.byte	0x9
+	.long	.LASF2783
+	.byte	0x9
+	.long	.LASF2784
+	.byte	0xc
+	.long	.LASF2785
+	.byte	0xc
+	.long	.LASF2786
+	.byte	0xd
+	.long	.LASF2787
+	.byte	0xd
+	.long	.LASF2788
+	.byte	0xd
+	.long	.LASF2789
+	.byte	0xd
+	.long	.LASF2772
+	.byte	0xd
+	.long	.LASF2790
+	.byte	0xd
+	.long	.LASF2690
+	.byte	0x7
+	.long	.LASF2791
+	.byte	0x11
+	.long	.LASF2792
+	.byte	0x11
+	.long	.LASF2793
+	.byte	0x11
+	.long	.LASF2794
+	.byte	0x9
+	.long	.LASF2795
+	.byte	0x11
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1789:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF670:
+	.string	"__ldiv_t_defined 1"
+.LASF1343:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1143:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1113:
+	.string	"HSV_VALUE_MAX 255"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2075:
+	.string	"__align"
+.LASF2142:
+	.string	"mpuConfiguration_s"
+.LASF2146:
+	.string	"mpuConfiguration_t"
+.LASF837:
+	.string	"alloca"
+.LASF2296:
+	.string	"mspPostProcessFnPtr"
+.LASF1556:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"USE_FAKE_BARO "
+.LASF822:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF941:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2028:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1945:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF2098:
+	.string	"RGB_GREEN"
+.LASF1838:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF2425:
+	.string	"rcInterpolationChannels"
+.LASF1436:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF600:
+	.string	"_WCHAR_T_DEFINED "
+.LASF948:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1590:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2064:
+	.string	"__pthread_mutex_s"
+.LASF927:
+	.string	"USE_SERIALRX_XBUS "
+.LASF468:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF765:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2335:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF2277:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1520:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF495:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF992:
+	.string	"USE_UART7 "
+.LASF2388:
+	.string	"reboot_character"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1885:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF684:
+	.string	"__SQUAD_TYPE long int"
+.LASF1352:
+	.string	"sched_priority sched_priority"
+.LASF1002:
+	.string	"USE_PPM"
+.LASF1278:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2357:
+	.string	"modeColorIndexes_s"
+.LASF2253:
+	.string	"setMode"
+.LASF2155:
+	.string	"ICM_20602_SPI"
+.LASF456:
+	.string	"__USE_MISC 1"
+.LASF759:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF921:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1434:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1692:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1522:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1301:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1816:
+	.string	"TRANSPONDER_CARRIER_HZ_ILAP 460750"
+.LASF746:
+	.string	"__pid_t_defined "
+.LASF2499:
+	.string	"mag_hardware"
+.LASF1074:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1773:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1508:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1029:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2331:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2050:
+	.string	"__uint8_t"
+.LASF841:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1353:
+	.string	"__sched_priority sched_priority"
+.LASF2232:
+	.string	"vTable"
+.LASF1857:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2084:
+	.string	"_Bool"
+.LASF2416:
+	.string	"spektrum_sat_bind"
+.LASF1491:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1921:
+	.string	"FLASHFS_PAGE_SIZE 256"
+.LASF530:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1878:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1638:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF963:
+	.string	"SKIP_IMU_CALC "
+.LASF967:
+	.string	"U_ID_2 2"
+.LASF1121:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2604:
+	.string	"currentTimeUs"
+.LASF1913:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF804:
+	.string	"NFDBITS __NFDBITS"
+.LASF943:
+	.string	"TELEMETRY_SRXL "
+.LASF472:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1362:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2176:
+	.string	"OWNER_ADC_CURR"
+.LASF934:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF569:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF512:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1653:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1929:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1386:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF1841:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1598:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"IOCFG_AF_OD 0"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1401:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2220:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2108:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2132:
+	.string	"I2CDevice"
+.LASF2584:
+	.string	"taskMainPidLoop"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2010:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1813:
+	.string	"TRANSPONDER_TOGGLES_ILAP (TRANSPONDER_TOGGLES_PER_BIT_ILAP + TRANSPONDER_GAP_TOGGLES_ILAP)"
+.LASF1716:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1616:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1662:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2433:
+	.string	"rxConfig_System"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2289:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF2110:
+	.string	"CW270_DEG_FLIP"
+.LASF1864:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF2042:
+	.string	"TASK_PERIOD_US(us) (us)"
+.LASF618:
+	.string	"WNOWAIT 0x01000000"
+.LASF592:
+	.string	"__WCHAR_T__ "
+.LASF2420:
+	.string	"rssi_invert"
+.LASF612:
+	.string	"_STDLIB_H 1"
+.LASF1054:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1785:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2217:
+	.string	"MODE_TX"
+.LASF1190:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1544:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1950:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1182:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1624:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1608:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1757:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2527:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1321:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1732:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1703:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2173:
+	.string	"OWNER_LED"
+.LASF1147:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF493:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1792:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2267:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2144:
+	.string	"resetFn"
+.LASF2099:
+	.string	"RGB_BLUE"
+.LASF2078:
+	.string	"uint16_t"
+.LASF1570:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1931:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF734:
+	.string	"__FD_SETSIZE 1024"
+.LASF2410:
+	.string	"halfDuplex"
+.LASF2468:
+	.string	"accelerometerTrims"
+.LASF1342:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2040:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1724:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1568:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"TELEMETRY_HOTT "
+.LASF729:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1833:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1084:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1691:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2572:
+	.string	"telemetryCheckState"
+.LASF1057:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1677:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF744:
+	.string	"__uid_t_defined "
+.LASF1730:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF848:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1618:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF681:
+	.string	"__U32_TYPE unsigned int"
+.LASF1996:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1246:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1178:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF996:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1440:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1536:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF722:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF893:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2598:
+	.string	"mspSerialWaiting"
+.LASF1762:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1971:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2386:
+	.string	"portConfigs"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1525:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1944:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF743:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1136:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF377:
+	.string	"__linux 1"
+.LASF2599:
+	.string	"useBatteryVoltage"
+.LASF591:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2021:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF2616:
+	.string	"taskUpdateAccelerometer"
+.LASF1444:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1336:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1900:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF1170:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2178:
+	.string	"OWNER_ADC_RSSI"
+.LASF1844:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1748:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2007:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2321:
+	.string	"BOXSONAR"
+.LASF531:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1883:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF701:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF665:
+	.string	"__f64x(x) x ##f64x"
+.LASF2093:
+	.string	"compression"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1186:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1270:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF937:
+	.string	"CMS "
+.LASF2298:
+	.string	"mspProcessReplyFnPtr"
+.LASF435:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1284:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1834:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2345:
+	.string	"PID_YAW"
+.LASF1649:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1712:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1942:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1784:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2180:
+	.string	"OWNER_SERIAL_RX"
+.LASF730:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1807:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ARCITIMER 4500"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1993:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF491:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1039:
+	.string	"_T_PTRDIFF_ "
+.LASF637:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1452:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2609:
+	.string	"taskUpdateRxMain"
+.LASF2008:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF583:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1901:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1133:
+	.string	"BIT(x) (1 << (x))"
+.LASF2204:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1829:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1511:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2241:
+	.string	"rxBufferHead"
+.LASF878:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1877:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF2389:
+	.string	"serialConfig_t"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1010:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF787:
+	.string	"_SYS_SELECT_H 1"
+.LASF2058:
+	.string	"int32_t"
+.LASF1139:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF643:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2379:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF470:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF799:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF980:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2503:
+	.string	"compassConfig_System"
+.LASF2255:
+	.string	"beginWrite"
+.LASF1302:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF590:
+	.string	"__need_size_t"
+.LASF1567:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF602:
+	.string	"___int_wchar_t_h "
+.LASF2212:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1531:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF2516:
+	.string	"executionTime"
+.LASF1706:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1888:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF1423:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF970:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1476:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1862:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF772:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF2518:
+	.string	"cfTaskHistogram_t"
+.LASF1552:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF671:
+	.string	"__lldiv_t_defined 1"
+.LASF541:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2201:
+	.string	"OWNER_BARO_EXTI"
+.LASF1163:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1938:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1398:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF877:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2026:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF514:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF649:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1848:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2216:
+	.string	"MODE_RX"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2002:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1003:
+	.string	"USE_PWM"
+.LASF1571:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1432:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2445:
+	.string	"values"
+.LASF2545:
+	.string	"desiredPeriod"
+.LASF760:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1532:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"LED_POS_OFFSET 0"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2179:
+	.string	"OWNER_SERIAL_TX"
+.LASF547:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2304:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1183:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF949:
+	.string	"USE_SENSOR_NAMES "
+.LASF2617:
+	.string	"compassConfigMutable"
+.LASF842:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1243:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1196:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1197:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1755:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2356:
+	.string	"targetPidLooptime"
+.LASF1366:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2506:
+	.string	"gyroADCf"
+.LASF819:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF870:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1499:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2613:
+	.string	"evaluateMspData"
+.LASF2067:
+	.string	"__owner"
+.LASF1919:
+	.string	"DASHBOARD_I2C_INSTANCE I2CDEV_1"
+.LASF711:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF945:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF625:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF497:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2033:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF1743:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1981:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF783:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2454:
+	.string	"acc_s"
+.LASF2458:
+	.string	"acc_t"
+.LASF791:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2265:
+	.string	"FEATURE_FAILSAFE"
+.LASF1502:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1831:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF2481:
+	.string	"voltageMeterSource_e"
+.LASF527:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF944:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1280:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1686:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1733:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF548:
+	.string	"__stub_chflags "
+.LASF1430:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1540:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1335:
+	.string	"SCHED_RR 2"
+.LASF2314:
+	.string	"BOXLEDLOW"
+.LASF2406:
+	.string	"rxConfig_s"
+.LASF2432:
+	.string	"rxConfig_t"
+.LASF2202:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1577:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2117:
+	.string	"ADCRaw"
+.LASF2119:
+	.string	"dataReady"
+.LASF398:
+	.string	"false 0"
+.LASF2214:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF614:
+	.string	"WUNTRACED 2"
+.LASF897:
+	.string	"INT8_C(c) c"
+.LASF1086:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF587:
+	.string	"_GCC_SIZE_T "
+.LASF552:
+	.string	"__stub_setlogin "
+.LASF2292:
+	.string	"mspPacket_s"
+.LASF2065:
+	.string	"__lock"
+.LASF653:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1433:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1171:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF2301:
+	.string	"BOXHORIZON"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF554:
+	.string	"__stub_stty "
+.LASF1091:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1811:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ILAP 11"
+.LASF2415:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF1734:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2085:
+	.string	"timeDelta_t"
+.LASF2401:
+	.string	"SERIALRX_IBUS"
+.LASF1861:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2418:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2062:
+	.string	"__pthread_list_t"
+.LASF899:
+	.string	"INT32_C(c) c"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1493:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1630:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1400:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1668:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2282:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1614:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2413:
+	.string	"rx_spi_rf_channel_count"
+.LASF2124:
+	.string	"sensorAccReadFuncPtr"
+.LASF2031:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF626:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2269:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2449:
+	.string	"SENSOR_BARO"
+.LASF2147:
+	.string	"MPU_NONE"
+.LASF1955:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1979:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2355:
+	.string	"airmodeWasActivated"
+.LASF2315:
+	.string	"BOXLLIGHTS"
+.LASF645:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1125:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2184:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1021:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1892:
+	.string	"PIDSUM_LIMIT 500"
+.LASF2086:
+	.string	"timeUs_t"
+.LASF1709:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2266:
+	.string	"FEATURE_SONAR"
+.LASF458:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2001:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2428:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1175:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF693:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1219:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2464:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1234:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF2172:
+	.string	"OWNER_SERVO"
+.LASF1135:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1165:
+	.string	"PG_IMU_CONFIG 22"
+.LASF974:
+	.string	"ACC "
+.LASF2162:
+	.string	"mpu6050Resolution_e"
+.LASF2037:
+	.string	"RCSPLIT_PACKET_HEADER 0x55"
+.LASF1908:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF1250:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1974:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF1815:
+	.string	"TRANSPONDER_TIMER_MHZ_ILAP 24"
+.LASF997:
+	.string	"STACK_CHECK"
+.LASF507:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2560:
+	.string	"updateArmingStatus"
+.LASF919:
+	.string	"USE_PWM "
+.LASF739:
+	.string	"__ino_t_defined "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF769:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF999:
+	.string	"TELEMETRY_LTM"
+.LASF2621:
+	.string	"serialConfig"
+.LASF1867:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF551:
+	.string	"__stub_revoke "
+.LASF1759:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1918:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1466:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1450:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1554:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1866:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2409:
+	.string	"sbus_inversion"
+.LASF1263:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1076:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF762:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1812:
+	.string	"TRANSPONDER_GAP_TOGGLES_ILAP 1"
+.LASF1917:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF1142:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1258:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF675:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2103:
+	.string	"CW0_DEG"
+.LASF795:
+	.string	"__timeval_defined 1"
+.LASF2440:
+	.string	"roll"
+.LASF1045:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2421:
+	.string	"midrc"
+.LASF1001:
+	.string	"USE_VCP"
+.LASF879:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2014:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF2442:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1987:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2051:
+	.string	"__int16_t"
+.LASF896:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF490:
+	.string	"__flexarr []"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2053:
+	.string	"__uint16_t"
+.LASF668:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1361:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF2237:
+	.string	"rxBufferSize"
+.LASF2171:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1924:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF902:
+	.string	"UINT16_C(c) c"
+.LASF1053:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1796:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1501:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"__USE_POSIX 1"
+.LASF1317:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF1871:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2198:
+	.string	"OWNER_RX_SPI_CS"
+.LASF603:
+	.string	"__INT_WCHAR_T_H "
+.LASF741:
+	.string	"__gid_t_defined "
+.LASF2106:
+	.string	"CW270_DEG"
+.LASF1845:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1839:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1300:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF1963:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1832:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1826:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ERLT 22500"
+.LASF538:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1059:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF788:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF440:
+	.string	"_POSIX_SOURCE"
+.LASF2553:
+	.string	"maxExecutionTime"
+.LASF1827:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ERLT 5000"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2243:
+	.string	"txBufferHead"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2278:
+	.string	"FEATURE_AIRMODE"
+.LASF2411:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2234:
+	.string	"mode"
+.LASF782:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1760:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"USE_FLASHFS "
+.LASF1512:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2073:
+	.string	"__data"
+.LASF1752:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF489:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1915:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF639:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1551:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1837:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF524:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2436:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2497:
+	.string	"mag_declination"
+.LASF2435:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2452:
+	.string	"SENSOR_GPS"
+.LASF664:
+	.string	"__f32x(x) x ##f32x"
+.LASF2592:
+	.string	"rescheduleTask"
+.LASF1547:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1922:
+	.string	"FLASHFS_WRITE_BUFFER_PAGES 2"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2035:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1808:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ARCITIMER 10000"
+.LASF1242:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1573:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1881:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1359:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF2515:
+	.string	"TASK_PRIORITY_MAX"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1617:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1220:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF487:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2133:
+	.string	"deviceSpi_s"
+.LASF2294:
+	.string	"direction"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1438:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1391:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1435:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2046:
+	.string	"unsigned char"
+.LASF844:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1451:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF871:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2261:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1355:
+	.string	"_BITS_TIME_H 1"
+.LASF539:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2260:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1230:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1233:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF875:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1604:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1046:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF742:
+	.string	"__mode_t_defined "
+.LASF2076:
+	.string	"pthread_mutex_t"
+.LASF973:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF2612:
+	.string	"taskHandleSerial"
+.LASF1975:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1176:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1658:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF2412:
+	.string	"rx_spi_id"
+.LASF1159:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF972:
+	.string	"USE_FAKE_LED "
+.LASF1851:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1306:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2083:
+	.string	"float"
+.LASF2570:
+	.string	"telemetryProcess"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1154:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF1379:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF2483:
+	.string	"vbatmaxcellvoltage"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF2299:
+	.string	"BOXARM"
+.LASF1749:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1605:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2427:
+	.string	"fpvCamAngleDegrees"
+.LASF898:
+	.string	"INT16_C(c) c"
+.LASF1051:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1260:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2254:
+	.string	"writeBuf"
+.LASF1946:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF2493:
+	.string	"vbathysteresis"
+.LASF2422:
+	.string	"mincheck"
+.LASF1210:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2025:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1523:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1023:
+	.string	"VTX_COMMON"
+.LASF1412:
+	.string	"IOCFG_OUT_OD 0"
+.LASF823:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF755:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF778:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1038:
+	.string	"_PTRDIFF_T "
+.LASF2316:
+	.string	"BOXCALIB"
+.LASF1271:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF535:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2489:
+	.string	"batteryCapacity"
+.LASF767:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF2263:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1058:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1068:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2256:
+	.string	"endWrite"
+.LASF1316:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF1407:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF475:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1751:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1264:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2575:
+	.string	"blackboxIsLogging"
+.LASF1387:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF2102:
+	.string	"ALIGN_DEFAULT"
+.LASF1107:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1191:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2312:
+	.string	"BOXBEEPERON"
+.LASF434:
+	.string	"_DEFAULT_SOURCE"
+.LASF936:
+	.string	"USE_SERVOS "
+.LASF1382:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1874:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF380:
+	.string	"__unix 1"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF866:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2210:
+	.string	"OWNER_VTX"
+.LASF513:
+	.string	"__wur "
+.LASF930:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2159:
+	.string	"mpuSensor_e"
+.LASF2539:
+	.string	"TASK_SELF"
+.LASF476:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1304:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2069:
+	.string	"__kind"
+.LASF628:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1311:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1221:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1161:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2284:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2479:
+	.string	"VOLTAGE_METER_ADC"
+.LASF2423:
+	.string	"maxcheck"
+.LASF2019:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF751:
+	.string	"__clock_t_defined 1"
+.LASF1936:
+	.string	"LED_MODE_COUNT 6"
+.LASF1538:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1384:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF2474:
+	.string	"CURRENT_METER_ESC"
+.LASF599:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2558:
+	.string	"cfTasks"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2149:
+	.string	"MPU_60x0"
+.LASF1098:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1800:
+	.string	"TRANSPONDER_DATA_LENGTH_ARCITIMER 9"
+.LASF1064:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2193:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1279:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2360:
+	.string	"specialColorIndexes_s"
+.LASF2361:
+	.string	"specialColorIndexes_t"
+.LASF2036:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF798:
+	.string	"__NFDBITS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1980:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF845:
+	.string	"__intptr_t_defined "
+.LASF1129:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF853:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF864:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2529:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF529:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF631:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1189:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF486:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1576:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF553:
+	.string	"__stub_sigreturn "
+.LASF1516:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1999:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1640:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF657:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF685:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2122:
+	.string	"mpuDetectionResult"
+.LASF2512:
+	.string	"TASK_PRIORITY_MEDIUM_HIGH"
+.LASF1378:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1261:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1454:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1586:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1543:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF2477:
+	.string	"currentMeterSource_e"
+.LASF754:
+	.string	"__timer_t_defined 1"
+.LASF1485:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2150:
+	.string	"MPU_60x0_SPI"
+.LASF881:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1810:
+	.string	"TRANSPONDER_DATA_LENGTH_ILAP 6"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1984:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF2322:
+	.string	"BOXSERVO1"
+.LASF2323:
+	.string	"BOXSERVO2"
+.LASF2324:
+	.string	"BOXSERVO3"
+.LASF1313:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF654:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF874:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1028:
+	.string	"USE_SPI"
+.LASF455:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF882:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2251:
+	.string	"serialSetBaudRate"
+.LASF727:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF958:
+	.string	"USE_NAV "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2490:
+	.string	"useVBatAlerts"
+.LASF2250:
+	.string	"serialRead"
+.LASF757:
+	.string	"_ENDIAN_H 1"
+.LASF1331:
+	.string	"_SCHED_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF537:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1704:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF969:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1181:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF903:
+	.string	"UINT32_C(c) c ## U"
+.LASF2487:
+	.string	"voltageMeterSource"
+.LASF1251:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF2245:
+	.string	"rxCallback"
+.LASF1875:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1237:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF424:
+	.string	"__USE_GNU"
+.LASF1787:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF692:
+	.string	"__STD_TYPE typedef"
+.LASF1330:
+	.string	"_PTHREAD_H 1"
+.LASF2381:
+	.string	"gps_baudrateIndex"
+.LASF1217:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2080:
+	.string	"test"
+.LASF2032:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF1441:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1846:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF843:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2393:
+	.string	"mspEvaluateNonMspData_e"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2239:
+	.string	"rxBuffer"
+.LASF2540:
+	.string	"cfTaskId_e"
+.LASF1957:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF1592:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2238:
+	.string	"txBufferSize"
+.LASF1593:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2224:
+	.string	"SERIAL_PARITY_NO"
+.LASF1961:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF776:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF839:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF691:
+	.string	"__U64_TYPE unsigned long int"
+.LASF2112:
+	.string	"sensorAccInitFuncPtr"
+.LASF735:
+	.string	"_BITS_TIME64_H 1"
+.LASF826:
+	.string	"__ONCE_ALIGNMENT "
+.LASF876:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1972:
+	.string	"LED_XY_MASK 0x0F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF2005:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF715:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF499:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2203:
+	.string	"OWNER_USB_DETECT"
+.LASF1455:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2034:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF622:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2074:
+	.string	"__size"
+.LASF1296:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1409:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1283:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF809:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF756:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2417:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF515:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1201:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF679:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2431:
+	.string	"rx_max_usec"
+.LASF2143:
+	.string	"writeFn"
+.LASF510:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2478:
+	.string	"VOLTAGE_METER_NONE"
+.LASF968:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1496:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF544:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF500:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1935:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1130:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1033:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1809:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ILAP 10"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2338:
+	.string	"isRXDataNew"
+.LASF651:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2273:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF586:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF2542:
+	.string	"subTaskName"
+.LASF581:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2207:
+	.string	"OWNER_INVERTER"
+.LASF1019:
+	.string	"TELEMETRY_IBUS"
+.LASF1893:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1365:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1997:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF768:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1958:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF2188:
+	.string	"OWNER_SPI_MOSI"
+.LASF1758:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2066:
+	.string	"__count"
+.LASF2233:
+	.string	"identifier"
+.LASF1579:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2077:
+	.string	"uint8_t"
+.LASF1097:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF549:
+	.string	"__stub_fchflags "
+.LASF2486:
+	.string	"vbatnotpresentcellvoltage"
+.LASF1889:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1976:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF683:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1519:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2618:
+	.string	"batteryConfig"
+.LASF1597:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF2578:
+	.string	"batteryUpdateCurrentMeter"
+.LASF827:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1127:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1479:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2437:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1587:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF931:
+	.string	"TELEMETRY "
+.LASF2603:
+	.string	"taskTelemetry"
+.LASF2339:
+	.string	"ARMED"
+.LASF1195:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1281:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1569:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1629:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"USE_ADC"
+.LASF740:
+	.string	"__dev_t_defined "
+.LASF453:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2522:
+	.string	"TASK_ACCEL"
+.LASF1956:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1869:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2344:
+	.string	"PID_PITCH"
+.LASF542:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF604:
+	.string	"_GCC_WCHAR_T "
+.LASF2510:
+	.string	"TASK_PRIORITY_LOW"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1804:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ARCITIMER 155 * TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER"
+.LASF1282:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF696:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1015:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF950:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF779:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF633:
+	.string	"__WCOREFLAG 0x80"
+.LASF624:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF534:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2138:
+	.string	"busDevice_t"
+.LASF2443:
+	.string	"busDevice_u"
+.LASF1610:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1542:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1110:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF2259:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1998:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF2605:
+	.string	"taskCalculateAltitude"
+.LASF1037:
+	.string	"_ANSI_STDDEF_H "
+.LASF828:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1563:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1635:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF437:
+	.string	"__USE_ISOC99 1"
+.LASF607:
+	.string	"_BSD_WCHAR_T_"
+.LASF1937:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF2455:
+	.string	"accSamplingInterval"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF647:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF533:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF579:
+	.string	"_SIZE_T_ "
+.LASF2200:
+	.string	"OWNER_MPU_EXTI"
+.LASF1853:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1344:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF2501:
+	.string	"magZero"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1585:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1238:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF2551:
+	.string	"lastSignaledAt"
+.LASF2170:
+	.string	"OWNER_PPMINPUT"
+.LASF2125:
+	.string	"ioTag_t"
+.LASF1048:
+	.string	"__need_ptrdiff_t"
+.LASF771:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF909:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2514:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF517:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1067:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1771:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1179:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1035:
+	.string	"_STDDEF_H "
+.LASF1714:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF979:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1721:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1406:
+	.string	"GYRO_LPF_NONE 7"
+.LASF707:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1297:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1782:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1393:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1711:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF658:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2611:
+	.string	"taskBatteryAlerts"
+.LASF2495:
+	.string	"batteryConfig_System"
+.LASF916:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1368:
+	.string	"TIMER_ABSTIME 1"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1897:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF906:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1541:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF1578:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1988:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1651:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1094:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1318:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1205:
+	.string	"PG_OSD_CONFIG 501"
+.LASF479:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2419:
+	.string	"rssi_scale"
+.LASF1169:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1215:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF2400:
+	.string	"SERIALRX_XBUS_MODE_B_RJ01"
+.LASF2157:
+	.string	"ICM_20689_SPI"
+.LASF550:
+	.string	"__stub_gtty "
+.LASF1174:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF689:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2221:
+	.string	"SERIAL_INVERTED"
+.LASF1818:
+	.string	"TRANSPONDER_TRANSMIT_JITTER_ILAP 10000"
+.LASF794:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF584:
+	.string	"_SIZE_T_DECLARED "
+.LASF1582:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2350:
+	.string	"PID_LEVEL"
+.LASF712:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2608:
+	.string	"taskUpdateCompass"
+.LASF2134:
+	.string	"instance"
+.LASF2063:
+	.string	"__pthread_internal_list"
+.LASF2330:
+	.string	"BOXBLACKBOXERASE"
+.LASF858:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2394:
+	.string	"SERIALRX_SPEKTRUM1024"
+.LASF731:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF518:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2060:
+	.string	"__prev"
+.LASF1105:
+	.string	"TRACE_END(event,arg) {}"
+.LASF1793:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1187:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1012:
+	.string	"LED_STRIP"
+.LASF1688:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF904:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1564:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF646:
+	.string	"__f128(x) x ##f128"
+.LASF2619:
+	.string	"accelerometerConfigMutable"
+.LASF811:
+	.string	"__fsblkcnt_t_defined "
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF859:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1952:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF2517:
+	.string	"startLatency"
+.LASF2567:
+	.string	"calculateEstimatedAltitude"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF766:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF2424:
+	.string	"rcInterpolation"
+.LASF1115:
+	.string	"NOOP do {} while (0)"
+.LASF2451:
+	.string	"SENSOR_SONAR"
+.LASF1458:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2328:
+	.string	"BOX3DDISABLE"
+.LASF1232:
+	.string	"IO_TAG_NONE 0"
+.LASF1009:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1077:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2029:
+	.string	"ESC_DATA_INVALID 255"
+.LASF2276:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF812:
+	.string	"__fsfilcnt_t_defined "
+.LASF613:
+	.string	"WNOHANG 1"
+.LASF1405:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1934:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF2505:
+	.string	"targetLooptime"
+.LASF1518:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1943:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF932:
+	.string	"TELEMETRY_FRSKY "
+.LASF940:
+	.string	"TELEMETRY_IBUS "
+.LASF1428:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1814:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ILAP ((TRANSPONDER_TOGGLES_PER_BIT_ILAP + 1) * TRANSPONDER_BITS_PER_BYTE_ILAP * TRANSPONDER_DATA_LENGTH_ILAP)"
+.LASF461:
+	.string	"__GNU_LIBRARY__"
+.LASF1244:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2448:
+	.string	"SENSOR_ACC"
+.LASF457:
+	.string	"__USE_ATFILE 1"
+.LASF1736:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2183:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1333:
+	.string	"SCHED_OTHER 0"
+.LASF2137:
+	.string	"address"
+.LASF1128:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1727:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1613:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF855:
+	.string	"UINT16_MAX (65535)"
+.LASF1559:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1849:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1008:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1255:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2363:
+	.string	"modeColors"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2492:
+	.string	"consumptionWarningPercentage"
+.LASF494:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1416:
+	.string	"IOCFG_IPU 0"
+.LASF438:
+	.string	"__USE_ISOC95 1"
+.LASF1588:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1073:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1560:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF609:
+	.string	"NULL"
+.LASF1065:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2513:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF2279:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF717:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2280:
+	.string	"FEATURE_RX_SPI"
+.LASF835:
+	.string	"__have_pthread_attr_t 1"
+.LASF2441:
+	.string	"pitch"
+.LASF616:
+	.string	"WEXITED 4"
+.LASF2185:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1954:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF708:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF749:
+	.string	"__daddr_t_defined "
+.LASF473:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1514:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF467:
+	.string	"__PMT"
+.LASF2382:
+	.string	"blackbox_baudrateIndex"
+.LASF605:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1055:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2347:
+	.string	"PID_POS"
+.LASF1131:
+	.string	"PP_IIF_1(t,f) t"
+.LASF825:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2383:
+	.string	"telemetry_baudrateIndex"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1116:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1265:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2151:
+	.string	"MPU_65xx_I2C"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF961:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1193:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1772:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2498:
+	.string	"mag_align"
+.LASF802:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2341:
+	.string	"armingFlags"
+.LASF905:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1657:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1870:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1602:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1932:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF644:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1151:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1767:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2300:
+	.string	"BOXANGLE"
+.LASF1865:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF745:
+	.string	"__off_t_defined "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF520:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1114:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1731:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1141:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1880:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF593:
+	.string	"_WCHAR_T "
+.LASF682:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1535:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1071:
+	.string	"UNIT_TESTED "
+.LASF2590:
+	.string	"feature"
+.LASF1150:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2620:
+	.string	"rxConfig"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1403:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1973:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF885:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1656:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2456:
+	.string	"accSmooth"
+.LASF2020:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF2594:
+	.string	"schedulerInit"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF852:
+	.string	"INT32_MAX (2147483647)"
+.LASF2281:
+	.string	"FEATURE_SOFTSPI"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1898:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF2141:
+	.string	"mpuResetFnPtr"
+.LASF820:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1824:
+	.string	"TRANSPONDER_TIMER_MHZ_ERLT 18"
+.LASF1089:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1060:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1820:
+	.string	"ERLTBitQuiet 0"
+.LASF2623:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF477:
+	.string	"__P(args) args"
+.LASF2587:
+	.string	"gyroSampleIsDue"
+.LASF1836:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF660:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF884:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1252:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF862:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1081:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF908:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF575:
+	.string	"_SYS_SIZE_T_H "
+.LASF2446:
+	.string	"flightDynamicsTrims_t"
+.LASF2444:
+	.string	"flightDynamicsTrims_u"
+.LASF1823:
+	.string	"TRANSPONDER_DMA_BUFFER_SIZE_ERLT 200"
+.LASF928:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1456:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1581:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1467:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1817:
+	.string	"TRANSPONDER_TRANSMIT_DELAY_ILAP 4500"
+.LASF2030:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1052:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF2293:
+	.string	"result"
+.LASF1745:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1825:
+	.string	"TRANSPONDER_CARRIER_HZ_ERLT 38000"
+.LASF824:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF983:
+	.string	"USE_FAKE_FLASH "
+.LASF1273:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF1385:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1863:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF2342:
+	.string	"cliMode"
+.LASF1216:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2018:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF924:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2562:
+	.string	"processRx"
+.LASF797:
+	.string	"__suseconds_t_defined "
+.LASF1591:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1562:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF718:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF850:
+	.string	"INT8_MAX (127)"
+.LASF814:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1104:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF2061:
+	.string	"__next"
+.LASF806:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1203:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF752:
+	.string	"__clockid_t_defined 1"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF892:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1145:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2519:
+	.string	"TASK_SYSTEM"
+.LASF1718:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF719:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF611:
+	.string	"__need_NULL"
+.LASF1049:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2523:
+	.string	"TASK_ATTITUDE"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF821:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1106:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF454:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF1948:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF2317:
+	.string	"BOXGOV"
+.LASF686:
+	.string	"__SWORD_TYPE long int"
+.LASF1506:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"USE_PPM "
+.LASF1487:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1447:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2602:
+	.string	"taskBlackbox"
+.LASF2472:
+	.string	"CURRENT_METER_ADC"
+.LASF2218:
+	.string	"MODE_RXTX"
+.LASF1022:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1005:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1424:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF2291:
+	.string	"mspResult_e"
+.LASF446:
+	.string	"__USE_POSIX199309 1"
+.LASF894:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF985:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1805:
+	.string	"TRANSPONDER_TIMER_MHZ_ARCITIMER 24"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF736:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2340:
+	.string	"WAS_EVER_ARMED"
+.LASF1589:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2139:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1014:
+	.string	"TELEMETRY_HOTT"
+.LASF868:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF793:
+	.string	"____sigset_t_defined "
+.LASF1152:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1460:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1286:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF483:
+	.string	"__END_DECLS "
+.LASF1337:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1117:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2509:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF2071:
+	.string	"__elision"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2136:
+	.string	"deviceI2C_s"
+.LASF2191:
+	.string	"OWNER_SDCARD"
+.LASF2508:
+	.string	"gyro"
+.LASF1951:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1923:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_WRITE_BUFFER_PAGES * FLASHFS_PAGE_SIZE)"
+.LASF1290:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1500:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1776:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF526:
+	.string	"__attribute_copy__"
+.LASF880:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1192:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1329:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1100:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2057:
+	.string	"int16_t"
+.LASF1528:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1822:
+	.string	"ERLTCyclesForZeroBit 10"
+.LASF1092:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1671:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2047:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2022:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2049:
+	.string	"signed char"
+.LASF661:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1075:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF2297:
+	.string	"mspProcessCommandFnPtr"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF572:
+	.string	"__size_t__ "
+.LASF907:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF448:
+	.string	"__USE_XOPEN2K 1"
+.LASF1383:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF935:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1111:
+	.string	"HSV_HUE_MAX 359"
+.LASF2589:
+	.string	"dispatchIsEnabled"
+.LASF2091:
+	.string	"on_motor_test"
+.LASF995:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF601:
+	.string	"_WCHAR_T_H "
+.LASF2140:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1160:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF503:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2467:
+	.string	"accZero"
+.LASF2115:
+	.string	"readFn"
+.LASF2520:
+	.string	"TASK_GYROPID"
+.LASF753:
+	.string	"__time_t_defined 1"
+.LASF781:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF773:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2271:
+	.string	"FEATURE_RSSI_ADC"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1647:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF545:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF770:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1390:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1137:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1682:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"VTX_TRAMP"
+.LASF1860:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF834:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2579:
+	.string	"batteryUpdateVoltage"
+.LASF663:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF580:
+	.string	"_BSD_SIZE_T_ "
+.LASF521:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1700:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"__cleanup_fct_attribute "
+.LASF505:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF998:
+	.string	"USE_DASHBOARD"
+.LASF938:
+	.string	"TELEMETRY_LTM "
+.LASF2038:
+	.string	"RCSPLIT_PACKET_CMD_CTRL 0x01"
+.LASF959:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1470:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1530:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1995:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF813:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2307:
+	.string	"BOXCAMSTAB"
+.LASF2536:
+	.string	"TASK_RCSPLIT"
+.LASF1417:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2556:
+	.string	"histogram"
+.LASF1850:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF546:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF808:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1168:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2118:
+	.string	"revisionCode"
+.LASF956:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF705:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2375:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2376:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1030:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2354:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1575:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2327:
+	.string	"BOXAIRMODE"
+.LASF2463:
+	.string	"accelerometerConfig_s"
+.LASF2469:
+	.string	"accelerometerConfig_t"
+.LASF2408:
+	.string	"serialrx_provider"
+.LASF1031:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1172:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1858:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1373:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF1856:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF900:
+	.string	"INT64_C(c) c ## L"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF697:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1720:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF929:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2290:
+	.string	"MSP_RESULT_CMD_UNKNOWN"
+.LASF1397:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF2600:
+	.string	"useBatteryCurrent"
+.LASF2390:
+	.string	"serialConfig_System"
+.LASF1227:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1527:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2205:
+	.string	"OWNER_OSD"
+.LASF471:
+	.string	"__LEAF , __leaf__"
+.LASF2596:
+	.string	"batteryUpdateStates"
+.LASF1561:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1774:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1158:
+	.string	"PG_PID_PROFILE 14"
+.LASF1740:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1295:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2153:
+	.string	"MPU_9250_SPI"
+.LASF2305:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1442:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1868:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF536:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF873:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2404:
+	.string	"SERIALRX_SRXL"
+.LASF1802:
+	.string	"TRANSPONDER_GAP_TOGGLES_ARCITIMER 0"
+.LASF922:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1422:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1229:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1633:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF953:
+	.string	"VTX_SMARTAUDIO "
+.LASF2114:
+	.string	"initFn"
+.LASF1847:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1896:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1108:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2326:
+	.string	"BOXFAILSAFE"
+.LASF838:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2252:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF2511:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF2349:
+	.string	"PID_NAVR"
+.LASF1338:
+	.string	"__CPU_SETSIZE 1024"
+.LASF698:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1643:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2227:
+	.string	"SERIAL_BIDIR"
+.LASF1949:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1099:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1546:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1448:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1469:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF540:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2374:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1308:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1729:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1646:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF481:
+	.string	"__ptr_t void *"
+.LASF2274:
+	.string	"FEATURE_OSD"
+.LASF2015:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF2549:
+	.string	"taskLatestDeltaTime"
+.LASF1202:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF957:
+	.string	"GPS "
+.LASF2016:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF688:
+	.string	"__SLONG32_TYPE int"
+.LASF1155:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2366:
+	.string	"SERIAL_PORT_USART1"
+.LASF2367:
+	.string	"SERIAL_PORT_USART2"
+.LASF2368:
+	.string	"SERIAL_PORT_USART3"
+.LASF856:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2371:
+	.string	"SERIAL_PORT_USART6"
+.LASF2372:
+	.string	"SERIAL_PORT_USART7"
+.LASF2373:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2248:
+	.string	"serialTotalRxWaiting"
+.LASF2535:
+	.string	"TASK_BLACKBOX"
+.LASF1429:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1904:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF2399:
+	.string	"SERIALRX_XBUS_MODE_B"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF1722:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2622:
+	.string	"blackboxConfig"
+.LASF1902:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF2044:
+	.string	"long int"
+.LASF2332:
+	.string	"BOXCAMERA2"
+.LASF2333:
+	.string	"BOXCAMERA3"
+.LASF1164:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1548:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1895:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF2128:
+	.string	"I2CDEV_1"
+.LASF2129:
+	.string	"I2CDEV_2"
+.LASF2130:
+	.string	"I2CDEV_3"
+.LASF2131:
+	.string	"I2CDEV_4"
+.LASF1328:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1276:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1960:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF846:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF854:
+	.string	"UINT8_MAX (255)"
+.LASF1404:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2181:
+	.string	"OWNER_PINDEBUG"
+.LASF1854:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1920:
+	.string	"DASHBOARD_I2C_ADDRESS 0x3C"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1763:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF849:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1348:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1991:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1533:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2318:
+	.string	"BOXOSD"
+.LASF1222:
+	.string	"PG_I2C_CONFIG 518"
+.LASF478:
+	.string	"__PMT(args) args"
+.LASF2465:
+	.string	"acc_align"
+.LASF2571:
+	.string	"gyroReadTemperature"
+.LASF939:
+	.string	"TELEMETRY_CRSF "
+.LASF1042:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF466:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1050:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1083:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF863:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1490:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2453:
+	.string	"SENSOR_GPSMAG"
+.LASF1503:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1041:
+	.string	"__PTRDIFF_T "
+.LASF790:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF796:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1594:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF674:
+	.string	"EXIT_SUCCESS 0"
+.LASF1347:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1369:
+	.string	"__struct_tm_defined 1"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1363:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1628:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF721:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2320:
+	.string	"BOXGTUNE"
+.LASF1017:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1723:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2525:
+	.string	"TASK_SERIAL"
+.LASF2482:
+	.string	"batteryConfig_s"
+.LASF2494:
+	.string	"batteryConfig_t"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2476:
+	.string	"CURRENT_METER_MAX"
+.LASF1966:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF484:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1266:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1126:
+	.string	"EXPAND_I(x) x"
+.LASF1090:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1622:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2439:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF1402:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2466:
+	.string	"acc_hardware"
+.LASF1016:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1882:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2079:
+	.string	"uint32_t"
+.LASF1327:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF578:
+	.string	"__SIZE_T "
+.LASF726:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF966:
+	.string	"U_ID_1 1"
+.LASF1859:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1426:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1737:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"U_ID_0 0"
+.LASF2242:
+	.string	"rxBufferTail"
+.LASF2303:
+	.string	"BOXANTIGRAVITY"
+.LASF666:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1211:
+	.string	"PG_PPM_CONFIG 507"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1637:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2595:
+	.string	"batteryUpdateAlarms"
+.LASF2392:
+	.string	"MSP_SKIP_NON_MSP_DATA"
+.LASF1494:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2090:
+	.string	"device"
+.LASF725:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1636:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1799:
+	.string	"TRANSPONDER_BITS_PER_BYTE_ARCITIMER 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1380:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1497:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1746:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2175:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2310:
+	.string	"BOXGPSHOLD"
+.LASF667:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF800:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1891:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF509:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1162:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2226:
+	.string	"SERIAL_UNIDIR"
+.LASF2601:
+	.string	"useBatteryAlerts"
+.LASF1208:
+	.string	"PG_PID_CONFIG 504"
+.LASF606:
+	.string	"__DEFINED_wchar_t "
+.LASF1707:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"_TIME_H 1"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF669:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2325:
+	.string	"BOXBLACKBOX"
+.LASF496:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2566:
+	.string	"compassUpdate"
+.LASF1013:
+	.string	"TELEMETRY_FRSKY"
+.LASF2043:
+	.string	"long unsigned int"
+.LASF1360:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF867:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1953:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF1245:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF2306:
+	.string	"BOXHEADADJ"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF492:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2500:
+	.string	"interruptTag"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1381:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF594:
+	.string	"_T_WCHAR_ "
+.LASF2089:
+	.string	"rate_denom"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2484:
+	.string	"vbatmincellvoltage"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1218:
+	.string	"PG_VCD_CONFIG 514"
+.LASF860:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF962:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF442:
+	.string	"_POSIX_C_SOURCE"
+.LASF2524:
+	.string	"TASK_RX"
+.LASF1947:
+	.string	"LED_POS_BITCNT 8"
+.LASF672:
+	.string	"RAND_MAX 2147483647"
+.LASF2309:
+	.string	"BOXGPSHOME"
+.LASF2182:
+	.string	"OWNER_TIMER"
+.LASF2113:
+	.string	"accDev_s"
+.LASF2167:
+	.string	"accDev_t"
+.LASF1619:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1188:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2116:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1742:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2537:
+	.string	"TASK_COUNT"
+.LASF1095:
+	.string	"CMS_EXIT (0)"
+.LASF1725:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1806:
+	.string	"TRANSPONDER_CARRIER_HZ_ARCITIMER 41886"
+.LASF2568:
+	.string	"baroUpdate"
+.LASF1123:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1557:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF872:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1926:
+	.string	"LAT 0"
+.LASF1240:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF2364:
+	.string	"specialColors"
+.LASF1717:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF955:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2056:
+	.string	"char"
+.LASF2295:
+	.string	"mspPacket_t"
+.LASF1992:
+	.string	"PWM_PULSE_MIN 750"
+.LASF617:
+	.string	"WCONTINUED 8"
+.LASF700:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1667:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2521:
+	.string	"TASK_PID"
+.LASF655:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1764:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1652:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"__S32_TYPE int"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1413:
+	.string	"IOCFG_AF_PP 0"
+.LASF1855:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF2070:
+	.string	"__spins"
+.LASF2101:
+	.string	"hsvColor_t"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1482:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1964:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF678:
+	.string	"__S16_TYPE short int"
+.LASF2126:
+	.string	"IO_t"
+.LASF1332:
+	.string	"_BITS_SCHED_H 1"
+.LASF1256:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF2470:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF574:
+	.string	"_SIZE_T "
+.LASF2313:
+	.string	"BOXLEDMAX"
+.LASF784:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2573:
+	.string	"blackboxUpdate"
+.LASF2068:
+	.string	"__nusers"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1726:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1254:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1231:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2365:
+	.string	"SERIAL_PORT_NONE"
+.LASF1601:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2546:
+	.string	"staticPriority"
+.LASF2194:
+	.string	"OWNER_FLASH_CS"
+.LASF1011:
+	.string	"USE_SERIALRX_XBUS"
+.LASF947:
+	.string	"USE_RX_MSP "
+.LASF1631:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2397:
+	.string	"SERIALRX_SUMD"
+.LASF2358:
+	.string	"color"
+.LASF1463:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2398:
+	.string	"SERIALRX_SUMH"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1939:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1539:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1840:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2593:
+	.string	"sensors"
+.LASF1325:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2302:
+	.string	"BOXBARO"
+.LASF582:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2450:
+	.string	"SENSOR_MAG"
+.LASF1606:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1274:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1788:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2569:
+	.string	"isBaroReady"
+.LASF847:
+	.string	"INT16_MIN (-32767-1)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF737:
+	.string	"__STD_TYPE"
+.LASF1066:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF676:
+	.string	"_SYS_TYPES_H 1"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF2154:
+	.string	"ICM_20601_SPI"
+.LASF869:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1262:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF695:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF498:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF650:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2287:
+	.string	"MSP_RESULT_ACK"
+.LASF1969:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF589:
+	.string	"__size_t "
+.LASF571:
+	.string	"__need_NULL "
+.LASF1120:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF703:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2225:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1310:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF910:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1004:
+	.string	"SERIAL_RX"
+.LASF1821:
+	.string	"ERLTCyclesForOneBit 25"
+.LASF1101:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1180:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2343:
+	.string	"PID_ROLL"
+.LASF1698:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"mpuConfiguration"
+.LASF610:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2109:
+	.string	"CW180_DEG_FLIP"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1056:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF785:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1124:
+	.string	"STR_HELPER(x) #x"
+.LASF833:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1583:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1367:
+	.string	"CLOCK_TAI 11"
+.LASF2262:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1982:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1185:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1025:
+	.string	"VTX_SMARTAUDIO"
+.LASF923:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2186:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF502:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1069:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF397:
+	.string	"true 1"
+.LASF1007:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2531:
+	.string	"TASK_COMPASS"
+.LASF1103:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF1346:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF2583:
+	.string	"imuUpdateAttitude"
+.LASF792:
+	.string	"__sigset_t_defined 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF532:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2120:
+	.string	"lock"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1632:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1357:
+	.string	"CLOCK_REALTIME 0"
+.LASF608:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2402:
+	.string	"SERIALRX_JETIEXBUS"
+.LASF1977:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF2526:
+	.string	"TASK_DISPATCH"
+.LASF1040:
+	.string	"_T_PTRDIFF "
+.LASF469:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1505:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2127:
+	.string	"I2CINVALID"
+.LASF1374:
+	.string	"_BITS_SETJMP_H 1"
+.LASF2039:
+	.string	"RCSPLIT_PACKET_TAIL 0xaa"
+.LASF2012:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1358:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1965:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF2561:
+	.string	"accUpdate"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF815:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2009:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF677:
+	.string	"_BITS_TYPES_H 1"
+.LASF975:
+	.string	"USE_FAKE_ACC "
+.LASF1223:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1708:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2576:
+	.string	"rcSplitProcess"
+.LASF1879:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1674:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF465:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1349:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1102:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1620:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF2369:
+	.string	"SERIAL_PORT_UART4"
+.LASF543:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2370:
+	.string	"SERIAL_PORT_UART5"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF747:
+	.string	"__id_t_defined "
+.LASF993:
+	.string	"USE_UART8 "
+.LASF1906:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1389:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1517:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2148:
+	.string	"MPU_3050"
+.LASF1226:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF831:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF630:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2104:
+	.string	"CW90_DEG"
+.LASF1697:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2378:
+	.string	"serialPortConfig_s"
+.LASF2384:
+	.string	"serialPortConfig_t"
+.LASF1370:
+	.string	"__itimerspec_defined 1"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1769:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF2111:
+	.string	"sensor_align_e"
+.LASF1715:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1453:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF830:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1702:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1791:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2460:
+	.string	"rollAndPitchTrims_t_def"
+.LASF2222:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2223:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1886:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1140:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1096:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF620:
+	.string	"__WALL 0x40000000"
+.LASF485:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF763:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF2244:
+	.string	"txBufferTail"
+.LASF777:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2319:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1603:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1580:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1609:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1526:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF2577:
+	.string	"gpsUpdate"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1138:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1962:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF632:
+	.string	"__W_CONTINUED 0xffff"
+.LASF2405:
+	.string	"SERIALRX_TARGET_CUSTOM"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1200:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF913:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1642:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1209:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF917:
+	.string	"USE_CLI_BATCH "
+.LASF1685:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2082:
+	.string	"double"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1461:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1289:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1268:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF728:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF780:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1288:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1134:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1515:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF710:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1372:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2189:
+	.string	"OWNER_I2C_SCL"
+.LASF2187:
+	.string	"OWNER_SPI_MISO"
+.LASF1472:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1446:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2337:
+	.string	"blackboxConfig_System"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2211:
+	.string	"OWNER_COMPASS_CS"
+.LASF597:
+	.string	"_WCHAR_T_ "
+.LASF977:
+	.string	"USE_FAKE_GYRO "
+.LASF1596:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF2288:
+	.string	"MSP_RESULT_ERROR"
+.LASF764:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1719:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF720:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2270:
+	.string	"FEATURE_RX_MSP"
+.LASF2528:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF439:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2426:
+	.string	"rcInterpolationInterval"
+.LASF598:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1396:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2264:
+	.string	"FEATURE_GPS"
+.LASF1087:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1425:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF865:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1253:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1063:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF504:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2563:
+	.string	"mspFcProcessReply"
+.LASF2095:
+	.string	"mode_profile"
+.LASF1225:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2336:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2054:
+	.string	"__int32_t"
+.LASF2557:
+	.string	"cfTask_t"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2190:
+	.string	"OWNER_I2C_SDA"
+.LASF2011:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2055:
+	.string	"__uint32_t"
+.LASF2403:
+	.string	"SERIALRX_CRSF"
+.LASF990:
+	.string	"USE_UART5 "
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF627:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF1925:
+	.string	"FLASHFS_ERASE_POOL_SECTORS 4"
+.LASF2548:
+	.string	"taskAgeCycles"
+.LASF1830:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2272:
+	.string	"FEATURE_LED_STRIP"
+.LASF723:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2532:
+	.string	"TASK_BARO"
+.LASF1916:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF1884:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2485:
+	.string	"vbatwarningcellvoltage"
+.LASF1093:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF915:
+	.string	"USE_CLI "
+.LASF2158:
+	.string	"BMI_160_SPI"
+.LASF960:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2550:
+	.string	"lastExecutedAt"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2496:
+	.string	"compassConfig_s"
+.LASF2502:
+	.string	"compassConfig_t"
+.LASF501:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2236:
+	.string	"baudRate"
+.LASF1167:
+	.string	"PG_RX_CONFIG 24"
+.LASF1194:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF421:
+	.string	"__USE_MISC"
+.LASF1079:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2377:
+	.string	"serialPortIdentifier_e"
+.LASF2219:
+	.string	"portOptions_t"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF851:
+	.string	"INT16_MAX (32767)"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF648:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2362:
+	.string	"colors"
+.LASF2597:
+	.string	"batteryUpdatePresence"
+.LASF1623:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1249:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF810:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2380:
+	.string	"msp_baudrateIndex"
+.LASF619:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF2240:
+	.string	"txBuffer"
+.LASF595:
+	.string	"_T_WCHAR "
+.LASF1132:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1550:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"_SIZET_ "
+.LASF1775:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1985:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF1689:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2004:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2533:
+	.string	"TASK_ALTITUDE"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF629:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF761:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2552:
+	.string	"movingSumExecutionTime"
+.LASF1036:
+	.string	"_STDDEF_H_ "
+.LASF1427:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF451:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1047:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1445:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1794:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2580:
+	.string	"dispatchProcess"
+.LASF1795:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1664:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2488:
+	.string	"currentMeterSource"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1994:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1779:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1672:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1909:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF732:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1803:
+	.string	"TRANSPONDER_TOGGLES_ARCITIMER (TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER + TRANSPONDER_GAP_TOGGLES_ARCITIMER)"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2541:
+	.string	"taskName"
+.LASF836:
+	.string	"_ALLOCA_H 1"
+.LASF2387:
+	.string	"serial_update_rate_hz"
+.LASF1228:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF2107:
+	.string	"CW0_DEG_FLIP"
+.LASF621:
+	.string	"__WCLONE 0x80000000"
+.LASF888:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1364:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF2385:
+	.string	"serialConfig_s"
+.LASF2206:
+	.string	"OWNER_RX_BIND"
+.LASF1199:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF2585:
+	.string	"taskMainPidLoopCheck"
+.LASF952:
+	.string	"VTX_CONTROL "
+.LASF1683:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2209:
+	.string	"OWNER_TRANSPONDER"
+.LASF1166:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2023:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF1293:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF890:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1326:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1872:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1529:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1285:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1475:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1645:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2414:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1595:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"__f32(x) x ##f32"
+.LASF1043:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF596:
+	.string	"__WCHAR_T "
+.LASF2161:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF699:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1910:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF1655:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2003:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF738:
+	.string	"__u_char_defined "
+.LASF1340:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2246:
+	.string	"serialPortVTable"
+.LASF1341:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF1356:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2457:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1307:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF801:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2554:
+	.string	"totalExecutionTime"
+.LASF570:
+	.string	"__need_wchar_t "
+.LASF2027:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1790:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2215:
+	.string	"portMode_t"
+.LASF436:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1654:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF976:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2559:
+	.string	"updateAltHoldState"
+.LASF2059:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2471:
+	.string	"CURRENT_METER_NONE"
+.LASF1299:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF733:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2024:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2581:
+	.string	"mspFcProcessCommand"
+.LASF1679:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2196:
+	.string	"OWNER_MPU_CS"
+.LASF2199:
+	.string	"OWNER_SPI_CS"
+.LASF1213:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2285:
+	.string	"sbuf_s"
+.LASF2286:
+	.string	"sbuf_t"
+.LASF642:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1905:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1801:
+	.string	"TRANSPONDER_TOGGLES_PER_BIT_ARCITIMER 4"
+.LASF1989:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1272:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1027:
+	.string	"USE_I2C"
+.LASF2072:
+	.string	"__list"
+.LASF2586:
+	.string	"taskGyro"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1927:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF978:
+	.string	"MAG "
+.LASF1376:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF482:
+	.string	"__BEGIN_DECLS "
+.LASF2081:
+	.string	"SPI_TypeDef"
+.LASF522:
+	.string	"__restrict_arr __restrict"
+.LASF615:
+	.string	"WSTOPPED 2"
+.LASF1680:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF901:
+	.string	"UINT8_C(c) c"
+.LASF840:
+	.string	"_STDINT_H 1"
+.LASF2555:
+	.string	"maxStartLatency"
+.LASF2459:
+	.string	"rollAndPitchTrims_s"
+.LASF2462:
+	.string	"rollAndPitchTrims_t"
+.LASF2461:
+	.string	"rollAndPitchTrims_u"
+.LASF641:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2230:
+	.string	"serialReceiveCallbackPtr"
+.LASF2100:
+	.string	"hsvColor_s"
+.LASF1761:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1744:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF577:
+	.string	"_T_SIZE "
+.LASF447:
+	.string	"__USE_POSIX199506 1"
+.LASF2165:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF690:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2574:
+	.string	"flashfsPoll"
+.LASF2615:
+	.string	"currentDeltaTimeUs"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF523:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1235:
+	.string	"I2CDEV_COUNT 4"
+.LASF1149:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2565:
+	.string	"cliProcess"
+.LASF623:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1549:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF449:
+	.string	"__USE_XOPEN2K8 1"
+.LASF636:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF2348:
+	.string	"PID_POSR"
+.LASF925:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1607:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1626:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2538:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1572:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2228:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1206:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1122:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF2168:
+	.string	"OWNER_FREE"
+.LASF2258:
+	.string	"FEATURE_RX_PPM"
+.LASF652:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2473:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF452:
+	.string	"__WORDSIZE 64"
+.LASF1287:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF640:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2491:
+	.string	"useConsumptionAlerts"
+.LASF2135:
+	.string	"csnPin"
+.LASF1978:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2352:
+	.string	"PID_VEL"
+.LASF748:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1819:
+	.string	"TRANSPONDER_DATA_LENGTH_ERLT 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF450:
+	.string	"_ATFILE_SOURCE"
+.LASF2097:
+	.string	"RGB_RED"
+.LASF1109:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1534:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2430:
+	.string	"rx_min_usec"
+.LASF1259:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF807:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1615:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1778:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2231:
+	.string	"serialPort_s"
+.LASF2257:
+	.string	"serialPort_t"
+.LASF2169:
+	.string	"OWNER_PWMINPUT"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF659:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1392:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1399:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1241:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2249:
+	.string	"serialTotalTxFree"
+.LASF1555:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1835:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1034:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1584:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1267:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1070:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1334:
+	.string	"SCHED_FIFO 1"
+.LASF1350:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1144:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF441:
+	.string	"_POSIX_SOURCE 1"
+.LASF2229:
+	.string	"SERIAL_BIDIR_PP"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1351:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1852:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2588:
+	.string	"taskSystem"
+.LASF1032:
+	.string	"DEFIO_NO_PORTS "
+.LASF1478:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2591:
+	.string	"setTaskEnabled"
+.LASF887:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1044:
+	.string	"___int_ptrdiff_t_h "
+.LASF2543:
+	.string	"checkFunc"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1248:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF525:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF724:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1484:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1907:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1239:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2504:
+	.string	"gyro_s"
+.LASF2507:
+	.string	"gyro_t"
+.LASF1659:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1437:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF805:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF2156:
+	.string	"ICM_20608_SPI"
+.LASF1644:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1173:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1303:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2013:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2017:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF775:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2145:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1006:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1766:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF942:
+	.string	"TELEMETRY_MAVLINK "
+.LASF462:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF750:
+	.string	"__key_t_defined "
+.LASF2045:
+	.string	"long long int"
+.LASF1670:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF463:
+	.string	"__GLIBC__ 2"
+.LASF895:
+	.string	"WINT_MIN (0u)"
+.LASF1408:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1411:
+	.string	"IOCFG_OUT_PP 0"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2088:
+	.string	"rate_num"
+.LASF2268:
+	.string	"FEATURE_3D"
+.LASF673:
+	.string	"EXIT_FAILURE 1"
+.LASF1153:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2192:
+	.string	"OWNER_SDCARD_CS"
+.LASF634:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2564:
+	.string	"mspSerialProcess"
+.LASF1695:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2544:
+	.string	"taskFunc"
+.LASF1565:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1269:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1312:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2407:
+	.string	"rcmap"
+.LASF2447:
+	.string	"SENSOR_GYRO"
+.LASF585:
+	.string	"__DEFINED_size_t "
+.LASF445:
+	.string	"__USE_POSIX2 1"
+.LASF1443:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1291:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1887:
+	.string	"ALL_MOTORS 255"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2480:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1739:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1930:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF986:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1431:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1314:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF758:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1650:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1377:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1911:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF2152:
+	.string	"MPU_65xx_SPI"
+.LASF1322:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2334:
+	.string	"BOXDSHOTREVERSE"
+.LASF1890:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1513:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1912:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1488:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1061:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF1214:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2213:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1986:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF2164:
+	.string	"sensor"
+.LASF1661:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2475:
+	.string	"CURRENT_METER_MSP"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF994:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF832:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2530:
+	.string	"TASK_GPS"
+.LASF528:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1388:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF926:
+	.string	"USE_SERIALRX_SUMH "
+.LASF635:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF508:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1521:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1419:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2208:
+	.string	"OWNER_LED_STRIP"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2395:
+	.string	"SERIALRX_SPEKTRUM2048"
+.LASF987:
+	.string	"USE_UART2 "
+.LASF951:
+	.string	"VTX_COMMON "
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF954:
+	.string	"VTX_TRAMP "
+.LASF2163:
+	.string	"mpuDetectionResult_s"
+.LASF2166:
+	.string	"mpuDetectionResult_t"
+.LASF2351:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1928:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2000:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF2353:
+	.string	"PID_ITEM_COUNT"
+.LASF716:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF774:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF1676:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2606:
+	.string	"taskUpdateBaro"
+.LASF1394:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1940:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1024:
+	.string	"VTX_CONTROL"
+.LASF1843:
+	.string	"LOOPTIME_SUSPEND_TIME 3"
+.LASF1078:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1371:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1663:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1786:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1903:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF713:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1558:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF2438:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1694:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF392:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF1157:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2247:
+	.string	"serialWrite"
+.LASF1184:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2582:
+	.string	"rxUpdateCheck"
+.LASF706:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1449:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF988:
+	.string	"USE_UART3 "
+.LASF1345:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF920:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1666:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1315:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1876:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1481:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2160:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF1639:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1236:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF984:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF971:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF573:
+	.string	"__SIZE_T__ "
+.LASF1082:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1914:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF1420:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1933:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2346:
+	.string	"PID_ALT"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF702:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2534:
+	.string	"TASK_TELEMETRY"
+.LASF2195:
+	.string	"OWNER_BARO_CS"
+.LASF1599:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF488:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF480:
+	.string	"__STRING(x) #x"
+.LASF2041:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF1204:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1959:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF1112:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF946:
+	.string	"USE_RCSPLIT "
+.LASF1899:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF2429:
+	.string	"airModeActivateThreshold"
+.LASF1275:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1968:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF2048:
+	.string	"unsigned int"
+.LASF2434:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF989:
+	.string	"USE_UART4 "
+.LASF1207:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF786:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1797:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF2087:
+	.string	"blackboxConfig_s"
+.LASF2096:
+	.string	"blackboxConfig_t"
+.LASF2391:
+	.string	"MSP_EVALUATE_NON_MSP_DATA"
+.LASF1701:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1983:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF1421:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1970:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF511:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1277:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2283:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1324:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1728:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1967:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2311:
+	.string	"BOXPASSTHRU"
+.LASF694:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF464:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1212:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1665:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2174:
+	.string	"OWNER_ADC"
+.LASF2052:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF861:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2121:
+	.string	"accAlign"
+.LASF2614:
+	.string	"taskSerialCheck"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1600:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1828:
+	.string	"TRANSPONDER_PROVIDER_COUNT 3"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1798:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1873:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF2308:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF2094:
+	.string	"profile"
+.LASF1713:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1156:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2607:
+	.string	"newDeadline"
+.LASF2275:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF803:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF2092:
+	.string	"record_acc"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1020:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1464:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2177:
+	.string	"OWNER_ADC_EXT"
+.LASF2610:
+	.string	"fcTasksInit"
+.LASF1611:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1894:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF2329:
+	.string	"BOXFPVANGLEMIX"
+.LASF2105:
+	.string	"CW180_DEG"
+.LASF2235:
+	.string	"options"
+.LASF1627:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1062:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2197:
+	.string	"OWNER_OSD_CS"
+.LASF2006:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1754:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2396:
+	.string	"SERIALRX_SBUS"
+.LASF1080:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1634:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1545:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1524:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2547:
+	.string	"dynamicPriority"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1319:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1621:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1415:
+	.string	"IOCFG_IPD 0"
+.LASF2359:
+	.string	"modeColorIndexes_t"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1770:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2775:
+	.string	"rx_pwm.h"
+.LASF2784:
+	.string	"asyncfatfs.h"
+.LASF2653:
+	.string	"thread-shared-types.h"
+.LASF2782:
+	.string	"pwm_output.h"
+.LASF2649:
+	.string	"/usr/include"
+.LASF2792:
+	.string	"voltage_ids.h"
+.LASF2723:
+	.string	"endianness.h"
+.LASF2726:
+	.string	"select.h"
+.LASF2715:
+	.string	"floatn-common.h"
+.LASF2737:
+	.string	"stdint.h"
+.LASF2689:
+	.string	"fc_msp.h"
+.LASF2788:
+	.string	"osd.h"
+.LASF2766:
+	.string	"pthread_stack_min.h"
+.LASF2688:
+	.string	"altitude.h"
+.LASF2625:
+	.string	"src/main/build"
+.LASF2646:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2690:
+	.string	"barometer.h"
+.LASF2700:
+	.string	"stdbool.h"
+.LASF2774:
+	.string	"flash.h"
+.LASF2698:
+	.string	"fc_tasks.c"
+.LASF2705:
+	.string	"wordsize.h"
+.LASF2660:
+	.string	"color.h"
+.LASF2665:
+	.string	"bus.h"
+.LASF2695:
+	.string	"fc_dispatch.h"
+.LASF2641:
+	.string	"src/main/target/SITL"
+.LASF2655:
+	.string	"pthreadtypes.h"
+.LASF2658:
+	.string	"time.h"
+.LASF2777:
+	.string	"sound_beeper.h"
+.LASF2699:
+	.string	"stdc-predef.h"
+.LASF2752:
+	.string	"parameter_group_ids.h"
+.LASF2767:
+	.string	"io.h"
+.LASF2702:
+	.string	"libc-header-start.h"
+.LASF2721:
+	.string	"timer_t.h"
+.LASF2764:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2739:
+	.string	"platform.h"
+.LASF2650:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2630:
+	.string	"src/main/drivers/barometer"
+.LASF2659:
+	.string	"blackbox.h"
+.LASF2667:
+	.string	"resource.h"
+.LASF2732:
+	.string	"atomic_wide_counter.h"
+.LASF2795:
+	.string	"esc_sensor.h"
+.LASF2634:
+	.string	"src/main/flight"
+.LASF2696:
+	.string	"imu.h"
+.LASF2778:
+	.string	"vcd.h"
+.LASF2635:
+	.string	"src/main/io/asyncfatfs"
+.LASF2747:
+	.string	"debug.h"
+.LASF2744:
+	.string	"build_config.h"
+.LASF2675:
+	.string	"cli.h"
+.LASF2662:
+	.string	"accgyro.h"
+.LASF2759:
+	.string	"struct_tm.h"
+.LASF2645:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2751:
+	.string	"filter.h"
+.LASF2768:
+	.string	"io_def.h"
+.LASF2637:
+	.string	"src/main/msp"
+.LASF2703:
+	.string	"features.h"
+.LASF2644:
+	.string	"src/main"
+.LASF2748:
+	.string	"trace.h"
+.LASF2636:
+	.string	"src/main/io"
+.LASF2631:
+	.string	"src/main/drivers/compass"
+.LASF2763:
+	.string	"setjmp.h"
+.LASF2793:
+	.string	"sonar.h"
+.LASF2670:
+	.string	"streambuf.h"
+.LASF2704:
+	.string	"features-time64.h"
+.LASF2749:
+	.string	"axis.h"
+.LASF2685:
+	.string	"compass.h"
+.LASF2629:
+	.string	"src/main/drivers/accgyro"
+.LASF2786:
+	.string	"beeper.h"
+.LASF2733:
+	.string	"struct_rwlock.h"
+.LASF2674:
+	.string	"runtime_config.h"
+.LASF2669:
+	.string	"config.h"
+.LASF2709:
+	.string	"stubs.h"
+.LASF2686:
+	.string	"gyro.h"
+.LASF2717:
+	.string	"time64.h"
+.LASF2712:
+	.string	"waitflags.h"
+.LASF2657:
+	.string	"target.h"
+.LASF2691:
+	.string	"telemetry.h"
+.LASF2740:
+	.string	"common_fc_pre.h"
+.LASF2713:
+	.string	"waitstatus.h"
+.LASF2678:
+	.string	"msp_serial.h"
+.LASF2738:
+	.string	"wchar.h"
+.LASF2706:
+	.string	"timesize.h"
+.LASF2627:
+	.string	"src/main/common"
+.LASF2791:
+	.string	"current_ids.h"
+.LASF2683:
+	.string	"voltage.h"
+.LASF2679:
+	.string	"rx.h"
+.LASF2648:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2724:
+	.string	"byteswap.h"
+.LASF2754:
+	.string	"rcc_types.h"
+.LASF2694:
+	.string	"gps.h"
+.LASF2720:
+	.string	"time_t.h"
+.LASF2681:
+	.string	"acceleration.h"
+.LASF2711:
+	.string	"stddef.h"
+.LASF2676:
+	.string	"pid.h"
+.LASF2692:
+	.string	"flashfs.h"
+.LASF2633:
+	.string	"src/main/fc"
+.LASF2714:
+	.string	"floatn.h"
+.LASF2664:
+	.string	"bus_i2c.h"
+.LASF2762:
+	.string	"__locale_t.h"
+.LASF2677:
+	.string	"ledstrip.h"
+.LASF2746:
+	.string	"display.h"
+.LASF2783:
+	.string	"timer.h"
+.LASF2710:
+	.string	"stubs-64.h"
+.LASF2776:
+	.string	"sdcard.h"
+.LASF2743:
+	.string	"parameter_group.h"
+.LASF2682:
+	.string	"current.h"
+.LASF2781:
+	.string	"mixer.h"
+.LASF2639:
+	.string	"src/main/scheduler"
+.LASF2697:
+	.string	"feature.h"
+.LASF2771:
+	.string	"vtx_common.h"
+.LASF2750:
+	.string	"utils.h"
+.LASF2725:
+	.string	"uintn-identity.h"
+.LASF2757:
+	.string	"struct_sched_param.h"
+.LASF2673:
+	.string	"fc_core.h"
+.LASF2753:
+	.string	"exti.h"
+.LASF2680:
+	.string	"sensors.h"
+.LASF2758:
+	.string	"cpu-set.h"
+.LASF2719:
+	.string	"clockid_t.h"
+.LASF2666:
+	.string	"accgyro_mpu.h"
+.LASF2785:
+	.string	"fat_standard.h"
+.LASF2693:
+	.string	"rcsplit.h"
+.LASF2672:
+	.string	"rc_modes.h"
+.LASF2656:
+	.string	"stdint-uintn.h"
+.LASF2722:
+	.string	"endian.h"
+.LASF2745:
+	.string	"cms.h"
+.LASF2779:
+	.string	"fc_tasks.h"
+.LASF2718:
+	.string	"clock_t.h"
+.LASF2687:
+	.string	"scheduler.h"
+.LASF2773:
+	.string	"adc.h"
+.LASF2708:
+	.string	"long-double.h"
+.LASF2780:
+	.string	"rc_controls.h"
+.LASF2684:
+	.string	"battery.h"
+.LASF2707:
+	.string	"cdefs.h"
+.LASF2728:
+	.string	"__sigset_t.h"
+.LASF2638:
+	.string	"src/main/rx"
+.LASF2716:
+	.string	"typesizes.h"
+.LASF2624:
+	.string	"src/main/blackbox"
+.LASF2671:
+	.string	"msp.h"
+.LASF2772:
+	.string	"transponder_ir.h"
+.LASF2794:
+	.string	"sonar_hcsr04.h"
+.LASF2741:
+	.string	"common_fc_post.h"
+.LASF2761:
+	.string	"locale_t.h"
+.LASF2642:
+	.string	"src/main/target"
+.LASF2765:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2755:
+	.string	"pthread.h"
+.LASF2661:
+	.string	"sensor.h"
+.LASF2760:
+	.string	"struct_itimerspec.h"
+.LASF2787:
+	.string	"dashboard.h"
+.LASF0:
+	.string	"./src/main/fc/fc_tasks.c"
+.LASF2632:
+	.string	"src/main/drivers"
+.LASF2727:
+	.string	"sigset_t.h"
+.LASF2668:
+	.string	"serial.h"
+.LASF2736:
+	.string	"stdlib-float.h"
+.LASF2770:
+	.string	"stack_check.h"
+.LASF2701:
+	.string	"stdlib.h"
+.LASF2626:
+	.string	"src/main/cms"
+.LASF2730:
+	.string	"struct_timespec.h"
+.LASF2729:
+	.string	"struct_timeval.h"
+.LASF2769:
+	.string	"io_def_generated.h"
+.LASF2640:
+	.string	"src/main/sensors"
+.LASF2652:
+	.string	"stdint-intn.h"
+.LASF2734:
+	.string	"alloca.h"
+.LASF2789:
+	.string	"osd_slave.h"
+.LASF2790:
+	.string	"vtx_tramp.h"
+.LASF2628:
+	.string	"src/main/config"
+.LASF2651:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2654:
+	.string	"struct_mutex.h"
+.LASF2735:
+	.string	"stdlib-bsearch.h"
+.LASF2643:
+	.string	"src/main/telemetry"
+.LASF2742:
+	.string	"blackbox_fielddefs.h"
+.LASF2731:
+	.string	"pthreadtypes-arch.h"
+.LASF2663:
+	.string	"io_types.h"
+.LASF2756:
+	.string	"sched.h"
+.LASF2647:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375 \360e\006"
+	.string	"\344\n\344"
+	.string	"\027"
+	.string	"\324\334\244\217\006\002\002"
+	.string	"\002"
+	.string	"\002\351\375\235\234\013\002\002\001\002\001\004\366\371\266\316\016"
+	.string	"\006\214\222\347\352\002\b\336\235\341\311\013\004"
+	.string	"\002"
+	.string	"\n\247\215\333\264\004"
+	.string	"\013\333\374\366\242\t\f\307\222\370\260\013"
+	.string	"\r\210\331\325\364\005"
+	.string	"\016\347\230\200\264\n"
+	.string	"\017\376\376\316\323\004"
+	.string	"\020\214\361\272\261\003"
+	.string	"\022\213\313\376\226\r"
+	.string	"\023\376\303\253\241\n\026\305\352\265q\027\335\251\235\247\b"
+	.string	"\030\250\214\376\353\b\024\002\003\002\004\002\003\005\002\006\002\007\002\b\002\t\002\n\002\t\002\001"
+	.string	"\002\013\037\301\244\206\355\003,\240\342\234\212\n-./0\240\342\234\212\n"
+	.string	"\013"
+	.ascii	"@\004\334\225\322\226\235\253rz[\332\003\254\262\005\341\300"
+	.ascii	"R-\016(A6\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\275\003"
+	.string	"t\002#\001"
+	.string	"\021"
+	.string	"\001\001"
+	.string	"\002\004\006\b\n\001\013\f\r\016"
+	.string	"\001\017"
+	.string	""
+	.string	"\020\002\001\022\023\026\001\027\002\003"
+	.string	"\002\030"
+	.string	"\001"
+	.ascii	"' \240\202\261\263\016\b\300\334\241\360^#\330\320\334\360\t"
+	.ascii	"\365\005/\275\300k&\352\321b\261\212\262\271\362\204\205\007"
+	.ascii	"R\032c\301\r\013s6l\205xd+\240|nL\341\305\330\002\030\003\343"
+	.ascii	"\222#\3508\203\2703\325\006\\\335\274\001X\\\250!"
+	.text
+	.section	.gnu.lto_.inline.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\315\003U\013"
+	.string	"\242\314-2`M\323\030\220W\200\330"
+	.string	"V \035\003FD\361\177iI\214\332\347\203\030=\200d\005<\305\332\n\004\252"
+	.string	""
+	.string	""
+	.ascii	"@%k\364\303\266\245\355\023\"R\356\024\277LJ<D\204 (\250\206"
+	.ascii	"\363\270x\016\037l\240#\027\274\376\324\023wW\232\240\372\255"
+	.ascii	"\230\034\002\3770:[&\035\260\025?-*.\r^\331\270\264\016N=\024"
+	.ascii	"\227\326IS\270\215\306\004\3444h>*O\2304\201[QK\264\016\253:"
+	.ascii	"\221\023\222\352\350\222\030\266\311\210\206~aw\031\376\242\020"
+	.ascii	"\273\013\360\263\025\247|?E-\ne\022d\3138\324\t_\236\026\350"
+	.ascii	"\023rw7\312\177\030\345:[\006\177\340\247#F\250\001\0323$\224"
+	.ascii	"Aa\332\016`\"2fd\036\022 \322<\001\b\202 #P\n*#TF`\214\240\214"
+	.ascii	"\305TXc1T\244\200\207\033\350\035?\336\234\302\347\354\210\241"
+	.ascii	"\203\332]|\322vU6\300\027\261\245\364\270G{n\305L\335\355*U\351"
+	.ascii	"\004y\271\262&\242\302\211\314>H\266&\220\023\020\035\027'\373"
+	.ascii	"\351Tm\260@]\316\301\247\300B-&\236\025\217f\217\264c*\241>\323"
+	.ascii	"A\360\346\017\306)\306\215\241\224\025n\311\0130Z&L E\350>o\372"
+	.ascii	"\306\205\003\270\006\375\346'\242\364\001\025A/\310d\355\274"
+	.ascii	"\362,\202y\037(\2516\340\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\365\004\305\016"
+	.string	"F\222:3Pm\222\0160\013\033\302'6\270S \033\224\207b\26333\255\021\006\2653u\235\310\236\336X5\021U\341\231\016>\356\210Q[k\337\276\375\335H\223i\007)"
+	.string	","
+	.string	"."
+	.string	"\nx\004.0t\210%7\226\344R\324\206V\226e\331\rC\304O\273a\355\206\215\355+[\254z\277\210X\025\361\021"
+	.ascii	"%\222\370&\373\211\210\t\270\342)\256\305\027\007\b\tTs\026\006"
+	.ascii	"s'\333\020\3612hK\2058\275\351U\250N\371\331\223\357\311\216"
+	.ascii	"\r]\342\211\357}e\2452aT\025\310bq\356+/\227;\211"
+	.string	"\335\316q\255\215\333B!\313\322\340@+\220Y\3433\3264\372\314\311\34784\323\3507\031\210!\267\217tR\344\366\257t \316\325\3436\372\270-\212\332\326:n+x\300\336\244e\220e\231\323D\241\270\367\036EMp%i29\200\204\2501qE\227\224\244\2623\006\340\"\031*\363\021`D\214\214A\"\"3\024f\222J\033\301\234\223\"4\332\251\204\267\301\323\306\001\315\265=\333\225 \331\337p\323W\322^\025\371k\003\217\"\254\271\335\312\264\342\362\360r\374\206g\346=GiLw7\200\356B\037'n\375\371XAW`\303\301\301\251\204\251q\240T\360\004G\322\032\220i\2040?\276}o\341\242\360qJd\r|\307\257\217r\204\202\302{\302w\322C\256\314Vn\314\021E\253J\245\210ARmw\220{]\220\217\344\212\334\325\337\244\324\245P\252\374\"\357}\301\207\330\207\315\204V^\001\\\024\277"
+	.ascii	"\243\177\207` \003\322Hr\233+\306\034\022\t\247+p\250\361D\240"
+	.ascii	"\204\320Z\366Az\256\032\343\f \026\273h\324P\234K\177\023\244"
+	.ascii	"\356\203$\344\325V\335j\017"
+	.text
+	.section	.gnu.lto_.pureconst.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\b\230\004\n\230"
+	.ascii	"\004\013\230\004\f\230\004\r\230\004\016\230\004\017\230\004"
+	.ascii	"\020\230\004\022\230\004\023\230\004\026\230\004\027\230\004"
+	.ascii	"\030\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\003"
+	.string	"\342\305\021\033\240\033\2061\377\377\377\377\377\377\377\377\017\260,\313\222\341\233eI\327m\335\276\224)\377\322\2542+\314\3522@\313\2522\245L\316\352L%\023<6G\203q1\201xx\f\205\023\016\216L\202\025\200LWO\0257\001\030"
+	.ascii	" \213\225t`\031\326\342<\266\205\022\n\006\204 \002\302\305\302"
+	.ascii	"\306\200 \013a\240\210\233\205\300\270X\021\321\031\203%\f\220"
+	.ascii	"x\323\302\316\006h\f\026\207\001\026"
+	.text
+	.section	.gnu.lto_.lto.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.127.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"5\t"
+	.string	"\026QA< \005)\035\200l\201\252\250\022\022\202u\377\350\200\201\236!\2410\271\020Q\353\274\336\333\206\214\r\326\002\371[\202~$\201\244[\230\tzEQuV\200\203\b\031\036\355_\362\273\355\235R,"
+	.string	"0"
+	.string	"0"
+	.string	"\237\017\200N\035\332;\037I\226\243\315x\310\360\354n\235#\017/C\377.\027\2113\330%\007\261\273\226\342\f\344\236\267\215`[\302\266M\273\273\2365{r)8\007\266\335\217"
+	.string	""
+	.string	"\366FkLl\177d?\320\034.\355\257\234%|\013\207E\273!74\273\243\202\023B\247\244\027\200N\003\263\346\b\225[l\312\034\222~\f\306_\016\003\372%\247~e\310\213\247\002\267\216\306\206\274hR\307\204\231C\221\266\223\234\225=\366(\223S\304\376'f(5\234L\246\205RG"
+	.string	"R\240V\252\t\027\013\365}//\300^\007Z\200'W\205\227\252^\252\262T\247U\365>\260v\006n]\240\276\352j\265\276:\032c\017\013"
+	.string	"\325s\241\214\305\032\236\001\027\n\321h"
+	.ascii	"\346\376J\363t\301\317ZM\001wy\321N2"
+	.text
+	.section	.gnu.lto_taskSerialCheck.128.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\325\t"
+	.string	"V\322E= \345*\035\200q\002\002d\013A\276\352&j\354\247\255\214\270\356p"
+	.string	"\222Yaj\177u\r\006\237 \205\353\314I\0025\200\246\210H"
+	.string	"ACS\336\323r\202\206\3004X\355\023B\344\226)2"
+	.string	"5"
+	.string	"2"
+	.string	"\004\337z\377\377\t\265\356\332\3721\333\215\\\005IKw\245\354\261\256\235\256\357\216l\027\202\221\223\321^;1\n\335\375)\243]\354y\377\037\374o\370\237\022=\013"
+	.string	"\240U<\034\310\377\326\257\371G\026\"\256\023.\267\356\356\234!\263\336\b&\232\363_\221\255\265\326F\361\200n\r\333\255\273v\216\220Y\217\263\006\337z\335\006\253\221jj\357\23190\216\375\233?Kb\256\214\231\224\021\343\3271(\030\334,9Y\351\371\362\327\327\344\216\177\273\356\3563\307\377y\356\272\232\311\206\245\003\244IL\241J`\t!.\f\374\003\n\201$R\002\310S@\232\304\024\252T\252\304qd\205\002\017=\344\003\t\226\016\341\211\206'\252B\201)\032\216$\365l\276\212\020GZ\256\002\f"
+	.ascii	"Fe_=\027\312\264\b\303f\302a\225\326V\304\274kH\305\204\016\n"
+	.ascii	"-\241\356\230\332I\006"
+	.text
+	.section	.gnu.lto_taskHandleSerial.129.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`.\001}\016"
+	.string	"\206\333eG"
+	.string	"\261&\035\363!gN\340S\356\025\346\350\303|\307?\244\261\005\332a\263\222A\362\rVH_\177l\323\026\221\241\215m\312\251R)g%\210\333=a\320\372\373@\037.\b\200\017\330\335}:\361\377\377\226\220M\266L)N"
+	.string	"Q"
+	.string	"N"
+	.string	"\243\227l\237\332\005l\237\016m\240\2178\313\311\200,\240\b\332\335N~x\370\251I\r}\020\261\365)\252\271&\305\036;?*\304\232K\255@\f\206\006"
+	.string	"\342K+\361\221\325\370\354\212At\251r,\273k\205\211\031\356\355\266\027\330v`\237\0257\366u~\225\352s$#b\034d6\344\317\2704C<\266g\272\020a\373\366M\204!*2R\354\317\\B\t?V\030\265\306\245)\341\244\310\t\332\035\r|:\201\350\323Vy\221r}\t?\347$\302\353\310\370c\267\303\n\026\273\343\001\023\020}\006\273k\242\332\002\207\217\215\306\t}\250\215\232\240\207y\344\222-\213\360\350x\bX\254G\032\334.!\354\320x\251\220\375\235\237"
+	.string	"}\020^\261\364\260O\237\265}^\212\314\3300\243C\346r|v\020\236\0331Vw\330cK\245\007\373\332\356\256e\236\312C\020\003*0\251\274\225\004\217\202)\200K'(\336\312\212\311\t\211\004l`z91P\301\230R\251\3257\342\217\004\272\200\236\352\301\327\322}-\035\314\311{\351\276\024\330\221\006\030\025cJu*\024*\325\205\214{yc\226\031\351\232#jG8I\331\262J\273XF/\274l\002\025"
+	.ascii	"\325s\241L\213u\016azif\366Z\325\245\353\232'\254\004\\\201*"
+	.ascii	"\230\032n\200\202S\204h\036\242\004W\225\313\200\304\022g\334"
+	.ascii	"\345\233\355I\205YQ\253\240"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.130.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"E\f"
+	.string	"\206\026TC"
+	.string	"Q5\035p\312\302\220\030\204H'4\343U\031(g \375\030&\024\276\253n\3255\221@#U\005#\202\026\301c\224\356\346\360J\246\327\202\2667-"
+	.string	"\343@\001~`B3\337\320\0370\250\211\220-S\n>"
+	.string	">"
+	.string	"@"
+	.string	"\016\355\031/;\366\255\225\252Ucw\273\031\342\341\261\251\241\177\326'#y:\326\341\023K@\002BC"
+	.string	"\231\302,\034#\306\263\256\033HQu\203\260\273\326\221\344pg\267\035\301\266\004\373\023\002:A\330\307vw=?\330\252\336T}\216\002C\006\202\026\273\034\257\033\033\222\271 a\373\025\373A\313\301\325\376\211{\204G\241\301\223]\017,>vK\005>\300=\303\334\242=\303>@{\026\342<\031\200\313\343\035%$\037\323\027m\233g\235\023Y1\222\322\022\377\027\355s\233V\325J\324\227\375\024WQ\362E8\203I?>\363M\332\263\317\002#+\224\276L1\241\256\022\"\2536\354\362\024f\240i\300\331l\026h2\004\300\n\235\320\207\002I\324\371\276\222\027\300^\006\004\201\034\222\005\317\323y\236N\364\341\204:\357\003\273\214\001\217.t\276\2164\032}]\245\334\307\bAM\021Dy\021R\027\b\306\251\215\001\324\217\306\004\025"
+	.ascii	"\325s\241L\2130\254\265\260\217+\024\\\226\263\035zf\240\261"
+	.ascii	"\244\260S\030)$%\002\024$#$0\2300+w\322ehk5Z\334\345\251\232"
+	.ascii	"\234\242\251="
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.131.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\f"
+	.string	"vWWD"
+	.string	"\2216\035\360G\"\177o_\277\325w\013\350\266?L\221\013\224N\274\022\371j<Zh\344ef\350\245\336\fl\304E\344\277A\245@\017\206\372\006\271N\356\024z\307\004\346k\346\216\300s\373\317'{o\231RA"
+	.string	"@"
+	.string	"D"
+	.string	"\003\254O{6\215\207(\2339I\361\300\342ew\257H\342\336eT\317\377\3125\037X\272,y\224\037\251\0277:\340Iv\220\244|_\271~"
+	.string	"M\252\031\006\273k\375@\020\367\274\355\006\266\035\330\227\020\212\303\016K\032O\354\313\335]G\023\373*\277T\3657\023\302\227\032\037\253]\222U\216u\2310N\330>\307^`B\301\325~\212\253\360\256\322\301\232\335\021.ZvC\003."
+	.string	"\340\323\343\035\326\247|\261\002\313\214\223\306\270\243\362\232e[\bE\220\bN\tj\243\266h3\245`T?\311\362W\234\205\344\227p\206N\377}\372\235\365\351\221acDW\336\250PSe\2647p\320\177\3668\305\222=1\026F\265\001F"
+	.string	"J\200\201\200\034"
+	.string	"}<]\004M\024\2020\022\3218NC&\300\331\247\273\320a#\nY\310\225\205\\\"!Lte\\w}\bx\303\240q\327h\333\270\213\023\356\345F\023?@\3412\022M\022\013\320\"\004\352(1\251\226h\222\365\027"
+	.ascii	"\325s\341\214i0\262\001\240-\337\333K\312\002\332\245\002$\360"
+	.ascii	"\205\261\275yfY\327\035\\\330\261s\025\3105\302\2152e\257\236"
+	.ascii	"\326\331e\024k5Z\334\345\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_taskUpdateCompass.132.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\365\n"
+	.string	"\266\024NC\020mj:\320F%P\214\314\223\352\334<U&"
+	.string	"c\340\b\3420=\347\367a\025\243Rr$\232\276#\027\326\336\t\236\f%,\202\t\264\313\301\001\204\27106\244\034\005(\240"
+	.string	">\300\005\202F\332\3362\245:"
+	.string	":"
+	.string	"8"
+	.string	";A\231p\260A\305\356n\262\302\301O\251\240\377\325+\241(\372\244D\270\234\036.\017)0\304\322\274\230,\204_]\037\210$\325I\311\356ZC\021\302\215\3356"
+	.string	"\333\001l\277\002\237XD\220\320:\354\232Z\260\330\026\366\341\202\355\333\037A\333b\223H\030\271~\345cx\006\360\252\006\256\354R\b\301\332\035?\334A9\306\361Kvl>#;f\320F\3611\025]\002}\350)EO\275\\,i\006\331\245\001\r'J\372r\246\224\2072[\301\002}x\211\231P\222\"+\007\020%VW\330#I%\312\376\334\335\265<\331W\375\231\252\003\016\301\210h2\031\020\214\246\361\021\330x:\003@\237\215\347\205\270\013s\332w\340\323\200\np\234\215\343l\237\216\306\263q\336\267i\033\356\020l\274\r\324u\336f\031G\227'\013\030\321\032I\322\254h&\355\r"
+	.ascii	"\325s\341L\213w\016\311\032\252\013{\t\325*\020\3505\304\302"
+	.ascii	"\020\312\3502Q\334\271\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.133.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\365\f"
+	.string	"\006\231[D\360\2226\035\"j2\237T\036\026\347\262\343\264\360\020W\035\316\240\334\356\362}\236\213\276h8\006b%$\004x\265\r\277\037\221\256!\036\257\337\245\225cBT"
+	.string	"\177\210\257$\017\223m}|Q\273\t\331[\246\024E"
+	.string	"H"
+	.string	"D"
+	.ascii	"\027P\235\262g\337x\370\262\226\013\217\016-v\354\356\214'\356"
+	.ascii	"]F\365\374\227\016\002\222\276\313k\304\243<`\212"
+	.string	"\221\3431W\020\244\221\fYA\001\276t\375@RQ\265\032\354\256\025$\211\270\251\333v`{\202}\2223vWj|,\r%#\205\355g5\331e\036b\f6\263\037\303B\303\365\205\270`p\370a\332\r\021\234\362\203\353\324\375\320\2631;\303\221]_\362U|\205w\230\024\203\354\232x1\263\033&\260\201\353T\201\207T\247d\361\263\214\0169E=\214XvWD\377r2\315Dg\250\036+\310\330\030\351\311\226\312w\225}\202\242\007\0379,\243\370\031;\251\013\0355V{\330\341\247\321\305\276\334\335ul\261\017\363\313\250\276\025\200\004\215\031\033\310s\301Bg#A\331@\230\025p\026tFFD8\233\001\235\204\355\343\211 \002m\034w\242\001\260\266\351L\272\216\210\202V2\265\222\t\362t>S\343\272\271!\340\020\206\215\233\242P\210\233X\270\227\033[ \224\240\331\020U$\246\266\311G\017:\006\021"
+	.ascii	"\325s\341\214i%j\330i+<\300\333*YB\205\004YE\330\025\032\354"
+	.ascii	"\2554O.\bY,/P\345\021\327rL!\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.134.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"=\013"
+	.string	"\306\225P?\020O5\035@\216\005\247\226*\3106\002\365\002\215\271u\036"
+	.string	"0j\352\177\211"
+	.string	"\230U\230\224\257\215xzo\325S\271n\230\271\312?"
+	.string	"A\005\311\371o\326\255\b\241\3569)=\377\337\332\336;\245="
+	.string	"<"
+	.string	"="
+	.string	".>\246\326\201\"] !cw5\212\372\367J\347\347\177uH(\202\257\217\r\247\265"
+	.string	"i\"\006"
+	.string	"qT'$\017\341W\237\030D\321\234\016\005\273\353\031\212\032n\354\266\027\330f`?\013\177\235\323wP\\\245\362\005\246\304.\251\006\215U\201\235\370`\373\366\307\317\216\330\227\024\227\317\257\374\020\027\361]U\301\220\335\016(X\273\243\001\023x\034\033\360Iv\254>@v\314\237\035\021\346CW\n>\365\"Y\224\236|\n\331\351G\260\340\320Z\321b4_\316f}(\263%L\230\017O?-\020%9\242\240%\255\f%\214\2353\354\021\234\364d\277\356\356\232\232\354\253\002F`I\220\301`\016X*\022\317\201\246\303i"
+	.string	"\362h\272.\264mx\253x\020\274\f\350\301\266\321\266\215\346\341d:\332\326yZE\200\271\217\246\323@\034\327i\221q_\227\232Lq\225J\322\002\025U\310\254\324\346\002\f"
+	.ascii	"\325s\341\214i\006jc\253\3452,+\264U#D\322\311\334]\272L\024"
+	.ascii	"w.f;40\005\005"
+	.text
+	.section	.gnu.lto_taskTelemetry.135.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\001\001\035\r"
+	.string	"\246Y\\D\020\221\223\016\363\225\247\307\350\201\367"
+	.string	"\004\022F\036\317\262\022@1\241\020\026m\220-\271CpL\333'\350\251\203\266<\255Eq\261\222\006\306_X\005(\261\352\336s\270\025P\304\375tX0\263f7\331R\246\024G"
+	.string	"D"
+	.string	"I"
+	.ascii	"\360\001\342/o\366\214\177/\273q\201\341\240\002\307\356b\352"
+	.ascii	"\362\355\027\324\334\374\253\336\351<\356\027\347\303\241\307"
+	.ascii	"K\245\302\002"
+	.string	"4.n|\274\r\020d\005\246\273\352\331\301Cen\030\354\256\263\363<\334\361\266%\330n`\377A\231\303\376\270\324\026\373pw\327\312b?\346\217\232\316L\277\363\331\001cAkw\245\245cY\327\213\022\266o\377\333l\217=\262b\344y\225\177\342(\266\307hpgW\004\013\231\335\317\200\tp~\205\034$\376\n\317\020S?b%\343#9{\013\321\036\231\344\273\324\t!R\312\375/542jR\274VX\315\244\262\306~\212\257H>\t\227P\362\335/\037%\376\272z\314\200P\311\226?6b\332)\030\362\235CP\3129[\324\210\261\001F \222 DBr@\004$\300\024AD\032A8\235\2104-%\373p\0062\231\230B'\nY\t\226\225`'\243\020\t\3134\023\006\032\340\322\005\221\206\235J%\r\363|{\270\312\342\240\305RQ\324\005 \243\332\241,\337\031*g\005,\032&\240\2668\022"
+	.ascii	"\325s\341\214i-j8k+\231\301\313\n\262@pp\307U\326\300\352\013"
+	.ascii	"\2735\030+\352l\370t\3018\336\334\020\304\251j U\307\204\002"
+	.text
+	.section	.gnu.lto_taskBlackbox.136.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\226\001\r\020"
+	.string	"\366\036mG\360\260(\035\370{\357\311\237\020\t\261|\005K\247x\n\325t=~\210}v?\037\326\200\274UV\360\366\377\031i\264\366\320O\355\245\311\346sp\360FV\342\314\255\200\"j\264\257\032\2479\\\2652F#\233l)S\nX"
+	.string	"U"
+	.string	"W"
+	.string	"\017\221\337\342\t\310on\3318^\233\231\234\314\fY\212\2369\247\2672o\235\223[\\m\371\334\311\007\030\272\316\201\270\224u\320\r\344\362\330\205\26182\347\024\205\034tc\002\236\0279Da,\206\264\220"
+	.ascii	"O\273\262\2040U\356d\316i\005C\0177\350\2665\330\216`_E\337\003"
+	.ascii	"://\375\261\272\220ac\352\016\273\006"
+	.string	"\323\235\331\217s\316\351\215\261_\363\207T\335E5\247j\271\352\250\352\213\006|\250\001A\307\234-?<f\316\006\243\204\355\333\257\265\354\316.1Qr=\315?q\232\326k6\370c\316\020-p\346\25410\002\320\267\221r\001\004\350\t)\267\266\005\223\036t\007\023[\227\334v\366\025a\263\"F\314 \343\352\316\315NL}\f\242\366\t\245\007\343\236\006\006\266\256\177\306\207\007g-\"\273=\355 ;7:1\365\361/\"\277\335Ze/0\375\261\217\3426+\376\b\253Xz\360\233\317\222\337\002v@\362\200db\322\200dT@E\241t2MX\251\224R)\326\027\3627R]P\221V(_\212\367\245x*&\322\311\373R*od\300(\f\245\224\267B\241R^W{=\316\215\261\004\227\234\327\302\314\t\320\320\332($=\350\270.\253\334\2315*\270\336\350Ac\027\234[\026{E\312\255\300\342\013\036"
+	.string	"\325s\341\214\351w\262\201\240\265\300\327\3653\267`\227\030\306\2420\265\230\026@\016.3\331p,\233\246e\327nL\271\231aKU9\210\352\"N\201\230pf\227\211\303\335\007F\031*\317Ry;["
+	.ascii	"xT5\244w\025("
+	.text
+	.section	.gnu.lto_fcTasksInit.137.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`#\013\3252"
+	.string	"\332T`\022G`ZR:y6\355\2636\206Q\221\330\004\3722z\375\333"
+	.string	"~\177\242\362-2\"\277\377m\330o6\200\033t}\242\252h\263`\360\307}\017%\306w{\327\340\005\352]'w1\301\277\362\277\362\277\375\237\020\"w\222\001\021\001\367"
+	.ascii	"\027\001\304\276\274\323\227\207\351ea_\016\3762\360^\376\375"
+	.ascii	"\262\357^^\373\262\372\313\351\275\334\367\362\375\345\207\220"
+	.ascii	"@\367\325Uf\246\327<[\033{t\3329\265K\221\267\375\317_\346\377"
+	.ascii	"\311\335\376\306\302\243\252'\235\211\2546\2400wlK8\374\256\036"
+	.ascii	"uM(\222\300\236\rj\031\365lm\024\211\201c\273k\333\247\320Uf"
+	.ascii	"\360\273\312,\363\233?\311\332[)c5\345\256m[\242\026r\366\312"
+	.ascii	"$\222\347h,\022w\206\302 \360\347[\325\264/\313\367%\001\257"
+	.ascii	"\262\242\256L\242\235]\244/\351\307\r\264\363\244FTw]\207b\231"
+	.ascii	"\245\303<\2534W\303\032r\217he\327H\366\"\031\361\013\354\356"
+	.ascii	"\004\375\270\341\365\241\327\025v\251a\365\270A(\026\017\340"
+	.ascii	"\245x\374\007\305\342\272\217\230e\225.\333\266\375\333\203\324"
+	.ascii	"\260v\334U\307\325*\252\233\342x\247\016\242\\\346\020\263\234"
+	.ascii	"\251\322\006\221\253\277\375\322\310\232\272\327\227\324\266"
+	.ascii	"-\337\253\254\033\347\2363\277\212\231c0\007\227\001\367]\337"
+	.ascii	"\335\332\217\273\334\332\300\035H;\250\332\306+\255i\253\375"
+	.ascii	"\300\252\216\324\335\223\362\264\277\025\346\004kS.c\272\357"
+	.ascii	"\265|\013\223\177\306\0326lX\257v\003w\334\353yg\367s\207\376"
+	.ascii	"+g\356\340\001L\317\275\375+\255\314!DPu\0243\217\270\025\346"
+	.ascii	"\257m\333#>\225W!\301?\273\312%\226T\376\322z\3656\260M\352\356"
+	.ascii	"\361\320K\034\364dyQ\270>\324\372>\021\205\215\363\3461\361\376"
+	.ascii	"\314\2259\205\212\373\253\267Q\230\263\243\030\331\005\032\274"
+	.ascii	"\314.\232\356\257x9\325Q\254\354\021\305\263k\257\036\363s\352"
+	.ascii	"\366\030\363\323\266\2010\253\227?\274\355\234\364\347\031\251"
+	.ascii	"//\350\313\n\372r\002\337e\004\277|\240/\033\370\345\240_^\376"
+	.ascii	"r\201\276\f\364\313\004\372\362\200_\026\320\227\003\374\362"
+	.ascii	"O_\006\360\313>\277\254\374\345\344/#\3732\317z\371\330\227\215"
+	.ascii	"\352\345\342\275\034=l ,\364\004\335C\316\340\\\330c|\201B'\246"
+	.ascii	"\255\021\371\r=A\323\210\363\017\375\267\277\306\220c\027\373"
+	.ascii	"C\363\265\3021\245\344P\330#P\277\252\263\335(L\352\352\375\202"
+	.ascii	"\312&\252\031\333\226\365\241l\037X\312_\236,!\003\366\330;\016"
+	.ascii	"\215\230\233_\262\373\215\330\367\352$\373Z\352n\333\266Q>d\023"
+	.ascii	"\325\306N\207\025\242\207\354\333f\215\214\247\201I\315\223\226"
+	.ascii	"\324o3[\217\235T\3669\254\231\234\343\035\236\261\177Hm\354["
+	.ascii	"\325\271`\274\240\355\325c\244\376\363K\251\263E\326b#\365\263"
+	.ascii	"X}\231B{\224-\362\346p\330\2645\026\t\222\365j\261o\364\013\255"
+	.ascii	"\355\230\026\006\317\216\330W\363\235&6\005\347\363\034\267\356"
+	.ascii	"\264\032W\325d\352\356\261\260\207}%g\3032\371\265\255\363\210"
+	.ascii	"O\367:\326\t\373\204uc\335\326\253\302\246P\227fd\355\301\021"
+	.ascii	"\354\024\330\3011\300\013F\013\272\366\334_\237\314"
+	.string	"+|\316\314\317\\\300\220!\303z\365\327\3006\260\271\036z\321S{lJ\314\024KO-\232@<\275`6\2332.\034\271\310H\302\322\204\t\021\214 $\235\236\232\314\026\025f4\231OOK\026\230N2\214\314\004\301\211\205\323\322S\t&\024DL(\210^\250XrA\304\324t\"\202\360\303M0\230M\242\247\246\246&\221\360)\365\006\302\252\\\030^T\252\247X\031\344q\r\312\242bI\340\211$\267\270\034\313\326\\\024Y\204;s\275_D97#:0,\236\036\343\337Y\255\025A7\243\3249o^\326\025c\265\256\217\373\203\315\261\305rq\255W\021\264O]\233\234\223#Q\350\215\206\211\231\342\320\027\034\350\023]?\320F>K\ft1\250\r\004\365\271\222,h\242\321\f\n\0251\305e7t\331\355\206\t\034^\324\331Q\2278\024\372\212+=\254\266\b\207\256\240i\024\350\206j\025\350o\371\360"
+	.string	"\352\035\002\r\224\022h\266\316\200\036\n\350\001?\001\375\034a\316h\200\026\376t\200\237\206\ns\216\001\320\276+\255>\r\240\3502\263^,\330\375\225\317\327\242j\023\250\202\016^i\025\206Qu\324\272\323ci\200\345\250\201$\206\031S2\"#\222\244 \3110\006\320\002\021\231\"\356\021\320 \204\016\262\221$\316\236\001%\361\022@\204 \243#\346\326\352\343B\236\211\301:\373mK\223G\0343\275\fwG\b\305g)\247%\262\334\337\251\304\325\203m\234\310\264D\340\315\276\343\b\361\303\3068\022y\234r\260\240o\242\001\356t\210\345\220\332X3\005\366l\373\3159\215l{Q\004\njz\024\274\236?I\207\346\320\236~U\375\255\033#\344\207\357A;\007\034\246\301`\215c\365\347\223\331(5\376\303\271\222/\305\216\022k\235\031YHm\367JN\354/\324\274[#q\"\354\273@"
+	.string	"J\301\340\305^\247\347\336Kx\254\235h\024t?\352\235\227h\341\223\f\235\254A\271g\223\245\326%\225\035;\260\241q:\365C\340\340jMU\203`\360?\274\007tas\030\252\244|\213\263\367\007\277w\204\016P\245\237\237\255\326\207\235\003e\f\270\337#)\360C\007\361\020\267\270\237k\246\3165\177\240\t)\342t@%\003p\r\243\345\220J\207S\246\210\342\"bD\355(Z\\N\0035o\031\224\033:5O\377]#Gon\343\275O\220\240x\n\360*\250\2426;\317]\005\333.\350\234`\020`N\223\310\342\326\276\371\321\025zh.\2327[\230A\313\007XT\343g^U\256\234C\376\257`\362\246\037\263\257\352\266\343\317b\241h\217LS\022\317##\rH\372"
+	.ascii	"\362!\026\375h\301M\020\267\310\021\306;W\212\243+\301\t\354"
+	.ascii	"s\310\361\304\220',\275\0230\"\f9\33766$U\234\342\355\025`R\236"
+	.ascii	"\275)\rT\003"
+	.text
+	.section	.gnu.lto_cfTasks.138.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`=\005\255\035"
+	.string	"\2261\274FphU\007\3111\212R\223B\211\364\224\023\340\004\254\224\301\274S\\\344Xu\232x\237@p&|\035\352\371%V-\277\220qj\357h\237\177\340\3771}\315\313\216:t\207._(\242\b\235O\362\270q\251wJ2\253"
+	.string	"\254"
+	.string	"\246"
+	.string	"\333\203q\211\034\240\004\372R{\0312\037j\306.\020\250\273K\332yKK\363t\265\bh\001}K\273\2300\276\2321\314\202\322\316[WH\334\n\252"
+	.string	"\326\317\273"
+	.ascii	"\335\213v0_z5 \314w\004\352R(\261\363V\022"
+	.string	"\212\301\321\rT\375\334\n\350Y\264o\321\342;\213Y&P\027\302\211\355`\252\37145\0346af>\340\bd\236]\352\347S@\247\322n%(l0\224\321T\3013\366**jNL\344p\350\256@]\242!\317\230\305~\005NL\2536\315\341\260\311ix\226\3358:\346\222y>}\201\3143\316\3028\207\bA!\321\277\330O\316\342\026(\250\353PCQ\366\224\374u\205\334Tv^^\275Xc\332\003\001\332Rgq\371\016\207\356\246B]?n+;/\321\360\001\372\253\335O\037\337Y\364z\235\230\332\362\362K\b\216c.=\332\367\204\335\316\242\230\303Pw^\212\2753:@\257\243\375\216\235\333Y\034C\342P\227\t\303\316\313\261\327\205\034\001|\001\035\216v9q\216\316b\235W\207\272\"4l\007U\336\247)\001NW\002\260\001z\033\355L7l\315\230D\"\241n\022\207\355\301\230|qR\207"
+	.string	",4\332\325\244QQ3*\337\rC\2361/\316\345f\374\214w\371\032\177\343^>\307\301\034\217\347q\261\t\376\307\233?\374\026\357~\214\257\3616^\307\357\370\342\033\177\210\2047\022a\007y\255\177z\"\372\213\374qK\235\304..CvV2\027"
+	.string	"\321\357\264\243^HPH\364A>\234\304\257\327\253\210\200\025\331Y\t\366\317\343{\350\367\261\243\236\030\024\022\375\017\366$\332y\235\352\310\236\222\275\302\222\354\254\f;\245\376\206\376\034Aa\003\034[\311I\344\263\004u]\n\223\235\225\315\240\227\241\237\306\317\360\235\304@\310&NvV\006z\021T}\223~\027;\352a\004\370HmY\036+\204u+\357\226\261\021n\027\204s\252\315\226\312\332t\206;\254'\316\245\270Ue\205\360\005[\233\356X\234\321\f\253\267\264\315\3516\264\031\324uE\262\031\300l\273\252\2714\211\267\252m\233\026\025\300\354\356\026\204Y6\335\035\351l(\326\255iQ\306\252\021R\213ks\351\f\363\326V=Rsj\013"
+	.string	"w\320\025a\260\245\271\242\031nq\271\035k[Q\334{\240Mh%\246\244\036\tZ\217\004\r\205O\351\004\255\267\244i\017\022\340_\212\021K4\246\337o\211\026"
+	.string	"\373\025\307\342W\316\305\223\236\345c\002n\2501D\206\030\304Ra\262\327\034\360B\021+z\020(\245\212\252\034\003I\217D\002{o\204\013\234\334c7\021]\226V\314\025\342b\036m+ov\030\\\316I\274\036.\265\240Aj\003\302\353\221m\304\325\361\3363\221m`P"
+	.string	"Q_\215\331.$\035\324\306\260\312\251\001\027n\265:\323\b\b5\330G}y\251>\311 \214f,\024\260"
+	.string	"\333\035\233(\340\343)\261"
+	.ascii	"\262\022\b5\233\213S\236\232QY@wo(\227\226\220i\345n\255-JR\211"
+	.ascii	"B1\325s\346b\343v\300pF\257\261\2775\002\f\375S\223\231\341?"
+	.ascii	"\203\266\004\336\334\031F\016+\020\303\306\336\357\241\203\324"
+	.ascii	"a,t\252Q\277 c\236"
+	.text
+	.section	.gnu.lto_taskBlackbox.part.0.191.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`~\001\355\017"
+	.string	"F\035kH\320TQ:\340\252\006\245\340\"\276\354\215t\007\025\027\272\365\246"
+	.string	"\204\3742\340X\214\210\\\235\367\332\254\005+\252uB\030j$F\354\332e+\2130\322\244\243\324\203\205\366\311u\3020:1m\016\331lF~${\357\235RQ"
+	.string	"U"
+	.string	"U"
+	.string	"O\351N\347\007t\247\366a\330~\335\030f\013y\245-\211O\217\017A\271\335\365N\245\317a\2372R\230\177\333Kd\263\231\317(\233\345\\\316\0048\034E\002\314b3\305F\205\354\266G\020\263\232\030\005\234\222@\330]\223t\356\356\266#\330\306`\377E;\242\322p\036\324\200\304\310m\254*x\320e\304\030\206@\245\341\230\210 \362\320\"\267[\275SW\322\355;\3467S\035G\\\354n\351\276\355e\227|\033\314.\371u \231Ywvsbq\212\361\325\257\375\007v \031\227\354\356\b\r\355\326\005\247F@:U\t\262\3076\253\273\374\211[\220X,\262\275\272\020\213\264\033;\3714^\003\364Q\234zC\030/;\365Ci\243\004\216D\355\207&\036\331\204\310\316o\177N\212\035!\210\206l4\212\262\307\222\316\225<\366\353\037i\364;\224\003<vm\216\214\254\t\232c\305\214\227af\276`\352"
+	.string	"\266\254>T\206\026\003n\260\342"
+	.string	"\305\302\302`\305\204\022RH\261T\023\\/\251V\213\303w\342\317\024\256B\224\253\302\347\342}.\336\213\n\305\362\276V\350\231\n\030\324\220jy.\020ly\245\317\225<\226\240\343\203F\326\314\223\030\245mA\025/\263JL\316\030\300\r\243\037\362\247\025\341\206d\037"
+	.ascii	"\254\302\201`|\365,<\"\033\303\324\206W[\017Cw\322c\266\260\337"
+	.ascii	"\212Y)\231\tm\313\276\230\366\003\242`\230\353\332\031\3130P"
+	.ascii	"&\364t(\365\026\006\021`\343^\t\366\362\254c>\003\330L\336i6"
+	.ascii	"\270\366b\212CS\343\336U\306"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.192.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"M\n"
+	.string	"\226SF:0\257\322\001\200H\214\341\204\221\304\3003\331B\3210{\303c1\201\213\337i\352\033\306\fx\013\255\371\212 \002\0374\025\006\006.p\314\006\212\\lN\377\316w\374\266\311\336)\0053"
+	.string	"3"
+	.string	"6"
+	.string	"\"\266_3\213v\313\307\217\325\334@2J\\v\267\236\316\333\305O\351\211\376s\347\310h\260O"
+	.string	"\332\306%\301=\315\302\356z\303q\323\333\036\331f\260\377\t\267\237{\331\035?'\332\235S\333\257\343\\\336\270\264\031\311\204$\345G\177\344$\342q.sv=NRvG\204S\037lNA\377dN\275{2\247\366\003\02736\247\315\366F~\332\023!\306\204y"
+	.string	"\206J\273\302B^fPl\302\034\200\362\302\2622FN\233\247\347\355\254\331\037\377SO\325\355j\354t\333AUBl\007V\020\215L\245R\202(T\020>\234T)\207\326\352\004\202\024\237\200\277P\030\021\232Z\020\037\252~\250\272J\231T\365\003\303\03220K\342\004\326\026\213\005\326\216myog\315\r\273\225\022"
+	.ascii	"\334\263\260\203\032\306Y\343+R9\257\320\331\032x\n\220\271\272"
+	.ascii	"\275j\226\346\251\322|\332m3e\247\001\340\332\213)\247\345\364"
+	.ascii	"k\313\030"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.part.0.193.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\035\f"
+	.string	"\346\326SC q\223\016p\021\215\213A\003\341\346\302\207b\230"
+	.string	"\b\023\300\234\207\205i \301\244\337\234\0334o\321\216(\374\006\214\tcg\033Z\220\n\005\325# \265\235R\230, (\320\215\337\351\352\326\310\336R\246\024?"
+	.string	";"
+	.string	"B"
+	.string	"\367T\026\223\222\322\220\302\306\356Z\217\232\362\355P3n\376\277k\270\316t\230\\\307\341\n\023\270\260\250\021\240CANJ\004\367\357\271\241;e\016x\3044\330]g:\334\325m?\260\355\300>(\366\355\177%{\343\177\233\275y\264]\372\n\t\364\2663\t\305\be\336\363M\374\304\366\025\022kvA\300`\331\365\024<\032A\346\261sN\365\bO\240z\264_\302v\311\304\233M#(5\271c\205\013\031\2337\254\277\312\213\013\213*\212m\f\325u\002\212\031\250|q\225\366\310\205<w=PB\242\345\244\246T\024k\204\253'\366\275?5}\314U\204\020\340a7\225\003\307~\210-F8f\360\001\211<<\026|<\005\264\b\243\020\020\b$\221Q\226\215\\"
+	.string	"|y4\n\232\210$\341\372\260\256\017K\004D\024b]\231fy\f\030\2530\312,\022\206e\326\346p\365\304Z\362\242%\203\236\240&Sm\314B\236s'\023"
+	.string	"\325\263P\3706|\226\215\257\326\260@\327I\357\005\006\353"
+	.ascii	"Q0\314u\255\224\306n\236%\315g\3306Sv\032\b\256\275\230\342\320"
+	.ascii	"\324\270w\2251"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.194.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\230\001\235\017"
+	.string	"\366\334gF\360\220*\035Rtc|0cD\315\3004\203\316\201\332\236\352r`\372[\230\374M\241<\324\253\371\004\326f\314\366_\203\331Z\234\020\203\306R\275\017G\232\023z!\303\035p\370\260`\262\364N\343^\221O6\331;\245P"
+	.string	"R"
+	.string	"P"
+	.string	"\257\3357\336\353\264}\022\266O-\243\354\027\207\255lFeF\206\231\214\335\r_i\210\243\336\321YQ\376e\337`\225\251w\223Uv8\355\f\340T\304\350(W\235\307\211\b\326m\237\033J\325\234\001^3\fv\327\237\207\333\273m\b\266'\330o\021\006W\260-[bN|\3551\237\266`E\373\264Y\351K\265\276\233I\r\334\203\357\365~\354\344\313\254\261}\372\313\004\242\034x\365c([\363\212\301\246\251a\345\332\335\017\021\2068\347a~\211\233@\375e\362\306.\210\024-\2730\004.\360\275\202\367\360\002\270\026Z\362NI\231\213\325|1\007K\316e\351k\0073\323\036\221\314\263N\217\342R\321\224o\3739\260\320p\331\351\243\2300\376\353nP2aL+U\261\337-M\261\357m\b\304\354\236\344b\326UW\214x\355\217}\332\367k?\341\333h\263Rc\350c\241BgtP\032C\032'"
+	.string	"Q\320\t\t\371"
+	.string	"\341\b\030I\030A\237\b\244\320H\222$\036"
+	.ascii	"\366pF#\243\016\211\202G$\364\210\204\241O\007\024z\310Q\310"
+	.ascii	"\031`\321\205\221\fI\"\021\031\316\323\024\331\277\333\007\026"
+	.ascii	"%T\325i\346\351\346#\236\r\022\315\263\f\232\320\224;n\345W^"
+	.ascii	"\002\" p\002\231\272\335\324\266@\020\313\372\341\020\0362\005"
+	.ascii	"\t\032\356\220\360\330\013\323\002\241}G-L\020s6\240\021J\224"
+	.ascii	"\220q\f\247)\206B\3027\356\371d\r\242\b\206$\243\315y\225:c\231"
+	.ascii	"\321\240z\013\253\363\366e\203\344\305\367\320|\334\273\360\030"
+	.text
+	.section	.gnu.lto_taskUpdateCompass.part.0.195.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`7\001M\016"
+	.string	"\206\031_F\360\224\223\016(\314\030D1h\374T\341\307\331U\300-W(I\263\270\264\241\027\371*\211\270GD\207\021Q\037\365\177\2335H=\343X$>!\316w`\263Izq\276\262\271\356\337\315\027*R+\177\334{\357\224\002C"
+	.string	"L"
+	.string	"M"
+	.string	"\f.\255"
+	.ascii	"\273L\360\002&\227\361\003L.\355\303\260\235\252qg\017ym\355"
+	.ascii	"\t+\310\007\236\327\356\316K\230\342\335\341\213\235\177\327"
+	.ascii	"A\252\025\315ah"
+	.string	"5\342/\345\361d\302\356\032#q\313\333^\261\355b?DqM\324\226M\004\0265\347\265\034\352\202\363|\206\214Q\006j\313&\200\217\020\017/^\273u^\272b\267\314w\f*r$\273\357J\331\231\357\352\354\314\251\353\314\304\272\253\032\b%\036\274\367\352\307\270\214\356:3\006\355\336\354\270\261[\003\276\215R\215\367l\276\212Kg@\275\253.C\367\017\264i\314\273\312w\035\003\322\303\005\022\"\035 \215\005\340\270\371\316\177b\205\017\210\037#(=:~\354K\362 \3130\306\2058\366\353\377\230\"!gW\304\022%\213B\346hA#eTv\021Q:\202)m\332\244\334FM$\212\300\016TVF,,\rTD\004\250\005R\351\245\302\311D\342\270\030\r\2005\021\305@G\247\013Z\313\324Z\246\351eT\232\032G\247\350\2007\030\0227O\333\306\315\354q!\216)\360\360\241\001n\200\220e;\364\002\036"
+	.string	"@0\276z\026n\220\rKj\030\267\346\f\224\032=\026\314\330\210i}\305\032@\024\fs]k\262L"
+	.string	"eBO\207Roa\020a#"
+	.ascii	"\324\3428X\254\022\302\345Y\307|\006\260\231\274\323,p\355\305"
+	.ascii	"\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.196.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\224\001\245\017"
+	.string	"f]iG\340\262(\035\312B\"\227\346\234\203\204r\033\372\2646\1774\035\365\020\013\332\001\005\265LbB\004\n`\337bV9\210\177\025\345\225\300\022\004t\\*C\b\222\0217\354\364\205\362\023\002\210\020\266\216\254;|D6\3312\245O"
+	.string	"V"
+	.string	"S"
+	.ascii	"\372\321_q\026\342e*\207\354\212\210!cwl"
+	.string	"\340\005\237\317\320\017t\237\334\013t\237j\373)l\257<X\264w>\346,\310\210\035\027\215gw\275OI\342\342\245r\242\317\272\004P\363\341*r\016$ew\375\001q\317\333v`\333\202}\037\001\235ZN\265N\365;\021\0056vin=66i\2348\355\237]\355\333\237\255|\332k\006y\265\272L\025\222\031\267\346\201\215\216\317D\320\347\t\016\023\373.<*\021\337\002&\304\032\227f\224\363B\005\317\356\310\340\323\021>\237\033\254\322\0162\261\335\0359\251a\242\001\372\227C3\222e\225R\336\365CuB\334X\033\007\230\317\356~\246v\016E\254\365\004\335\245J\253\013\026\2437\3730\256S\362K\330\344\242\177\271t\237\227\001r\330\230\200\265\364\346\327>a\006\214\307\216U\211c\323\036_\366\267\264\307\222\2238\366\271\2257v_\352\203\320\202\222\020\246\276\227\f\237\206p\200G$%\037\n\312\b\211\310"
+	.string	"\252BX\"QH\261\204\247\323\013(\300\240\b\265\202\372R\027@\025\017T\361XH_\311\003O(O\204\300\246\226\360\344\245L\246\223\007\262\255\347V\3368\245%c$\001\275\355\003o\0131|v[\177Ii\223V\002\036"
+	.string	"\334\263\320\303\206qM\341\261\216\021\020\255!T\210\247\023\322\365\001\305\"2P\023\260\324u\0133aE[\216\006\025\327\360\302Y\001 c%\246=!B\030rb\252\206]\361A\025\256\261\231\262\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375`\322\b\235\031"
+	.string	"vf\212F\200\234J:\260\335!d\377\031\245\234\b\245z\317\230+\350\304,\204\013\322[\306\004\360\241\240j\231\240\r\321\223s\277\354w\023\346\013\n\n\n\nh(H\377\207\032U\240L\327\361 \027\327\265e\355`\007\215I\222ds"
+	.string	"v"
+	.string	"u"
+	.string	"G\222S\352\007\021\251YR\237\"\365\261D\262Ov*\244\273Aq\277\376\230\037\365O\243~\025\003\034L\256\250\257F\324\357!\241\237\026\241\357\003B\037M|\320\377!:\350\013\033\034\013\203>\220\005\327\"D\313\222\226)\350\237\351\335\314Po\\\202\233\215\264,\205d\b\372<\204\016|Hnw\305Rh\266\333\273lZ\327\241\224R\003\375R\334]"
+	.ascii	"l\001\\^\364\305N]\364\301h\213~\030e\321\317BW\364\317\250\212"
+	.ascii	"~\031M\321'CQ\364\217\320\023\3752\324D\237\b-\321/BI\364\215"
+	.ascii	"|\304N\304\256\205\3306 \266-\367a\335r\036\372W:\364\255p\350"
+	.ascii	"W\331\32075\364\2772\364\2750\364\251\\\350w\005\373\\\026\372"
+	.ascii	"[\025\372SN\241/\345\273\373\2125\341YO\217\002<\024\247?i:\023"
+	.ascii	"\246/\311-"
+	.string	"\005=>F>\\`\205=\374\272h=<\226Gz\2133\246\333\001wO;\0166\351\370\365:N:\336)/\216<K<|\223\211\207\177*\215\034\225\244\303c\221\310c\025\371\347\221\310A\221\307\341\362h.\177\370\203\315\201k#Z\256\352kQ\365\235\334\350+\261\321\0272\325\017#\325\027S\243?\026\325O\002\325\377B\243\357eF\277\213\214\376\226\030\375&0\372\001\273\243~(\f\356KG=\021\034.\255\253\363\252Z\235V5\207\211\243\252\312\244\032RM\001I\236\222\032\256!Y\312\204\032\006\235_7gd`@\222\t\324\001\346\017\250\372N_\357\344\ryuw\352\206:sg\270c\216\347\032\311c%\371\344\262!\325\b\340\321\353\242\233\2347]@?\261\254\255\267M\363\343\321D\003\304/\177|\034\364\235?\3744^\217\243z\374\232\306\343\321T\343\361\313\200\245\250a$\213\2618%\325\354\031"
+	.ascii	"\003\231!r1\021`\030\013\032\005MPa\305H=>XC\226\001\260\241"
+	.ascii	"556\233`\335\021d\250\336\257\305\241^\243%\273\342\341\372\261"
+	.ascii	"h\225\207\266\325\264\267V\f\032\345+\244\341\001\354\206\257"
+	.ascii	"\177\221\334\017,\223\203{\222\327\255\202\210<,\235p#i\b\342"
+	.ascii	"\217/\245\326\\\245\032\204\266\203\320\246_S\205\314\330S\314"
+	.ascii	"t\245\203?\277\022\370a\366\201\231]\037bu\r\201@a\211b\223Z"
+	.ascii	"\240\204\263K\004\263\365\311\234'9Or\236\344<Y\366\006\231\020"
+	.ascii	"C\001\021\2614\230\210\245\301D,\r&bi0\bh\202\201d\200\360\236"
+	.ascii	"\357R\344\004\303\221\234'9x_\024\231\210V\342T\027\332\225\261"
+	.ascii	"\007\\\223;)\177\227\2761\006\177I\\\027\177\335\300\364\262"
+	.ascii	"\265E\263\244\371\234\205\301\345\346\227\331\354\225\027\240"
+	.ascii	"\262\264\224D\221\263\207=@p\350Nz\032\214\246\261\230\236\221"
+	.ascii	"@W\001"
+	.text
+	.section	.gnu.lto_.refs.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"(\265/\375 \236\375\003"
+	.string	"\342\311\036(\2207i\f\377\377\377\177}wwww\372\305\266\020\021\021\022\"\"\"\352mF\332 \352\356nn\226\220M\324\332\336I\246.\334\374\314\2701d\205=a\204\017\216\376i\203\327\005\023<\260\300\001\003@\032q\321\207\246\016M\033\23224\235,\332*\nI\272\220\224\2418qT\314\350d\3202\311\2563\242\\\217\035\347b>\247\303\364\263Y\305\2508U\342u.u\237\352\364T\210"
+	.text
+	.section	.gnu.lto_.decls.9a9d7cdd9a53e28f,"e",@progbits
+	.ascii	"(\265/\375`\"^\235\233\001*\256r\227U \ni:\215\001\004\255X\220"
+	.ascii	"V\256q,\211@X\365\326\016\264\f\322\210\325l\013\254\030LaV\037"
+	.ascii	"m\r\271\013Ld\320.\266n\244b\273\033\366\026\256h\333%\025\357"
+	.ascii	"(\200K\344\244\020,\267\216\177KE'\223J3\t\245\304G,\224\364"
+	.ascii	"\220{o)\245L\001[\bj\t\364\t\371x0\327\377\037l\345\f\017\025"
+	.ascii	".\313\226\006k\352fl\243\250n\256J\312\315\377\311\201k\340-"
+	.ascii	" 2Gn\214\301Z\307[\367\215\0336\306\233\261\f\234\365\377\307"
+	.ascii	"\336\031\323\032\313\242\201\361\250\331e\271c\334a^8\334\360"
+	.ascii	"\214\373&C\001\360\246`\334\214\261\200\344\330\235\001s\363"
+	.ascii	"\361X\266\377?%X\2369^n\376\217\326\025~ae.\241\023\333\273\371"
+	.ascii	"?SWV9K\016\"`\307slU\3125I\302v\363\265\236\276\216\203\2474"
+	.ascii	"\2226<\302\274a)\0345w\334tx\037G\275\316\214\023%&\257\313\345"
+	.ascii	"\243\267\207\353\213\222\233\257\243\350\333\343\335\363\253"
+	.ascii	"w\2714y\261%\357W\317(\2645\b\345\241\201\263q\363\361\\\274"
+	.ascii	"\377?Dn\246xq\273\371\277xI\"\031r\373+y\365\374\344\241\343"
+	.ascii	"cv\363\365\230\276\026\323w2\330\266\250\274\0307_\367\320w\327"
+	.ascii	"\314u#\244\316\265c\217\367\356\276\271\273t\327\256\313\026"
+	.ascii	"$\007Uy^\314\374\017v6\314\235c\343\216$\302\260!\367\336u\027"
+	.ascii	"i\217\327\356\322\271v\027\216e\263q]\006h\323\202$RBf\206f\346"
+	.ascii	"k-\235\241P\255\245\271rn\234=4T\327\343\255\311\315\327V\372"
+	.ascii	"\347\236\376\251\247\177\332\261\271m\354\361\272\271spWN\303"
+	.ascii	"\324\025\003\320\230!\335\33437\315\271\206\354cF\273\025\t#"
+	.ascii	"f\346\237Y\344\326\f\275\360B\366F\315\215\003\272\321\025\027"
+	.ascii	"\346\346\237hZ\315\355\214%.\316\334\374\263\211\276=\236\316"
+	.ascii	"E\363\272l\004\r\027\332\315?\225\350\237D\364\317 \372\247\227"
+	.ascii	"\276oW\214=jp\307\030\213\256\021>Y\322n\376\211C\337j`\342\275"
+	.ascii	"=\253\201\3713\353\272\375\227\213\325r\301\330s+L\02507_/\267"
+	.ascii	"\315\0363\334//\245\214\333xGdJ\353\346\237W\232\003{\333\f\246"
+	.ascii	"\335\333\263\031\314\237Q\332\264G\346\315;\372f\034\375\243"
+	.ascii	"E2\3571CQ\220!Rmn\276iF\373\270a\33086\302\324\f\244\332]\273"
+	.ascii	"W\354\361b9\226+\344J\001\241*\313\001S2\220Xn\332\321h\230\272"
+	.ascii	"\332R@:X\222\264\343#\271\367\346\220\201\003\207\214\205H\231"
+	.ascii	"\037:\337\374\241o\2650\311`\343\210$\200\211\026/P\242 \257"
+	.ascii	"\224;\344.\3210uE\002\231-H\213l\3627\242\237\275\277\216cgO"
+	.ascii	"\244 \3318\331`\343\216$\332\316\220{\033\245\334\262\277\021"
+	.ascii	"QU\330TI\312\220\026\371[7\326\355J\271d\031\210\244\214;\313"
+	.ascii	"\024#bW\226\274\306k\345\232]*\027\355N\271U\356\231=^)7\312"
+	.ascii	"\2238p(\261\\I\352Y\310/\315\350\227n\372\245\026\3752M\277\224"
+	.ascii	"\242_\222\351\227F\364K cI7\312N\216\306\315/\263\364\377\213"
+	.ascii	"\344&\261\307\253\344\212%\031\367\336B\344\032!\2122\332;\b"
+	.ascii	"\235\263\177I\311=r\215\330\270.\343\336\262@\207\316\r\232\344"
+	.ascii	"\336\306$\016\034p\0279w\256\230\371\331\213\376\257\221[\244"
+	.ascii	"\017Z\217>7\377\267\307[\344\212\031w\022\321\024%XAn~\206\242"
+	.ascii	"\237\307\364\263\230~\376\322\377\365\332qy\334 \027(\263\274"
+	.ascii	"8cu\363\375\272`\277A.\220}\203x\340\265\267\324\rR\264go\251"
+	.ascii	"\"k+\260\266\202,\005L\t\233\231\237{\350\373c\351\327\313\005"
+	.ascii	"\021\254\255\2335\260G\3463\227~\326\322\327h\221\314\r\366\310"
+	.ascii	"\354\300\036\2318n\227\235\313\223\367\342\346g)\034x\332FRQ"
+	.ascii	"\215\036kW7\037\263\321\377puc\340*Y\232-\254\017\362j\335\032"
+	.ascii	"\366x\267.V\266^\356\326\225q\263\210\302\366v\334\031bK\352"
+	.ascii	"q\231y\306\245Q\024\003\211\225\221\233\217\205\314\300;\364"
+	.ascii	"q\325\205q\267\256\024yq\363\357}\361l\305k\bKq\245\361r\363"
+	.ascii	"\257\035\375\033\247\337f\217\314\273-\222I\201=2\037\207Fk\243"
+	.ascii	"E2\355\325Q\367\261|\204\332\366Tq\335l\363\254\236=\376\315"
+	.ascii	"\356\331EVlL\224\330\315\277F\315b\357\275\355\337\314\363o\346"
+	.ascii	"\357\023m\267=2\177yh\233\205\307N\320\0319r\226\334|\353\345"
+	.ascii	"_\262vl\033K\207\253d\2150\007\003\271\367\376o\357\330;{\264"
+	.ascii	"v\254\335-\322\326y6\376\303\277tk\307\306\261uDT\306\255u\246"
+	.ascii	"\275\330\332J\342\200\257\326\244-1\263\335\026\311\254\220\247"
+	.ascii	"\255\034;\307\0367X:\267p\254\227\377P\031\267\332\336\306\242"
+	.ascii	"\0377vz\034o\276\255\243o7\230E{{{{v\203y+\247\363\233[\272\337"
+	.ascii	"\316Y6\367r\275\366\246\332{c\270j\352\370H\336l\335,\335\276"
+	.ascii	"92\263\272\214E\270ML\325\236\233\257=2o\313\350\307Y$S\310\036"
+	.ascii	"\231\033\206\360\334L\225\335\374\3335f\342`\271Hr\363-\227."
+	.ascii	"tijq\264l\201\343\026&\315\0071g\274\264\251\371\255\032\013"
+	.ascii	"g\343\354\031K\306\246\261e,\032{\264f\354\230[\343\336\307\275"
+	.ascii	"\367A\274Y6\"\274\267\0174c{\033o\277\374K\277\007\020\326\214"
+	.ascii	"\005c\3314L\355\355\243\007\006+{\264\230%\3676rH\342\300\341"
+	.ascii	"GL\027\223<\026\362-\017}[C\337^\351\333(]\301\"\231Wu\222E2"
+	.ascii	"\357\244)\260H\346+\2407X$\363't\007\026\311\264W,\026{\214\300"
+	.ascii	"f\271\007\020\307QV\212\206\372D\351\243w\363I\320B!n\327\216"
+	.ascii	"\301\312\006q$}\033\201i\367l\004\346\265\006\301\"\231\277\265"
+	.ascii	"b\215\247\231\030\260\343\315\326x-\025[\345\326h\247\334\003"
+	.ascii	"\210\013Q\355\263\275\215\326\230\367\226\262\266\002\"k+(\337"
+	.ascii	"\220H\245\231\371W[3{\026\001\276\302\362\332\307\275\215FEF"
+	.ascii	".\031An\276\321\"\231\332\036\231?6\303c@\362\017\206r*w\304"
+	.ascii	"\232\265\037#\371/T\326\371\374\357\2104h\030H\266_3\343\344"
+	.ascii	"\007\336\332\362f\344\307\"\374\030\207\255\262V_\3000\026\032"
+	.ascii	"\261|\274\367c>\377\035q\254\361\343\016@\204\240\347\307y\376"
+	.ascii	"{\005\203\037\343\371\361\235!l\347\307w\377]\203\264\373q\035"
+	.ascii	"\235\037\317\301p~L\367\343\022\270\315\217\331\374\227\f\226"
+	.ascii	"\373\361\032\254\346\307p8\203\037O\360\343\n~\274\341\307\035"
+	.ascii	"~|\346\307f~\334\200\177\370\315\337\1777\374X\377\027\n.\363"
+	.ascii	"\343\255-v\357\277\245\325\303\230\314o\325\3401\277\225\362"
+	.ascii	"_$X\f~\373\261Z\230\037\013\371/\013\267\377u\346\374\030\214"
+	.ascii	"\255\262V\226\316o\347\376g\240\301\177*\007\341/\337\376{\206"
+	.ascii	"\2030\215/?\336\332B\345\304-\374\245\326\177\317pP\027[e\255"
+	.ascii	"\256\341F\177\t\344-\214\330\177\313\340\266\377k\330\313\177"
+	.ascii	"G\\\350/\227\374\367\f\007\035\350/\3158\360\237N\227\250\233"
+	.ascii	"v\317\202^\341/\247RhA\345\216x\320_n\340\277r\230\313\377\265"
+	.ascii	"\337VY\253\377Y\354\215\377\032F\234\350/\323~\274\265\345\277"
+	.ascii	"C\350~\376\345\227\037\277\370\261\026\266\377\216\370\317_\306"
+	.ascii	"\370q\226\037\257\375\370\312\217\215?\236\362\343\263\037'\371"
+	.ascii	"\361\220\037\177\375\370\307\217{\374x\307\217s\374\030\307\217"
+	.ascii	"o\374\270"
+	.ascii	"\306\217\263~\214\365c\030?\236\372q\324\217;\360\343\r\374\270"
+	.ascii	"\305\217S\3701\324\217\325\037g\340\307\304\037\243\370q\004"
+	.ascii	"~\334\200\037\227\370\361\002~\254\200\037\217\3701\002~|\200"
+	.ascii	"\037\027\340\307!\3748\304\217A\374\370\303\217\227\376\233\347"
+	.ascii	"\277w\376{\367_\344\177\353\376;\347\277q\376K\367\3375\377\235"
+	.ascii	"\373o\232\377\302\375\227\314\177\315\3747\314\177\337\376\333"
+	.ascii	"\366\337/\377\345\362\337\343\177\265\3747\313\177\257\3747\355"
+	.ascii	"\277U\376K\345\277h\377\205\362_'\377m\362_\262\3772\371\357"
+	.ascii	"\330\177\225\374\027\311\177\215\374W\354?\225\377\016\371o\330"
+	.ascii	"\177\201\374\327\353\277\020\370\357\213\377Z\375\227\305\177"
+	.ascii	"\241\376\013\374\357\372\337\342\177:\377\035\361_\021\377=\377"
+	.ascii	"k\376\226\315o\345~;\345\267h\377\357\374_\363?\356\177\225\377"
+	.ascii	"g\377\203\377\317\374?\332\333\333\333\373O\241\377B\334?\"\203"
+	.ascii	"4P\230\032\322V\266\273\2726\374\304\250\252bw\366\022\355\354"
+	.ascii	"\r\211w\363\361d\265\377?\276\267\"\311\233\237\004\247\377\333"
+	.ascii	"\337\337\334RY{\357\255\322\270\263\246\204\314\337\336\226\326"
+	.ascii	"n\370\207,\266\026\374\317?\020\002\306]\265\345\316\336\333"
+	.ascii	"\336\321d^\244vP\260\313\270\254+\265\257\250\004|iQ}\341\270"
+	.ascii	"R\373\3222\272R\373\332QTI\242\214\262\366W\324\225\332\336F"
+	.ascii	"TTQ$\274\264\256\324\244\266\321\225\332\326\332.\344\264\354"
+	.ascii	"6~Em*\257m\264\251\266\324V\363\322\242\340\212\352K\353JMJ\313"
+	.ascii	"\350J\355Kk\253}\355\n\233J*\353\005\325\3162\332j_u\266\232"
+	.ascii	"\227V\205+5/\255+\265/:\313'\206\020\036\\kw\220\320\260ZWT{"
+	.ascii	"\206\f\036RY\025\342\256\214^\233no{\254\332Y;no\013\366\346"
+	.ascii	"\341\225E'\205\303\266M\305\315\230\332\"\345e\215{\357\f2\246"
+	.ascii	"\300\2746U\\\224\335qWM\274\366n2\345\264e\354\275\267\007Q\306"
+	.ascii	"\270-f\343\242\202\360\330XU{C\260\215{\313\330;\312\356\270"
+	.ascii	"\275w\324\336\373\314\342a\334[G\205\2531\0312\366\356J\222\261"
+	.ascii	"yD}\251\332\373\036\343\264i]\251\201y-}\301\2426\266\255\214"
+	.ascii	"Q\366\n\313k\217m\272\257,\255\026Uec\355\275\255\035=\246U\343"
+	.ascii	"\356\346\022\n\r+pun~R\022m<\333\333Hd>9b\365\345f\re\311\020"
+	.ascii	"\275\233\215l:\320\f\271\271d\302\304,\311\2071\250\315G\026"
+	.ascii	"\0337\227J,\027\334W\336\315O\242\241K$y\206\f-U7?\351\205.\215"
+	.ascii	"\020\005\301\252\363r\363\223\244t)6\206\017\026\265\233\217"
+	.ascii	"\241\216.\207\024\215\301\363\243\355\346ch\243\227~\200\201"
+	.ascii	"\225a\266\202qj\216\026\344\336]\033\206^\320\201\241\026\344"
+	.ascii	"eX\321\236<6R7\037\217\215\302\347M\325\315\307\340V~\225^<\362"
+	.ascii	"\340\270yi,\304c\224^\326\312\246q\212}\351\345I\356\335\265"
+	.ascii	"\001\023ab%\016\217\227^\345\017\24219\254\265\233K\037D\\\\"
+	.ascii	"\330\341\335|\fJ\312\036\345\216R\207\222%\\f\334\\\336(u\374"
+	.ascii	"\264\361\201+\242#G\2243wx\334\334\205\00109in>\0060\215\243"
+	.ascii	"\344\322[l\366\325\315\307\200C\037Oi\343\0243GL\232\215\032"
+	.ascii	"B\204d9\336\\n\351\031|\252\306\334|\f\245VV\t>\332\354\2244"
+	.ascii	"^f\301q\361\242\306\315\307S\316p\023G/\356\346\277\234Q\312"
+	.ascii	"p\221gF\255\224Qb%\t\371\b\323\361\346\346?\220G\377\0019\315"
+	.ascii	"\001\\\210\227/n\217\345\213\322*\001G\275\251\220r\"\250B\343"
+	.ascii	"s\363\037\340\242\377\362\252\264\322\301f\207\236\233\313\252"
+	.ascii	"\241\267\"y\226\334\374\007\320\364?\224Q\231\317\231\261\313"
+	.ascii	"\226\227w\250)\243\362^\036c\343\210\344<t\3102*\353\301!\313"
+	.ascii	"\251\222\252\224*w\351\302\036\313\250\334\247\214\312{n\216"
+	.ascii	"\240\030`\356\372\200\241\353\021G(\377\001\034\372\017X\351"
+	.ascii	"#\351\321G\242\243\217\024\247\217\344\226\223)\334\0251s\363"
+	.ascii	"\221\216:\353\311y\306\240y\341\003\347\346\ro!\236\357\334\036"
+	.ascii	"\363\235|g\243\262\354\336^\322\272\220{wqp\242\231\263\331\334"
+	.ascii	"|$$\372\317v\362]\027\220)Qn\256\223\201,g{7\037\t\207F\223\343"
+	.ascii	"`c\233\356\002&\003\231\351\344\272,'\317\261\307l\227\317,\331"
+	.ascii	"e2`v\371J\036\203\215m&\314a!\355\262\231\264\027K\331.\227\201"
+	.ascii	"\201\334\333(\344\006\217\006\034"
+	.string	"\241\f'\203\320\0317l\373\346#M\3517\331\215=f\272\254\346\230\333\3308\"$\362\366 \3512\226\fGT\356\375\2457\266\367\316\300\201\003\320]\021\035ff\22344\304\313\311\217\233\177A\216\276u\313b7\227\327\330c\226\313qjrH\326\220\201I\342\200\361\324\322 \315\374\013c\364/\244\351?\247y\206\003c\2756\206\240\032qpr\334\354a\3519\215Y\026\006\b\336\315\2770\246\177A\207\376\005\032\372\027\\\350\037%\265\0303I\233\274\267\233\177$\247\217\031\214\215#\222\373tA\276e7{\314a\362Z\016\223\261\\7\242ro).cA?\202h\2750\363\027\234,\323\246\345\346\037\035\365\255[\226\343\330\226\013\206\250\334\333+\313X\366\222\3332\027{\314]\262\226\337\334%\263]0C\356\314\232$\2238\224y\220xut\376\221\020\375#\030\372G.\364-\354\351[H\352[\220\323\267"
+	.ascii	"\247oALN\023\222\342\352\262\346\346[\340\242\377l\005\310\233"
+	.ascii	"*87\327\300\032c\223\315\262\017[\207\253d\351\2654=\254\035"
+	.ascii	"c@\346\222=\346\366\\\252\0319\3062\222\f%\223e*\331I>\313O\262"
+	.ascii	"\222|$G\311U\262\224L$\027\311eyIf\222\215d\264l\314c\271I\236"
+	.ascii	"\222\305r\022{\314f9\354YH\036\222f#\006\322\"\267d \3676\342"
+	.ascii	"\b\273\322\002\303\007\322\"it\215]*\031mtx\341]\252\030<\220"
+	.ascii	"n9\362\216>c\026\331\2657\206\261\374K?,[\036\216\223Ec,\233"
+	.ascii	"e\260\034\004\033\307~\254\300\352\220T/.\031\"\251\n\233\312"
+	.ascii	"\305\2171d6\313ZWf -\222G\336\301\207\013W\233\027_v\026\231"
+	.ascii	"\315\362\215/_dw\345\2313p\330x\220o\234E2\005`!I\016r\201\275"
+	.ascii	"\217d{3\356n\276\005\"\372\026\270\364-X\351\033\355\3217\232"
+	.ascii	"\243o$\247o\304\246o$\246\263\216\314\225&,\311\3157\002\242"
+	.ascii	"ot\245_!\217~\0053\372\025\270\350W\260\242_\341\211~\2051\375"
+	.ascii	"\nC\364+\370\320\2570C\277(\217~\021\234~\221\026\375\"3\375"
+	.ascii	"\242/\375\".\375\"\030\372\317Wu\331jo\215V\335\324\315\307q"
+	.ascii	"\376%9\326h\032\321\002\221g\n\322K\035l\207\r\251\007\r\217"
+	.ascii	"\024*\310=<\347\2229\263\254\321S\226\304tp\f\300\304L\037\314"
+	.ascii	"'\357\\\225\243\360\236L\205\365\262Tv\221\247\354\021\357\341"
+	.ascii	"\3441\036\316\003\341\346\215\221%z\312\222{\230\016F\332\270"
+	.ascii	"#\211;\\\220{\370\216e;\305\242\364\224\231w\254\200\350I\312"
+	.ascii	"\326\313\"\231\027\354\221y\"4\372DY\364\211\236\350\023\375"
+	.ascii	"\320'r\301\006\337\r\305\341\200\303v\363\207\220\372Ci\260\235"
+	.ascii	"\214;aOn\376\320Q\327\r9\321\037\n\323\037\302\241\217\264H\346"
+	.ascii	"\207\244\364\223\026\311\274P\033}!1\372\307m\330\224if\244H"
+	.ascii	"\335\214\331\314}\r\227\032\237%7\257\301i\370\f\256\222e\302"
+	.ascii	"T\035R"
+	.string	"\r\216\303r\366\210\327`4\307i0\334\263qo\252\2515\270\212\035\362N\255\301\306$\007\2408syBt6\275,\222y6\366\310\274\320\232\376\361\225;\205\255`37"
+	.ascii	"a|\364\334\\\306,\223\205|s\363\205\232\350\377X\f~\303n\030"
+	.ascii	"\f\036\203\303\330#&\203\333\262\027"
+	.string	"L\006k\301]p\225,\355e\n\016c\371\022g\f\257\035\301\340,\221\301^\322d\261lDQ\025\366\324\034\335\030\031\314f\331<0\253#\227,r\243\347X\206(_\210J?\250\216~\020\033\314\305\252\255\211\351\335\374 .\032oyPX\333Q\352\346\007Y\321\017\032\323\017\362\241\037d\245\337f\221\314\223\261H&V[:\276\"\001\227\267/7\237z\332\334\026\311<P\033}\2400\372\307T4\240r\323r6\005G1\301\315Z\216\233\377\001G\271R\330I\324\251\345\013\031\230\244\315\023\305\352\261F\242(\343\246a\"\211\"\003\223\334\333h\223Q\354\236\255\263qG\022gpH\233\304Q,\236\355CDe\334Q\247\221:d`\222\370\fK\301f\030\315\036q\024\374\344\030\n.K\"\212b\246\346\nP\006\332\026\311\264^\366\310<\220\021\215\233X8\027X\212\334|\240/=u|\004\273\300CjP"
+	.string	"EKI2\351\366_*|\344v\271n\330\330\266"
+	.string	"01\344\036\246\372\360EI\262\214\315\177\253\254\356\r\\%\353gFZ\031R\007>r{\334,\032\246\256\366\336\362\300\311\027%\311$>r\303\\2\330\330\246\255\322\210\034\271yn\2374\037dx\f\213a%\230\b6\202\231\340$\270\bF\202\227\330#>r\365\374\356\033\265\345\006\301\306\261\023KZ\021$>r\313\\<L0 \253\243$\231\274U\370\310\345\2729p\225,\255eJ\311e\373/\325\221\253\305\032m\\\327\216\252\203\201\223%J\222\0348`&2\334\354I\312B\222\202\306\320\276\256n\376\017\034\375\0177\017\366q\205\0062\006\276\001BU\326\317\2146]\370\013\003\301Ap\230=b0\374\343\227\352\272\360"
+	.ascii	"\002\203a/\313\206\215c\347Z\230\016\344\336F\f\206\2530\f\240"
+	.ascii	"69v\334I\356m<yT}\351\001\224\3773F\377GM\363\300=v\020I\235"
+	.ascii	"\215i\242\204\307\216\214\327Dj\216\216\343\035\331\212]\032"
+	.ascii	"\220\233q\016\234\245\227<\002\344f\334\245\277tHA\336\214qX"
+	.ascii	"\266-`gh7.\326\374\224\373\315/x\355\006\271\300\236\222;X7\237"
+	.ascii	"pK?\327\004Q\331`K\022w\252)\253\\\345aK\363S\315\177\302]\266"
+	.ascii	"\033\344\002En\324Ps\363\217=2\255\331\322\3174Es^\360$As\306"
+	.ascii	"\247\265\244\315\315\347\231\033\204\210\017\222\030j\314\224"
+	.ascii	"\335\033Qz\b)C&\264\207\213\335\036\231\261\353ee\217\2131e\022"
+	.ascii	"S\314\r\n\f1\266Ng\251\213\213\361v\005\250\211\035%xa\316!B"
+	.ascii	"][\202\234q+\217<\340\210&\006\314\231u\217\340\240\363\343\213"
+	.ascii	"\031\343\205.(3\274\230{t^aX]\312\271\223\313YC\204;\254\260"
+	.ascii	"-\317q\360\260\311bF\313\t\003J\335\025(7\203\370rf9\263`\253"
+	.ascii	"\032zyI\215<\243e\337\374\r\224h\017\350\234k\347\332Y\343B^"
+	.ascii	"\320\325\030\033\216\233\277A\017\r\202\206\025+\347\225:Szy"
+	.ascii	"IkG\226WF\355\347\025\2407m\222\034"
+	.string	"o>\323\262\271\207\344\305\216\rfh\020tN\343i<k$yE\3411\2212\204\230\301\261\007\005\f\037\275$g\312\024l\225\344\205\337L=\341\002k\202Wv\3637\334\351\245\266\261\261\363\314\274\223!\304L\031Q\227-\"M\314~\236\225O\310\350\341\272\371\204rJA\022\305d\311\315g\024 \020(ln\376\006\264\263\354lr>\371\377\023\304c\213\234\0357\237N\216TM\215\271\371\033\204\350\3439\311\376\377\224UH\224\274\335|2\t\023\"&Fv\3637\234K\312\260\237\375\246I\362\346o\330z\351NL\354L\222\344\205\351\334\335\365)\303\203\227E\353D\3623\t\\\324\232\230\233\317#\266n\006\025\027R\214D\251\313\0223r\026A\332\241\031\213\344\265s+n\214\325\235\006\021\026$\3109D\215\035\275\274\344\311\206\254\002&\344\347\020\363\312\022\035an>\3032^\024:p\214\314i\0172\200"
+	.string	"9\277\222\274\242\352l\200\006+/\017\303\255\365@\363U\207\343@\211Sr\3635 \243=\3448\177\234?J\264=Xo\366\004\375hbE\353\346k\200\246=\024\351\321\343\254a\255l\032HpXyy\311\237-sbin\276\006Z\332C\227\035;\260U\222WT\0363\013\313\016\032\214F5f\313\315\317\200\217\366"
+	.string	"\357\314q\346\330\203\245'+\251f\313\213\326\315\317\200\214\366\360\344\304q\3420\323\314-,;h\206\200a\201\335\374\f\302\264\207\265\0337\260\225M\213\263\265\225\fs\006\312\326\315\317@K{\320\263\265u\326H\362\302q\372\304\270\023RF\216\324Y\343g\t\031\030\326\315\017\300\236\366\340\346\234q\3168\263L.,;\036e\031\357l\254\315I\343g\226\330\234\033r\214\377\177\204`l\271\3710\243=\274aa\225h\326\212\004y1\356\312\316\310\355)\243Ew\020\307\305]\2340\254\225M\343\303\03220eAa7\332\302\234/~\302\260\312\223\325\345\274\222\2722\003y^\235V$\254\225\261\003g\013a\311\221\313;\253\262\032\354\244\006\232\252\233\037\200*zi\3069uN\225hpc\\L\254l\201\242\227\254\316\2503J\213\235$b\222a\270\350\325\335\374"
+	.ascii	"\004\321 \314L>&\037s\357\202Y\215\"h\244\274p\363\303\354ss"
+	.ascii	"o\b\317\225\270)\001\340\241\227\266\236\036\266\342\302z\263"
+	.ascii	"\247\354\204r\026&\216\034\r\302\r\036^\236\r\303r\202v\3631"
+	.ascii	"x\323 \324"
+	.string	"\350\321\203\255\216\251\266\217\275\261S\255+\215\326\315\307\240\212\006A\006\017\036l\265$JO\331\206\"3)46n>\006H4\336\023\342\246\035\323\216\255\323/\366\376\322\021\264\205%Wf\204$\016\312\315\277`\217\326\200\027\342f\035\263\2165\346(\343\246q\201J\r7w\222;\213\f\007KmYW7\377\002:-\001U\210\233l\330\230v\t\270\303z\302\244,\213\023\031\333\316\254\263\222a\343\311\315t\360\232\030&z7\377\2024\372\366\013\235\335\230\t\307lc\331\352\220{\033M8\246\233K\306\306\021\331RQ!\230\301\232b#9\307\224c\306\261G\023\216\371&)#gP\271\243\363/0\352_\340D\377\0022\375\013\226\350_PDKp#\304\3152f\031S\256\202\024\344\316\"\303\301\317\235\r\256\244\334\232\237\254\2729\271\233\343\214TC\366X!r\363/\300\241\377\301\2043\333\3144\3308\266"
+	.string	"0>H5\366h\302\231fn\223\204\360\364\210\332\201\346f\032\313\366\323\243\207\334\324\315\346\231\245\233h\350\264\276\334\270\271\264G\346/\240\322\267"
+	.string	"OK $\304M.G\223\2139\306\356\261\006\2641C\356\254.\016\210\360\272\\\215\335,\306\t\2321p7\337\2029\375\337\fc\217\346\233\351\345\326|3\333L7\rS{K\365"
+	.ascii	"\332\302z\302$\271\367N\342 $\347E\024\266\234\177\023\314M\267"
+	.ascii	"\337\354\202\261P\231\300crv\263\371e\351&\230+=)7\003\245\351"
+	.ascii	"[\200D\007\331#\363\026\374\320\037\246\264h"
+	.ascii	")\321l\030,&<\312J(iQf7\277\002=\372\203\215,Y\200t`)\261A\004"
+	.ascii	"cN\215\311\315\257\200\214\376\020\266\2666\347c\354'n\312L\215"
+	.ascii	"\233_\301\024\375\341\311\225+%Z\222\027\266\323\322SVf\366\250"
+	.ascii	"z\333\273\371\025\210\351\017kU\252\230iI}\260\212\224\351\275"
+	.ascii	".]\246L+7\323\346\250\270\241\253\373\377c\302\321\330\223\267"
+	.ascii	"G\177 C\205\312\2052_dwI\263kNNG\235\376`\007\r\255D3y`\t1S\266"
+	.ascii	"\303\366\350n>\005i\332\003*\323\3144+\321\346 \201\244\310\270"
+	.ascii	"\314\310\264\0077\242D)\351\220\220\005\311\221c\343\314\207"
+	.ascii	"\366`\f\n\224\022\215\013X\0221\245\231\033\231\232\033\332\203"
+	.ascii	"*N\234\224"
+	.string	"t\026\214\313\326\326u\273\222\244\352\346S\340B{\200\306$3\311J\264$;izy@H\344\254\231\272\371\023\344\351\016\326\204\260Ql\231\264\3072i.\371\271\332[k\2031Y]\034\3501H\326x\355\271\271\344/\361\312<sL\310\f\213a\244\353fSI\321^\215-jn\376\004u\364\355Y\025\227(8c&\020\023\314\364a\"1\203\230F\314\"\346\0173\211I\304\034bz\231_f\230)\304\024\263G\363\310\247\310\214\355m\324A\225\325l\334qKi\201P\306\316V\232^^\322<bZm1\217\230W\346\213;\001\224\251\241\227\227\334[m\211\206\251\365\265a\214\233^^R\2069\003\204\252\254\237\2526S\256\016\251\254F7V\362)\367\262\332\2259G\314\030&\026\bUY?V.\250 \315#f\r\263\0076\2665\240\r\035\030%\221\260\343\330\245rQ\022\351R\3621\217\230;\253Y"
+	.ascii	"L/\257\214\203=\323c\003\307\202l\362@c\302\265\343\346O\240"
+	.string	"Fw\2318\244\314\230;\314\034\366h\352\370K>e\237_\343\336T\246\016\323\206\211\203H\252\206^\036\221\024W\233-3\177\2021\375\233\\7q\\2\326V\021S\243s\263yc\351&W\037\274\030\307\233\213\354\221\371\t\276\364'\350\322\237\200\206\376M-3\313\314\206\220#\273\350\347\213\236\223\0337\177\202\251\031tv\215\230\265\252\233/\001\236\376M\254\227h}\356\256|\271\371\022 \365%\220\323\3063\0324\214x\335|\t\334\364%H\323\227\300\211\276\004@\364%\330\322\227`J?\2029\372\021\234\321\217\340\250\037A\231\316F{d\226zK/\367\020iE\271\302v\263\221=2m\216m\221\314\243\b\3064\006ZB\274\314s{,\363\224e\002x\373\"\273\033\022S\226\303Ks\320\023\342ey\247$#\212QGO\0312\214\324\235\233\037A\fM\301\227\020/\357n\217\345]9\226\200\243\327\3362"
+	.string	"\225%rI 'b\311\0377_\203\036\235\001^\210\227\310\037C\301e\366X\"\313$\t\350\262\262\243N.K\310\300$\357\350\312`\334|\rvt\004.B\274\254\263\307\262\316\326%\340\350%\265\205\001\02507w\202\246\320\241:\273\371\032\216Z"
+	.string	">B\274\2343\247<\222\251\254\354\250sN\306\326\326\217\233\037vu7_C\232\006\201\027'\016\266\312\260\303mH[2\356\007\036\0347_\003\024\035\342\256M\233\222\356"
+	.string	"`j\220\273\253kC\021WYU\227\362\315K\272\t`!\273\273\271t\223\325\260\276\300\370 \342$\210\221&7_\303\220\270R.\256\234\233\013\361eM)\267\346"
+	.string	"sC\332\3124p\351\003\240\017\232\022\016M\211\026BF\232\022.\r\335\034}"
+	.string	"\270\215)\313\214)\315\224f>\210C\246,C\006oLM\037"
+	.string	"I\334\3127\2670a\312\2670\031\260\003\200.}\b\364\274\224_\274L\t\321V~i\313\3023\007\001\035}\b\310h\r>B\274\344\302\305E\332\023.\242\034M\232\234\335|\b\314t9\027\342\245\226c\251\245,\222\243\254\354\255\"\235\030w\311\275\2738\270xvw\340n>\004a\372ke\226\265\022\315\334\333\032\275hd\355\256\254\r\037\0209\226Y\216%\232\216\332\200\333\220\2662\b\272\364!\240\322 \344\270r%\212\2359\032"
+	.ascii	"tB\274LK\263\306\323\212,\211\230S\312\027^\334\232\016\001V"
+	.ascii	"\245J\211f\367\336\373mnH[rwemx\206'Z\303V\210\227T\216%\025"
+	.ascii	"\313\226\243\254l\032@V`E\320$\367&\303\001\276\321V\345x\363"
+	.ascii	"3\300\320!\242\204(\243\224R^\232\231\225hz\357\035e\334\001"
+	.ascii	"i\020\005\272B\225\260\002\207%\212Cj\t#\2464\210\002\035*@\205"
+	.ascii	"\212\236XS\225\250i\b\\\201h\004\200\301\037\220\357I\025vxR"
+	.ascii	"\205>tEI<\251%\f\211&\244+\n\025DW(\340I\025bx\340I\025^xR\205"
+	.ascii	"\025\206T\250\350\211\264HD,\242("
+	.string	"\200\204\300UU\300\017\202;)\265@EP\201AGwR\352\220\2468\357\244TA\205\264\b\265\242\305\364I\230\2368j\032\002\233\232\210$\250%\214\356\244\024\f\022M\250)\234T4\230\"\210\350\367C\177X\234\360\364\243B\255\350\212\302y'\224)Hd\300\032\024a!\375\231@R\323\025]QP\205E4(\342\350NJ$\234(\201B\007\nT\374\210\301\021i\2218\242\210IE#\2202\021\205E z\264\336I\251\303\220(\024\022\177+\254\352[\241:\0019Y\325\252\346j!e\"\n\201\326;)=\001\213\253\312\224\006;\020\201Eb\220\370+U\237\232\"\251Eb\2208\"\210\002\177\351\223\272\002\203O\352\257\330\201\b\004\006\237P\370\025\211\356\244\244>5u \002\325\247\246\237\021\031 p'%\rN\277\025}R\201L,\212CwR\202\022\002W\021PB\240Q\321\020\210\226@,\266X"
+	.ascii	"\024\t\265DJ,\266h*\002Z}z\3651\300\350NJ\3054\b\305\224:\375"
+	.ascii	"\324\nT\241tH\210\026\233\210\253\nt\372I\205\250\t\251\0205"
+	.ascii	"A\205\212\236@\001\245\006\375\206P#\374\374\206P#\250P\321U"
+	.ascii	"3\021\201\305\324\004SZ\004\252)\323\320\212\256*Q\213\025X$"
+	.ascii	"\002\213&\230\212\3244\370k1\"m\022\221\n\201'V5]Q\022V\021L"
+	.ascii	"i\020\0356\001QXU4H$\204B\241i\b\\A\024>\300\002\025VH\205\300"
+	.ascii	"\023\277\224\205\002\202\350J\\-\264\370\r\323\025%a-\242+\n"
+	.ascii	",Pa\221Zt\341\350\367C\361\235\224\230\200O\035\230\200&\214"
+	.ascii	"\210\305\026My\005\016K\250*T\364\304/E\220\212_\3524B\205\212"
+	.ascii	"\256E\025PH\203LC\224\001F#\222\210ET\004\"b\021\025\001\t)e"
+	.ascii	"\202Z\201kPD\272\242A\250_\020\035\241BEW\rC'T\250\350z\341N"
+	.ascii	"J\300\340\357B\312D,\001\030\374\235HB\035(\255E\364\351H\004"
+	.ascii	"\206;)\245E\342/\205\324\004tEIH\340\004\025\0304\004\242%\260"
+	.ascii	"8A\205\212\256\025\356\244\364\363\245B\340:\204*v\370\245P\233"
+	.ascii	"\320\340\bMC\240\260\210\006]\004\025*\272\032\375\007,\246\303"
+	.ascii	"\264I\337\203\017\006\360\001\b,\316\203@\200\016\b\320\201y"
+	.ascii	"\020\b\260\264D\200\017\226\364?X\302\353\272\256>t\r\246$R!"
+	.ascii	"p\rj\021|JO0\272\223\322\223*L}\253\352[S\025?\324\304\223*\f"
+	.ascii	"ZU\242\211'Ux\244\372\204\230\206\250PH\034\241\252\351\217X"
+	.ascii	"4\361\033\341I\025\036]X\357\244D,\246\024hB\205\247\252\242"
+	.ascii	"O"
+	.string	"B\342\257h\b\f\376R&_\023*,jB\205M\250P\250\t=\261>A\025\205R\037S\t\025*z\"\305\017H\230\256j\013\024 X\327\024)\223o\305\240B\371\234~+\320\004\323PD0H,\036Y(\246k*$\"i\300\311\227\342)\350\373\375P\240\"\232\002S\021u\362\375~\250\320\272\372R\244L\031\356\244\224\002\332\002\253"
+	.string	"\b\006\211\305\354\364[\201O\245\232B\005\321\025&\224O\025\002\213'\324\037P\210\016[\220X\235\232\200\301\024H)\240EL,\246\024\370\375\320s\365\251\017H\205\300\265\330\201E\361\250\b\364\204\n\177\305\262\2302\001W\020\213O>\026E\243!\021\250\252P(T\"\026i\360\t\212D\212 \352\004\024$\376\210+\261\370T\304\004\374IQ\364\001\237T\037\213\"\206\224\tX,\246+\210\276!\220\202\325w6\241'\210@_\023T\360)\311\210\270B\241>\246!\020\205oEU\237\020\252\270\252H\237T"
+	.string	"\b\245A\364\247\002\255\305t\305\020\350\003\252j1\350Wd\002\n\313!P\250U\374R\247\037\013T\250\213\324\021A\342\323\257\210AM\323bSJ\"\r6\rE\b\321\021+\236RX\b\246\303!\352\364\363\261\200B},Pa\021S\220\350\244\246E\247\023\351\212\256"
+	.ascii	"\256?\021)\023\261\204\"\020M"
+	.string	"\032\002\177\251\n\345c\201\n},\212AwR\212\200\005:\004\n-\244\260\242(V<\020\f\246\277u\230\252i\361i%\016W\024\305\212\f\251/mB\327 q\205\205\324w!\375\025\241\210(\024\3235-a\035\246\305\"\324\317B\213\025\370C\237\320\021-\212\351\272\242(\212VT\004\b\244*\324\220\272\026\323\240\210\021\251\nu!mB\327a\372+\246&\232\206\300a\021\215\300\220\b\\\237\204P\352\220\370\323\240\002\325\264\230\256j\013\247\025E\261\202\210h\275\223R\007\"\020C\213\342\232\n\323`\272b\260\240BEK\030B\245\020J}%\326\"\321\304\003\305\024\230\002\270\016S& \320\223*T\237\232\214X\244L\303\022\351\212\026\231\240P\024\276\007\324\265H|\n\322\200\223\017\312\027D\201\305TE*\246\353\017-\242N?\337J$\242H\213\025\356\244\224\006\323\337\017\265@\365\375~h\271\336I)"
+	.string	"\253\004\230\320\364\004b\261E\223\221\352\263\300\204^(\256&\206#\024\323U\0056\245'D"
+	.ascii	"\352I\2104\034!]\201\305\024\316\342j\342\004\250'\341\320p\204"
+	.ascii	"5U\323\3429$\002W\264"
+	.string	"\b\005\365$\254\260\002\207%\206#\254\300!\320,\256&~C\250\021\230\320\364\204\337O\304\005\325\267\"%\361\373\241z8\002\023\232\026\315U\365\215\360Pb\204\207\022?\252\232\026\231\230\320\363\347\001\210\241|$T(\024AwRR\241PdP}\300'\024\202R\244$\322\247\026'|%L\240\020\224\376\206\350\252\016\201z\3659\240D\036\002M\f\325\237\t|R\261\n\205\002\257\276\017\226\026\260\344\373\375Ps\365}\260\264\016\201g\n\350\t#H\2100S&\342\210\025iQ\250\005\023\232\236\200\256(\323\317Z\344;\357\244\264\376\240\212\253\352A\365\261HW(\241\221\212\0371\350\363\231\353\020\212\370\363\371\316b:L\201\350\363\235j1U\241\206>\237f\032\002U\370|\246:\004>\251>\3379$\002U`0\365\371~V\337\252\002\203\025\356\244\244\246O-\326\0010\245E\324I\035@\007u\005\242\350"
+	.string	"5l\032"
+	.string	"\013\250!08"
+	.string	"\017>\360}"
+	.string	"\002\213\016)\023T\3607\004v(\252P\035BXY\244\303 :,\246\353\020\350cB\323\242\323\372\344\363aX\221\026\237|>sU\201A\237\317DW\224\311\3473\213\250\323/\247\032"
+	.string	"\252>\237\251\342G\f\346\3247l\002\006Q\037\321\260\t\030\024\361\373\241z\275\223\022\324\223\320G,\266h\372\375\320\016j1]\001,2m\220\372N\350"
+	.ascii	"D\007\037@=\t\217\206D\340\n\025$\252i\021H\365]H}(@=\t\203\314"
+	.ascii	"5\b\245\246'\f\211\300\365\227\256)\t\250'\241\205\025)\023\016"
+	.ascii	"\242+\212\351:,\3214\004\006\237\204(\n\277\037zt:\255D\242\020"
+	.ascii	"\205\337\017\375I\177C\007\254*\232\222\260\212`JW\224\351\351"
+	.ascii	"\001\301\364\367\023\241\0023\334I\211Xl\321\324A-\022\325a\252"
+	.ascii	"B\240\372\210\305\026M\346\352\363\360a\035\002\241t*\004\256"
+	.ascii	"OD\"\tk\332TDW\242\024#H\210 \026[4\351;)Mp\342SZ\354\260\022"
+	.ascii	"\211\305\016A\252\257\t\230bH\034\301\202\210B\305\017\r\242"
+	.ascii	"\250 \204\032j!q\2302\371\322\025-\002\245?\340\212\224\311\\"
+	.ascii	"\325t\365\025\211+Q\350\033\022\207~?\324\307T$\376\322\"\320"
+	.ascii	"\220\bT\325\264\370$$\376\202\316\325\007\302:\004B\235\367\360"
+	.ascii	"\001\004\032B\b\035|P\272\360\020B\030A\301\003LX\200\376)\251"
+	.ascii	"*Tt\365\375Rt\370\245\3500\004\242\302\016\277\242\332A))\r\002"
+	.ascii	"S\020\213O\276\224\211(\024\n\022\211\"\370\312\377\032\306y"
+	.ascii	"\306%\016O\227~\221\344\212\220*ln\006A\211\236\322WzJ[\331\254"
+	.ascii	",;\034\3500\271\353\243\255t\225"
+	.string	"Y\217\2736]\245](\331r\244*\253\206\272\266LY\321T\271O]\034\216\272\233\277\301\026\375k\251\257\027>\352\364tTYdKW\227#z\357Y\261\302Q\343\3463\206\022)\271\233Cpq\342\235}N\274\223\317O\024\020W\227\215\r|\316=`z\354${\364L\274q\221,\305\214.\366\364\316<;\306\3342\233\023v\3637@\323\377\231\324\203'\016\230\325=\365P\231WT_M\362\234x\240T\tRu\363\211\347?\337\330/T9\314G\234\037w\354d<l\322\324\270\373i\347\307j6\255M\227;\"7_.K?\357.\232\220\253\"u\3144\2659x|\220vn\204L\201\273\371\264\333\362\303\306\016\271::B`Yp\302\346\374\244\363\23370\035\225\320\2312sz7\237r\226~\316\321{{nb7\023\305\201S\244\003H\030\f\272\237p\324~\272\020)\202\274\371|\263\364\223\316"
+	.string	"F\202H\271\031\237n\332\274\301\202&\013\233\237m~\363\214\345\"\324%\315\025!7[8K?\331\344 yh0\231\223\013r\221\205&\206\223\2503bczL\254\245(\212\305\2344\246J\246\304i\f\203\025@@PX$\022\352\272\246>\023\200\204\314+ui\240\006\235b\206HD\222\244\244P\032\346\202!\230\350\211\352\0134\271\\Y\377"
+	.string	"x\r\330\360\004D\202<h\034_0MA1\324\001JB\355\037\f\312\013{\005\331N"
+	.string	"(6*\202gAP\030\314B\327\213*N\223\350Ce\004\240\341\034\025\346\263\340\312B\355\304\\\250e\232<a\367|\215\020\036\222t\311\276\022F\253\206\022I\005\242\307+z\325Z\355u\\Kb65\215\261\003(\357\216\0217\342\325\020G\324\205B\235@\332b\177q\013\207@\311Y\013\322-u\357\030\312=\350\235\244\017\266\215\225"
+	.ascii	"\026\213I\243X\342\333\276\"b\330\005\217]\035kX,W\275d@Z\361"
+	.ascii	"\345\363\377\217\233}\322\365\374\215\237\257\222\326\347\335"
+	.ascii	"U\007\242\021wb\032\310A!\025\356\b\035\004\030\"y\344\215\036"
+	.ascii	",H\343t?\r\030\207\326\236I\376\016\307&\017\004\326\020\367"
+	.ascii	"\377\\\333A$\003j\242@\260\211"
+	.string	"\001\345\233u\365\013\206\020\021\231d:\205\326,Sx A\260|#R\210\324me\241n\357F.#\253\250#\020\236\256\t\036XR\226j\260!b\234\246\342\327\007\206\007T\2356\340o\301Q8EiX\003b\210\t(N?[\003\351\264\256l\364mEk\264q\274\036f\205\177\371\263\306\222\214\032F\004e\304\030\373\367h\2614\001\032\204\345&\036\016\034\300\204u\353>\313\331!7\247\334\364\r_P>4\227B\f\023\373&\213f\b\246\251h\016\353\376\002\273\300\307k^$\220'\2729\007Qy\21020G\212\001\271\313\255\207\353}a\222\243bm\211O/\224\272\246\211\3462IF\305"
+	.ascii	"n\265nE\215g\363\242ft:\353\250i\031\005\227\022\033\357h\250"
+	.ascii	"\035\035\307\245\317\265\306e*\021\323\342l\016\021\320\377>"
+	.ascii	"sr\013\\\f\256yP8\314n\246W\242l\004\326u\002i\310@\016\364\377"
+	.ascii	"vX\222\021\331 \340j\024\216\272@\330\357\260r\350\263\335G\220"
+	.ascii	"J\343*P\003\376\242_5\022&\032\212\247\030e\234\234\216\254\331"
+	.ascii	"^\254\300\214O\315\370M\226\254\201W\230\037Y\321)X\310\202\373"
+	.ascii	"Y%;\r\300\256\216\371\220\342\013\267w\251[\302\307\220\247f"
+	.ascii	"\n\253\320:h\363p\263\221\210*\336v\212Wg [V\025`\232\001:\216"
+	.ascii	"\3171\366\257\376\200\177\334\020(g\334}vx\375\243UHG\224\203"
+	.ascii	"\300\352x\303u\033\346yU\213z\331"
+	.string	"P\005\3748\277\311\230\020J\266\213\031\260\007\214\006uz\024\035\377\253LN\b\026\2155u/<6\375GX&\267\030\002\346\nJ\005\177\004\321\341|1\330\205\177X\225\240\373\257\361\220Yz\251\027\231\n\376\257V0`|\323\345\370\247\320\377\336po\245\003N\006\256\023h0\365\034\200\203\220\021\035\210@\2278;\013\353\274\016\270x6wj\226\226\316\321a\230\352>\232\242\021\027.\314\220.\254\2617'\257\027\321\340\252\324l\331\233_l\240\343\222R7`7\n\256\352\305`\037NPJ\022\363?S\372y4\367\266@/d*\235\207!\226$4V%\211(\244\307M\023\032\316\361\336n\352\037\006\013=\256\327\373o\256\353\255\017\2422\013j\272A\300?\263\214:\331\331\001\274\205\002\377\0324\346}\376\325\356\023\236\363\300\303 \327\2764\220\277\030O\204\263\3518\341\322\331q\210\005_u\332+\200\233\212"
+	.string	"\357\362Ed\264)\f;d\370>\004\360\346\247_fT\327\206\311\243\001\324\374\306\nC\301Q\265(\f\234\256o\\;\233\276c*\205\216g\252N\225\220;G=\204\356\276\203\252\316\n\373e\233\242\200\353\2506n\377\367\023\256\313\213|\2415=\366'\245+\265\210f\023\272\036\265\253o\324\307\360v\212\001\274M\024\334\317f\241\243\037\312\355=\257\321\331`\224\037L\016\030\334N\275\243b\214@\262\ff7\3676\202[\216F\374\334\\\363\255*@\026u\342$\006G8\333qG\311\252\360\2169\007\2534\225\272Y\037N\002\337\353\025Zb9\030\033\020d\247\214f\320\271\301\313\016\211iT#\243[\315\360\360\307\356\213-\202\320/W$\350\336\bR\354\345>3\306\261\022dqq\204\255\030\027\007\253\307,\370Y\342+\235\310)\004\321d7\314\200\363@Z\372\360|K\027\375\275\345\3435\371\021"
+	.ascii	"\236\235\330\013\30644/<g\364\177\200\032\004\252\024Q\270j\200"
+	.ascii	"\2258\bd]\026m\340V\366\350\251L\254a<EE\272\332X\222\363\377"
+	.ascii	")\017Nu\317W\233\233yi \236\0204\220\231\365\317\030,\025\321"
+	.ascii	"f\374\212\227\321\336\231w\334W?\336J\024KJG\256\005\237\027"
+	.ascii	"\347\347\345\312QJ\264\362NR\212T \226\207\322|\301\2306\222"
+	.ascii	"5\274\026r\316%\030\"\020\310\360\227P\337\351F\376\035B(\027"
+	.ascii	"\334\2540\375\222\243\314 \274\273\313\257:\275\266\211q\323"
+	.ascii	"^@\211\357L\367\3013u\206\324-c@h\n\235\347\001\306\336\230\252"
+	.ascii	"\373\376\353|\247\343t6\200\223=\325\225\245\301\344t\342\267"
+	.ascii	"\t\021X'\352X\2211N\320C\340\372\314\nhZhm\003\301\0178)\224"
+	.ascii	"\343.\301\311\336?\335\220\022\315\331\245c\034\307\234\323."
+	.ascii	"\001\255m\261\333\255]6M\263\312jQ\230\302\261\221\334\017\313"
+	.ascii	"m\250\302\313\271Kp\017\f\216_\237;YV\r\330#a[nP\367\316\032"
+	.ascii	":\374\200\313_\212/u\001\2604\355.\354\371G\2758S\266\240B|%"
+	.ascii	"\200\340\211\b{P\351P\340\035\217\334\022\211\025k\031\343\213"
+	.ascii	"f^\034\220\247\2649\210\234R4I\356\225\254\"\342\353\256\033"
+	.ascii	"\216\367\200\355\332J\030O[-\030\354\310\300\222\375@\202\021"
+	.ascii	"\002\304#\230uP"
+	.string	"\021\2044\322\013#\256W\245sO\r\341r{\275\221;zC<\345\206&\002\036\t\020\3376P\364\326$\023oU\325c\nd\264\226=\217\023c\377\364,\317s+t6\375+\324\310i\327\001\254\267m\374\231\326\0051\361A\250\236\004\223\3250p\211\353\361r\340\352\325\036\346-\001\2733Q'^\237\2532\272\367\t\373\036\322\311Wj4\222(\"\234Q\f\352\025\346\301R,\005m\261\017e\307\245\224\273ai\235\367\263\216\363\022F92aP\376U\265\361\325\317\211g(\263\212b\0274\220\257\252\210\344\241 \341\025\201\270/\254)aJ\021\210w\"\"\177Z\305\212Q6o\216\177\276\271\341\352g\214\375X\241\251s\034\016l\304{\275\357a\275\377\224\233/\217\322M\231\306\370S\347\352s\026\342\312\354\242\317|x\314\264ou!\343\016)\373\"\370\225F4;4o}\237\244\232G 8\3737\016/"
+	.string	"\034\201k\231GP\321T\032&\366\372\216\372\251-\342\231 H\206\267\r\336\264P\244W\346\n\325i\216\006Z\356\310?\324\233\036\002/Q\343\256\237\251\""
+	.string	"\320\304\307\255\3536Z\361\224n\232\303\033\241\205\305\272\037\033\035F"
+	.string	"/\356$\206cq\272\350YH\226\227\374\372A\021\351\342r\037\355T\257\022@.\377\235\245k 7Q\t\033N\327T5\352D\234\352\344\252\372\240=\321\327m\206\212\3746\003\342\367W\21768\362\201&\276\2541\275\032\334\034\242\372\016\244\302\253v'\016OB\262\022\nG\317\200P(\306\376\273%\333@\335O/~\313X\357\203\371t\310H_\206pGD\347*_\357l\027\367,\2363"
+	.string	"\213~\016\252\224\244<\022\264\022%\013\275\346\017\332\301\251c\0043\257\371\0210\375\205\325\262\234=\321\"\263\211Q\300\314\227\215\256\372U0#\327F\272\377\264\310\352>\204\213\232\016\210\215\302k:\231\245\320\224\323\261)\2045\352B\330\204\034T\242\335\334X\0079cV^._\006"
+	.ascii	"\244\210c\"\260\022\033a\377\036F\242\002T/d. 0\342m\206M\r\267"
+	.ascii	";\242\352\372\240*\207\255^\304\211\201hq\344\203\3713cT\tYb"
+	.ascii	"dx\266\024xp\b\244p\340\200\021\205\3129\307\034q!\351\327=6"
+	.ascii	"\360\b\374N!\314j\324\362U\341\001\332\352\313\211\320\326\333"
+	.ascii	"\002\t\025\334T\003\220\206W\310\274`0\230\312z+$\030>H\f8\005"
+	.ascii	"\t]\230b*\247x\260bL\246\r~\246-\020\213n\252<\037\377\374\307"
+	.ascii	"H\252\024A\266\307\001\215\2229\021LYF\3760G(a\347\207\357\004"
+	.ascii	"g\270\017M\2164\031k\376)d)\314-]{\360\"C\330r?"
+	.ascii	"\330\265\214`H$f\031D\002c\214\027d#U\332\371\335\017j:\243\203"
+	.ascii	"\2029\325\261\n\262\350&Ep/\303-\265\2705m'\241\243D\322\343"
+	.ascii	"\211\356\"P6\315i\3530\363\251\273\236\324\361\356=|\371{\325"
+	.ascii	"\211k\351\200^\352u9\001\274\242\334cb\376Og\253\347\207\274"
+	.ascii	"=\270\317x\337\"9y\205\321k\017\323\224\203\202\fe\317k\372\223"
+	.ascii	"\b\220\362\334\021\255\205\350\334 B1\353\211T\263\261\003\006"
+	.ascii	"\301\242&e;\325\346\366\252\270i\0201\371{\343\210#q\f\352\r"
+	.ascii	"\036PS\237\231b\231%\246NK\360\350\370#\251 \372\207\024\301"
+	.ascii	"\201o\274i.\265\255\003\353\206\264\234\216\372\335\225\r\347"
+	.ascii	"0>3\331pa0<\201\226*\177A@s\013\201\243\201\004\217h\254\230"
+	.ascii	"\001\212=tx\271\271\t\233\370P\300!w\005\016\266\240\360\357"
+	.ascii	"\322\345\236G\254H{,,\024\r\301\221\353W\215G\341\240\247\244"
+	.ascii	"\004\f\031\2532\024\024>0\b\351\334u\307/\365\302\223(\222\263"
+	.ascii	"\346"
+	.string	"{\266n%\374\213\026@\017\353pJ\313U\017\237.\022\303\004\200\303S \232\003\302@_\025_\324\372\"P\213\rY\2175\3136Q\360\200\227\253V\227\332J\034e\222\360\266t$B\3064\031\020\263_\377\341\226Rvt\277Ks\275\223,\320\t\207\006\270)\\Z\273\335\247\327a\353m\203\350\211Bg\362#\256\266;\372#*\222\2676\233\220\330\201\347\0201\" \025\375\266\326\344\034\270K\301\013\364#\325\333\223,\242\300\320\023\235\b\027\003,7\2404\202\235\327\004Hf)\020\361\030\3059\320\353&[\n\376\347\316\227\203h\201\035\n\334\2304\245%\347\307jq\333\330Y\032\216O\217\245\006Wt\n\305\334\226\315\013\025^\244/~\302[\n[P\374O\350$hme\346*\0325.\235\336\253\271\377\324\242\001\017\245\351\206/,mx#\017\223\270\220\325\005\256TUt\336\316\2723A\310\206\244\004m"
+	.ascii	"\346N\316s\236\216\b\376d\177\223\nf\223\235\334`\340\034\224"
+	.ascii	"\222\204\365n\260/"
+	.string	"\305\363[\032I\326\223\226\2115\363b\2011\"$\264\033\273\006\205\351\2704S\332-\240\337\037\003nF\333\0032\262\\4m\231\354~\352\262,\262\347\2211\361W\271\276\230my\300\267JE@\354\235\300Vb*\337Xm\360\022\2521%\031\002\016\n\251\fd>D\035\372\177\265\214\336\201\345rc@\326]\255e\327\362\202`\263k\324)\377\366\307\246\037\323\026\367nj\200\207\017y\223\023\244s\334t\022V\220]R\2500R\004\277\256\217\036{\003\345\322P\224Q}Lg\356\206\004\320r\t\300\024\001=\363\226\003\244\377c\031\365\004@&\247|f a\262c\212\213\303\032\250+\225\257\354\354\363\007\254f\221i\f5\216Pd\251\243\334\333$\265\227'\322(\f\234\333\305\231\r\375\205X\013\260`\017\226^\236\2232\316|v\376M/\221\263N\314\034\tE]\343f\241=\270#\264\303\326oh\226\240\027"
+	.ascii	"y\335\310-K(A|E8\177j2{\206\020\367\273\264\340\210\327\\\224"
+	.ascii	"\351\007\227\210\343~\351V\316\376\371\245\210/4\235]\324d\310"
+	.ascii	"\330\272\207\003\352\2404\212:R-\200\036\200\356 \027\177\232"
+	.ascii	"\302\344[9LLG|\tr\006P\244\256\311\262o\246[\250jt\334u\334\250"
+	.ascii	"\345\3043\253f]\2038N\263iES\275\227\217\240\005\2106y\270\236"
+	.ascii	"H\214e\320\225\223\207\214\356I\351od\017\361\222/\200}\343\370"
+	.ascii	"l\350,\351\2531\337\246\257\223Y\320\271\017\212\337#\347\226"
+	.ascii	"2\311\304\t\344K~`\277\311\314\300\351\302\031'\201\356\326w"
+	.ascii	"\242~^\233\214\262p\022\020\032d}\337p\267\305\030\363\250\375"
+	.ascii	" \361\f\224G\370\247{8>\274\205\304[\\\334\257@\341\237\223\347"
+	.ascii	"!\027\251\3612\371\007\272\033\030}\201\210\233\005[\340I\026"
+	.ascii	"\003\374\345so\220\337\"\363.P\317\305\376\325\3329Y\177\362"
+	.ascii	"<\225{\321\365P\250\307\340\337\264\361\205\364:\245\227g\255"
+	.ascii	"\373\266\2143\372K\352\3016\217\021\231\027\006\227\314(\305"
+	.ascii	"\221\231\270.\277b\224\371B|\305\216\013&\321R\270Tt>Zg\243\257"
+	.ascii	"d\037\273\361I\266_\216\271\031?\236\263\002g1\303\317\306\355"
+	.ascii	"{\306R\374\200qm\240U\262\277\234\275\321Ms\362W\330'o\032i\037"
+	.ascii	"\351\013\246\344\256"
+	.text
+	.section	.gnu.lto_.symtab.9a9d7cdd9a53e28f,"e",@progbits
+	.string	"taskBatteryAlerts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"taskSerialCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"gyroSampleIsDue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"taskGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"taskMainPidLoopCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"rcSplitProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"flashfsPoll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"blackboxIsLogging"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9a9d7cdd9a53e28f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16355 @@
+	.file	"rc_adjustments.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/config/parameter_group.h"
+	.file 8 "./src/main/blackbox/blackbox.h"
+	.file 9 "./src/main/common/axis.h"
+	.file 10 "./src/main/flight/pid.h"
+	.file 11 "./src/main/target/SITL/target.h"
+	.file 12 "./src/main/drivers/io_types.h"
+	.file 13 "./src/main/drivers/resource.h"
+	.file 14 "./src/main/fc/controlrate_profile.h"
+	.file 15 "./src/main/fc/rc_modes.h"
+	.file 16 "./src/main/fc/rc_adjustments.h"
+	.file 17 "./src/main/rx/rx.h"
+	.file 18 "./src/main/fc/rc_adjustments.c"
+	.file 19 "/usr/include/string.h"
+	.file 20 "./src/main/io/beeper.h"
+	.file 21 "./src/main/fc/config.h"
+	.file 22 "./src/main/drivers/time.h"
+	.file 23 "./src/main/common/utils.h"
+	.file 24 "./src/main/common/maths.h"
+	.file 25 "./src/main/fc/fc_rc.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_adjustments.c.8295ed8d
+	.weak	rc_adjustments.c.8295ed8d
+rc_adjustments.c.8295ed8d:
+	.long	0x110e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF2395
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2043
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2044
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2045
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2046
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2047
+	.uleb128 0x3
+	.long	.LASF2048
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2049
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2050
+	.uleb128 0x3
+	.long	.LASF2051
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2052
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2053
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2054
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2055
+	.uleb128 0x3
+	.long	.LASF2056
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2057
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2058
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF2059
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	0xc8
+	.uleb128 0x3
+	.long	.LASF2060
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x5
+	.long	0xd9
+	.uleb128 0x3
+	.long	.LASF2061
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2062
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2063
+	.uleb128 0x1b
+	.long	.LASF2171
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd9
+	.uleb128 0x24
+	.long	.LASF2069
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x5
+	.byte	0x71
+	.byte	0xe
+	.long	0x141
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2069
+	.byte	0x5
+	.byte	0x77
+	.byte	0x3
+	.long	0x110
+	.uleb128 0x4
+	.long	.LASF2071
+	.byte	0x4
+	.byte	0x5
+	.byte	0x79
+	.long	0x167
+	.uleb128 0x2
+	.long	.LASF2073
+	.byte	0x5
+	.byte	0x7a
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2070
+	.byte	0x5
+	.byte	0x7b
+	.byte	0x3
+	.long	0x14d
+	.uleb128 0x4
+	.long	.LASF2072
+	.byte	0x8
+	.byte	0x5
+	.byte	0x7d
+	.long	0x19a
+	.uleb128 0x2
+	.long	.LASF2074
+	.byte	0x5
+	.byte	0x7e
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2075
+	.byte	0x5
+	.byte	0x7f
+	.byte	0xe
+	.long	0xd9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2076
+	.byte	0x5
+	.byte	0x80
+	.byte	0x3
+	.long	0x173
+	.uleb128 0x4
+	.long	.LASF2077
+	.byte	0xc
+	.byte	0x5
+	.byte	0x82
+	.long	0x1e7
+	.uleb128 0x2
+	.long	.LASF2078
+	.byte	0x5
+	.byte	0x83
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2079
+	.byte	0x5
+	.byte	0x84
+	.byte	0x9
+	.long	0x1e7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2080
+	.byte	0x5
+	.byte	0x85
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2081
+	.byte	0x5
+	.byte	0x86
+	.byte	0xb
+	.long	0xf6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2082
+	.uleb128 0x5
+	.long	0x1e7
+	.uleb128 0x3
+	.long	.LASF2083
+	.byte	0x5
+	.byte	0x87
+	.byte	0x3
+	.long	0x1a6
+	.uleb128 0x4
+	.long	.LASF2084
+	.byte	0x8
+	.byte	0x5
+	.byte	0x89
+	.long	0x226
+	.uleb128 0x2
+	.long	.LASF2085
+	.byte	0x5
+	.byte	0x8a
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2086
+	.byte	0x5
+	.byte	0x8b
+	.byte	0xe
+	.long	0xd9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2087
+	.byte	0x5
+	.byte	0x8c
+	.byte	0x3
+	.long	0x1ff
+	.uleb128 0x4
+	.long	.LASF2088
+	.byte	0xc
+	.byte	0x5
+	.byte	0x90
+	.long	0x266
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x5
+	.byte	0x91
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x5
+	.byte	0x92
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x5
+	.byte	0x93
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2092
+	.byte	0x5
+	.byte	0x94
+	.byte	0x3
+	.long	0x232
+	.uleb128 0x1c
+	.long	.LASF2303
+	.byte	0xc
+	.byte	0x5
+	.byte	0x96
+	.long	0x2bb
+	.uleb128 0xd
+	.long	.LASF2093
+	.byte	0x5
+	.byte	0x97
+	.byte	0x1f
+	.long	0x167
+	.uleb128 0xd
+	.long	.LASF2094
+	.byte	0x5
+	.byte	0x98
+	.byte	0x21
+	.long	0x19a
+	.uleb128 0xd
+	.long	.LASF2095
+	.byte	0x5
+	.byte	0x99
+	.byte	0x29
+	.long	0x1f3
+	.uleb128 0xd
+	.long	.LASF2096
+	.byte	0x5
+	.byte	0x9a
+	.byte	0x24
+	.long	0x226
+	.uleb128 0xd
+	.long	.LASF2097
+	.byte	0x5
+	.byte	0x9b
+	.byte	0x27
+	.long	0x266
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2098
+	.byte	0x5
+	.byte	0x9c
+	.byte	0x3
+	.long	0x272
+	.uleb128 0x3
+	.long	.LASF2099
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0x3
+	.long	.LASF2100
+	.byte	0x7
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x21
+	.long	0x306
+	.uleb128 0x16
+	.long	.LASF2101
+	.value	0xfff
+	.uleb128 0x16
+	.long	.LASF2102
+	.value	0xf000
+	.uleb128 0x16
+	.long	.LASF2103
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2105
+	.byte	0x7
+	.byte	0x29
+	.byte	0xf
+	.long	0x312
+	.uleb128 0x25
+	.long	0x322
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x26
+	.byte	0x8
+	.byte	0x7
+	.byte	0x31
+	.byte	0x5
+	.long	0x341
+	.uleb128 0x1d
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x341
+	.byte	0
+	.uleb128 0x6
+	.long	0x306
+	.uleb128 0x4
+	.long	.LASF2106
+	.byte	0x28
+	.byte	0x7
+	.byte	0x2b
+	.long	0x3a1
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xb
+	.long	0x2d3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2108
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xe
+	.long	0x3a1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2109
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xe
+	.long	0x3a1
+	.byte	0x10
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x7
+	.byte	0x30
+	.byte	0xf
+	.long	0x3a6
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2110
+	.byte	0x7
+	.byte	0x34
+	.byte	0x7
+	.long	0x322
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x3a1
+	.uleb128 0x3
+	.long	.LASF2111
+	.byte	0x7
+	.byte	0x35
+	.byte	0x3
+	.long	0x346
+	.uleb128 0x5
+	.long	0x3ab
+	.uleb128 0x4
+	.long	.LASF2112
+	.byte	0x8
+	.byte	0x8
+	.byte	0x2a
+	.long	0x431
+	.uleb128 0x2
+	.long	.LASF2113
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2114
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x8
+	.byte	0x30
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x8
+	.byte	0x31
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x8
+	.byte	0x32
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2121
+	.byte	0x8
+	.byte	0x33
+	.byte	0x3
+	.long	0x3bc
+	.uleb128 0x5
+	.long	0x431
+	.uleb128 0x12
+	.long	.LASF2322
+	.byte	0x8
+	.byte	0x35
+	.byte	0x19
+	.long	0x431
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x9
+	.byte	0x1d
+	.long	0x46c
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xa
+	.byte	0x25
+	.long	0x4ba
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0xa
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xa
+	.byte	0x3e
+	.long	0x4d8
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2139
+	.byte	0xa
+	.byte	0x42
+	.byte	0x3
+	.long	0x4ba
+	.uleb128 0x4
+	.long	.LASF2140
+	.byte	0x3
+	.byte	0xa
+	.byte	0x44
+	.long	0x512
+	.uleb128 0x11
+	.string	"P"
+	.byte	0xa
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x11
+	.string	"I"
+	.byte	0xa
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x11
+	.string	"D"
+	.byte	0xa
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2141
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x4e4
+	.uleb128 0x4
+	.long	.LASF2142
+	.byte	0x4c
+	.byte	0xa
+	.byte	0x4a
+	.long	0x697
+	.uleb128 0x11
+	.string	"pid"
+	.byte	0xa
+	.byte	0x4b
+	.byte	0xc
+	.long	0x697
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2144
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc8
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2145
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2146
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xc8
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0xa
+	.byte	0x51
+	.byte	0xe
+	.long	0xc8
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0xa
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0xa
+	.byte	0x53
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0xa
+	.byte	0x54
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0xa
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0xa
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0xa
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0xa
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0xa
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2157
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2158
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0xa
+	.byte	0x60
+	.byte	0xe
+	.long	0xc8
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0xa
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2161
+	.byte	0xa
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0xa
+	.byte	0x63
+	.byte	0xe
+	.long	0xc8
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0xa
+	.byte	0x64
+	.byte	0xe
+	.long	0xc8
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0xa
+	.byte	0x65
+	.byte	0xe
+	.long	0xc8
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0xa
+	.byte	0x66
+	.byte	0xe
+	.long	0xc8
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0xa
+	.byte	0x67
+	.byte	0xe
+	.long	0xc8
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0xa
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2168
+	.byte	0xa
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2169
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x18
+	.long	0x4d8
+	.byte	0x48
+	.byte	0
+	.uleb128 0xe
+	.long	0x512
+	.long	0x6a7
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2170
+	.byte	0xa
+	.byte	0x6b
+	.byte	0x3
+	.long	0x51e
+	.uleb128 0x5
+	.long	0x6a7
+	.uleb128 0x1b
+	.long	.LASF2172
+	.byte	0xa
+	.byte	0x79
+	.byte	0x5
+	.long	0x1e7
+	.uleb128 0xe
+	.long	0xb7
+	.long	0x6d4
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2173
+	.byte	0xc
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xd
+	.byte	0x14
+	.long	0x806
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2221
+	.byte	0xc
+	.byte	0xe
+	.byte	0x19
+	.long	0x888
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xe
+	.byte	0x1c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0xe
+	.byte	0x1d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0xe
+	.byte	0x1e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xd
+	.long	0x6c4
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0xe
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0xe
+	.byte	0x21
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0xe
+	.byte	0x22
+	.byte	0xe
+	.long	0xc8
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2231
+	.byte	0xe
+	.byte	0x23
+	.byte	0x3
+	.long	0x806
+	.uleb128 0x6
+	.long	0x888
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0x18
+	.long	0x989
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x25
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2270
+	.byte	0x2
+	.byte	0xf
+	.byte	0x53
+	.long	0x9b0
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0xf
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0xf
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2273
+	.byte	0xf
+	.byte	0x56
+	.byte	0x3
+	.long	0x989
+	.uleb128 0x5
+	.long	0x9b0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x10
+	.byte	0x18
+	.long	0xa69
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x19
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x10
+	.byte	0x33
+	.byte	0x3
+	.long	0x9c1
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x10
+	.byte	0x36
+	.long	0xa8d
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2304
+	.byte	0x1
+	.byte	0x10
+	.byte	0x3b
+	.long	0xab2
+	.uleb128 0xd
+	.long	.LASF2305
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0xd
+	.long	.LASF2306
+	.byte	0x10
+	.byte	0x3d
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2307
+	.byte	0x10
+	.byte	0x3e
+	.byte	0x3
+	.long	0xa8d
+	.uleb128 0x4
+	.long	.LASF2308
+	.byte	0x3
+	.byte	0x10
+	.byte	0x40
+	.long	0xaf2
+	.uleb128 0x2
+	.long	.LASF2078
+	.byte	0x10
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2309
+	.byte	0x10
+	.byte	0x42
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2310
+	.byte	0x10
+	.byte	0x43
+	.byte	0x16
+	.long	0xab2
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2311
+	.byte	0x10
+	.byte	0x44
+	.byte	0x3
+	.long	0xabe
+	.uleb128 0x5
+	.long	0xaf2
+	.uleb128 0x4
+	.long	.LASF2312
+	.byte	0x6
+	.byte	0x10
+	.byte	0x46
+	.long	0xb51
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x10
+	.byte	0x48
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x10
+	.byte	0x49
+	.byte	0x14
+	.long	0x9b0
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2078
+	.byte	0x10
+	.byte	0x4c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x10
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x10
+	.byte	0x50
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x10
+	.byte	0x51
+	.byte	0x3
+	.long	0xb03
+	.uleb128 0x5
+	.long	0xb51
+	.uleb128 0x4
+	.long	.LASF2318
+	.byte	0x18
+	.byte	0x10
+	.byte	0x55
+	.long	0xb96
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x10
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x10
+	.byte	0x57
+	.byte	0x1f
+	.long	0xb96
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0x10
+	.byte	0x58
+	.byte	0xe
+	.long	0xd9
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	0xafe
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x10
+	.byte	0x59
+	.byte	0x3
+	.long	0xb62
+	.uleb128 0xe
+	.long	0xb51
+	.long	0xbb7
+	.uleb128 0xf
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2323
+	.byte	0x10
+	.byte	0x62
+	.byte	0x1a
+	.long	0xba7
+	.uleb128 0x12
+	.long	.LASF2324
+	.byte	0x10
+	.byte	0x62
+	.byte	0x55
+	.long	0xba7
+	.uleb128 0xe
+	.long	0x9f
+	.long	0xbdf
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2325
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x10
+	.long	0xbcf
+	.uleb128 0x4
+	.long	.LASF2326
+	.byte	0x2c
+	.byte	0x11
+	.byte	0x75
+	.long	0xd3d
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x11
+	.byte	0x76
+	.byte	0xd
+	.long	0xd3d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x11
+	.byte	0x77
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x11
+	.byte	0x78
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x11
+	.byte	0x79
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2331
+	.byte	0x11
+	.byte	0x7a
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x11
+	.byte	0x7b
+	.byte	0xe
+	.long	0xd9
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x11
+	.byte	0x7c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x11
+	.byte	0x7d
+	.byte	0xd
+	.long	0x6d4
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x11
+	.byte	0x7e
+	.byte	0xd
+	.long	0x6d4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0x11
+	.byte	0x7f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0x11
+	.byte	0x80
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2338
+	.byte	0x11
+	.byte	0x81
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0x11
+	.byte	0x82
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0x11
+	.byte	0x83
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0x11
+	.byte	0x84
+	.byte	0xe
+	.long	0xc8
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0x11
+	.byte	0x85
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2343
+	.byte	0x11
+	.byte	0x86
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2344
+	.byte	0x11
+	.byte	0x87
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2345
+	.byte	0x11
+	.byte	0x88
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x11
+	.byte	0x89
+	.byte	0xd
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0x11
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x11
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x11
+	.byte	0x8c
+	.byte	0xe
+	.long	0xc8
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x11
+	.byte	0x8e
+	.byte	0xe
+	.long	0xc8
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x11
+	.byte	0x8f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x28
+	.byte	0
+	.uleb128 0xe
+	.long	0xb7
+	.long	0xd4d
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2352
+	.byte	0x11
+	.byte	0x90
+	.byte	0x3
+	.long	0xbeb
+	.uleb128 0x5
+	.long	0xd4d
+	.uleb128 0x12
+	.long	.LASF2353
+	.byte	0x11
+	.byte	0x92
+	.byte	0x13
+	.long	0xd4d
+	.uleb128 0x1e
+	.long	0xbb7
+	.byte	0x13
+	.uleb128 0x1e
+	.long	0xbc3
+	.byte	0x47
+	.uleb128 0x12
+	.long	.LASF2354
+	.byte	0x12
+	.byte	0x35
+	.byte	0x81
+	.long	0x3b7
+	.uleb128 0x27
+	.long	0xd76
+	.byte	0xaf
+	.uleb128 0x10
+	.long	.LASF2355
+	.byte	0x37
+	.byte	0x16
+	.long	0xd93
+	.uleb128 0x6
+	.long	0x6a7
+	.uleb128 0x10
+	.long	.LASF2356
+	.byte	0x5b
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xe
+	.long	0xafe
+	.long	0xdb3
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x17
+	.byte	0
+	.uleb128 0x5
+	.long	0xda3
+	.uleb128 0x10
+	.long	.LASF2357
+	.byte	0x63
+	.byte	0x21
+	.long	0xdb3
+	.uleb128 0xe
+	.long	0xb9b
+	.long	0xdd3
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2358
+	.byte	0xca
+	.byte	0x1a
+	.long	0xdc3
+	.uleb128 0x1f
+	.long	.LASF2359
+	.byte	0xf
+	.byte	0x6c
+	.byte	0x5
+	.long	0x1e7
+	.long	0xdf9
+	.uleb128 0x8
+	.long	0xb7
+	.uleb128 0x8
+	.long	0xdf9
+	.byte	0
+	.uleb128 0x6
+	.long	0x9bc
+	.uleb128 0x1f
+	.long	.LASF2360
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xe1e
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x8
+	.long	0xea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2361
+	.byte	0xe
+	.byte	0x2b
+	.long	0xe2f
+	.uleb128 0x8
+	.long	0xb7
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2365
+	.byte	0x15
+	.byte	0x7e
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x13
+	.long	.LASF2362
+	.byte	0x8
+	.byte	0x37
+	.long	0xe51
+	.uleb128 0x8
+	.long	0x141
+	.uleb128 0x8
+	.long	0xe51
+	.byte	0
+	.uleb128 0x6
+	.long	0x2bb
+	.uleb128 0x28
+	.long	.LASF2396
+	.byte	0x19
+	.byte	0x1a
+	.byte	0x6
+	.uleb128 0x13
+	.long	.LASF2363
+	.byte	0x14
+	.byte	0x3f
+	.long	0xe6f
+	.uleb128 0x8
+	.long	0xb7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2364
+	.byte	0xa
+	.byte	0x84
+	.long	0xe80
+	.uleb128 0x8
+	.long	0xe80
+	.byte	0
+	.uleb128 0x6
+	.long	0x6b3
+	.uleb128 0x17
+	.long	.LASF2366
+	.byte	0x11
+	.byte	0xa3
+	.byte	0x5
+	.long	0x1e7
+	.uleb128 0x17
+	.long	.LASF2367
+	.byte	0x16
+	.byte	0x1d
+	.byte	0xa
+	.long	0x2c7
+	.uleb128 0x18
+	.long	.LASF2368
+	.value	0x1bb
+	.long	0xeb5
+	.uleb128 0x14
+	.long	.LASF2374
+	.value	0x1bb
+	.byte	0x28
+	.long	0xd93
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2369
+	.value	0x1b0
+	.long	0xeeb
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2370
+	.value	0x1b2
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2371
+	.value	0x1b3
+	.byte	0x29
+	.long	0xef0
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2372
+	.value	0x1b5
+	.byte	0x27
+	.long	0xb96
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xb5d
+	.uleb128 0x5
+	.long	0xeeb
+	.uleb128 0x29
+	.long	.LASF2397
+	.byte	0x12
+	.value	0x1ab
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF2373
+	.value	0x174
+	.long	0xf8f
+	.uleb128 0x14
+	.long	.LASF2375
+	.value	0x174
+	.byte	0x30
+	.long	0x894
+	.uleb128 0x2a
+	.string	"now"
+	.byte	0x12
+	.value	0x176
+	.byte	0x14
+	.long	0xe5
+	.uleb128 0x7
+	.long	.LASF2376
+	.value	0x178
+	.byte	0xf
+	.long	0x1ee
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2316
+	.value	0x17a
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2377
+	.value	0x17b
+	.byte	0x1c
+	.long	0xf8f
+	.uleb128 0x7
+	.long	.LASF2078
+	.value	0x180
+	.byte	0x17
+	.long	0xc3
+	.uleb128 0x7
+	.long	.LASF2378
+	.value	0x18e
+	.byte	0x17
+	.long	0xc3
+	.uleb128 0x2b
+	.long	0xf72
+	.uleb128 0x7
+	.long	.LASF2379
+	.value	0x191
+	.byte	0x11
+	.long	0x7c
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2380
+	.value	0x1a3
+	.byte	0x1c
+	.long	0xd4
+	.uleb128 0x7
+	.long	.LASF2381
+	.value	0x1a4
+	.byte	0x1b
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xb9b
+	.uleb128 0x2c
+	.long	.LASF2383
+	.byte	0x12
+	.value	0x152
+	.byte	0xd
+	.long	0xfd4
+	.uleb128 0x14
+	.long	.LASF2078
+	.value	0x152
+	.byte	0x2b
+	.long	0xb7
+	.uleb128 0x14
+	.long	.LASF2381
+	.value	0x152
+	.byte	0x47
+	.long	0xb7
+	.uleb128 0x7
+	.long	.LASF2382
+	.value	0x154
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0xc
+	.uleb128 0x7
+	.long	.LASF2080
+	.value	0x162
+	.byte	0x15
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2384
+	.byte	0xdb
+	.long	0x100e
+	.uleb128 0xa
+	.long	.LASF2375
+	.byte	0x12
+	.byte	0xdb
+	.byte	0x36
+	.long	0x894
+	.uleb128 0xa
+	.long	.LASF2078
+	.byte	0x12
+	.byte	0xdb
+	.byte	0x51
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF2379
+	.byte	0x12
+	.byte	0xdb
+	.byte	0x69
+	.long	0x7c
+	.uleb128 0x10
+	.long	.LASF2080
+	.byte	0xdf
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2385
+	.byte	0xcc
+	.long	0x1048
+	.uleb128 0xa
+	.long	.LASF2370
+	.byte	0x12
+	.byte	0xcc
+	.byte	0x29
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF2315
+	.byte	0x12
+	.byte	0xcc
+	.byte	0x38
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF2372
+	.byte	0x12
+	.byte	0xcc
+	.byte	0x69
+	.long	0xb96
+	.uleb128 0x10
+	.long	.LASF2377
+	.byte	0xce
+	.byte	0x18
+	.long	0xf8f
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2386
+	.byte	0x39
+	.long	0x1078
+	.uleb128 0xa
+	.long	.LASF2078
+	.byte	0x12
+	.byte	0x39
+	.byte	0x45
+	.long	0xa69
+	.uleb128 0xa
+	.long	.LASF2080
+	.byte	0x12
+	.byte	0x39
+	.byte	0x61
+	.long	0xab
+	.uleb128 0xc
+	.uleb128 0x10
+	.long	.LASF2387
+	.byte	0x40
+	.byte	0x2d
+	.long	0x1f3
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2393
+	.byte	0x11
+	.byte	0x92
+	.byte	0x65
+	.long	0x1084
+	.uleb128 0x6
+	.long	0xd59
+	.uleb128 0x1a
+	.long	.LASF2389
+	.byte	0x10
+	.byte	0x62
+	.byte	0x9c
+	.long	0xeeb
+	.long	0x10a6
+	.uleb128 0xa
+	.long	.LASF2388
+	.byte	0x10
+	.byte	0x62
+	.byte	0xb1
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2390
+	.byte	0x17
+	.byte	0x5d
+	.byte	0x17
+	.long	0xab
+	.long	0x10cb
+	.uleb128 0x15
+	.string	"a"
+	.byte	0x17
+	.byte	0x5d
+	.byte	0x26
+	.long	0xd9
+	.uleb128 0x15
+	.string	"b"
+	.byte	0x17
+	.byte	0x5d
+	.byte	0x32
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2391
+	.byte	0x18
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.long	0x1100
+	.uleb128 0x15
+	.string	"amt"
+	.byte	0x18
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x15
+	.string	"low"
+	.byte	0x18
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF2392
+	.byte	0x18
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2394
+	.byte	0x8
+	.byte	0x35
+	.byte	0x83
+	.long	0x110c
+	.uleb128 0x6
+	.long	0x43d
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 53
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 26 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.file 29 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 31 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 32 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 55 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x37
+	.file 56 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 57 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1411
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1412
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.file 58 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x4
+	.file 59 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 60 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x14
+	.byte	0x4
+	.file 61 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x15
+	.file 62 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 63 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 65 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x42
+	.file 67 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x43
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 68 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 69 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1974
+	.byte	0x4
+	.file 70 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 72 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 73 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1984
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1985
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 74 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF2042
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1437
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1441
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1570
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1579
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1593
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1605
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1973
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1983
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1993
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2037
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2398
+	.long	.LASF2399
+	.long	.LASF2400
+	.long	.LASF2401
+	.long	.LASF2402
+	.long	.LASF2403
+	.long	.LASF2404
+	.long	.LASF2405
+	.long	.LASF2406
+	.long	.LASF2407
+	.long	.LASF2408
+	.long	.LASF2409
+	.long	.LASF2410
+	.long	.LASF2411
+	.long	.LASF2412
+	.long	.LASF2413
+	.long	.LASF2414
+	.long	.LASF2415
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2416
+	.byte	0xe
+	.long	.LASF2417
+	.byte	0xe
+	.long	.LASF2418
+	.byte	0xe
+	.long	.LASF2419
+	.byte	0x12
+	.long	.LASF2420
+	.byte	0x1
+	.long	.LASF2421
+	.byte	0x3
+	.long	.LASF2422
+	.byte	0x4
+	.long	.LASF2423
+	.byte	0x1
+	.long	.LASF2424
+	.byte	0x3
+	.long	.LASF2425
+	.byte	0x7
+	.long	.LASF2426
+	.byte	0xa
+	.long	.LASF2427
+	.byte	0x5
+	.long	.LASF2428
+	.byte	0x5
+	.long	.LASF2429
+	.byte	0x6
+	.long	.LASF2430
+	.byte	0x6
+	.long	.LASF2431
+	.byte	0x6
+	.long	.LASF2432
+	.byte	0x9
+	.long	.LASF2433
+	.byte	0x6
+	.long	.LASF2434
+	.byte	0x11
+	.long	.LASF2435
+	.byte	0x8
+	.long	.LASF2436
+	.byte	0x6
+	.long	.LASF2421
+	.byte	0x5
+	.long	.LASF2437
+	.byte	0x3
+	.long	.LASF2438
+	.byte	0x3
+	.long	.LASF2439
+	.byte	0x6
+	.long	.LASF2440
+	.byte	0x11
+	.long	.LASF2441
+	.byte	0x12
+	.long	.LASF2442
+	.byte	0x12
+	.long	.LASF2442
+	.byte	0x11
+	.long	.LASF2443
+	.byte	0xe
+	.long	.LASF2444
+	.byte	0x11
+	.long	.LASF2445
+	.byte	0x11
+	.long	.LASF2446
+	.byte	0xe
+	.long	.LASF2447
+	.byte	0xe
+	.long	.LASF2448
+	.byte	0x10
+	.long	.LASF2449
+	.byte	0xe
+	.long	.LASF2450
+	.byte	0xf
+	.long	.LASF2451
+	.byte	0xf
+	.long	.LASF2452
+	.byte	0xe
+	.long	.LASF2453
+	.byte	0xe
+	.long	.LASF2454
+	.byte	0xe
+	.long	.LASF2455
+	.byte	0xd
+	.long	.LASF2456
+	.byte	0xd
+	.long	.LASF2457
+	.byte	0x11
+	.long	.LASF2458
+	.byte	0x11
+	.long	.LASF2459
+	.byte	0xe
+	.long	.LASF2460
+	.byte	0xe
+	.long	.LASF2461
+	.byte	0xe
+	.long	.LASF2462
+	.byte	0xe
+	.long	.LASF2463
+	.byte	0xe
+	.long	.LASF2464
+	.byte	0xe
+	.long	.LASF2465
+	.byte	0xe
+	.long	.LASF2466
+	.byte	0xe
+	.long	.LASF2467
+	.byte	0xe
+	.long	.LASF2468
+	.byte	0xc
+	.long	.LASF2469
+	.byte	0xb
+	.long	.LASF2470
+	.byte	0xb
+	.long	.LASF2471
+	.byte	0x2
+	.long	.LASF2472
+	.byte	0x4
+	.long	.LASF2473
+	.byte	0x4
+	.long	.LASF2474
+	.byte	0x8
+	.long	.LASF2475
+	.byte	0x5
+	.long	.LASF2476
+	.byte	0x5
+	.long	.LASF2477
+	.byte	0x5
+	.long	.LASF2478
+	.byte	0x5
+	.long	.LASF2479
+	.byte	0x5
+	.long	.LASF2480
+	.byte	0x5
+	.long	.LASF2481
+	.byte	0x5
+	.long	.LASF2482
+	.byte	0x5
+	.long	.LASF2483
+	.byte	0x5
+	.long	.LASF2484
+	.byte	0x5
+	.long	.LASF2485
+	.byte	0x5
+	.long	.LASF2486
+	.byte	0x5
+	.long	.LASF2487
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1965:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1737:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2001:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1721:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1989:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1601:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1795:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1741:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF2318:
+	.string	"adjustmentState_s"
+.LASF2321:
+	.string	"adjustmentState_t"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2212:
+	.string	"OWNER_RX_BIND"
+.LASF1612:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF2268:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF1446:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1647:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2292:
+	.string	"ADJUSTMENT_ROLL_P"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF2136:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2172:
+	.string	"airmodeWasActivated"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1610:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1868:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1698:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1412:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1420:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1949:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2264:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2048:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1689:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2082:
+	.string	"_Bool"
+.LASF2323:
+	.string	"adjustmentRanges_SystemArray"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2397:
+	.string	"resetAdjustmentStates"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1814:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1586:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1706:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2182:
+	.string	"OWNER_ADC_CURR"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1668:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1619:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1992:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1774:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1590:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1639:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1674:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2036:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2091:
+	.string	"gtuneNewP"
+.LASF1792:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2044:
+	.string	"short unsigned int"
+.LASF2353:
+	.string	"rxConfig_System"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF2340:
+	.string	"rssi_invert"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1961:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1452:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1529:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1521:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1800:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1784:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1933:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1908:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1485:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2305:
+	.string	"step"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1632:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1937:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1649:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1910:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1740:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2059:
+	.string	"uint16_t"
+.LASF2236:
+	.string	"BOXANTIGRAVITY"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1558:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1474:
+	.string	"PP_IIF_1(t,f) t"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1900:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1744:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1879:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1983:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1430:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1867:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF1832:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1853:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2354:
+	.string	"adjustmentRanges_Registry"
+.LASF1594:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2022:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1843:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1489:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1712:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1974:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2041:
+	.string	"ADJUSTMENT_FUNCTION_CONFIG_INDEX_OFFSET 1"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1502:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2324:
+	.string	"adjustmentRanges_CopyArray"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2231:
+	.string	"controlRateConfig_t"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2016:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1620:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1509:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1997:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1924:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2033:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2254:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1525:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1265:
+	.string	"CMS "
+.LASF1859:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1932:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2086:
+	.string	"currentTime"
+.LASF2127:
+	.string	"PID_YAW"
+.LASF1825:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1888:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1960:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2186:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2205:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2019:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1437:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1628:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1593:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1476:
+	.string	"BIT(x) (1 << (x))"
+.LASF2210:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1582:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1687:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF2306:
+	.string	"switchPositions"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF2057:
+	.string	"int32_t"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2011:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2273:
+	.string	"channelRange_t"
+.LASF1465:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1946:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF2218:
+	.string	"OWNER_SPI_PREINIT"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF1882:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1599:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2390:
+	.string	"cmp32"
+.LASF1434:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1652:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2207:
+	.string	"OWNER_BARO_EXTI"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF2155:
+	.string	"levelSensitivity"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1747:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1608:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1964:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2363:
+	.string	"beeperConfirmationBeeps"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2185:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2237:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1522:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2089:
+	.string	"gtuneAxis"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1661:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2103:
+	.string	"PGR_SIZE_MASK"
+.LASF2314:
+	.string	"range"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1898:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1675:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2226:
+	.string	"thrExpo8"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2094:
+	.string	"flightMode"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1981:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1776:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2017:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1578:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1716:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1927:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF2326:
+	.string	"rxConfig_s"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2208:
+	.string	"OWNER_USB"
+.LASF2370:
+	.string	"index"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF1753:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1554:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF2220:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1432:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1925:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1994:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF1609:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2234:
+	.string	"BOXHORIZON"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2361:
+	.string	"changeControlRateProfile"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1468:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2335:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF2149:
+	.string	"pidSumLimit"
+.LASF2156:
+	.string	"horizon_tilt_effect"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2338:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2366:
+	.string	"rxIsReceivingSignal"
+.LASF1669:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2209:
+	.string	"OWNER_USB_DETECT"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1806:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1844:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"PG_PID_PROFILE 14"
+.LASF2144:
+	.string	"dterm_lpf_hz"
+.LASF1768:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1759:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1746:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2030:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1845:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2248:
+	.string	"BOXLLIGHTS"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2190:
+	.string	"OWNER_SONAR_ECHO"
+.LASF2368:
+	.string	"useAdjustmentConfig"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1885:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2027:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2348:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1514:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2235:
+	.string	"BOXBARO"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2369:
+	.string	"updateAdjustmentStates"
+.LASF1975:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1466:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2178:
+	.string	"OWNER_SERVO"
+.LASF1478:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1302:
+	.string	"ACC "
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2285:
+	.string	"ADJUSTMENT_YAW_D"
+.LASF2284:
+	.string	"ADJUSTMENT_YAW_I"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2295:
+	.string	"ADJUSTMENT_RC_RATE_YAW"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF2283:
+	.string	"ADJUSTMENT_YAW_P"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1696:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1642:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1626:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2329:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1953:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1426:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1629:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1863:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1856:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2341:
+	.string	"midrc"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2013:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2049:
+	.string	"__int16_t"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2147:
+	.string	"dterm_notch_cutoff"
+.LASF2020:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2051:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2009:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2177:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2097:
+	.string	"gtuneCycleResult"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1972:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF364:
+	.string	"__k8 1"
+.LASF1453:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2204:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1990:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1471:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1982:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2165:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF2331:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1936:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1688:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1928:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1670:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1443:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1727:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1988:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2028:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2179:
+	.string	"OWNER_LED"
+.LASF2071:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1793:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1749:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1463:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF2282:
+	.string	"ADJUSTMENT_PITCH_ROLL_D"
+.LASF1559:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1739:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1780:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2043:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1627:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2330:
+	.string	"halfDuplex"
+.LASF1569:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1581:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2312:
+	.string	"adjustmentRange_s"
+.LASF2317:
+	.string	"adjustmentRange_t"
+.LASF1817:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2229:
+	.string	"rcYawExpo8"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF1515:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1834:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2332:
+	.string	"rx_spi_id"
+.LASF2053:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF2004:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2062:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1493:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1633:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2232:
+	.string	"BOXARM"
+.LASF1781:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2347:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1723:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1731:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF2342:
+	.string	"mincheck"
+.LASF1549:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1464:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1699:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF1588:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1645:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2359:
+	.string	"isRangeActive"
+.LASF2106:
+	.string	"pgRegistry_s"
+.LASF2111:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2362:
+	.string	"blackboxLogEvent"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2379:
+	.string	"delta"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1414:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2386:
+	.string	"blackboxLogInflightAdjustmentEvent"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2078:
+	.string	"adjustmentFunction"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1439:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2245:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF380:
+	.string	"__unix 1"
+.LASF1680:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2216:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1500:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2392:
+	.string	"high"
+.LASF2343:
+	.string	"maxcheck"
+.LASF2296:
+	.string	"ADJUSTMENT_D_SETPOINT"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF1714:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2026:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1604:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1692:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2199:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1921:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1931:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1625:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1472:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF382:
+	.string	"unix 1"
+.LASF2157:
+	.string	"horizon_tilt_expert_mode"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2375:
+	.string	"controlRateConfig"
+.LASF2274:
+	.string	"ADJUSTMENT_NONE"
+.LASF1630:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1719:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1736:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1857:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1742:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2101:
+	.string	"PGR_PGN_MASK"
+.LASF2255:
+	.string	"BOXSERVO1"
+.LASF2256:
+	.string	"BOXSERVO2"
+.LASF2257:
+	.string	"BOXSERVO3"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2230:
+	.string	"tpa_breakpoint"
+.LASF1665:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1951:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1880:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1520:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF1978:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1963:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1530:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1613:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2358:
+	.string	"adjustmentStates"
+.LASF1556:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1720:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1999:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1641:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1922:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF2099:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2031:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1912:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1585:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2107:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1942:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1653:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1660:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2337:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1540:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2351:
+	.string	"rx_max_usec"
+.LASF2281:
+	.string	"ADJUSTMENT_PITCH_ROLL_I"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF2280:
+	.string	"ADJUSTMENT_PITCH_ROLL_P"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1955:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1423:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2374:
+	.string	"pidProfileToUse"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1422:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2084:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF2087:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2213:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2061:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2023:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2039:
+	.string	"MARK_ADJUSTMENT_FUNCTION_AS_READY(adjustmentIndex) adjustmentStateMask &= ~(1 << adjustmentIndex)"
+.LASF2194:
+	.string	"OWNER_SPI_MOSI"
+.LASF1934:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2105:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1755:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2058:
+	.string	"uint8_t"
+.LASF2364:
+	.string	"pidInitConfig"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1572:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2193:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1695:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1722:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1724:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1763:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF1770:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1635:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF1745:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1805:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"VERY_FAST_MATH "
+.LASF1957:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2126:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2252:
+	.string	"BOXTELEMETRY"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF2301:
+	.string	"ADJUSTMENT_MODE_STEP"
+.LASF1567:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1873:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1786:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1811:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF2388:
+	.string	"_index"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2006:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1761:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2309:
+	.string	"mode"
+.LASF1600:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2176:
+	.string	"OWNER_PPMINPUT"
+.LASF2173:
+	.string	"ioTag_t"
+.LASF1591:
+	.string	"IOCFG_IPD 0"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2123:
+	.string	"FD_PITCH"
+.LASF2154:
+	.string	"levelAngleLimit"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1413:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1518:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2389:
+	.string	"adjustmentRanges"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2325:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1897:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1631:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2277:
+	.string	"ADJUSTMENT_THROTTLE_EXPO"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1979:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1546:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2072:
+	.string	"flightLogEvent_flightMode_s"
+.LASF2076:
+	.string	"flightLogEvent_flightMode_t"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1754:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2014:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1827:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1544:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1657:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2339:
+	.string	"rssi_scale"
+.LASF1508:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1717:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1429:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2225:
+	.string	"thrMid8"
+.LASF1513:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2025:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1681:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1833:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1852:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2263:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1615:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1734:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF1725:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2138:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF1557:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF1864:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1638:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2066:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF1909:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2344:
+	.string	"rcInterpolation"
+.LASF2139:
+	.string	"pidCrashRecovery_e"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1634:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2387:
+	.string	"eventData"
+.LASF1580:
+	.string	"IO_TAG_NONE 0"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1775:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2005:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2371:
+	.string	"adjustmentRange"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF2270:
+	.string	"channelRange_s"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF1851:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2287:
+	.string	"ADJUSTMENT_PITCH_RATE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1555:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2189:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2108:
+	.string	"address"
+.LASF1677:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1496:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2299:
+	.string	"ADJUSTMENT_FUNCTION_COUNT"
+.LASF1789:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1849:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1751:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1735:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2002:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2085:
+	.string	"logIteration"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1592:
+	.string	"IOCFG_IPU 0"
+.LASF1764:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF721:
+	.string	"NULL"
+.LASF1411:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2294:
+	.string	"ADJUSTMENT_ROLL_D"
+.LASF2279:
+	.string	"ADJUSTMENT_YAW_RATE"
+.LASF2293:
+	.string	"ADJUSTMENT_ROLL_I"
+.LASF2223:
+	.string	"rcYawRate8"
+.LASF719:
+	.string	"__size_t "
+.LASF2191:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1531:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1690:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2288:
+	.string	"ADJUSTMENT_ROLL_RATE"
+.LASF468:
+	.string	"__PMT"
+.LASF1614:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2345:
+	.string	"rcInterpolationChannels"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2069:
+	.string	"FlightLogEvent"
+.LASF2163:
+	.string	"rateAccelLimit"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2142:
+	.string	"pidProfile_s"
+.LASF2170:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1718:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1532:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1948:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1901:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1778:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2098:
+	.string	"flightLogEventData_t"
+.LASF2303:
+	.string	"flightLogEventData_u"
+.LASF2104:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1490:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1943:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF2070:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF2378:
+	.string	"channelIndex"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2181:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1907:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1701:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1711:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"UNIT_TESTED "
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1498:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF1667:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2096:
+	.string	"loggingResume"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2395:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1987:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1484:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2042:
+	.string	"RESET_FREQUENCY_2HZ (1000 / 2)"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1427:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2079:
+	.string	"floatFlag"
+.LASF2360:
+	.string	"memset"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1565:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1840:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1643:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2151:
+	.string	"dterm_average_count"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1547:
+	.string	"PG_PID_CONFIG 504"
+.LASF1915:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1729:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1683:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1756:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2291:
+	.string	"ADJUSTMENT_PITCH_D"
+.LASF1611:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2290:
+	.string	"ADJUSTMENT_PITCH_I"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1738:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2152:
+	.string	"vbatPidCompensation"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1622:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1438:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1682:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1663:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1623:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF2010:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2352:
+	.string	"rxConfig_t"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1765:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2110:
+	.string	"reset"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1491:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1460:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2197:
+	.string	"OWNER_SDCARD"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1952:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2056:
+	.string	"int16_t"
+.LASF1704:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2047:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1421:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1644:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF2075:
+	.string	"lastFlags"
+.LASF2116:
+	.string	"on_motor_test"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF1895:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1499:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2012:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1442:
+	.string	"sq(x) ((x)*(x))"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1480:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1419:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1858:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1876:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF2021:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2240:
+	.string	"BOXCAMSTAB"
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1892:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF2018:
+	.string	"PWM_PULSE_MIN 750"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2003:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2122:
+	.string	"FD_ROLL"
+.LASF1507:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2171:
+	.string	"SystemCoreClock"
+.LASF2300:
+	.string	"adjustmentFunction_e"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1801:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2260:
+	.string	"BOXAIRMODE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2328:
+	.string	"serialrx_provider"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1511:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1494:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1566:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2211:
+	.string	"OWNER_OSD"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1655:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2102:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1916:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1516:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1550:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2238:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2224:
+	.string	"rcExpo8"
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1618:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1762:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1598:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1809:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF2000:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1579:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1440:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1424:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2159:
+	.string	"itermAcceleratorGain"
+.LASF2130:
+	.string	"PID_POSR"
+.LASF2167:
+	.string	"crash_recovery_angle"
+.LASF2131:
+	.string	"PID_NAVR"
+.LASF1707:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1819:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1976:
+	.string	"I2CDEV_COUNT 4"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1993:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1624:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1563:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1822:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF1536:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1285:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2073:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1435:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1605:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1510:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF2308:
+	.string	"adjustmentConfig_s"
+.LASF2311:
+	.string	"adjustmentConfig_t"
+.LASF2304:
+	.string	"adjustmentConfig_u"
+.LASF2124:
+	.string	"FD_YAW"
+.LASF2054:
+	.string	"long int"
+.LASF2265:
+	.string	"BOXCAMERA2"
+.LASF2266:
+	.string	"BOXCAMERA3"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1503:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF1790:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1548:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1616:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1969:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1454:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2187:
+	.string	"OWNER_PINDEBUG"
+.LASF2007:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1939:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2357:
+	.string	"defaultAdjustmentConfigs"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2169:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1773:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1709:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2251:
+	.string	"BOXOSD"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1561:
+	.string	"PG_I2C_CONFIG 518"
+.LASF2298:
+	.string	"ADJUSTMENT_HORIZON_STRENGTH"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF2307:
+	.string	"adjustmentData_t"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2146:
+	.string	"dterm_notch_hz"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1666:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1685:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1804:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2253:
+	.string	"BOXGTUNE"
+.LASF1750:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1838:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1636:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1469:
+	.string	"EXPAND_I(x) x"
+.LASF1436:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1798:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2175:
+	.string	"OWNER_PWMINPUT"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2060:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF1913:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1813:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1877:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2090:
+	.string	"gtuneGyroAVG"
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2115:
+	.string	"device"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1812:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2278:
+	.string	"ADJUSTMENT_PITCH_ROLL_RATE"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2367:
+	.string	"millis"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2243:
+	.string	"BOXGPSHOLD"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1574:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1450:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF2381:
+	.string	"position"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1883:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2373:
+	.string	"processRcAdjustments"
+.LASF2221:
+	.string	"controlRateConfig_s"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2249:
+	.string	"BOXCALIB"
+.LASF1829:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2239:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1526:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF2114:
+	.string	"rate_denom"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1486:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF2242:
+	.string	"BOXGPSHOME"
+.LASF2150:
+	.string	"pidSumLimitYaw"
+.LASF2188:
+	.string	"OWNER_TIMER"
+.LASF1693:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1527:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2032:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF1871:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2161:
+	.string	"dtermSetpointWeight"
+.LASF1646:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1847:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF1733:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1906:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2055:
+	.string	"char"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2164:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1968:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1828:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1589:
+	.string	"IOCFG_AF_PP 0"
+.LASF2008:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1658:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2272:
+	.string	"endStep"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF2246:
+	.string	"BOXLEDMAX"
+.LASF2258:
+	.string	"BOXBLACKBOX"
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF2227:
+	.string	"rates"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1650:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1570:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1777:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2200:
+	.string	"OWNER_FLASH_CS"
+.LASF2080:
+	.string	"newValue"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF1807:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1715:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1991:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2038:
+	.string	"MARK_ADJUSTMENT_FUNCTION_AS_BUSY(adjustmentIndex) adjustmentStateMask |= (1 << adjustmentIndex)"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1782:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2109:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1671:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF2024:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF2088:
+	.string	"flightLogEvent_gtuneCycleResult_s"
+.LASF2092:
+	.string	"flightLogEvent_gtuneCycleResult_t"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF701:
+	.string	"__need_NULL "
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2376:
+	.string	"canUseRxData"
+.LASF2118:
+	.string	"compression"
+.LASF1985:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2143:
+	.string	"dterm_filter_type"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1519:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2125:
+	.string	"PID_ROLL"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2380:
+	.string	"rangeWidth"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1467:
+	.string	"STR_HELPER(x) #x"
+.LASF2077:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF2083:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF1995:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1524:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2192:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2184:
+	.string	"OWNER_ADC_RSSI"
+.LASF1415:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF397:
+	.string	"true 1"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1769:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2233:
+	.string	"BOXANGLE"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1808:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"BOXFAILSAFE"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1596:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2289:
+	.string	"ADJUSTMENT_PITCH_P"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2035:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1562:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF377:
+	.string	"__linux 1"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1850:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1796:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2168:
+	.string	"crash_recovery_rate"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1766:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2297:
+	.string	"ADJUSTMENT_D_SETPOINT_TRANSITION"
+.LASF1575:
+	.string	"PIDSUM_LIMIT 500"
+.LASF2319:
+	.string	"config"
+.LASF1458:
+	.string	"NOOP do {} while (0)"
+.LASF1679:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1837:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1945:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1891:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2286:
+	.string	"ADJUSTMENT_RATE_PROFILE"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1967:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1501:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1894:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1779:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1785:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1702:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1537:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1431:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1481:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2215:
+	.string	"OWNER_TRANSPONDER"
+.LASF1820:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2081:
+	.string	"newFloatValue"
+.LASF1539:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1672:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1684:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1818:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF1861:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2063:
+	.string	"double"
+.LASF1606:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1637:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2320:
+	.string	"timeoutAt"
+.LASF1477:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1691:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2195:
+	.string	"OWNER_I2C_SCL"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1648:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF2322:
+	.string	"blackboxConfig_System"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2217:
+	.string	"OWNER_COMPASS_CS"
+.LASF2372:
+	.string	"adjustmentConfig"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1772:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2271:
+	.string	"startStep"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1487:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2346:
+	.string	"rcInterpolationInterval"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2148:
+	.string	"itermWindupPointPercent"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2120:
+	.string	"mode_profile"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1564:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2269:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2052:
+	.string	"__int32_t"
+.LASF2393:
+	.string	"rxConfig"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2196:
+	.string	"OWNER_I2C_SDA"
+.LASF2037:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2250:
+	.string	"BOXGOV"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF2310:
+	.string	"data"
+.LASF1874:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1504:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1456:
+	.string	"Q12 (1 << 12)"
+.LASF2067:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2228:
+	.string	"dynThrPID"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1919:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2276:
+	.string	"ADJUSTMENT_RC_EXPO"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1678:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1506:
+	.string	"PG_RX_CONFIG 24"
+.LASF1533:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1512:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1425:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1728:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1560:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1799:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF2034:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF1475:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2336:
+	.string	"spektrum_sat_bind"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1865:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1713:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1673:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF1603:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF1970:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2137:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1971:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1848:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2384:
+	.string	"applyStepAdjustment"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1977:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1703:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1903:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2132:
+	.string	"PID_LEVEL"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1788:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1538:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF2247:
+	.string	"BOXLEDLOW"
+.LASF1505:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1705:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1651:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2334:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF2160:
+	.string	"setpointRelaxRatio"
+.LASF1448:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1823:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF1831:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2029:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF2262:
+	.string	"BOXFPVANGLEMIX"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1954:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1659:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2394:
+	.string	"blackboxConfig"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1541:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2396:
+	.string	"generateThrottleCurve"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1573:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1855:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2100:
+	.string	"pgn_t"
+.LASF1552:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2015:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1918:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1306:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1482:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1433:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1470:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2153:
+	.string	"pidAtMinThrottle"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1621:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1488:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1862:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1996:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF1451:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1483:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2313:
+	.string	"auxChannelIndex"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1783:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1757:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1771:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1748:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2174:
+	.string	"OWNER_FREE"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2134:
+	.string	"PID_VEL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1441:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1710:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2350:
+	.string	"rx_min_usec"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1791:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1694:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1568:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2333:
+	.string	"rx_spi_rf_channel_count"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1726:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2064:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF2095:
+	.string	"inflightAdjustment"
+.LASF1959:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1676:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2222:
+	.string	"rcRate8"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1986:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1760:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"adjustmentIndex"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1416:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF1708:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF1654:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1904:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1662:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1980:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2166:
+	.string	"crash_time"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1835:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1958:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2315:
+	.string	"auxSwitchChannelIndex"
+.LASF2382:
+	.string	"beeps"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2385:
+	.string	"configureAdjustment"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1846:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1584:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1587:
+	.string	"IOCFG_OUT_PP 0"
+.LASF2113:
+	.string	"rate_num"
+.LASF1730:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1492:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2198:
+	.string	"OWNER_SDCARD_CS"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1418:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1881:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2377:
+	.string	"adjustmentState"
+.LASF1455:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2327:
+	.string	"rcmap"
+.LASF2356:
+	.string	"adjustmentStateMask"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1617:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1602:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1607:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1940:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1826:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1886:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2267:
+	.string	"BOXDSHOTREVERSE"
+.LASF2355:
+	.string	"pidProfile"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1664:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1998:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1553:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2219:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1576:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2261:
+	.string	"BOX3DDISABLE"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1697:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2046:
+	.string	"long unsigned int"
+.LASF1595:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2214:
+	.string	"OWNER_LED_STRIP"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2129:
+	.string	"PID_POS"
+.LASF2133:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2135:
+	.string	"PID_ITEM_COUNT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1794:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2302:
+	.string	"ADJUSTMENT_MODE_SELECT"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1870:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2050:
+	.string	"short int"
+.LASF2093:
+	.string	"syncBeep"
+.LASF2383:
+	.string	"applySelectAdjustment"
+.LASF1523:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2162:
+	.string	"yawRateAccelLimit"
+.LASF2068:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1534:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2365:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1545:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2145:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1428:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2128:
+	.string	"PID_ALT"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2201:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1543:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1479:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1447:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2202:
+	.string	"OWNER_MPU_CS"
+.LASF2275:
+	.string	"ADJUSTMENT_RC_RATE"
+.LASF2349:
+	.string	"airModeActivateThreshold"
+.LASF2045:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1973:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2112:
+	.string	"blackboxConfig_s"
+.LASF2121:
+	.string	"blackboxConfig_t"
+.LASF1966:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1597:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF1571:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1686:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2244:
+	.string	"BOXPASSTHRU"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1551:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1841:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2180:
+	.string	"OWNER_ADC"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2206:
+	.string	"OWNER_MPU_EXTI"
+.LASF1816:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2158:
+	.string	"itermThrottleThreshold"
+.LASF2241:
+	.string	"BOXCAMTRIG"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF2119:
+	.string	"profile"
+.LASF1889:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1495:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2040:
+	.string	"IS_ADJUSTMENT_FUNCTION_BUSY(adjustmentIndex) (adjustmentStateMask & (1 << adjustmentIndex))"
+.LASF2117:
+	.string	"record_acc"
+.LASF1459:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1640:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2183:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1787:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1542:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1577:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1803:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2203:
+	.string	"OWNER_OSD_CS"
+.LASF2391:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1930:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"pid8_s"
+.LASF2141:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1810:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF2074:
+	.string	"flags"
+.LASF1700:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2065:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1797:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1984:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2482:
+	.string	"io_def_generated.h"
+.LASF2473:
+	.string	"feature.h"
+.LASF2427:
+	.string	"io_types.h"
+.LASF2466:
+	.string	"mathcalls-helper-functions.h"
+.LASF2458:
+	.string	"math.h"
+.LASF2449:
+	.string	"long-double.h"
+.LASF2456:
+	.string	"__locale_t.h"
+.LASF2468:
+	.string	"platform.h"
+.LASF2406:
+	.string	"src/main/rx"
+.LASF2402:
+	.string	"src/main/drivers"
+.LASF2460:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2443:
+	.string	"libc-header-start.h"
+.LASF2448:
+	.string	"cdefs.h"
+.LASF2413:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2457:
+	.string	"strings.h"
+.LASF2417:
+	.string	"stdint-intn.h"
+.LASF2426:
+	.string	"target.h"
+.LASF2424:
+	.string	"axis.h"
+.LASF2412:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2415:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2450:
+	.string	"stubs.h"
+.LASF2454:
+	.string	"wchar.h"
+.LASF2398:
+	.string	"src/main/blackbox"
+.LASF2407:
+	.string	"src/main/target/SITL"
+.LASF2435:
+	.string	"beeper.h"
+.LASF2405:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2425:
+	.string	"pid.h"
+.LASF2411:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2423:
+	.string	"blackbox.h"
+.LASF2436:
+	.string	"config.h"
+.LASF2439:
+	.string	"fc_rc.h"
+.LASF2445:
+	.string	"features-time64.h"
+.LASF2486:
+	.string	"vcd.h"
+.LASF2485:
+	.string	"sound_beeper.h"
+.LASF2416:
+	.string	"types.h"
+.LASF2459:
+	.string	"math-vector.h"
+.LASF2462:
+	.string	"floatn-common.h"
+.LASF2461:
+	.string	"floatn.h"
+.LASF2447:
+	.string	"timesize.h"
+.LASF2441:
+	.string	"stdbool.h"
+.LASF2414:
+	.string	"/usr/include"
+.LASF2470:
+	.string	"common_fc_post.h"
+.LASF2399:
+	.string	"src/main/build"
+.LASF2453:
+	.string	"time64.h"
+.LASF2484:
+	.string	"rcc_types.h"
+.LASF2444:
+	.string	"features.h"
+.LASF2404:
+	.string	"src/main/flight"
+.LASF2452:
+	.string	"typesizes.h"
+.LASF2400:
+	.string	"src/main/common"
+.LASF2479:
+	.string	"serial.h"
+.LASF2487:
+	.string	"rc_controls.h"
+.LASF2401:
+	.string	"src/main/config"
+.LASF2478:
+	.string	"sdcard.h"
+.LASF2476:
+	.string	"flash.h"
+.LASF2430:
+	.string	"rc_modes.h"
+.LASF2474:
+	.string	"motors.h"
+.LASF2418:
+	.string	"stdint-uintn.h"
+.LASF2408:
+	.string	"src/main/target"
+.LASF2437:
+	.string	"utils.h"
+.LASF2409:
+	.string	"src/main"
+.LASF2477:
+	.string	"rx_pwm.h"
+.LASF2467:
+	.string	"mathcalls.h"
+.LASF2463:
+	.string	"flt-eval-method.h"
+.LASF2428:
+	.string	"resource.h"
+.LASF2446:
+	.string	"wordsize.h"
+.LASF2421:
+	.string	"time.h"
+.LASF2472:
+	.string	"parameter_group_ids.h"
+.LASF0:
+	.string	"./src/main/fc/rc_adjustments.c"
+.LASF2433:
+	.string	"rc_adjustments.c"
+.LASF2432:
+	.string	"rx.h"
+.LASF2465:
+	.string	"fp-fast.h"
+.LASF2481:
+	.string	"io_def.h"
+.LASF2431:
+	.string	"rc_adjustments.h"
+.LASF2480:
+	.string	"io.h"
+.LASF2438:
+	.string	"maths.h"
+.LASF2464:
+	.string	"fp-logb.h"
+.LASF2434:
+	.string	"string.h"
+.LASF2469:
+	.string	"common_fc_pre.h"
+.LASF2410:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2455:
+	.string	"locale_t.h"
+.LASF2442:
+	.string	"stdint.h"
+.LASF2471:
+	.string	"build_config.h"
+.LASF2419:
+	.string	"stddef.h"
+.LASF2451:
+	.string	"stubs-64.h"
+.LASF2420:
+	.string	"blackbox_fielddefs.h"
+.LASF2429:
+	.string	"controlrate_profile.h"
+.LASF2483:
+	.string	"bus_i2c.h"
+.LASF2403:
+	.string	"src/main/fc"
+.LASF2475:
+	.string	"adc.h"
+.LASF2422:
+	.string	"parameter_group.h"
+.LASF2440:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\034\001M\006"
+	.string	"T\b\020\002"
+	.string	"\020"
+	.string	"\336\257\204\246\t\b\002"
+	.string	"\002\001\002\002\002\001\002\003\002\001\001\203\323\245\330\013\202\001\002"
+	.string	"\002\004\005\006\002\006\002"
+	.string	"\002\007\003\240\342\234\212\n\004\265\201\225\355\n\n\005\226\204\231\223\n*\002\b\002\t\t\002\n\002\013\002\f\002\r\002\016\002\t"
+	.string	"\006\007\352\263\360\321\b\n\307\206\334\021"
+	.string	"\013\265\310\273\263\b\024\002\017\b"
+	.string	"\f\r\353\366\243\226\t\016\226\266\306,\002\017\276\325\276\331\007\020\021\022\240\342\234\212\n"
+	.string	"\034"
+	.string	")\"~\316\250hI\340v"
+	.ascii	"c\240\023\363\346?\264\003\036K-\374,X<\341\206\222\301N<\030"
+	.ascii	"\221\033\3602\260\272\273\264\026\0024\372\037\326\304\323p\360"
+	.ascii	"g&\260sM/\362\3562\311YV\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375 \242]\002"
+	.string	"\024\003\226"
+	.string	"\007"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\001\004"
+	.string	"\005\001"
+	.string	"\020"
+	.string	"\007\001\001\001\003\001\200\004"
+	.string	""
+	.string	"\b\n"
+	.string	"\001"
+	.string	"\001\013"
+	.string	"\001"
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.string	"w "
+	.string	"BY\002\363\271\003\262u\004N\346\312\005\261"
+	.ascii	"G`\200\005"
+	.text
+	.section	.gnu.lto_.inline.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`.\005\265\024"
+	.string	"\266\033^B \221\222\016[mB\0235\366C\200\357\352\323="
+	.string	"\bR\013\037y\226\"\275\n\331\033B\314&\207\024-AL7\177\020\013u\006pF@\b\003"
+	.string	"\322\034cnj\210\225\264kk\244\355\357\222/w\222)J"
+	.string	"J"
+	.string	"J"
+	.string	"\317\333\371\362\302\005\213\254~!m\002!\003\004\004\250B\020"
+	.ascii	"\350\343\351\200<\316\364\241\356\231\r\246\352\026\322V\220"
+	.ascii	"\241W\270\001\247\204\233\270\261\261\343)\316\264M\271\373\326"
+	.ascii	"m\313\355\356N\267\r\237Ng\204k\273\013B\231\343\tA\326\313\f"
+	.ascii	"\260\025m\017\363\303\234Z\266Y\332]\222S\201\301CG\245#j\230"
+	.ascii	"\3015\214\353(Z\213\376\333\260\304\304\200\374\377\201;\361"
+	.ascii	"a%\273U\337\333]\022W\263A\206Ke\265\211\003\333\272j\230l\f"
+	.ascii	"\273[\262\017\330\256\036\n4!~\321\217\3440-0(nHa/\013XEl B$"
+	.ascii	"\260z\244y\036\365\3022\030E\037i\366\237\337\363\0374\204>\214"
+	.ascii	"\216\321\217\244\273h)8\200\334n\360"
+	.string	"\332\035y\r\216\225\025\317\335\266-\327\351\247E\256\215#\364\n.\371-\007:y\te\246\303\202\023\327\002e\306\203\210=\366Gm\257\211\233\261\273\034wlg\347\307\363\221'\374F\345\245Dj\024^\312@\303\3062\376\260*e\212\344\262\224\033,j\215V\b\217\021\323C\305\255\326\222\223\250\321\262u\254\347\240\221\t\200\236\2501Y\245hD\222\024\244PX\016\300\002\241\242\261\016\020H4R(I\2061\370\305\246dY\241$\324\303\277P\347\254\336\240\004\027\203\234\333\233\036o\260\216\322:t\324\243/\212\bpU\030\033\264{\374\227H\f$.\2212\273\031\354\276\302\352\253\005\270\362\302\240\265j \360\037\242\261\362J4\\\305h\370\220\2164\363D\252i$\2018\205\357\232}\240\347?\355\226\271BT\267h\220\324\261gO\222n\016\376p\273R`S`\025\331+\334\034\230\224o\r\244\361\266\324\020\030"
+	.ascii	"\271\246U\254:\371-u\222\340\004\204\375$`\344\324\255\205;\256"
+	.ascii	"\365\025\264E\341\023\320\252\316\361@\230\370\233\034\005\374"
+	.ascii	"\217\334\036\200\017V0\217\\\bA\272q\237\202\025\314#\027B\220"
+	.ascii	"n\034\250\bV\303\301\363`a\272(^/\n@P\250\355 i\370p:\230 R\355"
+	.ascii	"\214\207()W\363\"-(\020pNq\027\336\217f\220 , $\003$\301 AX\300"
+	.ascii	"!\251,\300\335\254\211$\225\275<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`c\003e\n"
+	.string	"\202\017/-pi\222\016i\325\257\243\002>\374S|`@\001"
+	.string	""
+	.ascii	"\021\204\201\377\3632\310\277W\325:\330\202\331\377\337m\366"
+	.ascii	"\277\337\376\321\223\277\211L2l\364\324KH\bIA1'V\311\031~\301"
+	.ascii	"\240\231\252E>\310=#$\364;[\344\225KlV\006\371\307s$\342Y\243"
+	.ascii	"\211\210z\221\365\315\372\315\352\252[\374l\225\202\240\206)"
+	.ascii	"\221\374a0&\223(\242P$\251R\261X\034\016\207\037\217\037\206"
+	.ascii	"@\252\240.\227/\306`X1!\226\300\235\237mb&s\301\252UzQ\317z\003"
+	.ascii	"\277\372\346\254\347\254\316\203\332\304\257\001R9\301\032\340"
+	.ascii	"\322Kr\233\240m\232\320\235U\223z\224\336\344\313\006\255\023"
+	.ascii	"Y\250\241\254V\263\240\240\244P\33090#!\332\034\021\240XF\224"
+	.ascii	"\031\231\211.\263\244\314\001\2111\020\r\231\213\360wF\356\254"
+	.ascii	"\234\363\3259\341\214V\240\212H\001\013<<2\f\021/\366j\362\255"
+	.ascii	"9o\fn;r\217\313\300@\022\b\272\361\310\274A\324m\f\200(I\004"
+	.ascii	"e\245#\361v\211\237C\370C\034\207E\305H=8*D\016\352\357f\363"
+	.ascii	"\311\260\247\261\343c\003\336\241\002{\344\336Y\373s\204\364"
+	.ascii	"A\351~|}E^\252]\324\330\315"
+	.text
+	.section	.gnu.lto_.pureconst.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\232\004\004\232\004\005\232\004\n\230\004\013\232"
+	.ascii	"\004\016\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375 \260-\003"
+	.string	"BD\017\033\2405\351\377\377\350\252k\367\343\305W\r-yQ\327\234kD\033D\032!D\312\024/\215\243\250\237C\"\024\201{\356\370\f\025Qz\244s\225\257\316\243\2155\326\347F\023\201\370\037\374\200\017"
+	.ascii	"k b5\360\300\220\371*\224P\303U5\f\205\235\347jHQ\030\024\257"
+	.ascii	"\313^\224\305\201\250\025\002\006P\004"
+	.text
+	.section	.gnu.lto_.lto.dddcc00ec3602b94,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.63.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375 \213\r\004"
+	.string	"4\007R"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\266\317\ryw\250\367\005yu"
+	.string	"\005\001\006'\001\332%0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.ascii	"[\005\2412\3223\211\033@\021"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.67.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`,\003\205\n"
+	.string	"\344\016\037\004"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\377\001\005\001?\202\210\200\b\177}\273\001\030\030{y\276\001w\275\001u\274\025\001\027\b\177s\275\027\303\001w\302\001u\301\026\026\307\306\025\025\313\312\024\024\317\316\023\023\323\322\022\022\327\326\021\021\333\332\020\020\337\336\017\017\343\342\016\016\347\346\r\r\353\352\f\003\356\f\360\357\013\013\364\363\n\n\370\367\t\t\374\373\b\377\376\007\007\203\002\202\002\006\006\207\002\206\005\005\213\212\004\004\217\216\003\356\001\222\002\002\226\225\275\230\002\300\003q3\231\0024\227\002\224\002\223\002\221\002\220\002\215\002\214\002\211\002\210\002\205\002\204\002\201\002\200\0025\375\001\372\001\371\001\366\001\365\001\362\001\361\001\355\001\354\001\351\001\350\001\345\001\344\001\341\001\340\001\335\001\334\001\331\001\330\001\325\001\324\001\321\001\320\001\315\001\314\001\311\001\310\001\305\001\304\001\300\001\277\001"
+	.ascii	"c\250A\330\224B\226\355\220\2234\305\006\020\020\b\211`\224\302"
+	.ascii	"\001\022U\310A\271\\'>\320g|m\226\267\236\305\314wx\241\250&"
+	.ascii	"G\302$>\3226\344\006\322\267e>\336%\231\267\353%\362\357&\364"
+	.ascii	"B.jC\023\267\240\033Z\221\033\2215\243\303\330\346\204\264\326"
+	.ascii	"\251\347\037\350W\202\266T+\252\250"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.70.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\340=\365\225"
+	.string	"J\344\2002G \216r\032\003\007M\300w\343\245V\325Z\215C\267\207\372H-N\311\314l\261\345;\342\300O\324\222\213\002\033"
+	.ascii	"AbQ\316\266\306\332\255-g\2169s\204\231E&\362\363\026z\301\305"
+	.ascii	"\25483K\303%\331R\246\224R\036\003\262\0027\003\357:\373;w\313"
+	.ascii	"\371\354%\026\020\346}\223l\236y\021\333>)\223c\234\314c5\272"
+	.ascii	"\211\211tI\267\266t\214n\220\216\376\370X\221\215\213\016\306"
+	.ascii	"\031[\2720\226\211\207\216\370Xb\n\005}\320\t[:\253[ \240{y\254"
+	.string	"\312.|\336\347~-\035\245\036\027\317{,MK-w\236\305\361Z\272L\313\272\252c\371)\226\027\346\234\352.\264\325j\034\234_\371\351\026\267\267*n\305\335\332\252\235\033\225)\336\366\323.kQ\\\315\245\264U=(N\374\311O\275\234\221y\231\233\265U@1&\336\344\247\207`]\356\345_m\325\220K\313\267~\332\230u\345X>m\253\214\322*O\362S\253\345\nF\234\312\217\264UIK\237r)/\362SJ7\207\362\327\235\374\251\255\306\340\246y\2463\177Z\306\322L\231\266\354\313\266ZiI9\3311\374T\323m\214\265\305\364\265\255f\272EB6\f\237U\265td\354\306\016\323V7-\027\023[\361\263\354\334\016\t\273\260\r[,un|{,\305\263;\203\273\376\265 \223\227\376\362Y\\l\002\353Nx\r\217h\274\003\353N\210\241uw\005\220\252DU\321\255P\337\221\323\033\220\251\251J"
+	.ascii	"x\271\273b\371\276\324?&f\233\366c\266a\"}\307\275\245\365\272"
+	.ascii	"\257\305\262\305\206oo\222o\357g\221I\036\2270y\\|\350\332\313"
+	.ascii	"m\022\212\242\276V2\340\002\257X\212\030<zo-D\032\217\377X\352"
+	.ascii	"k\2653\246Iue\331-\243\320Y\2100\333t;\324vl#\364"
+	.string	"t\304\\\307\177\256\223\324\255;\233\273\276\357\253\242[^\342\240\312\243\177\241\351\232\272\312\177l\316\0335\366e\357}_\026,\304\355V\210\r\202<zg\016\300ESS\243\235\363B-:\341\341v\033dx\324\316\334W:\256\251\345Ph\235\367%\263\356\275/\225\005\027\271\3352\265{\234\335\272\315\343\354\226\233\230\255ME{i\316\340\246\260X\276\357k\364g\335\324,V\250H\201\342\204\211\022DC$F\210\020\n\n\001\002\350\303\217\207\016\034|z6\360\354\350\344\340\334h\310`S\363ti\234-\373\336\304\335v\375\244\262rj\026+\004\t]E\212\302^\024t\024':2\320M\224h\312<'\032*l\315-Nb\304\024\236\213\020\222\336y\320\\\b\271\006!\307\025\347@\037\304\340\374\247\005\017o\335\341\r\212\233s\360\241\242\346=Q6\2445OZ\034\024\337\321\251s\34298za~\303\246"
+	.ascii	"#\234\266\242\024\214\355)t\r_\235\341+\320\313mj\022\227\370"
+	.ascii	"\323\205l\021S\244[N#B\354\252\260\235l\212+_e+J\013\331\236"
+	.ascii	"$jT>Y\304\333\301/zs-D\001\343\242%\313\025)O\320\272\270\246"
+	.ascii	"j\254\244\234/e\332\325b\322B\036v\332\317\376\200\021No\254"
+	.ascii	"\240X\242\304\261\310\266k?b\025\345Ns\364\276/;\225\325UsQ3"
+	.ascii	"\277$3\2231\313\300\021\016C\267]?\327.\231\\^[\355\231\236\275"
+	.ascii	"H\345\2775\373\255\3662\320\274\024\211AL\327\340YY\273\263\354"
+	.ascii	"\316L\313&\333\214K\252h\217d\337ah\241'\307\344\020\376\237"
+	.ascii	"}g,\002\006\345\233\354\377\377\224S\232\314>\336-\352\276\357"
+	.ascii	"\373\202\337J\n^?\3344\024\234\335\372\277p\"\367\344\233\234"
+	.ascii	"A/K\361-\3238W\210N\236\311?\227M\002\333/c\377\025M\244\321"
+	.ascii	"\275\371\317\351\301\037\3716~*\034\216l\255\361\263\371\034"
+	.ascii	"9\022\205_\255Gs\355\t?\024\266\262\222\033\316\370\321\330\312"
+	.ascii	"\032\362|\031[Y\275\0351\266\262\214:\035u2a+\013\270\225\323"
+	.ascii	"Q'\030[\331\272@\234\216:\273\370\275\330\372\231[7\\l}\312-"
+	.ascii	"\r\035u*\341\327\262\271\304\342\237\326DJ\371\255\236\207H\370"
+	.ascii	"\253\334,T\374Gh\240L\361\253\3404\262B\024\277T\273\371N\374"
+	.ascii	"O\354\243&\373\346\017b\262\237\361\274\265\227\211%\373%[\335"
+	.ascii	"\356\250\263[v\252w*\313\232W2\263\265\315\013|_\247\006s\252"
+	.ascii	"\027E\267%<\373\272\271&\343Ho43\270\007\317<B\t\336T,\024\365"
+	.ascii	"N,\373e\336|\224\211^\377d*:\204\307a\030\345f\330\3632\025_"
+	.ascii	"\307d\246B\371\2271\367onn\226\341'cVK{\202vfVF6&\326$\354\253"
+	.ascii	"k\311\226\226\222\254)\326\225\2254I\025\022*\327\271\245\\\347"
+	.ascii	"\206r\235\333\311uN\301u\216\272\316D\336\231\351\235\225\\\347"
+	.ascii	"!-\327}\302;'\2753\222\353\034\244\251\335%\2743\220w\026\241"
+	.ascii	"\253\335!\274\263\007\256s\007"
+	.string	"\357\314\301;o\360\316\032\270\316<\236\316\031\270\316\320w\306\340\235/xg\013\\\347\035O\347\n\\g\n\336y\202w\226\300u\216\300u\206\340\235\037xg\035\357\354\200\353\334\300\323\231\001\327y\201wV\340\235s\274s\002\2563\002O\347\003\\g\034\357|\343\235m\274\363\221\353l\300\323\271\206\353L\343\235g\274s\001\357,\303u\216\361t\206\341:\023\360\316/\336\331\305;\017\340:\013\360t\016\300u\006\340\235[\274\263\321;\027\271\316,\236\316+\\g\025\357\234\342\235Q\274\363\t\327\331\304\323\271\204\353L\364\316C\357L\342\235G\270\316\"\236\316B\256s\320;\207xg\020\357\f\344:\177x:\377\270\316\036\336\271\303;sp\235}\\\347\236w\336\360\316<\256\363\216\353\254\363\3169\357\214\343:\337\270\316\032\3369\303;\333\270\3165\256\363\363\235\335w\246q\235\235\256s\373\316\354;\007<a\233"
+	.ascii	"\374\224(\021\333\232\331\003\017\300\263\222\231\017xu-\321"
+	.ascii	"\302\340\0370z\f\300\276\274\272\226\024\275\021\213/R\213\222"
+	.ascii	"f\306\342\311\nL\263\237\260\253\023\264\254\253\207\033\317"
+	.ascii	"\2225;\224\016TP\030\312\236\231QAy\342Nr\320\016\025\337\037"
+	.ascii	"\213\022\2115\231r\343U<KYx\243\214l,kO\201\277\201\342\0258"
+	.ascii	"3+#\033;\361(L\374\t\026\330\260h\r\260\257)&\276\306cW\211A"
+	.ascii	"#;\262\3268\314x6\253\331\251\370HQa(\273\245%E\245m\312\016"
+	.ascii	"\233\037\321O\243DXMo@W3\236\350YI\276\031jQ\322\260\256/~\006"
+	.ascii	"\211\177\261&\305\325\242\244\215x\022\"~\2044Z\003m\005\233"
+	.ascii	"\204\255j\222\023\3615\234\260+\b\365\315\215\365|\355P\201k"
+	.ascii	"\201\021\353\335\320\342\331\"\315\036\307\003\025\307P\326\b"
+	.ascii	"\253\002T\334\0258\234\026\330\202^*J\304F5\275\001\261P=\216"
+	.ascii	"->\350Y\312\260\026V\252\260\200\230\342[\260N\r\342S\274\271"
+	.ascii	"\335Y\251\302\002\320\203\370\360@MV\3307Z\303q\263\351\315\005"
+	.ascii	"Z\023\334k6\305e2\3204W\344\210\344\354\366\303\327x\224{3\217"
+	.ascii	"\211\304\235\3066p\340pv\373\363E\217[}__d\207\025ug\350?\206"
+	.ascii	"f\257\323i\247:\206~\231\312v\252\303Rm\351\372\262<\374$\231"
+	.ascii	"\241\367\360\355_\037\326\020uN\216\315\352\r\361C\327\356\360"
+	.ascii	"!^pa\223:'\307\341;\370<\207\257\362b\254>}V\017\265y\275\274"
+	.ascii	":yf\016\220\177"
+	.ascii	"\307f\327\273I\244:\342\244\240\307\320\207\0012\005\275<.7["
+	.ascii	"0{>L#\220\357\371\266\360\022H\226;\273M\021\036\310\206\027"
+	.ascii	"A\013^\226;;\236\337\260\363<+\036\314\342N\231%\335\236\271"
+	.ascii	"\242p\321\312\315V\227\360C\350\036q\b\025_\300?\027L\346\336"
+	.ascii	"\345\365\31115 \375\0276{`\206h C\037\3610\032\350\305\0015\374"
+	.ascii	"\r\352<ath\020\351u\276e\374\202\324\307\267\227\271\206\366"
+	.ascii	"H9\337h]\374\372\370\366p>\347\346q\230\305\177\211\322p|\337"
+	.ascii	"\027\0063\002\037\230\243\333\027h7O\343\261\317\313\277\231"
+	.ascii	"R\233\244\377\276fO\254!\222\310\320\377\353B$\021\321\017\337"
+	.ascii	"\020G\356\20337\240\003\352\2358\203^\234\206\337Kz\r\317J\302"
+	.string	"%\r\n~\301\244>\371\244\f\337O\n\t}P\360\213\315g\250y\033\b>\257\346-\023s\355\251\364\177\327\354\220\356\227\275\013=\004\222\241\257\005o\b\344\243;z\230\266\347\333)\375\223M\t\314\242\3425\355\225\260\264\373\235\326\310\310`\300,*\322\274\353|\032\t\276\352\f3S\301%\342\345\225\306\307\231\376\2574\373\344\216\013\332wr\3110\271:\231\2073\310\177@\0079\311\320\247\362p\3377\352\005\277\334\317m\300\334A\017o\252\036\316n\203<\320\243\334\323d\357\330$\3239\244H/'_\307\034\323BO\255\344\364k\013=\351q\265\017\007\002\255\251\3100}\373,\343\224\246\226\"\323w\235$\007@D\030\001\bK$)\3103\220\"% K=\220\214\204$!!%\371\370YB\352\361?\230\202\364\260\200\310\017!n\217\245 ?@h\205$\215\260\344C\bS\002;\f\002\f\020~\270\210\021"
+	.ascii	"\214\242\037\021F\bAH\022\216\037K=&\b\2224dIH\222\017\035\366"
+	.ascii	"Q\244\264$\344\007\322\222\022\023\t \364\350\300\307\020#\037"
+	.ascii	"!\030\t\031\241\007\222\221\217!JFEA\234d\302\217!FKIIC\214l"
+	.ascii	"\250O\315\276Of\001\037\342\323C\361+\231S|\307\\\033g\3131L"
+	.ascii	"\343L94l\0349.[\032\307L\225\256w\246S\330z\247\217IX\357hV!"
+	.ascii	"i\236\026\\\312\243\232\247\313\031\314\3461\234$\323<\226\220"
+	.ascii	"\217\355s\225\210\330>^\210O\216\331\200mk\227\327'\312\346#"
+	.ascii	"\366U\362mXs\013\256\310\022dh+\326$K\360K \007@+\035<\030^\007"
+	.ascii	"\337baA\t_\236\2266\351\267\222\r\276\333\257\373\232/o\203o"
+	.ascii	"-\032\374\006<^\203(\255\027\036\217%\031\264Mi{Ul};m\356\305"
+	.ascii	"\024\323E\206\266ZJ\246\213\212\211>\210_\320\307\202~\313\245"
+	.ascii	"k\253\220"
+	.string	"p\220\215\252\365\275e\325\027|k\035\032\266f!\341\005\337\203\026\374\005;\336\002)\2554\352\0026\315\355\370g[U\001 \227\024\2665\024]\337\252\320\334\221'\260\"\031\332\036i\251\260\"a\200\354y\004\304\242\340\247(x6\023\320\252\253\033\233\021L\330u\311wW+\325\023|/i\307\016\343i\335\3108\3017\030\t~\202\b^\002\2666*\202\3154D\023a\317j67e\211+J\206\266N\355{E\031\303\244\r\231K\b>3:t\246\351\r\b\023\202g\031\313\204\265\230\266\266d\030\223\257\3570\035\337_=\246\257-\246\255:\276%\035x\035\r\274\003\227\226e \033\240d\2002+LJ$\366\254\230\346\326\034\262jM\206\262d\306X\265fg\236\251i%gc\036.\360\326\350\220d\323\033P\344\002\205bm\331e*\367\232|\213\345\370n\322f\372\262-\273L\216\357\312\004>\007\002\237"
+	.string	"\344\243c\n\225\b4\0360x\365E%A\366,b\263O\215\220N1\224]T\224N\025q\251g\324\037\216?\214\016\031\026>\341x\226\321\217\314\351\355\315\257w\354\233\314\306\367\030\324\223\323k\343{\363\350m\030\360G\203Q\032_\205\025\374\362d\300\323\360R\303\217\357\223\354\350\272\212h\263g\371\232]*\224D\312P\266\213_\022i\022\257\332\200\004\216\306\357\351\345U\321xV\362M\3615\2432\242BW\331\267Y\001\337e+\034\2412\242\202\214/ \306\313\330\242\005\257*\306\035\f?+N\202\232\360xi)\341\332\013\301\301\263/4;\027\210*.\206\262X\330j\025\327\226k\351(\361\353\"\340]\210\022Q\233\336\200\3468x\002\236\245\364\343\342"
+	.ascii	"\353\312\212\215k\355\3549p\361}\2265\305\272\262\032\340]\b"
+	.ascii	"\360\003\264\261qW\340\226\b\360\026\200\237\326\n\\R\240\007"
+	.ascii	"\236mkv\261\017H\304\030\312Va\001\211X\023g\022\204\225\250"
+	.ascii	"#\361\347\271\240\204\n2\021\021\221$I\n\215\001\343\033 \f\204"
+	.ascii	"\221\260\244\362<\023\200\212\006\343 \221 \2111\b\215\324P\220"
+	.ascii	"2\n\312\037\343\330*\242?\203\232\373\363\346\316\270\243!\235"
+	.ascii	"y\250m\264\017c\t\030\340\253\r-\335\2245\324Rk\333#1#h\377-"
+	.ascii	"n\034^\267)\327\013\230\321\3109s\377\306\350Z\357-\353\013T"
+	.ascii	"\221O\007r68\271\001\234\007\336.\255-0\343\374\324\356b\027"
+	.ascii	"\250\272o\260\235A\205\327\247\252\217\206\001\334\260IyF \361"
+	.ascii	"~\211\252\275\024\360\"\301\347\0337U\304t\234\355\353^\337i"
+	.ascii	"\355`\271H\033\231 \345\275\002@\302\030iNc\001\361\314\245\265"
+	.ascii	">)\335\027v\326D\223/\335I\221\267F\255\365\222,p<\266M\323\344"
+	.ascii	"O\270E\\\311\345x\277\216\315=\224\345Cy 0\023\"\335\342\017"
+	.ascii	"Z\220M\025W\305`S\013\330(+\220\365\3650\261\340\033>\267\220"
+	.ascii	":\351l{\262c3\320\201{}+\320\024\252\337k\351\002Dr\237bk\032"
+	.ascii	"SQ2\270\034\327;6hG\204\365M\320.j\324\\6\273\374\353\257/\246"
+	.ascii	"\214z\005*\304\322S\273z\320'\024R\305\303T\004\201\304>\212"
+	.ascii	"?\210\030\253\263\316\232\004\t)$x3\204z\310i\rkhB`\213\200\004"
+	.ascii	"\312QA\300\024*\320\023aq6\035\310\204\b\352G'\205\035x\263\374"
+	.ascii	"}/>nL\f\222R\004\257\253e\023\302\016)j\321\240\\\"J\177\372"
+	.ascii	"\"\307\233\2530\272m\345\212.ld\ti\371f\026\300\217\227Dc\273"
+	.ascii	"!\264\326W\211\022\237/q\025)\341\366\021\177\225'\316\270\216"
+	.ascii	"\263\"O\n\001\217\b"
+	.string	"k\274\352\363L/\030B\242\026Q\202Z4\354\3724\216\027\242\360+\216\"\210\263jd\301\307GN\t\004\327]\263\373\022\211\216\336\320g\215;\244\252\224vrW\265\214y\033\357\b\023\202\245\rs\340K\301\211\353Qj\344\222\365\nML\313\007\343\361\301\305\210\013\020n?2Q\220\b\272\247\371B\026C\365}\343\201$Y\266\210w[xzn\257\245\351\002\273[\356.Yn\376\277\2317\177g\006\210K(_\342\247\234j\210\220\034\311\206D]\322\364X\253\276\016n\314=\307\353>\301\261\240.\221\205\353\036\335Z}\323\005w\355\001g\007\004\261 \205\273\350\352O\375\030*A:U\261\312\235\346IZ X|\006%%\212\330Yn0\255\237\007\004\275(\r$\3512\354\232\213,\335{\362R>\314\336\256\230\037\246\313\303\331\021\276\205\312\030\207p&\265\264\016o\242RHq\0051P\362\b\0136Q\265"
+	.ascii	"\245I}[5\360\344\322>}b\340fw|\017\310`\037\f\357\032#T[\230"
+	.ascii	"\244\374\016\001\354\324j\316}\261\234\350\261\351\272\302\t"
+	.ascii	"w]"
+	.string	"\016\274\333<0\3337(\353\r\242}\215\327\261\206\214^\013-4\260\023\315\202Im\027&\030\223\242#\365s\305\337\222\325V>\362\200\363:\262\266\031f\007@v\320\022m\332\325=\310\200\351\3255\037\t\201\245\036\226\325o\333\317\214\220|\\\002\275\205q\274}S\023\263\217)I\243\317t^\2443\261*b-\376\243~\312\220\257Nc\006L\356\225\367\357\240\357\n\020\267,Pm\333\247\210\257\323R\277\003"
+	.ascii	"(\344QF\304\316\356H\344\314o\017k\230\302\347\001\374\223q\316"
+	.ascii	"\032\2538\035Bt\345\215\231\bQ\270\323\256\243a`\264\335\244"
+	.ascii	"\2436T\362<u\316\313c\232\021I3\177\tk]\202\025]\231h\277\213"
+	.ascii	"\377\205Ki%\251\213\262\352\312}:\021Q\343))\324&)z\035H\260"
+	.ascii	"d\311\326\036r\303\241\021\326\341\n*b^\0059\031\302\036\214"
+	.ascii	"AP\272\333\272W\320+{8aI\351\037\001\206\013\334v\030\222\022"
+	.ascii	"\355\356`\2367\231X~/\211b\266\036\216\033\b\204\020\362\260"
+	.ascii	"\275\214\367ZB\300\035h\374V\033X\2211[v\274\222\252g\026\363"
+	.ascii	"\001\253\240\360R.\252\177\034\016\bvb\373\274\"\374w\266\323"
+	.ascii	"`Z\316\fju \355\234d?:\327\265*t\322fHc'c\351+W<D\235\177f\274"
+	.ascii	"\333\275'sPl\321:y-\252\223\316z\037d\267J\300\277(\216J\266"
+	.ascii	"D\277\261\264\037\327\363=ZV\3610\230\020\246\"|"
+	.string	"\224`\316=\313\364\370}\022U\362fb\311\241\377\\\001rD\223\325\301\200\323\023\305\336\221\367\315\351\276\026/\202\335\3404\264\320\021\330\225\325E\276\020=G\213\374\020\364\230m4F\201\031M\376\2770=\207\211\330\376\322c>\340\253\261\222\315S\357\225\376b\350\"\027\031\344J\252\373`\302\233\314\004c\230\256\250\035\364\241s\222\027\377r\363ow\376o\321\035\200\361\2533\377*\335\312\335\316v'=M\265$\261\274\214w\207\236\\\251w\206T.\251\361\016\217\336\277g\236(,U\363\276\037\335\277g<)\\J\363}\037\335\257\357\034)-Y\343\016\217\326\337\367\034\224.Y\323N<\335\316\272\312\315\022\226\245an\037\274P\317yRX\nM\373\371\340*\277\317\343L\307\324\003ik\254\333\260\256Sw\302@\347\306\032\235z\260\242G\263\240\226\0062\376\254\333\241\337\270\344\r\270C\250`\302\371\352\317y"
+	.string	"5\220\321(&\0076h3\227\017\275\330{\301\226\217O\325\004\212e\345\277\220\326\tR\004\2604\361G::E@\322CYps-\3659\205\304\254a*\003Q$+-\263\022\354f2\252E \230yqp_\207\275D4Mv\333c\376\345\003\001"
+	.ascii	"\177c\002L\363\026\373FY]\0174p\343`\306{\"\270!x\377#\344\277"
+	.ascii	"y\030\254>\346\377'\n\323\277\277\301\024s\t\250\373\234\325"
+	.ascii	"\203\362\n\202y\362l>.\264\247\f9ip\016\206@F\275\260\341\002"
+	.ascii	"\310\364qM\361y\273\b"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.71.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\352\bU/"
+	.string	"\032P\244\021H`ZR:?\"d_]\304\331"
+	.string	"s\231'\242~\353\224\\`q\302\204\276\245)D\264\331g\247\335\366\355\3716_o\345\242=4\204m\303\346\0074}_\020+Kx\363w\320\371BHU\351f\326J>!d\357$\003\004\001\372"
+	.ascii	"\004\001\315\241\257\335\"\352\315'\"\22533%pik\336\021\257\030"
+	.ascii	"\251\367h\375(?\213\361\346\223\352\314L\006\320\264\346\335"
+	.ascii	"W\342\177\330\257\352{\330\257}\263\030\335\300\257\367e\r\034"
+	.ascii	"21\352vB\265y\254'%LL\232\263s\301\327>\016\213\220A=@\236\032"
+	.ascii	"S\243D\373u\b"
+	.string	"\304\350\336\356\006\016\242\336\204j\2343W\227\266\234\235CM\324~\355\250n\272;\207\344^\030\230\325\331]\316\271\210\205<\3529A\340\317\327\366\330U\3057\252_v\337\222)\365\234\255\007\267\312z\\\340\325\372\317@\227\r\036\367\035\356\212\307s\307m\325\0371A\320(\340\362\202\343k7\200\344J\307\355\275\313\206\326\331\034_U\005\322'\033\035f\225\372S\303\310\362j2\256\252\022\273D\255\016w\265\245\016\275|\340\275\354w\006\223\352b\253\037s\212\375\001s\013{\327\325\026\276\275\242\234s\337%\323\306[\347\335]\327\335Z\335-\207Vy\312;m\2377\273\306\222dJ\247\342\257\336\301\027\277\313l\216\352\272\351\337\355VB\336//\366\360c\nK\265\316[\335\335\016\004&*u\343\034\314\r\354\ro\351s\021\246\215\345\037o}h\323\2659K\235+\270\366]\346\031G\306\236\245\317u\2279\301W"
+	.string	"\230Hu\363\372\276}9\024{\347'\374P\3367}\337\266\300\345\373\246\3339u\361W\367\361t:\305k\354\325\315\336\026\n\272\267\205>\257\362\356ao\363\234\354\337y\363\007p\347;xo\003\331\333\277{\333wo\267\367v\217\275\315\366n\257\367\266zoc\366\366\035\nh\0233\"L\3165\246prt\275r\344U~\347o\367\237l}+o[\261\342\226\364U+u\325J\t\003\223\016\317\214zm\210\226\246\026FEz\265n`\3078\224\276\224SY\261\276"
+	.ascii	"\247\2449e0F\353\375\2244\247\bYi\001gs\341\300\220\2343\004"
+	.ascii	"\f\267\313\320\346\234\037\254Ij(pF\f\006\373\265\367\225\305"
+	.ascii	"Crd\322\253\201\321\027\353\r\035\356\227\035\330\257+. \247"
+	.ascii	"C\007\232\325\203_\345B\334\203o\232\023\225sq\367\242\273\212"
+	.ascii	"\205\270o\325\232\251\264\267\033\233\006M]\0324\003\306d-\370"
+	.ascii	"\234\\\334\234\034\220\331o\264_\017daEU\334\335Q\006\272\030"
+	.ascii	"\335\3738\0177\323n<A\362\254\244\311\366\353\016V\261zf\225"
+	.ascii	"\267\366\323\200b\301e-\277Pf/\b\337y\242\362P\354\016\016\302"
+	.ascii	"7N\025\327\324\2356\320\335\211J\264\177)\031\303\223*\331\237"
+	.ascii	"\213\361\277\274\257\026B\304\212\245\204\314\300\274\255\370"
+	.ascii	"\253o\202\345\301(\256\326$.\306D\2333\325\203~\230GO\364\305"
+	.ascii	"\276\366\221\361~id\277\362`\002rdW\373\207)\225_8r\205W\207"
+	.ascii	"\361\247\004\377\304\036\355D 69\027\343\356\025I\367\313&Ra"
+	.ascii	"\251\336\301\030?H+\222\220\324'\244\013\334HDMH\311#\245\342"
+	.ascii	"\022RI\ti\034\220T:\302G'\027G \236\216Km\323\213\343\021\305"
+	.ascii	"\232\324\204|\321v\n\b)\216\016\"4\200@4`\t\231\2244.9Y\340i"
+	.ascii	"#QSr\351\250\224lrb\221\342\350\204\221\251hTQ\\J:R*\032\231"
+	.ascii	"\232\212D\303F\27682\025\223H$S\021\350T^\315\330\253\205>\243"
+	.ascii	"J<\325},\357\"5\347\234sr.\020wS\bb`\020\352\304\271\005\313"
+	.ascii	"Z\020\177\255J\320\330 \374\265\373\2360a\373\371\340 \236q\345"
+	.ascii	"\301\262\377\240L\3402.\262\302\206\003\272\025\225\361\343"
+	.string	"\"m\336egN\360\262\027E\261\262c\003\342\257\237\212\037\347\375'\002\2545w>\374\005w\241g\223\270y*\364l\273\025!\333\211J\350\026\2347n\212Dth\371\220\371\017\373\370\360\017\007\255\265-\366aa\231\252&=,\304-V\313T\215\261\270\207\205g\320\035\322\247]\264\355\301lw\205\267\201\032:S\027\200\276\250a8\246\024C\250HDD\222$Ic\260\002\021\241\262y\021\200\255dS$IA*\303\376\006\3327\235Y\202Jz\035\025\n\214\244\343K?\206\220u]1>\355\007\247\306_b\2342\272\366\003R(\221\302\260\270\365\3322\344EH\016\320:\365\001$/\232\235>O\236\273\333<\321\337W\342-/\253\333lu\320pu\267&\237\324\214\013\237\272I|\020\033L\033\336PJ\210\322\021\350\366!\0032h\233\360\330\205\013\277\343k\356\024[u\333\354\016A\333\272D\225;`\306"
+	.string	"\3639@H\365\341\355ST\314\340\340"
+	.string	"\242\275R\374\311\030@a-O\344w,~\277\031Gob\353\\\177\277`b\344\240\321>\024a\001\360<\2447\004\036"
+	.string	"\300\353\177\366\245\304'\rK\335\323\3701\213\272\262\206\216\320\256V\033 @\360\"SD\240\341'\261\022\020\276\256\022\026\f\330 3\337\031\342\311w\006jS\035\002\3747"
+	.string	"\270V`\373\003/1\257\274M\007\202\212\0361\321\241\260\245Q\2344\034\306g\244\366\271?\354\226m\221\332p\257\377\370\364\001\b"
+	.ascii	"\351\270),\n\233\251\345\254\"\337c\247\270\241a\334\307\271"
+	.ascii	";\300\205)K\230na\215\375l\203\024\275\247\265\203\b5~t7'@\340"
+	.ascii	"?\376\337#1[\207zkd\313_\020\370\243\346\312\310\243\340b\225"
+	.ascii	"qU\250JG-`uW\003"
+	.text
+	.section	.gnu.lto_processRcAdjustments.72.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\300\021eX"
+	.string	"*\221d O0\322\332\031\003o\247[\264\224\246\001\223-|a}W\212~$(\270\224\260\311&3\373\017\277\r\262\206k \026\365]\f\003"
+	.ascii	"Q`\360\361\303\\\327\325L\327M\237\356\257H\274x\321l\034V\334"
+	.ascii	"\263\0244@U\325MH\310\312-\245L)\245\372\001\307\001\374\001"
+	.ascii	":\326\352\340\330Vq\274\257\013\025\272)uV\344\2228\216[b\030"
+	.ascii	"8vc\245\234l\016D\300\352\326z\013s\3138\332\nw\226~\023\221"
+	.ascii	"$IW\331\373\276\255\0267\250\0267!)l\253X^\2657\035\342En\250"
+	.ascii	"\206\244\2377\026\034}\345F\n}\257v\320\314\254\312\324\fq\222"
+	.ascii	"\304\235\003\367\224\246\322meI\314U\242\372]:\201;\254\364\352"
+	.ascii	"\270\324\330\224E)\234\227\212.\205#*dYS\262\357\221\337\032"
+	.ascii	"]W\235\tl\253\304\"I\334P\270\245\020\215\250\261\233\213/m\257"
+	.ascii	"\215\216\202\203\271m\365\373\206N\343\226\310\243qh4\267\237"
+	.ascii	"\220P\254\202\276W\032x\251kb[-\246\304g\222\001\t\270\r-\241"
+	.ascii	"(\005}w\274\370\002-S\363\276P\024\255\362\006LT!\251\235\271"
+	.ascii	"\313\332\314\355\263\023:\347}\205\220i{_\250\n&b[eh\367\254"
+	.ascii	"\255\262\275\263\266\312.\363\231\206~\275\275f\206\231\246\346"
+	.ascii	"}\337\242\237\201\323N\241\315@\356v\020\320\217O\017\317\216"
+	.ascii	"N\016\316\215\315P\330\006\201\354oU\323w\227;\255I\320Ui^Iu"
+	.ascii	"P*\0243\246\325Q'\223\364\200\254)bZ\n\225\003\311\200E\326?"
+	.ascii	">=\351\0019\324pu\324Y$\025\3461yh1'\021\347yb\025\351\0353$"
+	.ascii	":a4xN\220H\023487Q\347\027\020\267\371%=\261\300z\330\025\327"
+	.ascii	"Cb\316\037.\214:\207\244E1'\227\267[\301\026snu[\017E\235Z\016"
+	.ascii	"\034zbe5\233\nuqq\241\243\316\254\264\304\0161\230i1\247\017"
+	.ascii	"\377\r\233H\326\364D\235\025 l\256\230i\317\216\"\315\366j\351"
+	.ascii	"\352/\214\017\315\023\313H\247)\002f\256\264l\256r\244m\013g"
+	.ascii	"\304t[\273\325U\225\177Ki5,\017\315\023\213\254\375\227\364\276"
+	.ascii	"/{\363\n\253Y\250\231{\215\271\205\3147]\002B\270\026\242H\337"
+	.ascii	"l\335A\220)~\240\355\224\354\373V)\300\215\306\004\b:\215\314"
+	.ascii	"\373\276H\377\003w\345W\264\232\330\251\357\025\355+\353z\377"
+	.ascii	"\3116o{\315Q\304\302\240\351\323\332\017\2056W\345y\314,\243"
+	.ascii	"}x\372\271\361)p\306L\323E\255\255\366\023\347\316\246\274\217"
+	.ascii	"\205oz\3217Lw\225.Z\3512Q\304\257&3\273]=G\343\346n\357hL\223"
+	.ascii	"\221\200{H\253\\\203\002\357&\005\025pT\367\253F\204\257\356"
+	.ascii	"}_#\022\332\272Wx\013\"\372YS\304 yF\201\024\244\245t\252\344"
+	.ascii	"\351ow-\276\241>\316\214A\006\336\315\026\377\223\303;\342oh"
+	.ascii	"\242G\337O\2728\345z\274\343\314\033p\340\335<ze\020\252\227"
+	.ascii	"\342\03639<\273\327\365\230\241T\376^\314\315b\306\262\250\360"
+	.ascii	"\013a\036:OP\243\317\272i\314\220\321:\307\b:;\320k\3150Z\347"
+	.ascii	"\027\315\326\214\324:\273"
+	.string	"\030:3\320\320\346\026\375\244\371\250\341\232W\264Z\263\321\320\271h\350L\324:\253h\235S\264\316(Z\347\023C\347\002Zg\0236\316\004\264\316\003\264\316%Zg\001\206\316\001\3408\223h\235\207Z\347b\353<\242u&\016\235E\004\235\001\030:\207\030:\013\t\235\203\204\316@\255\363O\353\3543t\356i\235y\206\316;\255\263N\353\234s\343\214\323:\337\3308\333\264\316\303\241\263p\350\334\016\235\203\2553p\350\314\n\235\177B\347\265uV\203\316i\353\374Ag\007:7\005\n\360\320\305\025F\367c\240\357\216\2765\257\234z\305H\303u\257u\263u\253uC\273\237\364\312\334D;/\035\345\226\230&\211\277\264\234\333; \331\267\215\335\021Znd|\233\271\235\rg\374\212\267\342b\231\024=\342\213\337L\037T\304\037\361\275\344\023\361\304o!\"\236g\016o\305'M5\200\344K+\307\365\302\270x\340\356"
+	.string	"\360\347\r\340\222\213\032\207\301\203\204i\332M\341\365\321\003\360\253\333\262+M\210\256\t^\350C|\307\005\375\004\\B@\037\364\363@\237\322\375\274\032f\271\206\nM\013\321~$\301\221\341\3632\354z\336\347[K\311\202L\026\231\236g1\027\027\264$\307\330\r\317\031\032\027\024\310x\036\210\315GK\007\233\031\337p?\343}\017\210\277\240d\361\305.\f\316\303\215\241U\004\276v\236\005\330\031\017\334[\211\274\347\230\341{\261\316\023\315\213\333\232\363:\377s\303\371\034\327\313\261\220\356\364+w\00607,lm\025\347\023"
+	.string	";\233\372\233\357%g\301%\302\262\257\340:\\#.\022wllm\325\346\201W`\374\360}\217\311'\224%\032\327\315\002\034\226\350\332\017iT\204\357\225\246\205\256\022o\262\302\037"
+	.string	"\314\n\214\357\265.N\265rm\037\306\373\336\022g\272Ln^\250B\346K\317\321\276\013\263\036sV\\\255\f\\\226\344"
+	.ascii	"\006\007,\301\022\326\026\017\205VF\211\017\300\340Ou\323\216"
+	.ascii	"\201g?\370\335\326@\246\217\3373\360\354L>\356>\177]&\334C\330"
+	.ascii	"u\342\232\271fk\253\354\003}\254\377\373fj\251\277~\312\306\344"
+	.ascii	"3\372\024\255\276\232\266\\\003$\375\275\033?(Q\310\326\350\251"
+	.ascii	"iM\273\377\241o\254G\237\276z\267\354\262\201\373\301\235c\013"
+	.ascii	"\227*\326\265a\215\361Ph_\252<\257\273\255\331;+mxu\016|\214"
+	.ascii	"\377\3351\371\374\217\336\201\017b[\036\241\362>\356-\255~y\276"
+	.ascii	"u\367\200\222\367\002^\232o-]\234\302\322E\030\035\304\215\327"
+	.ascii	"\002\005\210;\177\233\255\216Na;\363\003\363\204\343\341\003"
+	.ascii	"\033\035\325\252\\\221\002M 85\2458\2206\276)i|J>\031\277)\271"
+	.ascii	"\344\224\001\023\bG#T\320)\n)\002kL\332`ZR=hn\"\212\262\341\224"
+	.ascii	"T\026\035\221OOH%!c3%\215\311\013\216H\247\244\322Q\031\201\216"
+	.ascii	"\r\246\343\321\330\244$\034\201i\351H\343\006\007\362\370\306"
+	.ascii	"\2441\306\b\0260Eap4*\ty\351h\211)\201\005\f8\"\022\002\301\351"
+	.ascii	"\203#\362\001\246\244\321\002\033H\250\344\021\251\224\303JD"
+	.ascii	"Q\311#\323S2J\031\302\222\261\003%\250\"\245\017\212\216N\306"
+	.ascii	"\247\"%\250\250\"\242\021\214\024\201\t\252(\211DB\025\265\320"
+	.ascii	"\251~!i\315\306\215\311M=U[\320{\361\212\274\237\032\377e\034"
+	.ascii	"E\033\275\225\321?P\346\355i\364\255\326\351\373\276/P\215o\265"
+	.ascii	".\246h\243\257\361\235\023\345\355\316\307~\212\322\210\276\200"
+	.ascii	"/rA\305\027\360\354hDO\234\363\241\342\323.\3135T\336\267B\034"
+	.ascii	"\220\036\330\262\342|\220\374?\005\323U!G\n \223\257\373P\374"
+	.ascii	"\373\240\332\372Rvi\034A^\374\211G\361\035m\337\242[6)\361/\236"
+	.ascii	"}\2045\300?\361Bwd]\234r%\335\321\016:\223v\361\300_\201p\263"
+	.ascii	"6\361.\236}\371\303X\231\2234eN\204\300\244\360\253\"[2\206l"
+	.ascii	"\211\017\232W\261\255\272\231\016P\274:\023\317\314CqI\255\273"
+	.ascii	"\022+O\302n:1\360\355\020S\021\206\2007\361\351\236+\346bH\b"
+	.ascii	"\030\340\327\275,0n\022$\273\354\035\232\204 \002<\360H\211_"
+	.ascii	"\367\226M\002x\001\276u8\021e\277}\r\351,\001|"
+	.string	"\277\201\235E\273Y\210\353\3017E\332\230\364\274\027w+W\341w\021\027\266x\360\0349\211+\267\205\252\227b\366\031\374\253\003\036n\217\036k\253$\036\030\002\353"
+	.string	"_\361CO\343\231\335-\367\207w\223\213\313\227b\244\037\212\273\342\0354#z#\266d\321\241\363^\334n\001\201\200\250a(\347\030S\210FDD$I\222\264\0061\005\304\030'\035<\333\021@1T\254h$I\322\032"
+	.string	"\022_O\202\3334B\3713B\340y\301;\002\022\237\376\361\251\034\367\017>\331*\2741\201\377\251{\365\277%\\\326\2361Rt\247\357Q\002\230\206\360\336\214\00793\333Y\263a/D\334\263\210?9M\025\246\232\233\327a\230F\270-V\302\367\376.!\200I?\202v{\240d\0029\367\216\216\203w\250\273\245\fZiX\261\f\203/\277az\350z\324:\302\333aC\2340Y-\366\304\204\032 \2137\020\322\021\2571\225\367\001\207"
+	.string	"\031\336vw\312\270\331\367d\355\207\335\r\230G\211\267I\261c\234\214A\321N\211\221\256v\033\323@\245b/4\220z\034n\314\355\263\331\036]l\320\301/\265\212G\177\312vM\216L\234\337\231b\360\027\177\235\377\355\037\270\341\307:{i\223u\320\332l\30636v\350\020#\"[:\311\020)@\362\316W\301\330\270\340\242\261\345K\242\033\213\021w\231\354\204@\005\333\376\276\377\025\272\253\036'\302!\347\244$\214\t$\033\n\227%\211\305he\034G\203\034"
+	.string	"bN\310>\332i\232@\177\366\272g\324f\340\2445\267\307\364\344\204\037\331\026\331i\346\216\221\231\221\"3u\271\3556\327\256\271\2748\211^Dh\0210\234r\220\305{X&UK\n\225\375.\200\331\376^wD\002\016\334,\001f\021\b\b\250\216`F\365\312\377H/\357\035\271\034\201"
+	.ascii	"\017\264O\213\241\026\2215\312G;\005\235qC\264NoI*\241\232\364"
+	.ascii	",O\266oa\212\372Z\377Z\203h\237}\243\221\363\177\323\222\217"
+	.ascii	"\001\237\"g\355\230?I+b^6\232\272i|\267b%\364x\255MJ#\006l\036"
+	.ascii	"\313ZK\200\026\202?\345\372>j#U]y\r\024\304\\\367y\372\013`\310"
+	.ascii	"I0\230\033G\244\376\377gJy\311\217\320\261/**\037s\203\263\033"
+	.ascii	"\221\366@\244\003\223\300\220C9\226\252Moz\356i\226\243\363\227"
+	.ascii	"\t\257 _\024\003Lg\236\2249&\256\023%\305\313\007\0230\215\332"
+	.ascii	"\031\252\374\244RL\221\370\t|i@\262\202e\351u^\026\342\362\361"
+	.ascii	"\364\343M\265l\301\204U\030\214\033:\321\205R\217\266\341\323"
+	.ascii	"\266z\215\033\226\365 x\234\034d-k\240N@\034W\3055\354?d\324"
+	.ascii	"\352\271\"\200w\235b\244\001\017\330L\217\034\226YA-\234\210"
+	.ascii	"\f\334bs\007~\251\320\221\3711A\022\335ZM\312\001M\277\304\377"
+	.ascii	"\005\001\243XAS*\312\245^`\306\034e\237,;Y\027\200\322e\205\250"
+	.ascii	"\245\263\330'\3741C\247\212\b\363\217\327\243_\231k\364\370\342"
+	.ascii	"0I\242\002\360Gv\234\337\370K\357\357\202B\216\240\377\370S\323"
+	.ascii	"wP\001"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.73.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001\260&\b\224(\251ZPZH\271-gDL\221m\034W\007\362'\bG\375;\242t\001\211i\203UU\025\025\3262\306\207\336\022\006\035\"D\312\224\002\246.X\246\311T\031\266y`\300,P\027\244\032\240\306\001SA\352\302\340\205\300\026D\346\202\231e]\320\322\355\243U\217\202\307\307Q\nO\351\357\366\246\203?\364N\023\370\354r\036\375\217\203l\374\215K\216\320\362\361\222\257M\227l\211\211|tA\205rN\017T\262\231bw\\j\206\375h\325c\353@\210\2442\331\275XQ\331O\032\351\260}\2137\373\344\335g/\342Y\204\240\354.T\215o\317\315?\350\001\261\303=\001\022v\327\031;\030\267\336\266\201m\004\333\034\001\b"
+	.ascii	"3\241e\037\350\034\314=\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.74.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`c\t51"
+	.ascii	"\372RX\022DP\236Nc\313s\306\016X&\206@t\222\004\033lnl\357[\030"
+	.ascii	"SlB\256Hm+\024!C{\215\245&A\341\"\224\363iE\035\f`\030\335:\334"
+	.ascii	"\032\300\"g\007\340\321\n&\303J\2366\331{K\231d\013\001\006\001"
+	.ascii	"\022\001c\216\370m*U>\314O\357\253u\303\302\377b|\0361\376\027"
+	.ascii	"\254"
+	.string	"{\311R7\330\273\275Z\244\375=\007\317\365\342Z\360\271\370T\211S\304\030\273\352n\333*\023\277\3679\210\300\307Q\347\267\275\370\026,\247a/\275(\024\351\322\fr\364\0257\265_\215\334\216\370W\360\243R,gs\237\005\3067W\016\342\227\031\233\277\275_\017\355W\374\266F\357\021\377\211\377\342\342W\243+\307\253}\315=\024\313\265Z9\332-n|\177{o\006_1R\373\325\370!\366\253z!\366k.b\027c\277\277d\373nz\315\350\340\336;I'\301>W\337\3436\273'\266\303U\325\331\305\037*Yy\0027o\316.\255\023U5/\207\017\265\0023\267C%$^`\037\366\370\252\036\253\310p\353\351\212\241\026\271\bJ\271]3\253=]M\325\030}\246\321\265\225\365\337\257f|\200c^`\317C\245\2757\316\316.\257c\236c\214\233`\214\237\030\267}\001{\357;\337\005c\251\2271\241\211"
+	.ascii	"\3250\245\317\275\267\0042\277k\302g\362\025;=\345;\237\330\257"
+	.ascii	"\030\211\243\276\245bq\363\367t\200;\360\020[\n\216m.\017*\323"
+	.ascii	"\334q#-\260\250\337vc\364\2571\245\323x{ki\314\300\202\3302\327"
+	.ascii	"\301\177\257R\031\313S\271\274\235\353`\3742\237\365\021\214"
+	.ascii	"o\324F0&f\\D\314\230\210\230\261\200b\306C\305\214\003\350\214"
+	.ascii	"\205\330\214\203\200.=\3769\364\270\2503\346!fL$f\334\352\214"
+	.ascii	"\207:c\226\230\361\312\223\261\2523\326\304\214s\233\361\215"
+	.ascii	"X\302:\263=\275\346\3358\n\t7\336\032\306\311\245?\364\031\343"
+	.ascii	"\343\273\275\016\337\016\027\261\213u0\370a.w:='\2106\247\304"
+	.ascii	"\224\261\325/O\216l\376\234TY\364n\257a\22481F\342\304\374\245"
+	.ascii	"\341\035%\301\330=\264J\335`[\267\361{\215`p\370\001\004\254"
+	.ascii	"C\253\376n\034\217\222\206\367\034\334\373=\372j\024oh{\357\274"
+	.ascii	"\225c\270i\370uY\354\327 ] K\341\362\266\235\277\356\306e^f\025"
+	.ascii	"\250\3038E\326r\317^\004\031\f+\314\333Ms\255\270j\331U\313\252"
+	.ascii	"\022[\332\235G\252Fw5\360\035\f\234k\365\343\236\017w\254D\324"
+	.ascii	"<.\364\204LRu\350\020\365\261l\355\302\007\231\264\22234A9\255"
+	.ascii	"\276\\\331Z\317\364.\357G\017\021\203\243\264@\206[<p\351r\200"
+	.ascii	"\177\203A\315\260\201\335\300~\375\321\252\035\347\027\322Y="
+	.ascii	"\324\007\242\\a\314\\\210W\315\352s\270\033&\355\345l\212_\337"
+	.ascii	"\252\257f\357o\377\215\351\364\177{oU\005\253j+6\276\255L\007"
+	.ascii	"\017\310\327Zc\354\341C\276S\325\306\030Z\013g\255\365\373\232"
+	.ascii	"wp\210\3571\221\320[\223\365Q\331\032\276\032\252\036\275\275"
+	.ascii	"\267\356\304X\304\323\214\320B\316\236\204=\367\336\212\360\025"
+	.ascii	"\315\231\347\225`\277^\277\317\371\265\314\205\030\300\324.o"
+	.ascii	"\314\237\345\306\266?\372b\337\335\2239\177\313\233\211\322Q"
+	.ascii	"\262.\220P\311\r+\220\311\244\223\324\222\324\323\325TV\b\027"
+	.ascii	"XNCQS(\222TK?\310+\247\253\020RM,2*\351\004\302\007CI\200BB\230"
+	.ascii	"\360@\002\022\001\027H\250\344\324\212\237\220\224WI$\213+%V"
+	.ascii	"\n(\247\246'\253\244'\024I\311)'\026IOV\312$\244\003\230\252"
+	.ascii	"\005\322*\351\212\212\312*\251\370.o\324F\254\274\235\006\342"
+	.ascii	"-5\223\250\217\340\242\222!\220\326|\231\301\213\232\206\317"
+	.ascii	"\261\034[\324Kj\341\030\364\352\336{\267@\372\320\006/j \375"
+	.ascii	"\233\001\221\233\203\373\337\336\306\271\303\313\303\"\355\343"
+	.ascii	"\3167DZ\200.\322\267;\261\t6\244\2114\316\371+\367\250\302g\202"
+	.ascii	"\335%\256\231\031\373U\200&\202\005\320C\372\315\037B:\200\326"
+	.ascii	"n\315;<\272\301\205\264\032\345\"d\002\346m\027\n\353$\353p\241"
+	.ascii	"\254lth^]\n\310\340\340P\256ls\2037l\030\330\233\346m)\231F\325"
+	.string	"\3126\347\234\261\240,\210]\226.xDV}\004\007\351\037}\202m\357u\330\245\222\233\312!3.\002\227{\346#%\200\276\250q,\305\020c\f\215\310\210$IA\322\001p\002\231!+v\021\200\261TC\243\205\205\205\373\033\343\270\246\344\333Ce\035\201\357\263\246\n\313S\004\243G\336r\200\351\327\243\020\3477_,\257\265\226\263\030(e\341\347>\024K\231\307\356\251\334\213V\326U\300H&(\361\370\321\333\316\033\226^\017 \254\337b\204\217KG7\302\207\007DV\372\354\b\316\343\320\"K\r\341$|\306\2643a\342\237/\310N\336\036\346\027rn_T\026N\230\2231\352\201B\214l\2669(\304M\370\301\033|`\360\227\252c\321}3~8\243\325\214\253\224\214\200\2432\352\216\351\tC\267!\031\231\003\230\026\372\342C,2i\t\214\022\266\237\2640\265\025L\013f\322,\346\bq\223\247\027x\267"
+	.ascii	"\271'B\371\013=\320\263\277\264\216M\215\251\030\356\235\353"
+	.ascii	"\\&\r\370{\3567\204j\224J\030\034l\355;\253F>\313\350F\302xj"
+	.ascii	".&\210\262\213a\n\035Zr];%\322\220\257=7\261\303\314\222-e\007"
+	.ascii	"h)\245\265XC\301\\,\277~28\001\262&i\356\327]\356\310;u\240-"
+	.ascii	"~j\335\360\273\003\035\215\035\350\343y\033\265\345\f*\322\275"
+	.ascii	"\035Z\032Y\207_\321B\020\025ZA\310>\210\022\200\002\227\220\020"
+	.ascii	"\251\033\371\317\244Y\221e\0040\340\353\023}\360\366\347Y\367"
+	.ascii	"\241M\200\350\3072\225S>\303y\334S00\346\217\3055\214\307\344"
+	.ascii	"\031*"
+	.text
+	.section	.gnu.lto_useAdjustmentConfig.75.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\365\b"
+	.string	"\206\021A90\221\322\001\030\337bp\300\177*j\001\213\342R\035\246\316\315\220F)\017\023\355c[Bm\b\214\351\336m\004\305\324\306\224\002F\261q3\301\ti\027[Q\376\3216\331;\245-"
+	.string	"/"
+	.string	"/"
+	.string	"\264s\002\316\251E\273\346\243k\337\022\353`\261\331\335:E.^\212\376Q\036\260b\245.\001\"v\327r\305\372\270\347m/\330\256\260\275\022\236-\373\257_j\b2\231\217f\327c&[\030})\261}\217\235\340\202\270\264o\362\023\361/\324\007v[0.\273#\203\267\316\251\307\033p\036\236q\257\355l\331\342\006\246\232\034\226\323O\271\n\312'\361\306I~u\352\2378\247\005# *9\263\214\211\315\254\214\331cJ\316\020\373\332\356n\356>\235\347\360\320\360\331\016\274\220\342\233\3602D\241\017\224\350D%\001s[h\"y#S\250\201\321\201.8\260r\241J\022\201F\225\003\303\272)\370+y`5}\037X\003\b"
+	.ascii	"]\024B\231\320\307\027xp\001\306e\224o5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.89.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`X\002m\023"
+	.string	"\306#\177J\300\322Q:\302\021}0\344]\025\242\002!H]\022\340i\225\202\372\235eA\004U\273\017f\311\231\374\202a}{\r\226j'x\250(\330$\"zb\315\266)\024\326\370\204\243N\274H\200\017o\024\b\214MUD\226\220\275S\nc"
+	.string	"h"
+	.string	"k"
+	.string	"1DG\273[\001\374\347\331\2719\267\020iE\351O?\306\177h\007\352\340\tX\232\235\017G\273\347\202\177V\201\377\302\233\240\376y'\200\372g\377\205\355\331\3154{\307\317\236}\340d\203k\332]\361_eq\332+\365h\376q\027\261\345\324^GrB\234\226\334\013Q\331]\203\"\356\357\266Ql\203\260\251\2075\236P\322\020\214\246\2459Ol\3733~\004cX\201\263Gg\204\204\016\233\237\246\335S\374\347\023\244\366}\335s\376\316)\317^$sHsn\355\026\342X]w\234o\024\346X\3317\362\207ND{\221\f\254\335(\354\334\360\330\275\235\374s\251D\002\363\234\r"
+	.string	"\245\250\217\233\331)\037G\263S\016\212\tk\254*\275PP\037Q6Y\322\333\034\326\324\232Y>\247\023\223\337B\331\027\276k-\365(Q\253\335\362]\f\202\026&Hr#h\265_\276s\231\364\354n\203\333\230^i\365|\330\004\221\241OF\351\330\370\356\340\r\237ubZ\372\203V\036W\317\333\272\302\276\320_C\250\351\317\377#\np\002\234\330\305y\002\262)>$\027\327\235\306\3140\225\231\233\306\240\342\340bi!G\027\22616F\210\231\345\206R\244\224\271\214\023`J\0234+\205U\2428`\220\242:`\272Z1\322\224I(1\251\202\305\314\362%\006\223e`\215+\344K$-\210fk|\021\311\027LT%\260KC\371\022c.\327KL\331\246\307\035\314\241P\222\2513\256\265\362\330\226y\273* \\\367\363\b\242O\036@/\343\273\225'-\331"
+	.string	"\0042 \240\002!\254q\003\264\202G\202s\btB\332\340\341\264\205M\330\340\177\222q\253$\332'\2402\032\306\215\033\007\022\356\212\003\257U\330\322\344\341\b\333a.k\377\261k\326\n\213`\360\255+\323\305\364\237\017G\217\273\313@\034\350\327"
+	.string	"\003C\330"
+	.ascii	"N\264\203\267\214\016W4\037\224\305\330\310\346\007\260\223\025"
+	.ascii	"\232\235\233\213\222S\237~-\035\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\253\002\305\016"
+	.string	"\266VWC\340\226*\0350\307\203M\234\0311A3FxQ\213t\212+\302:\031\036&\247\025F\002\304PK\220\020\b\242\"\016\370p\003\b\021\306\030cc\231LS\374`\303\361\271\353\017\\\237\205c\013m\"\267L\001>"
+	.string	"F"
+	.string	"J"
+	.ascii	"@\244\203\323\032|\306\340\340\334<&\277\336q\225\226\214\031"
+	.ascii	"\210\377C\266x|\037r\177E\365\347\257\271\340\266\371\377\262"
+	.ascii	"\3438\262x\370=@\375}\355\372\371\237\301\320\256\273\273\303"
+	.ascii	"O\221\377"
+	.string	"\367FC8\360e\033\370D4\360o\031\3708\f\374\"\"\276\021\355\356\337\033/\360kj\341\0252\024B\314\237Ei\205\n\023\244\022\245\021\244\024\242+\312\305\004\021S\002_\210\214p\330\374\t\002\bPw\207\370A\344\003~\b\272UQuu[\3416\335\016\260\301\302\004\344\261\254q%\224-\251\202\022\252\350\bq|J@\311k\311u[\244P\200'b\312i\241\221;\240\353\2452\240\006X\231\341\344\272\212\322\350^b\006\276\037\3709\017\374#\035\370\001\007 \352&\351>y\004\354\250\203YU\201Z\200EsusMb\202\271\246O\275\234\355\205\316\325\032\n\346\2168sI\210\372WJM\246\351\366\223\322P\214'Q\336-&\324\016\f\t\356\335^D}-\307\330$7 \300\002\261\231\233\003\2346K\341V\2022\262\352s\300\315\334\215\"L\301\023\207\273\231[@\301\271\340[$u\264\256\0031"
+	.string	"\235*\004\337$5I\262!\207\026{\030j2H\202d\220\004\211 \001\022\007\311\037h(Ky+\030e\250\321hn\020\311\3601}W\340\253d9\354H"
+	.ascii	"\314\326\210{K\270\016\327\325\234\203\314H\016\304\f\002\201"
+	.ascii	"\365\313d\361\272\223\007\307\t"
+	.text
+	.section	.gnu.lto_.refs.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\305\006"
+	.string	"\022\016+/@S\222\016S\257\336\354\347\213\342\262\350u\002\270k\006db\357n\034\3030\f\303@\004\251\241\244>kr\0234\260\321F\3547\262m\333R\246\177\272:\320k\364\360\b\305!\324;\034o82\334#\254?Xo0\365\202\365\323\372\265*\260\3565\200sCqj\340H\377\214\375/\352w9>\213\342\253\250\267"
+	.string	"\370\n\351%\356C\212?\250\007\035O\270\367\334\235\317\023}\220=A\217\354(\303\206f\005\245o$\037\366\346\321\267\213\234\030\230\223\222\020\220~9\354\213Q#\223b2bO\221>;n\372\267\364)\372\013\235\n\317P\024"
+	.ascii	";\203\224Gf\004\b\326\022\002\342\312\214\002\302A0\020\002\342"
+	.ascii	"@0\020\002\342\202p\020\f\204\2008\020\254%&\004E\f"
+	.text
+	.section	.gnu.lto_.decls.dddcc00ec3602b94,"e",@progbits
+	.string	"(\265/\375`\255<\215\b\001Z\235\265[V \fQ:\215\001\026\364\223G>\347\026\347\260\372\230="
+	.ascii	"<\3759+\307Y\203gi\261\352\217\270\257R\3073\b\321\rz4\270Y\356"
+	.ascii	"\210`\326\332\266A#\246\034\230\216PF\343\016\350\031\260\332"
+	.ascii	"E\276\211\217\002\240\352\252\216\356\312\336\bF\236\366tIk["
+	.ascii	"n)S\375\004\301\005\345\005\230\016[\301L\256\023\313a$\307e"
+	.ascii	"\330\354\031\212\214\263\267\035:\270^(y\312\341.\354D\233\\"
+	.ascii	"\023(\212\361\304r\370\f+QR\364\344Y\343\266\241M.aY\226\327"
+	.ascii	"\023\n\217\034=n\274U]\276\033\"\013\333\250(\215\353\202a9\214"
+	.ascii	"u\371\320&\233>:bv\205\246\365c\034r8\007\017\035\020A\265+T"
+	.ascii	"a\t\3108\t\r\235\232\035S\227\306h8\355:\261\332\363\330U\323"
+	.ascii	"\006%\212\212\262\366!\210\363!x\255\245s\235\232\236\322\307"
+	.ascii	"N<\004\223\341\254\276\2426\234\217\310\020\301\262\304\013\347"
+	.ascii	"k\027\372\"\276\230\232"
+	.string	"x\f\207]'\026\303E~\347\214X\330EvMX\f\203\361\260\005\376Y\241!\205O\347\013\301\350\013\373\364\205{\372B=\215\275x\216\211\320\030\265@\343\201\263\214\026}\237WC\360\002'\332\202PM_(\246/\364\241/\264\322\027\036\351\007\303\350\007\361\364\203M\364\203d\032\203\277\340\017\375`\226~\020J?\035\243\237V\321O\225\350\247^\372i\r\375\024J\277I\272\365\363\236\356\340\231\353\364\363\232~&\323\317[\3729\206~\263\305\361R\226\025(xL1\272\333\314,\230\250\b\313Q\024\025r(\350\240\360\023f\201\231\260\022v\302+p\323u\342%\234\364\333\334\333\f\t\n\027\025\274\204S\314Yu\221\211\223\362\321\005C>\232E\037\225\242\217\306\351\243k\372\250\230>*D\037\305\241\217b\351\016P\027zD\340\030\034$L\220%\234\001uP\265.C\254p>\312\324\277T\260\334\266['\265"
+	.string	"\"E\236P.\230\273\345\362\335\272\033\017"
+	.string	"C{\206\271^\356\337\375r\273\\1\227\313\355\273~\327y\301\334<|\247\374<`n\225{\205(\214K\212\031]\335Y\330\235\221;\227\005\354\003\274\333v\203\356]E\204K\004\230\253\345\202\257\250\277.\035\020\302;\2703\263\f\371\352\335\347unp\367~\243\334\271\247D\315\335\3049"
+	.string	"\317\216\340|\274D\377n\020D\003\003\357\006\301c2}\314\245\217o\350c*}\354B\037/\351c#\375{\345\277v\227\312m\013\301\006v\353\005\022\234o\024\236_+9A'\251\3466C\331\342R\210\031\243u\256\206 zs\202\037\256\237\376\305\242ov5\004-\\\rA\314v5\004\323\204_qYf8\3378\235\303\207\027\2140\261[\206\2129\3512\032K\317\013v\343n\363k7F\315\255#X\205Ii\314\337\007In\333\r\263\271\233\2044\224\224\3064\271N.\334er\2357\356\272\375.\271o\317\315\275\215\366\336\027\361\363\374\036\210\270q\327\354\246\241M\256]d\007%"
+	.string	"\242\3004&\177{7A\200"
+	.string	"\241\003\"\325\242\267\2465\223_w5\004kn\223\276J\356\332uz\270l(s\f\307f\214\327\23008\377\036\351_\017\301\033x=\004\337\352\233\206/\332U\373M\273g\367@\304k\2146\330\336\315\233\226\367&\2727\203\233{3H\341v\020\035\t\346#\365\215\372\216\335#\327y\270\213\344\327\310\r\273\214Qs\223\355\275q\256\026\023\246\026\316\377\200\256\351\371\311~\001\321\336\"\316A\017\355\275\267\360\036.x\013\372Xcp5\004\363-\362\337\257\013\346\001EZq\265\315\366n^\300iF-\315\300\371\315\253!\250oN\360\307Ib\376\2775\371\037\027\346\277_~\374\205\346\030\376\274\341\371\317M\027\357\277Y\372\376\213\345\307E\362\356\226\037\357a\021?\016\341\251\227\207\257\374\270\356\034\3749\b\335\205\177\366\300\217;\314\341\030Qr\240`'?&@\214\377N\225"
+	.string	"\004\367\004&\370/\363\277\201?v\362\237\354\307UM~\234\305d"
+	.string	"\377u0\334\006x\311\177I\340\366\343$?V{\003\376L\202\005v\221v"
+	.string	"\374Y\001\377\355\300\1771\360\237\357\277=\377m\300\177I\374w\003\377\025\341\177\377\255\374\270"
+	.string	"h\377\271\374\227\301g\377\305\371\261Y\331\377>'$\357\200g~\354<\210?\023\340\307\016\370o\322\177\231\376\333\364_\247\377>\375\027\351\277+\376\353?\013\375x\350\307)\374\270\3751\373c\023?V!\354\307\303\037\217\340\307\311\3776\177\366\362c#?\026\362\343\031?\266\372\361\324\217\243~\314\342\307O?^\372\261\322\217\231?>\301\217K\360c\022\374x\002?~\300\217\017\360\343\235\037\033\340\307 ~<\200\037k\360\343\f~\354\341\307:?\246\340\307\031~L\363\337\343\217\001\177\374\377\202\371\217\366_/\377\221\374g\373o\302\177\375\376\273\367_\271\377>\371o\325\177\251\376\313\342\277P\377%\372o\320\177\221\377\315\371?\346\377\223\377%\376;\371\017\366\377"
+	.string	"\377\345\376\317\004\006\006\006\376\271\371\327\350\370\013\300\023\267mF\213\236\234[[\232\325\005o\315\251-@\352y\226\222\302[t\232\033\212&\311^\223\203_ \242\365X\317s\2243G\345\242\314\034\333Pl\236U\227\277\275\2458\300_\364\374\346fh"
+	.string	"\274-})\267\320{\357\024z\004\022\351b\361\334\342\246\310W\032\031\316\271)C\321<\253n\030e\250\3744\265\343(\005 \r\n\243>+8g\247\2337c$\307V\017\2343\323m\233Y\263\332A\016\227]\264}E\301\371\027\234\364S\244\310I\301\275o\363\252\311\t\003\263\236l\224Q<\037e\245|\224\2234s\357\255')\247\017\177V\361\234\364-5\035\204q\317\2572\2343\022\312\305\306\317\331\304\345\312\004\261"
+	.ascii	"\221q\224\247o\341\210\376\377\033\334DN{o\250\264\271\235\212"
+	.ascii	"j~\323{?\3746\027\275\001\330\373?\005J\260\267Q\331\r?\375c"
+	.ascii	"\215(\3061\330O\353\234\220\310\260\230\017\300z2\302Z\001\211"
+	.ascii	"\fk3\215x0/8m,&\022\331\336\027\266\221\021S\204\253}\001\211"
+	.ascii	"l?m\024S\236\356nb1\267\321\325\276\260\2156\021\006HFXOHdDO"
+	.ascii	"\027\220\310\260\2366\031\326\266\260\215\210\234T\030m\247\013"
+	.ascii	"\233\fko\223]=Y@\"\273zB\"\3032\273hIYBZ \271\241\245t\245 \031"
+	.ascii	"m\246\245)\"'\013uH\315\253}\267\3675K\261\235\002\260\367\324"
+	.ascii	"\225\323\035\321\n\227\255\250\216\251H\215\350\3526\227\212"
+	.ascii	"\262\256\266Q\035\022\220\253\275\201\024\001\355%\020\230\315"
+	.ascii	"\272\255u\353\2303\246\366\212\024{W\260\2647\363\356\272\275"
+	.ascii	"7s\357-t\232j\356\r\303\002\022\327\322\322\336R:K{\212\331\226"
+	.ascii	"bol\226\205\355\t\211,\353\212\247\r\t\031\327>j2/\327\276\303"
+	.ascii	"r\322dL\261\275\242Os=\261\340\3039\0231\001DB\206\363-,i\013"
+	.ascii	"\226\364\034\025s\235\250\230\274e\220\366f\361\241OF \221\277"
+	.ascii	"\355\344\304\301\363\376Q@t\fJTs\265\267\221LZ\017$`8_;\236\243"
+	.ascii	"\201\013\3101\203\b\316\301]\207\003%\f\030t\312\233\020>\234"
+	.ascii	"\321/{S\266\202ti\300\246T\025\316^\320.3QEE[\013\365\313:\244"
+	.ascii	"\320}i\201\366\361\355\275P\361\306\003\347g>\2432r\303"
+	.ascii	"\3718D\372\"P<t\016\265\2026\271\264R\321\013<\334\345\266Ia"
+	.ascii	"\261\273\221\207jA\263\240z\350\226\353D\361\320+G\3570\021\017"
+	.ascii	"\036\032\345\266Q\241x\037\210\345\360\353\002Q\343\324\202\202"
+	.ascii	"\252&\377\206O\007o\352\2524\243\306\366\242p\376M\233\266C\247"
+	.ascii	"\\'J\005\255kJ\331\301\205RA\351\304\372\346t@\200H\217t\261"
+	.ascii	"\b\f\346\337l\351\337\\\351\337D\351\3378\351\333\200\201\222"
+	.ascii	"\224\305\244\f1\222\223q%\005\026\234\201\340X\301\203\276\241"
+	.ascii	"A\302d\305\350\262\373\003\"\206\013\007\215\027HP6T\rm\202*"
+	.ascii	"A\341\3205\324\fu\242n\350\023"
+	.string	"t\t*\206\036A\333P44\r%C\343P'\350\031\232\004e\202\216\241e\327\211\276\241F\216\206\241M\274s\320P\002\242\265\004\204\007\r\244\247\214\252\247V\r).\0343`@\031\362\345\2115\3055\206\312\226] \266\022\002\206\313F\023\027\372\206\022A\213\240M.\231\243\254-W(\254\270\3207\364\206\223\351\371\003\365\001x\247\354\250\242\202\313K\217\013\b\372\206\352\310\200\f\275\251TN\016\013\025\0202.\200\234>Z\244-\004{\233\t\177\0042\361\341\214~\361\034\005\273 \t\\\033\316B\0338}\233#\3726@\364m\264\364m^\350\3334\351\327x\321\257\211C{\344\250(4x\340\374\032%\3725A\364k\262\364k\216\364i\300\350\323\350\351\323\330\351\323D\321\247y\323\247I\323\247\371\322\247\311\322\247Q\322\237\371\323\237\271\323\237Y\323\2379\242?3\304j\003m\264$\r\254\212\3526\257\274"
+	.string	"q>J\365\243+\240R\350\324\275\272(\266,\201\301\031}\201\302\270N\016h\f\276\033EO[\332\004{_\016\301\033\030x9\004\361\325\325\020\324\340\346\004Q\027<G\243n\236\274\234h8_@[p\020\016i\263\252\201\262\200\022j\262)\301\271\257\251\224d\004\006\316\377\340&Qa\224\364\344A\231P\024\350R\332\021\245\347\336\273\tuB\237\256\023e\302{3B\230*r\350\274\202\203v+R\312\202\363g\252t\n1\\*P\245\353D\223\320\243{ \002\fMB\221"
+	.ascii	"\237\034@\334\276 \177|\301\374\031&}\2310\3722]\364e\366\364"
+	.ascii	"e\360\364\217\026\241D2]\324\332T\340\2142\361\0233"
+	.string	"\037I\236\350\177\200\0011\030,\346H\327\223\007\020?1\227\021)\234d\232\354\2660 \356\262\231{ \004\221\222\303\357\017\3358\020\217\271N\f\210\275\034\377\341/\327\301LX\354\230\372\003\016#c\245\217J\246\207\276\214\r}ud\\\350\313\240\340\3427\005\316)\017\347\276fF3z\323\302\247\235\230\017\357\375\3375]\236e>\350\364u\023\275\245FlN\357\211\363\217\267\344\335\3405Q\362\003g\274`\321s+\005\316\327i\372\230(+\354\211C\307\016\251\265\251\033[\\D+4\341\002\022\204\nF\222g\224\223'\216A\245\366\244\361e\243\013\307\026\216\347\217*\037Va3\300\236\\Z\3178L\005_\301Xp\023\\\005\333a7\314\206\237\3406\254\005G\301S0\034\226\202\357\360\032\316\202\235\3407\\\207\241\340%x.JJp\023Lj\210\322\226\\\306\201]xQ\325x\262\257\\<\2158\261\202"
+	.string	"\337\n\032M\322\031rkA\206\340\234\306\245p)\223\247q(\263\231\306\341\210\301?\324X\214\t6\2334lUg-p\316\240\306Z\272d-u[\300\220%5\304\264=u\273e\330\350L\352\f\347\224\r\213\221\261\203\221\345\n\026\023\234k\022\003\246\211n\222e\220\032\302\204\363MP\210\216\2436\234\325\322(\032\036M7\024iZ\336q\366\342F\026ZR\035\222\223:\234\233`5MM9\256\314r\021V\223R\242#-K\237\376\236TQ\201s\006i\251X\212$\025K\235\327\311\211\257"
+	.string	"avY`\376\266T\213\017\177J\366\324\t\227\002\317o\n\316\351\221\303\2059\013\243\202s:v8\241\334\\\226\225\316\217f\036R\203\265B\317\tg\013\346\272\272R#_b}s^\222\272\236i\221\247F\266\264\360\"\205s\nv\333\202`<\250\f\371\302i\332|T\322\257\224H\216 \\WUd\306"
+	.string	"V\251H\275\320\272\254\030]6\rm\301\230\032Oq\324H\205\240Vj6sl7\t\327\344\260\300\3766\222\324\007\0321%1)=\236\ny\032\304\003\021\317\323]B\254\020\341\234\002y\372C*\212[\352#\375\361\203\006\231N\n}\003\350\261\250\247'\234S\256\347a y+\366pN\267\016W#u\345\317\006\017t.\313\256\b\3474G\252\343:/\227\356\370\215\333\321\231\\\240\376\t\356\345\202\351\215\247Z\277\214\214[\025\r,/\372Om\3742B4+1\270\370\3647h\321\036\236d\310Hg\004\313\334\306\260\331"
+	.ascii	"S$\313\2144\353\313\213+@\234b\031i\224\275\225\351ohj\017(\252"
+	.ascii	"\252R\253\fNz\350\345/A\226\232X\335\264\036?\262V\350\320\035"
+	.ascii	"\364\244\244\322\251;\266\233t\332\232\201\177N\300&Di\214\247"
+	.ascii	"S2;\270\374\341Ha\320\314\301\200\272Ka\244/\322;\027L<F\310"
+	.ascii	"+\262\241Jw\330r\341\"\215\322\271b\356i\0206\005\314\324\037"
+	.ascii	"M\330\232\225\2534\352\266\321`y\352*BEw\250b\301\"}\272c\027"
+	.ascii	"\310E\375\351\265\261%li\272\303\\SS\372\244s\205\352\361\365"
+	.ascii	"\305\341\310\330K\276\244NO\237\276\334\232+P\020Cw\210[Z\312"
+	.ascii	";t\256\320+X|R]x\352\b\351o\213\356\360\325\363?-zQ\252\244s"
+	.ascii	"\205\342\351}\310W\356\254\fI\223\236*i\365eA\3019U\201\376\255"
+	.ascii	"X\243\002%E\242\271\322\344\305$EJ\217v\374\300S\201s\n}c"
+	.string	"\352,\312\211NQ\244F\034r^\f\031ad\372\032~hl\324\363\224\351L\231X\314\003\3146\321\323\007'PY\336.\354\250\033\202\3635\020i\233\256\236\347\300\300\233\2263\2049\005\376\375m\247&\034\360\2609!m\321\025<{\236\001\001-\354\235\325\304\266\235\2448\300qqd\245b\211\266\200\350\354Y\356:\363Y\016\203\"Im\250\003\344\265Mq`S\206'\006\2053\230\246P\351E\232\031\022\375\0136\227\353\356\200H\311t`tO*\331\212\020(\317\273\374\274uR\026\266\221\022<\277<%\323\3350/\354=c\216\253K\376\222\3772\227\334\227\275\\g\366\313W\236\241\344(\327\311~\331.\n\215\025.[u7y\356y\035\212\220(`$\3133?3\226\254w\353\244|\330A\345\275\314w\235\371y\035\0166a\260\374\031\tf\266\244\030G8\347\274K&\2474\303\205\226\353\314x8G>"
+	.ascii	"y\340\234\263</\253`&)e\200\322\317\260B?'P\347*\272\312\223"
+	.ascii	"j\356\213~\016\027\375\234\247~\316\235~\216]]\246K\311\236\370"
+	.ascii	"\315\321a\273(+\212\3504\376\300$;\311O~\031\034\"l5\322\230"
+	.ascii	"\350\347&\027\300A\227\206s\316p\317q\277\f\226\333\342Zr\323"
+	.ascii	"\317K\362\333/ss\307\343L\fM?\273\245\005\372\275\3009\267\351"
+	.ascii	"\0249`\033\314P)\261\312m\177N\313j\231M\205@@/8g%y\355\231-"
+	.ascii	"'\331\231\r\204\253\275\2112\033\216\230\275\211p\356\315\340"
+	.ascii	"\336\f2\221\254-\264`~\316\020\375\273\253!hss\202w\t\3173\032"
+	.ascii	"\315\\\3343\214J{\240"
+	.string	"\032\033\313et5Qh0A!y.\023\2125\255\260s\316\360I\251r\305I6\303\002\213\023\016/\325\n\303B\355\bF\202>\331\321\244\017\347\347\250\320\026t\365\\\257\233\275\2563{\345f\013\r\274z\264\340"
+	.string	"\205B\2138i\022\210\363s\330\237\211\344\257l\304\206\r\356\356.\355\373\322\272\3029\203\361<\027\271\0222$\013\347\r7'\230\233fO]A\226\236\347\036\327\231{\344!\017\270\321\334\314\231\2746)\0162\224\013(l8?\017\371\263\217\374#\013\271\311\341c\313\214\022\330(\242\207s\006\302\363\034D\007\006.\321\302\371\346\346\004S\266'\030\226h\017A\266\266\362\216\274;\256\\\243\354m\017L{\340\242CG\336\301A\256G \221?0\267\025\314p\316;\246"
+	.ascii	"\341\201VCW0\327\363|\343\327\231od\034\227\351t\367F\253\202"
+	.ascii	"\343i\023\327\365\302\017\347\254E\32346\267\027C\037\203\222"
+	.ascii	"\336@\327\363\\\343:s\r\224*\023\215m\346\007{zS]5\314\024\200"
+	.ascii	"1p>\006#m\201TO\306\272y\2063\317\270m\035\b\321\212\276\236"
+	.ascii	"O\375{\333\202\036\306XYe\031\fH\303{n)\251\017\032\n\n\206\325"
+	.ascii	"\325\263\214\364"
+	.string	"\bL\355G\206\332\273\241\344$\247\001\320\002\006\214LuE\004\2211\365L\225\251\204IZ\3039\307\b?\253\0172I\342\206\025\372Y}\226\307\265\025\362\340\003eP1\005j\211A;\310dPP\262\210\\\211l\273D&\2132\252\211\265-\366,W\344\312\266\313\035\325(t,\"\327\035v)\264C\301\361(\204D&\221\302v\030L!\311\002\265I\244\320\207\250\036s\253.\203\324\240\340\201B\354,Y\325\304\312\032+h\207K\013\350\345z<\256A\301#\021\371\263\226\370A\256&V\265\250\226\260\034a\210\315\371Y}V\344\b\306Uis\240\020?\253O\213TYV\210D\253\376d\360\243s\240\020;\311u\303R\251\252\020\bbYU\251\252'l8P\210\";,\372\354\024}(PM\260B$4\264B\303\f@!*`\302\b%vZ\365\207%\266\030\240PL\036I\250l\222\004\216qI\344"
+	.ascii	"\273\022sN(\223$*h\017\024B)\224d\177\324 \"KT\356\250K\032\244"
+	.ascii	"\017N\227\303\037\344\2172E\376(QU\205u\231\215F\242\360\204"
+	.ascii	"2Y\314l\253D\215*\362g=\022\205Fu)\224\325\245\360\354\360G\031"
+	.ascii	"\302\206%\002\025\363\t\266]\256?j\t\034\226B9\313\243\020\321"
+	.ascii	"G5\352\234 \262l\317\262\203Q)D\201\206\026\247\310\006QX\022"
+	.ascii	"-\220\263,\226\260\\\252\305$\253\314\320\026\325\243\252a&H"
+	.ascii	"m\227'JhP\252m\211\023G\245\222\230\023\200\016B\264,Q\031b\204"
+	.ascii	"\237d\005\b\360\342\312\252H\365G\037\204\020\f\020\302\210!"
+	.ascii	"\341G$\240\203\004t\020\374\210\004"
+	.string	"\360\360$ \004\036\375\020x\320\366\305e+\201\033u\230\241\305i9\030\221\252p9,\341F\251\266%Z\226\330.e\324\037$\221MK\f\t\0215\260;Cl\316\020;\243$\006\025\331\224U\215\253\211!\366H\\Yuya)t\302\362fH=*\205D\3609\022\201f\216\311b\262M\262J\034\343*\343\303\016W\345r8\304nP\215+;D\256\030\264C\341\017\321\204\344:\374\021:*u.\264\352Re\223\255\020qhD\256'\f[\342r\030$\304\266(\250\312\245\0055\352\221X\\\316\264\254j\002\271\016\327\345\222\245)\262\3065(E\256A\032\205\242\nT\034\"\006i\234\345\221h\342\230T\262j\213\034\241\310nX\252*\373\243\212\020D$aB\351\203\2418\034\022\"\342\264D\023k[\354Q\215I\013\260+Q\007\271\026\325\245\320p\210\0304\034bi\332!\261%\212`a\211L&I"
+	.string	"*\266k\nK\034!\245\332.3\261%\032sn\017\324\323\n%e\226C\265%\266%.\f\251F\344\bG\025\211$\002\221\030\022\"\342\264\305`\253\226@\302\270*1\334,\207$\030WeM{\240\020\306U\271\243#\302]\016G\030We\220\204;\3025\256JTU\236h\207\254\332\036W\237\0135*"
+	.string	"\r}\224\307a\n\304\0233*"
+	.ascii	"\335\370\370$[\241\342\020\250\330&\221C\f-R-\262*\t$(\205\214"
+	.ascii	"\310\225\003\033hR v H\250\204qU\336\264H\241dq\250\376\020Y"
+	.ascii	"\325\004q\210\\\"UeP\222\204q%\241%\236`\"\007\271Z\240\3551"
+	.ascii	"\256J\013=8'\332\325\304\332\256K\244Z\342\250\232P\217\026\332"
+	.ascii	"\242\352\343\2233lYU9\244\016\333\343\332\016\221I\025V6\t\244"
+	.ascii	"c\202zl\333$\013d\002\005\310\2258\0016\331\022Yu\315\220\\["
+	.ascii	"b\tC\304\243Z\302\022\203\312\201V-\021\304\252\2551\347\304"
+	.ascii	"\205v\rZ+pT\213\305\236\033\243\361\230\004Z\252,P\373cA\rZ\333"
+	.ascii	"\031\365\370\203$f\030\236`U\023C\240%\221\005\200\205 !\244"
+	.ascii	"\016J\"U\343\214Z\\M\250\306`\273T\333!\233l\223ACd\322\246X"
+	.ascii	"$\016\215l\262\250\2623\310\344\272\\\252\2542(Y\244\021\032"
+	.ascii	"\223A5\355\201B\250\307\325'\311*\207;E\037\r\332a\b<\272E\256"
+	.ascii	"I%\nD\225=aHT\2667\313\341\317\352\203L\2228&\331\026\231,\346"
+	.ascii	"\250-\261\204\"+\034a\\-\300\002\265B\026\250\325K\265%\262\251"
+	.ascii	"\b#\220\300\002\231\200<a\224\031\221T\016E \005b\007\212\354"
+	.ascii	"\314\201B,}T\243\361\250\256>\303\241\344\t(\024\211\307\023"
+	.ascii	"\b\360\244Rew\332d\222\335\241Y\016{\220\353\260E\252&\"\360"
+	.ascii	"\223\254@\013\364\263\036}\004\320\016G\264\310UH\210L\256m\021"
+	.ascii	")$\001\f\307d\022\002\303\364\207x\224\200\217L;\364\340\203"
+	.ascii	"\026\271\no\034aTE \300\203\021!*8\002\020@\002\003\r\\`\002"
+	.ascii	"\272\030b\331\"\325\240v)$\002#qXdw\212>;\310\225\030\264Sd\227"
+	.ascii	";!.HAEjU\350H\334@KL\036%\220\202\212\264\001T\n6\351\242s\022"
+	.ascii	"\223\206\031;Z\201\205\231Pi\213h\n\316\001\330\\R0\\\322/2\314"
+	.ascii	"\275g\242\362\254\272|I\377\334\2506\217\277\324\013\tWP\374"
+	.ascii	"u\311D3(\002\303Lu\301IA\250/<\032U~"
+	.string	"MtmL3K\237\221 \013,*^u7\\I]+\354e!6f\300\231=\365\366\025\221;\234\233`L\034<p\306\200\tK\272\005K\232w\267\323\336}b)\336\323\2744H\263\256\f\347T\313m\243\001b$\025\206s\232\345\266%\241j\022\202\271\330\370\232\302!Ig\240bJz7%\275r\fD{\027\355]\225\243\003/\0319\374\354\236^I\255\330\314\270\273\362\262\222V\211+\273\202\362l\312\254\021\331\260J\251\240W\376\336\252\344\370\242\233\231\016\t\232Z\235\220\272\260@-\272L\325\307dDn.\235\252\362\003\363\027\245E\320+0\204\354\250\3032\324aP.\345@\305\240RfhF\233\244\003\243\024@PhL*\227N\227Y\037\023@P\2513\262\226\250\225RHhD$HARPP\310\316\001\356~*\204`\030I\237\036PhJl\021x\025\312\002\004\226\332\354+MA\\H"
+	.string	"\313/\\\223N\217\354\272\232\\\213\324\277%x\200\231\007\360\nt\247It\314\020"
+	.ascii	".Hb\n\3342\217e"
+	.ascii	"\250\224c\230\325w\231\200\365f\377\335\n\262!\353Y\350\017\025"
+	.ascii	"\221\242+\247Bo\1772\351:\342B\245\2441,\213\006\f\t9\236L\241"
+	.ascii	"\224\226q_\367\341\310\200\030hWY\304\364c\353\314\3465\025\201"
+	.ascii	"p-\247\300=\226'\233yc\0076\002\247\227I\265=\321@]\333\344\222"
+	.ascii	"\352\334W\204R\260*\336\031\n\325\351G\252\233\001\325\360m\353"
+	.ascii	"b\256\276\177iAxZ\310\301\316\210O\265\235\264\277\202Vcby1\233"
+	.ascii	"\375O\366\331mab\021m\023F)\216`\234U,\363J\307\241FF\305"
+	.string	"\375b\205\340U\272\016\032%\023\3059\215\261f\356\013w@CS\n\177T\016L\3421?\020\313\267\027\307\300\027\370\302\035\224x7\020\301\001P\367T\257nK\223\205\203B?\306.\n\211\025a\323B\276\241QJ/\354\337I\262\251I\365\357-\347I\260][\264T]dP\033\2144y\226\001\255\323#\004bh\217\026\363\207\367\303\255\2611\343\372\277\234J\006\201=K\013QKR2S\030c\026\314\204\305\013\f\223\215\261q,A=\342\272O\023d\251\312\037\"\034{/\361\376\323a\225\355J\304\275\020G\004\302Z\203%L\177N4\212@\250\003\211B\236\242%#\213|Ovw(\376\\5m\227m!Y\022\224l$\317\026\377[\316\343\2046\036\205\214\250\022\220V\240\312\254\201\"\313V(\314WR\033&\004f\226\347\233\031\333=\323\241\373\207\310\227Z$\227\256l\032\345\337Og\3216\2140\035"
+	.ascii	"A\212\334\276h\267:\020\305\363\f\243\200\374\335n\225.b\032"
+	.ascii	"\025\005\371\303\224w[\n\312\365{-Z\212\232\210B\334_\256tI:"
+	.ascii	"Z\371%o\221\022T\325=\001Q\026\347\265\340\356xg\347bk)\341\224"
+	.ascii	"\315|\375\335\273\237\017\330\344\237n\264\037\220\037\345\244"
+	.ascii	"g2\373\031\331D\344nb\0368\316\340\303fg\034\261\242\204\313"
+	.ascii	"\233:\331\337\034\231\231.\363\261f\\\245]n*\265\\\002g\031\013"
+	.ascii	"l\312\005"
+	.string	"\330\330\202\231\003g]\301NF\\IW\t\233\220\300\303\351\003\233p\212\253zK\311q'\261\240J\230\302W\234/F\237;oB\bc_\355\027\236\312,\275\330\034\337\326\223\021\215!\023V\177Sn\304\254\305S\315w\264\030\003\372\247\205b\027\312JI\3415\344\356\364\314M[B\303\322\005\212Y~\204\317g%\232#i*)\336G\3604\2541~\270\304\2344H\311jz\b_\003\203\362\034\304\n\347\"\2368\3513\267\207\254\004\301\024Ea\002D\233\\\335\365\315\306C5\231\230\244\f\312fS\362\344?\034;Dfn5n\030\211\356\017\354\226\237\213\231\006+a\037\321\347\3540Px\223\270\300u\006\002z\254K\021\004T\017\002\271AW~`_WtUO\3515\277\353\004\330\214\031E\325tU`*(\345]2$\237\335uG\024\2358\266\203\341#\2049\037\302 W'\343iW\337\254\347\377"
+	.string	"\004\266\3365\314!W\001\374/\233\333\2762\314-\027\222\216|w\034\017\210fOvl\254G%`\342y\227j\226E)w\200\031\276\250<p\204\3774?Q\323\263\003>7\r^\371\036C\267\372Y\036\203i\324\230\022\202fz\251\252wlZ\323[\020S\f|T\355Q-\332W\323B\034\005A\224\320NF%\220\037y\306\270\362+\357\t>\201\251P\327\206\240\353b\205\301\241\336u\342\005=\372Lp\207\027a\373\220Vo\332\365\356>\364\231\340\317\360M\244\366\307&fR\201\257D\016\316KOI\261\262\237E\020\030\346\007\026T\342\272\302SH\373\023)}+\207\340\021\307Q]\205\0321IX\274\352\177\240e#S\023\357\343\327\222\212\311\256\360\257\317+\"`Da?\332\214\247Db\2650:3\021\221\036\002"
+	.ascii	"\242\362\357\270\263\240\006\002 )\311\240 \t\242\360\237\201"
+	.ascii	"x\341M\340\f8\216\330\226\301\306"
+	.string	"i\230\200\275\225\325\263\"@\372\205s\365\265}\314:k\243\340\354\377\361\241\213\247\355Dk\330W\350\275g0\211\234\244:\bmP\232, \265\037\021E(a\004>OUl\363\271\351\205\332\213\252\341\323\264C@\033\373BTV\274h\332B\371\207(\177\345\022=\331\3640y\3624G\213\264\274\026\261e\3231\320`\n\270Y\230\203c\227\r|\26680\344\307\360y\242\r\376\262M\304\204\3325\261\271\234<=\017\266\322\340\332\273C\017\351\336\341\315\333J\267\211=\026x\023\242k\200h\267\270\017=\363\nd\022=H~z\232\016E\302=\017\356\310}<\t\rE\246\255\265\002'`a\tE\033\335\266\f\247\036\f\271@\376\354e`\026\307\370O\356\354C\216\3414~\023\351V\323TI\274\0166\255h\354\266i\255D\"\217R\240\021\275\256\253\032\271\270\261\364/%\204;\n\312\217T\272\204B\240\330N"
+	.string	"\323\002\020\304\2273\222zI$\260\316\212Q\364\034GG\022\377[\236\240\rk}a\346r\2014\027\3034\343\273d|\376\217\f\252\330\221\220\347\024_D~:\355\3238Nk\352\357\372\035Kd\2222\030(t\355\377\270\2608\365_\211\037\224\302\026,\337{\325F\035\006\374\270\241l&#\377\270\345\342\272)\243\212\bH"
+	.string	"hKu\372\312\033N\330\306^?Q\bO\006j\377\007~\316\2731\222\325\020\245\337\244\212\037N\360\013\224\3533\260\034H\021Qq\312\372\232\016\200\253\325k\364\036l\361[\340}y\235|\234\005X\013\343\357\262\323\232\271\242\3122"
+	.ascii	"\f\363\271v\367\2761\227\346{\024\331\t\255.%\213\355?8\325\325"
+	.ascii	"\342/\017Fo\3758\204\013<\303\035\215\177&\r\223\363\234\023"
+	.ascii	"G?\203\356\370\343\240\363|\313\315)3?/\234n7B\366\270_\224\023"
+	.ascii	"\350Xl\374\nNh\303Q\032\3666o\3323\341\251\350(&\331\377X\362"
+	.ascii	">$\346\242`J5|}\003\365\342!\200\377\346$\374\020\204\303s+\242"
+	.ascii	";\242\267D\235\003\r\326\nsE\240\322\201~G\310$L\366*B\257a\215"
+	.ascii	"r[\305\255\340\030\004h-\035F\336\001\314x\375\022P\334\317\341"
+	.ascii	"A%{\016V\312\2512\367\002\253\243@\352\234jL\345h,\347\223\366"
+	.ascii	"\277\305\356\273e\315\220\267\2200\357\372\212|\204\230\307\352"
+	.ascii	"\303\232D\363>\357\333)i\366v\313+\200\344\276\200`b<\304|)\035"
+	.ascii	"\352\323\325\310\"\377Ue\327\243A\366U\350\206\341\273q\270E"
+	.ascii	"\325>\007\221{\252\250\205\034\213\202\267\002\200\2613\201\333"
+	.ascii	",\313&\312\020\206\341\254\\\305\237\205\212\305\247H\330m\344"
+	.ascii	"N\310\237%\351\271\nM0\017h\206\306u+\275/uIQ\215\360\312\320"
+	.ascii	"'l\017\233\307\035\260H\022\256\344\177\026\340H\370\017\263"
+	.ascii	"\234\302\021\007\334\002P\200O\177I\320\027\024,\352\"x\264\206"
+	.ascii	"i\364\366\350d\377\026X\326T\267\347\340,j\332\177N\317\023/"
+	.ascii	"a\0053e\246Z\216C\325\373\367\003z`\035\211D\320\025\212\037"
+	.ascii	"n=\210\344\335K\206\177\267K0\210\n\022m\352\"O\325\304\265\250"
+	.ascii	"\201\361\232,uv\017C\026\256\303\237\n\246\035\243\031PM\"D\245"
+	.ascii	"g\307\beTWz\236\302_#\340\2439\202N\234\371=\036\247\252hxXq"
+	.ascii	"\361CU\316h\025s\271~\007\002k\277\315OK\271[\372f\305o1A,|\220"
+	.ascii	"\022\340\373\264\341\371_\n\f\362Y\204@\n\021\004\026\037\f\300"
+	.ascii	"\n\307\361m"
+	.string	"\262?,\365\366\241|\024\267^\251a \334\016F\325\2008\265\307\233\240\310\3278\340\344\252\343\331"
+	.ascii	"\016\247\024\322\\\206\003\355j\3704\bI/\2667J\364\276A\373\306"
+	.ascii	"\205~\274\201F3\237\311%\326\247\3402ZD\350\260\031\216\275\004"
+	.ascii	"\n\352g\3274\002\312\304\203}W\324\202\311\272\351\367\227\255"
+	.ascii	"\f\0050\3371vj\177n\353\241W\337R\374\006\214M\265\321\315Qe"
+	.ascii	"\033\367\333\337\234\202\033c\024\243\2020\270\034\342AE\022"
+	.ascii	"b\021q\223\263\006\003\016\3211\t\272\242\rk\",*T\250i\273\323"
+	.ascii	"N\276\376.\312\243}^\260\315\316\325\303\344\344<\270v\213\233"
+	.ascii	"\372\241<A\033\326\242hJW\370C\201d'\257,\325\177\002\332\026"
+	.ascii	"\340-&\244\354\001\201\217\024;@\264\357\360\035\375\363\200"
+	.ascii	"\276\277\254G+\305k\363\337\307\005\334#\363\235\372\270NsL\002"
+	.ascii	"KR\307\"\003c\006\021\177\230\363\243\220+p[pr~\350\300\024\354"
+	.ascii	"\0347~\363\305\211\327\027\254\276\213\335\333\331G\205K\003"
+	.ascii	"\247Z/\346/\375\234\317\333\274\354\333\022p\027p%g\303T\234"
+	.ascii	"\201\372\353\370s\325u\213\377\212#\273\273\313\027\206\267\370"
+	.ascii	"\306\372\307\031\034\264\377\360\363\352\204\276&f]\316\273\367"
+	.ascii	"y\233\027\006\177\300M*\314~\343\332\271\003\327\377-}J>/<\251"
+	.ascii	"z\335\206q\303\303\335\240k\263\316\215\345M\001)\375@\352\276"
+	.ascii	"\337\324\\\226fV\264\372sw\307\372\006\264\334x\360\177v\313"
+	.ascii	"\376\250\027.\352\367\214\374UNx\373\275uo\257\"y\255\243\177"
+	.ascii	"\354\377T6V\370D\032\253\323\265\337\034\334q\346\275\362\356"
+	.ascii	"\005\363\307\204\335\224)\322\306\272F\006'\016\026j~\230`\335"
+	.ascii	"V\364\326\263\021P\315x\226\272z\r\034\350\006"
+	.text
+	.section	.gnu.lto_.symtab.dddcc00ec3602b94,"e",@progbits
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dddcc00ec3602b94,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
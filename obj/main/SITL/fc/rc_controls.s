@@ -0,0 +1,18233 @@
+	.file	"rc_controls.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/io_types.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/flight/pid.h"
+	.file 10 "./src/main/fc/rc_controls.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/io/beeper.h"
+	.file 13 "./src/main/fc/rc_modes.h"
+	.file 14 "./src/main/sensors/sensors.h"
+	.file 15 "./src/main/sensors/acceleration.h"
+	.file 16 "./src/main/rx/rx.h"
+	.file 17 "./src/main/target/SITL/target.h"
+	.file 18 "./src/main/fc/rc_controls.c"
+	.file 19 "/usr/include/string.h"
+	.file 20 "./src/main/fc/fc_core.h"
+	.file 21 "./src/main/sensors/barometer.h"
+	.file 22 "./src/main/flight/navigation.h"
+	.file 23 "./src/main/sensors/gyro.h"
+	.file 24 "./src/main/flight/failsafe.h"
+	.file 25 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_controls.c.9fc115f3
+	.weak	rc_controls.c.9fc115f3
+rc_controls.c.9fc115f3:
+	.long	0xf8e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF2647
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2285
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2286
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2287
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2288
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2289
+	.uleb128 0x3
+	.long	.LASF2290
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2291
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2292
+	.uleb128 0x3
+	.long	.LASF2293
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2294
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2295
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2296
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2297
+	.uleb128 0x3
+	.long	.LASF2298
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2299
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2301
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2302
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF2303
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2304
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2305
+	.uleb128 0x1a
+	.long	.LASF2599
+	.byte	0x11
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0x10
+	.long	0xe7
+	.long	0x111
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2306
+	.uleb128 0x3
+	.long	.LASF2307
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x14b
+	.uleb128 0x9
+	.long	.LASF2308
+	.value	0xfff
+	.uleb128 0x9
+	.long	.LASF2309
+	.value	0xf000
+	.uleb128 0x9
+	.long	.LASF2310
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2312
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x157
+	.uleb128 0x22
+	.long	0x167
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.uleb128 0x23
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x188
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x15
+	.string	"fn"
+	.byte	0x5
+	.byte	0x33
+	.byte	0x16
+	.long	0x188
+	.byte	0
+	.uleb128 0xa
+	.long	0x14b
+	.uleb128 0xb
+	.long	.LASF2393
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x1e8
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x118
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1e8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1e8
+	.byte	0x10
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x1ed
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x167
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x1e8
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x18d
+	.uleb128 0x12
+	.long	0x1f2
+	.uleb128 0x3
+	.long	.LASF2318
+	.byte	0x6
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x335
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x8
+	.byte	0x22
+	.long	0x411
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF2373
+	.value	0x100
+	.uleb128 0x9
+	.long	.LASF2374
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF2375
+	.value	0x400
+	.uleb128 0x9
+	.long	.LASF2376
+	.value	0x1000
+	.uleb128 0x9
+	.long	.LASF2377
+	.value	0x2000
+	.uleb128 0x9
+	.long	.LASF2378
+	.value	0x4000
+	.uleb128 0x9
+	.long	.LASF2379
+	.value	0x8000
+	.uleb128 0x7
+	.long	.LASF2380
+	.long	0x10000
+	.uleb128 0x7
+	.long	.LASF2381
+	.long	0x20000
+	.uleb128 0x7
+	.long	.LASF2382
+	.long	0x40000
+	.uleb128 0x7
+	.long	.LASF2383
+	.long	0x80000
+	.uleb128 0x7
+	.long	.LASF2384
+	.long	0x100000
+	.uleb128 0x7
+	.long	.LASF2385
+	.long	0x200000
+	.uleb128 0x7
+	.long	.LASF2386
+	.long	0x400000
+	.uleb128 0x7
+	.long	.LASF2387
+	.long	0x800000
+	.uleb128 0x7
+	.long	.LASF2388
+	.long	0x2000000
+	.uleb128 0x7
+	.long	.LASF2389
+	.long	0x4000000
+	.uleb128 0x7
+	.long	.LASF2390
+	.long	0x8000000
+	.uleb128 0x7
+	.long	.LASF2391
+	.long	0x10000000
+	.uleb128 0x7
+	.long	.LASF2392
+	.long	0x20000000
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2394
+	.byte	0x4c
+	.byte	0x9
+	.byte	0x4a
+	.long	0x58a
+	.uleb128 0xd
+	.string	"pid"
+	.byte	0x9
+	.byte	0x4b
+	.byte	0xc
+	.long	0xc75
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2395
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2396
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0x9
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0x9
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2399
+	.byte	0x9
+	.byte	0x51
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2400
+	.byte	0x9
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2401
+	.byte	0x9
+	.byte	0x53
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0x9
+	.byte	0x54
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2403
+	.byte	0x9
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2404
+	.byte	0x9
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2405
+	.byte	0x9
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2406
+	.byte	0x9
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2407
+	.byte	0x9
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0x9
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0x9
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0x9
+	.byte	0x60
+	.byte	0xe
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2412
+	.byte	0x9
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2413
+	.byte	0x9
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2414
+	.byte	0x9
+	.byte	0x63
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2415
+	.byte	0x9
+	.byte	0x64
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2416
+	.byte	0x9
+	.byte	0x65
+	.byte	0xe
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2417
+	.byte	0x9
+	.byte	0x66
+	.byte	0xe
+	.long	0xc3
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0x9
+	.byte	0x67
+	.byte	0xe
+	.long	0xc3
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2419
+	.byte	0x9
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0x9
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2421
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x18
+	.long	0xc2f
+	.byte	0x48
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2648
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.byte	0xe
+	.long	0x5e5
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x1
+	.uleb128 0x25
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x27
+	.long	0x5fd
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2435
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x3
+	.long	0x5e5
+	.uleb128 0x4
+	.long	.LASF2443
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0x101
+	.uleb128 0xb
+	.long	.LASF2436
+	.byte	0x5
+	.byte	0xa
+	.byte	0x51
+	.long	0x663
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0xa
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0xa
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0xa
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0xa
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0xa
+	.byte	0x56
+	.byte	0x9
+	.long	0x111
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2442
+	.byte	0xa
+	.byte	0x57
+	.byte	0x3
+	.long	0x615
+	.uleb128 0x12
+	.long	0x663
+	.uleb128 0x4
+	.long	.LASF2444
+	.byte	0xa
+	.byte	0x59
+	.byte	0x1b
+	.long	0x663
+	.uleb128 0x4
+	.long	.LASF2445
+	.byte	0xa
+	.byte	0x59
+	.byte	0x4e
+	.long	0x663
+	.uleb128 0xb
+	.long	.LASF2446
+	.byte	0x8
+	.byte	0xa
+	.byte	0x5b
+	.long	0x6cd
+	.uleb128 0x2
+	.long	.LASF2447
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2448
+	.byte	0xa
+	.byte	0x5d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2449
+	.byte	0xa
+	.byte	0x5e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2450
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2451
+	.byte	0xa
+	.byte	0x60
+	.byte	0x3
+	.long	0x68c
+	.uleb128 0x12
+	.long	0x6cd
+	.uleb128 0x4
+	.long	.LASF2452
+	.byte	0xa
+	.byte	0x62
+	.byte	0x19
+	.long	0x6cd
+	.uleb128 0x4
+	.long	.LASF2453
+	.byte	0xa
+	.byte	0x62
+	.byte	0x48
+	.long	0x6cd
+	.uleb128 0xb
+	.long	.LASF2454
+	.byte	0x3
+	.byte	0xa
+	.byte	0x64
+	.long	0x72a
+	.uleb128 0x2
+	.long	.LASF2455
+	.byte	0xa
+	.byte	0x65
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2456
+	.byte	0xa
+	.byte	0x66
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2457
+	.byte	0xa
+	.byte	0x67
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2458
+	.byte	0xa
+	.byte	0x68
+	.byte	0x3
+	.long	0x6f6
+	.uleb128 0x12
+	.long	0x72a
+	.uleb128 0x4
+	.long	.LASF2459
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x17
+	.long	0x72a
+	.uleb128 0x4
+	.long	.LASF2460
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x42
+	.long	0x72a
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x15
+	.long	0x76b
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2463
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x58
+	.long	0x7a1
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2468
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2469
+	.byte	0xb
+	.byte	0x64
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xc
+	.byte	0x17
+	.long	0x83d
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2492
+	.byte	0xc
+	.byte	0x31
+	.byte	0x3
+	.long	0x7ad
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xd
+	.byte	0x18
+	.long	0x939
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2516
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2517
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2518
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2531
+	.byte	0xd
+	.byte	0x3f
+	.byte	0x3
+	.long	0x849
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xe
+	.byte	0x14
+	.long	0x96f
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2534
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2535
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2536
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xe
+	.byte	0x2d
+	.long	0x9a5
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2538
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2544
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2545
+	.uleb128 0xb
+	.long	.LASF2546
+	.byte	0x4
+	.byte	0xf
+	.byte	0x35
+	.long	0x9da
+	.uleb128 0x2
+	.long	.LASF2547
+	.byte	0xf
+	.byte	0x36
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2548
+	.byte	0xf
+	.byte	0x37
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2549
+	.byte	0xf
+	.byte	0x38
+	.byte	0x3
+	.long	0x9b3
+	.uleb128 0x26
+	.long	.LASF2649
+	.byte	0x4
+	.byte	0xf
+	.byte	0x3a
+	.byte	0xf
+	.long	0xa0c
+	.uleb128 0x15
+	.string	"raw"
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xd
+	.long	0xa0c
+	.uleb128 0x27
+	.long	.LASF2550
+	.byte	0xf
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x9da
+	.byte	0
+	.uleb128 0x10
+	.long	0x9f
+	.long	0xa1c
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2551
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x3
+	.long	0x9e6
+	.uleb128 0x10
+	.long	0x9f
+	.long	0xa38
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2552
+	.byte	0x10
+	.byte	0x4f
+	.byte	0x10
+	.long	0xa28
+	.uleb128 0xb
+	.long	.LASF2553
+	.byte	0x2c
+	.byte	0x10
+	.byte	0x75
+	.long	0xb96
+	.uleb128 0x2
+	.long	.LASF2554
+	.byte	0x10
+	.byte	0x76
+	.byte	0xd
+	.long	0xb96
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2555
+	.byte	0x10
+	.byte	0x77
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2556
+	.byte	0x10
+	.byte	0x78
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2557
+	.byte	0x10
+	.byte	0x79
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2558
+	.byte	0x10
+	.byte	0x7a
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2559
+	.byte	0x10
+	.byte	0x7b
+	.byte	0xe
+	.long	0xcf
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2560
+	.byte	0x10
+	.byte	0x7c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2561
+	.byte	0x10
+	.byte	0x7d
+	.byte	0xd
+	.long	0x203
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2562
+	.byte	0x10
+	.byte	0x7e
+	.byte	0xd
+	.long	0x203
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2563
+	.byte	0x10
+	.byte	0x7f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2564
+	.byte	0x10
+	.byte	0x80
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2565
+	.byte	0x10
+	.byte	0x81
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2566
+	.byte	0x10
+	.byte	0x82
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2567
+	.byte	0x10
+	.byte	0x83
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2568
+	.byte	0x10
+	.byte	0x84
+	.byte	0xe
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2569
+	.byte	0x10
+	.byte	0x85
+	.byte	0xe
+	.long	0xc3
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2570
+	.byte	0x10
+	.byte	0x86
+	.byte	0xe
+	.long	0xc3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2571
+	.byte	0x10
+	.byte	0x87
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2572
+	.byte	0x10
+	.byte	0x88
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2573
+	.byte	0x10
+	.byte	0x89
+	.byte	0xd
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2574
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2575
+	.byte	0x10
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2576
+	.byte	0x10
+	.byte	0x8c
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2577
+	.byte	0x10
+	.byte	0x8e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2578
+	.byte	0x10
+	.byte	0x8f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x28
+	.byte	0
+	.uleb128 0x10
+	.long	0xb7
+	.long	0xba6
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2579
+	.byte	0x10
+	.byte	0x90
+	.byte	0x3
+	.long	0xa44
+	.uleb128 0x12
+	.long	0xba6
+	.uleb128 0x4
+	.long	.LASF2580
+	.byte	0x10
+	.byte	0x92
+	.byte	0x13
+	.long	0xba6
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x25
+	.long	0xc11
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0xa
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x3e
+	.long	0xc2f
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2595
+	.byte	0x9
+	.byte	0x42
+	.byte	0x3
+	.long	0xc11
+	.uleb128 0xb
+	.long	.LASF2596
+	.byte	0x3
+	.byte	0x9
+	.byte	0x44
+	.long	0xc69
+	.uleb128 0xd
+	.string	"P"
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0xd
+	.string	"I"
+	.byte	0x9
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0xd
+	.string	"D"
+	.byte	0x9
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2597
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0xc3b
+	.uleb128 0x10
+	.long	0xc69
+	.long	0xc85
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2598
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x3
+	.long	0x411
+	.uleb128 0x1a
+	.long	.LASF2600
+	.byte	0x9
+	.byte	0x79
+	.byte	0x5
+	.long	0x111
+	.uleb128 0xe
+	.long	.LASF2601
+	.byte	0x3d
+	.byte	0x16
+	.long	0xca8
+	.uleb128 0xa
+	.long	0xc85
+	.uleb128 0xe
+	.long	.LASF2602
+	.byte	0x40
+	.byte	0xc
+	.long	0x111
+	.uleb128 0xc
+	.long	0x609
+	.byte	0x42
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF2603
+	.byte	0x12
+	.byte	0x44
+	.byte	0x21
+	.long	0x66f
+	.uleb128 0xc
+	.long	0x674
+	.byte	0x44
+	.byte	0x56
+	.uleb128 0xc
+	.long	0x680
+	.byte	0x44
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF2604
+	.byte	0x12
+	.byte	0x44
+	.byte	0xb3
+	.long	0x1fe
+	.uleb128 0x16
+	.long	0xcd9
+	.byte	0xe1
+	.uleb128 0x17
+	.long	0xcbf
+	.byte	0x46
+	.byte	0x1a
+	.uleb128 0x4
+	.long	.LASF2605
+	.byte	0x12
+	.byte	0x4e
+	.byte	0x1d
+	.long	0x736
+	.uleb128 0xc
+	.long	0x73b
+	.byte	0x4e
+	.byte	0x4a
+	.uleb128 0xc
+	.long	0x747
+	.byte	0x4e
+	.byte	0x6e
+	.uleb128 0x4
+	.long	.LASF2606
+	.byte	0x12
+	.byte	0x4e
+	.byte	0x9b
+	.long	0x1fe
+	.uleb128 0x16
+	.long	0xd0c
+	.byte	0xc5
+	.uleb128 0x17
+	.long	0xcf2
+	.byte	0x50
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF2607
+	.byte	0x12
+	.byte	0x56
+	.byte	0x1f
+	.long	0x6d9
+	.uleb128 0xc
+	.long	0x6de
+	.byte	0x56
+	.byte	0x50
+	.uleb128 0xc
+	.long	0x6ea
+	.byte	0x56
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF2608
+	.byte	0x12
+	.byte	0x56
+	.byte	0xa7
+	.long	0x1fe
+	.uleb128 0x16
+	.long	0xd3f
+	.byte	0xd3
+	.uleb128 0x17
+	.long	0xd25
+	.byte	0x57
+	.byte	0x18
+	.uleb128 0x13
+	.long	.LASF2609
+	.byte	0xd
+	.byte	0x6e
+	.byte	0x5
+	.long	0x111
+	.long	0xd6e
+	.uleb128 0x5
+	.long	0x939
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2611
+	.byte	0x14
+	.byte	0x26
+	.long	0xd7f
+	.uleb128 0x5
+	.long	0xd7f
+	.byte	0
+	.uleb128 0xa
+	.long	0x9e6
+	.uleb128 0x13
+	.long	.LASF2610
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xda4
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x7c
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2612
+	.byte	0xf
+	.byte	0x4c
+	.long	0xdb5
+	.uleb128 0x5
+	.long	0xc3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2616
+	.byte	0x8
+	.byte	0x74
+	.uleb128 0xf
+	.long	.LASF2613
+	.byte	0x8
+	.byte	0x7a
+	.long	0xdcd
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2627
+	.byte	0x14
+	.byte	0x27
+	.byte	0x6
+	.long	0xddb
+	.uleb128 0x29
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2614
+	.byte	0x15
+	.byte	0x35
+	.long	0xdec
+	.uleb128 0x5
+	.long	0xc3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2615
+	.byte	0xb
+	.byte	0x69
+	.byte	0x5
+	.long	0x111
+	.long	0xe02
+	.uleb128 0x5
+	.long	0xcf
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2617
+	.byte	0x16
+	.byte	0x36
+	.uleb128 0xf
+	.long	.LASF2618
+	.byte	0x17
+	.byte	0x6f
+	.long	0xe1a
+	.uleb128 0x5
+	.long	0x111
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2619
+	.byte	0xc
+	.byte	0x3c
+	.long	0xe2b
+	.uleb128 0x5
+	.long	0x83d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2620
+	.byte	0x14
+	.byte	0x2b
+	.uleb128 0x1b
+	.long	.LASF2621
+	.byte	0x18
+	.byte	0x55
+	.long	0x111
+	.uleb128 0x1b
+	.long	.LASF2622
+	.byte	0x10
+	.byte	0xa3
+	.long	0x111
+	.uleb128 0x14
+	.long	.LASF2623
+	.byte	0x14
+	.byte	0x29
+	.uleb128 0x14
+	.long	.LASF2624
+	.byte	0x14
+	.byte	0x2c
+	.uleb128 0x13
+	.long	.LASF2625
+	.byte	0xd
+	.byte	0x66
+	.byte	0x5
+	.long	0x111
+	.long	0xe6c
+	.uleb128 0x5
+	.long	0x939
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2626
+	.byte	0x19
+	.byte	0x1e
+	.byte	0x5
+	.long	0x111
+	.long	0xe82
+	.uleb128 0x5
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2628
+	.byte	0x12
+	.value	0x137
+	.byte	0x6
+	.long	0xe9c
+	.uleb128 0x18
+	.long	.LASF2630
+	.value	0x137
+	.byte	0x28
+	.long	0xca8
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2629
+	.byte	0x12
+	.value	0x133
+	.byte	0x9
+	.long	0xab
+	.long	0xec6
+	.uleb128 0x18
+	.long	.LASF2631
+	.value	0x133
+	.byte	0x26
+	.long	0xab
+	.uleb128 0x18
+	.long	.LASF2568
+	.value	0x133
+	.byte	0x35
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2632
+	.byte	0x12
+	.byte	0x75
+	.byte	0x6
+	.long	0xf2c
+	.uleb128 0x1c
+	.long	.LASF2633
+	.byte	0x75
+	.byte	0x2f
+	.long	0x5fd
+	.uleb128 0xe
+	.long	.LASF2634
+	.byte	0x77
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2635
+	.byte	0x78
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2636
+	.byte	0x79
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0xe
+	.long	.LASF2637
+	.byte	0x7a
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x2d
+	.string	"i"
+	.byte	0x12
+	.byte	0x7b
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x1d
+	.long	.LASF2638
+	.value	0x101
+	.byte	0x19
+	.long	0xa1c
+	.uleb128 0x1d
+	.long	.LASF2639
+	.value	0x104
+	.byte	0x9
+	.long	0x111
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2640
+	.byte	0x68
+	.byte	0x12
+	.long	0x5fd
+	.uleb128 0x2e
+	.long	.LASF2641
+	.byte	0x12
+	.byte	0x63
+	.byte	0x5
+	.long	0x111
+	.long	0xf53
+	.uleb128 0x1c
+	.long	.LASF2642
+	.byte	0x63
+	.byte	0x28
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2643
+	.byte	0x5e
+	.byte	0x5
+	.long	0x111
+	.uleb128 0x19
+	.long	.LASF2644
+	.byte	0x10
+	.byte	0x92
+	.byte	0x65
+	.long	0xf6a
+	.uleb128 0xa
+	.long	0xbb2
+	.uleb128 0x19
+	.long	.LASF2645
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x79
+	.long	0xf7b
+	.uleb128 0xa
+	.long	0x736
+	.uleb128 0x19
+	.long	.LASF2646
+	.byte	0xa
+	.byte	0x62
+	.byte	0x83
+	.long	0xf8c
+	.uleb128 0xa
+	.long	0x6d9
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 26 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.file 29 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 31 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 32 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 55 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x37
+	.file 56 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 57 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.file 59 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1411
+	.byte	0x4
+	.file 60 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1412
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.file 61 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x4
+	.file 64 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x8
+	.file 65 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.file 66 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x42
+	.byte	0x4
+	.file 67 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 68 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x44
+	.byte	0x4
+	.file 69 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x45
+	.file 70 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x46
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 71 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x47
+	.file 72 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 73 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1965
+	.byte	0x4
+	.file 74 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 76 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 77 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1975
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 78 "./src/main/fc/fc_rc.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 79 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xc
+	.byte	0x4
+	.file 80 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x50
+	.byte	0x4
+	.file 81 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x51
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2019
+	.byte	0x4
+	.file 82 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x15
+	.file 83 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2023
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2024
+	.byte	0x4
+	.file 84 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x54
+	.file 85 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 86 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x56
+	.file 87 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x57
+	.byte	0x4
+	.byte	0x4
+	.file 88 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x58
+	.file 89 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x17
+	.file 90 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5a
+	.byte	0x4
+	.file 91 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xf
+	.file 92 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5c
+	.file 93 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5d
+	.byte	0x4
+	.file 94 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 95 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2129
+	.file 96 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2131
+	.byte	0x4
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2132
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2141
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2146
+	.byte	0x4
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 104 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2179
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2180
+	.byte	0x4
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2181
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2182
+	.byte	0x4
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2183
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2184
+	.byte	0x4
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2185
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x70
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2186
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2187
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2199
+	.byte	0x4
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2206
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2207
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2208
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2211
+	.byte	0x4
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x78
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2212
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1437
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1441
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1584
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1596
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1971
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1974
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1991
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2018
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dashboard.h.22.499b1990b01ce2b674fe8b48758244f0,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2032
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2038
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2138
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2140
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2205
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2210
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2233
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2242
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2284
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x16
+	.long	.LASF1
+	.long	.LASF2650
+	.long	.LASF2651
+	.long	.LASF2652
+	.long	.LASF2653
+	.long	.LASF2654
+	.long	.LASF2655
+	.long	.LASF2656
+	.long	.LASF2657
+	.long	.LASF2658
+	.long	.LASF2659
+	.long	.LASF2660
+	.long	.LASF2661
+	.long	.LASF2662
+	.long	.LASF2663
+	.long	.LASF2664
+	.long	.LASF2665
+	.long	.LASF2666
+	.long	.LASF2667
+	.long	.LASF2668
+	.long	.LASF2669
+	.long	.LASF2670
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x7a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2671
+	.byte	0x11
+	.long	.LASF2672
+	.byte	0x11
+	.long	.LASF2673
+	.byte	0x11
+	.long	.LASF2674
+	.byte	0x15
+	.long	.LASF2675
+	.byte	0x4
+	.long	.LASF2676
+	.byte	0x7
+	.long	.LASF2677
+	.byte	0x7
+	.long	.LASF2678
+	.byte	0x8
+	.long	.LASF2679
+	.byte	0x9
+	.long	.LASF2680
+	.byte	0x8
+	.long	.LASF2681
+	.byte	0x8
+	.long	.LASF2682
+	.byte	0xa
+	.long	.LASF2683
+	.byte	0x8
+	.long	.LASF2684
+	.byte	0xc
+	.long	.LASF2685
+	.byte	0xc
+	.long	.LASF2686
+	.byte	0xb
+	.long	.LASF2687
+	.byte	0xd
+	.long	.LASF2688
+	.byte	0x8
+	.long	.LASF2689
+	.byte	0x14
+	.long	.LASF2690
+	.byte	0x8
+	.long	.LASF2691
+	.byte	0xc
+	.long	.LASF2692
+	.byte	0x9
+	.long	.LASF2693
+	.byte	0xc
+	.long	.LASF2694
+	.byte	0x9
+	.long	.LASF2695
+	.byte	0x4
+	.long	.LASF2696
+	.byte	0x14
+	.long	.LASF2697
+	.byte	0x15
+	.long	.LASF2698
+	.byte	0x15
+	.long	.LASF2698
+	.byte	0x14
+	.long	.LASF2699
+	.byte	0x11
+	.long	.LASF2700
+	.byte	0x14
+	.long	.LASF2701
+	.byte	0x14
+	.long	.LASF2702
+	.byte	0x11
+	.long	.LASF2703
+	.byte	0x11
+	.long	.LASF2704
+	.byte	0x13
+	.long	.LASF2705
+	.byte	0x11
+	.long	.LASF2706
+	.byte	0x12
+	.long	.LASF2707
+	.byte	0x12
+	.long	.LASF2708
+	.byte	0x11
+	.long	.LASF2709
+	.byte	0x11
+	.long	.LASF2710
+	.byte	0x11
+	.long	.LASF2711
+	.byte	0x10
+	.long	.LASF2712
+	.byte	0x10
+	.long	.LASF2713
+	.byte	0x14
+	.long	.LASF2714
+	.byte	0x14
+	.long	.LASF2715
+	.byte	0x11
+	.long	.LASF2716
+	.byte	0x11
+	.long	.LASF2717
+	.byte	0x11
+	.long	.LASF2718
+	.byte	0x11
+	.long	.LASF2719
+	.byte	0x11
+	.long	.LASF2720
+	.byte	0x11
+	.long	.LASF2721
+	.byte	0x11
+	.long	.LASF2722
+	.byte	0x11
+	.long	.LASF2723
+	.byte	0x11
+	.long	.LASF2724
+	.byte	0xf
+	.long	.LASF2725
+	.byte	0xe
+	.long	.LASF2726
+	.byte	0xe
+	.long	.LASF2727
+	.byte	0x1
+	.long	.LASF2728
+	.byte	0x1
+	.long	.LASF2729
+	.byte	0x3
+	.long	.LASF2730
+	.byte	0x2
+	.long	.LASF2731
+	.byte	0x3
+	.long	.LASF2732
+	.byte	0x3
+	.long	.LASF2733
+	.byte	0x4
+	.long	.LASF2734
+	.byte	0x7
+	.long	.LASF2735
+	.byte	0x7
+	.long	.LASF2736
+	.byte	0x7
+	.long	.LASF2737
+	.byte	0x7
+	.long	.LASF2738
+	.byte	0x7
+	.long	.LASF2739
+	.byte	0x7
+	.long	.LASF2740
+	.byte	0x7
+	.long	.LASF2741
+	.byte	0x3
+	.long	.LASF2742
+	.byte	0x7
+	.long	.LASF2743
+	.byte	0x7
+	.long	.LASF2744
+	.byte	0x7
+	.long	.LASF2745
+	.byte	0x7
+	.long	.LASF2746
+	.byte	0x7
+	.long	.LASF2747
+	.byte	0x8
+	.long	.LASF2748
+	.byte	0xa
+	.long	.LASF2749
+	.byte	0xa
+	.long	.LASF2750
+	.byte	0xa
+	.long	.LASF2751
+	.byte	0xa
+	.long	.LASF2691
+	.byte	0x6
+	.long	.LASF2752
+	.byte	0xc
+	.long	.LASF2753
+	.byte	0x3
+	.long	.LASF2754
+	.byte	0xc
+	.long	.LASF2755
+	.byte	0xc
+	.long	.LASF2756
+	.byte	0xc
+	.long	.LASF2757
+	.byte	0xc
+	.long	.LASF2758
+	.byte	0x7
+	.long	.LASF2759
+	.byte	0x7
+	.long	.LASF2760
+	.byte	0x5
+	.long	.LASF2761
+	.byte	0x7
+	.long	.LASF2762
+	.byte	0x5
+	.long	.LASF2763
+	.byte	0x14
+	.long	.LASF2764
+	.byte	0x14
+	.long	.LASF2765
+	.byte	0x10
+	.long	.LASF2766
+	.byte	0x10
+	.long	.LASF2767
+	.byte	0x11
+	.long	.LASF2768
+	.byte	0x11
+	.long	.LASF2764
+	.byte	0x11
+	.long	.LASF2769
+	.byte	0x10
+	.long	.LASF2770
+	.byte	0x11
+	.long	.LASF2729
+	.byte	0x14
+	.long	.LASF2729
+	.byte	0x11
+	.long	.LASF2771
+	.byte	0x10
+	.long	.LASF2772
+	.byte	0x10
+	.long	.LASF2773
+	.byte	0x10
+	.long	.LASF2774
+	.byte	0x10
+	.long	.LASF2775
+	.byte	0x10
+	.long	.LASF2776
+	.byte	0x11
+	.long	.LASF2777
+	.byte	0x11
+	.long	.LASF2778
+	.byte	0x11
+	.long	.LASF2779
+	.byte	0x11
+	.long	.LASF2780
+	.byte	0x11
+	.long	.LASF2781
+	.byte	0x11
+	.long	.LASF2782
+	.byte	0x11
+	.long	.LASF2783
+	.byte	0x10
+	.long	.LASF2784
+	.byte	0x10
+	.long	.LASF2785
+	.byte	0x11
+	.long	.LASF2786
+	.byte	0x11
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1956:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2198:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1728:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2457:
+	.string	"auto_disarm_delay"
+.LASF1980:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1712:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2014:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1592:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1786:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1732:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF2424:
+	.string	"THROTTLE"
+.LASF1603:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2078:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF2529:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2385:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1446:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1638:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF2162:
+	.string	"sched_priority sched_priority"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF2050:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF2045:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF2592:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2366:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1806:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1601:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1859:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2100:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF2068:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF2141:
+	.string	"__pid_t_defined "
+.LASF2133:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1412:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1420:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1940:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2636:
+	.string	"rcDisarmTicks"
+.LASF2525:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2290:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2163:
+	.string	"__sched_priority sched_priority"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1680:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2306:
+	.string	"_Bool"
+.LASF2563:
+	.string	"spektrum_sat_bind"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1965:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1805:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF1565:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1551:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2148:
+	.string	"__CPU_SETSIZE 1024"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2172:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2327:
+	.string	"OWNER_ADC_CURR"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF700:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1659:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1820:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2646:
+	.string	"flight3DConfig"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2222:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2017:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2479:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1765:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1555:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2237:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1665:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2118:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2266:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1883:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1783:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2456:
+	.string	"disarm_kill_switch"
+.LASF2580:
+	.string	"rxConfig_System"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2075:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1996:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF2567:
+	.string	"rssi_invert"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1952:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2450:
+	.string	"deadband3d_throttle"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1503:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1495:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1791:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1775:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1924:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2120:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1459:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2324:
+	.string	"OWNER_LED"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1623:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1640:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1731:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2375:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2301:
+	.string	"uint16_t"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF2557:
+	.string	"halfDuplex"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2152:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2077:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1891:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1661:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1735:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1870:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2272:
+	.string	"PIDSUM_LIMIT 500"
+.LASF1974:
+	.string	"BEEP_ON do {} while (0)"
+.LASF2629:
+	.string	"getRcStickDeflection"
+.LASF1858:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1844:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1585:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF2108:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1499:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1834:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1491:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1463:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2438:
+	.string	"yaw_deadband"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1476:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2242:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1580:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2466:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2484:
+	.string	"BEEPER_READY_BEEP"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2246:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1611:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2146:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2026:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2145:
+	.string	"SCHED_RR 2"
+.LASF1483:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2329:
+	.string	"OWNER_ADC_RSSI"
+.LASF1976:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1915:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2263:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2515:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2618:
+	.string	"gyroStartCalibration"
+.LASF1265:
+	.string	"CMS "
+.LASF1825:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2083:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1923:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2583:
+	.string	"PID_YAW"
+.LASF2539:
+	.string	"SENSOR_BARO"
+.LASF1816:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1879:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1951:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2331:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2350:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2249:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1437:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1619:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1558:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1577:
+	.string	"BIT(x) (1 << (x))"
+.LASF2355:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1547:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2614:
+	.string	"baroSetCalibrationCycles"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2299:
+	.string	"int32_t"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1566:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2101:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1734:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2363:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1873:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2268:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1590:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1434:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1643:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1994:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF1746:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1719:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF2044:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2352:
+	.string	"OWNER_BARO_EXTI"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1504:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2258:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1738:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1599:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1955:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2550:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1576:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2330:
+	.string	"OWNER_SERIAL_TX"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2498:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1496:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF1509:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2310:
+	.string	"PGR_SIZE_MASK"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF2191:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1703:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1666:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1910:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2168:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF2122:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF2373:
+	.string	"FEATURE_FAILSAFE"
+.LASF1972:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF2166:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2638:
+	.string	"accelerometerTrimsDelta"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF1853:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF2055:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF2491:
+	.string	"BEEPER_PREFERENCE"
+.LASF1707:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1918:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2508:
+	.string	"BOXLEDLOW"
+.LASF2553:
+	.string	"rxConfig_s"
+.LASF2579:
+	.string	"rxConfig_t"
+.LASF2353:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1744:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2639:
+	.string	"shouldApplyRollAndPitchTrimDelta"
+.LASF2616:
+	.string	"saveConfigAndNotify"
+.LASF1528:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF2365:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1432:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1916:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2042:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1600:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF2495:
+	.string	"BOXHORIZON"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1569:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2562:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF2401:
+	.string	"pidSumLimit"
+.LASF2408:
+	.string	"horizon_tilt_effect"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1993:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2565:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1660:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1797:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2236:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1835:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2390:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1471:
+	.string	"PG_PID_PROFILE 14"
+.LASF2396:
+	.string	"dterm_lpf_hz"
+.LASF1759:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2560:
+	.string	"rx_spi_rf_channel_count"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2221:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2377:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2449:
+	.string	"neutral3d"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2600:
+	.string	"airmodeWasActivated"
+.LASF2509:
+	.string	"BOXLLIGHTS"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2335:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2058:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1876:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2374:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2575:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1488:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1532:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1966:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1567:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2323:
+	.string	"OWNER_SERVO"
+.LASF1579:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF2460:
+	.string	"armingConfig_Copy"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2161:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2049:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2619:
+	.string	"beeper"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF2471:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF2481:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1999:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF2234:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1687:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2020:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2623:
+	.string	"resetArmingDisabled"
+.LASF1633:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1721:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1998:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2556:
+	.string	"sbus_inversion"
+.LASF2062:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2637:
+	.string	"stTmp"
+.LASF1426:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1620:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1847:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2547:
+	.string	"roll"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2568:
+	.string	"midrc"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2035:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2243:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2291:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2399:
+	.string	"dterm_notch_cutoff"
+.LASF2250:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2293:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1988:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF2606:
+	.string	"armingConfig_Registry"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2322:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1963:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1771:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1668:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF2116:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2349:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2196:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2015:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF2099:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1973:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2417:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF2386:
+	.string	"FEATURE_AIRMODE"
+.LASF2558:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1679:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1443:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1718:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2433:
+	.string	"THROTTLE_LOW"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2013:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2534:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2533:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2542:
+	.string	"SENSOR_GPS"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2129:
+	.string	"_PTHREAD_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1784:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1740:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2169:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1564:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1533:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2227:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1602:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2285:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1618:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2369:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2165:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1747:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2368:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1543:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1546:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2036:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF1808:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF1489:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF364:
+	.string	"__k8 1"
+.LASF2559:
+	.string	"rx_spi_id"
+.LASF1472:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF1983:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2304:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1467:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2645:
+	.string	"armingConfig"
+.LASF1624:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2493:
+	.string	"BOXARM"
+.LASF2149:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1772:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2574:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF1714:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1722:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF2569:
+	.string	"mincheck"
+.LASF1523:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2238:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2617:
+	.string	"GPS_reset_home_position"
+.LASF1690:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF1553:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1636:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2510:
+	.string	"BOXCALIB"
+.LASF2393:
+	.string	"pgRegistry_s"
+.LASF2317:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2371:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1414:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2115:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2063:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2223:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1439:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2506:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF2218:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF380:
+	.string	"__unix 1"
+.LASF1671:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2361:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1593:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF2425:
+	.string	"AUX1"
+.LASF2426:
+	.string	"AUX2"
+.LASF2427:
+	.string	"AUX3"
+.LASF2428:
+	.string	"AUX4"
+.LASF2429:
+	.string	"AUX5"
+.LASF2430:
+	.string	"AUX6"
+.LASF2431:
+	.string	"AUX7"
+.LASF2432:
+	.string	"AUX8"
+.LASF1474:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2392:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2570:
+	.string	"maxcheck"
+.LASF2031:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2480:
+	.string	"BEEPER_RX_SET"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF1705:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2220:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2476:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF2072:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2247:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2344:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1912:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1922:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2215:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF2039:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1616:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1573:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF2470:
+	.string	"BEEPER_SILENCE"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2635:
+	.string	"rcSticks"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2489:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1683:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2409:
+	.string	"horizon_tilt_expert_mode"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1807:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1621:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1710:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1727:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2079:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1450:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1652:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2531:
+	.string	"boxId_e"
+.LASF2308:
+	.string	"PGR_PGN_MASK"
+.LASF2516:
+	.string	"BOXSERVO1"
+.LASF2517:
+	.string	"BOXSERVO2"
+.LASF2518:
+	.string	"BOXSERVO3"
+.LASF2112:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1856:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2388:
+	.string	"FEATURE_RX_SPI"
+.LASF1656:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2209:
+	.string	"____sigset_t_defined "
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2033:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1942:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1871:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1494:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1969:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1954:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1882:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1604:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1530:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1711:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1608:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1978:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2057:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1971:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF2153:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF2041:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2261:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF2435:
+	.string	"throttleStatus_e"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2354:
+	.string	"OWNER_USB_DETECT"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1903:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2095:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1550:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2082:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2313:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1933:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1651:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2564:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1514:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2578:
+	.string	"rx_max_usec"
+.LASF1419:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2492:
+	.string	"beeperMode_e"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2123:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1663:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1946:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2381:
+	.string	"FEATURE_DASHBOARD"
+.LASF2630:
+	.string	"pidProfileToUse"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1422:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2358:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2303:
+	.string	"size_t"
+.LASF2175:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2253:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2339:
+	.string	"OWNER_SPI_MOSI"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1925:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2312:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2300:
+	.string	"uint8_t"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2269:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1686:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1713:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2199:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1571:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2535:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2621:
+	.string	"failsafeIsActive"
+.LASF1754:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF2461:
+	.string	"ARMED"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2080:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1626:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF2594:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF2423:
+	.string	"PITCH"
+.LASF1796:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"VERY_FAST_MATH "
+.LASF1673:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF2612:
+	.string	"accSetCalibrationCycles"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2582:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2081:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF2607:
+	.string	"pgResetTemplate_flight3DConfig"
+.LASF1541:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2130:
+	.string	"_SCHED_H 1"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1864:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2229:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF1777:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2367:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF2483:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF2160:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1730:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF2271:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1430:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF2351:
+	.string	"OWNER_MPU_EXTI"
+.LASF1985:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF2154:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1591:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2321:
+	.string	"OWNER_PPMINPUT"
+.LASF2318:
+	.string	"ioTag_t"
+.LASF1556:
+	.string	"IOCFG_IPD 0"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2406:
+	.string	"levelAngleLimit"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2027:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1413:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2631:
+	.string	"axis"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1492:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF1881:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2632:
+	.string	"processRcStickPositions"
+.LASF2552:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1888:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF1685:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1622:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1724:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1970:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1708:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1745:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2244:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1818:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2117:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1518:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1648:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2566:
+	.string	"rssi_scale"
+.LASF1482:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1709:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1429:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1487:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2628:
+	.string	"useRcControlsConfig"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2255:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2164:
+	.string	"_TIME_H 1"
+.LASF1672:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2207:
+	.string	"__have_pthread_attr_t 1"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF1749:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2588:
+	.string	"PID_LEVEL"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2135:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2173:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2283:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2524:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1606:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1725:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1689:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1716:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1960:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1531:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF1855:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1552:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1629:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1900:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2571:
+	.string	"rcInterpolation"
+.LASF2595:
+	.string	"pidCrashRecovery_e"
+.LASF2541:
+	.string	"SENSOR_SONAR"
+.LASF1625:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2522:
+	.string	"BOX3DDISABLE"
+.LASF1545:
+	.string	"IO_TAG_NONE 0"
+.LASF2219:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1423:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2384:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1984:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2241:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1595:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF1842:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2043:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1529:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2538:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2334:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2143:
+	.string	"SCHED_OTHER 0"
+.LASF2314:
+	.string	"address"
+.LASF1457:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1780:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1840:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1742:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1726:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1981:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF2054:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1557:
+	.string	"IOCFG_IPU 0"
+.LASF1755:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF721:
+	.string	"NULL"
+.LASF1411:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2464:
+	.string	"GPS_FIX_HOME"
+.LASF2142:
+	.string	"_BITS_SCHED_H 1"
+.LASF2387:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1948:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2548:
+	.string	"pitch"
+.LASF2336:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1681:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF468:
+	.string	"__PMT"
+.LASF1605:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2572:
+	.string	"rcInterpolationChannels"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2585:
+	.string	"PID_POS"
+.LASF2197:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2415:
+	.string	"rateAccelLimit"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2394:
+	.string	"pidProfile_s"
+.LASF2598:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2064:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2103:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1506:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1939:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2640:
+	.string	"calculateThrottleStatus"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2444:
+	.string	"rcControlsConfig_System"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2463:
+	.string	"armingFlags"
+.LASF1892:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2002:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1769:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2311:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1464:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1934:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2602:
+	.string	"isUsingSticksToArm"
+.LASF2494:
+	.string	"BOXANGLE"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1898:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF2603:
+	.string	"pgResetTemplate_rcControlsConfig"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1702:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"UNIT_TESTED "
+.LASF2626:
+	.string	"feature"
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2194:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1823:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF2032:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2389:
+	.string	"FEATURE_SOFTSPI"
+.LASF1658:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2105:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2192:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1715:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2486:
+	.string	"BEEPER_ARMED"
+.LASF1435:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2647:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF2012:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1458:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2051:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1427:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2610:
+	.string	"memset"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1634:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2403:
+	.string	"dterm_average_count"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1736:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1906:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2624:
+	.string	"tryArm"
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1995:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1674:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF2030:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2010:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1843:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1729:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2186:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2404:
+	.string	"vbatPidCompensation"
+.LASF2097:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2181:
+	.string	"__clockid_t_defined 1"
+.LASF2641:
+	.string	"areSticksInApModePosition"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2226:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2465:
+	.string	"GPS_FIX"
+.LASF1613:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2443:
+	.string	"rcCommand"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2452:
+	.string	"flight3DConfig_System"
+.LASF1578:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2193:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1438:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2511:
+	.string	"BOXGOV"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2490:
+	.string	"BEEPER_ALL"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1654:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1614:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2605:
+	.string	"pgResetTemplate_armingConfig"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF2281:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1989:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2462:
+	.string	"WAS_EVER_ARMED"
+.LASF1756:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"reset"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2073:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1465:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2085:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2478:
+	.string	"BEEPER_BAT_LOW"
+.LASF1561:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2342:
+	.string	"OWNER_SDCARD"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF2089:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF2046:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1943:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1505:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2128:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2298:
+	.string	"int16_t"
+.LASF1695:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2286:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2037:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2289:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1421:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1635:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF1886:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1473:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1991:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2131:
+	.string	"__time_t_defined 1"
+.LASF2379:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2467:
+	.string	"SMALL_ANGLE"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1442:
+	.string	"sq(x) ((x)*(x))"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2212:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1581:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1849:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2206:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2474:
+	.string	"BEEPER_DISARMING"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1867:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2231:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF2003:
+	.string	"LAT 0"
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1697:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2251:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2185:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2501:
+	.string	"BOXCAMSTAB"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2248:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2488:
+	.string	"BEEPER_USB"
+.LASF1982:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1481:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF2540:
+	.string	"SENSOR_MAG"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2190:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2599:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1792:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2521:
+	.string	"BOXAIRMODE"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2555:
+	.string	"serialrx_provider"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1485:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2184:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF2611:
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2233:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1644:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1540:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2356:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1646:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1827:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2309:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1907:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2224:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF1490:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2094:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2071:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1524:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2499:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1609:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1753:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2000:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2025:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2633:
+	.string	"throttleStatus"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1589:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1800:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2604:
+	.string	"rcControlsConfig_Registry"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF1979:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2276:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1440:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1424:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2411:
+	.string	"itermAcceleratorGain"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF2419:
+	.string	"crash_recovery_angle"
+.LASF2183:
+	.string	"__itimerspec_defined 1"
+.LASF2587:
+	.string	"PID_NAVR"
+.LASF1698:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1810:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1967:
+	.string	"I2CDEV_COUNT 4"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2018:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1615:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2107:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1537:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1813:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF2382:
+	.string	"FEATURE_OSD"
+.LASF2023:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1510:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2315:
+	.string	"copy"
+.LASF1285:
+	.string	"GPS "
+.LASF2024:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1583:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2469:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1596:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1484:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1889:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF2296:
+	.string	"long int"
+.LASF2526:
+	.string	"BOXCAMERA2"
+.LASF2527:
+	.string	"BOXCAMERA3"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1477:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF1781:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2067:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF2189:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2275:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1522:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1607:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2005:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1454:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2240:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2332:
+	.string	"OWNER_PINDEBUG"
+.LASF1986:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2022:
+	.string	"DASHBOARD_I2C_ADDRESS 0x3C"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1930:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2421:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1764:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1700:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2512:
+	.string	"BOXOSD"
+.LASF1997:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF2009:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1535:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1657:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2520:
+	.string	"BOXFAILSAFE"
+.LASF2171:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF2182:
+	.string	"__timer_t_defined 1"
+.LASF1676:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF2158:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF2132:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2157:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF2180:
+	.string	"__struct_tm_defined 1"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1302:
+	.string	"ACC "
+.LASF1795:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2514:
+	.string	"BOXGTUNE"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1829:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1627:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1562:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2065:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1570:
+	.string	"EXPAND_I(x) x"
+.LASF1436:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1789:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2195:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2257:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2302:
+	.string	"uint32_t"
+.LASF2126:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF1433:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1904:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF2179:
+	.string	"__clock_t_defined 1"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2497:
+	.string	"BOXANTIGRAVITY"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1804:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1868:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2459:
+	.string	"armingConfig_System"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1803:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2216:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1913:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2210:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2326:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2504:
+	.string	"BOXGPSHOLD"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1831:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2454:
+	.string	"armingConfig_s"
+.LASF2458:
+	.string	"armingConfig_t"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1521:
+	.string	"PG_PID_CONFIG 504"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1874:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2519:
+	.string	"BOXBLACKBOX"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF2288:
+	.string	"long unsigned int"
+.LASF2170:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2500:
+	.string	"BOXHEADADJ"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1500:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2217:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1460:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2453:
+	.string	"flight3DConfig_Copy"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1788:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2127:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2503:
+	.string	"BOXGPSHOME"
+.LASF2402:
+	.string	"pidSumLimitYaw"
+.LASF2333:
+	.string	"OWNER_TIMER"
+.LASF1684:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1501:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1862:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2413:
+	.string	"dtermSetpointWeight"
+.LASF2445:
+	.string	"rcControlsConfig_Copy"
+.LASF1637:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1838:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1897:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2297:
+	.string	"char"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2104:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1968:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2178:
+	.string	"TIMER_ABSTIME 1"
+.LASF2416:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1959:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF1819:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1554:
+	.string	"IOCFG_AF_PP 0"
+.LASF1987:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1649:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1814:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2507:
+	.string	"BOXLEDMAX"
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1641:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1544:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1768:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2407:
+	.string	"levelSensitivity"
+.LASF2345:
+	.string	"OWNER_FLASH_CS"
+.LASF2208:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF1798:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1833:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1706:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2019:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2615:
+	.string	"sensors"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF2096:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2496:
+	.string	"BOXBARO"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2228:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1773:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2034:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF2254:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2061:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2422:
+	.string	"ROLL"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF2070:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1493:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2581:
+	.string	"PID_ROLL"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1568:
+	.string	"STR_HELPER(x) #x"
+.LASF2205:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1737:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF1750:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2177:
+	.string	"CLOCK_TAI 11"
+.LASF2370:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2643:
+	.string	"isUsingSticksForArming"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2337:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1415:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2059:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1861:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1760:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2156:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2001:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1799:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2167:
+	.string	"CLOCK_REALTIME 0"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1587:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1678:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2200:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF2487:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2265:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1536:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF377:
+	.string	"__linux 1"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1841:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2472:
+	.string	"BEEPER_RX_LOST"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1787:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2420:
+	.string	"crash_recovery_rate"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1757:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2278:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2203:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1751:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1539:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1559:
+	.string	"NOOP do {} while (0)"
+.LASF1670:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2098:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1936:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF2202:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1958:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2549:
+	.string	"rollAndPitchTrims_t_def"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2282:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1475:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2642:
+	.string	"ap_mode"
+.LASF2138:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF2513:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1770:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF491:
+	.string	"__flexarr []"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1776:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1693:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1511:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1575:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1431:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1582:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1811:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1513:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1675:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1809:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF1852:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2305:
+	.string	"double"
+.LASF1597:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1628:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2088:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1574:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2280:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2087:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1682:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2340:
+	.string	"OWNER_I2C_SCL"
+.LASF2338:
+	.string	"OWNER_SPI_MISO"
+.LASF1639:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2362:
+	.string	"OWNER_COMPASS_CS"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF2279:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF1763:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2091:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2139:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1461:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2378:
+	.string	"FEATURE_RX_MSP"
+.LASF2398:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2573:
+	.string	"rcInterpolationInterval"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2648:
+	.string	"rc_alias"
+.LASF2232:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2372:
+	.string	"FEATURE_GPS"
+.LASF2400:
+	.string	"itermWindupPointPercent"
+.LASF1927:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2052:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2436:
+	.string	"rcControlsConfig_s"
+.LASF2442:
+	.string	"rcControlsConfig_t"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1538:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2530:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2294:
+	.string	"__int32_t"
+.LASF2644:
+	.string	"rxConfig"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2341:
+	.string	"OWNER_I2C_SDA"
+.LASF2267:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2295:
+	.string	"__uint32_t"
+.LASF2439:
+	.string	"alt_hold_deadband"
+.LASF1452:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF2093:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1865:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1548:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2380:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1478:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1456:
+	.string	"Q12 (1 << 12)"
+.LASF1790:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2625:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2106:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1908:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1669:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1480:
+	.string	"PG_RX_CONFIG 24"
+.LASF1507:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1425:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2277:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2468:
+	.string	"FIXED_WING"
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF1534:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF2140:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1945:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2260:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1664:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2136:
+	.string	"__PDP_ENDIAN 3412"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF1594:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF1961:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1885:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2593:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF1962:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1741:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2201:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2477:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF1694:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1894:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2174:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1779:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2357:
+	.string	"OWNER_RX_BIND"
+.LASF1512:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1850:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2360:
+	.string	"OWNER_TRANSPONDER"
+.LASF1479:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2038:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2092:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2125:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1696:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2084:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1642:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2561:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF2412:
+	.string	"setpointRelaxRatio"
+.LASF1448:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF1822:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1761:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF2150:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2523:
+	.string	"BOXFPVANGLEMIX"
+.LASF2151:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2176:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1650:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2448:
+	.string	"deadband3d_high"
+.LASF1662:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2544:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1515:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2270:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1846:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2347:
+	.string	"OWNER_MPU_CS"
+.LASF2307:
+	.string	"pgn_t"
+.LASF1526:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2225:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2245:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1909:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2252:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2004:
+	.string	"LON 1"
+.LASF2441:
+	.string	"yaw_control_reversed"
+.LASF2482:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1306:
+	.string	"MAG "
+.LASF2473:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF2609:
+	.string	"isModeActivationConditionPresent"
+.LASF2546:
+	.string	"rollAndPitchTrims_s"
+.LASF2551:
+	.string	"rollAndPitchTrims_t"
+.LASF2649:
+	.string	"rollAndPitchTrims_u"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1928:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2405:
+	.string	"pidAtMinThrottle"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2137:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2214:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1612:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1462:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1451:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1584:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2586:
+	.string	"PID_POSR"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1774:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1793:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1739:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2627:
+	.string	"handleInflightCalibrationStickPosition"
+.LASF1519:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2319:
+	.string	"OWNER_FREE"
+.LASF2053:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1630:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF2086:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2395:
+	.string	"dterm_filter_type"
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2590:
+	.string	"PID_VEL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2622:
+	.string	"rxIsReceivingSignal"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1441:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1701:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2577:
+	.string	"rx_min_usec"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2446:
+	.string	"flight3DConfig_s"
+.LASF2451:
+	.string	"flight3DConfig_t"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1782:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2613:
+	.string	"changePidProfile"
+.LASF1542:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2320:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1717:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2235:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF2040:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1667:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2011:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2069:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2066:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1416:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2144:
+	.string	"SCHED_FIFO 1"
+.LASF2028:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF2187:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2007:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1699:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1645:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2109:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2284:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF2047:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1653:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2273:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2188:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF2418:
+	.string	"crash_time"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1826:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1949:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2155:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1486:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2102:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2134:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2029:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1632:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2545:
+	.string	"long long int"
+.LASF1837:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1549:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2264:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2376:
+	.string	"FEATURE_3D"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2060:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1466:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2343:
+	.string	"OWNER_SDCARD_CS"
+.LASF2634:
+	.string	"rcDelayCommand"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2110:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1418:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1872:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1455:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2008:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2554:
+	.string	"rcmap"
+.LASF2537:
+	.string	"SENSOR_GYRO"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1610:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2090:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2485:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF2211:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1498:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1598:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2113:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1931:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1817:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1877:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2213:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2239:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2121:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2528:
+	.string	"BOXDSHOTREVERSE"
+.LASF2601:
+	.string	"pidProfile"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1655:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1977:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2440:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1527:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2364:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1828:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2620:
+	.string	"disarm"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2204:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2434:
+	.string	"THROTTLE_HIGH"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2006:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1688:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF1586:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2359:
+	.string	"OWNER_LED_STRIP"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2589:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2256:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF2591:
+	.string	"PID_ITEM_COUNT"
+.LASF29:
+	.string	"_LP64 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1785:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF2230:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2056:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2536:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1470:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1762:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2414:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2021:
+	.string	"DASHBOARD_I2C_INSTANCE I2CDEV_1"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2111:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1508:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2114:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2455:
+	.string	"gyro_cal_on_first_arm"
+.LASF2397:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1428:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2584:
+	.string	"PID_ALT"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2119:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2124:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2346:
+	.string	"OWNER_BARO_CS"
+.LASF1766:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2475:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2447:
+	.string	"deadband3d_low"
+.LASF1517:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1447:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2576:
+	.string	"airModeActivateThreshold"
+.LASF2074:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2287:
+	.string	"unsigned int"
+.LASF2532:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF1469:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1964:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2147:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1957:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1588:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1857:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2076:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2391:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF1895:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1677:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2505:
+	.string	"BOXPASSTHRU"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF2543:
+	.string	"SENSOR_GPSMAG"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1525:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1832:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2325:
+	.string	"OWNER_ADC"
+.LASF2292:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2159:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF2437:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2410:
+	.string	"itermThrottleThreshold"
+.LASF2502:
+	.string	"BOXCAMTRIG"
+.LASF1863:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2608:
+	.string	"flight3DConfig_Registry"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF1880:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2383:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2048:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF1560:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1631:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2328:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1778:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1516:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2274:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1794:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2348:
+	.string	"OWNER_OSD_CS"
+.LASF2262:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1921:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2596:
+	.string	"pid8_s"
+.LASF2597:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1801:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF1704:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1691:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1937:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1572:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1975:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2736:
+	.string	"rx_pwm.h"
+.LASF2777:
+	.string	"thread-shared-types.h"
+.LASF2716:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2669:
+	.string	"/usr/include"
+.LASF2722:
+	.string	"mathcalls-helper-functions.h"
+.LASF2757:
+	.string	"voltage_ids.h"
+.LASF2768:
+	.string	"endianness.h"
+.LASF2718:
+	.string	"floatn-common.h"
+.LASF2698:
+	.string	"stdint.h"
+.LASF2786:
+	.string	"pthread_stack_min.h"
+.LASF2651:
+	.string	"src/main/build"
+.LASF2666:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2691:
+	.string	"barometer.h"
+.LASF2697:
+	.string	"stdbool.h"
+.LASF2735:
+	.string	"flash.h"
+.LASF2729:
+	.string	"time.h"
+.LASF2702:
+	.string	"wordsize.h"
+.LASF2770:
+	.string	"cpu-set.h"
+.LASF2758:
+	.string	"bus.h"
+.LASF2692:
+	.string	"navigation.h"
+.LASF2662:
+	.string	"src/main/target/SITL"
+.LASF2723:
+	.string	"mathcalls.h"
+.LASF2760:
+	.string	"accgyro.h"
+.LASF2690:
+	.string	"fc_core.h"
+.LASF2745:
+	.string	"sound_beeper.h"
+.LASF2750:
+	.string	"vtx_control.h"
+.LASF2739:
+	.string	"io.h"
+.LASF2699:
+	.string	"libc-header-start.h"
+.LASF2774:
+	.string	"timer_t.h"
+.LASF2784:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2747:
+	.string	"fc_rc.h"
+.LASF2724:
+	.string	"platform.h"
+.LASF2670:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2655:
+	.string	"src/main/drivers/barometer"
+.LASF2727:
+	.string	"blackbox.h"
+.LASF2677:
+	.string	"resource.h"
+.LASF2779:
+	.string	"atomic_wide_counter.h"
+.LASF2658:
+	.string	"src/main/flight"
+.LASF2773:
+	.string	"clockid_t.h"
+.LASF2696:
+	.string	"stdc-predef.h"
+.LASF2737:
+	.string	"sdcard.h"
+.LASF2714:
+	.string	"math.h"
+.LASF2665:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2753:
+	.string	"filter.h"
+.LASF2700:
+	.string	"features.h"
+.LASF2664:
+	.string	"src/main"
+.LASF2659:
+	.string	"src/main/io"
+.LASF2715:
+	.string	"math-vector.h"
+.LASF2771:
+	.string	"clock_t.h"
+.LASF2772:
+	.string	"struct_tm.h"
+.LASF2653:
+	.string	"src/main/config"
+.LASF2775:
+	.string	"struct_itimerspec.h"
+.LASF2701:
+	.string	"features-time64.h"
+.LASF2713:
+	.string	"strings.h"
+.LASF2695:
+	.string	"feature.h"
+.LASF2654:
+	.string	"src/main/drivers/accgyro"
+.LASF2682:
+	.string	"beeper.h"
+.LASF2781:
+	.string	"struct_rwlock.h"
+.LASF2681:
+	.string	"runtime_config.h"
+.LASF2678:
+	.string	"config.h"
+.LASF2720:
+	.string	"fp-logb.h"
+.LASF2693:
+	.string	"gyro.h"
+.LASF2709:
+	.string	"time64.h"
+.LASF2689:
+	.string	"string.h"
+.LASF2687:
+	.string	"target.h"
+.LASF2776:
+	.string	"pthreadtypes.h"
+.LASF2740:
+	.string	"io_def.h"
+.LASF2725:
+	.string	"common_fc_pre.h"
+.LASF2732:
+	.string	"maths.h"
+.LASF2733:
+	.string	"parameter_group_ids.h"
+.LASF2710:
+	.string	"wchar.h"
+.LASF2703:
+	.string	"timesize.h"
+.LASF2652:
+	.string	"src/main/common"
+.LASF2756:
+	.string	"voltage.h"
+.LASF2686:
+	.string	"rx.h"
+.LASF2754:
+	.string	"current.h"
+.LASF2694:
+	.string	"failsafe.h"
+.LASF2744:
+	.string	"rcc_types.h"
+.LASF2782:
+	.string	"setjmp.h"
+.LASF2748:
+	.string	"gps.h"
+.LASF2765:
+	.string	"time_t.h"
+.LASF2685:
+	.string	"acceleration.h"
+.LASF2674:
+	.string	"stddef.h"
+.LASF2721:
+	.string	"fp-fast.h"
+.LASF2657:
+	.string	"src/main/fc"
+.LASF2717:
+	.string	"floatn.h"
+.LASF2743:
+	.string	"bus_i2c.h"
+.LASF2707:
+	.string	"stubs-64.h"
+.LASF2706:
+	.string	"stubs.h"
+.LASF2675:
+	.string	"parameter_group.h"
+.LASF2679:
+	.string	"pid.h"
+.LASF2742:
+	.string	"io_def_generated.h"
+.LASF2755:
+	.string	"current_ids.h"
+.LASF2769:
+	.string	"struct_sched_param.h"
+.LASF2761:
+	.string	"exti.h"
+.LASF2684:
+	.string	"sensors.h"
+.LASF2746:
+	.string	"vcd.h"
+.LASF2762:
+	.string	"accgyro_mpu.h"
+.LASF2683:
+	.string	"rc_modes.h"
+.LASF2673:
+	.string	"stdint-uintn.h"
+.LASF2767:
+	.string	"endian.h"
+.LASF2785:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2688:
+	.string	"rc_controls.c"
+.LASF2704:
+	.string	"cdefs.h"
+.LASF2734:
+	.string	"adc.h"
+.LASF2705:
+	.string	"long-double.h"
+.LASF2680:
+	.string	"rc_controls.h"
+.LASF2752:
+	.string	"battery.h"
+.LASF0:
+	.string	"./src/main/fc/rc_controls.c"
+.LASF2719:
+	.string	"flt-eval-method.h"
+.LASF2660:
+	.string	"src/main/rx"
+.LASF2708:
+	.string	"typesizes.h"
+.LASF2650:
+	.string	"src/main/blackbox"
+.LASF2759:
+	.string	"sensor.h"
+.LASF2726:
+	.string	"common_fc_post.h"
+.LASF2711:
+	.string	"locale_t.h"
+.LASF2663:
+	.string	"src/main/target"
+.LASF2763:
+	.string	"pthread.h"
+.LASF2731:
+	.string	"axis.h"
+.LASF2668:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2656:
+	.string	"src/main/drivers"
+.LASF2738:
+	.string	"serial.h"
+.LASF2741:
+	.string	"utils.h"
+.LASF2730:
+	.string	"build_config.h"
+.LASF2766:
+	.string	"struct_timespec.h"
+.LASF2751:
+	.string	"dashboard.h"
+.LASF2661:
+	.string	"src/main/sensors"
+.LASF2672:
+	.string	"stdint-intn.h"
+.LASF2749:
+	.string	"motors.h"
+.LASF2712:
+	.string	"__locale_t.h"
+.LASF2671:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2780:
+	.string	"struct_mutex.h"
+.LASF2783:
+	.string	"__sigset_t.h"
+.LASF2728:
+	.string	"blackbox_fielddefs.h"
+.LASF2778:
+	.string	"pthreadtypes-arch.h"
+.LASF2676:
+	.string	"io_types.h"
+.LASF2764:
+	.string	"sched.h"
+.LASF2667:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\235\006"
+	.string	"\224\t[\001"
+	.string	"\032"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\257\360\337\212\003\n\002\003\002\004\002\005\002\006\002\005\002\007\007\b\243\275\374\327\001F\006\002\b"
+	.string	"\002"
+	.string	"\b\002\t\b\n\n\002\n\t\n\013\r\017\345\230\223\317\b\002\002\003\002\004\020\202\244\276x\004\002\013\002\013\021\022\205\374\351\353\006\023\241\350\307\204\n\024\025\237\375\370\351\b\026\236\261\223\370\007\027\030\353\227\221\315\013\031\211\236\236\264\001\032\033\034\035\240\342\234\212\n"
+	.string	"\031"
+	.string	")\"M\335\005\332\007\344\253y\357\264Y\200Y\027\210\200\273Tc\034#\t\202\310%7\024\005`"
+	.string	"\204\373\251\001\\\343\346<ri"
+	.ascii	"3\242\356\355\205F\273\220\013\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 h\245\001"
+	.string	"\310\\"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b\001"
+	.string	""
+	.string	"\017\002\003\020"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"J\005\342\"\270\204i\212"
+	.ascii	" \2603.7YL\021+Ad\206\262\001,"
+	.text
+	.section	.gnu.lto_.inline.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\215\007"
+	.string	"\"\212#,pK\222\016d\236\201\221V`\264|\346\005t<\302m\007FC\004\036\240nCl\035]\017"
+	.string	""
+	.string	"$\204\200\376\330\026\233\326.\331R\2463\262F\356\0162\324\216JEq\002\312\251\222\212\362\320,\300\305\202\310\r_\004(\263\201-Tl|,\252\022\036\021\031\344xJJ\313\323\204;)c\200\270\260\340d1\264_\001\303\241R\021\364\211`\r\022\212\211\201\327\222\f\262\337)\3476urw\316\375\357\215\226?h\373\214\354\356n\37525\002+ `\"ci\033Zm \362\241B.\320\362\013\245%\007L\357H\263\220Z\203\360\206<\301m"
+	.ascii	"\374\213V\200!M\\\370\307@\200&\201\304\b\300elGd\003\240\201"
+	.ascii	"\316\nb\004\230\037\246\336\330\353\3019\036\211a!\360\264\327"
+	.ascii	"\201%\352\212_\300[\021$\200\353pE\341\370\323\234\255\305u\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"u\005"
+	.string	"\"\310\030\037\240'\351\330\003i\327\371\377w\361%\372\375\267v\373\377uq\363P|\177\333\272\335\214\020\231d\274qK\030(]\202\256\345\273\220I\362\341\312\330\214\021\304\351\352\270\272\216F\017z\246\343\232\322|\\\341\276x\305\267n\356\233\353L45\262\001"
+	.ascii	"\303\030\266sj\352\324\246\032q-\231\224.\364%y\334\020! \220"
+	.ascii	"\202\221U\334N[i\350\262v!\\\221\3278\303vKP\f\022\201\001\326"
+	.ascii	"\2311_\r[4s^\261e\302\2478m\310\262\027\270\001\206a\263\031"
+	.ascii	"\274T\255W+\344\367T\345B\312\304\356\332\r\027!Q\327\025w\b"
+	.text
+	.section	.gnu.lto_.pureconst.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\017\204\004\020\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \232\025\003"
+	.string	"\"\005\020\030\260i8@\222\004\252\2119q"
+	.string	"\003\247\221\255\331\234@Ev\t\331R\246?P\344\004\263\225\267\366\013\307^\211\007\367\234\277&\nM'S\276t*\345I\025\200\224\037\345\317\036;\215\362\365K\001\r"
+	.string	"y0\007\301 \330\325\034&a\002\027\354\225\t(A\2709\365%\304.\314\312"
+	.ascii	"\003(\002"
+	.text
+	.section	.gnu.lto_.lto.39c0da1cf9cc85ad,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.92.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\201\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\005\031?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.94.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.98.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\317\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\003\020?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.100.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 .E\001"
+	.string	"\360!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\001"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.104.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\327\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\b\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.106.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 :\215\001"
+	.string	"D\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\0012\264\013\352\376\n?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\004"
+	.ascii	"`\204\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.107.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \356\215\006"
+	.string	"\202\314-2pM\322\001\200\006\032X\267\022\360\366\371\fP\315\322\035=\260Y\205*j\315n\3738\355\200]\371\214\314VU\021\b\250rQ|)8\035A\204H\231Rn\224\345\301\275K\3055\205\366Xk`\025\207\005\b\326\236\205Q\003v\021\f\217]\234{l\212{\365\244\022lt\302~\310?\320\357\260\004&_=\3621"
+	.string	"\217R\0038*6yy\272\330D\261\243&5\303>\264\352\261\235N\225,\023\201k\227s\245lID\342a;cO>@\310\030>np\216\361\241\0209\331\215L5\016\237\320?\310\241\017\213\221\252\243yJ\t\273\353\254:\326\255\267]`\333\300\266\025\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.108.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`V\001\355\r"
+	.string	"\206[_C\020\257&\035\\\013\251.h\344\305T"
+	.string	"Y\344\242\260\211\030\200r\205\277\365\nJ\035c\325V\254o\215\365\307PG\017F\203\0271D\001"
+	.string	"*d\005\331P\177\261\370\004\335\221\337\021\371\246!K\366\336R\246\024L"
+	.string	"F"
+	.string	"M"
+	.string	"P\300\t\304\303\374\200xh\333\bFD\036\275\313\020\363\231\021\246\032\234\335\016S\f\037\035>\315\221o\221,\270\221qq\342H\207\025\376.nBj"
+	.string	"\316\345u\354\356=<a\270\226L\213dw\235'\216\302\035o\273\201m\006\366g\002\035)5e\377\355\356ZQ\266\323\236\253~\rM[/\035_\032\276\364\323\264\276t\276\364/K&\005\307\212\335\230\225\214E\001m6\330\026\331\227m@\204\210\246}\016\357 \272J\202\341\256\005\023%v;\020{t\036\357\006j\324\003 \017Q\003\365*\236\273KRM)"
+	.string	"\025\315\t\227\204a\325\247\177y\241\241\252\005Z\230r\256\251q\306\013\216\355\217\323\230Dgw\023\370\037\016\"\202\257\341\320!\226\374\351\320g\211\207\327\r\0266\245\\\371\272\260\031\303\016\026\001\215\204\204d \005\237\215\023\007\032J\211\212\211\345\354\023\202\240m+)ZV\222mX\006\302R\036\230\240`\331\026\302>\034\326TN6lE\3236\354\352\366o\025\345|\036O\375\270\2450\266=\332Q\322\026[\352\321\233rJ\271\212PSO\237\242\242\006\031"
+	.ascii	"\242s\220\301\320S\245\360\260\257\b\304\0051\300\r\330\265\202"
+	.ascii	"\325`\017\030\267\rIr\310\305C0\036\001\306\304\002\301_\202"
+	.ascii	"\243T\001\020\327\034\253eB\324j\234\253\212Q\363\364v\2252"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.109.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`\275\002e\024"
+	.string	"\366\345\204I\300\224Q:8\214\315\365k\347)\026\231\314=\322\222\016M\342\373\363_\301\367\370\271\253\263\240\034\3301\303\206\376\363\343Y\f\272/\032/\034\334\371\213\305\216\"\230\006Y\256\307`\263\302X\311Z\027\372m\237\020B\366\336R\312\024p"
+	.string	"e"
+	.string	"s"
+	.ascii	"\377\314o\372\372l\213\231\303dNG\fu;j?Dj\315\261NVEw\312\005"
+	.ascii	"@w\266\211\205-\370yt\312f\3307\024i\026\374"
+	.string	"h\354m\f\304R\211\202c\344A\205D\"\210I\244\361\334\244\r\037jX\232\304\232<\251\265\246\304\031\267D\021\"\244\224\022kRu\303c[\334\262\215(c\366Rj\255g\233\310a\037\356\377\021\377Q~\366\021\334\333aWgIHP_\003\335\226\240\0032\343\245\203|R\327E\377\f1\274\266m\003\"fM\363\305m\270S\221T\271\310\237\223q\337\376\355q\034\307w\316\177~\211\344\223L~J\362Q\315?I\276I\362C\311\007'\377\223|o\362\251\344\317\346K\3463\363W\200\227\003\311\344F\2557\243\221z4\207R<82\036w\366\355a\317~\351x\264\327a\323\036\264\036\031\217\377\032T\260@5\326\306\002\006**t\347\327\273\243\3555X\032\016\276Zg\007\2762v\306\003\b++t'\355\325\216\013\331\263\267v$\306\343jcD\370j\255\b\2760\366\207\345\213b\347[Z\363\333\352"
+	.ascii	";C1\036\177\332\2558\021\216\205\216\334\334r\257\022\212M\266"
+	.ascii	"\002\375],\360\332\002o\255b.\270^2/\256\026K\353\305jQ`\275"
+	.ascii	"\270\264``\265^1\254\325\200\273`&\274X2.\327\213e\312\305V\326"
+	.ascii	"\3169\f\216\347\333\205\321\305-\330\343\003D\2770Z\3226\377"
+	.ascii	"K\372)\261\226\311Zk\005\371(\247\246\350#iT\277tF\251&I\260"
+	.ascii	"D8R]\340\324(\241\240S\253~\340N\274\330\351\360\372\266\033"
+	.ascii	"\242h\251\004\355\333M=\033\245\244325\201!\2646 \320\002!\251"
+	.ascii	"\241\007\316\b\315\235\343\335-\031\271\\\232!;\336\323v\025"
+	.ascii	"\224#6\316ac\020\222iQ\307\022\201\2151\243.\316~\214\332\013"
+	.ascii	"X\334\361\305U\024\213=\020\262\201y\231g\f\373\256\033\215W"
+	.ascii	"J\263\336\255\361\033\3010s\333\016W\351\314\342^\355\232\225"
+	.ascii	"0\273\307\204-\2375\221\032\203\bt\020\241\351a.I\033xpc\220"
+	.ascii	"\301\035\252\221\316\215\236\220\241"
+	.text
+	.section	.gnu.lto_processRcStickPositions.110.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`\363\026mb"
+	.string	"\272\226`\"M0\316\332\031\003\341\0011Q\246/#f\034\024\0365\207q`\302\260_u\201c\211\024\305\027\307\f\214\355d\221\005\331\363\233\325\005\234}\356V!\020\006\241\316\030\0042\233\355\345\202j~\221\t\240\360h\006\265"
+	.string	"\241A\022\023\222D\246\224R\032\002\330\001\027\002kW\336.\2531\305\334\244\003f\030\3655\343\312\313\223v\035\273H\2646\005\005\002\332\324\027L0\352K\003*\357\013\223\302\367\2456\273\310\020\034\273\310\274\364\233jgn&M\007\355\272\017\330\346}\333\274Hy_\252\007n\036\273\310l\237\266\213l\363\264]d(3\231\246\272\275]\035\023uR\370\276\357\323\377`\266Yj\363\321\241\315(0\325D\t\001HPM\215\020\021B\nD"
+	.string	"QP\037"
+	.string	"xr\362\320\241\331\304\264\244\304!\ti\303\221\021\263\210h9\244A((\003\320\217O\017\317\216N\016\216\362&\351\"m\216\306\266\310\276C\271\221f`\315(0\325FH\024\317\004\213\326\326cF\227\020"
+	.string	"q\215\223\240Rs\350S#\322\030\272\210\304\016Q\b\203KAO"
+	.string	"\3012\351\255q\322W)\031\366\347H\330\222\206\223\216\361"
+	.string	"R\254\341\213zA\214C\205\351\017^\207u"
+	.ascii	"\004\002\372S\030/\356\324\245=<\377:\260Q0\nw\364U\332\205"
+	.string	"M\246\211\266\320pR.\336\324\322\224\205\t\313\026_rQ\202\022+\"\312\333g\204K4\322p\322>\347p\205\317\223\016\370\261#\332\207\326\326CF#\355\365\206=8\251\236\037Y\333\310\n\305\231,\224\325\214\257\257\322(\354\r\0222p\r'\315\363\";\242e]\017\3211q\ruK\\\250N\211\007\315\261#\264\211\311\360\f@D\374\307g\210\020\357\221\013\342<r@|\307\004\327\271\302I\337<G\256q\334\326\\\3116\tNA\323pR9\326\207\306\020\262\306k\243\253\224\207\337\030\253\222Fmgj\355^\245j,\023N\252\303\221l\023\217-h}\225\356`}V\350\361B\303Is\270\r\233\374\213\313\321Wi\032\033\225\266\367'\346GcU\tg8\332x\243\333(\313\3642\263\030^\264\321\254\322\f\006\313|\337\3275\033\363o\274nZ+db\330v\206\243\335X\365\276/;\231\331Y\363"
+	.ascii	"\315\3142a\3463\346\235\264\217\023\210\303\255jW\233\237\262"
+	.ascii	"1\207\321\371\215\327GA;Dov\363\313\23052\275\227\335\020\357"
+	.ascii	"\274n\372\262\346\023\020f\314\323 \200\330\344~\310\315\357"
+	.ascii	"\273f\337\367}\217?\265\t2\205\257\305zf\213K\317\364e\314\316"
+	.ascii	"\357\273\016\335|\347w\f\036b;\360\022\231\334\210\325\313v\351"
+	.ascii	"\261\322\332\237r\007\2312\204\275z\017\246\210\360V\277\364"
+	.ascii	"e\306-\355\033%\350*)\264x\335 Xo,}UX\361\252\337^\266V\177\365"
+	.ascii	"\316%\212\246\264\332\350\275\2778\034\354O\337\237\253\332e"
+	.ascii	"\314\323\360?;AO\241\340\370\276cR\334}-\245\002\013\254\254"
+	.ascii	"\332.\376'\005\326\365\373w\0241\314\023\335:\312\325\361}_\021"
+	.ascii	"\334z\275\347\344\016\322E\316\312\300\233,\203\266\213\375>"
+	.ascii	"\201~a5\254\276\23743\254\271J\333\364V\337kb \212y\"'\255f\327"
+	.ascii	"O\333\3733\362\334\034\201\350x\204\327~\266\375\244\251\330"
+	.ascii	"\302\314\f\032\005\257\215\327\021\320\t\032\016\276~\310L\025"
+	.ascii	"\363\237\376\305\245I\341\367\301\354\304\272\272\300\252\353"
+	.ascii	"\272O\270\316!\\g\251\276kn61-\271\316J\2563\007\3279\311uFr"
+	.ascii	"\347\r6\316G\256\263\221\353\314t\235\213\\g\"w^\272\363\220"
+	.ascii	";kp\235\205\\\347 \3279\203\353\f\344\316?\256\263\217\353\334"
+	.ascii	"\343:\363\270\316;\356\254\343\3169\2563\216;+\335\371\306uN"
+	.ascii	"\272"
+	.string	"\316n?iF\272\3166\256\363\321\306\331\210tnm\234Y\244\363\3338\373\321\271S\264\232\264\260\f\021\341\373\322HT\363~)\372\021\351&\335w\335O\332\350\255\027\275e\356F\241\253\355\244\361\330]\">y\036\337\"F\274\036i\004\337\227\032\302\214;\256\302\034\243\276fP\001-\321;\0316\242'\3217BF\220\301a\371X\256\243\227\037\305\346|vBY\202\320H\342\233C\242rds\2252h\bcq\033\206X\032CO\305\306g\344\310\214\357\206\003y\0033\322 \345\3756\324\306\rh\2327\231\206\247bk\301V8\b\345\315f\206\252A\327\222z\211\306\262\2610\246\225~\266Bh]B\357s\210\303\246GX\344\036\257A\357\236\005=\320\233\026\")\222\233\031W\312\223\273\r\355\3212C\247\320\037n\335\262Go\t+$:\302\320O\007;D\231\316\360!\274,\303\027\275)\365\346\216YD"
+	.string	"\242\341\247\354\245\237-\320sU\003e"
+	.ascii	"=\320\033\216\244^\222\240\275\277#B?\036\343G/.*m\0170\350\247"
+	.ascii	"\334\323\317\326\347\261\\\314\347\207\364tdXs\023f\002\320\007"
+	.ascii	"\355\211o\304j \021\331\241\322\034\335\317\333\220\325\220'"
+	.ascii	"I\324\007*\244\355\371"
+	.string	"\276\002\3515P!\207\255\006J\004j\004\032\007\215k\273\330\363J\201u?V\302)\301\273\236\237\362\367\263\345\371\206\253v\351\261\236\341)l\321\245w\236\007\315N\2175\006>\263\302\f\036\235O\232\200D\347[5o1M\316vr\336\377\220\346\240K\274\311r\276\347\330\304\036\254\213P\254\030\352,[\251o\253\366\262\305y\251g\217\342\020\363DA(\335\027\275!\005\241v\310-9E\316L\200\001\336d\314\024{0VZ\255\274\320b\th&\214J\316\340\225\0318\200\255|\256j\230!\347V\240e^\200\001o2\345S\261\215=\030'\255S\214\300\0241S\276ho\036\253\032\346\257]x\321\300\003\017\264]\274\371$\035\362[\300yKr\363\323\274\276\016\271\231Ar\255Z\277\264%\223\377\245\311\006;\371\317%\006\017#:GvXq\177\312m\330\317\326\346\271\252\\\266\270@a\363Do8\326\216"
+	.string	"\347\206 \331c\323#\277\f\371\307\307\252\006rc\351,O\356 \334\205\002E\333\305c,VD\340\325UT\321]\\Y^Y+\266\270\262\264\262\234\316+\240+/\255\254\002V\250\340\212@\003\247\227\n\007RlpBKk\013\202\016\264X\2608\221B\313\305\226\006]L\216\302"
+	.string	"\304\207\017N\fF8\001u\271\360\272\362B\221\245\345\345\265\305\245\201\227\222\235N]Z[\\^\033l9\255\234\\ON\f\2366Pq\265\342\311\311\325\365\3444\304[,\262\270\236\274\266\266\270\236\\jX\277\017\256\n{\261>\361#\307C\255Y\340\223\246\251\362\323\342)`i\300\235"
+	.string	"Y\370\002\343g\205\035\322\206\306D\007\354\373\266\231\020l\342\211\334\346`d\250Pb\n\224>\273.^\214\b@\367\345\253\200Q\022K\256w\315\374\345\202\3579\001\3161a\231)U]\021v\t\226 S\356\244\221|\345\305\335\300\022cD\222\257\0265^\303A*pp\"~\212\327\022\330`\353\027mS\233\253\222~k\327\367*\320\253WJ\200\314_b\272\3725\006\311\355}_\251.>\271\231\361Sk;\303\034!\226\370\230Iij\277\324\260\210\216Y\236\341`\002\3166ki\233\335y]\375*\243t{\337\267\311\230\277b\370:\023\343\301x\007\355\372\372\3250\326"
+	.ascii	"\022E\252\217P\351\351\330^\266\034^\351;\212\246\344\371E\310"
+	.ascii	"\341"
+	.string	"\177\002\317\374\230\2620 ~x_\031\367M\222$\200+T\376\322/Ch\b}VZ\016\004 Q}\243\237m\322\221\244>*I\271\352\025\312\016GI\261.\221\312\007\234\023\b\350\213k%wL"
+	.ascii	"\200\241\237-\022\021\244\276\265\326\360\216\306\323\006!\033"
+	.ascii	"\372t\\_\247\257\303d\237\r@2\253\207\237\362\363\204&\017\355"
+	.ascii	"\002\315R\207\326\"\344\301\324P\372\002\245\232\353\t?z\346"
+	.ascii	"\257D(\230\321\037}G\211\"vb?[\346\033]\360\314\1770QD\276Cv"
+	.ascii	"I\300\302\327A\005\2343$\237\341M\f2x4\273\234\321\321\223\302"
+	.ascii	"h\322\302A5\360F\2042?lrb\230\270\364\263-\362Q\304\307%\bm\005"
+	.ascii	"1K\312\024\256%`@\243T\234X}(\375\224\263\3643\201\375\250q4"
+	.ascii	"(\22133\"\"\"\005I\222B\007a\005\304\030\346$<n\021\3000\207"
+	.ascii	"(T3SR\222\302\036\007\213\020R\201\377\f\024/S\246\323@ydAzv"
+	.ascii	"\360\r\300\322\356\226<4`\206\340\377g*<\2428ae5\243\353@\005"
+	.ascii	"\004G\355\251\304\207\n\265Xa\"\370|{bE\324A\357\324h\006=P\211"
+	.ascii	"\207\2454(\317,\253?\304\247\240\fT\002\321W\"\335|\r\r\270\""
+	.ascii	"\261b{EN\336\332\033,x\rl\245}\264"
+	.string	"q\306\267a\226\226\260\303$\367\343bK\277\353\364\221fNk\221j\0220P\327_,\240\204\254\377\254\364\036\326\216\022Y\032K\307E\022\213\253\263\231\3018\t\016V\307g\340\212f\026\260\340\303\2372)9b\223\300\332[\347^\212\302yb\247fK\370Y.\224\327\245\314\334?\327\317;\316\361\306\302\037HJtjP\\\235\357NM\035m\322\307yS\036\274J\377\370\310\0347E#o\240\242p=\350\316L*\2439\217\210e\"hzq\016\305\\y\326\017n\n\255\256\027.j\243\374\303Q\244\213\033\r\231\0274\25381\330M\201\260\256\376B\311$0\374\007\321H\"\326\202\2166\r\022\306\367\3432J\315\357\2301'\t\b2OLX\221\233#P\236\t\317\304rG\334\305\313g'kCS(\323\231\316\311\374\325\251[\304.\331&Pp~\342u!\"s\356+\020r\230\265\277F\200\237\303\220"
+	.string	")\373\n\265\303\246\034vKo\006'\243\0314\376*\275\221\\A\213\307\253\210\212\007\002B_"
+	.ascii	"\264\365[d+%\036\360\352\013\237\377\240T(\272\341P\316\224\214"
+	.ascii	"J\253\341\t>I$\241\201\327d\377\342\325\300\352\f\350\013\314"
+	.ascii	"\037\215Y\230\030\304\345\322\034F\347H\021\\C\376m\024g\230"
+	.ascii	"\222\235\314\025\3020\036\260QoSx\333^HO\270\353q\272}\031D\304"
+	.ascii	"9<\270\030@\204\233\006\246O\2350\267.\033Mm\232\256\273o\025"
+	.ascii	"2R\007\017\252\366\364\201<_\001_8\"\3421l1`\004\264#\f\251\212"
+	.ascii	"\367bF\227\324 ,\\\2220\3159\271\235\374E\351m@\334y\262\351"
+	.ascii	"\315\037\221>\022h\024\330t\257-B\245\273C)Z\211C\367\"Q]\204"
+	.ascii	"\205\314\316\205n9\210\362\311\033e\370g\262\0044]\212=#\313"
+	.ascii	":\251\322E\344\021nk\331\305\244\362\254Y\366\n\235G!\325X\245"
+	.ascii	"\252X9eGG\001rZd\254\347'\3540\327\321F\365\270\023\342\3272"
+	.ascii	"\241\331\b\210\264\210\006\266\230\253{x\227`\345U\365~\230\374"
+	.ascii	"\006\265\344\272\022r\267\033\251\365\353\217\031\242\034\334"
+	.ascii	"\243\003\272S\253U\372\236\336\317Kt@w\247N\362\016\271\363\n"
+	.ascii	"\314\310\274\220\276Rt\376\376]k\350\331\217\267\253':rM\237"
+	.ascii	"E\226\316\252\320{'\017\227\330X\312}\220\307\325W\200\223\303"
+	.ascii	"\203P\202\364|\211\220Oe\202\362\004\3616Yvq\206,\0327\003B\203"
+	.ascii	"\337\200S\367\201\273@\304\031-\033\250\314X\251\376\034\206"
+	.ascii	"`,Q<\216n\266\355\306\f\316\310\\3\241\245p$\250\270\367\031"
+	.ascii	"\354\333\356\334\303z\222Gg\032Oq\356\315-V\226X\221\331d`\n"
+	.ascii	"\364W\251\247\321\t\263\357\337v\021b\270@Z\233\200\004\024\013"
+	.ascii	"\230\021$\350\002\322\006\315\024\360\251\270\260\272}\362\321"
+	.ascii	"\315\227\006\024\260\200\023\301\201\003s\\\216\254\206\314\372"
+	.ascii	"\021\024\365\3249.\341\025\256)\033\237}\204\351\t\320{\225\\"
+	.ascii	"=\032O\257\262~\376e T"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.111.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`D\001\215\016"
+	.string	"6\335eE"
+	.string	"\261&\035\177J\f?1#\367B\035\020e\256\345\343\312\203\177N\341\321\377\036\032\023\022sCn\265U\306\302\bQTR\362\202\325\f\344\322\273\024\254\377\227\021=\001P\247\b\207\334\fS4d\t\331[\312\224\002S"
+	.string	"N"
+	.string	"P"
+	.string	"+b\004\237G\333~\211\2330\371\004[\036>\354\003\214\026\233\236\335\335@N"
+	.string	"{\204\037\200=j\207\237\0165O\276F\003gg\365\255\034\202\276\fWX\200\365\242\"\300\307\002Cn\\\254\327<]\276Tf\306`w\235\253\017\303\035o\273\201\355\007\3669\004Nk\247\371A\237\371;\234\316b\032\213\351\250i\250i\325t\302\364\001\204\360|\307\305\356\205\327\215m\021uD\3306\331\232\375AbD\323~\353'L\247\261\340\270\273\201'g\267%b\007\237G\001\371\021b\304\371\231\223;vaprv\003\352\021\243\206\005K\326\260\312\270\n\026\025\323\2534@\215j"
+	.string	"\207B\275jD*_\006\251j\266\342\232\372\226\034\266O\236\202\364\331]\005\276\315Qt>\210GS(\345W\217~\t{\274\226\274\320A\345\313\032\314\246\r\273\265\222*c\037\256\306\330\001\234\027aD\212N *!!\341D\013B\036\245Q\005\023h.T:\351\274\024\224\216\203\300y\033'\332PF&\244\215\363J[\350\200\273\t\022\274-\245\353\274Mk\3555\306\231:\343',U\323L]\024\004\245)\b\241jzU\017*_\317\033\027\353EU\306\231\353*\030\026\025"
+	.ascii	"\277\271\"\341\320 5\266j\2001S\242\347\374\345\355\\\005\033"
+	.ascii	"\300\200\247\227\312[\300\005\367Ee\241k\270\363-`\266\020\005"
+	.ascii	"N\034\241\351\360\323\235\230\"k\\j\017"
+	.text
+	.section	.gnu.lto_useRcControlsConfig.112.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\335\n"
+	.string	"\206\324LD"
+	.string	"\253j:\300\373\362\362\006*~hh\n{\021g\234i\310.1\332\177G\230\020\305\241\306+n\364*\313\030\205%\203\001\312\253)\326\377I4\374\377z\326\231\343\235\r\241\310\3104\300z\266Tlh\313\224\0025"
+	.string	"6"
+	.string	";"
+	.string	"\032gp\327\\\236b\273\306\035\263]\363hcx\211`/!C\312%\333\335n\036\370x\035\375;x\004\271:]!<v\327J\256\004\334\363\2661l\207\330\317\004\036\354\362\244\323\200}\313\356\256'\313~\353\267\250ZU}\016#\263\360\361\332U\315>lL\243\260\300\366/\366\205\252\343j\237\301\033\214o\231>\261\313\2520a\267\f\323\217\360\327\n\n\b\264]\233.R\303\247NMj"
+	.string	"\247~\312f\213*\223T \300<Ya\034,\323\177p\b&_\201I%=y\315/m\3272\t\b\240tf\205m\270\260\032\326\37068\034\357\343\330TtD\022p\244\363\361|`\br\342\021I\330\333\210\0370\034\205@\257\304\013;\357\353B\036\023P\347\205b\267\2610(\352\204\335\b\004\303\356R\356'\313\"\035b\250\t\300\032\016"
+	.ascii	"*\324A\231\200\031o\006\\,\b\230\t\311]f\200`\210(C[\252\225"
+	.ascii	"p\301\373[\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`\360\003%\022"
+	.string	"F_sF\260\226J:\024\036\030\373\364\321f\300\005G\364\272\225\203\351\313Vd\252W\341\f\374O1p\230CKB\323\313\201\312\2519\360:\237\372\203\376\027\274\b\3058\016yF\251?\224\326\255\300\377\007\267\345\255#D\222\224\002\\"
+	.string	"a"
+	.string	"d"
+	.string	"F!\212P\370\370\337\222\217\245\330\314\304\353Y\213q<\3530n\347L\236\216\237\344x\013\216\263\334\230\314\2631\026wE\335\270\252YS\2411\327\214\257\324dlE\307q\034k\353)\234\225h\316\232\255\3018\265\377\315\002\306\362ls\2679e\257m%\343\335\234s\022X\177q\266;\260\035\326^8\254\277lX\217\032\3663\303^)h\177\303\260gqa\377Y\330/UXk\241\260.\233\260o!a\357\"\302\276\t\302\272\312\347\2346\355\301z\354\016\334\300J\030xk\201\265\024\270I\002;A`(\007\034\305\200E\017\310]\236\235\302\b\351\250D\321\217\275<[\bIh\004\022\321\021Q;RW\2004\251*\304\303\274\370n<R\223\302\036\251I\337\273\037L6lRO\200\017p\353a\223j\002\274"
+	.string	")&\233T\022\340\377e\204\206\217T\021\342=$Xe?R\207B\032\251C\337c\306\262\232j\244\316\304\313p\t\2311\223\372\357\337\261E\354j\326i\320\225\326)\210\275\323\2075\027\017\353.\001\376\367n\3169\201b\364a\340; Od5\251\247\n\017S\003*\211\214\324K\211?\021\030P3R?$\274G5.\241\221\372(\361\237\n\213\324\210\347\274\234\252l\244>\310w"
+	.ascii	"8\264\254n\244^\007\370\037\251\002q\244>\307\367\001[>b\320"
+	.ascii	"\244\376\t\314\221\272\241\216\324\375\316A\361P\n9 \020\003"
+	.ascii	"!\"\035\365\243\034\357\r[]j\361\355\366M\330\352\326\031H\200"
+	.ascii	"\004H\200\004H\200\004H\200\004H\200\004H\200\004H\200\004H\004"
+	.ascii	"\222W\320\316\262\364Y\n\003a\013%h~\340V\036\273<dc2\320\301"
+	.ascii	"\035H\243c\203\20169\356H\352\366\030\233e\326\264V-\351\312"
+	.ascii	"Hp0\333\230\033uGx\330\020:6r\354=\242+\211^\001\251\371~\031"
+	.text
+	.section	.gnu.lto_.refs.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375 \334%\005"
+	.ascii	"B\314$+\200K2\034\034\034\331\3124\\\225J\260\264\"j\034\022"
+	.ascii	"#1\262\030c*\214\200\211\246\221%\215\264F\b!{\357\266\367n["
+	.ascii	"\312\024G-(A\007\022@\005\3124 =\205\312ZI/\362R8\351U;\234\034"
+	.ascii	"\216\223\242\341\234h\236\022\021\020|>\264\247C\b\310\207\343"
+	.ascii	"{,\177G\37374\334\217\301\374\027\217o\361\376\212\345\033\036"
+	.ascii	"g\340/4\256\340x\202\343\b\356\017\332G\353\235\365\214Zb0\264"
+	.ascii	"\376Q\377\330\267\365L\035Q\263\364M\267\227\317?#\006\004\001"
+	.ascii	"(\242\305Q\330M\241\265k\033\314"
+	.text
+	.section	.gnu.lto_.decls.39c0da1cf9cc85ad,"e",@progbits
+	.string	"(\265/\375`\2158\005\372"
+	.string	"\312\213\021XU \na:\215\001\300'?\204t\352\375\345#\307^\322\324\313ae?l\316&<\362E<\304\247\336\231\217J\315\013"
+	.ascii	"\330\233M\026\032\002\231\274\236\325\260\274p]\f\027\255KE\004"
+	.ascii	"\206\307\233\357s,\317Q\316\337\250E\323\370.\206\300\352\356"
+	.ascii	"\016\305\266-\245\224)\312\004\221\005\246\005\037\250\334(6"
+	.ascii	"\213\245\373\332\271\212.\017\313\230Q\005\030N\332\334\322\227"
+	.ascii	"\357\213\241o\236\240o\346\351\233f\264\023 \262:\262$7_\003"
+	.ascii	"\262+\310&nNn\231\225\345M\336'Vy\235\\\263[4\253w\233\364a\222"
+	.ascii	"#\311\223\3167\275\350\233S\364\3150}sKk\020J\336\250\372q\231"
+	.ascii	"\204\375\2060\221\272\371\037\220ft`O\220F\242\316\224\\\261"
+	.ascii	"\233\344.\261\312\033v\221\374&wR\330=\222\334V\nP\226\311\032"
+	.ascii	"\333;\351\233\262\206L\216\236\374\314F?\233\240\237\263\350"
+	.ascii	"g6\375\274\244H\320\226\230\026dnN[Cu\275\356\276R\030\212\225"
+	.ascii	"\246\022E\216\255\273\323q\247\376\244\373B\257\216\335\234\017"
+	.ascii	"c\264\220{_\034w\353\362\270B\256\217\013\344\036\257\326\275"
+	.ascii	"q\273.\221\373\343b\335\032\227\353\352\270;\256\215\033\344"
+	.ascii	"\016\2719n\217\373ui\334,\253\274^w\306\257\325\275zN\356-\225"
+	.ascii	"\307&\206\232eU\232=\301k\352\013\230\036K2e\262\220qbr \325"
+	.ascii	"\374I\327\205\305\303I\344\016\225.8K\2720;\226pq\354\234:z\026"
+	.ascii	"\316\036\362\262\370\223n\013\213\027\307\314\231\031\310\017"
+	.ascii	"\177\322\365\2721\256\f\234D\362\270\350J\263\334{\3338.v.\b"
+	.ascii	"jhK\261\360\201\346z\3314v\016'\225\332\205\024\031K\r,\035;"
+	.ascii	"\207\216\033\373\346\356\205\331\237taX\274\240\247\241\035e"
+	.ascii	"\247\006\271w\362\366\313\217\201\006\327\313\266\261x;\233n"
+	.ascii	"\273\240\342\005\003S)\353\346\364\366NV`T\201)'G\306\204\f\362"
+	.ascii	"\245\263\026|\t\210\241\177e\340\211`o\265\235\260=\031y7_\252"
+	.ascii	"\244\337\252\t\254hy\273y'\263\320\307l\364\261\t\372j\230\213"
+	.ascii	">^\323\217{\272PV\311\341F\335\356Y\272\363H%w\032\017\036\033"
+	.ascii	"\036j7\037'\365-\007\237\220\345\340;^\2423\356\241\177\351\310"
+	.ascii	"\3117\346\274\300n\376u\243\177\275\350_6m\004\246\177\2674\207"
+	.ascii	"\033\372\027\206\346\340J\351[9\372\312<}\272:\375%\233\276\236"
+	.ascii	"M\242o}hkgM\260J\r\366\016?\241m3\240:M"
+	.string	"\352\310\271\371\026\207\276\325\340\263{V\203\357\326\205\376Po\260\026|G\241/\260\026|\266\213\225\263J\n\254\227\244\320%Bg-\312\315\357\200\276\245\300\207\367\366,\005\276\203\2407\224@\201\226\202\253b\266E\213M\036\233\320\271\371V\313o\253\3306\233\305\036\367\226\262,\322TY\261W\254\362\310\276\335b\261p7\241\222;i\363\276\242\256n\036\262\026|W\002\372\007\351\326\355EP[\203k=\202\275\355\221\317\356\355\331#\337=Z\013\276\002\254%\335\262\005]5\221\302v3\221\332\021\2237\037@n\236\342s\341#\r\314\315\267iV\312\335\356q\357\266\275\367\005\375\302\r\23587\333m-\370\206l\221\317\242%\335F)\362Ye%\267P\003\210\374 \273\031\3332kf\317\360\024\325q\253\355\235$\332)\333\322\245v\263=\273\366\211M\336\236Y'\307@\203\377Hm\263\275\223\366,\357\re\255"
+	.ascii	"\202\254\025\200\251\305\bT\024_NZ\013>m\213|d\367\371\261\335"
+	.ascii	"\2252\357\3711\tV~+\201\337~\360[\f\374v\304\177\257\332\216"
+	.ascii	"U\376\333\305\366_\033k\327\210\332\177\221P\271S~[g\237H\311"
+	.ascii	"J\273F\277\265\360\273\337\"\261$~,\344\267\003\260\025\334("
+	.ascii	"\327\t\355\277+\240\374?\200Q\206\037\333\370\177B\3778\006&"
+	.ascii	"\341\267\037~\233\301o\223~\273\363\337\3743\2212y\317B\370\355"
+	.ascii	"\003~\013\201\337:\340\277\020\370\237\377\374\364\304\311\325"
+	.ascii	"\177C\360_\020\374\327\003\377\375\300\177;\360_\021|\347\317"
+	.ascii	"Q\376\353\341\277\030\3747\351\277\035\376\233\200\377^\360\337"
+	.ascii	"\f\314\376{\364_\013\376\213\200\262\377B\177\206\373/\331\177"
+	.ascii	"\307\376\273\344\277J\376\233\344\277`\377\035\362\337\257\377"
+	.ascii	"\002\371\357\217\377n\375"
+	.string	"\227\307\177u\374W\353\2777\376\213\365\337\375\337\021\376\233\342\277\352\177\213\377\035\376W\370\337\364\277\347\177+\360_\n\374\327\203\377*\340\277\032\374W\377\226\315o\327\374\266\314o\357~k\367[0\277\235\373m\227\337\226\360\333,\277U\376\366\312o\333~\313\366[*\277\225\362[(\277=\373-\331o\307~\313\344?\334\377,\377/\360_\312\377'\277\375\361[\261\337&\371-\376\355\221\337\026\371\355\327\177/\277\365\372m\006~\353\301o\025\360\333\r~k\301\377-\377\265\374\247\362\177J\362?\b\377\345\376\003\355\355\355\355\375Y\355\377y\362SpBG<\220\216\331\260\301^F\311\215\345\343\366&\004Ek\200:s\006\257\261\016XS\263\244@\022M\313\362x\315\016\224\031Tvjz\362\302\334\211Q\223\246\207\006\031)Zp\227)D\016\215\266\233\321\334\275\377\033w1\022\307\306\210\326\260C\214\030\\\206\307"
+	.string	"<\220"
+	.string	"YQA\303A\346\270\f6\002\304\244\253\t\222\233\361\030l\344\307G\230!cBYZh\013\351\370\356\316\342y\220u|\312\333\320\004\212\311\365\346\004\241*}T\007\3518\314\255\022\207\301v:jo(-\016a@Wax\\7\343:[\207\204\013SG?\250\214\0162\203t\f\006\214\305\313Oh{F\217\213\2557J\364\366\216\263"
+	.ascii	"\333PBQ\273\371AO\264\0066H\307^\346\340 \365\203\216Z\303\034"
+	.ascii	"\3221\227.\026oC\320"
+	.string	"\225~\320\326\032\306 \035o\321\202K\260xz#w\252D\351-\201N\320\007:\2435L\301\202\005g\321FN\336|hH\365\020\003w\234\345i\262\223+e\250\260\020\215\366\"\254N\026\215\001\t\322\261R\211\225\270L\263\330\373G\216\rba\254\032+P\310<\321\027\230 \035_\271U\342+x\314>Y\331\275\331\356\206,\201\266\214i\265\001\323\025\332\224\270\315j\361\340\353\270\2616\204-\355j\350\355\235e\301\317S\013::\202\350\t\212\254\255a6\233\265\237\3628\224=i2`\346\254\260a!=:\220me3\364\321\030\3221\025\253\304T\354\024\017\276\222\233F\006$[Y\026\354\250i\302\304\312\315\007b\241'`\022%\n\226\322\004\311\316\232\\\r\0318\355X\212O\r\f,17\337\315y\362YX\026\0203\372\310\b\222ub1\024%\206b\317\214\366\323\232\013\220<Y%-\370O\234\236"
+	.ascii	"\016\t\233a'\307O~\374\004\237Q \271gT`\022\306\356\215\336\316"
+	.ascii	"\312\342\340c\266V\306\213\233\3433{\366\263\267\331\336;\003"
+	.ascii	"\017\222\260.\252\233\377\363C\377\376\276\re\265\367\3062\223"
+	.ascii	"\333*\352\347\326\264\226\303\017d\261\035\300\336?\007!H\356"
+	.ascii	"()E\332\35007(\035\033\266Ig5\225\306\365\344\001\327\225\024"
+	.ascii	"\027\216\2514\256\375$\005\366Dd\265\271\236\246\322\366&\332"
+	.ascii	"RRO\"\216\233h*m_m\026uWv'\271\236\266\324q\023m\251\r\265aJ"
+	.ascii	"\212\353j*\r\352\212h*\215\353j\247q\355\241-\005e\365Bj[\021"
+	.ascii	"\3554\2565;\355x54\225v\274\232"
+	.ascii	"J\343\032\2631^\324\215\321H+\342\265g\327LIm\031U;\240\254\206"
+	.ascii	"\350\246\222\307=fo\253\326b[\r`\357\035G\2531P8\2542\212NFT"
+	.ascii	"\033\324\321&\253\242\272\216[\212nJ\311qo%QL\273*\203\247$\335"
+	.ascii	"\026b\351\236~\354\330T-\366\306P\265\367\223\335t{\357\247\275"
+	.ascii	"\367\216\325\216\344\3369\206\246\220UU{g\031U\355\035Oo-\366"
+	.ascii	"\276je\224WSi]\307\244\267)i\310\355\"\371d\221{\f\227\225N{"
+	.ascii	"\202\262\251\330h\344\025\215\274\2331Y\317\233\022\332\216\244"
+	.ascii	"\321\311\344\336I!\037e\217\265\0327c&>3\320\276\254\261\323"
+	.ascii	"J\260\330\305\021#\t\326\026%a8\311\216\033\023\326\272`$G?r"
+	.ascii	"xl\033M\203\341#<\307\034Q\240\310\300\360\020L\304*\257\005"
+	.ascii	"\027\021R\302\223\220$Z\305\316\265\370\202\340\257\237=1vg["
+	.ascii	"A\200x\375@\371\242fy\275\360\2173qW\302n\306]\276\250\345\221"
+	.ascii	"\0265\364\355\0270g\3138<#[\334\270\230p\004\371EK\0342\r\217"
+	.ascii	"8+\313\274,\\\226f\272\264-\365\302\224!\355\306\220fd\206,\321"
+	.ascii	"\364@\302\235\361AGg\266\214+#d\211\253\260\016\334\003\037\361"
+	.ascii	"\f\274\003\347\300/\260\013|\205\2470\027\256\201\2650\025\316"
+	.ascii	"\302>p\013\274\205\255p\f\214\003\323\3000\260\r|\003\363\300"
+	.ascii	"2\254\022c\335\275\343\215\237\236\325\314\255\241\021S\004Y"
+	.ascii	"\302\225%\306\272kn\035\234D~\020\245\343\302a,\f\205Y\\\211"
+	.ascii	"\352\262\254\353j\0227\206\b\322\314\027\032\271*\030\353~\211"
+	.ascii	"\242\266\274\\\274\260!\3430\326\275\003\253\300\310\327&\206"
+	.ascii	"\307Y\007\031K\371\200i\263\223q\363}\2364\216zF;&\2010\324\215"
+	.ascii	"9\267<\235\351\332\356\364o\235\377\252\271\313KG\004{K\335."
+	.ascii	"6Qo7\3171\342!#\003\327\344\346\367|\321\327\240\215\f$\234+"
+	.ascii	"\347\352Y\345\215s\337\300\2350#\316uc\361,]\326~Z\223\001\222"
+	.ascii	"\267%9\364\214*\250\200\007\317+L\236\316\357\211\242\337c\246"
+	.ascii	"\337C\246\3373\246o^\322/\033\037\251\032l`7\363(\321v\202\036"
+	.ascii	".\375\036\033\372=0\364y\344\350\363\214\321\347Q\352\363\244"
+	.ascii	"\351\363\210\351\363l\351\363T\351\3539\372\372\214\276\226\323"
+	.ascii	"\327T\3645\230\276\306\241\257\241\364w\324\350\357\310\351\357"
+	.ascii	"\254\351\357\220\351\013v\204\350\357d\351\357T\351\373\364\364"
+	.ascii	"}&\350'/\2267-t\342\260\334\254\274nVy\337\356\025\264\313f\351"
+	.ascii	"\276D\304\231\263|\273U\256\025.9\310\275\367Q\005\025\364\344"
+	.ascii	"\r\311\241\324i>4\350\310h\335\214A\322o\233o,\313\026\2346\275"
+	.ascii	"f\004\024\344(\346\343\346\373\224\350[8)6K\220\271\367Q\r\362"
+	.ascii	"N\261\312K\345\246\245\005u=\326\320\231f9\f\2165\263.7c\210"
+	.ascii	"##\313o\030PgW\007\023\271\341f\327Cgp26\206\317:\200\264\253"
+	.ascii	"1\226\341\210U\305\335\374#\030:C\222%K\360\231\030\\\2201\275"
+	.ascii	"+'\303\355MNg \242DI\022\037\255\271\267\262,:C\016$\322Lbt\304"
+	.ascii	"j\242t\351\345`\363e\b\222\233Iz\352\264XSe\311\005e\210\200"
+	.ascii	"\211\351\f/\212\0241\301\030\300\206\253\315\330\r\033\263\246"
+	.ascii	"\004#7\301\262\22036\314\234\301\300\202\353q\363\215X\350\f"
+	.ascii	"PC\206\230Z\326J\335^\016\337\033.-[\254h\t\316|}\3458\025\312"
+	.ascii	"\256\336(\321\303d/\360|H\321\022\310\001\001b\3360:b4X\344\344"
+	.ascii	"\300!\005\207\221\233\177\201JK`\245\253\313\374at\304d\362\314"
+	.ascii	"\324\360\361X\343\345G\035\026\231}\247%0\363\341\303\334\262"
+	.ascii	"C\311(\2738-\272\304\262\2167\267\3142,I\034x]o\316\270e\321"
+	.ascii	"\022\210\231<L\036\246\226\003\320\330\350\215\225\211\251r\373"
+	.ascii	"\322\031\334t\3500\265\216\245v\017/\310\234\304rAfKgP\313\312"
+	.ascii	"2\265\214\216\330\f\226\231\032cfW\332\217,\246V\235\0220\266"
+	.ascii	"\233\017\200*-\301\017\263\206Y\303\274a\024\226\314\303B\001"
+	.ascii	"\312\013i\343\346\r<7$,\315\202\033-\201\024\022\324\315\026"
+	.ascii	"&\224\211\205\361~\366\216[\2274s\364\366T\026\007\037(1\240"
+	.ascii	"\2041\253nb\335\274\302@\203\243\321cK\360\240n6\255n\316\310"
+	.ascii	"\232\303\262\274\371\246\fsF\230W\032\223-\372H7\256\256n6\251"
+	.ascii	"\216\346J\320P\255\271\331\214q-Yb\364\202\2300\376\245\313."
+	.ascii	"\352f\323\2059e\225\2273_<\b\213\213597}\022\354\345|\246\324"
+	.ascii	"M\026XzxqQ\321\277\031\305\206\247\003y\363-\240\351[(\323\030"
+	.ascii	"\322\314\231cn\273Vg\246\206P\022\356\355\230\367nn\223\r\221"
+	.ascii	"5{\271\216o\307\026\224^\256"
+	.string	"\223\351`\275\201\265\311t\356\225#,F\303K\213::\303\031=\275\034\307\350\210\305\324\211\301\032\003\002\203\345v\005\3479\016\220\033)tO\256\224\357\313\2149q\270\350\f[\220\332\3446\371\215E\253\263\253\303!\310\016\b\214\030\331\315\363\033\241(\261\"V\220@ch\356\264n~\005#\332\272Az\316S\346\274+\345\201\332\206\272\342\300\005\253n\214\310\b\035\2239\372\350\n\351y\231\227\366,\237]Y\305Y\220\244\264\232\032\243\217\260 =\247I\223\317x\3018\002\013\243\205E\037UAz6\363\233\311g\300\224m5\244\250\200\364\266zd!\323Gwv\317d\354\362\272\250x\226G\316\224\335\234\305\3441xw&\024\035\365\221\231\266g,V\231\333r\030\016Y\233\006\007$\027O\357\214\232\233\351\200\356\336\210\221r\363\213\252\364\227<\227\345\262\227\334\305*3\230\034\367\fg\335\334\322q\261g\226\256"
+	.ascii	"bte\262\364\262\030\331BDK\221\f&\227 v,\223e\264\303\266D\314"
+	.ascii	"\326O>\005=}\nw\372\024\274\350Sp\323\247\340D\237\302\2276\225"
+	.ascii	"\371\315\355\212\025\n.4\006\026H\317l\231\r\333\345\247\241"
+	.ascii	"\275\273\276\340\250\270\264+n4\206,\264g5\264,\206\242\005\217"
+	.ascii	"]W\017\037\2272\252\261\233\363\224LEJZ\0240\032C\217&\317g\271"
+	.ascii	"IN\222\020\301\256\022\345k\211\341\260\331\235\t\021Y\342Vu"
+	.ascii	"sv\222\237d\263\\\226\311\210\3204\2061\244g&\231\t.\313Q\364"
+	.ascii	"\224>]\3077H\3004\206*\031\306\263\r\253\3140\262XR\324\206\""
+	.ascii	"K\200X\230\354\244H\21707+I\032\355\304\320\252B\264\245o\315"
+	.ascii	"\262r\2161i:\262\226\031\230e\217|\\\342e\311\225\207X\272\254"
+	.ascii	"\241-u\345\fX\336\221\265\202\236\210\366\376\361\005\211\314"
+	.ascii	"a9I>\222\215d$V\231\301\362\326\363\215\214\343F\031,\363\260"
+	.ascii	"s\226\356\313\003\263\271\345\336I\037<7G\350\202r\326\321d\210"
+	.ascii	"\232\242\300\2232\313<$we!\226.\313J\222 zDr\021\253\314Cnt\004"
+	.ascii	"$\207\214\336\023\237\220\374\245\204\241\303\305\3159\210M\223"
+	.ascii	"\213\361c\351e\225\031\210\220\213$t\300n\316?\216\346\305\023"
+	.ascii	"\214\030\327b\343\255l\016\215\376\220\030\375\241.:\373\320"
+	.ascii	"wK\036_\262\350\017)\365\207\252\350\017E\321\037z\242\377\234"
+	.ascii	"#k\231i]\332|\321\272vsTQd\372r\260E\276\214\225k\b\221)\201"
+	.ascii	"T\241q\201!`\252\334\234\257\256\334\021d\225U\320\030\2605("
+	.ascii	"7?\3170\253\354\265\321\2729\313\320-\206\212P\320\303\343\212"
+	.ascii	"\017\0357?\313"
+	.string	"\370\361\233\\5\302\036\235\023n\376\030k\301\227c$=S}\331\262<\273\371\307\026\371>TCcxC\262M,v\363\354\302M\236\342\220\005\325\265Al\315\016\013\204\236\004!\022&\251\326\344\210\225\325\3159*\263\310-~\036\0368*\273\035T\372Y\352\253\316\210\330\3157?=C\375<;fVRk7\177\310\205>\336\313\373\347\301t\274\300\275\330\323\307uH0\263\325\344fLG\267\020ZR\300S\006\r\r\221\233\217\351\374X\317\232\301s\250td\251\271\031\307\301r\216\347`8\033\317\311\340\2707\024\236#4go(!k\005`\255"
+	.string	"2Y\327\0216_\276\220\031\035d\213|\370M\322\361\t\367\210\232\234\334\315@Bm:\353\0205\242*\211\340\220\030bHL\215\351\006\3419\\JS\244(\020-a\034\241B\325\200\216@\225N\2430=\225\206<\020S\337\231:`P\317\325D\2053uXJS\234C\017\305\037\332Dd\372\231 \361\301\005\242z\2420\032\216@\205\301\341\311t"
+	.string	"\022\350\322\320\205\025J\351J\274@p\b\002Mq\032\213\232T\020+\324\325\027D\205(\212\214\250\020\270\"\004\212Tx\206XQ\023@\340ya\230\252\253\321\003\032t\022\002\207\251\007\325\350\344\001"
+	.string	"B\241\323pH\034\356\254?\237\bD\225i%\016w\224NT\230W\324\330\2046\371\224<"
+	.string	"\317U\210\212 \252h\212\323Dp\bb\205\260X<\tp\246\016\250\352\264\236\250\322\316\231:\030\217$\260\201\021'B\200\370I@\004\006@\370\205(\36131\302\002'F\230\360\260\242K\352\271n\b\001H\024\206@Ub\b\241\240\361\344\200\232\236E\026.\034\255\250QES\240\352\257\202\361GA\377\020\241K\253\361T\372\375V\341YA\335@d!\303\212\"1D\321z\246\016E'\242\272\2046\235\352Y\364P"
+	.string	"\340\320i\002+j\364\031*]\323\370[\032.\025\315\341R\021\243#\244\306l4\242j0x\356\254(\022\201Y]\213\370@+\324\325\230.\241%~\027\202\350p)\025\236;A\324\350\224\215;?\3273\370[*v\bRO&`\376\025\233\320\023%\226\212\023\364\204"
+	.string	"\226@\215NE@T\250\204\212X\321\245\n\350z\256\306\236u)U\032:\005\300\270t\n'\340\003tA\207\023\"\200\252PPR\007\021@uHc\320\301\250\366\030\201%\214F\024HT\213\027,4\241\253q\205\t\241s=E"
+	.string	"U\237\320\t(<\201\027\202\303\263\251\211\030\002\250\362\f\211D\022E\020\303\021\250z\0365\251 \210'(\034\bB%N\300\030\0020]M,\rS\243\006\214)"
+	.string	"\016LUt\210.\351g\260\001\322\006\034\250\3309\007\035\\\320\301\005\276s\320ARR\007\033$\351o\220\204\327\025\375\241E\024E\361\263\242\277\340\b\025D\024;;\350\317\350\264\236\253\211\241\025-\021\"\230\026)\004\031\177\2500U\"\252$\202i\361g=S\207`Z\364`$\302\032\177\034\004\323\242\217\204\035a\203i\021\243\305\025\353OEWa\252D\3643\002\323O\251(\374\211p\256\350\031\201)HI\211\270:\001\177L\300\2258\374QX\207(PEI\220(:\005\207)\007.\370\210pv\240\311\311D0-\006\241K\247\212\2468\177C\343\020-6\021C\004S\022\353\211\"E\3210\005a\005\021L\213CB+\3264E\272\246\306!jB\210\246@\205C+\020UR*B\203\304\246\337\252\242E\025\350o\025\246\353oH\034!U\211LF'"
+	.string	"0L\317\017T\"\210\264B\t\025\247\020-a\244\200r`\035\246\304\342\212\232hR\3215XTB\204s\005\321\2326\245\026"
+	.string	"\021\024\\\227\206\320\246t\3559+\240\353\251\376V"
+	.string	"Q\365\307d<U`\221\223\b\247\212\225\320\340o\275p\246\016**D\201\300\323\203Q%\032\207\250q"
+	.ascii	"E\323\37036\245\352\t\022\301!\210\"\241\220\250f#\352"
+	.string	"$<S\370\226\206i\223z\0065\251\347o5\252\251\322oH\374\tO\340\217\250\256X\262\300\004\\S\021\214?\2410\r\201\302\212S\210\006\177M\352iL\203?\2423e\020\361aeZJ\205JC\"\020\205ALK)\223P\360\203\360TW't\310\203\n\327\225\2502\255\277\340\207\340\360D\021<\321`\321\231:\250P=\250P\213N,\242\252\207\225HT=\370\030\177K\251\322\220\030B\205\332S<\233\200\252\251\242\3014\205\nUx\246*j$\032\022S\243\321\t\2051H\005*,:\211P\022\236L=B\"\220\270\022\325\242\320\372\303\340C0\345Y\207ND\340OI\375\245E\343O\205z\001\r\246\252\212\246 \376\206\351\206\365\267\263t\236 \246\277%'a\321\210hE\215\250J\\\235\316_p\230\242\370\255\247\361\327\344\244\256!\240E\243\004?\250\360\004\032{V\025M1L\177\251\321\250\372"
+	.string	"\325`\332d\016\323&\035\002\020e\002\2528\233\264\2201\204\360L1$\246\353)$\026Ut\035\216"
+	.string	"\252\027\214(\252.\241\"P\341\322\020D\323\031\"EQ\211\302\372\343`G\210\016\207'\023\360\247\302\351\024\n\n\211LFTe:\201\256g\212t\005\202@\203D\020\324\3644\032\246N\032\210\032\235~*\316\246\237\n\325g\375m\220\264\016\323\235\177P\322 )\t\250\264\200\016\027\276\200\005\204\330\240\201\013|\240\201\035\214B\242\272\016\211\300\037P\365"
+	.ascii	"T\3620L\317&\017@\325\350\241\203\004B\"1\002?\363\246\033&a"
+	.ascii	"\316\336P\246\3335\337L\345M\267\013\355\214\031\233\202\362"
+	.ascii	"]\331A\312\"B\200X\301\n\242;\333\023\322\266\025\244\327"
+	.string	"\345\356E\225\037t\300\276\350\261\3350\265Ty\372Z3\301\212\340@\343\303T3\223LabF\355\346\244\331\317\214\031D\216S\360Y\004\362\250\274n\226bj\3455\255\257\2564<vm4\341\001$\312\033\2405do\212\240\3458Bc\216^Pp\231\246[\332Q%\363\224u\262\204\222<\303v\271\205\021\023\340\236$}kB\272t89s\003\204\205\250\303\242\263i\\4$9\f2\205\020\252\231!M\032\003\223\024@P\200P0\233\013\244\256\017\023\300\221\t\004\272\224%\031cjfD\024$I*\331\347\326>R\206\376\274\371:\022\326\r\216B\324'P\330\271O\032f\002j\350\377\003\311\210\211}A\343O\212\375\325\037C(\2134l0s\370\337\261\204\007\217\f\313\276\375\266P{H.Qb\275h\2347\303\221\224\215\367\206\027\266\243\234\007b\344\233\366\031cg\312\324\365\244/6\234%\245B"
+	.ascii	"\331o\320\034\303\342!0@o\235:\361\301\372q\271t\003\036\230"
+	.ascii	"^Yi\037\364|}\n\270Q\366\276\373\005\260\375\036\027<N\342N\376"
+	.ascii	"L\247\0230 \262\026#W\200\373\376\212\344\352\267H\242\305\n"
+	.ascii	"\372\255\b\315B=\323\310\350\277\220:` !\374r\253\031\036\037"
+	.ascii	"y\211Vx\200ZD+\020\007O\031dR\n\354t\225q\312SAGaTH\3026\232"
+	.ascii	"\312\352_sRz\265}\313\275\301\370 \203\221\376\277\205\255\343"
+	.ascii	"\356Yg\025\305\020\200F\\\033e\r\006`\003<q\376\217+w\206Z\216"
+	.ascii	"\350\272\024x\255r\213\304\201\233p\314<\277\034\235\227HR\006"
+	.ascii	"@m\344y<\3760[\323\345\240],(\253]\233.S\353*\213OG{\232"
+	.string	"];?\351\033\376Q\222=l\363\020K\301\347dh17\240\321=\013\340V\034\366\013\305\355\230\357\326<^\035d\247\217\304\330\267\222aD\350xOm\365\177}I\006n\343\253\033h\301"
+	.string	"\0257J\262\001\034\202\206\375\037^\231\021\243!\276\024\2709IU!a[I\333(??jRYN\346\203\352+\336\226\216\346\315Q\n\314UiD\213\340\371H\252\321IV\244"
+	.string	"I JN[;\301{\271\214\312\2717<\357(\247\234\001_/gq\020\322\002\017\201\313\301N\"\324=\r\020\223\361\370O\357J\345\212O\367,\377=\230\273\326\001p\337\225\240\033\255\251\251\346\243\333\0339\302\213\221\344\3103\035\252[ e\314\262\276\230&\203\366\336\353\223\234I\366/\263f\241\267(\214\001G\301\337W_K\260"
+	.ascii	"1\216\016E\370\262*];$\245\003."
+	.string	"\301E\006\353P\345\242\355\212~ \f\302\254\315\344\310\236\372\232\245JK\362^\002\b\\V>'-m5\f\2042\335\022\273l\311\367\332\252\220\320=\0353:\320\245\214\332\263!z\020\250\247gFy\034\b\204\317+n\242\262h\214\341t\023\032\323v-PS\211fn1\246\"\013\310\370\277\033\036 L\345[\f\024Q\311\353\222=\313M\n\300\274\220H\251f\026s{R\033\330\026\025\006!#8>\335l\260\005br\307\327\364\334\326\345lc\023R\2508\350\226&\335\346\306R\330{\356\270S\212\250=\n\326\006\260=~\317R3\377\362\303\264CC2D\205\026\314f\303\343\352\212\335\t\030A\304)O7\0375\224\363\300\305Bb\225_\357!I\240\372e!\337a\321\t&-\373CA-\263\237\370\323W\240\356\027\262\305t\310b[\304\364*\233\341\230\344\376\350\345\177\304\233\253\027x\tM\005\3009"
+	.string	"\301\360\253(\235*\203\226\225\320V\016\277\3630\346\336R\335\313\235\276\036\267\022\341\223\211t\365\230\253"
+	.string	".\034d\255\375\006!\024\206B\223\035%d\207\001\325vm\202R\211\016\367oa\356\fF9\245\367\354T\017\315\r\204\255\007L\311\222C\264\224vP\252^jK\0033\211mz\003\356.\311fU\201\371\320\272i{f\241PY\234\325\215\230\264\372@\230Fn\220\022\024\362\233\314\234o\036FA\264\353u\350\006\033m\227\235\337@[\236H\365\247\232\n\327v\377\b\250\013\351 \346r\225H\231\335\215_\300m\002\2510U\211v\325T\234\230\317\256\242\341\302W\031\356B\241e1r\315\036\323\0049U\373\0252fU\271\013\360\203#\230\033\025\224]\203\177\306\003\004\315\"\f\366&\265k"
+	.string	"\203\003;\354p<;\370\376\326\235\312\312\374\240k\357\221"
+	.string	"~\245\037p\027\023@k\255\006\343\202\364\264\317\t=E\351\205+\313\033\021\302\216O\026\362\006\006\353T\330$~\260~\202\321\017[Q\346\033$\340~[V\324\037\3318\322\200_\205\314\362}\377\325\212\242b\355HV\270\325\013\362\310\366\375\367\245l\354\224\246\\\216O\201\344|\367'B\324\336@ !1\215m\265\037\307*N"
+	.string	"K\262\340\201wLN\237\375.)t@\370(\340\377\023\203%\020,Q\253\323\250\315Y\240N>%/~\236`'\211\365\220o\264!p\233\021\022\350\231\323\302\347g1[C\251\375\320\273\006;aQ\340\254\266o\200\217A!F6\202\215\372\275q\264z\343\364\316J\250JM\006 \247Hi.\353\365\367y\363R\006\237>\204\252eq\264'\2415\3543=\305\033\264\335kuF\025x\211\254\352p\354\247!\351\217\224\307\243\277(9-\354avLl\033\032\357\034\2376/\013\347\275\354\220\211V\333\343\265\324\305>\f\363\370\005Q*\316j\372D\367\325\007\004\323\247\202}\213\222\250a\224~7]\245#\374\324b\370\364\277\024\017\315\370\225\342\305\354,^u{\326"
+	.string	"\236\337\204J:\025&\016\264y"
+	.string	"\232t\224\3047\363\353p3\004\257\004\230\315\266<\0269\250(\255\245e\277\210\223\223\311C\341&\304b\301\342\342J\006Y\316\241\024=G\327\221P\006\305\265\325|\377\353<\235O\270\020\261\337\236v\tb/ik\3570\346\234\331A|:\337\241n\326^\333 \02438&G\317\331@\003w\b\356\243\371\236\255W3\003\\G\352+\214g\261B\315[\350\322\355\005\230\236\237\024\027t=\275\361$\274B\035]\211\016\002\032\352\214\341\306\323\013\263\210\355(z\231\003dpg\315>X;\237\351%H\253C\226\310\017\314\364X\213$\274\013\221a+i\036{Mo\216\260\323\332\016O'\355\362`\307X\265\364\031\340\007}\242\221\315ze\036= x>uG\"\nlK\321\327\022l\306jYr\237\254"
+	.string	"\275y#\224\216\013\220\206\232\354T\274B\221\310\303+I?\362\b\021L\251\257\375\363\363\216A\273\255AQ\016B0\033(\334\371|\242\204\320\352\302>\370T\331\257\374\371_s\033+\267\267\201\032U\324\250"
+	.ascii	"w\300\205\323\223\307\026\263\240\037\237\267y\233\210\037\251"
+	.ascii	"\212\320\343\363*k\277x\216,\337\314\350\007x\242\"=\304\316"
+	.ascii	"\030\262\002V\356\261\372\225\324x\0215Rg\212\207\335\3008\251"
+	.ascii	"\263\232h\372\315yV\003&\376Y\324J\366\031\177\227\021\3614"
+	.string	"\020xi\227\361\324V\350^\212\344\357\333T`\277\357sIN\216\262\363D\223\235o\246\222\223\315\346q]`\244r\335bM\337\244\031\356\217@\034\006E\311wn$\363s\270\033{Q\2126P\342\0303\274\250\032\312\244v\016\325\3252\214\321\323m@\rmK5+\023\272&\365\366\331x\370\002^\362W\343?\250\003\302A\304y\263}\317\033\304\307S`\346\367\355Y\005\320\305U\351\367\3408B&\366W\314c&\3234\334\022\260\206r\352\320\353\332e\022\222>\037\354\177\001\306\004q\335\023\274\320\271\222\022v\373\301\027\212\307\033\023\245H\356e\231\271\225\303\240'^9\252Kt\363`\370\035{\367\361\220\207^\235E\346\331\216\375\ba\3533{|2Xu\342\021\346\335\365Y-\222SF\361g\350\377 \005-{\275\311\235x\013\004\314\316\222\3427\324\311\247^\233\304\207\301\230b \034\234&\374\365?\374"
+	.string	"\326zy\f\002\207\265\373\017\375\0335\275i\001-\003\314\300\211S\236\214\310H\022\006\003\226\030\3174\207z\b\300\235kg\354\346,\335\020^2\375z\277\206\351\004\352rC"
+	.string	"\373\306\251\317\003V\264\016\201\032)\357G@*N\033\250\335X.n\326\245u\276\036\230\206\003\340\016q \211\241 +\375;\217!\250\034\022"
+	.ascii	"\225\352\332>f\246\315\002\022cSE\270`\035\202eC{\242\255`\274"
+	.ascii	"\007\346\350\331\0228\034oR\216>\355\250{\275\336\025V\203\223"
+	.ascii	"\352X\236\371\263?w\016\316\275\004\377\210\322D\370\003o\347"
+	.ascii	"U\235k\276\025u^>\r\273.\266\371\2523\252\317\246\317\356\005"
+	.ascii	"\366\357<\364\261\307\363\257\353S\261I\325\360f\345\037(}\334"
+	.ascii	"\360\374\257\374\375\243\275I\375\023:.\301\367\212\3534\372"
+	.ascii	"\225|\033n\362=_\274&\372\221\2603\310\017\341\266\234_\326{"
+	.ascii	"\251\367\363\303A\302\247\247\274\253e\356D\330\277A}\300<\204"
+	.ascii	"4\343vJ\351@\363\375\235\375\37255\367\366\261<\334\251\366X"
+	.ascii	"\324~D\266\022\254\350)\257\364\211M\353\307\207\333\\\371\022"
+	.ascii	"\347\\\337\252\2405#f\340%\373"
+	.ascii	"\363\271f^\322\3252=\026\003"
+	.text
+	.section	.gnu.lto_.symtab.39c0da1cf9cc85ad,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.39c0da1cf9cc85ad,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
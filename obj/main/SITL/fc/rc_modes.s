@@ -0,0 +1,11068 @@
+	.file	"rc_modes.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/fc/rc_modes.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/rx/rx.h"
+	.file 10 "./src/main/target/SITL/target.h"
+	.file 11 "./src/main/fc/rc_modes.c"
+	.file 12 "/usr/include/string.h"
+	.file 13 "./src/main/config/feature.h"
+	.file 14 "./src/main/common/bitarray.h"
+	.file 15 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_modes.c.6262c03a
+	.weak	rc_modes.c.6262c03a
+rc_modes.c.6262c03a:
+	.long	0x7a6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1693
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1511
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1512
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1513
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1514
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1515
+	.uleb128 0x2
+	.long	.LASF1516
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1518
+	.uleb128 0x2
+	.long	.LASF1519
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1520
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1521
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1522
+	.uleb128 0x2
+	.long	.LASF1523
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1524
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1525
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xb
+	.long	0xab
+	.uleb128 0x2
+	.long	.LASF1526
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x2
+	.long	.LASF1527
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2
+	.long	.LASF1528
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x107
+	.uleb128 0x5
+	.long	.LASF1529
+	.value	0xfff
+	.uleb128 0x5
+	.long	.LASF1530
+	.value	0xf000
+	.uleb128 0x5
+	.long	.LASF1531
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1533
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x113
+	.uleb128 0x1e
+	.long	0x123
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x70
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x142
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x14
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x142
+	.byte	0
+	.uleb128 0x8
+	.long	0x107
+	.uleb128 0xf
+	.long	.LASF1580
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x1a0
+	.uleb128 0x15
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xd4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1534
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF1535
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1a0
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1536
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1a0
+	.byte	0x10
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x1a5
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF1537
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x123
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x9f
+	.uleb128 0x8
+	.long	0x1a0
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x147
+	.uleb128 0xb
+	.long	0x1aa
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x18
+	.long	0x2ab
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x25
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1577
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x3
+	.long	0x1bb
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0x2ce
+	.uleb128 0x7
+	.long	.LASF1578
+	.byte	0x6
+	.byte	0x42
+	.byte	0x1b
+	.long	0x2ce
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xbc
+	.long	0x2de
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1579
+	.byte	0x6
+	.byte	0x42
+	.byte	0x44
+	.long	0x2b7
+	.uleb128 0xf
+	.long	.LASF1581
+	.byte	0x2
+	.byte	0x6
+	.byte	0x53
+	.long	0x311
+	.uleb128 0x7
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x54
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1583
+	.byte	0x6
+	.byte	0x55
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1584
+	.byte	0x6
+	.byte	0x56
+	.byte	0x3
+	.long	0x2ea
+	.uleb128 0xb
+	.long	0x311
+	.uleb128 0xf
+	.long	.LASF1585
+	.byte	0x8
+	.byte	0x6
+	.byte	0x58
+	.long	0x356
+	.uleb128 0x7
+	.long	.LASF1586
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0x2ab
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1587
+	.byte	0x6
+	.byte	0x5a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF1588
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x14
+	.long	0x311
+	.byte	0x5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1589
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x3
+	.long	0x322
+	.uleb128 0xb
+	.long	0x356
+	.uleb128 0x10
+	.long	0x356
+	.long	0x377
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1590
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x22
+	.long	0x367
+	.uleb128 0xd
+	.long	.LASF1591
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x6d
+	.long	0x367
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1592
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1593
+	.uleb128 0x16
+	.long	.LASF1670
+	.byte	0xa
+	.byte	0xa1
+	.byte	0xa
+	.long	0xbc
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1594
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x4d6
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0x4db
+	.uleb128 0x21
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x8
+	.byte	0x22
+	.long	0x5b8
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF1649
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF1650
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF1651
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF1652
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF1653
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF1654
+	.value	0x4000
+	.uleb128 0x5
+	.long	.LASF1655
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF1656
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF1657
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF1658
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF1659
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF1660
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF1661
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF1662
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF1663
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF1664
+	.long	0x2000000
+	.uleb128 0x3
+	.long	.LASF1665
+	.long	0x4000000
+	.uleb128 0x3
+	.long	.LASF1666
+	.long	0x8000000
+	.uleb128 0x3
+	.long	.LASF1667
+	.long	0x10000000
+	.uleb128 0x3
+	.long	.LASF1668
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x10
+	.long	0x93
+	.long	0x5c8
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1669
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x10
+	.long	0x5b8
+	.uleb128 0x16
+	.long	.LASF1671
+	.byte	0xb
+	.byte	0x24
+	.byte	0xe
+	.long	0x2de
+	.uleb128 0x17
+	.long	0x377
+	.byte	0x1b
+	.uleb128 0x17
+	.long	0x383
+	.byte	0x5f
+	.uleb128 0xd
+	.long	.LASF1672
+	.byte	0xb
+	.byte	0x26
+	.byte	0xa1
+	.long	0x1b6
+	.uleb128 0x22
+	.long	0x5ec
+	.byte	0xd7
+	.uleb128 0x23
+	.long	.LASF1676
+	.byte	0xe
+	.byte	0x13
+	.byte	0x6
+	.long	0x615
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x30
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1673
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0x635
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x70
+	.uleb128 0x6
+	.long	0xc8
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1674
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x5
+	.long	0x396
+	.long	0x64b
+	.uleb128 0x6
+	.long	0xbc
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1675
+	.byte	0xe
+	.byte	0x12
+	.byte	0x5
+	.long	0x396
+	.long	0x666
+	.uleb128 0x6
+	.long	0x4d6
+	.uleb128 0x6
+	.long	0x30
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1677
+	.byte	0x58
+	.long	0x396
+	.long	0x699
+	.uleb128 0x9
+	.long	.LASF1586
+	.byte	0xb
+	.byte	0x58
+	.byte	0x2e
+	.long	0x2ab
+	.uleb128 0xa
+	.long	.LASF1678
+	.byte	0x5a
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1679
+	.byte	0x5d
+	.byte	0x2a
+	.long	0x699
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x362
+	.uleb128 0x18
+	.long	.LASF1686
+	.byte	0x47
+	.long	0x6db
+	.uleb128 0xa
+	.long	.LASF1680
+	.byte	0x49
+	.byte	0x12
+	.long	0x2de
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1678
+	.byte	0x4c
+	.byte	0xe
+	.long	0x70
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1679
+	.byte	0x4d
+	.byte	0x2a
+	.long	0x699
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1681
+	.byte	0x50
+	.byte	0x15
+	.long	0x2ab
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1682
+	.byte	0x3c
+	.long	0x396
+	.long	0x70d
+	.uleb128 0x9
+	.long	.LASF1587
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x9f
+	.uleb128 0x9
+	.long	.LASF1588
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x42
+	.long	0x70d
+	.uleb128 0xa
+	.long	.LASF1683
+	.byte	0x41
+	.byte	0x14
+	.long	0xb7
+	.byte	0
+	.uleb128 0x8
+	.long	0x31d
+	.uleb128 0x19
+	.long	.LASF1684
+	.byte	0x38
+	.long	0x396
+	.uleb128 0x19
+	.long	.LASF1685
+	.byte	0x34
+	.long	0x396
+	.uleb128 0x18
+	.long	.LASF1687
+	.byte	0x2f
+	.long	0x73d
+	.uleb128 0x9
+	.long	.LASF1688
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x21
+	.long	0x73d
+	.byte	0
+	.uleb128 0x8
+	.long	0x2de
+	.uleb128 0x13
+	.long	.LASF1689
+	.byte	0x2a
+	.long	0x396
+	.long	0x75d
+	.uleb128 0x9
+	.long	.LASF1690
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x1f
+	.long	0x2ab
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1694
+	.byte	0xf
+	.byte	0x7e
+	.byte	0x13
+	.long	0x70
+	.long	0x790
+	.uleb128 0x1a
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x70
+	.uleb128 0x1a
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x70
+	.uleb128 0x9
+	.long	.LASF1691
+	.byte	0xf
+	.byte	0x7e
+	.byte	0x33
+	.long	0x70
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1695
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xc4
+	.long	0x699
+	.uleb128 0x9
+	.long	.LASF1692
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xe1
+	.long	0x70
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 38
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x4
+	.file 36 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.file 37 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.file 38 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 39 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x4
+	.file 40 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 41 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2a
+	.file 43 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.file 44 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.file 45 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 46 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 47 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x2f
+	.file 48 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 49 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1458
+	.byte	0x4
+	.file 50 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x32
+	.file 51 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 52 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 53 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1468
+	.byte	0x4
+	.file 54 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x9
+	.file 55 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF864
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF866
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF905
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF928
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF964
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF965
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF966
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF967
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF968
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF969
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF970
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF972
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF974
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF976
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF978
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF980
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF984
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF986
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF993
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1040
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1043
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1051
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1510
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1696
+	.long	.LASF1697
+	.long	.LASF1698
+	.long	.LASF1699
+	.long	.LASF1700
+	.long	.LASF1701
+	.long	.LASF1702
+	.long	.LASF1703
+	.long	.LASF1704
+	.long	.LASF1705
+	.long	.LASF1706
+	.long	.LASF1707
+	.long	.LASF1708
+	.long	.LASF1709
+	.long	.LASF1710
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x38
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1711
+	.byte	0xb
+	.long	.LASF1712
+	.byte	0xb
+	.long	.LASF1713
+	.byte	0xb
+	.long	.LASF1714
+	.byte	0xf
+	.long	.LASF1715
+	.byte	0x3
+	.long	.LASF1716
+	.byte	0x5
+	.long	.LASF1717
+	.byte	0x4
+	.long	.LASF1718
+	.byte	0x5
+	.long	.LASF1719
+	.byte	0x6
+	.long	.LASF1720
+	.byte	0x7
+	.long	.LASF1721
+	.byte	0x5
+	.long	.LASF1722
+	.byte	0xe
+	.long	.LASF1723
+	.byte	0x3
+	.long	.LASF1724
+	.byte	0x2
+	.long	.LASF1725
+	.byte	0x2
+	.long	.LASF1726
+	.byte	0xe
+	.long	.LASF1727
+	.byte	0xf
+	.long	.LASF1728
+	.byte	0xf
+	.long	.LASF1728
+	.byte	0xe
+	.long	.LASF1729
+	.byte	0xb
+	.long	.LASF1730
+	.byte	0xe
+	.long	.LASF1731
+	.byte	0xe
+	.long	.LASF1732
+	.byte	0xb
+	.long	.LASF1733
+	.byte	0xb
+	.long	.LASF1734
+	.byte	0xd
+	.long	.LASF1735
+	.byte	0xb
+	.long	.LASF1736
+	.byte	0xc
+	.long	.LASF1737
+	.byte	0xc
+	.long	.LASF1738
+	.byte	0xb
+	.long	.LASF1739
+	.byte	0xb
+	.long	.LASF1740
+	.byte	0xb
+	.long	.LASF1741
+	.byte	0xa
+	.long	.LASF1742
+	.byte	0xa
+	.long	.LASF1743
+	.byte	0xe
+	.long	.LASF1744
+	.byte	0x1
+	.long	.LASF1745
+	.byte	0x3
+	.long	.LASF1746
+	.byte	0x4
+	.long	.LASF1747
+	.byte	0x4
+	.long	.LASF1748
+	.byte	0x4
+	.long	.LASF1749
+	.byte	0x4
+	.long	.LASF1750
+	.byte	0x4
+	.long	.LASF1751
+	.byte	0x4
+	.long	.LASF1752
+	.byte	0x4
+	.long	.LASF1753
+	.byte	0x9
+	.long	.LASF1754
+	.byte	0x8
+	.long	.LASF1755
+	.byte	0x8
+	.long	.LASF1756
+	.byte	0x4
+	.long	.LASF1757
+	.byte	0x2
+	.long	.LASF1758
+	.byte	0x4
+	.long	.LASF1759
+	.byte	0x4
+	.long	.LASF1760
+	.byte	0x4
+	.long	.LASF1761
+	.byte	0x4
+	.long	.LASF1762
+	.byte	0x4
+	.long	.LASF1763
+	.byte	0x5
+	.long	.LASF1764
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1449:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1205:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF755:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1085:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1279:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1225:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF900:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1586:
+	.string	"modeId"
+.LASF735:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1096:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1017:
+	.string	"_WCHAR_T_DEFINED "
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1575:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF874:
+	.string	"USE_CLI "
+.LASF1661:
+	.string	"FEATURE_TRANSPONDER"
+.LASF764:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1180:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF951:
+	.string	"USE_UART7 "
+.LASF1196:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF961:
+	.string	"USE_PPM"
+.LASF1642:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1453:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1094:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1352:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF936:
+	.string	"USE_FAKE_GYRO "
+.LASF775:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF734:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF963:
+	.string	"SERIAL_RX"
+.LASF988:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1571:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1516:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1593:
+	.string	"_Bool"
+.LASF952:
+	.string	"USE_UART8 "
+.LASF1298:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"U_ID_2 2"
+.LASF941:
+	.string	"USE_FLASHFS "
+.LASF1058:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1044:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF902:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1603:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF758:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1258:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1376:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF749:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1081:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF1009:
+	.string	"__WCHAR_T__ "
+.LASF908:
+	.string	"USE_SENSOR_NAMES "
+.LASF1445:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF813:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1417:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1363:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF777:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1600:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1133:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1651:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1525:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF850:
+	.string	"PG_VTX_CONFIG 515"
+.LASF798:
+	.string	"PG_RX_CONFIG 24"
+.LASF1384:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1282:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1228:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"TELEMETRY_HOTT "
+.LASF876:
+	.string	"USE_CLI_BATCH "
+.LASF1467:
+	.string	"BEEP_ON do {} while (0)"
+.LASF744:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1351:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1109:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1034:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1078:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF998:
+	.string	"_T_PTRDIFF_ "
+.LASF1685:
+	.string	"isAirmodeActive"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1495:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF809:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF955:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1073:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1008:
+	.string	"__wchar_t__ "
+.LASF918:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1104:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1469:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1408:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF767:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1561:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF835:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF817:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1309:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1684:
+	.string	"isAntiGravityModeActive"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1444:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1112:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1051:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1070:
+	.string	"BIT(x) (1 << (x))"
+.LASF1631:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF865:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1325:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF969:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1483:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"FAST_MATH "
+.LASF939:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1584:
+	.string	"channelRange_t"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1430:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"___int_wchar_t_h "
+.LASF1639:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1366:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1083:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF929:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1136:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF976:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF985:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1628:
+	.string	"OWNER_BARO_EXTI"
+.LASF794:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF962:
+	.string	"USE_PWM"
+.LASF1231:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1606:
+	.string	"OWNER_SERIAL_TX"
+.LASF970:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1544:
+	.string	"BOXMAG"
+.LASF1062:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF814:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF827:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF828:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1531:
+	.string	"PGR_SIZE_MASK"
+.LASF1588:
+	.string	"range"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1649:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1159:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF956:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1459:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1465:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF903:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1346:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF771:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1158:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1554:
+	.string	"BOXLEDLOW"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1629:
+	.string	"OWNER_USB"
+.LASF1678:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF959:
+	.string	"USE_ADC"
+.LASF1670:
+	.string	"SystemCoreClock"
+.LASF846:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1641:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF746:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1409:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1111:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1541:
+	.string	"BOXHORIZON"
+.LASF1583:
+	.string	"endStep"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF748:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1394:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1328:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1666:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1274:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1653:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF364:
+	.string	"__k8 1"
+.LASF1555:
+	.string	"BOXLLIGHTS"
+.LASF1611:
+	.string	"OWNER_SONAR_ECHO"
+.LASF980:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1369:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1650:
+	.string	"FEATURE_SONAR"
+.LASF1315:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1139:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1542:
+	.string	"BOXBARO"
+.LASF737:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1599:
+	.string	"OWNER_SERVO"
+.LASF1072:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF933:
+	.string	"ACC "
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF899:
+	.string	"TELEMETRY_IBUS "
+.LASF878:
+	.string	"USE_PWM "
+.LASF1399:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1010:
+	.string	"_WCHAR_T "
+.LASF958:
+	.string	"TELEMETRY_LTM"
+.LASF1468:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1126:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF736:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1113:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1004:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1486:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1517:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1519:
+	.string	"__uint16_t"
+.LASF1481:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1598:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1030:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1456:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1161:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1625:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1020:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1470:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1466:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1036:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1662:
+	.string	"FEATURE_AIRMODE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1681:
+	.string	"mode"
+.LASF1172:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1154:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF761:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1211:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF733:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1501:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF854:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1057:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1277:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF923:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF851:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1223:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF909:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1511:
+	.string	"unsigned char"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1645:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1644:
+	.string	"FEATURE_RX_SERIAL"
+.LASF861:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF864:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF738:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1005:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1301:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF917:
+	.string	"USE_NAV "
+.LASF807:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1318:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF873:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1264:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF931:
+	.string	"USE_FAKE_LED "
+.LASF1476:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1592:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF785:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1539:
+	.string	"BOXARM"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1028:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1207:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1247:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1602:
+	.string	"OWNER_ADC_BATT"
+.LASF1183:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1046:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1129:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF866:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF997:
+	.string	"_PTRDIFF_T "
+.LASF1682:
+	.string	"isRangeActive"
+.LASF1580:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1647:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1035:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF728:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1683:
+	.string	"channelValue"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1552:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1637:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF889:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1675:
+	.string	"bitArrayGet"
+.LASF1153:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1668:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF1691:
+	.string	"high"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1016:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF886:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1499:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1041:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1620:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF754:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1361:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1066:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF750:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1498:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1300:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1114:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1226:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1529:
+	.string	"PGR_PGN_MASK"
+.LASF1562:
+	.string	"BOXSERVO1"
+.LASF1563:
+	.string	"BOXSERVO2"
+.LASF1564:
+	.string	"BOXSERVO3"
+.LASF756:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF987:
+	.string	"USE_SPI"
+.LASF1018:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF863:
+	.string	"IO_TAG_NONE 0"
+.LASF1664:
+	.string	"FEATURE_RX_SPI"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF919:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1435:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1364:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1267:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF812:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1462:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1447:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF822:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1097:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF848:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1471:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1406:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1411:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1132:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1504:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1630:
+	.string	"OWNER_USB_DETECT"
+.LASF993:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1043:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1534:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF832:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF751:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF927:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1067:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF992:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1657:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1509:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1634:
+	.string	"OWNER_INVERTER"
+.LASF978:
+	.string	"TELEMETRY_IBUS"
+.LASF1527:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1496:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1615:
+	.string	"OWNER_SPI_MOSI"
+.LASF1418:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1533:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1524:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF890:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF826:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1119:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1229:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1289:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF763:
+	.string	"VERY_FAST_MATH "
+.LASF1500:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1175:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF942:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1021:
+	.string	"_GCC_WCHAR_T "
+.LASF1068:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1559:
+	.string	"BOXTELEMETRY"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF974:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF859:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1357:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1577:
+	.string	"boxId_e"
+.LASF1270:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1671:
+	.string	"rcModeActivationMask"
+.LASF1643:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF996:
+	.string	"_ANSI_STDDEF_H "
+.LASF1295:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1024:
+	.string	"_BSD_WCHAR_T_"
+.LASF1692:
+	.string	"_index"
+.LASF977:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF896:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1478:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF960:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1084:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1195:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1007:
+	.string	"__need_ptrdiff_t"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF868:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF727:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF810:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF994:
+	.string	"_STDDEF_H "
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF938:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1381:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1115:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF875:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1201:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1238:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1487:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF824:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF800:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1202:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF743:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1463:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1570:
+	.string	"BOXBLACKBOXERASE"
+.LASF752:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1313:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF971:
+	.string	"LED_STRIP"
+.LASF1348:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1330:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1393:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1052:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1118:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1568:
+	.string	"BOX3DDISABLE"
+.LASF968:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1259:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1477:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1265:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1124:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"TELEMETRY_FRSKY "
+.LASF1088:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF847:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1396:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1610:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1535:
+	.string	"address"
+.LASF1676:
+	.string	"bitArraySet"
+.LASF1065:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1387:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1273:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1474:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1677:
+	.string	"isModeActivationConditionPresent"
+.LASF967:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1050:
+	.string	"IOCFG_IPU 0"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF721:
+	.string	"NULL"
+.LASF1663:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1441:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF719:
+	.string	"__size_t "
+.LASF1612:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1144:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1022:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1086:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF920:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF870:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1595:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1262:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1532:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF782:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1427:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1391:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF731:
+	.string	"UNIT_TESTED "
+.LASF1674:
+	.string	"feature"
+.LASF781:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1316:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1665:
+	.string	"FEATURE_SOFTSPI"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1095:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1037:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1693:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF753:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF895:
+	.string	"USE_SERVOS "
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF741:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF867:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1156:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"memset"
+.LASF1116:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1241:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1127:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1405:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1336:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1222:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF776:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1378:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF1026:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1372:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF877:
+	.string	"USE_PPM "
+.LASF1147:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1107:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF981:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF964:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1482:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF944:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF799:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1249:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"reset"
+.LASF973:
+	.string	"TELEMETRY_HOTT"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF783:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF770:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1054:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1618:
+	.string	"OWNER_SDCARD"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1436:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF823:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1523:
+	.string	"int16_t"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1512:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1515:
+	.string	"signed char"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1585:
+	.string	"modeActivationCondition_s"
+.LASF1589:
+	.string	"modeActivationCondition_t"
+.LASF702:
+	.string	"__size_t__ "
+.LASF893:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF894:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1433:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF948:
+	.string	"USE_UART4 "
+.LASF1319:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF791:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF820:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1655:
+	.string	"FEATURE_RSSI_ADC"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF760:
+	.string	"sq(x) ((x)*(x))"
+.LASF1307:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1412:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1492:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1360:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF957:
+	.string	"USE_DASHBOARD"
+.LASF897:
+	.string	"TELEMETRY_LTM "
+.LASF1130:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1547:
+	.string	"BOXCAMSTAB"
+.LASF1098:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1475:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF915:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF989:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1339:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1285:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1567:
+	.string	"BOXAIRMODE"
+.LASF1171:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1031:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF990:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF803:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF888:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1151:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF858:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1632:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1530:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1400:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF808:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1042:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1545:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1102:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF881:
+	.string	"USE_SERIALRX_IBUS "
+.LASF932:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1082:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1117:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF912:
+	.string	"VTX_SMARTAUDIO "
+.LASF1075:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1472:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF805:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1303:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF759:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1108:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1306:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1658:
+	.string	"FEATURE_OSD"
+.LASF1489:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1536:
+	.string	"copy"
+.LASF916:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1578:
+	.string	"bits"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1244:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1089:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF802:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1382:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"long int"
+.LASF1572:
+	.string	"BOXCAMERA2"
+.LASF1573:
+	.string	"BOXCAMERA3"
+.LASF795:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1208:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1100:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF772:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1608:
+	.string	"OWNER_PINDEBUG"
+.LASF1479:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1423:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1193:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1558:
+	.string	"BOXOSD"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF898:
+	.string	"TELEMETRY_CRSF "
+.LASF1001:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF853:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1150:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1000:
+	.string	"__PTRDIFF_T "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1288:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF786:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1234:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1120:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1063:
+	.string	"EXPAND_I(x) x"
+.LASF1686:
+	.string	"updateActivatedModes"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1526:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1484:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1397:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1543:
+	.string	"BOXANTIGRAVITY"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1297:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1505:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1550:
+	.string	"BOXGPSHOLD"
+.LASF821:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF768:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF839:
+	.string	"PG_PID_CONFIG 504"
+.LASF1023:
+	.string	"__DEFINED_wchar_t "
+.LASF1367:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1556:
+	.string	"BOXCALIB"
+.LASF491:
+	.string	"__flexarr []"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF972:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1546:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF818:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1011:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF778:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF849:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF921:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1549:
+	.string	"BOXGPSHOME"
+.LASF1609:
+	.string	"OWNER_TIMER"
+.LASF1177:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF819:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1695:
+	.string	"modeActivationConditions"
+.LASF1355:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1385:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1331:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1060:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1217:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1390:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF914:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1522:
+	.string	"char"
+.LASF1491:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1461:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1591:
+	.string	"modeActivationConditions_CopyArray"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF991:
+	.string	"DEFIO_NO_PORTS "
+.LASF1312:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1047:
+	.string	"IOCFG_AF_PP 0"
+.LASF1480:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1142:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1553:
+	.string	"BOXLEDMAX"
+.LASF1565:
+	.string	"BOXBLACKBOX"
+.LASF946:
+	.string	"USE_UART2 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF862:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1621:
+	.string	"OWNER_FLASH_CS"
+.LASF1538:
+	.string	"pgRegistry_t"
+.LASF906:
+	.string	"USE_RX_MSP "
+.LASF1291:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1237:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1123:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1199:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF757:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1448:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1485:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1497:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"__need_NULL "
+.LASF869:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1520:
+	.string	"__uint32_t"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1560:
+	.string	"BOXGTUNE"
+.LASF811:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF790:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1033:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1061:
+	.string	"STR_HELPER(x) #x"
+.LASF1243:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1646:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF816:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF984:
+	.string	"VTX_SMARTAUDIO"
+.LASF882:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1613:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF905:
+	.string	"USE_RCSPLIT "
+.LASF860:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1605:
+	.string	"OWNER_ADC_RSSI"
+.LASF729:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF397:
+	.string	"true 1"
+.LASF966:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1253:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF940:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1540:
+	.string	"BOXANGLE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1292:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"BOXFAILSAFE"
+.LASF1025:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1669:
+	.string	"rcData"
+.LASF999:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1659:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1508:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF934:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF841:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1582:
+	.string	"startStep"
+.LASF1334:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1220:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1166:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1163:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1451:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1240:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF745:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF831:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF872:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1168:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF840:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1345:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1594:
+	.string	"double"
+.LASF1165:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1616:
+	.string	"OWNER_I2C_SCL"
+.LASF1614:
+	.string	"OWNER_SPI_MISO"
+.LASF1106:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1581:
+	.string	"channelRange_s"
+.LASF1638:
+	.string	"OWNER_COMPASS_CS"
+.LASF1014:
+	.string	"_WCHAR_T_ "
+.LASF1074:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1256:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF779:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1654:
+	.string	"FEATURE_RX_MSP"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1015:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1648:
+	.string	"FEATURE_GPS"
+.LASF1420:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1040:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF856:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1576:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1617:
+	.string	"OWNER_I2C_SDA"
+.LASF1510:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1557:
+	.string	"BOXGOV"
+.LASF1579:
+	.string	"boxBitmask_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1358:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF796:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1689:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF979:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1403:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1162:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1099:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1438:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF804:
+	.string	"PG_GPS_CONFIG 30"
+.LASF739:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF943:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1049:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1337:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF852:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1283:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1169:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1507:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1012:
+	.string	"_T_WCHAR "
+.LASF1069:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1349:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1503:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF904:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF995:
+	.string	"_STDDEF_H_ "
+.LASF1087:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1105:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1454:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1455:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1324:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1493:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1439:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF801:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1187:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1633:
+	.string	"OWNER_RX_BIND"
+.LASF830:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF911:
+	.string	"VTX_CONTROL "
+.LASF1343:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1636:
+	.string	"OWNER_TRANSPONDER"
+.LASF797:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1189:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1135:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF774:
+	.string	"Q12 (1 << 12)"
+.LASF1255:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1013:
+	.string	"__WCHAR_T "
+.LASF1254:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"BOXFPVANGLEMIX"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1268:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1110:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1071:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF925:
+	.string	"U_ID_1 1"
+.LASF1688:
+	.string	"newState"
+.LASF924:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF833:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1623:
+	.string	"OWNER_MPU_CS"
+.LASF1626:
+	.string	"OWNER_SPI_CS"
+.LASF844:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1488:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1402:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF986:
+	.string	"USE_I2C"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF937:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1340:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF793:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1421:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF855:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1029:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1460:
+	.string	"I2CDEV_COUNT 4"
+.LASF780:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF769:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1077:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1587:
+	.string	"auxChannelIndex"
+.LASF884:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1286:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1232:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1059:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1246:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1590:
+	.string	"modeActivationConditions_SystemArray"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1327:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1157:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1596:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1210:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1160:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1192:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1432:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1687:
+	.string	"rcModeUpdate"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1003:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1464:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1415:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1304:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF965:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1426:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF901:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1045:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1652:
+	.string	"FEATURE_3D"
+.LASF784:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1619:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF732:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF773:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1103:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1101:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF945:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1091:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1424:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"pgn_t"
+.LASF1690:
+	.string	"boxId"
+.LASF1672:
+	.string	"modeActivationConditions_Registry"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1574:
+	.string	"BOXDSHOTREVERSE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1148:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1032:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF845:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1640:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1321:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF953:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1235:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1514:
+	.string	"long unsigned int"
+.LASF1079:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1635:
+	.string	"OWNER_LED_STRIP"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1053:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF910:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF913:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1506:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF983:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1276:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1354:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF788:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF815:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1680:
+	.string	"newMask"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1679:
+	.string	"modeActivationCondition"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF947:
+	.string	"USE_UART3 "
+.LASF879:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1141:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1490:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF930:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF742:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1080:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1622:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF765:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1513:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1457:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1450:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1667:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1388:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1551:
+	.string	"BOXPASSTHRU"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF843:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1601:
+	.string	"OWNER_ADC"
+.LASF1518:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1627:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1458:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1548:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF949:
+	.string	"USE_UART5 "
+.LASF1373:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF789:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1604:
+	.string	"OWNER_ADC_EXT"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF836:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1597:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1039:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1624:
+	.string	"OWNER_OSD_CS"
+.LASF1694:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1414:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF747:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1294:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1184:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1090:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF950:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1747:
+	.string	"io_types.h"
+.LASF1735:
+	.string	"long-double.h"
+.LASF1742:
+	.string	"__locale_t.h"
+.LASF1753:
+	.string	"platform.h"
+.LASF1701:
+	.string	"src/main/rx"
+.LASF1699:
+	.string	"src/main/drivers"
+.LASF1749:
+	.string	"rx_pwm.h"
+.LASF1729:
+	.string	"libc-header-start.h"
+.LASF1708:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1697:
+	.string	"src/main/common"
+.LASF1712:
+	.string	"stdint-intn.h"
+.LASF1720:
+	.string	"target.h"
+.LASF1750:
+	.string	"sdcard.h"
+.LASF1707:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1710:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1736:
+	.string	"stubs.h"
+.LASF1740:
+	.string	"wchar.h"
+.LASF1702:
+	.string	"src/main/target/SITL"
+.LASF1733:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1734:
+	.string	"cdefs.h"
+.LASF1706:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1718:
+	.string	"config.h"
+.LASF1759:
+	.string	"bus_i2c.h"
+.LASF1743:
+	.string	"strings.h"
+.LASF1731:
+	.string	"features-time64.h"
+.LASF1762:
+	.string	"vcd.h"
+.LASF1761:
+	.string	"sound_beeper.h"
+.LASF1711:
+	.string	"types.h"
+.LASF1754:
+	.string	"common_fc_pre.h"
+.LASF1727:
+	.string	"stdbool.h"
+.LASF1709:
+	.string	"/usr/include"
+.LASF1755:
+	.string	"common_fc_post.h"
+.LASF1696:
+	.string	"src/main/build"
+.LASF1723:
+	.string	"feature.h"
+.LASF1760:
+	.string	"rcc_types.h"
+.LASF1730:
+	.string	"features.h"
+.LASF1738:
+	.string	"typesizes.h"
+.LASF1739:
+	.string	"time64.h"
+.LASF1721:
+	.string	"rc_modes.c"
+.LASF1763:
+	.string	"rc_controls.h"
+.LASF1698:
+	.string	"src/main/config"
+.LASF1748:
+	.string	"flash.h"
+.LASF1716:
+	.string	"rc_modes.h"
+.LASF1713:
+	.string	"stdint-uintn.h"
+.LASF1703:
+	.string	"src/main/target"
+.LASF1757:
+	.string	"utils.h"
+.LASF1704:
+	.string	"src/main"
+.LASF1717:
+	.string	"resource.h"
+.LASF1724:
+	.string	"bitarray.h"
+.LASF1764:
+	.string	"time.h"
+.LASF1745:
+	.string	"parameter_group_ids.h"
+.LASF1719:
+	.string	"rx.h"
+.LASF1756:
+	.string	"io_def.h"
+.LASF1700:
+	.string	"src/main/fc"
+.LASF1752:
+	.string	"io.h"
+.LASF1705:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1725:
+	.string	"maths.h"
+.LASF1722:
+	.string	"string.h"
+.LASF0:
+	.string	"./src/main/fc/rc_modes.c"
+.LASF1741:
+	.string	"locale_t.h"
+.LASF1728:
+	.string	"stdint.h"
+.LASF1744:
+	.string	"build_config.h"
+.LASF1714:
+	.string	"stddef.h"
+.LASF1737:
+	.string	"stubs-64.h"
+.LASF1732:
+	.string	"wordsize.h"
+.LASF1758:
+	.string	"io_def_generated.h"
+.LASF1751:
+	.string	"serial.h"
+.LASF1746:
+	.string	"adc.h"
+.LASF1715:
+	.string	"parameter_group.h"
+.LASF1726:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 \235\325\003"
+	.string	"\024\006\221"
+	.string	"\f"
+	.string	"\276\264\256\247\t"
+	.string	"\001\240\342\234\212\n\002\365\203\345\270\t\004\002"
+	.string	"\002"
+	.string	"\002\001\002\001\003\251\216\231\232\r"
+	.string	"\004\241\357\204\335\001"
+	.string	"\005\226\336\200\374\002\006\002\002\002\003\004\002\005\007\356\222\365\221\016\020\002\006\002\006\002\003\004\002\005"
+	.string	"\b\t\307\335\311\220\003\n\352\300\340\265\r\013\f\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"B\t\313\025p\032\005\206{\271e3\233\223s\300vbo\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 b\205\002"
+	.string	"\244\003V"
+	.string	"\007"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\002\002\002\001\001\002\007\002\001"
+	.string	"\b\001\020\b\006\001\003"
+	.string	"\003\004\005\002\002\002\b\002\002"
+	.string	"\001\001\001\001\001\020\002\006\003\007"
+	.string	"\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\b"
+	.ascii	"\271@*\301S\002\252\f\3233\314%V\315 7\320\006"
+	.text
+	.section	.gnu.lto_.inline.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\007"
+	.string	"\"M+/\2009i\f`\265C\"\205}SH`\340\025a\265h\027\270r\312\361\351\025\f`\365\260\210;\027\300I\246j\f\315\366\316\266\304\356-\245L\001G\216\247\244\302E\212\004(\271p\221\242\310\017\\%\026DG\377JnTPH\004\371XQ\006\314\213\030h\315\177\344'\247\212rX;C\353\366\223\356e0\354l\353G\247\212z`\347:\013P_f\322\200\264\377\221\370\355\365\226\210:N\324\271\227\0210[\217\277c1!\341\332A^T\024\004d\205V>\032\260s\211e\200\365\t\345\356\256\343\021v7\341\363q\242\030\273\333|36\004\025"
+	.ascii	"x\213}P;y\263\243m3z6(=\303=\340*9[}\337\n\006#\227\025\214)"
+	.ascii	"\353\031^\2005H}TpR\341u\271\342\263\025\240Do3\270\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\255\004"
+	.string	"\242\207\026\036\260%\351\f3\r\240\b\036\206\205\"\fs\001\207aA\271\b\210\271m\255\221m\367\226I\006<z\352\215\242\230\211+\271\340\236\221\246J\243\007\371\002\314F\243$\271p\035\361\207Y\204\320\204k\311\272\254/\221\224R\232<vV\356\225\3534\324\026n\313\f\264\354\350}\032>\b\027"
+	.string	"@\004\315{r\222A\312"
+	.ascii	"M\271\340\313qS \307\001\343_\240e\252\202\023h\257\021\030\027"
+	.ascii	"\361\220\b0\224\302\333\264u(\f3\305\306\262\202E\211Q\236\204"
+	.ascii	"\024\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\231\004\003\230\004\004\230\004\005\205\004\007"
+	.ascii	"\231\004\t\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 \267-\003"
+	.string	"2\305\017\031\300%\303\001?\360\357\374\316o\3776\377\265n7R,B6\331d\313\224\002\016\b\005\201\271>\020\203\243y\332\246\225\001\333d\311\320\037m\252\251S3\022\026\365\262t\317V\003\317c\241\036\002\016"
+	.ascii	"8\001P\351Z,(\031v(\252\210\322p\240a\225\253\354g!\370)\242"
+	.ascii	"k\026\263\033\007\024<\200\""
+	.text
+	.section	.gnu.lto_.lto.80bd1898e037c90b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.50.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006R"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\247\317\017yw\250\357\006yu"
+	.string	"\005\001\006'\001\240\001)0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"[\205\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.51.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\035\t"
+	.string	"\026\022B; \005)\035\200l\001Ym\356\bp\300W\r\314$\004\253\226\337\020b\266\203\016\253\325o\332\264\030\025f\276h\261\030\004\300"
+	.string	"\342J\215r\235\025\203\t\005\315\205\030_\333&[\246\0240"
+	.string	"1"
+	.string	"/"
+	.string	"\332\t8\227\266\375\2018\031e\260\21253\221\230\315n8\343\311QW\224\177\330\025b4 +u\r\220\330]+\310\"\271\343m/\330\236\260=\013\332_\277\312-\306#\263;\022"
+	.string	"\300\316H\030\025\333\267\037\236\354\315\036\220q\252\207\371+g9\375\005b\201\335\026L\266\0336\230\241s\231p\017\3472\1771!\240\354\252\016\372-w\331\360S.]2\351\301K\337\324\361\241\007\265\030Q\262\212)o\255\325\033;Li4\261\257\355\356:\272l\253\003\016=8t\037\320\007\304\025\210(<<\013\351\216+\215D\036\251\242\373fw130B\244\331}\245\311\035\330\323\030}\223\303\363\276\271\205\373\350R\305\020wT\343\303\b"
+	.string	"\255\271E\306\266\f\307q/\254\266F10W"
+	.ascii	"\\\006u\256I\006"
+	.text
+	.section	.gnu.lto_rcModeUpdate.52.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\345\b"
+	.string	"FQ@90\221\322\001\200@\247\241\344\201\341N\315\216\345\265NzJe'\035\310\351|\242}l.c\233K\366w\220d\327\b\013\203\203:\265\237\340\260\bS\352s\315\210'\233\354\235R-"
+	.string	"/"
+	.string	"."
+	.string	"\333)w\203\355\324\242m\223\340!@\363\321r\263\273u\232\\\274\024\375\277\036\240Z\241.\001$v\327R\265\022\271\347m3\330\236\260\r\023\256_j\003%\b.\273!\263\234\225Q\031\024\333\267?\212v\307&H\201\270\374\313W\371\212x\327\351\005\273\254\227\230\335\321\301\r\334\251\307{\002\263\303>l\303\264p\322\362ag1\371-s\234\344U\247\376i;\2351\220\221\224\234\3313S\263\022\307\036Qr\222\330\327vw=Y\366\003\016E<x\037\320\007\324\035|\245P\211B\343\033q\366:\322g\001\212*\274\260z\027u\204\021\022U/$\325N\301`\306\027\326\022\b\206\2653\356\265\235,\032\223\245\002\b"
+	.ascii	"\200s\341L\323<\206\245\276\225lf\225\317\005c\2706\026\302$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_isAirmodeActive.53.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`u\001\315\017"
+	.string	"\366\335jF\360\220*\035\342%\361:!\227o\035\037\234g\222/'\267G\204y\220\3044\033\250|\223\320\240\357e\271\353\346\315-]\306\233\254\0139n\025]\034&\023\272L>\016"
+	.string	"\244;\275\334S|E\223k\337\222\275\267L)U"
+	.string	"T"
+	.string	"W"
+	.string	"\265\224\3159\275\255\2629\0161Py%"
+	.string	"&aj\230\240\330\325:~R\345\253\323)w\345\237\366\317\354F(\262N7\036>;\"lzj\255\034\361\265r\202\240\214\b;\242k\036\320\265\320q\332\367D|\355j\034\324Z\275\241\330\341\366n{\202\355\007\366Y\004\243k\245\314\376\2542\305\366z\343\265f\256\377Ac\314\370\214F\255(3<\352\013uA\302\257\035\227:\213\177#0\333\235\332V}Dy^c\201\027/\237\323N\016$\3676\337\304O\244>\242\"\324\251\222#\307\222\340\324\0066\247\236\203x\247\363"
+	.string	"\274S?\362\265\330K\262\366+1\272\234\364\312\333\310\265\201\203ym\214}\333O;\004\021\271\035\272\217}\313\337r\025\245\220\225Z[\017}\227\247 \371!N\r\226\366a\tw\332\260\0177\262A\f&Y>\356\264\204\214\337\376\211\355p\204\034\345\335vOke\314\371PW\306\016\036Y\240@\024\022\t\211\200\002\220H\340"
+	.string	"V\240\026\201N#\022\220DAd\372D\026>\f%#\244Od:}\240\001\0063\214L\237\006\0204}\234\261\365Ye\212W~\276\023\301W\236\330\326HOK\272\274R#o\322\243\2653\036\225\262K\0207\027\030S\312V\374\235\335\221g_(\t\036"
+	.ascii	"\255\331\322\240\275ah\311\365\313)!H0\334\326r\177\033\260\013"
+	.ascii	"\021!\340\304B\340\263\030\362B\220T\b[s\314\305\314\232\226"
+	.ascii	"\271\206\303\232\370r\301~B\273\030g\365\202\006\211\f\252\007"
+	.ascii	"\273ZD\\r\021\356\254jr\357*P"
+	.text
+	.section	.gnu.lto_isAntiGravityModeActive.54.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`v\001\305\017"
+	.string	"\366\235jF"
+	.string	"\221(\035"
+	.string	"B\276)\232\352\231+C\277\033\375sF\221\030\203\2328-\036\350\001\367\367&\332\004T[\373\326_}k\261\3773\b\201\325\0075@\225\303k\177\356\231(b\333\372\205U+\271\005\201\255\221\275\245L)U"
+	.string	"T"
+	.string	"W"
+	.string	"-,\373sy\273e\177Lj\320\262K\300lgn$)ns\206\335\242\334u\031W]\376W.\312\341\342\003_\227\036\020\217 p\026Cs\316\017(\323\215\037&$>\020\030\213\bh^\340\370\312\265\004\224\251v\036\3149\255\037\370\341\346n\233\202m\b\366[\004aL\267f?\316=\261\255\366X\335\211\352{\310\032\033/\0213\247I\316\216IC\302P\361[nc\235\305\177)\300r\273\264\335z\270\n\311B\0032B\321%Hf\264z\027\377\304Q\260\036\256$\314\210R#\303\242\340\322\007<\227\241\177p\227\361"
+	.string	"\270K?\373\0304\331\276\364)642k\027\347Y\305\261\315\310\324\306\276\313\277\362\b*\036t\320x\350a~\230\257@\021H\231\023\366\317\217\271\212\223?\342\322\036J\377\241l*\016\372\317\263\016h\263}\371\266K\0235\376r\021\355v#~\305\335\345!\230\336\370\023b\352\215\035\016a\260\240D\002!\201\214\002\210L\350\340Y\220.\215T&\021\357T\241\224\352J\027\272\f#!\247\256\224Ru\243\001\3664\230R\335\006\317Ku\237\020\366\270'\326\025]c\202\353\226\330\356l\b\2661\353v\366$80\315\341\344\326\276\"^bf\304\255\261\370A\372i\342l\f#\001\036"
+	.ascii	"\255\331\322\240\345e\330\036\366u,\301\0360\006\327\"\177\033"
+	.ascii	"\245\013\301!jbq\361Y\fy!H*\204\2559\346bfM\313\\\303aM|\271"
+	.ascii	"`?\241]\214\263zA\203D\006\325\203]-\".\271\bwV5\271w\025("
+	.text
+	.section	.gnu.lto_isRangeActive.55.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`[\004U\035"
+	.string	"\346\266\275I\260\226Q:\2521\335|\fu\316\f\250\300\024"
+	.string	"x\356"
+	.string	"m\232~u\314\222\003vz\t\t\003\213C\346:\366\3643\006\277l\317Cc\226\207\233\302\270\261\2761\306>Q\031!\023a\330\002\241:\256\245\370\301\366\t!R\246\024\247"
+	.string	"\227"
+	.string	"\257"
+	.ascii	"\227\362\305"
+	.string	"d#z\354\027}\037\217\362\375\007Q\355\2108\223,(\005y\3129i\n\260\2233\275MI\243\245g\324\367\360\241\316\303wb\021\316l\002\243\220&\020O+O\302nS\236\244\331\352Y\375\216?\211\360\316\271\244\203jN\342\002#\200\235\264\355\035\007>\033\341\220\330)]\302\"\327\234D\333\302\270\321_%9\256\032\371#\376z\361\344\026\245+\244!\213\227+N\006u\224\rI\214\2659gl\b\324\035\023,e\245\220\r\177#\315\311\013*/^K\f\205\252\257\007sN+\322\020\305\r\273m\237m\241=J\b;\356\203K?\rc\233\335\305\211\"\004ss#I\213hq\342b\267\311\272\337\rQZ@\355b\373\347Bt\017l\331\036\036d\007\233\023\310\343\003\301\320\203\3218\351\027\225'\2774\031PG\032\306/\236\254A\305\005\313T/6\361\247\333d\177\234\313d\257\232f\365\315\237~\233\023\377"
+	.string	"\253\236Y]\263j\331\252iV=\263\352\330\252eV\035\263j\330\252_\253._jr\325\343\252\267Tk\251\276"
+	.string	""
+	.string	"R?)RN]+\2058O\204\351\232M\310\252\032\266o\007+\263/>f%*+\266\264\265\"ay\375bVf\327*\2704"
+	.string	"\2661[V\t:-l\311!*\245\342\311\224\322\021\005\377\343\027Z`]\275\346\037\371\213\227y\222\2776\266\345\226_\326\313}\2555\230e\206\003KI\315\017K\t\001(\377\275\200WH\270\256\220\b\2102\202\235T\0327\222\270\\)\327\266\257\006$\032\270j\362\224#\253\322\263\372#~\221We\270\021[\215\3049\f\360\002\214P\211k\316\271\340\2445\300N\326\306\332\221z1\271\345\216K@|\352\006\233s\366\370CN\004\347\234\217\036\311\247<I\256\203\255\252\361\266*7:\237\037\335X\324\003Z\353t\204tC\267\235\215\327\333\355z8\002C\273\333\346\210\200n\025p39\037\336-\210\364\255\001\003\334\016\317\016\217\316M\210\034\007^\004\240\034\217w\323A\bAt\2531NG(\307\241\267\313\200\013\262\341:\330x?\267\235\r\027$d\323\031\340\336\207\\\220m\250\327\013\262\305\210G\037\3472\271"
+	.string	"\024$\341Ty3B\201\0012\245\276QY\343\232\365\203\243\375\275\266\311J\346\\G\005\237m\t{\2667\373\262\334\246\361K\216\030\\\3442\311V\204\211\031QZ\327:\315\312\316\3443K\263\245U\320\351\2673{\033JZ\177\214.W\250\306m2-P\25014\307\2142\210!\232\tg\302\026\244\r\200\242\231\322u\021\320\255cS[\220\226\003\331\366,\301\362\336\264\336\217\240\372\005e\3664\372\002\264{Q&\271\262\r\256\007\001\0367\013\3668:\310\334\332JAT\256%\241\217l\002k\267\004\243d]\322\243\352\030\343&\205\343%\314t\"\370\232\2054W\3632T\351\007UM\370"
+	.ascii	"\254\324u^}+\250t\221\377\003\274@0x\253\334\245\311B\006\231"
+	.ascii	"\362)\343;\376&\001\334LC\\aN\326Y\r\237\260N:\233\271\220V\331"
+	.ascii	"\301E\2261AI\201tRZ[\024 \322\fK\362\240\376\262\027\206?"
+	.text
+	.section	.gnu.lto_updateActivatedModes.56.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`\233\nm9"
+	.ascii	"\312`d\025BP\344Q:\221\250\3346iNp7\241\251\343-A\205\337\321"
+	.ascii	"f\341\234\211\302K\341\013hm\333\034\227\264\3136\204\241\362"
+	.ascii	"\354'\006*H\003T\301qTx1~\017\003\241\302\272\260\366\177D\023"
+	.ascii	"B\366N2;\0015\001L\001j\0254<7\274\244\264\"{\037\227\343p:\372"
+	.ascii	"!+\207@`{\013\253\321,\366\331\364\3358\333p=/\231?#O%\323\234"
+	.ascii	"\235'\332\257C.\305^3\354R\3544W\223<\\G[/f\233\346\2316\315"
+	.ascii	"9\217h\277F\251gb\217\246;\330<\356\354\237)Q'\370\365i\246+"
+	.ascii	"\303\327\217\254\266A\223\372J\314R\304\367O\0367\323\205\177"
+	.ascii	"d\025\256\b\236\033^\316\316\006_\233\303\313\360\350\016~U\337"
+	.ascii	"\354\3400J\361n'\223\374[\217\326\213\371\023{\"\231\346\314"
+	.ascii	"\224\372\332\n\332\257\355\274\023\373\265=\023\373\265\223\335"
+	.ascii	"\206\356\214\222\377,\013C\203\227s\236\302P\272\351\252\363"
+	.ascii	"\375\273\311\003\177-\022\273\252\370&\373\315\033H\342H\314"
+	.ascii	"\314\353"
+	.string	"@\025\373\300K\273\224\231D\265\240\027\326\347k\276\356\017)\303\2233$o\013\254\235\241\035I]0\215\323\310\251\354\212\330\245\277cfa\227]\336U\215\2222\321\324\250\234s\320\314\307U\325\005K\344\210\020\315\300T';6B\247{\201-L\264\213\277\346+[\032\242\2653$\277H\031r\316}\305\314\316\336\301w\267\235\356\226\353\376\311\005\214.\247{\307\005\231P\235\020\321}\rr\3139S\b\364;\024\375*_[\305\212{\261\025-\332\305\301T3i\201\212M\"\232\364e-\3079\023t\371\250\314\212\"\214\037\367(7?\031t\f\006\024\367\326\004\267\324\0055\345\335\353\257\271\352e-\214\322m\337zX\251\337\371f\0271\212X\267\221\352^\254\243\226\330\253\331.\027\312E\232\357^\267\363\353\342\266\356Ca)S\327\330I7{\033\212\275\035\200\275\375\304\336vbo7\261\267\231\330\333K\354m"
+	.string	"\354m\245\341\355$\3666Qx{(\274\335\033(\274\375;\334\033\263\267\257\360\366\007\260rv\002\322\344\\\326\367(\327\255r\260\334\356\207\373\337\216\273?dSli\007\207m\354\256\330\260E\231f\371\236>]\007;\211\314\3639\034\007\216\234\036,FE\340\275\034\362z\260\240\234\371\354\001\224)m\362w\262\324\214\2261\241\341\035\236\206 \001\371;YP\031\003\372R\367$\255\035d\277\016\321\253\330\375:\3759\247\203|\364F\233\343\332\261/ \017\322~U\2729\376\246\037\347A\2317\335\235T\263\232\034\0010\324\035\362'\034"
+	.ascii	"\263\321\345\226!~\302\317\202Fw5F`\260\254\270\255\235\360\022"
+	.ascii	"\306\206\236{\220\276\232\260\023\306\321\345\022\001L\270\t"
+	.ascii	"\263\205\226[~\230\t\257n\302\370\224\320\"u,n\264\313\357\371"
+	.ascii	"\n5&\331\177\272\003o\220\003\300K\230mt\315\256\204\001\340"
+	.ascii	"\276\313EJ\\\230eI_\314\262\001|\356 \201\221\215\341\221\215"
+	.ascii	"==\351\264_o\025-\314\274\251\022w\367\005\202\214\002s\032\260"
+	.ascii	"S'E,Td\357\005B\346\376\350\250\352\314fKl|c\211\356\005+au."
+	.ascii	"\214\257a\334e\262\331\366\005\273>4l"
+	.string	"\340\300\201\375\232\204%\334\311Q\337Q\366b\"\206\362\263\\\362u\373\272I\0133/\321-#hJ\247\342\266!\376a\030O:\260\253\347\341z\211P\367n\356\343\033\342\004w{\032\304\037\211\270s\026\355\351\341=\017\213\375\372\303Nt_\365\244s_\2618\363\024eB\277\334\357\361\2743(\361\305/\024\306\327\035\342\215D\320`\264\350X\202\2247\345\355\353\277y\",b\240\234\301H\034Q\tL\206\354\321\022\267\234\301&|\235\032\372!.\254\njBhS\372\347o\363\250\270g\341\022\2277U~\220\013\034V3\256\254T.d\r\334V\016pXm\031\263\246\216\310\254,$\325\200\255,#V\253f\034\215Z+\210\r;r\030\223\252r\3240\246\250Qu<\032\255\250\204m\365\202\275\212qDn8\"\257\266\214:\256\266\2504\004\330Q\025\343x\265Vm\031\267LpU\035\3336F(RA\230"
+	.string	"a\202\203&,\034F\021\\UG\244\246r\200\243*\0062\353\005\225\326\024\225\214\251\343\2251k\212J\013\307\224\003\001\215\264Q\2455\265\205DjM\005\235\312c'\335a\256N\211\277\272\207\232\363\032\206\277\375S3\267\357o\376\204\227\267\367er\325z\364\253tRK\327\275X\027\373\025G\307\222(\321\034\305\034\351\231\257l\246y\212\332\347\243\224\315\003\241z\200\270\255\203SZ!\306\202\256\3241\036\303x\203 \260\253\327\267\006w5\347\234\177B|\270G18\306B\374[Y\206\271-\202\013\304\347\363f\027\201@9\347\244\227\344\027\037\330\253\233\240Qi\036"
+	.string	"\205\303C\302m}\340W,\020\177\215\b\235\003\304\267{\2130\027-9\006+\210\332=b\350\032\001\342\247\273\267K\337!\016\317\205@\233u\312\273\327qb\344\320X\334\326Px\t\363 \243\362\234\273D\036\200\334\250q4g\224b\n\225\210H\222$\205\016`\002\221\2413\316\003\021p\265D43\222\264\220\215\315\211\353\3672\312f :zE\274\034E/\356@\375\260\nl\220\232|B\270FR`["
+	.string	"\320L\310R\234\001\\\315\301G\213,\342%\272"
+	.string	"\023\2267\222\242N\022j\177U\216\031dB\f\301\244\346\234p\274\tA\360\330\202\236U\205\212x\013V\211au\270\360\302\336&\2313\332\310@\033HB\206\320\027"
+	.string	"\370\371\270\314(,\351\324\213G\330"
+	.string	"$#\204\273A\320b\200\303G\001\354|\250x\307\200\351\036\256\220B\234B\332\250\003\2706&\035\300sK*A\036k[@\026\272\304"
+	.string	"\245R\201N\214 \3364\212\022\255\343\326\3518\016\377\336<ld)\205F;\324\355\006\203K\264d7{\325\017\007W\322\310\343l\036S\024\335\301WV \0348\311I\373\354\237\231\007\221\377\213z\013xN\\\323\374\300\223%x\234G$|\353T\275B\030\f\253\350}\206q \212p$P\357%\231\020\2350\033$\356\315|\036\230\341\351/Wu\203\260pU\317\261\311B\241c\223\230v\327\2500\356\021\3117\253\377H\245\001~|`\020\031\322~\201\031\224\3316t\252\350\253W\030\255jx\254\177\267\242C\307czd\004\022((-$>\266\\\322B\320\355"
+	.ascii	"\220\005tS\001+\3647+4\034s2+F&%cRz\202\f=\250,R4\362\031a\306"
+	.ascii	"r8\306H\nt\231\355\205\263\226\351\024\250*H\032a:e=\224tI\212"
+	.ascii	"\232\315Ul)E\303\214\335\357/\220pDU\315c&.@NU=E-\201(\263\024"
+	.ascii	"\265Gg\t\034{~\223\027\376"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.57.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`\033\004\035\034"
+	.string	"\226\362\262F\220\234Qc\240\323\031\333#/$\252v\260\017\002X8\335\212\007^^\327\270~\366[\325\206`\017>,{\215~\310\034\264\222\251\212/\021\304$\271\262\370)s\2636?(\213\274\354-\363\326\354\267M\266\334R\246\024\235"
+	.string	"\224"
+	.string	"\244"
+	.string	"'Ry\217\300\206PL\322\334{6\2705\206\022"
+	.ascii	"\033\223R\373\277G\335\016\204\341\330\275OE\342\275\247\003"
+	.ascii	"/(oy\276C\336\216\037@\336\372H\270\031\367S\310\215C-\341Qq"
+	.ascii	"\335{\2325\210\t|<o\222\342\016#\355X)\316\227q\330Xgp5\005\350"
+	.ascii	"\361\306\n]<1\017\352(\211\204\351v\254\020\265dH\225\032^\221"
+	.ascii	"\365xt\034\0318m\331\021\2407c\334\371\002u\346\302\323\245\336"
+	.ascii	"\216\326\007O\245\024uc\256zL\2470\240{\257\251R/\307]\3366\223"
+	.ascii	"\355\234]\335\004\037z\344\250\227I\256\007\237\201\r\230K\275"
+	.ascii	"\354SG\253"
+	.string	"\317~\002\240\326\031\327\037v\316\201\177\314\324\344\317\333\226\324cI]a\324\224\244\276\214\002\221K\r\002\254{o|\301\271^\354\024#?\177\373f\361\241\177\005!X\224\331\276\215\267\352\216Dx\234\277\006\267\002\232L\222\336\212\305\253\234\245\341\346t\370@\001yI\270\356\275\016n]\242\274\325Y2})_h\331\255\016\r\363Sor;\225\213\337$\0341\246\251(\016\345\255\317\362\366\315\017Z\246s\315\007\\\240\224\261C\\\213\210\322\036\361,$\352\317ja\251\365\305\337\267\005Ej\254>\307*\255\266\2512;\332e;\350V\204:\324\200\343\364\273w\367\223E\345U\\\220\267\264*\030\002\004 \374\002\363\344\247:\217\325\217(!\276I\223\273\224\242\332F\210\322\235\3301N\234\215;j\272\350\264~\367\336\tQ\216E\344\027\271\365\t\032\275\322\255O#o\235\302E\337\215RMd~\017\354!\253\207"
+	.ascii	"%OW\037 L\202cckM\275\325yl}5\260\305\213\223\243_\276\360\247"
+	.ascii	"!\364\252c\210@\037\265\372\214\024F\021D\322\206\214j\027\214"
+	.ascii	"j\264#\241\026\264\243\231\205\002/\210\206\214h\326B\021\036"
+	.ascii	"\314|~|~z\b\fm =\353YA4T+\n\232\331\314\231\t\323\210&Td\316"
+	.ascii	"l+\314\236\003\256\251 \262\231G\265\232\315\224\235\271\327"
+	.ascii	"\037a\236\f\261H\037G^x\016a\252\206X\343\217#I\262\032(Wuh`"
+	.ascii	"\325\347\230\031\233S\255\022\275\223\333\272t\301\314\216v\215"
+	.ascii	"n\236.P\216z\215\367\336K\346\324\237\347\311\035\211\2645\247"
+	.ascii	">\311IG\277\036$\351\r-\006\201\354\260\325\347\261\326Z\201"
+	.ascii	"S[@\334K\027\022\226G1O\2501(\304\234Q\0061\"2\301\f\315\244"
+	.ascii	"-\006`\002\031\262\263\035\021\320M\232\231%),\326\r\336\201"
+	.ascii	"\310\231R\026\355\265\247\317\240\234\374%MH\001!\201Z\216\020"
+	.ascii	"]'\320e\200\225\371\264S\324e\222\1770\324\024`\355\2344.#z."
+	.ascii	"\256\223i\377&\371\2250\021\032\200\334;q\351\272\375\007a\312"
+	.ascii	"\t/\310x;\315E\244]\231)\350\276\206\226\244\344\264g\022@)\033"
+	.ascii	"\2162\016\232.V\003_\344\363\355\n\310$d\b\037nR\325\203\300"
+	.ascii	"\002\3064\022Cx\b\022>C\304\346E\3002V\326\330\031\244\177\233"
+	.ascii	"yf\013)\267v\334_\223r\337\376u\2774"
+	.text
+	.section	.gnu.lto_.symbol_nodes.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\205\006"
+	.string	"t\t\235\001"
+	.string	""
+	.string	""
+	.string	"\0023\177\021\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005.\013\201\2044\177\022\0025\177\023\0026\177\0247\177\025\005<\026 8\177\027\340\301\257\030/\0309\177\031\354\331\276!2\032\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\0050\033\005\n\034\001:\177\035\377\037"
+	.string	""
+	.string	"\200\200\200\001;\177\036>\177\037=\177 \003"
+	.string	"\rD\003\003\244\001\003\003\016\320\360\372\250\001\001\204\006\003\004\004\007\020d\003\007\017\370\311\306\032\001\344\033"
+	.string	"\026"
+	.ascii	"\002K \330l\316][\331\r\254\301\201\332\001\320\371@f\377R#\b"
+	.ascii	"\206\313\217e\270X\rb(\264!\303\nC\2630\001\001\364\330\371\021"
+	.ascii	"\256h\002\350\020\021\324\023"
+	.text
+	.section	.gnu.lto_.refs.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375 R\025\002"
+	.string	"RD\r\026\260'\035\f\3030\f+\244\022\\(\242\255\245[\313\266\304n)S\023,\007n\364\213.\3207\333K_\251O\372H\377\350A\335\372"
+	.string	"\373\2144n\216\357g\002\003"
+	.ascii	"2*\n\270-V\371\002"
+	.text
+	.section	.gnu.lto_.decls.80bd1898e037c90b,"e",@progbits
+	.string	"(\265/\375`%\030ew"
+	.ascii	"\n\313\320,Q0\320:J\007\325\013\226c(\036X\213\307\330@\275&"
+	.ascii	"\227\341\317\025\205\263\033\332H\303\255\215]\360\302-P\206"
+	.ascii	"\336\370m\342\3705(\363,u\264\333\354\037\030\203-\302\203E\201"
+	.ascii	"hy\001Q\252D\312\312\311\214\355)r\227\311RmyJJ>!R\246b\002\275"
+	.ascii	"\002\302\002\f\307n\\\007m\233k\216(\035\334\356\275(\214P\240"
+	.ascii	"X\351\004\2112\265\246gFA<\234ux\330Y\317g\270\355\207\371\003"
+	.ascii	"\2131\314\312r\236:\231B\250\221\007\332\227\261\365\\e=\342"
+	.ascii	"\020lo\270eR\351\323\351\371\315\317k\230\007^c\346\275G\266"
+	.ascii	"1\247JO\247\314\206\333\260S\004\273\321\031\333;\304o7D)\237"
+	.ascii	"\2544\334\313\"T~>Y\204\332L\016\241&\300 T"
+	.string	"V\223tV\343)\251d\031\353\264\350\234&b7%\314\220#hi\320\313\254\302\326\351Y\333\266W\021\007&\\\353\0316\303NF\303eg3&sn\357mW\224\3411\274\"\321\215b\263\244yo\253b\005\243\341/<\006m\233\273-\\J\334\356m\215P\240\320a\351\312z\252\351\031\310J\304!\324f\252\225\301p\030v\216`1W\261\342h\321y\275\204\346\250\314\355\351\364|\\\317#T~\362\b\3653x\031\321\362\250*\322]\270\f\365\310Zc\303dFj\232!sx:\275\323\372\363\030\212\244b\266E@=\226|\361\321i\030;Y\354i\373\007\376$1\336\201\267\240_\311{\334\342\344\200/3-C\344\356\275F(\204\216<I\243J\323\363\026\326\322\314;@W\035y\203\354\224\257p\313\316#\306r\006\343,\3779\266\027\354\336v\350g\315N\220\260NIp\b5\265`\r:q\376:"
+	.ascii	"\306\273\342\273\365|\244\016\361\221\252\"\351l\345g\035\330"
+	.ascii	"\013\204\232\\\2667\354\336;\244v\225\021\311\323\351{}\313!"
+	.ascii	"\324\225A\250q\004\370;\004&j\375\207\373\031\310[\235\237\177"
+	.ascii	"\374\214\300\317\t\374\353g\037?\333Xr\017\262\037\375M\301\317"
+	.ascii	"I3\377\313\030\375/\340\347\251\242\277\223\210J\374\034\304"
+	.ascii	"A\002o\350\357\021O\377\036\340g\027\220\314\177\377\374\254"
+	.ascii	"\302\317J?\263\360s\n?\243\360\363\n?\367n\374\214\301\317'\374"
+	.ascii	"l"
+	.string	"\302\177\241\277\263\374,\3653\373\263\360\347\027~\226\361\363\322\3171~6\361\263\002?\217\370\231\200\237\215~&\372\231\3673\320\317\351\377\270\377n\376\257e\371\257\347\177\333\1771\377\345\376\223\375\307\363\377\315\177\264\377i\376w\371\317\345\277\330\377\022\377\317\376\377<\237\317\347\337r\376T\201\037\2004\314&\322E\032\206\271*d\202\334\272\276\270:\355\255\2447\027\020\331Y\237&\235\202`\020\352\207\313!Tf\242o\253\220\020-\255\016r\257\030\313\025z\206\231&$\210\216\207(L\306\320V\240\260\023\357\037\316\376\301oR\243\363\026?D\r\021\362D\356\336\345\002AE\251>@\234\253\320\031V\373\300\352e\007E>Y\315.]\032>f\264\272\307{\311\233\243\003\317\262\323\346\301cT/&m\246\354\030\272\272omv\264\216$R\232\314\263v\256\217\020\034Y\\\246\343\002\022w\243\254<\254d\262\255\326\326"
+	.ascii	"\271\254f\327.\016\224\246\rZ+O\253\352]\325V|\257\234\265\354"
+	.ascii	"\207\023\262\337y[\3758\201\302E\325\351Q\252\225w\244\245\232"
+	.ascii	"J\252s\254\305{\345\250q\023b\202v\243z\352\235\343s:)\207\031"
+	.ascii	"\327\351\3574\016\206\303\201L\252q4\362\303q\251\345\203\311"
+	.ascii	"~\316\230\3313\326i\337\270l\345\304\306\331s\3459O0\037\356"
+	.ascii	"s\236k\033N\236\353#\337\344\275\313\213\302A\263\\\036\241<"
+	.ascii	"\366\334\021\363|\037\333\030to\001CQR\224t\351\264\215\335\305"
+	.ascii	"\216z\033\373\006\035\257\327\275m\033\323{\215\314%x\314%tf"
+	.ascii	"K\214X\324\364\235g\375\035\236#\324\325\346\306\307\233\365"
+	.ascii	"\357_\275\306\344\275\027K\327\336dT\320Y\307|\364\0131\312\007"
+	.ascii	"\334\373\037m@\356\336%]p+\224/F M\342"
+	.string	"^p\213]G\243\262\350\2667\211\004\333*\"\263\360\240,j/\221\001.X\221\213l\267\224)\363\366m/\337\343\226\022\006d\313L\"[f\221\350\036\231\305{[%\0212\314Xd$\330\226\022\t\306T\026\335\343-^0#\221\365\310T\"\3230\225DH0\243\022y\334R\026)\351J2d\212\215\323\f\023A\036\257U\225\2261I\244\206l\231\227\355^\016\223\272\311\003\356\325b&\331\214=\030L\224\232U\024\027#\363\212\250\212\342b\336\243\0322\n\363\336(QM\267\n\202b\253v\221\260Z\261\210\326\245\222\272\227\200\252{\213|\325\356\275\305{\357.\251\325\336\373\203\b\331\254\252\272wiTu\265\212a\244\356\35508`\224H0.fR\030-`\315{\243-r\363\262m%W\260\342\327\245\272\367\262\235\265\251\314z\353\024\250\354\304Y\217\223\3650\227\364\330^\254\n\270d5\345nr\271"
+	.string	"\317J.J\222\2546\350\352*\tS\016O\224+!S\235\306\265a\037\340\334\270\272\312\2632\034\307\3419\274#\321=rQyc;|\207\235\f\307t8\013\034\303\251\342\306=\004\377\371"
+	.ascii	"\305\b\330\024\261\365\r\254N\036Je\247\350}[Gi\243\252\323i"
+	.ascii	"?o\026\264|#g\303\034\232\306\305&\252\323\336\323|\330\371\263"
+	.ascii	"\356s\236\230\033bg\316\3655\360\317\324\226{\347\371\177~\304"
+	.ascii	"\b1\262Ue\375\033\317\377\263\033[\003\322\224\262~\307d\005"
+	.ascii	"\232\253S\247\341\2624\363\034\267\342\330y\303}7\265C\022e\247"
+	.ascii	"\375\3666u\315\224)Kv[k\220\224\266\266\246c\304D\337\250\351"
+	.ascii	"\371\321%\244\006\353\213r\316\233\316\235,jVX\213\232v\305G"
+	.ascii	"O\2375\210\354\004\333\331:\016;\357\025\033a\306\315\035\241"
+	.ascii	"e\274t\350h8\3578BT\302(\031\353\264{8\2358$G8G\237\322\022\027"
+	.ascii	"5f\335\0059\361^s\366\032k\271 \354\032\225Gg\222v\312\344n\322"
+	.ascii	"\314\002EK\324\246tzuk\005Z;\361n\323\206\350^\256+`X+\017\216"
+	.ascii	"\347\n$w\202\251p#y{\261\263\2214\017F_m\221\227\346%\251\265"
+	.ascii	"\300\352\366\265\244\254\3235\255\321.\207\017\262\260\267\365"
+	.ascii	"\354\365\325X\330Z\260vz\251!\353.9\244\351+_\272\f\253-\211"
+	.ascii	"\356\321\213\0347\257\263\316\322N^\261\350\336\"iM\264Vk5\235"
+	.ascii	"\246\321t\032;\373\254\275\274wh+G2}\326Zz\214\325n\270\300\013"
+	.ascii	"\r\205\021\n\240\265;M\324x\351\327\333\n\210Bv`\005N\227i0M"
+	.ascii	"\206\325\226\355\305\002\352\322\234SE\256\315\364\031vv\231"
+	.ascii	"\033\265\367\206\241\020!\264\247\0079+*\031\263 0S@nt\332e\f"
+	.ascii	"v\226\243\310\227\030v\366\230\241\033O\3720\351\264\303\274"
+	.ascii	"-\305Q\234\312q\263tG\030\035\320\254\254\327u\255\327%\341\262"
+	.ascii	"\272q\013\222fd\275\216\310\332[:\214\235&Z\254\223\364\021\303"
+	.ascii	"\262\\\317&T\364\371d\023\352uY\353u9\326\353\244\326\277\261"
+	.ascii	"\264S\007\206\006.\315\311c\232\r\032\225\316\270\0221\b\225"
+	.ascii	"\304QWWi\035\252\2009B\246g}S\001\001\0075d\235\246|3\265sxO"
+	.ascii	"\371\177\372\254I\263\352\316\372\216\322R\376\037\036\033\023"
+	.ascii	"\261\257\266\365\rEG\366\204\363\321i?Y\245R5&>\004\361"
+	.string	"2\244\237\374\255\244\227\264\223\026fx\366\301\323i7\351\346\333I3\271\355\004\002\346\275\306v2\304\347^\343\020s\t\346\022i\025\256&cj\372\024\315z6\016\241\n1\b\265qHz'I#\343v\245\323\240\264k\rZ\263\301\206>v\300\325\225\325\224\033z\322\306\331\354\364i\217\025H\355\304{\b;{H\033\271\340\206\366\026c\360\242\203\023\306\204\322\351\333\310\337\001FoJAlb{N\004\004\201\275!K\f\n}?oJ\301\024\004\016Y\"\322o\tj\206/\bD\032\022\241\220\004\2301\003*\030\024\006w\254\222*\203p\330\304\n\203;\031\275\337\214\224\375\021\235~N*\373\203Q\300o\b\305\366~2voJ\321c\2011\220\202B''\241o\004\373\343\200\005\306"
+	.string	"zS\n\017Hx\001\003\211\3751\r{,\211\027|\302\031.~C\241\213\241\032OB\027\007\260OP\302!\223\322\360\307\376\234z\303\336\023\022\023PFP\350K\300\027\204\332\200\375\021\201\2022\232\375\021\177LOA\254R\220\351I\027dzB\1773"
+	.string	"\211)\221\370\033.-\365v5\236\204\276t\310>\241K\277 \023pFo\267\364#B\245\276\037q\367\241\022\323S\n\241a\257\311\227\326\030\262D \323o\204\022l\360G\374\rE \002I\324\350\r\207-\234~,\261\006\f%b\002\304\245\037\333\203\n\340M)h\f\221h\fA\364\330^\006\276\241\372#\002\205~5X`\f\275!\007@6\330\202\b\034\3407\004\266 \002\207~lo\351\251\204\240\031B!\006J:\rLxA\202\213\026J\032d\020\302\007J.FP\202\361\242\350>\340\360\027\3741\255\207\200E\003,\"\240\261{\004\02380\201\003\352#\230 )i\002\026I\353Y$\241\367\275@\354}\360\201o\030"
+	.string	";\324\021\225\200KA\241\213\240\020\310\366b"
+	.string	"\262\276\026\"~JK/h\bc\354\226^\2504~K\301\027.h@\365\206X%\026Il\020\270c\227\202\277\035Q\351\307\024\354\2150\343\027\f\366\232|<V)\202\335\323\217\205\301\016{,\361\207Uz\201\330sb\201\030\320\020\306\bz\223\210\013\237~C$V(\034\"\001\261J*\036`\203@\250\365\275\007\034\360\251`\241\202E\212"
+	.string	".\201\004.H\224"
+	.ascii	"\002\007\253/\005\361\267$tR\362\r\221|2\220\202\300\236\023"
+	.ascii	"\222oHDJaDd\2011\322 p\253\033+&t:m"
+	.string	"yK\254\220\004)\3435\247\272z\374(R%\247\352\212\017)\236\332\225'\222N\207\222X\350\022\013\355a\007\201(+Rd\262\216\366@y|P^y+Cy\240;~l\311a,\216\215\224\271\201\325\251\016\246\223\304\223\345f\255Zyh(\025\252D\251\320$'\213o\f\\Q{\226\311\335\245\216\243\037\275:\2324\223\222\003\307C\247\250\325\315\366\210]i\323)Zu\263\335Y\032\327\220\035[\333\002\201\021\"\246c\212\316\020\033\323\b\025\2168\352S\f\362\"\215\b=\327\3001;\r\332\021\367\326\023\207J\241kA\267\350\274W\273/f\346\304\310]\344\362\b\350+\307\327\032\264xT\352\250\r\025+\336\266v\345\260f\354\024=\036\215Z\242\211q3\242Q\017\201\307\250\241,f\030522#\"\222$I:\021\005\204 &\255\264\036\022 \0061\0162\306\314\320\004IJ\222\302\264w\021\347\226\320"
+	.string	"\341\366#\243\324R\325Z}wt\220\2321\243\264\020\364\372\034\367q\210\232\325`\352\320\343+MW\244\205\250s\036l$=\310\217\353\247Q\007\006\353\242<\214eV,=!\032U\273\232\335\210\203#\344\205\341\366:\305\326(I\310\3033Lj\277\213\340\334\004&\360\326\\X\021\346\335\337\020\214\264\037\327\221\264k\202x\033F\345+\361&\223P|<\352\024\216;\020\237\256\210\021\244\177\035\243:q[\245#z\177*p\302\350\2742\3033\f\262<\025\301\b\034\bU\314\222\360\222\377H\321\301\225\304G\264\335G\211$\311N\234\nP\266\261\216\246\276h\3563eBJX\335C\2256\211\f\222OR\204\234\004\021\240\234!\351H\200\220\034\327\241\035+\277\253\304\344\252\206RR\335F\020\221\030ZH4P\350\360\262&\312\002W\230@\n"
+	.string	"1\303\332W\360\225%\326\037\202\370\336\021\365\327\203ak\356\322\360\273t\247\372z\026AU\2523\340\023\236K\221\230\302\b\245\216\272\301\0042g\230\314\304\274C\223D\217\221\352p\200\016\004\244p\033\331q\304\315\264\356\314\005)\372 \252\037\254+\017\032\242\027\301;\2719\016\260\372\214\375\323w\004\330\203\\\301\232\310\002\232`tb\024\337\276\361\232u-\020\226n>P\252"
+	.string	"\264V\354B\370\314\240\343>|@\017\271\211t0\027Dd\022q!\001\240r*[b\217\225PO`'\272it\354\242\302\377!T\303\233\f\027\233\310\004\267\b \373\030K\252\321\310\355O\335\306\321\n\335y\303\276\276\321\243\035\304\242K<\026\330\355]\241N\350D\027*\221\036\343O\313i\227\004\020\244\205\213%M\202,\356\247srQ$\b%\370wdV\267\251\212\316\274"
+	.string	"\217[\3464\322i\233'K# \003/\256\371x\2165\241XZ\001\362\340\3046\342r6"
+	.string	"\001\311\216i(p=\266\313\370\267!\342v\b\311(\222\n<\030A\256\307\310\257\t%\030"
+	.ascii	"\177\313qc\206"
+	.string	"%\207\301\221\025\310\264N\326~d-\324fV&\377\300\201\3353\374\016\004\007#\353\277\035\342\t\371\210@N\316\307\203\235\244@\321\3752I\202O\344\315\"\b6\275T\220\307\336}\006l\335\217M\317I\3202X)\037Nx\342\227\254\244\350\313\340N\004\246\"\271=F\371\332]\226d\245\334\013j\230\345SnH\303\200T\025\273\360\257\354I\274\361\220\267\035i\201\230\256$\201\023\242!\b.L\327\017\336~'\001u\022\350\352sS`\254\220)3w\267\246\300\t\344\251Yd\233\300\254\304q\265\316H\300\347Z\223\234>\271(ri\30741MAnF\212\235\203\312[\200\223\312\270g\242\002\265\336o\033*\233(\200(c\264\305\333~T\033\215j\230\201\365~\327\2004\022A\307\254\304\242<\310^^\245)\227\250\213\225\201\250^~\225\257\313\263!;\037\211\0276\200:?B\377Hm\342\277V\331\327"
+	.ascii	"\027\212o\264^\005\367\373\007oE\317\277y\fN\334\376\322OF\341"
+	.ascii	"\023\237\311F\270,\373\031\227\375\241?/\255\306\313{\233\277"
+	.ascii	"\315\323\273\303\034\242z\031\236\213\232\rS\330\340\373&r \356"
+	.ascii	"\341\037\225\020\233i9\242\023\030G\246\367\350X\004\037\n\347"
+	.ascii	"y\366\325.\223o\333\326\340i\256\340^l\016S\347\240\005\341\034"
+	.ascii	"\257\232\337\351\252"
+	.text
+	.section	.gnu.lto_.symtab.80bd1898e037c90b,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"isAntiGravityModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.80bd1898e037c90b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19778 @@
+	.file	"settings.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/build/debug.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/fc/rc_modes.h"
+	.file 9 "./src/main/fc/settings.h"
+	.file 10 "./src/main/common/axis.h"
+	.file 11 "./src/main/flight/pid.h"
+	.file 12 "./src/main/target/SITL/target.h"
+	.file 13 "./src/main/flight/servos.h"
+	.file 14 "./src/main/common/color.h"
+	.file 15 "./src/main/io/ledstrip.h"
+	.file 16 "./src/main/sensors/sensors.h"
+	.file 17 "./src/main/telemetry/frsky.h"
+	.file 18 "./src/main/telemetry/telemetry.h"
+	.file 19 "./src/main/fc/settings.c"
+	.file 20 "./src/main/fc/config.h"
+	.file 21 "/usr/include/strings.h"
+	.file 22 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	settings.c.3df9160a
+	.weak	settings.c.3df9160a
+settings.c.3df9160a:
+	.long	0xdb0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF2852
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2554
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2555
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2556
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2557
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2558
+	.uleb128 0x3
+	.long	.LASF2559
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2560
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2561
+	.uleb128 0x3
+	.long	.LASF2562
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2563
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2564
+	.uleb128 0x20
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2565
+	.uleb128 0x2
+	.long	0x91
+	.uleb128 0x3
+	.long	.LASF2566
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF2567
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	0xae
+	.uleb128 0x3
+	.long	.LASF2568
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x3
+	.long	.LASF2569
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF2570
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2571
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2572
+	.uleb128 0xa
+	.long	0x98
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2573
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2574
+	.uleb128 0x11
+	.long	.LASF2780
+	.byte	0xc
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x6
+	.byte	0x30
+	.byte	0xe
+	.long	0x1b1
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2595
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2596
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2597
+	.byte	0x16
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2598
+	.uleb128 0x3
+	.long	.LASF2599
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xbf
+	.uleb128 0x3
+	.long	.LASF2600
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x1d0
+	.uleb128 0x21
+	.long	0x1e0
+	.uleb128 0xb
+	.long	0x8f
+	.uleb128 0xb
+	.long	0x70
+	.byte	0
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x1ff
+	.uleb128 0x1b
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x8f
+	.uleb128 0x1b
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x1ff
+	.byte	0
+	.uleb128 0xa
+	.long	0x1c4
+	.uleb128 0xc
+	.long	.LASF2727
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x25f
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1b8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2601
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xbf
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF2602
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x25f
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF2603
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x25f
+	.byte	0x10
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x264
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF2604
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x1e0
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0xae
+	.uleb128 0xa
+	.long	0x25f
+	.uleb128 0x3
+	.long	.LASF2605
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x204
+	.uleb128 0x2
+	.long	0x269
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.byte	0xe
+	.long	0x3a1
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2645
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2648
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2649
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2650
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2651
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2652
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.byte	0xe
+	.long	0x492
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2665
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2674
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2675
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2676
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2677
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2678
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2679
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2680
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2682
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2689
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0x25
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2853
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x16
+	.byte	0x18
+	.byte	0xe
+	.long	0x4ed
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2692
+	.byte	0x1
+	.uleb128 0x13
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2700
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x9
+	.byte	0x15
+	.byte	0xe
+	.long	0x58a
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2704
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2705
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2708
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2709
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2721
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2722
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2723
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2724
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2725
+	.byte	0x17
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2726
+	.byte	0x9
+	.byte	0x47
+	.byte	0x3
+	.long	0x4ed
+	.uleb128 0x2
+	.long	0x58a
+	.uleb128 0xc
+	.long	.LASF2728
+	.byte	0x10
+	.byte	0x9
+	.byte	0x49
+	.long	0x5c2
+	.uleb128 0x6
+	.long	.LASF2729
+	.byte	0x9
+	.byte	0x4a
+	.byte	0x19
+	.long	0x5c2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2730
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x13
+	.long	0xba
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0xfb
+	.uleb128 0x3
+	.long	.LASF2731
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x3
+	.long	0x59b
+	.uleb128 0x2
+	.long	0x5c7
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x9
+	.byte	0x53
+	.byte	0xe
+	.long	0x621
+	.uleb128 0x1
+	.long	.LASF2732
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2733
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2734
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2735
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2736
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2737
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2738
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2739
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2740
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2741
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2742
+	.byte	0x4
+	.byte	0x9
+	.byte	0x6a
+	.long	0x648
+	.uleb128 0xd
+	.string	"min"
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x13
+	.long	0xa9
+	.byte	0
+	.uleb128 0xd
+	.string	"max"
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x13
+	.long	0xa9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2743
+	.byte	0x9
+	.byte	0x6d
+	.byte	0x3
+	.long	0x621
+	.uleb128 0xc
+	.long	.LASF2744
+	.byte	0x4
+	.byte	0x9
+	.byte	0x6f
+	.long	0x66e
+	.uleb128 0x6
+	.long	.LASF2745
+	.byte	0x9
+	.byte	0x70
+	.byte	0x1e
+	.long	0x596
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2746
+	.byte	0x9
+	.byte	0x71
+	.byte	0x3
+	.long	0x654
+	.uleb128 0xc
+	.long	.LASF2747
+	.byte	0x1
+	.byte	0x9
+	.byte	0x73
+	.long	0x694
+	.uleb128 0x6
+	.long	.LASF2748
+	.byte	0x9
+	.byte	0x74
+	.byte	0x13
+	.long	0xba
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2749
+	.byte	0x9
+	.byte	0x75
+	.byte	0x3
+	.long	0x67a
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x9
+	.byte	0x77
+	.byte	0x9
+	.long	0x6cb
+	.uleb128 0x15
+	.long	.LASF2750
+	.byte	0x78
+	.byte	0x1c
+	.long	0x66e
+	.uleb128 0x15
+	.long	.LASF2751
+	.byte	0x79
+	.byte	0x17
+	.long	0x648
+	.uleb128 0x15
+	.long	.LASF2752
+	.byte	0x7a
+	.byte	0x1c
+	.long	0x694
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2753
+	.byte	0x9
+	.byte	0x7b
+	.byte	0x3
+	.long	0x6a0
+	.uleb128 0x2
+	.long	0x6cb
+	.uleb128 0x23
+	.byte	0x11
+	.byte	0x9
+	.byte	0x7d
+	.byte	0x9
+	.long	0x727
+	.uleb128 0x6
+	.long	.LASF2754
+	.byte	0x9
+	.byte	0x7e
+	.byte	0x11
+	.long	0xf6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2755
+	.byte	0x9
+	.byte	0x7f
+	.byte	0x13
+	.long	0xba
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF2756
+	.byte	0x9
+	.byte	0x80
+	.byte	0x1c
+	.long	0x6d7
+	.byte	0x9
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x9
+	.byte	0x82
+	.byte	0xb
+	.long	0x1b8
+	.byte	0xd
+	.uleb128 0x6
+	.long	.LASF2757
+	.byte	0x9
+	.byte	0x83
+	.byte	0xe
+	.long	0xbf
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2758
+	.byte	0x9
+	.byte	0x84
+	.byte	0x1b
+	.long	0x6dc
+	.uleb128 0x2
+	.long	0x727
+	.uleb128 0x4
+	.long	0x5d3
+	.long	0x743
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x2
+	.long	0x738
+	.uleb128 0xe
+	.long	.LASF2759
+	.byte	0x87
+	.byte	0x21
+	.long	0x743
+	.uleb128 0xe
+	.long	.LASF2760
+	.byte	0x88
+	.byte	0x17
+	.long	0xcb
+	.uleb128 0x4
+	.long	0x733
+	.long	0x769
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0xe
+	.long	.LASF2761
+	.byte	0x8a
+	.byte	0x19
+	.long	0x769
+	.uleb128 0x4
+	.long	0xfb
+	.long	0x784
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x2
+	.long	0x779
+	.uleb128 0xe
+	.long	.LASF2762
+	.byte	0x91
+	.byte	0x1b
+	.long	0x784
+	.uleb128 0xe
+	.long	.LASF2763
+	.byte	0x93
+	.byte	0x1b
+	.long	0x784
+	.uleb128 0xe
+	.long	.LASF2764
+	.byte	0x96
+	.byte	0x1b
+	.long	0x784
+	.uleb128 0xe
+	.long	.LASF2765
+	.byte	0x99
+	.byte	0x1b
+	.long	0x784
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xa
+	.byte	0x14
+	.byte	0xe
+	.long	0x7ce
+	.uleb128 0x13
+	.string	"X"
+	.byte	0
+	.uleb128 0x13
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x13
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xe
+	.long	0x7ed
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xb
+	.byte	0x25
+	.byte	0xe
+	.long	0x83c
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0xa
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2781
+	.byte	0xb
+	.byte	0x79
+	.byte	0x5
+	.long	0x1b1
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xd
+	.byte	0x19
+	.byte	0x6
+	.long	0x8af
+	.uleb128 0x1
+	.long	.LASF2782
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2783
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2784
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2785
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2786
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2787
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2788
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2789
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2790
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2791
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2792
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2794
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2795
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2796
+	.byte	0xe
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2797
+	.byte	0xd
+	.byte	0x29
+	.byte	0x3
+	.long	0x848
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xe
+	.byte	0x15
+	.byte	0xe
+	.long	0x8da
+	.uleb128 0x1
+	.long	.LASF2798
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2799
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2800
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2801
+	.byte	0x4
+	.byte	0xe
+	.byte	0x34
+	.long	0x908
+	.uleb128 0xd
+	.string	"h"
+	.byte	0xe
+	.byte	0x35
+	.byte	0xe
+	.long	0xbf
+	.byte	0
+	.uleb128 0xd
+	.string	"s"
+	.byte	0xe
+	.byte	0x36
+	.byte	0xd
+	.long	0xae
+	.byte	0x2
+	.uleb128 0xd
+	.string	"v"
+	.byte	0xe
+	.byte	0x37
+	.byte	0xd
+	.long	0xae
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2802
+	.byte	0xe
+	.byte	0x38
+	.byte	0x3
+	.long	0x8da
+	.uleb128 0xc
+	.long	.LASF2803
+	.byte	0x6
+	.byte	0xf
+	.byte	0x7c
+	.long	0x92e
+	.uleb128 0x6
+	.long	.LASF2804
+	.byte	0xf
+	.byte	0x7d
+	.byte	0xd
+	.long	0x92e
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xae
+	.long	0x93e
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2805
+	.byte	0xf
+	.byte	0x7e
+	.byte	0x3
+	.long	0x914
+	.uleb128 0x2
+	.long	0x93e
+	.uleb128 0xc
+	.long	.LASF2806
+	.byte	0xb
+	.byte	0xf
+	.byte	0x80
+	.long	0x969
+	.uleb128 0x6
+	.long	.LASF2804
+	.byte	0xf
+	.byte	0x81
+	.byte	0xd
+	.long	0x969
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xae
+	.long	0x979
+	.uleb128 0x7
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2807
+	.byte	0xf
+	.byte	0x82
+	.byte	0x3
+	.long	0x94f
+	.uleb128 0x11
+	.long	.LASF2808
+	.byte	0xf
+	.byte	0x99
+	.byte	0xd
+	.long	0x991
+	.uleb128 0xa
+	.long	0x908
+	.uleb128 0x11
+	.long	.LASF2809
+	.byte	0xf
+	.byte	0x9a
+	.byte	0x1b
+	.long	0x9a2
+	.uleb128 0xa
+	.long	0x94a
+	.uleb128 0x11
+	.long	.LASF2810
+	.byte	0xf
+	.byte	0x9b
+	.byte	0x17
+	.long	0x979
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x10
+	.byte	0x14
+	.byte	0xe
+	.long	0x9de
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x11
+	.byte	0x14
+	.byte	0xe
+	.long	0x9f7
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x12
+	.byte	0x1e
+	.byte	0xe
+	.long	0xa10
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xa20
+	.uleb128 0x7
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x2
+	.long	0xa10
+	.uleb128 0x14
+	.long	0x794
+	.byte	0x51
+	.long	0xa20
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xa3f
+	.uleb128 0x7
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x2
+	.long	0xa2f
+	.uleb128 0x14
+	.long	0x789
+	.byte	0x57
+	.long	0xa3f
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xa5e
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	0xa4e
+	.uleb128 0x14
+	.long	0x79f
+	.byte	0x5e
+	.long	0xa5e
+	.uleb128 0x14
+	.long	0x7aa
+	.byte	0x64
+	.long	0xa5e
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xa87
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	0xa77
+	.uleb128 0x5
+	.long	.LASF2820
+	.byte	0x69
+	.long	0xa87
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xaa6
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	0xa96
+	.uleb128 0x5
+	.long	.LASF2821
+	.byte	0x6d
+	.long	0xaa6
+	.uleb128 0x5
+	.long	.LASF2822
+	.byte	0x71
+	.long	0xa87
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xacf
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	0xabf
+	.uleb128 0x5
+	.long	.LASF2823
+	.byte	0x75
+	.long	0xacf
+	.uleb128 0x5
+	.long	.LASF2824
+	.byte	0x82
+	.long	0xa87
+	.uleb128 0x5
+	.long	.LASF2825
+	.byte	0x86
+	.long	0xa5e
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xb02
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	0xaf2
+	.uleb128 0x5
+	.long	.LASF2826
+	.byte	0x8b
+	.long	0xb02
+	.uleb128 0x5
+	.long	.LASF2827
+	.byte	0x8f
+	.long	0xaa6
+	.uleb128 0x5
+	.long	.LASF2828
+	.byte	0x94
+	.long	0xa87
+	.uleb128 0x5
+	.long	.LASF2829
+	.byte	0x9a
+	.long	0xb02
+	.uleb128 0x5
+	.long	.LASF2830
+	.byte	0x9e
+	.long	0xaa6
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xb49
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2
+	.long	0xb39
+	.uleb128 0x5
+	.long	.LASF2831
+	.byte	0xc1
+	.long	0xb49
+	.uleb128 0x4
+	.long	0xfb
+	.long	0xb68
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	0xb58
+	.uleb128 0x5
+	.long	.LASF2832
+	.byte	0xcc
+	.long	0xb68
+	.uleb128 0x5
+	.long	.LASF2833
+	.byte	0xed
+	.long	0xaa6
+	.uleb128 0x5
+	.long	.LASF2834
+	.byte	0xf1
+	.long	0xa5e
+	.uleb128 0x5
+	.long	.LASF2835
+	.byte	0xf8
+	.long	0xb02
+	.uleb128 0x5
+	.long	.LASF2836
+	.byte	0xfc
+	.long	0xaa6
+	.uleb128 0x12
+	.long	.LASF2837
+	.value	0x100
+	.byte	0x1b
+	.long	0xaa6
+	.uleb128 0x12
+	.long	.LASF2838
+	.value	0x110
+	.byte	0x1b
+	.long	0xa87
+	.uleb128 0x4
+	.long	0x5d3
+	.long	0xbc7
+	.uleb128 0x7
+	.long	0x37
+	.byte	0x16
+	.byte	0
+	.uleb128 0x2
+	.long	0xbb7
+	.uleb128 0x1c
+	.long	0x748
+	.value	0x114
+	.byte	0x1a
+	.long	0xbc7
+	.uleb128 0x4
+	.long	0x733
+	.long	0xbe8
+	.uleb128 0x7
+	.long	0x37
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd8
+	.uleb128 0x1c
+	.long	0x76e
+	.value	0x147
+	.byte	0x12
+	.long	0xbe8
+	.uleb128 0x24
+	.long	0x753
+	.byte	0x13
+	.value	0x306
+	.byte	0x10
+	.uleb128 0x4
+	.long	0xbf
+	.long	0xc12
+	.uleb128 0x7
+	.long	0x37
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2839
+	.value	0x30b
+	.byte	0x11
+	.long	0xc02
+	.uleb128 0x12
+	.long	.LASF2840
+	.value	0x30c
+	.byte	0xc
+	.long	0x1b1
+	.uleb128 0x17
+	.long	.LASF2843
+	.byte	0x5
+	.byte	0xb9
+	.byte	0x15
+	.long	0xc40
+	.long	0xc40
+	.uleb128 0xb
+	.long	0x1b8
+	.byte	0
+	.uleb128 0xa
+	.long	0x275
+	.uleb128 0x1d
+	.long	.LASF2841
+	.byte	0x7e
+	.long	0xae
+	.uleb128 0x1d
+	.long	.LASF2842
+	.byte	0x79
+	.long	0xae
+	.uleb128 0x17
+	.long	.LASF2844
+	.byte	0x15
+	.byte	0x78
+	.byte	0xc
+	.long	0x70
+	.long	0xc79
+	.uleb128 0xb
+	.long	0xf6
+	.uleb128 0xb
+	.long	0xf6
+	.uleb128 0xb
+	.long	0xdc
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2845
+	.byte	0x15
+	.byte	0x74
+	.byte	0xc
+	.long	0x70
+	.long	0xc94
+	.uleb128 0xb
+	.long	0xf6
+	.uleb128 0xb
+	.long	0xf6
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2854
+	.byte	0x13
+	.value	0x359
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF2846
+	.value	0x353
+	.byte	0x7
+	.long	0x8f
+	.long	0xcc6
+	.uleb128 0xf
+	.long	.LASF2848
+	.value	0x353
+	.byte	0x30
+	.long	0xcc6
+	.uleb128 0x10
+	.string	"rec"
+	.value	0x355
+	.byte	0x19
+	.long	0xc40
+	.byte	0
+	.uleb128 0xa
+	.long	0x733
+	.uleb128 0x18
+	.long	.LASF2847
+	.value	0x346
+	.byte	0xa
+	.long	0xbf
+	.long	0xce8
+	.uleb128 0xf
+	.long	.LASF2848
+	.value	0x346
+	.byte	0x32
+	.long	0xcc6
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2849
+	.value	0x327
+	.byte	0x13
+	.long	0xcc6
+	.long	0xd4f
+	.uleb128 0xf
+	.long	.LASF2754
+	.value	0x327
+	.byte	0x2b
+	.long	0xf6
+	.uleb128 0xf
+	.long	.LASF2748
+	.value	0x327
+	.byte	0x35
+	.long	0x70
+	.uleb128 0x10
+	.string	"low"
+	.value	0x32e
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x12
+	.long	.LASF2850
+	.value	0x32f
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x19
+	.uleb128 0x10
+	.string	"mid"
+	.value	0x331
+	.byte	0x13
+	.long	0x77
+	.uleb128 0x12
+	.long	.LASF2848
+	.value	0x332
+	.byte	0x1b
+	.long	0xcc6
+	.uleb128 0x10
+	.string	"cmp"
+	.value	0x333
+	.byte	0x13
+	.long	0x77
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2855
+	.byte	0x13
+	.value	0x31d
+	.byte	0xc
+	.long	0x70
+	.long	0xd91
+	.uleb128 0xf
+	.long	.LASF2754
+	.value	0x31d
+	.byte	0x2b
+	.long	0xf6
+	.uleb128 0xf
+	.long	.LASF2748
+	.value	0x31d
+	.byte	0x35
+	.long	0x70
+	.uleb128 0xf
+	.long	.LASF2851
+	.value	0x31d
+	.byte	0x49
+	.long	0xf6
+	.uleb128 0x10
+	.string	"cmp"
+	.value	0x31f
+	.byte	0xf
+	.long	0x77
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2856
+	.byte	0x13
+	.value	0x30e
+	.byte	0xd
+	.uleb128 0x19
+	.uleb128 0x10
+	.string	"i"
+	.value	0x310
+	.byte	0x13
+	.long	0x30
+	.uleb128 0x19
+	.uleb128 0x10
+	.string	"j"
+	.value	0x311
+	.byte	0x12
+	.long	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 39 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 49 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x4
+	.file 68 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 69 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF923
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF924
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 72 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x49
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1312
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x4e
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 80 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 81 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x51
+	.file 82 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 83 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.file 84 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 85 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x55
+	.file 86 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1634
+	.byte	0x4
+	.file 87 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1635
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x4
+	.file 88 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x58
+	.file 89 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 90 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x5a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 91 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 92 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5c
+	.file 93 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x14
+	.file 94 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5e
+	.byte	0x4
+	.file 95 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 97 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x62
+	.file 99 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x63
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 100 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 101 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2177
+	.byte	0x4
+	.file 102 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x66
+	.file 103 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 104 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 105 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x69
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2187
+	.byte	0x4
+	.file 106 "./src/main/fc/controlrate_profile.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2188
+	.byte	0x4
+	.file 107 "./src/main/fc/fc_core.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x6b
+	.byte	0x4
+	.file 108 "./src/main/fc/rc_adjustments.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x6c
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.file 109 "./src/main/flight/altitude.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x6d
+	.byte	0x4
+	.file 110 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.file 111 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x4
+	.file 112 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x70
+	.file 113 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x71
+	.file 114 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2234
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.file 115 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.file 116 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.file 117 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2274
+	.byte	0x4
+	.file 118 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 119 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x77
+	.byte	0x4
+	.file 120 "./src/main/io/vtx_rtc6705.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.file 121 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x79
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.file 122 "./src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.file 123 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x7b
+	.file 124 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7c
+	.file 125 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7d
+	.byte	0x4
+	.file 126 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7e
+	.byte	0x4
+	.file 127 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7f
+	.byte	0x4
+	.file 128 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x80
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.file 129 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x81
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2454
+	.file 130 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x82
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.file 131 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.file 132 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x84
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2460
+	.byte	0x4
+	.byte	0x4
+	.file 133 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.file 134 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.file 135 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x87
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x4
+	.file 136 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x88
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2493
+	.byte	0x4
+	.file 137 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x89
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2494
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2495
+	.byte	0x4
+	.file 138 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2496
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 139 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2497
+	.byte	0x4
+	.file 140 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8c
+	.file 141 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2498
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro105
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro106
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro107
+	.byte	0x4
+	.byte	0x4
+	.file 142 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x8e
+	.file 143 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8f
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2532
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2533
+	.byte	0x4
+	.file 144 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x90
+	.file 145 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x91
+	.byte	0x7
+	.long	.Ldebug_macro108
+	.byte	0x4
+	.file 146 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x92
+	.file 147 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x93
+	.byte	0x4
+	.byte	0x4
+	.file 148 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x94
+	.file 149 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x95
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro109
+	.byte	0x4
+	.byte	0x4
+	.file 150 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x96
+	.byte	0x4
+	.file 151 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x97
+	.byte	0x4
+	.file 152 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x98
+	.byte	0x7
+	.long	.Ldebug_macro110
+	.byte	0x4
+	.file 153 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x99
+	.byte	0x7
+	.long	.Ldebug_macro111
+	.byte	0x4
+	.file 154 "./src/main/sensors/gyroanalyse.h"
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x9a
+	.byte	0x7
+	.long	.Ldebug_macro112
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x12
+	.file 155 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x9b
+	.byte	0x7
+	.long	.Ldebug_macro113
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2553
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1197
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1206
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1212
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1224
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1226
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1228
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1258
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1260
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1262
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1264
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1300
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1311
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1316
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1341
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1344
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.6632086449fbd59aef993ded109b226a,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1356
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1363
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1364
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1365
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1367
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1368
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.23.e4fba624a2c005d3c7022fb9ef0a87ca,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1524
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1465
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1554
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1574
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1591
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1604
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1605
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.3217b4575ccf3c370ae0b5186c11b495,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1772
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1774
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1786
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1788
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1796
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1808
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2176
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2183
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2186
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2196
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2199
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2215
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.79.c3a4237a3ea21f9a324a771e53fbcf5b,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2221
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2233
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2240
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2259
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2270
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dashboard.h.22.499b1990b01ce2b674fe8b48758244f0,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2287
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_rtc6705.h.32.2cce3244327e41cc25c532c7afa6de4f,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2333
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2358
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.7eabd3dc96720430f10f642c53b6edaf,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2363
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1605
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2475
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2477
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro105:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro106:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro107:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2531
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro108:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2537
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro109:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.37.6498376d1e1396b14288709c9edf6d99,comdat
+.Ldebug_macro110:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro111:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyroanalyse.h.24.d83421841cfcc753a55e2729ef7d5afa,comdat
+.Ldebug_macro112:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro113:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2552
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x18
+	.long	.LASF1
+	.long	.LASF2857
+	.long	.LASF2858
+	.long	.LASF2859
+	.long	.LASF2860
+	.long	.LASF2861
+	.long	.LASF2862
+	.long	.LASF2863
+	.long	.LASF2864
+	.long	.LASF2865
+	.long	.LASF2866
+	.long	.LASF2867
+	.long	.LASF2868
+	.long	.LASF2869
+	.long	.LASF2870
+	.long	.LASF2871
+	.long	.LASF2872
+	.long	.LASF2873
+	.long	.LASF2874
+	.long	.LASF2875
+	.long	.LASF2876
+	.long	.LASF2877
+	.long	.LASF2878
+	.long	.LASF2879
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x9c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2880
+	.byte	0x13
+	.long	.LASF2881
+	.byte	0x13
+	.long	.LASF2882
+	.byte	0x13
+	.long	.LASF2883
+	.byte	0x17
+	.long	.LASF2884
+	.byte	0x5
+	.long	.LASF2885
+	.byte	0x2
+	.long	.LASF2886
+	.byte	0x8
+	.long	.LASF2887
+	.byte	0x9
+	.long	.LASF2888
+	.byte	0x9
+	.long	.LASF2889
+	.byte	0x4
+	.long	.LASF2890
+	.byte	0xa
+	.long	.LASF2891
+	.byte	0xe
+	.long	.LASF2892
+	.byte	0xa
+	.long	.LASF2893
+	.byte	0x4
+	.long	.LASF2894
+	.byte	0xb
+	.long	.LASF2895
+	.byte	0xd
+	.long	.LASF2896
+	.byte	0x10
+	.long	.LASF2897
+	.byte	0x10
+	.long	.LASF2898
+	.byte	0x9
+	.long	.LASF2899
+	.byte	0x9
+	.long	.LASF2900
+	.byte	0x16
+	.long	.LASF2901
+	.byte	0x9
+	.long	.LASF2902
+	.byte	0x16
+	.long	.LASF2903
+	.byte	0x17
+	.long	.LASF2904
+	.byte	0x17
+	.long	.LASF2904
+	.byte	0x16
+	.long	.LASF2905
+	.byte	0x13
+	.long	.LASF2906
+	.byte	0x16
+	.long	.LASF2907
+	.byte	0x16
+	.long	.LASF2908
+	.byte	0x13
+	.long	.LASF2909
+	.byte	0x13
+	.long	.LASF2910
+	.byte	0x15
+	.long	.LASF2911
+	.byte	0x13
+	.long	.LASF2912
+	.byte	0x14
+	.long	.LASF2913
+	.byte	0x14
+	.long	.LASF2914
+	.byte	0x13
+	.long	.LASF2915
+	.byte	0x13
+	.long	.LASF2916
+	.byte	0x13
+	.long	.LASF2917
+	.byte	0x16
+	.long	.LASF2918
+	.byte	0x13
+	.long	.LASF2919
+	.byte	0x13
+	.long	.LASF2920
+	.byte	0x13
+	.long	.LASF2921
+	.byte	0x13
+	.long	.LASF2880
+	.byte	0x15
+	.long	.LASF2922
+	.byte	0x12
+	.long	.LASF2923
+	.byte	0x12
+	.long	.LASF2924
+	.byte	0x12
+	.long	.LASF2925
+	.byte	0x12
+	.long	.LASF2926
+	.byte	0x16
+	.long	.LASF2926
+	.byte	0x13
+	.long	.LASF2927
+	.byte	0x13
+	.long	.LASF2928
+	.byte	0x13
+	.long	.LASF2929
+	.byte	0x13
+	.long	.LASF2930
+	.byte	0x15
+	.long	.LASF2930
+	.byte	0x13
+	.long	.LASF2931
+	.byte	0x12
+	.long	.LASF2932
+	.byte	0x12
+	.long	.LASF2933
+	.byte	0x12
+	.long	.LASF2934
+	.byte	0x12
+	.long	.LASF2935
+	.byte	0x13
+	.long	.LASF2936
+	.byte	0x13
+	.long	.LASF2937
+	.byte	0x13
+	.long	.LASF2938
+	.byte	0x13
+	.long	.LASF2939
+	.byte	0x13
+	.long	.LASF2940
+	.byte	0x13
+	.long	.LASF2941
+	.byte	0x16
+	.long	.LASF2942
+	.byte	0x13
+	.long	.LASF2943
+	.byte	0x17
+	.long	.LASF2944
+	.byte	0x16
+	.long	.LASF2945
+	.byte	0x12
+	.long	.LASF2946
+	.byte	0x12
+	.long	.LASF2947
+	.byte	0x16
+	.long	.LASF2948
+	.byte	0x13
+	.long	.LASF2949
+	.byte	0x13
+	.long	.LASF2950
+	.byte	0x13
+	.long	.LASF2951
+	.byte	0x13
+	.long	.LASF2952
+	.byte	0x13
+	.long	.LASF2953
+	.byte	0x13
+	.long	.LASF2954
+	.byte	0x13
+	.long	.LASF2955
+	.byte	0x16
+	.long	.LASF2956
+	.byte	0x11
+	.long	.LASF2957
+	.byte	0xf
+	.long	.LASF2958
+	.byte	0xf
+	.long	.LASF2959
+	.byte	0x2
+	.long	.LASF2960
+	.byte	0x1
+	.long	.LASF2961
+	.byte	0x1
+	.long	.LASF2962
+	.byte	0x4
+	.long	.LASF2963
+	.byte	0x3
+	.long	.LASF2964
+	.byte	0x8
+	.long	.LASF2965
+	.byte	0x4
+	.long	.LASF2966
+	.byte	0x5
+	.long	.LASF2967
+	.byte	0x8
+	.long	.LASF2968
+	.byte	0x8
+	.long	.LASF2969
+	.byte	0x8
+	.long	.LASF2970
+	.byte	0x8
+	.long	.LASF2971
+	.byte	0x8
+	.long	.LASF2972
+	.byte	0x8
+	.long	.LASF2973
+	.byte	0x8
+	.long	.LASF2974
+	.byte	0x8
+	.long	.LASF2975
+	.byte	0x8
+	.long	.LASF2976
+	.byte	0x8
+	.long	.LASF2977
+	.byte	0x8
+	.long	.LASF2978
+	.byte	0x8
+	.long	.LASF2979
+	.byte	0x8
+	.long	.LASF2980
+	.byte	0x8
+	.long	.LASF2981
+	.byte	0x9
+	.long	.LASF2982
+	.byte	0x9
+	.long	.LASF2983
+	.byte	0x9
+	.long	.LASF2984
+	.byte	0xa
+	.long	.LASF2985
+	.byte	0xa
+	.long	.LASF2986
+	.byte	0xa
+	.long	.LASF2987
+	.byte	0xa
+	.long	.LASF2988
+	.byte	0x8
+	.long	.LASF2989
+	.byte	0x8
+	.long	.LASF2990
+	.byte	0xa
+	.long	.LASF2991
+	.byte	0xb
+	.long	.LASF2992
+	.byte	0xb
+	.long	.LASF2993
+	.byte	0xb
+	.long	.LASF2994
+	.byte	0xb
+	.long	.LASF2995
+	.byte	0xb
+	.long	.LASF2996
+	.byte	0xc
+	.long	.LASF2997
+	.byte	0xc
+	.long	.LASF2998
+	.byte	0xd
+	.long	.LASF2999
+	.byte	0x6
+	.long	.LASF3000
+	.byte	0x8
+	.long	.LASF3001
+	.byte	0x8
+	.long	.LASF3002
+	.byte	0x8
+	.long	.LASF3003
+	.byte	0x6
+	.long	.LASF3004
+	.byte	0x16
+	.long	.LASF3005
+	.byte	0x16
+	.long	.LASF3005
+	.byte	0x13
+	.long	.LASF3006
+	.byte	0x12
+	.long	.LASF3007
+	.byte	0x13
+	.long	.LASF2962
+	.byte	0x16
+	.long	.LASF2962
+	.byte	0x13
+	.long	.LASF3008
+	.byte	0x12
+	.long	.LASF3009
+	.byte	0x12
+	.long	.LASF3010
+	.byte	0x13
+	.long	.LASF3011
+	.byte	0x12
+	.long	.LASF3012
+	.byte	0x13
+	.long	.LASF3013
+	.byte	0x13
+	.long	.LASF3014
+	.byte	0xd
+	.long	.LASF3014
+	.byte	0x7
+	.long	.LASF3015
+	.byte	0xd
+	.long	.LASF3016
+	.byte	0x4
+	.long	.LASF3017
+	.byte	0xd
+	.long	.LASF3018
+	.byte	0xd
+	.long	.LASF3019
+	.byte	0xd
+	.long	.LASF3020
+	.byte	0xd
+	.long	.LASF3021
+	.byte	0xd
+	.long	.LASF3022
+	.byte	0xd
+	.long	.LASF3023
+	.byte	0xd
+	.long	.LASF3024
+	.byte	0xd
+	.long	.LASF3025
+	.byte	0xd
+	.long	.LASF2973
+	.byte	0xb
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2168:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF1924:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2192:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1804:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF959:
+	.string	"__DECL_SIMD_logf "
+.LASF1068:
+	.string	"__DECL_SIMD_sinh "
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1961:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1998:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF905:
+	.string	"alloca"
+.LASF1944:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1935:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1538:
+	.string	"USE_FAKE_BARO "
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1498:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2552:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2299:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF2799:
+	.string	"RGB_GREEN"
+.LASF1234:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF2693:
+	.string	"THROTTLE"
+.LASF1815:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1505:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1969:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2274:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2689:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1850:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1338:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1499:
+	.string	"TELEMETRY_MAVLINK "
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF996:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1457:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1559:
+	.string	"USE_PPM"
+.LASF2375:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF2247:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2803:
+	.string	"modeColorIndexes_s"
+.LASF2805:
+	.string	"modeColorIndexes_t"
+.LASF2781:
+	.string	"airmodeWasActivated"
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2369:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1478:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1443:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF1426:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1377:
+	.string	"FP_NORMAL 4"
+.LASF2825:
+	.string	"lookupTableGPSSBASMode"
+.LASF1112:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF969:
+	.string	"__DECL_SIMD_expf "
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2425:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF2298:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1635:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1636:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1072:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2152:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1188:
+	.string	"__DECL_SIMD_tan "
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1173:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1586:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2685:
+	.string	"BOXCAMERA1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2559:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2477:
+	.string	"__sched_priority sched_priority"
+.LASF1257:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1892:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2072:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2598:
+	.string	"_Bool"
+.LASF1094:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2177:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF927:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2241:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF2017:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"SKIP_IMU_CALC "
+.LASF1524:
+	.string	"U_ID_2 2"
+.LASF1420:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1350:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1317:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2840:
+	.string	"valueTableIndexSorted"
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF1136:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF978:
+	.string	"__DECL_SIMD_pow "
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2486:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF1813:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF2614:
+	.string	"OWNER_ADC_CURR"
+.LASF1064:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF699:
+	.string	"__need_size_t "
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1871:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF2159:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2032:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2132:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2105:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2508:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2195:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1730:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1451:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2523:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF1877:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF2597:
+	.string	"DEBUG_COUNT"
+.LASF393:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1033:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2357:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2095:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1995:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2041:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2322:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF1585:
+	.string	"USE_SPI"
+.LASF2249:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1065:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF973:
+	.string	"__DECL_SIMD_expf64 "
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF1506:
+	.string	"USE_SENSOR_NAMES "
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF1611:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2164:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"__DECL_SIMD_erfcf"
+.LASF910:
+	.string	"__need___va_list"
+.LASF1320:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1731:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1139:
+	.string	"__DECL_SIMD_acoshf "
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF944:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1723:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF2003:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1987:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2136:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2445:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2111:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1687:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1120:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2611:
+	.string	"OWNER_LED"
+.LASF932:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2396:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1835:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2140:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1852:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1943:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2220:
+	.string	"VALUE_SECTION_MASK (0x0c)"
+.LASF2800:
+	.string	"RGB_BLUE"
+.LASF2568:
+	.string	"uint16_t"
+.LASF970:
+	.string	"__DECL_SIMD_expl "
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF380:
+	.string	"linux 1"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1250:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2817:
+	.string	"FRSKY_VFAS_PRECISION_HIGH"
+.LASF1318:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2466:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2402:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1293:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2103:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1780:
+	.string	"LED1_OFF NOOP"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1947:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2304:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF2082:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1490:
+	.string	"TELEMETRY_HOTT "
+.LASF2507:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF1090:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1259:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1446:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF2186:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1646:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2748:
+	.string	"length"
+.LASF1380:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1408:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1614:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2056:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2305:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1358:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1797:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF1590:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF2218:
+	.string	"VALUE_MODE_OFFSET 4"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1053:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2343:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF940:
+	.string	"__DECL_SIMD_sinl "
+.LASF2046:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1719:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1553:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1691:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1206:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1193:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1398:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2785:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF1179:
+	.string	"__DECL_SIMD_erfcf "
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2489:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF2363:
+	.string	"SRXL_FRAME_SIZE_MAX (SPEK_FRAME_SIZE + SRXL_FRAME_OVERHEAD)"
+.LASF919:
+	.string	"_VA_LIST_DEFINED "
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2794:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF2724:
+	.string	"TABLE_CRASH_RECOVERY"
+.LASF1299:
+	.string	"__DECL_SIMD_erfc"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2545:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF961:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2452:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2312:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF1823:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2460:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2535:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2459:
+	.string	"SCHED_RR 2"
+.LASF1711:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2616:
+	.string	"OWNER_ADC_RSSI"
+.LASF2750:
+	.string	"lookup"
+.LASF2200:
+	.string	"AIRMODEDEADBAND 12"
+.LASF2127:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2354:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2675:
+	.string	"BOXSONAR"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2246:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1444:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1727:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2257:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1494:
+	.string	"CMS "
+.LASF2037:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2237:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF2408:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1017:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2135:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2771:
+	.string	"PID_YAW"
+.LASF2028:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2091:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF960:
+	.string	"__DECL_SIMD_logl "
+.LASF2296:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1314:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2163:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2618:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2637:
+	.string	"OWNER_SPI_CS"
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2340:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF949:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1305:
+	.string	"__DECL_SIMD_tanf"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1291:
+	.string	"__DECL_SIMD_tanh"
+.LASF1596:
+	.string	"_T_PTRDIFF_ "
+.LASF1197:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1831:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1796:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF2735:
+	.string	"VAR_INT16"
+.LASF1571:
+	.string	"TELEMETRY_HOTT"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1678:
+	.string	"BIT(x) (1 << (x))"
+.LASF2642:
+	.string	"OWNER_BEEPER"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1785:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1232:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1576:
+	.string	"TELEMETRY_IBUS"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2240:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF1178:
+	.string	"__DECL_SIMD_erfc "
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1303:
+	.string	"__DECL_SIMD_tan"
+.LASF1043:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF1825:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2705:
+	.string	"TABLE_GPS_PROVIDER"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF2114:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"BARO "
+.LASF1378:
+	.string	"fpclassify(x) __MATH_TG ((x), __fpclassify, (x))"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1218:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1633:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1667:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1279:
+	.string	"__DECL_SIMD_atanh"
+.LASF1152:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2426:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF2753:
+	.string	"cliValueConfig_t"
+.LASF1946:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF2149:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF2650:
+	.string	"OWNER_SPI_PREINIT"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2085:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2251:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF1802:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1527:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1182:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1855:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF2708:
+	.string	"TABLE_BLACKBOX_PROFILE"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1931:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF2362:
+	.string	"SRXL_FRAME_OVERHEAD 5"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2639:
+	.string	"OWNER_BARO_EXTI"
+.LASF1704:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF921:
+	.string	"__va_list__ "
+.LASF2292:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1217:
+	.string	"__DECL_SIMD_expf"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF516:
+	.string	"__always_inline"
+.LASF1034:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2742:
+	.string	"cliMinMaxConfig_s"
+.LASF2743:
+	.string	"cliMinMaxConfig_t"
+.LASF2204:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1453:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF1067:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2349:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1066:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1950:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2729:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1677:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2295:
+	.string	"LED_POS_OFFSET 0"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2617:
+	.string	"OWNER_SERIAL_TX"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2658:
+	.string	"BOXMAG"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1724:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1333:
+	.string	"__MATH_PRECNAME"
+.LASF1103:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2737:
+	.string	"PROFILE_VALUE"
+.LASF1243:
+	.string	"__DECL_SIMD_exp10"
+.LASF1737:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1267:
+	.string	"__DECL_SIMD_log10"
+.LASF1343:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1364:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1251:
+	.string	"__DECL_SIMD_expm1"
+.LASF1365:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1035:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2549:
+	.string	"GYRO_FFT_MAX_PEAKS 1"
+.LASF1236:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1336:
+	.string	"_Mdouble_ float"
+.LASF1915:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2101:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2366:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1878:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2517:
+	.string	"__cleanup_fct_attribute "
+.LASF1580:
+	.string	"VTX_COMMON"
+.LASF1203:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1262:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1502:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1445:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF2248:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF1275:
+	.string	"__DECL_SIMD_log1p"
+.LASF1140:
+	.string	"__DECL_SIMD_acoshl "
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2585:
+	.string	"DEBUG_VELOCITY"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1881:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2184:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1979:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"USE_DASHBOARD "
+.LASF2480:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2338:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF926:
+	.string	"_MATH_H 1"
+.LASF1475:
+	.string	"USE_PPM "
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2720:
+	.string	"TABLE_RC_INTERPOLATION"
+.LASF2380:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1354:
+	.string	"__MATHDECL_1"
+.LASF1276:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1919:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF2130:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2422:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF2668:
+	.string	"BOXLEDLOW"
+.LASF2456:
+	.string	"_BITS_SCHED_H 1"
+.LASF1260:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2640:
+	.string	"OWNER_USB"
+.LASF1798:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1956:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1627:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1407:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1756:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF2839:
+	.string	"valueTableIndex"
+.LASF399:
+	.string	"false 0"
+.LASF2652:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF2760:
+	.string	"valueTableEntryCount"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1648:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2078:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF2128:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2367:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2197:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF1846:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1253:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2655:
+	.string	"BOXHORIZON"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1485:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2265:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF1650:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2113:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"__DECL_SIMD_log2f"
+.LASF1121:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF1016:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2494:
+	.string	"__itimerspec_defined 1"
+.LASF1028:
+	.string	"__DECL_SIMD_exp2 "
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2332:
+	.string	"RTC6705_POWER_COUNT 2"
+.LASF2829:
+	.string	"lookupTableBlackboxDevice"
+.LASF2261:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF1872:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2009:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2522:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1581:
+	.string	"VTX_CONTROL"
+.LASF2047:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1699:
+	.string	"PG_PID_PROFILE 14"
+.LASF1993:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1971:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2550:
+	.string	"GYRO_FFT_BIN_COUNT (GYRO_FFT_MAX_WINDOW_SIZE / 2)"
+.LASF1363:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2544:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF1328:
+	.string	"_Mdouble_ double"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF1782:
+	.string	"LED2_TOGGLE NOOP"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1977:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2048:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2669:
+	.string	"BOXLLIGHTS"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1670:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF2622:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1578:
+	.string	"TELEMETRY_SRXL"
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2255:
+	.string	"PIDSUM_LIMIT 500"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF2088:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2348:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1954:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1716:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1760:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1241:
+	.string	"__DECL_SIMD_exp2f"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2178:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1668:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2610:
+	.string	"OWNER_SERVO"
+.LASF1680:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1419:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1531:
+	.string	"ACC "
+.LASF2475:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1202:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2374:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1410:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF1497:
+	.string	"TELEMETRY_IBUS "
+.LASF1476:
+	.string	"USE_PWM "
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1556:
+	.string	"TELEMETRY_LTM"
+.LASF1925:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF2520:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF1129:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1899:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2271:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1296:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1845:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1829:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1933:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2487:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1656:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF2578:
+	.string	"DEBUG_GYRO"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF987:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2755:
+	.string	"type"
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1642:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1832:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2278:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF2816:
+	.string	"FRSKY_VFAS_PRECISION_LOW"
+.LASF2059:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2131:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1020:
+	.string	"__DECL_SIMD_hypotl "
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF2360:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF1602:
+	.string	"_GCC_PTRDIFF_T "
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1558:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2531:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2334:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2560:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2063:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF492:
+	.string	"__flexarr []"
+.LASF2583:
+	.string	"DEBUG_NOTCH"
+.LASF2562:
+	.string	"__uint16_t"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2212:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2609:
+	.string	"OWNER_MOTOR"
+.LASF1054:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1618:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1610:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2175:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1983:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1880:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF2364:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF2441:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF1216:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF2636:
+	.string	"OWNER_RX_SPI_CS"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1386:
+	.string	"math_errhandling 0"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2193:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF2317:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF1024:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1196:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2185:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1001:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2723:
+	.string	"TABLE_FAILSAFE"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1616:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF2852:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1092:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2846:
+	.string	"settingGetValuePointer"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1055:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1261:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1539:
+	.string	"USE_FLASHFS "
+.LASF1891:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__DECL_SIMD_erff16 "
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1163:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1930:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF956:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF984:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1025:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2191:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1613:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2813:
+	.string	"SENSOR_INDEX_BARO"
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF2812:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1462:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF2300:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF1042:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2454:
+	.string	"_PTHREAD_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1996:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1081:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1952:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF2244:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF2483:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1764:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1665:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2831:
+	.string	"lookupTableGyroLpf"
+.LASF1367:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1761:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1942:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1448:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1507:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF356:
+	.string	"__amd64 1"
+.LASF1050:
+	.string	"__DECL_SIMD_coshl "
+.LASF1817:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2123:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1814:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2554:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2319:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF1830:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1433:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1116:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF2479:
+	.string	"_BITS_TIME_H 1"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1959:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1771:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1774:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1298:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1603:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2020:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1212:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1530:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1515:
+	.string	"USE_NAV "
+.LASF2329:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1717:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2761:
+	.string	"valueTable"
+.LASF365:
+	.string	"__k8 1"
+.LASF1471:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1849:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1700:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF1529:
+	.string	"USE_FAKE_LED "
+.LASF2207:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2573:
+	.string	"float"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1695:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF2501:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF2838:
+	.string	"lookupTableFailsafe"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF2653:
+	.string	"BOXARM"
+.LASF2463:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1984:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2440:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1926:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1934:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"__MATHDECL"
+.LASF1533:
+	.string	"GYRO "
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1751:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1150:
+	.string	"__DECL_SIMD_erfl "
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1666:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1902:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1560:
+	.string	"USE_PWM"
+.LASF1791:
+	.string	"IOCFG_OUT_OD 0"
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1595:
+	.string	"_PTRDIFF_T "
+.LASF2670:
+	.string	"BOXCALIB"
+.LASF2727:
+	.string	"pgRegistry_s"
+.LASF2605:
+	.string	"pgRegistry_t"
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF1200:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF1615:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1623:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2325:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1278:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2830:
+	.string	"lookupTableBlackboxProfile"
+.LASF1107:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1032:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2388:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2593:
+	.string	"DEBUG_ALTITUDE"
+.LASF2509:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF2231:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1076:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2666:
+	.string	"BOXBEEPERON"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF1890:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"USE_SERVOS "
+.LASF2504:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF2371:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF381:
+	.string	"__unix 1"
+.LASF2765:
+	.string	"lookupTableMagHardware"
+.LASF1883:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2144:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2717:
+	.string	"TABLE_DEBUG"
+.LASF2648:
+	.string	"OWNER_VTX"
+.LASF515:
+	.string	"__wur "
+.LASF1487:
+	.string	"LED_STRIP "
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2081:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2359:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1805:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF2694:
+	.string	"AUX1"
+.LASF2695:
+	.string	"AUX2"
+.LASF2696:
+	.string	"AUX3"
+.LASF2697:
+	.string	"AUX4"
+.LASF2698:
+	.string	"AUX5"
+.LASF2699:
+	.string	"AUX6"
+.LASF2700:
+	.string	"AUX7"
+.LASF2701:
+	.string	"AUX8"
+.LASF1762:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1702:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2850:
+	.string	"high"
+.LASF1340:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2540:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF1917:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2506:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2397:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1011:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2038:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1484:
+	.string	"USE_SERIALRX_XBUS "
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2347:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1621:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1895:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2631:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF2124:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2806:
+	.string	"specialColorIndexes_s"
+.LASF2807:
+	.string	"specialColorIndexes_t"
+.LASF2553:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF866:
+	.string	"__NFDBITS"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1674:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2828:
+	.string	"lookupTableGimbalMode"
+.LASF1058:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1130:
+	.string	"__DECL_SIMD_atanhl "
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1955:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1147:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF916:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF2346:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1122:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1430:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF2002:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2385:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1833:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF950:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1181:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1922:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1027:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1939:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2060:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2759:
+	.string	"lookupTables"
+.LASF2587:
+	.string	"DEBUG_ANGLERATE"
+.LASF1864:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1945:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2287:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2758:
+	.string	"clivalue_t"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2676:
+	.string	"BOXSERVO1"
+.LASF2677:
+	.string	"BOXSERVO2"
+.LASF2678:
+	.string	"BOXSERVO3"
+.LASF2437:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2223:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1327:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1330:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF2187:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1517:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF2154:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2083:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"_ANSI_STDARG_H_ "
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1722:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF937:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1100:
+	.string	"__DECL_SIMD_log10l "
+.LASF2238:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF2181:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF1405:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2166:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2094:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1816:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2433:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF2764:
+	.string	"lookupTableBaroHardware"
+.LASF1923:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1820:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1452:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF2202:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF917:
+	.string	"_VA_LIST_ "
+.LASF2382:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1123:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2183:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2106:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF928:
+	.string	"__DECL_SIMD_cos "
+.LASF2467:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1199:
+	.string	"__DECL_SIMD_cos"
+.LASF2315:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1682:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2447:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF1554:
+	.string	"STACK_CHECK"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1087:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2352:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2641:
+	.string	"OWNER_USB_DETECT"
+.LASF2548:
+	.string	"GYRO_FFT_MAX_WINDOW_SIZE 32"
+.LASF1106:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2115:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_asinf "
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1591:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1783:
+	.string	"LED2_OFF NOOP"
+.LASF1788:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2407:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2601:
+	.string	"size"
+.LASF1459:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF2145:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1863:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1742:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF1294:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF2160:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1360:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2448:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1525:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1875:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"__DECL_SIMD_cosf"
+.LASF1344:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1247:
+	.string	"__DECL_SIMD_cosh"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF976:
+	.string	"__DECL_SIMD_expf64x "
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1133:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1246:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF929:
+	.string	"__DECL_SIMD_cosf "
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1292:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2158:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1639:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2373:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1638:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1397:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2590:
+	.string	"DEBUG_STACK"
+.LASF2645:
+	.string	"OWNER_INVERTER"
+.LASF1394:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2570:
+	.string	"size_t"
+.LASF2451:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2344:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2266:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2626:
+	.string	"OWNER_SPI_MOSI"
+.LASF1432:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1932:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2137:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2600:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF954:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2567:
+	.string	"uint8_t"
+.LASF1319:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2519:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1659:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2309:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF2252:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1518:
+	.string	"SIMULATOR_BUILD "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1468:
+	.string	"I2C2_OVERCLOCK true"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF1898:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2734:
+	.string	"VAR_UINT16"
+.LASF1334:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2836:
+	.string	"lookupTableRcInterpolationChannels"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1481:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2814:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1966:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"TELEMETRY "
+.LASF1973:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF994:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2405:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1838:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1282:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1300:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF981:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1186:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1148:
+	.string	"__DECL_SIMD_erf "
+.LASF2692:
+	.string	"PITCH"
+.LASF2008:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2712:
+	.string	"TABLE_GYRO_LPF"
+.LASF1557:
+	.string	"USE_ADC"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2770:
+	.string	"PID_PITCH"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2066:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"MATH_ERRNO 1"
+.LASF2406:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1572:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2283:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF2728:
+	.string	"lookupTableEntry_s"
+.LASF2731:
+	.string	"lookupTableEntry_t"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2076:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2515:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF1989:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF383:
+	.string	"unix 1"
+.LASF1374:
+	.string	"FP_INFINITE 1"
+.LASF912:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh "
+.LASF1366:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF938:
+	.string	"__DECL_SIMD_sin "
+.LASF2733:
+	.string	"VAR_INT8"
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF2014:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"TELEMETRY_CRSF"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF2254:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF951:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF2638:
+	.string	"OWNER_MPU_EXTI"
+.LASF2209:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF2468:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1222:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1803:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1304:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2608:
+	.string	"OWNER_PPMINPUT"
+.LASF2795:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF1794:
+	.string	"IOCFG_IPD 0"
+.LASF1605:
+	.string	"__need_ptrdiff_t"
+.LASF2715:
+	.string	"TABLE_BARO_HARDWARE"
+.LASF2767:
+	.string	"FD_PITCH"
+.LASF1012:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1309:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1466:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2236:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1622:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2150:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1335:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1348:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1720:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1592:
+	.string	"_STDDEF_H "
+.LASF2093:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2789:
+	.string	"INPUT_RC_THROTTLE"
+.LASF1249:
+	.string	"__DECL_SIMD_coshf"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2100:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1255:
+	.string	"__DECL_SIMD_sinh"
+.LASF2707:
+	.string	"TABLE_BLACKBOX_DEVICE"
+.LASF1741:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1834:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1936:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF934:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2090:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1312:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2182:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1473:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1175:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1920:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF966:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1957:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2335:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2844:
+	.string	"strncasecmp"
+.LASF2442:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1746:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1337:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1143:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1710:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1921:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1645:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1331:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1715:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1084:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2478:
+	.string	"_TIME_H 1"
+.LASF1884:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1436:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF2703:
+	.string	"TABLE_UNIT"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2819:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1442:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2776:
+	.string	"PID_LEVEL"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2301:
+	.string	"LED_POS_BITCNT 8"
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2055:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2228:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2684:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1818:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2023:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1937:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1901:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1928:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2172:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"__DECL_SIMD_acosf"
+.LASF1759:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1569:
+	.string	"LED_STRIP"
+.LASF2067:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1266:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1790:
+	.string	"IOCFG_OUT_PP 0"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF1141:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1841:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1399:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2518:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2112:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1660:
+	.string	"NOOP do {} while (0)"
+.LASF2580:
+	.string	"DEBUG_MIXER"
+.LASF1837:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1208:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2682:
+	.string	"BOX3DDISABLE"
+.LASF1773:
+	.string	"IO_TAG_NONE 0"
+.LASF2505:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1566:
+	.string	"USE_SERIALRX_SUMD"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1978:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2848:
+	.string	"value"
+.LASF1567:
+	.string	"USE_SERIALRX_SUMH"
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF2527:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2288:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1093:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1023:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2787:
+	.string	"INPUT_RC_PITCH"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2297:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1489:
+	.string	"TELEMETRY_FRSKY "
+.LASF1807:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1438:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1189:
+	.string	"__DECL_SIMD_tanf "
+.LASF2054:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2845:
+	.string	"strcasecmp"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF2455:
+	.string	"_SCHED_H 1"
+.LASF2368:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1757:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1630:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF1464:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1373:
+	.string	"FP_NAN 0"
+.LASF2823:
+	.string	"lookupTableAlignment"
+.LASF2621:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2457:
+	.string	"SCHED_OTHER 0"
+.LASF2602:
+	.string	"address"
+.LASF2065:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1346:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2849:
+	.string	"settingFind"
+.LASF2052:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2449:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1938:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2205:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1619:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1339:
+	.string	"_Mdouble_ long double"
+.LASF1099:
+	.string	"__DECL_SIMD_log10f "
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF2379:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2809:
+	.string	"modeColors"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2306:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1795:
+	.string	"IOCFG_IPU 0"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1322:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1528:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF2783:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF1634:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2732:
+	.string	"VAR_UINT8"
+.LASF2524:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1456:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF2404:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF1455:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF2623:
+	.string	"OWNER_SYSTEM"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2308:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1893:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF469:
+	.string	"__PMT"
+.LASF1126:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF2326:
+	.string	"LED_XY_MASK 0x0F"
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1612:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2773:
+	.string	"PID_POS"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1661:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2389:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2141:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2428:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2820:
+	.string	"lookupTableOffOn"
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1734:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2151:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF1390:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1185:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1109:
+	.string	"__DECL_SIMD_log2f "
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1351:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2512:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh "
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1981:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2281:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1376:
+	.string	"FP_SUBNORMAL 3"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1692:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2146:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1134:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2654:
+	.string	"BOXANGLE"
+.LASF1271:
+	.string	"__DECL_SIMD_log2"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1435:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2286:
+	.string	"HSV_VALUE_MAX 255"
+.LASF2110:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1904:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF2243:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1223:
+	.string	"__DECL_SIMD_acos"
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF2577:
+	.string	"DEBUG_BATTERY"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1914:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1626:
+	.string	"UNIT_TESTED "
+.LASF2328:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF962:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2217:
+	.string	"VALUE_SECTION_OFFSET 2"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2525:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2416:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF2327:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2035:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF2541:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1007:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2387:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF1870:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"__DECL_SIMD_logf"
+.LASF2430:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF1226:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1461:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1651:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1006:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1052:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1873:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF479:
+	.string	"__P(args) args"
+.LASF2190:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF2476:
+	.string	"sched_priority sched_priority"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1686:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2376:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1643:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1417:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1368:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1347:
+	.string	"_Mdouble_ _Float128"
+.LASF1767:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1454:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1177:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2543:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF915:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1948:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2118:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1413:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1124:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2754:
+	.string	"name"
+.LASF1269:
+	.string	"__DECL_SIMD_log10f"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2122:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1486:
+	.string	"BLACKBOX "
+.LASF2539:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF2722:
+	.string	"TABLE_LOWPASS_TYPE"
+.LASF2282:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF1970:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1941:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1416:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF2739:
+	.string	"MODE_DIRECT"
+.LASF1002:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1781:
+	.string	"LED1_ON NOOP"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF2851:
+	.string	"settingName"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF1758:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1562:
+	.string	"USE_SERIALRX_CRSF"
+.LASF952:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF741:
+	.string	"__need_NULL"
+.LASF1125:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1421:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2242:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1074:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1349:
+	.string	"_Mdouble_ _Float32x"
+.LASF2230:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2671:
+	.string	"BOXGOV"
+.LASF1069:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1885:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"_STDARG_H "
+.LASF1866:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1826:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF982:
+	.string	"__DECL_SIMD_powf32 "
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2542:
+	.string	"ESC_DATA_INVALID 255"
+.LASF1113:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1579:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF998:
+	.string	"__DECL_SIMD_atan "
+.LASF2213:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF2036:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1542:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1355:
+	.string	"__MATHDECL_ALIAS"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1968:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2604:
+	.string	"reset"
+.LASF1263:
+	.string	"__DECL_SIMD_atan2"
+.LASF2822:
+	.string	"lookupTableUnit"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1693:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1021:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2410:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF2461:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1662:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2333:
+	.string	"VTX_RTC6705_DEFAULT_POWER 0"
+.LASF1927:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1015:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1784:
+	.string	"LED2_ON NOOP"
+.LASF2629:
+	.string	"OWNER_SDCARD"
+.LASF1401:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1118:
+	.string	"__DECL_SIMD_log1p "
+.LASF2784:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF922:
+	.string	"_STRING_H 1"
+.LASF2790:
+	.string	"INPUT_RC_AUX1"
+.LASF2791:
+	.string	"INPUT_RC_AUX2"
+.LASF2792:
+	.string	"INPUT_RC_AUX3"
+.LASF2793:
+	.string	"INPUT_RC_AUX4"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2856:
+	.string	"sortValueTableIndex"
+.LASF1385:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1733:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2453:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1631:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF739:
+	.string	"NULL"
+.LASF2566:
+	.string	"int16_t"
+.LASF1907:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1229:
+	.string	"__DECL_SIMD_atanf"
+.LASF1654:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2555:
+	.string	"short unsigned int"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2546:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF1736:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2558:
+	.string	"signed char"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1637:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF946:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2575:
+	.string	"DEBUG_NONE"
+.LASF2706:
+	.string	"TABLE_GPS_SBAS_MODE"
+.LASF2716:
+	.string	"TABLE_MAG_HARDWARE"
+.LASF1062:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1491:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF1371:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1492:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1523:
+	.string	"U_ID_1 1"
+.LASF2284:
+	.string	"HSV_HUE_MAX 359"
+.LASF1297:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1552:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF2098:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1701:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2215:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1277:
+	.string	"__DECL_SIMD_log1pf"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1748:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1146:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1749:
+	.string	"PG_PID_CONFIG 504"
+.LASF942:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2730:
+	.string	"valueCount"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2310:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1244:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF2826:
+	.string	"lookupTableCurrentSensor"
+.LASF1628:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2061:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"VTX_TRAMP"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1228:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2847:
+	.string	"settingGetValueOffset"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2079:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1555:
+	.string	"USE_DASHBOARD"
+.LASF1495:
+	.string	"TELEMETRY_LTM "
+.LASF2155:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2275:
+	.string	"LAT 0"
+.LASF1516:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1402:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1909:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2342:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2536:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF2661:
+	.string	"BOXCAMSTAB"
+.LASF1379:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1110:
+	.string	"__DECL_SIMD_log2l "
+.LASF1434:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF2339:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2167:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2206:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2766:
+	.string	"FD_ROLL"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1709:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1211:
+	.string	"__DECL_SIMD_log"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1513:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1587:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2780:
+	.string	"SystemCoreClock"
+.LASF1227:
+	.string	"__DECL_SIMD_atan"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2004:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2681:
+	.string	"BOXAIRMODE"
+.LASF1135:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2736:
+	.string	"MASTER_VALUE"
+.LASF1588:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1713:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1341:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2239:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF2495:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF2313:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF2740:
+	.string	"MODE_LOOKUP"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2763:
+	.string	"lookupTableAccHardware"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF930:
+	.string	"__DECL_SIMD_cosl "
+.LASF1281:
+	.string	"__DECL_SIMD_atanhf"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1171:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2290:
+	.string	"LED_MODE_COUNT 6"
+.LASF1856:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1594:
+	.string	"_ANSI_STDDEF_H "
+.LASF2513:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1768:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1906:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2643:
+	.string	"OWNER_OSD"
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF1858:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1003:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1940:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2070:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2153:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1876:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2119:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2071:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1718:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1086:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2419:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2751:
+	.string	"minmax"
+.LASF1752:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2659:
+	.string	"BOXHEADFREE"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2386:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF1393:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1821:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1965:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2534:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1479:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1801:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF955:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1075:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2012:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1114:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1510:
+	.string	"VTX_SMARTAUDIO "
+.LASF2234:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF958:
+	.string	"__DECL_SIMD_log "
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF2203:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1422:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF2232:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1640:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2680:
+	.string	"BOXFAILSAFE"
+.LASF1427:
+	.string	"isascii(c) __isascii (c)"
+.LASF1375:
+	.string	"FP_ZERO 2"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2775:
+	.string	"PID_NAVR"
+.LASF1910:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1460:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF2022:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1793:
+	.string	"IOCFG_AF_OD 0"
+.LASF2096:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF972:
+	.string	"__DECL_SIMD_expf32 "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF2179:
+	.string	"I2CDEV_COUNT 4"
+.LASF971:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1061:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2196:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1827:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1848:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2432:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2108:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2025:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF1231:
+	.string	"__DECL_SIMD_asin"
+.LASF2532:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1738:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2603:
+	.string	"copy"
+.LASF1514:
+	.string	"GPS "
+.LASF2533:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1252:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1696:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1684:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1272:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1779:
+	.string	"LED1_TOGGLE NOOP"
+.LASF1808:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1712:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1041:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF2768:
+	.string	"FD_YAW"
+.LASF2564:
+	.string	"long int"
+.LASF2686:
+	.string	"BOXCAMERA2"
+.LASF2687:
+	.string	"BOXCAMERA3"
+.LASF1235:
+	.string	"__DECL_SIMD_hypot"
+.LASF1705:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1205:
+	.string	"__DECL_SIMD_sinf"
+.LASF2392:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2713:
+	.string	"TABLE_GYRO_HARDWARE"
+.LASF1111:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1750:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF2833:
+	.string	"lookupTableSuperExpoYaw"
+.LASF1819:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2400:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2314:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2719:
+	.string	"TABLE_MOTOR_PWM_PROTOCOL"
+.LASF2526:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2619:
+	.string	"OWNER_PINDEBUG"
+.LASF2210:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2273:
+	.string	"DASHBOARD_I2C_ADDRESS 0x3C"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1049:
+	.string	"__DECL_SIMD_coshf "
+.LASF2142:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1060:
+	.string	"__DECL_SIMD_expm1l "
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1976:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1912:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2672:
+	.string	"BOXOSD"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF2198:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF1268:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1496:
+	.string	"TELEMETRY_CRSF "
+.LASF2589:
+	.string	"DEBUG_SCHEDULER"
+.LASF1599:
+	.string	"_PTRDIFF_T_ "
+.LASF390:
+	.string	"SITL 1"
+.LASF1763:
+	.string	"PG_I2C_CONFIG 518"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1607:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1869:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2485:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF1888:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1540:
+	.string	"USE_FAKE_FLASH "
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF953:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2471:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF2493:
+	.string	"__struct_tm_defined 1"
+.LASF1323:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF2225:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2007:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2674:
+	.string	"BOXGTUNE"
+.LASF1574:
+	.string	"USE_RESOURCE_MGMT"
+.LASF2102:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1839:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2291:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF1663:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2320:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF1078:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2472:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF2390:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1671:
+	.string	"EXPAND_I(x) x"
+.LASF1652:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF2001:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2042:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2235:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2269:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF993:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1329:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2245:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2569:
+	.string	"uint32_t"
+.LASF2302:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF1010:
+	.string	"__DECL_SIMD_asinl "
+.LASF1679:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2116:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"U_ID_0 0"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1290:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2657:
+	.string	"BOXANTIGRAVITY"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1396:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1608:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF2016:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF2080:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1108:
+	.string	"__DECL_SIMD_log2 "
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1115:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1242:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2015:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2502:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1096:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1415:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF1127:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2718:
+	.string	"TABLE_SUPEREXPO_YAW"
+.LASF2613:
+	.string	"OWNER_ADC_BATT"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2664:
+	.string	"BOXGPSHOLD"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF2043:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1703:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1137:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF1598:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF2086:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2465:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF2214:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2679:
+	.string	"BOXBLACKBOX"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1570:
+	.string	"TELEMETRY_FRSKY"
+.LASF2557:
+	.string	"long unsigned int"
+.LASF2484:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2307:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF1392:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2660:
+	.string	"BOXHEADADJ"
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2503:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1688:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1425:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1519:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF947:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2000:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF2663:
+	.string	"BOXGPSHOME"
+.LASF1482:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2620:
+	.string	"OWNER_TIMER"
+.LASF1896:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1729:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1469:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1440:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1657:
+	.string	"CMS_EXIT (0)"
+.LASF2104:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1789:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2050:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1536:
+	.string	"USE_FAKE_MAG "
+.LASF1332:
+	.string	"_Mdouble_"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1424:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1221:
+	.string	"__DECL_SIMD_powf"
+.LASF2138:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2810:
+	.string	"specialColors"
+.LASF2323:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF2216:
+	.string	"VALUE_TYPE_OFFSET 0"
+.LASF1512:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2565:
+	.string	"char"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2429:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1104:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2492:
+	.string	"TIMER_ABSTIME 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1166:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2171:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1274:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF2031:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1792:
+	.string	"IOCFG_AF_PP 0"
+.LASF2211:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1101:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2801:
+	.string	"hsvColor_s"
+.LASF2802:
+	.string	"hsvColor_t"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1861:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1018:
+	.string	"__DECL_SIMD_hypot "
+.LASF1437:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF911:
+	.string	"__GNUC_VA_LIST "
+.LASF2026:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2667:
+	.string	"BOXLEDMAX"
+.LASF913:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF933:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1105:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF997:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1853:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1772:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2034:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1980:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2632:
+	.string	"OWNER_FLASH_CS"
+.LASF2496:
+	.string	"_BITS_SETJMP_H 1"
+.LASF2738:
+	.string	"PROFILE_RATE_VALUE"
+.LASF1568:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1504:
+	.string	"USE_RX_MSP "
+.LASF2010:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"_CTYPE_H 1"
+.LASF398:
+	.string	"true 1"
+.LASF2804:
+	.string	"color"
+.LASF935:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2293:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1918:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2194:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2837:
+	.string	"lookupTableLowpassType"
+.LASF989:
+	.string	"__DECL_SIMD_acosf "
+.LASF2421:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2656:
+	.string	"BOXBARO"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2514:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2398:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF975:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1172:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2582:
+	.string	"DEBUG_PIDLOOP"
+.LASF1776:
+	.string	"LED0_TOGGLE NOOP"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1237:
+	.string	"__DECL_SIMD_hypotf"
+.LASF2594:
+	.string	"DEBUG_FFT"
+.LASF2345:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2262:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2691:
+	.string	"ROLL"
+.LASF1131:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1077:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1248:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1467:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1561:
+	.string	"SERIAL_RX"
+.LASF2395:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2188:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1632:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1254:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1721:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2769:
+	.string	"PID_ROLL"
+.LASF1184:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1013:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1951:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2462:
+	.string	"__CPU_SETSIZE 1024"
+.LASF2741:
+	.string	"MODE_ARRAY"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1169:
+	.string	"__DECL_SIMD_asinhf "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF1145:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1669:
+	.string	"STR_HELPER(x) #x"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1949:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF1962:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2491:
+	.string	"CLOCK_TAI 11"
+.LASF2714:
+	.string	"TABLE_ACC_HARDWARE"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2834:
+	.string	"lookupTablePwmProtocol"
+.LASF1726:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1582:
+	.string	"VTX_SMARTAUDIO"
+.LASF1480:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2624:
+	.string	"OWNER_SPI_SCK"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1503:
+	.string	"USE_RCSPLIT "
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1624:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1270:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2384:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2073:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1972:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2470:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF1238:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF943:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1039:
+	.string	"__DECL_SIMD_exp10f "
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2782:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2011:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1929:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1799:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1036:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1597:
+	.string	"_T_PTRDIFF "
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2403:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF814:
+	.string	"__off_t_defined "
+.LASF1195:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1230:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF914:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2529:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF2482:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1302:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2788:
+	.string	"INPUT_RC_YAW"
+.LASF1194:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2356:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF2208:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1532:
+	.string	"USE_FAKE_ACC "
+.LASF2796:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF2087:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux 1"
+.LASF1411:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1370:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2117:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2053:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2473:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1403:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1999:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF2586:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF1095:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2835:
+	.string	"lookupTableRcInterpolation"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1389:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1240:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1963:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2756:
+	.string	"config"
+.LASF1882:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1412:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2854:
+	.string	"settingsBuildCheck"
+.LASF2423:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2148:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2337:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1321:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1441:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1285:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2156:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2170:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1183:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1264:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1369:
+	.string	"__MATHCALL_NARROW"
+.LASF1685:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1658:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF2370:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2581:
+	.string	"DEBUG_AIRMODE"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1210:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2824:
+	.string	"lookupTableGPSProvider"
+.LASF2490:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF988:
+	.string	"__DECL_SIMD_acos "
+.LASF2673:
+	.string	"BOXTELEMETRY"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2267:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1664:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1059:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1083:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1988:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1905:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1739:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1676:
+	.string	"PP_IIF_1(t,f) t"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1683:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2316:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2576:
+	.string	"DEBUG_CYCLETIME"
+.LASF2591:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1470:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1308:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1153:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1887:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2258:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1400:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2832:
+	.string	"lookupTableDebug"
+.LASF1220:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1418:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1474:
+	.string	"USE_CLI_BATCH "
+.LASF2064:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2574:
+	.string	"double"
+.LASF1809:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1840:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2413:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1675:
+	.string	"PP_IIF_0(t,f) f"
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF991:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2818:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2412:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1088:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1307:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1894:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF924:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2627:
+	.string	"OWNER_I2C_SCL"
+.LASF2625:
+	.string	"OWNER_SPI_MISO"
+.LASF1851:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"__DECL_SIMD_acosh"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2649:
+	.string	"OWNER_COMPASS_CS"
+.LASF2528:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2224:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1534:
+	.string	"USE_FAKE_GYRO "
+.LASF1975:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1859:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF2259:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1689:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2303:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2709:
+	.string	"TABLE_CURRENT_METER"
+.LASF1165:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2745:
+	.string	"tableIndex"
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2853:
+	.string	"rc_alias"
+.LASF2420:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1465:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF1649:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2139:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2377:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1620:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1606:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1388:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1766:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2690:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2391:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1315:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1382:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2628:
+	.string	"OWNER_I2C_SDA"
+.LASF2358:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2563:
+	.string	"__uint32_t"
+.LASF999:
+	.string	"__DECL_SIMD_atanf "
+.LASF2318:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1176:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF2821:
+	.string	"lookupTableCrashRecovery"
+.LASF1361:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2077:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1786:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF1073:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1706:
+	.string	"PG_IMU_CONFIG 22"
+.LASF2311:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF1655:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF1472:
+	.string	"USE_CLI "
+.LASF1289:
+	.string	"__DECL_SIMD_erff"
+.LASF1190:
+	.string	"__DECL_SIMD_tanl "
+.LASF2414:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF2431:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2120:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2710:
+	.string	"TABLE_VOLTAGE_METER"
+.LASF1306:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF990:
+	.string	"__DECL_SIMD_acosl "
+.LASF1708:
+	.string	"PG_RX_CONFIG 24"
+.LASF1735:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF1641:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF2222:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2808:
+	.string	"colors"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1286:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1324:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF979:
+	.string	"__DECL_SIMD_powf "
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1326:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF1450:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF985:
+	.string	"__DECL_SIMD_powf32x "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2157:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF2068:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2351:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1593:
+	.string	"_STDDEF_H_ "
+.LASF1806:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1897:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"__DECL_SIMD_asin "
+.LASF2173:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2097:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2174:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1198:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1357:
+	.string	"__MATHCALL"
+.LASF1102:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1953:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2051:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1170:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1429:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF2481:
+	.string	"CLOCK_REALTIME 0"
+.LASF1769:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1778:
+	.string	"LED0_ON NOOP"
+.LASF2488:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1404:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1991:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2644:
+	.string	"OWNER_RX_BIND"
+.LASF1740:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1155:
+	.string	"__DECL_SIMD_erff32x "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1509:
+	.string	"VTX_CONTROL "
+.LASF1128:
+	.string	"__DECL_SIMD_atanh "
+.LASF941:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2062:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2647:
+	.string	"OWNER_TRANSPONDER"
+.LASF1707:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1449:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1316:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2547:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF2417:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2450:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1040:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1908:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF2409:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1117:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1854:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1097:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2024:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1974:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2221:
+	.string	"VALUE_MODE_MASK (0x30)"
+.LASF1600:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1233:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1295:
+	.string	"__DECL_SIMD_asinh"
+.LASF2704:
+	.string	"TABLE_ALIGNMENT"
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF2350:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF2464:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2683:
+	.string	"BOXFPVANGLEMIX"
+.LASF2330:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF1057:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1019:
+	.string	"__DECL_SIMD_hypotf "
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF1258:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF1004:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1862:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2033:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1156:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2572:
+	.string	"long long unsigned int"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1743:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF2757:
+	.string	"offset"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF983:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2253:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1284:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2058:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2725:
+	.string	"LOOKUP_TABLE_COUNT"
+.LASF2634:
+	.string	"OWNER_MPU_CS"
+.LASF2599:
+	.string	"pgn_t"
+.LASF1754:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2511:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2279:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2726:
+	.string	"lookupTableIndex_e"
+.LASF2336:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2121:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2827:
+	.string	"lookupTableBatterySensor"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1584:
+	.string	"USE_I2C"
+.LASF1005:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1777:
+	.string	"LED0_OFF NOOP"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF2584:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1535:
+	.string	"MAG "
+.LASF2498:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF1029:
+	.string	"__DECL_SIMD_exp2f "
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF945:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF1245:
+	.string	"__DECL_SIMD_exp10f"
+.LASF2711:
+	.string	"TABLE_GIMBAL_MODE"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1391:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2762:
+	.string	"lookupTableGyroHardware"
+.LASF1549:
+	.string	"USE_UART7 "
+.LASF1672:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1765:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF2361:
+	.string	"SPEK_FRAME_SIZE 16"
+.LASF918:
+	.string	"_VA_LIST "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF2226:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF2500:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1428:
+	.string	"toascii(c) __toascii (c)"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1609:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1342:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1824:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1690:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2099:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1119:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1204:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF2199:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF2842:
+	.string	"getCurrentPidProfileIndex"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF2774:
+	.string	"PID_POSR"
+.LASF1056:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1063:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1986:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2005:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1960:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2702:
+	.string	"TABLE_OFF_ON"
+.LASF1629:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1747:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1167:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2606:
+	.string	"OWNER_FREE"
+.LASF1463:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF2378:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1038:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1842:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF2752:
+	.string	"array"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF925:
+	.string	"_STRINGS_H 1"
+.LASF1026:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2551:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2778:
+	.string	"PID_VEL"
+.LASF920:
+	.string	"_VA_LIST_T_H "
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2588:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF2798:
+	.string	"RGB_RED"
+.LASF2233:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1159:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1913:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2109:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1191:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2383:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF1770:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2607:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2843:
+	.string	"pgFind"
+.LASF1207:
+	.string	"__DECL_SIMD_sincos"
+.LASF2521:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF2227:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2365:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2162:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1879:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"__DECL_SIMD_powf64x "
+.LASF936:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2189:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2394:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF2027:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1625:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2458:
+	.string	"SCHED_FIFO 1"
+.LASF2474:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF2537:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF1000:
+	.string	"__DECL_SIMD_atanl "
+.LASF1550:
+	.string	"USE_UART8 "
+.LASF2260:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2744:
+	.string	"cliLookupTableConfig_s"
+.LASF2746:
+	.string	"cliLookupTableConfig_t"
+.LASF1911:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1589:
+	.string	"DEFIO_NO_PORTS "
+.LASF1857:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2434:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2229:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF397:
+	.string	"bool _Bool"
+.LASF1601:
+	.string	"___int_ptrdiff_t_h "
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1098:
+	.string	"__DECL_SIMD_log10 "
+.LASF2372:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1865:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2256:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF1431:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1154:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1037:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2721:
+	.string	"TABLE_RC_INTERPOLATION_CHANNELS"
+.LASF2161:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2134:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1071:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1224:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF2469:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF992:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1714:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2427:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2530:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2538:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1079:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1256:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF980:
+	.string	"__DECL_SIMD_powl "
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF819:
+	.string	"__key_t_defined "
+.LASF2571:
+	.string	"long long int"
+.LASF2049:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1787:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF957:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2355:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2579:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1162:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2510:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF1521:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1694:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2630:
+	.string	"OWNER_SDCARD_CS"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1345:
+	.string	"_Mdouble_ _Float64"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2435:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2074:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2592:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1423:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF2084:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2393:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2280:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1775:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF2268:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1352:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1822:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2415:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2250:
+	.string	"ALL_MOTORS 255"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2497:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1836:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1543:
+	.string	"USE_UART1 "
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1810:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2438:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2143:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2029:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2089:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2499:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2424:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2446:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2688:
+	.string	"BOXDSHOTREVERSE"
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF1149:
+	.string	"__DECL_SIMD_erff "
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1867:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2201:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1359:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF1755:
+	.string	"PG_ADC_CONFIG 510"
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2651:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF2040:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2270:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF1362:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2331:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF1551:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF931:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1483:
+	.string	"USE_SERIALRX_SUMH "
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1900:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1477:
+	.string	"SERIAL_RX "
+.LASF1653:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF2646:
+	.string	"OWNER_LED_STRIP"
+.LASF2057:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1544:
+	.string	"USE_UART2 "
+.LASF1508:
+	.string	"VTX_COMMON "
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1511:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2289:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF2777:
+	.string	"PID_MAG"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2277:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2779:
+	.string	"PID_ITEM_COUNT"
+.LASF1287:
+	.string	"__DECL_SIMD_erf"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF939:
+	.string	"__DECL_SIMD_sinf "
+.LASF2516:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF2294:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF923:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2165:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2381:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1157:
+	.string	"__DECL_SIMD_erff128x "
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1313:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2815:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1500:
+	.string	"TELEMETRY_SRXL "
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1698:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2219:
+	.string	"VALUE_TYPE_MASK (0x03)"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2341:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1725:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1168:
+	.string	"__DECL_SIMD_asinh "
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2272:
+	.string	"DASHBOARD_I2C_INSTANCE I2CDEV_1"
+.LASF1828:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1030:
+	.string	"__DECL_SIMD_exp2l "
+.LASF967:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1545:
+	.string	"USE_UART3 "
+.LASF1325:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF1992:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2045:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"__DECL_SIMD_acosh "
+.LASF2439:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF2841:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF1526:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1860:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1728:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF2018:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2180:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1541:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1265:
+	.string	"__DECL_SIMD_atan2f"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1644:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2276:
+	.string	"LON 1"
+.LASF1219:
+	.string	"__DECL_SIMD_pow"
+.LASF2772:
+	.string	"PID_ALT"
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2444:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2264:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF2263:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2633:
+	.string	"OWNER_BARO_CS"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF2786:
+	.string	"INPUT_RC_ROLL"
+.LASF1745:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1681:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2285:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1142:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2411:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF2399:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1132:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2556:
+	.string	"unsigned int"
+.LASF2811:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1546:
+	.string	"USE_UART4 "
+.LASF1697:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1022:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2176:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1187:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2418:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF2169:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1372:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1573:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1800:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2324:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2069:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2596:
+	.string	"DEBUG_FFT_FREQ"
+.LASF2401:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2443:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1089:
+	.string	"__DECL_SIMD_atan2f "
+.LASF948:
+	.string	"__DECL_SIMD_sincos "
+.LASF2107:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhl "
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2321:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF1889:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2665:
+	.string	"BOXPASSTHRU"
+.LASF1215:
+	.string	"__DECL_SIMD_exp"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1753:
+	.string	"PG_PWM_CONFIG 508"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2044:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2612:
+	.string	"OWNER_ADC"
+.LASF2561:
+	.string	"short int"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2019:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2797:
+	.string	"inputSource_e"
+.LASF1214:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF974:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1082:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2595:
+	.string	"DEBUG_FFT_TIME"
+.LASF2129:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2125:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2662:
+	.string	"BOXCAMTRIG"
+.LASF2075:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF30:
+	.string	"_LP64 1"
+.LASF1547:
+	.string	"USE_UART5 "
+.LASF2092:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF968:
+	.string	"__DECL_SIMD_exp "
+.LASF1439:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1353:
+	.string	"__MATHDECL_1_IMPL"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1577:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1843:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF2615:
+	.string	"OWNER_ADC_EXT"
+.LASF1180:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1990:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2147:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1744:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1280:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2436:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1209:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2006:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2635:
+	.string	"OWNER_OSD_CS"
+.LASF2353:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2133:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1604:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2855:
+	.string	"compareSettingName"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2013:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF1387:
+	.string	"M_E 2.7182818284590452354"
+.LASF1916:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1903:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2126:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF963:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1239:
+	.string	"__DECL_SIMD_exp2"
+.LASF1174:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1548:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1080:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2747:
+	.string	"cliArrayLengthConfig_s"
+.LASF2749:
+	.string	"cliArrayLengthConfig_t"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2971:
+	.string	"rx_pwm.h"
+.LASF2936:
+	.string	"thread-shared-types.h"
+.LASF2988:
+	.string	"pwm_output.h"
+.LASF2876:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2949:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2878:
+	.string	"/usr/include"
+.LASF2953:
+	.string	"mathcalls-helper-functions.h"
+.LASF3020:
+	.string	"voltage_ids.h"
+.LASF2927:
+	.string	"endianness.h"
+.LASF2921:
+	.string	"floatn-common.h"
+.LASF2904:
+	.string	"stdint.h"
+.LASF2994:
+	.string	"osd.h"
+.LASF3013:
+	.string	"pthread_stack_min.h"
+.LASF2984:
+	.string	"altitude.h"
+.LASF2858:
+	.string	"src/main/build"
+.LASF2875:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3014:
+	.string	"barometer.h"
+.LASF2903:
+	.string	"stdbool.h"
+.LASF2970:
+	.string	"flash.h"
+.LASF2962:
+	.string	"time.h"
+.LASF2930:
+	.string	"select.h"
+.LASF2893:
+	.string	"color.h"
+.LASF2992:
+	.string	"gimbal.h"
+.LASF2990:
+	.string	"navigation.h"
+.LASF2870:
+	.string	"src/main/target/SITL"
+.LASF2954:
+	.string	"mathcalls.h"
+.LASF2997:
+	.string	"spektrum.h"
+.LASF2935:
+	.string	"pthreadtypes.h"
+.LASF2979:
+	.string	"sound_beeper.h"
+.LASF3023:
+	.string	"esc_sensor.h"
+.LASF3021:
+	.string	"boardalignment.h"
+.LASF2966:
+	.string	"parameter_group_ids.h"
+.LASF2874:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2905:
+	.string	"libc-header-start.h"
+.LASF2925:
+	.string	"timer_t.h"
+.LASF2985:
+	.string	"failsafe.h"
+.LASF2898:
+	.string	"settings.c"
+.LASF2956:
+	.string	"platform.h"
+.LASF2879:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2863:
+	.string	"src/main/drivers/barometer"
+.LASF3016:
+	.string	"filter.h"
+.LASF2960:
+	.string	"blackbox.h"
+.LASF2886:
+	.string	"resource.h"
+.LASF3004:
+	.string	"pthread.h"
+.LASF2888:
+	.string	"settings.h"
+.LASF2892:
+	.string	"servos.h"
+.LASF2866:
+	.string	"src/main/flight"
+.LASF2923:
+	.string	"clockid_t.h"
+.LASF3025:
+	.string	"gyroanalyse.h"
+.LASF2885:
+	.string	"debug.h"
+.LASF2959:
+	.string	"build_config.h"
+.LASF2902:
+	.string	"stdc-predef.h"
+.LASF2972:
+	.string	"sdcard.h"
+.LASF2983:
+	.string	"rc_adjustments.h"
+.LASF2947:
+	.string	"math.h"
+.LASF2926:
+	.string	"endian.h"
+.LASF3000:
+	.string	"exti.h"
+.LASF2896:
+	.string	"frsky.h"
+.LASF2975:
+	.string	"io_def.h"
+.LASF3001:
+	.string	"bus.h"
+.LASF2906:
+	.string	"features.h"
+.LASF2873:
+	.string	"src/main"
+.LASF2987:
+	.string	"mixer.h"
+.LASF2867:
+	.string	"src/main/io"
+.LASF2948:
+	.string	"math-vector.h"
+.LASF3010:
+	.string	"setjmp.h"
+.LASF2908:
+	.string	"wordsize.h"
+.LASF2861:
+	.string	"src/main/config"
+.LASF3009:
+	.string	"struct_itimerspec.h"
+.LASF2907:
+	.string	"features-time64.h"
+.LASF2900:
+	.string	"strings.h"
+.LASF3022:
+	.string	"compass.h"
+.LASF2862:
+	.string	"src/main/drivers/accgyro"
+.LASF2940:
+	.string	"struct_rwlock.h"
+.LASF2928:
+	.string	"byteswap.h"
+.LASF2899:
+	.string	"config.h"
+.LASF2912:
+	.string	"stubs.h"
+.LASF3024:
+	.string	"gyro.h"
+.LASF2915:
+	.string	"time64.h"
+.LASF2918:
+	.string	"waitflags.h"
+.LASF2891:
+	.string	"target.h"
+.LASF2897:
+	.string	"telemetry.h"
+.LASF2957:
+	.string	"common_fc_pre.h"
+.LASF2967:
+	.string	"light_led.h"
+.LASF2944:
+	.string	"string.h"
+.LASF2919:
+	.string	"waitstatus.h"
+.LASF2865:
+	.string	"src/main/fc"
+.LASF2916:
+	.string	"wchar.h"
+.LASF2909:
+	.string	"timesize.h"
+.LASF2860:
+	.string	"src/main/common"
+.LASF3019:
+	.string	"voltage.h"
+.LASF0:
+	.string	"./src/main/fc/settings.c"
+.LASF2996:
+	.string	"rx.h"
+.LASF3017:
+	.string	"current.h"
+.LASF2877:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2978:
+	.string	"rcc_types.h"
+.LASF2993:
+	.string	"gps.h"
+.LASF2924:
+	.string	"time_t.h"
+.LASF2998:
+	.string	"acceleration.h"
+.LASF2883:
+	.string	"stddef.h"
+.LASF2952:
+	.string	"fp-fast.h"
+.LASF3008:
+	.string	"struct_tm.h"
+.LASF2920:
+	.string	"floatn.h"
+.LASF2950:
+	.string	"flt-eval-method.h"
+.LASF2977:
+	.string	"bus_i2c.h"
+.LASF2894:
+	.string	"ledstrip.h"
+.LASF2964:
+	.string	"display.h"
+.LASF2989:
+	.string	"timer.h"
+.LASF2938:
+	.string	"atomic_wide_counter.h"
+.LASF2974:
+	.string	"io.h"
+.LASF2884:
+	.string	"parameter_group.h"
+.LASF2981:
+	.string	"controlrate_profile.h"
+.LASF2890:
+	.string	"pid.h"
+.LASF2976:
+	.string	"io_def_generated.h"
+.LASF3018:
+	.string	"current_ids.h"
+.LASF2965:
+	.string	"utils.h"
+.LASF2929:
+	.string	"uintn-identity.h"
+.LASF3006:
+	.string	"struct_sched_param.h"
+.LASF2982:
+	.string	"fc_core.h"
+.LASF2895:
+	.string	"sensors.h"
+.LASF3007:
+	.string	"cpu-set.h"
+.LASF2980:
+	.string	"vcd.h"
+.LASF3003:
+	.string	"accgyro_mpu.h"
+.LASF2913:
+	.string	"stubs-64.h"
+.LASF2887:
+	.string	"rc_modes.h"
+.LASF2882:
+	.string	"stdint-uintn.h"
+.LASF2963:
+	.string	"cms.h"
+.LASF3011:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2922:
+	.string	"clock_t.h"
+.LASF2951:
+	.string	"fp-logb.h"
+.LASF2969:
+	.string	"adc.h"
+.LASF2911:
+	.string	"long-double.h"
+.LASF2901:
+	.string	"rc_controls.h"
+.LASF3015:
+	.string	"battery.h"
+.LASF2910:
+	.string	"cdefs.h"
+.LASF2943:
+	.string	"stdarg.h"
+.LASF2868:
+	.string	"src/main/rx"
+.LASF2914:
+	.string	"typesizes.h"
+.LASF2857:
+	.string	"src/main/blackbox"
+.LASF3002:
+	.string	"sensor.h"
+.LASF2958:
+	.string	"common_fc_post.h"
+.LASF2945:
+	.string	"locale_t.h"
+.LASF2871:
+	.string	"src/main/target"
+.LASF3012:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2995:
+	.string	"vtx_rtc6705.h"
+.LASF2889:
+	.string	"axis.h"
+.LASF2955:
+	.string	"ctype.h"
+.LASF2986:
+	.string	"imu.h"
+.LASF2864:
+	.string	"src/main/drivers"
+.LASF2931:
+	.string	"sigset_t.h"
+.LASF2973:
+	.string	"serial.h"
+.LASF2942:
+	.string	"stdlib-float.h"
+.LASF2917:
+	.string	"stdlib.h"
+.LASF2859:
+	.string	"src/main/cms"
+.LASF2934:
+	.string	"struct_timespec.h"
+.LASF2933:
+	.string	"struct_timeval.h"
+.LASF2991:
+	.string	"dashboard.h"
+.LASF2869:
+	.string	"src/main/sensors"
+.LASF2881:
+	.string	"stdint-intn.h"
+.LASF2941:
+	.string	"alloca.h"
+.LASF2946:
+	.string	"__locale_t.h"
+.LASF2880:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2939:
+	.string	"struct_mutex.h"
+.LASF2999:
+	.string	"accgyro.h"
+.LASF2872:
+	.string	"src/main/telemetry"
+.LASF2961:
+	.string	"blackbox_fielddefs.h"
+.LASF2937:
+	.string	"pthreadtypes-arch.h"
+.LASF2968:
+	.string	"io_types.h"
+.LASF3005:
+	.string	"sched.h"
+.LASF2932:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"5\t"
+	.string	"t\020?\001"
+	.string	")"
+	.string	"\254\362\247\354\n\f\002"
+	.string	"\002\001\002\002\002\003\004\002\004\001\240\342\234\212\n\002\305\355\241\370\005\003\004\251\200\364\267\006\002\002\005\002\005\005\343\323\306\321\001\002\002"
+	.string	"\002\006\006\342\353\273\220\006\006\006\002\006\007\257\221\313\212\013\006\002\007\002\006\b\333\262\246\323\001\006\002\b\002\t\t\233\364\343\336\006"
+	.string	"\n\243\364\237\242\t\013\256\361\377\337\t\f\376\367\260\205\006\r\323\347\261\306\003\016\330\264\373\207\t\017\221\327\373\372\t\020\261\372\215\340\017\021\367\316\327\257\017\022\206\340\246\342\006\023\371\270\213\276\f\024\225\254\310\321\004\025\216\307\310\264\005\026\356\214\300\203\f\027\337\257\374\304\r\030\331\246\217\340\n\031\201\200\324\222\b\032\210\270\313\332\b\033\305\270\203\267\007\034\231\246\357\235\n\035\355\316\316\363\b\036\327\222\361\365\013\037\365\236\302\302\r \342\223\240\267\n!\302\260\202\373\013\"\263\374\313\376\005#\240\342\234\212\n$%&'(\240\342\234\212\n"
+	.string	"\f"
+	.string	"@\004\334\201\306R)\202\212\n\330\305Z4\324\b\007\262\312\234\227vY9\253"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \204\345\002"
+	.string	"\204\003x"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\004\003"
+	.string	"\b\003\003\001\200\f"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\b\005\001"
+	.string	"\002\006\002\001\004\t\007\001\001\002\n\002\007\b\001\002\b\005\003\001\002\t"
+	.string	"\001"
+	.string	"\016"
+	.ascii	" \210\230\211\2772$\252\371\251\2656\327\3410\b5gT`J\245kT3\200"
+	.ascii	"\313\305\366\r`\001"
+	.text
+	.section	.gnu.lto_.inline.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`S\001%\n"
+	.string	"\346\021:60\345&\351"
+	.string	"wJ\365\rm\207\212\323-\2050\035L$\243\201\341E\321\003\003)\371\351\261\326\354:(\203Rl\030\030\020A\237\357Ag\335c\255\375\326\b\221;\005+"
+	.string	","
+	.string	"-"
+	.string	"/\025\373\007\024\261\243BA,N&8\273\257\354+\353w\343.\326LQ\310\364\016u\021IT\030\3641T\026\212\226\222\202\307\334\203\r]\321 \301 x\332\355.\b\323\271\037\332Uq\314\314\244\226\360\312\332\317\221\376\253A\035yI\271hFL\217\265"
+	.string	"\034\031"
+	.string	"4\355\327\003\361\231\255\266\246H\241\007\272\n;\323\233bh\265\2613m\032Z\032\023\232If\016\214\321\2404Z\032\265/C?T:6<}\f\377}\304\332\231\2056\247\211df5\365\225\341\324W\355\237\265\373X\327\275\037\350g\375>\317\272\357\343\031\241(\231)\020% P\"bF\355aP}\200\030R\340t\360\324\0028\222U\311L \205"
+	.ascii	"\244\020\r!\0074\312\031)Y\316\241\013\030\364.@\302\030\202"
+	.ascii	"X\346V\363<\337\315tX\303\201\354|Zp\370X\360\001*-\276\212\314"
+	.ascii	"{\027#\bk\236wXtq\204\t\2226\034/)\234\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\245\003"
+	.string	"RF\022\031\260%\351\024K\346(\204a\310\345\352a\230\3220`i\3266\262\311\3362\311$\001\234\273\333\241\254>O8'\321G\017|\213U\316\217\301\335\335PJ)\223Psm\032\325\250\021\265\321\005\377\220\225\nN\305$\221$,\004\020"
+	.ascii	"C\024\022\005t<\003k<\324?-@\270\200@\020\306\025\030\263\326"
+	.ascii	"\001\002\267f\036\315P\347`\332\3023\200\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\004\205\004\005\231\004\006\270\004\007\231\004\b\231"
+	.ascii	"\004\t\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \345\325\004"
+	.string	"\262\207\032$\240)\303\001`\2510pu>\033\006\210\241\342\2768\325|\267\223\212\241\262\036\314\376\317\325\347\222M\270\255\224)K\223\024M\321\304@\260\247\241\274\320\326\306\b\026|\236gj\226\035\336\343\"\261\270\311\177\363\330\253\323\256\346<PN\350zl\024\025\204\222\241\032\216\310\177\033\267\034s\200\225xB\345P\373l\345\203r\347\366W\002\023"
+	.string	"+9B\b\207\3432\314\"\321\216%\272\302\260\013\202\005\030\233\"\022\2200\201\206f\220\270\225\237+th-eC\013M\020\332"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.lto.5eb74295a49b0a7c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.142.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\220\0015\r"
+	.string	"T\025\321\001"
+	.string	""
+	.string	"\263"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\232\002}\273\001"
+	.string	"\005\001\006\025\001\017\005\001'.\206\b{\370\325Qy\276\016\005\001'6\206\bw\bu\301\r\005\001'@\304\f\005\001'J\307\013\005\001'T\312\n\005\001'^\206\bsq\315\t\005\001'g\320'p\322\007\005\001'y\206\bo\230\325\001m\325\006\005\001'\205\001\by\330\005\005\001'\215\001\333\004\005\001'\226\336\003\005\001'\237\341\002\005\001'\250\001\b}\344'\256\346\001"
+	.string	"?\202\210\200\300\002k3\347\0014\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\0015\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM206890821"
+	.string	"\bMPU9250650000"
+	.string	"\013LSM303DLHCA28MA8452ADXL345"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"'  \243)r\003["
+	.ascii	"\315\222\302\006\215\255\221\216[\323\fJ+\364\004\272][[pi7\234"
+	.ascii	"\211\243\315X;\3572!\221\227\236<\306\262\213k\3263O\306\036"
+	.ascii	"n-\301\365\214\021\2261\374\311D\2562&\376xv\310\321\227_\303"
+	.ascii	"L\006\007\007"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.143.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`h\001\315\f"
+	.string	"\304\024\263\001"
+	.string	""
+	.string	"\251"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\233\002}\273\001"
+	.string	"\005\001\006\025\001\016\005\001'.\206\b{\370\334Qy\276\r\005\001'6\206\bw\bu\301\f\005\001'@\206\bsq\304\013\005\001'K\307\n\005\001'U\312\t\005\001'_\206\bom\315'h\317\006\025\001\007\005\001'q\322\006\005\001'z\230\334\001y\325\005\005\001'\202\001\330\004\005\001'\213\001\333\003\005\001'\225\336\002\005\001'\236\001\b}\341'\244\343\001"
+	.string	"?\202\210\200\370\001k3\344\0014\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\001\321\001\320\0015\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM20689"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\007L3GD23050"
+	.string	"\tL3G4200D50"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.ascii	"# \360\"\302\306\006\207\254\372@\227\203j\250h\214J\306\240"
+	.ascii	"\016\362\356\260E\206\361t\227\263{\037\235\214]\346\020\231"
+	.ascii	"\300x\361\254\217\266\2321\316qK\230\214[\234\260\031\343\374"
+	.ascii	"=\023\025\327e\034\341<\2173\367d\335 \277\241\027\001"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.144.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \347\345\005"
+	.string	"$\n\220"
+	.string	""
+	.string	""
+	.string	"K"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\234\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\370\337Q}\276\003\005\001'8\b}\301\002\005\001'@\206\b{y\304'F\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007BMP280"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\t"
+	.ascii	"QVB\264\311\030X\f\b\347\231\007\330\332g\326\nj\277\001\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.145.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \350\375\005"
+	.string	"T\n\220"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\234\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\370\346Q}\276\003\005\001'8\206\b{\by\301\002\005\001'A\206\bwu\304'G\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007AK8963"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c75"
+	.string	"\bHMC5883"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\t"
+	.ascii	"ITC\264\311\030X\f\b\347\231\007\310\334g\326\nj\277\001\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.146.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 tu\003"
+	.string	"4\0068"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\355\021}\273\001,\206\b{\270\355Qy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.147.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\235\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\270\357Qy\276'2\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BEEP"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.string	"V\245\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableUnit.148.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\236\002}\273\0010\206\b{\270\365Qy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.149.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"]\t"
+	.string	"T\017\f\001"
+	.string	""
+	.string	"r"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\370\237\002}\273\0013\370\376Q}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'>\206\b{\230\376\001y\300\006\005\001'H\206\bw\330\375\001u\303\005\005\001'Q\206\bs\230\375\001q\306\004\005\001'X\330\374\001q\311\003\005\001'_\206\bo\230\374\001m\314\002\005\001'e\206\bk\330\367\001i\317'j\230\367\001u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\244p/\313\030^\r\002\006A\252\341\020\3146`\037\310"
+	.ascii	"\021\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312\027"
+	.ascii	"\254\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.150.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 y\235\003"
+	.string	"\204\0069"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\340\250\002}\273\001/\206\b{\370\305Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006UBLOX"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\005NMEA"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.151.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"d\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\300\251\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'/\206\b{\370\307Ry\276\003\005\001'5\by\301\002\005\001';\b}\304'B\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006GAGAN"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\b"
+	.ascii	"JX\314cG\205\267\346\231\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableCurrentSensor.152.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \276=\005"
+	.string	"D\tr"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\316\022}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'-\206\b{\270\316Ry\276\002\005\001'6\b}\301';\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"6I\363\fc\253\255}fM\240\362\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableBatterySensor.153.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\324\022}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'-\270\324R}\276'2\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.154.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 }\315\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\252\002}\273\001"
+	.string	"\005\001'1\206\b{\370\326Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007NORMAL"
+	.string	"\002"
+	.string	"\357\314n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.155.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \306\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\253\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\370\335R}\276\002\005\001'8\206\b{\by\301'B\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OH\315\323\016\220\271\317\254\025\324~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxProfile.156.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \243\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\300\254\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'4\206\b{\370\337Ry\276'<\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013LONG_RANGE"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007TUNING"
+	.string	"\005FULL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGyroLpf.157.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"m\b"
+	.string	"4\016\364"
+	.string	""
+	.string	""
+	.string	"^"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\320\271\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'6\206\b{\270\314Sy\276\006\005\001';\206\bw\330\307\003u\301\005\005\001'A\230\307\003u\304\004\005\001'G\330\306\003u\307\003\005\001'M\230\306\003u\312\002\005\001'S\206\bs\330\305\003q\315'Z\230\305\003y\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\0045HZ"
+	.string	"\0051024298HZ"
+	.string	"\00618\004OFF"
+	.string	"\022"
+	.ascii	"*\301A 8\226\246l\374\230\305\300j\2209\310\032l\r\262\006[\203"
+	.ascii	"\254\301\326 k\220\271\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableDebug.158.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\277\002-\024"
+	.string	"&\245\210J\320\224Qc\210\001\363)\001\370O\b\245\177J\340<\351<\332`\336\007\370\303*\236(>\240\036\255\213\227d\356u\364\343:\031\250M\317\354\211\311d\221\335\374\333G\312\366\241\240D\355\341I\220\253\023{\266\021i+\307dH\222dw"
+	.string	"v"
+	.string	"v"
+	.string	"2\267<\007|\013`\350V\215\256\001\337\006\2401S\217L\232[\356\360-\212\214[=:q\267\314\341\333\224\0306\025\311\324\335\222\006\337\np\201S\221N\030|\253\302\002\247&U\270\245\013\276\035\220bW\223\316\017\337\0220a\241*\231\027n\271"
+	.ascii	"\337\026 \261\223)=\035\300\267\254\263\274[z\021;\324\316\331"
+	.ascii	"\324aINN\371\r\267\030n\211\302\267\364'\224\242@\004'\362\""
+	.ascii	"?r$wJp%\b \240\232r2\3500\240\177\232U\237\023\245\203\223\334"
+	.ascii	"\352\217\351\204oQFl\365\207\t\337\326\263\274\246Y\r2an\371"
+	.ascii	"%|k\"DB\r:i\267|\021\276\265gy?l\252\220\t\204o\275\036\266*"
+	.ascii	"t\366\340\333\023%[\035\342\3019l\352\320\371\020\3706\225\024"
+	.ascii	"S\211j\267\374\007|\2532\332U\242{\300\267\253\"[52\003\244l"
+	.ascii	"\3142\032(\313)4\273^v\270\305/E\367\353eB3,\334\265\025\235"
+	.ascii	"L\315\314\315\215M\327\252Mh\325\314\304\334Z\265\234\256\265"
+	.ascii	"b\200\342(\330r\255\033\034.\327ZQ\007Y\277h\373\365J\321\357"
+	.ascii	"|\304K\234\347'\216\342*\276\342-\336\363\027\207q\237\377|\306"
+	.ascii	"\201\036t\241\023\375|\215\333\370\321\221~\3438\256C\301w\234"
+	.ascii	"\307\227\356\343@\036\344L\037\0224\217\344h\263\b\316@\025\235"
+	.ascii	"\351\274\367\327\340RR\317Xl\206\221:\213\031\004?\024\252s\204"
+	.ascii	"\020\346\321\354\"a:\374.\215\221\244\350\nc\227\266\200\233"
+	.ascii	"\034=:\222\341\376D2\246\363\036C\032\250U\350l\207 )\346\007"
+	.ascii	")\252\363\026\303\227\353\322\274?\235E\226\361S\321\025\325"
+	.ascii	"Y|q\345\026P\246\242.\340\267e\036\205\305t\f\266i:/ 0C*z\223"
+	.ascii	"\024\346\034\007\263\304&6<d21Pt\335\265/\246y\312\362\214y\253"
+	.ascii	"\347\223\254\0232\315\352\250\321\227\3653\332\031i1\276\325"
+	.ascii	"\305\273,\223\235\034e\342]S\360$k\213\371(\023m\312\254e.\353"
+	.ascii	"\231g=s\310\332m-\023\302\223u\266\365\254\227\271;k\005\373"
+	.ascii	"\332i\004"
+	.text
+	.section	.gnu.lto_lookupTableSuperExpoYaw.159.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \232\205\004"
+	.string	"$\bV"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\275\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'0\206\b{\270\357Sy\276'4\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.160.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \3615\006"
+	.string	"\264\n\216"
+	.string	""
+	.string	""
+	.string	"W"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\276\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\206\b{\by\276\003\005\001'<\301\002\005\001'G\206\bwu\304'S\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\033\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.161.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \301]\005"
+	.string	"\204\ts"
+	.string	""
+	.string	""
+	.string	"B"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\277\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\370\374Sy\276\002\005\001'6\b}\301'>\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.162.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\277\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\376Sy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005RPYT"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004RPY"
+	.string	"\003RP"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.163.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007U"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\305\024}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'-\206\b{\370\304Ty\276'5\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004FIR"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\004"
+	.string	"U-\366i5\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.164.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\312\002}\273\001.\206\b{\370\324Ty\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTables.165.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\264\002\225\016"
+	.string	"$\026\201\003"
+	.string	""
+	.string	"'"
+	.string	"\005\001\006\035\001\003\005\001\212\001\206\200\200\374\342\303\304u\177}"
+	.ascii	"\005\001?\202\210\200\020{y\274\001w\273\001\005\001\006\025"
+	.ascii	"\001\026\002\230\304\005us\300\001w\277\025\330"
+	.string	"\377\004\177q\303\024\230\377\004\177o\306\023\004\330\376\004mk\312\001w\311\022\005\230\376\004ig\316\001w\315\021\375\004\177e\321\020\026\375\004ca\325\001w\324\017\230\374\004i_\330\016\366\004i]\333\r\020\330\365\004[Y\337\001w\336\f\017\230\365\004WU\343\001w\342\013\b\330\355\004SQ\347\001w\346\n\345\004uO\352\t\344\004\177M\355\230\344\004mK\357\007\337\004\177I\362\006\330\336\004mG\365\005\335\004iE\370\334\004uC\373\003\t\330\327\004A\277\177\377\001w\376\002\327\004u\275\202\002\330\326\004u\273\204\370\002\271\1773\205\0024\203\002\201\002\200\002\375\001\374\001\372\001\371\001\367\001\366\001\364\001\363\001\361\001\360\0015\356\001\354\001\353\001\351\001\350\001\345\001\344\001\341\001\340\001\335\001\334\001\332\001\331\001\327\001\326\001\323\001\322\001\320\001\317\001\314\001\313\001\310\001\307\001\305\001\304\001\302\001\301\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.ascii	"L\250A\214\"x\274\376g0C)\316\003\020\020\246\030\231\017\f\003"
+	.ascii	"P\236\363>\240W8\205\3635\030\256\214\253\221\221\016\311\373"
+	.ascii	"V\220\342\244\343V\364\377}\277#R`\b!\362\275(\347\354\032+\340"
+	.ascii	"*P\366\027\260B\343\333e\023R\375\237\355\376\366\032b\261\304"
+	.ascii	"q\342\017\231R\243\307\"E\225$\343d^\242H]cI\251\256I\230\327"
+	.ascii	"7\325"
+	.text
+	.section	.gnu.lto_valueTable.166.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\367O%\376"
+	.string	"\372p%TT0\212,U\035\213w^y\306"
+	.string	"x \007\204\221\356\356$\2328&,\375\226\255\353{@\311\004\003*\377.;\377}\271kk\267m\202!\332\330\343\365z\335\356\3458\035\207\373\374\223\343\242\323\236SW\326C0\315\221$I\222S\202B\272\261\273$\225%L-@\005a\005H\005&\210\023\306\334\347\240<\271\277\fO\335s\277w'bL\025s_\022\327\231\304ofT\343\334\357\035n\314\233[\022$U*\232\373\275\0379Z\013\276\034\335\333\3306\274\331\225\0175\244\266\263!h9\323\233e\261P\213j\224Y/+\200\0070\261\036\226k\275\331\226\332\344~\357_\037z\220\271k\005\277\216\356\\}k\303\233\315\251!\204@"
+	.ascii	"\321{\314\375*\370`t\007\322\177\344^o\206\227j\361ae\263\027"
+	.ascii	"\"j\212\307\216\fo\266\327\304\375\336;\203\001\024\237l\004"
+	.ascii	";\024\335q\334\270\337\254\217\315\375\236\366\032\005\020\021"
+	.ascii	"\303iF\227\301\363i\306\324\253)\001I]Eg\341\242\267\310\360"
+	.ascii	"iP\251\224\373\275\257\350LF\317\027\346h\001J#J\234\350&\356"
+	.ascii	"O;\246N\356\367Nbg\251\203\350\305`\331\205\356I]\304T*\302\375"
+	.ascii	"\336C@`\304\331w"
+	.string	"\216\t\236%\350\216\324\217r\027\237V\005C-\242X\334\357\247\2300\f(\220\320\363\362\345\334\313\275>\355\n\215\353\302\305\350\371\250TI\240\204\025,Y\3626|Z\026Zv\345\273(`\242\356\216\312\224\274\351\323\266d\250E\224\312N\312\213\251\300\211&sP\236\334\2376\307\345\204\032\235X@\241\004\216\311\271$\307\3724:\224\305\033\337\005)\332\214\270\035\321\360iw\350\207\"h_*\316\210\250\245i\3704\274\236e\bZM[\030\323\227\030\3319\326\363iy\275.\f\314M\032[\021D\213\353\334\332\360iz\235\315\375~\n\251a\364]e,\316\036\347\325\t\344\374\221S}\332^\027\342~?}\234Vc\314ZDM\005\313.\364\311\343\334\301\363i}]\207\373\375\224:u4 \317\\\234OP8n@9\331X2:k\f\200\001/`8\3158e\344R\257v\354'\334\357g\323\031\303\324;"
+	.string	"\f\025+Z\234,r\255W\233\352H\356\367\223\311\0011\316$\022\301\263\004}\2368Mhx\265\023\213\373\035=G\234JF\347\022\335]\204\246\3279?\234!N\020YR\334\357\247\007'\2520c\304l\311\365\311\360\362e/\267\361jsn]f\264e\331\242\205.-\217FY\025+xwcT\214uvRr\032\257\206\367\244\026\317-\272\247''O\346\362~4\251a*\201c\262D\217\307[\372\256\r#nG\362\034\257\266\227\303\375n\026\201\032\222\266\246f4\022Yo\210\221\231\225A\301\030cqlu}y\035O\025\\m\216\037XA\262\252\224\200\350\034yTY\365\270:\217\250\032D\345\210\222\322\221\333\370\265\254\033j\321\364rt\240\303X\003\312\306\\\336\223\004R0\232d8\321M\211\021\200)\025+Z\260\310s\374\332]\224Z4\2410}\227"
+	.ascii	"v\230#\314\022'L\023\271\327\257\345\231l\356w\223D\004x\230"
+	.ascii	"\037\314b\222)\"\227\3725\275\035j\321\fs\277\233!L\020,\005"
+	.ascii	"T`\304\230Gcr\252_\353\353\241\026\315\035\356\3672L\037_\005"
+	.ascii	"U[\270\004\313.t\271\347%\367\361l\306\037j\321dr\2773\320\233"
+	.ascii	"\320\343J\036\226\243\231d\305\252\224rGe\312T\030\273\031\037"
+	.ascii	"%\326\223(P\252\264\314]\225pL\344\342z\236\355J\312\222\232"
+	.ascii	"\037nI\220\364<[\326\222#@\322\326\332\330z\236mkM\355\006\013"
+	.ascii	"\316\f\355lN\254,\013L,\214.\313\375^~\005\001\002,\261\346R"
+	.ascii	"H\260\324\242K\256\255\034\353\331\356\202\250\305r\207\373\375"
+	.ascii	"\fRf\235\3210\020B\325\303\207U\317\263\365\225OU\247\326Q\307"
+	.ascii	"\224T\256\365n\306\234K-\226L\356\3672\252o=\331\270QB\361\274"
+	.ascii	"\033T\371\301\375^\326@\337\345js\232!#\367z\267\243\005\324"
+	.ascii	"\342\347\271\337\313&\030Fe\214<\310[\331\361!t\275\225L\301"
+	.ascii	"r\005]\266(Ydx\267)\f\250\305\217s\277\233\245\212\022\205Q\231"
+	.ascii	"b\004[\252H\264=\004\257R\251\034Q\226(Ihx\267\252\f\250\305"
+	.ascii	"\037\342~/\227\324w\277J\244\022DY,C\364\274\333U\227\373\275"
+	.ascii	"\374\340\201\322\303\007^U\006\354K\237\2300\033\336-K\003j\361"
+	.ascii	"\217`\370\336\346\33508\275.\\x\336mk\003j\361_\270\337\177\213"
+	.ascii	"\226\275\207 F\005\370U\346\267\202\345J\317\273\315=\t\367\373"
+	.ascii	"\343\021 \347\3351-\272\340\327\321o'\205\303\313\315q@-\032"
+	.ascii	"\271\337o\242@\201\311\336\200\0177\177\\\360\345\350w\322\244"
+	.ascii	"\347\345\356\270\234:\240\026k\367\273\r\023\017,\371\300\253"
+	.ascii	"\326<\214~\307)\313\332\216 q\213\277I\037\007\367\373\033)\322"
+	.ascii	"\2014+\003\276\331\374C\202O\204~\265\264\370\235\030\271\234"
+	.ascii	"d\265X\301\375\376h]F\177&\202\363\350\317^\007\375\376Z\300"
+	.ascii	"\337\232\377+\370`\364\213\325!`@\330\335M\257=\276\250\276\243"
+	.ascii	"\243\342/}\017R\213\245\373\235|\001\240\337\337k\250H}.\243"
+	.ascii	"\357\022Ans\224\344\001\303w2}\b\350w\363\213\371.\372\235\224"
+	.ascii	"\351@\222\027\bA\023\372\030\310\2650A, E\360\301h\226\211U\221"
+	.ascii	"\217\260\300\310\340\313\375\316\242\030*R\331\021%X\022\271"
+	.ascii	"\013\013\216\f\216\356wv\211\001l\b\021\305\\\312\202\251&\367"
+	.ascii	";\013\242\001+\326\274\216a\221\330\243\\\312\202*\006&\304\254"
+	.ascii	"}Fk\230~\345f\210\003\332\274|Y\367r/\n\306\0340]\036\220e\213"
+	.ascii	"\226\234\212\002\224\024\367\373\232\307'\202\334&B\025++\036"
+	.ascii	"\007\n\307\034$T\246\364\t\350\244\324\345.(L\345pE\221@\325"
+	.ascii	"d\316INE!\347(\267s|[\227\254p\033(\\\345\250p\277\257J `\304"
+	.ascii	"\355\210\006\nY9GE(8\316k\332\332\252\2267Q\330\302\231Bd\b\032"
+	.ascii	"\0012\263\262\\\213\002\036\223\261\n\274V\260\365+\327\242\220"
+	.ascii	"\207\243\3265a\305\n\242\265\n\311\245(\350\341|\271\337\327"
+	.ascii	"\254\007\026X]\255>4T\200\302\341\321\203\302\333\324\312c\335"
+	.ascii	"\221\241\302\021'\206\373}\225Zu\334T\270\221\003\007O\205)\234"
+	.ascii	"%\367\373\nUfI\340i^i\004_\216^\237VcNU\241\352\206\213\373}"
+	.ascii	"\2351\2017\030M1x*l\325\275pa\364]\337\202\002\353\211yU\261"
+	.ascii	"\202\211\247\302\034\022\367\373\232bEa\364|)\b\267\002mK$\326"
+	.ascii	"\021<\025\360n\310\334\357\253R\331\274\256\3055D\206\ny7=\334"
+	.ascii	"\357\353\207\013b\202\335\216^\217\306\344^\025\364nf\270\337"
+	.ascii	"\3250J\027P\355\361}\331Pa\357&\311\375\256z\301\360\244EoK>"
+	.ascii	"\242B_\t\265hS\305\375\256fQ\363\312\251\257\262Y\255b\005/\203"
+	.ascii	"\005\243\215\022*\352\024\235\207\301\350\244\250u\032,L\331"
+	.ascii	"\220E\t\243j2\247:\311\275,T\331X\311\211\275\315\352[\260\\"
+	.ascii	"A\253K\3408X\270\262yr\277\253JT$Fj\222\264\362NkV\333\214\250"
+	.ascii	"Er)\013t6+\330\326V\262\327A\013v;Z%\242\016\311\265,\350\331"
+	.ascii	"\024\335\357\352\231jfl\013\033\023\313\233,\354a\0013+\333\352"
+	.ascii	"\342\312\233,\364\325\274"
+	.string	"i\235\001\311\302\312O\\0\246P\2135\\\356w\365G\252ed\202 \321\252\254zp\270"
+	.string	"U3\345~W\251\206(\351\230\222\272/\034eD\035S\"T6n@\335\027\246jL\270\337\325\032\352\223\232\346\244\316Pe\344>.T\321\350\271\337\325&5\254\026/\\p\270p\025\305\375\256\262XC\021|9ZU\241\246\340p!\213\346\004\233\2715\253K$\324\021\031.\320t\271\337U\245\2456\325\303\254\202\b>\030\255\026\325\020=\027\356h\254\334\357\352\007\017E\302\214\021\223K]\320\273\321g\204\313\234z\371\262\227k]\330\243q\321\245<:\322\226\247%K.u\001\024\315\022\0267\2739\245\022,W\320)^\225\\\353\202\343L\237\373=\235\222\336}8z\bH\200\314)\024\272(9\325\005z3vO\222\3045\221\343\200\3018\223\204\211\222\177K\362\246D\003\006\250\2311$oTmF\212\364`8\316d\271\337S64\270\364lN\207\244\021\331\200aj\246\006\032"
+	.ascii	"\226\264\211\221\215e\300\2605c\"\f\215\t\227W\027"
+	.string	"\017\2069\0311\356\367t+\025b\224j\231Z\342\220~\004\273\035\235b\001\321\200\201N\006\317\375\236^\245>P\310a\361\b~\035\235VQ\345^\030\356d\340\334\357\351\016\262\311\2269=\006\037\214NuD\345>0\340\311x\345Ho\030\2458N\034'\306\032O\271\r\f}@h\304pj2F\301\260z\362\266\242\005\013(\243\373=e\"\241\244&R\024\351\211\243\f\223\373=-\021%i)U\312m\374\330\224\314\222\373=\025\261DG\225zHA\244\037\252d\216\334\357)R\335\261OL\230\236\037\273j\365\300,I\351\262\347%\227\372\261\254\326\216\213]\236\0264K\216\365c[m\234\373\035\305bu7%\210R\241Q<\264J\316\364cs\255\021\367\273z7\005iF\241\004\321(4ZG\307\363cta\356w\026}\242D\345-\256\t*\247\341\307\362\332*&(\234\021\272\004\002b\240TA\213"
+	.ascii	"K)3z\004\211[\336\364cz-\f\367;j\344\\\232\303K[S\343y2c\253"
+	.ascii	"D\204\264Rvfv?\031\024\313\347~G\311\310+_a(\030\317\223\035"
+	.ascii	"Y/,mB\266\264z\236l\252I\220\274\253`\267\243Q \350\217\236'"
+	.ascii	"\253b\215\270\337Q\037\250\325Q\026\223\307\214\356\240By\344"
+	.ascii	"ROv\305\222\271\337\321)TJ\013\016\364\210\346\310\275\236l\216"
+	.ascii	"\265r\277\2437P(\243\357\332RF\343\t5fx2:v\306\f\275\3772\243"
+	.ascii	"0\232\320\030y\323\223\335\261\"\334\357\350\013.L,\320\025\271"
+	.ascii	"\326\223\365\255_T\2440\273P\241$L\224\270\277\314H\305\375\216"
+	.ascii	"\216@\227N/Jh\b\021h\221\303\227A\255p\356w\024D\217\232\373"
+	.ascii	"\230\340\313\321(\022zt\177\331q\210\030\362\313\0270|\367\227"
+	.ascii	"mi\355}\027\037\325\026.z\033\276ln\275\241\005\314\223\025,"
+	.ascii	"W\356/\243k\341~\357x}R\202\335\216\356S\356\356/\273[E\270\337"
+	.ascii	"\313\272/\361\246_\334\256\211E\260\220x\317?\t\310X\302\r\034"
+	.ascii	"\3168.\337;\361\317\316p\206\351\235\330\276w$@ k\242l\357\340"
+	.ascii	"um\357\264\344\260\236o[\026\032\316\357O\026\322\220?\366d\277"
+	.ascii	"\366l\237\344\225\374\334?\371\273\237\362y\237\345\275\374\336"
+	.ascii	"\217)\217J\021eRi\242<Q\272(_\2244Jc\211\243\314Q\356(y\224W"
+	.ascii	"\345\217\262\253\364*\307J\262rHI\244,R\032)\225\224oe\223\322"
+	.ascii	"IIW\326\225UJ\2742K\251\245\374R\362\231H\246\007S\311\\2Q\230"
+	.ascii	")L\027\346\013s\206I\303\274a\3420\247\314\035\246\017\363\312"
+	.ascii	"\024bj\231`f\230yf\242\231lf\233\211\304Lb\306\231r&\0243\212"
+	.ascii	"ygN1\257\230XL=\223\213\311g\2029\217N\244\263x\2128Q\234)N\027"
+	.ascii	"\347\213\223\306i<s\234\307\223\352\254:\261\316\254\263\353"
+	.ascii	"\364:\313N\263s\355d;\221\234I\316\270S\356\214r\322\235UN\274"
+	.ascii	"S\313\271\345\344;\301t\017\375CW\352K\035EO\321_t\030\235F7"
+	.ascii	"\366\034\375\330\251zU\307\352Y\275\253{\365\261N\326\211\364"
+	.ascii	"\264^\244\033\351J\372[\227\353Mz\224N\327\251\364*=\257g\351"
+	.ascii	"]\272\227\336\327\303\240\036\320\017h\022\252\204\236@Q\240"
+	.ascii	"-P\027\250\023*\003\255\201\332@\243P\035h\025\332\003\305B\263"
+	.ascii	"P.\264\013\025C\307P4t\b\312\206\266\241IP%\250\023t\016\225"
+	.ascii	"\202\332\241V\320+\350\026T\017\375\202\362\241c\322\2434DZL"
+	.ascii	"G\244$\322\024\251\212\324E\372\"\225\221\316Hm\244P\251T:\225"
+	.ascii	"\366H\255\322\2544H\372\225\202\245e\251Y\252\226\256\245GR\267"
+	.ascii	"\024.]\222:I\347\322\272TJj%\275\222nI\365R\276\024\214z\244"
+	.ascii	"\"\251\"\324$\265\204jBeRW\2500\324\030*\r\325\250\342Ps\250"
+	.ascii	";T\036\252\017\365J\r\242\nQ\275\324/\225L-S\323T5\365\210\352"
+	.ascii	"\2462Q\343\324'*\024\325N\275S\257\250XT.j\027\025\214\332\267"
+	.ascii	"\"\255\036V\021k\322Zb5\261\262X[\254N\253\214\265\306jc=\256"
+	.ascii	"Q+\325Z\265\376X\201\254[+\327\032\266\212\255g+\332\312\266"
+	.ascii	"\266\255H\326$+\2235n}\262BY\355\326\273\365\312\212e\325[\271"
+	.ascii	"\254|+\030\326\003\373\201Mb\225X\023\354\tv\005\313\202\215"
+	.ascii	"\3016\261Ol\r\366\310F\261<X*\366\007\013\204\335b\271\3300V"
+	.ascii	"\214=c\321\3305\226\215uc\221\260KX&,\0246\n{\307Na\257\260X"
+	.ascii	"X=\226\013\313\307\202i\221Z\017\255R\273\324\236hQ\264,\332"
+	.ascii	"\026mS\353\324\326hm\264Q\255\216\266Gk\325b\265Y-W\333\325\216"
+	.ascii	"\265d\355\220\226H\333\326\026i\223X\3202i\343\332'-\224\326"
+	.ascii	"\256\275k\255\264W\332-\255^\373\245\345\2239\232 \023\242\202"
+	.ascii	"\\i\002gm@Sl\226\361\020|9Z\006\204\314\207\236\bt\017\260\270"
+	.ascii	"\337e\220\236\302\214\021\2233E\270{P\327\007\206-\217]\366\274"
+	.ascii	"p\210\200\347\306\245\3144\225\344ii\263\344^\021\362\036\200"
+	.ascii	"\271\337[,\247\022\025\274*\034\"\350=\250r\277\267S\350\244"
+	.ascii	"\324\361D\330{`\214\2026\231s\222!B\337\003\022r\351\333\022"
+	.ascii	"8\236\t\214}\356\367VIg\002r\004\211[\206\t\034\334\271\337["
+	.ascii	"#bs\253\026|0\272e[\3430A\226\003%\356\3676\315\f\355,\307\222"
+	.ascii	"p\225V\006&\026\226kI\310r\320~\265^2\355V\253\325#a\313\201"
+	.ascii	"\225\373\275\r2\003w\005\244\375\301#a\316A\r\037\255\324\334"
+	.ascii	"\362\250j\251n\tt\016\230\334\357\355\216v\312\r\0015T8\2169"
+	.ascii	"r,\tz\016\222n@\2256J4\236Zc\256%a\257\001\237\373\275\235\321"
+	.ascii	"\312\240\271y\021\243\205\301AB_\203)\356\367\326\005\216\212"
+	.ascii	"\025L9\326\216\261I\212\034$\022&J\344X;PGF\234Os[\f\226+\350"
+	.ascii	"6\251\025\221c\355\034\033\234\271\337\333\020\355\007\243\026"
+	.ascii	"\304\321\321\2301:mb\202/G\267Gc\356\235\255 a\372f\032\224y"
+	.ascii	"\371\262w\357\3145\320\341~g\273\240K\214\276\313A\026v\013\253"
+	.ascii	"\205g\207\256A\214\274\007TU\254\340\345R;w%\250@\350*f\266\316"
+	.ascii	"NJ.\265\203\327\340\310\375\316\322)\001\300\311\223\271\234"
+	.ascii	"\306N\237"
+	.string	"\316\236\373\235m\302\306\031\261rU3P\022\244gJ\340\336r\254\tF+I\212\0341\222cM\200\202\342~g\333\210\004\237\b\315\252\245\345Z\023\216n\356wv\310"
+	.string	"\310X3\266\254g\302\224\316\231\373\235\035#\200W\360\353h\026\354+\227\232P\245\243\345~g\273\n\020DKH\2165\341J\247*\013\013\307"
+	.string	"U\254\202/G\263W\254\217\\kB\226N\r\367;\333\203\255\3129\200\324\016v\352\236\260\245\303\244\203\017\001\254\215\0339X\034\034&\314\351xp\277\263P\006x\027\375\236\200\031F\226\206\206\tt\f\362d\260N4\np\301\302`_\344^\001dm\027\001[\362\207\270\306\303\242\033\307\206\002\n:"
+	.string	"E \247\266k\332\206\214c8\216\341\031\262\003\320\373Cl\351\331\306_ L\003az\206\034\3263\016\017ga,\377^ L\333\220DE\035\336\332\226;"
+	.string	"a\232%e\033\036\372\3310\320[\333\035\346\373\365\201q\032\362\207(|\345{\256\2075\244P\026\372\211\337\332\206}d\310\330~\1773\235\262d0\226\201Xr\246%\361\371\276m\031\222%\201\342\031\242-\343\303\371\215m\032\362\226e\033(\377^\242\231~\205\210?6\344-\224\207DA\360K\004\3237$\016\211\313\267l\377\206\263\317\213\303\367K\007\331xP&\336\001\220\1775m\317\260\203\341\034\313w\320K\004\323/\221-C\322AC\034\031\207\345x\026\222\1776$~\313\370;\254\035\220q\f\277?\273\216e\233\301-\333D\272\216unHY8\377\3246\361%\252}\2021,\364i0C\004\3233\344o\b\323t-C\322C\304\367'\307\303\242{\030\364\312w\320\r)\254\343\032\257mbN\r\003R\016\022\302B\266]\307\257\r\204\327\324\374\374\324:C\265\360\r"
+	.string	")\333A?\371\007\276\2053\374\223sC\342\330p\355\363\016\201\263\020\266\021\302>\364\f\224!\213\3609\206\211p\374\342\260\317\f\021<\234\351\006\300\341<\264\341!"
+	.string	"\220\367|\313\266\214\337E@6\370P\266\355\240\230\206\264e\\\246\337\"[\306q\330\207\206\224\2010.\254\205^\241P\216_<\226q\371\007A\350~\345;\310\206\304\207rl\313\304\027\267e!\034\347\2640,\013\341\370\226!q\371\376\371\251_!\034\366\231o\273\306k\372\035\202\213\030\220C\265\320\206\004\002\316@7\244\020\266\361 y\370\376*h+\320!\345[\030D|m\031\037\312q\016=D\254!;"
+	.string	"\2757d-d\313\367;\3338\016\211\3330~\277\300\341\374\263\341!\273\376y\205\362p\b\003\305\020H\031\207m5\266e\310\337L\2776\020\256\2225\221H~m |\025\nk\273\225\271\337!\270\210%a\"\276\222AX\266}^\230\210\327\220\266\214\307\260]\327>\262}Cv"
+	.string	"ze\034\376\021\203^!<\333\362\335\240\210(\216\341\232\016B8\376\311\264\r\017\203\3368\206kH\342\034|\351\370\367\006\321\263P\b\323\267\fY\004\013\345\037\216P8\007_\332\206\357\371\227C\3226\374\342\267=\377\274\303\372\025\302\361[\333E\300\006\244-\377f\241\332\236\271a\237{\376\031\326\261\r\371\013\202}\336\032\017\202\357\240\371\007\333/q\350\275\211@\032\0228\234\177\260\f\364\336:\344p&\202\351\367'\313\304!Yx\277B\360\220\006\027\302/p8\017\375d\242\371G\002\034R\006\016a\240\370\305o\370\347\375\tk\240\027\027\302:+\371\033\302>?X\376\275Cp\321\f\371\223o[\026\222\355WX\333\370\260\216\337!\270H\207\244\353\241\374{\357[\216k\233\370\376f\"\016)\023\213\3607\207\206\354"
+	.ascii	"TC\376\374\324xP\374\002\305x=\314\371\315\304\027\207}\204h"
+	.ascii	"HY\210\343\265\r\204\277\303\231~q\370\375\315D\006\016\310\341"
+	.ascii	"\f\003\337\"|\026\202m\340;\343C\030\207\254g\034\266_\"X(\333"
+	.ascii	":$\016\004\234\345\241\027\037\3165\021\227\357_\003\0322\216"
+	.ascii	"a\366\367\023\326@\267l\003\341\300\033R\246g\274%e!p\b\353\220"
+	.ascii	"2\016\333/\003\262\310\226\205\352X\266_\240\033\266\343\032"
+	.ascii	"\222\030\364\033\316C/m\313\370<C\3367L\034\252\205\357\020\\"
+	.ascii	"$C\316\320A\367o&\336\020g\225\370\376T\342\234\222Bam\277\277"
+	.ascii	"\2248\243\344\020\\\364\376\2103J\342B\370\375\241\304Y%\337"
+	.ascii	"\237J\234QR(\013\275?\224,\302g\241\031\237\357\241|\343\220"
+	.ascii	"\370L\317\302W(\013\311B\031\022\217\345\237\037\006\270-\023"
+	.ascii	"\211\344\027\027\316\370;\254;\314v\r\004\201$\276wM\274k\342"
+	.ascii	"]\023\211\363\357\265\357\232\330\222\304\371"
+	.string	"\367\n\301\303\367&\002Y\022(\306\347\241\373\245\205xK\376d\234\026\3423$\221,$\006\375~\2040\320K\013\361\032\022\207qH\340\260\026\276\2700\b\376\221\1779$\016\323v\375\363\336D\340\r\211\317\303\240\226\034\326\363=\307\262M|o\370G\350-\n\336\366\217\016\211\017\347\227\266a!\374\342x\rTC\322B\374\035\316\357o&\266\344\035\317\370=\3430~\277\301\033\306mH\371W\323/0\310G\376\265\302:\306\357 \020\374\340w\250\266\003\206\330\250\263\341\247)\020\211\22134\"\"\222$IZ\003\343\030T$\004\3268\222[{\023@\206\220\250a\220dW\004\227\004\221\246\300\003\352(\316\246l\223\305'\272e\230\220$m\034\254u#\321\211\257C\036\b*\371\001\221\\PE\307T\017\004\325\241\343Q\211$\341\376T>\263\3514\2158\274\303\350\337\321A\030\215\347\216\256\371<[\240\250\300\026"
+	.ascii	"\036\341o\350\303\n\026o\256\235l\270\262\231\363%\f'\261'\021"
+	.ascii	"\031J\376\021\375!\242:\2024\0348\345\016S\nZ\002\bo\033E\006"
+	.ascii	"\310\216\237\212\374\370\020\354\377\315 \334i|\314\350\345o"
+	.ascii	"HNE5K\252\003Q\313?t\375)S$h\314\300\314\\o\342\343<\371a\210"
+	.ascii	"\236\021\033\314r*\035-\223b\362y2\200\036:p\272u\305,\314\267"
+	.ascii	"\224\005{\274\321\324O\366e/1i\243\037\006\216\206\215\324\""
+	.ascii	"0\315U\007\036\241\257\374{[6\025\367\324\336\230@\211\367^\272"
+	.ascii	"7\021\200(\t\t\t\336\224t\277\"s\337\300\023/\b\n~.9\265\\|\363"
+	.ascii	"\227m\177\314\036Y\0212\033)\001[\331\037\361\344\f\035\211\273"
+	.ascii	"|\271\375P\263p`\224\236\002C\361\205o\235\241$\230\374\306i"
+	.ascii	"\223+sK\311?\317!J\331\313cm\f\\\332e\375\377\013\020\301\341"
+	.ascii	";6\235f\016\017\201\223\342\017\177zH\226nP\202Flo\224\322\206"
+	.ascii	"b\231\324I\273\007\007\361\274Tg\222-\n\230\202\321\275\320\026"
+	.ascii	"D[\224\214\206W\341\261\377\331\202\375\336>8\373\202\211\211"
+	.ascii	"N\271\267\004\216\025j\303\202&qX\271\312\251\267k\026\221B\236"
+	.ascii	"):|\025\2435'1\351p\221\355\231\031^\346s\303\327\363\240\240"
+	.ascii	"@W\020\006\324\246N\243\016\212\3007\373\227\311\232ay=#,\366"
+	.ascii	"\004\b\271\312\2004aZ\277\230\242&\240\037Jn}\234?\236\200\362"
+	.ascii	"\257\257\235Y\273\217w\025\334\232\342\362di\344\nKD%\024\361"
+	.ascii	"8\367\257#\320\205\\{7e\242\343\362\032\021\352\360\333\306T"
+	.ascii	"\350\257\037a\340\371u\372\375\244\237\3559\257\2703\251\320"
+	.ascii	"\316\"\265G\013\350\024\304}\030@&\3748\334.\326\261\237#%I\260"
+	.ascii	"\344K\367|\346k\\\370PV\200\035;"
+	.string	"\230\201FD\212\323\336a[bj\177\r}\360\271H:\334c\221L\024\364\312;%`\036Vr\211z\363\021\262(;\261\306\363D'\332\251w\320\341\3334\272\227D\025k\020lxk\002\244@\255=\032\277D\243\250\200u\367ZR\002\260\036*\025\247\337\263\201J\266\253\020%\226\216\360\027W)\0164\370I\306\233E\250\225#:\221\331\004G\267\002\211O\215-B\301\247Be\227neH\336\315G$\323\375\235\032H\247Mbn\313H\017\203\222<\342\247"
+	.ascii	"`\255|\343\004!\334\232\331\273L\0174mp'\b-oY\027\336\n\376\254"
+	.ascii	"N\213\237\235\367\315\342\207\201M\037;#Up\351b\210\013sA\"i"
+	.ascii	"\300\206\245']\340\036\b\207W\2447aX\224\252\200\255\200\354"
+	.ascii	"\372T\202T\223\266\005;n\211\335E\350:\002\215\013\203[\225\030"
+	.ascii	"\251\023\300\230\205\3030\272N\220\310R8\322a\017.\257\221j\266"
+	.ascii	"\205\246\273\307\215\216\314\371\311\247G\373\201F\360&\003\344"
+	.ascii	"%\027i99\032\303Km\357\377\253\246V\221\3412\303?\370W\255\030"
+	.ascii	"\022\353h\260\324\311B\336{jf_\263Pqe\022\271Kf\020o\260\005"
+	.ascii	"8\265\336l\nt\263i=\234[\245S\213a6\275\371\230\376\213H\351"
+	.ascii	"]\n?R\244\356\310_\233\353\315\271\324Q\334\332\244\306e6\337"
+	.ascii	"\337\300\276C\227\361Bk\372y\013I\b\360\361\254G\242\265@\245"
+	.ascii	"S%\364Wyv\332Z\322I+\334\030\016\002KZ\223j\244\226eWZt\224\320"
+	.ascii	"\321\0131\342\016\016X\032QDP\200n\254\021\206[\322\275\310\262"
+	.ascii	"\254\330s\207{Y\223 -\216%m\223\002\245\264\265\343\353\0334"
+	.ascii	"\352\275\263\257*<\344\204\335\017Q\022\3607\211\275"
+	.string	"k\362\\\304R2M8\366\255d\357\331SM\322\207\345\b1\244d\027vj\376\220\0162\365\202`?p&\036\2114\373=\030Z\234\037\210\214]+\225.\321\035\226\303HN\206@Z~E\002\377\222\033\233Y\b\215\332\305\370^\001\206\275\006\023q\353\333\321R\217\304F\205T\341\215{\235SZ\340!\232\222@\325\265\222\b\220N\206u\\!/s\314Y-\202;\276]\024\032L\371\275\376\255\350\030\034\020\324\332\323\245\333A8\022\223!_?\326pa\006O\3703x 9\333q?cY\021Q\025\365\356\260\246\033\365\206\024\311\222\257U\n\325v\220t{\375\310\254?\250r\244{\326\f\367\275\334\375\273MZ=@Q\321\342\341&MT\365%\036\303\247P\030\002\303\317a\244\336\321\001/\341e\001\211\271\367\241\340S,\272\240\377\232\315\216Z\231\255><p\034Q7J\261\263\347\nSvb\217{\270\272"
+	.string	"\016\203\356R\007\207! ;\324D\002\005,\356Paq\032\357`P\221W\377\255a\226\231h*q\213\334\b\230\341\203N\327\221\337\335\377\225&\204\314w=:3_{\006\207LU&\204\317N\2624G\234\275\030\205\225\375\266f\n\377\306k\234\352\214\257\226\264z\343\221\226\344\236\267=-\361\321X.c\331\262\317\366\035\346\177\035G\007:Kl)M\242"
+	.ascii	"K\2234K\310\006U4\233\363\017\333G_*\337\276\306H\244Xc\031\316"
+	.ascii	"\215\032\344\211\334{\234\344=Q\337b\225\023,\232\"\331\217\216"
+	.ascii	"q\2425\r\355\206M\216\225\335?U\004\374\251\n&]\210\n\001\026"
+	.ascii	"\n\212\274:n\026\302\004F\316\203|7CD\200q\021-\006\201\342\340"
+	.ascii	"\247TG\005\007\354\025\237h\023\313\234\233l\031\254Y\264\277"
+	.ascii	"\353\240]\f_\222\227\257A\245Y\346rr\354\207\312vD\026%\320\305"
+	.ascii	"\250\367\374\267\204\355\221a\"\261\332\222\262\342\0276\342"
+	.ascii	"x\302$\354 r\261\016\317\237U81\365\364F\264\270\321\260=\336"
+	.ascii	"\346\221\177\364Y\215\236\305\336\302?B\304\022i\337}\225d\246"
+	.ascii	"\251\363qI5\200\252pzy\272\310L\232,FZ\213\376z\307\226\304\375"
+	.ascii	"\320\270sy\027\272OE,\n6}\253 \212\3720\367\024{|s\342-\222f"
+	.ascii	"Ec\222h\251\260\223\213\036\374_I+\f\300I-\340\020\347\214\341"
+	.ascii	"\217\n@\240\324n(\266b4MS\243\323\240\2464F\366\247bp\360\326"
+	.ascii	"\025\026\324P\237\241\006\177\"\277S\222'7p\233\f_\331\243cL"
+	.ascii	"\201*\022\235W\320\344\205[\251\016J\016\267Y\016l_}\315<a}9"
+	.ascii	"\323b(I\262rCg\034\t6,2\206\247\211,\242$\270S3U\177v\250\237"
+	.ascii	"{\364F\301:\333\177\021\311\370vfi\306$FR\263\362\234\225\311"
+	.ascii	"\245]\224\231\302A\232\325\241\260\267\n}\332e\313\302\244\366"
+	.ascii	"$#j\025\026\235\t\221\227x\201\306d\001\031\216\260\013\221<"
+	.ascii	"-\201\036\353\235B-odar$7\231w`\316\254\005\305%e\236\346\016"
+	.ascii	"\020\0319W\257F\310*z\b\253\213\221*\255\373<\350\305\007\237"
+	.ascii	"\037J}\033\027%\257\0033\003\333\200\032a\324 \347\0315\332-"
+	.ascii	"\260\274{\317"
+	.string	"e>ao\002,:\241\216\350:\344Idc\270'\323\020\261\316 \250>\033b\301\234\243\247\242Q\246#\362k\"\244\333\345Ur3\003U\345\354\223\025\316\016!:O\317w@vC'\375d\276\324\nv\367\302P\311\222\206\342\342\236\216\377\365\334?O\t\335\255\254\243Kmc3\t\237\002\r\250\247I&\275\215\006\325q{\240\236`\364\216\033^Y$\027,x`n\244\210\304\016\024\031\315\351\237\355y\273\"\346\210v\310e\013\357w\2647C\035\310\007B<\001\230\0279\\0\356\277\322\251\357\030\006\013-S\300\200\266\fD\343>4\021\222\005H\200\201\204eT;-\341\302i\316\n\360\243\360\243\346\240\353\255\372P\210\007&\023J\203\232\246**3_\0272\314\3414\233\233;Zn\263Gn\177\0332\023\306\250\310\211\035,\030\r\266\032\003\354p\253\316s\260\024\361\307\223#\307t\354q\350\fh\364"
+	.ascii	"\322\320Lv\235\203\005U\013\303\272\320\264\\9\213C\261\023\365"
+	.ascii	"ay\267\333M\233\306B\220\307J,\353\246\314\3164y\366\020\327"
+	.ascii	"C\033\331\256\310n\272\276R)\212i,\372\226\323\327\360\005\360"
+	.ascii	"\020]a\215R\331\215/~\243\246\001=\026\310\331@\265\237\016\020"
+	.ascii	"\226my|\265\033\325\260\254\365\226M\233\207\021>\025\3224\230"
+	.ascii	"\341b\233'zl\315\217\215B\034\200\264~\203\324D\013v^\354#\253"
+	.ascii	"\220\252A\251\374\260j\230\001\255\373\330\354g\n\274o{\364\024"
+	.ascii	"DL\321\177\316\275\221\006\223\222\315H?\343\256\340\b!\005z"
+	.ascii	"\035*\246\350G2\206\322\016~\317 \274W\032F\263\023P/\245eK\236"
+	.ascii	"\230\025N]gEgviv1\261\231\224O\374h\031j\"!\373\\no\356+a0\t"
+	.ascii	"\037\033 \022$\017\333\355)\214\301&<t6\337#\263\260\234\330"
+	.ascii	"\214\224gzd\301\3302M\240\005\273\035f`\370\312M\0261\017\250"
+	.ascii	"\355\271\321\2225i\002\260\265\034\254\240\023\246\002\301+\333"
+	.ascii	"\r\340XBC5/.\376S\207\314\252\022<\361\217\233\"W\215\227\246"
+	.ascii	"\247\325\020\310D\326\213|\023\322\216\017\370:\325[\351M\372"
+	.ascii	"\314j0\276\260iK\260\331\355\3020^\247\016v\304\350HT\332\323"
+	.ascii	"\242\336\374*\331k\214F|\237\313iv\032\352\233\272Nvq\365:\206"
+	.ascii	"\272\r\215\n\262\361??\227\303\267,\236\305\316\030\344\276\334"
+	.ascii	"\005\314+,`V\264\365z\213\rOm\350I\034_\351\337\240\023\217\b"
+	.ascii	"\205"
+	.string	"Sx\nmwe<\261\211J\306\005*\2334\333Zt\301eB\270 :\234\203v\261u>Q%\353\312Ysy\002\206\024\230\357\334\366\207\001\225\266>\314iJ\340cX\234!\336c\321\207\264+\373Y -q\305v3<#\013\351B\371\310\022\036\264\302\242\255\342\272\214\325<\227\246}L07`\241\304\260\221\224*l\240\016\204J\036\255t{\243\217\034a\335LM\312\367\001\2115'k\177"
+	.ascii	"#\330\336\\\324^\212\016r=6\344\230\243\362"
+	.text
+	.section	.gnu.lto_sortValueTableIndex.170.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\346\003U\033"
+	.string	"\2462\260H\240\230Q:\020\350\234un|\342G0\310\214\345\336J\251\375\245\300\205\013\312.i\232x\354\205\334/:/\343\226\271\030\362K\234\225?\341RL\031\336\341\351yP\001\013\340[\"\277\026\266V\300j \373\266O\310\226;\245\236"
+	.string	"\220"
+	.string	"\237"
+	.string	"32h\212\034J\350?\332k\213z\025NO\275\254Z\201\016N\232\366:\271\340\005\312\223\364\003\312\223\227\t\331^\f\030\325!\tOL\271#bj\255\265\305a))\352\023O\201\267k\205\376\202\271J\222\356\024\362\207\274\301R\025\341\226\251\335\320_/\027\207Q\ra\260\274\210\364\202\336\360\320\3218\360\f~ \301\230.\245\227\262\035\321$\351\006\207V"
+	.ascii	"v)\250\205\"A|\027~\036\355\214&\365\341\342{\340i\226\240\020"
+	.ascii	"m\231\332)}\272pj\255\236\272]\213;v\333T\266q\354%\006 .eS\320"
+	.ascii	"\253\265R\360\221|X\302w:\351\233\211y\335I\337\304\021\235\021"
+	.ascii	"7\217\276\3603,\243Uq\2113\232\242\354\362h\345\177\317\251\201"
+	.ascii	"\233c|\340)\020\033s\230T\265\214u\216\261\201Csy\366\215\004"
+	.ascii	"\313\311\333d\317\036\374\335\260\235~\321"
+	.string	"i\327\247K:M\3564\235\323\373\351\371\340}\001@F\026+v'\036keq$S\257\220Nz<\370\377>\355\317\360h|#\276\320\262\231\033\301\336\223\357\346ur&\006\215O\304\007Zv2\016\356\332\013\021Z)\232[\236\315\271\345\332\035t\346u\256\275\3250\332\241*\236\017\203\016\245\247\326{R\356\207>(\272\344>W\006\347\023\247\262\275\232\320\275\3619\tp<\036\217\247\225\261\3355\260$\005\023\321<\332\336\371\022\236_\365j-\262\261-\342Jzn\205Uk\021\205\251'\361\241!~\312\237\362\344\334\022\314R\325\023\024n\036\237\245K\220H.\317\001rILv\267@.\211\t\006\333\330\036E=\266\030\270\024\315-\001Y\306\252\330\342\340h\255\265\322\335\007\177\001\3138\245H\327v n\235\0076\020*|\360\020\241\206\200\317\275Ss\353\031\341\023\024\304s\253\355|\250\215\360\321\371\251\355"
+	.string	"\335j5\007l#\301\003T\013\262\331\200j2`\3756ePB\322\312\302-\221\377\234\322\277\272\225\034\337\311\0338\314\3538\224'\023`\201\301\r\371{\306/\305\035\257\345\3719`\333\344\b[\345lI!\363Q\207\021\265l\300\346\034\363\t>\241\225\213\214\255)}\324\277G\366l\377\373\202\323J\330\316\366\023\206\030#\325\013\305\247\330\020\364\244\\g\204\355kWK\256\214\224\361j\332\024\251\350(\227\347I\250A(\345\224r\204\221H$\030\nH$.\006\200\002\031\242:\017\020P\212T\222t\t\247\302\244TLD\233Xn\026\321\021R\204@\001\334\252\034e\253m\354\221\254[\2323\350Ip\315U\212\377"
+	.string	""
+	.ascii	"\"&\233\030\306\317\024\bp,I\355\231T`=\231\016\364M\013\201"
+	.ascii	"3\377\374D\374XS:\374\253\311\205\310# \023\367\024\361\326\301"
+	.ascii	"(t\303qAl+Y\260oK\021\205\3160*\021\022\231\264\370xJU\235\210"
+	.ascii	"\267\250\340\271\316\377b\277\0214u\275\033D\035\344{\326`\366"
+	.ascii	"*\257+\013/\222\004\331/H\375"
+	.text
+	.section	.gnu.lto_compareSettingName.171.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\276\001]\021"
+	.string	"f\342xG\340\360&\035\212\336\244\317<\n\260Y\212\353aM9\240b~\343\370\224\276\302i\343{\235\027\241\347\320\274i\312\315\022\254^\234v\236\353\264\006\036 \212-p\232ki!LsA\236\371\243\233\005\274G\344\023\262\245L)d"
+	.string	"b"
+	.string	"b"
+	.string	"-\206vs*\213\200\367\234\003m\373)\256\202f\0279\200\251\205$:;\267\025M\273\313\n\371\307w/^\300wOG\234v/j\322\374\216\320\345\236\207\307x\234\030:\217\320\026\031\030\325\354\244B\230\324x\340\306\250\306#|\211\037H8I\017z\316\2040\231\034%\273\353\224\ti\356\357\266%\330\236`g\f\340s?\307}~/\323\321K\353\323\031\323\357\3608\301!\274\020\215\335\016\273\247=\362\210L\034\350\267i~\220S\006l*\033\210\345K\263\327\360\244\323#cwG\3569\002\b\322\364\323B"
+	.string	"\300\332t6\017\222T\231\367q\221Q\273\"\224\206vW\345\006\340=\220#\325\323>\317{h\317\265<\300..\027\312"
+	.string	"\003w\367%\374\226\357\236\352g@\244\246\215\030\024/\271\263\b\323\207d1\003)\204\262|(\245\240\203a\313\032\026a\nQz\240\207\324\322\311`^A\345P\033\203,/\203\322\220\030u\261\247\327T\272\335\250\345\316\017\372I,\355\\l:\3319\227\324\034\373\272\333\355vV\234}\240\033\365\237?*0\227\276`-\b)\013\263\223\330\353\302\347\026\211\002\004\013L*$X\rx\301Z\261h\327Jv\022C\231\315^2\226\313\204\025Ci\301X\256\025\031kU\300)*\257\025\326,%e\205\225\312\355\343*\316\251#_\335lx\342\35257\233\233Di\324\031\333Q]R\323\227\270\273\353iN~H\033\210\242\342|\330\247\232K\272\027\016\033"
+	.string	"~\346@\232\325\020\332\373\241)\3117\3063}\300\342 G\024\321k\004\260\204\360\241*\214"
+	.ascii	"\206\326\251\335\252\001\343\302\263\261vF\202.\034B\003\023"
+	.ascii	"\2050bh \305\204\004\320\230$\225\035\204\373\212[\250("
+	.text
+	.section	.gnu.lto_settingFind.172.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\210\005m$"
+	.string	"jC\270\016J\200\224R:\025\300e\213\273Kq\022-\336\310D\305:H+R\243\335\335\274\233\004\350<\327P\340\246\364\332j\330\324.rc\3613M\200T\210gU\246\352.\213\306\314\325T'\2703\003\033\200\331\025\210\337\366\t!\204\354\235d\325"
+	.string	"\313"
+	.string	"\332"
+	.ascii	"j\r\325\260;\254\325\236\233\371(\230t\275\331\345\234o\256\366"
+	.ascii	"\204\232\344\020\337\356;\377C\351@Z\255{9_A9\3139\017\033B{"
+	.ascii	"\325&\245\301\033\336\373/\023\017\346\214\305v\226\263s\330"
+	.ascii	"\006\332\253\357q/\2456b\024'\216W\b\272\2104\005\301\313\331"
+	.ascii	"Il\347a\326\253\355]\326\253XF\373\272\207\215\377\371z-\220"
+	.ascii	"]\325\024_c\177\351\2778\250)\350\211\353\033p\325\224z\357f"
+	.ascii	"\037\020\243\351\342-SS\352\300\307AQ\341\200\212\272\354\017"
+	.ascii	"i6\3475\345\2529\3655mP\204\305\023\013\263)\2755\350\242\334"
+	.ascii	"\354w\311d\272\352u\361T\305qz\300\016M\312\217\231La\236\270"
+	.ascii	"\224\207\376:1\221\367\262\017r\316}\225\314\346\033\300\273"
+	.ascii	"[\256\273w\272U\235B\367\312\266A\342\245\276XT\007\260\351\224"
+	.ascii	"\207\221\326\343\017`u\311K\245\373gGC\352o5\021\211{\345\325"
+	.ascii	">\211\365\3521\220.\352x\363\372\320_+\232#.\337*\335\316\245"
+	.ascii	"\213\263\272O@\256K\331\030\253\233fF\346c\357\030\230\003\371"
+	.ascii	"_\376\365\273\234\354-|\331;\330\302\342\353\333\275\207\275"
+	.ascii	"[\366\336^\361mu\275\235\342\333\370\317\367Uo?@\211\250''\346"
+	.ascii	"\313\2409?\345Y\311pj\232\215\217\375d\177\331\037\366?_\243"
+	.ascii	"5\354\213\365\205|\310\315\372W3\243\214\256C\216a7\231\261%"
+	.ascii	"\307\3453\237t\325\331\345\354\314\360c,)\305V\227\023\013\355"
+	.ascii	"\325w+\365\203\034\332\277\032\250g\253\245YLB\227\333\r\n\355"
+	.ascii	"\003RO),\316j\001\320*.U\210a>\027e\0232\325\035\327\2445\006"
+	.ascii	"\027\201\321%/\225\265\030\374\261\231\273\342\027\354\202\273"
+	.ascii	"+\\\270W\306`#+&\274\324\335\030\276D\303\257P\335\341\345\234"
+	.ascii	"\314\211\333p/\252\273\035pWb\\\257\256\330\001\335\327\021!"
+	.ascii	">\331\223\254\216w3\026\230\3139yew\037\275m\003Q+\347\244\016"
+	.ascii	"\333\223pH=\354\254;\353U!\306mJ\026)V\361\233\256\034o^\207"
+	.ascii	"\257\361\2649g\235\376\221#\351\351o]\355\242\217\017v0#\355"
+	.ascii	"(\026U\013\342\227\335\346x\253\364\3058\210o\033\023\017\344"
+	.ascii	"\315\353\026\263\030c|\307\364\002i\3666\232\206\241\300\270"
+	.ascii	"\201\247\342\254\276\367E\316NI\301j\253\017/\357\2759;\325\004"
+	.ascii	"\337\374\342e\247\277\333-\" \200\204p\021)\210\247\204:B\250"
+	.ascii	"\007'\021\005\341\037\037\240\237\364\347\310g\250\030\2646O"
+	.ascii	"\202\034\005\fB\200X\200\363R\024\342\031J\273\007\307\310g\b"
+	.ascii	"\350\350\250hD\354\tA\034\002\342\021\"\366\024\031\021qh\232"
+	.ascii	"hD\261\210xDDTD\3749\3631V\373\244\307\022J\304\367\267WA\253"
+	.ascii	"\270V\030\334\303\313~p\304\310\0370\210\273\307\202[\274l \213"
+	.ascii	";\355\311`6B\222C/tF\321X\374g\213\037\366\233\346\234\263\257"
+	.ascii	"m\361a\026\274T\001\255\272\322\316\340N\323\213e\3602\354F_"
+	.ascii	"p\317\037\372\240X\324\007\334\237\323b\215F\017g}\005\264\352"
+	.ascii	"\005\033\3044x\331)\333\342\226\031\374'\202\323\340\031|\313"
+	.ascii	"\336\2028\254\254Z\234\325?\036\233\213a\004\210\261.\367\030"
+	.ascii	"|.0\267\353\214\266\261\005g\250A,\244\030D\204 F\302\231\332"
+	.ascii	"\022\035`\002\231\271\263:\020pIS\035\244}\321UU\207\210\211"
+	.ascii	"(MJd-\355\313\223$\033/ ZL\203(\244\220\005\024\326\032\0222"
+	.ascii	"\230\335\272\003\346\210\371\221\266\032\300\005\216N\304\245"
+	.ascii	"\260\005\016T\342o\331\343\354\n\026\3277\205\272\361H\235\365"
+	.ascii	":\265\026A\013\247\0058j\030\203\027Y\3333\003\257\266w[\344"
+	.ascii	"O\024\242\b\367\250V3\250\362%\276\317\375\256\267\260\347\362"
+	.ascii	"\315D\246\237\201\226\346\223\252\321Z@\210_\240\\!\020\210\021"
+	.ascii	"/\236\232\342\235\274\360\354\340\300\263\327\227\260\230\302"
+	.ascii	"\244l\357B+[(\246#\"Qi\017\304HI\270\364\1774\266x'+\223x\204"
+	.ascii	"\233\034\273\227\2612G\b\002Y\351\375\320o\\\2236]\204\2464S"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_settingGetValueOffset.173.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\257\002U\023"
+	.string	"f\344|H\340\322&\035\217\356\001\360\321\222Y\315Y\337"
+	.string	""
+	.string	"y\327%]y"
+	.string	"\216\230\330\022\007\247\225\305[\276\n/\346\246\351^\003\203h\266\236Yj9\3070\316)\206\214\021\226;\307\037>r<\017\374q}\035A\032\331[\312\224\002h"
+	.string	"a"
+	.string	"i"
+	.ascii	"+\325\337|\241\253\200=\224y\2009u\224\214\346\f\021X\345]:\364"
+	.ascii	"l\373AG\001sLU3\003\252\202nf-~\314\031~$/\351.\365\002\272\313"
+	.ascii	"\005\361\330;\031Wc>\370\356\301\020\222\017\351\341<\376v\007"
+	.ascii	"\037\220n\320j8\337\032\032YG2\347\f\251\331D=\241\3149\255\264"
+	.ascii	"Z\206\373t\333/\333\rl\305\005k\235i\220i\316\266\205\263xys"
+	.ascii	"\322\234\370C\022`<\236K_\246\273\374\226\210\020\232\321\234"
+	.ascii	"\177\373C,\225\3201\025\210\035\202\272;\366\343\\\035{\325)"
+	.ascii	"\253G\254F=\374C"
+	.string	"\254\366\242\372\024\325\335\252eT\307\250\326U\237$\245\304S;\216\334\234\030rAf\222<\"a\177\005\314\026\261Mr\004j\263Zz\232\3343\331d\013\332\210)h<\346\204Di\310\332+\023\3644\335\270\240\037\343\252%\023qw\314\362#\327\310\022\340Q\264\004\364\242\307\370$\201\312\364\255\341\033y\035d\3703\"\207\236i{\341\3030\316\233\023|\216\245m\006m\3509\221m\334\237c\303l\234\322\246\201\313\324\376\366\003\266\032m2\352\005\272o*NIp\242\200\201\n\204\005\253\001-\030\n)1\322\254\325+B\313\312\313K\353\365\261T\276\226\225\024\226\217\345\362\372V&vUh\271|/.\227\313'b\333\341|\234\253\343\324\f\350F\375X\347a\366\203\223\250=\016\321\317\210\035Yo/\330\366VW\346\273\270Qbw\332\270\250\335\03669\250\307\272nO{\332a\343#\267\333\317\232f4g"
+	.ascii	"\0014 \320\"\241\252yVba\203X\232l\006%\006\032fG\222\216\033"
+	.ascii	"\370C\243%\0365\337\236\304`D\354@\225\267\273\320\214\t)f\t"
+	.ascii	"\201=Q\350\214\006w\373\272<\240\265M\027\361\036\312\206\351"
+	.ascii	"e\242\331\203\277\222\305\245\234E\211\212#\flx\373\303\274S"
+	.ascii	"\224L\310@L\023\007\353#\362\033\305'\004\275\301\256\036&\362"
+	.ascii	"\204\013h\210\365\246|3\263.\243d"
+	.text
+	.section	.gnu.lto_settingGetValuePointer.174.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\017\001M\r"
+	.string	"\346Y\\D\020\221\223\016\357f"
+	.string	"\225\244K\227\303\241\0204\351\312\255k\250p\250\265\376D\241u\303\320\334\030\315X\374\324\261\266\350\337h?\213\004B"
+	.string	""
+	.string	"q\2631\366\262J\221!\304\201\362\316U\037\3104B\310&R\246\024H"
+	.string	"D"
+	.string	"K"
+	.string	"\254\225\017\330U\315`\261\033E\034\242\035\332\366W7Q\262i\fD\020/ \253\020.)t\354\306\316\361\005\260C\355\034\354P?\274\364,\371\2179\204\01629P)\3233k\260\273NT\352\345\326\333>`\373\201}\r\001\366\257U\225\235\245\267\307{s\326\237ai\250\351\013\246\365J\247\246\377\021\240\206\215\324ed\354fh\355X\030\260\305\210\307\337.\3711\336:%8;\252\b\330\231}*\306\n\346\306nDph\007\035\030\356\371\250K\277\201\203=\341+<\025&\237\212\202\274\330\350\343=\247\2541\200L\265K@y\324F=-j\3625Uy\270\364\260+\034\305\211\266\3332\342\237H\ti\"\016\375\025\354\360*B\203u\312\226Cp\270\230\331\254\261\243)\325C\337G\244\366\022\214(`@Ba\001G\340c\301\304\273"
+	.string	"\375q\243\022\024\020\211\364\031u\037I\207\002\362N\272O4\352\270\216C)\037QG\n\205D\335\026\367\327\252jS\317IY\fUu\323\323` \301\222-_\n\365\234\314\324\216 !\037\024"
+	.ascii	"\255\271E\306^\352\2559\266\026sc\200\023\002\204\354\264XA\263"
+	.ascii	",\0021j\341H\245\006\252\033\233]\023\375j\261A&LI\321%\352\276"
+	.ascii	"\341gFS;\237"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.175.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 \312\205\005"
+	.string	"\362\311%.pU\323\001"
+	.string	"\224\370\304\006\377\355\002\004\005[y\360\034\377O\005\262a\233\217\332\205\340\324D\247"
+	.string	"\300\005\316\261\233\020\f\217\307\210%{\313\024\257\250\255\201]\224Z\033W\f\306\256\205\203+mc\312\360\354aiL\263L\343)\354\235\340`\f\211\220\031yb\004uZ\216\376\260\223\263\362\257\324\023\374\245T\353z8\335\223"
+	.string	"\200\026\003\033\314\377\235\316\375\237\r/]\250\031\211F\324\335<-\313\255\344\276[\227\340}\335J\201\242\273/\275\217\262\237\373\377\360\037\361\237\006\b"
+	.ascii	"3\003&:c\023npML\013\001\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_settingGetValueOffset.part.0.181.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`g\001\225\016"
+	.string	"F\234aD\360\222(\035\212\3667\224\362#\006\311\003\253\203g*\006\203\274\365<c\245]\021\215K\370\374F\362\215\037\261\221\232[\221/]\205\352o2\221:,\366Z\231\225\235\0276\211\313\256\252\030\204:!do)S\nL"
+	.string	"J"
+	.string	"P"
+	.string	"\332\243=\315\276\n\316]z\256\325\312\266\377r\230\223\273\316\006\025T\347\245\003\213\213\037\273\336\366\b\340\004\260\307\274"
+	.ascii	"\354QI\274\273&\354\374T\265\240\256\377\016\241E\215\034\252"
+	.ascii	"\026\020O"
+	.string	"\316aV\262\273\326B\334\361\266\035\330~`\237&\251.Vx\270\332\262a:\203i\f\246#L\303\230V\230\316\313\374\027I\021\b`v=\274\202,+\3220a\377\343\354\215\377\235\354\215\271\307\230\fx\373a5b\303\243y\031\237\305\275\323cL\017\260\333\3321c\327K\360\350NP\243b<VN\244\362eU\250g\031\262I{\002J^\245z\032VJQ\266E\207aA\333\325@\342\317d \371%\036}\023\366\230Z@\307\n\225|\37135)pl\002ya\233\263Ov\017\315\265\253e\355\201\307\177\277\253\006\305\rT\n\t\376( Y\320\300$\002\003\317\200\320\005\n\037\f\321 \017IB\312I\251\024\"m \223-\345\344\203\262\201F\244\3153bQ\205\320h+\211D\243mc;\017W[\376wNb\232)\007\333\231\246\246d\330\346R\345\022U\027\333QS1U\037+#\034\343\035\026\035"
+	.ascii	"T\263\360<\0313=\323\232\035\260\002\223a\304-\230\314b,c\013"
+	.ascii	"\2321<k\354\202\t\257\306Z\341\0270 \017\214p\305\200\256\005"
+	.ascii	"dG\324%\004\301\263\016}\306\203\273_5rS\270\360\f\020\251)4"
+	.ascii	"/\275\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\371\001\325\f"
+	.string	"\206\023KB\360F)\035\254<\355\221\212%\013\367\005\036x\251w\245\341\244\001\370\313\202\031\366\204\211\027l\0372b\330\204>3\360\fl&\262\211l\206&\322D\232\364o\277\200"
+	.string	"\276"
+	.string	"\340\007j\313'D\022I\222\f7"
+	.string	":"
+	.string	"9"
+	.ascii	"\254:\2166\260\326Z\031\350\233>>\317\363\\\240/\372\270T\370"
+	.ascii	"P\257\231p\240\346\335\317J\204\013\365\356\206u\034I\336.\335"
+	.ascii	"\005@~\241\016\350\016\350\211\276\335\375\024\004\247\365\232"
+	.ascii	"\261\277"
+	.string	"\300\256\363\372\215\3536\027\257\261xN\305q(N\323\372\314\304eZ\342\266\3462\342\265^\223\365\237\325\203\032\202\036\351\201\376\310\201\336h$\235Z\006x.\r\364\272\364I\257d\335]\241\320\357~\022\232lT\311\366H6@\2579\262\002zM\221\035\020\362\030\220\347>\356\343q\\\307o\034\357i.7\316\323\\j|'\3430\030'{MY\033\216\007\305\224,\305b.&r\210\373[d\025\201s\202\333n\001\030\362q7\250\321\316\r\3713Xs\313\371\005\262*w.\200\340\251\347Zf\241gZ\241_R\241WJ\t9 @\003\021b\330\006\271\300\354\202\263\332\034\343\370a\210\310\300g\240\324$H\004\222\017\320\237\273\024t\013Sa\2437he\340<\34415+\226\314C\036\362\310c\036R\263b\311<\244f\305\222y\310C\036y\314C\036\362@\0367\223\033M\214\322\201\300f\204&\376\211G"
+	.ascii	"kG\022\275\243\021\207\240}\005\342\306;.\356\312\312"
+	.text
+	.section	.gnu.lto_.refs.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375 a]\002"
+	.string	"\022\306\021\027PO5\0060333\323>\360\007}d?\372K\366\233\210$\311\024B~\354x\2711\343\305\212\023#>\254\234l\2700\341\366`\366Z\235F\013\024\333\272\336t\272\361"
+	.string	"\\\314\231\334\311Vu\212\326\300\235G\215\004"
+	.text
+	.section	.gnu.lto_.decls.5eb74295a49b0a7c,"e",@progbits
+	.string	"(\265/\375`\3045=\352"
+	.string	"\212tuQV LA:\351\252?F\367\207d\266\2070\252\352\323_\3677\033S\334\377-\273\373\314X/\255\"*%V\341h\244\216\347\031\274\236Z\267\302\"\276F\033\246x\273\310\315S\226\252:\217f"
+	.ascii	"lv\245\337\256\271Y\346=\213x\177\237n\304D\244\343\220&mo)S"
+	.ascii	"F\004\022\005-\005R\375\242\243\270\331To\247~j\027MI\254\326"
+	.ascii	"T\335\364\307N\370\tGY\312k\301R\250\230\256\231\336\224\232"
+	.ascii	"\370\344\232\252\241\270\255\256\221\241LM\247"
+	.string	"\246j\026\034W\327\310jZx\245\341\2737\375\021!\202l,\312\r\034\373\366\202r\023\373\234\033\270\347\254\261\241##\203\f\013\372\316C\337v\275\224\256\351\260\r\301\341\342\r\375\337I\215\324G\334l\245\267\022\223i\345\033\222_\035c\251)\034\212\004\257\f_+q\026\036\203\324\307w\357\375 B\204\b\235\274\024\215\f\324\366\375\261~L(~g\350A\370@\001\234\206\3130\232\232\222\005\335\360\264\374q\223\323p\037\247\367\252\375\004\227^e\344\254e?6\303\315\f\370\fNT\324\030\263\355\233\f=gp\362\037gp\276\303\320\367\024\372~\022\203\263&\205\243M\f\n\206\233\034\206\265\330\203\360\003q\030\336\302_\352\220%\372Vd\217\357\336\265\037\021;fS\324bX\313^R\376\361\205\212\357\016e.\334\205\233\314wK\204\231\346\324#\030to!\316\035\016q\236\237\240\347\024=\243\241W~v`"
+	.string	"YB\323\366\\\003=\bT\030O\347\210\347&!\315\2211\333\017t\326\343<\306\253)\334MR\332\301\200\243%n/\372\356M\262\302{\334d=\256r\236\343)\357\364\336\265{\257\b\021?6@h0s:\355S\200\376\005\224\355\270\006n~\340\2734\325\361\303\213\"\323\366A\250\n\356\345\017'\377\375\361\207\363'\320{"
+	.string	"\275\006P\r\330\347\264P\320<\276,\f\240/\001\375\036\373\234\357c\237\223\345\330\330\347\274 \n\2238\336#\313\232\322\026n'\215\212\306\215T\255&\316LYU[V\302K\316o\234\344\037(\340UI\344\252\335{\371-\001\314{\217\370m\347\314\275G;\314\0330o`\177x\351p;\355I@\177F\302n\301\262\035gum\317)\017\3416f\336\233t\357\365\300a}v,\3322\021.\302M\016\330\310\371\b\263\035x\224\336\364\336t\247\307\320\264\025i\313\303>g\207\200\342\200\370\327\256sw\025\300\034\234\365\357\21798?,\331\347\254S\334sr\020\240\263\220\236si\225\336\035\034 uY\342\3322\033\003a5\016j\323\023\363\262\335\233n@\223\232 Qk\373\224}N\224{N\020\002\200\3637\220\363\337OBh\007\024\375\337\240"
+	.ascii	"\347\360\367\007b?\213\340\3470\236\277Yh\033\\\302\3175>\374"
+	.ascii	"}\344?\t\032\377"
+	.string	"\227\374\007\373X\007\200KE3/P\200\377\034\360\t\177o\375\255\365\367\325\3372`\374]\365\367\324\337RQ\177C\375\355\364w\213\277\373\350o\345\337*\370;\0052\374\035\003\362\357#\363\377/\377\305\374\357\362\267\t\3766\372y\347\347\r?\363\374l\301\317:\334?\237\377\365\376[\371\177\345?\326\317\312~\241K\320\304&\352\241F\321\303\026\372\371\004?\243\340\347\333A\377A\374\025h\326C\307X\r\257\237\227\270\360\267\360o\022\374=\202\020\374\r\202\373\374u\353g\036\037\370\333\003\377k\376:\204\001\bt\300\304\317Y)\220 \300\317Q,\374m\3429\177\335\240\347\347\257\245\277W\370[\003\177\253\360w\n;\301\277F\375\f\343\300\277:\375\374#\003\177\243\020\303\317D\376\276\300\337\026\370\333\204\277K\370\273\002\177S\340\357\022\177\223\360\267\004\376\216\300\377\233\2772\375\375\200\277\025\3607\b\177{\360\267"
+	.string	"\376\326\371\333\346o\364o\340\317d~\306\3623\335\317s?G\371\371\311\317r?7\3719\356\347\267\237\217\374\334\374\271\310\317i?\367\370y\354\347\260\237k\374\f\366\263\326\3171~\236\372y\3713\213\237\231~>\372\271\370\363\013?\017\375<\202\237\203~&\301\317\033\3709\205\237Q\370\371\002?\233\360s\211\237%\360s\006?_\360\237\355\177\333\317$\374\037\341?\013\377\317\374,\302\317\003\370Y"
+	.string	"?\007\340?\334\317\030\374\354\341\177\334\177\267\377j\377K\374\237\373\277\301\337\337\337\337\037\354\373\203\033\3709\030\n`\332\276f\325\253\252\027ef\244m\305\002z\235\361\200\261\257\037m+\367\234}\203Y\250\317\036U\263R\325\030`P=\006\247K\016;*m_a\034\030\206\205\213\276\266<\007\364Ze\277\306D\361h\373\340\022\352S75\225\327\242\013\352C\203S\263:\325\245\t<\367zm!K\252\341\3215\346\fT}\252.8\256\345\302\230ym9\r\350\025j\007\357ML\216\2666e;\245\240>e,XT\246\020<7\t\357\n\331\351\206\372<\325\244fM\252L\300\246{\324\343"
+	.string	"iK\252\016z\314\351\306\306d\244\355\353\3229.\211e\266Q\241i\373\001\320\253\322yF\003W\0314\324C\022>n6_=za\200\2524x\2256\311Q\2256[\232 \361k\233&M\202\346o\207\230\266\257\367o/\375\245\377pr\262\362\332\374\332\246\371\251JKJ!4P3}\206\233\215\246\373\336`]&\t\232\026\323d\032\260\264\254\201\362\272B\323~\214F\307\006\017\253\305\217>\0215UYKN,\224\357\331\204\376M\246\307\350\350\361\235Qrc\325\244$H\333\237J\264\301"
+	.ascii	"\275\303\344\330\2701\303[\333\016\334sz\270|\3000\250\2072 "
+	.ascii	"Z\0137\227fsi\"\300{\2316\202RvS:\3101\203\006e\203\n\312m\334"
+	.ascii	"D\316\017TW\256t\226&\013BIC\343\273V3B\330\274\021\021\223\302"
+	.ascii	"%\215\031\307\327\366Xr\356\246\256\334$\350\207\254\274\347"
+	.ascii	"\265\025\266\272J2\3012\262!g\250\374\364"
+	.string	"\336V\276\005\370tE\357\016X\206~\330\003aw\273\306;\317\035\013\312\340\253`\316\320\234\356\336x=g\315\232$Yi\3335p\334\231G\204.\t0\f\375\223\256{\322t\347\275\2342\243\226\037\220@\351:(Mw\236\243\253\340\016\253\020@/dsp=\345M\307mA\260%\036y=W\303\205i\n\231\236\223\362&\304\313]W\261\325\234\251\035ei\033\005(ed\207\223\266\007\276@o\307\240\027\274\305\305\265\234\t\351\215\n\306\200\273\343;k\032\336rr6\b\025UV\333n\302q\247\335\227(Tm\233\311\345\322Z\274\200\301q;ff\234\364\360\320\037-\020\357\267f\2775V\275WkF\360E\232vp\253\004\365\260\005\004\243q'\341f'i%5M\367N\031`\007\337\214\016\370J\326\336\021\255\033\2621ZJ\210\240?S \336\315vc7\226\272\367(,\370\202l\271\354\340\226\007\n"
+	.ascii	")\020\335l#}\244\331\316s\357E\272W++\370\302\356\216\257\357"
+	.ascii	"Z-C4\333\201w>r\270\265\275MB\377\376\317{\247\200\351]\"\341"
+	.ascii	"\234\fd\016\361\347p\275\275\367\177\225\200\226{\205\334\b\203"
+	.ascii	"\366x;\302\272\006W\204{m$\035-\233\326\272\224\033\232\326\216"
+	.ascii	"nS\323NjCSz\271<\334\265\257\333\2242\225\226\251\354\233\336"
+	.ascii	"\244.\251\233\304T\0325\245wyS\246\222\347&I\3614\245"
+	.string	"G\312\246\265.)nZcJm\270IWy\223\216\270\320$\246T\323\024\246\024O\323\332\221TSR\227\024\337\224y\271\206&i\227r\351\256\035\345\334{\237R2%\316\275G\313\253\274k\027\267\213\317\305\325\272l\207\226~\335{\357U\262\355y1kR\244k\327\344\203I\264t\357\336u\221"
+	.ascii	"%+\323{/\323ER\362\275K\351\362^$f\013VL\256\302\264\27497\351"
+	.ascii	"\350\t\311\213\211\263\204\304d\272>\270X\252i\315\213\t\024"
+	.ascii	"gd\215\354\"\245J&\273{]KtM\231^609kcVO]\\\351Y'6\205\016\n\020"
+	.ascii	"\207\327\037\231\0338\2556\252\036\222\326)^\326\302\264\025"
+	.ascii	"\222\006\235d a\323C\317j4"
+	.string	"\332k\017\254Fw\251Q\341\003a\206)\375\205\243\313\330\316\212\347&-\321\302\207\3266\272KG\271\341\336\257:\262\016\322@\372G\237\265\0327\033\255\305\336c}\203\r\255\303\270\215\355l\210\240F'\342G\304\215\236\030\035v:\226\306\267`\200\324dB\020,e\235\243}\260\235Uz\247D\220Ek\252\357\336t\2066\343f\227\375'\275\227\355C\216\231+}AN\037=\340Z`1\265m\036\2746\347\364UF\306\315\336q.8\027\203\035&\036hr\264m\035\337\302B\331\302\251\355\305\\\316V\305\245\321\265}\345\201\276\336@;D\335B_\257\320\327)\364\325\005\372\312\002\345\341\236S\203\366\352\002\256I\tS\327\325\\\215G\367\204\3247'\rZ\0323\314\fR\030.\276\266\264\310\230Ge\330t\372R%zm\377\316j\2544'^lm\033\253\373\252g\274\261Z\006NR\332X\2267\320a\336"
+	.string	"(\207\343\250\310i_\221\254:\006\316\fW\\P\035\203ih\030-T7\"xUm\273\352\247\177\240A\201\352[\366T\007\026\n;9\301\037\0322ms\234"
+	.ascii	"\335>\251s\302'\244-\216\034\r9b\260x1\265\245\341IgSR\227\217"
+	.ascii	"&Lv\256\270\300ZX&_[bC\214\317\306Y8\263!_K\026\356\257X\325"
+	.ascii	"\317\202ia\331z[\242\264\234\242\324\366\266\212U\302o-\234\177"
+	.ascii	":\302\3005\201n\223\334$Q\271\345\260H\254\333\220\250\027>\332"
+	.ascii	"\272}\360\024V\243\215\355\204\324\216<\313\306\206\006\207\023"
+	.ascii	"\225#\326\310\220\2461n\326\310o\233,E\254\352\005\225\2665v"
+	.ascii	"\255\210\025S\205\356E\333\333\"\177%\263D\362\226|\261\321\266"
+	.ascii	"\001\354s\326-@\267C\032\b\215&\261T\210\025#S\332\254\220\277"
+	.ascii	"\362\331 \374\326\302\022\272&\215\266!\304\314\314\254\032\023"
+	.ascii	"\271Q7`e\264\246N73;0\366\354V\315\246m\315\310\262\221\366\343"
+	.ascii	"\206E\330\027\276\377\216\201r\326\244-Z\213\351\2109\222e+\212"
+	.ascii	"\237\220\2524$\350O\263\254\314\366\3404dB\336\364t\302\320\237"
+	.ascii	"7\036?\017\333\343\207\251\364\002B\210\324\027&}\367Z\205\270"
+	.ascii	"\311\342\204\005\225\266\266\007\327\315\025\2513 d\320\237("
+	.ascii	"\\\267_\\\226\254\202\021\341>]%O\212\204\327Gf\243\344hM9vK"
+	.ascii	"v\253\003\315\262\321\"\255\255\315\201\303\336\260b6mGx\310"
+	.ascii	"hk\3038.\352\210\213\027k\243\326y\341!\265\265`\226\0067?gk"
+	.ascii	"\\\207\tS\333\034\037\372\025\360\347N\353e\273\252\240?e@,o"
+	.ascii	"a\330\245\335\252X\320\253L\257\025S\351\305\003 m\\\316\372"
+	.ascii	"n\223U\b\2353&U0\254n\267n\265\332\256\264\320\322\326f\335\316"
+	.ascii	"\b\003c\244\t\313\316\330\241%I\2325\324^!\240\263\374\270\316"
+	.ascii	"\310\270\215;\034"
+	.string	"em\233/w\332\030\034w\023\326lbe\251n\253\376\232\233 rKxj\250\235\272}\361\3270\r(\273;3\364\267R\177\r\216\227\0330\304\332>\207\007\372\234\032hC\201\270}z\262P\"\260\335#\251\020Q\244\260\314\330\200\303\316\254CX\0275I\351]\253\321\003\223\305\206\006=\316\026\224G\r\304m\013\333\242\261,\007!RzP\200\340\226M)\272A\007\210[\246\246e\262M6)\275R/H\341Y\365\351\264\311\221a\322\3266\341\300@{\224@\274\226)c\225D\350\200\224Y\335Y[\231\213k\225l\222\r\223\013\252\031\332Z\244#Nx\230i{\034'\364\325/Ms\351\324{\265\272\220\335\233\326\277j\246\271\330\316\352\001?\270\324\277z\206\333t\216\322\273\f*\211\023\002wd\225\366r\263\376U4\"~,\037\224\2200\250\375\r\027\3647x\350oj@\177C\005\375\271\201\202\366\300"
+	.string	"\361\252\245Y\265T2<K\313\032\250\274\037|w\t\245\203\232/T0\372*\231:\246f\311\005\357\256\255\230\264k\234!b\243\211V0\025\257~\251)Y\t^h\302p\263\202\251]\222p\304d)\261\254}\375\362\327-\225Ks\265\220\225u\207\324\266\362\001\275z\331\223\212\253j\013\344\201z\300>\347yS\003\355\251\001\342\225\312\271Y\251T,|\3110\220\227\306w\227V\035\350\224Y\322D\326\366\312-\233\362\344F\n\265\302\315\272W\357\316u\257\342U=\266\263\272W*\001qRfu}\367\336\037\0218YX\240\271Y\373\252\367W\273ZCs\265\240B\031\036U\200^\363\232\314\374hk\343\005\275\315\034z(\354s\336\330(A}\306\350\350\034"
+	.string	"\347\003\365067W\231B\244\367\005W\335;\2763\033&\352a+J\224\260&\033\026\250\207\252'Oj\234\251\321C=8\311\311U\255>$\250\007e\223&5\256\324\370@;\220\211\213\253`!\322\253DA\315\f\264\303\226\266fm\253o\007"
+	.string	"\323c\244|=E\265}]\362W\267\212$8\367e\215\256mM\002\364\252d'+\207\322\252\255\017\367\2347d5N(\207-G\216$\331Qs\221F\205A9\3405\2335F\220\356:RF\325\366\350\024\224\003\030\220f\005R\213\204\221Y?*hKz\fZ\244\313\213\026m_\211\3745H\025\242\007\205\207\327\266\246@\257C\322\224qbk\273\303='zo\023\345\260V\326\254e5\315\2032\264\315\305\215+\265.n\365\307_g\250f\034\207S&fK\255m=\003zEC\377\376\232\204\265\325\341\2363\230\366\341@;,\301\321\2548j\017\023\322\2534\301\362\216\357\254\307\364\310\003\362\324\366\225\307_sT\035:iULGm+\031\320\353\216"
+	.string	"(\221\213k\033\344\236\323\246\350\025\332\001kl\354\006\232\204v\220\n\013\253`!\266\262\240\035\230j\324\250Z&`\005\231\240\035t0\233\225Y\301B\004\3511\301\033i\242b\264}\375\372+W\355\3428\021^d@i\313G\200^\275*\234\223\2453m9e\237\363'h\206v"
+	.string	"\223\321\2542\252\326\217\036\223\203I)\311\"\261\032\235\303\244p\205\"\3431Y4\226\330\340D#\202Px\020\"\252\220\034\016}H\2368\213\307$\362\346D$\206B*\212\202\212D\022G\244\n\022\036\212\212T\024\213\306b0\006\343\221(i,\006Q\b\207EvxTad\215R\004\r\221\302\240c\022y\002\013\0260A\"9\034:\n\223\032$O|"
+	.string	"\302\013A\306\242\022\303\243\261D\212a\022\271\302\304\316\211F\b\021\215\204\206I!\f\304d\320\bHa\007\216Da\317\211F \2150\034\207H\022I\242!b\021\n"
+	.ascii	"\fO\f\203\216*\214&\222*\214\212\304\234\344\211F\220(\032"
+	.string	"S\2440\006]"
+	.string	"\003#O\300\200$\262!b$[0\0242\246\260I\022\217I\244\320\260\210\204\221\030\004D\236@\016}\220Gc\221\261D\221\220\03044B\346\2548\016a0\006\rW B\n\217(\204\310\"\242\260\002=C\243\025, \221B\243\030\214' \213\206\305\242\220\250\304"
+	.ascii	"\212FbRX"
+	.string	"d4\262@\320\n\027\024\031\203\214I\343Q\205\0241\250\020\203\360\003F#\031(p\034\032\25101\244\302\205\341\004x\206\204(\bI\360\020\0244\302\360(\214A\350(4\301\003\n\243\023\214\307\025%XP$t!\005\261\004\237\025\307a2)$\341hD\026\207&\222\305\341\361\250\242\304\317\260\210\210\302xT\341\202a\020\021\206\341\004d0\272\360B\220\260\210\204\017C!#\n&F \301\304q(D\204\301xT\301\204\n%tH\026\207)\212C\304\242\0218$\211\305\r\354\024S@\201\"\005\236\244\005\310\023\310\023\211\223,\2520\226XqL\026)\300\341\205\240!Q\t\241\"\242\n\022,8\016\223E\242Q\205\016BEb\005n|<\030\221<\n\215F\2440,\001\203a\na\006L\f\217B\243\024\306 \013\204\206\311\243\321\204\217\r\f;\017b!y4\"{\036D<\016\213\303!\364\tX"
+	.string	"\002\026\320"
+	.string	"\031\202\311\023\2150Ra<\016\2358\016\223\303\024\302\243\320\210\004\210\240\242\212\n$\207\310\233\"\212N\016\221\303#\020yb\3051\211$\016\rW\0302\302\031\236\200\210\264H\344\360($$\f\25602\006\331c\322\250\026\031\215$\234"
+	.string	"&O\300@,\n\262I\016\221(P\030O\241\341\013AB\243s\230BX\264C\243\025I\233TQ$\344"
+	.string	"\261(\210'\231<\321\200`\321I\224\034*\016O\030a\205\360x\024\002\223\303\023E\026\3100\024*Z i3,rA\310\302\t\304\242\240\016F*^0\032\213\316\344\211>\334h4<\222H\032\215G\02272\bST\344\211\0222\bQ(\022Q \026\005m\b\026\211)\252\f\302\024Eb\212s\210\210\242h\f:\223'\212CF\300\342\220Q=\n\211\202l\362\304\002\200\222E\242\n\364B\017\026"
+	.string	"\024\002\n!\020Fpx\b!\224\320`\003\031(\001\r\032\201\034*\022\223\311!\222D\020\n\022E\2420\005\211\240#\222\304\210\237\033V\255n\251\324\034\263=nr\244L\224\304\232.\006\024)[\200a-\267#*\007\\\023h\243\331\332d\330\360\002\326\260d\3143Sfm\201^\300/n^\016\b\226\256\325Y\321\333c\202\312\020\274\\\227\335\332Y\313\021&\003\310\325Jlj\364\210!\006d\002\267\316\204\351+\323\366\300\255\037\230\005\324\272aq\327G\325\226\355\330\347\304\240\013\320\2013\202b\\@\306\260\256\262<\345-i{\340\325o\267"
+	.string	"e\340p!\346\326\226\341\330\347\004*\001\035h\365\226F\345\013\030\003\b\343*\313\023\037@\030?\220\nX\305o-\210Q-!\323\226\317\330\347\364"
+	.string	"|\001\234\372\001\366\305\004\004\003\224\342\267\026\206P9\203\326\226\311\016\\F\301P\032\"\243\355\201Q\277u\002\204\232\301\343\013\254\355\355\354\200\016t\001\2241\3075\006|\002:\351\354]\371"
+	.string	":\375V\f\260\205\216\024\260'Pm\231y\006\350@\0267H\346\320\350hbb2\267\254\264=\220\351\007*\001\227\356\216\304\304\332\362\007\3569+\027\320\201IM\246\210<A\002\0365\233;\226m\017<\372\255\037P\271E\204\210U[^>\001\035xu\244\320\232n\1776\215\024\216*U\332\336\246\371\355\031\213\206\253n\327R[\266b\237\263\307\017\350\326LM\233\037\215'm-(c\373\316b\310\261\265\275\355\373k\022K&\307H\363\250J[\266!\006\350v\f\232\306\tTX[\016a\300\350\321\bRg\301$\331\242\302\272\373b\275(u\371\373\321\366\326\313o\273X>~\343\202K\225\264e"
+	.string	"p\301\001\263\267\206\326\366\002-K\234,/xQ\262\364\bv\225Y\212\201%\355\\:\271\262r\245H\316\332\225\\\336\336\333\251\324Gc\207\225\0307OgS\354\364\264z\007\215\373%\217\311\006J\222\023\277*\025\354LBG'\005\357\356\332\321\260w\177=\2635\364\023\226U\227\266\347\203\002tk\247\203mn\216J\335\335\027\223\274\266\267u?\277\265`7\303\fzm\033\f\350\226\316f\t_Z\324\2249\034\257\345\0250\264\333\271\277\246,\2073\027\005\317\214\224(4\232n6\312\037\204[\250\323\202\363QD<I\263\020r\314\231\251\221&Ics\024@0P\214.\234K\322\250\017\023@\223*\223\211\230g2dh\214$I\n\033\333\001\240\354\244\016D\025\212U\233\035\362\247.QO\351"
+	.string	"\031\310\n\344\001\357\2622F\250\222?&7\257\262\302\036G^\232\216\246*\375D\024Ut\227y\345\331\304\206\017\357\201aJ\261\323\315Hx-~\356\022\255$\345\235\341\272\217\305Z\001fN\274}\3540k\225\261\322\353\035\217\031>\022*\373\025h\311\233y\260a\236\251\207\240\334\213a\032p\204\016-\334\027\355h\001\004\2747\253\031B\271\212\366\350H\323\326\254\237zP\b\003\243r\322\226\264[0\273\253\227q\231\033\242S\004*\337E\205\250\256\f\336U\261R\254\223S\005\020\343\302\237}\327*k|\227\201\332\332\237k8\033\266\005n\034\235\222\363\224\346\272\026+6\374\352\354\006wX\251.d\004\227\361\207\237\204z\177%\332VQb\r"
+	.string	"\005\300j\024\235\304\202\330p\307P\334\226\375\260\020u(\334\334\267\305\356\277\330\035\310v+>\255\327v\212\377\r\274\210\224\2130\004H\235Q\261\317G\341\241nU\013*R\234\031\306\212\204\312\304\252\b(\321\231\034\020\033C \325\240\272\314\340.<h\366\3516\bM\366\220q\303\224a\030\0053^^Z\203\036\301g\3543e$\362\352\373\224/p~\305\244\332\261N\205Z\017\245U\372\026\325\344\364EG8H\033]\207\227\365\300Ic\224\230\362\275"
+	.string	"\217\311\341\360\b\315\230\342\025\036\t\331P\207\311\317\240G.\365f\342\203~\237\324&\332F\343P`p\330\307\243"
+	.string	"\201\323r\333\245\022=\237%\262%o\252\225\0352\200\001\301\345.\247\260\350b\364"
+	.string	"i\323\375\202X\325A\222Br\233\275'8$\013\005\220\306\3578 \364\2021f\315\345I\244o\223\270\017O\350R\313\001\275\2500y\037\267\262\231\370\242&\273\331{,\216R\377\314\\\257\205\b\206\005;\004\300\322\221]\373\003U\031S\006\200x\213P\300\206\243;\237\201\374\262}\304Z\352p\032C"
+	.ascii	"r}X\314#rNA*\246V`<\232\345{K\201\225\005\204\342Ugy0\345\375"
+	.ascii	"H\3272 W\004\323\327S^\005\020U\034\242i\340\274\017G\260\213"
+	.ascii	"\325\342\226\343p<\035\211\213\223\240\031\361r\025e\332p\314"
+	.ascii	"4\2418!p\365\315\220\220F\274\002~\345\343\306\330R\324\013\203"
+	.ascii	"\227$:\202\266\251\361\"\377P\021Z\344\221\262V'B`T\352\374\\"
+	.ascii	"\021\324\366\3503 \264\331\207\310ia\301\3268\350\034\376\363"
+	.ascii	"\3262\331]\032\261\306\337\363\253\200\024\2038v\013\006:J\321"
+	.ascii	"\022-\275\330\301\371J*\214\246\260\033\240\032An\337o\252\305"
+	.ascii	"\255\200\034\331\316\304T\032\nk\216aY\0211\336\341\325\221a"
+	.ascii	"Z\254\345*\002"
+	.ascii	"\246\\Jj8~*(\2212\276\232\2044\3605\3451\367X\2557\334\344\275"
+	.ascii	"B\200;\202Y\211,9\320\241\252\3613\035i\344\245^AN\272\337<\343"
+	.ascii	"\356\201$\002f\240\312\007\251\343D9\222\245?gv\237\025S\266"
+	.ascii	"X+\235N\362\200\004fWz\025<\"\"\362\203\355\233\031M\212%h\026"
+	.ascii	"5\0232\274\341\252\301u\026\304\211;\375\201=\370\021\024\320"
+	.ascii	"2\257\001\256\375\247\205\321\tq\177\360\310\336\343q\363\303"
+	.ascii	"\215%J"
+	.string	"L\023\241\315UP\222\307\363\013R\331,\232-t!\276WE\211\216\373\253lx\f\234\355avP\236\337\243&\211\212\361\251\t\317\260=\322?\006\234\032,\350\321\325\024\034\253\211\311\212\245\017\205\300H=\026\345\035^'\027\323\374A\350\272W\242Hu\3349'\n\340\313\235\213!\335\372\202\n\332\007i\320\264\270\266\315\364\362R7\264\030rLf\267]h\242Ef\\f\246\266\3352|\316NsI\3648M\235~;\006\225r4\005\204\017\351QAdOB\030\027(\225Qy\022C\016n\217\254A\017\210r\330\255o\346x\245\266\263\305]\372\037\246Z\247\330\274N\344\004\315d\2779d\214\342\325\340\307\030^i\371\276\351\277(\320\2173\006-\020\222C<\177M \226b\246\371\317\f%L#\313\372\034\204\020xd\230h\231%\020&\315L\220\260\177\344\363\342\352\025\371z\300\376J\216\320\314\177\344Zd"
+	.string	"\263\240 Y@\320*\240t5\205;\214\342\265N4\027}\265\033\no"
+	.string	"\202\263B\376E?V\006B2\321\206\203\314p\005-\005G\311\006\340!W\302}AY\211\037Hb\275@c\205ZRg}\017\223\366b\255\300\216ZAY\325\316\240\f\312\321q\035\210~\331r\031\013\215-\033n\370)b\001\031\021\241G\210\250U\210\"Cx\275\273K\373\365\003!k\233\3038{\367\"\3160j\236"
+	.ascii	"E\237h\314\252\367j\276\372^\347\265!IDu\332\342.W\3671\353("
+	.ascii	"!\357\221\267\335H\317\222:o\245\243\356\200Y\2563\001\253\026"
+	.ascii	"+\217C\304*<\252U\373\374\361\355\363^?qAT\340\312\273JL\351"
+	.ascii	"\331\332h"
+	.string	"\234E\362\253|c\027\\\212\021\266_<\351\021\301z`Z\375\275\f?Z \266\320\315\037wD\205\260\337C\224\004\354\367\023\013\315Oj\230\353\321\335*|\215U!\326b\341\2222-N\343`vKZ\245f]\217\004\027\016\342\200mST\314\277\026\274D\322\241{\271\320\300\212\277\0366\264\341C%\303\261\237\fK\362\t\021\220\371\225\177f\325\343<\223\032\344t\212y\201\177B\304\327\222El\312\2103h\256\251\274\255\335\210\236:\201\240m\257\354\352\321\232\240\013\251tXf\365\004l\240[\301G\024\304\246\243t\254\270\377\256\246\205ut%K\367\013@\327\301\242B\2346\024\007LA\261\022\361\363@:@\020%\r\257\222\274\331!\251\337v\023OI(A\262E\245\371\302\325\276\272;\343\317\265\337\301\217\314\t\360jT\377{\311%gh \020a\262E\n\263\261:\272\002\273\013;\025\335\272\313G3"
+	.string	"\037\207\255\360\273\221{\360\f\260W^\024\262Q\311\202\205\262`-\221\025\322\032w\264\260\n\005\237\342\254ZgV\013\334\270\002\214\322\004\367\201\236i?>\316\270\006\215\0220\376\320ttZ\273Hy\242\b\243\001\245\374N\312\311\345q\020\027\250\346\310,c\272\013\276\215\227_\274\214\233}\214\237%\254\316\037\036\234v\021\025\244\246]\221H\204\025\211\375\2215y\360|3\246d?\034\f'"
+	.ascii	"SO\224\231\376[]=%-&84>\372\335|\212\n\303Xn4\260\003{E1p\357"
+	.ascii	"\201\215^\001U\236-\250\353\232\345\351\217\326#r\300\265\371"
+	.ascii	"a\313\334|\211\264\2220\254.]\006XJ\351!8|8;\035\363\3613!\372"
+	.ascii	"\022\357\263\364O\317|(F\261\021p\267\334\264.\265\"\b-\035\t"
+	.ascii	"\027a\316E\360`\200\363"
+	.string	"\034\301kh\254\013\332\034/\340\253C\264\332\361\306\007!\344\313\342m\361Rk\304a\216|\376;\331h\335\223\310\271\276\236\325\2310\242M$\230E\257\3179+o?p'\236\205~\257@\260\263\246\363\317\205\316\276{8\032\033\264\350F\353\215\267\243\317r\255\274\3502\376\334\312>7\276\363\300#\331O\253\234\337z\353\230\201\201\337\2233p\335\203\201\205\247bq\332\366N\333>\264\343\253,\237\215\035\317\233\303)w\357\371\243y}T{=q\227\311\027&\247T~\177NH\017\206vb\345\201\212\247\204g,\366\023{\017\350\373\311y\021\366\253]Q\215\377`\027d\036\007\374\013l\362\262\177\232\257\017\201\333\237\374l\361\366\312\264;\033\365;\026\334?\345\004\315\246\3267\3363\022\270\271\350\202\301#\310C\n\374\207j\016\360k\020\307\200nQ;\205\352\022\240C\020\335\001\352\013U\035Az\001\350\003\214\035"
+	.string	"\266\037\035\363c?\017x;\344t\210c9\350<\033=\032\330I\351\301U\335?\365\214\243\246\021\254\377\351\373\276\337?\357H\236GO\334Q\356\177tOr\346\232\353D\350\313T\214\013z\323\022\370\226\376\333^\367\231\217\337\347\333"
+	.string	"\376*|W}n\323\235\374D\357\034\037:\271\355\374"
+	.ascii	"}\252\001O\037j\312\271\223s\327\306\336<O\227\036\204<mw\220"
+	.ascii	"\372\323\032\273\377_\377\244\375\307\332\255\233\277\276I\312"
+	.ascii	"\005@\277\262\334]\206p\307\201\377 \"g\252\331~\330#~\f6\237"
+	.ascii	"5\337\032\205\3377\265\215\022>\370g\031n\354jN\235\202n"
+	.text
+	.section	.gnu.lto_.symtab.5eb74295a49b0a7c,"e",@progbits
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"settingFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"settingGetValueOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"settingGetValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5eb74295a49b0a7c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
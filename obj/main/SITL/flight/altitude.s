@@ -0,0 +1,17526 @@
+	.file	"altitude.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/flight/pid.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/fc/rc_controls.h"
+	.file 10 "./src/main/fc/rc_modes.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/common/time.h"
+	.file 13 "./src/main/flight/altitude.h"
+	.file 14 "./src/main/flight/imu.h"
+	.file 15 "./src/main/target/SITL/target.h"
+	.file 16 "./src/main/rx/rx.h"
+	.file 17 "./src/main/sensors/sensors.h"
+	.file 18 "./src/main/drivers/barometer/barometer.h"
+	.file 19 "./src/main/sensors/barometer.h"
+	.file 20 "./src/main/flight/altitude.c"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	altitude.c.dc55dc57
+	.weak	altitude.c.dc55dc57
+altitude.c.dc55dc57:
+	.long	0xed0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF2539
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2203
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2204
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2205
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2206
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2207
+	.uleb128 0x3
+	.long	.LASF2208
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2209
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2210
+	.uleb128 0x3
+	.long	.LASF2211
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2212
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2213
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2214
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2215
+	.uleb128 0x3
+	.long	.LASF2216
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2217
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2218
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2219
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2220
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xc
+	.long	0xcf
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2221
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2222
+	.uleb128 0x7
+	.long	0xab
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2223
+	.uleb128 0xc
+	.long	0xf3
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2224
+	.uleb128 0x17
+	.long	.LASF2450
+	.byte	0xf
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0xd
+	.long	0xf3
+	.long	0x122
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x132
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2225
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0x122
+	.uleb128 0x4
+	.long	.LASF2226
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1e1
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2250
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.byte	0xe
+	.long	0x215
+	.uleb128 0xf
+	.long	.LASF2251
+	.value	0xfff
+	.uleb128 0xf
+	.long	.LASF2252
+	.value	0xf000
+	.uleb128 0xf
+	.long	.LASF2253
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2255
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x221
+	.uleb128 0x18
+	.long	0x231
+	.uleb128 0x9
+	.long	0x96
+	.uleb128 0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x252
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x13
+	.string	"fn"
+	.byte	0x5
+	.byte	0x33
+	.byte	0x16
+	.long	0x252
+	.byte	0
+	.uleb128 0x7
+	.long	0x215
+	.uleb128 0xa
+	.long	.LASF2309
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x2b2
+	.uleb128 0xb
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1e1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2257
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x2b2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2258
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x2b2
+	.byte	0x10
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x2b7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x231
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x7
+	.long	0x2b2
+	.uleb128 0x3
+	.long	.LASF2260
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x257
+	.uleb128 0xc
+	.long	0x2bc
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2261
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.byte	0xe
+	.long	0x3fb
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2310
+	.byte	0x4c
+	.byte	0x7
+	.byte	0x4a
+	.long	0x574
+	.uleb128 0xb
+	.string	"pid"
+	.byte	0x7
+	.byte	0x4b
+	.byte	0xc
+	.long	0x9bf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2312
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x7
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x7
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x7
+	.byte	0x51
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x7
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2317
+	.byte	0x7
+	.byte	0x53
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2318
+	.byte	0x7
+	.byte	0x54
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x7
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0x7
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2321
+	.byte	0x7
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2322
+	.byte	0x7
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2323
+	.byte	0x7
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2324
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x7
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2326
+	.byte	0x7
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x7
+	.byte	0x60
+	.byte	0xe
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x7
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x7
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x7
+	.byte	0x63
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2331
+	.byte	0x7
+	.byte	0x64
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x7
+	.byte	0x65
+	.byte	0xe
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x7
+	.byte	0x66
+	.byte	0xe
+	.long	0xc3
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x7
+	.byte	0x67
+	.byte	0xe
+	.long	0xc3
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x7
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0x7
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0x7
+	.byte	0x6a
+	.byte	0x18
+	.long	0x979
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2338
+	.byte	0x8
+	.byte	0x63
+	.byte	0x1d
+	.long	0x580
+	.uleb128 0x7
+	.long	0x3fb
+	.uleb128 0x23
+	.long	.LASF2540
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x9
+	.byte	0x18
+	.byte	0xe
+	.long	0x5e0
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x1
+	.uleb128 0x24
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2350
+	.byte	0x9
+	.byte	0x4f
+	.byte	0xe
+	.long	0x112
+	.uleb128 0xa
+	.long	.LASF2351
+	.byte	0x5
+	.byte	0x9
+	.byte	0x51
+	.long	0x63a
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x9
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0x9
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x9
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x9
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x9
+	.byte	0x56
+	.byte	0x9
+	.long	0x2cd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2357
+	.byte	0x9
+	.byte	0x57
+	.byte	0x3
+	.long	0x5ec
+	.uleb128 0xc
+	.long	0x63a
+	.uleb128 0x4
+	.long	.LASF2358
+	.byte	0x9
+	.byte	0x59
+	.byte	0x1b
+	.long	0x63a
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.byte	0xe
+	.long	0x748
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2397
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x3
+	.long	0x657
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x3c
+	.byte	0xe
+	.long	0x7a6
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x80
+	.uleb128 0xf
+	.long	.LASF2406
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF2407
+	.value	0x200
+	.uleb128 0xf
+	.long	.LASF2408
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2409
+	.byte	0xb
+	.byte	0x48
+	.byte	0x3
+	.long	0x754
+	.uleb128 0x4
+	.long	.LASF2410
+	.byte	0xb
+	.byte	0x4a
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x58
+	.byte	0xe
+	.long	0x7e9
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2416
+	.byte	0xb
+	.byte	0x64
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF2417
+	.byte	0xc
+	.byte	0x21
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF2418
+	.byte	0xd
+	.byte	0x16
+	.byte	0x10
+	.long	0xab
+	.uleb128 0xa
+	.long	.LASF2419
+	.byte	0x1
+	.byte	0xd
+	.byte	0x18
+	.long	0x827
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0xd
+	.byte	0x19
+	.byte	0x9
+	.long	0x2cd
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2421
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x3
+	.long	0x80d
+	.uleb128 0xc
+	.long	0x827
+	.uleb128 0x4
+	.long	.LASF2422
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x19
+	.long	0x827
+	.uleb128 0x4
+	.long	.LASF2423
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x48
+	.long	0x827
+	.uleb128 0x4
+	.long	.LASF2424
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF2425
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF2426
+	.byte	0xe
+	.byte	0x1c
+	.byte	0xe
+	.long	0xf3
+	.uleb128 0xd
+	.long	0xab
+	.long	0x884
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2427
+	.byte	0xe
+	.byte	0x1d
+	.byte	0x10
+	.long	0x874
+	.uleb128 0x25
+	.byte	0x6
+	.byte	0xe
+	.byte	0x22
+	.byte	0x5
+	.long	0x8c1
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0xe
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0xe
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xb
+	.string	"yaw"
+	.byte	0xe
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x19
+	.byte	0x6
+	.byte	0xe
+	.byte	0x20
+	.byte	0x9
+	.long	0x8e3
+	.uleb128 0x13
+	.string	"raw"
+	.byte	0xe
+	.byte	0x21
+	.byte	0xd
+	.long	0x8e3
+	.uleb128 0x26
+	.long	.LASF2430
+	.byte	0xe
+	.byte	0x27
+	.byte	0x7
+	.long	0x890
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x8f3
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2431
+	.byte	0xe
+	.byte	0x28
+	.byte	0x3
+	.long	0x8c1
+	.uleb128 0x4
+	.long	.LASF2432
+	.byte	0xe
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x8f3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x25
+	.byte	0xe
+	.long	0x95a
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0xa
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xe
+	.long	0x979
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2447
+	.byte	0x7
+	.byte	0x42
+	.byte	0x3
+	.long	0x95a
+	.uleb128 0xa
+	.long	.LASF2448
+	.byte	0x3
+	.byte	0x7
+	.byte	0x44
+	.long	0x9b3
+	.uleb128 0xb
+	.string	"P"
+	.byte	0x7
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.string	"I"
+	.byte	0x7
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0xb
+	.string	"D"
+	.byte	0x7
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2449
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x985
+	.uleb128 0xd
+	.long	0x9b3
+	.long	0x9cf
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2451
+	.byte	0x7
+	.byte	0x79
+	.byte	0x5
+	.long	0x2cd
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x9eb
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2452
+	.byte	0x10
+	.byte	0x4f
+	.byte	0x10
+	.long	0x9db
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x11
+	.byte	0x14
+	.byte	0xe
+	.long	0xa22
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xe
+	.long	0xa59
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2463
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2465
+	.byte	0x12
+	.byte	0x14
+	.byte	0x10
+	.long	0xa65
+	.uleb128 0x7
+	.long	0xa6a
+	.uleb128 0x27
+	.uleb128 0x3
+	.long	.LASF2466
+	.byte	0x12
+	.byte	0x15
+	.byte	0x10
+	.long	0xa77
+	.uleb128 0x7
+	.long	0xa7c
+	.uleb128 0x18
+	.long	0xa8c
+	.uleb128 0x9
+	.long	0xee
+	.uleb128 0x9
+	.long	0xee
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2467
+	.byte	0x30
+	.byte	0x12
+	.byte	0x17
+	.long	0xaf4
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0x12
+	.byte	0x18
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2469
+	.byte	0x12
+	.byte	0x19
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2470
+	.byte	0x12
+	.byte	0x1a
+	.byte	0x13
+	.long	0xa59
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0x12
+	.byte	0x1b
+	.byte	0x13
+	.long	0xa59
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2472
+	.byte	0x12
+	.byte	0x1c
+	.byte	0x13
+	.long	0xa59
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2473
+	.byte	0x12
+	.byte	0x1d
+	.byte	0x13
+	.long	0xa59
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2474
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x1a
+	.long	0xa6b
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2475
+	.byte	0x12
+	.byte	0x1f
+	.byte	0x3
+	.long	0xa8c
+	.uleb128 0xa
+	.long	.LASF2476
+	.byte	0x8
+	.byte	0x13
+	.byte	0x21
+	.long	0xb4e
+	.uleb128 0x2
+	.long	.LASF2477
+	.byte	0x13
+	.byte	0x22
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0x13
+	.byte	0x23
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2479
+	.byte	0x13
+	.byte	0x24
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2480
+	.byte	0x13
+	.byte	0x25
+	.byte	0xe
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2481
+	.byte	0x13
+	.byte	0x26
+	.byte	0xe
+	.long	0xc3
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2482
+	.byte	0x13
+	.byte	0x27
+	.byte	0x3
+	.long	0xb00
+	.uleb128 0xc
+	.long	0xb4e
+	.uleb128 0x4
+	.long	.LASF2483
+	.byte	0x13
+	.byte	0x29
+	.byte	0x1a
+	.long	0xb4e
+	.uleb128 0xa
+	.long	.LASF2484
+	.byte	0x38
+	.byte	0x13
+	.byte	0x2b
+	.long	0xb9f
+	.uleb128 0xb
+	.string	"dev"
+	.byte	0x13
+	.byte	0x2c
+	.byte	0xf
+	.long	0xaf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x13
+	.byte	0x2d
+	.byte	0xd
+	.long	0xab
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x13
+	.byte	0x2e
+	.byte	0xd
+	.long	0xab
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2487
+	.byte	0x13
+	.byte	0x2f
+	.byte	0x3
+	.long	0xb6b
+	.uleb128 0x4
+	.long	.LASF2488
+	.byte	0x13
+	.byte	0x31
+	.byte	0xf
+	.long	0xb9f
+	.uleb128 0x14
+	.long	0x801
+	.byte	0x32
+	.byte	0x9
+	.uleb128 0x5
+	.long	.LASF2489
+	.byte	0x33
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2490
+	.byte	0x34
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x14
+	.byte	0x39
+	.byte	0x6
+	.long	0xbf3
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2494
+	.byte	0x14
+	.byte	0x3f
+	.byte	0x1f
+	.long	0x833
+	.uleb128 0x14
+	.long	0x838
+	.byte	0x3f
+	.byte	0x50
+	.uleb128 0x14
+	.long	0x844
+	.byte	0x3f
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF2495
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xa7
+	.long	0x2c8
+	.uleb128 0x28
+	.long	0xc0d
+	.byte	0xd3
+	.uleb128 0x29
+	.long	0xbf3
+	.byte	0x41
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF2496
+	.byte	0x45
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2497
+	.byte	0x46
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF2498
+	.byte	0x47
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2499
+	.byte	0x48
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2500
+	.byte	0x49
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x2a
+	.long	.LASF2505
+	.byte	0x15
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xc74
+	.uleb128 0x9
+	.long	0xf3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2501
+	.byte	0xe
+	.byte	0x49
+	.uleb128 0x1b
+	.long	.LASF2503
+	.byte	0x38
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x1a
+	.long	.LASF2502
+	.byte	0x13
+	.byte	0x39
+	.uleb128 0x1b
+	.long	.LASF2504
+	.byte	0x34
+	.byte	0x5
+	.long	0x2cd
+	.uleb128 0x11
+	.long	.LASF2506
+	.byte	0xb
+	.byte	0x69
+	.byte	0x5
+	.long	0x2cd
+	.long	0xcae
+	.uleb128 0x9
+	.long	0xcf
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2507
+	.byte	0x16
+	.byte	0x51
+	.byte	0x9
+	.long	0xab
+	.long	0xcc9
+	.uleb128 0x9
+	.long	0xab
+	.uleb128 0x9
+	.long	0xab
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2508
+	.byte	0xb
+	.byte	0x66
+	.byte	0xa
+	.long	0xc3
+	.long	0xcdf
+	.uleb128 0x9
+	.long	0x7a6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2509
+	.byte	0xb
+	.byte	0x67
+	.byte	0xa
+	.long	0xc3
+	.long	0xcf5
+	.uleb128 0x9
+	.long	0x7a6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2510
+	.byte	0xa
+	.byte	0x66
+	.byte	0x5
+	.long	0x2cd
+	.long	0xd0b
+	.uleb128 0x9
+	.long	0x748
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2511
+	.value	0x130
+	.long	0xab
+	.uleb128 0x1c
+	.long	.LASF2512
+	.value	0x12b
+	.long	0xab
+	.uleb128 0x2b
+	.long	.LASF2541
+	.byte	0x14
+	.byte	0xce
+	.byte	0x6
+	.long	0xdc9
+	.uleb128 0x10
+	.long	.LASF2523
+	.byte	0x14
+	.byte	0xce
+	.byte	0x2a
+	.long	0x7f5
+	.uleb128 0x5
+	.long	.LASF2513
+	.byte	0xd0
+	.byte	0x15
+	.long	0x7f5
+	.uleb128 0x5
+	.long	.LASF2514
+	.byte	0xd1
+	.byte	0x14
+	.long	0xdb
+	.uleb128 0x1d
+	.string	"vel"
+	.byte	0xd7
+	.byte	0x12
+	.long	0xf3
+	.uleb128 0x5
+	.long	.LASF2515
+	.byte	0xd8
+	.byte	0x12
+	.long	0xf3
+	.uleb128 0x5
+	.long	.LASF2516
+	.byte	0xda
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2517
+	.byte	0xf4
+	.byte	0xb
+	.long	0xf3
+	.uleb128 0x12
+	.long	.LASF2518
+	.value	0x10d
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x12
+	.long	.LASF2519
+	.value	0x120
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x12
+	.long	.LASF2520
+	.value	0x125
+	.byte	0x12
+	.long	0xf3
+	.uleb128 0x2c
+	.long	0xdba
+	.uleb128 0x1d
+	.string	"dt"
+	.byte	0xf7
+	.byte	0x15
+	.long	0xfa
+	.uleb128 0x5
+	.long	.LASF2521
+	.byte	0xfd
+	.byte	0x15
+	.long	0xfa
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x12
+	.long	.LASF2522
+	.value	0x114
+	.byte	0x18
+	.long	0xab
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2527
+	.byte	0xaa
+	.byte	0x9
+	.long	0xab
+	.long	0xe1e
+	.uleb128 0x10
+	.long	.LASF2519
+	.byte	0x14
+	.byte	0xaa
+	.byte	0x34
+	.long	0xab
+	.uleb128 0x10
+	.long	.LASF2517
+	.byte	0x14
+	.byte	0xaa
+	.byte	0x43
+	.long	0xf3
+	.uleb128 0x10
+	.long	.LASF2520
+	.byte	0x14
+	.byte	0xaa
+	.byte	0x53
+	.long	0xf3
+	.uleb128 0x5
+	.long	.LASF2524
+	.byte	0xac
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2525
+	.byte	0xad
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2526
+	.byte	0xae
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2528
+	.byte	0xa5
+	.byte	0x5
+	.long	0x2cd
+	.long	0xe3a
+	.uleb128 0x10
+	.long	.LASF2432
+	.byte	0x14
+	.byte	0xa5
+	.byte	0x34
+	.long	0xe3a
+	.byte	0
+	.uleb128 0x7
+	.long	0x8f3
+	.uleb128 0x15
+	.long	.LASF2529
+	.byte	0x94
+	.uleb128 0x15
+	.long	.LASF2530
+	.byte	0x83
+	.uleb128 0x15
+	.long	.LASF2531
+	.byte	0x7a
+	.uleb128 0x2e
+	.long	.LASF2542
+	.byte	0x14
+	.byte	0x71
+	.byte	0xd
+	.uleb128 0x2f
+	.long	.LASF2536
+	.byte	0x14
+	.byte	0x50
+	.byte	0xd
+	.long	0xe71
+	.uleb128 0x5
+	.long	.LASF2532
+	.byte	0x52
+	.byte	0x14
+	.long	0xb7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2533
+	.byte	0x13
+	.byte	0x29
+	.byte	0x88
+	.long	0xe7d
+	.uleb128 0x7
+	.long	0xb5a
+	.uleb128 0x16
+	.long	.LASF2534
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x83
+	.long	0xe8e
+	.uleb128 0x7
+	.long	0x833
+	.uleb128 0x16
+	.long	.LASF2535
+	.byte	0x9
+	.byte	0x59
+	.byte	0x8d
+	.long	0xe9f
+	.uleb128 0x7
+	.long	0x646
+	.uleb128 0x30
+	.long	.LASF2537
+	.byte	0x16
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x1f
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x1f
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x10
+	.long	.LASF2538
+	.byte	0x16
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 39 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 45 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 50 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 67 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x44
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x4
+	.file 70 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x47
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1294
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 77 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4d
+	.file 78 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 79 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 80 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.file 81 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 82 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.file 83 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x53
+	.file 84 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.file 85 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x55
+	.byte	0x4
+	.file 86 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 87 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x57
+	.byte	0x4
+	.file 88 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x58
+	.file 89 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x59
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.file 90 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x5a
+	.file 91 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.file 92 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2102
+	.byte	0x4
+	.file 93 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5d
+	.file 94 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 95 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 96 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2112
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2148
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2186
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2187
+	.byte	0x4
+	.file 97 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x61
+	.file 98 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 99 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x63
+	.file 100 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 101 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x65
+	.file 102 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x4
+	.file 103 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x67
+	.file 104 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2200
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2202
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1179
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1180
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1182
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1188
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1190
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1192
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1206
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1210
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1212
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1224
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1226
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1228
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1258
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1260
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1262
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1264
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1296
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1313
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1313
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1323
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1387
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1426
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1447
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1449
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1388
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1477
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1478
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1482
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1487
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1488
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1489
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1490
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1492
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1493
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1494
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1495
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1496
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1497
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1498
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1499
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1500
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1501
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1502
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1503
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1504
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1505
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1506
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1507
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1544
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1478
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1549
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1681
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1687
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2111
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2147
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2182
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2185
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2191
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2199
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2543
+	.long	.LASF2544
+	.long	.LASF2545
+	.long	.LASF2546
+	.long	.LASF2547
+	.long	.LASF2548
+	.long	.LASF2549
+	.long	.LASF2550
+	.long	.LASF2551
+	.long	.LASF2552
+	.long	.LASF2553
+	.long	.LASF2554
+	.long	.LASF2555
+	.long	.LASF2556
+	.long	.LASF2557
+	.long	.LASF2558
+	.long	.LASF2559
+	.long	.LASF2560
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x69
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2561
+	.byte	0xe
+	.long	.LASF2562
+	.byte	0xe
+	.long	.LASF2563
+	.byte	0xe
+	.long	.LASF2564
+	.byte	0x1
+	.long	.LASF2565
+	.byte	0x3
+	.long	.LASF2566
+	.byte	0x5
+	.long	.LASF2567
+	.byte	0x7
+	.long	.LASF2568
+	.byte	0x6
+	.long	.LASF2569
+	.byte	0x6
+	.long	.LASF2570
+	.byte	0x6
+	.long	.LASF2571
+	.byte	0x6
+	.long	.LASF2572
+	.byte	0x2
+	.long	.LASF2573
+	.byte	0x7
+	.long	.LASF2574
+	.byte	0x7
+	.long	.LASF2575
+	.byte	0xa
+	.long	.LASF2576
+	.byte	0x8
+	.long	.LASF2577
+	.byte	0x9
+	.long	.LASF2578
+	.byte	0x4
+	.long	.LASF2578
+	.byte	0x9
+	.long	.LASF2579
+	.byte	0x7
+	.long	.LASF2580
+	.byte	0xe
+	.long	.LASF2581
+	.byte	0x2
+	.long	.LASF2582
+	.byte	0x11
+	.long	.LASF2583
+	.byte	0x12
+	.long	.LASF2584
+	.byte	0x12
+	.long	.LASF2584
+	.byte	0x11
+	.long	.LASF2585
+	.byte	0xe
+	.long	.LASF2586
+	.byte	0x11
+	.long	.LASF2587
+	.byte	0x11
+	.long	.LASF2588
+	.byte	0xe
+	.long	.LASF2589
+	.byte	0xe
+	.long	.LASF2590
+	.byte	0x10
+	.long	.LASF2591
+	.byte	0xe
+	.long	.LASF2592
+	.byte	0xf
+	.long	.LASF2593
+	.byte	0xf
+	.long	.LASF2594
+	.byte	0xe
+	.long	.LASF2595
+	.byte	0xe
+	.long	.LASF2596
+	.byte	0xe
+	.long	.LASF2597
+	.byte	0x11
+	.long	.LASF2598
+	.byte	0x12
+	.long	.LASF2599
+	.byte	0xe
+	.long	.LASF2600
+	.byte	0xe
+	.long	.LASF2601
+	.byte	0xe
+	.long	.LASF2602
+	.byte	0xe
+	.long	.LASF2561
+	.byte	0x10
+	.long	.LASF2603
+	.byte	0xd
+	.long	.LASF2604
+	.byte	0xd
+	.long	.LASF2605
+	.byte	0xd
+	.long	.LASF2606
+	.byte	0xd
+	.long	.LASF2607
+	.byte	0x11
+	.long	.LASF2607
+	.byte	0xe
+	.long	.LASF2608
+	.byte	0xe
+	.long	.LASF2609
+	.byte	0xe
+	.long	.LASF2610
+	.byte	0xe
+	.long	.LASF2611
+	.byte	0x10
+	.long	.LASF2611
+	.byte	0xe
+	.long	.LASF2612
+	.byte	0xd
+	.long	.LASF2613
+	.byte	0xd
+	.long	.LASF2614
+	.byte	0xd
+	.long	.LASF2615
+	.byte	0xd
+	.long	.LASF2616
+	.byte	0xe
+	.long	.LASF2617
+	.byte	0xe
+	.long	.LASF2618
+	.byte	0xe
+	.long	.LASF2619
+	.byte	0xe
+	.long	.LASF2620
+	.byte	0xe
+	.long	.LASF2621
+	.byte	0xe
+	.long	.LASF2622
+	.byte	0x11
+	.long	.LASF2623
+	.byte	0xe
+	.long	.LASF2624
+	.byte	0xe
+	.long	.LASF2625
+	.byte	0x11
+	.long	.LASF2626
+	.byte	0xe
+	.long	.LASF2627
+	.byte	0xe
+	.long	.LASF2628
+	.byte	0xe
+	.long	.LASF2629
+	.byte	0xe
+	.long	.LASF2630
+	.byte	0xe
+	.long	.LASF2631
+	.byte	0xe
+	.long	.LASF2632
+	.byte	0xc
+	.long	.LASF2633
+	.byte	0xb
+	.long	.LASF2634
+	.byte	0xb
+	.long	.LASF2635
+	.byte	0x2
+	.long	.LASF2636
+	.byte	0x1
+	.long	.LASF2637
+	.byte	0x3
+	.long	.LASF2638
+	.byte	0x5
+	.long	.LASF2639
+	.byte	0x5
+	.long	.LASF2640
+	.byte	0x5
+	.long	.LASF2641
+	.byte	0x5
+	.long	.LASF2642
+	.byte	0x5
+	.long	.LASF2643
+	.byte	0x5
+	.long	.LASF2644
+	.byte	0x5
+	.long	.LASF2645
+	.byte	0x5
+	.long	.LASF2646
+	.byte	0x2
+	.long	.LASF2647
+	.byte	0x5
+	.long	.LASF2648
+	.byte	0x5
+	.long	.LASF2649
+	.byte	0x5
+	.long	.LASF2650
+	.byte	0x5
+	.long	.LASF2651
+	.byte	0x5
+	.long	.LASF2652
+	.byte	0x9
+	.long	.LASF2653
+	.byte	0x5
+	.long	.LASF2654
+	.byte	0x9
+	.long	.LASF2655
+	.byte	0x2
+	.long	.LASF2656
+	.byte	0x9
+	.long	.LASF2657
+	.byte	0x9
+	.long	.LASF2658
+	.byte	0x9
+	.long	.LASF2659
+	.byte	0x9
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2093:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1270:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1865:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF1849:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2132:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1729:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF941:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2012:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1146:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1923:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1869:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1860:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"USE_FAKE_BARO "
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1421:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2200:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF1216:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2300:
+	.string	"OWNER_RX_BIND"
+.LASF1740:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1428:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1894:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1050:
+	.string	"__DECL_SIMD_sinh "
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF1395:
+	.string	"USE_CLI "
+.LASF1558:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2484:
+	.string	"baro_s"
+.LASF2487:
+	.string	"baro_t"
+.LASF1775:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1422:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF978:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1482:
+	.string	"USE_PPM"
+.LASF2444:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2451:
+	.string	"airmodeWasActivated"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1401:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2495:
+	.string	"airplaneConfig_Registry"
+.LASF1359:
+	.string	"FP_NORMAL 4"
+.LASF1114:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1094:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF951:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1259:
+	.string	"__DECL_SIMD_log1pf"
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2148:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1577:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2077:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1381:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1155:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1509:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2391:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2208:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2499:
+	.string	"altHoldThrottleAdjustment"
+.LASF1650:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1530:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2261:
+	.string	"_Bool"
+.LASF1795:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2102:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF909:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1942:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1443:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1447:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2523:
+	.string	"currentTimeUs"
+.LASF1299:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF1118:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1423:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2516:
+	.string	"baroAlt"
+.LASF2270:
+	.string	"OWNER_ADC_CURR"
+.LASF1046:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1239:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1796:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1274:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1747:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2057:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2135:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1902:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1639:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1692:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1802:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1133:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2249:
+	.string	"DEBUG_COUNT"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2181:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2020:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1914:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1237:
+	.string	"__DECL_SIMD_sinh"
+.LASF1508:
+	.string	"USE_SPI"
+.LASF2141:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1047:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF955:
+	.string	"__DECL_SIMD_expf64 "
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF1429:
+	.string	"USE_SENSOR_NAMES "
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF2089:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1302:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1640:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF926:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1632:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1099:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1928:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2470:
+	.string	"start_ut"
+.LASF2061:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1236:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1363:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1596:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2267:
+	.string	"OWNER_LED"
+.LASF914:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1760:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1777:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF2038:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1068:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF939:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1364:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2219:
+	.string	"uint16_t"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF2363:
+	.string	"BOXANTIGRAVITY"
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1232:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1669:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1300:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1696:
+	.string	"NOOP do {} while (0)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2028:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1798:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1872:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2036:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2007:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"TELEMETRY_HOTT "
+.LASF933:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1072:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1241:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2111:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1587:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1362:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF908:
+	.string	"_MATH_H 1"
+.LASF1960:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1981:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1340:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1722:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF1513:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF957:
+	.string	"__DECL_SIMD_expf32x "
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2167:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF922:
+	.string	"__DECL_SIMD_sinl "
+.LASF1971:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1628:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1476:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF924:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1600:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1188:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1377:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2403:
+	.string	"GPS_HOLD_MODE"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1613:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2338:
+	.string	"currentPidProfile"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF1170:
+	.string	"__DECL_SIMD_tan "
+.LASF1717:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2413:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2513:
+	.string	"previousTimeUs"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF943:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2161:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1748:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2193:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1620:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF2113:
+	.string	"AIRMODEDEADBAND 12"
+.LASF2052:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2178:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2381:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2534:
+	.string	"airplaneConfig"
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1636:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1417:
+	.string	"CMS "
+.LASF999:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2060:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2435:
+	.string	"PID_YAW"
+.LASF1953:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF942:
+	.string	"__DECL_SIMD_logl "
+.LASF2088:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2274:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2293:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2164:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1287:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1273:
+	.string	"__DECL_SIMD_tanh"
+.LASF1519:
+	.string	"_T_PTRDIFF_ "
+.LASF2027:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1179:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1756:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1695:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1714:
+	.string	"BIT(x) (1 << (x))"
+.LASF2298:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1684:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1214:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF950:
+	.string	"__DECL_SIMD_exp "
+.LASF1160:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1285:
+	.string	"__DECL_SIMD_tan"
+.LASF1025:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1042:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF2217:
+	.string	"int32_t"
+.LASF2443:
+	.string	"PID_ITEM_COUNT"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1556:
+	.string	"FAST_MATH "
+.LASF1460:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1200:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1549:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1703:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1261:
+	.string	"__DECL_SIMD_atanh"
+.LASF1134:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2070:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1871:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF2074:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2306:
+	.string	"OWNER_SPI_PREINIT"
+.LASF952:
+	.string	"__DECL_SIMD_expl "
+.LASF2010:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2149:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1705:
+	.string	"STR_HELPER(x) #x"
+.LASF1450:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1780:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1811:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2139:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1856:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2295:
+	.string	"OWNER_BARO_EXTI"
+.LASF1205:
+	.string	"__DECL_SIMD_acos"
+.LASF2483:
+	.string	"barometerConfig_System"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2323:
+	.string	"levelSensitivity"
+.LASF2190:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF515:
+	.string	"__always_inline"
+.LASF1016:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2536:
+	.string	"applyMultirotorAltHold"
+.LASF1135:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2117:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2426:
+	.string	"accVelScale"
+.LASF1049:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2173:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1048:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1875:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2092:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2430:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1742:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2273:
+	.string	"OWNER_SERIAL_TX"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF2500:
+	.string	"initialThrottleHold"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1633:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1315:
+	.string	"__MATH_PRECNAME"
+.LASF1085:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1225:
+	.string	"__DECL_SIMD_exp10"
+.LASF1646:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1249:
+	.string	"__DECL_SIMD_log10"
+.LASF2253:
+	.string	"PGR_SIZE_MASK"
+.LASF1325:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1346:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1233:
+	.string	"__DECL_SIMD_expm1"
+.LASF1347:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1017:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1218:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1497:
+	.string	"USE_RESOURCE_MGMT"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1318:
+	.string	"_Mdouble_ float"
+.LASF1840:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2026:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1054:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF2224:
+	.string	"double"
+.LASF1503:
+	.string	"VTX_COMMON"
+.LASF1185:
+	.string	"__DECL_SIMD_sin"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1244:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1425:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1257:
+	.string	"__DECL_SIMD_log1p"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshl "
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2237:
+	.string	"DEBUG_VELOCITY"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1806:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2109:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1904:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1424:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1873:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2162:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1990:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF2037:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1336:
+	.string	"__MATHDECL_1"
+.LASF1258:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF2055:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2374:
+	.string	"BOXLEDLOW"
+.LASF1242:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2296:
+	.string	"OWNER_USB"
+.LASF1434:
+	.string	"VTX_TRAMP "
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1881:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1131:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1589:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2003:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF2053:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1737:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1235:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2361:
+	.string	"BOXHORIZON"
+.LASF1074:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2398:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1594:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1591:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2317:
+	.string	"pidSumLimit"
+.LASF2324:
+	.string	"horizon_tilt_effect"
+.LASF1255:
+	.string	"__DECL_SIMD_log2f"
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2138:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1010:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1797:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"OWNER_USB_DETECT"
+.LASF1028:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1934:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1972:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1608:
+	.string	"PG_PID_PROFILE 14"
+.LASF2312:
+	.string	"dterm_lpf_hz"
+.LASF1896:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1345:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1310:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2460:
+	.string	"SENSOR_BARO"
+.LASF1139:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1973:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2375:
+	.string	"BOXLLIGHTS"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1706:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2278:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1501:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2013:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2172:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1879:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1625:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2362:
+	.string	"BOXBARO"
+.LASF1223:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2103:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1704:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2266:
+	.string	"OWNER_SERVO"
+.LASF1716:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1454:
+	.string	"ACC "
+.LASF2378:
+	.string	"BOXOSD"
+.LASF1184:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1607:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1477:
+	.string	"STACK_CHECK"
+.LASF2409:
+	.string	"flightModeFlags_e"
+.LASF1420:
+	.string	"TELEMETRY_IBUS "
+.LASF1399:
+	.string	"USE_PWM "
+.LASF1035:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF1479:
+	.string	"TELEMETRY_LTM"
+.LASF2144:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1824:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2194:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1278:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1770:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1754:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2520:
+	.string	"accZ_old"
+.LASF2143:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2230:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF969:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1167:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1583:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1757:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2206:
+	.string	"long unsigned int"
+.LASF905:
+	.string	"alloca"
+.LASF1984:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2428:
+	.string	"roll"
+.LASF1525:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1821:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1481:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2185:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2158:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2209:
+	.string	"__int16_t"
+.LASF1064:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1988:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2315:
+	.string	"dterm_notch_cutoff"
+.LASF2235:
+	.string	"DEBUG_NOTCH"
+.LASF2211:
+	.string	"__uint16_t"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2125:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2265:
+	.string	"OWNER_MOTOR"
+.LASF1036:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1541:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1533:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2100:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2364:
+	.string	"BOXMAG"
+.LASF364:
+	.string	"__k8 1"
+.LASF1565:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2292:
+	.string	"OWNER_RX_SPI_CS"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF1081:
+	.string	"__DECL_SIMD_log10f "
+.LASF944:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1368:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2133:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1006:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1178:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2110:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1373:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1936:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF975:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2333:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1908:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1037:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1243:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1462:
+	.string	"USE_FLASHFS "
+.LASF1816:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1686:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF2056:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1145:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1555:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1855:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF938:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF966:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1007:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2131:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1536:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF2454:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2015:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1275:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2463:
+	.string	"SENSOR_GPS"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF1024:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1335:
+	.string	"__MATHDECL_1_IMPL"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1921:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1877:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1673:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1701:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1341:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1349:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1670:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1867:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1430:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF2399:
+	.string	"HORIZON_MODE"
+.LASF1739:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2203:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1098:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1884:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1680:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1683:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1581:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1280:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1526:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2533:
+	.string	"barometerConfig"
+.LASF1945:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1194:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1453:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1438:
+	.string	"USE_NAV "
+.LASF1626:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1962:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1394:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1774:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2213:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1452:
+	.string	"USE_FAKE_LED "
+.LASF2120:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2223:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1604:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2221:
+	.string	"long long int"
+.LASF1761:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2359:
+	.string	"BOXARM"
+.LASF1909:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF1851:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2408:
+	.string	"FAILSAFE_MODE"
+.LASF1338:
+	.string	"__MATHDECL"
+.LASF1456:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1660:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1132:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2189:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF1702:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1827:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1483:
+	.string	"USE_PWM"
+.LASF1690:
+	.string	"IOCFG_OUT_OD 0"
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF993:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1518:
+	.string	"_PTRDIFF_T "
+.LASF2376:
+	.string	"BOXCALIB"
+.LASF2309:
+	.string	"pgRegistry_s"
+.LASF2260:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1182:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1538:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1571:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1260:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1089:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2245:
+	.string	"DEBUG_ALTITUDE"
+.LASF1551:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2372:
+	.string	"BOXBEEPERON"
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1416:
+	.string	"USE_SERVOS "
+.LASF380:
+	.string	"__unix 1"
+.LASF1808:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2069:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2304:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1410:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2006:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1912:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2248:
+	.string	"DEBUG_FFT_FREQ"
+.LASF2342:
+	.string	"AUX1"
+.LASF2343:
+	.string	"AUX2"
+.LASF983:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2345:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2347:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2349:
+	.string	"AUX8"
+.LASF1611:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2538:
+	.string	"high"
+.LASF1322:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2198:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF1842:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2339:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1963:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1407:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2171:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1544:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1820:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2287:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF2049:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2059:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF866:
+	.string	"__NFDBITS"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2353:
+	.string	"yaw_deadband"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1710:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1031:
+	.string	"__DECL_SIMD_coshf "
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1880:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF2325:
+	.string	"horizon_tilt_expert_mode"
+.LASF1104:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1944:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1927:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1758:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1009:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1864:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF2239:
+	.string	"DEBUG_ANGLERATE"
+.LASF1789:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1870:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2251:
+	.string	"PGR_PGN_MASK"
+.LASF2382:
+	.string	"BOXSERVO1"
+.LASF2383:
+	.string	"BOXSERVO2"
+.LASF2384:
+	.string	"BOXSERVO3"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1309:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2474:
+	.string	"calculate"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1312:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1793:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF1440:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF2079:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2008:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1631:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF919:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1082:
+	.string	"__DECL_SIMD_log10l "
+.LASF2225:
+	.string	"debug"
+.LASF398:
+	.string	"false 0"
+.LASF2106:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF1387:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2091:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2019:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1741:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2201:
+	.string	"BARO_UPDATE_FREQUENCY_40HZ (1000 * 25)"
+.LASF2465:
+	.string	"baroOpFuncPtr"
+.LASF1667:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1848:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1755:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__DECL_SIMD_erfcf"
+.LASF2050:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF910:
+	.string	"__DECL_SIMD_cos "
+.LASF1181:
+	.string	"__DECL_SIMD_cos"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1175:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1069:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2176:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1088:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2040:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_asinf "
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1514:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2489:
+	.string	"estimatedVario"
+.LASF1687:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2256:
+	.string	"size"
+.LASF1398:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1788:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1651:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1276:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF2401:
+	.string	"BARO_MODE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1342:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1448:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1800:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1183:
+	.string	"__DECL_SIMD_cosf"
+.LASF1326:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1229:
+	.string	"__DECL_SIMD_cosh"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF958:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1115:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1228:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF911:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2407:
+	.string	"SONAR_MODE"
+.LASF2083:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1580:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1539:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1579:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1379:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2242:
+	.string	"DEBUG_STACK"
+.LASF2301:
+	.string	"OWNER_INVERTER"
+.LASF2525:
+	.string	"error"
+.LASF2154:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2168:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2282:
+	.string	"OWNER_SPI_MOSI"
+.LASF1857:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2062:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2400:
+	.string	"MAG_MODE"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1883:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2218:
+	.string	"uint8_t"
+.LASF1301:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2150:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1738:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1823:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1850:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1316:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1708:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2456:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1891:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"TELEMETRY "
+.LASF1898:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF976:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1763:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1264:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1282:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF963:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1130:
+	.string	"__DECL_SIMD_erf "
+.LASF2340:
+	.string	"PITCH"
+.LASF1933:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1557:
+	.string	"VERY_FAST_MATH "
+.LASF2085:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"USE_ADC"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2434:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2379:
+	.string	"BOXTELEMETRY"
+.LASF1366:
+	.string	"MATH_ERRNO 1"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1495:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2001:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2397:
+	.string	"boxId_e"
+.LASF1859:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF699:
+	.string	"__need_size_t "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF1030:
+	.string	"__DECL_SIMD_cosh "
+.LASF1348:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF920:
+	.string	"__DECL_SIMD_sin "
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1939:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1498:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF2152:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1116:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1281:
+	.string	"__DECL_SIMD_erfc"
+.LASF1078:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2528:
+	.string	"isThrustFacingDownwards"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2485:
+	.string	"BaroAlt"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2122:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1204:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1889:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1728:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1286:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2264:
+	.string	"OWNER_PPMINPUT"
+.LASF1693:
+	.string	"IOCFG_IPD 0"
+.LASF1528:
+	.string	"__need_ptrdiff_t"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF2322:
+	.string	"levelAngleLimit"
+.LASF994:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1291:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1389:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2542:
+	.string	"applyFixedWingAltHold"
+.LASF1032:
+	.string	"__DECL_SIMD_coshl "
+.LASF1570:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2075:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1330:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1629:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1515:
+	.string	"_STDDEF_H "
+.LASF2018:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1117:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2452:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2025:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1759:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1861:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2033:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2107:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1396:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1657:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2486:
+	.string	"baroTemperature"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1845:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF948:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1882:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2159:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1955:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1655:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1319:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1619:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1846:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1540:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1586:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2473:
+	.string	"get_up"
+.LASF2153:
+	.string	"PIDSUM_LIMIT 500"
+.LASF1066:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2471:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF2170:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1809:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2466:
+	.string	"baroCalculateFuncPtr"
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1980:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2390:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1743:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1948:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1862:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1826:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1853:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2446:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF2246:
+	.string	"DEBUG_FFT"
+.LASF1668:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1492:
+	.string	"LED_STRIP"
+.LASF1992:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1067:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1248:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+.LASF923:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1766:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2541:
+	.string	"calculateEstimatedAltitude"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF2447:
+	.string	"pidCrashRecovery_e"
+.LASF2232:
+	.string	"DEBUG_MIXER"
+.LASF1762:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2388:
+	.string	"BOX3DDISABLE"
+.LASF2494:
+	.string	"pgResetTemplate_airplaneConfig"
+.LASF2316:
+	.string	"itermWindupPointPercent"
+.LASF1489:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1903:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1490:
+	.string	"USE_SERIALRX_SUMH"
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF1075:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1005:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1206:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1412:
+	.string	"TELEMETRY_FRSKY "
+.LASF2395:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF1732:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1171:
+	.string	"__DECL_SIMD_tanf "
+.LASF1979:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1666:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2459:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2277:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2257:
+	.string	"address"
+.LASF1805:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1328:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1917:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1977:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1863:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2118:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF2455:
+	.string	"SENSOR_INDEX_BARO"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1321:
+	.string	"_Mdouble_ long double"
+.LASF912:
+	.string	"__DECL_SIMD_cosl "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2531:
+	.string	"applyAltHold"
+.LASF1892:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF1451:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF739:
+	.string	"NULL"
+.LASF1445:
+	.string	"U_ID_0 0"
+.LASF2411:
+	.string	"GPS_FIX_HOME"
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF2429:
+	.string	"pitch"
+.LASF1566:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF2279:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1642:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1818:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1108:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1535:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2331:
+	.string	"rateAccelLimit"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2310:
+	.string	"pidProfile_s"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2066:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1441:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1643:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2076:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2521:
+	.string	"vel_acc"
+.LASF1391:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1372:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2358:
+	.string	"rcControlsConfig_System"
+.LASF1091:
+	.string	"__DECL_SIMD_log2f "
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2029:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1333:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1140:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2519:
+	.string	"vel_tmp"
+.LASF2147:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1906:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2254:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1358:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1601:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2071:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1253:
+	.string	"__DECL_SIMD_log2"
+.LASF814:
+	.string	"__off_t_defined "
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1494:
+	.string	"TELEMETRY_HOTT"
+.LASF981:
+	.string	"__DECL_SIMD_atanf "
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2269:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2035:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF1231:
+	.string	"__DECL_SIMD_coshf"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2229:
+	.string	"DEBUG_BATTERY"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1839:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"UNIT_TESTED "
+.LASF2420:
+	.string	"fixedwing_althold_reversed"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1609:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF2199:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF989:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1195:
+	.string	"__DECL_SIMD_logf"
+.LASF1208:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2509:
+	.string	"disableFlightMode"
+.LASF988:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2539:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF2130:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1595:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1584:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1388:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF1040:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1858:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1329:
+	.string	"_Mdouble_ _Float128"
+.LASF1180:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1676:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1771:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2319:
+	.string	"dterm_average_count"
+.LASF1159:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2529:
+	.string	"updateSonarAltHoldState"
+.LASF2524:
+	.string	"result"
+.LASF1817:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2043:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1463:
+	.string	"USE_FAKE_FLASH "
+.LASF1106:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1251:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2140:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1409:
+	.string	"BLACKBOX "
+.LASF1404:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2496:
+	.string	"setVelocity"
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1895:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1866:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2320:
+	.string	"vbatPidCompensation"
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pl "
+.LASF984:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2412:
+	.string	"GPS_FIX"
+.LASF1750:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF934:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF741:
+	.string	"__need_NULL"
+.LASF1107:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2350:
+	.string	"rcCommand"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1350:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1331:
+	.string	"_Mdouble_ _Float32x"
+.LASF1550:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1810:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1791:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF996:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1751:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF964:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1095:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1502:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF980:
+	.string	"__DECL_SIMD_atan "
+.LASF2126:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF1026:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1961:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1465:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1337:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1893:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"reset"
+.LASF1245:
+	.string	"__DECL_SIMD_atan2"
+.LASF2222:
+	.string	"long long unsigned int"
+.LASF1602:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1698:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1852:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2404:
+	.string	"HEADFREE_MODE"
+.LASF997:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2285:
+	.string	"OWNER_SDCARD"
+.LASF1383:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1100:
+	.string	"__DECL_SIMD_log1p "
+.LASF1804:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2479:
+	.string	"baro_noise_lpf"
+.LASF1172:
+	.string	"__DECL_SIMD_tanl "
+.LASF1027:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2080:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1367:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1803:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1547:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2508:
+	.string	"enableFlightMode"
+.LASF2216:
+	.string	"int16_t"
+.LASF1832:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1975:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2204:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1645:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2207:
+	.string	"signed char"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1578:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF945:
+	.string	"__DECL_SIMD_logf64 "
+.LASF928:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2227:
+	.string	"DEBUG_NONE"
+.LASF1044:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1414:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1353:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1415:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1446:
+	.string	"U_ID_1 1"
+.LASF1279:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1475:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1469:
+	.string	"USE_UART4 "
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF2023:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1610:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2128:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2418:
+	.string	"AltHold"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1124:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1128:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1554:
+	.string	"sq(x) ((x)*(x))"
+.LASF940:
+	.string	"__DECL_SIMD_log "
+.LASF1096:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1226:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1718:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1576:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1986:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1506:
+	.string	"VTX_TRAMP"
+.LASF2137:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2004:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1504:
+	.string	"VTX_CONTROL"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1478:
+	.string	"USE_DASHBOARD"
+.LASF1418:
+	.string	"TELEMETRY_LTM "
+.LASF1439:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1384:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1834:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2166:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2367:
+	.string	"BOXCAMSTAB"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF1361:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1092:
+	.string	"__DECL_SIMD_log2l "
+.LASF2163:
+	.string	"PWM_PULSE_MIN 750"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2119:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1618:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1193:
+	.string	"__DECL_SIMD_log"
+.LASF2461:
+	.string	"SENSOR_MAG"
+.LASF1436:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1376:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1510:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2450:
+	.string	"SystemCoreClock"
+.LASF1209:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1929:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2387:
+	.string	"BOXAIRMODE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1534:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1511:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1622:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1323:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2024:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1263:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1781:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1517:
+	.string	"_ANSI_STDDEF_H "
+.LASF1605:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1677:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1831:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2299:
+	.string	"OWNER_OSD"
+.LASF936:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1783:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1995:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2078:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2252:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF946:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2044:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1996:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"__DECL_SIMD_expf"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1661:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2365:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1375:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1746:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1890:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2145:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1292:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2192:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1402:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1726:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF937:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1320:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1937:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1126:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1433:
+	.string	"VTX_SMARTAUDIO "
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF2116:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2157:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1552:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1624:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2327:
+	.string	"itermAcceleratorGain"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1357:
+	.string	"FP_ZERO 2"
+.LASF2335:
+	.string	"crash_recovery_angle"
+.LASF2439:
+	.string	"PID_NAVR"
+.LASF1835:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF2478:
+	.string	"baro_sample_count"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1947:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1487:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2104:
+	.string	"I2CDEV_COUNT 4"
+.LASF953:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2136:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1752:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1773:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1674:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1950:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1213:
+	.string	"__DECL_SIMD_asin"
+.LASF2186:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1647:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1097:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1437:
+	.string	"GPS "
+.LASF2187:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1234:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2421:
+	.string	"airplaneConfig_t"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2480:
+	.string	"baro_cf_vel"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2416:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1592:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1733:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1621:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1057:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2214:
+	.string	"long int"
+.LASF2392:
+	.string	"BOXCAMERA2"
+.LASF2393:
+	.string	"BOXCAMERA3"
+.LASF1217:
+	.string	"__DECL_SIMD_hypot"
+.LASF1614:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1187:
+	.string	"__DECL_SIMD_sinf"
+.LASF1918:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2156:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1659:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1744:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2097:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2422:
+	.string	"airplaneConfig_System"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1129:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1056:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2275:
+	.string	"OWNER_PINDEBUG"
+.LASF2123:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2507:
+	.string	"applyDeadband"
+.LASF1105:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2067:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2337:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1901:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1837:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2142:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1250:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1419:
+	.string	"TELEMETRY_CRSF "
+.LASF2241:
+	.string	"DEBUG_SCHEDULER"
+.LASF1522:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1672:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1794:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2464:
+	.string	"SENSOR_GPSMAG"
+.LASF1807:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2505:
+	.string	"lrintf"
+.LASF1813:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"__PTRDIFF_T "
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1305:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1932:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2427:
+	.string	"accSum"
+.LASF1966:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1764:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"__DECL_SIMD_acosf"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1699:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1707:
+	.string	"EXPAND_I(x) x"
+.LASF1593:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1926:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2498:
+	.string	"errorVelocityI"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1496:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1311:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2424:
+	.string	"accTimeSum"
+.LASF2220:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF2425:
+	.string	"accSumCount"
+.LASF1189:
+	.string	"__DECL_SIMD_sincos"
+.LASF992:
+	.string	"__DECL_SIMD_asinl "
+.LASF1715:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2041:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2522:
+	.string	"lastBaroAlt"
+.LASF1262:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1272:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1378:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1531:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2005:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"__DECL_SIMD_log2 "
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1224:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1940:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1801:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2177:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF1109:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2370:
+	.string	"BOXGPSHOLD"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1968:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1119:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1562:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1658:
+	.string	"PG_PID_CONFIG 504"
+.LASF1148:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2011:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2127:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1957:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF960:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1493:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1374:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2366:
+	.string	"BOXHEADADJ"
+.LASF2514:
+	.string	"dTime"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2226:
+	.string	"debugMode"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF1682:
+	.string	"IO_TAG_NONE 0"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1597:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1442:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF929:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1925:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF2369:
+	.string	"BOXGPSHOME"
+.LASF2318:
+	.string	"pidSumLimitYaw"
+.LASF2276:
+	.string	"OWNER_TIMER"
+.LASF1356:
+	.string	"FP_INFINITE 1"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1638:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1392:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2329:
+	.string	"dtermSetpointWeight"
+.LASF1688:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2512:
+	.string	"getEstimatedAltitude"
+.LASF2502:
+	.string	"performBaroCalibrationCycle"
+.LASF1459:
+	.string	"USE_FAKE_MAG "
+.LASF1314:
+	.string	"_Mdouble_"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2532:
+	.string	"isAltHoldChanged"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1203:
+	.string	"__DECL_SIMD_powf"
+.LASF2063:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1435:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2215:
+	.string	"char"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2115:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1086:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2105:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2332:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF2084:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2096:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1256:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF1956:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"airplaneConfig_s"
+.LASF916:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1691:
+	.string	"IOCFG_AF_PP 0"
+.LASF2124:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1786:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1486:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1000:
+	.string	"__DECL_SIMD_hypot "
+.LASF1296:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1951:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF2373:
+	.string	"BOXLEDMAX"
+.LASF2385:
+	.string	"BOXBLACKBOX"
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF2481:
+	.string	"baro_cf_alt"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF915:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1087:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF979:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1778:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1681:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1905:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2288:
+	.string	"OWNER_FLASH_CS"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1491:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1427:
+	.string	"USE_RX_MSP "
+.LASF1935:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1700:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1499:
+	.string	"TELEMETRY_IBUS"
+.LASF397:
+	.string	"true 1"
+.LASF1970:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF917:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1843:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2134:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2506:
+	.string	"sensors"
+.LASF971:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1910:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2517:
+	.string	"accZ_tmp"
+.LASF2314:
+	.string	"dterm_notch_hz"
+.LASF1154:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2234:
+	.string	"DEBUG_PIDLOOP"
+.LASF2258:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1219:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2169:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1230:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1390:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1484:
+	.string	"SERIAL_RX"
+.LASF1548:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2311:
+	.string	"dterm_filter_type"
+.LASF2380:
+	.string	"BOXGTUNE"
+.LASF1630:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2433:
+	.string	"PID_ROLL"
+.LASF1166:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF995:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1127:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2402:
+	.string	"GPS_HOME_MODE"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1887:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1635:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1505:
+	.string	"VTX_SMARTAUDIO"
+.LASF1403:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2280:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1426:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2272:
+	.string	"OWNER_ADC_RSSI"
+.LASF1572:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1252:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1998:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1897:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2497:
+	.string	"velocityControl"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF1220:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF925:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f "
+.LASF954:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2146:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2360:
+	.string	"BOXANGLE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2477:
+	.string	"baro_hardware"
+.LASF1365:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2386:
+	.string	"BOXFAILSAFE"
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1724:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1076:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1520:
+	.string	"_T_PTRDIFF "
+.LASF985:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1815:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1212:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1120:
+	.string	"__DECL_SIMD_acosh "
+.LASF2183:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1284:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2283:
+	.string	"OWNER_I2C_SCL"
+.LASF2308:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2180:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF2121:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1455:
+	.string	"USE_FAKE_ACC "
+.LASF2476:
+	.string	"barometerConfig_s"
+.LASF2482:
+	.string	"barometerConfig_t"
+.LASF377:
+	.string	"__linux 1"
+.LASF1352:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2042:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1978:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1385:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1924:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2336:
+	.string	"crash_recovery_rate"
+.LASF1355:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF2238:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF1077:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2073:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1033:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1371:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1222:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1888:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2515:
+	.string	"accAlt"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1176:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1303:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1267:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2081:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2095:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1165:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1246:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1351:
+	.string	"__MATHCALL_NARROW"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF2341:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2233:
+	.string	"DEBUG_AIRMODE"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1192:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2022:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF970:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1907:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1546:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1065:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1913:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1830:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1254:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1712:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1588:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1719:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2468:
+	.string	"ut_delay"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2228:
+	.string	"DEBUG_CYCLETIME"
+.LASF2243:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1332:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1393:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1290:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1812:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1202:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1946:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1405:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1397:
+	.string	"USE_CLI_BATCH "
+.LASF1989:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF2202:
+	.string	"DEGREES_80_IN_DECIDEGREES 800"
+.LASF1765:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1711:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF973:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1070:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1819:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2281:
+	.string	"OWNER_SPI_MISO"
+.LASF1776:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2305:
+	.string	"OWNER_COMPASS_CS"
+.LASF1457:
+	.string	"USE_FAKE_GYRO "
+.LASF1900:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1598:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1147:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1018:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF2414:
+	.string	"SMALL_ANGLE"
+.LASF2064:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1543:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2351:
+	.string	"rcControlsConfig_s"
+.LASF2357:
+	.string	"rcControlsConfig_t"
+.LASF1370:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1675:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2396:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2212:
+	.string	"__int32_t"
+.LASF1297:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2284:
+	.string	"OWNER_I2C_SDA"
+.LASF2182:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2377:
+	.string	"BOXGOV"
+.LASF2354:
+	.string	"alt_hold_deadband"
+.LASF1564:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1158:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1343:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2002:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1685:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1941:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1615:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1568:
+	.string	"Q12 (1 << 12)"
+.LASF2510:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1271:
+	.string	"__DECL_SIMD_erff"
+.LASF2047:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2488:
+	.string	"baro"
+.LASF1288:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF972:
+	.string	"__DECL_SIMD_acosl "
+.LASF1617:
+	.string	"PG_RX_CONFIG 24"
+.LASF1644:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1623:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1582:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1198:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2415:
+	.string	"FIXED_WING"
+.LASF1150:
+	.string	"__DECL_SIMD_asinh "
+.LASF1671:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1268:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1306:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF2467:
+	.string	"baroDev_s"
+.LASF961:
+	.string	"__DECL_SIMD_powf "
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1308:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF1713:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF967:
+	.string	"__DECL_SIMD_powf32x "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2082:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1993:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1841:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2197:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF998:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1516:
+	.string	"_STDDEF_H_ "
+.LASF1731:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1527:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF990:
+	.string	"__DECL_SIMD_asin "
+.LASF2098:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2445:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF2099:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF2423:
+	.string	"airplaneConfig_Copy"
+.LASF2472:
+	.string	"start_up"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1339:
+	.string	"__MATHCALL"
+.LASF1084:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1878:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1976:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1227:
+	.string	"__DECL_SIMD_exp10f"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF1678:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF2031:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2440:
+	.string	"PID_LEVEL"
+.LASF1386:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1916:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1649:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1137:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1432:
+	.string	"VTX_CONTROL "
+.LASF1110:
+	.string	"__DECL_SIMD_atanh "
+.LASF2344:
+	.string	"AUX3"
+.LASF1987:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2303:
+	.string	"OWNER_TRANSPONDER"
+.LASF1616:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2346:
+	.string	"AUX5"
+.LASF1298:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2348:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1833:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2410:
+	.string	"flightModeFlags"
+.LASF1779:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1949:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2328:
+	.string	"setpointRelaxRatio"
+.LASF1560:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2540:
+	.string	"rc_alias"
+.LASF1523:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1215:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1277:
+	.string	"__DECL_SIMD_asinh"
+.LASF1959:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2175:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF2389:
+	.string	"BOXFPVANGLEMIX"
+.LASF1039:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1210:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF1240:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF935:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF986:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1787:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1799:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2511:
+	.string	"getEstimatedVario"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2417:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2530:
+	.string	"updateAltHoldState"
+.LASF2475:
+	.string	"baroDev_t"
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF1652:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF1079:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2188:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF965:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2151:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1266:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1983:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF931:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2250:
+	.string	"pgn_t"
+.LASF1663:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2160:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2046:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1507:
+	.string	"USE_I2C"
+.LASF987:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2356:
+	.string	"yaw_control_reversed"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1458:
+	.string	"MAG "
+.LASF2526:
+	.string	"setVel"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2236:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF927:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1720:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1289:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1590:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1772:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1472:
+	.string	"USE_UART7 "
+.LASF2065:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2321:
+	.string	"pidAtMinThrottle"
+.LASF2048:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2535:
+	.string	"rcControlsConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1532:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1324:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1749:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1599:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1186:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1563:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1721:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2438:
+	.string	"PID_POSR"
+.LASF1038:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1045:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1911:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1930:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1899:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1876:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1149:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2262:
+	.string	"OWNER_FREE"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1767:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1034:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1008:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2442:
+	.string	"PID_VEL"
+.LASF1125:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2240:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1553:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1838:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2034:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1919:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1822:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1679:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2501:
+	.string	"imuResetAccelerationSum"
+.LASF2263:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1854:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2087:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF968:
+	.string	"__DECL_SIMD_powf64x "
+.LASF918:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2129:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1952:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1573:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2195:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF982:
+	.string	"__DECL_SIMD_atanl "
+.LASF1473:
+	.string	"USE_UART8 "
+.LASF1943:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1836:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1512:
+	.string	"DEFIO_NO_PORTS "
+.LASF1782:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1524:
+	.string	"___int_ptrdiff_t_h "
+.LASF1542:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1080:
+	.string	"__DECL_SIMD_log10 "
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1093:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1790:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1136:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1019:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2108:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2334:
+	.string	"crash_time"
+.LASF921:
+	.string	"__DECL_SIMD_sinf "
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2503:
+	.string	"baroCalculateAltitude"
+.LASF2086:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF974:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2184:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2196:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2462:
+	.string	"SENSOR_SONAR"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1238:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1769:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF962:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF819:
+	.string	"__key_t_defined "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1974:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF2491:
+	.string	"DEBUG_ALTITUDE_ACC"
+.LASF1689:
+	.string	"IOCFG_OUT_PP 0"
+.LASF2179:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2231:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1144:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF1444:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1603:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2286:
+	.string	"OWNER_SDCARD_CS"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1327:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1999:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF2244:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1575:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2009:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2469:
+	.string	"up_delay"
+.LASF1567:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2432:
+	.string	"attitude"
+.LASF1991:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2458:
+	.string	"SENSOR_GYRO"
+.LASF1334:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1400:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1745:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1730:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1485:
+	.string	"USE_SERIALRX_CRSF"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1466:
+	.string	"USE_UART1 "
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1735:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2068:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1954:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2014:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2045:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2394:
+	.string	"BOXDSHOTREVERSE"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1792:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2114:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2355:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1664:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2307:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1965:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1474:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1002:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF913:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1406:
+	.string	"USE_SERIALRX_SUMH "
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1825:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2431:
+	.string	"attitudeEulerAngles_t"
+.LASF1723:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2302:
+	.string	"OWNER_LED_STRIP"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1467:
+	.string	"USE_UART2 "
+.LASF1431:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2437:
+	.string	"PID_POS"
+.LASF2441:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2504:
+	.string	"isBaroCalibrationComplete"
+.LASF1269:
+	.string	"__DECL_SIMD_erf"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1922:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2405:
+	.string	"UNUSED_MODE"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF932:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1920:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2090:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1295:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2457:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2210:
+	.string	"short int"
+.LASF2165:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1634:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2330:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1753:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2l "
+.LASF949:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1468:
+	.string	"USE_UART3 "
+.LASF1307:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2518:
+	.string	"baroVel"
+.LASF2527:
+	.string	"calculateAltHoldThrottleAdjustment"
+.LASF1785:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1637:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF2313:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1464:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1247:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1585:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1201:
+	.string	"__DECL_SIMD_pow"
+.LASF2436:
+	.string	"PID_ALT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2289:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2255:
+	.string	"pgResetFunc"
+.LASF1654:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1559:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2290:
+	.string	"OWNER_MPU_CS"
+.LASF2205:
+	.string	"unsigned int"
+.LASF2453:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1004:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2101:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2493:
+	.string	"DEBUG_ALTITUDE_HEIGHT"
+.LASF2094:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2174:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1725:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2492:
+	.string	"DEBUG_ALTITUDE_VEL"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f "
+.LASF930:
+	.string	"__DECL_SIMD_sincos "
+.LASF1627:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF2032:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1142:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1814:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2371:
+	.string	"BOXPASSTHRU"
+.LASF1197:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2490:
+	.string	"estimatedAltitude"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1662:
+	.string	"PG_PWM_CONFIG 508"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1969:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2268:
+	.string	"OWNER_ADC"
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2294:
+	.string	"OWNER_MPU_EXTI"
+.LASF2352:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1196:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF956:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2247:
+	.string	"DEBUG_FFT_TIME"
+.LASF2054:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2326:
+	.string	"itermThrottleThreshold"
+.LASF2191:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF2368:
+	.string	"BOXCAMTRIG"
+.LASF2000:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1470:
+	.string	"USE_UART5 "
+.LASF2017:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1606:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF2406:
+	.string	"PASSTHRU_MODE"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1697:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1500:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1768:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2271:
+	.string	"OWNER_ADC_EXT"
+.LASF1162:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1915:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2072:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1653:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2155:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1191:
+	.string	"__DECL_SIMD_sincosf"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1931:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2291:
+	.string	"OWNER_OSD_CS"
+.LASF2537:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2058:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2448:
+	.string	"pid8_s"
+.LASF2449:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1938:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1369:
+	.string	"M_E 2.7182818284590452354"
+.LASF1694:
+	.string	"IOCFG_IPU 0"
+.LASF1828:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2051:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1734:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1221:
+	.string	"__DECL_SIMD_exp2"
+.LASF1156:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1471:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1709:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF2112:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2641:
+	.string	"rx_pwm.h"
+.LASF2617:
+	.string	"thread-shared-types.h"
+.LASF2557:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2627:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2559:
+	.string	"/usr/include"
+.LASF2631:
+	.string	"mathcalls-helper-functions.h"
+.LASF2659:
+	.string	"voltage_ids.h"
+.LASF2608:
+	.string	"endianness.h"
+.LASF2602:
+	.string	"floatn-common.h"
+.LASF2593:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/flight/altitude.c"
+.LASF2573:
+	.string	"altitude.h"
+.LASF2543:
+	.string	"src/main/build"
+.LASF2556:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2578:
+	.string	"barometer.h"
+.LASF2583:
+	.string	"stdbool.h"
+.LASF2640:
+	.string	"flash.h"
+.LASF2644:
+	.string	"io.h"
+.LASF2572:
+	.string	"time.h"
+.LASF2611:
+	.string	"select.h"
+.LASF2580:
+	.string	"mathcalls.h"
+.LASF2616:
+	.string	"pthreadtypes.h"
+.LASF2650:
+	.string	"sound_beeper.h"
+.LASF2637:
+	.string	"parameter_group_ids.h"
+.LASF2555:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2585:
+	.string	"libc-header-start.h"
+.LASF2606:
+	.string	"timer_t.h"
+.LASF2552:
+	.string	"src/main/target/SITL"
+.LASF2632:
+	.string	"platform.h"
+.LASF2560:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2546:
+	.string	"src/main/drivers/barometer"
+.LASF2566:
+	.string	"resource.h"
+.LASF2549:
+	.string	"src/main/flight"
+.LASF2574:
+	.string	"imu.h"
+.LASF2651:
+	.string	"vcd.h"
+.LASF2564:
+	.string	"debug.h"
+.LASF2582:
+	.string	"stdc-predef.h"
+.LASF2642:
+	.string	"sdcard.h"
+.LASF2625:
+	.string	"math.h"
+.LASF2607:
+	.string	"endian.h"
+.LASF2655:
+	.string	"filter.h"
+.LASF2586:
+	.string	"features.h"
+.LASF2554:
+	.string	"src/main"
+.LASF2579:
+	.string	"altitude.c"
+.LASF2626:
+	.string	"math-vector.h"
+.LASF2652:
+	.string	"sonar.h"
+.LASF2588:
+	.string	"wordsize.h"
+.LASF2587:
+	.string	"features-time64.h"
+.LASF2621:
+	.string	"struct_rwlock.h"
+.LASF2571:
+	.string	"runtime_config.h"
+.LASF2568:
+	.string	"config.h"
+.LASF2629:
+	.string	"fp-logb.h"
+.LASF2595:
+	.string	"time64.h"
+.LASF2599:
+	.string	"waitflags.h"
+.LASF2575:
+	.string	"target.h"
+.LASF2645:
+	.string	"io_def.h"
+.LASF2633:
+	.string	"common_fc_pre.h"
+.LASF2581:
+	.string	"maths.h"
+.LASF2600:
+	.string	"waitstatus.h"
+.LASF2548:
+	.string	"src/main/fc"
+.LASF2596:
+	.string	"wchar.h"
+.LASF2589:
+	.string	"timesize.h"
+.LASF2544:
+	.string	"src/main/common"
+.LASF2658:
+	.string	"voltage.h"
+.LASF2576:
+	.string	"rx.h"
+.LASF2656:
+	.string	"current.h"
+.LASF2558:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2609:
+	.string	"byteswap.h"
+.LASF2649:
+	.string	"rcc_types.h"
+.LASF2605:
+	.string	"time_t.h"
+.LASF2598:
+	.string	"stddef.h"
+.LASF2630:
+	.string	"fp-fast.h"
+.LASF2601:
+	.string	"floatn.h"
+.LASF2648:
+	.string	"bus_i2c.h"
+.LASF2619:
+	.string	"atomic_wide_counter.h"
+.LASF2592:
+	.string	"stubs.h"
+.LASF2565:
+	.string	"parameter_group.h"
+.LASF2567:
+	.string	"pid.h"
+.LASF2647:
+	.string	"io_def_generated.h"
+.LASF2657:
+	.string	"current_ids.h"
+.LASF2646:
+	.string	"utils.h"
+.LASF2610:
+	.string	"uintn-identity.h"
+.LASF2577:
+	.string	"sensors.h"
+.LASF2604:
+	.string	"clockid_t.h"
+.LASF2570:
+	.string	"rc_modes.h"
+.LASF2563:
+	.string	"stdint-uintn.h"
+.LASF2603:
+	.string	"clock_t.h"
+.LASF2638:
+	.string	"adc.h"
+.LASF2591:
+	.string	"long-double.h"
+.LASF2569:
+	.string	"rc_controls.h"
+.LASF2654:
+	.string	"battery.h"
+.LASF2590:
+	.string	"cdefs.h"
+.LASF2584:
+	.string	"stdint.h"
+.LASF2628:
+	.string	"flt-eval-method.h"
+.LASF2550:
+	.string	"src/main/rx"
+.LASF2594:
+	.string	"typesizes.h"
+.LASF2653:
+	.string	"sonar_hcsr04.h"
+.LASF2634:
+	.string	"common_fc_post.h"
+.LASF2553:
+	.string	"src/main/target"
+.LASF2635:
+	.string	"axis.h"
+.LASF2547:
+	.string	"src/main/drivers"
+.LASF2612:
+	.string	"sigset_t.h"
+.LASF2643:
+	.string	"serial.h"
+.LASF2624:
+	.string	"stdlib-float.h"
+.LASF2597:
+	.string	"stdlib.h"
+.LASF2615:
+	.string	"struct_timespec.h"
+.LASF2636:
+	.string	"build_config.h"
+.LASF2614:
+	.string	"struct_timeval.h"
+.LASF2551:
+	.string	"src/main/sensors"
+.LASF2562:
+	.string	"stdint-intn.h"
+.LASF2622:
+	.string	"alloca.h"
+.LASF2545:
+	.string	"src/main/config"
+.LASF2561:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2620:
+	.string	"struct_mutex.h"
+.LASF2623:
+	.string	"stdlib-bsearch.h"
+.LASF2618:
+	.string	"pthreadtypes-arch.h"
+.LASF2639:
+	.string	"io_types.h"
+.LASF2613:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`d\001E\n"
+	.string	"\264\fX\002"
+	.string	"!"
+	.string	"\301\306\235\262\0176\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\002"
+	.string	"\002"
+	.string	"\002\005\002\006\004"
+	.string	"\003\240\342\234\212\n\004\352\263\360\321\b\005\007\b\t\n\013\f\352\311\246]\b\002\007\002\b\005\002\006\r\016\311\206\336\253\017"
+	.string	"\017\373\214\333\301\001"
+	.string	"\020\242\362\307\252\004\030\t\002\t\002"
+	.string	"\002\n"
+	.string	"\002\n\022\336\350\245\242\005\002\024\212\312\313\307\017\016\002\013\002\013\004\002\004\026\204\261\263\202\t\027\240\377\365\343\006\004\002\f\030\322\316\223\302\002\004\002\r\032\365\310\254\221\rB\002\016\005\004\002\017\013\002\020\002\004\002\021\017\002\002\022\005\002\005\033\034\035&'()\354\206\342\366\006\002*+\355\314\246\334\007,\361\312\376\322\006-./\240\342\234\212\n"
+	.string	"= \200\2029g\352Q\204\245\373v\231\275m\321X*R\334\245\033s\022\021\202:\352\rz\013\366\f_-\f!`3h\267\271\211Sl\207J\031\001,jf@\301\200\321"
+	.ascii	"\314\227|j\234\032\216\321\035\030\230\373\200p\352u\030R\260"
+	.ascii	"0%p\tx\275L\030\307\342\277$\267\220w4\226\310v\307\306F\361"
+	.ascii	"\3460\337d\016\204\335(\3160\027,\036\356\005]\340\304\177\204"
+	.ascii	"\206U\314!"
+	.text
+	.section	.gnu.lto_.ipa_sra.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 \237\265\002"
+	.string	"\202\204\f\024\240E\303\001\377\377\377\377\003\214\353\214Y3\255\305\217H\231RN\300l~F\252\365\355e\201.-\217\016i%\321E\326\320\251+\210\335a\317*\030\b\016"
+	.ascii	" HL\001\021\367^\330\220K\303\375\231\0206\252\254\316\362\032"
+	.ascii	"eG\316e~*\206b\377\006\260"
+	.text
+	.section	.gnu.lto_.inline.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`+\002M\013"
+	.string	"\006\221:8@\305\250\320\001wu_\342S|`\236\007\360LGfN.\030\2531D\202\017\330\243\366\035\307>T\027\t\256\233\226c\221\376I\tV\032\337>\313\377\366E#\215l\271S%"
+	.string	"+"
+	.string	","
+	.string	"?\246\027\231\231\372\376ihy\243\225\225\231\035-s\246\327\324\314\314\354\267\2722\023\325\307\255(\231\351\360\232Q!\003Z\237=\005G1\320\277\215\340\316OZi\260\377\314\245\246\262?5#D\300\t\004\366\367\364\256\343\251\257\024"
+	.string	"#\rs\f\376\002\022\275E\233\360rEw\342\2629\370A\217s\"\367)jP#n\3148\356!\373\324b\313\247aF"
+	.string	"\375!~\260\b\264B\270\241\n3\224\332\376\231\020{a\303\002\032\036*GR\321VG"
+	.string	"\223\3038a\322\n\377\215%\345\001Yy\225t\016a\243\261\022\2722U\227\213\215.\0264 P\002Q\b\307<\216\244\b6b/L\215`\026H8c\370\017\320\206\204\257)\234I\013\247\204\242a8\325"
+	.ascii	"8\315\257\bH\016w\276\373\266\030X\273\033\202\206tcl+\3473\243"
+	.ascii	"\247\275\177\245\231\0300\266\024\002\023.qp\301\271\337\245"
+	.ascii	"\315\342MlR\020\241Y\346\004\2176\024\r\231;hU\307\250%\235\020"
+	.ascii	"1\225D\030\030O\314c!~n0\216f\334\303\2150\333W\334!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\345\006"
+	.ascii	"\222\t\037(\220'I\007\377p\314i\325Y\363\303W\323\fN^93S\227"
+	.ascii	"\206v\n\300\263\201\246\021\353\255\265\266i\355\221\266\211"
+	.ascii	"\224)\377\363\017c`k\306\200\005\026\341@\200\300\"\310\312\351"
+	.ascii	"%\322\351\331\331\237\251U\256\262)\237f\351\211t0\f\025\310"
+	.ascii	"\244D\001&p\3757V\224\364P`\300\033Ty\264\350m\365V\257\351\001"
+	.ascii	"\220L\f\203\fZ<-Jh\021O8\240\332W\374\362'\346A, \260\2421\243"
+	.ascii	"\033\b\241;x\2070\267\313\365\230ck\217\261\354m\034d4:\002y"
+	.ascii	"\261\201-cA5\241\345\270\330)\2719\204\be\346\002\331\210\323"
+	.ascii	"\206\213CQ0F\230\257\244\r`\217\247\035\215Y\274\327`W\330\300"
+	.ascii	"\024V\030\027>\006\324m\272~@Y\351ad\303\334\316i`\b"
+	.text
+	.section	.gnu.lto_.pureconst.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\f\230\004\016\230\004\017\230\004\020\231\004\022\230"
+	.ascii	"\004\024\230\004\026\230\004\027\205\004\030\230\004\032\230"
+	.ascii	"\004)\204\004*\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\205\004"
+	.string	"b\206\023\034\240\247\205\003P\377\377\377\377\037\372M\270\373\337\375\277\261\377\366\335\356\214\224nD\312\024'\036qP\235\254\234\325x\366r\310\320cAA\340\324g*w\255\274\265\250\177\300\277y\346]P22\237\252\274\320\271\312W'\241|\320r\316T\004\033"
+	.string	"5s\256/"
+	.ascii	"\260\203\307\013\323\026\333\3143\r<1\303\356,V\320\020\362l"
+	.ascii	"\330\007\323! V\025\021dVS\244\210m\243\004\251\271\004\340\004"
+	.ascii	"N\265\003\002@\300W\021<\250\321\022Z\001\334"
+	.text
+	.section	.gnu.lto_.lto.3be6c9039492526,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_airplaneConfig_Registry.84.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\352\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\001\035?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/altitude.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_airplaneConfig.86.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\b}{\273\001"
+	.text
+	.section	.gnu.lto_applyMultirotorAltHold.92.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\342\tE,"
+	.string	"jH\274\017Fp\\N:\377\n\242\334\353_\356k\231\204\352~h\b\301\337\227\n\373\233]\221\300?\344\267\263Xp\262iJ\266#\333G\013Et\322\250\013\"\333\243;\347\030\305L\364\327{\303c\005h\177[[\263\204\220\235d\n\354"
+	.string	"\300"
+	.string	"\362"
+	.ascii	"i:c\356NZ\346\344R\244~\355\325\202e\263\254\031\357\210\332"
+	.ascii	"R\351\256]\213\256\335\022H\330\333Za\261N\274S\226\312V\321"
+	.ascii	"\275q\223[*\225Ke\227\2502\262\26122%\036v{\332\306\032j%S\244"
+	.ascii	"\003\034I'\b\36642b\341_)^(\033\205\305&\235f&S"
+	.string	"\344z\365x\203\246`O'\330\3559\\ tOs\177\320=\275OX\330\276=\3573\226\355\266\311\260T\007$l\213\212\\\232\246\304*d\2616\b\354\371\371z\274\235\016=\315z,\257\016\002\217\013\331b\203\300\036\036;\376\343\261>\035IH\272r\274\307K\372\341ucw7\314!\222\256\257\353t\020~x\365X\264\207\254\261\347\321\305M r\313\207\324z]\353\302a\016\3234\335\261=\fd\326\257\203\220\246\251\317\205\364Z\373\254m9\333S6/E\034:t\250{\306\366\365Z\353n\3451~Ni\275<\355\3224m\340M\333.P \244\244\320=_W9\204\313O9\346i\232\266\250\026\201n\375@\326\246\365:\266\251\226\213\210]\232j-\360\242\355\226*\257\330\236.\232\370r\231@\367\334j\304\006\305\3709\243_\256L[Ko\307Nf\275\202\331k\246i\232\272\006\261\177/\3756\360\273"
+	.string	"z\023\370\235\364{\370\033\311\274\217~\033\375.\372=\3407\321o\001\346=\364[\350w\320o\240\363\026\376\3769\357"
+	.string	"\350\r\340\267\317\357\340o\240y\367\240\367\017\275}\350\335\373\3153\357\335o\335o\364\367y\336\346\357z\3367\357e\240\203b\206\350,?\312\221[\237:\240:\b\363r\214[-\333\273\2024[\236X\2243>\340\244hYtl\326i\350b\361\251{e\207\306\333q\260\236\325GN\323\004\247`=0\307\253`n\033w ,\316\016\260\3025Qpzk\252\340\004\254EB%\235\3352\241=u\177\220\265\271\351\251B\266\2579\272\n\346\233\274\372\240\355\\\252\005*\f\373W\333\370L(\254m\271\340|\265W\177u\217<\nT_5\315\216ol|\246f\327X\270\200\001\003\272g\257\n\231h\005[\252{\2043~\316\3114M\317\nf\263\276\006\233"
+	.ascii	"\225pv\231P\357\332\236aZ\221!\003\272'\322\033\004\353U\333"
+	.ascii	"2M\032\234\234\320=\217\302\342\200J\2655+\230yUW\255\310\310"
+	.ascii	"\354*o\303\216\021\263\253_Su\265(\316Q\356\254\265\242u\217"
+	.ascii	"F\262>g\263\236\013f\303<y\305\034SRTS\246\212\342\210j\006K"
+	.ascii	"PQKKPQJBO)\235\230\272z\252\"\222(VU\025\241\210\256\252\236"
+	.ascii	"\252\241\224@D\241\270\242\272\032\361D\274\232\222\242\032\021"
+	.ascii	"\202H\202\352\251\212\beu\202\250d\344b\t\020V\304\253b\321\212"
+	.ascii	"\350K\032\327Lk\020S\210R\306X\263\202\004~\303g@\377\"\252\004"
+	.string	"ju\263,\223\302\2733\206f\240\022%U\003V\252\354r\207[\226TW\312\260\002\325\244\327\030V$\266\2571\240\033\r&n^K\220\336u\031\025\220j\3202I\317Q]\"\217qT\203\206\b\267\216\374\320\234k\331c-E\363\027L\0212\034\261\2113\3560\252^\265\037\233$8U3.\270\240jT\207\322\034\233d-s\370\004T\241\241*\340Y7\016\005U!\240\372S\203\204\025\350\2510@\375\311\203'\300\322F\017\200\235:E\025\200\275Wv\307\266'\306\344\215\316\233q\316\016\250E\325\001\200\345\250\201L)\021\215\314HIRPIk\300\002\021\241\"\326\001\021 )\204L\325L,\303\030\234\242\377\002U\263\2766\201\211\331\213\301\356D\373\034e\301\315\300b@\210pyWq\271vt\246uU\\OH\2601\214\352D\314\021A{\200@\255|F\360-\013\264g\027\323\243|\300\257\240\210"
+	.ascii	"D\301P\344\313K-\",`R\322\205\336\313\214\020'6\016\024\230W"
+	.ascii	"%'\"\310QQ\271\203\004\fy\b\301\227D\037\026$\200 \234\243\245"
+	.ascii	"\216\307)\177\326@9\"\314\232K\312~\t\262\207\360\362\257\251"
+	.ascii	"\200\266\337\017\220\245x|\317\2036\biFw\230\002\376\222\344"
+	.ascii	"\223\035+Q\311g\002\235\301p;8d)t\321\002?\272\342\213\276\363"
+	.ascii	"\034\311W\312\275d\272'\304\223\244b\244uox\272OT\217N\252\231"
+	.ascii	"\037\372\214eA\206D\374\307\034b\225sc`1\027X\207\301\212C\265"
+	.ascii	"\030\266\024\205\265l\243\352\274k\376\212\215\324\356p\345\332"
+	.ascii	"\224\215\0059c\022!wF\266x\233\325\336Z\216\320`^];\016\347?"
+	.ascii	"\241\0169h\344\307D:\302*\357z\262J\373t\245\270\n\362;i\233"
+	.ascii	"F\331\353\f=3\244\356\226\331\310o\342\321/^\003\260\336\343"
+	.ascii	"N2\354\375\360\006Ll#h\315uX\264=\f\027\330@\330\"\b\237\315"
+	.ascii	"\360\221H\t\3708\035c4\305\303\221\213\230G\320\347\2059\323"
+	.ascii	"\375\017\016[\346\006P\2551\265\271\364Hp\233Z\315\250\302\326"
+	.ascii	"<cB\325"
+	.text
+	.section	.gnu.lto_applyAltHold.94.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"u\n"
+	.string	"vSG:0\257\322\001\220\370\3218\214\255c\240\332\3409\270\223\013\234j\037\027B\256\021i\n\376\374\250H\021\2271\202\333\352\377^\006\221\f0\030@\336\030G!\003:\251\332'\204l\231R5"
+	.string	"4"
+	.string	"5"
+	.string	"4\343\343\275\216\356\350_v\200\322D\335\323\230\256w\031\327i7\300\332(\005LUw\200\033Y\271\354ka\222\273\230\204Z\253\2674[\367w\333\013\266\021\354s\002[k\271\325u\261g\344R\f\373]\2450\373\353\357\353c4\255\223\002\223ZY\347K\265y$\034\266o\337c\2647\036m\225\317b\365\264\334*\204\245\326\n\006\246}iJQ[R\301\352\240\356|\037\275\354\231\033-E\2659s\336\371N?\352]\275\310=\355\177\034d\302\3270\305i_\336\363O\337\275S\002\224WjO\007\006yB\f&Q$\216>\240\370\340 \0325\200\021\242\017\004\b\"\225@O\307\241D\210\004\212aH\0027\263\324\273JaV\270\260\245(\351\205\006$E9\240v>\226\303\211t\230\265K\001\022"
+	.ascii	"3\241/(F\207\241@o\037(\226\364B\017\266@\203\201\222\017W]\330"
+	.ascii	")\177\260\3075\021o\bz\\\346\230M6%\036\215A\355\001"
+	.text
+	.section	.gnu.lto_updateAltHoldState.95.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\325\001\255\020"
+	.string	"v\\iH\320\262*\035 9y\251\002a\365\201\361(\360\314\252\371\334N\004=\370\003\3011B\214\210`J\367\310|\302\333\2775l^\205\022\260\326\232*\031\003X\252\034D\035\312\037\t\3605w\247*\025\246\013R}\213{\023)S\nT"
+	.string	"N"
+	.string	"V"
+	.string	"1\233\344\230\375\343:\233\371\035\031\333\216\320\234\023\\\023\217]\306o5\346\217B\331%\315\343\227"
+	.string	"\bO\210)\214\371\006\314\234\270\311\2040\372\211h\276\237\002\030!\021\244\260\366\225\206\330v<w\005\021\322TGN\346\234\326[\030\342\036\271\355\225m\023[\033\0047\357\312\374s\243E\315\372\203\374^\320\351Q\323!\026\351\336\203\264]^\364\267\357\202\232\332\312\374\334G\273\021>S\211\330:\231n\t\373\337\\\022\266\252M\237Z\256:\252z\257>\200\021O\017\202\2379g\206\212L\035\261\207c\373\366W\0042V&\240~\0132\203\361\030+\024P(\371\030W\300HE"
+	.ascii	"\025\275\202\264-\244\n\224v)\036\3233#G,\221\246}\356\"\037"
+	.ascii	"\035\240\227\310]\323Zm8\232\016\331\317\371\013\225\177\343"
+	.ascii	"\025+\372,\371\270K\002\204\233\351\220u\207bq89=\037I\355\r"
+	.ascii	"-\372V\235V\030^`-\030K\n\204i`\265X2\200\034Z\251\026P\365r"
+	.ascii	"\001O$vuX\275@\230\313\365\002I\272\371\223\331\322$\016\007"
+	.ascii	"\006x\004\361L\316\363\200\200M\220\013\271>\357\275\024\b(("
+	.ascii	">N\267\221\"\232s2\360i\274F\004\377\346\321\022TT\344\243\334"
+	.ascii	"\003@\275\322\216E\3344 \300\002\021\231\3552 \017\203\033\366"
+	.ascii	"\307@\276\271\007\330\006y\326X\201\335#\034jL\023|x\316\325"
+	.ascii	"<\316\"\223\2317\231\320\340\310\325\372)\\\203\210\202w`\006"
+	.ascii	"~|D\223\027\356\314\355\021\373\032\007\335[k\247\273\300\242"
+	.ascii	"\350\224\337~#\271\231\227\255h0 \377\253\240]\277\337\026s\""
+	.ascii	"Al\330\240$O\355)(@\373h\fy\017"
+	.text
+	.section	.gnu.lto_updateSonarAltHoldState.96.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\327\001\325\020"
+	.string	"\306\234jH\340\262(\035\300\236\211\251\353g(\232\bH.\335\222\342!:\226@\fSN\241\222&z;y\336\364\006\372\277_\003\221YRb?\345\251\261\212\253\240\300P\020py,\324\355:\013\310\232\310\206\372\324G\033{\023)S\nU"
+	.string	"N"
+	.string	"W"
+	.ascii	"(b6\3111\233\307kf\346qt6\034\2409'\270&\036\273\214\337j\314"
+	.ascii	"\037\205\262K\334\343G\342C\007\210)\204\371\006\304\234\270"
+	.ascii	"}\b_\364\023\341\276_\202\027\240\021\244\260\366\225\202l7\276"
+	.ascii	"\273\202\bi\252!&sN\353-\fq\207\334\366\312v\211\255\f\002\372"
+	.ascii	"\233we\306\021#\205\314\332\203\374Z\270\321Q\323 \213\224\300"
+	.ascii	";H\273\305E\177\373*\220\251\255\314\337}\304\253\3213U\310\256"
+	.ascii	"\221\351\226\260\377\315%a\253\332\364\251\345\252\243\252\367"
+	.ascii	"\352\003 \341xHz\314\031\323\033\2326\342\016\215\355\333\017"
+	.ascii	"9*\022P\277\375\230\2558\013\225\t(\224|\214+`4\024@\277y\n\322"
+	.ascii	"\256\2202P\342\t\035\206\247\005\2158\"M\373\335E=7>\337\374"
+	.ascii	"\210\3345\255\325\226\243i\317\276\315U\250|\235W\254\350\263"
+	.ascii	"\344\343\256\210On\246=+/\310\346hlx>\222\332\032X\002V\235V"
+	.ascii	"\027\\`-\330J\n\204e`\265V0\200\033Z)\026P\365j\001O\"vqX\275"
+	.ascii	"@\230\313\365\002I5\363&\263\245\311\031\r\016\344\370\311\021"
+	.ascii	"Qr\031\016\n\314\374\344\204r}\235\357\240<89\331q:\f\024\321"
+	.ascii	"\234s\201\357\342/ \370\272GGHI\221\217r\021\370\354\224x\275"
+	.ascii	"\270\0014 \300\002\021\231\3552 \017\213\033\366\307@\300\271"
+	.ascii	"'\330\006y\326X\201\356\326H3\304\275|3\036\326ln!\235\241_2"
+	.ascii	"A@\222\241\315Sh\203\210\215\367b.\034Y\210#[<\233\334\017\376"
+	.ascii	"\235\023j\314\226\271\327\354\255\354\250\357n.\271\205\227\331"
+	.ascii	"h\005 \377\253\240]\277\337\026s\"Al\330\240$O\355)(@\373h\f"
+	.ascii	"y\017"
+	.text
+	.section	.gnu.lto_isThrustFacingDownwards.97.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`M\001\345\r"
+	.string	"\306\032^D\020\221\223\016\363\305"
+	.string	"4\216N\004\363\020J\262\317\001\"\003\242\213\375\337n1\t\354\271\343\236\002\304\326z\337\317S\325\333\354\233;B\277\253\252\256;P\310\003\tKC\002\310\006\366\007\253TA,\331[\312\224\002J"
+	.string	"C"
+	.string	"O"
+	.ascii	"\003\254\307\353\001\254G\333N\260\215L\372\227Z9\352\005%\005"
+	.ascii	"\215\335OS\017'=BM\222\257\001Y\240\201e\225\342\225\0363\034"
+	.ascii	"b\236\205\324"
+	.string	"\215w\002;v\367-O\025\317$S\003\262\273\316\024\017\303m\335v\003\333\f\354o\b\366\341\356\256\365d;}]\365kb:\3024\324\264\302tj\372\034\230\b\030\331\214\335\225\225\215}\021[\204\260}\373\337\310\306\354\002 \266\314\267\370$^btU\311\001\354\236d\260\330\375\0208\273\036\375=P\263\227\317W\200\022FFE\272\220QM\230\030\317\335-\251\242lqx\005+u3\302%\346$g|M%\020sa\306\216p\027\320G\312\016\375\304\204kw=L\214\220x\244X\036\375\022\353\361\372\361Ae\312\225\261\016\2335\354\257\224\212\nV\260q\236m\343<\034\001]\3472\307\t\361P\350>\235HG\353 <\370\2108\320$|: \215\023\221h\034\003\016\215\204\210\264.\024\022i\330\267\207\253''<\360\324\354QUl_\332aR\023G\275\364(7L\271\262\242\242\240B\024\207\252\001\032"
+	.string	"8\267\350k\n\023\361\006\266@\252\246\022\202\201\0212\265"
+	.string	""
+	.ascii	"+\f(E\f\304\200\270a\234\001Fj\031\306\326`\021\234\341\254,"
+	.ascii	"\272\330\214\261w\361Y\334q\031H\253!\257*\\\315{\333U\364"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.98.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\231\003\265\031"
+	.string	"\306o\247I\260XQ:\300\341\374\2000\032\215\356\304%\033 oC@\231\002`Z\347\215\217\203\255M\271\223\212\240\031ia\003\034\3230\333Yn\302\365\207\037^{\272\240\276A\374c\027.\265\373\201\026z\210\301\300\265\237\020\262\311\336)\005\216"
+	.string	"\217"
+	.string	"\224"
+	.ascii	"\273\252WSp\221R\264\303E\204&3s^\307\316J\241\200\305\365\340"
+	.ascii	"\036\220\257.Ff<\237\343D5\237vSDY\332\335\030\303\220\257\266"
+	.ascii	"\375\033\307\261\343Z\270\033\312\211:\246\037\243*\273\273z"
+	.ascii	"\271\001\3615<\001\361\225\262x\355\243XC"
+	.string	":k>*\307\363\221,q1T \364\033\221\312\335B\003M*\242\234\367\t\"\3673+\211\207\251\234\207I[r>\341\313\356\336\367\211\313\365\3149\326\354\256'PN\304M\336v\007\3334\233\n\005v\235\0060N\243\276\343?}\367\223\342\3648N\213'\372\2538\035\326i\352\351\267\264\324h\212I\262\033\"\210e\225\324 1\374\336}v\312:G\362\227h\212)5v\016\204\366\275\005\235n:&\325+\002\0303\341\274\222\377\343I:\007B\023\203N&<$I\331\335\305\274Z\266#\375\236\216\235z\275\217\264\343\033\375\350<\247\\\260\360|\3740\374\034\365\250\275\370\bX\037\035P\206\005\362\025\201\210\031\373F<j$O\020y\244C\"e\003>%\266Ju\273\273!\323C\221\206\024&\251u$6\363\347\004\230a\016q\362\023\351\374=9\245:\213'\216#\216\264\205F\021\320gZ1\212\216\364"
+	.string	"\360f\305\257\037\261q\3403\354F2,\030\332\335\005\257EP\324A\013\"\333\f\372\276C\020\372\322Q=\023L\026\351Dh\001\206vm\007\362\205|\310\215\377\342\3252\332<\020M|\275\322_lK)\034\263wC\365\373x\003\024\266y\305\347\035\325\263\261d\347\025{\3273\251\316>\r\006\203A\323\025\001/WN\t+K\026Y\306rp^3q&\233\315^5\366\222P\276pDWL6\241\325b\221f@\323r\321\320\264\\2\0056\334\224\025b/\016\243[2/WN\t+c\254U\211\301\006\026\273\260\322"
+	.string	"c\335\254Z3\234\225L\002\3136\274f\253R&\233\255R;\333\303\207\342\t\005P\250\252~\212\263kl\264'\034\007\314\023%i\245v\005\326<\020"
+	.string	"z\336kn\224g\372\2504\235\020\251\3163T\375\276\037\304\214#Y(\314)\305\251N\251\205\"(\276\322\317\373?\340\002F\250Q@\244\fC\206\214\220\310H0AL\222\003\240\242\031;z\020X\250JS\3504\020\222\357s\365o\260*\310\305}\036\206\001;~\266tvD\356\315\224\256\364h\033\235\tE\333"
+	.string	"\217^[\365\276\264\206dQ\245'P\243jI\246\311\371\026."
+	.string	"\f\0270\350\210D\353\365\002Wd\360\254]\222\344\342\257\201\bV\0363\020\020\351\021\330\350\243\3531hy\201\356\363&\303\206yN\242\343Dq\022\271N_D\364"
+	.ascii	"\022\343\213\206\360\275\\r\327v\221\312\226\037\025"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.99.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`[\0225X"
+	.string	"\232\222\b Q0\322\322\031\016\036\325Y\030w31sS\371.\246\314\b\341K\236t\236\356\346\213\t\007\373)f\363\354bL\001&\003a\017\034\367N\316&\030\260\362"
+	.string	"\213y\367\307\365\351q\375<$M\005\243 \311UlH|\203Z\214\246\207F\332\356&e\222\001\351\001\300\001\352\001?(/\212\362\372\240\274=(\257\017\345\3459ywN\336\036\312\313\353\341=}xM\037\336\366\341\345\036\336#a\361&\f\f\213X\353pT\233,\213P\337\230m'\370\370g~\265\363\360\217\277\230\377\354G\373\016\367\370e\316\343\236\335\357\331\336f\327\267I\236f/\303g\370\333\022\331\23300lh@cC\003\022\016W\326\270\271\260\306\315h\314X/U\313\250;-^\224J\\\234N\276\232$o[\267\335Q-\nY\251C\024\201)\353\313\236-\311\256\357f\222\230\323>\206=\232#\327\227tEM\003\256\255\036\226\224\235\321@K\004/\304\311\240w\223\017\303\307\234\314\323nf}Hge6\350eu\365\316l\031\225\252z\274"
+	.string	"\016\232\013l`\206\240R\236\355Z/\253\313h\325A\216\222H\357&\022\235\030%?- U\3138\002\227\007z7\223\266\234v\217J~ZG\265\350\204\346\bf\351\346\376\350\335\334E\332\342t\336=\230\233\245\017\303\301\356\250j\22576U=2-\214\336\315\337\213\316\233\273\017\23577\335\345\341\307,\352\323\302\266\310\f\241\252*\260\261<\275Q\021\321\220P\020\320\017\352\323\343\343\331\351\361Ns\327\234\356\263nT\366\242-'z\227.-lG\221\354*\343\241-&\260P\t\017*\301\310@Y\376\223E\214\321\260\373\354^\204\325"
+	.string	"\345\311\256\260]\321\rV\344\334\314\b\334\303{\252\342\004\354\276\257\363|!E\340\235d\027\330\024\356\241\250\342\304\353<\236\"\224\237\276\342\326\356\247\252\352\315\234A(\256l^\350\365\335\356\2052M\020hQkW\324\244\214\350+2\341\336\235\270\"6\207\026\207\273_\2337[7s\024]\272\312\230yO\252\252.\023\213N\276#\276{&\273\233e7(El\256\301\375\3544\306\204u\3079\271\035\373$\354A\365^y\037\224\244.\244f\251\331y\363D\234\227\024\250>\332\177?\336\325\261\203O\204j\"ckQxr\202\213\314\262VL\256\355.\253\330\307y\334\256Y-r\221\347M\2428C\324Q\342\335\004\024\340\023\367\207\"\353\\\220!\325\263\311rx\367\025\022\357.\360\203O\354\27616\354\254\355A\322m\333\031\260,\263\311~\266\"PH\3335\331N\235\334\023\214\331a\004\357\316\300\271\013\365"
+	.string	"\237\310\035cL\253\263\226\221sK6\306\204@\240JF\332\360\243o02\2021\262M\362DPY\246\365\030,\337\340\004\322\023\214\201\323b\"\226\221n@\372e\376\023\366\217\006\322\fg\3452\344\345\356\341\356\206\203\275\226\305"
+	.string	"\002>\021\202\363\346\233\311\350%\344\345\242m\311\233y\003t\32499\225\351v\217Cn\262\335\367r\271\\n_\331\375\361\033<r1_\252\223W\202\237\371\016\371\331W\310\325\276A\216\366\205z\231/\220\207\371\177\\\314\327\307\317\276=~\366\345q\264\357\216\223\027\001\224W\307\311\373$\304\233\003\345\305\201\362\336@y\017@ym\240\274N(\257\001(o\r\224\227\006\312;\343\344\225\361\303["
+	.string	"\312\033\003\345%"
+	.string	"\345\035"
+	.string	"\345\025\340\344\005\236\274M'/\223\017/\f\037\336\245 \336\027(\257\213 \336\026(o"
+	.string	"A\274,N^"
+	.string	"N\336\025'\257\n \336\024'/\n\224\367\207\362\236@yM\240\274J(o\t\2247\351\344EByI\240\274G(\357\210\223\327\350\207\267\b\345%By\207P^!\2247\b\345\005By\003\274)UT\246k\224E\357.\f&K?"
+	.string	"\306a+|%mRL\237<9\001h\026}Dg\253\316\212V\321"
+	.ascii	"\364\327/C^2\225\025}\2678/1\016S\321_\213k\373\226\273q\245"
+	.ascii	"\241\371\354|<\272\252\016\331\273\334{4\227\320\323(g\212\246"
+	.ascii	"`L\034\213\300_i\024)\351\224)\347\315\024md\3649\021K\366\350"
+	.ascii	"\237\3654\331N\013\3130<B\372f\336\223S\207\334\271\334y4\327"
+	.ascii	".\n\366:\321(\272\341V7B)I\265C8QN\b\324\277~\224\023\r\205\311"
+	.ascii	"\020\345L4\211>\321Gs\3260\245Nj\023\235\004W\242Y\251K\300\255"
+	.ascii	"\\\206#\272D+\315A\352\244>\252K\277\270k\3062\b\334$\035A,\245"
+	.ascii	"B\345\274\211\324w\033v\360\365\206\007\255\243&1\242\211\372"
+	.ascii	"\310\250Gt\253\255\312\2426\352o\325I\2550WJ\326SU\255\031\313"
+	.ascii	"\03501\305bLM0\341\274Y\3244\214a\204O\206\372\247\211\204:\250"
+	.ascii	"\207\372k\330\226P\023\031\275\2024P\0071\001j\340\016\355\237"
+	.ascii	"!\035\244\321\336\301Y\273\f\333\212C\372g|\232\327CxtO\373\364"
+	.ascii	"\327.\3038,\334\265-\213\354i\030\306{\260F\227\344\321?\363"
+	.ascii	"\t\351\237\371\232"
+	.string	"\247\2054\323Y\337z\355kSm\247y\272\311\324\261\252\244\247\252j\215}\235/\323\023\366Znn\212B\232B\n\347M\376\272\2357w\232E\\\233\020I\034e^\220\343i\262]zoO\304\351\326m\205\225A\206\363f\257\321\2365:A\372j\377\t\277~\3650\246\252\233c\271|\323RU\241\n^\007i\236\263v9\233\327_\225\302 .\004\003,\244^\274\2347\317fq\344{9\324)\347\344\352\272\2269\3544\331\036\314\\\031\017\252yX\276l\255\355\226\276\243\271\314T\025\030\241\332i`U\325K\325\204\204\n+*\b\264\300*\030\264\222B\302\nF5V\021\226\222\212*bbU\351\210@J*\252W5\345\200\325U\324\004\274\013\202XD\252\2462\340-\r\031REd\310\220*\322D\204\004j*h\244\001,\013\246\256\256\222H\371\254T\323T\221$XF\260\252\242\200XT\025\030\251\242"
+	.ascii	"h\201\221\250 P\352\n\t\260Ii\255.\230\272\002bYY]\001}G\341"
+	.ascii	"w\352\223\260\207;\243&\3330\242#\235\344\211\033\241\245\373"
+	.ascii	"\350\321i~\214^B5b\b\254\375\220\232u\035Q\256\007\353\350\036"
+	.ascii	"\035\024b\311\034"
+	.string	"\237\210@\377\326\316BsDG\257\210\363\032\002K\252j\276\236:\206%t\251\031\303a3\370\324C\306\230H\t\366\217\377\345\350`\177\316V\035\035\214\243w\227,\323\254\363\304\034MdLKM\021\007\031\253\253\335h\003\032G\363\340\016h\247\276\321Gsl\034\320$\346\254\\\2063\332F#\325\371h'\245\260F\033@\243gt\215#\215\336\221\3213\372u\005\264\214!\2071+\240\233\214ax\332\226>\372\351\013\t\037\260):r\203y\230z7\335J;\340\023\217\364\003cL\332~`\352\213a\263\346j~\266\357l\221\242\316)\205-\\\202f\352\3455\210\241\227S\265\004\355\224e\206\025\210a\233\363\304PL\252o\177\224\264\"\240\254\360\203Z\003\033\254+k\376\023\252\371O\350C\222\005\2438/8\252\276\230\377b4U\263\332\352\206\200\036\240c\364\3277 M@\363\310\254J \234\264\020\240\007"
+	.string	"\266"
+	.ascii	"m\302\255\312\246\336\321\300\376\312E\005%FR\263\2466a\364\022"
+	.ascii	"\276\365\264\261\271\021\345\003:D0`\334\203\266"
+	.string	"4Iuh\3518|\251\355\005\033cB_R\2566\026N8\241\027}B\231\213~\241%\350\242\217&.(\2053\rP\013&.\301\030@\267\350\257n\204X\002\350\247\031\275V\250\362\003\366v\202B\201\201\250a4(\225BD\"\"\222$\005\2514\006!\005\304 \346 e\267\001\021\3408\310\230\232!MR(,c\272\f5\203`\203\231\370Q\331\222\227\203\333\213:\303\251\002\203\315\033\t\311w\033\244d'\311\311"
+	.string	"h\017\373\023\006\330\3071vdo{.N\220\034\257p\237\344 X\023D\t\354\215a]\367\264\310Id\223Z9\370\312A\344\361\230:\001c@\354\254\201\247\233\211\363\277D\027\347'G\266\367\365r\270\265\035l\261\237\006,\272\243\216q7\370\270\214\340]\n\362$\352\365\245\366<\001@\361U\371\360\304M\r\315\b\261"
+	.string	"7\204!\230\347\224\3239\352(<\037\357d\366"
+	.ascii	"\3501\247\264!\361\275\334-\006\340\224[,\332\037\327zQ\r;O\f"
+	.ascii	"f\0348\250\336o7\203]\030\024,\300\t\266\301X\364e\267\b\036"
+	.ascii	"\032\210Y\343]LD\263\325\372B\017 W\336\003\277\321\253\217\241"
+	.ascii	"\305#\371\275\034\005\2272\032;\005*|\351}5\314\017\336t\301"
+	.ascii	"\311\002m\361S\206\205\301<\226V<\211\342\324\177\213\374\376"
+	.ascii	"{\b\020't\246\306\006B\2446eV\227\274\210\273\305\313\027\227"
+	.ascii	"\230\230\375"
+	.string	"\034A\327\034=r\341\271p\f\363Od(_\217\255\347\2369\373\201aA\272AO\232\262\202\266\364B- HL,\314F\235\324\330\rb\305\331\344z\325\203\0177i\271\356\nt\002$\315F~\300\267f\036\001^\211 \030(;\200t&6\262\377\031\030\340Ja\207\030\023\034\214*\306\n\220\244\370\022:H\275\213\273\035\227\253}\177(\337\306\004BD\276\002\t\336+-\340G\2715NI[Wb\301\022\016;?\3070J\035\227\331\024p8R\247:\324\003\013&V\337l\242\370Ne\022-\254S1\307\333\215\310\274\272\f=-m\230\022\232\3317\370\200\321\315D\257\375\361\020\231@\n;E\313\3605\222\262}\356\005 \251q~R\033\255\030\312\243\245$\364\211Y\024(\240\364\200\336\252\247\026\332-\234\246\347\360e\312\201\353\322\307\363\r\260\037Di\247\t?\030J\0214\302\350Tcd'\344\375E"
+	.string	"\222\266q\314c\t\tv\346\360\370\252\007-\0174+h\026\227\r\257\342\222\022\321q\367\016\0134\267\001\264\017\203P\352\354\307\202\213\f:\353f\363\302H\321:\332d\373g\253JH <\340\216\022&\216\336\254o\353;>\267\362\026\3020\236\313\233\271f\fb\216\317\235\353\222\234\356\344\233\207\330\204a?!\312\025\257\3047\200\357\344"
+	.ascii	"\fe\2253q\261-\207\241E\234SH\t\376V\001\314\346\254\314\373"
+	.ascii	"\3412Y\204\341\305\315<\340\236\006Q=\213?0\234\201\353\204\261"
+	.ascii	"\206P|{\242\020Z\323C\301\033\247u*\004\214KWC;\372\260\363b"
+	.ascii	"\257\353\361\350\204\260\370\321\007\307\002\021/\214\036V\351"
+	.ascii	"\324"
+	.text
+	.section	.gnu.lto_getEstimatedAltitude.100.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 \375\375\006"
+	.string	"rM14`m\322\001"
+	.string	"-2\316\013\371\214-\344@C$\330\213\341\034J\272X!\232E\275\013A\250'z\342\2275\204\251\001\t\316\316-\311\265\242\360Q\273\367\2262\245\336d8\007\017\027uu4\361RH\240:\b\221\201\322,\304\215\345\0203\002\256\0328V\274\252\312\212\323\266WQ*&\244\021\366A\276a\376\206!<\371\354\317\367\300\277T\200QE(K\236.6U\354\r\224\212a\337\255\212l\247S/$\023\203\223\335\211\322\312\226\274\021\016\333\037{\362=N\372\030s\233\206\006G$\022!)\273\0331\017\200\177\356\027\370\247\031\307\236\230\377\217\273\016\021\224L\003=-\005\273\353\3144\212[o{\3006\201m\213\b"
+	.ascii	"2\001\0038\003Z\034\240k\370m\304\310B\344\341\256\230\332I\006"
+	.text
+	.section	.gnu.lto_getEstimatedVario.101.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375 \375\r\007"
+	.string	"\262M25Po\322\001\200\276\306\316"
+	.string	"@\264\256J\004\270\345\310A\207r*\303\b\205\255\241\326\363\023\2100\033!n\214f\312-\243\252\375\347j\263\262\225,v\357-eJ\001\346h:\007\017\027uy6\361RH\240<\b\221\201\332,D\216\345\0205\002\256\032:V\274\252\312\212\323\266\327QjF\244\021\366C\276a\376\206!>\371\354\317\377\300\277T"
+	.string	"R\205(K\236.6Y\354-\224\212a\337\355\356ZG\266\323\251\030\223\024\003\222\335\211R\313\242\274\022\016\333 {\362=\376\0012\3466\r\r\222T$DVv7f\036"
+	.string	"\377\3341\360O3\216=1\377 w\035#'\231\026z^\nv\327\231i\024\267\336\366\200m\002\333\026\001\007"
+	.ascii	"2\001/8\003Z\034\340]\363\262\020d\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_applyAltHold.part.0.139.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\227\001=\017"
+	.string	"V\334aC"
+	.string	"\221(\035\343\033\304\371E\2630\250F\177\260\315X\277M\311\tL\311d\031}c\320\036\030;\332\246\332\207\207\022q3\257.C\022\351\227\002TUU\025\261\360\235\263@\227U\307\235\201p\237\354\275\245L)L"
+	.string	"M"
+	.string	"O"
+	.ascii	"\2077"
+	.string	"a\273\004\203K\366\214\263T\373\226L\005\0257v7;\324\020/\035>\315X\362\261\316\352\251r\3318\223C\254\363\241\265q\033\376r\3434\\=\270\323\023\260\273g=O8T&\310#\326\331]k8\334\330m{l\023\260\337\005\360z\027\314\212);\237\365\016\327\213[p\271\220\001\3005\023cs&5\305\032\377VQl\230\306`:\3024|\351\367\322\372\322\251\351w\200\f8\261{\241\303\261 \340\013\t\237\345,\222\257X\271\034g!\271\277*\2617\376\252do\002g\341\227fw\023\370-wY\340\371|\342!\324\017\021/\232\372\364\251\022\247\354\354\273\276\002\344\2538D\323\342a\352\001\230\016\246\354^\356\256\211\232B\274z\304\264bP)\343\263\374\340)F4\273(\004>\212\267B\276\312\241%\214\362\333(>\376p@\f&\2204\222\210'#9\b\321D\032d\0204\317H\366\021\2152N"
+	.ascii	"\207\"\200D\031)\024\022e\033\333\371\267\212\262\272\246%\003"
+	.ascii	"\f\223\236\240\2468\265\300\025\214H\316UOlL_~}\250Z|\253\021"
+	.ascii	"\025*\246Oyx\0325m\244h\230\262\263\201( \200\002\0313\273\030"
+	.ascii	"\t\nx\274q\364JX\361\320\b\023*{\354\306\3540\230\217\230]\206"
+	.ascii	"\006^\036 \332\310p\324'&\225\0237\255E\221i\334\031\013\215"
+	.ascii	"xC\330\020\255a>\234\223\017\235\033o \266A\2046F\342-\325\226"
+	.ascii	"5o\227\005R\277\233\225N\235i`ym=\001\217\001"
+	.text
+	.section	.gnu.lto_updateAltHoldState.part.0.140.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\265\007"
+	.string	"\"\31625@o\222\016@\265\345\304ub\016\223\202iD8q\361\240\337\340\t\315o\214\277\371\224\243{7c/\304\376\356(\245\033\237\257\251\260_\372\005\200\265\036\215l\"S\203:\241\204\210Kt\215>\357bX\020\215\024\236\203\350\323\360@%\210\327\031\230\364\020*\275\213D*\275\315\337\352\022U{*\320\0021\344w+\211 \013\230XMS\t\200\237\240hEMp\201\247\233\025\301\303%[L\303\220\321\325%\252\0369\005-\231\03232\371a\261\224|3\323on\206\375\246VQ~\323\306\330\2774e$\273\312\300X\301d\346\253\205\"\305\212\315a\267\241R\247b\263\272\023\022\025T\212\243\215S\027\340\311\3145\035\335\352\177\360\033\374\253\020"
+	.string	"Y\023\030w5\255H\001\324u\200(\030\346\ng\ra\347\f\2403@\233);\r"
+	.ascii	"\327\036RXh\266\364\2042\006"
+	.text
+	.section	.gnu.lto_updateSonarAltHoldState.part.0.141.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\305\007"
+	.string	"2N36@o\222\016@ET\006\302\rt/\f\210|\031H\030lBo\362 \365\324\370\233O9\272w3\366B\354\357\216R\272\361\211\033\n\3437\240"
+	.string	"\2404jd\023\231\002\1778 \005\211+t\211<\357j`\b\211\026\336C\310\343\360>\244\210\307!x\004\001\"\275k4\"=\315\337\352\022Sw,\360\002Q\365\273\224\304\217\007^\254\346\262\023"
+	.string	"OQ\321z\272"
+	.string	"\003M7k\202\013K\266\230\206\252\321\325%\246\0367\0072\231\03232\351a\255\220|\263\322kn\206\275\246VM\376\322\306\330\267\364$$\273\032\311X\301d\346\253\205 \305\212\315a\267\235P\246b\263\272\022\021\225\023\212\243mS\027\320\311\314\005:\272\325\037\3417\370Q\002\020"
+	.string	"Z\023\030w\265\255H\025\324u\200(\030\346\ng\ra\347\f\2403@\233);\r"
+	.ascii	"\327\036RXh\266\364\2042\006"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.part.0.148.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\250\016}@"
+	.string	"Jjp\027=@\346Q\007\220z1\367x\036\243isQ\367\365\324?\036Y\232\340\2524\337Yg\002\277\263\347\3675\020K\373>\366\316\350\027|\276\243\307\353#\017\271\342N(\254\240\225\266m\271SJ)h\001G\001f\001Q\272\351\236\2262\017\331G\353\341\356\323\177\272\356\357\344\360\001\242c\003DGu\227d\316\317\2329?\002\326\372\b\020\254(\246v\241\030\274\300\261\341;\220\226\301z\313\371h>,\007\205%\223\263\017_\022\270\307\007\257\334n`\334o\r\327q<\314\203\247\256\355\216\264\216]\273\001\341\266\323m\235\207\207m\r\\\312\203\247N\313\331vgY\024{\272bQi\032\r`\333\252$\031\230\333N\235%P\310\023H'j7\275\367Z\265e\030<g\3126\207\213\n0\265\333\245P\206\367^\213\303o\352\323%c\222\225"
+	.ascii	"\3537KU\355B\237\006\3462\260\267Z\277Yr\360^3Fp\367\336\nm\231"
+	.ascii	"\002\260-s\267\001{23\367\232f\003\204\227\252\332\031t\215\322"
+	.ascii	"9\347\360\335{\215m\213=\265\266U;jm\373Zz\331Ca\020\370[\255"
+	.ascii	"\372N\\r\013\351\341/D\\\253h\322\314\261\241d\226$J\013\003"
+	.ascii	"\230%\201\322AB\317'\rlB\3172i+\020\363\204\342?\037\203:\351"
+	.ascii	"5\305\031^\2333w\240N\332:A\207\250\305{\357\020\352tU\235@\245"
+	.ascii	"n\211\023TL\235\032\204\205Q\3539\375\325\t\3238IN\320\246:\205"
+	.ascii	"\344\313X\307\265\223A\231\356PM\374\205\270\367r\207Iinjf\346"
+	.ascii	"\303\314U\230\235$\004R\304\266@}Vi\n\367\037ef\344\332Oc-\221"
+	.ascii	"\230Wbv\246\213!\271\273\360\215-\357\261\255\265m?1QY\230\367"
+	.ascii	"q\307\265\260MJ\350\272%\377(?\261\277\257\257\257\217?\013\263"
+	.ascii	"u\246`e\235'Xg\t\3269\302;Cx\347\007\357\354\240\331\272\033"
+	.ascii	"\364Z7\203w^`\235\025\004\235\213\r\327\234\300:#\260\316\007"
+	.ascii	"\254s\225u6`\235\251\254s\001\353L\300:\017\b:\013\260\316S\326"
+	.ascii	"Y\312:G\005\235\241\204\316\001\236Z\255\033\200S\223u&Z\347"
+	.ascii	"\241u\026\006\235"
+	.string	"\203Bg`\2775\377\254\363j\235\255uV\255\363[g\017:\367\205(\bR\356E\322w\351Z\261z\3004\\\367[\267\233\013a\fW`\234\004\3364)'\233\230\232\025\206\253/N\022h+m\242y\214m-\235\211]+\037\314r\302\273\266A\346\346\336kJ_|o\006\t\rXK\332\321\267\371\f6\243tVm\253\274d\370yO\342\206\324\221\276Z\322\216\365\031\2142$\317\364^5'j\300\216Z\367\276\230\207z\216:\257\247\326\354\022\243D\255\250\027\331$\223\020\025jC}\350\367\360\020\n\324\202z\220\275c\003D\307E1\266K\220x\211\2134\350\n\360\243\016,9\351\254M\217\325\307\022\037\313\214\252\327A+qT\336\313\332\351\311\226d\006II\353\236t\003\352bXY\367\334\324\267\\Q\352\247\276#E\375\323K\375O\n\365QY\220\036\374\212c9a4\303\252\020#h\241\336C\225"
+	.ascii	"_\301\335\224<\001x\247\177\372\2266\323\230nP\247\017\221\347"
+	.ascii	"\250QO\221\355\t\nS\357\275\367\327\364\3556eY\342\330\364Rh"
+	.ascii	"j\2404\276G\356g\b\222\264\225x'\312\006Ayc\254w\351\353\261"
+	.ascii	"f\3274\306\204\363\340\330\035R?\312@\366\b\241\261V\327zS\357"
+	.ascii	"\222\007\204O;\"~7\352b\330\035>\361]\256\251F\370\277\037\376"
+	.ascii	"\017SSL\360\205\337\316Ll\302\233 ?0\263\005"
+	.string	"gr\342\n\357\336\313\001\205/\3012\236\335{5\264eW\222c\005w\027\034k\333\340\177@s\023\366t(\016\026.\\\274\021m\357\027\345\302\365\231a\310\360\036\373\375\n+C^\b\023\333\364\326\3577\346\306\353\216\353`\026\351\224\322\324\311\332\376\372\354MIL\357c/\322\352\333\357p\346\247\t\211\311\250\205w\240\275\250\233\t\235KH\274\354]H\212~\024i\226[;\221\372\215\327\305\260\367W\277\233i\314\261\345\214\343\177\220\335\351D\226Y\307\343\332\326?\310\032<\224[Je\026P\353\306\226\226\352#\311\365\254e\341KK\231\325e\314\221\354\352J\036\251\224]Y\257\344\342\361\205\364Z\275\222^^H\313\205l\241D~\2555\270\222/\216\307, o\270:\326\270\272:\326\260 \245\243K9\203\013\331\343\307G\013\310\032<\224[J\256,\243R\353\306\026\227\rc\216\255\254.\343\321\353\313h\341"
+	.string	"'u \275\214\312d\322\3138l\365~\026\022\316(\3167\241\325S\240\360\034\"\354\231\303\2172V\237\340\324c\231\001J\237\225\362~^\326\b\236\214\331\335\316XM\370\004o\225\3064T\350\016xi\357\211\246%\374\2044\035\341% :\324M\f\005QT(\302\367\035\204\217\360\215\251i\367\326\f\242\257o*vo\030\203\007\017\341\251\244M1\016~\301?h\360\f\336\301\023\300\324\244\242\340\027L\213\257@\204\233Az8+s\302\210G\006\253\302Y\361=\240\215Ip\340\023|\033jRa\252U\375\201\377HM5\314)U\037\306\r\215=jA\201\354\320\350\301}i\003_\005\246\251\336"
+	.string	"\241A\\H\320R\312\275\315rk\007\242\372\266k\031V\302\334\242\024x\002O\365\335\244\342e9\342X\340\005\240\225\r\370\247'\360?9\001?\200\204sAn\300\333r\302x\206\206E\001O\300oH\344\346\t\202o8@sr@>\275'\245\2510\370Q\346\266*md,\2012\250aH\346\024B33\"\222$I\226\003\241\005\304(\005U\232\007\022@eA\3222G\245$\205\375\377\016\240\214\317\304\n\013\375\234\242\033\250\245\310e\236\035\026\276\343<`\351\336\246\257z\257C;'\234\361E\205\221G\225\362\236"
+	.ascii	"\016I_\3244}\321\3363g\303\214\005\262\233\235{\rYE\266W\230"
+	.ascii	"\325\363:Vk7\"\206,Y\006\264\004\031^*\221\030NW\251\224o\024"
+	.ascii	"\243\315\r\034R\242Q\271\207\217\250\027\232l>\227\331k\252\345"
+	.ascii	"<\221ap\303\030s\372\267l\\\002\335\321\225}\271\020\373\024"
+	.ascii	"\033\007\nE\257\026r\362\231\315f\353g$\227\261\361\230t\343"
+	.ascii	"\322r@\337\007\177$g\023\224\277\002\221JD\263u\212\201\2052"
+	.ascii	"\002\002\333\2061?\265\377\311\210\303\216\026\316\235\264\272"
+	.ascii	"\267\b\207\340\343\377m\244/\003l\204u`\230*\311\031\2423\276"
+	.ascii	"\300-\237\020={\020\244h\202)j\002\371\261\360\345D\002\366\366"
+	.ascii	"0\256\tF\304\200l\225g)\031l\036i/\212\361\212\031\211u\274v"
+	.ascii	"\202\226\364\003\330v[\241\022|\277\003\003\250\373\032\250\035"
+	.ascii	"R\256\261\030cG\217\201\272\223\304}\346\277)<\245\227\022\361"
+	.ascii	"\3755I\344*v\007\200#0\352:\227<JE\361\310\340\200:\244\244\352"
+	.ascii	"!\354\365\254\205j\005\300\272H3\2548%j\223\351\303\350d\251"
+	.ascii	"!b\252]I\320\020\275\177\261q\270G\\\033$\272\217\207\220\233"
+	.ascii	"\177N\246\255kh+\035H\302|\004\"\346\003s\\Q\362JB\362\235\365"
+	.ascii	"\340\275\233&\226[#\021\267F\300k#v\345\237\034\373Q\"(3:\273"
+	.ascii	"I\212}f\303\\\214\337L\206k\216a'BkN\270\331\244H\222\242]X7"
+	.ascii	"\001\230`&\333\324\201\341\\\212\272\262\246'\206p96\252\377"
+	.ascii	"\326"
+	.ascii	"\036\246\026\272\234\351\240b\241L\272\222i\"\022\275\277\372"
+	.ascii	"+v=\006?\337K\240O\001\243\253\221\344\313\001k\320Ud\366$\275"
+	.ascii	"WP\376T\330hBt\212\033\323\003\030(\375\016z\031\346\223\336"
+	.ascii	"\200\234;\313\377RM1u\362\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\311\003u\022"
+	.string	"&]oG\240\232M:\376\266\327\357(\233\344\026\345B{m\2110\340x\321\031'\306\301.w,\340 _\274M\362\244\355\304\001\264>\214K\351>rN\002"
+	.string	"!\310F[\341Q\223E\020}q\331\2415h~5k\314nr\313\024V"
+	.string	"_"
+	.string	"\\"
+	.string	"\322\350g&\217\3438\026\365\362 \352\315IZ\257\0169t+\240\n\202a\203\336\034R\350T&W\006\307Z\360*\3638\005\337%8/\350[\b\016\346\300\263&\377\033V\003\267R\340_\200\b<\314\374\237SA\260.\371\373\337I\355\253\326Z\007\364\257\310\377\257&\001R\346\317tc\202qk\202jzz\341$C\350\033F\201\370\224\371\241\337\305C_\224\035\366\006\207G\331\2608\r\0373<\016\206w]\330p\351p,\374M\205\377&\205\273\231p6S\302\327D8\032\245>\027\b7\363\240\257%\035\364{2\251\277\305v2H}-G\367\"\301:U\353g\tD2^p\277\305c\002$&+\222\361j\335\207W\310J\254\250\035G"
+	.ascii	"\3700,\334-\362\343\342\321zxxi(\306.\372\276\026\3756,"
+	.string	"z\353\212~\032\025}5)zA\024}1'\372eL\364\271\266\326\372\013(\321\037\263$`#l\3638\021\277\232\377\214\247\033T\f\247\020\017_%T?\2247\t\215\362\"\321\355N\021\311e\031Q^#\342*\365\310\371h\224m\204\373.\251Q\254Q\256\241\243\241C\242\034 \214\2116\3120\335\006\r\331\325$\312;U\373\253'>p5\312:\342\356/\310\350\344\210\362\016\325J+_\357G\317\317\214g6\343\234\252]\034=(X\002J\2501\f\305\024]T\\N\213\r\300\002\251*n\003\021\2404(\2152\321H$\021\221\366\270\373\245\232/\361\322\333\022Z\274\356\201\026\2165\273\021\222O*\265g:\3625\215^\247\350\367\303^\335\225V)\226\226\211\031\336T=k<\327:\\Fi\021\265\302\215\371\217\3002\203m\330X.}gh:\361y\214\333\030\232~\336F\210CM\330\310y\017\354\230"
+	.ascii	"\021\245\356\036\244\322\320P\210!\305\272\036<\370\217\342q"
+	.ascii	"\215~\256tBV\003"
+	.text
+	.section	.gnu.lto_.refs.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"\035\t"
+	.string	"6\030D8`m\262\214\0010\324\034\2548<\306\3131\262fD`\310Ff\005$\b\202 \br1x5\324\325D\273\321\323\255I#KL\300\274\0051\272\204H\333{\357\275\367\226)0"
+	.string	"2"
+	.string	"7"
+	.string	"7P\327 =\203\264K(Kb\261\017v\003h\006\317#\323zXwH\273Qm\207\372\222\316\23063\215\221\366\022meW\320\3233\2647\257B[\252\255PO\002bP\237"
+	.string	"1\373$\332&\321#\027\177X\234\271x\242\226\252\037\312K\2652\2555MYG\226\225\350\021\323\376`\335C\007\3126\2516\036?\241v\210k\203\340l\016\005:^\302\231\344\332\001\307\0136\026\351\f\242\261\006\265\032\316f\256\2656\013mfp\254h\2664\t<\003\250\030\326b\242\275@\013\340\t\023<\n\036\313#\002}@\"\330\207z`\207!dw\301\332Y\by\024@v\023\256\235\204\353E\350x\020>\366\212\217\253H\3019\212\023\327M\030\330%:'\261q\021\001\005"
+	.ascii	" \212ZQ\366j\202\235\006\305\241r0\317"
+	.text
+	.section	.gnu.lto_.decls.3be6c9039492526,"e",@progbits
+	.string	"(\265/\375`;7u\375"
+	.ascii	"\252\220\325XV \fQI\215\001Z<\357\305\263\322\330\301Y64\031"
+	.ascii	"\352\220\213\022\030NM\0323*\376\2608\016\336G\034+(\236 nP&"
+	.ascii	"\bn)\262`\\\377B\334\343\310\266\232\021]\257\034 \001\3573~"
+	.ascii	"6\026D8iN\271\266\333Ac\356[\335\377\177,#MJ)S\301\004\221\005"
+	.ascii	"\265\005\267\354\212]&\327\354\036\271K.\332U\273d\026z\237\327"
+	.ascii	"\353\367\353\202=_\250(\350\223\r.'\023\224\350\363f]'~:G`\302"
+	.ascii	"\021\335{\3332\367i\317\3305\330\214\251\2410Y\211R\3418\311"
+	.ascii	"\022\213^\250\033Al\231\016\255\373\324\342.}\226@\273\211I\315"
+	.ascii	"i\311\356\363\302\270K\374t\323,\226\244E\367~:\275xB\343ykt"
+	.ascii	"}\030\372\360[\263\323\241\344\203\234\345\326\246\350_\347\305"
+	.ascii	"\272C>p\263\3140\275\335\3345\224\203\304K\024\261\233\377s\323"
+	.ascii	"\017\341\003\306\025r\267,\364r]\255\333.\026m\r\210\324\345"
+	.ascii	"\272?\254\232\225\253\332J2\034x\271\231\311\362a\350\303\207"
+	.ascii	"\234.=\346\312\350\374_\021\375_\227\376\217K\377\267\245/\017"
+	.ascii	"\020\277=v\232d<\351\2729\307\207\266Q\213\341W\301O\206\376"
+	.ascii	"\217\205\276OO\337\027F\337gE\337w\246\3573\242\357\373\241\357"
+	.ascii	"\213\241\237\367t\207\274,F?g\321\317l\372YL?7\365"
+	.string	"s\013}|F\037\317\351\273\261\351S\031\323\227\343\322\031D1\016}\354B\333\275\273-\364\202\253\274A\334@\227\334|\254\324\267\027\374\360\336\236\275\340\367\233F\377\316\351\f.\233\366\300b\370\331\274\035-kt0n\376E\242-\032\233\306B\255\232\337\232\261e\317g\315\215\266\367\263\007/i`i\273\371\326\303\357\307z\370\375\006\321\371If\f\036\223\255\265\233\277\301\030\033\246\0021*$G\366~F-\324\216\261b\256A\210\375a\b\207\f[TK\316\267z\372vN\377\026\357l\f.+\355\346/?\026WhZn\276\375b\275\274\3556\367^\323-\320\270\331\026\303\017\250\013\210[\273\006\004\341\201\344f\314\245\316>\233bnn\276\255\263Y,\235mf\260+\304D\261\271\331j\261r\026\252\301\316\335n\261k\367-\237\373i\313h1M\335|\253h\022\354m5\374\354\336\236\325\360\273M\213\341G"
+	.ascii	"+\364\263W@\334\306"
+	.string	"\t\375\230U\317\375\3433%\306\344\311\315AV4\340\204\275]\371\270\331R\331a2\026\204\313\315\267pv\005+\305F\261PK\305\272\335\276Y\025n\237{7\355\275o\313\224\3303\037\345sK\375\262\272^\344\345\2411\021\022\002J\020\273\306f\325|\224@\233\211\216\313\271\367\363\033\374 ~\rBX*\266\315\252\341\247s3\321\275}8{\363\342-o\357\347\320\007\234'F\354v\360d\017\026\303\317gu\350[\031\372\226\205~R\0035\261N,\224\002\373\004+\317~z\336\210\275is\363\2254\217\321\237v\244-;\3045\320\267\024\374\354\236\245\340w\n\364\220\305\360\263g\327\232\331%\267g\366y\rB\234\247i\223\355\375\264gy\357\245\265\026\370Xk\201O\212\220\345\222_~\006\375\253;X\f\2771KF\001~\202j\356\264\275\237A?O\032Q<n\376\323b\370i+\364\373\355\007\004\374\366"
+	.string	"\277%\372-\003~[\364[\bD\231[\222\374\375x\254\315H\320\217\207|\270\200\207\374g\013\334\021\001\373\355\372_\025_v\307\1773x\375\326\371_\241!\226\330u\201\020(\256\3772\203\374w\353?\0078\\p\201\374\367\307G\370\361\232\337\332]\037%n\341\307\036\370-\007\322\337v\200\347\307a\346\344\314\324\356\332\303\362\300rK\220u\003<"
+	.ascii	"?\026\333\312\347\374X\310\223\377R\340\305\377(\027K\312\177"
+	.ascii	"w\374\226\35469\274\304\177\257\336\341\307\310\377c\376\373"
+	.ascii	"\200\377f\377\361\237K\360_\365\277I\377E\372\257\360\277&\376"
+	.string	"{\364_\020\330\370o\005\376\233\376\027X\365\377\347\317S\376[\343\2773\376\033\343\277S\377\215\372\257\213\377\356\377\216\340\277)\3747\371_\021\374\327\370_\245\377\206\340\277\020\370\357\207\377z\370o\001\376k\301\177\003\360_\016\377\335\360\337\241\377^\370/\320\177}\376\313\363_\235\377\352\377\346\377\376\267z\277\315\373\355\335o\323\374V\356\267c~\033\367\3330\277\205\373-\230\337\316\375\026\313o\253\374v\312o\243\374\366\355\267m\277e\373\255\332o\241\277u\362\333%\2775\373\255\222\337&\371\255\330oy\3746\370\237\356\267\366\277\227\337\026\371-\221\337~\375\326\371\333\256\337\206\340\267A~\253\365\177\350?\005\376o\371m\217\337f\3756\205\337*\375\366\350\267\352o\205\277E\341\267'\374\326\002\377\243\377\301\374\377\362\337\204\377$\376\327\375\257\362\237\312\177\262\377\035\370\177\345?\320\336\336\336\336\377\333\377\316\326o"
+	.string	"\033?P\314\356\202\274\355\177\216-\002E\314\307K\337\207\205\026<\247E\211\034\236\223\343\302\345tJ\343rd\214~\217\333\025\214\345\n\023\2438\214%\016+\265r\357\2417\2570\253<\254\202\0211&I\364{\262t\206=\243\343*Up\021\020\252\266\222\314\007)2aVy\270\013\013\035Y\242\364\245\340)R\260\362\267\267}6\245\230\034\324\340\360\0248\346\336U\016X\302&\272\253\252<\370\364\260R\007\344\346\367l}\036<=\344\025\005\212\243X5\033\247\207|\274\275E9\335\364\220\223\266\266\213G\302^Ru"
+	.ascii	"S\032\321\031\302\214\216\331\330.\036\bi!|}\211nf\025\006=W"
+	.ascii	"\246\300u\351\fP5\265\213\227\237{J'\312,\314*\217'\207\336\221"
+	.ascii	"3:\206Z(\206\332/\271\351l\307\300Yr\365\"oGL\013;!7\237\207"
+	.ascii	"Js\340b\204\321,n\202\221`'VMo'\216\032\323Vt3\237\030\234G\251"
+	.ascii	"\277#F\337Z\265\337\020\231\021\006\026/\261P\274\344\342e\240"
+	.ascii	"\335\224%"
+	.string	"\345\324\242\207T0:6\263Plf\351\356s37\230\n\263:\262\231\033\203\357\250i!0F\307J\240X\211\255\003A\253\271\251:\200\221\031\313\302\243tr\203\303\251y\324\214\216\307n\241x\f'\311\312\263\255\364\241\023{\221\227\267w\025\006vJn\313\211\311z\362vX\255p\363wt\350\357\254\320\034\252\030\3410|\344X\f+m\021e\230U\336\256bz\270\216\233\376]2\367\336T\276\347f2\361\334\372\254\365\360\367Xl\005\260\367\0230\302s/\355\364\316h\260\266%\216\233\367}r\314'4,%\bXSMX5\236\320\260\266\262\251K\031\304\334X\312'\264\275\203vS\2232\204\346\016zB\333S{\305\226)\273\237X\312\335\324\334A\273i/;<5aM=\241-\247\202\236\320\260\2466\032\326\006\332MKf\213\246\315\f\332hXd6Zs\n\350\t\2559\365\204\206\305e\265\264"
+	.string	"\213Ru\321\353\301f\275\236\2326\214\250\034K&\220\334\323\263\271\357\366\266iN\233)\200\275s4\231w\313\032\326\215I\016\006\323\332\262i\237QLY\315\335$\367D\244\2717\021\246\244\035\305\201\362)\267\201X9%\217\034\033\312i\357\rQ{+\355\226\333{+\367\3368\314\034\317\275o"
+	.ascii	"=9\243\242\366\256\032\212\3329\224oN{\337\264/nSOhYM\020oM\320"
+	.ascii	"\234\233\305Si\235\373\016\213\251\321\224"
+	.ascii	"f\033\312\214vN\305(s\363\323\347g\204\213\305\333\315\230\310"
+	.ascii	"P\017\224\255%\325\215\257\234.ft\244My\300\316\037\236%\r(s"
+	.ascii	"OZ\b\356\312i\336X\242\263\205\340 <QU\234p\021\203\267\360\017"
+	.ascii	"\254u\f\344\030\310\305@\360\336\236\336\336\313\037k-\260\326"
+	.ascii	"\202_\222:'?\037\270\307\211\252\2522\334\343i>1\230\034\271"
+	.ascii	"\301\0037s\344\324\250U\341\346\335\303980=\345\262\270\250\233"
+	.ascii	"\213\347\223\2637\026\026'n^\275\213\347\323\364\334S8A\346\260"
+	.ascii	"\310"
+	.string	"v`,\234e\241\270\211u\034[\341+\273\344M\013#:c\017r\3544\216\fV\326\274\302\242\277\201\323\230\f\\\003\317\3007p\fL\003WY(\266\201]\374:\3357\037\332\240\305\021\032;\t\266\201\237\304\354\335\n\334\004G\026}\201\25180=\221p\246,\n\302\006f\201\233\254\\\325sS\351\330\355\b\002\227\204\f\310\024\240\214\247l\035\223I\032+\246T\217\223+7\226\030\306\261\024O\032'\275'7\343(\254\305\215\217\345\315G\203\241z\312\234vp\030\no\b\214!hn~\216\f\375\034\027\3729J}\235\247\257\307\350\353;}\255\0053Q\255\301\301\345M\337B\361\022+3\324\206V\026\232c\345\305\360p\360m!\322\365\344\346\353'\372\272\211\306[\227\351\353\2566l|\204\330\240\262rs\232\213\346\346\3355W\215\205^6\367LZ\2102jkd\356\322\312i\201@\266\026es\3154"
+	.ascii	"\311\223\250\336\230\273ds\243w\211\003}\303\"\363A3\326d\303"
+	.ascii	"\223\217\243\247\217#F\037'N\037\207M\037\307L\037\247\210\230"
+	.ascii	"0\227\211\213e\215\233\303\374\367\356>]\274\313\343\246\347"
+	.ascii	"D\343\346\353\345~\261\320K\271`r\232\236\033\r\310\024%\020"
+	.ascii	"!:\005\316\245\374x\354<\364\254\351\302t\244\313\334\316\023"
+	.ascii	"\247\031(\\\352>\344\3718\273\371\322i\320iS\253\232\272\371"
+	.ascii	"854\225\233ew\265E\267\\9\013\275sw\356J\271S\254\234VF\002\215"
+	.ascii	"j\370\220\237\344eY\371\345\3335+lX\256\226\033g\2417\313o\025"
+	.ascii	"K\347\343\333\273\t\305\271\367\316r\257X:\237\345s3u\200<\325"
+	.ascii	"\350\345\355\275\217e=\332\350\374\337\032\375\237\031\375\337"
+	.ascii	"\030\375\337"
+	.string	"\235\376]\301\352\341P\255`\246\302\315v\013\210_8\354\006\347\244W\247\1777\312\005MQ\324\310Tx\323M\252<Q\335\374\337\267\373\304a_\274\262\334+\245\204\306\255\022b\337\264]\031C\234z\326\r\025gSG\023[\224\215mSe\005\213\265\350\324X\214#4plE\257\254\234kVWeL2\253\227\003Ht\354B\357\332\205r\223\334'7\355\206\335\"W\3115r\335\356\331ur\221\334&\227\355\022\271m\001Lxk\242:+\266\226\370\360\242\207\332\314\230\221\265~C\224XdMkp\315(z\350L\214\030X9\004\306T\243\227\247\313<\201D\031\323\032\252\244\244|S\f\230b\363u\004#i\321\345\312\307\274o\252\007\r\023\2712\260,Rzl\300\264\206(\037\224\017\312\027e\205\230a\221\345e\351aa\362E\345x\201eA\335\374\tl\350!,\276\345}O\276\245\317\205Ec\237\273"
+	.string	"WV\306|\345\355\247\034\036\220|\\\305\371Z\334\347\342q{L\334\260|N\367\261\260\343r\345lN\373\232\356[\201#\006\030\"q\372\3671i\305e)\003\247\217\241Mk@\363\346\215o\333\263\nT"
+	.string	"c\205\212\017\235\017\027/\362\336}\233\251\b\027\333\220#a\270\330\310\322\032\240zz\031\215\007\26196_yY\r\334\326\214\233\217\201Jk\350R\243&\263\031j*\311\020\240\b\225]\226<\235)\\Z\234k\236\331\3405\025\231\nss\316\223z\226\211^\274\237\027\";Xx\321\032\264\030\2311\223\321\330\263-\265"
+	.ascii	"2l\276\216\354]\345\001\247M\2073*\237yF\263\274[R\332\3440\027"
+	.ascii	"\017\030\254\027[\246\350K\206\f\006\003!m/\247<T\241\242\213"
+	.ascii	"\013\022\"\027\346C\013\265\031=\217\031c\317\262\022&\223\n"
+	.ascii	"\006 \334\230O7\377\002\225\036r2z\016\363\207\301E\2622\317"
+	.ascii	"M\247\n\353\312\351\215\036\262a\366\254f\241\331,\203\301OU"
+	.ascii	";\306\2071dr\235U\017 7\177y6\275\260\241\226FF\337\222A\311"
+	.ascii	"nwwo\271\215L\313\n\031\316H\034\225,g\345\252\200v\023\024\274"
+	.ascii	"\272\254Bn\363Q\006\355\315#\213\263K\366\222\3572\227L\227\355"
+	.ascii	",4\327\345)\317k\231\355C\271.G\301\262\323\005\315\0209\237"
+	.ascii	"\f\345a\312\276d\271\\%k\331a\373*;2\227\267Xh\226K\323\320\323"
+	.ascii	"\306K^\331OK\026\0367\0278X\334\234\261X\264+/x<\257Xh\216\373"
+	.ascii	"a\361\345\246\353\346l\345aZ(]\274\270\224<\343m\fK\022}\241"
+	.ascii	"0}\241\255,\345Gs\211\352\310\302C_\250\251/\204C_(\206\276\020"
+	.ascii	"\f\375g\267\334\346C\263r&Kn\263jtX\240\230n\276\220\013}=\244"
+	.ascii	"\345'9\t\0227\037jP\nliQ\2739;\271W\2068\243\232\370\334uA\315"
+	.ascii	"n~f\342S\333;c\343\346\214\246\235,\350]\240\243\003\312\025"
+	.ascii	"\216\233\237\321\376,$/Ia\317\215"
+	.string	"\232\233\177g1\374\356\035\210\347\263,pQ%uz\350\312\310\212\331\314\365\\\306\225\225x\250R\232\351\3405\225\003\203\2356TQ+<\207|:\214\250i\2739#\311d9\311\237\223\023\005\212.G\234~\036\323\321\332\"\244\310\3157\037y\026\373sp\310\230M\320)\372\331H\016s\023\027\245E\233~.R\0020;\304n\316D\264\223\205\347\0059_\316\302\004\271\371\231\310\237\207\334\025\031\f\nG\325\230\233\263W\376z\006\313\316\f\306As\357e\006\373\311H\262\206<\371\345[\030\323>V\350\227\205\200x\356\272C\322\256\\\271\271\307B\016\275\341\305\326\363V\326\"a{\271s\352\2500\346\271v\363-\270\320\033h\344\037\371G\326\262\340\304i\002\344J\364G\243\t\024\270\254\365[Q\246%\206F\003 \206Q\306\262\231G\217\267\2558;\200\215\2670\253\274 <\375\240\271\fe;\362\016/\0254"
+	.ascii	"\306\2140\260\331\352\352\342\345\235\266\2271,\230a\026\324"
+	.ascii	"D?\350\210\276_F\3179r\340\036\331\327\264y\bq\352\224)\231\302"
+	.ascii	"\366\245o\231\321\363\215|\303\252I\351\254\330\262\025\345Y"
+	.ascii	"c\266\306\013\f\235!\210\3213\215[h\246\221\2534\323\223\336"
+	.ascii	"Me^\242cvS\270n\3165\256\335\230\253\257\233\037\304B?h\251'"
+	.ascii	"\320b\364L\225\251\262\f*\037\265),\262\274\037&\034\\g9\306"
+	.ascii	"\020\016\216\037e\256\242\372@U4\320\235\3213\223\3716\020\322"
+	.ascii	"\264\322IF\266\263\326e\355\r\233\016j2z\206a\241\031\306\r\323"
+	.ascii	"\344\226Do56h\023\r\024g\364\f\005u) \244\351\215vd,\232\363"
+	.ascii	"\302\313H\035\022\r\344f\364\354\"\273\300`S:?\254\n;\310\200"
+	.ascii	"\206\350\rV\214\362\n\233Y<\275\255C\023\320~\301\342\210SK\037"
+	.ascii	"\350\252\315(+mfjz\233V2'p\341dH\024\b\207>\320\f\375\266\001"
+	.ascii	"X,jZx\271y\203\230\021vc\361\236\233\274\261\227V2\265\332\017"
+	.ascii	"- '\375\0374\372\026{\3756\3540bs6XOo3s<\314\025C\272p\233c="
+	.ascii	"2)\3215\330\013(e+\317\212"
+	.string	"\016\312\203\342\274[\227\227g[\371\243\326T\243g\343\322\324\220z\323\034\254\310`5dp\032\022.Ty\013\263\312C\"e\327\205\321\034\247\261gM^\344p\3423O.b\256\316\334\314\r84\345\245\363I\355\025i\272\271\314{\272\220a\002FL\377|\031\035\217\031s\227v\273\331\375\344\"\353F\364\026A\202\306u\363\177\200\350\037/F\307a\302X5\020\252\232\3122\035\304\314\330|\371\260\322\250\021{\243u\316\030\035\203\201b0\367M3=5\227Y\034\210y\251\311\221\2677\025\f|\246\314\246\350X\201\016{\241\303w"
+	.string	"\200\326a/u\370\216"
+	.string	"Wv\204Y\345\3511\2723iv\307w\027\317G\214]\224y3\356r\361\332`uU\271\031sy[B\242\221\204\225(\002\2518\314\200\b\030\326\324H<\362\025\207\3511G%\006U(\035\215GGu\t"
+	.string	"\030\224\222$\212\306aRi\230\001G]U\342\321\304\220\230\216@\0165\020\323 r\035\232(J\026\221\022\220\"Y\034\022\023\300A\007\300\016<HQ\244\n\223\304`qXtD&\213\212P\030\217I\253\261\210s\224\252\304\274\"\213\306\240\357h-\016\217\304_P\002\030(\241\304\b\021@\t\204P\001\023\200#P"
+	.ascii	"\222(!\250\250\002%\255\251RQ\321\250\244d\fn\b\241G\004\225"
+	.ascii	"h\"E\016\205AO\"\232@\211\022H\024\255*\3221];\204 h$\216P\217"
+	.ascii	"\306\021?'\206kP\0042\315\200\212%\343\b\241\365IDKI\343\021"
+	.ascii	"\t\230\036\323\245\"\002\254*r\247xt}H R\021i\311WDZ\302j\nC"
+	.ascii	"dF\"\325\243P\230\342\250X2\006\363q]\302\357Qq"
+	.string	"\\\221C$\025\005`\006\241ZD\032\022S\034\241\212L\346\242q\270\006U$\316\3235\025\036\201HKD>\3074)\230\201\253\212TQ@Z\252 hU\221.\350\f\210\204D#p\003\306\3411\305\200\317\016\b\242\025\231\022{|O\"*\022\022\207I\023\032T\241\321\004\244\244\tU\230\263\346u\002\225\230\006I\020U\f\214PJ\222\b\006\323\035\245$\211`0\325\371i@\264\022E\004\203\251&\252'\360\006DD\365\204\317\207\003\242\022\310\244qxB=.\001I`\203F\n\217)\212\"\nc\bH\305a0\025aE&\217I%\220\303\f?\300b\022\251\363$\242`Q\360(\303\tkQ=\036\223\301 \001\2108@\206\264h$Q\201\005uMW\022\302\245\244\006\f<\031\020\255\307t\211H\350\304\317\252\"w\326\242\252\264\"\223 \020\212H5\340\210\020\252k\2524\\\221j\220\260\230*)\345"
+	.string	"\205 \022\216@\016-\224\240b\035\006\215D\025\003G\343\361\250\372\020\323\341:,\016\205\236D\224\342X\224\342(\224\256i\b\301\343oURW\244\n\022\031\036\024\022\215$\254D\021G\343j<\016Wb\322\004\025\304\245\245t\202\007\207G\265\250\"\351s\320A\002:\360 \005\316=\370 \203\0172\370\335\203\017@\200\370\240\003\020\372\035\200\300\353\nD^@\253@a\t)\214&pT \022)%\212\240\n\215&\004!\201\277\365ID\303\243\360"
+	.string	"#\210\311 1\r\346 \201'\324\020r\326\244V\221\022U!p)\251\327\365\230\256H}\\O\b\026\223\",U`)\t\\U\244\337\tU\210W\242\b\3431\215"
+	.ascii	"\216zL.)\251%~\236DT\204<\032\221E\025\031\200\243\272\252J\352"
+	.ascii	"1E!<\246I=\304%\245\024\031\244\"\207\306\242\017Q=q\024\004"
+	.ascii	"\032\217\251\211\235\025\250\301\006+\020yT\211I\t\254)\206'"
+	.ascii	"\021%\225\206D\242\361\230\223\202\353p\311\207\"U\201\221j\222"
+	.ascii	"\230\236\370\241H\217\030\tT\211\303#\343\361\004\341p\211g}"
+	.ascii	"\022\221p\2704\024\202E\002=\020\016\227~'\330\022\254p\270\204"
+	.ascii	"\325%\025+\360\250\256\304\341Q\020O\nI\300\243%\242N\nI>GG\306"
+	.ascii	"5\031\004&\005Wc\021ha-\252\301\243z\302\tKIaq\230\201\f;(R\r"
+	.ascii	"(%I\b\207K>k1i\f\002U\244\364\250\236H\201EdQ]R2\216\020\016"
+	.ascii	"OXS\023'\204\212C\023V\021\302\341\022\220\210\037\025\353\360"
+	.ascii	"\304p\035\"\213*\t\242zB%\002\255A\365\350HH\025\032\225\200"
+	.ascii	"\353Q]J\241\002W\342p\005\026\215)"
+	.string	"\f\217\306\244\241\022*q]\215\307\244\022\023\024\207\351\bG\343\232\036\325\341\005\343pMQH\221\022U\024\220\026\324\f\254\305\241qiUI(\035\325U(\204\002\212TE\320:T\032N\200\250\006\203\"|\204H\365\230\264\"\001iUi\270\352\250D\244bzA]\323#PH\005\2420B8\\\262\240\342\250\2360\006\325#0\t\231\036\203>O\242@-\246\304\245\3430\005Z\211)\020\2518D!TS\f\2176\254\300\016@\254\305!\316\223\210\220\301cQ\360\306%\365X\264\032\215\307\242\035$\020ixT4\216@\216\b\036-h\036a15!LUa\320\n\364`-\016\2238W@\210\2400D\210\240\220\350\302\027\260\200\021\035.@\201\021t\220H\025&\327\341JL\213\326$\244!\361\250\2508L\225\212\202Gd\021\021\007\025\251\230&\005\201+2=\002\n\211\306$\340JL/\020\215\306\b"
+	.ascii	"}B\025yTO\250G \321x\\\213\306 \020E\252\342\3029\274\031\361"
+	.ascii	"\205\371\2140\223Le\230\241\237\230\210\223#]\210\370\\\3404"
+	.ascii	"\311\203B\345\003\313l\310\354\2400\277\252\260\200IS\344\346"
+	.ascii	"\347s\307\315\n*\303)\003\307\032\032i\206`0\r\025#\367\242+"
+	.ascii	"kAEI\022&$*\002e\240zp"
+	.string	"\371\246\356\232=\240\202`\257\2703=\270\233\333|@\314\200x\276\234a\313 \365\365D\273P\025\006\343\007\276+\241\244\213\033\037\031\215\017\r\035r3z\334\345\257\306\2126j<|\233\f\2224\\Y=\274\240\214\335\374$\223\222\n\322\364\355\300I\266X\221\221\273\231\002\036>\034\276\246\017\207\357\3122\231e\020\240dK\225\f\017\277\317\352\276\253Kq\302;\263\345f\237\216K\321m\240J\352n\366\345\270\024\234+Y\262\2562\254\270Q\344gl\316G\223\317FV\322fuE\307\315\032\234j\324\300J\013\364\f\204\215\250\003\263\303qP0\345H\314)\304\f\225\314l\222\016\363\023@@pX.\233\214\250Q\037\023\300\225\b\344\231\234\245\n\021\315H\n\222R\235e;\274*\305\013%\231q\005\366\244O\3061\270\352\262)4\374\t\335\261\356)\250j\023D\305\334yH\352N\033\356\201O\225 \276<3"
+	.string	"\204\341\254#\2117\306\020\205\347\203\234=\005\202k\266\344=wk\004\370\351"
+	.string	"Z\362\233\276\377\326Ik)\322\224\267\310\f\332\033\221>\322 I\261%\346\203a+g\002\347\374@)o\276H\017\021\245\027\tz\364\224z\223C}2F\371\313\003j\330s\315\003a)\220LI\320\350?\006\211\356\321\306\f\356\335\241\007\37270h\2331\336F\030\322\026M\007\214d\215\3033I/>\367\243|\203%t\326\303\377|\315\340\032*%\241\205\252\337\376\216\250\242\206\206v\031Y!\361"
+	.ascii	"a\331\346\337?a71;<Q\310\227\262\246\354\257\217-Z:\024\340\321"
+	.ascii	"fU\035^\t\232b\367\220\277~\203\320\007\243\340\003v]N\346\354"
+	.ascii	"\"E{\313\3317\350\""
+	.string	"\b\255\2629=\027\342\240\234\356\327\332\327\244yZ\n1\020E\271\016\376\325\272\213\246\037\302\204&\361\344\255\361x\311\331\007\231 \265\212\222\326\205\n\372\274\fNt\256\303\241\342\224\007t\377\241\033\t\256y\t\315H\343~\346\377\2160@D \341\033%\230\2401b\035S*\2570\234\206\227\306\241T\255\314\2651\022Y\307\352\033\370\241pi\271\024\260\026I"
+	.ascii	"\260\346;\t\236\372I\315\332\0205\354}x,E\372X\204Vr\265C\232"
+	.ascii	"\304\252hS\355\316\326d\225\277\\Bo\222\017\2373NS\357\b\333"
+	.ascii	"\200\"\005Z\227\311\203\013BfE\336\261Y\300\0276\201\004\243"
+	.ascii	"\247\255\225\223i5\250\250\345\335\f\305RA\034\321\177Rh])\207"
+	.ascii	"\2266\036\346\324A6\003\214D\344f\335\004[h\307i<\220\023~8\344"
+	.ascii	"\215\307\016\002u\375\222\020(\003\351\267\004\206\262W\262\037"
+	.ascii	"\331\323<q\210:CU\374\270t\377\f\322\223\2324N*\374\016\325`"
+	.ascii	"\376\177\234\352@\355%Bq\360n2\302JWx\023\372\231\250\177\252"
+	.ascii	"\266WP\204\212\301=\272\225\221\177\234\3648Z\371\030($\266b"
+	.ascii	"\315\276\017\315\036-\232HW\224\320\224\321\263\264\031\213\023"
+	.ascii	"?\232\006A\207\256?\024A\224P\ry\002\201H\234uk\357\021\266V"
+	.ascii	"j\016 \347\325\255\263\034\312\202\202\336c\355\350G6*\325\232"
+	.ascii	"\264.Jp\365Z\030Q\033t1\033\022@\346(o\005]cY+n\244\343\300\345"
+	.ascii	"\374\346$\362\256Z\230|\362[\304G\033>\322\316A\037\267V\366"
+	.ascii	"3\037\317\312\332\261\275f\311\177\245\376\351\264\240\253F\340"
+	.ascii	"Tv\326\005=d;;\362\306\364\231kn\024\342\326(\241T-*!\307\305"
+	.ascii	"\307SJ\002\022\033\323\262tr\023\2076\235@ai\3630W\363H\213\356"
+	.ascii	"59\222\354\361\027$\026\247A\024\335#\233\247\330\345\244\035"
+	.ascii	"\034Z\375\256L\234np\367\375\232\364PhA\252\f\274\323\347&\370"
+	.ascii	"\316n\370\214\255W\032\024r0*\366\362\300\326\005\265_h\202\024"
+	.ascii	"\3760\333\302\261\250\017\326\324\236Q@@a\037r\035\243R\374\210"
+	.ascii	"\r4\234Y\320\301\032E\360\002&\332\347^\264\245\3568\357e\021"
+	.ascii	"\352\226GV\2059\"_\301H/\314\337\2179G=\301T'\333\t\376\016\314"
+	.ascii	"\235\211\364c\265\025\021\005\r\035\360\034\026Nk\300W!7\246"
+	.ascii	"R\r}\227<\373D\276a\211\243\316\223\302\347\212s\346\265\207"
+	.ascii	"\025\315\277:\021\220j\205\025U\037\334\336,\275dTf\202\\\304"
+	.ascii	"\207j\034\326c\030\306\3329\2717Kx9'\205\2622\244x\253\216\235"
+	.ascii	"7\210'\036\246\360\355 \242G\215F\272\304\360-\220\370~_E\341"
+	.ascii	"\032@\300"
+	.string	"\350W#\257\327S=F!\326TK*\004p?\\,#\031Jvj\221T\321\246 >\250\bUQ$X\322k\3200\223Oq\267\255\350\221*\374|\235\b6\022\t\313Z\246\273\333\316\225\222p\357Z=\312)LG\363\016,\206\365\374+\236\212\255E\224\007!\311z?a\3668p\206\331\371hFt\002LD=}\217\332\021\223\3559\321\317\301?\345#V\314\203\037\026i\257\245\025;h\353\006G\255\211\031\277\201\277\312\371\033?\225*V\212\277/\263\013\265\311\303}\315H\342\033\006\343D:U#vocu\201}\266\250\027\223\027AK\353%\017>\356A\255\255fj\355\347&sn\201\327b\005\264\222qX\037\034\327\202'\305\262\357\261\306\267\364\\\223\220\314<\003\374\225\020\024\245\016\357\362G\302\217N\322]\331\035\316\324\372\225\305\345J\350\023K\0366c\004\225\366H\030\253\355`\346\337P\214\022"
+	.string	"\365\261\303\020\006\211\310\250`\305P\237\002_N\224`\353x\314\026\006\275\260WM\236\327\202\266S\214\244?\320\257\207\252zY\245x\345\364\277\370\007*\323\021\354\334\317aa\200\227\210\013\2344"
+	.ascii	"\274\306\017\334sh\342\301\b\303\361\275\211 U\244\320\305\323"
+	.ascii	"\201j\344\320\013O\367\340\322\330\305\371J\312\275\334F\317"
+	.ascii	"\3348Qns\202\334\"x56\354\344#k\312\3078T\205%-qe5\bP\364\234"
+	.ascii	"NG\232y\263J6\024\227Q\315eZ\345W2\230\226\016\225\202\203r\240"
+	.ascii	"\300\034)\221\333\266B\367oE5\031\376\023z\231\223!\223o\374"
+	.ascii	"\332\301\236\023\306\270\016G\301\243\2363\315*\211x47H\375\262"
+	.ascii	"HQK\312\332o\362\320\027XT\330\025X;\340\344F\332\t\007\310\207"
+	.ascii	"\027\342;+TA\274 \251\0206O\234\270\244\223\n\n\330\003\204\253"
+	.ascii	"\n1\253\231:\223\245\334\200V\020/\346$\024\214\236Q\037Z\334"
+	.string	"\255\352\303p\200E\241lw\0378\013\353\255\312\003\203\202\001\202\326\0027H\035\241Z\362S\320\307\244%0\312\307\356\374O7|\227\3536\3369W\371\370\270\360\306\372\244\272\220\370^^\031P\263\271\017cW\362\342}\374\036\340\212\205\264\303,\237#&\023\032\303PB\333\302S-<\240(\255\035\274\341\037s\372\250\303\311N\356\314\246\316\305\367I/\362\236+\273\350\277\362\016\313\273\033\357\272d\027o9\201M0\376\\\034\t\254\302\225\224U8\241wQ\310 \307\357\354\227\007Yk\273\\,\030\241\376\242\024&\033\271\005mo\r\b+\035\002\361\303\303\034\013\310\315\337|\333\230\rgw\362\214(\033w\"\244a\335,jy\321H\310Qh\024\rl\r1\037\340L\364r\224\022\237\005]\232\270\001b\301\334\361\302\0356k\323d\365p%W)l\305\315\322r\345\331\017k\f\221^\356\273\362\274\344\264\nc"
+	.ascii	"\352vz7[l\301B\272\275&\342\310\267\024}V\273pz5\362\031\256"
+	.ascii	"\2648f\255[\315\013i \3323\250\233WJWW\353%\355F\216%|k\357\022"
+	.ascii	"\201/\036\355\230iW\225r\023B\214\n\301\256:\267\310\270)\300"
+	.ascii	"j1\356\233N\250\212\231\275e\2363\027u>\320wQ\347\2724\365J\361"
+	.ascii	"\037\030\270\375\b\354y8\307\206%\255\255\037f|q\307\f\217\241"
+	.ascii	"U?;\335\222\002\177\234\201*\200\tQ\037\314\355g\327\333m\003"
+	.ascii	"=\217T\367YbD\314\262\270\363\350]r\354\342\240Y\364\311\361"
+	.ascii	"[\321\323\222\255\f\307\006\212\r\276\031\257\341\330\224A\033"
+	.ascii	"\021%\233\004dT\306\020J\360\3351S\222kKQ\007\035\205\033I\205"
+	.ascii	"s\006\364\227\323\325\334\377\020\206\364\266\332c\261\030\002"
+	.ascii	"\235\364\032\026\306\307\2565\214W\237\346\232\206\254G\272\246"
+	.ascii	"\271\f\034NX\307\243\034\211\341h\003\005r\003R\fg\347qU:\313"
+	.ascii	"\225\033/\262\022\036\237\003\215~`\304='\270\n\037\317\315e"
+	.ascii	"\025\307\306\375\262\264\375\t\221\373\213(\267G4\252\262\265"
+	.ascii	"\220 g\004\365\005H\277g\226(\310\272B\320\026K\210\354)\320"
+	.ascii	"_\240'Rt\207nl}\265\273\021\347\347\242\017i\3547\036s\216|\377"
+	.ascii	"\250\374\267s\320\336\364r\206\364w\n\301p<\013>\340\241\377"
+	.ascii	"\324\036F\230\231\352\334\334c\337\3331\354s@\037\241\317/\357"
+	.ascii	"\263\316\374[\207\037\033\335\002\315D\317\016\277J\3313\254"
+	.ascii	"B\337e3\214HF\252\367\237\374\357\323\335\357\315\317w\2479\356"
+	.ascii	"\3279WYa\317\225\035\224\353\360\034\207Sg\247z\035\272:\272"
+	.ascii	"\003\332\323\036,\207\254\324\367\033go{\366\361u\300\353/\244"
+	.ascii	"U;n\006\222?\337\310\356\305\365\375\034~W\246\267\360\355o\237"
+	.ascii	"\374\363\363\256<\332\373\212\227V\276\201\376\234p\334\365\367"
+	.ascii	"\351C"
+	.ascii	"\367k\351NR'\f.E\\\033\277\212o\232p\300\256A\035\032\246\220"
+	.ascii	"\307\250\200\343\261m\367\033\313\2277\340\034\032\357\354\216"
+	.ascii	"\240\367\313\364?:\204\362\222\341\221\027\273\353Y%\257\214"
+	.ascii	"\363\tw\311\277\332d\177\353\376\200ZL\2226I\217C/-}\370-\017"
+	.ascii	"\260h\311\340\3648\376\321w\027\210\373\036\237\315\177\232\\"
+	.ascii	"\256u(peK\346\355\251\276\324\n\330\302\272\312\027<NW"
+	.text
+	.section	.gnu.lto_.symtab.3be6c9039492526,"e",@progbits
+	.string	"AltHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"airplaneConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"updateSonarAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"isThrustFacingDownwards"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"calculateAltHoldThrottleAdjustment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"pgResetTemplate_airplaneConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"airplaneConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"airplaneConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3be6c9039492526,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
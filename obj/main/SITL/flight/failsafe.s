@@ -0,0 +1,12133 @@
+	.file	"failsafe.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/drivers/io_types.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/fc/rc_controls.h"
+	.file 9 "./src/main/fc/rc_modes.h"
+	.file 10 "./src/main/fc/runtime_config.h"
+	.file 11 "./src/main/flight/failsafe.h"
+	.file 12 "./src/main/io/beeper.h"
+	.file 13 "./src/main/rx/rx.h"
+	.file 14 "./src/main/flight/failsafe.c"
+	.file 15 "./src/main/drivers/time.h"
+	.file 16 "./src/main/fc/fc_core.h"
+	.file 17 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	failsafe.c.7ad395c3
+	.weak	failsafe.c.7ad395c3
+failsafe.c.7ad395c3:
+	.long	0xb1c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1798
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1517
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1518
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1519
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1520
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1521
+	.uleb128 0x3
+	.long	.LASF1522
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1523
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1524
+	.uleb128 0x3
+	.long	.LASF1525
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1526
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1527
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1528
+	.uleb128 0x3
+	.long	.LASF1529
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1530
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1531
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1532
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x1c
+	.long	.LASF1799
+	.byte	0x11
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb7
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1533
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1534
+	.uleb128 0x3
+	.long	.LASF1535
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x110
+	.uleb128 0x6
+	.long	.LASF1536
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF1537
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF1538
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1540
+	.byte	0x4
+	.byte	0x29
+	.byte	0xf
+	.long	0x11c
+	.uleb128 0x1d
+	.long	0x12c
+	.uleb128 0x7
+	.long	0x8a
+	.uleb128 0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x5
+	.long	0x14b
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x13
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x14b
+	.byte	0
+	.uleb128 0xb
+	.long	0x110
+	.uleb128 0xc
+	.long	.LASF1675
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2b
+	.long	0x1a9
+	.uleb128 0x14
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xdd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1541
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1542
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1a9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1a9
+	.byte	0x10
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x1ae
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x4
+	.byte	0x34
+	.byte	0x7
+	.long	0x12c
+	.byte	0x20
+	.byte	0
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0xb
+	.long	0x1a9
+	.uleb128 0x3
+	.long	.LASF1545
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x150
+	.uleb128 0xe
+	.long	0x1b3
+	.uleb128 0x3
+	.long	.LASF1546
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF1547
+	.byte	0x6
+	.byte	0x18
+	.byte	0x11
+	.long	0x9f
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1548
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x309
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1800
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.byte	0xe
+	.long	0x364
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x1
+	.uleb128 0x20
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x8
+	.byte	0x27
+	.long	0x37c
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1609
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x9
+	.byte	0x18
+	.long	0x478
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1648
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x3
+	.long	0x388
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xa
+	.byte	0x15
+	.long	0x49c
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1684
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xa
+	.byte	0x24
+	.long	0x4f9
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF1659
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1660
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF1661
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0xa
+	.byte	0x30
+	.byte	0x3
+	.long	0x4a8
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xa
+	.byte	0x3c
+	.long	0x556
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF1671
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1672
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF1673
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1674
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x505
+	.uleb128 0xc
+	.long	.LASF1676
+	.byte	0xa
+	.byte	0xb
+	.byte	0x20
+	.long	0x5bd
+	.uleb128 0x2
+	.long	.LASF1677
+	.byte	0xb
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1678
+	.byte	0xb
+	.byte	0x22
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1679
+	.byte	0xb
+	.byte	0x23
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0xb
+	.byte	0x24
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0xb
+	.byte	0x25
+	.byte	0xe
+	.long	0xab
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0xb
+	.byte	0x26
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1683
+	.byte	0xb
+	.byte	0x27
+	.byte	0x3
+	.long	0x562
+	.uleb128 0xe
+	.long	0x5bd
+	.uleb128 0x8
+	.long	.LASF1685
+	.byte	0xb
+	.byte	0x29
+	.byte	0x19
+	.long	0x5bd
+	.uleb128 0x8
+	.long	.LASF1686
+	.byte	0xb
+	.byte	0x29
+	.byte	0x48
+	.long	0x5bd
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xb
+	.byte	0x2b
+	.long	0x616
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0xb
+	.byte	0x32
+	.byte	0x3
+	.long	0x5e6
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xb
+	.byte	0x34
+	.long	0x63a
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1696
+	.byte	0xb
+	.byte	0x37
+	.byte	0x3
+	.long	0x622
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xb
+	.byte	0x39
+	.long	0x65e
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1699
+	.byte	0x28
+	.byte	0xb
+	.byte	0x3e
+	.long	0x707
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0xb
+	.byte	0x3f
+	.byte	0xd
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1701
+	.byte	0xb
+	.byte	0x40
+	.byte	0x9
+	.long	0x1dc
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1702
+	.byte	0xb
+	.byte	0x41
+	.byte	0x9
+	.long	0x1dc
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1703
+	.byte	0xb
+	.byte	0x42
+	.byte	0xe
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1704
+	.byte	0xb
+	.byte	0x43
+	.byte	0xe
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1705
+	.byte	0xb
+	.byte	0x44
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1706
+	.byte	0xb
+	.byte	0x45
+	.byte	0xe
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1707
+	.byte	0xb
+	.byte	0x46
+	.byte	0xe
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1708
+	.byte	0xb
+	.byte	0x47
+	.byte	0xe
+	.long	0xb7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1709
+	.byte	0xb
+	.byte	0x48
+	.byte	0xe
+	.long	0xb7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1710
+	.byte	0xb
+	.byte	0x49
+	.byte	0x15
+	.long	0x616
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0xb
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x63a
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1712
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x3
+	.long	0x65e
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xc
+	.byte	0x17
+	.long	0x7a3
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1735
+	.byte	0xc
+	.byte	0x31
+	.byte	0x3
+	.long	0x713
+	.uleb128 0x15
+	.long	0x93
+	.long	0x7bf
+	.uleb128 0x16
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1736
+	.byte	0xd
+	.byte	0x4f
+	.byte	0x10
+	.long	0x7af
+	.uleb128 0xc
+	.long	.LASF1737
+	.byte	0x2c
+	.byte	0xd
+	.byte	0x75
+	.long	0x91d
+	.uleb128 0x2
+	.long	.LASF1738
+	.byte	0xd
+	.byte	0x76
+	.byte	0xd
+	.long	0x91d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1739
+	.byte	0xd
+	.byte	0x77
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1740
+	.byte	0xd
+	.byte	0x78
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1741
+	.byte	0xd
+	.byte	0x79
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1742
+	.byte	0xd
+	.byte	0x7a
+	.byte	0xd
+	.long	0x9f
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1743
+	.byte	0xd
+	.byte	0x7b
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1744
+	.byte	0xd
+	.byte	0x7c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1745
+	.byte	0xd
+	.byte	0x7d
+	.byte	0xd
+	.long	0x1d0
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1746
+	.byte	0xd
+	.byte	0x7e
+	.byte	0xd
+	.long	0x1d0
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1747
+	.byte	0xd
+	.byte	0x7f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1748
+	.byte	0xd
+	.byte	0x80
+	.byte	0xd
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1749
+	.byte	0xd
+	.byte	0x81
+	.byte	0xd
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1750
+	.byte	0xd
+	.byte	0x82
+	.byte	0xd
+	.long	0x9f
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1751
+	.byte	0xd
+	.byte	0x83
+	.byte	0xd
+	.long	0x9f
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1752
+	.byte	0xd
+	.byte	0x84
+	.byte	0xe
+	.long	0xab
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1753
+	.byte	0xd
+	.byte	0x85
+	.byte	0xe
+	.long	0xab
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1754
+	.byte	0xd
+	.byte	0x86
+	.byte	0xe
+	.long	0xab
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1755
+	.byte	0xd
+	.byte	0x87
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0xd
+	.byte	0x88
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1757
+	.byte	0xd
+	.byte	0x89
+	.byte	0xd
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0xd
+	.byte	0x8a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0xd
+	.byte	0x8b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1760
+	.byte	0xd
+	.byte	0x8c
+	.byte	0xe
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1761
+	.byte	0xd
+	.byte	0x8e
+	.byte	0xe
+	.long	0xab
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1762
+	.byte	0xd
+	.byte	0x8f
+	.byte	0xe
+	.long	0xab
+	.byte	0x28
+	.byte	0
+	.uleb128 0x15
+	.long	0x9f
+	.long	0x92d
+	.uleb128 0x16
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0xd
+	.byte	0x90
+	.byte	0x3
+	.long	0x7cb
+	.uleb128 0xe
+	.long	0x92d
+	.uleb128 0x8
+	.long	.LASF1764
+	.byte	0xd
+	.byte	0x92
+	.byte	0x13
+	.long	0x92d
+	.uleb128 0x9
+	.long	.LASF1776
+	.byte	0x38
+	.byte	0x18
+	.long	0x707
+	.uleb128 0x8
+	.long	.LASF1765
+	.byte	0xe
+	.byte	0x3a
+	.byte	0x1f
+	.long	0x5c9
+	.uleb128 0x17
+	.long	0x5ce
+	.byte	0x50
+	.uleb128 0x17
+	.long	0x5da
+	.byte	0x78
+	.uleb128 0x8
+	.long	.LASF1766
+	.byte	0xe
+	.byte	0x3a
+	.byte	0xa7
+	.long	0x1bf
+	.uleb128 0x21
+	.long	0x96d
+	.byte	0xd3
+	.uleb128 0x22
+	.long	0x955
+	.byte	0x3c
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1767
+	.byte	0xc
+	.byte	0x3c
+	.long	0x997
+	.uleb128 0x7
+	.long	0x7a3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1768
+	.byte	0xa
+	.byte	0x38
+	.long	0x9a8
+	.uleb128 0x7
+	.long	0x4f9
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1772
+	.byte	0x8
+	.byte	0x72
+	.byte	0x5
+	.long	0x1dc
+	.uleb128 0x23
+	.long	.LASF1787
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x6
+	.uleb128 0xf
+	.long	.LASF1769
+	.byte	0xa
+	.byte	0x37
+	.long	0x9cd
+	.uleb128 0x7
+	.long	0x4f9
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1770
+	.byte	0xa
+	.byte	0x67
+	.byte	0xa
+	.long	0xab
+	.long	0x9e3
+	.uleb128 0x7
+	.long	0x556
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1771
+	.byte	0xa
+	.byte	0x66
+	.byte	0xa
+	.long	0xab
+	.long	0x9f9
+	.uleb128 0x7
+	.long	0x556
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1773
+	.byte	0x8
+	.byte	0x6f
+	.byte	0x12
+	.long	0x37c
+	.uleb128 0x11
+	.long	.LASF1774
+	.byte	0x9
+	.byte	0x66
+	.byte	0x5
+	.long	0x1dc
+	.long	0xa1b
+	.uleb128 0x7
+	.long	0x478
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1775
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1c4
+	.uleb128 0x18
+	.long	.LASF1785
+	.byte	0xa8
+	.long	0xa69
+	.uleb128 0x9
+	.long	.LASF1777
+	.byte	0xae
+	.byte	0x9
+	.long	0x1dc
+	.uleb128 0x9
+	.long	.LASF1778
+	.byte	0xaf
+	.byte	0x9
+	.long	0x1dc
+	.uleb128 0x9
+	.long	.LASF1779
+	.byte	0xb0
+	.byte	0x9
+	.long	0x1dc
+	.uleb128 0x9
+	.long	.LASF1780
+	.byte	0xb1
+	.byte	0x12
+	.long	0x7a3
+	.uleb128 0x9
+	.long	.LASF1781
+	.byte	0xb8
+	.byte	0x9
+	.long	0x1dc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1782
+	.byte	0xa0
+	.uleb128 0xa
+	.long	.LASF1783
+	.byte	0x98
+	.uleb128 0xa
+	.long	.LASF1784
+	.byte	0x92
+	.uleb128 0x18
+	.long	.LASF1786
+	.byte	0x8d
+	.long	0xa92
+	.uleb128 0x24
+	.long	.LASF1801
+	.byte	0xe
+	.byte	0x8d
+	.byte	0x23
+	.long	0xb7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1788
+	.byte	0x88
+	.byte	0x5
+	.long	0x1dc
+	.uleb128 0x25
+	.long	.LASF1802
+	.byte	0xe
+	.byte	0x80
+	.byte	0xd
+	.long	0xab6
+	.uleb128 0x26
+	.uleb128 0x27
+	.string	"i"
+	.byte	0xe
+	.byte	0x82
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1803
+	.byte	0xe
+	.byte	0x76
+	.byte	0xd
+	.uleb128 0x12
+	.long	.LASF1795
+	.byte	0xe
+	.byte	0x71
+	.byte	0xc
+	.long	0x1dc
+	.uleb128 0xa
+	.long	.LASF1789
+	.byte	0x6c
+	.uleb128 0xd
+	.long	.LASF1790
+	.byte	0x67
+	.byte	0x5
+	.long	0x1dc
+	.uleb128 0xd
+	.long	.LASF1791
+	.byte	0x62
+	.byte	0x5
+	.long	0x1dc
+	.uleb128 0xd
+	.long	.LASF1792
+	.byte	0x5d
+	.byte	0x11
+	.long	0x616
+	.uleb128 0xa
+	.long	.LASF1793
+	.byte	0x55
+	.uleb128 0xa
+	.long	.LASF1794
+	.byte	0x48
+	.uleb128 0x12
+	.long	.LASF1796
+	.byte	0xd
+	.byte	0x92
+	.byte	0x65
+	.long	0xb09
+	.uleb128 0xb
+	.long	0x939
+	.uleb128 0x12
+	.long	.LASF1797
+	.byte	0xb
+	.byte	0x29
+	.byte	0x83
+	.long	0xb1a
+	.uleb128 0xb
+	.long	0x5c9
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 58
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 18 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 23 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 24 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 34 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.file 35 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 37 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 38 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 39 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 40 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1017
+	.byte	0x4
+	.byte	0x4
+	.file 42 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2a
+	.file 43 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 46 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x4
+	.file 47 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2f
+	.file 48 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 49 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x31
+	.file 50 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 51 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1438
+	.byte	0x4
+	.file 52 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.file 53 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 54 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 55 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1448
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.byte	0x4
+	.file 56 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1031
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1057
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1069
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1437
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1472
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1491
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1516
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1804
+	.long	.LASF1805
+	.long	.LASF1806
+	.long	.LASF1807
+	.long	.LASF1808
+	.long	.LASF1809
+	.long	.LASF1810
+	.long	.LASF1811
+	.long	.LASF1812
+	.long	.LASF1813
+	.long	.LASF1814
+	.long	.LASF1815
+	.long	.LASF1816
+	.long	.LASF1817
+	.long	.LASF1818
+	.long	.LASF1819
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x39
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1820
+	.byte	0xc
+	.long	.LASF1821
+	.byte	0xc
+	.long	.LASF1822
+	.byte	0xc
+	.long	.LASF1823
+	.byte	0x3
+	.long	.LASF1824
+	.byte	0x2
+	.long	.LASF1825
+	.byte	0x4
+	.long	.LASF1826
+	.byte	0x4
+	.long	.LASF1827
+	.byte	0x5
+	.long	.LASF1828
+	.byte	0x5
+	.long	.LASF1829
+	.byte	0x5
+	.long	.LASF1830
+	.byte	0x6
+	.long	.LASF1831
+	.byte	0x7
+	.long	.LASF1832
+	.byte	0x8
+	.long	.LASF1833
+	.byte	0x6
+	.long	.LASF1824
+	.byte	0x4
+	.long	.LASF1834
+	.byte	0x5
+	.long	.LASF1835
+	.byte	0x9
+	.long	.LASF1836
+	.byte	0xf
+	.long	.LASF1837
+	.byte	0x10
+	.long	.LASF1838
+	.byte	0x10
+	.long	.LASF1838
+	.byte	0xf
+	.long	.LASF1839
+	.byte	0xc
+	.long	.LASF1840
+	.byte	0xf
+	.long	.LASF1841
+	.byte	0xf
+	.long	.LASF1842
+	.byte	0xc
+	.long	.LASF1843
+	.byte	0xc
+	.long	.LASF1844
+	.byte	0xe
+	.long	.LASF1845
+	.byte	0xc
+	.long	.LASF1846
+	.byte	0xd
+	.long	.LASF1847
+	.byte	0xd
+	.long	.LASF1848
+	.byte	0xc
+	.long	.LASF1849
+	.byte	0xc
+	.long	.LASF1850
+	.byte	0xc
+	.long	.LASF1851
+	.byte	0xb
+	.long	.LASF1852
+	.byte	0xa
+	.long	.LASF1853
+	.byte	0x10
+	.long	.LASF1854
+	.byte	0xa
+	.long	.LASF1855
+	.byte	0x1
+	.long	.LASF1856
+	.byte	0x2
+	.long	.LASF1857
+	.byte	0x1
+	.long	.LASF1858
+	.byte	0x3
+	.long	.LASF1859
+	.byte	0x5
+	.long	.LASF1860
+	.byte	0x4
+	.long	.LASF1861
+	.byte	0x4
+	.long	.LASF1862
+	.byte	0x4
+	.long	.LASF1863
+	.byte	0x4
+	.long	.LASF1864
+	.byte	0x4
+	.long	.LASF1865
+	.byte	0x4
+	.long	.LASF1866
+	.byte	0x4
+	.long	.LASF1867
+	.byte	0x2
+	.long	.LASF1868
+	.byte	0x4
+	.long	.LASF1869
+	.byte	0x4
+	.long	.LASF1870
+	.byte	0x4
+	.long	.LASF1871
+	.byte	0x4
+	.long	.LASF1872
+	.byte	0x4
+	.long	.LASF1873
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1429:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1185:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1468:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1065:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1259:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1205:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1756:
+	.string	"rcInterpolationChannels"
+.LASF1682:
+	.string	"failsafe_procedure"
+.LASF1076:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1646:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF706:
+	.string	"USE_CLI "
+.LASF1160:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF1176:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF793:
+	.string	"USE_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1074:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1332:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF912:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1642:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1522:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF913:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1548:
+	.string	"_Bool"
+.LASF1747:
+	.string	"spektrum_sat_bind"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF1278:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF1038:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1024:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1557:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1293:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1728:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1679:
+	.string	"failsafe_throttle"
+.LASF1722:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1238:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1028:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1356:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1518:
+	.string	"short unsigned int"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF927:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1477:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1061:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF1704:
+	.string	"validRxDataReceivedAt"
+.LASF1751:
+	.string	"rssi_invert"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1425:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1184:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF967:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1264:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1397:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1343:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF931:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1554:
+	.string	"OWNER_LED"
+.LASF1167:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1113:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1531:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1662:
+	.string	"armingDisableFlags_e"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1004:
+	.string	"PG_VTX_CONFIG 515"
+.LASF952:
+	.string	"PG_RX_CONFIG 24"
+.LASF1364:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1208:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF1447:
+	.string	"BEEP_ON do {} while (0)"
+.LASF922:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1089:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1296:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1058:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1501:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1307:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF963:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1091:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1053:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1727:
+	.string	"BEEPER_READY_BEEP"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1084:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1449:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1388:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1632:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF971:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1289:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1352:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1424:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1580:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1794:
+	.string	"failsafeReset"
+.LASF1092:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1031:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1050:
+	.string	"BIT(x) (1 << (x))"
+.LASF1585:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1020:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1251:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF897:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1406:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF1593:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1346:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1063:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1116:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1475:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1582:
+	.string	"OWNER_BARO_EXTI"
+.LASF948:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1788:
+	.string	"failsafeIsReceivingRxData"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF794:
+	.string	"USE_PWM"
+.LASF1211:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1157:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1560:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1615:
+	.string	"BOXMAG"
+.LASF1042:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF968:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF981:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF982:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1538:
+	.string	"PGR_SIZE_MASK"
+.LASF1782:
+	.string	"failsafeOnValidDataFailed"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1139:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1439:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1445:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1776:
+	.string	"failsafeState"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1496:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1326:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1734:
+	.string	"BEEPER_PREFERENCE"
+.LASF1625:
+	.string	"BOXLEDLOW"
+.LASF1737:
+	.string	"rxConfig_s"
+.LASF1763:
+	.string	"rxConfig_t"
+.LASF1583:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1217:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1000:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1595:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF924:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1389:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1073:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1612:
+	.string	"BOXHORIZON"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1746:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF1374:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1474:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1749:
+	.string	"rssi_channel"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1584:
+	.string	"OWNER_USB_DETECT"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1308:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1254:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1232:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1471:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1626:
+	.string	"BOXLLIGHTS"
+.LASF1262:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"OWNER_SONAR_ECHO"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1349:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1759:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1119:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1613:
+	.string	"BOXBARO"
+.LASF915:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1553:
+	.string	"OWNER_SERVO"
+.LASF1052:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF765:
+	.string	"ACC "
+.LASF1767:
+	.string	"beeper"
+.LASF1674:
+	.string	"flightModeFlags_e"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF710:
+	.string	"USE_PWM "
+.LASF1714:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1379:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1803:
+	.string	"failsafeActivate"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF1724:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1480:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1448:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1106:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1740:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF914:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1093:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1765:
+	.string	"pgResetTemplate_failsafeConfig"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1703:
+	.string	"rxDataFailurePeriod"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1752:
+	.string	"midrc"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1492:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1523:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1525:
+	.string	"__uint16_t"
+.LASF1461:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1552:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1436:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1141:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1579:
+	.string	"OWNER_RX_SPI_CS"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1450:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1446:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1789:
+	.string	"failsafeStartMonitoring"
+.LASF1793:
+	.string	"failsafeInit"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1742:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1152:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1191:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"THROTTLE_LOW"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1467:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF911:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1507:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1008:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1257:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1005:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1709:
+	.string	"receivingRxDataPeriodPreset"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1664:
+	.string	"HORIZON_MODE"
+.LASF1517:
+	.string	"unsigned char"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1784:
+	.string	"failsafeOnRxResume"
+.LASF1741:
+	.string	"halfDuplex"
+.LASF1015:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1019:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF916:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1244:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1281:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF749:
+	.string	"USE_NAV "
+.LASF961:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1298:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1743:
+	.string	"rx_spi_id"
+.LASF1526:
+	.string	"__uint32_t"
+.LASF992:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF1456:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1786:
+	.string	"failsafeOnRxSuspend"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF939:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1610:
+	.string	"BOXARM"
+.LASF1245:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1758:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1673:
+	.string	"FAILSAFE_MODE"
+.LASF767:
+	.string	"GYRO "
+.LASF1753:
+	.string	"mincheck"
+.LASF1227:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1163:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1026:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1109:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1021:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF1627:
+	.string	"BOXCALIB"
+.LASF1675:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1708:
+	.string	"receivingRxDataPeriod"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF906:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1187:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF902:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1591:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF721:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1479:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1248:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1772:
+	.string	"isUsingSticksForArming"
+.LASF1600:
+	.string	"AUX2"
+.LASF1601:
+	.string	"AUX3"
+.LASF1602:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1604:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1606:
+	.string	"AUX8"
+.LASF1667:
+	.string	"GPS_HOME_MODE"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1678:
+	.string	"failsafe_off_delay"
+.LASF1754:
+	.string	"maxcheck"
+.LASF1723:
+	.string	"BEEPER_RX_SET"
+.LASF1596:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1719:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1505:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1783:
+	.string	"failsafeOnValidDataReceived"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1574:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1395:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1341:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1046:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF928:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1504:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1766:
+	.string	"failsafeConfig_Registry"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1280:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1094:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1206:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1536:
+	.string	"PGR_PGN_MASK"
+.LASF1633:
+	.string	"BOXSERVO1"
+.LASF1634:
+	.string	"BOXSERVO2"
+.LASF1635:
+	.string	"BOXSERVO3"
+.LASF1469:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF900:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1018:
+	.string	"IO_TAG_NONE 0"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1415:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1344:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF966:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1442:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1427:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF976:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1077:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1696:
+	.string	"failsafeRxLinkState_e"
+.LASF1002:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1659:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1451:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1386:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1391:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1233:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1112:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1546:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1706:
+	.string	"throttleLowPeriod"
+.LASF1510:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1654:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1023:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1541:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1748:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF986:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1666:
+	.string	"BARO_MODE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1762:
+	.string	"rx_max_usec"
+.LASF929:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1735:
+	.string	"beeperMode_e"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1047:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1672:
+	.string	"SONAR_MODE"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1515:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1588:
+	.string	"OWNER_INVERTER"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1502:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1569:
+	.string	"OWNER_SPI_MOSI"
+.LASF1398:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"MAG_MODE"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1530:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1044:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1658:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1790:
+	.string	"failsafeIsActive"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF1649:
+	.string	"ARMED"
+.LASF980:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1209:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1506:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1155:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1048:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1630:
+	.string	"BOXTELEMETRY"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1013:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1337:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1648:
+	.string	"boxId_e"
+.LASF1250:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1182:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1726:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF1203:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1275:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF1661:
+	.string	"ARMING_DISABLED_BST"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF728:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1458:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF792:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF858:
+	.string	"__need_size_t"
+.LASF918:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1547:
+	.string	"ioTag_t"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF1710:
+	.string	"phase"
+.LASF1777:
+	.string	"receivingRxData"
+.LASF905:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF964:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF1687:
+	.string	"FAILSAFE_IDLE"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1361:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1095:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1181:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF946:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1218:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1493:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1371:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1750:
+	.string	"rssi_scale"
+.LASF954:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF921:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1792:
+	.string	"failsafePhase"
+.LASF1443:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1697:
+	.string	"FAILSAFE_PROCEDURE_AUTO_LANDING"
+.LASF1797:
+	.string	"failsafeConfig"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1641:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1651:
+	.string	"ARMING_DISABLED_NO_GYRO"
+.LASF1003:
+	.string	"PG_VCD_CONFIG 514"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF1328:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1310:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1373:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1755:
+	.string	"rcInterpolation"
+.LASF1032:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1639:
+	.string	"BOX3DDISABLE"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1239:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1457:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1039:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1158:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1104:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF1068:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1001:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1376:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1542:
+	.string	"address"
+.LASF1045:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1367:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1253:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1454:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1534:
+	.string	"float"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1030:
+	.string	"IOCFG_IPU 0"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1778:
+	.string	"armed"
+.LASF877:
+	.string	"NULL"
+.LASF1485:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1421:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"failsafeApplyControlInput"
+.LASF960:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF1566:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1124:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1705:
+	.string	"validRxDataFailedAt"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1066:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF978:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1773:
+	.string	"calculateThrottleStatus"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1684:
+	.string	"armingFlags"
+.LASF1365:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1693:
+	.string	"failsafePhase_e"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1483:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1242:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1539:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF936:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1407:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1676:
+	.string	"failsafeConfig_s"
+.LASF1683:
+	.string	"failsafeConfig_t"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1175:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"UNIT_TESTED "
+.LASF935:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF944:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1729:
+	.string	"BEEPER_ARMED"
+.LASF1075:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1798:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1466:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1701:
+	.string	"monitoring"
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF1653:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF919:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1136:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1096:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1221:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1385:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1476:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1316:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1202:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1148:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF988:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF930:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1358:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF879:
+	.string	"__need_NULL"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF901:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1733:
+	.string	"BEEPER_ALL"
+.LASF709:
+	.string	"USE_PPM "
+.LASF1713:
+	.string	"BEEPER_SILENCE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1087:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1550:
+	.string	"OWNER_PWMINPUT"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1668:
+	.string	"GPS_HOLD_MODE"
+.LASF1462:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF953:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1650:
+	.string	"WAS_EVER_ARMED"
+.LASF1229:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1544:
+	.string	"reset"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF937:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1721:
+	.string	"BEEPER_BAT_LOW"
+.LASF1034:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF819:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1669:
+	.string	"HEADFREE_MODE"
+.LASF1572:
+	.string	"OWNER_SDCARD"
+.LASF1707:
+	.string	"landingShouldBeFinishedAt"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1416:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF977:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF898:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1771:
+	.string	"enableFlightMode"
+.LASF1529:
+	.string	"int16_t"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1521:
+	.string	"signed char"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF840:
+	.string	"__size_t__ "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1413:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1299:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF945:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF974:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1795:
+	.string	"failsafeShouldHaveCausedLandingByNow"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1392:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1498:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1717:
+	.string	"BEEPER_DISARMING"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF1691:
+	.string	"FAILSAFE_RX_LOSS_MONITORING"
+.LASF1340:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF1110:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1500:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1618:
+	.string	"BOXCAMSTAB"
+.LASF1078:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1455:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1799:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1265:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1638:
+	.string	"BOXAIRMODE"
+.LASF1151:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1739:
+	.string	"serialrx_provider"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF957:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF720:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1131:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1764:
+	.string	"rxConfig_System"
+.LASF1012:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1586:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1331:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1380:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF962:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1022:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF996:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1616:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1082:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1481:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1062:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1273:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1097:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF1055:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF959:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1283:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"disarm"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1472:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1088:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1781:
+	.string	"reprocessState"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1286:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1452:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1495:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1543:
+	.string	"copy"
+.LASF748:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1224:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1069:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF956:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1362:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"long int"
+.LASF1643:
+	.string	"BOXCAMERA2"
+.LASF1644:
+	.string	"BOXCAMERA3"
+.LASF949:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1080:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1009:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1562:
+	.string	"OWNER_PINDEBUG"
+.LASF1459:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1403:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1173:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1629:
+	.string	"BOXOSD"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1007:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1130:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF1656:
+	.string	"ARMING_DISABLED_LOAD"
+.LASF1677:
+	.string	"failsafe_delay"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF1268:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1154:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1302:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1043:
+	.string	"EXPAND_I(x) x"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1532:
+	.string	"uint32_t"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1464:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1685:
+	.string	"failsafeConfig_System"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1614:
+	.string	"BOXANTIGRAVITY"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1277:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1652:
+	.string	"ARMING_DISABLED_FAILSAFE"
+.LASF1134:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1511:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1775:
+	.string	"millis"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1621:
+	.string	"BOXGPSHOLD"
+.LASF1188:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF993:
+	.string	"PG_PID_CONFIG 504"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1347:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1657:
+	.string	"ARMING_DISABLED_CALIBRATING"
+.LASF1463:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF491:
+	.string	"__flexarr []"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1768:
+	.string	"unsetArmingDisabled"
+.LASF1617:
+	.string	"BOXHEADADJ"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF972:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF932:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1769:
+	.string	"setArmingDisabled"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1699:
+	.string	"failsafeState_s"
+.LASF1712:
+	.string	"failsafeState_t"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1620:
+	.string	"BOXGPSHOME"
+.LASF1563:
+	.string	"OWNER_TIMER"
+.LASF1711:
+	.string	"rxLinkState"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF973:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1490:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1335:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1311:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1197:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1370:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1528:
+	.string	"char"
+.LASF1497:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1441:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF1292:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1027:
+	.string	"IOCFG_AF_PP 0"
+.LASF1460:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1122:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1608:
+	.string	"THROTTLE_HIGH"
+.LASF1287:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF940:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1624:
+	.string	"BOXLEDMAX"
+.LASF1636:
+	.string	"BOXBLACKBOX"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF926:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1105:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1016:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1690:
+	.string	"FAILSAFE_LANDED"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1575:
+	.string	"OWNER_FLASH_CS"
+.LASF1545:
+	.string	"pgRegistry_t"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF1271:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1036:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1103:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1179:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1470:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1428:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1017:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1503:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF857:
+	.string	"__size_t "
+.LASF903:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF899:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1631:
+	.string	"BOXGTUNE"
+.LASF965:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1041:
+	.string	"STR_HELPER(x) #x"
+.LASF1223:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF970:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1567:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF1014:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1559:
+	.string	"OWNER_ADC_RSSI"
+.LASF907:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1334:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1681:
+	.string	"failsafe_throttle_low_delay"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1482:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1611:
+	.string	"BOXANGLE"
+.LASF1663:
+	.string	"ANGLE_MODE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1272:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"BOXFAILSAFE"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1736:
+	.string	"rcData"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1730:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1514:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF995:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1314:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1715:
+	.string	"BEEPER_RX_LOST"
+.LASF1200:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1146:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1011:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1143:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1409:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1780:
+	.string	"beeperMode"
+.LASF1125:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"disableFlightMode"
+.LASF1598:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1220:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1166:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF923:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1241:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF985:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF994:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1325:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1533:
+	.string	"double"
+.LASF1145:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1487:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1698:
+	.string	"FAILSAFE_PROCEDURE_DROP_IT"
+.LASF1440:
+	.string	"I2CDEV_COUNT 4"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1660:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF1570:
+	.string	"OWNER_I2C_SCL"
+.LASF1568:
+	.string	"OWNER_SPI_MISO"
+.LASF1086:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1592:
+	.string	"OWNER_COMPASS_CS"
+.LASF1486:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1054:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1236:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF933:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1757:
+	.string	"rcInterpolationInterval"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1800:
+	.string	"rc_alias"
+.LASF1400:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1010:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1647:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1796:
+	.string	"rxConfig"
+.LASF1571:
+	.string	"OWNER_I2C_SDA"
+.LASF1516:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1628:
+	.string	"BOXGOV"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1338:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF950:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1774:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1686:
+	.string	"failsafeConfig_Copy"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1383:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1142:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1079:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1418:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF979:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF958:
+	.string	"PG_GPS_CONFIG 30"
+.LASF917:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1029:
+	.string	"IOCFG_IPD 0"
+.LASF1484:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1317:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1263:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1149:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1513:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF1049:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF856:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1329:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1509:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF1067:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1085:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1434:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1791:
+	.string	"failsafeIsMonitoring"
+.LASF1435:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1785:
+	.string	"failsafeUpdateState"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1499:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1419:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF955:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF908:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1587:
+	.string	"OWNER_RX_BIND"
+.LASF984:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1599:
+	.string	"AUX1"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF1692:
+	.string	"FAILSAFE_RX_LOSS_RECOVERED"
+.LASF1323:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1590:
+	.string	"OWNER_TRANSPONDER"
+.LASF951:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1603:
+	.string	"AUX5"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1605:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1169:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1609:
+	.string	"throttleStatus_e"
+.LASF1115:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1745:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1235:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1327:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1295:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1640:
+	.string	"BOXFPVANGLEMIX"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1090:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1051:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF987:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1319:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1577:
+	.string	"OWNER_MPU_CS"
+.LASF1535:
+	.string	"pgn_t"
+.LASF998:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1494:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1382:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF818:
+	.string	"USE_I2C"
+.LASF1731:
+	.string	"BEEPER_USB"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1725:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF769:
+	.string	"MAG "
+.LASF1716:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1320:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF947:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1597:
+	.string	"PITCH"
+.LASF1401:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1488:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF934:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1670:
+	.string	"UNUSED_MODE"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1057:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1247:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1212:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1098:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1556:
+	.string	"OWNER_ADC_BATT"
+.LASF1549:
+	.string	"OWNER_FREE"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1226:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1680:
+	.string	"failsafe_kill_switch"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF904:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1761:
+	.string	"rx_min_usec"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1137:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1744:
+	.string	"rx_spi_rf_channel_count"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1190:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1489:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1140:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1465:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1689:
+	.string	"FAILSAFE_LANDING"
+.LASF1172:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1412:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1491:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1422:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1284:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1025:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1194:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1779:
+	.string	"failsafeSwitchIsOn"
+.LASF938:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1573:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF910:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1345:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1738:
+	.string	"rcmap"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1655:
+	.string	"ARMING_DISABLED_ANGLE"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1081:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1071:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1404:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1290:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1350:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1694:
+	.string	"FAILSAFE_RXLINK_DOWN"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1645:
+	.string	"BOXDSHOTREVERSE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1128:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF999:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1594:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1301:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1215:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1101:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1161:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"long unsigned int"
+.LASF1059:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1589:
+	.string	"OWNER_LED_STRIP"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1033:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1512:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1256:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF942:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF969:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1688:
+	.string	"FAILSAFE_RX_LOSS_DETECTED"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1695:
+	.string	"FAILSAFE_RXLINK_UP"
+.LASF1121:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF991:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF920:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1060:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1576:
+	.string	"OWNER_BARO_CS"
+.LASF1718:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1540:
+	.string	"pgResetFunc"
+.LASF989:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1127:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1700:
+	.string	"events"
+.LASF1760:
+	.string	"airModeActivateThreshold"
+.LASF1519:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1732:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF1437:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1430:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1508:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1368:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1622:
+	.string	"BOXPASSTHRU"
+.LASF1702:
+	.string	"active"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF997:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1083:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1305:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"OWNER_ADC"
+.LASF1524:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1581:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1438:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1619:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF1353:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF941:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1671:
+	.string	"PASSTHRU_MODE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF943:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1558:
+	.string	"OWNER_ADC_EXT"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF990:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1551:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1578:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1394:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF925:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1274:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1070:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1801:
+	.string	"usSuspendPeriod"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1410:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1825:
+	.string	"io_types.h"
+.LASF1845:
+	.string	"long-double.h"
+.LASF1851:
+	.string	"platform.h"
+.LASF1811:
+	.string	"src/main/rx"
+.LASF1807:
+	.string	"src/main/drivers"
+.LASF1856:
+	.string	"axis.h"
+.LASF1862:
+	.string	"rx_pwm.h"
+.LASF1839:
+	.string	"libc-header-start.h"
+.LASF1817:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1821:
+	.string	"stdint-intn.h"
+.LASF1827:
+	.string	"rc_controls.h"
+.LASF1852:
+	.string	"common_fc_pre.h"
+.LASF1816:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1819:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1846:
+	.string	"stubs.h"
+.LASF1812:
+	.string	"src/main/target/SITL"
+.LASF1831:
+	.string	"beeper.h"
+.LASF1833:
+	.string	"failsafe.c"
+.LASF1810:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1868:
+	.string	"io_def_generated.h"
+.LASF1815:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1830:
+	.string	"failsafe.h"
+.LASF1859:
+	.string	"config.h"
+.LASF1869:
+	.string	"bus_i2c.h"
+.LASF1841:
+	.string	"features-time64.h"
+.LASF1872:
+	.string	"vcd.h"
+.LASF1871:
+	.string	"sound_beeper.h"
+.LASF1820:
+	.string	"types.h"
+.LASF1843:
+	.string	"timesize.h"
+.LASF1835:
+	.string	"target.h"
+.LASF1837:
+	.string	"stdbool.h"
+.LASF1818:
+	.string	"/usr/include"
+.LASF1854:
+	.string	"common_fc_post.h"
+.LASF1804:
+	.string	"src/main/build"
+.LASF1849:
+	.string	"time64.h"
+.LASF1870:
+	.string	"rcc_types.h"
+.LASF1840:
+	.string	"features.h"
+.LASF1809:
+	.string	"src/main/flight"
+.LASF1848:
+	.string	"typesizes.h"
+.LASF1805:
+	.string	"src/main/common"
+.LASF1864:
+	.string	"serial.h"
+.LASF1861:
+	.string	"flash.h"
+.LASF1806:
+	.string	"src/main/config"
+.LASF0:
+	.string	"./src/main/flight/failsafe.c"
+.LASF1828:
+	.string	"rc_modes.h"
+.LASF1873:
+	.string	"motors.h"
+.LASF1822:
+	.string	"stdint-uintn.h"
+.LASF1813:
+	.string	"src/main/target"
+.LASF1867:
+	.string	"utils.h"
+.LASF1814:
+	.string	"src/main"
+.LASF1826:
+	.string	"resource.h"
+.LASF1834:
+	.string	"fc_core.h"
+.LASF1824:
+	.string	"time.h"
+.LASF1858:
+	.string	"parameter_group_ids.h"
+.LASF1855:
+	.string	"debug.h"
+.LASF1832:
+	.string	"rx.h"
+.LASF1829:
+	.string	"runtime_config.h"
+.LASF1866:
+	.string	"io_def.h"
+.LASF1808:
+	.string	"src/main/fc"
+.LASF1865:
+	.string	"io.h"
+.LASF1844:
+	.string	"cdefs.h"
+.LASF1863:
+	.string	"sdcard.h"
+.LASF1838:
+	.string	"stdint.h"
+.LASF1857:
+	.string	"build_config.h"
+.LASF1850:
+	.string	"wchar.h"
+.LASF1847:
+	.string	"stubs-64.h"
+.LASF1842:
+	.string	"wordsize.h"
+.LASF1853:
+	.string	"stddef.h"
+.LASF1860:
+	.string	"adc.h"
+.LASF1823:
+	.string	"parameter_group.h"
+.LASF1836:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\355\007"
+	.string	"4\n\247\001"
+	.string	"\024"
+	.string	"\200\331\204\226\002\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\334\225\250\316\tJ\002\007\b\b\002\t\002\006\002\n"
+	.string	"\002\001\007\217\271\213\277\005\024\005\007\002\001\b\345\227\312\267\013\004\t\236\233\221\355\007\002\n\324\210\217\002\002\013\353\262\334\316\001\f\302\327\301\252\013\r\337\246\213\313\r\002\016\370\264\244\335\017\215\210\305\275\016\007\002\001\020\300\272\315\314\002\006\021\352\232\337\347\016\b\007\002\001\022\353\303\321\231\004\023\264\256\257\344\016\024\350\377\333\367\017\025\026\240\342\234\212\n"
+	.string	") \200\202\2511\336}\311\017y7-\32023\200\220\004e\036en5\202\231\265b\222\202G\201\b\013&"
+	.ascii	"\331\200\016\0046\2470\tA\013\017\002\334\020\030\300\002\032"
+	.ascii	"\376\b\00688\223\005\347\034\314\034.\201\001\002\005\214\001"
+	.ascii	">\001\310\263i#\fP\275\023j\306\201G\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 tm\002"
+	.string	"$\003h"
+	.string	"\016"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\007"
+	.string	"\001\b"
+	.string	"\001\t"
+	.string	"\003\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\001\r"
+	.string	"\003\016"
+	.string	"\001\017"
+	.string	"\001"
+	.string	""
+	.string	"\020\021\022"
+	.string	"\001"
+	.string	"\001"
+	.string	"\013"
+	.string	" \004Jp^E\203p?\r\277\f\313U\310<"
+	.ascii	"\006T\332\201\001\026"
+	.text
+	.section	.gnu.lto_.inline.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\324\001}\b"
+	.string	"\362\312$,pK\222\016\260\b\341\037\002\276\307aQ\034\344\221!?\004\017S\305\212?\332\226\377\257\252\252\n\373\255\266m\261\261(\266f\311\226;\005\3777\306\261\320\202\342A\203Y\"\335S\361\200D\207o\006\224h\273\216L\265\001\375\253\273\337$\346G\300Y\315\204\321\251\003\"%\0212\300\021P\256\322\026\232\271\240\301l\347\266\306\266\365;7\271i\232*\313#p\341\003c\3022\022\030\241\340\321a\016\337\333\342\214\330\266\313S\b\321V\302\267\0032\264\215\3743/\0028 \240\242!\225mk\302\362\302"
+	.ascii	"\332\225U\340J\261N\201\265#\204\001n)\206k\250\r\021+\026av"
+	.ascii	"4#\303m \305\273\304H\221}Ad\036\274k\334 O\222\201\024\223'"
+	.ascii	"\262'0\2745\207\361\3541.kL\313\3011r\206/+{\276W\230a\361X\277"
+	.ascii	"\006\b\020\005\007\275\016\337\006rriH\334\006\212\001\036p\244"
+	.ascii	"A\004\375\232\213M\373\334\241\205\341\210W\360!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 \345\245\003"
+	.string	"\022\206\022\034\260\245\205\003\3141\326\222\244p\037`\233\3030,\017j\255\033\351F\272\021!\331R\246\377\313\257\374\311\217\250\n\f\271\376x\343\325\027O|\372aS\022\330>\033j[\002\020\007l\031c3\317\363\222\343y<9\006P\273.\004\020"
+	.string	"S7y\302\f\220:\305y\f4\350\225\212\244\032!%"
+	.ascii	"\315\0314\305\212kqS.\316\033r6\267\254\013\003,"
+	.text
+	.section	.gnu.lto_.pureconst.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\230\004\003\270\004\007\230\004\b\230\004\t\204\004\n\204\004"
+	.ascii	"\013\204\004\f\230\004\r\204\004\016\230\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"U\004"
+	.string	"r\005\016\022\2209\035\377\377\377W\020\331\356e\355/\260\364\023)S\377\317;T\332)\226\371d\024u\004\207\257\220\016.R\266\366\371\227gu\036\235W`+\237\250\334:O\273\231I' \240\002\t\220v6\341^\bC\273IG\353\316\307u\304N\031D#\276,{I\253\327ee\334.\275 \270'\023K\321=nAe\357\221\0060\200\026\256\233\b\215#\f\254\262\206\270\003r\301i\321\306/\261\021^"
+	.ascii	"\362O\317\261\270\300C"
+	.text
+	.section	.gnu.lto_.lto.a386ebcb14c4d832,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.50.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\204\007_"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\351\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\n0om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\005"
+	.string	"X\tH\271\036fq\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.52.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 E\345\001"
+	.string	"\364\0028"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\005\001\006'\001\344"
+	.string	"\350\007\n?\202\210\2000\177}\277\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\004"
+	.ascii	"@\020\\\006s\320\001\300\001"
+	.text
+	.section	.gnu.lto_failsafeReset.53.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\001\002\315\r"
+	.string	"f\227VD"
+	.string	"s\224\016\277\022@-m\231\267O\204\253\217\367\270\264\216\265\021\"\371\340\230\310hN\256\037\020\275\013\222v\b \322\n\302r\226`\353\347\377w\256\273a\032\024\200@\2538\347\251\246%\2429\"\331D\312\224\002?"
+	.string	"="
+	.string	"H"
+	.string	"\326L\347\323\027\240\311\300A\240e\327C,\310\306\300\027\022\266\257\261\312\356q\227\311~\005D\353\365cw\243\226\\\365T\371?y\200o\204\303S\304\301\356:\277\221\017\267\336v\002\333\f\354,\t%\274\214\371\232\372\326\020\273\273\212\006"
+	.string	"\273\035:>\312SN\376\210CoH\345\277C?\245\035^\033\354HYe\314\251\302D\216M \266\313K\025a?\333\335\265\222\330\232\206\231\3162\003\024\376\342\302A\251\360\226\027\nN\316\342\366v\027-\026\310\314\240\370H\263AgY\261\221\2319\001\325\016\3755\032`\262\273\035\177\345)\270\013\245\222v\230\t\371|d\n\317\242\232)\344\301\n\341\351\270aZ\252j\201\027+\006qB\242\355D\3426QDY\030q$Q\304\300m\245\b2\235\"\347\200\273\f!SDu\235)j\\\253g\253$\017`bV\352\331\367h6\204\337\360\330@"
+	.string	"\373hv\204\327\370\3200"
+	.string	"C\302g\300D\227\t\207\305\330\250\004. P\203H&\035\243C\257J\201\003zw;\222\251'T8\206\031)\337\205#\276\222=\001\316\370$\363D8\361\221lO\320p\342+\331z\302\024\034\203\325\322\031,\246\007\337`\223t"
+	.ascii	"\205\320\306\036\306)\311\373\355\220\221p)\016 1\020\266\260"
+	.ascii	"\321c\354\217!\200\245[\264\372\t"
+	.text
+	.section	.gnu.lto_failsafeInit.54.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\355\007"
+	.string	"bN680q\323\001"
+	.string	"\t\342\312\227JJ\301p0\302\211\265\244\244-\340W\241\227\241\021\370\233n\017\301\277\252|\037\347\346\307\210\210`\360p\345\317_a|P\335\241\272\221-S\n\366t>Z\346\201\266L\233!\207\206\r\244M\210-{\230\236\316\233\035\216\271\210O7C\034\327\315\215\270\267V\236\nJ\322\302\001\"\0333*\017\263%\216\362N\b4%\345r\021fO\334D$\020\356\256\202O\362\022\n\337\343\227+Fz\360\227?\302~q\302\230\222\256\234"
+	.string	"3\252Vil\221\244\222\303\276\265\362d[\013!cj@f\027cU\263-\227\n\210\355o\374\331/\027\303=\352\343\002e\334\335);\376]?\377#?\320X\001M\244+"
+	.string	"\303\356ZAS\306-o\333\3006\202m\226\r"
+	.ascii	"3\241\301\037\270f.\002\203\301\306\252\222\002 \321\255\032"
+	.ascii	"t!\217\013v\274\f\001.]\247\235O"
+	.text
+	.section	.gnu.lto_failsafePhase.55.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"]\007"
+	.string	"bN45Po\322\001\200\362)&\200\270\032v\366X\200\003n\2407\2610\336\b\205\255\241\326\343j\261\302l\204\205\265Bf\306\215k\240_z\0137Qz2K\366\3362\245\336h8V\345\351\\\225%?\f\013W\307\222\016W\325 7\231Gj\f\214=p2\371\301\260LRs\017\367\221\3742\2437a\033\342%\032\300\356&\370$\237\021\276\307\243%@\372\355\321\007M\217\372\nTFF\332\231\312Xu\261\247H\337\206}\270\217d[\255\017c\221B\300\262[\321\275,J<\001\261\035\262)?\344\"!kpvp\001\032%\n\223\226\335)3\037\230\036\341\005\246\307\307q\355\252\371/\035\256`t\033'\272b\024v\327\272q\027\367\273\355\003\333\b\266?\002\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.56.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 \375\025\007"
+	.string	"\262\21527@o\222\016@E\345t^\211\302\270\202\306\"%\233?l\226\350\375\3452\t\3737{\326\307\312)\004\232\326\377\225;\212\316\020\352O\001\331\003Y\300\226,6K\210L\001s6\035\354\372x\262\013\213\240\005\205\314\203\305\206\354b\210\234\355\0237\002k\016\235-\2024m\213V\227\205\250\341"
+	.string	"\tJ\374\017\025\341\0022\023\341\2064\005q;Z\035\021z-\265\272!\200V\017jTR\244\367\262\205\221\257\345\273\321\203\032_LB\324\377~0S\201\2421\3114\275\270\344IU\342\361\367\013\"zk\203\003\321\\;\016S3H&FX2\273\b7\312\365q\267\037\305\254X\244\224N\243\276LBf\376J'\212\016\373\023\374\005\377E\007"
+	.string	"\n\013\270\211!|\205"
+	.ascii	"]\303\t\206x\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeIsActive.57.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"\242\r26Pm\222\016\260\226)\233\004\r\336Iu/%J\\c\016\251T\377\320\351\361\377nG[\330\2357\342\025M\373\277\231\231\"E\235I-S<\023\206\300N\263\204\310\024k2\033\354\352p\262\013\213\236\005\205\214\203\305\206\354b\210\232\255\0233\2305\207\315\026=\232\266E\253\313B\323p@\004%\376\207\206p\001\231\211pAz\202\270\034\255\216\370\274\216Z\335\017@\253\007\005NN\242\227\332\272\310\247\362]\350\301\214\257%3sh\372\337\017^<L0#\231\244\324J\226T$\035?\350\255\r\016@s\3556H\305@M\210\244dv\021j\224\353\343n?jA\251@\215J\241\276KBf\376F%\212\016\373\023\374\005\277E\007"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.58.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\005\007"
+	.string	"R\21515`m3\006@Y\t\201MTA\032H\251}dqj;\240\206j\205\013\276\331r\214\336t\342D/\346\255IG\021\301\332!4\332\200@\222\343\266\226D\312\224\002\315`4V\305\331\\\2255;\n\t\327\306\232\fW\26503\031gb.\305\0324\331\354`X6-\336\035GT\367\231\276P\214\250\355\241\264\016\346\360\bp\377\rj\ro<\324\030\226\205\370@o\226\365\207b9\300\225\204\340\251\001\035\311Drh\322z \030+ZS\217\2436\036|\245\221\213\310?q:9I~d\264\265\245Z\033b\217\273;@$<J\377g\274\260f\250\325\356\f\260\211@\206\025\204\377\205\233\210\302\215nK\320\266\240\255E\b"
+	.ascii	"3\001[8S\374\370\032\327\304\264\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_failsafeActivate.60.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\230\001\225\016"
+	.string	"\226\232^D"
+	.string	"\221(\035\243<s\202\352\260\\\245e?o\314\t\350c\215\3757\264\022\274\256\b\372\206!m\203\376\227eTTU\277!!\326o\371%\363g\245\373\224\347\013G\364?\030\022\331\231\030\310\022B\366&R\246\024F"
+	.string	"H"
+	.string	"M"
+	.ascii	"\216OCMc\232\326L\347\323\007\240\2405S\243\300kw\303K\307\266"
+	.ascii	" \f\t\333\3670\311\2269+\265\331\007\231\224\226\231\335\345"
+	.ascii	"T\304IO\222\177\023\337>\225\3223[\260\273\316O\245\303\255\267"
+	.ascii	"}\3006\002;\023\004.7b\344\275h\227<\205\207\202\300\f\016?("
+	.ascii	"\332\026\276\002qR\273+"
+	.string	"\342\237\270*\344\2178t\206Q\376;\364G\361\020$e\303\224/\013Xm\016\327&\215\315:\245\206\260\217\255\202\260\261\364\006\2467\230\326\260t\366\f\220\306\347\202z\215\232\265\240V0\2052\356\230\250\212\351\200\032T\211S\276\234\252\372\224\035\366\203\263\200\240\355\242\210\370*\276\"\202\004\022\222x\230\372\027\026U\200\264'P\320\257<\234\264\344\f\307Gj\373.\332\035O\376\263\001\024-9\003\356\204x>\335\310\304\353>\334I\205\022\317\344\303]\360:\020\327\021\215\270\020\020\2070xD\334I($\342<X\246\327\264Lz\362Fa\214pR1\377\\\233n~\rQ\323M\217Z\311TS}ap\230\021\355E\246\034\026\225\311\205&\252\335\340.\034\264\b$ \220\002\241\261\362\001r\3002\034\235\260\032\203?\004\022q\035\312pl<~/y\225\310O\371\262\n\201_\254\245\024\361M\034%$\317\2505"
+	.string	"\3211b\201\243y\312\276\321\312@\f\361\364x\265af\225\r'\230'\206v8\020 \234\367!"
+	.ascii	"\323-Z\372\004"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.62.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"m\007"
+	.string	"R\01765P\215\322\001\274&3Hd\0173kI/\203\222{\207\032yXZ\345S\3156dO\037\r\264\240o \355/df\314@\270\270\177E\235\253Z\002\3667\2212\245\306\\2\330\305i\262\013\213\033\206\205L\203E\207\354j\210\230\215\213\027\213\265\207\314\0267\232\266E\353\333W\253$\325\201\217\202\374s\225\253j\225\022B\2012e\033\342 \\\300\356&\370\037?E\370\031\207\226\340\344\275C\237S9\274ZL\247O\246lYl\236\330\237'\265d\277\332\335\265\222l\2475\323\257\0048J\nDvE)\224%\201(\r\333\267\357\321\261-\037 t\334\375\303\020\275D\021\n1\331\375\242^\274{v\376;\016+L#\336\310\363\004P\330]\2477\232\270\365\266\tl\033\330\336\b\006"
+	.ascii	"2\241q\037\330<L8\3442;\334eS;\311"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.63.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\355\n"
+	.string	"&\325M@\020Q\234\016p\261\330\004\321\261"
+	.string	"\244\332{0U3\230\274"
+	.string	"d\312yCh"
+	.string	"\276\f\240\375\f!\252\332\007\021\305\200[\306F\346\004\004i\004T:}\271d$\362\263\t\350<\1774\322\375\245L)8"
+	.string	"8"
+	.string	";"
+	.string	"\"\273\241\002'\230<\026\270E=J.\200z\364g\323x\370\261\017\331\200!\344\306\356^\372\341\337\363\363\017r\n\330!zV\020v\327\tvh\270\365\266\017\330\306\3307\02016q\330\241(\325\203}\311\356\256\325\303\276\351\217\231\326Lg\246_\001\020\201\201\300\306n\206S\216\035\211/D\330~\305\266.<x\332'\361\022\337M\236)\273\035X\004VU\341Y\037)\016\326\320\253jlQ\342P\311\270GEM\255f\224F\220\362d\273;\no\262\273\f|\023?\001\362C<\332B(\017>\372!\352\361j\2010\215\362\344\\\001\022\276d\0268\270h\260\006\226\001\232M\3432\214\246\223y:\220\204\016\024\300\031K\266\301:\216\206m\256\017\205\t\032gsu4\254\302\225\341\272\313B\300\233'\343\256\317\266qW%\334KV=\034\301\305\310HI\001\r"
+	.ascii	"\373s\241\214i\023j\0307\204\004K@\334#\344x\202\\B3\230r\031"
+	.ascii	"\333Z\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.64.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"-\b"
+	.string	"R\31778@o\323\001@-YQ\034\207\202\177\2569\007\207\375z)\252\216\361x\3379@\377\233\3625\263R5\2327\325\377\312\035\201\354Z\032\bb_\231\256\307\246,m\262eJ\001\346l:\031\326}4,\233!\206\005\355\223\315\006\r\003M\016\327\315\315\2007\207\0167C\333\306MM\270\2676\232\024LT\243H\362\357\271l\355 \236\017\002\025\027M\221<\332\240\207\233\300iw\021\374\216{<\370\031\227\356D\322\027]\2272\004l\031\351\312\226\332\020\021z\360\361\033\025\244\370YS#)\2530v\370i\264\260om4\331W\377\n(A18\331\235X\305\254J\212h\330\276\306\236\315\362\360\264GaH\240^vw\306\213{W\317?\307\001\300\322w\315$\354\256\025,Q\334\361\266\013l\037\330^\t\r"
+	.ascii	"3\241\333\037\270\320\334\005\333\235J\206V6`\2028\362\f\305"
+	.ascii	"5\221.\204\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.65.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"]\013"
+	.string	"\266\024LA0\213j8\030\267\255\314\245\037]\326\214\340\222\037\333\336\333~\231\370\354t0\034\203\313\335\236\032o;_0\330f\b\323G7\374\375\355\r\005\305\361\001\005d\353\217\302m\200\n\243Z\264\266\267\224)\0057"
+	.string	"5"
+	.string	";"
+	.string	"&{\303\307\325\336\305 \200\353\303\356rz\340\246k\232&\277\242\261\204\342w\255\300\265BDi\031\273\373\006O\001\"\230Y\321\354\2563\024\t\334\333mw\330\306\330\377\b\247\234YK\333\344$\037^\277\300"
+	.string	"\250\237\363\025\303\260)\302\036\277T\225}mw\327\232\262\237\326\247\363\351[&d\0270\024v\007\314d\013\333*$\260\375\213\003*\341\036E\025\244e\001\225!\234zU\335b"
+	.string	"\024\2009\263-\362\226'\361 \225C\003+_\036\256v\350\243g\261\332\335\r\237u\007%>\202o\036\2256\277D\371\266M\b9\004\346d:\236\315\b\324m<\034)\344\323\201<\334H\267\tq\034\321\210\313`\330#\351\2108\222\347\211\270\313\270\327VS\366\030\001;)\250\251\352\035\305\376<Bw\261\202\240\221\241\003\305\013D\356\356\027\026"
+	.string	"3\241\t)\306\206\241\244\177\207\021\254\003\301\272\020\367\005\346@\001e\266\3644\226"
+	.ascii	"BT%Z+\0330A\034y\206\002.c\277\f\001\\~`\224\242jlW)\003"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.66.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\003\001\315\013"
+	.string	"\206UNB\020o\225\016\f/P\250\023~\031"
+	.string	"%\023\320\347Q\026S\250/\341\367\262\n\253+\031P',i\244\361\f\316~\222u\026zu"
+	.string	""
+	.string	"\252W\240/\2148xq\256\210/\027\bR\350\253\364?\331R\246\0248"
+	.string	"8"
+	.string	"<"
+	.string	"\267\230d\233x\230\332\263Z\tX)vWS\n'=j\222\374\n\006\343\003\273\307\006\327\r\320\024?v\367\032\236\n@/\263\202\331]\347\0072\270\263\333.\261\035b\377@\337\211R\306\034\323.` \377]\237a\202\247\235\323\345`\304\346\n;\354RQ\366\343\356\256\365d?\035\237\326\247\363\351gX\"\210\020\371\260\273 \306b_\031\210\013\266\003\252'\253\020\246Ta{{\007V\324\303*\350U5\203!\300\340e\314v\200\257\270\013\016\251$%T\351zp\265?\0179\216\324\356\216\370\252o \340[x\346\320(\363G\224g\261E\326\\6\234L\310\263e8\232\b@g\363p4\001[\346\243i@!\355\342an\300\006\244\2118\016\244Y\302}\\=\231Hx\225\324\213\212r\207bo\356\241\323\221j\201\220@\241\341\202\220\273\333\251\242\242\006\030"
+	.string	"3\241[)0\207\2678\320\022\035j\021\210\313\204\f\202\261\3214\345\nV["
+	.ascii	"\337\254\244\206\025f@\334\252Dke\003&\210#\317P\310e\354\227"
+	.ascii	"!\200\313\017\214RT\215\355*e"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.67.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\265\001e\021"
+	.string	"\026\240wI\360\322\2461\240TiQ\334\376c\250w.\235\024\217\206\1774\232\216H\325\212\271\322<\321\222m0\310\033E\310\022\206\021\267\331\030]\030|\b\355M\334\247\322\021O\254\347\222\356m\305L\024\301\341\3111wcu\223[\312\224\002^"
+	.string	"b"
+	.string	"c"
+	.ascii	"'\200zU\355\220`\337\307$&\344k\261\325LyoHx\312Z\356\336r\301"
+	.ascii	"\253\031x\257&\355\037/w\356o:"
+	.string	"ln\271{/HW\220$%\337\321I\372)\332\314;\217\304i\247 G\005\323G\223u+\243#\233\343>E\320j\346\0249\271\367z\316h#\356z\333\023l\313\354#\005\rr\334{\3634\344\036\325\"\036\333\367\207Nd\177\226\271\220\r\224HJQ\273\367~\257\376\220\214\375\275\336\027\"}\237\333\016\364\333q\376T/pAJc\355V#A\213\\-\206\013\007D#\346\335\036\221 \235$\245\r\336\253\252\310\346\377|\006\3712\304\252\246\274\264\024\027B\031\274\327\325\013\240^\273/\257\371\231)\235\201\260\323$\204R\035?\206\242\364\270\013\260\301\260-!\371\250\231M>\221;\034G\314\273\367:\360m\374\006\314g\361j\0171\363\263\030\324+\245\007z\374\320\314'\237\350\025L\360\270\323\251\223\201\223[:\356)F8LA\356t\262K\331\244:K'rh\2469\366\247i=\212\236\034\220\341\030R"
+	.ascii	"\241\201\305\325\372\320\262,+\006P\261/bX]\030`\026ZXc+\006"
+	.ascii	"e\200Uy]\020-\214\265\034R.a\231D(Q\t\037\214\250\354\030\216"
+	.ascii	"(0\230e\275D\030+\0020k\304\256\2040\227V\270\002\216-,-\227"
+	.ascii	"\025\320\325\n_@\226\b\003G\020\370\005cEp|\275D\360+if?\241"
+	.ascii	"\241\262Y\227\232v! \240\002\031R\333\306HS\337B\301\2607\332"
+	.ascii	"\334@a\021\312*\366\266\177[\341\200\230\203~\254=o\332\333V"
+	.ascii	"7\016;E\034\314+\307Q\214\024b\\\307\354\355;\205d'c\025\255"
+	.ascii	"\243^PW\030\231\365\006'i\264G\003c{"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.89.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\216\034\315w"
+	.string	"\032\265\254(O0P\332\032\003Jq\243\267\315\204\250f\n\030Q3m\362\233\022\261\n\340\201I\2048j\276\333\267*:\331M\242E\246\340c\351\237\256\310r\226\006\f\003!\b\323\305\241\020\034%\224\250\304t\367O/\340/\370z\364\345\361\264\267{\313\224R\n~\002G\002\204\002L\200p\3055\361\365\r&0\b<qga26\244x\215%;\310qD\032\346\346\226\266\225\024\re\0176\246\322\024z\2757BC\271\204\r@\275\021\242\254$i\313`\214\215"
+	.string	"f\033w\224\226\302=\205\213|5C\337U\355"
+	.string	"\324A+\321Qz\006n\032tX\240\241\252\2410\224\001\316\234\2745q\021g\250b\356(s\221Ih(?\225\225=!\201\331\204\2062\326\ni\3147\"\367\334\0257]\3275\223n\322O.\362\325\325\325U\303\t\211\3539\227\333H\307\3202\264\222\226\343b\007s\324\344\226PW\274)I\022\004\004\360\255-\204%2 \261\"\276iC%\316)\025\003b\007s\2421p\037\3518\267a`1\304\025\367\202Q\020D\016\002b\007\207ZG\330A\266q\204\035\314\311+\301\334F\030\304\b\267\341\254\206\262\342^\031 \204\304\275\001\276o\\S\007\331\211\330\301.\302\314WKv\231\265t\334\331\333I\356\224I"
+	.ascii	"\337\367Mv\360\315\276\331\270f#\026\276\333\"B\200\210\202J"
+	.ascii	"\"\237\234\232\230\226>(%!\035\031\025\021\r\t\005\001\375\370"
+	.ascii	"x\350\341\3319\352\344\340\030oljZ\232\231\242L\fq(\f\262\357"
+	.ascii	"#\\n\031\260\254\026\201\245C`\271\342 l\324lt\024;\354\222\021"
+	.ascii	"\244\245K?6\200/\324h\257-\373\034\312\233\310\275\271%\221O"
+	.ascii	"\323<w\242\222\347MS<g\222.\253L\361\245\350\034\365\203\322"
+	.ascii	"\224\035JzB\035\251I\037\2616LX\250)tn\264BX]\027\3255\021\213"
+	.ascii	"\244B\003\256\245\313&\354M\217+H\346|H\256\205\344\216x\220"
+	.ascii	"\222\237\032\320\317\263\331/pwo\355\263\266\204+\342\036\246"
+	.ascii	"\335\303#]\022i\363\235i\037u\202t\016\220\037\216c\274!\013"
+	.ascii	"sk\033\2643\257i\301\224k\313\035\336\016M\244\2719y\263\222"
+	.ascii	"\205\261\3204\314\265\245\016\237\221.\231c^$\"\013\313\3212"
+	.ascii	"l\210.\300\261\226.s\2603_\2246\364\332R\005\217a\231\250Oth"
+	.ascii	"\351\322\007\253##\210W?\233hm)\346D\237\366PO\312\235\021!M"
+	.ascii	"\266\304!\214\t+\233\223\001S\016\205\307\016\022k4;\364\276"
+	.ascii	"o\021\254\313\237\325\251\241\007\226\026\214\213ebR\241\321"
+	.ascii	"\317\366/\260-wc\217\030\232x\337\227[+K3\211f~\032\230\271\007"
+	.ascii	"sOL\374\315P\276g\3320*\371\314\006"
+	.string	"\237\036\371_\316\203\235,\330d\242\203\235\311\216\321\211\261\253\3608\346j\260\333p\032G\342\300\330\303z\331|s\362\326\3666\337\245\030\354)\260\026bK\ta\020\317\336%\021\202W\b\365\255\315\275\230Y\013\320\nX\262\232\311\354/\230\371\312\275\336%!\333\213\303\3030\263\001\256\224\362\026\303\027B3\262\201\236\023k\325J\330s=\302L\235\027i\216^\323Z\325sa\255\"\337\204\026\373\276\357+|'\367Y\036\223\355k\373{\263\020>\375\027\037\277\360\366\264\202\357\254\362\266\261_\026\330\302\367k a\360\205\236\025\374'\264o\244\032\\v\370w2w\351~\r\220\370q\371\027\366:)\334,\204M\327\0254\275\316\216\375\256\353!-\017d \367i\004\204\314\t,\340\355\305\376p\317\232\306\365Yl\223\347\302Z}\241\275\303\tV,\270\201\230t\013M\255\006\022\372\377\263+ql\371\225\271\001\333\332"
+	.string	"\367\017~ \202\b\204\035\364o@&\020\0346x\200\326\352[C\353\200\202\325\0034N\350\256@\330\301g\307`\301\333\263R\265\366x\202\346R\001\361}_\022\334\325\376\263\200\373G\007\371\002\f\274\2750\020v\260\037\b\315\210\226_\271\367Z\0016\351\353\201\024\330\275\326\277~6\004xSk\365\365@\177'\377\210"
+	.string	"\316\276\350\300_\306\034\005\225D>5]\263S\31757\265\316L\255\363\222\215\363\007\033g\245\032\347\244\326\031\251u>j\235\215Z\347\"w&r\347\241\326Y\250u\016j\235\201Z\347\237\326\331\247u\366\320:\367\3348\363\3248\357\034un\234sj\234q\212\316\306\326\371\246u\266):\327\264\316m\353Lc\343<c\343\\\254q\226i\235ch\234\2113\316\303\242\263\260\350\034\354\272f\266\350\374Eg\227q\356\017\226\256\3240\337W\306u\207\267\031\214\n\351&\335L\272\353\272\351\272\347\250)\330\212\247\353\375\306\234h\351&\\\222;\352\bl\305\323M8'\016\252/[J\367\261\025\373\342\350z, F\220\300V\035w&#"
+	.string	"\246\334\033\016W\f\202\211-\027]ll\327=+\225\007\351\177X`h\252\336e\347y\260\002\235\352\372\330\262\363NhFZ\206.\307\321;y8\245\350\370\357G\324\324:\377\365\324:/\305\352\221\351|Ky^\311\324\214\216\337Rz\310\251u\376\370\335\202\271EW\343\373\216\231\002\317\202\005\246f\372\276o"
+	.string	"\354W\034\013\3265\313\335\332\312\363\252\342|N\337\261\333\345}8\370\324U\276p\277\276\204\035\304y\241\276)M\264\341I\211\035n|E8zS&D_\3068\312@%T\310\211t\333\025\250\204\0069WC\375WL\331\325\t\324\367\334\320;\211\264XS\313\013\237\r]\204\376h\364\212\353k\245\006\005A\241(i\251k\366T\303\222 \250\235^\225\032'G\360\232\315\"6lU\034\200\372\336#v?5.@\207\3341\363\017t\307^\226\220\226\034_>_\332\370\337\027\303i\200b\364<f\033\336\021\252C\n\325#F\325\303S\225\"<zx\330IE\235\240b<[lD\341\351\203\336Xv\013\255\261\267\363N\250k\206\364$q|\202\221\036\275\256\231]\031\255\016:"
+	.string	"8\361mwF\r\367\006\327\237\224'.\3104\207\315\313\033\365\346Aq\266\256"
+	.ascii	"1\276\023lN\016JL\013\345\0167;mI\\\263'\031\226\004=\237\304"
+	.ascii	" \365\004\203\b#AO8\"jVl\336\3117o\363]ER\305"
+	.string	"\210kF\204\273y\022}6o\325t\223\322\304\271\351\325t\230\246\376\245Y\25393\254\310\265\357l\265\237\347\220\341\264]3!\263+\346m/t\222)\227\237g\013b=D\212\r9\345\322\246IA\350pwx{\361\320\016\351\203\261\242F\323n\017a\315{\225\207\247\271=\204\324\370u\214\215\312\214\013+o3\357d\256f\375\216\317\034\305\366\231]\247\003q\315\224\316~4\361\252\322|\314\267\317\303\327\2029\363464C\021\026\177\346\203\370Z\254m}\361[\031F\313\257h\216\346\372 \276/\027\tv3?s\201\270B\\5WM\330A\231\357g\033\005\031;c\302\311t!\313\353\246\001d\215\206\333_\322\020\367\005o\257\230o/?\317\032l\016hSd\332u\023\022\277\245H\372\212\234\331\205s\217x{\021\277\2074\267>\213\217\317\031\322\227\007L\2115\346\235\377\275\226Sw\225\2760\364\366"
+	.ascii	"\251Ysaer\304wr\267\203\t\354\001\212\236Z1u\300\t\022t\020\002"
+	.ascii	"\212\022PP\235\240RQ\263\001\025\b*\246\202!<P\225\200\007'"
+	.string	"V\2400a\002#\325\006)\032PA%\002\025\225\0062\034\342\304\b\001Bl0\005"
+	.string	"2\207j\305\324\212\t\252\252\250N\244P!\002\225\212\226O \2518\230\252\372"
+	.ascii	"\305\024\007\311\025\036t\200\342\003\016\222!\240\230\002!y"
+	.ascii	"BEU\022\t\304)D\240R\221\\\221\"\205\212dqK\233\320\372-\021"
+	.ascii	"\021\270\223\036V\r0\354\354\214t_\336B\260P\311w\372/\276\266"
+	.ascii	"\323k"
+	.string	"\200DG\307\273\005\304;\227D\351\212\021\365el|q\247\204&\221\316\325;/\332\224\320''\322\356\344\\L\3165\301\013\030J\250\222\023if\223\240\336\177\234H\033\225Y\224\320\236\243s\365Q\371C\t5:\021\007\206_\234D>#\221\317O\310g'\3443\023\362Y)\3529)\352\371\007\371\334\203|>\"\237\215\310gv\210\374d\223\214\031pI\367@n\362\017b\342\257\327k T\216%NZ;\305\250\326*\227\225\367a\305\202\322\231\216\030gfv9\244L\357,k\262\364H\317\364C\276\017\277\344,\264\322\177x \276\026k[\257\204\366d\256\217\347\221d\304\\!\r\212\364\035\245\271e'\346\315n\355\300\366\262\034L\362\350\231\256\031\322\3530\372\242?z\036\276\034*\030}C)\372\3662\344F\234\265\212t\013\212\346\300\343o\274\rc\225\317jf,>#\025\237!=\370\236\210\276u"
+	.ascii	"r&\372\2666\271>kH\220<\247!?\006\372\260\256x{\r}\203E\361\244"
+	.ascii	"\357\220_\236[\323;Y\350\203\252,e\b\275\210\240\257j\036\243"
+	.ascii	"Q\230\242P|\254\333\350\223\275,\007\263\324\316\031{`9\321\""
+	.ascii	":\036\206\224\320\177%\345D\335\244\3573ce\371\027\256\231\320"
+	.ascii	"\273\020f\361\252\276\317\003=O\222\026\314o\341\232\021\277"
+	.ascii	"\353\347\033\352\363\255\327\304\332bdC\300\275\261\376\204\314"
+	.ascii	"X]\260\274\344D[\300\321$\314\370\020\025\273J\205q\272\341\227"
+	.ascii	"\026\350\232!})`\312\345\030\255A\"\013\236\013J(\224\231!\351"
+	.ascii	"\373>\232\013+Kz\247L\363\032\346\310\2714\263C\310\217\362\360"
+	.ascii	"=F)\031\217?+U\242\214eu@\327\314\213\207O\352Kr\356h\317\227"
+	.ascii	"\350h\313,\211B\244\302-\233Ft\2064\352\233\016\351\233\205\020"
+	.ascii	"\254Y\023\246\245t\202v\250\022\0311\023[\205fHD$I\222\f\007"
+	.ascii	"\322\n\020\206Ca\034\310\364\006\022@DE\311s\212)\241\221\221"
+	.ascii	"$Ii\3307\332\373\203A\255C\035i\004\355.F\324NQj\326l\206\321"
+	.ascii	"\355Ua\377\371\312\022\222\242\200\034\207`\362P\323\302\212"
+	.ascii	"<\225WP}\027\332.\252\020\255\307\004\007\031m\305/]\021Pu\023"
+	.ascii	"\214DZI\304\221\270\277\n\244\001\316\256GnM\274]\350\270\252"
+	.ascii	"h\361\225\260\210\267\324\206Q!\377WO\\\030W\265d\337a\274P\272"
+	.ascii	"\244p\212\001\324\250\335\013>\033\033'\233\325\322T\321s#"
+	.string	"a66\221R\304s\021\320<X\002\312*\0333\207\315\240rjN5\034\244D\205=\310\262\303!\254\341\3617&:Ab(#gP\341\360\021Z\033k\323\271i\351 o)\356\002\350O\302\356\005$w\340\304\327\f\226\320\023\"\240\237X\362mV\345\005\tAF\256auo\213\323\350Xz\374\270p\210R\353Of\341\220\030\274J\352\b\364\374\302\030K\033\027\315\324\037\201\367\023\221\271G\001k\201\001\005\363\236>\bV\305\361\017\263!\247O\241r@\025~z6\301\032nF\020\n\357LQy\236j.\323\2152\252\366O,\003H\003\226\006\\+7b\006\240\025\021\340\326\350uaA\233S\tN\027\n\"^P\213\216)\234L\233\351\025\330E`\200\242\304\220\303\002M\266\237\376\377\304\017\020\253k\336\213\327\024\236d\244\360\327\235\214\273ms\322\nhZ\374[\2758\177\252ANu\221\365\274\265\344"
+	.string	"\272r\201\251\007:\313,D,{O\264@\317\241\302\316\300\034\230YT\246\016V\357\025\374\002\310\226\003jk\342\t\342\365\221\307R6l\273\217)\344\207\226\277\005*\235\227\005\312\324\363\277\004Fp\027\230_\r\350Ihd\020j\030\002\273\317u\312\214\022[\320/\007\016\224\330\205\243\022\033y\344\372\007|\321\233\255\001c\b(\344\203F\314e\325\350\265\200F\335\235\330\324q,I]bm\217\305\262\227\320\234"
+	.string	"\033\207\3638nr:\363\235Y\030\263\245\233]\306z\007\334\275\217O\305\243\264\201pE^\252\3509\363\233\006\364C\276t\003\246|y{\311\205{2\370\235\334o\2655T\323\207\202\002\262\205\234_\254\202\305\022\322\225\364[\226\221\275\362\343\333[\002\\\241\2619\350\352?\n\371V\210\272\304\027\303!\215b\300q\\\245\":\305f\345\256P\350\267ER\346\304*\220\241N-b\263\"\250\234j\306\n\363\204\351\b\332/"
+	.string	":\206\303\231\311\374\365L\222c\312\256\240\307\n5\031j{\262E\207\241M,\0027\003\212\024\037@Q\n3x\004\263\030\226\256\314\3338_\240_$\277\006M\240\3154\266\\\340\332\313)\242\013\215\255\260N\2379<\350\247\2630Rq\305\244A\326\22210\256T\375L\254\327\344\030\233\026\347K\221\236\016\2416\035\372eEztH\210\351\252\tdx\223\347\021\340\004C\034\360\337\322\257\322@\262(\244\002/\262o\256\330\005\331\247\247bf\223\230\332]\357\205V\326}\221y.\237,\213w\332o\207\253\232\t\253\335Z\312\n\220w\260\252\013\254\001\247\305\366\204\322\027\333\327"
+	.string	"\370\261\375\240Z\300\016\232\226\034\346\366\307\341\220\332\017b\321\275Pu\370WV\261\t\032\235\221\315\020R\377\255(\256\357\355\311{\021\262e\004Uz5t'6\225\351\223\266T\252v\2377H=\003\276B[\255\265\3231\363H\261\245\250\024\b\366\202\371\345y(\007\224\372\200\254\2300b\230[\030\244\336p+\32662)d\226\323\244v1\366\314\234hxE\025\003.2~S\306\200\202\312\340r}\273M\2730\307\022im\355\344\0312\307x,\264O\225\220\360\024\016\311\032\226\352\254&\204\rK\021\003\232\021g\344"
+	.string	"\226 9\342\325\031'c\241\327^T\223\364\320\225pG8\033\rA\217\ft\362\317\262\326\370\344\203\315\320R\270"
+	.ascii	"\034C\350\366\362\242\036#[\200\277\211F\360\214\372\275I\030"
+	.ascii	"ec\357\031\234tqzu\253\316\202\250-V\022\375\261\203\325_\214"
+	.ascii	"\352\027q\210\366\244o$\341s\022\203\037\021Y\270hH\354Z5\225"
+	.ascii	"\260\325\321\347\220\343{r\334\202\216zK\0279u=\033-\022\320"
+	.ascii	"\352\356\334$P\003\270\244>\332\025\222\370>Q\213\026\214:H^"
+	.ascii	".yQ\361\363z\r\250\326\3233%-\370\340\r\302)f^\032\261\257!R"
+	.ascii	",B5\214\036\037\245\327\212S>\021\275\354\214\\\0204\226\275"
+	.ascii	"\320\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\t\003]\017"
+	.string	"f\231_G\340\2626\035\230\006\321(\320^b/\006"
+	.string	"\372\257\264\347HG\245\350\363\316\321\3424\204\001"
+	.string	"\364\013\305wol\323\f\264\257\030\331$\004H\230a\206\271~N+GY\274\252\252\352Rb@\034\364c\377@\230\221ND\246L"
+	.string	"P"
+	.string	"J"
+	.string	"3\020\254[\007\366\202\201\265P`)\020\330\t\337\226\274\225\220\2620\030(Y(\373\202\235\270\247\263\016\023\327\370$\b\316\022\315+\250d\275\003s\bNE\273\255Sn$\315vH\202\240\\\331k\363\220\320LJ)\007l\005\314v\246\005\346yY\347pY\343\210\260\276\321\262\336aY\353\254\254m\250\254qH\353\034\225R\332\336\021\bkQ\037Xs\260\242\331 N)T\007S\203\026\315\216I\305pH\311\240dN\031L\037H\326)\202\201\213f\"'\302\231\005k\032\n\3267\t\326\001*\266y\362\253JD\371\225\305t\021*\213t\365l\241~A\\\253\224__\214*\262Q\271J~e\211\332\331\244\370\341\375\032c*7\203SD\206\270\375\3723\325:%\302\234\356W\240QG;/\030\337\037\232\233\257\"\347\303l\326\033-\321\274\202>\022 :\206"
+	.string	"\017\215?\211\311O2j&d\005\217\355\357|\350\215\370\324\370\327\020*\200\326\252\307\366o@\241\031\253\306\307\277i\344~\017\241r-\025\220\356?\201\352\001\231\030\341\037\005\252\250\305\220\037\377\0323 \360\0029\222\346\001\024Q(\203o31\235cT\327\224\325K\246\264\327Q\236G\031\017(\370-\336\003\346\017\347\032:\3240\324$H\200\004\220\004I\220"
+	.ascii	"\311A\362\n\032\215K7\245`\230!a\270F\216Y\336\360N\366\227y"
+	.ascii	">B\374\221\337\340\033\276\361\033\276\361\033\364c\207E\302"
+	.ascii	"\217\214\321\215\355\301\227~(\"\255\\\006"
+	.text
+	.section	.gnu.lto_.refs.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\355\006"
+	.string	"\362L%+pM2\034\206\237\305\366\001V\2740\"\220\311\362E\266\333WUv\372\177\352_\b\021\265\260\265!\322Z\033\202\374F\b\331[\246\024f\266\331\246Q\002\0339-g1J\375e:[V9@\212v\2249\360n\336\314;\275\227\267\362J/\364nB\221{ph`L\277\260\250\240\230\220\210\200xxwXoxv\206\223g5q\324\022\222\021\221\251! \037\035\033\257\031\253\302\233\360\"L\017^\203)\301:-\205\226\252@\315\213Y-/\300t\275{\037}!# \340\";n\003;\031\264s\027\265\260c8\325\303\013\227p\017Kc\255\331DR\210a"
+	.ascii	"\344\205\234\347Q\013\001\304\205\242\026\307\203\t!N0C\244q"
+	.ascii	"\341\261\202\341\202\031\202\213\022'\330C\034\306K\006\361\t"
+	.text
+	.section	.gnu.lto_.decls.a386ebcb14c4d832,"e",@progbits
+	.string	"(\265/\375`\352(\305\266"
+	.string	"j!I@Z0\2129\235t\016\020,\004\3060\301<\367gG\206\266\236\233s\331\342\371n~\301\032a\200\002\373\320\342\326\237\347s\324\2258v\246)\225{\255\370\324h\030(\311mc\357\003\207wIn\016\355\35061{\240\342\337uL\0057]w8\255\342Mcy\227\321\267Y\264\367\226)X\003\364\003+\004T}V\245j\323\253Su\361:\246\373\322\236K\315\327qW\t\030\242\004\256JU\026U\251\343pt"
+	.ascii	"\206\226A\225\252L\315\207\263tf)\241$V{?9acf\200\201s\257\326"
+	.ascii	">?\232\273\204o\275\340[9|\253\206o\277p\315u\331g\037jR\325"
+	.ascii	"\301wF\326\003\277?\374l__\177\370\335Z\341\013\366:L\237yh1"
+	.ascii	"v9\226\301n\306\b\031\023\246\336\333\027\370\355\341\327}\355"
+	.ascii	"\341\367\032\006{\310qZE\261\360e\211\f\331\fC\222\352\255#\222"
+	.ascii	"\362\n\003\233\341\251\031\344\346\342)\345\rx\244\313\251\t"
+	.ascii	"\224\2505'\315\206\204\354\352i\244\225,\2412\343\331di\255f"
+	.ascii	"\213La\264.\254'X\233\224\325\236\336\210\256\353)=\207\223\344"
+	.ascii	"\314SB}V{zk\177P\024\235\274\324\005\325\354\261\256\353\016"
+	.ascii	"4\033\316\2223S\001\311^X\355\275\355\372\256\2674\226\306\353"
+	.ascii	",\355\245\2734\227\276\322Z\372\254\353\332\312\273\206\246\373"
+	.ascii	"u\346\274\224s~\303\375A\377\0012\350\272\246\241\305\254\263"
+	.ascii	"\231\225\250P\t\200\005\\\233\023\275\234\235\026\374X\360c\242"
+	.ascii	"\344\n\333\003\267\002\025\301-\327T\372\254CWy\3075\334e\222"
+	.ascii	"\234\331\231s\316i<\034JT\365\276\n\301\033\310\271;\374\272"
+	.ascii	"\257\257;\374^{\340Z[\300:L\374S\241\360;\017\277\345\360[\r"
+	.ascii	"\277\201\3407\023\250\237\314,9sf\254p\3212\253\367-\003\037"
+	.ascii	"\003X'\256}~K\232\t\t=\200\344z\217\302\222\243\215v#\345\326"
+	.ascii	"\364\245\336\223\200\373H#\351\263N\362wY\217\375\2161sY\316"
+	.ascii	"\316\033\233d\365\306\244^\033\241\267\331\037\340\312\031\274"
+	.ascii	"\007\277\201~9\r\364;\306\227\3477A\373\374\376.\362\367W\203"
+	.ascii	"\265\230m\202bf\263\234\235;\300\257\266.\263z[\2546\221v\276"
+	.ascii	"\305:\354\007\310\3406K\031,gg\213\335\234\223\272)\300\351\246"
+	.ascii	"@\206mG\022\331\357\276\342;\333\347\207\233\347\367\327Z%h\252"
+	.ascii	"\036\274\324\b\"\360w\006*\004\317Z\037\330\362\267]\355\320"
+	.ascii	"W\352\317\1771`\003\350,\377\323*\207\277\372\374\225\347\304"
+	.ascii	"_\355\376>\326\233\372\327\374U\013\227\343\374v\004\226\337"
+	.ascii	"\374VD\227\333\374\026\304\207\017?\013@O\251s\265\246\322x\370"
+	.ascii	"+\rQ\020\374\307{\342\340\304\363\373\355\315\177\272,\307\277"
+	.ascii	"\005\376\267\373\226\347\177-\377\353\376\337\375\307\362\277"
+	.ascii	"\313\177.\025"
+	.string	"X\177\377\360\277\204\377\021\374\347\2679\177\337\374m\363w\315\3374\177\353\374\275\343?\360\267N\376n\373\233\355\357&\177\253\375\r\245\312\374\035\3667\223\277\323\352\375\237\363[\037\177\265\177\213\371{\357o\275\277\363\376\306\373\373\371w\335\337V\376\226\373\373\355o\267\277\243\374\355\365\267\212\277\261\376\226\361w\214\277a\374-\365w\324\337O\177;\375\315\364\267\322\337\313\2779\360\267\006\376^\361w\n\177'\377\266\300\337\310\377h\177O\340?\223\377D\376W\371\273\002\177\023\375\235\342\357\341\337&\374\177\3627\005\376\226\300\337>\177\367\374\315\363\367\206\277w\376\177\371\237\367\337\313\177\347\177\004\374w\373\277\323\327\327\327\367\313\230\360\343 ?\004c\001vy\273\254v8\373\330\241\202\2134-\234#&\364\332wV\373\352[g\265\3169\211\322\326\323f\311\304G\303\no \"\364\032\346}V\303T\276\016\314\230\271\252"
+	.string	"l\3141Wz9_\201\270i\013\202\325\245^15Rcpw\365\236\346\t\177&\f\236\311\022z\005sV\3014\337]\216e)\232\0265\274\362\364r\206\002\302\306P+b\306\004\337\213\227j\367\313\271\235L\251\251\236\026\362\352\227\274j\207\2279\377\270-\257\200\254\017\246\213\274/\374\031&\3360E\350\225\313\373\254r\251W:\253\225P\333{\346\251+\020@\271\033[\313z?\343\002oH\"\364z\367>\253w\025K\b\316\274\304\221ZNe\020\307b\260\017\020\241\232\245jy\335rV\267T\273\276\312\313;\f\302\246\334\020\243\227\257\246\200\252\335\267\330\344\034\201\214\334\017\257$i\370\365\377\345\244\251\234s\225\2143O)\331\274e\272\201\376\233\266-\200\3777\333\237"
+	.ascii	"%rNB\362\354\202}0I\2421A\226\211\233j*\343Zv\300E\265\304%\243"
+	.ascii	"\251\214+/\227\274\226;S\231k\331T\226\363N^ZZ\202\300\314;M"
+	.ascii	"e\231*\263\220\243\352\354\344Z\346%f\336\311K9i\202\246%.\252"
+	.ascii	"\246\262$\252\235\2462.\252\\\306\225u\362R\322\224\323R\236"
+	.ascii	"\332\311e\\w\271\214I\245\323T\306\244j*\343\302\321R\234\272"
+	.ascii	"f\250:\362\264\021\325\313\246\245\374\"*+iJ'\256\311\311\314"
+	.ascii	"t9\267\031S\236\022@\316Y\314)\272$\031\255\246\024\367BII\022"
+	.ascii	"\263;D)u1\363R\\\323\017f\316?\224\210r\024\006Kg\\v\241\343"
+	.ascii	"\226,de(\246\234\037\210\312y\3319.\347\274\3149\003\247\262"
+	.ascii	"\2349\317\320ijFE\345|\365\023\225\263\226kL9W\263:5\252\246"
+	.ascii	"\262.f\320\332\221\262fn\341\\v3\323qM\341\262e\221\f\225sn."
+	.ascii	"\270I\005\003\257\336Z\327cc\354\353\n\323\375\340,e0\032\365"
+	.ascii	"\036\267\300s\325\n\246\002\306\206\033\336\234\\\2452\303\234"
+	.ascii	"A\226T'W\343l\242\242 \231\253\367@("
+	.string	"\225\006\270\267v2\205\360\325\373\372\366W\267*\245\347\232\231\363R\263\330\022\265Woe\266\317\257\202\346\371\325(A\2573\340P\t1\222\244\336\035(k85j`\272Ro\223.\250\265\272V\233af\314\321\250?\376\240\030\364\232<\3044\263\260\232d5\255\236U\266\212V\233T%\325H\035\253Lj\007\252Z%R\235uIER\315j\221\352\244\266\325#5I}R\305jY\237\325\265\372\365\nV\303~+\0136\236\236\\QO\027l4\215\271Z\341Y\265V\270j\222\321\230\233\341\302G\363!\351\002\363$\303\312z\302\351\250;\306H\311\321\327\2540\374A=\232oo\213)\325\\\2532\324!\326\331\234i\321\265\345\t&\243*\341$\351\344%\026[k\265FU\262N5\334\302\310\013\257\272\203\257\266\200c\316\t\210NV\242b\327\034\263Vo<\2009\346*H\316N\0317\267+U0\270\265"
+	.string	"B\360\353\020>\0232\007\240\217\276\027x\365\326 A\257Bx~SW\316l&A\032\333Z\275@\240\017|`\r|`\025\276\031\260\005\376\357\013>\224\237\026\374\037\033\376\357\007\256/\\\2537\033^\365\376\367\002\376\017\006\376o\211/3\207/\003\005\003\245\341\313\024\301\033|\341\313\364\300\227q\001_\006\013\377)\263\304\327\273W\360o\033\376=\202\177w\340\337\032\3707\006\376\253\325\007\274\344\004\r\254\306H\242B\007\240\fk[7`"
+	.ascii	"\335\200\261\242\024\244VU)\034\305\303F\214z?\242E\363\341\330"
+	.ascii	"\234W8k\2025\230%\317:U_\324\250\nU\237j\266\257\357\027V\005"
+	.ascii	"\311m\252X\260\214yRW\257\023\314FJJ"
+	.ascii	"\007\3632]Q\213zc\341Uc\345\204zR/\017\323\2301W\351\207i\355"
+	.ascii	"\306n\264\005\2513\270\300\345\270I\277J4c\230\356\320\356\362"
+	.ascii	"\202:\035^\365\336\\e<\365\250:\322\247#\206yd\210\021\303d)"
+	.ascii	"e\t\235\016\314\203co\317:\365\204\325\b\323\326Ep\330-\251\367"
+	.ascii	":*`\236\037zz\325\356\207i\261\300\320\227\027$\347\267\265\257"
+	.ascii	".\230\007\254K\027\233\327i2@\252\326\214x\271\315\353\276)F"
+	.ascii	"\244\324\340\203\213\005\0279\314\223\206\207g\255\3740\227w"
+	.ascii	"@B\356\274\362\200L\264\232Qj\230\007L\226,\366\371\303\\\342"
+	.ascii	"\001}\335\205i\323\233i\203\203r\341i\355hh4\225|\325k\267\330"
+	.ascii	"\364\325@E\214\313j\311q\201{X\320\321\331\272\036\223`\355\213"
+	.ascii	"\032\024\034*7\\<]\271\255k\261\034\245\030^H\253r\023D\313\034"
+	.ascii	"\026\034\346\241R\245\212\265\322cY\212\203)^y_\332r\304\260"
+	.ascii	"s\267V\252R\315\301\306$\256N\261\301\302\365$\227\206{h\b\321"
+	.ascii	"@\203\225\373a\332\032\326\270<\t\222\363\025\320ma/\254N\316"
+	.ascii	"N\001\203\305\344\253\327\306\021m yR\357q\\\300\307\341\302"
+	.ascii	"M&t\373vf\337\232\255\003\263\234D\005\024\205\n\257J/OA\001"
+	.ascii	"\261\263#N\206;\274\241\006\241[7\353V\257\334$\235\234\273\364"
+	.ascii	"\324h`\220\312j\361\2067\200i\336~\331\246\215b\233\2562\f\013"
+	.ascii	"\354j\334\314\260r\262Q/\224',4300K\204\256\211\230\r\003\243"
+	.ascii	"\3419b\314\226\001\221\362<b\227t\334\225N^Z\222\245\211u\332"
+	.ascii	"0\234\345N\316,\3005\237\330\016\3306\353\304\256Y\266>\263M"
+	.ascii	"\254\221\0378\333\304\026y\253\261\342\205G\034\316\005\273\226"
+	.ascii	"\b\224\232B R\367\264K,\022\233\326qW\316\\U\223\006\003\026"
+	.ascii	" L\254Z\237\331%\377qf\013,\350p\023\346\212\036\221_\232\022"
+	.ascii	"\0335\0274Z\324k\321\272\314\355\211\205\255\263>\263IrZ\364"
+	.ascii	"\340\363\252\327\232]\213\323\322\305\323\331n\214\265\257\267"
+	.ascii	",\374\033+\374\033'K\206\347\236Z7J\3706}\3706{\3706x\3706Z\210"
+	.ascii	"\330\260\262\031\272\300\205U*oPJW\260\rb\207\344\fQ\273\201"
+	.ascii	"&\244\0019h@\253\367\312P\335x4\243\200\340\320y\235\025\211"
+	.ascii	"A\006\255\257\013V\275\366\007f\262q\373@\243\265d\213F\275\267"
+	.ascii	"?~\233e}\\\240\217\357K\275\247k\237\237\205!\350\266G\r\\\333"
+	.ascii	"S\254^\033\0332\274\241O\250\205\264\245q\273\303\322\260^\265"
+	.ascii	"\210s\211#U$\013\204\362\254\205*\365:\201[pdQ\352\265.X\035"
+	.ascii	"\366\205\177f\306\t\024\225\254/|\233\203\006\207\334\216\030"
+	.ascii	"\352\255}\266\237m\341\026\307?\003\004\233Z:\003\202om\330\033"
+	.ascii	"\377\214\345\223\342\304\251\336\333x\341[\0268\200\245\206\220"
+	.ascii	"zm\027f\262\331\3720S7\246EG\275\267]\277]\241nY.\023*\024\215"
+	.ascii	"+\273z-\323\326\270\345\262[\331ra\300\3149\311r\345"
+	.string	"\210\3119)\247\233\202n\n\356\220.\036I~\367630N\363\374lV\320\255V\345a\346\346V\357MM\030\334s\005\013\313\2549\003\017+Sp\217\235\f\031A\232Z[\260t\031\301=^b\304\230\313\321\004~\311}\345\350\201{\302PQY\030F\264\236W.lq\261U\2670.\0251+t\365\336\313g~pRb\366V\300>URvJ\252\307\t\rZU\263f\t\373$\261Q6J\001dR\236\277f\233\226\245,\330G\355\351O\326)\204\314\301\335\r1A\200kJ\262\210q\303>nM\326E\223u\na\331#\244\306\357\211^\227>'\261\031\030|tA\035\301>V,\013\313\3022\315\340U \303\232L\r-&\217z-S\253a)pR\340\202`\237;%\245\035\315\032,9\"Qt`\237/B\001\312#\243\243\t\022+\214FF\036\244\200l\300\212\017D\020\222@U\bC\250"
+	.string	"\347D!D \213\034\320\240M\212\032\241\350\t\307#\236\024Y\"\211\302\260\250LB Y\004@\232\342\247(\375\021=P\242I\342\216\021\231*\217\310aP'yT\302\321\320(\034r8Q\210$JD\026\005\207\035\026\020\001\023%\220\360 \270"
+	.string	"\020H\030!H\342D\020\205\211\235#\252s\242\020\"\222)\252\242\230\022\037P\006\223#\340d\321h,\026\375N\024B\204\022L\240\020\241D\207R\241r\002\024\206H#\t4E\222\310Ya\204$\241<Q\b\243#d:\024LQ%Z$L\205F\"*\030\036\217J(\321d\3151E\225I\006m\224\301\343\220\221\314q\310\310\242\027(&o2\211\246D\242\020\270\302\b9\274\251\322\310\376fE\252L\026\207\320\023A\"z\034*\032\205@\"\232<\272C4\t\274P)$\006\207\214B\340\244B\242\3415\032\025\241%\f\031I\020\201#\th\321Q\022=A<\242F\311#\024H'\216$\234\350\240L\205J\024\034\320\244\211\021\222&\224\305\243\t\233\023\303\364\247\3149Q\210a\020-**\217G\251\210a"
+	.ascii	"jx.\b\241L\205F!\224B\242\021\004\036(B\225\311\025(n>\374\260"
+	.ascii	"\230\242Gt\b\037\003\r\f\240\301\006H\300o t\201\320\005\277"
+	.ascii	"o \024\024$\244A\020\276\006AVi<A\230,\2020t,\026\245\302\036"
+	.ascii	"4H4\201\204<\001\210\006\223CBc\211\235\023\205@JE \245<H)\215"
+	.ascii	"\221\260h\230\312\244("
+	.string	"\261\250\002)5\n\213)\232\3349\"\213\311\344\321\tI\034$\324ht\004B\n\243\220\210\306\210\034\"\225\310\324(\207X\234Q\036\217\220\303`\2124X4J\006\221R\016(\261\230\246\250\nd\360X\234@\031\004\016\tK@\026\203CGF\243\237\035\244\362H\030$\036\213'\004\225\302d\260\350(U\242\200\032%!\260A\215\302a\222F\231\242*\216\305`1\231Lk\206)\261X$s,\026a\024\206(\321\020IX\204s\222$\214B\025GdQ)4\"\215RTy41L9$Q4\035BA@\215CG\017\212\204$T\030\245\330`D\217G!\3210\210t$\314!\032\221DI4%*\001U\n=@\211\310\021\322\242\360\347X\034\242\311\243 \222\260(\210\224\326$\203C\305\024G$\t\035\234\024)\220;DCe1\205d\320h,\242\020\354\301+\204F\224\030L\001i\fB\240\fn"
+	.string	"D\323#\":D\246F\301\r'\362p\244\021\232\212P\"\221\251\210\232dP\031\324 Hy,\002\223\312#\252\002\375\r\035\213)RY<\"\213hP\025E\345P\370C\323\243\224\347\204\217\261(,A,\032\205*xR@\212\200\032\225JdJ\244\334Qz@D\211\222\305c\261\004\372\001\321x\204$B1t,\022\217Bc\007\037e\360"
+	.string	"#\224\307\342\021V\242I4u"
+	.string	"\021YLQ\007\b\225B\020\220N\f\035\213*\212\350\020M!@\203\016\310A\223B\"#\0314x\302\347#\206\031p0\202(D@\210\236s\300\001\211\t \320"
+	.ascii	"\006\340a\b4\2050i,\nS\210P\022\r\025\215)D\034\213\302\"\021"
+	.ascii	"\3034)\"D\004\250R\250D\201\302\261(\002RZcD\"?\b\312l]%\232"
+	.ascii	"#2`1[\301:}\200\007eC+\017\007\215)I\227\233Uc\b\321\272Q\257"
+	.ascii	"\323Y\243\266\302\231\n3\236"
+	.string	"6\331\216H\025V\335\335\220\274\027\352\365\321\222q\257dT;\f\326\226;[\330\207H\214kucX\247\316S\027\204Q\351\354a"
+	.string	"\274\270RW\205+ua\314,i\254\242\\\251"
+	.string	"ta\334\252\273-\025\274T]*\0260j\320A\347\224\201Q\244F]\275w\2526\345l\201\311\362\205\005\377\367E\265\273gX8\272\242\344\254\033\223\030d\250P\326\212\225V\\\214z\257\323u\361\373\364\373T\357S\203W\250\202\341<J\302J!3$#2\222&Icr\n\020\006\344i\026\347\366\006\022"
+	.string	"\024E\321B\246\214\314\210\210\210$%)H\226\335k\313\203\341\365=k[\336#\317A)\322\221\313\366\020\335\344\343\350\201\205\232t\344\""
+	.string	"\037\3660%\376\241\027\261s\005\355\337~\330\355vF$KF^\213\316\204\264\322@\216\306G\3062\027c\r&\357\212\001\377~sq\325k>\242h\034\200\304 /\2113\304\340cv2\021\002\265\251\310G\246*\246cN\367l\f\217\307(2\f\350\277\257\276a\276\366\200\200\253\345J\300\031c\3326\277\244\276\245Z\241\n\177\321`S\332H\374\221\202\247fd\260\351>i:\352\233\033\024O\264Y2j\247;\023>#\332\231\2055\034\333\200f\3008\005\241s\211\240H4\310PR\225m\367;\212B\202.\331"
+	.ascii	"\367\355\201\300\303]\\\243&7\322\266\326g\037b|\316I\004\b\216"
+	.ascii	"!!1u\222@\264\025t\003\003+ \031K\025\274+T\315\260!\373\307"
+	.ascii	"g\204\240v\300\326\300r\006\205\304c\032I\240~\351i\366\257\r"
+	.ascii	"\340u\215m\326$\360\236qR\037\347K\314\366^\025\211\252]0\f\032"
+	.ascii	"\035\005t\201\313\210\300\013\025\242\252\"\315#\003\252jAy7"
+	.ascii	"-\356\325s\036H\r\236w\212\276c\377\360\313\324\331G\311\224"
+	.ascii	"l,\002\026P\210I A\246\243\227\030\327\244\364\246\244\t\003"
+	.ascii	"\371\204*\360\317+e\032.\214\345)\0178\332s\020\212\004\344\310"
+	.ascii	"`/\t\371_4w\205c\241IW3\037\341\357\233\371\016\245\307F^\376"
+	.ascii	"\307\320E\237\376Ms\007\002)\213\360\207\221.{\306r\242\005\026"
+	.ascii	"\273\352*\323\030\tF\275\307'\230\032T\2417Z\245\224\345\030"
+	.ascii	"!\004x\001\267\225\315!\337\244\001\367\343\021\3506\003\250"
+	.ascii	"4\212T\3024\310\023\271\016\217\365\2222\226\322ei\212\377\255"
+	.ascii	"\013\325\026#j\f\2340\333\370.f\271iPp\231\372N\354g\304b\006"
+	.ascii	"\270\217n\034\311\277\365\n\bA~)\307\352\360\344\252\2402\305"
+	.ascii	"[\203\246\310\301uC&\3230\246\262\260X\224}L\"5\230\372\320\221"
+	.ascii	"\262\234Op\230jd\360U\332\003%\355\371\252|~\330n\002'w\311\004"
+	.ascii	"TJ\353\203\3545\372l\365x!\001\366i\265\341\3555\203\027m\301"
+	.ascii	"\024\220\322\316x\024\235\272\bP\355\305\310\306\230\332\n\304"
+	.ascii	"N\215\262\003\311\nn\251\200dg\277\231+\377\th%\323(J\006K\023"
+	.ascii	"\363\325\267\255"
+	.string	"\372\250\365?\202n#\310\265\253A\342a\017\356\363\037\021:R\274p\020\244\351\2251g\r\375\205\262@E\314M8\260\277c\204\350j\271nf\356\3272\233\3730Hg\255\356\r\200\021f\323,K\215\361\300Pb1\222\022\320\365\f\266\244q\222U\235\303=1uT=^\304~;(\304q+!,\272~1\240i\270\\\323=p^\203\364\236C\312|\330\004\260\"\261\022\274\2026\331\360l\365\034\377\007\3159\377\361\264\3073\223\353\236%9\263\021\247D$~\3311eW\r\013\234\214@9\027\316\376\266\204n&;\353\234\034h\250X~\202@\254\210/\264\201\304\364\231Xic8S\302\0176\210\004q%SG\353\235\377\036\304\213\244\241\376\235@H\262,r\013\250\2333\260\206\224\246\342:0s6\246\276\f\2404\215\254Pa\256\2773\262\022\305\377[\321\243<q\274\2457\221_@\270\310?0E"
+	.ascii	"\301\271\376\322\371\021\330l\205NE\"Nc\263\002\354\021. \214"
+	.ascii	"\343\023\367^\316\022\223\177\307\"\304B\213\224\202\241\022"
+	.ascii	"\204,G\013\267B\b\222`E)\330\354\241\240\203F4\034\261\372.I"
+	.ascii	"\001B\325\r\0370q\236\006c6\330\005.#6O\016B\2567"
+	.string	"\365 \207\3278\201\"E4\350\016\206\367\304Q\022=Y\202\340w\317\241\265%\375\325\322\226Z}\351\264\233\223*\242\017[\306\240\205@\345\271\021\237\204R\271\222\226S)\230\204\373(\241UC\037\316X\1770}\277R\347\376\272\202/\020\373z\225\376Z\260\033\355i\325\3146p\344\262\332*\245\264\372\307\204$\363\035e\260NEJj\327\364\303\201wt\224\310*\203P\2333c\0347\332v\033\224\016A$\253=\251\004.\\\\\252k\344$\220\035\311k\213\316\256\303\2073\tN\324C\241\267\035/zAxj\020\316\346WJ\032\377K\370\360\021\022\004zrd\270-\036\006\262$S}\324)\t\247\241\306\237<?A\333F\3001\202\boe\373*\213g\277\376O\346\201\217\017\311\351\037'\301\300\235\024\232cX\212#\214L^-\243oVyF\306\250\261\204b.\\\307\227\002\263T\260\001\006\301R\226E"
+	.string	"j`\261\304\275\226Ab\022\335~\242\240\216\315\023\244\343\352\tP)|\376\332\263T\233v\\S\332`\313Xq\315\333\257\370\313\336\363+\037V\265OxR,h#A\254$q\251\207r\237L\371\371P|\225wNjCZ\301\231\345\037\375\003>\025\327\002/o]\254\252\345A\025h\037\br\\\316\3217\247\006K\366u\321\263.\233\337\013\240`s\307O\307pZ\037\037e%\340\322\374\32230\272 \244\326\340 \3543\362*\002\037HO\f\033A(`\022\034\325\254M\364\023I\006\225e\277\320\220\001M<\346\361\253r\364jA"
+	.ascii	"\252\331\345\223\311r\002\343\246|T&\002\210\n\346\356qe\251"
+	.ascii	"\t\r\262oN%\243\267Pw\250\r\273\366\206jk\364~F:\006\343;\355"
+	.ascii	"m\021\2752o\274l\t\306_x7i\375\274\234Glg\353\255`\362\236\250"
+	.ascii	"\257\367\354\221?y\376W\355M\366\214\277w\352\177\267\351\264"
+	.ascii	"\373\017\265D\357\177\243:\200\324\271\"~\320\342y\324~\300\327"
+	.ascii	"\204W\373O\251\2279zj\274\007\276\007\270\0306\037\244\347\221"
+	.ascii	"\007\200\331i\247\241w_\356\231\364\377?\213?%\270W\352\230\352"
+	.ascii	"\253\036\303\027\036\307\363\2032|8\311\351eN\027\332\0218\247"
+	.ascii	"\3666\312\323\375\223E\230\213\247D\037\036O\276\037\274o\250"
+	.ascii	"\2176=\006\300)\270\363\204\265\345k\210\374\006\373x\377\300"
+	.ascii	"\\=\300\225>\001{A\274\260\305\001\332\2609?\365\351\352s\003"
+	.ascii	"f\rT\032\321\267\204\243\342\304\340\0279\343\363\311u\017c\203"
+	.ascii	"p\273\240\207\237]\016{\233\"\331I\261\201z@\273\222\035\347"
+	.ascii	"\356|\373v~\340-a\373\334\257\252\021+\232\260#\201\303\311h"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.symtab.a386ebcb14c4d832,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a386ebcb14c4d832,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18526 @@
+	.file	"imu.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/common/maths.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/common/time.h"
+	.file 9 "./src/main/fc/runtime_config.h"
+	.file 10 "./src/main/flight/imu.h"
+	.file 11 "./src/main/drivers/io_types.h"
+	.file 12 "./src/main/flight/pid.h"
+	.file 13 "./src/main/io/gps.h"
+	.file 14 "./src/main/drivers/bus_i2c.h"
+	.file 15 "./src/main/drivers/bus.h"
+	.file 16 "./src/main/drivers/sensor.h"
+	.file 17 "./src/main/drivers/accgyro/accgyro.h"
+	.file 18 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 22 "./src/main/sensors/sensors.h"
+	.file 23 "./src/main/sensors/acceleration.h"
+	.file 24 "./src/main/drivers/resource.h"
+	.file 25 "./src/main/sensors/compass.h"
+	.file 26 "./src/main/flight/imu.c"
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 28 "/usr/include/pthread.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	imu.c.97a63623
+	.weak	imu.c.97a63623
+imu.c.97a63623:
+	.long	0x1138
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF2596
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2290
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2291
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2292
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2293
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2294
+	.uleb128 0x3
+	.long	.LASF2295
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2296
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2297
+	.uleb128 0x3
+	.long	.LASF2298
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2299
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2301
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2302
+	.uleb128 0x3
+	.long	.LASF2303
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2304
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2305
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2306
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2307
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2308
+	.uleb128 0x14
+	.long	0xdb
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2309
+	.uleb128 0x1f
+	.long	.LASF2372
+	.byte	0x4
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x4
+	.byte	0xd4
+	.byte	0x9
+	.long	0x111
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x4
+	.byte	0xd6
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2310
+	.byte	0x4
+	.byte	0xd7
+	.byte	0x3
+	.long	0xfa
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x135
+	.uleb128 0x19
+	.string	"X"
+	.byte	0
+	.uleb128 0x19
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x19
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2320
+	.byte	0xc
+	.byte	0x5
+	.byte	0x37
+	.byte	0x10
+	.long	0x164
+	.uleb128 0x8
+	.string	"X"
+	.byte	0x5
+	.byte	0x38
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x8
+	.string	"Y"
+	.byte	0x5
+	.byte	0x39
+	.byte	0xb
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x8
+	.string	"Z"
+	.byte	0x5
+	.byte	0x3a
+	.byte	0xb
+	.long	0xdb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2312
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x3
+	.long	0x135
+	.uleb128 0x21
+	.long	.LASF2395
+	.byte	0xc
+	.byte	0x5
+	.byte	0x3d
+	.long	0x191
+	.uleb128 0xe
+	.string	"A"
+	.byte	0x5
+	.byte	0x3e
+	.byte	0xb
+	.long	0x191
+	.uleb128 0xe
+	.string	"V"
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x15
+	.long	0x164
+	.byte	0
+	.uleb128 0x12
+	.long	0xdb
+	.long	0x1a1
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2313
+	.byte	0x5
+	.byte	0x40
+	.byte	0x3
+	.long	0x170
+	.uleb128 0x3
+	.long	.LASF2314
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x1e0
+	.uleb128 0x1a
+	.long	.LASF2315
+	.value	0xfff
+	.uleb128 0x1a
+	.long	.LASF2316
+	.value	0xf000
+	.uleb128 0x1a
+	.long	.LASF2317
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2319
+	.byte	0x6
+	.byte	0x29
+	.byte	0xf
+	.long	0x1ec
+	.uleb128 0x22
+	.long	0x1fc
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x5
+	.long	0x21d
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0xe
+	.string	"fn"
+	.byte	0x6
+	.byte	0x33
+	.byte	0x16
+	.long	0x21d
+	.byte	0
+	.uleb128 0x7
+	.long	0x1e0
+	.uleb128 0x6
+	.long	.LASF2321
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x10
+	.long	0x27e
+	.uleb128 0x8
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1ad
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2322
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2323
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x27e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2324
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x27e
+	.byte	0x10
+	.uleb128 0x8
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x30
+	.byte	0xf
+	.long	0x283
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x6
+	.byte	0x34
+	.byte	0x7
+	.long	0x1fc
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x7
+	.long	0x27e
+	.uleb128 0x3
+	.long	.LASF2326
+	.byte	0x6
+	.byte	0x35
+	.byte	0x3
+	.long	0x222
+	.uleb128 0x14
+	.long	0x288
+	.uleb128 0x3
+	.long	.LASF2327
+	.byte	0x8
+	.byte	0x21
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x9
+	.byte	0x15
+	.long	0x2bd
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2335
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x9
+	.byte	0x58
+	.long	0x2f3
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2336
+	.byte	0x9
+	.byte	0x64
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF2337
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0xa
+	.long	.LASF2338
+	.byte	0xa
+	.byte	0x1b
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF2339
+	.byte	0xa
+	.byte	0x1c
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x12
+	.long	0xab
+	.long	0x333
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2340
+	.byte	0xa
+	.byte	0x1d
+	.byte	0x10
+	.long	0x323
+	.uleb128 0x20
+	.byte	0x6
+	.byte	0xa
+	.byte	0x22
+	.byte	0x5
+	.long	0x370
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0xa
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0xa
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0xa
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x17
+	.byte	0x6
+	.byte	0xa
+	.byte	0x20
+	.byte	0x9
+	.long	0x392
+	.uleb128 0xe
+	.string	"raw"
+	.byte	0xa
+	.byte	0x21
+	.byte	0xd
+	.long	0x392
+	.uleb128 0x13
+	.long	.LASF2343
+	.byte	0xa
+	.byte	0x27
+	.byte	0x7
+	.long	0x33f
+	.byte	0
+	.uleb128 0x12
+	.long	0x9f
+	.long	0x3a2
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2344
+	.byte	0xa
+	.byte	0x28
+	.byte	0x3
+	.long	0x370
+	.uleb128 0xa
+	.long	.LASF2345
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x3a2
+	.uleb128 0x6
+	.long	.LASF2346
+	.byte	0x2
+	.byte	0xa
+	.byte	0x2c
+	.byte	0x10
+	.long	0x3df
+	.uleb128 0x8
+	.string	"xy"
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x8
+	.string	"z"
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2347
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x3
+	.long	0x3ba
+	.uleb128 0x6
+	.long	.LASF2348
+	.byte	0x8
+	.byte	0xa
+	.byte	0x31
+	.byte	0x10
+	.long	0x43a
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0xa
+	.byte	0x32
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0xa
+	.byte	0x33
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0xa
+	.byte	0x34
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0xa
+	.byte	0x35
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0xa
+	.byte	0x36
+	.byte	0x13
+	.long	0x3df
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2354
+	.byte	0xa
+	.byte	0x37
+	.byte	0x3
+	.long	0x3eb
+	.uleb128 0x14
+	.long	0x43a
+	.uleb128 0xa
+	.long	.LASF2355
+	.byte	0xa
+	.byte	0x39
+	.byte	0x14
+	.long	0x43a
+	.uleb128 0xa
+	.long	.LASF2356
+	.byte	0xa
+	.byte	0x39
+	.byte	0x39
+	.long	0x43a
+	.uleb128 0x6
+	.long	.LASF2357
+	.byte	0xc
+	.byte	0xa
+	.byte	0x3b
+	.byte	0x10
+	.long	0x4b2
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0xa
+	.byte	0x3c
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xb
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0xa
+	.byte	0x3f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0xa
+	.byte	0x40
+	.byte	0x13
+	.long	0x3df
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2358
+	.byte	0xa
+	.byte	0x41
+	.byte	0x3
+	.long	0x463
+	.uleb128 0x3
+	.long	.LASF2359
+	.byte	0xb
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2360
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xc
+	.byte	0x25
+	.long	0x51f
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0xa
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2373
+	.byte	0xc
+	.byte	0x79
+	.byte	0x5
+	.long	0x4ca
+	.uleb128 0x6
+	.long	.LASF2374
+	.byte	0xc
+	.byte	0xd
+	.byte	0x4f
+	.byte	0x10
+	.long	0x560
+	.uleb128 0x8
+	.string	"lat"
+	.byte	0xd
+	.byte	0x50
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x8
+	.string	"lon"
+	.byte	0xd
+	.byte	0x51
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x8
+	.string	"alt"
+	.byte	0xd
+	.byte	0x52
+	.byte	0xe
+	.long	0xc3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2375
+	.byte	0xd
+	.byte	0x53
+	.byte	0x3
+	.long	0x52b
+	.uleb128 0x6
+	.long	.LASF2376
+	.byte	0x18
+	.byte	0xd
+	.byte	0x55
+	.byte	0x10
+	.long	0x5c8
+	.uleb128 0x2
+	.long	.LASF2377
+	.byte	0xd
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x8
+	.string	"llh"
+	.byte	0xd
+	.byte	0x57
+	.byte	0x13
+	.long	0x560
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2378
+	.byte	0xd
+	.byte	0x58
+	.byte	0xe
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2379
+	.byte	0xd
+	.byte	0x59
+	.byte	0xe
+	.long	0xc3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2380
+	.byte	0xd
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2381
+	.byte	0xd
+	.byte	0x5b
+	.byte	0xe
+	.long	0xc3
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2382
+	.byte	0xd
+	.byte	0x5c
+	.byte	0x3
+	.long	0x56c
+	.uleb128 0xa
+	.long	.LASF2383
+	.byte	0xd
+	.byte	0x76
+	.byte	0x1a
+	.long	0x5c8
+	.uleb128 0x29
+	.long	.LASF2389
+	.byte	0x5
+	.byte	0x4
+	.long	0x7c
+	.byte	0xe
+	.byte	0x1e
+	.byte	0xe
+	.long	0x611
+	.uleb128 0x2a
+	.long	.LASF2384
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2389
+	.byte	0xe
+	.byte	0x24
+	.byte	0x3
+	.long	0x5e0
+	.uleb128 0x6
+	.long	.LASF2390
+	.byte	0x10
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xc
+	.long	0x645
+	.uleb128 0x2
+	.long	.LASF2391
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x16
+	.long	0x645
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2392
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xe
+	.long	0x4be
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x111
+	.uleb128 0x6
+	.long	.LASF2393
+	.byte	0x8
+	.byte	0xf
+	.byte	0x21
+	.byte	0xc
+	.long	0x672
+	.uleb128 0x2
+	.long	.LASF2394
+	.byte	0xf
+	.byte	0x22
+	.byte	0x12
+	.long	0x611
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2323
+	.byte	0xf
+	.byte	0x23
+	.byte	0x10
+	.long	0xb7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2396
+	.byte	0x10
+	.byte	0xf
+	.byte	0x19
+	.long	0x697
+	.uleb128 0xe
+	.string	"spi"
+	.byte	0xf
+	.byte	0x20
+	.byte	0x7
+	.long	0x61d
+	.uleb128 0xe
+	.string	"i2c"
+	.byte	0xf
+	.byte	0x24
+	.byte	0x7
+	.long	0x64a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2397
+	.byte	0xf
+	.byte	0x25
+	.byte	0x3
+	.long	0x672
+	.uleb128 0x14
+	.long	0x697
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x10
+	.byte	0x17
+	.long	0x6ea
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2407
+	.byte	0x10
+	.byte	0x21
+	.byte	0x3
+	.long	0x6a8
+	.uleb128 0x3
+	.long	.LASF2408
+	.byte	0x10
+	.byte	0x27
+	.byte	0x10
+	.long	0x702
+	.uleb128 0x7
+	.long	0x707
+	.uleb128 0x22
+	.long	0x712
+	.uleb128 0x4
+	.long	0x712
+	.byte	0
+	.uleb128 0x7
+	.long	0x717
+	.uleb128 0x6
+	.long	.LASF2409
+	.byte	0x88
+	.byte	0x11
+	.byte	0x4c
+	.byte	0x10
+	.long	0x7b4
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0x11
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x6f6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0x11
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x7b4
+	.byte	0x8
+	.uleb128 0x8
+	.string	"bus"
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x11
+	.long	0x697
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2412
+	.byte	0x11
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2413
+	.byte	0x11
+	.byte	0x51
+	.byte	0xd
+	.long	0x392
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2414
+	.byte	0x11
+	.byte	0x52
+	.byte	0xa
+	.long	0x98
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2415
+	.byte	0x11
+	.byte	0x53
+	.byte	0x9
+	.long	0x4ca
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2416
+	.byte	0x11
+	.byte	0x55
+	.byte	0x15
+	.long	0xa81
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2417
+	.byte	0x11
+	.byte	0x57
+	.byte	0x14
+	.long	0x6ea
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0x11
+	.byte	0x58
+	.byte	0x1a
+	.long	0x93e
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2419
+	.byte	0x11
+	.byte	0x59
+	.byte	0x18
+	.long	0x886
+	.byte	0x68
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2420
+	.byte	0x10
+	.byte	0x28
+	.byte	0xf
+	.long	0x7c0
+	.uleb128 0x7
+	.long	0x7c5
+	.uleb128 0x1b
+	.long	0x4ca
+	.long	0x7d4
+	.uleb128 0x4
+	.long	0x712
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2421
+	.byte	0x12
+	.byte	0x80
+	.byte	0xf
+	.long	0x7e0
+	.uleb128 0x7
+	.long	0x7e5
+	.uleb128 0x1b
+	.long	0x4ca
+	.long	0x803
+	.uleb128 0x4
+	.long	0x803
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0x27e
+	.byte	0
+	.uleb128 0x7
+	.long	0x6a3
+	.uleb128 0x3
+	.long	.LASF2422
+	.byte	0x12
+	.byte	0x81
+	.byte	0xf
+	.long	0x814
+	.uleb128 0x7
+	.long	0x819
+	.uleb128 0x1b
+	.long	0x4ca
+	.long	0x832
+	.uleb128 0x4
+	.long	0x803
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2423
+	.byte	0x12
+	.byte	0x82
+	.byte	0x10
+	.long	0x83e
+	.uleb128 0x7
+	.long	0x843
+	.uleb128 0x2b
+	.uleb128 0x6
+	.long	.LASF2424
+	.byte	0x20
+	.byte	0x12
+	.byte	0x86
+	.byte	0x10
+	.long	0x886
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0x12
+	.byte	0x87
+	.byte	0x1a
+	.long	0x7d4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2425
+	.byte	0x12
+	.byte	0x88
+	.byte	0x1b
+	.long	0x808
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2426
+	.byte	0x12
+	.byte	0x89
+	.byte	0x13
+	.long	0x832
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0x12
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2428
+	.byte	0x12
+	.byte	0x8b
+	.byte	0x3
+	.long	0x844
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x12
+	.byte	0xa9
+	.long	0x8e6
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2441
+	.byte	0x12
+	.byte	0xb6
+	.byte	0x3
+	.long	0x892
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x12
+	.byte	0xb8
+	.long	0x90a
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2444
+	.byte	0x12
+	.byte	0xbb
+	.byte	0x3
+	.long	0x8f2
+	.uleb128 0x6
+	.long	.LASF2445
+	.byte	0x8
+	.byte	0x12
+	.byte	0xbd
+	.byte	0x10
+	.long	0x93e
+	.uleb128 0x2
+	.long	.LASF2446
+	.byte	0x12
+	.byte	0xbe
+	.byte	0x11
+	.long	0x8e6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2447
+	.byte	0x12
+	.byte	0xbf
+	.byte	0x19
+	.long	0x90a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2448
+	.byte	0x12
+	.byte	0xc0
+	.byte	0x3
+	.long	0x916
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2449
+	.uleb128 0x6
+	.long	.LASF2450
+	.byte	0x10
+	.byte	0x13
+	.byte	0x33
+	.byte	0x10
+	.long	0x979
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0x13
+	.byte	0x35
+	.byte	0x23
+	.long	0x979
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2452
+	.byte	0x13
+	.byte	0x36
+	.byte	0x23
+	.long	0x979
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x951
+	.uleb128 0x3
+	.long	.LASF2453
+	.byte	0x13
+	.byte	0x37
+	.byte	0x3
+	.long	0x951
+	.uleb128 0x6
+	.long	.LASF2454
+	.byte	0x28
+	.byte	0x14
+	.byte	0x16
+	.byte	0x8
+	.long	0xa00
+	.uleb128 0x2
+	.long	.LASF2455
+	.byte	0x14
+	.byte	0x18
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2456
+	.byte	0x14
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2457
+	.byte	0x14
+	.byte	0x1a
+	.byte	0x7
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2458
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2459
+	.byte	0x14
+	.byte	0x20
+	.byte	0x7
+	.long	0x7c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2460
+	.byte	0x14
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2461
+	.byte	0x14
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2462
+	.byte	0x14
+	.byte	0x24
+	.byte	0x14
+	.long	0x97e
+	.byte	0x18
+	.byte	0
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x15
+	.byte	0x20
+	.byte	0x9
+	.long	0xa22
+	.uleb128 0x13
+	.long	.LASF2463
+	.byte	0x15
+	.byte	0x22
+	.byte	0x8
+	.long	0xa22
+	.uleb128 0x13
+	.long	.LASF2464
+	.byte	0x15
+	.byte	0x23
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x12
+	.long	0x98
+	.long	0xa32
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2465
+	.byte	0x15
+	.byte	0x24
+	.byte	0x3
+	.long	0xa00
+	.uleb128 0x14
+	.long	0xa32
+	.uleb128 0x17
+	.byte	0x28
+	.byte	0x15
+	.byte	0x43
+	.byte	0x9
+	.long	0xa71
+	.uleb128 0x13
+	.long	.LASF2466
+	.byte	0x15
+	.byte	0x45
+	.byte	0x1c
+	.long	0x98a
+	.uleb128 0x13
+	.long	.LASF2463
+	.byte	0x15
+	.byte	0x46
+	.byte	0x8
+	.long	0xa71
+	.uleb128 0x13
+	.long	.LASF2464
+	.byte	0x15
+	.byte	0x47
+	.byte	0xc
+	.long	0x8f
+	.byte	0
+	.uleb128 0x12
+	.long	0x98
+	.long	0xa81
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2467
+	.byte	0x15
+	.byte	0x48
+	.byte	0x3
+	.long	0xa43
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2468
+	.uleb128 0x3
+	.long	.LASF2469
+	.byte	0x11
+	.byte	0x5a
+	.byte	0x3
+	.long	0x717
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x16
+	.byte	0x14
+	.long	0xaca
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x16
+	.byte	0x2d
+	.long	0xb00
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2482
+	.byte	0xa0
+	.byte	0x17
+	.byte	0x2c
+	.byte	0x10
+	.long	0xb42
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x17
+	.byte	0x2d
+	.byte	0xe
+	.long	0xa94
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2483
+	.byte	0x17
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0x17
+	.byte	0x2f
+	.byte	0xd
+	.long	0x323
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x17
+	.byte	0x30
+	.byte	0x9
+	.long	0x4ca
+	.byte	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2486
+	.byte	0x17
+	.byte	0x31
+	.byte	0x3
+	.long	0xb00
+	.uleb128 0x23
+	.string	"acc"
+	.byte	0x17
+	.byte	0x33
+	.long	0xb42
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x18
+	.byte	0x14
+	.long	0xc7f
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2516
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2517
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2518
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2534
+	.byte	0x10
+	.byte	0x19
+	.byte	0x23
+	.byte	0x10
+	.long	0xca7
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0x19
+	.byte	0x24
+	.byte	0xd
+	.long	0x323
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0x19
+	.byte	0x25
+	.byte	0xb
+	.long	0xdb
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2537
+	.byte	0x19
+	.byte	0x26
+	.byte	0x3
+	.long	0xc7f
+	.uleb128 0x23
+	.string	"mag"
+	.byte	0x19
+	.byte	0x28
+	.long	0xca7
+	.uleb128 0x5
+	.long	.LASF2538
+	.byte	0x38
+	.byte	0x18
+	.long	0xa81
+	.uleb128 0x10
+	.long	0x333
+	.byte	0x50
+	.byte	0x9
+	.uleb128 0x10
+	.long	0x2ff
+	.byte	0x52
+	.byte	0xa
+	.uleb128 0x10
+	.long	0x30b
+	.byte	0x53
+	.byte	0x5
+	.uleb128 0x10
+	.long	0x317
+	.byte	0x54
+	.byte	0x7
+	.uleb128 0x5
+	.long	.LASF2539
+	.byte	0x56
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2540
+	.byte	0x57
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2541
+	.byte	0x58
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2536
+	.byte	0x5a
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2542
+	.byte	0x5c
+	.byte	0x1b
+	.long	0x4b2
+	.uleb128 0xd
+	.string	"q0"
+	.byte	0x5e
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0xd
+	.string	"q1"
+	.byte	0x5e
+	.byte	0x19
+	.long	0xdb
+	.uleb128 0xd
+	.string	"q2"
+	.byte	0x5e
+	.byte	0x24
+	.long	0xdb
+	.uleb128 0xd
+	.string	"q3"
+	.byte	0x5e
+	.byte	0x2f
+	.long	0xdb
+	.uleb128 0x12
+	.long	0xdb
+	.long	0xd5a
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2543
+	.byte	0x5f
+	.byte	0xe
+	.long	0xd44
+	.uleb128 0x10
+	.long	0x3ae
+	.byte	0x61
+	.byte	0x17
+	.uleb128 0xa
+	.long	.LASF2544
+	.byte	0x1a
+	.byte	0x63
+	.byte	0x1a
+	.long	0x446
+	.uleb128 0x10
+	.long	0x44b
+	.byte	0x63
+	.byte	0x41
+	.uleb128 0x10
+	.long	0x457
+	.byte	0x63
+	.byte	0x5f
+	.uleb128 0xa
+	.long	.LASF2545
+	.byte	0x1a
+	.byte	0x63
+	.byte	0x89
+	.long	0x294
+	.uleb128 0x2c
+	.long	0xd86
+	.byte	0xb0
+	.uleb128 0x2d
+	.long	0xd6c
+	.byte	0x65
+	.byte	0x13
+	.uleb128 0x11
+	.long	.LASF2546
+	.byte	0x1b
+	.byte	0x3b
+	.byte	0x39
+	.long	0xdb
+	.long	0xdba
+	.uleb128 0x4
+	.long	0xdb
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2547
+	.byte	0x5
+	.byte	0x6b
+	.byte	0x7
+	.long	0xdb
+	.long	0xdd0
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2548
+	.byte	0x1b
+	.byte	0x35
+	.byte	0x39
+	.long	0xdb
+	.long	0xde6
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2549
+	.byte	0x5
+	.byte	0x51
+	.byte	0x9
+	.long	0xab
+	.long	0xe01
+	.uleb128 0x4
+	.long	0xab
+	.uleb128 0x4
+	.long	0xab
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2550
+	.byte	0x1b
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xe18
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2551
+	.byte	0x1c
+	.value	0x343
+	.byte	0xc
+	.long	0x7c
+	.long	0xe2f
+	.uleb128 0x4
+	.long	0xe2f
+	.byte	0
+	.uleb128 0x7
+	.long	0xa81
+	.uleb128 0x11
+	.long	.LASF2552
+	.byte	0x9
+	.byte	0x69
+	.byte	0x5
+	.long	0x4ca
+	.long	0xe4a
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2553
+	.byte	0x1c
+	.value	0x30d
+	.byte	0xc
+	.long	0x7c
+	.long	0xe66
+	.uleb128 0x4
+	.long	0xe2f
+	.uleb128 0x4
+	.long	0xe66
+	.byte	0
+	.uleb128 0x7
+	.long	0xa3e
+	.uleb128 0x11
+	.long	.LASF2554
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x7
+	.long	0xdb
+	.long	0xe81
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2555
+	.byte	0x5
+	.byte	0x57
+	.byte	0x7
+	.long	0xdb
+	.long	0xe97
+	.uleb128 0x4
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2556
+	.value	0x1f9
+	.long	0xecb
+	.uleb128 0x15
+	.string	"w"
+	.value	0x1f9
+	.byte	0x1f
+	.long	0xdb
+	.uleb128 0x15
+	.string	"x"
+	.value	0x1f9
+	.byte	0x28
+	.long	0xdb
+	.uleb128 0x15
+	.string	"y"
+	.value	0x1f9
+	.byte	0x31
+	.long	0xdb
+	.uleb128 0x15
+	.string	"z"
+	.value	0x1f9
+	.byte	0x3a
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2557
+	.value	0x1ef
+	.long	0xefb
+	.uleb128 0x16
+	.long	.LASF2341
+	.value	0x1ef
+	.byte	0x1e
+	.long	0xdb
+	.uleb128 0x16
+	.long	.LASF2342
+	.value	0x1ef
+	.byte	0x2a
+	.long	0xdb
+	.uleb128 0x15
+	.string	"yaw"
+	.value	0x1ef
+	.byte	0x37
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2597
+	.byte	0x1a
+	.value	0x1de
+	.byte	0x9
+	.long	0x9f
+	.long	0xf25
+	.uleb128 0x16
+	.long	.LASF2558
+	.value	0x1de
+	.byte	0x32
+	.long	0xb7
+	.uleb128 0xc
+	.long	.LASF2559
+	.value	0x1e8
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2598
+	.byte	0x1a
+	.value	0x1d9
+	.byte	0x7
+	.long	0xdb
+	.uleb128 0x1d
+	.long	.LASF2560
+	.value	0x1c5
+	.long	0xf4a
+	.uleb128 0x16
+	.long	.LASF2561
+	.value	0x1c5
+	.byte	0x21
+	.long	0x299
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2570
+	.byte	0x1a
+	.value	0x193
+	.byte	0xd
+	.long	0xfac
+	.uleb128 0x16
+	.long	.LASF2561
+	.value	0x193
+	.byte	0x34
+	.long	0x299
+	.uleb128 0xc
+	.long	.LASF2562
+	.value	0x195
+	.byte	0x15
+	.long	0xcf
+	.uleb128 0xc
+	.long	.LASF2563
+	.value	0x196
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0xc
+	.long	.LASF2564
+	.value	0x197
+	.byte	0x9
+	.long	0x4ca
+	.uleb128 0xc
+	.long	.LASF2565
+	.value	0x198
+	.byte	0x9
+	.long	0x4ca
+	.uleb128 0xc
+	.long	.LASF2566
+	.value	0x199
+	.byte	0x9
+	.long	0x4ca
+	.uleb128 0xc
+	.long	.LASF2567
+	.value	0x19b
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2594
+	.byte	0x1a
+	.value	0x18e
+	.byte	0xc
+	.long	0x4ca
+	.uleb128 0x32
+	.long	.LASF2580
+	.byte	0x1a
+	.value	0x181
+	.byte	0xc
+	.long	0x4ca
+	.long	0xfe5
+	.uleb128 0xc
+	.long	.LASF2568
+	.value	0x183
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x33
+	.uleb128 0xc
+	.long	.LASF2569
+	.value	0x184
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2599
+	.byte	0x1a
+	.value	0x16f
+	.byte	0xd
+	.uleb128 0x1e
+	.long	.LASF2571
+	.byte	0xc8
+	.long	0x102f
+	.uleb128 0x18
+	.long	.LASF2567
+	.byte	0xc8
+	.byte	0x2f
+	.long	0xcf
+	.uleb128 0x5
+	.long	.LASF2572
+	.byte	0xca
+	.byte	0x14
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2573
+	.byte	0xcb
+	.byte	0x12
+	.long	0xdb
+	.uleb128 0xd
+	.string	"dT"
+	.byte	0xce
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x5
+	.long	.LASF2574
+	.byte	0xd0
+	.byte	0x11
+	.long	0x1a1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2575
+	.byte	0xbb
+	.long	0x105f
+	.uleb128 0x35
+	.string	"v"
+	.byte	0x1a
+	.byte	0xbb
+	.byte	0x39
+	.long	0x105f
+	.uleb128 0xd
+	.string	"x"
+	.byte	0xbe
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0xd
+	.string	"y"
+	.byte	0xbf
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0xd
+	.string	"z"
+	.byte	0xc0
+	.byte	0x11
+	.long	0xe2
+	.byte	0
+	.uleb128 0x7
+	.long	0x1a1
+	.uleb128 0x24
+	.long	.LASF2576
+	.byte	0xb2
+	.uleb128 0x24
+	.long	.LASF2577
+	.byte	0xa4
+	.uleb128 0x36
+	.long	.LASF2578
+	.byte	0x1a
+	.byte	0x99
+	.byte	0x6
+	.long	0x1088
+	.uleb128 0x18
+	.long	.LASF2579
+	.byte	0x99
+	.byte	0x1c
+	.long	0xc3
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2581
+	.byte	0x94
+	.long	0xdb
+	.long	0x10a2
+	.uleb128 0x18
+	.long	.LASF2579
+	.byte	0x94
+	.byte	0x33
+	.long	0xc3
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2582
+	.byte	0x8f
+	.long	0xdb
+	.long	0x10bc
+	.uleb128 0x18
+	.long	.LASF2583
+	.byte	0x8f
+	.byte	0x3d
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2584
+	.byte	0x6d
+	.long	0x112a
+	.uleb128 0x5
+	.long	.LASF2585
+	.byte	0x6f
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2586
+	.byte	0x70
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2587
+	.byte	0x71
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2588
+	.byte	0x73
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2589
+	.byte	0x74
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2590
+	.byte	0x75
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2591
+	.byte	0x76
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2592
+	.byte	0x77
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2593
+	.byte	0x78
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF2595
+	.byte	0xa
+	.byte	0x39
+	.byte	0x6a
+	.long	0x1136
+	.uleb128 0x7
+	.long	0x446
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 29 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.file 32 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 34 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 35 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 45 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 54 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.file 55 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 56 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 57 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 59 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 60 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 61 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3d
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1542
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x4
+	.file 62 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x40
+	.file 65 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1556
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.file 66 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1686
+	.file 67 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1691
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1700
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1705
+	.byte	0x4
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 75 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1738
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1739
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1740
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1741
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1742
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1743
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1744
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1745
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1746
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1747
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1748
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1760
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1767
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1768
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1769
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1772
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5a
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1773
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.file 92 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5c
+	.file 93 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1807
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1808
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x19
+	.file 94 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5e
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.file 95 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x5f
+	.file 96 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x60
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.file 97 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 98 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 99 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x63
+	.file 100 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 101 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x65
+	.file 102 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 103 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x67
+	.file 104 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x68
+	.byte	0x4
+	.byte	0x4
+	.file 105 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x69
+	.file 106 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2240
+	.byte	0x4
+	.file 107 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2242
+	.file 108 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2245
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0x4
+	.byte	0x4
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x4
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x70
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0x4
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2289
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF989
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF993
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF995
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1300
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1317
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1384
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1411
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1589
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1367
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1704
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1722
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1766
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1818
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1856
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2224
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2227
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2239
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2257
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2269
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2274
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2279
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2281
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2285
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF2286
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2600
+	.long	.LASF2601
+	.long	.LASF2602
+	.long	.LASF2603
+	.long	.LASF2604
+	.long	.LASF2605
+	.long	.LASF2606
+	.long	.LASF2607
+	.long	.LASF2608
+	.long	.LASF2609
+	.long	.LASF2610
+	.long	.LASF2611
+	.long	.LASF2612
+	.long	.LASF2613
+	.long	.LASF2614
+	.long	.LASF2615
+	.long	.LASF2616
+	.long	.LASF2617
+	.long	.LASF2618
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x75
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2619
+	.byte	0xf
+	.long	.LASF2620
+	.byte	0xf
+	.long	.LASF2621
+	.byte	0xf
+	.long	.LASF2622
+	.byte	0xb
+	.long	.LASF2623
+	.byte	0x2
+	.long	.LASF2624
+	.byte	0x3
+	.long	.LASF2625
+	.byte	0x2
+	.long	.LASF2626
+	.byte	0x2
+	.long	.LASF2627
+	.byte	0x7
+	.long	.LASF2628
+	.byte	0x8
+	.long	.LASF2629
+	.byte	0x6
+	.long	.LASF2630
+	.byte	0x8
+	.long	.LASF2631
+	.byte	0x9
+	.long	.LASF2632
+	.byte	0x6
+	.long	.LASF2633
+	.byte	0x6
+	.long	.LASF2634
+	.byte	0x6
+	.long	.LASF2635
+	.byte	0x4
+	.long	.LASF2636
+	.byte	0x4
+	.long	.LASF2637
+	.byte	0xf
+	.long	.LASF2638
+	.byte	0xf
+	.long	.LASF2639
+	.byte	0xf
+	.long	.LASF2640
+	.byte	0xa
+	.long	.LASF2641
+	.byte	0xa
+	.long	.LASF2642
+	.byte	0x6
+	.long	.LASF2643
+	.byte	0xa
+	.long	.LASF2644
+	.byte	0x8
+	.long	.LASF2645
+	.byte	0xf
+	.long	.LASF2646
+	.byte	0x12
+	.long	.LASF2647
+	.byte	0x12
+	.long	.LASF2648
+	.byte	0x13
+	.long	.LASF2649
+	.byte	0x13
+	.long	.LASF2649
+	.byte	0x12
+	.long	.LASF2650
+	.byte	0xf
+	.long	.LASF2651
+	.byte	0x12
+	.long	.LASF2652
+	.byte	0x12
+	.long	.LASF2653
+	.byte	0xf
+	.long	.LASF2654
+	.byte	0xf
+	.long	.LASF2655
+	.byte	0x11
+	.long	.LASF2656
+	.byte	0xf
+	.long	.LASF2657
+	.byte	0x10
+	.long	.LASF2658
+	.byte	0x10
+	.long	.LASF2659
+	.byte	0xf
+	.long	.LASF2660
+	.byte	0xf
+	.long	.LASF2661
+	.byte	0xf
+	.long	.LASF2662
+	.byte	0x12
+	.long	.LASF2663
+	.byte	0xf
+	.long	.LASF2664
+	.byte	0xf
+	.long	.LASF2665
+	.byte	0xf
+	.long	.LASF2666
+	.byte	0xf
+	.long	.LASF2667
+	.byte	0xf
+	.long	.LASF2668
+	.byte	0xf
+	.long	.LASF2669
+	.byte	0xf
+	.long	.LASF2670
+	.byte	0xf
+	.long	.LASF2671
+	.byte	0xd
+	.long	.LASF2672
+	.byte	0xc
+	.long	.LASF2673
+	.byte	0x13
+	.long	.LASF2674
+	.byte	0xc
+	.long	.LASF2675
+	.byte	0x1
+	.long	.LASF2676
+	.byte	0x1
+	.long	.LASF2677
+	.byte	0x3
+	.long	.LASF2626
+	.byte	0x6
+	.long	.LASF2678
+	.byte	0x8
+	.long	.LASF2679
+	.byte	0x6
+	.long	.LASF2680
+	.byte	0x6
+	.long	.LASF2681
+	.byte	0x6
+	.long	.LASF2682
+	.byte	0x6
+	.long	.LASF2683
+	.byte	0x12
+	.long	.LASF2684
+	.byte	0xe
+	.long	.LASF2685
+	.byte	0xe
+	.long	.LASF2686
+	.byte	0xf
+	.long	.LASF2687
+	.byte	0xf
+	.long	.LASF2683
+	.byte	0xf
+	.long	.LASF2688
+	.byte	0xe
+	.long	.LASF2689
+	.byte	0xf
+	.long	.LASF2626
+	.byte	0x12
+	.long	.LASF2626
+	.byte	0xf
+	.long	.LASF2690
+	.byte	0xe
+	.long	.LASF2691
+	.byte	0xe
+	.long	.LASF2692
+	.byte	0xe
+	.long	.LASF2693
+	.byte	0xe
+	.long	.LASF2694
+	.byte	0xe
+	.long	.LASF2695
+	.byte	0xe
+	.long	.LASF2696
+	.byte	0xe
+	.long	.LASF2697
+	.byte	0xf
+	.long	.LASF2698
+	.byte	0xf
+	.long	.LASF2699
+	.byte	0xf
+	.long	.LASF2700
+	.byte	0xf
+	.long	.LASF2701
+	.byte	0xe
+	.long	.LASF2702
+	.byte	0xe
+	.long	.LASF2703
+	.byte	0xf
+	.long	.LASF2704
+	.byte	0xf
+	.long	.LASF2705
+	.byte	0xa
+	.long	.LASF2705
+	.byte	0x5
+	.long	.LASF2706
+	.byte	0x6
+	.long	.LASF2707
+	.byte	0x6
+	.long	.LASF2708
+	.byte	0x2
+	.long	.LASF2709
+	.byte	0x6
+	.long	.LASF2710
+	.byte	0xa
+	.long	.LASF2711
+	.byte	0xa
+	.long	.LASF2712
+	.byte	0x6
+	.long	.LASF2713
+	.byte	0xa
+	.long	.LASF2714
+	.byte	0x2
+	.long	.LASF2715
+	.byte	0xa
+	.long	.LASF2716
+	.byte	0xa
+	.long	.LASF2717
+	.byte	0xa
+	.long	.LASF2718
+	.byte	0xa
+	.long	.LASF2719
+	.byte	0x12
+	.long	.LASF2720
+	.byte	0x13
+	.long	.LASF2721
+	.byte	0xe
+	.long	.LASF2722
+	.byte	0xe
+	.long	.LASF2723
+	.byte	0xe
+	.long	.LASF2724
+	.byte	0xe
+	.long	.LASF2725
+	.byte	0xe
+	.long	.LASF2726
+	.byte	0xe
+	.long	.LASF2727
+	.byte	0xf
+	.long	.LASF2719
+	.byte	0xf
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2216:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1061:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2234:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1852:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF732:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2464:
+	.string	"__align"
+.LASF1187:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2424:
+	.string	"mpuConfiguration_s"
+.LASF2428:
+	.string	"mpuConfiguration_t"
+.LASF965:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1992:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1872:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1281:
+	.string	"USE_FAKE_BARO "
+.LASF1057:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2113:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF948:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2238:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1863:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1377:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1248:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2454:
+	.string	"__pthread_mutex_s"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF841:
+	.string	"__DECL_SIMD_sinh "
+.LASF2260:
+	.string	"__ssize_t_defined "
+.LASF1425:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1947:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1898:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1242:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF769:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1721:
+	.string	"sched_priority sched_priority"
+.LASF1302:
+	.string	"USE_PPM"
+.LASF1569:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2437:
+	.string	"ICM_20602_SPI"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1693:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2577:
+	.string	"imuInit"
+.LASF1861:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF2119:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF905:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF885:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF742:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1657:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1625:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1700:
+	.string	"__pid_t_defined "
+.LASF1692:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2325:
+	.string	"reset"
+.LASF1542:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1437:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2200:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2101:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF946:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1329:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2295:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1722:
+	.string	"__sched_priority sched_priority"
+.LASF1030:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1940:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF1005:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2120:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2360:
+	.string	"_Bool"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1323:
+	.string	"VTX_COMMON"
+.LASF700:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1563:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF2065:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"SKIP_IMU_CALC "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1267:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2561:
+	.string	"currentTimeUs"
+.LASF1119:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1707:
+	.string	"__CPU_SETSIZE 1024"
+.LASF909:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1243:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2495:
+	.string	"OWNER_ADC_CURR"
+.LASF837:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF889:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1688:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1919:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1516:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1870:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2180:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2153:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1737:
+	.string	"TIMER_ABSTIME 1"
+.LASF2025:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1499:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1815:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1890:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2404:
+	.string	"CW90_DEG_FLIP"
+.LASF1731:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2241:
+	.string	"_STDIO_H 1"
+.LASF2389:
+	.string	"I2CDevice"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2143:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2043:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"short unsigned int"
+.LASF1328:
+	.string	"USE_SPI"
+.LASF1834:
+	.string	"PP_IIF_0(t,f) f"
+.LASF2108:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1571:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF2406:
+	.string	"CW270_DEG_FLIP"
+.LASF1547:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF746:
+	.string	"__DECL_SIMD_expf64 "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1249:
+	.string	"USE_SENSOR_NAMES "
+.LASF1394:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2212:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2243:
+	.string	"__need___va_list"
+.LASF2559:
+	.string	"angle"
+.LASF1500:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF717:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1492:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2541:
+	.string	"smallAngleCosZ"
+.LASF890:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2051:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF2035:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2184:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1677:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2159:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2130:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1456:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2492:
+	.string	"OWNER_LED"
+.LASF705:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2331:
+	.string	"GPS_FIX"
+.LASF1883:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2188:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1900:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1772:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF730:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2426:
+	.string	"resetFn"
+.LASF2306:
+	.string	"uint16_t"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1023:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1477:
+	.string	"PG_RX_CONFIG 24"
+.LASF1711:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2390:
+	.string	"deviceSpi_s"
+.LASF1066:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2151:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1921:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2351:
+	.string	"small_angle"
+.LASF1233:
+	.string	"TELEMETRY_HOTT "
+.LASF724:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF863:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1032:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1447:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1182:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF699:
+	.string	"_MATH_H 1"
+.LASF2083:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1397:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2104:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1845:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1339:
+	.string	"_T_PTRDIFF_ "
+.LASF2597:
+	.string	"calculateThrottleAngleCorrection"
+.LASF1333:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1665:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1496:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF713:
+	.string	"__DECL_SIMD_sinl "
+.LASF1602:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1488:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1296:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1867:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2288:
+	.string	"IMU_UNLOCK pthread_mutex_unlock(&imuUpdateLock)"
+.LASF1627:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF1197:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2172:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2266:
+	.string	"SEEK_SET 0"
+.LASF2189:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1473:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2312:
+	.string	"t_fp_vector_def"
+.LASF1803:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2258:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF961:
+	.string	"__DECL_SIMD_tan "
+.LASF1840:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2332:
+	.string	"CALIBRATE_MAG"
+.LASF1072:
+	.string	"__DECL_SIMD_erfc"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1368:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2225:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF734:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1871:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1705:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2233:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1036:
+	.string	"__DECL_SIMD_atan2"
+.LASF2062:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2175:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2271:
+	.string	"L_tmpnam 20"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1104:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1470:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1626:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1559:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1640:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF790:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2183:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2363:
+	.string	"PID_YAW"
+.LASF2076:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2139:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF733:
+	.string	"__DECL_SIMD_logl "
+.LASF1991:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF2211:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2499:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2518:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1078:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1064:
+	.string	"__DECL_SIMD_tanh"
+.LASF1454:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF2150:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF970:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1879:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1818:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1837:
+	.string	"BIT(x) (1 << (x))"
+.LASF2523:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2538:
+	.string	"imuUpdateLock"
+.LASF1938:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"__DECL_SIMD_exp "
+.LASF2383:
+	.string	"gpsSol"
+.LASF1562:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF951:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1076:
+	.string	"__DECL_SIMD_tan"
+.LASF816:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF833:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1199:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1134:
+	.string	"_Mdouble_"
+.LASF2304:
+	.string	"int32_t"
+.LASF2544:
+	.string	"pgResetTemplate_imuConfig"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2162:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1423:
+	.string	"FAST_MATH "
+.LASF1280:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF991:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1416:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1826:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF925:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1658:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1718:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1650:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1379:
+	.string	"___int_wchar_t_h "
+.LASF2531:
+	.string	"OWNER_SPI_PREINIT"
+.LASF743:
+	.string	"__DECL_SIMD_expl "
+.LASF2287:
+	.string	"IMU_LOCK pthread_mutex_unlock(&imuUpdateLock)"
+.LASF2133:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1850:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1903:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1934:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1003:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1545:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1326:
+	.string	"VTX_TRAMP"
+.LASF2284:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF2358:
+	.string	"imuRuntimeConfig_t"
+.LASF1601:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2520:
+	.string	"OWNER_BARO_EXTI"
+.LASF996:
+	.string	"__DECL_SIMD_acos"
+.LASF2268:
+	.string	"SEEK_END 2"
+.LASF990:
+	.string	"__DECL_SIMD_expf"
+.LASF1925:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF2230:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF515:
+	.string	"__always_inline"
+.LASF807:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF926:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1868:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2339:
+	.string	"accVelScale"
+.LASF1948:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF840:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF839:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1998:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1859:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2215:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2343:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2498:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1493:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1135:
+	.string	"__MATH_PRECNAME"
+.LASF876:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1599:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10"
+.LASF1506:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1040:
+	.string	"__DECL_SIMD_log10"
+.LASF2317:
+	.string	"PGR_SIZE_MASK"
+.LASF1145:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1024:
+	.string	"__DECL_SIMD_expm1"
+.LASF808:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1009:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1138:
+	.string	"_Mdouble_ float"
+.LASF1752:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1926:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1792:
+	.string	"__cleanup_fct_attribute "
+.LASF2457:
+	.string	"__owner"
+.LASF976:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1122:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1245:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2170:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"_T_SIZE_ "
+.LASF1570:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF718:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF913:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1171:
+	.string	"__MATHCALL_NARROW"
+.LASF1679:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2027:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"USE_DASHBOARD "
+.LASF1725:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1636:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1580:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1048:
+	.string	"__DECL_SIMD_log1p"
+.LASF1612:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1156:
+	.string	"__MATHDECL_1"
+.LASF1049:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1704:
+	.string	"SCHED_RR 2"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2521:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2004:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2413:
+	.string	"ADCRaw"
+.LASF2246:
+	.string	"____mbstate_t_defined 1"
+.LASF2415:
+	.string	"dataReady"
+.LASF1148:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF922:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1449:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2126:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1364:
+	.string	"_GCC_SIZE_T "
+.LASF2303:
+	.string	"int16_t"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1712:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF2455:
+	.string	"__lock"
+.LASF1092:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2286:
+	.string	"__STDIO_INLINE"
+.LASF1759:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1481:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2584:
+	.string	"imuComputeRotationMatrix"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1829:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1451:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2161:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"__DECL_SIMD_log2f"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2403:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1544:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF801:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2453:
+	.string	"__pthread_list_t"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2310:
+	.string	"SPI_TypeDef"
+.LASF1920:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2522:
+	.string	"OWNER_USB_DETECT"
+.LASF819:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2057:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1797:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2095:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2041:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2420:
+	.string	"sensorAccReadFuncPtr"
+.LASF1183:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2477:
+	.string	"SENSOR_BARO"
+.LASF2429:
+	.string	"MPU_NONE"
+.LASF930:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2096:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2373:
+	.string	"airmodeWasActivated"
+.LASF1084:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2345:
+	.string	"attitude"
+.LASF2503:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1321:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2136:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2002:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1485:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1529:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2376:
+	.string	"gpsSolutionData_s"
+.LASF1827:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2491:
+	.string	"OWNER_SERVO"
+.LASF1839:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1274:
+	.string	"ACC "
+.LASF2444:
+	.string	"mpu6050Resolution_e"
+.LASF975:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1606:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1467:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1198:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1240:
+	.string	"TELEMETRY_IBUS "
+.LASF1219:
+	.string	"USE_PWM "
+.LASF826:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1299:
+	.string	"TELEMETRY_LTM"
+.LASF1550:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1795:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1893:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2285:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF1548:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2210:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1619:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF760:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1696:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1880:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2293:
+	.string	"long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2399:
+	.string	"CW0_DEG"
+.LASF2341:
+	.string	"roll"
+.LASF1345:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1944:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1806:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2296:
+	.string	"__int16_t"
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2111:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1901:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2298:
+	.string	"__uint16_t"
+.LASF1107:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1651:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2490:
+	.string	"OWNER_MOTOR"
+.LASF827:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2570:
+	.string	"imuCalculateEstimatedAttitude"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1393:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2223:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2355:
+	.string	"imuConfig_System"
+.LASF1432:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1673:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2357:
+	.string	"imuRuntimeConfig_s"
+.LASF2517:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1270:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF872:
+	.string	"__DECL_SIMD_log10f "
+.LASF2402:
+	.string	"CW270_DEG"
+.LASF2005:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF797:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1832:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1732:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1193:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1399:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF766:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2012:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2031:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1949:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1189:
+	.string	"M_E 2.7182818284590452354"
+.LASF1034:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1282:
+	.string	"USE_FLASHFS "
+.LASF1939:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1590:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF2466:
+	.string	"__data"
+.LASF2179:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1974:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2028:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF936:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1422:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1676:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF729:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1041:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1557:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1396:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1185:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2471:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2138:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2480:
+	.string	"SENSOR_GPS"
+.LASF1103:
+	.string	"__f32x(x) x ##f32x"
+.LASF815:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2044:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2000:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1137:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1566:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1728:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1194:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1824:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1161:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1169:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1530:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1990:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1250:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1033:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1788:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1862:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2290:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1400:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1878:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF758:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1120:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1724:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2007:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1113:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1540:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1555:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1071:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1346:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1802:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2068:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2467:
+	.string	"pthread_mutex_t"
+.LASF1273:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1258:
+	.string	"USE_NAV "
+.LASF1486:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2085:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1214:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1897:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1469:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1272:
+	.string	"USE_FAKE_LED "
+.LASF2231:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1662:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2308:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1464:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2468:
+	.string	"long long int"
+.LASF1884:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2176:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1708:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF2032:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1785:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1391:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1616:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1276:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1520:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2588:
+	.string	"q0q1"
+.LASF923:
+	.string	"__DECL_SIMD_erfl "
+.LASF2548:
+	.string	"acosf"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2229:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF1825:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1950:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1303:
+	.string	"USE_PWM"
+.LASF1813:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1896:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1959:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF784:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1338:
+	.string	"_PTRDIFF_T "
+.LASF2249:
+	.string	"__FILE_defined 1"
+.LASF2321:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF973:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1398:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1406:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1051:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1620:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1784:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF2398:
+	.string	"ALIGN_DEFAULT"
+.LASF1418:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF849:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1592:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1236:
+	.string	"USE_SERVOS "
+.LASF1779:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF2556:
+	.string	"imuSetAttitudeQuat"
+.LASF1931:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2192:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2416:
+	.string	"lock"
+.LASF2529:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1230:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2441:
+	.string	"mpuSensor_e"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1660:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2459:
+	.string	"__kind"
+.LASF774:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1186:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1667:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2382:
+	.string	"gpsSolutionData_t"
+.LASF1471:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2482:
+	.string	"acc_s"
+.LASF2486:
+	.string	"acc_t"
+.LASF1142:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2226:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF1179:
+	.string	"FP_NORMAL 4"
+.LASF1965:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1376:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1629:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2086:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1227:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2431:
+	.string	"MPU_60x0"
+.LASF1130:
+	.string	"_Mdouble_ double"
+.LASF1404:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2545:
+	.string	"imuConfig_Registry"
+.LASF2512:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1635:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2182:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1876:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1833:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF822:
+	.string	"__DECL_SIMD_coshf "
+.LASF1350:
+	.string	"__SIZE_T__ "
+.LASF903:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2356:
+	.string	"imuConfig_Copy"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1943:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2067:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2418:
+	.string	"mpuDetectionResult"
+.LASF1775:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1617:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1881:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1970:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1987:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2599:
+	.string	"imuUpdateEulerAngles"
+.LASF1152:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1912:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1993:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2432:
+	.string	"MPU_60x0_SPI"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2315:
+	.string	"PGR_PGN_MASK"
+.LASF2081:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1978:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2278:
+	.string	"stdout stdout"
+.LASF1093:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2116:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1132:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1634:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1916:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF2261:
+	.string	"_IOFBF 0"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1770:
+	.string	"____sigset_t_defined "
+.LASF2554:
+	.string	"cos_approx"
+.LASF1687:
+	.string	"_SCHED_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2131:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF710:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF873:
+	.string	"__DECL_SIMD_log10l "
+.LASF398:
+	.string	"false 0"
+.LASF1593:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF1549:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1501:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1686:
+	.string	"_PTHREAD_H 1"
+.LASF1527:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2311:
+	.string	"test"
+.LASF750:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2557:
+	.string	"imuSetAttitudeRPY"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1074:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1614:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2173:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2019:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1095:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1165:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2279:
+	.string	"stderr stderr"
+.LASF972:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1047:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF966:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1598:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1297:
+	.string	"STACK_CHECK"
+.LASF860:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2534:
+	.string	"mag_s"
+.LASF2537:
+	.string	"mag_t"
+.LASF879:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2163:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"__DECL_SIMD_asinf "
+.LASF2463:
+	.string	"__size"
+.LASF1652:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1810:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1639:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2322:
+	.string	"size"
+.LASF1218:
+	.string	"USE_PPM "
+.LASF2280:
+	.string	"__attr_dealloc_fclose"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF2193:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2472:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1911:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1511:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1067:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2425:
+	.string	"writeFn"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1162:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1680:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1268:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1556:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF974:
+	.string	"__DECL_SIMD_cosf"
+.LASF1146:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2564:
+	.string	"useAcc"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF749:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF906:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF702:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1065:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2206:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1440:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1605:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF735:
+	.string	"__DECL_SIMD_logf32 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1439:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2582:
+	.string	"calculateAccZLowPassFilterRCTimeConstant"
+.LASF1358:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2526:
+	.string	"OWNER_INVERTER"
+.LASF1196:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1734:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1560:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF2507:
+	.string	"OWNER_SPI_MOSI"
+.LASF1980:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2185:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2456:
+	.string	"__count"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2006:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2305:
+	.string	"uint8_t"
+.LASF2585:
+	.string	"q1q1"
+.LASF2591:
+	.string	"q1q2"
+.LASF2592:
+	.string	"q1q3"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1574:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2506:
+	.string	"OWNER_SPI_MISO"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2174:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1946:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1973:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1136:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2024:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1760:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1831:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1906:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2473:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2014:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"TELEMETRY "
+.LASF2445:
+	.string	"mpuDetectionResult_s"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF767:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1637:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1702:
+	.string	"SCHED_OTHER 0"
+.LASF1055:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1776:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1073:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF959:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF941:
+	.string	"__DECL_SIMD_asinh "
+.LASF1996:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2056:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1424:
+	.string	"VERY_FAST_MATH "
+.LASF2208:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1552:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2362:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF828:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1363:
+	.string	"___int_size_t_h "
+.LASF969:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1315:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1538:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2124:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2396:
+	.string	"busDevice_u"
+.LASF1790:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2037:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1176:
+	.string	"FP_INFINITE 1"
+.LASF1166:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1167:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1168:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF711:
+	.string	"__DECL_SIMD_sin "
+.LASF1761:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1387:
+	.string	"NULL ((void *)0)"
+.LASF1318:
+	.string	"TELEMETRY_CRSF"
+.LASF1278:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_"
+.LASF979:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2483:
+	.string	"accSamplingInterval"
+.LASF869:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1086:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1356:
+	.string	"_SIZE_T_ "
+.LASF2519:
+	.string	"OWNER_MPU_EXTI"
+.LASF1713:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF995:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1181:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1851:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1367:
+	.string	"__need_size_t"
+.LASF1077:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2489:
+	.string	"OWNER_PPMINPUT"
+.LASF1816:
+	.string	"IOCFG_IPD 0"
+.LASF1348:
+	.string	"__need_ptrdiff_t"
+.LASF754:
+	.string	"__DECL_SIMD_powf16 "
+.LASF785:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1111:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1209:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1558:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF823:
+	.string	"__DECL_SIMD_coshl "
+.LASF1405:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2198:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2569:
+	.string	"axis"
+.LASF1150:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1489:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1335:
+	.string	"_STDDEF_H "
+.LASF2141:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF908:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1022:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2148:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1653:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1164:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2156:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1216:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1517:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1968:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF739:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1583:
+	.string	"LON 1"
+.LASF2078:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1975:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1674:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1515:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1139:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1908:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1969:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1525:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1446:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF775:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1484:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1594:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1361:
+	.string	"_SIZE_T_DECLARED "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2084:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2009:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1087:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1694:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2391:
+	.string	"instance"
+.LASF2450:
+	.string	"__pthread_internal_list"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1866:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2071:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF2451:
+	.string	"__prev"
+.LASF1976:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2220:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1312:
+	.string	"LED_STRIP"
+.LASF2115:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1039:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1085:
+	.string	"__f128(x) x ##f128"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1141:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1889:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2352:
+	.string	"acc_unarmedcal"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2160:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1819:
+	.string	"NOOP do {} while (0)"
+.LASF2479:
+	.string	"SENSOR_SONAR"
+.LASF1885:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1554:
+	.string	"IO_TAG_NONE 0"
+.LASF1780:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1309:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2026:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1310:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1568:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2578:
+	.string	"imuConfigure"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF796:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF997:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF783:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1232:
+	.string	"TELEMETRY_FRSKY "
+.LASF1855:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF962:
+	.string	"__DECL_SIMD_tanf "
+.LASF2102:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2539:
+	.string	"throttleAngleScale"
+.LASF1600:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1526:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2476:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2502:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2598:
+	.string	"getCosTiltAngle"
+.LASF2263:
+	.string	"_IONBF 2"
+.LASF2323:
+	.string	"address"
+.LASF2385:
+	.string	"I2CDEV_1"
+.LASF1436:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2154:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2379:
+	.string	"groundSpeed"
+.LASF2040:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2100:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1986:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1308:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF703:
+	.string	"__DECL_SIMD_cosl "
+.LASF821:
+	.string	"__DECL_SIMD_cosh "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1817:
+	.string	"IOCFG_IPU 0"
+.LASF2015:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1124:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1271:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1386:
+	.string	"NULL"
+.LASF2330:
+	.string	"GPS_FIX_HOME"
+.LASF1701:
+	.string	"_BITS_SCHED_H 1"
+.LASF1140:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1768:
+	.string	"__have_pthread_attr_t 1"
+.LASF2342:
+	.string	"pitch"
+.LASF1366:
+	.string	"__size_t "
+.LASF2504:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2586:
+	.string	"q2q2"
+.LASF2593:
+	.string	"q2q3"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1502:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1941:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1865:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1382:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1395:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1758:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2366:
+	.string	"PID_POSR"
+.LASF1820:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2265:
+	.string	"EOF (-1)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1621:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2433:
+	.string	"MPU_65xx_I2C"
+.LASF929:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1261:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1503:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1211:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1221:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1192:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2439:
+	.string	"ICM_20689_SPI"
+.LASF1317:
+	.string	"USE_RESOURCE_MGMT"
+.LASF882:
+	.string	"__DECL_SIMD_log2f "
+.LASF2558:
+	.string	"throttle_correction_value"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2335:
+	.string	"armingFlags"
+.LASF2152:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF931:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1553:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2029:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF731:
+	.string	"__DECL_SIMD_log "
+.LASF2318:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF2562:
+	.string	"previousIMUUpdateTime"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1083:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2565:
+	.string	"useMag"
+.LASF1461:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1044:
+	.string	"__DECL_SIMD_log2"
+.LASF1228:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1314:
+	.string	"TELEMETRY_HOTT"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2494:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2003:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF2158:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1952:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1565:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1059:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1962:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"UNIT_TESTED "
+.LASF1460:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2094:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2380:
+	.string	"groundCourse"
+.LASF1755:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1611:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2484:
+	.string	"accSmooth"
+.LASF2239:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF780:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF2589:
+	.string	"q0q2"
+.LASF2590:
+	.string	"q0q3"
+.LASF1374:
+	.string	"_WCHAR_T_ "
+.LASF1918:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"__DECL_SIMD_logf"
+.LASF2423:
+	.string	"mpuResetFnPtr"
+.LASF1753:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF999:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1452:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF779:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2596:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1099:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1455:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1608:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1444:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1208:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF2346:
+	.string	"accDeadband_s"
+.LASF2347:
+	.string	"accDeadband_t"
+.LASF1923:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"_Mdouble_ _Float128"
+.LASF1536:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2091:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1894:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF950:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2253:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2166:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1907:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1757:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1283:
+	.string	"USE_FAKE_FLASH "
+.LASF897:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1042:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1546:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1229:
+	.string	"BLACKBOX "
+.LASF1224:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1589:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2103:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2018:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1805:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1747:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2452:
+	.string	"__next"
+.LASF2546:
+	.string	"atan2f"
+.LASF893:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1740:
+	.string	"__clockid_t_defined 1"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF820:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF725:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1388:
+	.string	"__need_NULL"
+.LASF898:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1170:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1754:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1151:
+	.string	"_Mdouble_ _Float32x"
+.LASF1417:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2465:
+	.string	"pthread_mutexattr_t"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2485:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF1933:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1914:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1874:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF755:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF886:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1322:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF771:
+	.string	"__DECL_SIMD_atan "
+.LASF1672:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF817:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1577:
+	.string	"PIDSUM_LIMIT 500"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1285:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1157:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2329:
+	.string	"WAS_EVER_ARMED"
+.LASF1237:
+	.string	"CMS "
+.LASF2421:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1020:
+	.string	"__DECL_SIMD_cosh"
+.LASF2247:
+	.string	"_____fpos64_t_defined 1"
+.LASF2579:
+	.string	"throttle_correction_angle"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1462:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1887:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1642:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1026:
+	.string	"__DECL_SIMD_expm1f"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1706:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1821:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2461:
+	.string	"__elision"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2273:
+	.string	"FILENAME_MAX 4096"
+.LASF788:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2393:
+	.string	"deviceI2C_s"
+.LASF2510:
+	.string	"OWNER_SDCARD"
+.LASF1203:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF891:
+	.string	"__DECL_SIMD_log1p "
+.LASF1646:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1927:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF963:
+	.string	"__DECL_SIMD_tanl "
+.LASF818:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2203:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1685:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1414:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1158:
+	.string	"__MATHDECL"
+.LASF1955:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_atanf"
+.LASF1052:
+	.string	"__DECL_SIMD_atanh"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1035:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2294:
+	.string	"signed char"
+.LASF1100:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1438:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF736:
+	.string	"__DECL_SIMD_logf64 "
+.LASF719:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1895:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1349:
+	.string	"__size_t__ "
+.LASF1234:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1173:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1235:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1266:
+	.string	"U_ID_1 1"
+.LASF1070:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1295:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1378:
+	.string	"_WCHAR_T_H "
+.LASF2422:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1050:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2411:
+	.string	"readFn"
+.LASF2575:
+	.string	"imuTransformVectorBodyToEarth"
+.LASF1690:
+	.string	"__time_t_defined 1"
+.LASF2587:
+	.string	"q3q3"
+.LASF1607:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF919:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1421:
+	.string	"sq(x) ((x)*(x))"
+.LASF715:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF887:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1787:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1017:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1841:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1411:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2109:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1767:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1001:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1102:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1357:
+	.string	"_BSD_SIZE_T_ "
+.LASF2127:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1298:
+	.string	"USE_DASHBOARD"
+.LASF1238:
+	.string	"TELEMETRY_LTM "
+.LASF1582:
+	.string	"LAT 0"
+.LASF1259:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1204:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1957:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1746:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1798:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1877:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF883:
+	.string	"__DECL_SIMD_log2l "
+.LASF1659:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1360:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1478:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF984:
+	.string	"__DECL_SIMD_log"
+.LASF2414:
+	.string	"revisionCode"
+.LASF1256:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1091:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1330:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2372:
+	.string	"SystemCoreClock"
+.LASF1000:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2052:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1331:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1482:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1143:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2242:
+	.string	"__need___va_list "
+.LASF1745:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1369:
+	.string	"__WCHAR_T__ "
+.LASF2353:
+	.string	"accDeadband"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2147:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1794:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1904:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1337:
+	.string	"_ANSI_STDDEF_H "
+.LASF1465:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2595:
+	.string	"imuConfig"
+.LASF1537:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1954:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2524:
+	.string	"OWNER_OSD"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1783:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF1988:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2118:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2201:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2316:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1468:
+	.string	"PG_PID_PROFILE 14"
+.LASF2167:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1487:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF859:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1942:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1628:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF2435:
+	.string	"MPU_9250_SPI"
+.LASF1207:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1195:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2274:
+	.string	"L_ctermid 9"
+.LASF1869:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2013:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1121:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2232:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1928:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1222:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1849:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF728:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1539:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2060:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF917:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1253:
+	.string	"VTX_SMARTAUDIO "
+.LASF2542:
+	.string	"imuRuntimeConfig"
+.LASF2410:
+	.string	"initFn"
+.LASF1581:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1419:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1441:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2267:
+	.string	"SEEK_CUR 1"
+.LASF1177:
+	.string	"FP_ZERO 2"
+.LASF2367:
+	.string	"PID_NAVR"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2070:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2144:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1875:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2573:
+	.string	"accz_smooth"
+.LASF1664:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2269:
+	.string	"P_tmpdir \"/tmp\""
+.LASF2073:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1004:
+	.string	"__DECL_SIMD_asin"
+.LASF1807:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1507:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF888:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1257:
+	.string	"GPS "
+.LASF1808:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1025:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1045:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2336:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1856:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1334:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF2149:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2301:
+	.string	"long int"
+.LASF1963:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1008:
+	.string	"__DECL_SIMD_hypot"
+.LASF1474:
+	.string	"PG_SERVO_MIXER 21"
+.LASF978:
+	.string	"__DECL_SIMD_sinf"
+.LASF2255:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF884:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2386:
+	.string	"I2CDEV_2"
+.LASF2387:
+	.string	"I2CDEV_3"
+.LASF2388:
+	.string	"I2CDEV_4"
+.LASF1519:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1684:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1632:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2536:
+	.string	"magneticDeclination"
+.LASF1433:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF920:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF847:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1801:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2500:
+	.string	"OWNER_PINDEBUG"
+.LASF2549:
+	.string	"applyDeadband"
+.LASF2277:
+	.string	"stdin stdin"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2190:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2348:
+	.string	"imuConfig_s"
+.LASF2354:
+	.string	"imuConfig_t"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1717:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1960:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1751:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1588:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1239:
+	.string	"TELEMETRY_CRSF "
+.LASF1342:
+	.string	"_PTRDIFF_T_ "
+.LASF2395:
+	.string	"u_fp_vector"
+.LASF1532:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1390:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1917:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2481:
+	.string	"SENSOR_GPSMAG"
+.LASF1930:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2550:
+	.string	"lrintf"
+.LASF1741:
+	.string	"__timer_t_defined 1"
+.LASF1936:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2087:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1341:
+	.string	"__PTRDIFF_T "
+.LASF1691:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF848:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2532:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1716:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1739:
+	.string	"__struct_tm_defined 1"
+.LASF1125:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1351:
+	.string	"_SIZE_T "
+.LASF2055:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2340:
+	.string	"accSum"
+.LASF2089:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1983:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"ALL_MOTORS 255"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1822:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF851:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2566:
+	.string	"useYaw"
+.LASF1622:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1830:
+	.string	"EXPAND_I(x) x"
+.LASF1453:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF2049:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2275:
+	.string	"FOPEN_MAX"
+.LASF1799:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1316:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1131:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2337:
+	.string	"accTimeSum"
+.LASF2307:
+	.string	"uint32_t"
+.LASF1683:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2378:
+	.string	"GPS_altitude"
+.LASF1355:
+	.string	"__SIZE_T "
+.LASF2338:
+	.string	"accSumCount"
+.LASF980:
+	.string	"__DECL_SIMD_sincos"
+.LASF1873:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1838:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2164:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"U_ID_0 0"
+.LASF1738:
+	.string	"__clock_t_defined 1"
+.LASF2594:
+	.string	"isMagnetometerHealthy"
+.LASF1063:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1105:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2064:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2128:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF881:
+	.string	"__DECL_SIMD_log2 "
+.LASF2256:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1389:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2394:
+	.string	"device"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2063:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1777:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF900:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1106:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1160:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1576:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1112:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF910:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1429:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1518:
+	.string	"PG_PID_CONFIG 504"
+.LASF2134:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1723:
+	.string	"_TIME_H 1"
+.LASF2080:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1108:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF751:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1313:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1729:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2574:
+	.string	"accel_ned"
+.LASF1410:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1497:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1778:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1371:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1457:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1656:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1262:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF720:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1006:
+	.string	"__DECL_SIMD_asinf"
+.LASF1191:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1383:
+	.string	"__DEFINED_wchar_t "
+.LASF2501:
+	.string	"OWNER_TIMER"
+.LASF2409:
+	.string	"accDev_s"
+.LASF2469:
+	.string	"accDev_t"
+.LASF2046:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1498:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2412:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2169:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1811:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2098:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"USE_FAKE_MAG "
+.LASF1984:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2157:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF994:
+	.string	"__DECL_SIMD_powf"
+.LASF1596:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF2282:
+	.string	"_BITS_STDIO_H 1"
+.LASF1255:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1007:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1163:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1661:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF877:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF791:
+	.string	"__DECL_SIMD_hypot "
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF939:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2207:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF937:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1094:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2219:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1332:
+	.string	"DEFIO_NO_PORTS "
+.LASF2079:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1814:
+	.string	"IOCFG_AF_PP 0"
+.LASF874:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2460:
+	.string	"__spins"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1909:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2359:
+	.string	"IO_t"
+.LASF1116:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1543:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_expm1 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2458:
+	.string	"__nusers"
+.LASF706:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF878:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF770:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1610:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1541:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1989:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2513:
+	.string	"OWNER_FLASH_CS"
+.LASF1311:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1247:
+	.string	"USE_RX_MSP "
+.LASF2058:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1823:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1319:
+	.string	"TELEMETRY_IBUS"
+.LASF1133:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1644:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF708:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1966:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2552:
+	.string	"sensors"
+.LASF762:
+	.string	"__DECL_SIMD_acosf "
+.LASF1681:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1359:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2478:
+	.string	"SENSOR_MAG"
+.LASF2033:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2146:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2251:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF748:
+	.string	"__DECL_SIMD_expf32x "
+.LASF945:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2324:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1521:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2436:
+	.string	"ICM_20601_SPI"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1618:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1089:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF757:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1689:
+	.string	"__need_NULL "
+.LASF850:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1021:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1210:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1304:
+	.string	"SERIAL_RX"
+.LASF1415:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1027:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1490:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2361:
+	.string	"PID_ROLL"
+.LASF957:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF786:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1750:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2581:
+	.string	"calculateThrottleAngleScale"
+.LASF1782:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF2405:
+	.string	"CW180_DEG_FLIP"
+.LASF2186:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1828:
+	.string	"STR_HELPER(x) #x"
+.LASF1766:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF824:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2010:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"CLOCK_TAI 11"
+.LASF1971:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2568:
+	.string	"accMagnitude"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1495:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1325:
+	.string	"VTX_SMARTAUDIO"
+.LASF1223:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2505:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1246:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2497:
+	.string	"OWNER_ADC_RSSI"
+.LASF1407:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1043:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF397:
+	.string	"true 1"
+.LASF1307:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2020:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1715:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1011:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF812:
+	.string	"__DECL_SIMD_exp10f "
+.LASF745:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2272:
+	.string	"TMP_MAX 238328"
+.LASF1638:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF2408:
+	.string	"sensorAccInitFuncPtr"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2059:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1726:
+	.string	"CLOCK_REALTIME 0"
+.LASF1385:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1847:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1110:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1340:
+	.string	"_T_PTRDIFF "
+.LASF776:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1932:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2384:
+	.string	"I2CINVALID"
+.LASF2259:
+	.string	"__off_t_defined "
+.LASF968:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1769:
+	.string	"_BITS_SETJMP_H 1"
+.LASF911:
+	.string	"__DECL_SIMD_acosh "
+.LASF1804:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1727:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1075:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF967:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2533:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1748:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1275:
+	.string	"USE_FAKE_ACC "
+.LASF1995:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1533:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF2135:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF377:
+	.string	"__linux 1"
+.LASF2250:
+	.string	"__struct_FILE_defined 1"
+.LASF1172:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2165:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2543:
+	.string	"rMat"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1730:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1205:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2047:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1175:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1097:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2017:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2244:
+	.string	"__GNUC_VA_LIST "
+.LASF868:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2560:
+	.string	"imuUpdateAttitude"
+.LASF921:
+	.string	"__DECL_SIMD_erf "
+.LASF2430:
+	.string	"MPU_3050"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1764:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1352:
+	.string	"_SYS_SIZE_T_H "
+.LASF2400:
+	.string	"CW90_DEG"
+.LASF1742:
+	.string	"__itimerspec_defined 1"
+.LASF2313:
+	.string	"t_fp_vector"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2088:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2196:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2142:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1763:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF737:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1058:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2204:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2218:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF956:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1037:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2125:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1472:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF985:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1697:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF983:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF2145:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2254:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1413:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2036:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1953:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1508:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1835:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1448:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1842:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2328:
+	.string	"ARMED"
+.LASF1510:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2178:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2276:
+	.string	"FOPEN_MAX 16"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2377:
+	.string	"numSat"
+.LASF1202:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF993:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF2069:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1225:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1217:
+	.string	"USE_CLI_BATCH "
+.LASF2112:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"double"
+.LASF1888:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1645:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1624:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2245:
+	.string	"_____fpos_t_defined 1"
+.LASF2240:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF1579:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1567:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2283:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF1744:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2508:
+	.string	"OWNER_I2C_SCL"
+.LASF998:
+	.string	"__DECL_SIMD_acosf"
+.LASF1899:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2530:
+	.string	"OWNER_COMPASS_CS"
+.LASF1277:
+	.string	"USE_FAKE_GYRO "
+.LASF2023:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1698:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF799:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF934:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1458:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1375:
+	.string	"_BSD_WCHAR_T_ "
+.LASF809:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF2333:
+	.string	"SMALL_ANGLE"
+.LASF2187:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1403:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2214:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1535:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1756:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2299:
+	.string	"__int32_t"
+.LASF1117:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1184:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2509:
+	.string	"OWNER_I2C_SDA"
+.LASF2300:
+	.string	"__uint32_t"
+.LASF2320:
+	.string	"fp_vector"
+.LASF772:
+	.string	"__DECL_SIMD_atanf "
+.LASF1431:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF949:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2090:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1630:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1475:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1435:
+	.string	"Q12 (1 << 12)"
+.LASF1655:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2397:
+	.string	"busDevice_t"
+.LASF1215:
+	.string	"USE_CLI "
+.LASF2440:
+	.string	"BMI_160_SPI"
+.LASF1062:
+	.string	"__DECL_SIMD_erff"
+.LASF1260:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1663:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2168:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1929:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF763:
+	.string	"__DECL_SIMD_acosl "
+.LASF2205:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1504:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1483:
+	.string	"PG_GPS_CONFIG 30"
+.LASF989:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1882:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2334:
+	.string	"FIXED_WING"
+.LASF1979:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1531:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2050:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1126:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF899:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF752:
+	.string	"__DECL_SIMD_powf "
+.LASF1699:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1128:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1372:
+	.string	"_T_WCHAR "
+.LASF1836:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1977:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1365:
+	.string	"_SIZET_ "
+.LASF2202:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1935:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2237:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF789:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2407:
+	.string	"sensor_align_e"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1336:
+	.string	"_STDDEF_H_ "
+.LASF1854:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF781:
+	.string	"__DECL_SIMD_asin "
+.LASF2221:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2553:
+	.string	"pthread_mutex_init"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2222:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF971:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1159:
+	.string	"__MATHCALL"
+.LASF875:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2001:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2099:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1480:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2368:
+	.string	"PID_LEVEL"
+.LASF1733:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1206:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2525:
+	.string	"OWNER_RX_BIND"
+.LASF1509:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF928:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1252:
+	.string	"VTX_CONTROL "
+.LASF901:
+	.string	"__DECL_SIMD_atanh "
+.LASF714:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2110:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2528:
+	.string	"OWNER_TRANSPONDER"
+.LASF1476:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1118:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2227:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1649:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1682:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF813:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1956:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1902:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF2072:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1427:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1101:
+	.string	"__f32(x) x ##f32"
+.LASF1343:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1079:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2443:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1068:
+	.string	"__DECL_SIMD_asinh"
+.LASF2082:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1028:
+	.string	"__DECL_SIMD_sinh"
+.LASF1709:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF1710:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF830:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2572:
+	.string	"accZoffset"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1031:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF726:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1735:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF777:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1910:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF1178:
+	.string	"FP_SUBNORMAL 3"
+.LASF1922:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1153:
+	.string	"_Mdouble_ _Float64x"
+.LASF2327:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2449:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1512:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF870:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2228:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF756:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1575:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF2106:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2314:
+	.string	"pgn_t"
+.LASF1523:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2580:
+	.string	"imuIsAccelerometerHealthy"
+.LASF1081:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1695:
+	.string	"__PDP_ENDIAN 3412"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2350:
+	.string	"dcm_ki"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1327:
+	.string	"USE_I2C"
+.LASF2462:
+	.string	"__list"
+.LASF778:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2349:
+	.string	"dcm_kp"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2016:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2419:
+	.string	"mpuConfiguration"
+.LASF1773:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2302:
+	.string	"char"
+.LASF1843:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1109:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1450:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2567:
+	.string	"deltaT"
+.LASF1080:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1292:
+	.string	"USE_UART7 "
+.LASF2155:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF2171:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1354:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2447:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1392:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1144:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1591:
+	.string	"I2CDEV_COUNT 4"
+.LASF1459:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF924:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2129:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF977:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1430:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF2374:
+	.string	"gpsLocation_s"
+.LASF2375:
+	.string	"gpsLocation_t"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1844:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF829:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF836:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2034:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2053:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2008:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2022:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1999:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2264:
+	.string	"BUFSIZ 8192"
+.LASF1412:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF940:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2487:
+	.string	"OWNER_FREE"
+.LASF811:
+	.string	"__DECL_SIMD_exp10 "
+.LASF2563:
+	.string	"rawYawError"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1643:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF825:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2392:
+	.string	"csnPin"
+.LASF2257:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2370:
+	.string	"PID_VEL"
+.LASF916:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF716:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1420:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1961:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2248:
+	.string	"____FILE_defined 1"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF964:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1615:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2547:
+	.string	"sin_approx"
+.LASF2042:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1945:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1924:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2576:
+	.string	"imuResetAccelerationSum"
+.LASF2488:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1098:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1789:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1796:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1597:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2551:
+	.string	"pthread_mutex_unlock"
+.LASF759:
+	.string	"__DECL_SIMD_powf64x "
+.LASF709:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2555:
+	.string	"degreesToRadians"
+.LASF2011:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2075:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1408:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1703:
+	.string	"SCHED_FIFO 1"
+.LASF1719:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF2235:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f"
+.LASF773:
+	.string	"__DECL_SIMD_atanl "
+.LASF1293:
+	.string	"USE_UART8 "
+.LASF2066:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1720:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1905:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2199:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1666:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1344:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF871:
+	.string	"__DECL_SIMD_log10 "
+.LASF1604:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1370:
+	.string	"_WCHAR_T "
+.LASF1913:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF927:
+	.string	"__DECL_SIMD_erff128 "
+.LASF810:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1749:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1595:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2540:
+	.string	"fc_acc"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF701:
+	.string	"__DECL_SIMD_cos "
+.LASF1864:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2209:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2438:
+	.string	"ICM_20608_SPI"
+.LASF765:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2236:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF2427:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1029:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1491:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1892:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF753:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2097:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1809:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1812:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1771:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1981:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1380:
+	.string	"__INT_WCHAR_T_H "
+.LASF1264:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1463:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2511:
+	.string	"OWNER_SDCARD_CS"
+.LASF1147:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2122:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2132:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2107:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1587:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2114:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2475:
+	.string	"SENSOR_GYRO"
+.LASF1154:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1362:
+	.string	"__DEFINED_size_t "
+.LASF1220:
+	.string	"SERIAL_RX "
+.LASF1647:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1669:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1853:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1305:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1762:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1586:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1286:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1858:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1670:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2191:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF2077:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2137:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1774:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1800:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2434:
+	.string	"MPU_65xx_SPI"
+.LASF1678:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2571:
+	.string	"imuCalculateAcceleration"
+.LASF1212:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1915:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1401:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF2262:
+	.string	"_IOLBF 1"
+.LASF1524:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF389:
+	.string	"SITL 1"
+.LASF2446:
+	.string	"sensor"
+.LASF1578:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1294:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1765:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF793:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF704:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1226:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1585:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2381:
+	.string	"hdop"
+.LASF2344:
+	.string	"attitudeEulerAngles_t"
+.LASF1846:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2527:
+	.string	"OWNER_LED_STRIP"
+.LASF2105:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1287:
+	.string	"USE_UART2 "
+.LASF1251:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1254:
+	.string	"VTX_TRAMP "
+.LASF2365:
+	.string	"PID_POS"
+.LASF2448:
+	.string	"mpuDetectionResult_t"
+.LASF2369:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1584:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2371:
+	.string	"PID_ITEM_COUNT"
+.LASF1060:
+	.string	"__DECL_SIMD_erf"
+.LASF861:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2045:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1791:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1324:
+	.string	"VTX_CONTROL"
+.LASF723:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1743:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2213:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1613:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1115:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2474:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2121:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2583:
+	.string	"accz_lpf_cutoff"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2297:
+	.string	"short int"
+.LASF1494:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1641:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF803:
+	.string	"__DECL_SIMD_exp2l "
+.LASF740:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1288:
+	.string	"USE_UART3 "
+.LASF1714:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1127:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1668:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2093:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1505:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1671:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1561:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1373:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2442:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF1951:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1284:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1038:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF761:
+	.string	"__DECL_SIMD_acos "
+.LASF1445:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF992:
+	.string	"__DECL_SIMD_pow"
+.LASF2364:
+	.string	"PID_ALT"
+.LASF2535:
+	.string	"magADC"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1609:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2514:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2319:
+	.string	"pgResetFunc"
+.LASF1514:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1426:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2515:
+	.string	"OWNER_MPU_CS"
+.LASF1786:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1631:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2292:
+	.string	"unsigned int"
+.LASF2470:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1289:
+	.string	"USE_UART4 "
+.LASF2074:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF795:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2224:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF960:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2217:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1848:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2117:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1633:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1675:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f "
+.LASF721:
+	.string	"__DECL_SIMD_sincos "
+.LASF1573:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF933:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1937:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1860:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF988:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1522:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2092:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2493:
+	.string	"OWNER_ADC"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2417:
+	.string	"accAlign"
+.LASF712:
+	.string	"__DECL_SIMD_sinf "
+.LASF2326:
+	.string	"pgRegistry_t"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF747:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2177:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2289:
+	.string	"SPIN_RATE_LIMIT 20"
+.LASF2252:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF2194:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1290:
+	.string	"USE_UART5 "
+.LASF2140:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1155:
+	.string	"__MATHDECL_1_IMPL"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1320:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1891:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2496:
+	.string	"OWNER_ADC_EXT"
+.LASF953:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2038:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2195:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1513:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1053:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2401:
+	.string	"CW180_DEG"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2054:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1793:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF1088:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2516:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2181:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1443:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1188:
+	.string	"math_errhandling 0"
+.LASF2061:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1972:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2270:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1857:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF2048:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF947:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2281:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2197:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2637:
+	.string	"thread-shared-types.h"
+.LASF2679:
+	.string	"pwm_output.h"
+.LASF2664:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2617:
+	.string	"/usr/include"
+.LASF2670:
+	.string	"mathcalls-helper-functions.h"
+.LASF2718:
+	.string	"voltage_ids.h"
+.LASF2727:
+	.string	"stdio_lim.h"
+.LASF2666:
+	.string	"floatn-common.h"
+.LASF2649:
+	.string	"stdint.h"
+.LASF2704:
+	.string	"pthread_stack_min.h"
+.LASF2600:
+	.string	"src/main/build"
+.LASF2614:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2705:
+	.string	"barometer.h"
+.LASF2648:
+	.string	"stdbool.h"
+.LASF2706:
+	.string	"io.h"
+.LASF2626:
+	.string	"time.h"
+.LASF2653:
+	.string	"wordsize.h"
+.LASF2689:
+	.string	"cpu-set.h"
+.LASF2633:
+	.string	"bus.h"
+.LASF2610:
+	.string	"src/main/target/SITL"
+.LASF2639:
+	.string	"pthreadtypes.h"
+.LASF2720:
+	.string	"stdarg.h"
+.LASF2701:
+	.string	"__sigset_t.h"
+.LASF2613:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2650:
+	.string	"libc-header-start.h"
+.LASF2693:
+	.string	"timer_t.h"
+.LASF2702:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2671:
+	.string	"platform.h"
+.LASF2618:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2722:
+	.string	"__mbstate_t.h"
+.LASF2604:
+	.string	"src/main/drivers/barometer"
+.LASF2714:
+	.string	"filter.h"
+.LASF2642:
+	.string	"resource.h"
+.LASF2698:
+	.string	"atomic_wide_counter.h"
+.LASF2644:
+	.string	"imu.c"
+.LASF2607:
+	.string	"src/main/flight"
+.LASF2628:
+	.string	"imu.h"
+.LASF2676:
+	.string	"debug.h"
+.LASF2647:
+	.string	"stdc-predef.h"
+.LASF2635:
+	.string	"accgyro.h"
+.LASF2662:
+	.string	"math.h"
+.LASF2686:
+	.string	"endian.h"
+.LASF2682:
+	.string	"exti.h"
+.LASF2651:
+	.string	"features.h"
+.LASF2612:
+	.string	"src/main"
+.LASF2725:
+	.string	"FILE.h"
+.LASF2608:
+	.string	"src/main/io"
+.LASF2663:
+	.string	"math-vector.h"
+.LASF2700:
+	.string	"setjmp.h"
+.LASF2711:
+	.string	"sonar.h"
+.LASF2694:
+	.string	"struct_itimerspec.h"
+.LASF0:
+	.string	"./src/main/flight/imu.c"
+.LASF2643:
+	.string	"compass.h"
+.LASF2603:
+	.string	"src/main/drivers/accgyro"
+.LASF2699:
+	.string	"struct_rwlock.h"
+.LASF2627:
+	.string	"runtime_config.h"
+.LASF2668:
+	.string	"fp-logb.h"
+.LASF2710:
+	.string	"gyro.h"
+.LASF2660:
+	.string	"time64.h"
+.LASF2622:
+	.string	"target.h"
+.LASF2707:
+	.string	"io_def.h"
+.LASF2672:
+	.string	"common_fc_pre.h"
+.LASF2623:
+	.string	"maths.h"
+.LASF2677:
+	.string	"parameter_group_ids.h"
+.LASF2661:
+	.string	"wchar.h"
+.LASF2654:
+	.string	"timesize.h"
+.LASF2601:
+	.string	"src/main/common"
+.LASF2717:
+	.string	"voltage.h"
+.LASF2715:
+	.string	"current.h"
+.LASF2616:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2681:
+	.string	"rcc_types.h"
+.LASF2631:
+	.string	"gps.h"
+.LASF2684:
+	.string	"time_t.h"
+.LASF2641:
+	.string	"acceleration.h"
+.LASF2673:
+	.string	"stddef.h"
+.LASF2669:
+	.string	"fp-fast.h"
+.LASF2691:
+	.string	"struct_tm.h"
+.LASF2665:
+	.string	"floatn.h"
+.LASF2632:
+	.string	"bus_i2c.h"
+.LASF2680:
+	.string	"timer.h"
+.LASF2658:
+	.string	"stubs-64.h"
+.LASF2657:
+	.string	"stubs.h"
+.LASF2624:
+	.string	"parameter_group.h"
+.LASF2630:
+	.string	"pid.h"
+.LASF2723:
+	.string	"__fpos64_t.h"
+.LASF2652:
+	.string	"features-time64.h"
+.LASF2709:
+	.string	"io_def_generated.h"
+.LASF2716:
+	.string	"current_ids.h"
+.LASF2708:
+	.string	"utils.h"
+.LASF2688:
+	.string	"struct_sched_param.h"
+.LASF2678:
+	.string	"mixer.h"
+.LASF2640:
+	.string	"sensors.h"
+.LASF2692:
+	.string	"clockid_t.h"
+.LASF2636:
+	.string	"accgyro_mpu.h"
+.LASF2687:
+	.string	"endianness.h"
+.LASF2621:
+	.string	"stdint-uintn.h"
+.LASF2703:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2719:
+	.string	"stdio.h"
+.LASF2690:
+	.string	"clock_t.h"
+.LASF2726:
+	.string	"struct_FILE.h"
+.LASF2724:
+	.string	"__FILE.h"
+.LASF2656:
+	.string	"long-double.h"
+.LASF2713:
+	.string	"battery.h"
+.LASF2655:
+	.string	"cdefs.h"
+.LASF2667:
+	.string	"flt-eval-method.h"
+.LASF2645:
+	.string	"mathcalls.h"
+.LASF2659:
+	.string	"typesizes.h"
+.LASF2606:
+	.string	"src/main/fc"
+.LASF2634:
+	.string	"sensor.h"
+.LASF2712:
+	.string	"sonar_hcsr04.h"
+.LASF2674:
+	.string	"common_fc_post.h"
+.LASF2695:
+	.string	"locale_t.h"
+.LASF2611:
+	.string	"src/main/target"
+.LASF2721:
+	.string	"__fpos_t.h"
+.LASF2646:
+	.string	"pthread.h"
+.LASF2625:
+	.string	"axis.h"
+.LASF2605:
+	.string	"src/main/drivers"
+.LASF2696:
+	.string	"__locale_t.h"
+.LASF2685:
+	.string	"struct_timespec.h"
+.LASF2675:
+	.string	"build_config.h"
+.LASF2609:
+	.string	"src/main/sensors"
+.LASF2620:
+	.string	"stdint-intn.h"
+.LASF2602:
+	.string	"src/main/config"
+.LASF2619:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2638:
+	.string	"struct_mutex.h"
+.LASF2697:
+	.string	"pthreadtypes-arch.h"
+.LASF2629:
+	.string	"io_types.h"
+.LASF2683:
+	.string	"sched.h"
+.LASF2615:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\354\001\r\f"
+	.string	"T\017\340\002"
+	.string	"("
+	.string	"\331\342\235\342\005\032\002"
+	.string	"\001\001\240\342\234\212\n\002\003\004\315\343\301\244\013\005\006\344\332\221\323\t\036\007\377\376\327\224\016L\002\003\002\004\002\005\002\005\006\002\007\002\006\002\006\002\003\002\003\b"
+	.string	"\002"
+	.string	"\006\002\007\t\002\003\002\t\n\003\005\002\005\t\013\352\263\360\321\b\f\r\016\017\020\021\312\344\347\350\r\f\013\006\002\006\022\025\350\244\345[\036\f\002\f\006\026\247\320\217\212\001\027\030\031\233\326\340\375\t"
+	.string	"\032\214\353\300\262\002"
+	.string	"\033\034\271\227\355\346\006\024\002\b\002\r\002"
+	.string	"\002\007\006\002\r"
+	.string	"\002"
+	.string	"\035\036\037\263\310\213\200\t\b\b\002\004 !\203\366\244\240\016\n\003\"\225\307\226\262\006\b\002\016\002\004\003\002\004#\313\304\355\226\017$\313\332\267\345\r%\221\326\260\227\004\006\f\002\f&\353\254\217\274\r\b"
+	.string	"\002"
+	.string	"'\332\322\232\366\016(\276\363\265\272\007)*+\240\342\234\212\n"
+	.string	"I\250\201\271\300\220L\006m\351\001\200\202bSD\017\0210]btai\251i?\003\021\304\302:\250\037\361.\340u\372\023\021\372\361\020Q/\026\031\242@\317\342j(p\266,\260(C\b\340\022\211a\2310\336\021t\350YE\n\0059\331w\016\212\377\345i\224bBh\335\372\371\021U(/{fx\271\327B\346a"
+	.ascii	"J\320\346Jw\277\327\334\335\313:\227\243\303o\024F\243\221\315"
+	.ascii	"\321*\341\213D\024y\310dw\331z\224J\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375 \311m\003"
+	.string	"T\003\275"
+	.string	"\017"
+	.string	""
+	.string	"\001\006\001\001\007\001\021\001"
+	.string	"\025\031\032\001\001"
+	.string	"\001\001"
+	.string	"\001\034"
+	.string	"\001\037"
+	.string	"!"
+	.string	"\001\"\001"
+	.string	"#"
+	.string	"\003$\003\002"
+	.string	"%\003"
+	.string	"\001&\004"
+	.string	"\001"
+	.string	"\001"
+	.string	"\030"
+	.string	":\005"
+	.string	"\f\300\206\b\026"
+	.ascii	"\033\270\303\255\032s\021/)\022,\241\273\033\254\232\261\022"
+	.ascii	"\203\345\224(c9-\021\224\304\234\004p\003,\370,@e\260\314P6\200"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.inline.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`2\003E\016"
+	.string	"\006R@: \005)\035\021;\204\206y\355\364$\030"
+	.string	"K\223\003\3166\364)\013.\350T=\n\244\r\b\240\350\377\b\021\013\t\bDA\323\205\224/\r\361\304\333\267\275\367\017\3036\"\323N\001)"
+	.string	"1"
+	.string	"2"
+	.string	"0]\376\013\264\257\244\375\177\350\032\221\320fI\206\315\215\377\251\202\\{\376\177P\013\263\315\177\t\267\t\363\316\377\206\226Tn\025n!\314,#4(\250\226`\007\314\372DY\326W\326\347\266#\256\036\2271+*&P#\r\013\233\027.\221\325b\275\211\002b\354\272\232+WS\004\337\377h\020\221\227\032\203\"\270<\203*\275\362\344?AQ!\007-\306\377\214\326\225\263\377\237\236:d5\016\b\213\374 \271\2619\264\240m]\306\371\257\n}\216\272\212\235\227\037\267\260\215e\230H\035[\200\317=2-0&\023"
+	.string	"\217\224\331\251\252\n\333\313/\344i<9\361\345\233\254\026\213M\265\034juU\bA\007V\250!=\b\311\f\r\203\222B\2065P\2422E\351\001\022"
+	.string	"\0249\305\341\2641\310!\252\3142K[\317\203(a\3029\336\232x\246%S\347\r\334\320\r\237$\315}\025T\227@\265\303\020'\236ce!WI\361\361\005\300A\302x\210\031d"
+	.ascii	"\315`\2373LO7\361\246~\335\026`\340L\364\223n0\350\223,\3138"
+	.ascii	"|\304|\356\340\257v\327\331\001\224#\205\233 \034\327\273\351"
+	.ascii	"\r\347Q\375\372\242L\327\234\316\210\006\b$#G\252\206\207>\b"
+	.ascii	"\362\221\034\035\314\276\263$6\325s[\303\221,}\007\322B\363\031"
+	.ascii	"\353\3169\3065Ip\t\260\352\207}\036Y\305\276\260\022l~\377O\267"
+	.ascii	"\201\016\211\302\370\016\335\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\270\001\345\b"
+	.string	"BM,1`k\222\0160\f\303I\020(\336"
+	.string	""
+	.string	""
+	.string	"A\035\350EX\035,\261\240\220v\202Z\345(-\f\205}\226\305x\005\263\005\276\365u\272\315\266\244\311$\003\264T\233\252\242&\215\213\315\004\325\321`p.\034\033\031\023\325\321P\225D\205\274\3753\206\250V\304\377,T@\201L`{\346\212@ZnK\307\245\343t\212+#y0\251\260Z\224\240O)-X\344C\356\264\312\207\257\nB\\ \217\033\226<%%Vr"
+	.string	"\202\246\351\314\265\214Zk\255\224\2115\346\036s\235\035-\310\275\315\221s\270\337h\315.\316\256I\026"
+	.string	"\320Z\317\037\311\210\006d?\002, p\202\231\261\341\003\"\tJq\026\b\247\261RB\376"
+	.string	"(\336YgQ3\303~:/\321\0274\221\006 s\2771\036vc0tAJZ\327^\347\250@\331"
+	.string	"XrpP0\304\250"
+	.ascii	"\024R\373\033\232\261\305\200R\020\203\3004\336qc\n\215\025\306"
+	.ascii	"\260\215\206\355DB+.(&.\\\340\227}\177\250\264H\003/\002"
+	.text
+	.section	.gnu.lto_.pureconst.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\006\232\004\007\230\004\021\230\004\025\230\004\031"
+	.ascii	"\230\005\032\230\004\034\230\004\037\230\004!\230\004\"\230\004"
+	.ascii	"#\204\004$\230\004%\230\004&\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\245\005"
+	.string	"2\207\024\035\260'\303\001\f\223\206a\260&I\222\305\332\266M\2104B\366\001\2215\242\255Y\"S\njBm\025B\001\213\017\033\322\2632\3649F\266\2166\332\\\330\213b\242#\314\226\231\243-Z\346i\233\026\320\201.\327rtW\331T\264\300d\353\307\226\340\212* `\0022f\346\001di\214\351\214\005\333Y\247"
+	.ascii	"\0339b\002\034\210\256#X\247!\311\001\277\373h\326\222X\020v"
+	.ascii	":0@'\330\036\323\304\026\002<\311\333\264\"cFA;\352\360\205I"
+	.ascii	"}\323\276\253A\026b\373\307\214A\221\257\030\305^@\024\320\200"
+	.ascii	"\313-B\364x\321\313\355\370\302Z\031\002"
+	.text
+	.section	.gnu.lto_.lto.a28507c76e004810,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_attitude.76.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.80.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\345\261\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\b\026?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.82.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375 O%\002"
+	.string	"T\003B"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\005\001?\202\210\200\020\177}\273\001{\273\001\031\005\001\006'\001"
+	.string	"\304\023(yw\300\001u\277\001s\276\001q\275\001o\274\001"
+	.string	"\005"
+	.string	"H\005\006\327R\006\270y\331"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.83.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`+\bM\037"
+	.string	"F6\266H\240\326Q:\302\242'/G'\334\362\214\2056\266*\215}l\362r^\250\301Rc\206\227\300;N\343\027\373\334\302=\2121\024\312h\274\007\237\300\277\260\026\277\341o\350\313\002K\377%A\233\\\320>\324\243\377\033!R\246\024\247"
+	.string	"\202"
+	.string	"\242"
+	.string	"\\\346$1\026f2!\203\314x\325\037\374\255\376\253?\353\327\372\205\377\326?|\315\376u|\307y\034\353=\356\343?\016\344D\333rYC\257\b\\[_\020\224\b\301\036D\321\232\342@,\213J\003\332\311\\\361*lA\b\253*\nN\004M\304E\331\314\021PV\250\020\320N\352\246\004\034\307s8\275\312D\332S\211\333\357I\227+s\316"
+	.ascii	"'\r\200v\022\367\035\331\311\3619\262\223v\262\253<\030c\316"
+	.ascii	"Zt\201\300\3522\347\354-\214;]\235\374\023_\003J=]g\t\346\234"
+	.ascii	"V\240\224\211{o{g\033\311\246\255\b\366\271\036\304D_\206=x\250"
+	.string	"\007\236\364=\224\235\374\362\200\251\360\351\230\265\207\016'S\301\330\301'\335\027\366\307\271.\354\253yW\023\275\352\336=x\353nu\347~u\343\236u\017]\353\026\272\360\016\372\326\r\364\341\375s\265\317\325=W\363\\}\273z\347j\235\253s\256\306\271\372\346j\233\253k\256\246\271z\346j\231\253mW\307\\]\273\232v\365\354j\331\325\344\325\343\325{\265^\375^\214\215&A\001`_7\021Y\314\332t;\2641S^jD\207\362\304\tmk\253E\334\346\226\266[\374QAq\231\255\227\21141l\013\370\022%\231\2579\247\001%\357Z\362e\234t\331\324$;\251X@1\331\352l\377\243\"\336c\324\234\276\035\271\262}\320\002-\271c\330oJ\313n_\245\273\303\242\333\007\277:\257\334\336\352\233\353\302\355\257vqI\206\366Y\272CH\204\366Z\343~\205\216l\030\367f$h/\334\335\r*\302a\205"
+	.ascii	"\355\267tu\201\206tP\256\237\375\3608\237\202\361\367\373\263"
+	.ascii	"\357\372\325\200\322\261EeQ9\032\225FG\345X4`@9\032\035\225E"
+	.ascii	"\345\350##\002G\004$\0248\300\2539*\215\312\321H\274\rJI=\r\026"
+	.ascii	"*$]\240\320\303\220$A\251\207\304\324\324\343\365x)\303\004\246"
+	.ascii	"\236\206\245%\246\236-8?\316ua\0067\230\370\026\312<\240\210"
+	.ascii	"\020:\313\023\322 \322\237~\210:\3618X\300\231%Z\353O\314'd\341"
+	.ascii	"\263>}\322\331\343\303\263=@\373\263<+na\300|\331\331\333jq\267"
+	.ascii	"B\273\263[\024\246\310Y\235\241\325m\016\225\020\005\316\026"
+	.ascii	"-Yn\026Ghw{C%\224\262\301r\305J\215\r\315\326\374,\315\216ac"
+	.ascii	"2;\223[\334\312L\025m\033\345R\002\200\254\250a`\346\224\032"
+	.ascii	"\031\221\244\240\250 \031\0160\003\021\321F\035\022`\322\221"
+	.ascii	"\020\211\024T\326(\267\240\260\264X\317\202\206\336:\007\365"
+	.ascii	"i\257\372a\327N$\260\"\344\253\240=M\307\275\217\252\241b\243"
+	.ascii	"^/F\nld\305\2407; \307\316\302#\211H\302\220\023w\252$\031\376"
+	.ascii	"\255\301\314z6z8,\2618\255,\034\021\320-\213Q\342p\220\356T\316"
+	.ascii	"q8\261\021\347\224\253\230\317C~b\316\252'\r\265\036\2241\303"
+	.ascii	"\326\325\220\3435\n\251$\232\005\025\375[\232$5(\333\b+\347\020"
+	.ascii	"\344\232[\230Gy\211\373\257\223?\030I`A\215\320\311mf\016\030"
+	.ascii	" `\236\264Y8\254k\276/\234Ik\213\022+\376\241\334H\366\266ps"
+	.ascii	"\27569\035\023\271\342\321]r\335.\203MO\b\3101\334.\026\376\324"
+	.ascii	"e\206\241\247\\a2\315,\0254\253c\024\356\231\302y\3260\307+\346"
+	.ascii	"\361\020\251@>\256\230\037\220If\260\003\216\374\203']\224\030"
+	.ascii	"\025"
+	.text
+	.section	.gnu.lto_imuConfigure.86.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\324\003e\030"
+	.string	"\306\353\230F\300\026U:\024\030\3742\276\035k\303\020\016\2023N[$z\207[4\023\207\225\200\250\2434~\210VV\233\355\375\r\343-\315\367\3379gV\210\231I\365\214v\033\b%\315\352\206_\373J\f\361h\330F6\3312\245}"
+	.string	"y"
+	.string	"\210"
+	.string	"Gc\3667\237\354\360\207\274\210\316y>\021R\215\241\361?\341\346X\365~"
+	.string	"wy6\237\006`\254T\377\243\363\235\t\013\245\030D>\300O\177\210\216=~~\264k\306\254T\355\003y\220\333w&<wi"
+	.string	"i\262\313S\340\004\245O"
+	.ascii	"\037 ~\352\003\210\237\276\331_\316\313\261\357\375\350\351\205"
+	.ascii	"\331\335\224\304\361\333\365\346_\310M9\335\211+)\302\356Zs:"
+	.ascii	"\026\267\274\355\003\266=\330\241\204\237\262(g\344\273\223+"
+	.ascii	"\275\337\032\302\321\021\027\024\273\270\003R\206\362<>v\244"
+	.ascii	"\224b\020\017\360R\345{\312\330\262#\001Q\332E\241\362\215\374"
+	.ascii	"\b\216\357\363i\232\b}N\204\370y\251@\307\016\247G\326$`\204"
+	.ascii	"V\2036oG\345\r\373\341J\033\366w\277\200\251\236\231j\224\252"
+	.ascii	"GQ}\022\325\246\251.M5I\325b\250\236S\035N\265T\265\206\352\323"
+	.ascii	"\214.\264\330P\331U\021a\336\345^\354\363}L\301L\314\204\350"
+	.ascii	"DG\245\320\375p\032\244\261\273\242\355[\270H\336cm\f\360XM="
+	.ascii	"\221/\364-\025>d\337W\320\314\2701\003\270\273\027J\2375a\rN"
+	.ascii	"\203V \335"
+	.string	"I\332\027\376\313\"%g\204\341A\034\260\234d\312\013\031\223\2643\334\212\206*aQ\316h\303\251p\230b\222\r\202%iwx\024($Y\022%iJ\221\365&\276)&\224v\353K\354\243\351\262\273*\037\350J\\\257XL\f0\030\315F\302\305\202\205\230\261J\270\\-\224\031,P1P\265\034<\270A\275f\261\234\026+\207&\263\271^\265\032\315\305z\315l6Z\355\203\255\200]7$pd)\333\207\230l\006K\345\310Z8)WmD\352\206\200i!^\265\224\215F\253\245F\036\356\341J\033\236\360\342\207\223;F\311\242\t\262\367\363\013\371e\244h\361\233\221\366=8\004D\200\222\347\2612\312\031)\366\212\374\224$H\350D~\025\271*[\366?w\004\001r\224RJO\031\240\0268\036Kx\001N\25018\346\0303\212\r\005Q\324\202\2501\260\002\031!\263m\021`=s\210J\013\265\377\033"
+	.ascii	"\021K\326K\"\215 \324\205Mpk!\203\322\017O\261\352,\221\300\336"
+	.ascii	"\200\3138^\027\270g\203\267KH\332\342x\355\204QD\033\365\326"
+	.ascii	"\004\247{\334\214\rx;\363\326\343\3738\365\217\200bCg\273\351"
+	.ascii	"\024\270\266\250\004\271\237\003\r\371L\367c\272\212\323Z\247"
+	.ascii	"y\314\003\374\215\244fCP\023\213\226\316\255\221W9N1\031@\245"
+	.ascii	"\200j\306\255\323Xt\201\2746&\002\363\036\024M\205\240\214\""
+	.ascii	"\310[\213\024\230\251\305\262\376"
+	.text
+	.section	.gnu.lto_imuInit.87.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\301\001\365\020"
+	.string	"\266\340pF\340\324$\035\230\232q\2548\342hi*"
+	.string	"\222\r\303L;Y#z \357\233\235K"
+	.string	"\370Xap\226^\2555B\"v)\243c\330}\302,\034U\270<\025d\204\371\031\356x1o!\003||\2555\262\267\224)\005Y"
+	.string	"S"
+	.string	"d"
+	.string	"i\315t>\375\001+\3534\244\201\220\335\232\031\222M\202H2l\337\376\016g\227\230\263\231\036\303\331\007\r\321\0049\355\356\246/\316\375ir\376u\256\212\260\356/\305\342\372\026\310\216\212\004\200\275^\201\232\030\361:O\0250W&*\302\356:#l\305\ro[\305\366\211\235\024\002\2526KK>>"
+	.ascii	"\231j\257H\344\243\252\311K;_S\223\bM\022\333\345>\254\324\356"
+	.ascii	">\360y\336\203\302\31794\214L>\036\3722\332\341\365A0zZ93\201"
+	.ascii	"\035IOM\233G\354X\227zc\377\255\332\330\231Vi:\245iT\246\265"
+	.ascii	"\227\206\232~\032\332\271\204\306\201\264+X\310G\233\270\264"
+	.ascii	"s\n\315H\r]H\035\261\t\245.\372\002-\355\032\302l\306\364\332"
+	.ascii	"m%H\351gx\270rfMQ\n\203\314\310\240jz\f\317\221\341D\311\032"
+	.ascii	"\216c\203\002%\033\277\301\241\303\312\212v\b\365\004HO\n\265"
+	.ascii	"\360\361\324\3779\220\213\374\034{0\221\211\264\303\374\021\233"
+	.ascii	"\004dfA\221qYm1#D\254J\204\330L\254>\270l,/0\033\212\001\263"
+	.ascii	"N\264\274l1,\326\313V\022\333\277U\033\277\036\373$k\251\353"
+	.ascii	"q5T;;\326\3758FdF\2527fp\225\202\370Yz\245\021#H\237\343\321"
+	.ascii	"\276s\244\224\324n\353\3217\372\021\347#!%\037S\264C[eB>\252"
+	.ascii	"\324\201\213\024\001# P\2021s\265\036\363BC)\206\316\300\273"
+	.ascii	",\007\232\205\333\260\267d\025\016O\210\321M\004C\343\2056\201"
+	.ascii	"8\006\353\2349\316\320\021\333\303\256\267\341AM\262\216F\020"
+	.ascii	"\b\204\221\201\315\3632\302q\273@\347\231f\223\365\f\215\035"
+	.ascii	"\266\235X\0048D\231t\201vh`\006\n"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.88.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"u\t"
+	.string	"&\320<90q\323\001\200\b\356\024?\245\377\254\351'}\3671\250\266T"
+	.string	"\300o-Q$=&\177\323\355!\330W\325\366e\3249<\f\020\005.\2141\002\352\"\201\320\212\317f{\247\024)"
+	.string	"-"
+	.string	"."
+	.string	"\317\374\3314\027Q\373q\206c\314\331\335:A\376]~\376E\036"
+	.string	"\232H\227\036\206\335\265\004M\036\367\274m\003\333\007\366\035\002\247\326\030\311\203\247\376\b;\035p\341\224\344\3132\345\"\263R\307\026Ir~\330\007\330y\262=\231M\214\306\332\355x\355l\213\266\204\330\016\027\236\207\252\271\312W\274\362C\213\254\262\n;%`\035\345)\243\274W\030\214\302OL^\020n;\341%\030\002\256\335]\360GN\222\341\207\001\376h\"\320VC\023\022\033ED\255\330\036@\365\323yU+0g\001\321\325\020\307u5\023\367\363\324p\323*\315\r\373\034\346\247\316\302\371\241\003\027"
+	.string	"3\001G\320\2149\364vSyNY\006Y\300\030\371%\223\013\310m\303&`\334\255\244\202\310"
+	.string	"t \026\2528"
+	.ascii	"\273\252\325\205\256\341d!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_imuTransformVectorBodyToEarth.89.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`u\005\255\032"
+	.string	"v.\237G\260\230M:\304\363A\246HN@oOBU\262~=\332\240\363\264!(\271\336>\311\201\306S\251\275\216\365\310\230,\267\031a\370)\375)\274=\275\217\206\tx\216s\321\332\265\255\245\0048\335\355iO\267F\273%)S\217"
+	.string	"s"
+	.string	"\220"
+	.string	"s\256\b\226\231P\244\025\016\215R\225R\005\352m\325\037:\245@,\323\375"
+	.string	"\236y@%EBg\3026U\234\b\346hpE@\177\352\203\247Q$`I,t|6Rp\231s\026Pi\0060\225:\227n\007\001][yh\017\236B\225\320\333\234Mc\212\314\371;\340\037\230J\3774'T\t\323\233P\245y\266\026\3759\315W\215-\024Sb\346\234\342m(O\227gU \032\3631%\351\276 \3149\275>\246\026\352\253m\001\266\207\354\020\026Ys\316\005AT\b\007\353\r\225\366"
+	.string	"b\325\247\322\n\"T\251\317=Y)m\320;\304\214\224\271[\366/i_\303V\327|\223\255Q\352\234J\251}\024\250\306)\224*\200\257{\276\346\371z\347k\235\257s\276\306\371\372\346k\233\257o_\333\276\256}M\373\272\346\353\331\327\262\257i\276\216}\r\373\372\365u\370\265\374\332\365\365\277\336\2575"
+	.ascii	"MF\024\261JZ=\035KU<\006Q\301\252\371l\212\224\035.\212,\210"
+	.ascii	"\273\002U\247\264[\246\371\353\270/\221\036\215\330a\247y\017"
+	.ascii	"\026\221>\361\250WNt\214]\257T\2116\361\250TLv\n\\\262\352\253"
+	.ascii	"+\325\223U\370\377uI\244Gci\203\226w=|\250eA\223x\034B\342@~"
+	.ascii	"\350\200\036\361\030dd'Z\271\036t\375\357\232\352\351X*\322\""
+	.ascii	"\036\177\234l\f:\032\301\346\234BU\021\216\006d\335(\021\252"
+	.ascii	"\334\377<AQy\3149\3316\240Cv\270!T\204\216P'@ \224@h\202\002"
+	.ascii	"\006@\265\017j\n@\036\214\212\304\016\027,\024e\250 j(\232`$"
+	.ascii	"R@\342 \002\361\370h\003\021\222\330\341\350\bI\224\375\246\272"
+	.ascii	"\346\233,a\006\024\245/9w\233hg0F\317\315\224Q,\237\317{\256"
+	.ascii	"Z=/U/\310x\234e\215\271\023\355\t\206\213\3345\212\347:\317\355"
+	.ascii	"<v\2360`\264vr~s\035\234\313\347|\361\030\344\245\013\316o\266"
+	.ascii	"h\311bS\305\344s\225\272\275v\037\333c\277a\271\262S\240\025"
+	.ascii	"\033\355\263\327j.O{\030n\250qX\246\030$22\nR\224BZ\003\340\002"
+	.ascii	"\221\021\"\333\021\320 c\016\"\223:[k\240\240\201k\f\241]$hs"
+	.ascii	"\004\326\234\223\352\322/cbR\265\016B\231&\262\367]\304[\216"
+	.ascii	"\b\315\031\226D\216\301\324\325`c\243\246\032\270G2p\\\372\242"
+	.ascii	"\346kV\371\316\027Z05\204\366\f\34308\n\305\241\017\2225s\013"
+	.ascii	"\320\201*\213zm\307U\211:\r\037S#\214\235\277\253\025f!\210u"
+	.ascii	"H\262$\314\032>r\363a}V\007$\025\025\226(\033\004j@D+:{\316\331"
+	.ascii	"\251\002\213\340^\201\030\020G\005\264\327aX\322\347\335\242"
+	.ascii	"\335\217\367\306%\013\225D\366@\216\3162+\213\231\3613\327Y\240"
+	.ascii	"&@\350\025v\312\375\321\025@\005\3063*,\251E\001\377"
+	.text
+	.section	.gnu.lto_imuCalculateAcceleration.90.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\035\01353"
+	.string	"\nZ\024\023BP\344J\007\203,}\364\316\200\220\255^i\232\271\022\306YT\244C\017\036L\215V\024x`\177T\333"
+	.string	"\356\205c`\030\020\255\241P\264g\331cM\032d\360\257\235\241\247*\241h\300\306\336r\223\224R\n\r\001\013\001*\001\334d\235\231\254\363\222uV\262\316\004\254s\222u\036\220:#\3658\013\260\316G\326\331\310:\027\245\316D\251s"
+	.ascii	"\353\f u\036\262\316B\3269\310:\003\245\316?\251\2631u\366Q\235"
+	.ascii	"{Tg\325:\247\251\263\265\316h\352\\\264\316\237:\273un\fBM\320"
+	.ascii	"x9\357\265\221x\347\022\242\200GZ\257\233\257Q/z\221\271{\257"
+	.ascii	"\373\330x\214C2\363\2718\262\r]\032msx\367\336\bt\310\316k+k"
+	.ascii	"\353\275P\323n\210\331\335\031\336{\203\252Q\376R\033e\302\237"
+	.ascii	"\2469\310v\346\236\322T\326n\302\340\236{\201\234\351ro\236\025"
+	.ascii	"K\251\215\036\333\3106Zl\"\333(\257\314n:\357\356\246vpm}s\356"
+	.ascii	"\275\311\267\353\265S\213\026\337W\356\236\245[Z\247v\351\366"
+	.ascii	"\326\350\216.\006\271\305(\036\357\275F76\377\342\324\\\031\035"
+	.ascii	"An\312\242\021\032:6\335\327N\303m\315=mp\357e_\272\341hV\233"
+	.ascii	"\231Y0\263\030\263\261B\314\023*x/\371\310\366i\354\177d\322"
+	.ascii	"g\266\320c\354\247-\330b\302\200\361fA\333\250\r\203>3Y\177)"
+	.ascii	">j\325^\2728\213\376'\370\317\234\241\271\260\263h\213YC\357"
+	.ascii	"m\020\352\345\241\377\277\233\251\352-eP]\314\034Z\213\231\322"
+	.ascii	"\335\275w\013Kg9\343&\322("
+	.string	"\243\201\360^6\312\r\3026\352\017\305\004\004\364\002\366\315\327G5g+\345\336\370\270\f\226\2308\206\355^5\247~\260w.\312$k\236\310_\337\357\210JC5O\344\240)AM\374\217I\232\353v\230\363\322\272x\357\275\376u\314]\274\367^\376 \314\2523Y\352L!u\036K\235\305\232\257\031\254\233\335_\2513\203\324y\201\321\331\313\350\334\225:s\245\316[\251\263\002\037g-\353\234\225:c\251\316\tR\347\253\3249\231:#}\234\255\254sU\352L\245:O\245\316\bR\347\003\251\263\224\217s\224u\206J\235\237Tg'\353l\300:\027\260\316G\353\001\337\364\006\376\361(\347\216\277\364\005\336\"*\2234=\323\037\331\330\271\242\351\373\212\253\261\263\375\272\217\351\333\217\331Tz\260_\372b\033\345\030\260'\360J\337\312\271D\277\354D\302\177\374g\033%\360\311'\234;s\244Ix\006\374\321'!\375"
+	.string	"\001\217\364\335\226G\315\023\225\264\235\225\311S!\257N\272\316\n\205\251\220\216\200\177z6\345\034\341q/\210h~X\243G,z"
+	.string	"o\364\255\304#\372\242w<JC\265\274"
+	.ascii	"Ot\030\340\243\236pj\206\354<2\002\360G\314&\035t\350\335\b\375"
+	.ascii	"\320\267r\360\201^\210\r;\245\242\202^\212\331| CD\343\373\374"
+	.ascii	"\317\177\237r\256\201\317\033\277\225Q\n\373Y\326b\225\"\305"
+	.ascii	"6\352\363R\314\240\2778\034&\206\r\274\342\327\361\222%\373\356"
+	.ascii	"k\365\260{\311\366<\331\263\267\301\255\265\232^\023\306M\204"
+	.ascii	"W*k\025\357\345Z\3056\332\363KO\270\237?8md9G\370_\307\035f\325"
+	.ascii	"\357\260\367d\363:\314\354\240\t\303\324\036\3543\017 H\220`"
+	.ascii	"\033U_\351\331\034L\362\366\353\2751u\031\027<\270\007\264\022"
+	.ascii	"\034F\240\235\235\231\365p\026\326V\326\226\031\227\027R\350"
+	.ascii	"\202\231\212\021h\036,\237!W\220\020\221T\021\002\204\210\021"
+	.ascii	"\037\222%D\230\221H\236\241H\221D\"\261\211\023h(\222*L\230@"
+	.ascii	"\2214\346\335.\336\017\302\023\234\020\252\375\032\277(\336\013"
+	.ascii	"\004\254\365\272\r\365<\221\031\274\224\252^\360\f\2368\024\026"
+	.ascii	"\314\301\201\034h\033]\300\304\353\233|}\327{\271\022_\002c\307"
+	.ascii	"\372\366f\033\355\372\"&\234\022\256G\202G\341\267\236\313\215"
+	.ascii	"\024\331\302z\005\024\264^A\226\0263\353\237\230p\t\036+\316"
+	.ascii	"\355\302:P\310z\244\375\352\022|\007\362\270z: c\237\374++\367"
+	.ascii	"Q\246\366HR=r\314\352\221UVd.W5\365TqpoSr\b~G\031P\241\216\026"
+	.ascii	"\373\003\217\340\333q\224\251~\303\335\314V\271\225\007\017\333"
+	.ascii	"\350\201\007z\002^\371\323K\375X\351\274\227b\177\214\361i\034"
+	.ascii	"\365RV\016\365\314\253\335\312\264\275\214z\346\f^\203\235OZ"
+	.ascii	"wP\377\304l:\375\323\273\340\020_\206\265`\021\237\261\036\351"
+	.ascii	"+\205\203.\303\351[\360\331tg\234\201W:\227\345a\201\200\325"
+	.ascii	"\250a@%\221C34\n\n\222\222$"
+	.string	"\255\001\300\002\021\031#v\021\3408\246\230\252\032QJ\205v\003\215\325\317R\321C\002\300XI\313\333\037\261\351\371\226I.\036\b\225\334\222\024\344\376\215\370\363\237(\031\024\005\333w\t\210\247a\201\024\347\276Q\007A\222Bu%4D\016|\314%)\027\371\306\2021\007\260\020\006\272\320\236S\b\201\303P\355\344\205\252\nH\242\006\277\002N\221\320cpt\361\235.\260\330,\t7#>\301\230\351&\335nb\321\332\357\375\306\212\314\030\206G!\330Y\257AP\267\003r\255\341lt\334\233\265\037\311\375h\002\256O<\254\305\245\207\2670\204\307\306\342\351\242G\221~h\rG\2505\305\234&\262Mzg\001\306aC\241\375\204\030\364D\315\353\242T\"\202\006W\313\t\030\306\r\345G\342\235j\332\220_q?\232N\236\\\tP\235\3143o \n\345\274\306\233\033]\303l\311\b\317*S\301\037\261\246\361\234t\241"
+	.string	"\"\361'$\220@\302\212\2000\036\004iQ\346\302\362!\207\205\235\230hs\337\370\344\257\222\037\304\354\217\202\270S\202k!`\314\304\237\212\202B3\301\206\304\341\322\360g\272\013\260\274{\020\215W?\375\334\f\201y\255\022\037_\343\305\314\202|\023w\350G1\242Q\374'\023\261\233A\343>]\302v\313\250\344\337\200\t\302\221\204N$*W4B\345\330gUJ\322\223"
+	.ascii	"\007\307\001\272\203\342?\364\245\0363:4&\026\305mn\306\327;"
+	.ascii	"\250\032"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.95.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`p\005u\034"
+	.string	"\0262\253H\260\226Q:)\266\\\203\353(\316\211d\326W0\341\330\037g8\377K\316\005\3075G\352R_R\372\251\375[\355\317\004ia\203\025_|\311\235\302\362\002\306\212?^\362f\216\034?\371g\177\210m\321\356m#\204H\231R\212"
+	.string	"\213"
+	.string	"\240"
+	.ascii	"4W\317\\-su\314\325\262U\303\250:v5\354\352\227\253_W\273\256"
+	.ascii	"n\255\272T5y\365x\365^\255W?\300M\326\224\205\036s\246(v\231"
+	.ascii	"RdS\r\333\207ygO\271\022\322l\315\210\0022i\231s\3466\306wo\225"
+	.ascii	"\344\270\272\363[\b^A!\321[,^\276\bY\234\224\t\177\343\316\234"
+	.ascii	"\363\204\216E\337\221g\312E\024"
+	.string	"\231\3207\342\034=\025\035\307\025\205\260\247\332B0\347\264\006\205+n\327m\227\260\335c\223>\002N\300\254\030\035\327\376\321P>H\356\216o\370\024GG\346\364\3147'\017\300\356\270\333\344w\243\247E\307\364\253k\003y(\037\334\3359\261D\003\316\304C\227[\322}\355\360\220\207*\307\225t\007\220\346\234\006t<)\310\247q\322\"\206\364\301\223\376PyRo\247\362\344\227\247\252\211\247E+\321\211\311T,[\211H\027\206\375q\356\013\233T\353\220j\034\251\276\221\352\234\253qVm\033\325\265Q}\263j\232\252m\256\236]]su65K\263\263\375\357\250\367&w\342\241O\303\rL\304D\312\2235\213\2532\342iqfi\266\006%\2633;B\375\254x\262\215\221\231\222\322\345\242b\366\325\004\345a\017\322\223\356\200\022\331\366$\201Y\333\301\223 !\306\026f\027\n\026\233\301v\245\374n\274\326\303\377"
+	.string	"b\221\322\227\255]\375l\330\324\265\366\003\b\345\203\257\326\272\326\306\364\263\022p#\036\236\210TDw'\252akO\224A,\327\216\360!>4$[\302\205L\220Q\3159\013"
+	.string	"y\020\n\025.\350\203\027\202V<-\232\334r7\376!@B\007\224\033\321\201\003\320\207\r9\020@\030t\271\037\241\241\034\201\232\203Bh\020\312\215\b\n\022\312\301\224\346\307\271/$\024\245x\333k\351d=\313wI%nu\366@#,\034Vy\333-\256\343\312\234\275\355\201EW\307\262KJ\240@Ay2giUFYt\316ID.\f\343\3547\303\322\022\237r\271\262"
+	.string	"gi2\214\256F\233\025\237[\225\t3*\265\265\355o*n\242\274\331\332Q\357f\227\t\230\025#F\335\310\325T\213\265OI\333\fKO>\345b%B\321\326fp(O\252l\226\266;d\026q\250qT\003\tcC3\322\244\3260\006\320\002\021\241\261n\021"
+	.string	"\261d\214\rm\355\034#`\375\245l\307\033\340\253;\027\252\232\343kn\252q\331\203\260\320\002 \365\027h\236O\323E\002\027\342\315\374\222\036\361O\246\227\207;\352.\023\373\b\261d{\006\327\270\323>\207\347\353\350\n3\206M\331\374\"\002\335\206\214\357\261d\311Ov\332O\371\303q\035\204\023\3509\300v\366x\376\302l\354?\354J\007lG;x\316\363,2?\203\250\257\r\341\221\0030\342\300\002\271Q\033\362\"\022\274\221+"
+	.ascii	"\204}\260\375\232\372\267\264FSzQ$\232\254\356ejJ\005\210\336"
+	.ascii	"T\032I^g\212\264\243\035\262\305\377D\304\360[\216Ib\"\312\013"
+	.ascii	"\202\220\264\365\225a\360\017\355\001\253\360\212-\320\301)\317"
+	.ascii	"Q\003"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.98.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\203\006u%"
+	.string	"f\277\342G`ZR::\364\352\317\036\202\363\036\261\333\326\365U&\3530c\002&\375\007uk\264*9\330\234\313\231|\276\002\310\330s\363\245\366\243b\344\370\323\321\350\22728\034\300X\272\030h\326\255B\350\001\026\"\237\304\356\235d\315"
+	.string	"\302"
+	.string	"\321"
+	.string	"\257r+O\373Z\007\177\322\250u\0261\242\273(\031\221\275\372\303\207v'5\221u\366\203\327\222=!\301c(h(y\263\031\302\2526o\005\341\251\201`\257*"
+	.string	"2\324\335R\t\257\332\274\304\200\307\205L\232s\033\341j\027\261W\273\177\344\206~\273Ov)\311\227\325h"
+	.ascii	"9\0071\343\226s;\241\037\260W\205\347Y\257\376^`\275\332\311"
+	.ascii	"n4o\3032\360\210\221,+\322\234\363\020\023I\336\344Y\340\252"
+	.ascii	"\376\360M\366\265\226Ug\201\032\202\354`\036\370\203\020}cs("
+	.ascii	"\027\363\307\263\205D\353kYw]\302\305\274jpy\343\376\332\256"
+	.ascii	".\316Yb\375\2049\347\257\375\346XZ\335\013\324\220s\356\253\265"
+	.ascii	"\334\361\006\360\356\366\352n\033\335\353\212]"
+	.string	"\317\b\357\244\202+C\335\337r\274\223\251\227\\9\347&v\357ml\032\275to\2008\316\307\356\307\245\233BY\374\366B%\006b\026\177\017k\314\352\366u\337\355oT}\261\226j\272\327jZ\257\036;\260c*o_\363\310\215\2311\247z\307\362\237\311\341\370\214\365h\307\\\3231\002Ni\226\356\276\f\256\366\nM\345\345k\004]\240<N\267\251^\276|\335\255\325\305`\335\377e,\244\233\275\255\303\336\316ao\343\274}\263/\373\201\300\333*\3606\306\267\357z\373\0030\210}\3758\"\206\311\264y\253\317M~\252pI\336^\275}\266\267u\007{\352W\332\203\223\260/\262\253}\266\251\356\340\325\237J9g\025\203\235y\016\276C&<\217i\0305\222\220&\007\017\377\303`\335gZq0\036#\341f\230\f\224\3119[x[\1778\236\321N\230\335\357\216B\214\270\327\032\261^\305\301\006\354\340\336\366"
+	.ascii	"to\320\314v6/\3569Uss\316U\030\203]\314\242\312\335\325m\323"
+	.ascii	"=\227=\325\332\235T\342^\353b\241\346\025\256j\236\271&\332w"
+	.ascii	"\274\372\204\312\257\235\025#\367\234F\303\274\216\211\3159#"
+	.ascii	"}\313\223\240\207\266\023\353\020\261v5\225]\332\211\002\353"
+	.ascii	"P\232J\177\0323\204u\2378\230\0242\232<\211\274\374\313\212\276"
+	.ascii	"X\261\270^5\262M.\234\027\227\247\321^\352v\262\315%\003\034"
+	.ascii	"\024\032\320)y*/\337\357\345\373M\312\315qi'\r\366\252\216WP"
+	.ascii	"G\031\304\237\261\205T\324\321i\211xT,\022\005 \237\220\310\242"
+	.ascii	")\242\322\024\021\031,\0267,\021\217\246\210JF(\251\025\211\030"
+	.ascii	"\005\303\330bm\241 \"!\"b\205\013@:PI\306\246#R\224\223\021\211"
+	.ascii	"\224*\342t\021H\252\3518\214z\261t\204\341b\350t$6\r\213H\250"
+	.ascii	"!\320\201~\212aD\016\243\236\236\220\303`\253\374/c!*z<\225\330"
+	.ascii	"\252\027\\\026w'\247l\020>\257)\325\323\002\347\226\240\f\312"
+	.ascii	"S\367<\373\347\306\244Q\263\357\370`\362T\252\275\247\356\307"
+	.ascii	"\366\\a?\312\277\230t\261\001}V\025\263\031p\237\025c\025\367"
+	.ascii	"\315bJ?\345P\324\241\303z\025c\237\"\314\265\263vsO\374\314\271"
+	.ascii	"j\325\271\232\263az\332\236\321\317\326\334\267s\275\252\203"
+	.ascii	"\237\326m\200\215\250a,\005\231C\212HD\244 )H\322\001\200\002"
+	.ascii	"\031*#\036\021\220\255c\306j\222\333\001\340@\267O\330tl\261"
+	.ascii	"\021\005R\024\277\321\001v`\037I(\210}\025\366~\224\371+\321"
+	.ascii	"\213\226#\375\3441?\\=\260\215\246\337b\030'C\377\013L('\177"
+	.ascii	"S/\006UV\377=$\356\304\r\032\304Rh\237\226\253\344\243#l3Bc "
+	.ascii	"\224\004\001\357m=KA]'o\240(\330\020ZD\334\313J\022\021d\007"
+	.ascii	"3\177\360\265\217\205z\020t\345\301$J\222\351\326`\037\355p\345"
+	.ascii	"\301\242\351\243\256y\225\026\263;\230\214T#\3607%\211\r\035"
+	.ascii	"Ka\036\241\bLd\315\327\227\260\322\215\2737@\345/\031#R\\n)\320"
+	.ascii	"\373\3015j\210.\214x^\312\341\r{\306p\337z$\372)z\323\223QGb"
+	.ascii	"fp\261\204\331\221\r\001\345\233\373=\302\377\253\250\001m{\371"
+	.ascii	"7\206\024\272\t`U5\356\001\205\336\375\253Ap\250@A?\345\b\356"
+	.ascii	"D\022W#\212\374\343\2669\326\217\262j\002\236\324y[\360\037"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.99.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\320\001\315\017"
+	.string	"6\035iG\320TQ:\024A\204\006\373\262\2072<\314\245\021\025\341\272\306\243\256\020\315)\346\t\\\211\223}\327\260\361\353*`\271\025\252\336*M+)!K\006WX\307gG8^:\222}\230rK\301\246\332B\373{\223-S\nS"
+	.string	"P"
+	.string	"S"
+	.ascii	"?\231\227\334\007\314K\267l \257\311\366;!>\344\020\331\335."
+	.ascii	"\236x\353SrQ[~\250\205$\026\272>\001\2045\227\242\232s\034\202"
+	.ascii	" <A'4*b"
+	.string	"\243\020\246\321$\364\300\251\354\356o\256 \302\031\325P\313\356Zc\241\210;t\333\236\355\007\266\242\004\326\300A\037{,\221\200E\227\3256\242\307\252\021\273\346\322h\302>\267\273\353hc\237\366KU\253\252?J\261\361\3300d\227\346vd\201d\317\n\333\267_k\331#;e\266\340\372\033\277\305g\255\323:\230d\267\204\216\215\335\032\213\017\210.U\002\236\211\354R\007E&\344\2457\007\260\345\210(pb\374\310\022\225\321v\371\3641s\321e\373\314X\310\270\343\\\343\203\354\013\207!#\332]\223\377\3429)?\305\245U0\322\207\231\227\032\r\370\240\275\364v\335]W\264\314|\244\340\342\007L\213x\252\2365\035.)0\225L'\006\016H\002b\"\240R\037\204\325\013\n\004Y^\211=\022+\365u+\013.\037\206\n\335\313wJu\036\030\323\221\nX\225\001\005v+\225\n\354F\265=\267\321\306\022v"
+	.ascii	"\275\342\314\\9\317}n\364\350\215c\352`\371N\r\032?+\267\235"
+	.ascii	"\3403&\020\220\355n\003\373t\031\001$ \300\202\231)\253\003\204"
+	.ascii	" Pr\3500\031\030\032\214O{\257n<w\315\370v0\204\362\215b8\343"
+	.ascii	"\363`TQ\220\264\267\300\002\326J6j\tF\321~\213-\314&'3\374\002"
+	.ascii	"4\240?\304\312\017\345\364N\024\334\327)\377W\327\233S\020g\273"
+	.ascii	"V\031"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.100.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\265\007"
+	.string	"\002\31636Po\322\001\200\362\033k\017#\200\325\017Q\032\005\002#\226KT\3464-\016\305\255\311\230\361lf\350\204\220\263ff\346(\363\320J\327\275\313\203\003\021\331[\312\224\002\326d:\233+r\030\026\256\006\205\350p!l\242&\203\210\231\001c\017\tY\344`X\026\253n\377VC\251\230\217NX\304$k\345\343!\035\001\321\356\032t\007\211\360G\207\226\320\362\334\241\257\335%\324a\252\305R\372\344\213\253\213\315\223\335yR1\354\277\325\220\375t*\201IE;\331\255xq\331\024X\322\260\275\331\225\317\361\216\315&\275N4z\313\006\305\210iw#\346\026u\370\036@\035j\306\267\347\346\337\343\317\344\204\302\201<O\200\203\335ur \213[_`\233$\016"
+	.ascii	"2\241\233\037\270b\202\2219\032\023\341\305\201\330\f\206J\030"
+	.ascii	"\256\211\270!p\314\330\304]\221f\303\273\356\r"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.101.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\203\002]\025"
+	.string	"\346\250\215I\300\360*\035z\207\215\314`x\350S\337\273\266Nr\217x\370\371\027\275\223\230f\225\230Q$\013\365T+\\\264^m3\334\247\305\262r\367<\242\263\363\357*:\367p\036\367&\332\334~\035\354\277X\266l\333\326\b!R\246\024z"
+	.string	"l"
+	.string	"{"
+	.ascii	"\037\362R\252\207\223*\002Zac\316Y\340\244\033\244N\306\306\213"
+	.ascii	"\224$\024VV\355\223\003\273\013\325x\347\3140C\305\234C\003&"
+	.ascii	"\220:i\333/q\023;\363t\350\203S\002\t\331\020\341\230s\312@>"
+	.ascii	"R\236\324\213\224'\267\303y\037Wy~\357c\002\036L\302\234\013"
+	.ascii	"\337\261\204GC\016W\316o\214\261h\2629\361z\223\003TE\251\314"
+	.ascii	"9\255\302\034"
+	.string	"\0137y\333\fl;\260\225EG\201\363\177NZfF/<\351\317x\251<\371\205yP\362i\321'~\305\204\341\305\324'{\330\323\355\261?\316\345\261\255\206]\350\017\371\320\375\262\332E\252?FukT\263F\365jT\253Fuj\325(R]\216jrT\217\243zW\255\243\372#%#\\\324\024\347\254P\3341\233H%\240\017\375\366\316'\232E\242\2632\374\211]A\033!\213\332\303\260\351!BW\005\005|\255\356\211\202N\312\004\342\265\037z\314\247O.\367\265?\262\351\001\242\344\3323Zya\271\261qw\311}0\350\247E\373GGr\222\377\343\232\221\364B#-L\206NK\277\266\355\245\274pWf\003p{V\246\017\327\261S4\332\355q\322o\270\340\3204\275\240Xt\002\316\351\033\360\205@l\001T\035N\341$\230\017\321\215`\\1\212\002\265[K\314\2144\312I\nJ\312\f\201\002\023"
+	.string	"5\232\333l\002K\f\316\246\243\325r9\034\215\245v\323\351p9\027\235"
+	.string	"\323Lh`l2\235K\213\355\026A\026c\233\301\310h\271\031\231I"
+	.string	"\343$\324r2\035\016\227\223\261\206\363\313c\231'!\342U;9j\250\317+]{c\333\265V\361\355o\374X\330\276\365\301\332\324\266\3660\202A?]\255\375\340E/d\221\b\3414i\250v\245\253Z\222\007jS\373. @\002B\fsy"
+	.ascii	"I\"]\003\376\030\240a\354j\305\r\233\372\0300O\f\321;\230\203"
+	.ascii	"\252\003\026\t/?1\026\225\024sLu\340\017\025C^\373\221\211\243"
+	.ascii	"a<\306\001l\320\253\303\342U\032X\347\273x\252%.\255v\250\312"
+	.ascii	"\251\361>\210 3\037\207U6\n\211\0020\203\241`\2573\207A\220\342"
+	.ascii	"\034\t\211\223\313\307\235\215\350:\362\352\320\264a\017"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.102.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`$\002M\017"
+	.string	"F\\cE\360\260(\035\370\255\324\337\341&\352jQ<\303py\264?\241\204\364L\271\0176<\262qi\225\024\003\376\273P\364}\n\024^\214\255\261E\3223\360\214N3X<\003\344\210\247\357\364U\344\333\276\023A\366\2262\245L"
+	.string	"I"
+	.string	"Q"
+	.string	"_\f\007\333\343G,\301\323\276\210\217X\335e\230=\2736.\026\273\253\300\b\266\307\220\027\320\036\341\th\217^\331;\377b\3660\031\006\023:v\227\323\016_=W\376I\334\343\275\260\236"
+	.string	"\036\354\256\323{\321p\353m\213\330\216`'\210\367\036}\225\312J\336sH\213\262\234\262\032\235\315\035\366\307J\345`\037\356\356Za\354\313\374\240\177\377\347\256\337\223i\355\351\230i\370\264f:\237\376"
+	.string	"\220\0334.\314\354f\230\361\330\234H\363\301\366?\366\307\216\214\r\b:\001P\025\347\243\252\020'e0R\355\321W\220\f\304\330%\177\231\004\250\261\273\242\024W\321Q0\231\264\307{9\256\251\352\302eF+g6\354\033\274\265\354\266D<z\205/\227\020,93Hl\313\2278\n\325\266\333\272\347\237\370\214\005\337\303\243ST\031*\243\025=!\245:\224\350\221\005\242\021\321\210A\203\220\200R\351\204\202&\205T\246\216K\235\230t\245\t\\\205nd\342H\250\024.t\300'\224\022\024\227:\235P\334\347\333\303U\030\223\340\310i)\213\214\033\231\246\266\204\333\274\210E\325T_ \215\252=n\240\332$\257\241i\241\032* "
+	.ascii	"\203\231\031\323\006\373I\021\026\217VFC\330\203\221!{\313A\340"
+	.ascii	"y\023\306\270\007\373\301\026~\242\260\306up\213[E\241-sp\310"
+	.ascii	"\335\350\267\311,b\214GL\343g\013\fl\273\261\371!O\230n/~\230"
+	.ascii	"\375\361\030\231\357\260A\232\213\314`\314l\200\313\213\266\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.103.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\252\001\325\r"
+	.string	"\006XXE"
+	.string	"q\234\016|\307$Y\202I\3748\313\207\023`~'R\372D\256u\300\027\231a#W%V\227E\240F\035\306\2440(\214\335\376\340\037\377\377\377\337\347\326;\020\235f\313\347t\235\241\333\301\246\222\337h\357\224\002@"
+	.string	"C"
+	.string	"C"
+	.string	"\340KLz\333\205\231h\261\273\bl@{\335\\\300\345\325\362"
+	.string	"\227W\203v\215\217 \366$\016\013(7v\227\243\037\016~\202\376Q\276\211\255\3603k\260\273\236b\013\303Mo\273\200m\006\366\f\005)6\312\2359\3541\234\324\203}\313\356\256)\211\375\223\177\273\311\237}\374\353K~\232\031\215\314"
+	.string	"c\354^\210\351X\225\372B\204\355cl\315x\262\022\032aBc\201k\204\201\264WM\207\003\237\366I\274D\035\247le. \304*y\362k^\234);(\365W\234\205I\337e\317/\277.\257\036!FX3f\002+\331\374\211\253\370\264]\326E\037\305S\244|\327\253?\276y\361\325\377V \363\2427\"4\364\f\025\276:\205\333\223\340\343\371\210\024\200:"
+	.ascii	"\276\233\324\3718u\234\352\201\251\213\340\200\223\320\211N\034"
+	.ascii	"\t\225\342:\003\354M(\2418\225\347\2418\314\270\267,%\261VrP"
+	.ascii	"a\321\020\0310\257@D6\210F\0322\323.\231BhhN\231a\203\021, 0"
+	.ascii	"\203\221\251\340\030 K\221\021/HFc\210\206\334\270z=}\026\003"
+	.ascii	"-R\213\rk\205Z\354\335\306bB\0169\227\031$\33614q\216\213{\r"
+	.ascii	"\355w\301O5\377\366\270\267hh\016\2709\224aY\316\t\214\221\371"
+	.ascii	"\206\t\302\2342\203\021\263\301//ZM\006"
+	.text
+	.section	.gnu.lto_imuInit.part.0.126.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\335\b"
+	.string	"\006P<8@\217\322\001@\265\345\003\322\350'\030\247\316\f\r\320\nI\364\267\207\264\246jC>\325\224\\\032e#\210\"+\026r\235\013#\300{\202#PFc\034\250\330\312&r\247\024)"
+	.string	"*"
+	.string	","
+	.string	"\177\251x\274dvW>j\311\277+\304>\377\255\003\240R\247k@*\344\220\340\330\206aw\315\021\271\343m+\330\376\330^\t\013g\240\256\254\330\261U\225\255\b0\003#\273\03754K\022[N\354\267Lv\346\267>;{<\313\266\t\304\237\035s\227\311\0062\263\r\217\255\252\334\300\342\242\241\033\252+\333\033\350\243\220\354\204\273J^x\274\340tt:\2176F\006<\312\032\207\236,\220\302z\t>\230\335\234\233F\021\352\0346\017\0041z(\2118m\363@\333\374\0308\344)\2118\351MHp\025\021\322\202\003\211dh\222\244\247\300\335h\233\322\353\272\031\020"
+	.string	"U\023\030\017\006\b\224\3123<@\024\fs\205\3130a\347\f\2403@\233);\r"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.127.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\005\f"
+	.string	"vUOD\020\215*\035"
+	.string	"\253\b\001\0209\003\350\272s\033]hT\027\211\346%\257C\006\304\326hIci\033\306\276\037-\270\321\341\317\366\227\t\354\006"
+	.string	"*\na\216\033&\034\213BW\354z\370\325\003sp\240\275\367N)8"
+	.string	"8"
+	.string	"<"
+	.string	"\317`{drh\227\370Ha\357j\300\240ebw\271\3279\341\341\247\244\241/c3\361D\372<\353\024C\314%\236\036\\f\234R\230\354\2565\bw\275\355\022\333'\366\275\033\241\302,\330\276}\326\310\336|Vho\257\266G_\211\350\270'\223E%\"\345G_u\r\341W\"W\354J\360\360\332\035A^\355\241\275^\276Qy\245\327\250\274\332\001\323&\340Y^\232\374\206w"
+	.string	"\265\335\322E\277u\016\007\374\n\257\006\201\362\342\253\017\"H /\372\262`\222l\021\342\002\211\225'\344LyR\272\023e\177\374_\341\370\220\355:\230\311\002\316\204h2\232\315\b\t\006\003\224\322\361:\224\220\247\363} \347\302\034\f\350u\\h\200\200\256@"
+	.string	"\316\323m<\216\363\2018L\207?\006:\037\027\372|>n;\335\2112"
+	.string	"\021#JS\301\234)\033\304\007\330&\037\032"
+	.string	"\204#P\3771\004W`<\230\213!\n\006\003C\236\340P\205\001`\357\316\306\273R<\257\355I\031\021"
+	.string	"y`\204\353\360\267\306\026\236%\315g\3306Sv\032"
+	.ascii	"\256=\230\302i^zm\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\177\004\035\022"
+	.string	"\366\233iH\300\032'\215\001\274\266\376\005"
+	.string	"\001\354bf\037S]\210\006\354\210\333\242`\202@\330\244P\004\241  q\335\026\\\223;\264ILV\226\""
+	.string	"D\322b\363+\200\177\330\233\306\251\253_\254*\240\001\013\205\002@\272\377&;\005P"
+	.string	"V"
+	.string	"X"
+	.ascii	"?\341\024\334\364s\027\237\271\364\354P8\236{\354\b\321\217t"
+	.ascii	"\202b\203\311\371\007\354/\257\275\340\034d@\202\257P\004\273"
+	.ascii	"\023\356\300\336\2043\260R\201\205\270&r\363\020:_\202\265u\022"
+	.ascii	"\375O\365\373\252\216\337_\232!gj\255\225\300\216\204\373i\214"
+	.ascii	"F,f\031f\242?D\033ZA#2\"*B1{\001[\20220|\204^\330\251X\330\247"
+	.ascii	"T\330\245P\330G\331\036\205\233\2603\341$\354#\302\276\204\203"
+	.ascii	"\260(\264\021\372s_\335\021\264+\241\001\242@\373\255~\037\370"
+	.ascii	"`/\3039\270\326` \364#\006\027Y\260\001S\200\330\251&\r(e\r\034"
+	.ascii	"4\224`\252\031\240\006SM\027a\213q6\316B\025!N7S\214\257n\246"
+	.ascii	"n\234\272yb'cb\257Rb\267Bb\3072b\337\"b\317\022b\037\003b\267"
+	.ascii	"}\330\265x\330\303\310Z\353{\267\016\273\030\311\341\r+\252\341"
+	.ascii	"%\3720\212h\001\243\300N\\\271f\367\355rM\024x3S!j\374i\315\023"
+	.ascii	"\370jI\233\215[R\2545\245(O\302#\007\022\313f\312`6\023%J\211"
+	.ascii	"dkb\252\361&\n\344\361f'\356M\031\366x>\336\224\311O\305\332"
+	.ascii	"aM\231N\315\004\220\n\273\261\003c\253)k\257\325\224`\316*[\250"
+	.ascii	"1\b\212#\2612R*\fk\360\002\241\232\351\021P\020\227\232$\221"
+	.ascii	"H\234\220v\243\362&\372\273=\275\260+}\250\221\027\202\2371H"
+	.ascii	"\344\265\227\237@\214Y\021y\332i\265\324\234dd\371/\337\034F"
+	.ascii	"\237\331\327\004C\273jW\305]\353\376\250jd\220\272\322-\234-"
+	.ascii	"!\007tE\272\n9\314!\234\303,a\326E\003%\362\376e\3131z\026X\213"
+	.ascii	"\027i\276^\200\253\355*|\304\002\007\272\r\365\204S\220L\260"
+	.ascii	"\343\233\206\213\n\037\260\365w\231\017\340\356\201\226\022\002"
+	.ascii	"i\256\002\253"
+	.text
+	.section	.gnu.lto_.refs.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"u\n"
+	.string	"\266ZI5PK\223t(\031\311\274\2638\224\251\210\314\314\314\314\314\314\314\314\314\214\313\221\210\316@\363M?\372"
+	.string	"cd\033m\361\203p\233\375\337Hk\215\020\202\310nm\313\0245"
+	.string	">"
+	.string	"<"
+	.string	"\353\241\365l\375\020y\222/\311\017\220/\3457\362\243|\226\237\371\230+\366\027\021\262\377 {\203\354\n\262#\310n\221\335\222\235\222\3355\337\230W\370\330\207\276\035\002Oy\374\304\343#Gw\0347\324s`\36470~\rQ?C\364c\270`\001\372+P\230p\301~\t\256\017\301\375\016\3303\200\372\002\350\023<\177`\375\305\371\212\323'\316G\332C\260o\004\022\271\304\244\277\247;XoL\037\261\356\246\177X_\323+\326q:\242\255$8J0\202\033\220\272\205\364\005\244n\221\276\002\362\024\257G\274\016\201x\274\336\362\327\353\f\200\350\213\364\225G\023\300\013Nha\032\323\027v\325\3364\025\345^o\257\253\327\212\\M\246\340\230S\364g\365\266z\263\236hnQ_\214\256\\o\\G\327\0019C\202?\002\372Z\257 \035\331\001\017"
+	.ascii	"=E\345\034\216\260}\341m\221\262\325\260t\241\237A\0016\315\316"
+	.ascii	"\f\200`7\003\202\020\020\327\312\214c\b\312\036"
+	.text
+	.section	.gnu.lto_.decls.a28507c76e004810,"e",@progbits
+	.string	"(\265/\375`_C\3156\001z$\036wV \na9\351\020\2355\251\371\b\035\310\366|\246u\204\017\0276b\364\360\034\344\302\241\214N\274\220Y\036\364\332\273\034X\210\247\221\27323\307][Y\254X"
+	.string	"\264m\007\3430\024;\323\201\207\003\264mu\034t\202\257\035\342\303\374v\007\333x?\262m\t\331[\356\024r\006r\007\220\007\\\372\036\235\202\265\274R\201\271\020\323\367(\024\374\312<\234f\273\33452&\007\224\276G\305\360Q0|\264\013\037%\202\233\331U*\023\203\266\262\034j#z\252\240\365=\212\205_1@m]]\305"
+	.ascii	"=\272\243\247\374\275l\255\226Rw5\270\230i\351\333g\215V\231"
+	.ascii	"\032:\355\247\3232/\347\fy\252\352{\264\n\213 \347\252\001\255"
+	.ascii	"uuU\003z4\006Fk\021\372S\017\376I\007\237Y\215\320~2\264\205"
+	.ascii	"\202S\232\276?\341\360T\337\260\313/\017\236\250\232M\332I\213"
+	.ascii	"Uf\217}\254qt\027\007Q\312\t<M5\307\232\311\307lx\222\312NAD"
+	.ascii	"\200\321\271i\243\363p\247\f\001\003\004\337\237C\360[\213KC"
+	.ascii	"}\033b\"\311\025\265\"c\315\356j\253\316\332\360$\025\202\233"
+	.ascii	"Z"
+	.string	"\263s\240\360.B\274\234\263\230_D\2344\317\206 \3257&\2126\262f\316\313\2566\362.BPD\031\n\211X\263s\374\025JouW\013\321 \344\264\314J\224\310\2205a\350ZI/i$\235\244\277\032\254\303\332\2532\273\253\217<\203\207\f\347\024)tx.\334_8\374;\006\377r\301\277j\370\027\r\377\222\341\3370\374[\004\023U#TD5B\203t2\016\032\032}\177w\340\377\375\243\201Tfc5\217w\216\326\361\f\313\234\325v\364\225P\322B\316[p\276r^b\265\217\276\252oV\313\\\243\346\220+\263\207.\347e\006\017\036\354\232\233:R\320{\353\206\377\276\352\036?{\240\370\330S\231\335\243y,s\006\241(^3\266\372\336.\361\355\030\276M\202k\256F(\221\021\3747\215\367\215\277c\264\214\266\301\201\263\n\f1/\372vU\327x\333h\345G\220\270M\236e\262\234s\333\330"
+	.ascii	"+g\247\2661\224'g\247\241Z-\250\325\202\353D\313\313\nzo\205"
+	.ascii	"\340\246Jz\323p1dF\215\276\030\324\"\364\026\b\276\345\201{Y"
+	.ascii	"\215P\244Z\204\212\250Eh\277\250pvV\200\321\367VFGY'\334O\031"
+	.ascii	"\206l\370\240\"\325\367\r\007_\003\025\352\n\326L\211\255p\355"
+	.ascii	"i\346\274\374\337\271\235*\263\223\025\017S\255\2235O\255\023"
+	.ascii	"\202Z\346*!\256\272\0349\350r^z\310\340!\310\n\035\236\034\350"
+	.ascii	"\325S\367\f\311\350za\304KOo\3417\215z\247kH)\002\243\357\373"
+	.ascii	"\tW\272\3373\254 \353\224\203\f[\337\327<\370\225\r~[-B;"
+	.string	"W#\264C-B\377V\213\320\3274\030/\253\021Z\245j\021Z\335\3247\225\211T\341,\207xj\350\370`\366}\035\203_\221\320!$\364\225\211\331\304\001\265\345\211\312\321\267\246\251j*\363]\352\232\363\240\2269-\347<T\211|I\022\351\373\272\304'\344\234s}\027tWWWWW\337\005}e\202k\256Eh=\323\365\255\242y=S\315|\004\211\003Ae\262\234\227\365\314\315\331\251V\013\204j\265\340\354\322\345\204\206\336\327/\374\232\003We\035#\206\0075\204-J\3370\032\254\224\021%v\372\276\306\300S*Z}c^&{\232_*\230\312\254n\265Ju\253V\252\227\372\306\274a\352\2329g\017\032<\b9)\221\002\203\336.\031x(\274\221c\246\357A\200_\325\260\334\321`\355lB\274\234\335\350\276r\316\377k\226\312\245n\251\314\252\245\262\335\345+\331\237\364\327+U\255j\251mg\333"
+	.string	"#g\267\036"
+	.string	"033\345\013]\316\331\203\207\f\036\206\234\264\272\210\340{\n\340?"
+	.string	"\337\001\370'p\207j\204\336Z\204\276\003|\022\030\350\350\377\220S&\361\213\253\224\232f\245f`ef\316K\013AC\352\226gi\177-\253\313\212\306kcScI\337\277FyE\373\253Y=;[c\345\f\225s\236\240\315\310\371A\327\367o\325\b\005\252EhcU#\364\202Z\204V(I\257Q\376\372\244\222\025\241J\253ef\346\234\207l\233\227\250<}\273\026\241_V#\024\327\"\364o\023V\001\275\001\240\3776\371{\356o9\226\001\177_"
+	.string	"\377\327\353\357\020(\020\341D\377U\241\232\351:\273"
+	.string	"\021~\341\277l0\364o\003+\232\370\242\377\2229\372_\023V\001\177Ur8U\316-\374w\311\337\004\260\t\250\\\036`\021\3607\026\313\301_\271\250\374\366"
+	.string	"\366\202c`I\374\177\253r.\200\377>\375\265W\247*\231j\346\267#\376\226\253c\376\212\342\257p\177-\363\267\217M\262\"l\b\013\342\177\206[\360\337\035\1773\240B)\263\037~\353\301\026\300J\217\260Hu\352\257WZ"
+	.string	"\026\203\n\366?\356\030\374\337\300\212.a\t"
+	.string	"\347\007\370\357\004\376\267\375\337\362_\313\177/\377\273\374\017c\t\360_\314\205\376\373\200\377p\354\005_\323\034\364\322e\263?\n\2103\200\277\212\240\216\240r\325\260\277\036\371\033[\001\300\261\340\267\026:\364.\302\206_\360\337\256\277\1776"
+	.ascii	"\177e^\371k\317r\370k\025*\177\243v\203\255\240}\337p\002\374"
+	.ascii	"\226\202\n\201W\360\337\262\377g\377\321\236v\021\356\363_\016"
+	.ascii	"\177}\363\3276\177u\363W6\177]\363\367\214\277B\371k\331_\315"
+	.ascii	"\376\363\376\263\202\277\275\376N\3627\330\337H\376>\362\367"
+	.ascii	"\327\337a\177\373\254\004\177\363\370\333\310\337D\254\321\377"
+	.ascii	"\241\377,\341\257g\252\003\376\333\377\372\370-\206\337^\370"
+	.ascii	"\255\320o\201~\373\277\355\374-\367\367\231\277\327\376\266\362"
+	.ascii	"\367\362\357'\177\217\375\335\344\357%\177O\375\035\202\277\323"
+	.ascii	"\277\211\177w\340o\r\374\275\3647\360o\013\374\375\373\333\367"
+	.ascii	"w\357\357\r\374}\201\277U\374=\302\337\"\374\035\302\337\020"
+	.ascii	"\370\373\203\277Q\374\335\301\337\f\370[\001\177s\360w\211\277"
+	.ascii	"G\374-\342\357\f\376\376\360w\001\376\306\340\357\001\374\275"
+	.ascii	"\341o\n\376\236\340o\f\177[\370[\350o\237\377o\177\343\277\321"
+	.ascii	"\277\357\377\025\377\343\376\257\371\037\346?\332\337\375\327"
+	.ascii	";\177\265\363W\025\376*\347\257q\376\332\373+\004\376\303\371"
+	.ascii	"/\302_\345\376\n\347\257)\374\365\313_\333\376\312\366\327\265"
+	.ascii	"\277b\371k\223\2772\371\353\222\377*\322\376K\340\177\006\376"
+	.ascii	"\213\371_TWWW\367\357V\374?_\177R\004\002\02489\2728\352\325"
+	.ascii	"\241\303L\216\257\243[\243\336\0337\316v^\316njm6(\020rti\324"
+	.ascii	"[U\231\267\352lU)\001\225V\224fV\346\017\017R\342\263\375\357"
+	.ascii	"\001T2*\300`\323\327\002\262\243;\343N\375R\375Ru]\3159g\253"
+	.ascii	"\234\224\263\301\223,eat\331J\211t \025\360\377\372\376\321\354"
+	.ascii	"\244\3149\3278\227Y\371\004\204\376\365\365\254\025\351\017\252"
+	.ascii	"\266\n\340\377=\002\2129?\255\211\345\234k\035\254\204\315\251"
+	.ascii	"G\207|\276)\245\322\262\222&\262\252\240\262tH\245eUY\220J\313"
+	.ascii	"\312I($I\013\312\234\225\224J\313\331\002\024T\022\005V\225T"
+	.ascii	"\232S\266 \225\226\253\262\0134U5/\263\222\031\n+[\310P\331)"
+	.ascii	"\247aUu\220\202\312\252\222Js\252\262 \225\226U\225\323\2622"
+	.ascii	"Q\206rR\302\200\312J\0139-KNN\303\252\"\222J"
+	.ascii	"\303\252\222J\313\032\253H`\250\331c\003\213\030\n<j\020)\250"
+	.ascii	"L5u\345\244$z\223Zb\345\270\234+3*+\363[\316\002\310\371\nK\031"
+	.ascii	"\347\244\243\266=\275Q=\2519a\325e\316Y\303\324\223\026V\206"
+	.ascii	"zK\326\374&\025\206\225s\330\023S\236\3129\347\r\222\313\267"
+	.ascii	"L\244\276%\267\256\362\214\250\234)\310\313\234\247rN\326\374"
+	.ascii	"\226sN\346\234w\312\253e\316<\210\244\276\246\246r\266\3120\225"
+	.ascii	"\257\222Y\242rnf\233\266*\2514-\254\244,S\322\276\362\213e\262"
+	.ascii	"J\315\300\312_9.K\211\323\222fyF\316\271\322\301_U6\346\364\275"
+	.ascii	"1|\330\256XU\365=\020\031\276R\227j\352JT\337\0031\3017\n\337"
+	.ascii	"1\262&\254\357\201\264\360\205j{\201\006\253\357\201t\340\353"
+	.ascii	"\204\305\313\026W\337\233\\\246\311\371\300\323\245\357\201\236"
+	.ascii	"0\223+\315\233\355\236\312\264uiu=e\365\b%\227\271\n\2051\004"
+	.ascii	"\310\312\217\027/\320\373\333<\267zlp \347\264\265!E\232}-\236"
+	.ascii	"\244\333<\0130\262\345\244\257\255E\250\206(G\267w\376\216\321"
+	.ascii	"2*\323\336i\262\017\2269)D#Y\026F\227\225\312\017\377\031\203"
+	.ascii	"\177[\347\226\356\267s\326\216Ua\210M\2304\311%Y\316y\210\227"
+	.ascii	"\005\317\022\034}\353[5B7\324\"\324\322I\272\255\263+\022\004"
+	.ascii	"\212\221\276\025X9@N9\326\316\364\375\317\026\374\333&Y\013\301"
+	.ascii	"\003\345)\316\231\335\023/ZL96s4\350\024\351\373\326rb\317\352"
+	.ascii	"\233\225\t/rM\2647_j\330\300\331\232\322W\334\300\261n\354\033"
+	.ascii	"\333\306\306U\246ec\327\264\006l\254\224\276R\337\206\230 k\323"
+	.ascii	"\314y\351\241\206"
+	.string	"\231Q\327\004\272\377\241\202\221\322X8+_t\326\372\202\261f\204\234\210rF\302\226\202ES\231\026\016\316\236\351)\365m\310uR\345Z\241\323\n\203\336\377\240\341\367\226\030,_e\354\233%S\231\326\314[-LK\021:s\306Z\3732c\307\264\024\037\"fI\230\320y0F\341\302\203\357\177\242\340\377\210\341\377\204\341\377t\341\337\272\335K\035617\372\276\236y\261Z\2604\277\330.\225i\275X.\326\213\335R\331\3247f.\200\231\223(b9g\017\031<\240R0\226x\241\367?0\360\177\234\360}\344\360o\263 \005\335Q\363$\326\306\246\245\304p\322\301\206\001\206\332r\205l\315b\331\341\330\241V\305^\261U\254\232eZ+\225i\261X*i{\354\330\237\204\305:\261gv\371\205c\300IM\311\323l(\026\213EsR\327T\263X\254\224\263\3257f\375b\242\247\231s\316\320fi0j"
+	.string	"\335\373\210\301\367\341\202\357\203\005\337'\n\276O\022l\226\001\365\361\266d\322\367>[\370\032<\3517!\233\363\0172_Q\354\2622m\231%\253\313|\022\177R\231\205\322o;#g\2220\241\213\300\017%:\320{\037\030\370<<\370<:|\336\033\374\266j\204\376V\214\3032\307\324V\223W7**=q\230X0\021\324P\331\321\327\202U9\266+\271\273\222\005I\022:2`\265L=#\224\\f\032hW\022I\022\272\234\227p`\265M\225\253oL\024de\232p\026\254\246P\331\bA-srgD\016\222$t6\314&\261J\354\222\312\264`\026\311\255\227\375\022\032{bF\212\317\365\311\325\b\255X\265\b=\017\r\333#\265\214\213)E\372\236\347\004\317\271\335j=\026\210\215\016M\252\212\270\365\326_\351\330\2556\353)v\331\366"
+	.ascii	"-\"M\025:\217\006Y\212\270\211\345\274|=\373\353\\\265\323P\326"
+	.ascii	"L\311\243B\023\203q\273\3253\232l\303\223T\31656X\222\245\210"
+	.ascii	"\033\235\335j*}\305.\333\360\013\264![-\327v\320~\030\261Cl\020"
+	.ascii	"\213\202\305\262Z\266\210\025b\263,\227%R\231v\253\343\274\306"
+	.ascii	"\251\315g(k\033v\371\265\233\202V\244i\267Z\255\341$\271@\211"
+	.ascii	"\234\"ntu\316n\265\213\226\262fJ|\345\311\253\241\374\225\316"
+	.ascii	"VG\251g\352\233UN\312\271`\tX\0217\272\234\227\036<\330$Sj\362"
+	.ascii	"d\270?~\276\240dI\365=/\211\257A\313\331\034Rh4\355\223\235\342"
+	.ascii	" J\311\243Jcey\330\035\366\312\372\250L\333\303\352x\245S\353"
+	.ascii	"\214 a{X\253~\263\313\257\035\025.\036\266G\357\261N>ivx\310"
+	.ascii	"\340\301\303\356**\213\017\237{\034\007\037\217\3017,\016\033"
+	.ascii	"BNd_\302\250\334\260q\357\2049\275\251qk\343\236\305A\013\322"
+	.ascii	"\327VY)<tG\202\364\265J\234\305\303I\263\257\245\321ojZdP\372"
+	.ascii	"~\316R\375\347\3313\262\2712\252723\236\372\332\031CrpQN\372"
+	.ascii	"\036\203Y\0316\206\217\333\021\034_,\214\333\030\275FM\n\313"
+	.ascii	"\276\326\205\225\372\317\253u\276\252\276\372\376V\312\276\260"
+	.ascii	"siq\252\274Yf.,\035[lT\207\321\240\200;O1\372Z(\0377q\304hy\373"
+	.ascii	"\317;\265\354\274a#b\223u(X\034\221\272\276\307=l\256\273Uv\f"
+	.ascii	"\321\372\334\273\356D\023\206\304J\337c\033\370\330i\205\306"
+	.ascii	"s\007w\245\271\342\002g\205;p\314\034G\367\276s9\264M\322\313"
+	.ascii	"\njz\216N\236\034Y\274\372~\227\005\2772\273\316\233Nc\t\203"
+	.ascii	"\2416\347M\347\037A\242\236\001\312\033\200V\030S\346F\337\317"
+	.ascii	"\265\234\377<!5Q\330\266\310i\nM\241\311Y\315\216\303\263\023"
+	.ascii	"\247\347I\337\357\230\370;3\374FCmK\256 \243\357wKp\233\306\322"
+	.ascii	"`\2040\277r\316l\332Mev\233\016\323\246\305\364\2325\265\346"
+	.ascii	"\207\250\025\330\320{\r\326\364\231N\241\2761Qp\261\242\246\343"
+	.ascii	"*\263\327t\032\246\332\b\022\275\246\307\364[}\263Z@\333\225"
+	.ascii	"\246\220\227\222'P\320\373\035\021|\233@Q!\323p\215&\007\005"
+	.ascii	"\311\371\350\022\326\367; \370;+\334d\272Lerh3\313\241\240=c"
+	.ascii	"{\360\364\375N\211_9\240\265\256r@\277\223\302\337A\341\243t"
+	.ascii	"_\332\2552\033L{\311\322]6<I}0\346I\023L\257u\333\216J\323N\036"
+	.ascii	"\274\245\b\027\"\350=\252\245\013\227 \030lJ\326h\351->8\254"
+	.ascii	"\336\002M\372>\203\263\034UU}?w\346\021R\336\251z\223\347\304"
+	.ascii	"\363\203\213\252\237\240\331\221\003\327w\205\253\221#\305\r"
+	.ascii	"\333\331\374\345\234v\256\214\234\237D,\237\342r\266B\222@\013"
+	.ascii	"\335\031\235\237v~\316\215 \361.&\366\2349\251\363\363\272\n"
+	.ascii	"\2319(}oD\005\177\356\234\323\004\217\f5sTxrC\310\221\2767\022"
+	.ascii	"\3037R\202+h\203\373\371\006\356\224\273\370\005\335\033\025"
+	.ascii	"8?\345\316F\245\315\231-n\342\3166'\2333\315\271\346TS\302-\205"
+	.ascii	".\\\001\220\266\237e\332\3163\035r\216\252g\231\2062K]!\355\262"
+	.ascii	"\344!^\336~\236a\013\022\267\003\205\276\247\0312A@\222J\232"
+	.ascii	"\364=\275\234b\3161?\017\325Z\301i\252\357\215\206\340\237a\342"
+	.ascii	"\224!\211\353{\202\301QF=0\2702\254\320\245\271\375\004\363\240"
+	.ascii	"\253$[\\}\317/I?\335\316\035b\202\030\351\373S\213\320S\313\311"
+	.ascii	"\345\354\362\363,\220\253\032S\372\336(\006\376\271e\214IX\217"
+	.ascii	"\276\377\220\0162Jz\220\345\2347\250[P\247d\035 }\317,\274\032"
+	.ascii	"/\274\332\372\336\322\320r\321\326\367FOxC\230\232\332\271\206"
+	.ascii	"\341IU\2349\326\t\f5@N,?\327\202\346\244\274E\301\200"
+	.string	"\007oH\236\375d\236\235V\352\\]f+\254\344\234# a\3240\241\313RWHKB\200\2149\253\374\2642\246NJ[\3269\345'\225\237\267[\223F\314Y\337c@\303g\332O)?\357\354a\303MX\337c\210\202\377\023\355\347\001\r\031SfN\337c\020\303\307"
+	.ascii	"\206+Ps\364\377\204rB9\227\365,\323@\265\210D\355\241\313\331"
+	.ascii	"\n\311\347\313\0213_g\331\317e\215\203ZR\005\247\357\031\205"
+	.ascii	"\306rN3\356?\017e\023\026\344E\337c\320\302U\356\350\347\223"
+	.ascii	"\363I\2253\301\314NUH`j\240\271a\241\353\255I\337\027\315\301"
+	.ascii	">@\216~\216\235c\365\314M.3\r\fe5\242\314\241\313J\267\017Im"
+	.ascii	"J\251\276/\222\202)\250;\372\331\344lr]\\'\242\f\205V\326\226"
+	.ascii	"\225V\037N3Qd,\351\373\"&\270\202\032Gu\254\2364~\3568i\234K"
+	.ascii	"\222\236\262\023\222\016c`?\312(hN}\303\226;\031;\2560\373\276"
+	.ascii	"\210\b~%\343q\366\210\273\262Tdf~\234X\365m\210\t&c*\2353\353"
+	.ascii	",R\337\254\2102\324\332\233&\222\036c\251\266"
+	.string	"\312|}\235J\316$\247\327\331u\202U\346\211\344\fr\"9}\220\371Q3\347\365&ty\034\316\206'\251\017\242\234EN\255\223\310\017\226$N\254\350N#\347\221\312<\213<\203\007\017\032\202\360\260\241\213\202\336\377$r\016\001j\213\321\343E\337\023\205\232&F\306V\337_\240\303\377\311U\231\247\220\027I\364 \351{n\035\016\214d\f\031\357\202#\313\0232}\177a\016\377B\034\374\013hN 8M\323\307\030\374\013n\370\027\266\340_X\303\377\331\303R\245\205\251S\246\357/X\301g\216\323j\310I\233\220+}\177\352\370\317\023\241\210\231+}/\216\026\343\3655\325\367\347\r\2418$U\314\372\376\264q\245\256\316\216\276g\r\034u\201\f\003\037\037k@z\234\312\2375\376\273\347\254\002A\235\036\025\372>\256\032\241\325,\351\247\362\247\214\227fY\337_ \202+\260\322\363s\206\236s\n\311\312)\313"
+	.string	"cY\256>\370\224\261In\351\273\234JV\351\352{J\2351N\031?\217\267e\006\334U\337_\b\202\177\302\030\202\246kI\337\256\357\202\236Q?_\374\274\035\231\022\252J\337_\270\302?\241N\027?\317\352\031\263\005F\337_\270\201\177>\375\347\215\300M\220\261\276\247\023\216\272\340\002\003^\23338F\352~:\375g>\223m\203\0033zX\305\351\373f5B\205j\021z\367$\375\326\265\027S\214\230\276A\265\b\275\0057\230\203\016;v.\2368w\276|\340\314\300\236\254\360\213G\314\332\334\\\337{\347lbl\262\364\364\275t*\270a\016W\232\315[\207\001lfx_Y\346\226t~\353\324\275\311B\326\367\3169\315\270\262\240\351{\345\f\255\231\305\031\351\3739^]\2626f\245\357-L\301\034\360\274\371\233+\3279\347\374\265\233\342\025\005=\222\002\2257\027\316\257\\K\371Rc#\b\027\006"
+	.ascii	"\027\0336\267\315\007\034T\250z\242\026\307\306m\303\306\263"
+	.ascii	"2\242\354{\0138p\207\024\326"
+	.string	"\254\351\272\fd\202X!\361\2128!#\243\007k(s\364\233&\315\331L0+\030\334\021^Y\2325]}O$\007kHs\364\013w\341\220\020\225\301\024\320\035\375\236a\3363\327\005Q\214\\\225h\264\2564\233[N`}O\204\005wh\2229\231k\006\347\013T\341\031po\302\224\3715c\311\024Q\222v\345?\357\226)\261\022\322\367DK0W\f\230k\006\200$Ga\256\2300\327\f'sN.3\215*'KY\230X\266\262B\032R\323\224\022\245\357\211\220\340\023\341\300\357\322\245\353\320\234\353\022\213\2062[)\221:\264\361r\277x\351\272\232\2259[1@\212Z3[Y!\325\036I\302\210\365=\321\024\376\320\036\254\001\317\321\315R\357\226-g\273DY\306\223\330\327P\234\250\243\313V\255\026\253\345\005\232\2234Gu\254\336\265W\346]\2732\220r\256\261\200\261*\037:j^\271\357\207\324\340"
+	.string	"\244QS\353:\022O\344\fe\301'\235\243_+V\372\315\204\025VrN\2071\2633\313\216\nc}?4\005kPr\364;\345\225y\247\\\346\205\272\222t\022\245\356\211\342\202B\337Ke\206\023\nP}?\264\304\037\"\303"
+	.string	"\200;\372E;\273iU\016'\225\370JWW3+\227\037>$\004\177\210\n\003\300JY\3315#\321e\371k&D\326\245yg\316\177^\257K\021\272\276\027jb\r_\216>\324\013\005\312\273|\340"
+	.string	"-#\315\254\264\372\200\n\341\252\273\322\367B)`\rmGw\254\336'O\252\\Ub\245\333\207\035\263L\r;}/\004\006\277V9TC\225\243_1\261\312\306\0043\347\252\013\226X}"
+	.string	"\202\223\301\265\246\357\205\264\340\016TGWI\275K\230\234\355ffvq\206D\007l\n\276\220\230\206\346\321o\222$g\373 \2730\343`\211\0340\334\341\351\350C\275^w\310\375\252q73\263S\r\021t\202\b\t\301\027\332\201O(G\277]\314\333\325o7y\226i\370\274\b\022g\016]\316n\037,\21663f\337\007\301\301\024T\035\375\032a^#\367\205\225\312\331\206\001\232\230\225\205\321\215\301\022\254\035\375\022ye^\"\027\206\t\253\263\234\334a\001\263\372\260\233\023'\026\243\357\203\334p"
+	.string	"\344\270\316uQ\3009\347$Q~Zc\365%\344\027\205\013W\246&\256\312\225\241\221g\205\276\017*\303\035\274~\374\270Zf\300~\263~\265\206\262\270\260d\365\375\334\r\362\237\207\302\221I\001K\337\377\006\301:\257\250\300\f\t\223\203\264\240E\335\271@j\225\223\307\022.\205\276\017\n\202)\bs\364{\305\274W5\355\003\242\234\265\312\276\2560\005WG\327\252^\036<~\264\355\300g\253\r\225\263\323"
+	.string	"\206\270\240\304\341\350\033F \b\310aPC\013\246T\350\003~P\224\3001h\224\372\212B\026gJ\364\245\307\025'R\030\201\2510\350\301\361\350\033\341\003\305\0204\360\373u\200T\0011x\3649\022}A%_\212\342\212#\020h\\\002*\021\235P465\371z\307\342\317'\r\022\203\027\316\004b\202\022~E!\021\331\303 \024\"\211\304\"qwL\221M=b0\025\006\221$\364zB\307\024\331tY\034\213?\337\2514\f\036\357\231~D\237\221\004b0-\022\201\224\206\301c\007\240\321'\374\001\225:4\r\213D,F\020}\251\017\335\235\t\304Q(\364\375\230R\3370\304\007\212F\246\264H\334\261\360\001\2057=\022\213\277\223EJ\f\032\205h\013aSS\b+@P\021\"\005.\031}i\207\022~E\341\t\240\261xb\350L \224\202MJ\300\324gB0\375up\364]"
+	.ascii	"\250T\034\032\203\276\242\026M\305\023B\351\231@4!\213\306\245"
+	.ascii	"\236\021\230\002\207>\243\257)\304\005?\"\322\203\037\"\213>"
+	.ascii	"\217\275\245&\240\264G\\j:\211KM\026\b\202\340\361\266h*\376"
+	.ascii	"\2561m\262\017ja\354]P\002\356\224\200G\344=\356\356K}J\275\245"
+	.ascii	"&\020B=`\352\0236\r\201+\226\2324\244>$\005.d`\204\024)P\005"
+	.ascii	"r\030\264`4\026O\254\370uH\205\301\025\307\342\211\024\27044"
+	.ascii	"D\252\030\006'\020\002-\360\373\371~\200B\337O\005P\230\246E"
+	.ascii	"#Sza\b"
+	.string	"L\217-T\364\210\200F$\220\205\f;\021 R\243\257\tD\032$\202\200\034\006\2054p,\236\020\302\030\200\251/=\372\244K\276\2415\032\001\0028\f\256\250\200\004@8\"\213A\023\200\306\246\t\206\301\364\350"
+	.string	"\"\262x\342g\210T\001\034\006W\374~>\237!R\305\357\347C\177D\2008\366@\360\373\371\202~?_\357\307\002\365I\002\221\002\217,X\0245\360\373\371\200\316\004\342\3273\206\370\005\340\270\344\023z\260D\f\016\215\276\037\242\337\317g\201\251O\210\374\t}L\251\321\347\200\342\212\026J\305\006X`h,\2628\022}\306\025\310a\220C\352\223\200\361\212\360@k\340\201\036\341\201N\362@\237\0204\246>\t\244\305\024\300\024\3314\314\360_\320\b$\002\227\3607(\221A\t\016N\330\235\203\004\210H\200\b\364\034$ ))\001%\222\360K$\331\264w\004\n\227\210\035\030\201B\244\003\200J\3104\230\246>\2434M{\3064\365\025\375W\302\257\030\002r\030\fJ{\307\n"
+	.string	"\207\301\024#\207\301\237\017\370\214V(,\032/\323/\r6\235\037\360\265\260G R\3503\001=\023\210\343\321\3274,\3768\034{K\276\341y\002E\007K\276!J\f\n\177@\024\277`\n$.\371\206E\307\036p\030L\211\310\024\310a\360B\260\251\204\336\360\247\204\n}?%\340\320\350#\"{\277\237O\b(\\\"\372zB\241ox\374I\317\224\001\004\365\330\013jqB+\021}$(\371~\316\004\002(\004\n\340\330\373\375|gz&\020G)\006\224|\300\024Ec\213%\013\307\336\005%\037\006c:\002\321\003#0=\006\227\200).\200l\032\032\021="
+	.string	"\246A\343\007v\306t\204\024\310\246a\020\321\203\024x\004\032w\304b0\365\031\221KA\026\304\342\td\323\220(\r\022A z\220\006\211A\324\230\216\360#\"=P\362\001S\374~\035`8\366L"
+	.string	"\242\370\375|\230\350\201\222\017hD\323c\357\304\b\020N\214"
+	.string	"\201\207\246=\016Rb\020\271;\036\201F%%\337\3567\"h\221=\024G$\t?g\002qD\222\240\341\330\0136\251"
+	.string	"\376\202&"
+	.string	"\225~X"
+	.string	"Q"
+	.string	"\233Z\254\350\2010\202\212\037\340\217\350K\217\304 N{\023"
+	.ascii	"\341\022\203#\020\217?4\330t\264G$\t6\355\225Hz@R\357"
+	.string	"\367\363\241i\257DRJ\f\356>\340Kq\002E\007(P\251x\302\004\240\021\250\205\222\017\230\302\227\372\224x\351Pow&\020\351\017iL\217#\216\275\023\200)rh\241\204_Q\330\353\241)\021Y\374\365z;#\220\370\201b\257\267;\032\201G$\261\327\303J\304`\t\275\036z$\006\233\216\275\336\216X\f\036\203B`\257\307K{\3511($:\023\210#\260\251E\232\201\022\320\350c:f\020\342\230\006I\b\201$.ep\002\222\030\024f\260A\211^\t\016N\b\001TB\n\177\304`\b\343\021\031\002\001\351\t@\242\320G4\002Sb\260\247\344\003\032\231\322\246^o\002\023\200\306\246^\017M\217Aa\257\207\372R\237R\257\207\032}L\277\013\004A\360\330\353\241%\374\212\302\013\354\021\227\202B_O\210\270\024\024v\360\373\371pz&\020\310\246a\257hl\261\364\373\371B\034\215@\023\202F\245\002"
+	.string	"{)D\220\020Q\002\3314,\"\026\203)RX<\002\215>\307\036\006`O\005\262i\370c,\036\211\300#\232\n\221G`\nb1\230\376\200)\020\005\262ix\301\004\240\222Eb\241\317\004#0%\202\260D\f\n\233\206>\025\277\237\257(\355\215\320 %\006wLi\2618T\361\373\371x\302b\261\001\275\023\370#N =\372\200!\244\035(\001S\237RS\005\204\300\337\257\203cP\303\017\013\240R/\035:\023\210#S\352\033\206 \026\207\303\342\217\202\027\233\200\306\020i\261h\f\361\243\001\036\006j\006\252\005\252\261\230\376\200&\364\232X\364\220?\327`D\t\rJ\370\016\200"
+	.string	"\020CG"
+	.string	"\002Nt\250\200\b\017\300?\020\310a0D\312\264\024\024\262\bA\f\372\206!~\306c\b\020\023tP\377\243QN;A\313+/Z\240\344\335\214\030iM\310\314\366\314\221\222\345\311E\341\246\275\271\243\307\311e\212I{!\206\216\255\305aq\315\350\033\2001\264\t*\2066A\227|\220\245\252,Ll\002\0358"
+	.ascii	"G\302P&h\030\272\204\227\225I[\316\240K\300\224h\315\350\373"
+	.ascii	"\t\222\270\353\260\361\"\222\344\312\360@'\344\214\215\347\345"
+	.ascii	"E\n=\276\316(q\022\253\353\213v\241H\216z\035\365j\324\313\326"
+	.ascii	"\325\241PR\240\202\336\037=r.\311\326\254)\227aT\304\324\024"
+	.ascii	"9\255\354\246\320\255\325 R\343\274\250\274\346\320!W\253\207"
+	.ascii	"\232\215<}\331P!f_9g\"\2406u\2600\373^\002<\370G\271\252\034"
+	.ascii	"\256\"\367&c\013\235\021\204\343\r\2272Z0P\"[\232\304\310\222"
+	.ascii	"\363\251R'\347\r\032\004\255\341&G\327\327\202, (\026\n\344\224"
+	.ascii	"\303\3114@\276$\320B\203\206\021,\037\367E\335\236<I\372\266"
+	.ascii	"\225\345O\333\217*7\372Z \205Z\241=P+\224G\315J\016\272\230\335"
+	.ascii	"@\372\321\035Gy\260\375\200\001\303\326%\001\023\374\243"
+	.string	":\256\2139i\320\320\3458\247\352\234&@\234\372V\340\344\306\215SNL\006\316\220\3141\2029$\225J\264F%Z>\301y}\345l\205t6\203\274\341B\253\216\326\300\001\307GTK\371\252s$\331\367\022\360\300\033\334\240T(\325)W\341\306D\355\301I\263\033a}/\001\r\274\301\312\321\177\324\351(\224\023:\243\236e\032;\033a\342X\211\r\205\021\242V\207\3028:\343\250\214\372%Ie\245\357\321\030\250\324\231\347\nL\236\036}?\207\276\370\317\013z\362\343\013N\337\037}q4\352\f\224\261\233\\\356\312|\310\310\250\013\364)\017\336`E\367\363\016\035\232o\241\362\217\253\035\230\2238VtY\312\n\251\347\236\304\230\242\347h\376Y7\202\304\273\2001\223\321\243\357\317=>J\270\322\002\204,\250\303\341brD.\214a \312a\314!\306\320T\325\344\030\243\024@0HH(\030\317\366M\037\023"
+	.ascii	"\003\216m$9P\243\f*C$\"I\222\244\315}\234\203\265\316\263\032"
+	.ascii	"\303 \006\3411\377\016\266\034\033\245\257\216o\267\340?\005"
+	.ascii	"p\303\221f5\317\204:9]\310\3469\265\362$.\320\252\323\035`\006"
+	.ascii	"\001O3\235\310w\026R\354T\332\031\204\023G\007A:IK-(\177@,\332"
+	.ascii	"\352\013\334\305R$GW\331y>\02006Di\224\247\262]1\247\247w\315"
+	.ascii	"\364\272\006\"p\216zQ+cO\361\350P\177T`\220\005\365\315\252\220"
+	.ascii	"\006r\306:\212\022\222\270k\0330\353[\345\312\f\216\037\003["
+	.ascii	"\225tt\215k\367\266\027\211\t7\271\033G\203S\312\034\353\310"
+	.ascii	"\027w\035J\007\t_H-X\275O\211\332\306\353D\276\2476\212\3342"
+	.ascii	"H\265s\024\013\004\242g'\354\200\353RLL\202\177\244)R\\\355\242"
+	.ascii	"\366|\240\273K\246\244CW(\327\2071\223\352\344{\031\310\n\t^"
+	.ascii	"\314\355\005\242\223\373\262J\023\006d\037\276C\335\007P\005"
+	.ascii	"ns8w\364\30648\352\nqL\372\203J\366\201\032\323*\340C\233$\317"
+	.ascii	"\005\324hU\252\005}r\206\314I\022\352\201\211<\242\235\253\350"
+	.ascii	"\004j\324\304n\214%\350\3377:\261\336\300\313D\347\201"
+	.string	"\346\377\346\222\031\202\344\"\020\243+\331\2037T\3609S\234C+\2529C\342\257\254\356\002\001\350\352\\z\204\262\367\376\t\r\211\033\301\326\2778\335\371\026\202R\036]w-\341\333\001?!\002+C\250Q\200E\354}.r\201\013\252\313,\r\203\341O4\341\016\032\376\024\fA\357\027\334m\337\327+\352\243\307\251<\020\213K\276U$\016\257\3220\354{\255\265\226\277,\252\332\023\376J@\340\201\332s\331\326J:~\342\354\312\374\366JP\0355\214\036\357\254H\307|\231<\254g\347\223K\2739\202\016\371"
+	.string	"\204\005\021%q%\215\320\276\337\223 \251\234\240\364]*\0208\315_\200\333\353\325K\342\266\2172\321\271\363%\267\231\203W^k[(\321l\227@<jsp\300[\277\352`#K\003E\222\325|\003\236\315\203\271\344\ne:\260;\344\346\267\275\177)\374\240A\\\316e`SY\327\035\257\367k\327\001s\033\307\034`\220\020\250:\300\353Jnj\027\243\3346"
+	.ascii	"-I\031X`\346\366\200\363\030\001\226\277r\313\030\032\021A\004"
+	.ascii	"\255\341\377\001\027\231\224xE\020\302O\214\224\362\267\177D"
+	.ascii	"s\032WZ\260.#\302\245\205 \013\313\333\373s\316\205\031k\270"
+	.ascii	"\211\266C\273\323c\364\221\ry9\316\370X\\\302^\207\016"
+	.string	"\355#\253\233\321\241*4\344 \270\322\226\036\301\212\t\212\321\375gr\200\303\360\022\005\223\262U\261\020h/R\366W<\311\"$+\005\035D\213\013\337\302\020\266\375\313\300\206\365\025`\277&\263\324\327\242\244\314\336\301\026pd\300\240\326\262\360K\377p4LC\203\3108\337[8\177,\217}r\227\322\347\037\035\352&4\202nP\177\322\302wt\003\302\356\262\025\366Q\216E\317\027\202\200\333_\255*\n\325I\262@t\302\202\022\bo\r\003\230f\266\226*$\261\261\214\213\253\330\231\023n\330\022\357&s?\232<\220\024W\373Q\274a\315\361\3670@]lR\007\270\266g\220\271\217\323\237%7\204O\021+\320t8\250\363J>F\316\344\312\262\0379\217\237\302S\315\n\253]\375\017\330Y\037\321\216\377x\013\243\245\320\2472R\322\264\222\\\302%hL.\362\212\236\223\350\007\374[\377<\022>\324\246\311\023Q"
+	.string	"T\367t&V\036\227m\210e^$9\252\350\3275Q\t\217P\2503O\262\353\024\204\211\362\345\334\253?\361\302Y\205\300m\027p\223t\326rP\320\263L\264\t4/I\373C\374\243\177\374\260\204m,\023\212q\372\033\325\232\230\340\253\355}\360\231D;i\321\037h'\207bp&\331\3741FP\316\344\230)E\031\352\177\247\257\004\226?D\262\307"
+	.ascii	"\227\231\252JU\257\340\020g<\3152\320}\337\026\270\"\315\242"
+	.ascii	"\203{\301\210#\351\200L\370\352\237\226\345i\302\365M\f\322w"
+	.ascii	"\002\343\340q\262s\317\205\276>R\007jp\325<oK\232\225(hE|y\350"
+	.ascii	"'\326\331\255+;\214\200~j\271(\207\370\034\262\2317>\243\237"
+	.ascii	"\210N\325\273V#x\035\246\021\316u@ERZWj\351\243!K)e\242$\226"
+	.ascii	"e\033\251]6|\276\023\345\216\257h\b\302c*\305y't\027(.\234\353"
+	.ascii	"\n\246'k\017;P\037\375\316\320h\031AK\220\363\263\213\337(v\211"
+	.ascii	"\312\340\320\004\305\026\337!\215j\016\304#\370\376\374\324\005"
+	.ascii	"\301\317\331\214\331\004\033\304\250\241\304pX\221!\321\352|"
+	.ascii	"\316\271#,\252\317\312g\203\355*)\376\367\341K\347\314\275\027"
+	.ascii	"a\351'RF:y3^\314$\205_\260\3055\306\n\357\262(S W\270\236\016"
+	.ascii	"\277SNA\221\007\004\006\227)\032\253:\273^f\n2\351\253\270J\306"
+	.ascii	"s\253\373Y\26662\326\360\026\306t\0134\213\335\220G;!l\307\267"
+	.ascii	"\0079\31748H\312\346\220:@\037\203\267#\252\231m\311w\r\300\220"
+	.ascii	"~n\204\341\363\0351-\207\320l}\231\007n\234,\210\342\3417\253"
+	.ascii	"\275\327>\310U\252\323:\302y\016\357\353\177C\177\241O\213\347"
+	.ascii	"\371\331\313Q\227f\261!\004\306`3\254\316\346\251c\341;\244\030"
+	.ascii	"\365\247\r\004\035&\016\330yBn \260\252\371>\265<\007\346u\031"
+	.ascii	"\211\016\337\300\336\300B\242\266\314w\327\242n\252\031\021*"
+	.ascii	"\264\001/\331\274\022'\r\300sz\201\224LH\252\254\246u\305\323"
+	.ascii	"\3645\245\3375\307C\177\307^RN)63\373\231\030!\340\\\"\214\013"
+	.ascii	"x\276\257\214\353\024c\376\346pb\376\005\262\007\275=\223\266"
+	.ascii	"#d\356\357e\0305\036\225q\247p\3621\2110=\212\345\263\027\036"
+	.ascii	"\274L\322\202\345\213\277\r\0214\265dZjH\274\234Zcs\321\310\r"
+	.ascii	"{\226~\034\315F\036\340\376\335 \030\267P\266\022m\346\234Ko"
+	.ascii	"\226\360\030\347\265\370\325\t\3465\302\274\356\237\306A\257"
+	.ascii	"\216\2676\226\333\337\026\017\037\354{\363\025\016)\264\221\210"
+	.ascii	"\271\273t\326\362\372\177FGy\353\210\347\323\373\004c\007\256"
+	.ascii	"\272\206\177n\347N\177\356/\013"
+	.string	"Bb\351\3108\374;\357\360b\332\f(\033\300\026\212\254\326_;\203\324p\364\"\033\314`f\231\024W\252\275|\022+\207]\n\006\251\260\3711\357\252\nl%\340\210\361\254\213\221~\223\236\027\236\031\233W}\230\304\375\237\t\233\260\263\354s\224J\247\304c\024<:\215q\204\177`\333b\261\214X\212\332\2502E&w\346\201\374\237\266\"\270W\243\302\257<\033u\206Y_j\002~##\034>q\025N\243\240%\273\234\241\305\331\273k\220\217\325\215\306#\316\250\327\214i\002\214\205\212\207[\200\234G\315[\r\032\r,z\304\2616\240\255\265\301\367\005\330\001\270$I\316\241\253\2466\245V\326X\037\245\241(;w\236H\315YF81\207Y\350\347hp\347J\224`\346\302.\2040@\221\207B2\334%\343%>\364chc\b|C=\361\252,\0341\243\017G\316\216+vY\324IC\231\220\f%\344\035"
+	.string	"\360[\246]\221\345<\257J\263a\033\016\243\017\373\230)$\323\363\272\360\024\261*\271\301\237\364\260]/axs))\257 \264T\372\254\\4\222\016\364\204\034\002\221\306\244:\262E5\210v2\2278\263k\034\177\212\341\252\264\250]j\345\227\365\253,\216\375\2002\322\363D\247\200\270\303@p\013\235V\301\203+\277\032\344l\355\376\202\310\216\317\332\217S\341\223\270\305$g\367\364ai\214\325\261\321\3026{\177\312\377;\206\307\030\275\262\020g\304\361\367\217\213\177\263\0338$`\032\245\364\317\370\232\224\273\345L\242=\305>rk\221\275\363\037z\020\335\241\323$\213\1770\312\025\216\354\025\337'\344j\310G\252^ba\232\255v\330\372\201\352\001\307\016"
+	.ascii	"$\023\300\177\277\264W\363\254\375~Q~\273\343\361\311\3179:\371"
+	.ascii	"\347\305\244\217&\017\025\333s\276\343~CB]\253\236_\037\215\324"
+	.ascii	"\220'Xs+\2619\375\r\017\020\017\275yg;\375\312y2\344\030\002"
+	.ascii	"3\177\3342=\250\371\216\362\262\203\207%\327\242\315\b\332\365"
+	.ascii	"\366V\313m\374\007\264\357\207\2542\237\321\263\036\304\035\242"
+	.ascii	"\263G?\304\266\346\367\345\n\032NFf\331\360G\301G\321\013\210"
+	.ascii	"Se;\316g\311+\202\373f\267\276[i~\023\264\265\200\224\316B\375"
+	.ascii	"\265\327\210?\305\326\235]\3068[4"
+	.text
+	.section	.gnu.lto_.symtab.a28507c76e004810,"e",@progbits
+	.string	"accSum"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"atan2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"acosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a28507c76e004810,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18859 @@
+	.file	"mixer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/timer.h"
+	.file 10 "./src/main/drivers/pwm_output.h"
+	.file 11 "./src/main/common/time.h"
+	.file 12 "./src/main/drivers/resource.h"
+	.file 13 "./src/main/fc/config.h"
+	.file 14 "./src/main/flight/pid.h"
+	.file 15 "./src/main/fc/rc_controls.h"
+	.file 16 "./src/main/fc/rc_modes.h"
+	.file 17 "./src/main/fc/runtime_config.h"
+	.file 18 "./src/main/flight/mixer.h"
+	.file 19 "./src/main/rx/rx.h"
+	.file 20 "./src/main/flight/mixer.c"
+	.file 21 "./src/main/sensors/battery.h"
+	.file 22 "./src/main/flight/failsafe.h"
+	.file 23 "./src/main/drivers/time.h"
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 25 "/usr/include/string.h"
+	.file 26 "./src/main/fc/fc_core.h"
+	.file 27 "./src/main/config/feature.h"
+	.file 28 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	mixer.c.335bc614
+	.weak	mixer.c.335bc614
+mixer.c.335bc614:
+	.long	0x168c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x28
+	.long	.LASF2536
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2087
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2088
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2089
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2090
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2091
+	.uleb128 0x4
+	.long	.LASF2092
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2093
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2094
+	.uleb128 0x4
+	.long	.LASF2095
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2096
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2097
+	.uleb128 0x2a
+	.byte	0x8
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2098
+	.uleb128 0x4
+	.long	.LASF2099
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF2100
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF2101
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF2102
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF2103
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2104
+	.uleb128 0x6
+	.long	0xcf
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2105
+	.uleb128 0x1a
+	.long	.LASF2394
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb7
+	.uleb128 0x2b
+	.byte	0x8
+	.byte	0x5
+	.byte	0xbe
+	.byte	0x9
+	.long	0x105
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0x5
+	.byte	0xc0
+	.byte	0xb
+	.long	0x8a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2106
+	.byte	0x5
+	.byte	0xc1
+	.byte	0x3
+	.long	0xee
+	.uleb128 0x8
+	.long	0xcf
+	.long	0x121
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x7
+	.byte	0x1d
+	.long	0x13f
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0xcf
+	.uleb128 0x8
+	.long	0xcf
+	.long	0x154
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2110
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x187
+	.uleb128 0x13
+	.long	.LASF2111
+	.value	0xfff
+	.uleb128 0x13
+	.long	.LASF2112
+	.value	0xf000
+	.uleb128 0x13
+	.long	.LASF2113
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2115
+	.byte	0x6
+	.byte	0x29
+	.byte	0xf
+	.long	0x193
+	.uleb128 0x2c
+	.long	0x1a3
+	.uleb128 0xc
+	.long	0x8a
+	.uleb128 0xc
+	.long	0x70
+	.byte	0
+	.uleb128 0x2d
+	.byte	0x8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x5
+	.long	0x1c2
+	.uleb128 0x22
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x22
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x1c2
+	.byte	0
+	.uleb128 0xb
+	.long	0x187
+	.uleb128 0xe
+	.long	.LASF2133
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2b
+	.long	0x222
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x154
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x222
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x222
+	.byte	0x10
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x30
+	.byte	0xf
+	.long	0x227
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x6
+	.byte	0x34
+	.byte	0x7
+	.long	0x1a3
+	.byte	0x20
+	.byte	0
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0xb
+	.long	0x222
+	.uleb128 0x4
+	.long	.LASF2121
+	.byte	0x6
+	.byte	0x35
+	.byte	0x3
+	.long	0x1c7
+	.uleb128 0x6
+	.long	0x22c
+	.uleb128 0x4
+	.long	.LASF2122
+	.byte	0x8
+	.byte	0x18
+	.byte	0x11
+	.long	0x9f
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x9
+	.byte	0x39
+	.long	0x28b
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2132
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x249
+	.uleb128 0xb
+	.long	0x105
+	.uleb128 0xe
+	.long	.LASF2134
+	.byte	0x18
+	.byte	0x9
+	.byte	0x5a
+	.long	0x2ea
+	.uleb128 0x11
+	.string	"tim"
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x12
+	.long	0x297
+	.byte	0
+	.uleb128 0x11
+	.string	"tag"
+	.byte	0x9
+	.byte	0x5c
+	.byte	0xd
+	.long	0x23d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x16
+	.long	0x28b
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2138
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x3
+	.long	0x29c
+	.uleb128 0x6
+	.long	0x2ea
+	.uleb128 0x8
+	.long	0x2f6
+	.long	0x306
+	.uleb128 0x23
+	.byte	0
+	.uleb128 0x6
+	.long	0x2fb
+	.uleb128 0x5
+	.long	.LASF2268
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x1e
+	.long	0x306
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xa
+	.byte	0x40
+	.long	0x347
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x5
+	.byte	0
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2145
+	.uleb128 0x6
+	.long	0x347
+	.uleb128 0xe
+	.long	.LASF2146
+	.byte	0x12
+	.byte	0xa
+	.byte	0x8e
+	.long	0x3a1
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0xa
+	.byte	0x8f
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0xa
+	.byte	0x90
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0xa
+	.byte	0x91
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0xa
+	.byte	0x92
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0xa
+	.byte	0x93
+	.byte	0xd
+	.long	0x3a1
+	.byte	0x5
+	.byte	0
+	.uleb128 0x8
+	.long	0x23d
+	.long	0x3b1
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2152
+	.byte	0xa
+	.byte	0x94
+	.byte	0x3
+	.long	0x353
+	.uleb128 0x4
+	.long	.LASF2153
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2154
+	.byte	0xb
+	.byte	0x21
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xc
+	.byte	0x14
+	.long	0x4fb
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2159
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xd
+	.byte	0x22
+	.long	0x5d7
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x80
+	.uleb128 0x13
+	.long	.LASF2209
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF2210
+	.value	0x200
+	.uleb128 0x13
+	.long	.LASF2211
+	.value	0x400
+	.uleb128 0x13
+	.long	.LASF2212
+	.value	0x1000
+	.uleb128 0x13
+	.long	.LASF2213
+	.value	0x2000
+	.uleb128 0x13
+	.long	.LASF2214
+	.value	0x4000
+	.uleb128 0x13
+	.long	.LASF2215
+	.value	0x8000
+	.uleb128 0xd
+	.long	.LASF2216
+	.long	0x10000
+	.uleb128 0xd
+	.long	.LASF2217
+	.long	0x20000
+	.uleb128 0xd
+	.long	.LASF2218
+	.long	0x40000
+	.uleb128 0xd
+	.long	.LASF2219
+	.long	0x80000
+	.uleb128 0xd
+	.long	.LASF2220
+	.long	0x100000
+	.uleb128 0xd
+	.long	.LASF2221
+	.long	0x200000
+	.uleb128 0xd
+	.long	.LASF2222
+	.long	0x400000
+	.uleb128 0xd
+	.long	.LASF2223
+	.long	0x800000
+	.uleb128 0xd
+	.long	.LASF2224
+	.long	0x2000000
+	.uleb128 0xd
+	.long	.LASF2225
+	.long	0x4000000
+	.uleb128 0xd
+	.long	.LASF2226
+	.long	0x8000000
+	.uleb128 0xd
+	.long	.LASF2227
+	.long	0x10000000
+	.uleb128 0xd
+	.long	.LASF2228
+	.long	0x20000000
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2229
+	.byte	0x4c
+	.byte	0xe
+	.byte	0x4a
+	.long	0x750
+	.uleb128 0x11
+	.string	"pid"
+	.byte	0xe
+	.byte	0x4b
+	.byte	0xc
+	.long	0xc64
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0xe
+	.byte	0x4d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0xe
+	.byte	0x4e
+	.byte	0xe
+	.long	0xab
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0xe
+	.byte	0x4f
+	.byte	0xe
+	.long	0xab
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0xe
+	.byte	0x50
+	.byte	0xe
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0xe
+	.byte	0x51
+	.byte	0xe
+	.long	0xab
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2235
+	.byte	0xe
+	.byte	0x52
+	.byte	0xd
+	.long	0x9f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2236
+	.byte	0xe
+	.byte	0x53
+	.byte	0xe
+	.long	0xab
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2237
+	.byte	0xe
+	.byte	0x54
+	.byte	0xe
+	.long	0xab
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0xe
+	.byte	0x55
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0xe
+	.byte	0x56
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0xe
+	.byte	0x57
+	.byte	0xd
+	.long	0x9f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0xe
+	.byte	0x58
+	.byte	0xd
+	.long	0x9f
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0xe
+	.byte	0x59
+	.byte	0xd
+	.long	0x9f
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0xe
+	.byte	0x5b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0xe
+	.byte	0x5c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0xe
+	.byte	0x5f
+	.byte	0xe
+	.long	0xab
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0xe
+	.byte	0x60
+	.byte	0xe
+	.long	0xab
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0xe
+	.byte	0x61
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0xe
+	.byte	0x62
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0xe
+	.byte	0x63
+	.byte	0xe
+	.long	0xab
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0xe
+	.byte	0x64
+	.byte	0xe
+	.long	0xab
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0xe
+	.byte	0x65
+	.byte	0xe
+	.long	0xab
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2252
+	.byte	0xe
+	.byte	0x66
+	.byte	0xe
+	.long	0xab
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0xe
+	.byte	0x67
+	.byte	0xe
+	.long	0xab
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2254
+	.byte	0xe
+	.byte	0x68
+	.byte	0xd
+	.long	0x9f
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0xe
+	.byte	0x69
+	.byte	0xd
+	.long	0x9f
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0xe
+	.byte	0x6a
+	.byte	0x18
+	.long	0xc1e
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	0x5d7
+	.uleb128 0x24
+	.long	.LASF2318
+	.long	0x30
+	.byte	0xf
+	.byte	0x18
+	.long	0x7ad
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x1
+	.uleb128 0x2e
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2269
+	.byte	0xf
+	.byte	0x4f
+	.byte	0xe
+	.long	0x111
+	.uleb128 0xe
+	.long	.LASF2270
+	.byte	0x8
+	.byte	0xf
+	.byte	0x5b
+	.long	0x7fa
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0xf
+	.byte	0x5c
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0xf
+	.byte	0x5d
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2273
+	.byte	0xf
+	.byte	0x5e
+	.byte	0xe
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2274
+	.byte	0xf
+	.byte	0x5f
+	.byte	0xe
+	.long	0xab
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2275
+	.byte	0xf
+	.byte	0x60
+	.byte	0x3
+	.long	0x7b9
+	.uleb128 0x6
+	.long	0x7fa
+	.uleb128 0x5
+	.long	.LASF2276
+	.byte	0xf
+	.byte	0x62
+	.byte	0x19
+	.long	0x7fa
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x10
+	.byte	0x18
+	.long	0x907
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x25
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x11
+	.byte	0x15
+	.long	0x91f
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2317
+	.byte	0x11
+	.byte	0x1a
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x24
+	.long	.LASF2319
+	.long	0x30
+	.byte	0x12
+	.byte	0x24
+	.long	0x9d7
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2346
+	.byte	0x12
+	.byte	0x40
+	.byte	0x3
+	.long	0x92b
+	.uleb128 0xe
+	.long	.LASF2347
+	.byte	0x10
+	.byte	0x12
+	.byte	0x43
+	.long	0xa24
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x12
+	.byte	0x44
+	.byte	0xb
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x12
+	.byte	0x45
+	.byte	0xb
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x12
+	.byte	0x46
+	.byte	0xb
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x11
+	.string	"yaw"
+	.byte	0x12
+	.byte	0x47
+	.byte	0xb
+	.long	0xcf
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2351
+	.byte	0x12
+	.byte	0x48
+	.byte	0x3
+	.long	0x9e3
+	.uleb128 0x6
+	.long	0xa24
+	.uleb128 0x8
+	.long	0xa24
+	.long	0xa45
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2352
+	.byte	0x12
+	.byte	0x4a
+	.byte	0x15
+	.long	0xa35
+	.uleb128 0x5
+	.long	.LASF2353
+	.byte	0x12
+	.byte	0x4a
+	.byte	0x4b
+	.long	0xa35
+	.uleb128 0xe
+	.long	.LASF2354
+	.byte	0x10
+	.byte	0x12
+	.byte	0x4d
+	.long	0xa91
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x12
+	.byte	0x4f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0x12
+	.byte	0x50
+	.byte	0x19
+	.long	0xa91
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0xa30
+	.uleb128 0x4
+	.long	.LASF2358
+	.byte	0x12
+	.byte	0x51
+	.byte	0x3
+	.long	0xa5d
+	.uleb128 0x6
+	.long	0xa96
+	.uleb128 0xe
+	.long	.LASF2359
+	.byte	0x2
+	.byte	0x12
+	.byte	0x53
+	.long	0xace
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x12
+	.byte	0x54
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2360
+	.byte	0x12
+	.byte	0x55
+	.byte	0x9
+	.long	0x347
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2361
+	.byte	0x12
+	.byte	0x56
+	.byte	0x3
+	.long	0xaa7
+	.uleb128 0x6
+	.long	0xace
+	.uleb128 0x5
+	.long	.LASF2362
+	.byte	0x12
+	.byte	0x58
+	.byte	0x16
+	.long	0xace
+	.uleb128 0x5
+	.long	.LASF2363
+	.byte	0x12
+	.byte	0x58
+	.byte	0x3f
+	.long	0xace
+	.uleb128 0xe
+	.long	.LASF2364
+	.byte	0x1a
+	.byte	0x12
+	.byte	0x5a
+	.long	0xb45
+	.uleb128 0x11
+	.string	"dev"
+	.byte	0x12
+	.byte	0x5b
+	.byte	0x16
+	.long	0x3b1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2365
+	.byte	0x12
+	.byte	0x5c
+	.byte	0xe
+	.long	0xab
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2366
+	.byte	0x12
+	.byte	0x5d
+	.byte	0xe
+	.long	0xab
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0x12
+	.byte	0x5e
+	.byte	0xe
+	.long	0xab
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2368
+	.byte	0x12
+	.byte	0x5f
+	.byte	0xe
+	.long	0xab
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2369
+	.byte	0x12
+	.byte	0x60
+	.byte	0x3
+	.long	0xaf7
+	.uleb128 0x6
+	.long	0xb45
+	.uleb128 0x5
+	.long	.LASF2370
+	.byte	0x12
+	.byte	0x62
+	.byte	0x16
+	.long	0xb45
+	.uleb128 0x5
+	.long	.LASF2371
+	.byte	0x12
+	.byte	0x62
+	.byte	0x3f
+	.long	0xb45
+	.uleb128 0x8
+	.long	0xaa2
+	.long	0xb79
+	.uleb128 0x23
+	.byte	0
+	.uleb128 0x6
+	.long	0xb6e
+	.uleb128 0x5
+	.long	.LASF2372
+	.byte	0x12
+	.byte	0x68
+	.byte	0x16
+	.long	0xb79
+	.uleb128 0x8
+	.long	0xcf
+	.long	0xb9a
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2357
+	.byte	0x12
+	.byte	0x69
+	.byte	0xe
+	.long	0xb8a
+	.uleb128 0x5
+	.long	.LASF2373
+	.byte	0x12
+	.byte	0x6a
+	.byte	0xe
+	.long	0xb8a
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xe
+	.byte	0x25
+	.long	0xc00
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0xa
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xe
+	.byte	0x3e
+	.long	0xc1e
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2388
+	.byte	0xe
+	.byte	0x42
+	.byte	0x3
+	.long	0xc00
+	.uleb128 0xe
+	.long	.LASF2389
+	.byte	0x3
+	.byte	0xe
+	.byte	0x44
+	.long	0xc58
+	.uleb128 0x11
+	.string	"P"
+	.byte	0xe
+	.byte	0x45
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x11
+	.string	"I"
+	.byte	0xe
+	.byte	0x46
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x11
+	.string	"D"
+	.byte	0xe
+	.byte	0x47
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2390
+	.byte	0xe
+	.byte	0x48
+	.byte	0x3
+	.long	0xc2a
+	.uleb128 0x8
+	.long	0xc58
+	.long	0xc74
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2391
+	.byte	0xe
+	.byte	0x78
+	.byte	0xe
+	.long	0x144
+	.uleb128 0x5
+	.long	.LASF2392
+	.byte	0xe
+	.byte	0x78
+	.byte	0x1c
+	.long	0x144
+	.uleb128 0x5
+	.long	.LASF2393
+	.byte	0xe
+	.byte	0x78
+	.byte	0x2a
+	.long	0x144
+	.uleb128 0x1a
+	.long	.LASF2395
+	.byte	0xe
+	.byte	0x79
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x8
+	.long	0x93
+	.long	0xcb4
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2396
+	.byte	0x13
+	.byte	0x4f
+	.byte	0x10
+	.long	0xca4
+	.uleb128 0xe
+	.long	.LASF2397
+	.byte	0x2c
+	.byte	0x13
+	.byte	0x75
+	.long	0xe12
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0x13
+	.byte	0x76
+	.byte	0xd
+	.long	0xe12
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2399
+	.byte	0x13
+	.byte	0x77
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2400
+	.byte	0x13
+	.byte	0x78
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2401
+	.byte	0x13
+	.byte	0x79
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0x13
+	.byte	0x7a
+	.byte	0xd
+	.long	0x9f
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2403
+	.byte	0x13
+	.byte	0x7b
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2404
+	.byte	0x13
+	.byte	0x7c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2405
+	.byte	0x13
+	.byte	0x7d
+	.byte	0xd
+	.long	0x23d
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2406
+	.byte	0x13
+	.byte	0x7e
+	.byte	0xd
+	.long	0x23d
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2407
+	.byte	0x13
+	.byte	0x7f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0x13
+	.byte	0x80
+	.byte	0xd
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0x13
+	.byte	0x81
+	.byte	0xd
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0x13
+	.byte	0x82
+	.byte	0xd
+	.long	0x9f
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0x13
+	.byte	0x83
+	.byte	0xd
+	.long	0x9f
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2412
+	.byte	0x13
+	.byte	0x84
+	.byte	0xe
+	.long	0xab
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2413
+	.byte	0x13
+	.byte	0x85
+	.byte	0xe
+	.long	0xab
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2414
+	.byte	0x13
+	.byte	0x86
+	.byte	0xe
+	.long	0xab
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2415
+	.byte	0x13
+	.byte	0x87
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2416
+	.byte	0x13
+	.byte	0x88
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2417
+	.byte	0x13
+	.byte	0x89
+	.byte	0xd
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0x13
+	.byte	0x8a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2419
+	.byte	0x13
+	.byte	0x8b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0x13
+	.byte	0x8c
+	.byte	0xe
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2421
+	.byte	0x13
+	.byte	0x8e
+	.byte	0xe
+	.long	0xab
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2422
+	.byte	0x13
+	.byte	0x8f
+	.byte	0xe
+	.long	0xab
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x9f
+	.long	0xe22
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2423
+	.byte	0x13
+	.byte	0x90
+	.byte	0x3
+	.long	0xcc0
+	.uleb128 0x6
+	.long	0xe22
+	.uleb128 0x5
+	.long	.LASF2424
+	.byte	0x13
+	.byte	0x92
+	.byte	0x13
+	.long	0xe22
+	.uleb128 0x5
+	.long	.LASF2425
+	.byte	0x14
+	.byte	0x39
+	.byte	0x1c
+	.long	0xada
+	.uleb128 0x16
+	.long	0xadf
+	.byte	0x39
+	.byte	0x47
+	.uleb128 0x16
+	.long	0xaeb
+	.byte	0x39
+	.byte	0x69
+	.uleb128 0x5
+	.long	.LASF2426
+	.byte	0x14
+	.byte	0x39
+	.byte	0x95
+	.long	0x238
+	.uleb128 0x1f
+	.long	0xe59
+	.byte	0xbe
+	.uleb128 0x2f
+	.long	0xe3f
+	.byte	0x3e
+	.byte	0x15
+	.uleb128 0x16
+	.long	0xb56
+	.byte	0x43
+	.byte	0x43
+	.uleb128 0x16
+	.long	0xb62
+	.byte	0x43
+	.byte	0x65
+	.uleb128 0x5
+	.long	.LASF2427
+	.byte	0x14
+	.byte	0x43
+	.byte	0x91
+	.long	0x238
+	.uleb128 0x1f
+	.long	0xe80
+	.byte	0xba
+	.uleb128 0x16
+	.long	0xa45
+	.byte	0x68
+	.byte	0xe
+	.uleb128 0x16
+	.long	0xa51
+	.byte	0x68
+	.byte	0x3d
+	.uleb128 0x5
+	.long	.LASF2428
+	.byte	0x14
+	.byte	0x68
+	.byte	0x77
+	.long	0x238
+	.uleb128 0x1f
+	.long	0xea0
+	.byte	0xa5
+	.uleb128 0x7
+	.long	.LASF2355
+	.byte	0x73
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x7
+	.long	.LASF2429
+	.byte	0x74
+	.byte	0xe
+	.long	0xcf
+	.uleb128 0x16
+	.long	0xb9a
+	.byte	0x76
+	.byte	0x7
+	.uleb128 0x16
+	.long	0xba6
+	.byte	0x77
+	.byte	0x7
+	.uleb128 0x1a
+	.long	.LASF2430
+	.byte	0x14
+	.byte	0x79
+	.byte	0xd
+	.long	0x9d7
+	.uleb128 0x7
+	.long	.LASF2431
+	.byte	0x7a
+	.byte	0x15
+	.long	0xa35
+	.uleb128 0xe
+	.long	.LASF2432
+	.byte	0xc0
+	.byte	0x14
+	.byte	0x7d
+	.long	0xf2e
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x14
+	.byte	0x7e
+	.byte	0xb
+	.long	0xb8a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x14
+	.byte	0x7f
+	.byte	0xb
+	.long	0xb8a
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x14
+	.byte	0x80
+	.byte	0xb
+	.long	0xb8a
+	.byte	0x60
+	.uleb128 0x11
+	.string	"yaw"
+	.byte	0x14
+	.byte	0x81
+	.byte	0xb
+	.long	0xb8a
+	.byte	0x90
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2433
+	.byte	0x14
+	.byte	0x82
+	.byte	0x3
+	.long	0xeed
+	.uleb128 0x7
+	.long	.LASF2434
+	.byte	0x84
+	.byte	0x14
+	.long	0xf2e
+	.uleb128 0x7
+	.long	.LASF2435
+	.byte	0x85
+	.byte	0xc
+	.long	0x347
+	.uleb128 0x1a
+	.long	.LASF2236
+	.byte	0x14
+	.byte	0x87
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x1a
+	.long	.LASF2237
+	.byte	0x14
+	.byte	0x88
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x8
+	.long	0xa30
+	.long	0xf78
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	0xf68
+	.uleb128 0x7
+	.long	.LASF2436
+	.byte	0x8b
+	.byte	0x1b
+	.long	0xf78
+	.uleb128 0x8
+	.long	0xa30
+	.long	0xf98
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0xf88
+	.uleb128 0x7
+	.long	.LASF2437
+	.byte	0x92
+	.byte	0x1b
+	.long	0xf98
+	.uleb128 0x7
+	.long	.LASF2438
+	.byte	0x98
+	.byte	0x1b
+	.long	0xf78
+	.uleb128 0x8
+	.long	0xa30
+	.long	0xfc3
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	0xfb3
+	.uleb128 0x7
+	.long	.LASF2439
+	.byte	0xa0
+	.byte	0x1b
+	.long	0xfc3
+	.uleb128 0x7
+	.long	.LASF2440
+	.byte	0xa8
+	.byte	0x1b
+	.long	0xf78
+	.uleb128 0x8
+	.long	0xa30
+	.long	0xfee
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	0xfde
+	.uleb128 0x7
+	.long	.LASF2441
+	.byte	0xb1
+	.byte	0x1b
+	.long	0xfee
+	.uleb128 0x7
+	.long	.LASF2442
+	.byte	0xbb
+	.byte	0x1b
+	.long	0xfee
+	.uleb128 0x7
+	.long	.LASF2443
+	.byte	0xc4
+	.byte	0x1b
+	.long	0xfee
+	.uleb128 0x7
+	.long	.LASF2444
+	.byte	0xcc
+	.byte	0x1b
+	.long	0xfee
+	.uleb128 0x8
+	.long	0xa30
+	.long	0x102f
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	0x101f
+	.uleb128 0x7
+	.long	.LASF2445
+	.byte	0xde
+	.byte	0x1b
+	.long	0x102f
+	.uleb128 0x7
+	.long	.LASF2446
+	.byte	0xe9
+	.byte	0x1b
+	.long	0x102f
+	.uleb128 0x7
+	.long	.LASF2447
+	.byte	0xf4
+	.byte	0x1b
+	.long	0x102f
+	.uleb128 0x3
+	.long	.LASF2448
+	.value	0x104
+	.byte	0x1b
+	.long	0xf78
+	.uleb128 0x3
+	.long	.LASF2449
+	.value	0x10b
+	.byte	0x1b
+	.long	0xf78
+	.uleb128 0x3
+	.long	.LASF2450
+	.value	0x113
+	.byte	0x1b
+	.long	0xfc3
+	.uleb128 0x8
+	.long	0xa30
+	.long	0x1089
+	.uleb128 0x9
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1079
+	.uleb128 0x3
+	.long	.LASF2451
+	.value	0x11b
+	.byte	0x1b
+	.long	0x1089
+	.uleb128 0x3
+	.long	.LASF2452
+	.value	0x11f
+	.byte	0x1b
+	.long	0xf78
+	.uleb128 0x8
+	.long	0xaa2
+	.long	0x10b6
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.long	0x10a6
+	.uleb128 0x30
+	.long	0xb7e
+	.byte	0x14
+	.value	0x127
+	.byte	0xf
+	.long	0x10b6
+	.uleb128 0x3
+	.long	.LASF2453
+	.value	0x147
+	.byte	0xe
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2454
+	.value	0x147
+	.byte	0x21
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2455
+	.value	0x147
+	.byte	0x36
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2456
+	.value	0x148
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2457
+	.value	0x148
+	.byte	0x18
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2458
+	.value	0x149
+	.byte	0xe
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2459
+	.value	0x149
+	.byte	0x26
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2460
+	.value	0x149
+	.byte	0x43
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2348
+	.value	0x218
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2461
+	.value	0x219
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2462
+	.value	0x219
+	.byte	0x17
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2463
+	.value	0x21a
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x17
+	.long	.LASF2464
+	.value	0x21b
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x31
+	.long	.LASF2475
+	.byte	0x18
+	.value	0x13d
+	.byte	0x11
+	.long	0x83
+	.long	0x117b
+	.uleb128 0xc
+	.long	0xcf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2465
+	.byte	0x15
+	.byte	0x44
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x18
+	.long	.LASF2466
+	.byte	0x10
+	.byte	0x69
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x18
+	.long	.LASF2467
+	.byte	0x16
+	.byte	0x55
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x18
+	.long	.LASF2468
+	.byte	0xa
+	.byte	0xa3
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x1b
+	.long	.LASF2469
+	.byte	0x17
+	.byte	0x18
+	.long	0x11bc
+	.uleb128 0xc
+	.long	0x3c9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2470
+	.byte	0xa
+	.byte	0xba
+	.long	0x11cd
+	.uleb128 0xc
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2471
+	.byte	0x17
+	.byte	0x19
+	.long	0x11de
+	.uleb128 0xc
+	.long	0x3bd
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2472
+	.byte	0xa
+	.byte	0xbb
+	.long	0x11ef
+	.uleb128 0xc
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2473
+	.byte	0xa
+	.byte	0xb9
+	.long	0x1205
+	.uleb128 0xc
+	.long	0x9f
+	.uleb128 0xc
+	.long	0xcf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2474
+	.byte	0xa
+	.byte	0xc3
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x25
+	.long	.LASF2476
+	.byte	0x19
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0x1231
+	.uleb128 0xc
+	.long	0x8a
+	.uleb128 0xc
+	.long	0x70
+	.uleb128 0xc
+	.long	0xc3
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2477
+	.byte	0x1a
+	.byte	0x35
+	.byte	0x5
+	.long	0x347
+	.uleb128 0x25
+	.long	.LASF2478
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x5
+	.long	0x347
+	.long	0x1253
+	.uleb128 0xc
+	.long	0xb7
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2479
+	.value	0x2b7
+	.byte	0xa
+	.long	0xab
+	.long	0x127c
+	.uleb128 0x14
+	.long	.LASF2482
+	.value	0x2b7
+	.byte	0x27
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2480
+	.value	0x2b9
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2481
+	.value	0x2a1
+	.byte	0x7
+	.long	0xcf
+	.long	0x12a5
+	.uleb128 0x14
+	.long	.LASF2480
+	.value	0x2a1
+	.byte	0x27
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF2482
+	.value	0x2a3
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2492
+	.value	0x268
+	.long	0x135b
+	.uleb128 0x14
+	.long	.LASF2239
+	.value	0x268
+	.byte	0x17
+	.long	0x9f
+	.uleb128 0x3
+	.long	.LASF2483
+	.value	0x26f
+	.byte	0xb
+	.long	0xb8a
+	.uleb128 0x3
+	.long	.LASF2484
+	.value	0x272
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2485
+	.value	0x275
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2486
+	.value	0x277
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2487
+	.value	0x279
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2488
+	.value	0x27d
+	.byte	0xb
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2489
+	.value	0x27d
+	.byte	0x1c
+	.long	0xcf
+	.uleb128 0x19
+	.long	0x132e
+	.uleb128 0xa
+	.string	"i"
+	.value	0x27e
+	.byte	0xe
+	.long	0x70
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"mix"
+	.value	0x27f
+	.byte	0x15
+	.long	0xd6
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x134c
+	.uleb128 0x3
+	.long	.LASF2490
+	.value	0x28c
+	.byte	0x15
+	.long	0xd6
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x28d
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x3
+	.long	.LASF2491
+	.value	0x296
+	.byte	0x19
+	.long	0xd6
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2493
+	.value	0x247
+	.long	0x13e5
+	.uleb128 0x14
+	.long	.LASF2483
+	.value	0x247
+	.byte	0x1d
+	.long	0x13f
+	.uleb128 0x3
+	.long	.LASF2494
+	.value	0x251
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2495
+	.value	0x252
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2496
+	.value	0x254
+	.byte	0xf
+	.long	0x34e
+	.uleb128 0x3
+	.long	.LASF2497
+	.value	0x255
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2498
+	.value	0x257
+	.byte	0xf
+	.long	0x34e
+	.uleb128 0x3
+	.long	.LASF2499
+	.value	0x25a
+	.byte	0xf
+	.long	0x34e
+	.uleb128 0x19
+	.long	0x13ca
+	.uleb128 0xa
+	.string	"i"
+	.value	0x24a
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x25e
+	.byte	0xe
+	.long	0x70
+	.uleb128 0xf
+	.uleb128 0x3
+	.long	.LASF2500
+	.value	0x25f
+	.byte	0xf
+	.long	0xcf
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2501
+	.value	0x21d
+	.long	0x1409
+	.uleb128 0x3
+	.long	.LASF2502
+	.value	0x21f
+	.byte	0x15
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF2503
+	.value	0x220
+	.byte	0xb
+	.long	0xcf
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2504
+	.value	0x212
+	.uleb128 0x21
+	.long	.LASF2505
+	.value	0x20b
+	.uleb128 0x32
+	.long	.LASF2534
+	.byte	0x14
+	.value	0x201
+	.byte	0xd
+	.long	0x143d
+	.uleb128 0x33
+	.string	"mc"
+	.byte	0x14
+	.value	0x201
+	.byte	0x24
+	.long	0x93
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x204
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2506
+	.value	0x1f5
+	.long	0x1455
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1f9
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2507
+	.value	0x1ed
+	.long	0x146d
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1f0
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2508
+	.value	0x1dc
+	.long	0x149d
+	.uleb128 0x3
+	.long	.LASF2509
+	.value	0x1de
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0x3
+	.long	.LASF2510
+	.value	0x1df
+	.byte	0x11
+	.long	0xd6
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1e3
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2511
+	.value	0x1ba
+	.long	0x14dd
+	.uleb128 0x14
+	.long	.LASF2512
+	.value	0x1ba
+	.byte	0x17
+	.long	0x70
+	.uleb128 0x14
+	.long	.LASF2513
+	.value	0x1ba
+	.byte	0x2c
+	.long	0x14dd
+	.uleb128 0x19
+	.long	0x14d0
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1bf
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1c5
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xa24
+	.uleb128 0x15
+	.long	.LASF2514
+	.value	0x192
+	.long	0x151a
+	.uleb128 0x19
+	.long	0x14fd
+	.uleb128 0xa
+	.string	"i"
+	.value	0x198
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.uleb128 0x19
+	.long	0x150d
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1a6
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1ae
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2515
+	.value	0x18a
+	.long	0x1532
+	.uleb128 0x14
+	.long	.LASF2516
+	.value	0x18a
+	.byte	0x2e
+	.long	0x1532
+	.byte	0
+	.uleb128 0xb
+	.long	0x750
+	.uleb128 0x15
+	.long	.LASF2517
+	.value	0x183
+	.long	0x154f
+	.uleb128 0x14
+	.long	.LASF2319
+	.value	0x183
+	.byte	0x1c
+	.long	0x9d7
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2518
+	.value	0x161
+	.uleb128 0x20
+	.long	.LASF2519
+	.value	0x155
+	.byte	0x5
+	.long	0x347
+	.long	0x157f
+	.uleb128 0x14
+	.long	.LASF2520
+	.value	0x155
+	.byte	0x20
+	.long	0x70
+	.uleb128 0x14
+	.long	.LASF2521
+	.value	0x155
+	.byte	0x2c
+	.long	0xcf
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2522
+	.value	0x150
+	.byte	0x7
+	.long	0xcf
+	.uleb128 0x26
+	.long	.LASF2523
+	.value	0x14b
+	.byte	0x9
+	.long	0x9f
+	.uleb128 0x34
+	.long	.LASF2524
+	.byte	0x14
+	.byte	0x45
+	.byte	0x6
+	.long	0x15c7
+	.uleb128 0x1c
+	.long	.LASF2525
+	.byte	0x14
+	.byte	0x45
+	.byte	0x2b
+	.long	0x15c7
+	.uleb128 0x7
+	.long	.LASF2526
+	.byte	0x5f
+	.byte	0x9
+	.long	0x70
+	.uleb128 0xf
+	.uleb128 0x35
+	.string	"i"
+	.byte	0x14
+	.byte	0x60
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xb45
+	.uleb128 0x1d
+	.long	.LASF2527
+	.byte	0x13
+	.byte	0x92
+	.byte	0x65
+	.long	0x15d8
+	.uleb128 0xb
+	.long	0xe2e
+	.uleb128 0x1d
+	.long	.LASF2525
+	.byte	0x12
+	.byte	0x62
+	.byte	0x74
+	.long	0x15e9
+	.uleb128 0xb
+	.long	0xb51
+	.uleb128 0x1d
+	.long	.LASF2528
+	.byte	0x12
+	.byte	0x58
+	.byte	0x74
+	.long	0x15fa
+	.uleb128 0xb
+	.long	0xada
+	.uleb128 0x27
+	.long	.LASF2531
+	.byte	0x12
+	.byte	0x4a
+	.byte	0x8d
+	.long	0xa91
+	.long	0x161c
+	.uleb128 0x1c
+	.long	.LASF2529
+	.byte	0x12
+	.byte	0x4a
+	.byte	0xa2
+	.long	0x70
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2530
+	.byte	0xf
+	.byte	0x62
+	.byte	0x83
+	.long	0x1628
+	.uleb128 0xb
+	.long	0x806
+	.uleb128 0x27
+	.long	.LASF2532
+	.byte	0x1c
+	.byte	0x88
+	.byte	0x15
+	.long	0xcf
+	.long	0x1660
+	.uleb128 0x1e
+	.string	"amt"
+	.byte	0x88
+	.byte	0x26
+	.long	0xcf
+	.uleb128 0x1e
+	.string	"low"
+	.byte	0x88
+	.byte	0x31
+	.long	0xcf
+	.uleb128 0x1c
+	.long	.LASF2533
+	.byte	0x1c
+	.byte	0x88
+	.byte	0x3c
+	.long	0xcf
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF2535
+	.byte	0x1c
+	.byte	0x7e
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x1e
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x70
+	.uleb128 0x1e
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x70
+	.uleb128 0x1c
+	.long	.LASF2533
+	.byte	0x1c
+	.byte	0x7e
+	.byte	0x33
+	.long	0x70
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 29 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.file 32 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 34 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 35 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x31
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 57 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.file 58 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 59 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 60 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 61 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 62 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.file 63 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9
+	.file 64 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1552
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 65 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1559
+	.byte	0x4
+	.byte	0x4
+	.file 66 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xd
+	.file 67 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x44
+	.byte	0x4
+	.file 69 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 70 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x46
+	.byte	0x4
+	.file 71 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x47
+	.file 72 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 73 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x49
+	.file 74 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 75 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1978
+	.byte	0x4
+	.file 76 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 77 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 78 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1988
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 79 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x15
+	.file 80 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x50
+	.file 81 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x4
+	.file 82 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x52
+	.file 83 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2086
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1417
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1424
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1428
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1549
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1551
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2004
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2031
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2079
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2537
+	.long	.LASF2538
+	.long	.LASF2539
+	.long	.LASF2540
+	.long	.LASF2541
+	.long	.LASF2542
+	.long	.LASF2543
+	.long	.LASF2544
+	.long	.LASF2545
+	.long	.LASF2546
+	.long	.LASF2547
+	.long	.LASF2548
+	.long	.LASF2549
+	.long	.LASF2550
+	.long	.LASF2551
+	.long	.LASF2552
+	.long	.LASF2553
+	.long	.LASF2554
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x54
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2555
+	.byte	0xe
+	.long	.LASF2556
+	.byte	0xe
+	.long	.LASF2557
+	.byte	0xe
+	.long	.LASF2558
+	.byte	0x12
+	.long	.LASF2559
+	.byte	0xa
+	.long	.LASF2560
+	.byte	0x3
+	.long	.LASF2561
+	.byte	0x2
+	.long	.LASF2562
+	.byte	0x4
+	.long	.LASF2563
+	.byte	0x4
+	.long	.LASF2564
+	.byte	0x4
+	.long	.LASF2565
+	.byte	0x2
+	.long	.LASF2566
+	.byte	0x4
+	.long	.LASF2567
+	.byte	0x5
+	.long	.LASF2568
+	.byte	0x6
+	.long	.LASF2569
+	.byte	0x5
+	.long	.LASF2570
+	.byte	0x5
+	.long	.LASF2571
+	.byte	0x5
+	.long	.LASF2572
+	.byte	0x6
+	.long	.LASF2573
+	.byte	0x8
+	.long	.LASF2574
+	.byte	0x6
+	.long	.LASF2575
+	.byte	0x9
+	.long	.LASF2576
+	.byte	0x6
+	.long	.LASF2565
+	.byte	0x4
+	.long	.LASF2577
+	.byte	0xe
+	.long	.LASF2578
+	.byte	0x11
+	.long	.LASF2579
+	.byte	0x5
+	.long	.LASF2580
+	.byte	0x3
+	.long	.LASF2581
+	.byte	0x2
+	.long	.LASF2582
+	.byte	0x11
+	.long	.LASF2583
+	.byte	0x12
+	.long	.LASF2584
+	.byte	0x12
+	.long	.LASF2584
+	.byte	0x11
+	.long	.LASF2585
+	.byte	0xe
+	.long	.LASF2586
+	.byte	0x11
+	.long	.LASF2587
+	.byte	0x11
+	.long	.LASF2588
+	.byte	0xe
+	.long	.LASF2589
+	.byte	0xe
+	.long	.LASF2590
+	.byte	0x10
+	.long	.LASF2591
+	.byte	0xe
+	.long	.LASF2592
+	.byte	0xf
+	.long	.LASF2593
+	.byte	0xf
+	.long	.LASF2594
+	.byte	0xe
+	.long	.LASF2595
+	.byte	0xe
+	.long	.LASF2596
+	.byte	0xe
+	.long	.LASF2597
+	.byte	0xd
+	.long	.LASF2598
+	.byte	0xd
+	.long	.LASF2599
+	.byte	0x11
+	.long	.LASF2600
+	.byte	0x11
+	.long	.LASF2601
+	.byte	0xe
+	.long	.LASF2602
+	.byte	0xe
+	.long	.LASF2603
+	.byte	0xe
+	.long	.LASF2604
+	.byte	0xe
+	.long	.LASF2605
+	.byte	0xe
+	.long	.LASF2606
+	.byte	0xe
+	.long	.LASF2607
+	.byte	0xe
+	.long	.LASF2608
+	.byte	0xe
+	.long	.LASF2609
+	.byte	0xc
+	.long	.LASF2610
+	.byte	0xb
+	.long	.LASF2611
+	.byte	0xb
+	.long	.LASF2612
+	.byte	0x1
+	.long	.LASF2613
+	.byte	0x1
+	.long	.LASF2614
+	.byte	0x2
+	.long	.LASF2615
+	.byte	0x3
+	.long	.LASF2616
+	.byte	0x4
+	.long	.LASF2617
+	.byte	0x4
+	.long	.LASF2618
+	.byte	0x7
+	.long	.LASF2619
+	.byte	0x4
+	.long	.LASF2620
+	.byte	0x4
+	.long	.LASF2621
+	.byte	0x4
+	.long	.LASF2622
+	.byte	0x4
+	.long	.LASF2623
+	.byte	0x4
+	.long	.LASF2624
+	.byte	0x4
+	.long	.LASF2625
+	.byte	0x4
+	.long	.LASF2626
+	.byte	0x2
+	.long	.LASF2627
+	.byte	0x4
+	.long	.LASF2628
+	.byte	0x4
+	.long	.LASF2629
+	.byte	0x4
+	.long	.LASF2630
+	.byte	0x4
+	.long	.LASF2631
+	.byte	0x6
+	.long	.LASF2632
+	.byte	0x9
+	.long	.LASF2633
+	.byte	0x9
+	.long	.LASF2634
+	.byte	0x9
+	.long	.LASF2635
+	.byte	0x9
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1969:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1993:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1725:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1427:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1605:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1799:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1411:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1736:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF2454:
+	.string	"deadbandMotor3dHigh"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2125:
+	.string	"TIM_USE_PPM"
+.LASF2445:
+	.string	"mixerOctoX8"
+.LASF2008:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1616:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF2313:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF2221:
+	.string	"FEATURE_TRANSPONDER"
+.LASF2488:
+	.string	"motorMixMax"
+.LASF1700:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2438:
+	.string	"mixerQuadP"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF2038:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2385:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2395:
+	.string	"airmodeWasActivated"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1819:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1614:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1872:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1420:
+	.string	"TRACE_END(event,arg) {}"
+.LASF1559:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1445:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2462:
+	.string	"motorOutputMax"
+.LASF1953:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2534:
+	.string	"writeAllMotors"
+.LASF2309:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2092:
+	.string	"__uint8_t"
+.LASF2505:
+	.string	"stopMotors"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2477:
+	.string	"isMotorsReversed"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2145:
+	.string	"_Bool"
+.LASF2407:
+	.string	"spektrum_sat_bind"
+.LASF1671:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1978:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2032:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1818:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2163:
+	.string	"OWNER_ADC_CURR"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1573:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1672:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2530:
+	.string	"flight3DConfig"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2011:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1778:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF2517:
+	.string	"mixerInit"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2347:
+	.string	"motorMixer_s"
+.LASF2351:
+	.string	"motorMixer_t"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2324:
+	.string	"MIXER_GIMBAL"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2440:
+	.string	"mixerY4"
+.LASF2444:
+	.string	"mixerY6"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF2424:
+	.string	"rxConfig_System"
+.LASF2040:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF2017:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF2411:
+	.string	"rssi_invert"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1965:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2274:
+	.string	"deadband3d_throttle"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1508:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1500:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1804:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1788:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1937:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1464:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2160:
+	.string	"OWNER_LED"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1636:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1653:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1914:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1744:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2211:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2101:
+	.string	"uint16_t"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF2401:
+	.string	"halfDuplex"
+.LASF2088:
+	.string	"short unsigned int"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1537:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2496:
+	.string	"failsafeActive"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1904:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1748:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1883:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2501:
+	.string	"calculateThrottleAndCurrentMotorEndpoints"
+.LASF1892:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1987:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1455:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF1836:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1857:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2480:
+	.string	"externalValue"
+.LASF1598:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF2466:
+	.string	"isAirmodeActive"
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1896:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2060:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1847:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1468:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1716:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2370:
+	.string	"motorConfig_System"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1757:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1481:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF1593:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2054:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1624:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1426:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1488:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF1989:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1928:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1436:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2071:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2299:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2393:
+	.string	"axisPID_D"
+.LASF2463:
+	.string	"mixerInversion"
+.LASF2080:
+	.string	"TARGET_DEFAULT_MIXER MIXER_QUADX"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1504:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2391:
+	.string	"axisPID_P"
+.LASF1555:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1863:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1936:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2376:
+	.string	"PID_YAW"
+.LASF1829:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1964:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2167:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2186:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2057:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1462:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1632:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1571:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1590:
+	.string	"BIT(x) (1 << (x))"
+.LASF2191:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1560:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1691:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF1558:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF2506:
+	.string	"writeMotors"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1431:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1579:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1724:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF2199:
+	.string	"OWNER_SPI_PREINIT"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF1886:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2042:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF2126:
+	.string	"TIM_USE_PWM"
+.LASF2130:
+	.string	"TIM_USE_TRANSPONDER"
+.LASF1459:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1656:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2015:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2487:
+	.string	"scaledAxisPidYaw"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF2392:
+	.string	"axisPID_I"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2188:
+	.string	"OWNER_BARO_EXTI"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF2518:
+	.string	"initEscEndpoints"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1509:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2362:
+	.string	"mixerConfig_System"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1751:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1968:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2166:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2282:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1501:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2489:
+	.string	"motorMixMin"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF1514:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2113:
+	.string	"PGR_SIZE_MASK"
+.LASF2513:
+	.string	"customMixers"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2209:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1679:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1923:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF2129:
+	.string	"TIM_USE_LED"
+.LASF2039:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2356:
+	.string	"useServo"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1985:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF2461:
+	.string	"motorOutputMin"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2083:
+	.string	"EXTERNAL_CONVERSION_MIN_VALUE 1000"
+.LASF2055:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1866:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1720:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1931:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2292:
+	.string	"BOXLEDLOW"
+.LASF2397:
+	.string	"rxConfig_s"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2189:
+	.string	"OWNER_USB"
+.LASF2512:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2354:
+	.string	"mixer_s"
+.LASF2358:
+	.string	"mixer_t"
+.LASF398:
+	.string	"false 0"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2348:
+	.string	"throttle"
+.LASF1457:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1929:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1613:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF2279:
+	.string	"BOXHORIZON"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2472:
+	.string	"pwmCompleteMotorUpdate"
+.LASF2406:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF2236:
+	.string	"pidSumLimit"
+.LASF2243:
+	.string	"horizon_tilt_effect"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2014:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2409:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1673:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2190:
+	.string	"OWNER_USB_DETECT"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1810:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1848:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2226:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1476:
+	.string	"PG_PID_PROFILE 14"
+.LASF2231:
+	.string	"dterm_lpf_hz"
+.LASF1772:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2213:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2273:
+	.string	"neutral3d"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1849:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2293:
+	.string	"BOXLLIGHTS"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1582:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2171:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2046:
+	.string	"PIDSUM_LIMIT 500"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1889:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2210:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2065:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2419:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1493:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2280:
+	.string	"BOXBARO"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1979:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1580:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2159:
+	.string	"OWNER_SERVO"
+.LASF1592:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1302:
+	.string	"ACC "
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2353:
+	.string	"customMotorMixer_CopyArray"
+.LASF1475:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF1587:
+	.string	"PP_IIF_0(t,f) f"
+.LASF2276:
+	.string	"flight3DConfig_System"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1646:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1630:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1734:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2019:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2470:
+	.string	"pwmShutdownPulsesForAllMotors"
+.LASF2400:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2507:
+	.string	"mixerResetDisarmedMotors"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1451:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2432:
+	.string	"mixMatrix_s"
+.LASF2433:
+	.string	"mixMatrix_t"
+.LASF2020:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF2341:
+	.string	"MIXER_ATAIL4"
+.LASF2333:
+	.string	"MIXER_AIRPLANE"
+.LASF2349:
+	.string	"roll"
+.LASF2492:
+	.string	"mixTable"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2412:
+	.string	"midrc"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2051:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2093:
+	.string	"__int16_t"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1864:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2234:
+	.string	"dterm_notch_cutoff"
+.LASF2134:
+	.string	"timerHardware_s"
+.LASF2095:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2001:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2158:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1976:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF364:
+	.string	"__k8 1"
+.LASF1440:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1643:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1552:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF2185:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1686:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2009:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1585:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1986:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2252:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF2222:
+	.string	"FEATURE_AIRMODE"
+.LASF2402:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1940:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1692:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1932:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1674:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1430:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1731:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1553:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2066:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2365:
+	.string	"digitalIdleOffsetValue"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1797:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2035:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF2352:
+	.string	"customMotorMixer_SystemArray"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1538:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1784:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2087:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1631:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2084:
+	.string	"EXTERNAL_CONVERSION_MAX_VALUE 2000"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1760:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2204:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1548:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1551:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1583:
+	.string	"EXPAND_I(x) x"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF2511:
+	.string	"mixerLoadMix"
+.LASF1494:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1838:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2403:
+	.string	"rx_spi_id"
+.LASF1650:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2096:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF1996:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2148:
+	.string	"motorPwmProtocol"
+.LASF2104:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1472:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1637:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2277:
+	.string	"BOXARM"
+.LASF1785:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2418:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF2437:
+	.string	"mixerTricopter"
+.LASF1727:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF2413:
+	.string	"mincheck"
+.LASF1528:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1796:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1578:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF2162:
+	.string	"OWNER_ADC_BATT"
+.LASF1703:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2137:
+	.string	"output"
+.LASF1566:
+	.string	"IOCFG_OUT_OD 0"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2294:
+	.string	"BOXCALIB"
+.LASF2133:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2205:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2207:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1412:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1442:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1970:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1422:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2290:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF2144:
+	.string	"PWM_TYPE_MAX"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2455:
+	.string	"deadbandMotor3dLow"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2197:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF2499:
+	.string	"motorStop"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2431:
+	.string	"currentMixer"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2260:
+	.string	"AUX1"
+.LASF2261:
+	.string	"AUX2"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2263:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2265:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2267:
+	.string	"AUX8"
+.LASF1479:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2228:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2533:
+	.string	"high"
+.LASF2414:
+	.string	"maxcheck"
+.LASF2078:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF1718:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2257:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1839:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1999:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2064:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2342:
+	.string	"MIXER_CUSTOM"
+.LASF2180:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1925:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1629:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF2244:
+	.string	"horizon_tilt_expert_mode"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1820:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1803:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1634:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1723:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1740:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2343:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1665:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1746:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2111:
+	.string	"PGR_PGN_MASK"
+.LASF2510:
+	.string	"yawDirection"
+.LASF2300:
+	.string	"BOXSERVO1"
+.LASF2301:
+	.string	"BOXSERVO2"
+.LASF2302:
+	.string	"BOXSERVO3"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2482:
+	.string	"motorValue"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2224:
+	.string	"FEATURE_RX_SPI"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1286:
+	.string	"USE_NAV "
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2446:
+	.string	"mixerOctoFlatP"
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1955:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1884:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1556:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1982:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1967:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1617:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1535:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2116:
+	.string	"test"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1991:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1935:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1926:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF1773:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1652:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2153:
+	.string	"timeMs_t"
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1647:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2069:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2034:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1916:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1563:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1658:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2117:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1946:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1657:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1664:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2408:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1519:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF2423:
+	.string	"rxConfig_t"
+.LASF2422:
+	.string	"rx_max_usec"
+.LASF1417:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1676:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF2062:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2340:
+	.string	"MIXER_SINGLECOPTER"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1959:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2217:
+	.string	"FEATURE_DASHBOARD"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1447:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2194:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2103:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2061:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2373:
+	.string	"motor_disarmed"
+.LASF2175:
+	.string	"OWNER_SPI_MOSI"
+.LASF1938:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2115:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1759:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2100:
+	.string	"uint8_t"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2043:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2174:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1726:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1584:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2467:
+	.string	"failsafeIsActive"
+.LASF1767:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF1774:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1639:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF2258:
+	.string	"PITCH"
+.LASF1809:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1432:
+	.string	"VERY_FAST_MATH "
+.LASF2330:
+	.string	"MIXER_OCTOX8"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2138:
+	.string	"timerHardware_t"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2375:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2297:
+	.string	"BOXTELEMETRY"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF2275:
+	.string	"flight3DConfig_t"
+.LASF1546:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1877:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1790:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1743:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1815:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF2529:
+	.string	"_index"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1998:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2132:
+	.string	"timerUsageFlag_e"
+.LASF1604:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2157:
+	.string	"OWNER_PPMINPUT"
+.LASF2122:
+	.string	"ioTag_t"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1569:
+	.string	"IOCFG_IPD 0"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2108:
+	.string	"FD_PITCH"
+.LASF2241:
+	.string	"levelAngleLimit"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1554:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF2426:
+	.string	"mixerConfig_Registry"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2520:
+	.string	"axis"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1497:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2139:
+	.string	"PWM_TYPE_STANDARD"
+.LASF2503:
+	.string	"currentThrottleInputRange"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2396:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1901:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1635:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2371:
+	.string	"motorConfig_Copy"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1983:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2321:
+	.string	"MIXER_QUADP"
+.LASF1525:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1721:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF2322:
+	.string	"MIXER_QUADX"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1758:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF2052:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1920:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1661:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2410:
+	.string	"rssi_scale"
+.LASF1487:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1722:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1586:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1533:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1454:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1492:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2063:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2121:
+	.string	"pgRegistry_t"
+.LASF2427:
+	.string	"motorConfig_Registry"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2149:
+	.string	"motorPwmInversion"
+.LASF1762:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2030:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2308:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1619:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1702:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1729:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2387:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF1536:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2320:
+	.string	"MIXER_TRI"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF1868:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1565:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1642:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1913:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2415:
+	.string	"rcInterpolation"
+.LASF2388:
+	.string	"pidCrashRecovery_e"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1638:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2306:
+	.string	"BOX3DDISABLE"
+.LASF1550:
+	.string	"IO_TAG_NONE 0"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1448:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2220:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1997:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1651:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF2037:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1608:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF1855:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2268:
+	.string	"timerHardware"
+.LASF1534:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2170:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2131:
+	.string	"TIM_USE_BEEPER"
+.LASF2118:
+	.string	"address"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1793:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1853:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1755:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1739:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF2473:
+	.string	"pwmWriteMotor"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1570:
+	.string	"IOCFG_IPU 0"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF721:
+	.string	"NULL"
+.LASF2025:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2525:
+	.string	"motorConfig"
+.LASF1591:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1961:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2350:
+	.string	"pitch"
+.LASF2242:
+	.string	"levelSensitivity"
+.LASF2172:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2135:
+	.string	"channel"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1510:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1694:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1821:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1618:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2459:
+	.string	"rcCommandThrottleRange3dLow"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2416:
+	.string	"rcInterpolationChannels"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2250:
+	.string	"rateAccelLimit"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2229:
+	.string	"pidProfile_s"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1511:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1952:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2155:
+	.string	"OWNER_FREE"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2317:
+	.string	"armingFlags"
+.LASF1905:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF1782:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2081:
+	.string	"EXTERNAL_DSHOT_CONVERSION_FACTOR 2"
+.LASF2114:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF2464:
+	.string	"motorOutputRange"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1899:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1469:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1947:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF2526:
+	.string	"motorIndex"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF2421:
+	.string	"rx_min_usec"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1911:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2106:
+	.string	"TIM_TypeDef"
+.LASF1415:
+	.string	"UNIT_TESTED "
+.LASF2478:
+	.string	"feature"
+.LASF2151:
+	.string	"ioTags"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1477:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF2079:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2225:
+	.string	"FEATURE_SOFTSPI"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1728:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1460:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2536:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF2006:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1463:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1779:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1452:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2476:
+	.string	"memset"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1544:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2323:
+	.string	"MIXER_BICOPTER"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2238:
+	.string	"dterm_average_count"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1749:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2016:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF2124:
+	.string	"TIM_USE_NONE"
+.LASF2077:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1615:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1856:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1771:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1742:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2239:
+	.string	"vbatPidCompensation"
+.LASF2457:
+	.string	"motorOutputLow"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2143:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF2494:
+	.string	"motorOutputBase"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1626:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2269:
+	.string	"rcCommand"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1830:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2439:
+	.string	"mixerBicopter"
+.LASF2033:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1421:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2334:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1667:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1627:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF2002:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1837:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2452:
+	.string	"mixerQuadX1234"
+.LASF2450:
+	.string	"mixerDualcopter"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2316:
+	.string	"WAS_EVER_ARMED"
+.LASF1265:
+	.string	"CMS "
+.LASF2120:
+	.string	"reset"
+.LASF2336:
+	.string	"MIXER_VTAIL4"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1470:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2123:
+	.string	"TIM_USE_ANY"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1574:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2485:
+	.string	"scaledAxisPidRoll"
+.LASF2178:
+	.string	"OWNER_SDCARD"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF2367:
+	.string	"maxthrottle"
+.LASF1956:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2099:
+	.string	"int16_t"
+.LASF1708:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2338:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2091:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1446:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF2460:
+	.string	"rcCommandThrottleRange3dHigh"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1648:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1971:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF2491:
+	.string	"throttleLimitOffset"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF2142:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF2435:
+	.string	"motorStopEnabled"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1478:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2004:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2215:
+	.string	"FEATURE_RSSI_ADC"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1429:
+	.string	"sq(x) ((x)*(x))"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1594:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1862:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2013:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1880:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2469:
+	.string	"delayMicroseconds"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF2490:
+	.string	"motorMixScale"
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1710:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2059:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2285:
+	.string	"BOXCAMSTAB"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF2056:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2523:
+	.string	"getMotorCount"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1995:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2107:
+	.string	"FD_ROLL"
+.LASF1486:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2074:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2394:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1805:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2305:
+	.string	"BOXAIRMODE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2399:
+	.string	"serialrx_provider"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1490:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF2509:
+	.string	"motorDirection"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2498:
+	.string	"failsafeDshot"
+.LASF2495:
+	.string	"motorOutputScale"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2327:
+	.string	"MIXER_FLYING_WING"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1473:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1545:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2192:
+	.string	"OWNER_OSD"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1659:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1871:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2112:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2368:
+	.string	"mincommand"
+.LASF1495:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2449:
+	.string	"mixerAtail4"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2082:
+	.string	"EXTERNAL_DSHOT_CONVERSION_OFFSET 977"
+.LASF1529:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2283:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1622:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1766:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2021:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2128:
+	.string	"TIM_USE_SERVO"
+.LASF1602:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1813:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2328:
+	.string	"MIXER_Y4"
+.LASF2325:
+	.string	"MIXER_Y6"
+.LASF1992:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2050:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1423:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1449:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2246:
+	.string	"itermAcceleratorGain"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF2254:
+	.string	"crash_recovery_angle"
+.LASF2380:
+	.string	"PID_NAVR"
+.LASF1711:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF2502:
+	.string	"throttlePrevious"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1823:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1568:
+	.string	"IOCFG_AF_OD 0"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1980:
+	.string	"I2CDEV_COUNT 4"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2012:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1628:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1649:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1542:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1826:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF2218:
+	.string	"FEATURE_OSD"
+.LASF1515:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2119:
+	.string	"copy"
+.LASF2357:
+	.string	"motor"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1609:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1489:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1902:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF2109:
+	.string	"FD_YAW"
+.LASF2097:
+	.string	"long int"
+.LASF2310:
+	.string	"BOXCAMERA2"
+.LASF2311:
+	.string	"BOXCAMERA3"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1482:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF2127:
+	.string	"TIM_USE_MOTOR"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2049:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1527:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1620:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1973:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2486:
+	.string	"scaledAxisPidPitch"
+.LASF2335:
+	.string	"MIXER_HELI_90_DEG"
+.LASF1441:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2168:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2331:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1943:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2332:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2256:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1713:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2296:
+	.string	"BOXOSD"
+.LASF2018:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF2086:
+	.string	"TRICOPTER_ERROR_RATE_YAW_SATURATED 75"
+.LASF2447:
+	.string	"mixerOctoFlatX"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1540:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1670:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2475:
+	.string	"lrintf"
+.LASF1689:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1769:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2519:
+	.string	"mixerIsOutputSaturated"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2298:
+	.string	"BOXGTUNE"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1842:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1575:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2140:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF2363:
+	.string	"mixerConfig_Copy"
+.LASF1461:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1802:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1843:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2156:
+	.string	"OWNER_PWMINPUT"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2036:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2102:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF1458:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1917:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2281:
+	.string	"BOXANTIGRAVITY"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1817:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1881:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1816:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2070:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2288:
+	.string	"BOXGPSHOLD"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1844:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2521:
+	.string	"errorRate"
+.LASF1437:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1526:
+	.string	"PG_PID_CONFIG 504"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1887:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2003:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1833:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2284:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1505:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1465:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2203:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2287:
+	.string	"BOXGPSHOME"
+.LASF2237:
+	.string	"pidSumLimitYaw"
+.LASF2169:
+	.string	"OWNER_TIMER"
+.LASF1697:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2514:
+	.string	"mixerConfigureOutput"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1506:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1875:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2474:
+	.string	"pwmAreMotorsEnabled"
+.LASF2248:
+	.string	"dtermSetpointWeight"
+.LASF1564:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1851:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF1737:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1910:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2493:
+	.string	"applyMixToMotors"
+.LASF1981:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1285:
+	.string	"GPS "
+.LASF2251:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF2483:
+	.string	"motorMix"
+.LASF1832:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1567:
+	.string	"IOCFG_AF_PP 0"
+.LASF2000:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1662:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF2448:
+	.string	"mixerVtail4"
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1827:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF2291:
+	.string	"BOXLEDMAX"
+.LASF2303:
+	.string	"BOXBLACKBOX"
+.LASF1433:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2141:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1654:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1549:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1781:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2181:
+	.string	"OWNER_FLASH_CS"
+.LASF2479:
+	.string	"convertMotorToExternal"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF1811:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1576:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF397:
+	.string	"true 1"
+.LASF1846:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1719:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2010:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1786:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1577:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2230:
+	.string	"dterm_filter_type"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1498:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2374:
+	.string	"PID_ROLL"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2528:
+	.string	"mixerConfig"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1581:
+	.string	"STR_HELPER(x) #x"
+.LASF1763:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2206:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1503:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2173:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2165:
+	.string	"OWNER_ADC_RSSI"
+.LASF1413:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1874:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1418:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2022:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2278:
+	.string	"BOXANGLE"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1812:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2304:
+	.string	"BOXFAILSAFE"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1600:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1685:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF2429:
+	.string	"motorMixRange"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2219:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2073:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1541:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF377:
+	.string	"__linux 1"
+.LASF2428:
+	.string	"customMotorMixer_Registry"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1854:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1800:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2255:
+	.string	"crash_recovery_rate"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2508:
+	.string	"mixerUpdateMixMatrix"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF2360:
+	.string	"yaw_motors_reversed"
+.LASF1770:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1808:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1764:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1572:
+	.string	"NOOP do {} while (0)"
+.LASF1683:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1949:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1895:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1633:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2045:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2524:
+	.string	"pgResetFn_motorConfig"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2023:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2029:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1480:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2259:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF2326:
+	.string	"MIXER_HEX6"
+.LASF1898:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1994:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1789:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1516:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1588:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1456:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1595:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1824:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2315:
+	.string	"ARMED"
+.LASF1518:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1688:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1822:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF1865:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2105:
+	.string	"double"
+.LASF1610:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1641:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2339:
+	.string	"MIXER_DUALCOPTER"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2027:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1561:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1695:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2176:
+	.string	"OWNER_I2C_SCL"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2198:
+	.string	"OWNER_COMPASS_CS"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF2026:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF1776:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1466:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2214:
+	.string	"FEATURE_RX_MSP"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2233:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2417:
+	.string	"rcInterpolationInterval"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2208:
+	.string	"FEATURE_GPS"
+.LASF2235:
+	.string	"itermWindupPointPercent"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1543:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2314:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2527:
+	.string	"rxConfig"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2177:
+	.string	"OWNER_I2C_SDA"
+.LASF2075:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2295:
+	.string	"BOXGOV"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF1439:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1878:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2216:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1483:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1443:
+	.string	"Q12 (1 << 12)"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2223:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1682:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1485:
+	.string	"PG_RX_CONFIG 24"
+.LASF1512:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1491:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1450:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2346:
+	.string	"mixerMode_e"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2024:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1732:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1539:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF2072:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2465:
+	.string	"calculateVbatPidCompensation"
+.LASF1589:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1958:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1869:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2068:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1677:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF1607:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF1974:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2386:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1975:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1754:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1852:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2150:
+	.string	"useUnsyncedPwm"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1707:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1907:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2381:
+	.string	"PID_LEVEL"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1792:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2193:
+	.string	"OWNER_RX_BIND"
+.LASF1517:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF2262:
+	.string	"AUX3"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF2196:
+	.string	"OWNER_TRANSPONDER"
+.LASF1484:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2264:
+	.string	"AUX5"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2266:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1709:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF1655:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2405:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF2247:
+	.string	"setpointRelaxRatio"
+.LASF1435:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2318:
+	.string	"rc_alias"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1835:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2067:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2319:
+	.string	"mixerMode"
+.LASF2307:
+	.string	"BOXFPVANGLEMIX"
+.LASF1794:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1663:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2272:
+	.string	"deadband3d_high"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2154:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1520:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2044:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF2430:
+	.string	"currentMixerMode"
+.LASF1859:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2183:
+	.string	"OWNER_MPU_CS"
+.LASF2110:
+	.string	"pgn_t"
+.LASF1531:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2458:
+	.string	"rcCommandThrottleRange"
+.LASF2053:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1922:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1306:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2098:
+	.string	"char"
+.LASF1596:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2359:
+	.string	"mixerConfig_s"
+.LASF2361:
+	.string	"mixerConfig_t"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1941:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2240:
+	.string	"pidAtMinThrottle"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2028:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2337:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1625:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1467:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2329:
+	.string	"MIXER_HEX6X"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1438:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1597:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2379:
+	.string	"PID_POSR"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1787:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1806:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1761:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1775:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1752:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2355:
+	.string	"motorCount"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF2202:
+	.string	"FEATURE_RX_PPM"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2383:
+	.string	"PID_VEL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1424:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1714:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2364:
+	.string	"motorConfig_s"
+.LASF2369:
+	.string	"motorConfig_t"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2270:
+	.string	"flight3DConfig_s"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2007:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1795:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1698:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1547:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2404:
+	.string	"rx_spi_rf_channel_count"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2425:
+	.string	"pgResetTemplate_mixerConfig"
+.LASF2201:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF1730:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1680:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2005:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1428:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF1712:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF2147:
+	.string	"motorPwmRate"
+.LASF2504:
+	.string	"stopPwmAllMotors"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2031:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1666:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2047:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1984:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2253:
+	.string	"crash_time"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1962:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2076:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF2515:
+	.string	"pidInitMixer"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1499:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1645:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1850:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1562:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2212:
+	.string	"FEATURE_3D"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1471:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2179:
+	.string	"OWNER_SDCARD_CS"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2372:
+	.string	"mixers"
+.LASF1745:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1416:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1885:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1860:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2484:
+	.string	"vbatCompensationFactor"
+.LASF2398:
+	.string	"rcmap"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2041:
+	.string	"ALL_MOTORS 255"
+.LASF1621:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1606:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2146:
+	.string	"motorDevConfig_s"
+.LASF2152:
+	.string	"motorDevConfig_t"
+.LASF2442:
+	.string	"mixerHex6H"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1611:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1944:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2453:
+	.string	"disarmMotorOutput"
+.LASF2443:
+	.string	"mixerHex6P"
+.LASF1890:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2441:
+	.string	"mixerHex6X"
+.LASF2312:
+	.string	"BOXDSHOTREVERSE"
+.LASF2516:
+	.string	"pidProfile"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1668:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1532:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2200:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1841:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2468:
+	.string	"isMotorProtocolDshot"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1715:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1701:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2090:
+	.string	"long unsigned int"
+.LASF1599:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2195:
+	.string	"OWNER_LED_STRIP"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2378:
+	.string	"PID_POS"
+.LASF2382:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2384:
+	.string	"PID_ITEM_COUNT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1798:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2094:
+	.string	"short int"
+.LASF2058:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2136:
+	.string	"usageFlags"
+.LASF1502:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2249:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2085:
+	.string	"EXTERNAL_CONVERSION_3D_MID_VALUE 1500"
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1513:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1557:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1524:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2232:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1453:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2377:
+	.string	"PID_ALT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1977:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF2182:
+	.string	"OWNER_BARO_CS"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2471:
+	.string	"delay"
+.LASF2271:
+	.string	"deadband3d_low"
+.LASF1522:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1434:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2500:
+	.string	"motorOutput"
+.LASF2420:
+	.string	"airModeActivateThreshold"
+.LASF2451:
+	.string	"mixerSingleProp"
+.LASF2089:
+	.string	"unsigned int"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2345:
+	.string	"MIXER_QUADX_1234"
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2481:
+	.string	"convertExternalToMotor"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1601:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2522:
+	.string	"getMotorMixRange"
+.LASF2227:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF2366:
+	.string	"minthrottle"
+.LASF1908:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2289:
+	.string	"BOXPASSTHRU"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1530:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1845:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2161:
+	.string	"OWNER_ADC"
+.LASF2434:
+	.string	"mixMatrix"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2187:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2456:
+	.string	"motorOutputHigh"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2245:
+	.string	"itermThrottleThreshold"
+.LASF2286:
+	.string	"BOXCAMTRIG"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF1893:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1474:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2436:
+	.string	"mixerQuadX"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2497:
+	.string	"motorOutputLimitLow"
+.LASF2344:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1644:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2164:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1791:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2048:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1807:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2184:
+	.string	"OWNER_OSD_CS"
+.LASF2535:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1934:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2389:
+	.string	"pid8_s"
+.LASF2390:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1814:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF1717:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1704:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1801:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2532:
+	.string	"constrainf"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1950:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2531:
+	.string	"customMotorMixer"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1988:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2621:
+	.string	"rx_pwm.h"
+.LASF2564:
+	.string	"pwm_output.h"
+.LASF2602:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2553:
+	.string	"/usr/include"
+.LASF2608:
+	.string	"mathcalls-helper-functions.h"
+.LASF2604:
+	.string	"floatn-common.h"
+.LASF2584:
+	.string	"stdint.h"
+.LASF2537:
+	.string	"src/main/build"
+.LASF2550:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2583:
+	.string	"stdbool.h"
+.LASF2620:
+	.string	"flash.h"
+.LASF2565:
+	.string	"time.h"
+.LASF2588:
+	.string	"wordsize.h"
+.LASF2546:
+	.string	"src/main/target/SITL"
+.LASF2577:
+	.string	"mathcalls.h"
+.LASF2579:
+	.string	"fc_core.h"
+.LASF2629:
+	.string	"sound_beeper.h"
+.LASF2618:
+	.string	"motors.h"
+.LASF2585:
+	.string	"libc-header-start.h"
+.LASF2576:
+	.string	"failsafe.h"
+.LASF2609:
+	.string	"platform.h"
+.LASF2554:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2635:
+	.string	"voltage_ids.h"
+.LASF2566:
+	.string	"resource.h"
+.LASF0:
+	.string	"./src/main/flight/mixer.c"
+.LASF2542:
+	.string	"src/main/flight"
+.LASF2631:
+	.string	"imu.h"
+.LASF2582:
+	.string	"stdc-predef.h"
+.LASF2622:
+	.string	"sdcard.h"
+.LASF2600:
+	.string	"math.h"
+.LASF2549:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2614:
+	.string	"filter.h"
+.LASF2586:
+	.string	"features.h"
+.LASF2548:
+	.string	"src/main"
+.LASF2613:
+	.string	"trace.h"
+.LASF2543:
+	.string	"src/main/io"
+.LASF2601:
+	.string	"math-vector.h"
+.LASF2539:
+	.string	"src/main/config"
+.LASF2587:
+	.string	"features-time64.h"
+.LASF2599:
+	.string	"strings.h"
+.LASF2580:
+	.string	"feature.h"
+.LASF2571:
+	.string	"runtime_config.h"
+.LASF2567:
+	.string	"config.h"
+.LASF2592:
+	.string	"stubs.h"
+.LASF2595:
+	.string	"time64.h"
+.LASF2578:
+	.string	"string.h"
+.LASF2559:
+	.string	"target.h"
+.LASF2625:
+	.string	"io_def.h"
+.LASF2610:
+	.string	"common_fc_pre.h"
+.LASF2581:
+	.string	"maths.h"
+.LASF2615:
+	.string	"parameter_group_ids.h"
+.LASF2596:
+	.string	"wchar.h"
+.LASF2589:
+	.string	"timesize.h"
+.LASF2538:
+	.string	"src/main/common"
+.LASF2634:
+	.string	"voltage.h"
+.LASF2573:
+	.string	"rx.h"
+.LASF2632:
+	.string	"current.h"
+.LASF2552:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2616:
+	.string	"rcc_types.h"
+.LASF2558:
+	.string	"stddef.h"
+.LASF2607:
+	.string	"fp-fast.h"
+.LASF2541:
+	.string	"src/main/fc"
+.LASF2603:
+	.string	"floatn.h"
+.LASF2628:
+	.string	"bus_i2c.h"
+.LASF2563:
+	.string	"timer.h"
+.LASF2593:
+	.string	"stubs-64.h"
+.LASF2624:
+	.string	"io.h"
+.LASF2560:
+	.string	"parameter_group.h"
+.LASF2568:
+	.string	"pid.h"
+.LASF2627:
+	.string	"io_def_generated.h"
+.LASF2633:
+	.string	"current_ids.h"
+.LASF2574:
+	.string	"mixer.c"
+.LASF2572:
+	.string	"mixer.h"
+.LASF2630:
+	.string	"vcd.h"
+.LASF2570:
+	.string	"rc_modes.h"
+.LASF2557:
+	.string	"stdint-uintn.h"
+.LASF2606:
+	.string	"fp-logb.h"
+.LASF2617:
+	.string	"pwm_esc_detect.h"
+.LASF2619:
+	.string	"adc.h"
+.LASF2591:
+	.string	"long-double.h"
+.LASF2569:
+	.string	"rc_controls.h"
+.LASF2575:
+	.string	"battery.h"
+.LASF2590:
+	.string	"cdefs.h"
+.LASF2605:
+	.string	"flt-eval-method.h"
+.LASF2544:
+	.string	"src/main/rx"
+.LASF2594:
+	.string	"typesizes.h"
+.LASF2611:
+	.string	"common_fc_post.h"
+.LASF2597:
+	.string	"locale_t.h"
+.LASF2547:
+	.string	"src/main/target"
+.LASF2561:
+	.string	"axis.h"
+.LASF2540:
+	.string	"src/main/drivers"
+.LASF2623:
+	.string	"serial.h"
+.LASF2626:
+	.string	"utils.h"
+.LASF2612:
+	.string	"build_config.h"
+.LASF2545:
+	.string	"src/main/sensors"
+.LASF2556:
+	.string	"stdint-intn.h"
+.LASF2598:
+	.string	"__locale_t.h"
+.LASF2555:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2562:
+	.string	"io_types.h"
+.LASF2551:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\232\003e\023"
+	.string	"\024\033\216\004"
+	.string	"L"
+	.string	"\356\220\373\376\007\f\002"
+	.string	"\002\001\002\001\215\260\277\341\007\004\002\003\002\004\002\240\342\234\212\n\003\004\224\257\304\213\n\005\370\345\377\255\013&\002\005\002\005\002\003\006\002\007\002"
+	.string	"\002\b\t\006\352\263\360\321\b\007\b\t\n\013\016\017\020\350\300\306\254\005\002\021\354\206\342\366\006\002\022\023\221\306\210\360\006\004\002\n\002\n\024\025\360\347\263\276\007\"\002"
+	.string	"\002\013\002"
+	.string	"\002\f\013\b\003\002\003\027\030\031\032\033\034\035\036\037\232\323\204\263\r\002 \210\334\330\326\t\b\002"
+	.string	"\002\r!\"#\272\242\254\364\016\002\017\002\020\002\016\002\016\002\021\002\021\002\002\002\020$\366\200\211\274\017%\235\226\222\373\004\026\002\005\002\022\002\003\002\023\005\002\005&'(\202\220\201F.\002\024\002\024\002\025\002\023\020\002\023\023\004)*+\217\330\263\251\003\004,\316\313\323\260\017"
+	.string	"-\374\314\200\371\n.\322\221\266\371\006/\365\217\303\254\017\\"
+	.string	"\002"
+	.string	"\002\003\002\026\026\00313\334\217\363\222\f\b\002\002\0024\241\316\301\336\0010\027\003\004\002\0048\226\342\223\316\016"
+	.string	"9\274\336\227\370\007"
+	.string	":\316\317\221\317\017;\216\205\223\310\017<\314\311\255\300\001=\235\206\367\317\002>\206\270\257\235\016?\222\254\341\316\003@\221\260\327\363\002A\207\254\251\246\016B\325\233\244\265\013C\334\356\363\332\tD\335\372\220\202\003E\247\327\342\262\fF\254\275\261iG\321\256\205\311\017H\251\323\316\250\fI\275\225\333\350\001J\204\206\332\243\016K\313\346\310\307\tLM\241\242\220\212\005NO\347\373\336\272\fP\361\374\327\226\006QRS\240\342\234\212\n"
+	.string	"f\250\221Q\021\0212\005I\013[k\240\202*\232\332\006\021\320`\304T\311H\222\222\024\016\021T\215\016\242\376~}\275\362\333z{\264\032\207\267\312\224\341\376\274)S'[df\207l\031\313\377\n"
+	.ascii	"\025_\235#\362S\321\367\024\213\357{\230\206B\355[A\356.ZG\344"
+	.ascii	"{\266\020\332\256\222?\220\304\250\216\335u`\362\331\241\363"
+	.ascii	"\230\032\352\253y\2701I\224z\254\2163\312\024\273\374\330]\253"
+	.ascii	"\332\263\316't\230k\264\231X\332\0235\352L\230F\377)&\230,\243"
+	.ascii	"\361\307#V_\222dAW\031\332\023*\341\276;c\273\243\232\"\337|"
+	.ascii	"\242\"\177;\022\302\023=a\357\372\020 \003"
+	.text
+	.section	.gnu.lto_.ipa_sra.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \333\005\004"
+	.string	"\022\005\022\036\2407\215\001\377\377\377sUU\205\341-\262f\177\377\370~1=\221\256\220\021![\312\224\002\232\372\367\342\024'\024M\214?Q9\342`\270\260\226\240 0`$\251mm\003\3551;\032jNc\316\345TG\362\327\261\021\030"
+	.string	" \260\315\213\220\203\215\331\302\331\262i\005\030T\271\2545\217\215+Q\030"
+	.ascii	"\002\216\252\270Jp\220\314(\333@\n\256-\027\027\234\013b\342"
+	.ascii	"\315\365xY\003\006X"
+	.text
+	.section	.gnu.lto_.inline.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\004\004\235\023"
+	.string	"\246\033cG\320TQ\032\003\330\177\032X\2514m%\214\325n\rtSc\034m/\315L#)\201)\241\211\313\320\031\242\257Kp(\364o\024hRl\324\303\350\334\223\007\253\023\273$\240\002\246\243\274\030h&\016\210=\322\266\224;\005G"
+	.string	"K"
+	.string	"V"
+	.string	"\213\006"
+	.string	"\367RF\350\265#e\274h5\222\376\006\022\016\327\226\314A\003\372\021p\034\365\301\377$G}\243>N\273|\026\245y\321j\\\276\256RG\215\020\r\224a\236\036r\266\273\334w\272\345C/wwM\276\300\361H\352\332]\321\t\236S\225\326vW\003K\002\355n\203\t\250\034;\034\217]\bn\322]\352\356\306D\321\177 \241)!\0164%\f\374\307f\312\227\343\352ekW\006\345\001\232\362\2472\343$\227\034\201\343F\366\301%U\b\351\361bZ\243!\264$\f\226\222\031.\207\261\224\314\230\374"
+	.string	"\026\343\311\201&zb<9\353\354@\377"
+	.string	"q\245%f+\2026\250O\215%'*\314\200\265\203C\263\255RDK\207\305\002\023\\ek(H\255\264\202\321(\336\345,\343\271\002\267\263\347\364\241\227\022\236\253w\262\212\027\217\372\322\323Y\206O%\210\335\215A\200!\256\344\316\220\217\2138\tI\n\"<\240+\376\247\2042x\312\2279l\247\204Ym\214\270b\377P\270"
+	.string	"\263QDV\252\261Aq#e\013y\0234$\006l\351\214\026IH\f\344\t\251\324O\302\250\017\252J]\021\272\250\ng\250\001\261RH!#\222\302\244\322\034`\242\"dF\017\021\0209I\f\215\314H\324\302\316\001\025x\300\235\306\362\211FZ\203\3570\002\203+\244|P\354\360e\351W"
+	.ascii	"Js\r\235\006L\214d:\302+\222\346\033`\007\247\"\331\021\251;"
+	.ascii	"\310\266\210\025\021\263\300\276\013\334\353\\~J\365\247(=\256"
+	.ascii	"\237\037\373r\364\367\232\232\3163U\204\316HJ\306&\255\207\356"
+	.ascii	"=\341\326~\221D\222O\206\200[NV2\255\003vA&\003\177\345\024("
+	.ascii	"\205@\310\241\227\305c\313\303x\251\274Z\0259\336\ns\034\232"
+	.ascii	"QO\362\363\"|\203\367\220E}\274\303\236z\303\026\326\320\212"
+	.ascii	"Q\003\264\177R\376\222\271x\213W\367\320\031\375\350\340\242"
+	.ascii	"L\263\312\214w\202\360\322\037\034\316\3679\204w\fZ\004\020~"
+	.ascii	"|\017\244U\346R\007D\336%"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"e\007"
+	.ascii	"\242L&+\200K2\0343\26043\0204l8\030\211\021e}\201\0040F\322\002"
+	.ascii	"\376\360\377\317\005P\332\210k\0031\226E\314mG\262eJ\001\252"
+	.ascii	"N*\036\n\217\357x\2131\205\t]\333\325,\355\275\204\021\036\022"
+	.ascii	"\001\211\200\2742\020.-\226\027\207zPu\320\212\r\036E\373\241"
+	.ascii	"\246W\336\372\242\376\242\266\027\203\226\224\343\2741\303\300"
+	.ascii	"\202\300L\017I\241\ba \314\026jS\203\311V\302\226\344W\240\004"
+	.ascii	"\352\250\t@\021\2323\257\361\002~\224?jKn\"o\242\265\321\337"
+	.ascii	"J\357\201g\004\" P\"QP\353B\f\035\022j\f5\270\311v\331\303\366"
+	.ascii	"*_\212N\27736\363\275Bs\326\265\230\233\364\364\263\016\251\034"
+	.ascii	"_\354|\034\033\310\222 \022rW7&\026l4\017,\236\n\325\035\026"
+	.ascii	"\033~\250\315\221B\266.\353\356\2069\274\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 G\005\002"
+	.string	"r\004\017\030\220U\215\001\307@sUU5\335\365\252\220i\360\232\223\260\017pu\233\f*\201*\340"
+	.string	"\237\\\362\310!\177\334\2215\316\330\026\231\342\211\037.\303U\270\b\331\340\272`;\344\356\006\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\005\007"
+	.ascii	"\242J\037$pE\032\016\374\n\013KU\225\256t\377\177\375\257\377"
+	.ascii	"y\003<\360\006~\200\023jm\021\001\264\026+-\022)Sg\222\t\204"
+	.ascii	"\271\331\030\311\226\312\245.\017\307\337\230\201-\232\366\304"
+	.ascii	"\312\261.\332\255\277:\373\245(\233\255\025\345\032\220(\247"
+	.ascii	"~BT\235P\271\325\3050\247\362\251\375\235\347\274\022>*\005\005"
+	.ascii	"2?\243\362C\031x\b\372=\217\233\316=\3779R\346]j\257\312\n\037"
+	.ascii	"\334<\001\002) @\002\303\320\232\007M\006\262^DK&\236\321\341"
+	.ascii	"\337m7.\216\005\235\223\227z\b\2208\230R~\343H\322$,)\\\363\""
+	.ascii	"\001\027\203\377E.\230\2105\300/\021\354\232$\034\312B\363\365"
+	.ascii	"\232\340\301\270;}\266\230 \277\006r\356\201`D\252:s\007\202"
+	.ascii	"\026\263\007^\216.\205\366\f2\270\""
+	.text
+	.section	.gnu.lto_.lto.4f6253b0a424148d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.77.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \223M\004"
+	.string	"\264\007_"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\251\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\002\024?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.79.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\003?\202\210\200\020}{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.83.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\241\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\327\006us\250\364\005uq"
+	.string	"\005\001\006'\001\032\006?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.84.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\337\001\245\017"
+	.string	"v\232cG\340\224(\035\220a\006\"Dc\372\261\312\360\262\317cm6\217Y`\370(\277\212\361R\202\323\371%QY\204\325\364\341\265XZs&\315\362@c\001DT\001HDzki\304h\310\005\332q\020\375\242Ds\333\275S\nG"
+	.string	"N"
+	.string	"T"
+	.string	"\244K\3736\307!\376\346\345(\2734Cf\273c\212\037t\247\036o\200;\355N\200;\265h#\371\370\332\307R\240\300\331\331\335o\312\020\245x)\372\217\375\023\323\202\271<\241\260\273\2261-\026\367\274m\006\2663\330RC\324\177\341N\033\274\224\260\344\315\001dD\214\254\264\331#\214\2341\354{vw=i\354\337\374\362#\300\206\214\213\031\025\363\310\270+nM\226F\177\324<f\220WC\262\355\217\317!\036f\235\320\211q[\022Z\354\330x\247\266\320\235\206<\336L\247\322S\303\2659-\357\207}\004\203%m\226\262\333\204\235\036\004\202\355\244\006\036\210\202\032\223\001\263\017\367\261*\260\340%eK\376\312\331\250\367\250<R\222L\232\210\357X%\250\231\345:F\234:\250\025\351h|\305\331-\227\255\272\335U\361qH\2248\360\232\361\340]L\035R\027"
+	.ascii	"xB\004\225\022\007\322h$B9\201+\251Z!\254\252\212\002\271$\n"
+	.ascii	"M. \352Sy8\201 V\276\024\270\001\365\225B\226O\204\3005\204)"
+	.ascii	"\374T\265\206\037h\334\307\336\345\274\240\261\246\t\267\270"
+	.ascii	"\244wC\210uB\237]\227\314lw=c\350\002. \300\002\221\272\332\001"
+	.ascii	"a\302\023*\241\260\370\341\330\r\233\234\220B\352\346]\354V\214"
+	.ascii	"U%\210m`\035\247n\2700\322\363\230\322\\N\332\240N\250\340\022"
+	.ascii	"\217l\r\020\027\341\337\300m\030\276\025K\302\303\336\255\364"
+	.ascii	"E\313^\030\226\270c\255\213\030\334\002\2069J\210\225\353\313"
+	.ascii	"\234&k\202\261\272\022\225\274\2702\031"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.88.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\354\361\025\006yw\250\347\005yu"
+	.string	"\005\001\006'\001\300\001\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\\\205\240r?h\2227\200\""
+	.text
+	.section	.gnu.lto_mixerQuadX.99.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.100.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.101.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.102.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.103.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.104.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.105.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.106.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.107.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.108.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.109.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.110.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.111.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.112.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\215\004"
+	.string	"B\306\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\202\377S\221\315\263\373^\377\377\377\277j\202\211\361\365_\313\215$\031\3751\344\312\2267\204?\003\003\347\356\340\236\274j_n\f\236\3115\324\212\334\022|\222S\332\202\016"
+	.string	"\216^\334\f\274\221;\016\b\211%\246B\233\265\213\252\332J\214M\202\243\336\256\b\023"
+	.ascii	"5\003E\234\001\314\347\260#\334\260\306\321p\243\2031\001\314"
+	.ascii	"\307Ug0\032\rY\300<\212\305\f\276\020a\240H\316wqO\2778\217\201"
+	.ascii	"\""
+	.text
+	.section	.gnu.lto_mixerDualcopter.113.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.114.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.115.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.116.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`6\003%\017"
+	.string	"\024\026\002\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\305\205\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\374'\177q"
+	.string	"\275\312\026\301\025\274\236\364\247\037om\317\024\023\354\247(ki\006\325\324\022\350'\177g\330\021\274\020\017\274\247\037ec\301\337\016\270\247(a_\b\343\342\r\264'a]\343\346\f\260'a[\343\351\013\254'kY\325\354\n\250'\177W\275\357\t\274\236\244\362\001\240\247(kU\364\007\374&kS\325\367\005\364\246\037oQ\305\374\004\360\246(\177O\275\377\003\354&\177M\275\202\002\002\350\246\037KI\205\330\003G3\207\0024\206\002\204\002\203\002\201\002\200\002\376\001\375\001\373\001\372\001\371\001\370\001\366\001\365\0015\363\001\361\001\360\001\356\001\355\001\353\001\352\001\350\001\347\001\345\001\344\001\341\001\340\001\336\001\335\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"[\250\201\270\"fZ?\326P\223\210V\007\021 ,P\021r\003-s\"\022\200\205I\221\211t\231\305\255O\374\032|\331\026Q(\270q\270&\037_\0377\354\314\375\253X\356\307\274\313\364b\2522\316ZD\204\252\336lT\235\030\b(.\315\373"
+	.string	"?\342\\w\214\363\020\261Q\371^\253"
+	.string	"\220>\316\363\266"
+	.ascii	"|\370\350\263\225\"\314DZ'\257t\360\243\032\0010\303\364(\246"
+	.ascii	"k\324\300\302\304\252\261j\2104"
+	.text
+	.section	.gnu.lto_getMotorCount.125.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \354\255\006"
+	.string	"b\314.5@o\222\016@\265\220\330Y\277\034}\273&\310L:\307z\222K3\261D\361\377f\017\005\253\240Fw\325\367x,\212\206\213\236S\245\343\240\330u\020\255}\262e\no4\030g\302\352<\217C\203\365\300\360 \254\205\316\333`\022O3\360\025\301\301\236\347\272\260WmYgBG r\025_\222\226d\367c\212\017V+u?\231R\350\002:.Dx\272\312Ht\371-\204N\343\213Ig\372qt\002#*\n+\231\243\323K\246P' ?\350\253\017\020@g\3358F\031\017\f\013\223\226\314\355\271\215f\305\354V\244\230\020\024\026\215\024*\002$d\346\250\221J\335\365/\370\r\376R\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_getMotorMixRange.126.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375 \376\365\006"
+	.string	"\302\215150o\223\016\260\\$\013\310\250\352\036\301\301\233\2467\355\372k\3036>\305`\326\377^\367q\356\006y\373\367@))`p\240\202\340\007&\302}\026\252m#D\246g0\230F\302\332DN\003\203\345\260\020\037,\205M\314`\021\021S\360\005\241\301\"\347\272\260XqY\270=x\361@\212\257H\271\273\033zb\321\253\326\351.\242:=\030\300\201\341y\243\253\214|,\317u\036\324\370J\231\231\303\355\373~\220\240$%\241\313\264\030\265$\312D\322\361g_\335\217\202d\337I\034(T\025P\305\310Jf\306K\007\250NR\005\250Np\243Y_v\033R\311\343\304D\373t\372"
+	.string	"\0202\363\247}.:\354o\360\037\374[\007"
+	.ascii	"2\001;8c`\034\340]\363\264\020\204\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_mixerIsOutputSaturated.127.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\327\001\215\020"
+	.string	"6\237lF\360\320&\035\360d<\326\364\373\300\247\027\330\224L\331\222\013?\313\346\024M\235\273!IT\360f\320j\334P\2432\241\315 \255V\027\233!\031\233\331\215\f\037,^\346\240-\2046\312c,\016J\326\266\221\275\245L)X"
+	.string	"R"
+	.string	"Z"
+	.string	"\273\007l`\364\370q\001\332#|"
+	.ascii	"\355\321\266\023\210\274\f\373\327\201"
+	.string	"\345\036@\314n\204v?N9\034v-BM\230\217r\315\302\212\024*^\313\243\b\306G\366\302\204\327r\270y)\251\035\336\005\370\261\273\257y\256x\262L\321iw\235*^\206[t\333+\333\r\354\364\b?\2336\354\017%\025\306>\334\335\265\276\330NoN\227\376\375$\230\036\235\346\327\234\216\232\206Nk\372\034\227\321\021\nz0c\227e\350\306\266\210;\"l\277\354\315\006\211a\322\3179*|N\243G\020\027\246L\3733\037\361:\215yL\332\335PBg\0038\306Q\0021.1\031\032s\336\342\216\224\335X\001\222\226Tyf3\034=A\2070M\365?60R\257\252\237i\360\310\277D\033\351\365\263\035Y\016\331'\361\233\022\377\203[&y\225G\337D{\034)\203\030\227X\016=w\027Eo\036M\323\021\033\240\224\254\341\327\274\324\303\"*\027\312A\307\352:\025\311\n\020,H\215\210\204\204\230"
+	.ascii	"\264V'(\350\224\251S\235\254H8\227\204\b\253\t\0208\n+\024\t"
+	.ascii	"\227\352Z\234i\200Y\025T\035\347b\261:n\263\355o\017W_|\0322"
+	.ascii	"!\342\246\2579\tH\006\003,i\324\025\333Q}\212\251L\333\204\272"
+	.ascii	"\351g4'\216\3029,\007( \260\202\231)\272\r\026\"a\306\244\375"
+	.ascii	"\023\367%\fWp7\363\n\265\353v\2640\361\241\246\033#f0\322\203"
+	.ascii	"\320>C\0038\342\252\241u\226\\\216\373B\367\215\267\355\266\323"
+	.ascii	"\306.^\177\241u\327\266\026\026\023njc-\253\3231\213\324\250"
+	.ascii	"q\246)\007\272\250\257\355%\247\267k\225\001"
+	.text
+	.section	.gnu.lto_initEscEndpoints.128.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`i\004-\030"
+	.string	"\026\253\225K\240\324U:\024|\221\270\342{u\2664\317\327\032\315Wmp\273}Z`n\360\341\222\274\036\306\013a\251\355\352\266Yo\227\301\226\375\366wx-\336\253\361\323{\210S\230W\001`\320\227\2141t;\377\341\202\373\276}B\266\2242\005t"
+	.string	"v"
+	.string	"\215"
+	.string	"\315\2271?F\371%\314\207Q\376\213\371.\312o1\237E\371+\346\233\315/\231O\233\337\314\347\345\257"
+	.string	"\346q\204b\203 k\005\221<R\243\312\030'\376\357\353\275\237j\213&\352&!\351\024\r\251\265\236]b{[\322\346\336w\025\323\022\016s\266\344Y\352\032\362l\307\206@z\253\265\256\320\362\316\360\307\274\212\251\265\236\205\303\020{s\377;\370\037\340\2478\002\335\253\223\344\271]A\303\252\025X\340[\\\025\272\357\317\226\317\260+\277;sK\3565:\022\3718\311\265\326\234>\216\271\275T,z"
+	.string	"\271\310Y|\253\333\301\374m<\360\n\267qz\200\235\363\334\320\022-\250\207\b\220\312F\376\342\217\233\304\277\264\266\317O\3717\312\177\241|\027\312oi\276\255\3715\312gi\376J\363U\230Ok~J\363g\314G\241\374\223\346\233\004\261\226\035\330\033P\033\205 \201\214\214\271e\254\t\020\271\t\t\254IH\311\223\002X\227tO-\330\032N\260>\203\274h0p\365\253\033\031\254j\2603\230\\}\036\177\264d<`u\253[\t\302\302Xb\365"
+	.ascii	"\"\324\312\030\341\306\025\0021{\325]\024\254\222\260.\222\314"
+	.ascii	"\006p$\2025=I\271\364\367h\221\376\342\373s\n7\336hn\331\032"
+	.ascii	"\341\343$-\313~\241]VX\243\026[da\006\2073\267\244\2759\210\264"
+	.ascii	"\373\326\375\024\254\342\016\307\301\360r\037t\273\363\006\003"
+	.ascii	"\215N\303\205s\203nfw\342x6'\214\3555\034r\274\363\246\246\206"
+	.ascii	"w\276\212\276m\2373}\351E\016\331\350[\273\364\316\004\021Q\276"
+	.ascii	"\376\275\205*\310\326-M\231jm\353\325\254Wjk]*\005\201~NC\026"
+	.ascii	"\037=\241\225fi\252\024\254R\351\224^\351\332\024\255U\206\266"
+	.ascii	"\307\221\326\013E$\232uJ\233H\224\236\365R\354\016\035(\rsL\236"
+	.ascii	"\3440`\322'\262\226-\355\231L\223\246SA\240\037'\037c\250AP\204"
+	.ascii	"\23111\005)J\n\205\326\020\003\231`\212\033\020(\351hF\325\001"
+	.ascii	"\201A\254\3149\361\315\327+I\264\215\023+\212\251\203\247\017"
+	.ascii	"Iy\234\233\001-\360\264t\247N\207\302C\337\212\261\346\316\336"
+	.ascii	"\307\263\022.\013/+\264\233p\004\013\275\321YO2\251gRWG2\005"
+	.ascii	"\255ZV;%\230\307\314\357,\362\rghV\242\334`*\260@\241\351\321"
+	.ascii	"\362\330\334\360\243\036\201T3\247\215[`'\224U\362\361$\246\335"
+	.ascii	"l\035W\351B\355\276 \"M\0210\316\312\020\324k\374\364\321NS\""
+	.ascii	"\260v\237C\300\177\366qj\360\3166\217\032"
+	.text
+	.section	.gnu.lto_mixerInit.129.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"E\t"
+	.string	"\266QB= \005)\035"
+	.string	",\004X\n\350\302\362\007]\320\326\334L\240\007\033zO\207\230\t\f\213\326\032\266\031\353\217\002c\262\252f\002\004\320\020\004\200\324\324\005i\217\306\220\225X\3611\270\355\226)\005-"
+	.string	"0"
+	.string	"/"
+	.string	"\237\236\027l\237\016m"
+	.string	"\037W\3665\"!4\001v\267\223*\017\257\241\177\231\177D\327\352*"
+	.string	"\261\273V\321Er\313\333F\260\035a\033'\273k\371\262\037\373u\206^rJ;\273#\265\001K\2337.\266\017\262\025d\243\253}\330c\302\307T\376\354\242\300lv\307\005'\f|\212n\260\005-ojwx\350E\213Zre\235\235\250\364g.S\371-\006I\351\305O?\265}\036\260\230\260\264f\235\225\350\254\n\260\307\225\312\024\373\236\rn`x\360*\034F#\316\343\bH\026\237\304\307\036\007\222>L\247\016U\3020e\\t\032&\212S\347\201\034\035\027\362\267A\002;\324\367\201\035h\334{V\276<\001Cc\311\n"
+	.ascii	"-\242\301rE\306^\367Y\023gxK5\035\027\254\255\325hp\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_pidInitMixer.130.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`:\001\035\r"
+	.string	"\326\330XD\020\221\223\016s\271\241\301\212\2174\t\032\217\344\262\226Mo\265P\306~R+o\020K"
+	.string	"\323xl\373\370c\026\2020\322\250\240L\223\001\005(\002\302'\020\027]\364#\211\352?\033\r\324\032\"\204\354-eJ\001B"
+	.string	"?"
+	.string	"G"
+	.string	"w\371\013w\224\311;\273\247\026)v=\220\t\\\217\366.\240z\274\036\240z4g\327\334\363\260\227\331\240\002ccw1\355p\356\311\371'\361\216n\345\344i%\330]g\267\242\341\326\333\376\330V`?&2P\245\374\234+D\300\330\274a{'\251,\366\341\356\256\365d\037\365o`\372\202iK\323U\246#LC\230VMg\246\017\300\343\362\"s\261\233\341\303\261\251\250\002\204\355s\354\002,\037O;\n\3720\002\252\017\363\030\323\370-\326<\223\357<S=\246LG\203\346&\f\034Rk\004\337W\203\262[\372\250B}J\b\223\252*\213\224\031\327\324\253\344\260+\334\004\311\265\213\002\342\227\220`\341jy\364M\252\307\353\200\3760"
+	.string	"\"rp\300\303#\324\031\211d!\332\266\340A6\262\261(\264\215.d$\254$\002\204L$\004\243\2205 a\242\215\004\013y\254\215\2146\254D\3236\214\343\355\341\352\311\f^R%5\371B1!cXzUj\251\326\210Z\221~\"\006\031"
+	.ascii	"s3\241\214i\001j\030g\007\332\001f\002\2235p\035x\020`\007\233"
+	.ascii	"K\230\224\220\354\303\332\216aI\256\262\315q!\b\266]\314Tj\253"
+	.ascii	"\245\261\236\270\f\363\255F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.131.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\311\fM>"
+	.ascii	"\312g\320\026@@bR\007\367\355\234s\211"
+	.string	"\266\315\277\023w\240\003\\\021/`\250\377s\332\306k\251\367b\213\350\002\277\244\212\375\277\337\037\020\352.D\177Z1\020\253\354Z\341\314\0235\231\207\021\243\304\356-\223L)\\\001G\001a\001\316\307^\027\304\321t\033\016otl\312j\306U\346\300\333\276`\364\266)\350l\177k\247k\022:\273\333\204\036/\343\326\366\271F6T\210\277u\013\346\r\355\355}\3379N/\343p\355d\030\320qv;\231\3668\227\023\342\325n\343$\255\276b\026\020\253oNo\273i\364\326\311\231\256\267\331\227\256\267\355pB\272\221\336\266Hh7\037\257\256\275~e\35323\350}\337\347WY\032\025;\351\271\352\235l\241\236\264D:2*b*\211\222H\245\241\243\261\350\266\3711\264\275H\265\344p+O\0321-Oj\233c\303K*cV\034\251H5\347P\210\325\267B\2651+~D\305K\303Fk^\264\346\314\f"
+	.string	"M\016\231\202+X\231\235\360\250h\230(\027\207 \301\342\024\b\r\3469\326\tN\026\251\250\214=q\244G\237\270R^6Q\203\307\261n\240\001\236.fX\360\220\001\26513?\372\205\2315\301\306\234\001\031\312\271_\330Y\256\340%%\343tCpq\013\023w\263\005\2700T\245\030W\3762g\364\234\316\rp\t;\303m\206B\223C\346~ae\231IG\312\236ld\342\257\024\223f\247\367}\335\315\361\227\330\026\306E\252\367}\033{\211\215y/y\267'v\367\212nd\213v\356t~\234\352A)\034D\212Q{\3258\022\226\316\013\330\026?K\357v\356\024\305\206\355t\356G\342"
+	.ascii	"\3628\276([\373\323frs7\302f\005\224bB\276\324\023<\314\331\351"
+	.ascii	"\235\261\323#\374W{W\265\034\200\026,\332\367\017\367\377\205"
+	.ascii	"5P\212\t5~\377\177\357\"k\302K\356\302=\360\376\336\225\267\205"
+	.ascii	"\023\273\335\215\353\271\200ae\345z{\340\035P\313\366\374\312"
+	.ascii	"m\317s6W\355m\215U\003\273W\r\327\333\244\265?Q\234\3308\016"
+	.ascii	"\034\277\027\033vW\267\360O\273}A\226\354\240\376)\335\021\246"
+	.ascii	"\334\352-\325\342~\020\325|:\342>\340w\336M~\365fr3\336K\217"
+	.ascii	"[\251\305\315lq'\265\270\227-n\244\026\367Q\213\333\310\305]"
+	.ascii	"\224q+\0377\221\213;Y\304\2154\342\0362\342>\026q\033]\334E\027"
+	.ascii	"\267\353\342n[\3349\343\376\214\033g\334>!\300 \035\032}\357"
+	.ascii	"\213$\361\360\235\323\346eq\253\373\235\373\325\335\214\347n"
+	.ascii	"\2072\202\327H\250#P\243Wz\205OK\263\020\266\221PQ\250Q+\314"
+	.ascii	"hw\305\252i\227\354i\270\262\r\006\3613\355i\216\\|a\272\333"
+	.ascii	"\353\362\213\346\315m\201x\r\220\004Y1D?md \362\351\333@%\247"
+	.ascii	"3\375\327\023}\206'z\357B\314\303\322\344\037\313r\"\323\373"
+	.ascii	"5O\317\213Z\362\351\375\312\364OO'g\21030\370\334_[w\207\300"
+	.ascii	"ZU\004\360\233\257_fCo|\344;\227\027#\357\254{\374\241w..L\177"
+	.ascii	"|\246k\027\"\326\235,\233\366]\335\362\256\263;\033D\372\021"
+	.ascii	"l\t\027\245\326\340\032?\313\032\230\301\0175<\375\031z`\376"
+	.ascii	"\0212\376\023`\\2\353d\350\247\201|\220\200\265?\312\254\022"
+	.ascii	"W\216N\360\370\323\276r\213\237e\345Kf\223\024\001\341;^\204"
+	.ascii	"Q\274\301\375tx\256\215qB\017\004\326\336WJa\320\373\200\310"
+	.ascii	"\"H\270N\302\365\266\370Oj\034XV,\231h\004\216\361\247M6\267"
+	.ascii	"\371\235?\302/\375W\267q\227>C\240\323y\026\244F\025\305\206"
+	.ascii	"\356\356\330;\301>\305\346\273\231\006\276\364M\005f}\334\027"
+	.ascii	"t/B"
+	.string	"\367+\267}\367\235\013-\260\375%\3002\037zx\205\204v\177y\356T\t\370k\257\343vJ\260p\275}\301/\263\272\241(z\3254u\356\244\214S\350%--\317\375i\243\350n\214 \277\253Y\001\273O\370\034\024\037\276\374I'\370\265{\204\367U=S\353\272\005Fa\317\371R\264\267y\333*X\354\370'j\\4=\003\210U\f\034X,\334\216 5\001\306\013\t\020 D\035ay\303\210\312\262\002\202u\343\331c\306\025\226\r\031O\034X.n<ad\361xF\001\350\034:\254\262\236=r\344\310z\"\253Q\377)\235\242\317\234\350ou\273\325\335\315O\354\r\026\016F\223~\332\305@\244\251\377\300#\247K\375\027\037\227\352\223z\267\346\345\324\273U\352\247\n\244\255\361{\360n\355\206>\301V\372n\2511\025\263A\247\320*P*\224\352b*\270J\337\265\2675\324Jc\261{5\326\365\366\301\017"
+	.string	",K\366\261\3717xS\212 9\335\255~\001Jt\316\363\0275\334\267\306\257\214W\031\342\025\372\t\300\327\304\335\320,\320-\330\275\332ik\357\250(\352\333@\246\323\233\232^\251\350\225\360\232\336\357"
+	.string	"\355\256\202FQ\357wM\037\005\307|)jQ\222\236\371Y\260\013F;{\222\304f\371fM\312\220~\371\031\320\027\254\204,\tRRv\315\321\213\205!\351;\357\374\276Q\004F\177\364\271\020\027\227-(\030\f\326w\t\326\336\367\235\320\335\037\360W\025\201?/\243O@\215\303\223\333;$\004+Bb\263~\314\237\242\307\213>\313J\244\350\005P\313\334\224?\215\343\312\177\201"
+	.string	";\275\016us\273\241pP9\354^\312\207"
+	.string	"E\372Z\355n>\024\201\013\250a<\004\031SHFDD\222$IkA\005\304(\307\260;\017\022"
+	.string	"fAh\225\222:**\024\206\375\rs\322^\276\224\340\253\007\002\355\242)\376\321m;\026\204\005\300c(cr`\026\025 \230\032\377\022\006G\226\371\034Y\025\252H5\333\363\310\335\202\274\3747\206\021\255F\256]\352\276D\354\240T;?\3245\303\002\232\323`\367\202\2428\220\316\215\223&C\237\214\243o\366a\177\bI+\347H\246\230 \247\322\372\307\316p\224c(\231\016\220W\2301W\tTb\262\244\020c\007\322JE\365\214\026\210\024\271\234Q\304\303\022.\276\260e\304\\F\200F4\201Q\357\242>\250\341\304\275?\332L\365\206\352\375\275WL\235\271I\013\005J*,\023"
+	.ascii	"\2177#j\335\365\007\020\023>"
+	.string	"\270jP\324|\f\002\314S\016F\244G5!\036\314\255$.\337\265\016\366ed\275\272%\332\033\375\207\257\373\\\304\266\224\311\342\3255\244\316wb\334@\255\277\343\255z\013\260Q\375\265)<\373c/\310\017&=i\313\211\232K\245\276\007\354\347\316\206\232\314\272}\364\2244\355\025\211\247\024\2350\261\345\311\215\006\300\376\237\016\313\f\277RV\006\013\032\203\017\226\336\206\242\2741\356*\022\032\254\240\311A\022\370W\224\214\312\316l\203\rD\026HU3\304dBY\013(\374\241k\245|\354\242f7!\324\342\2164\370\346\317J+:\310\370b\221\253\025(\355\270\337\333E1\3343\374\"\204#\250\036\331\363\002\037\210\013\331Wc-+f\205<=z\347SZ]\026\025\025\220\212\266\330\323s\247h\025\026\206;\230k\224\fB\210!@zM\005\2548[\346[\036B\025\021\230p\207\204\210\024\004\375\337!\315\016"
+	.ascii	"V1Y$\247WH\220\234#\344FMw\335\346hM\001$lQ8\323\305\257\204"
+	.ascii	"H\256\277f\252\335E\363f=C \017>ipD\364\207\307\262"
+	.ascii	"\241\0165"
+	.text
+	.section	.gnu.lto_mixerLoadMix.132.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`@\004u\035"
+	.string	"Fv\275J\260\324Q:a\241\205JJ?|\036?\315r\225\003Wl=+S\351N\317\340\305\362\212_\375\313\2513o\026\250\367\254\356\301\273\273R\020\034l\354\375\303\317^\\0H\3201L\361\005tc\312\003\223m\337J>!D\356\224\002\245"
+	.string	"\235"
+	.string	"\247"
+	.ascii	"\346I\373\314\033\357<\265\377\343@~\336\363\320\260Zi4\tk\255"
+	.ascii	"3\276\231'c^+O\216\207)O\372\307\266r\037\257^\212\213\b\270"
+	.ascii	"Uk=\267\306\213/\276<\373\350\273\307\375\271\371*a\344\270\364"
+	.ascii	"\307\377\235\"E\001\335\034_*X\350x\004\256+S\207\322\321"
+	.string	"Wl\007\322K\023\351\260\021&)\n\353PGpu\364bd\200\325\003\306\177G\300\343(\211\222\343\250\205\030\004\300N\305(\241hH\210\321N\210\216;\\|\377t\272\244\370\243bd\347\342\364U\241\326jZ\264kq\307n{h[\203=\276\004D3\370\313\322\366C\235\222\020-\272\026E\310%K\245D\333\007D\227\311\376\202&\252-\357\222m\253}\310\017\363\336M{\357\177y\360\236\035x\313N\035#\251a\224\332\034\251_K].59R\217\224z\227\232.\365\007L\230\242$#\007q\251\370*\213b\227jEN5=\370\003oB(\313nIb\206|u\267a+\353\307\326\315w\372D\374'\313n\300\323\006zh\002\035\231A\251\342\225Z\253\314Ig0OR\231}s:\251\357B~>$\305i\265.A\021\326\352\233\261\205K(\312q?\374\354\233+\301\261\361j\035\252\261\315\341S\270"
+	.ascii	"Y\265\016E\020>\311\2101'W\276(\2676\033\275\377\036\253J\272"
+	.ascii	"\"\227\311/\255\265\355jQ\231\313\326\310\303R\266\027\264\206"
+	.ascii	"(W\024\331V\b\242\304\217\265\326:\332\366@\331\332\366:\245"
+	.ascii	"\0031\212WHl\323\004\266\211G\031\211\001^\255\265\306?\342\303"
+	.ascii	"# \013\307I?EyR\001o\213.\314\356^\347\364rS\225_\272\327\361"
+	.ascii	"\220\355\227V!\352\n\242E\317\252vW\225\022w\233\b\227V\254e"
+	.ascii	"(\314\370\323G\0374(U\361\212\266\357=&\210\006\270\363\354\334"
+	.ascii	"\370\3400\344\344zxN\330\314\374\240A\215\315\007\b\016\034\320"
+	.ascii	"\320|n@\350\340H\333\320\354\334\370\340r\316\036\02188\022!"
+	.ascii	"N\035\234\207\234\323f\207\347\244!\340\\\211\233\235\263'\227"
+	.ascii	"\3339e\276\372]2\253zX\005\255\220\271L\016PT\326\226\274\001"
+	.ascii	"\223\371\314\312\257\n\266\261=Q\227\335\341T\036f\236\340\024"
+	.ascii	"8\201\355\214\215\336\270e\266\017\236\353i\213\222Wm\037\234"
+	.ascii	"mm\202R\2143)a\003\201\347\343\224Gtx\fl\025#\030A0k\356J\351"
+	.ascii	"\234\312\035\367\365\"'\267\234-\271\345\220\250\013\352\246"
+	.ascii	"\026,V\\\262\274\252x\204\245\\&\377\005\202XR`\033T\2501\030"
+	.ascii	"\2071\350\230\231\t&\232\321\264\260\305p\002\031\243\262\016"
+	.ascii	"\020hI\242\2441\026\323(#\335\036\332\367\206f\022\251}(\006"
+	.ascii	"8:\306\310n\247\301)!\312S3\230'\276/$\266*\346\304V\262)\226"
+	.ascii	"\031\332\016\325lQ\03157\002\352\177\314\222\252&33\355\236\025"
+	.ascii	"BF\205\nF\354h\341pZ\257\201P\377\310-\262\213K\344\360GX4?I"
+	.ascii	"\310D\206\024[7\324{Zn\340ok!I\300T\274A,\355X3\274\307\250S"
+	.ascii	"4\006\345o\005\317n\301\270\320\227\224\352\273\265c\303\355"
+	.ascii	"\036t\334\2102\317\023\212\241\303\303\344\204\326\255&Sp\376"
+	.ascii	"\362\224\n"
+	.text
+	.section	.gnu.lto_mixerUpdateMixMatrix.133.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\242\006]%"
+	.string	"\nC\200\016E\200^Q:c\r\334#\256\224\207\245\32680\222\336?RS\354\215D1\21025\362I6\272\375hX\244\023\317\3660D#\207V\355\217$qb\031\355Sv\253\232\255t1\232\002|\301\276\225|B\210\224I\006\327"
+	.string	"\276"
+	.string	"\335"
+	.string	"kK\3322n\031\364*\210v9\206\t\201\336\374\263\374km\f\002\025i\344~\270\232\245E|\242\001\275\231\364c:\226{\245'\322@\257\202\003\200\\Y\306j\255J77\t\275\231\273\200\363fy\243\363\346\246\273y^\034\326\037\261\330\330\022\250\326\272k%{{Y\374\242\234\376f\253\321\320\331i\226\315\351~\326\224\200\020\022\270u\365\333{Bn\353\n\006)saA!\\+\033\214\215\371\363\260`\220R\200\226\023\340\277\216\324\025\004\302\264rVC\313\311\303\202?\312\t\202\306\310\034\314\006\243HIr\370\370l\326\004v\223+\f\331\221\034>~\362\270Y\003\213K\035o"
+	.string	"[\2762Wk\375\3279k\353\307<k\252\265.\003\267r|\207\276\273d\273+b\367\354\020X]>N\236f#Y\356\337\205\200\3620\215/#\251\265\247\200\250\263\270\234{h7\352`R\240\265\376\230\366^\376\205\267grsWH\231{\251\363&w\204%\304\036'\227\333$\211\372\305\347z\\V\226-d\003:\274\252\264\325\371~\022\243\330\217\005-\312\273/`\360\201\357\3770\342\353\253\3456\204\302*\227\355\026}\334\302\335O\030\n\032\333F\262\213t\342\367\310\3445j\336\242\363\022\335\370\3051o"
+	.string	"\346\035b\336\233\311k+yk\315Kk^\264yg\315{6\257\331\274e\3636\3632\363>\001\202)o\254\364\324\252\225\034T\335\230d\270n\374\211\347\335'\005\231\366Z\366`\001G\002\3034\313\373\360)s\324h\323\372\334R\341d{t0\346\264\244\007m\007Efx\366h`h\341w\354\3109{\326\247\034\f\257\263G\035\035:N\016\206s\316\326\325\031b\312\331#\201\f\217\003\207\rp\017Q\227m\366Y\006\253\313\267\341o\366\250s\343\264\204,[\267\204xC\006\t\353f\263\307\003\273\034\276\246\203\200\233j\232\020p\317\256\207\247\331c\204a\255\225iwK\034\215\223\216N\255u\202\231\237\371"
+	.string	"\"D\210\363f\377\006\362Gw\22735\266f-\\6\367\370\257\037\207\020P\241r\217E\235\265\253\364\033O\301\310\301^J9\302\310\036F\374\342W\315\251\364k\371\230'"
+	.string	"\303Z{\007\356\217\0273\202\304\323\223\t(>psX\310\035G}\342\0265Q\037\265UY\274SMUMI\001\330\b\017\230\240NH\200"
+	.string	"AG\324b\212W\005\025E\305\273\020\303\304\214\333B\351\250\242d\360\244vU*R\360X\240\330\265\340\231\220\332AQ\301\330\351\n\354\224\213(\252]\325\324\024\325\316V\354\335\246\364\206R\346\244\266t\243\316z\242\342\246\327\276\r\320\373BOZ5I\271\270\374"
+	.ascii	"\367\030u\200\363\326\302\357|^dlC"
+	.string	"\271:\324'+\002#\bK\255\205{\353\3562\212-`\334\323(\347n*%\245\302\007\336\372\205\221__\355\277^CJ\t\243\265pib3\244n\261S\3518\\\333\332B\233Z\333\3726\n\365\016\350\201R+{&\233^I\275\370\300\324\353\274Yk\232\217\036'\221Gp\335\324\343\262\227\350\"\365\215\273t\\#\365\261\210\3708\271\013\212\364\240\371\331\200\201\250A(\005\035S\246\202\031\021\031Ia\322\034\300\002\021\2313y\020P\247h\322BZ\003\210\300Y\271)P]\254\241\212\274\031d\264f\253\013\311b\206\304\241l@\n'\347\361S\247mN\032\207m\331\320=\3357\320\213\243\200\002I\204\336\2024\343c\357\t\204\301+yI\267$ @\311\376\233T\343%\360a\177^\2102\363FV-Q}^\255\255Tx\036N$!\2432\272\"\373s\353]\0038\006\231B\236\2445\265\357\254\343\007\005"
+	.ascii	"a\021\354x|7\270\335\310\201\203\031\031\364\361\322\204w\333"
+	.ascii	"\251\360\347\226\262\262\262\342=F\322]\004c\235\0211\355\354"
+	.ascii	"\375-\0053\320\334\277$\235\262\f\274\215-\345\273kMg\013\330"
+	.ascii	"\247\032;\350\214d\344\377q\371V-X6\020mZJd\347^\247\366\245"
+	.ascii	"\253\021\315PR$\361\220\323\257J\237\t\016g\001B#O\252\210\234"
+	.ascii	"\233I3\224J\207\313c\245d\314F)\025"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.134.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`g\0015\017"
+	.string	"\346\334fF\320TQ:\241]\360`\277\261W\2340RH``(|\036 M\351B\340t_\221\020\235>\241\213\031\361\277.q\360\370T8j\300u\341\005Wx\t\265\321]a\255\377\013)\022\356C\252t\373[\262\267\224)\005P"
+	.string	"P"
+	.string	"S"
+	.string	"*{d\225=\344_\214},\210\t\034\240\335\345\024\206K\016\277\033\246\352\021j\252\374\232\037\b\222u\256\325#\204Fh\036"
+	.ascii	"\027\t\030\241{\271\371\367\204q\265\022\316\210\271\376\273"
+	.ascii	"\202 X\347\212y\206Tv\327\331\271T\334\333m\247lK\260/"
+	.string	"#=\2334\373[\245\312\330G@\003\004\310\372\262\357yw>\375\220I\017\236\021GvQ\324\222\354,\356\240\271\367\333G\231\221~s\233\021\n\017\311\376\347\327\270\r\325=\357\210V)D\260\230\017\221\335%=:\201\350\361\344\003\266Gx\001\333\343}\233\013\236\272\351K\260he\315&-tzVm\2078\3141\002>\273\013\301\307y\016\017\376\314\243?\270\270tEXY\263\177\3438\034\363g,\3029\371\356\321w\216\032\020\262\202\2255\227\310x\250\376\320\361:\241&\375\336'\270`%\315\377\016i\274H\231Nn\300\340\201\311\202\203\224\224R\200\323m*\245V@\234X\270\226\f\030N\032.p\033N\025X8S\252\003W*`\024\207\225\024\327\202B\245\270\321\267\327\227_s\221\314\307\214\245\255\2502\016\375\350\246\372\223\244\247\302xgK\245\360\363\222Hd\252\302J\332\341\356.\334\364\336O\002\035"
+	.ascii	"r\311\022\323\232\317v\370\232\357\246A\337\232\206\313v6\002"
+	.ascii	"kBC\024\206]\3210\013\341\301\346\241RD\324\034\316\230\003c"
+	.ascii	"O\031\344\224\331\025\233[\rL7K\222e\355\300]\034\026Q\366BU"
+	.ascii	"\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.135.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\013"
+	.string	"\226\226SC\360r\234\016*&\313\324\341S\302\211x\036\032\265\334\022N\2656\006\205u4\243\325\216\007\033\376\310b&q\243\231\251\001\213a\354\260\360\2608\3340\342\221\243\272FD\300\t\207M\215'Z\361\223-eJ\001<"
+	.string	"A"
+	.string	"?"
+	.string	"'\235\215\271\263m<,\331\243\324\360\300B\307\356jZ\242\313\356Q\263\363/\036\314\007z\217\227\210+"
+	.string	"\020$jv\367&\317\020\320\224y\361\354\256\363\003C\334\326m;\260\335\300>\202G\335\361\351_\005~\314\340\220c\367\303\252\307\246\254\030'\216\372\355oZdW\361\023l\343\"\263\037\372(\236\242;\3122.\017\304\365\002e\207jw\263[6p\335\322|\200\345V\274"
+	.string	"\313\255\373\001!\366%m\322\205\374gU\357\016\2753(YQ\251\236\374\r\226\353g\005\r\220\\qL;\203\206\374w\355\2200\251\347L\271\241\222\031Q\221\024\225M\036v\350\245\236\354[\005\003G\312Jb\007Np`\001\350\243\240\323\341\004\330n\020\207\013a\330DZi\202\204\215B\004\255\302\006A\244\2018\222\306!\340\221\205\020\247\225F#N\303\302\275\222<X\245:\250\311\231\221\233\034\023\361\021\365\344\207\307\230X\215\310\354Q\003\017"
+	.ascii	"r\3112\3236\246\343\2528\351\206\005\031\007\251\205\023\222"
+	.ascii	"\022m%\314s\231\235,a\007\227\t\030p\250\311\333U\312"
+	.text
+	.section	.gnu.lto_writeAllMotors.136.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\205\002-\025"
+	.string	"f'\211J\300\360*\035z\335\341!7c\b\005\350m\314X;S\030z\367\277\216zt`\370\351\252\374\3639\021Sq\261e\344\325\346\360Mpl\203\242I\377\277)\212\242\350.\217\f\331\305xm\235\231\035\246\363\002\376\317>![\356\224\002t"
+	.string	"l"
+	.string	"r"
+	.string	"C\031<\326\232c\004\243\326\212\300\007:>\002\370"
+	.ascii	"\362\343<\b\371\3216\233\006\001]\275\225\370fd\212\236j\255"
+	.ascii	"\260\005a\217\323\337M\247\355)r\244;m>\321\351\316\314\021\257"
+	.ascii	"\274=\305\341\344G)CC\2001s\244)]M\210\217RGM\240\210H\027~\322"
+	.ascii	"\224\271I}\275\357\205\037"
+	.string	"wv3xe\3573uRk\365\344\2256w\307m\367l;\260\247Os{\354\233\374@\021\275<69\275R}\350O=8\275\343\364\244\323\377\360\360\001*\277S\252\265\246x\2436\215H\"\036\374\355\273F\274\374\237/4\313\345{\331\366S\274\310\366\240\223^m\352wO\276\r\304Z\253\310G7\350\370\030B\017B\036\b\363\237W7FA\265V\326G\377\004\214\315\3728Y\266\213\3475\247}\023\027\262=\017\2264L(\317\335\275L\016\337\305_\254\370@\226\261\260\254\352\0067\213LtOp3\352\264\326Z\251j\037|\310\353tU\373\230\017\271Y4%\256\355\013o\341\243\326O\255\325\304_q\0263\037\350\243i-\363\274\026\362\343y6R\373\235I1D\334,\372*\206\036v\205J\272r-\362\007\317 \0077\243|\341i\t\035\327\260\303\260\316(\373\227\013\262\273$\301\202X\212\002\022\222\221"
+	.string	"\261\331tl\244\246\202A6\203\275LX\221Q\220"
+	.string	"\253 \2130\203\305j.\260\221\002\246YP\251\301^h\264\032\214\365\303}yvC\022M\270\315\271\245\26388R\002 \240\314\363\274{\263\201\236P\020y\027r\265)(\234Z\323\007\306T\346y\253%\311\311\355\315\223\251FK\007x\224%\026N\f\031D\377\317\3207n\217UN\253\332u\232\"\247KCw76 P\002Q\350\256\007{\262\304\326Zn\207\3132.\350#\030\337w\340c\017\326wd\312#\013\355\306\257al\334p#\364B"
+	.ascii	"\326\004!\365*\023rkS\261\004C\342\313\233I+\264k\202\340cC\027"
+	.ascii	"\345\356\025\370VtlA\234\2219l\273l\263\373`\205\223\205\305"
+	.ascii	"f\264m6VfV\274T\210z\030\001\033\326j:\020\027\246\b\264p<\261"
+	.ascii	"\225[\367\346L\224\265\003\234\262\351zO"
+	.text
+	.section	.gnu.lto_stopMotors.137.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\r\b"
+	.string	"\302\21777@o\323\001C\265%>\210;\271\003x\215\002A\267\017\032\244?\377L\206\013K\177s\324\030\223\213`\\\365y\230a\030]\004S\321$\320\321%\2443\353'_\312\224\002\366t\266\217\004\226\305\320\202\002\326\220\020\035\260\203,z6P\354\bX{\370l1\244i[\274\300=f\225\244\tMP\"\235\360\225\005g\310\330\231\206`\262R\325\006A\344=\017Ph\347T\325\217^\256\251\257@\361Gnr\211\017\342\b\237\362\336+\337\247\314\253\353FC\224)s\302R\270\331b\203]*\207}\314*\311\326\264f:\237\276\005\360q\361\335Be\027#\345\262\250\352$\304\366/s\366\312A\217\r\020\331\030\221\260\354n\324\216sO\316\177\351\033\357\353\236\226\301\356:\275/\343\326\333&\260\315\261\235\022\f"
+	.ascii	"3\241\321\037X\317\334\260S\r\n\037v\261\335\242lqM\364\031\002"
+	.ascii	"y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.138.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\275\007"
+	.string	"\362\21656@o\323\001C\265\345\034\001\t\330\270\037\026\222\371\231\362,\262\361-w`C\177srD\331C\021\214\253>\0173\f\243\213\032\217&\201\216.\003\344\266ib\245L)\376x4\220\304\205A\221B\302\305\200"
+	.string	"\033.\003\f~\264\020\364\b8s"
+	.string	"iP\224e\032\264\274}f\325\244\371TN$\2350'\255\224_\225\275\200\035\240h2\325~\b\345\243\007(\224\3635\365%\030?\344\"\020~\207#F\371x\312\037U\247\256\233\013R\306\270\363\235|\233.\266\307\245b\330\317\254\232\354L\347\323\2578\034$\335\343\312nE\314\313\236\250\022\017\333\267\274\331,\36746\340c\2434\322\262\273P3\276=7\377 \337\304\216{\002\024\354\2563v\026\267\3366\201\355\216m\223\013"
+	.ascii	"3\241\257\0378\313\334\260S\r\003\037\226PV\273&j\f\201\274\f"
+	.ascii	"\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.144.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\363\f\2658"
+	.string	"JZ\354\023E`\330R\007_*\004z\237\370C\367\375\257\346O\243\357_\255P\366{\b\273Xs<\3264+N\373\331\253\257\315}L6=\\\261\363\372\0339\314\264\216W&\327\312M\031\302\330'\204\320\200l\255\335r\313\224R\024\001\027\001A\001\035\224\277\201\334\357\237\366;@\376\366\311\337=\371\233'\177\357\264\337"
+	.ascii	"\362\267N\376\316\311\3378\356\367M\376\266\311\3375\377M\223"
+	.ascii	"\277\227\371{&\177+\335\357\244\373\215l\277\217\356\267\261"
+	.ascii	"\375.\346o\267\375\316\370\373\377\333\2516\304\020SA\346a`\336"
+	.ascii	"W\254\214\230\327J\356{\363:\367\377nw\273N\036\211Y\340sN'\365"
+	.ascii	"\272\306\372[\366\276\025\302\353^\341\373\276K\236;\311\350"
+	.ascii	"\231\351:\256\347\326q\\\317-\355\336\342wm/\317\225\256\232"
+	.ascii	"w\370\276\257\023\337p\251\333\324\320,g\224I\344\321Xts\213"
+	.ascii	"_\332^\214:\202\221u\271M\r\r\232/}j\365\031\264\226\311c,\355"
+	.ascii	"\2253x\214\311\370d1j\255\314\352\310\263!\036c1\376\370V7\016"
+	.ascii	"\255\225\231y\321\254\372n\253T\230\344\213\377\215\301hu\304"
+	.ascii	"v\200Q?\267\360vIv\"I\366\365\370o\254\255e\276\357\353v\376"
+	.ascii	"ad^\377\305\250\367}\373\301\310\312\274o\274\333\177\272\233"
+	.ascii	"D\267\222*-\022j!\022\033q\022\273c\250pG\214l\340P\234\370\023"
+	.ascii	"\007\017\250\250\\\317G\354G\212\330\210\275J\206\211_\021;\007"
+	.ascii	"\233\256\244\261\306\367}\021\264'\361>\b\022(Pp=\273x\307\332"
+	.ascii	"w\2263n\347sl\205\022\026,\270\236\213y`\331i_\360#\030\214\357"
+	.ascii	"\373e\240\275\210\033\311\320\356\346\271\253\236O\327s\306\256"
+	.ascii	"g\255\233\261\346-\220\353\204\335\316\215Y\274Aw \367\261\023"
+	.ascii	"\356\257\232y}\231n\317s=\253v\267\276\312\312\355Y\256\347\307"
+	.ascii	"@\203f\323/\323\276\007\370\342\357\337\367\355\302#\\\307Ax"
+	.ascii	"Y\276>L#\237\371\272\226\333\r\365\360\016\346\330I\355\013w"
+	.ascii	"5\022`\213?lw?\221\327\371\001\265\351'\366s\354\357\365^\024"
+	.ascii	"\"f\337O\354\276\363\362\366\305l\335\336\276\357\3736\256\321"
+	.ascii	"=%\025\005\365\204\277\235\274\316\273\231\277\233\3627S\376"
+	.ascii	"^\312\337J\371;)\177#\345\357\243\374m\224\277\213\334\357\001"
+	.ascii	"\3557Q\376\026\220\277\207\3627\363\277\205\362\007\003r\274"
+	.ascii	"\214?#\302\006\254\017\343\315\004\340\240\301\276\304\032\250"
+	.ascii	"w\001\205\217\006\rW\354\264\035v\031z\262\027\033\342\302\374"
+	.ascii	"\024\037\306\\\352\241\025\"f\023\004\001\314\243\311\342\355"
+	.ascii	"\202\217b\271B\215\305rFH(J\324S\355\242\236(\377\253I\320O\377"
+	.ascii	"\r\362\003\"#\006H\311\217\215\273\033\312\037\234\f\200\177"
+	.string	"\302\004\300F\203\177\007\230$)u\250C\312\316\007\177y{C\260l\017\346\301>=\230'o\007\273\230\007;\025\316\210wp\306B\007\300\213\213\001`lH\245\"D'\253\240\260\261W\035 9[\b\033\033\327|9r~Wh\020\"1[\343`\027;\016\274*7\030\007\267cnpQ\0135-\207z\246\206\230\3151\204\210\223\243\021\263\371\b\267]\320\007G\370\220\312I\345\\\317\007\004\275\\\327\336Ot\2454),\212\230\255\035\317i\260\t\274,D\337-\025\"\245{\007\243\301\020\324\274pW\334\024\366:gb\221\332M\341\243\301\353\022P\301\225\005\313\0313\270\n\203\346s\260\354T\212Oi\254T\3635\237\353y\006\007Y\315\004\001\321\376z\t\335\2176\027\263\265\022\273x\013oJ\022+qXWYXm\b(\007\334X\315\017X\321*-\347\026TK\013\372\214jU\341.\340d\340\251\341\211"
+	.ascii	"\201\246\215\325\325VU\204(\210\016[\r\2548D\243P.\254\t\321"
+	.ascii	"-+"
+	.string	"..\020\317\236~6\271\254Ddi9\243XWY\03468\267\262\252\264\234O\256\017\316\246OC;Xq9\243P(\2273y7\365\366\3055\332)L\225\b\r\024v\"\254\022\231\211rR\305\032\247\360\273]\311T\2615O\370\347\256U\252X\244\024n\3420c\340\231\225)\366\352&:6&\274\204\233\2040\341#\220%\244@\0306X\316\020\356u8\213\277z\r\266\301\356\227\367\341J\270\006\367S\275`\375\355\376\257\367\235\366\210S\322#N\350\204\b\270\267=\2707\037\266\250\321s\016\365\n\207X\250\204\273\233\371u\367\2729^\230\340\334!\023\335\202\374\257\243}\316\351\2447\336\255\261\355\335\353\206\223gF\3156yn\n\323$\254\204\235\n\005G\022\316\261so\013|\361\327\304S\033\244o{\033qH\370\307\272\027Hv\3645~\355\b\377X\313<\251Y\237p\321\030\243O\363+\302\002\260\321"
+	.ascii	"\\\204s\036\265\220\b\007\201,\250\221L\307\020\232\231\021I"
+	.ascii	"\222\244 \311p\321\005\304\020\005\025Z\007\021\0201\263lf\244"
+	.ascii	"IA2"
+	.string	"\035\016\377\024\314\246\376\332!\306\212\376*<RL\0056\202f\020<\311$k\262JI6Hj_Cp\007\330\206\312\226\3008o\035\342\242'\240\002\255avo\276:A\314e\0366\2004I\002W\230\255@\246PQ\351\255\236#\353\316 \327\004\021u\307\253B\225x\3741\366\226\254\371wT\361H\252\270\241\202dt\222=\302\205\027\303 6\322\276\005=4T\007)\364a\034\023te\202\201C\200\215BJ\020kR\251\013\006m*\3015V\200\301_\033*|\341\013\344\350\037f\273\345\237\302\344\031G\034`F\242d\355\217\310\332k\2325]\035\367>/\262%\236\314'k.m\202\314\206\256\203c]\255\231\340\260\276\032\272>]\f\312\334\327\3005h\335\234\263\371\224\367==\005C\223!\310T\2202\035=\005\223#p\251&\033\020[\225\365\030\302\340\335\302\366R\316\230\213h\220y\220\345\020\2168"
+	.string	"6\346\256\327)"
+	.string	"2\310\332\370"
+	.string	"\240\003\340\356\312\342\331\332k\317P\357\313\305\026\200&\f\212\337\355w\030g\263To\235v&\\t^\346[\222\330\330\335\342G\242MQ\366\265\250\260\331f\276\313Y\317\004\206J^\240\360\321u\017\200\006/*g\226\251D7\204\246\033/\371\253\331t\361\033\354\245\020"
+	.string	"\275\252v_L\336\220\206\353\256\266\242\020\237\330\030l\377\030b\270A\300\2660}\264\226\n\213\236j<\202\202P\227\352\377\350\301\352\337!#%_3\177\300\365\355\224\352\035\352\236!\201D\236>{G\245~\347\205\363\263\3732\336!\236\343\321\\:a\363\022\324W\303\266\024bE\365\365\3621G"
+	.ascii	"P R\212*x\217\344\362\277\320~[\327\374-\263\335\340hCjD\227"
+	.ascii	"E?\307\241\367z\377\030\"\267\271\271\016\013eK\257\002\f\340"
+	.ascii	">Y\253\353\214\311\367\007"
+	.text
+	.section	.gnu.lto_applyMixToMotors.145.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\261\003U\033"
+	.string	"&r\263H\240\232Qc\270\227\211\265 \216\3242:\364\371Em\002m\263\345V(\031>\227\274\324\005&\334$\351\020\220\027)\024\2756X\341\303O\272\305x\360\216\2364\336\361\315\223]\2334\301\rq\304\222\374\336\006w\333{K\231R\227"
+	.string	"\240"
+	.string	"\230"
+	.ascii	"\262\241\364\032\271\252\2608>e\335\233*\270i\fh\215\025\316"
+	.ascii	"\353\177\234\307{\334\207\357\251\225|\346\336$\036\307{S\006"
+	.ascii	"v\220\236\346\274\211~\300y\323\376\223\375\272i\004\350M\373"
+	.ascii	"\354-O\227n\201\242Q0*\353\336K\2631\f\340ez\227>\353\373i\226"
+	.ascii	"\326U}\376p\350\247\212\233\245k\204\321\f\231aQy\243u\205<\022"
+	.ascii	"X\313\030\033G\267\350\321]e\202\026P\216d\206#J\032*0\264\334"
+	.ascii	"\370jb\030\254\325\225s\357u\025\016S\334\350m\003m7\331\026"
+	.ascii	"(\207\225\325\257K\335\347Y]\226\325\326\254\256e\365e~\202\313"
+	.ascii	"\017.Yl\234\230\274\327(\t\346R\231H\032\227\372\355\317t\340"
+	.ascii	"|\311\217\260\231\017\244\224\247~S\334\227X*\"]1\2417\357\037"
+	.ascii	"}>\324\243^\344G\236\344F\303j\260\214J\202\312K\3445\212L5V"
+	.ascii	"\2407k\302$Ar<\t\341\021#B\277E\027\bL\321\351*HE\021_\310\207"
+	.ascii	"\370N$HF\224^\247\030\030HV\236n\350MY9{\021\025D\250\274\304"
+	.ascii	"k\253 e=\345\330\200\336\234\315\300\261\017e\007\021|\007\""
+	.ascii	"\024A*0\304\3221{\251\313~u\313\013~\332\230}Q\013\363hu\243"
+	.ascii	"\252Z)6\322,E\341\251]\204X\277\232\334\375\211\215\350\275\367"
+	.ascii	"\306or';\276\323M\343xx\316\233\325\316\230\220\310\317X\261"
+	.ascii	"\302Qu\353\226=\226).\242X\2534\344d\207\313&\371\007\316\227"
+	.ascii	"\275\361h\025\324\025\242\252\345\377\300y\373\262\256A\"\260"
+	.ascii	"&\3553\371T\316w\262\356\247^\370s\336\274%p\205\370\253I\337"
+	.ascii	"\370\030!E\024_\260n\335\262S`\265J\366=\3254%\3036\311\216="
+	.ascii	"}\270\337x5\n\001n=5\233\006\001\267\020\270\236m\202\214\b\335"
+	.ascii	"\205\036.\207\273\320\003"
+	.string	"\341\323\003\221a@O\347\201g\341\246S\343\365\340j:1\037]O\303\313\020\032H\260u\210\360\340\201\315\f\020\016\303N\327\323\345P\333\315\207'\333\331\325P\333lv7 \\\216\326\363\260\203\353\321\241}\300\325r4\333\216G\2631`\235\317mG\353\351t;\032,\375=\347g\201\347L\205Y\233C\255^\230Cd\207|\263\244ueZ%\303\232l\314\232M.\005?\255\211\323\226\266\202\024kK\373`\230\037\225\355\307\332\027\261\364\362\342\2649\277\272\365\032I\25014\206\020S\306\020)\221@d*\320\024\036\260\002\221\301\352\001\020p86\035tR\206\fK\320\255\367\220\325)\tqJ|<!\"\234c\370\314\225\024_<\352\332\017\217\023\220W\2162\244\357~G\222\250\002D\270<R\005\346\276\267\312\310\0031\251\200\205$ \353`vN\234*\3404\022\241\211[)\004\275\230\354\340\373w\033\277"
+	.ascii	"\023\255\350C\264\267\030\274NC\271\316\245\016C\207\326\225"
+	.ascii	"\251\372\035\245\313<\322\007iZ\275N\245\322\030\005$\361R\367"
+	.ascii	"\275\345&\215!\250"
+	.text
+	.section	.gnu.lto_mixTable.146.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\037\025\365]"
+	.ascii	"\032\233<\"P0\220\312I\007\335^\260\356{*\236\277S\363\256J\371"
+	.ascii	"<Z\002\310/j\225$\340\233\270]\036\224\003\277U\327\260U;\005"
+	.ascii	"\326\b1}r\307\375\b~]\347\371<\271\361!W\301\017\f\207xWf\374"
+	.ascii	"\365\236(\367\377?\353\330\332l[\"e\222\001!\002\317\001\021"
+	.ascii	"\002;tR\236\204573\247't\332\346\270\225\261\305AR\265\207\263"
+	.ascii	"\217\263C'\264\346\013m\317;\260\252\305s\"r\267b>\202^[\016"
+	.ascii	"o\202o\230os7Td}vj^\3675Td8\230)\263`A `Hcme\234`\216fw\270\036"
+	.ascii	"\374\313\336\206\223\371\031*2=R\3224\035\232)\023\306L\031\020"
+	.ascii	"A\354\306\210\221\033#fI-Mp\273\230\274\224\251\223k1SV\321\203"
+	.ascii	"\262RU\371a<8\335.Qe\352\244h\313\330\tbQV\202`<\330\035\376"
+	.ascii	"W/\303\265|\313g8\r\257\341\313\0356U\351r/]\237\363\021\224"
+	.ascii	"\323\266\306\231\246`/\004\377\353t\252I\216K\323\314\006\271"
+	.ascii	"9l\377\262\213\003\001M\345\316\326V\207\355\207\0348\020\224"
+	.ascii	"\264\3559s\004\377k\322\313\262K&\2374-s\344\313\005\301\377"
+	.ascii	"\234\274\252~\345X\272\256\334\345S\261\224\3318\333\372\234"
+	.ascii	"i\232>\375\267\021\004\377c\372Q\375\017}Qmb\253b\336\245J\321"
+	.ascii	"\365*\"l\247\351\031\224/i\252\214\332\022\301\377\266k\227\316"
+	.ascii	"\225k\251R[\031![\364\3224%6\013D\373sT\371\r\352\256/yPJB:2"
+	.ascii	"*\"\032\022\352\020\004\3643\024\372\004\201\365\2076w\355\321"
+	.ascii	"$M\236\3110 _\362\360v%)zo\234\204\364d\t\205\217\322\304\246"
+	.ascii	"\334\210\t6\005e\242\343\204\213\2328\2270\021\223\0179\037t"
+	.ascii	"\343fvC\232\030\223\013\241Bk{n8\023\254\005\224H&\310\220/\327"
+	.ascii	"\270\003\n\f2\344\311\231`HP\004\3668\351\216g\306A!V\020;;\020"
+	.ascii	"\336'h\313\341\2064\261\263\377\224}x\344M\031\013\215\334\347"
+	.ascii	"L02;#\034L\023\033;\0205q\226\006\205\2400!\350\021\233$r\216"
+	.ascii	"\346!\242\200\215qM\206\025\371/X\344(\332\364\266g\314R\\\020"
+	.ascii	"&\303\260 \334\250\t'\230<Aa^\350\321\220'\311/\317_aGf \213"
+	.ascii	"4M\227\223ab\337\017\337e\340\356\177v\2136a\316dd\276#\tG\354"
+	.ascii	"V<\237t|Z\330\367\202\214r\344\347\006\033\330>\r\234\223$\241"
+	.ascii	"\202`\277\313\222\332\277\006\366o\013\362\354(\004iA\355\024"
+	.ascii	"p\350\214\374\204b\257]\006\3234E`\331\310\307\013\366N\376["
+	.ascii	"\f2\310\240\376\367k\020K\350\270\321>2o\377\344t\227{'\213\265"
+	.ascii	"s\374\344\316\325\377\270\251\310\364\274\215\031\371\271$\356"
+	.ascii	"\320P\365\271\374\n\315\310|\301\252\242\201`\032x\346\215\222"
+	.ascii	"_\253}j\216H\027\264\325v\371e"
+	.string	"\25745\212x\037\245i\251\013\342]\0349\370\311w%C;6\220\023q\331S\245W\204\232@\0375\2654\275x\317\346\260!\307\225!\357r\220\305O.\323\261\201,\211;*\314\016iSwn\314\224\371v\225Gn\265\335#\260\266\307\271\255d\267\306\025\2157\2773d|\3167F\345e\340y_\253\303}aT\336\027\217\373\272\250\274-.\367eQyWT^\025\257\362'PyQT^\252\327\371\236\370\335w\212(Uy\243*/T\345}\252\274&\202\274%\202\274$*/\001\225\327\251\3626U\336\021\314+\002\310;@\345\rQy\231*/\210\312+@\345\r\240\362\002Py?T\336\245\312\353\241\362*U\336\244\312\213Ty\217*\257Q\345-\252\274D\225w\250\362\nU\336\016\2257\250\362\002]\371\375y\226\357\260\362\n+\257O\345\rV^`\345\255\225\367WyQ\346\355\312\313\225\367\024"
+	.string	"A\221\023v\263e\232\016y\342\220\332\375\350\240<\357\257\363\317\371\233\377\335\257\374\263\374p\177\334/\367\317}\270{\275;{<\317s=\035\030!\243\327\305\216\227<7nO\234{X\252\366u\366\316\177\22180s@4\332\2048,u?\254\302\245\372k\252E\364\213\001ZD_H\016F\216\302m\"(`eU\377\033\240}\306\214\374\\\223&\325\317Bd\346\333\251fad\276\243A5\372wP\237\352\032}#\347\227\2734\302C\2023f4\273\352+\211}u\347\b\215~\2263\031\245\232F\363\034d\236\243\\\223lF\277y\246\020\r\242g\3640\t\222'\214f\352\020\335x\240\354R\252\001~\342\003\252\005\246\376\024#[\336\004h"
+	.string	"\032D/\265Y\233\001y\346\242\003h\001\032\335\322d\227\0058\300L|D\341-\t\240Og\004n\217E\177h"
+	.string	"\272\373\316\230\205]\022\361\026\002^\301G\324Z\232\246\006\374\267\254\204\325\"\230quU\377\373\320\277b\004\356\215\316\030\307\271\227\2272_\257\362\370\236\201L\2200\240!P\377\215\013L(B\244f\340\351\277{\025\232\021\357\250[Z\332\307L\225\007\001M\304\263\374"
+	.string	"4\022w|0\372p\f4U\303ha\022$\3136L6h?F\275\324@o\206>G}\273 \332/\226\032\351\215\033\243~\033\244>s\251\317\306C/)uR{h\264\017yvDr\246\324)\226\260\021.;\302_1\365\277$\243F\032\253\261sFME\326\3676f\307E?\356ES\265\213g\235\2324XRaQ\037\331\2751}Zm\257\306"
+	.string	"\233\372h\356\203\026\346JE\273E\221\335\232:5E\3754D]4\324BM\324\300>\"(\f\365\275,\351\320A-\324?/\310\263\243XX\2076`I\024\0179!\250C \303\341\215n\r\223E_\356L-\232\252Y\2640\311Y\235}\230\227\020g\305n\317\031\344\026vS/#\357\034\371y\023\222R\312\324\362\232\210\334\321\003\266\332V%\177*\372\313\237\bZ[S\310\022\245\352/a\243m\343h.\344\342\306\374\231\277\b\027\26625;)\363-\367\315\240\3751\302~\\8zl\260A\004\\\305\254\342\0038vpqim\351\340*\272\002\372Q\314\352\342u\344(\352@}h\355\350\325!\325C\007\027V\026\221\207VV\226\326\r\256,\254\016niq\335\300Z"
+	.string	"i\307\016-\032C:np\025% \362\201e\201\006E\tz\024\177\264\320"
+	.string	"\307\016\254\033=\204~`\361(B\360\243\b\301\226\026\227V\326p\0138a\300\r\033)P\240\220\032\342\241U\344\302\352\301\003G\007YZ/4(J\300\205e\343\203\242\275!\265\205\343G1\213\310\245#Gq\307\006D\036E\254,\342\215\255\036D\251\245\325\352"
+	.string	"\307\026\221KKk\2138T\032\337J6\330|\332\031\373\270>\3204M[\361\271\337\231\205\237\315>'\376\227/\273\334\222\326\222\273]1t\275y\t\343\310(\367\362\226\224P\364\365\222\254z\305\212\346\202'\231g\314\203\347\316o\347/C\212q\3569\215\036\240:\252Q"
+	.ascii	"%\337\200&\354\251Qj\265\265\352\250\266\241%\215\236\036\250"
+	.ascii	"~\2363\031\361D\365\357\310E\265\317\230\025T\367\026$\333q\215"
+	.ascii	"U?\357\251\255\340\236Z\005\2341;\037\302k\252\0212\3218I2\321"
+	.ascii	"\317AK\235\f&:\n\316\201)\210\231!\265\032Sy\211\022K4AO\224"
+	.ascii	"L9j5\324J\027\225\2445=1L\243\276"
+	.ascii	"&G\214\264*\211\336\322\322\f\301\273]XZ\360\223$:\2010E\255"
+	.ascii	"\266C&C2\372\307D\350\351'\372\353Dw\277\250\363\342=z\322N\364"
+	.ascii	"\353p\237\224\265=\"\031\375:'ZF\037y\366\373\322\244\302$\240"
+	.ascii	"\221\360\036\243\235\232\200n/\310(eA\247F\202C\327\264\302\344"
+	.ascii	"0V\350\340\206\366\251\006\232\321y\324JZ\312|Tb\364\347\234"
+	.ascii	"\311\030\343\f\235\017\3115\337\230i\211=c`\020\n\"\366O\177"
+	.ascii	"-\032$\325\303\376J!\016\013\235 \021\335\3755\202D3\206\021"
+	.ascii	"\355\266\313\027;\307j\222yF~\356O\017{D\243^\220lk\3156f\207"
+	.ascii	"V[\237&P\215>\336?\004\211\205\316\317\323\247\352\200\256\316"
+	.ascii	"\220i'\366\327\343\004\201\256\250a4\306\230B\n\211\210\210\210"
+	.ascii	"$I\222\016q\005\304\030\007!,n\022 UA\013;\203HH"
+	.string	"A\322dk\377\r\017CX\243\272-\373\2719\323\215\357\306\f\346\355\f\362v\357(\224\001\370e\336q$\324\003Q\230\317\301u\250\205\251\230#\005\301\347Z\024\200@\034\236\244\340\364\307\3233\242\273r\210\202=\347\317\017\"\016\226+\315\\\363\267\bA\371\374\321\306]\251\005I\252\366n|M!\233L3\332!t\fp\331Y\273\320\300\300\301]B\300S\203\017fD\365\261B&\217lj\373\311r\235\272\364e\211\f>\227\235G\354o\024\372\002\343\354)\363q2\bo\212W\355\004h\220\216\310\315$su\322\365\302\236\272UO\266\235\237\220,\265\260-\211\265\2738\360f^R\003\323\\\237\334\336\210\301\205\226\332\256\\\255\252\024\330\306\004\253,\370\0062\2416[\227\307\310\322\332\225G$ )d\031\261\344\003\275B\323\302x\362\021\217\020er6L\2350\243\326\344\211\006n\030\332=\241\363\002?4"
+	.string	"8>\237i\304\2678\331\002\t\200\245+\331H\025\t\023^hA-\364\271\267\230Ds\031)\363\302\013\233},\301p\344\315\256\245\211F\001\221\3748jT\343\373\341~\227A\361\373)\315\024\341M\247\366&~\250\363@j\303\361\272\022Z?\r3*7\205\022\201b\320D\235~(\204q\367\002\252\306\376\376#\300\312\242\3223\027\t\230Q\330\\\211\306?U+_\033\264\034!H\004\247\300E\207\201\022Y\250"
+	.string	">4\242\230\244a}mIg\357\367 0\374m1\226M\022\310B\272\r\034}0)\020\334\"\220\374\335P\336U\265@\362\305r\254\002=S\223o\324\307O\315\3032\0326\312\332$P,HM\260\333\357j\334WU{\234\364\350,\321\2706e\fr\210\355\240\312\3314\003=\200\345\2002\324\232\213Yh\304\025\203\244R\372\017\275\004\320\273\250\206\363\373\016uK\354\0339vsZ\310\023T\250\021\217\300s^X\372\250"
+	.ascii	"\272\036D\021>\234@\263%\241#\032\031\360\235\233&\312\203b\005"
+	.ascii	"Q\222C]\243z%(ch\250$\225\270\321\273\020*\036\334\021\215\335"
+	.ascii	"\220m\\\253\252\333\240\232\356\016Y\317\274<\013\211\231\241"
+	.ascii	"K\353\214\376\234\271\002D\304<\027^tbY\232\t;\201@\"\230\314"
+	.ascii	"\224\006r\330\\\233\344Rl\266\026\220j\233;\223\374m\017\204"
+	.ascii	"mv\276^0\226Y2B\\\353a\333\230\316\202\006\005\022\016m\007\314"
+	.ascii	"\212\006o\300\021\205\f\\\313\361Mp\373N\277_IJ.\3069Zb\225M"
+	.ascii	"\305\256\216\370\376\030\347\346|\326\210\303ev\302\356T\254"
+	.ascii	"\004\272\304\224D!\034\001\031\224B\364A\020\352\315\0332\314"
+	.ascii	"\350\246uwqF\037U\244\330\030\354\344\006ZI\3656u\367\271\275"
+	.ascii	"\023\257@\034\n1uD\026\200\231\207\351W\227\002\002'&\021[\240"
+	.ascii	"\230\364\240q\224\3248\310\223\342\f\201\375R\323z\226\301\373"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_convertExternalToMotor.147.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\275\n"
+	.string	"F\324LC\020o\225\016"
+	.string	"[**\337\327\241S\325W\021:z\247\003\230=\312\267\016*\001\357\241\361n\026k\351BBA\213j\006\026\225\001`\242*@\222\225}\r\032\025\216CM\221)E\262\260\372\372\023\262eJ\0018"
+	.string	"8"
+	.string	"7"
+	.string	"\337p\016\243\375\322\346\005\325\307\n\304\203\017\261\335\345,\357\230|\323\3161\371&-|\274\216\376['P\302\240\302\204\032]/\006\354\256\325\204\222p\313\333\006\261m\300\366,{\232\265X\024\333\210\f\266G\277\345\312e\202\306f\211\276\246\375\306V!`\273S\344\233\013P.\0204\252\366;\334\303\370)\362\266\233z\211\330\235#\016\241|\323P\333\016\322B\222%_\252|\n\0070\222\316\254\256\023\363\362\254\013H\221Tfu\225\320\300b\305\252\314\236#\225\025\354k\273\273\226\024l\251\326\317\377\332\002\023\247\b\250\253Hl\036\350\3536!(\202\036\f\227\220\004\340\034"
+	.string	"\220\311`6<\320\327m\276\356\023zb\310\3130\007\023z\241\216\207\023\025$\350|\b\270O\247\363p\234\260\001\207\3610\310\300\0139\021\004C\2562\367\266\006\f"
+	.ascii	"\2463\241L\2130,(\004\f\316\201\357\032\2752aN\212.\240\n\002"
+	.ascii	"N<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_convertMotorToExternal.148.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"5\013"
+	.string	"\246\025P@ Q\\8\203HP:D\002\304"
+	.string	"O\270\224\356\024\n8\274)\244\032\003\025\342-\206=\207\366&T\327\306\265\334\332\372\236\304\266\222\n"
+	.string	"\006&Z1\345\371w\303\204\321\265\341J\377,iR\246\024<"
+	.string	">"
+	.string	":"
+	.string	"\024\206b\333/q\023\235=\r\007\360\323|\214p\244 \331\025-\002?P\235\312\033\250N\251\210{O\317?\310%\224H\264\bM\337\023"
+	.string	"\204\335u\206\246\017\267\3366\002\333\023\354_\002\035L\367P\261\333qbcaP,<>\376v\347\203\330\222\031\351|\364\276\341~I>Jd\354\212\nN9B\345\224\235\211\321\311\264\177\342(\272\213\026q\200]\027\"+vw\201\023T\036Zr\206\3208\251~<\006L\023_U_\203\343\006\230'\2562\325\036i\250\036^\273\323\006\375\234!/<\224\314\3304\261\305/5\204}\312*\b\373\243\370\247\246O\211Ft\004\330(\273<\331%\3320\216\204\rp\207\201\203\017\205\006\034\316\246"
+	.string	"6\312.\317\246qZH\200?\233\r#\201B\026w\301\002(\253`\211@W\310\372l\031\254\315\305\032\006l\2638M\333,\213\270\267U\037\234\300\r"
+	.ascii	"s3\241L\2130\354\030\2022\253\006t\r\177Z\2244-\336\312\302Y"
+	.ascii	")\024\200cF\252i\2230\311"
+	.text
+	.section	.gnu.lto_writeMotors.part.0.187.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\372\001\355\021"
+	.string	"\306cxG\340\320(\035\372\210\214J\214\032Q\215K\265^\007\001\250\266t\033\030\212\016\350\345\"\034\032t\032,\335\360\233\017/\213\024y\331_l\230\006\"b\21418\326\324\302J&\314\211\301\f\227\001S\016m\265\237\354-eJ\001`"
+	.string	"a"
+	.string	"a"
+	.ascii	"\217\360!\336\343\375\032\213m\362k/\333\364\370\023\266Yf\374"
+	.ascii	"\262k\334\226\263\377\031\202Y\241cw\277G\035a\220C\333\255\371"
+	.ascii	"z\204\232\336\313\177\355%\331\254\3451e3\020\207p\364\"C\002"
+	.ascii	"\300,\006S\272\034\320q\317\230\031,\365\303\304\207g\310\275"
+	.ascii	"Q\311\356\232\024\342\036\3356\313\266\003;#\004\233E\326k\217"
+	.ascii	"\214\227Y*\315\352=\225\243\313YqlM\2174\355\301t\204\232\326"
+	.ascii	"L\347o\367A\n<\330\261+\263\333\2616\021\250\304o\277}\377v\024"
+	.ascii	">\316&\263\370\024\263\355lF\304\007\365\333k>\217H\013\224}"
+	.ascii	"\036?\305m\257\253p\fR"
+	.string	"\313\f\311\305\017QnwQ\217>@z<\235\200\027\207\351\361\027\207q\342\357\030e\265\362\036\243\226D\300\0347\327\022\030\334\335U\245\331\206\372\333O\260,2\202_\241\236\003\215K\356\234\240\346\306G\246Y\255\274\3146/\332\342\253\252Sf\303\366\206\373\370\207\264\273)\237\305{2\370;\217NY\311\313\036\375\025\3571\265\004\004\313\235\217\373=\004\341\020\n^\240\240\201j\002\003\022\222\221\001\253[5\342:\321\260b}*\025PV\026(|\027V&\254O\345J\371F\f\270\205\341\304\365\251\264Z\256\317d;\2578\226\260\243\001S\027\007\270\331,2\325\360\210J\363q/\r\355h\324\323\221\200\034\251m\242:\305j\177\207 \"\241M\345\350rPi\216:\036\352&\235\204z\215\361\364\naF,u\216\352i% P\002Q*\353\006v\262|\353\314\276\tk\rD\315r\224i\233\215+>\227\333\243"
+	.ascii	"\006\336I\216\025\323iX\013b\255\f7\002F\034\322\330$\2137\342"
+	.ascii	"\342\364\204\306\232\301\266P\342\031\f\324`@,L:@s\312\332@\320"
+	.ascii	"\032\272\013H\230]\311\315\344\342\336k1\036"
+	.text
+	.section	.gnu.lto_applyMixToMotors.part.0.201.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\t\020]O"
+	.string	"\032\203\034\035T@R\312I\007\256J\226L3\377\271-^\336g\207\262R\251\002\353a\322\362t\241\252\227\n\221[\277_+\301)X\022\266\267\241\314&\034\334\372Gr\240lf"
+	.string	"f\006`f"
+	.ascii	"\"\022\307\274\341\356h\2227\216;\257\341x\213\003\273\216mj"
+	.ascii	"M\032!R&\031\267\001\232\001\276\0010\336\303\336\207\206\224"
+	.ascii	"5\243X\255\225\327\373\263\252=\017\257r\264[\371\225cY\336V"
+	.ascii	"\231\225M\251\252z\224\265\252\252\237\t\367M\376\344:\\\312"
+	.ascii	"\315Ney?S\270Q\231\022\303\254P^\004\331Ud\207\356g\2124feS~"
+	.ascii	"\343J\312\0163^\211U\006\032\344\327r\306\n:\354\241<\007\341"
+	.ascii	"\243\304\370\331H\326\257\024\b\21751'\335\317\237Y\364\343\211"
+	.ascii	"\223\031f\335\252\255\306\343M,\311\006\272\237E`K\273o\262\004"
+	.ascii	"\030 <\0163~4\222\025\007\252\306\302\024\261\267Z\223G?\267"
+	.ascii	"\202\255\372IV\255\254\024\312%\346\337\360%g\362\244\3606l\331"
+	.ascii	"}\265\30206\245\326d\322\317% y\236\334O\335urc\273\273\237\253"
+	.ascii	"B\367s\367Jv\267*k\205\273b\236\344\252?H\034VM\336j\255\300"
+	.ascii	"\237\035d{7\223_!\026~H(\b\350\307\247\207gG'\307\207scS\323"
+	.ascii	"\343\245;\035\232;\315f\"\341\236\306\207L\324\004\034`O\313"
+	.ascii	"\0223\0210\263<\273R\b\013\305\240\245\344A5\034\250\2060\376"
+	.ascii	"Ir\037s\2051\213\nO\313\"b\362l\001\002\346d\222p\017\330y\206"
+	.ascii	"\360\016\230\371[\373b\035\264\205\362\031 \227\264\375\320R"
+	.ascii	"\362\034/\366y\035\207\253\213o\270^`\033\343k~F\262\214\334"
+	.ascii	"3W,\251\030\361\264,\027L\036\034`W-0/e\341;\363\227\226\305"
+	.ascii	"\243\204\221\254\035\254+\201\242-~hm=gE\344\223\257\2129n\246"
+	.ascii	"\305\034o\233\242\r\363Wk=\2263V\261\006s\316\211\320\026\265"
+	.ascii	"\326\375p\354K\342\273\214\263\273n\2735g\002}\204{\2325\373"
+	.ascii	"`\313\266,\367\223{\327\037Ra,I\367qw\243r\357\036\030\031\233"
+	.ascii	"\r6\263\37327\023\265\377Z\020\230\370WL\271\237o\003\272\266"
+	.ascii	"\206\034\267\307r\b\216d\275\271U>\303}\334&:\002\\f\226\333"
+	.ascii	"0\354\242\274\002\330\360\002\225R\336\244\224\027\t\345=Z\201"
+	.ascii	"\362\252@y\215P\336\242\024(/\212\224\367\004\312k\"\345\r\240"
+	.ascii	"D\312\373Cy\001 \221\362\022\245\274C)\257P\312\033\224\362\002"
+	.ascii	"\245\274?)\257O\312\333\303\274<\277\341\337\251\341\325\251"
+	.ascii	"\341\3159\227\257\017\345\305\351\361\336\240\2746<\336\232\035"
+	.ascii	"oo\307\313\333\361\246)\357.\345\325\035\355\213\246\274\271"
+	.ascii	"\224\367Ly\315\224\267S^\336\361~\311D\226\335\030k\305\021\207"
+	.ascii	"\246\3668\317\210\374\312o\345G\373\253\374<\374g\277\226\237"
+	.ascii	"\313\337\345G\354\006\315\272\225\344\322J\302\330`\3370a\350"
+	.ascii	"\203\305\321\013\2054\300\"\226\313F=\332\335\345*\246j?y\273"
+	.ascii	"\337\013q2\273\274\235\272\227=\230\217\271\333\331V\366\325"
+	.ascii	"\266L\032\266-\203\324|\020\023\346\b1az\310\254\350\276\260"
+	.ascii	"\235l\353\r\t\314\022\312\3772u\266E3\223\265\230\003$\r\226"
+	.ascii	"\021IHt\\\336e\277V\225\246\334\362\033o\310%K\264\245sy\332"
+	.ascii	"~\b+C\250\255\331\253Ve!\320 \231,\205DYz\332\026\035\266\240"
+	.ascii	"d,,\205\230\332\345i\001by[\265YE5,]\313\317\366Y\212\230d\371"
+	.ascii	"a\321\212)\331\216)bo]\001@pD\343O\3734\220\2175\023\016\331"
+	.ascii	"\262\237\276\026\017\370\2055\373\030\256\025\022a\243P\206+"
+	.ascii	"\327j\255\007\374\\n\201]\020\"\217\b\221\b\221\344~\372\364"
+	.ascii	"\307t\235\r9.\203\236>\026\017\235\336i\236>q\006\363\373C.\247"
+	.ascii	"u\372D#58n}\235\323@Z\254\322\254\335\007E\031\227\326\357'W"
+	.ascii	"L(\352\370\220~,\3675!\"\001\3039\372\321Q\002=\206\312\233G"
+	.ascii	"~\030)\341\322\204\\g9}\\\234\266\311r\3238\3020\326!T\242\253"
+	.ascii	"\325\306\001\3139x\005\341\230\220\311\002\013\344~\336\364\261"
+	.ascii	"\334\f\363!e\3158\266\004\325\362\343>e\224*.\300\221\251i\233"
+	.ascii	"\276U\232!\307)q\n\r\350j\255\b,\027Y\353\201\375\327\317\215"
+	.ascii	"@\002\tr?k\372R\274\234\355\216cF\037\013+-\370\300\3515\273"
+	.ascii	"M\320\353\002\210Hz\334\324\034\235\337\220D\254\314zH\007\200"
+	.ascii	"\327=/F!\252\002&^\037\214q\310\226\221\262\210\367\320b\206"
+	.ascii	"\216x\036\256\200M\037Xc\354\254\246\217\2336\233\261 \355\002"
+	.ascii	"\234\034Y\226Y\366s\242\230\021\353\245\273\356\255!\207X\231"
+	.ascii	"\355t}\242\261\226x\264}lpS\013\342D\277\n\357j\327\273\364\306"
+	.ascii	"\005\272f\341C\312\f\306\261\035\232\353\236\030\322\313\312"
+	.ascii	",w\266Pc\355\214\034\332=\266\037\320>\332\177C>\263="
+	.string	"\274\253\301\006\374+\264w\265L\221\032Mc\215\224=\b\365\255\350l\344P\263\317\376\201#\272\r9n\310\201\331\367a\007ZX\256\217\313f\367\23389bln\242\306:\363wo\211\221\022-\215\250\177\345\030\364\030\236\\;\330\2626\003\373\244$C\n(CJ\347i\004\250'3F\320E\357\223\322\324\023\025S\024\220\204`TT\260\211*\212\251yPw\232bb\340\306\311\005S\023\0068N%@Q5-`\023#H\001\025T\024\024\005T0^P\301\260@\207*\3704\345\200\223\bLS.\240\230D\250y\021\244\302`\267\005\fp@S\b\006\260`\241\344\223\001U\201T\220*\030\245krz1\365\033A\212I\267MJRN2\240\242\200TO#@\271\020\001H\002\024S\024\260Ij\n\250\024\264\301\027NR@\252`P\n\310{\213a\327\030\352\343\356\330\202\224\272\331r\216\356\023\240}\335"
+	.ascii	"\260\005`\"\\D"
+	.string	"\b\344(\f\022$\367\023\330\273\255a\316\233\022\316\327\347b\326Z\253\020\020R\037!\206\225\375\254\350$\245>\027\244\373Z\251\277\263T\302\245%\365\2205\273\341\022\302_B\031\272\204B\204\344~\362\004u!%\371(+b\034\313\001\250\217{\001\r>F}2\337\365\240R\\2\246\007E\253h\254\366\332\261BE\257h\016C\\\016\333\304\374k\277\016'aE\312,\177\372h\242\215z\231HD\r\216\373\tW*\350\b\343\306_A\200\361\362\351\343\0169\t3\362\224h\336!\321_\273\016\r\222\211\225\231\016\211N\321XE\215\242C \003\202\314\323(\305\264\352\366\347x\202FG\0302&\372m(\372b\212\372_\376\033\026\235h\024\001\264\211>\021\210!\307\005\371 \200\366\361\262\325EG\212n1L\241\247\304\261D\017y\331\352\222\302\266\025\261\005\006\236>\356O\f\220_'um]\355\313\rPv"
+	.string	"h)2\266C\351R$\321\357\362\337p\250I\364\341\210F\241\016\352\241\376iB4\002\324=\035\324\001\201c\250\2018\344\024ChdDD$I\2224\006a\005\304 \007\2513\017\021P9\203\2544IJ\035\235\240\016\363Y\313\221\323ta\324N\201\316v{\206]\035U~\302\202M\240c\320)\0062oc\343\247D;\202\203\221b\237DP\025Z55"
+	.ascii	"\240\212\341\216\374\370\rgUHo\017\266z1\013\304\230\326|\016"
+	.ascii	"l\227\215\261\331\tZ(}'_\224\275t(\034\203\007\035\007"
+	.string	"P\255\346g\r\273L\231\313\304\016\025\350\305\213\272]\277\t\322\273\250;\363C\217\274\021\034\030S\325\254\306j{\031\241\261\324\225\312\302F\320F\206\247\204\314\034]\032\356\177\025\030\372\353\306\215\311G!\247\264*KZ\211\314\237\\G\355d\b\211Z\241;\222<\266)\034?\206"
+	.ascii	"\002K\370\0053/E\215@\266\204\375C\360\212\260\313\376O\256k"
+	.ascii	"\363i\226\017d\203\225\022\264\315d\235\301<\002\312\335\374"
+	.ascii	"\354\234_\307\230\347O\230t\353V^\276\035NJ\330\276\342\226\326"
+	.ascii	"\016\027i\315\226\314\246\0068\255\223 \207\262nh\002\034\303"
+	.ascii	"\260\267\232S*I\300\206C\tA/q<#\245\260nx\346\361\006F\344\252"
+	.ascii	"\321W\315.\274\244,Eh\310\305"
+	.string	"@\3277\317Qe\224\177\263\241\326\367\213_\025Sq\372\360\305L\302#M\221\202\300\025\030.\035\331C^\225,o\247\322\030\223\246\343p\225\310\237\266?}\370je\034\304\364AT\316l\227\b\246\231\0014\362<?\315\243N\237&\330\037\007\326\322\367BDx\024\235\004K\037\235\312\n\231\354B\321\005\377@\027\3378\300\306\374\371\206\271\271\232\006W\365\007\b\013\265(`|\323\230YO#\303\335\035Wi\353\311\315\212\221\207\265\360\370\345\227\213\034\241\210b\f]\307#w)\302urR\224\337\255\032\222\311h\250.\230a8\275\3126\217\2756J\242|f\310\273\266\275d\007<\346\300\262)a\267_\030\207\265\340\203\222\314\"\r\311\267\n\364\374\361b?\277\344\0059\026y4\225\023\221\017\3625\263a\032\024c\232\3109\206\257\217\351^\177\013a0\216\261\263d\226Z\"\2300u\263G\322\365\352\234\203\035"
+	.ascii	"\246\216B\303U\233v\021d9\207-h\3759\241\243LBWB|\341\216t~4"
+	.ascii	"\020\247\016\037\354Xa\254^\270\f\305K\243\226\201\036\311\343"
+	.ascii	"\326\234\242P \344m\177~\003\t3\273\337\332zc\264\272t,\315\310"
+	.ascii	"\354\013\323\340\022A}\216\357\330\267\300\301p\233\304\0209"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\255\006M\032"
+	.string	"&j\230A`\346Jc+\374\311\244\177(\021Q\255p>\300\017\330\373\357\f\233\314\007\260\213\262M\201\252\265\333&9PE`\251>\023vde\017zg\240W"
+	.string	"\300\346D|\245\347\003\351i\276\255!I\344N)\203"
+	.string	"\211"
+	.string	"\205"
+	.ascii	"},x\320\326\263\202\365\330zRp\236(\357\261\023\314\307\032)"
+	.ascii	"\301a\"\034\t\204\373\3234\362\201\3118\270\016d6\360\3222\270"
+	.ascii	"\006t.\270\376c\032\251\340eJ6\003\365#OgK\340?[O\004\306s\340"
+	.ascii	"C\2147\263F:=\210\201\013)p\317%\350D\321\223\300\275\230Y\317"
+	.ascii	"\242\373\236\"\211\366\263\266\225N\024M\257<\265\r\n6\335c1"
+	.ascii	"\321\2729\373\332_\316.<\317\363d\272\3063m\013\271\0056\034"
+	.ascii	"\247\206\341\3200\233\031^\223\345:2\354\006\313obX\315\225\321"
+	.ascii	"X9M\225\003\251\356\323`\334\0271_\034n\352o\326\305\335\244"
+	.ascii	"\356\211\344\275\345\301\265\270G3Y\\\212]q5k[I\305\243\330\024"
+	.ascii	"\367g(\356\311\314\023\367c\246\005\357\360\374\231\270\0173"
+	.ascii	"K\334\203\221\360\030;\302y\"\356\275\314\020.cA\330\356\303"
+	.ascii	"\375\227\007\337\261\002\254\370\355\351p\237\232Fr0\340\006"
+	.ascii	"\237\261\032\356Q3\303=\322\304`?\027\034Hitr\027V\242\244\236"
+	.ascii	"\260>}\335\262\367\205f\274\327\241\324y\257f\367T\312\356\333"
+	.ascii	"\310\356\237\214\335C\021\273w\022v\237\004\354^\311\327\275"
+	.ascii	"\221\364~\315\353>\211\336OA\336/\371y\337\344\347y\332I\201"
+	.ascii	"\356=\223\003\361\217'\037\356\322\303^\254=u\234\242:Vq\361"
+	.ascii	"0\230.\337\355\260\030\253\303z\326\356\332:ra]UmI]i\021\375"
+	.ascii	"\364+\207\371p\330\316\321\202\\\246\263\34567<G\313r\002\216"
+	.ascii	":\003U\037\007\350d\254\177S\276\250Jr\356l\311\017\030\324\213"
+	.ascii	"s\237\261\006)/\264L\223\f\3723\326\243Ec\035R\263N\325*\360"
+	.ascii	"Hkul\346+\032\217N\256\315|\305\372\344\262X\257,C\254O\315\020"
+	.ascii	"\353\003\3114\325\253\t\233\352\001\317T\237Z\217\251fi\031."
+	.ascii	"\325\244\324\313\245\032 \005\240\\\016\253P\322oX\243\306\f"
+	.ascii	"\353\321\243\244Ju\341\271<\332\263\265H\311g\253Q\362Fv\203"
+	.ascii	"Y\334g+\021\340\003\200\202\2501\f\003\024[I\222\244\2225\340"
+	.ascii	"\002\241!\342\034\021\260\234$G$\020\021\t$\030\232\202\016\213"
+	.ascii	"\"\332\245\351\3257\340\247ES\320\207\247\314\237\273\237T\007"
+	.ascii	"#5\032km3\342\232s\343\344\271&+\243\001V\221\260\220S%\207z"
+	.ascii	"-\026\210\323\251\252\372\200\245\202\334\231\n*\205JA\245P)"
+	.ascii	"\244\022\f\247]\376\316\220\032\223a\306F2\376\325\243 \201\307"
+	.ascii	"X\346-)\336y\307;\357x\347\035\217\027\034\322\177H\230\375\356"
+	.ascii	"d8O\n<\221\200\255\362\333\275\353q\263\367\267\225J\313C\336"
+	.ascii	"j\273\371\216\360j\267<\272\3633\257\260\037\203\022\260M\\\261"
+	.ascii	"\212\331E\227d\261\226\r\362<g\333\313\2566\337M\201\004!\\\377"
+	.ascii	"[xo\365!\266,\217qk{=\366\316\333\242\300\307J_4\001\265\256"
+	.ascii	"\234[_\005"
+	.text
+	.section	.gnu.lto_.refs.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\026\002\215\020"
+	.string	"&\254x@"
+	.string	"\261&\255\001|h\373\rc\030n?\347\354\216\007u/TU\365\252F\231\271\252\252\252\252\252\252\252\332j\377~\021\347\347Lz\367\216\217U^\037\0201\331\333d\317GFn\365\267\253#\3312\005_"
+	.string	"m"
+	.string	"d"
+	.string	"(w\2054\212\352\236\23469\271\247\323\246\324\315P\213\230\\\f\365HtC\250?NKF\206d_\246$m\313\216\334v\025\271a\\_\321\356\024\242k"
+	.ascii	"]GtN\350\232\322\b\260Y\244\005\214^\t\271$\264I\364\bd\021\310"
+	.ascii	"\037\241=@\267\317\217,\351\372\323\316\243\r\271n\355\265\257"
+	.ascii	",0\327m\271\356j\265\352\272\251k\024\314(\326\025\201\331\303"
+	.ascii	"t\273\356\345\224&\344\272\\\257`7\205\265\n\273)\326(\354\226"
+	.ascii	"\260&\301n\306\232\204\265 \227-\243\035Z\016mO\273\241\345\251"
+	.ascii	"\241\335i3\264\030\332\013\255Ns\320\032\264\234\206\323\030"
+	.ascii	"\264\005m\225eYmZ\025\320\216X\356'\300\001h\233\351VnK\345\016"
+	.ascii	"H\271/\247[\002\237\273'\345<\245{'tg0\371\005\320\255\243\032"
+	.ascii	"\247\265\002\225oJ\267\325\2723\241K\340d\031\320\215I\275\372"
+	.ascii	"\\\225\224QBWer\ntMTg\247EH\227\fLj\335\021\351\020\315\0023"
+	.ascii	"3\267\211\022\270\237\230\373!*\323v\021s\267\020\335C\207\036"
+	.ascii	"\036\326wX7\006\326\016\256\023\\\267XWfu\203hE4\227\026\341"
+	.ascii	"\332~h\250\006\341\352\241\301\264\007\355Y(\335\253@!\373&\224"
+	.ascii	">\t8\262\333\206\212\023\330K`\347\330\214S\363\002\226_nv\261"
+	.ascii	"\271\245f\222\233Gl\026\251\031\013\020\201)v\rj7\232\007<\336"
+	.ascii	"\001r\353\b=\307\215\032\245\323\230!#\006\f\224\277`A2p\024"
+	.ascii	"*7Ab\304\311E\200\356\020\251\177\b\025\004\001-\317\206\312"
+	.ascii	"#n\242\240\266a\027\342\032U\340\276b \234P\264b\371\205\340"
+	.ascii	"\n\214\312\237\226\203\003\354\320\202\220\232\030\303\261\024"
+	.text
+	.section	.gnu.lto_.decls.4f6253b0a424148d,"e",@progbits
+	.string	"(\265/\375`\315U=s\001Jv\216\211Q\0200\204\3514\006\203\255U\273\t[\275/,/\267J\265\336\004\362\036c]7\375\324F/V\242.\313\214\250\310&\324\266A\320"
+	.string	"`\364\313\026\301\231\211\257\240\300Y\214H"
+	.ascii	"\0352a\370C&\372\207\276\220\335\201K\030\240\377\317'I\366\226"
+	.ascii	"R\312\024i\007\210\b\327\b{gm@\366\254\323\226\267\367\006*\211"
+	.ascii	"\222\223\244'\377l[\224Zg\231~:E?\005\323O\277\364\343\216h\313"
+	.ascii	"t\013\002\302\006F\233\233\355\330\016\253\340\257\332\025r\211"
+	.ascii	"\340*L}v\005\317\265b\256\341q\221\374\301$y]ry\256\025\r\035"
+	.ascii	"W\354\232]+w\313-\273Y.\226;v\247\\\264\333v\323.\224\033\345"
+	.ascii	"\236]\347\255r\245\334\265\313v\311\356\225\253\345\206]*\326"
+	.ascii	"\354\252]'\277O.\330\363\345\261U\365\264c:\256\354\330\017!"
+	.ascii	"SUf\370x\326\260\241\365u\255\262v\\\255#\366\013v~\375\316\272"
+	.ascii	"\356<\367v^+\254\255\247\023\210\215\343\003\363\333\261f\337"
+	.ascii	"\327-\362\007\215\330/z\367\006\016\254/\265\373u\233`\347\027"
+	.ascii	"0FW\335s\357}\255\256\244~\270]\265\233\003\313\214g\211\337"
+	.ascii	"\216q\331\270=6\037TA%rvU:(q\325n\017\373\305\306im'9$\334\232"
+	.ascii	"w\317\274\275\235\037\214>\240ppm\324\220\3107\316\026\245\033"
+	.ascii	"\\\351\333\344K\0076\206_\223\276\031w7\337%\301_&\026hys\273"
+	.ascii	"\371g\211\322\2471\364Q<}tN\037\315\026\245G\341\364\321,\372"
+	.ascii	"alQzW\270C\254\331\321\365\372\rb\323\016\214r\356\262\275\235"
+	.ascii	"B\300\2719=\320n>jE\337\036\245B}}}}\366(=\032\246\263%J\217"
+	.ascii	"6\365s\237~\236\323\317^\364s\230~6\242\237\233\372\331\2066"
+	.ascii	"\221g\350g)\375\266<\372\030\216\376\323\213~\236-J\217\305\364"
+	.ascii	"1\021}\254C\037o\375KG\377\322"
+	.string	"i\016UW\206u6\243\354]\250_\031\377\215\272R\227\312Z\251\272+\275\233/\214\033\303\232e\270S[\310\336yAe\335\374\033\247I\260\267\315\220\332\276>\233!\275M[\224j`\211\322\373\024\374\205\n\312\212\202E\355f\013\327)\003\024\267\037+\334\374\337\315\367\233\362\245\013\355f\313w\355\236\355\273\345\263y\336A\211\377DY\276\274\367\223\265\035\202\254\355\200\276!y\272\222\346\3371\372\267x\364\236d\310a^{\347l\267\331\364\344\316\356f\274mQ\312\201\235\rBN\034WAn\376m\035\213\347s\247\346)\354f:=0\324\320\340n\376]\323\267ijT\304\342\220\335\331\247\235c\355l\2355\263r\254\233\3337\026N\025+\026-\350ihGA\215\331196\213\216qE\354\271\267\323\312\261[l\233\240'\347v\362\2712\245\006\227\274\275\367\007 \2753k\324~\362\357\n\332\266\331\242\024"
+	.ascii	"\226(\375\325\322tF\232\013\232\217#7\377\306\320\267i\\\212"
+	.ascii	"\374V\316\262\261k\254\032\233\306\232\3319\013w\273f\265\374"
+	.ascii	":o\301\204!\342\354\240\204\235\263b\354\227 \247\241\r\265\306"
+	.ascii	"\353ko\347-\333\037\234\263d,\032\354\374\022A\210\221\347\336"
+	.ascii	"\373#\376\340\355\234\035c\321\260\263"
+	.string	"mGA\245\361 \307f\006^\336\336\316\017F\037>|\370\020\364\205u\227\366\223\177k\346\026\315o\333\254\233\215\353\300\336Q{o\f>x\336\242\252\334|&\343(#$\311\315\267\\\264-\023\2745C\2242\265\234\033m\357-\204\352\200\003b\344f\037K\224\336f\321\267R\364-\022}\273\245oeh#[\224\332.\326\2135\333`\337\336A\211c'+[lo\247\020\020_\024><7\337>\351\333\r\251\355\263\033\322/\365\343lQ\372c\211\322#[\224>\251-\323\026\245\027,Qz\013\350\227\2409\330\242\324^\261e\326\314\203=\273%\263\316\243O\316\355\334\333)t\215\354\245]\271\371!\350\237\340\177\n\236v\211\007\351[\017)\356\353\263\036\322_\315\201-J\207lQz-Q:d\211\322\337R\371\355\024+\346\001OY57\332\336N\013:\252K\026\261\233\357\264E\251\266D\351\025aE"
+	.string	"\376\027\004F"
+	.string	"\376"
+	.string	"\227\330\0300\002\202\177\374X\307\006\021\177>\300\b\314A\r\r>\031~L#\353\177\006\376\233\3603\264\304\305\201\022\340z\030\353\277\"\020p\013\200\201+\264u\326\016w\200\371\337\036\354\002\317\300#x\273\207\037\315\360\337\n0\326\223\tx\004O\361\013\1776"
+	.string	"\236!\342\002\\bg\320\301\003\366\215\205\203\247\354\363ot+\004\360\275\215\332\037g\340\267z1\376[\005c\305%\301\336\217+\360\333<\251\377Z\300Q\377\365`\364\337\204\377\374\371\016\320\367\256\317\211\376\034\200\377\366`\027\036\354]\377\031\203\n\031\357}\031\340"
+	.string	"\0064`\317\224X\002\277\305\303PO\330\351\277\311\377.\341\022\373\377\n<\202\177\370\263\030{v\r\030\370\212[\370\263\226\333t=\034m\331\025\233%\016\227\300\210I\360_%\036\001\233\377\266\270\373\033\006\256a\017\207\340\277*<\304\237\333\330#v\b\231u\336\347\317S\376\333\203]\334\375\367g$\326\003\277\215\200\025\341\267|\270\205=\332\244\333\375\356r.\n\373\201<\230\351\307\013\370\355\321z\001\374\337\273\006\177v\372o\001\360\362\267\303\213"
+	.ascii	"\340\237_\334\204\374\001\272\277e\365\277F\254\374o\227\021"
+	.ascii	"'T\260`\020\340\245\377\246\341$F\376\227-\314o\305\374v\314"
+	.ascii	"\177\223\260\322\377\r\177~\373/W\327\177\303\226\377-\302\343"
+	.ascii	"\307\177\271j`U\375\327J\f\325\230\343\277KB\360_.\027\377-R"
+	.ascii	"\201\377r\211\360\337\036\t\370/\327o\313~{\345\267X~{\366\364"
+	.ascii	"G!\320\302\322\245>\377\353\376\313\371o\367_\016\315\3778\377"
+	.ascii	"\351\376\337\375?;\036\320\237\205P\034O\017\037/\370\255\232"
+	.ascii	"\337\312\375x\303\363\237&\340\277"
+	.string	"}?\276?\266\377\345\373o\236\037\377\307\031\037\375\370\003\377m\363_<\377\275\363c\013~\354\201\377B\177\232\342\307\306\037\017\177\314\201\037k\340\307\026\370\361\212\037\237\360\343\023?F\300\217?\370\261\211\037{\360\343\021?\016\376x\203\037\177\370\361\321\217\005\360c\013~l\341\307B?\376\375\030\375\257\333\177\331\376\253\345\277Y\376\233\366\337\263\377b\371\357\225\377R\371\357\224\377F\371\257\223\3772\371\257\221\377\n\371o\327\177}\374w\307\177q\374\227\306\177\231\377\235\361_\253\377j\370\357\324\177a\374\367\351\277\373\277$\370\257\b\376\353\363_\025\376\333\364\337\026\377]\377\253\374\357\322\177\217\377\365\300\177Y\374W\370_\016\374w\003\377\245\300\177O\370\257\212\377\232\360\337\022\376\373\200\377\216\360_\007\374\027\305\177\031\360\337\023\377U\300\177\021\360\337\002\374\267\304\177;\370\257\210\377\022\340\277 \376;\200\377z\370o"
+	.ascii	"\376\233\301\177;\374\367\202\377n\370\357\205\377\006\375\027"
+	.ascii	"\350\277?\377\375\375\337\373-\336o\323~\233\345\267d\277\345"
+	.ascii	"\373m\236\377w\376\323\371\255\336o\363~[\347\267w\277=\372\177"
+	.ascii	"\366\377\355\277\t\377W\374V\377\366\371[\273\337\302\371m\233"
+	.ascii	"\337\256\375\226\356\267s\277\215\373\355\231\337j\371\255\332"
+	.ascii	"o\235\277E\376V\351\267)\374V\370[\025\277\355\371\355\377\367"
+	.ascii	"\375\327\373\237\342\177\235\377x\377\305\376_\375\207\373O\200"
+	.ascii	"\276\276\276\276\037H\377B\036\370?\200@g"
+	.string	";\201\266\245\256th\002|\352\261\2317\177(\216\326p\027|.\2735\313e\026OK\355\375\244\265\301\222/3\272\250$7\177h\214\036\252\n>[1\313V\360\336\t\257\346S\227\006Q\232|8P#8\230@\335\374\2412\375\201\315yg\256\322;C\024f\235\266\274f\030\274\265\233?\324Do\370\022|\036\033\303sN\240\355\247,\022d\314\373\245#\013\307\315\037\342\322\037\276D\211\222\305F(z\002\244\301\\\033ss\026\263|9O\231\25517g)\177sC\006V\345\346\343\001\355\223-Q\324n\376P\225\336@%\370\f\005\212\t*\316=\375\241\317\211\223\374$\001o\274\236z\005g\034\257'g\373y1\t\222v\363\205\340h\020UK\276$3\001\356-'"
+	.ascii	"M\276|"
+	.string	"\330\324\240\2422\223/@]\\1\242\334|!3\032\003\257`Nb/\230\013\346,\315\261\353\264\345e9\223u\346\346\263\375\277\031\3302v\250\332\334\254\241I\360\031\311\255YF\202\373\254\023\323\356\255\266\246\310so-\020@_\302t\320\271\371B[t\006'\301g#\326,\033\2712Nx57\r\016M\236Z ~\234`\354\361\270\371Bg\332\002,\301g\"D\344p\340\326\346\004q!0\335\001-\370<d\310\331F\330RU\f\260\344\271A\\(\210\306 L\360Y\210\220\263\345\034_u\332\302P<y\344\256\324\320\0308\t>wu\235\355'\320\266\324Y\333fj\201\020*\253\201\307\356\346\013Ei\f\234\301g \326,\0039\233\246\332;\214\2224\0073o9\333Bu\363\203\3604\006kA\313g\363\217\374\303\362\031m'\2744G3\f\210\236\036c\236\030\271\371As\332F\356a#o\t"
+	.ascii	"\356F\356q#o\331\315\334[k;\325I\227<\203\304\312ly\203\343y"
+	.ascii	"\353\231\007\t\240\200q\336\374\254#\357\370\201\"p\021)r\363"
+	.ascii	"\203\316\350\234#k\375\007\346\260<N27\377\006\205\361p\237\340"
+	.ascii	"\321\331\273\031\330\363\205\347H\222\233\217\367-\377\201z\311"
+	.ascii	"\027*\2603\375 %\372\210yf\246\361\241\2757\324\336>z\244YL\346"
+	.ascii	"\321\237\263\236i\b\331\265\r\201s\363\361.\325\177`\320\027"
+	.ascii	"\235#N7?\250\25170\t\036w1\303]\354\027\016~jPo\236\233\351\004"
+	.ascii	"\261\001-x\374f\315\360\233\325;\341\345\334N\032\250\304i\201"
+	.ascii	"\300N\260pas\363\251\262\025U\256J\367\266\316&\026sk1\217\216"
+	.ascii	"\250\310\310V2r\225v\262{mu\332\302\266\226\326Q\232F\306\316"
+	.ascii	"\323\315\271\nM\343$\211\332\315\017\262\241\037\344\244A\344"
+	.ascii	"\b\346\235\235\236\237\376\224c\350\275\267\223sc\031-i\253\323"
+	.ascii	"\226\267\265\264\216\320\033O=\320`<\307\370;(\361\272\237\275"
+	.ascii	"\305\366\336\032z\220\234a)\271\371xY\352?\020\307\250\313\212"
+	.ascii	"r\363\237\245\236\243\354$\261\303Ag\013)\001k\366\310P\326\r"
+	.ascii	"\020"
+	.string	"\216'ls7\037\350\215\376o\177\377t?1\367\3364P\347fB\375\244\277\275E\255=\372\201,\266\030\374\317?\200\2727T\031\272\275\267\245\243\233\260=\361\340\260\3218\346T\031\227\323\t\256\254(\256\034Se\\Y\026\246\312\270\266ST\022'\013\314\315\3454U\266\267\205\250('\024\315\254\251\262\247ma\252lgm\2514Yv;\271\234vTs[\330Q\373i\2275\2638LEqeM\225=eY\230*\343\312\332e\\{hG=1\251\2426\323\302.\343\222\263\313\232YCSe\315\254\2512\256)v\007U\335\227\032d\350\206\204Y4SQ{\306\325\326\023s(n\312\331\334t{[4\030\233\271\343\366\306`\357\255&\223\356)\207m\203\212\233\001\265\366\324\264\316\275w\206+\250\256\346\216\212s\262;n\312Iso'PI\373j\357\275I89\3436\021\033\347\024dk[\301\330\033"
+	.string	"\333\271\367\325\336Nv\307\355\275\235\366\336?\346\226s\357\035CS_WW{k\031]\355-'7\030{_47mYSe]\315\240\233Y\331\327\216\341t\262SV\315\375\265\351\270\230\272\314\251\312\266\332{\3339\372+\253\306\335\315\230\317\007\313\212\03197\037h\212\306y\320\352\200YSRD\357\347\t\307\02647\037\b\210\306yE!g^n>\220\226\266@J\360\230\316\255\031\246\203\353"
+	.ascii	"\247\366\246\301\201\233\263N[\336f2A`<\324\312\0268Jn>\220\225"
+	.ascii	">\320\223\306wBN\260\202\210\271\371?u\264\323\247\315G\232\215"
+	.ascii	"\247\335\330\225\216\251\272c\273\250{F\216\217\274\233-Y\360"
+	.ascii	"\270\016\267}\201\221'\016\206\023\343G\331\2317\307p\316v\233"
+	.ascii	"\0304\025\336\236\336\315\270F\360\370\r\002\214\004\221\342"
+	.ascii	"\006\2371\001\243s\243\r\246\353\261\232\253\223\202\351\216"
+	.ascii	"\325n\263Y\307\314\032\033<\027\004\017\326\017\274\006\253\261"
+	.ascii	"fx\016\313Y\347~\t\234\306\362\005997V\332\205\244\006\227\274"
+	.ascii	"\271\213\346\310\327o\n\335\223\"i\376\017\235\376\217\027\375"
+	.ascii	"c-k\316\2361(%pq\370\f\352&\rJ\035f;>\363\3436\354\206\315\374"
+	.ascii	"\374\270]\201c\336\\\306(\365\2523\005u\363\177\326\364\177,"
+	.ascii	"\006\217\301p\326\f\223\301^\214Ft\361\021$\203\271\374xb2\370"
+	.ascii	"\r\2071\001\203\t\234\321\345\365\334\333i\364\341\303\207\240"
+	.ascii	"f]\332\032\035\006\f\027\276;9i\316\324\211\327]\227\233\377"
+	.ascii	"[3\374\005[qn\243[\243\r\221\272\233\377c\246\3773\246\377\323"
+	.ascii	"D\377\247\210\256`\333\242\024\177Y\242\324\276\t\036\263\375"
+	.ascii	"\314\241+\213\262\005k1B7d\215\226\265\354$\013\036\230\363\307"
+	.ascii	"\245\313\363\352\346\037gQ\003\316\305\261\021\343\3464#\374"
+	.ascii	"6\347\354\316\315\377\351\241?\002\214\025\306\202\313\260\031"
+	.ascii	"F\263f\370\f[\271\035\303W\326\322\276\\\271u9[P\324\320\256"
+	.ascii	"\202\302\372\302g\367\355lAQ\316}$\225\233Q\203\313-\263\303"
+	.ascii	"\214UO\266\333\026\245\377a\352\037W\301\316\314\246w\344\351"
+	.ascii	"f'\252g#G\232\233\363\360\220=\257\325\023\2229lx+\371\272\013"
+	.ascii	"\363\205e\364x>\361\264</\217\377>\257\0341\317\274[g\r\314\236"
+	.ascii	"\334\224\276\260\257\275\235X\252\310\223\312\307\227s\352\307"
+	.ascii	"3\217\330\363Za\030D\236Ep\030\236\202\251\340#8\n\206\202W\300"
+	.ascii	"Ap\022,\004\223\341%\030\f\023\301O\260\030\356\302c\030\t\366"
+	.ascii	"\302N\360\027\036\202\231\340&X\n6b\315\260\022\274u\334\003"
+	.ascii	"\373\320\272\223\366\204:\362\365\244\263\345\251\004_a\036\330"
+	.ascii	"\371%\002\024\217\347\261\022\374\003s\341*L\275\005j\f_W\224"
+	.ascii	"k\205\243\214|\341\030^nv\262\330<\254\344\352\241=m\336\315"
+	.ascii	"S\373\272VJ\260S\222\257\275\235\037\214\32256=\310>\310\030"
+	.ascii	"\210\317\2315\271\0317\337gO\343\346\361\023\2162l7\337\247N"
+	.ascii	"\3478[\224~\r\215\306<~\\\205\255\360\216\3335\007\312\355f\035"
+	.ascii	"@)m\272D\271\371>c\364K0\345f`\034X\013\337\260f8\007\246q\\"
+	.ascii	"\303\202\271u\332\220\3039p\326\022\2671\032\3009!h\356t\276"
+	.ascii	"\017\231\306a\372>`\372>N4\236\021<\306\362\211\262\241\226\344"
+	.ascii	"f\340\227\266O[\224Z`\211\322\373\370\320\367\311\322\367\201"
+	.ascii	"\241\337cG\277G\215~\317\232~\217S\277g\211~O\017\375\036*}`"
+	.ascii	"\236>\220N\037\bF\037xE\037XD\037XC_\363\351\3537\372"
+	.ascii	"\032\214\276\306\242\257\301\364\265\020}mC_S\351\377\350\350"
+	.ascii	"\377\342\364\235vV\216\320\214m\027W\347FX\004J\324\315\037\301"
+	.ascii	"F,m\215\2327\027\316ms\343X\263\353\346\322\2419\257\233;g\321"
+	.ascii	"l\234\327~r2\001\245\215\017G\336\336\316\324LN\233\035=\371"
+	.ascii	"?&\372\277.\375_\r\375\037\225~\212'\227&\235\002\303\3327\337"
+	.ascii	"4\027M\266\322\004J\275(\3512v\363\3237\372\277qf\260\327\223"
+	.ascii	"+yn\366\3626\365\265\367\376\177\311\3343\027\356\226\261f\327"
+	.ascii	"\314\r\363+\346\216yv\356\035\005\246\213\357r\351b\365\202\242"
+	.ascii	"\206\366\026B\365e\363\256\231\373\305\352\3318\264rwy=`\234"
+	.ascii	"L*7_\203\227\326 \313\312S3+)\027<\367\263\235\254l\254\037\033"
+	.ascii	"\\\032.y{J\353\310\247JU\0254Z\236ry\352\326A\211\307\t\003\233"
+	.ascii	"{\2729m{\220V\031.\317\233\237nI\331~`O\023!ePn\276\006*}\002"
+	.ascii	"X\301\221\225us\272v\235\304\261\222ss\232\345G\213M\336\220"
+	.ascii	"T\315L\227"
+	.string	"\034\324\315\351Y\212f\315\016\227\246\335)\024\304%F\032\334\315\327\360\244o\017\227\226\300\036.M\313\236b\371\201@.>\204p\335\374\n\364\364\237^\371\201?\2659\036_7\277\002<\375\n\352\264\006T\306\306R\247Q\023\263\221\033\343\022\006t\206\006[VJ\366\324\t\204\207%n\214\310\177`j\006+\217^\232\316 \206\230\330\001jL\031\013\333[\353(\350\354\315V\222\233_\301\017\235\301\017)RR0\243&^\223\005k\353'#\313\233\225\233_\201\f\235A\215\260\260\022]\240\204\205]\270\031lnpZ\003\251'OR\260!UwL\316\224&)\030pI\223.\2533\235\201\231&MP+;\344\204Z\203\347ko\255#-\305&G\332\315\007\300\227\316\300.\370?M\222&I\227X+\033\313b\271\203\265\225\267\267\326Q\317\215\0328\330\322/k\226.\261x0\304\330nN\225\\\035N\252'"
+	.string	"\270\264M\023|z$=r\211\034\211\251\301\304\002\2228(7?\203\034\235A+\370\264HZ\304\362e'\347\306\232\200,k\214F\260\2159u\3633\224\321\032\270\004\237z\375^\371\231\235\206v\024\224\030 :+\26057?\303\232\326\260\246\371t\205f*\2252;\260\263\344\271\363\364a;{\342\2719\r\222\n\351\342\002\222\001\212\326\360\246\306\323\036i\215\324\307\255\342d\372(\211K\303\314\271\201r:\273\340\024Y\2739\335\221n\001\273X\311m\335\374\224\207W\032$On\276\251\216\237\0303*\355\346\247Zx\217L\027\252\233\237\346\370\017,\301\033 QnNqh\030\031\274<"
+	.string	"\335X\211c\344\346?\265\361\024\307\237\336\2707\3201\035\260\342\241ews\220%J\321\267\340S\033W\t\032\034\334\315\317`\2455\334\t>\315J\263,^~\032\332\273K\313\217\027\0254:<z\203UJ\365\024+\245Rr\264\344\013\bn\016\033\0337\247W\351\214\324*\255Je\030\315\351\r:\202Oc\24410]~\262\260\367\323^\033\324\216\033^n\276Q\026\275\341H\227\243k\3209\224\2155C\273\244RA\250\375t\204\304\224\035\324\304jL\307\315i\324\257JG\026\264\233o4\246o\305\350P7tv\354\r\332F\003\324\324\bbg\236u\350\323\306y\235"
+	.string	"#\363\274C\365l\234\326\320\216\332\002\347\311\207\302A\333\0049Y\330;\210\231\257t\247P\351\023\332\207\356\245N\326\f\345C\345\034\235C\331D\241|h\234\023be\236{;}\346\360\224\304\005e\272\307\321"
+	.ascii	"55\302\230\233\021\250\036:\007\275c\343\264\234\233\206\217"
+	.ascii	"\226&\\wy(\0364\2175C\365n\344\334\033-\003\020\2366yci\376\321"
+	.ascii	";y?m2x\304\270\031\265c\313\340\252\202\334|\243+\375\243x\326"
+	.ascii	"\f\255\023\203\311^\222\233Q:\217C\345$\243\352o7\334\246\224"
+	.ascii	"\271\371F2\364\215\242\3641\330\321\250\235^\363\354a\346\346"
+	.ascii	"c\220\243\217!\216>\006:}\fq\372\030\340\364\217\272A\333\224"
+	.ascii	"\215\241c\246\315\225+c\005u\3631\200\321\327i\213\322#K\224"
+	.ascii	"\242hP9T\315\017\024\222\322\266B\226\233\217\201M\037M\363\037"
+	.ascii	"hB\2213Yn\316\366o)z\346h\334\017\274pJ\276\256n"
+	.string	">\0065}\264\fj\346\007\006\321%I\253r\3631X\321G\311d\351\243\243\343f\024N\303\300\340\304CO\217-?xx9\n\367\243o\350\027t\214\n}{vnF\303\240b\216\216A\301lt\f\211\346\336O\350\030\241<{?\tY\333\301\332\016YJ\227\022\2654\037\203\022}:[\224\002Y\242\324\266\005\217z1\363\345Iv\3631\334\320\035v\270\271\221}a\200\2419\240ac\343\361\245\2479\304\321\242\00552\202s;\331\033_n\364\005|Y\262\240LFpn'\341W\235\266\2603\232\303[Z\032\332E\304\252\213\346\240vv\006\247Ls \303\202\005\275\"\346\353\211\346\340\204\314\232\241d\350\025\027qk!\270[A\311\315\250\225\037u\242U\260ZO\035\2255m7\353m\211\322S@D_0\207\n\025\224I\033\n|\350\013\272L\231\202v\215\340\334N\031\330u\332\302(\300\241;\314"
+	.string	"\003C\243\0349w\rk\003\304\032\332\006C\312\013\n\345h\030V\263QSSy7\007\203G\241X2<U\300\334|\n`h\016TN\234\240L\206X\341\321\034l \261f(\022\224\311\220-a\0212V\320\257\243K\376\353\005M\202\325\322+]\332t\334\214*\t\036\375\242\313r\273q3j\211\322t\216\276"
+	.ascii	"m\2105C\207\240F\320\326~"
+	.string	"\310\336\236\330\0219Z\344\277V\250\027V\323O=4\317\233;\b\036%\222\206y\001r\347\346\273F[\260'D\b\217\2421\372\002\257\2465C\233h\327\bC{\013\t\373\332L\033 \3260\026!C\236\240\\\377}\242@\260\332/\210\0306[n\316\333\026\245/b\323\027\364\b\332(\026\335B\267P\037\300\251\275kl\360\326\264\001bm\f\035\214&h\217T\253m\211\231\233_\344\324\032tA\265P-t\307\216\264\314\023\303\250\363&\005\325qt\207E\353\022\007\347L\021\021\255A\036\0336P\034vR1\314\255\243&\276%rn\034\305\301\346#F\f\033\0224\262&Z+\320\320\031\254\202Gi\320\030\363k\202\347\304y\363\213\246t\206\035<\312db\273\f\214\332Obm{k\201H\321\b\321;s\363'\340\323Ft\202Gg\230\2413\260\335\t\264\346\3162A\3464FC\207\231\363c\013\035\035"
+	.ascii	"!2\216\312@\255\354\336S6\327\235\023\255\262f\250\325\024.\316"
+	.ascii	"\0347\037\317~\371\017D\273\352\300a\273\371\023\274\321BH\202"
+	.ascii	"G\247n\315\320)\f\347\004Z\363i\211\211&O\237:*6Hn\376\004h\264"
+	.ascii	"\207g\020\205\262\250\024\352\204\302\260h'\244\366n\"Is<'h\323"
+	.ascii	"\237\200\212\276\265h\351\205\037\301\243O\350\223\375\222\235"
+	.ascii	"\254l\254\236\030\\i\364\362\366\016\003\002\337h\253\202v\363"
+	.ascii	"'\310\322\036\326\240\033\335i\216\266:ma\031\217\215S\024\033"
+	.ascii	"}D\305\307WD\263\325\251\t\273\371D_\364\0213O\236\\e\021\260"
+	.ascii	"\204\307\327\326\322:\272`hxY7\237(\213>z\323\313x\364r\225v"
+	.ascii	"\302\323\326\343\311l\354\346"
+	.string	"\0231\321\033\330\202\317y9\317\352i\251)T\316\356\271\231Z \200\262\260\351kr\363\211\272\364\006\032\301\347:u0\235\226\232\332;\313\304\2247<\326\314\270\371D0\364"
+	.ascii	"\322\320\241\223\253\336\242\256h1\273\371\027\344\350\ri\202"
+	.ascii	"\317w\371\016\323\221 k^P\2435d\t>\327\231\345\272\374<\241\265"
+	.ascii	"\237\2342\260\263G\304\\]e;\270\271 En\376\205/\372\027\256\350"
+	.ascii	"\2438p\340\344*;N;4cOn\376\205$\272\303\224\240\215b3\2355\313"
+	.ascii	"t\331\rpj\357\254\004\350\330\002\201\245\020\341R'\267\021\242"
+	.ascii	"\221\244N\314\271\366c\305c\313\333\020=\200\036h\320\344\271"
+	.ascii	"3\315\314\266\004\017\2205\317su\272\271\205w\347\346\254\346"
+	.ascii	"ov`Wjr\377\201D`P\246\344r\232\337\216&d\354\234\202T\301\335"
+	.ascii	"\374\013;\264\005"
+	.string	"d\202\307PPg\313QC\273JJ\353k\206\232\227\233-h\013\036G\341(\rn\317 \034T\306\334\271\371\303\2160ar\231\241\r\025g\307W\017\231\224\r+d\236\313\370|\261\203\207\004n\316\234\215\025\340\306l\340n\013\212\023\225\242\006\214J\f\336\302c\220\204\231s\363/\\\351\017P\274x\311_\334\200\272\266\242\356\334\234\277\244y\234>\256n>\036\236\303\267w\205v\363/@i\f\266\202\317\\\270\234-\017\355*\250\252\2669\215\0013\370\334\326\266EMc\020\025|\336\262%F\026\035\317&\272C\\\360ym\355l\007\356\035\246\256\255\251;x\t>\253\251\235\3152)\240a\004\353i\301Jw\200\023|FC\363\2613g%*\217\356\220\027|63\013@\375\244\020KdRI)Id\2014\016\225=\3530yd\201\016\035\207\304\244u\250$b\271\032S\020\301\204D\"@\023\023\322x$"
+	.ascii	"\t\017\204\036\230h\022\261.\221I\"\312bE\032\225"
+	.string	"\307\364I!^(\325u\035\246 b\251L.\221\352\222\002\032\224I\007,\325\345\221I\005\322E\262\2702%\241\240\344bi\303\262\210L\022\325eRI4\246\260\360\244\020\252\222q}1<\252E\364I!Te\222($\262\020A<a9\364\244\020HH\243r]\212P\213LG\"\322(B\271d\022A\301\361\310\204D&\221\277U\250\252`\\\246.\222\312\2445\211\374\261\030\252\307\274\252K%U)}R\bU\311\264\016U\026\277'\205X\252\305\244\022\bK\243\320\232LZ\242X\032'xR\b\021\033T\022T\026\303\345\3218d1\244\004A\311\305\022\221z\\RJ\206\240\344b\211\202\n(\271X\002zR\210\022V\220\200\202\210UER\016\327\017\020\223\307\020Te2\004\241\342rX\001\265\230TR\032\207D\037\256\303\342\252.\203\204\352:<.)\251+*x\261\224\fah\202\027K\311\020"
+	.string	"\260>)\304\022SR\211$T\252\253\2524T\016\227Dh@D2\371 Y\\t)DZ\372Y\205H\244%\024\211\264\204U\025\214\313\274\\\252\312bq\370{\261\224$f\345\272\204\213*\022\311x\034\376\212\352\222)#\223\306\225\250.\177W\n\221\226B"
+	.string	")\207I\304\374B\271.\215H\352\t\031H\214\350 h\201\342\220I\002A \370\034\207L(\204F8\032\207+\005\202T\254\303\243\003\222+1\002&,\220\\\211\021\360\261"
+	.string	"\211\245\244R\205zDB\032Q\020R\341A\223:\202\007\027\3701"
+	.string	"\310\002*\212C&\t\364(\325u)I4*W$W\034\207H\245\27265 I\244"
+	.string	"\005\t*\204(HP\26146\r\201\3521\205\341\212&\243\222\006\016q\020b\311\2244\266P\225*.<)\004Q\250*\031W$\223R\004\361\202%\322\360\350"
+	.string	"$\244QI9\364Q&\327d\bE$\bG&\342qH\034\200\222\013\025K\311u9\264\\J\256\313\236\245\212\302\250\250\n_\f\225J\020\222\353\222\211\250AU2M\360\263^H\241\256\303\342\322\004&X\246M\306\024\305a\262\204\037#\222\004#\022\230\204d\034A\203\213d\t\305\021\025\204@TR\340\"Y\302\205$$\343\b\305\021IH\306\021\204\\$K\b\272P\264,\"\033@\\6`5\"\215C)V\244\252T2\021\207\212\352:T2\255C\024\226\024"
+	.ascii	"5\031S\f\245XU$ %u]\276@Ah\270\016Q\020\225iQ=\2460D6`)\271\242"
+	.ascii	"\220BI9\\\032\213\026T$\344\360\004c"
+	.string	"P\3230E\004\202\202\226K\225H\034\246\033\350 \230\001\0168\220\016%W4\031S\2748.-\r1\034\217 \004\371p\020bU\016\227B,\225\3115\231B]\215J\027\027\204H\007\254\352R=\001i\251\350D\243RE\252H\372$< \200\007&\232~7\361\001\007\037p\220\336\304\007\301\340\007\036\004\365=\b\342u]\205\313\t,S\250J\306U\257@U\350\003TT\227J\265\205\252\024.\205.\206/\210Vt)\374\255H\246\236d\013\245\212\202\272d\322\353\317R\250T\233\214)\324\023\222\226Ce\bE\343\322\205\240\245P=\032Y$\225*\212\306\245\237\365I!\212\306%#\024v)4Q4.\245*,\t\266h\\\302\352\322\213U\250T\327\243\221\205\205\037\025\222\204,\226\216B\027\303\027=*$\005\261`\221\\\231\210\302$\342\232D\n/\254H\225\250TU\254HcR\305\022S\021i\254"
+	.string	"\006\037\027\303\013(1\241P4.\005\251HC\245\332b(\\\"\325%\245d\bE\243\212u\230B\013\"\2441\305\nB\321\2704$\364b5\2660\256\306%RE\341\250\266P\217C+Qe\301\202H-&\225\204\253R]jR\205\353\321\270\n\221I\025\214\312d\222\321\n\n\220\306\241\b\312\344:T\252JJu5N\2204\256\303\023\232\206G\365\204\345\2055\t\311\250V`E\032\223K\253\212\202\222R]\213D'\270\030\276\260\260\032\225\214%\034U\"\021\004u\035*\203\212+\322\220\252d\\{\324#\022r8\201\272\016\225\302\027J\265E\222\250*\205I\313\241\222H\364\244\020\313cR\271\"\223D!Q)\202\310B\003\212\021C.\222\307\240$$c\222Pq\304q\250\\\231T$PX\034QD\016S(\016\325\"\221ZL\246"
+	.ascii	"\236\270\0246\031\225\3530E\223Q\311G\037\217IeN\""
+	.string	"\256\306%\324\305\360\005~R\210&\245\210&%Q\223\262gi\250DT\242J\265hl\221T.\t\233\224\307\241Q\251.- \223\306\345\222)\205eP\223z\\bB\301\3428L\352Y\022Z\205\035\214(\032\201+\222)I\024\262P\n\215KKa\223\022\203Z4*\225j\213\244\020i\344 Db:.\031YX\325\245\252L\256LCa\021iLA\270\016\227B%&\345\372\001uiY\301\217z\034\022\227=\253Rm\2014\n\215\313\245\322\207\250,\032\225P\244QI\177\200\250&\021\233\206JZh\031\302q\330\002\2314\256\303crI\251\256H\022\210J\fKUU\"\251(\324#\022\022\004\245a\b-\226X\\8\252H\3440\211(lb\032\n\233\206JB\305c2i\251*\223V\250\353\260\205q%\202\240\026\223)\224\306\241\021\322HT\227L\302\246\241\222\260I\371;&\223\f\020\242\353\223"
+	.ascii	"PD\016\225\224\222D\244Q\251\007h}R\210\225iieJ\n\225\\,\211"
+	.ascii	"X*\325\026"
+	.ascii	"Fe\221\303\223K\252R\304\232L*E\370\254\302\337\022i\270\"iL"
+	.ascii	"\227B$#\013d2\204\026*\nu\035\236\360sL\022\223kR\251b\b\231"
+	.ascii	"4.\225j\013$\tJ.T(\223kR\311\302*4\261\"\215L?%\027*\212*\021"
+	.ascii	"\371b\211\234\200\272d\nj\241\026\261\312t\034R`U\227,XD@=\026"
+	.ascii	"I8\016W#\222\261H\001\322\250\344\263\n=\b\256H#\223>\211\240"
+	.ascii	"\007\304\024J\214\030\021\302\302\r`\200\0208L\300\004\02141"
+	.ascii	"\204Rm2*\211X\223\220\214G\026\"\220\306\241\222\b\242r)\"D\006"
+	.ascii	"\365\270\256Ie\322\3324T\362\371\377\343\002r\001\027\"L\200"
+	.ascii	"t<Y\353\273y\2038\036\277&\217\337\217\r\310\344|\374\367\343"
+	.ascii	"\r\006\034:in\376\365\370\233\306\223F\246\346\346\337\326\017"
+	.ascii	"\316L\327\0174\032\304\332\215\337\216\337\215\237\216_x\332"
+	.ascii	"\"\361\326\274{\376t\374\264\304\216\360\340\241\365\313\001"
+	.ascii	"\005\n\0329\314gd\245\211\217\037\216\353\344\247IG\207\356\346"
+	.ascii	"[\020F\377?\033\351\222'}N+'vr\0266G\243\315\317,o\013\215\254"
+	.ascii	"\024\r\320\030\232\026\031f\336rzF\375\270y\003$?\031?\254\237"
+	.ascii	"\214\337\f\022]\240\346\350\375\256\376\233\001v%\216\333\315"
+	.ascii	"?\253\263U\021\342\226\346\346_\325\331\204\266T\2413b\001\023"
+	.ascii	"\375\377\250,Z\016)<Y\246R2)\337\035\026\267\030\250UP\336\230"
+	.ascii	"5T0\3220@N\276(o~R\231\206\335\335\225\332/\n\327\361\241\301"
+	.ascii	"\247#\311\017*\345\022G\326G\344\346\240\024\354H\f\267\237"
+	.string	"S\n\306\200;+!7;\305\260\260\2144\323\276\354\3467\267\345\311\225\331\331\322\275*_{\357\241\0377t\264\240\335|\013\216h\020}\351\2354Oz'\305c\231\314;\017];jp\311\333Z6\216\376T\357)\036\034F\356\331C\206\005<\364\237\346\345\252\234\246\303\253\313N\337\275\021\245\307\nu\360\236\216{\312\341\245N!\272\246\020+:x\216\217\017\032e<\3229\250\017\034L\360\330\270\273\262\344\f\2348r\242\\P{\332\361dRB\230)F\354P#\350\223\334\236\235:\264\013\004m{vqb\244`W\322\356\300\311\317-rp\352\3227\251\217+i\314\344\335\214\201\032\271\247lR\271\264\215\305\263\316\255\325t\272\013\300\0178;\260\274=\265u\204\264\302\0172)\335\3236d\372\260\264q\245s?6k\340\254\334\234\256Ay\324x\343D\315\017\374\361\"c\346\356\346oX\243\277\301\214\306"
+	.string	"O\\\\\212F\303\222+uL\033\243G\331\0264ZF\230]:\00313fP+\243&^\243\207\265\025&\244\005\b\23107\177\203\224\316\300\310\230\177LJ\3468j\373\b\373\242\262\304)O\n\367\224L\220\330\333\363\016\236\377@\341[\221\2749:\003-_\276\244a\316j\314=\363\332\324\231\331\221\202y\032\246\307\215T\032\332\2351U\262\324\334|\r\\\264\006K\274xI\301\220t\t\205\346\250\203!\344RL\252\3040\n\344\224B\2101\022\332$\351c\025@@`D\036\026J\363\350\036\023@\303\215,\265\231\230e\214\251\231QR\2204\225\275\306RY\343\252$\342a4[A\2030\215P\313g\314Et\353\331\253"
+	.string	"5\315\371+\233_r\224\340\255\256\275\203\205\001x{\320\244\3766\366\3208:\204\335h\243\b\315\367\236\021CZ\003\304\177<\212\013\236L\246B3\3106\205\325\365\344\200\244\313\222\246\344/\b\032\003\271\002\n\341\322\005\376<\030[Z\345\216-\373\251\302!LmMI\257\336\331t\2277\n\330A\202\202\371lO\372;\214\031'9\266\241\262;\375\371\375\307\253\244\262s\003\367N\253+Z\236\006\t\213\261\252\336v\265V\215\320\247eG\336\352\036\177E\327\211\241`N\036\302\363\005\322,\203 \203\272&\032f\004s\327<\265\275\255\017\034\037-\213\302\017]\255\271\017,\254\350\262\237\377\342\365\240\235p_\271\025\225\310"
+	.string	"\327\355\362\253\217g\006\337\006\340\315\312\220K\021"
+	.string	"\225\2039\213\310\332\341\313\203\037\202\035\036\273\"\324*\036\320\377$\275A\r\254\202\020Z@O\215\332\235\364%\340\375{\032\177E\351\250\302,~G\336\343c\001G\301\306]\215\224\n\233\343x&\303\316\214\346\370?\303\235G\222\016\311\330>\350\267(\203\302m\370_r\363b%\307n\361-|\310*\001K\241+}'\025N\f\240yz\270M\302\374"
+	.string	"[\207\266\375\360\362\370\205\370\230yK\260\206_lQ\305\276\277\214\365_\272\250\202\342v\330\270\255<\267\371\\\346GB\254Gk\223\362h\314"
+	.string	"\007\316\254\254\027\241/\350\037\230R\037qt`\234"
+	.string	" \364\342Av\f!\f\274\254M@\207\004\232\017\341\311\241\246JeW\272l\252\202f\001\222\321-9M\212_\226D4\3463\314\\A\026f\251\363\204\344\316\243\331a\fb\217#\276\347\376\\\213\362\360\366\003;\004\254\tA\270g\334a\"\216N\336q\243^\334\274\276\026\252\346b\340\267\255\004Ew\351t\206R\021\350\3470Tcm-\326\351\203\375L$)\330\302\343#\235,\3257\17717\271+\022\006\306)\351\340\354\003{\227\3145\231\2049%\363VuG\300\204\242\347-S\263\352\b\347+\345`\025\325\240\3338[\024\255y\241\242\005e(\016\252"
+	.string	"\317\222\256\364\331\373S\337\234\330\254\350ee\366\336\271k\277\313\230lk\3641\231MD\342I\306D\225\276\204\322\366k\244/\303\023U\365\f\307\221\260m\262\2001i\177H\255\334n\262\351\202\373|\204,gP\013\321\327>\227P\237\311\360#Y\247\035hy\037\030\225\030\024,f\357\363G'\001#?\r\270\025\242\340]\220yJGf\314\270d\252\2027\303\347\2501m\322~\245\373OPL\274>\353Q\304\3259\";*Q\034\225\007\f\005\212\322\342\205\226y\353\374\033\247\016\307%I\301e\030\352"
+	.string	"\3011\201#\311\245\"\201\327!\230?b\022\364\316.\376\221\260t\222?\316+\031"
+	.ascii	"u ~\027\005\223\224\031\013P\323\007a\013\\d\332\242\002\004"
+	.ascii	"\006\253\336\004\nJ#\231\305\314\317\305]\2328X\265\341\370\304"
+	.ascii	"\202\351G0\313\023\327\252\304\327\326|\3164\226\036\"!\240\340"
+	.ascii	"\261\374ejS\3132\346\377@"
+	.string	"\317c\035\b\377\032d\261\n\344\361\376\255y>mB\r\246\004\211\025\210\221\251'r\277\260\332[\336i`!\371 /\201\313\333z\265\0221\r\334\373:\"\350\216\254\232;\035\006\254\002\313\266O\232k\262*cy\260\321s\337\342X\257\022\205Sgg9\320K-\332\214\b\322\013kN\324%7+\b\205\0250p\223\"\243\267%v\220\035\371\307\013\234\343\031 \026\204\361\026~\356\317\250}\fe\242\201\364\033\032\277\307\334\235\316\313\260\003\301\264i\244\2631L\320\301\311\005\205\021\232\f\252\274\nqm\200\315\036\202\341(\304&\223\033\216\241\r\344\231%\331_J$>-{\030\274z\204^\236\263;(\333<\030\350\177\220?\022d\204\217\267\356\236\377\232.\202\303\364(\217\211\364\004\001rc[\336\260\357\270\013\242\300\371\013\310v\350\351b\276\312\345\332$d\006\206B\n\211\333\027\341b\211\200\352\022\016\343y"
+	.ascii	"\226\226o\302\006\2773\204*g\203\317MAb\214\327*\020*\261\272"
+	.ascii	"\257\212\200\r*\364^"
+	.string	"\343\3066\r\315\203x\023\210P\356\210\262\300B\322\253\250\310\245qX\206\363\320\n\211\375O\220\275[\262\213\"\n\320\365y\033X\355\353\316C\256:\244\3672\003\372VR\367&-C\365|I\332\372\013\341D{\361\252\235\304\321\352K\2103\265gB\255\347O\254\236\0204\206v\272\f\246W\305<\255\376\2150\246\255\244g\361\314\267\353a\366\024\354\036f\370\237#"
+	.ascii	"\273B\341\177\312#\324A\2364\310H-4\034\312))KJ\b\263\fqU$\340"
+	.ascii	":\fv\030\344\332\277\3350\246m:\374\007\004q\332t\202\323\203"
+	.ascii	"\003q>S\244\367\200[\261\007;\310\253\3379\322(8\233\3347\234"
+	.ascii	"AA[\031?\357H\276\207\006\222\264\274o\261\356\240(n\223\266"
+	.ascii	"\276+\024T\006Q\\\347NWy\235(\336Eo\rCO\320\355\312\255\215\030"
+	.ascii	"\220\177"
+	.string	"\304\213:Q8\030h\001\t\332PA'\302'\250\230&0C@\177\303\305\363\212\311\376\256\001\271N\f\201\177\213\334\343k$u\006\215\220\221\346\n>\002{\t\367\023\021<\370i\223\365t\244\023\276\0271]\372\372i\361\036\346\022h\353$a\003:Qn9F\306\260\276P\314s\314+\246-s/\004\203}\336\315y\024\036\356X\013\207\303Z\355\005\004d\251!\300)\204\357N0\374\253\025\315\362\3726o7\0379@M\366\274\311\330N\313\033q\013\265eR\276*P\004\362!9P\231u\302n,\257\230\243\003\263au\347\177\342\343@\335x\350i\017\272\211.~\247\246nH\252aPS0]t\307|\b\316\313\331=\n@\024\365Ze\272\237Ol\301X\t\0177\b\340\017\202\007\374\031\240\024N\231\304\337\352bc\3121\243t\277mw\265\277\354C\262\337\304\226l\325\276\020\365\341Wh\220\362\357\276"
+	.string	"\302\327\245L,\3073-\222,\017\215\2341\f\330O\377\235L\213\206\272\302a{\205\314\230\335\331\254\023\202\373"
+	.ascii	"| =\311\301\221d\f\257\247(\246\2165L\370>\223\260\3054\266\222"
+	.ascii	"\\\225\373\371\006<\302\"<\225\3229\227=z\003\322\316j\370N\233"
+	.ascii	"\244Z\250)A\220\275H\200\210v\bb\360\332KHv\254\221\262z\201"
+	.ascii	"\302\024:jFK\\\n\234\263\255\270\352(\265 \312{\350h@)\254\311"
+	.ascii	"h\262\313Vte\0065\256\006G\317m\306\226\247@\342\177\t\242\224"
+	.ascii	"\312-\330y\206\374\361\230z\327\037:\227O\231\024\363\276\223"
+	.ascii	"Q[\375O\fL\325\311\367\212\007A\237WD\216\334\344\320\027\316"
+	.ascii	"\216 >\271\323\035\372\350\023L\001`\235\237;m\f\240]\013\030"
+	.ascii	"a\345\265\272~ \307e\217x\205\216\0312\020\331*"
+	.string	"\373W\376\020\235\372}\r.\220\345&\361)B\207=\267I_\234\t\317:\311\3401\027p\316\3700zgw=\013\310Gh\003h\205\001 J\360\337\322gz\025\221\026.P\332\252~\251\315\255\235\207]~\322\331f\234E\201VbJ\3304}\003R\314H$\016j$\031\267\272\215\204s\371\026\254\b\231}\217\377\210\0072\365\023\276\241\224\374\027\342^\326B\337\302\343\210[\366\300Y\250\306j_\360W\240\357ZR};\301\221@h\r\237\r\365;\323\263\364\271\350\025Y\f\330\234\277\002h!~\367\301\346\t\301\352\222D\213\025\220\361\3452\352\r\317\260\333\n\003>=\222\033\207\256\210\361\216\325\304>\373\273\305L\002\340/\300nk \265z\362\215\334|\201\271\347\224\002&\007\206\246\n\006UU.z!\221\0318\345\345Q0\003\325l\224\242\0210OeP\0374x\230A\203\331\226\277\371B\303\232|\331"
+	.string	"\364\235o\242o\2305\361\223\264\254\203\247\255Y.]\211\336Y\373g\336X\177~\243\321\353\255\353\335\224\325d*3\364\314\023\314\360eA\r\314\352\024\3451\357\226\301\320`\361j@\215=!k/>:\374oc)a\003ALU\025\t\002\030\316\376\344:\342|\345\026\311\224\032"
+	.string	"\013%\275\232\200'\247\312\374\rh\tx\302\006\354d\330\310\377\363\357\350\bE'.K\007O\232M\017\320\232\207\330\324BI\310#\206<C\f\243\345"
+	.string	"j$\364vd\203D\r0K\300\204\001\264\207/\302\304A3\272\247\036B\tK\237\302@e\356<:z\rn\2461.\007LG'\240a\361c\312\370A\301P\367\020\300\365d\277\\B\224\032\354\327;%\341\203\352c<\314e+N\206\371\265\261\313\b\346\001\367\200\274\243\016\b\t\242\216PJ\2357\3675\027(_\221\013\365\225\307\215D\226h\232\301\303\210\257\267\301\nu\b\253\262l\277\023@\017\022WK\001\242=e\261\217\351"
+	.string	"\230\021\\\013\257}"
+	.string	">\033z\241\331r}N\202\322\032P"
+	.ascii	"Tv\231\022\2641A\224L!}\364\321\202\002\256l\341\376\023\256"
+	.ascii	"&=\371\007~U\001\274\215\336\203\375\221\030p\224/F\350\023\232"
+	.ascii	"\374\377\2668\2213\372\374\023\005@\330\004\273H\0316&X\215\202"
+	.ascii	"\001\005\230\301\362'\013\030\302\3352S\226/\b0\212\261\276\330"
+	.ascii	"\005\371=W\257d-|\354l\236Z.\356\356\246\246s\346G`\244w|\331"
+	.ascii	"\367\3578-A\037\201D\331\323\025"
+	.string	"%\260\333\023\376\002\036\234\323\024.\343\0057\304\246\263n3\210\223+\2567I\372\357\262\017\332>j2\356n\344\365\3535_#\246\333`+\361\0304\343\217\243\357\311<?s>\304\374Y\305\234\320>\032\221\377\345\3526$G\2622\317\350\267\220Y+-'x\252\276\261>s\323\312\177\305\031\366\311u\\\374\316\232\355\020\277\200\300G\030v\220d<\3421\373\341L\233\231'6$\364_\270\357\355\201\353\261b\3131\236Bv\036\017\275\207\\o\373c\366\036\024a\020\356\316\022:\027\305qy\267\377o\035\025\307\003|\330\374\026s/c\213{\352yF\347\250\335DB=S\364<\335\357+9\2074\\\363w\025]\376\244\367\274Kq\233\001\254\364\265B\017\214P\267\201\007P\355\033\004\373\203\353\036\200\376\207,\356\256>>\260\336\301\034\335\372\200\245\364G!k\367\277\"\332jq\276\352\227\254\017?\227p\262"
+	.string	"\3445my\257\305\rI8r\214\003\214\377\352\236\030V\377Q<\004\277\335\353\226^\336i\303V~\335\354z;\371\2310\207\272\372\232\024W$\237\350\353KG7\2240n\303\313|\036>Y\3339cp\260\374\270\177\232\267\377=\315~x\367\035?M\342\367\325\355d_\217\335\ts\267\030\232\355\243\325:\256k\266\031\371e\323\223\001\036{\275\233\311\351\343?U6\274\374-\267'Z\352\344\320R4d`\247f\277\325\377\363\373#u\033\335\232\316\030\212v\2411\347\026\361\204\343\016%WX^\260v"
+	.ascii	"\324}i\f\320\260\035\\\317+\367S;>M\321\270\266\253]\226\313"
+	.ascii	"\\\342b.\346\262\213\275p/\346\312]\333U\344\202\016v\336\nI"
+	.ascii	"w\375'\233sM\016\337L|\004\333R\302\213P\342\247yj\213q\274\357"
+	.ascii	"\251\217\213\353Z\265(\347\202\251\252+"
+	.text
+	.section	.gnu.lto_.symtab.4f6253b0a424148d,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"mixerInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"motorOutputMax"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"motorOutputMin"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"motorOutputRange"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"throttle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"pidInitMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"pidSumLimit"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"pidSumLimitYaw"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"mixerUpdateMixMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"calculateThrottleAndCurrentMotorEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"applyMixToMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4f6253b0a424148d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18804 @@
+	.file	"navigation.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/flight/pid.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/fc/fc_core.h"
+	.file 10 "./src/main/fc/rc_modes.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/common/axis.h"
+	.file 13 "./src/main/flight/imu.h"
+	.file 14 "./src/main/flight/navigation.h"
+	.file 15 "./src/main/target/SITL/target.h"
+	.file 16 "./src/main/io/beeper.h"
+	.file 17 "./src/main/io/gps.h"
+	.file 18 "./src/main/sensors/sensors.h"
+	.file 19 "./src/main/flight/navigation.c"
+	.file 20 "./src/main/common/maths.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	navigation.c.58b2f763
+	.weak	navigation.c.58b2f763
+navigation.c.58b2f763:
+	.long	0x120b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF2627
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2264
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2265
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2266
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2267
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2268
+	.uleb128 0x3
+	.long	.LASF2269
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2270
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2271
+	.uleb128 0x3
+	.long	.LASF2272
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2273
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2274
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2275
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2276
+	.uleb128 0x3
+	.long	.LASF2277
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2278
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2279
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2280
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2281
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2282
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2283
+	.uleb128 0x1e
+	.long	.LASF2482
+	.byte	0xf
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2284
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2285
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x134
+	.uleb128 0x14
+	.long	.LASF2286
+	.value	0xfff
+	.uleb128 0x14
+	.long	.LASF2287
+	.value	0xf000
+	.uleb128 0x14
+	.long	.LASF2288
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2290
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x140
+	.uleb128 0x24
+	.long	0x150
+	.uleb128 0xb
+	.long	0x96
+	.uleb128 0xb
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x171
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x1a
+	.string	"fn"
+	.byte	0x5
+	.byte	0x33
+	.byte	0x16
+	.long	0x171
+	.byte	0
+	.uleb128 0xc
+	.long	0x134
+	.uleb128 0x15
+	.long	.LASF2344
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x1d1
+	.uleb128 0x8
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x101
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1d1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1d1
+	.byte	0x10
+	.uleb128 0x8
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x1d6
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x150
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	0xb7
+	.uleb128 0xc
+	.long	0x1d1
+	.uleb128 0x3
+	.long	.LASF2295
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x176
+	.uleb128 0x20
+	.long	0x1db
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2296
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x319
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2345
+	.byte	0x4c
+	.byte	0x7
+	.byte	0x4a
+	.long	0x492
+	.uleb128 0x8
+	.string	"pid"
+	.byte	0x7
+	.byte	0x4b
+	.byte	0xc
+	.long	0x8d6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x7
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x7
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x7
+	.byte	0x51
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x7
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x7
+	.byte	0x53
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0x7
+	.byte	0x54
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x7
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x7
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x7
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0x7
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x7
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2359
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2360
+	.byte	0x7
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2361
+	.byte	0x7
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2362
+	.byte	0x7
+	.byte	0x60
+	.byte	0xe
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2363
+	.byte	0x7
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2364
+	.byte	0x7
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF2365
+	.byte	0x7
+	.byte	0x63
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2366
+	.byte	0x7
+	.byte	0x64
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0x7
+	.byte	0x65
+	.byte	0xe
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2368
+	.byte	0x7
+	.byte	0x66
+	.byte	0xe
+	.long	0xc3
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF2369
+	.byte	0x7
+	.byte	0x67
+	.byte	0xe
+	.long	0xc3
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2370
+	.byte	0x7
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF2371
+	.byte	0x7
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF2372
+	.byte	0x7
+	.byte	0x6a
+	.byte	0x18
+	.long	0x890
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2373
+	.byte	0x8
+	.byte	0x63
+	.byte	0x1d
+	.long	0x49e
+	.uleb128 0xc
+	.long	0x319
+	.uleb128 0x6
+	.long	.LASF2374
+	.byte	0x9
+	.byte	0x18
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.long	0x59f
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2413
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x3
+	.long	0x4af
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xb
+	.byte	0x15
+	.long	0x5c3
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2416
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xb
+	.byte	0x3c
+	.long	0x620
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x80
+	.uleb128 0x14
+	.long	.LASF2425
+	.value	0x100
+	.uleb128 0x14
+	.long	.LASF2426
+	.value	0x200
+	.uleb128 0x14
+	.long	.LASF2427
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2428
+	.byte	0xb
+	.byte	0x48
+	.byte	0x3
+	.long	0x5cf
+	.uleb128 0x6
+	.long	.LASF2429
+	.byte	0xb
+	.byte	0x4a
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xb
+	.byte	0x58
+	.long	0x662
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2435
+	.byte	0xb
+	.byte	0x64
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xc
+	.byte	0x25
+	.long	0x686
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x6
+	.byte	0xd
+	.byte	0x22
+	.byte	0x5
+	.long	0x6b7
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0xd
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0xd
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0xd
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x6
+	.byte	0xd
+	.byte	0x20
+	.byte	0x9
+	.long	0x6d9
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0xd
+	.byte	0x21
+	.byte	0xd
+	.long	0x6d9
+	.uleb128 0x25
+	.long	.LASF2440
+	.byte	0xd
+	.byte	0x27
+	.byte	0x7
+	.long	0x686
+	.byte	0
+	.uleb128 0xe
+	.long	0x9f
+	.long	0x6e9
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2441
+	.byte	0xd
+	.byte	0x28
+	.byte	0x3
+	.long	0x6b7
+	.uleb128 0x6
+	.long	.LASF2442
+	.byte	0xd
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x6e9
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xe
+	.byte	0x17
+	.long	0x71f
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2446
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x3
+	.long	0x701
+	.uleb128 0x15
+	.long	.LASF2447
+	.byte	0xc
+	.byte	0xe
+	.byte	0x1f
+	.long	0x793
+	.uleb128 0x2
+	.long	.LASF2448
+	.byte	0xe
+	.byte	0x20
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2449
+	.byte	0xe
+	.byte	0x21
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2450
+	.byte	0xe
+	.byte	0x22
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0xe
+	.byte	0x23
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2452
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2453
+	.byte	0xe
+	.byte	0x25
+	.byte	0xe
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2454
+	.byte	0xe
+	.byte	0x26
+	.byte	0xe
+	.long	0xc3
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2455
+	.byte	0xe
+	.byte	0x27
+	.byte	0x3
+	.long	0x72b
+	.uleb128 0x20
+	.long	0x793
+	.uleb128 0x6
+	.long	.LASF2456
+	.byte	0xe
+	.byte	0x29
+	.byte	0x1b
+	.long	0x793
+	.uleb128 0x6
+	.long	.LASF2457
+	.byte	0xe
+	.byte	0x29
+	.byte	0x4e
+	.long	0x793
+	.uleb128 0xe
+	.long	0x9f
+	.long	0x7cc
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2458
+	.byte	0xe
+	.byte	0x2b
+	.byte	0x10
+	.long	0x7bc
+	.uleb128 0xe
+	.long	0xab
+	.long	0x7e8
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2459
+	.byte	0xe
+	.byte	0x2d
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x6
+	.long	.LASF2460
+	.byte	0xe
+	.byte	0x2e
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x6
+	.long	.LASF2461
+	.byte	0xe
+	.byte	0x30
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2462
+	.byte	0xe
+	.byte	0x31
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x6
+	.long	.LASF2463
+	.byte	0xe
+	.byte	0x33
+	.byte	0x19
+	.long	0x71f
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x7
+	.byte	0x25
+	.long	0x872
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2468
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x7
+	.byte	0x3e
+	.long	0x890
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2478
+	.byte	0x7
+	.byte	0x42
+	.byte	0x3
+	.long	0x872
+	.uleb128 0x15
+	.long	.LASF2479
+	.byte	0x3
+	.byte	0x7
+	.byte	0x44
+	.long	0x8ca
+	.uleb128 0x8
+	.string	"P"
+	.byte	0x7
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x8
+	.string	"I"
+	.byte	0x7
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x8
+	.string	"D"
+	.byte	0x7
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2480
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x89c
+	.uleb128 0xe
+	.long	0x8ca
+	.long	0x8e6
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2481
+	.byte	0x7
+	.byte	0x6b
+	.byte	0x3
+	.long	0x319
+	.uleb128 0x1e
+	.long	.LASF2483
+	.byte	0x7
+	.byte	0x79
+	.byte	0x5
+	.long	0x1ec
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x10
+	.byte	0x17
+	.long	0x98e
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2506
+	.byte	0x10
+	.byte	0x31
+	.byte	0x3
+	.long	0x8fe
+	.uleb128 0x15
+	.long	.LASF2507
+	.byte	0xc
+	.byte	0x11
+	.byte	0x4f
+	.long	0x9ce
+	.uleb128 0x8
+	.string	"lat"
+	.byte	0x11
+	.byte	0x50
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x8
+	.string	"lon"
+	.byte	0x11
+	.byte	0x51
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x8
+	.string	"alt"
+	.byte	0x11
+	.byte	0x52
+	.byte	0xe
+	.long	0xc3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2508
+	.byte	0x11
+	.byte	0x53
+	.byte	0x3
+	.long	0x99a
+	.uleb128 0x15
+	.long	.LASF2509
+	.byte	0x18
+	.byte	0x11
+	.byte	0x55
+	.long	0xa35
+	.uleb128 0x2
+	.long	.LASF2510
+	.byte	0x11
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x8
+	.string	"llh"
+	.byte	0x11
+	.byte	0x57
+	.byte	0x13
+	.long	0x9ce
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2511
+	.byte	0x11
+	.byte	0x58
+	.byte	0xe
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2512
+	.byte	0x11
+	.byte	0x59
+	.byte	0xe
+	.long	0xc3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2513
+	.byte	0x11
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2514
+	.byte	0x11
+	.byte	0x5b
+	.byte	0xe
+	.long	0xc3
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2515
+	.byte	0x11
+	.byte	0x5c
+	.byte	0x3
+	.long	0x9da
+	.uleb128 0x6
+	.long	.LASF2516
+	.byte	0x11
+	.byte	0x76
+	.byte	0x1a
+	.long	0xa35
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2517
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2518
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x12
+	.byte	0x14
+	.long	0xa85
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2524
+	.byte	0x13
+	.byte	0x3a
+	.byte	0x21
+	.long	0x79f
+	.uleb128 0xf
+	.long	0x7a4
+	.byte	0x3a
+	.byte	0x56
+	.uleb128 0xf
+	.long	0x7b0
+	.byte	0x3a
+	.byte	0x82
+	.uleb128 0x6
+	.long	.LASF2525
+	.byte	0x13
+	.byte	0x3a
+	.byte	0xb3
+	.long	0x1e7
+	.uleb128 0x26
+	.long	0xa9f
+	.byte	0xe1
+	.uleb128 0x27
+	.long	0xa85
+	.byte	0x3c
+	.byte	0x1a
+	.uleb128 0xf
+	.long	0x7cc
+	.byte	0x4b
+	.byte	0x9
+	.uleb128 0xf
+	.long	0x7e8
+	.byte	0x4c
+	.byte	0x9
+	.uleb128 0xf
+	.long	0x7f4
+	.byte	0x4d
+	.byte	0x9
+	.uleb128 0xf
+	.long	0x800
+	.byte	0x4f
+	.byte	0xa
+	.uleb128 0xf
+	.long	0x80c
+	.byte	0x50
+	.byte	0x9
+	.uleb128 0x28
+	.string	"nav"
+	.byte	0x13
+	.byte	0x52
+	.byte	0x10
+	.long	0x7bc
+	.uleb128 0x4
+	.long	.LASF2526
+	.byte	0x53
+	.byte	0x10
+	.long	0x7bc
+	.uleb128 0xf
+	.long	0x818
+	.byte	0x54
+	.byte	0x12
+	.uleb128 0x1b
+	.byte	0x10
+	.byte	0x13
+	.byte	0x83
+	.byte	0x9
+	.long	0xb34
+	.uleb128 0x8
+	.string	"kP"
+	.byte	0x13
+	.byte	0x84
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x8
+	.string	"kI"
+	.byte	0x13
+	.byte	0x85
+	.byte	0xb
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x8
+	.string	"kD"
+	.byte	0x13
+	.byte	0x86
+	.byte	0xb
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2527
+	.byte	0x13
+	.byte	0x87
+	.byte	0xb
+	.long	0xdb
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2528
+	.byte	0x13
+	.byte	0x88
+	.byte	0x3
+	.long	0xaf9
+	.uleb128 0x4
+	.long	.LASF2529
+	.byte	0x8a
+	.byte	0x12
+	.long	0xb34
+	.uleb128 0x4
+	.long	.LASF2530
+	.byte	0x8b
+	.byte	0x12
+	.long	0xb34
+	.uleb128 0x1b
+	.byte	0x14
+	.byte	0x13
+	.byte	0x8d
+	.byte	0x9
+	.long	0xba1
+	.uleb128 0x2
+	.long	.LASF2531
+	.byte	0x13
+	.byte	0x8e
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2532
+	.byte	0x13
+	.byte	0x8f
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2533
+	.byte	0x13
+	.byte	0x90
+	.byte	0xb
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2534
+	.byte	0x13
+	.byte	0x91
+	.byte	0xb
+	.long	0xdb
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0x13
+	.byte	0x92
+	.byte	0xb
+	.long	0xdb
+	.byte	0x10
+	.byte	0
+	.uleb128 0x29
+	.string	"PID"
+	.byte	0x13
+	.byte	0x93
+	.byte	0x3
+	.long	0xb56
+	.uleb128 0xe
+	.long	0xba1
+	.long	0xbbd
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2536
+	.byte	0x95
+	.byte	0xc
+	.long	0xbad
+	.uleb128 0x4
+	.long	.LASF2537
+	.byte	0x96
+	.byte	0xc
+	.long	0xbad
+	.uleb128 0x4
+	.long	.LASF2538
+	.byte	0x99
+	.byte	0x12
+	.long	0xb34
+	.uleb128 0x4
+	.long	.LASF2539
+	.byte	0x9a
+	.byte	0xc
+	.long	0xbad
+	.uleb128 0x4
+	.long	.LASF2540
+	.byte	0xcb
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2541
+	.byte	0xcc
+	.byte	0x10
+	.long	0x7bc
+	.uleb128 0x4
+	.long	.LASF2542
+	.byte	0xcd
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2543
+	.byte	0xce
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x4
+	.long	.LASF2544
+	.byte	0xd3
+	.byte	0x10
+	.long	0x7bc
+	.uleb128 0x4
+	.long	.LASF2545
+	.byte	0xd5
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2546
+	.byte	0xd9
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x4
+	.long	.LASF2547
+	.byte	0xdf
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2548
+	.byte	0xe5
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2549
+	.byte	0xec
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF2550
+	.byte	0xef
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2551
+	.byte	0xf6
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xe
+	.long	0xab
+	.long	0xc83
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2552
+	.byte	0xf7
+	.byte	0x10
+	.long	0xc6d
+	.uleb128 0x4
+	.long	.LASF2553
+	.byte	0xf8
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x4
+	.long	.LASF2554
+	.byte	0xf9
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x4
+	.long	.LASF2555
+	.byte	0xfa
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0x4
+	.long	.LASF2556
+	.byte	0xfb
+	.byte	0x10
+	.long	0x7d8
+	.uleb128 0xe
+	.long	0xc3
+	.long	0xcca
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2557
+	.byte	0xfc
+	.byte	0x11
+	.long	0xcba
+	.uleb128 0x5
+	.long	.LASF2558
+	.value	0x100
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2559
+	.value	0x102
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x2a
+	.long	.LASF2628
+	.byte	0x10
+	.byte	0x3c
+	.byte	0x6
+	.long	0xcff
+	.uleb128 0xb
+	.long	0x98e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2560
+	.byte	0x13
+	.byte	0x46
+	.byte	0x5
+	.long	0x1ec
+	.long	0xd15
+	.uleb128 0xb
+	.long	0xc3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2561
+	.byte	0xb
+	.byte	0x67
+	.byte	0xa
+	.long	0xc3
+	.long	0xd2b
+	.uleb128 0xb
+	.long	0x620
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2562
+	.byte	0xb
+	.byte	0x66
+	.byte	0xa
+	.long	0xc3
+	.long	0xd41
+	.uleb128 0xb
+	.long	0x620
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2563
+	.byte	0xa
+	.byte	0x66
+	.byte	0x5
+	.long	0x1ec
+	.long	0xd57
+	.uleb128 0xb
+	.long	0x59f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2564
+	.byte	0x14
+	.byte	0x6b
+	.byte	0x7
+	.long	0xdb
+	.long	0xd6d
+	.uleb128 0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2565
+	.byte	0x14
+	.byte	0x6c
+	.byte	0x7
+	.long	0xdb
+	.long	0xd83
+	.uleb128 0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2629
+	.byte	0x16
+	.byte	0x1d
+	.byte	0xa
+	.long	0xf5
+	.uleb128 0x10
+	.long	.LASF2566
+	.byte	0x14
+	.byte	0x6d
+	.byte	0x7
+	.long	0xdb
+	.long	0xdaa
+	.uleb128 0xb
+	.long	0xdb
+	.uleb128 0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2567
+	.byte	0x15
+	.byte	0x8f
+	.byte	0xe
+	.long	0xdb
+	.long	0xdc0
+	.uleb128 0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2570
+	.value	0x2ad
+	.long	0xde4
+	.uleb128 0x5
+	.long	.LASF2568
+	.value	0x2af
+	.byte	0x9
+	.long	0x1ec
+	.uleb128 0x5
+	.long	.LASF2569
+	.value	0x2b0
+	.byte	0x10
+	.long	0x1ec
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2571
+	.value	0x29e
+	.long	0xe08
+	.uleb128 0x5
+	.long	.LASF2572
+	.value	0x2a0
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2573
+	.value	0x2a1
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2574
+	.value	0x294
+	.byte	0x10
+	.long	0xab
+	.long	0xe25
+	.uleb128 0x7
+	.long	.LASF2576
+	.value	0x294
+	.byte	0x23
+	.long	0xab
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2575
+	.value	0x28a
+	.byte	0x10
+	.long	0xab
+	.long	0xe42
+	.uleb128 0x7
+	.long	.LASF2543
+	.value	0x28a
+	.byte	0x23
+	.long	0xab
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2577
+	.value	0x273
+	.byte	0x11
+	.long	0xc3
+	.long	0xe6b
+	.uleb128 0x7
+	.long	.LASF2578
+	.value	0x273
+	.byte	0x31
+	.long	0xc3
+	.uleb128 0x7
+	.long	.LASF2579
+	.value	0x273
+	.byte	0x40
+	.long	0x1ec
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2581
+	.value	0x25c
+	.long	0xe85
+	.uleb128 0x18
+	.uleb128 0x5
+	.long	.LASF2580
+	.value	0x25f
+	.byte	0xf
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2582
+	.value	0x23d
+	.long	0xec1
+	.uleb128 0x7
+	.long	.LASF2578
+	.value	0x23d
+	.byte	0x28
+	.long	0xc3
+	.uleb128 0x5
+	.long	.LASF2583
+	.value	0x23f
+	.byte	0xb
+	.long	0xec1
+	.uleb128 0x5
+	.long	.LASF2580
+	.value	0x240
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2584
+	.value	0x241
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0xe
+	.long	0xdb
+	.long	0xed1
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2585
+	.value	0x21f
+	.long	0xeff
+	.uleb128 0x19
+	.string	"d"
+	.value	0x221
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2586
+	.value	0x222
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2584
+	.value	0x223
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2587
+	.value	0x215
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2588
+	.value	0x215
+	.byte	0x2e
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2589
+	.value	0x215
+	.byte	0x43
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2590
+	.value	0x215
+	.byte	0x58
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2591
+	.value	0x215
+	.byte	0x6a
+	.long	0xf3b
+	.byte	0
+	.uleb128 0xc
+	.long	0xab
+	.uleb128 0x13
+	.long	.LASF2592
+	.value	0x1f5
+	.long	0xf7e
+	.uleb128 0x5
+	.long	.LASF2593
+	.value	0x1f7
+	.byte	0x14
+	.long	0x7bc
+	.uleb128 0x5
+	.long	.LASF2594
+	.value	0x1f8
+	.byte	0x14
+	.long	0x7d8
+	.uleb128 0x5
+	.long	.LASF2595
+	.value	0x1f9
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x18
+	.uleb128 0x19
+	.string	"tmp"
+	.value	0x1fc
+	.byte	0xf
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2596
+	.value	0x1dc
+	.long	0xfea
+	.uleb128 0x7
+	.long	.LASF2597
+	.value	0x1dc
+	.byte	0x2e
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2598
+	.value	0x1dc
+	.byte	0x44
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2599
+	.value	0x1dc
+	.byte	0x5a
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2600
+	.value	0x1dc
+	.byte	0x74
+	.long	0xf3b
+	.uleb128 0x7
+	.long	.LASF2601
+	.value	0x1dc
+	.byte	0x8f
+	.long	0xfea
+	.uleb128 0x7
+	.long	.LASF2602
+	.value	0x1dc
+	.byte	0x9e
+	.long	0xf3b
+	.uleb128 0x5
+	.long	.LASF2603
+	.value	0x1de
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x5
+	.long	.LASF2604
+	.value	0x1df
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0xc
+	.long	0xcf
+	.uleb128 0x17
+	.long	.LASF2605
+	.value	0x1cd
+	.byte	0xc
+	.long	0x1ec
+	.long	0x100c
+	.uleb128 0x5
+	.long	.LASF2580
+	.value	0x1cf
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2606
+	.value	0x1bb
+	.long	0x1030
+	.uleb128 0x1c
+	.string	"lat"
+	.value	0x1bb
+	.byte	0x1f
+	.long	0xf3b
+	.uleb128 0x1c
+	.string	"lon"
+	.value	0x1bb
+	.byte	0x2d
+	.long	0xf3b
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2607
+	.value	0x1b2
+	.long	0x1054
+	.uleb128 0x1c
+	.string	"lat"
+	.value	0x1b2
+	.byte	0x30
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2608
+	.value	0x1b4
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2609
+	.value	0x193
+	.long	0x106c
+	.uleb128 0x7
+	.long	.LASF2610
+	.value	0x193
+	.byte	0x1f
+	.long	0x106c
+	.byte	0
+	.uleb128 0xc
+	.long	0x8e6
+	.uleb128 0x12
+	.long	.LASF2611
+	.value	0x182
+	.long	0x1087
+	.uleb128 0x19
+	.string	"i"
+	.value	0x184
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2623
+	.byte	0x13
+	.value	0x175
+	.byte	0x6
+	.uleb128 0x12
+	.long	.LASF2612
+	.value	0x112
+	.long	0x10c8
+	.uleb128 0x5
+	.long	.LASF2613
+	.value	0x114
+	.byte	0x15
+	.long	0xcf
+	.uleb128 0x2d
+	.long	0x10b9
+	.uleb128 0x5
+	.long	.LASF2584
+	.value	0x123
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.long	.LASF2614
+	.value	0x151
+	.byte	0x12
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2615
+	.value	0x104
+	.long	0x10ee
+	.uleb128 0x18
+	.uleb128 0x5
+	.long	.LASF2601
+	.value	0x107
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x19
+	.string	"dir"
+	.value	0x108
+	.byte	0x11
+	.long	0xab
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2616
+	.byte	0x13
+	.byte	0xba
+	.byte	0xd
+	.long	0x1107
+	.uleb128 0x11
+	.string	"pid"
+	.byte	0x13
+	.byte	0xba
+	.byte	0x1c
+	.long	0x1107
+	.byte	0
+	.uleb128 0xc
+	.long	0xba1
+	.uleb128 0x1d
+	.long	.LASF2617
+	.byte	0xa8
+	.long	0xab
+	.long	0x1155
+	.uleb128 0x16
+	.long	.LASF2618
+	.byte	0x13
+	.byte	0xa8
+	.byte	0x1e
+	.long	0xab
+	.uleb128 0x11
+	.string	"dt"
+	.byte	0x13
+	.byte	0xa8
+	.byte	0x2c
+	.long	0x1155
+	.uleb128 0x11
+	.string	"pid"
+	.byte	0x13
+	.byte	0xa8
+	.byte	0x35
+	.long	0x1107
+	.uleb128 0x16
+	.long	.LASF2619
+	.byte	0x13
+	.byte	0xa8
+	.byte	0x45
+	.long	0x115a
+	.uleb128 0x4
+	.long	.LASF2620
+	.byte	0xae
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0xc
+	.long	0xdb
+	.uleb128 0xc
+	.long	0xb34
+	.uleb128 0x1d
+	.long	.LASF2621
+	.byte	0xa1
+	.long	0xab
+	.long	0x119d
+	.uleb128 0x16
+	.long	.LASF2543
+	.byte	0x13
+	.byte	0xa1
+	.byte	0x1e
+	.long	0xab
+	.uleb128 0x11
+	.string	"dt"
+	.byte	0x13
+	.byte	0xa1
+	.byte	0x2c
+	.long	0x1155
+	.uleb128 0x11
+	.string	"pid"
+	.byte	0x13
+	.byte	0xa1
+	.byte	0x35
+	.long	0x1107
+	.uleb128 0x16
+	.long	.LASF2619
+	.byte	0x13
+	.byte	0xa1
+	.byte	0x45
+	.long	0x115a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2622
+	.byte	0x9c
+	.long	0xab
+	.long	0x11c4
+	.uleb128 0x16
+	.long	.LASF2543
+	.byte	0x13
+	.byte	0x9c
+	.byte	0x1e
+	.long	0xab
+	.uleb128 0x11
+	.string	"pid"
+	.byte	0x13
+	.byte	0x9c
+	.byte	0x30
+	.long	0x115a
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2624
+	.byte	0x13
+	.byte	0x57
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF2630
+	.byte	0xe
+	.byte	0x29
+	.byte	0x8d
+	.long	0x11d8
+	.uleb128 0xc
+	.long	0x79f
+	.uleb128 0x31
+	.long	.LASF2625
+	.byte	0x14
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x11
+	.string	"amt"
+	.byte	0x14
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x11
+	.string	"low"
+	.byte	0x14
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x16
+	.long	.LASF2626
+	.byte	0x14
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 48 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x30
+	.file 49 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 51 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 52 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 53 "./src/main/common/gps_conversion.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1426
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.file 54 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 55 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x8
+	.file 56 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.file 57 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 60 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3d
+	.file 62 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 63 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x3f
+	.file 64 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 65 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1959
+	.byte	0x4
+	.file 66 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x42
+	.file 67 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 68 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 69 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1969
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x10
+	.byte	0x4
+	.file 70 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 71 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 72 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x48
+	.file 73 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x49
+	.file 74 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4b
+	.byte	0x4
+	.file 76 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4c
+	.byte	0x4
+	.file 77 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 78 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2127
+	.file 79 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2131
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2132
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2141
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2146
+	.byte	0x4
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 87 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2179
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2180
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2181
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2182
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2183
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2184
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2185
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2186
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2187
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2188
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2189
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2201
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2208
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2209
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2210
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x68
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2213
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x69
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2214
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.file 107 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF2263
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF989
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF993
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF995
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1300
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1317
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1384
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1425
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1433
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1540
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1542
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1590
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1958
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1968
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1988
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2011
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2126
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1367
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2138
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2140
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2200
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2204
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2212
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2247
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2631
+	.long	.LASF2632
+	.long	.LASF2633
+	.long	.LASF2634
+	.long	.LASF2635
+	.long	.LASF2636
+	.long	.LASF2637
+	.long	.LASF2638
+	.long	.LASF2639
+	.long	.LASF2640
+	.long	.LASF2641
+	.long	.LASF2642
+	.long	.LASF2643
+	.long	.LASF2644
+	.long	.LASF2645
+	.long	.LASF2646
+	.long	.LASF2647
+	.long	.LASF2648
+	.long	.LASF2649
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x6c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2650
+	.byte	0xf
+	.long	.LASF2651
+	.byte	0xf
+	.long	.LASF2652
+	.byte	0xf
+	.long	.LASF2653
+	.byte	0x2
+	.long	.LASF2654
+	.byte	0x3
+	.long	.LASF2655
+	.byte	0x5
+	.long	.LASF2656
+	.byte	0x7
+	.long	.LASF2657
+	.byte	0x6
+	.long	.LASF2658
+	.byte	0x6
+	.long	.LASF2659
+	.byte	0x6
+	.long	.LASF2660
+	.byte	0x6
+	.long	.LASF2661
+	.byte	0x2
+	.long	.LASF2662
+	.byte	0x7
+	.long	.LASF2663
+	.byte	0x7
+	.long	.LASF2664
+	.byte	0xb
+	.long	.LASF2665
+	.byte	0x8
+	.long	.LASF2666
+	.byte	0x8
+	.long	.LASF2667
+	.byte	0xa
+	.long	.LASF2668
+	.byte	0x7
+	.long	.LASF2669
+	.byte	0x2
+	.long	.LASF2670
+	.byte	0xf
+	.long	.LASF2653
+	.byte	0x5
+	.long	.LASF2671
+	.byte	0x12
+	.long	.LASF2672
+	.byte	0x13
+	.long	.LASF2673
+	.byte	0x13
+	.long	.LASF2673
+	.byte	0x12
+	.long	.LASF2674
+	.byte	0xf
+	.long	.LASF2675
+	.byte	0x12
+	.long	.LASF2676
+	.byte	0x12
+	.long	.LASF2677
+	.byte	0xf
+	.long	.LASF2678
+	.byte	0xf
+	.long	.LASF2679
+	.byte	0x11
+	.long	.LASF2680
+	.byte	0xf
+	.long	.LASF2681
+	.byte	0x10
+	.long	.LASF2682
+	.byte	0x10
+	.long	.LASF2683
+	.byte	0xf
+	.long	.LASF2684
+	.byte	0xf
+	.long	.LASF2685
+	.byte	0xf
+	.long	.LASF2686
+	.byte	0x12
+	.long	.LASF2687
+	.byte	0xf
+	.long	.LASF2688
+	.byte	0xf
+	.long	.LASF2689
+	.byte	0xf
+	.long	.LASF2690
+	.byte	0xf
+	.long	.LASF2691
+	.byte	0xf
+	.long	.LASF2692
+	.byte	0xf
+	.long	.LASF2693
+	.byte	0xf
+	.long	.LASF2694
+	.byte	0xf
+	.long	.LASF2695
+	.byte	0xd
+	.long	.LASF2696
+	.byte	0xc
+	.long	.LASF2697
+	.byte	0x13
+	.long	.LASF2698
+	.byte	0xc
+	.long	.LASF2699
+	.byte	0x1
+	.long	.LASF2700
+	.byte	0x2
+	.long	.LASF2701
+	.byte	0x1
+	.long	.LASF2702
+	.byte	0x3
+	.long	.LASF2703
+	.byte	0x5
+	.long	.LASF2704
+	.byte	0x5
+	.long	.LASF2705
+	.byte	0x5
+	.long	.LASF2706
+	.byte	0x5
+	.long	.LASF2707
+	.byte	0x5
+	.long	.LASF2708
+	.byte	0x5
+	.long	.LASF2709
+	.byte	0x5
+	.long	.LASF2710
+	.byte	0x5
+	.long	.LASF2711
+	.byte	0x2
+	.long	.LASF2712
+	.byte	0x5
+	.long	.LASF2713
+	.byte	0x5
+	.long	.LASF2714
+	.byte	0x5
+	.long	.LASF2715
+	.byte	0x5
+	.long	.LASF2716
+	.byte	0x5
+	.long	.LASF2708
+	.byte	0x8
+	.long	.LASF2717
+	.byte	0x9
+	.long	.LASF2718
+	.byte	0xa
+	.long	.LASF2719
+	.byte	0x4
+	.long	.LASF2720
+	.byte	0x5
+	.long	.LASF2721
+	.byte	0x5
+	.long	.LASF2722
+	.byte	0x5
+	.long	.LASF2723
+	.byte	0x4
+	.long	.LASF2724
+	.byte	0x12
+	.long	.LASF2725
+	.byte	0x12
+	.long	.LASF2726
+	.byte	0xe
+	.long	.LASF2727
+	.byte	0xe
+	.long	.LASF2728
+	.byte	0xf
+	.long	.LASF2729
+	.byte	0xf
+	.long	.LASF2725
+	.byte	0xf
+	.long	.LASF2730
+	.byte	0xe
+	.long	.LASF2731
+	.byte	0xf
+	.long	.LASF2653
+	.byte	0x12
+	.long	.LASF2653
+	.byte	0xf
+	.long	.LASF2732
+	.byte	0xe
+	.long	.LASF2733
+	.byte	0xe
+	.long	.LASF2734
+	.byte	0xe
+	.long	.LASF2735
+	.byte	0xe
+	.long	.LASF2736
+	.byte	0xe
+	.long	.LASF2737
+	.byte	0xe
+	.long	.LASF2738
+	.byte	0xe
+	.long	.LASF2739
+	.byte	0xf
+	.long	.LASF2740
+	.byte	0xf
+	.long	.LASF2741
+	.byte	0xf
+	.long	.LASF2742
+	.byte	0xf
+	.long	.LASF2743
+	.byte	0xf
+	.long	.LASF2744
+	.byte	0xf
+	.long	.LASF2745
+	.byte	0xf
+	.long	.LASF2746
+	.byte	0xe
+	.long	.LASF2747
+	.byte	0xe
+	.long	.LASF2748
+	.byte	0xf
+	.long	.LASF2749
+	.byte	0xf
+	.long	.LASF2750
+	.byte	0xa
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1950:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2200:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1061:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1722:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1973:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1586:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF732:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1124:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1780:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1726:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1717:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1281:
+	.string	"USE_FAKE_BARO "
+.LASF1057:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2003:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF948:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1597:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1377:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1248:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2076:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2525:
+	.string	"navigationConfig_Registry"
+.LASF841:
+	.string	"__DECL_SIMD_sinh "
+.LASF1215:
+	.string	"USE_CLI "
+.LASF1414:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1632:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1242:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF769:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF2162:
+	.string	"sched_priority sched_priority"
+.LASF1302:
+	.string	"USE_PPM"
+.LASF2550:
+	.string	"waypoint_speed_gov"
+.LASF2043:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF2475:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF2483:
+	.string	"airmodeWasActivated"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1800:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1595:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1179:
+	.string	"FP_NORMAL 4"
+.LASF905:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF885:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF742:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2066:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF2141:
+	.string	"__pid_t_defined "
+.LASF2133:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2607:
+	.string	"GPS_calc_longitude_scaling"
+.LASF1426:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1434:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1934:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1201:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF946:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1329:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2407:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2269:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2163:
+	.string	"__sched_priority sched_priority"
+.LASF1030:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1674:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2296:
+	.string	"_Bool"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1959:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF700:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1799:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1267:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1545:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1119:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF990:
+	.string	"__DECL_SIMD_expf"
+.LASF2148:
+	.string	"__CPU_SETSIZE 1024"
+.LASF909:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1243:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2172:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2305:
+	.string	"OWNER_ADC_CURR"
+.LASF2260:
+	.string	"NAV_BANK_MAX 3000"
+.LASF837:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1554:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2129:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1653:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1065:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1604:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2547:
+	.string	"target_bearing"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2224:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2499:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2493:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1759:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1549:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1470:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1984:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1370:
+	.string	"_WCHAR_T "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1143:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1877:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2265:
+	.string	"short unsigned int"
+.LASF1328:
+	.string	"USE_SPI"
+.LASF2524:
+	.string	"pgResetTemplate_navigationConfig"
+.LASF1982:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF746:
+	.string	"__DECL_SIMD_expf64 "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1249:
+	.string	"USE_SENSOR_NAMES "
+.LASF1946:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2262:
+	.string	"DISTANCE_BETWEEN_TWO_LONGITUDE_POINTS_AT_EQUATOR_IN_HUNDREDS_OF_KILOMETERS 1.113195f"
+.LASF2576:
+	.string	"angle"
+.LASF1497:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf "
+.LASF717:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1489:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF890:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1785:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1918:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2118:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2573:
+	.string	"cos_yaw_x"
+.LASF1453:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2302:
+	.string	"OWNER_LED"
+.LASF705:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2431:
+	.string	"GPS_FIX"
+.LASF1617:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1922:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1634:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1725:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF730:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2280:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF2176:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1023:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1526:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1474:
+	.string	"PG_RX_CONFIG 24"
+.LASF2152:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2075:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1066:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1885:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1729:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1864:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1233:
+	.string	"TELEMETRY_HOTT "
+.LASF724:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF863:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1032:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2261:
+	.string	"GPS_FILTER_VECTOR_LENGTH 5"
+.LASF1968:
+	.string	"BEEP_ON do {} while (0)"
+.LASF2545:
+	.string	"crosstrack_error"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1182:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF699:
+	.string	"_MATH_H 1"
+.LASF1817:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1397:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1838:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1579:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1339:
+	.string	"_T_PTRDIFF_ "
+.LASF1333:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF2106:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2021:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF713:
+	.string	"__DECL_SIMD_sinl "
+.LASF1828:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1296:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF715:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1697:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2600:
+	.string	"destinationLon2"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2529:
+	.string	"posholdPID_PARAM"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF763:
+	.string	"__DECL_SIMD_acosl "
+.LASF771:
+	.string	"__DECL_SIMD_atan "
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2373:
+	.string	"currentPidProfile"
+.LASF2244:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF961:
+	.string	"__DECL_SIMD_tan "
+.LASF1574:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2432:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1368:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2498:
+	.string	"BEEPER_READY_BEEP"
+.LASF734:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2015:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1605:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2146:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2145:
+	.string	"SCHED_RR 2"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1909:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2032:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2397:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1104:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1493:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1237:
+	.string	"CMS "
+.LASF2549:
+	.string	"wp_distance"
+.LASF2081:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF790:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1917:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2466:
+	.string	"PID_YAW"
+.LASF2589:
+	.string	"target_lng"
+.LASF1810:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1873:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF733:
+	.string	"__DECL_SIMD_logl "
+.LASF2551:
+	.string	"GPS_filter_index"
+.LASF1945:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2328:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1933:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1078:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1064:
+	.string	"__DECL_SIMD_tanh"
+.LASF1451:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF970:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1613:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1501:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF2229:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1571:
+	.string	"BIT(x) (1 << (x))"
+.LASF2333:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2616:
+	.string	"reset_PID"
+.LASF1005:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1319:
+	.string	"TELEMETRY_IBUS"
+.LASF741:
+	.string	"__DECL_SIMD_exp "
+.LASF2516:
+	.string	"gpsSol"
+.LASF2231:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2544:
+	.string	"rate_error"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1076:
+	.string	"__DECL_SIMD_tan"
+.LASF816:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF833:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1134:
+	.string	"_Mdouble_"
+.LASF2278:
+	.string	"int32_t"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1412:
+	.string	"FAST_MATH "
+.LASF1280:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF991:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1560:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1052:
+	.string	"__DECL_SIMD_atanh"
+.LASF925:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2099:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1927:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1728:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1379:
+	.string	"___int_wchar_t_h "
+.LASF2341:
+	.string	"OWNER_SPI_PREINIT"
+.LASF743:
+	.string	"__DECL_SIMD_expl "
+.LASF1867:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1562:
+	.string	"STR_HELPER(x) #x"
+.LASF1270:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1541:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1637:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1668:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1003:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1980:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1326:
+	.string	"VTX_TRAMP"
+.LASF2042:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2330:
+	.string	"OWNER_BARO_EXTI"
+.LASF996:
+	.string	"__DECL_SIMD_acos"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1659:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__always_inline"
+.LASF807:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF926:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1682:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2530:
+	.string	"poshold_ratePID_PARAM"
+.LASF840:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2027:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF839:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1407:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1593:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1949:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2440:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1599:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2308:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2380:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1490:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1135:
+	.string	"__MATH_PRECNAME"
+.LASF876:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2040:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1646:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1040:
+	.string	"__DECL_SIMD_log10"
+.LASF2288:
+	.string	"PGR_SIZE_MASK"
+.LASF2586:
+	.string	"target_speed"
+.LASF1024:
+	.string	"__DECL_SIMD_expm1"
+.LASF1167:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF808:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1009:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1138:
+	.string	"_Mdouble_ float"
+.LASF2193:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1660:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"VTX_COMMON"
+.LASF976:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1122:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1245:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2526:
+	.string	"nav_rated"
+.LASF1904:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"_T_SIZE_ "
+.LASF1128:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1993:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF718:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF913:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1171:
+	.string	"__MATHCALL_NARROW"
+.LASF2120:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1966:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1761:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"USE_DASHBOARD "
+.LASF2166:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2016:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1847:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1048:
+	.string	"__DECL_SIMD_log1p"
+.LASF2053:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1156:
+	.string	"__MATHDECL_1"
+.LASF2505:
+	.string	"BEEPER_PREFERENCE"
+.LASF1701:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1912:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2390:
+	.string	"BOXLEDLOW"
+.LASF1033:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2331:
+	.string	"OWNER_USB"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10"
+.LASF1738:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF922:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1446:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1364:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1910:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2354:
+	.string	"dterm_average_count"
+.LASF1092:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1594:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1026:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2377:
+	.string	"BOXHORIZON"
+.LASF2417:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1563:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1448:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2352:
+	.string	"pidSumLimit"
+.LASF2359:
+	.string	"horizon_tilt_effect"
+.LASF1046:
+	.string	"__DECL_SIMD_log2f"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1979:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF801:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1654:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2332:
+	.string	"OWNER_USB_DETECT"
+.LASF819:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1791:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1348:
+	.string	"__need_ptrdiff_t"
+.LASF1829:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1465:
+	.string	"PG_PID_PROFILE 14"
+.LASF2347:
+	.string	"dterm_lpf_hz"
+.LASF1753:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1165:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1130:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1731:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF930:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1976:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2391:
+	.string	"BOXLLIGHTS"
+.LASF1084:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2313:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1321:
+	.string	"TELEMETRY_SRXL"
+.LASF2569:
+	.string	"gpsReadyBeepDone"
+.LASF1997:
+	.string	"PIDSUM_LIMIT 500"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1870:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2073:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1180:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2026:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1736:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1482:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2378:
+	.string	"BOXBARO"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2509:
+	.string	"gpsSolutionData_s"
+.LASF1561:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2301:
+	.string	"OWNER_SERVO"
+.LASF1573:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1274:
+	.string	"ACC "
+.LASF2161:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF975:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2047:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2628:
+	.string	"beeper"
+.LASF1464:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1297:
+	.string	"STACK_CHECK"
+.LASF2428:
+	.string	"flightModeFlags_e"
+.LASF1240:
+	.string	"TELEMETRY_IBUS "
+.LASF1219:
+	.string	"USE_PWM "
+.LASF2485:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF826:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1299:
+	.string	"TELEMETRY_LTM"
+.LASF2495:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1985:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF2236:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1681:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1627:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2251:
+	.string	"NAV_TAIL_FIRST 0"
+.LASF1611:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2461:
+	.string	"GPS_distanceToHome"
+.LASF2214:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2060:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF760:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1938:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1614:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2267:
+	.string	"long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1841:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2438:
+	.string	"roll"
+.LASF1345:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1678:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2247:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2012:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2270:
+	.string	"__int16_t"
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2164:
+	.string	"_TIME_H 1"
+.LASF2350:
+	.string	"dterm_notch_cutoff"
+.LASF2272:
+	.string	"__uint16_t"
+.LASF1107:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2171:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2300:
+	.string	"OWNER_MOTOR"
+.LASF827:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1401:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1393:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1957:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2094:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF364:
+	.string	"__k8 1"
+.LASF1421:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF2114:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2327:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2584:
+	.string	"axis"
+.LASF872:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1188:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2541:
+	.string	"actual_speed"
+.LASF1974:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF797:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1566:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1967:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF2608:
+	.string	"rads"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1399:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF766:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2368:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1765:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF828:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1034:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1282:
+	.string	"USE_FLASHFS "
+.LASF1673:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1960:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1913:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1655:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF936:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1411:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1712:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2117:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF729:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1041:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1972:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1396:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1185:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2520:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1103:
+	.string	"__f32x(x) x ##f32x"
+.LASF815:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1155:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2127:
+	.string	"_PTHREAD_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1778:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1734:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF2169:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1558:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1161:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1169:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1527:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1724:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1250:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF2418:
+	.string	"HORIZON_MODE"
+.LASF2592:
+	.string	"GPS_calc_velocity"
+.LASF1596:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2264:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1612:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2157:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF758:
+	.string	"__DECL_SIMD_powf32x "
+.LASF889:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF2165:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1741:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1113:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1537:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF2491:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1071:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1346:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1802:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1273:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1258:
+	.string	"USE_NAV "
+.LASF2230:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1483:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1819:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1214:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF2274:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1272:
+	.string	"USE_FAKE_LED "
+.LASF2282:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2048:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1461:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2553:
+	.string	"GPS_filter_sum"
+.LASF1618:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2375:
+	.string	"BOXARM"
+.LASF2149:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1766:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2226:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1391:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1708:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2427:
+	.string	"FAILSAFE_MODE"
+.LASF1158:
+	.string	"__MATHDECL"
+.LASF1276:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2458:
+	.string	"GPS_angle"
+.LASF2240:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF923:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1559:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF2623:
+	.string	"GPS_reset_home_position"
+.LASF1684:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2534:
+	.string	"output"
+.LASF1547:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1630:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF784:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1338:
+	.string	"_PTRDIFF_T "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2344:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF973:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1398:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1428:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1051:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF2086:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF880:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2061:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2225:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1990:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF849:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2388:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1236:
+	.string	"USE_SERVOS "
+.LASF2220:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF380:
+	.string	"__unix 1"
+.LASF2167:
+	.string	"CLOCK_REALTIME 0"
+.LASF1665:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2403:
+	.string	"BOXAIRMODE"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2339:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1230:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1863:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1769:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2101:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF774:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1186:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2128:
+	.string	"_SCHED_H 1"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2515:
+	.string	"gpsSolutionData_t"
+.LASF2258:
+	.string	"CROSSTRACK_GAIN 1"
+.LASF1468:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2626:
+	.string	"high"
+.LASF1142:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2494:
+	.string	"BEEPER_RX_SET"
+.LASF2239:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2595:
+	.string	"init"
+.LASF1699:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2594:
+	.string	"last_coord"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2490:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF2528:
+	.string	"PID_PARAM"
+.LASF2070:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1820:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1227:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2025:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1404:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2322:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1906:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1916:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2037:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1610:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF2555:
+	.string	"GPS_filtered"
+.LASF1567:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2503:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF822:
+	.string	"__DECL_SIMD_coshf "
+.LASF903:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1737:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1677:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2360:
+	.string	"horizon_tilt_expert_mode"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1801:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2216:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1615:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1177:
+	.string	"FP_ZERO 2"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1704:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1721:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2182:
+	.string	"__timer_t_defined 1"
+.LASF1152:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1727:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2443:
+	.string	"NAV_MODE_NONE"
+.LASF847:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2286:
+	.string	"PGR_PGN_MASK"
+.LASF2398:
+	.string	"BOXSERVO1"
+.LASF2399:
+	.string	"BOXSERVO2"
+.LASF2400:
+	.string	"BOXSERVO3"
+.LASF2098:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1093:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1129:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1132:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1650:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2211:
+	.string	"____sigset_t_defined "
+.LASF2533:
+	.string	"last_derivative"
+.LASF2565:
+	.string	"cos_approx"
+.LASF1936:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1865:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1540:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF710:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF873:
+	.string	"__DECL_SIMD_log10l "
+.LASF1963:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF2433:
+	.string	"SMALL_ANGLE"
+.LASF1207:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1948:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1876:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1498:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1598:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1524:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1705:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF750:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2254:
+	.string	"GPS_LOW_SPEED_D_FILTER 1"
+.LASF2055:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1907:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1095:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF701:
+	.string	"__DECL_SIMD_cos "
+.LASF2153:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1633:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2284:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1047:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF2039:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1575:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF860:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2030:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF879:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1897:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2238:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF782:
+	.string	"__DECL_SIMD_asinf "
+.LASF1334:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2093:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1544:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2456:
+	.string	"navigationConfig_System"
+.LASF2291:
+	.string	"size"
+.LASF1218:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2521:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1645:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1508:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2420:
+	.string	"BARO_MODE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1433:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2506:
+	.string	"beeperMode_e"
+.LASF1162:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2121:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1268:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1657:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1146:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1020:
+	.string	"__DECL_SIMD_cosh"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF749:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF906:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF702:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2426:
+	.string	"SONAR_MODE"
+.LASF1940:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1437:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2046:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF735:
+	.string	"__DECL_SIMD_logf32 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1436:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1199:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1358:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2336:
+	.string	"OWNER_INVERTER"
+.LASF2543:
+	.string	"error"
+.LASF1998:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF2175:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2022:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF2317:
+	.string	"OWNER_SPI_MOSI"
+.LASF1919:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"MAG_MODE"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1740:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2279:
+	.string	"uint8_t"
+.LASF1121:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2566:
+	.string	"atan2_approx"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1994:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2316:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1908:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1680:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1707:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1136:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2201:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2522:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1748:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"TELEMETRY "
+.LASF1755:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF2414:
+	.string	"ARMED"
+.LASF767:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF2078:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1620:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1055:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF2217:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1073:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF959:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF941:
+	.string	"__DECL_SIMD_asinh "
+.LASF1730:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1790:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"VERY_FAST_MATH "
+.LASF1667:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2465:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1381:
+	.string	"_GCC_WCHAR_T "
+.LASF1376:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2395:
+	.string	"BOXTELEMETRY"
+.LASF1363:
+	.string	"___int_size_t_h "
+.LASF969:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1315:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1535:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2257:
+	.string	"RADX100 0.000174532925f"
+.LASF2579:
+	.string	"_slow"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1858:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2413:
+	.string	"boxId_e"
+.LASF1771:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1176:
+	.string	"FP_INFINITE 1"
+.LASF1166:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF821:
+	.string	"__DECL_SIMD_cosh "
+.LASF1168:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF711:
+	.string	"__DECL_SIMD_sin "
+.LASF2497:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF2202:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1796:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_"
+.LASF1996:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF979:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1072:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1444:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1086:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1356:
+	.string	"_SIZE_T_ "
+.LASF1025:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2154:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF995:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1746:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1585:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF2250:
+	.string	"NAV_IMAX 20"
+.LASF1367:
+	.string	"__need_size_t"
+.LASF1077:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2299:
+	.string	"OWNER_PPMINPUT"
+.LASF1590:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1550:
+	.string	"IOCFG_IPD 0"
+.LASF1303:
+	.string	"USE_PWM"
+.LASF754:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2357:
+	.string	"levelAngleLimit"
+.LASF785:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1111:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1209:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2147:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF823:
+	.string	"__DECL_SIMD_coshl "
+.LASF1427:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1137:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1150:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1486:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1335:
+	.string	"_STDDEF_H "
+.LASF1304:
+	.string	"SERIAL_RX"
+.LASF908:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1022:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1882:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"__DECL_SIMD_sinf"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1616:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2571:
+	.string	"updateGpsStateForHomeAndHoldMode"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1964:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1216:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1514:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1702:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF739:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1739:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2013:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1812:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2115:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1512:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1139:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1642:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1476:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1703:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2453:
+	.string	"nav_speed_max"
+.LASF1443:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF775:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1481:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2024:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2583:
+	.string	"trig"
+.LASF1666:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2209:
+	.string	"__have_pthread_attr_t 1"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1361:
+	.string	"_SIZE_T_DECLARED "
+.LASF2222:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1087:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2135:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2173:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2406:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1600:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1805:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2451:
+	.string	"nav_controls_heading"
+.LASF1719:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1683:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1710:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2477:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF1525:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1312:
+	.string	"LED_STRIP"
+.LASF1849:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1039:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1085:
+	.string	"__f128(x) x ##f128"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1141:
+	.string	"_Mdouble_ long double"
+.LASF714:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1623:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2542:
+	.string	"GPS_scaleLonDown"
+.LASF1894:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2478:
+	.string	"pidCrashRecovery_e"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1619:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2404:
+	.string	"BOX3DDISABLE"
+.LASF1539:
+	.string	"IO_TAG_NONE 0"
+.LASF2221:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1309:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1760:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1310:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2218:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF2243:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF796:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF997:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF783:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1232:
+	.string	"TELEMETRY_FRSKY "
+.LASF2411:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF1589:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF962:
+	.string	"__DECL_SIMD_tanf "
+.LASF1836:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2041:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1523:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1406:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF2602:
+	.string	"bearing"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2312:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2143:
+	.string	"SCHED_OTHER 0"
+.LASF2292:
+	.string	"address"
+.LASF1662:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1148:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2512:
+	.string	"groundSpeed"
+.LASF1774:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1834:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2122:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1720:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1308:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF703:
+	.string	"__DECL_SIMD_cosl "
+.LASF1359:
+	.string	"_SIZE_T_DEFINED "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1551:
+	.string	"IOCFG_IPU 0"
+.LASF2554:
+	.string	"GPS_read"
+.LASF1213:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1271:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1386:
+	.string	"NULL"
+.LASF2430:
+	.string	"GPS_FIX_HOME"
+.LASF2142:
+	.string	"_BITS_SCHED_H 1"
+.LASF1140:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2077:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF2252:
+	.string	"NAV_SET_TAKEOFF_HEADING 1"
+.LASF1942:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2439:
+	.string	"pitch"
+.LASF2358:
+	.string	"levelSensitivity"
+.LASF2314:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2603:
+	.string	"dLat"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1499:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1675:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF468:
+	.string	"__PMT"
+.LASF1382:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1395:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2500:
+	.string	"BEEPER_ARMED"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2199:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2366:
+	.string	"rateAccelLimit"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2345:
+	.string	"pidProfile_s"
+.LASF2481:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2062:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF929:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1261:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1500:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1211:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1192:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2572:
+	.string	"sin_yaw_y"
+.LASF1317:
+	.string	"USE_RESOURCE_MGMT"
+.LASF882:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2416:
+	.string	"armingFlags"
+.LASF1886:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1153:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF931:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1988:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1763:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2289:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1178:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1083:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1458:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1928:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1044:
+	.string	"__DECL_SIMD_log2"
+.LASF1228:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1314:
+	.string	"TELEMETRY_HOTT"
+.LASF1991:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF2463:
+	.string	"nav_mode"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2304:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1892:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1686:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1059:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1696:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"UNIT_TESTED "
+.LASF1457:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2110:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2513:
+	.string	"groundCourse"
+.LASF2196:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1466:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF780:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1374:
+	.string	"_WCHAR_T_ "
+.LASF1652:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"__DECL_SIMD_logf"
+.LASF2103:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2194:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF999:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2535:
+	.string	"derivative"
+.LASF779:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2627:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1971:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1099:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1452:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2049:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1441:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1208:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1352:
+	.string	"_SYS_SIZE_T_H "
+.LASF831:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1170:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1149:
+	.string	"_Mdouble_ _Float128"
+.LASF2462:
+	.string	"GPS_directionToHome"
+.LASF1533:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1628:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2581:
+	.string	"GPS_update_crosstrack"
+.LASF950:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1515:
+	.string	"PG_PID_CONFIG 504"
+.LASF1900:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1714:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2596:
+	.string	"GPS_distance_cm_bearing"
+.LASF897:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2263:
+	.string	"TAN_89_99_DEGREES 5729.57795f"
+.LASF1042:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1981:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF2537:
+	.string	"poshold_ratePID"
+.LASF1229:
+	.string	"BLACKBOX "
+.LASF1224:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2011:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1837:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1723:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2188:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2546:
+	.string	"GPS_WP"
+.LASF2095:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF893:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1749:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF2181:
+	.string	"__clockid_t_defined 1"
+.LASF2560:
+	.string	"areSticksInApModePosition"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2228:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF820:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF725:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2249:
+	.string	"POSHOLD_RATE_IMAX 20"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1388:
+	.string	"__need_NULL"
+.LASF898:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1572:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2195:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1151:
+	.string	"_Mdouble_ _Float32x"
+.LASF1989:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1067:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2504:
+	.string	"BEEPER_ALL"
+.LASF1114:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2484:
+	.string	"BEEPER_SILENCE"
+.LASF787:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1608:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF755:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF886:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1322:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2422:
+	.string	"GPS_HOLD_MODE"
+.LASF2113:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF817:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1818:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1285:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1157:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF974:
+	.string	"__DECL_SIMD_cosf"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2415:
+	.string	"WAS_EVER_ARMED"
+.LASF1750:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"reset"
+.LASF1036:
+	.string	"__DECL_SIMD_atan2"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1459:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2083:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2492:
+	.string	"BEEPER_BAT_LOW"
+.LASF1555:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2587:
+	.string	"GPS_calc_location_error"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2423:
+	.string	"HEADFREE_MODE"
+.LASF788:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2320:
+	.string	"OWNER_SDCARD"
+.LASF2609:
+	.string	"gpsUsePIDs"
+.LASF891:
+	.string	"__DECL_SIMD_log1p "
+.LASF2087:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1661:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2044:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF963:
+	.string	"__DECL_SIMD_tanl "
+.LASF818:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1937:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1187:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2126:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2452:
+	.string	"nav_speed_min"
+.LASF2562:
+	.string	"enableFlightMode"
+.LASF2277:
+	.string	"int16_t"
+.LASF1689:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF917:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1002:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1035:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF951:
+	.string	"__DECL_SIMD_erfc "
+.LASF2268:
+	.string	"signed char"
+.LASF1100:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1435:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF736:
+	.string	"__DECL_SIMD_logf64 "
+.LASF719:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1629:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF2580:
+	.string	"temp"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1349:
+	.string	"__size_t__ "
+.LASF1234:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1173:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1235:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1266:
+	.string	"U_ID_1 1"
+.LASF2248:
+	.string	"POSHOLD_IMAX 20"
+.LASF1070:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1295:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1378:
+	.string	"_WCHAR_T_H "
+.LASF1880:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1467:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1050:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2131:
+	.string	"__time_t_defined 1"
+.LASF1027:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF2362:
+	.string	"itermAcceleratorGain"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF919:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1410:
+	.string	"sq(x) ((x)*(x))"
+.LASF731:
+	.string	"__DECL_SIMD_log "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1017:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF2601:
+	.string	"dist"
+.LASF1843:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1978:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2208:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1001:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1102:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2488:
+	.string	"BEEPER_DISARMING"
+.LASF1357:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1861:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2233:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1298:
+	.string	"USE_DASHBOARD"
+.LASF1238:
+	.string	"TELEMETRY_LTM "
+.LASF2004:
+	.string	"LAT 0"
+.LASF1259:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1204:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1691:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2020:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2187:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2383:
+	.string	"BOXCAMSTAB"
+.LASF2052:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF883:
+	.string	"__DECL_SIMD_log2l "
+.LASF2017:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1360:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1475:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF984:
+	.string	"__DECL_SIMD_log"
+.LASF1256:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1196:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1091:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1330:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2192:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2035:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2482:
+	.string	"SystemCoreClock"
+.LASF1000:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1786:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2597:
+	.string	"currentLat1"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1394:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1331:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1479:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF2611:
+	.string	"GPS_reset_nav"
+.LASF2255:
+	.string	"GPS_X 1"
+.LASF2186:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2374:
+	.string	"magHold"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2132:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1369:
+	.string	"__WCHAR_T__ "
+.LASF1126:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1881:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2235:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1638:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1337:
+	.string	"_ANSI_STDDEF_H "
+.LASF1462:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1534:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1688:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2334:
+	.string	"OWNER_OSD"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1640:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2559:
+	.string	"nav_takeoff_bearing"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1852:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2618:
+	.string	"input"
+.LASF2287:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1183:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1901:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1853:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2564:
+	.string	"sin_approx"
+.LASF859:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2092:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2069:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1518:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2381:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1195:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1603:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1747:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1986:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1112:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1222:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1583:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF728:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1536:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1794:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF887:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1253:
+	.string	"VTX_SMARTAUDIO "
+.LASF1101:
+	.string	"__f32(x) x ##f32"
+.LASF2001:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1438:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2574:
+	.string	"wrap_36000"
+.LASF2469:
+	.string	"PID_POSR"
+.LASF2370:
+	.string	"crash_recovery_angle"
+.LASF2183:
+	.string	"__itimerspec_defined 1"
+.LASF2470:
+	.string	"PID_NAVR"
+.LASF1692:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF2184:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1804:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2355:
+	.string	"vbatPidCompensation"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1732:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1961:
+	.string	"I2CDEV_COUNT 4"
+.LASF744:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1977:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1609:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2105:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1531:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1807:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1004:
+	.string	"__DECL_SIMD_asin"
+.LASF1504:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF888:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1257:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF2518:
+	.string	"long long int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1577:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1045:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2435:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1449:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2538:
+	.string	"navPID_PARAM"
+.LASF1478:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1883:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2275:
+	.string	"long int"
+.LASF2408:
+	.string	"BOXCAMERA2"
+.LASF2409:
+	.string	"BOXCAMERA3"
+.LASF1008:
+	.string	"__DECL_SIMD_hypot"
+.LASF1471:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1709:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1775:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2000:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF884:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF2619:
+	.string	"pid_param"
+.LASF1516:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF2570:
+	.string	"updateGpsWaypointsAndMode"
+.LASF1601:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1954:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1422:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF920:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2242:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2310:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1924:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2372:
+	.string	"crash_recovery"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1694:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2394:
+	.string	"BOXOSD"
+.LASF1983:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF2010:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF2527:
+	.string	"Imax"
+.LASF1239:
+	.string	"TELEMETRY_CRSF "
+.LASF1342:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1529:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1390:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1651:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2080:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2617:
+	.string	"get_D"
+.LASF1670:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"USE_FAKE_FLASH "
+.LASF2621:
+	.string	"get_I"
+.LASF1307:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1716:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF848:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2622:
+	.string	"get_P"
+.LASF2180:
+	.string	"__struct_tm_defined 1"
+.LASF1125:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1351:
+	.string	"_SIZE_T "
+.LASF1789:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1735:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1823:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF851:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2158:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF2063:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1564:
+	.string	"EXPAND_I(x) x"
+.LASF1450:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1783:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2197:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1316:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1131:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2281:
+	.string	"uint32_t"
+.LASF2124:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2511:
+	.string	"GPS_altitude"
+.LASF1355:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF980:
+	.string	"__DECL_SIMD_sincos"
+.LASF1607:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1447:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1898:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"U_ID_0 0"
+.LASF2179:
+	.string	"__clock_t_defined 1"
+.LASF1053:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1049:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1063:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2379:
+	.string	"BOXANTIGRAVITY"
+.LASF1105:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1198:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1798:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1862:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF881:
+	.string	"__DECL_SIMD_log2 "
+.LASF2590:
+	.string	"gps_lat"
+.LASF1389:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1797:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2593:
+	.string	"speed_old"
+.LASF1552:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2018:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF869:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2031:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF900:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2629:
+	.string	"millis"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2386:
+	.string	"BOXGPSHOLD"
+.LASF1106:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1160:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1825:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1418:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1341:
+	.string	"__PTRDIFF_T "
+.LASF939:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1868:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2392:
+	.string	"BOXCALIB"
+.LASF1814:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1108:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF751:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1313:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2170:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1194:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2382:
+	.string	"BOXHEADADJ"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1494:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2219:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1371:
+	.string	"_T_WCHAR_ "
+.LASF2349:
+	.string	"dterm_notch_hz"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1454:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2097:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1262:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF2578:
+	.string	"max_speed"
+.LASF720:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF2125:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2385:
+	.string	"BOXGPSHOME"
+.LASF2353:
+	.string	"pidSumLimitYaw"
+.LASF2311:
+	.string	"OWNER_TIMER"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1495:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1212:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2364:
+	.string	"dtermSetpointWeight"
+.LASF1631:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1832:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"USE_FAKE_MAG "
+.LASF1718:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1891:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF994:
+	.string	"__DECL_SIMD_powf"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1007:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1163:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2102:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF877:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1366:
+	.string	"__size_t "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2178:
+	.string	"TIMER_ABSTIME 1"
+.LASF2367:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1941:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF937:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1094:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2612:
+	.string	"onGpsNewData"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1813:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1548:
+	.string	"IOCFG_AF_PP 0"
+.LASF874:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1643:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF791:
+	.string	"__DECL_SIMD_hypot "
+.LASF1116:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1808:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2615:
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2389:
+	.string	"BOXLEDMAX"
+.LASF2401:
+	.string	"BOXBLACKBOX"
+.LASF1203:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF747:
+	.string	"__DECL_SIMD_expf128 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF706:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF878:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF770:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1635:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2585:
+	.string	"GPS_calc_poshold"
+.LASF1538:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1816:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1762:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2323:
+	.string	"OWNER_FLASH_CS"
+.LASF2295:
+	.string	"pgRegistry_t"
+.LASF1311:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1247:
+	.string	"USE_RX_MSP "
+.LASF1792:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1557:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2445:
+	.string	"NAV_MODE_WP"
+.LASF397:
+	.string	"true 1"
+.LASF1827:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF708:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF972:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1700:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF762:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2071:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF748:
+	.string	"__DECL_SIMD_expf32x "
+.LASF945:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2293:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2023:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2059:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1089:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF757:
+	.string	"__DECL_SIMD_powf128 "
+.LASF2130:
+	.string	"__need_NULL "
+.LASF1383:
+	.string	"__DEFINED_wchar_t "
+.LASF850:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1021:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1210:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2539:
+	.string	"navPID"
+.LASF2068:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF1408:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2346:
+	.string	"dterm_filter_type"
+.LASF2396:
+	.string	"BOXGTUNE"
+.LASF1487:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2464:
+	.string	"PID_ROLL"
+.LASF957:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF786:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2191:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1387:
+	.string	"NULL ((void *)0)"
+.LASF2223:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2421:
+	.string	"GPS_HOME_MODE"
+.LASF2207:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1744:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2177:
+	.string	"CLOCK_TAI 11"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2556:
+	.string	"GPS_degree"
+.LASF1492:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1325:
+	.string	"VTX_SMARTAUDIO"
+.LASF1223:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2315:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1246:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2307:
+	.string	"OWNER_ADC_RSSI"
+.LASF1429:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1043:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2057:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1855:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1754:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2156:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2582:
+	.string	"GPS_calc_nav_rate"
+.LASF1011:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2058:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f "
+.LASF745:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2079:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1987:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2376:
+	.string	"BOXANGLE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1793:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2402:
+	.string	"BOXFAILSAFE"
+.LASF1385:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1581:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1110:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1340:
+	.string	"_T_PTRDIFF "
+.LASF776:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1672:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF968:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2210:
+	.string	"_BITS_SETJMP_H 1"
+.LASF911:
+	.string	"__DECL_SIMD_acosh "
+.LASF2501:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF2168:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1075:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF967:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2343:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2034:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1275:
+	.string	"USE_FAKE_ACC "
+.LASF1530:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF2253:
+	.string	"GPS_FILTERING 1"
+.LASF377:
+	.string	"__linux 1"
+.LASF1172:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1517:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1835:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2486:
+	.string	"BEEPER_RX_LOST"
+.LASF1205:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1781:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2371:
+	.string	"crash_recovery_rate"
+.LASF1175:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1097:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1751:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF868:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF824:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF921:
+	.string	"__DECL_SIMD_erf "
+.LASF1191:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2205:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1745:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"NOOP do {} while (0)"
+.LASF1664:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1930:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2606:
+	.string	"GPS_set_next_wp"
+.LASF1123:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1324:
+	.string	"VTX_CONTROL"
+.LASF2204:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF737:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1058:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2531:
+	.string	"integrator"
+.LASF1952:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF740:
+	.string	"__DECL_SIMD_logf128x "
+.LASF956:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1037:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2561:
+	.string	"disableFlightMode"
+.LASF1469:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2454:
+	.string	"ap_mode"
+.LASF2138:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF983:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1879:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2588:
+	.string	"target_lat"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1764:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2568:
+	.string	"resetNavNow"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f "
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1770:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1687:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1505:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1569:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1445:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1576:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1507:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2605:
+	.string	"check_missed_wp"
+.LASF1669:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2510:
+	.string	"numSat"
+.LASF1202:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF993:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1803:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1225:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1217:
+	.string	"USE_CLI_BATCH "
+.LASF1846:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2283:
+	.string	"double"
+.LASF1622:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2567:
+	.string	"sqrtf"
+.LASF1568:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1935:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1542:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1676:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2185:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2318:
+	.string	"OWNER_I2C_SCL"
+.LASF998:
+	.string	"__DECL_SIMD_acosf"
+.LASF1056:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2340:
+	.string	"OWNER_COMPASS_CS"
+.LASF2002:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1277:
+	.string	"USE_FAKE_GYRO "
+.LASF1757:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2139:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1455:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1375:
+	.string	"_BSD_WCHAR_T_ "
+.LASF809:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2234:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2351:
+	.string	"itermWindupPointPercent"
+.LASF1921:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2614:
+	.string	"speed"
+.LASF1403:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2245:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1190:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1532:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2412:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2273:
+	.string	"__int32_t"
+.LASF1117:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2459:
+	.string	"GPS_home"
+.LASF2319:
+	.string	"OWNER_I2C_SDA"
+.LASF2036:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2393:
+	.string	"BOXGOV"
+.LASF772:
+	.string	"__DECL_SIMD_atanf "
+.LASF1420:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF949:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2091:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1859:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1472:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1424:
+	.string	"Q12 (1 << 12)"
+.LASF2096:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2563:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1062:
+	.string	"__DECL_SIMD_erff"
+.LASF1260:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2104:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1663:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"NAV_SLOW_NAV true"
+.LASF2457:
+	.string	"navigationConfig_Copy"
+.LASF1939:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2624:
+	.string	"navigationInit"
+.LASF1480:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1439:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF989:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1145:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2434:
+	.string	"FIXED_WING"
+.LASF1713:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1528:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1784:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1556:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF899:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF752:
+	.string	"__DECL_SIMD_powf "
+.LASF2033:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1372:
+	.string	"_T_WCHAR "
+.LASF1570:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1365:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1850:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2029:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2447:
+	.string	"navigationConfig_s"
+.LASF2455:
+	.string	"navigationConfig_t"
+.LASF789:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2085:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1336:
+	.string	"_STDDEF_H_ "
+.LASF1588:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1347:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF781:
+	.string	"__DECL_SIMD_asin "
+.LASF1955:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2476:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1956:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF971:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1159:
+	.string	"__MATHCALL"
+.LASF875:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1833:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1477:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1962:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1888:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2471:
+	.string	"PID_LEVEL"
+.LASF2174:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1206:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1773:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2335:
+	.string	"OWNER_RX_BIND"
+.LASF1506:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF928:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1252:
+	.string	"VTX_CONTROL "
+.LASF901:
+	.string	"__DECL_SIMD_atanh "
+.LASF1844:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2338:
+	.string	"OWNER_TRANSPONDER"
+.LASF1473:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2090:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2123:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF813:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1690:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2598:
+	.string	"currentLon1"
+.LASF2429:
+	.string	"flightModeFlags"
+.LASF1636:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1806:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2363:
+	.string	"setpointRelaxRatio"
+.LASF1416:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1343:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1079:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1006:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1068:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2448:
+	.string	"gps_wp_radius"
+.LASF1028:
+	.string	"__DECL_SIMD_sinh"
+.LASF2150:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2405:
+	.string	"BOXFPVANGLEMIX"
+.LASF2151:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF830:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2532:
+	.string	"last_input"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1031:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF726:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2436:
+	.string	"AI_ROLL"
+.LASF777:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1644:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1656:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1181:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2159:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF2517:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1509:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF870:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2536:
+	.string	"posholdPID"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF756:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1995:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1840:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2325:
+	.string	"OWNER_MPU_CS"
+.LASF2285:
+	.string	"pgn_t"
+.LASF1520:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2227:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1081:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2136:
+	.string	"__PDP_ENDIAN 3412"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2014:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1903:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1327:
+	.string	"USE_I2C"
+.LASF778:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2502:
+	.string	"BEEPER_USB"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2496:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1278:
+	.string	"MAG "
+.LASF2487:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2276:
+	.string	"char"
+.LASF2620:
+	.string	"pidFilter"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1109:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1193:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1080:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1292:
+	.string	"USE_UART7 "
+.LASF1565:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2356:
+	.string	"pidAtMinThrottle"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1354:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF2137:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2591:
+	.string	"gps_lng"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2198:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1392:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1144:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF1074:
+	.string	"__DECL_SIMD_erfcf"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1606:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1456:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF924:
+	.string	"__DECL_SIMD_erff16 "
+.LASF977:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1419:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF2507:
+	.string	"gpsLocation_s"
+.LASF2508:
+	.string	"gpsLocation_t"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1578:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF829:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF836:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF2630:
+	.string	"navigationConfig"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1768:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1742:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1756:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1733:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1405:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF940:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2297:
+	.string	"OWNER_FREE"
+.LASF2051:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF811:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1685:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1624:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF2084:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF825:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF799:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2473:
+	.string	"PID_VEL"
+.LASF916:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF716:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2604:
+	.string	"dLon"
+.LASF1992:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1695:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2256:
+	.string	"GPS_Y 0"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF964:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2056:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2558:
+	.string	"nav_bearing"
+.LASF1776:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2100:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1679:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1658:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2298:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1098:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1711:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2237:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF2038:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2599:
+	.string	"destinationLat2"
+.LASF759:
+	.string	"__DECL_SIMD_powf64x "
+.LASF709:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1970:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2067:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1809:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2064:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1430:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2144:
+	.string	"SCHED_FIFO 1"
+.LASF2160:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f"
+.LASF773:
+	.string	"__DECL_SIMD_atanl "
+.LASF1293:
+	.string	"USE_UART8 "
+.LASF2189:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1693:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1584:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1332:
+	.string	"DEFIO_NO_PORTS "
+.LASF1639:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2449:
+	.string	"gps_lpf"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2107:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1344:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF871:
+	.string	"__DECL_SIMD_log10 "
+.LASF2045:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1647:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF927:
+	.string	"__DECL_SIMD_erff128 "
+.LASF810:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2190:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1965:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2369:
+	.string	"crash_time"
+.LASF712:
+	.string	"__DECL_SIMD_sinf "
+.LASF844:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1943:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2155:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF765:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2134:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2246:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1029:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1488:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1626:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF753:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1831:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1543:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1546:
+	.string	"IOCFG_OUT_PP 0"
+.LASF2212:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1715:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2437:
+	.string	"AI_PITCH"
+.LASF1380:
+	.string	"__INT_WCHAR_T_H "
+.LASF1264:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1460:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2321:
+	.string	"OWNER_SDCARD_CS"
+.LASF1147:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2108:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1856:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1432:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1866:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1423:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2442:
+	.string	"attitude"
+.LASF2009:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1154:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1362:
+	.string	"__DEFINED_size_t "
+.LASF1220:
+	.string	"SERIAL_RX "
+.LASF2088:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1602:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1587:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1305:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2203:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2213:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF2008:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1286:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1592:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2111:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1925:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1871:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2215:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2241:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2119:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2410:
+	.string	"BOXDSHOTREVERSE"
+.LASF2610:
+	.string	"pidProfile"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2444:
+	.string	"NAV_MODE_POSHOLD"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1649:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2089:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1184:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1521:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2342:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1822:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1294:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2206:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF793:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF704:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1226:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2007:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF2575:
+	.string	"wrap_18000"
+.LASF2548:
+	.string	"original_target_bearing"
+.LASF2514:
+	.string	"hdop"
+.LASF2441:
+	.string	"attitudeEulerAngles_t"
+.LASF1580:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2337:
+	.string	"OWNER_LED_STRIP"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1287:
+	.string	"USE_UART2 "
+.LASF1251:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1254:
+	.string	"VTX_TRAMP "
+.LASF2468:
+	.string	"PID_POS"
+.LASF2472:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2006:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2474:
+	.string	"PID_ITEM_COUNT"
+.LASF1060:
+	.string	"__DECL_SIMD_erf"
+.LASF861:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1779:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2577:
+	.string	"GPS_calc_desired_speed"
+.LASF2460:
+	.string	"GPS_hold"
+.LASF2232:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2424:
+	.string	"UNUSED_MODE"
+.LASF723:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1777:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2054:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1115:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2523:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2271:
+	.string	"short int"
+.LASF2019:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1491:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2082:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2365:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF803:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2446:
+	.string	"navigationMode_e"
+.LASF1288:
+	.string	"USE_UART3 "
+.LASF1127:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2109:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1502:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2112:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1373:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1513:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2348:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2540:
+	.string	"dTnav"
+.LASF1284:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1038:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1350:
+	.string	"__SIZE_T__ "
+.LASF1442:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2005:
+	.string	"LON 1"
+.LASF992:
+	.string	"__DECL_SIMD_pow"
+.LASF2467:
+	.string	"PID_ALT"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2050:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2324:
+	.string	"OWNER_BARO_CS"
+.LASF2489:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2290:
+	.string	"pgResetFunc"
+.LASF2613:
+	.string	"nav_loopTimer"
+.LASF1511:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1648:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2072:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2266:
+	.string	"unsigned int"
+.LASF2519:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1289:
+	.string	"USE_UART4 "
+.LASF795:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1958:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF960:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1951:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2028:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1582:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2074:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2116:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f "
+.LASF721:
+	.string	"__DECL_SIMD_sincos "
+.LASF1484:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1889:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1671:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2387:
+	.string	"BOXPASSTHRU"
+.LASF988:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1519:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1826:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2303:
+	.string	"OWNER_ADC"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2329:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF987:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2361:
+	.string	"itermThrottleThreshold"
+.LASF2384:
+	.string	"BOXCAMTRIG"
+.LASF1857:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1290:
+	.string	"USE_UART5 "
+.LASF1874:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF2425:
+	.string	"PASSTHRU_MODE"
+.LASF2450:
+	.string	"nav_slew_rate"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1320:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1625:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2306:
+	.string	"OWNER_ADC_EXT"
+.LASF953:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2557:
+	.string	"fraction3"
+.LASF1772:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1510:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1999:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2552:
+	.string	"GPS_filter"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1788:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2326:
+	.string	"OWNER_OSD_CS"
+.LASF2625:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1915:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2479:
+	.string	"pid8_s"
+.LASF2480:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1795:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1189:
+	.string	"M_E 2.7182818284590452354"
+.LASF1698:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1591:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1782:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF947:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1931:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1969:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2706:
+	.string	"rx_pwm.h"
+.LASF2740:
+	.string	"thread-shared-types.h"
+.LASF2688:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2648:
+	.string	"/usr/include"
+.LASF2694:
+	.string	"mathcalls-helper-functions.h"
+.LASF2729:
+	.string	"endianness.h"
+.LASF2690:
+	.string	"floatn-common.h"
+.LASF2673:
+	.string	"stdint.h"
+.LASF2644:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2749:
+	.string	"pthread_stack_min.h"
+.LASF2631:
+	.string	"src/main/build"
+.LASF2645:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2672:
+	.string	"stdbool.h"
+.LASF2705:
+	.string	"flash.h"
+.LASF2653:
+	.string	"time.h"
+.LASF2668:
+	.string	"navigation.c"
+.LASF2677:
+	.string	"wordsize.h"
+.LASF2731:
+	.string	"cpu-set.h"
+.LASF2721:
+	.string	"bus.h"
+.LASF2663:
+	.string	"navigation.h"
+.LASF2641:
+	.string	"src/main/target/SITL"
+.LASF2670:
+	.string	"mathcalls.h"
+.LASF2658:
+	.string	"fc_core.h"
+.LASF2715:
+	.string	"sound_beeper.h"
+.LASF2734:
+	.string	"clockid_t.h"
+.LASF2746:
+	.string	"__sigset_t.h"
+.LASF2709:
+	.string	"io.h"
+.LASF2674:
+	.string	"libc-header-start.h"
+.LASF2735:
+	.string	"timer_t.h"
+.LASF2747:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2695:
+	.string	"platform.h"
+.LASF2649:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2655:
+	.string	"resource.h"
+.LASF2742:
+	.string	"atomic_wide_counter.h"
+.LASF2750:
+	.string	"boardalignment.h"
+.LASF2637:
+	.string	"src/main/flight"
+.LASF2662:
+	.string	"imu.h"
+.LASF2699:
+	.string	"debug.h"
+.LASF2671:
+	.string	"stdc-predef.h"
+.LASF2719:
+	.string	"accgyro.h"
+.LASF2686:
+	.string	"math.h"
+.LASF2700:
+	.string	"gps_conversion.h"
+.LASF2720:
+	.string	"exti.h"
+.LASF2675:
+	.string	"features.h"
+.LASF2643:
+	.string	"src/main"
+.LASF2638:
+	.string	"src/main/io"
+.LASF2687:
+	.string	"math-vector.h"
+.LASF2745:
+	.string	"setjmp.h"
+.LASF2733:
+	.string	"struct_tm.h"
+.LASF2736:
+	.string	"struct_itimerspec.h"
+.LASF2676:
+	.string	"features-time64.h"
+.LASF2634:
+	.string	"src/main/drivers/accgyro"
+.LASF2665:
+	.string	"beeper.h"
+.LASF2744:
+	.string	"struct_rwlock.h"
+.LASF2660:
+	.string	"runtime_config.h"
+.LASF2657:
+	.string	"config.h"
+.LASF2692:
+	.string	"fp-logb.h"
+.LASF2684:
+	.string	"time64.h"
+.LASF2664:
+	.string	"target.h"
+.LASF0:
+	.string	"./src/main/flight/navigation.c"
+.LASF2710:
+	.string	"io_def.h"
+.LASF2696:
+	.string	"common_fc_pre.h"
+.LASF2669:
+	.string	"maths.h"
+.LASF2702:
+	.string	"parameter_group_ids.h"
+.LASF2685:
+	.string	"wchar.h"
+.LASF2678:
+	.string	"timesize.h"
+.LASF2632:
+	.string	"src/main/common"
+.LASF2717:
+	.string	"rx.h"
+.LASF2647:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2714:
+	.string	"rcc_types.h"
+.LASF2666:
+	.string	"gps.h"
+.LASF2726:
+	.string	"time_t.h"
+.LASF2718:
+	.string	"acceleration.h"
+.LASF2697:
+	.string	"stddef.h"
+.LASF2693:
+	.string	"fp-fast.h"
+.LASF2636:
+	.string	"src/main/fc"
+.LASF2689:
+	.string	"floatn.h"
+.LASF2713:
+	.string	"bus_i2c.h"
+.LASF2682:
+	.string	"stubs-64.h"
+.LASF2681:
+	.string	"stubs.h"
+.LASF2654:
+	.string	"parameter_group.h"
+.LASF2656:
+	.string	"pid.h"
+.LASF2712:
+	.string	"io_def_generated.h"
+.LASF2730:
+	.string	"struct_sched_param.h"
+.LASF2667:
+	.string	"sensors.h"
+.LASF2716:
+	.string	"vcd.h"
+.LASF2723:
+	.string	"accgyro_mpu.h"
+.LASF2659:
+	.string	"rc_modes.h"
+.LASF2652:
+	.string	"stdint-uintn.h"
+.LASF2728:
+	.string	"endian.h"
+.LASF2748:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2732:
+	.string	"clock_t.h"
+.LASF2703:
+	.string	"adc.h"
+.LASF2680:
+	.string	"long-double.h"
+.LASF2739:
+	.string	"pthreadtypes.h"
+.LASF2679:
+	.string	"cdefs.h"
+.LASF2691:
+	.string	"flt-eval-method.h"
+.LASF2639:
+	.string	"src/main/rx"
+.LASF2683:
+	.string	"typesizes.h"
+.LASF2722:
+	.string	"sensor.h"
+.LASF2698:
+	.string	"common_fc_post.h"
+.LASF2737:
+	.string	"locale_t.h"
+.LASF2642:
+	.string	"src/main/target"
+.LASF2724:
+	.string	"pthread.h"
+.LASF2661:
+	.string	"axis.h"
+.LASF2635:
+	.string	"src/main/drivers"
+.LASF2738:
+	.string	"__locale_t.h"
+.LASF2708:
+	.string	"serial.h"
+.LASF2711:
+	.string	"utils.h"
+.LASF2701:
+	.string	"build_config.h"
+.LASF2727:
+	.string	"struct_timespec.h"
+.LASF2640:
+	.string	"src/main/sensors"
+.LASF2651:
+	.string	"stdint-intn.h"
+.LASF2633:
+	.string	"src/main/config"
+.LASF2650:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2743:
+	.string	"struct_mutex.h"
+.LASF2707:
+	.string	"sdcard.h"
+.LASF2741:
+	.string	"pthreadtypes-arch.h"
+.LASF2704:
+	.string	"io_types.h"
+.LASF2725:
+	.string	"sched.h"
+.LASF2646:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`2\004\255\021"
+	.string	"\204\023&\005"
+	.string	">"
+	.string	"\326\243\245\315\t$\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\002\002\004\005\002\006\001\352\263\360\321\b\002\240\342\234\212\n\004\331\351\335\210\001\005\315\343\301\244\013\006\007\b\347\322\305\356\004&\007\001\002\007\002\b\002\b\001"
+	.string	"\002\t\001\002\n\t\n\013\f\r\016\017\020\021\377\331\231\340\001\020\002\013\f\002\f\022\232\324\315\325\t\016\002\r\002\r\002\005\002\005\002\023\024\025\026\027\030\326\242\354\235\006,\001\002\016\002\016\002\016\031\032\266\242\362\262\016\f\017\002\017\002\002\002\033\034\035\036\202\343\307Y\022\020\002\020"
+	.string	"\002"
+	.string	" \"\262\342\212\331\002b\004\002\017\002\021\002\002\022\004\002\023\002\023\003\017\002\t\005\002\005#$%&'()*+-.0\243\334\230\230\002\0061\257\206\360\260\002\n"
+	.string	"\002\003"
+	.string	"\002"
+	.string	"3\305\273\237\352\r\0044\346\371\363\252\016\0305678\212\367\201\200\n&\002"
+	.string	"\002\024\001\002\0079\367\212\311\265\t\002\002\025\002\025;\304\345\306\253\017$\005\002\005<\270\325\330\372\r\036=\202\242\261\253\016&\t\026>?@\376\316\231\304\004A\314\241\341\303\rBCD\240\342\234\212\n"
+	.string	"\200\212\250\321E\251\021)I\n\033c\200\202\261\251!\017\022\240\023\033\246B3\246\240E\251\327\264ga\212\256\316I\375\270\016\r\203\343w\031\322\271Q|\206)\355\257\n\325K\245v\365\202\373\253\205\214@\200\361\027\200\214\325\301\331\342\342t\327\275\204t\344{\002\257\227\266\213\265\307Jq\334B\355\314\243{\273\006\030 \227<\227+\246,1\342\b\361\337-\263yN?\030;wT\370@\026\350Tf|\371q\022\362n\237\3529\366\257\331\221\367\361\235\313q7\234\026\017\225\275\363\267ggL\362\225K6\026\300\301FB/\367-\271\357\231\344\344\277\367\3137\001\334\233o\356@\024\303\3508\026H\241\354\207\264\004\200-\330\265q"
+	.ascii	"i\306\241\364\275/\304\332D4'\321\307\215\025&C\214\207\310\203"
+	.ascii	"\351\361\237\304u\257\365\221\2570b<.\244~\241\274\357\2355\317"
+	.ascii	"\367\006~4\210S\025\343P"
+	.text
+	.section	.gnu.lto_.ipa_sra.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"}\004"
+	.string	"\342F\024\032\200M\032\003,\332\031\230\201\245\024\2457\236\217\266\307\217ds/\354[:\231RJ\231\274\237zj\222\310\007\2457\024\030\225\b\203\027h\313\320\220}8\266\301X(v\023\373\322e\324u\2614\267z*\246\327\230\r\270\364\031\260\203}\324\242U9\"\032"
+	.ascii	"\033\303!/P0r\006\033&\261;\223F\355\t!\202!`\034\030\f\f\001"
+	.ascii	"\343\300\260*\361A\fJ\234J\340\034\031T\021(qc\006\243\\\310"
+	.ascii	"\250u \020\200\313`\032\030\002"
+	.text
+	.section	.gnu.lto_.inline.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`|\004=\023"
+	.string	"v\231\\E\360\262h\030\003\310\334\324\210\377:HL\243Va\337\366\326\232\251$8Z\323g[\f"
+	.string	"\356\316;\345;\0348\244\3413\370\265$]\027\236\021\232\220\224s\300\216\335\224Ut\005\230\323\320\317R\324\206\374-\245L\001E"
+	.string	"F"
+	.string	"R"
+	.string	"\247\266v\252\240\306\310\344x\t\360&%\001kq1\001\241\376\272\201\304\324\326NK\314\200\265,\230\204Eeb\262\031\246X4EL6\033\347-\317R\356\356~\376\244\251]\017C\276\236\264f\327c\360$\207t\bs"
+	.string	"\376\025P>\236\224\333\020\210\240v)7D\217\211\034\021c\001\004S\372\037H\034u\304X<\206\035\362\362u\343\304\227\201\265+Z\240\\2\351\003\351\244o\322\227\277"
+	.ascii	"mtI[$:9\356\004\275\262\275m\0013\273\333\340\t\235\266P\253"
+	.ascii	"\034\t\235\326@\255rNF\331\261\273\003T\310^\300\214\034\341"
+	.ascii	"C\276bX6\036$\214\007\303\306d\b\371\322Q\3710\245\313\246fF"
+	.ascii	"\344\321H\202\370<\007]\361\374p\341,ip\364\340A\227\025\230"
+	.ascii	"\022\264v\227\300'8~>?\246\327\363\242C\243B#\206\f\326\256/"
+	.ascii	"\244\013\325\316\r\212\310\203\250vn\306\331\202n#\255sp\205"
+	.ascii	"\r\251-\nZ\346\236\270\270))\"\021\307m[kwCN\315T\240dD\221\372"
+	.ascii	"P\270\036\016i\320C\211ok\227\001w\250\021I\306\310\310\020-"
+	.ascii	"(H\322\034\200\002\241\241*z\021\260,\206\224\204\206F\333\326"
+	.ascii	"\r\220\270\t\033Mv\2408u\271a\326\251\243\002\243\352\n\364\372"
+	.ascii	"O\367\322K\034\231I\233<,TR\206k\372\211\027\241;\nPL\004\214"
+	.ascii	"\023\362\347\017.\005\005\357\315b\004?\300V\031\235\344'U>\344"
+	.ascii	"`\274\205\f\270\207l\004\3236\325>Oia&\023\004d\017\271\372\267"
+	.ascii	"%{\205:\324\334\2355\213\335b\272*\376\007V\006\344\353u=\374"
+	.ascii	"\f\214\221\023\372-\3171\"\340\027\307A\266\232\304%\bPw\306"
+	.ascii	"\023'.\300\303\226\247\371\206\365u\326\360\331k\254P\332ErN"
+	.ascii	"\177\225\343\274\204i4<\213\277\220D\fi\003\013f\301F\245%\334"
+	.ascii	"\376\225<\033\344\352\354\247\226\214\0359h\026f\243\324e~\207"
+	.ascii	"C\262\266\202.\346qO*\345\"\022h\330(\3205\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\377\002\r\n"
+	.ascii	"\322\213)1`M\222\016p\022\0041\376\344\024\266M\202\372 \b\202"
+	.ascii	"8.\364\200\001\202\005H`*?\325\256/v\0026u\201\2055\332Zm=\024"
+	.ascii	"\261\204l\231\002\177\233\3254\220I\337kn8\304\f&\323Z\322\347"
+	.ascii	"ir@\220$5;\034NH\220\214\004\264\030\361\211C\f\340\254\255\374"
+	.ascii	"\303\357\320\3603\314\256\253\023\262\004lYid%\0222\035,\254"
+	.ascii	"@a\271\302\n\322~\264\242U\366\342\332\213\303\216\301f\335f"
+	.ascii	"\365\267\250\207e\352/02\246Ja\316\033\\\200\311Z\002\001l\017"
+	.ascii	"\323\301|8\302U\027=\300\037\315N\002B\250aaU\"1he\331\016\220"
+	.ascii	"\002\031\242\262\016\022\300QI\240\3438\316H\347\224\n\252\302"
+	.ascii	"2\313\263n9\230\376m\356\177\1771\201\327\351\376?\031\275\363"
+	.ascii	"\026\235\005\351\312pXjW\353\254\f\326%G'\023o\265\364\034\221"
+	.ascii	"\264\212Wf%b\211\357 W\377\264\327\365\332\027\336q\356y\331"
+	.ascii	"\307r\252\031\262\353\265p\026F+ \300\310\237\3715>j\333\365"
+	.ascii	"\276y\027\336~A\263\273\211\370\332>\265C\360\354\301\310\374"
+	.ascii	"\344N%\007\003\216\316\276\3445\036\304I|\276lO3"
+	.text
+	.section	.gnu.lto_.pureconst.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\b\232\004\021\232\004\022\230\004\030\232\004\032\230"
+	.ascii	"\004\036\230\004\"\231\0040\230\0041\230\0043\230\0044\232\004"
+	.ascii	"8\231\0049\230\004;\231\004<\230\004=\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`U\001\035\b"
+	.string	"\002\314 &\220)\031\016\3770\377_uwwww\267\2116TU\033i-k?\211Q\007\024#\325\002\216B|#\262eJ\001\252\316\3302<\332F\022.\264\205\226\"\230Co\330\2465\be\330\017\272\017b\205+\200H\341>[;h\244B\372\250+[\305 )Po^\314%p"
+	.string	"\037\273\330<\271,\372\016\223MU\r\325Xk-5\240\013IW`\346\316\326\2317\333\2049\263E\230'\333\203)$\300M\0047 `\002\031\252\343\003\333\313\226\001J\023p+X\032\t\341\032c\016\367c\211&\201\3137;\205O/QV]_h\370Gx1\206\207aR\264\216\017\017eu\253\034\t\b\bB\310\3035\031\274\nz\206lu@Dpt\213Q\216@\265\004\310\267\373\350\315\215K\344-\333\270Z\334\301\036\360"
+	.ascii	"\374\\\\\334\3128\242\357[\325\003\312\371\261\324R\206e\213"
+	.ascii	"\211\240\251\267\357\257-\254\335!"
+	.text
+	.section	.gnu.lto_.lto.cf9e7ccbb683cb92,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_navigationConfig_Registry.66.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\004\b`"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\230\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\f\"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/flight/navigation.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_navigationConfig.68.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 U-\002"
+	.string	"$\003H"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001(\254\002\344\035\001\001\036\024\310\001?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.string	"<E\300\335\224\236\233\353\252\bN\271e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_GPS_angle.69.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_navigationInit.77.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\375\006"
+	.string	"\222M14`O\322\001p \320\016\2143\242\341?"
+	.string	"\320\034\353\216\347\220[W\252q4\002\273\207(B\267Cw\253\277\t\b\016L\202k\227\351\032:Z\370\023B\244L)\336h,\370\260\212\363 *\313a\n\234\267\220\340\254W1\270\315\345\3404\002\206\r\b\227\303 \274\\f\333K\253\240\003\026\221G)L\345\325~\210\310G\017T\250f\037\344!\023\276\207%:\371\370\311\357P\237\256\230\fO\216\234$*(\233.\366\246\245j\330\227VA\366\323\227\250\225\223\200\222\335\213\321\313\212&\223\220\355g\234\331)\337:\366\"!\213\221\226\335u\312\361\354\231\371\3778&~\264'\200\301\356:\343\007\343\326\333&\260]`{#\b"
+	.ascii	"3\241U\037(\374\341\036\327D\272\020\362\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_actual_speed.89.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.108.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\335\013"
+	.string	"F\025OC \251*\035@\233\253IH\372\306\320\001\006\270k\370\322C\313Q\f9V^j\220\0243'+\013(\337\337\232\310\221\354*\262\320DBU"
+	.string	"\214\030$\200:p\362P\2659 \237\2214c#\204\220-S\n;"
+	.string	"9"
+	.string	";"
+	.string	"(\003\023j\255!E9y\257\243K\372?\277P\232\244{\f\246\352]Eu\332Q\334f\022\034\314S\007\221\002P\376\374\222\230\246]\320\242\326\352-M\223\373\273\355\f\333\025\3661\002\037}\367N#\032\254J\233\363\322Nlu)\3300\322\322\226\375\256R\226\3755\370\365+\017\262\005\027\020jM\345*\324\232G\013`\373\366\007\220\266\305\244\375\3400W}\202\222\343wO\302\025\241\201v\256\202\221\224\200\016\\;\364\261/M)\351.\334MF}\371@\372\363\025[\314\301iq\376/\337)H\275\250\225is\366_'\020\342\247Xd\264/\3579\326`>\243(\312pD\220\314'\024qp\304\216\215\360#f<\241\006\024\n1\023\036=6\240P4\216\240\320\002\253\357*eYcV+Q\223G[\233\317?p\004\033\216(2x\275\363\371\261\027\350x\306\031"
+	.ascii	"3\241\251(\206\346C\351\332\216\202i\016\026\002g`ISwI\006\017"
+	.ascii	"X\214\2074`\243\007\003\240\025@\311\207\253.\354\224?\330\343"
+	.ascii	"\232\2107\004=.s\314&[\304\2431\250="
+	.text
+	.section	.gnu.lto_onGpsNewData.109.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\007\003\325\024"
+	.string	"\026\344\177H\320\360(\035\n\022\277A\374\212\201m\0313V\363\317\216\225\222\346\346\310\343\037G$\200j\ni\360\026\243\r\231\320\377\327\025\267\373\337\335\363\367\210\2650\204\017\221\025\203\230\373\244j\260\032_\360\022\370\006>6\262\t\2212\245m"
+	.string	"a"
+	.string	"k"
+	.string	"A1{t\314\236\361\335\207y\"\237\232P\323\234\263\265\036b\032\373\250\352H\2112\004Wc\276\352&\373\2509W\215p\250\301y\207N\203\246\200hnT\364\321\340\034w\245p\253\251\314\360\220u\223"
+	.ascii	"\016\230s\216\267\b\n\316,H\242sd\303\272\321@\220\027\035b\034"
+	.ascii	"\367\021 \232\034U\321d\316i\265\335jn\217\333\036\262]\300^"
+	.ascii	"1\273\223\200\371?\206\211\321\333b\344\303o\210\322\315L\177"
+	.ascii	"\016p"
+	.string	"\344;\356\b0\354\234\230\246B\331;\232.\217\375\255%E\351xwlU\177\250\232\245\352\225\252EUKU\207\252\006U\275\252>\200\347B4\3218\2004\247\205_\324L\n{ l\337\317]'\363 \257\r\322\210\207~N\306\036\037\336\017=P2\\\025\2671=\307a\362\033\256\312\360\350\335p\213\036\"\023\341\362\360\376\361\213Hp?P0\210\001\265g\303w\237\025\027&\200\313c\3600\271\233\302sa\257|\b\226\232s\032\360\205~\342\345\377<\364\003\027\027\371p\267DI7\323\337u6dTa-\"W{\334S>\236\322\214>Y/\"\277\253\265\326nh\372\263\037F)ay\271^NT\\\020NXZ/\013T\\\rRZ,\256\223\225\026J\213K\253D\200_\016\024\264\264^^\257\226\326\270\233}wtij\233\004l\"S\034\033F\243\230\320V\246Z\251\257Sq\351m\336\225\201\370"
+	.ascii	"\211\350`\355uK%.\227u\335UFH\276\251P\trEN5<z8HX\300\360\245"
+	.ascii	"\324\307[\232\321\247\213b\212\313\025\213`\344\206\004C\250"
+	.ascii	"A8&\0314C$\022F\222\222B:\240\002\241\031\273\r\020@\247ff\332"
+	.ascii	"\034#0\004\357\266\357\331\344!O\376\246\360$\t\b\304%\271\037"
+	.ascii	"\204\345\362\n\035a\214\242\336\352ft\225\017\202fW\2465\266"
+	.ascii	"v\377 \3622a\226\f\340\r\005S\250\022\001\035\247\307m\201Zu"
+	.ascii	"\022m\270\027\335!\210Q\257\2355\323L(\251\220\252?8Z]\243\370"
+	.ascii	"\367\320\247\233\350cJ\215\240\367\265\362\315g\233B\2630&\324"
+	.ascii	"\205z\\O1\351\331C(S\032\246?M\\#\213P\003"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.110.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\265\013"
+	.string	"6\026P@ Q\224\016s,a\fH^4\223:\205\"\266\267\017\224K\304\"B\027\036\024\017&s\256\256\215\3042\345\366oU\213\331C\331+\206\016A\200\215(B\223{\315\263-Q\007\263\375M\266\224)\005?"
+	.string	":"
+	.string	";"
+	.string	",L\"b\354\356\245\032\256\275\202\232\232?\301"
+	.string	"\350<\322+J\206Cx\300\005\211\027\002N\034:\313+\245\006\360,@\003\273{\220\347\005\217\313\234`v\327\331y\030\356x\333\013l[\354'\b\376(\276\272\016(\331\330\362s\236HA\2629\303Fq\251\035\366\341*\207\375t|\032>\375\t\201\032*\030\300\330=}4v\244*\321\301\366\355\177\320l\313\232\335\342(\217\375\210v\366\020\"\312\356\"\360A<5\301\377x\345O(\024-%\"[~\317\335%\251+1\352AN!I\255(\245\f\347+\361\032\325i\332\340\362\263\037r\021\221\377\341\n\243|\367*\326\\:\031\006\312l0\n\231\316\005z\260\301\"8\270:X\206si<\237\353R\300\231\204\006\236\013\224e\236\313BmW\016\005\337\310\246\\e\245\r\201\223\357\254J\262\211\020\017\036P;\f/\212PsC\nE\024"
+	.ascii	"3\003\3369\003\353-\243\331\013h\373)\223\343D\240\244\b\243"
+	.ascii	"\212lGc\033\254\272\260S\006\306\036\327D\246!\350\3402\001\003"
+	.ascii	"V5\262f\310\355*z"
+	.text
+	.section	.gnu.lto_GPS_reset_nav.111.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\207\006\365\035"
+	.string	"\246\357\254F\200\236Qcc\037G\307u\332"
+	.string	"\026m\t:@\246\367I\203GQ\f\253\b\200/\253\374\215\245\n\2177t\030\341\257\252:\037i'\003\3150\335'\207\032\263E\312\324\364\\j\007\n\360\346\334\027\024m\333[\312\224\002\217"
+	.string	"\221"
+	.string	"\247"
+	.string	"Tz=\304\013\265\002\211\327\325\362^\242\203\243\326P;jb\355Q\232l\333Q\373\241m\2679A\277:\024\337\205>\326\234p\324\262\216\320H\336{\177\216\032\250v\364v\236\331\321\363\003fG\355\263\331\234Huo\004\306\300Z\336{q\226\210\353O\342}V\337\321\323V\237_\305\212\300\240\323\321\223\247\210\222\252"
+	.ascii	"\301\027'\203\243\261\353\303\327\247\340\257\236U:n?<\003\244"
+	.ascii	"\034`P\307+M\350\336\353\n"
+	.string	"\fB\335\263\333\346\331\346`\317\244\004K3\333-\216e\211\207\352\336[\301\357\272\027\n\337\310Q\253`Q\017d1;j\200J\231\3262\357|\001\261\365hd\214i\375\363\013oa*\255M\373\370\250_<\302nm\332\304_\265C\354\277\210\226\0342l\205\330\264\013\357\013\360\361\"#b\314\2757\312\346\\04\013\222\013\177\373F.\033uE\313\212\2152.7\030\201\311\027m\233\233N\364\263l\224\321\311\275\327v\324\266\357TzB?\031\367\344B\376\034U@\026T\353\261|)\237\322\364NCO\252$a&\3235E\257Cg\016\221\321\311\230K\242\233\371\265\234{\0348J-+l\376*n\332\350:X\215%\211|\232`\375\303\327\316h\231b&\323\242\217-\325\210!\240Z\322)\332\350\310\243\236\035\3124h\352V\263\313v]\360\242s/\343\256\236\035\311\ta`'\323\233\035-\200\\\276x"
+	.string	"[\314\260\254\327\224c\246\230o\256\227\037\353\267\224x1\275\035$0\214\016\203\025R\352\352\313\301 \355F\214(\341^m\nj\201py\025tKk\323;_L\272,\005\340\302#\260\344Y~\334r\242\352\001 v&\254!L\240\020\342\301\207\n\022\200\n\354\356\034P\022o\307t\204\264Kq\224\204c\022\201\264#\021\002\227\264;*\201\313)-\341\200\022\230gB\247\204c\342\361\224p6bz+\304\036\260\200\245\366\207\332!\246\365\2604k\265\352\317o\237|\037g\267\031\304\\T2\177\370\223K\220k\241\2646\177\336{\357I\263\027\376\326\340\2674{\030R\277Z\346\003_?\266\274\212\352\r\033\272\bJ)\037\265\306\220Q}\002\326\031CF\347j\f\030\365\305\220\221\253\354\337\252\277\232\352.X)k\200\216\250\301T\305\220\020\005#RP\230\024\322\001\360\002\221\241Z\035\022"
+	.string	"\025)P1f%\242@\031M\241\2601\007\237Sr\t{lD*\021\225\372A\313\356!\254\327\353\277M&\222\242\024\253\252/A\027+=\220\223\262\224e(\t\237^\bP$\031\312\330y\023\231\221\234U.\036\033_^I\262\315\212>b\240\314\327z\242P\337kT"
+	.ascii	"C\263\024e\347\216\026\221W\355\342\303HT\355Q\204\350\270\257"
+	.ascii	"H;\262e\376\366LT\343\301\347L\006\225\371\322\202\261G\202\227"
+	.ascii	"\356\"\316g>0{\365w\317\2620\323\315\375%M\342\202\262B\200\205"
+	.ascii	"\223\335\370\246&\246\267\007\355m\006\374P\366\211\236\030\020"
+	.ascii	"H\370\016\2221\372Gi\325\r\217Q8\251\254'\316\363R\"u\351\261"
+	.ascii	"\213\316j\372e8\234\241\241'{\215\032\367G\276\236\232b[aj8\234"
+	.ascii	"\021\336\272\020!\200\260#bu^\210\246\"=)\271\374\277:\235\313"
+	.ascii	"Q\003"
+	.text
+	.section	.gnu.lto_gpsUsePIDs.112.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`q\006-\032"
+	.string	"6\253\232L\240\022V:\372\030\204\326\376\023\323w\333\371\031\373T}\321\210\263\023\264\200z\364\023\304\240p\366\001\304h\267\347g\233\323a\334A!\256\352'\314|R^\333\240\327\341X\017\013\201]\227\302\225\201\307\331\266\266\373\021mk$H\312\235\002x"
+	.string	"y"
+	.string	"\220"
+	.string	"|\032\363g\315\2275?\306|X\363\325\346\247\314\1775\277\233\317\314\267\005\002\210x\262 u\257P\264\353:\245J+\376[\332?\240I\201\345\337\272\260/\210\026\311ck\367\022\031\331\2707i\340\274\230M\237\2648\325\2461kSmz\342\017\265\311\343\265I)\202\226Z\367\336^\243\260D\313\304[kde\306\241\036\3130\006\367\336\263q\350\203}\333\377*\377\035\374\352U\367\013\242\321 ?\367\372\250pw\303\252\200X\0249z\333\334\355\004\372\361\337\330\345\372r\204a\225B\226\347\275\327\305\246\277\216\215q!v\357m9j\220\201wTa\323[\036\325\246/\373%\325\246\266_\212\220>\034=35\241.s\375\311\036\356\023\277}\335&\372-\322Z"
+	.ascii	"\315\3375_\307\374\\\363q\315\2771\337\326|\224\346\327\230\177"
+	.ascii	"\322|\223\346\2270\237\244\371#\035\004\216ZCL\372\207`}@\213"
+	.ascii	"\033H8AK\332\204\244Kb,U\217)\222\254\021\251(Z\217\364\3169"
+	.ascii	"kZ\277\226<\240\236fm\225X\262\2463S\216;\"4\026RT\213\022[\261"
+	.ascii	"\226\365\316\t\353X\277\226\315\325*sX&\241\357\250\203\345\231"
+	.ascii	"\302\332*\213\220W[\367\336\334/\301.\341Hyj5\251\375\377\254"
+	.ascii	"\322\215\264\325W\247@[#\t\351\345\354\376e,\2153sO+\303\316"
+	.ascii	"\240y\260\206\255\261F\265i'\031\255\230\326\004\325Q2G\320\342"
+	.ascii	"\23390\301%\001/'c\023\234Y\207\017(\004sf\007\362p\326\340\316"
+	.ascii	"\217&\210\341\207\323\333\251@\023\264\231\351\341\004\1777="
+	.ascii	"\340P\247\307\023\3605Gf\330\333Y\327a\217\226\274v\204\223O"
+	.ascii	"\027Y\210=\300\350\236\315\020;\356\300\001\252\353]\256u1\254"
+	.ascii	"\201\203\030(\327\004\201\343\037.\336\032g\353\033\220oT\310"
+	.ascii	"+\262bk\337Ts\b\245\353\314\333\223\013\206\253j\215\322\260"
+	.ascii	"\245\223\2565\023\321Z}O,\233%\344=\205\254\034\325\223\366M"
+	.ascii	"E\255\200\004\200\200\250qT\t\025\331,)\217\202\244\0030\003"
+	.ascii	"\021\221\310\r\021\220(\251\020b\310l\302r\013R.\007\310\354"
+	.ascii	"\022\301\330\036\006\206z@06eg3\021B\241$\030\314\257\205\206"
+	.ascii	"!N\234\200cR):\032\t\205\360\300\203\366\031\247\330\003\223"
+	.ascii	"\204g\314_x\361G\325*^\004\217\022\240!L\365dqPc4t\033\337\024"
+	.ascii	"\3539\334\252\\\220\234!\020nbh\216\230p\222\372!\342G\n\223"
+	.ascii	"\202\013#\232\314\305z\221\352\217\316\317\272-\206\365\332%"
+	.ascii	"\246\320*\374\035\004N\021\344\006\332\354\027\234i\324\314;"
+	.ascii	"\325\220\266\363\244\245\227\332kl\232T\234\342\336\"\346\323"
+	.ascii	"\301\257\241S\315.\227\323Gl\2024\332\211\240\366\303\007\361"
+	.ascii	"P\302\202\272\214\366j\204\352{\370\203G\272\320\030\025"
+	.text
+	.section	.gnu.lto_GPS_set_next_wp.114.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`}\b\035+"
+	.string	"\232G\300\017C`^N:\343\201by%\21581\034\317m\034N\255Ac\004[<PN\270q\350,l\315\f\177RI\177\276\360%\220\312\0067\317Sr\304\374@\276B\2716\260Uj\016\345\273w\005\215&M\312$\003\350"
+	.string	"\324"
+	.string	"\356"
+	.ascii	"iqo\250\304\275\231\"\243\005\327f\t\\\233\250/\027ok\202\274"
+	.ascii	"\2559\266\215\232T\242\240\216\211\323\255\355\210\341\313F\375"
+	.ascii	"\245\351\023\347\340\346S*u\276[\327\333\216M\313\332\203\211"
+	.ascii	"Lz\007FP\255\313\020'[\327\256\321\327\366h\326h\2213~\266?3"
+	.ascii	"\242L\227Z\253\021\362f\350\257\252m`\343\013~\221j\276\232\031"
+	.ascii	"z\036\247\\\016=P7\367ff\030\335\f\232\221\332}\332\236\314\313"
+	.ascii	"\3148\332\272\235^<\226\224x{\362j\255\016n.\325\217\215v\203"
+	.ascii	"L\226r:\2347\203B\244\316\273\007\3630\310\233\035\177Tk\023"
+	.ascii	"1jj]Bm\324ys\227W\002\336<\217\004\274\271\310]>_\222\325\263"
+	.ascii	"\361\325@\023Tk\0256\224#\317\310\375\307\034@*\346u&\302Pk]"
+	.ascii	"N\305z|\373\273\273`w\273v\3177\001y?j\335\013}}i`\265&\027\034"
+	.ascii	"h\247\276\034%\226/\356[\003}\240\201w\224\202\272\r4\343)\363"
+	.ascii	"\216\346Esp\316\374:\346\340\352t_\355\301$\363u\237N\214\241"
+	.ascii	"n\247\316\0136\364\336\335\007\257C\003\334\325Z)\354\351>\307"
+	.ascii	"j_vsa`\361S,C\251\336>N\021=\313\366G\340\3157\263\205\215%\271"
+	.ascii	"oy\216\317\2562\337\356\362\213\333\311\356\177\265\233\354\236"
+	.ascii	"\274\b\276\366u:y\017\234\274\006L\336\002&o\223\311\313d\362"
+	.ascii	".\235\274J'o\322\311\213d\362\0220y\217L\336\001_\376E7\373O"
+	.ascii	"\"^ \220\3274y\177&o\233\274l\362^\301\323\021:Yxj\335\321W\250"
+	.ascii	"\326\231oU\276\366\357~\317v\271.5gs7\2073\"G\375\333\013\033"
+	.ascii	"c#|\004\306\200n\264\2601\271\237\314n\216]\205\363\353H\003"
+	.ascii	"\242f\320\237Z\344\003\217\241osG\244\352mwC\342\2020\020\364"
+	.ascii	"e\370G\225\005\366\001'\006\305<\320\b;\336\036\374\031\347`"
+	.ascii	"\034(\003\016s{0IG\344\32774\034\271\006\272/\373uR\236!OA\354"
+	.ascii	"*\377\214i\034\037\207\301P\016G~\312I\252\223+{u\360@\305O\251"
+	.ascii	"\200\207\f\241\207+Dh\020z3d7\005\005\372\360=\264\302\035\240"
+	.ascii	"\252\251\273??\273\237#\337\325\232|\272\013\342y\350\203\025"
+	.ascii	"\361>U\f\310j\255Sx\3473\202D\211\022@\023(\370\351\376*\221"
+	.ascii	"\366\332\247\036v\365j\377\230\027\321\211\325!\350}\236\353"
+	.ascii	"Y\267}\331\016\267m\333\366R=\001\354\324\3735\026D~\212\240"
+	.ascii	"c$\001k\257\345\2719;\247\376\332\203I\267\367\t\304\342\025"
+	.ascii	"\n.-\"\021\227\026\221\210X4\016\257P\030Y\020\267\206\306\""
+	.ascii	"\256\025\303\255_1\353\252\027\302\324\204\026R)(H\210Z2\016"
+	.ascii	"\257zUD\025\263\254\214C\242\225\214aQhtA\264\272j!,Z\r\261\204"
+	.ascii	"*\266\270\204Q\t6K\213\305\226\320\230\225\265%4Z&\377\253\335"
+	.ascii	"\344\004\222\272d\177-\260\227\265\360\026d\225+\310,Y\2007\033"
+	.ascii	"-\3253\033\330\257q(\311}Z8\013\222"
+	.string	"\313Y+\330\324\362\025\306\202\364\202\374\202\f\303O\221a\2007\315\216\212bf\244\nRL\343\245zOcqp\017&\337\334\252\374,\007\345\025\350\313M)\333K\365\232\232\251\013tKi\352\336\013\033#cjn`\347g\251/\367\004\r\340\304*\003\226R/\365\367\224tI\215\324J}%\226\257<\314$\251#D\031B\240\221\232\321\224yG=\240\t\364\357\216\322\312W\022VB\342\f\200\273\250a@\250\030CDB\nJS\222\f\007\240\002\021\241\"\253\003\02101\204\212\250&Y\016\326\301\321\246PQ]\235N\271\223\341d\021\247\205+\220)6\307zH\233\003d=\202 q\334%4\355\370a\216\004hk\371>\trz?\007K\027\240!\245\376\n\302\264\335\030\035}\t\253\0278W#I545\210\032\215E\r*_\275X\017\367\302\326`\005\"\215\033|\207\344\226H4\022\221!\036[\025"
+	.string	"}j\224l`\001\272\022C\310\021\270\2171\200\375\360\323\237\036f~ip \360_B-\363\034\007\263\367|\202\214\244\317\236)P\222\347\013\267\005\202\005\206\212\34090\017\007'\346\024\303\226C\005\244\025oT\326:\343\n\177\234\254\264P\327Z\253m\232]\364\364\032 \031b\346(\332zJ~t\304\372\205\031\\r/ yh\002\356\035)\036\031p\\O\032\314\323g\277\302!\355\210\350f\343\311yD\302i\315rG^\005\333\253\354\217\b\215\243/\2549\373/\334O\357F\004\022\222\375\276\213\253\304\021\206\205\230\024\356\306y\027\337(\356$\035\220\201\343\202n\242C\001\210\303c\303\241a\203\"J\f\305\013h"
+	.string	"\314\354\257\220GP^\365k%\311"
+	.ascii	"\311\225\364/Y\332\372\320\356\3571r\335\251m\220\b\002\204\250"
+	.ascii	"\n/j\021\367?"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.116.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`J\004\225\033"
+	.string	"Fr\257I\260VU:\324\312\235\211g\030\305L\341\226\223\331aE\023\240\261\355\252#Ic\245-\t\345\025\217D\260n\336fO\007e\242(\003\335\323\324\237\235\331(\207pOS~$\347\345\027\277\253\031\236*\236\347+\376F\310\2262\311\235"
+	.string	"\212"
+	.string	"\231"
+	.string	"7\362#\273#\3551\305;\021"
+	.string	"x\005\b\226Z+\202\223\373`\352\244\214\306\212E\212\303\367x\3500\021\240\342\213\240\033C\252\374\304\b\322#\203\nb\320\200V\375\t)\201!u2FB\347\274{\037\377\261\3730\3504\265\0361%\251\225\230`qR'\227x"
+	.ascii	"\345\311\324]\345\311\335\355Z9\261FE\341\3601\242\250\245\326"
+	.ascii	":k\032\337\2356\357\366?\036&(\344\235\022\275\351\201&\031U"
+	.ascii	"X\302\037\2751rB\364\343YH\350cFE\250\265.\007\205(\276\344w"
+	.ascii	"w\302\356\246\330\245\265\017*O\276YI\250\250\307_\226\231\274"
+	.ascii	"D\251\314e\227\310\343\236\261{Z\373h\367E~\331\211\374\005\216"
+	.ascii	"\364\205\235\370\023\370\220\377\346\306\357\353\303\177\300"
+	.ascii	"\203\374\002\232\327\246y]\224\267\206\362\322P\336\026\345\235"
+	.ascii	"!yY\224W\206\362\256(\257\212\362\306P^\030\312\233\242\274\250"
+	.ascii	"\346-\233\227l^\332\274\335\274\334\2747\020+j\002\272R\353\320"
+	.ascii	"\227.\025\n\251\004\307\221~\343\221\374\270\252X\222q\217\262"
+	.ascii	"_\253\n\r\rs\f-\351\004k\363\341\007[-\023\321\274}\365L\214"
+	.ascii	"\210\325\373&\022n<\005(\230E\246YL\307\233\030\036\251u\371"
+	.ascii	"Wk\317\300\252e\272|\212aU\357\376\340\312\007W-\3735oc\032\246"
+	.ascii	"U}'\240\021\254a\035\323\244\224W\277\032\246[\t\250\303\367"
+	.ascii	"D\b\353#\245\032\3250\035K\316d\217{\033\373a\215\374\340\032"
+	.ascii	"\033\002\025\026e\243\232\225\310\246]6I\201l\322I\250\250W\201"
+	.ascii	"v\177y\365\215\227\365"
+	.string	"\230\313v\277\372K@,\375\356\246K\300\034>\013\334\324i\237tA\227\262\261\001'm\247FM\334N\215\372\230\267\034\315\306\203:u\267\032\3151q9'm\307\274\235:[mF\201\211[\320\300\301\206\034\236\007\fp\002(8i;\247i\313\345@\364\250\266\007\307\304\335N\232\317-\004\315\234\235\034|n\0356\314\314\033\355g\326\223\323\315pb\213\363`\313\315N\034.7S\021\353i\355#\r.\240\364\332GmV\334\002\306W\251t\265\215\321\352I\213'=5\301h]\351j\036!N~\274ec+\\\275O\332\ru<\245\246]\375\247\022I*\214\246k\272\213@#\337\016`\215\233V\323t)\205\305\260\236\351\rZ\250QP\251\f)CD\n\n\n\n\n\254\305\300\002\221\241*\036\020@\bI\323\034\2438\3303\006\032\314^\325\321\247\"\316V\201/\211\001\202\001\263\325b\035I\263y\177\020"
+	.string	"wQ\0301\243\371\256\363g6\322\273*\213\305\361\232\006\230\222a\0057}\211\253\013\374\023yb\346R\\\210\340\343'\370\343!\243"
+	.ascii	"#\362\006T\372H\250 \025\b\035&\263\377\216\321\376B\020q\331"
+	.ascii	"\267P\320\236\003E\354\262\311 K&\236\310\206\\\b\206x\021\344"
+	.ascii	"\220\317y\024\252\373.\210\246\t\354\001@r\363\314\267\232\262"
+	.ascii	"\222\333\232\253\017<\020\020%\r\315\367\236\362\341\037"
+	.text
+	.section	.gnu.lto_GPS_calc_velocity.117.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\215\005u\035"
+	.string	"\3662\262I\240\326Q:\215\261\300\220wV\002\023\033\306d=\366J\232\346\353\013xbT\271\001_\201\222\262\205\366?\376\354\207\274\022h\244\231'h\305\323pK\360/\374\003\277\236\342\303dM\202\375\241\335\354\007\t\370\201>\331\233H)S\222"
+	.string	"\215"
+	.string	"\245"
+	.string	"\374\230\311\217M~9\371\224\362'\345\223\224\337\223\317$\177\005\034\345\210\"\202K\255%\302\300T(\023\213\306Nm3\3632\371\357\r\313\320\267\307wx\331\3558\264>V\252i\247~\025s2Q\003b\001s\254\265\016\330\371\\lg\320\322\350Nrs\350\316\225\275\351\277\262\303\250Z\322\260\002\244\352Rk\325u\214mZ\262\271\351[2\210\t\n\235\226L\261M#\204\"\203j\255\313cy\204\360\211\271dPk=\007\205'\366s\3777\370\357\340\237]\001P\265\372"
+	.ascii	"\b\365\206\3715y\342\260\177\203\254\220_i\270\325\255\350Nn"
+	.ascii	"\233\214\035\356\222 z\341Z\253S\363\350\366\021\020*P\374\345"
+	.ascii	"\337\037\013\204\367\235\361\017=\336\340\316o\257g\306\025>"
+	.ascii	"\016;nK\027\356\310Db\261\362\327?t\342\206\361/Y\373\305\277"
+	.ascii	"S{!\312\277Q\276\255\344\003Q\376\017\345\373P~O\311\347\241"
+	.ascii	"\374\235\222_\243|\032\345\353P~N\311\307\241\374\233\222o3\371"
+	.ascii	"5\223OC\3713\224?\243|Y\311\227\231\001.p:\247\027\b\346{B\344"
+	.ascii	"d\265 \204\210\020\201\356\304\351\004F,\231\276\351I\005\004"
+	.ascii	"\033R\024\326\264\rM\3274\217\326L\323\314Z\3263\004\266\t\223"
+	.ascii	"\231\204]\242$K\026&\246e\272\253~O\204:\3261\355\343\365\273"
+	.ascii	"Q6\355X\357\357F\222\t\267*{\251\214+f\323n\255\337\221\354\356"
+	.ascii	"\3314\353W\343\351\005\026IQ\254\326\252\340{\265G(\200\250\300"
+	.ascii	"\033\254\320\013d`\371na\253\212r\277\321\032A\"\300UkE@d\213"
+	.ascii	"\\\370\316\330\371\244\335\216\356\354\316\031\245f\304/\241"
+	.ascii	"\336\251\r\362\365\257\366\0347\200 \001\206\241#\005\007r5\016"
+	.ascii	"<\246>RN\251\267c2J\332y0R\3221eH\332m\300\240S\332\031\361t"
+	.ascii	"HK\035t9\334{\034.,\351\230z\275%\235lX\267_<V\324\001\305\327"
+	.ascii	"O\277\205\201\201\371\372r\303a\353RT\303\305\205\265\202]^E"
+	.ascii	"8-H\266,\266\306\031\245\002\024m\354\362\350q&J\013\217\335"
+	.ascii	"\250b\013\362\212\025\026"
+	.string	"U\210hQT\330+\330\245\002\250\271\246\3744\320\022\327\247\177zz\247}x\272gK\n\217M\357\240\250u\221\250\306\025\345\301\006\273h]\353\256\002\202\361>\213\3524\255\313\255\337\216\234\276i\235\236[\277r\250ALD\031RB4\222\222\242$\215\001\260\002\031\031\263\016\021\3608\307\230\242\232\234\326QK5\373)J\213]\244\320o\276Q\336tG\202M\2547\337jo\225\353\344\017h\002\311p\330QZ\263]\307\326Q\356H\271\351\244\347\354nN\272\345Hm\272YB\313o \274\304\035I\017{\024\252:Q\236E\350k\321\020\360qf3\243\244z\363X\031\375\025\377\242op\024\233\257\037\260|!:\037n\354\007\303\023\0273wL\364\251\270u$\005\260y\2509\361\355\364\372\363\003\325lUd\300\371\r\332!IL\230\237\302\002[\337\035\203\316;\275\215\375\332\301L\022\n/!.\n0;\374"
+	.ascii	"\323\241\243\246=w\017ZG\330d\341\2425\321\307\032\304Ug\365"
+	.ascii	",Un\376;Z\340\210u%\3676\256\377\001"
+	.text
+	.section	.gnu.lto_GPS_calc_poshold.119.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\272\023\rX"
+	.string	"Z\211\240\036L0\f\333\031\003\253\315\247\256\350\334\345d\266\207\265\004\366\322AN\202\246v\273\305\334\300XhCs\325\331\025fI\213\253s(J\r\\\355\024\b\230\303\025K\232\235^I\357?\r\214\002mY\355~\261\370\211\r\241MBV\356\224R\n\342\001\245\001\336\001\r\247W\350\302\036\300\2728?d\3424\t\177\314\b\233_\242\203Z\006\233c\276D\003\251?T\002\251U\275\305J\315\324Q\257\260*4\271\337\374\210P\304\334o\232\r\310R\326j\213\347\345\313\363bK\3506H\232\r\367\t\215B\247\260\n\366\375\371\215\260\372\363\3630u\322\307G\330\307\307\243\246\230U\327\204u\032@\326\366W\304zO\221\364\036\317e\300\242\230U\027\305\266\336\2214\255\246\327\264\t\013x\001\346\341m\345\341Q\035\251\004a\357\212"
+	.ascii	"a\025!\275\357\334\212\250!ks\376T\213\216\336vG\272\216\341"
+	.ascii	"\306\220\2651\261t?\200tG\310\332z\356\b\363\262\004$\314K\271"
+	.ascii	"\270F\263\200\227\233B\337Z+Cm8\346%'\351\020\270\333\372-\312"
+	.ascii	"\013\2051\256\353.\235\355Fet\275\242nWTL\321{\217\300-B\237"
+	.ascii	"I\322nT=Q\267\253\343\242?\242,\333Z\025\023+\352r!\261,)D+\004"
+	.ascii	"\362R\324\336lIz\255\312\030u\271$\360\242\207\266\242W\366\301"
+	.ascii	"\366\312m&\t\363\262\327\265\3134\b\255\306\313\020k\322\252"
+	.ascii	"\214n[\0163\021\312z\364E\253\340\230\235\021\200\3555\204`Q"
+	.ascii	"\2435\031gCy\256\335.\267'8\301\314\215\352\272nP\257,\304\366"
+	.ascii	"\312\354\r\307^\215\275s\354\225\235\314oz\224\270V.\314\312"
+	.ascii	"d\231)t]w\350\267\260\2671\332\314\272\263\223,\362\270\032\337"
+	.ascii	"\235\334@M\330\264\270\254:i\334\320\345\314\254\367\266\246"
+	.ascii	"\030S\314\275I[\355\312Y-]^\215\224\322\307\034\256,#\363\365"
+	.ascii	"U\311\005\245\215\306\024`k\236\344pa\0317\260\301\342\246\333"
+	.ascii	"\264/\341R\342\337j\215\200\331[\340\225.\257v\244\r\327u\331"
+	.ascii	"\265\270\272\232\225\315\314\0340\363\026\346\035\036\001?\247"
+	.ascii	"%\270\376\321\370\353\333[\366o\374\316R|\372\242\005<\230x\005"
+	.ascii	"\007$\320\243\307\261\327\377\243?\271\034\357\277\276e)^\220"
+	.ascii	"\343;\312\315\326\255\326]\345\235\242W\245*}\216\3577\017\307"
+	.ascii	"\337x\245\377\267\367\354\212}\270\026K\215(\300\361>c\320\277"
+	.ascii	"\361\315\367R\341Zy&q\357\255\223ai\242\325A7\004\317\242b]\367"
+	.ascii	"\331Z\354J\374e\240\001*\252\021\372\233\255\231O?T\300\257\252"
+	.ascii	"X\327u\221\330\255\374\371\203\233\254W^b\362\326b:\366\332\017"
+	.ascii	"bL\356\351\213\334mS+>G\346\246\372\034\224\024\366\244\022\205"
+	.ascii	"\351\311\211\251\223=\327\017\231"
+	.string	"\243W\376b\314\335]Hp2\001\177\026f\326Y\007\353\234\243uVj\235q\264\3167Xg\033\255sR\353\\\243u\246\301:\317h\235e\260\3161Xg\030\2543\022\353|\324:\033\261\316/Zg\027\255sQ\353\334\242u&j\235Y\264\316C\255\263P\353\274\202uV\321:\007\265\316)Zg\024\255\363\211\326\331D\353\\\242u&\321:\217\350j3P\353\374c\301YD\353\314\364a\235A\260\316\037Xg\017\254s\207\326\231CC\2335tZ\363\316\3229\003\353\214a\351|A\351\254\243t\316Q:[`\235[\245\363R\351\254d\235\223Jg\226uF.\235\217J\347U\351l\\:\277\322\331Y\347\026\240\2052\341j&l\256\333d\021\321\325[\3454\350j7\264;\255\237\271\027\021;\261\025{\336x\375\371\361\226\n]\3456\344%\223\031}\241rS0_\274\215\2451\244da[\033\361!H"
+	.ascii	"\372\2566\363\347Y\332W\020\365\364\\\346\244\305ED,\327}\002"
+	.ascii	"\001}\343\211\370\237\357\321\300\325\234f\254\353b\031\261\203"
+	.ascii	"\340iN0\3160N1N1\307^E|\343\215A\311\020=\207g~\277j:<\207?\276"
+	.ascii	"\275\324\017\337\337\341\237\360-\253\262\263\003/S5@\024?\250"
+	.ascii	"\222\216\325\232\0332\037\236\304\237a+\335\302\024v2\354\316"
+	.ascii	"\375\300\2038\204c\304\364``\313\b{\372\241\030\345\263\277\234"
+	.ascii	"\361\312g\302R"
+	.string	"\2014K1\357\316\216.\254J}\316\370N|\363\276\366d|\230\262\r\300\264\226`\214\227\361\016\3307\355\326\353$\232]\264J}\256/\366\342a<\373\013\307\202\026\0246bY\224\030_\f\351\217\336\001\265<,7\344n\323\3123\\{n\n\335P\330\020\233\230\r\276\370\376;\372\356C\372\2366\263\350\221\214\376\310\350\217s\257\240\213\177\361\236\370\346=?p\2632\027\337p\177Pw\233\322\342W|\321;\340\013F\364,\276\305\037\023\337\263\fX\312MF\364\310\267%T\206^\350Y\274\221\360=\273\"\343d,e\275\f\275\213?h\362\205\250\354,\343c,\355\211B\006\206\306E\213o)r\354u\305\267cP\275V\272I1\241\223av[Y\260\344\271W\367\035\006\fw\201\207\261\364\006\3031\234]3\223\337t\237\374~\301\256|\321J\021\036?\255*J\275\301l\315\017\f\255Wv*\376\005@"
+	.string	";v\f\300E\330\260. h!\013\367\233\206\321\263\361\354\367"
+	.string	"f)r\307I\243\254}m%\275\215\032O\343\223\344\330\207K\211B@\215\343\323\220C\363\304\t\003\004Pu\034\362[\332\314'\362\035\020\314\361\271xl\360\333* SG\242\210<\255RMSC\236t8\tyr2\"\201\032\362\354$d\304ij\2519D\004\252\331\204b\3620\325\\\372\346\222\324R\324\017 OQ\311) \016\344)\352\245\240\244\244\232V \r\244\251)\312\310\217\251&!RKS-\027\031\035\005i\341"
+	.string	"\322\013!\036#O\021,\031\231I\210\b\324\323\324\222\220'\b\226\210\fM9\ty\032\022d\210\310\323Rs\210I\312\310\220\220\017CE5I\rMAAI\r-\243\317\376,\314N\003\365\236\177\225|1NvA\372\374\033zPk\370%\032^)\005,7\334i\233~i\370\206\266\221}1\326Y\263\002v\f\352\234\265/\270\025\304\357\370|C[\303\373\030\343\246\334\307R\036?>%\035\277\023"
+	.ascii	"\020\333a|\323\022\304\313\360{<r\270\2609\300\271\245\207\207"
+	.ascii	"\317\220\267\306\357\272\325:\203\343u\373\036\376hBc\370\226"
+	.ascii	"\303\230??\247\266>>\367\233\336\351ax\346\205\307\360\016x\267"
+	.ascii	"\367\027\276s~\371:;\237\363\216\227\245\250\326\030\332\246"
+	.ascii	"v;o\343\351\207\216L\n\263\262U\025\354B\307\001\332\361\305"
+	.ascii	"\230\007\007F\030\337m:\031\206f\353\260\311\037}\214_B\324\017"
+	.ascii	"\034-\274\224\032\336\277\205G\022\276\206O_D\003\342;-\021\361"
+	.ascii	"P\307W\264\220Z\327:\036\304\nWv\255\342u|\f.i^8\213\212:q\211"
+	.ascii	"Qe\315s\307Fl\346\363\260\231\035\250\370N\253\306!\034\f\264"
+	.ascii	"`\355\253,\350U\244x\024\037\364?\367\236\215y\032\272\024\317"
+	.ascii	"\363\007\305+\241\214\0049\273=7\256\252G\n\231\024\216\347\257"
+	.ascii	"J\032\024\357\305G`i\217\333\031\007\324\022<\361#\036\305\257"
+	.ascii	"|/\230\211/\361'\276\203\231\367l\3043\337\304\177\300{\313H"
+	.ascii	"<\321\227\370#\336\253\006\350I|\217\231\027,\201\274\250\221"
+	.ascii	"4\310\224B#3\"\242 I\2224\006q\005\304\030\345\234t\335\021"
+	.string	"\360\254tN\311\210H\222$5\032\003\324"
+	.ascii	"\277\322`\252b3\315\374\360h\275H\"\017D\025\022\231&\230\230"
+	.ascii	"\032i\216\353\3576\266\230\330\362\371\306H\2636\232m\314\242"
+	.ascii	"\377\264\253(\221v\215\307/\031"
+	.string	"\241i#\360\302\261\3717\311(\320K\320\311\367\n2\261\237\215\354\003\326\220\256\"\277\327G\204$\203\016\023[\372\002\002\302j\310\033\226\366N\n\316CU\302\005:\266\265\321(\357E\354/\017\030C|\017\360\353\003db\303\357; \025\274\366@\351E\007\340\002Htb\210\324\025\"\266\\&\343\021\027\272PH.\323\245%\036\347ul\rc\202\240\312\214\341\215\235\202\231#\325\216b\335Q\312)e\037l-\035\020\312}\016<Q\363FE\026\025\375~\271\033\305W\002\330\001\020\207\354P\3347\242U\313.\007]\353\307q\033\202y\240\300\370\374\240\366\030\226_(&p\240\320\356]\336\341\357r{\2364w\346E\001-w\276\342zrS&%\224\230f\300\3409\210{\016\232\315\315\004\307.\341\322\213\026X\034\006P2\341\310R\370>\347Cf\207\004 d\b\352\325X\277:\007s\005\027\317>Fyx"
+	.ascii	"7\214k$N*\320<\263\267\333I\241\023\215$i\206\t\222\377]\004"
+	.ascii	"\222\366\3222J\342"
+	.string	"\201qb\034J\242\324\2353\324z\022y\035\251\177\322:h\262\002VNv\212\371\354\324\316\306\333\241\255\356\336\317\345\257\331\345\233\330u:\332\261\307#[\300\336\007\266qS\233L\273C\037\320\"\356[\245\365\213\205K3P\207\352S\225\026\212\\\344\355\360**W6\350D!\210\005\272 \374s\274+B\022\236\254\f\\G\270I\3211B\326r\215\375\240,\027`<L\210\274F\207\352\330\332\331R\2518.\362\003\217e\0210\016\024P8!k^\315\200\371v\023j\311\243H8\345\236\206\340Xv(\347\327\276\002\212G-\270\231\316\017\352%2\274\037\226\303\034,\\'\354Tl.\034\030|-\360\02685\027\234\304\261\374\007\035\fJ\017(\332\242\025Kq\245!\017\377ODn\324\362[\240\2518BzC0SF\254\f,\305\253\277\025\263\277\256;d\006o\236\025\032h\021C\0013\377`$@\274"
+	.string	"n\313\217J\022\360\366L\362\"Y\204\334\351\2401r\344\302J\202\252C\013\211H\204%\241\033\024lo\022\340\232n\360\203\275\347x+\027\225F/\210\"\207\333r\210\233&\201\016\374\323\025\f\343zp\321\020\031`\342\b\200J\360\31432}\227\223s\211\264j\021qHp\241\33143\211\313~\313\310\221\023\230[p5v\350\227"
+	.string	"\301\350\251\233\027\215\004\026\355H\267\225\254"
+	.string	"\023\326\036`T>9\310\240\250\216\337R@\336D5\017Fq\344\241e}Sp\361v\234\f$d~\270\226\331h\325Z\224"
+	.ascii	"sS\032e49\336JEJ\035\326\005x\266\317y\214\300\346\276h\261I"
+	.ascii	"\023\033$\247\235\237\220\206\324\234?\007 ?\"\n\024\312\374"
+	.ascii	"{\b\260\326\272\206z<s\224\207\3227\301\036\025"
+	.text
+	.section	.gnu.lto_GPS_calc_nav_rate.120.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`)\023\215V"
+	.string	"\232\215$\037O0\220\322\032\003\257\324|\007T\030hL\3107nC-&\214\373\331\314\342\242\366\337\310\273I3\214\\cZ\024\005\032\020\312\016\346\350\312\330L\226\033\025VT\202\\PJ\243a\336\202\377\272\321\373\001-*\212\301\331\007*\002\3212\"eJ)\005\352\001\246\001\347\001T>\356\365\r\215C\3735\320\025\306/\215\320\2254\307>\241\262\276c\224&_\n|G\264(M4T!/4T\252\316\022:\331\306P\235\bm8r\327 \344fd\356\032\216\255\307NaU\326\317\233gG-A\330g\230\211lA\303\300\035C\313\3203\260{Q\264\251\024\200\252\2514\004\036W4\257/\232\367\203\005\020ko\004a2\b\263mjto<\013\372\216\237<M"
+	.string	"\261\366\250\204\rE\3125\231.\323f\032\350\n\203fW\227eW'\025\364r\022\3229\231\2702\336x\3239\235\3100\333\222BU\343\320{\016\331c\030\016\215\331\326$FHO\f\222\331\326O$31\214\005\314\304\376\302Ld#\315\205\033\256\2754\320\345$\3069\245V\227\253\351n5\251\030\203\336qF\332)\005\324t\267:\256)D\330\354\333\013T\305\253\246\253e\323$\004i\232\237\t\025\214\254\367\233\221~\201jm\272Z\032\250"
+	.ascii	"M\033j\226!\350.F\230\211\315~ci\266vc"
+	.string	"b\020\023-\275%\331m\031\254n[\217\262@2\006\204\315rS\0304\226\205\235\016\245\341\354H\002\302f\203V0v\263]H\366\032?\333\335r\373H\fg\035P]\327M\321,\033 l\266\270\006e\031\335\231;\255\257$[m\003f]\027lL\234\3536\207\230H\330\354N\373\004\233\365\356\t6\313I\346\032\2008p\253\\\224\375a\261\371\271\256[\364N\330{m6\007=\3316Av}Or\233\360J\263\324\252j\233\325\007\212YY\216\026\326\212\342\371\346l7+\017\226)i\366F+I\257+\212\2572#\344h]\255>04\241\241\317\264#\321\342\300\277\335\232m\322ef\251\245\244\335\346\206\353\272\354K\255\255fa3\363\02633\231y\314\004\315\022\277\331\246_\206o\3637\337\302\037~\277T\001^\370,\033\263\016\241\315\0030\375\242l\213Vy\1772i\250>\2478\002SF\251\004\007"
+	.string	"\022<c\237\231\207\332\215\2358R\327u\215\255\267\334\003\362\022\317|"
+	.ascii	"\002\336K\366\217\300\256\276\212OD\313J|g\351\242\322\331T\252"
+	.ascii	"V\200\272.\037\005\006J\257\\Wib\375\022\337\317\327\354\177"
+	.ascii	"\375\365\371R\375Y\313Xs\231\340\177\277dV\036\310\375\376\215"
+	.ascii	"\005\310\375\327\200T\334LV`\001\357\345\002\301f\373}\246\\"
+	.ascii	"J\017\344!_=\316\354\300\003\336K.Z}\025\017\341\332\032\222"
+	.ascii	"u\002/\360\316\365\034\230\233V\376b\314\335P\300\210p\204?\214"
+	.ascii	"\331\235\203\270s\001\2553\220\326\231\200\326Y\311\235\177\264"
+	.ascii	"\316>\334\271\207;\363p\347\035\356\234\324:\353pg\244\3269G"
+	.ascii	"\353\214\243u\276\321:\037\265\3166Z\347\032\2553\rw\236\321"
+	.ascii	":\313h\235c\264\316\306\326\031F\353l\324:\277h\235]\264\316"
+	.ascii	"-\272\332\314\242u^\261\343\254\242u.j\235\211\206\334\031\205"
+	.ascii	";\237h\265n\001:Ks\211^k\016\312q\036\341\316\"r\234C\3508\203"
+	.ascii	"\320q\006\322q\376\240\343\374\343\316>:\316\036\334\271\307"
+	.ascii	"\235yr\234;\270\363\216;\353\3448\347\264\316m\353\214\223\343"
+	.ascii	"Ll\235oZ\347\241;\013[g\233\3269\330:\263\255\363\212\343\374"
+	.ascii	"8\316\356\316\235\300{\361]\225\001\276\fM7\204\3005.\224\375"
+	.ascii	"\"\245\253\335k\335Y\272\333zenn\033\272\312\255\206\211\314"
+	.ascii	"4\212\022}\323e\212_\017\301\350\3344+i\372\252\240\261\263\371"
+	.ascii	"\320\264K\243`\240?\357\341?|\277_?\376\347IXu\005\332\321\315"
+	.ascii	"\211\231\342V\251\312\037\337\177\257\035\tw>\236\005\262)+\364"
+	.ascii	"x\037\357z\321nh\017\323\346\232U*\373bH\317\243]&\201A,\214"
+	.ascii	"\203\365\305v|\322K\200\305\356\312\325p\237\351\033.Zw3t'\331"
+	.ascii	"\262&\204<>\244\357i\322w\264\213;\276\361\272\210\343w\350\370"
+	.ascii	"$\035\037|\276{9\036\351\375\357\265S\252\340fe9\276\341\246"
+	.ascii	"j\312.]7\236\306\343x\327{\277\216\336\306\337\370\340\237\024"
+	.ascii	"vr3\217\336\346\r\211\227\322\327x\033\277\366\275fVQ<\n;\205"
+	.ascii	"\314\032\357b\312I)\016\205\235@J\230_iO\234\370\230S\260Y\032"
+	.ascii	"\217\363D\r\3327]\226\230\351!\330\\\226\230TX\333u\261\253\233"
+	.ascii	"\016\005\206\003\363\023\330Y\306p\f7'\246\213\312/\247\037\351"
+	.ascii	"\262\204\344\231\216\013o`_i,;\t\316$9%I%Y%Y%i\205\235\204`["
+	.ascii	"&\324\374\322T\2704\352\005Z\300{x\233\274\270~k%Z\316\250U*"
+	.ascii	"\220/\340\373\265#\340\225\036\310\377\333k"
+	.string	"f\305\311+\316e\264\204\200'\361D\255\303+}\347\275\324/}\303\345\357\316K\017\301\344\232U\276\346\342I\244\204\256\253\354%\273\b>B\262\005\034RRq]T~\2775\317\367\274\353-\367Z\350\360ZI>\322,\244^\356\361|\207\377\247\177\200\244\213\354\313n\267\356q\017Z\347y>\210\203\025\b\275\363:\317\376\336`#\235J1\340j~\006\243y\017\215Z\201\356\374\335\re\1779\277\363\237\207\005h\245\375\234\377\347k\207\3637\337\022\037\347\203z/\325;Hb\307\362#<\270\231\315\262\017%\245`STPE\216l\024\323T\005\307\035MD\216M\253\021d\005\317MDRMSKOEE\220OO\310\tBL=-\375\323R\324\022T\004B\216P\303)!.\344\b\365Q\310\250(&\226\3101jj\205zb\232Z\245\216\030,\255\334\302\b\306\020\026\022\030_\020\375\bab\202\222\212"
+	.string	"\203\245\247!O@T\004y\234Z\"r\274`\251H\321T\023\221c\005C\212\212\034\227\236\212&\210\222*\"\"\301H(\246\250\242)$2\252\210\330T\366\207\2610Z\007U\276\025g\260\272.\nG\335\326M]\363@\233\027\343!\024v\350_\215\247\350\240G\342A\2174\003\023-gd\325\275\240\277\241\364\034\232\233V\275\006_\214\017`a\345\361}\246\207`^\262"
+	.ascii	"\245|\322\367x$\314C\337k]\034\240\203~h\215\213R\271s\231\223"
+	.ascii	"R<\006v\222\030\303K\236\215\030\273K\222\254\302>\227{s#\036"
+	.ascii	"\232\2243f\206\307\222 ?\342\275\256\f\2319\036iT\216\256}>H"
+	.ascii	"]\213x\237\017hMm.\215\312\211\b\361\"\336\365\344@|\b\240\377"
+	.ascii	"\360 f<\320S\200\347\265\245\232\246\217\017\315\224,\031?#\306"
+	.ascii	"\033_\206Y\227\217\221\213\361?S\265\272'Y\0300\377\\\356\315"
+	.ascii	"\335\271^\250\200\2260\343\234?S&r\306'\301\337\330\t\364B\027"
+	.ascii	"\030\337\342\215\317\346\275_F\377\342a<\b\266\327\254\305\027"
+	.ascii	"\275\321\213\250{\311\\\374\321\277\370`\335K\206\305\273x \266"
+	.ascii	"\367\253\004wc\247\214%am[Z|\020\030\026\337\325.\256xv6\nk\240"
+	.ascii	"kX|\327\251\370\025\017d\202gI\236 t\335+#\3665\307\222l\"\226"
+	.ascii	"t\342$\330\254\212\357\272'jW\216\236\350\213\276_2'\236\350"
+	.ascii	"\203o/\025\305\367\374\211\377\276\227\314\252\312\311'\336\244"
+	.ascii	"RR\"m!"
+	.ascii	"L\r\305\0070U\023\201\222\250q0\310\224R\206dDD$I\2224\006\221"
+	.ascii	"\005\304\030\306 \274\016\022\200t9\216;\244F\002\221!)JR\230"
+	.ascii	"\306T\001\277\334K\250\267T\rA\326_\303jN\211X\311\343\377\365"
+	.ascii	"\243\004\035I\030\353i$\354U\252 \214MH\310\343$\265\212h\260"
+	.ascii	"\357L\210\357\036',\360*B(~\377\026tT\344\312\242\264\376\216"
+	.ascii	"\310hZ\177\377]\222\037 \353\220J\r\367SQ6?8\023\222\254\262"
+	.ascii	"\335\357Ph\025Yog\364#VJ\035\b]s\031\346\037\334]\370\004\f\273"
+	.ascii	"y\222\321\031%\312^\201h\362,\022\244\344\030\226\235\324\004"
+	.ascii	"Bl\264\\\270\310\3646\307F\316\024\362E\240e\305.\021/z\261o"
+	.ascii	"Wi\035!\331\030\271s\363r\361\257}u\203>\262 \340\231\005\204"
+	.ascii	"Z\310\302\304\274\271\324p\364\251D;\021\270q\"\277\004]\246"
+	.ascii	"\265Og'p\310\342\300tw\242\247\360\323\233\360z\242s\264\036"
+	.ascii	"\377\367D4G`\204hY\351\263G\256\024^\364\225zqt\230\3374\332"
+	.ascii	"\361\353\302W\213\307\353\313\215&\031\244\275\201\302\311d\345"
+	.ascii	"I\242\246\2505\002\336?\326\321\242\351\321\200\022\006Ugt0\262"
+	.ascii	"^Af\311R\334\007\261\027\n\333b\342'F\007of\016A\231\3050\366"
+	.ascii	"S\335G\032\376^'Qv\025\245\303\3609\327\324\210_\251\021\322"
+	.ascii	"\224N\013F-\270\255\234\025\034\024e\r^^\366\223\2221Ij_I\342"
+	.ascii	"o\017~.Axa\364\306\3413FZ\"_}\nk\247\277\274P!\022\260\364A;"
+	.ascii	"\004\357\352\325\341\325\352\2273H\007z\f\354\3510\330\274\330"
+	.ascii	"v\003!=\362\306{Z\325u\2770=\222\205\203\260U\304Wc\246\b\006"
+	.ascii	"U\212\\\372p\"\262\234e\037\264\265B2\213>*\006R\256\237G\033"
+	.ascii	"\\\025\245\374?=\2420\021\344S\203\231w"
+	.string	"\245\345\032\250\300\267H\372:\363\"x\331`\270\357l\376\003(\235\307\242\347~\221\254P\032\265g\026$\304\"L\334\226\243\300\n\324uOVq\321C\262:\357a>\201\312\037\177R\363>'\264\374\362\311\363\261g\354\255lZ\361\202P\302\306\207\346.X\034\246\365*F\032\\X\354\023\245T\006[\345gI\365\007\305s8\t\346\003p\235\001J\265\250)\367X\253\226\222\301\201\217\314\222c\215e%$\262\250L\302\232W'\277\237VI\231\035\247$q\313\333\226\312D\022\310\310\1774\273<,\215\267\231\345\\\220\3328\301g3\205\026Ot\030\375\224G\370\244\3528\2217\241\333D\335\\Y\3264\220-\rq\311\r2\216E\352\364\363\352\331\226\0276lj\032\316#\007\022=\362s\220\006X\2727(\3003\364\"\314:\217c\351\023\352Z\023\253\322:sm\210a(\032\fY\350w\366\020.1\b\377\355"
+	.ascii	"}D\270}\251\346U\020\220(\217\205o\372'T"
+	.text
+	.section	.gnu.lto_GPS_update_crosstrack.121.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\354\013]5"
+	.ascii	"JV\034\023Ip\226V\007\203deM_\245\217;e2\266\376\360\006\203"
+	.ascii	"Yz\001\004\212YJ\342\023\\\002A`\311$\314x`h\327\255=\374T\374"
+	.ascii	"\203\222J3\365dB\307e\330\313~%\304\3144\022x\222\260\301\221"
+	.ascii	"$d\357\235dJ\001 \001\n\001\034\001?\335\255\326l9\373\345\213"
+	.ascii	"\f\202o\bRw0\rm\301\325\f\366"
+	.string	"\362x*\366\023w_bZ\267&\271X\273\020\340\212\252'`q\034\007\375\355n%\247>\225L\324x\332\233a\2255\340\357M\217\237\234\275\332\036\304\311\222\234\372t\251\361\264\030\307\205\025;\340o\373\370\374U:\022\366\327u#\354o\373XRw\320_7\330J\335Vj\232\342\245\237/1'3.q\034/\277\206+yM\222\006y4\026\21132CaL\020\370\363\365\340\327\375\254\324\376{\232.yM\022\314i\220pR]n9\362\261\313\2158\\\245\333\215\\t\013h\333\360\034NJ\207\213\214\352z\3620\033\231\330\003\232\221\331\222\221\207[.\274\262\306\3101=\2400\327\311\232\342\362 \320\352E\376\351dMY\271\017N\252\352\352:;\244\250r\317\265\271b\262\302\341\244`\270\002\240\314\250\342aN\031~\245M\331m\341?\2342\271\3128\216=\3153\3244\232s\017(\216\343\316O\323)o"
+	.ascii	"\336\355^\335\235\324\r\374\n)\256>\262yZh\366\322\006W|\330"
+	.ascii	"&Wa\331\220\305q\034\277&\354\274\230d\275;v\363@IrY\3577\370"
+	.ascii	"\377\346\035\214\364*\232\267\355hta\376(\260\376\204\3779X\235"
+	.ascii	"0\345.\355i\356[t?\340\034\315}\205\264\bV\236\335\277\237\271"
+	.ascii	"\022\232\275t~\377\177\227zE\217\020\345\377\265\033\361\267"
+	.ascii	"g;\216\376\320\314\376\344o{\023\366\327_H\205\n\232\267M@\016"
+	.ascii	"\f\\\234\275tS\243\371\265\272\375\267\333\355\266\237Fw\017"
+	.ascii	"\217c\275wt\224^\365\316\301\271qs\007\260q5\357\244/7\362\350"
+	.ascii	"\313m\3643\357\242\227y\023}\271\207nn\241\233;\306\315\035\354"
+	.ascii	"\345\006\276\271\177on\037\234\273\367\346\206\337\334\257\233"
+	.ascii	"\333us\277\233;\273\271]@\214\235\332\324\255\256\304q\324\366"
+	.ascii	"K\234}\335t8\326\275\352^\346~\346\256\346\355C\334\r\311\211"
+	.ascii	"\264\267i\250\222\202e\243\302\"9\233\215l\004\237\2777x?\275"
+	.ascii	"v\263%r>W\301\302\205\013OY~\017\374\177\223:\361=\374\277\367"
+	.ascii	"\336\373\336\245\3328\217\222a\003\223\t\373\333{\237aN~w\220"
+	.ascii	"P\366'\370\221\260\230~\251\035mn\232|Ws%\233\373X\342\221\215"
+	.ascii	"\343v\260\335Na\212c(\317\373\311\035\377\357\327\254I\265\320"
+	.ascii	"5'\242\311m\267\272h\261\305\327\352<c\374\r/\202\310\037:\341"
+	.ascii	"\341{\230g*\024W\252vqtL\271\213K\264\312(\277\335\341\277[\205"
+	.ascii	"9\257\203\241\316\237\260\316\033\203Xu\336\2533\312\367\252"
+	.ascii	"\222\354g\flK\306Z\035Zs\336\2539=\245\213\026+\264\n\251\026"
+	.ascii	"\315\262\267i\201\"#\346\n$~\273\277\177\277\372\216\217\363"
+	.ascii	"P\335<*\374\t\343<\362\227kN@\242W\234 Q\271\304\377\211d=D\310"
+	.ascii	"\031\022\240\022\277\226\375\256\307\367\262$\376\177t\321\024"
+	.ascii	"\345\345C\342W\2632\242\232\324s\327\323"
+	.string	"U\266\367Z\355i\376\240\b\336k\363\355\272\377\236\346\276/=b8\261\375\315\027\037\352\t\027?)gu\322a\356\001CBDCn\t'\210\357!\037\021CG\314\346\262\310\331l:;\330\0345\231\037\004B\250\210\371\206h\006\035\271\235`\001\003\017\b84P\340Cc\34442\nz\273\203O\221\223\350\210)DD\202Y\264<\032\022\"\002\341aYD\304l.;\030\211X\372\344\2643D\220\321\362\310\3514Z\006\251P\177\032\355\233\213\221\205~\324\255y\255<\024\327\037\324\274,\371HS\224W\362\265\036\034i\201\344\371v\217\302w7\035Nl\306\235\357y\250\356\236\337\"\241\316]\\\177`\271i\351y\307\322\360\274c\205\317c\267\323V\345B2qa\316:\272a\331y\307\n\177\347I\033\031\003\3332>a\241[\223\2667j\236\235\360\035\353\033\260\240\331\013\213\230w_\370.\275\212\336\305\374"
+	.string	"\256:\247s_s\244[\361"
+	.string	"\357>\214\027\315\342\301\017\360\235\245wI0,\332\236%,Z\2338\244!\264\272*Z\352\252\364\033\2155\214\364n\204\317\337\227:\247\"\033\374\356V\342\241\362\343f\247\233\340T\372mF\030\351\035\005h\360_3\2470\320\274U\001\374\366\201\022\250\201P\345\220B22A\224$I\222\016\321\005\304 \345\234\321\003\022 \3660NJ\346.HA\222B\373w>M\376\034Pg\361\f\357\371\243\233\3671\262\356\364\2041\304^Uy\244\013=\343\f3#\020\224{\005\251ih\242\204T\306\362\3145@\326K&\356fA\253\006\337\315\027!r\274\244\326D\337\360\317\006|\370\3658\204\304m\326[\372MgJ\263bz\3672\212\335P#\212\323\327\252]\322\006\212\264_~-\273\211f&D\277\177\204H\364\376'\261D\n*PQ\341\204\344\355j\210\315\353\004LG,/\276\023\365\324\302"
+	.string	"\260o\257\027w\322\007\001r\\D\352\364\007\3558\375^-\307\244\253\177\206>\250\331l\325e\315\034\303\346\217}\276\203\007\371\301~\271\366\210\260\326\022\272\326x} \265\324%\330lH\267\245tr.\370/\264w\023d\222v%\304\007\022\373\022\235\270\326\357\310\324q\220\306L0ET\252\255Y\264w,]\\\261\"7 e\207\213\0367\2206\225\205K7\023 \264\272Q\273+Md\350`1L\224#\356"
+	.string	"\264\256\t"
+	.string	"D\2106\227\t\0036bs\226\345 \005q\325\030@.\220\263\201J\363\261\205n\271\325\267\227\343\230\227\201\312\016X3\314\250\221\r\321-\314\325\340\306\325\317\033\n"
+	.ascii	"\204\352\001\315\347\264\216\316\030u\302s\005\344\352h\005s"
+	.ascii	"{\320\205#\242q\202'\003.\242\001;\313$\310\310\031\243\245~"
+	.ascii	"k\263\341\244\265\303S7\241\204}2(\025\030\324?e\002\221\312"
+	.ascii	"\342\347k\023\223\377U0\326#`\022\376\234\315\342\267\241\353"
+	.ascii	"\\WG\206\221\342\212Dn\330\f`\254\341R\235H\325\007&n\003oD\241"
+	.ascii	"\202\267/\345htV\030/\233@\371\003"
+	.text
+	.section	.gnu.lto_updateGpsStateForHomeAndHoldMode.125.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\212\016-?"
+	.ascii	"*k,\027AP\344J\007C[\264\212D/q\255\006)F\003\313F\222|\310\230"
+	.ascii	"\204A\2724\376WI\302s\030O\023\003\264V\002\002B@\f\230\004\243"
+	.ascii	"l\t\215\336r\261\265\202}$m\237\020\262\311\336;\245\224\002"
+	.ascii	"f\0015\001j\001\316\256:7\207\240'p\332ZI\343\275:\032\373\334"
+	.ascii	"B\365\257IG\273\003\273\361\272\241\23527\341\230&\323e\374\372"
+	.ascii	"\230mPp\f\216M\224.\rX\006\246\371\372\317\257\317\300\231_\237"
+	.ascii	"\322\232~\206\331\273\023f\017)O\006k\326L\203\336\266\316S\242"
+	.ascii	"XE\217\023\342U\352\375\245\254\275\260`\n\275mEF\376\250\371"
+	.ascii	"\320C\242K\031\263\262\365\230\225\034\243\263po\031\203;T\266"
+	.ascii	"\032\325\002\203=cc\307\334\341\t\270\273r\357h\214\326\002\243"
+	.ascii	"\350\366\332\222;\270\250VY\004\333*w^\ffe\253i_i,\254\\\232"
+	.ascii	"\003e\276\364r\351\272;.u\035\330V\227\030\257\272J[1k<\346\353"
+	.ascii	"\353v\275\020\316]\027\305{\357S\253,\305\266\332\354\243\265"
+	.ascii	"\325\264\215\326V\331\214YNC\351n\322\035\236ZT\317\275\327\371"
+	.ascii	"H\332\254\211\226CBA@\312$\222=\256j\372n\306\215\\k;k\242\345"
+	.ascii	"qB\223\234[\222\036\"\322Bq\204D<\bh\210\020W6\311\271\r\351"
+	.ascii	"d\220\2649\b\347\310\226s{k6e\020g\206G\033\262\001I\217\324"
+	.ascii	"\030\201\323\200\335d\307\366\346\307UM\257u\365G\247Bm3\364"
+	.ascii	"\322\374\r\331\350\322\346\275\267\261\264\333hCs?N\270\367\262"
+	.ascii	"\257\265\2715\0275s;`\346\2269H/\307g\327?\266\232"
+	.string	"V\177m\303\346P\335!\341\033\332\315\2473r\221\247\317<\202\204\367\232\204o\246\375\0313_\347\360\203\243\310e\254\306F<i\367>\235\376\323\357\326\316\377\277[\305d3\327~\177\367\323NA\363Ff\346\352\302.*:f\023\235\006E\224\233{o\325\231F\363\305\275\244UN\001\346\275\006\266\266\332O\225\004\357\351\215\254 \261\315\360:#3\024\315\177\216\271\323\373G\230S\347\f[\035\330\214\241\003\233\265Rg\013\035m\256\320\321f\n\035m\316j\274f\254\2066KP\235#\254\316W\253\263\325\352\\\265:S\245\316S\2513\004\325\371\301\352\354`un\260:;Wg)\3259ju\206Z\235\237Tg\006\252\363\202\325Y\301\352\234`uF\260:\037P\235\r\254\316N\253s\201\325\271iun\256\316\004V\347\001\2523\023\353,\200u^b\235\225Rgf\352\234\244:\007H\235\221T\347#\325\031"
+	.string	"\353l\304:\027\261\316D\251\3632u\036R\235\205R\347 \325\031(uV\246\316\311\2433rufW\347\243\352\274\252\316\352\352\234\256\316\257\006\201y\232\371[7\266"
+	.string	"\366\355Y\274\311\237c\017O\330\251o\300F\026\361c[\234sT\276\205\267\201\247\231\203\202\314\357\300\244Gzf\200O\202\362\247\237\0058z$\250n\374s\364S\210\177o\206"
+	.ascii	"\276O\327\021\035c\257-\032=\200\357\242'z\243\3576\316\302\027"
+	.ascii	"\275\337Q\373\363$z\027\374\322B\266\220\251\333\243\210L~\326"
+	.ascii	"O={k\007\315\033\033\307\032\217\034L\026\351\370(\366\261?w"
+	.ascii	"\001\020\317J\3419U\227\337z\315\366\271\033\242\306\227V\370"
+	.ascii	"\254\267\221\365J\300Nzi\373\353\356\241\327'\007\223:\311o\277"
+	.ascii	"n*\277\303t\363\371\245\233O,m\304%\361G\341\323\031\375\f\263"
+	.ascii	"\216\024\374\255\b\205+\f\275\367\2562\352\324\231q\271\245j"
+	.ascii	"\245\302O\210\301\246\260Yp]~\205o?m\034\332\033*}\357\275\351"
+	.ascii	"\317\335\350k\030\353\362K\344\241i\275n\2727RzK\027A\337\334"
+	.ascii	"\255Y~G\207>\350\227\377{m\235\320\017\335\261\243%\364\255%"
+	.ascii	"\311\037\320\007}G\365b\027{\357\275\342Vl:[\0326lX[\005\372"
+	.ascii	")\304\277W~\267\213\310O\376\357\251\375\341\222\370\303\357"
+	.ascii	"\275g\317\036V\344\227\310{\223\346|\230\271C\307\361\300\336"
+	.ascii	"\233V\305\235\330p>\200\b\341\275\026bm\025\371L\210=\260\276"
+	.ascii	"\361\330g\026\201\025^(\276\274R\027b*\236\275\244Xx\221q\201"
+	.ascii	"9\303\304\300\300\304\272\224\310\300\270~Lll\314\204Z\026\366"
+	.ascii	"\305\002\311\020\252\254N<(qE%"
+	.string	"\205\364\202\204\013\2562\022,\304\272\220\334%\025&\366E\306\205\342\253\005W\230\223\314\013\305\227\212\023\316\260/.0g\327\030\013\247\024\001\026[ab\314I&&6\346TB\237\235\336?\302l\"\224\302\347\243\021E\b\002w\365\021\254\376\352\231{UO\365V\277\236\221\372\252?\036>=\325\247~\234<\370\341\303\301?h\360\016\236\031u>\3247\370UP\352\235Q/\365\3073\255\342\016\267\250\267B\374{z(\006\377\364\351\235V\321\331\\\007\203?\220\344\357\211\205\360\356Y\274K!\b\337\204A\312\317\3606\230\027D9\216\033\n~\301\177\234\004\257\340\225\342\264v\b\376\300'\370\343^\033\207\326|\004\317\214\266v\003\376\300\253qZ;\264!\006j\320\260\340\364\006\376\017[4Oo\004\303\306\t\237\002\357\364J\207\255]\323\023\370\002\177\214\266u\022\276\371M\337\255\035\3237?\311O\253\210\365\003\236"
+	.ascii	"\200\037\360\352a\253\030\204\351gx\232\200gZz\245\027\220\341"
+	.ascii	"\227\224\310\214\021\003\035\322z\b\204B\203@\030\236S%\363{"
+	.ascii	"0\271\365ZZ\204e\310\214\351\346SL\340\333\240V\020\206\346\236"
+	.ascii	"f>\006 =\315t9\246\362\347\006\255l}\007\201'\250qD%\215BC#\""
+	.ascii	"\222\244$Ik\301\005\304 \005\241\331\006\021\360\244\204\fM\315"
+	.ascii	"HAARgX\003X\203'{\244[\220\216\262\264[\374\223(C\236\372C`F"
+	.ascii	"BH\371b\375"
+	.string	":bq|4$T\352\350\376i\252\304\300e\260\233\017\022\332$\375\213S\202\0222\235\311\300\225\225\315$0\352\024\317l\036\322!*5\034\340\023\3458\235\032\300c\312\336\206\332\222\034\372`\202W]\206f\322\366{y$\357\372\r\027\270\357uQ\224\364i\362m\b|?\330~$\022\ra\243\223#\210\021\377\224\350\0255\\i\323,F5\215k\bUF\242\266\317\307\233\310X\300\013\2772i\3715=\203PI\\4\024\034\033\330\006\214\f\272%9l\275\302\030\022>\024\253z\245\233\266,}g \371\272;\200\343\311V\331\255\214b\277\210\364h|\253\310\254\373\323\270\200\\\t\341\2731\002\205\262~~\275VIc.`\001\321V\364G\301\311E'W\2549\366W,\355\333\3626Sq\307F\222a8\021\201\035?+\337t_,&\262\273\256\346\033B\214\\Mf\036\215\223\006(\204-\"lb\235"
+	.string	"\303\2040\341J\202\301'\334\215W\227;\363ba\344\311\267\300e\317\020\257\rM<\244\005\236\3651\335\344\256\272N\323\025\265>!1\006\243\201>mDb$\266\322\361\r\250\372\342\031\002G\343\234i\366\242\226 \207\312\320@.r\036\241\177*o\262\307\215\2277\361\343\021\245K9\311\251"
+	.ascii	"\343u\225\277`*\017\211\252.\215\273A\006\374u\032\2335;o\f\035"
+	.ascii	"?\342#\211\337\311\231i\006\033'*\301@\375lY<\230lX\211\307\243"
+	.ascii	"\214\361\024\310\004\267\005i\337\233\252Q\257\257\336\245\355"
+	.ascii	"\036\231g3\362\3659Et\023\210( %C\376#\3557f\021\377!-\232\217"
+	.string	"\036\264\"\202\240n\230\300G\332"
+	.ascii	"|\005/\300hU\312vh0g\364\316fT\315\033\345\357\017"
+	.text
+	.section	.gnu.lto_updateGpsWaypointsAndMode.126.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\304\n\3351"
+	.string	"\nO\244\021F`\\N:w\343R\241\264@n\362\242,[\361)\352\262?0f\233\211\357\210\024\3145\306\263\306\366\301\036_\274\032\354\026\212\f\256\314\242\207\013w\372\031n\364\253\335\341\245\351p\276c\333\321\266\266\215\020\262e\222\001\374"
+	.string	"\364"
+	.string	"\016\001?j31m\366ys\217\332<L\233\205is\360\315\300\264\371\2276\257oVosz\233\017A\300\035\2665V\320\322\3346\3166+\312\327\312\251^\314\272\257\366f\376\233<\024\220E\002\003\007\354\325h\034U9\333\254\325HY\236Z^\333:\225\2562\023\360*\263\314uw\216\265"
+	.ascii	"\320\340\260\256\344\265m{\274I\316\276\210h\310(\024\004T\374"
+	.ascii	"!\372\364\f\205A\340oU\323\333,\377g!\250\324\252z\221\331\211"
+	.ascii	"\314\232\364P\223\033\315\230\264P\331\203\316\226e\320\245\222"
+	.ascii	"\006\022j\005y\361I\262\377\200\2155\321\007\354lI\244{\276\316"
+	.ascii	"\226Cz\370\345\325B$\261\036B\036\024\362\346\221\316\226]\r"
+	.ascii	"l\262\377\202|%\263\321*\327P\253F\247i\0029oxCYM\224C\255\253"
+	.ascii	"\276\320\345\222\364\250m\3337\3379\264\254\272\177\026\332\266"
+	.ascii	"\345Vj\3658\0038\363\303\230\371\003s\260-G\036X\360A\213\272"
+	.ascii	"x\020+s\b\021}%\037u\333\233=\237<\2578k\322\252\024\024c\243"
+	.ascii	"+>i]\257\222\226o\031A\242D\211\365\352z\017|\356\215\235\004"
+	.ascii	"_h|\250\227\271v\365J\261\271)\266\360N+\363\211\247\276R\275"
+	.ascii	"\023\302\256n\025\277\355\r\035(\203iF\031K/\223\323#\327\364"
+	.ascii	"\266\022\2664\314*\216\005\tl\333\366\001\377\312\237P|&W\231"
+	.ascii	"\205\013\027\353\325\364.\321"
+	.string	"\255%;\372\337\023X\003\3347\017\204\262\271\271j<\334'\260\376\006\270\334X\\V\035e\276\363T\220|&\fc\252\257\274\312\237Z\257\376\022\321q%;\312+\\X\336]\373\204kOc\275\332\357R\317I\262\367\270m\234\311\323\273k{\217\331i\325\227\311\374\033\215F\243|\2170\247\315Ji3\202\264\031)m6\272\315\001\214W;\013\245\315Ao\006J\233\213jsx\232\n\314\351a(\242!\335\242\2743\362;MLs\3142\217\307&Q0w\325\016\3612\321\255\231\371r\346\020sue\032\311\231\030\037\004gltGOZ}.\2029>7\351\313\312\267\003\257\247\347v\237R\017/3\273\204-\353+{\256\360\016\357\032\006\253/\331Q\263\327\261O\200m{\365\200\017\347qX(,\032\233\226\266^\025^\bj\340\302\276\232\303\313\344\327I\353\302r\013\036z\024hqXn\300\257]\350\346"
+	.ascii	"\336\213\r\201\027D\363\347\361\264\323\352\335\t]\013I!\364"
+	.ascii	"P\270\215\223\277\235\331C\035X\3602\335\216t.\377]$6\277{\200"
+	.ascii	"\214\213\370\234\343\324\273\003\n\220\223f\346w\2313\302\222"
+	.ascii	"mu[\320\366\254\224\225\037w9V\n;\205m\366\225ls\275J`\254N\324"
+	.ascii	"\362\250\277v\270\245\243i\242p\346k/s\3018\327\266\311+\231"
+	.ascii	"Y\301\3114-\215\265m\033A\314\307`\310\240A\303z\225y\003\207"
+	.ascii	"\032}\001\334\340\001\204\024\fLDp\300D$\003\331!\206S\007\252"
+	.ascii	"\247\251'\251!\237`\212BBQ9\251\200\212\341\024u\244Z\241\002"
+	.ascii	"\252E\212c\024\224\223\213\343\t\251\251#"
+	.string	"\223\021#_<I\035\251\220H\251\343\320\231|\332\336#7\354\342\344\222\327\2129m\333\266-\212\320\314\254\026\273e\325fw&\215\354\207\222\310xM\210\r\t\237y\234oaEk_\220j\237\263\233\002\375\016e\024<\243\021\360\216\315\315\202'\255A\327\250\275\202\256\021Y\317s/lI\025,c\204\272\276\0344\361l\220\225\231\355b\275\372J>\322\223\323\273\013J\177\204\356\353\244\341\300r\373\035z\343\315\001\304\355\243\177\320\230\301\022!\262^\005\272D:\035O\275.F \273\255\271\367@.=D\207ot@\212\227\371\001H\234I~\202gw/\336`g\025o\222\361y\307\200\030\227/\342\267\350\274u\030\311i\345\005\242\306\321T\341F\333\270@\244\240k4\035\373*\356g\251\253\272\005{_\036\276\237\313D\007\007%\336\200\353\250\221,\007\035C$#\"\005II\222\016\260\002\021\021\252\352\006\021"
+	.string	"\245sN\025\321\246R\230\306\331T\025\252\020(m|\240\371\230\203\323\001n\362\370\270\260\024\025\236X*W\206\251B\336"
+	.ascii	"\b\242\030\004\257\322%\b\340B\363\324\343\200\027s>\214\320"
+	.ascii	"\234i\272\244!0\177]\f\373 Lj\307\227-\340\325\255\3615\2501"
+	.ascii	"5\341'x\354\016\026\275L\201\265>f#\241\255\234\333b\211Z\362"
+	.ascii	"\017\206\002\3121\314W\037\254J\017\241\216\246e?\317\365\305"
+	.ascii	"\2709\030)\373\031n\013\324(\220\2421\bzp\376\315\213\356\177"
+	.ascii	"9\267h\277\261\330\rraY\344M\006\245\035T\267_\316\216%m\352"
+	.ascii	"xq\334\313\367\324\021\\3`\306\222\237\256\303\261w8^\226H\302"
+	.ascii	"\321\324\210c\300\232\201\r1\320eo\354\246\311\376\266\355\363"
+	.ascii	"4_\317Bj_\303\b\220\251\340\031?\311:\322czwO\331\375\354\371"
+	.ascii	"\fP\334#\261\371\203\f\370\360\264\344\251#<]&mg30C\216\326P"
+	.ascii	"\303\220\267\032\271\353\362X\322\203\036\006\262\355gu\302Z"
+	.ascii	"\352\261\330\316\243\2618p\243l\227l\303\007^Rb\3328\370\372"
+	.ascii	"/-:~a\303g\034\276\256<\243@\302\020+\327l\274\250\025\327n\230"
+	.ascii	"\232\216\204\201\257=x\335\204\326\212}\251cgp\340\001\373E\033"
+	.ascii	"\252\310>\267\317eA\037\201\3047\035\273#\242$\210_Y\267X\200"
+	.ascii	"X\306\004\024\300\233\251\371t\217\032\321Wt\245C\226\322\301"
+	.ascii	"\025'\233S\364\"\2757\001\033\3443\232\020\005c\307=\260\352"
+	.ascii	"p\035E:\373\026\035\270O\021,eJ\324,\271`\230\226\nl\250j\037"
+	.ascii	"\266\034\321)K\213\321\350\314\221\356\177"
+	.text
+	.section	.gnu.lto_last_coord.2.138.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_speed_old.1.139.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.166.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\321\002\245\023"
+	.string	"&c{H\260TN:\330\317\037\034.i#6\324\240\374\337\0161dIB\351\031\362\026)+\303\205\367\224FF\264\370\2336S\271\315\217~\b\307\223\317;\320\375\220\373\265\207-j9%\311\223\277\316\337|\342\237\271\b\"{\313\235R^"
+	.string	"c"
+	.string	"p"
+	.string	"\366\223\374\027G\262\035F\350\355\004yO&\206\262j\rBpj\230wZ\340\003\272\323\371"
+	.string	"\335\351\375[\315n\3717\233\335:}\013\333\265 \333l!G2\252w\372\361\031\211\324Z\277\323-q\333WN\233/\n\355|\177\273\024\205<\\\272>I \324Z\355}\270\351m\247\330n\2617B\027O}\233\356F&/zV\020\273cW\n\027\2123\375?8\021VU\026\221[\344\235\237u\211l\022\351\256\223\246\235\364\244\322;\245\345\224>"
+	.string	"\001\007B\324\n\2243RGP\334\211/\375\343\245}\177\274\013\177\351Ln\271V{M\241|\374\315O\272\322\253\206R\f\035'\240\254Z\243V\274\323W\025JV-\376\221'\270\270\210C\344\356\356\225\317\021\373\270N\367\225\373\016,zd\316k"
+	.ascii	"\310\020\217\314\331\245\302D\276\351K0L\024\2747}G\202\353\b"
+	.ascii	"\317#\007\016\237\374Fx(\025\252\333\250`\341E^|\351\246.\034"
+	.ascii	"\027:\300\222\232i\200\025\365\246C\301\224`\325\312"
+	.string	"s\321\216\235F\bs\314g\314\234\030\325ZS\236.\243\306?:5h#\003\264\034PfZA\n\003\032\024\f*\013`&3Pf\035\003\303\221\201\264X\r\310!\206\363\3212\324\200\032h>\0340v\363\305\314r>\030\001\3136\314\314>\232L6\373Z\266\345g]\"\377v\017'U\305\263=\336\335\"\333\341\2503k%\361 +I\346\334\255\177\365\037\022VXX\350v\273AL\325\315\245\343g\tn\305\372=\036= \300\002\251\232\332\006X\307Pi2\214\266\237\200\3032\256\\\026\231\354\263hf\330\220R \212\233\236\270r;\276f\311\242\310\332i\321\227\001\277\265\016\261f\234:\254\330\310X\036O\326qr\347\326\332\265%\177F\263\006\272\354\r\357\234\215\365\2246\360\263\325\336%/%\n>\327'\272a\246p\001\324!\\p\303\033\nF}\25097K\340\260J\021fa\364\001\332S\366\030"
+	.ascii	"m\317A\035n\347\ty\f"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.part.0.168.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`{\003\345\027"
+	.string	"Fk\226I\260RRc\350yj\325\212\364\272L"
+	.string	"\006\177\025\036AT\241J\244\037|qu\344\205\262%\n0\0023\264.G(d\023@\374\0355\307\337-\3127\034\236\017\341k\177\256V\367?\224Bte\376am\266\311\226[\312\224\002w"
+	.string	"|"
+	.string	"\207"
+	.ascii	"\364ON\276\003\2318@\370\360\272\367\252\334\372\201y\3537\355"
+	.ascii	"\370L\266\342\212}&_\351K;ga*\233\317\322=j\351\302Z\201r\353"
+	.ascii	"\233yk\273\200\362\226|\200\362\366>\361g\327|\"\320\256\335"
+	.ascii	"\036\311\366\017\310@\273\353KF\367R\306\237'\261{\357y[M\034"
+	.ascii	"\370JI\240\177\342g\303 \236WZ\220\210S\222\2232\006\367^\233"
+	.ascii	"B\267\275m\026\3332v5\006\267\3248\374\262i\376\302wb\333\334"
+	.ascii	"\205\316\300\326\275\267\245\305\2458\370G\267\306\331\321\017"
+	.ascii	"w\365\204+)H\217\036\251\n\222u\351\030\255E\256\344\311[\211"
+	.ascii	"l\0315MF=+\251\315\222Zf\251\313\027ok\251IK]IjJR\237\004\345"
+	.ascii	"\b\240\304\275!\216D\356\220\225q\342\305\337\276\337\364\242"
+	.ascii	"\037\345\232\177;O\362\241\352\210\")\356\275\277;\371\310\033"
+	.ascii	"u\311#\035[6\244\225\032\\I\003\204d\335?\375\304\233ZJCC\274"
+	.ascii	"\312\352\347\370\225\251\374#O\360\224\247\302\206_%\324V\277"
+	.ascii	"X\301\002\375\260\254\036\206|*\217\251\225U\226\255/\232\352"
+	.ascii	"@\274\204\356\365\202\343\021\312\347\336 \002\262\332\372+!"
+	.ascii	"\212\036zt"
+	.string	"\255d-\265\204b\265Vj\024z=\3524\253\033P7\303\256\206\206\200\375\351\266 \035\363HU\030U\271\215\252\013\257Ac\006\005{\265\235\362\030\276\022\027\237\35200\340r\364\303\\\031=\334M\365J\213\202\232\004\031\\Xn&:\032p<\322\271[\316N\327\303\331\350>\340r\316\336\006\033\335M\315\231\243\303\341\2349\236\316y;\340]\007\032\336\331\333\355xg\3156=y+\221)\034\261\202\265\307\365d\255E\266i\365\307_\240\234UZ\375\217\320\267\316\005$\002\225^^\312\333Y5\341\"1fV_\353=b\032\300\300\f\277h'P\312\252Y\253Q\250\242\307\301\263bN\b\347!\223b\264\343X\021$\314\314\224\267\262z\006H\250Q(\245\220RJ!!\2320\212\245\205\003\200\002\241)\244\007\021\240-\204\2104j;i\224\326O?\362\201H\235\260=p\211:%\027DPo\350bG\216"
+	.string	"\231\307\367=\331h\247|#\247\b\232#\261\251\205\007\245\246\226\023U\023/\244D\350\300\307XE\347?\212\017\244\200\267/\2770\313\370\2727\351\234\370w,\025\224\270/\271\302\274\314\222\373\262\375\203F\274\216\227%\274\355\233l\206\363\206U\374"
+	.string	"|#\002\3058W\224\304\020ZC|\253\371J\2575\271\235"
+	.ascii	"b\024t\254\235W??"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.175.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`c\034\355~"
+	.ascii	"Z\304\224+L \222\322\351\333\346\344\034q(w\35045\321Z\3705\317"
+	.ascii	"\231$\360\351N!j\314q\363\362\337\r-\263\344'\302<\002\346f!"
+	.ascii	"\277.fv\030\210\301\001\250\252\225o&\201\277\277\227\257\b\237"
+	.ascii	"U\276JGX\204\221\271\265\332m\247\224R\246\002s\002\252\002*"
+	.ascii	"\262\330\252\241\317\037,\246NM\354.\335x\31527w\231.\254J\323"
+	.ascii	"\202\355CO\177\310\034!\341\2323\3025Po<\006\325\214\r\252iR"
+	.ascii	"\366V \240\013\201\200T\277\343&\223\214\340c\372\235P\324\321"
+	.ascii	"h\250\242\224;\256\212\345\210\371\264\343\335\003\267\231>S"
+	.ascii	"\325h\250\206\240\027\210\320\033\323\017J\002\264\330\307\265"
+	.ascii	"LU\t\263\037\300\264\237\215\276\343\016\323c\210Q/\204:\272"
+	.ascii	"\317J\275`\367\315\354\211a\024*lt\237\325\320\335\002\034\241"
+	.ascii	"\244*\362I\257\324\373\274\252\2178-EtO\2547\237\215\226^9\364"
+	.ascii	"6\211\224\210\345A7(\202\261\301\034\230\205\301\321w\034\203"
+	.ascii	"\033K\353\241\320;p{\271\261\313\273\367v\341\302b\352W\244\366"
+	.ascii	"D\364\356\202BsA\252\320\373e\344#\323\302\306\324D\306\240\330"
+	.ascii	"x\334y\254#\253\357\370\177\234\261\211\261\335{\355\242:\232"
+	.ascii	"\356\212\233\367B\245<\265]\335Z\035\267\226\336\3226\335UR\022"
+	.ascii	"z\233\027p\271\302Fx/\224F\261\211>\336\307u.\213[\016\351P."
+	.ascii	"\253\263 [L\t\331\be\024\261\240\300\f\327n\334q\234\303:8\211"
+	.ascii	"\013z\277\232J3<5\\\267q_Qb\362\304\334W\270\253\264\225\266"
+	.ascii	"s\340hq\253Y\314\001N\2074\367\336\023M\344\246b\023\223\032"
+	.ascii	"hm\242\332\307\365\206~S\241\335\370\205|\271A\005\346\206\256"
+	.ascii	"\320n\214\201\225\032\356\275Me\005\034\3566\035\3149\334m-s"
+	.ascii	"N\023{\n3\353hr\313\214\246\241\317\333pe^U\b\357\275NM\374\031"
+	.ascii	"\330[\2056\353x\333GFE\"\210B\f\t\005\001\375\034\215 |zxvtr"
+	.ascii	"X\234\342\315JT\337\221Z\356\255>2r+\022\3016\305\211\330:\304"
+	.ascii	"\232\236\024\037\252\241\315\205\232tP\0235\351\314\201\314\372"
+	.ascii	"\307LM\362c\342\307hK-9\003\034\003\342\326\306%=\326,[\201\312"
+	.ascii	"\242KXi\254\351\366 \242\255$m\272\265\221\271O\317\263yT\023"
+	.ascii	"i\266\370\320\322\346\021\025\350\307\031\263\241\255\224\326"
+	.ascii	"\024\363\035\025\250,\315IK\233FT\023\321,sJ\327\221\001\b\f"
+	.ascii	"\235\243\304\336D\215\001y\241qZ\332,\322i\3150/&\2455\301\374"
+	.ascii	"F5!\346EHK\233/\250@`\224\230\351\270\366\036_^\276:\363\313"
+	.ascii	"\205&\262_.\264\252\022P\230\206\216\347\253K\025\352\372q\226"
+	.ascii	"\363\305\345\337qm\002K\036\333t\f\b\f\355\306F\272\211\272\367"
+	.ascii	"r'"
+	.string	"\2514'5\263\313`f4f\242\016\002\257\363F1\345\024\235_\202,*k\311\200\310\210}\314\300\244\024\237\357y\020\377\203K4\345\t>\0032\205\f-\031S\f\356l\227\230\265M\232\254M\364\371\024\177tc\310b\022'=/\364G\227\214\302s\344\n\350i\304\305\332'jm\224(\353\316\363\374g\221k\352\374\316\207\210.\327r\036\347u\304V0R\307~\316\337\f.\323\236\260aH 0)\037\225\232]\234g\237\250\267\\\323\251{\001\347\231\031\313\207 \177\374\356\275,\330\203\270\220vJ\333\326Ri\251\254M,*\\\337\311/\374\013\3318\3705\245\\\370\375(>\324_s\231\002\245\t\021\206\263\200L\301\354\200\373\220jz\336{\241\232\310\316\364\0361\270\2314\221gLM\255M\274y\034\267o.\004\204\022\247\256\377P\336\376\270\274\220u\352\302\244\337\036ebf\372\357d\346\023\335p\255"
+	.string	"\222\244\263\341\216kUm\314\353\210\020\177G3\003\325'\276\017\022\233\243\353\277\372\3046K:\245\037\362R\373\377\367RL\371\376\355e\310\316\345]4\270\2310\005\026x3-X\233\330\317D\006\226\364C\356\266f\353\206H\257\263\361w\362#u\227\325\005\331\301\037\003\363\217s\005\2543\005\023\320\350.\315\0224^\363\024\353\034\001\353<\303\350,\303\350\034\303\307\031\202\037g)\326\371\001\326\331\201\036\347\006Xg\030\f\3748\277"
+	.string	"r\216\002r^"
+	.string	"\310\331\005\353\254\300\3219\201\2433\002\254s\213\037\347\003Xg\026+\214\316PFg\025F\347\024F\347'\037g\024 \234\r`\235\013`\235\235X\347&\326\231\351\350\274tt>qt6\301:\227`\235\t`\235I\3708\017\340\343,@\217s"
+	.string	"=\316"
+	.ascii	"\034\235G\034\235\225\214\316IGg\244\243\363\221\321\331\310"
+	.ascii	"\350\\dt\026A\304:\207`\235\207|\234\205@8\007\261\316@\254\363"
+	.ascii	"\017\353|d\235\215\2543\b\326\331\207u\356\361q\346a\235wXg\035"
+	.ascii	"\3269\207ufYg\034\326\271\310:\3374\\\363\332\343Ld\235U\326"
+	.ascii	"\371Yg\357qn\344\2112=b\367\3768\374\341\"!\3225i\270n\273n\276"
+	.ascii	"\336\342.\325\007_9\364\331d\225\210\345y\323\220A\210R\356\350"
+	.ascii	"R\261\340`\020\206\240O \354\332\016L\272\037\270\353\315\304"
+	.ascii	"qAO\240\b\005|\027\312\200\334q\236\031d\006:}\323\027\360\257"
+	.ascii	"\304\351?I\323{\225\036E\244\200L\337\205G\220;\317\027\323:"
+	.ascii	"\263\364L\337\203\313\275\023o\342\227\276\227i\017\003\317\365"
+	.ascii	"\300r'>\005\031X\2117\361^e\231\206\200'\361%^\355[\242}\330"
+	.ascii	"\027A\316("
+	.string	"\022\360\352`\217\"\311w\341\211 \327\250$\376\253\364(R\330\375\224~\221\336iw\013V\206h\231\n^!/>\b\262\357\374\200H\265\235\337\027\341\217o\001\331V\236\317\202T\343\360|\037\203L\246\347\201\204\332\021\330I\311\273_~\027r\351\271z\br\223\362\276\373$U\361\336\344\375-\244 \025\325j\330\206\025\035\316\333\264C\006\33306\205\310\306\233\256\361\001\331Y\236\203ZkZ*\202\201H\027~\200R\t\370\245\351;GC\245\343wo\262\231g\220f\244\226\312\260\326T\213\215z\303~\213;\332\355\343\256\r\004\211u\200\357\266\002\232\304*\300\017 \346J\253M\313C\200o\372\003\243\201\265\016\223\356\216\370\274\263\335Z\331\301\270\264\335R\266]]~m\334W+\273\236\357]y\265<x\254M<z\252\241\233\022X\246fJO\013\347\206\266,\264?\274\231\374\277\305\337,\236br<Fk"
+	.string	"\337\320.J\337\332h\005\340\003xv/0e\036\215/\013"
+	.ascii	"\370\240?\260$\264Y:#9@\302\370\356\302F\374\235+\375\210\357"
+	.ascii	"\245\232:\245_\372\003K\336\rI\372-\256\307\fL\362\273/)\322"
+	.ascii	"\263gq9\236\013\302r,\2477\327J\036/\360p\231\0278<D\303uo\022"
+	.ascii	"\200\243GJ3\372\243\3573\3134E/\342\215\276\227hJ8\217k\207\020"
+	.ascii	"i\303\302\036\211\f\f\2053\267F\332#\336L\021\277\001\022\345"
+	.ascii	"o\035\356\274\223q\310\344\020\375\223\361\036\274>\f2\\^\310"
+	.ascii	"fl\375\250\244z\357\275:D\337p\235\264\324\353\023\221\bB\244"
+	.ascii	"0'\304W\301\341\215\311m\200\206\330A\200\2570_\354\320\273!"
+	.ascii	"\221\374\332\244\214\374\330\324\276%_C\026\245\f\275\n2\272"
+	.ascii	"\240\272\350O\340%\303\351\264\237\272\272\026\3120k\305w\362"
+	.ascii	"M\230\276Z\205\276\307\336\364\376\320\260\257V\236\027z\365"
+	.ascii	"\314R\214\247n"
+	.ascii	"\213\032\257+jn\336\311N,\376\253\205\311\2517\217\363=\230\333"
+	.ascii	"$k\320c\261?q\032\332$\255\222\326\351\\\233\030\364Bd`I*@N\220"
+	.ascii	"Ah3\364\375<\320w\\\007\265a\006&\217\377\363\354K4_\266\361"
+	.ascii	"\217\277\352-\327\332\214\177\206\024\3623\003\021<B\325\215"
+	.ascii	",\023\252n\252n\344\250Q\202\0079\250\252\260j\344`Q\300QB\226"
+	.ascii	"\007\036\244P\303\006\016\026\016,,*b\bTT&d\021M\260A\225C\345"
+	.ascii	"'\250\025\"\240\370\200\205\212\246\240,\253\024j\250\fB\323"
+	.ascii	"\r\034V9jTY\235P\343\206S\216\021\252\254J\020\301\351\206U\r"
+	.ascii	"\033N `e95!1\016\023\250\260\234r\340\300\201\345\224\323\037"
+	.ascii	"\003\277\222\277\2549j\313\3330\217*\370\242\327n\351\320vU\360"
+	.ascii	"Gj\322\037\274'\322\253\326]\214\236j\222~8\345N\003y\230^vF"
+	.ascii	"\357|\240\316\007\0214\236U\242\251o\275.\376\240f\304k.\204"
+	.string	"\004?\001r\245\340u\322\336\366\332\244P\360jtI\270\027\305\313\353\"\340\340\026\351\004E4<\f\t\r*\316d\311T\204\226 \232\027\037\233\"j\223\340\243t\210\341a\352%\370n\243\346\341\001\206x\247\017-\215\\\247ZO\212\227n!\313:$S\301.\235\224\334\253\233\372\306\353\244\b~\306O}G\227hJ\273,T\021\320\315x\243\277#-y\315\356Q\271\353\"\240\240\226\251\340\320;Y\306\307\370\302\345\205Zd@\3601\276\347^N\213/\013\004e\316\330\366x\360\216H\257\220\224\016[\036x\251\3773a\034\370\007\276\227k\312+\310:*\007\236\351\017,\b\217\210\324)\345N\003\203\336\211\303D\215\207\327\334O\324\263z\\\361\f|\017\326\302[\033\370\036\213~\025-<\034\032\320\301\354\207?C\251\005\016\343\231\265\272h\351q\375\0263\3600\220Q\240\323@;1|8jQ\232d\2100"
+	.ascii	"\024\245A\220\027oC\324\277X\340]|\324\001\277\200\002\357\342"
+	.ascii	"\277\317\3130\201W\340\277\315r\357\n\017\002\237\200\033\002"
+	.ascii	"\337DF\346\013\307I\023\351\317\263\370\017\336\366\016\370\026"
+	.ascii	"`\236\255\335\372\322v\035\3608`P\317\242\237c\016\245+\240~"
+	.ascii	"\305\273\236\212O\361P(^\305\017\365y\031&\237>\305\367\322\360"
+	.ascii	"\327\236>\305\037\330\2251_\244~\315Zi\343a\0328\246[\210\225"
+	.ascii	"6\264\251`[\255-\246\335\3310\212o>\326\002\363Q\264\370\212"
+	.ascii	"\367rA\361\253=\024\255\2761Z\177Z\177k\023Q|G\333\r\315\302"
+	.ascii	"\210\265\271%\215\214}\351\0262\2306\304)x\235M\006\201h\315"
+	.ascii	"Q\307 /ex\356\272\230u\320\035\017[\336\206\277\215\322/U\214"
+	.ascii	"\357|'\374i\214\206\350\005\314\321\316\330\2410\232\242Y\361"
+	.ascii	"y\233\305\t.\227<\266\032~\t3\243i\"\024\203\341\336\255\026"
+	.ascii	"c\3762g\336\022I\\n\370O\003\036\307Nz\351\244\227p\260\223\222"
+	.ascii	"=tG\273\330\367$\3154M\202\235\250\"\t9\217\242N!\241\031\021"
+	.ascii	"iA\222t\322\n\020\210cy\036\266\324\003\022`\3445\316BF$\232"
+	.ascii	"\244\240R\3308\206\240\256\2216\016\210/B\214a4\261\261\004\300"
+	.ascii	"o\341;| \220\235\t+9\341bB\231^\312\2107\037\307;\222\244l1\270"
+	.ascii	"J\305J\314\246\277\0166\331,\201<\342\261:\002\371\320\204\304"
+	.ascii	"\2170\253=(\263\272\226~\220\2620\224Z\025\t!\252\031QB\022I"
+	.ascii	"\322\f-f\263\016\3728g\221t\250n\233\343\021\314\232\002\311"
+	.ascii	"\335x\232\232\201o$\375d\2504\263\001\366\027\006\307\300\311"
+	.ascii	"\377\352~\335\252\347\206\023\335\203Qv\266\352;qd8\022Vi\252"
+	.ascii	"\230\244\262"
+	.string	"jEB\3677q\231\223,6J\263\205\366>2Eh\256(I\302*\023Dp!\373\345\345D\241\365\316\235\255\005\035\226{\263\357\200\362\231\326;f\276\243\301U\003\267\301\335Y8}#J&\344 \265\006O\312\257\204\214\273\013k'\022\311 \231y\007\325\336@\370zh\232I\023\202\241^\030\201\034#\207\2110\002\317\312\226`\355\003Y\340\367\021\n\023\327\371\265\356\336\002\037\331\276\026\202\035\230\376\007\2771\rtA\346\237\017\351\307(Qe\34298s:r\331@T\232\355wg\364\313\"\363\3020\366\214\223\247\255-q\271\350\363\002\240\315\023\245\322\367^\306\035F\270\2001mM\025\334\250\243\2558TV\020\260\275[\310\016p\366\224\216\001\314\311\024r\270\224\357\256\273\202fc\325\205\373\313B\2203\353\330\370u\364\276@P\263@Q\232\2526[Z\244\3432\260\245\235/\236\334<\327f\020^\375\371"
+	.string	"\301!\326\366\353\211\027\244,\032\246\n\254\251\340Ib\006N\223\304\177\3730D\021,\275\277\221_\204\235\251h\252\217\005W\022nI.s\205\020xok\2109\"5+\201\301\367\016K\037a4\204g%\336\033VB\245(\335x\256\226\225\255\322\373\357; \262\230\002\307\220\332\275\265\225"
+	.string	"^\257le\271C\257\n\370if\032\353#U\353?\347\372\256r\250\243\020\335%\242tL\246\266\017\355\362\367}\265\267\r\355\365y\240\256\256\007\322\301,\224\343j\023\364\251sR\215\230\020\370\332J\027H\354\013B\354g\364\371\230q*\243\021\260\f\021^\220 |\3256\023\235\337O\251lXh\2003\2149Z\220}\0234\264wd*\003\314I9?\345nH\fPFg\202SQ\324Y\301\032.\234C\367~\303\271\030\b\342\b\352\013\205\276)o5\356s\354\006\220\226FA\201O\211\3513Z\212\023\013\247D\337D\347\341X52\235,D\037\"\345\214\344(e$\272LvO\317\030S\352\260\303\f\202\307\311\221\227\247O\371\274\202\233f\017\353\244\273\337\\\236\241tN\262P\372O\346C"
+	.string	"\034V\244TH\263\224\347+\002\350X\005\316w|\005\233<\317d\2238\233\360\356\320S\354\367\211\037Q\335.\355\207.\274,\322\322l\222\276xrA\021&\313I\333M(\245\276\300\243\321\211K\367R!*,\353\273\017\330\353\202K\354Q(\274;6\377\205\212\321_\003c]QA\342\r;H5m\242\356Ge7\370\004bb\202qq\300\317\204e\036\375\2228\013\353\231\224\272\357+RB\255\333\305\236m\201\207\364\264]\225\222?!W\366P7\301\001f7\342\316w\207\th\221ZgNO\243\\odH\217}K0\311\272\276\017\351\265\f\337\342^\030'^\t}z\251\026\346\n#\201c\021\304\352\366\340u 9\270\"3;\334\005\306\241\336?~\013\257A\235:/\203\257\r\244\016\261\303m\355\024"
+	.string	"\235\034\354\301\220\027\005\234Y\206H\223\035\032\201w\245\017R\\\332\236;I\271{\005H\322\350\342\270U\254+\345G\361J\302\002\301Y@\367J\224\037\317\275ScL\376\325,\277K\231)\371\214\320\007\036\343\335\177\204\232\250S\020\301\343\257b\360\206\025\242\177\330o\350\333\372\344bE\021\0133\031\222\260\006B\237F\360\2104p\021\234#\265\363\245\3015IY\255V\356 \275\300-\021\302\211V\027eY\302~\324\225\214\301$U\225@\312\004K\313/\322M#\342n{\223s`\213\017\365\256\203\336\315 \311\256\244\260\033D\226\304\006\367\311\316|\013\037\372\253e\275\231CRD\2253X\321~C\355d\211\034\313\300\255G\016t\210\351\r\367;\3633e:g\016"
+	.ascii	"\302\t\377W\2706\343x\375'\220\336\254\032\337h\350\r\227\016"
+	.ascii	"\311\013/\240Y\313\314\346\177T\022\364\025\0271M\274N\tHsrp"
+	.ascii	"\324,\213\232\317\b2\030\205\027\031Tp`C\263\r\005\030\364\263"
+	.ascii	"]\275\223\214\250\016\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\220\005\365\030"
+	.string	"\206\247\222GpZN:\203\004\221\332\210xdg\005s\213\334\275,'\345\345\243\013\022J1\303\302;\371W;\312\020H\022\353b\210m\245\013\310\266'\030"
+	.string	"\006\200\001/\211\f\344\302Z\236\303\364\016\350\313u\031\327*}\367\221D\246{"
+	.string	"~"
+	.string	"~"
+	.string	"\366G\0207\263?\366\234,U\325\365\303\345\256\323\303\251t\270gsr\270\230\r\327b\340\\4|nx\271n6\233\315\f\367mN\f\367h\316\013\177\263p4\373c\205!K\341n\023>E\302\343\206\316\026\341Y\370\353M\253\n\275_s\n\035\013\221\207@8\\\020[\331\377><|\004\372\025\333?\257\351\003\026bSUM\237\374\367g\313b"
+	.ascii	"i\232\246\016\356\323\234\377s\256\002\353\024\324\227O\254u"
+	.ascii	"\340eN\367q\316\032\367ph\334\237iz\3232\335\257-\335\337\235"
+	.ascii	"3\336\246\3644\031\037K\2727\203t_\346\210W\333Tso\270\214\356"
+	.ascii	"\355N5\205Rt"
+	.string	"O\346\214\301UDg\372|\213\205\301T\266\323\027\034\304\376\350\342j-\016\206\305\351V\334\213\212\327\331NS<\214\355\024\305\277\330NO\274\213\211\313L\316\022\234\332NI|\314\b&\"\342\262\327\371c\210\237\005\\l\276a_5\300\260\331\211\222\177L\2711\340\260y\253\231\260Y\365\005\233\227,\003\266\316\362f\300f\344\017\330GIf/7wm/\373\365Nr\314\327<\272\223\371\372\307\345\">.\037\351q9\213\307\345\255\035\227\215H]\236\322q\371*\307e,\034\227UN\323\364\357\271q\031\b\033_D`\177\214\272\024\373KE\031\213KJ6\256\264\177\221\261\b\311\230TL\212\"R\202Rp\016/\252\314aK\220X5@\333i\351\2642cY\211\251aZ\231\347.\f\356ih\317\255.\211\220ID;H\307g\027\230\225\002kh\023X9\001W\334\326\257\247$\242\335[\321\320\346-Y"
+	.string	"\033%vWC;\207\356lh\353\b5/\313\204\272\247$6/Il#\240\240f&\277J\0241/!\203\336Q\016\177z\007\311\003\276\300\232\b\177\232\221\301\005\335\263<J\236\r\233)8\354&\346\260\237\220\f\344\025t\250A\f\303\363Z\005\"\244 i\351\320\002\241\032\262\003\021\340\024EG&\032\211\n\232v\027\221S\360\0179"
+	.ascii	"iv\b\304\334X\352!\030DP`\341H\030\033Eur\003\322c\005\244\f"
+	.ascii	"_(\326\333\205y\2057Bq\236q\347\304Y\362\227\260\225\314s\220"
+	.ascii	"\352FNG\257\327\323\351\323\277jr\022\030\273T@\230\003\337S"
+	.ascii	"\372\364\332\244\336\007nL\373)'#\364\022\343\r\276\363\362\306"
+	.ascii	"qE\254\234N\323\363}\334P}\037\007\326\024\363D\020e\377\261"
+	.ascii	"#\205\006TH\363Wj\203\324n\0174F\211\205L\225\231\b,\315\307"
+	.ascii	"`\255\031\366\250\030\2222\272\252[\002;\307\007\301y\346\303"
+	.ascii	"\246\366p \r(3\302G\364\377\223\346P\016Z\355\343\355\251\002"
+	.text
+	.section	.gnu.lto_.refs.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\007\003-\025"
+	.string	"\026u\221F\360\260(\303\001lL\350Ce\346\221\206\375Y~b\026\372W\007&\233\301\303X\007U\036uq\034\026\207\305aqX\034\026\f\214\020\350\267"
+	.string	""
+	.string	"\374\233\262\177Q\237\232Z\033\b{\023\365\210%\3440\tR\362\367\226)y"
+	.string	"\177"
+	.string	"\201"
+	.ascii	"\307\276_\t_\305\321C\264\327H\203x\274\n\024\244~\016\370k\030"
+	.ascii	"\365qD??^\202{hs\331\035\275\f\276^\005\241~\013\356_\221\342"
+	.ascii	"D\327'1\302\373u\272?C\327a\334\267\310_\341>\245{\221\373\220"
+	.ascii	"\243\213\264\357@\257mo\200\277<\3355\277\305\323Y\346\253\264"
+	.ascii	"\267>}\365\351\243\326M>\217\322\372\351\363#\317\213\346\177"
+	.ascii	"\331w\236\347\346o\310\317\372\036\357\231\001_\202\365\357\200"
+	.ascii	"\"\326\316\224\257\263\372sN}\017\246>\007Q\3661\310\037\007"
+	.ascii	"\245_Av\032\224w\315\356\242z\226\331WT\257\032?\245\352\250"
+	.ascii	"T\0379\351\246\223/\245>\f\320A\223\376\001\350\336\374n\276"
+	.ascii	"V\322e\311(\330%\261\207\342\223H\272h\344;\262\376)\365l\376"
+	.ascii	",u9\027\331\366N}3\265\264g\312\220\317\255\351z\023\324\240"
+	.ascii	"1#\206\213\024&\276\037\304\327\267\020\3767\362i\302\003\254"
+	.ascii	"\306\210\226\002\206\351\255\260\257\302\236\n;*\354'\256\227"
+	.ascii	"\270>\342z\007\3279P\007\201z\006\352\013\307\252\257\247\276"
+	.ascii	"n\362u\221\256\233\272\036\322u\020\326;`=\004\353[\250k\257"
+	.ascii	"\236\271\352\302I\361\023\337\023\373\306\362\037\361\225\354"
+	.ascii	"\355\3245S\227\342*\363\216\330!\371\206\030{'||%\200\337\b\020"
+	.ascii	"\036\244\364: }\033x\337\005\255\336\032\371E\320\372\036\020"
+	.ascii	"}\013\314\030\377\027\033\013\025[6\017o#\247 =9`\276\210\017"
+	.ascii	"\035h\372\033h\376\013c\377f\3653ccbr\230X\177\231\377\212\245"
+	.ascii	"\254~\364\0365v\323\352A\306\216Jro\365\033\3633\361\031\322"
+	.ascii	"5\340\352%@CF\350\207\301\302\325/\361\352\333\274>\026z\231"
+	.ascii	"W'\275^\024\372\317\373m\344\345\3102\241a\255\356\362\276\345"
+	.ascii	"\243\263\266\2162\177d\375\311\326M\262G\315\027Y\037\222:\b"
+	.ascii	"\370#P>\022\261FS\356\301\3523( \240\0022\232\260\033w!\214H"
+	.ascii	"4\367U\377\312\204\366a\311\204\255D\260\206\263\330Q\027\327"
+	.ascii	"q\230\350Z\021\331o\263\306\0326^\263K\251\275\021\314\030\240"
+	.ascii	"\335\333P\317\306\n\260\311\n\312\005PK\030\020\004\303\376\247"
+	.ascii	"\202\260[\030\313\004iw\033k\232\270@+\264m\231\200V\002\265"
+	.ascii	"\250\024"
+	.text
+	.section	.gnu.lto_.decls.cf9e7ccbb683cb92,"e",@progbits
+	.string	"(\265/\375`\335F\005;\001\372 \"vV JQ9\351\0248\275\302\320\364\3038\307\247o\364D\031\356\230\327-\201&\347\330\331\033v\324;*\307\265\372\277w^\"xE\356k[\r\261n\214\357\333\200R\264-\211\2606\255\322(\024aYf\b"
+	.string	""
+	.ascii	"\367\257\241{Z\263\2629\337\334\356\377=\b\331{\313\024K\006"
+	.ascii	"W\007\237\007<a\330\364H\253\367\366\f~{8\205<\234\177\355\362"
+	.ascii	"\252\341\225\307U\215\030\3012e\256\032\371+\221Z\244*k\226\206"
+	.ascii	"\240&Q\266\216\324[\227mtz\350\242![?^z\320M\325\373\206\222"
+	.ascii	"B[\223\361h\273 \233\263\017\265\257\n\244\376\250B\252V\315"
+	.ascii	"\252A\252\217>\253[\265G]\346,u\305Vo\340\350\264\246+\"\202"
+	.ascii	"\030\225\252\243n\325\035m\327tW\t\b[k\261\034\235\026d\346\234"
+	.ascii	"5\245nU\254N\013\202Z\346\252\004\244\371\b\323\313y\211\204"
+	.ascii	"t\324=\200\354\325\030\272\267a\370\366\b\276\r\202os\340\243"
+	.ascii	"6:o\223\370\225\r~\005\203_\267\340\277\265\321\371W\033\312"
+	.ascii	"K\344\206\036\215z\253U\017)S\302\250\367\025\013v\201\321\204"
+	.ascii	"\374\300\353\261\030\\RF\276^\370\020\223Q[\024\241\2525\352"
+	.ascii	"\214ZUi\364Y\225\361\327\251\n\343h\007\313]\327\226\237\373"
+	.ascii	"J\005wV\033\235\031\272\350|\215\202_\301\360k\021\374\n\004"
+	.ascii	"\3775\252f\223\213\234\272.\365\276\20393\276\250\300\241\372"
+	.ascii	"k\262\367\272N\205\352\263\232\377\036k:mbq\356&\243E\215\232"
+	.ascii	"[\316\335\202\244\226\371\310\t\206\206R\211t\204\204\364S\246"
+	.ascii	"f\nG\317\355\334F\347\273\016~\313\301o=\374f\203\377\326{S\347"
+	.ascii	"\3748\373\362\306Mg\345lf\203n\214\216z\233M\267\351\263\r\235"
+	.ascii	"\267\246H\224U\275\3572X\0049\367\206\263\367\366z\303\371\367"
+	.ascii	"\232\r;N\340~\fQ\2037\201\0301\320\324\333x\035W\263\262\006"
+	.ascii	"\037\257\034qh\352\345 \304;M\321Yu\265\314i9g\241\023\314\n"
+	.ascii	"\0208h\332\214\017\331\024\223\265z\337dlO\310\364]\237\3511"
+	.ascii	"]\246\305\364Y\233\351/o0\035\246\315\264[s\261dU\020\260\363"
+	.ascii	"\302\3139\277\241\224\261\360\325\006\326\001\007\037\264\231"
+	.ascii	"\356\322vv\371\265\203\266\225\004/\347\345\230\231^\353\264"
+	.ascii	" \250\241,\025\025"
+	.string	"\366\225\363\022\351\b\t\t\t\t\th\271\302\335\233\240\333\3136:\217\272\350|c\301M\327^\372\254\202\256;\007\037\334&\313\262X\316K!\240:O\352\310\251\367\r\207\337\025\234\275\327\025\234\3575\274\345hI\2057Q\352}\213\341\267\330\037\342=\327r\235f\227o\370E\024.\274\234\227\377[Kc\351,}\326s\375\302{JS\371]\346,\225s~\007W:.Hj(Km\025\371\3129\207x\3175\\\307Y\262\252,\265\005\207\244u\267\366F/\347\214t\204\204\324\203\344\307\217;|\337)\3407\f\374n\201\333\205\256\322g\217k+\357\267V;\217\3242\233\345\234\205\332\310\013I#\365>\004xE\3169\367\343\316\235\275\275\275\275~\334y\026\370v\321\371'|\2726:\177\272\350|\023\376\006\360)\200;\264\321\331Q\332\254\3176h\264\367\262\311nB-\3632\347\245P\355\242\243\026\245\336?"
+	.string	"\377\370\336R^T\226?\370\016~op\332\275\275\336\340|\305Cmt\326.:\207\272\350\004\321F'\013-V\201\235\232\221\225\323r^\022\t-s\320\bR\357\227mt\342.:\037\302\005u\307f\360W\021h`\344\364[_\251\0368\261\0304\211\277K\350\022=\342\257\036\252"
+	.string	"\252\006ru!\200@#\265\221\013~\313\301J"
+	.string	"\004\200;B\025\271\037U\t0\370o\001|J\032\251\223\202*\370o\005c\377\323,Y\200-\372\273\253\307\252\224\277\236\375\026\003\032\233%\372\253\211\277\221\322\340\331!\026\376\016\263B T\265\277\313l\320\377\273\023\034\332\310\017\360_%\rP\323"
+	.ascii	"\250K:\204n\300\337\b\370[\315\002\375\326\254pn\301\177\221"
+	.ascii	"\374\365>\257\212\222z\244\037\331\037\333s\r\277\245\363\367"
+	.ascii	"\0316\265\247*q\253p\326\324\300ok\2078\332A\370/Q\320\337>\366"
+	.ascii	"l\241+}f\314\0330\034\254\371\333\332\030\354\377\n\247\262\371"
+	.ascii	"o\345I\277E\373\333\313\233\326r<+Wj\bNX\351\362\t~\013\344\257"
+	.ascii	"A\312T2\177\365j-\337\340\304\034\013GDkp\326\006\246\345$\371"
+	.ascii	"\276\245\216\251I\304\374Os\274\243\377\002\370\177\342\257w"
+	.ascii	"\225\356o\244\017\340\277F^\347\357\025\177\227\371\351\374\375"
+	.ascii	"\201\277\373o\263\252\345o\025\r\202\277i\374\035\202O\240\203"
+	.ascii	"\334\350\277)\374\315\306\347o\241\237\277\211\352\210K\251\r"
+	.ascii	"\370\233:\367\f\377\r\301\177\376\373\241\335\340~\367w\222j"
+	.ascii	"\305\350B\377e\300\377\274*\377\321\\\370\333\r\356\177]\b\376"
+	.ascii	"sx\320\177)\260Q\376\3726\345\257\024\020\362\235\377\362\350"
+	.ascii	"\377&\377\356\360\267\005\177k\360\367\005\177\003\340\357\f"
+	.ascii	"\376\256\340\257\305\377\370\277^\376z\343\257)\3745\307_m\374"
+	.ascii	"\325\352\2578\376\252\343\3574m\177\025\301_\253\376Z\343\257"
+	.ascii	"\306\277\262\375\027\372\315\017\376\272\366\327\263\277\226"
+	.ascii	"\375u\371W\261\277\202\375u\311_\225\374\325\353\257B\376\232"
+	.ascii	"\365W\037\177\305\372\353\216\277\032\377\252\201\277b\340\257"
+	.ascii	"\026\370\353\211\277R\340\257&\3745\002\177\035\361\327\006\374"
+	.ascii	"U\204\277.\340\257F\177M\300_\001\360W\240\277\206\360W\021\177"
+	.ascii	"\005\341\257\036\3745\304_\223\376J\200\277\"\375\325\303_\005"
+	.ascii	"\360W\r\376\212\301_;\374\225"
+	.string	"\303_'\370\353\321_%\370+\206\277\016\3755\350\257=\177\305\177\275\177\255\177\375\337u\376\236\3637\233\277\325\374\235\346\3573\177\227\371{\314\337w\177\203\371\333\356o/\177w\371[\313\337X\376\276\362\267\225\277\337\3766\3627\333\337j\177\243\375-\344\357\255\277\223\376\366\360\367\331\337D\377\363\376\273\371?\201\277\315\376\247\371\273\354\357\261\277[\370;\354o'\1777\371{\311\337J\376\313\375\307\362\237\314\337^\377\267\374G\373_\367\337\312\337]\177\017\371;\310\337\021\370\273\304\337\016\370\233\204\277;\370\233\203\277A\374\355\373\033\351\357\001\374\035\200\2771\374]\377\277\371\257\346?\336\3773\377M\3747\341\277\330\377\021\374\237\373\177\264\267\267\267\367\373L\375?[\277O+\313\\uF\371!\367\241\036\t\023#Y\357\203j\340\317\230a\337\316\234{\231EU\225\257\252<\\\220F\343\326\240a\337:W\345|\245"
+	.ascii	"\265\031x\371\352\312\003\016s\233\222U\357\201\302\340\0039"
+	.ascii	"\301\032\252\370~c\334\030V\212\207e\266\321#\345\t\020\027\256"
+	.ascii	"\240\305uq]\334):\367\305\357\224\335\302\265\304\254\336\347"
+	.ascii	"u\332\330\222\253!\365\036\350\no\210\363\375JIu\334\035\312"
+	.ascii	"RF\246\276\200f\340\243,\337/T\237]\250vS\207\262\324\013$_r"
+	.ascii	"\360\021\231\3577\337\334qw\312\217\035\346P\246N\235\016\304"
+	.ascii	"\224J\260\237)\330\202:yyv\216\230\225s;'h\254\207ZY\2756N+\231"
+	.ascii	"\221V\246^\013\007\210\211\234\273,\365Z\275\332u\367\260\260"
+	.ascii	"\326\352\265o\202\236h\251\333\253\327\272\251_\377y,\2359qb"
+	.ascii	"\365>\257v\375\347\001\202\362uw\245\t\326\300\305w\313\206M"
+	.ascii	"5R\3022'wZ\204%\301Fs\276[5j\242\270~\270\260\221\225\3576\315"
+	.ascii	"\231Mc\321"
+	.string	".\3242'O-q\260^xaM\275\377Qb\ri\276\3333}f\317T#\030\252H\264H\362\003\205%`\363\335\226)\303\303\f>\302\341\273\0353\246\337(\341\265\027]^\260\004K\337\355\335\373\314\336Y)=U<kRv\340\275\341\243\030\276[0`|\254\341\n\340\354\354\354[\347\234\363\230\317\023\254\241\215\027/\375\246.\263U\317\013,\237#\330\0026.p\266K\277\351"
+	.string	"\265\314V>Ti\264\360}r`\r{>\233\245\255\026-=|Z\340\273u\376\253T\316P\031\b\tiA\f\216z-x\301\327O\332\312\301Y,\215w\363\3252+}\250\364\362\207\367\304\301\3579\2035\214\361\335^\271r\267\273\314Gv\320x\364\334a\013\354|\026\256m\0258k\245\355p\376\332a\243\202\203\227\253\226\037\336S\207\3373\207\337mwZ\260\364\331)\226\312\255\333\231u\263o8\347\234\\f\252\035\2573J\245^\276\252\362`\337~\016>8\232\237\234\305r\316\034\314:&I\326\352}\217\032\376\337\257\377\231\241\252r\316Js\231\253\242~\316\277\337f\267\207\037\250mc\360\377\332\277"
+	.ascii	"#r\206\272\243\3139w\033\274\304\r\212G\275\377;d\223\256j\312"
+	.ascii	"L+)\202\226\225\224V\nSfZVDSfZ9)\225$IT\225\265\222Sf9\023II"
+	.ascii	"%GdYM\231Ae\242)\263l\225[\324Yu^j%\263TV&\312R\031*\233eYu\230"
+	.ascii	"\222\322\262\2322\203\262\"\2322\323\262\312fZy(KAU\301\220\312"
+	.ascii	"UD\331LKM6\313\262\032\2322\313\262\2322\323:\322r0\226\270\240"
+	.ascii	"\fC'\244\255\311\246\244r\r\032XPUCtS\313\254,&\347Ns\221\253"
+	.ascii	"2]\316\030\344\214\225U%\006*\205~\213\242\253\021\325\006\225"
+	.ascii	"\325\313\234\363\006\032Q[YY\212.\331\231n\212IV\316L\242\232"
+	.ascii	"2\215\234s\366 \271\244\313F\232.\031\004+\317p\221\363\004y"
+	.ascii	"\2313\215\234\223\235\351r\316\311\234\363N\025\3262\347\035"
+	.ascii	"CS_4h\344|uD#c%\341\\\344\\\323\310\274YM\231me\205\200;3\373"
+	.ascii	"\312/\226\311\236\232\221\225\277\262\030\255*l\226$\3133r\316"
+	.ascii	"\315\006\177Y\331Xc\331\332\366\330$\353}\217\rl\3256\364\270"
+	.ascii	"\261]Y\325{\036:x\351\363\346C\355F\275\366\fN\353L\275\347!"
+	.ascii	"\203\255Y\233\2260)2\352=\017\035&\263e<Y;\242@\311\221\031\235"
+	.ascii	"\371n\307\306z\bu]\265IR\357y\334\260\230m\241\246 C\005e\231"
+	.ascii	"\330\023\033\366C\003\013\032\230z\317\363\365\344h\005\337\255"
+	.ascii	"\023'\035\327Ux\355\305\030\036\020|\324\346\273mrf\233T\257"
+	.ascii	"\256\302kD\264\340\345\252\267\017\347\301\201\217\272|\267K"
+	.ascii	"\2264\336\3212+{^<\251\372p\236\032\330h\314w\253\344\314*i\274"
+	.ascii	"+\265\314\312s\013K\251\324\313UW\037p\233\255(O\352=O\013\234"
+	.ascii	"\201\314w\213\344}f\221X\257+U\226\223AQ\320\310\360\241\227"
+	.ascii	"\363\325\007!\270/\036X\352\265I\200\342$\211\363V\3571\033|"
+	.ascii	"l\006\377\366\b\027\013W\266\322\352\265\\\325\032\261]\267\\"
+	.ascii	"\266\3109\370\340?R\226\353\346\f\325}AP\367\005f\034\022\250"
+	.ascii	"(\347=\016\203\177Kd\b>\3032\245\034\242\264N\310(\341b\205\330"
+	.ascii	" Af\344\250,\251\327n\235Qx^.\352=\306\202\343\264\214\331\201"
+	.ascii	"A\002\347\346\305\353\353M\356\253\307\316\364\230Re\n^\245\362"
+	.ascii	"\327)nX\360r^\326\270+m\\X\370\200\016\314N\f\027\236\031\037"
+	.ascii	"_de~\250m\021\303\203\362W\2731F\360,\r\313\303\372\260Y\226"
+	.ascii	"\312b\331\035\026\206}a\255\354\224\325\2627\254\016;\303^\331"
+	.ascii	"\037\326\205\005b\253\254\f\233\202\265acX\0346\207\355ak\364"
+	.ascii	"\231U\326\275\333l\223\277\365F\0265\2740G\276\246\270@\305*"
+	.ascii	"+^\255c\227_$\242x\340\325)Vi\241l\013KV\205\251DeyR\355\356"
+	.ascii	"\272\276\252\035\231\"T^`\373\252qVY\347\322\360\344\376\032"
+	.ascii	"\207e\355\253\356\257vVY\277$\371\312yy\204t\266\335\365\030"
+	.ascii	"\013\341Z)\237.mv5\352=>\3036\n;\301\227\256\215\316\267q\341"
+	.ascii	"\277\256y\255\363W4"
+	.string	"5M\245\303\201\272\305&\n\256\3369<ac\252<\251\367x\013\377\00365\340T9U\257\317j\234\232\367\352\246\352x\223\275i\273\240\344P\216\262\243\212S\333\344\244\032\017\224\300i1\321\343\t#\304\313\032|\217\247\260\355\242\3638\211\277\263\207\277C\007W5!^\327\370H\335XKR/\017\034\334xmtZ\320E\347w\356\360w\262\340\357\270\341\357,\361w\220\340\357\340\300\337\201\201\177\306\301?\303\340\237.\340\016]t^\257\215\316\237d\370\247\022\3743\013\377\234\201o\262\3017\265\340\233h\370&\023|3\013_\256\215\316\2335\360\357\036\006\321E\347\361\332\350\374E\203\177\267\340_\027\360o\013\370\327\b\026\321F\347\227mlf\224,aP\225\355\267,\013\310B\345\330\342\266\246\306cd\214\205\035jiTZh\221D{M{\307U\234\234\222sQo\277\205xE\273A\334P\251pV\245"
+	.ascii	"Yu\315\265U)i;T_jPU\263Z\266\366\305\206J\275+T\261 \250\241"
+	.ascii	"\234\223\270\341E\251d}V\313jY\205R\227MW\344\206\251\341\345"
+	.ascii	"\234\2216 \3355\275\255,\347\375\353\330\353\262\335\364\216"
+	.ascii	"\322\n\231\013\365\3662\304\353\230}\273\342bN\275\277B\360\233"
+	.ascii	"\f\254\335\260P[\250a}\326\244\2418i7T\304\352\223v\323tE\362"
+	.ascii	"mQU\007&w\204\"D\016\276\277/\360o\022\337\322\301\267n\360\311"
+	.ascii	"d\003,U\205Ml\211\nm%M\226:U\205\273\361H\211\023\207\245\304"
+	.ascii	"\003\020\2340Q`_\325\013\253\241\241\223Qo=R\221\364\231\207"
+	.ascii	"\232d)\024\026(\031\213\201\346(\f\377\246\031S\310\022(\260"
+	.ascii	"\275e\2331^F\310\3309X^\306\230^=j{j\314\324[\301^\235)\246\316"
+	.ascii	"\274\013\201D\251\0043\303\334\274\213\002\246n\253^\023L\013"
+	.ascii	"Y\246\370\250\327\374R\273\244\264\220\023W\257iw\244\205;|q"
+	.ascii	"1\275\230\\L\272\316Ug\310(\225`f\227\233t\275\226\257\216\304"
+	.ascii	"\375\3479\3070\001\362\242\336\037\275\300\277\271\305\366\220"
+	.ascii	"B\206\245\336\013\320\230W"
+	.string	"L-\346\025s\016'\205\3041\263\334\234\023\312[\243c\016\313\032 e\272\230XL9\2563/\252j\265\304\316\210U\275/\274k(i1W\3575\320\301\277\031g\275~\252\326l\221c\245\335\bQB\205\205*\235v\246\320B\016[\275\3573\323\005\373v\325t\024\3312\337n\302\211QN\351Q\357\363L7\273\252-s\334\320v\270\362\250\276\250\\\266\240'g\272\270MA\343y!j\013\021\263\355\342I\321z\253R\357\004dii\346Z\335^\016\260 \273!1d\250\335\\\023\212jrdJ\024\2603`t\300\341\r{ff\346\331V\r\245\022;\251R\246\215\224\233g\226\353L\023Cy\247\301\t\236\240\253\254\314\024;\312J\252\361\360\304K\034\2717W\270p\f\301\033\316@\201b.\273,S\265[Y\0341\275\272\203\r\027\256\261\233\313\236:.\324\260A\371\317\003\202LW\222z\257\341\005\236"
+	.string	"GX\230)\326e\231\352"
+	.ascii	"j\342\310\201\355\270\365"
+	.ascii	"\370\242a\262pS\254\323*W\234\033]\275\317\263,\374\347\371)"
+	.ascii	"\243%\243.\017S\020\325\244\211\tv\242\271\340\246\315%\022\247"
+	.ascii	"\0052\365\232`\246\023\0368:\262\350\230+\004\205\240Y\251\367"
+	.ascii	"\022\300\341K\260\206'8\263\344_bz\365\3202\312N\313W\316W\036"
+	.ascii	"p\222\354\006\223z/\301\030\236\340\005%JL/\0252P\226dM\275\227"
+	.ascii	"\200\t\246\200\213\310M$DL\257\212\327\313|\225\225T#\242J\234"
+	.ascii	"5Wzy\n\313\203\331\225\005\n\216$7\275\356\206F\306K\025\263"
+	.ascii	"\353\346\221\237g\347\016\314\\Y\2757\232\203M#7\271~\036\223"
+	.ascii	"\207\2152L\352\275\321\033\374\233E~\236\237\"Z\270\254\251\367"
+	.ascii	"Fj\360\215\312`\n\250|\377M-S\313\024\322e\231\212\003\013.\240"
+	.ascii	"y\323\313\371\312C\220\027\220\032k\352\375\315 7\205\270] b"
+	.ascii	"t\020\251\327\334\272\233\020\02521]nM\250<Y\253\367FQp\217\361"
+	.ascii	"\335\3142\263\252\227\bi\031\312\312\003\026e\231\033DH\350\234"
+	.ascii	"\324{#%&Z\343\273\351\303\364a\271nr\231\2512\214Yi1\t\361V5"
+	.ascii	"U\3573\324\301FW\276\233X&\226E\273PC9\013\211\361\226\253\256"
+	.ascii	">\230mfR\311z\237A\f6\352Z\363;g\215\271\343\210l\231\024R\306"
+	.ascii	"i2kfV\250W\307\216\f\035li\365>\303\034\3561\033\227\316\335"
+	.ascii	"\023\223o\035\016QS%\210u\351 \312l\321tEDXA\213\335\013\223"
+	.ascii	"\252\351\256\206\262\024\0253x6\314\344\255\023\224$\3129\b\227"
+	.ascii	"/\034\346\225\231\202y\303T\2329\372\314\264a\272\370\221i\303"
+	.ascii	"\204\332\202\227\363\322'L\236\027]\320\275t~\206C\324T\tP\310"
+	.ascii	"\230T\346\224Y\243\351\246\250`\247E\317\2542\255\372\314\244"
+	.ascii	":Z\346\234\266\001H\316\030=(\347\375\315\032&\215\267\030<^"
+	.ascii	"\324k\316h\2639\031A\352}\006.\374\2331\372\314\224!\364B\005"
+	.ascii	":I\3525a\374\f\214d\f\031\217\303\001\307\302\226z\237\201\b"
+	.ascii	"~\006 \370\031n`S\n\203\301\353\301\245\336g\250\201\237!\006"
+	.ascii	"~\206\026\370Et\360\213\364\360\177\367n\035\263,m\270\324\261"
+	.ascii	"\263\3332#\252\336\027\265\301\027\316\225#\024\3666\204\255"
+	.ascii	"\336\3378\377y&\300\325\205\255\336\253W\347\274\276h\324\373"
+	.ascii	"\373&HL\0225\262z\177\335\374\3471\331\366\332\350\250\367\346"
+	.ascii	"a\027Ea6\350\351A\345\007\0176\277y\377\345r\333|`\217\316\233"
+	.ascii	"z/\246\215\316\236\022\342\227\r\227+xc\365\276\250\r\033)\331"
+	.ascii	"\362\233\346n\271x\225l\231L\347`}\bJ\213\262\306k)%Gc\311\\"
+	.ascii	"\275\267\314=s\321\374<<Uf\330a\325\373\"3\374k\246H\035\222"
+	.ascii	"&\365\326~\334y\307\374\222\371yv\304\252\244\324\352}\321\030"
+	.ascii	"\376\275\273b\264T\201Q\357\213\234\340\3370\377yFP\006\310\223"
+	.ascii	"z/\030\354\242\250\310\006<d\312\316tu\371\005\363_\272j\345"
+	.ascii	"~\231\301\343*M\275\267\356\332\375~\271^\362\375\342AV\316P"
+	.ascii	"\367\213\320\234\234\241\204\272/\350\276\340\206my\255\235\367"
+	.ascii	"E[8\250\213\316\313%\304o\227\352\22567W/P\027\235/\202\302\024"
+	.ascii	"\274\340\263\\}\263\374\034|p\261\3349\313u\363UN\256\351\320"
+	.ascii	"D\f\0065\370\030\270`\n\226rr\th\262\345\253\207\0232j\352=\006"
+	.ascii	"3L\301\227+W>\200\342s\245E\0160\365\036\303\026\3560\003\016"
+	.ascii	"\356Z\221s\255|\271\362\243\312\257\225\0377.\346\254\325{]\250"
+	.ascii	"]]\350\f\201\302`\003\363(}\277nnv\b\216\232\312\202\332\362"
+	.ascii	"\340\211\n^n\202\254\310^\350Q\357\211\306\340\f\314\356\224"
+	.ascii	";\305\332y)\225`\371\352\312\203\211u\026\345,\013\356`\345\354"
+	.ascii	"\354\262uY:\0371\256\254\375\262\355\220Q\315\260\253\367yW\355"
+	.ascii	"?O\317\032/`\356\352\375\257\332M\353\2611FJ\234\3352\215\310"
+	.ascii	"\261\321V/Z\335[\036\331,H\344\330\324{\"7\254\241\005\337\257"
+	.ascii	"\3315C\242T\352\021\231a\243;\337o\331-\213\352\"\n\303F`wy\227"
+	.ascii	"\347\026\017\236\2646,n\365\236\350\013wP\003\345P\354\033\316"
+	.ascii	"Sb\\\035D~\344\325{\"-\354\023\305\367+&\326v\"\\e\331; \026"
+	.ascii	"\307\033YZ\275'\312\201y\266|\277aa\355F\204\"Y\367\005\024\221"
+	.ascii	"8`9_}\350\261q\204\314\231z?\224\207\217^\360\375\202\201\275"
+	.ascii	"\3502T\207\177\216\370~WX\241\323D(\222\005\005\245\301\022 "
+	.ascii	"q\344\364r\226\373P\233\204\231\035\251\367C.\340\013x\370~\227"
+	.ascii	"\334\254\313\244zu\220Zf+\037#G\224J\275!3\374!&\330h\215\357"
+	.ascii	"z\365U\242\304\266\335e\266\352\211r\244\261\346Zl"
+	.string	"\251\367C]\370m\333\316\rA|\277I\222\304\361\2017D\371~\217\334#U\255\204\241\234\211\244\031\262\2017\324\360\375rq5\336Y\305\023\343\205\336\220\024\336\260\346\373-R\244JQ\302kD\346\340\305\301\033\274|\277C\206\310\371\022J\2037\350\360\375\006\271A\032\357h(K\241\301\371\022\n\203\217\352|\026\256\257\226V\333\201\330Y{\201F(\316\307\315\362Q\365\343f\375P\343\362\321\002\305\254K\275\027J\303\027b\202\177\352|\277Xg\027\253\355n\262,S\035\200,\216\034X\316r\037L-7o\236\324{!\030x\203\027\337\357\216\035\355\246.sU\017\214\030Ay\030(\317\367{uv\257\354\332\205*\313I!\266\254:\260\326\342&\005*37n\216\033/p\334\034\027\207}\303\311f\273\362\360\243\302\035\023\034\365>\310\n~P\023ld\305\367\253T\266\233\316o\330\305V\021\274\\u\365\301"
+	.string	"Ov"
+	.string	"\301FS|\277UU\235v\241\002A\0245\"\177A\364(D\242A\t\214*~A\024\211\024:\375PXB\233\226\204@\200"
+	.string	"\001B\007 @\200\020\021\342g\004\036U\364\214(A\024\002\217<J\277\024e250\021\205L\304\342\3607\301\210\022J?\2367%!\227\216\276%\024\033\034`\201\022'H\030\341\347\200\021\0240\341G\302\t?\023%\210\224\320`\321\004\343\b\304\022H\024\226\204\251\t\364\b\334@D\207\336\224\344+\n\317\007\240\303\016"
+	.string	"\221\302 \321\233\222P'a\352C\036\321\024\302c0\375!M@\235\204)F\n\207C\241\323\211,.\365\020\205\310\2367%!\207C\340\0222\025v\300\367Dd*\300\212'\242pX"
+	.ascii	"\017@\370\201 b\205\017\r>\r\227\210B\337\021\371\344\363\251"
+	.ascii	"(\036\233\322\"q\007\005\020\035\336\024I,.\231(\322\243\007"
+	.ascii	"\220\346\233\222\220M)\320\311G,:9\025\227&XQ<\032\215\300\037"
+	.ascii	"\007D`\n\374yS\222\004N\2240\341\353\200\302RqH\002z,\222 \024"
+	.ascii	"DS`\na\2724\002\022x\0014Xt:\n\201E,\214E\022\214\3227%\031\237"
+	.ascii	"\212G\246\337\021MQ'\340\021h\364i\260D|z\200\017\021E5\221?"
+	.ascii	"&\343O\372#2\031M\"\223\321\242\037\020\"/\022\211\036\203A\340"
+	.ascii	"\016\013cq\351\036S\243=\020\213c\212\0242\241'\3746\004Q\"\223"
+	.ascii	"p\b\334\t\242\310\247\213\33490\005\006\231\214IAG`\323\322\375"
+	.ascii	"\241)phtBO\244(\022=\201\311\330a\bD\022J,\2160\242h\003X\004"
+	.ascii	"\201\350\tH#\023\006\342\b\310\013l@\203E\023\202\303b\tA\342"
+	.ascii	"\b\250S"
+	.string	"\261\204c\321\004\322H\242\203Q\305/]\201\022\177)*\244A)%\242\307\343\323\022Q*$\226\bB\216(\241\204\"+\20042\365\364\004y\320!\023\221'\005\220\b\304D\024:\035\201>oJB\217\305\245\337\022\n\337RpX,\201\t\350\264\223\242\310\364c\001T\201A\b\310\203\244#\352$<a,\026\207\277\024@\242P\n \021\007\321\237\036\247'dP\007\300#\n\036\024=2\241=A z\\\201\006\211\302\037`\n\034\241\002\235"
+	.string	"\322H\202X,zS\322\322\017u\022\246\304\247\243o)\005\246\310\036\024(\212(\n\300\364\227\002H,\302\032\204\310\242\361\227\242H\364\3703\241D\302\202\"\f\033\200HJ\217@c\022\352T,\241x\202X\024\246K\350Q8\"H\034a\004\232\002\207OI?)\200D\242\024@\242\317\320o\b$\n\231\204\307\242\006\024\226\200\307\024\211,\036\227~h\n\f\032\237~&\224H\0309-\375L(\221\3200\242\204R\n \361L\001$Z'4E\2620\241A\310\350\207\246\300c\317\320\261x<\242f\32184\004>\245K\300\037\236\020I\301a\321\207\250\2428\202X\224"
+	.string	":\004.!\177&\224H\f\365p\220\024<\026\213K?)\200\304\023A3\025\022\205\267\203\244TH\024\236,R\341Rq\210\246\370-\r\201K?\023J$\210\276$<\242D\224\t\337\003\020\n"
+	.string	"\202\210\025;\027\021\002\210\020@\234\027\021B\210\020!\200\020\002\037\204\020v(\375!\217\350\360\311\001)\320(5a\204\023FP\372\215(\241\304\203\376\202%V\024;\260\023\034\242?4X4\341\210\032Q\264\003?\350\017\311\004\034>"
+	.string	"\r\026M b\"\n\217@\264\003\277\024e:\002\323 t\211\bL\221\302\340\317\250\302G\351\002?\023J$N\324\251\330\3643\241D\002\247\347\260Xl\300\317L\321\023\232\220\300#\tA\241\021C\020\362\207\016\205(\212G\245\240\320\370\223\276))(4\216h\344ODPh<\225\272D\007\205F\213\032Y\244\277#\232\016\205(\210~>\320\364Ca\034\376T"
+	.string	"Y\364|\240)\b\005\212b\372\264\364kZJ\213\304\037\206\224\210.\035Q\245\224(,*\031\237\202D\341\0054\370\250"
+	.string	"f\300\351\311DPh\fJ\211O\305\245\037\312\004<\242)\200?$\0215:\025I\b\n\225R`\007R\024\021\205&\244#\004\205\306!t\310D\034A\210E*L!L\205H\"jb\210\246@\207C\351\022\212\002EQzD\215+\320_:\024\246?b\361\003\302c\261\351\350\004:L\323\342\261\351\204\004D!\220\004\352tDSa\206\2420\005\236\260\0028DO@bH\233\230\204\350\005R\242\260hLQ\023NG4\r\026\235\240\002\310\202(\025:\t%0D\227\226F@S\3401(\030\034\026\233\220\350\261)e\032B\235\204i\017:d\"\0023\2608\242)\212K\350\361\327\204\004\036\227\212T"
+	.string	"\217\366MION\302\243\341\260x\274MK\251\320h\252"
+	.string	"\262\260H\364i\bLq\246?\016:hB\376\230\204(\210E\0220 \237\204A\340\361gT\361C\032\231\200P\030\207?\244\221i\007M\201\307\237\nt\310D\024\006\201h\323\0179,\036Sbq)\003Q\270\002\350\364\013\242\250\021\371K\001$\002\241\301\242\323\317\b\334\031QB\311\366\034\213)\360\310\204\246DaO\372d$\n{\320\024\302\024\230BxD\203\277\024\t\034\n\245O\306\364\251x\036"
+	.string	"J(\324\022(\324\021(\324\025@\247\022w\007\371\003\246\300\021\304\2420}\032\026M \215LD\351ODJ\024>\355\244@\023NO\3043}S\022\322\310\344+\n3\274hD\217\276\264X<\372|\322!\320\"\177KE\t \215L@)ph\323\037\007\035\244D\341\016\2618\264M\303\241E\203O\2510\035\002\177&\224H\374\004Q\324h\302\007E\036\237\212$\004\211O\305#\323O\372\003!DJ\024>\341w"
+	.string	"\202\001Pp\320\001\021\037$I\360\003\034\200\204\016\025\230"
+	.string	"\t\274\224D,\nS \2230\005\220\350K\233\230\204C\024>\242\020\350\344[:\"}I\026\030\213\301\246\033\344N\231ql\311\"\347\226\t6\347\326\304I\275\034\312N\037\247\326\351\343\004\322Y\203%e\316\254\237@\260r\315\027\271z\317\037\235\366b\t\033(\\1\224U|\324\373\r4p\006mWg\217\253\023\213\247'\f\213\2170\275|u\003\353\344\301\243+\255\214\307\271C\0050wV\354\331r\214\234\230\344\251\243\3668\201\230\325\211\325\373\2439\030"
+	.ascii	"ip\234)\2348\316\034%$\251z\2349\224,\331\232Q\357\217\314\340"
+	.ascii	"\377\274\261\3549sR&\315\206y\346c\206n\207\224\322\266\t\215"
+	.ascii	"a\322$\317\352Z\001B\233\333\001U%\026\224\243\007\035\016*s"
+	.ascii	"MM\230\233#\365\376g\r\273\206\2447\244\254^\016S3N\032\347\214"
+	.ascii	"3F\347\252#_\371\352\206\207\037y\301\034\204\234S\247\214s\352"
+	.ascii	"\214\361\301\016\245\022\354\204\3613\206\020\013Vkl\256,\177"
+	.ascii	"\250\250\272\262\352=\245\316\026?]\374tQO\027vo\357l\341\013"
+	.ascii	"\332y1\230qB\235Q'\324\231q2\347\344P\216\002#\367u\364\2061"
+	.ascii	"\350\"\347L\31293V\333\373\231+\331\024\263\036\365\232u:\316"
+	.ascii	"\216IRg\256^\223\316\251\350Hs\243R\2579\307\304\202\305\244"
+	.ascii	"\211Ya\rg\260%\317\214\223g\302\351\252\252L\200\261:4oz\371"
+	.ascii	"\352\206\336M8q\246\0133m\352\3525\337\034\313Q\033\373R\257"
+	.ascii	"\351\346q;s\\\266~\034-q\006=\316\230m\316\230lJ\350i!\266\346"
+	.ascii	"&\233\216\023\352\202J\332\325k\252\3518 q\3404\301\363i!&\273"
+	.ascii	"\300K#\024\207dF\036\032k\026\204\262\250\243\341cZ<2Jq \212"
+	.ascii	")\205\020Shjj\222\016"
+	.string	"\363\024@0PH\"\027\013\311\263>\023\300B\214\253\305\211\240\224\212)23\"\"J\222\024\024\024\262q\256\254\335t#\333\024\370n\316\264k\376]*=J\233\242\203]\371JJ\235\243\016N\222\366\374\226\213\274\335\023\373\253\207x\250\351\235\321\017\226n\220\335\f\264\214\262\0320?C\215<\023Z\220A\364\270\215\207&\021J\340\r\310\344\330\001\237&U\245\324\016\r\361q{\225\024\263\346\221\374Yx\266`\bo\227\357t\213_\221f\360\322\273#\235f\206&-\341\216\336\020\257L\217Tm<\262$\305\026\r\320\223\232H\221e\352\337\213\314\201\375K@\nn\333\226\377\\\331\001\265\353\357\330p\\\332m\3271\322J\332\312-U>@\246~\rstSc\332\367\021\037\230\367F\306\355\261\364,\267r\025\327\370\005z\274\234\257\246\330\275\034sfy\304\\\231=\233\306\366+z\310\3258F\3627\207\231"
+	.ascii	"\002\241}\177\205\320\302Iq\337\311\251\375(,\343d\300\371\254"
+	.ascii	"\200\2121IMl\261O\300\216\346\342\t\351\337[\177~N\365\022>^"
+	.ascii	"~\205q\036x\023\254.\257[0\034\333\320h\025\034<\304\f%\363z"
+	.ascii	"\335,%C\274\314L\0214\261\325\323Q\3349\251\226\031,9,\302VO"
+	.ascii	"\277\241\013V'\002\004<\002\317\256\255\243\f\306!\262\363H\031"
+	.ascii	"\301_\021\301d\322\240\326\320\353\261m\334#\tE\036$T\271\344"
+	.ascii	"\026o\2047\2467\306\372$\305?+\300\033\243\225"
+	.ascii	"1L\304us\\\024\247\303\363\202\224jv\320'\327\275#\226c(\366"
+	.ascii	"\2513\276@I\2324\002^?\232\264\203\332N\364\n\273W?\022\343J"
+	.ascii	"C\227\300K\26431\223\302\272\277\275U\302\327\253\232\207\305"
+	.ascii	"\0228XX!\352P\314\253\230\320\347\341J\224="
+	.string	"c\027\f\031\201T\255\3336\361bnS\r\330\370\340\234A\315\346\302R\240\217\205Q\236\344\346\026t\324\205\206Z\230\261\025go\214\262\266\340\334\353D\220\277\345(\244\255&\330m)O\313\202\301\366\322;\215\027\026\225\206f\273\233\346\ne/\276\222\325E\377k\037\315\316\033\210\264\2026)\312\231_\344\310\336I}\030\233\325\255\305\310.\222\240r\340\204\310\325\210\035C\311M\226\220\254F>\215\037\326\245\236C\342\276\017\276y\254\215\025\235ln\371\354\025T\325\334,\310i\325\026U\327u\322\213\236\301\254\232\362\315\332MJp\334z\367\275\246+(\242\226\224\004o\372|\305g\002V\307\350\275\332n\261\007\257~\241\372\202r\377\364\021Hau\036D(n\357\373\355\356\257\344j\0042%\264\002\034M\246\321\262\220\017eb\240A\322\340\"\250rO~\350\007\nT\"\306\b\343m\251d\371\204\205\373\024B\314"
+	.string	"\367\275vg\244\313qw\306\210\324\245\347Lx\331\210\245\026\001\300\313<\246\253f\353/!s\206\f\340\306\335V\304\304rH\244]\f/\314\25761\206\343\230y\215\033\016\322\231J\210Z\212,'\327 _\303FaR\034N\177O\\\004hS\233\237\\\255\272-\203\027\320@A\340/\243\267\345\207\210\"P\377E$\220"
+	.string	"\005\032w}\213\212\251$\251DIrf\270\202tc\206\3012\314\255\005\353a\321\234\330%\300h\346o\313\033\372\"\b\202\227-\377\033\354A\027\330\277w\274\266i\274\301\307\365\333\007\312\206<\346"
+	.ascii	"\022\217{7l\354\\\234\324\\\020\232\207Sc]\362\202\222\264\345"
+	.ascii	"\026/\367\254\202\374\027u\3323\365\277\355\254^\360\225\036"
+	.ascii	"}\275|\253H)yM|\313I\361#\213\306\320Gra\370\366\243P\311\321"
+	.ascii	"\317\356G\320@\336J\244\205\232O\351\312\337\037\021(\004\257"
+	.ascii	"\027\334\332@_x\022\326\261^\300\2270g4\265\312\263d\216[\033"
+	.ascii	"\263\250A\254(\277S\276\017]\253\035\210\337\254K\2754\035Rg"
+	.ascii	"\345\032\276Q\3337\3264\177\310\303\262\360\004P\177\310^JS\243"
+	.ascii	"!\354\003\350M\267\nv\262\251\254\337w\203\020\313\210'\364r"
+	.ascii	"\316\230 \375\r\247\245\177\332\232@(\241\211\225\330\023\312"
+	.ascii	"\373L\301o\315R\343D\203\017\016R\214._\013\355.\325\201y_;\267"
+	.ascii	"\241\244cn\274\3433I\244Q\307\204\b\330\351\332}1\343/\326C\030"
+	.ascii	"X\326\001\2315\023\206\205\220\373\342 \002V/\327q\310\322\261"
+	.ascii	"1\352\336\020\307\344\264\312\324\374\023@;_o\200\312\205F;\207"
+	.ascii	"\273\334\321\021AI4\013\024\350$\330\216!c\243\250\034\031\376"
+	.ascii	"M\366\035\213\352!\320\306F\374\264P\374\275\343\306\3236@i\365"
+	.ascii	"\244\3602;5f\021\201|-\332>\0265\374]s\006\032\005\326\251\210"
+	.ascii	">$\304\220\212[\036\002\336\215\001\275\214Hf=\212\332\304\271"
+	.ascii	"@\352L\367znn\364\340\205Yp\374\213\350^\310c\374\311\304\275"
+	.ascii	"\325\007\003\233t\207=\273\244\247\257\030\213\021\2029\3401"
+	.ascii	"\nw\t\355\n(8G'\231'\363\242\\\177\3361\007\355\025u\244R\250"
+	.ascii	"\342\374,\275$\260\017\274r\2139\346f\274!\342\034\024T\240\222"
+	.ascii	"\"[|\355g\357\205\217\n]@\\\001\267B\211\324\317a\213u\253\023"
+	.ascii	"\364:X\244o<\244k\227Ph\b\013B\246\240\200\204\327[\017\0251"
+	.ascii	"\225\242\315o\302\232\321h(\005\372>\215\26214q\3224\350\231"
+	.ascii	"N\305\366SL\342@\371.\007\257\301\341\342gcZi\332\b\212\247\r"
+	.ascii	"\3719\235\n\237\264\2342!\376C\322\213\363m\204\007"
+	.string	"\362\020\370\263cM49/\007[9bZPH\\\245\230+\022J\264-\233\254r\273\200-\354\332A\027\240\222:\no\314\341\345+yP\0177)\262l\341\316\3025\216Y\275\205+\314\316?\302\323\373\024O\202X\314?.m\241\212\272\377|9\236~\371\370\206\206\021\324\207\360H\033\307\271|\221I\230\252\216]\2525e3\202H\262ZB\020\3735\341~\261\0318\020\034\335M\220\"Q\311+\242\336\241\300\200\346/\220\"\267\206TF\ng\227)\366\240\tF\020PD-\324\224\322\013\314\363R\360T\"\216\277\315j)\352\247c\n\006\212\211\307A\033)\017S\300h\375o<\241\270\202u\005\365\0167I\217\356\207~\bpm$\365\216\277\242k\323\247\013\023F\005\244H-~;k\336\370\243\267\241\273\354M\016dZ\240;ML\306^\242Jh!@\367X\335\027\301\324\322X\356#\366\260\034\2657-"
+	.string	"\326\223\240\227\360\234N\360Y"
+	.string	"h6\017\264s/\226)}:leg\372\024\036\212\243\360\207\032U\371\246\031p&\325\211\034\020\332\326\372t\260\326\377\317\255\237\352\223"
+	.string	"\237,\362\222\247\201A\357\372Q\346.I\224\274\316\356o\357U6\374B\360\311\327\342\310\330\321\306\353\231d\212\224\342J\343\334!]\002}\316\002\364\230x\345\356?\022 \301p\034mO\330\344^\2118S\243\323N\231r8U\224\336o\f\331\220v\020\f\244\376\003\277\374\3028\246\241\221\350\234d$\240\365\204z\001/\373K\205\366gQA\314B\250\355p\001\214R\256<\376\303\037\344\347\244\007\321\212T\265>?r-f/\245\031\335\fV\305\221\002\036CE=\235\220x\202\315\370\002 1\007\350\\\263\023fsHQ\257\235-\241\305\026\333J07\272\rKI\342s,P\203P\263Q|\016y \203\247\343\217\246\2014\005K&\336\351\351\351wCO=\3514\213\276Q"
+	.ascii	"[\204\341\003<\302\006J\236\333\203\275E\257\223\246#\213\334"
+	.ascii	"r\003\017\t[\220\276\026\005\fp\027n\233>\352\216\310\205\372"
+	.ascii	"\027b\321\006{N\322\361\332\344\245\242\370\250\365;\320`\246"
+	.ascii	"\205#\235]\022\214\217*\347\373\255\317\336\374\005M\2613\360"
+	.ascii	"|\277\256\017g\237\207\034C4\344*7\237\002zKI\376\222\233\350"
+	.ascii	"\233\003\374:j#b~\257\177\244sH\303G`\2710\322C\317\3067>!\274"
+	.ascii	"\254\377\030\342\321\252\277\264\372Y\030E7\264\330_j~\312\345"
+	.ascii	"\177"
+	.string	"\254\372\363]G\311\031a\316\212<e*{)\3163\324\233\273\336\277\224/s\357~\227\216w\210>\247\345&[\302>\211\323\036\256\361\020\3002\356\344\\\002o\210N?J\374\220j\033'm\316\337\237\366\211\200=\333\235\331\253`/o\207,\370p:\237U\360\235\343\311\216[R\377e\025t(\264\035\317\311\033\362\307\035>\223\363\357\341U\235\340?\367\316\006\367\221P\332v\034x\363\f|\227\3405\363\333\222\363\210\370\233\263\201w\343\326\355\305\354-\263\227\374\247n\270p\255\033p\352l\226\321\347\3059VK\212+\rMt\373\243C\037\304\236/\2717\262\017`}\261\226\221\361\375\274\005s\234\303k\371\221\036\247\331ds\254\336^:\031i\243\231]\244Q\303\350\275\223\362K\210\200\\\215\247\210\347\224\274\0228\303\231\033LV6\270\203Q\237\204;\256O\032\243\274)*\337\341\347\227\207\030\3776\2775;"
+	.ascii	";@[\017\350\021c\022K\273\346z\232\363\3628\256\314"
+	.ascii	"\351z\336\360&\310\343\370\032\032\257\347\2753\030s\242\324"
+	.ascii	"\365fg\350W\001\260T<.q-\341\036\301\257\355\033';\025\224\353"
+	.ascii	"\334\376\034G\016M^\367\277\341`\221\370\223\355;\240x\346i4"
+	.ascii	"\343&\r\223\200\337x{\345\324\246\324o\301\f\033_\211\331fYJ"
+	.ascii	"W\343\202\372\353\n"
+	.text
+	.section	.gnu.lto_.symtab.cf9e7ccbb683cb92,"e",@progbits
+	.string	"navigationConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"GPS_reset_nav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"gpsUsePIDs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"GPS_set_next_wp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"updateGpsStateForHomeAndHoldMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"updateGpsWaypointsAndMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"GPS_hold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"pgResetTemplate_navigationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"navigationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"navigationConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cf9e7ccbb683cb92,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16254 @@
+	.file	"pid.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/common/filter.h"
+	.file 7 "./src/main/config/parameter_group.h"
+	.file 8 "./src/main/common/time.h"
+	.file 9 "./src/main/fc/runtime_config.h"
+	.file 10 "./src/main/flight/pid.h"
+	.file 11 "./src/main/target/SITL/target.h"
+	.file 12 "./src/main/flight/imu.h"
+	.file 13 "./src/main/flight/navigation.h"
+	.file 14 "./src/main/sensors/gyro.h"
+	.file 15 "./src/main/sensors/sensors.h"
+	.file 16 "./src/main/sensors/acceleration.h"
+	.file 17 "./src/main/flight/pid.c"
+	.file 18 "./src/main/fc/fc_rc.h"
+	.file 19 "./src/main/flight/mixer.h"
+	.file 20 "/usr/include/string.h"
+	.file 21 "./src/main/common/maths.h"
+	.file 22 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	pid.c.0b039413
+	.weak	pid.c.0b039413
+pid.c.0b039413:
+	.long	0x11a2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF2109
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1836
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1837
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1838
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1839
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1840
+	.uleb128 0x4
+	.long	.LASF1841
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF1842
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1843
+	.uleb128 0x4
+	.long	.LASF1844
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1845
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1846
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1847
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1848
+	.uleb128 0x4
+	.long	.LASF1849
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF1850
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1851
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF1852
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1853
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF1854
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1855
+	.uleb128 0x11
+	.long	0xe7
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1856
+	.uleb128 0x1c
+	.long	.LASF1989
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x5
+	.byte	0x1d
+	.long	0x124
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x5
+	.byte	0x25
+	.long	0x13c
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1862
+	.byte	0x5
+	.byte	0x28
+	.byte	0x3
+	.long	0x124
+	.uleb128 0x11
+	.long	0x13c
+	.uleb128 0xd
+	.long	0xe7
+	.long	0x15d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1865
+	.byte	0x10
+	.byte	0x6
+	.byte	0x1a
+	.long	0x19a
+	.uleb128 0x2
+	.long	.LASF1863
+	.byte	0x6
+	.byte	0x1b
+	.byte	0xb
+	.long	0xe7
+	.byte	0
+	.uleb128 0x7
+	.string	"k"
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xb
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x7
+	.string	"RC"
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xb
+	.long	0xe7
+	.byte	0x8
+	.uleb128 0x7
+	.string	"dT"
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xb
+	.long	0xe7
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1864
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x3
+	.long	0x15d
+	.uleb128 0x1d
+	.long	.LASF1866
+	.value	0x1f0
+	.byte	0x28
+	.long	0x1f4
+	.uleb128 0x2
+	.long	.LASF1867
+	.byte	0x6
+	.byte	0x29
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1868
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x9
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1869
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x9
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1870
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1863
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xb
+	.long	0x1f4
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0xe7
+	.long	0x204
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x77
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1871
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x3
+	.long	0x1a6
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x30
+	.long	0x22e
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x36
+	.long	0x24c
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1878
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x3
+	.long	0x22e
+	.uleb128 0x8
+	.long	0xe7
+	.uleb128 0x8
+	.long	0xee
+	.uleb128 0x4
+	.long	.LASF1879
+	.byte	0x6
+	.byte	0x46
+	.byte	0x11
+	.long	0x26e
+	.uleb128 0x8
+	.long	0x273
+	.uleb128 0x25
+	.long	0xe7
+	.long	0x287
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x4d
+	.long	0x2a5
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1883
+	.byte	0x6
+	.byte	0x51
+	.byte	0x3
+	.long	0x287
+	.uleb128 0x14
+	.long	.LASF1884
+	.byte	0x70
+	.byte	0x6
+	.byte	0x54
+	.long	0x337
+	.uleb128 0x2
+	.long	.LASF1885
+	.byte	0x6
+	.byte	0x55
+	.byte	0x1b
+	.long	0x2a5
+	.byte	0
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0x6
+	.byte	0x56
+	.byte	0xb
+	.long	0x14d
+	.byte	0x4
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0x6
+	.byte	0x57
+	.byte	0xb
+	.long	0x14d
+	.byte	0x10
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0x6
+	.byte	0x58
+	.byte	0xb
+	.long	0x14d
+	.byte	0x1c
+	.uleb128 0x7
+	.string	"a1"
+	.byte	0x6
+	.byte	0x59
+	.byte	0xb
+	.long	0x14d
+	.byte	0x28
+	.uleb128 0x7
+	.string	"a2"
+	.byte	0x6
+	.byte	0x5a
+	.byte	0xb
+	.long	0x14d
+	.byte	0x34
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xb
+	.long	0x14d
+	.byte	0x40
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xb
+	.long	0x14d
+	.byte	0x4c
+	.uleb128 0x7
+	.string	"y1"
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xb
+	.long	0x14d
+	.byte	0x58
+	.uleb128 0x7
+	.string	"y2"
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xb
+	.long	0x14d
+	.byte	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1886
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x3
+	.long	0x2b1
+	.uleb128 0x1d
+	.long	.LASF1887
+	.value	0x1c4
+	.byte	0x62
+	.long	0x377
+	.uleb128 0x2
+	.long	.LASF1888
+	.byte	0x6
+	.byte	0x63
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1889
+	.byte	0x6
+	.byte	0x64
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1890
+	.byte	0x6
+	.byte	0x65
+	.byte	0x17
+	.long	0x377
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0x337
+	.long	0x387
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1891
+	.byte	0x6
+	.byte	0x66
+	.byte	0x3
+	.long	0x343
+	.uleb128 0x4
+	.long	.LASF1892
+	.byte	0x7
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x7
+	.byte	0x21
+	.long	0x3c6
+	.uleb128 0x16
+	.long	.LASF1893
+	.value	0xfff
+	.uleb128 0x16
+	.long	.LASF1894
+	.value	0xf000
+	.uleb128 0x16
+	.long	.LASF1895
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1897
+	.byte	0x7
+	.byte	0x29
+	.byte	0xf
+	.long	0x3d2
+	.uleb128 0x26
+	.long	0x3e2
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x7
+	.byte	0x31
+	.byte	0x5
+	.long	0x403
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x7
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x19
+	.string	"fn"
+	.byte	0x7
+	.byte	0x33
+	.byte	0x16
+	.long	0x403
+	.byte	0
+	.uleb128 0x8
+	.long	0x3c6
+	.uleb128 0x14
+	.long	.LASF1898
+	.byte	0x28
+	.byte	0x7
+	.byte	0x2b
+	.long	0x463
+	.uleb128 0x7
+	.string	"pgn"
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xb
+	.long	0x393
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xe
+	.long	0x463
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xe
+	.long	0x463
+	.byte	0x10
+	.uleb128 0x7
+	.string	"ptr"
+	.byte	0x7
+	.byte	0x30
+	.byte	0xf
+	.long	0x468
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0x7
+	.byte	0x34
+	.byte	0x7
+	.long	0x3e2
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x463
+	.uleb128 0x4
+	.long	.LASF1903
+	.byte	0x7
+	.byte	0x35
+	.byte	0x3
+	.long	0x408
+	.uleb128 0x11
+	.long	0x46d
+	.uleb128 0x4
+	.long	.LASF1904
+	.byte	0x8
+	.byte	0x19
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF1905
+	.byte	0x8
+	.byte	0x21
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1906
+	.uleb128 0x11
+	.long	0x496
+	.uleb128 0x27
+	.long	.LASF2110
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x16
+	.byte	0x18
+	.byte	0xe
+	.long	0x4fd
+	.uleb128 0x1
+	.long	.LASF1907
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1908
+	.byte	0x1
+	.uleb128 0x28
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1909
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1910
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1912
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1913
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1914
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1915
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0xb
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x9
+	.byte	0x3c
+	.long	0x54e
+	.uleb128 0x1
+	.long	.LASF1918
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x80
+	.uleb128 0x16
+	.long	.LASF1926
+	.value	0x100
+	.uleb128 0x16
+	.long	.LASF1927
+	.value	0x200
+	.uleb128 0x16
+	.long	.LASF1928
+	.value	0x400
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1978
+	.byte	0x9
+	.byte	0x4a
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xa
+	.byte	0x25
+	.long	0x5a8
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0xa
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xa
+	.byte	0x39
+	.long	0x5c0
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1942
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x3
+	.long	0x5a8
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xa
+	.byte	0x3e
+	.long	0x5ea
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1946
+	.byte	0xa
+	.byte	0x42
+	.byte	0x3
+	.long	0x5cc
+	.uleb128 0x14
+	.long	.LASF1947
+	.byte	0x3
+	.byte	0xa
+	.byte	0x44
+	.long	0x624
+	.uleb128 0x7
+	.string	"P"
+	.byte	0xa
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x7
+	.string	"I"
+	.byte	0xa
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x7
+	.string	"D"
+	.byte	0xa
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1948
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x5f6
+	.uleb128 0x14
+	.long	.LASF1949
+	.byte	0x4c
+	.byte	0xa
+	.byte	0x4a
+	.long	0x7a9
+	.uleb128 0x7
+	.string	"pid"
+	.byte	0xa
+	.byte	0x4b
+	.byte	0xc
+	.long	0x7ae
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1950
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1951
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1952
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1953
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1954
+	.byte	0xa
+	.byte	0x51
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1955
+	.byte	0xa
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1956
+	.byte	0xa
+	.byte	0x53
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF1957
+	.byte	0xa
+	.byte	0x54
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF1958
+	.byte	0xa
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF1959
+	.byte	0xa
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF1960
+	.byte	0xa
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1961
+	.byte	0xa
+	.byte	0x58
+	.byte	0xd
+	.long	0xb7
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF1962
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF1963
+	.byte	0xa
+	.byte	0x5b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF1964
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1965
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF1966
+	.byte	0xa
+	.byte	0x60
+	.byte	0xe
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1967
+	.byte	0xa
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF1968
+	.byte	0xa
+	.byte	0x62
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0xa
+	.byte	0x63
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1970
+	.byte	0xa
+	.byte	0x64
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF1971
+	.byte	0xa
+	.byte	0x65
+	.byte	0xe
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1972
+	.byte	0xa
+	.byte	0x66
+	.byte	0xe
+	.long	0xc3
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF1973
+	.byte	0xa
+	.byte	0x67
+	.byte	0xe
+	.long	0xc3
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF1974
+	.byte	0xa
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0xa
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x18
+	.long	0x5ea
+	.byte	0x48
+	.byte	0
+	.uleb128 0x11
+	.long	0x630
+	.uleb128 0xd
+	.long	0x624
+	.long	0x7be
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1977
+	.byte	0xa
+	.byte	0x6b
+	.byte	0x3
+	.long	0x630
+	.uleb128 0x11
+	.long	0x7be
+	.uleb128 0xd
+	.long	0x7be
+	.long	0x7df
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1979
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x15
+	.long	0x7cf
+	.uleb128 0x9
+	.long	.LASF1980
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x45
+	.long	0x7cf
+	.uleb128 0x14
+	.long	.LASF1981
+	.byte	0x1
+	.byte	0xa
+	.byte	0x6f
+	.long	0x811
+	.uleb128 0x2
+	.long	.LASF1982
+	.byte	0xa
+	.byte	0x70
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1983
+	.byte	0xa
+	.byte	0x71
+	.byte	0x3
+	.long	0x7f7
+	.uleb128 0x11
+	.long	0x811
+	.uleb128 0x9
+	.long	.LASF1984
+	.byte	0xa
+	.byte	0x73
+	.byte	0x14
+	.long	0x811
+	.uleb128 0x9
+	.long	.LASF1985
+	.byte	0xa
+	.byte	0x73
+	.byte	0x39
+	.long	0x811
+	.uleb128 0x9
+	.long	.LASF1986
+	.byte	0xa
+	.byte	0x78
+	.byte	0xe
+	.long	0x14d
+	.uleb128 0x9
+	.long	.LASF1987
+	.byte	0xa
+	.byte	0x78
+	.byte	0x1c
+	.long	0x14d
+	.uleb128 0x9
+	.long	.LASF1988
+	.byte	0xa
+	.byte	0x78
+	.byte	0x2a
+	.long	0x14d
+	.uleb128 0x1c
+	.long	.LASF1990
+	.byte	0xa
+	.byte	0x79
+	.byte	0x5
+	.long	0x496
+	.uleb128 0x9
+	.long	.LASF1991
+	.byte	0xa
+	.byte	0x7a
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x29
+	.byte	0x6
+	.byte	0xc
+	.byte	0x22
+	.byte	0x5
+	.long	0x8a7
+	.uleb128 0x2
+	.long	.LASF1992
+	.byte	0xc
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1993
+	.byte	0xc
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x7
+	.string	"yaw"
+	.byte	0xc
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x6
+	.byte	0xc
+	.byte	0x20
+	.byte	0x9
+	.long	0x8c9
+	.uleb128 0x19
+	.string	"raw"
+	.byte	0xc
+	.byte	0x21
+	.byte	0xd
+	.long	0x8c9
+	.uleb128 0x1f
+	.long	.LASF1994
+	.byte	0xc
+	.byte	0x27
+	.byte	0x7
+	.long	0x876
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x8d9
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1995
+	.byte	0xc
+	.byte	0x28
+	.byte	0x3
+	.long	0x8a7
+	.uleb128 0x9
+	.long	.LASF1996
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x8d9
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x901
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1997
+	.byte	0xd
+	.byte	0x2b
+	.byte	0x10
+	.long	0x8f1
+	.uleb128 0x14
+	.long	.LASF1998
+	.byte	0x10
+	.byte	0xe
+	.byte	0x40
+	.long	0x934
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0xe
+	.byte	0x41
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0xe
+	.byte	0x42
+	.byte	0xb
+	.long	0x14d
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2001
+	.byte	0xe
+	.byte	0x43
+	.byte	0x3
+	.long	0x90d
+	.uleb128 0x9
+	.long	.LASF2002
+	.byte	0xe
+	.byte	0x45
+	.byte	0xf
+	.long	0x934
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2003
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2004
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.long	0x984
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2010
+	.byte	0x4
+	.byte	0x10
+	.byte	0x35
+	.long	0x9ab
+	.uleb128 0x2
+	.long	.LASF1992
+	.byte	0x10
+	.byte	0x36
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1993
+	.byte	0x10
+	.byte	0x37
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2011
+	.byte	0x10
+	.byte	0x38
+	.byte	0x3
+	.long	0x984
+	.uleb128 0x2a
+	.long	.LASF2111
+	.byte	0x4
+	.byte	0x10
+	.byte	0x3a
+	.byte	0xf
+	.long	0x9dd
+	.uleb128 0x19
+	.string	"raw"
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xd
+	.long	0x8f1
+	.uleb128 0x1f
+	.long	.LASF1994
+	.byte	0x10
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x9ab
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2012
+	.byte	0x10
+	.byte	0x3d
+	.byte	0x3
+	.long	0x9b7
+	.uleb128 0x11
+	.long	0x9dd
+	.uleb128 0x15
+	.long	0x86a
+	.byte	0x35
+	.byte	0xa
+	.uleb128 0x5
+	.long	.LASF2013
+	.byte	0x36
+	.byte	0xc
+	.long	0x496
+	.uleb128 0x15
+	.long	0x83a
+	.byte	0x38
+	.byte	0x7
+	.uleb128 0x15
+	.long	0x846
+	.byte	0x38
+	.byte	0x15
+	.uleb128 0x15
+	.long	0x852
+	.byte	0x38
+	.byte	0x23
+	.uleb128 0x17
+	.string	"dT"
+	.byte	0x3a
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x9
+	.long	.LASF2014
+	.byte	0x11
+	.byte	0x3c
+	.byte	0x1a
+	.long	0x81d
+	.uleb128 0x15
+	.long	0x822
+	.byte	0x3c
+	.byte	0x41
+	.uleb128 0x15
+	.long	0x82e
+	.byte	0x3c
+	.byte	0x5f
+	.uleb128 0x9
+	.long	.LASF2015
+	.byte	0x11
+	.byte	0x3c
+	.byte	0x89
+	.long	0x479
+	.uleb128 0x20
+	.long	0xa39
+	.byte	0xb0
+	.uleb128 0x2b
+	.long	0xa1f
+	.byte	0x45
+	.byte	0x13
+	.uleb128 0x15
+	.long	0x7df
+	.byte	0x49
+	.byte	0x41
+	.uleb128 0x15
+	.long	0x7eb
+	.byte	0x49
+	.byte	0x6a
+	.uleb128 0x9
+	.long	.LASF2016
+	.byte	0x11
+	.byte	0x49
+	.byte	0x9e
+	.long	0x479
+	.uleb128 0x20
+	.long	0xa60
+	.byte	0xc7
+	.uleb128 0x5
+	.long	.LASF2017
+	.byte	0x8c
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0xd
+	.long	0x148
+	.long	0xa8d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	0xa7d
+	.uleb128 0x1c
+	.long	.LASF2018
+	.byte	0x11
+	.byte	0x97
+	.byte	0x15
+	.long	0xa8d
+	.uleb128 0x5
+	.long	.LASF2019
+	.byte	0x9a
+	.byte	0x15
+	.long	0x387
+	.uleb128 0x5
+	.long	.LASF2020
+	.byte	0x9b
+	.byte	0xc
+	.long	0x496
+	.uleb128 0xd
+	.long	0x204
+	.long	0xac4
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2021
+	.byte	0x9c
+	.byte	0x1b
+	.long	0xab4
+	.uleb128 0x5
+	.long	.LASF2022
+	.byte	0x9d
+	.byte	0x19
+	.long	0x262
+	.uleb128 0x5
+	.long	.LASF2023
+	.byte	0x9e
+	.byte	0xe
+	.long	0x96
+	.uleb128 0x17
+	.string	"Kp"
+	.byte	0xd7
+	.byte	0xe
+	.long	0x14d
+	.uleb128 0x17
+	.string	"Ki"
+	.byte	0xd7
+	.byte	0x15
+	.long	0x14d
+	.uleb128 0x17
+	.string	"Kd"
+	.byte	0xd7
+	.byte	0x1c
+	.long	0x14d
+	.uleb128 0x5
+	.long	.LASF2024
+	.byte	0xd7
+	.byte	0x23
+	.long	0x14d
+	.uleb128 0x5
+	.long	.LASF2025
+	.byte	0xd8
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF1968
+	.byte	0xd9
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2026
+	.byte	0xda
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2027
+	.byte	0xda
+	.byte	0x19
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2028
+	.byte	0xda
+	.byte	0x26
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2029
+	.byte	0xda
+	.byte	0x39
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2030
+	.byte	0xdb
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2031
+	.byte	0xdb
+	.byte	0x22
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2032
+	.byte	0xdb
+	.byte	0x34
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2033
+	.byte	0xdc
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF2034
+	.byte	0xdd
+	.byte	0x14
+	.long	0x47e
+	.uleb128 0x5
+	.long	.LASF2035
+	.byte	0xde
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2036
+	.byte	0xdf
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2037
+	.byte	0xe0
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF2038
+	.byte	0xe1
+	.byte	0xe
+	.long	0xe7
+	.uleb128 0xb
+	.long	.LASF2039
+	.byte	0x12
+	.byte	0x15
+	.byte	0x7
+	.long	0xe7
+	.long	0xbc9
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2040
+	.byte	0x12
+	.byte	0x16
+	.byte	0x7
+	.long	0xe7
+	.long	0xbdf
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2041
+	.byte	0x13
+	.byte	0x6f
+	.byte	0x5
+	.long	0x496
+	.long	0xbfa
+	.uleb128 0x3
+	.long	0x7c
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2042
+	.byte	0x12
+	.byte	0x14
+	.byte	0x7
+	.long	0xe7
+	.long	0xc10
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2043
+	.byte	0x6
+	.byte	0x8c
+	.byte	0x7
+	.long	0xe7
+	.long	0xc2b
+	.uleb128 0x3
+	.long	0xc2b
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0x8
+	.long	0x204
+	.uleb128 0x18
+	.long	.LASF2044
+	.byte	0x6
+	.byte	0x89
+	.long	0xc46
+	.uleb128 0x3
+	.long	0xc46
+	.uleb128 0x3
+	.long	0x258
+	.byte	0
+	.uleb128 0x8
+	.long	0x387
+	.uleb128 0x2c
+	.long	.LASF2045
+	.byte	0x13
+	.byte	0x6e
+	.byte	0x7
+	.long	0xe7
+	.long	0xc5d
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2112
+	.byte	0x12
+	.byte	0x17
+	.byte	0x7
+	.long	0xe7
+	.uleb128 0x18
+	.long	.LASF2046
+	.byte	0x13
+	.byte	0x74
+	.long	0xc7a
+	.uleb128 0x3
+	.long	0xc7a
+	.byte	0
+	.uleb128 0x8
+	.long	0x7a9
+	.uleb128 0x18
+	.long	.LASF2047
+	.byte	0x6
+	.byte	0x74
+	.long	0xc9a
+	.uleb128 0x3
+	.long	0xc9a
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0x8
+	.long	0x19a
+	.uleb128 0xb
+	.long	.LASF2048
+	.byte	0x6
+	.byte	0x75
+	.byte	0x7
+	.long	0xe7
+	.long	0xcba
+	.uleb128 0x3
+	.long	0xc9a
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2049
+	.byte	0x6
+	.byte	0x68
+	.byte	0x7
+	.long	0xe7
+	.long	0xcd5
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2050
+	.byte	0x6
+	.byte	0x8b
+	.long	0xcf0
+	.uleb128 0x3
+	.long	0xc2b
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xc3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2051
+	.byte	0x6
+	.byte	0x84
+	.byte	0x14
+	.long	0xd10
+	.long	0xd10
+	.uleb128 0x3
+	.long	0xc46
+	.uleb128 0x3
+	.long	0xe7
+	.uleb128 0x3
+	.long	0xcf
+	.byte	0
+	.uleb128 0x8
+	.long	0x337
+	.uleb128 0xb
+	.long	.LASF2052
+	.byte	0x6
+	.byte	0x83
+	.byte	0x14
+	.long	0xd10
+	.long	0xd35
+	.uleb128 0x3
+	.long	0xc46
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2053
+	.byte	0x6
+	.byte	0x85
+	.byte	0x14
+	.long	0xd10
+	.long	0xd64
+	.uleb128 0x3
+	.long	0xc46
+	.uleb128 0x3
+	.long	0x2a5
+	.uleb128 0x3
+	.long	0xe7
+	.uleb128 0x3
+	.long	0xcf
+	.uleb128 0x3
+	.long	0xe7
+	.uleb128 0x3
+	.long	0x24c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2054
+	.byte	0x6
+	.byte	0x6f
+	.byte	0x7
+	.long	0xe7
+	.long	0xd7f
+	.uleb128 0x3
+	.long	0xc3
+	.uleb128 0x3
+	.long	0xc3
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2055
+	.byte	0x6
+	.byte	0x82
+	.long	0xd95
+	.uleb128 0x3
+	.long	0xc46
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2056
+	.byte	0x14
+	.byte	0x2b
+	.byte	0xe
+	.long	0x96
+	.long	0xdb5
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0xdb5
+	.uleb128 0x3
+	.long	0xdb
+	.byte	0
+	.uleb128 0x8
+	.long	0xdba
+	.uleb128 0x2f
+	.uleb128 0x30
+	.long	.LASF2086
+	.byte	0x11
+	.value	0x162
+	.byte	0x6
+	.long	0xeef
+	.uleb128 0xf
+	.long	.LASF2057
+	.value	0x162
+	.byte	0x28
+	.long	0xeef
+	.uleb128 0xf
+	.long	.LASF2058
+	.value	0x162
+	.byte	0x4f
+	.long	0xef4
+	.uleb128 0xf
+	.long	.LASF2000
+	.value	0x162
+	.byte	0x67
+	.long	0x25d
+	.uleb128 0xf
+	.long	.LASF2059
+	.value	0x162
+	.byte	0x7a
+	.long	0x48a
+	.uleb128 0x6
+	.long	.LASF2060
+	.value	0x166
+	.byte	0x12
+	.long	0xef9
+	.uleb128 0x6
+	.long	.LASF2061
+	.value	0x167
+	.byte	0x11
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2062
+	.value	0x168
+	.byte	0x11
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2063
+	.value	0x169
+	.byte	0x10
+	.long	0x496
+	.uleb128 0x6
+	.long	.LASF2064
+	.value	0x16a
+	.byte	0x15
+	.long	0x48a
+	.uleb128 0x6
+	.long	.LASF2065
+	.value	0x16d
+	.byte	0x11
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2066
+	.value	0x170
+	.byte	0xb
+	.long	0xef9
+	.uleb128 0x1a
+	.long	0xe5e
+	.uleb128 0x6
+	.long	.LASF2067
+	.value	0x173
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	.LASF2067
+	.value	0x179
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	.LASF2068
+	.value	0x17a
+	.byte	0xf
+	.long	0xe7
+	.uleb128 0x6
+	.long	.LASF2069
+	.value	0x193
+	.byte	0x15
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2070
+	.value	0x19a
+	.byte	0x15
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2071
+	.value	0x1a3
+	.byte	0x15
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2072
+	.value	0x1a4
+	.byte	0x15
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2073
+	.value	0x1a5
+	.byte	0x13
+	.long	0x49d
+	.uleb128 0x1a
+	.long	0xec6
+	.uleb128 0x6
+	.long	.LASF2074
+	.value	0x186
+	.byte	0x19
+	.long	0xee
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	.LASF2075
+	.value	0x1ad
+	.byte	0x13
+	.long	0xe7
+	.uleb128 0x31
+	.string	"rD"
+	.byte	0x11
+	.value	0x1b1
+	.byte	0x19
+	.long	0xee
+	.uleb128 0x6
+	.long	.LASF2076
+	.value	0x1b3
+	.byte	0x13
+	.long	0xe7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x7ca
+	.uleb128 0x8
+	.long	0x9e9
+	.uleb128 0xd
+	.long	0xe7
+	.long	0xf09
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2079
+	.value	0x154
+	.long	0xe7
+	.long	0xf49
+	.uleb128 0xf
+	.long	.LASF2067
+	.value	0x154
+	.byte	0x24
+	.long	0x7c
+	.uleb128 0xf
+	.long	.LASF2068
+	.value	0x154
+	.byte	0x30
+	.long	0xe7
+	.uleb128 0x6
+	.long	.LASF2077
+	.value	0x155
+	.byte	0x12
+	.long	0x14d
+	.uleb128 0x6
+	.long	.LASF2078
+	.value	0x156
+	.byte	0x11
+	.long	0xee
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2080
+	.value	0x140
+	.long	0xe7
+	.long	0xfaf
+	.uleb128 0xf
+	.long	.LASF2067
+	.value	0x140
+	.byte	0x1b
+	.long	0x7c
+	.uleb128 0xf
+	.long	.LASF2057
+	.value	0x140
+	.byte	0x35
+	.long	0xeef
+	.uleb128 0xf
+	.long	.LASF2058
+	.value	0x140
+	.byte	0x5c
+	.long	0xef4
+	.uleb128 0xf
+	.long	.LASF2068
+	.value	0x140
+	.byte	0x6d
+	.long	0xe7
+	.uleb128 0x6
+	.long	.LASF2081
+	.value	0x142
+	.byte	0xb
+	.long	0xe7
+	.uleb128 0x6
+	.long	.LASF2074
+	.value	0x147
+	.byte	0x11
+	.long	0xee
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	.LASF2082
+	.value	0x14e
+	.byte	0x15
+	.long	0xee
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2106
+	.byte	0x11
+	.value	0x105
+	.byte	0xe
+	.long	0xe7
+	.long	0x1007
+	.uleb128 0x6
+	.long	.LASF2082
+	.value	0x107
+	.byte	0xb
+	.long	0xe7
+	.uleb128 0x6
+	.long	.LASF2083
+	.value	0x10b
+	.byte	0x11
+	.long	0xee
+	.uleb128 0x1a
+	.long	0xfea
+	.uleb128 0x6
+	.long	.LASF2084
+	.value	0x116
+	.byte	0x19
+	.long	0xee
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	.LASF2085
+	.value	0x126
+	.byte	0xf
+	.long	0xe7
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	.LASF2084
+	.value	0x12b
+	.byte	0x19
+	.long	0xee
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2087
+	.byte	0xfc
+	.long	0x101e
+	.uleb128 0x13
+	.long	.LASF2057
+	.byte	0x11
+	.byte	0xfc
+	.byte	0x22
+	.long	0xeef
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2088
+	.byte	0xe3
+	.long	0x1042
+	.uleb128 0x13
+	.long	.LASF2057
+	.byte	0x11
+	.byte	0xe3
+	.byte	0x28
+	.long	0xeef
+	.uleb128 0x10
+	.uleb128 0x5
+	.long	.LASF2067
+	.byte	0xe4
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2089
+	.byte	0xa0
+	.long	0x1098
+	.uleb128 0x13
+	.long	.LASF2057
+	.byte	0x11
+	.byte	0xa0
+	.byte	0x29
+	.long	0xeef
+	.uleb128 0x5
+	.long	.LASF2090
+	.byte	0xa4
+	.byte	0x18
+	.long	0x19a
+	.uleb128 0x5
+	.long	.LASF2091
+	.byte	0xa6
+	.byte	0xe
+	.long	0xcf
+	.uleb128 0x5
+	.long	.LASF2092
+	.byte	0xa8
+	.byte	0xb
+	.long	0xe7
+	.uleb128 0x1a
+	.long	0x108a
+	.uleb128 0x5
+	.long	.LASF2093
+	.byte	0xb7
+	.byte	0x15
+	.long	0xee
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.long	.LASF2067
+	.byte	0xc7
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2094
+	.byte	0x92
+	.long	0x10af
+	.uleb128 0x13
+	.long	.LASF2095
+	.byte	0x11
+	.byte	0x92
+	.byte	0x34
+	.long	0x5c0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2096
+	.byte	0x8e
+	.long	0x10c6
+	.uleb128 0x13
+	.long	.LASF2097
+	.byte	0x11
+	.byte	0x8e
+	.byte	0x23
+	.long	0xe7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2098
+	.byte	0x85
+	.long	0x10de
+	.uleb128 0x10
+	.uleb128 0x5
+	.long	.LASF2067
+	.byte	0x87
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2099
+	.byte	0x7f
+	.long	0x10f5
+	.uleb128 0x13
+	.long	.LASF2100
+	.byte	0x11
+	.byte	0x7f
+	.byte	0x24
+	.long	0xcf
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2101
+	.byte	0x78
+	.long	0x1117
+	.uleb128 0x13
+	.long	.LASF2102
+	.byte	0x11
+	.byte	0x78
+	.byte	0x2a
+	.long	0x1117
+	.uleb128 0x10
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x7a
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x7be
+	.uleb128 0x12
+	.long	.LASF2103
+	.byte	0x4b
+	.long	0x113e
+	.uleb128 0x13
+	.long	.LASF2057
+	.byte	0x11
+	.byte	0x4b
+	.byte	0x24
+	.long	0x1117
+	.uleb128 0x5
+	.long	.LASF2104
+	.byte	0x4d
+	.byte	0x25
+	.long	0x7ca
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2113
+	.byte	0xa
+	.byte	0x73
+	.byte	0x6a
+	.long	0x114a
+	.uleb128 0x8
+	.long	0x81d
+	.uleb128 0x34
+	.long	.LASF2105
+	.byte	0x8
+	.byte	0x25
+	.byte	0x1b
+	.long	0x47e
+	.long	0x1174
+	.uleb128 0x1b
+	.string	"a"
+	.byte	0x8
+	.byte	0x25
+	.byte	0x2e
+	.long	0x48a
+	.uleb128 0x1b
+	.string	"b"
+	.byte	0x8
+	.byte	0x25
+	.byte	0x3a
+	.long	0x48a
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2107
+	.byte	0x15
+	.byte	0x88
+	.byte	0x15
+	.long	0xe7
+	.uleb128 0x1b
+	.string	"amt"
+	.byte	0x15
+	.byte	0x88
+	.byte	0x26
+	.long	0xe7
+	.uleb128 0x1b
+	.string	"low"
+	.byte	0x15
+	.byte	0x88
+	.byte	0x31
+	.long	0xe7
+	.uleb128 0x13
+	.long	.LASF2108
+	.byte	0x15
+	.byte	0x88
+	.byte	0x3c
+	.long	0xe7
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 41 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2b
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 52 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.file 53 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 54 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 55 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 56 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 57 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 58 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 59 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 60 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3c
+	.file 61 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 62 "./src/main/fc/fc_core.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1565
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x13
+	.file 63 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x40
+	.file 65 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1602
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xe
+	.file 66 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x42
+	.file 67 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.file 68 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x10
+	.file 69 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x45
+	.file 70 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x46
+	.byte	0x4
+	.file 71 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 72 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1718
+	.file 73 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1721
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1730
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1735
+	.byte	0x4
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 81 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1768
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1769
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1770
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1771
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1772
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1773
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1774
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1775
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1776
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1788
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1795
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1796
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1797
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1800
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x61
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1801
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1835
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1417
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1422
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1425
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1429
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1472
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1592
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1601
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1608
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1717
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1725
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1727
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1752
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1822
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1834
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2114
+	.long	.LASF2115
+	.long	.LASF2116
+	.long	.LASF2117
+	.long	.LASF2118
+	.long	.LASF2119
+	.long	.LASF2120
+	.long	.LASF2121
+	.long	.LASF2122
+	.long	.LASF2123
+	.long	.LASF2124
+	.long	.LASF2125
+	.long	.LASF2126
+	.long	.LASF2127
+	.long	.LASF2128
+	.long	.LASF2129
+	.long	.LASF2130
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x63
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2131
+	.byte	0xd
+	.long	.LASF2132
+	.byte	0xd
+	.long	.LASF2133
+	.byte	0xd
+	.long	.LASF2134
+	.byte	0x11
+	.long	.LASF2135
+	.byte	0x2
+	.long	.LASF2136
+	.byte	0x2
+	.long	.LASF2137
+	.byte	0x3
+	.long	.LASF2138
+	.byte	0x2
+	.long	.LASF2139
+	.byte	0x6
+	.long	.LASF2140
+	.byte	0x7
+	.long	.LASF2141
+	.byte	0x9
+	.long	.LASF2142
+	.byte	0x7
+	.long	.LASF2143
+	.byte	0x7
+	.long	.LASF2144
+	.byte	0x8
+	.long	.LASF2145
+	.byte	0x8
+	.long	.LASF2146
+	.byte	0x8
+	.long	.LASF2147
+	.byte	0x7
+	.long	.LASF2148
+	.byte	0x6
+	.long	.LASF2149
+	.byte	0x7
+	.long	.LASF2150
+	.byte	0x10
+	.long	.LASF2151
+	.byte	0x2
+	.long	.LASF2152
+	.byte	0x6
+	.long	.LASF2153
+	.byte	0x10
+	.long	.LASF2154
+	.byte	0x11
+	.long	.LASF2155
+	.byte	0x11
+	.long	.LASF2155
+	.byte	0x10
+	.long	.LASF2156
+	.byte	0xd
+	.long	.LASF2157
+	.byte	0x10
+	.long	.LASF2158
+	.byte	0x10
+	.long	.LASF2159
+	.byte	0xd
+	.long	.LASF2160
+	.byte	0xd
+	.long	.LASF2161
+	.byte	0xf
+	.long	.LASF2162
+	.byte	0xd
+	.long	.LASF2163
+	.byte	0xe
+	.long	.LASF2164
+	.byte	0xe
+	.long	.LASF2165
+	.byte	0xd
+	.long	.LASF2166
+	.byte	0xd
+	.long	.LASF2167
+	.byte	0xd
+	.long	.LASF2168
+	.byte	0xc
+	.long	.LASF2169
+	.byte	0xc
+	.long	.LASF2170
+	.byte	0x10
+	.long	.LASF2171
+	.byte	0x10
+	.long	.LASF2172
+	.byte	0xd
+	.long	.LASF2173
+	.byte	0xd
+	.long	.LASF2174
+	.byte	0xd
+	.long	.LASF2175
+	.byte	0xd
+	.long	.LASF2176
+	.byte	0xd
+	.long	.LASF2177
+	.byte	0xd
+	.long	.LASF2178
+	.byte	0xd
+	.long	.LASF2179
+	.byte	0xd
+	.long	.LASF2180
+	.byte	0xd
+	.long	.LASF2181
+	.byte	0xb
+	.long	.LASF2182
+	.byte	0xa
+	.long	.LASF2183
+	.byte	0xa
+	.long	.LASF2184
+	.byte	0x1
+	.long	.LASF2185
+	.byte	0x1
+	.long	.LASF2186
+	.byte	0x1
+	.long	.LASF2187
+	.byte	0x3
+	.long	.LASF2188
+	.byte	0x3
+	.long	.LASF2189
+	.byte	0x5
+	.long	.LASF2190
+	.byte	0x5
+	.long	.LASF2191
+	.byte	0x6
+	.long	.LASF2192
+	.byte	0x5
+	.long	.LASF2193
+	.byte	0x5
+	.long	.LASF2194
+	.byte	0x5
+	.long	.LASF2195
+	.byte	0x5
+	.long	.LASF2196
+	.byte	0x5
+	.long	.LASF2197
+	.byte	0x5
+	.long	.LASF2198
+	.byte	0x4
+	.long	.LASF2199
+	.byte	0x5
+	.long	.LASF2200
+	.byte	0x4
+	.long	.LASF2201
+	.byte	0x10
+	.long	.LASF2202
+	.byte	0x10
+	.long	.LASF2203
+	.byte	0xc
+	.long	.LASF2204
+	.byte	0xc
+	.long	.LASF2205
+	.byte	0xd
+	.long	.LASF2206
+	.byte	0xd
+	.long	.LASF2202
+	.byte	0xd
+	.long	.LASF2207
+	.byte	0xc
+	.long	.LASF2208
+	.byte	0xd
+	.long	.LASF2138
+	.byte	0x10
+	.long	.LASF2138
+	.byte	0xd
+	.long	.LASF2209
+	.byte	0xc
+	.long	.LASF2210
+	.byte	0xc
+	.long	.LASF2211
+	.byte	0xc
+	.long	.LASF2212
+	.byte	0xc
+	.long	.LASF2213
+	.byte	0xc
+	.long	.LASF2214
+	.byte	0xd
+	.long	.LASF2215
+	.byte	0xd
+	.long	.LASF2216
+	.byte	0xd
+	.long	.LASF2217
+	.byte	0xd
+	.long	.LASF2218
+	.byte	0xd
+	.long	.LASF2219
+	.byte	0xd
+	.long	.LASF2220
+	.byte	0xd
+	.long	.LASF2221
+	.byte	0xc
+	.long	.LASF2222
+	.byte	0xc
+	.long	.LASF2223
+	.byte	0xd
+	.long	.LASF2224
+	.byte	0xd
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1570:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1742:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1448:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1685:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2075:
+	.string	"dynC"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2060:
+	.string	"previousRateError"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF2034:
+	.string	"crashTimeLimitUs"
+.LASF1434:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1751:
+	.string	"sched_priority sched_priority"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF1615:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1943:
+	.string	"PID_CRASH_RECOVERY_OFF"
+.LASF1990:
+	.string	"airmodeWasActivated"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1723:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1657:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1730:
+	.string	"__pid_t_defined "
+.LASF1425:
+	.string	"TRACE_END(event,arg) {}"
+.LASF1565:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1455:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1868:
+	.string	"targetCount"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1841:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1752:
+	.string	"__sched_priority sched_priority"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1906:
+	.string	"_Bool"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1609:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2059:
+	.string	"currentTimeUs"
+.LASF1879:
+	.string	"filterApplyFnPtr"
+.LASF1737:
+	.string	"__CPU_SETSIZE 1024"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1761:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1767:
+	.string	"TIMER_ABSTIME 1"
+.LASF1981:
+	.string	"pidConfig_s"
+.LASF1983:
+	.string	"pidConfig_t"
+.LASF1517:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2078:
+	.string	"currentVelocity"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2094:
+	.string	"pidStabilisationState"
+.LASF1837:
+	.string	"short unsigned int"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF1617:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2081:
+	.string	"angle"
+.LASF1518:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1510:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1709:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1985:
+	.string	"pidConfig_Copy"
+.LASF1474:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1864:
+	.string	"pt1Filter_t"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1852:
+	.string	"uint16_t"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF1830:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1495:
+	.string	"PG_RX_CONFIG 24"
+.LASF1741:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2039:
+	.string	"getRcDeflection"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1564:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1465:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF2064:
+	.string	"crashDetectedAtUs"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1697:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1634:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1506:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1478:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1659:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1923:
+	.string	"GPS_HOLD_MODE"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1491:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1831:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1625:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1735:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF2072:
+	.string	"ITermNew"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1566:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1437:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1988:
+	.string	"axisPID_D"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1514:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1986:
+	.string	"axisPID_P"
+.LASF1605:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1672:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1931:
+	.string	"PID_YAW"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1472:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF1608:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF1850:
+	.string	"int32_t"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1432:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1422:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1690:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1682:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF2036:
+	.string	"crashRecoveryRate"
+.LASF1553:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1982:
+	.string	"pid_process_denom"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1584:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF1987:
+	.string	"axisPID_I"
+.LASF1633:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2056:
+	.string	"memcpy"
+.LASF1878:
+	.string	"biquadFilterType_e"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1874:
+	.string	"FILTER_FIR"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1991:
+	.string	"targetPidLooptime"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2061:
+	.string	"tpaFactor"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1511:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2028:
+	.string	"horizonTransition"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1524:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF1895:
+	.string	"PGR_SIZE_MASK"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF1780:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1665:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1815:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF1616:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2054:
+	.string	"filterGetNotchQ"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF1711:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1562:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF1755:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2018:
+	.string	"rcAliasToAngleIndexMap"
+.LASF1600:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF1644:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1734:
+	.string	"SCHED_RR 2"
+.LASF2092:
+	.string	"dTermNotchHz"
+.LASF1576:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2077:
+	.string	"previousSetpoint"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF1869:
+	.string	"index"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF1543:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1467:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1631:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1787:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1918:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1469:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1956:
+	.string	"pidSumLimit"
+.LASF1963:
+	.string	"horizon_tilt_effect"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1904:
+	.string	"timeDelta_t"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1583:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1825:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1486:
+	.string	"PG_PID_PROFILE 14"
+.LASF1951:
+	.string	"dterm_lpf_hz"
+.LASF2053:
+	.string	"filterBankAddBiquad"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1810:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2080:
+	.string	"pidLevel"
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1503:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1547:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1619:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1302:
+	.string	"ACC "
+.LASF1750:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1638:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1485:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF1589:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1823:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1587:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1763:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1651:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1885:
+	.string	"type"
+.LASF1726:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1447:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1839:
+	.string	"long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1526:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1992:
+	.string	"roll"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1842:
+	.string	"__int16_t"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2104:
+	.string	"_reset_template_77"
+.LASF1954:
+	.string	"dterm_notch_cutoff"
+.LASF1844:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1578:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1683:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF398:
+	.string	"false 0"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1870:
+	.string	"movingSum"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1441:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1705:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1602:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF1804:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF2067:
+	.string	"axis"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1567:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1563:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1972:
+	.string	"crash_gthreshold"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1431:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1708:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1603:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2049:
+	.string	"nullFilterApply"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1612:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1758:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1867:
+	.string	"filledCount"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1548:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1919:
+	.string	"HORIZON_MODE"
+.LASF1816:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1836:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1754:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1558:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1561:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2073:
+	.string	"outputSaturated"
+.LASF2090:
+	.string	"pt1FilterYaw"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF1504:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF364:
+	.string	"__k8 1"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1487:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF1573:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2082:
+	.string	"horizonLevelStrength"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1482:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1738:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1813:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF1648:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1928:
+	.string	"FAILSAFE_MODE"
+.LASF1304:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1997:
+	.string	"GPS_angle"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2086:
+	.string	"pidController"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF1784:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF1898:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2076:
+	.string	"delta"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1412:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1704:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2026:
+	.string	"levelGain"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1652:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1872:
+	.string	"FILTER_PT1"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1427:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1621:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF1807:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2048:
+	.string	"pt1FilterApply"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF2035:
+	.string	"crashRecoveryAngleDeciDegrees"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1692:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1910:
+	.string	"AUX1"
+.LASF1911:
+	.string	"AUX2"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1915:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1917:
+	.string	"AUX8"
+.LASF1489:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2108:
+	.string	"high"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1626:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF1907:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2106:
+	.string	"calcHorizonLevelStrength"
+.LASF1661:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1667:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2084:
+	.string	"inclinationLevelRatio"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF2017:
+	.string	"itermAccelerator"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF382:
+	.string	"unix 1"
+.LASF1964:
+	.string	"horizon_tilt_expert_mode"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1803:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1649:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1771:
+	.string	"__timer_t_defined 1"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1893:
+	.string	"PGR_PGN_MASK"
+.LASF2091:
+	.string	"pidFrequencyNyquist"
+.LASF2079:
+	.string	"accelerationLimit"
+.LASF1689:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1435:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1798:
+	.string	"____sigset_t_defined "
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1719:
+	.string	"_SCHED_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1606:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1622:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1588:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1519:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1718:
+	.string	"_PTHREAD_H 1"
+.LASF1545:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1826:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1568:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1646:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1630:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2023:
+	.string	"ptermYawFilter"
+.LASF1671:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1899:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2007:
+	.string	"SENSOR_INDEX_BARO"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1529:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1921:
+	.string	"BARO_MODE"
+.LASF2022:
+	.string	"ptermYawFilterApplyFn"
+.LASF1417:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1712:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1552:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1458:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1637:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1457:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1812:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1854:
+	.string	"size_t"
+.LASF1764:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1618:
+	.string	"ALL_MOTORS 255"
+.LASF1920:
+	.string	"MAG_MODE"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1851:
+	.string	"uint8_t"
+.LASF1822:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF2088:
+	.string	"pidInitConfig"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1594:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1890:
+	.string	"stage"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1788:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1452:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF2008:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1669:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF1908:
+	.string	"PITCH"
+.LASF1433:
+	.string	"VERY_FAST_MATH "
+.LASF1328:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1930:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1962:
+	.string	"levelSensitivity"
+.LASF1670:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1556:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1818:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1873:
+	.string	"FILTER_BIQUAD"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1789:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF1306:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2013:
+	.string	"pidStabilisationEnabled"
+.LASF1743:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1461:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1858:
+	.string	"FD_PITCH"
+.LASF1961:
+	.string	"levelAngleLimit"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1604:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1411:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1507:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF2025:
+	.string	"relaxFactor"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF2068:
+	.string	"currentPidSetpoint"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1940:
+	.string	"PID_STABILISATION_OFF"
+.LASF2103:
+	.string	"resetPidProfile"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1535:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1706:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1533:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1497:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1464:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1502:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1623:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2052:
+	.string	"filterBankAddPt1"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2102:
+	.string	"pidProfiles"
+.LASF1724:
+	.string	"__BIG_ENDIAN 4321"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1451:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF1945:
+	.string	"PID_CRASH_RECOVERY_BEEP"
+.LASF1546:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF2089:
+	.string	"pidInitFilters"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2051:
+	.string	"filterBankAddBiquadLPF"
+.LASF1946:
+	.string	"pidCrashRecovery_e"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1560:
+	.string	"IO_TAG_NONE 0"
+.LASF1808:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1574:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1614:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2063:
+	.string	"inCrashRecoveryMode"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1681:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF2065:
+	.string	"dynKi"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1632:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1544:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1419:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2095:
+	.string	"pidControllerState"
+.LASF1453:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1732:
+	.string	"SCHED_OTHER 0"
+.LASF1900:
+	.string	"address"
+.LASF1445:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1571:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1770:
+	.string	"__clockid_t_defined 1"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1999:
+	.string	"targetLooptime"
+.LASF721:
+	.string	"NULL"
+.LASF1731:
+	.string	"_BITS_SCHED_H 1"
+.LASF1668:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1938:
+	.string	"PID_VEL"
+.LASF1796:
+	.string	"__have_pthread_attr_t 1"
+.LASF1993:
+	.string	"pitch"
+.LASF719:
+	.string	"__size_t "
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1520:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF468:
+	.string	"__PMT"
+.LASF1927:
+	.string	"SONAR_MODE"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2062:
+	.string	"motorMixRange"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1786:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1970:
+	.string	"rateAccelLimit"
+.LASF1934:
+	.string	"PID_POSR"
+.LASF1949:
+	.string	"pidProfile_s"
+.LASF1977:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1653:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1521:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1883:
+	.string	"filterBankStageType_e"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1998:
+	.string	"gyro_s"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF2001:
+	.string	"gyro_t"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1592:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1896:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2038:
+	.string	"crashGyroThreshold"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1479:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2112:
+	.string	"getThrottlePIDAttenuation"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1446:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1611:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1415:
+	.string	"UNIT_TESTED "
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1783:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF2071:
+	.string	"ITerm"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1643:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1694:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1781:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1470:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2109:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1473:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1640:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1462:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1554:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2096:
+	.string	"pidSetItermAccelerator"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1958:
+	.string	"dterm_average_count"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1980:
+	.string	"pidProfiles_CopyArray"
+.LASF1536:
+	.string	"PG_PID_CONFIG 504"
+.LASF1785:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1942:
+	.string	"pidStabilisationState_e"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2055:
+	.string	"filterBankInit"
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1585:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1684:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1833:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1775:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1959:
+	.string	"vbatPidCompensation"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2058:
+	.string	"angleTrim"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2006:
+	.string	"SENSOR_INDEX_ACC"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1782:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF1426:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF1579:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1677:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1265:
+	.string	"CMS "
+.LASF1902:
+	.string	"reset"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2003:
+	.string	"long long unsigned int"
+.LASF1480:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1674:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1736:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1924:
+	.string	"HEADFREE_MODE"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2002:
+	.string	"gyro"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1678:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1635:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1882:
+	.string	"FILTER_BANK_STAGE_BIQUAD_DF1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1717:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1420:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1840:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1456:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1488:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1720:
+	.string	"__time_t_defined 1"
+.LASF2074:
+	.string	"errorAngle"
+.LASF1639:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1430:
+	.string	"sq(x) ((x)*(x))"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2046:
+	.string	"pidInitMixer"
+.LASF1795:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF2024:
+	.string	"maxVelocity"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1820:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1774:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF1691:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1572:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF1857:
+	.string	"FD_ROLL"
+.LASF1496:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1989:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1884:
+	.string	"filterBankStage_s"
+.LASF1460:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1500:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1773:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1863:
+	.string	"state"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1483:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1555:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1811:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1894:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF2047:
+	.string	"pt1FilterInit"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1539:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2016:
+	.string	"pidProfiles_Registry"
+.LASF1590:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF1569:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1601:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1428:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1459:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1966:
+	.string	"itermAcceleratorGain"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF1974:
+	.string	"crash_recovery_angle"
+.LASF1772:
+	.string	"__itimerspec_defined 1"
+.LASF1935:
+	.string	"PID_NAVR"
+.LASF1889:
+	.string	"stageCount"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2031:
+	.string	"ITermWindupPoint"
+.LASF1696:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF1525:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1285:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1753:
+	.string	"_TIME_H 1"
+.LASF1499:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1610:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1859:
+	.string	"FD_YAW"
+.LASF1847:
+	.string	"long int"
+.LASF1886:
+	.string	"filterBankStage_t"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1492:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1537:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1664:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1442:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1829:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1976:
+	.string	"crash_recovery"
+.LASF1747:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1779:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1550:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1881:
+	.string	"FILTER_BANK_STAGE_BIQUAD"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1760:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1800:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF1721:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1746:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1769:
+	.string	"__struct_tm_defined 1"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1762:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2041:
+	.string	"mixerIsOutputSaturated"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1801:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1654:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1471:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1827:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2040:
+	.string	"getRcDeflectionAbs"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1853:
+	.string	"uint32_t"
+.LASF1715:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF1581:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1468:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1768:
+	.string	"__clock_t_defined 1"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1805:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2105:
+	.string	"cmpTimeUs"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1596:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2037:
+	.string	"crashDtermThreshold"
+.LASF2070:
+	.string	"errorRate"
+.LASF1438:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1580:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1759:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1416:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1515:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1806:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1475:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1688:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1835:
+	.string	"PID_PROCESS_DENOM_DEFAULT 2"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1716:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1957:
+	.string	"pidSumLimitYaw"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1516:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1968:
+	.string	"dtermSetpointWeight"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1628:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1693:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1971:
+	.string	"crash_dthreshold"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1577:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1582:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1642:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1559:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF2087:
+	.string	"pidInit"
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF397:
+	.string	"true 1"
+.LASF1676:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1439:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1575:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1901:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1650:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF701:
+	.string	"__need_NULL "
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF1421:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1950:
+	.string	"dterm_filter_type"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1508:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1929:
+	.string	"PID_ROLL"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1778:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF2113:
+	.string	"pidConfig"
+.LASF2101:
+	.string	"pgResetFn_pidProfiles"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2029:
+	.string	"horizonCutoffDegrees"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1922:
+	.string	"GPS_HOME_MODE"
+.LASF1794:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1766:
+	.string	"CLOCK_TAI 11"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1513:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2099:
+	.string	"pidSetTargetLooptime"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1413:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1687:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1423:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF1745:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1591:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1756:
+	.string	"CLOCK_REALTIME 0"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2033:
+	.string	"horizonTiltExpertMode"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1797:
+	.string	"_BITS_SETJMP_H 1"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF1832:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1757:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2098:
+	.string	"pidResetErrorGyroState"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1551:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF377:
+	.string	"__linux 1"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1538:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2014:
+	.string	"pgResetTemplate_pidConfig"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1748:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1975:
+	.string	"crash_recovery_rate"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1792:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1597:
+	.string	"PIDSUM_LIMIT 500"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2015:
+	.string	"pidConfig_Registry"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF1791:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2011:
+	.string	"rollAndPitchTrims_t_def"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1490:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1909:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1727:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1466:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1528:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF1856:
+	.string	"double"
+.LASF1656:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1599:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1613:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1725:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1933:
+	.string	"PID_POS"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF1686:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1728:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2042:
+	.string	"getSetpointRate"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1953:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1821:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF1955:
+	.string	"itermWindupPointPercent"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1641:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1865:
+	.string	"pt1Filter_s"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1845:
+	.string	"__int32_t"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1846:
+	.string	"__uint32_t"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF1440:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1450:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1662:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1493:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1444:
+	.string	"Q12 (1 << 12)"
+.LASF1476:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1695:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1522:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1501:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2097:
+	.string	"newItermAccelerator"
+.LASF1549:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1824:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF1729:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF1834:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1477:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2027:
+	.string	"horizonGain"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1880:
+	.string	"FILTER_BANK_STAGE_PT1"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1944:
+	.string	"PID_CRASH_RECOVERY_ON"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF2020:
+	.string	"dtermDenoiseEnabled"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1498:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1866:
+	.string	"firFilterDenoise_s"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1936:
+	.string	"PID_LEVEL"
+.LASF1871:
+	.string	"firFilterDenoise_t"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1527:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF1912:
+	.string	"AUX3"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF1913:
+	.string	"AUX4"
+.LASF1875:
+	.string	"FILTER_LPF"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1627:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF1984:
+	.string	"pidConfig_System"
+.LASF1916:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1714:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1673:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1978:
+	.string	"flightModeFlags"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1967:
+	.string	"setpointRelaxRatio"
+.LASF1436:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2110:
+	.string	"rc_alias"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF1888:
+	.string	"channelCount"
+.LASF2066:
+	.string	"gyroRateFiltered"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF1739:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF1740:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1765:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF1905:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1530:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1595:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1892:
+	.string	"pgn_t"
+.LASF2044:
+	.string	"filterBankApply"
+.LASF1541:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1814:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1660:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1855:
+	.string	"float"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1809:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1849:
+	.string	"int16_t"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1941:
+	.string	"PID_STABILISATION_ON"
+.LASF1848:
+	.string	"char"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2010:
+	.string	"rollAndPitchTrims_s"
+.LASF2012:
+	.string	"rollAndPitchTrims_t"
+.LASF2111:
+	.string	"rollAndPitchTrims_u"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1877:
+	.string	"FILTER_BPF"
+.LASF1960:
+	.string	"pidAtMinThrottle"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1620:
+	.string	"I2CDEV_COUNT 4"
+.LASF2032:
+	.string	"ITermWindupPointInv"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF2030:
+	.string	"horizonFactorRatio"
+.LASF1860:
+	.string	"AI_ROLL"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1418:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1534:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1675:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF2021:
+	.string	"dtermDenoiseFilter"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2000:
+	.string	"gyroADCf"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1429:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1647:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1557:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1454:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1817:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1629:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1979:
+	.string	"pidProfiles_SystemArray"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1658:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1655:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1414:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1733:
+	.string	"SCHED_FIFO 1"
+.LASF1749:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1449:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF1776:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2019:
+	.string	"dtermFilterBank"
+.LASF1994:
+	.string	"values"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1698:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1636:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1876:
+	.string	"FILTER_NOTCH"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1777:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1624:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1973:
+	.string	"crash_time"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF1744:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1509:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2004:
+	.string	"long long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1799:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1861:
+	.string	"AI_PITCH"
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF1914:
+	.string	"AUX5"
+.LASF2050:
+	.string	"firFilterDenoiseInit"
+.LASF1481:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1699:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1887:
+	.string	"filterBank_s"
+.LASF1891:
+	.string	"filterBank_t"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1424:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF1443:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1996:
+	.string	"attitude"
+.LASF1700:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF1679:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1701:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2085:
+	.string	"sensitFact"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1790:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1542:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF2093:
+	.string	"notchQ"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1702:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1722:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1802:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1828:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1710:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1666:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2057:
+	.string	"pidProfile"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1680:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1598:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1862:
+	.string	"angle_index_t"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1793:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1995:
+	.string	"attitudeEulerAngles_t"
+.LASF1586:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1937:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1939:
+	.string	"PID_ITEM_COUNT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1819:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1925:
+	.string	"UNUSED_MODE"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1645:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2009:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1843:
+	.string	"short int"
+.LASF1512:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1969:
+	.string	"yawRateAccelLimit"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF2069:
+	.string	"gyroRate"
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1523:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1703:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1607:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1952:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1463:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF1932:
+	.string	"PID_ALT"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1713:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2100:
+	.string	"pidLooptime"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1897:
+	.string	"pgResetFunc"
+.LASF1532:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2043:
+	.string	"firFilterDenoiseUpdate"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1663:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1838:
+	.string	"unsigned int"
+.LASF2005:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2045:
+	.string	"getMotorMixRange"
+.LASF1707:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF1505:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1593:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1540:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1494:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1903:
+	.string	"pgRegistry_t"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1965:
+	.string	"itermThrottleThreshold"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF1484:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1926:
+	.string	"PASSTHRU_MODE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1531:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2083:
+	.string	"currentInclination"
+.LASF1947:
+	.string	"pid8_s"
+.LASF1948:
+	.string	"pid8_t"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2107:
+	.string	"constrainf"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2215:
+	.string	"thread-shared-types.h"
+.LASF2192:
+	.string	"pwm_output.h"
+.LASF2173:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2129:
+	.string	"/usr/include"
+.LASF2179:
+	.string	"mathcalls-helper-functions.h"
+.LASF2175:
+	.string	"floatn-common.h"
+.LASF2155:
+	.string	"stdint.h"
+.LASF2224:
+	.string	"pthread_stack_min.h"
+.LASF2114:
+	.string	"src/main/build"
+.LASF2126:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2154:
+	.string	"stdbool.h"
+.LASF2138:
+	.string	"time.h"
+.LASF2159:
+	.string	"wordsize.h"
+.LASF2208:
+	.string	"cpu-set.h"
+.LASF2195:
+	.string	"bus.h"
+.LASF2143:
+	.string	"navigation.h"
+.LASF2122:
+	.string	"src/main/target/SITL"
+.LASF0:
+	.string	"./src/main/flight/pid.c"
+.LASF2189:
+	.string	"sound_beeper.h"
+.LASF2221:
+	.string	"__sigset_t.h"
+.LASF2125:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2156:
+	.string	"libc-header-start.h"
+.LASF2212:
+	.string	"timer_t.h"
+.LASF2222:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2181:
+	.string	"platform.h"
+.LASF2130:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2136:
+	.string	"filter.h"
+.LASF2162:
+	.string	"long-double.h"
+.LASF2217:
+	.string	"atomic_wide_counter.h"
+.LASF2120:
+	.string	"src/main/flight"
+.LASF2142:
+	.string	"imu.h"
+.LASF2185:
+	.string	"debug.h"
+.LASF2153:
+	.string	"stdc-predef.h"
+.LASF2193:
+	.string	"timer.h"
+.LASF2171:
+	.string	"math.h"
+.LASF2205:
+	.string	"endian.h"
+.LASF2199:
+	.string	"exti.h"
+.LASF2157:
+	.string	"features.h"
+.LASF2124:
+	.string	"src/main"
+.LASF2186:
+	.string	"trace.h"
+.LASF2172:
+	.string	"math-vector.h"
+.LASF2220:
+	.string	"setjmp.h"
+.LASF2210:
+	.string	"struct_tm.h"
+.LASF2116:
+	.string	"src/main/config"
+.LASF2213:
+	.string	"struct_itimerspec.h"
+.LASF2158:
+	.string	"features-time64.h"
+.LASF2170:
+	.string	"strings.h"
+.LASF2117:
+	.string	"src/main/drivers/accgyro"
+.LASF2219:
+	.string	"struct_rwlock.h"
+.LASF2139:
+	.string	"runtime_config.h"
+.LASF2177:
+	.string	"fp-logb.h"
+.LASF2144:
+	.string	"gyro.h"
+.LASF2166:
+	.string	"time64.h"
+.LASF2150:
+	.string	"string.h"
+.LASF2198:
+	.string	"accgyro.h"
+.LASF2214:
+	.string	"pthreadtypes.h"
+.LASF2191:
+	.string	"fc_core.h"
+.LASF2182:
+	.string	"common_fc_pre.h"
+.LASF2141:
+	.string	"target.h"
+.LASF2151:
+	.string	"maths.h"
+.LASF2188:
+	.string	"parameter_group_ids.h"
+.LASF2167:
+	.string	"wchar.h"
+.LASF2160:
+	.string	"timesize.h"
+.LASF2115:
+	.string	"src/main/common"
+.LASF2128:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2194:
+	.string	"rcc_types.h"
+.LASF2203:
+	.string	"time_t.h"
+.LASF2146:
+	.string	"acceleration.h"
+.LASF2134:
+	.string	"stddef.h"
+.LASF2178:
+	.string	"fp-fast.h"
+.LASF2119:
+	.string	"src/main/fc"
+.LASF2174:
+	.string	"floatn.h"
+.LASF2196:
+	.string	"bus_i2c.h"
+.LASF2147:
+	.string	"pid.c"
+.LASF2164:
+	.string	"stubs-64.h"
+.LASF2163:
+	.string	"stubs.h"
+.LASF2137:
+	.string	"parameter_group.h"
+.LASF2140:
+	.string	"pid.h"
+.LASF2187:
+	.string	"config_reset.h"
+.LASF2207:
+	.string	"struct_sched_param.h"
+.LASF2149:
+	.string	"mixer.h"
+.LASF2145:
+	.string	"sensors.h"
+.LASF2211:
+	.string	"clockid_t.h"
+.LASF2200:
+	.string	"accgyro_mpu.h"
+.LASF2206:
+	.string	"endianness.h"
+.LASF2133:
+	.string	"stdint-uintn.h"
+.LASF2223:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2209:
+	.string	"clock_t.h"
+.LASF2148:
+	.string	"fc_rc.h"
+.LASF2152:
+	.string	"rc_controls.h"
+.LASF2161:
+	.string	"cdefs.h"
+.LASF2176:
+	.string	"flt-eval-method.h"
+.LASF2180:
+	.string	"mathcalls.h"
+.LASF2165:
+	.string	"typesizes.h"
+.LASF2197:
+	.string	"sensor.h"
+.LASF2183:
+	.string	"common_fc_post.h"
+.LASF2168:
+	.string	"locale_t.h"
+.LASF2123:
+	.string	"src/main/target"
+.LASF2201:
+	.string	"pthread.h"
+.LASF2135:
+	.string	"axis.h"
+.LASF2118:
+	.string	"src/main/drivers"
+.LASF2204:
+	.string	"struct_timespec.h"
+.LASF2184:
+	.string	"build_config.h"
+.LASF2121:
+	.string	"src/main/sensors"
+.LASF2132:
+	.string	"stdint-intn.h"
+.LASF2169:
+	.string	"__locale_t.h"
+.LASF2131:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2218:
+	.string	"struct_mutex.h"
+.LASF2216:
+	.string	"pthreadtypes-arch.h"
+.LASF2190:
+	.string	"io_types.h"
+.LASF2202:
+	.string	"sched.h"
+.LASF2127:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0011"
+	.text
+	.section	.gnu.lto_.icf.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\263\002\205\r"
+	.string	"t\017\247\003"
+	.string	";"
+	.string	"\235\220\226\317\003"
+	.string	"\001\273\335\253\241\t\002\310\214\304\233\002\020\002"
+	.string	"\001\002\001\002\002\004\240\342\234\212\n\005\006\007\b\207\264\227\277\007\020\002\001\002\003\002\004\002\005\006\002\006\002\007\002\007\013\f\r\232\373\214\201\t"
+	.string	"\016\266\210\226\325\b\004\002\b\002\b\017\020\021\303\216\256\340\002\t\022\023\256\330\276\211\r\024\315\343\301\244\013\025\356\363\250\233\t\002\002\n\002\n\026\027\257\314\240F$\007\002\003\n\002\n\013\f\002\f\030\031\032\033\036\037 \272\366\317\246\004P\002\002\t\002\t\007\r\002\r!\"#$%&'()*+,-.\303\375\364\367\t\016\002\001\002\01701\341\233\271\272\007v\002\020\002\020\002\002\002\021\t\002\021\022\021\002\02123\352\263\360\321\b45678\336\215\314\344\r9\332\320\206\375\003:;<\265\263\276\320\005=\316\237\253\264\016>?@\240\342\234\212\n"
+	.ascii	"q\250\261\331\240dF5\n\303\030\320\202!\032Z\007\022\200\204"
+	.ascii	";\246\335&56\366;\221\244\n\221\244B\023\276\374\241gx\331\324"
+	.ascii	"\234\320![`\244\356\243u\230\311\007hvI\266\224}LU\243V\210Y"
+	.ascii	"O\374$;.6\325\277\304%\251\252]\244\323\016\311\f\341\277\235"
+	.ascii	"\330N0\347t\235\326\222\004xW\003w\336\363\332\272?U\207b\317"
+	.ascii	")r\245\267@\373b\325u\353\223\237V\240,/\236\343q\363\226,\231"
+	.ascii	"\372\307\001}\322\027\276fP\017\333\276/\316=;\223\212\310\260"
+	.ascii	"\223v\006\353\025V\345Z\377\306\022*3\003E\217/6\035\305\315"
+	.ascii	"S\343\260!?~Y\215p\031"
+	.text
+	.section	.gnu.lto_.ipa_sra.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\004"
+	.string	"R\005\021\034\240'\351\377\377\377\377?N\253\252\252\346\024\356=\372\357G\302\344\023g\263\333[\246\024\216bh%\277\270\020\353\364\024/QV\330>\030\316\022\026"
+	.string	"L2]\034x@\375\306;\273\2209\311\255\323\253k|\004\032"
+	.string	"m\340\360\263\234\323\021&Cp5"
+	.string	"\300\310I\f\301T\035\236a\\\316\220y\341\200!\2535\260\024\002\203\200*\343\266FCq\261\0206\2132"
+	.string	"\rd.\002\213\301B65\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`m\004\265\022"
+	.string	"F\033V>\020\215(\351`\211\371\345\211\026OH;\235\243\231\271\022\201\357\260b\\@\231A\375W"
+	.string	"\245\356\273:V\001\374\003M ,r\325)"
+	.string	"\221H\212\240\322\307b\373\233\rV\266\306GdK\222\002C"
+	.string	"E"
+	.string	"E"
+	.string	"\354\250\021\244\013\036\007*?\006\331\337uWd\214\237\210)$$0\020\230b\263/'\342\203\017%\017\f\370\307A\n\037'\013\223\374\234\353\236a\032\247\207mk\371\020\257\266"
+	.string	"\370Lt\247vt\371\313\225\215\037\272\023\r%!\t,\323t[,\335\026\331\227RA\302\204K\316\350\260\303\f\366\251\214\361wH\317U!\232\0024\017\333"
+	.string	"\262\331\367\271^\214i\r\332\216\006\035J[\2121s.\013R{\256\335\271\233m*\b{8\362\271R;\252x\016rh\213`s\353m]\267%rW\315\324J\034\271+\224\3332q[\027\341J\"\314\304>\356\352tW&g\276\005\004i\273\311\033\376\226_C\301\271\236\324\334`\243\020\322\006\021\026\001\013\260\314\332\263\214\205\234\353\342\300\004\201\224\371\016\202\200(\221\201!:\256\303\211z\260\023\312\300\347F\332^\360S[\315\005\032{\347\256\355\246\035t\025SCQm{1\223\235\254\263jhl6\032\r5\210&\250\026~\250\361L\210\216F\322\202\202TZ\003\220\002\031\2421z\021"
+	.string	"5\250\020\262\232%\206l\254\001\314\017\242U\2449&9Jj\364\302\345\301Q\217\236%DV\324\300l\322\301\207yV\337\201\337\230\315l\367 \304\265\025\363\324\263\t.\332\265\006\230\325\326\212\227\352\235*\223\204\264\323V\311"
+	.string	"\023^\032#.\321\\p\t\025\212_\240\177~\273\006\007\021\343y\260\017RTJ6\347i\245,\240\375s\024\r%\215Xll(i\204\3512s\r\323\220jF\204\236\230\"\353\317\323\222IG\231c\303u1\031\344<c \217(\225"
+	.ascii	"a=\225\177\326|\350x\222\311\377\203\244D\312\352\0021\022\240"
+	.ascii	"^\2742\3255\033\321X\264RT\310\201\342\220\357<j\333\342\"\276"
+	.ascii	"\257\323\370\270)C\305\371\333\200\353+q\246\224R\205\316\377"
+	.ascii	"\224\037\303b\211\272\r\277\346\017\204\033U\365\021\200\206"
+	.ascii	"\331\312\001x"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\177\002\215\t"
+	.string	"\"M%'\220)\205\016\377\277\3431:,H\377\377\257!\305G\304\364\020\346\244\262\b]"
+	.string	"j\375m\373\b\374\217\023[\354-\223\fd\216$!\312\257\226J\270\271S\231\236\300\324\027\250\324W`\332IQ$:\305`\375\006\353\"\340\234s8A(\031\351\360\343pP2*\351\035\216\006\204\200\034("
+	.ascii	"x\342.\361\021\317+{\364>\2037\257JH\317J*\033\275\317\177-l"
+	.ascii	"\216\260\211\334\222%+\225Ya\275%\366\022\353\234\030\224\310"
+	.ascii	"kQxQ&\355\321\243\347\202\364\020@\250aM\305\246\002)(\250\024"
+	.ascii	"\326`\202!ef\036\021\2204D\020E\216X A&,(L\206\335\017\200\323"
+	.ascii	"E%\212xz\203I<\345\3205\333\f\312\b\216\254\351\031B\340\240"
+	.ascii	"<\362\3704\002Rp\201t\322\253i\005\275\325$\365\211!\205\360"
+	.ascii	"\356\237\271E\262X2Q\303\\\007!N+\323`1\035\232\313\367\265\213"
+	.ascii	"Ws,\226i\244\244!\324\032\200$g\301j\251\3404\\V\341\225\374"
+	.ascii	"T\005e\n\320&\256\224\260\031\365\253\021GUC\346C\260\034n\377"
+	.ascii	"\344\326\020\220\001"
+	.text
+	.section	.gnu.lto_.pureconst.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\002\230\004\b\231\004\r\230\004\016\230\004\021\230"
+	.ascii	"\004\023\230\004\025\230\004\027\231\004 \231\004.\230\0041\231"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`[\001\335\t"
+	.string	"\026\02011`E\223t@\271\2040tt\301\003(,\022`\250P+\203\016\003\203\220I\206\201mG+T\377\021\246\217H`'\342\243\006j\333}k\212\020)S$"
+	.string	"\""
+	.string	"#"
+	.string	"\n\235\221\362HgB9B\333-\213IB\352\374\215\f\333\260\315\354\346_\226\021\340R\201\331\311\360\200\357\033\021\255\2279\177\332!]\377C\003\206\262"
+	.string	"\"X(\177\340Q\376h\337!"
+	.string	"\225C\235\222rI)\332\223\007\r\255T\265\005\240\035\303\314\357J]\314\017\216\030\363v\253\322\234\363\215(\345\224\316I\371\244\353;j\346T[&\213\304\304\324\370'\366\324(b\024D\357VU)\257tJ\345RgT\036q\376P\307\317\303&:42 `\202!$\313\016\246\031\236\257\022\026G0\301NqW\035\262@\316"
+	.string	"\266\343\2712\004\030\367\247\034i)\240A\206\327\327}^\362#\274# \376\376\350\237!\0367!\004k\205\324\317^|*\007\321\376\207C\020\362.(\253"
+	.string	"\b\266\223Q\025*3-*\0216\214$\271#\254\020!8\351\232\200\301f\231,YE7\004\023x.O\255\322R\0178"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.f1dd4492f1f168cf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.50.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\276\374\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\006us\250\346\005uq"
+	.string	"\005\001\006'\001\001\370\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.52.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\002?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.56.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375 \2235\004"
+	.string	"\204\007a"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\314\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\344'\001\016?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_resetPidProfile.57.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\035\n"
+	.string	"\206\023I@ \345*\035"
+	.string	"\274(GX\004\013\200\177\2100\024OX\tR9\333"
+	.string	"\326\206&(l:$\326\206\275\030\200\022\005\r\216\025\316\006B$"
+	.string	"\021\2048\262?Gd\002\302\234c\210\315\350\023B\366N)2"
+	.string	"5"
+	.string	"6"
+	.string	"\367|^\341\273\3279\302w\317\245-\340\347k?S9\251\301\355.X[^\236\226\376e'0[\253S\316\305\356\232\232\255\224\273\336\366\203m\f\333\004\002+\366\273\335]W\227\375\330O;\013\033n\300B\200]\224\003\006\326\346\331\274Pj\377,m\217\355\3002qz\231/sX\371\030\311\017v]\264\332\356\031a\210N7\0165\355\276\371~\236F\305\360\332e\335\364g>Cuw\271\347\021\325w\363\236\257\372\356\321j\207\210\320\233n`\325\225\307\034LBL-w[Z\300>W\264\006\026IPT\210B\034!\220A\351\024\232DR\203\024\216\005\036\201H\341\b\246<:\302\223\t\004\t7>\300\021\211\002A\037\213c\211\004S\242H\202\236s\337mu9\003\200\255\244\232\370\003\253\345\002\n"
+	.ascii	"QS\240L\350\374\013\f\217\377F\b\310\022\022\\\246\234.6\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.58.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`k\002\345\024"
+	.string	"F\350\211I\300\322Q:J\263b*\345\351\022D\377:H\300\227\311\320\362\320\334C\341\362H\200\017\240\005W\300QtN"
+	.string	"5\265\022\fg\007\232\222'\234f\263\213\302\212\202\261\3641\366\256\320\013\314\32434\252(\357\314\331,\331r\247\024o"
+	.string	"s"
+	.string	"s"
+	.ascii	"v\353\341[v\202*\331\245\375\237\003\341\036\024\363\002\273"
+	.ascii	";ML\273c\211\025\210\017=\376\300\352\241x\003\253\207\306\331"
+	.ascii	";>\366\354\211\244f~R\273\033\323\023\326\317"
+	.string	"\361\236\022\367p\252\304\371\254\231\320_9<x=\231\207\223\300\356\n\350}\230'\222\246\247\223s\305\315\365\277/\310\251\301\353\335\\\262f\273k\311\353\331\334\253\333\266\331\226`K\234\273\326\035[|\320\317\272\357\236\227V\225\226*}\021\026U\016\004K\273!\252\202\254S8#\305}\277}\177\350H0/\362\217\264'\244\365\320\b\0303\323\201\330\251\2243\302\036\276L\310.o\004s`\314\310\2706\037A\302\306\217\324CG\020\037\276hd\376\350\377^52\333>\214\023\341\3563\rQF\204\b$\242\352\261\273\260\207F\021\037\272\346\207`\002g\272\221\364\354\356\316\363e|\2516\217\342\2417\334V\347\335V\017U}$\016\035\344yv\355T\306.S>H\027)z\361\264G\247\300B\305\324\217\225A\253\336\350\256\234\262T\3651v-\254t\337X]\245~\347\243\223U\236z\235:f\206\344d\225\003"
+	.ascii	"\201\250\356\256\214\032\366\373\016\241DN\006\375\337\247\013"
+	.ascii	"\035\t\214zZ\031\264G\235T\036\373\337\r\"\264[\326\300\301\003"
+	.ascii	"\331\211\205\023\223\001\267\225\026\032K\3156A\205\346\322r"
+	.ascii	"\212\211\n\315%\366\202\341\002\255\205%\246\201V!C,\305v\213"
+	.ascii	"\231\214\270\346\262b\213\275\324j\266Xk\314\375\253;\276\320"
+	.ascii	"E`\320)\247\272Py\314jRQ\025J\302>\225\246\344SQ\240<H*\034:"
+	.ascii	"Sg9\031\374\234\242\336w\027\203O\025\365;\034\022`\324\377\373"
+	.ascii	"k\200@\234F\200\230\246|\254\f\032\200|\322\237\024/ @\002\202"
+	.ascii	"\030\263\362\301\375bh8ou\257\354`.\024\311\260\312\313\216\003"
+	.ascii	"\202y\002\267H(\301\026\034\342\253+\bv(\262Ai`\210v\266\203"
+	.ascii	"\225\2034\341\365f\276A\363J\320\227\334\n\266x\264aZ\223\031"
+	.ascii	"\301T\266G1\251\225\271\213VT\222h\254!\365\242\310\215\305\275"
+	.ascii	"\370\337\033<\347;\257\004\355R,b\033\254\366v\007\374S\356\\"
+	.ascii	"\341\t"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.59.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"-\013"
+	.string	"\206\325OF"
+	.string	"\255*\0350il\2100b\210r)\027\330P\213\257\0204\214\210\030\261y\007\f\223\205\201\367\362\306\350f\221R\bBs\344T\3426\240\360\377\377\254?\017_\277\232\225sA{\370\217X\327/\313\032!d\313\224\0028"
+	.string	"7"
+	.string	"?"
+	.string	"\0270\354\222\036\366P\234\3338Fwn\373Ew\316\242\035\342\344\202\375\204RFVbw\275\251\340\342U\364\037\373ft\251\256\232\221\335\265\216."
+	.string	"\367\274\355\216m\022\373\236j\302&U:\023\330\337vw=_\366a\377\246jU\3655\025\003:tT\330\235)Ol\215\313\320\300\366\355\223\242\315\2619>\204\256\217\371\017\016A<,\345\315.\2023\317\272s\227\215$L{\253\200\210\003k\221\262\334\020\263\273\352|\352\3348\264\034\260\264\3646?\257\2415B\3006\375\b\227\220\362\031\030\006\245\037\317\371\250\356\\\006\b\003+-\255\026\002x\330\016}\200\204\204@(\240\217\005\251\364\235B\0204\031}!\307\242\317\350\013\275\323\212\312\307\222\342\265|'%Odr\361>\032\006C\222\311;\201\240\311\343\220\373m\347\313%\004j\253\311\262N_v\n\246\2758\r"
+	.ascii	"bS\240L\350\025\0328\036\253\2130\270\310\243\205q\325\320\034"
+	.ascii	"\340\335R\255\234.\030\3015\267\020\346\023"
+	.text
+	.section	.gnu.lto_pidResetErrorGyroState.60.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`B\001=\016"
+	.string	"\266Z_E"
+	.string	"\223\223\016\200\255c\241)\340\0265\361\257\270\\V\016\177\221\312\324\354\363\017D\216\tP\213\202\270\216\021c\020\030\024L\tf+\025\216\377\377\377\016\365\317\332U\303\316\331\301\366\275\f\344\236\235l\226\354-eJ\001H"
+	.string	"K"
+	.string	"H"
+	.ascii	"(;\310\275\325\236u\242\004+gw3ma=\364n\230\250G\250\211\362"
+	.ascii	";$"
+	.string	"\233'p\321c\343R\217\260\300\356\016\340F\300Q\272p\252\20440\327{g\260zm\034\314\263C\332]\347\306\245\270\261\333>\331\226`\337D+~l~\266\227J\235\261\377U\031;\276\273\217\005\210\341c\301\220\335\227W\221\305\211;`\274\373\355\227\344\b\3712|\317\237\022\035\241\3178\r\324;\363\360\244Pxp\260^\204\354.\350\321&\236G\222\217`\217\360\006\260\307\177\034Q\337\235D\313\317\241_\243\236\204\nU\276l\262\335\330N\005\266C\374\206oFV\273\013\301\257q\033\037\374\027\217\006\321\222\337\036\375\026\354\021\001\220\034-_\026\320\242Q\335\335\224\032\364w\237\300B\313\317\367\016kb\262\025>q\360 \302\311\250\302HD`\245\344\001\005:Ed\241\244\222\261h\310P\332\200!\353PB\341\220\245\234V2\321\001\233T.\2342\026\223\351\224}\274\275\312\3706\367\264jp4UE\2351"
+	.string	"\227FUW\202~ui\360+\005\227\210$\362\305\254IZ~\2070\035"
+	.ascii	"{\22123\264\237\223\231\006\364j\273\n\326N\307z&fA\317-\330"
+	.ascii	"\323\330b\271!\360\261!70\001\254x\312\302\212\235\256\211S\023"
+	.ascii	"y(Q\202U\350\227+\202\314\270q\243l\260\323\336\236\003\376\244"
+	.ascii	"\334\271\346\023"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.62.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\335\b"
+	.string	"&\321?90\221\322\001\200@\247\243\206\f\254\313e\362\252\366\216\223\030_\b6\350\265\336\227m$\201\022+\312\367\236\0211\255\245\300\211\301#O\365W\332(\006\207\356\226\353A6\331;\245,"
+	.string	"/"
+	.string	"."
+	.string	"\333?\334\247C\333\346\260\326>\026\322\021\273\331]*I\036>\206\376_\357\254X\251G"
+	.string	"\210\335u\\\261>ny\333\b\266'l\267\004\"\366]\177\334\022Z\257\211\355z\324r\2266eNl\337c\037\240<<\332O\271Jx\227g\356\354\316\274\300\354\356\202\025\002>\r>\300}\006\036\330>\206\246\222\034\216\322_9\213g\276\2117,\213_}\372\226q\237\004% \252Xsty\321l\304\261a\251(G\354o\273\273\226\001\026148\210B\024!\220@\375\300Q\365J^\327E\230\252\007Jhx\247\217;P\005\tEA\214\013R\311\202\236H#\023\355j\006\005\025\370Cy\225\202\337Wi\t"
+	.string	"\352S\240\314\2000\034EX\002\233"
+	.ascii	"\3432\312\267\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_pidStabilisationState.63.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\225\t"
+	.string	"\366\022F; \261\322\001\360\342\224I"
+	.string	"Y#\203\266\205\3741\234\t"
+	.string	"\377\222\016\004\350\0038\206\3260C@H\002P\225D\365\035@\017 \364\230\234\265/\251T\272\232R\364\275\321\023B\366N)1"
+	.string	"2"
+	.string	"6"
+	.string	"_\302\r\300\177\336\t\300\1776\355\231\237%\373\231\t\310,\267\273a%\271yj\372_9\247\345R\235\002L\354\256i\313%r\327\333^\260]a\373%\366\275\335]W\230\375\330O)\365\277\013Z\256\246\001f7dw\2631_\r\305\366;\266\302K\342\324~\312U\314\307R\346\354\276dh\273\247\203\031\002\036\236\215\246\243YU\226_}\226\313>\374\023{\240\350[\377|\024\370\017Avs\301\255\350\316\177\n\244\365\3656\326\255\245\306\242;\027\330N\035n\251\215}\252h\035\t\006=@D\200>\030\037\217"
+	.string	"\251\f\225\026$\251T\032\311\3224R\214\304\323\200E\236\221x\n\313\r\r\261\224\021\232\304\020G(\";B\317\201\307\023\211\f\313q$\303\316\271\367\266\302\034\b"
+	.ascii	"\331S\240Lh\361\013Tp\341\330ehk5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.64.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidInitFilters.70.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\007\fM<"
+	.ascii	"\nf0\026?@\246N\007\255\2728T]\331\346\233\241\240\220\007)\366"
+	.ascii	"\025\301\320\036P|\256\243\027\bkM\360D\276\3728\fy6\351\031"
+	.ascii	"\301wEK\364\021G\244\233'\377Q\362\307&\"\"B\366\336)\245\024"
+	.ascii	"V\0012\001P\001n>\220\364&\t\204t\367\3269]\272\256\233\256;"
+	.ascii	"\256{M\253\2762\367\324\323\216\213Scu\234G\306\302\255\306\337"
+	.ascii	"\003n6\334m\270\250\004\244\373\241\004\223^6\025\\\032\2755"
+	.ascii	"\312\022\366\352-\327s\\T\366Y\023D\310\204\n\351\346\356\374"
+	.ascii	"\356\225\216 \364\240\245\255\246\3558\306\0232\241Ob\177\356"
+	.ascii	"\370\335{\257ze\r\302^\225\252\362\315\203v\346~k4m\303\t\351"
+	.ascii	"\245{\255\340\211s\257t\001S\t{ei;\261"
+	.string	"\275\n\273\211\355\225[fB-]\273=\327\3069\327\350\336\273|,\354\255J\233\223\274\355d\023\323\222R\022\362h,\022\207\302 \273\252\357-\267\0013\205\236d\314N6%\005J3\244V\306\326L=\205nY\312\242\305\225T'-_\332\254\362\340\340\265\035\232'])Kk\244]\273[\243\2672jei}\f\032i3\0061\250f\334\332\274\375\251\225\255u\361L\n\253\244\006\215\302*A\327T\342\027(\024\037N\241kS_\240O\\8\245Vf\326A\325\312O\316\242\236B\315T\247$\\\236E2\247\263\253X\221,\314U\"Y\223~$\031\230\252\274\367\366\\\373\030\331\227{\020\303\275\227\375IV\326\354\324\314\335\204\231q0\023\031\005)\274\237)V\264\360~\2622\354\231\334sM\264\263\243|\fM\326j}\253\357\271n\312\243\372\365\331\235\200H\2733\275\006\277Kn\017\373A\027]\207}"
+	.string	"}pe\324\253\357\270\377\253wEb~F;1S\277\3672\377\243L\365\352\303\220\323\003sG\374\257~;\001\233\374\242\347d\t\357\005\223\300-\247\345\242%d\023\302\366\372\357\324\007\367ez\355\332\250\276\327\264\262\351\217\330\237\352[\221\030\237~\306kV\357m\036\360o\261<_\036\310\334p\372\216\361\270\331x\006\337y?{\345\346;\266\327~\bY\314\232\036\310E)E\263i\022\317\224\277C\327\0371K\231\376Q\346V\357[a\306j\272\346\345\225U\320\271\252\341\272\023\364\232f\252\256k\236\352\270f\345\320\271"
+	.string	"\321\231\300\352,\025t\216b\235\241\212\316\003\206\316\002\210\316\001Xg"
+	.ascii	"C\347\247\240\263\323\352\234\f:7\r\235\231\210\316K\253\263"
+	.ascii	"\022\3219)\350\214d\235\217Ag\343\320\271\310:\023\207\316C\326"
+	.ascii	"Y\030t\016\262\316\254\320y\r:\253\254\363\257\316\276:w\005"
+	.ascii	"\2510hR\242\001_e\366\345\201~\304\351\207f\311\273\266g)\363"
+	.ascii	"\354\n\362\252\273\256[Li\332\265\232\247\346e\310\257\375\211"
+	.ascii	"\200/\321\231\2436\336E9\232)\360\246O\022qfi\267\034?\371\355"
+	.ascii	"`MN\030\265\361\216\211\021YV\345J\317\364\315\306\233\316\354"
+	.ascii	"\322\266\211=\223\227\236\351\370K\200J\310;\262N\324E\300=\246"
+	.ascii	"G\372\350#nH~\244\021\367_;\237\212\270\0271!aK\261\275\262?"
+	.ascii	"oX\240\227;\345V5\"\006\274s/\263\321\374y\253\260\246\2049 "
+	.ascii	"\2306\324\212Iz\251>\270?\"\362\035NN\357\370\310g\377\364\360"
+	.ascii	"\243\314Y"
+	.string	"\354\221L\023:\276S\037\243\351\025\036\360\356\366\f\273|\343+\277\273E\303\266\233\026\324\307m\232\f\336OV\357\223g2\367\237\006\024d\003\007\016l\257\306\037\232\031Z~\323E\371\360\213\317\374\001\204\367s\371\304/*\237\370-\306G\370\303\177ES\3417]\026\2706-\364\243\347\367wh\315\221_\234\340Gy\305\"\265\371\364\360Y\255\2768\227\307\211\367W\257\3741\274\003\312\207!'(\251\267\327!X\356=\255\027bD\211\022l\257Q|\211\356<\2717\347\261\315\246\361\244\020\336\333\354'\267\235\276s\202\031E;\266|\274PK\340`\275vl\361\320\361C\304\217,\034Z<thuu\210\261\225\243\t\210\007\032Y^\\\"nti\231\210ad,\007\020(`5\200\321\200A\222\226\215-\031\\]$bl\345 r\026\203\030[9\226^4fl\331\220\261\304\261\365\342\3062\253k\307\222A"
+	.string	"\346\312\241\325\265\364\342\342\352Z\026\245\267\325\373VD\350\331k\376WR\203K}\201ggk\277\202U\362\334\266\f\2114$\220\300\027\200z\002\276&\365C3;~\245\375\222Z\263\342\321\226\331\243\375\372b\251\270\032\017\nk\235\316\271\274i[\244\035\213\200Fg\312u\320\270\2555}\224\217\264I\020\3609\024\217\322\222\265JZ&L\330^?\322\263\311]\232\337\022G\207\207)\352}\214\034\037\250\217z6o\351\243\205\032\352a\310\3659q3\250;4\323{\250\031\003\323#)}\224\223\352\220X\277\n:^\365\324\217\345\351\251\337 \250\355z%\2436\365]\327{\314\263+IX\337u\255l\366\324c}\213\241]@\2226\305\362\247\027\360\003\236\271\215\322\236\2613\331J\362=\337|I\233f\201\357\336;\241W\3662W\322Ri\253\264\3216\312\366:\340\373\331$\300\013"
+	.string	"\360\001\336\34184\013\3007\234>\270\252\177\372\266\353\241\023\360\003\003;\001\353\024\200\366\250A4\006\231S\206DDD$I\2224\006\220\002\221!*\353\021@\265T\252h\223\024\206\003}\343\2172tld\332h\004\"\031'\f\270\027\006\213\230\036\201\021O_\363\205\352X\261V\214p\373\204R\007\234\347,\311S}\n}b\207\236!\200\267\344\260\210-\325\021j/L\325\264\252L\376?,T,\003#\210'p#P_\202\254\3160\234\t\344\302i\013b\234\270m\205\3645x\331\313\376k5\277\307e\021*\024\204ld|&\245\314\336\300\327\026\005E\270\035\377\330a\243\266\t\013\271U\277\204z\343f\277\216\245\363\247\231\303;o&\360\251-\f\214\267\005\022\237\347\247y\323\037_\301v\307\007\002xf\260>\364\243\340\216:E\303\342\335!\276\363z\024\223j\034=K\320\257\034\373(\337\272\360\277"
+	.string	"\245\340|\b\030\330\351\257\004\023}P\360-\t\t0J\262m\262)[\276-\201\3437\364\354[QC\267\253\233t+t\332\\\211\355\254\242\302\233\234\234\302\300R"
+	.string	"\224Y5S\320\304\242\024gd\034\177\317\352\t\264\030\231\245:\210\230\247\177\220\363y\022\035'\t\200N\232z\275o!\371\265; \332\245\210"
+	.string	"\321\254@\016"
+	.string	"\326\360\203\341f\230\256e\034\207\035LtbS\020\223\323Zg$\366\216\013\302\225\006_I\200\335\216IPH\316\007."
+	.string	"C\016\216,\364\003\224g]\276A}\027V\026eQ\260\351!e6!\324\304\201\301,\n\017\245w\346\273\361\373\264\255\212\b<\004o}\003l\336\033\226\330~\320L\251\266\t,\2444Y4d\263\215\272\314\211\300(\376@"
+	.string	"\263"
+	.ascii	"\374H\303\324_B\264\327\364\225zQ\354\240\n\315\023\325\022\r"
+	.ascii	"(\223\231\021\3030^\314<j\357\300\223\037\201\020ZV\317\300>"
+	.ascii	"\354L\356\322\344}\216\345\r8{c\311l\364\373\003"
+	.text
+	.section	.gnu.lto_pidInitConfig.90.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`z\fe4"
+	.string	"z[4\023:P\352\311p,\242\372\246\301(\240\213\301l\363.\272\377J\326n\335w\031d\212-\306\210 \257\233\204\312{#\310{\213\r\220\215\013\004\271\233\n3W#\322\237\020\262w\2222\005\t\001\f\0017\001\236P\256%|\035\341k\b\273\276\332\365\203r\355`\327\r\3125\203r\275\340k\005\273NP\256\255\3125\202\257\017\354\332@\271.P\256\t|=`\327\002\312u\200r\r\340\353\252]S\225\353\251r-\365u\324\256\241\3125\261\\\017\277\026\356\332,\327e\271\376\327\273k\215\001\365\351\320$\017\211\316s\311\240\247S\221\371\307\214\342\251\332z\265\006\314zg\265c\251+:0\245\243u\214\212g>b\033\023\"\036<|"
+	.string	"\317\363\334R\323!\210j^\225*e_\315\201\351\332*G\347\030\265n\210\n8\317.\203\372\234\347]\227\265\210j\372N\r\b\325$*\001\241\2326\332\225\364n\356T<{\216\344m:\317\263\370/\276\226w\352r\215j\226_\243uhf\247\021\354\004!\341\332\324,\003\234\347Y\005g\244\374\332$po[\242y\242W;jA\016$$\334\023\335\241\331y\236^$\\\023\265Pm\263\331\036aO\261\t\205\b\r\202\302B\f\304'\203\023\226;O\303\023\205\037\232\027\316\320?~\372\230V\026\225\337s\222\312\357<\3171+\037\325\253\341\0339V\2219\204j.\037\362RR\337\246\320):O\227\r\016n*r\236n\022\376\362zL\363\266\203\336\377\017<\002\352\367z\344\223\235\246z\324\304\374l\023\321\244yx\024\375\316\263\310\230\232\366\232\342\371A<\317\"bw\210"
+	.ascii	"\002\351\232\033\243\246u\210PM\275\330_\235\333\016z*I\345?"
+	.ascii	"\317\263\355\336R\305S\262,n\333\311jGK\272-\233\214[tn'\373"
+	.ascii	"\256M\365<\317s/g\253\236\347y\372]l\305S\303\320:U\022\212\247"
+	.ascii	"F+\327g\346:D\271\006a\256\315\312u\331\256?|M\366\265"
+	.string	"\207]w\370\232\303\327\033\314\365X\271\326P\256\305\312u\206r\215a\327a\345\032\254\\_\370\372\353\353\242\271\366*\327]\345\232\253\\o}m\341\353\n\346\232B\271\326*\327Y_c\225\033\222\352\334e]\013\353Y\267\342s#\254_\360x\346\315\317\204E\342$\b\357\375\221\232\270\273\225\360\t\021.\341V\216\216\200\020\256f\"\274\324;\236\271:\204\2635ru/\273\007\367\272\355\233\b\022%J\364!/\231\330\363\301\265\3468\370tB\260\301\035\374zG@Ojds\235858\031\2308\f6\241Xp\006\n\276\340\302\274\004W\020\250\346\225\211\007\026&\007\t\356\365\306\312\222\n\025\344\363HM\026N\bnu\340\bn\032\370\201Jj]*I)\361\23007\251\201\337P\315'T\323\300\273\332\024\370[\261z\310K\004\356\244\3469\317\263\252\300\365Xh\300\t\374y\002>\200\205>\022\260I\272"
+	.string	"\2672\322FNZ\307\270\205\367\274'T\363zmmmg&"
+	.string	"\017Pu"
+	.string	"\037\366Q\275\312\205*R#\022\317\363\244z\326_\235\235F%\325,R\363r\246\ns\030\177\244\335R\264'\261\355.E\373Y\244\"\313\311jGM)[\320l\346\266\235\264,/w\305\323+.E;\214\353\361J\206%qS\210\372^ \003\311M\222\372T\324\245\240\036\005C\003@\322\204\314(\035v\001\303\206\260/\032_^"
+	.ascii	"n\354H\303\261\306\226\302F\232\217(\327\360\262\221\346\243"
+	.ascii	"\030DG\216\264\0358\212=\322f\360(\326`\003R\364\262\362\232"
+	.ascii	"\217\033l\305 kklE\251\273S\365|\027\243\bT\344\3667\237\325"
+	.ascii	"9\t\361\263_\017\312\312\t\361\254?L \340H1;\210\270uc\366,K"
+	.ascii	"el\234\244\362\341e_\301#\240\225]\363\341X\211\310\356E\263"
+	.ascii	"i\214X\264\030\271p\351\213\362p\262[\005v\270\007\271-\243\326"
+	.ascii	"\341\305\277>\016\367\212\3311\306/`\214b\214b\204C\277\r\347"
+	.ascii	"ps\354\033\310\354\234q\316\330\261\300\030\322p/f\274\267\212"
+	.ascii	"\024\323\3602\357XH\354f\336\361\314\033\241\f[\320l \206g\270"
+	.ascii	"U_\3301\374yF5\213E-\354\\\202\300n{\251\254\225*\253\346\273"
+	.ascii	"p\256\203}\375\302\207\202\305\177}\250\347\365\"\335\306y=\353"
+	.ascii	"\217\217k\2458Y`.\312\273\276O\234\324Z'5lc\233\034B>\344%\256"
+	.ascii	"o\275\013\356\r\327\241\246X\370\326\025P:\002\"\265\302-<\201"
+	.ascii	" \205W"
+	.string	"0\306\331%\3069\024^\006\006\220\326*1\332\345q\t\201\002\250QH\244\031\262\031)')H\322\0321\006\204\030SH\274\001\021\3008\007\241\251\221\221\202\202\244\320fQ\f5\f\244@E\020\302\321C\326G\006\026F\243\205X6!0\027\351[\250\3539|\351\342t\326\204\224\231(\003?\341u\376e\265\336\346@\375\300\"\351I\210\217\363\234\226\001Z3\025[:\205^\341\310\310\235\350\302\264A\327\337\356\032\322!x5\177\241\243\037\300.PD#^O\232\351p\356\367\034\335Oc/e\026\354*\241\334\202\300\346\232\001\253\261\216\320\304\210\b2\202\254\003\332\267\027\367\232e0j\246\350\213\276)\206f\215\231xw\316\233\260\232;\020\344\301H\256\372n(\265ku\013r(<\372*\344\372v$\252S\247\224\027\271. \322\203\350\316\273\276XRN\277^2dK\306\220\"\355VBH\206 \032\203"
+	.ascii	"\tyXH\272\007_\303\264!\321\305\272\374@+G\220\r<e\301\277\021"
+	.ascii	"\217\242C\372D\221\356\353\313]\234\006\263\351EK\013\312|\251"
+	.ascii	"A\222U\327\226\tFZC\3128\265\354P\262\330f\006l\232-39\255\347"
+	.ascii	"(\201\234%J\n\244\326\250\373\230k\275\b\313q\211b\306\214A\033"
+	.ascii	" \207=\337\324\240@\215\004\\\300\007\363\330}6G6\230]\023\327"
+	.ascii	"AB\177\227\301\2260\024\246+\346\"Qsr\3565\335\005\206\304\330"
+	.ascii	"\325\243\220n~\200\224%u\303\263^wau\007\317u\305\347fG\344}"
+	.ascii	"T3\312\344x+\330\374~u\271\311F\3706\\z\215Q\261\205U\244s\215"
+	.ascii	"\005\256o\375\263\214ME\204\241\366z\372\316\377\206w\266\233"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_pidInit.91.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\r\002\245\022"
+	.string	"\006#|H\320\362&\035\013\316\207\001h!\"\333\303\254\216\305\251\230\023b($\320\3034\310\256\017\325\016_\331D\370\237\260\201\221\375-JK\005\261\031L\314.E\225\204\2471\250\315\367p8\310e\341\241WM>\346Z#{\357\235R`"
+	.string	"a"
+	.string	"k"
+	.ascii	"6t\350\270\263\237P\021U\024\365j\b\254\327\026\375\321\216\355"
+	.ascii	"\275\336\263[\263\225K\373E\237\021\273\221\210\013\330\035\262"
+	.ascii	"\355\330\035Q\234\200\365\352\361&\335+\353\003\272W\307l!\037"
+	.ascii	"]\354\223\250\200jQ\273\373\315\026\217]\306\374\323\016@6\343"
+	.ascii	"\271\\=\330]K\331,\350\236\267}b[\202-g\001\257\016q\344e\257"
+	.ascii	">N\367\372y\340\205\221(s\226\267\"M+\247\354\261GN\026\366\351"
+	.ascii	"\356\256\347\220\335I{7\372W\235tG\245)\225\236UZR\351\007(1"
+	.ascii	"\001\304\345iwD\216jqu\t\206\177\364\244\235\217>\322KN\306\356"
+	.ascii	"z\261\275\261\224\210\206S\360\212 \310\312\224\257\3714^c\347"
+	.ascii	"\001\267\377\240xZ\261v\311\345|\370\354\212'\335\364&\375Ag"
+	.ascii	"7\317\364\003%\332\204\232|\036_\322\361\211\314\001\006\246"
+	.ascii	"{%\340\224\342I\037\261\225h:\3223\320\240\244\210\320\371\332"
+	.ascii	"[\242\234\362\234\237t\242\374\304\350\231s\036\250*\3467\031"
+	.ascii	"\326\256O\213\257\343J\256\032\020\354^\345t\340d\177x\016\035"
+	.ascii	"\326\356\266\3708n\273\361\211\002\256\0330\347\025\206\021f"
+	.ascii	"\300\227g\226\005\f\032\260\250tPI!q\331\2004!\214\302\f\370"
+	.ascii	"\032\261L\312\f\370\372r<\324\20064\037\b0\346\346\223\201\205"
+	.ascii	"\370R\n8|\271`_N\030\302>o\024Ow\016\331\202\020N\234=60\241"
+	.ascii	"B\320K\t\t\023\271\2326\006\r\3622\267|&\217I\252^\373i\277\220"
+	.ascii	"\303IAy\323gz\017\3376X\311J5\331\220) \200\202\031\"<\007Q\023"
+	.ascii	"(=t\245\fLq\272\350f6b\273\270\001\265\220\"\234\037LvX\3075"
+	.ascii	"\033\033s\023\267\255\217X%s\262\nC;\022\2454i\231\371\306\035"
+	.ascii	"n\f\335\026\215\352h\316\2100\333n\037\367\327^y{H-\366{\313"
+	.ascii	"4\024'\034\354eA\214\374\226\323\220\226\027\002%\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.92.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\223\f\315<"
+	.string	"\312e\f\026APdR\007\023\336\026+@~+\355\306'\351:\024\246B\005?|\354T\242B|\367\034\2558\177J\023\316'\234m\357"
+	.string	"\021\205"
+	.string	"\004W!\250+\352\222\035\272"
+	.ascii	"\274\005\365\337\241\214l\263{\247\224RG\001/\001\\\001\316J"
+	.ascii	"\356\234\304:#\261\316G\356ltg#w.b\235\213\2543\321\235\207\253"
+	.ascii	"\263\360\235\203\2533\360\235Yw^\335\371\335\331\335\271+\020"
+	.ascii	"\307\320\211\263\241\317\275?\252\207\356\035K\275\322r\335p"
+	.ascii	"\335\322~\346N\026\312\342\226\343\236\343b\322\320\234\344^"
+	.ascii	"\034\027\233M\356\201\323\241G7\003N\0267\031\3562\\L\332\271"
+	.ascii	"\335\030K\263\222B\330\2543\343\340\036\323m\\LJ\245<m\365~t"
+	.ascii	"\0206\233D\223\325bn\b\277\310\230\304\322\220\370\271\367.h"
+	.ascii	"\226\021\b\233\345\376\322`p0OW\251\024\265\340\234\017\035o"
+	.ascii	"\206\356\275\312\247^\0026\273\366\021\330\354Gi\034\275\204"
+	.ascii	"<*%!\035\031\215\212\212\304\2410\bd\327w\034\334A\f\253\227"
+	.ascii	"i\037\261\262\257^B\342\221\251\305U\361\243\022\225N\232\022"
+	.ascii	"\227\346H*v\244\375i\002\244J\037\235\271\261\n\033\231\231\033"
+	.ascii	"IQ\342EE\"\222nk(6\262#>\204\022v\023 I:\270:\231\321\021\322"
+	.ascii	"xd\321u\352\216\023>\3052\035\016\304#3\322:;\244Wb\331\220~"
+	.ascii	"cY\330\372t\357\355\266v\036e`\356A\f\367^v\2612 \315L\315\334"
+	.ascii	"Nf\216\302\\d\006Y\226\\\250V\375\206\037\341\273e\003\033~\267"
+	.ascii	"~\240^\375.\222\343\307Z\360\321\264\200,\360\321\330W\345{\230"
+	.ascii	"\262D\377\340\247\236\207\360\201\377>\236\004\n\276\360\251"
+	.ascii	"\354P\364\033-\347\323\343\206\313\363\244\264\t\276\363\351"
+	.ascii	"\211a\037\370\002\370Z?\346\024]\247\325o\2440o5"
+	.string	"\225\253\247z\356\275WjzM\013n\265fy\351\202\345v\001l\226\375~\223&\006\352Uvj\227\251oiKX\002\365\277\225]\277\323\264\222\301\372-\310\327\177\2366{\330\275\320\250\007\337fr\325v\r\314\253\377\315\206\332~\357\375\372G\363\357\377\360d\214[\2350\367\343\2413\360\3575K\206\276\240\231\2331\274\305\372\221@\260\334\205\375\027;\365\f\357\372\037\263\024\314\037\215\271\327\373O\230)daMh\271f\t\r\327|\345\316\021\334\331\312\235\253\334\031\202;?pg\245;+p\347\004\356\214\300\235\017\270\363T\3035K\265\2649\312\235\r\2703\224;?\271s\322\235\013\2703\001w\036\340\316\002\334\331\311\235\003\270s\223;\003pg&w^rg\244;\037\201\001\202>8\275TZ\024j\206w\343\272{\324)A\242`\364\024~m\323\262\325\005\311\372\226\006\370\254o!g\372\264f\307o\372"
+	.ascii	"\357<S\250\225#g\004\360M\037D\324\262M=\200\017\266i\327\214"
+	.ascii	"\324?\243o\267\276\275n-\275\247\023\274\321\003\t\365i\246O"
+	.ascii	"\360\354\255\240>\276h\037_\322\220\223=\275\036{z<\335p\213"
+	.ascii	"9\242bQ/g\302f\255\250vwL\237'\217\247Oa\322\253VAN\017\030C"
+	.ascii	"Q7\313\275\363\200\350\274\253v|\213\212E\033\\a\263OP\377c\246"
+	.ascii	"o\252\231B\255\234\003\217\374\245o-f\252\355Z\227\351\036\243"
+	.ascii	"\332q\234\261\267\263#\344\273\025<\"\220o\241\215\323\250\343"
+	.ascii	";\335\352\330\351;\236\216`:\246\0036{\374d\021\265\316(\030"
+	.ascii	"\341\235X\365^\204\360E[\202\320\t\255\376\300\363`&\001Tz\025"
+	.ascii	"n{a\356\307\334s\232\016\tn5.a\302[\314\004\260Y\245/\322\213"
+	.ascii	"\2569\360-\246\221\324.wP\377\343\242\244\207\200\364IG\217\364"
+	.ascii	"'\336Z@\320\243\007@\025\026\215_\025|c\220\b\247\203\237\301"
+	.ascii	"\207\217\026\247\213\336\252\370E\017<2\227\247\365C\374\342"
+	.ascii	"sh\323\002\202\022_\211\320\234\035\035\211\240^]Y\217\237\037"
+	.ascii	"5\302G\2336\232\274]-\226]k\215\346\213\347.*\031]O-/%\263\351"
+	.ascii	"\345\325\334rzzi\375sKK\303s)\203\311%\203\030b\271\324\365l"
+	.ascii	"\301\344r>E\274\340\242\301\345\201\331\264\261t6\273\220\\\365"
+	.ascii	"\300\n\253\312\201\n\007TG\314\346\362\251\305\\\276\330brx2"
+	.ascii	"\271\234\316\031[J\274E\265b\tC\371\354j\261|\301B\311\\jy)\267"
+	.ascii	"\2342\224TM\334\204\301\345T>\233M\247\262(\205\366z\377\t\273"
+	.ascii	"\221\267\315\304\b\235\321\333>\203\202\304\372.\323\3044#fG"
+	.ascii	"\024\336\231\030\241;F!\370'\350\2039\324\277\272\333\272\307"
+	.ascii	"\202\3749X+x\004\236\243\243^A\037\337\236\236\327\375\335A9"
+	.ascii	"o\316\207\237{\357\202nkb\335_\324cX\3022\360XfP\377\364\006"
+	.ascii	"\276\351\255e\223z\250oB\324\312y\372\240]\273\0066\b\371h\254"
+	.ascii	"\022\"JW\337s=\274\203\244/i\302KI\275\323\315.\314\375\336H"
+	.ascii	"=\006\350\361\352\320\325\017H\213B\343\352\224&|\303\365\023"
+	.string	"4\371\023\376\337Z60\257\372%\237*-\n\r#\341[\256\300;\275\204\3774\\r\300\001D\340\013|\017x\001O\340\201`\322\330i\331\234\006|\037I\223\247]\323r\357E\022\360@\276v\255\347\272\307\352\272\340\335Nz\264/'{\244N\357t\243\023\201\r\250\201D\003\rR\246HD\224$IA\322\001A\005\304 h\245\253\007\021 9s\020\315HJ\n\222e\f\362\351\367\317\222\202\320,\315\256\037\273\227\013W\336\036\034\242|\030K[J\035'2p\b\331=A\244?\0075\350\037\276V\237\r\255^8\250\016\246\033\273\017\016\363\246\271|\255C\n\031j\315\256\301\232a\360$\202}\222,\002\315pE\013rJ\020rw\367\031\213<U\347\233\213\345\007\305\n\342\360\030\270\006B\221\277\005\241-\220\370\232G\362\352`\314\236\f]\247\242\362\270\316x'\321\340!{\300|\307\025Kit\321J\341"
+	.string	"\305\275\fH\022\300\305%\215\"\274\361*\277{\342\246\260.j\b\200u\021 \272C\332\t\212\201\332\005J:B\273\027v\332H\"\333\343\310\340\2079\026(lJz\331\215F\275\237\343\247\346\347\216\215\013?V\274\344\342\243`\376U\272\334~\210u`\f\323\241\350\256\250HE\247M\201\311MHCW\335}\306\210\2328x'B-\265\337q\212\236bO\327\365;\313\332\266p}*Gmk\374\252\270\001\023\361\024"
+	.string	"~4\007\0246|e\360\212\220aq\220\240\246\017\006\017/\335$\246\364\354\225\350\001`\267?\3469s\311\260\305i\210g\210\034p\314\326\201\\~\023m\001V\242\363P0\\\313| \301\342\337\n\\0\232"
+	.string	"e$\207\026\210\023\2233.\301\342"
+	.ascii	"(\351\270\0069l\303\314yC\326\375\277`)\001?\255\361\304\f\325"
+	.ascii	"v{v\227A\n\246\016\350\220\262\030\242\025D\367\"\300\345)i\245"
+	.ascii	"\226\344b.'\263\201\b\323g\356w\302cCl\031\275\004\332\230\330"
+	.ascii	"\231hn\345|\362\302\303\345\020\233\315\343<\231\376\233\245"
+	.ascii	"~D\022\247\200 \365#\2009Z\b\037\352\350\334\327\030\237c\251"
+	.ascii	"Bp\207\244_\352\362\215^\016\206\205\r9\332R\207R\331AP\224\202"
+	.ascii	"/\230\265\370\216\251\200\370esx\230\215;\250"
+	.text
+	.section	.gnu.lto_pidLevel.93.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\204\007e-"
+	.string	"*S\f\022E`\232N:\017\270\026\245\322w5\321\257\372,\365H\366\025\204V\363A(\276u\315\002\355\311'\211,\257f\320\366s\332\264EM\350\232\212\305j`~\007\036\233\317\001p|\\3{\033\351f\216\266\021B\344N2\020\001\363"
+	.string	"\020\001\367\026\375\262\244\371eY\222\221\326\307W\243\217/"
+	.ascii	"\333\321\230i\034\233\273n\021\264\3149y\323t\243R{\350\327\257"
+	.ascii	"\\\267!\272425o\2562\330\365\276\230\213W-3\223_\345y\\\\\232"
+	.ascii	"\201\307P\247\231g\222xu\t-\212\371\016\214\030f\303\350I\304"
+	.ascii	",z\357Mp\225\261\224\346D\245u\fM\201n\231\230 \210hTSy\201\004"
+	.ascii	"t\307\2468\311@\274\252\004&\312Z\346\317=\n\363Rb<\350\336 "
+	.ascii	"h\366\356\235S\300\021\346\210JZ\242n/\307~\274s\357\217&{\367"
+	.ascii	"^\005\374D\274\312\314\374&w\302d\206\246smn\303\274"
+	.string	"\031dto\356\275S\306\027\255W\323\017\255W[\310\231\037\256j\332\226\311\177\336S%[\240\317\263\260\017u|\325q5-23\362\3649s\246\b\242|n\236'\303\246<gh\357\024\201\032\0274\2373\261\264\350\013\2203\007\274-;\033\263v8\341\336\313\366yv\343L<3\267`f8\346\341\207}D\330\267c\251\217wc\323\312\341\264\273\227\372\202N$b\266\220\177\354\200f\276:\332?\323\276\337\332X\207\261\355\356\225\316\031}\333>Y\035\346\254\013\"\211\367\216Q\361\271`XAt\213\261^}+\021\3125m!\333?\034\203\327\312a\236\023\263\315\306\374\364v\020\346\035\313\007\240\236^\367\033x\340\331\351w\347\246S\371\t\244\226\231\214\307;/]\356\037p)\277\200\327\235\223R\313H\251\345\243\324\262Qj\271(\265L\264cy(\265,\224Z\016\272e\240[\376!Z\366\271\345\036\242e"
+	.string	"\251\345\342-\363\334\362Nj\2318\264<L-\257D\313jj9M-\367-\333\241\345#x\021\"t4H\330\335kV8\347zQ\373\216<\360\277\373\361\336\314_Z\213\342-\\\\\362\021\bVFD\355<\016\310\\\344\257[\341\357\035\313\377\332\317N\311\r\203S\312\374i\035\352\003\315\226,\355\321\247aB\341\2731\205\n\366\317\n\353\325\241\0360$\rn\260\251\177'\324L\335\324V\317\371&\006\275\0251qk\227%\024\026\306\031\273\267\331\024\324B}'\022\240\016\352"
+	.ascii	"\202\316h\263{\032\250\207\202\3167\237\376As\341zd\356\035{"
+	.ascii	"\300\234\341g4\230a2\331p\273\266\027\353U\237\276\036a\037\200"
+	.ascii	"\356\351\223\325!,A\325\306\035N\306\203\203\266{/\225\230\217"
+	.ascii	"\001\301\\%\302\376)b\275\n\240\251\206\364\365`b>\364\317;\261"
+	.ascii	"\r\234\0278\321fJlc\0235['\233\236\347\022\313\327\346\213\217"
+	.ascii	"n66v\261SL\3512f\343\360\001\317\203\227d\360\177\177\016\274"
+	.ascii	"7\2630k\256\225\303\304\276_\261\337wc\023\312\323\305\235\346"
+	.ascii	"\351\246\343T\263\323\252\037Y\235a\023\373h\234\321\021\007"
+	.ascii	"3\354\333\021\312\3610\256m\354;\325\324^\373\202\026>X\202x"
+	.ascii	"\357}\300\367\362/&\370\004\n\373'\212\365\252\032Z\313\254\256"
+	.ascii	"\243rY\265udq\344\320\225\204\201T&\265\210\264\262\220Zi\213"
+	.ascii	"\344V\263\226\324\227\326\322\212k\252+\311\305\225\274\n\260"
+	.ascii	"\344\262j\225\2022\251T\036y\226]\310\244\327\362X\205\205\374"
+	.ascii	"\260\354:*\225`WB\\He\210\343VV\227\325\316q\013\251\"\251\374"
+	.ascii	"\200\205\364\342\341\006\f\034@h\260 \305\002\251\237/\244\013"
+	.ascii	"\253\224\257\244\260\220^SK\255,\344\226\212\251.\244\025\327"
+	.ascii	"\324\225\362kJ\n\211\223^G\345\3242\231TN\025\347\232Oo\007Q"
+	.ascii	"\343\334\254O\3754qFT\250NJj\bk\315\026\343\347\235\347\017K"
+	.ascii	"RO\030>\031h\244~Rs\352\243F\352$4Mm\324G}8I\214Z\002a\332\037"
+	.ascii	"\024\247~`\201%\314&\366O\247\376\2225\261\016\343o\371k\374"
+	.ascii	"=\031\274o\213\023\335[\241\372u76\213\032\252;\214\023I\233"
+	.ascii	"\273a(\363\t_\261\177\362\225\365jQG\021\206\211[\203\243\006"
+	.ascii	"P\206\031\234\332l\\\365\327D}\300\357\254ay\253s\304\026\233"
+	.ascii	"\251\313\370O\353\201\016\200\216\250A4\305\f3L)\021\021\021"
+	.ascii	"\031\205I\322\001\240\"\221\262\262\r\021\240=eS\222v\003\356"
+	.ascii	"ii\226E\344\337\237\244\210d!\025<j\272\260\325\3365$l9\252v"
+	.ascii	"1\312\220\341\005l\207S\207\347\243\226O\2712\302{\231\314\302"
+	.ascii	"l\020n9\226\253\244?\022.\271;6\351\313\025\335\305\036\305\007"
+	.ascii	"\345_\022\r\307\337r\321\020:\226\352\317<\265q\233yAs\034\244"
+	.ascii	"K\300\330\260\3351b,\250B\240\203\032\314i\3372\251\207\203\346"
+	.ascii	"\310\210Z\300\276\201,\202d\305\202\030(O \321\347\331{\346)"
+	.ascii	"\306R\230\345\324 \317\340N\354F\374\213{\210\247'\027\330\177"
+	.ascii	"\034^\tY\007\200\030\002\n\017\356\343\352\322\250\366\275/\254"
+	.ascii	"\026a\nB\006r\374\211Wy\270\020]L\030\\\335!\211\202\262\"\305"
+	.ascii	"\207\304\033\034G\263\257\346:\362l6\362\331\036\221S\311)4`"
+	.ascii	"\227\224\332\367\340\314\n@\254y\316#\322f\235uE\307\221l\tY"
+	.ascii	"H\353\206Z\3275\020\022h\351%\245\004\001T\005P\360\340\207J"
+	.ascii	"8j,\342\017"
+	.text
+	.section	.gnu.lto_pidController.95.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`j!\305\231"
+	.string	"\372\365 6I \320\322\031\016\177:\240\342<\220\332\264z\350p\026\007\277w\r>\376\353\343=5\316\032d\241e\277\027\017\204\227\3340v\035\270\257\242\342\026(\005\334-\355\226f\361\"\306Uv\232iT\366\376\342\215j[3![\312$\003]\003\363\002`\003*o\252\362\266\312\313*\357\257\205\206!\332\225\2666\275\207n\035[\274a\275c\304\003\363\300\037\360?\374\021\377\304\277\317_\347\177\376|\277\337\217\347\317\363\347\375p~5?\233\0271\007\276\233\377\315\211Xi\367Oi\006\375\206+\356\320\323\f\211\353\f\023\344C\213\203\370\304Kt\320\212\337\341:{\364\241\303T.hwh\263>\270\007t\033T\210\271S\030(Z\030(\020KA.W5k\332\305\316\035\t?\253\224O\230\365?H\344\354\306\b\r\005\211\261Z?Oq}\266"
+	.string	"\007k@\nf\355\016\345=p\317g\207v\031\302\377\366{\036m"
+	.string	"L 4\271u]\207"
+	.ascii	"\323U\315\337T\260R\371\200!\234l\351L\254\313\340iHW"
+	.string	"5\b\264a3\bUf\225\344\323\020BJ\267By\331\336\035\271\251\033\235\370X\355\351\354\367n\347}\277s\350\365\324\220g\2355\374\356\352\030\342i\273\003\363#\223\206\214\317I\0337\272+O\256.\030\324p\307\005\344\215OkVV0\226\257\243\025\345E\267\216\365\250\001\220n\205>='?(4\374\324\344\2050t#\224\234\325\356\347\204p9\\]*\330\033\254\342\306j\177\267\307\333!'8pv\016\224\035}t\344\f\243 oL\277\346mnw\347\0169\201\275\341\212\002;Z\305\304\234noB\346\206+\n\214\316\002>:\271\027F\020c\265\313\206\013\351E\266\024\326\3067\270\256k\027\362F':\253]5F\242\300\350\326(1\372\350\344\f\327\225\214\305\215\373\003\031\242\006\253T\206\243Y>\r\222\364h\005\3332\210\007\362\306\2504\304\035\253\216!\211\363\0019VL\247\244\351h\005\253\313b"
+	.ascii	"\362\306\020j\254\316\273\227\273\231\345\317\224\360\016\353"
+	.ascii	"\252\002\235\273u\245\233Z)\344\215Kw\245\343\215\310{8\336\270"
+	.ascii	"\273\334\355s\272\265\365m\3300Ac\270\256kU\257\320=\265\374"
+	.ascii	"\224\356\233\366\362TS-X\254P\221B\n\305\t\023%H\214\210\022"
+	.ascii	"\001\365\344\024\002\304\207&\246%\245$\017H\035\216\214\212"
+	.ascii	"8\020\r\251I\244\320\321\230v\025/\367B7\222aP\274N\225\036\365"
+	.ascii	"\245.\364\232<\305%\n\337[\3309\013;O^\261w\025u\236\202\016"
+	.ascii	"K\325q2\212:o\370D\035;6\341\346%\332\234DZ\245\267d\354P\262"
+	.ascii	"6\351\321\332\240?\207#c\303#\322\025\203plP\032\373\022v8\262"
+	.ascii	"5\034\345FQ\r\213\200\222\355\3151\324\231?\2351\303Nrf8D\231"
+	.ascii	"\203\200\222\225!\303\037\332\336\304\004\206\227\276\260R\233"
+	.ascii	"\037/\234\024w\017P\26268\262.\214\304\002\034\331\013\334!-"
+	.ascii	"r"
+	.string	"\363\373z\341\324\222\310\306Gi\224\237\217\200\222\305\255\261Q\226\027\245L{kiR\250\351\2219\034\031\032s\310\242\007\013\023]\371\320\bU\350FZ\024+O\246 \320\354L9\224\354,=\201gK\r\207#3c\244\025>e,\004%\273\242\207\t\037\317\344\2731Ub\001\356\255\b\312\222t\305\034;\247\030\224/N\325\267)o\344\224W\341\235\237@Y\222F\255\353z\347G\300\221\3711\013\335X\327u9\fJ\224\257\213\3576\227\335\223\330}B!\234\266\244Reifv\274Qm'6<\"\275\303#\375<V\274\003\3132\013?\354H\337L\013X{\355\365\374'\350\025n\257\353\352ul\265ef\361\353\035y8\207\226\2628Q\213\355\215\255\266Fa\315\325F\026\252X\\G\213\361w\316QG\3470fI\323\3217\230\214\370\3231\311\250I\227\253\017\247\305u4W\277\211F\243\212^\262\241"
+	.ascii	"\323\2770\302*\026jd\357.\267,\325"
+	.string	"\370a\311^\266\262\201\324\032\237-W\270\234\26526[\262\265-\275x\351\207\241\300\344E%\035\031B-\305\206w\274\377\211^\235\376\312$\263\246[m\177\033\213\213\213U{u<6\007u\201`<h\227\245\360\224\253%\230\345\333\333\361\306c\023E\313\346\240\340\337}\315r\214\024`\330\357\230lY\006\271\256\314\207-?\341\261\245\013\373.7\3562nYfY\346\2704\263\234\343\207m\324\2228F\253\260\324\330B\205bgi\357\356\213\257Y\347\3128_\030!\223\211\222\013\027r]\327w\331'i#\237\330\031S\017\016\b}6\335 4\3335\003q\277\273\337\204[\376b\260u\356\273,\216}\303\017\3337\307\033\271a\260\2251yq?\350u~\031l]\231%\336\251]\323\355\213\027\227\211\f\364e\264\030\022\206\371\240\357\006\212w\021P\200\037\366A_\n\353\275\005\351\277y\024\223\0217\004\357:"
+	.string	"\001?,H+\321\362\325^\313\204\306zX\240Fi\037\342\350\016\tWF\334\245\373\342V\333\375...*n\253\260\233\344=\232\007\336c9\340\367W\254\234\231=\360\373\262\347}_\345\207\337\217\035\361\373'wr\302\353|\337\344\317\357\233\347\373~\311\375\276\367:\236\357W\225W\3714\177\t$\274\317W\311\b\247\373E\370\231\037\311\021\256\016\274E\036\303/\344l\276 \334\315\367\203\277\371\006Qy/x\342\327\002\037\317\363\355\361<_\036\317\373\3568\234\257\016#^\nT\336\tT^\tT\336\bT^\bT\336\007T^\007T\336\006\232x\031Py\027Py\025Py\023Py\021Py\017Pys\250\274\006\250\2748T\336\033*\257\r\225\267F\007\336\002\230xi\250\274\004\250\274\003\250\2743T^\031*\257"
+	.ascii	"*o\f\225\027\206\312\033\200\312\013\200\312k\265\304\373B\211"
+	.ascii	"\327\205\312[\245\362R\251\274S\315"
+	.string	"\333\"\211\227E\022\357\n\225W\205\312\233B\345\225RyQ\250\274'\222\274&\222\274%\222\274$\220xG$y\243\220xE$y\241\222\274OI^\247$o\b$^\020I\336\017H\274MI^&\017\274K*\257\222\312\233\224\344\365\220\344EB\342\355\220\344=B\34252\342-z\336\227\250\003\357\220\312\253\252\274\311#^\244\312+d\304{Ty\215\001\207\204\233\247\002\231( \214z\364\375\274\002'cL\234\036H\350M\217z\264\217\026\333\252\213\356%B\253\372o\235Jkz\370\332.\2140HSuU\037\321L5U\247\177M\270/(\036\245\337\322l\252\241\242xLD\350\352\325\367{\024\323G\337\253Y\260\351\366\265W\b]\373x\236\201\026&#.\271p\265X[\233\005\305\316X\264\220n\321o\212\371\372>\217+\232\305\216^\321F4L\024\365\240\027d\2206g=$\364\361\241\325\370P"
+	.string	"\006J\332\233s\323\346%\247IEK\245h\025\375\341/,\205\037\261\263\006\324\342\306\324j+\325(\372\320\275u\342\3317R\375\277\023\215\242?\314i\032\236\350\237E\367\210\235\t\335\321\335Y2\321P}%\332D\253\230C\242\243\272D?\025\216h\022z\312\305/\256\345\335"
+	.ascii	"8\242\277\310&\242\243\246X\216\022\320\377\342(\005\335\017"
+	.ascii	"OD\317h\301\356\320(\005/:\245V[\250~\352C\235|\247\314\363\247"
+	.ascii	"\334\263\347x#T\263\"[\231S?u\212\302\246a"
+	.ascii	"\210\376\320N\375\304\327t\003\321!\354\224\213Ot#\bD?1\212\327"
+	.ascii	"\324\037Z0\033%\240\353\001\\\243\024\364>@5M=\003\005\2738<"
+	.ascii	"&T\f_kR\253y\370\240U\210\331\303\246\205?rH\255v\264f\352\247"
+	.ascii	"\325\331\221\201\321(\243|\224\202\202\307\033\231\272\006\341"
+	.ascii	"\357\347I\2658\353\341 \023K\037\255\233\n\231(v\t},\rB\320\215"
+	.ascii	"\213i6<)x\226\345\017\320R\277\260\204>!\303\3001 \371\241\364"
+	.ascii	"\343\347x\343R'\275AI\210b*5\t\235\242\231[\247\362\317\276Q"
+	.ascii	"j\252hY\321^\026%\375>nh\b\243\305\306\342\342\240\244V\322m"
+	.ascii	"\327\204\363\320I\r\202\2579\210\324G\355"
+	.string	"\241\323\302\246[\207F\222S\002\212\261\266\312B.\243\024\024@\034\223Q\036*\021\225\211\312\304\343\215\035:\006\033\236Q\037\365\231(\272\240\\\274\035\340\272\202\311\330]zq\013\313/\344\272\202\305\030\243|\262\\\362\031\326\224\034o4\352\333E\361\374\374O\366\260|\212 TP\2075b\302\034\245D<\032\016Z\321\b\275)\007\036\335\243\305\230\312\213z+\f\326\362\255\250\213\366\314\240=\214F\240\301<Z\204F\322&,\305\370a#\364\251ha\322^[\264'\305\360O\363KQ\2531\332wt\177\021\263\345\034\330\346\372\206~\245\371m\356\313\361H\363h1\251c\221&\254\013\354K\035\207\272H/3)\373\362\302_\226N\306\226P\226P\2167\016uU\024\371\007g=$\344\321\317C\244\3629\222\260-\216\2113\371\263\336T\350H\377J\213m\236@\300_\317U\266\271\273\303Af\336a`\333:\227"
+	.string	"Y\200b\273\302\344EAW\372\200Cj+\373V\372M7\251/ahj\253\265\332?\223\001\247\020\232|Y\027q\251\353#\312\003\004\275\263\256+\262\325\314Zm\016\352\354\200\361 \263>\3765\r\363\376\224\365\003\225}\244_\326\034\270\002\227%\025)K3e\177\206\350\222\035>W\363\236\321#\017\307\320\035\002\002\334\321\247\241H\017q]W!g\t\265\267\352\362x\313:\221\313)\0049\210$\001\222\036\260\305W]B\260\200\0309\370\006\241\302\032\222\325UEDk\310\020\255\037\037\256\216C\355\"\222\245U\244\013K\007\220\254\t\220\220[Z[[XI#\022\254\b\206la\355`"
+	.string	"\t\004\253\353j\313H\327\225\216.#E\272\214h\031%\351\312\372\241%\004\253\207\021W\226\bW\351\226V\327\217\253\004\256\212t%\261< rU\201\bY\020liui\r\341\220\345"
+	.string	"\221$@\214@\260\266\260\272\204d%\200\325uU\301\021\027\017\254!Y;\272\210`mm\031\371\301\241\203\034\007\340\320\332J\342\001rH\326\326\016,!\036\020\271J."
+	.string	"/\002\230\001\200\013\016\\P\031a\t\311\352@kk\002 YE\324\375A\005$\253HUW\020\017\262\204tPE$\353jH\325\217-\256*\252\246\325*\202\265U\325\245\245\265U5D\307\374\327Va50s\207\331_k$]\3274\033W\363\017\306\220\346\374\005\200\356\016\t\251Zm\212\205\026\257\322\233\032\211zG\213}G\3470VI[\363\376t\252\325\252\364\363\252\\\357Clsd\334\"\356\205\2660c\3048\373\336\372\255\335\370"
+	.string	"\r\263x\261h\265\245\240\277\\\261-\337(\350\242hY\037\226\025\023t\227u2u[\233\240\004=A\004-A\033\3214[\257yY\232E\320&\242x}T\240I\322\322\234\236\210\320U\305\322\363\020\272.\303\320\\\242W\306\370\271\035\022\376\352\270,\245\267\264"
+	.string	"\f\364,T\032\344\002Z\n\b\372\201.:\223\002\030\b\232\355<\320*\354\230E\240>rR\016t\003\315}\262\2749\320\227\023m\240\233\004\233\206zQ;\206(\016W\347\227\364\004t\242\325V\004+\376qO\305\022^\236}Q\254x\013\224c\216\f\004\206i+\3121\f\364S\364\314\037\263u\212X+C\361\034\353\037.\320\n\364\307\232\371\232{\215\302\002]"
+	.ascii	"[Y\002\nt'\366\224\216\322R\214x\260\0343\346xc\002\r\203\rO"
+	.ascii	"\357I\037\021\201>\240\377\244;\017\001<\013\332G\037\320"
+	.string	")_\034\013\372\211&F\350`C\342'\364\005N\372\211\217bv\216\276\223\346\302'.\344h*\266\264\204\001\215\243\177B\253\370;\301\200\276\"\216\026:Q\235\333J\242\325\326y\243\223\b\353\354\330\350\032}\243\233\254S\031\267ol\364\335(\313\324\350\303Iz\316\275\030\363\0033b\351\344X@7\r\rV@\327\210\226E\345\271r\356H\203\017\214\007\231i/\345\334\366\252$S\302\200,\341x#\215\206\212\2361\223x\037Z\230\212\377\223g\031\266'\032?\"Zm\343\230P\211\353d\272\001*ZV\364|c-\353\352\365D@\017\320\334\002\001\375$\330\034\240\237\246\356/\315\235\256u|\223\336\252\013|bi\322\257\363(\r\370^J4\312\031\232t\362\356\320\215\350i\005\2726\373\317G1g\364\233h2Z\200\236a\270FF\337\216\255\f\204\216\321\002t\323\034\030\035@\307\350\333\260\3166\373\006\006"
+	.ascii	"\035@\037\003\255\023\t\310\016\200\236b\303c>\315\226\364\371"
+	.ascii	"\376\254Sj\320\371%\275\024\305c>\253@\327\020\255\306Y\270\317"
+	.ascii	":\231\004\005}pU\277\350u\321V\201\314g\005\343(\347\3149\336"
+	.ascii	"\370\242\223e\314=\f\250\324S\326Q>\225\317\343\215.ZD\241\336"
+	.ascii	"`\202\347\250\362\360 \022\303\240c\210DD\302H\222\2445b\n\020"
+	.ascii	"\212by\240\307\324\007\022 \225A\211-\253\221$I{\006\356Rf6\322"
+	.ascii	"\240\013V8\323\tp\211j\032\0244-5z\210\212\350\004\326\022\232"
+	.ascii	"\210+%p\277\320|\370\350\024\301\241\013\210\3103O\271\247\357"
+	.ascii	"\275&\322*XL\307\211\213\221\274^/\246\001\340\025\244\305tD"
+	.ascii	"\367GX\035r{\024>pv\030\372$K{=@\247/\004\213\203\215%9\237i"
+	.ascii	"l\006\004\304\235\316&\023\325Be\347`\363\330r>\t\236\360\271"
+	.ascii	"\246\371\222\323\002\262\307\030\244\203\366|\373\372\002\351"
+	.ascii	"\331|\201\022\267D\262p\372\017 \311\264\273\002\357\016\317"
+	.ascii	"\216\333\254\202T\036r\021*\027\232\247\307B\362\202\300\221"
+	.ascii	")\227\031\225\220\030\002UE\365\355\177\314/z\033&\037(\214\275"
+	.ascii	"[\214\335DubB-c\356A\331\004.[\363\357\342\251\304Y|\365\260"
+	.ascii	"\214\021l\303\365\267+,\246\373\207=\302\376I~\265\3614\315\347"
+	.ascii	"\023\342,}\363t\216A\315V\321\377\002>\244r\001Hp\255\305\016"
+	.ascii	">\357w\003\350wQ\r\r=\017\263Uc\006\340\006\273[7\252#\315\371"
+	.ascii	"U\320\027r\360%\254\313\255\252K\267;\177%\240\354(\307\331\377"
+	.ascii	"\212\t]\213zg\177\2742\002\203\211X\017\004f\035\023\257 \352"
+	.ascii	"\302\253\001\251,\312\262\363\317\233V\304\002\317\243\204v."
+	.ascii	"ZXV\231\275\3402\264\275g\b(@\252K\254\262OZ\367p!\357\242NJ"
+	.ascii	"\250\346\271U\223\355h\3118\251,\235Lr\341D\023\300\373S*\341"
+	.ascii	"\235cW\360Z\350\316\276\250\200\0371\204\336\347!|\231\322\356"
+	.ascii	"\205J.\240\023\216F\223\323\233y\270\002\344\241\243\262\244"
+	.ascii	"9\f\250\317N\261\364Le\304\tpK\323\020\030Z\300\005\3452\031"
+	.ascii	"\375\006\273\301]\027\372\206\230\033Pn\t\033\245\376*\353i\203"
+	.ascii	"\262\005T\233\246\350L\313\337\347\306\006\310\306"
+	.string	"\246\035\323\006\240\370%\3540\240SOmT>\031\340\233\003\204N\207E\232\323\313\247M\340\n;\335@\324\005\306:\332\205\017h\330\344j\353\364R\007\251\253\"`\n\243\203\\\3518\236\202\026w\243\314+\357P\362\265G\031X\377\254\f\342\326\224\240\b\204\300\247\242\341\276O\036\302R.\206|\302\332\365\261\\\200\264\271\311\256\335K\302\235\226n\235\333\031r\354\224\247\030\323\375`\273\237\335\023\356\006&\201qp+\001\365\266*"
+	.string	"\003\263\336Q\255\257\007\307\311e>@(\3343\013\r\333\020\022\306r"
+	.string	"b\305|'orT\200\005Pd\"$\020f\337}\331\n^RyP'\"\243\234\226\274\252\330jB~\340\271\351\334%\246\027u-\310\367y\264\206\006\277\013\003\216\224D|\262\246SY9\233\311Mw\f_g\271\022dN-\313\371\3762\004\240v\351&\303\233\017\217yN\243<Kp\0022\231\374#\337f\340[\027\310\314\353\247\240\313\320Y\222\344\t\242\350fd\325io\013\177M\344\210\236B\234\350\367\313RM$<\370\322T\306\rE\303w\310\205t\364j]\243\240L\024\225R\036\200\242\247PXA\324)%\031\237\336\211:\354H\316\262\366\031P\245(\264\211\237\271 \347\260P\270\362<RD-\353\350\243\300\213\031\330\326\266\354M"
+	.ascii	"?(\365\fx\252\303g\326\372\234-\306\235\327\256\rU,\227G\252"
+	.string	"\365\005\350\307\221\364\374\242\347\365\211\206\325\245\316\307\006<{42H\303\223\341d\345\336\251\261#\371Pu\273\334\031\b!\303\356\367\335\243um\323\255\031\345wY\316\233\036/\216\367\333\303\332\234\232>11\017\377\353\371\030\210{\332\361Q\321f\217\177\241\340`\206z\266\327\005\314\252\271^\344\230\f\340\003\212ygd\346\t\245\241\203\030\357=\025\374\335N~B\302\236\266\262\001\016\370\321\376\322:\223\374\016o1\356\272\203+\215\312\021\222)[\361\245\rqd\327\003\300\234u\326\347\243\204\236\225\305\203\255?\030U8a\025P\002\211\033F\030\rh\313k\022\"4\022S\024\362\374\247\037\223\200\025\316\230\274\221\022)c\207\215\351\330\335\ft\032^\220l^\245'!w\bS\037\322X\213n#\220W\372\240\273\3617\020\266\227\351\320$\3504\370\202E\235\035^\300\320Wl`\264\035\361\221\231\227\303\352\320<"
+	.string	"4.\\\360\031\260\346\303\272\027\031A\364\207\314j\213\033\250\025\276\215/V\213f\343Q_o\023\205\326i\032\350\031"
+	.string	"\234;^\203'\202\264\021\f\217\023\263\354~\026\277\204\300\364/a\212\201\032\353s\324\035\214\236\233\030\0249\264\347\264\353\211\312\310\217\334,\034gx8\207\r>p\364u\0034\016f(\347T\030\0206\356\261\3610R\023\357\206h\213\025\td\246\311hA\024\026\224\034%\241\304\240\006\253>\233\260v\333\276\242\005\302\211yEX\213\0059\245\275\240\374b5\360:e\027\2667\f\263\036\022\244\341\346\210\371\212\333\271\305\035\341\3309\300\242\200~OV\236\013\347\217\354\322\302\243\333\241\322\361\032\203\271\357\204Kh\245\214]\270@\302hd\314\bq\323\030\2471B\225;\351\203R}\3729\342l\222\006\315L\205T9)"
+	.ascii	"\fJ\364\032\204\013,\350M-\335\027%H\255s\n\266\274\033\271\016"
+	.ascii	"m\250\306\341\246pm'\004\250_\310T7\3544\200\020,\304\215\026"
+	.ascii	"\203\306\350\207/\352\347\244\207"
+	.text
+	.section	.gnu.lto__reset_template_77.5.97.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`;\001\305\n"
+	.ascii	"\302O;8\020yZ\003@=a\2532.\343\0049\374\255\275\351!2j\270\252"
+	.ascii	"\252\372\252\372\365\3375\016\262\022\nBBAH(\b\tMC\025\307Ie"
+	.ascii	"\234n\355{\036yY\333I\006\364\034\222\366\214\264M\263\270v\261"
+	.ascii	"\rc\235\214o\032\3436\336\341x\3261\217\307=\037_\220s!\227\""
+	.ascii	"\227#\353H\276%\373\230\\;\331D\371'e \225o+\343X\326\265\254"
+	.ascii	"\345\362\342\342\005-\364\220l\242w#\315\233\351\246\235~\032"
+	.ascii	"\352\250\251\256\372*\342,\b\230O\254\372i?\021\036\177V\023"
+	.ascii	"\013\240T\335g\237\242\267\241\300\004\030&\366\b\302\244\272"
+	.ascii	"\222}Ia@&\026\325\215\354G\007\t\273\227i7\277\365k?\031\002"
+	.ascii	"\206\345\352\245\275\214\2211\230\261\241\2518\004kp\306\033"
+	.ascii	"\t\023\354\275~\024\261\207K\327\3261\361P\300\3678)\036\322"
+	.ascii	")\005\035\0023 \260\"2\354\001\177\023\357\257lt\r\307]\273\314"
+	.ascii	"T\362\216\306\304\273Ua|Lc\223\261\030\304\257f!B\345@\305^\201"
+	.ascii	"alu\341\261\320&\212\313\260F\035.\263\215\340\336x!Da\240b\373"
+	.ascii	"s\026\326\336\207(\314\213hy`\314\36229\2443\300?|C\005S\221"
+	.ascii	"\f\005\334w5<\202\3133B\320\203*\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`\227\005\235\026"
+	.string	"v\343\202F\200ZN:\235\212\016\t\214n[\354\307:\324\365P*\333\004n\303\362N\327\315P<OB\321j\272/u\265\266\262\366\365;6\316S\314\023\321h4>\374\017\225\214A\354\231\243Hx/)q%\312\332Cn\231\002m"
+	.string	"v"
+	.string	"k"
+	.string	"\037\276\345\341Z\035N\244\013\236\305\241\337\265\241\201\206v\232\\30=u\323\304\360\240^\350\245iAG\377\253\300\200:\265\322\254\302\246F\232L/[:\231\322\331$\235\016R\337\313<:\032\205\237Q\243\233\321\242\247\t\021\335\r\255@`\245\2623\241\337e\362\277\301z\340`\350\377\t\034\n\377\376\313\224\354\326Z\353P'\315\377<L\002R=\034DTFSE\364\277\262\362\365\246xRVP\274*\3357x\344\306\021\375\217\367\241\r\bR\217Cw\016j\374\r\215\267\241Q\227S?77WgF\237\r*\202\214\237\211\321\3472a<\313\213kqq,-\276\306\342j+~E\305\255\244x\030\212\213\235\370\230\211\203\321\022\377\"q\257\021\375-S\301\313\2108\027\r\321'\263uX\377\2409\020\3751\033\007\033\371\247\0306\362.k"
+	.ascii	"#h\333\305\222\003w6{xK\255\036\336\342\226;wO'N\006\020\\\256"
+	.ascii	"\265\376\236u\256[\373i\272\257\306H\037\256H?\216H\177\315\220"
+	.ascii	">\034!}4W\375\266 }7 \375\342\217~\030\037\3757__L\257o\306\252"
+	.ascii	"?\247G_nkU\377\313\362\370\016\003:$\344\030\242\177\224/j\347"
+	.ascii	"\013_)j\373\265R\270\204\334\331\267r\005hE\251n\345\222I\330"
+	.ascii	"\240\234H\362\n\307H\246\002\356\345\342\220<\351!\031hk\231"
+	.ascii	"\214d\002\305\335\n\024\202\275\214\344\0373\222y\202g$oy4\222"
+	.ascii	"\003\004w\247\212\351\330\207(\244c\037\340\250\343^\271O\253"
+	.ascii	"2\005\353[#\363\312\375\360\327\304\311\271F\016*\273FNP\\!\257"
+	.ascii	"\221\201\276F.P\006p\2501\030\307#\225\024\224\2444\225\306\360"
+	.ascii	"\002\2411\316\001\021\200\030\316\034\231H$\222H(\350\001\277"
+	.ascii	"1\321\"\252:\016\350\341d\336@yd\353\221\210j\310\203\313\207"
+	.ascii	"\307\320\235\006j\035\251~\233\213\322{V>]\337J\272,>\017\037"
+	.ascii	"DU\025UQ\250\252\242*\212\325W-`\n\213\233\224\005z\016\350\267"
+	.ascii	"f\013*8f\254@\317g\006@3L\241>\016\377\n\341T\272/\245(\220\034"
+	.ascii	"V8L\273\266\0049\267\366\2154\310\r\272\227g/\372\275\277\332"
+	.ascii	"\270\246\214E+\263\246\035\205\226\332\r\361a\341\3307\270\303"
+	.ascii	"\342\264\034X\256A\353Q\257\035\bRDk\365\007\233\263\216:\320"
+	.ascii	"Z\020\f\021\030t\264hVT\005"
+	.text
+	.section	.gnu.lto_.refs.f1dd4492f1f168cf,"e",@progbits
+	.string	"(\265/\375`+\001\245\f"
+	.string	"\266\036\\E"
+	.string	"\217(\351.\234\034\325\230k\262"
+	.string	"\276aWQ\256R\331\204A\302\022\205\267\272\253\002T\210\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\033\323\374,\260\302\0266\304/\364\307\262\237H\240\227/\360\353\366k\321w\337\266F\266L\001E"
+	.string	"J"
+	.string	"H"
+	.string	"\336\243\276<\354\236#\324G_\236y\007\370\034A\335\350\371)\200\256y\252\3213^\317\256\235<63:\213\373\021\316\2476_\212\277mch\317aE\373/h\376\224y\223\366`\366\235\370\\<1\346\232\367\363\024\017\013O}\020\036:|\364Y2h\372\256Loe\335\200\326W\\\027\341\364\320\324A\217\276\321\321;\260o\245\022"
+	.string	"}\314\305\373a\003\362a\244\376\213#\377\325\" \277e\324\337 \312W\351~\f\241\236\362\345\255\356Q\276|\025\245/\003\223\336\005\251\237E\f\310\377\242\002\365\223X\375.\234\177D\374?\230\374\0326\277\253\244\237\224\274\352\343I\242\\\024\372\357\313;\341\005Tgx}\353z$\371\034Y${\030U\377%\244\237\"\3257\001\322\217\241\032'H\005I\222)\361l%\202<\020\357\013\027-b@_\030\224\336\025\035_\024\253\336\023%B\2761\325\367\305\352\025\021\202\365e\361\370\256\250\230\276\256\315\327\202\247\267\302\347K\301\373N"
+	.ascii	"\277\022<\337\b\020H\337\007\243\257\203\223\336\006\001\020"
+	.ascii	"\004\00172\341\033\2303\254\245<Q\3362]K\2517F\305\017\b\224"
+	.ascii	"\022]\301\200\361\026\003\024="
+	.text
+	.section	.gnu.lto_.decls.f1dd4492f1f168cf,"e",@progbits
+	.ascii	"(\265/\375`\017MMW\001\nMf\200U LI9\351\266;S\307l\304dD\317"
+	.ascii	"N\355\316\337n\256\377q\325\371\334\234\216~\331\273\231\271"
+	.ascii	"\231\275\235\271\371\377}vb\rS\253\310\310\257\bB\364\352\"\037"
+	.ascii	"_>7]e\306\363\366\304FC\234\"\352\373{\374\274\246*\345\316\330"
+	.ascii	"\315:\334\232\220\275\345N\001\372\006\366\007&\b<gW<\254\266"
+	.ascii	"\274\273\374\035W\333\374\255\267\352\340\004\341\353\373\323"
+	.ascii	"\\<d\250\223\206jlK\006\270*\256\315\f\356\255\336Q\251\351\353"
+	.ascii	"\226T\3139s\260s_\224\314\350\373\363\013g\351\266\252l-\255"
+	.ascii	"F\245\261T;\257\022}~K-\025\256\323\200\314\234\271\354\204\345"
+	.ascii	"\2349|\370\320\263\207\244\307y\331\2202\274\260\365DH\337\237"
+	.ascii	"7\336\364Z_\251\312V\266\025\265V\326\266\312\0064\225\314X<"
+	.ascii	"J\354\336\300\331:jc\226\347\275)\006\337\\\303\177WIk?!W\320"
+	.ascii	"\240\275\323\324r\316\033|n\330\255\341\321WD\2107\3329\326e"
+	.ascii	"H\235$\007\236([\204\030\241\322g\036\332PA\351;%i\325\364\230"
+	.ascii	"\003\246\357M)x\315\036\225e\355\363SR\346\215\017,l\316n\256"
+	.ascii	"\253\272\005\22095Z\226a\376:G\007f\211W\331dY\312\231#e\304"
+	.ascii	"_\327\320\031\353\373C\302AS\005\tK\233\022\262\214c\266\314"
+	.ascii	"9Y\373:\037Y\276\320Oz\254\313\372HCi\261\356\352!\375\325\\"
+	.ascii	"m\326K\332I\033\351&M\326[-\245\221t\221f\322J\232H\203uXGi\257"
+	.ascii	"\252\354$\275\343\255\325"
+	.string	"<~\337,\331\226}1$\t\233K\343\266L\322V\255\303&\303J\240\362\261\3149\317u\222\356\321B,\032\026v\243\n\223\006C\255\263\3110\036e\027\331\362M\275\363\225\374k_Ky\265qS\357\200\246\204r\025U\233\331_\327t\222\n\247\336\331$\034~Qem\231\367\3275zXj\235\277\366%\251v\226\204\345\234\374\200\364\341\314\242\006\b\025\005\334\016\342S\227\345\f\215\2767\275p\373\350\037U\331@\376\n\246&\177\323\266\262Z\316\311\fvJ\307\230\267\276\257\036\316\240\277\277\277\277\352\341\274\311\003_\273jt>K%:o\316\300\255\343o\027\375\242st\240\273\342Pm\351\213\003\tX\266&\216\254\357\315\026\370#d\320\370;\253o4VU\266\215\276z\323\250r^\323j\324: )\241Lu\246FX\316I\021#\332F\317\250u\325N+K\301\351\200\t\234\2321\276\234\223\037\220>|"
+	.ascii	"\246)Rf\017\337_6\330\236\301\277e\360o\035n\030!\3361|\252p"
+	.ascii	"`Y\322\027H\207\353\262\032\235\001`\303B\225\350\3745\303\277"
+	.ascii	"L\360/\027\376\255\201o\351\340\3336\370V\f\276]\303\267b\270"
+	.ascii	"C%:\317W\215\316\333.|{\003\337N\341\267\036F\222\303\3573\374"
+	.ascii	">\202\337:\360\341z\n\177n\211oW\006oP\211\316/\253\321\371\n"
+	.ascii	"\207_\251\340j\246\236\251\312\f*\232dP\177\305\300V\245\357"
+	.ascii	"+\024\374\232\301i\377\376j\006\347\353\027~\325\201\253\230"
+	.ascii	":\246*+\250d.b\304\255TZ6\3139\031\224\341\016\331\035;}_i\340"
+	.ascii	"\327\n\316\372W+8\357\002\006\241\032\235\367K\005AI\035WD\274"
+	.ascii	"\324.\326j\306V^\31399\344\203%,\216[_*\325\rhJ(\347%oK\271\032"
+	.ascii	"W\225\265K\227\nW\271T;\257[\306\266\3149\177\340\360\341b\341"
+	.ascii	"\353\ns\336\312\245\262\325\255\r<6\272\240q\351[\321BH\251f"
+	.ascii	"D'\226V2\257\345\234\203,\234\027\027~}\277\002\277\246a\321"
+	.ascii	"\362W-\365\255f\251\312)\365\354\235\314\271*\347\374\232"
+	.string	"\254R\331\200\314\234\267\334\302r\316\347\340\017\361\352V\333*\033\005-r\336:B$E\346J\034_\316\371\003\322\207\017\307\263\"v\360\275\t\370$\340\252V\255T%\207\272\366\212V\323nN%s2\347\034T\367\274\250\262\372>\004\374\023|\275r\"\256<\342\0310\tr\256\034\316\372\367W9\234\007b\241jtv%:;T\243\363\2157\250F\347Y\211\316'\253\321\211+\321\371\327\002|P=T\016j\207\013\376\272\200\277\"\240\022\240\202\360W\013\376j\200\277\016\340\257\033T\020\031\030U\rE\030\3746\210JX\200\277\232\251@\375`A\260\372{\203\t\032h\022l\300\276X\253v\254\213\212\242\246\260\013\260\016hQ\342\257\310\252\232\206\352\267&\246\376J\301\177\n6\360\f\nPW\260RV\004\177\247G\020t\361\216\251jl\b\216\346\326\205\337\262\370\253\004~\033u.\377\267\324\020\017\350\253\004h"
+	.string	"\222m\341(\204\340g\353\330\026\364\356\366\277\355]\376k\371\253\234\005\301\337t\354\223\361?\322\3239\374v\313o9h\252S\354\007\376\366\251P\275TU\374\025\214\365\300\177\024\236A\r\341\023\374WYGT\017\265\203\277\226\261\304\277~\360\327:\313\364\327\004\324\r\376\212\301\337(*\007\177]!\342?\231\346\372+\002\376\252W?\324\016U\250j\370+\212\032dU\3745\203\337.\375\265\001OQC\370\007\377\315\372\373\357\026\375k\333o\225\252\320&\325\r\374\365\213e\341\257\301\337\342\341\337\036\374\375\201\355\300o\213\204\277\235\200\003\177\365"
+	.string	"\304o\005\260\001\353A\003m\201E\300_\241D\311\300_\017\360W\0014\300b\340?\005v\205\377\031\374/\300\177\024\352S\r\341#\374v\004\177\307\370\273\305\206z\201\250\233\377\375\340(\\\003\374\025EM\361\373\337\n\254\005\222~\376w\350\3051PC\360\236\337\262\375V\205\020,\005\216\177\353\243fQ\020\263'\224\340\257N\177s\271\371\302\337d\177\233\375-\345\357\261\277\241\374]\366\367\331\337K\326\204\277\273\376~\362\267\023;\201\377A\277\031\345\267\022\370m\t\277\205\300oE\370\355\002~\233\200\337v\360\333\340o\r\360\333\001\374\026"
+	.ascii	"\2775\372-\360\267\377\273\357o\276\277\345\374]\346\357\272"
+	.ascii	"\277\307\374M\367w\334\337W\376V\373\233\312\3372\376\246\372"
+	.ascii	"[\352o\022\374-\202\277\243\376^\361w\361\357\245\277\321\277"
+	.ascii	"\223\376\036\376-\374{\003\177g\340\357\013\374\275\302\337*"
+	.ascii	"\374\215\342\357\n\374M\201\277Q\370\333\204\277%\360w\004\376"
+	.ascii	"&\341\357\022\1773\340o\005\374\r\302\337\026\374\365\354\357"
+	.ascii	"\n\376\006\300\337\033\376.\372[\350o\240\277}\376\356\371\033"
+	.ascii	"\377\265\305\337\367\357\376\373\177\275\363W\277\277\356\375"
+	.ascii	"u\371W\275\277\272\371+\233\277\342\375\025\315_\217\1775\363"
+	.ascii	"\3272\177\255\373\353\323_\351\376\n\346\177\323_\277\374u\205"
+	.ascii	"\277\242\370\217\346\257(\374U\356\377\332_I\374\265\001\177"
+	.ascii	"\215\373\353\226\277\006\371\253\333_\263\374G\341\257Q\376\372"
+	.ascii	"\342\257!\370k\324_\223\376\247\370\353\212\277B\3755\375+\362"
+	.ascii	"\257 \370k\361\257\304\377(\376*\374+\007\376z\201\277\246\370"
+	.ascii	"k\005\376z\342\257\024\370\353\003\376\352\200\277\206\360\377"
+	.ascii	"\204\377^\376\313\375\227\372O\367_\303\337\337\337\337\017\354"
+	.ascii	"\340\317 \200\377\003\257k\027\312\230e\322\353r@\300\234\271"
+	.ascii	"\302\204\231\275p\271j\267V\242\t\335\322\310\337\252\335Z\r"
+	.ascii	"\203\"\346>\271M\256\223+v\303\252\3622\271H~\277n\222\252\313"
+	.ascii	"\344\036\271\034\320WV\376\341\362\004\213\213\237\373\337%\277"
+	.ascii	"`\377%r\213\374\rh\254\207\025\\\337\253$\304\357\222\237\270"
+	.ascii	"\270\251\256\276\247S\211N\013l\320\020\374\240\034\370A"
+	.string	"0\360\203\250\360\201\352\340"
+	.string	"\330U\2423\204\\\215N\036\273Jt\036(\r6:\022\374\025\"d\005&\\fc\\0\321\234\340/\220\013\244\347j2\327\340\271*\003T\206/\320\272<.\217\353\243\001V\220,\261\026\024&S=~}dp\221E\215I\037\232W\327W\337\003\021\301E{\301\233\243\336\035w\207\225\037K\240\033\370o\265\253r\236\022@P\221)x9\372^"
+	.string	"f\303\306\305\021W\206G\211\r1\266{\343\027G\233\251\241\271\312\340\207\213^\004\177\261\252\362bu\027)\0370)-\r\260\033\033OZ\354\341\013\256\\\375\352\322\300y\313\026\240\027\366\274P\371\234_\032\246\031\261%X\372>\003\035.\312\021\274\265b\255\374\355&s\022\2367\"\275\340o\214\030\215\346V%s\326\251e\313\234\006\346\232\022?-}\237\201\r_@\346\272\2700\256\213k\205\245\340\364<\261\302\343\257\357\177_\374Z\351\3353T\322\340\365\375\234F\363\037x\222\251\341\327\327\367\031\304\360\021X\360\267\352V\221\301y\341#\"\301\337\251;\365\267\b\344\026h \320\031\302e\306\227!\b\356q\013\376f\345\315\365N\004\257\255\251\251\0018\031\242\306\217/\3479\r\372I\231Z\222\276\377\321\303\032\244\202\267w\356t\332\235J\313Y=2\230\2441;\357\264\374\315\351\373\0375\034"
+	.ascii	"69\227c\375p\316YJ(S\265\261\n\263vn\375*\232\033\016\253\276"
+	.ascii	"\266\017\370\243e\213\017\255\276\266\2165\203\033SG\255\257"
+	.ascii	"\235c\371\202\324\311a\206\357\226\216m\313\203\321\303-\311"
+	.ascii	"\001\350\244\005\2243\030Z\355\311\r1.~\244\340#\270\340\355"
+	.ascii	"\336\336\013\245\224\245\027>\262\022\274].\377v`\316su\340n"
+	.ascii	"\340\243\262\340\255\236\322\352\375\255b\035\335P\226-3V\326"
+	.ascii	"\340?R\370\bN\360\326\315/bDUZ7\265\016)K\355u\240\223\324\340"
+	.ascii	">m\360\320]\360\226\215\322\262\261^\356TZ\226\022A\030\027}"
+	.ascii	"|9kiP\305\300\260\243\206\031l\001X\232\247\261x5\347\234\265"
+	.ascii	"\262\024\234\004dm\301\362\340\227Wu\345V\315\233W\023\"l}\357"
+	.ascii	"\303\206/\230\203\346hl\013\234\251Hu\020\342u\247\357}\234\340"
+	.ascii	"dua\206\256E\3372\365\310\027\251#}\357\363\205\355\030K\246"
+	.ascii	"*/g\353rP\320\2279B\340\372\336G\bf\221s\316\365r'\317\345NK"
+	.ascii	"\207D\344'%J\337\373\334\300\026\f\020\221\031zo}\3573\003\333"
+	.ascii	"/v\362b\300\320\367=v\260\225\343\320\363\326\246\225\325\367"
+	.ascii	"=w6\356gJ\207[\231\276\357\021\003g\267X8mxt\365}\017\033\234"
+	.ascii	"Q\220\340\255\333\253\322\272\331(@\253\234mt\360eH\017\031\356"
+	.ascii	"0\027\274%\273\245b\2236\213\b-\254\362\224\223\016`\320\270"
+	.ascii	"\314\3702\026\226\006mY\304\310\316\312\372\276G\t~M\246\231"
+	.ascii	"U\221\242\264W,\026\313V\225v\315\252eic\345o@\300\234\347\316"
+	.ascii	"\326,\332\337\200\252\2229\311\251f\313W\031\337\207S-\216\007"
+	.ascii	"^\317}\017\022\374\236 \370=Z\370=:\360{n\340\367\270\300\035"
+	.ascii	"\322\312^f\317p\006#\305\303\243\213\313\231)\267g@%s\370\220"
+	.ascii	"\230\371\220\351a\003\317L\212\211\227\203\306\222\244\211\274"
+	.ascii	")_\372\036H\007\037\210\207\177;f\243p\305\260\003C_(\031\310"
+	.ascii	"\242\024\311\353{ \035\376\b\031Y\302\254\023;\243mi\233\330"
+	.ascii	"'V\254*\255\023{uK\303\326pb\261,\023\213\2065\2013Z> }8>\221"
+	.ascii	"\303\303\367\267Y\267L~\013\303\306\260a\330j\311\327\223\276"
+	.ascii	"`\031x\225\003\310\206\273\212\307\230\265\321u\026V\327\354"
+	.ascii	"(\2637pL\t\3139\317\3450\013\313J\354\227Eb\215\330$\366\005"
+	.ascii	"\273\304\026\261^\226HU\332#v\353v\210\345\372\365\261$\254O"
+	.ascii	"\213LGw\001\252\022\312\271KJW\331#\266\007\330\322\036\261?"
+	.ascii	"\254\220\033\007x\262\345\253\214/\347$R\317\224\033\223/G\367"
+	.ascii	"@$\230gY\211\316\003\265l?Q\336\025\351{\340\224\3051\340\343"
+	.ascii	">|L\007\037\313\301\307p\360\261\036>n\203\217\361\360\361\035"
+	.ascii	">\\%:oW\211\316\246\021\3426\213\001_D\312\372\036\327a\n\266"
+	.ascii	"\252\321i\325*\321y\314\005\037[\301\307e\230\202\\\215N\233"
+	.ascii	"\254D'\006M\202\225\254v\f\267.\354\213>\253\331\006\026\212"
+	.ascii	". \313\214\205C\203\343\0270\006?\202}\247\377n\263u\221m\013"
+	.ascii	",\225\263T2\327@r\302\204\313\214/kiy\2702b\210\201\365\265-"
+	.ascii	"\364x\320j\3148\323\367s,\325\177`\317^\231;5\226\312N\335Xc"
+	.ascii	"En\212y\304\316\215,Ui\245z\307\377\207Q2\027\247\357y\356\340"
+	.ascii	"\377\365\375\237y\n+\347l\303Lf,\252\237\363\257\257f\255\036"
+	.ascii	"\376\f\325V\f\376\337\234o\301\212d\226\272#'\347\\\345`'oS>"
+	.ascii	"\372\376\357\220M;,+5.)\021\270\262\252\270vX\251qe\rY\251qe"
+	.ascii	"\251\252%RCX\231K\312J-\347\241\252*\251\022[YVjSy\310J-g\345"
+	.ascii	"\026f\262jNrI\345\252\255<\224\253\362TV\333\312\352`U\305\225"
+	.ascii	"e\2456\2255d\245\306\225\225\325\270\262P\256\232\302\202Q\225"
+	.ascii	"\261\206\262\032\027\234\254\266\225%d\245\266\225e\245\306%"
+	.ascii	"\244N\261\372\373\221\025\203\234.;5\313\252*\323\270\3721\205"
+	.ascii	"%dg\225\334\312x9\3275\027\031+\333\345\214A\316?\266\260\360"
+	.ascii	"\246vT8*;\032TY\246\266j2\347\314\341\212\252k+W\331I\325lg%"
+	.ascii	"\266\225\263\030\025S\276\3129\347\016\244\222v\371H\265\223"
+	.ascii	"\"\362#\317p\221\363\0049\231\363U\316R5\333\345\234\245r\316"
+	.ascii	"<X?\2229\367\020\262\n\273\272\312Y\013\351*\377\220\332\342"
+	.ascii	"\"\347^c\003\227e\245\326\265\025b\313\025\265\260\374\")U\255"
+	.ascii	"fl\345\260\214\307\205\205\325\244\320\362\214\234s\215\203\303"
+	.ascii	"\262n\354\365=\217\032\376\333\317\016\220\23397''\325\022\314"
+	.ascii	"E\363u\235\326\242\343n\254\357y\222\360%}\340\202\260\341\350"
+	.ascii	"\233\374\251Q\343kk\016\020\263J\230\262)9qj\2277a"
+	.string	"\356\304\311\033\200V\372\344~\354\301\351\341\221\243\205\026\345\337z\211\026\226s\026\372a#G\313Z\337\363\030\301\177\277\311+\363\301%F\337\274n3%\253\031\343\323\253\312\316k7\0271\3425\231\263Y\320\336\01797\356=O\017|\036+\3747\233\306\243k\323\206I\337\020\215\327e\272\213E\303\"\341L\214e\316yM\253\251\312\306\353\273wU\247\371M\346\\\205\327f\032M\265[\313SY 0\301\242Sf\255\312Tar\336\232\253\321\3713\215\207>\003\254J\006\001\323\304\001\262\326\367\347\030\374\323\r\377\264\202\377\266{^K\241E\001SG\306K\235\276\030}_\225MfL\016&wz\210\0211\342o?9\233\345\234)\310\360d\f\034\230\276M\367\274\377\300 1M\234\250\351\3739\177\373\017\254O\334\310\260\204\231\223\342\245k\255o\317u\177i0\357\271\366r\021#\376S\325s7\347\251Z/"
+	.ascii	"\252\365\002SN\311T\225\363\376\244\202\377\226\353\022y\212"
+	.ascii	"\225\030Kk\003L\271\346T\362s\211\036\0222\"e}\317$'\226\017"
+	.ascii	"\230\225,Dj\235\331\005\203\233\267\276GB\202'@c\304\310y\004"
+	.ascii	"\t\347)g\352\226<s\234\320\230\362\372y\344\315\207\016=\033"
+	.ascii	"}\317\027"
+	.ascii	":0w\206\253\007\236\340\t\020 '\221\253\226\363\025\247K\327"
+	.ascii	"O\"m\\p\362\372\236\\'\226\030\220\261\274\276\347\020+d\312"
+	.ascii	"\013\216\252\276\347\326\337\354\222:\256\372\236B\032M\222\""
+	.ascii	"g:\372\236Ax\204`\361\233c\271\264\232\031)v}\217\344\002O\220"
+	.ascii	"c\307\216\323\207\214\260\333E\007\\Y\217\237>\200\324\256\254"
+	.ascii	"d\364=y\234X&\233\257\033q}O\2559\230\303R\306e\23496\250\371"
+	.ascii	"E[\213\031\313"
+	.string	"\264d\223%Y?s\374\"F\2348b\320ia\006\307\215{\026\267F\013\030\360\212\232\222,6\354\326\334\0356$}\317\253\023\353.ch9rb\2355\206dy\321\201Rg\212\212\217\206\275\362\021[\273\262\321\367\234\361\267\2714-\313\rd0\007\271\340\377s\352S'\214*\224\244\272\363\021\366C\212\217=\253\2370\364\256\210`a\365=\253\316\027\031\332\270]\2119_\234.z\354\210#\006\005[!\231Q\344lq\221\364x\355\370\262\353{R\325\272\032pv\304\372~N\275\243\342D\313\b\033F\372\363\363;3\322\024\264\257\262Z\306\310\021/\363\357g\366\251\252\"%M_\363\316M\273\353*\243\246\257\031C\255k\036I\030\313\rR\360\006'f\237\331g\362\335V\345 J\200e\316\364\304\364\375\206/\274\201\315\204\301\204\301\344\253wf\372\346$\020\245N\313\244s\223\357\007\313\224\277\271\rR\030"
+	.string	"9\202\377\31537\325\374Ui\2361\345\3303?Y*-\327\340i+\243#\306\227\255\264<"
+	.string	"\311x\303UD\357\246\234\233qD\214x^\321\310\225+}\315\275\327#q\256X\365\275\2714\341\374@ \0237Y\356\364\375\221\031l\276A"
+	.ascii	"\220\276!~f^_qy\002\244\257\351\346o\376\0033dA\363\372\321\367"
+	.ascii	"s\3146\377\201\226L\327"
+	.string	"\031\252\276&\236\271\246*Og\262y2\b\210\313\0136\272\276?\242\303\257\247;KPOw\232w7\323\374@ \227 E\270\372\376(\016\377&\232\037\310\203%\215\217\260\276?r\303?R\342\332\027\274i\226i4\"\254\345\251,\017`l\304\3711\244\304.\212\016,D&x\263\256\256\347\256T2\327(\242\202\245f\214/c\315i\020\002\016\313\252\357\217\246pQ\223\340\3151\377\030+\346R9\201\270\241\223\243\357\215\342\340\"+r7\351\344L*'V\007r\033\234\237\017\232\026\\T}M0f\030s\316\374bz1\262\303Emk7\271\210\030Q\225\346\232\031w\242\003/\260\234\271Zf\254\037\032\374h\001B\006\243\257\331\227\277\265\254\276\346\233\271\005\0307\343\314\217\2767\341\274\314(y\322\267\335x\314\260\252\330\372\336\324bc\020\023\007\243\357\315,\377\201%h3\204\254\257\331\206]\030m\311"
+	.ascii	"\310&-\357\213\355f\333ob\251x&\216\016\314\360\241\365\246/"
+	.ascii	"P%:\315\032!n\2625\330\032\035]\024\\\004&x\363\312\22505lG\216"
+	.ascii	"e\337\033\r\301E\\\2027\321\252\322D3\325D\360\022\312\271\013"
+	.ascii	"\006\\\306\322\322\200\347\313\327W\227\251\366\233if\225\266"
+	.ascii	"s\346\247W\325\027h\253\032\235\025M%:o\004\003\027\271\271\272"
+	.ascii	")\304\3342\207T\245yeR\tA\225\247\306\030\340$\253'F\262\007"
+	.ascii	"Z\3373\036\031<\332\326\372\276\310\017\277\232q\231D\360\212"
+	.ascii	"\230]\024PYE\300\254\316\313DR\355\274D\200\"\246/\211)V\355"
+	.ascii	"\264\204r\225\233\233\345\230i\304\354\002\222\032\312\231\b"
+	.ascii	"\231\2602s\212if\222\231QL)Ui\216\231_7\267\314!GJ\232c\346\013"
+	.ascii	"\365\256\332y\211`6f\351\223f\016\230\035\320\345z\036\005TV"
+	.ascii	"\0218c\263\0243\225\230N\252\235V2\333\360\321\322$\r\031\363"
+	.ascii	"\211\t\245*M1\244d\316k\0342\330Y\303wv\336\337t\322\344\007"
+	.ascii	".\206\217\027}M&zjt2\210\364}Q\033\376M\260\2524\303\202^4\211"
+	.ascii	"aI_s\311\363`H\305\220\321\367sn\216-R\306\364}\321\032~Q\032"
+	.ascii	"~\321\023\363\b\276[\002!\323\367E`\370E_\370EF\360\213\202\340"
+	.ascii	"\027\361\300\277I\304\3542"
+	.string	"\325\302\310!\323U\353\316\214\231A\325\367E9p'\253\321\351\241\022\235\246\017\023\210\031\344\007\006\225\301\031i\353\373\242+|\363\307\177 \nH\352\332\372\336z\271\323\344q\263\307\017l:\260\260\253\276/\262\3027w\230Z?\020\bo\t\033Z\337\027e|S\307\177\240\331\366'\207G_3\007vA\264\227A\017\0207!&\215\2339~\263\206\211e\342p\341/\006:}M\033\346\215\2338\314\254l\342\350`+\347)\023G\220_\316SA\265^P\353\005\267\254\013\f\313yO\224\207\217W\215\316\f\225\350\354\270\0207i\220\361\262\244\322\367Ds\330\310F\260\222U\263\205\331\302\224a\255\362\024W\007rp~h`\252\351A\321\021\343g\013\212\216\345\355\201\345N\315\204aZ\331\027\262\326t\3655_\234h=\252\340\372\236\b\213\351\202\310\t.\242\021\274IeRix#\025D\316n\255\357\211\216`"
+	.string	"\360\005o\3467\246T\307\021\201\312*Oq\031\200\254\f\321\016|\"*\\\224\203\277w\356\3247\031\356\326\224)\353{\ru0\005^\301_;o\256\237\355r\363Z\236\2621B\312\0205\370\032\3420\005?\202=W/\337/b\304}s\353\364\334\315ZYj\357\002)Y\032\250\340k8\202\003\020\026\374]\3369\027\206\356R\263\013,\t\264)\321\240\205\003"
+	.ascii	"\003\316\235s\341\\9\235\267r\016\343Q\266%Y\3368\277rl\021\251"
+	.ascii	"\037r\372\336= 6T\240\240ip\201?\024\007\003@\312\2325W\217\003"
+	.ascii	"\331\220 1w\256\330\344\375\352\351\2351\200!i\321\367\272\261"
+	.ascii	"f<<\372\346`\350{\333X>\270\"m\234\364\275lz\257\257\n\225\277"
+	.ascii	".\377\201B9$|}?t\207\213\276\202\277j\324X1\"he)8\030\200\241"
+	.ascii	"]<3%s}?\324\005kH\006\177\357\376\256\3524Uy\357l\030\021\326"
+	.ascii	"\266r\026\003\230\300\321)\003\246\021\362F\257\357\207\336p"
+	.ascii	"\207\027g\316\3303\245\337\322J\332\026\230\276\037R\342\r@\202"
+	.ascii	"\277e\312\2549\301\033\274\202\277uulC[x\203\215\340\357\230"
+	.ascii	";\206\312\020\r\274\341E\360\227\216\316\232\251X\030\313\213"
+	.ascii	"\263%>\362\013\376\202\001c\355*\026n{1e"
+	.string	"Y\207\217\322\004\177\277|q\003\327\206\217\350\202\277rW\316\206P\031>\242\n\376\306\305\245\240f\t>\242\021\374\335\262\345oW(\313x1\026&\304\205\217x\004_\365\252\036\231Q\235\340\257\233\233\231\020l\364&\370\233%Kw\251C9O)\201\373\201\215\356\202\277X\260t\227\023\253\004%\330R\210\007\356\020d\355w\315\236\341\\\207\001n\326\240\365\275\220\fl\024&\370{\345\312\363\254U\236\032\002\302\227 ?\314A\310\331\317\256Z\025JR\235\311\013\313Y\313\003\320\2355t\271\312\257\332[\217\025\277\"n\372^*7\355\347\306\020\276\267\233v\321\230(\241\261\243m\216\024=\252\233\264j\235G\343\215_P\036\346P\026\374\177\315\314zLM\3135(\220\"\245\345!\250\317\bW\235\276\017\032\203\215\336\202\277e\312[f\347N, \215\"S\226AJl\244\026\374\035R\225w\310\035\003Z\345|\343"
+	.ascii	"_\032\355w\354\277\\\267\353F\0312\003\307\225\276Pn"
+	.ascii	"\224\"j\320\364}\220\030\276Ll\225\013V\355\002g\n\242N\304\224"
+	.ascii	"C\212'\247$\340\231\202H\246t\350\244\242H\034\036Sd\321\230"
+	.ascii	"\324\003UD\323\224D\t\023'Rt\211\003\272"
+	.string	"T\034\246\300\202x\302\321\230\032OH\321%\241 4\035*=\251p\204\246\303\024Rt\351\b\225\016Q\244PO)\024\005\220&\216\316\024<\242,\210N \216(\013\342\t)\261h\202X4\001T\001\246\244\324\210B\212\226\020D\024\"=!D\302\t\023\036\240\244D\342(%\026M\024\245\304\242\211\fAg\n&\035\205I*@$\2518B\262@\242I\005Z\")\205\024]\322p\246\340R\221xL\221 P%\250\246\244\"\021\304\021\t\005\342\250\251\t\252X4\026yR!\352\002\021y\266`<2\245\306\"\217\212!\332t\243\236\222\234P\247\363LA\023R\230@\001\242\303\007\222\214M#\240G\343\bAJh:\\AL\223H \207+\240JF\247#qH\024\365d\034\001H\303\207\351P)E\221@)8D=\031G0\212\032\036\217$\220g\n>A\031\217K\302#\232\242N\303\343\360\t\304"
+	.ascii	"\222\212P>E\025m\"\205KO?\251\260\270\364d\026\227\236,\352\002"
+	.ascii	"\021y\221H\364\250\2444\344\211z2&\335c\372d\225\320\342\022"
+	.ascii	"\261i\310\243\204\"\241n\321HL\223P$\317\217\302\245\247`\206"
+	.ascii	"\343\220)\351F\035S$q\tMAX\224\n\205\031\236\206'\260@\225\212"
+	.ascii	"&\214)\220Cb\023\211\244\343Q\211\241\020A4\035\246@tbHD\020"
+	.ascii	"\251BJB\tM\223\320\024%\342 \210*\031O(\022\215\2066\b\"\241"
+	.ascii	"\214\304\025\350\361I\303\021mj2\036\323\fNh\212\214B!d<F-]\236"
+	.ascii	"\022\306cT\t\032\320t\230\302\0201\t-\221T\001R\005'b\n\241\025"
+	.ascii	"E\023D)L\bE"
+	.string	"\245\304$c\023j\001\026C'\037\026\303&\364\350\2434\201&N\240\237&\320\031\200\232\232\240\212A$\2640\274\200\323\021M\237\214R\244\360HT\241A\tmj\"\252\360\361a\201*\025\211\246\023\024\212\245\"q\205\321\t\250\001E\022\215E\264\204\022\332\304\302\260\b\001#!\023G&\204%L\234@\022Y\f\201\306cT\tG\343\361\b\001%\342\323\221\022\361\304P\212\024E\241D|**\022\207%\370\024\211\303\022\200g\n&\tQ'bZ\204:\202HB.\r\233H@\225\214'\004-\021W\f\213\026\2408Q\002P\211\370\204\217\3064iH\202\006$\212\036\227\320\022#\024\025\215\303\343\020\252d<\001\002i\0231\205\021fJ\227\212\35015!\002IM\303$$\244\260HB\212\"\321\024\226\236\214xR\3410mBK\240N\304\324'M\217\351\211\"\tQMOO$\204R!\362\2106AA"
+	.string	"U\202J\211i:4J\205H\025P'b\212\225\206P  \262\240\201\204\2404\205R#\205>h:L\221\346\007\352\b)\364\0172%\026M(\021\237\200:\b\2660\274"
+	.string	"\t!\322'\240\364LA\020E\243\223\2231\t"
+	.ascii	"\"\242\032)\034B\205\350ST\nti\230\242"
+	.string	"0B\237\242\322\273\001\013\035\202\205\026\301B\207\030\266\210a\207`\321\"Xt\210\2506\221\302\017\024\207\017hB\213\305!S\322OZ\2042\216\200.\rSd\217\206'\235\bz\022\361\210\026\321%\374\016<@\200\007 \260\3409\b\n\330@\001\033\234\007A\001!B(\300\203\020\370\036\204\260#\202\037| D\323a\323\223\023\232\nS\024\211\036\205E\250\020M\207)\nb\023\221\205a\212B\211\370\264!\035\032\233T\230H\341\022QE\3218\202\022\361\311\307\311XD\225\204H$\232d<>\t\225\210OCg\n\032\217QK\023 \205\306c\324\322\231\nEp\360d4\232\220\242K\307a\n\244b\204\022$\214\307\250%\334d4>@h\246*P%a\272\341L\301\242\2218\004\201<\032\221E\024\211\001\022J\210t\"\036S0%\245\304\023JE\022MM\306#Q\212\246\300\204\034\036GP\">i"
+	.ascii	"B\n\321&\242\n\343\361\204\022\361\351'=SP\211\370T\242\"\205"
+	.ascii	" (\021\237\316\023\325DU\">Y\364)*\025\036\321\264\211\250b\350"
+	.ascii	"\307\005&\241\212\247&a\013\303\250\036\027\230\200T\2500\246"
+	.ascii	"PIB\246\244\324X\024jH\213h\322\021=\221\026\211\306\023OPJE"
+	.ascii	"\342\n\033|Z\030^\300\t\n\205\022\361\t(-B\031\223\204\350\322"
+	.ascii	"\360\210\256\030\n\213Fb:D\026\321''\343\bJ\304\023\351\220\205"
+	.ascii	"\025DE\342\t)\t%\342\223\020\332\264T$\021\024\225\022W\020S"
+	.ascii	"\"\262\210\242hBW\240MBi\022\252B\005\021\252dt\022\246G\364"
+	.ascii	"\211\005*L\233\210\251\260ht\201x42!\245@\233\322\324xdJqT$\016"
+	.ascii	"K8\032\323\341\021u:\242)\261\310HL\207)\260\0306\241) 5\244"
+	.ascii	"LKDt\205\264H4>\245(\n\247#\232*\021\245\320\3020j(%:\021MhB"
+	.ascii	"\223\222H\240\351\360\b\244\244\324ddB\242G\246tI\b\n\243N\304"
+	.ascii	"\264\007mZ*\016\213R!\bi\221\b\305\203\246\303\2430\352\210\256"
+	.ascii	"0&\241G!\023rxL\"jax\264g\nB9\021\221n|B\217 R\243\361\b\302"
+	.ascii	"\247\251\311x\274LI)\361\311L\205\036\204H\213D\236s\020\242"
+	.ascii	"\203\004p\260\001\013\033\004\203\236\200\004\214\320A\005\024"
+	.ascii	"J\300IA%\342\023\210\224i\211\330\244\002D\2218t\002\221tD\202"
+	.ascii	"\bnha\030e\221(T\323p\305\371\237\007\306I\0064s\005\206U\027"
+	.ascii	"\0371i~^^X?;]]\231\307E\362'\017\317\215\f\236\026\247\025\273"
+	.ascii	"\267&\216\035O\225Usc\274\255\321\341\241:\261\234\255i\211\351"
+	.ascii	"\213\301\333\035\236\251\363\016\217\024P\nhM\\\0231\236|\036"
+	.ascii	");6/\310\205\351{\376\331.\326\314\035%t&\3108i\226s\022\350"
+	.ascii	"\204\222\344\305\026?<K\245N\226*v\352\335\271\243\205\235\266"
+	.ascii	"\263\316\025C\305EF\337\034\004\324w\246\006\235\276\030\310"
+	.ascii	"9\343\234|qN:\025\013+w\020G\005\326\203/k\341\360\360\2370\374"
+	.ascii	"\244\203\241T\311\333\322\367\234\3637\264\"[\314\364=\345\374"
+	.ascii	"-\310\r\r\357+\f\376\317=\353\345\003\237\22148&\237^\020&h\372"
+	.ascii	"\236z\347\233\237\313\237\313>\227\366\357\357\234\202Fy\346"
+	.ascii	"\235b\247\221'cpn\316\202\310\351\343k\023F\205\265)^\330\230"
+	.ascii	"i0\032`s\326X;\2514j_}O5\035\350\273cV\243/\216\273\227&\344"
+	.ascii	"G\2323\337\264\275\262\271;\233\245\255\304\274\300@s\325\202"
+	.ascii	"\262\f\251qw\236\261s~uh6\314\3000\2033E\256\314\035K\272\301"
+	.ascii	"sa\227\303\313\225\\\347C\007Z\0162'\021 1{Wcc\316#`zl\250\304"
+	.ascii	"\234KF\274i\343\203\356Fic\244J\254\3579WK\360\367\367\367\347"
+	.ascii	"\227\363\3249w\226\340\312\262R\333\312y\352\fs\202\3719\367"
+	.ascii	"\240K\246\345\311\330\371\245\321\260\351\331\3118\345~z\t\332"
+	.ascii	"\3231\304G\3373\356\354\022%\f\313\232\347\3519q\303\345\254"
+	.ascii	"\357\271\345\344\342\025\306\026\3677_b\005\361\211\361\261\201"
+	.ascii	"\223\303CC\212\035#o\246\032\346\021&\367\202[\013\262\274\272"
+	.ascii	"\267S\213\0253\267\025\346\354\314b\306\321\301\270K\366E\032"
+	.ascii	"\303"
+	.ascii	"\306vbA\332\262w{}s"
+	.string	"c`\350Z\2649\261\274i}a\365=\207$Fj;\225\247\322\2529c\344\007\037\230\234\2607}\317\001\f#\205\245\245\235Vx\360\304\271\340\001D\355\247\225\f^dxk\372\236UN,\253g\205\016\317\r3\361\002\003J\337s\020\202\221\260\246L9\223(\320\276\312\002p\244\316\013\225\237\311\036\257#_\310\372\236g\347\013&pVl\034\254\360\206\276S\312)%\255o\256g+\303e\361\341\ruP\240\234dH8O\351\252[\002\361d\244a2\366\223\254\347\256\337\230\037a\372\236Q\312`\2445aa\247XM\3135\032P\305\310\2171*3\271\312\351\344\247\230\027:s\224\364\375\234\263I\23448\2144a\262\201\275\037Qv\230eh\240\300\350{$2<\301\337\371u~\235K\220p\2055\250c\341sJL2\312a\034M\"\246\214B44\224\026\016c\025@ hH\032\222\310\250\243{\023"
+	.string	"\204M\354\204\201\236u\f\252\031\222\024$)T\366\343(\n\325\227\333\201\013#:\262\234\242\361\215\231\265\205\220\307\277\006aT\017\276\2572*\224b\233\247\370p\303\036\260\211\240\247\232\203\262&\031\362\301tG\251\2253\230\265\304 Jt\237\225\026\307\343{\340`\324\224\227o\265\224I\301};\212khL\360!\271\224Xr\366\274\366\036\354]\224\265\232\325\321\205F\242\364\301\r\301\2534F\027L\356\374\337\304QG\n\320\322zEU\204\346A\024\212K(i\017\241#\236\033e\357\343\253\343M\272(\322\326\346|0\242\035\230\375\371\240\006\036\362\217wc\334@\321u\177L\322.\023]\374C_\367k\337\033y"
+	.string	"\327\260y_\316\026"
+	.string	"I\203\352\320h#\007\246\2638\222c'\350Jf\244\202\265\317\210\307\313E\347\340\317x\036\205\020\007\252\337\270\322\324M\023,\0055D\343\372\215\n\323!@\023\t\362\354\\\26117\037\271s\357uq\355\275\225;GY\3049\0235\026f\006F\362k"
+	.string	"\276\215\372\200g\207f\323gqN\255X\207W\353D^\2104\216in\331\312]\321\007\242\216"
+	.string	"3P\276\205\370Q\"\277d\003HB\016\330Uq\366\036\317\245`\375\2408\202\177\244\024\007\035-\306\356\35096\230\212\302K"
+	.string	"&v\271G.\321\007G\2668\226=\315"
+	.ascii	"\355\244v\247\034~Q~P\352A8\273\037\265\033 \231\006\304\211"
+	.ascii	"\211\\Q\272\210\245\255 \360\347\302\360\2475\n\330_W\205\021"
+	.ascii	"\224\356\377i\367\307\226\321\203\nAO\377e\007glc\r\024Xy\b\004"
+	.ascii	"\t^0\241\002\267\256\203\035\211\020Mx\223,\3351B*$\017\332\252"
+	.ascii	"h\333\374H\255f9J~\207\t\007\002F\275%t\317J\277\005\t\301\225"
+	.ascii	"\005\337\367x$\364\247\241EM\253\213H\205\375\\\352\350Dp\331"
+	.ascii	"\354\226\311N\200X\307@\202\273\262B\330\201\217\315\265\367"
+	.ascii	"\016%\027\224\233\037\b\342\340'\016\325\236Q\r-\013\212\016"
+	.ascii	"\254\033^\006\220\330I3\235$\242\264u\376\320\332q\323\037u\253"
+	.ascii	"\220\3147\217\020\272ylk\036i\254\205\356\352\276\223\253\273"
+	.ascii	"?e\250\023\241\233\037\230\340W\226\302v\020|\200\330\013\326"
+	.ascii	"\305e\342\346\234*\203\"\303\207\347T\304\360"
+	.string	"\262N\034RF\305A\244\235\260d\237/awV\017\212^\211:\226\2157\262\204\235\245\253\035\274\341\300\325\250\263\177o\030@\302\034\246\030\377\344\020\321?n\253?\364\277\006>\334~\303\357\017o\231\334_\213\306\027\366+\363\007\3475du\342\271\323P\271'E\030.\220\373\322\006\253\034\004}\344\0262)\257\006\006[\025\345\212\306\037\236C\211\215\271I\037\271\207*\331\201\223\\\351\341\2465\306\274\261\210\363\034\373\371a\256\027D:\306e\306WW(^\201 \337\271mp\342\363i2MH\234\202\b\350\262\302f\f \013\313E\272\234\267\001(\326G\236\3721\020\033\026$\"\033I\206\231\360\351<OFh\212\2109N\324\245\332\020\225\022\310B\210\301\253n\0363\252\345\252($9\351,\302H\241\357\tt\306\377\377\222\027\022\237\004\351\303\2710q\251\203\202\303\234\261\236\234\326g\304\026\224\226o\261\254\247"
+	.string	"f\321\276\030M\210\005\236\020\215T\026;\342\205>\005\245O\377\001\201=\325\027\364\204F\2057\265\0045\361\035M\267\016\024\233B'\030\335u\221_\333[\032-\211\033 \302\321\3428\362\255ej\256\230\250\260\216\n\215\n"
+	.string	"\034X{\265%[\335\255`\256\364\312\342\026\373A\0033\nIP\304\023p19{\007iI5q\267\004\237\364\332\025l|\364'\245l\375\272\016\320#\3449\032'\360\301\310\200~;\373\320\2733Z\201\341~I\244'\030\311%Y*X\305\346%\306\311j\033,\237\324`@R\334\211\025\007\336\302\237\177!\320\217\021\031(6\363c\210\241\003\204\2533\270g\033c(\214\371\331^1\350\236hK\236\030j76\374\340[y\322N&\220O\273S\321\273{\004\032P}\033\210/\236Q\n\302\250\001\317\270\371\201\335\333\ffM}\326\251\201|~s/+\326\243E\002u\217Q\307\263\203\326\242Jq\340b\3543w\024\233L\0267\324\251\370F\377\206,\232Y)H\216"
+	.ascii	"*\360\331\311\013\260\2340\201x\371\321\013 \360b]"
+	.string	"\204M\003>\353b\221\0173(Va\355F\340\202\031\275\001\265\344\226\005\350\373\f\373\241\373DQ\203\232\200\bwL\002^\005f\024\224z(S\367/qi\310<@\220e\r^D\\\315\254\bu\256\363VN\004L\200\242M\031\342\367\t\025d\364CZ\213Z\316\342\267\213\\l\314\027~\233kz!D\336qt\"\272\353\325\372\373\226\r\270\025\236\313\304\307\213\344\223\220\325R\224\317\303$\205S\004\213O\353\"\261\2306\352\321=\361,z\345 \232\256S\214\222\374\222\005$\313?K]#\333\350\211V'.n\260F\361\215\246\007\214\244I\357[\374K'\354\306\211H\216\035W\305\242\2431:\324\201\321\333\210:\272\030\302\347\216)\017&\0368uVl\234\213\211o&\274I\362\b\204\262\037r\334\301\234<rCgv\272'\256Wv\322\343@\261\240J\020\274\r\036Z3\304\304\007\317#\235?\n\307\217"
+	.string	"\225\340\307q\005\030"
+	.string	" x\217\003z\373\364\2400m]\354\324\274\254\366\201\2313t\027t\307\230k(\034{]\0258\256\234\222\004C\341\353\344\001\372S\223:\210\235\310\341\361\027\251\031\204-\265\300\004Qx\311\315\233\202\351\007\206v4>S.\250lL\nh6x\304\346\"\306Q\200\b\\R\312\357\324\3329M\276e\224\354\227\210US\270\f\257q\246=\034r\257\326\313p8\326\334iI\244\034i\3230e9B\215A\342\234\005V\326\330\2252\366\217S\303v\354\311\235\"\007:\2159\313"
+	.string	"\030t\247u\212N4\324\331\247\306X1\360-b\224\213\013\b9B+Wn\237a\004\342\225\235l2QV>}\334S\367&\367\326\344\340\305\222\235\005\0232SV@\317'\245"
+	.string	"\346B=\025\266rL:\325D\340i\213\243$\335i\253\374\254\351\002\037\230\007\004\206\f"
+	.ascii	"L\374]T\276\315'\2509\225J\363M\020\307U\360$\202?}8)az1\245"
+	.ascii	"<\267*\262k\307\244\200\307\331b\333\300\365\250\236\030\224"
+	.ascii	"\363\260~\"\217\265I\252\355\344\267i\316\302\2776"
+	.string	"\276\211\331U\303\214\261\310\346\235\301\375\217\007\031n\314\222\004I\260z\351w\017\262G\354\353\002p\324p\311\032\365\373\n\020\031\253\374Dd\274pK\200\"\362P\235\332\025\232U\211\375\326P\327\220\r\345\217\017\261\231u\320\301\373\1778\034\216\363\374\262\b\013Da^y\240G\311\377\034FS\305\324\225\305\024\230\240\352ma\231\3532\200\fD\266\260\335\256\311\021\323\3228\227\203z)\340\241f]\321\203\001\037\3253a\021\205I\245\361\265n \261w1?\2512\214"
+	.string	"\351\246#\251\320\003\366\223m\257\325\334\223\361@w\326\230\275\325A\312\026\032\246\326\366\207\235\265\274\314\326\271\035\203D\335!\231\354&\243\271\352\267N\322\255^\354\200\367\324\215\332O\315v\256\240r\217!\316\222\242\351\214\267"
+	.ascii	"kH\362\317Pm$\247\252UL?\326D\205\025.\334:\213:\243\263\352"
+	.ascii	"\322\027\312\217\243\243UaS\t"
+	.string	"\203a\325TGk\316\227>O9\260R\003\241&\254\220\022\271\016\t\371\3440<\032O\020\2365\207\036\340\337u\226\253!\200\004N\022\006\n\352\001\306\275\017\322\316c\231:\276\264\366a/\243\267\352q3\001\315\204{\217\n@y\300\300\341-n\260\253\237\354`\257\017\020u\026\202@-\203\007\233m\017Z\306\037\002\2739\363\272\246Z;\031\013\263\222>\242`\270\215\310\335\344,m\006\262TQT\255\bw\266\265\232\275A\332\310\270\025PV\030\241g\227\262$\311uE\301S\037\001V\210\027Y:\301\226Wo\017\353@\213\346\241g\352\2158C\224\342\344+\270Lz \353T\367\206\322\\\372\206\020\"\267\350\325\353\321\257\f\031\210\001n.\321\035\250xHT\022e\214\261\264)Zn\253A\363\325\302\302\205\n`\002\330x\234\277l\230\315eM_\030H\036\034\016\254\256w\206\202\272\025\372\007\330\373^\262\026"
+	.ascii	"\202-D\2071\304\362\333\311\340G\314\374\336\005\317HuI\215\f"
+	.ascii	"\031h\322\273\273)\332O7\037\276(E\305\275\343\331\340\013\234"
+	.ascii	"\030!&\270`\351\264B\341\0248_\024)\267\344\333A\270\353\211"
+	.ascii	"\f\354\362\233\220\034a$\247\262g\266\200\212\305\253\261\324"
+	.ascii	"\236\326\001E)0\3624]\033+1K\373\223S\364\325\263cbb\217\263"
+	.ascii	"+\034y\273\216\367\376\371\266\372{\311\277\030\236\257sS\210"
+	.ascii	"\370\310\201C\024n\t?\207{\236\365\376][t{\037\036\375\364$\347"
+	.ascii	"e\377w\006\177\217\307\234RC\205O\302\321vv\257\377Z\367$\333"
+	.ascii	"\214\364\355\360\016\375\375\024\211z\241\232\367\016\035\304"
+	.ascii	"\377h7\352"
+	.string	"\316\362\313\350k/\345\254[n\277\354l\374]\350\026lm\254\365M\225\273i\2361\260\227\362\027\277\271\354\331a\007\276\207\360I\307=\205\366\303\376q\265{\216\373\341\353\324\207\217\313>\374\315\006Y\013\376O\373 ~\310\275y\033\007\350\231\263\032\360\217\270\375x\356\032\376j\217\363\317\310{\354\360;m\336!\001[\214\306\3453Q\354y\177?\025.\301\3521\363\253\300y\322\330\333\221\013.\317\025\330s\371~\310\371V\336\203\\o\253\361)\\\237\356\271\332\317\235z\2058\235\020\344~\225\311\320\217\315\027C\177\330\364\267=\024\316h\337\304\347\035\033O\371\300\2443\263\355\245\347+\017\031\211\3117\2669\210\375\304\316\0379\177\277\030,\270A\220c\357\001\202;\351^]2\325\213\266\307\276\336s\024\206\216\232]\304<\351\206+\021/\n\374\310\317\272}\206\352\n\345\023zi\366\270!\347\013\223<`mj\355"
+	.ascii	"o\314\237y\310g\354\327\367\016r\356\352\227\\\324+\201|\361"
+	.ascii	"\237r\324\353}\332\351+\016$FGg\216\271\212\223L\247+"
+	.text
+	.section	.gnu.lto_.symtab.f1dd4492f1f168cf,"e",@progbits
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"pidSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"pidResetErrorGyroState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"filterBankAddBiquadLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"filterBankAddPt1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"filterBankAddBiquad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"filterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"pidInitMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"filterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f1dd4492f1f168cf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18447 @@
+	.file	"servos.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/common/filter.h"
+	.file 7 "./src/main/config/parameter_group.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/timer.h"
+	.file 10 "./src/main/drivers/pwm_output.h"
+	.file 11 "./src/main/drivers/resource.h"
+	.file 12 "./src/main/fc/config.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.file 14 "./src/main/fc/rc_modes.h"
+	.file 15 "./src/main/fc/runtime_config.h"
+	.file 16 "./src/main/common/axis.h"
+	.file 17 "./src/main/flight/imu.h"
+	.file 18 "./src/main/flight/mixer.h"
+	.file 19 "./src/main/flight/pid.h"
+	.file 20 "./src/main/flight/servos.h"
+	.file 21 "./src/main/io/gimbal.h"
+	.file 22 "./src/main/rx/rx.h"
+	.file 23 "./src/main/flight/servos.c"
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 25 "./src/main/common/maths.h"
+	.file 26 "/usr/include/string.h"
+	.file 27 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	servos.c.24213067
+	.weak	servos.c.24213067
+servos.c.24213067:
+	.long	0x16bc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x29
+	.long	.LASF2521
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2083
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2084
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2085
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2086
+	.uleb128 0x3
+	.long	.LASF2088
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2087
+	.uleb128 0x3
+	.long	.LASF2089
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2090
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2091
+	.uleb128 0x3
+	.long	.LASF2092
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2093
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2094
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2095
+	.uleb128 0x2b
+	.byte	0x8
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2096
+	.uleb128 0x3
+	.long	.LASF2097
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF2098
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF2099
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF2100
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x8
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2101
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2102
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x3
+	.long	.LASF2103
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2104
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2105
+	.uleb128 0x1c
+	.long	.LASF2351
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0xec
+	.uleb128 0x22
+	.byte	0x8
+	.byte	0x5
+	.byte	0xbe
+	.byte	0x9
+	.long	0x135
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0x5
+	.byte	0xc0
+	.byte	0xb
+	.long	0xa2
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2106
+	.byte	0x5
+	.byte	0xc1
+	.byte	0x3
+	.long	0x11e
+	.uleb128 0x7
+	.long	0x104
+	.long	0x151
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2115
+	.byte	0x2c
+	.byte	0x6
+	.byte	0x22
+	.long	0x1e2
+	.uleb128 0x6
+	.string	"b0"
+	.byte	0x6
+	.byte	0x23
+	.byte	0xb
+	.long	0x104
+	.byte	0
+	.uleb128 0x6
+	.string	"b1"
+	.byte	0x6
+	.byte	0x23
+	.byte	0xf
+	.long	0x104
+	.byte	0x4
+	.uleb128 0x6
+	.string	"b2"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x13
+	.long	0x104
+	.byte	0x8
+	.uleb128 0x6
+	.string	"a1"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x17
+	.long	0x104
+	.byte	0xc
+	.uleb128 0x6
+	.string	"a2"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x1b
+	.long	0x104
+	.byte	0x10
+	.uleb128 0x6
+	.string	"x1"
+	.byte	0x6
+	.byte	0x24
+	.byte	0xb
+	.long	0x104
+	.byte	0x14
+	.uleb128 0x6
+	.string	"x2"
+	.byte	0x6
+	.byte	0x24
+	.byte	0xf
+	.long	0x104
+	.byte	0x18
+	.uleb128 0x6
+	.string	"y1"
+	.byte	0x6
+	.byte	0x24
+	.byte	0x13
+	.long	0x104
+	.byte	0x1c
+	.uleb128 0x6
+	.string	"y2"
+	.byte	0x6
+	.byte	0x24
+	.byte	0x17
+	.long	0x104
+	.byte	0x20
+	.uleb128 0x6
+	.string	"d1"
+	.byte	0x6
+	.byte	0x25
+	.byte	0xb
+	.long	0x104
+	.byte	0x24
+	.uleb128 0x6
+	.string	"d2"
+	.byte	0x6
+	.byte	0x25
+	.byte	0xf
+	.long	0x104
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2108
+	.byte	0x6
+	.byte	0x26
+	.byte	0x3
+	.long	0x151
+	.uleb128 0x7
+	.long	0x104
+	.long	0x1fe
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2109
+	.byte	0x7
+	.byte	0x19
+	.byte	0x12
+	.long	0xe0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x7
+	.byte	0x21
+	.byte	0xe
+	.long	0x232
+	.uleb128 0xe
+	.long	.LASF2110
+	.value	0xfff
+	.uleb128 0xe
+	.long	.LASF2111
+	.value	0xf000
+	.uleb128 0xe
+	.long	.LASF2112
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2114
+	.byte	0x7
+	.byte	0x29
+	.byte	0xf
+	.long	0x23e
+	.uleb128 0x2c
+	.long	0x24e
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x23
+	.byte	0x8
+	.byte	0x7
+	.byte	0x31
+	.byte	0x5
+	.long	0x26f
+	.uleb128 0x1d
+	.string	"ptr"
+	.byte	0x7
+	.byte	0x32
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x7
+	.byte	0x33
+	.byte	0x16
+	.long	0x26f
+	.byte	0
+	.uleb128 0xa
+	.long	0x232
+	.uleb128 0xc
+	.long	.LASF2116
+	.byte	0x28
+	.byte	0x7
+	.byte	0x2b
+	.long	0x2cf
+	.uleb128 0x6
+	.string	"pgn"
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1fe
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xe
+	.long	0x2cf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xe
+	.long	0x2cf
+	.byte	0x10
+	.uleb128 0x6
+	.string	"ptr"
+	.byte	0x7
+	.byte	0x30
+	.byte	0xf
+	.long	0x2d4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x7
+	.byte	0x34
+	.byte	0x7
+	.long	0x24e
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0xcf
+	.uleb128 0xa
+	.long	0x2cf
+	.uleb128 0x3
+	.long	.LASF2121
+	.byte	0x7
+	.byte	0x35
+	.byte	0x3
+	.long	0x274
+	.uleb128 0x8
+	.long	0x2d9
+	.uleb128 0x3
+	.long	.LASF2122
+	.byte	0x8
+	.byte	0x18
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x9
+	.byte	0x39
+	.byte	0xe
+	.long	0x339
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2132
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x2f6
+	.uleb128 0xa
+	.long	0x135
+	.uleb128 0xc
+	.long	.LASF2133
+	.byte	0x18
+	.byte	0x9
+	.byte	0x5a
+	.long	0x398
+	.uleb128 0x6
+	.string	"tim"
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x12
+	.long	0x345
+	.byte	0
+	.uleb128 0x6
+	.string	"tag"
+	.byte	0x9
+	.byte	0x5c
+	.byte	0xd
+	.long	0x2ea
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2134
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xd
+	.long	0xcf
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x16
+	.long	0x339
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2137
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x3
+	.long	0x34a
+	.uleb128 0x8
+	.long	0x398
+	.uleb128 0x7
+	.long	0x3a4
+	.long	0x3b4
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x8
+	.long	0x3a9
+	.uleb128 0x4
+	.long	.LASF2229
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x1e
+	.long	0x3b4
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2138
+	.uleb128 0xc
+	.long	.LASF2139
+	.byte	0xc
+	.byte	0xa
+	.byte	0x98
+	.long	0x400
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0xa
+	.byte	0x9a
+	.byte	0xe
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2141
+	.byte	0xa
+	.byte	0x9b
+	.byte	0xe
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2142
+	.byte	0xa
+	.byte	0x9c
+	.byte	0xd
+	.long	0x400
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ea
+	.long	0x410
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2143
+	.byte	0xa
+	.byte	0x9d
+	.byte	0x3
+	.long	0x3cc
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.byte	0xe
+	.long	0x543
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2159
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	0x548
+	.uleb128 0x2d
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xc
+	.byte	0x22
+	.byte	0xe
+	.long	0x626
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x80
+	.uleb128 0xe
+	.long	.LASF2198
+	.value	0x100
+	.uleb128 0xe
+	.long	.LASF2199
+	.value	0x200
+	.uleb128 0xe
+	.long	.LASF2200
+	.value	0x400
+	.uleb128 0xe
+	.long	.LASF2201
+	.value	0x1000
+	.uleb128 0xe
+	.long	.LASF2202
+	.value	0x2000
+	.uleb128 0xe
+	.long	.LASF2203
+	.value	0x4000
+	.uleb128 0xe
+	.long	.LASF2204
+	.value	0x8000
+	.uleb128 0xf
+	.long	.LASF2205
+	.long	0x10000
+	.uleb128 0xf
+	.long	.LASF2206
+	.long	0x20000
+	.uleb128 0xf
+	.long	.LASF2207
+	.long	0x40000
+	.uleb128 0xf
+	.long	.LASF2208
+	.long	0x80000
+	.uleb128 0xf
+	.long	.LASF2209
+	.long	0x100000
+	.uleb128 0xf
+	.long	.LASF2210
+	.long	0x200000
+	.uleb128 0xf
+	.long	.LASF2211
+	.long	0x400000
+	.uleb128 0xf
+	.long	.LASF2212
+	.long	0x800000
+	.uleb128 0xf
+	.long	.LASF2213
+	.long	0x2000000
+	.uleb128 0xf
+	.long	.LASF2214
+	.long	0x4000000
+	.uleb128 0xf
+	.long	.LASF2215
+	.long	0x8000000
+	.uleb128 0xf
+	.long	.LASF2216
+	.long	0x10000000
+	.uleb128 0xf
+	.long	.LASF2217
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2299
+	.long	0x30
+	.byte	0xd
+	.byte	0x18
+	.long	0x67e
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x1
+	.uleb128 0x2e
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2230
+	.byte	0xd
+	.byte	0x4f
+	.byte	0xe
+	.long	0x141
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xe
+	.byte	0x18
+	.byte	0xe
+	.long	0x77b
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2269
+	.byte	0xe
+	.byte	0x3f
+	.byte	0x3
+	.long	0x68a
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x15
+	.byte	0xe
+	.long	0x7a0
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2272
+	.byte	0xf
+	.byte	0x1a
+	.byte	0x10
+	.long	0xcf
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xe
+	.long	0x7fe
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x80
+	.uleb128 0xe
+	.long	.LASF2281
+	.value	0x100
+	.uleb128 0xe
+	.long	.LASF2282
+	.value	0x200
+	.uleb128 0xe
+	.long	.LASF2283
+	.value	0x400
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2284
+	.byte	0xf
+	.byte	0x4a
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x58
+	.byte	0xe
+	.long	0x835
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2290
+	.byte	0xf
+	.byte	0x64
+	.byte	0x10
+	.long	0xcf
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x10
+	.byte	0x1d
+	.byte	0xe
+	.long	0x860
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x2
+	.byte	0
+	.uleb128 0x22
+	.byte	0x6
+	.byte	0x11
+	.byte	0x22
+	.byte	0x5
+	.long	0x891
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x11
+	.byte	0x24
+	.byte	0x11
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0x11
+	.byte	0x25
+	.byte	0x11
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x11
+	.byte	0x26
+	.byte	0x11
+	.long	0xb7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x23
+	.byte	0x6
+	.byte	0x11
+	.byte	0x20
+	.byte	0x9
+	.long	0x8b3
+	.uleb128 0x1d
+	.string	"raw"
+	.byte	0x11
+	.byte	0x21
+	.byte	0xd
+	.long	0x8b3
+	.uleb128 0x2f
+	.long	.LASF2296
+	.byte	0x11
+	.byte	0x27
+	.byte	0x7
+	.long	0x860
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.long	0x8c3
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2297
+	.byte	0x11
+	.byte	0x28
+	.byte	0x3
+	.long	0x891
+	.uleb128 0x4
+	.long	.LASF2298
+	.byte	0x11
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x8c3
+	.uleb128 0x24
+	.long	.LASF2300
+	.long	0x30
+	.byte	0x12
+	.byte	0x24
+	.long	0x987
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2327
+	.byte	0x12
+	.byte	0x40
+	.byte	0x3
+	.long	0x8db
+	.uleb128 0xc
+	.long	.LASF2328
+	.byte	0x10
+	.byte	0x12
+	.byte	0x43
+	.long	0x9d4
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x12
+	.byte	0x44
+	.byte	0xb
+	.long	0x104
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x12
+	.byte	0x45
+	.byte	0xb
+	.long	0x104
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0x12
+	.byte	0x46
+	.byte	0xb
+	.long	0x104
+	.byte	0x8
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x12
+	.byte	0x47
+	.byte	0xb
+	.long	0x104
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2330
+	.byte	0x12
+	.byte	0x48
+	.byte	0x3
+	.long	0x993
+	.uleb128 0x8
+	.long	0x9d4
+	.uleb128 0xc
+	.long	.LASF2331
+	.byte	0x10
+	.byte	0x12
+	.byte	0x4d
+	.long	0xa19
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x12
+	.byte	0x4f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x12
+	.byte	0x50
+	.byte	0x19
+	.long	0xa19
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x9e0
+	.uleb128 0x3
+	.long	.LASF2335
+	.byte	0x12
+	.byte	0x51
+	.byte	0x3
+	.long	0x9e5
+	.uleb128 0x8
+	.long	0xa1e
+	.uleb128 0x7
+	.long	0xa2a
+	.long	0xa3a
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x8
+	.long	0xa2f
+	.uleb128 0x4
+	.long	.LASF2336
+	.byte	0x12
+	.byte	0x68
+	.byte	0x16
+	.long	0xa3a
+	.uleb128 0x7
+	.long	0x104
+	.long	0xa5b
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2334
+	.byte	0x12
+	.byte	0x69
+	.byte	0xe
+	.long	0xa4b
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x13
+	.byte	0x25
+	.byte	0xe
+	.long	0xab6
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2348
+	.byte	0x13
+	.byte	0x78
+	.byte	0xe
+	.long	0x1ee
+	.uleb128 0x4
+	.long	.LASF2349
+	.byte	0x13
+	.byte	0x78
+	.byte	0x1c
+	.long	0x1ee
+	.uleb128 0x4
+	.long	.LASF2350
+	.byte	0x13
+	.byte	0x78
+	.byte	0x2a
+	.long	0x1ee
+	.uleb128 0x1c
+	.long	.LASF2352
+	.byte	0x13
+	.byte	0x79
+	.byte	0x5
+	.long	0x3c5
+	.uleb128 0x4
+	.long	.LASF2353
+	.byte	0x13
+	.byte	0x7a
+	.byte	0x11
+	.long	0xec
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x14
+	.byte	0x19
+	.byte	0x6
+	.long	0xb59
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0xe
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2369
+	.byte	0x14
+	.byte	0x29
+	.byte	0x3
+	.long	0xaf2
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x14
+	.byte	0x2c
+	.byte	0xe
+	.long	0xbd2
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2386
+	.byte	0x14
+	.byte	0x40
+	.byte	0x3
+	.long	0xb65
+	.uleb128 0xc
+	.long	.LASF2387
+	.byte	0x7
+	.byte	0x14
+	.byte	0x4e
+	.long	0xc46
+	.uleb128 0x2
+	.long	.LASF2388
+	.byte	0x14
+	.byte	0x4f
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2389
+	.byte	0x14
+	.byte	0x50
+	.byte	0xd
+	.long	0xcf
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2390
+	.byte	0x14
+	.byte	0x51
+	.byte	0xc
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2391
+	.byte	0x14
+	.byte	0x52
+	.byte	0xd
+	.long	0xcf
+	.byte	0x3
+	.uleb128 0x6
+	.string	"min"
+	.byte	0x14
+	.byte	0x53
+	.byte	0xc
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x6
+	.string	"max"
+	.byte	0x14
+	.byte	0x54
+	.byte	0xc
+	.long	0xab
+	.byte	0x5
+	.uleb128 0x6
+	.string	"box"
+	.byte	0x14
+	.byte	0x55
+	.byte	0xd
+	.long	0xcf
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2392
+	.byte	0x14
+	.byte	0x56
+	.byte	0x3
+	.long	0xbde
+	.uleb128 0x8
+	.long	0xc46
+	.uleb128 0x7
+	.long	0xc46
+	.long	0xc67
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2393
+	.byte	0x14
+	.byte	0x5c
+	.byte	0x15
+	.long	0xc57
+	.uleb128 0x4
+	.long	.LASF2394
+	.byte	0x14
+	.byte	0x5c
+	.byte	0x51
+	.long	0xc57
+	.uleb128 0xc
+	.long	.LASF2395
+	.byte	0x10
+	.byte	0x14
+	.byte	0x5f
+	.long	0xca6
+	.uleb128 0x2
+	.long	.LASF2396
+	.byte	0x14
+	.byte	0x60
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0x14
+	.byte	0x61
+	.byte	0x19
+	.long	0xca6
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0xc52
+	.uleb128 0x3
+	.long	.LASF2398
+	.byte	0x14
+	.byte	0x62
+	.byte	0x3
+	.long	0xc7f
+	.uleb128 0x8
+	.long	0xcab
+	.uleb128 0x7
+	.long	0xcb7
+	.long	0xcc7
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x8
+	.long	0xcbc
+	.uleb128 0x4
+	.long	.LASF2399
+	.byte	0x14
+	.byte	0x64
+	.byte	0x1b
+	.long	0xcc7
+	.uleb128 0xc
+	.long	.LASF2400
+	.byte	0xc
+	.byte	0x14
+	.byte	0x66
+	.long	0xd33
+	.uleb128 0x2
+	.long	.LASF2401
+	.byte	0x14
+	.byte	0x67
+	.byte	0xe
+	.long	0xec
+	.byte	0
+	.uleb128 0x6
+	.string	"min"
+	.byte	0x14
+	.byte	0x68
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x6
+	.string	"max"
+	.byte	0x14
+	.byte	0x69
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0x14
+	.byte	0x6a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2390
+	.byte	0x14
+	.byte	0x6b
+	.byte	0xc
+	.long	0xab
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2403
+	.byte	0x14
+	.byte	0x6c
+	.byte	0xc
+	.long	0xab
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2404
+	.byte	0x14
+	.byte	0x6d
+	.byte	0x3
+	.long	0xcd8
+	.uleb128 0x8
+	.long	0xd33
+	.uleb128 0x7
+	.long	0xd33
+	.long	0xd54
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2405
+	.byte	0x14
+	.byte	0x6f
+	.byte	0x15
+	.long	0xd44
+	.uleb128 0x4
+	.long	.LASF2406
+	.byte	0x14
+	.byte	0x6f
+	.byte	0x45
+	.long	0xd44
+	.uleb128 0xc
+	.long	.LASF2407
+	.byte	0x10
+	.byte	0x14
+	.byte	0x71
+	.long	0xdad
+	.uleb128 0x6
+	.string	"dev"
+	.byte	0x14
+	.byte	0x72
+	.byte	0x16
+	.long	0x410
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0x14
+	.byte	0x73
+	.byte	0xe
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0x14
+	.byte	0x74
+	.byte	0xd
+	.long	0xcf
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0x14
+	.byte	0x75
+	.byte	0xd
+	.long	0xcf
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2411
+	.byte	0x14
+	.byte	0x76
+	.byte	0x3
+	.long	0xd6c
+	.uleb128 0x8
+	.long	0xdad
+	.uleb128 0x4
+	.long	.LASF2412
+	.byte	0x14
+	.byte	0x78
+	.byte	0x16
+	.long	0xdad
+	.uleb128 0x4
+	.long	.LASF2413
+	.byte	0x14
+	.byte	0x78
+	.byte	0x3f
+	.long	0xdad
+	.uleb128 0x7
+	.long	0xb7
+	.long	0xde6
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2414
+	.byte	0x14
+	.byte	0x7e
+	.byte	0x10
+	.long	0xdd6
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x15
+	.byte	0x16
+	.byte	0xe
+	.long	0xe0b
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2417
+	.byte	0x1
+	.byte	0x15
+	.byte	0x1d
+	.long	0xe25
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0x15
+	.byte	0x1e
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2419
+	.byte	0x15
+	.byte	0x1f
+	.byte	0x3
+	.long	0xe0b
+	.uleb128 0x8
+	.long	0xe25
+	.uleb128 0x4
+	.long	.LASF2420
+	.byte	0x15
+	.byte	0x21
+	.byte	0x17
+	.long	0xe25
+	.uleb128 0x4
+	.long	.LASF2421
+	.byte	0x15
+	.byte	0x21
+	.byte	0x42
+	.long	0xe25
+	.uleb128 0x7
+	.long	0xb7
+	.long	0xe5e
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2422
+	.byte	0x16
+	.byte	0x4f
+	.byte	0x10
+	.long	0xe4e
+	.uleb128 0xc
+	.long	.LASF2423
+	.byte	0x2c
+	.byte	0x16
+	.byte	0x75
+	.long	0xfbc
+	.uleb128 0x2
+	.long	.LASF2424
+	.byte	0x16
+	.byte	0x76
+	.byte	0xd
+	.long	0xfbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2425
+	.byte	0x16
+	.byte	0x77
+	.byte	0xd
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2426
+	.byte	0x16
+	.byte	0x78
+	.byte	0xd
+	.long	0xcf
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0x16
+	.byte	0x79
+	.byte	0xd
+	.long	0xcf
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0x16
+	.byte	0x7a
+	.byte	0xd
+	.long	0xcf
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0x16
+	.byte	0x7b
+	.byte	0xe
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0x16
+	.byte	0x7c
+	.byte	0xd
+	.long	0xcf
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0x16
+	.byte	0x7d
+	.byte	0xd
+	.long	0x2ea
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2432
+	.byte	0x16
+	.byte	0x7e
+	.byte	0xd
+	.long	0x2ea
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2433
+	.byte	0x16
+	.byte	0x7f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2434
+	.byte	0x16
+	.byte	0x80
+	.byte	0xd
+	.long	0xcf
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2435
+	.byte	0x16
+	.byte	0x81
+	.byte	0xd
+	.long	0xcf
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2436
+	.byte	0x16
+	.byte	0x82
+	.byte	0xd
+	.long	0xcf
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0x16
+	.byte	0x83
+	.byte	0xd
+	.long	0xcf
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0x16
+	.byte	0x84
+	.byte	0xe
+	.long	0xe0
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0x16
+	.byte	0x85
+	.byte	0xe
+	.long	0xe0
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x16
+	.byte	0x86
+	.byte	0xe
+	.long	0xe0
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0x16
+	.byte	0x87
+	.byte	0xd
+	.long	0xcf
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2442
+	.byte	0x16
+	.byte	0x88
+	.byte	0xd
+	.long	0xcf
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0x16
+	.byte	0x89
+	.byte	0xd
+	.long	0xcf
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2444
+	.byte	0x16
+	.byte	0x8a
+	.byte	0xd
+	.long	0xcf
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0x16
+	.byte	0x8b
+	.byte	0xd
+	.long	0xcf
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2446
+	.byte	0x16
+	.byte	0x8c
+	.byte	0xe
+	.long	0xe0
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2447
+	.byte	0x16
+	.byte	0x8e
+	.byte	0xe
+	.long	0xe0
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2448
+	.byte	0x16
+	.byte	0x8f
+	.byte	0xe
+	.long	0xe0
+	.byte	0x28
+	.byte	0
+	.uleb128 0x7
+	.long	0xcf
+	.long	0xfcc
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2449
+	.byte	0x16
+	.byte	0x90
+	.byte	0x3
+	.long	0xe6a
+	.uleb128 0x8
+	.long	0xfcc
+	.uleb128 0x4
+	.long	.LASF2450
+	.byte	0x16
+	.byte	0x92
+	.byte	0x13
+	.long	0xfcc
+	.uleb128 0x3
+	.long	.LASF2451
+	.byte	0x16
+	.byte	0x95
+	.byte	0x14
+	.long	0xff5
+	.uleb128 0xa
+	.long	0xffa
+	.uleb128 0x30
+	.long	0xe0
+	.long	0x100e
+	.uleb128 0x5
+	.long	0x100e
+	.uleb128 0x5
+	.long	0xcf
+	.byte	0
+	.uleb128 0xa
+	.long	0x1054
+	.uleb128 0xc
+	.long	.LASF2452
+	.byte	0x18
+	.byte	0x16
+	.byte	0x98
+	.long	0x1054
+	.uleb128 0x2
+	.long	.LASF2453
+	.byte	0x16
+	.byte	0x99
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2454
+	.byte	0x16
+	.byte	0x9a
+	.byte	0xe
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2455
+	.byte	0x16
+	.byte	0x9b
+	.byte	0x18
+	.long	0xfe9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2456
+	.byte	0x16
+	.byte	0x9c
+	.byte	0x18
+	.long	0x1059
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0x1013
+	.uleb128 0x3
+	.long	.LASF2457
+	.byte	0x16
+	.byte	0x96
+	.byte	0x13
+	.long	0x1065
+	.uleb128 0xa
+	.long	0x106a
+	.uleb128 0x31
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2458
+	.byte	0x16
+	.byte	0x9d
+	.byte	0x3
+	.long	0x1013
+	.uleb128 0x4
+	.long	.LASF2459
+	.byte	0x16
+	.byte	0x9f
+	.byte	0x1a
+	.long	0x106f
+	.uleb128 0x4
+	.long	.LASF2460
+	.byte	0x17
+	.byte	0x36
+	.byte	0x14
+	.long	0x987
+	.uleb128 0x14
+	.long	0xdbe
+	.byte	0x38
+	.byte	0x43
+	.uleb128 0x14
+	.long	0xdca
+	.byte	0x38
+	.byte	0x65
+	.uleb128 0x4
+	.long	.LASF2461
+	.byte	0x17
+	.byte	0x38
+	.byte	0x91
+	.long	0x2e5
+	.uleb128 0x1b
+	.long	0x10a1
+	.byte	0xba
+	.uleb128 0x14
+	.long	0xc67
+	.byte	0x4b
+	.byte	0xe
+	.uleb128 0x14
+	.long	0xc73
+	.byte	0x4b
+	.byte	0x43
+	.uleb128 0x4
+	.long	.LASF2462
+	.byte	0x17
+	.byte	0x4b
+	.byte	0x83
+	.long	0x2e5
+	.uleb128 0x1b
+	.long	0x10c1
+	.byte	0xb2
+	.uleb128 0x14
+	.long	0xd54
+	.byte	0x4d
+	.byte	0x41
+	.uleb128 0x14
+	.long	0xd60
+	.byte	0x4d
+	.byte	0x6a
+	.uleb128 0x4
+	.long	.LASF2463
+	.byte	0x17
+	.byte	0x4d
+	.byte	0x9e
+	.long	0x2e5
+	.uleb128 0x1b
+	.long	0x10e1
+	.byte	0xc7
+	.uleb128 0x14
+	.long	0xe36
+	.byte	0x5d
+	.byte	0x10
+	.uleb128 0x14
+	.long	0xe42
+	.byte	0x5d
+	.byte	0x34
+	.uleb128 0x4
+	.long	.LASF2464
+	.byte	0x17
+	.byte	0x5d
+	.byte	0x61
+	.long	0x2e5
+	.uleb128 0x1b
+	.long	0x1101
+	.byte	0x8b
+	.uleb128 0x14
+	.long	0xde6
+	.byte	0x5f
+	.byte	0x9
+	.uleb128 0x10
+	.long	.LASF2396
+	.byte	0x61
+	.byte	0x10
+	.long	0xcf
+	.uleb128 0x10
+	.long	.LASF2465
+	.byte	0x62
+	.byte	0x15
+	.long	0xc57
+	.uleb128 0x10
+	.long	.LASF2333
+	.byte	0x63
+	.byte	0xc
+	.long	0x88
+	.uleb128 0x7
+	.long	0xc52
+	.long	0x114b
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	0x113b
+	.uleb128 0x10
+	.long	.LASF2466
+	.byte	0x68
+	.byte	0x1b
+	.long	0x114b
+	.uleb128 0x10
+	.long	.LASF2467
+	.byte	0x70
+	.byte	0x1b
+	.long	0x114b
+	.uleb128 0x7
+	.long	0xc52
+	.long	0x1176
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	0x1166
+	.uleb128 0x10
+	.long	.LASF2468
+	.byte	0x79
+	.byte	0x1b
+	.long	0x1176
+	.uleb128 0x7
+	.long	0xc52
+	.long	0x1196
+	.uleb128 0x9
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x1186
+	.uleb128 0x10
+	.long	.LASF2469
+	.byte	0x83
+	.byte	0x1b
+	.long	0x1196
+	.uleb128 0x7
+	.long	0xc52
+	.long	0x11b6
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0x11a6
+	.uleb128 0x10
+	.long	.LASF2470
+	.byte	0x88
+	.byte	0x1b
+	.long	0x11b6
+	.uleb128 0x7
+	.long	0xc52
+	.long	0x11d6
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x11c6
+	.uleb128 0x10
+	.long	.LASF2471
+	.byte	0x90
+	.byte	0x1b
+	.long	0x11d6
+	.uleb128 0x10
+	.long	.LASF2472
+	.byte	0x9b
+	.byte	0x1b
+	.long	0x11b6
+	.uleb128 0x7
+	.long	0xcb7
+	.long	0x1201
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x8
+	.long	0x11f1
+	.uleb128 0x32
+	.long	0xccc
+	.byte	0x17
+	.byte	0xa0
+	.byte	0x14
+	.long	0x1201
+	.uleb128 0x7
+	.long	0x1e2
+	.long	0x1222
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2473
+	.value	0x202
+	.byte	0x17
+	.long	0x1212
+	.uleb128 0x25
+	.long	.LASF2478
+	.byte	0x6
+	.byte	0x6a
+	.long	0x1249
+	.uleb128 0x5
+	.long	0x1249
+	.uleb128 0x5
+	.long	0x104
+	.uleb128 0x5
+	.long	0xec
+	.byte	0
+	.uleb128 0xa
+	.long	0x1e2
+	.uleb128 0x33
+	.long	.LASF2474
+	.byte	0x18
+	.value	0x13d
+	.byte	0x11
+	.long	0x9b
+	.long	0x1265
+	.uleb128 0x5
+	.long	0x104
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2475
+	.byte	0x6
+	.byte	0x6e
+	.byte	0x7
+	.long	0x104
+	.long	0x1280
+	.uleb128 0x5
+	.long	0x1249
+	.uleb128 0x5
+	.long	0x104
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2476
+	.byte	0x19
+	.byte	0x59
+	.byte	0x5
+	.long	0x88
+	.long	0x12aa
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2477
+	.byte	0xe
+	.byte	0x66
+	.byte	0x5
+	.long	0x3c5
+	.long	0x12c0
+	.uleb128 0x5
+	.long	0x77b
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2479
+	.byte	0xa
+	.byte	0xbd
+	.long	0x12d6
+	.uleb128 0x5
+	.long	0xcf
+	.uleb128 0x5
+	.long	0x104
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2480
+	.byte	0x1a
+	.byte	0x3d
+	.byte	0xe
+	.long	0xa2
+	.long	0x12f6
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0xf8
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2481
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x5
+	.long	0x3c5
+	.long	0x130c
+	.uleb128 0x5
+	.long	0xec
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2482
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0xe
+	.long	0xa2
+	.long	0x132c
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x5
+	.long	0x543
+	.uleb128 0x5
+	.long	0xf8
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2484
+	.value	0x20d
+	.long	0x1346
+	.uleb128 0xb
+	.uleb128 0x13
+	.long	.LASF2483
+	.value	0x214
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2492
+	.value	0x204
+	.long	0x1360
+	.uleb128 0xb
+	.uleb128 0x13
+	.long	.LASF2483
+	.value	0x207
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2522
+	.byte	0x17
+	.value	0x1fd
+	.byte	0x5
+	.long	0x3c5
+	.uleb128 0x18
+	.long	.LASF2485
+	.value	0x1c5
+	.long	0x1395
+	.uleb128 0x17
+	.long	0x1388
+	.uleb128 0x11
+	.string	"i"
+	.value	0x1d6
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.string	"i"
+	.value	0x1f8
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2486
+	.value	0x177
+	.long	0x1423
+	.uleb128 0x13
+	.long	.LASF2487
+	.value	0x179
+	.byte	0xd
+	.long	0x1423
+	.uleb128 0x13
+	.long	.LASF2488
+	.value	0x17a
+	.byte	0x14
+	.long	0x1433
+	.uleb128 0x17
+	.long	0x13c8
+	.uleb128 0x11
+	.string	"i"
+	.value	0x1a1
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	0x1416
+	.uleb128 0x11
+	.string	"i"
+	.value	0x1a6
+	.byte	0xe
+	.long	0x88
+	.uleb128 0xb
+	.uleb128 0x13
+	.long	.LASF2489
+	.value	0x1a9
+	.byte	0x15
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF2490
+	.value	0x1aa
+	.byte	0x15
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF2491
+	.value	0x1ab
+	.byte	0x16
+	.long	0xe0
+	.uleb128 0x11
+	.string	"min"
+	.value	0x1ac
+	.byte	0x15
+	.long	0xb7
+	.uleb128 0x11
+	.string	"max"
+	.value	0x1ad
+	.byte	0x15
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.string	"i"
+	.value	0x1be
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.long	0x1433
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xd
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.long	0x1443
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2493
+	.value	0x12f
+	.long	0x1487
+	.uleb128 0x13
+	.long	.LASF2494
+	.value	0x134
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x17
+	.long	0x146a
+	.uleb128 0x11
+	.string	"i"
+	.value	0x155
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	0x147a
+	.uleb128 0x11
+	.string	"i"
+	.value	0x15b
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.string	"i"
+	.value	0x161
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2495
+	.value	0x126
+	.long	0x149f
+	.uleb128 0x20
+	.long	.LASF2497
+	.value	0x126
+	.byte	0x28
+	.long	0xcf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2496
+	.value	0x11d
+	.long	0x14d1
+	.uleb128 0x20
+	.long	.LASF2497
+	.value	0x11d
+	.byte	0x30
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF2498
+	.value	0x120
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0xb
+	.uleb128 0x13
+	.long	.LASF2499
+	.value	0x121
+	.byte	0x12
+	.long	0xcf
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2500
+	.value	0x10f
+	.long	0x1505
+	.uleb128 0x20
+	.long	.LASF2501
+	.value	0x10f
+	.byte	0x1c
+	.long	0x88
+	.uleb128 0x17
+	.long	0x14f8
+	.uleb128 0x11
+	.string	"i"
+	.value	0x114
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.string	"i"
+	.value	0x118
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2502
+	.byte	0xf1
+	.long	0x151b
+	.uleb128 0xb
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0xf6
+	.byte	0x16
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2503
+	.byte	0xe0
+	.long	0x1531
+	.uleb128 0xb
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0xe7
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2504
+	.byte	0xd2
+	.long	0x1547
+	.uleb128 0xb
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0xdb
+	.byte	0x12
+	.long	0xcf
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2505
+	.byte	0xc9
+	.byte	0x5
+	.long	0x88
+	.long	0x156f
+	.uleb128 0x15
+	.long	.LASF2494
+	.byte	0x17
+	.byte	0xc9
+	.byte	0x18
+	.long	0x88
+	.uleb128 0x15
+	.long	.LASF2389
+	.byte	0x17
+	.byte	0xc9
+	.byte	0x28
+	.long	0x88
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2506
+	.byte	0xbe
+	.byte	0x9
+	.long	0xb7
+	.long	0x1596
+	.uleb128 0x15
+	.long	.LASF2494
+	.byte	0x17
+	.byte	0xbe
+	.byte	0x3f
+	.long	0xbd2
+	.uleb128 0x10
+	.long	.LASF2507
+	.byte	0xc0
+	.byte	0x13
+	.long	0xdb
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2508
+	.byte	0x4f
+	.long	0x15c5
+	.uleb128 0x15
+	.long	.LASF2509
+	.byte	0x17
+	.byte	0x4f
+	.byte	0x2a
+	.long	0x15c5
+	.uleb128 0xb
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x51
+	.byte	0xe
+	.long	0x88
+	.uleb128 0xb
+	.uleb128 0x10
+	.long	.LASF2510
+	.byte	0x52
+	.byte	0x29
+	.long	0xd3f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xd33
+	.uleb128 0x19
+	.long	.LASF2511
+	.byte	0x3a
+	.long	0x15f7
+	.uleb128 0x15
+	.long	.LASF2512
+	.byte	0x17
+	.byte	0x3a
+	.byte	0x2b
+	.long	0x15f7
+	.uleb128 0x10
+	.long	.LASF2494
+	.byte	0x42
+	.byte	0x9
+	.long	0x88
+	.uleb128 0xb
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x43
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xdad
+	.uleb128 0x21
+	.long	.LASF2513
+	.byte	0x16
+	.byte	0x92
+	.byte	0x65
+	.long	0x1608
+	.uleb128 0xa
+	.long	0xfd8
+	.uleb128 0x21
+	.long	.LASF2514
+	.byte	0x15
+	.byte	0x21
+	.byte	0x79
+	.long	0x1619
+	.uleb128 0xa
+	.long	0xe31
+	.uleb128 0x21
+	.long	.LASF2512
+	.byte	0x14
+	.byte	0x78
+	.byte	0x74
+	.long	0x162a
+	.uleb128 0xa
+	.long	0xdb9
+	.uleb128 0x27
+	.long	.LASF2516
+	.byte	0x6f
+	.byte	0x81
+	.long	0x164b
+	.long	0x164b
+	.uleb128 0x15
+	.long	.LASF2515
+	.byte	0x14
+	.byte	0x6f
+	.byte	0x91
+	.long	0x88
+	.byte	0
+	.uleb128 0xa
+	.long	0xd3f
+	.uleb128 0x35
+	.long	.LASF2517
+	.byte	0x14
+	.byte	0x5c
+	.value	0x106
+	.long	0x166f
+	.long	0x166f
+	.uleb128 0x36
+	.long	.LASF2515
+	.byte	0x14
+	.byte	0x5c
+	.value	0x123
+	.long	0x88
+	.byte	0
+	.uleb128 0xa
+	.long	0xc46
+	.uleb128 0x27
+	.long	.LASF2518
+	.byte	0x5c
+	.byte	0x99
+	.long	0xca6
+	.long	0x1690
+	.uleb128 0x15
+	.long	.LASF2515
+	.byte	0x14
+	.byte	0x5c
+	.byte	0xaf
+	.long	0x88
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF2519
+	.byte	0x19
+	.byte	0x7e
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x28
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x88
+	.uleb128 0x28
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x88
+	.uleb128 0x15
+	.long	.LASF2520
+	.byte	0x19
+	.byte	0x7e
+	.byte	0x33
+	.long	0x88
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 28 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.file 31 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x20
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 33 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 34 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 39 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x27
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x30
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 56 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x38
+	.file 57 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 58 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 59 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 60 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9
+	.file 62 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1550
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xc
+	.file 63 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 66 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x42
+	.byte	0x4
+	.file 67 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x43
+	.file 68 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 69 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x45
+	.file 70 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x46
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 71 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1975
+	.byte	0x4
+	.file 72 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 73 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 74 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1985
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 75 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2025
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2056
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2082
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1417
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1437
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1549
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1556
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1560
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1974
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1981
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2081
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2523
+	.long	.LASF2524
+	.long	.LASF2525
+	.long	.LASF2526
+	.long	.LASF2527
+	.long	.LASF2528
+	.long	.LASF2529
+	.long	.LASF2530
+	.long	.LASF2531
+	.long	.LASF2532
+	.long	.LASF2533
+	.long	.LASF2534
+	.long	.LASF2535
+	.long	.LASF2536
+	.long	.LASF2537
+	.long	.LASF2538
+	.long	.LASF2539
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2540
+	.byte	0xd
+	.long	.LASF2541
+	.byte	0xd
+	.long	.LASF2542
+	.byte	0xd
+	.long	.LASF2543
+	.byte	0x11
+	.long	.LASF2544
+	.byte	0x9
+	.long	.LASF2545
+	.byte	0x2
+	.long	.LASF2546
+	.byte	0x3
+	.long	.LASF2547
+	.byte	0x4
+	.long	.LASF2548
+	.byte	0x4
+	.long	.LASF2549
+	.byte	0x4
+	.long	.LASF2550
+	.byte	0x4
+	.long	.LASF2551
+	.byte	0x5
+	.long	.LASF2552
+	.byte	0x5
+	.long	.LASF2553
+	.byte	0x5
+	.long	.LASF2554
+	.byte	0x5
+	.long	.LASF2555
+	.byte	0x2
+	.long	.LASF2556
+	.byte	0x6
+	.long	.LASF2557
+	.byte	0x6
+	.long	.LASF2558
+	.byte	0x6
+	.long	.LASF2559
+	.byte	0x6
+	.long	.LASF2560
+	.byte	0x7
+	.long	.LASF2561
+	.byte	0x8
+	.long	.LASF2562
+	.byte	0x6
+	.long	.LASF2563
+	.byte	0xd
+	.long	.LASF2564
+	.byte	0x2
+	.long	.LASF2565
+	.byte	0x10
+	.long	.LASF2566
+	.byte	0x3
+	.long	.LASF2567
+	.byte	0x10
+	.long	.LASF2568
+	.byte	0x11
+	.long	.LASF2569
+	.byte	0x11
+	.long	.LASF2569
+	.byte	0x10
+	.long	.LASF2570
+	.byte	0xd
+	.long	.LASF2571
+	.byte	0x10
+	.long	.LASF2572
+	.byte	0x10
+	.long	.LASF2573
+	.byte	0xd
+	.long	.LASF2574
+	.byte	0xd
+	.long	.LASF2575
+	.byte	0xf
+	.long	.LASF2576
+	.byte	0xd
+	.long	.LASF2577
+	.byte	0xe
+	.long	.LASF2578
+	.byte	0xe
+	.long	.LASF2579
+	.byte	0xd
+	.long	.LASF2580
+	.byte	0xd
+	.long	.LASF2581
+	.byte	0xd
+	.long	.LASF2582
+	.byte	0xc
+	.long	.LASF2583
+	.byte	0xc
+	.long	.LASF2584
+	.byte	0x10
+	.long	.LASF2585
+	.byte	0x10
+	.long	.LASF2586
+	.byte	0xd
+	.long	.LASF2587
+	.byte	0xd
+	.long	.LASF2588
+	.byte	0xd
+	.long	.LASF2589
+	.byte	0xd
+	.long	.LASF2590
+	.byte	0xd
+	.long	.LASF2591
+	.byte	0xd
+	.long	.LASF2592
+	.byte	0xd
+	.long	.LASF2593
+	.byte	0xd
+	.long	.LASF2594
+	.byte	0xb
+	.long	.LASF2595
+	.byte	0xa
+	.long	.LASF2596
+	.byte	0xa
+	.long	.LASF2597
+	.byte	0x1
+	.long	.LASF2598
+	.byte	0x3
+	.long	.LASF2599
+	.byte	0x3
+	.long	.LASF2600
+	.byte	0x4
+	.long	.LASF2601
+	.byte	0x4
+	.long	.LASF2602
+	.byte	0x4
+	.long	.LASF2603
+	.byte	0x4
+	.long	.LASF2604
+	.byte	0x4
+	.long	.LASF2605
+	.byte	0x4
+	.long	.LASF2606
+	.byte	0x4
+	.long	.LASF2607
+	.byte	0x4
+	.long	.LASF2608
+	.byte	0x2
+	.long	.LASF2609
+	.byte	0x4
+	.long	.LASF2610
+	.byte	0x4
+	.long	.LASF2611
+	.byte	0x4
+	.long	.LASF2612
+	.byte	0x4
+	.long	.LASF2613
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1966:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1990:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1722:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1420:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1602:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1796:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1742:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2125:
+	.string	"TIM_USE_PPM"
+.LASF2389:
+	.string	"inputSource"
+.LASF1596:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2472:
+	.string	"servoMixerGimbal"
+.LASF1613:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2359:
+	.string	"INPUT_RC_PITCH"
+.LASF2056:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF2267:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2210:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1426:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1697:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1763:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF2032:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2352:
+	.string	"airmodeWasActivated"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1816:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1611:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1869:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF2005:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF2025:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1443:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1950:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2263:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2089:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2138:
+	.string	"_Bool"
+.LASF2433:
+	.string	"spektrum_sat_bind"
+.LASF1668:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2026:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1815:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2355:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2152:
+	.string	"OWNER_ADC_CURR"
+.LASF2393:
+	.string	"customServoMixers_SystemArray"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1620:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2008:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1775:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1565:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2328:
+	.string	"motorMixer_s"
+.LASF2330:
+	.string	"motorMixer_t"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2305:
+	.string	"MIXER_GIMBAL"
+.LASF2080:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1893:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2507:
+	.string	"channelToForwardFrom"
+.LASF2416:
+	.string	"GIMBAL_MODE_MIXTILT"
+.LASF1793:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF2450:
+	.string	"rxConfig_System"
+.LASF2034:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF2014:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF1441:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF2437:
+	.string	"rssi_invert"
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1962:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1506:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1498:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1801:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1785:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1934:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1909:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1462:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2149:
+	.string	"OWNER_LED"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1633:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1938:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1650:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2200:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2371:
+	.string	"SERVO_GIMBAL_ROLL"
+.LASF2101:
+	.string	"uint16_t"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF2084:
+	.string	"short unsigned int"
+.LASF2402:
+	.string	"middle"
+.LASF2422:
+	.string	"rcData"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1901:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1671:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1745:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1880:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1984:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1453:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF1833:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1854:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1595:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF2066:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1844:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1466:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1713:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1754:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2357:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1702:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1479:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2204:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2518:
+	.string	"customServoMixers"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF2366:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF2287:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2463:
+	.string	"servoParams_Registry"
+.LASF2060:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1621:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1486:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF1986:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1925:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2077:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2253:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2350:
+	.string	"axisPID_D"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1502:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2348:
+	.string	"axisPID_P"
+.LASF1835:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1933:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2339:
+	.string	"PID_YAW"
+.LASF1826:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1889:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF1961:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2156:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2175:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2063:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1460:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF2394:
+	.string	"customServoMixers_CopyArray"
+.LASF1568:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1587:
+	.string	"BIT(x) (1 << (x))"
+.LASF2180:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1557:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF1556:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF2099:
+	.string	"int32_t"
+.LASF1623:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2508:
+	.string	"pgResetFn_servoParams"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1424:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1576:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1744:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1721:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2188:
+	.string	"OWNER_SPI_PREINIT"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF1883:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2036:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF2126:
+	.string	"TIM_USE_PWM"
+.LASF2512:
+	.string	"servoConfig"
+.LASF2454:
+	.string	"rxRefreshRate"
+.LASF1653:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2012:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF2349:
+	.string	"axisPID_I"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2177:
+	.string	"OWNER_BARO_EXTI"
+.LASF2482:
+	.string	"memcpy"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2476:
+	.string	"scaleRange"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1748:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1609:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1965:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2296:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2155:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2236:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1499:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2353:
+	.string	"targetPidLooptime"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1662:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2112:
+	.string	"PGR_SIZE_MASK"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1683:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2198:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1676:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1920:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF2129:
+	.string	"TIM_USE_LED"
+.LASF2380:
+	.string	"SERVO_DUALCOPTER_LEFT"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2333:
+	.string	"useServo"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1982:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2061:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1863:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1910:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1717:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1928:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2246:
+	.string	"BOXLEDLOW"
+.LASF2423:
+	.string	"rxConfig_s"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2178:
+	.string	"OWNER_USB"
+.LASF2501:
+	.string	"index"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF2331:
+	.string	"mixer_s"
+.LASF2335:
+	.string	"mixer_t"
+.LASF398:
+	.string	"false 0"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1455:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1926:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF1610:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2233:
+	.string	"BOXHORIZON"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF555:
+	.string	"__stub_stty "
+.LASF1579:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2050:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2432:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF1911:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2011:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2435:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2046:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF1670:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2179:
+	.string	"OWNER_USB_DETECT"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1807:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF2455:
+	.string	"rcReadRawFn"
+.LASF1845:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1454:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2215:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1474:
+	.string	"PG_PID_PROFILE 14"
+.LASF1791:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1769:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2202:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1846:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2247:
+	.string	"BOXLLIGHTS"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2160:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2040:
+	.string	"PIDSUM_LIMIT 500"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1886:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2199:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2071:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2445:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1491:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2234:
+	.string	"BOXBARO"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1976:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1577:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2148:
+	.string	"OWNER_SERVO"
+.LASF1589:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1302:
+	.string	"ACC "
+.LASF2395:
+	.string	"mixerRules_s"
+.LASF2398:
+	.string	"mixerRules_t"
+.LASF1473:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF2468:
+	.string	"servoMixerBI"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF1584:
+	.string	"PP_IIF_0(t,f) f"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1643:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1627:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1731:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2426:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1954:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2086:
+	.string	"long unsigned int"
+.LASF2322:
+	.string	"MIXER_ATAIL4"
+.LASF2314:
+	.string	"MIXER_AIRPLANE"
+.LASF1929:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"roll"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2438:
+	.string	"midrc"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2057:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2090:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2133:
+	.string	"timerHardware_s"
+.LASF2092:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1998:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2147:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1973:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1781:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1433:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF2499:
+	.string	"servoOffset"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2372:
+	.string	"SERVO_FLAPS"
+.LASF2174:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2378:
+	.string	"SERVO_BICOPTER_LEFT"
+.LASF2006:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF2375:
+	.string	"SERVO_RUDDER"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1582:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1983:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF2054:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1450:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2211:
+	.string	"FEATURE_AIRMODE"
+.LASF2428:
+	.string	"rx_spi_protocol"
+.LASF2464:
+	.string	"gimbalConfig_Registry"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2017:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1689:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1423:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1728:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1551:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2072:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1794:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF2029:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1539:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1574:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1536:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF2274:
+	.string	"HORIZON_MODE"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2083:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1628:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1757:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2427:
+	.string	"halfDuplex"
+.LASF1546:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1549:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1818:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF2193:
+	.string	"FEATURE_RX_SERIAL"
+.LASF2115:
+	.string	"biquadFilter_s"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2429:
+	.string	"rx_spi_id"
+.LASF1647:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2094:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF1993:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2104:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1470:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2130:
+	.string	"TIM_USE_TRANSPONDER"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF2231:
+	.string	"BOXARM"
+.LASF1782:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2444:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF1724:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2283:
+	.string	"FAILSAFE_MODE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF2439:
+	.string	"mincheck"
+.LASF1526:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1575:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1700:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2136:
+	.string	"output"
+.LASF1563:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1646:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF2466:
+	.string	"servoMixerAirplane"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2248:
+	.string	"BOXCALIB"
+.LASF2116:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2489:
+	.string	"target"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2196:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1412:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1435:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2400:
+	.string	"servoParam_s"
+.LASF2404:
+	.string	"servoParam_t"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2475:
+	.string	"biquadFilterApply"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF2022:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2244:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1688:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF1849:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2186:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2221:
+	.string	"AUX1"
+.LASF2222:
+	.string	"AUX2"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2224:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2226:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2228:
+	.string	"AUX8"
+.LASF1629:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1477:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2217:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2520:
+	.string	"high"
+.LASF2377:
+	.string	"SERVO_THROTTLE"
+.LASF2440:
+	.string	"maxcheck"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF1715:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2218:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2399:
+	.string	"servoMixers"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1836:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2070:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2323:
+	.string	"MIXER_CUSTOM"
+.LASF2169:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1922:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1626:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1583:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2488:
+	.string	"currentOutput"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF2069:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1817:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1631:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1720:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1737:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF2324:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1743:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2110:
+	.string	"PGR_PGN_MASK"
+.LASF2254:
+	.string	"BOXSERVO1"
+.LASF2255:
+	.string	"BOXSERVO2"
+.LASF2256:
+	.string	"BOXSERVO3"
+.LASF2194:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2213:
+	.string	"FEATURE_RX_SPI"
+.LASF1666:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1952:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1881:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF1554:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF1979:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1964:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1892:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1614:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1533:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2107:
+	.string	"test"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1988:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF2490:
+	.string	"from"
+.LASF1932:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1923:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF1649:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2140:
+	.string	"servoCenterPulse"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1644:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2075:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF2405:
+	.string	"servoParams_SystemArray"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1913:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2117:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1943:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1654:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1661:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2434:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1517:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF2276:
+	.string	"BARO_MODE"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2448:
+	.string	"rx_max_usec"
+.LASF1417:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1958:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1550:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF2410:
+	.string	"channelForwardingStartChannel"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF2207:
+	.string	"FEATURE_OSD"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2321:
+	.string	"MIXER_SINGLECOPTER"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2282:
+	.string	"SONAR_MODE"
+.LASF2462:
+	.string	"customServoMixers_Registry"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2206:
+	.string	"FEATURE_DASHBOARD"
+.LASF2497:
+	.string	"firstServoIndex"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1445:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2183:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2103:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2067:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2051:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2033:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2164:
+	.string	"OWNER_SPI_MOSI"
+.LASF1935:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2275:
+	.string	"MAG_MODE"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2100:
+	.string	"uint8_t"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2037:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2163:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1723:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1440:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF1764:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF1771:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF2270:
+	.string	"ARMED"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1636:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF2219:
+	.string	"PITCH"
+.LASF1806:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"VERY_FAST_MATH "
+.LASF2311:
+	.string	"MIXER_OCTOX8"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2137:
+	.string	"timerHardware_t"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2338:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2251:
+	.string	"BOXTELEMETRY"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2373:
+	.string	"SERVO_FLAPPERON_1"
+.LASF1544:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2269:
+	.string	"boxId_e"
+.LASF1787:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF1740:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF2515:
+	.string	"_index"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1995:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1762:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2418:
+	.string	"mode"
+.LASF1601:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF2461:
+	.string	"servoConfig_Registry"
+.LASF2146:
+	.string	"OWNER_PPMINPUT"
+.LASF2122:
+	.string	"ioTag_t"
+.LASF2141:
+	.string	"servoPwmRate"
+.LASF1566:
+	.string	"IOCFG_IPD 0"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2292:
+	.string	"FD_PITCH"
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1552:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1411:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1495:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF1891:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2361:
+	.string	"INPUT_RC_THROTTLE"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1898:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1632:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1980:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2302:
+	.string	"MIXER_QUADP"
+.LASF1523:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1718:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF2303:
+	.string	"MIXER_QUADX"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1755:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF2058:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1658:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2436:
+	.string	"rssi_scale"
+.LASF1608:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1485:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1719:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1531:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1452:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1490:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2403:
+	.string	"forwardFromChannel"
+.LASF2474:
+	.string	"lrintf"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2121:
+	.string	"pgRegistry_t"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2459:
+	.string	"rxRuntimeConfig"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2509:
+	.string	"instance"
+.LASF2262:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1616:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1803:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2414:
+	.string	"servo"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1439:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF2479:
+	.string	"pwmWriteServo"
+.LASF1726:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1970:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2301:
+	.string	"MIXER_TRI"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF1865:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1562:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1639:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2511:
+	.string	"pgResetFn_servoConfig"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2441:
+	.string	"rcInterpolation"
+.LASF1569:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1635:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2260:
+	.string	"BOX3DDISABLE"
+.LASF1548:
+	.string	"IO_TAG_NONE 0"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1446:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2209:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2374:
+	.string	"SERVO_FLAPPERON_2"
+.LASF2031:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1605:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF1852:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2229:
+	.string	"timerHardware"
+.LASF1532:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF2409:
+	.string	"tri_unarmed_servo"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2159:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2131:
+	.string	"TIM_USE_BEEPER"
+.LASF2118:
+	.string	"address"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1437:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1790:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1850:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1560:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1567:
+	.string	"IOCFG_IPU 0"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF721:
+	.string	"NULL"
+.LASF2285:
+	.string	"GPS_FIX_HOME"
+.LASF1729:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF2295:
+	.string	"pitch"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF2161:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2134:
+	.string	"channel"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1508:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1691:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2465:
+	.string	"currentServoMixer"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF468:
+	.string	"__PMT"
+.LASF1615:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2442:
+	.string	"rcInterpolationChannels"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1570:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1509:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1949:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2272:
+	.string	"armingFlags"
+.LASF1902:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2020:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1779:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2406:
+	.string	"servoParams_CopyArray"
+.LASF2113:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1467:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1944:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2151:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1908:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF2028:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2106:
+	.string	"TIM_TypeDef"
+.LASF1415:
+	.string	"UNIT_TESTED "
+.LASF2481:
+	.string	"feature"
+.LASF2142:
+	.string	"ioTags"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1475:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2214:
+	.string	"FEATURE_SOFTSPI"
+.LASF1874:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1458:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2521:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF2003:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1461:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1776:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF2379:
+	.string	"SERVO_BICOPTER_RIGHT"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2480:
+	.string	"memset"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1542:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2514:
+	.string	"gimbalConfig"
+.LASF2304:
+	.string	"MIXER_BICOPTER"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1746:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1916:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1730:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2013:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF2124:
+	.string	"TIM_USE_NONE"
+.LASF2097:
+	.string	"int8_t"
+.LASF1612:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1853:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2318:
+	.string	"MIXER_HEX6H"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1739:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2376:
+	.string	"SERVO_ELEVATOR"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF2286:
+	.string	"GPS_FIX"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2230:
+	.string	"rcCommand"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF2021:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2401:
+	.string	"reversedSources"
+.LASF2315:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1664:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1624:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2278:
+	.string	"GPS_HOLD_MODE"
+.LASF1999:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2449:
+	.string	"rxConfig_t"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2271:
+	.string	"WAS_EVER_ARMED"
+.LASF1265:
+	.string	"CMS "
+.LASF2120:
+	.string	"reset"
+.LASF2317:
+	.string	"MIXER_VTAIL4"
+.LASF1578:
+	.string	"STR_HELPER(x) #x"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1468:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2123:
+	.string	"TIM_USE_ANY"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1571:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2279:
+	.string	"HEADFREE_MODE"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2167:
+	.string	"OWNER_SDCARD"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF2356:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF2381:
+	.string	"SERVO_DUALCOPTER_RIGHT"
+.LASF2362:
+	.string	"INPUT_RC_AUX1"
+.LASF2363:
+	.string	"INPUT_RC_AUX2"
+.LASF2364:
+	.string	"INPUT_RC_AUX3"
+.LASF2365:
+	.string	"INPUT_RC_AUX4"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2098:
+	.string	"int16_t"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1953:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2319:
+	.string	"MIXER_RX_TO_SERVO"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2087:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1444:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1645:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1968:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF1896:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1476:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2001:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF2139:
+	.string	"servoDevConfig_s"
+.LASF2143:
+	.string	"servoDevConfig_t"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1422:
+	.string	"sq(x) ((x)*(x))"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1591:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1859:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2010:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1877:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2483:
+	.string	"servoIdx"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1707:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2239:
+	.string	"BOXCAMSTAB"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF2062:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2495:
+	.string	"updateGimbalServos"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1992:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2291:
+	.string	"FD_ROLL"
+.LASF1484:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2114:
+	.string	"pgResetFunc"
+.LASF2351:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1802:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"BOXAIRMODE"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2425:
+	.string	"serialrx_provider"
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1488:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2308:
+	.string	"MIXER_FLYING_WING"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1471:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1543:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2181:
+	.string	"OWNER_OSD"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2458:
+	.string	"rxRuntimeConfig_t"
+.LASF1656:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2494:
+	.string	"servoIndex"
+.LASF1868:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2487:
+	.string	"input"
+.LASF2111:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1917:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1527:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2237:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1619:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2018:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2128:
+	.string	"TIM_USE_SERVO"
+.LASF1599:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1810:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2309:
+	.string	"MIXER_Y4"
+.LASF2306:
+	.string	"MIXER_Y6"
+.LASF1989:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2044:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF2023:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1447:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2342:
+	.string	"PID_POSR"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2343:
+	.string	"PID_NAVR"
+.LASF1708:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1820:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1977:
+	.string	"I2CDEV_COUNT 4"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1457:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1625:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1648:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF2498:
+	.string	"channelOffset"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1823:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF1513:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2334:
+	.string	"motor"
+.LASF2505:
+	.string	"servoDirection"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2510:
+	.string	"_reset_template_82"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2290:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1606:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1487:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1899:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2027:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2293:
+	.string	"FD_YAW"
+.LASF2095:
+	.string	"long int"
+.LASF2264:
+	.string	"BOXCAMERA2"
+.LASF2265:
+	.string	"BOXCAMERA3"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1480:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1725:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2127:
+	.string	"TIM_USE_MOTOR"
+.LASF2500:
+	.string	"servoMixerLoadMix"
+.LASF377:
+	.string	"__linux 1"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2043:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1525:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1617:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2316:
+	.string	"MIXER_HELI_90_DEG"
+.LASF1434:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2157:
+	.string	"OWNER_PINDEBUG"
+.LASF1996:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2312:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1940:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2313:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1774:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1710:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2250:
+	.string	"BOXOSD"
+.LASF2015:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1538:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1667:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1837:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF1732:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1766:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1805:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1751:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1572:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2417:
+	.string	"gimbalConfig_s"
+.LASF1580:
+	.string	"EXPAND_I(x) x"
+.LASF1459:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1799:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2145:
+	.string	"OWNER_PWMINPUT"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2030:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2102:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF1588:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1914:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF2235:
+	.string	"BOXANTIGRAVITY"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1814:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1813:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2076:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2242:
+	.string	"BOXGPSHOLD"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1841:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1430:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1524:
+	.string	"PG_PID_CONFIG 504"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1884:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2000:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1830:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2238:
+	.string	"BOXHEADADJ"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1503:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1463:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF2452:
+	.string	"rxRuntimeConfig_s"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2502:
+	.string	"servoConfigureOutput"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2192:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2241:
+	.string	"BOXGPSHOME"
+.LASF2467:
+	.string	"servoMixerFlyingWing"
+.LASF2158:
+	.string	"OWNER_TIMER"
+.LASF1694:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1504:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2485:
+	.string	"servoTable"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2457:
+	.string	"rcFrameStatusFnPtr"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1872:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1561:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1848:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF1734:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1907:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2096:
+	.string	"char"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2387:
+	.string	"servoMixer_s"
+.LASF2392:
+	.string	"servoMixer_t"
+.LASF1978:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1285:
+	.string	"GPS "
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1957:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1829:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1564:
+	.string	"IOCFG_AF_PP 0"
+.LASF1997:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF2415:
+	.string	"GIMBAL_MODE_NORMAL"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1659:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1824:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF2245:
+	.string	"BOXLEDMAX"
+.LASF2257:
+	.string	"BOXBLACKBOX"
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1651:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1547:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1778:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2170:
+	.string	"OWNER_FLASH_CS"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF1808:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1573:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF397:
+	.string	"true 1"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1716:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF2007:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2119:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2068:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2047:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2252:
+	.string	"BOXGTUNE"
+.LASF1496:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2337:
+	.string	"PID_ROLL"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1749:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2277:
+	.string	"GPS_HOME_MODE"
+.LASF2492:
+	.string	"servosFilterInit"
+.LASF1760:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2195:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1501:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2162:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2154:
+	.string	"OWNER_ADC_RSSI"
+.LASF1413:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1871:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1770:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2019:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2354:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF2273:
+	.string	"ANGLE_MODE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1809:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2009:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF2258:
+	.string	"BOXFAILSAFE"
+.LASF2471:
+	.string	"servoMixerSingle"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1597:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1682:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF2491:
+	.string	"servo_width"
+.LASF2360:
+	.string	"INPUT_RC_YAW"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2190:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2079:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1994:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF2368:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF2108:
+	.string	"biquadFilter_t"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1851:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1797:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1767:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF2329:
+	.string	"throttle"
+.LASF2419:
+	.string	"gimbalConfig_t"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1761:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1680:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2496:
+	.string	"forwardAuxChannelsToServos"
+.LASF1838:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1946:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF1630:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2039:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1712:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2082:
+	.string	"COUNT_SERVO_RULES(rules) (sizeof(rules) / sizeof(servoMixer_t))"
+.LASF1478:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2220:
+	.string	"THROTTLE"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF2307:
+	.string	"MIXER_HEX6"
+.LASF1895:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2052:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1991:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1786:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1703:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1514:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1585:
+	.string	"PP_IIF_1(t,f) t"
+.LASF2382:
+	.string	"SERVO_SINGLECOPTER_1"
+.LASF2383:
+	.string	"SERVO_SINGLECOPTER_2"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2385:
+	.string	"SERVO_SINGLECOPTER_4"
+.LASF1821:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1516:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2421:
+	.string	"gimbalConfig_Copy"
+.LASF1673:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1685:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1819:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF1862:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2105:
+	.string	"double"
+.LASF1638:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2320:
+	.string	"MIXER_DUALCOPTER"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1558:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1692:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2408:
+	.string	"servo_lowpass_freq"
+.LASF2165:
+	.string	"OWNER_I2C_SCL"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2187:
+	.string	"OWNER_COMPASS_CS"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF1773:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1657:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1464:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2203:
+	.string	"FEATURE_RX_MSP"
+.LASF1860:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2443:
+	.string	"rcInterpolationInterval"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2299:
+	.string	"rc_alias"
+.LASF2396:
+	.string	"servoRuleCount"
+.LASF2197:
+	.string	"FEATURE_GPS"
+.LASF2288:
+	.string	"SMALL_ANGLE"
+.LASF1937:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2391:
+	.string	"speed"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2397:
+	.string	"rule"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1541:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF2268:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2093:
+	.string	"__int32_t"
+.LASF2513:
+	.string	"rxConfig"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2166:
+	.string	"OWNER_I2C_SDA"
+.LASF2081:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2249:
+	.string	"BOXGOV"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF1432:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1438:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1875:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2205:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1481:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1436:
+	.string	"Q12 (1 << 12)"
+.LASF1800:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2477:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF2212:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2484:
+	.string	"filterServos"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1679:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1483:
+	.string	"PG_RX_CONFIG 24"
+.LASF1510:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1489:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1448:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2327:
+	.string	"mixerMode_e"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2289:
+	.string	"FIXED_WING"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1537:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1686:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF2078:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF1586:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1955:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1866:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2074:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1674:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF1604:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF2516:
+	.string	"servoParams"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1972:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2367:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF2388:
+	.string	"targetChannel"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1704:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1904:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2344:
+	.string	"PID_LEVEL"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1789:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2182:
+	.string	"OWNER_RX_BIND"
+.LASF1515:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF2223:
+	.string	"AUX3"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF2185:
+	.string	"OWNER_TRANSPONDER"
+.LASF1482:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2225:
+	.string	"AUX5"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF2227:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1706:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2284:
+	.string	"flightModeFlags"
+.LASF1652:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1822:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2431:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1428:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2132:
+	.string	"timerUsageFlag_e"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF1442:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF2453:
+	.string	"channelCount"
+.LASF1832:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2073:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2300:
+	.string	"mixerMode"
+.LASF2261:
+	.string	"BOXFPVANGLEMIX"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1660:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1672:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1518:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2038:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF2460:
+	.string	"currentMixerMode"
+.LASF1856:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2109:
+	.string	"pgn_t"
+.LASF1529:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2478:
+	.string	"biquadFilterInitLPF"
+.LASF2059:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1919:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1306:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1593:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1456:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF1581:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1540:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1622:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1465:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2384:
+	.string	"SERVO_SINGLECOPTER_3"
+.LASF2310:
+	.string	"MIXER_HEX6X"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1431:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1594:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1784:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2420:
+	.string	"gimbalConfig_System"
+.LASF1758:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1772:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2470:
+	.string	"servoMixerDual"
+.LASF2332:
+	.string	"motorCount"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2144:
+	.string	"OWNER_FREE"
+.LASF2191:
+	.string	"FEATURE_RX_PPM"
+.LASF1640:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2346:
+	.string	"PID_VEL"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2024:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1711:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2447:
+	.string	"rx_min_usec"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2486:
+	.string	"servoMixer"
+.LASF2004:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1792:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1695:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2430:
+	.string	"rx_spi_rf_channel_count"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1956:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1677:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"PG_VTX_CONFIG 515"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2002:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2407:
+	.string	"servoConfig_s"
+.LASF2411:
+	.string	"servoConfig_t"
+.LASF1421:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF2045:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1709:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF1655:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1663:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2041:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1981:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1959:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1971:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1497:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1642:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1847:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1559:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2201:
+	.string	"FEATURE_3D"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF2049:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1469:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2168:
+	.string	"OWNER_SDCARD_CS"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2336:
+	.string	"mixers"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1416:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1882:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1857:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2298:
+	.string	"attitude"
+.LASF2424:
+	.string	"rcmap"
+.LASF2053:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2035:
+	.string	"ALL_MOTORS 255"
+.LASF1618:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1603:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1634:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2456:
+	.string	"rcFrameStatusFn"
+.LASF1941:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1827:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1887:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1492:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2266:
+	.string	"BOXDSHOTREVERSE"
+.LASF2504:
+	.string	"servosInit"
+.LASF2522:
+	.string	"isMixerUsingServos"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1665:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1987:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1530:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2189:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2055:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1698:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"attitudeEulerAngles_t"
+.LASF2413:
+	.string	"servoConfig_Copy"
+.LASF2184:
+	.string	"OWNER_LED_STRIP"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2503:
+	.string	"loadCustomServoMixer"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF2469:
+	.string	"servoMixerTri"
+.LASF2341:
+	.string	"PID_POS"
+.LASF2506:
+	.string	"determineServoMiddleOrForwardFromChannel"
+.LASF2345:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2347:
+	.string	"PID_ITEM_COUNT"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1795:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2280:
+	.string	"UNUSED_MODE"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2386:
+	.string	"servoIndex_e"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2091:
+	.string	"short int"
+.LASF2064:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2135:
+	.string	"usageFlags"
+.LASF1500:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1843:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1511:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2088:
+	.string	"__int8_t"
+.LASF1555:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1522:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF1451:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2340:
+	.string	"PID_ALT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1974:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF2048:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2171:
+	.string	"OWNER_BARO_CS"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1512:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2358:
+	.string	"INPUT_RC_ROLL"
+.LASF1520:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1590:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1427:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2172:
+	.string	"OWNER_MPU_CS"
+.LASF2473:
+	.string	"servoFilter"
+.LASF2446:
+	.string	"airModeActivateThreshold"
+.LASF2085:
+	.string	"unsigned int"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2326:
+	.string	"MIXER_QUADX_1234"
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1967:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2517:
+	.string	"customServoMixersMutable"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1598:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2216:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF1493:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1905:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF2243:
+	.string	"BOXPASSTHRU"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1528:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1842:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2150:
+	.string	"OWNER_ADC"
+.LASF2412:
+	.string	"servoConfig_System"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2176:
+	.string	"OWNER_MPU_EXTI"
+.LASF2369:
+	.string	"inputSource_e"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2390:
+	.string	"rate"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2451:
+	.string	"rcReadRawDataFnPtr"
+.LASF2240:
+	.string	"BOXCAMTRIG"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF1890:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2232:
+	.string	"BOXANGLE"
+.LASF2370:
+	.string	"SERVO_GIMBAL_PITCH"
+.LASF1472:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2208:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF2281:
+	.string	"PASSTHRU_MODE"
+.LASF2325:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1641:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2153:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1788:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1519:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2042:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1804:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2173:
+	.string	"OWNER_OSD_CS"
+.LASF2519:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1931:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1449:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF2493:
+	.string	"writeServos"
+.LASF1811:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF1714:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1701:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1607:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1798:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1947:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1985:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2547:
+	.string	"io_types.h"
+.LASF2593:
+	.string	"mathcalls-helper-functions.h"
+.LASF2562:
+	.string	"servos.c"
+.LASF2576:
+	.string	"long-double.h"
+.LASF2583:
+	.string	"__locale_t.h"
+.LASF2594:
+	.string	"platform.h"
+.LASF2530:
+	.string	"src/main/rx"
+.LASF2559:
+	.string	"servos.h"
+.LASF2544:
+	.string	"target.h"
+.LASF2587:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2570:
+	.string	"libc-header-start.h"
+.LASF2568:
+	.string	"stdbool.h"
+.LASF2537:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2586:
+	.string	"math-vector.h"
+.LASF2541:
+	.string	"stdint-intn.h"
+.LASF2552:
+	.string	"rc_controls.h"
+.LASF2555:
+	.string	"axis.h"
+.LASF2536:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2539:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2577:
+	.string	"stubs.h"
+.LASF2581:
+	.string	"wchar.h"
+.LASF2531:
+	.string	"src/main/target/SITL"
+.LASF2548:
+	.string	"timer.h"
+.LASF2529:
+	.string	"src/main/io"
+.LASF2557:
+	.string	"mixer.h"
+.LASF2558:
+	.string	"pid.h"
+.LASF2535:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2551:
+	.string	"config.h"
+.LASF2556:
+	.string	"imu.h"
+.LASF2584:
+	.string	"strings.h"
+.LASF2572:
+	.string	"features-time64.h"
+.LASF2612:
+	.string	"vcd.h"
+.LASF2611:
+	.string	"sound_beeper.h"
+.LASF2540:
+	.string	"types.h"
+.LASF2589:
+	.string	"floatn-common.h"
+.LASF0:
+	.string	"./src/main/flight/servos.c"
+.LASF2588:
+	.string	"floatn.h"
+.LASF2554:
+	.string	"runtime_config.h"
+.LASF2580:
+	.string	"time64.h"
+.LASF2526:
+	.string	"src/main/drivers"
+.LASF2538:
+	.string	"/usr/include"
+.LASF2596:
+	.string	"common_fc_post.h"
+.LASF2523:
+	.string	"src/main/build"
+.LASF2566:
+	.string	"feature.h"
+.LASF2600:
+	.string	"rcc_types.h"
+.LASF2571:
+	.string	"features.h"
+.LASF2528:
+	.string	"src/main/flight"
+.LASF2579:
+	.string	"typesizes.h"
+.LASF2549:
+	.string	"pwm_output.h"
+.LASF2524:
+	.string	"src/main/common"
+.LASF2605:
+	.string	"serial.h"
+.LASF2602:
+	.string	"flash.h"
+.LASF2525:
+	.string	"src/main/config"
+.LASF2604:
+	.string	"sdcard.h"
+.LASF2574:
+	.string	"timesize.h"
+.LASF2553:
+	.string	"rc_modes.h"
+.LASF2542:
+	.string	"stdint-uintn.h"
+.LASF2532:
+	.string	"src/main/target"
+.LASF2608:
+	.string	"utils.h"
+.LASF2599:
+	.string	"parameter_group_ids.h"
+.LASF2533:
+	.string	"src/main"
+.LASF2603:
+	.string	"rx_pwm.h"
+.LASF2563:
+	.string	"mathcalls.h"
+.LASF2613:
+	.string	"time.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2590:
+	.string	"flt-eval-method.h"
+.LASF2550:
+	.string	"resource.h"
+.LASF2575:
+	.string	"cdefs.h"
+.LASF2598:
+	.string	"config_reset.h"
+.LASF2561:
+	.string	"rx.h"
+.LASF2592:
+	.string	"fp-fast.h"
+.LASF2607:
+	.string	"io_def.h"
+.LASF2527:
+	.string	"src/main/fc"
+.LASF2606:
+	.string	"io.h"
+.LASF2564:
+	.string	"maths.h"
+.LASF2591:
+	.string	"fp-logb.h"
+.LASF2565:
+	.string	"string.h"
+.LASF2595:
+	.string	"common_fc_pre.h"
+.LASF2534:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2582:
+	.string	"locale_t.h"
+.LASF2560:
+	.string	"gimbal.h"
+.LASF2569:
+	.string	"stdint.h"
+.LASF2597:
+	.string	"build_config.h"
+.LASF2543:
+	.string	"stddef.h"
+.LASF2578:
+	.string	"stubs-64.h"
+.LASF2585:
+	.string	"math.h"
+.LASF2573:
+	.string	"wordsize.h"
+.LASF2610:
+	.string	"bus_i2c.h"
+.LASF2609:
+	.string	"io_def_generated.h"
+.LASF2601:
+	.string	"adc.h"
+.LASF2546:
+	.string	"parameter_group.h"
+.LASF2567:
+	.string	"stdc-predef.h"
+.LASF2545:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\376\002e\020"
+	.string	"d\025\362\003"
+	.string	"/"
+	.string	"\227\324\251\365\n\n\002"
+	.string	"\002\001\002\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\346\252\251\302\017\004\002\003\002\004\240\342\234\212\n\005\303\310\271\246\t\004\002\002\002\005\002\003\002\006\006\b\313\303\260\243\006\224\001\002"
+	.string	"\002"
+	.string	"\002\007\002\b\002\003\002\t\n\003\002\006\002"
+	.string	"\002\013\f\002\f\007\002\r\016\017\020\002\016\021\004\002\002\022\t\002\t\021\022\023\024\352\263\360\321\b\026\323\314\333\334\002D\002\023\002\023\002\002\024\002\020\002\017\030\031\232\242\313\204\f\032\033\340\216\253\313\016\004\002\025\002\025\002"
+	.string	"\002\005\035\243\230\366\360\007\b\036\240\367\360\225\r\037\376\340\242\235\003\n\002\002\026\002\027\003\002\004!\"\206\353\317\360\016\f\002\030\002\030\002\031\002\016#$\350\266\266\364\b\030\002\002\032\033\002\032\034\002\034\002%\235\316\247\271\r'\344\362\241\220\b\020\002\035\002\002\032(\317\245\260\262\b\036\002\023\002\023*\342\201\222\246\004\002+\230\227\377\334\t\002,\257\260\211\347\004-\265\371\317\206\t.\362\324\245\255\006/\303\306\351\344\0060\320\266\271\326\t1\227\213\266\256\t2\376\312\360\275\b3\217\240\261\222\00445\247\336\216\365\00167\302\234\216\234\01789\235\307\214\342\002:;<=\240\342\234\212\n"
+	.ascii	"X\250\301\255\340\214\314),(I\2415\003P\202b\254F\017\022\200"
+	.ascii	"\323:\036TJ0\024L\245Y`\254\177\007\261\302*\b\357\361(R\244"
+	.ascii	"\242\224[u\254\361\334I\312\002EHT,\221\353\t\201lE\203\f,Zi"
+	.ascii	"\272\023V\032\202\276\210\026\324\035\246\246\275+5\217\277\032"
+	.ascii	"\216G\215\306\273'\236\220\267~\023\310\210\222\376\277\005\024"
+	.ascii	"\316\234\r\273X\003<\003\031\264\2275C\027t\342\204T\2333\354"
+	.ascii	"\326F\2471\377\227\036\030&\202\335\276\235\243<\343M\373\321"
+	.ascii	"E$\207\365\346\311\217j\2707g\025!\203\236\370\343&{\3307Y\332"
+	.ascii	"8\205\257\336\377\0208\321~\367\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \321M\003"
+	.string	"D\003\305"
+	.string	"\021"
+	.string	"\001\001\001\001\001\003\001\001\002\001"
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"\026\001\031\033"
+	.string	"\001"
+	.string	"\001\035\003\036\002\003\037\"$"
+	.string	"\001'\001(\001*"
+	.string	"\003+"
+	.string	"\001"
+	.string	"\001"
+	.string	"\027"
+	.string	""
+	.string	"\310N\200%\300K`\244n\214\262\003\226\0055ZR\344\274\272\220e4\227\334~\022\355\223\rX\326b\016\204\2149\"G"
+	.ascii	"\304P\t\374\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`M\003\355\020"
+	.string	"&WVD"
+	.string	"\261h\030\003\330\315\335[\242)\370\207\016/\300\220WX \304m\377a\021\201\020L%\351\265\2754\016\265e\207K\377\f\321\306\007@\377?\274W+@Uiv\272#\21377e\206M\\\303\266[J\231\0029"
+	.string	"C"
+	.string	"O"
+	.string	"z\203D\345\352_J\034\327\023\335\331\335\217u\356\323\307\221v\312\335\335\355S\t\363H\244\b\251r\306{Y!\032\363D\245\205\335\365\370S~\362\021\245\257\335\005\275\200\265\005\001\032\\\244\013\204\220\265\275*k^\260\264\360\203\216\207\f\262c\207<~\376"
+	.string	"\035s\037>\330>%sbZ,r'%m\304\264Z`\t\022\b\273\234\355\256\020\310W\225z028@\376p\337\334\227\277(\246K\036i\235\236\230\311zJ,<\033^!\037\200\320\303\001\003\251K\227\330\005\235\001\217\2004\222\304s4\001pIon`\300h*\352\322bC\003d\004M\262\003M\213\353c\003\037\013D\216\310\306\253q\215\026I\251\214\t\021pJR\304L\377\207P\363\327\356v\254\340?i\271\233\270o\304\321#UV!`7\360%_;\235\341\202g\345\331\tNRFF3bCIV\216\032(L$(IAB\005\023\"#\300\2119X1He\214\025LET\250A1C\202\031\033\242-H\306`\002\2311\252;\021"
+	.ascii	"-D\b\031!\233 MR\031\346Gz?\025B\351\202\260\373\306\364\203"
+	.ascii	"\322\347&\241\b\3160r|\310\224p\342\327\372x\037\207\037i=*'"
+	.ascii	"zH\367g\205\267\220\006#\025W\t\350\332\351h\t\324\311\342e\216"
+	.ascii	"H\242\247)\030bY\030\002\313z\026_\022\235Z\355\232hls|\346\275"
+	.ascii	"\335\312\017x\nd\214\005\306\220\031b`:\020\323\237\232\363\204"
+	.ascii	"\3737\304\236\360\026b\006:\344\202\f\304\024\242(\346\300s\001"
+	.ascii	"\301\341Xz\035\233\361\272\325\035fk(\201\251\337'\222\263\372"
+	.ascii	"\004)k\003\020\267cU\\\243\f\302\377\331\021\223R\027$\336;"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\314\002\275\013"
+	.ascii	"\322O1/pk2\034dj\373\307=\nfJ\201\016j\364AU\217\023$@\306!\020"
+	.ascii	"\305\372\377\377\377\0324\351c\225lBb?\032\263%\332\237l\231"
+	.ascii	"d$Y\221\fcX} \224\025\204\271\r\nx\217\243\247v\307]\342\034"
+	.ascii	"\267\221\247\306\247\326\245\013\265@\222\t\036\317\354\264\352"
+	.ascii	"6(\2245\322\362\306\227U\241\352\250:\351K\251L\224\336"
+	.string	"{\2174\250x\212;5-`\024\355\"\006(\213\262v\022\255\3258\3431\376\342~\275\305\354\303>\032\216\2063\331L6\231\220L\310{\017\2265AZw\221B|i\004_Zg%#\200\337\020\205Q\"\231\235V\367n\242u:X\312HW\350\342\3205\331\016\276\216=\005\310\256R\250\3618\360Fd4\326\312\001p\002\231\262\353\001\022\200\241z\214\2039\206\230\233\t\223\263X\177\003(<\200\013xk\361\nW/T%\350x\277\b\020\270\336\003\360\306E\002\244\271\344\206$Yp{\033\362MV\307\360!\370\326\200'\207\355 \317\275\331\371:h\370i\273\303\265\211O\t\340QA\323~]\2140\311C\243\333@\306\"N\n[\344(\315B;{%\r\225\226xL^\261\207\202\2661\036\353*\017^Z\243P\t.\304f\244\362F\020DZ\254\206\362su4\006\340\346T\273\247i6\024\"\343 \361"
+	.ascii	"\350IW\005\303Gq\002"
+	.text
+	.section	.gnu.lto_.pureconst.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\005\270\004\b\231\004\026\231"
+	.ascii	"\004\031\231\004\033\230\004\035\205\004\036\205\004\037\230"
+	.ascii	"\004\"\231\004$\231\004'\232\004(\230\004*\204\004+\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"U\007"
+	.string	"\362\312 )\2405\031\016\347:W\365\356\203\216_"
+	.string	"\340\037\001\202:TO4\351\335\b\221F\244u\216\327\2309\227\314\031m\333F\244L\001S\217\242T\336\232\020\237w&T\351\276\225\267v:\270\2526\246\256\212\214\331\2247\355\202K\225\224\273.\212\371\312_g\244s\352\224\032\225G]\377\tHY\250\323\265\206\371\224?\312\245@\220"
+	.string	"\020 \360\006l\214\031a\316g\354\203yc\317\273\323\356\312\017\005\0341\363\034\b. P\202Ru\347\001&\262\300vdC\b] \246(@z\334#\236\270\b/\034\354\200\311\030\207\335\274#18\004\001\240[x\204,Xlc>C\342&\266@\335\037\35358\024\267\244\274\026\330\336\214\tR\025v\277\323K\2601c\267\353eY\2466\r\366\220\300 \367\246\345`\030\206\325\021X8"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.fe8126d2a54b96f1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.75.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007_"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\274\253\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\006us\350\364\005uq"
+	.string	"\005\001\006'\001\0204?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.76.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\244\001\275\016"
+	.string	"\226\030]F\360t\233\016D\343y\260\305\246\377fQ8y\333\006\252\210\306\272\302\242i\033\2551\201c\253\262\255\264\257A\275\200\217:\267\206'\300L\021Yr\313.\312\214G\207\233\320\227\252s5U\202\234\212 ;zI\333)\005E"
+	.string	"F"
+	.string	"K"
+	.string	"\376\215\343\bO#\363\001\2733Anv\305\b\206@?-\036%\373\244/\220}:\264\215$0!`\311\t\233$\273\313]2B\031^\206\376S?)\231F\227"
+	.ascii	"*\354\256e\311\244\342\276n\233\201m\f\266\\\020+$$\3312\212"
+	.ascii	"\022\"+Y\2668\222W\f\373\330\356\256\257\031\3734\277\244\037"
+	.ascii	"\026\b\206\354\242h1Y\325\374A\343)k\233\252\263\355\213\317"
+	.ascii	"\021\276\3069t\224\202\2160JGvw\373\364\n\375L\3016\234\356\322"
+	.ascii	"\001\364Sb6N\333b\373k\376yA\222,\313q\005\346\035\247\252\240"
+	.ascii	"\344h\342p\037\242U\353\257\231\375\362\036\225:@5\361|8\217"
+	.ascii	"\035\rX\232\220\2132\033\274\016\321\201\225\035\363Q\004\335"
+	.ascii	"\335\316f\004\t\003\250\031\237\276L\366\371 \336C\2004\204V"
+	.ascii	"\002\230B'\3413\301\243\342\351\020p\361ZB\325\202f\226\016X"
+	.ascii	"A| \220\203\331\340\342uh\341B^\206\027\216\345\003\271\216\002"
+	.ascii	"W\017\240\217\203\251\365\3434q\237:\035k\250HW\t\307\234\344"
+	.ascii	"V\004\210sRNvO.n|!* \240\002\0313\333\001\246\360Id\322^\021"
+	.ascii	"l\323H\337\006\210LH\001u\363.\376\023C\200\211\"!\310\274\253"
+	.ascii	"\265\351\344j]D\211\337\334\221\322\200\t\027\241\007d\216=)"
+	.ascii	"\353*\033P8\355&\006\343z\2129\205\001\373\333\365\221\253\265"
+	.ascii	"\366\032\264H\024\263`m\305B0\216,\362\206\027\202 \003"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.80.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \210\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\301\033\006yw\250\375\005yu"
+	.string	"\005\001\006'\001\360\0250sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\\\005\2412\022h\2227\200\""
+	.text
+	.section	.gnu.lto_servoParams_Registry.84.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \226=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\340*?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.85.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\337\001\r\022"
+	.string	"\326c|H\320\224M:\326 \215\211\020\222T\240\306d0\006\0306\006\307\315uR\226\013\3555\351\2708\024\304\2650%\326lS\230PQ\020\343\202\340^\315 WK~F\354\n\304\232\377\360\362\r\303\275\272\310z4i\204l)S\nh"
+	.string	"c"
+	.string	"g"
+	.ascii	"\017\352\360\001"
+	.string	"s\372\034\341\230s\\q\212w\316\343\rt\347\274\027\350\316\331e\007\371hb\236F\242f\350\310\234\023\334\022\366.\307[\252\353\234\\u\371BG0b\207l\366:'O78?\004\314>H\227%!:\257]mf1\225+r\276\257=E\347\206l\226s=\275\3149\255\262\231\210\273\273\355\226\355\b\266\236\004j+J\232\312d\217/\335\037\373.K\242\n\257\217\215z\320\177:\355\226W\357\252u\3257\351\210\3708!\2323\304M\311D\342t\244P=\355{\241\362\207\354\324\007\244\362G\277\346\324\271\017\205\312\266/\3433\\\247\331\310{\341xD\264\023C\346\234\3379C\360\316\241\310\247\354\217Gu\265\017\3431\\\0011\275}\307V\224\024@\\\362\364\266\337v\033\241\032\0012\247x\231O\34350\310\003\2353\207\260\273\354\234\037v\347v\355\f\033\3642\2334\361\210\373\262\356iwU\212\210-"
+	.string	"\334<\272\257\356E\0261\275Y\356w\245\251f\tLo6i\352\231C?\b\233\321.\321\r\222\034\353\357\247\335\001\017L\231\374\332\245\213\236\253\273\001\203\004*\005-\013ZX\b\310\304\314\300\320\2043+\3171,!KCK&\004i(LXU\220"
+	.ascii	"\316\254`,\2001\255\020d9`\326\005\231\026H\303b\265\300\324"
+	.ascii	"8\277>\276\320=[\021$\330\306\270\375\361\351hQ\273J\372]\256"
+	.ascii	"\215m{\267Q'\367\201\222\007M\322\243G\356\013L\231.\347\234"
+	.ascii	"S\242\366\264\243\250\\.j/\356\004  p\002!\313yb\022\024\006"
+	.ascii	"v\217\254\263(!\251W\246\303\b\032\026\310\364\255\330\332\345"
+	.ascii	"\306&\325W\267\306@]\f\346 \211\200\204xF\341<\302\212\331WW"
+	.ascii	"4\255Y\332F\004\177\367\373V:q\321\020\301^\250\032\357G\244"
+	.ascii	"s\211'"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.89.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007R"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\261\033\005yw\350\305\005yu"
+	.string	"\005\001\006'\001\001\0030sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"[\205H\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.94.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.95.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerBI.96.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerTri.97.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerDual.98.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.99.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.100.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.101.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`A\002\365\013"
+	.string	"\304\021\f\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\203\367\242\017wu\b\310\001y\307\025\370\366\202\017sq\002\314\001y\313\024\023\022\021\020\017\274\236\374\226|om\005\332\001y\331\016\r\f\013\n\t\344\226~ok\332\001y\347\001\007\006\270\226zsi\314\001y\355\005\346\342\rge\004\361\001y\360\004\003\002\250\226oca\001\371\001y\370\330\003_3\373\0014\372\001\367\001\366\001\365\001\364\001\363\001\362\001\357\001\356\001\354\001\353\001\352\001\351\0015\350\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\334\001\333\001\330\001\327\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"0 @#\031\221\007M\006\004\373\202\330\304\345\"e\250\275`\022"
+	.ascii	"\231\356\240\345~(\341\022\346\237\221\221\337Z-X'9\316\rbE\347"
+	.ascii	"\332\252`\211Ln\302$\222\356A.\027b\303\036\314n\232\260\211"
+	.ascii	"$w\t+%q\320,w\351QM\276\006\275\\\375a'\227\260K\204\223\241"
+	.ascii	"\204\310\240\207U\004"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.102.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`f\003%\031"
+	.string	"\026\356\243G\240ZQ:e=\317\257r\306\221eI\342\232\354\200z\255\277L\t\343\344 \315\233~\350\321b\244\276a\273f=\214\317\255.\2526>\2360`\2246\236\036\017\217j\016Z:4\341\340I~\367\366K\020\331d\357\224\002\213"
+	.string	"\205"
+	.string	"\222"
+	.ascii	"@\366{\376\001\232\375i\305\270Hp\236\200\201\001\334\345\365"
+	.ascii	"\274z\302\310\023\004\232\363L\374\335\227\314\316ca\326.\220"
+	.ascii	"r\312./\201y\306\327\235\320\266\257\344N3\323&o\210\r1\027\264"
+	.ascii	"5Y\263\273d\200\023\020_\347\005\210\257T\310i\027kH'\315wq\361"
+	.ascii	":tj\252\007]\227\033N\307\303\034\334\013\027Ni\322\220\200U"
+	.ascii	"\023\231\034\334\213\220g\251\n\307{\2372pIs\342D\330]\317\033"
+	.ascii	"\356\306\215s\333C\266i6=\n\265\351\306\"=\255T\266`m\226~\357"
+	.ascii	"\255\037\356\313N76/i\322\234}Z\226ei\032\304\366t\313\323\254"
+	.ascii	"?\335\343y\277\350\351Z\247C\234"
+	.string	"i*NOW\316\222\025Y\356\326(\337\254\227:u\344O\277}'\256&\337\350\302\306\b\225\013\002w\027\351>?\212\366\242t\273\353\262=\333Q\342-\356\347\b\320\251\347\025\301\016\250\316C!\275\211\251&l\355\006OS\027\033\217\004\257\3760\276N\3377s\365\334\002\254\251\221\206t\246\261\005\001\374v\370\314\231\246\251\220\346<RJg\260\307\305\346\360*\035\306\335\r\362\251|\352\003\210\327\374\355E_EdW\233\345'\2254VL\264\374\nq\244!zc\224f\033\317_\216/#\375\323w&\035\351\334b\013Z\350?\030\215\321\203i\311iW)\350O\354\026\227Bb\032\370a\246\027\305iw\037@y\024\"\277\310\253K\024\315\337^\375\030\275O\314\316\227z\230\253e\003l\251\001\342\344:\276\250\035\215$hN/\365\235\036\"\002!\026\305d\022D\310^H\262\230\204X\006\0230#\243\327\220\320"
+	.string	";\bR\300`\301O\203\037\037\035\0250\021F\024Z\026\3629\212\245\220\301\216H\024C$\210L\214 \215\210^E\244\220\354\210\364)\340\330\t\230\214D\021\213\311H\027\257\366pi\020\317\"Wej\213\276w\226\356j\027\262h\2452lW\352\b5\232\024\356\356\2124g\013\327r\241B\017\235T\026,-z"
+	.ascii	"j\004^y\211\202:\004\246\237\217\0313\252\214T\232s\212_\241"
+	.ascii	"=\360\251n\005\203\206\r\033\304W\026\r? `\002!tW\017\331\006"
+	.ascii	"$\307\036\366+iR\374\212\227\303\t\262m\027\231\215\245\320:"
+	.ascii	"{\254j\322\371\005+\235|\271\330\344\212\206\325\006\271D!\004"
+	.ascii	"\363\201\301%\277\214ok\207\306\3524\004\0179,\304Gk\026\254"
+	.ascii	"EB\"\340\211X\245\026\340\360\200(\021\265\370\021f\273\242\262"
+	.ascii	"\367\265\2747-\310F\330\207\004\326\023\007\341\016lc o\362{"
+	.ascii	"\261\265_\366\220\027bI\024\236\361A\304K<\236w\005\335\240T"
+	.ascii	":\302M\360\2728\205\267oT[\005\005"
+	.text
+	.section	.gnu.lto_servoDirection.103.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\344\001\305\021"
+	.string	"\326axH\300\322Q:*\002\246\3271\013\005\340\017\245?;p$c7\305X\377\nUx\004\374\007\227\225\273\001"
+	.string	"\265\246\026\001\205z\256p3\340v\b"
+	.string	":\b\350\b.\203\302U<\320\272u&\020\017\005\003\343\203\375d\023)S\n^"
+	.string	"^"
+	.string	"g"
+	.string	"\271\033,\252GV\215\006\317\023\035g\236Gv{\202\226v\027\201Y\252G\333\376\320o3\233\367\345X\330\016d\"\347\bjw\303\223\013"
+	.string	"\037\277\007"
+	.string	"\037\025\350\263\177\2323\337\346\337\004\241\236\216\215\304\265\304V\373Nv\367\272\347\216\355&3\265\262\273N\035\033\317\035o;\202m\032;\t\004BL\233Qv\256\226\372c\377[\365\261\237\373U\307\375\251\247\243\246?M\353\323\251\351\217\224,\355\200`cWDo\310\352\2104`\270\346E\376\221\216P\n\332\335\225\355\331\267I\373\271\020J\272\035xD\301\355jnd\036\313\322xX+r\340<A=\272\202\352\361~\321\314^\331,&]\327OA^N\211Z\366\234\252\372\234\"*Ey*H\004gH\315\034>\343\205\345D\023\212\333\356\215\312c\3301\227\001\313\002*~\030\r\335v\367\001\322\223<\370/\036-\233\311\353<\372\037\300\307\253\201\0268Z\366\354\357~\335U<\234rA\232H\200\364\354\321MvH\270\020>\234R\372\335Oh\031\345\353N\242\024vyY"
+	.string	"]-\261\031\030\005\231\231\030\230\327\312\016T\022,P\220\302 \245e\002\302\225\001F\002\211[Z2\030M\314%\013e\\6\274:h\ba^\027^\302\226\230,l\r0,\306\025\013e`\260X\270\312\321\376\255\372X\366\244(#)\234pd\353QwlG\365\nMk\037"
+	.ascii	"%\242\334]\033\325\037\377\005~\212\301\250\307M\n\261j\" P\002"
+	.ascii	"A\316]\035\320\006J`\003\375`\252hJ\307\033\222\330\202\r\fn"
+	.ascii	"\257\266\215\344V.\330\357b}\022\355\253\275Ed\363\276\007\304"
+	.ascii	"5\0340\312\217l3[K\n\002;\021\233R\033\033\323u\364\265_bw9F"
+	.ascii	"\212g\001\034Q\242\206\321\361\255Ue"
+	.text
+	.section	.gnu.lto_servosInit.104.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\266\002\315\025"
+	.string	"\326\247\213J\260\022R:\013\247\354JO\037\264\315\206'\311\274\003\201P}\326v\262V\341\265G\255w\370^u\375\331\033\177\315\317\226\007\264\366\2370\367\034&$\377\320\237\222\032\343.\023\\5\254\352\271\320\017J2\305T?i\204l\271S\nw"
+	.string	"q"
+	.string	"w"
+	.ascii	"/\216~O\265\n\r\\4\214\274"
+	.string	"x\227o\266\216\013}\365G%tF?j\255\345\2160y*\274[\363v\2625\262\350\316\233\377{k\307\2439IY8:8\356\244\303CeP;|\036\264\231\255\213\330\351\3718{\316\372p*\302\323\321\222Z\253\213\227\233KIrL\354Dx5\024\366\224\344\343\277\317\033^nN\226J\255\325s\307\333\271Cn\373\307v\003{\"\0055'+\372\212\031}\320E_\210\031c\306\213s[A_x\0254?\310\033l\363\273\213\276m\274\370\215\221\340\301\315+\317a\r\247:\251l!\315\334\236}\031\224\215\220\027\310~\035\b\274I:=\212\323\2428M\351\364\356\364\234\323\037\021\251\272\301\200\251\326\234\253\252\332$\3128q\340o\037\366\213\371D~\320.\030Q\354D\301\355\300\031\262\n\261\002#\271\343>Jg5\265{\2043\2254n\317s\237\364\007O\245\206\250?3\206\354\215\317r\3541H|="
+	.string	"\f\241\312\0244`\320#]\3349da\255\342\036\305_NLF\273=\237\303H\227BQ\216\334\004\342\221Y\362\b\243-a\302\374\216.\312Oni<\207L\273~\213\273\360R\213\225\346wV\212\332\361\330\335\353\254\354r\026/\261\024\333\036n\004#\300W\003^\220r"
+	.ascii	"\005\301I\202\023\223\327\354v1\261\321:\324^l\245\214\005\230"
+	.ascii	"\031\206\ne\206YKL\351R\263\225&\003L\323\360R+eh\264Z\351\022"
+	.ascii	"\326/\320\357\3440H\023nk\310\355\025\360\031_k\312\nYroH\007"
+	.ascii	"!\310U\301M\252\377\264\326Z[\257=\360%\270I\345\177f$\367\265"
+	.ascii	"\267\001Q3\257L`(\345\262\361\225\321v\355K+\001|\265V\231?\343"
+	.ascii	"J\017\f\201\205%9 @\002\202L\262\363\273R\211\210\346\271\356"
+	.ascii	"D\016\371\240r\307\361{\203\355\234\364k\340Y.\357\300\334\211"
+	.ascii	"\217\306\347\352\240\215\242\211\326on\343%^5\242E\\\033\026"
+	.ascii	"\034tq$\206\340^\"\303\f6\363\0048\350\263\311\020bY\252\264"
+	.ascii	"\013EfJ\355Y,g=\n6p\352\030*W\376w\001\261\212\265\276\020\371"
+	.ascii	"\206\254\354t\205\326\005$o4\345\032\227\020of:.\274\031\b3\226"
+	.ascii	"\207\363\016\002\267|\255\243\327N("
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.105.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\242\003\005\031"
+	.string	"\026m\237G\260\032Q:\320\022\270\024z\2507R\227\032\253\220\013\2644\243\330\260\210\202\347\264\254bZZ\212\265\216H6\324~\337y\255?\372\tk@\005\027\324\037\364\347\213G9c\371\321\355\337\323|\241\020\305dXA\310\226;\245\205"
+	.string	"\206"
+	.string	"\216"
+	.string	"\244\307\207\252\037\254\017\235H\366\236\223P3\032(\237\257d\252\265\256\036Z\205z\230z\002\361!=\002\361\341\034-\263\307\234\f\252\367!\3010r\252\265\266\026\210\r\234\222w8e\027C\272S\346+\271\203\241 .7\273H\367geW\223\273\321\033\035\020\245\223\237>\271\332\f\207\3348\2457CG\202\324\344lt\231\370\252\214\271\333\334\223W\361\202\270\334\215O"
+	.ascii	"\034j\255\236\270\\\215\033\300m\317l\347\330[$\251\333\316<"
+	.ascii	"K\035\357\021}\244;\351\361\205\034c1\217{\350\263\020\037*\b"
+	.ascii	"2C\233A\317\022\007\227:\2016Y\233\013d?\003\224\333\027\357"
+	.ascii	"\217=\276wS:\275tz\356\364\007\024 \372\335\224\265\316\b\246"
+	.ascii	"\251[B)B\336\373\355\037\355\0241N\036|H/\276\304o\022\300\306"
+	.ascii	"\230#\265\326\321\266\214V\244J\205x$\317)B\2155\347\213^\234"
+	.ascii	"\211\223>TZ\r\f]x7\036\021\036z\003\352\241\n\210\345\363\374"
+	.ascii	"E\002~\200d\223\"$\276!O:\250\b\361\013+Z\262M4\266C<I\004\b"
+	.ascii	"\235\027\035\257V\333\205\373\354\026\247\202\263\013~J5\031"
+	.ascii	"\274Zk\006)\237\222\243#>\374>X\"\362\215~\362(3@\032OLc\231"
+	.ascii	"]=\372\201,GN1\220\224\241{\243\247\006\224D\366\3274Df\275\372"
+	.ascii	"{\327\340\2036\201>yjd7\313\036\004\246\231n,\342\352\347\275"
+	.ascii	"\344\251\t\252\225v\234\377\344PJ\370B\017\355\342\341\021\037"
+	.ascii	"\332(^\3638\0076\341bgD\n\027\216h\f\027$T\230@\301\002\005\233"
+	.ascii	"\003"
+	.string	"\256[\307&\366j\001\333\211\265V\230(\341:A\242\225\302\225\203\242\245\003\213\265l\030\370\245b\007\326Z\361z\301Z#I\373\376\370J\216*{[h[\003#.\220\003$\241\343n\230\271:]\037'\211t;\204\261M4Zv\034h\023xZk\255\341\270\357=\305:\335\021B\331\203\313\356\357\270\246\277G\234\273\373\233\2566\203V\232\273`)\307\b`\224\247&\243,X\256\3404\b\262\262g|v\004F\250a0\304\030S$\030\212DFh\244\300\003\200\002\241\2719\017\021\260\255c'\005\206\2555\007\267\n\373OB\200\027\357\332\313\360\244\212\302!;g\346\377\233\245k\362@\361\253/j^#lU\036\331$w\274\225\375l\301\004\246\255xA\334\020\311\261\254\rOC&5s\322/#D\372$\027U\226u\347\371\023M\363I,\365\354<\026\254\322\371\305\211c\3461&\220\3513\333\227\372\032"
+	.ascii	"\t>\267\312\005\002\340\310\312\241\200X\335\303Y:X\346\0079"
+	.ascii	"\177\242\201\007\203\003N\242[:K\367\003"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.106.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\032\005\225\037"
+	.string	"\2067\303H\220\330Q:\220\350MhD\216"
+	.string	"\371N<\004\341\022\313\363\261\343\2041\212l\262\261v,\355\354\231\305\374\350\377\354Y\300\250\366\031~0\217\037\313\310"
+	.string	"\0223\005\020d\234>\3516\030\344\031|g\321\376\267\222O\310\2262\311\255"
+	.string	"\240"
+	.string	"\257"
+	.ascii	"\265\366\274\\\236\363\345\316q\314\227\364\001\314\227\317\255"
+	.ascii	"\322\356\230#\257\352\277\320\206^ij\255\276\356\261\275"
+	.string	"S\344\267d\245\353r\270\333i3K\272kV\332\333\204nD\343\322u\271\032\214C\240#\312\3527\372\240)\215\325\317\212VT\2476\354\362\254\"\r>)\317\215,R?+VQ\034\263\035bn\343\031\207TlR[\023\024\020\236\321\211\006\251\225I\036\311\304%N\310\324\3519\365\035\r@#\212\027\037/C\252\256u\004YE\033\334\310\263\f\243\023\335\251\265^\353\374d\0242\333\204j\255\313Dc\324\227\367\335\357vw\302.\355\ne\367mk\357u&H*~?\363%7\220\016\f\313R9\242\004\255\373\270=\177\227\350Jcb\265\335/y\327\212\355\261\266\305\206\361\211/\367\033\326:4\252 \257-\203\215\235U^\263\213\\\342>\356\3769\316\b\253l\363\330e^\235\234s}{\315{\323\274\274\346\3355\257\316\344\315\231\2748\223\367v\336\223\362\332J^\263\344-)/m\336f^>\357\r"
+	.string	"(b6a\254V\25056\225K\231\fr\256\363@\371\354\221\354\221\233\343)\372<\311\267\224\316\265b\347R\361\204\3625\246L\r=\357\365S\237MaK\367\331\247k:z+\024\3445\247\265\326Z\346\364\271\276\023\3445\353\363^\347\364\235nD\200\322\3620\026\030.\345X\273+\342W2$\270\252\265\006\355\255|L\303n\350\300'v8\363Te6m[\337\211\210\355Kf\226m\366\235\262\204\274\266\275.{\200\330\260\315\221\277\024XY\367\327XS\024\355\343\376AWjev\377`\322\006\256\207'?,\270\252RT\340\212\n\355\005>\266\310\272\367R>e\b\004\021\023y\021\315\354\210C!\001$awa\374I\221\0020\2652\0055\271\023#z\254\227{\342\310<2\037\013$\201\301\203\006\016 8\370\001p\364-\372I\372\275"
+	.string	"\032%\371\\\2408q\224\302\204o\305\021\t\025\276\"`\222\357\207\300\376X\030\001}.~?\240/\207\254o\036\313\301\b\227`\013uCpede\271>\356\200#\231Bn\322N\346C&\257o\372C\252/<\033\021b\004\223\340\016\360n\005\013|\342\356\b{iy\311\0318hPQn},\273N\003u\311\251]w9\321L\360\006L]\357\314\206.\020\351Z@\322\030\006\314\222\324\251\023\002\007\232.4&V\263=\311\314\341\372\326\271\376P\212\207;\217d\352\364\255?L\n\311t\332\207F\245u\034\230\032\263\217\273\373As\272L\333\005l\250aD\345\220cf&\022Q\320$\205\026\003p\002\031\242\273\016\021\260-US\323b\2155{\350|\275\255\276$\274\365g^\230\006\220\253\275\242n1Q\261\325\177\371\026\222\001&\320\345\257\024\253\366z\247\001&\265"
+	.ascii	"r\006F\330\n\320\rpD\374\030\211\003\304C\f[\030X\f\021\316m"
+	.ascii	"\271YA\3427\242<Pz\324g\351\022\201{&\007\241\272IK\346\2522"
+	.ascii	"OP\366\232\313\033\331SA\246\224\213\345\374/\2157DzFLF\311\355"
+	.ascii	"\002\366\016r\003l\361\370\322\236\3319\362\020\277~\022^~}\222"
+	.ascii	"\2579\374\323:.\244T\030d\354I\177\370+h\252x\032\031E\031O\025"
+	.ascii	"\260\n\216N\360\376\243\270\323Q\031#\2443\342\230j&\"\252OK"
+	.ascii	"f\207\203TQ\3530LYz\021\334\355\375\346\276\030\376"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.107.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\217\006\r\""
+	.string	"\326\272\316G\200XN:\177O\346\212p\337\374\277\276\265\273JE\354G\265m\214\303*\272?\327\354\262^7\373\352mesBG5\356\220\224j-\037\206\212\347\211/yp\235~\236Jh\356\236\3339\234t\300\240\304\022B$I)\262"
+	.string	"\271"
+	.string	"\273"
+	.string	"\031\322\237<n@\276\226\317e\336O\236/@\366\226\223\251\f\251\324\353\210\025Wk\355\371i\f\351\317\223g\363l\001zi\277\370&\277\033\235\264M\255U\305\262Z\253\217\031\244?w\256\203\3764_"
+	.string	"\375\351\237\r\346ZW\365G P]t\265\326\336\nA=\340\246\326m\356\357;\364L\315-\177\276\223'\bC\013\ne|g\356f\334 \"@\beN8\023\207\374\330\214\022\005`D\307\317T\307Ss\325\260T}M\212\207YaJ\310\331\271^F\t\233J\323\310\360{\2563"
+	.string	"k\013\n\207/w\027j\255.\203B\034\267\315mg\3316\262\321\243f\342\n0\251\252Q\236\343\365DGCnn\267\357\372\016\020\251e\325\3024\221[\367\fQ\235\353&\222\252\022iv\2637~\007X\242q\203\363\366f\237|\232j*\353\\\"\223k\265Dck5\225K\264\217\240\006\227\224\327\312\316\301\271\361\276\271\361\347]\354N\277u\357^\032=K\237[\3324K\257Y\272\334\322\327!@Fm\203W\2557\352\322\324\264\023Y\344b\377\226\231N\346\227\255\325\026\036\27213I\244\354\020,"
+	.string	"\333\027\205a\206#\020\246?\361\243|\250b\205g\373g\326\257jb\035\351\212t\r\324\200^\276\213\351P\234\324P\201\303\240.\305\247$t?\035%\320\237\337\241!\306\217\3754\220s\37390%f\316%\372\351Z\331f\311\346\354\302\225=\337m\224m\017\270\223\350n1\3009\225g\320\252."
+	.string	"K47k\255\325\314\331o\3556g\257"
+	.ascii	"i\266\226v\333\304\331|\034\304\272\254\241^\302R/R\302\216\326"
+	.ascii	"Q\035@\355\023G\363\355\220\2603.\006\324\004\303\034yJ\300\216"
+	.ascii	"\337)Bm\242g)\3324G3,e\227\233\227\r\342\227\327y?\250\200\367"
+	.ascii	"\241\266\321\223\276\363\213\2305%t/\273\305\253\2508u\202\234"
+	.ascii	"5\371("
+	.string	"\326Z' O\205\205\217\365\323I.\312\007\177\372K\350\317\262\355J\f\260\254\263\337\365s\375C$9\312\002>2\201\372n\tB@\017\034\004A\b\372!\020\243\b\005\222\3574\321\317R\022\f\245\242\245\336\213##\337\212\024=$\337\t\026=\"\245\245\336\217\001'\265(R\352\275HJR\352\361\264\200w\362\024Y&\r\270M\273%\032'\313\211\263\013\227\366<M\215O\316\316E\367\035.\306\203\217\333\234\210\005Wa\316\365y\023+\205W\322\004Q\234\275X\2728\026\220rk5\016\306\007\377\210lSE,?\304\024\033\351`\276\230c\242z\220\375cO\337vH\225\245{\262\335\257\271\177\312\332\335Z\320rw\377t$\335rwj\240\326\030\304\341B\f]\325\352$d;\305\337DDp\253\325\251\355n#L\022%\320\007\003{\250Q4\306\234RF\212\002\td\322\264\260\305\300\002\021\"\242y\022"
+	.string	"v9E\2311#G\024\030\024\025j\315\001\301\b\374\024?\251\206\177\270\030\211a\226\244\036f\321\027\375\352DFwC\017P\375hX/\220[}M>M\331S>a\306\200I\024\272T\237f\366u\034\236\204$cV\273zL\340X@N6\221H\247\201a\03518<\260\f\003\314\352\242J<\311)D\260$\034\177\272\030'P\017\203\0021\250,v\\7\276\263az\001\201r\266b\245n\253A\236w\327\276\210\263\023+u\273Z\017\222y2\002\002b#E\204eM+\301\331\235\227o.\204}\246\016\013\217\342\027v\324\3348N%dQ\b\262\326\233\001\367\345\360\215\376\200\216\353\375\232\214\266\035\304\t\300\213\322\375\021(\244\366Q!\317[\370\037\f}\367\2774mG\222\273\252\364n"
+	.ascii	"]\006\216q\320\351\367\232@\357\025\355\344V\032"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.108.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\264\002\275\026"
+	.string	"F*\226K\300\360*\035\177\325\242.\306Q\356\020Jh\004\260\232\311A\204{\275O\375@\334 \363.\330\242k6\307eU\326\374=\242\023\217\314\256\261~\037X\034\256\204\250,\272\373,\271\332\003B\211\370\275\237m\274XY\3276B\210\224I\006\203"
+	.string	"w"
+	.string	"}"
+	.ascii	"\333\212\251H\026\021\021IP\035\375\201\266\025;\221\262{\344"
+	.ascii	"\251*\211\224\220q\210Y+\222\300\321}\020\013\221\302\274[\222"
+	.ascii	"\240\367\037\336v\255E\033/jE\216\254\210\352\350\366vq\034\331"
+	.ascii	"SS\306\024\301 \035\265VY\203\330\223{G\317\346\336\036\350\003"
+	.ascii	"\214j\b\2072G\317\024\320\306\3475\004\236(NL\244+\3175\303\037"
+	.ascii	"\237%p\336W^\304\310\205p\210sN\251\324Z\227\205\303\016\337"
+	.ascii	"\364[\333\345\030\001&txy\343\352\037\257\340\203omgaa\244\247"
+	.ascii	"\326\031\223\375\212\007\301\354E\034]\\\f_xt\037\223\036u\365"
+	.ascii	"\213\351\350\343\346\362r\270T\371i\027\371\343\346\331=J\217"
+	.ascii	"\023s{g\027\366\237\337\343\345z\362\313\372\361\273JyU)o*\345"
+	.ascii	"M\231\027Ey\317\223\267\233\227\231\367\037\001rh8\310Q\253M"
+	.ascii	"sGUB\221F<\371\037\317\273\217)S\366\310\2752\215B\005Q(\217"
+	.ascii	"6\351\254\232\237\226\325*>~\372Yk\255'\254\237\034:\253a\375"
+	.ascii	"\317\270\271Y\372\340n\264w'P\340\0137\004\3302{6\332?\nFy4\253"
+	.ascii	"\317>\241h\212\277\356\376\021\r\323\307M\r7bQ\325ZQ\366Eo1\243"
+	.ascii	"\265\264\244G\271\027\030\221V\375~0\312\307\315}\205\234\227"
+	.ascii	"\256\372\325 I4\305\0377\027\300\322C\267\020\f\340\260w\317"
+	.ascii	"K\237|\204+\177\006;\232\256V[i\355h\272Zm\345\205v\273\261\270"
+	.ascii	"\314\\{bR\340\200\201\022\004%$\037\031h\025n\r \354t9[\315c"
+	.ascii	"g$:\034\206\034M'\333\271\264\330^j\262\233\215\005F6\313\351"
+	.ascii	"d$\002\026w\201\226\223\355p\270\234\254\205\364\275w\226D%_"
+	.ascii	"\377\320\346\331\223\"#\261\310\027:\253k\256\37470\021}\372"
+	.ascii	"\325\007\272\252\211\310\201]\275\352\232\275.U5\203\0333\354"
+	.ascii	"\264\251N[\325\251\244`\016,\325 2\\\347\245\254N\0035 P\002"
+	.ascii	"A\220\231\007\221\305\350\021|\241\345h\376\363\343\2665W1\226"
+	.ascii	"\226\211j\257\021\343\231\3356\215\3140!\267>b1\254\254\266\322"
+	.ascii	"j\257rD\020\313\263\301x\364\275b4cF\033\335\272P\031\355\262"
+	.ascii	")\235\321)&\\t\360\n\371-q\326\001 e\305 r\0343\030\324\272\236"
+	.ascii	"\027B+R\267\214U\324\006\363k\207\353(cH\270\345W\\\270)j\203"
+	.ascii	"|)7\342\216\007\016\007"
+	.text
+	.section	.gnu.lto_updateGimbalServos.109.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\335\013"
+	.string	"\266\326QA\020q\233\016s\031\201(h\212U\005Aph !\351s\346\024=\007\021"
+	.string	"Xp\001X\330\327u\2310\342\242\333\353\312\367\005"
+	.string	"(\177\002\025&\267\363\232\006.%S\004\275\341\331\365\223\266\267\224)\005="
+	.string	":"
+	.string	">"
+	.string	"#\0172\355\314\002\356&\036\326]\222\027-v\275\312\005*\217\346l\032\367@\354\024\202E\310\211\215\335\275\364\303\271'\347\037\305\251ND\364\234 \354\256\263\023\031\271\365\266\007\330\326\330\317\002\217Wk\006\312(?\247\013\02226o\330\236(\325\203}\270Zb\337\344\2472=\305\264\004\323Q\3230\323\n\323\251\351_0&bh\276\335\016\037\216M\211(#l\337b\023\b\022\245\222B\030 $\037\371\031j\254~\262\002bJ\\2U\325\306,\344;\013\340\240\"S\252\372\220\034\327\324\n\244\306(?\003W\361\251\354\256\003?\305\275\314\027\361\350\f[\276{\3647)n\300\340@\002\004\031\005\031\013\300\206\316\004P\204Mh\3230O\2079\326\226i\320:\333\025\252@\001\273\340\271@\230\204\317\305\321\266\313\n\340\fCG\273BY\246]\026o\017WK\2749\2212\322\017_2\352$\351\244\325=\002\023"
+	.ascii	"=\251\\f\224\231xs\024\316\363\002\n\362Y\203\263 :\200e\013"
+	.ascii	"y\303xX1\310pE\267\227\t\3205</&@05\017\334\271E;\237"
+	.text
+	.section	.gnu.lto_writeServos.110.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`k\017\005B"
+	.string	"\252l\250\027AP\236N\0073\261\320\2553&\360v\030\007\307\310\250&}Y\364\273n\307\036\272\373C\253\215\323\r \n/.\276Ek"
+	.string	"\304\310\026\200@\203\316<\016\2234\323\264\252.\312\343\030\351M\366\226)\245\024t\001D\001n\001\316\215A\211\314\232\fV\3326\307 @\255\032\365\213\222\016\354\006\354\376\353\336\353\313\334\315?UX\250\231(8\207\n\0135\3550\315\214Z3$zwM2[\334}\334SX\250\231\246\245\264\337X\3771!\373Lc\257`I\202\330\266-\005\266Uf/\327Vo+\327V\277\371X\250\271e+\301\326X\357\211\261\355]\321\n]\035\304\266\365\303j\225\257\330V\307\230\247\3557\327\266`\232\263\300>m\333f\275\221u]\221,\313&\371\366\365k6\272c\275\244\224\264DR&\217\214\212\220DCBG#[\\\325\373LMN>\306="
+	.string	"\215\035\250\332\263\227\236\264\322\023%\236$\267f\327\313{\005gFG\033\246\331\335\345\232!u\032\251\r\323\352\222\270\362\026\321\322\336t\335\261\343\326U\350<y\244\217\356\320\233&nZ>\262\274i*A\334h\256\213\256q\315\313_\033\246!\271\\\207vRzJC1I\003\342H\250\"kpM\364\001\313\220\217a#t4\262\206in\227\311$\255\315\213E\347\232\217^\357\025\242\227=H\265\263\273\314a\007m\276\366\250\232\rW\233\fI\337\242\223\257/\023.\\\240j:\372\341\232\351H7\371\\;\351\375\210\002\345\255\354\250Vce\333\266m\2714$\254\027\235m\333\262C\325\326\232\0014\2633`\346\n\314Df\002\255\262\210\021#\230pm\325\277"
+	.string	"\335\227\241\3014\375\245\233\2579\230Q\363\364@/\206\251Lw\323K\3274;\237\036\210\273\273\356\330\270sb8<\275\202\332\230\372ku\303S\225p\251\277VCn6<U\317,\323p\253A\202\273k\343\314p\237\341\251\332F9\206\233\fO\325\3026d!w\0306\352\343\256\215\033\344\006\303S\366\262C[\034\323\273.\334^xz\003\211\351\376Z[e\356-\314<U\341\264\265\355\263\341\034\332Z\335\366\315\00517\226\316\362\305]\307&PxC[\345F\261\266\332ol#\363A\354\203eZl\355\275\366\212#\363DV\212Q\241\004stf\026`\336Pf\226\375\223}p\320\260\365Df\2772\177)s\277\225\033M\236\374D\230-8\0378\360\352\342R\235\267:\260\031\253\001\233\257\372\257\331\252YE5\325{\315R\253sT\321y\300\352\f\345\316\314\242\263\200\3259\300u~zg"
+	.ascii	"\253\263\323unzg\246\325y\351:+\275s\322u^\2763\322uV\276s\362"
+	.ascii	":\037\275\263\321u.zg\344u&z\347!\325\331x\235\331w.\252\316"
+	.ascii	"\353uV\337\371^\347\177g\367\\S\317\305\364MG\\N\b\023\025?\315"
+	.ascii	"\206\212\217\274\242\227r\221\033\221\363\233\016\017\r\223G"
+	.ascii	"{J\037\361\360\246D\017X=@\2660\265`K}\324\352#\250orR\337{V"
+	.ascii	"\356\211\334\217v\343F\033\322\371\375G\240\255\336\371\335\240"
+	.ascii	"\260\214\322/=S\352\227\276\017\317\004=\370\336k&\231'J\375"
+	.ascii	"\203\277\2076\340\312^i\254\316\337\334-\251\247t\243\025\236"
+	.ascii	"y'\354\361\214C\364e\211\364\313\357\036<\220\272(\037\3530\371"
+	.ascii	"J\266\265\244\0244\355\205|CIO\216\236@\2366\372#\317\201f\224"
+	.ascii	"\344\244H\013\371E\006<\352Pd!\036a{a\0235B\314\205\231=*\311"
+	.ascii	"\355\370R#\021\207&CO\364\256\305k\270\331\320o!\025\366P\236"
+	.ascii	"\261\341\261O\353\3267_\033\345\272\237V\343o=\373Y[Y\017\362"
+	.ascii	"VlB\205\nk\253\306\027@\327\226\244\203\n\255\b\235\342\322Y"
+	.ascii	"\257\303~+>\373}\b(\261\370Yt_\220\203\203\222\206i\002W\f\353"
+	.ascii	"\372a\200s\314\374\017"
+	.string	"3_\350>\030\330\2665\343\342\336\323|4l\340\300amu\375'\272\276?\\\232\235\352K\273\217\f\262\245]%\036\365\t\370}\025\261\361\334Q\257\022q\351\377X\315\334\301\203V\\\215\177r7\233\377\177k\261\201(\247\353\200`\333\266\355\342\236\323tBp\327\005*\232\027p\035\320B\220@A\002\003I\032&J\264\250p\344/\0030\300f\204\231\200\221\025#\005\n\025+Nd\265P1\202E\326W\030\214,\003N\f\346\302DXV\f0\260\260,!?\262~\"\035\312\250!\373\262\245\227\366\271\2231;1\266m\333\f\310\026\333k\017qJ\205Qy\315\217\"\344\261\003P\235\322Ky\211\036\232\245\205\347\213T\365\315\217z\222\036\300~m;`\320\260\371N2O,K\262`\341\335\215R\224(\207z\3461\2751>\263\177r\325C}\237\t\032\n\003\245\003\315\371\243\267|)\253\375\2652\337\235"
+	.string	"\3121\363?\256\204\231\265\343\320\217\337\341qR\210d4\365\214\224z\276I\252\227\001d\213\267`\273\233%}\306>l\227\006A\273\235\247\253>\312/V\001O\002\220\351\314\206\2602G\220\340\r\025\360Zqf|}\f\223gX\325ZZ\371R6\272\0359\370\246\203\002\327\204\325X\037\355*}\304\203bw\344\325\324\202M\365Q\206k\254*}\371Pa}\007\336\244\203\357@\254w \025\206\355\351\003P}"
+	.string	"/\252\367\002\360Os>g\004@\225n\2640;\336\n\232\037/G/e-hQ\3277]^\237S\201\276\372hS\351#^\336\226\".\247\026\354\251\342\225\3127u\365\r\350?\360\202\3041\352\372\006\274\372\256\316\302\203O\323;M\275S\201A\250Q8G\031B3#\"\"I\222\2445\301\005\304 \346\234\335\006\021\320(\310\030c2BR\220\324\2504\007\250\346\244\217N\275\253V\022\266o\020\204.\372\354V\331\220\271\271\002\372\243\246\365\370\374Gc\302;\364\flK=-V+\203\206T\f\363\f\370e\005\n\3016\344~\334\230\250\037\255\203\3200f\307R}\356z\026K\rl||\377\3233\007\216\203\016Yi1\205S_\023\001T\324\244Ez\216\317"
+	.ascii	";\017KG\262\333H\335\354:\342\024\240pCS\007\003\217km'$\361"
+	.ascii	"K\325\352\340)\004\257\035\326k\330\237\020\363\310\020\260*"
+	.ascii	"\202\300\363Z\221\005\023\356t\242\235\357\004cM\325P\251\023"
+	.ascii	"\205'R\210J\243\341\367s]\314\245\032q}\245\302GS\227\005\006"
+	.ascii	"\207\351W7\362\301p\360.\266P\013\002f\210\006\\\334\245\031"
+	.ascii	"$\bS5\0016Z\213\343\217\373r{\231\324F]\310\2006\305\322\337"
+	.ascii	"\344\310\272;\240\005B\206\210\244\002\337\237\323sc\353.\b\341"
+	.ascii	"!M1\356)Tx\262j\323\315\216\204\3530\342\220\217\nT\335]\375"
+	.ascii	"\333 \255)\2057\253\031P\353\217(D\034\311\345\360qT\246\306"
+	.ascii	"\331\034\250\303\3451\356\033\301\200\242)\317}\373\211\204I"
+	.ascii	"U\335\336\234\276\266\254t\317\357\250\277e)dP\371\257\223\003"
+	.ascii	"6\324\372d\017\002v\377\210c\274\321\367\245n\263\275\343\346"
+	.ascii	"\264\246\230\336\tC|\236\201\354\304\022F\242~3\005\364L\243"
+	.ascii	"\017\037\232\2057\200\006\332\250\024\275\231\004\246j\023C-"
+	.ascii	"\006\034X?\306\242\"\374K\370\005\311\370\361\322\231\007\003"
+	.ascii	"!)\226F\250 |\2277\336^\340\202H\257j2;\252\264\323\034'\262"
+	.ascii	"\225L<a\2038\253\204>\013"
+	.string	"Yu\250\352)\377\265/oy\237\334\232\245f\342E\335\024\213\022X\350\252\273<k\n\\g'\336\016\246\230\356\361\312\003Mi\221\323\226\325r$\330\005\033\t\327q\375\342\r\231\236\337h"
+	.string	"\240\321\231\253\324o\301z\017"
+	.ascii	"\346\307\250\337w\350NsN\001\304\024\206\321\231\236\255\033"
+	.ascii	"\235p\235j\342\366H\272:\314\335\nIP\347\312\033\267\274Ee\267"
+	.ascii	"E\210\363\217\\(^`\306\247\006"
+	.text
+	.section	.gnu.lto_servoMixer.111.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\232'\345\242"
+	.string	"\352"
+	.string	"e8K\020\030\246\351\f\007\024]@\205K\n\265I\331''\200n7\301t\347q\347\272\277\034\235\374\253^\035\t'\277[\223I K\336\333\341j%("
+	.ascii	"\314\313\255\301\026%\311\215Da\254\375(\027Y\254\252\361\366"
+	.ascii	"g\226\266^\322\222\2242\201\0033\003\213\003Qj/T\262wD\262WD"
+	.ascii	"\332\033\"\251W\231\366>\251\275 \224z?\250\275N\310^\017\310"
+	.ascii	"\336\016\310^\016\310\336\rj\257\006do\006do\023\262\227\t\331"
+	.ascii	"\213\001\331\273\204\354M\252\275J\310^\025\331\213D\366&!{\221"
+	.ascii	"\220\275G\310^#\265\267\b\331{T{\215\310\336T\355-\"{\211i\357"
+	.ascii	"\323\336N\352e\266\003\361$\317\r\271umrX\270\342)\326y\351\225"
+	.ascii	"y\220y\216\031\312\374\2069\016\263\034\3468f7F"
+	.string	"j^\343\243]>r\204\345MH7\267\271\356&\267\247\027w\0265\354u{\213\351\343\260x\367F&J\325\026Uq\324\034\365\301t\250\030\354\270\307'\232\302\320\307r\341\t/\025\273\\\270+Z\370\340DUm\374 \221;\022.\0372\3669,Af\250\004\0247hTP\035\334\323\023B\250(\356oO/0\020\013b\300#\347 \241_\337\202\355\321\303\307\200v\217\326\212\017\377\341\027T:\205~}a\374\372:\350Q\343\247\217\026?}2\270\255\035\271\270GO\333\032\306\200\036a\n*{\254X\317\332\021\333\326\260%,\321/\256r\344\263\022\302w\226\361\334\t\335\3562\211\353\232\225\270\245\2055g\bQ\254\355\ta\275\265\263`m\212\231\300\262\347EFx\302\221\355l\021\266[v\201\363\214}\n\311\340\325\341\303\253C'\310\221\213wt\270\b2AGE\332|W\204\351\254\035\203\035\351\236R"
+	.string	"\327uM\301\305\335q\247by\315\262\033\246c8\\\307s\\\220\223\245\334RZ\271\376\352|\ta\317\212\026L\216\223u\\\277\030\347\324\360:"
+	.ascii	"|C\004\232\007\270\256m\031\034\271H\242\020\252\325\265\304"
+	.ascii	"\016\215#\027K a\303m"
+	.string	"\230<\247u\\\341\034\277\324\356\3148rQ\251I\254\221\203*\273\224\326.5:\216+\262{\304E\022dT,\267-\277\355\021\t4iX\r\223\335\326\356\270\005v\224\203\262\001\224q\344\242\222X\304l{D\302L\005\237a4L^3\242l*\255+\227C_\326u=\301\3055q\344\"\343\341\246\224\213N\214!\345\"s7\020\267\241\255F.\202\236p\204\353\272N]K\b%%\017{db\033o\021\221\311\"B(\237@|p\032\341\241\003\207\r\032241aXJ*\251\310$\244##\250\242\2431-\022\337\314e6\026Ax\347\025\266\305\"\332\030:\323!\330\260r\311\017\223'c\f\271\257\300+bk\030\004[\030\260\265\376\300\007\306\326[h\332\211\r\217 \032\2174Y\201\371\300\346\210/\020\001\326\261\034\n\355A\00513\334\201\2031\206\034\037\007\377\\\b\274\"V\2067\220a\r^"
+	.ascii	"\221\351\f\317*\201W\304V\340&5;+4\023\006.\274D4Qf\347\t\363"
+	.ascii	"\201m!6\345\301\002\210\003\271t\262KZ+\251hU\032i\214qE\254"
+	.ascii	"\013'\225\315I\241\221\370\300Z *\217\230\017l\212\034\2256\342"
+	.ascii	"\246\031\206\"\032\231\200\365a>07\304\027\201\202P\3407\016"
+	.ascii	"\021\006,J\027\205PAL\n\037\371\215\213jl\002\257\210Ia#\024"
+	.ascii	"N\235]D\206=\211\312u]\217\302\2164\321(\f\n\237\330\324d\005"
+	.ascii	"/dX\027\321\004`\234Af\343\376\n\343\3526\306X\327u\333+L\214"
+	.ascii	"7\212w\373mw\363v\241\004\005X\316\230Z\264\244\\\214:\214\276"
+	.ascii	"\265\3063c\204j\032q(\021\037\361\"\3249\310\351\"\336v\317("
+	.ascii	"\022O\f\261N\357M\372\263\020\177z\253\340fG\371\020\314\264"
+	.ascii	"V\303\344r\\\327.\027\333m\235\206\251\346\205\t\006L\312E\345"
+	.ascii	"\031.m\r\304\237\316\317h\263\017\245zM\353L\243a\212a\216a\262"
+	.ascii	"\300d!\345\"\210\247\340\24234e\305\033\351\207_\215h\345\312"
+	.ascii	"L3\351.\023\r\223\255\331\353\303\0330\353\372\326\"\341\201"
+	.ascii	"q\362p\247\023\377:\334\3039\030r\370\206w\270\321\316Y\3065"
+	.ascii	"F\001\034\316q}ua\300l8\213)\032Rd\270\206\023\r\233\236\341"
+	.ascii	"\037\3560\035\303\233\336\201\217Z\027\246\363\336\322\223\307"
+	.ascii	"p\243\240\263\214kK\332\322\331M_\235\026\025\222o\321\207'E"
+	.ascii	"I\275\322\033\026#\305\r\236u]\342\2726G \257\336\311\320\031"
+	.ascii	"&\351HG\276\003\364\212\225\b\222\316zG7:\322\215|\234e\\U\312"
+	.ascii	"f\310\240qt\226\353\253\243\202BO\231Q\001\r\032)\027\215\336"
+	.ascii	"\"\r\017\312R\033Df\210E?\276\350\304\277\036k(dk\227r\361x\026"
+	.ascii	"xa\306\024\351\215'\032\246h\261\260\364-\322\016\213g6-\025"
+	.ascii	"\215\275\006\021_<Q\320\251\327\354C\024\315d\337\034\327u}\261"
+	.ascii	"\255\244\227`\260\334e\203\r\316\242\257\016\351\3160Jo\025\363"
+	.ascii	"9g6>\362\271\371u5\242\355\225I\244|\236\363\355g\024\256>\334"
+	.ascii	"\355g#!\262\334ek\330h\366\262\221r\221\377!-J\263"
+	.string	"\017W\003\241\206B}G\210o\355D\273m\\\375\263]~\201\206(\320>\313\356\0349up\350\240m\326\360\034/\3131\224\337\3602\334\233\033\307\341e5,\207\227\323\2545\365r\0312L\275<\246W^\026\263\324\313`\274\250a\341A^&\3438^\036c7^~\342D,\f\254\t\223%J\276\322^\366b\352\345$i/#Y\352\345\247\332\313\316d/\037I\366rW\262\227\271\324^n\246\275\274\225\366\362\232\3662\231z\227i\257\021\265\367\204\264\267H\332kB\332\253\245\366\226\220\366\022I{IH{\263\322^,\265wH\332{\225\366\nI{\203\244\275Vj/\220\264\267J\355\375\241\366\372H{\023\260\324K\225\354\355\221\354\345\221\366\216\220\366\356H{u0\365\346H\366\212\220\324\213#\331\213\200\264\367F\332\033B\332\013B\332\373\001S\257\007I\275\007P{;H\3525\200\332[\200\264\227"
+	.string	"J\275\003\300\320\313A\332k#\355\025\300Ro\r\2657"
+	.string	"\311\336\r\222\275\032\250\275\031\250\275"
+	.string	"H\366b\220\354\275@\355\245\241\366Z\220\354\255 \331K\201\332;C\355\235 \331+#\331+\201\332\033\201\332\033#\331\013A\262\367\001\265\027\206\332\353@\262\267\201d/\003j\357\002j\357\213d\257\002\311^\027jo\013\265\227E\2627\201\244\336\025\311^\004\324^\025j\357\024\262W\n\331\233B\355E\221\366\236H{M\250\275\007\250\275%\322^\022i\257\001jo\347&\337v\026\262\362\353\013\342\247\017\212)wx\256\276G\217\220\007\371\325\213p\3162\252\013\271\007\3503\372\343A\200\334\352E\270\fyw\273\327\204O\215\n\344?\316a\262"
+	.string	"\251z\361\357\031-\243ul\341\207\035\322\307Y\320z\032\363\005,\353\360X\346\345\331y\r\332\302lZG\037/J\300\213\320g\224)/\316Z\0258\256\244\2131\325\371\312\235\207\3112"
+	.ascii	"\fs+\352\013\325\r`\223;\317\3658\313\361x\217\263\363\313\b"
+	.ascii	"\347\361-\274\343#\3508\b\337\361\224\2173L\216\353\330\373\n"
+	.ascii	"j]r\230\211;CY)\3029\356\375\207\343\b\270\bg\270\3438;\2437"
+	.ascii	"\216\200s\200\333"
+	.string	"\303k\227\206\360\033\337`\347,\003\302?x\bg\020\236\362yF=\370\007y\236\266\3243\365\007\215\271%\205\246\305\203O\265\300\007w~\303\312\003\300\275\005\235_:\370\001\370\374l\331\367-\203Y\260tp\266K+td(X\210\371\320\254"
+	.string	"7\300y\351\347V\226}V\013"
+	.string	"Tv\206\013\355.\353n\266|\241\237\254\b\202\373:S\366*\313\277\245\240e\340\222P\312\305\002\\\201\2765\036\304<\207\215\300\344}9\004hd\350\312J\210\227\336\344\326\236\250\021\"\300y\020+\233\0048\221\3173\312\202\232s\034\301S\311b1\205\271%\205\202\032d\336\030\2764g9\354\201\241G\311j\201\006\205\2715\365\207\214\323<\303\034f&yb\272\220\315\353\211\324ex"
+	.string	"\357@n~2\232\203\357.\023-\r\233\275\006p\245\215s\360\242\3403*\200\333\270\323\237\263\254\306\005p'\270g\224\311\274\f\216\035\375l\227\263\322\032\277r\353\333]\036>,\013j\316\301\230[O\305=\2237ar\035a>\237)\027k\034\212\225\344\201\271\334\335\2210\243\237-C=\313\032\361\216\\\367\373\031O|\031\222\341\327\325\210\366\256\254O\036\243\331\211\030\221!\260$En\254l2?9\327\235\235e\\yNX+\335]#t\376\245\245\242=\311\275\230I\276\230K\226\244\\lB+\204\2247\366\253\241\033\233r<\001\303\254\331\211\226\337\2308\346J\236\223"
+	.string	"<\2176x"
+	.string	"4\370\006\031\\\003B?\362\256\f\016\001\360\246\021\006\007\300\005\307\200\306/\b\364\365\220\306\243\f-0,\262\253\340\026P\360\n^\204\3168\005}\235\b\321\214G%\232\200\360h'\343\023Hp\031/B#\270\004{zP0\202G\245\035\212A\310(\b\301c<p\b\236Ba\374\201@@\030'\221f\310\201@)\264\201;\300\300\0338\321p\2013"
+	.string	"\350\205\005\016%\370\242\257xG\201\277pq\005^\274\343\374\322\342.\374\364i\361\250\276:B,\366\020o\227\300Y\2548\002O\340\013\027_\236\025w\321\247\342\b\354\351\251xTZ]\340\324\245>e\246m]3t\245\270\324\215p\316/x.t\035f\2230\246\023')\027S\\\252\257.\016\n:I'\216\342\027l(\267\033\3569\3566l\342\304\0017q\"\334X\313\321\202\201V\307\264\322\342O\234\003\016#\rM\211\277a6\255$4$^;\257A$^\3427|FY\364\013\235\240\004\211D\b\241\001\337eJaNi\366\"q\342\032\345[\033u\003N\204\246\320k\264`\374\331eVi9\246\025\027h\353\272\272\340\3426\\\3071\003UVW\024\350\270\302A\344\312\212\002+\016~\354"
+	.ascii	"\002\004G\217\034L=xP\365 \022\261\372\321\003\013G\325\024\020"
+	.ascii	"\253\252*\253\034\035\260\252p|{P\335Hw\344\270\312\262\262q"
+	.ascii	"T\302\016\035@h\030a\355\340q\205\003+\255\262\272\032\201\330"
+	.ascii	"\003K\007\025\221\033G@\250\252^\002\216\252S\361*\340BE\002"
+	.ascii	"\b\254`\261Bj\t++\b\020\252\342\346\220\032bE\302\325\216!SX"
+	.ascii	"=xP\375\030a\n\b\025\216\252\251\034WC\246\244<\254U\220\035"
+	.ascii	"WSXVVWSGmM~\226\ra\fO\363\\k\204\270\256W \3405f6N\002\252\351"
+	.ascii	"C@\021?[#\236\222\327~\277\021'\230\311\310.\003J\236!\337\340"
+	.string	"\224\020?\333\356\022\030\350\211\261\274\267\270\210L\340\032\bV;\313Y;\017\256\031:\271!-uP\354\354\344\034&\366\226s\016cr\006;G\231L/\fOS\271D\363B\313>\f\250\220\351\"4\b\313\243\232G\300@<\\M^\300\254I\267}\207\r\312\237\2475bv\300\013b\265\027yy\013>\243tP\226\017\023C7\020b\316`\336Q7\266\377e\035\377\302\001-\323\270-\341\340\300\234\355\244u\232\230\271\266\017U)\213i\2721\276\225\225b\336w\236\321u\227r\377\263\204>\t\025\263v\372\351\323\353\230\363[\337Z\263\213\377\004\256}\244\273\230\307\2305\267\330\210.\214\357\220Y\311\234\241\036B#uK6G'G\331\0033$\2750\276u\311\231\311[\t/y\372uV\242\207\357\3530\322\352\222\234\275\336\177s\307\263\204~\300B!\242]#u\337\323\333$\227J#d6\304E\207\366"
+	.string	"\0171\331\231\220\225MC\207\\\234"
+	.ascii	"G<\313\036m\351\300p~?\250"
+	.string	"\023\314cc2\364\236g$\317\273\235\254\345\233e\2348\317\027E\211#\256\353\272z\200s\216\033;\303I1%\205v\322\341gJ\270\216\326\0074\027\236\320\n\311\231\355\034\224D^\0344\364\031P\206\"\3475\377\332e\347\351h5\241\331\0359;\317]G\230\356\334\365\337yF\233g.9Z\307\272\346\233\322\352\232k\316d\316t7\336\361\263\007p\203\t\315K\274\236\220\251\r\342D`]O\r?\333!\203M(.x\246\360|\303$\305L\246\b\240\027L8\373\0259\373\331:\357\341\365\274u\343\237\263\f\363F\316\353\235\354\234a\226g\3129\234\245\036.D{\303\334\342A\272\345\2710m\355\204\0339\00787Z\307\271\023\316{iE\316&\334\370\207wWeJ \236f\006$:\266\256&.s\021\334\374\332\224yj\367\214\362vv\323:\n\346\267\247\206\316B.;\273\264\373\232\345\235\005T"
+	.string	"\363\310\305\261\035ns\250=f;|\334C\250\r\317\036\333a\r\310\360\255ylD'F\217\326\031\217\225\315;\255\243\340\336zh\020\022\246\237m\215\005,\375\034\310Efq\302\302\bJf\235\241\377\332-\341\315\r\372\022\224\315\277<w\340\034\002lbx\222\327\330S\2305\315\322\317\226\310\263.\002\007\262Q\2330@\3461\271B25BXgAY\347@D\316\177L\302\261N\344\013\t\367"
+	.string	"\315:c\345M\311\005ZI\366q\323\3230\245\216\322\220\247\321\212Bkk\362!'\n~\r\r+\233?\303]\254~\025\203k\250\362@%\217\202V\251\231\021\221$I\n\315\001B\013\020\b#i\026[j\033\022\340s9\f\223N)!\221\221$I\322vb\314\030\222"
+	.string	"\217O\206.\371:]\034\035\344\334}B'\241X\006N\207\021\242\t"
+	.string	"\020\202\301k\217/\322\237u\277\322x\275@\017nj\030=\343\300\021|\252\334\202n\034\255Y\227$wqd\202'P!\330\3063\3715\312d\366"
+	.string	"\034\350\343\223\262\034\341\345\021\352\r\201\3633\320\204\203[\215\214"
+	.string	"9\245o;\246\266O\257\327^\363\251s~\234\212\310\271\230/<\243\b\314\277\274\276\224\304\216RtBB\213\341\254G\364~\226T\357L\207#\f\017\215$\177*9'\034_D=\210E\007h\301\307+2&\365\3728b|qX\276 \374\326\231\020]o\345,\332\377\343c\355:\227\035\331\254\262C\314\033\353\020<\362\016\313\224O2C)\207b\324\241\r\331\016BZ\255\277\375B\030tR\251j\241\311\202\313\270\352P\1773W\002\207\257\373\216\331n\217Cs\206!\202\025\260:\017\335?\227\207>@\200\303\256b\310\245\227\026\236\030\274=P\263\001\241wKS=\335e\t\207\267\033\023T\244\236a\335{\222\344\f\273\3406\305\313\354\201r\316\025m\261\233\b\362\216T\277\231"
+	.ascii	"\007\b\217\372\204\343\2265\366\336P\001\341SrPp\342\232(\321"
+	.string	"\"\267\210\301$^\311\241s\n\347\334\262\262w\220^\260\346\215\200]j\205t\262]_\355p,\264{^\006\242=\356\334\333\221\fE\215\376\224\311~\230\3264-\036NL\022\272\243@T\370\304\345\007\216\374\tnV\023&\264\376x\250>'\263o|\031I\342\211U\340\303\244B>\203\245\0045\023\334\243\222v\202\031X\024y\352)|\273\200\272w2\203\253\b\f2\376\1778\372Sv>\325\315$!3y$mPg`\261\003\317\227\007\244/\276o\217\032-kvY`\246E\004B\341\322\231\007\342\"\034\276\214\210\032\002\300\344<\236@m\347\004"
+	.string	"\030\372,\023#,xk\252R\247\007\304\265\373 \212\365\221$Z\224N\261V\030\223e\035\037\212\037\302>\302\327\023"
+	.ascii	"\213\024\177\254\225\205*<\246\r\207\334\341\003\370;d\261\002"
+	.ascii	":T\234p\2657\f\225\310g\232\0023#)\306I\226>\212\320g\245\216"
+	.ascii	"#\213\357o\017\305\016@s\177;*\024@\340$\245 \362)\361D\221\357"
+	.ascii	"\214\260\3279\023\221\367\035\247\207*\306\255\337\254Qe\337"
+	.ascii	"\n\200Fb\276\226?\2502Z\343\260)\203-\013\2350\f\323\345\305"
+	.ascii	"\024\300J\206:i\t\212\f\rc\356\301{N|\360?'<b\216\031s\354\355"
+	.ascii	"\310\277\355<\243\327G\021\202\250\326sI\335KHP\376\307\254`"
+	.ascii	"\303\326W\230^\355\227\211\204A\231\362\377\252\202\212!\272"
+	.ascii	">\241\263!\031\214\003\306\222\006\246U\312\266\331p\256\274"
+	.ascii	"\246\032\001\311\202\254\330\317\t\301\313y\276\211\305\200\177"
+	.ascii	"L\230\263\264\3711\241\307\005\236{\342\2622I\341\177Dp\270C"
+	.ascii	"\337P\316\376\201\225\026\277+\312\017\303\345\017\304Z\"\337"
+	.ascii	"0\016,\216l\307\n\357c\306\004\032\310\026\231\272#\023!T\227"
+	.ascii	"\"V\230\222\307\002\325\241>\265\363\356\r\3305\267f.\321\206"
+	.ascii	"6{4}\272!\t\0279\3408R\314\323>\303\237\021-\202_\235\232\243"
+	.ascii	"\271\223\201\363H\322\001\214\006\022\206\031n\364A\274\314L"
+	.ascii	"\362I\243}(\240p\274z\333\"\006\r\311\020\221\003\r\243\234\274"
+	.ascii	"&\002\367=\300\0245X\351\207\314w\363\302\275\001)\210\243\355"
+	.ascii	"\033\016D\nT\311\026\245\265P\300\223\256\200d\371\245do\320"
+	.ascii	"\352\243\300\341\273x\270\361Cr}\240ja\230\311\037\300\204L\302"
+	.ascii	"\345\023\325\201<\032\275\230\304\211\300P\3051\315\270\330f"
+	.ascii	"\256!\225 4f+f\202\356\"\376\221\243\t\363\242\n\203\034E(\343"
+	.ascii	"pFj\265]\3330\200\004\027\264\356\206\"Nl^&\322\377U\"\207\246"
+	.ascii	"\023\252\244IN\321\204pp_\004Q\220e\013\013I\021\213h\303=.{"
+	.ascii	"\206\346b\347_\036\323Gn\236\211\310\321\264\307\244^\313:\351"
+	.ascii	"\371e\316\036F \030\372\364\244t\373\035C\231\271\355#\330\312"
+	.ascii	"\323$Y\271\205\264\354\362u\324N \224\027\0364\352\003\031T\212"
+	.ascii	"\027~\324\243\177\205\005Ak\017\251\252\374\276\r\371\340\026"
+	.ascii	"\032\341\001\261\271\217\222%\303C\344,j\023\243\363\222\256"
+	.ascii	"%0\301\335\005\016\320\206\026\345YT\034\232oE\252\243\375\270"
+	.ascii	"\2607V\341\201\321'\363u\030\177l\207\266=\241\251\256m\313\341"
+	.ascii	"\205W\221\240\263\227\275\274\362\244\365\277\241\245\337,\002"
+	.ascii	"\224\f\204\356]\313\027i\200\325Cy\322GP\370\f\322\262\326,+"
+	.ascii	".\236z\223\251\360\360bb\032\330\255\316\276\366\321\317@^\325"
+	.ascii	"\005\254?\203\371\264\032\203\f\335\253\036D\364"
+	.string	"&\234\371\006\f\315(\243\024\300\254\300\232W~\354\337\302\033\233S\300\f\265\355\250Y\007\371\325v!La\341\3708\305\250\3204)3\267\365|W\022\362:\005HF\037/?H\262\360\346\327s\314d3\342M\372(:\357\003\352W\377\315\373zF'\256_\356=O\372at\f\303\245\b`a\f\233\274\233\336\260k\374\230\0361\220\035\260\321U@\311%Sg\244Ea80\023\356\364\027\fJ`\214K+\245\202\273\221X\201vpR8k\324\355\350Y\f\001a\021fP\207\356i\024R\312\331\302\346\034\256g\030\210\367\271\331\n\324RO\270l\335\316\236\224f\251\373r\200\242\2148:\270\252\374i<\211\223-\266\212\222\342\002x\326>\2244)\001n\037\342Q\263p\bWd\366C\230`\351\\\210\311!\022\035~i\335Q\346U\310\034Jp\206f)\313\242\031\3609Y0\205#\354yF\354o\242P"
+	.ascii	"\0278k\312\217\321\340\021\036\302\316\324>\255\327p\023\020"
+	.ascii	"\211\004\300L\021\b\216f\b^&\211\260\n\027\306\342\324`\231\265"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_servoTable.112.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`3\030\275d"
+	.string	"z\242\260#K N\313I\007\017\373\347m\005\312_\344\220\306\363X\247\033\026\234\347\254\242\033l~\247X\320s\253Vu\214\354\307\004\004=^\200\361\344\277^\331\211\242il\342E(\374o\260\304\334\217\037I\024\214\267\030Gwkj\275\233\224I\006$\002\364\0018\002\310\312{\254\274\306\223\267Xy\317\312K<\362\016\215\274\265\310+,\362\366\311\313D\336W@cP\031\331\232\224\316{K\247\f\306\220\332\325:k\207\373\227?\236\237\356\302\335\357\233\327\333=\256\022\274\377y\240\251<@f\362"
+	.ascii	"q\350\203\346\247\317\027?}\232\224]\316\327;;\024dwJn\267L\341"
+	.ascii	"[:\226t&\bF\366\344\331T\262{\254\003\242g\357\202\2235~\312"
+	.ascii	"\330\334\314P\024\250\304\223<%\240\320\0210\370FB\021\215\275"
+	.ascii	"\263G\022\2014v\227\016\316r\314\323\263\205\343\031\033:\373"
+	.ascii	":\255\214[\356\347\344\030p\013$\347x\306\246\r\232`_\232\246"
+	.ascii	"L\036\267\207\323\31284\273\213Fu\275\245c,\326\372\330\244^"
+	.ascii	"\247\334hT\376\033&w\263L\005\322$\225\023g\315/,B\316\303\355"
+	.ascii	"\333,\3726'Q[o\351\224\007\320\274\261)jr\266=\233\034n~\312"
+	.ascii	"\330^w\027=\013\035\234[bg\334Z\224\023\2024\232\257\334\277"
+	.ascii	"}\205&g\241\203\213\235\315?\202(^\327\201\3635\352L\303W\341"
+	.ascii	"\225\206\257\3735M\216\257R`4v\357\266,^4y\233\2233%C\204\223"
+	.ascii	"\367\244/M\337\244^\367\304\371z\036\321]\276\277\245\245\304"
+	.ascii	"\265(_p\212\3224\245\352/N{^\370\366\255\215~\203S\023\323\222"
+	.ascii	"R\022\222\206#\243\f\310\243\261x\022\207U\330O\214\356\371J"
+	.ascii	"\340\3267\034O\fM\0361\354\024\242\004*ko\032s&\023\364\306\360"
+	.ascii	"\222\322\223kO\"\326\360B\005\314\221\302\250\261\2064>2\342"
+	.ascii	"\362\fe[\030Y6G\306\307\244<)\306c\\\230\237\027*#\274hF,\013"
+	.ascii	"\237B\246\273\263A\307\023\323\"<Q\266\247\312\333<\204\0311"
+	.ascii	","
+	.string	"L\024F\341\211\201\021F}\361PH\224\"\006\310h\314KX\345GH\313\357\234\303\306\272\270\226\261r\341\325\\\304\025\2462\017\316\230\bo\246?\335\213X\032\256!\023\030f\030\343\230W3\261F\232\246\313`cT\276\034\276{\300\335U\333m\342\n\303\356\n\224\0378\352\t\fwo\340\340\203u\2670\353\352\255\275\232\373\370\353\373+\264w2\303F\333#-B\033]\301<I]F\207-s(\243\017\020\324\305\213\204\211\274\310`\006\334\203a\202aV\033}\272G%\031p\247.\243m\364\275\312\270xp\t\340S\307\rv\305\224\366\204\241\344h\200\007\017D`\205\222<\b\002{]\235i\232V-w\361\007>\366b^\367\007\004\020\f_\271\241\324\352\374\316/\205O\023/e\300\376\025=ipB\020tI\274+d\b\037l\243\270zk\221|\230x't\263-\016\354F\373\373\326\330\342\300\375\223"
+	.string	"\223bO\313)o-\037Q\316\206\247\300\013.1-\332\003.\037\221\016\217\222\"<F0,\037q\316yC?\264|D9a=\326\260o\357\267|\304%\226\037k\370z\356H\377\334\260\2419\337\356\362\031\220VF\226\246[/c\260\324\2040\315\302\202\273\177\341\203\260\366b\226H\021>X\221\341\353\273\210%\311\203\313d(\375+\2242\340\356\033\0277\332\356\253\374\274\326\266I\330\255\274\024T\336!'\357\004'\257\220\223W\202\312\033A\220#/\220/\277?*\257\217\223\267\307\311{Uyy\234\274;*\257\016#o\216\312\213\243\362.p\344\275q\270\257\225\221\027\201\323}m\034\317\267\200\343\371\3168\335W\306\311[Uyc\234\2740*\357\213\223\327E\345mq\362\2628yW yU y\251\220\274)N^\024\225w\252\362J\235\274'*\257\211#\257"
+	.string	"'o\t$/\t$\357\b$o"
+	.ascii	"'\257\210\312\013@\345\rq\362FU^\250#/\210\223\367\003\222\327"
+	.ascii	"\003\222\267\003\222\227\303\311\373Ty7\234\274NH\336&$/\023"
+	.ascii	"\222w\351\344U\252\274I\225\027\251\362j8y\217*\257\321\2217"
+	.ascii	"C\345\rJ\355\244V'\251\221\315\243\241\366\274\312t uRW\375\321"
+	.ascii	"\320F\215\324(\366\216Z\303\027\317]\361`\332\022\215\302\211"
+	.ascii	"\002\311\0355\017\252\271eh\243\206\n\224\003\207\343 34\347"
+	.ascii	"\271\371\322\335\024\213/sxldC\301y\251`\354\263\217\355\001"
+	.ascii	"\316\313L\261\215}("
+	.string	"\334\346\352\207\002-\032\306ph\224\357\245)\231\r:e\f\r!\204\341k\261\177H\317\215\330g\327@\257B\303&\366\020\316\n\257\200\246yC\257\f\331\355\375\007\320\356\257/\371\306\315R\263M(\310O\017\351N\206\265\357E\251\327\305\213\2620\233\223sY\005V\203\216\260\005\345\302\245\241\364ND\200sFd]\344h0\272\302\021\027\366\265\314\320\243wt\030O\271\260\265\224\202\250\370<z6\334E\321\320/|0a\017`\326\325L\203\267\243\027\2053\314\345\2342\200fG\313\023\354\230)\263\274\242\363\317\325\241c\264\036\b\342\2651=~\364\002\031~t\216\245\23009\372s\027\246\300\005\227\006\331h\313b\374\370\214B\372m^D\343\347V\224\240'\3500\026\341?~\364\227@\372\307R\215\271\213\202\323\276,\201\330\371\347Z\270\2359\271\3179\2037A/\tWGg\302:\260B\312_\315\215g"
+	.ascii	"\305\376\372\222GT\215\273\240ap\220\241\211c\306EH\217xs\366"
+	.ascii	"\371\331\301ys\031fI\271-M_q\230\306\365\300\ro!\223\240\213"
+	.ascii	"u\254:\202fD_\202H\271+C2\211\224\305F[\253F\240YP\311\247\213"
+	.ascii	"\027\231\300Z\3205\030\313X8\013Zf\321\023\3203\350\231\341+"
+	.ascii	"\002\375=jnI\036L\302k\302\235\215\266\037\274\223\241\025\313"
+	.ascii	"Y\301\263\352\303=\352F[5\327}\t\036n\321\024\330\n\232\246\241"
+	.ascii	"\220\231u\301\370\234\335)\256\202\252a\250.\204\224r\330^\227"
+	.ascii	"\251p\bh\333\341\32056\016\030\276\336\350\263\321s{\234\007"
+	.ascii	"\362K\377\372\214\211\274\244r\236\304&\316MJ\031CR\177\234\377"
+	.ascii	"\214Y\262\315\215rcxl.l\332)2\364\016\206W\"\233'\340y@\243\304"
+	.ascii	"BD\022F08bD\310$+\203^#)\224\030Y\202\205\204*I\026\022$YD8,"
+	.ascii	"A\202\325G\276F\216\f\031rP\304\202$7\214\033\003\206\212\026"
+	.ascii	"+X\270`\221\"\tI\226\226\225\005ZXL\264\262\254\262zdP$I\022"
+	.ascii	",#D\226\226H\n%Y\033h\025QB\265\304\b\006G2\270\200*\311\021"
+	.ascii	",$TD\264\224P\245\350\260Y\032\024\321\242Z\222\225\245Eu|K\276"
+	.ascii	"IP\363\263\231\310.\331\\\033\032\255\204\236\246 \275\302\244"
+	.ascii	"\002z\006\b\237\321\007\bj\033L\377\n\325H2\340\177a\232\246"
+	.ascii	"\251S\243-\017\024\230(\350\353\275hFg\354l\271\364\242\207\004"
+	.ascii	"\351\343\231\321A@4\375\360\252\032\312\325Q?\031\322U\315L?"
+	.ascii	"w\3052\203M-:FS\320\313^\207\270\300\254\260\0302^\25405\332"
+	.ascii	"\306\350\027]\201\222\217\336\215p\306\360\322@\277\225\270\030"
+	.ascii	"\252\2441\324\242\237\367\242\357'F\377\016F\307\360\272:\373"
+	.ascii	"\003\030=B\257\216\213~\301\325\\h\230$|:\331[.:\206\332\036"
+	.string	"\343]\335\236w\213\346?\037\360 \032\246GX\343g\317.\n\306\202\201h\333\262\350\317\321sD4(\346\302\214\276\236\347\371Ah\032\3528)\177sK+"
+	.string	"\027\251\350\025T\235\242U\350h*\024\235BQ\"\024S\255\243A0\245\332DOu\207\272\023-\205\350\352|\207\320(\007d\350D\237O\2006\321u\317\257O\200>\035\337;M\240\331\024\263\304\336 \022]bD\007\320$p\364\b\021\035\200 =\021"
+	.ascii	"4\216\006\261\027\242\241\032\200\356\260\027\325!\362\256N\b"
+	.ascii	"\020\032\345y\177\242\372\204\324\334@4TWD}\360@\364\357\330"
+	.ascii	"\275\333\002\305\244^\245i\247Xf\255\217R\243-+I\235\207Rg$\251"
+	.ascii	"?\317\317\277A)GR/\240\303\366I\037\272\311\307C\177\350\320"
+	.ascii	"\034\332\203\217\356\320\225\371\324\034\366\270\360\264\241"
+	.ascii	"\221\355\243\241\376x\225q\334\221zCW\325y\251\300\225\347Km"
+	.ascii	"\200}S\304\246\031\343y\337\001\366\255q\352;WNit\007+\324\324"
+	.ascii	"NL\275\324M}/2<\232\251k\235R/\365\277\004[\270:\355\004\201"
+	.ascii	"\353\250\2210%\231R3#\"\222\202$\311\260\006\221\005\304\030"
+	.ascii	"\306\240\263n\022\340S9\311c\216\031C\"\"#\022$HI\222$\255\001"
+	.ascii	"E\031dW\241\371\322\250\221\213\277Fz<u~D\235\275\372\247\r!"
+	.ascii	"\f\263\374w\217\377NU\241\364\007*\211\372sK\212\250\277Z\255"
+	.ascii	"-}\357#\247/\205b\325X8\244\002\372Do\372]B\2407U\022\0063\244"
+	.ascii	"\306\251\313\274S\203\366\261\217\267\352\253!\0020\314\224\325"
+	.ascii	"\212\317\206\361\323\nV\226\267\024evn\026\370\302S\342}1t1u"
+	.ascii	"\377\253\036\222\214\240\207\246\t!4\335g^\272\037\215\031BX"
+	.ascii	"\367\320#k\305bVQ\254\347\316\300\340\331lM\207j\231\030=\312"
+	.ascii	"\236\343\363k\fW\232.\361h\206\252\272\034\300\003\262\365\312"
+	.ascii	"\237\026t\250}\031u=(\322\216b\"+l-"
+	.string	"\363<g\024\317L\327XRH\217\301\250\225F\232E\347:}sECq\231\006\271\030\323\217eY\362\351\027\311\023\323p\231\231\007(\016\351\\\017\210N\231X\256<\013\376e\263\2279(f0\030\022/HB\364\274\367.u/\\dNP\210\031\232t \200B\016\217\\\257[\304v\337[W\323\205\f\177\322\216j\360\363\013}\372\233nK\361\034\006\377\312g!hq\002\307,\004\266\373\214\314\366\235\025!\213\214h\264@\3041\306\332'\325l\263\254e\036\031\255\230\224@\016\224/T\2341T\270k\234\345\342\231+=!\033#J\035C\373\343\f\212*;\302\314\037\023[H\357z \304.\f\373\232\306\013\224$E\027)\342f\001\2061\250E_\346\252\306a\024-\231\351\f{\214=\363\326\274\374TV\330B\216\270\265\334-\2717m\bO\244qBu\333\316\340\257\251\037\3462\303\030QM\312\b\t"
+	.string	"\0228\024ww\246\314\366\033\340\223>\233\271\241\177(\372x\211\3363L\026\356\264\202_k\251#\311X,\230\034\212\033\fH\220\310\n2\216\234\360\352\034*.\352\216\325/lL\341,\304I:\246h\006\330\371\034)\270+\216\234\362X\372\024\r:l\032v\305\304\207\221\353W\005\3254\0348~E]\nN\005e\b\022\337/\255{1\362\226\342\361\357\301\264\235\266\256\257\2479\024\322\321\013\260\302?\357\323\024\364\342\315p\272\002\204\002#\306Z\b\365\320\337\235\346\025K\347\346)%\333\262}\3052vh\0260CV\030pA,\352\235\362\256|\246\272cF\314\365\204n\345J\002-\372x\371\270\264\202TD\251\036\035\257\352\004p\351\251\027Z\013"
+	.string	"2\\\007|g\236\211\366X\\\312\237\032\f\324\205\325\026\001\256\r\242\306X5\321s)C\241\315\242\022\240\\\024\023C\320\351;\377\271\016\271F\340>\224\017\342\262\314\367\314+\255\370\2371\377\231\253\\\305\211\237\207`\242\200\316\032\255\372\246@\314\036^B"
+	.string	"h\2508\023\305\311~\022\356y\320\337%\264\320Z\247Z\206\202w\375c\352\206\357Y\030\367\005\234\250jm\262\353v^\026\367\301\254\205\220\2774"
+	.string	"\262G\016\021\311\fOm\233\354\367\035\n\307\232"
+	.ascii	"Q\226\f'\324\r\233\260\211`\267\317\376\247\265\327O\230\205"
+	.ascii	"l\336\204\007YQ\320\213l\313\223\243\037\234\220QB\336=\303n"
+	.ascii	"\253Y^\222\241\375\277\177,JG8<\212\355\224+\346@\331$\272oJ"
+	.ascii	"\001\250\310v}\002\370\353\322\001\355\022W;\253AINB\f,\362\346"
+	.ascii	"\337\351w\351\200\336\037"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.113.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\r\007"
+	.string	"\322\31515@o\222\016L\3750p\244\351\260\207\031`\337QO\036\306,\003v\222\300\301\354\337\324\315Y9\205\360\213\306\303\f\303\350\002\360\245\220:\020\363w\217\243\265Md\nc.\233\213\002\313l\036\347\301A\003\321\360$4\013\021\017\203m\336e\340k\"\203=\316ua\317\322\262Tb\t\221\340\203\240\017ZDl\350\004r\333W\244#\233\334\217+>\271\212Z\335O"
+	.string	"\255\212\002\036\030\037\267me\244[y\315\343P\343K%\226~7:w)\006\013\224,%s\264\261\344IUb\372;o\215\220\3209\253\3261\252\251%D\242\222\251=\344hV\227\335\206\224\002\3316\021\311S\027\240\220\231;\021\351\242c\377\202\337\340\337\b\b"
+	.ascii	"2\241U\037\b\004L8\256\211\217\021y\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_servosFilterInit.115.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"E\f"
+	.string	"\026\330WD"
+	.string	"\2216\035s\024\263G\372\247Jw,\227\251a\340c2\3159\341\013Mu5\367|\316S4\262\375Gt\310{DU\371\223\001$SUUN\360\367\271\207Q\367;\306 \277\316H\361h\367\375i\023)S\n@"
+	.string	"C"
+	.string	"D"
+	.string	"\367a:\273\343\316\246q\260e\013\270\240B\300\270\261\273\231\262t\331\335\322\354\374\215\007\307\373Jna$\256\340s\304w\262<\273\373\227'\312g\312\334x\354\256\323\373T\356x\333\021l?\260\357 \326\025\373\252[\237\316\r"
+	.string	"\026\324\367\223\032\273)5:v\025gR\\\365\333\377\304\030\275\305a:\237\231\221}\320g\361\230\356*\313\370\252\354E\264\270\244\330\330]\320\243\021`\217\236\017\270\036\255\013\270\036\003\032\207\274g\325\2227\2401Q\241\232\362G\256\324\t23N\211\3036\367\027#\330\356\211\344\273\270\214\007\037\305\243A\220\344\275G\237\344zL%p\"\246\2245>\020\232\b7s\330\240)5e\3374!j\025f@J0R Z \n\005\370@\001\002\346\217\020\247u\330@\270L\344\202\205\020\f\0252\r!\0222d\037\033\227\205\fX\333"
+	.string	"\262e\"\232\266e\035\260t]y\371O\302\025\253\222\232,M\371\340_\302\344\333\221\240\253\242\330\234\264\003\016"
+	.ascii	"6\211\244\345\212L\333\200\016\267\304\350\002\330\276*\214\t"
+	.ascii	"\245i']p/\213\335\301e\002\006<jd\177(e"
+	.text
+	.section	.gnu.lto_filterServos.116.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`E\006\205$"
+	.string	"v\177\340I\200XN:{6d"
+	.string	"\232\032\211R\3755!\205R=#\nx\364\227\312\226%\237Zhvw\250HU\373\273*\273\224\032c4\322\255\371\316X\345\1771\233}\316O\215\374\374\271\333\030\266\376S\267\2665#\226\020\"w\222\001\306"
+	.string	"\304"
+	.string	"\315"
+	.ascii	"@fF\016\231\232\227\331\323\202\242\023\003\223\200\214\307\332"
+	.ascii	";W<\b\303Y\270\311*\035-'\312\037\n\2362\205\365\251\001\036"
+	.ascii	"<|1~\223\201O\r\364\340\371\330\311\220/c\270\337\252{\250.0"
+	.ascii	"/\273{/\202\247\254\263>\035\376F}\212\276F}\332@F2"
+	.string	"g\021\320t\225\034\200a9\235\201\271\367\022\233\213\327\243\315\263j\221\357\251)\332\253E\362{>\276%S\351=\2647E5E\310tB{\356\264\300xs\311\252`WO\177L\253\243\250N\026\023\027B&\023z\363D\353\312\337n\243\230M\266\327\253\257\315\333)\246\023:\274\367>\354\005tP\275\260\266\347s\357e\273dV\235}gf.f\246bVm\374\367\334)s\254<\244\276\201\234uLV\f3\013\035\311\320z/\323\003\376\221\303\025\371^O\231\204\321~iT\237\276\003\334 K\332<>\360\214{^\213\307\334\\\262\275u\367\224\232\343\266\301\214c-\333X\3135/;\013S\3133\326r\320Z\006\246\226\177\326\262/\265\274\246\226{\253eU\265\234\366,\243\252\345N-[\324\362\003\004\277\274\230\207\372ro\213\2741w.}\373z\331\317|\276\220\277%\021\271\221\273\261hc\323\321\3066"
+	.string	"\212\324Z\021\256\265\"8\316?\255O\325\206(\210\241\226\364!\f\2076/\223F\253\214Sq}\312\027\222\304\fD{\227 O]\300\260V\034\b\337Le\362\".S^\270\370\372m\300\376Z\260\257\326\353`\377\327@\037\267\202\034{\315]Z]\225_\237\355\354chg\037\256\355\353&\023v*\310\261\347\200\235\211e\211\375l\n\262\314\022\240\241\305\211%\026\345R\"H\230`\277\254\240>]\373X\252<Nie\027\306\356\367\245\3065;\215Y\032\231\224\027.\302\276\363\303\244\305\343\323=\235\250\335\353\306\342T&\307\246\315\214!\203\372\245\332C\246Vb\001\266\033mf\r\033\354\227i\017\233Z\211\371s'\b\320\335{\277t\302\341h]M.\327\301\303\207\017\375\345\225\355\356&\243\264K\332<\240/\001\261\336{{\370I\256$\304OP\220\372\324\366\345n\274\275y"
+	.ascii	"t\317%\335iSa\334\272\267\002DCE\"4\305\261\004\021\322\217\221"
+	.ascii	"Xt4\032\217A\003\220\214?\315D*\204D\024\025C\250\f\341\301\002"
+	.ascii	"\036\006\r\0344\330\241Q!\342\302"
+	.string	"\312A;GG\024FBGD$\242\241b\211\021\304\242\342\217\221\030dtD\334\311\341\243\t!#\"\322\361hD\0046\223o\033a\377\323\023o.\331K\275\336\342\231\272\024\247S\034+\202\013;\212\341TaK\250\363B\263j\206\331\302>I\213w\364\336{\325\336b\r;\320\232\376\333}3\334\250\276|5\260m:\212\031\247_\226\340\302\306\351+\263T\273g\222\347Ls\026\0207]X\276\334b\3233k\227\201\226\372:\3305\315V\331e\311\346\361\314\322\312z\345\250q\205\366\026\007\033\330@N\271\277\375\247\306|\272\375Vic\002\200\201\250q(\305 B\310\320\214\210\310\004iAs\220\002\231!+z\021\240\235ul\244\005)\024\332\rB\t\214\365\267pu#\314\364\177\241\001\250=\253\204\257c\"y./\217\241B\207\351\207(\341\2107]\345\202\004\266H\300p\355d\263\306\357.\277\234\226"
+	.string	"5\317=\312\303\322\237\263\350(\274\021-\311D?\016\306\301\267\213\361\022\306\203:\215\f Yp\320"
+	.ascii	"\030\340\277a')\200\240\236q\3346V\t\201w\262_\016eA=l\001\320"
+	.ascii	"@#\375S\243\031O\3046\2278\326\210\026=\2069\250\300\355\313"
+	.ascii	"\033\365\001\273\374\233\244\277e\265\\\301\2625\311J\001\234"
+	.ascii	"B7\034\277\0227_\3675{\345 \320\376\326\220<\"$\2418'\t9K\232"
+	.ascii	"\354dx\300\2230\242)\245\260\341H^~\343M\344+D\312\3072\3717"
+	.ascii	"\374\205\252)\212\002\253\342\256\216\244eNK\363f\030X\260i\341"
+	.ascii	"B\247\337o\331i\374\017\337\216\304\373\215\241\002"
+	.text
+	.section	.gnu.lto__reset_template_82.1.119.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.184.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\234\002M\025"
+	.string	"\026\351\215J\260\022R: *\354O\300\241\365\347Q-\200Df\006\273S\034=9&y\336ePB\2578\bQ\245\027e\3637\374\266e5<\"m\205]6\001\311\203\376\f\226\364\024\"\2536o\224\327\277\306\333\026\031\307\037\221M\344N)r"
+	.string	"{"
+	.string	"{"
+	.string	"\304Z\253\312\251\r\264N_\027@\236\216?!O\315\363&\257\364\240R\324Z]\323\007\326l\227\017\264\331\256\323\253\260]\333\331f\363x\351\253(?\241\037a\261\326\032;]\022n},\357\235\266\217;\251\315?\360#:^\317\307Qdh\247\243\204\207\033]\256z\200\270\3603\210w\233K\362\353\360yr*\362Rku\313\303M\336\366\214\355\030{\306\b^\352r\225;\341M\262I\221i:\222\323K\247\3478}\222\331+`T+Q\326\220*\202J\231x\360\023\245\364\025\355`\324\2743\326^\351+\272\023\020\325\212b\305\225*.\376\202\307;\013\264\3416\202\201O1gT\254\265\214\235\272l\255}\363\374\311\367\321\223\341\007\337\344\013k~\341\312\312\333\245D\261<x\240\357\224\"\305b\337\311/\317\302\366\026\236z-\252\347\340\373\021\005\273\373"
+	.string	"\302\274\316\257\334\366\330\307\221\241\244Jg[\3477\"\300\252j\255.6>%a\002\f\fyJ\367\272\017sw\277#G\274\315\254K\311\264j\305\265\3705\036E\343/\235\272F&#O\347^\370\361\227#Hu\004l\"\371!\375\351&@~\210BL?\374\031\247Q\301_\362\315l^w\352\317\310\323\357H\3576\263|\341M\252\206\277a\235X\336/\324P\220\250\271J\001\266Y\320\202\200%\301\212\202\025X"
+	.ascii	"\r3\016Z\226\201\341\314th48\261\034\233\032\231\005\n\261\013"
+	.ascii	"\262\230\233\230\f\r'\006#\340\031\006\032Z,g6\243\305\\\266"
+	.ascii	"\3477\311\007\376@C&\252\333\372x\307U2-AU\016\300j\222;n\220"
+	.ascii	"m\267\356)r\334\006V\270)\304\027\236\242@\032\367\3456\326Z"
+	.ascii	"\353\256\222mr\037\374\3536\261|\340\343\222\373\334\221\317"
+	.ascii	"\3142I\034\206\0300\037/ @\002\302\034\245<\373pl\217\264I\351"
+	.ascii	"/S\267\017*\273l\330\266\302\325, \205T{\360\33560J\246\214,"
+	.ascii	"10W\236O\363\250\304\266\300\271nl\204\206\316\315\300\2155\221"
+	.ascii	"$\336\243AV\007\300X!!\272\271\020\261\r\237\b=\356\343\337\270"
+	.ascii	"\207\210\353\276\202\2210\bM\204I\006h\246\354\f\274\255\t\337"
+	.ascii	"`\327'\315u\242\337\245\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\036\005\335\030"
+	.string	"V\246\217I\200XN:=7\002t\341\230oL-\216=}\bPLw>\355C+\274\207\033\210\221\233\270,\346\332\334&O,\023\033P\305\212\275\271\234\377\377\377\377\177\017\b\300S\371\300\201f\245`.\013\366\340\034:\352\327\016\233\310\024z"
+	.string	"\177"
+	.string	"z"
+	.ascii	")\207\207y\362(\265\266!\177\214\251\341Tp\206+\2670\344\313"
+	.ascii	"\231\027n\006\337\324\302\325*4\017L\341g\270\300\257L\350\035"
+	.ascii	"\022Z"
+	.string	"\005\352\036\021\032\nB\023\321~\372\351\025?h\2478\007\371`\b48\035fp&E\224r\013\362\275\230\037\372\334\nNU5\365R\220\377\305\274\177\257i\360e\260O\222\310\225 \037\315T\303\276\376\374\233Y5\2004M\323\236\3742\363?/'E\227\"\343S\260\360i\370oJZR*\022\022%\005\t\221\016\274\327\247\030\257Bt6\030?\016=\213\320\215/\216t\3615|\323\240ki\221/\206E~rE\247\230,\352\310PE~\234\2713U\264J\221\337\305D\3613\370\304\267\364\0202Ng&\362\341J\034\212\031\261\215D\376\333\210c\301\"^\207C\344\273\201\310\347\222~\335\345r\271\374\220\337fzh\252TUW\257\016\271\273\314\033oq\256\021\333\003\272\304\202<\354wk\332\027\177\267\217\355\253S\255z\277\333Zl7\326\326\334\325\303zW\250\005\256W\322\2737l\373\234(\301^\354\335"
+	.ascii	"\310\276diO>P|y\310f\321{yl_2*\272\263\237\276M\371w:rW1\345"
+	.ascii	"\226\312\221{\nG\276\335R\356(\245\334\303\244\374e\247i\372"
+	.ascii	"\003o\344\3175\322\217\020\330\350"
+	.string	"\251\361&4\376d\306\315\214\036%\357\254\366I\022\271t\f\334\326*vc]\331\031\301\347m\"\255Sg\035\273\357\340\224`\367\274\231}\361\274L-z\336#\266\233\255\025\222\004=\257pm\023\r\310\320\r=\357\320\nD\356\25497\354\257m\033\250\037H\320\363\372\320\363\326 iZ\364\274\255\342\234\027\350w\336\233b\323\030\325\214A\236kSl\001oUeA\236\333\353\227\004}G\343X#\201c:\027\303\271\2745l\250a\f\b\364pD\223\222\244\334\240\002\241\251\252m\021\320\244\244N\215\310\004)hAA\007\200\260\272W fpxg))G+\223\250\275jh93\265\325\270\"(t\351\f\353+;\334\257jUD\201D}\036UI\201\332(\343\204D\335\3126<\373\\\265\216\276V5\324/\"a\211\246j\034?\360!\340\220,\233V\331\266fomd\252\377q\245N\323\250\251\016<"
+	.string	"1E\344a\302s\304\203h\251C}\265\260\017\2030\265\310\250\255Y\027\006\314\253\322\273\232\213\rY\232j\22402\256\2621\"\230\"^T\256"
+	.string	"hFY\270\013\004\345\f\262"
+	.string	"]F\256\354\323\354"
+	.ascii	"\342B\226\0042\221\204\214X\2722\3635\355\364\004\226\"62\317"
+	.ascii	"dI\357Q\272\3733\003\342\017"
+	.text
+	.section	.gnu.lto_.refs.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`\371\001=\020"
+	.string	"\346bgD"
+	.string	"\221(\215\001\276\330\362\273x\272/7G\254{|d\314#{9\255\216R\025\240\\giPUUUUUUU\235\nT\372\037=\3075P#\t\326\367P\017\364lF\032\211\021Y\322l[R\371\245L\001Q"
+	.string	"Y"
+	.string	"S"
+	.ascii	"*\030*p\237\022P\266O\007\333\337\332\374\227\030/\\V\240h)\261"
+	.ascii	"\361\263\342?\302\363\203\320\336D\373\222\215O\305Ge\037b_\352"
+	.ascii	"<){\017\354\275\316\203"
+	.string	"\262\357\260\367p>\343\274\206\363\273Y\263\032\213\257\327\031=\356\353\216\3217\252\231\2573\002\020\036l\236\r\030h\237\013h\274\300p\261\277\013\013\025\332\237\342\204\3507\261\371,\356\027\301\002\372\023\356U\233\247\270\017\211\017\202\276\304=\2669\307;tZY!<\304W\016\240W\r+*\334\253\205\356u\302'\327\224\315\025e?[5d\264ha\371|~\370\344\331!C\237\302\274\024>\207\367\332\226o\300\217]~\201\237\361^M\177`\213\272<\324}\367}\267\345\235\357w\323\265\313S\334\263yf\3123\246\034S\n\220\371\342&\305\317@\037\271=\366z\005\360\bs\270y\210{\017\367\261C\317,\307unX\331\013\024R\"\004\257&z\251\002L\002\375\024\201\246\036PNW\030\003*R\225\nH\221\374\2267\211\335?\331_\355\223\354\243\366\277\220'\355\217\256\357\366\265}\2157\210\266\n\374\221/\377"
+	.string	"\177\364\345\241/\337\276<\373\022\025\013h\211\222hJ\t\350"
+	.string	"\035Q0.\022\346 \341\0011 \240\242:\013\365\034\f,B\030\327\016x\222"
+	.ascii	"M\033\270\246\307\220f\\s\316\351\336\f\326\335[a\r\200\031c"
+	.ascii	"L\223v0v7A\204\225U\255B;\032kM\230\254d\267[!\266\225\351\355"
+	.ascii	"\341fPv\345\346\2651\3370l6\271\331\301\215\311&b^\215ar\333"
+	.ascii	"m\005\266\333i\254\tv3\006\232\270\265\250\031"
+	.text
+	.section	.gnu.lto_.decls.fe8126d2a54b96f1,"e",@progbits
+	.string	"(\265/\375`|Q\335\\\001\232On\200U LI9\351\272\353\336\347\334uWELL\344\373\234\314\251\253\252\250\276\231\271\231\271\335\273\331\3552\377{s\377\307v\215>\360E;\217\214\374\nTc\260\023~\273(\274|\271$1\260\221\331\360\2138\222@B"
+	.ascii	"\002\202\355\267#\177gn`\357F\310\336r\247\346\006\367\007\036"
+	.ascii	"\bh\355\325>l\024+<E\312\233v\021\203\314V\007\371\207\204\360"
+	.ascii	"\355\020\343\327.\254\264\302Z\254\315\372IS\351fO\351(M\326"
+	.ascii	"L\332\331U\372\254\221\264\222\226\322e\355\244\227tZ\257u\223"
+	.ascii	"\206\322j\235\244\307\252\263\321:\354m\244\217\374v\013Y0\236"
+	.ascii	"\225\216\006U\245\273\361%\365\234\312\361|r\225\025\326.\252"
+	.ascii	"l\364\f n\332\005\325\215\247\232\2168a97+]\216\277\260\006\373"
+	.ascii	"\207~T\264\276\n\005\253*\254\321\232H\027\361Z\363\3149\267"
+	.ascii	"\213\027\225\215\207\351\223\237\240tL\371+]\243\265\214\030"
+	.ascii	"O\022\376J\307U\271\300\t\313\271I\267E\306EX\331?4\244\242\361"
+	.ascii	",}\262\223\0306a97\3370\376J\327h\255e\001.6}b97?\b}@\273t\261"
+	.ascii	"\0333\302\355\271\032\224\202\200\207\273\b\032\020\311_\f\274"
+	.ascii	"\276G\323\340\243q\370\350\032~Z\rJ\2176\361\3210\374-5(m\036"
+	.ascii	"\375U\235\036\272\307\273\253\276=\370\324\314\316\234\233=\301"
+	.ascii	"2y8\322\372\036\365\201_=\244=\177\177\177\177\325Cz\024\007"
+	.ascii	"\276\025(=\n\205\177\307\340\337"
+	.string	"5\374;\206\205p\340_+\354\241\006\245\277P\370\326\r&\312\303\267g\360\335jPz\033\006\337\276\341\3331|\273\003\337\306\300\3578\370M\006\277\271`\021jP\372\266\2023h\251\026O\250\264\244\242\336-\236\032\314]\016\276\2765m\350\035e\335\262D\371A\365\023\272\306\310_\233^\276\237\376f\266\323\006\247\271f\337:W\203\322\013*P\332y\350\275\354\"i]\272\364\335\371\213\223\266\320\341\004\003\3475\316\333\032\273\320\203\323\327\267\372\r\275\302A@\020\036d}\355\233\276\332\344\032\203\363\302k\337_\371\252\233\212W\271*\250Pk\250\372\3726W\rJ;T\240\264\356\r\275\276\300s5vF\245\357O\3253\203m\324x#\245M^\r\363\207\265\326y\257x\225+\347*9\347\nz\364\226ie\372V6\365Y\235\033\352]\356\251x`NW}\337g\330\0049\327\ri\375\373\253\033\322\277\256\331"
+	.string	"d\362\246\243\207\032\fz\2325\250x\364\375k\0324&\236M*}\317\344,\243|m\351\373f\202_\2414+\232m\206\001\247x\245\371+\231jW\353j\231\352\254fj\230W\272*f\212\231JE\n\232\001\374C\257f\252[\235\263M7\tH9\363|2\202\204j\246\216\251h<\313f\256\002z\251\301\332\023\372\360\341\003\317\017\277 S\030\356+\034\\s\rJ}\330`0BU/\210\2218}_\345\360\007\200\005\2678#{\346\334|}\373\207\274T\270\032g\233a\301\026_e\317\234\363\377\372\245v\251r\325Y\275T\027^\333\352\224w3\347\247\234\363\253\332?\364\352\245^\251l\266\351\226\237\234\350B\320\305Y\303\302\227s\363\303\007\241\017\250\025\0162r\370\326\270\312e\205\\\001\316z\232\252\321w\313\255\361\345\213H\337\327\037\270f\031z\325\002\224Ze5sZ\316\271'"
+	.string	"V\340\336\372\002+P\372\332\205_\257\360k\306O\342\fjP\372#\326\251@i]\253U\252\323\203j\3455\255\252\035e6s3\347fO\007\201\243&\245\357U\340W\017R\373\367W=H\257\002\366\251AiW\240\364s5(\255Q\252YubP\317>\202\204\333\245Y.\313\271\331\263\023g,\316\233\276\227"
+	.ascii	"\326!\372_\001]&\341\032\360+\006i\375\253\030\244o\374g\rJ\317"
+	.ascii	"W\203\322\332\244\226y`\245\246\270rZ\316\315\037\374\204e\255"
+	.ascii	"\254\357\2335(\305\025(\375m\002\256j\007\326\352\357\264\352"
+	.ascii	"\267T\031\270F\376\312\254RQO\177\253E\252\305o\t\020\3657\372"
+	.ascii	"\267\n\026\352\377]\007N\201w\360\016\377\325\361\367\007\326"
+	.ascii	"\330\032\336\3011\374\267\310\337\037\200\272?\232SO8\025\371"
+	.ascii	"\373\307\242\350\340\357\372\003k\264'\370\005\226\004_\300\177"
+	.ascii	"eT\260\332\345\257N\277\035&c4E\375\025\352\267E\326\202\247"
+	.ascii	"\277\262\250+\374}\200\023\277\335\300\351\257\027\370+\007\376"
+	.ascii	"\212\342o \313\374\253\004\b`\2275\375[\204\303y\034\233\377"
+	.ascii	"{\320@{\002\241\016\376.aI\360\263\273j\237\342\277\027\b\200"
+	.ascii	"]a\202\233\371\300\032k\220s\360_7\002\270\013\370m\005L\377"
+	.ascii	"\357,\0078h&\005\376\013m\360\200\352D~\340g$(\301/\260\312\377"
+	.ascii	"(\016\200\377\352\375\375\2015\376\275\242\216\200\213\345@'"
+	.ascii	"\255\022\363\f\305\005\360\3370v\330F\013\201\277\222\240\226"
+	.ascii	" \351\377Y\023\020\034\350\277\\\232\203\365\340\257\035\034"
+	.ascii	"U'}\3647\222U\361\367\216%\376\315\374\217\242\006\371\177v\241"
+	.ascii	"\377\256\325\026\2775\362\340\267+t\321\224\277J\375\266\250"
+	.ascii	"=\250`\335cS\374\225\371\333\341_\345\376^\200\235\300/\370_"
+	.ascii	"\201]\341\267\034h\017l\370\257\223\277\223v\003V\003[6\003\026"
+	.ascii	"\003\366\002\177\305\362\327+\177#\177\376k\367\267\214\017\376"
+	.ascii	"\346!\201\277e,\340o\027A\177Sa@\200\277m\374\225\305_W\374\225"
+	.ascii	"\205\2776\3755\371W\344_\231\376\352D\017\200\202Ea\344\267*"
+	.ascii	"T\030\026\205\377\034x\360\267XH\330\tX\t\234\031k\t\330\276"
+	.ascii	"\363\243\\\376\217\371_\346\277\231\307\375\377B\346?\230\243"
+	.ascii	"\271\316\177\t\360\367\225\277\341\376v\341\357\267\277\333\376"
+	.ascii	"\306\362\267\026\276.\373\333\312\337U\376\266\340\267\021\370"
+	.ascii	"\337\363\243j~k\342\267\n\370-\321oE\370\255\207\337v\370\355"
+	.ascii	"\005\277\025\372-\320\337\177\177\303\371\373\315\337|\177\357"
+	.ascii	"\375\275\346\3574\177\217\371\233\356\357\270\277\267\374\375"
+	.ascii	"\365\267\216\277q\374\275\365\367\214\277c\374\375\342\357\f"
+	.ascii	"\374\r\365\267\t\376&\301\337\"\370{\305\337\312\277\227\376"
+	.ascii	"6\376\235\364\367\007\376.\376M\374\273\350o\017\374\315\201"
+	.ascii	"\2775\3607\212\277+\3607\n\177K\340o\023\177?\340o\007\374]\342"
+	.ascii	"o\022\177\037\340o\003\374M\364\367\b\177\217\370[\204\277C\374"
+	.ascii	"\r\302\337\037\376\366\340o\016\376\336\340o\016\177\013\340"
+	.ascii	"\257v\177[\360\327\021\374\325\371\267\206\277\201\376\376\371"
+	.ascii	"\273\347\257/\376\336\371k\214\377n\376\337\375\307\373o\345"
+	.ascii	"\377\231\277s\376\016\376\265\203\277\323\277\242\371+\230\377"
+	.ascii	"(\376\372\345\377\331_\343\376\312\345\257[\376\252\345\257h"
+	.ascii	"\177=\373\257\302_\245\374\365\310_\215\374U\310_\177\374\265"
+	.ascii	"\352\257S\177\205\361\327\022\374u\370\327\016\374u\002\177\005"
+	.ascii	"\376\365\376\217\363\037\205\377}\377\333\374\317\373\257\346"
+	.ascii	"\177\232\377h\376\227\375\027\301\377.\377\005\360\367\367\367"
+	.ascii	"\367\353\244\360\353\024\371\013\240\024rw}\317\363\005\237\307"
+	.ascii	"\n\016b#\372M\222$\016\210D/IS\n\0162#\372=r\244[\334\340Sf\226"
+	.ascii	"\271\345\234\005\"\r\363\325\007\246\357y\306p\320\022\242\337"
+	.ascii	"0\347\r\353\026\367\311,/\027\260\314\263\022\303[\362t\260\365"
+	.ascii	"=O\r\254\023\207\350\227\b\221\032\207D\032\027\323\b\021\222"
+	.ascii	";6x9k\\\324\r\351\373\0356\270'\016\321\257\020\347\025R\331"
+	.ascii	"H\200q1\231\035\220\354X\363\204/\347"
+	.ascii	"- Z\t\231SH\337\357@\301\036\320\370\361\343\002qrw\201\320%"
+	.ascii	"!B\245\357w\222\340\013\344\210~}8\257\217\332G\002\214+ce\200"
+	.ascii	"\344\311\246\217/\347,\020:\313(8[}\2773\004s\370\372\252hH\200"
+	.ascii	"\345|\245\001\233e\316]\0331o\372~\307\006\376@\207\227W\013"
+	.ascii	"o:\177X\003\031D\277;\234wG\315\303PR\231i\244\003\223\273,\020"
+	.ascii	"=l\332\364 s\203?h\201\003\307\325Qs\3169+/\357H\320\nc\345\341"
+	.ascii	"\2779\252\363\352@\233\\i\266\320W\247\f"
+	.string	"\006A\345\326\2705\356\226OvJ\323\367\354\311\"\363\343\313\265\361\273\025$\223\326t\322\367zW+\310\314\313\302q\265n\026\216\026\226jg2\214\037F\342n\0135L\221\031E\332\372^\307\r7s\334r\250\315\350{el\300\320\266\226u\325\367:d\370^}\004\t\271\314\211f\307\227\276\327\t\202oU\022?2\271\357u\264\260\220K\325\223\244\212\007\227\276\327\241\302\032|\021\375\302\250\316\013\243\341\004\245r\306\032al\007\223#|\331\312\n\304s\336\\\027A.\033R\230}\237\223w\245n\213\033\325dtb]}/\024.\362\244\361B\337\347\214i\263\366\3149\337m\271\345\234\237O\252<\363\006\260F\256\312s\357M\315\022+\317\2343\233\267\325\271\264\032\226\245\212\033\033\347f\013\3472\257\223}s\227\367\311\366\331\277\352\264~\366\005\274&nzo\343\t\346\274e-\314\317\362\275\215\347\251\231\205"
+	.string	"\355\336\236\204\361}\370\240\303e\214\335\f\241\373\2343\374\234%\3709H\360s\302\360s\206\340\347"
+	.ascii	"\301\317\361\201\237\303\003?g\007~N\016\374\234-\374\234,\f"
+	.ascii	"\202\tQ\035\2536\314\355\031\213\306\302\2509\312\n\003^@\236"
+	.ascii	"\331j\006\210\347@a\0205\210,\235\025s;\346c\254\035\3169/\233"
+	.ascii	"\271J\b\311\035\223#|9+\313\003\360\305\023-\034fn\355\276\246"
+	.ascii	"\351\264\252\270\364\275\236\255\373\037\344\301\312AUg\313\254"
+	.ascii	"\201c\276\360\"c\027j:\256\310\330%\017Y\221\"P}\217\001\013"
+	.ascii	"\376_\337\177\232\231V9g,\264\231\255\234t\322\277\276\242\265"
+	.ascii	"z\370w\252\255\032\374\277\017\001\205\234\231i\300r\316\265"
+	.ascii	"\rF\322\306\334\312 \243sVR\316\256%\211\256\253\247\256\026"
+	.ascii	"\244\234]W?R\316\256\274|\"\262\374\261\312]K)g\316?OOK\023\270"
+	.ascii	"\256\244\234\314\374#\345\314W\031\212\356\252\346f\3272?q\345"
+	.ascii	"\237\374\224\231\331\311u\225\201\324S\327\225\224\223y\365#"
+	.ascii	"\345\354\272\312\316\256\354\223\237\230V.\236\262\325Ovv\335"
+	.ascii	"e'\327\225\217\224\223\353J\312\331%\244\236q\201d\017\253\016"
+	.ascii	"\354\313J\r#\365\224cP\335`Z\371\314I5\271\262\231\234kZT\266"
+	.ascii	"\312s9k\220\363\r.+3\314\026\252\233\323\\\f\247*L\256\332\314"
+	.ascii	"9o\240r\362\342\312Os\313\232\347\244\222p\345\234\304\t)S\345"
+	.ascii	"\234\363\b\313\346"
+	.string	"\\\376Q\347\226<n\344\251\250\234\001\220\2339S\345\274\254y.\347\274\3149\003\255n4s\266\341#\025FE\225s\226\020U\276\261|\213\312\271\323\316\270]I9\275\270\206\336\320\234a\271EsY\245\246\270rX6\323e\205\235\313(y*\347\\\363p\330\225\f\274\276\307\240\205\177;g\301<k\214\271C\341\316lD\365\265_r\306\210u\345\365=\206)\354\345\226Y\343K[\227\366\313\270\2159W\005\355\254\031D\363\243\006\0274\340\020!l\236[\264\240f`N\352\254\332\255\226\337R\261k6\213\216\025\263\346\204\255/\\;YJ\351\365}\360\017_\261l\366\315K\355\231s\363\212\255\"&\rkO\314\005\213\245:\355\025k\345\303\007!\314\245V\265\226\276\271\371\341x!\366&\330\243G]n\353;\266\252\374\243\357\203}\370A5\370A9l\201\r\253@\251M\033\272U\323\3113\343\034\353\013"
+	.ascii	";E\357\206\331\261\007\004\355gnL0(\23516\332\274\265SJ\037\224"
+	.ascii	"7G\372J\371\177k\246\303e\225\237\360\352\354\316\372F\001\333"
+	.ascii	"\223r\352\373`\026\374\337:\261O,\224\352\264M\273\244\212\022"
+	.ascii	"19l\323&iZ&\266\254\203\222e\020\2565jd\360\375mY\023{%\016\336"
+	.ascii	"]_\262$`xX\372>H\004\217Y\261\226a\367cM\337\007w\340\007\267"
+	.ascii	"\360\2032\360\203R\370\370\017\377\026\211\0077e\234\304\216"
+	.ascii	"\030\t\226\301\350Q\303\206U\2475b\213|\004\t\257M#\226HE\253"
+	.ascii	"sY\331\326\205\361\221C,\347\246\320\207\03460?\032\367\036o"
+	.ascii	"\301\307X\206\b\221ZR\225\373Z!6\3105\343\332I](\202\345I\337"
+	.ascii	"c5\374[ `\306\272\270\372Z0\3335\366\264>\354\227\355a\177T\247"
+	.ascii	"\005\263Y\267^\226\307\205*\335\225\245A\024e\025\214\001Uf\301"
+	.ascii	"\354\2162\013fkX\256\013\234\2442\323+\003-al\372\202~~qd\030"
+	.ascii	"nm\326\240T\250\002\245\307e\370\230H\016\253\003\007\020\210"
+	.ascii	"]\213\270\276\307[9p \301I\245\331\033\2678\330zb\320\311\315"
+	.ascii	"\350k[\260[\377\203\300\"9\232\224mY\033qjT\306\232)\227\237"
+	.ascii	"\231\275\352\264Z6\253\231\205.\2263/c}\217]\340\353U\264\377"
+	.ascii	"A\324k/M\033\034;\243\311\f\261\271\276\007\236\301\257N+\303"
+	.ascii	"b\021i^\201\352\373_\357\026\013M'_\220cw%\346\244\357\201q\370"
+	.ascii	"\267V\266\352\302!s\"\243]\330\030\025\257\366\330\2501\244o"
+	.ascii	"\337R\t\355\240\361\373\"\327\367\267S\026F\212&\231J\337\027"
+	.ascii	"M\f\\\304D\315\350{\240\025\374Z\366\027g\241lnKS\361\234\266"
+	.ascii	"\300\260P]W\361\274\270<\255\223}\262.l\224ma\245\252\323B\331"
+	.ascii	"\345m\346\3744\243\327t\001\263P\226\351\345\231s\006>\271j\023"
+	.ascii	"\206\347\036H\206\017\034\202\017\304\201\017\254\201\377\216"
+	.ascii	"\003\247\212\223M\335\0302]\246\375V\270`\316\270\266\276o,\233"
+	.ascii	"\032K\252\372\036\350\002\277a\340U\264!j\200\244i4A\302\332"
+	.ascii	"F\235\220\347S\307\263\257_h\276v\323m:\257\367\252\263\365\372"
+	.ascii	"\3565K\267\360\272\246\3218\375 \241\365\232"
+	.string	"\rX0\306\031\323\311\347\036\b\205\237\362\341\247g\360S9\374\224\013~\212\005?m\303m\246\355\252S\250\317\3209\305\270\321\367i\032>A\256B\351\377\252P\372\324\211\201\271\006\245\177\212\031z\217I\343\270\201\221\326\267\207.\f\363\305\235U\313\275\303\374\r\246\347\336\326MJ\360\330\364\265\271\006\245\"T\240\264\277\f\275\345P\255.;\202\364\315\361\022\227C%,\217\255o[\303\3610}r&\322\366\354\322\\\252\263\343:\256\265\364\226:\007v\311\324\2369\347\017\033>\\*|^q\351\026 \226\013Q\256\364}\332\304\257joV\302\332\205\316\322X\252\223\255a\274\271U<\0364g.\266\260\234\363\007\320p}\245\342\3610\233\331\n\303\217f^\016\276\234\363\007\241\017\037\220O\276\336\340\373\264\013?\275\201\237f\341\247W8\265\202\306\263\243.\312\256o\245\25315\364\0169\236\346HyT\263\\E"
+	.ascii	"\2547xb9gy\300\360\244u\227#\365z\312\003x\304n9\244o\332u8."
+	.ascii	"\2646\255\276\351\216\034\033>d\254\365M\271\360\0335(c\372\246"
+	.ascii	":\210`\016\200\330\260\221\336\3200F\327\267\205GL\217\0270\322"
+	.ascii	"\255\2477\234\224\b\261r_\354"
+	.ascii	"\210\251!\243\325\367\02501\007M\032?\2154\253\232\345\252z\006"
+	.ascii	"\007F\037_\316Y\036\200vn\330"
+	.string	"\232-Tg\232u\275\250\262\266\276i\215\212\246\325t\361|\233\022\2661*}OA\033\334\301\024\321\377t\371\024\352\257\316t\231\312\260bt\362\322,W\001\327\310\366\372\370\262T\226\007\036\030l\272\276\372\376\351\324S\031O\261F\220p5\306\036hh}\323\253\327\037yhR}\237V\245V\1770h$M\2258}O\001\034Nc\204\200\243o\207_\337\247T\377\203\030\300\350\206(\351\333\365pi\n\243\251\256(\301\3217}q6\377\203;U\242\200\335\350{\275\324\305\377\240\225\363\022\343\3247\215J[T\347\273\244Ro\366\360\\i\241\326\245\357)`\303\257\357\222\236\240\276K\232:=}\372\203\301+9\276\272\372\236\0024\374\247\314?\b\244Rf+\254\357)\210\202O\001\031n,\242\243\177\177\355\203DZf^y\340\202\205\207\3673d\216I\337S\340\002\007\305\021\035\205\003\007u\272\313f\256\322"
+	.ascii	"\345*\317j\310\315J\252\357\203\3640\005\\\210\216\366\241}\350"
+	.ascii	"\033\022i\371\366\340\202\265\307\227\255\266\200\340Q\203{\341"
+	.ascii	"J_\364MP\035\346`\203\350(\037\312W\321\\\246\225+\205\215\231"
+	.ascii	"\326\367AY0\207!\317\243{OtKj\265B^k\303\327fed\344\372\242m"
+	.ascii	"P\275<\274\273(\230\003\031\321QtM\303\201\321wP\214\320\365"
+	.ascii	"}\320\027\346`\245\314\3214e\310\244l\005\263\242<E\351\213\236"
+	.ascii	"A\321\330\231\251\013z\2019\304\021\035\035\203\216\271M\022"
+	.ascii	"`>9{\305\245kr\220\241i\2039\250\361r\224\316\013\272%ETP\214"
+	.ascii	"\030\034\317lu\003\004\256\361\345\tX_t\016\r\203\202A\345\320"
+	.ascii	"/\032\300`\016}DG\343\320\270\213um\3169\322\270e\253,\020\265"
+	.ascii	"\310\027\r\031}\257\301\n\326\200\312\307Q1t\f%\253N\324\007"
+	.ascii	"\272e\310)3\177\200\300\344\255\306\320\332\003\353\253\005\b"
+	.ascii	"Ck-\255\35754\361kY\023\324\211\231'h\331\005NR\020(\003\363"
+	.ascii	"\214\202J\251s`$\226xy\236\241V\352\\\226O~bK\363\206BA\313x"
+	.ascii	"\226?9\363\220\013\303\202fA\341\320+\250\033\352Bu\242o\250"
+	.ascii	"\363\350\030Jv!\364\rmV\266:\007F\242\354\3133\247\214^\2219"
+	.ascii	"\236\333\344j.p\222\202\300\2233O\324\n\212\206V\251sY\315\214"
+	.ascii	"\225c\345\b\335\036\037\312\206\266U'j\345B\315\234\3236\354"
+	.ascii	"\274\261\343{\222\336\037\255\262\246\343\366b\253E_\224Juv\201"
+	.ascii	"\301\243\3575T\341\037M\253NT\255\305\0218D\372\242S\256\306"
+	.ascii	"\305\362\005\f\rS\370\032\242\360\201\334`\324\f\223y\342\220"
+	.ascii	"\353{\240<| 6\370@g\360\201\350\360\201\276\340\037u\202\226"
+	.ascii	"9\343\332\310\225\211\3712\345\324\367@\\p7kP\352\241\002\245"
+	.ascii	"h\022t\t\312\344\017\366\220\271\365X\353{\2407|T\311\377 \005"
+	.ascii	"\200\200Y\353{\353\341R\364\310Q$\177\260\273\024\t\243\352{"
+	.ascii	"\240*\370h\030j\344\017\362\230!\242\026\245\357\201\234\370"
+	.ascii	"h\221\265\2776Z}Q\"8\nh\211\007\030p\260\351\330\002;J\344\357"
+	.ascii	"\214\376@\207\210\340\017\316\013}\321 \250\220\243CP \350\220"
+	.ascii	"\021\270rf\242Cz\374rf\366\324\312\241V\016\227\314\253\b\225"
+	.ascii	"\364\036\310\b\276\231\032\224\326\266\241\243`9rY\236P\372\036"
+	.ascii	"h\013o\260\243:\321\035\350\327\027\230=\363\252\342\345G_\224"
+	.ascii	"\307\217v\241^\355\267B\034\031A\276\372\332f\rJ\211\200^\340"
+	.ascii	"\r\232\350\320\221\365\006k\340\206\003\307\226\ff\260\006]j"
+	.ascii	"T'Z\003\335\202\200O\316^fr\260\256L\031\321:j\343G[@\263,\032"
+	.ascii	"/SD\372v\327\320Q\255\313c\257\352H\337\316\252A\351\006X\360"
+	.ascii	"\006e\254\252\023\265Bg\b\371\344\374\325$\f5\303\206\214\033"
+	.ascii	"\254\2432~\364\252Bi?\324\n\253\n_\337\021CG\261\304\\\330\341"
+	.ascii	"\246/O\005J\237\301\fk\360f\252:\321)4\206\007\237\234\275\334"
+	.ascii	"\204e\253\031 \354\331N\213\036{U(U\373\245e~\264\355\365}\006"
+	.ascii	"%x\203-\242:V\321\026\325\211\266@_\b\345,\003\2047#3@\330\263"
+	.ascii	"\025\264\214A\245\216\272\270\316\030\346\224]\337\241\241\243"
+	.ascii	"R\025\312\233(Z\372>\203\017\334\301\034\232\321\214BA \350\357"
+	.ascii	"\r\303qq\362\325\027\205B\235\214"
+	.string	" \361\232\352\213:5\312D\237\216:\241\313\217 \341:O\250\323\315\231Y+\007\236Z9\240pC\230R\322\373\f;\3603\304\300=\\D\277q\342T\264\2734\313U\030ZX\032nQ\322\372>\003\023{\220\342\347w\201\330\201\t\313YY\036\354\324\262F\217=\374\301\033\037\337\355\333 \343\216\214.m\254\357\355{\263GE\311\317\030\354\243\204\350wo\257\242\221\310\342Z\342e0\026e\315\023\264k\357\005.\270C\024Q\035\253\027\257:/\336m#\002\227\345\r\020\301\346\030'b7\357\352\350\223\241w\251\354~LY\301\037\240\236O8W'\344\332\306\372\376G\fs@B\364\273fM\303\301PR9_\021!1\302\241\n\314\220\276\377\261\201?l\33547\315\005\342f\3313\240\264\276\372\376\007\nk\020Ft\233\304&9\034\0042\363J\2041#\031\204\006(D\277u\257\273vXDM\2267@"
+	.ascii	"\265\370ie]3\350\216<8B\232U\246\266\330\340\372\336'\016\376"
+	.ascii	"`\204\f\231\013$\001S\200<\303\f\201\323\321\367>y\370\303\024"
+	.ascii	"\242\271;f\356\212\tf\253\234\263\022\340C+YFK\324\245\373\025"
+	.ascii	"s\270\262052}o\230\303u\221\363\322\321\367z\207\373\037\274"
+	.ascii	"4\336\232|\351{\2371\370\003\033/\027\214\227+\027\314V\035\300"
+	.ascii	"\204I\305\336\274\320r\277\374\312U\274\03553v\234\311\375\017"
+	.ascii	"V*p\344d\364\275O\023\034T\206\3507.\256}\220H\343bbu\200\262"
+	.ascii	"#\317*\347\211\232\247\262\276\367\371\201\237%\313\005\222\346"
+	.ascii	"\\\233\\UV9\313\312C\007hZ\356\026-\027Hg\256\234\303\200[\214"
+	.ascii	"L=sV\226\007$\0369\304\364\275O\026\276O\306\035\272\210~\337"
+	.ascii	"\252\363\276]\027\272+\007\313\214\274xf++\020.\374\367\312\305"
+	.ascii	"r\243\202\246\204\241\321\227\202\356i\203;\020\322\326v\201"
+	.ascii	"\334'\347\354\224s\016\034\251\214:\314!\217\350\327\312\265"
+	.ascii	"r\261j\016\003Rqr\362\334\353B\347\327\367=X0\207\026D\277k\257"
+	.ascii	"\316\273vc\334'\263|\225C\025\206\311\021\236\271\2654\\}\337"
+	.ascii	"c\206;P\243\246v\201\334\3650\301\031\274!\372\235\362\352\274"
+	.ascii	"S\256\025v\222\342\3122<hA\257\210\r\241\321\367=>\260\0066\210"
+	.ascii	"\256\263\332*N[\245\242\t\345%^\006cWM\020\257\025-\365@\b\321"
+	.ascii	"\257\331\rr\245\330*\022.\206\240\364h\341\367\270\300\034\260"
+	.ascii	"\020\375:\251\316\353\3446k~\313\231\231\325\001\311\033\206"
+	.ascii	"\033vk`\3726\377\373\344B\261`\332\013\031,/}\323\271\n\224\236"
+	.ascii	"\347\016k\350Bt\313\244:-\223\016C\"\215+_\0215\271\n\262\027"
+	.ascii	"\264\262\365\245\253\357O\033\321/Yu^\262;\3432\315\362\262g"
+	.ascii	"\215+/G\365\262\327BU\337\363\230\301\002\370B\364\273\344\325"
+	.ascii	"y\227\\1\022i\\\031\013\0048.6};Y\304\264\332\364\275L\252\314"
+	.ascii	"\0029\306\342\020\031$&\245\030*\231"
+	.string	"P\020\372!&\225\210J\351\t)L@Y4\232"
+	.string	"b\221\264\264\304\200\237\244aQRYL!\202\311x\024B\023\223\261\230\024\302\b%\bK j\022\241L\032\217E\250\n\245\261\210LJ\217\024\202\210dR\016\211*\200G\n\221DR\016\225\210G\306\341\t\fG\n\221$\032\035\225\204EH\021E*68"
+	.string	"\003&P\224`\200\320\001&T"
+	.string	"\005a\211\023B\025L\374d@\211\205\245\235#\20582\026\221\312\244\b\242\021SR\221\261(\002\231d\022AAR\022\223\321x4\002\225B\242\b\212\311\224\205#\022Iy4\002U\f\211I\227\305R\221\022Q)=R\210\t\2400\241\202\b\020\024\035\223J\020\221\307\022=F\311a\006\210FG%dq\bD\024\356\370X"
+	.string	""
+	.ascii	"\026K\307\022A\302\344\322\261\304\217\362H!\226\230\216\310"
+	.ascii	"#!\222\250$*\r\221\303%\021\035\212\214L9F\025\215&\205GK:J\241"
+	.ascii	"\361h\t5\036-Y\242\b\212\311\233L\022\221FFC \213\245c\321E*"
+	.ascii	"\227\254\021\321xTL\032\002\215\210I\246\233\004\036)<Z\n\261"
+	.ascii	"\203\034\"\025]\026He\262xD"
+	.string	"<\021DL:2\026UH\0322\231\300C4\016\223\226\220E\006d82\0263pd,\262H:A\203\217\211\006\024\221(v\222\216\307\006\b\321\344\221\261\230\274@\262\230\341\310XTB\016s\222\312\"\222\205\234\246\"\nF\303\343\004~\224Ce\022C2\207\210d\322P\204\201\322Q\231d*a4<&iH\246\312\242\321D\322x,*\213\210\310\242\t<' +\200\202\261\250\204$*\211F\036\210JE\345\322\3618\001\243b\n?>\"\204P\"\207K!\224E\243\211d\216\016\020\n>\304\244\024C\024=;\"T\240\207\305\020\211d@\005X\331c\202\t\243\342R\nB\023L\244\220,6\r\203G\n\221L:\"\225\306c\221\260\350\002#\343PI\351X\242\b\031<R\210\"!RD\221\n\001$\217\206I'\020\215\216(\364`\030*\207&\024!S%\2422\311B\005a\206#\212&&\006"
+	.string	""
+	.string	"M>\200\250\034\032-1eP\n\223Hb\022\223\003\210FL\312\242R9\fR*\211\302\034\025\224F\"\022\311T\364C\024\032\231h:\246"
+	.string	"*\217\024B\205\b\343QI\351X4\302\250\223B$Q\231T<\301h\310\024\202b\n\036\021R\364P\212\036\221\242\207\206=b\330CM=\242\251\207X\364\b\026=d\324\031^\224\024\032OP\022\223\304\023GKA/*\"\211F\342\021\376\b%\204P\002Q\023\360D\006\020\301"
+	.ascii	"\"\244'2\300\320\220\001J\030\302/a\310\016\205\030A$$*\207I"
+	.ascii	"KJD\245P\250\201(l\"\032\031M(\211IL\310\233\024&\211IL't\210"
+	.ascii	"IL'x\224G\n\241\324A\223B \362\250<*a8\256@\022U &\231\360\221"
+	.ascii	"B"
+	.string	"\2108\026+H\032\246P*\036\361\020\215\216J\227\330TT*\241CT\016O %\211H\025\304\023M\310\035\2442\005\343\tC\345\320\204\fD\245\242\322\310t\242\t\371c<\201\205\341\t\243!\361D\0212\007\251L!\203\361\204$\223r\250T\201\2504D\236P\204\354Q*\035\221'\250\310\220\024*\r\221\303\024\222F\304$\222\270\202\210\354!&\031\031\025\225Re\3231\205M\n\221\304\246\"\n\304#\344P\271C,B2\035UP2-\031\2139D\345\020y\215\210\304\245$j,*\331\264i\250dY\030\"\355\221B0)\025\205\222\222\216\310\213T\244,.\241,\fY\330$\221)i\270\"=R\210&\244\210&$P\023\022\303\322P\251\b\211\"\211F\305\025G\344\222\260\t\2314,\"\211\311\037\343\261\230L2\245H\3624\021\223\226\230LP\2214D\302\220t,:*\217\310\245\036\245p\304"
+	.string	"\214\212A\245\221\351X$T\201\024\026\227\222\302&d\005D\243\"\022I\\q\024\032\213\031\b\217\230\222\226\204~\224\304$\021yT2\r\205F\306b\n\241r\230\024*1!\225  .%-\320!&\r\213\222\030\224H\342\ncQXL&\2219EH\243\242\022j,*a\020\024\021\221\212\232\206J\270'\2314\\a<\026\225\303\244\343\022\222\2504\232(BV\220$\022\221GD\023\210IGF\006(\rK\254XR\221A\330\3044\0246\r\225z\214\222\216HI\"\022\t\005Q9\\QT\0261\200htD\001Y\034\n\031\213E\304$\223\260i\250$lB\346"
+	.string	"\225G\262\240\204\0229T\252pd,\032!\207, \217'$\021\215\306!R\021\006;\312#\205P2-)\231\216B%\026\226D$\221\304\025E\244Q\006?.\021\221\"\224\307#RD\216R\bL\036\rQ\034\213iRxTTa<\226XA4!\231\304\224\002\222\2504\022K\370\020\225\303\023J,\244\240\263\202hd\225\302\022\206p\b\210H\025\302dr\270\304\3021I\250\024\022)\215E&\340\tP\202\b\003\030\0321\302\210\020\031^\200\002\224\310\340\002\024x"
+	.string	".\n\221\024\241D:*&\251\020a,\016\225D\024!\223\"B"
+	.ascii	"\340\270\002IL\n\215\210J\310\241\221IXD*\177\376\003\261\236"
+	.ascii	"\\4\272\250\261\253\366\201\325\326\314\301\260\002V\225\271"
+	.ascii	"9+\343\341R2\006\256/\b9\200/\2001\200/\200Tw\007p\342\303\332"
+	.ascii	"\343\003R\001\247\276\f\271\353\002N\001a\240W\270\254\276\340"
+	.ascii	"\034K\326\360\365\375\006\036\270\231d\212X\031\2510 \032\037"
+	.ascii	"\033V\213T\f\3738\"\227#\312\005t\210\030\275: Tz\343\216lO\310"
+	.ascii	"S\312\243n\315\300\342\341tg|\340\353a\006d^\261\2461\206\003"
+	.ascii	"\270\254l-@\275Y\353\233\306I\377\016\314\007\346\006f\373\367"
+	.ascii	"\227:\0313%\275!X\361\245p\370R?\020\240\320\275\301{\363\324"
+	.ascii	"\017.*M\033\272\276i\237\033\033\370O_\270:x\370\342\310\270"
+	.ascii	"\330K\263\224\3745\247\372\202\340\366L\365\322g\332&\270\214"
+	.ascii	"\341v\367\264M\232\267\202\307\223V^\212\207\211\360\325 {\241"
+	.ascii	"\204O\311\206%\376S6\027\310U\323\002\363Z\323Fn\306\017\030"
+	.ascii	"jR\2659(\177?\372\202\320\306.Mc\227\242\351\360\224sTfA\304"
+	.ascii	"\253\354y\346)\032\373\226e\213Z\0216\370O\315\244`f\270\276"
+	.ascii	"\246\352\354\264\204\225\225\211\221\003\313\271\325\267\351"
+	.ascii	"\314\271\331\243!\213I\214>1U/\244b\256\025\r'h_}\235\342d\334"
+	.ascii	"\350\013B\221\324K\032&\365\222\316U++<\r\274\300`\355\361\345"
+	.ascii	"\254\031\036\376\364\313\323\271\177\004\t)\030{F\254IW\n&\225"
+	.ascii	"\003.up\341k!nY\332\204\304\340\263\246NUU\020\256\270\027\030"
+	.ascii	"\246\244\310\020\341\022\343\216y\271\005I\267\240[I\316\200"
+	.ascii	"Q\243\005\235\201\253\3601\t\313\202~\241;\244\352\314\340.\326"
+	.ascii	"V\017\033WX\236\272\320\203Wc\307V\337\364-\275\302$\214\212"
+	.ascii	"]\337W\347\325\254A\222\346\312\223\276i[\352\006\026\246\206"
+	.ascii	"\205\315\237V|I\370\316\260\2452\2001\232\274\351a\3456w\202"
+	.ascii	"\024\t\362d\355\270H!\322\265v\267\326\244\334\271\320\227\203"
+	.ascii	",\315\247f\315T\315\226i\213\313\211\002#J\230\263\247jO\323"
+	.ascii	"F\220p5XlI\031f\337t\312y\262\276\\y\366}\212\206\001\311\227"
+	.ascii	"\223I\337\207`V\343\352\252o\352L\242"
+	.string	"f\352\256o*\345p:Yu|>\242x\301\035\210\220\235,}\"\204\263\023)qO<\205\312\215-'O\237\254\3511\233\212s\3237-\323\342\002\n\234\276i\223\267m1\263\362\024J\303\035\310\0349\222\212]\320$\314\2230\235\272\247\232:&O\305\332t\244\230zN\372\246H\322%\377\203=^jv5\322%\251\2227\036`\314\013\245\343\267\205W\227&\261/\330$]dsBKp\0076 O\211"
+	.ascii	"I\303\252^m\346,\256%\036\007:\272t\335"
+	.string	"\340\313R7<\034\365\320\341\245\310\3230/\351\337\231[W:\004XG\246\213Y\337T\b\272%\003M\222 \177P\007\314\213\034^\337\013e\374\n\334`\016\366z\364H\301\204\270l\035]\034>\261\0350XmW>\236\202\355\350\235\315=i\037\251\\\225_\237\013\230\203\034\205x\250\343\201\263jH,\3060\f\304\230C\206\251\221\332$\351C\025@0H@\"\026\f\367\311=\023\300\203\213,Ey\240\006\035c\206HDD$\214$I\215a\f\346\366un\316\"\177\315]\007\236\223y\247[\374Wi\323H^wX(\2245Q\233&~*\231\323\037}\213\026\360\342t\032\033\266\277'\022\b\375H\177\367g,~\211\034\230bo\231}\031\367K\342\261\217\215r\371\030\374\210~\025\356gj\r\363G\020L\323x\333\234\240\322 Tm\241\006\021\257\374$\252\350\376\362,\034\322;Z\200`\345\310\005\240\257"
+	.string	"\210\345\245X\3165+]c\241\250\302\270n\033\b\363\2321`\370\340\330W\t\271\205\244Q\207\025\345"
+	.string	"\006\t9\340\227\023\n\341.)\323\343\351,C\362\210\316\030\375|y\264&<[6\223\342\035\302 \211Y\n\003]\211\004\020\216OW\004\204!\rm\255b\375\273J\346\211\201\331\"\205t\330~5]$\323\352\267\013\246\304<\343\206\326\231\315^\224\026&_\003\333\327\374\257\315\255\366\223\037\253\215\232\nu\310\353\237\313\361\303\0322\3510bL#\203{Ng~\005\001\220\300t\026"
+	.string	"\333\331\222\006k\3230!\336\343\270\031\037\260(\306o\300\017\004b\362\343\033\242QD\306|\326\026\251\013\213Eu\326\324\272\016\225\374\375\032\226\016\302K\225\334\002\316\260|#\034n\221\331\324\350\001\240\037R^\036k\323I\276\3264*\226\fcv!\275X\346\314\361\3261\200\347Zw\306\276(\013'a\020\206\355\001\203\027\377\272?XY\337\326[Ne\037\260\021\251\352\322\376\022q\243\355P\206\033\222$?\343\210+\2641Z-(\330o$\331)\375\261\365\237\024~\212E\206\273\273\2714\335\200\272\020\303\300\226?{x\346-ZQ\320^hII\212x\246\204V\340\207\254Z,\335\331\372\021B="
+	.string	"\001<\224\266\022\276(\254%\205v(A\374x\"\370\236\300S\275\351f[\220\202[BO\355[\337\tyi\307\tE\303Vo\330\313u\273Y\325\2305\026j\204\240\207\214R\220\234\335\200\032\213\3043\2564\324\344\002\342\303C9\364\211\207c\200|\351\007\037\316\035\211\321K\201\"\270\271 &\260\266L\032\375a%A\375Q_`\334\354\222B\237\346\016\317\f\313q`-q\371BJ\314\013fbG\315o*I1t\257\024\nij\353\303.r\200\303U\346\246\202\0160Q"
+	.string	"I6(i\ry\205|\240X-g\bv\r\372,\304\242\032v\260\366,\225\312\326\273Tm\343\311\242\351\377\350D\35384e\357\21040\3511&J\345&2{\370\332\030q\220!\356\322#7\202\205n\035I\002\027\212\311$\316\t-\305\313\206\321\306"
+	.ascii	"\320!\352\2006\203\345\275\t\255\016\335e\310\267{<\003\242\027"
+	.ascii	"\267\241\350\346\313\336\343\224\353\273@\373\021\331\343=\302"
+	.ascii	"Q@\027\246\324D\301\254\240x\317\004\252h_8b\fq<\215|\304\334"
+	.ascii	"\272N<\340\263\\\203\t\203\r\0228\034\030\0303N\023\330\270\006"
+	.ascii	"\237$\343\353h\230\366\n\306^Z:\275h\177\274z\017i\032\246\240"
+	.ascii	"g\307N;\220"
+	.string	"/4\353\363=\342\216)R\\2\nY\006\334[Mo\251\374\027\311\212a\201\rely\334zJ\275\254_S\t\303\325\023\332\004\274\356&r\262j\261\351\321\324\205 \235\347@\236\216\225\315\337\2121\307b\3147M\230\274R\310\305\300\331\036\346DuIBrq\301\004ir\204\232O7,T.\021\016\234,L\3246G\177U'I\326\342B\271\356S\263\003f\304\351N/\263\307\306\362N\240\307B2\323\"\032\217d1\302\225\363\326%\256\021O\353Uw\026C\326C\271\313+\0023-\n\260\262\337\201\203\377L\2046w\235HO2#\005\214&[m;\343\363\035\347P\344\2001\t\nR\331\252\221\257%*/?\223=IA\203\365\017\325\213\334\274\340\356\271\230\336\201\274\350#\210\241\2672\b\201\326\013U\326+(\036\213\005Yt\004\266\221\247\302\037Yc\356LG_\215\022\240\313\303U|E\032\013"
+	.string	"\006\342H"
+	.string	"("
+	.string	"/\276\205\035\236P|+\326\276(\305\371\315|E\351\257\007\227\375N\212t\356\017FE}\356\207\346/\361\317\2044`\354J{\222p3\007\313\n\2706\347\22276\321\037\220\"\366\304\355\f\326E\366t\026a\365c\331\345\363\267g\240\302b>\023\0252tP9\274\316\017\036\022!\276\021\246^\003\231\206\004\030H\030Xke\251PF\331B\245\205E\326\247`\204\300v,\240\355%\320x?BB\372w{\373\001{\271\356{\007\222!\261C\376e\261#\227\256I\354\2345_\350{\231\220\346!J\177\t\016\022z\233)\217\021\310\367\232\rn%\276\\\222\2770\250\"\272\371\234@\016\373\264\225\200osmU{o4\353\300\251\351\221v\210L\024;\254k\373X82 \224\204\323\302\307*\003\342\271\230\257\023\367\252\350\271\236x`\221}$$D%\2653\231\036\225\037\235\274\373\213\3138\300"
+	.string	"R\354\006\322A0\r\371U\024\037#*\227\022\234\035\037f\221\351\314\264m3\322 \025\033\312\034\263\332w\220i \331\"O\275n\177\206\022=\341\275\177\257\266\200\206\274\346\003%\013 #LE2'7\364\236k*j\321\371k!\245\016\3578\016\211\305\n\036<DE\271%!\007\036\207s\3238R\313\264\271\225\216\235\005j.\342\001\241\304\335\310{\021\336\322'\337<\275\342\343\266\177r\3144\305\376\255\330;\324\212Cu\001p\326\360\222\021Yk\370\204\225\316\246/\272\221\247j\367\007\246\320\325W\b\354\375o\017T\201\031N\277\001\032~\310\312\025\232\332\020kg\310\007w!Z\013\232\266\031\025\202`-F\033N.\365|\3717\207\227z"
+	.string	"m~\fU\001T\331\343\n\220o\345{\035\236\323,o\244Sl3 \230K\006\004\244\027\361_\307\270h\006\023\002\217\312q\016\263T\2218D-\235\023\302\177\251e\241'\35332\224(\221\254=\035\270\201\220\245M\275e\245F\347\366\372\200'D\315\260\354\277\236\301{\275f0\210w[.\222\353\212\265\356r\223\016\225\022H\b\t\203\006^M\207\275\023f\f\362\201%\004\216\376|\277\026\271y\0028\350\037<\003\223\214\252\330\260\t\214h\351\021\005,\266<\177X\370\355\013\276!\346@\264\372\002J\305\2663"
+	.ascii	"4UH\227\357\233(\312@\022\002}\341\366$X^.\215\205Z:\250\341"
+	.string	"Z.\234F\302@\327\261\3702V08I\006\373\177u\215\204\370]\315\tR\006\200\027\346\302\203\006\347p5\346\253\271 O\025\t\320\271+$\200\315\355a\007\330\263\350u\023\217!\007\220\256\324M\230>"
+	.string	"\"\3514\275\310\307f\351\255\270\370\224\"\361\020\212@\227\034\374\342\351@\201_\204\225"
+	.string	"+*G,\204\363\001\236t\274\301\\\022\275b\b\205Rq\235\027\276\353fw8\242\036\ro\2008\203\306\357\223\232\227\30662\335er\fLh;\313j1\211\r\366\361\265\211z\345p\035\200L\204,]\311\356;\271\222\324\206\357\344\267\243\301\304\202\354\317\205#W\201\272(\323\033\243+\362\260\317\353\207A\311\345\354\314\325\343^\\\2713\025A\2323YW\312\205\241&\213IvB\020\223\270\364\234\215\\u\236/3\244\226\315i\303\346o\205\201h\247\236\332^\002o\377NY\215a&\365\264U\027\270A\325A\301$\334\343\220\002`\245G\314\222\355o\346\004\025x\2039(\264*\305@O\016\277T\3156\255q\331\3006=\020\370k\332#\364T\200\344\257\376\2704`\226\314}\214p{1\273e#\352\224"
+	.string	"\334\260\244\254\034\306\203\277\313\004\t\002\324\211\211W\255\271\257\254\233^\345\367!\001\0239hO>\347(\3217\005\316r\265\340\362\331X\026\372\213E\315w\256\212q\377gyt\247\263\304-\277\217\334\372\022m\241$F\326x\343\215\225\311\013\0251\267\354\300\332\007x\333w\234\324\224\201\372!\304\260\256\252(\330T\024\004|\026\217\032P3\354s\301\363kn&2I\206\373\213\264:c\\\325u%\235=\373\203P\337\316E@\351tE\320rK\250\237p\234\364\262P\353\313K2\235\335Q>p\021\232q\251\322\243\310<\362\276d\344\365\360\f\220\251\351\334B\320\304\355\252\001PN\262B\207\227\f\211\330wZ\344\027\231\3347*\336\222\325Yr\265\270\247(\354m7\300\215\201\t\263\207@\331j\352x\233\363\315\346\263\374\322\340}g37\302!\306V\222\262N\330wg\332_(\322\377\241H"
+	.string	"\002\"\266;\215\003u"
+	.string	"\365\214\265oP@\207\227\301\240jk\235L\032\251\255\263\243\331\303\020~T\223s\005\323\275q\325F\300\306e\363w\230\314\304\222\024\003\003\032\315\337M\\K"
+	.string	"M\201\206\273\240,\021\332\021h\376a\204\345u\300\355\343.R\353'h\"\301\262\007\251\266\233\377(\324Gk\361\360\020\033\021\201m\275\2128\bnb\346\334D\251N"
+	.ascii	"\324\362!Z\223hX=\004\372\346\240T\205\254\362\346\246P\001!"
+	.ascii	"\202\337p\316\353\344\334p\355\342K\266\330L+\030\3262-/\337"
+	.ascii	"\215\365\352\360[\025\276\216\350\003`\2175\303\b\376\215\310"
+	.ascii	"\342\250\222\303!\234\331\364{I\336\236\001\237=\220\f\313i\215"
+	.ascii	"\241>?]ZO\236_l\355>\022,&\341\006\006?\331\341\325~\330\305"
+	.ascii	"\356\365\211\2777\206b\367\303\315W1\301Z\201\376\371\240\336"
+	.ascii	"S\334\013\325~\322{\335\312\031\227o\020\275\253\033\004\221"
+	.ascii	"\211<b\256\374\005'\247`\345w1\271s\030\206\220\274\225J+\016"
+	.ascii	"\307\250\252i\017\300\017V4\271c\270+x;\032a\037K9\265/\377\277"
+	.ascii	"\270A\334\373\f\364\261Y|d\341\363\0207\241\030\276\330\277;"
+	.ascii	"\336\235\261\321m\355\252\323\323[\307\312\256\274\375\020\372"
+	.ascii	"#\343\347\333"
+	.string	"\331\352\320\035\364k\372\371\234\212\215A\363\022\356V\301]\347.\351\033\360\305\236d\212\277Y?S\205W\022'\3028\315\206n\314\273Gd\326\331\2417xR\336o6m\251\236\025,\026\"\310\207x\364\301d\256\275\233\023n\376P}\t\350\203!N\225\325%\337t\334\001\337\227\344\320\355\234\3018\300A\332=\342\033\350\362T\260?\254\333\\\264\fa\252iw\333\275K\316\b9\337\270\333@\225G\244{I*\273\205\254\347\235\341\353\347fW\240\374\rW/\372\234!\3777In\206\337^\017\357\016\022~(s\031\275w\037k\007$\273\350\271F|\f\217{\341\376R\360\237\250\231\265G.\276\230\225\205x\262\202\226\350\305u\261\\\330\027\001\027\232\362\324\370\303u\371Qh\346\3058\345\306\017\300\336`\350 \036\036\312?\244Z]K\272\2234\356\210STH\270\r\372\356dU\331h\031\322\230\366I\r\354a"
+	.ascii	"\310UW"
+	.text
+	.section	.gnu.lto_.symtab.fe8126d2a54b96f1,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"p"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"p"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fe8126d2a54b96f1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
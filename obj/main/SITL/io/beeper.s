@@ -0,0 +1,10666 @@
+	.file	"beeper.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/config/parameter_group.h"
+	.file 4 "./src/main/drivers/io_types.h"
+	.file 5 "./src/main/drivers/sound_beeper.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/io/beeper.h"
+	.file 10 "./src/main/fc/rc_modes.h"
+	.file 11 "./src/main/sensors/sensors.h"
+	.file 12 "./src/main/io/beeper.c"
+	.file 13 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	beeper.c.8bb8e6ca
+	.weak	beeper.c.8bb8e6ca
+beeper.c.8bb8e6ca:
+	.long	0x60e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF1669
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1504
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1505
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1506
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1507
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1508
+	.uleb128 0x2
+	.long	.LASF1510
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1509
+	.uleb128 0x2
+	.long	.LASF1511
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1513
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1514
+	.uleb128 0x9
+	.long	0x80
+	.uleb128 0x2
+	.long	.LASF1515
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1516
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x17
+	.long	.LASF1670
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xa
+	.long	0xa4
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1518
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1519
+	.uleb128 0x2
+	.long	.LASF1520
+	.byte	0x3
+	.byte	0x19
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x3
+	.byte	0x21
+	.long	0xfd
+	.uleb128 0xa
+	.long	.LASF1521
+	.value	0xfff
+	.uleb128 0xa
+	.long	.LASF1522
+	.value	0xf000
+	.uleb128 0xa
+	.long	.LASF1523
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1525
+	.byte	0x3
+	.byte	0x29
+	.byte	0xf
+	.long	0x109
+	.uleb128 0x18
+	.long	0x119
+	.uleb128 0xd
+	.long	0x7e
+	.uleb128 0xd
+	.long	0x64
+	.byte	0
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x3
+	.byte	0x31
+	.byte	0x5
+	.long	0x138
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0xe
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x138
+	.byte	0
+	.uleb128 0x6
+	.long	0xfd
+	.uleb128 0xf
+	.long	.LASF1532
+	.byte	0x28
+	.byte	0x3
+	.byte	0x2b
+	.long	0x196
+	.uleb128 0x10
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xca
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1526
+	.byte	0x3
+	.byte	0x2d
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1527
+	.byte	0x3
+	.byte	0x2e
+	.byte	0xe
+	.long	0x196
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1528
+	.byte	0x3
+	.byte	0x2f
+	.byte	0xe
+	.long	0x196
+	.byte	0x10
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x19b
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1529
+	.byte	0x3
+	.byte	0x34
+	.byte	0x7
+	.long	0x119
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x8c
+	.uleb128 0x6
+	.long	0x196
+	.uleb128 0x2
+	.long	.LASF1530
+	.byte	0x3
+	.byte	0x35
+	.byte	0x3
+	.long	0x13d
+	.uleb128 0x9
+	.long	0x1a0
+	.uleb128 0x2
+	.long	.LASF1531
+	.byte	0x4
+	.byte	0x18
+	.byte	0x11
+	.long	0x8c
+	.uleb128 0xf
+	.long	.LASF1533
+	.byte	0x6
+	.byte	0x5
+	.byte	0x20
+	.long	0x1fe
+	.uleb128 0x4
+	.long	.LASF1534
+	.byte	0x5
+	.byte	0x21
+	.byte	0xd
+	.long	0x1b1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1535
+	.byte	0x5
+	.byte	0x22
+	.byte	0xd
+	.long	0x8c
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1536
+	.byte	0x5
+	.byte	0x23
+	.byte	0xd
+	.long	0x8c
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1537
+	.byte	0x5
+	.byte	0x24
+	.byte	0xe
+	.long	0x98
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3
+	.long	0x1bd
+	.uleb128 0x9
+	.long	0x1fe
+	.uleb128 0x2
+	.long	.LASF1539
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1540
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x348
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x87
+	.uleb128 0x7
+	.long	.LASF1588
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x1a
+	.long	0x1fe
+	.uleb128 0x7
+	.long	.LASF1589
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x4b
+	.long	0x1fe
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x9
+	.byte	0x17
+	.long	0x3f5
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1612
+	.byte	0x9
+	.byte	0x31
+	.byte	0x3
+	.long	0x365
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.long	0x4f1
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x25
+	.byte	0
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.long	0x51b
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1656
+	.byte	0xc
+	.byte	0x32
+	.byte	0x20
+	.long	0x20a
+	.uleb128 0x11
+	.long	0x34d
+	.byte	0x53
+	.uleb128 0x11
+	.long	0x359
+	.byte	0x7d
+	.uleb128 0x7
+	.long	.LASF1657
+	.byte	0xc
+	.byte	0x32
+	.byte	0xad
+	.long	0x1ac
+	.uleb128 0x1a
+	.long	0x533
+	.byte	0xda
+	.uleb128 0x1b
+	.long	0x51b
+	.byte	0x46
+	.byte	0x19
+	.uleb128 0xb
+	.long	.LASF1658
+	.value	0x1db
+	.byte	0x5
+	.long	0x21b
+	.uleb128 0xb
+	.long	.LASF1659
+	.value	0x1da
+	.byte	0x5
+	.long	0x64
+	.uleb128 0x12
+	.long	.LASF1660
+	.value	0x1d9
+	.byte	0xd
+	.long	0x348
+	.long	0x581
+	.uleb128 0x13
+	.string	"idx"
+	.value	0x1d9
+	.byte	0x29
+	.long	0x64
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1661
+	.value	0x1d8
+	.byte	0xe
+	.long	0x3f5
+	.long	0x59e
+	.uleb128 0x13
+	.string	"idx"
+	.value	0x1d8
+	.byte	0x2a
+	.long	0x64
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1662
+	.value	0x1d7
+	.byte	0xa
+	.long	0xa4
+	.uleb128 0xc
+	.long	.LASF1664
+	.value	0x1d6
+	.long	0x5c2
+	.uleb128 0x8
+	.long	.LASF1663
+	.value	0x1d6
+	.byte	0x1c
+	.long	0x20f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1665
+	.value	0x1d5
+	.long	0x5da
+	.uleb128 0x8
+	.long	.LASF1666
+	.value	0x1d5
+	.byte	0x21
+	.long	0x8c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1667
+	.value	0x1d4
+	.long	0x5f2
+	.uleb128 0x8
+	.long	.LASF1666
+	.value	0x1d4
+	.byte	0x26
+	.long	0x8c
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1671
+	.byte	0xc
+	.value	0x1d3
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1672
+	.byte	0xc
+	.value	0x1d2
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF1668
+	.value	0x1d2
+	.byte	0x1a
+	.long	0x3f5
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 34 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 36 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 39 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1039
+	.byte	0x4
+	.byte	0x4
+	.file 40 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x28
+	.file 41 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x29
+	.file 42 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1040
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 43 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.file 44 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 47 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 50 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 51 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1449
+	.byte	0x4
+	.file 52 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 53 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1456
+	.byte	0x4
+	.file 54 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x9
+	.byte	0x4
+	.file 55 "./src/main/io/statusindicator.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1476
+	.byte	0x4
+	.file 57 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 58 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3a
+	.file 59 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 60 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3c
+	.file 61 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3e
+	.file 63 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1503
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF922
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1038
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.24.f6966c02694732c8732768a975cac6e4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1046
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.f7b0f6199f2d61606ca6ec4fc855972e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1056
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1475
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1488
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1495
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1673
+	.long	.LASF1674
+	.long	.LASF1675
+	.long	.LASF1676
+	.long	.LASF1677
+	.long	.LASF1678
+	.long	.LASF1679
+	.long	.LASF1680
+	.long	.LASF1681
+	.long	.LASF1682
+	.long	.LASF1683
+	.long	.LASF1684
+	.long	.LASF1685
+	.long	.LASF1686
+	.long	.LASF1687
+	.long	.LASF1688
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x40
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1689
+	.byte	0xc
+	.long	.LASF1690
+	.byte	0xc
+	.long	.LASF1691
+	.byte	0x3
+	.long	.LASF1692
+	.byte	0x4
+	.long	.LASF1693
+	.byte	0x4
+	.long	.LASF1694
+	.byte	0x2
+	.long	.LASF1695
+	.byte	0x4
+	.long	.LASF1696
+	.byte	0x5
+	.long	.LASF1697
+	.byte	0x7
+	.long	.LASF1698
+	.byte	0x5
+	.long	.LASF1699
+	.byte	0x8
+	.long	.LASF1700
+	.byte	0x7
+	.long	.LASF1701
+	.byte	0x9
+	.long	.LASF1702
+	.byte	0xf
+	.long	.LASF1703
+	.byte	0x10
+	.long	.LASF1704
+	.byte	0x10
+	.long	.LASF1704
+	.byte	0xf
+	.long	.LASF1705
+	.byte	0xc
+	.long	.LASF1706
+	.byte	0xf
+	.long	.LASF1707
+	.byte	0xf
+	.long	.LASF1708
+	.byte	0xc
+	.long	.LASF1709
+	.byte	0xc
+	.long	.LASF1710
+	.byte	0xe
+	.long	.LASF1711
+	.byte	0xc
+	.long	.LASF1712
+	.byte	0xd
+	.long	.LASF1713
+	.byte	0xd
+	.long	.LASF1714
+	.byte	0xc
+	.long	.LASF1715
+	.byte	0xc
+	.long	.LASF1716
+	.byte	0xc
+	.long	.LASF1717
+	.byte	0xc
+	.long	.LASF1718
+	.byte	0xb
+	.long	.LASF1719
+	.byte	0xa
+	.long	.LASF1720
+	.byte	0x10
+	.long	.LASF1721
+	.byte	0xa
+	.long	.LASF1722
+	.byte	0x2
+	.long	.LASF1723
+	.byte	0x3
+	.long	.LASF1724
+	.byte	0x1
+	.long	.LASF1725
+	.byte	0x3
+	.long	.LASF1694
+	.byte	0x4
+	.long	.LASF1726
+	.byte	0x4
+	.long	.LASF1727
+	.byte	0x4
+	.long	.LASF1728
+	.byte	0x4
+	.long	.LASF1729
+	.byte	0x6
+	.long	.LASF1730
+	.byte	0x4
+	.long	.LASF1731
+	.byte	0x4
+	.long	.LASF1732
+	.byte	0x4
+	.long	.LASF1733
+	.byte	0x4
+	.long	.LASF1734
+	.byte	0x4
+	.long	.LASF1735
+	.byte	0x4
+	.long	.LASF1736
+	.byte	0x4
+	.long	.LASF1737
+	.byte	0x4
+	.long	.LASF1738
+	.byte	0x4
+	.long	.LASF1739
+	.byte	0x4
+	.long	.LASF1740
+	.byte	0x5
+	.long	.LASF1741
+	.byte	0x7
+	.long	.LASF1742
+	.byte	0x7
+	.long	.LASF1743
+	.byte	0x7
+	.long	.LASF1744
+	.byte	0x8
+	.long	.LASF1745
+	.byte	0x2
+	.long	.LASF1746
+	.byte	0x8
+	.long	.LASF1747
+	.byte	0x8
+	.long	.LASF1748
+	.byte	0x8
+	.long	.LASF1749
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1196:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1471:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1076:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1270:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1102:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1087:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1031:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1649:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF706:
+	.string	"USE_CLI "
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF1187:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF793:
+	.string	"USE_PPM"
+.LASF1053:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1085:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1343:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF1534:
+	.string	"ioTag"
+.LASF929:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1502:
+	.string	"BEEPER_COMMAND_REPEAT 0xFE"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1651:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1510:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1540:
+	.string	"_Bool"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF1047:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1289:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF902:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1061:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1498:
+	.string	"BEEPER_PIN NONE"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1549:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1474:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1599:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1249:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1367:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF944:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1461:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1072:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF1436:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF992:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1195:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF984:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1408:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1354:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF948:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1546:
+	.string	"OWNER_LED"
+.LASF1178:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1124:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1516:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1021:
+	.string	"PG_VTX_CONFIG 515"
+.LASF969:
+	.string	"PG_RX_CONFIG 24"
+.LASF1375:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1219:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF1038:
+	.string	"BEEP_ON do {} while (0)"
+.LASF939:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1342:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1069:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF980:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF918:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1604:
+	.string	"BEEPER_READY_BEEP"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1095:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1486:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1399:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1635:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1006:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF988:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1043:
+	.string	"DSHOT_MAX_COMMAND 47"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1300:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1363:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1435:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1572:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1103:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1068:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF915:
+	.string	"BIT(x) (1 << (x))"
+.LASF1577:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1057:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1494:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1316:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"PROSHOT_DMA_BUFFER_SIZE 6"
+.LASF1262:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF1585:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1357:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1074:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1127:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1459:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1574:
+	.string	"OWNER_BARO_EXTI"
+.LASF965:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF794:
+	.string	"USE_PWM"
+.LASF1222:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1083:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1667:
+	.string	"beeperConfirmationBeeps"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1552:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1618:
+	.string	"BOXMAG"
+.LASF906:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF985:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF998:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF999:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1523:
+	.string	"PGR_SIZE_MASK"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1150:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF1054:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1661:
+	.string	"beeperModeForTableIndex"
+.LASF1513:
+	.string	"long int"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1036:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1337:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1611:
+	.string	"BEEPER_PREFERENCE"
+.LASF1628:
+	.string	"BOXLEDLOW"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1575:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1670:
+	.string	"SystemCoreClock"
+.LASF1017:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1587:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF941:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1400:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1615:
+	.string	"BOXHORIZON"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF943:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1458:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1319:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1243:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF364:
+	.string	"__k8 1"
+.LASF1629:
+	.string	"BOXLLIGHTS"
+.LASF1557:
+	.string	"OWNER_SONAR_ECHO"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1360:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1130:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1616:
+	.string	"BOXBARO"
+.LASF932:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1450:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1545:
+	.string	"OWNER_SERVO"
+.LASF917:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF765:
+	.string	"ACC "
+.LASF1672:
+	.string	"beeper"
+.LASF1658:
+	.string	"isBeeperOn"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF710:
+	.string	"USE_PWM "
+.LASF1591:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1390:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF1601:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1464:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1456:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1171:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1487:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1117:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF931:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1104:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1495:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1511:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1544:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1447:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1040:
+	.string	"MHZ_TO_HZ(x) ((x) * 1000000)"
+.LASF1571:
+	.string	"OWNER_RX_SPI_CS"
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1037:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1668:
+	.string	"mode"
+.LASF1163:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1252:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1202:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"ALL_MOTORS 255"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1470:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF928:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1652:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1025:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1050:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF901:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1268:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1022:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1214:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1504:
+	.string	"unsigned char"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1032:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1035:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF933:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1292:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF749:
+	.string	"USE_NAV "
+.LASF978:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1309:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1255:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF1519:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF956:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1613:
+	.string	"BOXARM"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1198:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF767:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1238:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1174:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1063:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1120:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1058:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF1630:
+	.string	"BOXCALIB"
+.LASF1532:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF923:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1533:
+	.string	"beeperDevConfig_s"
+.LASF1538:
+	.string	"beeperDevConfig_t"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1626:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1583:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1385:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1463:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1144:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1600:
+	.string	"BEEPER_RX_SET"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1596:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1310:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1566:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1406:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1352:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF910:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1609:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF945:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1291:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1105:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1217:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1521:
+	.string	"PGR_PGN_MASK"
+.LASF1636:
+	.string	"BOXSERVO1"
+.LASF1637:
+	.string	"BOXSERVO2"
+.LASF1638:
+	.string	"BOXSERVO3"
+.LASF1472:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF819:
+	.string	"USE_SPI"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1034:
+	.string	"IO_TAG_NONE 0"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1426:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1355:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1258:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1044:
+	.string	"PWM_TIMER_1MHZ MHZ_TO_HZ(1)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1438:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1366:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1088:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1019:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1397:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1402:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1656:
+	.string	"pgResetTemplate_beeperDevConfig"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1576:
+	.string	"OWNER_USB_DETECT"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1060:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1526:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1653:
+	.string	"SENSOR_INDEX_BARO"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1003:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF946:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1612:
+	.string	"beeperMode_e"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF911:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1580:
+	.string	"OWNER_INVERTER"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1561:
+	.string	"OWNER_SPI_MOSI"
+.LASF1409:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1525:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF908:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1654:
+	.string	"SENSOR_INDEX_MAG"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF997:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1110:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1220:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF912:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1633:
+	.string	"BOXTELEMETRY"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1030:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1348:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1261:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1193:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF1286:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF728:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF792:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1075:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF858:
+	.string	"__need_size_t"
+.LASF935:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1531:
+	.string	"ioTag_t"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1042:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF914:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF981:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1372:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1106:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1192:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF963:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1229:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF971:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF938:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1454:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1644:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF1339:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1113:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF896:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1109:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1642:
+	.string	"BOX3DDISABLE"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1250:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1052:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1671:
+	.string	"beeperSilence"
+.LASF1621:
+	.string	"BOXCAMSTAB"
+.LASF1256:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1115:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF1079:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1018:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1387:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1556:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1527:
+	.string	"address"
+.LASF909:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1588:
+	.string	"beeperDevConfig_System"
+.LASF1264:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1645:
+	.string	"BOXCAMERA1"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1067:
+	.string	"IOCFG_IPU 0"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF877:
+	.string	"NULL"
+.LASF1156:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1589:
+	.string	"beeperDevConfig_Copy"
+.LASF1432:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF1558:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1135:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1535:
+	.string	"isInverted"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1077:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF995:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1467:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1253:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1524:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF953:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1418:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1382:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1049:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1605:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1186:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"UNIT_TESTED "
+.LASF952:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1307:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1492:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1606:
+	.string	"BEEPER_ARMED"
+.LASF1086:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1669:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1469:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF936:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1147:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1232:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1396:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1460:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1484:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1327:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1213:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1159:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF947:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1369:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF879:
+	.string	"__need_NULL"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1610:
+	.string	"BEEPER_ALL"
+.LASF709:
+	.string	"USE_PPM "
+.LASF1590:
+	.string	"BEEPER_SILENCE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1098:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF970:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1240:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"reset"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF954:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1598:
+	.string	"BEEPER_BAT_LOW"
+.LASF898:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1564:
+	.string	"OWNER_SDCARD"
+.LASF1151:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1427:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF994:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1505:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1508:
+	.string	"signed char"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1119:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF840:
+	.string	"__size_t__ "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1424:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF1370:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF962:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF991:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1298:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1403:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF903:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1594:
+	.string	"BEEPER_DISARMING"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1351:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF1477:
+	.string	"LAT 0"
+.LASF1121:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1089:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1330:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1276:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"BOXAIRMODE"
+.LASF1162:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF974:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF720:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1142:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1578:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1391:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF979:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1059:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1013:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1619:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1093:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1465:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1485:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1073:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF920:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF976:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1294:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1475:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1099:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1297:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1528:
+	.string	"copy"
+.LASF1041:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1235:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1080:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF973:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1373:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1646:
+	.string	"BOXCAMERA2"
+.LASF1647:
+	.string	"BOXCAMERA3"
+.LASF966:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1499:
+	.string	"BEEPER_PWM_HZ 0"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1476:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF1091:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1501:
+	.string	"MAX_MULTI_BEEPS 64"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1026:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1554:
+	.string	"OWNER_PINDEBUG"
+.LASF1663:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1414:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1184:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1632:
+	.string	"BOXOSD"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1483:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1497:
+	.string	"IS_INVERTED false"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1024:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1141:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1279:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1165:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1111:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF907:
+	.string	"EXPAND_I(x) x"
+.LASF1662:
+	.string	"getArmingBeepTimeMicros"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1517:
+	.string	"uint32_t"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1388:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1617:
+	.string	"BOXANTIGRAVITY"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1288:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1145:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1624:
+	.string	"BOXGPSHOLD"
+.LASF1199:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1010:
+	.string	"PG_PID_CONFIG 504"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1358:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF491:
+	.string	"__flexarr []"
+.LASF721:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1620:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF989:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF949:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1020:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1623:
+	.string	"BOXGPSHOME"
+.LASF1555:
+	.string	"OWNER_TIMER"
+.LASF1168:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1346:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1376:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF904:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1208:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1381:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1514:
+	.string	"char"
+.LASF1452:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"GPS "
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF1303:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1064:
+	.string	"IOCFG_AF_PP 0"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1133:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1457:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF957:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1627:
+	.string	"BOXLEDMAX"
+.LASF1639:
+	.string	"BOXBLACKBOX"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1116:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1033:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1567:
+	.string	"OWNER_FLASH_CS"
+.LASF1530:
+	.string	"pgRegistry_t"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF1282:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1228:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1114:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1190:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1039:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF857:
+	.string	"__size_t "
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1512:
+	.string	"__uint32_t"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1634:
+	.string	"BOXGTUNE"
+.LASF982:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF961:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF905:
+	.string	"STR_HELPER(x) #x"
+.LASF1234:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF987:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1536:
+	.string	"isOpenDrain"
+.LASF1559:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF1082:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1551:
+	.string	"OWNER_ADC_RSSI"
+.LASF924:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1345:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1244:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1466:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1283:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"BOXFAILSAFE"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1607:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF1012:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1325:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1592:
+	.string	"BEEPER_RX_LOST"
+.LASF1211:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1157:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1028:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1154:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1420:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF1189:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1442:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1136:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"BEEPER_COMMAND_STOP 0xFF"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1231:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1177:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1660:
+	.string	"beeperNameForTableIndex"
+.LASF940:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1496:
+	.string	"IS_OPEN_DRAIN true"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1002:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1011:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1336:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1518:
+	.string	"double"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1051:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1562:
+	.string	"OWNER_I2C_SCL"
+.LASF1560:
+	.string	"OWNER_SPI_MISO"
+.LASF1097:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1584:
+	.string	"OWNER_COMPASS_CS"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF919:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1247:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF397:
+	.string	"true 1"
+.LASF950:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1411:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1027:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1650:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1563:
+	.string	"OWNER_I2C_SDA"
+.LASF1631:
+	.string	"BOXGOV"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1349:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF967:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1394:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1153:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1429:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF996:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF975:
+	.string	"PG_GPS_CONFIG 30"
+.LASF934:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1328:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1023:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1274:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF899:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1160:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1048:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF913:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF856:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1664:
+	.string	"beeperUpdate"
+.LASF1340:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1490:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF1078:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1096:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1445:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1446:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1315:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1430:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1597:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF972:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF925:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1378:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1579:
+	.string	"OWNER_RX_BIND"
+.LASF1001:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF1334:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1582:
+	.string	"OWNER_TRANSPONDER"
+.LASF968:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1180:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1126:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1246:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1643:
+	.string	"BOXFPVANGLEMIX"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1101:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF916:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1539:
+	.string	"timeUs_t"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1004:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1569:
+	.string	"OWNER_MPU_CS"
+.LASF1520:
+	.string	"pgn_t"
+.LASF1015:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1393:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF818:
+	.string	"USE_I2C"
+.LASF1608:
+	.string	"BEEPER_USB"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1478:
+	.string	"LON 1"
+.LASF1602:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF769:
+	.string	"MAG "
+.LASF1593:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1331:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF921:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF964:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1412:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1451:
+	.string	"I2CDEV_COUNT 4"
+.LASF951:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1659:
+	.string	"beeperTableEntryCount"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF922:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1277:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1223:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1548:
+	.string	"OWNER_ADC_BATT"
+.LASF1541:
+	.string	"OWNER_FREE"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1237:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1055:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1318:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1148:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1542:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1500:
+	.string	"BEEPER_NAMES "
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1468:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1488:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1183:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1423:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1666:
+	.string	"beepCount"
+.LASF396:
+	.string	"bool _Bool"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1455:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1433:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1295:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1489:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1417:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1062:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1205:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF955:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1565:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF927:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1482:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1094:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1092:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1481:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1453:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1415:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1361:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1648:
+	.string	"BOXDSHOTREVERSE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1139:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1016:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1586:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1312:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1226:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1112:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1172:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"long unsigned int"
+.LASF1070:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1581:
+	.string	"OWNER_LED_STRIP"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF897:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1479:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1321:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1267:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF959:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF986:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1537:
+	.string	"frequency"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1045:
+	.string	"DSHOT_DMA_BUFFER_SIZE 18"
+.LASF1132:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1665:
+	.string	"beeperWarningBeeps"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF937:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1071:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1568:
+	.string	"OWNER_BARO_CS"
+.LASF1595:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1138:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1657:
+	.string	"beeperDevConfig_Registry"
+.LASF1506:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF1448:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1441:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1379:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1625:
+	.string	"BOXPASSTHRU"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1014:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1547:
+	.string	"OWNER_ADC"
+.LASF1509:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1573:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1449:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1622:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF1364:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1614:
+	.string	"BOXANGLE"
+.LASF958:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF960:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1550:
+	.string	"OWNER_ADC_EXT"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1007:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1543:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1570:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1405:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF942:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1285:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1175:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1081:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1421:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1692:
+	.string	"io_types.h"
+.LASF1743:
+	.string	"gps.h"
+.LASF1711:
+	.string	"long-double.h"
+.LASF1718:
+	.string	"platform.h"
+.LASF1676:
+	.string	"src/main/drivers"
+.LASF1727:
+	.string	"timer.h"
+.LASF1732:
+	.string	"rx_pwm.h"
+.LASF1705:
+	.string	"libc-header-start.h"
+.LASF1686:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1674:
+	.string	"src/main/common"
+.LASF1708:
+	.string	"wordsize.h"
+.LASF1701:
+	.string	"target.h"
+.LASF1719:
+	.string	"common_fc_pre.h"
+.LASF1685:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1688:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1700:
+	.string	"beeper.c"
+.LASF1699:
+	.string	"sensors.h"
+.LASF1681:
+	.string	"src/main/target/SITL"
+.LASF1697:
+	.string	"beeper.h"
+.LASF1679:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1737:
+	.string	"io_def_generated.h"
+.LASF1684:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1696:
+	.string	"config.h"
+.LASF1738:
+	.string	"bus_i2c.h"
+.LASF1707:
+	.string	"features-time64.h"
+.LASF1739:
+	.string	"vcd.h"
+.LASF1689:
+	.string	"types.h"
+.LASF1709:
+	.string	"timesize.h"
+.LASF1703:
+	.string	"stdbool.h"
+.LASF1687:
+	.string	"/usr/include"
+.LASF1748:
+	.string	"voltage.h"
+.LASF1673:
+	.string	"src/main/build"
+.LASF1721:
+	.string	"common_fc_post.h"
+.LASF1728:
+	.string	"rcc_types.h"
+.LASF1706:
+	.string	"features.h"
+.LASF1678:
+	.string	"src/main/flight"
+.LASF1714:
+	.string	"typesizes.h"
+.LASF1726:
+	.string	"pwm_output.h"
+.LASF1715:
+	.string	"time64.h"
+.LASF1734:
+	.string	"serial.h"
+.LASF1731:
+	.string	"flash.h"
+.LASF1675:
+	.string	"src/main/config"
+.LASF1693:
+	.string	"sound_beeper.h"
+.LASF1698:
+	.string	"rc_modes.h"
+.LASF1690:
+	.string	"stdint-uintn.h"
+.LASF1682:
+	.string	"src/main/target"
+.LASF1722:
+	.string	"utils.h"
+.LASF1741:
+	.string	"statusindicator.h"
+.LASF1742:
+	.string	"vtx_control.h"
+.LASF1683:
+	.string	"src/main"
+.LASF1723:
+	.string	"feature.h"
+.LASF1680:
+	.string	"src/main/sensors"
+.LASF0:
+	.string	"./src/main/io/beeper.c"
+.LASF1695:
+	.string	"resource.h"
+.LASF1694:
+	.string	"time.h"
+.LASF1725:
+	.string	"parameter_group_ids.h"
+.LASF1716:
+	.string	"wchar.h"
+.LASF1740:
+	.string	"runtime_config.h"
+.LASF1736:
+	.string	"io_def.h"
+.LASF1677:
+	.string	"src/main/fc"
+.LASF1735:
+	.string	"io.h"
+.LASF1712:
+	.string	"stubs.h"
+.LASF1746:
+	.string	"current.h"
+.LASF1744:
+	.string	"battery.h"
+.LASF1710:
+	.string	"cdefs.h"
+.LASF1733:
+	.string	"sdcard.h"
+.LASF1704:
+	.string	"stdint.h"
+.LASF1724:
+	.string	"build_config.h"
+.LASF1717:
+	.string	"stdint-intn.h"
+.LASF1713:
+	.string	"stubs-64.h"
+.LASF1749:
+	.string	"voltage_ids.h"
+.LASF1729:
+	.string	"mixer.h"
+.LASF1720:
+	.string	"stddef.h"
+.LASF1730:
+	.string	"adc.h"
+.LASF1691:
+	.string	"parameter_group.h"
+.LASF1747:
+	.string	"current_ids.h"
+.LASF1702:
+	.string	"stdc-predef.h"
+.LASF1745:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 r\255\002"
+	.string	"\364\003f"
+	.string	"\017"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\257\204\241\210\f\013\245\351\271\273\013\f\240\342\234\212\n\r\016\240\342\234\212\n"
+	.string	"\b"
+	.string	"SDP\031\202s\\`T0De\\1\307\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 Du\001"
+	.string	"\3608"
+	.string	"\n"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b"
+	.string	"\003\t"
+	.string	"\003"
+	.string	"\006"
+	.ascii	"@0\315K`\234\312`-\203n\240\r"
+	.text
+	.section	.gnu.lto_.inline.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"5\002"
+	.string	"\204\002j\001"
+	.string	"\n"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t"
+	.string	"\f"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344u\024\215\315u\271\211G\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 Dm\001"
+	.string	"\3408"
+	.string	"\n"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"@0\315S\320\230\n\n\350\213\2628\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 P\365"
+	.string	""
+	.string	"hD"
+	.string	"\006"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007"
+	.string	"\007"
+	.string	"`\013\330\0076\003[\\\366\005Yo"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.7535b055968c34d7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeperDevConfig_Registry.53.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\265\376\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\306\007us\250\335\006uq"
+	.string	"\005\001\006'\001\006\367\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/beeper.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_beeperDevConfig.55.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 1m\001"
+	.string	"$\002$"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\035\001\001"
+	.string	"?\202\210\200 \177}\275\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@FJ\320\003(\002"
+	.text
+	.section	.gnu.lto_beeper.56.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\375\006"
+	.string	"\322\21513`o\032\003pH\bGO\t\245sJm\244\257\2763E1\241X\237Hf\246\335\232<\334\245\335yAp\020RJu\347F\201\226$\205\331&\245\224)\005\345T\frCQ\233i@BL\317k5Y\362#%\025g'Ft8\236XY\022q2\350\374H+N\314iEMv\277;\254&uT8\213zc\364\326\322f\240\346<Z\277\377\257\303\332\366`\254\364g\274\270\\\005\246\210\264\265\246\025\270PpkMb\322\345\022\212f\376\321\b\312\237-4!\300\360\300\005\030\303g\002\214a\257v\305\031\310}\022\202Qb\371\037\335\207/\267\253\266\2113!\021\310\r\300\341\177[H\244\341:\267Eh\333\320\226#\b"
+	.ascii	"\002Td\342}^4\270`\3472\210\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperSilence.57.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \300%\005"
+	.string	"R\311\",\200U\351"
+	.string	"\034\222\304\261\206F\001\265\016w\305-\253$\252\365\250\021/\377\366\034.\323\026\221\304\n(PgYPr\buk{\247\024\256\250\031\257\030\035*-\215X\r\210VS\242\224\301\362\212S'RN\235\272=\344\016\024X1b_\200\335e\017j\354\013\026r\366[<3\332\275\f\b,i \362\330\376d\314.\275\343\354C\035\013\b`w\025n\216\375a\376?/h[\366G`\354\256\237\266anx\333\t\333\n\333\217\b"
+	.ascii	"3\003\366\231\241\300\367\273\206\307B\350\227q\301\245[\264"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.58.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \377\375\006"
+	.string	"\242\314/5PO\222\016\200~l\332\221r\215\266J\321\245$\034\005\232\3026\006m\343\260;6X\355Yl\\Hh\275\252\232d\252\205\024\315\217\313R\250Zf\334\"Bd\n{,\006\330\251\252\016E \002I\304\007\316\026u\301\020\204\325\213\237\007\372x \236uE<\252\340\030\202\327\023\305x\275)\313\272\217\200\215\016\nWq]<\262\315|6j\016\344\013\220\356\343\233\273hHJfF\rM\276lZJ\376N?\301$\264\366\n\013XM&v\231\034*,\231\031\302\007\003\335\214}L\263\221\354\n\211\005\212Lf>'R\254\r\273=)\207T\032\265\t4d\346\215T\322\350\256\277\301\357\360c\004\013"
+	.ascii	"7\003\200(m\21173`\2413\246\341.\327p\354\020\006\230\032\002"
+	.ascii	"\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.59.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\222\f/5@o\222\016@\265\345\343\036Db\246\340\273\222\204\217kG[g\007\214`fG\343X\r\215].y\035\254\212j\225g\020_9\226\274x;\255MYK\210L\001o,\005\250\251*\r%\360\351@\304\206\314\026uA\017\204\325\213\234\327\341l\034\236u=<j\340\350\201\327\373\304x\275)\313\272QK\031\022n\342~hdc\371\f\324\034\351{I7\372\206\225\224\222iQjI\024\314\211\307\337\351'\222\203\326\036!\001+H\304.\023c\304$33\270 \240\230\261Wi\306\221-\351\240\020Y\311\314\3476\212\265a\267!\315\204D\2406\200\205\314\274\205D\027\335\365'\370\031\376\212\013"
+	.ascii	"7\003\200(m\21173`\2413\242\341.\327\360u\b\rL\315\003wn\321"
+	.ascii	"\316'"
+	.text
+	.section	.gnu.lto_beeperUpdate.60.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"U\007"
+	.string	"r\01644`o\032\003pH\b\207=%\004\307\202\352\037\302)\n\302\311"
+	.string	"\304:\226\314xAJ\350=\310\310\262\373\207?2\013\017\217:~ \264\374\327\354\337{K\231R\325d\f2\203a\231k\300\003!7\332\303\207#\347\214\310\004\232]Sv\244\304\342\246E\216\246\331\304lz\342e\320\255#g\374l\333\214VwO\207\244V\030\032\023\220\242\006\031\375\265\264\035\350\301R\353\351\377\013I\355\203!\227R~\213\027\227\253P(\036mm\265\326\307\202_\353\020\213p\036\221(\346\037\205\234\374\235B\023\002L\035\270\24025\231\2402U\256]q\307q\233tT\224\260\374\217p\303\234\037W\233\304\230\220\b\344\007\320\360\277/$\272p\241\333\"\264uh\233\021\b"
+	.ascii	"\263\223\240Lh\320\013\f\027\002]\006\261V\243\301]^\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.61.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \325\345\005"
+	.string	"\362\312(1pK\323\001@\206\352\002\034\006\024\2140\222\242`V\\\250\216J\362\250\331\335\321\025\335\342t\321\241\252\021\200\327.1\034\256e\335Rc\333\332\336)\005~\234\031\243\030\007\240\204\240\001$P"
+	.string	"\237y"
+	.string	"\235\211e\024'D\220r\302\246\356\235e\323\367\013\207\004\247\340K<l\333\260\353\324\334e\177Yg\331\215\340W\266\313\320\301\261\031\f\006f[\262\033\177\342\024\222\351R#\252g\201-d\032\273\025R\036yg\226C\336\031\007q\372F\375W\\\222Q\325\364\366\b\330]7\252j\270\335mWl\003\330\336\b"
+	.ascii	"2\003.j\364\257BpMdF\210+D\036\356\n\245\235d"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.62.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"U\007"
+	.string	"\302\21524`O\322\001\214S\311X\035O\036\326I\247\002u\0325\366\223O"
+	.string	"\306:lC>\362Iow\367m\311Z\024\241\372\212\351^}\"\373X\321\332\2667\3312\245\336X\013RSU\032J`\302\341r\266(Lr\244\254\342\274\"\304\265y\210\026\026\021\251\002O\216\304\242\304\234X\234\266}\006\241\306\006\205\253\360GG\001\255\216\354\315\243.d_Z\307a\253\363x\bf\367\"\346eY^\312\207\355\216=\331\223\226\240\372\021\2538`\027\264r\262\273\nF"
+	.string	"\370\263\355\207\\\244\343L\332DZ\306\004\304\242\304ew\213\006'\200\177\322\007\340\237\353xv\315\374\223\\3Z>\232\347\232i\330]\353G\303\270\335m\037\330f\260-\n\013"
+	.string	"\211IEfh`\344j\200#\204W\271\3105<\302\242\341!\270"
+	.ascii	"T\236N;\311"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.63.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\355\007"
+	.string	"\362N78@o\323\001\200K\005R\3137"
+	.string	"\3427u\032\f\002\313d\025Je\007\214A6k\2746IFe\272\272\313\255,\303@\362\032d:%\302u?V1\215f\337\215\354\235R\376l\n\324\243i\236L@\242\201\223\3362\217\202(\325f\307\315\007\356\34307\017bf\005\356@\324\233\021]\347M\254\356\301+\241\024rLH\n?$a,a\307\306\027\273\206\242\324\260_\355\356Zf\330\221\223:\335\303e\367\"\006fU\254\023\223\355\317\306l\200\226\203\030\355\213|\344{5\2127\273\244\024\223\335EpGs\313\240\262\355\207\374\364\031\344\324\322(c\002\251@\245v\353t=\301uK\363\201\353\226\3348\370\b\372'y"
+	.string	"\nc\245D\024z\3140\354\256\243\205ht\313\333\356\330^\260\375\021\013"
+	.string	"\211IEfh`$k"
+	.ascii	"J\210\277\022<]\363n0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.64.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \324\335\005"
+	.string	"\"\013)1`M\222\016"
+	.string	"\255 %p\202\300\245I\263\025\006\324\036\372\275\316\321\360\221\255RL\236\371\241\220}\013"
+	.string	"L\200r\227\373B\250\302\013\307\266\326\b\221)W(\320]\234Kh\317\322\026,\b\n\255\002\031\032%\340wq\2605\274\007[Te\031\365_\320fP8\260\207;Q\221k\344+\314b\026_'\031\365\353\240\324&3\242\204$C\236\017\315\037?\272\033\345\210\017\342T\030S5\032\020\036\"\231\331\004*A}\234\002@}\330EcW\274\355\250\264\311L\230\256\211Af\2762\223Dg\375\007~\202?\006\007"
+	.ascii	"2\003v\2501\\\023\235\021\002\013\221\211\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.65.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \315\355\005"
+	.string	"4\nv"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\345\243\237\001\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\273\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\262\001\274\340\004\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\262\371\360\005"
+	.string	"\203\003\202\260\371\350\007\006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/io/beeper.c"
+	.string	"\t"
+	.ascii	"2\003\202a\251a\017!0\327p\270\210\261\204\310\341\316\231\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"]\004"
+	.string	"\224\006:\001"
+	.string	""
+	.string	""
+	.string	"\0028\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\0029\177\005:\177\006;\177\007<\177\b=\177\t>\177\n?\177\013\300"
+	.string	"\177\f\301"
+	.string	"\177\r\0057\016\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\0055\017gistry"
+	.string	""
+	.string	"\0052\020\201\204\0053\021"
+	.string	"\022\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\254\034R\226\375\345\334\006\017\235\211\357#\340\033\340\033"
+	.ascii	"\340\033\340\033\340\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\013\002\f\002\r\002\n"
+	.text
+	.section	.gnu.lto_.decls.7535b055968c34d7,"e",@progbits
+	.string	"(\265/\375`\365\017MU"
+	.string	"\252\225<!T@R:J\007\255E\272k\321\342\335\225)i\201\310\341\236\365\235\320P8UEx\334<\214\360up\225p\227\350\224\035\rma@\005\251\314\316\227\200\244\016\202\256\007\250\362;\"\022\0231EsaT<\211\264H"
+	.string	"\022x\271O\211\232\207\372\243\332\356/e\n\305\001\004\002\376\001\235\366\321\250\244\032\032\273\316\220Ci\033\t\321\312#mL\251\2205\331\334io\027\251\220&\030\323\344\321\230&\207B]L\016\273S\244\220qI\034\256QI\2054*\223\310\241.\366\260\225D#g1\2114\236I\"\205\214J\"\322X\244B\016AiU-\215n\316\206\354\023c\261{@I\021\217BLc\232l6\335\273t\352cQ\267T\362\310\206\030d\303\232\230=\232\274\020\223\233v\367"
+	.string	"PMU\311.2\215Y\311\356\254\246\032\r\245b\2302;\206e\016\217H\365\223S7\001\235vCu\017\267\231\335=\354n\236\243T\332=D\310\210\005\005\325\035%\002\252\245\206b\234\272y\211\026\2064*\253\222Gb\270(\261:G:\\\343S\262\261\232\r\325\361T\016\265\364Sw\357\234\023\013\331\202\034\256&v\231+\246\255\364!\002\001\223\206\35318W\271]\273e\300r9\003+n\033r\265Vw\032\364\363\203\225\037\354p\275\004\347\327\326"
+	.ascii	"\334rq\020\036P|p\375\212s\261\254\326nm\226M_\271\222\255\354"
+	.ascii	"N\177lD ea\270\216X\020\270\272D8\237\242_\206\003Q\365\212\363"
+	.ascii	"\3715\201\013Z\0238\036\352\340\220C\232/3-T\306\256l\377Z\355"
+	.ascii	"\277U\374\357\324\277\005\374K\300\277\006\374{\300\277#\376"
+	.ascii	"\337~~\361/\006\377n\360\257\006\377\302\370\327\202\1773\370"
+	.ascii	"\267\003\021\376U\361o\005\377N\260!\374\017\372\331\310\277"
+	.ascii	" \374;\343\337\030\377z\360/\211\377>\374\237\363\277\371_\315"
+	.ascii	"\177\346\330\177\261\377b\376\203\371/\343\377\362?\227\377\\"
+	.ascii	"\377\211\376\223\375\377Y[[[\373w\204\3376\342\367A\003\347\231"
+	.ascii	"\250\202\033#V\270\362\360t\2629\225\310\241q\301\261\342z\036"
+	.ascii	"\376\273\306\275pF\350.vw\b~\"\022\025\207\353\233\013\002\007"
+	.ascii	"\264D\270U;\372\376@\204;F\245\275\344\253%\031\031\327\037^"
+	.ascii	"s\352\274\324\251\263>lT\333\342`\3311\245\212\233\026\346 \361"
+	.ascii	"a\323rO\242T=q\3354^\036\266\207o\332\356\340S\334\264\272$\200"
+	.ascii	"vI\334\304\232\020\2670\317\263\330\251\253A\216\234\235\223"
+	.ascii	"6\013{ue\307\2244\036%\304\"]s.V\245\240\311\360$\313\251S\263"
+	.ascii	"f\3156\257\254\340\206,\221\274\301\341\333\214s\203\225V\234"
+	.ascii	"\177\331l\233\315\301f|J\366\262;\035\n\302\342B\022&iPN\214"
+	.ascii	"\035)?\270\256\233}\363\205\263hpT$\273\211\013'\350N71h\227"
+	.ascii	"\304.\211z\245\352\252\013\256\236\257\234O\027\004\356\\\"\034"
+	.ascii	"\325\3313<;[5^a\2524sM\224YX6|\325\354\226[\033\256#\306\213"
+	.ascii	"\325\037b\260\224\3558{\212\224\225-\223\261x\270\204\271j\352"
+	.ascii	"\206\230\225ua.\032\033\032\025\346\225Yn\315\234\251%\327\363"
+	.ascii	"\360\374\2669{\226\224)\263dNnc\246\316\324\230\371\222\001i"
+	.ascii	"\2115{\370B\022[\222v\346\354\341\032\033k\302C\310\320\205\257"
+	.ascii	"\263\307\f\0312+\306\004\013(\311\030\22153\354\326\212\335\260"
+	.ascii	"\214I\203x\335\252vx\023\346\311\331#',l\305\234B\335\024\307"
+	.ascii	"\n+\227v\234*\276\316W\314\355,\313I\027\256\337\252\263\307"
+	.ascii	"N\321vY\260\257\227\255\365\262`.\324\335M\335Ep8\301\365\305"
+	.ascii	"k-\255\243\244L\374\230]q\243c\277|\301<\007\237n\255\356.@\367"
+	.ascii	"\203\223\016`\\_g\267\374\317\245@\263r\302\365(\234?\256\211"
+	.ascii	"\307\356\366qK\373\330\344\203\333\333\256\211\377gm[\273\201"
+	.ascii	"\356t\367\320\242sF\tC$\302\365\377\210\206\240\207U\212D\344"
+	.ascii	"PR\330@\231\302YZh\2540\226)g\370\211\f\334\265\314(\241.\202"
+	.ascii	"y\323\3346_L\205\263\200\206C\335G\314\260\300\030\f\177\341"
+	.ascii	".\274d/\273\305_\254u\276b\254\213\370\342*e\315\236"
+	.string	"5u\256\230@5\312\341\024\320d\274`\013\255\331\300\177\324\305[\254\\fT\332>z\276`\241\315\220\306\205\275v\213\273.\"\355\023'\006\370\261\323&m\013\247\334\342\023\266\203H\016\256\314\265J2\036G\234\322\335b-A9\240\2509\341\312Y\016G\307p\007\017\256\267\246\363U\355|m\236W\316\033\232Sfh\347\353\232\3635\315\371Z\346|\235\341\374Y\ng\335\224f\350\230q\226\027\333P\366\324\024v\n-\021n\204\t+n\022t%,\t\030\023\016\226\240\001\343Z\2270\331\025\026T\f@l\234|i\201\001l\215\216\020\256\254\344t\252\\%tS`^ \302\365\254\344_5N\222\302\232\032\017\\\317\346\310\321\031I\217\031\r\315,\\}j\f\247\256\253h\255\354\3369\363\330\255\275\303FXK:\004\252\352q\224R GeDH\016\256\311T\304\355L\021J\024\256\257A\3167\340\203]"
+	.string	"\262u\027\371\302Z\201\\\257eF=p\245\313\246,\305@x\3102a\200@\313K\263;\235b\"\\\204_\330-\226\342\037\347'\206:\247g\026\376#\226\342\343z\001\271"
+	.string	"{\241\206\264\356\364\304\211\023\"N\370Di1)\272\312A8j\267J\260\220s\017f\3417b\332)[\251}mqs~K\340lkk[\002w[\232\363\2660\334B\005R\206\304\211\327y\233\226\363\266)\347mKN\241\005\201\343%\302\245X\0208\334\022\3418\007\353\340\035\177.G\346\311\006)\252\363l\324\301p\326D\nW\336\213\341x\205\263\323\237\343\321:\026\277\246\316s\023\027\377\234M\355\f\031\035\\o\373\021\257\201B\003\0310b\030\t\321%\340N8\242\204$\237\215\027(\320\367\"\b\307\317\367\""
+	.string	"&T\030\304\021C"
+	.string	"\341k\240\370\335\360\001\227\220\200\250\020e\332\001w?\243\245\244\004\222z7*\020\242\301\236\036\t|\013\"\371\b\221zK\277[o\351gCS\340\005k0\210\002\225\224v<8~\276\244\n\024\376l\377\301\001\024\006yK\350\007\"\204\257\201B\251w\303\0274\n\002\321\023x@\245\"!\022\213#\034I=\364\206\t(\220\204\\\020iH\210\304\263\264\223\341\343\335\224P!\020=\241\007#\310\323\365x;\340\004=\364\327A\220\327\243\204\366\226x6v<Jh\360FMB\203<\337\twJ@\244\245\037\n\240\245\023\320\t\220P\341\316\306\217\t\225!D\203\350\007K?\004l\370|\022 \335z\035"
+	.string	"\321 O'\354\335\360\275\300\001\024\366("
+	.ascii	"\001\334\325H\252L;\016P@\225z0P\0334v2\200\276\nB\b\221\030"
+	.ascii	"h\340\f\372\200I\274\rP&\236\f&`\004Bt)\004*\334)\375f,\365x"
+	.ascii	"=\340\016\204\340\017E%\350\371x\302\035\023\220GB\317\367\""
+	.ascii	"\004\232\324Cm\360b\374<\304}?\024h$\364\371\200F=\270'\361\200"
+	.ascii	"h\017]:\257\202\305\002,Z\240\300\363\026.R\270H\201{\013\027"
+	.ascii	"GG.X\034\235gqd\023\"\005g\240L<\341)Dj!\354\361n\360\240H\250"
+	.ascii	"\222o\003\237\357\222X\240-h\320h\201\002\200;\340\300\213\021"
+	.ascii	"38\260\340LB\001"
+	.ascii	"D\177(J\303\310\3073\352\361vLFI"
+	.string	"\300\240\021\n\001\3140\231%TW\016.c\004GC\324\231\034\\\027\253\350<\366\261E\003\301\262\211H\023e\216r\216i}\254A\201\241&L*\315S\327\244\350,&\246\306\243\205d\005:d\247NI\321y\314\317c\230L%\nuWY\205\3651J\201\036\"\217\035\260pM\352\252\234\215eQ\236\272,\\uv\262[\\\305a\"\350\240\255\031\231,\271\206\341\341!\004lI\345\374\266\211\302\001\201)\250q,\246\030532\"#\222$I:1\005\2040\007\251\343\r\021p%\263jH\222$\031\306\017\006\306\223\276(@\231\216\347\351F\201\220\216\253\204\214Rw;\t^\270\324`\"\240\326_\301\227\244\261\214RS\306l\026\330V\267\234my\t?\227\276\222\371\262~\254\317\023>\213\027\020\031\354\354l9\330\277\b;|\031\365\262\033\253\024e\020\310q\331\fV\324\206I56(u\251\234\351*"
+	.string	"Z\3420\264X\244\234\267\032\220\303YS#-\243\303\264\350-_O$E`\214\3065\2076\002k\200{\250P\352\203\t~z\356\213A~\264\253|\267\352\214`-\\\224\350\327s\356\300d\310\205\273C\rg\367\210E\335\365}B\371/\021\3661!\037%\316\277\302\350\336\277#\355\314\006c:5\237\325w\013/\303E\b\362\316\371Y0\321\257\022g\353\302\202C)\272\331\346\004K)D[\364\315T\300\367$\031\277\332\2069\r||X%@ I\202Cp&\220@\274\374h a\206\342\273\264\027\035E\206\260\243\367P'\257\020xk\314$6\221\302\007\036\343A\334\313\260\342\237\204\247\007\322\205\364\be\3041\330\210?\242:\227u+tyX\251`\230\355\263\216\023\037#~%\007\005\013~\0323\244p\030\247\037a\332D\004\272c\303\177\326\037\030g\365\220\200"
+	.string	"\021\216\223\340\303\330\177v\030|\276\206xF\314\3419RL\232\251\372\300/\237\301\316j\310\211\213c\2054\273\207\217a\316\361J\342\261\334er\311*.\204b\311\241J\230N\033T\300\371\267R\254\023\335\271<\022z~\240W\334\243ry\224\216\362\353x\\w\351v\326\210\016\215\325O|\255asC\270\316\020K\034\352\241\225"
+	.string	"\216\257\335\240\031\\\333\205\263I\002\202\bS\251c\226\027nb\314\357\b\207\001<\331K\226V@f '\002A\2654\251\035=\225"
+	.ascii	"\305B|(\033\212G\344\033A\206r\245`\236bM\022\276\324\312~\340"
+	.ascii	"\037\241& \377\250\367\301t\264<\2763F\223\257r\335h\364\356"
+	.ascii	"\304\003\310\216\232L\275\365)<E\333\341\231A\330A\240O\210N"
+	.ascii	"\r\326)\222A\253\271pE\r"
+	.text
+	.section	.gnu.lto_.symtab.7535b055968c34d7,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_beeperDevConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"beeperDevConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"beeperDevConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"beeperDevConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7535b055968c34d7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9929 @@
+	.file	"displayport_msp.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/display.h"
+	.file 7 "./src/main/msp/msp.h"
+	.file 8 "./src/main/fc/rc_modes.h"
+	.file 9 "./src/main/io/displayport_msp.h"
+	.file 10 "./src/main/io/displayport_msp.c"
+	.file 11 "/usr/include/string.h"
+	.file 12 "./src/main/msp/msp_serial.h"
+	.file 13 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	displayport_msp.c.19e3f1a5
+	.weak	displayport_msp.c.19e3f1a5
+displayport_msp.c.19e3f1a5:
+	.long	0x869
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1408
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1291
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1292
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1293
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1294
+	.uleb128 0x5
+	.long	.LASF1296
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1295
+	.uleb128 0x5
+	.long	.LASF1297
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1298
+	.uleb128 0x5
+	.long	.LASF1299
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1300
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1301
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1302
+	.uleb128 0xa
+	.long	0x8c
+	.uleb128 0x5
+	.long	.LASF1303
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1304
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1305
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1306
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1307
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0x1c
+	.long	.LASF1409
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xa
+	.long	0xbc
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1308
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1309
+	.uleb128 0x5
+	.long	.LASF1310
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x126
+	.uleb128 0x10
+	.long	.LASF1311
+	.value	0xfff
+	.uleb128 0x10
+	.long	.LASF1312
+	.value	0xf000
+	.uleb128 0x10
+	.long	.LASF1313
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1314
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1315
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x132
+	.uleb128 0x14
+	.long	0x142
+	.uleb128 0x3
+	.long	0x8a
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x161
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x15
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x161
+	.byte	0
+	.uleb128 0x4
+	.long	0x126
+	.uleb128 0xd
+	.long	.LASF1321
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x1bf
+	.uleb128 0x16
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xf3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1316
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xb0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1317
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1bf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1318
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1bf
+	.byte	0x10
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x1c4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1319
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x142
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x1bf
+	.uleb128 0x5
+	.long	.LASF1320
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x166
+	.uleb128 0xa
+	.long	0x1c9
+	.uleb128 0xd
+	.long	.LASF1322
+	.byte	0x18
+	.byte	0x6
+	.byte	0x15
+	.long	0x25c
+	.uleb128 0x2
+	.long	.LASF1323
+	.byte	0x6
+	.byte	0x16
+	.byte	0x27
+	.long	0x2fd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1324
+	.byte	0x6
+	.byte	0x17
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1325
+	.byte	0x6
+	.byte	0x18
+	.byte	0xd
+	.long	0xa4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1326
+	.byte	0x6
+	.byte	0x19
+	.byte	0xd
+	.long	0xa4
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1327
+	.byte	0x6
+	.byte	0x1a
+	.byte	0xd
+	.long	0xa4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1328
+	.byte	0x6
+	.byte	0x1b
+	.byte	0xd
+	.long	0xa4
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1329
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x9
+	.long	0x302
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1330
+	.byte	0x6
+	.byte	0x1f
+	.byte	0xc
+	.long	0x98
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1331
+	.byte	0x6
+	.byte	0x20
+	.byte	0xc
+	.long	0x98
+	.byte	0x16
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1332
+	.byte	0x58
+	.byte	0x6
+	.byte	0x23
+	.long	0x2f8
+	.uleb128 0x2
+	.long	.LASF1333
+	.byte	0x6
+	.byte	0x24
+	.byte	0xb
+	.long	0x32e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1334
+	.byte	0x6
+	.byte	0x25
+	.byte	0xb
+	.long	0x32e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1335
+	.byte	0x6
+	.byte	0x26
+	.byte	0xb
+	.long	0x32e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1336
+	.byte	0x6
+	.byte	0x27
+	.byte	0xb
+	.long	0x32e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1337
+	.byte	0x6
+	.byte	0x28
+	.byte	0xb
+	.long	0x347
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1338
+	.byte	0x6
+	.byte	0x29
+	.byte	0xb
+	.long	0x36a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1339
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xb
+	.long	0x38d
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1340
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xb
+	.long	0x3a1
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1341
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x32e
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1342
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xc
+	.long	0x3b1
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1343
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x10
+	.long	0x3c5
+	.byte	0x50
+	.byte	0
+	.uleb128 0xa
+	.long	0x25c
+	.uleb128 0x4
+	.long	0x2f8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1344
+	.uleb128 0x5
+	.long	.LASF1345
+	.byte	0x6
+	.byte	0x21
+	.byte	0x3
+	.long	0x1da
+	.uleb128 0xa
+	.long	0x309
+	.uleb128 0xb
+	.long	0x70
+	.long	0x329
+	.uleb128 0x3
+	.long	0x329
+	.byte	0
+	.uleb128 0x4
+	.long	0x309
+	.uleb128 0x4
+	.long	0x31a
+	.uleb128 0xb
+	.long	0x70
+	.long	0x342
+	.uleb128 0x3
+	.long	0x342
+	.byte	0
+	.uleb128 0x4
+	.long	0x315
+	.uleb128 0x4
+	.long	0x333
+	.uleb128 0xb
+	.long	0x70
+	.long	0x36a
+	.uleb128 0x3
+	.long	0x329
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x4
+	.long	0x34c
+	.uleb128 0xb
+	.long	0x70
+	.long	0x38d
+	.uleb128 0x3
+	.long	0x329
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.uleb128 0x4
+	.long	0x36f
+	.uleb128 0xb
+	.long	0x302
+	.long	0x3a1
+	.uleb128 0x3
+	.long	0x342
+	.byte	0
+	.uleb128 0x4
+	.long	0x392
+	.uleb128 0x14
+	.long	0x3b1
+	.uleb128 0x3
+	.long	0x329
+	.byte	0
+	.uleb128 0x4
+	.long	0x3a6
+	.uleb128 0xb
+	.long	0xbc
+	.long	0x3c5
+	.uleb128 0x3
+	.long	0x342
+	.byte	0
+	.uleb128 0x4
+	.long	0x3b6
+	.uleb128 0x5
+	.long	.LASF1346
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x3
+	.long	0x25c
+	.uleb128 0xa
+	.long	0x3ca
+	.uleb128 0xd
+	.long	.LASF1347
+	.byte	0x5
+	.byte	0x6
+	.byte	0x31
+	.long	0x429
+	.uleb128 0x2
+	.long	.LASF1348
+	.byte	0x6
+	.byte	0x32
+	.byte	0xc
+	.long	0x98
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1349
+	.byte	0x6
+	.byte	0x33
+	.byte	0xc
+	.long	0x98
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1350
+	.byte	0x6
+	.byte	0x34
+	.byte	0x9
+	.long	0x302
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1351
+	.byte	0x6
+	.byte	0x35
+	.byte	0xd
+	.long	0xa4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1352
+	.byte	0x6
+	.byte	0x36
+	.byte	0xd
+	.long	0xa4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1353
+	.byte	0x6
+	.byte	0x37
+	.byte	0x3
+	.long	0x3db
+	.uleb128 0xa
+	.long	0x429
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x7
+	.byte	0x1e
+	.long	0x452
+	.uleb128 0x1
+	.long	.LASF1354
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1355
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1356
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x43a
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.long	0x54e
+	.uleb128 0x1
+	.long	.LASF1357
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1358
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1359
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1360
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1361
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1363
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1365
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1366
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1367
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1368
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1371
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1389
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1390
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1391
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1392
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1393
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0x25
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1395
+	.byte	0x9
+	.byte	0x17
+	.byte	0x1d
+	.long	0x429
+	.uleb128 0xe
+	.long	.LASF1396
+	.byte	0x9
+	.byte	0x17
+	.byte	0x57
+	.long	0x429
+	.uleb128 0x17
+	.long	0x54e
+	.byte	0x16
+	.uleb128 0x17
+	.long	0x55a
+	.byte	0x49
+	.uleb128 0xe
+	.long	.LASF1397
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x7f
+	.long	0x1d5
+	.uleb128 0x1e
+	.long	0x572
+	.byte	0xb2
+	.uleb128 0xc
+	.long	.LASF1399
+	.byte	0x2c
+	.byte	0x16
+	.long	0x309
+	.uleb128 0xe
+	.long	.LASF1398
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x10
+	.long	0xa4
+	.uleb128 0xc
+	.long	.LASF1400
+	.byte	0x95
+	.byte	0x22
+	.long	0x3d6
+	.uleb128 0x18
+	.long	.LASF1401
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8a
+	.long	0x5c6
+	.uleb128 0x3
+	.long	0x8a
+	.uleb128 0x3
+	.long	0x5c6
+	.uleb128 0x3
+	.long	0xc8
+	.byte	0
+	.uleb128 0x4
+	.long	0x5cb
+	.uleb128 0x1f
+	.uleb128 0x20
+	.long	.LASF1402
+	.byte	0xb
+	.value	0x197
+	.byte	0xf
+	.long	0xc8
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1403
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x5
+	.long	0x70
+	.long	0x608
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x1bf
+	.uleb128 0x3
+	.long	0x70
+	.uleb128 0x3
+	.long	0x452
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1410
+	.byte	0xc
+	.byte	0x5d
+	.byte	0xa
+	.long	0xbc
+	.uleb128 0x22
+	.long	.LASF1411
+	.byte	0x6
+	.byte	0x47
+	.byte	0x6
+	.long	0x62b
+	.uleb128 0x3
+	.long	0x329
+	.uleb128 0x3
+	.long	0x62b
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d6
+	.uleb128 0x23
+	.long	.LASF1412
+	.byte	0xa
+	.byte	0xa3
+	.byte	0x10
+	.long	0x329
+	.uleb128 0x8
+	.long	.LASF1343
+	.byte	0x8f
+	.byte	0x11
+	.long	0xbc
+	.long	0x657
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x8f
+	.byte	0x32
+	.long	0x342
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1342
+	.byte	0xa
+	.byte	0x89
+	.byte	0xd
+	.long	0x66f
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x89
+	.byte	0x23
+	.long	0x329
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1340
+	.byte	0x83
+	.byte	0xc
+	.long	0x302
+	.long	0x68a
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x83
+	.byte	0x36
+	.long	0x342
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1339
+	.byte	0x7a
+	.byte	0xc
+	.long	0x70
+	.long	0x6cf
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x7a
+	.byte	0x25
+	.long	0x329
+	.uleb128 0x9
+	.string	"col"
+	.byte	0x7a
+	.byte	0x3a
+	.long	0xa4
+	.uleb128 0x9
+	.string	"row"
+	.byte	0x7a
+	.byte	0x47
+	.long	0xa4
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x7a
+	.byte	0x54
+	.long	0xa4
+	.uleb128 0x11
+	.string	"buf"
+	.byte	0x7c
+	.byte	0xa
+	.long	0x6cf
+	.byte	0
+	.uleb128 0x12
+	.long	0x8c
+	.long	0x6df
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1338
+	.byte	0x67
+	.byte	0xc
+	.long	0x70
+	.long	0x731
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x67
+	.byte	0x27
+	.long	0x329
+	.uleb128 0x9
+	.string	"col"
+	.byte	0x67
+	.byte	0x3c
+	.long	0xa4
+	.uleb128 0x9
+	.string	"row"
+	.byte	0x67
+	.byte	0x49
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF1405
+	.byte	0x67
+	.byte	0x5a
+	.long	0xd4
+	.uleb128 0x11
+	.string	"buf"
+	.byte	0x6a
+	.byte	0xd
+	.long	0x731
+	.uleb128 0x11
+	.string	"len"
+	.byte	0x6c
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x12
+	.long	0xa4
+	.long	0x741
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x21
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1337
+	.byte	0x62
+	.byte	0xc
+	.long	0x70
+	.long	0x75c
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x62
+	.byte	0x2c
+	.long	0x342
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1336
+	.byte	0x5c
+	.byte	0xc
+	.long	0x70
+	.long	0x782
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x5c
+	.byte	0x26
+	.long	0x329
+	.uleb128 0xc
+	.long	.LASF1406
+	.byte	0x5e
+	.byte	0xd
+	.long	0x782
+	.byte	0
+	.uleb128 0x12
+	.long	0xa4
+	.long	0x792
+	.uleb128 0x13
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1335
+	.byte	0x55
+	.byte	0xc
+	.long	0x70
+	.long	0x7b8
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x55
+	.byte	0x27
+	.long	0x329
+	.uleb128 0xc
+	.long	.LASF1406
+	.byte	0x57
+	.byte	0xd
+	.long	0x782
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1334
+	.byte	0x4e
+	.byte	0xc
+	.long	0x70
+	.long	0x7de
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x4e
+	.byte	0x23
+	.long	0x329
+	.uleb128 0xc
+	.long	.LASF1406
+	.byte	0x50
+	.byte	0xd
+	.long	0x782
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1333
+	.byte	0x49
+	.byte	0xc
+	.long	0x70
+	.long	0x7f9
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x49
+	.byte	0x20
+	.long	0x329
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1341
+	.byte	0x3f
+	.byte	0xc
+	.long	0x70
+	.long	0x81f
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x3f
+	.byte	0x25
+	.long	0x329
+	.uleb128 0xc
+	.long	.LASF1406
+	.byte	0x41
+	.byte	0xd
+	.long	0x782
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1407
+	.byte	0x32
+	.byte	0xc
+	.long	0x70
+	.long	0x85b
+	.uleb128 0x6
+	.long	.LASF1404
+	.byte	0x32
+	.byte	0x22
+	.long	0x329
+	.uleb128 0x9
+	.string	"cmd"
+	.byte	0x32
+	.byte	0x37
+	.long	0xa4
+	.uleb128 0x9
+	.string	"buf"
+	.byte	0x32
+	.byte	0x45
+	.long	0x1bf
+	.uleb128 0x9
+	.string	"len"
+	.byte	0x32
+	.byte	0x4e
+	.long	0x70
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1413
+	.byte	0x9
+	.byte	0x17
+	.byte	0x9d
+	.long	0x867
+	.uleb128 0x4
+	.long	0x435
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 42
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF727
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 36 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.file 37 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 38 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 39 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.file 40 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x4
+	.file 42 "./src/main/fc/fc_msp.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.file 43 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.byte	0x4
+	.file 44 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1290
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF735
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.46a70d544f77cb07ab69aafc19a8be6f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF793
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF832
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF853
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF855
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF903
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF933
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF934
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF953
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF968
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF995
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1106
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.59.465b2f7532a4846ee89798d0d344cbd1,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1289
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1414
+	.long	.LASF1415
+	.long	.LASF1416
+	.long	.LASF1417
+	.long	.LASF1418
+	.long	.LASF1419
+	.long	.LASF1420
+	.long	.LASF1421
+	.long	.LASF1422
+	.long	.LASF1423
+	.long	.LASF1424
+	.long	.LASF1425
+	.long	.LASF1426
+	.long	.LASF1427
+	.long	.LASF1428
+	.long	.LASF1429
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1430
+	.byte	0xc
+	.long	.LASF1431
+	.byte	0xc
+	.long	.LASF1432
+	.byte	0xc
+	.long	.LASF1433
+	.byte	0x10
+	.long	.LASF1434
+	.byte	0x3
+	.long	.LASF1435
+	.byte	0x4
+	.long	.LASF1436
+	.byte	0x7
+	.long	.LASF1437
+	.byte	0x5
+	.long	.LASF1438
+	.byte	0x6
+	.long	.LASF1439
+	.byte	0x6
+	.long	.LASF1440
+	.byte	0xf
+	.long	.LASF1441
+	.byte	0x7
+	.long	.LASF1442
+	.byte	0x8
+	.long	.LASF1443
+	.byte	0xf
+	.long	.LASF1444
+	.byte	0x10
+	.long	.LASF1445
+	.byte	0x10
+	.long	.LASF1445
+	.byte	0xf
+	.long	.LASF1446
+	.byte	0xc
+	.long	.LASF1447
+	.byte	0xf
+	.long	.LASF1448
+	.byte	0xf
+	.long	.LASF1449
+	.byte	0xc
+	.long	.LASF1450
+	.byte	0xc
+	.long	.LASF1451
+	.byte	0xe
+	.long	.LASF1452
+	.byte	0xc
+	.long	.LASF1453
+	.byte	0xd
+	.long	.LASF1454
+	.byte	0xd
+	.long	.LASF1455
+	.byte	0xc
+	.long	.LASF1456
+	.byte	0xc
+	.long	.LASF1457
+	.byte	0xc
+	.long	.LASF1458
+	.byte	0xb
+	.long	.LASF1459
+	.byte	0xb
+	.long	.LASF1460
+	.byte	0xf
+	.long	.LASF1461
+	.byte	0xf
+	.long	.LASF1462
+	.byte	0xc
+	.long	.LASF1463
+	.byte	0xc
+	.long	.LASF1464
+	.byte	0xa
+	.long	.LASF1465
+	.byte	0x9
+	.long	.LASF1466
+	.byte	0x9
+	.long	.LASF1467
+	.byte	0x2
+	.long	.LASF1468
+	.byte	0x1
+	.long	.LASF1469
+	.byte	0x3
+	.long	.LASF1470
+	.byte	0x5
+	.long	.LASF1471
+	.byte	0x2
+	.long	.LASF1472
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF747:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1348:
+	.string	"colAdjust"
+.LASF825:
+	.string	"TELEMETRY_CRSF "
+.LASF1080:
+	.string	"PG_OSD_CONFIG 501"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1252:
+	.string	"MSP_SET_MOTOR_3D_CONFIG 217"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1303:
+	.string	"int8_t"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF816:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1307:
+	.string	"size_t"
+.LASF1122:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF1382:
+	.string	"BOXSERVO3"
+.LASF1369:
+	.string	"BOXPASSTHRU"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1096:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1290:
+	.string	"MSP_OSD_MAX_STRING_LENGTH 30"
+.LASF1087:
+	.string	"PG_PWM_CONFIG 508"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1115:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1322:
+	.string	"displayPort_s"
+.LASF1345:
+	.string	"displayPort_t"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1117:
+	.string	"API_VERSION_MINOR 36"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF762:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF794:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1194:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1057:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1217:
+	.string	"MSP_ATTITUDE 108"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1177:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF1158:
+	.string	"MSP_SET_MIXER_CONFIG 43"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1020:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1212:
+	.string	"MSP_SERVO 103"
+.LASF959:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1242:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1326:
+	.string	"cols"
+.LASF963:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF761:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1235:
+	.string	"MSP_BATTERY_STATE 130"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1134:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF763:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1257:
+	.string	"MSP_SET_MOTOR_CONFIG 222"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF872:
+	.string	"USE_UART1 "
+.LASF1173:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF1199:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1170:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF953:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1357:
+	.string	"BOXARM"
+.LASF793:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1354:
+	.string	"MSP_DIRECTION_REPLY"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF878:
+	.string	"USE_UART7 "
+.LASF1133:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1088:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1116:
+	.string	"API_VERSION_MAJOR 1"
+.LASF754:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1391:
+	.string	"BOXCAMERA3"
+.LASF1098:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1183:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF1406:
+	.string	"subcmd"
+.LASF781:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF845:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF976:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1123:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF811:
+	.string	"USE_SERIALRX_SUMD "
+.LASF952:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF840:
+	.string	"VTX_TRAMP "
+.LASF887:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF879:
+	.string	"USE_UART8 "
+.LASF774:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF1037:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1148:
+	.string	"MSP_SET_BATTERY_CONFIG 33"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF751:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1404:
+	.string	"displayPort"
+.LASF1308:
+	.string	"double"
+.LASF729:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF775:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF989:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1238:
+	.string	"MSP_COMPASS_CONFIG 133"
+.LASF1270:
+	.string	"MSP_DATAFLASH_STREAM_DATA 154"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1394:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1222:
+	.string	"MSP_BOXNAMES 116"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF738:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1287:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF863:
+	.string	"USE_FAKE_GYRO "
+.LASF1225:
+	.string	"MSP_BOXIDS 119"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1036:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1090:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1029:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF852:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF758:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1025:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF839:
+	.string	"VTX_SMARTAUDIO "
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1251:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1206:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF921:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF755:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF765:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1189:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF833:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF808:
+	.string	"USE_SERIALRX_IBUS "
+.LASF752:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF822:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1250:
+	.string	"MSP_SET_MOTOR 214"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1228:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF1301:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1144:
+	.string	"MSP_BUILD_INFO 5"
+.LASF902:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1312:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1352:
+	.string	"whiteBrightness"
+.LASF778:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1006:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF928:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1169:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF1243:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF779:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF832:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF883:
+	.string	"STACK_CHECK"
+.LASF731:
+	.string	"__PDP_ENDIAN 3412"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1082:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"MSP_BOARD_INFO 4"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1318:
+	.string	"copy"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1010:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF884:
+	.string	"USE_DASHBOARD"
+.LASF897:
+	.string	"USE_SERIALRX_XBUS"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1313:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF788:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1338:
+	.string	"writeString"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1221:
+	.string	"MSP_PID 112"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF817:
+	.string	"TELEMETRY "
+.LASF1233:
+	.string	"MSP_VOLTAGE_METERS 128"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1411:
+	.string	"displayInit"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1351:
+	.string	"blackBrightness"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1097:
+	.string	"PG_I2C_CONFIG 518"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1018:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1121:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1249:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1149:
+	.string	"MSP_MODE_RANGES 34"
+.LASF1190:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1009:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1195:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF1295:
+	.string	"signed char"
+.LASF1065:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1304:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1008:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF895:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1193:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF970:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF771:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1076:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1043:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF831:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF907:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF888:
+	.string	"USE_PPM"
+.LASF1230:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF1054:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1377:
+	.string	"BOXTELEMETRY"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF748:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1291:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1395:
+	.string	"displayPortProfileMsp_System"
+.LASF756:
+	.string	"isascii(c) __isascii (c)"
+.LASF1108:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF736:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF870:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1341:
+	.string	"heartbeat"
+.LASF1159:
+	.string	"MSP_RX_CONFIG 44"
+.LASF1049:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1314:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1202:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF919:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1356:
+	.string	"mspDirection_e"
+.LASF1201:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF1283:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF965:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF874:
+	.string	"USE_UART3 "
+.LASF828:
+	.string	"TELEMETRY_MAVLINK "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1079:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1375:
+	.string	"BOXGOV"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1383:
+	.string	"BOXBLACKBOX"
+.LASF1344:
+	.string	"_Bool"
+.LASF767:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF810:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1140:
+	.string	"MSP_API_VERSION 1"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1364:
+	.string	"BOXHEADADJ"
+.LASF1051:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1103:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF1302:
+	.string	"char"
+.LASF1002:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF803:
+	.string	"USE_CLI_BATCH "
+.LASF1232:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1277:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF975:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF1407:
+	.string	"output"
+.LASF753:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF1368:
+	.string	"BOXGPSHOLD"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1331:
+	.string	"grabCount"
+.LASF908:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1151:
+	.string	"MSP_FEATURE_CONFIG 36"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1154:
+	.string	"MSP_SET_BOARD_ALIGNMENT_CONFIG 39"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1141:
+	.string	"MSP_FC_VARIANT 2"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1299:
+	.string	"__uint16_t"
+.LASF979:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF955:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF757:
+	.string	"toascii(c) __toascii (c)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1412:
+	.string	"displayPortMspInit"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1333:
+	.string	"grab"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF957:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1325:
+	.string	"rows"
+.LASF994:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1266:
+	.string	"MSP_STATUS_EX 150"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF782:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF760:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1240:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1367:
+	.string	"BOXGPSHOME"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1030:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1269:
+	.string	"MSP_DATAFLASH_READ_STREAM 153"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF773:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF968:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1089:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1131:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF946:
+	.string	"___int_wchar_t_h "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF982:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF910:
+	.string	"VTX_CONTROL"
+.LASF985:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1208:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF743:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1187:
+	.string	"MSP_SET_RXFAIL_CONFIG 78"
+.LASF846:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF911:
+	.string	"VTX_SMARTAUDIO"
+.LASF1084:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1055:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1112:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1397:
+	.string	"displayPortProfileMsp_Registry"
+.LASF1271:
+	.string	"MSP_DATAFLASH_STREAM_ACK 155"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF937:
+	.string	"_WCHAR_T "
+.LASF1167:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF847:
+	.string	"SIMULATOR_BUILD "
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF792:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1145:
+	.string	"MSP_NAME 10"
+.LASF1078:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1234:
+	.string	"MSP_CURRENT_METERS 129"
+.LASF809:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1147:
+	.string	"MSP_BATTERY_CONFIG 32"
+.LASF1130:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF956:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1237:
+	.string	"MSP_GPS_CONFIG 132"
+.LASF1365:
+	.string	"BOXCAMSTAB"
+.LASF988:
+	.string	"BIT(x) (1 << (x))"
+.LASF978:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1297:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1107:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1260:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF942:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1371:
+	.string	"BOXLEDMAX"
+.LASF1216:
+	.string	"MSP_COMP_GPS 107"
+.LASF1256:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1013:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1311:
+	.string	"PGR_PGN_MASK"
+.LASF990:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF903:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1296:
+	.string	"__int8_t"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF974:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF853:
+	.string	"U_ID_2 2"
+.LASF1211:
+	.string	"MSP_RAW_IMU 102"
+.LASF862:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF898:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF929:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1403:
+	.string	"mspSerialPush"
+.LASF1282:
+	.string	"MSP_SET_4WAY_IF 245"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1120:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF969:
+	.string	"NOOP do {} while (0)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF805:
+	.string	"USE_PWM "
+.LASF1181:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF835:
+	.string	"USE_SENSOR_NAMES "
+.LASF1028:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1280:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF826:
+	.string	"TELEMETRY_IBUS "
+.LASF1220:
+	.string	"MSP_RC_TUNING 111"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1074:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1248:
+	.string	"MSP_SET_HEADING 211"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF791:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1095:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF739:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF967:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1136:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1317:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1409:
+	.string	"SystemCoreClock"
+.LASF961:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1196:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF954:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1339:
+	.string	"writeChar"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1385:
+	.string	"BOXAIRMODE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1273:
+	.string	"MSP_SETTING_INFO 157"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1268:
+	.string	"MSP_TRACE_READ 152"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1182:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1200:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF917:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF728:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF836:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF920:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF759:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF984:
+	.string	"PP_IIF_0(t,f) f"
+.LASF766:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF995:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF866:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1258:
+	.string	"MSP_SET_GPS_CONFIG 223"
+.LASF789:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1003:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1113:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF750:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF880:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF930:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1012:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1064:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF925:
+	.string	"_T_PTRDIFF_ "
+.LASF1066:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1410:
+	.string	"mspSerialTxBytesFree"
+.LASF1285:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF901:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF850:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF960:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1388:
+	.string	"BOXBLACKBOXERASE"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1038:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF732:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF889:
+	.string	"USE_PWM"
+.LASF1160:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF1231:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1275:
+	.string	"MSP_UID 160"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1255:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1300:
+	.string	"__uint32_t"
+.LASF1179:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF1215:
+	.string	"MSP_RAW_GPS 106"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1262:
+	.string	"MSP_RESERVE_2 252"
+.LASF983:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF890:
+	.string	"SERIAL_RX"
+.LASF1100:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1150:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF737:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF935:
+	.string	"__wchar_t__ "
+.LASF777:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF802:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF868:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1413:
+	.string	"displayPortProfileMsp"
+.LASF1022:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1014:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1286:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF1021:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1048:
+	.string	"PG_GPS_CONFIG 30"
+.LASF940:
+	.string	"__WCHAR_T "
+.LASF1072:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF909:
+	.string	"VTX_COMMON"
+.LASF1288:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1156:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF1114:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1214:
+	.string	"MSP_RC 105"
+.LASF1146:
+	.string	"MSP_SET_NAME 11"
+.LASF1168:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF468:
+	.string	"__PMT"
+.LASF1086:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1111:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1229:
+	.string	"MSP_MOTOR_3D_CONFIG 124"
+.LASF1163:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF1259:
+	.string	"MSP_SET_COMPASS_CONFIG 224"
+.LASF1265:
+	.string	"MSP_RESERVE_3 255"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF855:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF896:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1329:
+	.string	"cleared"
+.LASF392:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1355:
+	.string	"MSP_DIRECTION_REQUEST"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF923:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF977:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1349:
+	.string	"rowAdjust"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF821:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF842:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF1126:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF1236:
+	.string	"MSP_MOTOR_CONFIG 131"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1319:
+	.string	"reset"
+.LASF1340:
+	.string	"isTransferInProgress"
+.LASF1405:
+	.string	"string"
+.LASF1330:
+	.string	"cursorRow"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1293:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF999:
+	.string	"UNIT_TESTED "
+.LASF1152:
+	.string	"MSP_SET_FEATURE_CONFIG 37"
+.LASF1093:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1119:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF1337:
+	.string	"screenSize"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1205:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF1132:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF814:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1017:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1104:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF922:
+	.string	"_STDDEF_H_ "
+.LASF949:
+	.string	"_WCHAR_T_DECLARED "
+.LASF820:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1102:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1157:
+	.string	"MSP_MIXER_CONFIG 42"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF926:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF785:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF924:
+	.string	"_PTRDIFF_T "
+.LASF1267:
+	.string	"MSP_TASK_LATENCY 151"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1310:
+	.string	"pgn_t"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1321:
+	.string	"pgRegistry_s"
+.LASF1320:
+	.string	"pgRegistry_t"
+.LASF1110:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1185:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF899:
+	.string	"TELEMETRY_FRSKY"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1203:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF398:
+	.string	"false 0"
+.LASF1399:
+	.string	"mspDisplayPort"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1052:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1174:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF397:
+	.string	"true 1"
+.LASF932:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF860:
+	.string	"ACC "
+.LASF834:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1166:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF1067:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1034:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1360:
+	.string	"BOXBARO"
+.LASF1335:
+	.string	"clearScreen"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1172:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"BOXLEDLOW"
+.LASF881:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF848:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1101:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1254:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF1278:
+	.string	"MSP_ACC_TRIM 240"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1186:
+	.string	"MSP_RXFAIL_CONFIG 77"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF1400:
+	.string	"mspDisplayPortVTable"
+.LASF1050:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1192:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF864:
+	.string	"MAG "
+.LASF1171:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1387:
+	.string	"BOXFPVANGLEMIX"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1155:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF867:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF824:
+	.string	"TELEMETRY_LTM "
+.LASF931:
+	.string	"_GCC_PTRDIFF_T "
+.LASF844:
+	.string	"USE_NAV "
+.LASF749:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF1198:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF1069:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1244:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1279:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF945:
+	.string	"_WCHAR_T_H "
+.LASF1209:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF1373:
+	.string	"BOXLLIGHTS"
+.LASF915:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1041:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1042:
+	.string	"PG_RX_CONFIG 24"
+.LASF1023:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1081:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1381:
+	.string	"BOXSERVO2"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF744:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF865:
+	.string	"USE_FAKE_MAG "
+.LASF912:
+	.string	"VTX_TRAMP"
+.LASF1162:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF882:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1191:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF1033:
+	.string	"PG_PID_PROFILE 14"
+.LASF861:
+	.string	"USE_FAKE_ACC "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1292:
+	.string	"short unsigned int"
+.LASF1379:
+	.string	"BOXSONAR"
+.LASF807:
+	.string	"USE_SERIALRX_CRSF "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF815:
+	.string	"BLACKBOX "
+.LASF972:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF857:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1281:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF1188:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF892:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1408:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1059:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1175:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1063:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF948:
+	.string	"_GCC_WCHAR_T "
+.LASF1218:
+	.string	"MSP_ALTITUDE 109"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF971:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF841:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF790:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1075:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1213:
+	.string	"MSP_MOTOR 104"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1035:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1137:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF1324:
+	.string	"device"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1316:
+	.string	"size"
+.LASF1359:
+	.string	"BOXHORIZON"
+.LASF913:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF389:
+	.string	"SITL 1"
+.LASF992:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1245:
+	.string	"MSP_RESET_CONF 208"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1045:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1305:
+	.string	"uint16_t"
+.LASF962:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1393:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF927:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF784:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1294:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1197:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF1047:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1396:
+	.string	"displayPortProfileMsp_Copy"
+.LASF1210:
+	.string	"MSP_STATUS 101"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1350:
+	.string	"invert"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF730:
+	.string	"__BIG_ENDIAN 4321"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1070:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1016:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1366:
+	.string	"BOXCAMTRIG"
+.LASF914:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF891:
+	.string	"USE_SERIALRX_CRSF"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF776:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF944:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1241:
+	.string	"MSP_SET_PID 202"
+.LASF823:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1004:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1105:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1398:
+	.string	"cliMode"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF916:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1044:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF764:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1276:
+	.string	"MSP_GPSSVINFO 164"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1184:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF1380:
+	.string	"BOXSERVO1"
+.LASF939:
+	.string	"_T_WCHAR "
+.LASF858:
+	.string	"USE_FAKE_LED "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1031:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF768:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF804:
+	.string	"USE_PPM "
+.LASF918:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1247:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF1128:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF780:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF849:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1392:
+	.string	"BOXDSHOTREVERSE"
+.LASF1060:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1056:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF941:
+	.string	"_WCHAR_T_ "
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF993:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF943:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1129:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF893:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1127:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF997:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1180:
+	.string	"MSP_REBOOT 68"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1207:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF1284:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1253:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF856:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1005:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF877:
+	.string	"USE_UART6 "
+.LASF806:
+	.string	"SERIAL_RX "
+.LASF843:
+	.string	"GPS "
+.LASF1219:
+	.string	"MSP_ANALOG 110"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF772:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1085:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF745:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF837:
+	.string	"VTX_COMMON "
+.LASF1071:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1027:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF886:
+	.string	"USE_ADC"
+.LASF1058:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1011:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1161:
+	.string	"MSP_LED_COLORS 46"
+.LASF769:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1204:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF1007:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF786:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1046:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1106:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF770:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1091:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF973:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1298:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1062:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1039:
+	.string	"PG_SERVO_MIXER 21"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF742:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1327:
+	.string	"posX"
+.LASF1328:
+	.string	"posY"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1032:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF819:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1347:
+	.string	"displayPortProfile_s"
+.LASF1353:
+	.string	"displayPortProfile_t"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF830:
+	.string	"USE_DASHBOARD "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1000:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1336:
+	.string	"drawScreen"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF829:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF934:
+	.string	"__need_ptrdiff_t"
+.LASF1261:
+	.string	"MSP_RESERVE_1 251"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1026:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF885:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1001:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1077:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF966:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF801:
+	.string	"USE_CLI "
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF936:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1142:
+	.string	"MSP_FC_VERSION 3"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1138:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF950:
+	.string	"__DEFINED_wchar_t "
+.LASF1053:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF987:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF998:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1370:
+	.string	"BOXBEEPERON"
+.LASF838:
+	.string	"VTX_CONTROL "
+.LASF1164:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1289:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1389:
+	.string	"BOXCAMERA1"
+.LASF1390:
+	.string	"BOXCAMERA2"
+.LASF1402:
+	.string	"strlen"
+.LASF746:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1165:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF980:
+	.string	"EXPAND_I(x) x"
+.LASF1378:
+	.string	"BOXGTUNE"
+.LASF1332:
+	.string	"displayPortVTable_s"
+.LASF1346:
+	.string	"displayPortVTable_t"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1139:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF1109:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF854:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF991:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1401:
+	.string	"memcpy"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1358:
+	.string	"BOXANGLE"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1264:
+	.string	"MSP_DEBUG 254"
+.LASF1386:
+	.string	"BOX3DDISABLE"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF873:
+	.string	"USE_UART2 "
+.LASF938:
+	.string	"_T_WCHAR_ "
+.LASF1153:
+	.string	"MSP_BOARD_ALIGNMENT_CONFIG 38"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1019:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF951:
+	.string	"_BSD_WCHAR_T_"
+.LASF1061:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1083:
+	.string	"PG_PID_CONFIG 504"
+.LASF1239:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF733:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1306:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1118:
+	.string	"API_VERSION_LENGTH 2"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1176:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF735:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF727:
+	.string	"_CTYPE_H 1"
+.LASF1263:
+	.string	"MSP_DEBUGMSG 253"
+.LASF947:
+	.string	"__INT_WCHAR_T_H "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1334:
+	.string	"release"
+.LASF1374:
+	.string	"BOXCALIB"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1040:
+	.string	"PG_IMU_CONFIG 22"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1068:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF851:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1094:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1099:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF958:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF795:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF783:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF1363:
+	.string	"BOXHEADFREE"
+.LASF1309:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1015:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1343:
+	.string	"txBytesFree"
+.LASF813:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1226:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF741:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1315:
+	.string	"pgResetFunc"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1124:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF1223:
+	.string	"MSP_PIDNAMES 117"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1125:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF1024:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF827:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF812:
+	.string	"USE_SERIALRX_SUMH "
+.LASF933:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1073:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF740:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1246:
+	.string	"MSP_SET_WP 209"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF900:
+	.string	"TELEMETRY_HOTT"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF875:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF859:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF981:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1384:
+	.string	"BOXFAILSAFE"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1323:
+	.string	"vTable"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1135:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF869:
+	.string	"USE_FAKE_FLASH "
+.LASF1227:
+	.string	"MSP_NAV_STATUS 121"
+.LASF964:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1178:
+	.string	"MSP_RX_MAP 64"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1272:
+	.string	"MSP_SETTING 156"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF996:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF734:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1342:
+	.string	"resync"
+.LASF818:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1361:
+	.string	"BOXANTIGRAVITY"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1274:
+	.string	"MSP_SET_SETTING 158"
+.LASF1224:
+	.string	"MSP_WP 118"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1376:
+	.string	"BOXOSD"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF871:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF876:
+	.string	"USE_UART5 "
+.LASF1362:
+	.string	"BOXMAG"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF905:
+	.string	"TELEMETRY_IBUS"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF1092:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF986:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1471:
+	.string	"streambuf.h"
+.LASF1452:
+	.string	"long-double.h"
+.LASF1459:
+	.string	"__locale_t.h"
+.LASF1464:
+	.string	"platform.h"
+.LASF1417:
+	.string	"src/main/drivers"
+.LASF1446:
+	.string	"libc-header-start.h"
+.LASF1427:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1462:
+	.string	"endian.h"
+.LASF1431:
+	.string	"stdint-intn.h"
+.LASF1442:
+	.string	"target.h"
+.LASF1465:
+	.string	"common_fc_pre.h"
+.LASF1426:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1429:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1435:
+	.string	"display.h"
+.LASF1421:
+	.string	"src/main/target/SITL"
+.LASF1441:
+	.string	"msp_serial.h"
+.LASF1419:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1420:
+	.string	"src/main/msp"
+.LASF0:
+	.string	"./src/main/io/displayport_msp.c"
+.LASF1460:
+	.string	"strings.h"
+.LASF1448:
+	.string	"features-time64.h"
+.LASF1430:
+	.string	"types.h"
+.LASF1425:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1450:
+	.string	"timesize.h"
+.LASF1444:
+	.string	"stdbool.h"
+.LASF1428:
+	.string	"/usr/include"
+.LASF1466:
+	.string	"common_fc_post.h"
+.LASF1414:
+	.string	"src/main/build"
+.LASF1456:
+	.string	"time64.h"
+.LASF1447:
+	.string	"features.h"
+.LASF1455:
+	.string	"typesizes.h"
+.LASF1415:
+	.string	"src/main/common"
+.LASF1416:
+	.string	"src/main/config"
+.LASF1437:
+	.string	"rc_modes.h"
+.LASF1432:
+	.string	"stdint-uintn.h"
+.LASF1422:
+	.string	"src/main/target"
+.LASF1467:
+	.string	"utils.h"
+.LASF1439:
+	.string	"displayport_msp.c"
+.LASF1438:
+	.string	"displayport_msp.h"
+.LASF1423:
+	.string	"src/main"
+.LASF1469:
+	.string	"parameter_group_ids.h"
+.LASF1457:
+	.string	"wchar.h"
+.LASF1418:
+	.string	"src/main/fc"
+.LASF1453:
+	.string	"stubs.h"
+.LASF1424:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1436:
+	.string	"msp.h"
+.LASF1440:
+	.string	"string.h"
+.LASF1472:
+	.string	"msp_protocol.h"
+.LASF1451:
+	.string	"cdefs.h"
+.LASF1458:
+	.string	"locale_t.h"
+.LASF1445:
+	.string	"stdint.h"
+.LASF1468:
+	.string	"build_config.h"
+.LASF1433:
+	.string	"stddef.h"
+.LASF1454:
+	.string	"stubs-64.h"
+.LASF1470:
+	.string	"fc_msp.h"
+.LASF1461:
+	.string	"ctype.h"
+.LASF1449:
+	.string	"wordsize.h"
+.LASF1434:
+	.string	"parameter_group.h"
+.LASF1463:
+	.string	"endianness.h"
+.LASF1443:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\255\005"
+	.string	"\004\t\007\001"
+	.string	"\023"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\312\332\260\336\t\b\002\002\002\003\002"
+	.string	"\002\004\003\240\342\234\212\n\004\215\377\300\244\017"
+	.string	"\005\320\235\262\314\006"
+	.string	"\006\224\217\236\327\t\006\002\005\002\005\002"
+	.string	"\002"
+	.string	"\b\t\230\232\324\211\b\n\263\326\341\254\013\013\262\201\245\301\003\f\330\271\210\336\b\f\002"
+	.string	"\002\006\006\r\253\301\343+\006\002\007\002\b\b\002\b\016\353\323\300\246\002\t\t\017\020\361\253\302\312\n\021\334\347\232l\022\023\240\342\234\212\n"
+	.string	"\017"
+	.ascii	"O#\t\\\204\314|\206\344\356\246\246\265v\335\004\007\004\007"
+	.ascii	"\004\007\264\351b\300>+\324v!\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 \353\355\003"
+	.string	"RE\020\031\260%\351\f\3030\224\226y\030\206a(\005\t\2665K,\261\244\355-S\n.9\330\205\213\312(Z\034\277u<\252B`\002\205\030\335Z\206\213T\"f\375\b\340\361\211\354<\341\2173\333\032\036\002\031"
+	.string	"\r[\2210F>\r\202ZP0\344\301M\314>\334\n\230\177SW8\214\002`\021\020\006\210"
+	.ascii	"r,\2049E\231\2510B\005\256D\200yM\314\301\226\212\245\022\374"
+	.ascii	"\006\260"
+	.text
+	.section	.gnu.lto_.inline.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\330\001\r\b"
+	.string	"\202\313\"(\220'I\007\327wA'F\206\357d\023e=;\271\222\0372\262\315z\273\353\356\366\305\361*d\033i\315\022\333\032\331r\247\333\317+\337\034j\206CD\273ch\273\2209k\026\203n\326\303"
+	.string	"\003F<\032$\004\006\324\242,\322\333\177?\003\371\033T\230x@(K\354\233\005\220\330\2669\270\220\345\271\205\266\310\350\277\364\312\263\230o\316m\352\002\236\322D\243I\300\266\245\303\036\264Ex\305\226\260\365Vhsk\320\241m\362\314|\b1 `\0021DF7\372\002(\324`\033\246\t$L\341f"
+	.string	"\2028\372\001\345`\277\rk\342\273\233]\003\3463\262\006"
+	.ascii	"\266\325s\f\311\306\314\253\204Hxt4b\230\210\300\002\257\t\271"
+	.ascii	"6=\343\270\031\335\001\362\016\302M8\332\261\006K,\347\f\304"
+	.ascii	"\335\233\035\217\346\034\354\344\311\316\272\335\250F\220A\037"
+	.ascii	"\203\357\310\355\321\b\376\353 \220\204\341\321\321\n>\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\033\002\245\b"
+	.string	"r\216()pK\222\016\375X\257\216\027"
+	.string	"\337\320"
+	.string	"\252\252\252\243\340f\r\273\341\032"
+	.string	""
+	.string	"@\232y\017\370\321\355o\246ny\333Md\222\001\\(\350q \350)R@\301V\006\372\247y\245\240\336o,e\f\246\205\235s\2254P\277\2362P{=a\240\236\033\354\323\005\352E;xh\232\006\342\033\322\242\036\352UyD=P"
+	.string	"\300\024?\261\304\n\023\356\315\3303\326y%%\222Ya\2652r\006+\257W\344\365\257NG\214G\254\237\256\t\257\311\244\262\364GG=\204\3778X\325;\337K\376\227\347\271\360@\0020 \220\002\021\263\242\007\024\221\224Y\271\355b\034#@\001\034\007\373`\003\362"
+	.string	"\f\003\032\265\257\013\201\210\304\bx\324y"
+	.string	"\202-\300\200\234I\353@i/\200$\220_P\346d\0162\002y\340f\372lm\220V\003\340\361*\263"
+	.ascii	"\355\311\334)\356\274=r\371\rX\310\303\267\004\342w\251\\\210"
+	.ascii	"\007\326?1\374\272\341\206\r{\263%e4D\301\335"
+	.text
+	.section	.gnu.lto_.pureconst.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\205\004\001\200\004\002\232\004\004\230\004\005\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\230\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 \344\025\004"
+	.string	"\264\004\312"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\r"
+	.string	"\001\300\004"
+	.string	""
+	.string	""
+	.string	"\001\002\023"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\b\020\001\001\002\002\001\270\006\024\002\025\020\020"
+	.string	"\004\005"
+	.string	"\006\001\b\t\n\013\f\004\200\214\260\006\r\004\374\007\0071cO313"
+	.string	"\005.cR "
+	.string	"\027"
+	.string	"I\005H\254@h.\340\022"
+	.ascii	"\343\256-\374\001#\330\fl\001\373\\\226\201\0268\027\262<6\025"
+	.ascii	"L\253\260\340\024\343Q\306\220\352\304mP\331\361\347j\030(\002"
+	.text
+	.section	.gnu.lto_.lto.5edd62853221fa77,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.16.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007R"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\334\ryw\350\375\005yu"
+	.string	"\005\001\006'\001\005\200\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_heartbeat.19.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\357\002}\026"
+	.string	"6)\221I\320\322\2521\240\211\004\347Aa+\220\315\323\257\315\307\276\217\367\231DF\241\354\322o\336_P\337\251\332\375\236A\232<\032\314\265i(8p\004\036\322ZNC\345`f\030\311\006\"\203/)\247s\220@\207\026H\333{K\231Rz"
+	.string	"}"
+	.string	"z"
+	.string	"\277\032\324eq\032\226\360\240\274\227W\362\323\027P#\272\326\353a\370.\376\342\366\324\346\003\356\005:B\2727U`\026\352\247S\224m\277\305\211nv\322LQ\364\032,s\212|\334{Y\252\027@\177\232'\200\376\264'~\273i\353\315?\360\246\220\257\307\256ws\263\347\326<"
+	.string	"$\342\207H/g\252n$\345\034\371\252\323\303\251\365\244r\357u\335\365>\334\347m\257\330\346`\333U\367\356,\203\334\244s\306\212\377~\373~\321\221v\312\266\007\375\341c\374\350H\037\372\356\275\251\233y\211\022\356\361h\273\f'\317C\t\211.\214\321\210\026l\241\365F#\032\312\013\351"
+	.ascii	"\302U$\326\314\353{0\324:\353\213FI\261\235X#\201\200\003\003"
+	.ascii	"\352\247P%\247\233 \264T\336\233\226\374\034Q!\264=\265\261:"
+	.ascii	"\n=L\312\237~\221\315N\375\274\037\274\245FxZ\366\201FI\271="
+	.ascii	"\326\266\251:\234\364\336\273\240\276i\304\222h]CO\353\0022\341"
+	.ascii	"\324&\3734^\243\346\2470\214V\277\243\241?O\033`\311w%\362\026"
+	.ascii	"l(]\244\243x$u\230\374\307\247~\202\007\306\020\354\330\335\370"
+	.ascii	"\240\327\320\027\255\275\360*\\\005\342*\fQS7$\370\357\"K<\\"
+	.ascii	"]\272\ny\224n\005b\247\271jM\3307\257\005\262\317\352\323Y\215"
+	.ascii	"\236\252\317\247\277\005\200\372\344 \031\006\276\314K\214\205"
+	.ascii	"\241qY\027X\213\213\206\206:\205\345\004\206\301\213\203\223"
+	.ascii	"\225\201\231Y\254B\312-+\031\r\226af\026\223\331Xbd\264\227\013"
+	.ascii	"+\366b\311\274X`\254\226\031\215\265R9&{\231\261fb\261\031+e"
+	.ascii	"\333)\356\246E\355\221_\331\361\251%?Y\035\333'\253\302\331\234"
+	.ascii	"k\314{IDP\376\352\322\376\321X\374\2017\207~p\246\200j\362\020"
+	.ascii	"\344P(\350N\242>R\303\253~\207Z\324\336\330\006; p\002!2\253"
+	.ascii	"\016V\020\204\346#\243\333@\201\263\332C\233\345\022\306\223"
+	.ascii	"\260\343\200\007Y\31473\207-\203\"H\217M#\247\213\220\025\203"
+	.ascii	"]\003\326\3062&W\267\255\031\230\f\0300\366\365\225\021b\007"
+	.ascii	"x\030\375\374\262\357pLD\006$B\370\206\363\006\215\354\3432\276"
+	.ascii	"\226\200Apq\004f\026\314p\262\334v\226>\235d\2067\210\017\202"
+	.ascii	"/M\017,+_\325!\252\017\261\324\026\230=I\330\323. \b\264\337"
+	.ascii	"4\245\310P"
+	.text
+	.section	.gnu.lto_grab.20.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\222\003\035\031"
+	.string	"\026\355\236J\300TU:\320L6\r\206C\311\002\"kx\262\204I\\\b\002\232*\326\347\334\230\005@\325\357~\241\30183\310EZ\224\350\212\326{\372\350\030\006 \222\313\021"
+	.string	"\241[P\352\321\243Ds\235[\201\366\326\320$\215\020\262wJ\001\204"
+	.string	"\217"
+	.string	"\210"
+	.string	"\020jt^d\247\334\036\247\236\215\024\302]\335\314G{8\221\315F\375f\243\354"
+	.string	"ZV\247\366\203\\\310\355'\317\007\354\n\035%\331=\033XU~\364Y\332\366\177\034\310\315\006\212g\216\335\t\027\344S\304ewU\251\027 ?\212'@~\2548~\273X\351\315\377\220\213\274\240)\271\335\211\213.^\305\004B2\272\310\354pb\352\t\223\317\203\247*v=\224\236,\354\256in\307\342\036o{\203m\022v]\n_\226i\374\3618\322o\337'z\320F\331v#\376\221'\271\2223y\017\350&\356\321\205\365\001m_b\340u\245\021\220\305\371-\311\212\254N\364\277%\031\251\203A\361\202U\372\220\324\304\005\232\300\033\372X\221\364>C\250\261\035I\315"
+	.ascii	"\005)\037J%\013\270\237\f\274\341\016%\233\213,G\362\223|\323"
+	.ascii	"9\021\377\350G\232\354.\352coQ\350`|pA\302\335s\346\243\200\237"
+	.ascii	"\325\351{:?y\352\217\206\027C\241\221\216_$\240\305\312~\221"
+	.ascii	"\003\347\356:\240\367BcxT]#ke\021e\351\241^\354Cy\224\232\257"
+	.ascii	"\303$d\3649Y\005\200\005H\030|\007'U\226\311\313-@+\f~\340Q3"
+	.ascii	"\214<\351\245\340\312\356>\367\337S\346\320k\344}O\231J"
+	.string	"O\231F0v\350\210\005G\272\f\026\235I\207~\322c\214ZTY\332Tn\031Z\241\365\275\247L\332dT\215\245M\366\211\243\365\206}q\253\220MR\217$\265XR\327\237?\215!yT\016\004wW\f\003\276\211V\211\212Sc\325\020\257\033V\215F\272\306\346\001N\204\226\204\0074\brf0\016(\337\320\304h/\02093Xl\307\246D\214\346\n\241\202\271T&\\6/\325\315\214\246\242I\031\026k\315T90\330L\205:\315\213U\254\017~\303\212\030t\346cUa{\254)\263\342\354\367\376!\3070\304d\212\2735*\b\211\320\241}\340\317\367']\3641\303\024e(\203\303,\365xC7\220\364\203-\021\3649\261\222\365\204i\265\313<\364\247'K\250AH&`\210!$\023L$#\3224m\240\002\2219c\007\020`G\264)\024\226\003\036p\341\242\330:\261\3701t\262\222\307\242\206\350"
+	.ascii	"\241\261\252e<\304\244\001\356(\035\004%<O\212\013\340\247\021"
+	.ascii	"~\220`I*.\266\216V\255%\017\001\327\034\211\266\245|\376\262"
+	.ascii	"\0037(I\275C\207\333:\204\236\\\215\374\257\006G.\236d\246wT"
+	.ascii	"W3z\2737#Z\343KO\032V\017\373?\234\340L\253\006\306i9m\003\311"
+	.ascii	"\2129~\002v\357w\270\246;\3003\240mC\001\374\024Z^\244\3776Y"
+	.ascii	"\246\374\363\007"
+	.text
+	.section	.gnu.lto_release.21.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\363\002M\026"
+	.string	"\246\351\220J\300\020)\0350\300N\372/y\212\016\177A"
+	.string	"s\034\237\037\333\n\327\201L\241}\335@\354KiH\223\356\r\214Z\331t\365\f~\2632i\262\037\360\346\027d\021\026\205\357\347\262\255^YfuSq,\016@\275H#\204\354\235Ry"
+	.string	"~"
+	.string	"w"
+	.ascii	"\270\373^\314=\241*\n\341C\334\345}\234\364\005\323\243\310u"
+	.ascii	"j?\305U\340~\302\234"
+	.string	"\300n\317\221\322\356\331\300-\363\244O\323\266\217\342B8{8\236>=\225n\207\206\250\306\356\266X7P\236\034_\240<YG\034\367\261R\234\377\337G \235\246]/\346#\316\353\250\240\307\203\215\216\236nd\275p\242\271\360\324\246'C\251j\302\356\232\356z\035n\362\266Kls\260\353H%S\f\004\305\335\233\342\215u\"\227L\334\367\333\367\211.\264W\276}\310/\372\212\263\270\322\2079\273\273\302\2311<s\223\222no\341\341y&PhU\220\216jC\256\222\036\351\250V\3628ft^A#[\220\213\244\017z\204\344v#\333\201\b00\230'\201;\303\343\240\321\355\020w\317\217\223\003J\270N\017\274\375\204\2515\024p\242\210'}\242\233\275:\316\377y\345\261\344\262\355\021\2226\f\255\2219w\327\001\275\324\207\242Q\265\255$\353\353\027%C\245\3543\275\311\346\223p\254F\277\253\225'\311\032"
+	.ascii	"*\347D\341-\270xZ\245\2334\2062@\376\244\257x\206\376\223-\230"
+	.ascii	"\261\273\337\035\351?\267\225\017\326z\340Y9:e\n\034\276\320"
+	.ascii	"\r\f\356{\007\024/G\213\246@\341\323\322)\373\324\321*\302\376"
+	.ascii	"\270\273\353\332c\223\324*\222\272TQ\223?\377\n ?K\312JUqyU\224"
+	.ascii	"\330\311\313\245V\232\304DD\345A\n\004\221\220\004-4Y\205\225"
+	.ascii	"OBf\265X\206\026\232lv3Y\231\325`(-\031\254\305\0023\211\265"
+	.ascii	"Nh\265V\b\313\262Y\n\255\325\"\223\321Z+\333>s\037kY/|\311\315"
+	.ascii	"\016\375\270\252\332\330VUV\256\352\3742\356\202\220@\364\321"
+	.ascii	"\242\375$\244\340\377\373\030\304\223\033\005P\220s\b\207@?\367"
+	.ascii	"\260\364\205\032`\364\273\262\2265\306\265\0069 \240\002\031"
+	.ascii	"*\253\007~\020\004\314G\306mF\2013\332C\323\262\022F\223\260"
+	.ascii	"\321\001\021\261\230_f\316Z\006A\220\2366\r]\027%+\006\273\006"
+	.ascii	"\254\215hL\256j[{`\0320\250\330N\367\303\016\243\236_\356\035"
+	.ascii	"\224\235\030\274\261\274\"K\317)\330\277\0202\036j\3272\2628"
+	.ascii	"\303BE\237\215\345\266\311\336\372`a\371\354\025\244\250\343"
+	.ascii	"p\307\\&\335h\352\".\275/\261\365\223\033)\007\255[\232\242y"
+	.ascii	"("
+	.text
+	.section	.gnu.lto_clearScreen.22.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\363\002}\026"
+	.string	"f\251\221J\320\362\2501 0\326\301*\205\235/\"S~\013\232\230\b\213\204\215\276\ne\234\313\304\3400\2620\344v\0203\261!b\264\037?[/\025Lt\f"
+	.string	"\355\032;\006\307/H\n\306+|I\243\325\205\213\002"
+	.string	"\215M\366\336R\246\024z"
+	.string	"\177"
+	.string	"y"
+	.string	"\357\321\2307\305*\211\304P\361\336\035\311I_0G~\\\257\366Y\274\305\355i\315\t\334\013$d\2727m\340\323<\351\324\264\355\257\270\321\315&\216\351\t\336*'\224\203$u\357=[7P\236\034_\240<iM\374\366\321\326\233\177\337G\025 \204:\236\315\307\236\333Q\001\220\b \"\274\334\330\262\341\224\363\341\353\016\357\246\326\325\204{\257\253\216\327\341&o[\3056\007\333\242\0049\020\374\270\227\247*\310u\"c\f\275\367\333\367\221>\264Y\266\375\310O\272\213\2778\323\233h\334{Y7\323fg^\241\320v\030&~g\376\214\356Kp\t=r\225\365\301%\264\334\205\340|x\001\225jE.\262\036h\224\024\333\225j\007\"\334\300`\236\374]\234]HNN\250xoJrr"
+	.string	"\n\327\353\177\266\2475V\207BOT\361\244\217d\263Y\277\371>\263F\202\\\266\215\222r\013\326\256\251:7\351\275\327A\375\324O\225\222u\255$\355\313\027uS\247\354\313\370\214\232\037\344\030Z\257C\313\223\244\r"
+	.string	"\345\341\305\341-\324x\272L7y\020u\224\374\302\263|\216\356\223-\330q\357\275\356\301\023\275V\036h\355\177o\341*\225\353\257\007M\335\300\340\275\213@\355p\265\312\365\207\343\351V*;\315U[\302\376x-\220MV\257\310\352rUM>\375-\200\322G\3651.0\366e\346e[b,\257\031\264t\312\312\311\313\003\027\b'&\tdh\262\n,\263\230\314\320X\006\031\232lf[\201\231\241\260\226S\006;c`+\261\223\205\206\236&-\313f.\264SF&\243\235,\333Nq\037mi?\274\nO\210J\362\225\335\261\275\262-\234\315\231f\274w\204\204b\257V\331\027\006\201\277\357c\221\017n\024PK\0362l\222\"\272\211\245?\324"
+	.ascii	"\253\327\225\266\2646\266\001: \220\002\031*\253\016F\020D\316"
+	.ascii	"G\266\333E\201\263\332C\333\362\021\306\223\260\343\200\bY\314"
+	.ascii	"73\207-\203\"H\217MC\347E\316\212\205]\003h#\272&\327\261\255"
+	.ascii	"\036\230\f\0300\266\353\373a\207Q\317/\351\016\377D\344@\"\206"
+	.ascii	"o \257\320\022s\004\3735\204\f\207\331a\031Y\220aP\321\315\366"
+	.ascii	"r\233dn}\210\260<\366\nX\324I\270c.\223n4i\021\227\337\227\330"
+	.ascii	"\372\313\215\204\203\026-M\321 \024"
+	.text
+	.section	.gnu.lto_drawScreen.23.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\363\002u\026"
+	.string	"fi\221J\300\322Uc\250\360\220\2148\215R\336\003\306\013=\242\201\205\205}\240&#\nL\351]\005\2079\335\226\354A1H\364\245\032\342UU\240\f\264\236\257\023\263\013\260(X\242\267\312:M\016\231\316\005\337\306\246w\264\367\336[\312\224\002y"
+	.string	"\177"
+	.string	"y"
+	.ascii	"\347\315\234W\205I4\"\210xon\344\244+\234)\035\253W\373AoQ{J"
+	.ascii	"s\002\367\372"
+	.string	"\034!\335\233.0z\236tz\332\366Y|W\263\207cjBg\336v8CN\367^Tu\003\345\311\361\005\312\223\266\304k\037m\255\371\357}\\\341\241\210\323\325|\344\271\035\021\370\200\360\221\322\335FU\r%\234\013_ut6\265\232\021\356\275\2568\335\206\233\274\355\024\333\032l{\0227Dv\334\273S\004r\225H\030)\316\373\355\373C\027\332(\323.\344\023\335\305_\034\351I3\356\275\250\332Y\223;o0H\373\221\207\317\235\276\335u\001\032\311\204Ve=\320HV\346Bn:\260~E3\240\025Y\377\363\t\n\355E\263\003\017lX8O\372\356M.\004\347\266#\336\233\216\234\034\200b\365z\037\355)\215\315\221\300\323D<\351\017\321l\324k~\317\250T\217\225m\237\240\324\002\326\246\25196\351\275\227A\375S\210b\221\365\254$-\253\327dS\237\354\307\270\214\231\177\302.Y=NV\236$m"
+	.ascii	"&\016'\nO\201\306\322E\372\311c\210\203\344\017\036\325#\364"
+	.ascii	"\336+A\216{\357q\007\376\347\263\362?k\357\273\312V\177\270\372"
+	.ascii	"\21235\203\202\363\236b\312\331j\321\325\027d\351\326\037vz\253"
+	.ascii	"\226\204\375\361Z\037\233\2546\311\352\322\254&\237\376\026\200"
+	.ascii	"\231\013\343aZ^\254\213\f\313\262\270VX2\262\322(*&.\rZ\034\230"
+	.ascii	"\224\210\304\304^\023P^)\201\311\\\027bb/\030M\345\005&k\261"
+	.ascii	"\240\257\026\n\323Rq\241+1\031Z\242\362\013\326\022Cc^\257\030"
+	.ascii	"\212\262\355\324\366\321\226\366\302\247\354|\250#7\255\216m"
+	.ascii	"\323\252l\366\346\231\361^\021\020\210\274Z\264\037\004\376\376"
+	.ascii	"\336G\240\036\333(\240\222<D\230\344\364s\017K_\210\241U\217"
+	.ascii	"+mikl\003: \220\002\031*\253\016F\020D\316G\266\333E\201\263"
+	.ascii	"\332C\333\362\021\306\223\260\343\200\bY\31473\207-\203\"H\217"
+	.ascii	"MC\347E\316\212\205]\003h#\272&\327\261\255\036\230\f\0300\266"
+	.ascii	"\353\373a\207Q\317/\351\016\377D\344@\"\206o \257\320\022s\004"
+	.ascii	"\3735\204\f\207\331a\031Y\220aP\321\315\366r\233dn}\210\260<"
+	.ascii	"\366\nX\324I\270c.\223n4i\021\227\337\227\330\372\313\215\204"
+	.ascii	"\203\026-M\321 \024"
+	.text
+	.section	.gnu.lto_screenSize.24.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"\305\n"
+	.string	"\346TKA \2138\035\207\023\022\b\200}\005"
+	.string	"\036=\022\357z\266F\226BZ\212\205\t\220\237\f\324{\263\210\235*\312\332\312\306\211;\013?\260\360"
+	.string	"\030{<\210k\177\031\207\321\345NXvq4\021!R\246\0248"
+	.string	"6"
+	.string	"8"
+	.string	"\266\017\341\021@[C\0252\030a \f!\013!v7R^q\335\252Nq\335\322\005\007\237\240\377\t\257P\b>\210F\236'\366\261\273N\321\310\300\255\267\235a;\304\376\026i\354\341\177i\272\312\264j:3\375\f;\340\001\203\303n\201\024j;X\031\034\330\006m\315\2260y<\355\227.\001|\330\371\304.i\203i7\2548f\267\034f\016\017@\231\262ju\362\013\252\225S\351\232\372\320\b\373{\005"
+	.string	"\331\356"
+	.string	"\016\237\202\027 \333\3357\270\345w\256[W\213S\351\223)k\t6E\330\241'U\201\375j\225dk\336\270XH42\035\226\355\202\343q \2321[\367mD8\036\327\t\270\224t\237f$r\232h\242\271l\"\306\373\342F1\327e\274\310\3418/j\341\336\306\224\362Q\220+M\305TA\020\b\017"
+	.ascii	"BMm\233^d\256\006(\274\030;\300\346\236\312\347\022\033\224\n"
+	.ascii	"\3205\034^\026\360\006\023\017\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_writeString.25.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\305\004\335\036"
+	.string	"\0268\301I\240\326Q:\304\013l\017\322GF\275\307\214\223l\037<\035\365VxY\313Q)^\201\306.\200l,S\255\377\366\323\343\270w?\350d\271\254\207\360\n\353\361\016S/\202\224\243\212\213\021\206\003o\227\213\254\275\222O\b\221;\245\253"
+	.string	"\252"
+	.string	"\247"
+	.string	"\347K\032T0\223a;\225\213\347Q\360\224\212\301\344Xk\265yi\237s\246d#\245H\024\220\251?!=t\316\227\263_\324\3562\325\007eE\207-\266\245\366\203\034\336\241v\336Z\231\274l8_\006\270b;\265\017\344Ax\027\032}\246V'\342U\255\302\033\327\316\227\026\236\266}\037\377\301\263\213\244\360i\t\346#&\r\321Rk\255\321>\300|I\276\306|\2713\316;\271\224\347\177xr\007\323\027p\351\350d\212/\231\300\311\305\226\331\222\217\244-\341J\272\361\364\304\322\217RX\205Z\253)p\t\305]\3366\006\3338\233\374\0221\352\231\013\377\230C\375\262G\375\261\245\206\235\3526/\365\227K\275'5=\251O"
+	.ascii	"v|r`\252V\245//\225\253\304\272q\252\277\312'\336h\313\254\273"
+	.ascii	"\225\177\344H\236\344[\317\262Uk\225iU\242m\351\265t\017\236"
+	.ascii	"R?\274n\212U\270(\033\214\276X\2053\2031$\026"
+	.string	"YX\273\263\342\200M\361\260-}\226\037\344\350\216\265+0\241\211\320\371\362\252\"\005cI>\342\261V\241\315K\031\033\266\323_\351.4Z\023\027Rx\035_\372D\235-;\317'\362\241e3\026\266\"7\302{U\321YqX\210\241\344XkPD]u\353%\022({\255Kh\262\372Pg\001\225\027u|g>\353\264\336\376*\312a\273{)HL>'1\224n\271\267\372\024\334\354\t(\345\303\235\200\227$O\017=\3204\244\245\373\244/K\214c\224-\027}\251\025[\33374Z\364\212\373\235i\233\301\207;\230\247Zk\204\331\023\226\017\017`*\013\266\025\020\334E\323\\\330~\b\022\026\037\3752\235\362a\356\251N\353\321.\376\232\373a\322\227\036\3752\f-\327\376\031A\017\374Rh\372\355\221a;\350T\216\256J\273\330B\037]\031\366\311\272N\366R\327,5M \202x\326\247\350\303\n\365"
+	.string	"m\b\241\237\034\221\316$q\313-\320\215g\235\263\343\300\007B\217\004\0078\006\210r\267\f2\363\340\f\351\202t\210r\267\241\022;@C\272\037\020\265\333OM\350g'\250\306\223\323\325ph\276\r\365\344jD\267[\256&\023\366N.\315\336x\fJL\324\3465{\302v\315\322z\353s\021Y+\f\n\257\372\217P\364\313W\347\321\324#\007\320\335\330\221,Zt\370\306\r\034\350\2014k\356\221c\326\035lDM\374\204\265\326\006\364\\^|Qm\327g\366\203\020\257\037\345b\337\353Vv~\r{\300\321\003q\346\313\231\205\251\242\342h\274\006cb\250aD\206\020\221\204DF$\032Q\2204\007\200\"\221c\326\r\020H\312\246)\024\206\003B$\260\241\367\340\346\fE\013A\333"
+	.ascii	"\026\347\006\006C(5\345-\t\372 \310\201\367\240q\346\235G^Xk"
+	.ascii	"HM-\013\310I\242\032\306\332\206\026\304\350\263uX\226j\210\242"
+	.ascii	"'v\217Ah\203\275mm\333\003\016E\303\214\321[\215q\3673\235\360"
+	.ascii	"\345$V\342F_\345\254;\020\333a)\231\030\005\342v\254\212N\306"
+	.ascii	"\373\346\373/\2548v\034XR\361\354\210\203\005\213\223\274\316"
+	.ascii	"h\033\336\016\007jiI\356z\rm\266]\300\240\017\376\315\203\225"
+	.ascii	"\362\244}\206\026^7$}\345%\2268\031\002[\374\254Z\244\310(\307"
+	.ascii	"9\013Z.\200;+(\302Er\325\276\373\024\333\325"
+	.text
+	.section	.gnu.lto_writeChar.26.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\211\001E\017"
+	.string	"\026\335fD"
+	.string	"\221j8@\007\237[\2709\216\374^\024\276\232\302\345;\177h\231\235\347\006\"^q\234\340\001_\177\263\t\307\3117\276S\223!\375C,\360\252jr\376\004\020i\001w\340y\315b"
+	.string	",\033G\376\336R\246\024O"
+	.string	"X"
+	.string	"N"
+	.string	"\244\247\375\021'!~\244p"
+	.ascii	"\273\262\024*v\307\017\177\336;\217\236m?\304E\2106\013n\234"
+	.ascii	"\3058\256\231W\211\033\273\373\211.`\363\216{\200\315;\345p\361"
+	.ascii	")\372\267\235\3730\253\301b\255'\207\301\356:a1\226[o\273\200"
+	.ascii	"m\022\3735\002\367\016"
+	.string	"\363s\232VMg\227~\207\207\345\005\201\026\273+7\232u\321\255hy\314o\213\276\315\237\220\013\311\304O\210\217ay\353\301\253\340B#\263k\301\300;\227\274w\036\031\002\001\323a\244\345%\345\036\353\212\261\362@F\322\264\021\204\210\247\245Xw1\3148\360\336\205.\004\252\352Q[B*\017\003\251\350\245-wT\365\257\032O3cb_ml\177t\314ld\355v\265}\340\266\025h\266\273\n\016\243\301\351\3652^5*y3\207&k8`l\346\260\307V\352\006\373\334\252\314\3264\350\343\3579\355\357\374\345\001&+\bj:\013\f\365\0044\251CJ &\tJD@F\003T!\330\340c\323\b\225B\031Q\205 jB\351\004\225:\221|\340\351\213p*\241|\2460\365\215D\006Q%\341\247\002\301\360\373\214{\033\244\"\031T\324e\026\267\253a\201\f-o\356\344Q\334\006~3v\367\260\f\037"
+	.ascii	"BMm\233^d\256\006(\034\315\226\327\306\nX\327DqT\030\033\324"
+	.ascii	"\b*\006\246.|1\265\322\274\013\271\023\255\301\206\265\363\314"
+	.ascii	"\264\001B LFP\030\030\002\346@`\240D0\002P!T\250!\340\304\223"
+	.ascii	"j\305$L2"
+	.text
+	.section	.gnu.lto_isTransferInProgress.27.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"=\b"
+	.string	"bO:90s\322\0013\235\007\356\b\245\003\013\217\320=\356\032FD{\327U\365T}f4\264\005\316&\206\205Gp\267 qOI\304tS\333'\333&\364\211,9\330\006A{\247\024\036u\242\013\207\322\203\210;@\201Tb3\211\373N\246\n\024H?\215\016\343;y\026\223z3\303\353L\223\004\236&\207`\372\225\300\211\242\024\234[\335\207\232d\211\251p\310\016\007\214\334\024\320\270b;\033y\354\252\212\262\304>\300\356\256e\313\216\02390\235\205\327\356\352\247gm\262\232\024\333){\263\005| b\264\337r\227\324_6>\260\333\302q\355V\006\317\3203\327\033h\317B'\320\236\331v\303(\345\360\365d\005\362\b\371\210\201\355\326)M\036>\206\376a\236\260\"C\362\232a\251\036A\021\273\353\b\302\022\271\345m+\330\246\260\215\022\n"
+	.ascii	"BMm\233^d\256\006P\264\032\260\004\373,6\3215/\341!\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_resync.28.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375` \001m\f"
+	.string	"V\030VA\020s\232\016\177\013\245(\363\224\260X\016\333\3377\004\211)\204\326\206\336\026\"\360\221\344\323\241\266t}\231l\364\021\201\213\007\363+ \022\211@D:\264\266w\326\351\t\002\213\320\272P\263\273\233\224)\005B"
+	.string	">"
+	.string	"E"
+	.string	"o\261]t\362\001\273\241\0327v;\006\216\323\237\273\033\200\177\323\t\300?o\366\217w+\213Q\031\201\022#\310\356F5\361\355\271\371o\371\b\227\342\341\211\211\260\273N.E\304\255\267\255\3006\005\373$\002#\247\013\212\035\233B\354\016\224\252b_\332\335\265\206\354\213\376I\323P\323/\323\222\246U\323\231\351S"
+	.string	"T\350X\220c7\304h\310\276<\034'l\337~\267\331\224\035\200\007\204\347[|\026\0014\244\024\252v\365\031\326\264\273\033_FI\206\002+,'\360/\211p@\004\334\202\251\252\332\003D\tP\216|M=J\021\373:\214\r\323\356\207\215\357\342/4\237\345\317\034L\362\334\237o\002\377\256\033\037\242O\006v\300\321\\h\320y\240\311\034\360d\327\004\312$\031L\263*x\262\013\353\300\321\200i\225\205xU\261\244\342X\221$\323b&\201/\254\223E\317ue\221\352>\227VC\022V\274|\024d\250v\3476\020\334\202O\241\244\017\303]\002\024"
+	.string	"BMm\233^f\366Y~\265v+(\034<"
+	.string	"\333\2002\300\036\330\316\016\222\001\024\370\020f\330\270J\b\336g4\204*"
+	.ascii	"\3562\007\334\345E;\311"
+	.text
+	.section	.gnu.lto_txBytesFree.29.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\345\b"
+	.string	"VP>; \0057\035\200l\001\351\254\200\212O\024!Ms\f"
+	.string	"\361Uu\270Rc[p>j\224L ))\226S5\363\023\026\004\020 \f.\303\302\214\200\321 \224\022&-\276\265-e\n-"
+	.string	"-"
+	.string	"-"
+	.string	"\030'6\335ub[\300\331\212Z\002\316V\262c\303\345\360\273&K\205|\304\214%q9\240\241\273\317cIc/\367\377\301\377\207\377(\001-S\265\200\374\007\377\353\027Xa`\376\227dK\300\255\026;\320m\252a\351\256\t\237\235\255^;\377\277\";\002>\244\252G\311:m\004{)\261\013Iz\305\177\305\210w\224\362\303A\222\342\255\027Vq\241i\276\371\253\310\362\364/\325\322\364\237/)\013f\006!\245;#"
+	.string	"\200_\320<\022\n\241\217'3\370:\352p\035\224q\236\b\342\353(7\322&8o\213\230t\233\024\233&\232\240\316\233\031v\312\205\272\371Q\332\315\253v\f"
+	.ascii	"BMm\233^d\256\006(.B\033+b\272&\236\261\300/\230 \340\204\221"
+	.ascii	"j\305$L2"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.30.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 \375\375\005"
+	.string	"D\n\303"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\203\344\302\005\177}\370\337\362\003{y\270\337\242\005wu\370\336\322\007sq\270\336\242\005om\370\335\302\005ki\270\335\262\005ge\330\334\002wc\334\302\005wa\327\202\005w_\327\322\003w]"
+	.string	"?\202\210\200\330\001[Y\305\001W\304\001U\303\001S\302\001Q\301\001O\300\001M\277\001K\276\001I\275\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\013"
+	.string	"\240h(\332\nE\003R"
+	.string	")\200\024@\n %&)f\222:"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_displayPortMspInit.31.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`4\002\215\021"
+	.string	"\246\237qH\340\262(\035\212\002\030\242\333a\252\rYh\241\374b\377\242\031\013\020\220T\254Bq\226"
+	.string	"\306\036\n\360\330\374C\303\017\202V\331\324\3545\252\237\232\024\320\0071\226\313\267n\320y/\016\245PNc\307iG\354\336d\357\224\002X"
+	.string	"X"
+	.string	"_"
+	.string	""
+	.ascii	"z\032Ly\332\353cX]F`|@\374\330\035\025\234\372"
+	.string	"\353N}\233\227\355\235\336N\261=\277\305]\244\030F`\224\201\t\255\330Z^\004\331\035?\217\037PO\273\007\250\247\363\304a\2270\3775\347hfn\342\213\312%\310\301\356Z\212/0\367\274\355\003\266'\330r&*\177\346\324`(/\206\365\324\346\320\222\027-Z\231*\226\266\020<+\205\330\243LN\023\366\271\235%l*\335Qi\020']\2514\245\322\034'==/\305N\202\237\335\017\267!\253CsP\3706\307y}\346\337@\370\241\331]\357\224\3661\374\262\270\214\210+6\004\247\001DD $/Un\3229}Xbd\362\3469\271\371\226\"\256\360\033\026\272\335\016$\337\306sNl:\311S=\235\223\344c\026\2237\037\347\241\332\n\236\233\337CME\317g\257A\343\264\213bR\210=\021$\362\263\317Hu\273,\265\3332p\250TM\325\323\317.#\354vc\027}\030\217\021f`*\301\260"
+	.ascii	"\305\244dT\300\305\002\037x>\215V-\325\211\213\005\256B\223\206"
+	.ascii	"U\013u\341\003Q\337\006\224I\365\235X\255o$2\270Ba}.\020d}\336"
+	.ascii	"\030\373\216\216\t\211\330\224\331\2139\355\257y\3106B\247\213"
+	.ascii	"\360\036<\f\274TA\263\253\023$\341;tTYc\301C\347qL\3419J\002"
+	.ascii	"dv\227\204C\006- \200\002\231\252\253\007BS\333\354E\\M(\342"
+	.ascii	"\333@A\354=.\003\326\265A\362\316ED\301\256v4\356\312\\\006\315"
+	.ascii	"\260\035\036\311\374}\326`\253W\221\250\220>\326\306q\331\006"
+	.ascii	"[\221\035m`\026\021_+\022\211\213/\264\356\300\371<t\030\234"
+	.ascii	"?\234\342F\371\343\025\025\265\"\b\311\343A\002y\346{$\255\230"
+	.ascii	"\004C\006"
+	.text
+	.section	.gnu.lto_output.part.0.39.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\321\001\025\020"
+	.string	"\346]gE"
+	.string	"\257(\035\343\013\210\372K\322\317\201\262\236\235(\314\223\276\002\264\221i|*W+\274\020\226\035\030\264\206<\246P{\331)\260\360~}\320\004\316\b\020\301\246\243\217\305\332\374Q'\270<\016\317\335\030\331[\312\224\002Q"
+	.string	"X"
+	.string	"N"
+	.string	")$\326]\023\0272\273\337\202Gs\233G\373(V1\333\376\211\243x\366\f\374F\310\034\264x\261\274\330]\356\321\363\002\333#<\201\355QE\334\273&\364\374\204\311X\327\303<A\013\013\230\214\3033\343\020\200\307\356z\323\341\216\267\335a\373\303N\005\001\217~\315\2639\217FY\225\030\\\337\3562\350\220"
+	.string	"\305\374\013M\365\001\2733\232%l\036\323^\275ee\261N\214\313[<\003;\353\na\"\263\273\021V\337nX\001\301<\213\237\342*\336W*\030\350\254KE\303\203o\343\325SH\376mI\254c\002\244\371\317\r8\274\007\260\250\236\227\262|M\375\212W\214V\326\3700\327"
+	.ascii	"\261\251'1\177\355\2314>\355o%\215\025\352\211}\270:\2635\275"
+	.ascii	"i:\336\345\207g\371U\323\371\357\177\200#@\331-\251\201\261\037"
+	.ascii	"\242\212\022\257\335~m\345\303\230\363BSyX\0364\002\251S\007"
+	.ascii	"\20132\022\321\020\325\207\232#\264\021\002\032ul|\016\200\224"
+	.ascii	"Dj\321\307\204*MH\235:\223\205\220\210\tE\002\341:\0227B\n\225"
+	.ascii	"8\321\t\305}<\356L\243\023\227\352\272\023\307\261\235\207\253"
+	.ascii	"\263\214\214\272i\006\333\233\332\243\245\027T@\372\245\r\252"
+	.ascii	"j\252\335Q\310\007) `\002\031Tf\033\317YH]\263}\204\333\345\005"
+	.ascii	"\376\004\177D\221^\227\307\242\016D\3201\0218el'\372d\201U\232"
+	.ascii	"\tc\363\331\007 \033nf\314\321bO\335\rs?k\001\2540\373\250\343"
+	.ascii	"8BT\227\027\306\343\301\247+\030\214\223\272v\265~\310\256_\034"
+	.ascii	"6\231\260\354>\017\234\275\371\332\200\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\247\001\305\b"
+	.string	"\004\f\243\002"
+	.string	""
+	.string	""
+	.string	"\002\030\177\026\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\033\177\027\034\177\030\005\r\031\201\204\001\035\177\032'\177\033\271\200\202\202\200 \023\177\034\005\"\035\024\177\036\002\027\177\037\026\177 \025\177!\002\031\177\"\032\177#\037\177$\272\200\202\005\021\021\200\003\005\036\022\020%\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\016&\005\002'\001!\177(\377\037"
+	.string	""
+	.string	"\200\200\200\001#\177)%\177*$\177+ \177,\003\004\024d\003\005\025\244\001\003\006\005\310\377\241\372\001\001\302\007\003\b\242\n\003\t\302\007\003\n\013\f\027\f\026\344\n\003\f\202\022\003\r\f\302\006\003\016D"
+	.ascii	"' \360\002\241\231\222\007e\222Iy\350\231t\340g\2027\273\263"
+	.ascii	"2\341\314\265\037\331\3010\324#8\b\034n \327\227\202n\301P~\304"
+	.ascii	"pyd\b>s\005\215\214\261\206c\274\036\321\232TF\257GRMZ\007q\215"
+	.ascii	"\321q\005\3451P\003\230-\225Q5h\266:\001"
+	.text
+	.section	.gnu.lto_.refs.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375 oe\002"
+	.string	"\222E\017\024\2605\215\001\f\303\260 \227\266$\211\335\273\255\255o2\311\024\036\327\201\205\237L\003>;q\331<l\030\217\333;\362\224\2263\366\2730\005\3461\205 \013s \215IH+\275|u\020\004"
+	.ascii	"U\345\203\306RD\360\2538\001"
+	.text
+	.section	.gnu.lto_.decls.5edd62853221fa77,"e",@progbits
+	.string	"(\265/\375`\032!5\231"
+	.string	"J\367\2746N \222\312I\007\354\r\377\310\201\263g\221\337\342\357\376~\376\3143\272\256{W\3448\032T\177\354\020\177w\374]\241n\021\031q\254\t\232[d\240\"\036\"\"\301\314\305P\265\""
+	.string	"\021I\340Ys\016\007\210\225`b~E\356G$\236l)S\350\002b\003b\003\357\245\035\rw\200\237\273K&\257\323\241\241\367\035\2416\263\236\267\355\211\241\232\225\3036\251 V\2305\235\006\006\345\264E9\313\330\024r\227\250;)*d\030nE \225\223\320\f \225\223\220\325\360\032N\303\206\034\345B>sF\303\317\363\2241\202\316\266\3010TNB\242\177\250\220\313\200a\034C\234\252\360\2447md}\377X\337;\326\367\325\372\206Z\317f\326\240\0360k\364\366:\0254\362d\005\3554\360\te\353\374\272\324\370\255'\252\302vM\314\320\256\\\260\304\023S\0042#\203S\344\330\316\307\336\333u\346\244r\307v\0264\241r\022>\325\230\255\354\311 \017\301^\370\013\3771\030\346\302\200\334\307Q\366\343\275\263\026\346{\320\363^(nsc8\346\313\302"
+	.string	"I\032\247ma6\237\345\363VQ\320F\345$\274\367\016\3711\036\353\225xb\216\32056x\357\363\021\374\374\344_A\304~l\205\355J<\335\333\305\345\363\004wC\r\341\275O\007\202\034p\300\001\007V\"v\321\252"
+	.ascii	"\3223\222\225\203\330\307\372\263\036g\311\211\362\361\345\364"
+	.ascii	"\364\221\243\202*\354\364\234\307X\2367\250\247\215\022.\334"
+	.ascii	"\\\3175\326\263\323\372\036\326\347\260>\271\002\3151\035GMp"
+	.ascii	"\335\363\247\247\215Y\033\303N\177\303z6\241\362!\233P\017c\r"
+	.ascii	"\202k~\343\2703\034K\341\201z2\\z\257\023s\002>\314\t\334\334"
+	.ascii	"\2119\255\251\351iX\357\302z\202I\250\f\205\3278\032\304Q\276"
+	.ascii	"\202\350v\t\345\242\335{\177\230\313\023\325V\247Oa\345!\372"
+	.ascii	"?\200\323%:\317\372\303=\344 \365\275\n1\t\025\210G\250\0200"
+	.ascii	"\t\225\321LX\246\224\327m\273\367)\342\347\231c\312G\247\177"
+	.ascii	"2\tu\345\021\352\317\320B\031;\177\213a@5\204\266\205\237e\370"
+	.ascii	"9\206\237U\370\331\305\3173\374\f\303\317,\374\274\302\317/\374"
+	.ascii	"\\\304!\\ \301\003\r\244\360\377\200\277\325~v\222\346\204\377"
+	.ascii	"\352\337w\205h~F3@\222\334\337\376\333\277\343~\356\240\305\317"
+	.ascii	"u~\313g\304\374\334\027\006\006\365\002\374}\370\037\360\377"
+	.ascii	"\226\365\3577\036\324\364`\350\003\233\034\376\363w\232\237q"
+	.ascii	"\200\226@\376\374\373\374=\346\347#?+\3719\311\317\316\237\307"
+	.ascii	"~F\3623\031\326\317b?\023\371\337\363\333\343\317`~\356\3623"
+	.ascii	"\336\317\321\237\323~>\373\331\354g&??\375|\177\376\341g\037"
+	.ascii	"~\356\341g\036~\336\341g\035~\316\341g\031?\333\360s\361\347"
+	.ascii	"\244\237a\374L\374\317\346\347\032\376\007\376L\303\317&~\336"
+	.ascii	"\371\331\200\237\t\370\377\342\347\021\377\353~\006\340g\021"
+	.ascii	"?\003\375\314\3633\316\317\374\277\315\3775\377\303\374\027\374"
+	.ascii	"\217\366\377\201\377y\377\201\016\017\017\017\377\024\352O_\374"
+	.ascii	"\004\254\b\027\nj\351\201\327\025\301\204^\253\013\004\027+\276"
+	.ascii	"\317\257\345\205\362\272\".\324u:\301\204\372\262bB\235\254D"
+	.ascii	"0\241_V\027\372u\201.\224S\263\006\324m\212\270\320\2571\027"
+	.ascii	"\352e\005\304\204zY1\241_Z\254\203\351W\305\n\356\017,\213\267"
+	.ascii	"0\241.\325\324\226S\023\210\217\371\364\272\177\367r[\324m*p"
+	.ascii	"\357\226W\363\317\t\213\347\236\370\250\236\340\234\274.\001"
+	.ascii	"SO`^\027\212\217\251\304\353^%OJwJ\202\345\223\357\na\276\245"
+	.ascii	"\217\255+\025uo\001S\367.\371\362\335{\227\367^\234\346\326\363"
+	.ascii	"^\035@L\347\324\324\275YASwkI\027uo\267\001\316Y1\241`^CtQ\240"
+	.ascii	"\316K\343\271d\347\375\373j\256\320\245\332\225\272\367r\231"
+	.ascii	"\325i\025\004\231N\233K\2279\375\360\216\254;;\210\330\214\233"
+	.ascii	"\3079\332<\232O\204\347]\002\020\025\273B\321Zx\212\004\001\027"
+	.ascii	"\004\327zFKk(\036\225\223\020\314G\017)\323\033\004#\322cY\234"
+	.ascii	"D\273\355\312\020\\\217\261\200\373\373J\353u\226\266k*\275\327"
+	.ascii	"ym\245\253\364]c\341h\3431\226\267W\367\350\257\270\256Ca\017"
+	.ascii	"\315M\316)e\212s\350\255\307|\226\"\356\365\021\347$k\264\005"
+	.ascii	"\260P9\313\332\b^;{\t\363e=/\016\026yT\316\037\\]oAut*U``\327"
+	.ascii	"\2247]\317\251tY\302\244:\025j\271\034\250\347\205\346\370\225"
+	.ascii	"\341j\273ZS\346\372\364i\2755\\o\305\254\267]\332\330\322<B'"
+	.ascii	"i\242\274\331|\246\314\260\324\300\203\256\351\350\365u\351\002"
+	.ascii	"\345\275\366S\305d\322i\253uX\034\020:\252N\373\311v>lX\312z"
+	.ascii	"t\332Ov\316\256\334\230l11\274\341\027\267\236@;\363\251\233"
+	.ascii	"c\2165y\237\355\374\345\360\"\327i\233u\330\217\226W\020j\235"
+	.ascii	"v\031\016\216#:tt\332L\330N\007\214\230\274:\266\273\001C\023"
+	.ascii	"(\267\266D\311\212F\315\363L\222\267\022\206\343-\205\321($>"
+	.ascii	"[\244\220\354@r\004gK\0231C\234%B\272\322\214\255\020\360\210"
+	.ascii	"11\265MJ\2225E\336bw\032x]\301Y\037C\204\350\f9\023\204M\220"
+	.ascii	"\267\220\207\341\271%\272\256\317\tZ\247?\323a\377sX+\n\217 "
+	.ascii	"a@\200\204q\301\n\274v~6\256\372\007\357\341\320\270\022L\322"
+	.ascii	"\351-\327\372\347\034\217Po\236W,s\335\201\"zs\235\243\315\305"
+	.ascii	"m\204\236w)C\026\254.\302\333l\242x_\331\332qv\005\244H\016\235"
+	.ascii	"\341\022!:m-\325\257y\030\325\351\333mm!:\007G;\353o,n{\n\305"
+	.ascii	"\353B\357}\366X\247\034zr\235\246B\352\017\013]\261]\367\351"
+	.ascii	"I=u\372\344\251\252\"\342\205c\247\311\026\256-\253\246\312f"
+	.ascii	"\267\346\354\364\335\374\273\212\251\264\024\r\367>\325\036j"
+	.ascii	"bw\2356\217PW\f\275\251\3242*=\324D{J\352\003\262\035`:m\033"
+	.ascii	"}\343-\3255ZJ\002\257{\235Z\352g\315\275N?\314\t0'\2206\0013"
+	.ascii	"\"EM\337P&\215'B\306\274t\372\246\3617\020\035\005\245\223#\253"
+	.ascii	"\f\225N\273\311$T\005x\204\332OCo\250\033@\3002}\235&\300#\234"
+	.ascii	"zIe\367\304\256\323s\027\323\003\247\026d\313\312\355\201\365"
+	.ascii	"=uj\341l\034G\237g\247\334\247\216\206[\036\326\372\037\370y"
+	.ascii	"\252u\273\225\362\347\344\324u\375\370\252j\223\342\267c\265"
+	.ascii	"\261~}Zw\372\236O\033\rZ\257\0230\264A2enG\032z\033M\237{F\316"
+	.ascii	":\265k\226G[\r\221\027\330\251\205\322Wh[mi\235Z\265\337Y(qX"
+	.ascii	"\322Z\207\316\024\022 ZgV\036&\221\023'6\215\241\334\252\t\346"
+	.ascii	"\332\f\226\335\233%\244F\021\323$,\315\0022\3413\262\2662\036"
+	.ascii	"\321\355\031G\355Y\317m\320v\235\254\204\360\232\206W\204\267"
+	.ascii	"y\005\205\b1>\034\034\253N \321\255\2315\003\272\027Lk\356\247"
+	.ascii	"\320oL\2244\253N\033\013\304\355\025G-\020\226I\220\332s\271"
+	.ascii	"Ce\013\205\316W\0252\265N\311pnh\275\265\001b\331\254\277A\255"
+	.ascii	"\276B\3232\350e\277\310\262\f\372\260E\230/\013\350BM\t\034\274"
+	.ascii	"\367Z\247\325\321W{N$v\211Ub\217X#6\tG\255\323\202\335\nas<\210"
+	.ascii	"\212u\332\035\226\007\363\005"
+	.string	"\331"
+	.ascii	"Mop\307\357\214\021>\237\024\353\202i\200\203\266\210\375a\211"
+	.ascii	"\354\3049\321\350\020\263c\034\265E\332\b\3501\374B\230\246\022"
+	.ascii	"\261Cx\346l\354\240\321\251\025\002\315\273\341\303,\214\243"
+	.ascii	"6H\030\032H\330\214uj\201\\0\255\261\264qC%[\257:\327\253`=V"
+	.ascii	"/\203\\{\\\353U\255\325nY.\2162`\273~\343\364\274\317&\302\306"
+	.ascii	"m\255\323\253\f\250\366\360\220\031P\257\336X\257>\255\277i\263"
+	.ascii	"\3766\353\352\006\212\305\314^\341\332BM\213\303\006\321d\016"
+	.ascii	"\310\033\231\365\326\312\204!Z\336~\247Z\252\333\252?\247\363"
+	.ascii	"\2148\247\004\327[);\3657\346\246\346e\275\275\361vhF\253Skc"
+	.ascii	"\215\272\261\302\200\016\327\024\036\326\306o\231\266FK\351p"
+	.ascii	"\310&M\247\377c\022j\017\217Pm\324\320-\215\235\275*\203O:\345"
+	.ascii	"\271)[y\234\326\311:\331' \336\262\204\232J\223\302$?s\373\324"
+	.ascii	"a\201\\d\321\037k\217\r2\262>+\354\321\222\226\326kreoo]?8\244"
+	.ascii	"H\021s\372dqsk\261\025\350>\365\2419\177\366\340\340Z\254\235"
+	.ascii	"8lOZ\203;UD\357\302h\027\262\335\006Y\353E\233\3232x\357\025"
+	.ascii	"\024>ZJ\224\240q\255?j\210\264\032\"-v\350\f\f\3544\352\275\374"
+	.ascii	"\364\252j\242y\247\351\331\343\022%\246\323>c\006\210\207`\227"
+	.ascii	"\021l2\353\362\336&sGG\346\347\244\323\036\3540\325\312R\007"
+	.ascii	"[\247-\206\355\254s\013\240\220N;L_\365L\035qb\373]*\004\335"
+	.ascii	"\231^\247\277\311\261\376\206\271\362\240\3055\335zu~\360\320"
+	.ascii	"\361#z\1779G\373K\367\245K,Y(\324+\263\264)`V\036+>\372\317G"
+	.ascii	"\013Y\227?\264x\3048\235\255\204\263\256\365r\003\253\253\354"
+	.ascii	"f]\t\371\250\021u\227\366\362\216>\332l\"\334{q\236\244d5\205"
+	.ascii	"\336\277z\235\232\367^\0347\317\333|\342Q\371\206Y\350\357a\313"
+	.ascii	"\n\374O\357"
+	.string	"=\001\304{\227q\177f\326$rN;N\334\337\3605\231\320\257\345\006_VP_XL\350\327]B\215-E4\357\327\222\t\275WD\312\242q\204\035\"\262\211)5\022\227\220\312\244z\245\024I\025D\244\246\245#cQ\0052\331\244B\200\245\245&\243\361h\304Q\026\2512\216H%\345\321\210\003\303\210\270\224\316`:\212A\214\241*%\233PH\0261%c\224x\261dTD\022](\245 \341\305\b.T(\211IH#\345\rG\307\245\026D\344\261\305\317\f\246c\213\002\224WJ\301\324tD&\025!\211Jb\f#\244\021\223\212\244\"\f\343\361h\201#c\023\bJbr\307\b\243\225\304$\021y\223,Jb\342Q\026\031\223\230n\214ILVY\304bH\207b2EB2\302\231\301t<J\221J&\213D4&\025\227\214p\220\210\311\2464\211sdQ\022S\212\236\031He\262\230DT\341"
+	.string	"e\3218\002S\262\004"
+	.ascii	"\210H\307\022\212KG8*\004)\224H#\246\024\312&&e\323\261'\006"
+	.ascii	"Q\231\234\341\242\210)YB\211\037\025\221D#1i\275\004,\036`AA"
+	.ascii	"\0168\247\300\002\b,\200@=\005\026\f\rY\300bh=\213!\253T\026"
+	.ascii	"\255\210`%\022\221 $\211\312\031\035\344\240\334I\211I#\342\022"
+	.ascii	"\021\211\263\343B\206\021\022I\207\250C\321\205\221HD\036%u\222"
+	.ascii	"\214E\244\322\305\016\322H\251\005QYD\312\310I&\211\310\244#"
+	.ascii	"\022\005\343\bH\"\214\244\321\b\371\"Y\f@iD\254A\2114\"*\345"
+	.ascii	"\034\031g$\211H5\200\237 \026\031\217E\345\021\021Y\364\200)"
+	.ascii	"\031\303\007i\244t\224&\213\210KE\030G$\n\001,\035\217r\224\311"
+	.ascii	"&\033\2208\220qD\346(\221D\034\214E\365\206#\243\245\032~\222"
+	.ascii	"I\242Q\251\224TDv@T\026\225d\374(\257\224\"\211$\342PD\"\231"
+	.ascii	"\370\221\211\210T\241<\036\221*v\224\306\246c\213\032\214\220"
+	.ascii	"I9\311\242\236d\021\013J\344\021\205\021\304\245\032\214^\340"
+	.ascii	"\240\022\217\2128\020\221\324\244\214#2M.\035\217R\027\232p^"
+	.ascii	"H\036\231\322\245\343\261\203\242\033$\"\322\210\270t\204\243"
+	.ascii	",\242@i,\252'2\032\202\021\001\261\202\241\024\006\274\202\n"
+	.ascii	"Z\234X\301\204\020\326\243\024L\311\030EJ\344\221i\206\321\022"
+	.ascii	"S\262\210\244\342XTa,\032\305Pq\204L\252H\201\200\214\243\n\310"
+	.ascii	"c\022\331t\224c\030\345\341\n\342u\013\371\226gO\324\250\001"
+	.ascii	"\323\\G\320\334 L\373\251\321\025\306\260\323\364\tK\020[gn\321"
+	.ascii	"\220\311\321cG\247\266\2145\303\304)\345K\247\202a\222\004\326"
+	.ascii	"\215\261d~\2028\335\354.\346\203MB%\204\200\203x8Tg\206@\304"
+	.ascii	"\330.sUO\242\204I\263&\025\226D\260\373,T\227\333X\247<W~~\026"
+	.ascii	"\f\257UQ9\t{\257I\2338\300[0\347A+\\\366\350\324~\3510\234gS"
+	.ascii	"\213\311\337\273\234B\226\374\331!\260\210ua\265\226\325\355"
+	.ascii	"K\037\227\333\272\003\227w\253%\317v\261d\326,\257\345\230\f"
+	.ascii	"\356\324\364\304\3510\363\342\273\355r\333\267\202\310\312Q\335"
+	.ascii	"}\241\351\324r\361\311\322\253\033\334b\253$\371\001}`\205\222"
+	.ascii	"\303\312\312\356\355\244\335E\365uj\365n\333\200P\361q\311\362"
+	.ascii	"\347\360\214)\222c\bt\375\352d\335\001\302v\373\306f\361l\037"
+	.ascii	"\317]B\271U8of`[\204\227\231%\344sC\314\327\217\272[\274\333"
+	.ascii	"++\210.h\004\022%J\247\326\312m\025!e\2420\357l\225#\201pm\272"
+	.ascii	"VK\345\001\256\302\036k\354\202p\021[\322i\323]\260\247\352\226"
+	.ascii	"puj\003\202\250\250B\3610\212\362\0203\b\221\210\310\2106I:R"
+	.ascii	"\n\020\006ci\036\310e\017\022\340T5\2229\307\314\214\210$IQ!"
+	.ascii	"{\215\001\252-\211\fB{\360A\215\225\030;\202\300s\223\203\371"
+	.ascii	"\3704\037q\323E\216>\246\242\270\031B:NJ\025\032.\260s\201Z\223"
+	.ascii	"\363_W\227\036\253\351\030\002\007d\200q\343\310jsO\374E\320"
+	.ascii	"w\357\025\246`;\207d\022\253\350\251`\363\2774CM\211[\211\376"
+	.ascii	"\367\363\350I;^\211$j\364\210\256\223\006\231\212\242\375\371"
+	.ascii	"\236e\245P\317\304:\260\237\244=G\n\317\353\205\003\005c\r\205"
+	.ascii	"\311\343a\204\r\3323T-\312\362\004h\337^?\217\276\312\273\t5"
+	.ascii	"\375Pb+c \036CJ\003\016\227!\020k\020\3734\345u\023\260s\267"
+	.string	"\374$J\017Q\351\342\246,\300T.\001\356&'\020S\307f\326f\fhw\231f\207\277\316\314~\230D\313\273\252\013\2305o\325\001\203\316\f\244\351\b\017k\035Q\177\236\253\331\023\376\016 \367\321\005\017\337\217/o\002U\256\"[\204r4\321\020\367\237\360\200\n\003\254\220\177\f\344d)\224\240\366\302\372\305Hym\366D\207I\231\215L\211o8\b\t\200\261\221\231\016\341j\276\220\331\372\347\204j\332k\001'\020>jlp\302s\256\271\367\214\373\017\250\025X7R)\034\367\322\374\"ix6\\b\027\334\211\336\337:\377\210\270r\256\212x;$\213\2231J8\262\336*\300\231\001\225q}{@X0DU\367\261\342A\352\375\340\240\017\364\203\220\356\017\3275\254$4I\343\013\256\031J\016\375\3515\037\341\265<\330\327\016?x\237\305>\262@\206\350\251\207\327\335Y\354\355\340\262\035M\303\373%\3700"
+	.string	"\356"
+	.ascii	"B\200\273x\023Q\006\b"
+	.string	"\003C\317\331\375\266\007*\016\245)(\274\221\177\217\322G"
+	.string	"U\311'\353\235h\314\352\234\023"
+	.string	"\335K+\313\310\242S\037\b\227\260\006s\360[\007\022\274L\030\r\"\032\262\250\216\206WS>\251\241\326\326\346B\031n3,\307;7\314\254\204\305\036\006\342U\034\315\035\201\200\016`Z\204M\255.O\321"
+	.string	"\224\374fE\216\243y\347\222\374\037I\325\247\304T\325\206+y\322\022\313\203\023\200\213\231\365<['\305\361N j\251\262\035\266\034\220<\222\250\361\355\213\216\210\274\035\354\037(?\241)"
+	.string	"\233|f-A\n]RDr\025\037\334\225\241lF\024\254\302v\232Z\334?\363\315W\250HpX[\241\207L\315\004=\">\226\316/w\\GG\250\350\333\225\262\232\002\3506\222I.$Lzp(C\023\204\377\271R\t\234H\272\"\003\3309jQxJFX\233B\350\347\314Z\222\342$\3617\340\355e\266\347\275\332\261\203M\365\327?\020\216\342\371\b\373\320:\235x\037\225\352\004r\340\216\366\230\033\234\336\276Gi\004\204\324\207V\245\250\255\004"
+	.ascii	",\203\273\3744F\242s\024\f\302\n\265\312\203X\233\326\\\200\021"
+	.ascii	"\007\tL\020\304 5!(x\350\247\324o\302\323\226\236 \300J\360\003"
+	.ascii	"TNZ\214\025\327T\241\326\342\215\243\242\321\002N\240\001\333"
+	.ascii	"\f(_\254-\222\353\023<<\027\313c\234\tp@D&\252\371Zy\007/\377"
+	.ascii	"\277\2550\274\256\030\023Z\371D\355\3156\2065\225\030\360\222"
+	.ascii	"/e2\263\032\251x\2638\302\370\3638\222\336\353\305O\354\022\230"
+	.ascii	"UT*\346\312\373\357g/\222\343\256>\3229\350\366-`\270\355=)\002"
+	.ascii	":\230\020"
+	.string	"d3B\001>1%\213~\357`\275\224a\252\257\210\006\027\f%\323\210J\357\206\212B\"I\220\331\307\020\211\031\b\r3\345Q\267\233e\321\247e\244\221C\334\200\253UA\316\003\276\370\r\3643\346Cb\033\330M\237o0F\203\022i40\244?\263\246X:\033\005dO`\235\231\326\256\246\271\361\315\231-\003\372\013\021\232\004\356\366/\315\336\215\333\346\310\262\017\301\017v\022\341\200\312\251\223\207\242d1\241\024#m@L\364\2430q\244\004\254\007\305\263\243#\th\367\343\261PI\354\201^\205\035C\331=\ff\233C\336P\346c\b\264r&\277v;\361\346paW\300\324\205\bf\307\276\207\247\346\341\240\007S\235\017`T\364\221\345\201\204\245\203D\307\203\223A^(\236Cmn^\235\357U\322\261\300\201\002\353\223LL\030\023\315\240\315prq&\353\212\262\247\257\034\033\n\241\370X\007\033am\225\350"
+	.string	"\330\372\320\004\222"
+	.string	"\341/f\207\351r\253]\212M\231\365T\351C\f<\330\025\013\024\327\371\347p_\344\343\343W\003\177\035\344\353\356x\232k\"\371#\305a\315\035\300<Y\362\2432\336f\007\226Y9\355a\354\305\277n\240\356\202\\\353\374\\\344Yw\034\376mzH1\315\362\t\357)\342\217?\353\311\3467\373|j\034\233\260%`\323\323\307u\007\357\330\361\217\347\033\331G~\334'\237\253<\202\346|\366:wx\327\345\220\342\227\005\363\235b\205\302"
+	.string	"\330\317h\206\340\217\305\347y\220\n\311\304: \315+\207$Xqh\177\005\203"
+	.string	"\206\n~\221\021!WU\r=&lI\177\003\336\020S\013'o\3107a\302\377"
+	.ascii	"\330\n"
+	.text
+	.section	.gnu.lto_.symtab.5edd62853221fa77,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5edd62853221fa77,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
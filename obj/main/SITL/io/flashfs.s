@@ -0,0 +1,9832 @@
+	.file	"flashfs.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/drivers/flash.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/io/flashfs.h"
+	.file 8 "./src/main/io/flashfs.c"
+	.file 9 "./src/main/drivers/flash_m25p16.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "./src/main/drivers/time.h"
+	.file 12 "./src/main/common/utils.h"
+	.file 13 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	flashfs.c.db81e541
+	.weak	flashfs.c.db81e541
+flashfs.c.db81e541:
+	.long	0x9b3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF1105
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF957
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF958
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF959
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF960
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF961
+	.uleb128 0x4
+	.long	.LASF963
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF962
+	.uleb128 0x4
+	.long	.LASF964
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF965
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF966
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF967
+	.uleb128 0x4
+	.long	.LASF968
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF969
+	.uleb128 0x4
+	.long	.LASF970
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF971
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0xb0
+	.uleb128 0x4
+	.long	.LASF972
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x9
+	.long	0xc1
+	.uleb128 0x4
+	.long	.LASF973
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x9
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF974
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x4
+	.long	.LASF975
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF976
+	.uleb128 0x14
+	.long	.LASF985
+	.byte	0x10
+	.byte	0x5
+	.byte	0x17
+	.long	0x150
+	.uleb128 0x6
+	.long	.LASF977
+	.byte	0x5
+	.byte	0x18
+	.byte	0xe
+	.long	0xc1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF978
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xe
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF979
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF980
+	.byte	0x5
+	.byte	0x1d
+	.byte	0xe
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF981
+	.byte	0x5
+	.byte	0x1f
+	.byte	0xe
+	.long	0xd2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x9
+	.long	0x102
+	.uleb128 0x4
+	.long	.LASF982
+	.byte	0x5
+	.byte	0x20
+	.byte	0x3
+	.long	0x102
+	.uleb128 0x9
+	.long	0x155
+	.uleb128 0x28
+	.long	.LASF1106
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd2
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF983
+	.uleb128 0x4
+	.long	.LASF984
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xd2
+	.uleb128 0x14
+	.long	.LASF986
+	.byte	0xc
+	.byte	0x7
+	.byte	0x24
+	.long	0x1b9
+	.uleb128 0x6
+	.long	.LASF987
+	.byte	0x7
+	.byte	0x25
+	.byte	0xe
+	.long	0xd2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF988
+	.byte	0x7
+	.byte	0x26
+	.byte	0xe
+	.long	0xd2
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF989
+	.byte	0x7
+	.byte	0x27
+	.byte	0xe
+	.long	0xd2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF990
+	.byte	0x7
+	.byte	0x28
+	.byte	0x3
+	.long	0x185
+	.uleb128 0x9
+	.long	0x1b9
+	.uleb128 0xa
+	.long	0xb0
+	.long	0x1db
+	.uleb128 0x29
+	.long	0x37
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0x39
+	.byte	0x10
+	.long	0x1ca
+	.uleb128 0x2
+	.long	.LASF992
+	.byte	0x45
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0x2
+	.long	.LASF993
+	.byte	0x45
+	.byte	0x21
+	.long	0xc1
+	.uleb128 0x2
+	.long	.LASF994
+	.byte	0x48
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x2
+	.long	.LASF995
+	.byte	0x4a
+	.byte	0xc
+	.long	0x212
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF996
+	.uleb128 0x9
+	.long	0x212
+	.uleb128 0x2
+	.long	.LASF997
+	.byte	0x4b
+	.byte	0x11
+	.long	0x179
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x4d
+	.byte	0x1c
+	.long	0x1b9
+	.uleb128 0x2
+	.long	.LASF999
+	.byte	0x53
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x2
+	.long	.LASF1000
+	.byte	0x56
+	.byte	0x11
+	.long	0x179
+	.uleb128 0x14
+	.long	.LASF1001
+	.byte	0x10
+	.byte	0x8
+	.byte	0x5f
+	.long	0x28b
+	.uleb128 0x6
+	.long	.LASF1002
+	.byte	0x8
+	.byte	0x60
+	.byte	0xe
+	.long	0xd2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF994
+	.byte	0x8
+	.byte	0x61
+	.byte	0xe
+	.long	0xd2
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF999
+	.byte	0x8
+	.byte	0x62
+	.byte	0xe
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1003
+	.byte	0x8
+	.byte	0x63
+	.byte	0xe
+	.long	0xd2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1004
+	.byte	0x8
+	.byte	0x64
+	.byte	0x3
+	.long	0x24a
+	.uleb128 0x9
+	.long	0x28b
+	.uleb128 0x2
+	.long	.LASF1005
+	.byte	0x67
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0x2
+	.long	.LASF1006
+	.byte	0x68
+	.byte	0xc
+	.long	0x212
+	.uleb128 0x2
+	.long	.LASF1007
+	.byte	0x6e
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x15
+	.long	.LASF1008
+	.byte	0x9
+	.byte	0x24
+	.byte	0x5
+	.long	0x70
+	.long	0x2dd
+	.uleb128 0x5
+	.long	0xd2
+	.uleb128 0x5
+	.long	0x2dd
+	.uleb128 0x5
+	.long	0x70
+	.byte	0
+	.uleb128 0x8
+	.long	0xb0
+	.uleb128 0x15
+	.long	.LASF1009
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.long	0x9b
+	.long	0x302
+	.uleb128 0x5
+	.long	0x9b
+	.uleb128 0x5
+	.long	0x302
+	.uleb128 0x5
+	.long	0xef
+	.byte	0
+	.uleb128 0x8
+	.long	0x307
+	.uleb128 0x2a
+	.uleb128 0x19
+	.long	.LASF1018
+	.byte	0x22
+	.uleb128 0x10
+	.long	.LASF1010
+	.byte	0x21
+	.long	0x323
+	.uleb128 0x5
+	.long	0x323
+	.uleb128 0x5
+	.long	0x70
+	.byte	0
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0x10
+	.long	.LASF1011
+	.byte	0x20
+	.long	0x338
+	.uleb128 0x5
+	.long	0xd2
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1012
+	.byte	0x9
+	.byte	0x27
+	.byte	0x5
+	.long	0x212
+	.long	0x34e
+	.uleb128 0x5
+	.long	0xd2
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1013
+	.byte	0x1e
+	.long	0x368
+	.uleb128 0x5
+	.long	0xd2
+	.uleb128 0x5
+	.long	0x323
+	.uleb128 0x5
+	.long	0x70
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1015
+	.byte	0x9
+	.byte	0x26
+	.byte	0x5
+	.long	0x212
+	.uleb128 0x10
+	.long	.LASF1014
+	.byte	0x1b
+	.long	0x384
+	.uleb128 0x5
+	.long	0xd2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1016
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x1f
+	.long	0x390
+	.uleb128 0x8
+	.long	0x150
+	.uleb128 0x16
+	.long	.LASF1017
+	.byte	0xb
+	.byte	0x1b
+	.byte	0xa
+	.long	0x179
+	.uleb128 0x19
+	.long	.LASF1019
+	.byte	0x1c
+	.uleb128 0x1a
+	.long	.LASF1053
+	.value	0x3bb
+	.long	0x3c1
+	.uleb128 0xe
+	.uleb128 0x1
+	.long	.LASF1020
+	.value	0x3bf
+	.byte	0x1f
+	.long	0x28b
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1021
+	.value	0x3b4
+	.byte	0x5
+	.long	0x212
+	.uleb128 0xc
+	.long	.LASF1022
+	.value	0x3ac
+	.byte	0x5
+	.long	0x70
+	.uleb128 0x1b
+	.long	.LASF1063
+	.value	0x368
+	.long	0xd2
+	.long	0x499
+	.uleb128 0x3
+	.long	.LASF1023
+	.value	0x368
+	.byte	0x36
+	.long	0xd2
+	.uleb128 0x11
+	.string	"end"
+	.value	0x368
+	.byte	0x46
+	.long	0xd2
+	.uleb128 0x2b
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x8
+	.value	0x372
+	.byte	0xa
+	.long	0x423
+	.uleb128 0x2c
+	.long	.LASF1024
+	.value	0x800
+	.uleb128 0x1c
+	.long	.LASF1025
+	.byte	0x4
+	.uleb128 0x1c
+	.long	.LASF1026
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2d
+	.byte	0x10
+	.byte	0x8
+	.value	0x37d
+	.byte	0x5
+	.long	0x446
+	.uleb128 0x1d
+	.long	.LASF1027
+	.value	0x37e
+	.byte	0x11
+	.long	0x499
+	.uleb128 0x1d
+	.long	.LASF1028
+	.value	0x37f
+	.byte	0x12
+	.long	0x4a9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1029
+	.value	0x380
+	.byte	0x7
+	.long	0x423
+	.uleb128 0x1
+	.long	.LASF1030
+	.value	0x382
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1031
+	.value	0x383
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x12
+	.string	"mid"
+	.value	0x384
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1032
+	.value	0x385
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x12
+	.string	"i"
+	.value	0x386
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1033
+	.value	0x387
+	.byte	0x9
+	.long	0x212
+	.byte	0
+	.uleb128 0xa
+	.long	0xb0
+	.long	0x4a9
+	.uleb128 0xd
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0xd2
+	.long	0x4b9
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1034
+	.value	0x34e
+	.byte	0x5
+	.long	0x70
+	.long	0x4fa
+	.uleb128 0x3
+	.long	.LASF1035
+	.value	0x34e
+	.byte	0x1d
+	.long	0xd2
+	.uleb128 0x3
+	.long	.LASF1036
+	.value	0x34e
+	.byte	0x2f
+	.long	0x2dd
+	.uleb128 0x11
+	.string	"len"
+	.value	0x34e
+	.byte	0x44
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1037
+	.value	0x350
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1044
+	.value	0x316
+	.long	0x55c
+	.uleb128 0x3
+	.long	.LASF1038
+	.value	0x316
+	.byte	0x22
+	.long	0x323
+	.uleb128 0x11
+	.string	"len"
+	.value	0x316
+	.byte	0x35
+	.long	0x30
+	.uleb128 0x3
+	.long	.LASF1039
+	.value	0x316
+	.byte	0x3e
+	.long	0x212
+	.uleb128 0x1
+	.long	.LASF1040
+	.value	0x333
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1041
+	.value	0x335
+	.byte	0x12
+	.long	0x30
+	.uleb128 0xe
+	.uleb128 0x1
+	.long	.LASF1042
+	.value	0x31a
+	.byte	0x1d
+	.long	0x55c
+	.uleb128 0x1
+	.long	.LASF1043
+	.value	0x31b
+	.byte	0x16
+	.long	0x56c
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x323
+	.long	0x56c
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xd2
+	.long	0x57c
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1045
+	.value	0x305
+	.long	0x594
+	.uleb128 0x3
+	.long	.LASF1046
+	.value	0x305
+	.byte	0x22
+	.long	0xd2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1047
+	.value	0x2f6
+	.byte	0xa
+	.long	0x2dd
+	.long	0x5b1
+	.uleb128 0x3
+	.long	.LASF1046
+	.value	0x2f6
+	.byte	0x28
+	.long	0x5b1
+	.byte	0
+	.uleb128 0x8
+	.long	0xd2
+	.uleb128 0xb
+	.long	.LASF1048
+	.value	0x2e0
+	.long	0x5ce
+	.uleb128 0x3
+	.long	.LASF1049
+	.value	0x2e0
+	.byte	0x1f
+	.long	0xb0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1050
+	.value	0x2d6
+	.long	0x5e6
+	.uleb128 0x3
+	.long	.LASF1051
+	.value	0x2d6
+	.byte	0x1d
+	.long	0xa4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1052
+	.value	0x2cf
+	.long	0x5fe
+	.uleb128 0x3
+	.long	.LASF1051
+	.value	0x2cf
+	.byte	0x1e
+	.long	0xd2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1054
+	.value	0x2bf
+	.long	0x622
+	.uleb128 0x1
+	.long	.LASF1042
+	.value	0x2c5
+	.byte	0x15
+	.long	0x622
+	.uleb128 0x1
+	.long	.LASF1043
+	.value	0x2c6
+	.byte	0xe
+	.long	0x632
+	.byte	0
+	.uleb128 0xa
+	.long	0x323
+	.long	0x632
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0xd2
+	.long	0x642
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1055
+	.byte	0x8
+	.value	0x2b2
+	.byte	0x6
+	.uleb128 0xb
+	.long	.LASF1056
+	.value	0x29f
+	.long	0x663
+	.uleb128 0x3
+	.long	.LASF1057
+	.value	0x29f
+	.byte	0x16
+	.long	0x212
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1058
+	.value	0x26f
+	.byte	0x5
+	.long	0x212
+	.long	0x698
+	.uleb128 0x3
+	.long	.LASF1059
+	.value	0x26f
+	.byte	0x1c
+	.long	0x212
+	.uleb128 0x1
+	.long	.LASF1060
+	.value	0x276
+	.byte	0xe
+	.long	0xd2
+	.uleb128 0x1
+	.long	.LASF1061
+	.value	0x277
+	.byte	0x14
+	.long	0xde
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1062
+	.value	0x261
+	.byte	0xa
+	.long	0xd2
+	.uleb128 0x1e
+	.long	.LASF1085
+	.value	0x250
+	.long	0x6c8
+	.uleb128 0x3
+	.long	.LASF1042
+	.value	0x250
+	.byte	0x37
+	.long	0x6c8
+	.uleb128 0x3
+	.long	.LASF1043
+	.value	0x250
+	.byte	0x4b
+	.long	0x5b1
+	.byte	0
+	.uleb128 0x8
+	.long	0x323
+	.uleb128 0x1b
+	.long	.LASF1064
+	.value	0x1f8
+	.long	0xd2
+	.long	0x73d
+	.uleb128 0x3
+	.long	.LASF1042
+	.value	0x1f8
+	.byte	0x35
+	.long	0x6c8
+	.uleb128 0x3
+	.long	.LASF1043
+	.value	0x1f8
+	.byte	0x48
+	.long	0x5b1
+	.uleb128 0x3
+	.long	.LASF1065
+	.value	0x1f8
+	.byte	0x59
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1066
+	.value	0x1fa
+	.byte	0xe
+	.long	0xd2
+	.uleb128 0x12
+	.string	"i"
+	.value	0x1fc
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1067
+	.value	0x208
+	.byte	0xe
+	.long	0xd2
+	.uleb128 0xe
+	.uleb128 0x1
+	.long	.LASF1068
+	.value	0x20b
+	.byte	0x12
+	.long	0xd2
+	.uleb128 0x1
+	.long	.LASF1069
+	.value	0x20c
+	.byte	0x12
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1070
+	.value	0x1e1
+	.byte	0xa
+	.long	0xd2
+	.uleb128 0x1f
+	.long	.LASF1071
+	.value	0x1d8
+	.byte	0x1c
+	.long	0x755
+	.uleb128 0x8
+	.long	0x1c5
+	.uleb128 0xc
+	.long	.LASF1072
+	.value	0x1d0
+	.byte	0x18
+	.long	0x390
+	.uleb128 0xc
+	.long	.LASF1073
+	.value	0x1cb
+	.byte	0xa
+	.long	0xd2
+	.uleb128 0xc
+	.long	.LASF1074
+	.value	0x1c3
+	.byte	0xa
+	.long	0xd2
+	.uleb128 0x2f
+	.long	.LASF1083
+	.byte	0x8
+	.value	0x1b8
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x20
+	.long	.LASF1075
+	.value	0x1ad
+	.byte	0xa
+	.long	0xd2
+	.long	0x7a8
+	.uleb128 0x1
+	.long	.LASF1076
+	.value	0x1af
+	.byte	0x1c
+	.long	0x7a8
+	.byte	0
+	.uleb128 0x8
+	.long	0x161
+	.uleb128 0x20
+	.long	.LASF1077
+	.value	0x19f
+	.byte	0x5
+	.long	0x212
+	.long	0x7ca
+	.uleb128 0x1
+	.long	.LASF1078
+	.value	0x1a1
+	.byte	0xf
+	.long	0x219
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1079
+	.value	0x182
+	.long	0x82a
+	.uleb128 0x3
+	.long	.LASF1023
+	.value	0x182
+	.byte	0x21
+	.long	0xd2
+	.uleb128 0x11
+	.string	"end"
+	.value	0x182
+	.byte	0x31
+	.long	0xd2
+	.uleb128 0x1
+	.long	.LASF1076
+	.value	0x184
+	.byte	0x1c
+	.long	0x7a8
+	.uleb128 0x1
+	.long	.LASF1080
+	.value	0x18a
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1081
+	.value	0x18d
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x1
+	.long	.LASF1082
+	.value	0x18e
+	.byte	0x9
+	.long	0x70
+	.uleb128 0xe
+	.uleb128 0x12
+	.string	"i"
+	.value	0x194
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1084
+	.byte	0x8
+	.value	0x16c
+	.byte	0xd
+	.uleb128 0x1e
+	.long	.LASF1086
+	.value	0x14b
+	.long	0x84b
+	.uleb128 0x3
+	.long	.LASF1057
+	.value	0x14b
+	.byte	0x26
+	.long	0x212
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1089
+	.value	0x13f
+	.long	0x212
+	.uleb128 0x22
+	.long	.LASF1087
+	.value	0x12a
+	.uleb128 0x22
+	.long	.LASF1088
+	.value	0x119
+	.uleb128 0x21
+	.long	.LASF1090
+	.value	0x107
+	.long	0x212
+	.uleb128 0x18
+	.long	.LASF1091
+	.byte	0xda
+	.byte	0xc
+	.long	0x212
+	.long	0x8d5
+	.uleb128 0xf
+	.long	.LASF1020
+	.byte	0xda
+	.byte	0x36
+	.long	0x8d5
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0xdc
+	.byte	0x14
+	.long	0xde
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0xdf
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0xe0
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x31
+	.long	0x8c7
+	.uleb128 0x32
+	.string	"mid"
+	.byte	0x8
+	.byte	0xe3
+	.byte	0x13
+	.long	0x77
+	.uleb128 0x2
+	.long	.LASF1002
+	.byte	0xe4
+	.byte	0x12
+	.long	0xd2
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0xf4
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x28b
+	.uleb128 0x13
+	.long	.LASF1094
+	.byte	0xbf
+	.long	0x8f0
+	.uleb128 0x2
+	.long	.LASF1020
+	.byte	0xc7
+	.byte	0x1b
+	.long	0x28b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1095
+	.byte	0xb6
+	.byte	0x11
+	.long	0xd2
+	.long	0x90b
+	.uleb128 0xf
+	.long	.LASF1020
+	.byte	0xb6
+	.byte	0x42
+	.long	0x90b
+	.byte	0
+	.uleb128 0x8
+	.long	0x297
+	.uleb128 0x23
+	.long	.LASF1096
+	.byte	0xb1
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0x18
+	.long	.LASF1097
+	.byte	0xaa
+	.byte	0x11
+	.long	0xd2
+	.long	0x936
+	.uleb128 0x2
+	.long	.LASF1076
+	.byte	0xac
+	.byte	0x1c
+	.long	0x7a8
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1098
+	.byte	0xa4
+	.byte	0xc
+	.long	0x212
+	.uleb128 0x13
+	.long	.LASF1099
+	.byte	0x96
+	.long	0x957
+	.uleb128 0xf
+	.long	.LASF1046
+	.byte	0x96
+	.byte	0x29
+	.long	0xd2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1100
+	.byte	0x88
+	.long	0x96d
+	.uleb128 0xf
+	.long	.LASF1101
+	.byte	0x88
+	.byte	0x31
+	.long	0xd2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1102
+	.byte	0x7d
+	.long	0x983
+	.uleb128 0xf
+	.long	.LASF1035
+	.byte	0x7d
+	.byte	0x2c
+	.long	0xd2
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1103
+	.byte	0x8
+	.byte	0x75
+	.byte	0xc
+	.long	0x212
+	.uleb128 0x34
+	.long	.LASF1107
+	.byte	0x8
+	.byte	0x70
+	.byte	0xd
+	.uleb128 0x35
+	.long	.LASF1104
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x17
+	.long	0xa4
+	.uleb128 0x24
+	.string	"a"
+	.byte	0x5d
+	.byte	0x26
+	.long	0xd2
+	.uleb128 0x24
+	.string	"b"
+	.byte	0x5d
+	.byte	0x32
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF565
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF625
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF693
+	.byte	0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 33 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x5
+	.file 34 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.file 35 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x23
+	.file 36 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 37 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF956
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF742
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF772
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF773
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF774
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.8fcd518b05545f13645854f569c3dee7,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF897
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.21.42b0efe26f2c975d82840e6ab4f40d87,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF953
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1108
+	.long	.LASF1109
+	.long	.LASF1110
+	.long	.LASF1111
+	.long	.LASF1112
+	.long	.LASF1113
+	.long	.LASF1114
+	.long	.LASF1115
+	.long	.LASF1116
+	.long	.LASF1117
+	.long	.LASF1118
+	.long	.LASF1119
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x26
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1120
+	.byte	0x8
+	.long	.LASF1121
+	.byte	0x8
+	.long	.LASF1122
+	.byte	0x8
+	.long	.LASF1123
+	.byte	0xc
+	.long	.LASF1124
+	.byte	0x2
+	.long	.LASF1125
+	.byte	0x1
+	.long	.LASF1126
+	.byte	0x3
+	.long	.LASF1127
+	.byte	0x3
+	.long	.LASF1128
+	.byte	0x2
+	.long	.LASF1129
+	.byte	0xb
+	.long	.LASF1125
+	.byte	0x2
+	.long	.LASF1130
+	.byte	0x1
+	.long	.LASF1131
+	.byte	0x4
+	.long	.LASF1132
+	.byte	0xb
+	.long	.LASF1133
+	.byte	0xc
+	.long	.LASF1133
+	.byte	0xb
+	.long	.LASF1134
+	.byte	0x8
+	.long	.LASF1135
+	.byte	0xb
+	.long	.LASF1136
+	.byte	0xb
+	.long	.LASF1137
+	.byte	0x8
+	.long	.LASF1138
+	.byte	0x8
+	.long	.LASF1139
+	.byte	0xa
+	.long	.LASF1140
+	.byte	0x8
+	.long	.LASF1141
+	.byte	0x9
+	.long	.LASF1142
+	.byte	0x9
+	.long	.LASF1143
+	.byte	0x8
+	.long	.LASF1144
+	.byte	0x8
+	.long	.LASF1145
+	.byte	0x8
+	.long	.LASF1146
+	.byte	0xc
+	.long	.LASF1147
+	.byte	0x7
+	.long	.LASF1148
+	.byte	0x7
+	.long	.LASF1149
+	.byte	0xb
+	.long	.LASF1150
+	.byte	0x1
+	.long	.LASF1151
+	.byte	0x2
+	.long	.LASF1152
+	.byte	0x6
+	.long	.LASF1153
+	.byte	0x5
+	.long	.LASF1154
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF638:
+	.string	"INT32_MAX (2147483647)"
+.LASF580:
+	.string	"__STD_TYPE typedef"
+.LASF816:
+	.string	"USE_CLI_BATCH "
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF985:
+	.string	"flashGeometry_s"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF975:
+	.string	"size_t"
+.LASF987:
+	.string	"bytesWritten"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1023:
+	.string	"start"
+.LASF1012:
+	.string	"m25p16_waitForReady"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF1073:
+	.string	"flashfsGetWriteBufferFreeSpace"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF953:
+	.string	"FLASHFS_ERASE_POOL_SECTORS 4"
+.LASF807:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF593:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1008:
+	.string	"m25p16_readBytes"
+.LASF1024:
+	.string	"FREE_BLOCK_SIZE"
+.LASF486:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF613:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF684:
+	.string	"INT16_C(c) c"
+.LASF970:
+	.string	"int32_t"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF942:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF853:
+	.string	"VTX_TRAMP "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF693:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF981:
+	.string	"totalSize"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF674:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF789:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF775:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF696:
+	.string	"true 1"
+.LASF884:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF653:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF625:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF663:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1007:
+	.string	"journalEraseAddress"
+.LASF1088:
+	.string	"flashfsEraseCompletely"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF801:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF783:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF824:
+	.string	"USE_SERIALRX_SUMD "
+.LASF991:
+	.string	"flashWriteBuffer"
+.LASF1056:
+	.string	"flashfsPoll"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF766:
+	.string	"_WCHAR_T_DEFINED "
+.LASF900:
+	.string	"USE_VCP"
+.LASF1071:
+	.string	"flashfsGetWriteStats"
+.LASF751:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF792:
+	.string	"PP_IIF_1(t,f) t"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF940:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF688:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF632:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF577:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF954:
+	.string	"FLASHFS_ERASE_READ_HOLDOFF_US 500000"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF841:
+	.string	"TELEMETRY_MAVLINK "
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF797:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF641:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF662:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1059:
+	.string	"force"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1013:
+	.string	"m25p16_pageProgram"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF721:
+	.string	"NULL"
+.LASF730:
+	.string	"VERY_FAST_MATH "
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1052:
+	.string	"flashfsSeekAbs"
+.LASF907:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1078:
+	.string	"deviceReady"
+.LASF1022:
+	.string	"flashfsIdentifyStartOfFreeSpace"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF1032:
+	.string	"result"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1028:
+	.string	"ints"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF846:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF510:
+	.string	"__always_inline"
+.LASF657:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF821:
+	.string	"USE_SERIALRX_IBUS "
+.LASF835:
+	.string	"USE_SERVOS "
+.LASF385:
+	.string	"DEBUG 1"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF634:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF945:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF967:
+	.string	"long int"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF784:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF728:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF608:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1102:
+	.string	"flashfsSetTailAddress"
+.LASF738:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF750:
+	.string	"_PTRDIFF_T_ "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF845:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF622:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF896:
+	.string	"STACK_CHECK"
+.LASF607:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1096:
+	.string	"flashfsJournalSlotCount"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF669:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF601:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF979:
+	.string	"pageSize"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF897:
+	.string	"USE_DASHBOARD"
+.LASF910:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1075:
+	.string	"flashfsGetSize"
+.LASF732:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF837:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF676:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF830:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF741:
+	.string	"Q12 (1 << 12)"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF920:
+	.string	"TELEMETRY_SRXL"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF938:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF961:
+	.string	"signed char"
+.LASF956:
+	.string	"FLASHFS_JOURNAL_MAGIC 0x4A534642"
+.LASF971:
+	.string	"uint8_t"
+.LASF598:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF567:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF908:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1095:
+	.string	"flashfsJournalCheck"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF582:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1086:
+	.string	"flashfsEraseContinue"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1090:
+	.string	"flashfsDeviceIsReady"
+.LASF879:
+	.string	"BARO "
+.LASF992:
+	.string	"bufferHead"
+.LASF765:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1077:
+	.string	"flashfsIsReady"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF901:
+	.string	"USE_PPM"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF600:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF957:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF654:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF885:
+	.string	"USE_UART1 "
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF932:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF944:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF941:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF887:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF952:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF633:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF996:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF473:
+	.string	"__P(args) args"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF811:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF780:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF823:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF609:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF420:
+	.string	"__USE_GNU"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF649:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF647:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF782:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF921:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF570:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF592:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF914:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1074:
+	.string	"flashfsGetWriteBufferSize"
+.LASF964:
+	.string	"__uint16_t"
+.LASF786:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF950:
+	.string	"FLASHFS_WRITE_BUFFER_PAGES 2"
+.LASF624:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1027:
+	.string	"bytes"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF851:
+	.string	"VTX_CONTROL "
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF936:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF802:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF660:
+	.string	"INT_FAST8_MAX (127)"
+.LASF648:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF575:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF640:
+	.string	"UINT8_MAX (255)"
+.LASF1100:
+	.string	"flashfsAdvanceTailInBuffer"
+.LASF689:
+	.string	"UINT32_C(c) c ## U"
+.LASF668:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF639:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF947:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF658:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF1014:
+	.string	"m25p16_eraseSector"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF859:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF805:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF623:
+	.string	"_BITS_TIME64_H 1"
+.LASF586:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF769:
+	.string	"__INT_WCHAR_T_H "
+.LASF666:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF809:
+	.string	"I2C1_OVERCLOCK true"
+.LASF571:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF616:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1011:
+	.string	"m25p16_pageProgramBegin"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1081:
+	.string	"endSector"
+.LASF656:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF813:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF618:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF935:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF695:
+	.string	"bool _Bool"
+.LASF734:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF949:
+	.string	"FLASHFS_PAGE_SIZE 256"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF785:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF963:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF986:
+	.string	"flashfsWriteStats_s"
+.LASF990:
+	.string	"flashfsWriteStats_t"
+.LASF1036:
+	.string	"buffer"
+.LASF1041:
+	.string	"firstPortion"
+.LASF804:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF665:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF742:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1010:
+	.string	"m25p16_pageProgramContinue"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1015:
+	.string	"m25p16_isReady"
+.LASF1030:
+	.string	"left"
+.LASF659:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF929:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF781:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF852:
+	.string	"VTX_SMARTAUDIO "
+.LASF866:
+	.string	"U_ID_2 2"
+.LASF875:
+	.string	"GYRO "
+.LASF1099:
+	.string	"flashfsPageProgram"
+.LASF911:
+	.string	"LED_STRIP"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF892:
+	.string	"USE_UART8 "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF576:
+	.string	"__SLONG32_TYPE int"
+.LASF681:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF597:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF980:
+	.string	"sectorSize"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF818:
+	.string	"USE_PWM "
+.LASF800:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF848:
+	.string	"USE_SENSOR_NAMES "
+.LASF628:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF630:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1065:
+	.string	"bufferCount"
+.LASF968:
+	.string	"__uint64_t"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF672:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF776:
+	.string	"NOOP do {} while (0)"
+.LASF599:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF565:
+	.string	"_BITS_TYPES_H 1"
+.LASF1048:
+	.string	"flashfsWriteByte"
+.LASF1034:
+	.string	"flashfsReadAbs"
+.LASF677:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF687:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF1003:
+	.string	"check"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1035:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1106:
+	.string	"SystemCoreClock"
+.LASF995:
+	.string	"pageProgramTiming"
+.LASF994:
+	.string	"tailAddress"
+.LASF794:
+	.string	"UNUSED(x) (void)(x)"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1033:
+	.string	"blockErased"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF585:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF392:
+	.string	"__REVISION__ \"599932d\""
+.LASF701:
+	.string	"__need_NULL "
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF849:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF865:
+	.string	"U_ID_1 1"
+.LASF847:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF791:
+	.string	"PP_IIF_0(t,f) f"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF923:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF803:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF581:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF777:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF831:
+	.string	"TELEMETRY_FRSKY "
+.LASF893:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF752:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1055:
+	.string	"flashfsJournalTail"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1000:
+	.string	"eraseHoldoffUntil"
+.LASF747:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1092:
+	.string	"journalAddress"
+.LASF863:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF629:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF743:
+	.string	"_STDDEF_H "
+.LASF977:
+	.string	"sectors"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF939:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1042:
+	.string	"buffers"
+.LASF617:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1083:
+	.string	"flashfsTransmitBufferUsed"
+.LASF760:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF902:
+	.string	"USE_PWM"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF922:
+	.string	"VTX_COMMON"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF966:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF1031:
+	.string	"right"
+.LASF790:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF903:
+	.string	"SERIAL_RX"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF685:
+	.string	"INT32_C(c) c"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF757:
+	.string	"__wchar_t__ "
+.LASF1089:
+	.string	"flashfsErasePoolIsReady"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF815:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF881:
+	.string	"USE_FLASHFS "
+.LASF395:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF671:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF762:
+	.string	"__WCHAR_T "
+.LASF983:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1039:
+	.string	"sync"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF463:
+	.string	"__PMT"
+.LASF982:
+	.string	"flashGeometry_t"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF868:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF603:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF572:
+	.string	"__SQUAD_TYPE long int"
+.LASF909:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF745:
+	.string	"_ANSI_STDDEF_H "
+.LASF779:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF686:
+	.string	"INT64_C(c) c ## L"
+.LASF733:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF934:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF834:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF855:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1070:
+	.string	"flashfsGetWriteBandwidth"
+.LASF364:
+	.string	"__k8 1"
+.LASF1020:
+	.string	"entry"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF883:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1104:
+	.string	"cmp32"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF959:
+	.string	"unsigned int"
+.LASF627:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1069:
+	.string	"bytesRemainThisIteration"
+.LASF827:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF694:
+	.string	"_STDBOOL_H "
+.LASF771:
+	.string	"_WCHAR_T_DECLARED "
+.LASF833:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF610:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF569:
+	.string	"__U32_TYPE unsigned int"
+.LASF748:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF796:
+	.string	"BIT(x) (1 << (x))"
+.LASF746:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF651:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF606:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF644:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF509:
+	.string	"__wur "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF912:
+	.string	"TELEMETRY_FRSKY"
+.LASF951:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_WRITE_BUFFER_PAGES * FLASHFS_PAGE_SIZE)"
+.LASF1063:
+	.string	"flashfsFindStartOfFreeSpace"
+.LASF697:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF683:
+	.string	"INT8_C(c) c"
+.LASF1040:
+	.string	"bufferBytesBeforeWrap"
+.LASF754:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1051:
+	.string	"offset"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF621:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1049:
+	.string	"byte"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1079:
+	.string	"flashfsEraseRange"
+.LASF873:
+	.string	"ACC "
+.LASF1080:
+	.string	"startSector"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF997:
+	.string	"pageProgramStartTime"
+.LASF727:
+	.string	"sq(x) ((x)*(x))"
+.LASF594:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF894:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF861:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF619:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF723:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF759:
+	.string	"_WCHAR_T "
+.LASF877:
+	.string	"MAG "
+.LASF1097:
+	.string	"flashfsJournalAddress"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF880:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF753:
+	.string	"_GCC_PTRDIFF_T "
+.LASF857:
+	.string	"USE_NAV "
+.LASF547:
+	.string	"__stub_revoke "
+.LASF969:
+	.string	"char"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF767:
+	.string	"_WCHAR_T_H "
+.LASF999:
+	.string	"eraseAddress"
+.LASF829:
+	.string	"LED_STRIP "
+.LASF891:
+	.string	"USE_UART7 "
+.LASF928:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1037:
+	.string	"bytesRead"
+.LASF646:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF925:
+	.string	"VTX_TRAMP"
+.LASF1029:
+	.string	"testBuffer"
+.LASF895:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1044:
+	.string	"flashfsWrite"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF958:
+	.string	"short unsigned int"
+.LASF820:
+	.string	"USE_SERIALRX_CRSF "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF828:
+	.string	"BLACKBOX "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF870:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF905:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1105:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF602:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1001:
+	.string	"flashfsJournalEntry_s"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1004:
+	.string	"flashfsJournalEntry_t"
+.LASF919:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF740:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF770:
+	.string	"_GCC_WCHAR_T "
+.LASF655:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF778:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF854:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF825:
+	.string	"USE_SERIALRX_SUMH "
+.LASF955:
+	.string	"FLASHFS_SECTOR_ERASE_TIMEOUT_MS 5000"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF631:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF839:
+	.string	"TELEMETRY_IBUS "
+.LASF926:
+	.string	"USE_I2C"
+.LASF798:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1025:
+	.string	"FREE_BLOCK_TEST_SIZE_INTS"
+.LASF389:
+	.string	"SITL 1"
+.LASF1085:
+	.string	"flashfsGetDirtyDataBuffers"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1046:
+	.string	"length"
+.LASF972:
+	.string	"uint16_t"
+.LASF989:
+	.string	"busyTimeUs"
+.LASF806:
+	.string	"M25P16_PAGESIZE 256"
+.LASF749:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF652:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF960:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF876:
+	.string	"USE_FAKE_GYRO "
+.LASF1068:
+	.string	"bytesTotalThisIteration"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1047:
+	.string	"flashfsWriteReserve"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF1101:
+	.string	"delta"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF690:
+	.string	"UINT64_C(c) c ## UL"
+.LASF889:
+	.string	"USE_UART5 "
+.LASF927:
+	.string	"USE_SPI"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF904:
+	.string	"USE_SERIALRX_CRSF"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF836:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF550:
+	.string	"__stub_stty "
+.LASF888:
+	.string	"USE_UART4 "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF843:
+	.string	"USE_DASHBOARD "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF774:
+	.string	"__need_wchar_t"
+.LASF898:
+	.string	"TELEMETRY_LTM"
+.LASF946:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF578:
+	.string	"__S64_TYPE long int"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF993:
+	.string	"bufferTail"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1019:
+	.string	"m25p16_eraseCompletely"
+.LASF1054:
+	.string	"flashfsFlushSync"
+.LASF761:
+	.string	"_T_WCHAR "
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF568:
+	.string	"__S32_TYPE int"
+.LASF642:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF817:
+	.string	"USE_PPM "
+.LASF931:
+	.string	"DEFIO_NO_PORTS "
+.LASF1018:
+	.string	"m25p16_pageProgramFinish"
+.LASF1084:
+	.string	"flashfsEraseUpToTail"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF626:
+	.string	"_BITS_WCHAR_H 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1064:
+	.string	"flashfsWriteBuffers"
+.LASF862:
+	.string	"SKIP_IMU_CALC "
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF764:
+	.string	"_BSD_WCHAR_T_ "
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF692:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF729:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1082:
+	.string	"endRemainder"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF736:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF906:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF869:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1087:
+	.string	"flashfsEraseAsync"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF612:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF890:
+	.string	"USE_UART6 "
+.LASF819:
+	.string	"SERIAL_RX "
+.LASF856:
+	.string	"GPS "
+.LASF763:
+	.string	"_WCHAR_T_ "
+.LASF810:
+	.string	"I2C2_OVERCLOCK true"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1061:
+	.string	"bytesBuffered"
+.LASF605:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF583:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF871:
+	.string	"USE_FAKE_LED "
+.LASF850:
+	.string	"VTX_COMMON "
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF899:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF664:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1076:
+	.string	"geometry"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF860:
+	.string	"SIMULATOR_BUILD "
+.LASF678:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1026:
+	.string	"FREE_BLOCK_TEST_SIZE_BYTES"
+.LASF933:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF962:
+	.string	"short int"
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1058:
+	.string	"flashfsFlushAsync"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF974:
+	.string	"uint64_t"
+.LASF1062:
+	.string	"flashfsGetOffset"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF636:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF739:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF832:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1072:
+	.string	"flashfsGetGeometry"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1021:
+	.string	"flashfsIsEOF"
+.LASF573:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF842:
+	.string	"TELEMETRY_SRXL "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF756:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF611:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF590:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1057:
+	.string	"idle"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF574:
+	.string	"__SWORD_TYPE long int"
+.LASF680:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF758:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF587:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF673:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF670:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF579:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1067:
+	.string	"bytesTotalRemaining"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF772:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF795:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF814:
+	.string	"USE_CLI "
+.LASF998:
+	.string	"writeStats"
+.LASF566:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF682:
+	.string	"WINT_MAX (4294967295u)"
+.LASF679:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF838:
+	.string	"TELEMETRY_CRSF "
+.LASF787:
+	.string	"EXPAND_I(x) x"
+.LASF643:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF768:
+	.string	"___int_wchar_t_h "
+.LASF799:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1009:
+	.string	"memcpy"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1016:
+	.string	"m25p16_getGeometry"
+.LASF604:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF620:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF595:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF635:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1017:
+	.string	"micros"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF1103:
+	.string	"flashfsBufferIsEmpty"
+.LASF886:
+	.string	"USE_UART2 "
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF773:
+	.string	"_BSD_WCHAR_T_"
+.LASF650:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1066:
+	.string	"bytesTotal"
+.LASF973:
+	.string	"uint32_t"
+.LASF1094:
+	.string	"flashfsJournalWrite"
+.LASF1050:
+	.string	"flashfsSeekRel"
+.LASF584:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF645:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF596:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF930:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF637:
+	.string	"INT16_MAX (32767)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF588:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF864:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF589:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF937:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF808:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF731:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF924:
+	.string	"VTX_SMARTAUDIO"
+.LASF978:
+	.string	"pagesPerSector"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF984:
+	.string	"timeUs_t"
+.LASF976:
+	.string	"float"
+.LASF1002:
+	.string	"magic"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF661:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1043:
+	.string	"bufferSizes"
+.LASF826:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1093:
+	.string	"slot"
+.LASF698:
+	.string	"__bool_true_false_are_defined 1"
+.LASF615:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF844:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1098:
+	.string	"flashfsHasJournal"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF840:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF737:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF755:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1107:
+	.string	"flashfsClearBuffer"
+.LASF735:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF965:
+	.string	"__int32_t"
+.LASF858:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF913:
+	.string	"TELEMETRY_HOTT"
+.LASF591:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF744:
+	.string	"_STDDEF_H_ "
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF872:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF788:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF822:
+	.string	"USE_SERIALRX_SBUS "
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF882:
+	.string	"USE_FAKE_FLASH "
+.LASF943:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF948:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1038:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF988:
+	.string	"pagesWritten"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1060:
+	.string	"pageBytes"
+.LASF667:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1005:
+	.string	"journalSlot"
+.LASF675:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF614:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1053:
+	.string	"flashfsInit"
+.LASF1091:
+	.string	"flashfsJournalRead"
+.LASF691:
+	.string	"INTMAX_C(c) c ## L"
+.LASF867:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF918:
+	.string	"TELEMETRY_IBUS"
+.LASF917:
+	.string	"TELEMETRY_CRSF"
+.LASF793:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1006:
+	.string	"journalDirty"
+.LASF1045:
+	.string	"flashfsWriteCommit"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1122:
+	.string	"stdint-uintn.h"
+.LASF1151:
+	.string	"io_types.h"
+.LASF1140:
+	.string	"long-double.h"
+.LASF1148:
+	.string	"__locale_t.h"
+.LASF1152:
+	.string	"platform.h"
+.LASF1134:
+	.string	"libc-header-start.h"
+.LASF1128:
+	.string	"flash_m25p16.h"
+.LASF1146:
+	.string	"stdbool.h"
+.LASF1117:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1110:
+	.string	"src/main/io"
+.LASF1108:
+	.string	"src/main/common"
+.LASF1121:
+	.string	"stdint-intn.h"
+.LASF1131:
+	.string	"target.h"
+.LASF1125:
+	.string	"time.h"
+.LASF1116:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1119:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1141:
+	.string	"stubs.h"
+.LASF1111:
+	.string	"src/main/target/SITL"
+.LASF1138:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1139:
+	.string	"cdefs.h"
+.LASF1115:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1149:
+	.string	"strings.h"
+.LASF1136:
+	.string	"features-time64.h"
+.LASF1120:
+	.string	"types.h"
+.LASF1153:
+	.string	"common_fc_pre.h"
+.LASF1109:
+	.string	"src/main/drivers"
+.LASF1118:
+	.string	"/usr/include"
+.LASF1154:
+	.string	"common_fc_post.h"
+.LASF1135:
+	.string	"features.h"
+.LASF1143:
+	.string	"typesizes.h"
+.LASF1147:
+	.string	"locale_t.h"
+.LASF1144:
+	.string	"time64.h"
+.LASF1124:
+	.string	"flash.h"
+.LASF1112:
+	.string	"src/main/target"
+.LASF1130:
+	.string	"utils.h"
+.LASF1127:
+	.string	"flashfs.c"
+.LASF1113:
+	.string	"src/main"
+.LASF1126:
+	.string	"flashfs.h"
+.LASF1145:
+	.string	"wchar.h"
+.LASF1150:
+	.string	"maths.h"
+.LASF1129:
+	.string	"string.h"
+.LASF1114:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1133:
+	.string	"stdint.h"
+.LASF0:
+	.string	"./src/main/io/flashfs.c"
+.LASF1142:
+	.string	"stubs-64.h"
+.LASF1137:
+	.string	"wordsize.h"
+.LASF1123:
+	.string	"stddef.h"
+.LASF1132:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\307\004]\023"
+	.string	"\304\027\273\005"
+	.string	"3"
+	.string	"\222\252\207\246\005\020\002"
+	.string	"\002\001\002\002\003\002\001\352\263\360\321\b\002\003\004\217\326\220\226\t2\003\004\002\004\004\002\004\005\240\342\234\212\n\006\007\201\312\275\225\001\032\002"
+	.string	"\002"
+	.string	"\005\b\t\n\013\f\r\244\372\246\336\001\004\002\006\016\302\270\372\213\001\032\002\002\007\b\003\017\020\204\201\2421\n\004\002\004\021\227\345\271K\b\t\002\t\022\324\304\226\361\001\"\002\002\002\t\t\002\t\002\t\023\273\327\240\221\b,\024\231\307\212\303\004\002\004\025\227\223\322\276\r\026\334\230\206\330\005\026\004\002\004\027\030\346\213\230\336\004\003\002\004\002\004\031\242\312\247\352\n\004\032\315\232\205\243\004\n\033\332\266\270\277\017\b\034\340\214\255\200\n"
+	.string	"\035\362\243\316\340\002\004\036\343\201\230\333\t"
+	.string	"\037\313\322\375\213\007"
+	.string	" \304\227\367\204\005!\321\243\245\314\006\006\"\264\234\345\377\001\002\002"
+	.string	"\002\003#\233\322\373\252\n\b\n$\372\232\257\304\016%\252\234\220\272\001&\254\214\274\322\t\026'\343\220\247\235\007"
+	.string	"(\225\332\354\265\t\n\013\002\f)\237\257\302\264\t"
+	.string	"\002"
+	.string	"*\333\261\323\223\003*\r\n+\211\226\221\263\007\034\016\002\016\002\017\002\017"
+	.string	",\304\277\217\311\002\006-\313\302\255\331\b\b.\375\326\257\342\004\022\002\002\002/\260\315\312\t6\t0\202\264\361\214\t\"\r\002\020\002\002\002\021\020\002\020\002\021\002\0211\233\364\351\204\007\b2\240\342\234\212\n"
+	.ascii	"p\250\2611\031\021\3220\252V\016p\202\"Df\035\022 3!L\304\020"
+	.ascii	"\202L0c\022\234$\325\372\033\375\370\217\272\371\362\200\222"
+	.ascii	"\254\017X\236\023O\313\013/\366\375\032\275\2101Ml\353FfD\245"
+	.ascii	"\275\352\270\273\f\220[\316\214I\336x\210\013d\357\325w\357\367"
+	.ascii	"\t]L,q\033\204\350\247\304P\370\350\207rs?%\347\356\3447\001"
+	.ascii	"5\343\216\241y\273 \303\336\212\220m\230y\002\273 \351j#\023"
+	.ascii	"\275\t\206$\230\2767 \007\212M$!\r\001\275c0t@\271\1776J\245"
+	.ascii	"}\264\323\\\216\fiw\373\300\030\314p]\013\351\034[}\214\2607"
+	.ascii	"$\357f\013\021\354t\371\276\017G\345p1w\245\214\315\t\306\256"
+	.ascii	"\327\272\272\213\n\344Hp\262\232\261\370$O\017\310\312\210\004"
+	.ascii	"\300L\002\376\265\370\024\304\324\334<7vS\324g\2164NT\354\232"
+	.text
+	.section	.gnu.lto_.ipa_sra.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\375\006"
+	.string	"\202H\031\"pe2\034\374\377\377\177x\f\374\377\377\377\357i)i\001\004p\004\005"
+	.string	""
+	.string	"APD\006d\350\226;\245\352\256\300\276\027\260\n0P\245t\021\274H)\264\017\372x\336:\234}\263\376\232)\243\230y\261\314\312\244\314\211dF&\344\241\312\351h0\026\357+6\361\b\335\303\006i\r\274U\320)\302\321k:yA9 p\2021\227t\002\001"
+	.ascii	"\336\370\030\t7\364M\022&Y\312\206B\200e\336\226\2546vk\343\202"
+	.ascii	"\204\026#\346\210\0365\330q\013'\331\007\314\023\231G\256\201"
+	.ascii	"l\004\354\320\"\304\20297\022\3433f\"\\\307\240\3640)A\212 \256"
+	.ascii	"\027t\312a\b\213\035\301O\213[\305\214\333\365\333\240\221\236"
+	.ascii	"\372L\027#\354O\206O\342\325\222\236\f\246\\Y\301\335\255\331"
+	.ascii	"]Y\233C"
+	.text
+	.section	.gnu.lto_.inline.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\030\b\365\037"
+	.string	"\226i\232L\220RV:\356;\223\177\320G2wn\355\360\242\244\273\314[\210\207\244)\032{\357b\242*\244\250\322\217u\223]\377\304\214\310\\\230\352\205[\"H\006"
+	.string	"d"
+	.string	""
+	.string	"@"
+	.string	"@\004\204\354\354\026\262\242*f\273\225\301f\376\027y\262\345N\001z"
+	.string	"\217"
+	.string	"\212"
+	.string	"\277\277;\021\366C\214\323NNbh0\370\366/\016f\026\205HYx&\227I\342\377&kMCs\3160(}\177\177m:-\347\274\362\021\231\344]\277\n\273+\n\202\006\356\274\013\233km\232\264\026\361\217j\024\313\302\372\277\355;u\333\356p/\340\332\346p\374k\203\221>Y=\336\342\253\256\377\277\337\303\3169g\334O\354\254\240\021G`\377\267\0063\275\312\246\277?\370\034\033N\366\004\256\342hI\375U\253k\314"
+	.ascii	"\037pmp\t\243\036+\225\033\354c\207\355\204\357\002\214n:f\275"
+	.ascii	"!IB8\332\377\202\034-\251*}!\352\231\215\336SZ\"N\313\271\230"
+	.ascii	"\273o\210\2414=\226s\036y\357\336\273\203[[#\361\254\220\241"
+	.ascii	"cx\345\b2\341(%\367OS\245\035\021\372C:\242\206\202\274\226D"
+	.ascii	"\307\003@\323Ua@+Zbw]iIw\347\261N\232>6\315\200\224\374\030\272"
+	.ascii	"\372\203\0056\323o*\033s;\213u\367\315\257\3038\314\375\3355"
+	.ascii	"s\316\354\025\334_L\004eR\262\260\3610\362\370\376r\177\213J"
+	.ascii	"\2674.\222v\352\355\212y\362\004\310\236\346\362\215\254\207"
+	.ascii	"\002\006\303\232\276\305<\210[\252-\251sw\227\306h[R'\357-?1"
+	.ascii	"eF\316\371\344\b.\026E\024\315\035xf\024\006\324\242@B\035\331"
+	.ascii	"\037\270\361T\266\261\270\350\251l\313\235\305\200\256\221r\316"
+	.ascii	"\"_\301K\2430 ^\020\022\352\250{\201\017\377\020_E\252J\032\335"
+	.ascii	"u\321\2264/\252I\211\220qr\b\353\225I\036\337\337!~a\204\222"
+	.ascii	"\001Ora\207\020\313)\362\222\016\030\323\313\332\335HfO*\t-\017"
+	.ascii	"\360kZ\347\307\205\317L_\310\212g\350W<\007\277;\021\266\206"
+	.ascii	"Q+\007S\372\366\275\351\246\256\244\226\313cX_\311\033\b{\210"
+	.ascii	"\303\231\301\217\337\324\276v\200\375\234\263%\245\337o\301/"
+	.ascii	"\213\373o\026\013\373+\261y|\232\306\2766\025\367k\3009NV^\036"
+	.ascii	"z}7\264\211\247\200\265\2501\261b\244\b\016IRIs`\002\021\241"
+	.ascii	"\262\262\r\022\240$=\202\202\3129Ef\250\222\314\246R\230\016"
+	.ascii	"\272\023\266$\267\302\340\216\277\004+\255j\345s\341\224\334"
+	.ascii	"N\220\f\247\237\024L\356\276\250\263<\n\233\256!\372)\226\310"
+	.ascii	"\022\272S\365cS@D\221wi\227\243(C\301\016\270\273\265e\217\321"
+	.ascii	"\326\035\210WN\247\005\246\207\242\005\206\226\\\243\327\336"
+	.ascii	"\374\351\304~\331\356Mv\363f\263\273B\304\013\252.\236\005~\300"
+	.ascii	"\033\244\326:\302\210H\266\350\346\325\213w\202Y\306\324U\347"
+	.ascii	"\251\2139\331\272T\237)\f\214\315\353L\200\237\206\013\206*\345"
+	.ascii	"\327\036IH:X\327Z\004\220\224D\203\300<X\312\374d^\004\324\215"
+	.ascii	"\222\331\323\346Q\323b\2259Rrf\\\201\336\303tI\177\005U\317\242"
+	.ascii	";\235Ug\272\3347\301\322B6d\316x\022\2326\354\241z\361<1/\253"
+	.ascii	"\204D \224\177\354\270\231P\376MkL\364\277\030\f\367\376\022"
+	.ascii	"\2358~.\340.\007Ak\230\207\220\237\270\337\363\374'F\311\361"
+	.ascii	"\016]\355\rr(\230\013\222\227(\005\340\375\013}Q\261u!\337\350"
+	.ascii	"\220\210\fKV\202\334\267\374\005>\335\270\307\215~\372\037_\346"
+	.ascii	"2\033\232\355\335\365hyTL;\200\345\230K\265\177\332\325?\325"
+	.ascii	"\271\267\331%Do\367\202\317\374\033\301\035\r)\321\252\337\232"
+	.ascii	"\235\262\b\303jr\264v\2704\302$\002,_(\235iuc!\304\021g\365("
+	.ascii	"\340\257>\372\352\200%"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\376\003\275\016"
+	.string	"\026\025>7Pg\224t\260\022\231\305c'\0321\346\241233\003\236W!b\027\021\205V\004v\351\303\305\214\006\"^\025\370\241\252\252\252\252\212\260\361\bQ\343\341\377D\026iR\246/"
+	.string	"."
+	.string	"1"
+	.ascii	"\224\310\204%\022\376\200\225\n\310\004,?\320z\255\027!\013\371"
+	.ascii	"x\0041\022\304\312\257\354\346\370#UUU\\\243\271F\374N=\211\\"
+	.ascii	"c^\021\002\025\017\212\211\227\370\210\207\370\037\336\341\033"
+	.ascii	"~\206/\265LU\346D\371\t\031\260=#\312\2108\200\265\337\376I\341"
+	.ascii	"\227\374Z\\\300\376\365[\216\006\024\316-\2435 \240@\211\200"
+	.ascii	"\037\252\344\3547\033v(\361\270\236\364\036=H\317CR\302h\027"
+	.ascii	"\013\232\337\260\315\374\rQ\303\246\206\225\322\204\371-^\037"
+	.ascii	"\377\003X\342\260\274~ZI\206\250vF\007d\003\362[s\b\254$PK%6"
+	.ascii	"\365*=\252\347\331\3705\376[\254\322\273\224\255\027\240s_\250"
+	.ascii	"q5rJdHR\220B\303\030@B\302\324\225y\022@\022\022\b\345A\312\024"
+	.ascii	"Rd&6\206\275\003\330\200:'\274\245Z\206<\346\270\237\304W\307"
+	.ascii	"\365\312\201\322\223\235\220\323\315i\3467R\252\267&e7\301'\t"
+	.ascii	"\254\313!\217\276\bfQ\347\005\366{R\020a\272\033\233gi\327U\225"
+	.ascii	"w^d\\(\246#\262\322\365\2217\376\333AA\023\300<8\365\300[,\020"
+	.ascii	"n\307QN+x@\353\217\342?5xnf>r\321*a\037\246\264\377}\313\364"
+	.ascii	"\367@\177YSj\004*\321q!=\3134\030\240g\366A\211\350\334s\024"
+	.ascii	"L\251\033\332\302\300U\266E\370\205$\177\335\222\302g\214\352"
+	.ascii	"\261y6L6l\356L\337\177\364\204F\254\2724X~\322?\313w\321\b\317"
+	.ascii	"\352\3556i\276c"
+	.text
+	.section	.gnu.lto_.pureconst.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375 v%\003"
+	.string	"b\007\030!`O\322\001!\bn5\036\006\256!$\b\202 \210\364'\232\350\211?\371\344\221\354\317\013\006\374\332\00174A\367s=\26339s\263\244\231\231\211\231\227\271\256\345V\226(wr\223\334\"3\210z\334\034\263\306e\334\305U\\u\023\0231\017O\206[\270\2049x\022<\nL\300\375\336\272;Q"
+	.text
+	.section	.gnu.lto_.ipa_modref.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\345\003\235\f"
+	.string	"\222\f&,pK\222\016\260*\326s\365$"
+	.string	""
+	.string	"@\360"
+	.string	"\340\002\004\324\377\327\232:\322\377\377\377\337Z\273mkm\\\005\351vd\317\371\021\331R\246[&\013F\306\264\236*\033\032[\345\342iQA1\321\271s\271\230D\004\304\017+\204\016\r?\027\b)\377\344\257\204\267\364\321\377t\341\277\n\204\034;\341\021x`\215)f\032|\255\240\317;\356\346\234\322\273?\346w\317\373\244\004\035\030`\311\225_m1\345L#\345\021\365\007pPq\251\263)o:\243N\250\375\251\315\260\300+\217{\250\341=\253\232$[sP\002!c\316z\021"
+	.string	"\021#\036*\232)(H2\315\001\255x\025I\357\034\364\363\222\311\237\247_\3509\251y\213\221\330\222\363\373\307\345IM\272\203\0348\361\016\350s\312f?\201\220q\346C\352)\244\275\277\363%\027:V\212Z@\3222\314<\212I\206\345\035\376%\331*\212\321DM\206\204\016Z\346\206\371,\2451"
+	.string	"\3041\276\300<L\314;\237\360\255\264\254\216\255\2640\207"
+	.ascii	":6\216\035\017\003\242\020\254oK=\315\363\032| g\324\316\376"
+	.ascii	"\030\341\364\230\343\225\2221\333\363479\215\352\303W\317<hX"
+	.ascii	"\026(\371\263\345\243\346*\276\3423^\203\250\345\203\332\235"
+	.ascii	"+R\330\275<\317=\304\272*\201\236`\211\360\007G\233\b(L\245\025"
+	.ascii	"\346d\026\326\315\321\352,\356\205-\017\252\244\205\263\313\r"
+	.ascii	"\301WR8\337\311\b]\277\"kR!O\f\374"
+	.text
+	.section	.gnu.lto_.lto.3e02a91ae838c797,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashfsPageProgram.22.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\344\003\235\031"
+	.string	"6.\237E\300\030Q:D\207\271\r@U>\004\305\345f\365\337\312.\013\bF\344\203\245)\244\320f\006_\363\314\326_U\240\220\223M\245&PE!0\026\253\t-\n<4\245\353'\341\247eC\310\301\2765B6\2212\245\207"
+	.string	"}"
+	.string	"\215"
+	.string	"\276\021\016WV_*\"C\321`\240\216\340x\220\331\315)x\304\321\322z~\211\350Ed\207\201\252\202C\"\363\350\t\250G\237\b\221\275z\374\312\306I\322z\332\027\362!\263'\311\234\332\275A\245\311nn\201\021\240\036y^"
+	.string	"|\374>"
+	.string	"|\364\314\036\363\234\216\rq<\214thv\327\2459>\373\2479\363\303\bJO\335\216h\377f\\\003\034\261\370xv\367\272g\213#[f\030aw\235\267\243\030w\274{\354\357B\265\337\374\335\223\274\374\035\217.\001\203\201\217\237\276\350\207-{NU\377\310\221\234\360w\030E,\177\213\201\217\251)$"
+	.string	"z\275Q\233Z\366L@\312\246q\332|\262s\266T\234\375o\025\207\375\245w\2764\353K\353|\351\234'\375"
+	.string	"\302\364M\230^\205iU\230N\205iT\230\016\3034\030\246#\230\376bZ\277tj\372\006>\330@S&Ao\367Eo\3152E'=|\"\327\021=\027i{\370\220\277\241t\205\r\233\322\254R\303\333|\372\225\256\332\235a\252};Vt\315\356hr\271\331\r\341\345\356\322Tq\332\373\t\220\245\"\226\260\260H5\316]\020\226N\321\321\034eE\321\311\321\324\031\265\271\356\252\035\020\336\215\374.v>\266l>-\235\247\226O\316\335\231P\237\374\346\004j\250/\252a\313\236\023P\t\250\314\360p\362\372iT\033D\210\374\315<EJ\263\277\344Ld>??\340c\324\374\202\244\352+\201\035h\332\r>C@\257\021\321\f\0328x1\200 bDk\200\211\241\022)^@\240\177ZB$L\b\371"
+	.string	"\221p\305`\256\0240\037\024\256\237 !W\213\345\230\212W\220k(\026\013r\255r\265\177\25380\320`\252\251\3157\352T\346\227\201+\275Q\3452S\372\0301\253$2T\032F&\240\tLJU\252b\212j\330,\341M2\324\356>\360\273\334\013\205\n==\340cJ\005|I\242\262i\234n\001\364y\337b\001C\206\f\340\243N\223\231\334\261A\251\237\345L\0326t\350"
+	.string	">*\224\233S\201P\250Q,\311\2241\306\261\231(\2246i\fp\002\0219W\335\021`E\203h$\213\265\003-\274\032\254r\004(\315\352z\324\267\265\265\351;'\201\356\270\r\240\231\327\235\365\350V\307d\351\027D\362\t\326\205\306\373\320\261q\301\2706\030)7XQ\330.\025\0374\362\314\356\306}\027\357\205\351H\033\311\tL\211\235\037\244\257}\343\264X\001"
+	.string	"\216\030)\002\021s"
+	.ascii	"k\324\302\323\254w\013\nB\264D?\304_\331\221\277\376\022\246"
+	.ascii	"\213Y\372\335\177\342\252\245\346\354\036\327\331\234\267\326"
+	.ascii	"D\254\017\020\3620t?\340)\230\034\255\365\326O\025\370\337\272"
+	.ascii	"\210\347\027\200.\252%"
+	.text
+	.section	.gnu.lto_flashfsJournalWrite.27.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`d\005\235!"
+	.string	"F|\320G\200\334M:\r\276\332mF,\363!0\273\005\234\365|\335\003L[:\325 \021\267\375_\305\224\333\364N\355\017w\311=\306\f\"~Ilw_!\031S.\324\355y\36693\023^\207\217\021a\322\255w#\233\310\235d\265"
+	.string	"\260"
+	.string	"\301"
+	.string	"\374(\005\202D\231:\224\027Y1\264X\260w\302\234\343\252\023\371\305z\304\230\344\336\233{ef\363B\252_\237\326\r\353\353\330\340\225\300\321\250\351\313\370doRu!\325\322\275\226\227b\0325\367\022\215^\231h\317\244\2129\367\332|\242\231#"
+	.string	"\306\210\371C\376\222\007\315\013aX+\255\233qL\226\232{\265\032\274\362\002\373\372\373\235\362U\347\006\312W6\231\323\234\bvm_G\254\342\332\275W\327@n\276\222MM\276\325\353o\213\353\244\345z\223\f\274\264\330\020\260uE\356t\361q\346\303S\031[=Jm\025\356\275L\177[5\316\345\231\371\0033k`\256\301sz\364\3107c\245\2431\331{\257\"\360\317L\354\370aN\345+O'"
+	.string	"\ny\364\310"
+	.ascii	"(\337\254"
+	.string	"i\005\375o@O\330\321k+\276\331q'\026/\227\306\271\215\023\355\313\207\007\241\246\365f\315\245q\230\211=\332_\314'o\377`\266\224\213,e\"Ky\310R\026\262\224\203,e\240\237\347\037\033e\037K\271\307R\346\271Q\036`)\343l\224o6\312\326R\266Y\312\245\245\\m\224IK\271-ej\243\374\004SD\326\324$<\2717\353(\347\246\325\263!?\177\341)\363\371\306\233E\225\255\031\243\230\177\362\247p\216\315\251\023\331\3263\273\224\251<@\341\031\374\351\237\347O_\307\224\343\3161)b_n\260\250\231/P*e\377\360\3472\216\245\021uQ?\f\026\216\241\356&\352\262\230\345\264\207\272\267`\335pr\334\251V\334\362\205\370!\206\0352\277\227\235\2107\326\315\234!MC\267\020\020I3o\370o\r_\313\267$u@B*_i\367\224\351\242F1\362\214\312\f\262'\225\314\036>L\n"
+	.string	"v\357\215p\200\f\033\001F\250Q\007\255\322\246\013\017r\2072\207\020A\377\343n\253\013\371y\245u\177\371\364{\251\t\227+\n\207\371W\216e\004?\214I\224\240\377\225(_\337\037^\001Z\331\233\256\236\366\351c\315!\317VJ\236\356\351\212\306\027TPR;\247\247]\n\313\016\036@\3309\220\260t\342\310"
+	.ascii	"\025\224T\213]e\246\243(\024*\242\224X\240\320=5\351Z4)9\351"
+	.ascii	"\230\240\242tG>\374\344b\007\245\223zz\202\322\345\210\274\223"
+	.ascii	"\267\177p\005^"
+	.string	"\367^a\220\367\366\240p\341\257\206\314,R\362\341<\216Y\344\210)f\212\225\257;`l\254\340z\315D\202\344\006\327Be\320n\315\346\2775\274\217(m\337\372>\257\236\232\355\003\300.\343\020\001\3259\030[3\233J\314 \221\257\255X\250\313\266\265\221\317\253G\217\254\363\244\262v\331\367\031\351u5C\001\330u\346\240\021L\013j\240\026j\262\350#\322Sz\231\2406\002\ny'\233\303\217\021\303\301\002?\354E\371\n\324\001s\250a0\351\230b\244dD\222\242$\351\200\002\021\2612z\021PY\310\206\222\322r\244\367\317}L;\b.;\031\n\322\351v\346\334\330\b,\n\020\367\362\373\267\246\211\024\b\257\266\016\375\233J\024\234B\354\027O\264\324I\227\270\337\354\353\206\220)Z\260\364\240I\334\375\035\244\311#\331\t\2705\372YT\317\330\331\232\036\003\350\310j\216\254\201\327\324\220\336\242\363\f\3271\242"
+	.ascii	"\335\f\217\263\357f\\\003\201^(\027N\277\300\n-\347\001\204\333"
+	.ascii	"\013\335\244`\365\251\365\002\347\212\3672&\243B\313\216\266"
+	.ascii	"F\311R\006{\033\244_\3546@\242\023\220`\226\237\370\2751\331"
+	.ascii	"<T\316\367\245\352}\0344.ss\024\342\337\003\302\202\\R\246\201"
+	.ascii	"S\321\222\035\3117\220\327{/\320\210\021\351\360\305:\027D\361"
+	.ascii	"\032')\210S\235 ;\r\361\274\2114\036\243\006"
+	.text
+	.section	.gnu.lto_flashfsJournalRead.28.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`W\013\005@"
+	.ascii	"\252ox\030?@dR\007\023\234<A\304\321\354_\361\346!\tu\001\200"
+	.ascii	"\020\t\031\333mU,\350P\266\333\240\200\214+\221\272\017\3725"
+	.ascii	"\375z\372\233M/#\026,\016p\002\241\331,\362K\322m\367\336I\246"
+	.ascii	"\024y\001f\001n\001\3219z9\313U\3159 3si\273\\\017\233\210\226"
+	.ascii	"\277\365\t*zu\264\332\351\034\323\222\335NG\313\347\364X\363"
+	.ascii	"\0304\213\001\351\362g\355\205\353p\335\303\376\341o"
+	.string	"\255,\213D\266\226s\036:\333.\347G\367\320Y\266\233H\273\233\303\361h\017\215H\342\004\211{\256\351\345\f5\301\344M\3235u\025sW\2266`D\270\316\032\313\222\016u7D\274\255\351\\#`n\234,oz9g(g\273\203\353l\323Z\374Kb\334\355k\316\206\210\263\tqc\316g\213\344r\206&\373\311u\266\241\036\240u\326ud\353\254\204)\"\315\345P-J\200O5O8\221r\206*?\013\260Z\255\376\371\n\365^\352\340s9\362h,.\021\225\336\2410\350\002[v}\314\325.\f3\342\310\343\272 M_\036b\330\221\225@\234#i\036M\303F1`Rpq\n\266\345N\013^\302\"V\346\304U\003\036'J0\227\274F.\006\214\013V\242\202_\237\202\221\211\001\233\202\207w\376\200\355O\231\013\247`Q<\332\304A,bP\334u\262\"6\346\300\365\001\031\037&\304\260\347\032"
+	.string	"\320\225D^\347Nb\300\306p\213\2718\333\304\3275\003\0334[\210a\316\365\333\242u^\347\370+\254\013\277G}5\263&\267F\265\"\006\3051\220C\316\271\261W\230\2307"
+	.string	"\357\366\256\356^v\013Y\004\302\270:;\036<\303\003\243\362ei\3304O0\303u\252\020\336\343x\0233\352B2\220\240T=\250\177\360\020~\205\343\004\323l\341\203\240>\351\322v\341\201\202\2709wQ\265O\271\324^\264\253\365h\235}\360\002\266\2601q\265q\034\033\007\357Robb\2776\342v)\214\030\330\275\034\274\227\2315\337H\273\234\013\343\322L3\366\013\236\335\231Q\371 A#\355e\354\327\rm\342G\353v\252\351]Z\377Y\367\213\333\202\022n\252\027\367\324\213\233\002\021\367\204\027\267\204\027\267\324\213;\302\213[\371\342\216J\276\270!\274\270\241^\334\017\\\352\355\340\305\375\364\342f\220\300\363x;! \342>\340l\356\006\n05n"
+	.string	"\276\307\033y\3646oc\321\337x/\rq\023_\334J/\356w\210{\370\342\026\276\270\203/nW\t7\360\305\335\016q\263/\356\365\305\375/n<\304\355\030\024h!\233\222e\315\027\202f%UI\371\017;\367\305\245\356{\334\361\270\347qos\177\343m\267\267\333\271\237+\347\323\336\247H\031\032<\266\034\026\326\310\031\253I!v\274+g\3131"
+	.ascii	"\232\305Z&^\364\326\"9k\214\336\275\355\201\346\260\fly\207k"
+	.ascii	"w\325\306\264d\373[;\235\327\365\320\370%\017V\2418=\034k\360"
+	.ascii	"d\301\005BW\344\356\007\221\357\276+z\3761\357\356\364,\342\263"
+	.ascii	"e\030,~\262\300\373\236(O~\201\367GN\262\346\235\257e\254\330"
+	.ascii	"M\201\337\356\310\037\211hW\353\021%\260{\225h\235u\257\275\344"
+	.ascii	"\003\037\323Y1\t\214\272g\200\t\0334B\327\370T'f\372\343\177"
+	.ascii	"\365\352.}\025\244?\f\345\305\377\352\356\017|\242\036<\243\232"
+	.ascii	"Q\367\212G\274\346\234sp\005\036\337\325\374\330Z\2477\376\227"
+	.ascii	"\327\371\021\230\340{m\213\277\364_un\324k\303\317\201\351&x"
+	.ascii	"\177\343MLw\372\004\217\351\234d\3155S\334e\252g\f\270T\255V"
+	.ascii	"\253\236\325\266\277t\313s<\336~\200\274\261*?3\352\236\034*"
+	.ascii	"gz\332G\363\251,\32436k\315\331\312\006/d]\364\332p\265\211\322"
+	.ascii	"2\002u\250\360\255\217\326Ig\177\351\206\327\205\373\232\t\373"
+	.ascii	"!w=N\207\302"
+	.string	"\365Z\277;\205\n\354^\35479\337HC\370\377\365\335IV\364\254\026\377\277;\3058=~W\364\\\232\362J\2418\275\347\361&\246\277\323c<\247\232\343\027\337\377'9\311\232u\356I\244O\246\037\bQ\033\3347\2266azo\363&\013\317\364\036\365\004K\0045\013E\377\276Z\365\006\355\323[\370\306\317\261\325\233\256e\360O\317*r\3765\347\272\205\347\031\362\300bF\353,\203W0w\340/\314y[X:\264\326\252\033W?\343F\215\030Wl\220\345\226\325\025\226U\rWK\313jYU\325AG\214\035\313\036X8\210[4\254t\254[6j\334X\262-Ea\312J\312\202\214\252(d\220\345\326\016+\266gDi\321\260\241\025C\007\r%\326\r\345\216\0331\256\2243\226Z\312\250\001\215\305\303j\251\334\302\302Z*\207\335\335P\246\377\331\023\243hT\311\235\253\365:'QH\032\225\262\355\\-"
+	.string	""
+	.ascii	"\337\034\230\337TCRa$\036\365\005w\252\315Bp{SO\365\376\374c"
+	.ascii	"\036r\n?\005\327-\360\323\020\327\030\013\np\023\340\344L\232"
+	.ascii	"\016\221\320\255\035\037\255\223/\303\255O\027\356\253\202\241"
+	.ascii	"\356\331\335\2051>Z#\237\370\230\220\033\336\220\344\023\037"
+	.ascii	"H\347\007\371\361y+>ZK\245\021\021\374\037\022\026x\344\177A"
+	.ascii	"9\362?\370\351\302}\354\030+\310\367=\316\367v\306n\t\001\362"
+	.ascii	"\021\300Qb\207\353\306\364U!Jx\245\307\213\334\357|\030i\322"
+	.ascii	"\037\252\236\324Kx\037\364\214\022\341\225/\365-\2345\270\031"
+	.ascii	"\341+\3445h\243^\371\217\367t\322l.68WCp\265\351\034\255\263"
+	.ascii	"Q\277`\013\033\323\217\013\343\032\365\361\340\031\336\037*\237"
+	.ascii	"\201w\274\356\016>I\351\247\362\374i\021_\227\322\243\365:G'"
+	.ascii	"I\233g\265\357\373\350\376\340}Yn\316\231\252\235\032\002\204"
+	.ascii	"\232\220\326\331\367\331;\220\322\364#3\267\262\027\222\017\213"
+	.ascii	"\006^8\f~\200\350\250a \005\225SJ\tQ\020IA\222\244\003`\002\221"
+	.ascii	"1\263z\021\260\271C6\233Ja\030\003B)\313\362 c.\254\304\332P"
+	.ascii	"\305\347a\265\222U\032\"\t&k\005\001\331\013aH\236\304\303{\302"
+	.ascii	"\225\016\216\204H\031/\035\376\212\013\353K\3731\267\007\215"
+	.ascii	"h\312\365\rT\004\257\266\315\363\205\267c\227\264\0225\346\001"
+	.ascii	"\353`\235\250\237~\272+vg\200\315F\36204p\037\377\262\310\255"
+	.ascii	"\242\323v\f8\024\323\b\261g\251\001\016\376Q\213\b;\214&\216"
+	.ascii	"$\200NC\211\252j\n\203\327\363\244\377B\374p\n\006\"\005d\342"
+	.ascii	"8\030\204%\206\274\237F\rVn\355\037\211b\246\241\004N\252\306"
+	.ascii	"w@\353\232\004^\033n\031\361\251\333\304\375\326R\301O\355\033"
+	.ascii	"\231m\375Rj\\\254c\030\257D\252X*\212\306\034I8PV\245N\312\027"
+	.ascii	"\354\035^\2454cq\227QKR\220~\2316)\354r;R\303T\f\t\236dR\305"
+	.ascii	"\324K#S\321\217\232\n\217pZ6\317\020=0n\331\373\241w\234\025"
+	.ascii	"\214\206\237\213<)w\213\215\260Hn=\275\244\352\366\247\034o\211"
+	.ascii	"H,\3542\023ta\254\331\245\215\364\207#\307\037\236\f5\016\373"
+	.ascii	"/C\027d^e\304$\243\253\250\006s\\\326#\002Z\353e\263\220J\255"
+	.ascii	"\366\217\"\353We\200\213\370\302_\364a\377$\272\302\241:\345"
+	.ascii	"dt\272\372\200\321\n\2670\274\247\001=\244j5w\036\205p\340\363"
+	.ascii	"\311)\237\265\314\200bnf\\\234\303\026\022\335\322#\371\t\\\212"
+	.ascii	"a<f\364\0167"
+	.ascii	"\261\273\214\372g\342\343\035T\307\224\325\265\227B\257\355\236"
+	.ascii	"\363\305?Bh\020)z\002\252\300\202\353\254e\315@\305V\210\263"
+	.ascii	"3\001\013\357\035\022\341\302\321t\272Z/\374\373\260;\374\001"
+	.text
+	.section	.gnu.lto_flashfsEraseCompletely.30.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\265\003\375\031"
+	.string	"F-\243I\240\330Qc"
+	.string	"FM\017\361\202|\363o\b\314\230\230\305\362\207\315\212\236\"%f\017\030\201\203?i\275\251W\223\371!\317@e{\262P\363f<\017\205i\255\264\006\257\26156\277\301z\033\222\344\363\303H\272\355\336[\312\224\002\207"
+	.string	"\205"
+	.string	"\221"
+	.string	"\244\355\336\215\272c\3220\n\301I\230-g\255w\362\231\3364t\2247\2427\370\036HS\226\272\356E\025\234t\215y\222\3463\345\311\3611\345I?\310\220=;Yg\356\331W\216\346\270\227\362\201\002\252\353\336{Z\034\357\235\034m\355\371\007\362\372BJ\211\223\026\256`\001\006\213>\306\206h\371a\245\301\242\333\321\200\223\252#"
+	.string	"A\242\221"
+	.ascii	"\222\016\254\017_S\004\177\265\302\036\334{]\201\301\026wy\333"
+	.ascii	"\030l\353\330c\r\345\235N\343\253\\\f\343u\025\253vND=\3204?"
+	.ascii	"[\3023FJ\305\255[\271\330\350\257Z\033\366\307{\357\265\255a"
+	.ascii	"\227\325/e5\255\254\236\225\325\262\262:FV\233Oo\030\314\001"
+	.ascii	"\245\0312\204?,\026zW|u\271N\310#;\236\376\366}\251\247\376\320"
+	.ascii	"3\367\202\276\344\0047h\314X\222\n\362\243\002\3048\355G\371"
+	.ascii	"P\037\022t\"B\343\205\201\336\026$\254t\031\307<i\324\374\323"
+	.ascii	"\320\227|!\025\254f\017Md\366\024R8\223\235\230- d\242\021\253"
+	.ascii	"\256\256"
+	.string	"\304+I\017\373\236\322\264\033\236\254\210\252\227\237\232\347Kz\314{\211\032\370JB\\\360\223\204\254L\026\023\221\nf\237V?\315\240\241\036\b\263G\242\361\341e\304&3\2138U\314\022\303\342\312\351\007r\036\243\251\242\226\017\311\223\324*\224_S\372GNe\273\341p\345Ik\005\270U\323\242\"\367\215|\212\347'\371\007\250\036\bT\236\224\311\222\341\253_\376\323eD\276.\344&W\323T1\313y\001B\272\021\267\017\271\033\316\364\315\002\006\267\033\007\033|lbv\273\233\316\307\247\006\263\315f\307\241\303\256\346\201\303\231\3739A\374\324>\2346\335\356\264\031\340\\\210\233\356\034\221\313\351\316\031\352\273\255\341\363`b5\322\354\207\337QA\005\205\021;\263/6\005y\204\026\265|\366g\037\247\364\251\274\n\016\204\234z`Nyr&\007\227\221\r\313\026\001'3\205\253(\212\216-\002\334\242r\361b\241\360$"
+	.ascii	"U\245\344\321\355\322\362\221OhV\200\220Xo\230\020J\2152\033"
+	.ascii	"\2633;F9\241\364\233\360Q\250Q8\252\230afF&\2320J\223\264\001"
+	.ascii	"p\002\22193\017\021\2609e\264 \225\326\f\266\023\225'gN\243\232"
+	.ascii	"^!\205+\212\342\244R>\270\347S$\327\214sg\232B\2119S-c\315\027"
+	.ascii	"zf\234\336\3529@\363\314\207\377X\f\202f6F{1\265\035fT\204\302"
+	.ascii	"w\317a\021\271\302B\344r1{\265P\257\274\212FP\261\335\303\310"
+	.ascii	"~J:\221S \260\017\364\2631\226\247\351\331K_\312\334(\207,n\361"
+	.ascii	"\367\001\225\334\313\211\375\326\f\027\n\206L\007Zz\270\2505"
+	.ascii	"e\"\177w\037g\037\213\177\0201J\257?\377|\230O\221\322\325"
+	.text
+	.section	.gnu.lto_flashfsEraseAsync.31.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\262\002e\025"
+	.string	"&\345\207I\240TRcl\324\332m{o\325<^XN\312\233%\210\301Ug\366;xH\013\005\037\257K\330V1r\265*\242\370\316\366u\247_u\tzO\274\016/'\256\264K\277\262\274\025\275\245q\316]P\351b\353\226[\312\224\002l"
+	.string	"o"
+	.string	"t"
+	.string	"G\2720\347\247n</\360E>YFa\367\236\013n\235\"\273E\371\ty;\236F\336\372G9vyKK\357l\255\237B\367MU(\206a\367^\263\276\370\356v\254t\347\317\200:\267<\037k\213\255% N@\236\327\321\334y\"\022"
+	.string	"\364\215%[1n<x\252\002\330\243\224\204\345\336k\372\003\262\270\311\333\206\261-\301\256&\0010\220xt\314"
+	.ascii	"\250\317t#A\377\233U\b?\275\252\3433}\366\324#\343\242:\213_"
+	.ascii	"\017~F\234\201u\251\230}\366h\r\262?\336\nd\223\324\245\245\236"
+	.ascii	"\215\324/\271\317NX\327K\217{W\214\031\271WV\212\310\037\236"
+	.ascii	"\t\347F\256@Z\037\342\330\345\227rn\344+]\030Rt\357-om\357n\215"
+	.ascii	";\016AE)\270%@\304\244\364I\016O!}\251\0231d\220\221!o\253\220"
+	.ascii	"\237\027u\342\201\272o\343Q:\177\310\032f\350\1773\344m\201 "
+	.ascii	".\276\364\031\215\261+]\006&\214*~]G>\351(<*fJ\314A\213\276\252"
+	.ascii	"\342HC\032@\355\232\032\375\317(\001\210G?!\026\224\242\336F"
+	.ascii	"\226\365\301\233(\311\320\371\372a\345\243E|&s\270\223Mv\257"
+	.ascii	"\317\201\337\344\341\203?"
+	.string	"d\202\274-k\202^a\320\240\266\362`\203\215\n-\227\253\341llhH\\\243\222\273\351\220\243\001qc\336l\246\b\033M\b\263\006\2273U\f\3706\242\2063K\334n8\263<yg\341\325\236\255A;!\351_\335\307N\030\241\245\205\354\302\272\325\267:\217\t\024\\\\\310[z\344\347u\200\332/\025j\356\207\022wTY@\220\005F\244\322\241\203\2319\021\002\243Ma%\375\301\307\364\374\024\271x8>\025C\207\016A\250Q \215\022\343\024\311L\232 E\321\001\200\002\221Iu\033\020pX\324\214\0016s\321W\346E\016\214J\200\006i\2074\037V\324\001\020\210$\271\340\203e]`\220 \303\207;\200q\"\317?m\275\332\363'\231\222\023c\003U\214\272P\333\262\321}oR\244\t\032\275\3410\321\034f\023\200\234p\266\bh_\205o\206\322\232\\\017\305\307\370u\262\364\303\206 \211KU\034Y"
+	.ascii	"z\020\037g\035\317\235\370Let\220\242u\252"
+	.text
+	.section	.gnu.lto_flashfsErasePoolIsReady.32.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`Y\003E\031"
+	.string	"\026\256\243H\260\230M:\020 \020y=\035\024\020\t\216\2058\213L\325\302\335\0359\230Z\347\177z0n\323J,U\027\265\023\251\2016\327~\300h\317Q\202I\377A\237C}+=\205\203\337\205\261\\\336\214*\230\"B\b\331R\246\024\221"
+	.string	"\202"
+	.string	"\224"
+	.ascii	"enW\2760\241Ekj\301A'\030\017zw\001\341\301\361\261\360\340m"
+	.ascii	"#\373\345\007\021\214|\364]\216%qE\227\215J\253,w\344\342\370"
+	.ascii	"\321G1\004\347\352\221/R\220:\002&*\244\217\247\345.\376\212"
+	.ascii	"\213\334\314)\313\362\205\263i8\005,\355\270\301pJSA\026\023"
+	.ascii	"0\227\262)\230a\013\227\033\216\351S\246\310\227\032\026\022"
+	.ascii	"\034\323w\352X\261"
+	.string	"\212\001\303%M\0035t`\275we\201\253\251\212\024\312\262\264\336p/n\231\333\206a\273\202\275%\002\260}\r\033\265E\362{\007\340\0332\376|U[^\024\n\214+\245\206\261w5]'\373\263\334&{\252q\246:6\3257Sm3\3255\242\232\346\274\033f\365L\250\036\247Z\234\352p\252\301\251\236S\275\240Z\247\372\003@\252(O*\026kW.u\211)\255\200Mx\234\367\333\367\211\234\347\367\374\262\221\216\026\255) E\2372\203&\0323\016\372D\212^\007id4\260\277\363\203\\H\321\207\240\230\001YU\341:\371QWTfl\337\273\205\026YlK\366fq\226\005\316~\013@=\365\252\370Ug\242\301\207\362\006\016\372\033\207=\360\313Y\3522]\242\\le\321@%\261\035\240\363\351\215\024\272#\323fk\366f'\026\245\036\265\016Ob\263\244\216\347H|j\366\200.\200\317\352R\270\240"
+	.string	"\331u\372\201B\232\355\351QIR.\237g\331\215"
+	.string	"\215e\231$\301/\322\023\344C\241\b\017\322,\316O\bM\273\254>'\260=\35794\rc"
+	.string	"\352\363\204f\372[v"
+	.ascii	"!\202\314\301\204\036\017;\261\242\241\0212\241\231\fh\264\317"
+	.ascii	"\016\321\317\007\"\036\020?\344,\210\f\021\304#D\372\f\021\221"
+	.ascii	";\004<\023!\033\"G\314fC\344kG\373,\267\311\032.\270\212\f>\316"
+	.ascii	"l\016mk\036wfo\033C\323\256p\\\247}\342\031\221\"\212\033\356"
+	.ascii	"O\357*I\271\246X\020WG\007\356\225h\324\264+\312\005p\311_n^"
+	.ascii	"C\270;7\274R\362Qs\207[\371<9\201a\204\"\021\036\334}\222\237"
+	.ascii	"u/\365\327\217(\033[Y\265E\322\034\\\001B\250Q0\001\203N\221"
+	.ascii	"B2\"\301\210bQ\007p\002\03113\017\020xI\013+\313\001\277\373"
+	.ascii	"fJMC\350\314'$\030/\263\264\336\253+\002\212Y\347\337\263\007"
+	.ascii	"e\262\275\026\265\276l>Sy\221\342`\033?\267c\001\030\242[\207"
+	.ascii	"\340\310%r\302\016\364/\215$Gfc\016\244c\230\274e\202\205\266"
+	.ascii	"`l\001P \221\235B-P\247\r)\200\317\267\026\302\017\306\264\026"
+	.ascii	")wL9v\325\317k\351w{\346\346\n\227:E\035XS\036i\251\021I]\024"
+	.ascii	"\334F\221\020j"
+	.text
+	.section	.gnu.lto_flashfsEraseContinue.33.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\322\n\0255"
+	.string	"\252X\214\023BP\346Q\007\025\256\001\376+\004\355\241y\323\371\202\023\200\375\357\252\202v\\-\r99\206x\376AGW\005\233Ny \021\021\021\021\021\345t\3134\311\270\317>\262\020\3534\310.\315H\232\334{\247\224R,\001\n\001+\001H=d\311\274`^\343f\233 EP\247q\2531\220\2230\372\013K\220b\027v\326+w\024\006\260\327\242\"S\314-\206\033LCat\030\031j\013\006m{\304\350cwf\327\266P\251^\331\n\332Hl\257\275\036\262\275\252@f\243/S\356\314\016 $\373l\306\200\0264w\326\246m\241T\f\325\353\225\223\314~\032:\326\336\262\"_jvm\333\032\377I'{\b\340\310\250HH\024\004\376|\275\313\256\352{\222\373\367\254\321C"
+	.string	"efN(~t\255\226\364(k\243\242\261\026\"Q\013s\242\251\223L%\266m\333hG<\b\324\321\0078\324\261\007\320\222\036F\372\327Sg\0216\"\356S\237\276\016M\351\251s\210Z\300\256\306[\257\247N\260\253\"\361\230\322l3'\230\0325\3476H\370\374rV\215\n\203\363C\370\364R\221\3520\341\323h\335d\346,\363\025\204\237?\315'\220V}c\352\226y\310<\201\364\253Nt\244C\204O\246j"
+	.ascii	"\t\224<\r\327\216\343\271t\277Vm\333\2627\237=\232\0034s\217"
+	.ascii	"`\346\023\314\277\016\037@\356\213\322\363\330\343\324L\207\337"
+	.ascii	"\322&*\275\020\007\235[\312\225\302\2739\374F\222d\3715\270\341"
+	.ascii	"\372\027\007f\272\246{rqmw\201\032\255=\\i\273\243k\275\0203"
+	.ascii	"t\351/\306\334\237\227\227\227\307\337\204\371:W]\347\006\327"
+	.ascii	"\331x\235\213\327\231\312\347<\325i\315R\3279\352:3\270\316\013"
+	.ascii	"\2563\324uV\340s~\352\265f'wNp\235\021\\\347\246\353L\274\316"
+	.ascii	"L\327y\351:\037\3609+]\347\244\2266\017\373\254\373\350:\013"
+	.ascii	"\2573Q\3179x\235\201\327\371w\235}\327\271w\235o\317\231\275"
+	.ascii	"\316\353uV\257\363_g\277\316\r\241\310%\314H\231\221\317\003"
+	.ascii	"my\344\031j\351\254oT:\255{\255[\332\317\334Rn\270\013\004\215"
+	.ascii	"\035\231V\363\242\277p\247\3517\002R\260\270\265Eqk+`\"\331g"
+	.ascii	"\220D&\264}Rp\323f\310d\212\365F\303]\246\315\274\3503H\025\332"
+	.ascii	">\207Q4/-v\2752\206^\257\304\016aK\317\253\273\217\304W\035\210"
+	.ascii	"\004]W\022L/\312\221\3555\351\247\344\230\375\253$I\203\230|"
+	.ascii	"}\346\n\026\274\233Ld~\r?\353\373\002M\205\354PB\346\273\300"
+	.ascii	"&\370\254(\034n4=<Y\332\356\346\020|\202\277u_\207\376\325G\360"
+	.ascii	"\004\316\250\351u\316\222\267n!c\360r\364\t\364\337n\3527\032"
+	.ascii	"\003\316\234A\203wS}\"\267\\\357\331\300\241C\007\266\327\377"
+	.ascii	"\240\234\303\305M\231vc\364\364^\214\375\373iD\345\344\361\340"
+	.ascii	"\317$\007\246\364\274\236bQv\271/\3063\330\243\317\212\356a:"
+	.ascii	"^\026\347\035\235[]\235$\354\213q[\211#G%~\303u\007\035{\276"
+	.ascii	"\322<\3237=\216\246\357\317\212\316\341\266\323w\220\334Q\370"
+	.ascii	"C\b\357f\b\266\327~\001d`\334\322n\264\366\341\271\322v7\247"
+	.ascii	"\\\353\020?\211,\316\235\330 cS\227\376\3003\275\212\307\253"
+	.ascii	"\312\362\252\347,\275\221LD\307!q\340\225\310\202q\322i\273\301"
+	.ascii	"\203\333\362\255\305*}VT\016\323\361\270\245\214\325o\264zm\313"
+	.ascii	"\214\300\355\006\304\026w\024\031l\257J\001Y\315(\212H\025\\"
+	.ascii	".^\030Y\034W\2548j\025\300j\031].\266V\034\267N\364\270\352\001"
+	.ascii	"\204\255*\tY%\212\303-\025%\270T\326*\"M\240@b\2510a<r\031Yp"
+	.ascii	"a\2550ju!\215\305\001|l\261\325etq<v\031\201Pe\177\023\266R\376"
+	.ascii	"Rm_\354\331C\206<\331a\203\002\340\305X\370\300\247\021\235\243"
+	.ascii	"6\222%z\341_5/\263\245\0071A\364\235\206,\370]\367{\337\003\277"
+	.ascii	"} \273\204\370\375\222\034\030\240.I\356\350\332\243\242\006"
+	.ascii	"\337jB\343Wu\317`\331y\270sF\322K\022\315\273\231Dc{"
+	.string	"\0250&\210\215\217\252\327\341uM\272\264:[\350\334\315)\215p4\2202s\276\025\025\237\352\215W~c\254(\302\277HP\021\201\264J\341T\032c\271\215\261)\251\357\2644)\265\350\026:\\f\315\271\206\b\310\340\233\355\267\340\243\242\336\347J\337\332\226\240\bo\0310\334\035%b@\250W\360\013\256\372\020\324\033E\264!\022\n\030\n\245e\376\342\372i\215\261\032/\251e\213\237\234\276\327\326\234\330\3068\\\241\336\023\352&]\322\337\357}{\005\200\341\250\2214\305 CC\"\"\222\224$Ic\240\002\021\241\"\253\003\022\200\264M\351(t\227\264Ph\377\r\2003\323\246\363\322#\332\3048\177E\374\250\024?%\350#\256\304\364C\230\344W\031\333\247\225\016\343u-\337\017 6b\036<\375\237'\307\224%\2005\f\020\033 \216\334M!Gj\332\221\210N\002J\3026@$\376\244\023MF\037\222\300\331"
+	.string	"\340\351\346\310\350\366\314\216!}\222\023k\004\0327>*\247\34212\260\005\\\224\373I2=\374\214\200\242\202Z@C\234\030\330\367R4\272\273\223\225\005\246\273\f\220P?\3202\002\020\321@\364,\2644]\031c$,m\260\300\310P\233\360&)\036"
+	.string	"*-\256\212\244\247\307"
+	.string	"\230\350Sv\b\244F\321\232%\246\206]\360p\207I)b\347\311\322F\272A:\253\220\326\276\312\375P\007\031\327\364'\267\324>\206\332\233;\013<\020\232C\241\177U\332\007\370~f\005o\375\237*\337\372\345\356\356\376\365\362Hu\004\250}\2430\3567\212\r\235\004+\206\324mfBsr]\367\360\265\013\203(\2579\303\314\223<\356\307\270V\271y\002\023\304|\013k\r\004\227\223\322\261\307]\210W\250\0328J\274$\350\3527\353\241\226\002\303\025\355\232\217\227\246\004B)Q\007\b\351\240\225\201\006&\312\032z\336\017\365\337\265\t'\376|\360\210\235\234\225\331\303\327-\242slO\325}\276\350i\371~\322(&\276\310\216}\344\371n"
+	.ascii	"\327\250\270\235\251\201\247v \264f?a\214R\344\356\0366\rTK\301"
+	.ascii	"q=*ai\0031\252\017-\244h)\324"
+	.text
+	.section	.gnu.lto_flashfsEraseUpToTail.34.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\336\b5+"
+	.string	"\252G\364\017Gp\032R:k\031P\211M\005#\315\037\254\362\206:\377\255\216-\311-\240\2449HP\342\033\365\373\035)-\\\004\373\326\220\306 \205s!s\234\353\322\262\207\232\367\374\f\3102\224l\313p{ \277\375\337\b\331r'\031\355"
+	.string	"\321"
+	.string	"\355"
+	.string	"|%?\371(0.E\306]\215\312\365\253E\334\234\331\334\272*\227\236r\022\357)+\377\243>\345]\250>\355\037_1\257\2712\311\272\023[\333j\316\255\353:l$,\344\333W\367\021\006\003\364\360"
+	.string	""
+	.string	"\376|=\336NMo\333+\276\025\363V\364\302\272\317\335\315\310Avh\327\330\225P\027\345r\244\022+4:\362%\366`[T\354\001z\216\347\001c\016\261"
+	.ascii	"\256RtK\234C\273\216\367'\007Y\361H!\026\370\023r\245iS\344+"
+	.ascii	"\310}\207v\0019\273Q\223\256\037\266\227ey?\256\2706;\343\232"
+	.ascii	"43\272\"_\306\253\367\310\355\213\017\036\257\255+\004\246\344"
+	.ascii	"\355h4lz{YE\355\320.\037wB\362\311\361\310\333\033^3\354e\262"
+	.ascii	"\343}\344\257\02369E\257\035\267\273\246u]\331\026\275\276\316"
+	.ascii	"?g\276\ff\246\300\314\013\006.\324\247\301f\202\213B\264w\030"
+	.ascii	"h\231I\224\260/\276\255\210d5\026\017H\353Y\265\231\251T\330"
+	.ascii	"\027\271H\253\261\030\250&\245\321\204\030\001\323l\325\222\320"
+	.ascii	"\325\316aVf\331\016c~\004\350S\t\267\021\346ky\351ZV\272\226"
+	.ascii	"\027\\\313\nT\313I_\236\221\256\345\004\327\362\321\265\214\340"
+	.ascii	"Z>p-\033\251\226\213\336<\023]\313\006\256\345\002\327\362\320"
+	.ascii	"\265,t-\023P-\007\335y\006\272\226\203\251e\337\265\334\273\226"
+	.ascii	"y\327\362\356ZV\257\345\364Z\276\327r_\313\266-\177\230\3321"
+	.ascii	"\212\261\365\233r\315q\207\316\352\226rY\362\345\337\374\235"
+	.ascii	"o\346;\371h/\310\346\232\374\263\f_\362\231\374\343+\0307\343"
+	.ascii	"\026\262dl\210\331S\376\024\030\277\247=@\032pP\352\370\326^"
+	.ascii	"\324\344\247\277A5\025\021\365\233M\2423*\310?%\313\350\344\304"
+	.ascii	"z\035\306g\302\326\266+\320G\273\023W\232--\352P\033\350\033"
+	.ascii	"\006Z]+\243\366\204\243\221\350\374\221\377\301!\335\350\242"
+	.ascii	"D\036\264@\0138>\241\226\007\233\"hvBM\240\207\372\232\241Q\226"
+	.ascii	"\025u7\241\036:\275M\212@\017\035\237_\240\307B\007\214\214\332"
+	.ascii	"a\374C\251A\375\201\331v'?\375\t\025\006\303\006\226\241>\rj"
+	.ascii	"\037\270(\366\331\005\250\357|\021\321\316\271\023\250\017v\264"
+	.ascii	"\373\236R^\345<\270g\032\235\0332j\226V\322\016K\373\266\205"
+	.ascii	"2\305h\331:VK\273\367\205\303\355\241\243\221A\217\344]\327u"
+	.ascii	"\275\335]^\224\013\266\355\356\323\030\222\365\264oa\301\037"
+	.ascii	"\343\016\036\354\213\036\324\247\266\007\034\215\314Q\317\"\305"
+	.ascii	"[W\255\b|,1\246xc\001\354\340\001\204)\007\022>\200`\022\272"
+	.ascii	"\250Z1u\202jJ\004\217\245\230\254B\214\260\2122\021bHEb\210\202"
+	.ascii	"D\324\211\241T\225\325\220\t\210\251RLU\rWPQU\r\177J\342\333"
+	.ascii	"\b\024\235\033\261\2638\310\236\316\255\232\034\237\016\343^"
+	.ascii	"\363\232\302\232\226\255\263X\035zw*\360\272g<\352\301\006m\003"
+	.ascii	"g\314Q8d\231-\\\210\006\331\244\032g\2412g\320`&\031\245\223"
+	.ascii	"C\352\230a'\310\344Q\352#\317;sE\315\226\026\340\256\317\374"
+	.ascii	"\005\256\270--=K\355\353\033l\276\256\373Y\036\007\234;\026`"
+	.ascii	"n\311W\346\005N\317\202V\320JQ\217\263\300\351o\244\024\354\300"
+	.ascii	"\260I\343IZ\362\323\345\256\232$!\365\227K$\346\271\200 \311"
+	.ascii	"\004mPi\002\370\035\365\317|\b:A\202\33650\rS\f\233]#5}\311d"
+	.ascii	"\031]\224\b\214;\"\202B\204\354"
+	.string	"w\240\215\032A\324\3254\035p:\\\223\321\200$\001\200\271\250\201<\004\035C\"$\"AAR\230\2441\320\002\221!\232m\022 \244Qh\255S\246 \306\332\177\003?\361\213n\023\352c\306\250\340G\025\030 \341B5w\224\273\355mT\202\025lI\025\303\264~,\341]I\001\326\204\256`\310{\323\3101OL\244o\227R\031\326\370G\236s$\313\031\212\303FF\202\344\213\223\254G\352,\016\033\334\217\027\215`\3317\346\020\216\314\204\336n\3039\"\335t[\3148r\b\374\334I\002T\335;/\262\220\212\3745L\257w\017\344O\246\357l\017wewQ\2010\"o\302\033(\313(\370\376\365\225\246\237\363\313\332Gn\r\364}1!\006w\337\237\225f7\327\217d\275\263\313\221\343%\307\326\250&;\210\325\203\220\346\016\337\362\302oX!\214`\344:\210\002B\202\370%\240PAa\023_f\017\224\027"
+	.ascii	"\020p\275\245S&\320\317.#$\037N\232\242\206\355?J\020Fb9\326"
+	.ascii	"\bL\3403\007\035\004U\220:\227\206\335\2262\335HS's\370VWDu\303"
+	.ascii	"9\345\336r{\321\200\b`M\212\3259\257\371\006\247Q\301#\324\311"
+	.ascii	"9\253\344\3349\240\177-\005fH\265\326T`t\256fm\337hXC\254\017"
+	.ascii	"\325\363\213\247:\005\264\271\021]\f\357U\225\003\2301\3152\025"
+	.text
+	.section	.gnu.lto_flashfsEraseRange.35.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`^\004\225\034"
+	.string	"\2064\266J\240\230Q:`\314x:\352a@\032#\263\020\332\217Ru\343*\0370vr\201\013\275\351\034\363\262N\366\263\377\373\257pR\326\0355\005Q\205\226^\007\035^\007\213\213\341\\@\213\234\024\240I\323\327\177\335\275)\371\204\020\271S\n\241"
+	.string	"\231"
+	.string	"\242"
+	.string	"\244'\230'\355\226\023\020*\202y\2625\2049\265\377\343@n'\022\341U\255BC\212\324\n\2041\002\363\344\313\005\224'\307\303\312\223\276\331S\016\214Q/\354\215\bB\245\326*[\030n\025\213\305\342G\340\255\242\267\233\252\222\034\227\336|\334\315Q\305\343s\343O?@\243\214T\024\323\227N{|<\252\322\241\342\345\227\236"
+	.string	"\312\223\236O\305\311\024\037\307\002<\343\001'\027QX\276\035\3351\301o\t\212\026\237n\024\340\344\"\312\225n`\307\017\020\245\252\231Z\253i\317g\342^\335\366\f\3335{|\020\006\342\350\016\331\367p\306\220\206\367\205\355\022{\321\r{\035\370\007x\360v\235\350o=\351n\271\360\3506\227Z\265\324\345R\223K=.\365.5]\352\017(\320\344t\303\244V\237\242\225\332\204d\302q\341_\364\037\375\301?\351\256 \030\237\210\277d\226\353'D\022\326\350`\236\374\215\036\344HW2\253%E\310\207\334\236\024\342\225\367\263\362)A\"\252V\340\r\320lU\t\256\270\300s\344\341\313\316Uw6\202rP0O\272|0v\221\207&\356\307\f\332\370E\325Z\025<N\2164\355k\315\355\261\017\241En\351#\017\241J\247"
+	.string	"\020\223\230;\223#c\013\376\332\330\322!\357\307B<b \350\305p\334!+8lk\214\232(\321\bl_4.l\334u\302c\002\362\332\037\355\276\002\354\356\ny=t>\\\373 ]\327^8\342\312\267\265tW\n\257\207\216\207L\f\251\250\245\225\337\032#\250\035\225\262\235s&\232Y\353\356\201o\244\246\203Y\343\244\037\242<\371\215A\021\345h\321\224\030\324\262O\372K\216N\271\244\266\207\017\364\275\226=\213\026\272\305\371J\267"
+	.ascii	"\364T\351\224\0038\007Q\263\2359\2643\203\311\252\321l6g\205"
+	.ascii	"\231\316\271\252\235\263\223\302L\347d\231\351\234k\006\r\034"
+	.ascii	"\234\fdjf10[\215\306\266C\332&f\007\303\315\016\315\006\f2\032"
+	.ascii	"\216L\007\207&GfS\333\221\305\0200\215\303Y\223\331h\264\232"
+	.ascii	"\214\005\254\237\311\255\316\334!\263\244J\227](\244kW\333\263"
+	.ascii	"Zs%4\355\250\024yBh\265\027~\254\265V\225\313^\270Z\227=\357"
+	.ascii	"'#&yb\241\252\265q4\320\367\374\262[\234\313%W\265\347\355Xm"
+	.ascii	"9$w\201\214\223 *\331EB\302\343+w\310\2271\374\215\261\275\322"
+	.ascii	"\315X\250A8\344\2441\306\214\214\004\023\214\214\270\330\220"
+	.ascii	"\002\231\261\262\016\021\240\2654fj\330\r7\200\023\312\033\207"
+	.ascii	"D|)\362\342#6\347\372Z\322\314\354D\374S\326\274\210\244KU\221"
+	.ascii	"\222\200\022\275+^\354\t4\023n\247\035\273\327o\377\355qP{h\265"
+	.ascii	"\340\013m\\\003X\334(\022\362%F*\021\207\254\206\224xOt\260\343"
+	.ascii	"\362\301\322\332\334\tw\234\207\365jbm\006\220Y\351\031\201'"
+	.ascii	"\335>k+\217^f\020\322YD\345\202\224tr\245l\275\320?+\307\224"
+	.ascii	"\201\003\316YE\340Bz\006\352\036\025v\016\27104`\203\177\360"
+	.ascii	"=\n\214}V\217\016\271\007\273\245P5"
+	.text
+	.section	.gnu.lto_flashfsIsReady.36.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\257\003\r\033"
+	.string	"&\261\257I\240\330M: g\257\313\315\034\320D\373\212\2331`\335\303\t\362ii;9\245%\345&\306\247\031\274\373\211\326\314\300\241\374\177\346F\364C\300srO\223s\254\017\0232%\026\276\310\016\330\220\367\366\030j\215\020B\210\334)\005\236"
+	.string	"\215"
+	.string	"\234"
+	.ascii	"\327*\262\317\217\3256\362\261|\336\260 \374\212\005\316.E\231"
+	.ascii	"*t\t^5\370\350\005\346G?\3201\362\321\323\035L\367\241\345\202"
+	.ascii	"\213\f\212\246\270\325\361\243\323\314\222\034\305\255G\376\356"
+	.ascii	"\264r\311\013\314\r\030P7E\004TQe\027kz\022q"
+	.string	"\206a.\216\365\004C\232\240j\331\301\313\027\362O^\244\370~N\037E\005aP\240l\277$\261@\024\217,\017\276*\375ZT1\306Wd`\203J\214\363\327\023o\256\340\350\362\364\365\305\017\251\326\322\002\212\242\256\276\037\214\273v\333R\2661\330[$D\304\320zf\202\371\221\225\2119\326w\204Mea\320zf\247\275\272U\366Et\251lW\333\270\372\346j\033Y]CV\323\220\325'Y]#\253ie\265y\340]\272\232tu%\253\177#!\314F\r\037\301\315\222\242Lg\312\240a\343\027\220\003\177\373~\327\201~\320\247\215\210\236\345R\306\030\231.\"\237\353F\003\202}.\037\311\267\210\236d\305\321\244&\032\323\222\025\262\013\351o\310\217\346\001\220O\355\323E\317\362\001-(\212\236\037\035cIAz\034\376\244\2668\017\377\372@[\003V\346\030\230TY\030\364B\263(FFqo\373\364\027\266\314"
+	.ascii	"z\325/\271\315*\375!Hs{\266\252\034h\020\367\na\242(\222\004"
+	.ascii	"\237\311\t\036\277\307\212\r\260%\213W\317\270\016\235\210\225"
+	.ascii	"{\340qx\365\314\266\352\003s#\352}\345>*\370\332P\253\353_\242"
+	.ascii	"q\004K\035:\331\354\257~\254\323\306\b\233\312\310x\"\320mww"
+	.ascii	"\265\311\230+S\273U\376\021i\333\236-.H\325\314\265\352\247A"
+	.ascii	"\272z\237mu\244z\273\363\323\327\276\002EB)rA\272\334\b\323\016"
+	.ascii	"\"\350\344\034L\350\371\311\001P\364\303\223\323\220\363\001"
+	.ascii	"R\221\3739\355\2233$\202\304\020O\t\0218\035\020\316\004\020"
+	.ascii	"O\020\316Gh\b\227C\300\272\0239!\\\n\235N\bw\246\274\213\350"
+	.ascii	"R\031\205\320\214I\356\224\220Ii\263u\225\326\026x\333\243\031"
+	.ascii	"\003\271\024\244z\273\253\r\243\304\314\246\316\004\315\255\362"
+	.ascii	"\205\200U!iV\b\330\217\361\334\232\232\375\366lY\361\247\\\230"
+	.ascii	"\301\357\341\r;\365\276\035\362\343w\200\325\223\017|\215\241"
+	.ascii	"S\030\257\214B\263\002\254\206bh\315\321\302J\t\271\264=W\fD"
+	.ascii	"\250a \342\224bL\251\t&\252 \205\211:\200\002\021\251\253\033"
+	.ascii	"\021\020&dR\n+\255\006\242\323\336{\177\031rBn\n\344\347\340"
+	.ascii	"\300\201P{\005\bE\004\200\323\034\b \017X p\202n\023\226\202"
+	.ascii	"]\241\276c7\365\241\274\\(\206Tf\343*\f\306\027\306\317[\306"
+	.ascii	"e\325a\273\"\355\246\274\342\324\203\334\032A\037\214\033\264"
+	.ascii	"\357\326j;\025\230\350\361\252kB\374}\370\343\231\361\366\210"
+	.ascii	"\271ZB~%T\370\244\tvY\256>\036(Y\030\013\202\304,\241\007DKx"
+	.ascii	"\036\333=\361NS\244\256\006"
+	.text
+	.section	.gnu.lto_flashfsGetSize.37.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\226\001U\017"
+	.string	"6\234fG\320TQ:\220\312\3705\n\017\327h]C\210j\025\212|\307\241d\233`\356\311\315\370\037\261\212\317r}\355\367\337\324c\\\003\027\330!\370M\361\220\027\\\201\r$\2210\312\2111e\037\223\220\304\216\366\244\221\275\245L)S"
+	.string	"M"
+	.string	"S"
+	.string	"\236\234\337\342.T^\301i\"\266\331\250m\3301\"\345\354NN`{\204/\331\036\267\304W\217pu\345\263\036%"
+	.ascii	"\t\201\007\001\244\003\026\373\360\205\b|xB\004\210\275\240I"
+	.ascii	"\315\t \237]gb.UQ\212\224\322\n\213y\270\267\333\216"
+	.string	"`\033\202}\"\001$\232\316\217T!{\262to\354C\2716\266\325#\253\271\317[d5\204\352\205j]\365I&<|\234\212HI3tD\372\304\033*>o\377\205\212D\200\210\005\366g~\316uT\2371\2272\035F4\034z\f\221r*xt\002\3561?dV\270\274\323\330\355l\227\3130\351\036\220\001\240\361|GP\016\026\2737?m\337\025\030=/\r\262]\341;'N\312\227\003?\306\313\307\241x\364c\266\307\357\200 9-\035\262\322p\374\310\375\374IK\205,R;\205A\017\023\355kF\270\226\345\317\036Fa\320\300Cy\2602\241T\222\001\005\343\235>\317\2053K)\325B!\245b\241\245\373L\335\005\223\312\251cA\245\272\222\001\177/\036\252\203\371>TG2\345\241\\\033\037\247\326\003\271\375\354$\234Z\212\235\261\r\327)\255u\305\032\334\026\220\321\224\204\006\331\f\350]\335\321\302\037"
+	.ascii	"\277\251\322\375x\357\026\300\213@-\326\312V\006\320^5\022\335"
+	.ascii	"L\276P\305k\"\201k\2004\210\016E\t'P\264q\207\346\321m\\\217"
+	.ascii	"\025--\241\270&\022\333\304\326\305;K\020p\242T\003\306E\001"
+	.ascii	"B9\230\347b\232\310\323*("
+	.text
+	.section	.gnu.lto_flashfsGetWriteBufferSize.39.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375 \3315\006"
+	.string	"\304\n\201"
+	.string	""
+	.string	""
+	.string	"&\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\357\370\270\004\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\213\317\006\221\250\300\004\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}\276\001"
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\347x\341\234\036\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\242\013"
+	.string	"\203\003\202\2409\006\177\001\377\003\244\003\001\200\300\013/root/repo"
+	.string	"\030./src/main/io/flashfs.c"
+	.string	"\t"
+	.ascii	"2\003&:\203\023\002s\r\247\206`2\203\017wE\232\r\357\2727"
+	.text
+	.section	.gnu.lto_flashfsGetWriteBufferFreeSpace.40.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\221\001]\017"
+	.string	"\266\034dD"
+	.string	"\221(\035\343\030\013\\3I3\236\362\303w\033\252\261*\336\226j\212_\007K/\204\376\273\001\207F\220\276\255\005:\013r6oT\002\301\270\375\377\377\256\252\202\375y\265\223W\346\343\177\311\263Y\262\245\224)\005S"
+	.string	"H"
+	.string	"U"
+	.string	"\177)\261h?\016\036f\002\003J\fM\214\337\326q\016\354p\017"
+	.ascii	";\324\226\213\016WS\344\2178t\221\321*y\022\016o\241\325Z\b\255"
+	.ascii	"U\311\253p\335\002&\025* \317d9X\033\\\374{\246x\244\314\215"
+	.ascii	"\201\030\243\263\344Q\270\261\333>`\233\200\2350\376F]\261a\032"
+	.ascii	"\004\323\237M{6\255m\272\263\351\f\2469\233\336l\032\3334tz5"
+	.ascii	"\255\232\316\215\001/\254\b-b\234\360\242\021e \212\020>\352"
+	.ascii	"\037\311O\326ZJ\320\304\030\265C\037Ebk\207\367O%\266\346\213"
+	.ascii	"\b\256L\325\344\t\027+\303n\224\203)\324\215\376\304\205\224"
+	.ascii	"/\247bzU\250\252B\251\341I\305\2309\210\222IF\225E\021\300\250"
+	.ascii	"LrF\314Hj\346\2238\f\347{\260\203._\3524@\207\013\243|\371\337"
+	.ascii	";)\327\314Q\277J\n\006\013MC\314\032\373#\245\2628\006\361\350"
+	.ascii	"B\024t\037\013B6Ndc \3621\262\201\204\272\315C\200\271\006\t"
+	.ascii	"B\333\003\216\013m\3327\372F]q~X\255\330\217\376{\366buR\216"
+	.ascii	"\2024\305\366j\307HI\006\251\276.\302V\241G?\232v\324\243?1\221"
+	.ascii	"4]U\246\033\357\024X'\323\f$ `\002)Vg\007q\022Z\fR\250p\245\t"
+	.ascii	"Z\213\t\301\233\030[\b\231_\"p\034\217M\032\203U\022\334aE\302"
+	.ascii	"\233\b\020r\255\211Y\004V\303\270{clt\307]O_!\353\255\377\306"
+	.ascii	"hI\013#\"\247Ey\323\217c\316\254\025\022g\264\023\266\030\032"
+	.ascii	"\001\356\001"
+	.text
+	.section	.gnu.lto_flashfsGetGeometry.41.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"\022\214-3`M\323\001 \261\202P\226\222\203r\245\326 NR\rC\002\255\fuL7\342`\\\364>]\362e\220DQ0\b*\025M\302\321qq\303Z\333R\246\024\256\246\313\242pQ\013\226\007/\257\341B1\274\312\272\336$\031:$X\357\001B\353Eq\257\034\325\202\t\315\330\245\r!\221\327T\017*2\2329\262\330<\261c\226za\337\355\356Z9\266\323\352\bBH\">v5)(;\362\200d\330\306\330\221\277q\016\2141)v\266"
+	.string	"M\207\302\243d7>\307\017@\177"
+	.string	"."
+	.string	"\375Q\214cO\314\177\307\235\206\211\210\266\311\236\025\204\335uj\233\355\326\033\330\336\002\b"
+	.ascii	"2\003\346:#^\b\217.\363b\206!\356\2124\033\336uo"
+	.text
+	.section	.gnu.lto_flashfsGetWriteStats.42.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375 \367\265\006"
+	.string	"\342L/2pm\032\003"
+	.string	"\301U=dm\034\003`\320\204\256\256\370\255\203M\320\035%m5\211\b}\312\312\242r4\377\377\257\200\307\236\355\213\246\016\021\264\262I\231R\325`\254M\202\225Q\330<\310y\f\234\314\302\323T\326\303\\\n\033\020\252\347"
+	.string	"a\365\250y\267Q\373\021-\377\307\262\366\360|\2503\354\n\021\231\245]\035';\003\212O\213(UqVj\247\2075\213\326\225\377o\033\265\214\300\244$\206\374\240\024\224\2238\021\215\266\235\226\2527\314\321\351u\231\030\242"
+	.string	"\020I\002\344\344\237\257\323\003\223\235\305\002\223]\273\360ev\325\356p\205T\032\221!\217\031\300\301\3772\031\022\271\315\005m'\002\b"
+	.ascii	"2\001\0138\032:\034 \\\346\305\fC\334\025i6\274\353\336"
+	.text
+	.section	.gnu.lto_flashfsGetWriteBandwidth.43.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"]\f"
+	.string	"\246\027TA\020\221\223\016\370\377W\321\216\347\257\327\251\036\f\232\314\021C%h*\323?\237\017b\002\031\326\007\031\033\177\346\355\214#\026v}\357HUU5B\360\033\001\214S+\034\035&Bo\265\237\354\275\223L)C"
+	.string	"="
+	.string	"C"
+	.string	"\0354\350b\005J\213\216\030\267j\200;\320\3179"
+	.string	"\364;\007cvO\254.\2613\016\231\023IS\361\235\001\f3T"
+	.string	"h#\3271i\260\341\2223E\3132)P\214\261I\322,\270\317m\023\264-\320:\013&y\252K\336\270\\\250\021\223G\273\225\3447\264v\361,m\263\232f\251g\341\263\357Y\367\3543\233\231\365F"
+	.string	"\b\023\205\0301V8\311D\032\017\306\207\266$-\247\036a\022$\305\334\0267\020d\233+\003\376\356\257\307I\210\321\177\277\240\314\264\226[T\344\t\244K\206|\221\303\264\362b\320W\220\002&\313\035m#\370\004\366\021c<P\233\360v\325\036\374:a$M\362\253G\240\237\337\201)\021\005\371\\!\f\256P\203\220\312\022\251\036\210\204\034T \242\253\372xjAX \252$X\226\250\342l\321.\236\245\177\211\231)Y\263\022\323\"\215\302\324S\332R/\310\344#\007\257\271\337\335\341)\026'\"\374wO\026"
+	.ascii	"A\013m\271\302|\032zk{\013\246\351\236\210\200-\204\232eU\030"
+	.ascii	"\245\202\302\306\240\220\316\n\330A\301,B\214\211\t\306e\342"
+	.ascii	"Al=D.\356\226\251\312\345\271\324\036"
+	.text
+	.section	.gnu.lto_flashfsWriteBuffers.44.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\256\fEC"
+	.string	"*p\204\030>@\246\326\030\3660\317}u\204\327\336\365\260\306\212\344[4\306\256\252\362\200\237\370\030_XT`\256.9\325\034\244w\333\307\351_\334'\221\337%X"
+	.ascii	"\374\326\356\030[#[\223R\312\224R\n\203\001Q\001~\001q\212P\360"
+	.ascii	"\236\353[\227!n\311\226#Z\356\204s@\366\360\35078\230\207\315"
+	.ascii	"6s\017\3565\315\246\333\360\260\370\332=\201bi\3005p\376\n\275"
+	.ascii	"\257\364F\220:\316SP\335\363:\201\315\026\2214\231\351\236\313"
+	.ascii	"2\351\253\346\316\001\221\222a6\313)\230\230\250\271z\247\341"
+	.ascii	"\274u\351-\203\022\006\357}_,\016\321\327|4aNKo\331\\\024\003"
+	.ascii	"\260Y\"\236\246;s\233\3513=Z\272\243\215\357\033e\020\336\373"
+	.ascii	"J\261\030\001\260Y\226\002{L\223\351\301\317U\n\247&\324\322"
+	.ascii	"\350LM\243\367\2256\227\255l\233]\033\3316\373S\216\234d\267"
+	.ascii	"Z\255V{\2256\257\353\263\225I\344\321\270\244T$&\r\205A\240\333"
+	.ascii	"\262\353\373\223{H\215V\321\324\304Z\211\245\215\231'\245\254"
+	.ascii	"]i\3444\315J\023?JY\253\322F*\275\344Z\350\022\027\310\220\333"
+	.ascii	"\232\225V\202s\342E*\353R.\255\315\211\256\205\rP\204H\253tR"
+	.ascii	"\001\2675&=\\\255\n\305Y\324\3234&\253\222H\026\264\216\323\005"
+	.ascii	"\344\322\226\270pNG\265\331"
+	.string	"\301\322\301UB\0310Tz\232\246d}4k\364Z.\215\315\201\256\005\267\265h\273\323\264\350\272\214s\346mK\005\202G\306\317m\355J\263\253\353\203H\226\242\232\217\325\301_!9P52_\343\214\364w\233v\275*\331\037;5#\355\256\205\367}\331\321\324\326\232\231\232\271\3230\363\025\346\241\202\325,\336t\272\352\241\r\336\3521\340)\363?\3566\275\352\271U\271;b\253\2670\346\216\032\253\210\037\333\372\341\273\356\252\255\376\303\367\324\036$\017\337v\275\254\372\365=\274\363\231\265q\353\345x\002\257p\207}C\225\370S\370\3776\353\2626\337i\373\375\333L\216\314\253l\365\375k\336Y\2441\257r\322^\365\251\242E\324<3\037\020x4\365=\277i?\333\266\353\tO\306\334\021+\253O\374\016\275\356\210YJ\346\377\306\334\253#\2769\374Q\230\207\316 >x`\347\016Z\034.\264\264\273B\243\351\246"
+	.ascii	"\241\323t7h\366]sV\3435c]1\273\256\331\252\312u\246r\235\021"
+	.ascii	"\004\235\017\b\235\247\202\316R\256\263\201\240s\224;\027h\235"
+	.ascii	"\227\2533\001\327\031\312u\036\020t~\022:\013\b:\007\b:\003"
+	.string	"pg\247\326\271iuf\352\273fe\262\351\232\221m\327|t\235\215\357\274\324:+\265\316E\327\231\350:'\271\316C\240\263\360\235\203\2553\320uv]\347\326uf]\347\365\235\277u\366\326\271E\264\233=mL\264\370\375\037\351K\244\372\350\335\303\312\321\322w\335x\335t\335u\335v\315\375\246\3470\017\031G\313a\b\321<nMn7\334p:\3172\3173>^\214\271\021\201\240\261\243m\026\300\373\240\246\257\360N\300\346;-\360\233\276\205\244|\246\357\263H}\3240S\206\374)\375\0337\337\370-7\267\347u\324/mH\021\237(\305\177c:m\374v[aTz\n\277\324y]|%\346\027\377\371\316\"\215Q\271<U\020\0326\304\021qG\236\270`2}\235\370\314\0304\020\"~\260\216\3126Mzrf\255\016}\324\"D=\251\241a\322\017\337kn\257\314\377\004}H\372`t\f\320\360\237"
+	.ascii	"u\020:\266\327\357P\325\0307[\204\300\253G\202\370?!\032\355"
+	.ascii	"\320X\237\346\033Q\342\304\211\266Y\020\237\244\022\035\233\323"
+	.ascii	"\3025yrz-\3636B\3247e\344]\022E\203\355\325\037\240;b\306\205"
+	.ascii	"\360X\017\315\323\302\367\232\013\224tf\024)\274\321\204\037"
+	.ascii	"\341\t\331\213!\302\372\306\003B\370\306k\277\3714\204_\007\231"
+	.ascii	"m\351\233\352)\033=\211\342\376\033\373\333\317\326}\2579=W\337"
+	.ascii	"\276\373\017\251\253\375l\331o\277\317\242\275\367T\021\306\376"
+	.ascii	"\023\240(\235\026`:N\033\353\246_\230YHZ\327\256k\325\037\251"
+	.ascii	"\246^\246\307o:\272\"\257\337!g\313}\247\3618\271\2570\213-o"
+	.ascii	"\264\255\266\331\246\276D-\230\024\035\301\217~\266\314\\1\274"
+	.ascii	"\321xY\366bL5M2e\377\215\203b\376\303\337\250\022rf[=\264\343"
+	.ascii	"\252\221\336\303\207\005M5\234"
+	.string	"]`[^\\`Z_]2L8\t\273:F\215..\0223\266\300\234&\276\270\300\302Z \301j\340pb\370\342\322\321Ub\310\t\0260\340J\340\240\305\213,\344\227\027\027\f\0308Z\270\354\"\353\013\206\214\257\255\0310\232\316\256f\215\256-\032M\027^_\315,'v\332\340\362j\2029\235^\315\241t,\257\223k\020\371\311\016\277\034{2N\376\361;\274Cj8?N\362\224mtqmH\255\347\225=\376\325C\371\3521\004JJ\277\3518\353\213\234\217$\325\223=U\204a=\202\247r1\004\317\004\310\017\233\3267]/\307\256^\353\177\020\214\265g\230\016\324\252\034\322\230\365Sfl\204\222\260\276\371\320\340\237\221\303\263hI\314f2\217\314\357\272\346\367\335\372\276\357{\3747-fM\"-]x^\211\315\317z(3\007\346s\3706k#K6\242\306e}\337\371\327I\303\005\317(\005w"
+	.string	".\221\242\003\0175\365R\177\340W5\006~\352YER\210.|\337\365\322\3007\377\302\263\212\f\274\253\207\300G=\311\320\210z\037\264\374\n_\300P\027\177i|\002\307>\352\235>wr\254,\025\233\257|\250\027\227>\370P(\263%m\305\342\003\037\312ye\346@\275\324\200\207\372\225\317l\013\231Wg<\201\003~U\003Ur\346\351\241\340\032\355\220\200\017\360O\312\027\360\253\232"
+	.ascii	"\377|P%.\310D9\323\003x\346\201!\250\201$\347\034T3#\"\222\244"
+	.ascii	" Ic\341\004\004))\241e\036\021p\275TE\333\354\354\031\353\017"
+	.ascii	"\234\253\336bk\302\034#\353i\207\207\037\035\331b\205\340+4@"
+	.ascii	"T~\037\021=\252Eh\3644\247\230\024\223\231\330\306\223\217?\002"
+	.ascii	"\372\237\364#i\266^\017\031\361\005\211|H\203\217z\f\003\245"
+	.ascii	"\272@\030!\374\343\200\303\230!p\003\324\262j\020\031\345\031"
+	.ascii	"\367\025\223{\345\326\037\023\241\234\261&\027\3501\327\265\237"
+	.ascii	"?S\314\252\203\206\273\321^T\330\2326\032\303\006\264\267\272"
+	.ascii	"'\022\231\b\356Tv5\251\366`\245\323_\032b\307\230\272d\357Y\033"
+	.ascii	"}e\372\203Av\346\232\032.q\203\227\032\353\320\375\324\bq\275"
+	.ascii	"\013\033=\232\351p\223'\360u\325$\024M\310\022\364\021#\210."
+	.ascii	"\233[\bm^\375\233Yp\232\303\230\027e\306\367\205\302\320\003"
+	.ascii	"\367`xW\364\346!Q\370\3020bB\274\004\362\236\001\303VIUYBt\033"
+	.ascii	"t\r\243\254\375\"\234l\211L\333\026o\344\300-[\342\030MB\314"
+	.ascii	"\220\315<\267N\253Z\036c\037\031~\377\347\001\347^(\231\300|"
+	.ascii	"x{!\336\307T\221M\001\302\266x\352\222\n\r\300k\217>\244\275"
+	.ascii	"f\220\255\177\223^\232\001\367\006\241V\300#\357C\306\356\037"
+	.ascii	"\207()\247\301\245{\003\243\240\221\357\377\344n0\246\234\247"
+	.ascii	"+lc\340\352;a^:\036]Z\362\"i\361\220\321K\354L\202\b\003neY\301"
+	.ascii	"\375\352\0205\207\270\255`\244\225\016%\374\266\013\240\211\217"
+	.ascii	"\b\030\350\344"
+	.string	"\001b\2431\237\241;\365\230\302\270\336\t&"
+	.ascii	"L\354O\340\032\004\t\324\260e\237\032\306\232\214\246[c4\"SM"
+	.ascii	"26q\306\b\t\372 `\224\306J\025\243\252u\203\230`\205\330tP\300"
+	.ascii	"G\370\355\n\352\260\354\335\356\202\207_xWJP\237\323`\202\204"
+	.ascii	"\220\232\f\251;\256\234\353\321v\242\262\"O\217$\273\030_\327"
+	.ascii	"'\260\2742\224\365\243\177\314\315\265\334\375\2102\331>i? D"
+	.ascii	"\223\227U3{\3040\313\306_\221\265\317\007\270<\242\374L#,\251"
+	.ascii	"\342\312Ql8\246\246\243\266\364\370B\247\274\276\355\017"
+	.text
+	.section	.gnu.lto_flashfsGetOffset.46.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\272\001\205\020"
+	.string	"\346\036mG\360\260(\035jqa\213_\257\314\305\035\036\323\262`\353\370\032\214&^\237@S\245\353>\t\307\016\334\177iu\264\333\262c\302\274\032\340\314\335\244EV\202\362\3023\020\"\237u01m\033\377[\371\326\032\331[\312\224\002^"
+	.string	"N"
+	.string	"\\"
+	.string	"$^\"\305+\004\022X\240\201\0204\255\031\033s\206\336\307=\270\313\370"
+	.ascii	"\334\345r\370\3522\256\256\374\330\343\214\027\235o\247\006T"
+	.ascii	"\271\274\005\036\036\027\350\362\370\021\241c\266S\003\272|#"
+	.ascii	"\310\353E\205\022\270\022=p6\304xxm\001?\325\317\2019\247\325"
+	.ascii	"\005R\270\271\333V`\233\200\255 \001\237.\314~\234\013c\257\332"
+	.ascii	"\264\352\222T\223\244z$\325\235T\213V\035\222j\220T\177\244\232"
+	.ascii	"\213"
+	.string	"jiu\214\352]\365\001\214h\304\200\307\340b\316\t=9\346\215d\001\302\227=D\271\t\237\274\350\214\230sv\227\276\f\305\356.o\247\330\235\037q\336-\270N\264jS\332MW\330p2D\320\206>\313-h\317\"\363i\217\345~\366\273\334\256Mk\307\210V#\347\037\\\257\233]\230\334\335\005\263\332\212\342\2301\221\033\362O|\206\362c\034A\245w\251V@\207\013,\355\361\303\213h\266\234\313\036\202\325\346\r\032\235\206\2517;\f\036\tQ\2214P\2118 \361P'\357\301I\304\304\033I\251\274\220\001FA`\220\362NP\250\224\327\205\254/\214\325C\rF,\355\303'\220qk\251\330\320\232\266\305v\334\017\326~6\3557\2428\315\352T\342\227p\227\337\307^@%\205\314+&I[\032m\267\244=\313\353\033m\264\021m% `\002!Uy\003\021\005\214\221\251\210\263\3755q\341\344\313\332["
+	.ascii	"\212\354\245\215\355\207\314\005\0216\216w\223\217Q\225\344w"
+	.ascii	"X\223p'\002\204lC\034\277C\267\203`\354q\207W]2\341K\253`\223"
+	.ascii	"\221\225\306Dg\337\210q\241\025+\234\331-\215\363\203w\024\265"
+	.ascii	"\020\n"
+	.text
+	.section	.gnu.lto_flashfsFlushAsync.47.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\022\b\235/"
+	.string	"\nS\230\022D`\236\326\030\263Mevi1\347w\215\331F\324p\320\324+fW\336\2633!\026F\257\230\265\233\262\230N\277\007\373\016\351\032\364%\260R\343\350\267\263\005\007/\273\270\356\351b(G\021\204\322\210\2242\245\224\002\037\001\377"
+	.string	"\024\001=\\\f\272J[\221\321\315\030\305\254\346\273\024\"\301\346\240-h\226)"
+	.string	"\233-vP\333\354\332\304\226g\312\300\275\321\256\210zj\207\026\346}\233\f\370"
+	.string	"\260Yff\007\021d\360U7\305\272\200\314\352\222X\346\274o\223\351\223\364U\003\021\003"
+	.string	"\370\361\031\366\360\b\203.\360\327\262\353\373\0257V\003!\225\250A\243\032\361\"k\342+Y\013P\246\\\342\0040\326\326IQ\245\022\377\37159[i\f\r\332\024#^>\332'\311\210\327\220\036F\225C\326b\231\022\314{V\244\260!\324\216*\305\326\342\234]\262\313\224B\234g\302\217\347\221;-\313\034-\214*\203"
+	.string	"\361\240\333e\312\037Q\245\017\007\256A]M\266:\252\374\261*\220\276\305ig'\225)\277\374\327<\364\364\266\226=\272\375E\261\343\274\323\262\354\321\354\252"
+	.string	"\214\214\216\341Rk\r2s\204MCg\370\332G\262\376\325\201\226\245\333p\231\265\366\234\271)kg;\327\022\351\376kz\337\227}k\351\325\034\324\314\375\202\231A0\377$\004r]j\254\3753\231\370>\377e\203N\221\351\031\274,\247\003\006\312\347]\356\270\376b\344&\343\022R\336[Rm\263\304\037\302\373:z\225\373\255\203luQ/\r\224\246y\241N\333\331\301g\232\222\272\367z\037s\023\351\317d\356\257V\253U\3760fv6\020tV\n:\027`\347$v.\006\235\221\\\347#\327\331\310\235\t\270\363"
+	.string	"w.rg\001\2563\221;\017\271\263\220;\007\005\235\211\215\326\375\023t\366\031\262s\260\325\232]\327\371\347:\267\2563\313\316\253\353\354\256s'8A\246\013\307\262\301\330\336\267\253Z\347\265c\341\234\264Z\277-\241an\r\235\3525v\257@\321\334\246\2664\027\026\313/b[Xd\351\266\252\"_\352d\251b\356'\263\220]\364\032\377\0259(`h\357\373\n\233\345\306\342\202Y\330,\313,\203\373J;Y\310SU\263\352\327\353m\032s\314\334H7"
+	.ascii	"\233\r\037\355\255\275\243W\355\220\036h\354\353\310\245\203"
+	.ascii	"lr\321\327\373\200p\322^\3524K\336\216(\347\201\361\200\"|&7"
+	.ascii	"\231\231\235$\024x\3640\314\334$\241\277\341\273\317E\327\353"
+	.ascii	"?\021\2359\204\b\357\255\365\037\020A>\326\333K\335s\271\351"
+	.ascii	"(\205\212\027\276\3403\333kH\247\204\271W\355\317S9\363l<\255"
+	.ascii	"\020\241\356u\335x2\006|&;\223\2722\255\3217\2645\264\351KBY"
+	.ascii	"\242?z\256\243\037\376\223\263\f\202\273\351\321w\263\333\331"
+	.ascii	"\215D+MJ\225\036\245?\002o4\340\213\236\300\267\026\030r\300"
+	.ascii	"\257t\002~}\233\345\332\"\001\357|>\327\347\\\311)]\355\320\023"
+	.ascii	"\t}\320\017}\023_\350\333\347\203\376\351\222wx\346\344"
+	.string	"D\273F[\234\031\366\311Y\327\320\016\316\361E_\357s\231u/u\212\340n\370\255\326\305\243\367\261\277\277m\325\016\277\371\264\236 \253m\325\366\373w\362\013\031\246\305X\215prj\233\355_\032\363g\232\235\2167\033z\3533\273\003U\306\0261*\030K8\255pI\030\251\214QQ.*T\031[\304x\352\341\006\020\"\030\033Hx\"\261D4BQME\261\f\265T\025e\242\312\tE\024\323\224\024\223\n)\247\024LPTULKD<\265\302H\305\324bj\212\212I\310\314\334<\366\372~\030\2578c\222\204\022\r|\223\231\365\261A\335\246\003\3261\313c\203~\263\351`\360\271\351\370\310\365}\337\027H\351\013\274\201\357$\034r\252\364\356\233\002O,'\306\034\271\373\314\026.xoq1\353\261\330\237rO\250{E\2654\037\304\267\2650\034\\\001\222\376F\0223o\316`H\372\177,5\347\0308"
+	.ascii	"\317\344b\221s\267e\330\340\275U\374\bm\035\2043\2136\360\315"
+	.ascii	"RJ\235\276\3178)\2324[\216\374\360<\343\232\324=\237\253\226"
+	.ascii	";\257\327\\q\350\320\241m\326H\f\216\232\2743\bc\344\270\r\237"
+	.ascii	"\311\277o\237\312I&\313\351\250\261\362\340\364{#3\306;\323\013"
+	.ascii	"\322\323>\233\346C\373\356\327\021\r\373BxoR\352\336\333nA\250"
+	.ascii	"4y\336\232\324=\244\200\244\250a E\231b\nI\211(H\222\244\320"
+	.ascii	"\001\220\"\0312\253\007\020P\310h\232\016EF\325\351q\202\273"
+	.ascii	"\005Q6C\337\""
+	.string	"Z\017[\254\321gM\360'\243\245\264l%+\326\026\327S\217:\003\240s\003\261\336Bk\203\230\203c\313\0271-1p\303=\264\325\263\374\332M|q\273\"\240H\035\275\350\326\230\244@Z5QM\210\355\354\354\342F\317Kn\307\243\363\005\255\373\254\030\2203\210U\311\263\312\232\216\340\207rW\032\347\3563C\374W13\201\205yY\206\370\342\312;\n>\247\r\216\274\351y\235N>\205\021$O\246\335)\311\032{\206mW\313\270Ox\2332}O\200S?\317#\261?G\367\376\236\013\350\001IRN!b\350-\325\201\327\312C\004\315\224\236\220\345s\335\026]\020.\341\016`C\374\233\255\t\tX\330#\203K\246l\306\034<\372\316\270\n\211*-J`A\306\265N\246\252\004\037=\b\t\212\210B|\344\373\377\3642Z\334#\250%\307\260\202\004\233V\n>\200\002\303\374\020\3771\236\245\302\"\372\274"
+	.string	"\024&6\216\205\020\314\307\371\275.\260\023\362 X\323\022\316("
+	.ascii	"\025G/\261\340\\\021F\325"
+	.text
+	.section	.gnu.lto_flashfsPoll.48.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`Z\001%\017"
+	.string	"\226\033eE"
+	.string	"\261h8\003@\027\fB\357P\317\237\302\251\273\201\367\3074{\276Q\376\320>\235\227\346\311\346\361\207S\330\265T\217\230\277*\314\005\0178r\374\377\377?M\353\333\243\326U\272k\266\220\345\310*\331{o)S\nP"
+	.string	"L"
+	.string	"T"
+	.string	",vE\0056"
+	.ascii	":g\226\215sqeG.\265\023\024<\273\373\251\210\263\336q\233&\313"
+	.ascii	"\017\205\255w \224s\235\n\313\r,D\371\206\201\246\333\201\224"
+	.ascii	"\026\036D!\270\r\250Q\231q\361\251!|ez\246\335u\302\302\016\267"
+	.ascii	"w"
+	.string	"\333#\266\035\330_\t\327q\034Gk\b\373i\357\351\356\263\237\313tr\020\300\001mN\270\304\350\215\270\033\306\237}\301\311\214\260}\277v\261\344/V\0203,)\263\335\025\235\363k%\266\350\334\375\027\226-\2629f\022d\236\346\005%\326g&\243\357\344\314\002\233\312`\356\351i\177\206\0225:6\020<Um\345\212\03251\265I\327\351\007L\214W\3320\200\364\305\024\205<\254\323R\f\024\037\222i\201\261\351\003\322\tszh\320\220\340\351\022\301m\013\027\3620\027xi\313\247=\224\202\206C\317\316\246\217-\202\2512;\356`P:u4\370\b!\t8\221\204\2406\203\220V\"\017V\036$\"_\n\365I@yD\370@T\253\2174rj\302I\365UH\245T\237Ht\335\344Rp\333\335\355\002d\252=\202\312\303L/m\231\323T\347\311\rW\216w\001\322Tp*\213\221\361!\366c\242%\037"
+	.string	"\233YEfh:#\017\024\340\303A\300\025\251\355\025m-\237\021\336\023#\343"
+	.string	"\256\032\006V\343\301\262\250\354AC9V\0302;\252\256\324\303\202,\342\022\324%\3562\033(*\"p\367n\232>0\222\256\332\001w"
+	.ascii	"\263\310a\356\001"
+	.text
+	.section	.gnu.lto_flashfsJournalTail.49.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"e\013"
+	.string	"\206\025O>"
+	.string	"S]8\200\263\245\017\311\027\373oJw\215\262\214\004\"\226\365\303\377\027\362X\202\241`\2748l[\363\206\331\200!\330\307\301\225\376\377\257QPmE\364#\021dT\266\331\201M\210\224)\005="
+	.string	"8"
+	.string	"A"
+	.string	"\037M,E\005\016\r.z\354\256\246%\316\375\322\344\374\207\007\360\201\335\257\211\350z\021\030\315\020\r"
+	.string	"A\227\201\032#r<|n"
+	.string	"\275L\t\203\335u~\240\207\033\273\355\006\266\017\330O\020\243\227J\302\376\265J\2625\255\231N\211&\025\352"
+	.string	"\276Dc7\024\362cUX\214\024\266\357\237.zn2\002\020<V\354nv\314?y\354\354\330}\023gg\346l\035\001\035\353F\n\224>|\321\233\267\330&\273 \005>\013\f\024|\024\031\"\307T\013\234\020?\031\342H\372\242\205\013\371/u\201\bO;_|"
+	.string	"\030!ll\202LV2\306\026+_\240\306\326\216M\020;\276T:\030\b\035K\004\214\266e4\t\031\313F\273p:Z\205\342m\302\003\216Va\3338Z6~~\255\222\354"
+	.string	"\265j\255>\352]\002\322\316h\362\237U\273g\351\033\251\364[D\365\341\363\003\2070\021"
+	.string	"3\241uh\214\254\201?fY\240Z\301\226\300\026"
+	.ascii	"e[R\261\325SX\270e}\027r\034\214\225\207\262Y\\\346\250\232\244"
+	.ascii	"\201\251="
+	.text
+	.section	.gnu.lto_flashfsFlushSync.50.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\364\005\235\""
+	.string	"\006z\317K\220TR:\025\312\b5\035M\304\224<\272\340E\034\001\021\354O\206a\"\024\t1\304\2248s\004V\343\335\344DCT\275-\205\232e\243]0\003\"\t\230\221\211p\314\314\345\245`m\244\261x/\376of\313ol\226\220\275\223\f\260"
+	.string	"\261"
+	.string	"\301"
+	.string	"W\032\325$\273i"
+	.string	"\332\215\344\025[w\262\301S\346s1\353\236r\205o\0351\257O\357\207|\311+oE\362D\220\2564\001\323\314\276\r U.(\250O\3370\274\0319\277:\026\322\263N\274\233\372LlU/\326\272\231n\236\262\002\365)'\017"
+	.ascii	"\367T\375\f\356)#17\237<v\r\325\333p\213\255\273\177\227\307"
+	.ascii	"\221\256\346p)z-\022?\351jNg\371\\\215\343v\305\032O}\305%\324"
+	.ascii	"\246\273/\226\302\242\006t4\031\177\321\007_E#\276\"\n\264G\325"
+	.ascii	"\374\361\345-\213\242\222\2659\235\356fK,6\235ugf%f\306\300\214"
+	.ascii	"\363\005\366D \356\351\275\001\244\030\205\366\215\237\344\273"
+	.ascii	"\256'\352\032\326X\333\363\313\377\330\214\301l\273\2059\251"
+	.ascii	"do\024\363\321\276;\230y\226ix\226gV\3132\253\345\030\236e\230"
+	.ascii	"\325\362\313j\331\267Z\356\355,\363t\226W\325\362N\265\254S-"
+	.ascii	"\337\002\275(\310\342\255\272\272a\274q\351\263\224L\352Y\277"
+	.ascii	"\362\226\371|\262'\031q-~\340\244\305F6\342\310\307\202\327\342"
+	.ascii	"\001F\214G\202\314\353\305\230W>"
+	.string	"\272\026\277\310\303vNaV\335\275\202e\025\t\311I\355\301\376\225UtU\264\020*\201\227\322\bmc\262\233\276\224b\273y\332\223\312A\355\275\336u\024\037\272\351n\357\242U\206n\3024\263\177\035\271\254R\237\245\331\2024&RxR(1d\216+5(OSiX.\252\2516'\357\362\231G\373\300G\352\222\232\234\345\270\352n#\334S\273Et\n\355\033\257\367b?\343\001p\354\026\236\310w\362'\027\370\310\247\214\201\207\347~\t\210\222}\343{\327\213\232\r\335\204b\3771\255\214\331a\377\013.\252n{\366\220\f\f\324\300\276>\t\265\276\324p\340H\274\327m\204SB8\0264\235\256\f$-\256\240'\262L\240\335:&\\y\335\232\322\2539\203\247\370x2\335\033\305\272{\257\321\005\023\352\211&\005\205\325\262d\203\356\352\370eW\322\303G\362\0170?@\021A\233\016D=j0\307\016 D"
+	.ascii	":\220\340\303\001g&\b,\021\264C\004\004\002*\362Y\371\007'\b"
+	.ascii	"\344!\330\003\002\3507\024\364\023\n\352\t\361\373!\n\376pjx"
+	.ascii	"H\004\220\350Gbh\210\350\267&\205G\373\356`\035\341U\272\372"
+	.ascii	"\230\335\355\262e"
+	.string	"wiz\030\307\276\353*S\261`u\3333\bS\200\265\b\216\004\324\230+X\260'\262\315\322Mb\241\037\314\006\373\227\277y\022\346hn\226\023\2354\367n\r\335\252\236f\2362w&\346\242}.\303\311\304\\\024\312\320\255\212\251\315\211\273Q\274\203\3437o\005%p\304\302\343\242Zks\302\\\376\224S\331\341#\327b\321\026\321\371ra|\267w_\356\227\246|7\200\202\250q,'\215b\206hd\222\246\240 \351p\002\231)\302y\021`\275DT#IA%cC8\022\265*F\270\355{\226\217\0042\271\337R\rH\021\320M\027&\0039\207\320S\261\013\254~\261\234ABp\316\332c\024F\3675/\034\307\300\276_7\230\313\207\264Y\244\265P\374\250,\371\266we\340\226\352*]?|\177\272d\250\241I 8u\245\265\363\342*\257\002v\\\201\304\312\004\260Y\325\001j\307\372*\305\203E\024"
+	.ascii	"\340\273\346\254\357=3\317\200\350\233\0278)\205\031\206\233"
+	.ascii	"f\303\261\353\220\206\3571W\326(Q\317p\006V\250\266d9\327q/\344"
+	.ascii	"\324\013\207\274sa\310?\315?a\326\353\246*S\243\370\306\016\031"
+	.ascii	"&\255\242\261\257\2017\017\211S\236\331\340\032n\252\317Ht\237"
+	.ascii	"\272\340\203p\324\277\341\211\346;\351P\363lH\215i\016!\374\365"
+	.ascii	"I,\200\372e\033\r\262\244\023\221\\\366\013Mj\003O\271\005\215"
+	.ascii	"`R\034v\235K[\031\227\032"
+	.text
+	.section	.gnu.lto_flashfsSeekAbs.51.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`V\0015\017"
+	.string	"\326\233eF\360\222(\035J\030\267\213\353\f\356\2037\036\256\205\214`\365\021\270I\033?\307\224\341:\3147oG\362\241}\204\230\307\241\262Hj\201\345\326\324\201\031x.#\332q\0345\017\313\345'\fY\365\347[Cd\023\271S\nJ"
+	.string	"P"
+	.string	"T"
+	.string	"vgw<@\227\177\371.O\021\336\225rg\327\203kfwD\340\002\234\317\317\007p\237\333G\270O\207\366\354c\210%)\301\302\212\321v\327S\020\017/C\377\257w\304\326\312\245\b\203\335\265\024[\031n\275m\002\266\035\330\267\021R?\330\337vw\255-\266JO\225\336\356\372\265\003 \307\205\326Q\310\354b\250\005Y\232\031c\204\377\362\030\352\243\037\343\3410\243;\f&\365\261"
+	.string	";A;\360\031"
+	.string	"\b\fu\230\3246n\353&Xn\270\320>\335\200\363\351\277\240\354\356\363\376\030\006Su\2105\265\233\270M\247\236\265a%kV\335t\023\302\032\"[h\220\371+\316\"\345\213\360\227\"/\246p\237\002ptP\311\232\037\273G\246&{\3149>^36=T\017\373G%o\214B\203\2236\205\n\362\242?+]\261\201\231\f\331\312\033{\\\005 8:\211D!\021\227$P0*Y\360@\004\032Q\031\201$\322\307\331\004\004\222\"\200!\t$\357+y(\245\220\31139\201\036\210\304\337\204\321\311S\371\276\223\327\215\252o\253-\234Y\r\032\225\256\376\327=*~\220\260\331\241\22270 \310\230X3\325w\361\027\246\322\311\t\367\037"
+	.ascii	"\255Ye&\2368E\313\245\333V\250}\220\f4\341\203\004\300\306\301"
+	.ascii	"b$\222?B\267\245\026\261\025\253\2641\013\323$M\243\352l\370"
+	.ascii	".\250\201\332K\303$\310L\030\254a.8\001k\f%\n\202\335\352\324"
+	.ascii	"\300\312\f\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_flashfsSeekRel.52.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\221\0015\020"
+	.string	"\206\336lF"
+	.string	"\261&\035/\034\324\254\257\224c`3\310\017\361\341\272\301Q<\016uj\246\357\312\035;\227+1E\361\252\r\362\033\bH\334\252\251O\353t\370\377\277+\203\326i1\030\376\224\001\"%\007\374\254\031\261d\023)S\nP"
+	.string	"W"
+	.string	"Y"
+	.ascii	"\334\243_\263b\223\036O\262I3LO\3731\227a}\306\202E\273!dpv7"
+	.ascii	"\304\007\270\307\322\tl\217\332?\266G\263\354\331A\022\013\202"
+	.ascii	"\302\304K\366\263\273\235\2168\353\311\362Os\321\007cy\206\032"
+	.ascii	"\354\256\363\203i\270\365\266\r\330~`g\201\006]\251\"\354k\273"
+	.ascii	"\273V\027;\246\271\230\016}\346\337\264\264j\351\324\322\007"
+	.ascii	"\020`v\003v\230p7C\270cs\242\214\023~\315e+\007\375\233\021\007"
+	.ascii	"\032/\273Kz\314F\245t!\006\263\223\340Q\200\217I\363\261\225"
+	.ascii	"\333\250h\340\302\376\362\241F\314\317.\030\362h\007\001\372"
+	.ascii	"W\213+C\253\206T\343\361\352\221-6\350\270\030`\243\303e\037"
+	.ascii	"\251\bu~s\256\207\006\007H\207\352c/\2652\310\251W\325c\360\340"
+	.ascii	"\312\320\233\246\376\325\303_q\026*~\tK8\311\177'\333\343U\324"
+	.ascii	"\322\312\320(=\\\332\025\274\374\347\222KY\214`\226Cg3\310\001"
+	.ascii	"\236wZ\225\224\214\204,\242`\301I\204\001\204\022\323G\312\311"
+	.ascii	"C\241T\233IL\036*\20272\001\325\251R\035Jj\344\244#Yy\235\t\304"
+	.ascii	"*\n\247U\227\242R\255:\022\330\272\266\352bn\346\223\323R\327"
+	.ascii	"O\363Q\n\037\020@;\255\f\212A\222\262\217\207S\377\305a\244N"
+	.ascii	"&&\333\243\342\370x\302\247\266\220r\001! `\202!&\257\016-\253"
+	.ascii	"H\217\327!\243\241\"FS\370\222\261\t'\022`\343g\261\206\344\003"
+	.ascii	"\273\225\026\325\"d\335J\036\275f`;.\233#\334j*\246\324\336\306"
+	.ascii	":\334@{\3210E\240a\315NZc,h\371{\326\327\nH\362\3422d"
+	.text
+	.section	.gnu.lto_flashfsWriteByte.53.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`7\003\205\030"
+	.string	"\026,\236I\260\226Q:,PB\020v\304\212\034f\350O\360(n\323^\356\346\234\2470\272\241t\225\300\244 \240\243R8v\353\0327\251\r\223d\370\3246f\300\331\331\232\366\023\307\3309\317\013^\232\305\237bo\355\177k\204\020)S\n\214"
+	.string	"~"
+	.string	"\213"
+	.string	"A_\002\341\235\263\327\224d\316\237\002\027p}t\220M\365\237\322\f\300cH\221\020-sN\334\302x\320_\256\0269\212\253A>\254\f\361W\013\247\205Q\322]\003Z\030!\275%\326\bM \2115s\316XY\244\244x\363T\036\241\225D\342L\007\025\2163}"
+	.string	"\016\023I:\036\305p\310+O\\l\355\350\022\224\362T\236\370\212\007zM\216h\345\220H\003\305E\225\003\257\"\312\235j\013g\316i\345\225F7\354\266\223l?\2607B?\202\2722\245Q?\204S\263\\T\254l`Y\235\3510'\254\025XUS\263\354\337N\327g_\234\373\302&\3257RM\243\352\031U\333T-\243\352\032\251\216Q5\214\252i\252\236\215j\331\227~\327\250&U\255\243\372"
+	.ascii	"\004P\005\247\202\360 \262R~\263\304\027.Sj\\R\303\366\375\246"
+	.ascii	"\003\201\376\263\204%,\275%\017\007\342\233\024Qz|\364\233\200"
+	.ascii	"\354\330\307\307\354\0300\201\252}\323 #\256\220\353\263\316"
+	.ascii	"x\022%\322\354\201\207`%\253\b\311\306\354mE\354\227\367\220"
+	.ascii	"\267=\323\025\211D\025\320j\212\312\220n\031g\226\306\2662;\263"
+	.ascii	"'\352\355l+:\251\2558o&\244Lm\365J\241\262T\311\025\024\026\""
+	.ascii	"\314\306\320v\2660{\"\033\273\245\355\311\235\355:)\362\"\203"
+	.ascii	"\312\"<\r^Oj\327g\331\222\253\023|2\244[\2340\310\366\345\007"
+	.ascii	"\037$\347\313\260\216\203\236\307\201\374H\356-\006\222\220~"
+	.ascii	"\361\201\207A]\375\036^\300\240\001\317\002\007:\024ll<\035\200"
+	.ascii	"tD\357\330\374T\270\360\223\223\241\002N\327\203\323\320\223"
+	.ascii	"\223\303\355\370\374\340l\002X\267\201\307\007\327A\247\363\301"
+	.ascii	"\305~B\307\021\332\335\253\246\bnO\310\321\363\\3\264!l`\350"
+	.ascii	"C\350Z\237s\344\222\233\022\226!\303\034OJN=Z\353s\216\374\352"
+	.ascii	"\004\243\f\fo\b]k\373\303\221\200\270M\231s:\360\215\374\310"
+	.ascii	"\216/\343\243y,X ?\022\210\241BH\277Et\347U=G\222\373\025\205"
+	.ascii	"HaU\355\221\222@\2501($!1\n\252\021\211D\2644\352`\002\031SV"
+	.ascii	"\036\020P\311F-\034\033\373\322p\272@y\"8g\006\276b\364\3749"
+	.ascii	"\245<\360\017\360\355\320:o\303\344p\277\247+\235\\\023*`\020"
+	.ascii	"qw\224\213\253\247\362\346\tk\326bW\314\307\207^\204r\331,L\322"
+	.ascii	"\205\035\275\354\036V\023\037.\257\376\347M\240hD;2\327\344\317"
+	.ascii	"\374\030\020\005\213wDL\005F\324\340\301\016\214WG%\007\024w"
+	.ascii	"3\240\001[\323\330\336\274\255\355+\033c\223\302\223\212\236"
+	.ascii	"P\003"
+	.text
+	.section	.gnu.lto_flashfsWriteReserve.54.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\013\002-\021"
+	.string	"\266`pE\360\320&\035s>3\337\033\234\302X\357&~o\270\264\340\323\255\375\325k\307\301\351\232\234@\363\\\350\006#\327[\001\321\307\r\274\277\225\201+\2419C\311\306\021\241Al\322J\256,G\266\251[#{o)S\n]"
+	.string	"T"
+	.string	"]"
+	.ascii	"91\347\330}\251H\261\013\033`\001\241C\333>\210\207\220\361\214"
+	.ascii	":h\220\262\020\362!\006\313\004\215]\030g\330?\342a\350\035\361"
+	.ascii	"P5|\346\360i\316\370\331\b\002\f:\261\226\213\346\320\346o\344"
+	.ascii	"\262\271n\256\232\027`w\257\363|\340Ref#\273\353l\271$\334\361"
+	.ascii	"\266\023\330>`'*\360\n\200\303\204T\306\034\362#\303\305\246"
+	.ascii	"\r\033F\223\232\301\376[}\331N{<\347\347\310\322[L\227^\232\364"
+	.ascii	"\322\332K\217^Z\024\323\241\227\316^:\3024|\351\367\322\252\351"
+	.ascii	"\324\364?\266\013\020\\\317\211\355F\210\335\330\026\260\247"
+	.ascii	"\203m\031[\263\265\227)\363\001*R\005b\005u4^H\375\035\005(\244"
+	.ascii	"\0277~L<L\236\326\214LCQ\237f\n}V8P\243\236\025\244\022S\241"
+	.ascii	"\202\360\260zT\031\263\352\333\333'>\375\nG\245\252\n\203\025"
+	.ascii	"\364\235\037\240\334]\032\325k\t\t\0265Y\243\004*U\344\213\370"
+	.ascii	"\b\025\377\306,]\276u\350w\361\001\026!P\340$b\240d\201\251#"
+	.ascii	"\005\006\245\345\264\022mbz9Iy!Y9\341:\024\327\202\"a\341L\\"
+	.ascii	"^8\023\210;\006'\027\016\246\353\\8\r\266\177\253/\017\215\251"
+	.ascii	"\220R\2257\365yN\333\206\335\324[\376\211\243 \361o\016mr:\305"
+	.ascii	"C\017\375\312\303\026\203%\222\226L\327\224\244p\305\212\302"
+	.ascii	"HE\252\2152) p\"bfv-\253H\343e\033mL\033\210VY~\004\316\205\033"
+	.ascii	"\316)\311.\b\313\003\344\311H!\004\017\032a3F\024+\202\206\024"
+	.ascii	"\b\223\243\231\360F\030|Bn0\270:\356\205\t\032\bU`\003\244\304"
+	.ascii	"\361\256\306\270\3506\240i\207Q\343\333b\n\326\2217\037\351!"
+	.ascii	"\037\312\215\337\333Z\245\007"
+	.text
+	.section	.gnu.lto_flashfsWriteCommit.55.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`#\001\345\f"
+	.string	"V\030WC"
+	.string	"\2216\035\243\247!\270\323\035\f\210\240\205X\204\376&\021\333\327\317<~\006\373|I\333\2220\332\243\006M\f\021U\025\272\006\240\037\032K\377\3375\332;\0374po\336{\224\003\021\220\231}k[\312\224\002A"
+	.string	"?"
+	.string	"E"
+	.ascii	"\237<\017@}\212\347P\237\274\3310\376u\330\216\210\t\242"
+	.string	"\026\031\273{)\207o\217\232\233\237\351\330t\036\367x\341\n\300\013E\317\356\276\304S\202\007\312\314t\354\256\263\363*\334\323m'\260\215\300\376(I\303\376\270T\025\373qw\327\272\301>\313Oe:fZ3\235\231~\225\255\214(x'\305\330\035\2051\3532\265\370`\373\225]\211\254\247\375\225\223\330\316\002\301\233]\r+X\354~\004,@\023\371\342$0D)w\227SU\261\206?\241T?P\270\b\345\fo\200 J\252)\336\201zU}\204\f\240\f\355\233\370\211\023\337\203\037\240\344\273O>\n\365)u\203\201\322k\266\210j\244d\350T\341\275\300\200\033\346(`\340\303q\340C\201\305\0211YP\362!\241\fbi!\"\232\007I\310\205\215\\%#\036\f.\220L\273\254\216\261\006\237\3542\301\260\354\252\276\275\005\027\230\227\024\005Y\223\003n;\320\362\235=!\345\274\001\216(\305H\322\230\215\032\030"
+	.ascii	"\255YEfh0\202\260\001J\336\300\225vw\204c\320\212/\344pz\211"
+	.ascii	"\026C\033\f\361x\204/D\003\201@\212\307\267\352\327\313\032\354"
+	.ascii	"\202\267\265\032\r\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_flashfsWrite.56.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\031\f\005@"
+	.string	"Jl\250\027?P\3461t\213\r\034s\236g\205\342\330\325\271\006b\323\376:\322\250S\326K\230\025d=\301\034\302\260\320O\223\307\375\"I\324\003"
+	.ascii	"\342'\020\376\005\003\320\203\331|\004\242\241fdk[\356$\003f"
+	.ascii	"\001P\001p\001n:\236\256\364\n\035\231\245\261\013\022\274\357"
+	.ascii	"\321\002u\216\317s=\313\357\3212vE\357\026\021m\216\0334\357"
+	.ascii	"\336\257\034qK\207\372\341\351q;\314D\376\361:\034\003\352h\f"
+	.ascii	"z6f\345\327\330\203\030 4\367"
+	.string	"^:J\376\234\037\314\304\373\372q.\207\211C/jR\366\252\2210KT\346\242\314\2219M\352\027\354\376\b\231Y\235\335\275\321\t\367\261\211\340\220\312\321Vf\013\031\226\177#\244\300#\331A\335H\004\357\033>\2175z7\313\237I\261\360^,u \202\367\031\355\260\310\361\225\371\320\257Y\236\r\221\027\357\325\262v\347\336\350\024C\b\336\307\321\013\370\335\027<\324\357>\346%\363\242G\311n\001\2630M8y\367\336\252\356\362\345\235\232\230\226\210Ca\020\370\363\331\256K\376\360\271u\247\246\2613\331\013E\362\304.\375\032\263K\222\232\205>\346\213J]\372ea\243\203N\261\200U9Q\316\243\260\200M\3710J\b\004\201\005L\312\203Q\0365\346+\254\002\255Q\3725\305\032\357\275\304g\263\376\254\002-U\246\227~\211Y\343[\\\363r\274\252\357O\0301r>\235\334\002\315TB3\264\366t\362\266\022\306"
+	.string	"5izvY\001\203\262(\272\235W$O\256Z\201 \356\275\\\235O\260\363\323\231\317\314\374\305L$\022UR]\213\250\026\362\021=\321\013\376\027\206!\243\336)\343w\237S\017\360\022\306\254{|;\037\276=\222\326\371\233\2745\"\304\366a 5\301CxeS\274\313\371\311\356\032Io\235\304\034\345\252\275\205\371\366\266\026\346Z\231C\255\274\301V\326`+g\250\2251\330\312\027le\013\266r\205W\246\340T\271\252X\231\252Xy\252V>\326\312\023je\t\266r\004[Y\312V\206`+?\250\225\035\330\312\rle\006\266\362\202b\345\250\277\371\r\374\354L\340l\316\003\316\346\207z\332\031\300\325\316\305\237\375O\305\312N\305\312\303\246\312\302b\345`\2612\360\251\362\317\251\262\257\251\262\265\225\333V\256\265\362E"
+	.string	"\031[\242\344\371\265\275{\227\354Q\272q\276<b\276\347w\373\323~\265\333\027:\235\rC\215g\216\314\234\034\362\t \322\221\251~\316\306\345\2206z\237GS\205\356G\202\205l\340\271\264\307\377\360\003}P\343\221\313\033\203\306\355\311Rs$\326\307]\320\236\2546r\231W\036\300\271\341\2607,z\301\216\266f\007\315c\022s\034\326\303\035\320\241_\323\343n8\nD/\230\001BR\242\320\274\2771\013\257\233#\177\215\337v?\3033>\357\263|btxL\240\232\231k\222\373!2\200\354\336\313\241\236\333\274\210)\277~?\267j\2540\207\034\332y\347\035\207n8M\2753V6\030\321\320\0332\364\027]C\206\266rM\2753_\323;aoA\376\270v\325\"\366"
+	.ascii	"\231\243\245\2642v\030\232\353Ve\"\333V0=\263~\3675\034\347\335"
+	.ascii	"\205\306`\241+\364\005\013\025\332\326\251\315\301\261\2333Q"
+	.ascii	"%A\251\271\267=+\337\025\266/cP\275I\247\024|\222V\246lzG\241"
+	.ascii	"\371y\237\022\341\177!n\341\370\335W\3418\357\252\372\322C\262"
+	.ascii	"\022@v/\363N\276\243?:\301\377r\037\243\260\262\372\335G\241"
+	.ascii	"\357E\246\352\322\237l\256Mz\007\375J\322\312\334)\336m[\201"
+	.ascii	"\201.\356\035\2540\377\334\017\213#\231\363p72)%!\371y"
+	.string	"\221\356\356LFW\fx!?\003\235DC\324U%%\211\003\345kzW$\3205\373\365\026\256`\004\005\262\022\372v\236\242nR\323N;\350\t\215\344\330O}9\257aJ\302l\341\021\n4\241{\357\310\337\261\317v_\331\224\221/BK\220j\b\035\241\3575\306%\325\026\356A\333{n\373Ax\320\365Q}\233T\361<\032t\3056h\007\fzA7\350{\225q\325=\216j\006}\247^\320\r\327\324[z\213\3640\316\261\270\356-\034\325N=\003MPWJ%2Y\243\306\025\220\006\222\207\322h#y\025T\002\225\310!Y,\210<\256\222/\220I-,\244\b%\322\207\020\021I$\026\326\217\031\002vhe\371Hj\251\360\241Lfa-\321\330!Diw s4W\300\220\001Y\201\303\214\032TPW>\256jX\246A\245\304\272\241\274\312\201U\245\225U\265#\353JG\025\215\244\262\212\252"
+	.string	"k\361@&\253|hi%\253\210Q\346\355m-\f\202\331\\Nu\302\231\227fK5]\275\305R\220\2504\r\271\020\350aW9'\302\265\252\305*@\026\002-\354CzZ\320\323\207\tSoa{\377\342\027\354\031h\207\360\366\b\364\317nd>5\201>\233W\031\327t@\237\315\200~\233\027\231H\301*\300\016\002\273\302i\352\335EU\333P\375k\346e\233\020D+\276\346*f\325DV\247\374|"
+	.string	"\332\366\233zLA"
+	.ascii	"\372i72\237\032@\3276/G\\o\322b_\355\306\356b\327\266\332\265"
+	.ascii	"\177rx}.\351\312\236\332\2222\215\264\250\206wFJ\324\332\243"
+	.ascii	"\303\336\213\345\203\335Y\335\273\2228Q\356L\355\230u\022\024"
+	.ascii	"\252\346#\252N\272\316y\307\334\373\213\337TS\365\233a\\=\325"
+	.ascii	"\266RSo\330\204\356\3038{RC\267m\356\344\341\275?\007\206\034"
+	.ascii	"\221U[\0306\005A\235\372\024Y\003:\346\022&"
+	.string	"\352\235l\364\352-(Om\310\003\t\274\004\200\375\250q(\347\224b\246fDD\222$)4\006p\002\221)2\333\001\021\020I\251\250H\222\202B\032\003\2171\227\317\352\346y9\226\327\342\2214\221\256D\272Ya\b\002\357\333\003\2070\277|)Y\250\031iv\263$\376\272Y\263\223\272+\205\275\025w\226\200\023\"\034\"\216\242h\347\317\\\251\356\272\235\233*,Mf\311\227\370\371\222,\224\331\202\n!\344\344d\310\001C\311\314\224\036\310]\212\0359\354!\006=\022\352\256fp\"\031\235MQ\376\321\202j\213\270R\362g!q\314\222c\203\r6\007\340\227\333R\356\2313\334\030\004\370}\343\354\261\374*M8K=0\212\350\364F\353\260x\306g\250\344si\216\220\030\347\004'UL\230\301\007\274\004\212\217I<p\360\241%<3T\226\347@%\017Z\316-\255\036\002\373IkCE\240\237\250\027;\333"
+	.ascii	")!\005\"\317a#\017\333\242Et\245\303W\325H\232\254\270_'\331"
+	.ascii	"\303\245\203\310%\031\002\3634\023\276\fD\266\300i;\275vj\001"
+	.ascii	"3\035\003\t\022\202\200t,\341J\234v\241\2159\034Z\27449\037b"
+	.ascii	"\200T\033\353\n\004;\300b\316^\b\241\225&6KV\221\354^D\f|\214"
+	.ascii	"S|\005\f`\202\241&\325SZ+\231\362\026\374\305\b\357<\033\f\246"
+	.ascii	"\240\004py\376\310\330H\322\017\213\205\017\004\300ort0\177\300"
+	.ascii	"\310\257\033K\"\211\236\017\216\343\342/\273\b\342\003\304\371"
+	.ascii	"\231\016 \326\360\020#\254\200\271@I\207%EF^a\244\300g\347$\362"
+	.ascii	"\354j\362%\005\260\256S|w\204\273\001o\252\203\252v\276c\223"
+	.ascii	"0\300G\\\357\204\313\003\212\200\315m\327\315\001\215\020\033"
+	.ascii	"\312FL')\202\320\270n/\374("
+	.string	"2\306-LX6x\204\335\303\020NY\300S\\Q\030\271\262\243F\232\237\374\3608\217\013\363\265\331\350\016\224\237C\254A:"
+	.ascii	"\374q\200\365K\307)k\213v\225quE\307R\003"
+	.text
+	.section	.gnu.lto_flashfsReadAbs.57.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\t\006\275#"
+	.string	"zA<\016Ep\336M:k\016a\260\256$Y7\232\202\310\3073N\354j\205e\207\240\024\217\377\021Rb\371H\375OW\314(;\240\234S&T-L.q\177\310A\0260K\035\235U Ig\275)\337\214l#D\356\224\002\325"
+	.string	"\271"
+	.string	"\331"
+	.ascii	"dN\276v\325\347\220#\006\266Vkmp\323\035tqz;\346T\016\250A%;"
+	.ascii	"6\2347u\311\036%\276\013\326\275\330\370P\255K\336\\ \236:1\275"
+	.ascii	"\323o\271a]\255I\264 k%:\360\202\363\246m_\354Y\260\354dI\004"
+	.ascii	"\033\022\211yq\201i\253\265\366\232^\204\273Y\236\207\273\271"
+	.ascii	"N\216\365\235\356\314\341\314r)\226\377\342K,G\344|I\0333\314"
+	.ascii	"\372\016A\222.\"\327\t\361P;y<\352\350I\3225\344\271\243\375"
+	.ascii	"\020R\306Eq%\20353lG\373A\244,\362\021E\370\342\0265I\340\311"
+	.ascii	"#\034\006y\251#\353\003L\0333\f\362-\025\300I\016\t0\f\226IH"
+	.ascii	"\236\244\035y\252c\b\2444g\241\326j*\034v\335B\267\215\305v\n"
+	.ascii	"\333\234\023fH7>\347\346\366K\313\266\274\200t\220e\250qb3\203"
+	.ascii	"V\351\037\233\b\244\313\304~Yk\255\336%\366R3-\365\322R\037X"
+	.ascii	"j\245\245N\312Q\033\270\361FZ\352\243\245.\260\324FK]\264\324"
+	.ascii	"D"
+	.string	"9j\336\2177\201\223\335C\367\362\013\330}\354?\277\345\317}\3546q\324\345R\357R\323\245~\202m\203&(\206d\323\210\325\307 @\025\216yF\312\215\377\361'\373\332?\372\310\334P\r\312\215~\231\205\214u\3650^=jU\274\262\334\364\311\\\t\335\024P\244g\177\314\325\305\314(\253\020b\355\242\241\326\226\245\255Vb\203\233&q\336\2446\226_\264\220N\255g\007\313\264\333\217\345\226iw{\265\255)\276\361>\326\264tr\236\226\034'\bF\346T\332\244=\200\342hOJP\207\363\224\344\"[\030\034\271\344\r\030\355\373\031\325\223\001\244\275\321\210TFfG\321\n\322m\017\330\333\032\022\267L|*n\316\312\002{\344C\360\250\303u\\\243=Z\035G{\027\177#E+S\334\326\264L\263\002k\024fF\233\340\b\023S\026-\321\032m9gk\n\020\305\331\024m/\f\352kT\020\255R\030"
+	.ascii	"\263\344\331\274\251\301\262\313\304\247\302\3616\352\313Y\220"
+	.ascii	"\276\371G\373\236\206\352\25458\301GS\202\205\017e\006\356&o"
+	.ascii	"\211\350l\321\242\203L\315\320\020\330\037\337\244E\377xG\375"
+	.ascii	"\243\213*z!\201=\222/\340f\371\310\357\314\270\240\275\314O:"
+	.ascii	"\0015\254b\370\\T\371\250N)(\037\210\237/F\215(\335\013_\213"
+	.ascii	"\265\362MM]E\341\f!\202\004\037\004\nQR\017x\277\237\317JJ\n"
+	.ascii	"*g\025\017~S+~P-\246zU,z/X@\271\350\251\260\372\365\036\034\271"
+	.ascii	"\n\206\317\252\027\243\252\312\252'd\333D\255\227u\227\364(Z"
+	.ascii	"9\323\355\326\245y\256\351\241\255\360\245\265@;\371\0012\264"
+	.ascii	"'c\242\345\n\330\334\332\0270\320\013\207\266ik\263ln\271\264"
+	.ascii	"\214K\220\023\333\240]\337\316\357p\360\2418\203\006z\241\006"
+	.ascii	"\334M\032H\270g\311\313\3279\340\350\356\226\311-/$j{\370@/\244"
+	.ascii	"\373\373\002\276\031\321\0059~\003g\213\030\021\334,\313hC\343"
+	.ascii	"Q\333\304\tz\241\233\212\337\025\257\374p\333c\256\205\335\271"
+	.ascii	"\264/\313\035\bl\250Q@\303\240Q\244fFd\302\244$\311\001\260\""
+	.ascii	"!2\352\006\022\200\325U\306\260\231QPs\366\337g\313\217/\211"
+	.ascii	"\225\210Q\036\371&h\321t\254\337\245\262O\214\027\3133L$\234"
+	.ascii	"\200r\267\357\240\331\032a?\250\223N\273p\3372q\004OG\364\323"
+	.ascii	"\2400J#<\246\t\223\3062\001\233\271\242\"j4qT\3411\017\0253\006"
+	.ascii	"\317x\020\376(\344\370M \360Hm\r\214\201\351\033z\022%\246\352"
+	.ascii	"\360\223\345\374\234\205f\037\216;\261h3\230b\217*\002Zv\236"
+	.ascii	"#\r\234\037\201\242\017\346L\022\370\366\\*\001M\340\272\317"
+	.ascii	"\274);\005\bH@E\233\235\264\205\001l\261|\302V\307m\246\326\344"
+	.ascii	"\336\371\177\234p\320\373%>#{Ky\252B}\213\"\215 \313\3277\275"
+	.ascii	"\314k\225\306*\020\bG\321X\374\001"
+	.text
+	.section	.gnu.lto_flashfsFindStartOfFreeSpace.58.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\247\006\345)"
+	.string	"\nL\240\020J\200\330U:y2\237\355|Y@f\273\362\226I\207\037'l\317\324g\206cFZ\007{=n\265b\226H\371\003uT\350\335\0338F\342\f\307v\034\333\345\373\276}\220\236\362x\016\216%x:\204\330\266mM,!D\356$\003\377"
+	.string	"\343"
+	.string	"\364"
+	.ascii	"=6\314K)hKWR\304\030.\032!\330\253,\232-\rW5\246@\030\177\230"
+	.ascii	"\265\330\231\266\\m\372\303\254\214\025\223\266m?\260Wm4~\032"
+	.ascii	"@0:\026\214\337\321\262"
+	.string	"\275\261\3760Kc\345s\2257\324\314,\213i\257M\372a\343\002{\265f\366\303\367O\212lk\333(2`m\273\374a\004\354\325W\335\312\210\213\036b\030\231\016T]ABI\323\266K\340\3577\353\325\364\001\326\253\035$}\272<\257|\353\342q7\033[[\3254\327\267\310\207>\225!\225u-\035\035G\246\344\201to+\223\323m\005\242\230\232\316\222)w\244?*e\323\255\245\2710H\234vK\310\324A\223W\230\244\273\036\311qu\267\024\243\371\233\\B\336\224\315\361\\:\341\212\311\220\223){\244\215\305\024;\225\222\307\3557\317\301\213\030.\253g\024\223\323o\315B\333\266|\225\226\230\316\2723\363\223\231\207\314+0\3154O4\037[N\t\240M9\375\256\377\272s\372S\220k\2147\312\270\263s\275\335\275\236\035\327\360\242/\256\357\333+\224\343\023N\337\364\373\2369N!\335('\200\352\360q"
+	.ascii	"e\274i\374\002\007Y\013(\331e^A=\321\332\233\306\274<\272-\305"
+	.ascii	"\374]Z\326\0267\020f\276\374#\320\303\263\363\255\263\316\271"
+	.ascii	"\316\276\234?\371q\276\374o\004\034\353ls\255s\357[g\336\273"
+	.ascii	"\316\273{\235u\351\345\\z\031\247^\276\245\227m\352e6\275\\K"
+	.ascii	"/\257\352eU\275\234\246\227;\275|\323\3137\320S\226\345E\253"
+	.ascii	"j\254\313\226\355\215\250\232\266\213\032f\344X\277\326\277\365"
+	.ascii	"s\375]\277\327\017\366\032\263\021?\353P\316|\224K\371\2247\031"
+	.ascii	"\307n\375P\371\227\321\301\\\260GJ[\226+\031e\332V9\304^}\033"
+	.ascii	"UT;\330$WD\220_\353\017c\275\231\253\"\310\257\364\\n\323I\206"
+	.ascii	"\261\332\2640\213\006S\f\312\246\217Uk)\326aQwZU\312\371"
+	.string	"\274\327\311\264\327\031\336\374u0\235SO\264^[0\036\3538L'\324\263\214\361\246=m\333\266]w\372Z\n\336\353\235\376\361i5\203\212]\244\031<\232jKE\243\321\350\213\253\255\037\2255&\351BE<K\361\200\220\266m%0\007\337,\301c\353\003C\302\214L\347\362\211\326M^a\216\244-\305?\253A\363e*\327@\230\307\2660KK\322\2052\356\366\036\366+'vfJ\314(\336,:\323\254m\333\bWk\315\274bx\257\304\366\357\330G\214\323k\327\236\324^\373\275\326\327j\253\316#U\023_\237\353?c\332\276\376\331\321\311\256u\235\366=;>\235\013\252\204\354IMUO\272\245\230U\224O\264\213\f\302\240\220\020\013\f\304a\220x#\n\005\211R\242\211\022CB5h\bE\023\211X\f\203\302u\350A\301!\220p\303\t\022ED#pA)\202\315\f\036@\b2\2200\"hA"
+	.string	"\242\020\2108T\231\304\202\241\220\211!\020\221\020\260h\b\230b\b\b\005\220\204p\b\\0\200\213T\004\205@bQ\221\020\210[\266\277\361\232\323\346\265\316\257\177\306Fb\027i\333FU8\330_\006\353F\371\246s\375k\235\263\243\031\\\347\372\2029>\335\032\327G\2561:\257\323\267\356\263#\025\322\215\362e\216u\301\265\024[\351i^\207\346\222\233\323\234\332\b\364\216\375r\245\204\374\272>\347\324&\240u\031\262\340\320\365\275v\375.\336\275i\374?\211\026\004\315-ey\235\003)F\246\346\353\236Nr\312\356\372\2069f\243\346k\002\235|\363"
+	.string	"X\236\346\264\246k\001\235d\033O\337\313\327<}\235\307'\2441(\n\001\200\205\250A0\245\234R\006\231\221\231@\210\024\0263\006\220\002\021\252\253\035\020hX\243\264\006$\323\034\217V\202\241\344\340\211\223\336\304\335Z\252t\f|\f\2368\351r/\315C\0077\273$\372ch\346\036\01734\032\\\222,\242\276h\241N%/Z#\264\202\204eTWH\330\017\365j\022Bpnd\032\r?\211\205,\017\251\023\024\252PDB{t\230L\003%\261\357\247R\017q"
+	.string	"\207\243\025\343z\203\233\322\315\277\215\257\353\b\343WWO\n5\334\360a\342\314"
+	.string	"8J\342o\315\301\026\246\036\264\311\356\277\236ps\221]I\227\210\336\303T\354\272\366\220x\020\3664\314R7aX\371\230\374\330\354\252w\304\361\323\335\013v\t\207S\022\"\002\036\002\"\002\036\002\"hC.&\210\221@,=\346Wb,~X(\204\205j|&\307"
+	.ascii	"t\306\205\347o0\251\"r\027w\325\016\233\007\370\3475\340)\322"
+	.ascii	"\226\022\336\372{HG4\001\325>\354P5"
+	.text
+	.section	.gnu.lto_flashfsIdentifyStartOfFreeSpace.59.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`-\002\275\022"
+	.string	"\306c~I\320\322(\035bB\223\354\304\303+\266)E\006\t\240\211\253\r\0034\311\3403\254Z55l\330\332\250M\256\232Y\353\317G\266\026P.\301e\302;\020\273\031\344\032g`6\021x\002\252<\020\321\b\346\223\315H#{\313\235Rg"
+	.string	"a"
+	.string	"o"
+	.string	"udp\352\005\340\251G\3606\314\016}\030\347\201\331CsTq#\311\361\250\355z\265Vq\365\002\337\351\374\310w\272)\016;\235+a\376s\237;7K\261\323\n?\226l7\233\317\224\f!3$\0327\233\357T`4DB\300\2156\021\340\254@\372\356\222\3466\223\022%\241\326ji\273\325\334\337m\237\330\236`\313XN\3668\223\253c\177\326\315\261W:\\i\325J\247V\032\\i\024\225\376\256\273\351\224\236+\375"
+	.string	"\253\344D\313\021-\322XE<\021\251F\024G\213\353~\373>\320u\376\316\241a1\357\361\376\f\351\335\360\324Z\303S\037(&<\035P\242\201\375\030\276\317\307\230\377\310\314:b\2545\035\224z<\275\032G\022\305\f.h\032\\\324\246v\366\370\340b\246r\033\340\2128\326k\260\2406\001\016"
+	.ascii	"o\350\350;\232t\354\354\352\334"
+	.string	"\345\3736\005\250\210&\233|\235[\036\344\002\326J\203\340\317\200y\361Y\310|\247\337\222$\365\310\344\223%/\007\335\353\276\222I'\203\322\327qx\311\333\350\036\307\304lc\376\356*\236\317Q\225N`\022O\210)Hx\242\3126q\360\200e\022!\345B\311\210\007\027\f\353\245\305b\001\255R\362Z\301\360B\311\260\"\266ZD\r-(/\242\212\353%\226\034pk\003\313%\302\264Z.1\034e\237us\374\027DES\265\337\235\002\b\037\265\033\233\332pil\317]\311v\346\357\334\327\212\020\220\341\372'\237m\001E\336\366]\315l\314\316\375!j<#& 2*\244Z\0038^$ `\002!dV\036?\253(\354xA\224\320\263C\020:h\2212g\255\231\035\330q\224c\310\030T\330\b\211a\b\"\265\007`@\0206q\326H\002\217\243\212\370\234a\353\313~omI\326\261\220\035\"\354a!"
+	.ascii	"|6\303\212\233\220B\314\231+\346\336\3775\240\302\025]\020\n"
+	.text
+	.section	.gnu.lto_flashfsIsEOF.60.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`+\002\345\022"
+	.string	"\326#\200J\300\020)\0350T\322|(\243\257\221\226\300 .\270|\242f\345e\346\366Lq\222\005\354\177\020D\222E\257;ju\332kX\237\260\366\020\316\022p\021\204A\020\004\373\0246\233\255\247\n\002\020,\0170\347mO\032\331[\356\224\002l"
+	.string	"c"
+	.string	"p"
+	.string	"\032lL\t!8\365\001\361\324\275\013\bO\305\203\204\247\267c\354\227\025\230\304\330\366^\t\233\020\036\024\215\212\251Z{\343\222\270\355t\256\264\371\017\372\224\322\331\361\013\"\351dN#D\335\310\351p>[F:pA$\035\316w\032hR\362"
+	.ascii	"@73\013\354\230\b\376wY\243\303I\311rPk\265\314\351n\356\360"
+	.ascii	"\266Ol?\260\245-T9^\"\252\264\262{8\271=\366g]\036{J\273\246"
+	.ascii	"tkJ\213S\2325\245C*M\357\273\247\245wJ\377c\362\242p\374\360"
+	.ascii	"\2406\330\2536W=j\023\205q\342\276\337\276_t\237\377\363\313"
+	.ascii	"1\265\013\231\005\304\003\205\216P\255\365u\352\027\325^\247"
+	.ascii	"\001>$\260\337\363y\037\252\235\bf\326\234^\275\t7\332\242\265"
+	.ascii	"\003v@9b\303n\305dm\270\342N\032\034~p)g\301\332q\027;\322J\270"
+	.ascii	"\"\273\017\240\222\323gT"
+	.string	"\311H\261\333\363\267\204tQ~L3\262\312\367\231\345G-b\2553\f|\243\f.\276\017LxJ7\344i\350&\257,\2011\346\336\367\221\233\264\262(}\037\006\232|n\356wB\340V\306\377\335\005$r\252\322J|\002&\005.Y`\022+i\2002\201\004\2446{\211\271\310b+\242SHh*\024h\260\n*\243\214e\264\300\002s\031Sf\264\221\204\200e\027b\263\361E&\233\215\275\333g]\036\037h\211i\266\366\277C\350P\203\306\305\212\353\332\032\333\273#\267\305\331\265\337\335\323\f\341\222\376\342\304\367\261\004\230|\356\324\207\205\247_\221]\216\203~\020GKITR\001# `\002!c\310\016>\253\202&\357\321PL;l<|E!+\222Od6\314\207{\034Q,\371V\305\344\365\fC\004\251=\300\001A\334\304Y#\211<\236*\223\007\215X_\336\203o%\262\307\030~l\026\216\205"
+	.ascii	"\324\263\2349n6\007\246=\366\242\300\343\212\332\016\005"
+	.text
+	.section	.gnu.lto_flashfsInit.61.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\\\002\305\023"
+	.string	"\226\344\203J\300\322Q:\bj\341D\021*\363\001S/5\310D\034\327\375\207\320\202,(\027J K\324\305\f\375($\002\332\327K`\300\321\320L\370\354A\304\367\327\247(\f\027\227\263\257\303P\366\377(\316\024f\270\346O\b![\356\224\002o"
+	.string	"e"
+	.string	"r"
+	.string	"\341\301\361%\341\301\373:\231\315\262\314~z\371SO\200\250nf\370j\255\344\256\270\354b\b\322\2352\377\271#\3409\252\2718\222xH\031@\335\030Br\273\241&9.l\317\331L\320\302S\020\333m\347tE$\204\306dt\333\371\322\004KI&Hn5Z\200\207\005\323y\23787\332\234\242J\255\325\323v\323\271\307\333\006a{\202=s\002\353c\177\177\277\337\317\333c\323\351\025\235\036\351\264H\247C:\r\3564\375\356\336\221\225\212\252\001U-SYs~Uu\t\304\361\342\273\337\276?\364\235\3173\313\262\231\353\2747\">\024\272Z+\353\240?4\303:\030\340\204\003\373\245\017\364\240\231\013\321\320Z\242\254:2@|:_\255e\203\203V0\036ty\223\270\336T\021\002G\203\206\013\256\270\364\207\r\fZ\3535\302%q/7\202\001\327"
+	.string	"n\244\227\364\035S:d\354\372\374\256\220.\013O\2516\247\374\2355\274\3105\326Z\213\340\023\311\274\374\0264\341A\272\003\232\202f\363\347\331\313\261\373\335\017\314&\225\305\351\357b\036\346m\273\347IA\333\032\237w"
+	.string	"=\241\261\251\207$\025\265\200\252\210\217:\251\354\2226\003Ny"
+	.string	"\241\225\"\201\005\003J\311\007XL\313\365j\275\214nA\211\271d\210\255lp!_0$\007\230\025\027\331\002\213\221('~uh\301\310\230\327\013F\262\312\331i\335\036S\210Z\032\255\265VQ\300\264/\254\314\333\374\334Uh[\3633\005\205\024\256\217\037\203\207\022\035\367\274W\030\341ts\264\342\256\026\247%\\-\013\317\311\271_DQ\217%)\250\031hc\\\002\001* `\002\2311\265\r\277\2572/\036\246\302MGc4\017N\331@ap^~\226\331\301\374\024t1\223h\315d`\007P\306\220\231\202\246\356\364\340\004\314\326\021\f\bB\023\207m,Hy\236\324O\030km\211<\036 \345(\213\340\222\033\347B"
+	.ascii	"\342\231[Y\030\226\257\332\345\267\306*\030\352\232\203\267\250"
+	.ascii	"H\020{"
+	.text
+	.section	.gnu.lto_flashfsDeviceIsReady.part.0.74.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`n\001\225\016"
+	.string	"\246\232^E\020\221\223\016\374\243\273"
+	.string	")\037\025"
+	.string	"`\271\363.\006\257\241 \200\266\253p\373\277\226\263i\177\340\326(\310\026s\300\202\036b\221[\331\361\267A \020"
+	.string	"\304 \302jyz\036P\200F\353\343\326\262d\357-eJ\001L"
+	.string	"E"
+	.string	"L"
+	.string	"'\354\361Q\262\301\266=>L\314\035\345R\2624\2242\304\334\230\023\205=n\210s\217pUr>"
+	.string	"\323\311\343u\250\236\251\303\027&\250\221aC\200\t\005^%\022\336\277\253\212\251S%pi\201\3149\315\371p[\267\335\300\366\001\373\252\376\2131\220\350\275G\237D>~=*\020$]\371\337\035p\230\301a35\207\356\311+\017\347\266\330V[\253\226\253\216\253\206\253\336U?"
+	.ascii	"\202\021\003V\346,\255tL\226\230*a\377+\261;\376gbw\036\037\031"
+	.ascii	"g\316\271\300\2279\013\220\377\362\350\220\221\021\371\030\367"
+	.ascii	"R\241 \351j\341>\305D\247+\373+\036\023\222 \022\311\307]\005"
+	.ascii	"\034\265-lzO\367\036X\272=\261'\365\315\270\313M\315\314\356"
+	.ascii	"\3116'\277\020T\320@\321\033\3730Gq\001\006}6\221\b[6A\004\323"
+	.ascii	"B\030\205P&\302@\243\r\373\024\260V!d\204]\320\264\021\326\261"
+	.ascii	"\255\337\026\006*\02121\340\317IkUl[k\020\322vq\341\236R\034"
+	.ascii	"\206\001\232\032\236\024\214\334\027\331E\343\342\236M\\\270"
+	.ascii	"rwG\312\212\037\274E$ \200\002!\263\351\001\351f\fJh\220N\215"
+	.ascii	"\227\3554\016\\\264\203\244\237\200\036\2635Z\027|\tt\342Z\312"
+	.ascii	"\3603D\267\030\006\222:f`\333.o\231\216\266h\274-\bP\242\036"
+	.ascii	"f\204KC\002\253\2603\001\220\001\326FX\025\257\237^\0334\242"
+	.ascii	"{-\036\003"
+	.text
+	.section	.gnu.lto_flashfsJournalWrite.part.0.79.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`z\003u\027"
+	.string	"\266i\222J\260\022Vc\300\371\006|\007\b\375aM@.\004g\375(\334\367Vx\004\035k\373\354\3465X\006\234G\255R{\353d\376\001\325\235X\212\177\034\265y\370\362\241\364-?\003e\330\337\371\343O\317\342z\\\206p\355\357-eJ\001t"
+	.string	"\201"
+	.string	"\177"
+	.string	"TU\367\ne7-<O\3022\302\271\364\2079\237\350\227s\017\3368\326\023\336\236\364C\335\353\246\210\224\314\276\320\037:\221\356\301\233s\227\202\034q\354T\335\233\236\334\264\311y\363\367\004X7CN\302\272y\025\266s\251u6\325\205A\267\005L\352\024\257\356\275\350M\013\342\272\333Z\352\374\335\255\213\247\347u\344eK\345\336\353\323\3476o;\3056\003\333Z\005\2465\200\371~\300\251\220\352\024\304\223\036\351t\233\361\343e\344\\;w)\314w\324\023\236\030\306c\340\\{\n\363\265"
+	.ascii	"R\2417ce\313\276\337\364\0273FWM36\322g\262=\305\037}%\277\234"
+	.ascii	"\273\275\310-\236\222\213\233\2374\"\"\351vc\315\016"
+	.string	"\006\032\013\316\263\260_\306\275\310G2M\034Q\334{_\271\007m~sR\020\035`\362\344\246HRV\326\037\371\305\257\300=h\323r\237B\025\003e1\247\004/\302oX+;\322\022.\305r\336\333C\340G]p\361\205jX7\253-\tA\204S\223\256\306!{\344c8\325\207\003T\037\t\023S\377\273\275\207\037\236\335\371Lw\031S@-\375>\306\023Q'\376\224\332\361\323\203\307\255>\252\005\332\226/\357\275\327\366\203\355\252.]\325\326U]\217\274\3572\0311\240\303\275;\311\037\367\307d\"\361\341\237r\246\235w\t\346\323\251q\0333\0018\033\315\214V\233\301\234N1p`\226\222\240e\002\n\t\316F#33\355\202r{\241pc\251\360\202\326bP\231\030\026\032\352b\273\241(\005\\\2630\263\2414\265\232\r}\331\256W\301\261<k\201\266o\312{\201\024|x\220*bM\272D\272\026\310"
+	.ascii	"\216\034|\032\313\237\272\016\232/d\007+\365\277\025\326\315"
+	.ascii	"\222\034V\0026@\301ji\355\007\020\352\177\216\365\354\316>\362"
+	.ascii	"'\376\031\216\032\236\254\255\266\264\001J\250q,%\035\"D( \222"
+	.ascii	"$Z\320\352\200\002\231\272\252\007\022\200&\246\226j\302\342"
+	.ascii	"\322z\327\r@NU2\233o\347\250\022\323\317\316\331\247\330\240"
+	.ascii	"d`N@C&\\\t\201^\"\315\267\n:b\250\002\356\202\331W\276k7\021"
+	.ascii	"I\305y51\231\2454\037sZcG\245L\263\267\227\331F\033\244\374Q"
+	.ascii	"\222\301\021G8>\2308e\002\251\347\275\206d\337\262\2117Y\002"
+	.ascii	"\036\214\340\0074\304W\\\214Af\321\314%\f\026\320\263\261h\234"
+	.ascii	"\030eig\020\031\303J\273[c{\f\324,\262_\3704\017\r"
+	.text
+	.section	.gnu.lto_flashfsJournalTail.part.0.98.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"5\f"
+	.string	"F\326P@ O\225\016"
+	.string	"\366G\300\0300\251b\210\366\221\253\214}\006*N\007\276\230S\232bGQgqL\030\266al\b\210\f\231[X\232\323\001(B\200\324\tL\373\025\300jQA\301VK\366\336;\245<"
+	.string	"="
+	.string	"?"
+	.string	"v\213\207\337FV\034\0224^\273[O\245\206w\2372\322\316\207X\002\224\274\320g,y\025.\005x\244)\331\335\203\217\023\274Q\214\004N!\226\3355"
+	.string	"\0137v\333\nl\033\260\277 \224\n\310\234$\024~\246\2736\224`\275\226\024\036\260mJ\345c\356\341gB\240R\301z\355\206\325\367[\017?\007a\n\006\017\017\273\373\326\347>\b\2623\037\354\354\354\364\037l\203(\270\013qwCR\246ls\260\313{\2708H1\206\375\021\327\340\370*o\236\370\222\007;\275\314B\234\350p\002/\210\342G\224)K\372\271\022e\317\350\323\271r1\340\264k\372\230\261\031\250\t\016\"\034\306L\266L\203\355\342 S5M}\240\271l*\246\263\325I\304\032\004\006\235\032A\323:5\263\035?W\242\234 E\007\214\016\221\034YN\231:\207\371\033'\301m4\r;-\360\275\370\006\013\024+6\312\260|\032"
+	.string	"k\033C\212\200$f\206Wq \340#\322h\302\332m\330\2201\026"
+	.ascii	"\362\300\bW\f\244\026\203k\b}T\354\241\302\367\214\221\346-\235"
+	.ascii	"\266l\346\355\2640\\{E\341\322\324\224\340\326k\313\030"
+	.text
+	.section	.gnu.lto_flashfsPoll.part.0.105.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`b\001U\016"
+	.string	"6\333^D\020\217(\035\003_\252\321Z\270\300\n\"0Y\271\346=\362\300oS\277W\003\224"
+	.string	"?\376{\212]\253\t\266U\033v\237!@\276\243P\022\201"
+	.string	""
+	.string	"\250$\351>\332\030\017\001\352T'/\366f-\331D\312\224\002H"
+	.string	"K"
+	.string	"I"
+	.string	"\t\016m@sh\377\203m\223\211=;\305#k;+ J\\b\273\273\035\252\206{\207\231\246\346\371\337a\246V'\317\002\254N\256\002V\250\314\263\273\217\317\t\253S&\201k\231\215\335\265\206\302\235\271m\006\266\027\330w\005\235\347\213,\325_\033P\361\200mg\200J\356\036Y*\rX\254\025\333\215\233\357\273\376*=\204\025\303\213\nJkw7\207\276\253t?\232\354\215\037={c\323Y\272\307U\231p^\020h\276\305\031 \357,]\347+T\264H\354\306\237j\212\355N\273v\274P\240\222\205}\021\207u\276\212I#\371\324\241?\242\035^9'*\220d\214\037\177\026\214\005\023\233-RS\254\332\263\325\f\266\246\365-\177f\372\232l\245\304"
+	.string	"\224]U\214\213\275"
+	.string	"Gp\260}\027\007\306P"
+	.string	"\naht||\n\204D>D\231=>$\220\006$\016\021\220\215\023m\017D\034\0166\217\021i\373t\314A\b\2156\t\0347\3326\266\363\033$z\202\234T\265E!(\375\234\252\372\222\027!\0362"
+	.ascii	"is\021\362){N\372\3710\230\016\271\273\001  `\002\031\244\266"
+	.ascii	"\001\037K\271\021\340\002\254\035\b$\335\311\361\210\366+V\304"
+	.ascii	",R\263K}Z\317\332|\317Q8\330\260C\354\271\030*\267\221\266\255"
+	.ascii	"l\f\3315\277\204\352\347\373z\333o\351\nb\361\222<nSFN\257\266"
+	.ascii	"\236\020\306"
+	.text
+	.section	.gnu.lto_flashfsInit.part.0.120.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\211\r\255="
+	.string	"jf\214\026B@bN:o\345\320qw\345k\272\215\0171\025=\304,`(\315\337\210oL\323\214\250=\226\345\027\300\377~\264p\350\207\342\007\3759\n\325\331\t!\026\006(\346\\d]\367k\242\2615B\310\336I\006P\001B\001Z\001Unxt\267r\375\271n\033K\301\037a\2310q\355\343\tG\370v3}\270\306:\233\036\335$r\221\360\267\247\365\335\210]\334\372m_\243<\233\036\311-\350{\344\250\327\247\t\242\370\365\257\321\221\354\321\364\323t\333XW7\323\331)\210\220\254\314\373\276g\273\352\257\035\305$t\177\255\257v\350\325\317\374P\3370\350\013\346\343\217\260\f\341\373B\037|\355\006\305\257\r="
+	.string	"\366k\361H\366+\261\237\206\325\335\366\323\224\335\355\327\223\351n\254f+\273\001\0175{\227\322\bu\245!|\337\327\351k\246r\345\221\216\214\216EDnk\034*\022\331U\315\030\251\354\247\035?\347\264\364\334\234YGb\202\002V\345GuF\3070\3006f/z\316\221a\242\350\325(c\242e\n\241\200\235\335m\275\376Z\244\327\036?\306\3475\305\370\232\340\241C\001\033{\361yM&pg\342\322\f\303\304\026\200}\230\316%g\207\324"
+	.string	"\322\322\343\346\\\362UU\020\245cR\344\344R\t<\253\350y\237\020\254\252\016\002\335\004\002\360\225\205\331:\267pV\007\220\335!y^\323\211\272"
+	.ascii	"/\212\337\341\216\2118\2650F:\222\330\341}\337\376\322\312;\351"
+	.ascii	"\335g\321\335-\272]\271~1f\3403\2373<\321\312Y}\277\033\337\234"
+	.ascii	"\024\003\351@\013\007\203 9\334\217\326\020\232\346\275\230\020"
+	.ascii	"\316e\235\221\317\323\351t\332YJw\213\273\251\305\235\300\305"
+	.ascii	"\315D\204;\351\342F\340\342>\340\3426\340\342.\340\342&\320\342"
+	.ascii	"\036p\271\267\200\026\367R\213;\200\213[\311\305\r\300\305\235"
+	.ascii	"\344\342F\272\270\221\\\334G.n#\027\367\261\305]D\344\342v]\334"
+	.ascii	"\255\213\333\350\342\036rq\027]\334\304\0267{\351{uq\253C\270"
+	.ascii	"s\213\033\033q\177\003~6\270{\337\257\251\341\373d}\243\345o"
+	.ascii	"h.\330\024,`uT2\013j\366E\301\202TG\035j\366\205\341JT\332\315"
+	.ascii	"\357\035\260\315\266\240\017\272\373\252\247T\250\231\263\302"
+	.ascii	"\237\324\351\353\345n\354~\237\317\375\244\036\327\331\215\241"
+	.ascii	"\031\037\251ni\277\217\310\215!\332\367\372|\3356\326\0058\r"
+	.ascii	"\321\364\360\372yQ<\032\236man\207\307\351\364\357\214btvu\304"
+	.ascii	"\020\"\t\262\343\361:\017\363\224\246(\276\256\253\036\327\237"
+	.ascii	"\243\341\031\327\215u\272)\347\331\372\324\265~$\020\361\345"
+	.ascii	"\364\341<N\325\351\246T\350\353<\262\211\201\360\265I\024\277"
+	.ascii	"&\325#\3317\001i\370L\245\234\024\222\263:)#3\200\374?\256?Z"
+	.ascii	"x\252\226\2249\364\231q\222\304\203\032\307\024\024C\346\306"
+	.ascii	"`\370\310T\377J\177\b\201\317\f\301~5p\026\326\337;\312\3436"
+	.ascii	"\237\220\220\004\311\224\264F\371\230\217D`#OF#p\221\247c\321"
+	.ascii	"\273\026\305X\264\327.0\363\305S\021Q\376\336\036\021_\236\244"
+	.ascii	"`t\314\320\347\244n>\334U0x\206hdik{^h\212\271\254\277\305\316"
+	.ascii	"\035\326\230\337w\025^{\272\346\326\241\334f\"mV3\321 \266\273"
+	.ascii	"\276\364\207\373\277\264\371\201\026\006.\211\\\306\254tf\227"
+	.ascii	"\341y\210\205-fb\036\312\352\036\027\232\226\b\274U\314N#\360"
+	.ascii	"\262\0041\0278s\355\350\034\200\351\323f%<\233e\260I\333\005"
+	.ascii	"~\247V'~\260_\331\234\204\355\340\344\255\371\322'\227\230\220"
+	.ascii	"t\315\177\366\335h\247\246\347\305>\2736\205\203\335(\0167U|"
+	.ascii	"\337\367\202\232\027\364]z\310$\277\365\346\374\025RsYG\2619"
+	.ascii	"\343)l{\002\340\307\035NE\221\331\275\202\005>3\3473y\262\225"
+	.ascii	"\263:\037ga\222Es.\353\376\013\026\347\261\257\2743\203zw\266"
+	.ascii	"\360\240\276_\273\270\240\027\305\367\335\272\320\017\004\004"
+	.ascii	"F\377\n\016\366+\316\n\316\314,\361\264\215p?UUPTOO1\210VPU4"
+	.string	"hH\261WTV:\240\326\236P\301\002\324\004\f2\236\" \257\250\254\240\242\244\240j\024{F\204*\0326\252b\344\240\341$u\303I\307\215\030QN3\250\252\234\",\265\324\016(*'+))*\247\266\273\361\3257K\351\247\375C\016\323\242\313\254\205\324C}_(\034\376\366\007\256\335y\220\261\350\362r\216V\030\270T\337\367}\217\216\007\362\347\212\fd\004v\177]\223\227\246.X\354\trS2'`\332b\347\316\256\256n\016S\276\234'\223\231)\377\257\3530\002\356V\226)\251\3403\223\371\n\f\002,^\020X\311tLA\271\223u\r6\013\003\227Fg\007\374\366\25449\026\310\004\262\001\021\230\212\211\002#p\231\t\002\327\262\306'-\032 \327.p\024\023\003\004\344\313\311\t\230\2133\3226\330,\024\314cf`K\242\026)\237\317x\224\275\b\325\212t\315\025\335\214\314D\360\376\350\215j"
+	.string	"\241=9\303i\230\202K\271\261\023L\246\324bE\211E\211\205\375\232\377\230\202\323+\265\260\001\362R~W\230R\016\220\325B]\207\330-\211R\023\345\226\244\2761\275\033\333\246y/\376Qk\203\247C\016\003\334\217*\275(\301\3403;\031\375\315"
+	.ascii	"\341\340y\3135\030X8\250\224\177\247\tw+\311(\003\201\034\250"
+	.ascii	"q8\304\034S\204FdD\222\202$\351\241\005\204\030'\341\331\006"
+	.ascii	"\022\240\263\301\026\224\214\211\214\214\224\024\024\244\326"
+	.ascii	"pv)\215["
+	.string	"\321\325\372<>\222\3373\"c\022\257\321\325\3063@M\016\367.2|\271\325\f\243u%\2423\233vv\263\337\357UKJ\325\255\244\2553\3519\016M\241\213g\242\026YGs\2745\216c\354\360\230\261*sc\342\312$r\316FT\302Q\271\025\005\317\020\364\022\242\34376\230&\"\246\031%\245\2265\247\304\230>\216\360\222y\220bHO*\357\324=8\310_t\305\024=\345(\20304\355\n\332|J\274r\357\206\217O\340\244\1778O~\366\021c\245\277\005\366hG\231\234@\024\210\337r\373\246}>\3066\3342\374\236\013\260`fx\232u\254K\177\005\206hC`\355\252\302\b\006\"\251!\200\231\267\t\036k\022\361\332\310\004\371\257a\2433\270us\027\212\313\221\325kr\235\3703\fm\005c8J\026!Y\245\372\210gn\260\215\\\330a\204\327DD\220\242\036\216Z\\?\r\235\031<\231\302"
+	.string	"\256r:\353\373m\"\022\324z\\zD\333\\=\321$\273K\315\255Xf6\325\264\353\231\243\336S\351!\317\307\301r\203_\322\246\032\226\301\324\212\304\024xL;k\257"
+	.ascii	"2\314\251m\302bJ\027\253\274&l7\247\031Rf\b\203\"\r\245\ra\267"
+	.ascii	"\226b \222A\231LA\f\355\304\226\336\374\372l(\305\325h\250\240"
+	.ascii	"j|\336\267\261\016bG\326\"S\221\262\333 \034\251l\364N\366KI"
+	.ascii	"\226\rq\2520k\226\334\222\351\227Pg;\275\350\035\025\232\222"
+	.ascii	"\352\314\361\034t\3231i\250XB\002\273\007\240\213\243\317\200"
+	.ascii	"\314\222\306\211C\250\224J\243\371\245\007\316\374\302\301F\370"
+	.ascii	"\372\253\226\261C^\265\321\330\362,\224\223\260\226\021\034\301"
+	.ascii	"\025\001\254\357\365))\016VG\207\033\002\364I\272|[=\260D\024"
+	.ascii	"\203xi"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\\\b\255!"
+	.string	"\226u\304Gp\334m:\265\213\222eU\026Q\244\315\227\n\275\247\004\324\336\326\242\270J\267\210E\244P\023\345_J\317\356\203\263\354\324yb\001\177\001\374%\210\201\304\262\222\024\033\347`\370Q\316\032\262\201\02383\274\325\260\215OM\356\273"
+	.string	"\257"
+	.string	"\257"
+	.string	"\0342\326\206\214\367h\310\t2d*\f\031\275\220\247\306>o\312X\310P\025\362\025\205\\5!GI\310g\204\274\005!k=\310V\016\262\324W\0366\310B\257l2\310O\013\262\223\202\034\354\312M\\\231\t\257=Y\033\333\312\007F\255\2344f\345F5%K\220\177+V\306r\326\253\214\211\243U^\302Ue$\252\214\303(\241\031s\031\247\204\200\254\210i\236H\345\002#\331\347\f-*g\235\002\206: \004AG8("
+	.string	"\302\334\033\315\241'\362\305b\261\350\224\r\214A\"`"
+	.ascii	"\240c\334k\332\264\003\302\030\343RUM\253`\2341\006\363\243o"
+	.ascii	"i\232\246LYi\304\030\007\b\021\357\275V\274\363\326\036\307\350"
+	.ascii	"i"
+	.string	"\023\206\362\216k\273\243\360@\302\206\210Gt\334K\364f\253\206\036\343\355\240\035kVP\362`n\217g\352\250qrE\236\307\366\335\314i\271\\\221\327\261\275\242d\257E\312\260\\\355N\276\271\367k\225\373\213\025\214m\334%\355\207\031\364v\002/z{\311v\023\361\021\346\204\352v\222\355q\335\203\026\247\352v\364v\335\333\335\244\355\216\030\024\277W|\025\031\253\245\310X\013\212\214\321Nd\234f\"\343\266X\"w\221\310\330\035\221\361\026\021\031\237\025Cd\005 2\316\322i\232b\234\364!c\263\3066<\334:d\2561\335kn\\\371R\024<NM2\024|\273Y\301{\001\203O\"\266R{\245H\016\370\037\261q{\206\206\314\020\360?\266\361\013\247\213\222,\340K\265G*db\3644\001\233\256\023\33311\275\211=\016Xz/\375\353\207\"]H\355n\013+\252a\337s\276w;\344\313\362\245\261\341"
+	.ascii	"Bu\364/\364\350\344\332#\237\025\r\237*\243\316\321g\211\216"
+	.ascii	"\236\221\321so\357_\275\267\030\257\3508\265m\334\212\336\342"
+	.ascii	"\205\202U~\205\030\257<\330\333/\023\202\343\017Vy\337\333\274"
+	.ascii	"\035"
+	.string	"\256\026\264<\317\035C\313\353V\264|\263hy\026\375-G\3303TeX\327\236RR\247\321\002\243>\203\355\2512lB\272\242\016\303\355\212zR\333\255\332I\215\230Qo\366<N%\317\347\\\364\274\320\333Jy\330\220\241\347}\273\363Hmc7lt\374\b\317\257`\321\363/Z\246\3630\210}#M\202\250\302\363>wx\002\354\360\275w\370\236\330\360A\303\267\213\016\021\334K\b\365\036\321\024\276\206;E\313\274\f\267\373\005Cfl\313\274\213\265wL|\264m\231\377\275\375T\346E\n\227\371\237\332;63<\245\371\036\261\205w\314\324\232\314\223+\226\371\234\n|:O\355\017\031\323\003\017\320\35195\200\216\250a\024\210\303L\211\210\004IZ\222B\007\300\002\231)\332:\021\200\fg\031!\022\214\0042\023\310\206\016(9\377nA\024 \332\206\023\323\376\3218\243\273\363\2010\355\256e'F\226\345\344"
+	.ascii	"\232At\340\312\267\030\344\363\024\020J\027\301Y\037GzVJ\333"
+	.ascii	"MB\246\224t\007+\245\223Xm\345*A\247\341Q\230\r\334\\\227\320"
+	.ascii	"\370\232ZiR\256\230+\364(TW\3026\36131\337\256G\257\211\204A"
+	.ascii	"\001uz4\037i\032\210F\322$\025\013\013~)l&)\261\rYL\372\033\277"
+	.ascii	"\216\373n\f\023P\006\227\364\306\210r\222~\251\263\244\250\226"
+	.ascii	"\265^\255%\305ji6\352\275J\245j\247\315\006\322C\321\313\032"
+	.ascii	"\320\026U\007\231A\263\315n~\362\254Oa&\273j\030\324\216R\371"
+	.ascii	"\254\005c\317\0255\255B\253)j\320+e\236|e\253\037\016\002\236"
+	.ascii	"\254xy\320K\367\366\241c\311\364\005^\377\374j\313\256\013#\300"
+	.ascii	",\032\002\217\331\035\253\2305Z|\233\"5\202\206\204\240\235^"
+	.ascii	"\f\211ec\262\324"
+	.text
+	.section	.gnu.lto_.refs.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\244\001\205\r"
+	.string	"\006d];Pi\223t0\213$&<\340I\272\\o#\246\252\252\214\231\251\210\252\252\252\252B\300\r\235\227\300\260\377\210\370\031\3224\376\347\021\372c\223Y\374\377\240\217Hk\2044\322\032\3312\005K"
+	.string	"H"
+	.string	"N"
+	.string	"\323\353\355=\233>\251\037\242\267"
+	.string	"\373\001XH^\361\272\346=\305\353\230\367\027\252KL\275j}\322z\244=\225\335\345\263\374\310\345\253-A\376C\302\372#\260>\204v\005\375\213\366M_\323\257\242\247@\324\325\372J~\244\277>\033\004\355\017\261C\262\2254\005\353\030\330/\253K\264O\255\273\330\245lE:\331\224\016\261\336\034\"\337\243\177\307\3729\332=\375\211\376\353\273v\251O\334\037\3267V\327\350{`\347\300'"
+	.string	"_\322\207\371\r.q;\300F\372\243z\371\026\252\026\356)\366(\366\025\337\254/\261[\\\257\332\263x\201\350\037\304\337A\373\017\353\254\347\344[\264\276\211\337\342C\355\n\352H>\240W\316\270\200\365$\317\254\243\367\371\306\344\3712@\217\332C\361\211<\242[:"
+	.string	"\326#\242^Y\035\"\277\206\f\024><:b\276\306\345\031\227\031\324ch\375\013\261_a\302j\237\243\365\005\261'\310\336Y\035\243\365L{\242v:l\035\022\373\224\035\3129\320\257u\nc\235\321\272'>\305\345\022\227\027\3542\310\376\206|\004\371\006\326\177\3627Z\327\210\237\t\024"
+	.ascii	" \244%n\252`?D\b\242\002O\r\310\317\250\246!\332y\220\260]\354"
+	.ascii	"\260\302\037\024\327,\260d\233%h\303\212Y\003E\017\301T\3758"
+	.ascii	"\025\201\t\264\226@\3040\357"
+	.text
+	.section	.gnu.lto_.decls.3e02a91ae838c797,"e",@progbits
+	.string	"(\265/\375`\f9m\340"
+	.ascii	":>\311FU JQ9\351\0248\217\206\341\357\217\025%\334\262g\367\377"
+	.ascii	"'\374#\214s\325\363\016\320\\aa\033S\035[\177\322\350]\016@\267"
+	.ascii	"\240vw\246\360\376\247\306\32347\234\362&\f\003\033\373t\337"
+	.ascii	"\3634\367\256%\r1\363\376r\214g\017\242\376\266\353\241Z\334"
+	.ascii	"[\312\024\251\003J\004\223\004K\224\264\345\276\241\363\231\f"
+	.ascii	"@\247T\364\372\220`\004"
+	.string	"\bX\333\332Te\370rnT9\235\304\362\334@\274\320\266\305bx\f\2271\037\357\235\303\360\023\346\275\367\034\345c=>\0332\243\032L\201\342\341uo\224\003\016\2028\350\211V\245-\245V\310f\322\363]z\276\222\236\331\360\356\202arWhm\371\256\331\216\301\234\357\370\313?\204\270\220y\305\356\215\362\235\2757\2119\203!s\0069V\262\222\306\200\366l\346\245\016\312\310\331\030\\\220\356H\025\246.\035z\330\340)y\265\375\231\013o\251vV\210l\265\245\213\006\001\3258\201S\327\366\334$=\b*\374&\346U&\252\306S\270n\210\003\260\204\225\271\227\354\374\304\n\237\ru\356\265\202\222\306r\354\306o\303\234{\241`[,\366\017\235\3458\n\237\005\200\351^+*\037\253-5\234\370\335\033=_\3419\306\302Z\270\214\345\030\356\\\205\343n\243\367\262\335{9\b\032\352\251\331\240\022\33233\345\313\023"
+	.string	"\177\224\351\215n\033\201\2236\326\366\032Hy\215\331\270\214\003\267\235\3218\3559I\321h\224\347\215*\rG\333\247H\317\034\200\365\357\2179"
+	.string	"\017\201\364\207'"
+	.string	"6g"
+	.string	"\262\024\036\343\262\016lv\206\302\321\3530\243\227\354\336\250\217\016\336\031\037hmoB*\024\372\237\301\352\206xOz\356"
+	.string	"\364\341\016\300w\272\201'"
+	.string	"\332:\236"
+	.string	"\370\263\223\237\303X\214Cm\332\200^\264{\243\030Rf\2255\261\266\217\362\004\300\2243"
+	.string	"\377^\241'\220\201>\321\205\354\036\376\3124\002\t\246\267\270\275\240\202\341\357\263\237\225cKV#~\346V\341\031\376j\377\237i\t\374\234\363\337M\212\232"
+	.string	"\016\337\360\327e\247\320$N\030q\360\363\001^\200\277\346\260\300\t\240\377\374U\001f\315\312\302\320}\376\032\303\r\205\232\244G\3108\321'\374<\200\237\013p\013\376Z4v\251\323\362\363\t=\002V\213\320v)0@F\b5\005\341_A\214\351\020f:\300\267?\330\240AT\342\307\\@\347\257\036\332\003\003\334\310\371\353\0052\204v\376\212\341\375\327\236\341_u\024\320\035\254\370\233\203\n\376Z\3518\274\347o8.\330\256\r\320"
+	.string	"\263c\360\267\025\216@w q\002\374\335\204d\202Dk\320\031l\320\033\316\250\230\223\321"
+	.string	"\274\306\340\002\370;\fw\351"
+	.string	"l\320"
+	.string	"\370"
+	.ascii	"\376\0163q,C\037a\017\267\350\nT\310M\351\240\326\360\267\004"
+	.ascii	"\r\364\016\177\273\375\017\363\237\257\205\315\363s\225\336\371"
+	.ascii	"9K\353\\\320)\320\377\r:\370\f\376\236\372;\347g3?\223\371y\357"
+	.ascii	"g\275\237\361~\276\373\271\356\347\271\237\343~\246\3623\333"
+	.ascii	"\317c?\253\375L\366s\364g\260\237\233\374\314\365\263\222\237"
+	.ascii	"\217\374\\\344\347\017\374\034\344g\253\237\241?\373\370\371"
+	.ascii	"\350\347\035?G\375\214\343\347\033?7\177\246\3613\363\347\345"
+	.ascii	"\317\"\370\031\351g\031?\307\370\031\371\263\361\347\016\374"
+	.ascii	"\354\342\347\027?\027\375\254\342g\r\374\334?S\340\347\024?\257"
+	.ascii	"\360\363\211\237S\370\331\304\317$~\036\361s\t?7\340g\006\374"
+	.ascii	"L\302\317\022\374\f\364\263\b\377\335~N\300\377.?\207\370\337"
+	.ascii	"\366\237\356\347\017~\006\361\363\206\377m~\036\372\237\342\277"
+	.ascii	"\331\177\273\237\021\360s\007?o\3603\001~\316\340g\f~\016\372"
+	.ascii	"Y\303\317\024\374<\301\317\031~\006\376'\363\037\314\377\272"
+	.ascii	"\377\\\376o\371/\366\177\305\177-\3779\374\375\375\375\375>\036"
+	.ascii	"\374)\006\277\006Z\0014\312\244\007\312\245?Ez\257\367:\257\206"
+	.ascii	"\241\213\212\363\002F\001\323z`:\017\303\234\020^\353\341u^\272"
+	.ascii	"\304\312\313\371\302\245\245\326\366\300\254\364@\250\364^\332"
+	.ascii	"\316K\213\001\357\345(\364\311\371s\367\245\355\276\264X\272"
+	.ascii	"dz\312\201\223>\307K\232\323C\350\335\245\313\316\225\233\225"
+	.ascii	"\364\207\f\026,\275e\t\254\351\336[v\232\366\324f\264\226.'h"
+	.ascii	"\222\226\271\266+\2456\250\340\322\355\273\3216K7\355<\227\232"
+	.ascii	"j\332>GJj\211\b\275\345\312Z\256\301\202\242w\351\243\344#\247"
+	.ascii	"+\265Kqq<\260RK%\364\206\203k\257)gZ\315\b\365\024\356\267\262"
+	.ascii	"~\343\267\216^'\320\225S\316\214\364\314o@\240(kk\335\206\245"
+	.ascii	"\305\366n\263\203\202\247g\373\322\034!B|\307\235V\326i|\307"
+	.ascii	"JX\300\244\026\212\320\373\354\254\275\264l\225\364g\311\330"
+	.ascii	"X\227\031\231j\262w\331\307X\"br\204\271\023\326\200\252B\365"
+	.ascii	"$\315Q\022%\n\227\2508/[$\255o\230\230\370\254\304\265WRQq^\226"
+	.ascii	"K\250\235p7\313\272\311g6z\237;WF\242\035\234\371\f\370\263\326"
+	.ascii	"a\035\326b\351\275w\031\275OA\246\277\247y\213\335\351$Y"
+	.string	"re\243\355-T\332_AB*B\272\306\342\244\335%L\3221\305K\2324J&\201T\327\r&\354\246\355\266\330Pj[\265\b\275\227\224\365\222\246*\021\275\313\023l\234\316\016^\357\322F\322[\\v+\235\204\211\\Y\022\241KA\020\274\025\255\254\235\275,d\232\262\316,\273T\374\216\030\261XZjXm\337F\376&\322E\230<P\276\340\\i\313AhC\357!>\365M\216\306\033!A\204g\226(y\n\242\241\235\202\3445\261\200\344\331\261]i\373\006\322U\302\036\027\262\234\254\265\3750\364\276\362\212\253bcU\005\214\263#\312XW5\264\206\0234nQ\341\323\223\021\350\217\246\242\300\224\230\246\372\273G\373`\346\210}E\271\322v\303\275\234\001\330<\206\336S<5\350\220\210i[\377v\\\340\023\325\341\004\244\245\316\322\306\3245E=\207~d\326\254t\344`\255\033\346Kc\365Iqj\034."
+	.string	"\341\2009\353k\013u\321,\355\230\322\366\325,}jg;\365\r.\353g7\261\2115\325\236\330X\253\361s\231Wh[\367F\373\331L\367\031\034K\213\212\013\032\336\320\3531\267c_\243\351k\221\364\025H\372*\225\2766\245\177/53\r\277\t\201\306\345\035@\302\342\224\001\361\0175\223\3150\032\256C\273IJ:\204\375\335;\243i\264R3_A\315\tf\021b8\034\347\374W\306\177\235\304Rw\331G\2000,Qq~W\312\271|'\375\037B\360\231\360\336"
+	.string	"\264\021\276\247\224\266}u\354x\354\345\265}\032>\003ryz\323F\356\f\274I\316{/TN\364:\225\204\347\034\346\016\177\017W\326\340\277\275\367\177="
+	.ascii	"\232{\217p\241I\227\270%M\265\275\016\270K/f\322\023\303\215"
+	.ascii	"^g\223\314j\331,\373\362\304\020\275U\032.\031\220\333\214Z="
+	.ascii	"-\364\366\215^\276L\253\347\007\232Q\250\263\031\205.\177.\023"
+	.ascii	"\272\2747\372\374i\242%-\271If\365l\222A\237\030.\363./YRU\312"
+	.ascii	"\204>\233t\320\347O\223,\351\331dZ=1\b\341\"\022\247F\230\325"
+	.ascii	"\024~6\231\367\206S\217$\347O]3\n\275z\3672\032\215\353\324\340"
+	.ascii	"\336\036P\247^R\024\277)\325\335PbK\202r\364\336[\201\223\322"
+	.ascii	"\025\3642\353\232\\\320{\271\224^\\\247\017\226\321"
+	.ascii	"\272K\204\353\226@z"
+	.string	"\\\0334\356\265\300\351\336%\337\272{\357\362\336\033t\366\210\336\313\343\247\271\345\344t\257T\220\323\355\261\244B\343\336F\333{{6\311\256\240CT\314\310\266\356Rt\311[W\317\312\231\222-\243\\\033\367^>\223n=]\350k{~\343\206\003\025\212m\214I[\366c6\\v\001\267\251K)W\254'\316W\0347m\337D\322\377\361\005@V3t^\003\214\303\246\t\255\255\317UzFs>k\350\275\032\200]V\002K\335&5\244\221\346|9\363\272\346\214\235Q\355\204w)\345>\005\327\276\310<\361\273M\251\016\303&2VXqng\3342?\2048\2371\210\231Y[\253t&r\306\254\271\264II\304\260\305\311K\355E\200\2176Uo\376\206|\311b\322\266+\234\363\265\023\034\023\037m\353\233\223a\2132\244G\333\247\251n*\227+;\277\312\206\313\256\245\266\371\020n)MK]\372\021\360\265"
+	.ascii	"k\232W5pTXVX\322\277\242\371u\202jxS[U\322\367\260\245\300!f"
+	.ascii	"\314t\033\332\326\220*+Y\\)\360\206\0301\225"
+	.string	"\314+\363R\245m\t\351\304\250y\031\363JfL\017\016\246\026\276\236\035)\260Y\245\250\3206%H\333\367\334\024\250\247\247\327bDt\332\246\334\334\314\244\301*<\274\316\213\002\004\003\025&\313\\\n\364\372\362\245\336\005A\353\013f\236py1\261\301\343\315\356\365.MY\335\023\2634\307\t\035]\255\343\237\250\322\036[\231.*\2658]^\353\204On\226\324\332V.|f\271\302\300\322\332\326-\315\244\307)I\322\031\223\0248EN\256\316y\341\3512%\255+\313\353\\\n\246\017\017\013\237u\335\023\007\264m\275\322U=\177m\376\310\204Vi0G\225*5.\bZ\355\252\276PaI\243\226|1\305\265\227\030\271\2777m/\274)\020\r\025*\335\306gI\264\232Lx|i\220)4\345S\252\033K\271O>a\252\236p\371\335+\325Ahc\252\206\022\267(5}^\272\322\306\023ze\253l|\346"
+	.ascii	"\264\233\364\354\220\345\tF\347w\235X:\300\220U\327\325\366<"
+	.ascii	"4R\2356ffUM+*\316\253\272!\263Z\222\366\2526f\b\345\255M]\333"
+	.ascii	"\212\326U\035$+HW\333z\326\301\022\251a\325\334aS\245T\262*\245"
+	.ascii	"\323\004\205\324\261J"
+	.string	"V\307:\215\0237Qq~>\240:\370\322\357\314\245:_bb5\032F\025\025\347\307\363\325&\344\t\312k\324J\224)JS\333\372\204\317\346\332\374\320\322\266:i&<7\312\315T\007\237\032fj\224\326R\236)^\367\252`|\257\326\326\260\314\334\232\263\257W0V\273RG\224\274\300U\265$\226\362\3405\251]M\272\215\257\363^)\022\272~lY+L'lY)O\034\256W\256N\223\336?5_T~=\322\236\266\252U\265\252\222\035$~5\311\253\022\236\273\2643g\332\326\255\266r~y\231\265\255HZjG\211\217H\323\255\330\034T\302v\232\351\316\233#G\272M\004\247\276\262&3iR\236&C\206\324\"A]hQq~:QLo\362*\221\327\"9ap\321(v\223s\245F\214\333]*\264\003\002\244\006\001\321\205\2218\251h\301z\r\322lU~t\301\245\301(VVu\271"
+	.string	"1u4\252\360\225\245\301\266\037?*T\002'tQq~\335\226\243\315\032\250\225:3[\232\260R\036\034SS\325G\232\2001V\211G\037]\217W\037\315$\350e\215\211\246\245(pgD\347\231\366H\325\035uGe\226"
+	.string	"\221\026\025\3475D\242eMZ\333\353\334t\350D\207\216\032\005d\346\226Vf\211\220+[Q{]uH\362\322a\232\323Yq\270=y\225\tz\221=aj[q\270P\233\360i\271\271"
+	.ascii	"\305\303\204\007\023\260g\177\371P\005\311S\363\344=\241\331"
+	.ascii	"\033\027\032\270t8W\3435\352\215\336\nNy\032R\306\303\237_\222"
+	.ascii	"\033\325I\357\214\324\221\352Tm\3549\241\242h`]\236\265\211\341"
+	.ascii	"\322#e/l"
+	.string	"\201\222\016\361\232\225\251Y\231%\246\266\304\232\272\254A\323a\037\215\272D\343\347*\221i\332\272R=:\f\261\326|0i\373\224F\352\323\244TgT\245\312L\227\300\266-[\236M\035m\317<\223\262&\255\271&\365\311\252\267\336\272\314\202\022\025\347\347\304\211\236UU#G\365F/\365Qs\343\246\343\360\325\210\212\363\022F\371\333\342\322\266\343\b\265p \261\322\266\337\004\345\322\03796l:\r\247\315E\305\371\361\223\251\245\216,\255xk\3268\005\277\322\237-h\320t\232\027\276t\270t\351\261\327\366iz\276@\275p\255\312t_\231.[3\323}f\272,\004\224\2508\257\235\266&Z\\\332>\250#}PIL\217\021#\224\302\327c\370\202\230\354Iu\360\231\021\227#\311$\261\250\210\b\250\201\r\030\030\332\200\0066`\300\203\r\354$\211\224D'(\211$\220\2240\216F$MH\200$\"\032\211"
+	.ascii	"bAL\262\240,\036%\215D\310\024\177!\2244**cx0\036\217\216\216"
+	.ascii	"E\037@\3008*\312!*\221BID\2414\026\253\322\030\343(\342\001\""
+	.ascii	"\214&\210EF\242\026X\224\360\027B.\214E\2442\351\201\310\"\206"
+	.ascii	"Q\221\261\350\001\231\214\341\201\002#\243\030F\343\321\030T"
+	.ascii	"\252 \206\240\230\004\3128\"_(\217\306`\013\"\242\221E\202Qt"
+	.ascii	"D<\002\032\213.\210&h\260\340E\262h,\242\020\204T\034R\200\204"
+	.ascii	"<\242\240,\022\311\310\220dADD\252\370\261 yD\026\025\217\200"
+	.ascii	"*4p\241\002\204!\030!>\034\001\375\205P\004R\230@\341AIt\201"
+	.ascii	"$Rn\360@\321\321H\004\021y\024qDT&\221P\370(\213F\023\311\025"
+	.ascii	"%\030\021W\030&W\224\340\001\"\021E\221\021\tE\262xtt\024\241"
+	.ascii	"D\372y\221\214a\204\002\n*"
+	.string	"\214\020\"\265(*\215D\026&\004@l\001IL\022W &[\264P\341\347\205\222EQ\006\013#\221\tAJ\"\t\f\224D\022J\"\211!\321\205\221h\205\"#R\262\004\f,\210\210%\220\214\210J\242\021\214\243\243\b\nx\214\216'\200*8\246\200\301B\006\013<\020R\"\211`\b\021\213\212-\020OP\036\215P\360\310\330qa,\036\025S`\200!\201Q\221(\305\212\235#\"\244\213#\362\004\321\005\321\t $%\262x\202\320\250\2504\262\320\242\305\221\205\321\261\004\006b\fcQi<\212\220\240\003\031\220X\020\021WH\2320:\036O\214H\266\320\240T\252P\246Hb\213\0261L\370\t*=PD|Q\224c\034aDdD\3068>`\202\242\242\013\242\243\034\243\"\221\222'\231$\"Y\260(\201\230$B\022\205/\"\026\021\301@A$\"Qh\241\202\022I\244D\301\302XD!\331\002"
+	.string	"/*\"\211F\242\213\364\037\200\200"
+	.string	"\020B"
+	.string	"A\360!\214\340\301\b\036"
+	.string	"\037\302\bCC#\2000\224\036\204\241\252T\021B0'\2514\026\355_\004%U$\225DJ\024D%\322\n\241\221\250T\026\221\025H\n\223,\020\217\212)\220\2221V\354\030\035\217&\250\310Q\376\205P\022Il\241\210d\001\200\037a\020\221\036\224\307#\322\003\217\021\221\362\250\324I\252@B*\211GG\"\t\237d\020\005\222x\"9T\252"
+	.ascii	"a\210\350\202\bF\252T\361\001\204\322X\214\221~\350"
+	.ascii	"\203\020\304\241\020V\260\020\312p\021D\020\261\201\005\t\220"
+	.ascii	"H\213\204\222-^$\211\214Zx8\026=\030\213DG\036\212\220I\017B"
+	.ascii	"\032\210!(\242@\036\225E\304\344\316\255,\321\3108\301U\350\007"
+	.ascii	"\334\340\366\250lacBa\262o\235T]\370B2f\335\370\315\336\027\026"
+	.ascii	"\333v;\305\247OG\325T[\273f\331\272\266\324^(;\337\230%b\340"
+	.ascii	"\236\264\265iVm\310VZ\225\266/\343\364\343\362\333C\2633n\204"
+	.ascii	"\271\t\322\326\254*\321Q\342\305\210\221\266=@\304l\231\230%"
+	.ascii	"\343k\346\203%C\236\334\222\335\216}\b\3611@\260\266\244*Q\254"
+	.ascii	"\2246,#?R\251\205b\243U\207\226T\322\217\023\207\2367~oFv\266"
+	.ascii	"\334\034\321jk\235\264U:d\317)G_X\227\365\221(\276\037`A|\256"
+	.ascii	"\r\037\314\266\031\224\272\354W\227\365*\241\304\267\343\367"
+	.ascii	"\254;\263\245I%\023\206\t.\3162\251\313,06\317\266\031\236\224"
+	.ascii	"X.%v\211\236Z\022\273UEH\221\265\266Q\346P\bX\022/m\207q\262"
+	.ascii	",\022\233e\265J,\263\226\260\272Pm\035i1\023\372l`\265\215\016"
+	.ascii	"\201M\216,Q)r\247\007\305\262A\244\215L\f\0338m3D\001\261C,\020"
+	.ascii	"+\204\235N\022\272\250\264\231\363\273R8\202\334\ni%\315L\223"
+	.ascii	"Jkk\261|\236"
+	.string	"R(\2252Vi\340hq\361k\013\324\004j\253\240-6\203\rN\n\304Ge\177P]\301\311\363Q\353\244\250\262\\ik\247\242C.yxzv<:\317\246\355\030r\265\303-K\217\264\266@N\035VJ\207}a\313F\275\031\211B\243j-\005\232\2628l\016\213\243F\201\231\333b\222b(s\303\272`oX\250\022K\2541\366y\013U\221\234qr\263N\255\2765qN\373\324\302R\323\022>\002\0077\254J\177\353\004\226\346i\311Q\303F{\361\320Iy#\327\024\307z@\276\232j\3249\2501\271+\313\304oQ3\334\254\265\005\272b\227l\323\006\205G\250\203T\343D\327\225\212)\245fDF\222\024\322\001\303\024@0H8*\236\017\327e\017\023\200R\007T\332\224\204\251\241\032\231\221\202$\365\031\306\004\202\311\210\347--23\375>e\220\017\265\336\316#_\301\216\\\321\017w/\210\264\021"
+	.string	"\321\341IS5\303\226\213\317\375\337\034z&\020\366\314)\305\337w\300\235\234\214K\353X\263\360\211\245deUeq\027+\370X\307\256\002\315\321\340\224\370\n\326\303\275\341x\024\204O"
+	.string	"\326\227\321H\233>\257\354\001m&._\377\317\236\340\355I\304'\234=\330\336j\031\320\324~\031%\223%\326%$\227\226\343\325\314y\377\247|<\364\020\344\274\271\031/\325yD\231\377"
+	.ascii	"\200\277\367V\207i\rX\322\033`\030\214\300\317\336<\243R\374"
+	.ascii	"<=\376\313\nZ\236\251h\232RA53b\357\317bA`:Y\257\276\252\264"
+	.ascii	"\301\215\234I\270H\254\204\206}\353\273r\031\377\214\013\017"
+	.ascii	"E\311\b\r\336#\244nw\275DL\b\235\262\232\366\266\317\346\302"
+	.ascii	"=>it\244\237'_\225\215\246i\207\022\306\002\204O?\364\224I\324"
+	.ascii	"\267i\206\363\256 <8/\211\373\254\247\216\017>O\004\313\250 "
+	.ascii	"@\3003\024[:\035\335\004\247\340\341?\024~$\371\202:\316\377"
+	.ascii	"\212\016\366\026Sn"
+	.string	"\250\213\204\320\300\276\322v\017\n\031\243\013\016\350\226\217\336\253\260\372\212-\005\322\267\350\210\222}[_M\361\332\005\303\240Tr\261\r\231\370\034\"\305(\306\317\327\2773,\320\021\314 R!\230\237\276S\267q\262\236W\240)F\3105;h\202\371z\333ssv\r[\026\017!\244\203V\207e\031\211C\360\272\255\367\300@\201'\266m\310\323\340\377\216\212\343f\252K\301\257\300\267p\007^K\353\233\266d\017|\023\366\357\027X\320\342s\256\247\020s\177\377\265\327\210\"\201\356\r\b\277|\002\267\246\325\320\032\f\266\021D\320$,:\026i?G\211Kz\023&\233\004\322\227\035b\214\304\0212]\230\375\316\"\3316\251zj\372o\324.\005E>\t\3721\302Ess\f))\240\252\317j)H\340\324\242x\356\367\3072\372q?\017\223\004a\217\021\2123P\310\250{W\207F\033\365\230\t\035\342\310\264\305\323"
+	.ascii	">K\200\207\337C\252\322M\222\274\351\334\274\246W\302\342\214"
+	.ascii	"?\364\353A\201\315.\230\313\036.\353\n2O@\360\354;\3315\302\004"
+	.ascii	"\376I\016\177\0334MP\037\232P\262y\321\366\3069\033\276Z4\233"
+	.ascii	"\300\367&\020\325\232X\035\367\006\332\216\336)*<h\34147\235"
+	.ascii	"\354\242O\r\371R\361\316\202\357\340f\273\022\025LE\346i\370"
+	.ascii	"\370\004(\033\226\262\27610\223\007\265\024\210m\365\320\004"
+	.ascii	"\302\353\256\177!4U\021;\032#\3015\240\f\304\331\333I\353V\352"
+	.ascii	"\374\211q\217Z+\351j/3\327\361\344v\243\300r\356\344\345\n\221"
+	.ascii	"\310,\352|g\266b\317\230\306Bg1G\303\003\257A\f\314\332\\:\337"
+	.ascii	"\344K;elMH#\352Zy!N\337\322\205h\254i\271\037\240\246\201\t)"
+	.ascii	"\372\222\357\216\247]"
+	.string	"x\270\317\322_\274\"\2531\221MA\242\033T\235[\303\231\231\\\255,\235\302Xa\314f\255#\240dOH\351\271cW\363\337\267\301\205\001\343]]\377\272\002\331\343\377\034\226\311\333%\211\206\211\230I\253\267\342Doa-\31001\311\323a\340\372\r.\331\032\367\212\274\200$\b\361T\005l;V\332GA\236-\306!\234\345\022x\330h\373\334R\250|;\256\254\241\\}\004\275\211\302n\245\240m\303-w\025a8\252\317X\360\344&\030\223\336\240\307\256\336\374S\243\246\207d\272o\310\271\256c\345\200\003q\356\323YS\252\267/\034 D\273\224\271\\]\362 :\360\270\334l\244\230o\312\372\032\321\016\371;\261\300\350\r\227j=\233v\356\324\311\001\262A!\345*:\331S\020?\217K\212\243\222c\244Q\333\020*\215\240{s\233\261'\035\266\244\005\315\321\204\234\307M\225\027\274\203q\305n\004E\374\200"
+	.ascii	"r\331`\201SA\235\025L\030JY\312\273\355\214GW@\352\276\217\242"
+	.ascii	"ct\210k\360\277A\220~N\020\272\267\261\301%\274\320\027\352#"
+	.ascii	"C\301\376\277\341\372y\372{\335\330\215\034\256\375\203@\026"
+	.ascii	"2\035\350\354\303\234\226\247\".\261\245]\237\367\230\247}\271"
+	.ascii	"z\235\247\313\312\372\324\335\276\246\250\230\325\320\341\351"
+	.ascii	",\233\363\233\237\267\316\367\016\006\\\3204\f\330\235\216\251"
+	.ascii	"^\261\334E\030Z\361\362\2560\233'\2121\214\232\267\300\260\376"
+	.ascii	"\343\215-\273\037\207\223\214Q\267\030H2\245\245\0133e\005\331"
+	.ascii	"_1?\031y\2777!\240f'\343\203\242\354\231\253\210\214\225\353"
+	.ascii	"y\202\326\360\216\203\332H\241.\243F0\"AI\375kF\016+\271m\323"
+	.ascii	"\003\003\032!g\2606\212\225j\306\374\357\314\302\260\007l\302"
+	.ascii	"\222F>\357V\257\b\245N\345\312\324\2706\3202o\025\f\017\016\n"
+	.ascii	"Q\216\364\031\244\\\026a\210\035\223-@\0216o\372\226\221m\351"
+	.ascii	"p:}\254\345\t\320b\f\232\371x\223\324:\316\0039\213\037$\203"
+	.ascii	"\026\242\307\007\032H\242\322/\264K\232\347\343\302\370\365M"
+	.ascii	"\247oT\243\326\005\221\022Zv\242\334\200\242\313\227\347[\004"
+	.ascii	"\026\342\323\322\316\306\033NM\272\226\004\334\220\254\341\260"
+	.ascii	"\353\203\205\210\343{l\367p@e\372\\\242\314l\001\210\372\230"
+	.ascii	"\274\355\022\247\037\031$"
+	.string	"\030Y^\016\257\025?\252\365Z\001\274}\034n)q\224q\rB\316\365\r\274D<\021 \221\037=\260\\YIL+t\247!cX\245\302E\233\316\241\025\237\375\3773*;\306\024\200\bG>\301\337\221\fO\264\332\034i\306\202\303*\016\022Y\254\231\023\256\225"
+	.string	"\340TvN\017\322#\261]\350\200a9[Xt`@0\233\242\315\236d7\253\005\360\240O%9_\277\337\013\023\336\254\305\350&\0319"
+	.string	"\340\016\1776\026E\004fs\336O\373P\300zV+\300PK\270\220V\237\230\220A\r\273\343\216\377%.\322P\r\2759\267U\375'\370=fM\370\333\300\376\332\251\214\363\317J<\223\305TN\270\301o\221\300\327]\262\243\026\371\203\240\377Y\331^\360\277t\003O,\302\310\364d\t\374\241\244\026\367\252\210\331\216\024H\t\0161\177rh\232#8M$\263\336$\260\331C\302\346\302\236!\034\317)\343\215`\022\321\302\241\227\304\3416\242\255/`RN=\324\262\351[5?)\256\224.\373\235*@dY\277V\026n\271\214\fx\2446~SN\020 \356\022\361\327K\245\336$"
+	.string	"\"`\274H\227\267\216N6\226:\345C,(\332\320nMX\013C\250\336\236%j\303y,.o\022l^\330I\371\025\367\226\356\321\315\257l\271\206\264?-\317\300\363\267c\277\337c~\337\242o$8L\376\220\235\006\276U\177\333\354\\\221l4\025:k\351?4p\f\375\326c\255\327+\r~\206\017+&w\301\377\304\246i\354\263ad\241\207\325\357z\241'\032/f\245n~&,9\270\036\343o\036\313\217\027#.i\237L\315\3426\336\353\316\006\276_/29H\237\274\254x\277\312Y\341\230\r\315\251\306\303|\362Z\273"
+	.ascii	"\337'\372\262CY\217\312\376\004\026\312\331\336\026l\230\\\036"
+	.ascii	"\357\265\376\317\256\277\335]\372\310\241.r<\275\253G\347\327"
+	.ascii	"\276?\246}T\3639z\257\243\312m\225\3715\203\021;\232\216\241"
+	.ascii	"\377\332\224\267,\275a,C\340I\273\324'\306\371\210w\317\374\330"
+	.ascii	"\314r\361\036\326\333+\317%X\216nA\247\037\307\254=\301s\205"
+	.ascii	"\317\246\306j\032\275y\260\330\270\212y3M\207\315\254\314\371"
+	.ascii	"\177\256\r/\007\037\3563\335\346\247\365-qo\251\200\rU\263Y\354"
+	.ascii	"\247X\213\027\236m{}\007<i\333y?\b\242K\352\374\340\255\347\371"
+	.ascii	"\302a\361\n\354t\367\222\331\204\007\341l\350\037\276]\374\263"
+	.ascii	"\337a\366\225\362\022\363^<@\247\367\361S\252\206\r\332\304\360"
+	.ascii	"\323\202\343\037Bn\363\360\002\220\353U\332\316\376He$\311\374"
+	.ascii	"\212G\256}\201\fu\200p\201\237\022\277?\371\\\234\035z\3273I"
+	.ascii	"\306\310t\232\342'\354\t\340\001!\374\265\306\351\2635\277X\031"
+	.ascii	"7gE?\332\310\316\314\204uD\317\242\237\227\356\007}\244\327K"
+	.ascii	"\310\277uG\231\207F\336\323Z\334\006\236\316\220\376\t\324\364"
+	.ascii	"\371\247\346\013Rw\023\376x\347>\304\315u\303\322\003_7~\311"
+	.ascii	"\026\210G\303\207,\272s8\225}+\205\276\312\365\245\3748\323\332"
+	.ascii	"\301L\246\234X\357\177\312\337s\003\203\337\216\200\345\344\376"
+	.ascii	"\007\316\242\031/Uf\271\316\256\035\341\244\377\022\373\322\254"
+	.ascii	",7$\307\205\357\005n\n\316w\245{,7\030\373i\324\247\272\037\336"
+	.ascii	"\315\204\362\356\263\036\323W\362\377\347\261H^\367\350\006\035"
+	.ascii	"l[\256\333\002/P\177\360\303\243\242\373\220\245)O\367\233J\r"
+	.ascii	"\213\313C\230Y61\323Gv\233\036\243P\\\342[/\\\247\351\273\343"
+	.ascii	"\370\023p\246\227^Z\320\234rHj\235\270\372\007T\360B\215\023"
+	.ascii	"\364\243\345\025\367\357z\3649\357\271\274G\206\207\365]\314"
+	.ascii	"\251}\001\224\261\2631\007\354B\361\207\334/\316(1\267\375\235"
+	.ascii	"%}\200\316+\177\222\204\033\376\005se\307\351\372\347\206\235"
+	.ascii	"\327\\\361\306\371\365\330'\f\036fn\206sd\036\314\336\204\272"
+	.ascii	"\203\030\346\217\307]\373\253~\244o\360\360\024\372\257\304\256"
+	.ascii	"\372(\345O|\317F}\315\017\263\003\\M\373\350\374\272^\316Q\373"
+	.ascii	"o\315\3429 \361|\313\376QO\270\306)\342\213\242w\322\334\373"
+	.ascii	"\273\005\\Q\337\347o\352\365\032\227n+\235\033\336\370M \267"
+	.ascii	"A\257\310u\301u\223\205\\\342\016\267.-o\267C\362\363\250;\217"
+	.ascii	"\357tk\020\321,\272i\214\262\276\250\217\344\235\255\007\373"
+	.ascii	"\325\216%\305O\021Kno\235\351E~\033w\321'\214\202n"
+	.text
+	.section	.gnu.lto_.symtab.3e02a91ae838c797,"e",@progbits
+	.string	"flashfsEraseCompletely"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"flashfsEraseAsync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"flashfsEraseRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"flashfsGetWriteBufferSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"flashfsGetWriteBufferFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"flashfsGetGeometry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"flashfsGetWriteStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"flashfsGetWriteBandwidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"flashfsJournalTail"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"flashfsWriteReserve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"flashfsIdentifyStartOfFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"flashfsIsEOF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"flashfsFlushAsync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"flashfsPoll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"flashfsWriteByte"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"flashfsWriteCommit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"flashfsFlushSync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"flashfsSeekAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"flashfsSeekRel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"flashfsWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"flashfsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"m25p16_getGeometry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"m25p16_eraseSector"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"m25p16_pageProgram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"m25p16_readBytes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"m25p16_waitForReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"m25p16_eraseCompletely"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"m25p16_isReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"m25p16_pageProgramFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"m25p16_pageProgramContinue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"m25p16_pageProgramBegin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3e02a91ae838c797,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19007 @@
+	.file	"gps.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/io/gps.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/serial.h"
+	.file 10 "./src/main/io/serial.h"
+	.file 11 "./src/main/fc/config.h"
+	.file 12 "./src/main/fc/runtime_config.h"
+	.file 13 "./src/main/flight/pid.h"
+	.file 14 "./src/main/target/SITL/target.h"
+	.file 15 "./src/main/sensors/sensors.h"
+	.file 16 "./src/main/io/gps.c"
+	.file 17 "./src/main/common/gps_conversion.h"
+	.file 18 "./src/main/config/feature.h"
+	.file 19 "/usr/include/string.h"
+	.file 20 "./src/main/flight/navigation.h"
+	.file 21 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gps.c.e779dbd5
+	.weak	gps.c.e779dbd5
+gps.c.e779dbd5:
+	.long	0x18fd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2a
+	.long	.LASF2592
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2116
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2117
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2118
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2119
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2120
+	.uleb128 0x5
+	.long	.LASF2121
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF2122
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2123
+	.uleb128 0x5
+	.long	.LASF2124
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF2125
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF2126
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2127
+	.uleb128 0x2c
+	.byte	0x8
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2128
+	.uleb128 0xb
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF2129
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF2130
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF2131
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xc1
+	.uleb128 0x2d
+	.long	0xc1
+	.uleb128 0x5
+	.long	.LASF2132
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF2133
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xb
+	.long	0xe3
+	.uleb128 0x7
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF2134
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2135
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2136
+	.uleb128 0x24
+	.long	.LASF2405
+	.byte	0xe
+	.byte	0xa1
+	.byte	0xa
+	.long	0xe3
+	.uleb128 0x5
+	.long	.LASF2137
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xd7
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x153
+	.uleb128 0xa
+	.long	.LASF2138
+	.value	0xfff
+	.uleb128 0xa
+	.long	.LASF2139
+	.value	0xf000
+	.uleb128 0xa
+	.long	.LASF2140
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2142
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x15f
+	.uleb128 0x15
+	.long	0x16f
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x18e
+	.uleb128 0x25
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x25
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x18e
+	.byte	0
+	.uleb128 0x7
+	.long	0x153
+	.uleb128 0x10
+	.long	.LASF2171
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x10
+	.long	0x1ef
+	.uleb128 0x16
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2144
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1ef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2145
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ef
+	.byte	0x10
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x1f4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2146
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x16f
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0xc1
+	.uleb128 0x7
+	.long	0x1ef
+	.uleb128 0x5
+	.long	.LASF2147
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x193
+	.uleb128 0xb
+	.long	0x1f9
+	.uleb128 0x5
+	.long	.LASF2148
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0x5
+	.long	.LASF2149
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2150
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x1d
+	.long	0x242
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2153
+	.byte	0x7
+	.byte	0x20
+	.byte	0x3
+	.long	0x229
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x22
+	.long	0x279
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2159
+	.byte	0x7
+	.byte	0x28
+	.byte	0x3
+	.long	0x24e
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x2c
+	.long	0x2b0
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x34
+	.long	0x2c9
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2167
+	.byte	0x7
+	.byte	0x37
+	.byte	0x3
+	.long	0x2b0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x39
+	.long	0x2ee
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2170
+	.byte	0x7
+	.byte	0x3c
+	.byte	0x3
+	.long	0x2d5
+	.uleb128 0x10
+	.long	.LASF2172
+	.byte	0x10
+	.byte	0x7
+	.byte	0x40
+	.byte	0x10
+	.long	0x33c
+	.uleb128 0x2
+	.long	.LASF2173
+	.byte	0x7
+	.byte	0x41
+	.byte	0x13
+	.long	0x242
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2174
+	.byte	0x7
+	.byte	0x42
+	.byte	0x10
+	.long	0x279
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2175
+	.byte	0x7
+	.byte	0x43
+	.byte	0x15
+	.long	0x2c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2176
+	.byte	0x7
+	.byte	0x44
+	.byte	0x13
+	.long	0x2ee
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2177
+	.byte	0x7
+	.byte	0x45
+	.byte	0x3
+	.long	0x2fa
+	.uleb128 0xb
+	.long	0x33c
+	.uleb128 0x9
+	.long	.LASF2178
+	.byte	0x7
+	.byte	0x47
+	.byte	0x14
+	.long	0x33c
+	.uleb128 0x9
+	.long	.LASF2179
+	.byte	0x7
+	.byte	0x47
+	.byte	0x39
+	.long	0x33c
+	.uleb128 0x10
+	.long	.LASF2180
+	.byte	0xc
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x10
+	.long	0x39a
+	.uleb128 0x16
+	.string	"lat"
+	.byte	0x7
+	.byte	0x50
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x16
+	.string	"lon"
+	.byte	0x7
+	.byte	0x51
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x16
+	.string	"alt"
+	.byte	0x7
+	.byte	0x52
+	.byte	0xe
+	.long	0xd7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2181
+	.byte	0x7
+	.byte	0x53
+	.byte	0x3
+	.long	0x365
+	.uleb128 0x10
+	.long	.LASF2182
+	.byte	0x18
+	.byte	0x7
+	.byte	0x55
+	.byte	0x10
+	.long	0x402
+	.uleb128 0x2
+	.long	.LASF2183
+	.byte	0x7
+	.byte	0x56
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x16
+	.string	"llh"
+	.byte	0x7
+	.byte	0x57
+	.byte	0x13
+	.long	0x39a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2184
+	.byte	0x7
+	.byte	0x58
+	.byte	0xe
+	.long	0xd7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2185
+	.byte	0x7
+	.byte	0x59
+	.byte	0xe
+	.long	0xd7
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2186
+	.byte	0x7
+	.byte	0x5a
+	.byte	0xe
+	.long	0xd7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2187
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xe
+	.long	0xd7
+	.byte	0x16
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2188
+	.byte	0x7
+	.byte	0x5c
+	.byte	0x3
+	.long	0x3a6
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x5e
+	.long	0x433
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2193
+	.byte	0x7
+	.byte	0x63
+	.byte	0x3
+	.long	0x40e
+	.uleb128 0x10
+	.long	.LASF2194
+	.byte	0x20
+	.byte	0x7
+	.byte	0x65
+	.byte	0x10
+	.long	0x4c2
+	.uleb128 0x2
+	.long	.LASF2195
+	.byte	0x7
+	.byte	0x66
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2196
+	.byte	0x7
+	.byte	0x67
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2197
+	.byte	0x7
+	.byte	0x68
+	.byte	0xe
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2198
+	.byte	0x7
+	.byte	0x69
+	.byte	0xe
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2199
+	.byte	0x7
+	.byte	0x6a
+	.byte	0xe
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2200
+	.byte	0x7
+	.byte	0x6b
+	.byte	0xe
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2201
+	.byte	0x7
+	.byte	0x6d
+	.byte	0xe
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2202
+	.byte	0x7
+	.byte	0x6e
+	.byte	0xe
+	.long	0xe3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2203
+	.byte	0x7
+	.byte	0x6f
+	.byte	0x17
+	.long	0x433
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2204
+	.byte	0x7
+	.byte	0x70
+	.byte	0x3
+	.long	0x43f
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x4de
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2205
+	.byte	0x7
+	.byte	0x73
+	.byte	0xd
+	.long	0x4ce
+	.uleb128 0x9
+	.long	.LASF2206
+	.byte	0x7
+	.byte	0x75
+	.byte	0x12
+	.long	0x4c2
+	.uleb128 0x9
+	.long	.LASF2207
+	.byte	0x7
+	.byte	0x76
+	.byte	0x1a
+	.long	0x402
+	.uleb128 0x9
+	.long	.LASF2208
+	.byte	0x7
+	.byte	0x78
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2209
+	.byte	0x7
+	.byte	0x79
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x9
+	.long	.LASF2210
+	.byte	0x7
+	.byte	0x7a
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x9
+	.long	.LASF2211
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0xf
+	.long	0xc1
+	.long	0x542
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2212
+	.byte	0x7
+	.byte	0x7c
+	.byte	0x10
+	.long	0x532
+	.uleb128 0x9
+	.long	.LASF2213
+	.byte	0x7
+	.byte	0x7d
+	.byte	0x10
+	.long	0x532
+	.uleb128 0x9
+	.long	.LASF2214
+	.byte	0x7
+	.byte	0x7e
+	.byte	0x10
+	.long	0x532
+	.uleb128 0x9
+	.long	.LASF2215
+	.byte	0x7
+	.byte	0x7f
+	.byte	0x10
+	.long	0x532
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x699
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2266
+	.long	0x30
+	.byte	0x17
+	.long	0x6ba
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2266
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x3
+	.long	0x699
+	.uleb128 0x26
+	.long	.LASF2267
+	.long	0x30
+	.byte	0x1d
+	.long	0x711
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2267
+	.byte	0x9
+	.byte	0x30
+	.byte	0x3
+	.long	0x6c6
+	.uleb128 0x5
+	.long	.LASF2278
+	.byte	0x9
+	.byte	0x32
+	.byte	0x10
+	.long	0x729
+	.uleb128 0x7
+	.long	0x72e
+	.uleb128 0x15
+	.long	0x739
+	.uleb128 0x4
+	.long	0xd7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2279
+	.byte	0x48
+	.byte	0x9
+	.byte	0x34
+	.byte	0x10
+	.long	0x7fd
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0x9
+	.byte	0x36
+	.byte	0x24
+	.long	0x892
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0x9
+	.byte	0x38
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x9
+	.byte	0x39
+	.byte	0x10
+	.long	0x6ba
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x13
+	.long	0x711
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2284
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xe
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2285
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xe
+	.long	0xe3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2286
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xe
+	.long	0xe3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2287
+	.byte	0x9
+	.byte	0x40
+	.byte	0x17
+	.long	0x897
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0x9
+	.byte	0x41
+	.byte	0x17
+	.long	0x897
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xe3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0xe3
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0x9
+	.byte	0x44
+	.byte	0xe
+	.long	0xe3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0x9
+	.byte	0x45
+	.byte	0xe
+	.long	0xe3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x9
+	.byte	0x47
+	.byte	0x1e
+	.long	0x71d
+	.byte	0x40
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2294
+	.byte	0x50
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x8
+	.long	0x88d
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xc
+	.long	0x8c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0x9
+	.byte	0x5f
+	.byte	0x10
+	.long	0x8db
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x9
+	.byte	0x60
+	.byte	0x10
+	.long	0x8db
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x9
+	.byte	0x62
+	.byte	0xf
+	.long	0x8ef
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x9
+	.byte	0x65
+	.byte	0xc
+	.long	0x904
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2300
+	.byte	0x9
+	.byte	0x67
+	.byte	0xb
+	.long	0x918
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2301
+	.byte	0x9
+	.byte	0x69
+	.byte	0xc
+	.long	0x92d
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2302
+	.byte	0x9
+	.byte	0x6b
+	.byte	0xc
+	.long	0x94d
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2303
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xc
+	.long	0x95d
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2304
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xc
+	.long	0x95d
+	.byte	0x48
+	.byte	0
+	.uleb128 0xb
+	.long	0x7fd
+	.uleb128 0x7
+	.long	0x88d
+	.uleb128 0x7
+	.long	0xd2
+	.uleb128 0x5
+	.long	.LASF2305
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x739
+	.uleb128 0xb
+	.long	0x89c
+	.uleb128 0x15
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0xc1
+	.byte	0
+	.uleb128 0x7
+	.long	0x89c
+	.uleb128 0x7
+	.long	0x8ad
+	.uleb128 0x20
+	.long	0xe3
+	.long	0x8d6
+	.uleb128 0x4
+	.long	0x8d6
+	.byte	0
+	.uleb128 0x7
+	.long	0x8a8
+	.uleb128 0x7
+	.long	0x8c7
+	.uleb128 0x20
+	.long	0xc1
+	.long	0x8ef
+	.uleb128 0x4
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x7
+	.long	0x8e0
+	.uleb128 0x15
+	.long	0x904
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x7
+	.long	0x8f4
+	.uleb128 0x20
+	.long	0x222
+	.long	0x918
+	.uleb128 0x4
+	.long	0x8d6
+	.byte	0
+	.uleb128 0x7
+	.long	0x909
+	.uleb128 0x15
+	.long	0x92d
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0x6ba
+	.byte	0
+	.uleb128 0x7
+	.long	0x91d
+	.uleb128 0x15
+	.long	0x947
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0x947
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x7
+	.long	0x94c
+	.uleb128 0x2f
+	.uleb128 0x7
+	.long	0x932
+	.uleb128 0x15
+	.long	0x95d
+	.uleb128 0x4
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x7
+	.long	0x952
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x20
+	.long	0x9cf
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2315
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2316
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2317
+	.value	0x800
+	.uleb128 0xa
+	.long	.LASF2318
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2319
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2320
+	.value	0x4000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2321
+	.byte	0xa
+	.byte	0x30
+	.byte	0x3
+	.long	0x962
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x32
+	.long	0xa48
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2338
+	.byte	0xa
+	.byte	0x43
+	.byte	0x3
+	.long	0x9db
+	.uleb128 0xf
+	.long	0xef
+	.long	0xa5f
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0xb
+	.long	0xa54
+	.uleb128 0x9
+	.long	.LASF2339
+	.byte	0xa
+	.byte	0x45
+	.byte	0x17
+	.long	0xa5f
+	.uleb128 0x8
+	.byte	0x5
+	.long	0x7c
+	.byte	0xa
+	.byte	0x48
+	.long	0xac5
+	.uleb128 0x31
+	.long	.LASF2340
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2352
+	.byte	0xa
+	.byte	0x55
+	.byte	0x3
+	.long	0xa70
+	.uleb128 0x10
+	.long	.LASF2353
+	.byte	0xc
+	.byte	0xa
+	.byte	0x6c
+	.byte	0x10
+	.long	0xb2d
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0xa
+	.byte	0x6d
+	.byte	0xe
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0xa
+	.byte	0x6e
+	.byte	0x1c
+	.long	0xac5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0xa
+	.byte	0x6f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0xa
+	.byte	0x70
+	.byte	0xd
+	.long	0xc1
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0xa
+	.byte	0x71
+	.byte	0xd
+	.long	0xc1
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0xa
+	.byte	0x72
+	.byte	0xd
+	.long	0xc1
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2359
+	.byte	0xa
+	.byte	0x73
+	.byte	0x3
+	.long	0xad1
+	.uleb128 0x5
+	.long	.LASF2360
+	.byte	0xa
+	.byte	0x7d
+	.byte	0xe
+	.long	0xb45
+	.uleb128 0x15
+	.long	0xb50
+	.uleb128 0x4
+	.long	0xc1
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x22
+	.long	0xc2d
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2368
+	.value	0x100
+	.uleb128 0xa
+	.long	.LASF2369
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2370
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2371
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2372
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2373
+	.value	0x4000
+	.uleb128 0xa
+	.long	.LASF2374
+	.value	0x8000
+	.uleb128 0xc
+	.long	.LASF2375
+	.long	0x10000
+	.uleb128 0xc
+	.long	.LASF2376
+	.long	0x20000
+	.uleb128 0xc
+	.long	.LASF2377
+	.long	0x40000
+	.uleb128 0xc
+	.long	.LASF2378
+	.long	0x80000
+	.uleb128 0xc
+	.long	.LASF2379
+	.long	0x100000
+	.uleb128 0xc
+	.long	.LASF2380
+	.long	0x200000
+	.uleb128 0xc
+	.long	.LASF2381
+	.long	0x400000
+	.uleb128 0xc
+	.long	.LASF2382
+	.long	0x800000
+	.uleb128 0xc
+	.long	.LASF2383
+	.long	0x2000000
+	.uleb128 0xc
+	.long	.LASF2384
+	.long	0x4000000
+	.uleb128 0xc
+	.long	.LASF2385
+	.long	0x8000000
+	.uleb128 0xc
+	.long	.LASF2386
+	.long	0x10000000
+	.uleb128 0xc
+	.long	.LASF2387
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x58
+	.long	0xc58
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x10
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2393
+	.byte	0xc
+	.byte	0x64
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x25
+	.long	0xcb3
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0xa
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2406
+	.byte	0xd
+	.byte	0x79
+	.byte	0x5
+	.long	0x222
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.long	0xcea
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x2d
+	.long	0xd21
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x40
+	.byte	0
+	.uleb128 0xd
+	.long	0x4de
+	.byte	0x45
+	.byte	0x6
+	.uleb128 0x17
+	.long	.LASF2419
+	.byte	0x46
+	.byte	0xe
+	.long	0x98
+	.uleb128 0xd
+	.long	0x4f6
+	.byte	0x4a
+	.byte	0x13
+	.uleb128 0xd
+	.long	0x50e
+	.byte	0x4b
+	.byte	0xa
+	.uleb128 0xd
+	.long	0x51a
+	.byte	0x4c
+	.byte	0xa
+	.uleb128 0xd
+	.long	0x502
+	.byte	0x4d
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x526
+	.byte	0x4f
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x542
+	.byte	0x50
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x54e
+	.byte	0x51
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x55a
+	.byte	0x52
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x566
+	.byte	0x53
+	.byte	0x9
+	.uleb128 0x17
+	.long	.LASF2420
+	.byte	0x5b
+	.byte	0x16
+	.long	0x8bd
+	.uleb128 0x10
+	.long	.LASF2421
+	.byte	0x18
+	.byte	0x10
+	.byte	0x5d
+	.byte	0x10
+	.long	0xdbf
+	.uleb128 0x2
+	.long	.LASF2422
+	.byte	0x10
+	.byte	0x5e
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2196
+	.byte	0x10
+	.byte	0x5f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x16
+	.string	"ubx"
+	.byte	0x10
+	.byte	0x60
+	.byte	0x11
+	.long	0xf4
+	.byte	0x8
+	.uleb128 0x16
+	.string	"mtk"
+	.byte	0x10
+	.byte	0x61
+	.byte	0x11
+	.long	0xf4
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2423
+	.byte	0x10
+	.byte	0x62
+	.byte	0x3
+	.long	0xd7d
+	.uleb128 0xb
+	.long	0xdbf
+	.uleb128 0xf
+	.long	0xdcb
+	.long	0xde0
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0xdd0
+	.uleb128 0x17
+	.long	.LASF2424
+	.byte	0x65
+	.byte	0x1c
+	.long	0xde0
+	.uleb128 0xf
+	.long	0xcd
+	.long	0xe00
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xb2
+	.byte	0
+	.uleb128 0xb
+	.long	0xdf0
+	.uleb128 0x17
+	.long	.LASF2425
+	.byte	0x72
+	.byte	0x16
+	.long	0xe00
+	.uleb128 0xf
+	.long	0xcd
+	.long	0xe20
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0xb
+	.long	0xe10
+	.uleb128 0x17
+	.long	.LASF2426
+	.byte	0xa3
+	.byte	0x16
+	.long	0xe20
+	.uleb128 0x10
+	.long	.LASF2427
+	.byte	0xc
+	.byte	0x10
+	.byte	0xa6
+	.byte	0x10
+	.long	0xe58
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x10
+	.byte	0xa7
+	.byte	0x10
+	.long	0x279
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0x10
+	.byte	0xa8
+	.byte	0xd
+	.long	0xe58
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xc1
+	.long	0xe68
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2429
+	.byte	0x10
+	.byte	0xa9
+	.byte	0x3
+	.long	0xe30
+	.uleb128 0xb
+	.long	0xe68
+	.uleb128 0xf
+	.long	0xe74
+	.long	0xe89
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0xe79
+	.uleb128 0x17
+	.long	.LASF2430
+	.byte	0xae
+	.byte	0x1a
+	.long	0xe89
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0xb8
+	.long	0xeca
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2437
+	.byte	0x10
+	.byte	0xbf
+	.byte	0x3
+	.long	0xe99
+	.uleb128 0xd
+	.long	0x4ea
+	.byte	0xc1
+	.byte	0xb
+	.uleb128 0x9
+	.long	.LASF2438
+	.byte	0x10
+	.byte	0xc4
+	.byte	0x1a
+	.long	0x348
+	.uleb128 0xd
+	.long	0x34d
+	.byte	0xc4
+	.byte	0x41
+	.uleb128 0xd
+	.long	0x359
+	.byte	0xc4
+	.byte	0x5f
+	.uleb128 0x9
+	.long	.LASF2439
+	.byte	0x10
+	.byte	0xc4
+	.byte	0x89
+	.long	0x205
+	.uleb128 0x32
+	.long	0xef7
+	.byte	0xb0
+	.uleb128 0x33
+	.long	0xedd
+	.byte	0xc6
+	.byte	0x13
+	.uleb128 0x34
+	.long	.LASF2440
+	.byte	0x10
+	.byte	0x10
+	.value	0x24e
+	.byte	0x10
+	.long	0xf6d
+	.uleb128 0x3
+	.long	.LASF2441
+	.value	0x24f
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2442
+	.value	0x250
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2183
+	.value	0x251
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2443
+	.value	0x252
+	.byte	0xe
+	.long	0xd7
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF2444
+	.value	0x253
+	.byte	0xe
+	.long	0xd7
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2445
+	.value	0x254
+	.byte	0xe
+	.long	0xd7
+	.byte	0xe
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2446
+	.value	0x255
+	.long	0xf10
+	.uleb128 0x19
+	.byte	0x1c
+	.value	0x309
+	.long	0xfdc
+	.uleb128 0x3
+	.long	.LASF2447
+	.value	0x30a
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2442
+	.value	0x30b
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2441
+	.value	0x30c
+	.byte	0xd
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2448
+	.value	0x30d
+	.byte	0xd
+	.long	0xb5
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2449
+	.value	0x30e
+	.byte	0xd
+	.long	0xb5
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2450
+	.value	0x30f
+	.byte	0xe
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF2451
+	.value	0x310
+	.byte	0xe
+	.long	0xe3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2452
+	.value	0x311
+	.long	0xf78
+	.uleb128 0x19
+	.byte	0x10
+	.value	0x313
+	.long	0x104a
+	.uleb128 0x3
+	.long	.LASF2447
+	.value	0x314
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2453
+	.value	0x315
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2454
+	.value	0x316
+	.byte	0xd
+	.long	0xc1
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2455
+	.value	0x317
+	.byte	0xd
+	.long	0xc1
+	.byte	0x6
+	.uleb128 0x1c
+	.string	"res"
+	.value	0x318
+	.long	0xc1
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF2456
+	.value	0x319
+	.byte	0xe
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2457
+	.value	0x31a
+	.byte	0xe
+	.long	0xe3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2458
+	.value	0x31b
+	.long	0xfe7
+	.uleb128 0x19
+	.byte	0x34
+	.value	0x31d
+	.long	0x113a
+	.uleb128 0x3
+	.long	.LASF2447
+	.value	0x31e
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2459
+	.value	0x31f
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2460
+	.value	0x320
+	.byte	0xd
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2453
+	.value	0x321
+	.byte	0xd
+	.long	0xc1
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF2454
+	.value	0x322
+	.byte	0xd
+	.long	0xc1
+	.byte	0xb
+	.uleb128 0x3
+	.long	.LASF2461
+	.value	0x323
+	.byte	0xd
+	.long	0xb5
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2462
+	.value	0x324
+	.byte	0xd
+	.long	0xb5
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2463
+	.value	0x325
+	.byte	0xd
+	.long	0xb5
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF2464
+	.value	0x326
+	.byte	0xe
+	.long	0xe3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2465
+	.value	0x327
+	.byte	0xd
+	.long	0xb5
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF2466
+	.value	0x328
+	.byte	0xd
+	.long	0xb5
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2467
+	.value	0x329
+	.byte	0xd
+	.long	0xb5
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF2468
+	.value	0x32a
+	.byte	0xe
+	.long	0xe3
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF2469
+	.value	0x32b
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2c
+	.uleb128 0x1c
+	.string	"res"
+	.value	0x32c
+	.long	0xc1
+	.byte	0x2e
+	.uleb128 0x3
+	.long	.LASF2470
+	.value	0x32d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2f
+	.uleb128 0x3
+	.long	.LASF2471
+	.value	0x32e
+	.byte	0xe
+	.long	0xe3
+	.byte	0x30
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2472
+	.value	0x32f
+	.long	0x1055
+	.uleb128 0x19
+	.byte	0x24
+	.value	0x331
+	.long	0x11c3
+	.uleb128 0x3
+	.long	.LASF2447
+	.value	0x332
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2473
+	.value	0x333
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2474
+	.value	0x334
+	.byte	0xd
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2475
+	.value	0x335
+	.byte	0xd
+	.long	0xb5
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2476
+	.value	0x336
+	.byte	0xe
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2477
+	.value	0x337
+	.byte	0xe
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF2478
+	.value	0x338
+	.byte	0xd
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2468
+	.value	0x339
+	.byte	0xe
+	.long	0xe3
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF2479
+	.value	0x33a
+	.byte	0xe
+	.long	0xe3
+	.byte	0x20
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2480
+	.value	0x33b
+	.long	0x1145
+	.uleb128 0x19
+	.byte	0xc
+	.value	0x33d
+	.long	0x123d
+	.uleb128 0x1c
+	.string	"chn"
+	.value	0x33e
+	.long	0xc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2481
+	.value	0x33f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2482
+	.value	0x340
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2483
+	.value	0x341
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x1c
+	.string	"cno"
+	.value	0x342
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2484
+	.value	0x343
+	.byte	0xd
+	.long	0xc1
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2485
+	.value	0x344
+	.byte	0xd
+	.long	0xa9
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2486
+	.value	0x345
+	.byte	0xd
+	.long	0xb5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2487
+	.value	0x346
+	.long	0x11ce
+	.uleb128 0x19
+	.byte	0xc8
+	.value	0x348
+	.long	0x1292
+	.uleb128 0x3
+	.long	.LASF2447
+	.value	0x349
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2488
+	.value	0x34a
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2489
+	.value	0x34b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2490
+	.value	0x34c
+	.byte	0xe
+	.long	0xd7
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2491
+	.value	0x34d
+	.byte	0x1c
+	.long	0x1292
+	.byte	0x8
+	.byte	0
+	.uleb128 0xf
+	.long	0x123d
+	.long	0x12a2
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2492
+	.value	0x34e
+	.long	0x1248
+	.uleb128 0x21
+	.long	0x30
+	.value	0x350
+	.long	0x1319
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0xb5
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x24
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2509
+	.value	0x361
+	.long	0x12ad
+	.uleb128 0x21
+	.long	0x30
+	.value	0x363
+	.long	0x1354
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0x5
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2516
+	.value	0x36a
+	.long	0x1324
+	.uleb128 0x21
+	.long	0x30
+	.value	0x36c
+	.long	0x1371
+	.uleb128 0x1
+	.long	.LASF2517
+	.byte	0x1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2518
+	.value	0x36e
+	.long	0x135f
+	.uleb128 0x6
+	.long	.LASF2519
+	.value	0x371
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2520
+	.value	0x372
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2521
+	.value	0x375
+	.byte	0xc
+	.long	0x222
+	.uleb128 0x6
+	.long	.LASF2522
+	.value	0x376
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2523
+	.value	0x377
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2524
+	.value	0x378
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x6
+	.long	.LASF2525
+	.value	0x379
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x6
+	.long	.LASF2526
+	.value	0x37b
+	.byte	0xc
+	.long	0x222
+	.uleb128 0x6
+	.long	.LASF2527
+	.value	0x37c
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2528
+	.value	0x37f
+	.byte	0xc
+	.long	0x222
+	.uleb128 0x6
+	.long	.LASF2529
+	.value	0x382
+	.byte	0xc
+	.long	0x222
+	.uleb128 0x35
+	.value	0x158
+	.byte	0x10
+	.value	0x396
+	.byte	0x8
+	.long	0x1454
+	.uleb128 0x1a
+	.long	.LASF2530
+	.value	0x397
+	.byte	0x14
+	.long	0xfdc
+	.uleb128 0x1a
+	.long	.LASF2531
+	.value	0x398
+	.byte	0x14
+	.long	0x104a
+	.uleb128 0x1a
+	.long	.LASF2532
+	.value	0x399
+	.byte	0x16
+	.long	0x113a
+	.uleb128 0x1a
+	.long	.LASF2533
+	.value	0x39a
+	.byte	0x14
+	.long	0x11c3
+	.uleb128 0x1a
+	.long	.LASF2534
+	.value	0x39b
+	.byte	0x14
+	.long	0x12a2
+	.uleb128 0x1a
+	.long	.LASF2535
+	.value	0x39c
+	.byte	0xd
+	.long	0x1454
+	.byte	0
+	.uleb128 0xf
+	.long	0xc1
+	.long	0x1465
+	.uleb128 0x36
+	.long	0x37
+	.value	0x157
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2536
+	.value	0x39d
+	.byte	0x3
+	.long	0x1400
+	.uleb128 0x13
+	.long	.LASF2537
+	.byte	0xa
+	.byte	0xa8
+	.long	0x1491
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0x1491
+	.uleb128 0x4
+	.long	0x1491
+	.byte	0
+	.uleb128 0x7
+	.long	0xb39
+	.uleb128 0x13
+	.long	.LASF2538
+	.byte	0x9
+	.byte	0x77
+	.long	0x14ac
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0x6ba
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2539
+	.byte	0xa
+	.byte	0x9f
+	.long	0x14bd
+	.uleb128 0x4
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2541
+	.byte	0x11
+	.byte	0x12
+	.byte	0xa
+	.long	0xe3
+	.long	0x14d3
+	.uleb128 0x4
+	.long	0xf4
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF2593
+	.byte	0x14
+	.byte	0x3d
+	.byte	0x6
+	.uleb128 0x13
+	.long	.LASF2540
+	.byte	0xc
+	.byte	0x6a
+	.long	0x14ec
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2542
+	.byte	0xc
+	.byte	0x69
+	.byte	0x5
+	.long	0x222
+	.long	0x1502
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2543
+	.byte	0xc
+	.byte	0x6b
+	.long	0x1513
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2544
+	.byte	0x9
+	.byte	0x72
+	.byte	0xa
+	.long	0xe3
+	.long	0x1529
+	.uleb128 0x4
+	.long	0x8d6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2298
+	.byte	0x9
+	.byte	0x75
+	.byte	0x9
+	.long	0xc1
+	.long	0x153f
+	.uleb128 0x4
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2295
+	.byte	0x9
+	.byte	0x71
+	.long	0x1555
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0xc1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2545
+	.byte	0x9
+	.byte	0x79
+	.long	0x156b
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0xf4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2546
+	.byte	0xa
+	.byte	0xa1
+	.byte	0xc
+	.long	0xa48
+	.long	0x1581
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2547
+	.byte	0x9
+	.byte	0x7a
+	.byte	0xa
+	.long	0xe3
+	.long	0x1597
+	.uleb128 0x4
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2300
+	.byte	0x9
+	.byte	0x78
+	.byte	0x5
+	.long	0x222
+	.long	0x15ad
+	.uleb128 0x4
+	.long	0x8d6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2299
+	.byte	0x9
+	.byte	0x76
+	.long	0x15c3
+	.uleb128 0x4
+	.long	0x8bd
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2548
+	.byte	0xa
+	.byte	0x95
+	.byte	0xf
+	.long	0x8bd
+	.long	0x15f2
+	.uleb128 0x4
+	.long	0xac5
+	.uleb128 0x4
+	.long	0x9cf
+	.uleb128 0x4
+	.long	0x71d
+	.uleb128 0x4
+	.long	0xe3
+	.uleb128 0x4
+	.long	0x6ba
+	.uleb128 0x4
+	.long	0x711
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2549
+	.byte	0x12
+	.byte	0x20
+	.long	0x1603
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2550
+	.byte	0xa
+	.byte	0x89
+	.byte	0x15
+	.long	0x1619
+	.long	0x1619
+	.uleb128 0x4
+	.long	0x9cf
+	.byte	0
+	.uleb128 0x7
+	.long	0xb2d
+	.uleb128 0x38
+	.long	.LASF2594
+	.byte	0x15
+	.byte	0x1d
+	.byte	0xa
+	.long	0x20a
+	.uleb128 0x11
+	.long	.LASF2551
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x164a
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xf9
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2557
+	.value	0x44d
+	.long	0x1662
+	.uleb128 0x14
+	.long	.LASF2552
+	.value	0x44d
+	.byte	0x29
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2578
+	.value	0x442
+	.long	0x167a
+	.uleb128 0x14
+	.long	.LASF2553
+	.value	0x442
+	.byte	0x2a
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2555
+	.value	0x3ec
+	.byte	0xc
+	.long	0x222
+	.long	0x16a3
+	.uleb128 0x14
+	.long	.LASF2553
+	.value	0x3ec
+	.byte	0x25
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2554
+	.value	0x3ee
+	.byte	0x9
+	.long	0x222
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2556
+	.value	0x3a9
+	.byte	0xc
+	.long	0x222
+	.long	0x16bd
+	.uleb128 0x1f
+	.string	"i"
+	.value	0x3ab
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2558
+	.value	0x39f
+	.long	0x16f9
+	.uleb128 0x14
+	.long	.LASF2553
+	.value	0x39f
+	.byte	0x20
+	.long	0x1ef
+	.uleb128 0x1b
+	.string	"len"
+	.value	0x39f
+	.byte	0x2e
+	.long	0xc1
+	.uleb128 0x14
+	.long	.LASF2559
+	.value	0x39f
+	.byte	0x3c
+	.long	0x1ef
+	.uleb128 0x14
+	.long	.LASF2560
+	.value	0x39f
+	.byte	0x4b
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2561
+	.value	0x257
+	.byte	0xc
+	.long	0x222
+	.long	0x17b2
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x257
+	.byte	0x21
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF2562
+	.value	0x259
+	.byte	0x1a
+	.long	0xf6d
+	.uleb128 0x6
+	.long	.LASF2563
+	.value	0x25b
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2564
+	.value	0x25c
+	.byte	0x14
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2565
+	.value	0x25c
+	.byte	0x1f
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2566
+	.value	0x25c
+	.byte	0x2b
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2567
+	.value	0x25d
+	.byte	0x11
+	.long	0x17b2
+	.uleb128 0x6
+	.long	.LASF2568
+	.value	0x25e
+	.byte	0x14
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2569
+	.value	0x25e
+	.byte	0x24
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2570
+	.value	0x25f
+	.byte	0x14
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2571
+	.value	0x260
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2572
+	.value	0x260
+	.byte	0x1b
+	.long	0xc1
+	.uleb128 0x6
+	.long	.LASF2573
+	.value	0x260
+	.byte	0x2c
+	.long	0xc1
+	.uleb128 0x27
+	.uleb128 0x6
+	.long	.LASF2574
+	.value	0x2dc
+	.byte	0x19
+	.long	0xc1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x17c2
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2575
+	.value	0x239
+	.byte	0x11
+	.long	0xe3
+	.long	0x17ff
+	.uleb128 0x1b
+	.string	"src"
+	.value	0x239
+	.byte	0x23
+	.long	0x98
+	.uleb128 0x14
+	.long	.LASF2576
+	.value	0x239
+	.byte	0x30
+	.long	0xc1
+	.uleb128 0x1f
+	.string	"i"
+	.value	0x23b
+	.long	0xe3
+	.uleb128 0x1f
+	.string	"tmp"
+	.value	0x23c
+	.long	0xe3
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2577
+	.byte	0x10
+	.value	0x1ee
+	.byte	0x5
+	.long	0x222
+	.long	0x181b
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x1ee
+	.byte	0x19
+	.long	0xc1
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2579
+	.value	0x1d7
+	.long	0x1831
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x1d7
+	.byte	0x21
+	.long	0xd7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2580
+	.value	0x1aa
+	.long	0x1849
+	.uleb128 0x14
+	.long	.LASF2581
+	.value	0x1aa
+	.byte	0x19
+	.long	0x216
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2582
+	.value	0x1a1
+	.long	0x186d
+	.uleb128 0x14
+	.long	.LASF2581
+	.value	0x1a1
+	.byte	0x29
+	.long	0x216
+	.uleb128 0x6
+	.long	.LASF2583
+	.value	0x1a3
+	.byte	0x15
+	.long	0xe3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2586
+	.value	0x194
+	.uleb128 0x1d
+	.long	.LASF2584
+	.value	0x140
+	.long	0x1899
+	.uleb128 0x1f
+	.string	"now"
+	.value	0x142
+	.long	0xe3
+	.uleb128 0x27
+	.uleb128 0x6
+	.long	.LASF2585
+	.value	0x152
+	.byte	0x1c
+	.long	0xa48
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2587
+	.value	0x10f
+	.uleb128 0x3a
+	.long	.LASF2588
+	.byte	0x10
+	.byte	0xe2
+	.byte	0x6
+	.long	0x18c3
+	.uleb128 0x17
+	.long	.LASF2589
+	.byte	0xef
+	.byte	0x19
+	.long	0x1619
+	.uleb128 0x17
+	.long	.LASF2282
+	.byte	0xfd
+	.byte	0x10
+	.long	0x6ba
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2590
+	.byte	0xda
+	.long	0x18da
+	.uleb128 0x3b
+	.long	.LASF2195
+	.byte	0x10
+	.byte	0xda
+	.byte	0x24
+	.long	0xeca
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2591
+	.byte	0xcd
+	.long	0x18ef
+	.uleb128 0x3c
+	.string	"i"
+	.byte	0x10
+	.byte	0xcf
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF2595
+	.byte	0x7
+	.byte	0x47
+	.byte	0x6a
+	.long	0x18fb
+	.uleb128 0x7
+	.long	0x348
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 22 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.file 25 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 27 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 28 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 31 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 33 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x21
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 38 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF732
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF733
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 43 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2d
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1182
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1209
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 54 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x36
+	.file 55 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 56 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.file 57 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 58 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 59 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x4
+	.file 60 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 61 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3d
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 63 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1653
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x41
+	.file 66 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x42
+	.file 67 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.file 68 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 69 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 70 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2061
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xb
+	.file 71 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x47
+	.byte	0x4
+	.file 72 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x4
+	.file 73 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 74 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 76 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2069
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF2115
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF707
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1098
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1102
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1106
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1108
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1110
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1112
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1122
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1124
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1126
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1132
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1138
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1140
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1142
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1144
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1148
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1154
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1160
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1172
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1203
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1208
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1211
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1213
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1238
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1241
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1253
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1260
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1261
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1262
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1263
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1264
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1341
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1362
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1364
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1395
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1396
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1397
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1398
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1399
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1400
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1401
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1402
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1403
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1409
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1411
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1412
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1421
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1422
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1429
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1442
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1443
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1459
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1460
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1461
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1477
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1489
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1493
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1509
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1535
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1652
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dashboard.h.22.499b1990b01ce2b674fe8b48758244f0,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.5180f3e1226fed2dcd3d65550473d6df,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1670
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1672
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1680
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.25.4117cdff46e82297320ff417e4998484,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2092
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2596
+	.long	.LASF2597
+	.long	.LASF2598
+	.long	.LASF2599
+	.long	.LASF2600
+	.long	.LASF2601
+	.long	.LASF2602
+	.long	.LASF2603
+	.long	.LASF2604
+	.long	.LASF2605
+	.long	.LASF2606
+	.long	.LASF2607
+	.long	.LASF2608
+	.long	.LASF2609
+	.long	.LASF2610
+	.long	.LASF2611
+	.long	.LASF2612
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2613
+	.byte	0xd
+	.long	.LASF2614
+	.byte	0xd
+	.long	.LASF2615
+	.byte	0xd
+	.long	.LASF2616
+	.byte	0x11
+	.long	.LASF2617
+	.byte	0x3
+	.long	.LASF2618
+	.byte	0x2
+	.long	.LASF2619
+	.byte	0x7
+	.long	.LASF2620
+	.byte	0x4
+	.long	.LASF2621
+	.byte	0x4
+	.long	.LASF2621
+	.byte	0x7
+	.long	.LASF2622
+	.byte	0x5
+	.long	.LASF2623
+	.byte	0x5
+	.long	.LASF2624
+	.byte	0x6
+	.long	.LASF2625
+	.byte	0x9
+	.long	.LASF2626
+	.byte	0x8
+	.long	.LASF2627
+	.byte	0x7
+	.long	.LASF2628
+	.byte	0x2
+	.long	.LASF2629
+	.byte	0x3
+	.long	.LASF2630
+	.byte	0x10
+	.long	.LASF2631
+	.byte	0x6
+	.long	.LASF2618
+	.byte	0x4
+	.long	.LASF2632
+	.byte	0x10
+	.long	.LASF2633
+	.byte	0x11
+	.long	.LASF2634
+	.byte	0x11
+	.long	.LASF2634
+	.byte	0x10
+	.long	.LASF2635
+	.byte	0xd
+	.long	.LASF2636
+	.byte	0x10
+	.long	.LASF2637
+	.byte	0x10
+	.long	.LASF2638
+	.byte	0xd
+	.long	.LASF2639
+	.byte	0xd
+	.long	.LASF2640
+	.byte	0xf
+	.long	.LASF2641
+	.byte	0xd
+	.long	.LASF2642
+	.byte	0xe
+	.long	.LASF2643
+	.byte	0xe
+	.long	.LASF2644
+	.byte	0xd
+	.long	.LASF2645
+	.byte	0xd
+	.long	.LASF2646
+	.byte	0xd
+	.long	.LASF2647
+	.byte	0x10
+	.long	.LASF2648
+	.byte	0xd
+	.long	.LASF2649
+	.byte	0xd
+	.long	.LASF2650
+	.byte	0xc
+	.long	.LASF2651
+	.byte	0xc
+	.long	.LASF2652
+	.byte	0x10
+	.long	.LASF2653
+	.byte	0x10
+	.long	.LASF2654
+	.byte	0xd
+	.long	.LASF2655
+	.byte	0xd
+	.long	.LASF2656
+	.byte	0xd
+	.long	.LASF2657
+	.byte	0xd
+	.long	.LASF2658
+	.byte	0xd
+	.long	.LASF2659
+	.byte	0xd
+	.long	.LASF2660
+	.byte	0xd
+	.long	.LASF2661
+	.byte	0xd
+	.long	.LASF2662
+	.byte	0xd
+	.long	.LASF2663
+	.byte	0xb
+	.long	.LASF2664
+	.byte	0xa
+	.long	.LASF2665
+	.byte	0xa
+	.long	.LASF2666
+	.byte	0x1
+	.long	.LASF2667
+	.byte	0x1
+	.long	.LASF2668
+	.byte	0x2
+	.long	.LASF2669
+	.byte	0x2
+	.long	.LASF2670
+	.byte	0x2
+	.long	.LASF2671
+	.byte	0x3
+	.long	.LASF2672
+	.byte	0x4
+	.long	.LASF2673
+	.byte	0x4
+	.long	.LASF2674
+	.byte	0x7
+	.long	.LASF2675
+	.byte	0x4
+	.long	.LASF2676
+	.byte	0x4
+	.long	.LASF2677
+	.byte	0x4
+	.long	.LASF2678
+	.byte	0x4
+	.long	.LASF2679
+	.byte	0x4
+	.long	.LASF2680
+	.byte	0x4
+	.long	.LASF2681
+	.byte	0x4
+	.long	.LASF2682
+	.byte	0x4
+	.long	.LASF2683
+	.byte	0x4
+	.long	.LASF2684
+	.byte	0x4
+	.long	.LASF2685
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2052:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2474:
+	.string	"ned_east"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1808:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1688:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF827:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2182:
+	.string	"gpsSolutionData_s"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1882:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF2110:
+	.string	"UBLOX_SBAS_MESSAGE_LENGTH 6"
+.LASF1828:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1708:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1376:
+	.string	"USE_FAKE_BARO "
+.LASF1083:
+	.string	"__DECL_SIMD_exp"
+.LASF1336:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2063:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF1682:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2490:
+	.string	"reserved2"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1699:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1453:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1343:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF936:
+	.string	"__DECL_SIMD_sinh "
+.LASF2380:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1498:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1783:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1849:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1235:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1337:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF864:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF2113:
+	.string	"FRAME_RMC 2"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF760:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1397:
+	.string	"USE_PPM"
+.LASF2301:
+	.string	"setMode"
+.LASF2361:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF701:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF973:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1316:
+	.string	"USE_SERIALRX_CRSF "
+.LASF746:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF727:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF2540:
+	.string	"sensorsSet"
+.LASF1955:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF980:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF837:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF700:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2095:
+	.string	"LOG_SKIPPED '>'"
+.LASF895:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1536:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2036:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1056:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1424:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2121:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2393:
+	.string	"stateFlags"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf"
+.LASF2280:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2150:
+	.string	"_Bool"
+.LASF1754:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2061:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF795:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1901:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"SKIP_IMU_CALC "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF721:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1362:
+	.string	"U_ID_2 2"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2581:
+	.string	"currentTimeUs"
+.LASF2417:
+	.string	"SENSOR_GPS"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF846:
+	.string	"__DECL_SIMD_pow "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2173:
+	.string	"provider"
+.LASF2224:
+	.string	"OWNER_ADC_CURR"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF984:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1755:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2016:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1989:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2008:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1861:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2554:
+	.string	"parsed"
+.LASF754:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2268:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2197:
+	.string	"errors"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1238:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1979:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"TELEMETRY_LTM"
+.LASF1879:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__DECL_SIMD_sinh"
+.LASF1423:
+	.string	"USE_SPI"
+.LASF1551:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2309:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1988:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2074:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF841:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1445:
+	.string	"__WCHAR_T__ "
+.LASF1344:
+	.string	"USE_SENSOR_NAMES "
+.LASF2048:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2153:
+	.string	"gpsProvider_e"
+.LASF1697:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1217:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1241:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshf "
+.LASF812:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1591:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2527:
+	.string	"_class"
+.LASF985:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2177:
+	.string	"gpsConfig_t"
+.LASF1871:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2020:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2167:
+	.string	"gpsAutoConfig_e"
+.LASF1995:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1278:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1555:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2221:
+	.string	"OWNER_LED"
+.LASF800:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2503:
+	.string	"MSG_VELNED"
+.LASF1719:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2024:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1827:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF2175:
+	.string	"autoConfig"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2492:
+	.string	"ubx_nav_svinfo"
+.LASF2370:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1279:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2194:
+	.string	"gpsData_s"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2132:
+	.string	"uint16_t"
+.LASF1833:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1079:
+	.string	"__DECL_SIMD_log"
+.LASF1215:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2338:
+	.string	"baudRate_e"
+.LASF2316:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1648:
+	.string	"LED1_OFF NOOP"
+.LASF2157:
+	.string	"SBAS_MSAS"
+.LASF1831:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1966:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1328:
+	.string	"TELEMETRY_HOTT "
+.LASF819:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF958:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt"
+.LASF749:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF2068:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1546:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2583:
+	.string	"GPSLEDTime"
+.LASF1277:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF794:
+	.string	"_MATH_H 1"
+.LASF709:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1470:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1940:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1681:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1434:
+	.string	"_T_PTRDIFF_ "
+.LASF1428:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1595:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF808:
+	.string	"__DECL_SIMD_sinl "
+.LASF1930:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1587:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1391:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF810:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1559:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1074:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2202:
+	.string	"state_ts"
+.LASF2076:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1186:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1572:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1531:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2390:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1444:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF829:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1707:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1497:
+	.string	"VERY_FAST_MATH "
+.LASF1579:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF2011:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1501:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF747:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1199:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2484:
+	.string	"elev"
+.LASF2087:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1332:
+	.string	"CMS "
+.LASF1921:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1946:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2019:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2396:
+	.string	"PID_YAW"
+.LASF1912:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF828:
+	.string	"__DECL_SIMD_logl "
+.LASF2047:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2228:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2247:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2311:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF817:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh"
+.LASF1553:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1986:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1065:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1715:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF782:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1528:
+	.string	"BIT(x) (1 << (x))"
+.LASF2252:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2064:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1100:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1414:
+	.string	"TELEMETRY_IBUS"
+.LASF2289:
+	.string	"rxBufferHead"
+.LASF836:
+	.string	"__DECL_SIMD_exp "
+.LASF2207:
+	.string	"gpsSol"
+.LASF2441:
+	.string	"latitude"
+.LASF1046:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1171:
+	.string	"__DECL_SIMD_tan"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1229:
+	.string	"_Mdouble_"
+.LASF2130:
+	.string	"int32_t"
+.LASF1177:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2354:
+	.string	"functionMask"
+.LASF2466:
+	.string	"ecef_y_velocity"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1998:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1496:
+	.string	"FAST_MATH "
+.LASF1375:
+	.string	"BARO "
+.LASF1275:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1086:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF2303:
+	.string	"beginWrite"
+.LASF1517:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF2472:
+	.string	"ubx_nav_solution"
+.LASF2456:
+	.string	"time_to_first_fix"
+.LASF733:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF2033:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2260:
+	.string	"OWNER_SPI_PREINIT"
+.LASF838:
+	.string	"__DECL_SIMD_expl "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF2081:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1686:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1422:
+	.string	"USE_I2C"
+.LASF2419:
+	.string	"gpsPacketLogChar"
+.LASF1739:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"__HAVE_FLOAT64 1"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2072:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1421:
+	.string	"VTX_TRAMP"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2249:
+	.string	"OWNER_BARO_EXTI"
+.LASF1091:
+	.string	"__DECL_SIMD_acos"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1761:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__always_inline"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1021:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2166:
+	.string	"GPS_AUTOCONFIG_ON"
+.LASF2263:
+	.string	"MODE_RX"
+.LASF935:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1078:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1398:
+	.string	"USE_PWM"
+.LASF1487:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1695:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2452:
+	.string	"ubx_nav_posllh"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1527:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1796:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2227:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1592:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1230:
+	.string	"__MATH_PRECNAME"
+.LASF971:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10"
+.LASF1605:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1135:
+	.string	"__DECL_SIMD_log10"
+.LASF2140:
+	.string	"PGR_SIZE_MASK"
+.LASF1240:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1"
+.LASF1262:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF903:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1104:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1253:
+	.string	"__MATHDECL"
+.LASF1233:
+	.string	"_Mdouble_ float"
+.LASF2336:
+	.string	"BAUD_2000000"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1644:
+	.string	"LED0_TOGGLE NOOP"
+.LASF1985:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2368:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1762:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"VTX_COMMON"
+.LASF1071:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1130:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1340:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2513:
+	.string	"FIX_3D"
+.LASF2313:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF748:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF775:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2156:
+	.string	"SBAS_WAAS"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1654:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1266:
+	.string	"__MATHCALL_NARROW"
+.LASF2205:
+	.string	"gpsPacketLog"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2066:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1863:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1339:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2169:
+	.string	"GPS_AUTOBAUD_ON"
+.LASF1949:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1251:
+	.string	"__MATHDECL_1"
+.LASF1144:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1803:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF2014:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2170:
+	.string	"gpsAutoBaud_e"
+.LASF1128:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2423:
+	.string	"gpsInitData_t"
+.LASF2422:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1840:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF708:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1624:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1203:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF398:
+	.string	"false 0"
+.LASF1017:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2421:
+	.string	"gpsInitData_s"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1548:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF786:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF2012:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2264:
+	.string	"MODE_TX"
+.LASF1187:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1730:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF2534:
+	.string	"svinfo"
+.LASF1099:
+	.string	"__DECL_SIMD_asin"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2584:
+	.string	"gpsInitUblox"
+.LASF1520:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1550:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1997:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2071:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF896:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1756:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1931:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2385:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1567:
+	.string	"PG_PID_PROFILE 14"
+.LASF1877:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1855:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1225:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1465:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2372:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2414:
+	.string	"SENSOR_BARO"
+.LASF1650:
+	.string	"LED2_TOGGLE NOOP"
+.LASF2099:
+	.string	"LOG_UBLOX_STATUS 'S'"
+.LASF2529:
+	.string	"_new_speed"
+.LASF1025:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2162:
+	.string	"GPS_BAUDRATE_38400"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2406:
+	.string	"airmodeWasActivated"
+.LASF1179:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2232:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1416:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2085:
+	.string	"PIDSUM_LIMIT 500"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1972:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"_SIZE_T_DECLARED "
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1838:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1584:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1628:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2152:
+	.string	"GPS_UBLOX"
+.LASF2299:
+	.string	"serialSetBaudRate"
+.LASF2220:
+	.string	"OWNER_SERVO"
+.LASF1530:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF720:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1369:
+	.string	"ACC "
+.LASF1070:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1566:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF711:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2013:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1335:
+	.string	"TELEMETRY_IBUS "
+.LASF1314:
+	.string	"USE_PWM "
+.LASF921:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2172:
+	.string	"gpsConfig_s"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1525:
+	.string	"PP_IIF_0(t,f) f"
+.LASF997:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1660:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1164:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1729:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1713:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1817:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2512:
+	.string	"FIX_2D"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF855:
+	.string	"__DECL_SIMD_powf128x "
+.LASF704:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1716:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2369:
+	.string	"FEATURE_SONAR"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1943:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2511:
+	.string	"FIX_DEAD_RECKONING"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1396:
+	.string	"USE_VCP"
+.LASF946:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2092:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2122:
+	.string	"__int16_t"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2104:
+	.string	"GPS_TIMEOUT (2500)"
+.LASF2124:
+	.string	"__uint16_t"
+.LASF1202:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2589:
+	.string	"gpsPortConfig"
+.LASF2285:
+	.string	"rxBufferSize"
+.LASF2219:
+	.string	"OWNER_MOTOR"
+.LASF922:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2595:
+	.string	"gpsConfig"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2502:
+	.string	"MSG_SOL"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1466:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2059:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2314:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1764:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1505:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2505:
+	.string	"MSG_CFG_PRT"
+.LASF2246:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1365:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF967:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1841:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2067:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1288:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1472:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF2545:
+	.string	"serialPrint"
+.LASF861:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2291:
+	.string	"txBufferHead"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2328:
+	.string	"BAUD_230400"
+.LASF1867:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2381:
+	.string	"FEATURE_AIRMODE"
+.LASF2519:
+	.string	"_ck_a"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF923:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2077:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1377:
+	.string	"USE_FLASHFS "
+.LASF1775:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF2015:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1810:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2168:
+	.string	"GPS_AUTOBAUD_OFF"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1495:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2539:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF893:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2176:
+	.string	"autoBaud"
+.LASF2334:
+	.string	"BAUD_1000000"
+.LASF1974:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF765:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF2483:
+	.string	"quality"
+.LASF1198:
+	.string	"__f32x(x) x ##f32x"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1250:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2097:
+	.string	"LOG_NMEA_RMC 'r'"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1880:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1295:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF2556:
+	.string	"UBLOX_parse_gps"
+.LASF1632:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1515:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF739:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1264:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1629:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1826:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1345:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1701:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2116:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1906:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1714:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF736:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF853:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2364:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1843:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF2363:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1639:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1642:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1166:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1441:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1904:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2111:
+	.string	"NO_FRAME 0"
+.LASF1080:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1368:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1353:
+	.string	"USE_NAV "
+.LASF1585:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1599:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF364:
+	.string	"__k8 1"
+.LASF1309:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1733:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1568:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1367:
+	.string	"USE_FAKE_LED "
+.LASF2135:
+	.string	"float"
+.LASF2281:
+	.string	"identifier"
+.LASF2193:
+	.string	"gpsMessageState_e"
+.LASF1563:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1720:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1868:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1455:
+	.string	"___int_wchar_t_h "
+.LASF1156:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2302:
+	.string	"writeBuf"
+.LASF756:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF1371:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1619:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2470:
+	.string	"satellites"
+.LASF2109:
+	.string	"UBLOX_SBAS_PREFIX_LENGTH 10"
+.LASF2547:
+	.string	"serialGetBaudRate"
+.LASF1516:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF2198:
+	.string	"timeouts"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1786:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2319:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1675:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1732:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF879:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1433:
+	.string	"_PTRDIFF_T "
+.LASF2171:
+	.string	"pgRegistry_s"
+.LASF2147:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1068:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2366:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1471:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1479:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2304:
+	.string	"endWrite"
+.LASF2306:
+	.string	"FUNCTION_NONE"
+.LASF1146:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF975:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF793:
+	.string	"_STRINGS_H 1"
+.LASF1491:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF944:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1656:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1774:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1331:
+	.string	"USE_SERVOS "
+.LASF2335:
+	.string	"BAUD_1500000"
+.LASF2531:
+	.string	"status"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF2204:
+	.string	"gpsData_t"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2028:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2258:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1325:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1965:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF869:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2573:
+	.string	"svSatParam"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2188:
+	.string	"gpsSolutionData_t"
+.LASF1630:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1570:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2387:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF1237:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1274:
+	.string	"FP_NORMAL 4"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1801:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2565:
+	.string	"offset"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1452:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2524:
+	.string	"_payload_length"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1922:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1322:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2451:
+	.string	"vertical_accuracy"
+.LASF2324:
+	.string	"BAUD_19200"
+.LASF1886:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1477:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1779:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2241:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF2286:
+	.string	"txBufferSize"
+.LASF2158:
+	.string	"SBAS_GAGAN"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1712:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1252:
+	.string	"__MATHDECL_ALIAS"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF917:
+	.string	"__DECL_SIMD_coshf "
+.LASF2151:
+	.string	"GPS_NMEA"
+.LASF772:
+	.string	"__SIZE_T__ "
+.LASF998:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF2321:
+	.string	"serialPortFunction_e"
+.LASF1256:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1903:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1845:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1717:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1272:
+	.string	"FP_ZERO 2"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1806:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1823:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1748:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2114:
+	.string	"FRAME_GSV 3"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2138:
+	.string	"PGR_PGN_MASK"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1814:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2282:
+	.string	"mode"
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1333:
+	.string	"TELEMETRY_LTM "
+.LASF1224:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1227:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2454:
+	.string	"fix_status"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2383:
+	.string	"FEATURE_RX_SPI"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2298:
+	.string	"serialRead"
+.LASF2038:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF2174:
+	.string	"sbasMode"
+.LASF1967:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1364:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF764:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF805:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2481:
+	.string	"svid"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF968:
+	.string	"__DECL_SIMD_log10l "
+.LASF2293:
+	.string	"rxCallback"
+.LASF1657:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF2577:
+	.string	"gpsNewFrame"
+.LASF2050:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1978:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1700:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2356:
+	.string	"gps_baudrateIndex"
+.LASF1626:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF845:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1704:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF755:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf"
+.LASF2018:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2582:
+	.string	"updateGpsIndicator"
+.LASF2287:
+	.string	"rxBuffer"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1964:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF796:
+	.string	"__DECL_SIMD_cos "
+.LASF2272:
+	.string	"SERIAL_PARITY_NO"
+.LASF2566:
+	.string	"parity"
+.LASF1281:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1142:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1784:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"STACK_CHECK"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF955:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2251:
+	.string	"OWNER_USB_DETECT"
+.LASF974:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1999:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF877:
+	.string	"__DECL_SIMD_asinf "
+.LASF1429:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1651:
+	.string	"LED2_OFF NOOP"
+.LASF1672:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2143:
+	.string	"size"
+.LASF2098:
+	.string	"LOG_UBLOX_SOL 'O'"
+.LASF762:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF2029:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2496:
+	.string	"CLASS_ACK"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2409:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2430:
+	.string	"ubloxSbas"
+.LASF1918:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1610:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1162:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF2471:
+	.string	"res2"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1484:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1257:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2359:
+	.string	"serialPortConfig_t"
+.LASF1363:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf"
+.LASF2148:
+	.string	"timeMs_t"
+.LASF1115:
+	.string	"__DECL_SIMD_cosh"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF844:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF835:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1114:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF797:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2575:
+	.string	"grab_fields"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1160:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2042:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2530:
+	.string	"posllh"
+.LASF2376:
+	.string	"FEATURE_DASHBOARD"
+.LASF1791:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF785:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1538:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1294:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF780:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2250:
+	.string	"OWNER_USB"
+.LASF2255:
+	.string	"OWNER_INVERTER"
+.LASF1291:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2134:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2236:
+	.string	"OWNER_SPI_MOSI"
+.LASF735:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1182:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2021:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2142:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2131:
+	.string	"uint8_t"
+.LASF1216:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2427:
+	.string	"ubloxSbas_s"
+.LASF2429:
+	.string	"ubloxSbas_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2082:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2360:
+	.string	"serialConsumer"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2559:
+	.string	"ck_a"
+.LASF790:
+	.string	"NULL"
+.LASF1782:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1809:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1489:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1522:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2588:
+	.string	"gpsInit"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2410:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1850:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"TELEMETRY "
+.LASF1857:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF862:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1722:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1150:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1168:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF2434:
+	.string	"GPS_CONFIGURE"
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1016:
+	.string	"__DECL_SIMD_erf "
+.LASF928:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1892:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2564:
+	.string	"param"
+.LASF2044:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2395:
+	.string	"PID_PITCH"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1457:
+	.string	"_GCC_WCHAR_T "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2465:
+	.string	"ecef_x_velocity"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1410:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1637:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1960:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2191:
+	.string	"GPS_MESSAGE_STATE_SBAS"
+.LASF1873:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1271:
+	.string	"FP_INFINITE 1"
+.LASF1261:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF916:
+	.string	"__DECL_SIMD_cosh "
+.LASF1263:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2362:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF806:
+	.string	"__DECL_SIMD_sin "
+.LASF1898:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2341:
+	.string	"SERIAL_PORT_USART1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF2342:
+	.string	"SERIAL_PORT_USART2"
+.LASF2084:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1167:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1181:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1933:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1090:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1687:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF789:
+	.string	"__need_size_t"
+.LASF1172:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2344:
+	.string	"SERIAL_PORT_UART4"
+.LASF2345:
+	.string	"SERIAL_PORT_UART5"
+.LASF2179:
+	.string	"gpsConfig_Copy"
+.LASF1678:
+	.string	"IOCFG_IPD 0"
+.LASF1443:
+	.string	"__need_ptrdiff_t"
+.LASF849:
+	.string	"__DECL_SIMD_powf16 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1206:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1304:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF918:
+	.string	"__DECL_SIMD_coshl "
+.LASF1478:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2034:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1232:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1245:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1588:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1430:
+	.string	"_STDDEF_H "
+.LASF2445:
+	.string	"ground_course"
+.LASF1977:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1117:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1984:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1781:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2578:
+	.string	"gpsHandlePassthrough"
+.LASF802:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1311:
+	.string	"USE_SETTINGS_INDEX "
+.LASF710:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1804:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF834:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1664:
+	.string	"LON 1"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF2458:
+	.string	"ubx_nav_status"
+.LASF1614:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1234:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1744:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1578:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1805:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF1473:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1545:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1228:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1447:
+	.string	"_T_WCHAR_ "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF870:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1583:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2579:
+	.string	"gpsNewData"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2488:
+	.string	"numCh"
+.LASF1658:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1969:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF745:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF702:
+	.string	"__BIG_ENDIAN 4321"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1702:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2310:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1785:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1812:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2056:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf"
+.LASF1627:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1407:
+	.string	"LED_STRIP"
+.LASF1951:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1134:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1674:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1180:
+	.string	"__f128(x) x ##f128"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2450:
+	.string	"horizontal_accuracy"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1725:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1296:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1996:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1510:
+	.string	"NOOP do {} while (0)"
+.LASF2416:
+	.string	"SENSOR_SONAR"
+.LASF1721:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1641:
+	.string	"IO_TAG_NONE 0"
+.LASF1404:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2323:
+	.string	"BAUD_9600"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2379:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2557:
+	.string	"gpsEnablePassthrough"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF891:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2159:
+	.string	"sbasMode_e"
+.LASF1092:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1327:
+	.string	"TELEMETRY_FRSKY "
+.LASF1691:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF741:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1057:
+	.string	"__DECL_SIMD_tanf "
+.LASF2569:
+	.string	"gps_frame"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2459:
+	.string	"time_nsec"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2413:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF2487:
+	.string	"ubx_nav_svinfo_channel"
+.LASF2231:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2108:
+	.string	"DEFAULT_BAUD_RATE_INDEX 0"
+.LASF2317:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF2144:
+	.string	"address"
+.LASF1509:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1243:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2185:
+	.string	"groundSpeed"
+.LASF1876:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1936:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2312:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1822:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1236:
+	.string	"_Mdouble_ long double"
+.LASF798:
+	.string	"__DECL_SIMD_cosl "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1679:
+	.string	"IOCFG_IPU 0"
+.LASF1518:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF2536:
+	.string	"_buffer"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1366:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF2388:
+	.string	"GPS_FIX_HOME"
+.LASF759:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF2382:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2517:
+	.string	"NAV_STATUS_FIX_VALID"
+.LASF1987:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2010:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF788:
+	.string	"__size_t "
+.LASF2233:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1976:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2477:
+	.string	"speed_2d"
+.LASF2491:
+	.string	"channel"
+.LASF1807:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1777:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF468:
+	.string	"__PMT"
+.LASF2357:
+	.string	"blackbox_baudrateIndex"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1468:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2475:
+	.string	"ned_down"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2214:
+	.string	"GPS_svinfo_quality"
+.LASF1526:
+	.string	"PP_IIF_1(t,f) t"
+.LASF2358:
+	.string	"telemetry_baudrateIndex"
+.LASF2436:
+	.string	"GPS_LOST_COMMUNICATION"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1511:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2267:
+	.string	"portOptions_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2025:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1024:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1356:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1602:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2035:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2329:
+	.string	"BAUD_250000"
+.LASF1287:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2307:
+	.string	"FUNCTION_MSP"
+.LASF1412:
+	.string	"USE_RESOURCE_MGMT"
+.LASF977:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2155:
+	.string	"SBAS_EGNOS"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1248:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1026:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2080:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1865:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2476:
+	.string	"speed_3d"
+.LASF2141:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1273:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1560:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2030:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2292:
+	.string	"txBufferTail"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1139:
+	.string	"__DECL_SIMD_log2"
+.LASF1323:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF738:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2330:
+	.string	"BAUD_400000"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1994:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1788:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1446:
+	.string	"_WCHAR_T "
+.LASF1405:
+	.string	"USE_SERIALRX_SUMH"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1218:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1482:
+	.string	"UNIT_TESTED "
+.LASF830:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2186:
+	.string	"groundCourse"
+.LASF2102:
+	.string	"LOG_UBLOX_VELNED 'V'"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1919:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF875:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2384:
+	.string	"FEATURE_SOFTSPI"
+.LASF1081:
+	.string	"__DECL_SIMD_logf"
+.LASF1094:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2510:
+	.string	"FIX_NONE"
+.LASF874:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1757:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF2592:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1194:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1554:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1862:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1543:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF718:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF774:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1759:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF2551:
+	.string	"memset"
+.LASF1244:
+	.string	"_Mdouble_ _Float128"
+.LASF1208:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF757:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1635:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1045:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1617:
+	.string	"PG_PID_CONFIG 504"
+.LASF1832:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2002:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1816:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1137:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2073:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF2006:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1625:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1319:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1698:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1670:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1939:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1825:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF2528:
+	.string	"_new_position"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF717:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF988:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1649:
+	.string	"LED1_ON NOOP"
+.LASF2213:
+	.string	"GPS_svinfo_svid"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF2408:
+	.string	"SENSOR_INDEX_ACC"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2389:
+	.string	"GPS_FIX"
+.LASF2585:
+	.string	"newBaudRateIndex"
+.LASF1709:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2209:
+	.string	"GPS_packetCount"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF722:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF2518:
+	.string	"ubx_nav_status_bits"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1265:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1246:
+	.string	"_Mdouble_ _Float32x"
+.LASF2448:
+	.string	"altitude_ellipsoid"
+.LASF1490:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF2462:
+	.string	"ecef_y"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF937:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1769:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1750:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF882:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1710:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF850:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2161:
+	.string	"GPS_BAUDRATE_57600"
+.LASF981:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2265:
+	.string	"MODE_RXTX"
+.LASF1417:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF866:
+	.string	"__DECL_SIMD_atan "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1920:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1380:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF731:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1852:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2146:
+	.string	"reset"
+.LASF1131:
+	.string	"__DECL_SIMD_atan2"
+.LASF2101:
+	.string	"LOG_UBLOX_POSLLH 'P'"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1561:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1723:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1512:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1811:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF883:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1652:
+	.string	"LED2_ON NOOP"
+.LASF2239:
+	.string	"OWNER_SDCARD"
+.LASF1298:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF986:
+	.string	"__DECL_SIMD_log1p "
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF768:
+	.string	"_STRING_H 1"
+.LASF2509:
+	.string	"ubx_protocol_bytes"
+.LASF1058:
+	.string	"__DECL_SIMD_tanl "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2039:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1282:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2460:
+	.string	"week"
+.LASF2129:
+	.string	"int16_t"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1598:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf"
+.LASF2486:
+	.string	"prRes"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2563:
+	.string	"frameOK"
+.LASF2117:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2120:
+	.string	"signed char"
+.LASF1195:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1537:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF831:
+	.string	"__DECL_SIMD_logf64 "
+.LASF814:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1731:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF2054:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF930:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF771:
+	.string	"__size_t__ "
+.LASF1329:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1268:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1330:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1361:
+	.string	"U_ID_1 1"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1390:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1454:
+	.string	"_WCHAR_T_H "
+.LASF1982:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1569:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF792:
+	.string	"__need_NULL"
+.LASF1122:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF2374:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2269:
+	.string	"SERIAL_INVERTED"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1494:
+	.string	"sq(x) ((x)*(x))"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF982:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1532:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1945:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2440:
+	.string	"gpsDataNmea_s"
+.LASF2446:
+	.string	"gpsDataNmea_t"
+.LASF2070:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1096:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1197:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF779:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1963:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1773:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1393:
+	.string	"USE_DASHBOARD"
+.LASF2480:
+	.string	"ubx_nav_velned"
+.LASF1663:
+	.string	"LAT 0"
+.LASF1354:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1299:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1793:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2504:
+	.string	"MSG_SVINFO"
+.LASF978:
+	.string	"__DECL_SIMD_log2l "
+.LASF737:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF2115:
+	.string	"UBLOX_PAYLOAD_SIZE 344"
+.LASF2051:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2495:
+	.string	"CLASS_NAV"
+.LASF1577:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2537:
+	.string	"serialPassthrough"
+.LASF2415:
+	.string	"SENSOR_MAG"
+.LASF1351:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2350:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2351:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1425:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2405:
+	.string	"SystemCoreClock"
+.LASF1095:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1888:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1474:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1467:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1426:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1581:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF2283:
+	.string	"options"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2195:
+	.string	"state"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1983:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1324:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1740:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1432:
+	.string	"_ANSI_STDDEF_H "
+.LASF2548:
+	.string	"openSerialPort"
+.LASF1636:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1790:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2253:
+	.string	"OWNER_OSD"
+.LASF822:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2497:
+	.string	"CLASS_CFG"
+.LASF1742:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1954:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2037:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2139:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF832:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2003:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"__DECL_SIMD_expf"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1620:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1302:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1290:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2485:
+	.string	"azim"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1705:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2078:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1207:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF847:
+	.string	"__DECL_SIMD_powf "
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1539:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1317:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1685:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF823:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1348:
+	.string	"VTX_SMARTAUDIO "
+.LASF826:
+	.string	"__DECL_SIMD_log "
+.LASF1196:
+	.string	"__f32(x) x ##f32"
+.LASF723:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1492:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1540:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF728:
+	.string	"isascii(c) __isascii (c)"
+.LASF2399:
+	.string	"PID_POSR"
+.LASF2100:
+	.string	"LOG_UBLOX_SVINFO 'I'"
+.LASF2400:
+	.string	"PID_NAVR"
+.LASF1794:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF763:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1456:
+	.string	"__INT_WCHAR_T_H "
+.LASF1677:
+	.string	"IOCFG_AF_OD 0"
+.LASF2428:
+	.string	"message"
+.LASF2275:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1834:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1388:
+	.string	"USE_UART8 "
+.LASF839:
+	.string	"__DECL_SIMD_expf16 "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1711:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1734:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF2349:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1992:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1909:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF2377:
+	.string	"FEATURE_OSD"
+.LASF1606:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF983:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1352:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2447:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2210:
+	.string	"GPS_svInfoReceivedCount"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2343:
+	.string	"SERIAL_PORT_USART3"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1140:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2346:
+	.string	"SERIAL_PORT_USART6"
+.LASF2347:
+	.string	"SERIAL_PORT_USART7"
+.LASF2348:
+	.string	"SERIAL_PORT_USART8"
+.LASF1724:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2296:
+	.string	"serialTotalRxWaiting"
+.LASF1647:
+	.string	"LED1_TOGGLE NOOP"
+.LASF1692:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2112:
+	.string	"FRAME_GGA 1"
+.LASF1580:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF2478:
+	.string	"heading_2d"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF2432:
+	.string	"GPS_INITIALIZING"
+.LASF1214:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1799:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot"
+.LASF1573:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf"
+.LASF2196:
+	.string	"baudrateIndex"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2088:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF979:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1618:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF2211:
+	.string	"GPS_numCh"
+.LASF1703:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1506:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1015:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF2229:
+	.string	"OWNER_PINDEBUG"
+.LASF1662:
+	.string	"DASHBOARD_I2C_ADDRESS 0x3C"
+.LASF2178:
+	.string	"gpsConfig_System"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2026:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF2590:
+	.string	"gpsSetState"
+.LASF1507:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2075:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1631:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1136:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1334:
+	.string	"TELEMETRY_CRSF "
+.LASF1437:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1118:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2325:
+	.string	"BAUD_38400"
+.LASF1463:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1753:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2418:
+	.string	"SENSOR_GPSMAG"
+.LASF2105:
+	.string	"GPS_INIT_ENTRIES (GPS_BAUDRATE_MAX + 1)"
+.LASF1772:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1378:
+	.string	"USE_FAKE_FLASH "
+.LASF1818:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2200:
+	.string	"lastLastMessage"
+.LASF1220:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1891:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1564:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1837:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1925:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1819:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1513:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1521:
+	.string	"EXPAND_I(x) x"
+.LASF1552:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1885:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1411:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1226:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2133:
+	.string	"uint32_t"
+.LASF2184:
+	.string	"GPS_altitude"
+.LASF777:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF878:
+	.string	"__DECL_SIMD_asinl "
+.LASF1549:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2000:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"U_ID_0 0"
+.LASF2290:
+	.string	"rxBufferTail"
+.LASF1158:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1200:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1293:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1464:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1900:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2160:
+	.string	"GPS_BAUDRATE_115200"
+.LASF976:
+	.string	"__DECL_SIMD_log2 "
+.LASF1462:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2464:
+	.string	"position_accuracy_3d"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2587:
+	.string	"gpsInitNmea"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1680:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF716:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF995:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2594:
+	.string	"millis"
+.LASF776:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p"
+.LASF2479:
+	.string	"heading_accuracy"
+.LASF1201:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1255:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1927:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2300:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF2558:
+	.string	"_update_checksum"
+.LASF2555:
+	.string	"gpsNewFrameUBLOX"
+.LASF1502:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1436:
+	.string	"__PTRDIFF_T "
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1970:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2493:
+	.string	"PREAMBLE1"
+.LASF2494:
+	.string	"PREAMBLE2"
+.LASF1916:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF2469:
+	.string	"position_DOP"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1408:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1289:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1483:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1653:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1596:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2514:
+	.string	"FIX_GPS_DEAD_RECKONING"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1556:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1357:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF815:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1102:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1320:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2230:
+	.string	"OWNER_TIMER"
+.LASF1780:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF2457:
+	.string	"uptime"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1597:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1307:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1958:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1673:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1934:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"USE_FAKE_MAG "
+.LASF1820:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF725:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1089:
+	.string	"__DECL_SIMD_powf"
+.LASF2022:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1980:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1350:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2128:
+	.string	"char"
+.LASF1258:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF972:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1459:
+	.string	"__DEFINED_wchar_t "
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2055:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2593:
+	.string	"onGpsNewData"
+.LASF1427:
+	.string	"DEFIO_NO_PORTS "
+.LASF1915:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2339:
+	.string	"baudRates"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1676:
+	.string	"IOCFG_AF_PP 0"
+.LASF2586:
+	.string	"gpsInitHardware"
+.LASF2498:
+	.string	"MSG_ACK_NACK"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1745:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF886:
+	.string	"__DECL_SIMD_hypot "
+.LASF740:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1211:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2431:
+	.string	"GPS_UNKNOWN"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF926:
+	.string	"__DECL_SIMD_expm1 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2223:
+	.string	"OWNER_ADC_BATT"
+.LASF801:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF2127:
+	.string	"long int"
+.LASF865:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1737:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1640:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2340:
+	.string	"SERIAL_PORT_NONE"
+.LASF1864:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2242:
+	.string	"OWNER_FLASH_CS"
+.LASF2212:
+	.string	"GPS_svinfo_chn"
+.LASF1406:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1342:
+	.string	"USE_RX_MSP "
+.LASF1894:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF699:
+	.string	"_CTYPE_H 1"
+.LASF397:
+	.string	"true 1"
+.LASF2208:
+	.string	"GPS_update"
+.LASF803:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1802:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF555:
+	.string	"__stub_stty "
+.LASF2542:
+	.string	"sensors"
+.LASF2165:
+	.string	"GPS_AUTOCONFIG_OFF"
+.LASF857:
+	.string	"__DECL_SIMD_acosf "
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF781:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2500:
+	.string	"MSG_POSLLH"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2570:
+	.string	"svMessageNum"
+.LASF843:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2145:
+	.string	"copy"
+.LASF2093:
+	.string	"LOG_ERROR '?'"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF2533:
+	.string	"velned"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2468:
+	.string	"speed_accuracy"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1184:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1485:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF852:
+	.string	"__DECL_SIMD_powf128 "
+.LASF770:
+	.string	"__need_NULL "
+.LASF2532:
+	.string	"solution"
+.LASF2332:
+	.string	"BAUD_500000"
+.LASF945:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1116:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1305:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1399:
+	.string	"SERIAL_RX"
+.LASF1643:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF1488:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF938:
+	.string	"__DECL_SIMD_sinhl "
+.LASF743:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1589:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2394:
+	.string	"PID_ROLL"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF881:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2094:
+	.string	"LOG_IGNORED '!'"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF791:
+	.string	"NULL ((void *)0)"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf"
+.LASF769:
+	.string	"__need_size_t "
+.LASF1037:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1519:
+	.string	"STR_HELPER(x) #x"
+.LASF1846:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2506:
+	.string	"MSG_CFG_RATE"
+.LASF2365:
+	.string	"FEATURE_SERVO_TILT"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1594:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1420:
+	.string	"VTX_SMARTAUDIO"
+.LASF2274:
+	.string	"SERIAL_UNIDIR"
+.LASF2426:
+	.string	"ubloxSbasPrefix"
+.LASF2234:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1341:
+	.string	"USE_RCSPLIT "
+.LASF2571:
+	.string	"svSatNum"
+.LASF2226:
+	.string	"OWNER_ADC_RSSI"
+.LASF1480:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1957:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1856:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1106:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF907:
+	.string	"__DECL_SIMD_exp10f "
+.LASF840:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2079:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2106:
+	.string	"GPS_BAUDRATE_CHANGE_DELAY (200)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1895:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1461:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1683:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1435:
+	.string	"_T_PTRDIFF "
+.LASF871:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1768:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1098:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1006:
+	.string	"__DECL_SIMD_acosh "
+.LASF2090:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1170:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2262:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1476:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1370:
+	.string	"USE_FAKE_ACC "
+.LASF1440:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1971:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF377:
+	.string	"__linux 1"
+.LASF712:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1267:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2001:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1937:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1300:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1883:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1270:
+	.string	"FP_NAN 0"
+.LASF2433:
+	.string	"GPS_CHANGE_BAUD"
+.LASF2199:
+	.string	"lastMessage"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1853:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"__DECL_SIMD_erff32 "
+.LASF963:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2032:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF919:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1286:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1313:
+	.string	"USE_PPM "
+.LASF1847:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2353:
+	.string	"serialPortConfig_s"
+.LASF2164:
+	.string	"GPS_BAUDRATE_9600"
+.LASF1766:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF713:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1222:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1638:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2439:
+	.string	"gpsConfig_Registry"
+.LASF744:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2040:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2438:
+	.string	"pgResetTemplate_gpsConfig"
+.LASF1798:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2271:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1132:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2453:
+	.string	"fix_type"
+.LASF1571:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2237:
+	.string	"OWNER_I2C_SCL"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF705:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1981:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1514:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2520:
+	.string	"_ck_b"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF927:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1486:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1646:
+	.string	"LED0_ON NOOP"
+.LASF1789:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF833:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1607:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF2580:
+	.string	"gpsUpdate"
+.LASF1547:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1533:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1907:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2538:
+	.string	"serialSetMode"
+.LASF1609:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF2337:
+	.string	"BAUD_2470000"
+.LASF2521:
+	.string	"_skip_packet"
+.LASF1308:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1205:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF987:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1771:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF2183:
+	.string	"numSat"
+.LASF1297:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF758:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF719:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1312:
+	.string	"USE_CLI_BATCH "
+.LASF1948:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2136:
+	.string	"double"
+.LASF1223:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2443:
+	.string	"altitude"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF859:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF766:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1529:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1778:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF703:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2235:
+	.string	"OWNER_SPI_MISO"
+.LASF1735:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2259:
+	.string	"OWNER_COMPASS_CS"
+.LASF1450:
+	.string	"_WCHAR_T_ "
+.LASF1372:
+	.string	"USE_FAKE_GYRO "
+.LASF1859:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2526:
+	.string	"next_fix"
+.LASF2089:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1557:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2373:
+	.string	"FEATURE_RX_MSP"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1747:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1451:
+	.string	"_BSD_WCHAR_T_ "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1303:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF2367:
+	.string	"FEATURE_GPS"
+.LASF2391:
+	.string	"SMALL_ANGLE"
+.LASF2023:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2444:
+	.string	"speed"
+.LASF2437:
+	.string	"gpsState_e"
+.LASF2515:
+	.string	"FIX_TIME"
+.LASF2154:
+	.string	"SBAS_AUTO"
+.LASF1285:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1634:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2125:
+	.string	"__int32_t"
+.LASF1212:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2238:
+	.string	"OWNER_I2C_SDA"
+.LASF2126:
+	.string	"__uint32_t"
+.LASF867:
+	.string	"__DECL_SIMD_atanf "
+.LASF1504:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2549:
+	.string	"featureClear"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF2553:
+	.string	"data"
+.LASF1961:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2375:
+	.string	"FEATURE_LED_STRIP"
+.LASF1409:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2507:
+	.string	"MSG_CFG_SET_RATE"
+.LASF1574:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1508:
+	.string	"Q12 (1 << 12)"
+.LASF2215:
+	.string	"GPS_svinfo_cno"
+.LASF1310:
+	.string	"USE_CLI "
+.LASF1157:
+	.string	"__DECL_SIMD_erff"
+.LASF1355:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2333:
+	.string	"BAUD_921600"
+.LASF2004:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1765:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF858:
+	.string	"__DECL_SIMD_acosl "
+.LASF1576:
+	.string	"PG_RX_CONFIG 24"
+.LASF1603:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1582:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1541:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1084:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2352:
+	.string	"serialPortIdentifier_e"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1718:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1110:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2392:
+	.string	"FIXED_WING"
+.LASF1036:
+	.string	"__DECL_SIMD_asinh "
+.LASF1318:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1154:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1221:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2355:
+	.string	"msp_baudrateIndex"
+.LASF707:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2288:
+	.string	"txBuffer"
+.LASF1448:
+	.string	"_T_WCHAR "
+.LASF753:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF1813:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"_SIZET_ "
+.LASF2041:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1952:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1800:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1022:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1760:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF884:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1431:
+	.string	"_STDDEF_H_ "
+.LASF1690:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2442:
+	.string	"longitude"
+.LASF876:
+	.string	"__DECL_SIMD_asin "
+.LASF2057:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2320:
+	.string	"FUNCTION_RCSPLIT"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2058:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1066:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1254:
+	.string	"__MATHCALL"
+.LASF970:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1935:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2455:
+	.string	"differential_status"
+.LASF730:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF2535:
+	.string	"bytes"
+.LASF2103:
+	.string	"GPS_SV_MAXSATS 16"
+.LASF1990:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2401:
+	.string	"PID_LEVEL"
+.LASF1301:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2254:
+	.string	"OWNER_RX_BIND"
+.LASF1608:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1023:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1347:
+	.string	"VTX_CONTROL "
+.LASF996:
+	.string	"__DECL_SIMD_atanh "
+.LASF809:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1460:
+	.string	"_BSD_WCHAR_T_"
+.LASF2257:
+	.string	"OWNER_TRANSPONDER"
+.LASF1575:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF752:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1213:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2107:
+	.string	"GPS_INIT_DATA_ENTRY_COUNT (sizeof(gpsInitData) / sizeof(gpsInitData[0]))"
+.LASF908:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1792:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1738:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1908:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF2203:
+	.string	"messageState"
+.LASF1500:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1910:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1438:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1174:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh"
+.LASF2327:
+	.string	"BAUD_115200"
+.LASF1349:
+	.string	"VTX_TRAMP "
+.LASF1887:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF2552:
+	.string	"gpsPassthroughPort"
+.LASF2294:
+	.string	"serialPortVTable"
+.LASF925:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF887:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1126:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2270:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2308:
+	.string	"FUNCTION_GPS"
+.LASF872:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1746:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2266:
+	.string	"portMode_t"
+.LASF750:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF1276:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2149:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1611:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF965:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2523:
+	.string	"_msg_id"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF851:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2083:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF2315:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF1152:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1942:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2244:
+	.string	"OWNER_MPU_CS"
+.LASF2137:
+	.string	"pgn_t"
+.LASF2163:
+	.string	"GPS_BAUDRATE_19200"
+.LASF1622:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1176:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2190:
+	.string	"GPS_MESSAGE_STATE_INIT"
+.LASF2005:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2544:
+	.string	"serialRxBytesWaiting"
+.LASF873:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1645:
+	.string	"LED0_OFF NOOP"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2096:
+	.string	"LOG_NMEA_GGA 'g'"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1373:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF897:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF813:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1534:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f"
+.LASF2525:
+	.string	"_payload_counter"
+.LASF1204:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2435:
+	.string	"GPS_RECEIVING_DATA"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1175:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2278:
+	.string	"serialReceiveCallbackPtr"
+.LASF1387:
+	.string	"USE_UART7 "
+.LASF1669:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1633:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF2007:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF729:
+	.string	"toascii(c) __toascii (c)"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1239:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1655:
+	.string	"I2CDEV_COUNT 4"
+.LASF1558:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2574:
+	.string	"checksum"
+.LASF2572:
+	.string	"svPacketIdx"
+.LASF1019:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2543:
+	.string	"sensorsClear"
+.LASF1072:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1503:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF2180:
+	.string	"gpsLocation_s"
+.LASF2181:
+	.string	"gpsLocation_t"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1535:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF924:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF931:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1870:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1889:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1844:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1835:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2206:
+	.string	"gpsData"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF2516:
+	.string	"ubs_nav_fix_type"
+.LASF2216:
+	.string	"OWNER_FREE"
+.LASF906:
+	.string	"__DECL_SIMD_exp10 "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1726:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF920:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF894:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2062:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2403:
+	.string	"PID_VEL"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF811:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1493:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1797:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1993:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2279:
+	.string	"serialPort_s"
+.LASF2305:
+	.string	"serialPort_t"
+.LASF2217:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1193:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf"
+.LASF2322:
+	.string	"BAUD_AUTO"
+.LASF1763:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"serialTotalTxFree"
+.LASF854:
+	.string	"__DECL_SIMD_powf64x "
+.LASF804:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1481:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF868:
+	.string	"__DECL_SIMD_atanl "
+.LASF2277:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1795:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1741:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1439:
+	.string	"___int_ptrdiff_t_h "
+.LASF2467:
+	.string	"ecef_z_velocity"
+.LASF1475:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF966:
+	.string	"__DECL_SIMD_log10 "
+.LASF999:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1749:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2086:
+	.string	"PIDSUM_LIMIT_YAW 400"
+.LASF734:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF2461:
+	.string	"ecef_x"
+.LASF905:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2463:
+	.string	"ecef_z"
+.LASF1659:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2546:
+	.string	"lookupBaudRateIndex"
+.LASF807:
+	.string	"__DECL_SIMD_sinf "
+.LASF939:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2045:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF860:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2091:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2550:
+	.string	"findSerialPortConfig"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1124:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1590:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1728:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF848:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF2501:
+	.string	"MSG_STATUS"
+.LASF1671:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF825:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2371:
+	.string	"FEATURE_3D"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2591:
+	.string	"shiftPacketLog"
+.LASF1359:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1562:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2240:
+	.string	"OWNER_SDCARD_CS"
+.LASF1242:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF724:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1968:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2424:
+	.string	"gpsInitData"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1668:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2567:
+	.string	"string"
+.LASF2412:
+	.string	"SENSOR_GYRO"
+.LASF1249:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF784:
+	.string	"__DEFINED_size_t "
+.LASF1315:
+	.string	"SERIAL_RX "
+.LASF742:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF2449:
+	.string	"altitude_msl"
+.LASF1689:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2489:
+	.string	"globalFlags"
+.LASF1400:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2284:
+	.string	"baudRate"
+.LASF1667:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1381:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1694:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2027:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1913:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1973:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2273:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1776:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2189:
+	.string	"GPS_MESSAGE_STATE_IDLE"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1751:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF726:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1623:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2261:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1924:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2318:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1389:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF888:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF799:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1321:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1666:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2187:
+	.string	"hdop"
+.LASF2119:
+	.string	"long unsigned int"
+.LASF2560:
+	.string	"ck_b"
+.LASF2256:
+	.string	"OWNER_LED_STRIP"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF767:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1382:
+	.string	"USE_UART2 "
+.LASF1346:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2398:
+	.string	"PID_POS"
+.LASF2402:
+	.string	"PID_MAG"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1665:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2404:
+	.string	"PID_ITEM_COUNT"
+.LASF1155:
+	.string	"__DECL_SIMD_erf"
+.LASF956:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1881:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2562:
+	.string	"gps_Msg"
+.LASF2576:
+	.string	"mult"
+.LASF1419:
+	.string	"VTX_CONTROL"
+.LASF818:
+	.string	"__DECL_SIMD_sincosl "
+.LASF732:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1210:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2411:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1338:
+	.string	"TELEMETRY_SRXL "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2123:
+	.string	"short int"
+.LASF2295:
+	.string	"serialWrite"
+.LASF1858:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2508:
+	.string	"MSG_CFG_NAV_SETTINGS"
+.LASF1593:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2541:
+	.string	"GPS_coord_to_degrees"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1661:
+	.string	"DASHBOARD_I2C_INSTANCE I2CDEV_1"
+.LASF898:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1383:
+	.string	"USE_UART3 "
+.LASF2499:
+	.string	"MSG_ACK_ACK"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1929:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1604:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1067:
+	.string	"__DECL_SIMD_cos"
+.LASF1449:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1615:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1787:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1379:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF2473:
+	.string	"ned_north"
+.LASF1544:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1087:
+	.string	"__DECL_SIMD_pow"
+.LASF2192:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT"
+.LASF2397:
+	.string	"PID_ALT"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2331:
+	.string	"BAUD_460800"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2243:
+	.string	"OWNER_BARO_CS"
+.LASF2201:
+	.string	"state_position"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1613:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1499:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2326:
+	.string	"BAUD_57600"
+.LASF1035:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2118:
+	.string	"unsigned int"
+.LASF2407:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1384:
+	.string	"USE_UART4 "
+.LASF1565:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2060:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1055:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2053:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1684:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF706:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF2386:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF957:
+	.string	"__DECL_SIMD_atan2f "
+.LASF816:
+	.string	"__DECL_SIMD_sincos "
+.LASF1586:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1991:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2276:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1696:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1469:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1621:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1088:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1928:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2222:
+	.string	"OWNER_ADC"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2248:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1082:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF842:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1018:
+	.string	"__DECL_SIMD_erfl "
+.LASF2009:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2420:
+	.string	"gpsPort"
+.LASF1959:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1385:
+	.string	"USE_UART5 "
+.LASF2561:
+	.string	"gpsNewFrameNMEA"
+.LASF1616:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2522:
+	.string	"_step"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2378:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF773:
+	.string	"_SIZE_T "
+.LASF2568:
+	.string	"checksum_param"
+.LASF1415:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1727:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2225:
+	.string	"OWNER_ADC_EXT"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2425:
+	.string	"ubloxInit"
+.LASF1874:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2031:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1612:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1148:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2218:
+	.string	"OWNER_PPMINPUT"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1183:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2245:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2017:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1542:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1897:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1284:
+	.string	"M_E 2.7182818284590452354"
+.LASF2482:
+	.string	"flags"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1693:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1386:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1523:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF2069:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2668:
+	.string	"axis.h"
+.LASF2673:
+	.string	"io_types.h"
+.LASF2661:
+	.string	"mathcalls-helper-functions.h"
+.LASF2653:
+	.string	"math.h"
+.LASF2641:
+	.string	"long-double.h"
+.LASF2651:
+	.string	"__locale_t.h"
+.LASF2663:
+	.string	"platform.h"
+.LASF2662:
+	.string	"mathcalls.h"
+.LASF2625:
+	.string	"target.h"
+.LASF2659:
+	.string	"fp-logb.h"
+.LASF2655:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2635:
+	.string	"libc-header-start.h"
+.LASF2640:
+	.string	"cdefs.h"
+.LASF2610:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF0:
+	.string	"./src/main/io/gps.c"
+.LASF2648:
+	.string	"endian.h"
+.LASF2614:
+	.string	"stdint-intn.h"
+.LASF2674:
+	.string	"dashboard.h"
+.LASF2664:
+	.string	"common_fc_pre.h"
+.LASF2609:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2612:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2642:
+	.string	"stubs.h"
+.LASF2683:
+	.string	"sdcard.h"
+.LASF2682:
+	.string	"rx_pwm.h"
+.LASF2626:
+	.string	"sensors.h"
+.LASF2604:
+	.string	"src/main/target/SITL"
+.LASF2602:
+	.string	"src/main/io"
+.LASF2629:
+	.string	"feature.h"
+.LASF2624:
+	.string	"pid.h"
+.LASF2608:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2622:
+	.string	"config.h"
+.LASF2675:
+	.string	"bus_i2c.h"
+.LASF2652:
+	.string	"strings.h"
+.LASF2637:
+	.string	"features-time64.h"
+.LASF2685:
+	.string	"vcd.h"
+.LASF2684:
+	.string	"sound_beeper.h"
+.LASF2613:
+	.string	"types.h"
+.LASF2654:
+	.string	"math-vector.h"
+.LASF2657:
+	.string	"floatn-common.h"
+.LASF2656:
+	.string	"floatn.h"
+.LASF2623:
+	.string	"runtime_config.h"
+.LASF2633:
+	.string	"stdbool.h"
+.LASF2611:
+	.string	"/usr/include"
+.LASF2596:
+	.string	"src/main/build"
+.LASF2665:
+	.string	"common_fc_post.h"
+.LASF2676:
+	.string	"rcc_types.h"
+.LASF2636:
+	.string	"features.h"
+.LASF2601:
+	.string	"src/main/flight"
+.LASF2644:
+	.string	"typesizes.h"
+.LASF2597:
+	.string	"src/main/common"
+.LASF2621:
+	.string	"serial.h"
+.LASF2680:
+	.string	"adc.h"
+.LASF2598:
+	.string	"src/main/config"
+.LASF2628:
+	.string	"gps_conversion.h"
+.LASF2631:
+	.string	"navigation.h"
+.LASF2645:
+	.string	"time64.h"
+.LASF2615:
+	.string	"stdint-uintn.h"
+.LASF2605:
+	.string	"src/main/target"
+.LASF2670:
+	.string	"utils.h"
+.LASF2606:
+	.string	"src/main"
+.LASF2672:
+	.string	"light_led.h"
+.LASF2679:
+	.string	"io_def_generated.h"
+.LASF2603:
+	.string	"src/main/sensors"
+.LASF1:
+	.string	"/root/repo"
+.LASF2658:
+	.string	"flt-eval-method.h"
+.LASF2620:
+	.string	"resource.h"
+.LASF2678:
+	.string	"io_def.h"
+.LASF2618:
+	.string	"time.h"
+.LASF2671:
+	.string	"parameter_group_ids.h"
+.LASF2627:
+	.string	"gps.c"
+.LASF2646:
+	.string	"wchar.h"
+.LASF2660:
+	.string	"fp-fast.h"
+.LASF2619:
+	.string	"gps.h"
+.LASF2599:
+	.string	"src/main/drivers"
+.LASF2677:
+	.string	"io.h"
+.LASF2669:
+	.string	"maths.h"
+.LASF2639:
+	.string	"timesize.h"
+.LASF2630:
+	.string	"string.h"
+.LASF2607:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2650:
+	.string	"locale_t.h"
+.LASF2634:
+	.string	"stdint.h"
+.LASF2666:
+	.string	"build_config.h"
+.LASF2616:
+	.string	"stddef.h"
+.LASF2643:
+	.string	"stubs-64.h"
+.LASF2647:
+	.string	"ctype.h"
+.LASF2638:
+	.string	"wordsize.h"
+.LASF2600:
+	.string	"src/main/fc"
+.LASF2667:
+	.string	"debug.h"
+.LASF2617:
+	.string	"parameter_group.h"
+.LASF2649:
+	.string	"endianness.h"
+.LASF2632:
+	.string	"stdc-predef.h"
+.LASF2681:
+	.string	"flash.h"
+	.text
+	.section	.gnu.lto_.profile.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\362\005\305\023"
+	.string	"\364\023\346\006"
+	.string	"@"
+	.string	"\302\372\202\311\007\006\002"
+	.string	"\001\213\362\247\271\002r\002\001\002\001\003\002\003\002\004\002\005\006\002\005\002\007\002\007\002\002\006\b\t\007\213\326\277\344\004\003\240\342\234\212\n\004\005\006\b\t\n\013\f\r\016\017\352\263\360\321\b\020\277\330\344\275\016t\006\002\006\t\002\n"
+	.string	"\002\013\021\022\023\024\025\026\027\030\031\032\033\211\221\360\254\005\266\001"
+	.string	"\002\f\004\002\r\r\002\006\b\005\002\002\r\034\035\036\037 !\"#$\203\342\256\325\013\020\002\002\016\002\t\002\017\002\020\002\021\002\n%\207\245\203\341\004'(\373\351\266\224\005r\n\022\002\016\t\021\017\023\002\024\t\025\021\002\002\026\027\030\002)*\352\301\345\224\t+\234\247\312W,\341\313\326\317\016-\267\256\240\261\n.\300\370\237\271\004\f/0\357\303\216\341\006,\016\002\002\002\031\002\032\033\002\0311\232\356\240\354\n2\265\244\343\267\f\0023\343\376\252\366\003\0024\370\262\277\340\b5\307\216\315\331\0062\034\005\021\t\t\002\t67\360\237\325\371\006"
+	.string	"8\262\273\233\244\013\n\002\0359\327\327\240]\b\036\002\037:;<=\367\334\321\267\n>\332\260\306\224\006?@A\240\342\234\212\n"
+	.string	"\200\257\250\261\321\300Dd&I\2265p\202BTDn\022\240\222:\216\310\220\221\220\314\204\205\255\224\366\231\003\220\354~\0207 \333N{\004\001/\255\222\2219^\b\027q\2130\002\375\f\216\274\350\310\322)\b(\331r\202;\t\354\253\257\021\240\3343t\354a\276\212\210\254of\232A7VD\251\225gd\320\3233\242\323/`N]\342Ze\274\237\005\351yj\rs\347\335\207V\306\016"
+	.string	"\372o\233\336\305\207%Q\033\302^\377\203\346\236\002O\r\302e\004T\204\030Yo/aq3\304\337W\310\367S"
+	.string	"o\326v\2263\302|\211\301q\203s\\\005\202\273\212a\247c\235\335\357-\326\312\204\317F:\375\356\\\227\005LjV6\352\223\3071\213X{\023\224^\374\316\b\271\005bq\261)\317\364S4\230i\030~\217\310n\224\002XT;{]\270a([\357\346\350\332\201Y\261\223m"
+	.string	"s;l\330\302\240\310Ls\342\214\032~;\003\036J\300.D:#\320\354\223\315\263)\373i\327o\2433\312\226\303X\221s\334\217\373\276\345"
+	.ascii	"=\264Rx\203\n&\223Vs\204+\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\365\003"
+	.ascii	"\262D\r\024\240\2531\377\377?\320\246\357\237\203\b\313\260\374"
+	.ascii	"\260l)S\n\002\252\377\233\242W.\207N\217\273\243\215}3/\252$"
+	.ascii	"\310~\030\026\272K\fz\353\3744\005\017\002# \260\202I\353\006"
+	.ascii	"<\004\306W058.\037\305\001\022\343q\243\327\320Q\271\254uV\024"
+	.ascii	".\017\323\303\001\242\351s\330de\317\276\004\362\242\343\256"
+	.ascii	"\300\260,\342\006\343\002)\360\001-\306\027\\@\211xW\317\244"
+	.ascii	"\300C"
+	.text
+	.section	.gnu.lto_.inline.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\034\005U\027"
+	.string	"\306byG\340\362f\030\003P\005\243d\236\022\372\203us\216:Q\374"
+	.string	"\341\335,\226p\022(\206\n\352t2L\355\351\261(\024,nB\236\237\006;eA\206A0\202 Te&\222 \317\277\362\202F\007\206&\266{\355-e\nc"
+	.string	"f"
+	.string	"b"
+	.string	"\236\215\205\324NB\201H9\252L\224\221\314\337)\363|\314l\360Ld\361o\361v\273\335\017\360_t\027\024\265\224P\372\371\342\345\004E-\255;\277\277\230\3660q\204\003\017\207yBp\354\320\371\326\325Ew\267\006\374\030\265J\201\342G\345\373G\315\374sF\t\034uC\352\031\343\371<\271\310\241\274\311\240\030\343\343\212\352\030Q\273\351\257p1xW:'+\360\327\270\277X>|\277~\301\274#\033\"\036Ez\334aK\300\003\370\035vw\366\254?E\023\206M)\251\226)\t\020\250\220<+gj`\212\312<r\276h\355\352\306C\177.0\242+\337\341\341\212\342"
+	.ascii	"\315D\350\342\342\005%\021\343\226\323\307Y@\260l\300\227\005"
+	.ascii	"\340o\022\322\200\017\343\371\274\310\001Y\210Q\251\"\"E*\314"
+	.ascii	" a\2368cw\305\027\f\013c\252\203\313\031\205+p\321\322k\2221"
+	.ascii	"\253J\234>\225\203\251\226!>\340\242\355\242\351\037S\333\356"
+	.ascii	"\n\320K\354\356\311*\237-/\317\327\223\234\253\373m\270\342\272"
+	.ascii	"(\321\356\242\334\272%S\247\241$\033\016,\036x\357\242e~\177"
+	.ascii	"\t\200\247\034\241\033\361F\305\225n\300\024\276\345/e\332C%"
+	.ascii	"tc\r\365P\2658\321<a\264j\267\246\344\t\257~L'\232\246\002,!"
+	.ascii	"Y\251/\025\272\331\031\2420\n\304v\243\241\301@\0065\322\325"
+	.ascii	"\300\371\306\021\362\214y<\2735\342\020hJ\202\254x\"j\375\340"
+	.ascii	"\031\370.\236L\255p\271\"\326\016\032xg\272h\001w\2501E\205\210"
+	.ascii	"L\315\214\246\270\322\034`\002!Cv\335\022\200\365LG1B2\301\314"
+	.ascii	"\330\202Ja\177\016}\005am\321\0024\331e\322\314\206\233+\020"
+	.ascii	"\305\360\353\340\230\034X\004I\025\213n\362\242\270\200B\364"
+	.ascii	"\332\0257\321K\250\253h\372[\314\325F\276\204K\362\177\230|1"
+	.ascii	"z\nN\251v*\243&\312\375\367\377\370\202,\247H\f\333Hnc\034D["
+	.ascii	"\253\343\205\tTV\255\3773\334\256\217\021\032\246W\201\250\372"
+	.ascii	"\361c~\357\262\251%\036\240L\344M\001v\245,\376\003vV\004\032"
+	.ascii	"kR%\317\271\b\256,\237\337\023\220\311D\220\016\375+\336[\034"
+	.ascii	"!4RKp1\023\251\344V\332(@\211\200\217\273a\261*;\266\255\333"
+	.ascii	"\254\f\024\0176\020#\317\264\354$\026\221\206r3\304\305\250\020"
+	.ascii	"\260%\250\177\224\235t8\317\205-\302\316\247\177\213\233Q\273"
+	.ascii	"\030Yt\023K\201sgF\rP\373Q\221\311*\327\305\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\306\003=\013"
+	.ascii	"\242N*,pK\222\016\374\377\271\252\201/\374\204\321\002WUu\241"
+	.ascii	"\333\260=TU\325\245\347\377\237\217\315\260\372\377g{.R\t{\007"
+	.ascii	"Bd\222\001$\257\315\260\336\237\006FB\317!\tA\333\257\240\244"
+	.ascii	"\036\245\367\372G\024ib\220[\003\t\336\247\b\210\007\222\016"
+	.ascii	"\223\311\034\261\252\036#\027\271\r\271\033\326\263\262\317k"
+	.ascii	"e\\Y\337\242\037\207\265\375:\254\274\001x\371\322@\246\364y"
+	.ascii	"X\031H.\360\222Td\263\326ZW\"\022\241\254\254\360\307c&\257\334"
+	.ascii	"\333bo\261\316\213\242\fG\231y\320\203\n\006\230z\347\003\310"
+	.ascii	"S\217\275\346K\001\"LL\250aASD\026\264 \205\235\003@B\302\234"
+	.ascii	"#\333\022@\343\t\030\f\306X\b\031c\240\030\242`&NXni\261\030"
+	.ascii	"\262IV(Dz\321\350\177\265-\n\031@\355D\215\250\240\364\t\371"
+	.ascii	"\nf\224\376\r\n\035\307\304~\362~f\315?`$\031\225\244\223(I\213"
+	.ascii	"m(\312\244\325\376v\327YA\331\\\237mW/6\224\321\255\023\3463"
+	.ascii	"X\b\354\022z\b\006\223\2629\2564:uq\365J\321{\313\212\227\261"
+	.ascii	"c\253V\200\234'j\353\367t8\016\023\377\25297\254.\314y\224Ah"
+	.ascii	"T\220\004\314\004\220\330Kt\244\243\036\247\026\353E8\2040\207"
+	.ascii	"\326Sdd\253\254XG5\216\f"
+	.text
+	.section	.gnu.lto_.pureconst.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\232\004\020\232\004\033\232\004$\230\004(\230\004"
+	.ascii	"-\230\004.\230\0040\271\0041\230\0042\230\0043\230\0044\230\004"
+	.ascii	"5\270\0047\230\0048\232\0049\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\345\004"
+	.string	"\242F\026\"\240'\351\340\377\377\353\377\377b\367\007\377\256\016\354;\2264\"k\037A\317\t!;C\214|B\244L\0017\307\203\001\376V\336\264\215?J=[EI\221\001b,\024?\333\317\206\255\273;\bY\271\026\231\023\235\210v\246\307\360K\371\322yh\013\345\037\230 I\027\234\236\204\034"
+	.string	"j\013E\006\272J\305H]\3765f\270\003`\335\232I\006\326\213\262t0u `\\\217M\006$\252\356a\265\2143\003\306\224\262-\251\255\001\263\236\3461\315\002\363HYl1AG\374"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.b2dec28079bc0e17,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.48.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\307\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.59.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\355Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\354\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\354\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\347\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\347\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.60.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\016\326C\006DQ<\322O\374j\232\036\227\004\252W,\034b\350\332@5\265I#D\246\022\314\275W'\224\356E\020\225*\214\246xHMGT\326"
+	.string	"t\265\320\371\031l^\021|\201\346\02283C\274efM\367&\207\277\372_\334\304\220\341\360\366T\200A1>M\351^-S\326\242\276\374O\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxSbas.62.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 \334\345\004"
+	.string	"R\210\037+P\345$\035(\202\2537\253\004\022H \001\003\352\2145\263\273P\363\034\344\314\314\264\031\0351J4`\205\354\325v\032\220M\032I2\001\212\266}\017L+\200\274\214\241\016\300\275\201F[\353\023\330\264g\257{\376,z\264\351\323*\306\255E$\261\212\263z\200\347\250x\352\002<\033)^j\030</P<t\r\340\351&\274sN\274#\231`\331\305\3428\335\224wVZ\203g\021m5\001\f"
+	.ascii	"/\202\240\334.\344\003\345\202\254\301 P.\310\032\f\002\345r"
+	.ascii	"\250\374\006P\004"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.67.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 \216%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\263\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\020\036?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.69.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}\001\001\005\001\006{\001"
+	.string	"\005\001\006y\001"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.text
+	.section	.gnu.lto_gpsInit.72.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375``\t\0350"
+	.ascii	"\272R \022F`\\R\007{B\323\207U\272(\205\005g\177\346\321b\322"
+	.ascii	"\245\342\215*\blz\3333@\377\021\304!Q\207\0329\200~\002\002\002"
+	.ascii	"\247\354\371\272\371N\256\311\352#\"\3744\344\255\\\301HGi%\266"
+	.ascii	"\211\334[\246\224\002\r\001\001\001\020\001\035\354'\267\322"
+	.ascii	"\236\266v\321m\225\345\234\203\276B\2618\2519\315\003TM\202\226"
+	.ascii	"\006\352;\364\311\2618\271\222\345\202\234\002\301\327\376\340"
+	.ascii	"W\236\272\203\276\276\237\371\263\203\022\302\234^\245u4\033"
+	.ascii	"\236\251\224\277\036^p\030X_\333\311J k\340en\326z\363\006\013"
+	.ascii	"\245d\325\220v\350rv:\360\265\027\260\276\3768\001\354\253\352"
+	.ascii	"\002\260\257\335v\317\271\363+;T\ry\345.\347\\\274^\215\277u"
+	.ascii	"a\020\370c}x\270\022\325\373m;\224\013}CQ\017*\013F\235@\225"
+	.ascii	"\002\024\034Z|\252\314R\203Q:N\374\351@M\224B\376\007d\244\n"
+	.ascii	"\313\331\251\022K\375i\242\f\362>\342\022)\365\230\005\342C\177"
+	.ascii	"\272:\345L\232\\^\371\n`\f\210\023U!\263(`>Un\251\027\r\n&\270"
+	.ascii	"\234zuB\263\255\f\317H\325\020\277j\2061J\304\370T\251\245\342"
+	.ascii	"#[\274\374\351\257c\031\365\357\033\3129\367'\227U\336<\336\355"
+	.ascii	"\270\273Gt\377n@\327\327\272\203\257)R#'Y\347\363\355k B\274"
+	.ascii	"'\201.\r\256(6"
+	.string	";\276\326#<\r\232\004lzS\037\354kM\302\247F3O&Y\267\346@6\274,\356=\330\344\234q\302\256\346?\307\327\353\227\222\035x\002\336o\330\201\273\025'Ct\364d\373\233\2171q\202\210\b\243H\361\236\354\037\252\013\325/\035s/\336\255\302\303\2001\240U\204\273Wx\227\".\005\276^\232\345F\334m\344mF\342W\316\331B;\233K\217\332\303|m\244\244\367d\022\366\325G\316\356\370{\355O\007J\261\246\371\365\272\235Q\177\231\335.D\306\b\\\337\256\356\365;h\375\006r4\357\036oz\023\201\337\303\337\267p\375\016\342o\240\357\373\207\277Y\366\333\207\2771\376^}\337*\376\276\370\373\327o\207\340Vmwp\204\340r\366\261W'\307\255nK\274\351\216\346\337\355kYN\270\271\313jXY[\331\235G;\314\366\366\n\373~|\217\366\212\375\035\317\243\305\352\254V\353\265\260\257\276["
+	.ascii	"\254\351\266\274~\003{\323Mp\351%\361]\346]\357\235\363\\#\365"
+	.ascii	"yD>\307\034\021m\0216\347\214\257\263\035yd\313,~\345,e\241\273"
+	.ascii	"k<U\353e@.g)\f\276\366K\375T\013\246\266IZ1\334\212a_\327[\004"
+	.ascii	"k\336\253^G\336\3516\372\243\221}\250\253@Ms\203\364M\3159gl"
+	.ascii	"a\372\206dx\273\272\233(\215\263\305\367\214\005\3560\220\263"
+	.ascii	"#J\341\364\260i\305Y/\263\335oT\253\313\013\361v\251n\304\177"
+	.ascii	"\227\236e\204R\270i\276z\306\001y\356F|\357\337+\207j+\352\367"
+	.ascii	"\232g\314=\303\006-M\345\351\322\340={\321X\353D(\345\262\346"
+	.ascii	"A\237\334\266\201{.\213\247\032\251\317\353\227n\351\271\216"
+	.ascii	"\306\340\337[2\334\335Ji\251\274'{\256;\341\222:\363\333\335"
+	.ascii	"\232y\035\234\253\245\375:\361LQs\262\270#\207\366\314\335ph"
+	.ascii	"\343\263\027GMFML+R\222\013\031J\035\232\226\224J0\315@\032v"
+	.ascii	"\205\026,Zd\270p\341(\002\317Q\013\245\030j\033#0\315@**%\025"
+	.ascii	"e$\031\305(\032\227\230\212\021\006\264\322\214\243\245b\223"
+	.ascii	"\222\322R1\350<\372\355\352\241\343\215\352v\250\373\323\211"
+	.ascii	"\254\234xt\307"
+	.string	"8\241\317\265g\317\344\227\004]\217v\207\027\373\260hP\264G<\330\177y\264I<\363\273\242i\316\332\321\341\302\213\343P\3779\272I\231>\230+\233\013\006`B\307\217\226txu?\273-3\340e\366\323r\213}\245\003\221v\220R\337'\235xu\274\300C\002\3138\274\272\341\355\337z\"/\332\303\272\215j\247\246\260\257\356&Y'\364\355m\016L\274\301\333\336\352\300n\347\302\333\335\362h}\274'\207W\315X\027j\371X\255\025\217\034\0049\341\375\001o\360\362<\321@\357\\\265L\177\003\343\201\264^\016\346\007\360\372\033\366\376\254\252\330;\254\263%\326t\313\"^oz\017\035\177\227\251A\350f\205`L\354\013{\003\200\264\250A$I2\207P\221\004\221$I\n\303\001\220\002\021)\253z\021\300<\311\230\262Q\240\202BiY\003\377\343a \211O\037\352)\2350%\021\365\301\314\247\n$<\361 "
+	.ascii	"\211\216\233\350\340y\253\332\022j\225\323t\216\232\341Ta69,"
+	.ascii	"\277/S\034\340\\z\363\217\021\013\226u\316_%\253\301\232Vn\255"
+	.ascii	"i^\245\355\312M'r\2258#Q \304P\257\232\250\n>RHO{\311\330\035"
+	.ascii	"/\243\f\036\301\354\2651E\372\251\2448@\021k\305\215u\301\240"
+	.ascii	"\260Lm\005\2718g\340\372#\241Js\250\265\273\302\277^2\f\311\303"
+	.ascii	"'\363\237\263t\0173\223\225i\250\342'RO\375\037\017\266B:\362"
+	.ascii	"O\262\233A\b\262\200\341O\016\023&X\334Ew\327\2562\246 \343\350"
+	.ascii	"wS\030C\032bBP-0\226p\363\3014\276\327\003M\020p\201\t2<:\345"
+	.ascii	"Q\375\026h\2415\223\345=\036m\207\017\"\355\034>s\365H\023'w"
+	.ascii	"\306r6nv\b\240`\376N\357O#\225\222\330\003R\376\376y\te\350\201"
+	.ascii	"\363:\335QT5\267t\300\353\177!\b*\356V\270<\222\356\335\361\264"
+	.ascii	"j/\230\301\005Y1(\007\355\231Vs\210arr\272\304nE\3528d\377i~"
+	.ascii	"P\316UxT\253\270F\033\230\211\262\020\362\322\355 \217_91'\334"
+	.ascii	"~R\360\034\221\332\204t5"
+	.text
+	.section	.gnu.lto_gpsInitNmea.73.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"\355\n"
+	.string	"\326\324K?0m\224\016C'$\362!a\201\302\b\240\3500,\025,t\360\013?k\367\007\263\304\220\360\261F\b!Z\re\177\224\3365?\016Y \201*$\314\333\325\341P;\267\331\315Z\262\267\224)\0059"
+	.string	"7"
+	.string	"<"
+	.string	"\366\211o\245=\t\222h\004\310\356F\355\360\352O\263\362\237q"
+	.string	"\231f\375U\256\257@I\344\203\242a/vT\030\r\320B\231\022\314\356:3\r\303\ro[\201m\004\3661\001\320\377L\207\327\003\027\032Wv6\220a\013A\261\231\302\336\260T\016\366\337\252\205\235i\230\351\367\364%'q \037\0136vG\235\212\345 \207\007\333\267\377\241\262)\256\002\026\001\034%8+G~mtX\320\203&\250\3178\003\021&B)b\002]\327u\007MO\241N\032\260\354|}\352\024\255\260#<\204g\262\273\t|\020\327\230\340c\034\232\302'\237=\316\\<\234\007\221\322D\b\232\006\233\230\351x\342\245b\212\343\240\023%PT'R\266\353jaH\342B<.\305\276\301\272\300\360\330m-\317\221\027 \355\r\225\317\254jMJ{aw\003\020"
+	.ascii	"3\003\266:\204\215\200kX\376/\263\254\326\366]M\254 \200G\254"
+	.ascii	"\204L\350\204*l\327D\023L\320\3422\307l\362-L="
+	.text
+	.section	.gnu.lto_gpsInitUblox.74.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"\265\013"
+	.string	"\206VR@"
+	.string	"U\224\016jN\027\277}\3244K\356F\266:)\371\277\"2\030\233\2001"
+	.string	"\304A\005\263\215\300JB\275\371Y\261\374\177\361\327\377\377\337\234\274\001\250\231\3463\267\344\007A`K,\331D\312\224\002>"
+	.string	"?"
+	.string	"?"
+	.string	"\327\2439;\310A\025{\223\r\032j\f\331]MS\234\273\245\311\371\225\257\273\205\245\256\026\002\022<R\331w\262,\253\023@\256zr\370P\231\024\315\356:\275\357\303\035o\373\201m\006\366\035\004\276\206a\030ZQ\330\232\316L\237B@\307\n\302\215\335\016\241\221\355\021s\270\260}\373 \227)\b\r\330W\371/\016\203{\214\fX\347\001\263a\342\235\354\202\t\036]"
+	.string	"{\274\334r=Z\017\020BV%TKl_\270R74~\240\222\210\261\274\332\024Hy/\365\202\322\316\276\214\317\300\340\267\260\205R\336{\364K\327\343\225dE\bS\206\0360\342\252Wv\200\360\261Y\304\006O\251%\016^\320\331t\032d2\036\f\200\322\026Rs0$\221\004m\373h\241O\004\220\306\031\2214\214"
+	.string	"o\"\317H\253\260m#-\003M\327\230\364t\023\035\013\021'\013\356\201\347\221[\273\273V\226\366\004P\336\263j\2278\002\020"
+	.ascii	"v\221'3\340\324\341\236\205u\" \026\026+`\005\320\366\313\020"
+	.ascii	"\377\007\023\020\270*\\\006\002K\200\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.75.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\036\001}\f"
+	.string	"V\326O> O\225\016,>\t\330\344\320F\\\243\306qS\215Y&\013\270"
+	.string	"\365\313\352P\215\f:\305[O>aB\246tG$\r\035\250="
+	.string	"\030@\202\021t\305\2448;2\303\233[$\233l\231R="
+	.string	"<"
+	.string	"@"
+	.string	"v\353\342h\237\242$\001\365\332\335Mjx\367\231I\355|e\215`\350}\336\364\354\003\313\005\206\027\236E.=\237\026!\2458<\302\bR5*\273k\005C\013\267v\333\005l\013\260\237!\017\374\322\247!p\364\340\247\317\321>/\003l8ut\264\252Z\274X\215a\213\237J\221}9\216#\3142d_}M\022s\241\300\265Ka\224\261\253\251\242\203\355\333\007\321\331\020w\001\025Og\234\224\"\255\220R\364\023>\n\267\034\267\202;\301\344aA%|\023nI\f,^\273\336?>\003\355SA\373#\374\217c\264\025V\334\001\020\220Gc\2667\027\341\300\261\353!\340\207\370)\266P6\231\004\033w\331\026\\\016`6\213f\263Q"
+	.string	"\230\313 \320l\r8N\263A\304\316\263\225!\003\343\252#?_\374\263)\201q\231l\250`G}\222=\324\306pz\3207\275\362I\317'q\007\037"
+	.ascii	"3\241Y)p\340\257\213\221\214gL`m|X+\200\\T\307\250\232\303\233"
+	.ascii	"6\3011\233\0366Z\213s#\021\\B\252~>\225\231P\2138\013BMs\314"
+	.ascii	"\342\207Y\356OY\b.\003\216K\007\263q\232\222\212\272\003\362"
+	.ascii	"\355\262\362\004"
+	.text
+	.section	.gnu.lto_gpsUpdate.77.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\275\f\355>"
+	.ascii	"\nh\320\026BP\350M\007\260k\256\\\260 Rt\345\016 \204\244\254"
+	.ascii	";\375@\344B\366\262\035K\240\2021\022\301\227\317v7\342hz\343"
+	.ascii	"z\266\006\352\034dmA8\312\201L+#H\320q\007\351M\233\354\275S"
+	.ascii	"J)^\001C\001T\001dR-4\\\332\333vQ2?of\205\"4#\240\336m:z\f\016"
+	.ascii	"4\355*{\353\313\233Y\241\r\253\030\035\314\277f\333\321i\334"
+	.ascii	"k\257\005\367\353\224\231[\r\275m\035\232p\350\356Ms\320\351"
+	.ascii	"\023\233\b\355\255\266\243\321xtrmSF\206\256Sn0;\230\177\235"
+	.ascii	"\242?\346'\263\b\355\314m\326gm\243\361"
+	.string	"`\337\275N\272\274\335\233\006\201\025\254\235.5Q\355\024m\241\332)\267\314\177:-\354v\023\016V\230B\367\336\342K\341!\253\337\266\020\351\310(X\004\374\261\276\2657T\321\244'z\313\035\240\315Z\0357\345\261\205c\2154&\346G\350\200\2578G\030\320y\322\247\331\302\334h\214\211\007\335\272\225Eh\003\2724\203z.\371\205\022\213LAz9\260\007\325\354\004fifx\277\036TVW\263s\311.t\351JR\211\373zP\3146\226\031\n\344$\353\253\327%[\355$\311\245\036!p\222\374B{\350\253\215qs\341\214\213X3\333\203(\253|\350d\255\262V\2224z\225E\326I\350\001(L\360~J+t)N\016\253\341\032\301\\r\212\377\232\244\211\250\220\313\f\236\240\022\013}\200\007\213\222f6\202+\3112\367\036\324\275\227\035\251\314j\016\320\314\315\305\314\036\230\177o\001C\377\301\246\t\247\262"
+	.string	"\347\206\0231\302\033\311\377G\377au\275\373\244%\275\320&4ve,\351\205\332Dt\364\271\341L\234\360F6\375\204e\3035\353\254\233c\323\353\335\035\035^]\313\351^\323\356y\3149\246\270\257\030\005O\255\313$\203.9\263'\206\242\362<\376G\277\375`!Br\177f\025+\274\221\377KV\177\214\363W\022\013\3061\277\016\03752\377`\334\255t\344l\013\221\245\324~\026k{\254\334\020s\273\3517R\334d\334\"\312\033\031\245v\332\017\324\263E\345\211\330\343\276\314]\317cN\253\362\007cn&\257e\035?\024f\326\371\311\347\\\3549;\261\316\020X\347\007\254\263\003\326\271\001\320\271\251\321\272\231\200\316D\326y\310:\013Yg"
+	.ascii	">g$\237\363\021\353l\344s\016\372\234\213|\316\300\237\363\217"
+	.ascii	"ufYg\237\317\271\307:\253\253s\332sF}\316\277:\373\352\334\031"
+	.ascii	"\f\300\241\023c\316\275E\022\035\272r\251\032*\334h\032\356\006"
+	.ascii	"\233o\003\250m5S\350\r\333\020%B\317{\r\367[\247\271\321j\246"
+	.ascii	"B\254YT\250\030\327N\217\274\205*\232\033\314\277\246\231w3F"
+	.ascii	"L\273\351\bez\211\312\3638\350\364Bz\256\347\321#}cm9\022O\322"
+	.ascii	"2[$\255\226\226\332\351\321+\351\331\352b\346\226\313\263Z&1"
+	.ascii	"\217']\331vy\265L\230\250\235\026\310c\347\3442j\342D|\b\332"
+	.ascii	"D\nr\002k\245x#\215\276\265\226N\255_\360\221-S\311\201\334u"
+	.ascii	"\321\007\037}^\251\25122w[\246\n\374\242G\357\304\374\252e\272"
+	.ascii	"\017\340+\211\241\r\235\312\264\212\r\021\266\3332\365\367\355"
+	.ascii	"d\314\251\332\262\365^+\n\354\327\217-\225\326J\213\245\305\242"
+	.ascii	"v\372{\003O\366\021\031\223\302\236\215\024\324mT}\317\376\373"
+	.ascii	"\271\372\252\362DY\332\220\021\317\227g\327\3008<\037\001\273"
+	.ascii	"\271\005\316\334vi\277,U\375\221\203qus\327O\023\210#w\364'\213"
+	.ascii	"\025\346\265>\330\035\367\240t\310!A\334u(;\362\026\341\252\362"
+	.ascii	"\247\0015\035\377Y\357=\366W\177\027P;\365\341\275*\373Cw\227"
+	.ascii	"\267\251\3730\363\237\356\2575\354&o\332m\372-}8\"fn\317zO\313"
+	.ascii	"\\\357\275\024\270\363\264\236\r\334d\2352\207\016\035\324N{"
+	.ascii	"\237$\206\006g\327{0\243\252>\007\002\236>\363\007\020\336H\325"
+	.ascii	"N\372\276a\327\331\334\3555\335\314n\"qL9\252F\357\2757-:\312"
+	.ascii	"\306\n\033S)Op\301\302\205\205\n\025\242\234\214\246JD\305\200"
+	.ascii	"A\302\206\214\250\0325n\264(\342\026NS3^\024\245"
+	.string	"`\024e\300X\021\243\330\242\306T\321i\310R3\242j\024mHI\325(\376\250\372\241\244\210\223\243\372*\346V\023\342t#|\3726\277\203\024\3443B\327<T\246\177z\364\316\325\0270\256+%\004\346\211\204\026\377\2574\033[\313\\\327\212\257\341\007\250\n\357\350\301\330A;=\213\2659\020\336\351\273\211\205\350\3013=\204\357\253*i\016\306\330#\257\307\263\307S\355\364\301/\320\263E`\213\255\3318\2555#u\230\276\325z\t\350t3$\362\346\305\350\301\344\232\b\345N\245\231\333c[\345\215$\276\204\245\225\023n\356\226\351\240\323K\216\252\255\033\254N\016\217\216\212\017\324\321\237A\017\353v;3s\360\355\346\245\213\233\0037-Y\332\r\313\02572\275\332\021Z\342\245m\006\3140\370R\033\261Z C\347\227\260<G\212\036\214\205l\335\006Q\207N\341\003\370\341?\334U\0252\343:&|\006z\320"
+	.string	"\374\210-\201\326;uI<\272\243?\201E\324!.\245-\022\245@\242\006\257t(\306\340\023\277\353f\203\247\261\3643O<F|idb \314\356L\036\240\356&\267g\356\3252\203K\\N\263\3313xf\032%\264,T\207C\355\201\020\250a0\347\0343E#\"\222$\005\2054\0061\005\304\020H\245<\017\021"
+	.string	"9\247\030#\021MQAR\031\016\200G\022B\243\362\335\013,\020\016\250\250\327\020\371U\bW\277Tj\341\245\345\226\363\330z\001Jgz\344\201\3578\355A.\216\214\036+\232\214_\2202\007\273z\215u\177\220#j{\345\355\310<\233\"L\3673\032\t}\262\217"
+	.ascii	"\262hue$t\226}\372\310a5\022G\336\332\360Y\371X\273\022\345\267"
+	.ascii	"\033v\013E\242k\022\244\r\336\023\336\272\375\020l}\224'\201"
+	.ascii	" \302\200_n\222\n\317\\gC\233\3203Ik\016\324r\310L\275\035\020"
+	.ascii	"\206\240\246h^\230\303\201_\361D\"em\355\201\2464\375\215\022"
+	.ascii	"c\331\225\354\2756U\260\261\323\367[\312\266\307\326M\213<\217"
+	.ascii	"7\317\275\307%\260<\304\212E\026\221\023\247s\371\b\321\307\361"
+	.ascii	"c\203\"\302d\256Et\020\322\236\270\036\223-@\\\312\250\027+\245"
+	.ascii	"1A\343.p\264\311\027\310\201O\261\346)\333\323y\361\370\333\244"
+	.ascii	"P2T\262GT.6\316>\332\001V\234\2276\246\246U\326{\302Z\257W\023"
+	.ascii	"e\341\030c\372\250D\263\264\333\240m\312J\275A4v\3549\247\223"
+	.ascii	"\204\334 [7\344\216\023fy\331\314\330\373f\257\367?l\266\331"
+	.ascii	"\313\026&V\321\261\t\031\316\246\b\261\371\030\334\360\323\023"
+	.ascii	"\001\212\024\364Y\261\334\370;\226q\346'D\241\340\"-r#/\345\331"
+	.ascii	"{i\214r\277\213yM\200ZR\023&My\202\025G\005\002\357\331\353\250"
+	.ascii	"\254\314)\251\377\023\214\260\231\347\263\311\201\024\b\255+"
+	.ascii	"e\343\224R\032\024`\324\205b\f\310>\f\006~\300d\206\210S~\025"
+	.ascii	"\345_\371\340\320.\254\034\321\237\203\f\021\312<N\026\022?t"
+	.ascii	"\274P\312p\022$\216\3161>\216b\344\255\343\177\375\335\307\030"
+	.ascii	"\222\256n\255\242\tR\255\203\3003/i5\321j\3125\353\032\253%L"
+	.ascii	"D\001<\252\200"
+	.ascii	"\3740'\215\3111\221\2204\032\2130\305\221C\245\335\027dJ\003"
+	.ascii	"\354\324"
+	.text
+	.section	.gnu.lto_gpsNewFrame.79.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\270\001\325\017"
+	.string	"\326\036jE\360\222(\035b\357\331\364\253\315\347\220\252\364\301\245{\361F\344\276n\333]\315\013\246<\274b\333\213\223\337\254\325WM\230V\264s)\227\3177p\006\236\t\024+$\2510o\3053Jn\323\320k\021O6\2212\245Y"
+	.string	"O"
+	.string	"W"
+	.ascii	"\376\330\n6\220h^\306\202u\027F\342\305.\230\300\007\272G\333"
+	.ascii	"^P\202r\352\340\007\327e4ZftvAO=<\365\270i\246|\325\343\005\033"
+	.ascii	"\337\313\345\333g'\241\365`\341h\361r\271\266X\034\201X-\204"
+	.ascii	"\347\205A\023\300\311\356:\277\027\207\233\273\355\007\266\031"
+	.ascii	"\3309\022\273\255\006\276\211\203%_\304\243)\234\362\337\243"
+	.ascii	"\177\342\036\257# J\2542\364g\367\330\300\250\261\371\303\006"
+	.ascii	"Y\2511\3665\fC\037V\030\333i\220\323\236\313\374\235\323Q\323"
+	.ascii	"\233\2465\246sK?\300\303\325\341\201\nw]!\220\275\21152\333("
+	.ascii	"\007\251j\217T\362\037H\r\264T\345T\325w\232\2327Z\202\2542t"
+	.ascii	"\210M\355*^\240\346F\225;\217\325b1Tc\374\025>\213;\277u\351"
+	.ascii	"\030\261/3>\215q\272]\325a>\211{\024\331\f\262\034;\236\3026"
+	.ascii	"\316\017\263\215\223\337\"\370\274\2642\210m\t?\261\322\005."
+	.ascii	"I\211\220\342\300\304d\024\022 \272E\241\023\213\212W\"y\023"
+	.ascii	"H(+\236\310t\362B\".\261\214L^\205R\311\344}\300\325\267U\030"
+	.ascii	"s994\027\351\247\270\357\320l\036\375\354q\247\203\2024\252\006"
+	.ascii	"[Y>\212\373d\333\335\215\003rS\033\002J\376\363t\272\315\240"
+	.ascii	"\035d#c\013\t  \220\002)1;\007\244\362\2606tv\244x\213\006.\025"
+	.ascii	"\3354<\006s\235\006\235d\033\n\361O\235\376d\022-\321\327\343"
+	.ascii	"\025\364\343%\207\002\003q,\254\003%\221q Z\360\020\3020\347"
+	.ascii	"xHL\353\335}\254\334\275\355\331\236\216un'\003"
+	.text
+	.section	.gnu.lto_grab_fields.80.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\317\004\315\037"
+	.string	"v\271\310K\240\326Q:I\363\361\313}\243\330e*\264\360a\242l\257pY\360\225\225%\346\233\033\260\250}\373!\330~\320-o\275\230z\364c\300\234\214\227&\306K\223\342\214\344Z\003\232\366=\243DP\271\036\377\355\206\375F\b!D\312$\003\270"
+	.string	"\251"
+	.string	"\261"
+	.string	"\016R\333TM\311\273\013\030\004}\007\207\355Z\223\256n\322\2336 5\314\273\317q\035A\027v8\255V&\037P\265\n\025l\201\364\346\n\323\3378\216\240\315I\370\240\373\031\bN\3419i\325*\264\315\\\300y\263<\313y\263Y\354\213s\207\275\\)z\232esn\357\3410\252\"$!~\321\254\370\035\335u\252\"\023\305\323\2444K\277\022G\251\212J\2243\334\363\361\3704\272Y>\bbD\024\363}(\331\305\222\254\317(B\342\262D\220TdD\314\267+\005 Q\321\004\346\033\342~\361\023\202U\262\226~Gg\024\247\326\272\034\302\367\373\256|w\243v\027\302n\t#\300\265\271\317\031k\\\323\222!\336\332\033\253\2524V\n\031[\335@c\203\003U\307\347\316\017\377"
+	.string	"\205\216\217\233\243\365\342\323*)T\225\217\273B\017\334\300\335#\220\212a\334f\332\225\211\201\371\216\377\305\345\302\277eyYj\037~i\263\023\2772\2247\306\274"
+	.ascii	"N\336\025\223\027f\362\276R^W\312\233\242\274(\363\236'\257\311"
+	.ascii	"\274\345\311\333&/\233\274'\260\242D\204\357DBj%JR\251GL 1>\374"
+	.ascii	"\211\347\335\240\275\323\213\013\2631!\346\312j\214\020<\312"
+	.ascii	"\300yR\363a\356\365W\017B+H\305I\255\302\00477\r{5?)=)6\301B"
+	.ascii	"\033\270/\376D;%\244\351\322[\366\254e\335s\375v\272\032\327"
+	.ascii	"d\004\352\2673m\027\332i\267\021\036r\377\204\363I\321~\357\310"
+	.ascii	"\354\226>\373\273\032\2626\233\235xH\235\321\352\004L\177"
+	.string	"\370\231\327sg\255a\372X\273\031/\236f\264B\2225\216N\t\321\020\"g\003}\316\375\323\006\237\001-^\354;\2347\t\\A\351n\351\2629\311\256\206Pw\337\245\377\322o\256\302C\3528\271l\264\"\221\202\207P\224\331\300=\207\363\245\277te\345s\351\023?\243{\356\234\265K?\312.I\210\223\373\253\252\344YHIE);;\357\341\001j \f\032x\312e\240SA\247\301\315\215\005\033Y\016\356\2477\307\346\247\347\202\355\266c\313\260C\201\307\226\203\373\261\331\004\330[\217\005\234\r\350v\303\331`\302\372fZ~\325:\266\243\221\243\254\265\321\216FRz\343YX\232[\210\007\254t\321Z\266S\372Q\353\036\272\345\222\351\356\3017~\326\275\037\217\365\251\232\230\f\361\226Nl\245[\032\300\254W\232\223\360\220\2722ki\326|\334\332\313Zk}\311\364\270\254eZ\253\352\310Q@(\033\256\006n"
+	.ascii	"b\020\211\306t\214\030\234:a\232\326\275\330s\247\254qMSC\274"
+	.ascii	"\025\244\365\207i\214,\231LB=w\302:\006\246_\001c\25010\306\224"
+	.ascii	"b\b\331\214\004\221\030\244\2301`\002\221b9\017\020hX\332f3\266"
+	.ascii	"P\002\026\262\234\234z\273.\034\023\230&7\303\344\370\332S\342"
+	.ascii	"\376\372\352U\020\331k/\241y\230\363\274\222\373\221\372\200"
+	.ascii	"\337YK\230\206\316\344\232\354WA\303-\302\f\374\317^'\214\344"
+	.ascii	"\327\036\225\374\fF\002\371{h\276&\301!\3117[\222\204\036\016"
+	.ascii	"\266\274\316Y\037\201\342\216\260\236w- \313Na\206\001\372\322"
+	.ascii	"\034q\004v\261\201$\341\270\356B\212n\314\250\210\331u6\341P"
+	.ascii	"\304\242\307[\231\257\374digk\035\270%\203TM0\220J\017\261\021"
+	.ascii	"h\336\372N9+&\320\241\\st>\336ac\277\025[/uU\t\032\244,r\320"
+	.ascii	"\310\242$\001\016Q e\242\357\017"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.81.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\340*\205\233"
+	.ascii	":\353\2403H \320\332\031\003a\275KE}\253\0301\227\310VTG`V\365"
+	.ascii	"}\002\213&;\026\3561\201\013\331\307\274F\334\035$AT\3768\n\321"
+	.ascii	"CG\363=?\344h\313\177\365\260A*\302\255\313\210|\"\366i\346H"
+	.ascii	"\223R\246\224R&\003\354\0020\003$\334y\304;\037\275\263\221;"
+	.ascii	"\213x\347\020I\347\242w&zg\020\356<\364\316BI\347 \327\331\203"
+	.ascii	";\003\271s\322\235]w\376q\347\016\356\314\301\235}\334\271\307"
+	.ascii	"\235y\334\031\351\316;\356\334\2723\353:\257\357\374\256\263"
+	.string	"w\335\337\331\340\0257\367\204x\357\221\307:o\032V\f\225\006\354\366\322m\327\215\327\235\327?\336\3019\270\217\3678\217#\275\365z\307\177\230\233\273K\003r\203a\037.AH\177a\006\232\b\322y\3377-\211\233\217\373OJ\315\313R\331\205\367\036\371I\273\222\346\202\356\"\304\247Y\025k\222\230\233\013\367\226\356\023\322~\\J/\274w\314\212\216\016\026:\025 \233U\266P\333\354\332\037\332f\233\271\004\356\273\316\322Zz\217}\242\236\350-\327\267\314*\356\212[\016d\263Q\217yf\007\204%1\343-\225W\300\\!\233\225Z\222\304l\267\354\367\353\035!1\256/\361}\361\234\232\345\251(\"I\357\215\205\311\377\276g~`\336\367\205b\023\310fWL\225\300M\242!]pR\304Q\001\333\243\363\276xR\037\205\203z\305k\256\362f3\027\366\343>\336\302|\274\307z\254\205\3638\013\343\315\220\021\303\n"
+	.string	"\030/\\TQMq\227\026,V\250H!\025\005\365\344\204\242\211iI)\351\204\211\022HJ\022#\216\214D\204(\"\0021$\024\364\301\003P\322\375\351\300\301\247\207\007\271\323\262\353{\223\373y\207\b\035\353j\346\302~?c^L\234\373\312\232\267\224\rE\237G\234\371\332\b_\365\020I4M\205\346=\326\323\262s\305\263f\212\006N\224\354Ms\336\212$\232V\2449\213Q\364Y\344\217\2103\0364(\372<\341\315\3170\212>\303\036]F\f\307\266\252\326q"
+	.ascii	"`4\366\013\306Ew\261\376\020:NzP\214\316j\305\b\266\246\301\034"
+	.ascii	"z\325\316\325\nd\210Me\002\205\236j'bs\227U\371\327H\203boV%"
+	.ascii	"\321g\023o\301b\347\nI\257hc\350*v\256\\\230\236\301IQ\305D\312"
+	.ascii	"\361-JF\355(43P\037J\360\351\314\252\204\023+t'A\024e\336\242"
+	.ascii	"df\272I\2062f\236\311n\351\212\022`G\305\276\264Bm\201,0RT\254"
+	.ascii	"\360\223\246\244\274\235`3Qb\347\n\211\213\237+I\334\371\210"
+	.ascii	"U.\354\355\310\250\020\213\213\340\221\023W\007N\224\254\260"
+	.ascii	"Cx\351\322g\327\"\353Z\344\225\026i\245E\"\213b\370\243+\\\211"
+	.ascii	"\346\032\304\034\025\037\232k\301\205\346\246x\320\234\024\377"
+	.ascii	"0\307\202{hk\24066O\266\255\271\333\366\304\177\332\316\274C"
+	.ascii	"\333^#\301\211\2319\007\244(\231\223\366i\342=*8\017\023G6\234"
+	.ascii	"X\231\357\254(\316\316 \351A1'\253\220\23247>c`\336\016\212\315"
+	.ascii	"\255J\017\033\373r6\231\246B\257;W{\215\225\346\344\021:\206"
+	.ascii	"\244\177H\317\330\263\243bn\332\344\373\276A\321\247\221\325"
+	.ascii	"w\256\336\367e\207\216\2215\037\320\314"
+	.string	"\355\312\314Z\314I?\002l\227Z\334a\242\2731r\355\025{\361\336&\326\035\271\005\017\317c\206\350Y\b\004\001C3[\240\265(@Cc\232\331&\325\322\222B.\02447\350\347\314\354\347\303\030\017\256B\030 -\315l;,Q\322!\371\327\314\226C\nd\034\\1\315l}\374\210\021\237\037\306\356\361\"\036\326\323\341\216\303\262\345\036\364\023HP\t\353~\224\230\371dif\313\363?m\376\364!\356\265\362|\277Y\233\3104\366 \237\003c\224w\371\213\374&\363\314\370\345\345\271\241w\376\r\273N;V\2759\260mv\347{\317\235\372\245\020\t\246\231m\373n\005\252\027\351\264/U(\306\351\217\215T\013s\266\263\245\231-\373\r\367\324\212L\244\034\366\217\n\305\\\211\323C\307\021\265\217\220\216\210J\2264\355K\327\357\250\226B/gL\334Z\037\304\224\3312\263\b\375\206)D}\337\327\005w\233v\323"
+	.ascii	"\267\224f\371G\216\034m\263#\326\344\370\3777\230c\241\277Pa"
+	.ascii	"\231\334\231\356>\3027\266\233\314\f\232e}B\b\304\214M\220\241"
+	.ascii	"\265&\334\203M\303\222[\no\351\360\206\352h\233"
+	.string	"\025\242\312q\372#7\225\220\311\340[\246\265\224\244\351\362j\n4O\274\177)3\247y\022\344\236\201\017\213\334\240\210\213A\006n3|\210<\021\327\305\355}\337\246\030\312:4\263\r\344\206\201\017E\234\211\241\247\231m\263\335h\357t\316\255\3070\363!\362}\273\372\214\017\221\256\3365S\304\304\027\355mjv\371J0wd&\302$\203/\335\262\303t\347i\2119\326\361\301\310T\303\342\340\353\215\314\275l[\257\001@sz#\373\270a\360\365Ff\252\301\206\301\327\033\231\361\236\335yu\214\274\376R\346\356\274:F^~5fwn+I\347\246k\300\346\236c\347\236\266\227\346\216\262:\367\n\253sKW\347V[\235;\255\355\232\333\253\363\232\373\331x\315\355l,\335K\3279\004\327\231ku\006\262:o\320z\315?Z\257Y\003\327Y\313u\366\341:\367x\347\f\\\347,\327\231\307\007\347\035@\316\030"
+	.string	"9_"
+	.string	"\344l\201\353\\\301;S\360\316\023\270\316\022\270\316\021$\235!H:\353\370\340\374\200\353\234\303uv\300un\300\235\031p\235\027xg\034\357\254\200\353\234\300;#\360\316\007\270\363\r\327\331"
+	.string	"\327\331\206\353\\\200\353\214\345:\023\220t\256\221t\036\300u\246\361\316\002\274s"
+	.ascii	"I\347+\327yF\322Y\306;\307xg+\327\031\206\353\374\302uv\341:"
+	.ascii	"W\271\316T\256\363\324;\267xg\026\256\363\212\244\263\n\3279"
+	.ascii	"E\322Y\352\235\243\200\234\241\222\316O@\316N\036\234Qxpn\362"
+	.ascii	"\340\314\224t^\002rVJ:'\271\316'\222\316&\\\347\022\2563\222"
+	.ascii	"\353\254t\235\003Xof\213\200\027b;\0343\370R\351\316\242\242"
+	.ascii	"\256\306\227i\256v\200\257\361\201\017\003\327\223&\024(m\263"
+	.ascii	"\003\034\322\321\245\210\033\263\224\022\2236\343\215\206\t\214"
+	.ascii	"\017f\tE\005\2246\247\\=\215\337\t\004s\f\340\005\b\340\3337"
+	.ascii	"\177^\256\276\027\017\237\374a\023\251\352\f\277e\324Z_\224\346"
+	.ascii	"\024\031?\343w\004\371\366d|762s\323\353\363\226P\324\307\373"
+	.ascii	",M\266&\013\315)\315)m\2631\330\312\242\332\352c|[}\373f\361"
+	.ascii	"J\003\221\323]U\027\242\354\370\347\246(`a\2072Zi/\033\240^\312"
+	.ascii	"\311^\266\375\234\301\313\031\005\275\276\355\030\033\306\267"
+	.ascii	"\327\257{_g/~}\030\337_n?\355\251\177\361,\233/\270g\231\347"
+	.ascii	"w^+\235\317\177\305\257\263g/\333\252w\361\375\005\367|\354e"
+	.ascii	"K\365U\337rT\037\305V\346$\343\374\306k\245\223HO};\177\375\373"
+	.ascii	":k\361S\215\315\342[<[\375r$!\352Y<\033\370u\366\364\307\300"
+	.ascii	"6,q\356\311\245\fj\021\364r\306;(\335^e\247++\036\256IE\207\212"
+	.ascii	"_\361k\325\311\215\212\212\357\2706t\322\376\2766r(\342R\274"
+	.ascii	"\224,\251O\361l\240S\033\233\3247]\233\267\264\006\342\244i\005"
+	.ascii	"\031\274\312\227\217\256\037\365\r\346\330&"
+	.ascii	"\311\264\275\257M\n\317T\205z{\264\346\364\311\323C}+\370d\366"
+	.ascii	"N\236\276\005\033\337\310\342\322\034\247\270g\322\234\226\241"
+	.ascii	"x\247g\005w\250M\217\342\213\252_V\230\312\232\317\264L\337\364"
+	.ascii	"D\212_pK\317\364\375\204$\205\245\357;\305/\322\033\304Y\301"
+	.ascii	"\024\301(\035\341\027C\312ay\024\330\271\310\321\255\206p\\h"
+	.ascii	"\3573D\343Ie\224\344\036\332\234\022Iz\245g\025\301\376+\351"
+	.ascii	";\f\231.\201'\306\234x\346&\335?\227J\3574\361'\236e\003\346"
+	.ascii	"X\302\235\272\371\376}l\3265\357\274\241&\276\353\320\206|W\230"
+	.ascii	"\276;\023%\352t\265\227-\322\227\370\006+[D\242+\241\3749.\327"
+	.ascii	"$^\371\r\206\344\351\217\212\001\350 \361Q\205e\206rj\354\300"
+	.string	"\220^\232\242\231\355\210\031\342\300\031\021\267\367\246<z\304C\243?\372V\320M\033#C3\022d\232\331\212\240\022\212h\222\307d\304\222\020\317L\303\331`)\255a\253E\037bPM\321\367\030\303$w\375}\206)\034\021\315\200\365$\330P\020O\364m\340W\0343XH\031@\374\023\233\335\332G\370\310yR\250\221\264\207\336\243\036\003\023If\350\227\252u\375}\204\215\"\026\205\236\271\206\007b)\255\275\357K\305>\306_\260\341\301\215\033m\263\254\"4N\320\013\025y\363y\230\034\310\367u6\024\f+\260\20074\350;\f\232\327w\361S\t\347\370\225\326\222\023\302\013\373\037O\233\037;\227\235'|\354[\3322-\354zl\021<\366,\253\034\021;v\272\270*\026\366*k\342\030\327/rG4\376\326Zg\232\303\2224\211Es\354t\357'\307^\205\017\221\336GrT\034\216=\256\373\250\355A\270\204"
+	.string	"\311\352\241A\026\362G\337P\240G\220\035\037\370\330\t\302\225"
+	.ascii	"R\204\fl\200\320\003H\326\016\034!\b\361\t\262\343\203\0358@"
+	.ascii	"\330\321@\bBzx*\003\036\031\274\250\252\352\021\345f5gE\t\351"
+	.ascii	"@Kj\353\207\024\007?v\004\221\312\372@\210TT\020ou\320\343\003"
+	.ascii	")\020\266\266>\220\362q\366\2531"
+	.string	"\25754\370\037\276\251\335\332a\372\307\207M_\351\374\347\364\233\r\230\343\032b\343\217o=\247\001Z\037\030\302\373x\255\357\275\346\001S\262\374\020\236}\f\020\037\210sl\364(\f\243\325\343\203\n\025\013X~\225\025\220\t\202\272~Ibs\302\3433\310Z\275\004\341\361Y\2106`\275\224\177z\331\362\370\216\256~<\336\b\216\230\356CD\223\206\200\227\362\023\276E\273\001\234H\267\323*S\035\2465\3700D\301-Z\275\327@TD3\032|\353\265{c\215\227\0160\003K\336\216\300$41\217\306\035\006\325\025\357\356\315\333Z\327\234b\301\340\253\330\354\352.xf\023\036W+\315)\t\272\270u\332\234V\271`\313J\034#\250\357C\244\023k\247\"N\005\260\240k\205kN\337\334\330\310\255-4\247S,x\253\340\271\262\260l\023\204\306Y\327\226Q*x*\266'\024\fY\245ji4V(h\024\230M"
+	.string	"\266\236a-Q\271Id5k\206%Q\233\345\265\311\352\244\211\302\221\346\330\030\033\350\312\004\013\271\226M\360T\205v\210M\332m01\200\243\226\353\r\265H\360\\\317\276&\221\340\227\n\313\230\264^7\321\266\224\020\202x\242\312q:\210IV#\275E\346j\366\320\\\255c\354U\314\254G\330\343\374\334\3360\202_\327\"\021 \216A\360\320'\323:\036\202\365\004\256\024\232Pt\274\022[\231#\322:\304\0041\314!\252\024\356\b\332f\227\250r\234\253s}F\220\244\271dI\333\354\003\317S\235\021\243\245\337\204|s\276X\365\n\017$\307\372\346x\022\215\203Q\276\275\264\022\310o\360\035\345\377\017)c\331:\360-u\340\235\330\2641^\352\327\313\266\201\357\025\336\250\312\3007\360LoX\253\227\262\303\350\264\367\027\255\366\033|\030\317i\006\240\276N#\003\337r"
+	.ascii	"X\340;\r\307/\200C\201\307\361F{\n\274\b6\016c\256\023\370VC"
+	.ascii	"\340\023x\243*\230\243\215\003\036\201/\252\336\370\003\236\250"
+	.ascii	"_\274\224\361\232\331\336\370\037\273\277\341\025o|\013\016\350"
+	.ascii	"p\003v\377u#\341\233\343\266\230\350t\361Rf\301H\325t\377\\n"
+	.ascii	"\004\2051\r\002\336\242\357\334_9\275\361m\272o\300V:\001\277"
+	.ascii	"\214\261"
+	.string	"\362F\036\016s\210\232\370\177\3208N@\346\022\212\374!\023\351\346\3374\2314i\232\231Y\371\245B1\356\343\343\343cs\265=\367M\367,\230F\256QD[\214\363\204`\354\240P9\364}\371\252\313\253\334\rU\255S3\365R\356\033\257f\200\241\2273R\265\f\370\240B\305\027\272\373\016\341\244\351\302ka\343k\350\243\266\200\267\361\r\246\204\206\002\336\210\255LP\231D\215\027\213\227\022y5Z'\326\016\313$\375\242u+\004{I\346\321\0049\f\304zA\002>\203\272\250\002Y5\215J\207hdD$IA\222a\r\302\013\020\b\002Q\030CX\036\022\340S5\210\224\020)2\221$IK\007\322)\215<\301\025\262\204g\270'\004c0\303\220#\230\216\266\364\264\007\302\212 :UE\203\2275\246\301'@\252\0378\177\227\327\232\330j\314\3052\023g.\271\242\310\214\223\314\2631ac8n\217Z\371"
+	.string	"\262\315\350\331\201\352W\261\225\273v\350\223e\374\033\317\274\204I\023\211\301\035"
+	.string	"\301/\307O\351\332\2768\301\2632\004\001\334Y6j\016\260c\354\376\260o/^\r\232\377\234t\200\026G2\224E\223\030w\215\260R\036G"
+	.string	"X\274\374\345\303\302\3778Z,\265#4QL\320:\b}x\333\212\034\371\255\255\323\007\366=\257'v<\025\345\226\022"
+	.ascii	"\226x\276\022i\2172=*\304\330\320\216\246q>\303E~k<9C\036\257"
+	.ascii	"o:6\207\317\260e\373\341\371\334\2018\276W\362irC\342\226Ku\026"
+	.ascii	"\005"
+	.string	"\321\322\340\373cd9\022~\230uf\200\202\002 \261\331\212\250t\004\002d\211\342\020\032\035\217\375\275\007c\201C.\033\177\323f\316)\355\332\204\024,\250\bz\260\360\305e\322{\004T\240\342?\331\033\314 \327\252?\343\345\316\210\243\026\242\034A_)\212\217\304;\203G\026\324\247\350z~\017sQ\202\330\013\233\332\202\340\314\203\215b'a\254]\0305\231\2750\227\217\200\212wf\366\356oO|\n\256\2003u+qxy\177'\b\323y_8\t\033\r\307\305\362\372p\335\322|\217\233\300\006\222\2615\t\tlgyh\347\204Y\344\362\344\245<\230,\313a\3312o\247\216\273n\327vCG\333U\226\t\231H\253\277\022xSv\002\242\305\r)\211WV\324\322\026\241\354\334%]\\\222,\275\227\302\274\344\357#&\200\356X\217\3530\364/0\202\256?\020i\221Z6c\203\b\353\275'Y\006p\252M"
+	.ascii	"W\005\212?q\231\242\034\246\227\rgZY\371\305\252\270-\036<P\n"
+	.ascii	"\257\246\"\314R\306*\374\243\306\376\262\205\242\343\346u\023"
+	.ascii	"\326\204<\207)mt\375Lg\354\177\346\211\023\256\377\342\211\330"
+	.ascii	"\262\273R'\017\f]\245\270\374jH\013N\234\327\224\261\230AP\f"
+	.ascii	"\244\257\223\356\371\023\202\333k\314\251\254\323\324\312\f\266"
+	.ascii	"y4\256+\310\363Y\340\360\031\233A\320\320O\316\361\357\225M\210"
+	.ascii	"N\236\007\351P\376\273 )'\034;\252\2520'7\332[yQ\030\320\227"
+	.ascii	"\350C_R+\307\370\252\215b\325"
+	.string	"\b\267#,\214\021\217\\$\024{\360K\265\024\307\026\007\363\216\032+\021T\346\271@\312F\032\333\026\311\351V\237~\214$\273\020f\321b|)\250jC\267_E\363\r\006Q)\0276-!\346c7\255`\017e\b\214\217"
+	.string	"\235\024n#8\270\374\345\034x(\267uM}\320D\314r5yTZ\t\317\313\241\246\277\260\251U\337\025Gn&\204\251\361\334\226J\362\240\274\205\357\377\234v\263\357\260\231\023\210\034R~j\240\305\021\373\215\250\n\312\262Dj\007\372\004p\272\002Z\210\350o\317\001Szc`q\1772\314\344\230{\253b\030\032\340\316\032\177\032\246\317\370\225\n\231@\331\356\266p\262_\254\340\277\224\303\327%12t\274\240\376a\331:\356(1.k\364\t\302\222\375J~;\343sW\231\276\0243\254M\337I\2779\314F."
+	.string	"1R\023k\200\360I\306\316x\373\225\250\337\f\320E\342#\330\330x\321\0376K8\3007\345\253\tYd\204\017\252\016_\020)G\236qq\031\247$=d\335\211\372T\213\200\365v\275.\031\2340Je\032\002:a\007?\341\2457\335;\201\330D\347\300\327\266E8\252B\212\020\311\252e\032G\231\201\007\322s\302\020g,\037}\2228$\223\351\266S\036pz\224\210 \236\264\330\346\233\001\202\324\022a,\2113\220\311\304\305.\276\326\216B\314\342I\337a'\263\262\327!\024\365\274\373\335\300\364\331\301\206\321,\251\013+\313+/\371\305\3131\310/\313\211\257\226\223\036\005'\216\3076\035\226\353m6]'P\316:\300?o\270\335\321\\\346\234\270\226y\331C\277W\023wv\332|\206%8\367\340,g:\363\373k\373j1\207\n\030\362,}\351\240\037:C\264T"
+	.string	"M\202F\321\260&I=\373'g@\277cB\001\363\030\246\244\005\0238-\264\257h\027\223c\250\341\243\362ro\234 \031\260\367\222tf-\273\257\237\251\264\215\375|\323\234\327<\364\240\b\221\274/\351\230\2540\017\360M\034\342i\323Z\255\037Y\021\003\200rk\331j\210$\265\251\026s\244R\024\004\310LF.L9\217\001\371\200AZ\032\3651J\212A\254\023v\275\031\3124\375m3}\275\020i\217\262N\244\207\t\243\017\217w"
+	.string	"z\275\262\352\032H\205\302\013[\242%\266\213z\242\f\225)\313\032\277\345\356\372n\272\356\021\216\336\235"
+	.string	"\315\202>\016\330\007'\323S\324\030\365K/\254\202Y=\23610\313WJ\3707q\327\210\321\307\360\r\031|\263)\224\217\277:\261\334\r\225\221\007F\205xz\334XC3\"\237\300~\024p\212M3\336\323:\346\344\234\236\240\265\360\225^\034"
+	.string	"^|\236\234_'\3055w\225\211\303\3311\332\352\316.-\024\322\375\212\230\220\230V5\025\024\314\371\006B\347\311N\210\306\b\332\032T\254=\311\032Y\375o\202\215H\375\270\315\0261ny"
+	.string	"\304\237$\326\036\265\236m\256\222\210\213\317\025\tr\303\036vk*4;H\343x[q\305E\020}\200m\\}_\210\262\251n\374,\316\250\350\344nD'!\276\2374\261\307/;{\317\335\373\233\213\345\211q\330\235_n*;\n=;\262\317\350&\021\t\002{\370\331\223F\240\226\325\360g\216"
+	.ascii	"x\3208\216U\343\245\341i\031\013o\305\255\321\372\260\214\022"
+	.ascii	"r5\207\247y\245\377\342\002\212\3611\320\323\336\bF\336\341'"
+	.ascii	"\020\343\330C\216\026pxi\363}\360\364\246\247\252\031]\267\337"
+	.ascii	"\223\rJ\035\";\236$k#\344\257\254\275\317E\204\245\004\324\t"
+	.ascii	"\275p\240\200w3\235\207\202\347\177h<\302I\240\351\371C\335\361"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto__update_checksum.97.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`H\002u\022"
+	.string	"v!vG\360\320&\035\210]<$`\203\006E{\276\231A\353\256\032%6\036\\\364\243\375\325\347\240\242\361F\264\0311nx\315\206\240\205S\301\377\257m\021\026\207\245xn\016 \312\302\355~y\302x\246\355\373\030\033!{K\231R_"
+	.string	"`"
+	.string	"`"
+	.string	"s\202#\016!]\032\274\001\356\222t\002\334\245[\266\214\203>\023\344\207\204\204Y\2159\247\267\034\374\333#xGm]\306\325\226\037b\243\001\373h.cg\203\343!\300g\023O\216\214\210>\273\306\276\227F\020:\337\317\356\300\205\355\004\354\323\271v(sN+\354\253ps\267\375b\273\201\255\023\002\266\351B\377\307\201~"
+	.string	"\245\203\177\307e?\307\301\273\273\354\346\242ZFu\214\352\215j\215\352\017\370\bQ\342\273\2156'\316\315\306\254I\242\017\036\366\210Mh\006D\300\254\t\322\300\240\006dcA\n\221U;AI\353 \313;\347\016\213\023\322\345\310\220\310\325\376\210\377\264.\233\271iN\236!\024\001\246Z\230\303\251\206\356\026\305\025\347\2343\232\366\262\037pih\004\347\326\264\217q#\342\205A\252\304\335\225*,Rd]\330-\2758l\206\356w\3677nv^+]U\341\323R,R\007\177\206\273\374>\226\301\2457\177(\264\260\264\0256\337Z$\314i15\264A\032\335\036\373'>GF^\236+).\250xJqA\305\027\026\b\353\222\324JJ\201\211\t\013\311\307I\346\224\212F\221\304\300<\360T-\336K\313)\202\207Z\305x$\005\254\202aYy2*\325\312\363"
+	.ascii	"\347\227\307\244pC\315\265/\271=\306\241\025\355l\251c\273\215"
+	.ascii	"}\366S\240\025\231X\323:*\307r\033\363*\bF\215\036\271\264\007"
+	.ascii	"\177;\213\353\266\364\331\0034 \220\002\221\303\352\377\362\244"
+	.ascii	"\201\327G\002\264\346\253\"E\301h\f\020b}}\203\301e[6\340\256"
+	.ascii	"a+\020Y\334,\2255\273.a\005\002\235\016\340\th\227\363\303\265"
+	.ascii	"\202\263\017\217{\230\227\207\031\236s\347\024\233\nL\255\222"
+	.ascii	"+\222~\325\324\346\212lm\265\313\262\361\274Md\204p4\354?\204"
+	.ascii	"\271\300!\200`vu/8\013y\202\262\233\201)\233.\363\004"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.98.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\211\022\355J"
+	.string	"Jt\274\031DP\234R\007\260\3153o\364A\313\035,\b\310\366\251\027\017\240\\<\303\263\313@n\340\233B\363\344\223a"
+	.string	"\242\265 \270a\323"
+	.string	"\020"
+	.ascii	"\002@\200V$?\222\351\034\007\366\031=\211&\357j2\332\275\267"
+	.ascii	"L)\005{\001r\001\225\001\337\306\341\367\223\373\355\304~7\261"
+	.ascii	"\337L\354\367R\177+\261\337I\354\267\021\373]\304~\023\365\367"
+	.ascii	"\020\373-\304"
+	.string	"~\007\261\337@\354w\221\375\376a\277\211\375\355\343~\367\264\337\303\366\333m\277\333\366\233u\250wf\277?\177\373\006\230I\r\032M\337+\023\3075\362\024\306k\3320p\016u\357\366\356v\321\036\355\037\255%U.\347s.\034\032\3461Z\3540\004\347\322\364\3051]\226\267\035\240\307[)Gr\275e\335\310\365\266\013\034p\321\360\022Y\322\217\300\334\231\345\025\3018\246C\346!=\344,\235\367\322\303n|rjbZRJB:2*\"\032\022\n\002*\376\020}z\206n\313\346\207\333\223n\034\266),\234\363\247\240\246R\356\235\224R\276\351\0014\t\023;$\253q\304\247gPX\005\325\2760p\2774\354\022\202\026\347Jq\236t\304\221\216\030\371\243\\\255\223\203b\304Fu$)\"\342DD\334~\350\351Bl\317\017bSr\266\366@\305(S\3233\036\3773\325\206\266\303\211\354\200557\220\330"
+	.ascii	"\241\343J\316v\274\317\364L\007+\245\344L\355{\206]\022\200\360"
+	.ascii	"\255\221\033lC\213\342\303\034\356\022\2339\274\rj\226\261Rq"
+	.ascii	"\034{\324\337\254I\366\354\317y~+\322\303\333\316\322^\270D;"
+	.ascii	"\"v\304\246\322\375aW\034\307\375\314&\2327\224w\277Vw\033\350"
+	.ascii	"&z\n.\350\2030<\007G\341\250\353\255O\016\322K\273\353\311\335"
+	.ascii	"\020\374\216W \2403\377rO\316W\226\327!\325\333\316u\3630\017"
+	.ascii	"\357\312\242(#\270_\037\237\233\246\315\335\023|\217\316\034"
+	.ascii	"\n\256G\215\323\236asw\005\177\303\001\211j\301\335\\\020\232"
+	.ascii	"z\033\f\0314\27435\270\336\346+\314\277\336\340k8\034"
+	.string	"\237\335\035<\317\003\025\202;\307\373\320\376\346m\203\020!\302\365\226\315G7(\231\351\227\242\221\n\350u\204b\264\270G}\302],\330\227|\253\202g\265\217\315N,\336]\311\267\266\373\267\225\2415\311\331\331f\332\317\020\250~\221\213\263k'S\264#L\273\030\327}\304Q3$^\332\277d>\252\\\\\354cK;\227\256\323\363nt\275u\262\\\207N.\256\333\263tw\035\267\026\256\361\210\343\244\257uw\327yf,@j\371\327n\227z\335K\342\353\313\365\366\241S^\302m\267\322\242\304S\337\332Y\270\336*Q\001\333\2478\025\026\355om\002\354\235\351m;\230\353\255g\237\264\261\317\323aQ\246\036u\2424\r\222\301\277\370\t\273\351\222\237\235\335\376`\002\331\274u\016\322\315~K\350b\277\031\3647\262\375\336j\277\265\216\375\235\325\337\003\206\337\002\206\337X\303\357+\366\333\212\375\256b\277\251\330\357"
+	.string	"\3547"
+	.string	"\366{\312\375\226j\277\243\332o(7{QY*g\353\362:\326\345\f*G\345\245\275\262(\312\034o\205\003\027\265\n\314v\200\nT\346\212\032\325\236\316+\372\224\2159\277Y^\307v\374\\\330\326\263\307\313\301lVT)Oy\313M\216\f\2241\216u}b\324\304\351\307?\361r\262\007\344\231x]-\201\341\242\2248\345\253%M\271\033v>\222W\310\247\017\367V\346\337\330\2207\362\036\337`8\252\"M\371\230\244\210\311m)3\rYb#\022\312r\337\"\365\303\013:\372\326V\017%\347VV\032\022\312AlxR.\302q{ \257\343\265\301pN\346GRv\274\240\354|\032\316"
+	.ascii	"N\0259?\303\2152\203\"\317\366Z\031"
+	.string	"\3715\030\256\207Q\266\022\323\341\345\252\006\306\261\2569\200\212\324>\351D\271\350s\020]m\024\263\263\237\230\345.\225\346]}\216\256\225\315\262\\\313\353\256\315\241\214\343\355\230\177Zy(\273\373\223\235\354V\336\023@b\016\222\375u\205r\021ZE\357\305W\223<\332\353j\232\360\023\267;\023\312\256F\317}\214\256\204\354Qw\031Pw\243\033\224%\344\376e\232\022^\3622\336**\334\344\315\340'P\317g\006\345*\275\253\030\353\264\213c\021\022\256I\276\265\247(\315\243\033\374s\330m\027|2\030\n\034U\3023\004z\245\325_\267\230\201\262/\323>.\332q\177\362\325\26781\377d_\336P~\236\302W\312\0271?Q\t\363\236n\314\305\265\260\353\223ST\221\363\342\253\335\001}`D\210\021\013\022$x\267\204\276\274El\251@A\002\t\366\205<\361\005\302\004RD\n\025\310\255\243\006C\361\246@\256"
+	.ascii	"\003K\201\374\241\213=\007\351\007^\244\322\247/\353)\214\326"
+	.ascii	"I\275d\257:\022\231?+\033\210q\260\317\314\306\033\346_5\307"
+	.ascii	"\200b\225\247\307\024\311\327e\357)+{-\263\262\222^\332\0225"
+	.ascii	"\247\354\254\372\200\034\"\017\310E\2754\351\340\027\265-p\224"
+	.ascii	"4Y\005de\241ce\001\235\343\234\f\023\333\023\343{g\212\361\271"
+	.ascii	"\336be*7\302)Sv\n@\243\324\225\233M\312\371\230\315\216\371*"
+	.ascii	"{Y\345\253\253U\366I\313k;\346\261'tw6\216\343x\251+;\324\245"
+	.ascii	"\306\302\334c\356\312^\266\306R\257yU\204\257\261\352'f\347\005"
+	.ascii	"\361\334\t\004\254\312\\zx\250\376\336(\252_ k\207\347\371^\007"
+	.ascii	"u`2\256=8\206\001:pS"
+	.string	"k\016Uv\020\030@\357\205zR\007\341d\266\212\021>\234\267\301\363\rL\226\200\352\006\216\201\244\266\201\233\307\3474@n\340\006\265\003 \257y\215\324~\274\317\023\263\212\345\201\223\311@\345\253y\271\250B>\rL\226@\301\362\321\3001\220\3173p\363\212j\006@\346\322\203\372\345,-C\206\246t\364d\374h\031xEj\017ss6kO\312N1nw\207\224\235\257;\225ST\301{\361\3254a^\263\257;\346\337\330\214\377R\343\275\300\315.Sbf\260\\\313\224q\254\253\335Q\340\331\340\337\227y\026\033p\364\t\bF\n\307\327Is\201\231\250q<\006\235C$\"\222\202$\251\264\006\301\005\204\020\345\2303z\021\2200\250 C4CRP\220\244\003$\355\333\004.a\234\017f\247P\263S\374\177\200\377\267\361\013\350\002/Z\3418v5\031\021\322\021\254%\020\032\323\033o\027\221W!eF\344"
+	.string	"il\200e:\252}\003.}3h\214\255I3U2f7A/\275\250\002Y\344\274\317.bi\227\\z\254[\255\0328\333\003\236\277\027+{\244\314'\243\236C\n\356\240\301n\366\316\366G\316\tT\r\257\034\n>B\357I\241\304\026\265\240\344\261\212\030\364Hz\320\366n\342\372\257\215\002\032\003\242\221\037\303"
+	.string	"\323.\222\274\317\303\024Tq\311v\021\367\243T\307\206\313>7\256Cq\t\t\260\037>\003\321\333dh?'\001\b\221\034\333\336|1\232d\265\267\227\201\343$\226y\276M\307!\221\334\362p\325f\t\300\210P\023f]\207\347\310\203\002YJ\230P\262\230'`\274PiM\236|\222SC\305\271$\333R\004\310M8?\363\346\360KiSu\316Q?3\271\213\320\313\016d\343\361\211#X\234\034\332\212 T\217\361\341V&\001\234\030r\255G"
+	.ascii	"Jo8=\231\244\276\216\321Z%UC"
+	.string	"K\271\030e\331\345n\036\302W\\\344\214\227\315(\242\311\226jv\347~\347\005\231\001\030\001\271\275\266\177\266\f_\244 o;\246-5F\322\375\225\023&\273\357\273\310\277\343\333-\271\276\377\035\357\223^\030\265\255\016\316\345@\272\300\233\336L\201Z+\376\233\3745\372\215nFfa\373\326\207I#\006@\222\024\034\344\016\337\271D\002\030\251\273\240.\322c\332a\371\177\177\371\306v\b\033f\211\237\274z\2756D/,0"
+	.string	"T\325\304\201\2171M\2533\330\237\202\251W;e2\237\233\314\225\306\246^\017w\201\016\224\347#L\007\327\313\034\255`\001\264\241\255\352LX/\252`3\313B\013\260\257\002\016\303*\260\251Ln\260\312\233\t\213c\236^\212\031T\0277\224\252b\3646\221\273c\353\211\350\027\2660-i\256\0310\016/\206\2077\0130\346O\340\344\371Z\203\035$\345-\222\261\255][\013\213:\273CTk7}\006\335\307\r\r\032bfn\301\220\037?#\221h\265\365\220\267\006\251\243\231\022\232\244<4=\022r\200\013\230\031\327\240\317"
+	.ascii	"=^\242\336\017\276ML/\215\317\211\t\362U\201\246\272\n\222\264"
+	.ascii	"\200V\201P\345\231e6\253\274\263b\033\332\343M\320\001{\035\207"
+	.ascii	"\261\\Gq<0\324\361\322\245L\031\3253\233\336^4N\235\257\330K"
+	.ascii	"\245\252\325NJP\214H(d\240\225-\"k#\317\373\306\244\341\246\224"
+	.ascii	"\264p\267AC\201s\364\204\261\250h-\351\005;\217\376\003"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.99.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`S\022\315H"
+	.ascii	"zo\310\030A@\334R\007\221 \242#\367_\372\302\341\347\026\270"
+	.ascii	"E\317/\314\267,\214\213\202\331@\002n\360\027\206\203\314\224"
+	.ascii	"\";\2144\027\221\3059\030_\272\021'T\340\005\356#\345\tL\356"
+	.ascii	"1\217oM6\221)\245{\001R\001\216\001\256_\023\277s\247\363\357"
+	.ascii	"\366v;\277k\307\353e\323\230\341\326\306~w\3314\352\373\276K"
+	.ascii	"w\333\355f,\335U@(\325\355[\332\263\270\226\031^\327\365\024"
+	.ascii	"f}\247\023\346\024+$\335}rgv\367\350D\331]\357\246\321^\355%"
+	.ascii	"\202 R\335t\317\247/\353\333#\267i\263\324\003\356v\004\004Q"
+	.ascii	")\374N\365j\374\276i{|\357kE\320\001\222\356.p@\243\237Gb_t\022"
+	.ascii	"T\321\214\331)\276\257\225\n#\351\246\037\255\336G\377\364&\246"
+	.ascii	"%\245$\244#\243\"g\223hH(\b\210\371\343\263T\366$\221\331=\342"
+	.ascii	"\177\266Gx\333\326\025\352M\277\274\211\356\231z\324-\035\235"
+	.ascii	"=\230D\375*\305r4\220\355\263\343P\244\324WzK\254K\272b\345\221"
+	.ascii	"\216XL\021\315\257\322\271\343\004<c\204\216\327\344\217\216"
+	.ascii	"\220\311\271\021\262\n\317\rX\311\243.\262\221\311y\221\2239"
+	.ascii	"\205.\371&\221\222\037J\342BI\340>\b\2109\205V\035\n\212T\355"
+	.ascii	"\231Pldi\376s\225\246\035\237\336\367u(R\"\357\203c\315\222Q"
+	.ascii	"\351\336\370\353A\266m\347$C\250i\241\205zS\037\216\274J\313"
+	.ascii	"\306>\373p\367h \r\315\017\346\024zt\252i\203\343U\377\034S\261"
+	.ascii	"?>\235c&qohgC\234Mjf#,\347(f{\312)T\371\310\252\367}\373\243"
+	.ascii	"S2o'\357~\256\356\256\352\016*\013\317\2304\322\227\346Nq\257"
+	.ascii	"<\205\235\255\016\033\366x\332\r\267\200W\377\342^u\rZ\251b\366"
+	.ascii	"\353\265GM\262\f\036\261\233\027\357\252\257\327\266\273\037"
+	.ascii	"\306I\0211vk/l7L\356\310\243\312\021\266\263A\3529Q\323~\315"
+	.ascii	"bn\216<\252\234`{\032\227\310\231v4\30722\355ep_\016\300v1\357"
+	.ascii	"ko\265\321\211_\373\237\273\030nT\244\312\275k`\332\371ZN\362"
+	.ascii	"}\277<\255\235)"
+	.string	"\273\013U\365\022V\261Y\337\353n9\356i-\347\243o\201\343{\366\215\335\256\347]\274\332\343z\305\326{t\013\367\224\201\375\266\037O\373\3723;\235c\351\242\023\260g\354\037c4\\<|\237\261\333\n}\354\326\355\216xf:\327\330H\267\362\373*\371-\302\357\274\255\234\352>\345t\336R\375M\240\347{@\177G%\277\005$\277\003$\277\001$\277\241z\276\237\362\267S\362\273)\371\315\224\277\227\220\337J\310\357$\374\215\204\374>\312\337F\371\273(\177;\363w\023\371M\204\374\036B~\013!\277\203\3627P\376f\346\357\237\374\355\203\374^\346oe\376\356\311\337\311\374\215\314\3379\177\273\371\373\230\277q\376v\022\005\266@\327l\251\006\342B\353\333c\233\347\035\ftzf\203\213\207\357\233w\341\322v\346\\\342\262\204\215\332\314\n\361\332\204\254q\347\322\006\244I\370v[\"\354\326J8)M\235\022\036"
+	.ascii	"W\226\204\263\274]\364\020,\t\377\236\366:\324\335\341\351\274"
+	.ascii	"\234\336\2727<\026\016Ko\357\373>p\267\377\312S=\264\307\271"
+	.ascii	"\333\037@\200\310\3566\300\242\035a$\214\353\2145.\n\215\361"
+	.ascii	"\253|\024(w\204\243\340\312\356\030Q)\302Nl$\245\310\t\245\211"
+	.ascii	"\235N\232u\006\021\007\277^\033\204\374%\201@J\234\350\314UN"
+	.ascii	"reU\202\251\007\304\312\304"
+	.string	"n\375\314\355o\036\t\0276@\037!\203\331\237'\343W\231H0\354\361\374\021a#CX\b\023\261\r\341&\227\312AX\b\273\215<\320 |\264\353\003Rc\342\037\fD\204\371s\346\203\177\314|\252j\204`\t\274\3423\267\304\375?\036\310\325\210\022%\362\022\3438c\215U\224d=8\211\225\322\236$\017$N\352@N\021\374h\0243O\226j\177\303\004\026\215H\266q\302\305G\234\303\\\354\304\226\0351\230c|\304n#\r\372\333\1771n\302\226\235\235i4\033\343\316\205M\210\022H\236\023\201xP0a}LaE\254\"84,\333\224\214\235m\030m\017#`\"\340b\262\316\325+\32312D\f\212f\265 \373\352\206\316\265\317=o\233f0c\267v9_'z\330\304\323Z\027\017\363\274\375\215\303y\252\320\322\312\356:\275%\346m\307\\\337[\236\245\025\003\006\326\213\334\016\262RdI\200"
+	.string	"Ak\n\bK\006V\326\261UL\305x\261\202\212k\213\312\305\026V\013*\0250bPM5\233\353\205\026\f*\031\\\\0\250\226V0\307F\332\007\373\362\214\201a\3727\317\252\n\216\201\301\236\347RRX\302\032\030\206\266W]\251\247\226]<\224\302UY\332\026\007_km\"P\340\273\237M\236O\336\243\004\260\325\032\024\177\335y\301\2573&\354\326\226\245"
+	.string	"\305\316\2004\356\035_\330\022v\213J\214\302Ml\240"
+	.string	"|\030"
+	.string	"\013\230\363\331\256(\317)S\262\273\001p\023\\\031\245?"
+	.string	"q\340<\237Ca"
+	.string	"n\272\222X(\276\n\316\"\367\267y\322\261h\032\276\357\353q\355-\262\273Q\206\211`\277\346\t[<\253<\347\346\262\273O\270\247\254\232\344\244\346\204S\033\365\332~\347<\364\316\254\213Y\260gD\302n\315"
+	.string	"\217\221\b\214\365\212^\214[\341\034}\301\r\236gx\302f\205\253\300\216G\"\260\337\371\023\030\230/\177W\230\314\013\262(2\f\304{\321C\277\353\256!\346\317\260H~\2317\363\274\362\304\362\254>\253\331\335+L"
+	.string	"\353\007\264\335n\267\336\225\255\260\b\354\372|\001\304\205|tE\214\260[W\366;\227\260\306\364\303s\345\227\352\021\221O\021\361}\306\271C\007t\032&Ni\023\245\250\t\377u-\275\371yWf\302M\030k\333\302\203\351J\366\357\375\227\013\0304h\310\3562\341%\270\201\247\250\201L\310\024\232\031\021\221\024$\005Ik\341\005\204\030\305\334Y\007\021\3200\307\234\232\251\221$I:\277x\203{\002+Ko\332\350\347C\266b\241z~\326\025e\262Kq\315\212s\\h\340P\\\371\224\n\3555`\001\220\312\274"
+	.string	"kA\030\375\027\374~$Y~o\255Z\242a\034++(\253\t\263q[\033\303\343\206$\264\270!P\376f\352[1\322O\037\330\236(-\037^\2421\375O\006\373M/F\250\261"
+	.ascii	"\274B\237.`\356\177n\037\033\377\027LRKp\244\003\311\230\021"
+	.ascii	"\221Z\324\n\333\371\342\326\357\307H\022\206CBeInFW\f\213\245"
+	.ascii	"\\\237\260\222\207\377\206\364\342\346\306\342\240\361CR7\006"
+	.ascii	"k\204<\312\b\257+!J\bQ\205\316L\025\265\312\b,$\2501\001\356"
+	.ascii	"\364O\311R\006\0214\205Y\324MH+OJTV@\030\236\266\330\031,\275"
+	.ascii	"_\342\376\300[45\357\323\371\245\223\254\373\204\257\177\230"
+	.ascii	"\364\307\316\317d:\234\335l\347m\2149\372\035u\252\240\037Dc"
+	.ascii	"9y\244\005X\372\310\f\026\320x\302<7\023\034\216\246erj\320x"
+	.ascii	"\253N\242J\356\275\335M\360\211\n\261\261b:R\027\315\361\252"
+	.ascii	"\335> \257\r\3123\215\305=7H\343n\336hc\230\377w\017\256\033"
+	.ascii	"\360\262\374aX\002\273\350F\235\322.\274\202\357\374J\271<\200"
+	.ascii	"O\036\321\215\317\346\n3\300\204\224\0068\215\336\363[\317<\252"
+	.ascii	"\324O\177;\247MD\340"
+	.string	"Z\206\363\026d\177\006\316\374\201\350\304\315\033m\f\363\377\276\251\214\357\345(\350\267"
+	.ascii	"\345\033\322\266Bw\300\247\255\277\204\343Y\253\235a\371"
+	.string	"\\\356\3251\366r\024{\310C\3737\320\233\377\305\321\351\034\362$\316(\366\274\006k\241\bbq\007\203\224_\200(\036\361\342\203{={X\270\315\001\303\371\340\345\206w;\235\3067\023\274\227\301\037\020\357\227)\357q_O\371\007\317\270\237q1='\336\243\377f\344\272\373\361\334\022\246c\3063\275\336*t5\b\025\306L~y\240\227\241\221\221\275\252\310}\034n\311\201\327:\354\204$\323\212\241s\220\353\027:\234\322\205\275\365\233\274\351\f\325!\323\"\201kJ\321+J\343)v\252D\246E\212o\272j\323\333?\313^\261\326\371\265\267\271\220\3073)\230S\247\233\b\231\237\301\245h\363p4\374\005\177+\247\356E\n\255\003 \\X\306]\231r\355\362!W\320\252\201\220\202\324PVV\023x\375\360\344\207\307\302Q\243\261\025(\313\001\253\322|@+G\245\325Q\256(r\255\213\225A\257\271\245\320@["
+	.ascii	"\nIn\254\002\006\006\277:QVmb\031\t\027Z\327\253\030\206\035"
+	.ascii	"n\226\300[\001\027\nB%$m\005\242[\224?"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.100.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`b\001}\017"
+	.string	"f]iG\360\220*\035\362CWB\207w\317&N\375\201\355\245\306\021\201\3617\034\203\322B-\377<\361J\226\220BaML$\261W\276\177?\200{l\022\207\305\3074\323\033\262\027 f\346\276\261|\265:k>0\032![\246\024T"
+	.string	"V"
+	.string	"S"
+	.string	"9HTm\007 \325i\031<wE\310\230\331%\031\030A\347\237U\266\016\003\032v\365"
+	.string	"\306\350*q\273\033N\023W\335\233\252\362\377r\220\021\266\272\367\341\323;\020\033\221\003a,od\306\315\365\362\332\001\326R\3758\331]\353\bc\271\277\333\216`\333\304~\214\357\210\330\300Q\342-5v=\354x\354\355{\201\302\207y\231:\013_&\344\204m\305\356\202\377l\253\036\203\032\021\311}}\310Zf\024\374\373\314HT_\363\311\267H=\006\245\344\276\316\242\303\321p\377\f\241\363O\300\013p\376\351\tp\376\3710)\033\374w\320^\020(\265\033-\325\031D?\375\262dA?z\023\344\322\232+\277<"
+	.string	"\032642\357\334\334\324\344ln\373kW\f(\177\203OFu\\^\tB\334h\037\237\210\272\303:?\357\352!\352\316\rf hVw\330$K\247\314\276\2673f\177j\357\264_U\035\242\0334B\031\231\224\224\244x\002\204VB#\317\"\317IEBX\"\205\025H!\n\241\310t\n=\".\251\244\230\302\225R\311\024\202\244xog\314\003f*n\342d\331\257\375/\007\307\024d\256F\364B\324/I\023\364\243\247\355\312\241\365\321\353H\354\\\314)\263}\201\343\315\033"
+	.ascii	"\177\221'\023\232\233\006\216\007\3753|\261vbb\3418~`la\205\271"
+	.ascii	"\367\314\254\007#\034\300a\254\n\215\207\017a\005\347\032\276"
+	.ascii	"\215\025\017h\350t\b!Q\371\033\332. ,\007\246\344\211;7U;S4\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.101.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\230\001\005\020"
+	.string	"\326\036mG\340\262(\035 m\217\306t8;D\373\2319\276@\364\246'iN\241y\367@\"J\314\355P\225(m{M\267\240\225\036x\004[\035\252D\340x\034\017\034\004\261&\341\334\315\3030\034\037\204\374E\373\214l\"eJ\001X"
+	.string	"P"
+	.string	"["
+	.string	"(Z\307q\271\200]\232\033<\273\341\002\037\b=:|\211{\f\235"
+	.string	"\367\350\226\255\343\241\315\026\230\361!\306\342gw;\r\361\3267\315\226\377\234\213@\231\353\233\314uK@\213\321\203${\331J0#\300\347<9\310`\231"
+	.ascii	"\036\354\256\023\224\305\334\361\266#\330\206`\247\003)\256\302"
+	.ascii	"\305\2771KK\036|\364[\270\307\253"
+	.string	"h\346\2255\347N\t\032\320\216M\037v\350J\255\261\277\355\356Zi\354\343\374\243\2479MGMo\231\326\247\363\351\223>\373\201\351\020s\017>\2730\265\037\213#\312 a\373 \266\202\032\247\247\375\023\017\232j\247T\f@l\330\271j\324\310#&\003\323\231\331\350\271M\020\215G\265\306\266\b\267i\311\212\034/\031\344\274\b\247\272\251\276\210\315\300\262f{u\235\013\241\335=\371.4\244\204n\\\270GU\021\316+k-RK\">\2431\372\214\247'\224W;\303\227\007m\340E]\366\003npRr\342`d$e\n\260\302\362HPT,\036\013e\345\373P$\237\212j\200ML\237\212\252\363V\035\206\025*\2453a}\235)\304\236J\212\325\255x\036\253\003\t\367\333*\215%\230\b\201h/\2059$\375\t\334C\n\025N6\273\257\203#\345\324\266\200\212\251\013\006\247\242\031\0043\237\236\215\2241\034"
+	.ascii	"\325S\340Lh\352\307\220\306\342\375\315\r\264wfL4f\321\301\272"
+	.ascii	"\353\365\020\317l\210\314\274\036\2260\215<\0176J\315\206pC8"
+	.ascii	"\\\354\t\316Th\003\334\313SHw\305\240p\301\347[\215\026wy\252"
+	.ascii	"&\247hj\017"
+	.text
+	.section	.gnu.lto_gpsInitNmea.part.0.139.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\016\003\355\025"
+	.string	"\226\247\212I\260RN:n.\367\001\037?\025\261\b\364A\356\213\303{tT\231\252\237\245\271\324\271\236WH>\034\310\\\225\265\322\250t\250J4\271&\226n?\362\337\310?g\311\307\r?\343O,q\270\370\203\314\345hkd\357\275S\nl"
+	.string	"q"
+	.string	"{"
+	.ascii	"B\003\257\b\250N\246<\224\357;\n\237\247\350\241\276\035:\021"
+	.ascii	"SU\223p\327w\340\325\005d\257&\017 \276\322\217\210\257\376\223"
+	.ascii	"\317\375\036\316\236\371\275\321\236\275\236\3116\356\203G;\307"
+	.ascii	"}\274\275T\221\320O\270\273\264\327\231\364\361S\322\321\357"
+	.ascii	"\235$,\367\371\337G\264~jL\r\201\270\004p\032k\331]\313B\334"
+	.ascii	"\365\266Yl\257\330\263CS\316\013\375\260k\336\302&\333\335\024"
+	.ascii	"_\352S\031|\245W\333\334\344w7\361\365\363*\270\234t2\314<#\202"
+	.ascii	"C\257\225_+l\343Nd'\2575\021U\303\256\234\004\223\023\311\223"
+	.ascii	"\236\356<\262E\351XLZ\024\245k\225\246TzViI\245/B\302\202\265"
+	.ascii	"\353!\314\307\032U+\023\376\323\177\366\314>w\362\243J\222\202"
+	.string	"$\232v\027\267,\226*I\005%\342\177~p,[\bO\206\234\261\363\372\035\0048\314z\324i\017#\241\016\372\036\361P7\321\311/\217te\t\220u\212\323\206\020A~g\223\240\231\263\177\365\0308\276\222%\274\310\027\361U\234!\\D\336p\03002\337\352/&P\n1\342w1\342k\235\t\270\254\346\244\025^e\341W\274]\240\024\333\034\356\342\002\203\255]\240\025\252\003e\350LM\254\211\257s\376\252\204\323\003V@\203\201f\201\212J\rE\244\266#\263\243S=\203\242sSC\273\331h\032l26\264\231\034\035\032\n\211o7\265\034\332\316\355\226C\233\331\226\247;\217\f\003\026\324\315\037\373P\347)\332a\227\016G\020\310T\260I\270\276\367\3362'\222\307%\361\304\267\306\245\033%a\261\371\237G\246\333p\321\342\261\363\" \375\337\370\324@~\027\2338F?3g\t\004\363]\034<\350Bc"
+	.string	"o\207\004~e\005B\250a4\201t\f\241\231\031\211d\022Ms\260\002\231*b\007\020hfZ\330j\003\007!\322\321G\336;\213F,\356\007\235\3111\362/#h\277a\355\374\336'\216\277:\333~M\322qA\372i\271)\2377:\027\235\300%\326\020\257\334R\004\034\240\221|\316BQ\267"
+	.string	"6\203iN\223\307p\315\341\247\2304\304\222\024p\001\330\n\261sB}\357\037\214cL6\21705\\a\363\364\020\216\303\251)\034\r\300\242n\016"
+	.ascii	"!v\306\2640oQ?"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.146.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\314\025\355S"
+	.string	"\372\201\310\034Q@\022j\215\001\352\343\334c\264{w\235\365\275\212\226il=\001\354\351\031\264\317\245\032>c(\313E\311\023\205cDVd\232\233\361\263\347E\311\351\337\023\223\237\275\362"
+	.string	"\376\206jQu7\230\335\315\234\335\345\016 \017\t\300\327H\232H\"\245L)\245\270\001\213\001\273\001\321!\336)U\255\205\376\352vk\267y:\237\224Ov\260\007CI=\226R3\245'\020\303u\016 \260\007\337c\tI\005\030aNL\306V\371\311\246\314\315\355\366\326\306\206C(\331\323n\375\305\335&\324\324\306\206\003\255\211\005\002\330V\327\324T\251(Yih\317&Em\322e\231\225\251Rtx\t\224\365"
+	.string	"\241\303\370EL\f\217{\206&c\376\261\b\035\306=\246\236\200\226\265\343%{\323\253\267'\027\236\320YO\352-&B\323\240#}\276\313\366\261\225\306\205\367\276O\025\255r\fv\006\021\270\307\375\265\203\033\214\177\274\243\231\034\231G\351\371.\225\375\345\376Z]\021\355a\356'wW{\271\315\344\310\036)\331\261\262d\335\373>\201Z\345\022l\253<M\263\266\232\366\314\332jo1\363\016%\273\314t\375t\276]\326\203\007\rx\357\373\032[}#\355v\016\316\215M\r\221f8#\023\003#\f\276"
+	.string	"\177\276\226\355\255j\372^t\271=\271<\352\0342\234\255%~cS\223\325\202\023\265\232\006\311\021\037j]\371\214Lo\350\311\252cX\300RV9L\313)\255\234.\034A\3654\244\203C\230\376b\326\275\004\246?uN\202h9\245\220\224\306\tI\022K\231\202\377\322\272\227\276\265&\301\365\344\202\266\r\326#\330\237\225V\317\307\033\017_S\0369\345\217\224\347}\337\337\222\311\325\336\220\025\023\013\325\323V\247\351\017\363ITp\271\224\322\360@\244J\203\2657-\225\374\203"
+	.ascii	"\361-\223V\230\367}\233J\271\225\272L\027{C\357\373r#q5\3534"
+	.ascii	"\263\247\314l\001\363P\202]\fh6\030\314\234\243\271 @\200\363"
+	.ascii	"}\225\002\310\353!\022H\025X`]`mu\375f\353\267\356\2506\266\265"
+	.ascii	"\217\253\312,\243\361\356"
+	.string	"\324/:\341\033\272\262\234jJ\366>\025\017\333\272\276\201\300\306\336\322\261>\256\3517UX\234\222\013\301\377\376\351\273\025\246$I\036ef\242\326r\314\362/\"\330\266\345<H\236\3076\316\334\300\003\336I\377\031SI\177\304\3016-\271\376\241\2111@9r.\374\335\377M\346+\334uL\247Vy{\272$\025\356*>e\212=\3716\235%y\247^\037)\334@0\035\373\276G\315\354\326Y\177x}\3702Y\005\251{\337\327\247}\340f2w\017\354\363\365\371M-y\027f.j\036f\260\357\373\302\340\336\241\241D\300}\325*O@\201w\222\202\265\325~b\225\027\222G\271\301\272H\311\024\324\356\365<\377&\177\261\323\367W`n\235]\b\235[\264\316,Zg!\237\363\n\240\263\221u\016j\235U\3008\003\320:\003\265\316?>g\037\240s\n\326\271\247uF!t>\321:\233h\235K\370\234I"
+	.ascii	"\235G\260\316<\255\263\b\241\363\216\320Y\247u.\006\235sZg\034"
+	.ascii	"\237\363M\353l\003t\256a\235\211@g\032\326y\330:\317\264\316"
+	.ascii	"2\255s\214\317\031\346\305Y\bt\016\262\316/>g`\353\374\3739\373"
+	.ascii	"Z\347\326\347\314\366X\347\265uV[\347\264u\376\376jv\326\271"
+	.ascii	"+ \376<y_\247qO\212\337fL\344p8\230\025\315X\206\267\261\245"
+	.ascii	"f\\\344jN\314\312R\033\206n[\300\021\326\2349%\027\202\207\237"
+	.ascii	"\271#\300`"
+	.string	"/s3\267\211Kp\235\234\326Vs\276\013I\035\263\313\253\007\245:\353\030+LL\022\240Y\266l=\241vt\315C?G\322\235V\003\031\316w\032\023\271\030\ri8^D\206\203}]\351N\343\"g\342\225\206\326\351\335\024\3367\251a\332\374\315\222\233\0172\340Y2\330\274\21395\342\327|;\f\006t\033\004\376\002\002\005(!~\267\r\237\306\205\031l\222\341\267\330\234W\320M\310\224n\260f\243h\245A\353|\337t\241\334\245\037q\241\256t\2423\337kL\344,\034\253\266\364\332\314{\340M\270p\037\327^c\031\336<\256\260\343\324\342M\362\250t\257q\221S\315\b\252\340qk\355k\002\225{\325\232\325r7\005\315\322:\326v\322QnR\255\3143\217E\247\220N\332\365q\215y\231O\27101\223<\352@\374G\f\261\313\013\027>\f\n\356\217\023`~\350\006\361(WH\233Y\340P\b\270"
+	.ascii	"\302\237\204\337fU/\037\374\036\342\312\031\254\323\313\0170"
+	.ascii	"\347\225\307\022\355\214\376{ \021\267\351\235d\236%\022\200"
+	.ascii	"O\234\353\300\223\256\021\226\275\207\217\340V\245\256\225{d"
+	.ascii	"=\262\266\372\373\001\346\324\210mXz\337d\337\367\276\261\302"
+	.ascii	"\246\244\360\326\005W\211w\322w\302\331gvep\265\274\223\355\363"
+	.ascii	"(\375\021\263'\271\322\006\334W\354n\271]\336I\267\353\211sq"
+	.ascii	"\314D~t,:\375=Q\345c\330\206C\357\333m\375\336\177\024\036]\220"
+	.ascii	"<\312\244\003\234A\bF5l,`\224\203\206\0035@\240q\200\016#\033"
+	.ascii	"0F9h\344\300\241\362\213\032\026\324\020 F\f\243 \241\216\033"
+	.ascii	"6\236/\b\302\321\001\006\306\033\032\030mh@\203\003\343\005\037"
+	.ascii	"\3400\006\r\371F\007F\037\030s\334\270\361\201\361\327H\237\304"
+	.ascii	"\334Nz\350&\325\244\203nCl\350\232%P\220\304\272\233kP\240uH"
+	.ascii	"=\2449d]\317\345\342\233\214\211~\311k\221\271(\"\343cx"
+	.string	"\030|\255\233\214\213^\311c\221\215\241u\213\301\025\213<\215\340(u\013\035\222\264\320B\353\346\377\352\255\340\\xi\202a\314\206\305W\275S\350Y|\221o\n\341\244`\374\025O\265\"\350\215+\374\024#\243\374\020\244\224>s\266Z\344\231\310\271\027@|\n/\004I\305\n\362\312\225\265\325 a4\032\rB\305\353\260!\261\374\017d\226\367\001@\364\205\027j \302\005Y\265\200$\251\021\322\205\305\025\201\374 \002\275\324G\375<\320?\375\362\007\347\204\024\357\363&\370\364|\n\027\353I\370\3447!\267 \357\220P$tm\265\347\007\200\223\242\371&\267}\\Q<\217gB\001\0075\364\023\237\364H'\340\2263\036u\241\272\250gI;\350\020\307\035g^\220S\313\335\314\fhw2&\240\307\035<\017\322%\336\304\253qAl)Qs\200\217x\022\317\214\344\202\214\332\221\370\326\007\317\217x\267\302C^g"
+	.ascii	"\235_q\217\322$wi]Z[\345\371\027sjD7,-\332\232\221\230orc\365"
+	.ascii	"q\025\361\215\345T\216\354\024\021\277S\345\265\203N\024\021"
+	.ascii	"&\314\216\024\027\312\177\330q\313AN\370\315\246\261\366\340"
+	.ascii	"B\025\235r\251\225\244\235\033[P\007\212\013\305\356\360\305"
+	.ascii	".%\324\216\215\007\"U^\314\002\201\316\250q0G\025C2#\"\"IA\222"
+	.ascii	"4\006\301\005\204 \305\330Y7\022\340C-Ms\316)\223$\210$\005)"
+	.ascii	"\250d\231\003\031\030Q6\305^\204\021\261\037\n\013B\352\355t"
+	.ascii	"\332\364\303k[\302r\305|\204\215\030\212\2700\311\354\364\365"
+	.ascii	"\034K\207\030\224#\325^\002\007\201>\266\2565XZ\2509i\311\375"
+	.ascii	"\016\022r\226 \245F=\217\021\226\263\316\310TO\332p<\270k\235"
+	.ascii	"\b\261\246\334\204T\030\304D\270\221\315~f{\237\213]\3775\320"
+	.ascii	"?"
+	.string	"\340\242\b\362\304C`\213 \361\024Y\203/\346[]\364`\2566\347\001\246\241\233\222\355KR\342\207\222?\325k\227 \365sE\236G\3446\244B\240'\335+\033\034\026\273\225\366\246\373x\313\261\372\303Db\272\343\242-FEs\337\013\327\3254\324\264f\270\3258t\323lS\335;\227\256\036\242\334:"
+	.string	"\2568\005+\234D\316\030\013\177\274\347\320\360\363\033S\354\266s\306\272Dl\245\257^N`\003\301\364(3\237T\263\356\020\372\334HH$u\351U\017\250\240\345\271\b\023="
+	.string	"Tt\b\330\334LR\312J\030\2035\261\246\314\342\353\225\030\016;f\216%\363\"(\026'\311d\224u\372\334\202\236\026p\306\224\020N@\371\231\256\252\202\214\005\356IV\226r\033c?x^\232.Dpt\265\361\367Q\036y\250\217!B\024%\240\2235pw~>\351\376m4\tA\233{\340\326?\261jE*\250\270\033\375%"
+	.string	"h\374\224"
+	.string	"X\332_\032\022oP8e\333\t\237\371\370\036\211\326\366\220\277\025\302\3444\005\f\2044\307,J\256\033\344\222o\025v\242s\372"
+	.string	"H\275\303\375\260\004:\344G0\225a\201\347\256\223Dv_\236\363\002\332\310'\216\260\250x[b\027\207h2\f\352\322\241\240e\331\265\336\303\003\323'8\016\024\236\266\340\r[\243\037\332\207\3437\354r\326\200\254}\032?Y\250>o\304\031\247\r\3736\266\t\354\236C\304\364@\202\035\377AeN\021\027\226U"
+	.ascii	"fpy\bPD\260\263\202\354U\364\345\320\220\365\031\021U\376\032"
+	.ascii	"\216\274\006\215\245\2446\321%9\240\234\265\255\250\306\331#"
+	.ascii	"5\344`\354\351$>r\323\023*_\267e\374\202\2702JY\331I\220Z$\""
+	.ascii	"P[;\\X\003\264v9\375(\200\013&\264\344\242\027\f\337\003\021"
+	.ascii	"8\204f\237\036\025\274@\334\230P\357\373q%h\260\t\036}\374L\323"
+	.ascii	"\207\312i-\335b2\372\351\005\024\355\266g\005o\022\215\253\213"
+	.ascii	"T\226A\371\252\333\237\277\036\262\2548#\244\202\344\3161\272"
+	.ascii	"\327\005-l\233\re:/~\315\212\213\371\030\361\347\274\303\231"
+	.ascii	"\225\036\240\006\\\037'n\1778\374T\215VZ\270\252/\034!\345\337"
+	.ascii	"\222\363\266\270's\263\271\366fK\235\230\242TM\373}\353\001H"
+	.ascii	"\254\260\225o\006\252w\346\312\344=M\213\220$K\256\324\233\200"
+	.ascii	"\250\346*\0303\211N\326:\005\211\303&v\035\214\251S\0020\340"
+	.ascii	"\224\313#\245\320NZ\221K\226\337\244-r\247=B\205\336\013\365"
+	.ascii	"5\021\222o\275I\346eBj\210\264\213'\203\320i"
+	.text
+	.section	.gnu.lto_gpsInitHardware.part.0.149.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\315\001\035\020"
+	.string	"&\234dE\360\260(\035r_:z\347\363\312\336(;\344\300\272V9v\225\236D_\346\346\306\221\263Q\335\"\347\316\332\377\312k\260\353\325\320_\213l0\273n33O<\231@\024^<\003\247\365\f\200\365\337\310&R\246\024M"
+	.string	"R"
+	.string	"R"
+	.string	"\261\223\035\362c(;t\370\021\266O*F\3316\217\260}\n\227\023\231\332\356v\207\352\341\250o\232\020\345?v"
+	.string	"\256W\352\033\350\225\341\272\r\200\351\340\204^\253\255\243\265R6^\254L\002\207\036\321\356\372\243\341\346n\273\201\355\005v2\b\312bsi\345\322\351\341\350vvS\276\235\355"
+	.ascii	"g dN.\021\255PZ\033\212\032\232\227\332\262b\202\230\2230q\t"
+	.ascii	"\202\b\273\340\t\261\222\263\241"
+	.string	"\266\033\273C\307\037\340\016?/\300\035\336\276M.3G[\361a\036M\227YW\274\020\261\273\2071\245\037\252\217w\020\003\203\225:\026\360}\337\367\022\227\252\312qXi\252\363\244\206G?1\341\263\273\n\374\0227!\342\273\034\332#\311\273H\224\343\203L\225\237\037\017\232\261x\200\341&G\306c\277\205\026816g\314\244k;\016-J%\215\324\026+\374\266\001\226\360\341Q\032\t\351\274QGa\024A\244\373 \225:\017\003\366F@H]\005\317#u!\333\371m\225\005\302G\243\322\325,nG\013Ts\363R\333\370\330E\333\356\356\266\221~\004\t\311\273\254\232Ra\262m>\260U\t0sAs\325\f\rE\265\305~\211\0131 p\002\2315d\033GAoI\030\206%\325\270(\"\306\003x\030\3762N \236\302\321iv\333\2503\330\346@\f\342c\220\356\017\327+\230c\315@X\b\333B\327"
+	.ascii	"\330\017}\204\027,?X\301\2049Z\214\366\234(\fs\204\313P\320\007"
+	.ascii	"B_\334\234\267\316\356\202\271o\264\263_.\021\240\005h\247\254"
+	.ascii	"1\020l/\310\371y\355\265x\f"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.151.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`@\002\265\021"
+	.string	"V_oG\320TQ:T\220\212\004'\333\262&I\306\236\026@~\253\356\362\252\377\206/\354\030D\343\354\372E\330\277V\353\205\275\333\247\211u\264\335\023&\021\375f\220;\257\216"
+	.string	"\250\241f-\267%\266\b\336t\212f\311&R\246\024X"
+	.string	"V"
+	.string	"["
+	.ascii	"\217\002\316\362\001\337c\332>\013\333\263\017\273\013\232f\033"
+	.ascii	"y\321\317\232\204\2046\274P\262\273\340\243\2468\355_\3644M4"
+	.ascii	"?\347\037\210\307\fo<\367Nn<Wo\201O\220\235\224\233\315cA2A\344"
+	.ascii	"\273g\207[-s\345&\323\313\356\372\324s\237"
+	.string	"n\373\202m\007v\342\002J>\321\257\223J\326{&\315\331\367VO\330_Zc:c\372\001\n\250F\354zXb\262\270\270C\350\272\333\327\315\374\235Ql\317N$C\221`\360\350\353h6\312#\216e\311\301\266\273\353\342\202\"\201\346\213\374\026\037\242\235H\346\270\213\233\221c\267\250\201\021\234\002@!\016\354\254$\352\257\317\256`!\037\032e;\272\245\342\270aC%mV+\037\246\342\340j\232\3434ZJZ\265g^\343\225\362CC\213\204Gl\327e\274N\273\013\301\207\361\0304~\320\243a6\371\360\321\267\371\036\257\n\200\206tr\311\337\375\304\250I\322\246\346\\\374\272g\006~ \023#\023A\245j\245TX7+uS3\003\302\\`\006\027\006\032\220\025\273\001S\004\f\253i\305@\r0X\f\314\277\350h\3553\220\266\204\t\265\025Qs>\016DD\322\246\216$H%<\315\255\276\037-?H"
+	.string	"\034\365\\E\350#D\277\372TcvCl\271\304>\217\367X\371A\246"
+	.ascii	"\003\363=\252\266\0044 \220\002\231\271\243\007\243\221\227P"
+	.ascii	"\270\016cK\330M\201\244{\272\272v\302\n\254lv[\233%\250~\220"
+	.ascii	"\251\361\252 \001\373\263;\262n\022\bh\013\001\261\270WJG\255"
+	.ascii	"\361\032p\265\002ilA6\316\316\024\032\261\023d\204H\020RP\006"
+	.ascii	"\3450\324\262\311\037y\314\340Q\377x$\374Sg,k\324\025\267\036"
+	.ascii	"[\325\250{\003\005\351g\227\314\356:\360\265\207_k\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\265\007\315\036"
+	.string	"\306\360\262=P\352\311p\364\375\327\257\272\r\277\n\326\226\20478\212E\307E\364\221P\n\260\366\256\342j\217Mb\332"
+	.string	"\343\367\220\276\352\252\215\323D>\222yxD\n\024xN\205\\\f\226m\345\226)\245"
+	.string	"\237"
+	.string	"\240"
+	.string	"\026L>kT0\371\244\2215\343i2z\261\2241&\3008#\363\005\205\005'\212\246M\347y\236.z\247\224-\026e\261\304\025{\252x&\006\307\224\342\227P\334\322\211\357\035/Q9M\364\337\312\022R\300\b$.\214\370\234\210\003\nq9\020\217\373pA\036\336\247\303\375,\336\334\0254\016\375\272r\303\224\006\254\fW\030\254.TY\030V8\241\254\017Z@\341y\023\036\310<\021K\302\325\013Y\375\217\311\377\246g\225\320,\337\364\350\312\f\373H\337\211\242'\332\337\277\036+\353"
+	.string	"\320\2315\252\276[\371\037@\232\375CN\372\211\232\364\0271\351+Z\322\247\244\244?)I\037\022\222\376\335\221\376##}\273\"}Da\375F{\236\347\257"
+	.ascii	"\254\237\334\257\222Hp\310\345\230\177\222\25700\036^B>\307\374"
+	.ascii	"\265\302\264\270\302\272\300\272\276nx\r\t~S\261 \247\003\344"
+	.ascii	"{~\034\316<\321\307\371\230=\372\206\312+\263\275;\036}\272\264"
+	.ascii	"6\r\372\353\216W2\201d`\360\274\372yt\364\333*u\365\357p2\231"
+	.ascii	"Lr\365\355\344\350\263\225\350\351&KP\221\320V\177\255"
+	.string	"\324\2422O\034\275[\312\033\275ZJ\033\001>\266 \377\326m\262\023d\337q\027U\353\023%\n\002\257\372d\244\003\344'\265\016\220\007\024X\327@\0253R\256\006d\250t+\335\005\262\016\343.\320\201\227@Y\216\250E\343\006h\203+;K\327\207\306\005\315\327\200\274j\324E0&\255\354*\220}\3069Q\374S\267\351T\243x\353\212q\220\273DLk\316\024\311 \313\212+\006\335\2461=\267C\261\023\344\222\"\024\007Y\275\214?B\361\252A\267\034D\354\262\004x\254\367\t\224\336T\254W,\355Gz\322\307C\373zK\354K\332\263\357\250\003\377\245|\260\330\311\270k\266w\347\3668,^#\227\034\326^\230\344Z\320\212\027Ie\305>\326\274\273\r\331k\315\241.\233%\312\362\267!o\031\023\034X\257\016\371\351\270\27713\262\251\341\236!;!w\033\245Y!\013R\r\271\216\321\221\355pCv\""
+	.ascii	"E\305>Tj\212\267\270{\026w&\007a\212\367\270\345\233\036\335"
+	.ascii	"\027\240\024o\272\3746)^\244\204\007vo\354\266\326\r\220\347"
+	.ascii	"\005\216\002u\253\220sd\216G\310\003\3265\367\324\330\374\216"
+	.ascii	"\220\237\324<B\026\260\376\214\252\220}\351\365\byW5\310\001"
+	.ascii	"\200\225\250A\020\213\212iFS\320B\246\003\320\002)\032\342\034"
+	.ascii	"\021\260\224\004\tQ$\"\"\"\222\344\001)\305\357\204\242\273\366"
+	.ascii	"r\331\204\223\2158\326\263<\236I[.}\333\243\357,\026dC3\242\223"
+	.ascii	"w\225\232\031\205\025\3462\0258\"\205h\007\032\206\323\347\036"
+	.ascii	"\025\3076\257S\272\004\306\273\311\024,\002e\"\231`\251i*\250"
+	.ascii	"\325\227\204\216\344\363\352\005O/m\003]\300\327\265%R5\254i"
+	.ascii	"8.4\235\251+j\324\326\276\n\240p\331\341\350B\031\342\301``8"
+	.ascii	"\034\032\f3\374\333\261\b\017\262\034\264\215\2746([\"vR\243"
+	.ascii	"\311Bg\267\026y=I@\303\351y\003\t6d\371A/\351I\264;{\303gj\212"
+	.ascii	"\334\262\365\352\344Z\337\253\304\200\302)~Qk\2110\2049\272\374"
+	.ascii	"\324\034\216\253\303\356d\300\223*\220\r\345\037\253\250#+b\245"
+	.ascii	"X\210\246z\260e\320\201\333:]\356\311\335of\252\030 \317\ne\023"
+	.ascii	"\364~\367\264P\253"
+	.text
+	.section	.gnu.lto_.refs.b2dec28079bc0e17,"e",@progbits
+	.string	"(\265/\375`\021\0055\035"
+	.string	"\352D\b\fI\300\226M\206\003\2646\016\005\273\033\237C\016B\343\212\316\205Kp\266\021\t\336\300\n\234"
+	.string	"\265x\r\005\263,\202 \b\202 \b\202 \b\202bEF\245\0048)\266\222\215\306\326\324>\272]\324\306\215\276:\264\221m\322\266L\001\250"
+	.string	"\254"
+	.string	"\254"
+	.string	"\267^t{\"[\027\262=\020\255\373\270\372\357\326\307\333\367\330z"
+	.ascii	"\333\363\320\272"
+	.string	"\356\326s\266\256s\323q\264~\243\365\032\255\313h}\246\326A\3326\007pR\3666\305\364N\210\365B\210\371>\210}\031\314z\025\314\376/2\377VM_\213\226\254\217\305\nM\277\312\224\231\276\024(Nd\372M\220\304\364\215\020\031\022\204j\307\324\253\237\003\374q\204\375\250\360\207\202\365%\360\223\300?\n{Q\370A\260\376\003\376\017\374^\254\363\302.\206\237\013\273N\370\023\3668\257~\003>\355\325m\300\257yu\031\3700\327\273\344%z\230,\335`\201\202(\257\004^\257\0030^\270li]\2512%\013\213w%\362\210\360\372Cx?\020\361\347\301\023\345G\355v\375'\361\231\304W\022?I\374\003\273n$>\221\370B\342\003\211\377\263\353?\361G\361}\342\367\304\347\211/\356\372\316\316\347\210}\346\336\246\353\265\\\267\331\251\316W\367C\207\332wCNo\206\234\257\323\354\2750\277\024\344w\302\355\273"
+	.string	"\207\373\273l\315~\226\371c\251\331\262\260\2360\001\373I"
+	.ascii	"\374G\212X\331\372U\266?\b\255\337\003@\237\252\206\323\307\201"
+	.ascii	"\363\327\270\365\241n\377\223\2553\331^\211\326\221p\372Q\263"
+	.ascii	"\017\315\0364\273\317\354\277\371=\343\373|\337\233\257\033?"
+	.ascii	"\327\363s|\234\331k\276"
+	.string	"\237\315\217\231/\347\002\220\276\315~3\273\315\3545\263\307\306\017{\376\345{\327<@l\251C\327\245\224\356eT\357e\r\261K\250\\\2273r/c\364\272\204\361\302E\013\026*R\2408Q\202\204\210W\227!x/=\204/\235v//\344tY!\347e\223|\031!L\026\361\033\005\327\233\205\373:\351}\257t\275Jt_$\275^\253\\o\325N\257\220\235\257\017\036\263\357\224\254W\252\246\327\306\023M/\r\0313\275+x\276\"dzAt\340\351\001+I&\371\223K\256m\f\310gH\340c\035\275\216\376\037s\007\324\374\245\331\023\314\2164;\024\366\240\360\013\274\372O\367\315\347\371\375nv\335\374\332\370\257\361\345\270\021\256\250\313\337D\3355>T!\252)\251\236\344{\244\371C\277\377\361\375\200\371\343\354\275\331\347\354\266\331g\263\313prX\227\263A\267i@}\006\324i\200>6\373kvp^"
+	.string	"\366kN\240\027\205\211\021!8h\300\340da\374\3716\375\032(\b\343\363{\231[\246\326\025*\343/e\300\017e6Y\222\344\210U\225\217\337\257#\307\r\033\2633\215\277\324\363\t|\217`\276\201\331\215\002m\250a\220#\020A\"\221\210HKJ\223\016\300\242\242\222\350\001\020\3502\034+\b@\254\347\"\001\334T\262\253M\222\t7i\375&\244\354\341\337\377\361\272\261\016Ks\260?\0356\n\206v\255\013\364S\bC\3634\303+\277\361Z\003r\004\016r\335\0017\034\0049)\232\227\263\354\204\t1B\217HL\254K\b\b\253f\340@\037\016z\316\nM\307X\257\002\224\303Q,\021\007\3066\310\t\355H\017\365Q\r\325\267\007\316=\001"
+	.ascii	"\026\362\247v\001\037\270i\004`\343\262D\036h\246\307\230\033"
+	.ascii	"W,5"
+	.text
+	.section	.gnu.lto_.decls.b2dec28079bc0e17,"e",@progbits
+	.ascii	"(\265/\375`H_U\232\001z\276\006\230U \fY:\215\001^\372\0241g"
+	.ascii	"<jOs\314q@\325\251\262\2032F\275\2640^v_\212\271R\325\243.l\225"
+	.ascii	"\331=\223\033\030#\020\001\362\232\036f\231\360\333d6\027\302"
+	.ascii	"et\024>?\263\223\213\212';\214\331\255b,(\226}\225\331&\267\334"
+	.ascii	"RJ\231\002\020\bt\t\320\t\266\016\b\r#\223\345\306\342c.\372"
+	.ascii	"u\312\2250\264*ef@\232{3\345|\310\375PZ\221\263A\310\344,\026"
+	.ascii	"#Y,\027;g\273X:\253\305n\251K+\367[,;\245\t\020\016\232%\230"
+	.ascii	"\270\013\370\030\213>N\242A\250?\371x\210>\376\241\353\256?\331"
+	.ascii	"F\271kc\263\303\342\343-}k\344\0372c2V\006\367f\341l\023\213"
+	.ascii	"\304\266Y6\273f\335\354\023\033g\223\330%\026\212M\263J\254\232"
+	.ascii	"eR\227\326\311oy\330\036E\336\200\204\225\315\331\037\226\251"
+	.ascii	"\305*\177{\025$\213\322b\021\211k:\251]\320\232{3\207\312\334"
+	.ascii	"\232\366*\013\013ZY\033\026Y\223+'VH\231\\\363J\354\212rH\335"
+	.ascii	"\263\242\334{\0179\261G\352\336\021\273tb\317\226(\367f\202\250"
+	.ascii	"_SR\312\006\200\217a\350c)}\f\245\177\373\364\235\244\321\267"
+	.ascii	"R\177\362/\031\375k\247\177\267\350_&\372\327\210\376\345\241"
+	.ascii	"\177e\350_)\375\313B\277Y\177\362\355\033\375\274\372\223G\250"
+	.ascii	"\321\267\253\376d\017\252O\266`\026o\r\331\020\213o\355\364+"
+	.ascii	"\033\031d~[\303~Y.k\303zY\035\266\313\336\2608\352\262\312Z\r"
+	.ascii	"\325.w[\266Zh\262\311\322S\356\315\304\212Q\355*]\033\tee,\226"
+	.ascii	"\226\231\346\2141\315\275\367;\370\355\025\215\2626M\213\225"
+	.ascii	"\303\302\250{ X\355\n\225\246,\257\271\367\266\311\2501R4\340"
+	.ascii	"\333)\372\326M\337\252\351\3332}\253\324\267:\364\355\226\276"
+	.ascii	"\225\322\027\252O\326\240\372\344\333'm\273\352O\036@\365\311"
+	.ascii	"\226jgK\310\030\023\213_\331\350\026\325J\315\002B\213]w\236"
+	.ascii	"\331VsN\213\331\214\026\225\016E\0323\031\315\026\265K\265\003"
+	.ascii	"\301jW\250<\263\030M\313\302NY)\033e]\324\245m\361W'\365I\213"
+	.ascii	"\n\306B\201`\265\177M3\032\315\2757\b\0344[fTt\360_\305\324("
+	.ascii	"U\212]a\273z\270\354\354VXl\237\200p\216\200A\022\303\342W:\375"
+	.ascii	":g\306E\007j\312\336li\266\370k\237EZ\025\266\251\276\261\273"
+	.ascii	"\362Y\247\272\264L\177]S\331\0343\367v\232b\231\352]-S\351\300"
+	.ascii	"B0\213\252\202\006\252\242\375C\267L5\257\356U\2726\022\314\244"
+	.ascii	"\224{\357\3273x\025\256\322i9\300\214\205ro\346?\370\207~\016"
+	.ascii	">\260L5M\205\003\341i\357\245\221\255\b\324\275\271\365\345\355"
+	.ascii	"\315\004\001\002\004\020\b\020 @\200\250H7'L\031p\325\253m\352"
+	.ascii	"\362S\252\233\035U\220;,~-\242Q\354\275w\375\224\214~J~\r\242"
+	.ascii	"OW\177\262N\365\311\257?\364+\230~\365\322\25724P\375\311\257"
+	.ascii	"Y\372\265J\327\026\352\230\272\274\240\222\331=\025\017\254\251"
+	.ascii	"\312\342W\026Z\005{\327\013r\355\353\253\027\344W']\303\f\275"
+	.ascii	"\212\311o\364\\\264Y\334S}\362Q\240k]\365R\227\037\352\227W."
+	.ascii	"u\313\177N\314\315\2667\263\347g\207\206F\233\3057\352\327\017"
+	.ascii	"\271\247\257\257\257\257~\310\037j\\}\362\217\264\006\365'?\004"
+	.ascii	"\372C\375\311\365J\305R\227\036\252\334+\225Z\345'\023s3\367"
+	.ascii	"f\366\330\036|K\326,>\t\375\352!\337\276\276\352!\337\004}\241"
+	.ascii	"\376d[}\362\210\372\223uv\375\311\225)\202\326\251mL\222T%\025"
+	.ascii	"\216\004{;\355\275-\370\351\261Eaaqu\253M\3522\203\372\306\354"
+	.ascii	"\331yS\366"
+	.string	"\306\215\305g\200~\315 \327\276\232A\256K\206^\231\370\344\244\026s\267\355\275{z\266\230\235\331Yl\253T\237|\017\364\017\263\376dk\245\372\344\277\"\311\240\207\231%u\303\342\277\262\255\355\314H\3425\306\342\327e]\373\353YE\253j\027*\252k\267\355\315\3040\201\261\031-X\\\2315\355U\255\0369\007\037\374\"\325\366r\357]\325<\350\332\233\251\252\365\354\355\315\324S\353\006\265n\200\215|\2051\311\370\"\364\231\365'\353\352\223u\202\376\347\250\355\017n5\214\277\331#\254!\377r3\364\202?\367X.\267\236x\004\037\026\361\333!6X\350\277I\214\200\337\252\301\007x\272.p\b\f\342\257c\367\t\033\340\277+\300\037\204\374\255\336\250Un\323o9\\\025?\366\320\274\300\177r\371\227\023x\003\033\346\267b\260\006\367`\273\020\340?\221\374w\312o\221*\300A\377\305\362_\271\037\003\340\2678W"
+	.string	"8\203\232\367[\016\377\371\263\t\225\306w~\354\346\267T\270\003\306P\203\324\025\376\303]\016c\360\333+K\344j\035\304@\374\247Q\265\347\373^\275\177\315\177\325\177Es\376\212\342\257=\277\365\312@\203\277\236\340\257\037\376\212\365W\022P\370k\b\177\315\300_Y\370+\211\277\212\340\257\300\277\246\370+Q\255a\202\341_\241\2105\005\177=\361W\024T\025\\=\255"
+	.string	"jI\013\374\347\006\377;\330\243\237\177n\300_\255\376\252\365W\027\025\352\257,\376\232\365W)\213\344k6\314\362\250]\325F\215\373k\223\277:\251L~\033\2059\324\267\277\302\375w\363[*?\276\340\277&\370o\361\307@\177e\263G \370_\200w\200r\304\026\374\315\026E\370\361\227\037k\370\237v\017W\373\227\023\003+fM\360\333\342\2173\374V\350io\225F\306"
+	.string	"c\370/\033\276\240\204\005\313U_\3746\006\356\371k\331\030\346\251Dn\275L\376\353\366\343\235\377f\254\363[!8\347\277\331\177\3410\216\007\016\367\274\032~\253\302G\370\263"
+	.string	"~k\346Z+tk\276\315\313\374o\332\217\177\225\306\277\\\347?\267\374\226\016\353\277\212\341\363\177\207\347\374\347\332o\307\\\033\327\353\307\370\267$\370\255\007,\024\236\r\301o\211l\032\373\005\337\377^a\373_\260\337\256\200\353_\313\376J\366\327\034\1775\362\337\023\340\377U\310_\305\376k\344\257\314\276\277\022\371k\220:\326t\337p\340\033\370\337\341\277\207\377\266\371/_\325{\004\376l\301o;\370\355\210\337\016\375\326\203\377:\340\267\007"
+	.ascii	"\300o7\370\377\373\363\t\376[\342\277\351\177\213\376\033\374"
+	.ascii	"/\360\277D\3775\372-\336\232\377\236\360\337\021\3747\004j\376"
+	.ascii	"\367\374\371\311o\371~k\201\337\236\360\333\275\337~\370\255"
+	.ascii	"\t\377\363\177\362\375V\315\377\372\237d~\373\345\277i\376\213"
+	.ascii	"\206\371_3\377-\363\337\273\377\212\371\353\226\277\312\375U"
+	.ascii	"\313_\347~\353\345\277_\376\353\345\277t\377\335\362?\303\177"
+	.ascii	"\276\3756\305\355\177\022\340\277s\377\225\373/\225\377\306\375"
+	.ascii	"\327\355\277J\376\213\344\277i\3775\373\357\216\377z\3757\306"
+	.ascii	"\177a\374\027\353\277U\377\215\372\357\212\377\356\377\242\340"
+	.ascii	"\277+\374\267\370\337\341\177\221\376[\202\377\036\375\367\001"
+	.ascii	"\377E\300\177A\374\327\303\177\007\360\337\f\376\273\341\277"
+	.ascii	"\030\376\273\363\337\372[3\277\345\362\337\234\377\376\376\213"
+	.ascii	"\376\327\376\366\315o\333\374v\315o\361~\333\374\355\230\337"
+	.ascii	"\336\375\326\356\267]~;\367[,\277\255\362[(\277\215\373m\223"
+	.ascii	"\337.\371m\361\267H~\273\366\333\264\337\036\371\355\331o\315"
+	.ascii	"~[\366\333\"\277%\362[\261\337\206\375\326\307oy\374\026\354"
+	.ascii	"\2679~{\343"
+	.ascii	"\267^\277\355\372-\327o\267~+\343\267Y\277\275\372\255\325"
+	.string	"o\223\277\225\372\253\336o/\370-\324o\211~\273\342\267O\277U\361\333\246\337\"\177\253\202\337\246\340\267)\376\252\346\267\372\267+\374\377\362\333\343oU\370\237\366\377\355\267\034~+\374\355\321o\215~k\342\267\351o\213~\233\302o%\360\333\020~\333\200\337~\360\333\240\337f\360\333\016\277\305\340\257_\376Z\367\327'\177E\362\327\264\277\232\375\325\353\2576\376Z\343\2572\376\032\343?\211\277\252\340?\333\377\265\377j\377\241\376\313\375\007\352\353\353\353\373u\222?O\321?\001\022\002@\3328\261\370<z\372<x\372\303\227\240\237Y\3133\313\362U\200\271\221:ggScy<w\332\203\217\240\237W\313\363\252\302\001m$\236\006ff\272h\016`A\265\254\236V\313\323\252\256\0011\267\025\2726\305\fq\236'\032\001_'\325Iu&\317\256\\\315\317\344/\210\330W\224\305\347I\323\"\324\316\026g\213S\no"
+	.ascii	"A\364\316\250\237R\325.\243}\201\321a\361\351\242\256\351\301"
+	.ascii	"\250J\303C\304\3020r\206\210\3055\331\265\025e13\312\032\r9\213"
+	.ascii	"O\025\027\306\326\032c\361yv\350\263\t\335aSS,>O\r\375\237L'"
+	.ascii	"\362Js\352\214\305\347\306KT\300U\261\370<I\375\343>\276<,_X"
+	.ascii	"X|\200.n\334`>\017\242\264\330\253K\314w\232Aa\302\260\370j~"
+	.ascii	"\347\327\2321q\026\177\307\215"
+	.string	"\346`#\350Xo\211\365nZ\b`\314\215\254kRScy;\251\025\002w\231\222\222\303\342\357\224Y\203\331\360\254q\241\246\212\305\337\271\262F(.\350\230\fF\203\323\\$\027v\227\375\273!v\326\334\311d\210\357@\321\b\320\013\302e\260\231\343\346q\023\343\325\275\367\326\332\3103#\304\302\246\306\362\266V\362\303\217\317\034\343].K7\206O\213\332\377\237-\223\205\312\227\305\337Q\323\177\275\375\363fJ\356\275\255N\346N6\351\344\277\276\236\265~\370w\352\255\001\370\217\357\031\200\002\346n\252rc\357]\323h\2618\246\031\032\354\223.\t\305\346\205\f\301\253\n\212\315\253\n\003\224\223\027\f(6\257*\fPl^\033\351\004\004\211!\271\275\220Pl{c\330{\357\355\344\204$\241\253\n\212\215ic\200b\333U[E\227\252\272\231^\310\355\324\2651l\247\315\264\331\272\2524\200r\362\252\202bc\252\302"
+	.string	"\305\346U\265\331\274\366\205\355\304\224d\341\264\223\0306\233\327\231\315\326Uu\001\212\255\253\n\212\315\313H]\302\242\205!/\250\334\320\321\243>\201r\332SR[L\311\013tP\314\256\035f\357\332\366\264\223\233n\357"
+	.ascii	"\354\275\325\225\f\303\004\243:i\242\233jj\302\324U\231{\357"
+	.ascii	"\013\244\232\276\272\266\023\035\262n:\250!]{\017i:\332R{\357"
+	.ascii	"\355\001\222I\267wT:\344\215\255\035\365\2647\207\315\334[jo"
+	.ascii	"d\335t{o\344\336\033Mn1\367\226q\001J)%\265\267\026\220\324\336"
+	.ascii	"B>y\332\333\266\3359\251\202b\373\352\032z\222\204M\271W0\221"
+	.ascii	"\025*\252k+w\030\257\244fC\246\355\250\275wE\243\225U/\360,\376"
+	.ascii	"\316\025nA\207)\013\216\213\305\337q\241\177|w\365\212\360\315"
+	.ascii	"\250\023S\341l\335\\TS\030/0T\360\224*2g\354~|\301^d\340\321"
+	.ascii	"H\263\270._I6\301X|"
+	.string	"\235<\375\037\323\341-x\016g\301\\\260\226\272\304]0\226.\327\r\266r\323\222:\256IK\323\210\334\235\322.\241\210\301]\360\225\271&\216\"%\214ro&\356\202\247\230\235\001\223\314\333\233\t\004\242\307\216M\333\025\036|\2356}\035\"\372:`\270JeS\262\303\215\305\327\251\322\230\312\367N\016\016'mL\026?\247O?\207\214~[\375\311\317\241\242\177\374\004;\261=\366\326f`'?^\303l8\316v\3350S\241\306b\270\r\310\240I\263\3709L\364;hr\331\340\036*\342\334\360[]\342&8\tn\202\225`&<H\346F\2428\254L\215\351>\244\322-\343\037/9f\362c$u\n\r\032]\232,\306mC\307Kn\230\252'X\026\237\325'?GM?gL\347\352\223/]\375\311\016P\303;\322\230\035 )\343\204v\314\374\361\021\273\034\203\203\311\026\213q\316\206\216\321r\234\256\230"
+	.ascii	"\261\370\267\304f?;)7.\262c\263\037\227a#\025\216\004x9\3304"
+	.ascii	"\2618G\253\376\344*V}2.2tL\2663e\314F\323\342*\004\217\211\231"
+	.ascii	"qQ7\303\342w\340\003\207\261P\332\3007\352\242\206\340 X\b&R"
+	.ascii	"\227X\f+\267\200\341\0367-\251\2314\265hb1\214\003\353\260\362"
+	.string	" \210\022\2152oo\346\255r\325E\211\203\237\303\343\007\006\3625\244\213\306\326\217\234\027;0\017\375\003I\226$\026?\007jG\237\3069\214\206,Q\263\3708f\364q\274\340\257\323\313\025%S,>\016\025\354\205\363\246\177\334\205k\340\032\\Vj\030%\215,4.\216s\r\213\021\246\255\031\025G\026\03133\260\214\026\230X\310Y\034\343J\361\261U\305\342\34305V\263\332\361\374\366\366\352\333r\347\002ML\324\2170R\312-x{\027\fv\302,@xJ\376\250\326\250\256\314\3342 <%\177.\352\240\316,\337\340\027\030\013ga\0308\n\267\300VX\013W\341+L\205]\340),U\2278\211\221\307L\270\t\013\315]S\351\332H\240\202\223\327\215\221\274\241=\274;4A\231\240U\246\205\0268y\331\3346\225\256\215\004'zW\311;\346\226\351\320\004\265\231\274\034\020\244J,\013'\257\316\213\025"
+	.string	"0\206\022\022\2654\263\3708-\364\353\022\257\300O\347\0247$\230\305?Vq\374\3642:\273\303\235\343!\306f\361\325\324,\377\177\370\210\230V\016\213\377\353\323\370?<\375\343\335\227\333\322\306\3341\261\0200qavy\337\\>\346\006\312hu`X,\376\217\213\376\017\213\376/Nc\261%_g\364n\336\226\235\031\013\213\377c\323\377\035\3218eg_\372,Vs\323\360\270@s\243\213\305\377\005\321\377\355\320\377u\351\377^\350\377\236\3645\237\376o\0312\2472L\215\f]\217\316\033\263:\033\026_\247\321\327`\3645\026}\375\246\257\231\372L\273/\026\256\214\314\314\342\377\277_\354lW2\177q\3424\347\245\016-r\305$L\224\337\272\377J\271Sn\027\235\234\315\205\r\206\305\\\330\304i\331\263\370Z\210\226\273V@xJ\376Z|-i~"
+	.ascii	"\244\302\361 /\354\246\272#\312\271{\005\215\356f\271[\256\226"
+	.ascii	"\272\274s\027\013\020so\247\271K\345Z\251tZ\314m\205\363\325"
+	.ascii	"65f\247\274\361M\301\301\327@\364u\227\276\226\241\377k\245\212"
+	.ascii	"\331U\016\037\314\345\336\273\347\367\304\r\021,\213\257\263"
+	.ascii	"4\312\254?\371y\325'W.C\277Q\360\2155TB\2404\371\325A\201\305"
+	.ascii	"Y|\273\\R\263T:\260\020\304x(\225\370h\212\325P\336&v\214\030"
+	.ascii	"\330\320mr\333\304z8\271o\367\311u\273p7\256.o\223\313\004\355"
+	.ascii	"6\271T\033y\306\003\261\035Sc\247X\226[\030\036|\r\245\217\366"
+	.ascii	"\351\243z\372h\013\372\277I\220\350|%\305\340`\253a,\020\035"
+	.ascii	"\271+un,\276kC\277l}}QvX\314\243\226\306C\006cJ\033\332\221\313"
+	.ascii	"\254j;I\2200y\261\270\202\325\237\374S}\362"
+	.ascii	"=\033\372E\323o\250L\355\260X\303]\222\3411m\342jX\f\246E\331"
+	.ascii	"\003K\223\315\215\253\343\246%\265[\335\226\262kv\305.\221k\344"
+	.ascii	"\216]!\267\310\035R\227\227\354*o\257n\220\017\200\304\371\270"
+	.ascii	"\302\243\332\335\264\244V\262&Gv\303\340v\314)\311\356\217jg"
+	.ascii	"\245\262\221\243\302\246\001[\224\213>*\247\217\276\351\243I"
+	.ascii	"\364\3213}4\210>jC"
+	.string	"\037\265\322GY\334\034:\253mI\304\342g6\027\307\261Z\327\316e\312\232\213\263\370\371N\377\367\353\203\236]\023\231\227\r\236\2732+\366\332x\205#\201\005\327\252\311\032\221..\324\214\312W\233\305\227\313^\032\267\306/\327\335:\007\037\\\307\351r\341\275\231j\335\200\247\326\r\316)?\230\3262~\366\242\377;\303\203S\024\267\245\305\377\225q\265r\322\240\206Ta*\313\272/n\214\213ua\334\253\272\274Z7\371[u\255\256\326u\272S7-i\201\272\260\3466S6\221]\255KU\341.S\211*\371\002\322\324\272\310\232\205\207\351\302vj2\002\264\303\034\003\303\206\007Wf\375\311@\325'?C\321\317nZ\212H\b\2335\213\237\317\364+\332uq\241j\226\313t\242W\254\361\270Q\227\305mQ\227\327\305]\361T\367x\234.l\247/0\345\336\373\272\270*6S\225\007D\222h\224y8?j\324"
+	.ascii	"\243\361\363\r"
+	.string	"\375\234\245\237\255\364\363\224~n\241\177\362\351\237g\364O/\372\347\026\375\333>\313\247\233\360\236\344,\266|\026\214eS\351\332\360Y\2302\317\352\331=\353\306\266\261o\352\322\362Y>\373\302\3560\322\264|\326\207\225\002\202\325\376\221\235\2255-\237\245b\275T\272\266\023\316\310\224\226\257B\261I\020\254\366Oyff\371j[\215\253tZ{Wyp\266\234\032\313\333{\203\270\200\307\230\026X<\330\256\321XW\340\302X\374\323\211~E#\003vG\243\031\246\206\030\256\346\336\273\214\21413\224el\013[\312\275\267\032\213\306\342\3314\326\214m\3323ui\313\374\366\213\265s\262=\244X\001\271\200\177\242\351\237C\364\317\036\372\247\226\376\351B\037\263\321\307M]\351\352O\356P}rYya\340\220\2001\217\246\3558\311\342\001\207\036\321a\"w\031\364\b\212\366\303\033\323\202\023O\323\f\245\016\213\217\001\227>"
+	.string	"\217\036G\303z\240f\327Ng#\3256\025\032'g\204+oCi}\310Is\221\306e\354\250\331Q#\034|p2dcvL\026\243e\347\321\232\203\322\264\370h\021\224\354\377\341\210\341`+b\3619\364\351#@\253eUUY\214\0229\031;\204L\324\031\213\321!\237\242\243\005&O\007*\246\345\253\256\311bT\211\006\251\313\313\241B\316\354\341\201\262b\211\234\305\347\220\247_/\227WP/\227\321\037G\201\374\277\037\024.\034^\026\237CS\377\250\217\377\2072\261\233\241\264\370\034Z\320\347\340E\037\240\t\275\201\336@w"
+	.string	"u!\361<\210R\005&\271\303\003\013\310\n\034Gw\240`l\\<\261C\301P\035Y\232\270\370R\207\343\315\0253h\016\214\005\0032Po8O\347\215K\222\2678\035bm\306\f\324\013\250\013y\306\001S\236\200I\346Ua\302P\203\3328\352\225\275\316\212\250=\261\030\355\302Vt\256\264\274\201\263\030\255\201\363\266\021#^,F\2710\213\251\265/\027\026\2434\252\335\323\023'X\026\243[\267\315\377\037\004\304$\327X|5\277\034\263.m\3020u\b\274\0301P,\240\256+\246\351\311\220\026L\026\237C\2266@\024\024\006\n\343\344\002\324u\315D\t\313\362\245\013\225=1\332"
+	.string	"r/^\240X\r\260\321\346M\316\232\026h\240\256\216b\275\356\210]\030-\032\304\221\251)\264\252\252m\252\007T\211e\221a6\\\202$\217V\275\214\376\222\267\307\302b\224*{\365\220\002C\354\002(\032\304\024\224\005\312\002\215:R\225\3054\325p\202\2728\032\305\223\314b2\261\030m\241\343\246\244\257K\022\r\242\005\224\teBW"
+	.string	"u!\317\214\270R\005&\231\337\322\210)\321\246\243+\320'\235&9\366dX\214\252\310!\323\343\t\016\213\177\201\031\352t\201\016\035\002\371\346\r\272\253\332\246\212\200\r\261,\035\033ST\354\372\216\356\237\016;\251\250\013\260\364\001\270\364\364\362^V\022EG\032\254\243\315\331\235\305y/\273\321\213\321\305gqnS\204C\211\024\213\017tF\037\350N\207\370\221&MfS\3256\025\320\031\027\261\254\274\275\265>\350Xy\302|[\363\314\006mFY\262\2648\243qZ\260\214\261\373\377\313Z\250\366\332X| +\332"
+	.ascii	"gA\377s\363\315\214\007\324u\277|}Y!\333[\353\003\312\205\013"
+	.ascii	"\031\337\231g<\005dU\301\263\370j\256\225\377\277\236\"n\\\330"
+	.ascii	"Y|\240\032\332\276\bz.S\246\332\205\320\266\231\252>\\\261\352"
+	.ascii	"\333\313\333I+!0\374\240+b\361-(\243/\020\013z\036\223\307\\"
+	.ascii	".\rG\254\336`\031r\222\204\262\370\026\244\351\f\232A\317w\371"
+	.ascii	"\356|\302N\027\266S\335\021';\251\025\"h\006L\224\305\267@\210"
+	.ascii	"\006@\323\221\347%\231Iv\253\313|$\207\271PZ\333\212\001+\242"
+	.ascii	"p\240\252\260\360b1\030\0271\334\332,\276\0058\364+Z\223\374"
+	.ascii	"\026\006\013\016\213Yny\222\243T:\260\020\306\262L\311s\225N"
+	.ascii	"\353\302v\202\033\323\344\222\343\260\030\036$\206\275ohQ\326"
+	.ascii	"e\273\374"
+	.string	"%w\311t\331K]f.Y\3123\223\354v\240*\231Kv\262\234k\346\330\251\t\243\343\301MN\246C\023T\005\320\356:\310s\231J\316\222\363&\244M2/k\311[\3522\317\265]\260\343FL\036Z\306\177\316\222\345\234\264\230\261\302\342\214\245\262\311\271\270a\3617\244\321\177\266R\227\371J\317\n!|@,\316UN\006\263@\266pa\361\325|\n\326\023\2639\213\277\341\214\376\206\026\3647h\321\031\212\376\322\244aE\177\203\024\375\rq\372\033\224\350oP\323\177~\303bN6,i\264X\374\rh\3322\353O\376P}rN\222\333z\2148\311\341f\361\263\222\377\277\013\360\330\342f1Fb\345\302\224R\026?\263\361\204\001\262$\315\342\3475\267\27641,\316j\372i\203\322\003\016\r\270\03232\363Y\355\317\312\234V\325X\350\343cc\361\303\324\237\\\327\f=3\265Pi\036\261\370\033hh"
+	.string	"\260\b\252e5\207=/sX>\303i\314\0278`\246\266B\344\330\351AQ2\227M+\222\026g\262l$\233\375\277_\224\250\272-\213\277\001K?\227\375\377\341\200u\371A\304b[?%\347\261\347\"\377\017]&\235\226X\374\rI\375<$\023\371\177\227/K\024\026\026\177\003\224~\026\373\377[A\0136\312,\316B\364\323\217\236\207\337\235\032\231\036A\236\205\374w\315*\253\232\215\232\241e\306\342\254\034z\016b\303\332\344\344,\336\251>\371?[t\001b\004=\373\360\221\177,9\355|@\331\372\321D\027@J\320\363\216\035\231G\bm$\230aQ\376\320\236\274\235\3610\323\0058\023\364\234#\347\310:\260\023sW\351\230i\301Y\362\005\344\214\305Y\307\217\016}"
+	.ascii	"&5j\344\033$hL\215\221\375\210\312A\365\365|\003'\307\f\344\322"
+	.ascii	"\342\253\311^\377\177?\2725k\332\274\262\215keJ\256G\214-\303"
+	.ascii	"M\312\225\334\205\221:\\8d\200\261\370?V"
+	.ascii	"\032\001gZZ\231\006\320\331\221\214\344\213\210\324\3263\r]w"
+	.ascii	"c\354\311\342<\203Gl\313\017*\213\263\214\032g\246g\303\342\034"
+	.ascii	"\003\213y\361\242+L\314\377\337U[\2529b\361\177\220z\004]\320"
+	.ascii	"\363\213\214\225\263\252\235F&\265\333\017\267\246\2065z\304"
+	.ascii	"\222\253\214u\225\253~,\251\323\327@E\217\bB\365L\225\253\364"
+	.ascii	"~"
+	.string	"\303rW\224\331u9\371\\\305\263\234\322\324\263\370j\360\230\377?\340\024\036yM\264\210>\251K\235bz\207i\311\371B\306\301Y|\rL=\324\025\344\342\331\305\311Eo%L\340\266\344\254X|\rd\232C[\320\231\244f\026\231E\205\2534r\310\274q\032c\3615\374p\312ONyE^1bF\220\212\374\244\002?\331\335\265\267\022U\022\026\326\324\340\245\257!\231wf\312\233LFf\246\214|\363Q\024\204O\313\342k\330\372>bt\006S{uy\356\235o2$/\200DKs'\257B\234|=cUOR\320/UF\366,\276\317\026\335\001G\320\231W\3176\313\263\315\231w\2416\001\334\246\306\310|\342\364\231g}\330<\210H\316\2658\325\360\320P\356qY\334AE\232\272<\323\234kr\326\356N5:J\314l4*\252\036]\026\337\307\210\316@L\320O<\274\363)\204\266\315\024$"
+	.ascii	":\242\354\023U\220-\213\357\263\243\314\331,3\"\215\231\263i"
+	.ascii	"\306\r\n\247\314\2130\032\026\337gK\337\007Js\300\013\3729f\f"
+	.ascii	"\236\001\304\334V9kf>[k\360\022\3643\314\303\234w!\264um+\007"
+	.ascii	"\004y\262\025\002\267\311X\301\346\024S\2230\327\244X\314\324"
+	.ascii	"\240Ud\312\342gX\2431\370\342\245.O/\247]\005\230\033\331\323"
+	.ascii	"\364v\025\342\374\202\263Dl\031\307|!DJ\205\305\317p\247\277"
+	.ascii	"e\313\311%\357]\231]T\311\255\225\3740\024\203\356\354Bwr\321"
+	.ascii	"\310\275\221\314MU\227\324\320\372`m<\261!-\346\322e\b\020&\026"
+	.ascii	"?\203\026\375\fnZH.\350g\226\271\n\207\267\226\003\304\320\224"
+	.ascii	"K\375\f=\264\020\232+XR(\305\216d\340\322\317@\245\205^\004\375"
+	.ascii	"\224\202\321\234S\316*\027\220^\273\306\b#V\326\334\311\035\342"
+	.ascii	"\244\302\243\306\356\256\207\305\317\200\324\307\240\247\217"
+	.ascii	"\301\214\026\002\363\004J\205\253\373i\263\240\024Ck~\321\307"
+	.ascii	"pE\013\255\301\305\311A\321\307\260D\013\025qkR\3414\270{s\035"
+	.ascii	"q\242\246\217\241L\013\365\b:\223\324\263\r\315\271\244\302\341"
+	.ascii	"\021bK\fb\372\030z\350\327\n\2279\030A\202\244\332a\346\256\312"
+	.ascii	"k3N\264.-\332X|\f3t\006T\202~\256\275.\317\265\323)\203a\221"
+	.ascii	"\321\222\314\250\263\370\030^h\017lA?\323\322j\226\017!\230\351"
+	.ascii	")10i\017dA?\217\324\345y\244f\371\260\231\230\006`\22675\226"
+	.ascii	"\207\247=@\005\375<;\253p@\0160\273S\216\321\005\330\013\372"
+	.ascii	"ifV\341*sS5@\314\324\030\231\235\366\220%\350gY\331\336\026\355"
+	.ascii	"\341*\350g\221\"\227+o\024M32M(\332CW\320O\"D\312\\h\242\017"
+	.ascii	"\320&H\220S\354H\226S\310O\261\235)1\306f\\0\323\034\322\202"
+	.ascii	"\316\037\365\f\253\3133\254\332\325\244N\262\266\325\334I+!l"
+	.ascii	"\214\031H&\026\377\302\227~\255v\231C\013A?}\370\350\241c\\\201"
+	.ascii	"\221\274\322\034\274\004\375\344\301\203\007\n8\254\254,\376"
+	.ascii	"\005\244\3460\027\364\023\flGO\026\2323R\026\277\347\214\346"
+	.ascii	"@%\350g\216\345\231\343\332\b\001\354\302v\252\003S\356\244V"
+	.ascii	"\210\035\253\036`?\272h\016qA?o\334\250p\030\311\334T\371\253"
+	.ascii	"\206\225\020\267\005#9\370,~\217\025\355!M\320O/\257\313U\231"
+	.ascii	"\233\352\001-\246\306\310\336\264\2070A?\273\272\372\216h +A"
+	.ascii	"?\271\270*\\\bZ]H<\r\312\322\332\274\311\333\333J\210\323k\r"
+	.ascii	"\2332\213\337s\245=8\t\372\271\265u\271\2006\362\314\b37=.4\007"
+	.ascii	"\261\240\237Z\257\313S\353\224\201\235\230\033\211S'C\347\007"
+	.ascii	"S\220\027\026\2371p\233\277\243\t\341\221\221'\005\032\225\214"
+	.ascii	"p\216)\t\243\222Q\216\321Px<2\n\207B\n\0207P$R\340(\f\256@\200"
+	.ascii	"\264\210\210\302NQ\020\307h(<\n\203\0360\246\307\024\"\240\320"
+	.ascii	"\200\016\232\342\250\2244\001\021\216\302$\3430X\334\200Q\210"
+	.ascii	"\301\217\204D\244EKHDC\241\210\242qI\304\006$\244\245\341\220"
+	.ascii	"8D\217\300\224\005\2411\257@,\036\035\211C\324D0E\302\307\324"
+	.ascii	"\230\224&\345\242"
+	.string	"\241\320\204\006\022\303T\211\310\363#\241`\2124BZ\\:\006S\023:?\0222\022\236\b\016K\030\022u\216)\tc\221h\034\246F\234\364(,z\3408\024\026S\310I\2018JK*\020\211H>%\244I\302#\207#\320\210\202Q\210\204$L\312\"\034S\022\030~$4$\n\215\305\364\304\220H\0044*\031\211\030\022\223\222\210D\0020\246i\321(-\002\022\217\300\242\"\221H\004$\221B\t\032~$t\302\006L !\342\230\032\025\203G\rT \"\"\215\220\026\211#\364\374H\250H\250$\342xd$D2\001T\224\036\203'\204G\"\t\030\203\036H\213\210IEa\320'\205\022q\004\236\343\217\204\224\226\210E#`1=\246\"\006@4\\\242@\316\320\204=\215@#%\235#ph\244t\016\215\224n\312\202\320\210\215\306\264XT\024DS(\021\211p\361\250t\277\223\242x4\n\215R\r"
+	.string	"3\024\245C#!R\020-J\215K85\242\017\036\203E\307\324\230\026\201FJB<\307 \222RR\272\201cjL5`\244t\001\020\211HD<\022\213J@\024%\2262\030K,]0\036\205%\200>%\202\303\t\030\225\2144"
+	.string	"/\340\024\211\307 \221\260hh\202Q\251\204\f \b\245I\302\r\2200\201\023H\244P\202\016\007\214JF\277\0344=\006\213\224\226\200$R(\001\007\347\030$\001COZ\f\256PT\fV`\303\017\205\320DZL\241\347\027\275\327\033r\t\"8G\341\320\204_Rz4\246 qA\007\005\021\251\004\007|\216Eb\nF%#\324\370\013\036\203$\344\214\020:\026\203JB\3014\351\002\031xF\b\001\223\226\214*\020\245GD\027t\206\204\222\226.p\302\310sD9\02022\242\360\353@(M\n\026M"
+	.string	"\215JF9\371\003\241\024Ga1\250\244s\002\204\216\251\321\204\t\242>\025 \224\024,\006\225P\264\230\036\207KD\242\013GG\243a\212\004,\n\022\221R\004\225\200=%\202@\025\210\200\247\321\030D\"\002f%\240\222P\005#PG)=\032\201\347\205\343p\2118B\021\321\304\320\004\013\210\303\fE\302\023\306\236!\211\024J\340\001\222H\241\204\037\316\n\351\020\270\363#!\242\341RQ\004\221\211 \034\024\351P\037s\t Z$\004\032\031\223\200h1x4\302\005\243\222\02105\026\203J\300\017`\340\004\0218\320c,BJ\205&\200%\202E\243\234\343\261\230&-\031\207\304\021x\216\214\226\210\305\243\243\321\030L!E*\032\006+`T2\322`D<\341\230\252@\024L\301\250d\244\223\002)\240!K`\002(\\ M\n\026)\260Bz\001\"a1\035\246F\372\036$"
+	.string	"\001\t"
+	.ascii	"\001\005z\020\0300\202\001#\362A`\300\320\020\003\0220\244\237"
+	.ascii	"\200\241\353\201\220"
+	.ascii	"\321PX<\032\365\021h\344\3001\003QhA\212\3421MJ\221\322\243\005"
+	.ascii	"\031T0\006Q\030\022\205G\242\341\222\t\235\024h\302\006%c\222"
+	.ascii	"Q\311\b\003\020\005\261\204\nDA\244\022\033\216\250\021h\f\226"
+	.ascii	" \201\202\210Tb)\307hT2\312I\201)\030\225\214v\212i\221\360\004"
+	.ascii	"\261\250\244S NZDD\301\030,a\324)\260\307HhbH\034\201x\\\n\342"
+	.ascii	"\244@\t\030\225\214v\212\226\202\"\020\217KA}\374\221\220\bc"
+	.ascii	"1=!,\026u(\036SHO\bS\242T\003@*\020\005K !\005G@Q\3041\002u:"
+	.ascii	"p,\022S@\n\n\213\251\361B\212T\"\270\201\023\271\230\nM\b\217"
+	.ascii	"\303\264H\210s\004\246ED\024\216E\242\022NZDL\302G \006\216E"
+	.ascii	"\242\322\216qH\024\036\225\210hz\fj\240h)XB\247,\bI\244,\bI\350"
+	.ascii	"\243.\352\024\005\323\n \t\203\033(\246&L,\211\200\342\250sT"
+	.ascii	"\341\230t\217\302\241\tF%\243\035\024i\321Px\242(\261t\215\300"
+	.ascii	"`\232t\201\035}\022\001w\214JF\277\023EZ44!=\006\213EK\301\022"
+	.ascii	";\306\"\261XL\263\361\270DL\223\204G\215\224s4\006O"
+	.string	"8\032\203H=<\306#0=\006\217F\235\002Q0*\031aH\217\301#\211\324(h4\246I:HD\242\b\300\323\b\f\036\203$\2200*\031a8\006I$-\r\363\361GG\244\3405\006\211\210'\030\225\214v\216A\244;$\"\335#$\244\013$\221B\t:Ei\252D\"'5\026\227\210#\024\r\227\210E#\035%b\321\021&\022\036\213\351\t\fFC\"\322/\210\244\213\204D\243\222\020\t)\315\200dL\002\246EKG\341\021)\250\203\024<\016\211,\b\213\304#\237#$$#Q)\247I\302\243\322RF\n\n\217\303\264\230\2320!,\362A!4\001<\032\213B\023@\342\021C\276\300\2011-b\242\3248\004\246I\302\343O\2054]\001\247J)\216@\024B\023\332\270t\f\036\215@\024B\0238(R\344\242\016\200\032P\244Hq\024\022\021\221\322\023@\026\200&R\242\264'\005\f\220"
+	.string	"\034\022\205G\241\221\250\244cL\213\327\230\036\205HH\3511h\304\031\022\205\307%$\242Q_8:\026\211\303\337\321\030L\207+\020\213\200E\351P\027u\240\2138"
+	.string	"\032\r\205E\301\364\b'\005Q\260\270DD\024\004\026\245\251\222\221\247(\035\"\245'2\017\020x\"8\004\242(\261\264\341\032NTJ\213\"\216DbQD\016jL5PT:\207GD\267Hx\302\210\215FA$\023g\212\243\020)\270d\002\2248$\272'R\244\024\243IB\026\202\030)\035\016\203GD\350\021\310A\007i\222\360\210\217FHZ\032\236F\243 \022\005\220\202%\210HF9G`\002\206\216C\341\222\346\240(=QL\215i\361G41\024\2360\346#\020\204\343P\270\204\032\323c\212\022g1xD\204\377AQ\211\242\005(@\001\251P\317\027\260\200\0214\340\300\005J\320DBF%#\021D\241\210\2410\230$\202\250h\024!\344\363S\215\n,\230\300(\337\360`\321\261\206&\354\314C\341\336\242\310"
+	.ascii	"R\245\206\253H\016\375\343\\\023\305\206\205\235\365\201F\241"
+	.ascii	"\2119\273\262\230\231\243\005\365\206\306\003]\201\343\246\314"
+	.ascii	"H\337\016tk\246*\264\034\026\017\231"
+	.string	"\371\322`_Z\30730\355\335\2647\027\215\017A\232h\224y[\353J\353\3709\370@\347\b\222\345\245M\016\215\343\354[aV\344Ta\201\334Q1\243o`\345/\253\210\035\023\213\337AN\377\332+\263\271B\234\264T\3308\357\270v\250\260\353B\251\350@!\331\372\252\201\312\345\240A\303\246\306\225o\340\340(\223EI\343L\212\200\027\205\303n\325,\031\206\n7n3N\251\235$\232.2\031g\025\333\365\345\312Z\214\214W\305\212\023&\026\017a\3210\264\226\206qr\251;\271\267\326\276`hL\215\221uh\2425\226\325W:\353\032\353L\215\025\264\327S\353\006=2\334\254\by\201\361~e\356\226zVU/)C\347\242\nIO\230.\034Q\311SF\022o\316\215\305M\315=\254)7\034-> sRyE\324)\2263g\327d\342\002\215\343\300N)\325\002M\323zS\256\364X\234\\\226\304"
+	.ascii	"\373\262X?\335\025\364\365\365\365\355\355\315\244\237\254\206"
+	.ascii	"\322+\256\237\336\203\206!\203b\312*P\257\332D\204-\314\351\264"
+	.ascii	"\303YV\275X\323\204\205\331\306\350\3611\241;x\224\344\035\211"
+	.ascii	"\241\221{rqD\212\350mFw\244oG\337\351\324\202\016*4,\036ZC\363"
+	.ascii	"\3207h\036\312\207\3520\202\356\035\345\333Z\241|rC\203\310\022"
+	.ascii	"&\213\3216\326\r\333\024\013\213\337!M\243z\035\210\350\037e"
+	.ascii	"s>\305@F\331\201\2569k\216\031\211\241&\215\026S\017\310\231"
+	.ascii	"\243i~\024\017E\203\221A\252,-\266Z\365'\013\200\314\320\321"
+	.ascii	"3(\2223s\273i\006S\321\233\2416\346\250\231\037%\203\226\311"
+	.ascii	"qf\313\027\026\333d\375\311\001\250>\031\255\033::\346\274\273"
+	.ascii	"CS\327\002z\027F\306\2204h\230\243w\377=C\305T5,8\252LY\\\273"
+	.ascii	"\352OF\301\f\035\r\223\343&\307\027f\261\017j\207~\311Qc\232"
+	.ascii	"\250@\273\034\375\362\243u\250\027TE^\263\317b\013U\177\362\006"
+	.ascii	"\325'\333\253\241\243]\322\262Dq\342B\327c\345v\007d\313Q\272"
+	.ascii	"\252F\002\013P85\365Y<4ttK=\342&\255\212\305\006\36017\227oT"
+	.ascii	"\265M\345\2013`\222Z\006\222-I,~\007*m\200,+VP\27137j\217\315"
+	.ascii	"\n\313Q9/T_\\\026\243W\262\227\023\2328\031m\366\316\334\211"
+	.ascii	"Y\374\016H\375\341\f\372\004}\202R\221C\202I\356\\\255\001\001"
+	.ascii	"C\247\034\245\242\"\007\223\313bTJ\366\n\003\213kZ\214F9\201"
+	.ascii	"\314\231\251a1\n\345dr\252Cr\345d\342\2112\347UfF\203\330\361"
+	.ascii	"\366\206\306\215\250{E\222/2\3155TC`\240pG\343*\334\325\025\265"
+	.ascii	"\034^4\210\027K\226\240n@]\3103\037\316l\210e\345\375\244l\244"
+	.ascii	"\311@\231\034u\323\301Q\347\343+N\203`R\242\004\305\002\322\373"
+	.ascii	"lM\256\271\263D\314\251\312\342c\240\246\r0fm\rER\325\346\r\331"
+	.ascii	"5\302\302\256\006\333Q$;j\220\320\241\031\321!`\234"
+	.string	"\375ghZU\333T\032\216 \305\002\206}\250\363\301\223Z@\254\3048\212\344\024dF\241\241!J\322\001\223\025@@@H(\022\013\226U\366\023\200\003L\254\204\271\252eL1\231\021\221$I\n\033k\254\2001v\274f\0047\013p\026\320\235Q\252\254}v%\252Yu\351F\373|\243|\251b!\364\375 #\305\004\021?Q,\0307\220T\376\301\315\207\205\327\246\266F\003\260\237>\212\222\324_\253\202:f\251\365\333\305\240\221\2527\016\220x\310\004\006<\256\265\020%\0046\275\020\304\373K-\025a)\343\265_\227Y\205\371\370\030\2065\212\271`P\036\302`g/x\362q\305\264\037\327\246\344\f\004\025\320\035\031kf'\f\316\021C\226\206\fU\370>\306\"\360NI\022\220\323~&in\033\224\023j\324c\266\352\336\241\013\b\020S\242\323\202\245#\037\033Q\2511\204Otr09v\004\001B="
+	.string	"\333\240Q\037?\270"
+	.ascii	"\311\332u\3310"
+	.string	"\345w\017[\255K<\320\b\300\b\004Jqa-*\312\217\300\366\257\243\347\025\305\035\306\365\346\365L\255\224\326\002wG\226\001\306\314O\214\252\321\206\320\b\370B\005\222\231\371U\342\353\016\213\351\026Bi\001/\270;N\356\220\343\200_x\004\345\236\277\320!\324W\347j\336\201\243r\001\250\260\030!\204`\211\302j\332Up\371\203j\200\352-|\267N0\035\344\2250\265Z4\363\r\0045;t\001\362$\310*U`"
+	.string	"\307\322\223\207\324\207\024\274\226n\255\002\340\\\267\336\002\036:\271\345\253lt\177t\227L!q\357^\304\322\233\247\375\311\267\234\nF'9\0052\021\3759\205\301\037\222\2410\204\346\365+\0379h\007\n>b\364S\315\003(T\223]\230\357\307C\021}g\242\342\003\240\334$\232U\314\370\005\007\376\307\361B\361\320\200A\252\036\023\212\375\361\004\232\253,d\205\207\264\323\232\261iS\002"
+	.string	"\"\207\344\347#~d$OR\345\304\001\311H\214\224\203\245X\256!\\\345\345\201\213'\354\340\032*\253\200\312*\232~\301\033X\314\323\350\230\251{\262R\3332\220b&\222\331P7:\013\270%rF=\275\f\360\364(\314$\006/\b\317\371B\371\330\310$\224eKs\025l%\357*G"
+	.string	"\202\225\210v_\323\303\327\243\312\007FlSv\007\244\004\242\034h\360\271"
+	.string	"\366\331"
+	.string	"\271\340\224y\\\274W\005j/\311N\004\272\030\247\326>\364\036W\353\367\370l8C\253V>y\257K\253\363\230j\236\032h8\370[\236\234\351'\013\b\035\3155\351\324\255\t>_$\223\245\351\365\240\343Nl\006y\376\244-PL\371V\247\347.Pe\261\354\215\207\013IZ\203\027\317,9\273u\326H\376\253F\364`\t\244\316\001\250E\255)\370\265\b\004Z4V5\013!\212\034<\324\\\314\036\366h\002\332\372\242\303N\247\374\371\271\035&u\016\367\311c\232\250\334\037\346\002\037\236PjL\034\360Rc\002\347\210\252\253r\266;@\315r"
+	.string	"\205\300\357y\260\307L zH\n\274\205\n\347\255H\300\003\336\341\317\037X\217\005+\246~\033\004\306\204G\241t\321\3327B\363aF\310\374\201\273\324[}\275\020\331B.\221#\037l\036\256"
+	.string	"K\237D\307\020G\216\246\265'G\002d>S\020\332\267re\027\300\254%\262\302\313\303x\356!\033FF\240q \267uv2k\301\021\274\003\314*\261\343q\260\013%\34028\325<\330\002oN\\F9l\313\227]<\207\353\376\330h\240\223\224\337\"o\233\247\224\020\002\300\024\370'\344{jb\307\231\"\217\350g\236\207G\253x\255\352Qp\314\303\273\226\266\006\361O\270o\266L\215F\347^\352\023\210\3313}\341\225-j\020[\371EOG\225*7\033\3067\262Gk\315\224/]\374Jz\236Oc?\372\264\231X\0064P?\3170\203\n\311g\232\347I\013\223\331\221\352+\021="
+	.ascii	"\007\306s<\rP\032\334-\032\310L\366\330\240\261\3428M)vv\371"
+	.ascii	"\255)\tR\302\241f\256T`\337\306\0138s\316\304\305h&\376\273\211"
+	.ascii	"\347\322\240\007\233\301\022q[\337\271\204\233 ;\307fav\347u"
+	.ascii	"x^\263\350\230\253x@\2715\334 \024w\250\241\314\266Hq\325\300"
+	.ascii	"\347H\305\243t\230+'m\002\245\273p\272\271'.c\225\342oc\243i"
+	.ascii	"<\262\261\203\030P\002\262\354w\334\225\213P{\027\023\234\353"
+	.ascii	"\353%\216\274\211;XyK\320\0276\345d1U\225\212^\001\233\003\256"
+	.ascii	"\306\340\301\225P\277\302B\256j?\347Q\377gg\330\006\246\376."
+	.ascii	"\366\275I\312\3226\002`,\r?I\r\276\321\242l0\004\300(\263Q\250"
+	.ascii	"\207\241R\271\013>#\227\036\217\223|'\373\226\344\361@HNe\302"
+	.string	"\275\254zNh*\305\352/\355,\201\025t]\375\220\274e p6Z\023q\222\256\236|\314q>q\262\272\3555?I\315lTS#o\367\310\310\326\001k\315\326+\206\307\2011\322\t\206\026\033\254\02782\373|\231\324\225\003\326\212\006\274\033P$\363\253s\251\345\316\303KS\254\227\261y\232\2450\367|1\310\255\275\016w\242\020N\264\250\221\367\027\356\021\223\n\220\213\360\021\367\333?\334cJ\032\351f6*}\227\216\356\257\030\326\200\324_a Q\250\223\315=\263\254Sc\027\217\373 ^h\037\360\020\354\t8\270\377t\246\013\371=q\2109A[\350\210\223\033\264\311[\360\037\270\310$*\"\252\217\177a\257^\315\212\347\253\204\021\r\252X\262q\\&q\245\346\354\371\364=\2538}\271\354T\006-.\227\206\360\224\302Y\241\340\251\233f%\t\321\374\t\204\223W\020S\274\341g\227Pj\257\334\320\313"
+	.string	"Y\260\244\3131\223\236#\307\264\356\252\376T\025\021\300\272\201dg\372\226e\016x\334\217$\036 4Cy\177\273{\004\326-L\026r\371\030\371\215\202\006\216\345$)\243\016\006}6\244\364,[$\306\0233\3243\342%"
+	.string	";\016/\203?\304\324\027\304[\263\021{\331?\024\372\372DZ]\325\177W\245\022\006l\325S\206\r\336\0013\365\017\341h\226W+\2223O\245\315\324\371\350\355\250\366\215BC.\013n\360\353\347\255\237\023\026\027&UX\236\207tg\334\210\035\013\204\244\300\332\331h\034\017\277\232\321\305yz\366\205\250\374\021\235m@mMZ\310{\226\230\"\343]B`n\001\023T\220eG\266{\224\263\216\204=r\330=\214R\024\212\366\331\222\t\025\314\351\262!\241\2039@L^\017\371\224}\022\326\232\006\027\241\f9{\030\301\330\232PcW\220\374\016\224\251\363\350\022n\301\377\030\334\2755\217\2654\323\343\271B\265\261ok\364\256\265\031\nvEgxYd\003\007\201g(\242i\205\\|\366\354\307\350\341\370o\265k\004\21130!R\022\004\371\247/D.\226D\".\217c"
+	.string	"z0n\036V1\323th\3714\252@*hq/\004\215\261\266\360\031_\326\315\0347\306\361\377E\336\326\003\344\306\371\200\267Lz\272\025\032\243\202A\005\372d\023$\337\033j)\222\276\233\216\260D\"\377\270\3026\352\274\314Y=\273\221Kr[\367\\\261\331A\224\253("
+	.string	"\fJ\t@\234\023K\027zy\244\301\032\025U{-\212\270\311\240F\n\34793g"
+	.string	"\361\277\354\0246\317\326\235M\271\250h\272\0210`\327\237\206\214>\0318\270r\202uZL\226 Y\323\244\373\231\030k\365\3135\205\022\231\224D\020\271\261n\216>-\b<\316\355H\226\b\360\236 q\344h\222\344k:\207\313c\230\321\004H\242d\001]\255|\313\370\213b\013\321\\\221\316v\034\365\215\t\021\302,\300\303\177+\334\236}k\271\2124\312\036\002\260\005\031\256\324\355\333i\022"
+	.ascii	"\b\261X'\321a[\002\266@\335(\207X(\321\235\022\363\356\220i\223"
+	.ascii	"j\207\300\211\313\200,\033\206\300\301\313\3728K1\0220\260\032"
+	.ascii	"1&\026\347\265G>\357o\034\363\262_\0365\234\236\032Q\r\350\270"
+	.ascii	"+\220\225\002\233\226c\315\341\255\240\372\024n>\3652Ep<\324"
+	.ascii	"\351\035d\260\027X2\376\354>)\007\357+\214\327\022!y\375R`+\326"
+	.ascii	"\211\243\271v\337\230\200\nU\177<Cy\202\334]u\006\251\3466\224"
+	.ascii	"\f\026p\227\256\230\267=\254\212\364\n%\245\217\3436\204\035"
+	.ascii	"u$;\226*O\t\030\234\243\332\264K\034\230\250WU"
+	.ascii	"{\255\246l|^\323\310\tJ\376\370\326=\325\021\356q\035F\354\343"
+	.ascii	"9\211\251\227\234\325e\206\233#\301\377\245\n'?\257K\017\362"
+	.ascii	"7\236\016"
+	.string	"\310\343J\334\t\260\376n\340\245_\004\246!\017\300\271\032cP\261&x\002#A\246\bP_\316\346\006B\374\236\322\302\0254\301\343\264\331<\025 V\343I\220\254\005\\A\240\004\323\r\001\005\030\263\216\300\204\362\353f&13@N|2\2670s|!j+\242\351e\251pO\332d\246\250\001S\337\r\376\352\252\334\035\037\220\335\363\266uMq0\004\355\212\201\315Y9\364k \177\034\353\367\203\331\275\232A\\\356a\003\021\031\247\331\233\031z0\27122\273B\006l\004\314\364\336\344s\207\325IjPJ\034v\343\251V]\214\200\302\221\f#\201\007m\325\3718\307L\331\357\243\232z\035\331\016\320\314g\022\f\303?\240U\200\310\335\013W\003\322uS\bI\3617\204I|\021\t\031C,\202\365\310\013\275\034oF1(\376\227\032\376C\tfV^\250\251\357B:\220\227\300\026\302R\226``\2268;\272"
+	.string	"\0211\240,"
+	.string	"\3011'2\177:\355#9\265\230\206U\303\265\227\337\b\302,\372\247\035\372\341\321GB\251\263x\371\273\367~`\214I\035\345Y;\3416mA\025>\r\226\007\270\037\344\r\262|\203\331fk\351'\352\251\260S\236\232\332\230\005\215X\002\030\0204\006\254\222\256\205\374'n\021\035\036I"
+	.string	"\340o\264\204\316\242\313\307\247\300\367w\243\376\302\305\004\344\307*4\026\f\221\330\276\255g>\217\006\005\203\202\324\243\217+th\360"
+	.ascii	"\272\322\376\316\312\224\215\236\tP\034\344;\220\250`\037\275"
+	.ascii	"5g\322\3557\346\346\343>\005\375\230gQC\247\232\274\016\204\307"
+	.ascii	"\f\314\200\227\347\217y\257\262PF\221,\341i\305X\211\253*\036"
+	.ascii	"\264\005\213{\356\300`="
+	.string	"n0\232\252\314\351\203<\207\215j\226!~\263%9\366Q\206\276\377 \fI\355\b\370MTK\201\177%4\2559\201\240{\232\3770! \311\237\200\346\241\327\024\f{\240\333\213\n\032uY+\2765\211\315\334f\354\346\346.PX\241\373\353\027\226\021\017\031]!\232\007T\210\004\204 \250\335].r\374\r\317\365}\250\200\212\202\246J\033\2629\247\355\220M\177\203\3073\0072\204\211\363\232\315\216\316CP\321\204 x\3020\272k\017U\305\3772r.\242\332\277\265 \030=\232\241F6\022q\024\t\307\263{\027\357L=\267\0258\305\255\376\032\365?\226\034m\335\253\270\302\343]qc\334\211|e\324\225\254\234\275d\236K\"\337\027\306v\264\261\277i>\021\362=,\332a\316\227\013\3661\344O\004\251\276S\373\273x\2772~\025J:v\252\253E\343\354\210\265\375pw\317#po\357\343\235\304O\320\347"
+	.ascii	"\250\036\345\276x\342\220\250\340\273z\353\306\336D\363]Q\316"
+	.ascii	"\303\312\376&\320=\255\033\327\006\230\311\036o\267\261\224\313"
+	.ascii	"3=R\006Rqz|\237\255\370\342\201\377w6o\344\276\304\2063\363<"
+	.ascii	"\306\301Ch\360!6m(q\256\017\236Wa\347ow|\017\341\366S\247\201"
+	.ascii	"\307L\371o\254mq\364\323\341\231=L\332\\\306\035^t\250\0167\363"
+	.ascii	"\316\307\277\350\335\223\253\254\211\356dD\332\027\022x\245~"
+	.ascii	"\222\217)\311_\210<ws\241\264\341\002\277\372\0026_\304\315T"
+	.ascii	"\004/+\334y\275\345@\377\3272^\361\3302\364\2535.m\021\377\340"
+	.ascii	"c\301Z\037\210\220\005C^\016\213vX\007-fU\264\263\223\217\202"
+	.ascii	"\335\311\321\f\025\372\222\351\315<[\343\241\357\257\3776\373"
+	.ascii	"\002:K\322\316|\306\007\022=!\327.\224\277\342\265\024\263:Z"
+	.ascii	"7\004\034\007\331\376\027\315\003b\033\"]\311\303_\231\345=\354"
+	.ascii	"/\331|\311\352]\017\204u\333\200\325\356<\254\364\337\215\276"
+	.ascii	"\020\007\3208F\342\370\316\371Y\255m&\235\322\r\233\271\221\256"
+	.ascii	"\370UC\354\246_\260\365\352|v\355{\302\314g7\177\202\333\256"
+	.ascii	"i\335}\347]\375\311_#\262\360\343\304\346(s\232P\263\333Z\303"
+	.ascii	"\301LM\366\275\336\327\310}\013;\321t\332\335\f\335,\003\220"
+	.ascii	"\237\267\377\256.\367@i\005\003.]p\304K'\344\337\343\241+"
+	.text
+	.section	.gnu.lto_.symtab.b2dec28079bc0e17,"e",@progbits
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b2dec28079bc0e17,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
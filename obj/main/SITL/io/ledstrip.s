@@ -0,0 +1,6948 @@
+	.file	"ledstrip.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	ledstrip.c.a9f39bea
+	.weak	ledstrip.c.a9f39bea
+ledstrip.c.a9f39bea:
+	.long	0x9e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3
+	.long	.LASF1097
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1084
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1085
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1086
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1087
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1088
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1089
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1090
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4c
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1091
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1092
+	.uleb128 0x2
+	.long	.LASF1094
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x61
+	.uleb128 0x5
+	.long	.LASF1098
+	.byte	0x3
+	.byte	0xa1
+	.byte	0xa
+	.long	0x7b
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1095
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 4 "./src/main/io/ledstrip.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF455
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF528
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF546
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF612
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF648
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF528
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF676
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF677
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF455
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF737
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF753
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF754
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF569
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF755
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF756
+	.file 30 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF757
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF774
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF787
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF795
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF796
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF813
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF814
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF815
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF827
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF834
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF835
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF839
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x30
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.file 51 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF844
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF907
+	.byte	0x4
+	.file 53 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF909
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF910
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 57 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 58 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3a
+	.file 59 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 60 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF466
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF545
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF566
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF647
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF736
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF773
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF786
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF808
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF812
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF830
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF838
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF566
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF843
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1028
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1035
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1052
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1099
+	.long	.LASF1100
+	.long	.LASF1101
+	.long	.LASF1102
+	.long	.LASF1103
+	.long	.LASF1104
+	.long	.LASF1105
+	.long	.LASF1106
+	.long	.LASF1107
+	.long	.LASF1108
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1109
+	.byte	0x6
+	.long	.LASF1110
+	.byte	0x6
+	.long	.LASF1111
+	.byte	0x2
+	.long	.LASF1112
+	.byte	0x1
+	.long	.LASF1113
+	.byte	0x9
+	.long	.LASF1114
+	.byte	0xa
+	.long	.LASF1115
+	.byte	0x9
+	.long	.LASF1116
+	.byte	0x6
+	.long	.LASF1117
+	.byte	0x9
+	.long	.LASF1118
+	.byte	0x9
+	.long	.LASF1119
+	.byte	0x6
+	.long	.LASF1120
+	.byte	0x6
+	.long	.LASF1121
+	.byte	0x8
+	.long	.LASF1122
+	.byte	0x6
+	.long	.LASF1123
+	.byte	0x7
+	.long	.LASF1124
+	.byte	0x7
+	.long	.LASF1125
+	.byte	0xa
+	.long	.LASF1126
+	.byte	0x6
+	.long	.LASF1127
+	.byte	0x6
+	.long	.LASF1128
+	.byte	0x6
+	.long	.LASF1129
+	.byte	0x6
+	.long	.LASF1109
+	.byte	0x8
+	.long	.LASF1130
+	.byte	0x6
+	.long	.LASF1131
+	.byte	0x6
+	.long	.LASF1132
+	.byte	0x5
+	.long	.LASF1133
+	.byte	0x5
+	.long	.LASF1134
+	.byte	0x5
+	.long	.LASF1135
+	.byte	0x5
+	.long	.LASF1136
+	.byte	0x6
+	.long	.LASF1137
+	.byte	0x9
+	.long	.LASF1137
+	.byte	0x6
+	.long	.LASF1138
+	.byte	0x6
+	.long	.LASF1139
+	.byte	0x6
+	.long	.LASF1140
+	.byte	0x6
+	.long	.LASF1141
+	.byte	0x8
+	.long	.LASF1141
+	.byte	0x6
+	.long	.LASF1142
+	.byte	0x5
+	.long	.LASF1143
+	.byte	0x5
+	.long	.LASF1144
+	.byte	0x5
+	.long	.LASF1145
+	.byte	0x5
+	.long	.LASF1146
+	.byte	0x6
+	.long	.LASF1147
+	.byte	0x6
+	.long	.LASF1148
+	.byte	0x6
+	.long	.LASF1149
+	.byte	0x6
+	.long	.LASF1150
+	.byte	0x6
+	.long	.LASF1151
+	.byte	0x6
+	.long	.LASF1152
+	.byte	0x9
+	.long	.LASF1153
+	.byte	0x6
+	.long	.LASF1154
+	.byte	0x6
+	.long	.LASF1155
+	.byte	0xa
+	.long	.LASF1155
+	.byte	0x9
+	.long	.LASF1156
+	.byte	0x6
+	.long	.LASF1157
+	.byte	0x9
+	.long	.LASF1158
+	.byte	0x5
+	.long	.LASF1159
+	.byte	0x5
+	.long	.LASF1160
+	.byte	0x9
+	.long	.LASF1161
+	.byte	0xa
+	.long	.LASF1162
+	.byte	0x4
+	.long	.LASF1163
+	.byte	0x3
+	.long	.LASF1164
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF852:
+	.string	"INT32_MAX (2147483647)"
+.LASF826:
+	.string	"__ONCE_ALIGNMENT "
+.LASF957:
+	.string	"TELEMETRY_CRSF "
+.LASF692:
+	.string	"__STD_TYPE typedef"
+.LASF812:
+	.string	"__fsfilcnt_t_defined "
+.LASF453:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF643:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF948:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF651:
+	.string	"__HAVE_FLOAT64 1"
+.LASF739:
+	.string	"__ino_t_defined "
+.LASF656:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF778:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF663:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF553:
+	.string	"__stub_sigreturn "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF515:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF781:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF529:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF752:
+	.string	"__clockid_t_defined 1"
+.LASF490:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF898:
+	.string	"INT16_C(c) c"
+.LASF1089:
+	.string	"signed char"
+.LASF461:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF790:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF983:
+	.string	"U_ID_0 0"
+.LASF1077:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF888:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1004:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1067:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF615:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF397:
+	.string	"true 1"
+.LASF624:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF867:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF504:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF800:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF737:
+	.string	"__STD_TYPE"
+.LASF788:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF793:
+	.string	"____sigset_t_defined "
+.LASF477:
+	.string	"__P(args) args"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF756:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF821:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF573:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF977:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF705:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF749:
+	.string	"__daddr_t_defined "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF980:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF943:
+	.string	"USE_SERIALRX_SUMD "
+.LASF608:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF972:
+	.string	"VTX_TRAMP "
+.LASF665:
+	.string	"__f64x(x) x ##f64x"
+.LASF803:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF642:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1011:
+	.string	"USE_UART8 "
+.LASF650:
+	.string	"__HAVE_FLOAT32 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF902:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF589:
+	.string	"__size_t "
+.LASF846:
+	.string	"INT8_MIN (-128)"
+.LASF731:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF689:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF465:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF877:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1095:
+	.string	"double"
+.LASF759:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF492:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF577:
+	.string	"_T_SIZE "
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF855:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF876:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF767:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF935:
+	.string	"USE_CLI_BATCH "
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF910:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF832:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF609:
+	.string	"NULL"
+.LASF984:
+	.string	"U_ID_1 1"
+.LASF735:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF971:
+	.string	"VTX_SMARTAUDIO "
+.LASF1026:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF893:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF549:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF828:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF714:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF639:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF965:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF514:
+	.string	"__always_inline"
+.LASF575:
+	.string	"_SYS_SIZE_T_H "
+.LASF940:
+	.string	"USE_SERIALRX_IBUS "
+.LASF758:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF463:
+	.string	"__GLIBC__ 2"
+.LASF925:
+	.string	"__va_list__ "
+.LASF657:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1084:
+	.string	"long int"
+.LASF455:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1034:
+	.string	"TELEMETRY_MAVLINK"
+.LASF772:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF792:
+	.string	"__sigset_t_defined 1"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF449:
+	.string	"__USE_XOPEN2K8 1"
+.LASF720:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1060:
+	.string	"_PTRDIFF_T_ "
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF964:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF734:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1015:
+	.string	"STACK_CHECK"
+.LASF761:
+	.string	"__PDP_ENDIAN 3412"
+.LASF719:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF883:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF713:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF712:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF511:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF512:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF584:
+	.string	"_SIZE_T_DECLARED "
+.LASF479:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF627:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1016:
+	.string	"USE_DASHBOARD"
+.LASF1029:
+	.string	"USE_SERIALRX_XBUS"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF956:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1022:
+	.string	"SERIAL_RX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF500:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF890:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF949:
+	.string	"TELEMETRY "
+.LASF981:
+	.string	"SKIP_IMU_CALC "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF661:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF493:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF674:
+	.string	"EXIT_SUCCESS 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF827:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF470:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF474:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF669:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF572:
+	.string	"__size_t__ "
+.LASF770:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF679:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF481:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1027:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF694:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF528:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF993:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF926:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF963:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF710:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1039:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1020:
+	.string	"USE_PPM"
+.LASF738:
+	.string	"__u_char_defined "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF583:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF586:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF437:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF478:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF652:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF868:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1002:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF585:
+	.string	"__DEFINED_size_t "
+.LASF799:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1051:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF951:
+	.string	"TELEMETRY_HOTT "
+.LASF819:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1079:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF801:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1006:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF746:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF847:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1019:
+	.string	"USE_VCP"
+.LASF807:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF522:
+	.string	"__restrict_arr __restrict"
+.LASF547:
+	.string	"__stub___compat_bdflush "
+.LASF581:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF942:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF721:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF424:
+	.string	"__USE_GNU"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF863:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF833:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF501:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF647:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF570:
+	.string	"__need_wchar_t "
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF978:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF552:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF569:
+	.string	"__need_size_t "
+.LASF1040:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF682:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF704:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF534:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF519:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF439:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF633:
+	.string	"__WCOREFLAG 0x80"
+.LASF907:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF487:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF736:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF619:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF987:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF671:
+	.string	"__lldiv_t_defined 1"
+.LASF517:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF995:
+	.string	"USE_FAKE_GYRO "
+.LASF446:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF874:
+	.string	"INT_FAST8_MAX (127)"
+.LASF862:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF892:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF996:
+	.string	"MAG "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF903:
+	.string	"UINT32_C(c) c ## U"
+.LASF638:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF882:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF853:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF667:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF666:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1082:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF632:
+	.string	"__W_CONTINUED 0xffff"
+.LASF872:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF464:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF939:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF802:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF698:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF930:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF1025:
+	.string	"USE_SERIALRX_SBUS"
+.LASF683:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF728:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF923:
+	.string	"_VA_LIST_DEFINED "
+.LASF796:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF941:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF822:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF932:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF486:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF730:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1070:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF751:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF915:
+	.string	"__GNUC_VA_LIST "
+.LASF396:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF598:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF824:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF672:
+	.string	"RAND_MAX 2147483647"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF879:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF928:
+	.string	"I2C1_OVERCLOCK true"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF499:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF880:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF779:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1035:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF610:
+	.string	"NULL ((void *)0)"
+.LASF985:
+	.string	"U_ID_2 2"
+.LASF994:
+	.string	"GYRO "
+.LASF509:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1030:
+	.string	"LED_STRIP"
+.LASF611:
+	.string	"__need_NULL"
+.LASF1061:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF675:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF905:
+	.string	"INTMAX_C(c) c ## L"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF450:
+	.string	"_ATFILE_SOURCE"
+.LASF688:
+	.string	"__SLONG32_TYPE int"
+.LASF895:
+	.string	"WINT_MIN (0u)"
+.LASF777:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF709:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF655:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF454:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF967:
+	.string	"USE_SENSOR_NAMES "
+.LASF798:
+	.string	"__NFDBITS"
+.LASF843:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF844:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF804:
+	.string	"NFDBITS __NFDBITS"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF640:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"WUNTRACED 2"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF886:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF711:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF677:
+	.string	"_BITS_TYPES_H 1"
+.LASF854:
+	.string	"UINT8_MAX (255)"
+.LASF820:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF891:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF901:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF440:
+	.string	"_POSIX_SOURCE"
+.LASF1081:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1093:
+	.string	"__uint32_t"
+.LASF438:
+	.string	"__USE_ISOC95 1"
+.LASF538:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF551:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF576:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF785:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1098:
+	.string	"SystemCoreClock"
+.LASF1075:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1068:
+	.string	"UNUSED(x) (void)(x)"
+.LASF491:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF797:
+	.string	"__suseconds_t_defined "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF473:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF571:
+	.string	"__need_NULL "
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF435:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF969:
+	.string	"VTX_COMMON "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF740:
+	.string	"__dev_t_defined "
+.LASF1053:
+	.string	"_STDDEF_H "
+.LASF471:
+	.string	"__LEAF , __leaf__"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF1052:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF966:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF503:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF715:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF693:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF783:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF912:
+	.string	"_STDARG_H "
+.LASF1012:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1062:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF841:
+	.string	"_BITS_WCHAR_H 1"
+.LASF668:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1057:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1033:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF982:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1074:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF729:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF916:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1073:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF931:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF637:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF594:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1021:
+	.string	"USE_PWM"
+.LASF531:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1071:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF834:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF590:
+	.string	"__need_size_t"
+.LASF579:
+	.string	"_SIZE_T_ "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF750:
+	.string	"__key_t_defined "
+.LASF1085:
+	.string	"long long int"
+.LASF620:
+	.string	"__WALL 0x40000000"
+.LASF591:
+	.string	"__wchar_t__ "
+.LASF540:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF545:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF934:
+	.string	"USE_SETTINGS_INDEX "
+.LASF606:
+	.string	"__DEFINED_wchar_t "
+.LASF1000:
+	.string	"USE_FLASHFS "
+.LASF840:
+	.string	"_STDINT_H 1"
+.LASF616:
+	.string	"WEXITED 4"
+.LASF660:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1046:
+	.string	"USE_SPI"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF885:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF526:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF596:
+	.string	"__WCHAR_T "
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1041:
+	.string	"VTX_COMMON"
+.LASF476:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF507:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF525:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF766:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF467:
+	.string	"__PMT"
+.LASF924:
+	.string	"_VA_LIST_T_H "
+.LASF829:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF782:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF646:
+	.string	"__f128(x) x ##f128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF626:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF873:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF451:
+	.string	"_ATFILE_SOURCE 1"
+.LASF684:
+	.string	"__SQUAD_TYPE long int"
+.LASF1028:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF896:
+	.string	"WINT_MAX (4294967295u)"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF771:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF542:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1055:
+	.string	"_ANSI_STDDEF_H "
+.LASF784:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1069:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF953:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF974:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF364:
+	.string	"__k8 1"
+.LASF537:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF629:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1088:
+	.string	"unsigned int"
+.LASF835:
+	.string	"__have_pthread_attr_t 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF468:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF946:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF421:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1054:
+	.string	"_STDDEF_H_ "
+.LASF605:
+	.string	"_WCHAR_T_DECLARED "
+.LASF952:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF448:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF722:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF718:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF681:
+	.string	"__U32_TYPE unsigned int"
+.LASF1058:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF498:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1056:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF502:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF837:
+	.string	"alloca"
+.LASF524:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF550:
+	.string	"__stub_gtty "
+.LASF592:
+	.string	"__WCHAR_T__ "
+.LASF865:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF858:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF604:
+	.string	"_GCC_WCHAR_T "
+.LASF695:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF961:
+	.string	"TELEMETRY_SRXL "
+.LASF513:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1031:
+	.string	"TELEMETRY_FRSKY"
+.LASF786:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF398:
+	.string	"false 0"
+.LASF747:
+	.string	"__id_t_defined "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF791:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF897:
+	.string	"INT8_C(c) c"
+.LASF743:
+	.string	"__nlink_t_defined "
+.LASF1064:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF687:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF733:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF462:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF697:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF992:
+	.string	"ACC "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF706:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF623:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF723:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF530:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF622:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF480:
+	.string	"__STRING(x) #x"
+.LASF1086:
+	.string	"unsigned char"
+.LASF1013:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF527:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF659:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF636:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF593:
+	.string	"_WCHAR_T "
+.LASF653:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF999:
+	.string	"USE_FAKE_BARO "
+.LASF909:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1063:
+	.string	"_GCC_PTRDIFF_T "
+.LASF976:
+	.string	"USE_NAV "
+.LASF787:
+	.string	"_SYS_SELECT_H 1"
+.LASF1091:
+	.string	"char"
+.LASF475:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF536:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF574:
+	.string	"_SIZE_T "
+.LASF601:
+	.string	"_WCHAR_T_H "
+.LASF1010:
+	.string	"USE_UART7 "
+.LASF1047:
+	.string	"LED_STRIP_TIMER 1"
+.LASF860:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF773:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF997:
+	.string	"USE_FAKE_MAG "
+.LASF1044:
+	.string	"VTX_TRAMP"
+.LASF495:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1014:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF857:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1087:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF578:
+	.string	"__SIZE_T "
+.LASF947:
+	.string	"BLACKBOX "
+.LASF757:
+	.string	"_ENDIAN_H 1"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF989:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1024:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF1097:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF634:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1038:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF774:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF482:
+	.string	"__BEGIN_DECLS "
+.LASF869:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF875:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF510:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF973:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF617:
+	.string	"WCONTINUED 8"
+.LASF447:
+	.string	"__USE_POSIX199506 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF794:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF845:
+	.string	"__intptr_t_defined "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF920:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1045:
+	.string	"USE_I2C"
+.LASF725:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1092:
+	.string	"long long unsigned int"
+.LASF998:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF658:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF582:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF748:
+	.string	"__ssize_t_defined "
+.LASF1076:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1059:
+	.string	"__PTRDIFF_T "
+.LASF621:
+	.string	"__WCLONE 0x80000000"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF866:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1083:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF789:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF754:
+	.string	"__timer_t_defined 1"
+.LASF443:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF628:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1042:
+	.string	"VTX_CONTROL"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF960:
+	.string	"TELEMETRY_MAVLINK "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF506:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF760:
+	.string	"__BIG_ENDIAN 4321"
+.LASF899:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF904:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1008:
+	.string	"USE_UART5 "
+.LASF831:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF919:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF612:
+	.string	"_STDLIB_H 1"
+.LASF1023:
+	.string	"USE_SERIALRX_CRSF"
+.LASF452:
+	.string	"__WORDSIZE 64"
+.LASF806:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF600:
+	.string	"_WCHAR_T_DEFINED "
+.LASF913:
+	.string	"_ANSI_STDARG_H_ "
+.LASF955:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF554:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF962:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF488:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1048:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1017:
+	.string	"TELEMETRY_LTM"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF690:
+	.string	"__S64_TYPE long int"
+.LASF541:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF775:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF580:
+	.string	"_BSD_SIZE_T_ "
+.LASF485:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF597:
+	.string	"_WCHAR_T_ "
+.LASF839:
+	.string	"__COMPAR_FN_T "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF815:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF595:
+	.string	"_T_WCHAR "
+.LASF680:
+	.string	"__S32_TYPE int"
+.LASF856:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF603:
+	.string	"__INT_WCHAR_T_H "
+.LASF936:
+	.string	"USE_PPM "
+.LASF1050:
+	.string	"DEFIO_NO_PORTS "
+.LASF894:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF908:
+	.string	"_STRING_H 1"
+.LASF814:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF900:
+	.string	"INT64_C(c) c ## L"
+.LASF808:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF457:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF641:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF906:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF745:
+	.string	"__off_t_defined "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF848:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF825:
+	.string	"__LOCK_ALIGNMENT "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF644:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF548:
+	.string	"__stub_chflags "
+.LASF988:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF795:
+	.string	"__timeval_defined 1"
+.LASF937:
+	.string	"USE_PWM "
+.LASF588:
+	.string	"_SIZET_ "
+.LASF724:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1009:
+	.string	"USE_UART6 "
+.LASF938:
+	.string	"SERIAL_RX "
+.LASF975:
+	.string	"GPS "
+.LASF744:
+	.string	"__uid_t_defined "
+.LASF929:
+	.string	"I2C2_OVERCLOCK true"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF769:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF717:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF535:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF648:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF518:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF990:
+	.string	"USE_FAKE_LED "
+.LASF842:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF662:
+	.string	"__f32(x) x ##f32"
+.LASF508:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1018:
+	.string	"USE_ADC"
+.LASF631:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF878:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF483:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF618:
+	.string	"WNOWAIT 0x01000000"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF979:
+	.string	"SIMULATOR_BUILD "
+.LASF456:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF849:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1090:
+	.string	"short int"
+.LASF466:
+	.string	"_SYS_CDEFS_H 1"
+.LASF918:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF762:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF521:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF810:
+	.string	"__blkcnt_t_defined "
+.LASF850:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF780:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF496:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF809:
+	.string	"__blksize_t_defined "
+.LASF958:
+	.string	"TELEMETRY_IBUS "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF533:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF685:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF654:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1066:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF613:
+	.string	"WNOHANG 1"
+.LASF544:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF676:
+	.string	"_SYS_TYPES_H 1"
+.LASF494:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF702:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1080:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF497:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF686:
+	.string	"__SWORD_TYPE long int"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF505:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF699:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF444:
+	.string	"__USE_POSIX 1"
+.LASF887:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF884:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF691:
+	.string	"__U64_TYPE unsigned long int"
+.LASF543:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF664:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF922:
+	.string	"_VA_LIST "
+.LASF933:
+	.string	"USE_CLI "
+.LASF970:
+	.string	"VTX_CONTROL "
+.LASF635:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF678:
+	.string	"__S16_TYPE short int"
+.LASF830:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF753:
+	.string	"__time_t_defined 1"
+.LASF968:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF823:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF776:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF917:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF516:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF602:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF768:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF954:
+	.string	"USE_SERVOS "
+.LASF532:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF716:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF520:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF707:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF649:
+	.string	"__HAVE_FLOAT16 0"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF670:
+	.string	"__ldiv_t_defined 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1005:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF607:
+	.string	"_BSD_WCHAR_T_"
+.LASF864:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF763:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1094:
+	.string	"uint32_t"
+.LASF436:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF696:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF859:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF871:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF484:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF765:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF441:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF445:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF708:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1049:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF630:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF539:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF851:
+	.string	"INT16_MAX (32767)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF700:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF742:
+	.string	"__mode_t_defined "
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF701:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1072:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF927:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1043:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF469:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF755:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1096:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF836:
+	.string	"_ALLOCA_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF945:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF458:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF727:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"__need___va_list"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF625:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF959:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF944:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1065:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF741:
+	.string	"__gid_t_defined "
+.LASF489:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF546:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF673:
+	.string	"EXIT_FAILURE 1"
+.LASF472:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1032:
+	.string	"TELEMETRY_HOTT"
+.LASF703:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1007:
+	.string	"USE_UART4 "
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF991:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF645:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1001:
+	.string	"USE_FAKE_FLASH "
+.LASF1078:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF813:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF764:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF599:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF950:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF911:
+	.string	"_STRINGS_H 1"
+.LASF805:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF838:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF881:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF732:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF889:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF921:
+	.string	"_VA_LIST_ "
+.LASF442:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF726:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1003:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF870:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF986:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF587:
+	.string	"_GCC_SIZE_T "
+.LASF523:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1037:
+	.string	"TELEMETRY_IBUS"
+.LASF1036:
+	.string	"TELEMETRY_CRSF"
+.LASF811:
+	.string	"__fsblkcnt_t_defined "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1143:
+	.string	"__sigset_t.h"
+.LASF1150:
+	.string	"struct_mutex.h"
+.LASF1118:
+	.string	"features-time64.h"
+.LASF1140:
+	.string	"uintn-identity.h"
+.LASF1159:
+	.string	"__locale_t.h"
+.LASF1162:
+	.string	"platform.h"
+.LASF1111:
+	.string	"target.h"
+.LASF1147:
+	.string	"thread-shared-types.h"
+.LASF1116:
+	.string	"libc-header-start.h"
+.LASF1114:
+	.string	"stdbool.h"
+.LASF1106:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1099:
+	.string	"src/main/io"
+.LASF0:
+	.string	"./src/main/io/ledstrip.c"
+.LASF1136:
+	.string	"stdint-intn.h"
+.LASF1163:
+	.string	"common_fc_pre.h"
+.LASF1105:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1108:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1123:
+	.string	"stubs.h"
+.LASF1158:
+	.string	"locale_t.h"
+.LASF1100:
+	.string	"src/main/target/SITL"
+.LASF1149:
+	.string	"atomic_wide_counter.h"
+.LASF1120:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1121:
+	.string	"cdefs.h"
+.LASF1104:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1122:
+	.string	"long-double.h"
+.LASF1115:
+	.string	"stdlib.h"
+.LASF1160:
+	.string	"strings.h"
+.LASF1112:
+	.string	"ledstrip.c"
+.LASF1109:
+	.string	"types.h"
+.LASF1137:
+	.string	"endian.h"
+.LASF1128:
+	.string	"floatn.h"
+.LASF1164:
+	.string	"common_fc_post.h"
+.LASF1132:
+	.string	"clock_t.h"
+.LASF1107:
+	.string	"/usr/include"
+.LASF1145:
+	.string	"struct_timespec.h"
+.LASF1134:
+	.string	"time_t.h"
+.LASF1142:
+	.string	"sigset_t.h"
+.LASF1129:
+	.string	"floatn-common.h"
+.LASF1130:
+	.string	"typesizes.h"
+.LASF1146:
+	.string	"pthreadtypes.h"
+.LASF1126:
+	.string	"waitflags.h"
+.LASF1133:
+	.string	"clockid_t.h"
+.LASF1117:
+	.string	"features.h"
+.LASF1131:
+	.string	"time64.h"
+.LASF1110:
+	.string	"stdint-uintn.h"
+.LASF1139:
+	.string	"byteswap.h"
+.LASF1101:
+	.string	"src/main/target"
+.LASF1135:
+	.string	"timer_t.h"
+.LASF1152:
+	.string	"alloca.h"
+.LASF1148:
+	.string	"pthreadtypes-arch.h"
+.LASF1127:
+	.string	"waitstatus.h"
+.LASF1161:
+	.string	"stdarg.h"
+.LASF1102:
+	.string	"src/main"
+.LASF1156:
+	.string	"wchar.h"
+.LASF1153:
+	.string	"stdlib-bsearch.h"
+.LASF1151:
+	.string	"struct_rwlock.h"
+.LASF1157:
+	.string	"string.h"
+.LASF1103:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1141:
+	.string	"select.h"
+.LASF1155:
+	.string	"stdint.h"
+.LASF1125:
+	.string	"stddef.h"
+.LASF1124:
+	.string	"stubs-64.h"
+.LASF1119:
+	.string	"wordsize.h"
+.LASF1144:
+	.string	"struct_timeval.h"
+.LASF1138:
+	.string	"endianness.h"
+.LASF1113:
+	.string	"stdc-predef.h"
+.LASF1154:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b0d94e92107a261e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\013"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b0d94e92107a261e,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\355\007"
+	.string	"D\016x"
+	.string	""
+	.string	""
+	.string	"~"
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	"\006\023\001\004\006\025\001 \b\022"
+	.string	"5\200\342\026"
+	.string	"\276"
+	.string	""
+	.string	"4\f\006(\001\017\006(\001"
+	.string	"\bI"
+	.string	"\004\002\310\235\363\346\t\017\300\200\200\304\200\300\204\t"
+	.string	"\275\001\274\001"
+	.string	"\302\001(\277\001\301\001\300\001\004\002\267\340\255\021+\330\220\200\370\325\206\337\2412\242\243\204\200\220\201\001\303\001\273\001\277\001"
+	.string	"\273\001"
+	.string	"4\207\001"
+	.string	"\017SystemCoreClock\030./src/main/io/ledstrip.c\bGNU C99"
+	.string	"\024.a9f39bea"
+	.string	"\buint32_t\013/root/repo"
+	.string	" target/SITL.h"
+	.string	"\b"
+	.ascii	"\257\354\361\004\363\366\346\002\341T\237\255v\023\265\b\234"
+	.ascii	"0\026\2241"
+	.text
+	.section	.gnu.lto_.symtab.b0d94e92107a261e,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b0d94e92107a261e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
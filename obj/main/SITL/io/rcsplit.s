@@ -0,0 +1,12035 @@
+	.file	"rcsplit.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/time.h"
+	.file 4 "./src/main/drivers/serial.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/io/serial.h"
+	.file 7 "./src/main/scheduler/scheduler.h"
+	.file 8 "./src/main/fc/rc_modes.h"
+	.file 9 "./src/main/io/rcsplit.h"
+	.file 10 "./src/main/io/rcsplit.c"
+	.file 11 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rcsplit.c.fcfd3eac
+	.weak	rcsplit.c.fcfd3eac
+rcsplit.c.fcfd3eac:
+	.long	0x9fa
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1840
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1607
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1608
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1609
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1610
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1611
+	.uleb128 0x4
+	.long	.LASF1613
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1612
+	.uleb128 0x4
+	.long	.LASF1614
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1615
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1616
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1617
+	.uleb128 0x4
+	.long	.LASF1618
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xd
+	.long	0x85
+	.uleb128 0x1b
+	.long	0x85
+	.uleb128 0x4
+	.long	.LASF1619
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF1620
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x1c
+	.long	.LASF1841
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xa7
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1621
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1622
+	.uleb128 0x5
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1623
+	.uleb128 0x4
+	.long	.LASF1624
+	.byte	0x3
+	.byte	0x21
+	.byte	0x12
+	.long	0xa7
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x20c
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1675
+	.long	0x30
+	.byte	0x17
+	.long	0x22d
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1675
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x3
+	.long	0x20c
+	.uleb128 0x13
+	.long	.LASF1676
+	.long	0x30
+	.byte	0x1d
+	.long	0x284
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1676
+	.byte	0x4
+	.byte	0x30
+	.byte	0x3
+	.long	0x239
+	.uleb128 0x4
+	.long	.LASF1687
+	.byte	0x4
+	.byte	0x32
+	.byte	0x10
+	.long	0x29c
+	.uleb128 0x5
+	.long	0x2a1
+	.uleb128 0x8
+	.long	0x2ac
+	.uleb128 0x3
+	.long	0x9b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1702
+	.byte	0x48
+	.byte	0x4
+	.byte	0x34
+	.byte	0x10
+	.long	0x370
+	.uleb128 0x2
+	.long	.LASF1688
+	.byte	0x4
+	.byte	0x36
+	.byte	0x24
+	.long	0x405
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0x4
+	.byte	0x38
+	.byte	0xd
+	.long	0x85
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0x4
+	.byte	0x39
+	.byte	0x10
+	.long	0x22d
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x13
+	.long	0x284
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1692
+	.byte	0x4
+	.byte	0x3c
+	.byte	0xe
+	.long	0xa7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0x4
+	.byte	0x3e
+	.byte	0xe
+	.long	0xa7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1694
+	.byte	0x4
+	.byte	0x3f
+	.byte	0xe
+	.long	0xa7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0x4
+	.byte	0x40
+	.byte	0x17
+	.long	0x40a
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x4
+	.byte	0x41
+	.byte	0x17
+	.long	0x40a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0x4
+	.byte	0x42
+	.byte	0xe
+	.long	0xa7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1698
+	.byte	0x4
+	.byte	0x43
+	.byte	0xe
+	.long	0xa7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x4
+	.byte	0x44
+	.byte	0xe
+	.long	0xa7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0x4
+	.byte	0x45
+	.byte	0xe
+	.long	0xa7
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1701
+	.byte	0x4
+	.byte	0x47
+	.byte	0x1e
+	.long	0x290
+	.byte	0x40
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1703
+	.byte	0x50
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x8
+	.long	0x400
+	.uleb128 0x2
+	.long	.LASF1704
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xc
+	.long	0x435
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1705
+	.byte	0x4
+	.byte	0x5f
+	.byte	0x10
+	.long	0x44e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1706
+	.byte	0x4
+	.byte	0x60
+	.byte	0x10
+	.long	0x44e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1707
+	.byte	0x4
+	.byte	0x62
+	.byte	0xf
+	.long	0x462
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1708
+	.byte	0x4
+	.byte	0x65
+	.byte	0xc
+	.long	0x477
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1709
+	.byte	0x4
+	.byte	0x67
+	.byte	0xb
+	.long	0x48b
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1710
+	.byte	0x4
+	.byte	0x69
+	.byte	0xc
+	.long	0x4a0
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0x4
+	.byte	0x6b
+	.byte	0xc
+	.long	0x4c0
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1712
+	.byte	0x4
+	.byte	0x6d
+	.byte	0xc
+	.long	0x4d0
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0x4
+	.byte	0x6e
+	.byte	0xc
+	.long	0x4d0
+	.byte	0x48
+	.byte	0
+	.uleb128 0xd
+	.long	0x370
+	.uleb128 0x5
+	.long	0x400
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x4
+	.long	.LASF1714
+	.byte	0x4
+	.byte	0x48
+	.byte	0x3
+	.long	0x2ac
+	.uleb128 0xd
+	.long	0x40f
+	.uleb128 0x8
+	.long	0x430
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x3
+	.long	0x85
+	.byte	0
+	.uleb128 0x5
+	.long	0x40f
+	.uleb128 0x5
+	.long	0x420
+	.uleb128 0xf
+	.long	0xa7
+	.long	0x449
+	.uleb128 0x3
+	.long	0x449
+	.byte	0
+	.uleb128 0x5
+	.long	0x41b
+	.uleb128 0x5
+	.long	0x43a
+	.uleb128 0xf
+	.long	0x85
+	.long	0x462
+	.uleb128 0x3
+	.long	0x430
+	.byte	0
+	.uleb128 0x5
+	.long	0x453
+	.uleb128 0x8
+	.long	0x477
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x3
+	.long	0xa7
+	.byte	0
+	.uleb128 0x5
+	.long	0x467
+	.uleb128 0xf
+	.long	0xd2
+	.long	0x48b
+	.uleb128 0x3
+	.long	0x449
+	.byte	0
+	.uleb128 0x5
+	.long	0x47c
+	.uleb128 0x8
+	.long	0x4a0
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x3
+	.long	0x22d
+	.byte	0
+	.uleb128 0x5
+	.long	0x490
+	.uleb128 0x8
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x3
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	0x4bf
+	.uleb128 0x1d
+	.uleb128 0x5
+	.long	0x4a5
+	.uleb128 0x8
+	.long	0x4d0
+	.uleb128 0x3
+	.long	0x430
+	.byte	0
+	.uleb128 0x5
+	.long	0x4c5
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x20
+	.long	0x542
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1724
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF1725
+	.value	0x400
+	.uleb128 0x9
+	.long	.LASF1726
+	.value	0x800
+	.uleb128 0x9
+	.long	.LASF1727
+	.value	0x1000
+	.uleb128 0x9
+	.long	.LASF1728
+	.value	0x2000
+	.uleb128 0x9
+	.long	.LASF1729
+	.value	0x4000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1730
+	.byte	0x6
+	.byte	0x30
+	.byte	0x3
+	.long	0x4d5
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x64
+	.byte	0x6
+	.byte	0x48
+	.long	0x5a3
+	.uleb128 0x1e
+	.long	.LASF1731
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1743
+	.byte	0x6
+	.byte	0x55
+	.byte	0x3
+	.long	0x54e
+	.uleb128 0xe
+	.long	.LASF1744
+	.byte	0xc
+	.byte	0x6
+	.byte	0x6c
+	.byte	0x10
+	.long	0x60b
+	.uleb128 0x2
+	.long	.LASF1745
+	.byte	0x6
+	.byte	0x6d
+	.byte	0xe
+	.long	0x9b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0x6
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x5a3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1746
+	.byte	0x6
+	.byte	0x6f
+	.byte	0xd
+	.long	0x85
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1747
+	.byte	0x6
+	.byte	0x70
+	.byte	0xd
+	.long	0x85
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1748
+	.byte	0x6
+	.byte	0x71
+	.byte	0xd
+	.long	0x85
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1749
+	.byte	0x6
+	.byte	0x72
+	.byte	0xd
+	.long	0x85
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1750
+	.byte	0x6
+	.byte	0x73
+	.byte	0x3
+	.long	0x5af
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x3e
+	.long	0x6a2
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1772
+	.byte	0x7
+	.byte	0x8f
+	.byte	0x3
+	.long	0x617
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.long	0x79f
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1792
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1802
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1803
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1804
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x25
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1811
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x3
+	.long	0x6ae
+	.uleb128 0x1f
+	.byte	0x1
+	.byte	0x9
+	.byte	0x18
+	.byte	0x9
+	.long	0x7c2
+	.uleb128 0x2
+	.long	.LASF1812
+	.byte	0x9
+	.byte	0x19
+	.byte	0x9
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1813
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x3
+	.long	0x7ab
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x1c
+	.long	0x7ed
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1817
+	.byte	0x9
+	.byte	0x20
+	.byte	0x3
+	.long	0x7ce
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x29
+	.long	0x824
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1823
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x3
+	.long	0x7f9
+	.uleb128 0x10
+	.long	.LASF1824
+	.byte	0x35
+	.byte	0x17
+	.long	0x7ed
+	.uleb128 0x10
+	.long	.LASF1825
+	.byte	0x36
+	.byte	0x16
+	.long	0x430
+	.uleb128 0x14
+	.long	0x7c2
+	.long	0x856
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1826
+	.byte	0x37
+	.byte	0x1d
+	.long	0x846
+	.uleb128 0x11
+	.long	0x83b
+	.byte	0x2a
+	.byte	0xf
+	.uleb128 0x11
+	.long	0x856
+	.byte	0x2b
+	.byte	0x16
+	.uleb128 0x11
+	.long	0x830
+	.byte	0x2c
+	.byte	0x10
+	.uleb128 0x16
+	.long	.LASF1827
+	.byte	0x4
+	.byte	0x74
+	.long	0x891
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x3
+	.long	0x891
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	0x91
+	.uleb128 0x12
+	.long	.LASF1829
+	.byte	0x8
+	.byte	0x66
+	.byte	0x5
+	.long	0xd2
+	.long	0x8ac
+	.uleb128 0x3
+	.long	0x79f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1828
+	.byte	0x7
+	.byte	0xc0
+	.long	0x8c2
+	.uleb128 0x3
+	.long	0x6a2
+	.uleb128 0x3
+	.long	0xd2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1830
+	.byte	0x6
+	.byte	0x95
+	.byte	0xf
+	.long	0x430
+	.long	0x8f1
+	.uleb128 0x3
+	.long	0x5a3
+	.uleb128 0x3
+	.long	0x542
+	.uleb128 0x3
+	.long	0x290
+	.uleb128 0x3
+	.long	0xa7
+	.uleb128 0x3
+	.long	0x22d
+	.uleb128 0x3
+	.long	0x284
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1831
+	.byte	0x6
+	.byte	0x89
+	.byte	0x15
+	.long	0x907
+	.long	0x907
+	.uleb128 0x3
+	.long	0x542
+	.byte	0
+	.uleb128 0x5
+	.long	0x60b
+	.uleb128 0x20
+	.long	.LASF1842
+	.byte	0xa
+	.byte	0x99
+	.byte	0x6
+	.long	0x924
+	.uleb128 0x17
+	.long	.LASF1836
+	.byte	0x99
+	.byte	0x1e
+	.long	0xd9
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1832
+	.byte	0xa
+	.byte	0x7d
+	.byte	0x5
+	.long	0xd2
+	.long	0x958
+	.uleb128 0xa
+	.long	.LASF1833
+	.byte	0x81
+	.byte	0x19
+	.long	0x907
+	.uleb128 0xb
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x8b
+	.byte	0x12
+	.long	0x79f
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF1834
+	.byte	0x8c
+	.byte	0x11
+	.long	0x85
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1843
+	.byte	0xa
+	.byte	0x54
+	.byte	0xd
+	.long	0x98a
+	.uleb128 0xb
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x5a
+	.byte	0x12
+	.long	0x79f
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF1834
+	.byte	0x5b
+	.byte	0x11
+	.long	0x85
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF1835
+	.byte	0x63
+	.byte	0x15
+	.long	0x85
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1838
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0x9b8
+	.uleb128 0x17
+	.long	.LASF1835
+	.byte	0x3e
+	.byte	0x35
+	.long	0x824
+	.uleb128 0xa
+	.long	.LASF1837
+	.byte	0x43
+	.byte	0xd
+	.long	0x9b8
+	.uleb128 0xc
+	.string	"crc"
+	.byte	0x44
+	.byte	0xd
+	.long	0x85
+	.byte	0
+	.uleb128 0x14
+	.long	0x85
+	.long	0x9c8
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1839
+	.byte	0xa
+	.byte	0x2e
+	.byte	0x10
+	.long	0x85
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x28
+	.long	0xcd
+	.uleb128 0x18
+	.string	"len"
+	.byte	0x35
+	.long	0x85
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x30
+	.byte	0xd
+	.long	0x85
+	.uleb128 0xc
+	.string	"crc"
+	.byte	0x31
+	.byte	0xd
+	.long	0x85
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 46
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 29 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF724
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF727
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF728
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF729
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF731
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF771
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF798
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF831
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF832
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2f
+	.file 48 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 49 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 50 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 51 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x33
+	.file 52 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 53 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 54 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 55 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1196
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.file 56 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 57 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 58 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 59 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1589
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.file 60 "./src/main/fc/fc_msp.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3c
+	.file 61 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.file 62 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF802
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF804
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF830
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF866
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF905
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF928
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF964
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF965
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF966
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF967
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF968
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF969
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF970
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF972
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF974
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF976
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF978
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF980
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF984
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF986
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF993
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1040
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1179
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1200
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1208
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1591
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcsplit.h.35.60cb2b54a6da895dfd971417785ff508,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1844
+	.long	.LASF1845
+	.long	.LASF1846
+	.long	.LASF1847
+	.long	.LASF1848
+	.long	.LASF1849
+	.long	.LASF1850
+	.long	.LASF1851
+	.long	.LASF1852
+	.long	.LASF1853
+	.long	.LASF1854
+	.long	.LASF1855
+	.long	.LASF1856
+	.long	.LASF1857
+	.long	.LASF1858
+	.long	.LASF1859
+	.long	.LASF1860
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3f
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1861
+	.byte	0xd
+	.long	.LASF1862
+	.byte	0xd
+	.long	.LASF1863
+	.byte	0x2
+	.long	.LASF1864
+	.byte	0x4
+	.long	.LASF1865
+	.byte	0x4
+	.long	.LASF1864
+	.byte	0x6
+	.long	.LASF1866
+	.byte	0x8
+	.long	.LASF1867
+	.byte	0x5
+	.long	.LASF1868
+	.byte	0x6
+	.long	.LASF1869
+	.byte	0x6
+	.long	.LASF1870
+	.byte	0x9
+	.long	.LASF1871
+	.byte	0x10
+	.long	.LASF1872
+	.byte	0x11
+	.long	.LASF1873
+	.byte	0x11
+	.long	.LASF1873
+	.byte	0x10
+	.long	.LASF1874
+	.byte	0xd
+	.long	.LASF1875
+	.byte	0x10
+	.long	.LASF1876
+	.byte	0x10
+	.long	.LASF1877
+	.byte	0xd
+	.long	.LASF1878
+	.byte	0xd
+	.long	.LASF1879
+	.byte	0xf
+	.long	.LASF1880
+	.byte	0xd
+	.long	.LASF1881
+	.byte	0xe
+	.long	.LASF1882
+	.byte	0xe
+	.long	.LASF1883
+	.byte	0xd
+	.long	.LASF1884
+	.byte	0xd
+	.long	.LASF1885
+	.byte	0xd
+	.long	.LASF1886
+	.byte	0xd
+	.long	.LASF1887
+	.byte	0x10
+	.long	.LASF1888
+	.byte	0x11
+	.long	.LASF1889
+	.byte	0x11
+	.long	.LASF1890
+	.byte	0xc
+	.long	.LASF1891
+	.byte	0xc
+	.long	.LASF1892
+	.byte	0xc
+	.long	.LASF1893
+	.byte	0xc
+	.long	.LASF1894
+	.byte	0xc
+	.long	.LASF1895
+	.byte	0xc
+	.long	.LASF1896
+	.byte	0xd
+	.long	.LASF1897
+	.byte	0xd
+	.long	.LASF1898
+	.byte	0xd
+	.long	.LASF1887
+	.byte	0xd
+	.long	.LASF1899
+	.byte	0x10
+	.long	.LASF1900
+	.byte	0xd
+	.long	.LASF1901
+	.byte	0xd
+	.long	.LASF1902
+	.byte	0xc
+	.long	.LASF1903
+	.byte	0xc
+	.long	.LASF1904
+	.byte	0xb
+	.long	.LASF1905
+	.byte	0xa
+	.long	.LASF1906
+	.byte	0xa
+	.long	.LASF1907
+	.byte	0x2
+	.long	.LASF1908
+	.byte	0x3
+	.long	.LASF1909
+	.byte	0x1
+	.long	.LASF1910
+	.byte	0x3
+	.long	.LASF1911
+	.byte	0x5
+	.long	.LASF1912
+	.byte	0x6
+	.long	.LASF1913
+	.byte	0x4
+	.long	.LASF1914
+	.byte	0x4
+	.long	.LASF1915
+	.byte	0x4
+	.long	.LASF1916
+	.byte	0x4
+	.long	.LASF1917
+	.byte	0x5
+	.long	.LASF1918
+	.byte	0x7
+	.long	.LASF1919
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1580:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1843:
+	.string	"rcSplitProcessMode"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1184:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1336:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1599:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1216:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1410:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1242:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1227:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1017:
+	.string	"_WCHAR_T_DEFINED "
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1177:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1809:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF874:
+	.string	"USE_CLI "
+.LASF1693:
+	.string	"rxBufferSize"
+.LASF1311:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF951:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF961:
+	.string	"USE_PPM"
+.LASF1710:
+	.string	"setMode"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF800:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF880:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1225:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF826:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1483:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF936:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF799:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1075:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF963:
+	.string	"SERIAL_RX"
+.LASF988:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1805:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1613:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1688:
+	.string	"vTable"
+.LASF1076:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"_Bool"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1282:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"USE_UART8 "
+.LASF1429:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"SKIP_IMU_CALC "
+.LASF941:
+	.string	"USE_FLASHFS "
+.LASF1048:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF926:
+	.string	"U_ID_2 2"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1201:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF902:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1633:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1602:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1389:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1822:
+	.string	"RCSPLIT_CTRL_ARGU_WHO_ARE_YOU"
+.LASF1205:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1700:
+	.string	"txBufferTail"
+.LASF1677:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1223:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF820:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF1665:
+	.string	"OWNER_LED_STRIP"
+.LASF1407:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1453:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF787:
+	.string	"__f32x(x) x ##f32x"
+.LASF1090:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1718:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1212:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF1009:
+	.string	"__WCHAR_T__ "
+.LASF908:
+	.string	"USE_SENSOR_NAMES "
+.LASF1576:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF725:
+	.string	"__need___va_list"
+.LASF1335:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1130:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1415:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1399:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1548:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1759:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF734:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF1094:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1630:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1264:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1619:
+	.string	"uint16_t"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF1839:
+	.string	"crc_high_first"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1167:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1115:
+	.string	"PG_RX_CONFIG 24"
+.LASF1725:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1515:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1359:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"TELEMETRY_HOTT "
+.LASF876:
+	.string	"USE_CLI_BATCH "
+.LASF848:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF752:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1482:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF808:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1034:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1209:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF998:
+	.string	"_T_PTRDIFF_ "
+.LASF1507:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF732:
+	.string	"__struct_FILE_defined 1"
+.LASF1458:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1126:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF955:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1327:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF748:
+	.string	"SEEK_SET 0"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF740:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1064:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF377:
+	.string	"__linux 1"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1008:
+	.string	"__wchar_t__ "
+.LASF918:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1235:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1635:
+	.string	"OWNER_ADC_RSSI"
+.LASF1180:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1539:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1795:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF753:
+	.string	"L_tmpnam 20"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF846:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF788:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1152:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1134:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1838:
+	.string	"sendCtrlCommand"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1770:
+	.string	"TASK_NONE"
+.LASF1440:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1575:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1720:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1243:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1208:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1078:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1061:
+	.string	"BIT(x) (1 << (x))"
+.LASF1661:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1302:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1697:
+	.string	"rxBufferHead"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1402:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF969:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF766:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1745:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF939:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1712:
+	.string	"beginWrite"
+.LASF832:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1561:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"___int_wchar_t_h "
+.LASF1669:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1813:
+	.string	"rcsplitSwitchState_t"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF1497:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1214:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF929:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1267:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF976:
+	.string	"USE_RESOURCE_MGMT"
+.LASF796:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF985:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1658:
+	.string	"OWNER_BARO_EXTI"
+.LASF1111:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF1818:
+	.string	"RCSPLIT_CTRL_ARGU_INVALID"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF772:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1672:
+	.string	"MODE_RX"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF962:
+	.string	"USE_PWM"
+.LASF1362:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1059:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1636:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1778:
+	.string	"BOXMAG"
+.LASF1052:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1131:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1144:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1145:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1290:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF956:
+	.string	"STACK_CHECK"
+.LASF1803:
+	.string	"BOXFPVANGLEMIX"
+.LASF1593:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF847:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF849:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF903:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1477:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1289:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1190:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1659:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1368:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1073:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF807:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF728:
+	.string	"____mbstate_t_defined 1"
+.LASF1163:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1671:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF795:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1540:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"MODE_TX"
+.LASF776:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF797:
+	.string	"__STDIO_INLINE"
+.LASF1224:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1775:
+	.string	"BOXHORIZON"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF887:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1702:
+	.string	"serialPort_s"
+.LASF1089:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1525:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1284:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1459:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1405:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1591:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF1789:
+	.string	"BOXLLIGHTS"
+.LASF768:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1641:
+	.string	"OWNER_SONAR_ECHO"
+.LASF980:
+	.string	"TELEMETRY_SRXL"
+.LASF824:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1500:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1366:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1270:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1776:
+	.string	"BOXBARO"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1629:
+	.string	"OWNER_SERVO"
+.LASF1063:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF819:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF933:
+	.string	"ACC "
+.LASF1604:
+	.string	"RCSPLIT_PACKET_HEADER 0x55"
+.LASF810:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF899:
+	.string	"TELEMETRY_IBUS "
+.LASF878:
+	.string	"USE_PWM "
+.LASF1530:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1010:
+	.string	"_WCHAR_T "
+.LASF958:
+	.string	"TELEMETRY_LTM"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1257:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1077:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF803:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1244:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1605:
+	.string	"RCSPLIT_PACKET_CMD_CTRL 0x01"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1471:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1614:
+	.string	"__uint16_t"
+.LASF791:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1628:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1030:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1587:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1723:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1655:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1020:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1600:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1036:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1832:
+	.string	"rcSplitInit"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1699:
+	.string	"txBufferHead"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1690:
+	.string	"mode"
+.LASF1468:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1543:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1285:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1342:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1598:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF842:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF864:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1171:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1595:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF817:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1047:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF838:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF923:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1168:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1354:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF909:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1719:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1607:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF835:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1178:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1200:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1079:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1395:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1005:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1432:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF917:
+	.string	"USE_NAV "
+.LASF1124:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1449:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF873:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1615:
+	.string	"__uint32_t"
+.LASF1155:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF931:
+	.string	"USE_FAKE_LED "
+.LASF1187:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1622:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1102:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1773:
+	.string	"BOXARM"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1028:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1338:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1711:
+	.string	"writeBuf"
+.LASF855:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF935:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1158:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1087:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1314:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1728:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1203:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1260:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF900:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF997:
+	.string	"_PTRDIFF_T "
+.LASF1790:
+	.string	"BOXCALIB"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1069:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1713:
+	.string	"endWrite"
+.LASF1715:
+	.string	"FUNCTION_NONE"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1542:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1786:
+	.string	"BOXBEEPERON"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1824:
+	.string	"cameraState"
+.LASF1667:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF699:
+	.string	"_STDIO_H 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1771:
+	.string	"TASK_SELF"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1038:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1329:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1016:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1450:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF886:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1041:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1650:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1546:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1492:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1056:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1761:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1091:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1431:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1245:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1815:
+	.string	"RCSPLIT_STATE_INITIALIZING"
+.LASF1357:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF724:
+	.string	"__need___va_list "
+.LASF1796:
+	.string	"BOXSERVO1"
+.LASF1797:
+	.string	"BOXSERVO2"
+.LASF1798:
+	.string	"BOXSERVO3"
+.LASF777:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF987:
+	.string	"USE_SPI"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1199:
+	.string	"IO_TAG_NONE 0"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1708:
+	.string	"serialSetBaudRate"
+.LASF750:
+	.string	"SEEK_END 2"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF919:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1566:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1495:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1129:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1701:
+	.string	"rxCallback"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1578:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1506:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1139:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1228:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1747:
+	.string	"gps_baudrateIndex"
+.LASF1165:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1821:
+	.string	"RCSPLIT_CTRL_ARGU_CHANGE_MODE"
+.LASF854:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1182:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1537:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1695:
+	.string	"rxBuffer"
+.LASF1772:
+	.string	"cfTaskId_e"
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1694:
+	.string	"txBufferSize"
+.LASF1681:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1258:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1660:
+	.string	"OWNER_USB_DETECT"
+.LASF993:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1198:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF861:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF762:
+	.string	"__attr_dealloc_fclose"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1557:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1149:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1074:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF927:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1753:
+	.string	"TASK_PID"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1057:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF992:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF731:
+	.string	"__FILE_defined 1"
+.LASF774:
+	.string	"__HAVE_FLOAT64 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1664:
+	.string	"OWNER_INVERTER"
+.LASF978:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1645:
+	.string	"OWNER_SPI_MOSI"
+.LASF834:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1549:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1689:
+	.string	"identifier"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1618:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF756:
+	.string	"L_ctermid 9"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF859:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1378:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF890:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1143:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1360:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1420:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1754:
+	.string	"TASK_ACCEL"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF942:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1021:
+	.string	"_GCC_WCHAR_T "
+.LASF1058:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF974:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1176:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1488:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1811:
+	.string	"boxId_e"
+.LASF1401:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1333:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1426:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1024:
+	.string	"_BSD_WCHAR_T_"
+.LASF977:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1085:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF770:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1739:
+	.string	"SERIAL_PORT_USART8"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1189:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF960:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1215:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1081:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1736:
+	.string	"SERIAL_PORT_UART5"
+.LASF1730:
+	.string	"serialPortFunction_e"
+.LASF1007:
+	.string	"__need_ptrdiff_t"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF868:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1060:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1127:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF994:
+	.string	"_STDDEF_H "
+.LASF1505:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF938:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1512:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1246:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF875:
+	.string	"USE_SETTINGS_INDEX "
+.LASF809:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1332:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1109:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1369:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF845:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1117:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1084:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF844:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF771:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF801:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1804:
+	.string	"BOXBLACKBOXERASE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF932:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1584:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"PG_VCD_CONFIG 514"
+.LASF971:
+	.string	"LED_STRIP"
+.LASF1479:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF769:
+	.string	"__f128(x) x ##f128"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1253:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1524:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1042:
+	.string	"NOOP do {} while (0)"
+.LASF726:
+	.string	"__GNUC_VA_LIST "
+.LASF1249:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"BOX3DDISABLE"
+.LASF968:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1390:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1188:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1396:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF891:
+	.string	"TELEMETRY_FRSKY "
+.LASF1219:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF840:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1164:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1527:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1726:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1055:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1518:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1721:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1350:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF967:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1806:
+	.string	"BOXCAMERA2"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1207:
+	.string	"IOCFG_IPU 0"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF754:
+	.string	"TMP_MAX 238328"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF721:
+	.string	"NULL"
+.LASF858:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1296:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF1642:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1275:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1748:
+	.string	"blackbox_baudrateIndex"
+.LASF1022:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF921:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1749:
+	.string	"telemetry_baudrateIndex"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1043:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1217:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1833:
+	.string	"portConfig"
+.LASF1553:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF920:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1141:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1563:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF870:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1716:
+	.string	"FUNCTION_MSP"
+.LASF1625:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1393:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF767:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1099:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1558:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF837:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1632:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1522:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1316:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1326:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"UNIT_TESTED "
+.LASF1098:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1107:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1014:
+	.string	"_WCHAR_T_ "
+.LASF863:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1226:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1037:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1840:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1597:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF783:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF895:
+	.string	"USE_SERVOS "
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1082:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF867:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1287:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1372:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF735:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1536:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF813:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1467:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1353:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF816:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1093:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1751:
+	.string	"TASK_SYSTEM"
+.LASF1509:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1181:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1026:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF821:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF1755:
+	.string	"TASK_ATTITUDE"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1828:
+	.string	"setTaskEnabled"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1297:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF877:
+	.string	"USE_PPM "
+.LASF1278:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1238:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1674:
+	.string	"MODE_RXTX"
+.LASF981:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF964:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1193:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1825:
+	.string	"rcSplitSerialPort"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF944:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF830:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1116:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF896:
+	.string	"CMS "
+.LASF973:
+	.string	"TELEMETRY_HOTT"
+.LASF729:
+	.string	"_____fpos64_t_defined 1"
+.LASF1100:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1044:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF755:
+	.string	"FILENAME_MAX 4096"
+.LASF1648:
+	.string	"OWNER_SDCARD"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1291:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1567:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1140:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1608:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1611:
+	.string	"signed char"
+.LASF784:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF893:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF894:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1564:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1018:
+	.string	"_WCHAR_T_H "
+.LASF1510:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1108:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1137:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1752:
+	.string	"TASK_GYROPID"
+.LASF747:
+	.string	"EOF (-1)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1438:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1473:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1816:
+	.string	"RCSPLIT_STATE_IS_READY"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF786:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1491:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF957:
+	.string	"USE_DASHBOARD"
+.LASF897:
+	.string	"TELEMETRY_LTM "
+.LASF1261:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1321:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1781:
+	.string	"BOXCAMSTAB"
+.LASF1768:
+	.string	"TASK_RCSPLIT"
+.LASF1229:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF836:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1186:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF915:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1741:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1742:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF989:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1841:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1416:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1801:
+	.string	"BOXAIRMODE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1031:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF990:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1120:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1722:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF888:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF996:
+	.string	"_ANSI_STDDEF_H "
+.LASF1830:
+	.string	"openSerialPort"
+.LASF1175:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1662:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1106:
+	.string	"PG_PID_PROFILE 14"
+.LASF1531:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1159:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1779:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1233:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1113:
+	.string	"PG_IMU_CONFIG 22"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF881:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1213:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1424:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1248:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF912:
+	.string	"VTX_SMARTAUDIO "
+.LASF1066:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF822:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1122:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF827:
+	.string	"isascii(c) __isascii (c)"
+.LASF1709:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF749:
+	.string	"SEEK_CUR 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF862:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1434:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1684:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1603:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1239:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1594:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1740:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF751:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1437:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1183:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF758:
+	.string	"FOPEN_MAX 16"
+.LASF916:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF723:
+	.string	"__need_NULL"
+.LASF1814:
+	.string	"RCSPLIT_STATE_UNKNOWN"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1732:
+	.string	"SERIAL_PORT_USART1"
+.LASF1733:
+	.string	"SERIAL_PORT_USART2"
+.LASF1734:
+	.string	"SERIAL_PORT_USART3"
+.LASF982:
+	.string	"VTX_COMMON"
+.LASF1737:
+	.string	"SERIAL_PORT_USART6"
+.LASF1738:
+	.string	"SERIAL_PORT_USART7"
+.LASF739:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1705:
+	.string	"serialTotalRxWaiting"
+.LASF1767:
+	.string	"TASK_BLACKBOX"
+.LASF1220:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1119:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1513:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1616:
+	.string	"long int"
+.LASF1191:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1807:
+	.string	"BOXCAMERA3"
+.LASF1112:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1339:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1157:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1231:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1638:
+	.string	"OWNER_PINDEBUG"
+.LASF1836:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF759:
+	.string	"stdin stdin"
+.LASF1554:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1324:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1792:
+	.string	"BOXOSD"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF898:
+	.string	"TELEMETRY_CRSF "
+.LASF1001:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1027:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1170:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1281:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1000:
+	.string	"__PTRDIFF_T "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1380:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1419:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1103:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1365:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1757:
+	.string	"TASK_SERIAL"
+.LASF1251:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF760:
+	.string	"stdout stdout"
+.LASF1053:
+	.string	"EXPAND_I(x) x"
+.LASF1762:
+	.string	"TASK_GPS"
+.LASF1413:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF757:
+	.string	"FOPEN_MAX"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1620:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1195:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1528:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1698:
+	.string	"rxBufferTail"
+.LASF1777:
+	.string	"BOXANTIGRAVITY"
+.LASF789:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1428:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1827:
+	.string	"serialWriteBuf"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1784:
+	.string	"BOXGPSHOLD"
+.LASF790:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1138:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1683:
+	.string	"SERIAL_UNIDIR"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1156:
+	.string	"PG_PID_CONFIG 504"
+.LASF1023:
+	.string	"__DEFINED_wchar_t "
+.LASF1498:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"isActivated"
+.LASF1194:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF491:
+	.string	"__flexarr []"
+.LASF792:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF889:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF972:
+	.string	"TELEMETRY_FRSKY"
+.LASF1610:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1780:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1135:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1011:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1095:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1756:
+	.string	"TASK_RX"
+.LASF1783:
+	.string	"BOXGPSHOME"
+.LASF1639:
+	.string	"OWNER_TIMER"
+.LASF1308:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1136:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1769:
+	.string	"TASK_COUNT"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1516:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1050:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1348:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1521:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF793:
+	.string	"_BITS_STDIO_H 1"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF914:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1617:
+	.string	"char"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF991:
+	.string	"DEFIO_NO_PORTS "
+.LASF1443:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1204:
+	.string	"IOCFG_AF_PP 0"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1273:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF839:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1787:
+	.string	"BOXLEDMAX"
+.LASF1799:
+	.string	"BOXBLACKBOX"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1179:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1731:
+	.string	"SERIAL_PORT_NONE"
+.LASF1392:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1651:
+	.string	"OWNER_FLASH_CS"
+.LASF1800:
+	.string	"BOXFAILSAFE"
+.LASF970:
+	.string	"USE_SERIALRX_XBUS"
+.LASF906:
+	.string	"USE_RX_MSP "
+.LASF1422:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1254:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1330:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1579:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1196:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF773:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1682:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF869:
+	.string	"I2C1_OVERCLOCK true"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1794:
+	.string	"BOXGTUNE"
+.LASF1128:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1837:
+	.string	"uart_buffer"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1033:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1051:
+	.string	"STR_HELPER(x) #x"
+.LASF1374:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1133:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF984:
+	.string	"VTX_SMARTAUDIO"
+.LASF882:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1643:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF905:
+	.string	"USE_RCSPLIT "
+.LASF1222:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1070:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1485:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1763:
+	.string	"TASK_COMPASS"
+.LASF1384:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF940:
+	.string	"USE_FAKE_BARO "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1774:
+	.string	"BOXANGLE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1423:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1025:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1758:
+	.string	"TASK_DISPATCH"
+.LASF999:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF741:
+	.string	"__off_t_defined "
+.LASF1606:
+	.string	"RCSPLIT_PACKET_TAIL 0xaa"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF934:
+	.string	"USE_FAKE_ACC "
+.LASF1842:
+	.string	"rcSplitProcess"
+.LASF811:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1408:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1465:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1351:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1735:
+	.string	"SERIAL_PORT_UART4"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1381:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1744:
+	.string	"serialPortConfig_s"
+.LASF1750:
+	.string	"serialPortConfig_t"
+.LASF1294:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF812:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1560:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1582:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1276:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1680:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1646:
+	.string	"OWNER_I2C_SCL"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF804:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1793:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1371:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1826:
+	.string	"switchStates"
+.LASF1086:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1148:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF872:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF761:
+	.string	"stderr stderr"
+.LASF1299:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF818:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1476:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"double"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF865:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1306:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF794:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF802:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1644:
+	.string	"OWNER_SPI_MISO"
+.LASF1263:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1237:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1668:
+	.string	"OWNER_COMPASS_CS"
+.LASF1590:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1065:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1387:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1096:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1760:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1015:
+	.string	"_BSD_WCHAR_T_ "
+.LASF763:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1819:
+	.string	"RCSPLIT_CTRL_ARGU_WIFI_BTN"
+.LASF1551:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1040:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1173:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1810:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF738:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1647:
+	.string	"OWNER_I2C_SDA"
+.LASF1791:
+	.string	"BOXGOV"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1489:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1764:
+	.string	"TASK_BARO"
+.LASF1820:
+	.string	"RCSPLIT_CTRL_ARGU_POWER_BTN"
+.LASF1829:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1534:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1293:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1569:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1142:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1121:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1080:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1743:
+	.string	"serialPortIdentifier_e"
+.LASF943:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1206:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1414:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1746:
+	.string	"msp_baudrateIndex"
+.LASF806:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1696:
+	.string	"txBuffer"
+.LASF1012:
+	.string	"_T_WCHAR "
+.LASF852:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1480:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1765:
+	.string	"TASK_ALTITUDE"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF904:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF995:
+	.string	"_STDDEF_H_ "
+.LASF1218:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1236:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1585:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1729:
+	.string	"FUNCTION_RCSPLIT"
+.LASF1586:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1455:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1570:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1118:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF829:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1318:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1071:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF727:
+	.string	"_____fpos_t_defined 1"
+.LASF1663:
+	.string	"OWNER_RX_BIND"
+.LASF1147:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF911:
+	.string	"VTX_CONTROL "
+.LASF1474:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1666:
+	.string	"OWNER_TRANSPONDER"
+.LASF1114:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF851:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1320:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1266:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1788:
+	.string	"BOXLEDLOW"
+.LASF1386:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"__f32(x) x ##f32"
+.LASF1002:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1013:
+	.string	"__WCHAR_T "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1446:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1678:
+	.string	"SERIAL_INVERTED"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1703:
+	.string	"serialPortVTable"
+.LASF815:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1679:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1717:
+	.string	"FUNCTION_GPS"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1675:
+	.string	"portMode_t"
+.LASF1241:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1062:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1624:
+	.string	"timeUs_t"
+.LASF925:
+	.string	"U_ID_1 1"
+.LASF924:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1150:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1724:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF1470:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1653:
+	.string	"OWNER_MPU_CS"
+.LASF1656:
+	.string	"OWNER_SPI_CS"
+.LASF1447:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1161:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF765:
+	.string	"__HAVE_FLOAT128 1"
+.LASF841:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1533:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF986:
+	.string	"USE_I2C"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF937:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1192:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1067:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1110:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF764:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1687:
+	.string	"serialReceiveCallbackPtr"
+.LASF1552:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1172:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF828:
+	.string	"toascii(c) __toascii (c)"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1029:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1097:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1068:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF884:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1398:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1363:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF746:
+	.string	"BUFSIZ 8192"
+.LASF1685:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1154:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1049:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF775:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1707:
+	.string	"serialRead"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1377:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF733:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF742:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF730:
+	.string	"____FILE_defined 1"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1714:
+	.string	"serialPort_t"
+.LASF1626:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1341:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"serialTotalTxFree"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1596:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1686:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1323:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1003:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF833:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1573:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1435:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1831:
+	.string	"findSerialPortConfig"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF965:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF901:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1461:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1197:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1202:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1345:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1676:
+	.string	"portOptions_t"
+.LASF1823:
+	.string	"rcsplit_ctrl_argument_e"
+.LASF1101:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1649:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1486:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF823:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF736:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1234:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1232:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1692:
+	.string	"baudRate"
+.LASF945:
+	.string	"USE_UART1 "
+.LASF853:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1555:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1441:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1501:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF860:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1808:
+	.string	"BOXDSHOTREVERSE"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1279:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF1032:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF744:
+	.string	"_IOLBF 1"
+.LASF1162:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1670:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1835:
+	.string	"argument"
+.LASF1452:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF953:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF885:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1252:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF743:
+	.string	"_IOFBF 0"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF866:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF946:
+	.string	"USE_UART2 "
+.LASF910:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF913:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF798:
+	.string	"_CTYPE_H 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF983:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF831:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF392:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF1105:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1704:
+	.string	"serialWrite"
+.LASF1132:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF947:
+	.string	"USE_UART3 "
+.LASF879:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1272:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF930:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1083:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1211:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1766:
+	.string	"TASK_TELEMETRY"
+.LASF1652:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1609:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF948:
+	.string	"USE_UART4 "
+.LASF1588:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1581:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1045:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF805:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1519:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1785:
+	.string	"BOXPASSTHRU"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1160:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1456:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1631:
+	.string	"OWNER_ADC"
+.LASF1612:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1657:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1834:
+	.string	"switchIndex"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1589:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1782:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF949:
+	.string	"USE_UART5 "
+.LASF1504:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1104:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF979:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1255:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1634:
+	.string	"OWNER_ADC_EXT"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1153:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1627:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1691:
+	.string	"options"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1039:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1654:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF745:
+	.string	"_IONBF 2"
+.LASF1545:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1088:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1425:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1315:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1221:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF950:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1817:
+	.string	"rcsplitState_e"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1914:
+	.string	"io_types.h"
+.LASF1893:
+	.string	"__FILE.h"
+.LASF1880:
+	.string	"long-double.h"
+.LASF1903:
+	.string	"__locale_t.h"
+.LASF1904:
+	.string	"platform.h"
+.LASF1870:
+	.string	"target.h"
+.LASF1890:
+	.string	"__fpos_t.h"
+.LASF1874:
+	.string	"libc-header-start.h"
+.LASF1858:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1900:
+	.string	"endian.h"
+.LASF1887:
+	.string	"stdio.h"
+.LASF1886:
+	.string	"stdint-intn.h"
+.LASF1911:
+	.string	"rc_controls.h"
+.LASF1905:
+	.string	"common_fc_pre.h"
+.LASF1857:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1860:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1881:
+	.string	"stubs.h"
+.LASF1852:
+	.string	"src/main/target/SITL"
+.LASF1912:
+	.string	"beeper.h"
+.LASF1894:
+	.string	"FILE.h"
+.LASF1849:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1889:
+	.string	"stdarg.h"
+.LASF1856:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1876:
+	.string	"features-time64.h"
+.LASF1861:
+	.string	"types.h"
+.LASF1898:
+	.string	"floatn-common.h"
+.LASF1897:
+	.string	"floatn.h"
+.LASF1878:
+	.string	"timesize.h"
+.LASF1872:
+	.string	"stdbool.h"
+.LASF1859:
+	.string	"/usr/include"
+.LASF1844:
+	.string	"src/main/build"
+.LASF1906:
+	.string	"common_fc_post.h"
+.LASF1845:
+	.string	"src/main/common"
+.LASF1875:
+	.string	"features.h"
+.LASF1883:
+	.string	"typesizes.h"
+.LASF1884:
+	.string	"time64.h"
+.LASF1864:
+	.string	"serial.h"
+.LASF1866:
+	.string	"scheduler.h"
+.LASF1867:
+	.string	"rc_modes.h"
+.LASF1862:
+	.string	"stdint-uintn.h"
+.LASF1869:
+	.string	"rcsplit.c"
+.LASF1853:
+	.string	"src/main/target"
+.LASF1895:
+	.string	"struct_FILE.h"
+.LASF1919:
+	.string	"streambuf.h"
+.LASF1868:
+	.string	"rcsplit.h"
+.LASF1854:
+	.string	"src/main"
+.LASF1918:
+	.string	"msp.h"
+.LASF1846:
+	.string	"src/main/config"
+.LASF1916:
+	.string	"io_def_generated.h"
+.LASF1865:
+	.string	"resource.h"
+.LASF1863:
+	.string	"time.h"
+.LASF1910:
+	.string	"parameter_group_ids.h"
+.LASF1901:
+	.string	"endianness.h"
+.LASF1885:
+	.string	"wchar.h"
+.LASF1915:
+	.string	"io_def.h"
+.LASF1847:
+	.string	"src/main/drivers"
+.LASF1913:
+	.string	"io.h"
+.LASF1892:
+	.string	"__fpos64_t.h"
+.LASF0:
+	.string	"./src/main/io/rcsplit.c"
+.LASF1855:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1891:
+	.string	"__mbstate_t.h"
+.LASF1850:
+	.string	"src/main/msp"
+.LASF1879:
+	.string	"cdefs.h"
+.LASF1902:
+	.string	"locale_t.h"
+.LASF1907:
+	.string	"utils.h"
+.LASF1873:
+	.string	"stdint.h"
+.LASF1909:
+	.string	"build_config.h"
+.LASF1888:
+	.string	"stddef.h"
+.LASF1882:
+	.string	"stubs-64.h"
+.LASF1917:
+	.string	"fc_msp.h"
+.LASF1899:
+	.string	"ctype.h"
+.LASF1877:
+	.string	"wordsize.h"
+.LASF1848:
+	.string	"src/main/fc"
+.LASF1851:
+	.string	"src/main/scheduler"
+.LASF1908:
+	.string	"parameter_group.h"
+.LASF1896:
+	.string	"stdio_lim.h"
+.LASF1871:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375 \235\215\003"
+	.string	"\204\005\221"
+	.string	"\t"
+	.string	"\305\333\260\346\002\026\002"
+	.string	"\002"
+	.string	"\002\001\002\003\002\003\001\002\001\001\352\263\360\321\b\002\372\347\212\324\013\b\002\004\002\004\002\005\002\006\003\004\240\342\234\212\n\005\236\221\341\235\003\004\002\004\006\251\207\337\333\001\006\002\007\002\b"
+	.string	"\002"
+	.string	"\007\225\312\372\256\r\002\b\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"\256@\344p\225P\223@\335\313\216\214\231\205\333u!\227\325\006"
+	.ascii	"\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375 5U\001"
+	.string	"\330)"
+	.string	"\005"
+	.string	"\001\001"
+	.string	"\001\002"
+	.string	""
+	.string	"\005"
+	.string	"\003"
+	.string	"\001\006"
+	.string	"\003"
+	.string	"\002\007\001\001"
+	.string	"\001"
+	.string	"\005"
+	.ascii	"A\205\330\031\t%\310K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"m\005"
+	.string	"\"\311\037)pe\013c"
+	.string	"\235\007\026\016\022KF\003\244?7{[r]\321\377\237n\247Z\250\252\002\372\217\335\222F\336A#QJ\231\002\377\023p\323|ld\300W\032Y[\217\006\001C!\034\220\227i2\235\320\341\352\377R\321\356f\225\335\305\246.]\353\360\261\220\216\334P"
+	.string	"<\305#=\246\b\006q>\276\326\351\217\005\376\363\334rw\267zN'\222\357\263\310\177\2208\216\234^H'K\202\232\032\261\021"
+	.string	",Cld\267JhH-"
+	.string	"\231\200\307\004\220*\260\251 \2007g\214?\230"
+	.ascii	"\003\257\263\032\206%\363T\241\t/\301\024\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\215\005"
+	.string	"\022\211\033#\200EI\007sICd\0034!\364\212T\272\f\036\037\302\210fD)"
+	.string	"3"
+	.string	"\374\\\364\333&m\313$\003$S\362\225\003n\342\314V(\217\362\254\027\220\316\270r\255\327\272q\245\032\220\274\r3\314\216kB\246\002\300\035a7\367\315u\273LiFW\265s\357\\?BXz`)\243\0377\227n$U\023\210'\320\344\t\252\354\231\370!\033"
+	.string	"Z "
+	.string	"\216fZ\200u\343\032\206\201\353@nH\315\243\031\332Q\365v^3\252I\257\340\003\"b.\026x\330\317\3538\255\316i\322\251\004z\243\022\2131\202"
+	.ascii	"Km[\261\\\026\373\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\270\004\005\270\004\006\231\004\007\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375 \221\235\002"
+	.string	"\024\003\205"
+	.string	"\005"
+	.string	"\001\002\022\001\002\002\002\023"
+	.string	"\001\002\023\001"
+	.string	"\002\024"
+	.string	"\001\002\025\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\002\006\002\002\026"
+	.string	"\001\002\027\001"
+	.string	"\001"
+	.string	"\007\001\002"
+	.string	"\r"
+	.ascii	"t@\324*7\013ux\206y\212\200\232\004\261\032lK\331\224\020\230"
+	.ascii	"ww6\200\305\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.2b52c16b0cd58a3e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sendCtrlCommand.37.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\324\007%-"
+	.string	"\372L\350\020Hp\032R:[$\365\245I\005P\230\320+\37751\252\244\354,@P\220C\022c\310\206\250t\364\322j\246\211\202\257\320\270\216&\252Ns\355(\177\304\035\235\3251\016\306]\035z\224/\272\036h\3419,!\204\220\275\223\f\372"
+	.string	"\356"
+	.ascii	"\002\001`\377\225/\273\355\t9\226\213\031?\346\342\007C@\316"
+	.ascii	"C\254\300r\276\322\300>E\220\366\222,5\200`\274\262\310f\260"
+	.ascii	"\225l\b\215\267\234\225\t\2366\006\266\247c\351\267\373Un\305"
+	.ascii	"\370\260\027\255\313\271\313\355K\316\312\005}\200}\372;\220"
+	.ascii	"\372\024}O}\332\306n8W~\345\brTK;9"
+	.string	"g 6\302\262lO\243G\225\357\026\033\017`\327\362zt\354\252\246(\276\306>\214\003X~\207\2562n,\271\363\312\007\312\004\367\206\366\246\214\333&\263z\234\207\2566\256\332\334y\305\2052=\343l\275\231\274=E\262\266\256c\273\262x|E\r\244\031\362\346\316+-t\210k-G\213Eu\325\006o\236]Y[O\337<\032\305\315\263+\253\307Q\244\256\254\037\307\350\203(3\312xX1\320VK\035'_\376Za!\357]-\344\234\373Vae\275\003\274\373C\335M\242{\355\020a\270Y\250\307%\304\332b\\\270\356\203y\030\026\375$\375\204\342\276\n\205\372\364x\327\246u\274s\375\345{\230X\316|\343\272\225\310\213\275\272\317nIC\322\230Hw\022\322\317\336\277\243\253\275\215\212\210t\267\t\350n\017\251\267\007\250\267\205t\267\203|@?\354\355\236\317\315\336\273\207\375\272\247\2751{\373\256\267_"
+	.string	"B\221\240\271\234o\314\341\311hR4&W\373\323~\263\377\354\037{\177\313\323\372jov\333F2e\333\324\231}/G\303M\312\244\344\234\333\263/E4kM0\263\244\336\237})\nQ\030\023\242\215/#Z@\316\3200E\356\255\247\266\224\336\233\365\271\274\313\324\313\210x\306\00603oO\033\004\373\264\225\354\267L\365\311\256\245\333\247=6-Y\330\300rVz`\237\366\236K\335'\353\006\020\246\256,\376p\316\\m\001/\252F\370\b?\311\325\274.M\022\266p\324\025!P}\270\b_\267$\036\344\363\322\300\002\345\215%\"\200\211\360ucp(u\b\023\300\247\3221"
+	.string	"\017a\264\251\340Bx"
+	.string	"~\022\217\017\013a\314\206J\316\253\314\224.b\316\025{\365\241\324 \374.\2615\037\016\302\267\214J\216H\006\223\331\270\203\246b/\265W\b\"\024\003\204\237\366\203{\030\b\337\215JG\237\315\251x\"\276K\253-\037\314\340;\354\203/\233\344\023\344\235k!\030\246g\022,\005j\256\375i\315\1778sf\264\353\204XQ\203\236\275\rrd~y\242\350\253\352f\377A9\022%'\316\214\235\367\335\254\222\243\303\027_6TrM\276"
+	.ascii	"H\363E\265\273\025|Y\374\371\31293\371\276\350\374xQ\275\362"
+	.ascii	"\022\202\034o\\_&\017\027W\304\201\217\235\327vu\231;V\344\234"
+	.ascii	"7\250\0134\347\256\n\037\273\356\r\313\235\353\035\023\307\231"
+	.ascii	"g\002\335W\2050\005\036J\255\300O\037\n\235\234\210%FH\r\233"
+	.ascii	"\210mp\030\304\035l\022:0\341\024tR\352I\251\020B\021O\f\233"
+	.ascii	"\330\016*I=\245X\321\"8\004F=\001U<5A\001\203\303\026@%\241\216"
+	.ascii	"Z!\034\002\245\242\242\206\300Vy<&\322\027#\017\240\375\301\030"
+	.ascii	"[=\300M\017\260\341\356\240\360\276\252\177I\f\243/3\315\231"
+	.ascii	"\327\374\211\372\276\350X9\242E\005\343+\273{\371\327`BAs\274"
+	.ascii	"q\037\352\354P\236\017\257J\270\320\257\375'\203\333\022\036"
+	.ascii	"R\233\377\260\325\233\347P#\214\347\203\033EW!eRv?<\024C\372"
+	.ascii	"\035\335\376\303H\370y\330gs\207o\366\303?\373\275\025\350\300"
+	.ascii	"\371h\261W\237\207\352\222\360\252$,\005\302>l\265V\351\2160"
+	.ascii	"\206K\337v\2436\302\027\334\304\270pM\214\356"
+	.string	"\215k\037\232s\316=\330\253\003$\331\"\334*\201\263\022\341$l\325}\204\2576\027\200\263\250QP\207\024SB\"\"A\222\244\031\016p\002\231);n\020H\311F\223\2449?C\305\302\263\233\332BrJ\254\242\225\370\215\274\204\313\205!\341j\354\021 \207&\326\3017\250\343\252\250`'\364\313\fO\215\025:\026\030\025\274\244\235U!\275\307\334\314\203\270\276\206$\351h\271\004f\240\016\233\2061\024H\353(\255\232\271*@\206\333\021\234\233\342\341\32500Q\214\3572\354\224\321\020\006(\360\374>\204\205z\204u\233\036\001\272\260U\327lj=$\354\001-\252\270\343O\260\036\037\277\t\030l\210\230\361\b\r\373\235\321yf]\007+\"FbD\341\013\024\0346\311\212\222\376Z1t\360\330\211\356\202\322E\223M\207@\177h\354k\016\001\207{#\331\013Yw\021\241\331\355\301\2212\340\032\033Gy\024\321\316"
+	.string	"\300\235\f\331\273=l\204d"
+	.ascii	"\246}\264q\210\215\334\222\b[\b\275\261\241\232\f2\216#4\302"
+	.ascii	"0\037\201\370>M!\252+|\372\256Q\310\357\355\024d\2344\301\005"
+	.ascii	"|\304\225.\304\376k\253]PE\362\342Sw\317E\377\365\344`\267\005"
+	.ascii	"\353\002\310\230\372\250\361YV\240\375:\316',\352\204\rt^ch-"
+	.ascii	"\"#&_\313$9\2413\312\r\035\374^*\313\342k@p\035\301\321\355\302"
+	.ascii	"[\201\253\n"
+	.text
+	.section	.gnu.lto_rcSplitProcessMode.38.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\313\004\225\036"
+	.string	"\366\366\276H\240\330M:\204\336\311\233\325\220Z.\036X\366Z/\226\363\375o\2368\n\304;A3\007\370\217|1\351`\353\337\317&\312IW\210\353\217\243\360\204\034\037\3362\371\304\207!;\204\3504\306\242\212\372\023K\b\331\233H\231d\256"
+	.string	"\235"
+	.string	"\246"
+	.ascii	":{$\373\336\226\237\264-:O\362\253\243c\305\030sL#\227\326\021"
+	.ascii	"/\265\366 |n\203\3613\347\004\350g\370\033\372\371r\217v\273"
+	.ascii	"\274\007\244\212STK\2762\265\326Z\377X\031\037\275\224\221\243"
+	.ascii	"Hg\3305|\264\317\275\f\003\354\b%\364\220X\346\303I\307\311Q"
+	.ascii	"\344\021\303\fJ\306d\230`z\n\347\225\022p\0054-1\005\301\243"
+	.ascii	"\207dL\312\351\3513|\340\305k\314\254I)$`c\310\356?\031\034\346"
+	.ascii	"\320:\317hJ\342\276N\307k\300\230x\2049\265\326[]A\021\246\035"
+	.ascii	"\314\"O\255uy\327\344\364\005\360\335\375\332\335\017\273a\215"
+	.ascii	"?\215\037\231\356\346\355\377\232\356\261\374\033}\233\320\342"
+	.ascii	"\222\304fv\317\344Mn{\252]\001\304\337}\356\201\232A\220\034"
+	.ascii	":\016\356\255.\373a\001\253\f\334\355\345\270y\273\347Zkn\273"
+	.ascii	"\307.\316}\337\233\221\227\366\254\257M\310;;\326\227\244\274"
+	.ascii	"c\310+\212\274t\362N\312\033N\336\016y\271y_\200CU\231/\007\304"
+	.ascii	"j\265\021<S\277f\024\"\367\375Y?\326{\36743:\373%\373\337\226"
+	.ascii	"4\240\317\311\224\023\017]t\366J\366Zb\023*\034"
+	.string	"=\313h\254U\"\327\224\325\206\361\223\246%b\323Y\213\274\253:g4[\"1m\211\315\343;\240\264\356+6\301`\360\353\016(\331\264^\236m=\355\215\350}\357\211\3221pg[8\252\227\0300\332\274\236\330\031\250\332R;`\253\351\034\206\354\240f\363\336\365\331\227\332\021\217R\024\001H\255\325\302\356\272\270WO\202\260Z+\206'\207BbO\365\271%||\350\347l\362\312\246\303\236R~\177\215_\360\275ZkXD\273q3&{\367'\005\177\327\255!*\251s[\363\033\263\351g=G\307\300\375\327\215(\267Ms\227\022\024\022\007\227l\356\260k)\215VDA?@E)p>#\214\237\023A\036T\330\210n/\206\312\265\371\374P8\201\302\206b\347\346\366\265\355\020\335X\264\030\262\341jB\267Z\320\315\007\250f\303\r\325v\f\254P\213\037\\\215HH\bW+{\365|\036]#\225\315["
+	.string	"\\$NO!593\026t\230ORd\363\350\030\370P\206\323\307z\fJ6N_\t\n\251\367\262\312H\324\030\230\345\3111\032&\233\227\245\250A\320\277z\020`\251\020\026f\354P\314\030\006\253\216\201\031\233\367\"j\245\n\225\013aaD*8L{7\204\b\376ns\222:\2677M\3737\266\246\370\316\f\\\261oZ\006&\313\215\350\254\003`\250a<c\221b\210$\020\021\005iSh\f\200\002\031!3;\021\260-dT\234\264\031"
+	.string	"S\211W\356\270\027\232-O\0274\f\332\323[\037\344\001V\022\206aFp\334a .b\301\023f\260\004}}t\240VfJbx\324!LOB\247\t\004\003\343\315\354La\"K\271_2\020u\202[\f\021\301(\274G\004\266U\241\257'\2011)\323\206\003!h\334\275"
+	.string	"%\304[\241t\336"
+	.ascii	"\255\003\337\027$l\2152%\236\252\320\210\274\227\025\207\317"
+	.ascii	" \375@\177\376\024\3721\224\327\321\374\317\bL\273\277\016\234"
+	.ascii	"\317\017iT)\023\223\331\213\357\302)'\033\212\273\363\377;\037"
+	.ascii	"M\330\270\376\025\336\351q\034\2571 \024XeN\205\002\252\263."
+	.ascii	"_\225\246=:X\r"
+	.text
+	.section	.gnu.lto_rcSplitInit.39.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\025\002E\023"
+	.string	"\026&\206I\260TN:\224\330k\336q\322\344\312\357K\265\005w\221\314Q\r\267l\037\367\330\f\026=\030\313(\253>\276\250\266\376\0230\265\365\ti\375\362f4\215\376L\"}\335\t\370p\277?L\375\327\204V3b]\373{o\271S\nt"
+	.string	"n"
+	.string	"n"
+	.string	"@\377\3513\202\376\003z%J:9\362u RkX\340\323\004^\237\016\337B?_g\241\237\216A\020\344\334\303&\244/%)\212\342\2525\234-S.\346N\247\334\230\363a=\335\351+\304\247<\020\203C\016\225\336\006\031\233*\342\202(\312\017_)\340\207\017\030*\275\235\034\240\224\002\307\201\217F\275\241\030Mdj\255\216\274\236\207\333\344\266k\266g\354(!\326\300\023\317\203\355M\240\330\255\316\007\236\306*\311\310V\215]v\250\213\353\263\177%\0252\242\274+lG\247\374w\303\034=\037\274\345\214\336\031\035e\364\001\264<\235PZR\262A\302\212\264\004I\305\232;Z<\370\377\036\355\257"
+	.string	"c\036\3650\266\022B\3714^#\350\301\037\331.\254=\032\026<\236\270\030\274>e\362~\030\024[y\021c?\353[_\307\255||'C\250\211\347}\3725\364s{\360\266X\242\037\201\356'P\223]=\005\352\333\320\333\370\327\246\341\304\363\342\312Jbu\266s>e{\021RkM\340\337\260pAAS\255\365N\237\337\027\255\237P\\b\024*\021Y\276\222b:\332\365\371@\024\2667\301!\273x\304\221\nD\026l\377\273L(v\371$\276\326\337\250\003\266\233f\203c\240B\215V\203a\311\261\325tn\013zp\267\035\230i0=6\f;<4\334\354f\233\351\330l2\314h8\236\031\214\213o;8\270Y\317\355\206\233\305\302z9S\366\300\317"
+	.string	"A\222\252\222~\216N\317\265\214\320\016\321\365\371Po\020U\242\250J\312\376C\345\032\331.\321v\360 \236\227\262\273\272\277\326Z\247\017\335\275\tj]\355\242h\215\b`\205%\003\037"
+	.ascii	"\221S\360\305\001a\230\300\025vi\210MZK\200\205P{4\021 \270W"
+	.ascii	"\261\346jGk\n\200\031\224-\374q\"\230+P\214;\020Q\331-\271Ld"
+	.ascii	"\211\301\253\300\272J\005\215y%OXb\013?\362D{\213\200\001\030"
+	.ascii	"nJ\241\366"
+	.text
+	.section	.gnu.lto_rcSplitProcess.40.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\025\013"
+	.string	"\306\324M>"
+	.string	"3\324t\260\261p\210R\275k1\376\244$3\240\004\3474\204\327\004q@\021\023\351\034\330\0204\t\036\323\301\324P\223\024\277\206\\\246\276\"\262%\260\274\256\263r\021\206$\374i\223-S\n;"
+	.string	":"
+	.string	"="
+	.string	"\326\361\221\304^\225\"\203\252\265\273\232\034\361\360\230\324\320\217\210\241c\036.1\006&\0305\006\210#l\222\003E\210\247\256\032D\222*\304\262\273\326\222\330\341\236\267\r\301v\004\373\004\002\273\273\226'[\325\237\023>\264v,X\355nx\375X\033s\206\t\333\227\330\005L\017\256\366U|Ex\024\006\007\330\005\201\222\261;6\260\002"
+	.string	"\237\224\037\310>\261O\262O\207\016\224\221\f\331"
+	.string	"\r\016z\343E\f\2264(\273\244\340\202ER\227}\026o\001\362K\370\302G_\372\364?\331\347e\002\226I\244/G\\8\236\372eu\242\007\217U\037\366\030R)\302>\026\3360\234\203\n\231-S\231\200\0228Mw\351l\270\357\363l\002\274U:\235\005\016\270}\232\327i\233\016\243\321\266\017\324*\b\354q\270O\353x\336\247I\306\275<\331\"\222#\f\2426\350\321\227\034\017"
+	.ascii	"\304\263\340\314\200u\316\300\257\356a\031\245\232\005\200T\260"
+	.ascii	"\360\034\266|Y5.X[\253\321\342.?\325\336\024M\355\001"
+	.text
+	.section	.gnu.lto_rcSplitInit.part.0.46.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\351\002\025\027"
+	.string	"\006\353\224I\260XQ:\300\347\377\024b\\R\036 \006\003\213Q\307sD\031\316h\330\230\004c\241@\325\202I0\322\324~*\234To]\237C\323~\220\347 \332O\025\317*\037\322\017J~\275\221\354;\354\007\2475D\354\336d\357\224\002}"
+	.string	"|"
+	.string	"~"
+	.string	"/\302\245Nav\264\354\213>\220\007\301\235\b\350\013b\b"
+	.ascii	"\211\236\210)\273\342\202S+\bO-\376@=\r\257\252\247\367\341V"
+	.ascii	"\315m\250U\203s\356\342\214\022\207\221%\304\321\323\256\310"
+	.ascii	":\2352<e\356\024\234\262\346|\271\343\005\235\242\\F\227\321"
+	.ascii	"\261\004F\224\221\207\342 H`w\005\360\204\300\006\273{\245\313"
+	.ascii	"\021<\235\234.9N\\\252^Q\256\335u\230\342F\335\266\3146\005{"
+	.ascii	"&\b\273\2361lKW\212\222\006\377\273g\225\226\367\335\177\231"
+	.ascii	"\2711\240\305n\211-X\326\005Er\343E\277\357\377}\332\367}\377"
+	.ascii	"\371F\234\362-\351B|%\337N\304\026\006\r\205\343\321\n\230\""
+	.ascii	"\255\373\236\344\217\343\370\"?\341\342@\215=\026\022\302S\030"
+	.ascii	"\242\326\223^\344#\211H\376\220\037\341N\304\266\022\022\227"
+	.ascii	"wC\203\311\217\247\b\341\351\n\274_t\363\215\234\362\355D@2F"
+	.ascii	"\\\023C\001\243\244\363s\204\214\215\024!i\205\252x1]:p\316\236"
+	.ascii	"m:\357\373Jg\253\237t^\351\347\261\353\301\264\317U[\347Jr33"
+	.ascii	"v\367\201m\016O\"C\320\264\273\020\216\034\211\006\337\306\251"
+	.ascii	"wf\362\273Y=e5Q\231\023\234\340\322\313\350\203i\376\367\225"
+	.ascii	"N^\361\237\374\247\3129\247\374\201h\341a\312\t\376Bh\321\311"
+	.ascii	"-\276\221\207P\222\210U\234V^\361\374\334\335 9{\236\365\337"
+	.ascii	"\r\035b8<\0232\300j2\233OJv\303^1\00789\260\034\032\225\216,"
+	.ascii	"\207gfS\243\315z\\\f\243\251\3116\364\370\300h\254\231\214\305"
+	.ascii	"#{\355\260`4\037\026M\214g=1\032\2536\233\321X\251\177g\f\271"
+	.ascii	"\002\311\007~\351\265N\273t\323\003\255\360\344\311I%\031\274"
+	.ascii	"\300-T\373\002\006\371\235W\037f\220\345\270\204I\376U\375&w"
+	.ascii	"\362\362m\030\026\223\337\305\352\251\201&*:\243\337,m\025\247"
+	.ascii	"=8{\2465\352\352\266\032 < P\002A\352\356\034\221\246\240\250"
+	.ascii	"\2141\264\300\260\342 8\033ep\273\"\232\004\340\216)Z\313b#\335"
+	.ascii	"\025\025Q\360\021\250\024b\363\264\327\006H\3375\013y\026V\312"
+	.ascii	"\370\3565}\223\003\316\034\323j\325l?[\344C^\272\306\307>\346"
+	.ascii	"\262\242j=\354\262T5\240\007UC\270\336\305\377\232X\237\3042"
+	.ascii	"*\253\253\370\251r\215\016\f?\225\306\306\210\251,\275-\007y"
+	.ascii	"\006\021\266\252s\332\b\305\t\r\334?\341p\365\343uN\2776\214"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\365\006"
+	.string	"\322J)/`-P\007pB\23325\303\3567`\034\220\335$A*lk\233\3600$\b\202\302%\020\340\245\bQ3\370\023\fAS\370O\266\243\2242\005O-ud\013!Qe\025\355\301\205V\276\34340\006\340Z4p\227-\223yK\200%S]\334ua\226\273\350^d\251T&%\002\337\211!\0308Bb\211\210'\362\377\357\234@L\221O\363"
+	.string	"\034~\320\330\036\031\030\307\307\002;\350\377\247c\264\262\273[\201+\022\242\207 iwS\007\334`Q\006\320\373\017;\306\356\370\371\027\2712"
+	.string	"\244\333(\340I\377'\007\026"
+	.ascii	"CGe\333\354I\213Eb\005\037\324\003\200\003\200\303\007L\344\027"
+	.ascii	"\032\214`x~V\030\016\262\001bU\205\333\031\262\236e\201\302\237"
+	.ascii	"\312\003\f\330(\347+\255z\002"
+	.text
+	.section	.gnu.lto_.refs.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\004\002"
+	.string	"\003\002"
+	.string	""
+	.string	"\004\r"
+	.string	"\001\004\037"
+	.string	"\001\004\""
+	.string	"\002\005\001\004\007"
+	.string	"\001\003\020"
+	.string	"\002\006\001\001\t"
+	.string	""
+	.string	"\001\013"
+	.string	"\001\007"
+	.string	"\001\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2b52c16b0cd58a3e,"e",@progbits
+	.string	"(\265/\375`\346\027\245p"
+	.string	"\332\271\204)R0\022\322I\007;\355\356\356`t\275\3674G\344\352\317\345<j\024\356\257+W\027\327\025\342S\350vVYH\355\255\215\355\345b\256\260Q\007\024\fhOo;\302<\252\264\250\2548\323\317\022\204\b\346\\\003\274\303\377'0\307E\235D\214h\210\020)S5\002\177\002\225\002zD\274\307O\216\343g\326\004L\362\210\266p\027\002\226\224/\262\310@\360\363\023(\354D\307\226\352Y\231\223\223\237\350\274\307o\254\205\237N\027ji\350\356m\317b?\243\355q\024\236\262b\307\362&w\250C H\263\007\226\274{[\006\200\030\300\311\223\373\201\252\200\224\317\360 \201\022\013\353\364\275\245\232\261c\203r\024\302ug\273\223\311\271\227"
+	.ascii	"\024n\bX\263\323\3371\335\377\233\364\tX\326\f\235r\030\026\303"
+	.ascii	"f\013\360\2303\031.\363\032d{\333\266!\b\036\312:\355a\022\277"
+	.ascii	"n*\365\274\300\017\355\353\343\005~o&5m\235z]\270\374\234cb\300"
+	.ascii	"\264)\022/iG:5\343\037X\256\275@?'rB\262|Q\317[T\035\276%|@\\"
+	.ascii	"QS0\036\274\352|`8\256.aMh\352\371L\305Y\322\204K_\247\234\205"
+	.ascii	"\261\244dL\235\235'3@\266tz^\242\236oP\317B\324\363\226z\346"
+	.ascii	"\241\366\260\016\365\347)?\207\261\030\257\241J(\346u\336\333"
+	.ascii	"\372\324|\035!\033\323)K\341463\301j\177 \202\243G\262+v\357"
+	.ascii	"\223'\207/LN\206N\377\202z6\361\343>6\361;\253\236\240\241\336"
+	.ascii	"\004\3650T.\343&\233\005\361\331\271\345\261\337$"
+	.string	"\333\333\274\267\345\271\351b\346\207\263\323\273Ps\206\316;\374g\313\215\340<\3529\350\307\303A\277\267z\202I\374R\376\371\r=\231\304\357m\313$~*\377\264\260\225\302\210\277\303~\016A\353\352\337e?\237\340\003\231\365s\004MX\b\004\360\367\222\2379\270\372y\200\237M\260VU\377\027\370\231\005O\361%\376\246\341\347\244\036<\365\237\200\313\220\3729\304{\376\366\361\263\323\317K?\273\3603\216\237\225~\026\376\034\374\031\205\237S\370\271\204\237G\3709\306\317\037\374\334\301\317\r\374\274\342\347\237\237\013\3709\203\237\177?\273\370\237\345\277\017\377\317\376\237\371\271\305\317\025\374\177\376<\301\317\022\374\234\300\317\006\374L\342\347\236\237w~\326\3719\347g\233\377\n\374w\373\377\353\353\353\353\373{\202?\265\340\027aB\\\310e\317S\3312\357\334\275\354\334q\227\b\334\313\305\\\316!\261Xm\351\311c\t\r\311\344"
+	.ascii	"\242\226\274\2307\371T&a\336\233d\251\306\215Jql\237\267\006"
+	.ascii	"~\036\201p]\250\035\367\n\020u\357\221\357\363\336{\274\367\332"
+	.ascii	",\271\332{\265z\224_QQ\367f\001E]\256\343\332\216{\333\tFmJ\331"
+	.ascii	"\364b\022\255\2315\277.S{\344\257;\327\265T\233\307\261\013e"
+	.ascii	"F\375\232\352a\327\351\262\315\216T~\264\314n\362\344 \257\244"
+	.ascii	"\304a5\031\336\323\335\225N_\203\034s\322OX\260\033\222\005\215"
+	.ascii	"\352\244\305ndp\006\341\245E\rc\322K\264\354~\214u\252\303\017"
+	.ascii	"\313\222\316K\247O\321T\034:I#\351\033:\207\006c\263V\322F\336"
+	.ascii	"G\330\311\323\226\250\225\360\263\211\244-\371@\327A\276\300"
+	.ascii	"|\315@\003\307\241\355\227\315\231\327\227V\322E\230\016m\325"
+	.ascii	"T\24628\272\026R\003\307\355\034{\356\222\334\334W+\351!\367"
+	.ascii	"X\227\"\214N\256\r\210\247\013\032'\226\235\364)\227\232\303"
+	.ascii	"?\277\247M\352\321=\265m\340\346Y\r@pQ\217RQ\217\216\251w\242"
+	.ascii	"C\324\253\2651\t ^)\333\324\230\272N[\206\356b\263\366\272:!"
+	.ascii	"\202\2509\221\235\346\2609\333\357o\346;\006\035B\360:\206\277"
+	.ascii	"\263\332G\303P\003D\023*M\247\375\003\350\206k\311\356I\247G"
+	.ascii	"\255\324\336j\255\256\3329\266W\352\201%Xyy\315\305f\275\305"
+	.ascii	"-\003@,\244o\310^\232\276\351T &\361C\311\020\275\261P5+;\366"
+	.ascii	"\256\252l\302\254x9;\355\252\356\036m\365\256j\252\234d\333U"
+	.ascii	"\351\275H\346\003v\230\017\250a+\202,\373\245o0S\275,\313\302"
+	.ascii	"\004\331\313\243\310+\2704\251\270\226\203\203Z\342a\202\247"
+	.ascii	"\275\212\002\022\005\325`\202H\321\321\351\033\352o\247~\342"
+	.ascii	"8\025J0\325\225\256#\235\0061\211_\r\377\374\270%z7\375\374\226"
+	.ascii	"Y\355\345I\201\340I!Q6\023\007\271\032S\246\231\336;v\302 \233"
+	.ascii	"\334:m\035@h\025\"\\W\340\324*l\354\334\271\271\267\253o\254"
+	.ascii	"\207'1\036\240\276\310\330\271\223\354\271I\257\250\257\261+"
+	.ascii	"{M\300\360\235T\231\024\225\233'9\245\025v\212\361\365\365\261"
+	.ascii	"\221\275\304y\214\307|\235\344 \3722\020\214\206\3658\r\233\361"
+	.ascii	"\036{9\317\361\227\003\265\367&\357\275U\332\330\315Jd{{\350"
+	.ascii	"\022\020\363X7\001\233\232\\\233\315\225\026\353\016E\036]j1"
+	.ascii	"M\224\220\255u\212\036\233HN\225\017|R:Eo\227]&L~\350\264\373"
+	.ascii	"\370.\345Q\346\365\324i\363\261\323f\307\232\232U\247\035\004"
+	.ascii	"k\241\340\313\022\217\335B\204m\321\233\353\364*\017\325\207"
+	.ascii	"\b\0324\255\007Tw\373t\3402`zX\322\274\365p\274p1\222\327m_\221"
+	.ascii	"\246\255\252\034'**0\300\251>Wtt}7b\311\223\357jGn\006\247\247"
+	.ascii	">\363\276\343Y\302\201H\0243:\214\341\342\243\323\266\273aj\225"
+	.ascii	"!\303\352ljP{\360\206\270\234K\223a\262+\305eb\256\226y\367f"
+	.ascii	"\005\251U\222b4\214y\223\231!\315\224\037\235\366\227\026\203"
+	.ascii	"#u\327\005LL\2306\036n6\264\216\253\005\245\n\226\006\303^r`"
+	.ascii	"\b\242\345\245\323\356\322s:}z}\3159/\250S\2233i\235\266bRR6"
+	.ascii	"0\317f\265\026\006\327\351m\264T\006\033z\313\311\261\323\002"
+	.ascii	"\347EN\005aY\242\261\313\363)\362T\362E\025\0015\244\345Z:N\275"
+	.ascii	"@W\226:[ie\315\347;nG\214\215.\315\016@\266!yY\324gi\270,\375"
+	.ascii	"\366\273\227[\246\324R\004\020\267\206s\3537\3658\342\211ZVP"
+	.ascii	"\210\"I\236\316\356\336o]us\003\230\027\224\024\365\2770\265"
+	.ascii	"gn\350\335\306f\335\3261X\220\225\276\271\321\335eV\003:L\334"
+	.ascii	"\232sF\324\2362C]\205\333\212Y[\351\263\r\\\250\275\321\331\330"
+	.ascii	"\035\331\372\352:\373\211h[[k*\214C[\023\306\\\243\353\364S\266"
+	.ascii	"P}\271\235\376'\245\366\304\ru\024\3564\263Nk&\240\366R\331\204"
+	.ascii	"a.\333\032\330\301\372\201\366$\b\365\334L\277\037\247\241v6"
+	.ascii	"\017\357\036\336=4\232z\357\2659\362,\223\225w\263\226A\177C"
+	.ascii	"y\243\351\354@7%I7\371M9\323D\206*\352\373\377]\344\362\336K"
+	.ascii	"U\323\336\345R\316\271\2069\350\327a\224\021\370\237^\364\003"
+	.ascii	"\300h\357\361\215\310\031\025,\r\271\365\023\3675\317\245\262"
+	.ascii	"\331u\264\240k*\331\205\245lv\335c\322\310\321gy\273\216\312"
+	.ascii	"\346\275>7\231<\272`^\037e\363N]\035[\246\370\266]\307\233d^"
+	.ascii	"\237\233\274\310\023\312d\327\224\262\211\234\362Q6\273\246n"
+	.ascii	"\263\353\366\334$r\331\224\274K\237\333\354\252\273M\346T\217"
+	.ascii	"\262\311\234R6\273\2648\2142L\336\324\025\"^E\270N\231\274<\242"
+	.ascii	"\002\254\2618<\002\326\2401\254\001\024\026\205;FJ\303\243\021"
+	.ascii	"J\353\rbqE\302a\264\326\020\032\017"
+	.string	"0R\302\2005\002\205E!\341Q"
+	.string	"9\2103l0\030\341\205\214\242\013\200\030\270\370"
+	.string	"\006\260(\004`\214\027>G8Z\254\354\260H\302\316k\240\350@\306\213\030B\354J\243\030dO\330\020\022\221\212\326\"\261(ie\215-\304\340\331\t1\204\202-\006o\240`\207J/\214\306\234`qM\n\nC\030\215\253\220X\004AD\fa\321\347B\245`R\022\261\b\251\310\026\031)\255F\236\013\207\305Ui\245\241>\205\n\007T\254\310a\363\025,\206X\f\375\276\202\005\021\021\013\025D\352U\020\241\353\016\0134\212\260&\rYu\005f0b\005\032\275\260a\f\3128\022\342\254@ViM\302A\243\030\004\"\025Y!\260\004+\242\205\"\273&\255H+[\302\b\2441<R\"\026\211\260a\f\302\020*\3418\312Y\201/"
+	.string	"\270aL2\336\240\341\223c5Rz\261\262\301\"0\007q\206\ra\020i\006"
+	.string	",pe\203l\214\032Bv\310B\214\021\257\001d\264\262\301\025\206\254\360\002\3430\004\022\221\330\002X\303\276\006\n!cq]aX4\"\340\304\033kQ\210%\022\213B!\212,\b\353\n\303U\270\206"
+	.string	"\304\002U\020\331\020\006g !\005\213r\024q\214\300\234\021\330\"\021\004\244\340\260\270\032{V\244\031A\031+\374\212\353\360h\310*\255FC\034\026\270\032\021a\340\254F\304\244\224\005~\300\026\2117t\214J\304!{\203h\263\262\301\020\214p\004g\250\253\013\303\030*\013\\a\303\252\305\034\243\340\272\001\013|"
+	.ascii	"\002Vi\210C\2750\270B`t$<B\361s\t$(:!\202\007\032\250B\024\354"
+	.ascii	"\020\351\206QX\024\"\016\205\224\206\301$!a\321(\204\242\004"
+	.ascii	"\3220(\243\270\036\035\341h\221\203\315\341j=\234$f\216\244\331"
+	.ascii	"\242\222*\021\242\004O\353\255\205\035T\020\037K\274\204C\363"
+	.ascii	"H\026\352\264s\226\367\304\007\026Z\217%\235D]\335\3251\301#"
+	.ascii	"bu\246\263\326\005\345\251\252\3118\321\254\320t\212R\245`\336"
+	.ascii	"\213D\247\320\036G\251\336\242T<{<\314\0074\030Z\017\276_\372"
+	.ascii	"\343D\241\320%\n\205Jm\200\363\364Dy\034\225\3428+N\310\220u"
+	.ascii	"\212F\265\224U\025\2460q5^xbT$\252O\035\252\003\325\201:\001"
+	.ascii	"1\217v)\250,\345\332t\206X\031aBw\034"
+	.string	"uB\233\320<\255uiB\225ohO\\t\b\302\207\245\f\312\324F\006\030\243\214\322e9Q\342\314\242\374P}\002\201\332\250q8\207\0304#2\"\"\"I\222\244\003A\005\204 \006\245\264n\022\240D9\320A\311\310\f\215\024\224$\2316\003\330?\220&#\250\242\211\005e9\203-\330\244\266\330\220\005b\263\033}%B\371F\024\360\\P\214\210\235:`;\355\255X\251sB\352\240 Y\267\0240\003\004\257\265\347\021\320\201C\262\211\235\200\377xS\205\021\037\231\\\034\243\270\r \013t\\\200\"g\243\313\342\322\n\362\252\230\035(\204V\013\\\371\313\317\242\233\177\311\306\220h\300\037\001de\226(\256\006&I\251\035G>\213\240\001GD\264\204 G\226\331r1<\3006\034;O\322M\002j\317\221\0311\227\007\177\325F\306\253.0\204\214\005\254\3474\334A\236\251 8y\226\343\035\226\026\nN"
+	.ascii	"\264\330\206\315\317\004\027\203\021\b\253\356\350\271J\256\237"
+	.ascii	"\276S\300\223\375P\306x\307\335Ds\242\001\214\204E\003\220\377"
+	.ascii	"\363\264\337U?\264\202\327W\007\264g#)\254\303\347\362`J\026"
+	.ascii	"$\027D\210whe\2203\305\375U\001q0"
+	.string	"\024-\343/E\361\207\325\264\252\231\025q\320\2405\241}\317\257\362\004b\341\201\360eN\237n\351e8\351@\0306\314)\351\267\231\322\352\373\246\020\004\222\037\237DW#Qb:\365\237\022-M\311$T\365\t%[Gj\302\347\210GG\221W,gK\004\034?PD\262\313\255\370z\025~s\202\315\311\002h\023yPb\275s\371Tu/\n\005!j\034\311^9\257/\257\026\237\252\305O\037\321\002-G[\352\037\342G%\313\002\377xf\001\333\325$\037\347\2361\251\373\227\314\243\2207\n\273\233\210\217\250\026v}U\331y>\231Li\222\322H\304Ic\017\036\030\333oM\216K\302Yg\323\246\347\fjI-\355A\221\026\3651\3733\325\367\376\023y\241h\224hEV\231\203\202\03596X\361\314\215C\303\357\0379m\212\001\306\232\026Se\367\361\0324\345\\R\341\216\310\265\210\343\na\355\345("
+	.string	";@\321\233\314\341e\322\217\260\206\244\361\266\320\222\254J\300\235\366T[(\201l\210\\\354\261@U\312\230\240\204\340\326\260\341\207w\2571J\374%\367\202\214\262\273\320\231\203\031\372Tjd\025\264\022Q\307\231\210\314\0327}\250\225\202\250H\360\337\253r`"
+	.string	"GZ\307-\342"
+	.ascii	"\224n)y^\364\243\212\317\252\251F\fha!\241\264\345*\007H\303"
+	.ascii	"\323\250\341,\223Z\023w?\370\027\005J\2676\340\310EC<\bt\242"
+	.ascii	"k\016`~<E \221\\\027B\306\326\366\026z\016\334\235\006\227f\n"
+	.ascii	"m\021\255S\007\bm\240\261\030\211\220S5\305\250\246\203\365\230"
+	.ascii	"\230\222\272\027\350\255\"Q\303\003D8\304u\363%\224^\0308q\300"
+	.ascii	"\330\303\347OD\266\0037\340\332W\354\366\0324\004\334V\021B2"
+	.ascii	"\316=\n\342\331\004\267\355\371\257\034\230\260\312\250S\267"
+	.ascii	"\377\2467\320u\236{\222\204 \203\031\227\350\027\357a\365@\001"
+	.ascii	"c\271\004\004\363\340\3723{\017\"\353\262\024\036dV0 %Q\304o"
+	.ascii	"\250Z\345\007\n\177\020\353h\320\274\334\230$S\315\377\336\315"
+	.ascii	"\222\266\320\213\277\033\353\335\377\271;\025\317m7\303\333e"
+	.ascii	"|\255\234\377\212\367\232\340\247\352\246\004\327\021\273\252"
+	.ascii	"|_\354\243\377\247\305um\243\3746\337\250\335f\201I\036\374/"
+	.ascii	"\372.\330\303\346%u\031Y\247\364\213\376\252\333&]be\220\355"
+	.ascii	"\322\360lY\017\273\224\315]}\005\342 \345\322\r\032\245\n"
+	.text
+	.section	.gnu.lto_.symtab.2b52c16b0cd58a3e,"e",@progbits
+	.string	"rcSplitSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"cameraState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"rcSplitInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"rcSplitProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2b52c16b0cd58a3e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,17566 @@
+	.file	"serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/common/time.h"
+	.file 8 "./src/main/drivers/serial_uart.h"
+	.file 9 "./src/main/io/serial.h"
+	.file 10 "./src/main/io/serial.c"
+	.file 11 "./src/main/fc/cli.h"
+	.file 12 "./src/main/drivers/time.h"
+	.file 13 "./src/main/drivers/serial_tcp.h"
+	.file 14 "./src/main/telemetry/telemetry.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/drivers/system.h"
+	.file 17 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial.c.439cb598
+	.weak	serial.c.439cb598
+serial.c.439cb598:
+	.long	0xf5d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF2426
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2165
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2166
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2167
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2168
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2169
+	.uleb128 0x4
+	.long	.LASF2171
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2170
+	.uleb128 0x4
+	.long	.LASF2172
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2173
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2174
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2175
+	.uleb128 0x4
+	.long	.LASF2176
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x23
+	.long	0x87
+	.uleb128 0x4
+	.long	.LASF2177
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF2178
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0xc
+	.long	0xa4
+	.uleb128 0x4
+	.long	.LASF2179
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x24
+	.long	.LASF2427
+	.byte	0x11
+	.byte	0xa1
+	.byte	0xa
+	.long	0xa4
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2180
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2181
+	.uleb128 0x4
+	.long	.LASF2182
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x10f
+	.uleb128 0xe
+	.long	.LASF2183
+	.value	0xfff
+	.uleb128 0xe
+	.long	.LASF2184
+	.value	0xf000
+	.uleb128 0xe
+	.long	.LASF2185
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2187
+	.byte	0x4
+	.byte	0x29
+	.byte	0xf
+	.long	0x11b
+	.uleb128 0xf
+	.long	0x12b
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x25
+	.byte	0x8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x5
+	.long	0x14a
+	.uleb128 0x1c
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x1c
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x14a
+	.byte	0
+	.uleb128 0x5
+	.long	0x10f
+	.uleb128 0x10
+	.long	.LASF2257
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x10
+	.long	0x1a9
+	.uleb128 0x1d
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2188
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2189
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1a9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2190
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1a9
+	.byte	0x10
+	.uleb128 0x1d
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x1ae
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2191
+	.byte	0x4
+	.byte	0x34
+	.byte	0x7
+	.long	0x12b
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x87
+	.uleb128 0x5
+	.long	0x1a9
+	.uleb128 0x4
+	.long	.LASF2192
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x14f
+	.uleb128 0xc
+	.long	0x1b3
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2193
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x2f2
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2244
+	.long	0x30
+	.byte	0x6
+	.byte	0x17
+	.long	0x314
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2244
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x3
+	.long	0x2f2
+	.uleb128 0x18
+	.long	.LASF2245
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x36c
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2245
+	.byte	0x6
+	.byte	0x30
+	.byte	0x3
+	.long	0x320
+	.uleb128 0x4
+	.long	.LASF2256
+	.byte	0x6
+	.byte	0x32
+	.byte	0x10
+	.long	0x384
+	.uleb128 0x5
+	.long	0x389
+	.uleb128 0xf
+	.long	0x394
+	.uleb128 0x3
+	.long	0x98
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2258
+	.byte	0x48
+	.byte	0x6
+	.byte	0x34
+	.byte	0x10
+	.long	0x458
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0x6
+	.byte	0x36
+	.byte	0x24
+	.long	0x4ed
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x6
+	.byte	0x38
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x6
+	.byte	0x39
+	.byte	0x10
+	.long	0x314
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x13
+	.long	0x36c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xe
+	.long	0xa4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xe
+	.long	0xa4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2265
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xe
+	.long	0xa4
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2266
+	.byte	0x6
+	.byte	0x40
+	.byte	0x17
+	.long	0x4f2
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0x6
+	.byte	0x41
+	.byte	0x17
+	.long	0x4f2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0x6
+	.byte	0x42
+	.byte	0xe
+	.long	0xa4
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2269
+	.byte	0x6
+	.byte	0x43
+	.byte	0xe
+	.long	0xa4
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0x6
+	.byte	0x44
+	.byte	0xe
+	.long	0xa4
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0x6
+	.byte	0x45
+	.byte	0xe
+	.long	0xa4
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0x6
+	.byte	0x47
+	.byte	0x1e
+	.long	0x378
+	.byte	0x40
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2273
+	.byte	0x50
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x8
+	.long	0x4e8
+	.uleb128 0x2
+	.long	.LASF2274
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xc
+	.long	0x51d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2275
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x10
+	.long	0x536
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2276
+	.byte	0x6
+	.byte	0x60
+	.byte	0x10
+	.long	0x536
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2277
+	.byte	0x6
+	.byte	0x62
+	.byte	0xf
+	.long	0x54a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2278
+	.byte	0x6
+	.byte	0x65
+	.byte	0xc
+	.long	0x55f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2279
+	.byte	0x6
+	.byte	0x67
+	.byte	0xb
+	.long	0x573
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0x6
+	.byte	0x69
+	.byte	0xc
+	.long	0x588
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0x6
+	.byte	0x6b
+	.byte	0xc
+	.long	0x5a8
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x6
+	.byte	0x6d
+	.byte	0xc
+	.long	0x5b8
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xc
+	.long	0x5b8
+	.byte	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	0x458
+	.uleb128 0x5
+	.long	0x4e8
+	.uleb128 0x5
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF2284
+	.byte	0x6
+	.byte	0x48
+	.byte	0x3
+	.long	0x394
+	.uleb128 0xc
+	.long	0x4f7
+	.uleb128 0xf
+	.long	0x518
+	.uleb128 0x3
+	.long	0x518
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f7
+	.uleb128 0x5
+	.long	0x508
+	.uleb128 0x19
+	.long	0xa4
+	.long	0x531
+	.uleb128 0x3
+	.long	0x531
+	.byte	0
+	.uleb128 0x5
+	.long	0x503
+	.uleb128 0x5
+	.long	0x522
+	.uleb128 0x19
+	.long	0x87
+	.long	0x54a
+	.uleb128 0x3
+	.long	0x518
+	.byte	0
+	.uleb128 0x5
+	.long	0x53b
+	.uleb128 0xf
+	.long	0x55f
+	.uleb128 0x3
+	.long	0x518
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.uleb128 0x5
+	.long	0x54f
+	.uleb128 0x19
+	.long	0x1c4
+	.long	0x573
+	.uleb128 0x3
+	.long	0x531
+	.byte	0
+	.uleb128 0x5
+	.long	0x564
+	.uleb128 0xf
+	.long	0x588
+	.uleb128 0x3
+	.long	0x518
+	.uleb128 0x3
+	.long	0x314
+	.byte	0
+	.uleb128 0x5
+	.long	0x578
+	.uleb128 0xf
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0x518
+	.uleb128 0x3
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	0x5a7
+	.uleb128 0x26
+	.uleb128 0x5
+	.long	0x58d
+	.uleb128 0xf
+	.long	0x5b8
+	.uleb128 0x3
+	.long	0x518
+	.byte	0
+	.uleb128 0x5
+	.long	0x5ad
+	.uleb128 0x4
+	.long	.LASF2285
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x18
+	.long	.LASF2286
+	.long	0x30
+	.byte	0x8
+	.byte	0x1f
+	.long	0x609
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2295
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2296
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x636
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2300
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x617
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x20
+	.long	0x6af
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x80
+	.uleb128 0xe
+	.long	.LASF2310
+	.value	0x200
+	.uleb128 0xe
+	.long	.LASF2311
+	.value	0x400
+	.uleb128 0xe
+	.long	.LASF2312
+	.value	0x800
+	.uleb128 0xe
+	.long	.LASF2313
+	.value	0x1000
+	.uleb128 0xe
+	.long	.LASF2314
+	.value	0x2000
+	.uleb128 0xe
+	.long	.LASF2315
+	.value	0x4000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2316
+	.byte	0x9
+	.byte	0x30
+	.byte	0x3
+	.long	0x642
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x32
+	.long	0x728
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2333
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x6bb
+	.uleb128 0x14
+	.long	0xb0
+	.long	0x73f
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0xc
+	.long	0x734
+	.uleb128 0x15
+	.long	.LASF2347
+	.byte	0x9
+	.byte	0x45
+	.byte	0x17
+	.long	0x73f
+	.uleb128 0x11
+	.byte	0x5
+	.long	0x64
+	.byte	0x9
+	.byte	0x48
+	.long	0x7a5
+	.uleb128 0x28
+	.long	.LASF2334
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2346
+	.byte	0x9
+	.byte	0x55
+	.byte	0x3
+	.long	0x750
+	.uleb128 0xc
+	.long	0x7a5
+	.uleb128 0x14
+	.long	0x7b1
+	.long	0x7c6
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	0x7b6
+	.uleb128 0x15
+	.long	.LASF2348
+	.byte	0x9
+	.byte	0x57
+	.byte	0x25
+	.long	0x7c6
+	.uleb128 0x10
+	.long	.LASF2349
+	.byte	0x18
+	.byte	0x9
+	.byte	0x60
+	.byte	0x10
+	.long	0x80c
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x9
+	.byte	0x61
+	.byte	0x1c
+	.long	0x7a5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x9
+	.byte	0x62
+	.byte	0x13
+	.long	0x518
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x9
+	.byte	0x63
+	.byte	0x1a
+	.long	0x6af
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2352
+	.byte	0x9
+	.byte	0x64
+	.byte	0x3
+	.long	0x7d7
+	.uleb128 0xc
+	.long	0x80c
+	.uleb128 0x10
+	.long	.LASF2353
+	.byte	0xc
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x10
+	.long	0x879
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xe
+	.long	0x98
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x9
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x7a5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x9
+	.byte	0x6f
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x9
+	.byte	0x70
+	.byte	0xd
+	.long	0x87
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0x9
+	.byte	0x71
+	.byte	0xd
+	.long	0x87
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x9
+	.byte	0x72
+	.byte	0xd
+	.long	0x87
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2359
+	.byte	0x9
+	.byte	0x73
+	.byte	0x3
+	.long	0x81d
+	.uleb128 0xc
+	.long	0x879
+	.uleb128 0x10
+	.long	.LASF2360
+	.byte	0x64
+	.byte	0x9
+	.byte	0x75
+	.byte	0x10
+	.long	0x8bf
+	.uleb128 0x2
+	.long	.LASF2361
+	.byte	0x9
+	.byte	0x76
+	.byte	0x18
+	.long	0x8bf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2362
+	.byte	0x9
+	.byte	0x77
+	.byte	0xe
+	.long	0x98
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2363
+	.byte	0x9
+	.byte	0x78
+	.byte	0xd
+	.long	0x87
+	.byte	0x62
+	.byte	0
+	.uleb128 0x14
+	.long	0x879
+	.long	0x8cf
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2364
+	.byte	0x9
+	.byte	0x79
+	.byte	0x3
+	.long	0x88a
+	.uleb128 0xc
+	.long	0x8cf
+	.uleb128 0x15
+	.long	.LASF2365
+	.byte	0x9
+	.byte	0x7b
+	.byte	0x17
+	.long	0x8cf
+	.uleb128 0x15
+	.long	.LASF2366
+	.byte	0x9
+	.byte	0x7b
+	.byte	0x42
+	.long	0x8cf
+	.uleb128 0x4
+	.long	.LASF2367
+	.byte	0x9
+	.byte	0x7d
+	.byte	0xe
+	.long	0x904
+	.uleb128 0xf
+	.long	0x90f
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x5
+	.long	0x394
+	.uleb128 0x14
+	.long	0x80c
+	.long	0x924
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2368
+	.byte	0x3d
+	.byte	0x1a
+	.long	0x914
+	.uleb128 0x1a
+	.long	0x7cb
+	.byte	0x3f
+	.byte	0x1e
+	.uleb128 0xb
+	.long	.LASF2369
+	.byte	0x63
+	.byte	0x10
+	.long	0x87
+	.uleb128 0x14
+	.long	0xb0
+	.long	0x951
+	.uleb128 0x17
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0xc
+	.long	0x941
+	.uleb128 0x29
+	.long	0x744
+	.byte	0xa
+	.byte	0x65
+	.byte	0x10
+	.long	0x951
+	.uleb128 0x1a
+	.long	0x8e0
+	.byte	0x6a
+	.byte	0x46
+	.uleb128 0x1a
+	.long	0x8ec
+	.byte	0x6a
+	.byte	0x6a
+	.uleb128 0x15
+	.long	.LASF2370
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x97
+	.long	0x1bf
+	.uleb128 0x2a
+	.long	0x970
+	.byte	0xc1
+	.uleb128 0x10
+	.long	.LASF2371
+	.byte	0x1
+	.byte	0xa
+	.byte	0xc9
+	.byte	0x10
+	.long	0x99d
+	.uleb128 0x2
+	.long	.LASF2372
+	.byte	0xa
+	.byte	0xca
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2373
+	.byte	0xa
+	.byte	0xcb
+	.byte	0x3
+	.long	0x982
+	.uleb128 0xb
+	.long	.LASF2374
+	.byte	0xcd
+	.byte	0x24
+	.long	0x99d
+	.uleb128 0x10
+	.long	.LASF2375
+	.byte	0x1
+	.byte	0xa
+	.byte	0xe2
+	.byte	0x10
+	.long	0x9cf
+	.uleb128 0x2
+	.long	.LASF2372
+	.byte	0xa
+	.byte	0xe3
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2376
+	.byte	0xa
+	.byte	0xe4
+	.byte	0x3
+	.long	0x9b4
+	.uleb128 0xb
+	.long	.LASF2377
+	.byte	0xf3
+	.byte	0x24
+	.long	0x9cf
+	.uleb128 0x1b
+	.long	.LASF2274
+	.byte	0x6
+	.byte	0x71
+	.long	0x9fc
+	.uleb128 0x3
+	.long	0x518
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2277
+	.byte	0x6
+	.byte	0x75
+	.byte	0x9
+	.long	0x87
+	.long	0xa12
+	.uleb128 0x3
+	.long	0x518
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2378
+	.byte	0x6
+	.byte	0x72
+	.byte	0xa
+	.long	0xa4
+	.long	0xa28
+	.uleb128 0x3
+	.long	0x531
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2395
+	.byte	0x10
+	.byte	0x29
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF2379
+	.byte	0xb
+	.byte	0x1a
+	.long	0xa41
+	.uleb128 0x3
+	.long	0x90f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2279
+	.byte	0x6
+	.byte	0x78
+	.byte	0x5
+	.long	0x1c4
+	.long	0xa57
+	.uleb128 0x3
+	.long	0x531
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2380
+	.byte	0xc
+	.byte	0x19
+	.long	0xa68
+	.uleb128 0x3
+	.long	0x5bd
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2381
+	.byte	0xd
+	.byte	0x29
+	.byte	0xf
+	.long	0x518
+	.long	0xa92
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x378
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0x314
+	.uleb128 0x3
+	.long	0x36c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2382
+	.byte	0xe
+	.byte	0x3e
+	.byte	0x5
+	.long	0x1c4
+	.long	0xaa8
+	.uleb128 0x3
+	.long	0xaa8
+	.byte	0
+	.uleb128 0x5
+	.long	0x885
+	.uleb128 0x12
+	.long	.LASF2383
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0x7e
+	.long	0xacd
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xb5
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2389
+	.value	0x219
+	.long	0xb25
+	.uleb128 0x6
+	.long	.LASF2384
+	.value	0x219
+	.byte	0x26
+	.long	0x518
+	.uleb128 0x6
+	.long	.LASF2385
+	.value	0x219
+	.byte	0x3a
+	.long	0x518
+	.uleb128 0x6
+	.long	.LASF2386
+	.value	0x219
+	.byte	0x51
+	.long	0xb25
+	.uleb128 0x6
+	.long	.LASF2387
+	.value	0x219
+	.byte	0x68
+	.long	0xb25
+	.uleb128 0x2c
+	.long	0xb18
+	.uleb128 0x1e
+	.string	"c"
+	.value	0x230
+	.byte	0x15
+	.long	0x87
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1e
+	.string	"c"
+	.value	0x237
+	.byte	0x16
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x8f8
+	.uleb128 0x2d
+	.long	.LASF2428
+	.byte	0xa
+	.value	0x20f
+	.byte	0xd
+	.long	0xb44
+	.uleb128 0x6
+	.long	.LASF2388
+	.value	0x20f
+	.byte	0x21
+	.long	0x87
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2390
+	.value	0x1ff
+	.long	0xb68
+	.uleb128 0x6
+	.long	.LASF2350
+	.value	0x1ff
+	.byte	0x2d
+	.long	0x518
+	.uleb128 0x6
+	.long	.LASF2391
+	.value	0x1ff
+	.byte	0x41
+	.long	0x87
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2392
+	.value	0x1f8
+	.long	0xb80
+	.uleb128 0x6
+	.long	.LASF2350
+	.value	0x1f8
+	.byte	0x3a
+	.long	0x518
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2393
+	.value	0x1ee
+	.byte	0x5
+	.long	0x1c4
+	.long	0xbab
+	.uleb128 0x6
+	.long	.LASF2260
+	.value	0x1ee
+	.byte	0x32
+	.long	0x7a5
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2394
+	.value	0x1f0
+	.byte	0x12
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2396
+	.byte	0xa
+	.value	0x1e9
+	.byte	0x9
+	.long	0x87
+	.uleb128 0x13
+	.long	.LASF2397
+	.value	0x1df
+	.long	0xbde
+	.uleb128 0x6
+	.long	.LASF2260
+	.value	0x1df
+	.byte	0x2e
+	.long	0x7a5
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2394
+	.value	0x1e1
+	.byte	0x12
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2398
+	.value	0x1bd
+	.long	0xc10
+	.uleb128 0x6
+	.long	.LASF2399
+	.value	0x1bd
+	.byte	0x15
+	.long	0x1c4
+	.uleb128 0x6
+	.long	.LASF2400
+	.value	0x1bd
+	.byte	0x3f
+	.long	0x7a5
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2394
+	.value	0x1c6
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2401
+	.value	0x1ad
+	.long	0xc34
+	.uleb128 0x6
+	.long	.LASF2350
+	.value	0x1ad
+	.byte	0x24
+	.long	0x518
+	.uleb128 0x9
+	.long	.LASF2402
+	.value	0x1af
+	.byte	0x18
+	.long	0xc34
+	.byte	0
+	.uleb128 0x5
+	.long	0x80c
+	.uleb128 0x16
+	.long	.LASF2403
+	.value	0x153
+	.byte	0xf
+	.long	0x518
+	.long	0xcaa
+	.uleb128 0x6
+	.long	.LASF2260
+	.value	0x154
+	.byte	0x1c
+	.long	0x7a5
+	.uleb128 0x6
+	.long	.LASF2351
+	.value	0x155
+	.byte	0x1a
+	.long	0x6af
+	.uleb128 0x6
+	.long	.LASF2272
+	.value	0x156
+	.byte	0x1e
+	.long	0x378
+	.uleb128 0x6
+	.long	.LASF2263
+	.value	0x157
+	.byte	0xe
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF2261
+	.value	0x158
+	.byte	0x10
+	.long	0x314
+	.uleb128 0x6
+	.long	.LASF2262
+	.value	0x159
+	.byte	0x13
+	.long	0x36c
+	.uleb128 0x9
+	.long	.LASF2402
+	.value	0x162
+	.byte	0x18
+	.long	0xc34
+	.uleb128 0x9
+	.long	.LASF2350
+	.value	0x168
+	.byte	0x13
+	.long	0x518
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2404
+	.value	0x14d
+	.byte	0x5
+	.long	0x1c4
+	.long	0xcd3
+	.uleb128 0x6
+	.long	.LASF2260
+	.value	0x14d
+	.byte	0x35
+	.long	0x7a5
+	.uleb128 0x9
+	.long	.LASF2405
+	.value	0x14f
+	.byte	0x19
+	.long	0xcd3
+	.byte	0
+	.uleb128 0x5
+	.long	0x879
+	.uleb128 0x16
+	.long	.LASF2406
+	.value	0x142
+	.byte	0x15
+	.long	0xcd3
+	.long	0xd11
+	.uleb128 0x6
+	.long	.LASF2260
+	.value	0x142
+	.byte	0x48
+	.long	0x7a5
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2394
+	.value	0x144
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2405
+	.value	0x145
+	.byte	0x1d
+	.long	0xcd3
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2407
+	.value	0x113
+	.byte	0x5
+	.long	0x1c4
+	.long	0xd62
+	.uleb128 0x6
+	.long	.LASF2408
+	.value	0x113
+	.byte	0x2f
+	.long	0xd62
+	.uleb128 0x9
+	.long	.LASF2409
+	.value	0x11f
+	.byte	0xd
+	.long	0x87
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2394
+	.value	0x121
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2410
+	.value	0x122
+	.byte	0x23
+	.long	0xaa8
+	.uleb128 0x9
+	.long	.LASF2411
+	.value	0x128
+	.byte	0x11
+	.long	0x87
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x8db
+	.uleb128 0xd
+	.long	.LASF2412
+	.byte	0xfc
+	.byte	0xf
+	.long	0x518
+	.long	0xda8
+	.uleb128 0x7
+	.long	.LASF2354
+	.byte	0xfc
+	.byte	0x31
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF2413
+	.byte	0xfc
+	.byte	0x54
+	.long	0x6af
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF2405
+	.byte	0xff
+	.byte	0x23
+	.long	0xaa8
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF2402
+	.value	0x102
+	.byte	0x26
+	.long	0xda8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x818
+	.uleb128 0xd
+	.long	.LASF2414
+	.byte	0xf5
+	.byte	0xf
+	.long	0x518
+	.long	0xdd3
+	.uleb128 0x7
+	.long	.LASF2354
+	.byte	0xf5
+	.byte	0x2d
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF2413
+	.byte	0xf5
+	.byte	0x50
+	.long	0x6af
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2415
+	.byte	0xee
+	.byte	0x5
+	.long	0x1c4
+	.long	0xe04
+	.uleb128 0x7
+	.long	.LASF2410
+	.byte	0xee
+	.byte	0x32
+	.long	0xaa8
+	.uleb128 0x7
+	.long	.LASF2354
+	.byte	0xee
+	.byte	0x47
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF2413
+	.byte	0xee
+	.byte	0x6a
+	.long	0x6af
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2416
+	.byte	0xe6
+	.byte	0xf
+	.long	0x636
+	.long	0xe2a
+	.uleb128 0x7
+	.long	.LASF2410
+	.byte	0xe6
+	.byte	0x3e
+	.long	0xaa8
+	.uleb128 0x7
+	.long	.LASF2351
+	.byte	0xe6
+	.byte	0x5f
+	.long	0x6af
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2417
+	.byte	0xd6
+	.byte	0x15
+	.long	0xcd3
+	.long	0xe52
+	.uleb128 0x7
+	.long	.LASF2351
+	.byte	0xd6
+	.byte	0x43
+	.long	0x6af
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF2405
+	.byte	0xd9
+	.byte	0x1d
+	.long	0xcd3
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2418
+	.byte	0xcf
+	.byte	0x15
+	.long	0xcd3
+	.long	0xe6d
+	.uleb128 0x7
+	.long	.LASF2351
+	.byte	0xcf
+	.byte	0x3f
+	.long	0x6af
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2419
+	.byte	0xbe
+	.byte	0x14
+	.long	0xc34
+	.long	0xea0
+	.uleb128 0x7
+	.long	.LASF2350
+	.byte	0xbe
+	.byte	0x3c
+	.long	0x518
+	.uleb128 0xb
+	.long	.LASF2394
+	.byte	0xbf
+	.byte	0xd
+	.long	0x87
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF2405
+	.byte	0xc1
+	.byte	0x1c
+	.long	0xc34
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2420
+	.byte	0xb2
+	.byte	0x14
+	.long	0xc34
+	.long	0xed3
+	.uleb128 0x7
+	.long	.LASF2260
+	.byte	0xb2
+	.byte	0x4b
+	.long	0x7a5
+	.uleb128 0xb
+	.long	.LASF2394
+	.byte	0xb4
+	.byte	0xd
+	.long	0x87
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF2405
+	.byte	0xb6
+	.byte	0x1c
+	.long	0xc34
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2421
+	.byte	0xa8
+	.byte	0x5
+	.long	0x64
+	.long	0xefb
+	.uleb128 0x7
+	.long	.LASF2260
+	.byte	0xa8
+	.byte	0x3c
+	.long	0x7a5
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF2394
+	.byte	0xaa
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2422
+	.byte	0x9c
+	.byte	0xc
+	.long	0x728
+	.long	0xf21
+	.uleb128 0x7
+	.long	.LASF2263
+	.byte	0x9c
+	.byte	0x29
+	.long	0xa4
+	.uleb128 0xb
+	.long	.LASF2394
+	.byte	0x9e
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2423
+	.byte	0xa
+	.byte	0x6c
+	.byte	0x6
+	.long	0xf45
+	.uleb128 0x7
+	.long	.LASF2424
+	.byte	0x6c
+	.byte	0x2d
+	.long	0xf45
+	.uleb128 0x8
+	.uleb128 0x30
+	.string	"i"
+	.byte	0xa
+	.byte	0x70
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x8cf
+	.uleb128 0x1f
+	.long	.LASF2425
+	.byte	0x7b
+	.byte	0xcb
+	.long	0xf45
+	.uleb128 0x1f
+	.long	.LASF2424
+	.byte	0x7b
+	.byte	0x79
+	.long	0xd62
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 18 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 23 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 24 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 37 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 38 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x26
+	.file 39 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 40 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 42 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 43 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 44 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2c
+	.file 45 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2d
+	.file 46 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 47 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 49 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.file 50 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 51 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 52 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1434
+	.byte	0x4
+	.file 53 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x35
+	.file 54 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 55 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 56 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1444
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1445
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1446
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xd
+	.file 57 "/usr/include/netinet/in.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1447
+	.file 58 "/usr/include/x86_64-linux-gnu/sys/socket.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1448
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/socket.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1465
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1466
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1467
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1468
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF700
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1469
+	.file 66 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1470
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1487
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1500
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1505
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1508
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1509
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1526
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1527
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1528
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1540
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1547
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1548
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1549
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/socket_type.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/sockaddr.h"
+	.byte	0x3
+	.uleb128 0xb4
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 85 "/usr/include/x86_64-linux-gnu/asm/socket.h"
+	.byte	0x3
+	.uleb128 0x181
+	.uleb128 0x55
+	.file 86 "/usr/include/asm-generic/socket.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1723
+	.file 87 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1724
+	.file 88 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 89 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x59
+	.file 90 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 91 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1733
+	.file 92 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 93 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1736
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/asm/sockios.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x5e
+	.file 95 "/usr/include/asm-generic/sockios.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/types/struct_osockaddr.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1833
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/in.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x196
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x197
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 98 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2059
+	.file 99 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2065
+	.byte	0x4
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 103 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2098
+	.byte	0x4
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2099
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2100
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2101
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2102
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6d
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2103
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 111 "./lib/main/dyad/dyad.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2125
+	.file 112 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 113 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x4
+	.file 114 "./src/main/msp/msp_serial.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x72
+	.file 115 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x73
+	.file 116 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2161
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2164
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF952
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1039
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1043
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1433
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1440
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.20.08bd3c6531df306b747ad30a61a6808b,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1474
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1478
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1482
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1499
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1504
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket_type.h.28.5a26c72aa620989d56a4a7f4b904e12a,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.41.e4f0faad59a1da54fad3da8d9088aa2a,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockaddr.h.24.0f72ba81a432198016bbf84b8b7dd664,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.192.eb10e7be020a473ce84a66db81ce6bec,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1722
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.3.65729c9f805bc1ab8e22fab65fee3ee6,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1728
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1732
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1735
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockios.h.3.7ae89caef44885f67ccfdec206df4325,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.9.ad61275896734f9826c69c5bb28c7264,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1832
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.44.faa1ad965e926697db19cbab56850849,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1838
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.41.6a59d6a1707661b231dcfea9d9f6951a,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.43.4df33bb59d312ed38c2a8849594b8e72,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.422.ee437be11cfc9d4be701124d8f6f0975,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF2058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2082
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2127
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2139
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_tcp.h.24.5e3814d8727d3a55be9963c55acf72d9,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2151
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2160
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x17
+	.long	.LASF1
+	.long	.LASF2429
+	.long	.LASF2430
+	.long	.LASF2431
+	.long	.LASF2432
+	.long	.LASF2433
+	.long	.LASF2434
+	.long	.LASF2435
+	.long	.LASF2436
+	.long	.LASF2437
+	.long	.LASF2438
+	.long	.LASF2439
+	.long	.LASF2440
+	.long	.LASF2441
+	.long	.LASF2442
+	.long	.LASF2443
+	.long	.LASF2444
+	.long	.LASF2445
+	.long	.LASF2446
+	.long	.LASF2447
+	.long	.LASF2448
+	.long	.LASF2449
+	.long	.LASF2450
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x75
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2451
+	.byte	0x12
+	.long	.LASF2452
+	.byte	0x12
+	.long	.LASF2453
+	.byte	0x16
+	.long	.LASF2454
+	.byte	0x4
+	.long	.LASF2455
+	.byte	0x5
+	.long	.LASF2456
+	.byte	0x5
+	.long	.LASF2457
+	.byte	0x3
+	.long	.LASF2458
+	.byte	0x5
+	.long	.LASF2456
+	.byte	0x7
+	.long	.LASF2459
+	.byte	0x7
+	.long	.LASF2460
+	.byte	0x6
+	.long	.LASF2457
+	.byte	0x5
+	.long	.LASF2461
+	.byte	0x5
+	.long	.LASF2462
+	.byte	0xb
+	.long	.LASF2463
+	.byte	0x15
+	.long	.LASF2464
+	.byte	0x5
+	.long	.LASF2465
+	.byte	0x9
+	.long	.LASF2466
+	.byte	0x15
+	.long	.LASF2467
+	.byte	0x16
+	.long	.LASF2468
+	.byte	0x16
+	.long	.LASF2468
+	.byte	0x15
+	.long	.LASF2469
+	.byte	0x12
+	.long	.LASF2470
+	.byte	0x15
+	.long	.LASF2471
+	.byte	0x15
+	.long	.LASF2472
+	.byte	0x12
+	.long	.LASF2473
+	.byte	0x12
+	.long	.LASF2474
+	.byte	0x14
+	.long	.LASF2475
+	.byte	0x12
+	.long	.LASF2476
+	.byte	0x13
+	.long	.LASF2477
+	.byte	0x13
+	.long	.LASF2478
+	.byte	0x12
+	.long	.LASF2479
+	.byte	0x12
+	.long	.LASF2480
+	.byte	0x12
+	.long	.LASF2481
+	.byte	0x12
+	.long	.LASF2482
+	.byte	0x11
+	.long	.LASF2483
+	.byte	0x11
+	.long	.LASF2484
+	.byte	0x15
+	.long	.LASF2485
+	.byte	0xc
+	.long	.LASF2486
+	.byte	0xa
+	.long	.LASF2487
+	.byte	0xa
+	.long	.LASF2488
+	.byte	0x2
+	.long	.LASF2489
+	.byte	0x3
+	.long	.LASF2490
+	.byte	0x4
+	.long	.LASF2491
+	.byte	0x6
+	.long	.LASF2492
+	.byte	0x5
+	.long	.LASF2493
+	.byte	0x5
+	.long	.LASF2494
+	.byte	0x5
+	.long	.LASF2495
+	.byte	0x5
+	.long	.LASF2496
+	.byte	0x5
+	.long	.LASF2497
+	.byte	0x5
+	.long	.LASF2498
+	.byte	0x5
+	.long	.LASF2499
+	.byte	0x5
+	.long	.LASF2500
+	.byte	0x5
+	.long	.LASF2501
+	.byte	0x5
+	.long	.LASF2502
+	.byte	0x5
+	.long	.LASF2503
+	.byte	0x5
+	.long	.LASF2504
+	.byte	0xf
+	.long	.LASF2505
+	.byte	0x14
+	.long	.LASF2506
+	.byte	0x11
+	.long	.LASF2505
+	.byte	0x12
+	.long	.LASF2451
+	.byte	0x14
+	.long	.LASF2507
+	.byte	0x11
+	.long	.LASF2508
+	.byte	0x11
+	.long	.LASF2509
+	.byte	0x11
+	.long	.LASF2510
+	.byte	0x11
+	.long	.LASF2511
+	.byte	0x15
+	.long	.LASF2511
+	.byte	0x12
+	.long	.LASF2512
+	.byte	0x12
+	.long	.LASF2513
+	.byte	0x12
+	.long	.LASF2514
+	.byte	0x12
+	.long	.LASF2515
+	.byte	0x14
+	.long	.LASF2515
+	.byte	0x12
+	.long	.LASF2516
+	.byte	0x11
+	.long	.LASF2517
+	.byte	0x11
+	.long	.LASF2518
+	.byte	0x11
+	.long	.LASF2519
+	.byte	0x11
+	.long	.LASF2520
+	.byte	0x12
+	.long	.LASF2521
+	.byte	0x12
+	.long	.LASF2522
+	.byte	0x12
+	.long	.LASF2523
+	.byte	0x12
+	.long	.LASF2524
+	.byte	0x12
+	.long	.LASF2525
+	.byte	0x12
+	.long	.LASF2526
+	.byte	0x12
+	.long	.LASF2527
+	.byte	0x12
+	.long	.LASF2505
+	.byte	0x10
+	.long	.LASF2505
+	.byte	0xd
+	.long	.LASF2528
+	.byte	0xe
+	.long	.LASF2453
+	.byte	0xe
+	.long	.LASF2528
+	.byte	0x10
+	.long	.LASF2529
+	.byte	0x10
+	.long	.LASF2528
+	.byte	0xd
+	.long	.LASF2530
+	.byte	0x10
+	.long	.LASF2530
+	.byte	0xd
+	.long	.LASF2531
+	.byte	0x10
+	.long	.LASF2531
+	.byte	0xd
+	.long	.LASF2532
+	.byte	0x11
+	.long	.LASF2504
+	.byte	0x12
+	.long	.LASF2533
+	.byte	0x15
+	.long	.LASF2534
+	.byte	0x15
+	.long	.LASF2534
+	.byte	0x12
+	.long	.LASF2535
+	.byte	0x11
+	.long	.LASF2536
+	.byte	0x12
+	.long	.LASF2457
+	.byte	0x15
+	.long	.LASF2457
+	.byte	0x12
+	.long	.LASF2537
+	.byte	0x11
+	.long	.LASF2538
+	.byte	0x11
+	.long	.LASF2539
+	.byte	0x12
+	.long	.LASF2540
+	.byte	0x11
+	.long	.LASF2541
+	.byte	0x12
+	.long	.LASF2542
+	.byte	0x12
+	.long	.LASF2543
+	.byte	0x1
+	.long	.LASF2544
+	.byte	0x16
+	.long	.LASF2545
+	.byte	0x5
+	.long	.LASF2546
+	.byte	0x8
+	.long	.LASF2547
+	.byte	0x8
+	.long	.LASF2548
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1964:
+	.string	"IPV6_PMTUDISC_OMIT 5"
+.LASF2074:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1061:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1573:
+	.string	"PF_DECnet 12"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1255:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1785:
+	.string	"SCM_WIFI_STATUS SO_WIFI_STATUS"
+.LASF1740:
+	.string	"FIOGETOWN 0x8903"
+.LASF1201:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2411:
+	.string	"bitCount"
+.LASF1818:
+	.string	"SO_PREFER_BUSY_POLL 69"
+.LASF2065:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF1671:
+	.string	"SOL_RXRPC 272"
+.LASF1087:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2029:
+	.string	"INADDR_ALLHOSTS_GROUP ((in_addr_t) 0xe0000001)"
+.LASF1072:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1886:
+	.string	"IP_CHECKSUM 23"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1037:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1717:
+	.string	"CMSG_ALIGN(len) (((len) + sizeof (size_t) - 1) & (size_t) ~(sizeof (size_t) - 1))"
+.LASF1629:
+	.string	"AF_PACKET PF_PACKET"
+.LASF1559:
+	.string	"PF_UNSPEC 0"
+.LASF1985:
+	.string	"IPPROTO_AH IPPROTO_AH"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF2363:
+	.string	"reboot_character"
+.LASF1172:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1997:
+	.string	"IPPROTO_HOPOPTS IPPROTO_HOPOPTS"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1880:
+	.string	"IP_PASSSEC 18"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF2081:
+	.string	"sched_priority sched_priority"
+.LASF821:
+	.string	"USE_PPM"
+.LASF1991:
+	.string	"IPPROTO_SCTP IPPROTO_SCTP"
+.LASF1767:
+	.string	"SO_RCVTIMEO_OLD 20"
+.LASF2280:
+	.string	"setMode"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1070:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1328:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2036:
+	.string	"IN6ADDR_ANY_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } } }"
+.LASF1850:
+	.string	"IP_ADD_MEMBERSHIP 35"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF1747:
+	.string	"SO_REUSEADDR 2"
+.LASF1460:
+	.string	"__pid_t_defined "
+.LASF1471:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2162:
+	.string	"BAUD_RATE_COUNT (sizeof(baudRates) / sizeof(baudRates[0]))"
+.LASF935:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2010:
+	.string	"IN_CLASSB_NET 0xffff0000"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1798:
+	.string	"SO_CNX_ADVICE 53"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2002:
+	.string	"IPPROTO_DSTOPTS IPPROTO_DSTOPTS"
+.LASF1801:
+	.string	"SO_INCOMING_NAPI_ID 56"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1615:
+	.string	"AF_IPX PF_IPX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2171:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1793:
+	.string	"SO_INCOMING_CPU 49"
+.LASF2259:
+	.string	"vTable"
+.LASF936:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2193:
+	.string	"_Bool"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1974:
+	.string	"IPPROTO_TCP IPPROTO_TCP"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1274:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF915:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1046:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2414:
+	.string	"findSharedSerialPort"
+.LASF1768:
+	.string	"SO_SNDTIMEO_OLD 21"
+.LASF1517:
+	.string	"NFDBITS __NFDBITS"
+.LASF1533:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2091:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2202:
+	.string	"OWNER_ADC_CURR"
+.LASF1735:
+	.string	"__BITS_PER_LONG 64"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1289:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"SO_SNDTIMEO SO_SNDTIMEO_OLD"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1446:
+	.string	"USE_UART "
+.LASF1485:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1838:
+	.string	"__CONST_SOCKADDR_ARG const struct sockaddr *"
+.LASF1234:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1050:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2271:
+	.string	"txBufferTail"
+.LASF2246:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2390:
+	.string	"serialEvaluateNonMspData"
+.LASF1068:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1749:
+	.string	"SO_ERROR 4"
+.LASF2023:
+	.string	"INADDR_BROADCAST ((in_addr_t) 0xffffffff)"
+.LASF1352:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF950:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2304:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF2406:
+	.string	"serialFindPortConfiguration"
+.LASF1725:
+	.string	"_LINUX_STDDEF_H "
+.LASF1057:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1421:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"PF_INET 2"
+.LASF2128:
+	.string	"__need___va_list"
+.LASF1180:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF2134:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1606:
+	.string	"PF_XDP 44"
+.LASF990:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1987:
+	.string	"IPPROTO_BEETPH IPPROTO_BEETPH"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1260:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1393:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1773:
+	.string	"SO_ATTACH_FILTER 26"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1339:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2199:
+	.string	"OWNER_LED"
+.LASF1163:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1109:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1669:
+	.string	"SOL_NETLINK 270"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2177:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2157:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF975:
+	.string	"PG_RX_CONFIG 24"
+.LASF2333:
+	.string	"baudRate_e"
+.LASF2071:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF909:
+	.string	"NOOP do {} while (0)"
+.LASF1360:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1875:
+	.string	"IP_RECVTOS 13"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1204:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1670:
+	.string	"SOL_TIPC 271"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF1443:
+	.string	"BEEP_ON do {} while (0)"
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1327:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1666:
+	.string	"SOL_NETBEUI 267"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1649:
+	.string	"AF_CAIF PF_CAIF"
+.LASF1983:
+	.string	"IPPROTO_GRE IPPROTO_GRE"
+.LASF2127:
+	.string	"_ANSI_STDARG_H_ "
+.LASF2145:
+	.string	"LED0_ON NOOP"
+.LASF1054:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF2369:
+	.string	"serialPortCount"
+.LASF1977:
+	.string	"IPPROTO_UDP IPPROTO_UDP"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1511:
+	.string	"__NFDBITS"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1303:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1693:
+	.string	"MSG_OOB MSG_OOB"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2032:
+	.string	"INADDR_MAX_LOCAL_GROUP ((in_addr_t) 0xe00000ff)"
+.LASF1956:
+	.string	"IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP"
+.LASF1786:
+	.string	"SO_PEEK_OFF 42"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF2361:
+	.string	"portConfigs"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1622:
+	.string	"AF_ROSE PF_ROSE"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1457:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF930:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1080:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2043:
+	.string	"ntohs(x) __bswap_16 (x)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2338:
+	.string	"SERIAL_PORT_UART4"
+.LASF1595:
+	.string	"PF_RXRPC 33"
+.LASF2378:
+	.string	"serialRxBytesWaiting"
+.LASF1598:
+	.string	"PF_IEEE802154 36"
+.LASF1384:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1691:
+	.string	"__ss_aligntype unsigned long int"
+.LASF2391:
+	.string	"receivedChar"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1644:
+	.string	"AF_IUCV PF_IUCV"
+.LASF994:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1576:
+	.string	"PF_KEY 15"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1285:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1420:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2206:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2225:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2306:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF1548:
+	.string	"__have_pthread_attr_t 1"
+.LASF2066:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1688:
+	.string	"__SOCKADDR_COMMON(sa_prefix) sa_family_t sa_prefix ##family"
+.LASF1088:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1053:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1616:
+	.string	"AF_APPLETALK PF_APPLETALK"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF927:
+	.string	"BIT(x) (1 << (x))"
+.LASF2230:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1042:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1551:
+	.string	"SOCK_DGRAM SOCK_DGRAM"
+.LASF2268:
+	.string	"rxBufferHead"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2360:
+	.string	"serialConfig_s"
+.LASF2364:
+	.string	"serialConfig_t"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1832:
+	.string	"SCM_TIMESTAMPING SO_TIMESTAMPING"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1500:
+	.string	"_SYS_SELECT_H 1"
+.LASF1814:
+	.string	"SO_TIMESTAMPING_NEW 65"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2354:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1512:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF799:
+	.string	"BARO "
+.LASF2045:
+	.string	"htons(x) __bswap_16 (x)"
+.LASF1804:
+	.string	"SO_PEERGROUPS 59"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1580:
+	.string	"PF_ASH 18"
+.LASF2282:
+	.string	"beginWrite"
+.LASF1930:
+	.string	"IPV6_RECVPKTINFO 49"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1406:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF2238:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1342:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1059:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1902:
+	.string	"IPV6_2292HOPOPTS 3"
+.LASF1112:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1907:
+	.string	"IPV6_2292HOPLIMIT 8"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2227:
+	.string	"OWNER_BARO_EXTI"
+.LASF971:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2139:
+	.string	"__va_list__ "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF1759:
+	.string	"SO_PRIORITY 12"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2241:
+	.string	"MODE_RX"
+.LASF987:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF822:
+	.string	"USE_PWM"
+.LASF1207:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1689:
+	.string	"__SOCKADDR_COMMON_SIZE (sizeof (unsigned short int))"
+.LASF1973:
+	.string	"IPPROTO_IPIP IPPROTO_IPIP"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1929:
+	.string	"IPV6_HDRINCL 36"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2205:
+	.string	"OWNER_SERIAL_TX"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1908:
+	.string	"SCM_SRCRT IPV6_RXSRCRT"
+.LASF919:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF991:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1701:
+	.string	"MSG_WAITALL MSG_WAITALL"
+.LASF1570:
+	.string	"PF_X25 9"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1004:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1005:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2185:
+	.string	"PGR_SIZE_MASK"
+.LASF1800:
+	.string	"SO_MEMINFO 55"
+.LASF1319:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2053:
+	.string	"IN6_IS_ADDR_MULTICAST(a) (((const uint8_t *) (a))[0] == 0xff)"
+.LASF1799:
+	.string	"SCM_TIMESTAMPING_OPT_STATS 54"
+.LASF2095:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2331:
+	.string	"BAUD_2000000"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1860:
+	.string	"MCAST_LEAVE_GROUP 45"
+.LASF1452:
+	.string	"__u_char_defined "
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1135:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"PF_SECURITY 14"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF1487:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1496:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1554:
+	.string	"SOCK_SEQPACKET SOCK_SEQPACKET"
+.LASF1435:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1504:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2174:
+	.string	"long int"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1441:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF2299:
+	.string	"PORTSHARING_SHARED"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF2085:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2311:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1322:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF2067:
+	.string	"__CPU_SETSIZE 1024"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2064:
+	.string	"SCHED_RR 2"
+.LASF2098:
+	.string	"__struct_tm_defined 1"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2228:
+	.string	"OWNER_USB"
+.LASF2394:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1589:
+	.string	"PF_IB 27"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1023:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF2240:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1757:
+	.string	"SO_OOBINLINE 10"
+.LASF1812:
+	.string	"SO_TIMESTAMP_NEW 63"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF947:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1385:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2242:
+	.string	"MODE_TX"
+.LASF1593:
+	.string	"PF_BLUETOOTH 31"
+.LASF1811:
+	.string	"SO_TIMESTAMPING_OLD 37"
+.LASF1663:
+	.string	"SOL_ATM 264"
+.LASF1618:
+	.string	"AF_BRIDGE PF_BRIDGE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1984:
+	.string	"IPPROTO_ESP IPPROTO_ESP"
+.LASF949:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2039:
+	.string	"INET6_ADDRSTRLEN 46"
+.LASF1704:
+	.string	"MSG_CONFIRM MSG_CONFIRM"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1643:
+	.string	"AF_BLUETOOTH PF_BLUETOOTH"
+.LASF2099:
+	.string	"__itimerspec_defined 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1458:
+	.string	"__uid_t_defined "
+.LASF1129:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1795:
+	.string	"SO_DETACH_BPF SO_DETACH_FILTER"
+.LASF1834:
+	.string	"SHUT_RD SHUT_RD"
+.LASF1304:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1931:
+	.string	"IPV6_PKTINFO 50"
+.LASF1835:
+	.string	"SHUT_WR SHUT_WR"
+.LASF1250:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1729:
+	.string	"__FD_SETSIZE"
+.LASF1110:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2041:
+	.string	"GROUP_FILTER_SIZE(numsrc) (sizeof (struct group_filter) - sizeof (struct sockaddr_storage) + ((numsrc) * sizeof (struct sockaddr_storage)))"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1728:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1635:
+	.string	"AF_IRDA PF_IRDA"
+.LASF1552:
+	.string	"SOCK_RAW SOCK_RAW"
+.LASF2024:
+	.string	"INADDR_NONE ((in_addr_t) 0xffffffff)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2153:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF2051:
+	.string	"IN6_IS_ADDR_V4COMPAT(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && ntohl (__a->__in6_u.__u6_addr32[3]) > 1; }))"
+.LASF1819:
+	.string	"SO_BUSY_POLL_BUDGET 70"
+.LASF1258:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1947:
+	.string	"IPV6_ADDR_PREFERENCES 72"
+.LASF2210:
+	.string	"OWNER_SONAR_ECHO"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF2386:
+	.string	"leftC"
+.LASF1858:
+	.string	"MCAST_BLOCK_SOURCE 43"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1345:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1652:
+	.string	"AF_VSOCK PF_VSOCK"
+.LASF1784:
+	.string	"SO_WIFI_STATUS 41"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF2397:
+	.string	"serialRemovePort"
+.LASF1115:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1448:
+	.string	"_SYS_SOCKET_H 1"
+.LASF1027:
+	.string	"PG_VTX_CONFIG 515"
+.LASF938:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1780:
+	.string	"SO_MARK 36"
+.LASF2198:
+	.string	"OWNER_SERVO"
+.LASF929:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF793:
+	.string	"ACC "
+.LASF2080:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1813:
+	.string	"SO_TIMESTAMPNS_NEW 64"
+.LASF1646:
+	.string	"AF_ISDN PF_ISDN"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF738:
+	.string	"USE_PWM "
+.LASF1566:
+	.string	"PF_APPLETALK 5"
+.LASF1375:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1482:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF2424:
+	.string	"serialConfig"
+.LASF1444:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1156:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1102:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF937:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1692:
+	.string	"_SS_PADSIZE (_SS_SIZE - __SOCKADDR_COMMON_SIZE - sizeof (__ss_aligntype))"
+.LASF1089:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2019:
+	.string	"IN_MULTICAST(a) IN_CLASSD(a)"
+.LASF1578:
+	.string	"PF_ROUTE PF_NETLINK"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1847:
+	.string	"IP_MULTICAST_IF 32"
+.LASF2038:
+	.string	"INET_ADDRSTRLEN 16"
+.LASF1508:
+	.string	"__timeval_defined 1"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1709:
+	.string	"MSG_WAITFORONE MSG_WAITFORONE"
+.LASF1895:
+	.string	"IP_PMTUDISC_OMIT 5"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1621:
+	.string	"AF_INET6 PF_INET6"
+.LASF2004:
+	.string	"IN_CLASSA(a) ((((in_addr_t)(a)) & 0x80000000) == 0)"
+.LASF2172:
+	.string	"__uint16_t"
+.LASF2033:
+	.string	"s6_addr __in6_u.__u6_addr8"
+.LASF1738:
+	.string	"FIOSETOWN 0x8901"
+.LASF1995:
+	.string	"IPPROTO_RAW IPPROTO_RAW"
+.LASF2264:
+	.string	"rxBufferSize"
+.LASF2197:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1878:
+	.string	"IP_IPSEC_POLICY 16"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1432:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2309:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1700:
+	.string	"MSG_EOR MSG_EOR"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2224:
+	.string	"OWNER_RX_SPI_CS"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1455:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1661:
+	.string	"SOL_X25 262"
+.LASF1442:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF1912:
+	.string	"IPV6_MULTICAST_IF 17"
+.LASF1741:
+	.string	"SIOCGPGRP 0x8904"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1501:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1868:
+	.string	"IP_ROUTER_ALERT 5"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2270:
+	.string	"txBufferHead"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2323:
+	.string	"BAUD_230400"
+.LASF1518:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1449:
+	.string	"__iovec_defined 1"
+.LASF2261:
+	.string	"mode"
+.LASF1495:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1148:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1601:
+	.string	"PF_NFC 39"
+.LASF1237:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1624:
+	.string	"AF_NETBEUI PF_NETBEUI"
+.LASF1781:
+	.string	"SO_PROTOCOL 38"
+.LASF1899:
+	.string	"IP_MAX_MEMBERSHIPS 20"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2392:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF1577:
+	.string	"PF_NETLINK 16"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1881:
+	.string	"IP_TRANSPARENT 19"
+.LASF908:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2329:
+	.string	"BAUD_1000000"
+.LASF1571:
+	.string	"PF_INET6 10"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1469:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1031:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1636:
+	.string	"AF_PPPOX PF_PPPOX"
+.LASF1791:
+	.string	"SO_MAX_PACING_RATE 47"
+.LASF1861:
+	.string	"MCAST_JOIN_SOURCE_GROUP 46"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1659:
+	.string	"SOL_RAW 255"
+.LASF1605:
+	.string	"PF_SMC 43"
+.LASF914:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1253:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1028:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1199:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF2332:
+	.string	"BAUD_2470000"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1848:
+	.string	"IP_MULTICAST_TTL 33"
+.LASF2118:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF2305:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF2165:
+	.string	"unsigned char"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1587:
+	.string	"PF_WANPIPE 25"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1953:
+	.string	"IPV6_RECVFRAGSIZE 77"
+.LASF2084:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1942:
+	.string	"IPV6_PATHMTU 61"
+.LASF1038:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1041:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF939:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1240:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1772:
+	.string	"SO_BINDTODEVICE 25"
+.LASF1277:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF777:
+	.string	"USE_NAV "
+.LASF2119:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF984:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1294:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1887:
+	.string	"IP_BIND_ADDRESS_NO_PORT 24"
+.LASF967:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF1852:
+	.string	"IP_UNBLOCK_SOURCE 37"
+.LASF1923:
+	.string	"IPV6_LEAVE_ANYCAST 28"
+.LASF2181:
+	.string	"float"
+.LASF2260:
+	.string	"identifier"
+.LASF1607:
+	.string	"PF_MCTP 45"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF962:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2106:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1826:
+	.string	"SO_TIMESTAMPNS SO_TIMESTAMPNS_OLD"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1733:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF1586:
+	.string	"PF_PPPOX 24"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1657:
+	.string	"AF_MCTP PF_MCTP"
+.LASF2281:
+	.string	"writeBuf"
+.LASF795:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1223:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1874:
+	.string	"IP_RECVTTL 12"
+.LASF1579:
+	.string	"PF_PACKET 17"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1884:
+	.string	"IP_MINTTL 21"
+.LASF1870:
+	.string	"IP_PKTOPTIONS 9"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1159:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2314:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1048:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1105:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1945:
+	.string	"IPV6_TCLASS 67"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1043:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF2257:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1480:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1918:
+	.string	"IPV6_MTU_DISCOVER 23"
+.LASF1748:
+	.string	"SO_TYPE 3"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF903:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2401:
+	.string	"closeSerialPort"
+.LASF2283:
+	.string	"endWrite"
+.LASF2301:
+	.string	"FUNCTION_NONE"
+.LASF1183:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1387:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2114:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1437:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1994:
+	.string	"IPPROTO_ETHERNET IPPROTO_ETHERNET"
+.LASF2109:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF2140:
+	.string	"RX_BUFFER_SIZE 1400"
+.LASF1447:
+	.string	"_NETINET_IN_H 1"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1058:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2236:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1937:
+	.string	"IPV6_RECVRTHDR 56"
+.LASF1370:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2403:
+	.string	"openSerialPort"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1645:
+	.string	"AF_RXRPC PF_RXRPC"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1922:
+	.string	"IPV6_JOIN_ANYCAST 27"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1896:
+	.string	"SOL_IP 0"
+.LASF1465:
+	.string	"__clock_t_defined 1"
+.LASF1174:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF2111:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1295:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1609:
+	.string	"AF_UNSPEC PF_UNSPEC"
+.LASF2319:
+	.string	"BAUD_19200"
+.LASF1686:
+	.string	"SOMAXCONN 4096"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2219:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF2327:
+	.string	"BAUD_500000"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1957:
+	.string	"IPV6_RXHOPOPTS IPV6_HOPOPTS"
+.LASF2161:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1337:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1450:
+	.string	"__BITS_SOCKET_H "
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF923:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1845:
+	.string	"IP_RECVRETOPTS IP_RETOPTS"
+.LASF2330:
+	.string	"BAUD_1500000"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF951:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1736:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1276:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1754:
+	.string	"SO_SNDBUFFORCE 32"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1638:
+	.string	"AF_LLC PF_LLC"
+.LASF2105:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1090:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1761:
+	.string	"SO_BSDCOMPAT 14"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1891:
+	.string	"IP_PMTUDISC_WANT 1"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1633:
+	.string	"AF_RDS PF_RDS"
+.LASF1468:
+	.string	"__timer_t_defined 1"
+.LASF1202:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2183:
+	.string	"PGR_PGN_MASK"
+.LASF2158:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1187:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"USE_SPI"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1040:
+	.string	"IO_TAG_NONE 0"
+.LASF2278:
+	.string	"serialSetBaudRate"
+.LASF2425:
+	.string	"serialConfigMutable"
+.LASF2381:
+	.string	"serTcpOpen"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1941:
+	.string	"IPV6_RECVPATHMTU 60"
+.LASF1506:
+	.string	"____sigset_t_defined "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1470:
+	.string	"_ENDIAN_H 1"
+.LASF1411:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1340:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1243:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF989:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2007:
+	.string	"IN_CLASSA_HOST (0xffffffff & ~IN_CLASSA_NET)"
+.LASF2048:
+	.string	"IN6_IS_ADDR_LINKLOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfe800000); }))"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF2272:
+	.string	"rxCallback"
+.LASF1438:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1423:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF999:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1073:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF2356:
+	.string	"gps_baudrateIndex"
+.LASF1025:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1755:
+	.string	"SO_RCVBUFFORCE 33"
+.LASF1557:
+	.string	"SOCK_CLOEXEC SOCK_CLOEXEC"
+.LASF1382:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2266:
+	.string	"rxBuffer"
+.LASF1590:
+	.string	"PF_MPLS 28"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF2265:
+	.string	"txBufferSize"
+.LASF1597:
+	.string	"PF_PHONET 35"
+.LASF1971:
+	.string	"IPPROTO_ICMP IPPROTO_ICMP"
+.LASF2250:
+	.string	"SERIAL_PARITY_NO"
+.LASF2285:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1539:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1910:
+	.string	"IPV6_AUTHHDR 10"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2229:
+	.string	"OWNER_USB_DETECT"
+.LASF1372:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF2150:
+	.string	"LED2_OFF NOOP"
+.LASF1045:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2188:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1402:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1113:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1890:
+	.string	"IP_PMTUDISC_DONT 0"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1009:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1568:
+	.string	"PF_BRIDGE 7"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2057:
+	.string	"IN6_IS_ADDR_MC_ORGLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x8))"
+.LASF952:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2385:
+	.string	"right"
+.LASF1864:
+	.string	"IP_MULTICAST_ALL 49"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2054:
+	.string	"IN6_IS_ADDR_MC_NODELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x1))"
+.LASF924:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF2132:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1415:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2102:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1807:
+	.string	"SCM_TXTIME SO_TXTIME"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2233:
+	.string	"OWNER_INVERTER"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF2179:
+	.string	"size_t"
+.LASF2094:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1481:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1723:
+	.string	"__ASM_GENERIC_SOCKET_H "
+.LASF2214:
+	.string	"OWNER_SPI_MOSI"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1394:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2187:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2176:
+	.string	"uint8_t"
+.LASF2047:
+	.string	"IN6_IS_ADDR_LOOPBACK(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == htonl (1); }))"
+.LASF1943:
+	.string	"IPV6_DONTFRAG 62"
+.LASF1906:
+	.string	"IPV6_CHECKSUM 7"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2367:
+	.string	"serialConsumer"
+.LASF1751:
+	.string	"SO_BROADCAST 6"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1901:
+	.string	"IPV6_2292PKTINFO 2"
+.LASF1540:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF921:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1966:
+	.string	"SOL_ICMPV6 58"
+.LASF1596:
+	.string	"PF_ISDN 34"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF1706:
+	.string	"MSG_ERRQUEUE MSG_ERRQUEUE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1003:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1095:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF2015:
+	.string	"IN_CLASSC_NET 0xffffff00"
+.LASF1877:
+	.string	"IP_FREEBIND 15"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1205:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1454:
+	.string	"__dev_t_defined "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1998:
+	.string	"IPPROTO_ROUTING IPPROTO_ROUTING"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1825:
+	.string	"SO_TIMESTAMP SO_TIMESTAMP_OLD"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF925:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1732:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF2428:
+	.string	"nopConsumer"
+.LASF1716:
+	.string	"CMSG_FIRSTHDR(mhdr) ((size_t) (mhdr)->msg_controllen >= sizeof (struct cmsghdr) ? (struct cmsghdr *) (mhdr)->msg_control : (struct cmsghdr *) 0)"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1036:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2060:
+	.string	"_SCHED_H 1"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1333:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1246:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF2008:
+	.string	"IN_CLASSA_MAX 128"
+.LASF1178:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"IPV6_MTU 24"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF1541:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1271:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF2336:
+	.string	"SERIAL_PORT_USART2"
+.LASF2286:
+	.string	"UARTDevice"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF1550:
+	.string	"SOCK_STREAM SOCK_STREAM"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF756:
+	.string	"CMS "
+.LASF1711:
+	.string	"MSG_ZEROCOPY MSG_ZEROCOPY"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2073:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF820:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1935:
+	.string	"IPV6_HOPOPTS 54"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1756:
+	.string	"SO_KEEPALIVE 9"
+.LASF1060:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1673:
+	.string	"SOL_BLUETOOTH 274"
+.LASF941:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2339:
+	.string	"SERIAL_PORT_UART5"
+.LASF2316:
+	.string	"serialPortFunction_e"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF1484:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2146:
+	.string	"LED1_TOGGLE NOOP"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2377:
+	.string	"findSharedSerialPortState"
+.LASF902:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2149:
+	.string	"LED2_TOGGLE NOOP"
+.LASF2223:
+	.string	"OWNER_OSD_CS"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF1350:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1357:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1650:
+	.string	"AF_ALG PF_ALG"
+.LASF1955:
+	.string	"IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP"
+.LASF1091:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2120:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF2097:
+	.string	"TIMER_ABSTIME 1"
+.LASF1718:
+	.string	"CMSG_SPACE(len) (CMSG_ALIGN (len) + CMSG_ALIGN (sizeof (struct cmsghdr)))"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1177:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF969:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1214:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1859:
+	.string	"MCAST_UNBLOCK_SOURCE 44"
+.LASF1863:
+	.string	"MCAST_MSFILTER 48"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF977:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1924:
+	.string	"IPV6_MULTICAST_ALL 29"
+.LASF1982:
+	.string	"IPPROTO_RSVP IPPROTO_RSVP"
+.LASF1687:
+	.string	"_BITS_SOCKADDR_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1904:
+	.string	"IPV6_2292RTHDR 5"
+.LASF2318:
+	.string	"BAUD_9600"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1611:
+	.string	"AF_UNIX PF_UNIX"
+.LASF1565:
+	.string	"PF_IPX 4"
+.LASF1439:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1658:
+	.string	"AF_MAX PF_MAX"
+.LASF1674:
+	.string	"SOL_PNPIPE 275"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2011:
+	.string	"IN_CLASSB_NSHIFT 16"
+.LASF1473:
+	.string	"__BIG_ENDIAN 4321"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF2379:
+	.string	"cliEnter"
+.LASF1641:
+	.string	"AF_CAN PF_CAN"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1637:
+	.string	"AF_WANPIPE PF_WANPIPE"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1429:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"PG_VCD_CONFIG 514"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF1324:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"AF_NETROM PF_NETROM"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1727:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF1306:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1730:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF2382:
+	.string	"telemetryCheckRxPortShared"
+.LASF2130:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1098:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1676:
+	.string	"SOL_IUCV 277"
+.LASF1620:
+	.string	"AF_X25 PF_X25"
+.LASF1369:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1479:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1719:
+	.string	"CMSG_LEN(len) (CMSG_ALIGN (sizeof (struct cmsghdr)) + (len))"
+.LASF2396:
+	.string	"serialGetAvailablePortCount"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1094:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF2088:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1235:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1525:
+	.string	"__fsfilcnt_t_defined "
+.LASF1599:
+	.string	"PF_CAIF 37"
+.LASF2107:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1640:
+	.string	"AF_MPLS PF_MPLS"
+.LASF1241:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1154:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1100:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1651:
+	.string	"AF_NFC PF_NFC"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF1750:
+	.string	"SO_DONTROUTE 5"
+.LASF1064:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1782:
+	.string	"SO_DOMAIN 39"
+.LASF1855:
+	.string	"IP_DROP_SOURCE_MEMBERSHIP 40"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF2092:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1024:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF2384:
+	.string	"left"
+.LASF2209:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2062:
+	.string	"SCHED_OTHER 0"
+.LASF2312:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF2189:
+	.string	"address"
+.LASF1827:
+	.string	"SO_TIMESTAMPING SO_TIMESTAMPING_OLD"
+.LASF922:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1363:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2307:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1195:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1549:
+	.string	"__socklen_t_defined "
+.LASF1897:
+	.string	"IP_DEFAULT_MULTICAST_TTL 1"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1052:
+	.string	"IOCFG_IPU 0"
+.LASF1648:
+	.string	"AF_IEEE802154 PF_IEEE802154"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1619:
+	.string	"AF_ATMPVC PF_ATMPVC"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF721:
+	.string	"NULL"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF1775:
+	.string	"SO_GET_FILTER SO_ATTACH_FILTER"
+.LASF2061:
+	.string	"_BITS_SCHED_H 1"
+.LASF1141:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF2211:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1558:
+	.string	"SOCK_NONBLOCK SOCK_NONBLOCK"
+.LASF1120:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1150:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF2357:
+	.string	"blackbox_baudrateIndex"
+.LASF1694:
+	.string	"MSG_PEEK MSG_PEEK"
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1882:
+	.string	"IP_ORIGDSTADDR 20"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1656:
+	.string	"AF_XDP PF_XDP"
+.LASF1538:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2358:
+	.string	"telemetry_baudrateIndex"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1828:
+	.string	"SO_RCVTIMEO SO_RCVTIMEO_OLD"
+.LASF910:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2245:
+	.string	"portOptions_t"
+.LASF1062:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF2410:
+	.string	"portConfig"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1664:
+	.string	"SOL_AAL 265"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1001:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1408:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1731:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2324:
+	.string	"BAUD_250000"
+.LASF1928:
+	.string	"IPV6_XFRM_POLICY 35"
+.LASF2302:
+	.string	"FUNCTION_MSP"
+.LASF2044:
+	.string	"htonl(x) __bswap_32 (x)"
+.LASF1515:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1361:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1844:
+	.string	"IP_RECVOPTS 6"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1865:
+	.string	"IP_UNICAST_IF 50"
+.LASF1238:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2186:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF959:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1226:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2037:
+	.string	"IN6ADDR_LOOPBACK_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1 } } }"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1940:
+	.string	"IPV6_DSTOPTS 59"
+.LASF1582:
+	.string	"PF_ATMSVC 20"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2325:
+	.string	"BAUD_400000"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1668:
+	.string	"SOL_DCCP 269"
+.LASF1367:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1171:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1631:
+	.string	"AF_ECONET PF_ECONET"
+.LASF906:
+	.string	"UNIT_TESTED "
+.LASF958:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1699:
+	.string	"MSG_DONTWAIT MSG_DONTWAIT"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2409:
+	.string	"mspPortCount"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1685:
+	.string	"SOL_SMC 286"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1292:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1602:
+	.string	"PF_VSOCK 40"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF1949:
+	.string	"IPV6_ORIGDSTADDR 74"
+.LASF2371:
+	.string	"findSerialPortConfigState_s"
+.LASF2373:
+	.string	"findSerialPortConfigState_t"
+.LASF1071:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2055:
+	.string	"IN6_IS_ADDR_MC_LINKLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x2))"
+.LASF1627:
+	.string	"AF_NETLINK PF_NETLINK"
+.LASF2426:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1903:
+	.string	"IPV6_2292DSTOPTS 4"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF942:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1132:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF2383:
+	.string	"memset"
+.LASF1092:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1808:
+	.string	"SO_BINDTOIFINDEX 62"
+.LASF1217:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1103:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2046:
+	.string	"IN6_IS_ADDR_UNSPECIFIED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == 0; }))"
+.LASF1625:
+	.string	"AF_SECURITY PF_SECURITY"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1846:
+	.string	"IP_RETOPTS 7"
+.LASF2133:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1758:
+	.string	"SO_NO_CHECK 11"
+.LASF1381:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2035:
+	.string	"s6_addr32 __in6_u.__u6_addr32"
+.LASF1189:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2078:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1927:
+	.string	"IPV6_IPSEC_POLICY 34"
+.LASF1823:
+	.string	"SO_TXREHASH 74"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1854:
+	.string	"IP_ADD_SOURCE_MEMBERSHIP 39"
+.LASF2026:
+	.string	"IN_LOOPBACKNET 127"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2014:
+	.string	"IN_CLASSC(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xc0000000)"
+.LASF1889:
+	.string	"IP_RECVERR_RFC4884 26"
+.LASF1837:
+	.string	"__SOCKADDR_ARG struct sockaddr *__restrict"
+.LASF1312:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1990:
+	.string	"IPPROTO_COMP IPPROTO_COMP"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1198:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1989:
+	.string	"IPPROTO_PIM IPPROTO_PIM"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1144:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1519:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1011:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1466:
+	.string	"__clockid_t_defined 1"
+.LASF1871:
+	.string	"IP_PMTUDISC 10"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF953:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1675:
+	.string	"SOL_RDS 276"
+.LASF1853:
+	.string	"IP_BLOCK_SOURCE 38"
+.LASF1354:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1534:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1585:
+	.string	"PF_IRDA 23"
+.LASF737:
+	.string	"USE_PPM "
+.LASF1123:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1778:
+	.string	"SO_PEERSEC 31"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1083:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2243:
+	.string	"MODE_RXTX"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2298:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF1883:
+	.string	"IP_RECVORIGDSTADDR IP_ORIGDSTADDR"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF976:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1225:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2191:
+	.string	"reset"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF2034:
+	.string	"s6_addr16 __in6_u.__u6_addr16"
+.LASF1684:
+	.string	"SOL_MCTP 285"
+.LASF960:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1760:
+	.string	"SO_LINGER 13"
+.LASF2049:
+	.string	"IN6_IS_ADDR_SITELOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfec00000); }))"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1969:
+	.string	"IPV6_RTHDR_TYPE_0 0"
+.LASF911:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2068:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF1900:
+	.string	"IPV6_ADDRFORM 1"
+.LASF2217:
+	.string	"OWNER_SDCARD"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1600:
+	.string	"PF_ALG 38"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1862:
+	.string	"MCAST_LEAVE_SOURCE_GROUP 47"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1412:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1836:
+	.string	"SHUT_RDWR SHUT_RDWR"
+.LASF1000:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1948:
+	.string	"IPV6_MINHOPCOUNT 73"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1766:
+	.string	"SO_SNDLOWAT 19"
+.LASF2166:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2050:
+	.string	"IN6_IS_ADDR_V4MAPPED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == htonl (0xffff); }))"
+.LASF1632:
+	.string	"AF_ATMSVC PF_ATMSVC"
+.LASF2164:
+	.string	"ALL_FUNCTIONS_SHARABLE_WITH_MSP (FUNCTION_BLACKBOX | ALL_TELEMETRY_FUNCTIONS_MASK)"
+.LASF2169:
+	.string	"signed char"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2059:
+	.string	"_PTHREAD_H 1"
+.LASF1104:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1721:
+	.string	"_EXTERN_INLINE __extern_inline"
+.LASF1830:
+	.string	"SCM_TIMESTAMP SO_TIMESTAMP"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF2110:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1409:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1697:
+	.string	"MSG_PROXY MSG_PROXY"
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF1355:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF968:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF997:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1467:
+	.string	"__time_t_defined 1"
+.LASF1494:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1486:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1724:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF2247:
+	.string	"SERIAL_INVERTED"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1453:
+	.string	"__ino_t_defined "
+.LASF1283:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1483:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2117:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1872:
+	.string	"IP_MTU_DISCOVER 10"
+.LASF1388:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1584:
+	.string	"PF_SNA 22"
+.LASF1318:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1547:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF916:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1873:
+	.string	"IP_RECVERR 11"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1336:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2122:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF1106:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1526:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1074:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1521:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1783:
+	.string	"SO_RXQ_OVFL 40"
+.LASF2389:
+	.string	"serialPassthrough"
+.LASF1737:
+	.string	"__ASM_GENERIC_SOCKIOS_H "
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2344:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2345:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF2126:
+	.string	"_STDARG_H "
+.LASF2427:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1261:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF940:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1774:
+	.string	"SO_DETACH_FILTER 27"
+.LASF1147:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF2420:
+	.string	"findSerialPortUsageByIdentifier"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF980:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF2262:
+	.string	"options"
+.LASF2100:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2308:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF2013:
+	.string	"IN_CLASSB_MAX 65536"
+.LASF1696:
+	.string	"MSG_CTRUNC MSG_CTRUNC"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2124:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1869:
+	.string	"IP_PKTINFO 8"
+.LASF1127:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF2365:
+	.string	"serialConfig_System"
+.LASF2393:
+	.string	"serialIsPortAvailable"
+.LASF1035:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1996:
+	.string	"IPPROTO_MPTCP IPPROTO_MPTCP"
+.LASF2231:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF2113:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF1451:
+	.string	"_SYS_TYPES_H 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2184:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF966:
+	.string	"PG_PID_PROFILE 14"
+.LASF1376:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1044:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1959:
+	.string	"IPV6_PMTUDISC_DONT 0"
+.LASF1019:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1078:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1653:
+	.string	"AF_KCM PF_KCM"
+.LASF2151:
+	.string	"LED2_ON NOOP"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2000:
+	.string	"IPPROTO_ICMPV6 IPPROTO_ICMPV6"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1986:
+	.string	"IPPROTO_MTP IPPROTO_MTP"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1523:
+	.string	"__blkcnt_t_defined "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1093:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF2351:
+	.string	"function"
+.LASF1672:
+	.string	"SOL_PPPOL2TP 273"
+.LASF932:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1841:
+	.string	"IP_HDRINCL 3"
+.LASF982:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1972:
+	.string	"IPPROTO_IGMP IPPROTO_IGMP"
+.LASF1489:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1810:
+	.string	"SO_TIMESTAMPNS_OLD 35"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1279:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2350:
+	.string	"serialPort"
+.LASF2253:
+	.string	"SERIAL_BIDIR"
+.LASF1695:
+	.string	"MSG_DONTROUTE MSG_DONTROUTE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1925:
+	.string	"IPV6_ROUTER_ALERT_ISOLATE 30"
+.LASF2147:
+	.string	"LED1_OFF NOOP"
+.LASF1084:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1107:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF2343:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1765:
+	.string	"SO_RCVLOWAT 18"
+.LASF1980:
+	.string	"IPPROTO_DCCP IPPROTO_DCCP"
+.LASF1282:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1842:
+	.string	"IP_TOS 1"
+.LASF2190:
+	.string	"copy"
+.LASF776:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF2137:
+	.string	"_VA_LIST_DEFINED "
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1999:
+	.string	"IPPROTO_FRAGMENT IPPROTO_FRAGMENT"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF2335:
+	.string	"SERIAL_PORT_USART1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2337:
+	.string	"SERIAL_PORT_USART3"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF2340:
+	.string	"SERIAL_PORT_USART6"
+.LASF2341:
+	.string	"SERIAL_PORT_USART7"
+.LASF2342:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2275:
+	.string	"serialTotalRxWaiting"
+.LASF1065:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF979:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1358:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"__CMSG_PADDING(len) ((sizeof (size_t) - ((len) & (sizeof (size_t) - 1))) & (sizeof (size_t) - 1))"
+.LASF1893:
+	.string	"IP_PMTUDISC_PROBE 3"
+.LASF1244:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF2366:
+	.string	"serialConfig_Copy"
+.LASF972:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1184:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"IPPROTO_EGP IPPROTO_EGP"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1076:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1032:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1628:
+	.string	"AF_ROUTE PF_ROUTE"
+.LASF2207:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1399:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2021:
+	.string	"IN_BADCLASS(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xf0000000)"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1713:
+	.string	"MSG_CMSG_CLOEXEC MSG_CMSG_CLOEXEC"
+.LASF1831:
+	.string	"SCM_TIMESTAMPNS SO_TIMESTAMPNS"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1634:
+	.string	"AF_SNA PF_SNA"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF2413:
+	.string	"sharedWithFunction"
+.LASF2320:
+	.string	"BAUD_38400"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF944:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1030:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1126:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2154:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF1770:
+	.string	"SO_SECURITY_ENCRYPTION_TRANSPORT 23"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF1503:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1509:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1809:
+	.string	"SO_TIMESTAMP_OLD 29"
+.LASF2076:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2408:
+	.string	"serialConfigToCheck"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF2370:
+	.string	"serialConfig_Registry"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF963:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1210:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1951:
+	.string	"IPV6_TRANSPARENT 75"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1769:
+	.string	"SO_SECURITY_AUTHENTICATION 22"
+.LASF2077:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1762:
+	.string	"SO_REUSEPORT 15"
+.LASF920:
+	.string	"EXPAND_I(x) x"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2028:
+	.string	"INADDR_UNSPEC_GROUP ((in_addr_t) 0xe0000000)"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1787:
+	.string	"SO_NOFCS 43"
+.LASF2136:
+	.string	"_VA_LIST "
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1510:
+	.string	"__suseconds_t_defined "
+.LASF2178:
+	.string	"uint32_t"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2258:
+	.string	"serialPort_s"
+.LASF1373:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1885:
+	.string	"IP_NODEFRAG 22"
+.LASF2269:
+	.string	"rxBufferTail"
+.LASF1603:
+	.string	"PF_KCM 41"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1273:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2072:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1130:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2030:
+	.string	"INADDR_ALLRTRS_GROUP ((in_addr_t) 0xe0000002)"
+.LASF1938:
+	.string	"IPV6_RTHDR 57"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1390:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1556:
+	.string	"SOCK_PACKET SOCK_PACKET"
+.LASF2279:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1456:
+	.string	"__mode_t_defined "
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1016:
+	.string	"PG_PID_CONFIG 504"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1343:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1843:
+	.string	"IP_TTL 2"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2083:
+	.string	"_TIME_H 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF1678:
+	.string	"SOL_ALG 279"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2089:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1742:
+	.string	"SIOCATMARK 0x8905"
+.LASF907:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF995:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2108:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF955:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1639:
+	.string	"AF_IB PF_IB"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1915:
+	.string	"IPV6_JOIN_GROUP 20"
+.LASF1569:
+	.string	"PF_ATMPVC 8"
+.LASF1790:
+	.string	"SO_BUSY_POLL 46"
+.LASF1970:
+	.string	"IPPROTO_IP IPPROTO_IP"
+.LASF2208:
+	.string	"OWNER_TIMER"
+.LASF1153:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1703:
+	.string	"MSG_SYN MSG_SYN"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF996:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2402:
+	.string	"serialPortUsage"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1331:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1307:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF917:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1193:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1366:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2175:
+	.string	"char"
+.LASF1532:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1583:
+	.string	"PF_RDS 21"
+.LASF1840:
+	.string	"IP_OPTIONS 4"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1905:
+	.string	"IPV6_2292PKTOPTIONS 6"
+.LASF1763:
+	.string	"SO_PASSCRED 16"
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF1288:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2347:
+	.string	"baudRates"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1049:
+	.string	"IOCFG_AF_PP 0"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1118:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2006:
+	.string	"IN_CLASSA_NSHIFT 24"
+.LASF2129:
+	.string	"__GNUC_VA_LIST "
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1820:
+	.string	"SO_NETNS_COOKIE 71"
+.LASF2131:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1497:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1101:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1039:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2334:
+	.string	"SERIAL_PORT_NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF2101:
+	.string	"_BITS_SETJMP_H 1"
+.LASF2192:
+	.string	"pgRegistry_t"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF1267:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF913:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1824:
+	.string	"SO_RCVMARK 75"
+.LASF1213:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1175:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1677:
+	.string	"SOL_CAIF 278"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF2056:
+	.string	"IN6_IS_ADDR_MC_SITELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x5))"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2018:
+	.string	"IN_CLASSD(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xe0000000)"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2163:
+	.string	"ALL_TELEMETRY_FUNCTIONS_MASK (TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK | FUNCTION_TELEMETRY_HOTT | FUNCTION_TELEMETRY_SMARTPORT)"
+.LASF1424:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"IPPROTO_UDPLITE IPPROTO_UDPLITE"
+.LASF1803:
+	.string	"SCM_TIMESTAMPING_PKTINFO 58"
+.LASF2143:
+	.string	"LED0_TOGGLE NOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1445:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2372:
+	.string	"lastIndex"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF2251:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1555:
+	.string	"SOCK_DCCP SOCK_DCCP"
+.LASF2142:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF2058:
+	.string	"IN6_IS_ADDR_MC_GLOBAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0xe))"
+.LASF2012:
+	.string	"IN_CLASSB_HOST (0xffffffff & ~IN_CLASSB_NET)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF988:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1952:
+	.string	"IPV6_UNICAST_IF 76"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1530:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF2112:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF1802:
+	.string	"SO_COOKIE 57"
+.LASF2220:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1498:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF918:
+	.string	"STR_HELPER(x) #x"
+.LASF1546:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1219:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2096:
+	.string	"CLOCK_TAI 11"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2156:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF993:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2212:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF1067:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF2204:
+	.string	"OWNER_ADC_RSSI"
+.LASF904:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF397:
+	.string	"true 1"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1229:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF2075:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF1505:
+	.string	"__sigset_t_defined 1"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1789:
+	.string	"SO_SELECT_ERR_QUEUE 45"
+.LASF1794:
+	.string	"SO_ATTACH_BPF 50"
+.LASF1849:
+	.string	"IP_MULTICAST_LOOP 34"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1268:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1682:
+	.string	"SOL_XDP 283"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1459:
+	.string	"__off_t_defined "
+.LASF2404:
+	.string	"doesConfigurationUsePort"
+.LASF1708:
+	.string	"MSG_MORE MSG_MORE"
+.LASF1660:
+	.string	"SOL_DECNET 261"
+.LASF2087:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1892:
+	.string	"IP_PMTUDISC_DO 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1866:
+	.string	"MCAST_EXCLUDE 0"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF1654:
+	.string	"AF_QIPCRTR PF_QIPCRTR"
+.LASF1739:
+	.string	"SIOCSPGRP 0x8902"
+.LASF377:
+	.string	"__linux 1"
+.LASF1909:
+	.string	"IPV6_NEXTHOP 9"
+.LASF1018:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1310:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2090:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1196:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1256:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1142:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1592:
+	.string	"PF_TIPC 30"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1461:
+	.string	"__id_t_defined "
+.LASF1264:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1816:
+	.string	"SO_SNDTIMEO_NEW 67"
+.LASF1034:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1544:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2020:
+	.string	"IN_EXPERIMENTAL(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xe0000000)"
+.LASF1220:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"PORTSHARING_UNUSED"
+.LASF2353:
+	.string	"serialPortConfig_s"
+.LASF2359:
+	.string	"serialPortConfig_t"
+.LASF1139:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"findSerialPortUsageByPort"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1405:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1543:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1427:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"__daddr_t_defined "
+.LASF1121:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF2249:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1776:
+	.string	"SO_PEERNAME 28"
+.LASF2009:
+	.string	"IN_CLASSB(a) ((((in_addr_t)(a)) & 0xc0000000) == 0x80000000)"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1476:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1490:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF1911:
+	.string	"IPV6_UNICAST_HOPS 16"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2086:
+	.string	"CLOCK_REALTIME 0"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1562:
+	.string	"PF_FILE PF_LOCAL"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1216:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1162:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF946:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1806:
+	.string	"SO_TXTIME 61"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1008:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1815:
+	.string	"SO_RCVTIMEO_NEW 66"
+.LASF1857:
+	.string	"MCAST_JOIN_GROUP 42"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1017:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1321:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2180:
+	.string	"double"
+.LASF1683:
+	.string	"SOL_MPTCP 284"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1493:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2423:
+	.string	"pgResetFn_serialConfig"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2215:
+	.string	"OWNER_I2C_SCL"
+.LASF2213:
+	.string	"OWNER_SPI_MISO"
+.LASF1108:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2216:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2237:
+	.string	"OWNER_COMPASS_CS"
+.LASF2152:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1958:
+	.string	"IPV6_RXDSTOPTS IPV6_DSTOPTS"
+.LASF931:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1232:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1116:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF2125:
+	.string	"DYAD_H "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1477:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1647:
+	.string	"AF_PHONET PF_PHONET"
+.LASF956:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2141:
+	.string	"TX_BUFFER_SIZE 16384"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2025:
+	.string	"INADDR_DUMMY ((in_addr_t) 0xc0000008)"
+.LASF2123:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2400:
+	.string	"serialPortToDisable"
+.LASF1396:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1069:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1710:
+	.string	"MSG_BATCH MSG_BATCH"
+.LASF1033:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1536:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1702:
+	.string	"MSG_FIN MSG_FIN"
+.LASF1817:
+	.string	"SO_DETACH_REUSEPORT_BPF 68"
+.LASF2252:
+	.string	"SERIAL_UNIDIR"
+.LASF1950:
+	.string	"IPV6_RECVORIGDSTADDR IPV6_ORIGDSTADDR"
+.LASF2173:
+	.string	"__uint32_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1572:
+	.string	"PF_ROSE 11"
+.LASF2388:
+	.string	"data"
+.LASF1334:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF973:
+	.string	"PG_IMU_CONFIG 22"
+.LASF2155:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF734:
+	.string	"USE_CLI "
+.LASF1944:
+	.string	"IPV6_RECVTCLASS 66"
+.LASF1379:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2328:
+	.string	"BAUD_921600"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1961:
+	.string	"IPV6_PMTUDISC_DO 2"
+.LASF1075:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1591:
+	.string	"PF_CAN 29"
+.LASF1414:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF981:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1932:
+	.string	"IPV6_RECVHOPLIMIT 51"
+.LASF2417:
+	.string	"findNextSerialPortConfig"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2346:
+	.string	"serialPortIdentifier_e"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1051:
+	.string	"IOCFG_IPD 0"
+.LASF1715:
+	.string	"CMSG_NXTHDR(mhdr,cmsg) __cmsg_nxthdr (mhdr, cmsg)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1313:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF2368:
+	.string	"serialPortUsageList"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1259:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2355:
+	.string	"msp_baudrateIndex"
+.LASF1478:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2267:
+	.string	"txBuffer"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF926:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF2159:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF1325:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1867:
+	.string	"MCAST_INCLUDE 1"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2395:
+	.string	"systemResetToBootloader"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF1063:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1939:
+	.string	"IPV6_RECVDSTOPTS 58"
+.LASF1081:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1430:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2315:
+	.string	"FUNCTION_RCSPLIT"
+.LASF2407:
+	.string	"isSerialConfigValid"
+.LASF1431:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1300:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1581:
+	.string	"PF_ECONET 19"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF2405:
+	.string	"candidate"
+.LASF2052:
+	.ascii	"IN6_ARE_ADDR_EQUAL(a,b) (__extension__ ({ const struct in6_a"
+	.ascii	"ddr *__a = (const struct in6_addr *) (a); const struct in6_a"
+	.ascii	"ddr *__b = (const struct in6_addr *"
+	.string	") (b); __a->__in6_u.__u6_addr32[0] == __b->__in6_u.__u6_addr32[0] && __a->__in6_u.__u6_addr32[1] == __b->__in6_u.__u6_addr32[1] && __a->__in6_u.__u6_addr32[2] == __b->__in6_u.__u6_addr32[2] && __a->__in6_u.__u6_addr32[3] == __b->__in6_u.__u6_addr32[3]; }))"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1542:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF978:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2362:
+	.string	"serial_update_rate_hz"
+.LASF1926:
+	.string	"IPV6_RECVERR_RFC4884 31"
+.LASF1993:
+	.string	"IPPROTO_MPLS IPPROTO_MPLS"
+.LASF905:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1898:
+	.string	"IP_DEFAULT_MULTICAST_LOOP 1"
+.LASF2093:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1967:
+	.string	"IPV6_RTHDR_LOOSE 0"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2232:
+	.string	"OWNER_RX_BIND"
+.LASF1007:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF2374:
+	.string	"findSerialPortConfigState"
+.LASF2416:
+	.string	"determinePortSharing"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF2235:
+	.string	"OWNER_TRANSPONDER"
+.LASF974:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1604:
+	.string	"PF_QIPCRTR 42"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2387:
+	.string	"rightC"
+.LASF1165:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1680:
+	.string	"SOL_KCM 281"
+.LASF1564:
+	.string	"PF_AX25 3"
+.LASF1111:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1231:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1792:
+	.string	"SO_BPF_EXTENSIONS 48"
+.LASF2322:
+	.string	"BAUD_115200"
+.LASF1291:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF2069:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2273:
+	.string	"serialPortVTable"
+.LASF2070:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF2375:
+	.string	"findSharedSerialPortState_s"
+.LASF2376:
+	.string	"findSharedSerialPortState_t"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1612:
+	.string	"AF_FILE PF_FILE"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2042:
+	.string	"ntohl(x) __bswap_32 (x)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1514:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2248:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2303:
+	.string	"FUNCTION_GPS"
+.LASF1119:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2244:
+	.string	"portMode_t"
+.LASF1086:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF928:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF1856:
+	.string	"IP_MSFILTER 41"
+.LASF2295:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1010:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1613:
+	.string	"AF_INET PF_INET"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2148:
+	.string	"LED1_ON NOOP"
+.LASF1679:
+	.string	"SOL_NFC 280"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2310:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF1714:
+	.string	"CMSG_DATA(cmsg) ((cmsg)->__cmsg_data)"
+.LASF1315:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2222:
+	.string	"OWNER_MPU_CS"
+.LASF2182:
+	.string	"pgn_t"
+.LASF1021:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2116:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1797:
+	.string	"SO_ATTACH_REUSEPORT_EBPF 52"
+.LASF1474:
+	.string	"__PDP_ENDIAN 3412"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1378:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2300:
+	.string	"portSharing_e"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF846:
+	.string	"USE_I2C"
+.LASF1916:
+	.string	"IPV6_LEAVE_GROUP 21"
+.LASF2144:
+	.string	"LED0_OFF NOOP"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1946:
+	.string	"IPV6_AUTOFLOWLABEL 70"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF797:
+	.string	"MAG "
+.LASF2103:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1976:
+	.string	"IPPROTO_PUP IPPROTO_PUP"
+.LASF1316:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF970:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2256:
+	.string	"serialReceiveCallbackPtr"
+.LASF1397:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1492:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1475:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1796:
+	.string	"SO_ATTACH_REUSEPORT_CBPF 51"
+.LASF1745:
+	.string	"SOL_SOCKET 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1537:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1436:
+	.string	"I2CDEV_COUNT 4"
+.LASF957:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1914:
+	.string	"IPV6_MULTICAST_LOOP 19"
+.LASF1805:
+	.string	"SO_ZEROCOPY 60"
+.LASF1833:
+	.string	"__osockaddr_defined 1"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1979:
+	.string	"IPPROTO_TP IPPROTO_TP"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF934:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1262:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"SO_SNDBUF 7"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1208:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1705:
+	.string	"MSG_RST MSG_RST"
+.LASF2254:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1014:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2201:
+	.string	"OWNER_ADC_BATT"
+.LASF2194:
+	.string	"OWNER_FREE"
+.LASF2415:
+	.string	"isSerialPortShared"
+.LASF1630:
+	.string	"AF_ASH PF_ASH"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF2277:
+	.string	"serialRead"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1222:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2138:
+	.string	"_VA_LIST_T_H "
+.LASF1462:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2040:
+	.string	"IP_MSFILTER_SIZE(numsrc) (sizeof (struct ip_msfilter) - sizeof (struct in_addr) + (numsrc) * sizeof (struct in_addr))"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1524:
+	.string	"__fsblkcnt_t_defined "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1520:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1888:
+	.string	"IP_RECVFRAGSIZE 25"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2399:
+	.string	"softserialEnabled"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1133:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF2284:
+	.string	"serialPort_t"
+.LASF2195:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1753:
+	.string	"SO_RCVBUF 8"
+.LASF1913:
+	.string	"IPV6_MULTICAST_HOPS 18"
+.LASF1186:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2398:
+	.string	"serialInit"
+.LASF1594:
+	.string	"PF_IUCV 32"
+.LASF2317:
+	.string	"BAUD_AUTO"
+.LASF1136:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2276:
+	.string	"serialTotalTxFree"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"AF_DECnet PF_DECnet"
+.LASF2082:
+	.string	"__sched_priority sched_priority"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2022:
+	.string	"INADDR_ANY ((in_addr_t) 0x00000000)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2063:
+	.string	"SCHED_FIFO 1"
+.LASF2079:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2255:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1528:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1712:
+	.string	"MSG_FASTOPEN MSG_FASTOPEN"
+.LASF1168:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1722:
+	.string	"SCM_RIGHTS SCM_RIGHTS"
+.LASF396:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF2421:
+	.string	"findSerialPortIndexByIdentifier"
+.LASF1561:
+	.string	"PF_UNIX PF_LOCAL"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2422:
+	.string	"lookupBaudRateIndex"
+.LASF1391:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1933:
+	.string	"IPV6_HOPLIMIT 52"
+.LASF1418:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1280:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1472:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1642:
+	.string	"AF_TIPC PF_TIPC"
+.LASF1488:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2418:
+	.string	"findSerialPortConfig"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1464:
+	.string	"__key_t_defined "
+.LASF2296:
+	.string	"long long int"
+.LASF1610:
+	.string	"AF_LOCAL PF_LOCAL"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF2017:
+	.string	"IN_CLASSC_HOST (0xffffffff & ~IN_CLASSC_NET)"
+.LASF1047:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1507:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1567:
+	.string	"PF_NETROM 6"
+.LASF1190:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF1764:
+	.string	"SO_PEERCRED 17"
+.LASF2027:
+	.string	"INADDR_LOOPBACK ((in_addr_t) 0x7f000001)"
+.LASF961:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2218:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1779:
+	.string	"SO_PASSSEC 34"
+.LASF2135:
+	.string	"_VA_LIST_ "
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1079:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1726:
+	.string	"__struct_group_tag(TAG) TAG"
+.LASF1077:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2003:
+	.string	"IPPROTO_MH IPPROTO_MH"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2001:
+	.string	"IPPROTO_NONE IPPROTO_NONE"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2263:
+	.string	"baudRate"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1876:
+	.string	"IP_MTU 14"
+.LASF1400:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1681:
+	.string	"SOL_TLS 282"
+.LASF1286:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1513:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2104:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2349:
+	.string	"serialPortUsage_s"
+.LASF2352:
+	.string	"serialPortUsage_t"
+.LASF1667:
+	.string	"SOL_LLC 268"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1124:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1963:
+	.string	"IPV6_PMTUDISC_INTERFACE 4"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1022:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2239:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF2160:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF1297:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2313:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1545:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2115:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF1211:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1097:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2168:
+	.string	"long unsigned int"
+.LASF1055:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2234:
+	.string	"OWNER_LED_STRIP"
+.LASF2412:
+	.string	"findNextSharedSerialPort"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1921:
+	.string	"IPV6_V6ONLY 26"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2121:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1934:
+	.string	"IPV6_RECVHOPOPTS 53"
+.LASF1698:
+	.string	"MSG_TRUNC MSG_TRUNC"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1920:
+	.string	"IPV6_RECVERR 25"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1330:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1988:
+	.string	"IPPROTO_ENCAP IPPROTO_ENCAP"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1894:
+	.string	"IP_PMTUDISC_INTERFACE 4"
+.LASF392:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF965:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1822:
+	.string	"SO_RESERVE_MEM 73"
+.LASF1665:
+	.string	"SOL_IRDA 266"
+.LASF2274:
+	.string	"serialWrite"
+.LASF992:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1743:
+	.string	"SIOCGSTAMP_OLD 0x8906"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1917:
+	.string	"IPV6_ROUTER_ALERT 22"
+.LASF2031:
+	.string	"INADDR_ALLSNOOPERS_GROUP ((in_addr_t) 0xe000006a)"
+.LASF1879:
+	.string	"IP_XFRM_POLICY 17"
+.LASF1574:
+	.string	"PF_NETBEUI 13"
+.LASF1662:
+	.string	"SOL_PACKET 263"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF2016:
+	.string	"IN_CLASSC_NSHIFT 8"
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1788:
+	.string	"SO_LOCK_FILTER 44"
+.LASF1117:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1771:
+	.string	"SO_SECURITY_ENCRYPTION_NETWORK 24"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1707:
+	.string	"MSG_NOSIGNAL MSG_NOSIGNAL"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF943:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1056:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1626:
+	.string	"AF_KEY PF_KEY"
+.LASF1821:
+	.string	"SO_BUF_LOCK 72"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2326:
+	.string	"BAUD_460800"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2221:
+	.string	"OWNER_BARO_CS"
+.LASF2005:
+	.string	"IN_CLASSA_NET 0xff000000"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2380:
+	.string	"delay"
+.LASF1978:
+	.string	"IPPROTO_IDP IPPROTO_IDP"
+.LASF1012:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2321:
+	.string	"BAUD_57600"
+.LASF1553:
+	.string	"SOCK_RDM SOCK_RDM"
+.LASF1954:
+	.string	"IPV6_FREEBIND 78"
+.LASF2167:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF1968:
+	.string	"IPV6_RTHDR_STRICT 1"
+.LASF1015:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1499:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1433:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1614:
+	.string	"AF_AX25 PF_AX25"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1426:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1962:
+	.string	"IPV6_PMTUDISC_PROBE 3"
+.LASF1608:
+	.string	"PF_MAX 46"
+.LASF1839:
+	.string	"__USE_KERNEL_IPV6_DEFS 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF912:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1960:
+	.string	"IPV6_PMTUDISC_WANT 1"
+.LASF1364:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1690:
+	.string	"_SS_SIZE 128"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1981:
+	.string	"IPPROTO_IPV6 IPPROTO_IPV6"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1020:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1301:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2200:
+	.string	"OWNER_ADC"
+.LASF2170:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2226:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1655:
+	.string	"AF_SMC PF_SMC"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1403:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF1349:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1588:
+	.string	"PF_LLC 26"
+.LASF964:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1734:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF1560:
+	.string	"PF_LOCAL 1"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1516:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1746:
+	.string	"SO_DEBUG 1"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1936:
+	.string	"IPV6_RTHDRDSTOPTS 55"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2203:
+	.string	"OWNER_ADC_EXT"
+.LASF1777:
+	.string	"SO_ACCEPTCONN 30"
+.LASF1247:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1013:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2196:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2287:
+	.string	"UARTDEV_1"
+.LASF2288:
+	.string	"UARTDEV_2"
+.LASF2289:
+	.string	"UARTDEV_3"
+.LASF2290:
+	.string	"UARTDEV_4"
+.LASF2291:
+	.string	"UARTDEV_5"
+.LASF2292:
+	.string	"UARTDEV_6"
+.LASF2293:
+	.string	"UARTDEV_7"
+.LASF2294:
+	.string	"UARTDEV_8"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF948:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1270:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF2348:
+	.string	"serialPortIdentifiers"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1160:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1744:
+	.string	"SIOCGSTAMPNS_OLD 0x8907"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1066:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1965:
+	.string	"SOL_IPV6 41"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1851:
+	.string	"IP_DROP_MEMBERSHIP 36"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2495:
+	.string	"rx_pwm.h"
+.LASF2521:
+	.string	"thread-shared-types.h"
+.LASF2447:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2449:
+	.string	"/usr/include"
+.LASF2515:
+	.string	"select.h"
+.LASF2535:
+	.string	"struct_sched_param.h"
+.LASF2468:
+	.string	"stdint.h"
+.LASF2445:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2542:
+	.string	"pthread_stack_min.h"
+.LASF2530:
+	.string	"bitsperlong.h"
+.LASF2430:
+	.string	"src/main/build"
+.LASF2446:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2467:
+	.string	"stdbool.h"
+.LASF2494:
+	.string	"flash.h"
+.LASF2457:
+	.string	"time.h"
+.LASF2472:
+	.string	"wordsize.h"
+.LASF2536:
+	.string	"cpu-set.h"
+.LASF2437:
+	.string	"src/main/target/SITL"
+.LASF2524:
+	.string	"struct_mutex.h"
+.LASF2520:
+	.string	"pthreadtypes.h"
+.LASF2502:
+	.string	"sound_beeper.h"
+.LASF0:
+	.string	"./src/main/io/serial.c"
+.LASF2497:
+	.string	"io.h"
+.LASF2469:
+	.string	"libc-header-start.h"
+.LASF2510:
+	.string	"timer_t.h"
+.LASF2540:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2485:
+	.string	"platform.h"
+.LASF2450:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2466:
+	.string	"stdc-predef.h"
+.LASF2526:
+	.string	"socket_type.h"
+.LASF2455:
+	.string	"resource.h"
+.LASF2523:
+	.string	"atomic_wide_counter.h"
+.LASF2443:
+	.string	"/usr/include/netinet"
+.LASF2508:
+	.string	"clockid_t.h"
+.LASF2545:
+	.string	"light_led.h"
+.LASF2460:
+	.string	"cli.h"
+.LASF2496:
+	.string	"sdcard.h"
+.LASF2537:
+	.string	"struct_tm.h"
+.LASF2511:
+	.string	"endian.h"
+.LASF2543:
+	.string	"dyad.h"
+.LASF2498:
+	.string	"io_def.h"
+.LASF2436:
+	.string	"src/main/msp"
+.LASF2470:
+	.string	"features.h"
+.LASF2440:
+	.string	"src/main"
+.LASF2531:
+	.string	"sockios.h"
+.LASF2435:
+	.string	"src/main/io"
+.LASF2479:
+	.string	"time64.h"
+.LASF2539:
+	.string	"setjmp.h"
+.LASF2461:
+	.string	"serial_tcp.h"
+.LASF2532:
+	.string	"struct_osockaddr.h"
+.LASF2432:
+	.string	"src/main/config"
+.LASF2442:
+	.string	"/usr/include/linux"
+.LASF2538:
+	.string	"struct_itimerspec.h"
+.LASF2471:
+	.string	"features-time64.h"
+.LASF2484:
+	.string	"strings.h"
+.LASF2546:
+	.string	"msp_serial.h"
+.LASF2525:
+	.string	"struct_rwlock.h"
+.LASF2513:
+	.string	"byteswap.h"
+.LASF2491:
+	.string	"config.h"
+.LASF2476:
+	.string	"stubs.h"
+.LASF2463:
+	.string	"string.h"
+.LASF2465:
+	.string	"target.h"
+.LASF2462:
+	.string	"telemetry.h"
+.LASF2486:
+	.string	"common_fc_pre.h"
+.LASF2490:
+	.string	"parameter_group_ids.h"
+.LASF2480:
+	.string	"wchar.h"
+.LASF2473:
+	.string	"timesize.h"
+.LASF2488:
+	.string	"build_config.h"
+.LASF2448:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2501:
+	.string	"rcc_types.h"
+.LASF2509:
+	.string	"time_t.h"
+.LASF2534:
+	.string	"sched.h"
+.LASF2453:
+	.string	"stddef.h"
+.LASF2434:
+	.string	"src/main/fc"
+.LASF2458:
+	.string	"serial_uart.h"
+.LASF2500:
+	.string	"bus_i2c.h"
+.LASF2429:
+	.string	"lib/main/dyad"
+.LASF2477:
+	.string	"stubs-64.h"
+.LASF2454:
+	.string	"parameter_group.h"
+.LASF2541:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2499:
+	.string	"io_def_generated.h"
+.LASF2528:
+	.string	"posix_types.h"
+.LASF2514:
+	.string	"uintn-identity.h"
+.LASF2529:
+	.string	"posix_types_64.h"
+.LASF2503:
+	.string	"vcd.h"
+.LASF2505:
+	.string	"socket.h"
+.LASF2512:
+	.string	"endianness.h"
+.LASF2452:
+	.string	"stdint-uintn.h"
+.LASF2507:
+	.string	"clock_t.h"
+.LASF2492:
+	.string	"adc.h"
+.LASF2475:
+	.string	"long-double.h"
+.LASF2474:
+	.string	"cdefs.h"
+.LASF2544:
+	.string	"stdarg.h"
+.LASF2489:
+	.string	"utils.h"
+.LASF2478:
+	.string	"typesizes.h"
+.LASF2441:
+	.string	"/usr/include/asm-generic"
+.LASF2547:
+	.string	"msp.h"
+.LASF2527:
+	.string	"sockaddr.h"
+.LASF2487:
+	.string	"common_fc_post.h"
+.LASF2482:
+	.string	"locale_t.h"
+.LASF2438:
+	.string	"src/main/target"
+.LASF2533:
+	.string	"pthread.h"
+.LASF2504:
+	.string	"in.h"
+.LASF2464:
+	.string	"system.h"
+.LASF2433:
+	.string	"src/main/drivers"
+.LASF2516:
+	.string	"sigset_t.h"
+.LASF2456:
+	.string	"serial.h"
+.LASF2431:
+	.string	"src/main/common"
+.LASF2519:
+	.string	"struct_timespec.h"
+.LASF2518:
+	.string	"struct_timeval.h"
+.LASF2481:
+	.string	"stdint-intn.h"
+.LASF2548:
+	.string	"streambuf.h"
+.LASF2459:
+	.string	"serial.c"
+.LASF2483:
+	.string	"__locale_t.h"
+.LASF2451:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2506:
+	.string	"struct_iovec.h"
+.LASF2439:
+	.string	"src/main/telemetry"
+.LASF2522:
+	.string	"pthreadtypes-arch.h"
+.LASF2493:
+	.string	"io_types.h"
+.LASF2444:
+	.string	"/usr/include/x86_64-linux-gnu/asm"
+.LASF2517:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\036"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\365\n"
+	.string	"$\021\312\001"
+	.string	"\""
+	.string	"\354\301\314\336\005"
+	.string	"\001\363\330\276\203\007\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\327\214\256\274\b\002\002\005\002\006\004\333\375\377\333\001\005\373\306\354\242\001\002\006\332\321\347\237\002\002\002\007\002\007\007\240\342\234\212\n\b\340\312\235\355\005\t\365\365\232\331\003\006\002\003\002\b\002\t\002\t\n\013\f\346\224\340\266\r\r\360\371\267\351\n\002\002\004\002\n\016\361\255\215\366\f\017\312\255\203\356\004\f\002\003\002\013\002\n\007\002\007\002\f\002\r\020\021\330\316\241\361\007"
+	.string	"\022\201\267\341\302\n\002\023\263\210\303\241\004\002\002\t\002\t\024\344\326\341\330\017\004\002\004\002\t\025\205\246\207\370\001\016\002\007\002\003\002\017\f\002\007\026\225\321\235\326\006\b\020\027\205\221\270\243\016\024\002\003\002\003\002"
+	.string	"\002\021\030\031\301\375\230\360\017\b\032\350\300\306\254\005\003\033\352\245\231\243\n\021\034\246\343\274\353\004"
+	.string	"\035\226\333\341\336\001\022\036\200\236\352\337\005"
+	.string	"\037\220\232\212\335\n !\240\342\234\212\n"
+	.string	"\037"
+	.ascii	"U\220\032h(\246\r\263\267\202\002\025\315a]\007:\200\301L\003"
+	.ascii	"{\223\274Y\256\0232\237\322W\327 a\020\227\b\217\206F\341\356"
+	.ascii	"Mk\344\362wi\227PW)wG5\273\262j\032\021\0258r%\254\231\231h\327"
+	.ascii	"G\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\215\005"
+	.string	"\262\006\023\031pM\322\001\371\277\252\252\252\252\"+N\222$I\222\270\240\032\021B\344N)\256\372\3124U\371\372L\226\222\234\346\007X\360\310 \363\341\330b\354b=k\215vR$\020:\017[zm\003an\260\0220\273\004\022\332v\177\033N\t1 \200\202Iw:6i\306Z"
+	.ascii	"\001\312\3408\326\b\306\311\f\326Fg\301\375A\020bOpm\323c\250"
+	.ascii	"%8[\254\250\324/\3413\305\0034\002\330-m\206\231\341;\206\036"
+	.ascii	"\331\350D\2162dQ\016F\347\335\330\362ff`\330\333o\\F\024\240"
+	.ascii	"\200Cc\036\307\301\030B\016\246\247\245\r\300\342b\016\001"
+	.text
+	.section	.gnu.lto_.inline.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\263\004\225\027"
+	.string	"&\345\203J\300\020)\0354D\3239b\f%\217HLV+\213_\bv\035\320\302\361\177jlJ\3422#\177\311\257\316\340\277\007\263m\262Bv\212*\370\337\024\206\345\215m\212\242p\205B\345p\201IY\271;x[\2234\211\324\275\223L\001q"
+	.string	"l"
+	.string	"x"
+	.string	"!\3437B8\336\305\324\233\362\232 \251\027/\177\274\352\027\244\3710\314+\237\361\013\322\210\254L\236_\220\006\304"
+	.ascii	"\304\220\367\022S\300\253\230\312YL\001\257F{\310\204\266\312"
+	.ascii	"\204\032\212\362\305T\246\215\241(\337\350\351[9m\177P\335s\304"
+	.ascii	" \301\210\331+SG\006\352B\t\3133\360\204zj^\373\241=\241\326"
+	.ascii	"\nc\337\336\334k\255u\3324{\364\004-\234<,`\2319#:\370\0208\300"
+	.ascii	"\255\364\255\274\367^\257n\232\250\265\276\f\302\233<\255\262"
+	.ascii	"\247\240F\253\354\225X\266\032Lq\275\320\364\201i\3566S>9\241"
+	.ascii	"\251\315\266O\371\334(\255I\227\355\221\357~'\264\241\027ef\371"
+	.ascii	"\334$\301\034\243\tLs\263(+\370\033MI\237\222>\2050y@\024\321"
+	.ascii	"X\213\246\241m\221\357\332\323\0019\275\230E\353^y.b\320\212"
+	.ascii	"\264\264\263\343\300\313:\bgw\331\003\261\254,\0240\311\217o"
+	.ascii	"&\311\365\204\201\bH\202%TU\312<\363\260h\223.\321b\356'*\007"
+	.ascii	"\035\243I\343f\f/\350DeP\025\341\240\315\276;\264\263\267\230"
+	.ascii	"\344/k\327\236\204\263K\360l\252\260S\303\304#OG[64\253\243-"
+	.ascii	"\033\231EB|+\327^\330D\271\021\211\252\024.\233\345M\001\366"
+	.ascii	"\255\\\373K\322\333\326>l\032\267\270\333\310\226\213\240\360"
+	.ascii	"4#\322i\273\366%\332\332w\223AX\373\356\324\273{\214Q\210\245"
+	.ascii	"\023\023\360\255\\S\373\365\265\235\2334\003\333 \244}\227r*"
+	.ascii	"\030\245\246\227M\354\327-\002u\337\271\361A\005\375AA%5\272"
+	.ascii	"d\200m\334?\005T\035 \034&\332\006 \034&\231k\246\272\007\255"
+	.ascii	"\bf\250\3414D\b3\020\321\214\024\264\031\016\220\"\232!+\017"
+	.ascii	"\022@U]\245$\021\034\023\241 \201\3620{@\362\265\3319\212\217"
+	.ascii	"\350\315\232\257\317Q'\361\270l>j\260\b\305\242\310\320F@J\t"
+	.ascii	"\326\330\020\336\243\302\270\370^7Yr\007`\221\b\252\351\347Y"
+	.ascii	"\303\005\274\3405\273\341\370\214>{\363\323)\204cu\243\257\n"
+	.ascii	"\036\2670\364\346\315\260a0r\340\332\231\216\305\375h\245Id\226"
+	.ascii	"\373\352\217\322:\377\260\001\362*\372\315\037\303\3270\230f"
+	.ascii	"\0134\212\001mIx\303\372\026\374x\312\bp\013\220\311^\376\206"
+	.ascii	"`\023\r\3370\210U?t\350\233\346\033J\331=\022\254\317l\021.S"
+	.ascii	"\227O_P\245\251\213k\022K6A7T-\335@<\016 \020\003\207\356&:\037"
+	.ascii	"`\036q\243\025\\\253\2368\035"
+	.text
+	.section	.gnu.lto_.jmpfuncs.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`F\002\365\n"
+	.string	"\326P1)\2009\351\034\003P!\003\302\004\2142\212\242\2562&!F\335\314\261\366ahm\033!\211\233\033\b\327`\237\032n+wJ)%"
+	.string	"&"
+	.string	"&"
+	.ascii	"\235(\227\267\303I1\200\265PM\361$\262\302JIQ\n5y\037\304\036"
+	.ascii	"T\226?e?\265mL\266l\230\026\002\022mD\013\321\207\223\342\212"
+	.ascii	"\242\376\230\242\250<\3462~@\353\201\305|\206\241mj0\177\361"
+	.ascii	"Wk\001\306 \337\211jNpR\315G0\031\255\rV\243\342\367K?\377\370"
+	.ascii	"\362\267H\334\003\367q#.\363\233\3178T1\254\025\220\206\020\004"
+	.ascii	"\224\334\344\365\034\337\271\345\353\304E\314\306_n\2435\204"
+	.ascii	"\313\322?({\271n\037\016\362i\016\tA%E5\004C\2501\251u\304,P"
+	.ascii	"f\nY\306`\002!Tx\033\021\300<h\034\242!\n\262\205\315\343U\334"
+	.ascii	"\260\353\225\203\302\201Y\322\303\201Rs~\362\262\271]nl\323V"
+	.ascii	"\275\2122\2443\366-F:+\365\251\325\205H|flDs\016\341\006\317"
+	.ascii	"\207Y\333\326\374O&\007_\361\2105sR\244\021\362\262\246c\342"
+	.ascii	"\251\312$5\227J\316\027\200\201\004\275\344F\201\304\372\"\022"
+	.ascii	"\022\2467NmK\227\277 \276\005P7\020u\244\260F\352Q\340<WM\325"
+	.ascii	"\371\032\256IC\035w\007"
+	.text
+	.section	.gnu.lto_.pureconst.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 La\002"
+	.string	"H"
+	.string	""
+	.string	""
+	.string	"\030"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\271\004\r\205\004\016\205\004\017\271\004\021"
+	.ascii	"\030\022\231\004\023\205\004\024\205\004\025\232\004\026\232"
+	.ascii	"\004\027\230\004\031\230\004\032\204\004\033\204\004\034\270"
+	.ascii	"\004\035\230\004\036\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`C\001\025\t"
+	.ascii	"RM)-\200K2\034\310\220fB\327\343\3661\203\263\256\005\255\t\234"
+	.ascii	"\215A,:\307\343\311[\257\251i\353\032!m\214,\032|\333d\357M\244"
+	.ascii	"L\001GLP`\326\235\330\364\212b)\277\0075\370\250\334\241`\022"
+	.ascii	"<<\313h'\357\247\034\245\234\021\244mh\237\222\026\202ZI\304"
+	.ascii	"I\017<\234@\031:\027\312\025:%\345d\ni\002\376H\271\264^\001"
+	.ascii	"\372\200`B\347\245\374\322f\350hD(\177\347\221-\t6\nc\303U\\"
+	.ascii	"\374<\314\315\237g\250\2551\213\371z\3557\357/\215Je\316\243"
+	.ascii	"6[\312\211\274|2\373b\0026 p\002!32\0172B\214;\304e \254\244"
+	.ascii	"\3611\350\005\b>\212\210^\205\242u\273M\347\205\355a\205\247"
+	.ascii	"\360.\030\206\306\026\357\330\225\016Y@\326]\020\"\226\035W\260"
+	.ascii	"\260t\206o\351\210vY\263\300X\021\n \2360\217p\300E'\320\364"
+	.ascii	"\337\275\331R\030\300w\365\223\025x\025\272T\246\177\206\001"
+	.ascii	"\207\334M\254s\314Ssl\3316n&\232.\215\227\250\303-\277\001\300"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.71f14211fb1f2ba6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.40.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.42.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.46.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 \222\035\004"
+	.string	"T\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us\375\005uq"
+	.string	"\005\001\006'\001\344\r?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.47.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\256\003\355\026"
+	.string	"\366g\217I\240\326Uc"
+	.string	"G\"} x\013l\241\243\206O\312\213\225\365\301\223\021Rl\244\224\350\364\n\236\311\310\257\210\0166\212\025\346\242\273\374C\377\343<\002\347\321\253\200\332\244\177\031\304oC\200\r\244\013\276\004\205\315\276\335{K\231Ru"
+	.string	"u"
+	.string	"~"
+	.string	"GU\316\243\3302\030\265W\3738\236\243\367\242\234\017\270W(j\351^b\003\257\274\216\232x\003\351\321\327\013\244G\335\263\223\2348\274/B\245\340\321\344\336K\263.\374\372I\274\317\332;z\332\332\363\215^\177\242|GOW\217\017U"
+	.ascii	"!\212\323\306\274Z\301#\004\326s\006\320\355\217^\217Y\300*$"
+	.ascii	"!\320\253\353\345\336\353\032\024\376\334\351m\223\260m\301\266"
+	.ascii	"S\001Mk\215=ZG\353\331_\274\204\240_m\372G?i\264p-)\321j\251"
+	.ascii	"\373)\235\035\265v\t\023\365A\253\354X\237c7\222ZX\2676m\242"
+	.ascii	"\257\332!\3736\346\216\f[!\033\366\242\037}\361\256\265\372\002"
+	.ascii	"d\202\2320\023\\\335\253b\353\311M\242\310\030/\376\366e5j>\321"
+	.ascii	"?2\212\314F\355:\276\243\367\242\233^>\237\227\261\270Tr\357"
+	.ascii	"\235\035u\205W'\314\276x\025\226W\013\263\337a\001\254[\226\031"
+	.ascii	"\217An\313\\y$9a\371\344\r\217\202z\242@\344\344\360!NB\234>"
+	.ascii	"\223\332\035\3164"
+	.string	"\203<F\030f5)\257\265i\016\344\266\262\374\201c0\274\367\332\216\3325W\312\275\356\275\020\222p@\034X\022\345\244GS\245 \326\257n\2358\222\315\353^\035\233\337\343>t\347\211\216z\004/}\360\250\317\263Oz\201\374\325-\247\030\231\224\267\006\271\333\346\362\300\303\315\245\346\240\205@M\356\303\215\016&\305\267\226\0204\271\035\216G\323\345h79\032\033\332m\307\243\265 \260N\004nG\303\321\351v4\024\342\275\025\362\005&\311\237\005\332R\030\216$&\306R\221\226 3\334jfe\030s\272ZX\177LjkxU\314\002\226S\341\024L\305h\313\033\035\200\221\251D\355\220]E,\314Z\253:{\265<nJ\253\205\261\322\251N\214T\373\362\253\315\237\367\336\033L\250AL\305\020C& \231PJK\253\003\320\002\231!\"\017\021 UH*\220\241R\217\373\006\n\367vM\201;\210\253\242\365\335"
+	.string	"0\222T\261\311\320\030.Pb\032\332\033X\244<\016\360Uo\262\365]\362H\342X\031\200\324>\336[D\363&\335F\023\335G\177\250\342\210N\214B#\240\274h4f]z#\206\272*\312"
+	.string	"0\325\374\337\311\336\027\006\314/\023\260\202caz\177\003\315\306\303\211$[:\215\367\252\252\221\314\304\367~\207\032\032tw\334\303\330=\321"
+	.ascii	"\033N\360\362 \025"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.48.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\367\001\255\022"
+	.string	"\206#~H\320\362&\035*"
+	.string	"\262\r\225H%\nB\335S\032\200\343_\n\021 \004\327\256\363"
+	.string	"7J/\242G\035\3017Mww\220\263\325\315\316\274?NFr4\310\312\037"
+	.string	"\371'\036&)'\315s\262\273\232FM\032\331[\312\224\002i"
+	.string	"f"
+	.string	"i"
+	.string	"\236\305P\004\250\272\031\312A\3321g\370\215\274@w\031O\240\273\334\037\007x\f\357NgWu2\256\316\374\232\253\342>\271\350\t\001s\242\n\317\217\323s\327\033h\243\235\320\316\345\004 &\033\350\3411\252\020\231\030\021\002\336\3045Jbb\2015\335\347\256"
+	.string	"(\311\006\356\\U+sN\253\r\344p{\267}\263\r\301\326\003\001\271\203\250\360\001c\252\224\035\326\350\342\354\243\254\300\221\341\365\261\255^y/\372UV\313\207w|x\257TkT\037\204\005\342\211\244\306\234\032\246z\314\027r\251\304\303\337\246\361sf\211\350|\fNh\036\316x3H\225\204+\2621gHri\007\"\266O\365E\030\274\232\263\247\251\305\234\341\002'\360.\177\342C4\001\037\241}\246\213\353\355qxlt\312\317]"
+	.ascii	"\213\033\250IB<>\310\270qwo\366\356j5F\210\222\016\202\360\210"
+	.ascii	").\316\252\325\215\241\240Q\323\250\fO\361\342\315YC\361\217"
+	.ascii	"\216\004\213\007\272t\005Yw\333\245/\353.uWKq\277\232#\347\007"
+	.ascii	"M\247\f@\251\303>\341 \272\261\213\373L\367\360\021B\320T\312"
+	.ascii	"\254\r\017\027\\.0/i\224\224\023\226\226\024\223\006%\003\\2"
+	.ascii	"-\t.\026Z,\236[J(\264^1\227\354\203\275>\230W\353\345k\211\311"
+	.ascii	"\276\022\003\206\305\270b\237\f\f\026\373X\266\035\316\257\217"
+	.ascii	"c\232\234:\177\326=\367UP\023\211\270Z)\327+\264\265\231\241"
+	.ascii	"Z\234M\240\244\267\322\2467z\334\333\003\250\232FE\035=qWh*\365"
+	.ascii	"8\347\234\235\267\017\003$ 0\002\242\024<;d\021\374\276\206\326"
+	.ascii	"\314\225}\201\235\330\216\323\3006\330f\030\"\323\242\254\204"
+	.ascii	"l\023I\313\254\253P\264\326\241~\270o\025\243\350\216\022\317"
+	.ascii	"\0175\246\342AC\261N\255:H\270\373\377\225\002\226 \024\357\237"
+	.ascii	"v\213Z\202S\204-\004Jc/e\305ot\332@\006"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.49.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\346\0015\022"
+	.string	"\026\242yG\320\224M:\260\301Q\266PC\272s\364\0247\204\260\300\317\362\334*<\230\331<?0_\277@$\303\246\242mu\263\365\214\305k\221\007{\365\322\007\370\312\225G\325+\026mA\250\226P4P\206\331\017\t\331{K\231Rd"
+	.string	"`"
+	.string	"f"
+	.string	"\337i8r\214\220\3149W)' \037\341\007\310\307Ea\357\260vK\205\275\223\021\256\302\374\233w\260\333\341\361q\362\345\300\226\"D|~\273\352|8*Y\364<N\030\3721\373F\034B\0072\\\004\235|\036\340\336\216\230R\237L\367\267'\030b\232}=\327\356e\316i\235}\"n\357\266ulK\260U\006\276\223\214\200 \341\005\262;\371\242?\256zo\273U\325\367RH<Vn\314\031\"\247d\356\210J+n\373\355\243\ba\361k\376\315)\224!,\266\315K\336\r\217wd\224\343i\316\251\362\350\b\336\343m\230\235\262Q\232X\256/\352`"
+	.string	"s\376(A\232s\256\030\201\367x\030\217\001\263\227`-EVp]\271\377`\002Gs\027\302\021\251\212\331\221\036\021\256n\267:\366\t\356\205\001Y,\b\\\232\343~_4\200\310\024\212\303md\360\346\224\265\3705nD\003/\364h\r6\362\263G\337F>~\017\004)\3054\347"
+	.string	"\270\026{\264\223$i\255\362\333\376\340D\354vH\364\363\0317\301\0215M\215\262k7\2724\007\033X23\255\350\026\227\006\024b\\\0260P\tx\261Z\025Z53,\231\226\211cT\026`Z/\026\315\312\325Z\315\264`.\254b^4+U\001\2730\260^\253\032\227\353\265J\325\346\027\310{\322\261D\252n\330\355\356\372%\2668%\272\2459\345\023\345\256\223\252\\wI\352Bp\222)T\356G\367%\246Q\207s\316)eJL\243\002% @\002\242\324Yu\200\022L\0340\373\214\222\"\241\274&\005\325N\311"
+	.ascii	"I\022\207\232\303_\033\266\3334E\253i}\277\261+\023K\254;Kt8"
+	.ascii	"$\312\305\243\003y\201\241XP&d9^\004\305\231E\342j\030 \037\310"
+	.ascii	"\373\310@v,\241)\242\026\002\245\261\237\262\0027:-&\003"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.50.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\264\002\265\026"
+	.string	"V*\227K\240\324U:(\276\241\0316\0078\236\255S\301\363\032{\342em\324l)\240\360[_\340B\337%\f:\266b\237\357\377\347j\030\330\240 F\3555\360;\215\016\254\026\307\003\241s\376\362E\274\232\361\304K$\3374\t\"{\313\235d\202"
+	.string	"}"
+	.string	"\204"
+	.string	"'L\025p}+L\030\335{\0270\202\362\026\245~\306i\354\230g\340\364\321i\3158\325\020\253\356=a|\276"
+	.string	"y[\236"
+	.string	"y\333-\270|=\317$\345\235E\332\332\224\307\2179\253\262nr\202\230"
+	.ascii	"k\352\212\024\221\022\037\312P2\306\316-\006 \343\017H\342\265"
+	.ascii	"B\250\021\364c\002\234\251-4\362x\361\324\006\350\243\375\341"
+	.ascii	")\322\324P\b\021p\347\224\325r\357e\372\003\352\234\31333\220"
+	.ascii	"\231/0\323\241<=j\305\255\244\017_r\354\301t\251\025\363\031"
+	.ascii	"C;\310|>*\"\342\004"
+	.string	"w\017\263\371\363/I\246l/<\327\023\317m)\323J\371%\031\316*\251\327\322\2758WH\356\017\213\004t\342/<e\276\213\230r\343\207Z\256b\361D\336/M\216\2113\003U\241\274=\177h\327r\311Ha\376\220\031\250\354.\324\225\027\006\313\030|\212\272\367Lp\313\023J\027P\n\245\277\301\027\272\215\335\003,\216>\350\213\337\024\020\333A~\224\022T\223\335m\303lr\224:\340\353=\325\016r\331\264q\303!>z\204\2319\374\b\3062QU\335{\037\030\271\004\020R\005\355x\021\217\274\245}\362#\004\340\270D\366\211\327\361\364\236\203\247\300\347\307\314!~t\211\340s\357]\301q\242\033\337\305-\177\310\321\377n\3719\362\226\354n\372\355\324~\263\232j\222\364\350\025\277\370\2178*\265\361\306\310QwPG^x\013\001\264\227\330\2546\263\305d&\b\332\314V\263\274\302\242\242A\306\322\300\301k"
+	.ascii	"\216V\333P{\261\321f\265\022\226\275:\304j8Z\016v\253\301l\265"
+	.ascii	"\230\013L\206\313\301^'|\363@\303\301^n7\034\254u\336w\017\205"
+	.ascii	"&+c\021y\035\177\361f\224\022T\355\266\266\271\245\3272(X\035"
+	.ascii	"d3\311\232m\177\364\306\327\266\221\340\344\243G*\225\212\312"
+	.ascii	"-=j\365z\357\275\244\331\027\036\245w\035Y\333\354\323\244\220"
+	.ascii	"\241W\0172 P\002A(\031\017\200&x5`\232\031\244\202%^S1\025\211"
+	.ascii	"\317v\267\006\262S\225\275\215-_\205#b\230\020\377bA\0277\032"
+	.ascii	"\267\035\177\031a\f*\027\232p\322(\247\206\363E\303\355\355\257"
+	.ascii	"\251\f\315}6D+>\320}n\212\007\227\331J\306\rr\233H{y\206w@\007"
+	.ascii	",^\242\342\271Kv \023\353aw#\021\230\225\225\t\216\210\262\206"
+	.ascii	"\316\275Z\363\004"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.51.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\252\002]\026"
+	.string	"\306\351\224K\260\324Q:\003\232\214\347z_\036\347\025\372\227\234'o\250\177\304Y\357Ik\033Ok\334x\316!\0378\252\225\266\257\247\202[)y\367\323\311\352\373'\250\367\334\033\241b\252:WO\372\367\223[.o\356\317G$\226\354-w\222\001\177"
+	.string	"|"
+	.string	"\200"
+	.string	"5\027po\021V\216{\317\006\254\200\274}\214\313\260\341\233\201\323\350\307\205\223\265\023V\335{\232|\276\300xK\236\300x\333*\230|=\317#\275\2755\332\332\364\306\277y\253\266x|\206\274z\273\3122u\244\304\1779:\276\b\272\335\200\344\203\327\023z\255\022f \035\275z8\265\225\206<\036<\335\351\351h\377w\272#\230\213Z\352\005\235\266\\\356\275Ly\275\2373yf\3561\263\006f\n#\317@\204\243W\374\362\371\357&L\305 \227^1\2377\264}\314g\247$:&\270\213\230\313'\375\344\310\224\355\317s=\360\334\2242\255\224oR>\001A\362D\302\244\272\267\247\210u\177X\035-\016\374\317S\346\243\374\250\\x%\027\nP\020x\373\315\361){v:\027\310\333\363\225l\\(;\025\346\377\330\301\212\315O\033y]\264\206\276\242\324\275\347\202[\256\200"
+	.ascii	"K\205\322\323xR=\332,xJ\204\330\366\361\245\246\206z\354\356"
+	.ascii	"\035\346\027Q\350\200\016g\244\266\217\311\246]\003\022\321Q"
+	.ascii	"+f\206yS\215}\022\"\335{#\020i\001\200\301\252\033\307q\033o"
+	.ascii	"i\237\034%\001 \216\030\373\300\333\210p_\27210\3421s\210\333"
+	.ascii	"\240M0\272\367\262\f_\343\003\177\305-\313\320\320\363n\3714"
+	.ascii	"\343\355\330\r\305\013\252\375nA\355\262p\264\310\017\376\"\210"
+	.ascii	"@=\344Y\342\324\355\263\215?\003\262\031\330\313\354%\006\026"
+	.ascii	"+A\310^bf\226YZV8\304Z\036@H\0310S\243a0\341XJ\007\330\254&\223"
+	.ascii	"1i33f\006\2031c5\0313\345\204i\036d5s\206F\253\231.f\346\363"
+	.ascii	"\276\213,D\361\f\233\3063\375\301\227RSC\265\333\332f\027\\\347"
+	.ascii	"N\264\332\307e\017[\266\345\321\013_{\207B\021\035\265\252T("
+	.ascii	"j\273\340\350\325\353\275\367\216e\377|\002\334mc\355\262\237"
+	.ascii	"3\224\243\305\247 \0061 @\002\242P2\036h\242\327F\241\216#\025"
+	.ascii	"7\345\356\212\255H|\266\2735\220\035UY\314\306\325^\205\0031"
+	.ascii	"L\026\377\242A\307\205d\030GT[\212A\351\205\020N*\312\211\341"
+	.ascii	"\356\242\001\366\316\323Tvs\257\rq\025\367\377>4\305\301e\267"
+	.ascii	"\262\001\203\304&\332^\252\214\034\351\314\303\025\272\346;\201"
+	.ascii	"\354\004BSD-0S+c\035\021e\r\235{\265\346\t"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.53.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\235\003\205\032"
+	.string	"F\361\252G\260ZM:\200\372<\250\231l\274\0254A\267\355\302j\031\2431\251a\216x\306\373\326\332_\210\353\352'W\220\330\304\377\251\345i\241\365g\344\366P\373Y?J\373\230\272\021\270p\230\372k;~ol\215\220M\344N)\221"
+	.string	"\216"
+	.string	"\234"
+	.string	"H\306\324Z28u\006\326\251\217\363\261]\247\267\201l\227\215#5\316i_\351M\200^\376\270Uk\217\237\224ZK\007V\300:}\201W\362%@\256!(\223j\270\220v\020\345\254j-G\2277\020\236\262^ <]$\203\263v\n\206;k\276\223\203G\222l\261\335\202Non/\276\023\232\340"
+	.ascii	"\"6\036\202\026\230\034\361qs\033\002wI\327\364\336g\214\333"
+	.ascii	"\213\271\337\0354\242Dg\273\331\370\0241\324Z=m\267\032\267x"
+	.ascii	"\333-lo\260\227)\226\355\314\333v\302\024\263y\233_C\033\344"
+	.ascii	"\351\2432U\347\225]\n\315=\262/a\352\351\207\327\310\366\264"
+	.ascii	"K\234\266\021\247[\3414\353\274[\244\323!8M\301i\360\345\277"
+	.ascii	"\002n\234\244"
+	.string	"*\350j\235\361SS\243\350\224!\347\375\366}(\347\371=\273\ft\334w\266\317\227|\246\305Y\261\252\265\272Nu\254 \032\254\036\322\016\034$\343\234\327\371\274\374!P\017c\252J\210\203S\234'\343\241\034\347\347pr\243\375\234\317\237\324^\207h\264f \005\035(\025T\324\026\020\002\314d\261\202\272\226\020~\220\332\036\360\241\004\300\207F\334\363\376\303\203\234WO\265\006^l\264c\361p\337\204\323\357\374\341W@\\\360\322t\247\020\"F\214\bO\305]1\266\033\340\206\233 G\264\206\234?\323\375\316\260[\211\275*\251\326*\241\312me\310\307Bp\351&\310\r\351\020\232?\277\367\313\360\231Y\2520K\274\335\243\335m|d\246\316\364\337\360AQ\355^\367\0279\257<}M\001\346\357\247\220\301\277t);7I\265\222\267\371\276G9\341\0079\r:=\260\022\262\022<\260X\313\023(D \021\243\360"
+	.string	"B\016\001\236\231\254'\306\303\302\004\313\261\034\0240\031Mg\3058\223\215<2X\2121F[1\346\034\360L\205\016m\354\231\315h\243\253$\277F\032\252\232\350\242\200\317\362\367\336:\203F\307\212\353\332\030\266]\373\"W\310>\357/\362\272\337\311_T\324\024E\002\241{dq{\340\240\272\304X\\\300U\360E\211\234\277\027)\"\003\326Z+\270G\376w\227\303\310)\\\020\332,\r\007\306\305L\343\326\356\332,(\206\b\007k[{\2425;s\270TD\250q \305\030Q\f\221\231\241h\202\214Tc@\002B\020R\346\001\021"
+	.ascii	"\302\032\261\345\314\001\266\274\026\260\304\272\300\251\212"
+	.ascii	"$\217\206\006|\316M\300\230\036\303\t\317\237}8\302o\202\030"
+	.ascii	"\337\372\307X\241\200\357\001\3077CsB%\271{K}2\243&\241\204Q"
+	.ascii	"\245g6\213)2\222\177\342\204;\213\240a)\216\016\347\240\270!"
+	.ascii	"t\323\304\257C\260\352YW\312Fg\206\037\327\340\\\345\212\336"
+	.ascii	"\013\221\242\270\225k\001\222\316YR\262\001\304\245\200e\001"
+	.ascii	"\3223\037\216\211\034.\032\261\177<J\214\334\365\264\t\234~"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.54.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\314\002\255\026"
+	.string	"\226\251\224L\240\024R:\025\350+\316*4\032\003I\035\306\305\003\315l\337v\322Gg\2168\016\272\354A\021L^\341\333\354[\366\273\275~-\177\366\273\305\266\307\233x\035FJp\305@\017\270\002\252\337R8\326\b\001u\331\211J\b\331D\356$\003\177"
+	.string	"x"
+	.string	"\201"
+	.ascii	"h\255\017\362\221\236\224\363\024\207D\271:+x\234\356M\0310\313"
+	.ascii	"y{\200\374\321k\344p\256@J\344\363\032z\301+n\335\233\242\234"
+	.ascii	"\236@y{~@y\333Clk\356\2455\311\2569\376\210\2271\337\316\203"
+	.ascii	"\273jQb\374\334\264pt\354\371\200N\222\021l\320(\212\371xd\013"
+	.ascii	"\225\240N|\345\361\351\324~\360\bdD\355\216L\276\237W3\346\336"
+	.ascii	"\313\265\347\3639\237gf\022\314\\\201\271Z\005]{\245\270#\264"
+	.ascii	"\253]|\342_\302\210\325TE\204L\335\300\340\001\030\257\246nU"
+	.ascii	"\302\234\356j\003\231\3572\025\204\005\367\217\371\351\037\203"
+	.ascii	"q\345\263+\233e\345\262\254lme\222\254\334]\271~x\376\211\210"
+	.ascii	"\273u\005\241\353\336\236\256%W\210}\202\361\341\317|\025\"\372"
+	.ascii	"\342\205/\225\"\312|\342\207\271\337\235\023&=CFF\356M\025\334"
+	.ascii	"\362\204\363\366|a\016\363\213Y\305(d\202\262l\334\220\210NM"
+	.ascii	"\302\261\266]6i\305CA\266\355\363\270\230/\334"
+	.string	"\007\006K%\265\325\203\207\354\004+jk\307\237r\345-\331)EH\001\214Z\260\376\3608)to\312-\250\3521s\210\0333\334\370\242\341:d\022\252p<\307\21463S\336\302\272\255z@fw\257\024y\\\272\332\305\265\231k_\252\371\221\350\336\353\302W\372\215\016|\027\267Ls\253\357\335\362o\345\355{Gt\257)\315\264\033\231LM\306&\233\231\360\013\314\203\r3\230\006\016Z\004\330n\265\233\231\r\004\207\223g-\036d5\034\315\006\275\325P[MF\203\316p6hK\n\337>\320p\350\315\355\206C_\251\356\375\243pLRj\262w\372\2117\311\322\022\"\337'\237\3151\272\336\265(\033\310f\253\030J\001\2519\177\230\3152\004\351\301\177\206\211+\362\336{m\003\371\357\245\240\037\224\331?~\226\226P\303\372\315\303\0343\"1`\f\302\n5 @\002b\214a\363\266T\002D\233\237\303\212\335"
+	.ascii	"l\264&\224)0\344G\377\fT\321\216\211{Et\\f\366\256\337\017\245"
+	.ascii	"@\273\260G\306\020231\374\303@{G\220\305;B\360\210\023c\211\307"
+	.ascii	"\201\3104\203\206\221\354\226i5\214\001\213%\016\034H\"\374\030"
+	.ascii	"4j[GqR\214\257;\016\310\233\3416\n\331&|\234l\313\327\327C\250"
+	.ascii	"\312\352\310o#)8\026\306\300\321\032;\367j\303\023"
+	.text
+	.section	.gnu.lto_determinePortSharing.55.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`w\001\025\020"
+	.string	"6_pG\340\322&\035\203=\222\f!\340L\311\200\310TBj\032\035O\275\251\362\001\251\356\261\027.\352\270\237\275\332Ah^A\270+\034\352\r\373Yk\304\0307\024\022\225\253\373/SL\231I\206\326=\325\2511ido)S\n_"
+	.string	"U"
+	.string	"]"
+	.string	"$\300\222\221\214\233\241 s\206\\\311G\264\313\370\002\332\345\216\370wM\306\325\3177\2013\327@\\\306\222\033H\"P\340\206x"
+	.string	"\206c\024\343\002\027\216\035\024\330\212#E=@N\240\215nD\361\301\211\201\002k\342\t\006R\212\307\2569\240\215jIe\316i\345"
+	.ascii	"~\270K\267\335\331\246`\337'\366\343\334\227"
+	.string	"}\241\277\364\360\227VG\251^\251\326\250\376\026`EQ\204\331\234\036fCf\016I\303\204m\031\373d\223\270NV/\244!\n\230\255\236\240\t\333%\211\316\211\252}\240\007\311<\214\371\2009_I3\346\f\0318\301v\351p\263\355\377\234\205\214\277\030\006\013\323w\370\371QC\356K\304\207\022\251\320\235\035:<\342\302|\005\332\356}J\253\273\253\331\270\tQ\2433\177u\177\223D\2433\333\336]`\330\346l=\360\207X0\333\234\363%.\277\b\216\200ht\366\3559\321\342h\035\243\311e\211\035\265T\210\037\273\211\b\205\216\2512;\234\321\205\005*\257c\245T\031\\6CHq\300\222Ji\200bB\240B\347\242\362$\260V\336\213\311)\023\013+\335\252\005\206\363:N\325\255\\\340R+\030\316\304\200\275\227\226\025\307\362\274\025w\n\347\343\334\227\317#s\351_\\\343\377i\"=d@R\377i\217\035"
+	.string	"\217\314\265\376\247\305\315\261\035\327*4[\243\005\030"
+	.string	"\200C\260\303\320c\373"
+	.ascii	"of\tR\306\300\202U\r+\305\243`\352\3005\272\205\201 \212i\334"
+	.ascii	"\300\020\206kbDl\354\263\205\271\204,+\324\020pB\22068\205\320"
+	.ascii	"\222P;T0\315"
+	.text
+	.section	.gnu.lto_isSerialPortShared.56.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\300\001-\021"
+	.string	"\266\241wH\320\322(\035\"\025u\350\216\004[\022\003 bC-\257a\025\001M\rRD\004"
+	.string	"\315&\334\263\266\203\352\201\327)\f\373\rY\322e\3103p\212\226r7\020\324\320\2435B\313\344\016\256\2429\023\f\374A\376\336[\312\224\002a"
+	.string	"`"
+	.string	"_"
+	.string	"H0\346\274%\260\201\356\321\267\017\220\217\335I\344\243m+Xy\371\346\267\021=\377\231\241#\2244\347\315\333\237\337\\F\270z\343\037w\027\0236\334\216\f\347\262\303\343\006\205&s\316\223,\246\013IfDG"
+	.ascii	"d\032 \312Q\355\303qW\036\031L\265\004a\316i\335\221q\270K\267"
+	.ascii	"Mc;e\337(C\177w\333/\241:J5,\251\267\244V\251\376)@\221\321\203"
+	.ascii	"\334\234=9\037\223F,*a\373\366Y\274\354\223]\222\244\022\365"
+	.ascii	"8\177\305\205^"
+	.string	"\037\252\201\"3\026B\306\204\356\321\004\346P\201\372 \377v\025\257\003eP\221\031\203\365D\350\036E\264\244\206\212\352S\370'\216\342u\233\315\005\314I\013\264\023\t\267\005d\277p\013\330\330\327fD7\340\001\271\373\243nuw\345\016\035\0170\315\371\253{\235\0379\232\263-s\0273\335\234\261\006~\013\326\327\221x\374\236\340\260\345h\356zT\233\305X\333H\271!:\202\220b\312\303'\020S{\3307\034]\037\373p\3169\2754\333j\323\201~\220\007\253O\345J\255j\\b\\*\n\026^X\250\230\326\210L\013%a\365\251\\\251U\rL\210\035\260\254TH\261,`\2202rA\005\263\372Z\\\254\217\306\344T\n\006\224\212\365\322\362>\225\267R\241f\274\024\253\345\245\020\360G\363\302\362\\\337\307\362N\267y8\227f\215\b\256\020\345qyl\233\326$ga\216k\352\344\372\310\025Q\233\275\210\033\034"
+	.ascii	"\200C\260\301\320\257>\2149\262\310\231\"\020\370\301\244\006"
+	.ascii	"\215\241\022\006\002\204\002\305\305\350\240\025\024\004D\032"
+	.ascii	"b\032\002\257.\303\200y\340\212`\260\247F\301\261\bj\213Z\210"
+	.ascii	"\224\204b\324\354Yi\220\265N("
+	.text
+	.section	.gnu.lto_findSharedSerialPort.58.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"e\f"
+	.string	"&\030XC\020s\232\016s]\017\205\245\377\0250h\276k\006\353k\225"
+	.string	"\244\303\215\001@\374d\371\021\272ml=\034\353\206]C.8\030]\"\016\320<\310\nj\247\007\302\237bu\324\327\030s\340\255\021\333m\313\224\002B"
+	.string	"E"
+	.string	"B"
+	.string	"2vg\002\237P\227$j\333O\361\227\317\240\003S\3442\355\340\301\"\003dwZ\236/\240\271\244N@s\031K\034t\005\371\227\271\204\002f\024\266\200\327\311\301\356Z\303\026\227;\336\366\211m\t\366\037\004$\354K\033G\330VO\217\371\345\347/E\365\251\001>p4\370\261\013bF\310\336\2203N\330\376\354\021\333\304\005GZq\026\337c4H$\333A\204(\205\272\254$\223\027NT\373*\016\363}n\260\334\rQ#\321\266\220\351\303)V\036\"h)>^\007\313\220\220\316XG=D\3647\r\r\202\277\305cx\004\210vC\017\375\027\207\261\342\233\270\364\346\321\207\227\276\247\373\350CW\037\"h\035\331\310\261\032\304\236\240\306\332\226y\230\366IQ\361\262\b\024:\334\245\322\225\230\001\312\202\t\030\nG\301\246\344BwA\320\266\314\303\264O\005"
+	.string	"\3066\030\256\214\353t\326\226YZv\255X\030\327Y\033\003\3362t8\313\3336\316\032\231{O\261\nE\016\016\2402>\020"
+	.ascii	"\242\223\240\314\2000l\020;=#\232f3B\270&Fj\241a&:\020>\030\005"
+	.ascii	"\307\340T#@\304\223\272bj'\031"
+	.text
+	.section	.gnu.lto_findNextSharedSerialPort.59.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`b\t\2156"
+	.string	"\312]\350\024CP\246U\007=\203\357\232'H]\002\335\035\360R(\234c\177\035\317(\321\320\177\205\245\324R\221.\333@\270\232\355]\177<DoM\242\237\210&j\3377\231\317\272"
+	.string	"\275P\264\017\226e\343&{o)S\n3\001.\001F\001\261\220\335\376\235\007\r\354\313\211\366\206 ;|\363\2035\375W\362\205\352\234T\361\254\275\353J\360\273\b\244\206\376j\374\327 @2|\257\344\357(\250N\212\026\267\266w\034\341]\227\001\277\353_mr\347\275\233\335\235\334y\356\b\236\206-\232\347r\3724>\332\242\335\224\202\205\004\374\356Q{\300\320Pg\3677\363g\234>\026\342\356\336S5\353\336\361\004o"
+	.ascii	"\277[\224\237\314o9\371\262@lE\232C{sv\261\355\035#y\374\003"
+	.ascii	"\336w\341\017\360\276\253\253\300\337\306\357\260\373\364\362"
+	.ascii	"\177\276\036o\247\203s\257\333\352\274\364\177\372\037\364\352"
+	.ascii	"\273\240\262/J\n\345{A\265\251@X\322\253\347\265\360\302Z\375"
+	.ascii	"\256\235\320\245K\332g\241O\332 \030X\325\2179\311\27267\005"
+	.ascii	"=\373,\264I\253!\020 '\217\215\312\260\002*\322\252\317\265\036"
+	.ascii	"\312h]\371E\235\255FS\235\363\331W\300\005\332$\2779\020\330"
+	.ascii	"\207\220\225V\365./J$\267Y\250U{$\366\371H\264\231\365w}\013"
+	.ascii	"\346\314\332V\033\226\024\312\347\034\210\275\267\347gT\372\016"
+	.ascii	"|\367\227\340\356S\356\260U{g\3607\373\263\031\376X\336u\032"
+	.ascii	"5\362?k\274\357\376S\020\363\231^W\2776\202\213\272\202\312q"
+	.ascii	"\376k\376\245\302\342r\025\316\224@ZS\273~\027\006\227\335\331"
+	.ascii	"\315=\206\312\232\332\206\3113\352z\212\273.{\001]v!\001_\366"
+	.ascii	"\001_\366.@g\017\360\327\367 0;\200_\366\"\317\016\004f\377}"
+	.ascii	"\232\177\337\307\377\275_\366\235g\177{\331]_\366Vg\317\275\354"
+	.ascii	"o`A\332\225U\0258"
+	.string	"\215\026o\252\270\267\215u\305\264\374\365\277\354\375\351|\231\177\326y\356\364W\177\254;m*\016Y\330\343\333\361\307\003lvi\221\335)\0365\343\035\375p\006\033\341]#-C^~\262\343\337)\266\361\216\276`\262\366\204f\325\320\307\232\324\321\321\356\252xK\337\312\313\272\305\246\204\3375\352\032>\235\227\343?G\315\234\343{\361\240\"\362G\316\321?\216\321\230\241\373\307q\013\030\216\017\207\351\350)N\220\205\335\3222\276X\323\263\361o\363a\377F\303I\303f\205\237\240p\225m\330\346\2676}\032\037\301\375E\fU\335\300\333\n\373\031\352\374n\232>\\j\177\365\245\230\034Ut\263\2072\020Y\222\001\2429\244\225\241rsY\346\257<\336w\007h\341\0253\275\257kV\200\376\262\0072e^\363\023\017\tV\236\177u\217\221\367\222\314\007+{o\r\211>nYfy&D\210\367]\001Z\233=\227\004u"
+	.string	"\2353s&bf\377\245\276\310tu\252\355\315\253\251L\357_\237\305\2247\206\375\335W\035<\257\333B6m\033\324\352'\373#\246\213x\267\021\033\224t!jck\365\353\031\373\026J\262\333\352\346\247\304\222`\231\331\315\337\0242b\345:x\001h\021?\335\323"
+	.string	"\264\001\263\227\262G\252\325>x\213\364\237q\355ifD\356\323;]\244\337B\316\252\237\336\351w&\362\022O\310\204n\020!\255A\202T"
+	.ascii	"\363\304\261\255}\240\344\373\356O;P3#\366*\254o~\027V&\317\316"
+	.ascii	"n\356\323o\375\254\337\315;\b&\330w\230\366\304\222dw\332\277"
+	.ascii	"\327\037=\233\377\223d\360Ow\017\362~N|\233\264\275\233\032P"
+	.ascii	"|\037\025C\242\274]m\355\335\314\260\347\371\260p\361\342\005"
+	.ascii	"\fO\302S\251\b\252\264\n\317d\312\314n\356\352\254\215\340\234"
+	.ascii	"\211\264\273\214Gc\372\263\264\035Hb\361FQi$.\025wD\034I\311"
+	.ascii	"\027J\344q\005\360\007q\311Xtq\024o\030\217\"\224\310c\217\035"
+	.ascii	"Q\231\264T\\2&)\351H\344P\026a,\021\221I9\222A\327\260\001\203"
+	.ascii	"\r\245\r\303\013\024\202:\222I(\214\307\242R\311\330t\243\347"
+	.ascii	"J\024v$\025\221\304$\322\261\210d,&\361@RB&\221(\b\375\330\203"
+	.ascii	"\210DR\036\217H$^\314|=\205\204Z\223j\230\317\177\371\376\330"
+	.ascii	"\357\262D\377\360\200\372}\265\203`j(\351OS=\247\261\270\310"
+	.ascii	"\334ed$Lp\226ru\203\367B\0057F6e\363i\352g$j\226\234\365Z\235"
+	.ascii	"P\027Xv"
+	.string	"\311\317\345\0278\033I\261\f\003\357\275\201\232\201\232\031\246\030\024\016SSR\274\214\006\353\355jk,\0355\032\267\t\332\331\355=\206z\341\231[t\247\251$\314\334\252apf\376g_\005\221?\316\260W\200\026\352#\376:^\241~,.51&Y\241\376:ed\377c\317+\213N\333\326\240\3504\325uc9\002\332}\272\377\366A}\004~\2467\330\036\302\n\352\277\266{\357\r\023\320\177\375\243<\037\324\004\364?\225/;\331\255\263\236\206\314r\003t\253\221\001\200\275\250q \304\224c\f\321L \022F\222$\035`\002\021\252\272z\022\240\346\265VHR\240l\354\277\001\020J\252\031O\242\257\212\247\325\303]\211|HKR\257\320\310n\002b%\006lI\211p\2371M\212/n\0334'\001\005\322\3325.)>f,=V\261\301\253Z>\nQ\036\355\333\253\350(\341\2052\366\230\027\357\277\327<"
+	.string	"\232P\375\335\257\326\242\203\332\314\233=\243\250B\2241"
+	.string	")$ \261\371\026\353\332Z\313\024Km\036\222\2724a\356Q&`\024\340\233\207\350\314!EF\264\\\017e\347h\007\207'\261k\301\237:\233\212\300V\246@;\006\035o\342\343\251+E\275\207\326+$\336\326\204\230S%\003\013\314b\354@b\315T\221\251\023\256\242\267LC\345eMW\334$Y?}\364\341[\340\026#\337\222;\333\016\003\320\224t\343Z\260\326\354\361C\322r\244\265r\f\336t\316\313\321\302b\356W\362\352+\236\275M6\330&@\023,\234\344\r\017\3741|\300\241\320]\315\345Mq_\006\225\321\315\303\227\313W\312E\315\206\335\241\353yy\236\200\1776\034\350w\241\030\315(\275\261<\225\367\277\266\022\240\027\241\232#\370\263L\241\352\215-3x?@X\344\326f\352=\177\353\242\3770t\214"
+	.ascii	"7\b\220\f\313\346\313{,\224n2A\367\266\205\374h\254\006\202\345"
+	.ascii	"\320X\362\330\266L}^\035\246\234tJT\001r\206\205\020\365\003"
+	.ascii	"\311a\312\360\007"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.60.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\365\006\225,"
+	.string	"*P\240\021F`\\N:{\231\245\360-\265^\021\245[@\224R\235@\3758\260"
+	.string	"\205hn\216\327\367\b\210y\221[F\312\250\345\356\303\024n\370\343\351$\003\357g\327\244+\247\302\341G\302\355n\367\337\306\3326i\204\020\271\223\f\007\001\364"
+	.ascii	"\013\001nL\274zt\342\364\266K\271z\224\355\330\254&\373\006\007"
+	.ascii	"\267\327\266\355\006\366*2=\363\025\237\215\211G!N\207Z!\263"
+	.ascii	"\240-\230\223\234\337S\351*W`\217;\234\356e\376\363P\256\276"
+	.ascii	"\326\342=m\333\343\213\225\266\205\036\340\001\354U\206>h\275"
+	.ascii	"\312\376g\275\232\200\301\025c\035\n\004\354iA\272\242~m\013"
+	.ascii	"M\366\017f\237B\317\305\213u\243N\2218\024\262\301UM\373b\361"
+	.ascii	"\263nL\r8\323 \266\256\253\223\006c4\311\034\257\231#m\342[\203"
+	.ascii	"\343n[\267(\300\207X\331\211\306\260\256\341\221&\331\025\246"
+	.ascii	"A`C\274\216\327\304\221\032\330\273\342\346r\027p\2449v\331k"
+	.ascii	"9\037L!d\251\001v\274\346\215\364\006\321\343#\206u\3355=:\273"
+	.ascii	"\3148^\223,M\n\303\003\r\363\2524\236\032\303\\\244H\271\337"
+	.ascii	"\2570\256\333w\273\201\271)\317\2773\261\262\337`\204\266m\371"
+	.ascii	"z\205\211\235w\316\374#f\256b^1\004\317b\246m\271\232\2562\227"
+	.ascii	"x\025)\266m\271\032P\301z.\357\006D\355*\277\305z\365\250\323"
+	.ascii	";\257\032Z7\220/\367\303\250\243\201\327o1\376\2564+\375\321"
+	.ascii	"Cp{\232\344\354\326\311\300\273\325z\350\037\230i\331\330;\333"
+	.ascii	"U\032V\374\372\332\033\207\031\232u\033\215\371\f\327\276)\343"
+	.ascii	"\356\301\234\204\364\270\363"
+	.string	"\321\327~\001\352e\244z\331\210/\037\037=\027\021\r\005/\013\361\345\240\3652\320z\371g\275\354\263^\356Y/\363\254\227w\326\313F\365\262\316z\271\270^&\256\227\207\352e\341z\231]/\007\327\313\253zY=\364\234\256\227\257z\371\003\226\314\234eij]\006\332\202\005\312i\301\250X\210<\356\217\376\3207\363\217nN\3747>\334\345\230x|sb\216[\361\226\331\024\212\351\305)\353\246X\261m\221`\\\332\226\275\266\205z`\257\036\2338\361\243\360\003@\3753c\335\222\013#J\2225k\243\t\363\306\274\244H\315i\023\365P\177-\035\250\251\332\274\024\353\220\340\265s\032\254\330\266m\317\374\224_0\013\374i\240&1\207\211e\313\357\351\004\363\351\237\356@\327u\243\247y\332\247\035D\231\316\224\247{\232\303\335N\027\233\247\225\350\376B\312Y\230\261w:y\247\323\306\003\177\3534\323\034b\263]\354"
+	.string	"v=6G\006\311\260\211] O\330\303\373\026v\201(\023\260o\263\035\274c\026\t>\271S\363\346l\267\256\035l"
+	.ascii	"i\324^\373K\177\253\r\200\216\t\270ed\250#h\251H}\350\221\267"
+	.ascii	"Z\211\032\251\233\216\351\334"
+	.string	"\272\201l\254#\273\230\267\247\231\224\300j\324\227;\333\327v\206\353\302\341\237\300\3726j\276]7\266\372v\332\246\013\2209\352ZF\250l\3100\261\313\"\205@J\036\223:\254\347\222\257\266\242\207\364\326\212ucxGm\303L\353\312\212\005@\332\226\353^\314L\341V\224\001#\224\"\246N\f\225 X\026Q!\246\224j\212)\025\313\247\024TK\013'\252\244\212\334\344\200\001\b(\007\n\0260\371\224\200\212\"\361\264\3040B)bj\371\364\303PL&>(\251\242\252\222KerJ\371A*\tEU\225d\032\342\345\211(\252d\212\345\222*I\204\266\357\036\022\364\002\337\252\350\374X\353\345>A\257\313[\225\340\307\374x\354\333[NcZ$\352\364\336j\025j\020m^\002o\265\246-\324}\227A\007\364\257\257\211\217YD\247\321\230\210\203\230\324w;\3737\346\274J/\352/N\211C}\266\263ml"
+	.string	"\336\317\235\250\277\212\372)\360\214\350\3368\\\324\217>m\333\266-&\365\243G.\275\250\223\372L\247\333\207yc\315\277\333J\002_\210!b\255A\3755\236{\324\314\037\240\356\275\202\032\205\031Wg\261\220\f;\265\2551|C$Q\215\372D^H\232\332\032\341\226\033\235QA\266\367\327\247\265\345I\032\333hGz\302DF\260\321\270<\200\214\250Q0\305\214sH\315\210\210H\222\244Y\003P\0021\310\254\352\001\020hw\332\fc\034\013\344A\0059o\345\233\t\265\272_\271`\216\320\b`\353J\274\037J\r\225HJ\bx\2052\353lapu\311\266\360\232#l\335#\346V"
+	.string	"\213\\\n\211\227CI\336;"
+	.string	"+\260\370\355\200\337|\271z\351\240J\272A\304A\226\272\305\355\225\255\326:\035\330\270w\3441G\326hf\317\337k\341\373,#\f\340+\217\016a9Lg\356\307\275l/\017\356O\217\247\026\020\004\205,f\272@\036\fgY\222\313f-"
+	.string	"\233\304.\013\022\251D\345m\004\333\305\361\r\340D\245Y\266\005\341F\363\tw\336\314\346\324\266"
+	.ascii	"\3633sP\370\372\235\003\215&\361c\351\335rt\"Z\n\003\025\371"
+	.ascii	"T\024WN\226\306e\364\301\020\b\bZ_1\274\207F\240\021\231\213"
+	.ascii	"B0\3242\300r\021&T\366\340\205\321\325\375\024`\b1r^\222U\206"
+	.ascii	"\256\212[ \3324W\301&\340.\346\233\342\022\300\215\223\331\362"
+	.ascii	"E\357\333}\223G\032/\370\376"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.61.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\321\002]\027"
+	.string	"F\253\232K\240\326Q:\200\rK\240\030\301\031{\334\233\313\030\017\320xH\3162\206a2\254\271\300\034%\217\330\226\325\316x;\301\037c\356I\354\203\264\351\253\033O\341\r\274\n\374\200\327\271\206\312\300\343\244\013_\0373g\240\261\222O6\221;\311\206"
+	.string	"~"
+	.string	"\207"
+	.string	"0x\216\356\220\002\256\317D\210\034\367^\004|\300\274u!\337\342.x\230g"
+	.string	"m*\202=\375~\254\264\356Ee\214\276@yk\236@y\333'\330<\211\236\313\312\273\253\264dW\036\277\347.\322%DTd\005\370C\3128a\202\364a\257\226QF\2675=\216? \210\223d\203\027RN+\300\016dW\245<\236\276\002\001}\265?|\305\"\366\214\314"
+	.string	"\032\275\272h\356\275\\\177\300\242\263yf\00623\005\346\032$\247\272J\361H\310\255[\314h\257v\220\371|e\3640\202\233\211\371e\036\375]'\236K\256\334\027\236kW\276\312W\250\320rR\363\343\336\241\343\224\013\304\352Hq\342/|e~K\317\3541n\005k9\323\023y\277>D\257\241\247\017M\356E'\230\267\261'\263[\275\nv\0333\316\230?\0242\226\331Cd\2464\202\232\334{_n9\202y{~\025\0173\2149\2265\253\365T\374\251\007(~P\206\330\016\362\215Q>\272\354W\0031\257\024K\304|\247\022\262\203\354\352\367Nx\304W\2450\363\205\357\330\261DR)\035W7\001\214D-\034\317\301+o\337,NS"
+	.ascii	"\212IB\312>\361;J\347m\360`\262~\314\314\3415l~\243\351\336+"
+	.ascii	"s\313\254;\215\233\007Y\367^\0062>\003\207\017u\313\032t\352"
+	.ascii	"\177\267|\235\362\266\354^\3623:\353\221\237\376AE\021\235\n"
+	.ascii	"E\271j~q\240t\016O\262X\n\267\034\232\rg\313\321j\257\r7[\016"
+	.ascii	"gYffA\205\332L\002\0051\003v7\234\005\\N\356f\303\251p-\006\003"
+	.ascii	"\r\267\273\341\310t8Y\016G\263\221\325v8\262\030\026\326e\270"
+	.ascii	"\355d9:\335N\006C\3177\223\204$H)\216\3627\376\364/c\224\017"
+	.ascii	"\362\325\335\3154g\367\222\\\035d\030\2225\273\221\324\227W\306"
+	.ascii	"*kC@\342\253R\310\343Rm\232\263n\235\274\367\336\262\203.g\335"
+	.ascii	"b\230\3276\373>$z\365x\250\342Q\3555 P\002AF\331:\200'\030\r"
+	.ascii	"\230z\006\332\203!^c\323\2652\307\025Y\034\357\030f\f,H\350*"
+	.ascii	"\301j\022\341^c\2014\250\270\020\t#\213j\203\321\177\002|\335"
+	.ascii	"q\262\360\216\260xD\006\251\340\n\f]\203\f\007{(\025\224F\203"
+	.ascii	"+\\\023/\202b\235\225\217\273\366\200<\246n\270\026L\255\216"
+	.ascii	"iC\007\321y4I\t \313\341\341\274Q\013\314\324JXG@Ys\347^\355"
+	.ascii	"{\002"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.62.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\237\004\205\037"
+	.string	"\266x\307K\240\326Q:\304C\270\341\222\243\304\201/\326\300\333\037\352>\360 \355\025c\016\031\312u\022h@\331\2774I\213#\362u*\244j\320.}?|\360r\234\034-\340\017\334\200\3441\253\213\273\340\025HJ\240\260\267F\b!{\357\235d\261"
+	.string	"\252"
+	.string	"\265"
+	.string	"h\320\322\013\257\234\201\264\343\256p\0367\360\224\361\260\325\332}\037w\342\375I\247\321\234\223\242\024s\316\013:\301y<{\201\362\370\236@y\314 \206\327;\007\312\020\372\222\321OT\226\234\2015\033\243\317_\340\033\327\235\243\247Y\342k\353N?x\005G\"$\216\"HJA\364s\246c\210\250\232\227"
+	.string	"\221\025\327\267\206X\334\027.\246\242\007\177jy\315\240!\256"
+	.ascii	">\237+3EJ\321\211<\025\347P\361{!8\355\230\021\300\327s-\224"
+	.ascii	"\260\310\215\257@>\237jO|=J\3614\241\362\251x5'\344\234\273\366"
+	.ascii	"|)\336\260w"
+	.string	"w\260\2731t_^uK7\220\247\332\237\361\212\t\027m\225\272mm\030j\326>_|\233]\273\374\360\215\377\364\337\262v\305\265\037[\240t\344b\351\3106\001f\241$\227\254\205\205\340\370\360/\276O\365b\337\330\261\376\324\207}\"\357W\3358\007\322\267B\217\304\330q\325\315S\371\322\310\352\222u\331j}\325\223\316\200\374\022\\@=\257\343\003$l\247\372T?\310\2014\b\216\320\022\n\231\025\333\247\036\325\027\312\256\330\272/\304\271T\037g=\300\354\203\200\245\345#K\316\371\302\243p\272c\307\357\346\365\203\035\223I\331\016\374\017\336\241r\236}\206\002\326>\251\264c\013\364>\226\330Rx\322S\265$\223\260\235\220\336\234s\306\250\375\360\345\330\242\366>G<5\371\032H\242\033=,K\256\375\365i\257\335\005\235\364T-\375\253\246y\022\035\314D\270\003\311\221\234\200+RY\262n$\307\032\230\361\004"
+	.string	"id\332\027\257\203\224\026\311y\351\352\335\034\211\373PF\316Y\346\370W\315\341\307\234\204\256\234\363\203!'\342\241_\343\270A\350\352{\272\362\330\2646JoEZ\223}\343\177\002\331b\313\n\203\276\214\266i\377\360\021\220R\342oS\322\325aH\242\255[\035m\312\201\364U\345\332W}\226\326-]\200\311\353\213J\016#p569\214\273\271\325\344jln4h\313\314\304h\240\231i\340"
+	.ascii	"f\300\016\227\333\220\273\261\301\325\344`M\003\363\341\226\333"
+	.ascii	"\341D\324t\271\232M\356\006\242F\263\023Q\2031\320\272\020\270"
+	.ascii	"]\355F\247\333\325b\300\364V\251\353I{5_^K;K-OW[\332\377tIk\262"
+	.ascii	"D\355\357\306\274\370%O\253\324}+o\217%\330\235\341Z\267\263"
+	.ascii	"\237\325\001w\346\234\355\203\257Y6\220\216\234\236\322\232\374"
+	.ascii	"\314\222T\017\323\376,@)\022\022\361\261~\343i(~\204\326\264"
+	.ascii	"0\013\324X\207Y\0010\250(\251H\343\026\314\036jX\374\203\207"
+	.ascii	"51y}y\245F\245\375u\254\350\242\001_\250\201,\304\030A\n!\031"
+	.ascii	"\221@\002\"J:`\002\031\"\264\016\020hH\243dZ\003\200*\206\027"
+	.ascii	"\303\016 9,\344'0\303x\242\357w\222\254u\2407\226\235Y\026\307"
+	.ascii	"\370Rw\177\n\2506\027P\300\023m\006\255Z\310\r\207\027\261\020"
+	.ascii	"\321*\223\006\362:\260\3630\302@\345\n\267\037sZ@([\213C\244"
+	.ascii	"\3546\341%<\f&\202\311\330\222\220\252R\003\333<\235\254\022"
+	.ascii	"w\032\252\003\200s\206B\033\"A(\313j\026\234\225Yd\333\260 d"
+	.ascii	"\204\326j{\274\013\234\224\233\243-\230\312Tz\336\346\"I\314"
+	.ascii	"\322B\326\ti\307)I\222\305z\314\300}\3329\217\206\301\2516.1"
+	.ascii	"M(O\212 KH\032comWD:.d\316;\323\227\307\177"
+	.text
+	.section	.gnu.lto_openSerialPort.63.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\207\007}."
+	.string	"zRT\022E`^Rc\363R\321\226\374\272\024\200A\316\033\257\342\037m|;\2013\312\033\305u9\004\251\311W\215\226T\016\027v\267\237\b\377\215\214,\030J@iq\323\300k\343\003j5(\f\345b\225\266\355\275\367\2262\311\022\001\003\001\020\0016\352\304dL\207,\227\246/\335\264\2530\242\335p\335r\343K\027M\r\n\0134C5\377\f\007\273\354a\251\201\211\0303\324eO_\272_\324\236\340\355\375F\300\035\334\257B]\2069c\374+\307\002\365W\307\227\256\363\312\t\336\336;\002V\340~\035Ro\345cP8J\350\375\312j\353\232Xi\251\263\367K\204\337\377\260_\335\013`\277\352%\330\275\372\036\2579\352>\300\237\257\347\266\354\252\352\034\205/u\037\fvl\\\007\026\265\02136E\222\245\365\337\245\313-#\331\247Bh\303,\362)\313\"\252"
+	.string	" wr\227.\215\344\336\223\\w\325\nx\\X.]\022Q\177X\322,oU\r\3202i\220i\245\256M\262\256;\217`\312R+\263j\373c)\027dV\251\030\336\270)r\350T^\245\004\271\252n \013c\022dR\251\272\f\315\355o\317W\314\252\254\017}\0063\307lM\0323\310sk\264\367\306Y\311\314:\016\036\343\273\030c-\214\331h\372n\037J\346;\370\316\247\020\363\232\346\355|\007\343w*\353f\233\234\036[X'\301\330\315X(H\2301\320\243\307?\301\214\007\274\354\007\360\265c\341\323~\237s\371\201\337\362\377~\366\373|2\356\375y\334\376\375Y\234\261\006f\234\177\031\277\300\2056][M\252\3505\357\306\332\203g\237Y\301@\371\363\217\376k\327\030\037\237\314\243\370o\370\207\241\302\374\211\017\305PJg\303/\363k\306\205\355\275\177_\335\206\250\336\315,\202\226\031\253\263\367~\360\325"
+	.string	"\224a\316wS\372\253#\300>\017\2718\272\257\006\264\fO\346a\360\307l\031\243t1\307\357\252e\017k\307\035\036\226\033F\351\367\325@\225!\306\007\203'XPz\333\322\220\324\273\2614\200\235y\017\367\3531\206\302\367r'\376\021`~9\356\254\032olcu\236\334\257\004\270\206\030\257E\251[\353M"
+	.ascii	"\367\216\205\355\375>\370\212\231\\\002;\206mZ{\232W\244|\242"
+	.ascii	"\245\247\233w u\366\272O\354\365\351\314\3500N\361\272'\027_"
+	.ascii	"\315\210\026\356\336[\337\371\374\006\346\244\213\354J2\3579"
+	.ascii	"Vc\332\021ku\323C\334\0354\347\3724\377\333I\354\270\263r\352"
+	.ascii	"\037-\3644\027\322Gfs\331m\210TH\377\3133\372;\357\233\023"
+	.string	"\363\232\342%\271X\335\304=\250\032\244We>\334[}\305\201\216*\333Q\351 i\265QR\335{\3575H\377\371\241/\261\255\016\322\257\352\232\312{\256D-\n\246\234\243F\325M\f\244Y\2154\233\243\312v\360\237x\305\327\350X\245t.\310\265\020\226\321\tS\363\270?\217\354W \035\304\344\nP\315\314\217~\364O^\311\347\245G\b_\312?1Vq4-\212\276\314\374\214\013|'_\361\013\030\371J\030\354\327\037\255\343\224BZ=@\267qVz\222y\017\376\333\357C\rN\252\321~L\333\264n\342%\366\317\233\360\372A\241\367\251=\245\273\314{Q\340\274\246p\330E'b\2221\211\211\210\324\313QLb2\256\305\031\304\246\024B'\344\261\204\257\251\306\261-&\035\227\324\242\023\361D\322\r\342\221\253\204D<\242A\203\310!\007\322\307t4:!1\335\220\341b\f\031,\034!e\240PAB"
+	.string	"d\321(\303\350\304TL2\3720\222\004\032D#\262\330Dt4\0221\031\211KDH\310&\"\tA\370X\243\210$r:\036\221D\2777y\235\004\007\275lY9\201\302\017u^\320\234\356\355\256\265\306FI=\345\223\243T0\006\3619Q\t\346\264\244"
+	.string	"\320q\200\276\016\314m\345\350\221\2541\016\361\274\245\273\030\"\204l\224y\254\316Z\307=\331\246y{\001\23438\340}D\203"
+	.string	"\ta\303\346\247\233\370v\027\352\243\347r\232\207\215\202\3206\251P\177\355C\311\354\243\201\372\247}\232\325\030\233@\221\257\024\352\240\230\255\245\245p\020*&\335P\030\337\271_{\271\367nP$\2132\305\223\312y\036\274Rc\276\366\f\330\236j\006\307\352\236\306\331J\317\217\225G\261_\373\n\257\244\225\200\222\250a \b\025B\210!\021\221@D\244\205tp\002\2211+\333\021\320\261cVZ\217\003.\005\244\361\261\366\003\276\f"
+	.string	",\033\324\327\026\016\022\322\312r\222\330m\355\226~\255Y\027\366\007\365\321<g\276\256r\201\n\036\233\271`\016\270\316\342\224\352\333\030X\273\333\301  \211{\2731\264\241\316"
+	.string	"\211\360"
+	.string	"\021|"
+	.string	"\r\344\\\2529\370\022\f\217\026\361\314\350\233\342\263\206\b\371\251@\036\315\305\026+\340\331\201h\375\336\020\261>z\226\225"
+	.string	";\023\333\024`\264"
+	.string	"\225l\334\020yt\003HQ)\342\205\242\302\035\226\b\033\237\3117y\217-`\017\270\353\331\304\n\270\024\324\n\037\221\270\207\026+R\210,"
+	.string	"\203\210\271)\336\205J\355\322db\314A\364\273\362-\256y\0173\276W?a)\017\252\336\203a%\367B\205\222\304d\037(\316]jr\203!\264\224\263\036\346\312G9\217\207\250l|\2420d\371\330'\314,\224"
+	.ascii	"\273A\225\341\026\035X\237V\025\362!\"\204\214'\013\310h\210"
+	.ascii	"\022\016\201\\\357\270\313\211\250H5\327/\343\037N\351\235\310"
+	.ascii	"\262\355^)}\331\217\n"
+	.text
+	.section	.gnu.lto_closeSerialPort.64.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\212\004\345\036"
+	.string	"f\266\303I\200\232U:]\266\207\235\255\370\0369\271L\316\310P\231\326Lq\f\243\022i\004\362W@;\023\375=5\242\206\235\027l+\343\233\021f\324jG\303\360\274]\316\3433\036K|[$l\252\230\234\230\266\016\026\255\221M\366N2\253"
+	.string	"\252"
+	.string	"\256"
+	.ascii	"H\305\231\222\214\255f\316\352\203\343\356\320\007n\334n\273"
+	.ascii	"\257\344K\200\207\372=@\316N\312'9\253\021\332\201\354\270\325"
+	.ascii	"\023@\217e\037\200\0367\260\273\314Ud\376Rk8\365\225s\266\335"
+	.ascii	"\037-\373\251\276\261\005^\026C\361y-\260O3\266\270\214A\017"
+	.ascii	"\246\032\217\235\024\220\274X\346\030\207gZ\325\346\310\243\316"
+	.ascii	"\300H\261\206E\317\230R\021L\216\021\351\3549c\306\306\225B\213"
+	.ascii	"\2134\375<5,I\362\224c<:/\023\252*g\336\3020\"\331{\345m\024"
+	.ascii	")a\227\225\261\3516\346\223snK42\275g\357\356cw\347\272\317\025"
+	.ascii	"\001[[\300\322\334\373\252\357\004\355\233~\324qV\363\013M\266"
+	.ascii	"o\272U\241\275G\2545I8\372:u[\333\265\364\266i_\276g\330\266"
+	.ascii	"\354\353\373<\324\177\001\\\030\243\003G\020-\267K\315Kap\362"
+	.ascii	"\026\fe\310\327\177\331w\362e\237\331i\003\277\366\225\r$:\223"
+	.ascii	"\276U\352\303L\332\257\362\021\276\310\247\222\214\027\0028\267"
+	.ascii	"\333WA\375\320\342l\207\2138\315\343\004L\267;\371T\237j\006"
+	.ascii	"\025\321\233,\r\223H|\212(=N0\274u_\252%T z\262h\247\205\232"
+	.ascii	"\2272\f\371R\362%Bv\374Guz\340\307\255[5z\016\307\236a9\323\213"
+	.ascii	"\211\366W?/\f\016b\216\254\233\263M\217\363\372\004\317\234s"
+	.ascii	"\306\351\375\372\235\027\241\347M\357\221t\bm\330}0\215B\210"
+	.ascii	"l\274\234\367\330\264{o/\031\346\310\272\351\257}\342W~\270\313"
+	.ascii	"T\222\234\263\005+A:I\251/*\257\362\325\b=\246]\003OP5f\023\327"
+	.ascii	"\354~\371\"\036\301\365R\214  \211_\273\205\036%h\0032\347\334"
+	.ascii	"\203u(\274>\220\343V\341\263'\372\320\343\331\275_\2104\316+"
+	.ascii	"\273\261/\3038A\033\326g\3761\2303\270.\225\022\030\326\275\307"
+	.ascii	".B\277>\004\217\234\242\362\2645\214+[}F$\272!\334\317\356G\b"
+	.ascii	"\227\233\261\320\375\b\355\260\016\b\347\033\241\323=\030*\224"
+	.ascii	"\310a\230@\201G\300P\217\007\202\3269\036\024\270]O\347\263\361"
+	.ascii	"v6\241\035.\310\226\353\371l<\006\232\227B\327\263\r\361x=[\252"
+	.ascii	"\006\177\235\332'x\205\262{\314\362\356\023\367\362k`\263\326"
+	.ascii	"p\345\320n\334\271\344\250\230\b*\200\\\340E`\253\b\206&\003"
+	.ascii	"\241\335\272k\001\222\345\234-\364\265X\354t\274\200\374\320"
+	.ascii	"c\005H5A\0336B\253\t\226\214\361\344\024\273G\017]JTW\370S~\346"
+	.ascii	"?\f\223\206Wwvk\237\362\332-\221\fc\263\260\270j\367\352\272"
+	.ascii	"\374\243N\013\223\325\004k\006s\2407\\\250A,\345\230R\210)\021"
+	.ascii	"\221 A\025\030:`\002\031\2623\017\021\3001d\267\311\326\001A"
+	.ascii	"\271\370\251\333|\371A\221\266\334\007\3032\317r\311_3n\262\005"
+	.ascii	"S\260\324,B\373\004k\022(B\177\312\306\005\355\321\246\334\345"
+	.ascii	"\226\232mu\335\022a/\3318@s\350\022@\254\002\305k+\300\215\303"
+	.ascii	"\210\005?\030\3158\313+\241\253\205n\025pQ{E\007\304\351\353"
+	.ascii	"\020^\362\006\374\347\002\267C5\322\017f\373r\210\276\227\350"
+	.ascii	"\264\f\245\210\240\\E\003\030Q$\371\245\r\244\324|/!R\371\022"
+	.ascii	"\342\31207\203x?\330\345\323r\334e\215O\350\317\335d\273\344"
+	.ascii	"\213\004>=\252\263\204\321\205`F\340\345l\276\355\321\342\233"
+	.ascii	"7K_\266\371\003"
+	.text
+	.section	.gnu.lto_serialInit.65.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\310\004=\036"
+	.string	"\306v\301G\220\232Nc\004\262\255\024\347\004\314\314D\213\261/\264\300o\222s\030o\200\202\201\313\022\224\r\220q\255\2554\335\255\320\250\330\026\213\254\367"
+	.string	"\211}\212\275:x\3624C\361\311\203\344K\202\270\260\b\243\007m\262\345\2262\245\256"
+	.string	"\232"
+	.string	"\260"
+	.ascii	"\227\307\033\316[\234\0270o\313\0170ok\314t\224\332\017|\226"
+	.ascii	"\316\003\205\315\325\216<\230\334;\344\361\202\363\326K\266\225"
+	.ascii	"\017\267\356\213\200\201\022\322\345\336\233\2533|\276\034\336"
+	.ascii	"7\272\364\230\333i3mY\351\222\017\344\t\220W\200A\246\307\224"
+	.ascii	"\266()*7J]\225\272\264+WM\364&c\312\352'\002\341T\325m\245\202"
+	.ascii	"\262,\264\033\245\252J\003XPZ\334\353TE\020\212\232T\2672\301"
+	.ascii	"'\\0\005-\313\002eYh2\301\247\322\001\026\224\026\270\240\023"
+	.ascii	"\255\367\272\245\021\225&\234\262:\265]\270\367\232\002\203S"
+	.ascii	"7\356\266\211\330\036\262\313\025\001\267&**2o\355\035\tz\240"
+	.ascii	"q\236*\223i\321\352\374"
+	.string	"\221\351\017\371\327\221\337e\236\tz\340\255o\302\274\2459j\371\321\244o\250h1h\274\024i\017\231h\325\262\257K{\252\341\032\303\246\371\360\2379\361\276Y\352\323R\333Lj\323\244\266%ui\251\253\245\246%\365kn\326\312x\\\356e\221\374r\311\254\030\215\023\177\3736L:?\210\357e\234\315Og\023=v2I\235_F\242\260\334{un\rt\336\036g\327l\321Uj\337\307\177,}\350\363\355^a\362\310\275\001?9GcYw\270|\204\231\265\222\035\250\366\344\217LZk\375\023V\023M:\n\2559\\U:\226\374\211\217\307\311\317\202&\023\216Z\b\024s\230\212\324\r0[\265<S_/$\232\311\024q\320\256\032B\252\262j\335g\316\324\036\361\314\211\256\031@\321\206\361V\333\303\225\370\024\034\357\275\022\306~n\266\356\275\272\333$\026\fP\315\266\321\305>\234\367:\351\374#\017\003Q\206"
+	.string	"2\201\314\333\327\177q\211\001(\276\250_Q^\302\252u~\342-\300\370Q\244\357\365\022\207\320E"
+	.ascii	"\372\341\375\304\324\371\203\274H\221\314\326\275\277\003}\""
+	.ascii	"\007\023\362\273\002'\210\206\220v6i\227\201\327A\251\307\343"
+	.ascii	"0\300:\n>\"\204(@\210\320#\324#`\210\310HD\020\222\006\245\021"
+	.ascii	"\274\244\031\013\365\030\005\355zDI9\336.\207\264\013:\312\t"
+	.ascii	"\365\222r=5\346\225 \352\345\224x\274^\0167\274\2571\200\374"
+	.ascii	",\"\311~\265)\246j\031wu\322\324zFu~\253*\316{\314\274U\fI\341"
+	.ascii	"\245H\337\352\205\037E\276\274\367\336\033M=\3618;\277U\232\235"
+	.ascii	"\242\013\212\344<\255\024o\253'\232\255\336pUm9\36310\373\311"
+	.ascii	"9\372\310\024\263|\007\030\321h\373\033\230f=\320#\213\030%@"
+	.ascii	"2\2314\276\201i\253YV[+\254U\201\n3\305\267\263%%Y\2501,\204"
+	.ascii	"\rC\20223\301\00423\223f\f\260\002\231\251\262\r\021\020\265"
+	.ascii	"6e4\006w\003\353\fy\345w\236\0372.\367\022\262\321o.ty\244\333"
+	.ascii	",\223\257\361\314*\355}RTH\234F\2265\333\006\2450\317'\353\200"
+	.ascii	"\003\333\350c\213$\256b\207\016\202h\340\004q\360jK\363\241q"
+	.ascii	"\203\372\243\305\202\364\334\317\\xj1\017\234$\034\2769\f\261"
+	.ascii	"xk6\372\016|#jmi3\314\303&\020\206\321\352\306)\360\345\244\322"
+	.ascii	":\022\346\351\240\227\204\254\021\"Nc\036D\324\304$YJ\027\317"
+	.ascii	"\017\245\222\353\027\"\305R\325q\354\016`(*<\032\t%\260S2\241"
+	.ascii	"[oe)d\232W\032"
+	.text
+	.section	.gnu.lto_serialRemovePort.66.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`s\002]\024"
+	.string	"Ff\207I\300\322Q:\n\300\234\231\357\024#|"
+	.string	">\251\023(\002*\354\341\005\n\232\t\332O\320:\222,\341\250\316*\334\226_t\260\364\034\255>\\3\244(dQ\024\025\212(\324\212N\236eg\223\310z!V\327k\333'{\313\235Rr"
+	.string	"l"
+	.string	"t"
+	.string	">\300:5y\211x:/@<u\316\346q\037Q}\020\tG)H\255U\266$\314\372\364\335\242\314}%\322\2712\347#\275@\325p\307\243\371j\256tvp\220\360p\346l\252\007\320\201\2279\274\032)\216\240\3609\355\371\234'A7<\220\3606\314\022\250\021;\\<\033\271\007\376\244*\270\343\371\\\256Vj\255\226;^\207\233u\333;\266#\330R'\237)\204\244\220'\252J*\333G#\267g\1776uc\344\035\262_?\372[\377\335\224JO*\275SZ\256\364\001\020\b\202\222Y\252\225\303\260\252>\321\031'\376\373\355\303\202(\276\317\007\332\005kB\261\355\005)\271\377p\254j\264b\n\276\360Q\253/\301\251!\260N\357\262aI(\227\366W\234E\356G3n\325*\344\324TkU\020A5rh?\370&\234_\344\n\243\374n\024Ow\007\224\370"
+	.string	"\"*\367\0311\006\f\246\024) $\302\237\0039\325P1\267\347\326\312\265%\345\260\221Cl[\270\213\031\004R\265V\007\266e\276\364b\200\250\326:Sz\213\232_t\352\f7\371\335\251\177\023O\345\266\216\350~'\021\234\":9\364K\330\263K:Bd\354\366\216\023\377\273\004\021:I\345\003\003\032h.0#\365L%eB\213\n\203\006\261"
+	.ascii	"6\332Ha\214\201\241\271\214#n\211]`\031m\264\233\2546\312`F\226"
+	.ascii	"\027Y\213\355&\213\301\\\303@\263\311bj5\233\314\345\253\337"
+	.ascii	"!#\235%\f\361\244\333\232\325\366\354\262A_KM\310'\235n\016\353"
+	.ascii	"\201\016\0339\204\376\b\321]\321I\252\317Zk\025_\373\337M\216"
+	.ascii	"\023\351\276bB\036I\347\322\370\356\307\207\307\211\273s\177"
+	.ascii	"\023- p\002!\272\252\003\200&\030\024\330=\262\271v\270V\303"
+	.ascii	"\001&:Z\313e\307'\213\037[\375U\246R\210t\013Q\032\302E\250X"
+	.ascii	"\311\327\260\304\232\3073\346$\267\207\320`\353\203\nn\034\303"
+	.ascii	"!\270e\230\215\227z\350\322\336\3266>[\343*\002D\330\025\263"
+	.ascii	"\257z\205E\353[9\305EC\004v@\244!\353\373F\250\333\271\f\031"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.67.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 \351}\006"
+	.string	"2L-3Pm\222\016\274&3\b\3316\267\324\335\272m{\205o@kk\367\255\033\366o\333\220\364\316\0338a\277\231\231)2\272o%<P\024\230\250\265\255\221-S_*\t\226\352\302d\236U\275\205\312\242\360.W\346U\002\266\0300\327k\260\254\353Q[\326\201\320\rp\334\3037\243\032\331\275\330A\203\325:]\315\244\023:"
+	.string	"\213\b\016\216\246$\022G~\333\240\233\370J\351@?\216N@\024\202udvF$\t2q\204~\354\251\r\016\260\263n\025\235I\310\003bC$s{\216\242Y1\273\305\250$*\371\320<\233\"\005!3G\315\363\351\256\177\301O\360\177\002\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.68.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\333\001\025\022"
+	.string	"\346\242{H\320\362&\035.0R\237\003\235\355\342\314\256\215Y\233\271c\027.\353-\277[\235|U2\210'\326\212\304?\373\032\266"
+	.string	"\343\002\370\tz\307\343\013\335 G\026t\272]\327\220sz\230\220\332\004hB\\\303\022\262\267\334)\005h"
+	.string	"`"
+	.string	"g"
+	.string	"\tl@\3659r\002\336\247\374"
+	.ascii	"\357SA\211\314\263\337\200p\036D\203\246\bj\367\006\352\b\253"
+	.ascii	".o\367\214\263{Sj\234\3711\367\344w\223sC\3046#M\236\234@\330"
+	.ascii	"\330jq\246\320\271\224\016\204V\220\020\261\311H\315\351\222"
+	.ascii	"V\266\231\250\317=&\361\250\3410\262\351<~(\273\353Xc\363p\177"
+	.ascii	"\267=\263-\301\216_Q\312\276\305D\375\261o\244\036\035v\254>"
+	.ascii	"\366\367\241\337s\264<\356\326\031\035e\364U\237Z\202z\222\355"
+	.ascii	"vqv@vi\306\b:\356\267\317\332!\361o~\316+\026\017\311q/\252E"
+	.ascii	"\361\031\0351\355\330\275!\3704\004\325\347m\231\275\262Y9$1"
+	.ascii	"\332gq!\331\207`\034\262\333\323\004cw\003;?=\356#\177\361T?"
+	.ascii	"\375L\210Z\334\271\245\204\024O\324\370\260!\365\307\236F\205"
+	.ascii	"\021\345\220\211Q\266/\374\005\314\001\246\335m`\233\303u,\005"
+	.ascii	"\200v\327\244\350.^\276\211Ok\210\305\327|\3721\3573j\310\220"
+	.ascii	"\352UN\321\004\241\305\235\003(\311\250\241\272\233\037Hj\377"
+	.ascii	"\305;\356\024D\320r\227*\336\342\261g\003\033\\+-\341\264\311"
+	.ascii	"II\005\225\223\005\fZ\002`\256\320B\350\322\342Z\t\001X\245\205"
+	.ascii	"!%\204\271b\340+\004[\302\024\026P\005\026\003[,\2772\270`\240"
+	.ascii	"\313\353\005\003W\267\275\372Dp\322\241;\232\376\314{\356\023"
+	.ascii	"\234\232tG\372\317<)\325(4\255\361x\372\343\325\f\371\351,\021"
+	.ascii	"OtU\033\325\203&\231\0305?\250\242\320\242\324\345\356\006! "
+	.ascii	"P\002a\n\257\003\200\022\264\f\030\373\fZ\214\221\362\356\016"
+	.ascii	"\252P\036\242\3774\fC\333\030\276\325\2572]J\021o\261\373\246"
+	.ascii	"9\335\355\333\334\341X\340\207\322;\373\225\231H\274Y\036\f\240"
+	.ascii	"P\313\263\215\2750\005\334\202\352\n\236\366\231'\361\272\f\031"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.69.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\235\013"
+	.string	"F\225OB O\225\016\200Ay\364_\200\322\013\020\277A\260N\004\276\253\030\300M\036\"`\274\201\276xO\303\036\214#\320\345\200i\314\203\200"
+	.string	"(\203\303\322c\300t"
+	.string	"D\261@\034]\334\211Ks\254%do\231R:"
+	.string	"<"
+	.string	":"
+	.string	"\036<\365\2736\245~\276\316Z\200\341\347\332\224\210F\037*\241h^\306\327\352\251\253\206\020\2443\004\351\362\251O\0213\026\030\222\256\022\004\273k\005\303\r\367v\333\rl'\260/\022c\212O\265;\232\305X\227\266\002a\373\025\033\304\305\200\253\375\021'\361\035u\341\034\273\246\021\305\256(\300\001&\327,\376c\2736\271\307v\315\237\315\342\342i\257\212e0\021\333]N\006\356$\350\301\313\003\0346J\260\271\273;7\245|\302fS\250\240\007\r $?\326h\275\220'X\242PZ[0\025\2532[\374\250\354`\377r\032_\226&\373\250\177\252\372\222\221\276`\f0\320`\b\024\260tx\274N\001\305\032\213\203\f\307\333t\270\216\303A\340d\036p\032\257\303YB\334E\330x\234\247\353<\256\"\356\245\311\013d.\f\022dY\202\241Y\330.\275\022+B::C\247t\024"
+	.string	"8\211n\313<\231\201\205:\022\324B>\334q\275\240\307\330"
+	.ascii	"\326\201\202\232\272Bg\301\234A\331r\365\267\032\035\334\213"
+	.ascii	"[\252T-\003\365\262I\230O"
+	.text
+	.section	.gnu.lto_serialEvaluateNonMspData.70.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`R\001\365\r"
+	.string	"6\032_E\360\2226\035 A\201\232\270a\364\267\035Y$\217\312EjXX\340\226\205\352\264\373\017\373\023B\351\367\253 \263O\250)\n\307LEH6\241\"Ri\3230\n\350\264K\241\370p\025U%F}\177\262\367\226)\005I"
+	.string	"J"
+	.string	"J"
+	.ascii	"\326\rT\237\356\354\036\007W\354iR/28\273{E\025\357^M\031\265"
+	.ascii	"\363\037sO\351kyE\342\323\203\213\312\021\217\222\304\005\347"
+	.ascii	"D\200\217$?9"
+	.string	"/:\036s\205\371<\325\216\204\335\265\226>\021w\347\266Sl\237\330\207\t\216&\373\250\277:\370K\251\276\347\223\202\307\367\0173\273!R?\326f\332ha\373 v\310\215\221\250\266\203\222\356 \313\007\254\227\003\004\005\3533\204f\344j?\306etGu8\201]\023\216\232]\260\201\027X\237\006\177\240\372\f$\b\276\314i\244\370,>\255\262\351K\237\376V}>2\270A\2154e\221\320\205\354h\025m\321\006}\311\tH\261\305\257\021\232\360\216\032\024\212\030OVp\226JF\224\0317$\315\261HX\"\\\365a\203\236\306\223}\271\273\033\\\350\302\204\n\031\007-\3032\356\343\b&%(\230\t\311\003P\201\025n;\001`\f\204!\244q\231\350\332\264+\203\026R\2710Nt\201\020x\323\220q\327\312\266q\027\b8\272\334h\262B\0306\243\350U\002\324\3062\357\305\214'\313x\333\302g4k7\031"
+	.string	"8\211n\313\274\231\320\223\024x\300k;\336\253T+ \016\006\326\207d>\330\200?^\220\202d\231\0227\251\212\341\002&\327\330\2600\004\b5\033\370\221*4\t\264\003Y"
+	.ascii	"3\246\024\n\n"
+	.text
+	.section	.gnu.lto_nopConsumer.71.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 \376\005\007"
+	.string	"\322\f15@o\323\030@\265\345\034\to\005\271\016`\231\354(\017\2606v\002HJ\254\004\337\334\344\202o\347\351\257\243(]&\252[\340\24535"
+	.string	"\300\211\371L\266m)S;|<\021\326\247\241C\rT\242Jb\332\242&\252+\003\205\"v\305\212\253\242\210V\026\212T\301\230\005(\213\"\f\313\"\307\333\204\244\315\347R\302\200\031'|-\337j\314{\233\302\217\317i!\351U D\245K\016e\227cFfK\032\026\221?9O@\242\240\372\f\036-K.\206\273\035)+\273\336\302\b\233\324\254\375\213\201\306n\235\021\217\215\023\230\335\215\020$\265T\355L\223\f\340\272-\025"
+	.string	"bwW\256\033\3450\377\203\377\341\037\005\t"
+	.ascii	"\222IefhD\307m\303\265\256\211\342!`05\004\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthrough.72.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\265\004\315\033"
+	.string	"\326\256\250J\240\226U:\322h3\037\001L\3401^\t\314\365\205\246OL\222]\340G\210k\362\224@\3628v\250e\257>\333\314\216\273\007\326\320\272\316\242\001_\216\322$\245\237D\374\207\350\310\325\306\007\337\016e\003\215\326\215lho\271\223\f\223"
+	.string	"\215"
+	.string	"\230"
+	.string	"E\2047\302\342\262{\223\232D\335k2`\004\345-\233\247\261n\313\007`\335\262\220\271\313M\245;\3408\304\205\323\324\2757\327:\270\344V\013\377\202\271d\312\026\313\326\246B\376\261\350/\nDdt\230\215\032\324U\300H\204t\231\252 \351$\314\317!\244J\023\352A\274\323\013\374\030:\242\345\215DFo\271\212Eg\321\270\005\372\241u\306\273.\320\002\004)V\034\326"
+	.string	"GK\264\334\3514\250\330\202\322\326\315\275\227)\261Ht\23693ca\346\r\3145EU\314f\017\355\034\314\277\224!\036\334I\314o:\337\016u\266\375\351<{\323O\363\245?v\363\207\335\310\357\372\322\331Z\312\265RnK\231V\312'@a\034!R|\320\224{\205\256\254.\026\373\304\307\241\376\247\232\221\022~\325\216\204\034\275\324^\340\370H\370I\370U\213\201s\020A\370'\025\277@WE\220\243T\362^\023w\3138\345-}1\323\254\232\250hH\342\350\322\212\001"
+	.string	"\356\220iG\206,&\225\205\362\226F\005w\312|\"\017@)\244\223\023\207\203\361^&\205<\"\263c\275\177L\\fvx\364\3047\005\034\303\356)r\002I\200<:\033<0^ZUt\353\233\327{\357-\225\250\222Q\255\003D\313<\275\262\322\364\255\203\230ESj:\016R\206\355\034\006\250\232yz\033\214\256Lq\245\261\266\035\304\3444\310\242\355\033\237\312\323\023 u\257\317\211_\372\005\034>\264\212\237\344\274b\363\206\331_\301\212\265\216i\313\220R\261\316\n\246\233*\251\253\231M"
+	.string	"\351\211\\3\354\036\276\323\257t\2129/\r\273c\b\212\330\341\375X\030lP\304\016\357gY\302\204\b\272\335\204\007\020lf\301\020:#*\357lF\344\360~:\300\234\217\227#\301\313\351\345v?`\316\306\306\276\022:\277\\\320\347\373\345^-~'\325\346\033\230\332.[\327/\266>\024\314\326'\222\310+g\007\343UrY\022i\345u:\345G\350\b\353$(\357F\001\353\256 \213BV\331I\251\227Fi\263m\256\331E\021@i\303\232\331\303\207\237\356\341Y\323\276\2131>\364\n\3129\353?\275F\006\"\207\2368\353l\250a8)\02533\"\201\204\t\222$I\007\300\002\021!;\017\0200\310h\266\205\f\007\203"
+	.ascii	"I\362\017r\321\236\353\363*3A\0318)\177\377HA\367\257&S\023\204"
+	.ascii	"(\326\260\223\361\267\031\022x\364\254\320\320<\366\216\203\327"
+	.ascii	"\272\220\006*\263J\315;\305\004\314\247g\317H\202*+?T\230\"g"
+	.ascii	">&z\351]O\361\217pC\371\b\205\342M\234\017\266\322\262\002\205"
+	.ascii	"\356\362\324\325ldi\022\341U\357#He*\365\302k\322(\325\374\241"
+	.ascii	"\213H7\375\235\fh@/-\031S\3161xLp\270\233\001\220\243\276\322"
+	.ascii	"\022\t\bX\252\302\3743\350\030C\375\232\275\322\340\004\265\302"
+	.ascii	"\002\004\2507\334\307\351\333\003\327\306C\223&\375\314d\232"
+	.ascii	"Q\325\361\36348%\n5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\241\003\005\020"
+	.string	"\364\026\235\004"
+	.string	""
+	.string	""
+	.string	"\002\307"
+	.string	"\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006/\177/\260\206\3618\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005(0\201\204\0010\1771\346\206\316\200*21\1773\234\211\365\321"
+	.string	"\0022\1774\005'\"\200\003\0023\17755\1776\252\333\3426\0054\033\005+76\1778\0027\1779\0028\177:;\177;\221\212\227\315"
+	.string	"\0059\034\002:\177<<\177=\234\367\200\311\002=\177>\002>\177??\177@\300"
+	.string	"\177A\301"
+	.string	"\177B\005)C\302"
+	.string	"\177D\002\303"
+	.string	"\177E\304"
+	.string	"\177F\305"
+	.string	"\177G\360\372\250\002\306"
+	.string	"\177H\310"
+	.string	"\177I\252\220\326\001\005.J\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005,K\005"
+	.string	"L\001\311"
+	.string	"\177M\377\037"
+	.string	""
+	.string	"\200\200\200\001\312"
+	.string	"\177N\313"
+	.string	"\177O\315"
+	.string	"\177P\314"
+	.string	"\177Q\317"
+	.string	"\177R\316"
+	.string	"\177S\322"
+	.string	"\177T\321"
+	.string	"\177U\320"
+	.string	"\177V\003\001\"D\003\t\"D\003\021\"D\003\021\017\242\001\003\022#\361\344\203\254\001\001\344\027\003\025$\274\201\300+\001\244\023\003\027\244\001\003\034&\221\205\327\307\003\001d\003\034%\244\001\003\035(\240\276\320\347"
+	.string	"\001\204\001\003\035'\244\006\003\036\034B\202\001\003\036+\016\003\036*\320\360\372\250\001\001\344\017\003\036)\022\304\026\204\032\204\033\004\036\265\023\325\033"
+	.ascii	"A\250A\024$\301\320\024e\024\246\334\220\002!B\242\007\021`\024"
+	.ascii	"\r\032D\210\300\b\310D3\032\364\365\216\350j\013\f\241\202\233"
+	.ascii	"\334%\345\237\311\273\316\236^H\375\362\032\f\312r/\202\351\205"
+	.ascii	"\227\337\347w{\016\376_\177;\2619\364/\030\350d\234\245\n\226"
+	.ascii	"\025(\215\306\243\007\\\210\316\353\310\0225\257\321n\241\024"
+	.ascii	"P\271\024\357\367\314\345\320\321\314\253\354Jk/\271\013e\225"
+	.ascii	"\352\264v\251N\334]\234\341\362\221(AMq9h\214\r\217\314\334\242"
+	.ascii	"U"
+	.text
+	.section	.gnu.lto_.refs.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375 \377%\005"
+	.string	"B\316$$\240%I\007\377\377\377\377\377\377\377?ZE\236\323\276\375\377\377O\354\267\333\261\315~\3336!m\023B\232\224)\263K\257\b\306\207{\272\213\216\356\203\002\3365\0017,~\353\223qd\017\230\227\305\027\353\r\214+\354\023\213+\353\021\306\317\270\352\037\353\306\242\342\004:b\237\254\211~\367\3075\240\037\367\347\252\364&Ep\205\344\023\354\027\353\353L\302\003:Q\237\356\321u\243\210\230\025\365"
+	.string	"\367w=)^\325t\216\236\354\221\025\365\323\017Gf\203['\377\205\004"
+	.ascii	"\310N\021\253\205\300\0165\212J\0242"
+	.text
+	.section	.gnu.lto_.decls.71f14211fb1f2ba6,"e",@progbits
+	.string	"(\265/\375`\2265]\342"
+	.ascii	"\312X\231LT \fI;\215\001\325\340\335\004gQ\246\2037\356%\215"
+	.ascii	"[\f\374\255\200w\303\005\214\270\005\374\1775y\315_o\256\210"
+	.ascii	"^\365\003\243\253\234\334\220g\3425\2719\323L!\356\352g?4v\217"
+	.ascii	"/0J2\232\335\232\254b3\341\314\345f\"\301Z\245v\244\2242\005"
+	.ascii	"\005\004\321\004\327\004_gpP\223]\333\224\2668\230I\377w)\006"
+	.ascii	"v\022\243\016\353f\245|C-n\356\346\343!}\223.\322\327\275\267"
+	.ascii	"\314\216\252\033}\206\372\227\212\276p\241\327\310%p\306\225"
+	.ascii	"\275\233\177\215n\320-\232q\242\207\264t\363\025\272Cv\rq\211"
+	.ascii	"^\206\326-}\341\253\242\343LO\337\2060\326\2040\346\275.\226"
+	.ascii	"\370\335F\305,Hg7\327(\206\230\311\302'dd\013\006zh\211\332W"
+	.ascii	"\242\0055k\223\022\225\026\304\0335\226Hts\026\333t'\205\030"
+	.ascii	"\247K\030Z&v\212\305\242'\b\tN-\026{hWkh\to\013m\025\016\f\255"
+	.ascii	"\333\340t\315\320Z9\234\356\275\212\300\021!\002\346O\017\321"
+	.ascii	"J\347_2m\214\332\273C\364\364\267lV\316\016\022\240j\213\341"
+	.ascii	"\315\2028\306\271\350\264\357\346_\036\032\320\376Y?\333g\251"
+	.ascii	"\330)v\265\201V\357v\317Jy^\367\036\032\373K\330@\233g\323\260"
+	.ascii	"XT\267\t\335M\367\336\267M\370\376\234\314\035\315\246\246p`"
+	.ascii	"\003m\024\033\207W7mDf7\275\203b\355h\236\027\266\220\236\337"
+	.ascii	"\326\336\353\355\327_\342\337\300\204\r\264x\326\016\257[[H\357"
+	.ascii	"-\001{J\332\264\034\356\275\342\210\250\3413<\233\243\311\267"
+	.ascii	"R\364\361\254\006\243\214\205\323\267I\364\255\227\276\275\322"
+	.ascii	"\267M\372gt\266\316\256\026\330'\337\300\304\361sl\177\315(v"
+	.ascii	")\332\030\372\326\002\243]\264\026\030\277\202\276\233\023\253"
+	.ascii	"\301x"
+	.string	"\026\332h\337,\234]1\260Kn\333\354\332]\202\326\275\356\275\326\\\254-hd7_\205\276\305\300\210\027\027-\006\306O@_<{c\274`5(Q{\001#\322\344v\363\255\332o\315\354\231M\273Q{\017\355\2759\320\310\355\215E-\232\225\232\371\320r\363M\350\273\255\006\343\007{c\264IJ\334\226\335\030\243N\353\256\001\300\232\334\333\315G\251\375\262d\030\232\024\265\317\366^m\262\034S \341\315\026\314\"\261\253%\263c\317cQ[\272\367\236\211\251r;\013\272\371\203\325`\314\366\306(\003\342\017;\215\324\336&~\265\213\275\367>\332\313\031\277Z\rFmo\214\277M\3766\213\321\177\225E\227It\207~\033\345\267BO2>\3761\376\257N\320}\336\236\215x\345\277\0340\301\177?P\002\300*}\204\371\307z\036\354\314\217\355\236\\\234o\370\361[\n)~\341\307f'\334\013t\270q\201\202\303"
+	.string	"\307\230d\301U\375\367\204\021\330\246\315\217u"
+	.string	"^\021<\354\267\030\224a\245\337&\271,\334\027g\247\3711\223\230P\327\377\227\037\257\300\225\341\307:\377p]\024@\303q~\214\243\001\023~\273\341\311c~<\302\365\217\023\360\333\032w\205\377)\230\376\303\374\370\312\177+\377\375>\345\377\337\377\276\377|\2007\374?xtU\370o\004\200\376\217\275\303\217m\376K\342\277\033\374\267\304\177G\374\367"
+	.ascii	"\377\325\340\277\035\\\021\3775\300u\376\257\3713\213\3376\221"
+	.ascii	"\370-\322\177\373\343\016\377m\376w\371_\026\377M\376w\347\277"
+	.ascii	"\310\377v\340\277\030\370/\005\376+\201\377\202\360\337\004\374"
+	.ascii	"\327\304\177\355o\021\177{\345\267U~K\370\333\277\337\372\375"
+	.ascii	"V\357\267P~\313\344\267p\277e\373\355\331o\313~+\366\333#\277"
+	.ascii	"\345\372\255\326o\263~k\365[\251\337\342\370\255\215\337\316"
+	.ascii	"\370m\322o\241\277}\376V\305o3\360\333\020\374\226\004\277\345"
+	.ascii	"\300o\005\360\333\026\377\005\177[\301\377,\277\035\301oY\370"
+	.ascii	"\355\n\277\375\340\267!\374\266\204\337:\177\313\374\255\362"
+	.ascii	"\267.\277\005\301\377'\3771\370\217\366\177\311o5\374V\375\355"
+	.ascii	"\316ou~\233\363[\r\374\326\003\277\355\300o7\360\333\020\277"
+	.ascii	"\035\300oA\374\366\202\337z\370\355\361\377\226\377\211\377\265"
+	.ascii	"\374G\374\257\366\237\354?\006\376\327\375\367\260\270\270\270"
+	.ascii	"\370\353\n\374\232\352'\200\2148J\372\244\210\206\343\232\341"
+	.ascii	"==A\335(\214\022\266\035^t\332\202%OO\030\207\255r\202\323l\304"
+	.ascii	"P\272q\214\343r3yRd@m\232\r\321S\313Kc`R\303\256\270\006\266"
+	.ascii	"\001#\264\006Ux\230\213\314\031\035\341\246\227 \303\263 Dk\006"
+	.ascii	"\247\"1\266\264\005Zb\304\3003\216D_9Bh!\037F\323\245\343\031"
+	.ascii	"X\206\214\022\253\304\0337c\246\230@\254\267\252*\034\275\306"
+	.ascii	"\273\245D\304\233\257\2314\006-\020\266\313\342\243\025\037\341"
+	.ascii	"\244\027hN\\\234\356h\216\f\216Y\236z8a\244;B\022\226\216\365"
+	.ascii	"(6\350\026\247E\003\200\207\320\2050T\357\275-\331\023\247\020"
+	.ascii	"5G\360\364\230\030\035C1\326\021X\022.z\301\021\005\334\273E"
+	.ascii	"\230\310G:u\222ekh\225\025'<d\tg\232\212\274\314\366\364\206"
+	.ascii	"\037 \356\"\336\307O\374\274~\326i?\t;\340\202r\242\021\342G"
+	.ascii	"'\372\3677\356\240\350\336[\206\313\272\243B2F\353bg,\266y\357"
+	.ascii	"\007\200\002\353~&~Y\321B\332\202p\374\303\376\361\242P\251\324"
+	.ascii	"\263\001RLCR6\240R\251\375\034\n\362\264\211n\251'T\272\267\315"
+	.ascii	"\036\032z> j\333@\245\233i\023Ea\262{\225z\356\241\250m\263\207"
+	.ascii	"v\320\007\350\220\024\023T\032\304d\003\225J1m\251\324\276\260"
+	.ascii	"\207\202\2420\206v\324fK\245\b\2674\212\351\002T\032\305\004"
+	.ascii	"\225J\355\260\203P\305(\223\341\327\224\240\345\202\016\355\030"
+	.ascii	"J9\202\242\027\360\240k\324\366\333\333\236\025\355(\210\275"
+	.ascii	"sDE\375\202lX7!\274\030BJ\202\242:(\tME\355!<\350\220\250\275"
+	.ascii	"\207\b\365l\245\016\236+\336\366a\361\236T9vR\321\336\024(\355"
+	.ascii	"\375\264\033o\357\375\334{\037\2439\326\275o\\\200n))\355\355"
+	.ascii	"\204\243\264s<\337\212\366\276g\177nLP\351TT\211\2672\351\326"
+	.ascii	"6Z\237v"
+	.string	"k\373IE\265\364)\266\223\252\350-\246\031\205t+L\340\fhQ\342N\225Y\334\315?\376\320\030\250@\374\"\332\365\"^=\024\353~:\267@\025\036\036\233\364=\274\327\360f\371=\274Xd\206\326{\230\367\016\262\366\002\032k/p\221\313\n\"3\346\037\243W\256\225+YfuASC\\7\337\324\201\370\235No!\316\306}\200P\205F\b]\222\240\355\331Y\3217\322\351\033\037 ~\251\254\227\312\025\264\353^\2721\322\021\215f\020\210Cs\204\020\b\030\022}#\025\340\337\3344\006\341\315wJF#b3\326\350\263\353\365s9\002\267\332\260s\231\302B\245\355\346u\215q\333\201FC\2125\254i\222n\341\332\273zb\200Q\252n\276z\377\315\273Qn\016\031\227\303\036\207H7\313\354\025\357\314x\225\204\260\f\n\r2:\257\240;;\231\275\305-\2055_JfTyRg\253\232\002\007\353\350"
+	.ascii	"\203`\324\335\254\024\007$G\223\233a\b\271E4/{K-\216e!}\001I"
+	.ascii	"\332\302\272E4C\027\366\320\224\322\326\330\t\022\237In\332\022"
+	.ascii	"\331R\013\227\013I\017:\344\026})\306]&\267\311ur\327\256\332"
+	.ascii	"]r\347.\334\225\273nW\311m\273lv\275o\027\351\227\354J\211\334"
+	.ascii	".&\210o6"
+	.string	"/\004\257C$w\314\203\020\264\004'\301\373#\310-2#;\222\362v\275.\230\305;{\200[\226\351\333\325\272\\\036\204\240;H*\004\256\350\340\024\346PoO\006"
+	.ascii	"\362Ek!\351\353\b\024}\273\336339\265\347U\331\257\331\005e\366"
+	.ascii	"\366\200\355~\b\221\336\374+6.\207\tq\262\212\323y=\033\273b"
+	.ascii	"gbT\376\326\026\372\332\264\326\033fD\242wEG\246\357\362\245"
+	.ascii	"\263\020\264)\302\257{$\007\337\021\030\\\372.@4L\027\230\224"
+	.ascii	"\305k\344\026A\252B\025\345\346\273\354\320wi\322wQ\322w\331"
+	.ascii	"\372\271\212~\376\343\332\332\322\032\013\274\031\257FF\361\210"
+	.ascii	"\036\217\233\237\363\364s\234~6\323\317^\3729Kk\340\243G\314"
+	.ascii	"\022:+WzX<\247\215\373\324\240\n\215\\\331\365\366\270V_T\212"
+	.ascii	"Kr~f\252\242\332Q<!7\013\256I\266\264xM\331A\343\215B\035bRQ"
+	.ascii	"4h\210B7\237\203\033uw\254{\351\330\343\006"
+	.string	"T\341!\017\273\336\250\013\365\rL|\341`,!B\206\344|l\247\217\227\350\310q\267\304\206\345f\034\270\306\024\032<\304.\214;\3436\261\221\251M\235\356\321]\372\240(\372r\244\227\366\337\033\367\351\332\260\353u\272\321_\246+\3438\327\tM\204\b\034\021/' \f\262D\347[\203\006\013\322\225&@\364\245\021gNvpS\263|\366\277\300\b\251\222\026\311\323G\200\036kbb\2729'y\340\207\004&\021\336\234\245\227\223q\352;\354\221\311\360\335\224\236\320\315y\315bv}]\036;\r\234\021Z\035\235\276\t\354\353\214\031\354\031\t\334\216*)\270\257\377\345\230\306\207ckM\237\246L[1\020\317]v\315]\267\250\001g;\210)\304\034S\225\033\207;\352$\003\233,\274\"54\206) \236\213\344\"\0261\017]\330{\212\316\355\005\352\344\217FHcH\314B\3175\354\232\205\362\t0\324i\317"
+	.ascii	"1E\227#\003\031D(~r7\0179\"=\251\235a\321\267_N\371\206\037\f"
+	.ascii	"\034\371\351\013\312\216\034E\344\211T\376a\361\234.\354!6*"
+	.string	"\323\257 9G~\242y\332\354Mu\267\265\225\205\344\026\262V\316\312\\v\315A2\217\347\246l\3438k9H\326a\343,\336U\003\276\354b\370\256h\341\321d\247\007z\020\202\242@\362\227\177\344\251\354\303\3429\255[F\314\032\227 \034V\006b\327\374\3438\353\336g\035f\264L9Db\364\221\257\334\216p\030\335\234{H\353\220\250\222T\3315[\325\030\265\260%\310\315\231\352\2010\236GH\227\253\361v\304nL\177\346K\177FKg(-e\252\343\316\207\376L\225\376L\224\376\214\223\376\314\f\375\347\033\371\311EJg\345.?\331\351\331%\t-\351\033\302\336\0303S\236\221i\374/5^nVjF\372Y\306\t?\240\250\335\234\355\345\214y\3519Z\247\265\245t\363g\202\364\263R\216\341\027\004M\fQ?'\251-Zy\2729#\351\"\031*\030\300\350`\203\302q\3633\322\237\211rQ>\372"
+	.ascii	"\013\213\031\232a<\037e\243\235\217:\210\332;(\037\325$\356\035"
+	.ascii	"Tc\355\005\326^\220\275\246\264\322\214\3712}\372~V\203qf\257"
+	.ascii	"\304\363P\314\035\223i\330\233\326\260\226\230\230\237!pumm'"
+	.ascii	"#!\\\224\212\364\235\345\375\374<\022Y\255;n\306\213ZWm\323\233"
+	.ascii	"\261\342]\nb7\bu3\336r\001\215CzI\346. \315\022;\251\2560\275"
+	.ascii	"Ajh\210\021\007\027\267\216jJ\334~d9F\324R\016\023a\334\214\017"
+	.ascii	"\357\022V\234\r!Vz\203\337\225+X\357\220\257\210\314\326\034"
+	.ascii	"v\225*\230\t\n\255;>*\"\201\177\232\003\326t\212\t1\224i\315"
+	.ascii	"M\237\020\316\220\272\031\023Z\273\230)LF\300\3304\007#T\250"
+	.ascii	"`A\335\026\2265\206\310\027x,x\364\232z{\002\323\030\210\200"
+	.ascii	"8\376\303\177\326\016FHm\315\3401Y\232\303\235\024)\030\007n"
+	.ascii	"\201*4\302\241l\b\336\315\330\257\315\b\222&7c\276{\230\246\004"
+	.ascii	"J\032#\245q\242y\317\303zz\257\331}\365\300\301\004G9\326\203"
+	.ascii	"\261\302\361\374\212\221\241q\272\2348\301P\216\200\372\210n"
+	.ascii	"\212\325\3351\224%\260\"co7c;\233&C\343N\221\355f\374\3446"
+	.string	"m/\257\275\233q\335M\3131\310\246\220n\306t\267\350X\364\346V\343f<w\301\0300%\212\245+\346H\024D\277\233\037#\244;\374\210\213\303LP`\351\200![\342\343J\356\230\311\213t/\353\371\247;8q\303K\3340\034\212'\326\221\214\0266\302\271\267c\270-\252C#6M\001S\332\3230\233\336>\260\256Pb\220\266\265c6\027\265\271%lJ.\340\240\215=%j{Pt|\351\253!KO^\272\202\254\2633\\\326\027\270\005\005O\013V\225\246\240\217\354d\270\354\356m\326\22785\026\265\001ILr\\\266\024'\004\027\345f,\205I\322\025,\001\303c`X\f\305\323\366\270\303oceW\353\261\330=\304wvZ\346n\306a\230\310\214\264\257\314\311\315\030\211\215\333\353\373\272\312\242=\f\t\271\020|\004\305>\366\261\201\240h\005X\344\370\210\2276\273\352\3523\202\273\214{>\336\376"
+	.ascii	"\215\340!\230\210\220iU\033&\202O\200G\327$%\270v8\243cb\242"
+	.ascii	"=p\341\026\270p\226~\006\211\231\262Q\t\002\2461D\001q\254u\273"
+	.ascii	"b-\213\330\200\263\275\231\004@F\347\224\301%L3\314\341C{\200"
+	.ascii	"\273\272\302Y1=\240\240\n\017g\314\n\317\354|\034ga \206Ho|\030"
+	.ascii	"\b\306z\242\004I\212\240L\225\342\334\340\017\253WA t\255If-"
+	.ascii	"\257l\355\346\277\320\320\036\002\251p\017*l\365\262\243X\212"
+	.ascii	"\"T\241\221\017e\177\353\315\330*\204!CD\356\022\036\026,g\210"
+	.ascii	"\332\202(\035xJ\007\226\302\260\243\366\336:\252\021\375Mi\226"
+	.ascii	"\242$\211\3558\226\302<l!\022D(<\002<\312\2443\211\304@Su\276"
+	.ascii	"\020\301\005\n;H\030\325\231db \346=#\222>:$tVd`\252N\345\bI"
+	.ascii	"\037\035\375\236\021\352\016r\351\343\\.EX\246hrx\317\b\n^ }"
+	.ascii	"\324\035\227\027\316\237\026#T\240\343\314Q\252?\024\370\321"
+	.ascii	"I\361\236\021\027\354\250.P`\241\243\366\234\240\340=#\234M\022"
+	.ascii	"\352\016\220\217\2162I\202\331\004\"\261\301\307\007H\251\\*"
+	.ascii	"\217\316\034\343\nK\345q\005R\365\311N\265\331Bma|\317\210\t"
+	.ascii	"\244(!\005\022N\225\207\211t~`\241\263\3649\2412\227'j^\374,"
+	.ascii	"O\344\274g\304\017\320\222\311\223\323\002\311D\376\220\320\031"
+	.ascii	"\200\216\022(F\271\3422]\23292\316\034%\317\217\213\222\347\007"
+	.ascii	"\253,$\233\271\331T\231;;\310\343\213\237\245Nf:\177\360\216"
+	.ascii	"\252\344I\372 \217;j\023(\253\315\343\2319<?#f\362\013\246\263"
+	.ascii	"\231\344QQ\320\320\303\003\264d\3668\233M$\322\211|\300O\323"
+	.ascii	"\004\345\362\004\325\211\004\362A\2520\002\2172\351t&[4\225H"
+	.ascii	"f\212\236fR\231$a\231\202\271$\301\231D\256@\200f\tN%\220O\022"
+	.ascii	"\251\202\003\234*\004TX\266\270\340T\002-O\3248\223\312\022\324"
+	.ascii	"\346\322G\247F\251\376,i\232\026h\252\313\035\034$\023hG\231"
+	.ascii	"$\241\202\235\244\017\362\0027\031v\324f\022\203\232\303\243"
+	.ascii	"L\252\312d\013\246\352Tw28]\250'\340\264P\235"
+	.string	"\315\027)\344\334d\350\360B\204"
+	.string	"4_\324\034\030\021~\200X,\227>7M\r<\311\0259J\022\234jSE\201\347g\303\317R\031s\235$SU\252<\372\035x\200"
+	.string	"\017>pq\374\007\n\320@\001\032\030\377\201\002J\224P\200\007%\364=(\201\2359M\023\324\026I\247v6\223\023\270\361Y.E\310qqvpv`\252-\200\232\357i2U\025\222\314\035\017Lg\005T\025\222\252\216\212\002\016\013\035\244\n\037\037\344\t\027L\230\013\\P}T S\250`t\346\250;K\023`\324\235e\213\354\314\241\300L\363gyT\235H\024\264\312B2\005\355\324L\231\035\244\212\302'\211L\301TW\254"
+	.ascii	"\022\301\205SFe\"{\256\323t\246\220\302\2162\271\242\002g\023"
+	.ascii	"\351\363\342TsH\310\240\2339*\017\262i\001\033g3G\006\306\231"
+	.ascii	"\263\001\007N\246\352\324A2\221=:9\316\345R\205\312\274@\343"
+	.ascii	"\314\251@\017\207/\177T&\t\347r\311$\021\363\202\351T[\250>\252"
+	.ascii	"\223C3\007\003\213&\322\004\3452\351\324Q\002\255\220I\302\374"
+	.ascii	"4[\3304\177xl\2349\037\034]\250;\312\022v\200\220*r\\,U\260\320"
+	.ascii	"A\372\250\330\320\344I\256P.O8\231\313\237\030g\216\007%\234"
+	.ascii	"\312$\220f\241\207\231\243:\221;?@9\032\324\034\246\232\\\221"
+	.ascii	"t*\325\235\022\234\314e\0056\374\003\020L\250\320\001\201\203"
+	.ascii	"\016F`8\b \234\370`\201\023 \240uF\370 \223L\265Ib\231$\241L"
+	.ascii	"\"[\220\320a6I\214\330\360\337\005\212\021\257\354(be\224\007"
+	.ascii	"7\340\333R*\312U`\234\266\004\261#\272~4\207tR`\fa=\230*\301"
+	.ascii	"'[.By\017\355\351j\352\346\365Kfi\t+\352\272<\247\230\260\303"
+	.ascii	"\255\212\313\266\313\"G#K^\314y3\253b\027`V\314M\234\2040m\311"
+	.ascii	"m H\333\342\273\371R\305\020\356X\225h);\352\351\360{B\274\205"
+	.ascii	"\307\256\260<\266,Wp&\254\211G\214C\033w\200L\302\262!N2\224"
+	.ascii	"\001\206$c\311jxa\213>\256`h^\342U\224\2333\310 $\314U\310\376"
+	.ascii	"\246/J<\304n\024>W)\222\251\322\0032e\023\3257\211\201\201yP"
+	.ascii	"\003\273\215\312\246\002\247\030\313\322\020\033Y\360y\220\306"
+	.ascii	"\334\230\225\r\221\276\341\003\004\304\210\013\210\016N\263a"
+	.ascii	"\036\227[\026\235a\213\217/O\301\211\302}R=\234\214\270\220\311"
+	.ascii	"%\325\360{\236\222\247\020\301\230\321w\276?-x\267\357&\035\211"
+	.ascii	"\020\351\244u:\303\225\236^\336\303\211\302\2002\246\022\215"
+	.ascii	"\350'Y\240-\3305\357=\312\220 iV:C\023(Pr\2365\223!E\204f\212"
+	.ascii	"\340\335\215\214\367\234\007\363G\204vv\267\320\320\2111] \322"
+	.ascii	"\031\304\346\346\262]\206\260=8\365cK\222\237<\333\2715\375`"
+	.ascii	"\253[\237[\260.\323\275\024R\001\034\242\021\302\261\325c\212"
+	.ascii	"\316\340\367\366\226\233\3301&\305\255\027\247\2567>&\317M\356"
+	.ascii	"R\226Q`\217\233\263\334\345\360\346\013\243\2739\307\345%\031"
+	.ascii	"\016Lk\220\261\366\257\3456;\226\207\210\345po\247\0201D\266"
+	.ascii	"\236~\231\355\271\255\306\211n\256\213\310\234\025\300\250\233"
+	.ascii	"_\263\265\206,\020G\236\303\362\221\254\206\371d\366sl/\035\333"
+	.ascii	"\346\f[8\334P\247\0201bHby\267\354Y\3559m\003\023\0174B\204/"
+	.ascii	"\350\346\214\366\034\204\221"
+	.string	"\250\003\023\323\201p@\346\024SL\231\021\232\321$i\f\343\024@@@H4\233\r\2101\037\023\300S\350\023\252\226G\025c%\"I\222\024\206\335\347\262\271\f;\362\232\203\222#\356\2528\251\333\3210\314\005\337\021G\2451\0012\324\333\347\312\312g\337\3054\025\002S\343\036T\242\n$B)\027kZ\023\3614j\254\344\330\263\026\034|s\327\314^\313\210\231\351Y\267\256\272N%/\205\253p\026\315}\235\344b\262\241\260\236\221\235\035hL\305)\303@\272\235\256b\237\002Ir\224\372\377\263B\205\314\365\242\274\217\305\rB\256\034X\346\304M8\021O9\204R\223\376\007I\221\232k \257\020\332\341hh\205\261J\333Ub\313\322\262P\240\233\244-\363\361\031Q\227\025\224A\264\001N9!\212\264\322$K\257\317\b\333:\324\3324\214Js\031\333\243\240\033\215L~\376\373\245\265\332\374\263dx\215m'7"
+	.ascii	"]\313r\211,6TF\320\257\255.\004\263"
+	.string	"_\210\211t\221\345\005V2\211\230\206\375\265\231@\250-\177\340\267\233\032\326\202\331iY\364\3556\302HkB`\f\022W\2153$\013^\373\333\365G\245\2300)\203\316\344\345\210\363:6Mh\002\361\260Dj><\313\322\253^\352S\230\035\363\n\276\314\332\346l\022\320o\0378C\3332\301\377\031\026 \204X\201Q\302P\206S\244\240\237\363\027\263\262a\357\322>\027\324v\033A9\256Y!\373\226\350\322!\250$\263\343\fb\250R\205?\030K\273>P\211@\355\fE\021\242\336F\303\314L\214\275\250G{CA\340\211P\033d\355;\213\212\327}Rb_\274f\005S\235.\364g8\351t\327yo\367\324,W\242\340\313\251\341Yv\205\310\017\021\030\242\314,1\250\002\275<\2424\027\216\300\325\353|\220\373#(\020\013K\255G\022$W\202V\362 \365\246|\270#\341\243\001\315\201\311\013P/o\225"
+	.ascii	"\3664~e\246\243'\t\177\320^>\2137k`\252\236\024%\234\312"
+	.string	"\354\345q\206$\035{\002\233\217P\n\255w\f\341H\"\351\\\316\004i\253As\033_\372yM\261\350{\206+\216\240\016\375\025\n&T\242%eF\253\360osM\3047\344\212I\201\212S&O\363@$M\234V\035\026OHT\210\016\337\236g\326\365\0021\2412\311>xc\210D\314=\b\376e\365\276/&6;\373\271\327\345\221\265\005VR4\262\315\251\352Q\220\364\226\311\270n\353B\031z\311)\325?U\274I0\277%\276\374(k=\274\232`\3646BE\037\214\356\275\273\241\200~6[{\005\343\256\037\257Z\325\027B{\002\342\201\3630\263\262A\210\305c8Z\235K\346\352\007\033=\211\217\264\220yVhO\250g\001CT\364\255m\263\263a\372z\263\214\n\0302\250P9@\300(\242\334Bbo{\345\342\207\354\221\210\347\023.\276X\275;\253\002\252\226\023\212\330\005$\200lJJ\212\201"
+	.ascii	"3\215\344T\242\322:`A\037\364\206\244q\034\302\270\376A\027\340"
+	.ascii	"p\216\224\343>C\224(\271\2403\2118\"\264\257\f\030\301\374\257"
+	.ascii	"\td`\320\262b\242k\343\234n,\301p\026\371W\3603\334\206(\300"
+	.ascii	"\r\351;\332\333>^\311y\263\327\032!\021\216\301(\240\322\216"
+	.ascii	"\257\025\025\030Y\327/t\016\225'\311.gV7\230o\037\347Q\303\227"
+	.ascii	"-F40\204\332\rH\004)\252J\365\315\202\016D[\262\036\350C\240"
+	.ascii	"\300\256\220c\225N\375s\372\244|\307\211\253\376\001\343g2~\355"
+	.ascii	" 0\201U\246F\315\344\263p\212\345C\206\260 Z~S#\321%\250\377"
+	.ascii	">>\020&-\371JI#\375\320\321\252\f\253\035\317\204O\354\377`\202"
+	.ascii	"\352\253S\f8\302\336\375\261b\007\235\001,\212\371d@\222\032"
+	.ascii	"\337IC\204\b\023O\202dE\371~\023\321z\371\336E\346%\026X\354"
+	.ascii	"\3677U\333?\236\377\207\263\276\211\211\001\241\223\322\300\330"
+	.ascii	"\326\253\375\210\004\362&\360\344\224}j\n\227\\"
+	.string	"\214r\220y\231>\"\272\271\\\227"
+	.string	"\023\227\326\204\2279O\020\272\017\246\220\213(G\332\325\344\024\034\252\030\277v\250\314\311\357\024\034\271\273\013\035,X\037\3514\\\n\301Q\027\305\356\304\366\2669\001\031\252\3402\241\265\351\341\365\346\307\266\333V\200\004\037\310\253\005y\365N\356\275L\007\005\327?\035G\337\366\306_J\033\030\220\244\347B\032\006\013\214\013\f\200[\220\241"
+	.ascii	"@\270c\313\272i\004\263g\242\001O\200_\235\002\\\314^\2024\343"
+	.ascii	"\025\357\214'\237\305A)tu\007H8@\331\2254\342\3450\300\322"
+	.string	">\372;\344&\224\030I\377\220\337\332G\260\263\325(\335\331\3328M\205P\246\317<\026\255\211\363+\037\300\224>\f\334\355\227@P\006\336j\361@\006\240\016\003#\n$\207\307\214N\347\321\342\351\266\222_`?v\306\t\\\275}>\021\346\221\b\263t\202^|\016\324\221<\363\372\230\257a\320\030\321\026\371\323v\205\233{\002\346 \007\344\206\244\200\342\f\201\032v\216\\\326B)\245\n\224\352\277&\031\024\242\345x\034S\372\3367<`cL0\265\220\365\0261u_=\301\345\352\227I\003Hp\203P\225\241Ji\214\247c\nU- &\264\t\027\246~\230\234\377Y\201l\336\267&\203\255\2029{\235\022a\371p\236)\3459\215\300)\021\250<\267\215F\221\233Wp\"\30602\301\001L\302\266|\220Gc\fA\275\226\362R'B\354[\\\311\355\277>\301\270\013Om62F\177\004\027\265\263\275\245\310"
+	.string	"\372\020\002\317~\307K/\007a\361\376\244\210\262\200\217~6C$\355\217\362'?@\033s\017/\244\234\374\216\354\263\315\306\306\002\300$j(\374\270\bO)l\261(\234\331d\355\327\240\211K\335\342\261:\335\306\\\261:O\257\006\301G\212uB\206\272\323\263\372\304\024\016\272[\003\n\325f\033\345\003\b@\023>\376\351W\344:Yv\343\013\344o\277\356\262\2607$\t\212NtH#\252\303\263\326\241\347\265\226Z\032:\330c+\211\251\231o\212U\322\033gQ@\351~\303me\313$\200HI\023"
+	.string	"\2334#{\331\305\f\302Ym\375\343MM\333\206\225\340\t\216\\\312D\032\251\255\344w\033\301\262\334\265\377\301n\005\035y%\242\245\234\\1F\321\212\231:@\f\232\270\264\256c_\240\340\304\351\201O\301\323\354\252?\263,\302j\332t\221q\341\347\352>\211\350\013Zw|\267U:\"G\251\272\372\244\322\306\255Z\214\002x\322S\307\320o\331\276\377\216\263\306u\312\355\2760\330^\252\353\004\025i\304#=\253\367\361\346v\023\022\220ut3%'\0058\311m\334\2235\200\373\301\216q\035\243_\036b4c\372\373RQJ\260\005\024\235A\260F\240\350\204|@a5\272/\333\236\027\032\244\302\340\316\027:\036\267\203E\005\313\204\236\366$\020\240r\030\355[\021\304@\013\203\021@\326\330\212_\304\006&\020n"
+	.ascii	"\343nd\320S\227o\310\016qj\340\263E\222\341\362\353\016o\353"
+	.ascii	"p\313\256\307\306\235\377\037\0049\241\330\344\302\003u\331y"
+	.ascii	"w\355\035{dd\305Amv\332\002\235\270\374\322\343m\310N\310\177"
+	.ascii	"l\274!K\353\346|\261\357=\232\341\036\271p\225\300\027t\367\321"
+	.ascii	"\320\233\205[\027\204}x\353\263\263\372\n\\\277zQS\030\224\317"
+	.ascii	"yw\204Ex\234\024\177\267\3415\332?\346\373d\375\210\330GM\022"
+	.ascii	"\337\\\345\370t\303\316\315v\360\355!p\223\334\341\353\243\363"
+	.ascii	"\037\367KhG\007z+\304m\310\265\262\273\257\356\267\335ua\317"
+	.ascii	"\245\357\235\277\271\362*\364\251d\337\212\037\2419\026\257\333"
+	.ascii	"./\346\231\031\230\267\016$\034\266_\036\016\030F\362`\204\343"
+	.ascii	"\306\225\247T?\313u~\250\272\376&\001#\220\377\3724w\251\017"
+	.ascii	"\002\373\337qU\321\001f7\254s+\340m_\237kl\265\037z\376\224="
+	.ascii	"\025\277\357|\376\221\272\356\374\001\375\026~\274\331\277{P"
+	.ascii	"\220\177\210\367B\311\323\306Ed\360\372\273S\\\224\233\211\356"
+	.ascii	"\022\355\360:\327\361G=\267GSq\246\272\263\221{\347\221\313\356"
+	.ascii	"\026\217\372\342\366\\V\366\337\322u\364>-\3409\273\177\035\362"
+	.ascii	"B\267K\331Q#/\353\013\336\223\347\245\347\237\365\253P\374\324"
+	.ascii	"9\332_l\007\353\257\013\025\216mf\355QSs\037\244u\266k\343\021"
+	.ascii	"\271Pt\036\272\001\335\002\354\276\261^`\327\3265/\346\345\363"
+	.ascii	"\261\177\n\253bOR\277.\r\236\367\375\355\271g\020{+\3022O\031"
+	.ascii	"\356\032\035\275\374\213\330\026\323\257\363\0172\237\327\245"
+	.ascii	"\371jP\371\311V\307\027\217\247\030r\334\251\210]\351\246\354"
+	.ascii	"\273\013]\001"
+	.text
+	.section	.gnu.lto_.symtab.71f14211fb1f2ba6,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"serialEvaluateNonMspData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.71f14211fb1f2ba6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
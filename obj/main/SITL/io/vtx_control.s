@@ -0,0 +1,8705 @@
+	.file	"vtx_control.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	vtx_control.c.f7ddae47
+	.weak	vtx_control.c.f7ddae47
+vtx_control.c.f7ddae47:
+	.long	0x97
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3
+	.long	.LASF1500
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1487
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1488
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1489
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1490
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1491
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1492
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1495
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1493
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1494
+	.uleb128 0x2
+	.long	.LASF1496
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x5
+	.long	.LASF1501
+	.byte	0x3
+	.byte	0xa1
+	.byte	0xa
+	.long	0x6d
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1497
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1498
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1499
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 4 "./src/main/io/vtx_control.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.file 7 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9e
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF525
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF579
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF652
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF692
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF579
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF752
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF756
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF757
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF820
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 24 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 25 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 26 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF912
+	.byte	0x4
+	.file 28 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1c
+	.file 29 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 30 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 31 "./src/main/drivers/buttons.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x4
+	.file 32 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x20
+	.file 33 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 35 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x23
+	.file 36 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1063
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x25
+	.byte	0x4
+	.file 38 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x26
+	.file 39 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x4
+	.file 40 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0x4
+	.file 41 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 42 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2b
+	.file 44 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.file 45 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 46 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 47 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1456
+	.byte	0x4
+	.file 48 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 50 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 51 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1466
+	.byte	0x4
+	.file 52 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 53 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x36
+	.byte	0x4
+	.file 55 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x37
+	.file 56 "./src/main/fc/rc_modes.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1486
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF434
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF486
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF505
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF522
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF524
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF529
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF530
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF531
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF532
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF533
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF534
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF537
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF538
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF539
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF541
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF542
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF544
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF548
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF572
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF573
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF584
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF589
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF590
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF637
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF651
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF681
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF683
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF685
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF687
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF689
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF691
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF707
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF875
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF889
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF937
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1052
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1062
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1477
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1485
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1502
+	.long	.LASF1503
+	.long	.LASF1504
+	.long	.LASF1505
+	.long	.LASF1506
+	.long	.LASF1507
+	.long	.LASF1508
+	.long	.LASF1509
+	.long	.LASF1510
+	.long	.LASF1511
+	.long	.LASF1512
+	.long	.LASF1513
+	.long	.LASF1514
+	.long	.LASF1515
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x39
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1516
+	.byte	0xa
+	.long	.LASF1517
+	.byte	0xa
+	.long	.LASF1518
+	.byte	0x7
+	.long	.LASF1519
+	.byte	0x6
+	.long	.LASF1520
+	.byte	0xd
+	.long	.LASF1521
+	.byte	0x9
+	.long	.LASF1522
+	.byte	0x8
+	.long	.LASF1523
+	.byte	0xe
+	.long	.LASF1523
+	.byte	0xd
+	.long	.LASF1524
+	.byte	0xa
+	.long	.LASF1525
+	.byte	0xd
+	.long	.LASF1526
+	.byte	0xd
+	.long	.LASF1527
+	.byte	0xa
+	.long	.LASF1528
+	.byte	0xa
+	.long	.LASF1529
+	.byte	0xc
+	.long	.LASF1530
+	.byte	0xa
+	.long	.LASF1531
+	.byte	0xb
+	.long	.LASF1532
+	.byte	0xb
+	.long	.LASF1533
+	.byte	0xa
+	.long	.LASF1534
+	.byte	0xa
+	.long	.LASF1535
+	.byte	0xa
+	.long	.LASF1536
+	.byte	0xa
+	.long	.LASF1537
+	.byte	0xe
+	.long	.LASF1538
+	.byte	0x8
+	.long	.LASF1539
+	.byte	0x2
+	.long	.LASF1540
+	.byte	0x3
+	.long	.LASF1541
+	.byte	0xe
+	.long	.LASF1542
+	.byte	0x3
+	.long	.LASF1543
+	.byte	0x1
+	.long	.LASF1544
+	.byte	0x3
+	.long	.LASF1545
+	.byte	0x4
+	.long	.LASF1546
+	.byte	0x4
+	.long	.LASF1547
+	.byte	0x4
+	.long	.LASF1548
+	.byte	0x2
+	.long	.LASF1549
+	.byte	0x4
+	.long	.LASF1549
+	.byte	0x2
+	.long	.LASF1550
+	.byte	0x4
+	.long	.LASF1551
+	.byte	0x5
+	.long	.LASF1552
+	.byte	0x4
+	.long	.LASF1553
+	.byte	0x4
+	.long	.LASF1554
+	.byte	0x4
+	.long	.LASF1555
+	.byte	0x4
+	.long	.LASF1556
+	.byte	0x4
+	.long	.LASF1557
+	.byte	0x4
+	.long	.LASF1558
+	.byte	0x4
+	.long	.LASF1559
+	.byte	0x4
+	.long	.LASF1560
+	.byte	0x4
+	.long	.LASF1561
+	.byte	0x4
+	.long	.LASF1562
+	.byte	0x4
+	.long	.LASF1563
+	.byte	0x4
+	.long	.LASF1564
+	.byte	0x4
+	.long	.LASF1565
+	.byte	0x5
+	.long	.LASF1566
+	.byte	0x6
+	.long	.LASF1567
+	.byte	0x6
+	.long	.LASF1568
+	.byte	0x6
+	.long	.LASF1569
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF765:
+	.string	"INT32_MAX (2147483647)"
+.LASF1484:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1320:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"__STD_TYPE typedef"
+.LASF405:
+	.string	"USE_CLI_BATCH "
+.LASF1189:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF577:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1056:
+	.string	"LED0_ON NOOP"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1014:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1202:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"PG_PWM_CONFIG 508"
+.LASF1235:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF1421:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF676:
+	.string	"__stub_sigreturn "
+.LASF541:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF906:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF479:
+	.string	"USE_UART6 "
+.LASF639:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1359:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1353:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"LED_STRIP_TIMER 1"
+.LASF975:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF653:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF614:
+	.string	"__flexarr []"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1472:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF811:
+	.string	"INT16_C(c) c"
+.LASF938:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1073:
+	.string	"IOCFG_IPD 0"
+.LASF1111:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF885:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF804:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF820:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1161:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1358:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"USE_UART1 "
+.LASF1266:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF875:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF1188:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF480:
+	.string	"USE_UART7 "
+.LASF1340:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1326:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1290:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1016:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF628:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1140:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF752:
+	.string	"__STD_TYPE"
+.LASF1453:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF790:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF601:
+	.string	"__P(args) args"
+.LASF1155:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1218:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1050:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF720:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1034:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1349:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF413:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1361:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF442:
+	.string	"VTX_TRAMP "
+.LASF1164:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF489:
+	.string	"USE_VCP"
+.LASF1089:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1122:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF794:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF518:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1043:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF850:
+	.string	"_GCC_SIZE_T "
+.LASF955:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF547:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1392:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1471:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF759:
+	.string	"INT8_MIN (-128)"
+.LASF746:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF865:
+	.string	"___int_wchar_t_h "
+.LASF704:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1093:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF589:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF430:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1001:
+	.string	"PG_PID_CONFIG 504"
+.LASF933:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF616:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF840:
+	.string	"_T_SIZE "
+.LASF1357:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1046:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1322:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF532:
+	.string	"__USE_POSIX2"
+.LASF1257:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF789:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1262:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1149:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1418:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF531:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF954:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1008:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF947:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF454:
+	.string	"U_ID_1 1"
+.LASF750:
+	.string	"_BITS_TIME64_H 1"
+.LASF1137:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF943:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF441:
+	.string	"VTX_SMARTAUDIO "
+.LASF496:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1203:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF672:
+	.string	"__stub_fchflags "
+.LASF1316:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF821:
+	.string	"_STDDEF_H "
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF729:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1289:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1211:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1108:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF585:
+	.string	"__GNU_LIBRARY__"
+.LASF535:
+	.string	"__USE_XOPEN"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1095:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF540:
+	.string	"__USE_XOPEN2K8"
+.LASF435:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF638:
+	.string	"__always_inline"
+.LASF838:
+	.string	"_SYS_SIZE_T_H "
+.LASF410:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1162:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF551:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF761:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF587:
+	.string	"__GLIBC__ 2"
+.LASF555:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF888:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1493:
+	.string	"long int"
+.LASF579:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1224:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF892:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1239:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1311:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF556:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF573:
+	.string	"__USE_XOPEN2K8 1"
+.LASF738:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1448:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF902:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF828:
+	.string	"_PTRDIFF_T_ "
+.LASF552:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF425:
+	.string	"CMS "
+.LASF381:
+	.string	"__unix 1"
+.LASF1278:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1368:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF434:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF749:
+	.string	"__FD_SETSIZE 1024"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF485:
+	.string	"STACK_CHECK"
+.LASF1292:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1388:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF796:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF728:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF635:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF636:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF619:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF603:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF928:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1227:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF499:
+	.string	"USE_SERIALRX_XBUS"
+.LASF659:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF896:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF946:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1299:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF624:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF803:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF419:
+	.string	"TELEMETRY "
+.LASF1159:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF916:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF905:
+	.string	"Q12 (1 << 12)"
+.LASF524:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1015:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1470:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF936:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1097:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF580:
+	.string	"__USE_MISC 1"
+.LASF1419:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF679:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF553:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF584:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF594:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF927:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF881:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"signed char"
+.LASF983:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF835:
+	.string	"__size_t__ "
+.LASF1343:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF694:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF605:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF926:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1146:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF498:
+	.string	"USE_SERIALRX_SUMH"
+.LASF652:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF999:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1401:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF463:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1302:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF994:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF961:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF725:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF988:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF490:
+	.string	"USE_PPM"
+.LASF1066:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF513:
+	.string	"VTX_SMARTAUDIO"
+.LASF727:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1119:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1487:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF561:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF602:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF781:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1382:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1377:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF848:
+	.string	"__DEFINED_size_t "
+.LASF1247:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF967:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF393:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF521:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF421:
+	.string	"TELEMETRY_HOTT "
+.LASF1143:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"TELEMETRY_SRXL"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1217:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF997:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF760:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1060:
+	.string	"LED2_TOGGLE NOOP"
+.LASF1499:
+	.string	"_Bool"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF646:
+	.string	"__restrict_arr __restrict"
+.LASF670:
+	.string	"__stub___compat_bdflush "
+.LASF1074:
+	.string	"IOCFG_IPU 0"
+.LASF844:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF872:
+	.string	"NULL"
+.LASF1475:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF736:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF548:
+	.string	"__USE_GNU"
+.LASF423:
+	.string	"USE_RESOURCE_MGMT "
+.LASF776:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF969:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF625:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF774:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1033:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF681:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF992:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1100:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF675:
+	.string	"__stub_setlogin "
+.LASF1053:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1428:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1286:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF510:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF697:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF719:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1233:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF658:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1416:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"UINT32_C(c) c ## U"
+.LASF1181:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF1091:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF472:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1037:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF538:
+	.string	"__USE_XOPEN2K"
+.LASF611:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF751:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF539:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1084:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1031:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF641:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF686:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1200:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1088:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF879:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF465:
+	.string	"USE_FAKE_GYRO "
+.LASF570:
+	.string	"__USE_POSIX199309 1"
+.LASF1051:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF787:
+	.string	"INT_FAST8_MAX (127)"
+.LASF775:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF847:
+	.string	"_SIZE_T_DECLARED "
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF948:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF468:
+	.string	"BARO "
+.LASF795:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF533:
+	.string	"__USE_POSIX199309"
+.LASF766:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1096:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1105:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF923:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF890:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1007:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF830:
+	.string	"___int_ptrdiff_t_h "
+.LASF1437:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF977:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1082:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1223:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1460:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF588:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF537:
+	.string	"__USE_UNIX98"
+.LASF409:
+	.string	"USE_SERIALRX_CRSF "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1154:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF554:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF448:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1086:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1026:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1002:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF973:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF713:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1483:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF846:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1114:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF698:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1476:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF853:
+	.string	"__need_size_t"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF743:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF984:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF645:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF411:
+	.string	"USE_SERIALRX_SBUS "
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF783:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF610:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF745:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF735:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF878:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF689:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF908:
+	.string	"bool _Bool"
+.LASF1148:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"BIT(x) (1 << (x))"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1036:
+	.string	"STR_HELPER(x) #x"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1461:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF1256:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1434:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF861:
+	.string	"_BSD_WCHAR_T_ "
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1265:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1025:
+	.string	"IO_TAG_NONE 0"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF792:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF398:
+	.string	"I2C1_OVERCLOCK true"
+.LASF682:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF623:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF617:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1157:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1131:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF452:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF793:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1458:
+	.string	"I2CDEV_COUNT 4"
+.LASF1334:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF505:
+	.string	"USE_RESOURCE_MGMT"
+.LASF418:
+	.string	"LED_STRIP "
+.LASF683:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF873:
+	.string	"NULL ((void *)0)"
+.LASF1268:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1032:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF884:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF633:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF500:
+	.string	"LED_STRIP"
+.LASF644:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF829:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF1250:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1172:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1398:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF574:
+	.string	"_ATFILE_SOURCE"
+.LASF703:
+	.string	"__SLONG32_TYPE int"
+.LASF402:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1021:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF724:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1127:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF525:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF527:
+	.string	"__USE_ISOC11"
+.LASF578:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF437:
+	.string	"USE_SENSOR_NAMES "
+.LASF755:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF757:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1413:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF424:
+	.string	"USE_SERVOS "
+.LASF1293:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1098:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF799:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1027:
+	.string	"NOOP do {} while (0)"
+.LASF726:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1013:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF692:
+	.string	"_BITS_TYPES_H 1"
+.LASF767:
+	.string	"UINT8_MAX (255)"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1373:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF564:
+	.string	"_POSIX_SOURCE"
+.LASF889:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1495:
+	.string	"__uint32_t"
+.LASF1260:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__USE_ISOC95 1"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF662:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF839:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1501:
+	.string	"SystemCoreClock"
+.LASF883:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1054:
+	.string	"LED0_TOGGLE NOOP"
+.LASF1275:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"UNUSED(x) (void)(x)"
+.LASF615:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1480:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1079:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1191:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"INT16_MAX (32767)"
+.LASF1080:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF30:
+	.string	"_LP64 1"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF597:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1462:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1103:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF526:
+	.string	"_FEATURES_H 1"
+.LASF559:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1277:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"VERY_FAST_MATH "
+.LASF595:
+	.string	"__LEAF , __leaf__"
+.LASF542:
+	.string	"__USE_LARGEFILE"
+.LASF522:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF436:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1242:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF627:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1332:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1042:
+	.string	"PP_IIF_0(t,f) f"
+.LASF1062:
+	.string	"LED2_ON NOOP"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1052:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1409:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF708:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1457:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1028:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1338:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF972:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1371:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF634:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF563:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1415:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"_T_PTRDIFF_ "
+.LASF1071:
+	.string	"IOCFG_AF_PP 0"
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1463:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF546:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1124:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF503:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1142:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1269:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF882:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1077:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1308:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1352:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF744:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF401:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF956:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1459:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF400:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF857:
+	.string	"_T_WCHAR_ "
+.LASF1201:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF921:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF655:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF459:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF607:
+	.string	"__END_DECLS "
+.LASF1328:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1331:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF842:
+	.string	"_SIZE_T_ "
+.LASF1041:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF1274:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1212:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1078:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF433:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1452:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF854:
+	.string	"__wchar_t__ "
+.LASF1406:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF664:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF669:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1226:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"USE_FLASHFS "
+.LASF523:
+	.string	"_STDINT_H 1"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF471:
+	.string	"USE_FAKE_FLASH "
+.LASF940:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF932:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF939:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF798:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1176:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF650:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1295:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__WCHAR_T "
+.LASF990:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1497:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF511:
+	.string	"VTX_COMMON"
+.LASF1424:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF600:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1085:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF929:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1356:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1451:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF631:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF649:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1099:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF591:
+	.string	"__PMT"
+.LASF1004:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1482:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1092:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1090:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF901:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1379:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1173:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF575:
+	.string	"_ATFILE_SOURCE 1"
+.LASF699:
+	.string	"__SQUAD_TYPE long int"
+.LASF1280:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1101:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1272:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1072:
+	.string	"IOCFG_AF_OD 0"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF549:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF666:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF823:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF897:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF877:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1481:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF444:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1314:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF365:
+	.string	"__k8 1"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF661:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF950:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1489:
+	.string	"unsigned int"
+.LASF754:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF917:
+	.string	"UNIT_TESTED "
+.LASF1011:
+	.string	"PG_VCD_CONFIG 514"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF592:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF416:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF935:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1022:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF545:
+	.string	"__USE_MISC"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF891:
+	.string	"sq(x) ((x)*(x))"
+.LASF822:
+	.string	"_STDDEF_H_ "
+.LASF868:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1195:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF422:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1281:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1412:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF572:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF737:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF733:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1474:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1167:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF696:
+	.string	"__U32_TYPE unsigned int"
+.LASF1341:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1194:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF622:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF953:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF824:
+	.string	"_PTRDIFF_T "
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF626:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1304:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF673:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF778:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1206:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF771:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1113:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF690:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF431:
+	.string	"TELEMETRY_SRXL "
+.LASF637:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF501:
+	.string	"TELEMETRY_FRSKY"
+.LASF910:
+	.string	"false 0"
+.LASF494:
+	.string	"USE_SERIALRX_IBUS"
+.LASF970:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF810:
+	.string	"INT8_C(c) c"
+.LASF909:
+	.string	"true 1"
+.LASF832:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF702:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF748:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF586:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF712:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF462:
+	.string	"ACC "
+.LASF1179:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1430:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1443:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF721:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF952:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1059:
+	.string	"LED1_ON NOOP"
+.LASF598:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF654:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__STRING(x) #x"
+.LASF680:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF483:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF651:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF450:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1019:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1325:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"__need_NULL"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF849:
+	.string	"___int_size_t_h "
+.LASF1427:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF968:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF1220:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"_WCHAR_T "
+.LASF1259:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"MAG "
+.LASF1058:
+	.string	"LED1_OFF NOOP"
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1440:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF469:
+	.string	"USE_FAKE_BARO "
+.LASF504:
+	.string	"TELEMETRY_MAVLINK"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1283:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"_GCC_PTRDIFF_T "
+.LASF446:
+	.string	"USE_NAV "
+.LASF1067:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF674:
+	.string	"__stub_revoke "
+.LASF1117:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF987:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1494:
+	.string	"char"
+.LASF599:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF660:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF837:
+	.string	"_SIZE_T "
+.LASF864:
+	.string	"_WCHAR_T_H "
+.LASF1397:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF960:
+	.string	"PG_RX_CONFIG 24"
+.LASF941:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF773:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF931:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF467:
+	.string	"USE_FAKE_MAG "
+.LASF514:
+	.string	"VTX_TRAMP"
+.LASF1454:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1252:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1133:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1238:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF951:
+	.string	"PG_PID_PROFILE 14"
+.LASF1112:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF495:
+	.string	"USE_SERIALRX_SBUS"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF920:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1488:
+	.string	"short unsigned int"
+.LASF1215:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF841:
+	.string	"__SIZE_T "
+.LASF417:
+	.string	"BLACKBOX "
+.LASF1030:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF464:
+	.string	"GYRO "
+.LASF1456:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1208:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF529:
+	.string	"__USE_ISOC95"
+.LASF801:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF528:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1425:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1391:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF536:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF508:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF904:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF486:
+	.string	"USE_DASHBOARD"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1296:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF606:
+	.string	"__BEGIN_DECLS "
+.LASF1128:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1115:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF867:
+	.string	"_GCC_WCHAR_T "
+.LASF1486:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF782:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1029:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF443:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF571:
+	.string	"__USE_POSIX199506 1"
+.LASF993:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF758:
+	.string	"__intptr_t_defined "
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF428:
+	.string	"TELEMETRY_IBUS "
+.LASF1047:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF740:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF390:
+	.string	"SITL 1"
+.LASF1049:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1221:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF530:
+	.string	"__USE_ISOCXX11"
+.LASF963:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF845:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1284:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1350:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"__U64_TYPE unsigned long int"
+.LASF827:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF779:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1490:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF567:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1193:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF512:
+	.string	"VTX_CONTROL"
+.LASF1151:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1197:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1367:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF630:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF534:
+	.string	"__USE_POSIX199506"
+.LASF812:
+	.string	"INT32_C(c) c"
+.LASF1467:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF817:
+	.string	"UINT64_C(c) c ## UL"
+.LASF934:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1422:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"USE_SPI"
+.LASF1106:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF493:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1313:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__WORDSIZE 64"
+.LASF852:
+	.string	"__size_t "
+.LASF863:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1246:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1344:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF922:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF677:
+	.string	"__stub_stty "
+.LASF1023:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF426:
+	.string	"TELEMETRY_LTM "
+.LASF432:
+	.string	"USE_DASHBOARD "
+.LASF1076:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1500:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1254:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF612:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1346:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF962:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF705:
+	.string	"__S64_TYPE long int"
+.LASF1209:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF843:
+	.string	"_BSD_SIZE_T_ "
+.LASF609:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF819:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF1145:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF858:
+	.string	"_T_WCHAR "
+.LASF685:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF695:
+	.string	"__S32_TYPE int"
+.LASF769:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF949:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1287:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1245:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF406:
+	.string	"USE_PPM "
+.LASF520:
+	.string	"DEFIO_NO_PORTS "
+.LASF807:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1298:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF753:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1404:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1061:
+	.string	"LED2_OFF NOOP"
+.LASF813:
+	.string	"INT64_C(c) c ## L"
+.LASF451:
+	.string	"SKIP_IMU_CALC "
+.LASF581:
+	.string	"__USE_ATFILE 1"
+.LASF978:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF974:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF860:
+	.string	"_WCHAR_T_ "
+.LASF1163:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF893:
+	.string	"FAST_MATH "
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1232:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF862:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF900:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1121:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1485:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"__stub_chflags "
+.LASF458:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF407:
+	.string	"USE_PWM "
+.LASF851:
+	.string	"_SIZET_ "
+.LASF1104:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF739:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF408:
+	.string	"SERIAL_RX "
+.LASF1109:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF445:
+	.string	"GPS "
+.LASF1400:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF399:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1431:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF732:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1003:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF710:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1190:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF642:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF460:
+	.string	"USE_FAKE_LED "
+.LASF439:
+	.string	"VTX_COMMON "
+.LASF989:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF945:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1329:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF632:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF488:
+	.string	"USE_ADC"
+.LASF976:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1376:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1386:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"PG_GPS_CONFIG 30"
+.LASF791:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF925:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF1055:
+	.string	"LED0_OFF NOOP"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF449:
+	.string	"SIMULATOR_BUILD "
+.LASF492:
+	.string	"SERIAL_RX"
+.LASF1083:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF964:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1024:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1251:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF1492:
+	.string	"short int"
+.LASF590:
+	.string	"_SYS_CDEFS_H 1"
+.LASF980:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF957:
+	.string	"PG_SERVO_MIXER 21"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF515:
+	.string	"USE_I2C"
+.LASF557:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1152:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF1335:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1134:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF763:
+	.string	"INT8_MAX (127)"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1473:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF620:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF903:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF447:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1230:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1468:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF918:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF657:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1192:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1301:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF700:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF484:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF834:
+	.string	"__need_ptrdiff_t"
+.LASF1205:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF944:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF668:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF487:
+	.string	"TELEMETRY_LTM"
+.LASF618:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF919:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1081:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF995:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF717:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1310:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF621:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF701:
+	.string	"__SWORD_TYPE long int"
+.LASF1116:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"IOCFG_OUT_OD 0"
+.LASF855:
+	.string	"__WCHAR_T__ "
+.LASF455:
+	.string	"U_ID_2 2"
+.LASF985:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF629:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1102:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF714:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF568:
+	.string	"__USE_POSIX 1"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF797:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1040:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF667:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF869:
+	.string	"__DEFINED_wchar_t "
+.LASF1094:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF971:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF913:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1065:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF815:
+	.string	"UINT16_C(c) c"
+.LASF808:
+	.string	"WINT_MIN (0u)"
+.LASF403:
+	.string	"USE_CLI "
+.LASF440:
+	.string	"VTX_CONTROL "
+.LASF1355:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF693:
+	.string	"__S16_TYPE short int"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF809:
+	.string	"WINT_MAX (4294967295u)"
+.LASF438:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF427:
+	.string	"TELEMETRY_CRSF "
+.LASF1038:
+	.string	"EXPAND_I(x) x"
+.LASF1465:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1214:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF640:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF456:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1048:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF731:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF898:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF722:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF762:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1407:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1436:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1446:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1118:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF475:
+	.string	"USE_UART2 "
+.LASF709:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF907:
+	.string	"_STDBOOL_H "
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1455:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF404:
+	.string	"USE_SETTINGS_INDEX "
+.LASF937:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF870:
+	.string	"_BSD_WCHAR_T_"
+.LASF979:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF777:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1136:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"uint32_t"
+.LASF1187:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF711:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF772:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF476:
+	.string	"USE_UART3 "
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF784:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1130:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF565:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF569:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF723:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF519:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF866:
+	.string	"__INT_WCHAR_T_H "
+.LASF663:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1317:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF481:
+	.string	"USE_UART8 "
+.LASF1469:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF684:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF958:
+	.string	"PG_IMU_CONFIG 22"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF1069:
+	.string	"IOCFG_OUT_PP 0"
+.LASF715:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF986:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF453:
+	.string	"U_ID_0 0"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF716:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1012:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1017:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF880:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF397:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF895:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF593:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF383:
+	.string	"unix 1"
+.LASF756:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1498:
+	.string	"float"
+.LASF1477:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1403:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF687:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF415:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1225:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF379:
+	.string	"__linux__ 1"
+.LASF582:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF691:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1464:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF688:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF911:
+	.string	"__bool_true_false_are_defined 1"
+.LASF742:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF583:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1107:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF942:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF429:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF414:
+	.string	"USE_SERIALRX_SUMH "
+.LASF833:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1389:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF899:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1170:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF613:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1307:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"TELEMETRY_HOTT"
+.LASF718:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF477:
+	.string	"USE_UART4 "
+.LASF550:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF461:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1039:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1364:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF543:
+	.string	"__USE_LARGEFILE64"
+.LASF1057:
+	.string	"LED1_TOGGLE NOOP"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF1182:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF491:
+	.string	"USE_PWM"
+.LASF886:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF1236:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF914:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF378:
+	.string	"__linux 1"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1063:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1449:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1433:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF678:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1319:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF747:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1087:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF802:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1110:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1158:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF566:
+	.string	"_POSIX_C_SOURCE"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF741:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1445:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF818:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1184:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF478:
+	.string	"USE_UART5 "
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF647:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF996:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF507:
+	.string	"TELEMETRY_IBUS"
+.LASF506:
+	.string	"TELEMETRY_CRSF"
+.LASF1010:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1044:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1410:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1547:
+	.string	"io_types.h"
+.LASF1530:
+	.string	"long-double.h"
+.LASF1521:
+	.string	"platform.h"
+.LASF1550:
+	.string	"vtx_common.h"
+.LASF1505:
+	.string	"src/main/drivers"
+.LASF1546:
+	.string	"light_led.h"
+.LASF1524:
+	.string	"libc-header-start.h"
+.LASF1513:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1507:
+	.string	"src/main/io"
+.LASF1567:
+	.string	"osd.h"
+.LASF1536:
+	.string	"stdint-intn.h"
+.LASF1518:
+	.string	"target.h"
+.LASF1522:
+	.string	"common_fc_pre.h"
+.LASF1512:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1515:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1531:
+	.string	"stubs.h"
+.LASF1569:
+	.string	"rc_modes.h"
+.LASF1543:
+	.string	"build_config.h"
+.LASF1508:
+	.string	"src/main/target/SITL"
+.LASF1566:
+	.string	"beeper.h"
+.LASF1528:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1560:
+	.string	"io_def_generated.h"
+.LASF1511:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1551:
+	.string	"config.h"
+.LASF1561:
+	.string	"bus_i2c.h"
+.LASF1526:
+	.string	"features-time64.h"
+.LASF1564:
+	.string	"vcd.h"
+.LASF1563:
+	.string	"sound_beeper.h"
+.LASF1516:
+	.string	"types.h"
+.LASF1533:
+	.string	"typesizes.h"
+.LASF1545:
+	.string	"buttons.h"
+.LASF1565:
+	.string	"runtime_config.h"
+.LASF1541:
+	.string	"stdbool.h"
+.LASF1514:
+	.string	"/usr/include"
+.LASF1519:
+	.string	"vtx_control.c"
+.LASF1502:
+	.string	"src/main/build"
+.LASF1562:
+	.string	"rcc_types.h"
+.LASF1525:
+	.string	"features.h"
+.LASF1538:
+	.string	"common_fc_post.h"
+.LASF1568:
+	.string	"vtx_control.h"
+.LASF1503:
+	.string	"src/main/common"
+.LASF1556:
+	.string	"serial.h"
+.LASF1504:
+	.string	"src/main/config"
+.LASF1553:
+	.string	"flash.h"
+.LASF1534:
+	.string	"time64.h"
+.LASF1517:
+	.string	"stdint-uintn.h"
+.LASF1509:
+	.string	"src/main/target"
+.LASF1548:
+	.string	"utils.h"
+.LASF1555:
+	.string	"sdcard.h"
+.LASF1554:
+	.string	"rx_pwm.h"
+.LASF0:
+	.string	"./src/main/io/vtx_control.c"
+.LASF1510:
+	.string	"src/main"
+.LASF1549:
+	.string	"time.h"
+.LASF1544:
+	.string	"parameter_group_ids.h"
+.LASF1535:
+	.string	"wchar.h"
+.LASF1559:
+	.string	"io_def.h"
+.LASF1506:
+	.string	"src/main/fc"
+.LASF1557:
+	.string	"io.h"
+.LASF1539:
+	.string	"maths.h"
+.LASF1529:
+	.string	"cdefs.h"
+.LASF1523:
+	.string	"stdint.h"
+.LASF1540:
+	.string	"config_eeprom.h"
+.LASF1537:
+	.string	"stddef.h"
+.LASF1532:
+	.string	"stubs-64.h"
+.LASF1527:
+	.string	"wordsize.h"
+.LASF1552:
+	.string	"adc.h"
+.LASF1542:
+	.string	"parameter_group.h"
+.LASF1558:
+	.string	"resource.h"
+.LASF1520:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.8910fe43c50f98b4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8910fe43c50f98b4,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\375\007"
+	.string	"d\016w"
+	.string	""
+	.string	""
+	.string	"\204"
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	"\006\023\001\004\006\025\001 \b\022"
+	.string	"5\200\302\027"
+	.string	"\276"
+	.string	""
+	.string	"7\f\006(\001\017\006(\001"
+	.string	"\bO"
+	.string	"\004\002\310\235\363\346\t\017\300\200\200\304\200\300\204\t"
+	.string	"\275\001\274\001"
+	.string	"\302\001(\277\001\301\001\300\001\004\002\267\340\255\021+\330\220\200\370\361\206\346\2412\242\243\204\200\220\201\001\303\001\273\001\277\001"
+	.string	"\273\001"
+	.string	"7y"
+	.string	"\017SystemCoreClock\033./src/main/io/vtx_control.c\bGNU C99"
+	.string	"\027.f7ddae47"
+	.string	"\buint32_t\013/root/repo"
+	.string	" target/SITL.h"
+	.string	"\b"
+	.ascii	"\257\354Q\005\343\265\316\003\302\251;[\331&\312\b\\3\266\226"
+	.ascii	"1"
+	.text
+	.section	.gnu.lto_.symtab.8910fe43c50f98b4,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8910fe43c50f98b4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,21378 @@
+	.file	"dyad.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/unistd.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/socket.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/sockaddr.h"
+	.file 7 "/usr/include/netinet/in.h"
+	.file 8 "/usr/include/netdb.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 12 "<built-in>"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 15 "/usr/include/stdio.h"
+	.file 16 "/usr/include/signal.h"
+	.file 17 "lib/main/dyad/dyad.h"
+	.file 18 "lib/main/dyad/dyad.c"
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/socket.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/time.h"
+	.file 21 "/usr/include/fcntl.h"
+	.file 22 "/usr/include/string.h"
+	.file 23 "/usr/include/arpa/inet.h"
+	.file 24 "/usr/include/stdlib.h"
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/socket_type.h"
+	.file 27 "/usr/include/errno.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	dyad.c.a4e88998
+	.weak	dyad.c.a4e88998
+dyad.c.a4e88998:
+	.long	0x19d5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF2635
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2323
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2324
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2325
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2326
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2327
+	.uleb128 0x8
+	.long	.LASF2329
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2328
+	.uleb128 0x8
+	.long	.LASF2330
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	.LASF2331
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2332
+	.uleb128 0x8
+	.long	.LASF2333
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x8
+	.long	.LASF2334
+	.byte	0x1
+	.byte	0x99
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x8
+	.long	.LASF2335
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x8
+	.long	.LASF2336
+	.byte	0x1
+	.byte	0xa2
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x15
+	.long	0xae
+	.uleb128 0x8
+	.long	.LASF2337
+	.byte	0x1
+	.byte	0xc2
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x9
+	.long	0xcb
+	.uleb128 0x15
+	.long	0xc1
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2338
+	.uleb128 0x20
+	.long	0xcb
+	.uleb128 0x8
+	.long	.LASF2339
+	.byte	0x1
+	.byte	0xd2
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.long	.LASF2340
+	.byte	0x2
+	.byte	0xdc
+	.byte	0x13
+	.long	0xb5
+	.uleb128 0x8
+	.long	.LASF2341
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x9
+	.long	0xc1
+	.uleb128 0x8
+	.long	.LASF2342
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x8
+	.long	.LASF2343
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x8
+	.long	.LASF2344
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2345
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2346
+	.uleb128 0x8
+	.long	.LASF2347
+	.byte	0x5
+	.byte	0x21
+	.byte	0x15
+	.long	0xd7
+	.uleb128 0x31
+	.long	.LASF2636
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x1a
+	.byte	0x18
+	.byte	0x6
+	.long	0x18b
+	.uleb128 0x3
+	.long	.LASF2348
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2349
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2350
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2353
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2354
+	.byte	0xa
+	.uleb128 0x32
+	.long	.LASF2355
+	.long	0x80000
+	.uleb128 0x21
+	.long	.LASF2356
+	.value	0x800
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2357
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x17
+	.long	.LASF2360
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb7
+	.long	0x1be
+	.uleb128 0x4
+	.long	.LASF2358
+	.byte	0x5
+	.byte	0xb9
+	.byte	0x11
+	.long	0x18b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2359
+	.byte	0x5
+	.byte	0xba
+	.byte	0xa
+	.long	0x1c3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x20
+	.long	0x197
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x1d3
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xd
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2361
+	.byte	0x80
+	.byte	0x5
+	.byte	0xc4
+	.long	0x207
+	.uleb128 0x4
+	.long	.LASF2362
+	.byte	0x5
+	.byte	0xc6
+	.byte	0x11
+	.long	0x18b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2363
+	.byte	0x5
+	.byte	0xc7
+	.byte	0xa
+	.long	0x207
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2364
+	.byte	0x5
+	.byte	0xc8
+	.byte	0x17
+	.long	0x37
+	.byte	0x78
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x217
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x75
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2365
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x12
+	.long	0x118
+	.uleb128 0x17
+	.long	.LASF2366
+	.byte	0x4
+	.byte	0x7
+	.byte	0x1f
+	.long	0x23d
+	.uleb128 0x4
+	.long	.LASF2367
+	.byte	0x7
+	.byte	0x21
+	.byte	0xf
+	.long	0x217
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x30
+	.byte	0x7
+	.byte	0x29
+	.byte	0x3
+	.long	0x2f4
+	.uleb128 0x3
+	.long	.LASF2368
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2369
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2370
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2371
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2372
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2373
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2374
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2375
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF2376
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF2377
+	.byte	0x1d
+	.uleb128 0x3
+	.long	.LASF2378
+	.byte	0x21
+	.uleb128 0x3
+	.long	.LASF2379
+	.byte	0x29
+	.uleb128 0x3
+	.long	.LASF2380
+	.byte	0x2e
+	.uleb128 0x3
+	.long	.LASF2381
+	.byte	0x2f
+	.uleb128 0x3
+	.long	.LASF2382
+	.byte	0x32
+	.uleb128 0x3
+	.long	.LASF2383
+	.byte	0x33
+	.uleb128 0x3
+	.long	.LASF2384
+	.byte	0x5c
+	.uleb128 0x3
+	.long	.LASF2385
+	.byte	0x5e
+	.uleb128 0x3
+	.long	.LASF2386
+	.byte	0x62
+	.uleb128 0x3
+	.long	.LASF2387
+	.byte	0x67
+	.uleb128 0x3
+	.long	.LASF2388
+	.byte	0x6c
+	.uleb128 0x3
+	.long	.LASF2389
+	.byte	0x84
+	.uleb128 0x3
+	.long	.LASF2390
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF2391
+	.byte	0x89
+	.uleb128 0x3
+	.long	.LASF2392
+	.byte	0x8f
+	.uleb128 0x3
+	.long	.LASF2393
+	.byte	0xff
+	.uleb128 0x21
+	.long	.LASF2394
+	.value	0x106
+	.uleb128 0x21
+	.long	.LASF2395
+	.value	0x107
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2396
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x12
+	.long	0x10c
+	.uleb128 0x33
+	.byte	0x10
+	.byte	0x7
+	.byte	0xdd
+	.byte	0x5
+	.long	0x32b
+	.uleb128 0x22
+	.long	.LASF2397
+	.byte	0xdf
+	.byte	0xa
+	.long	0x32b
+	.uleb128 0x22
+	.long	.LASF2398
+	.byte	0xe0
+	.byte	0xb
+	.long	0x33b
+	.uleb128 0x22
+	.long	.LASF2399
+	.byte	0xe1
+	.byte	0xb
+	.long	0x34b
+	.byte	0
+	.uleb128 0xa
+	.long	0x100
+	.long	0x33b
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0x10c
+	.long	0x34b
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x118
+	.long	0x35b
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2400
+	.byte	0x10
+	.byte	0x7
+	.byte	0xdb
+	.long	0x375
+	.uleb128 0x4
+	.long	.LASF2401
+	.byte	0x7
+	.byte	0xe2
+	.byte	0x9
+	.long	0x300
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2402
+	.byte	0x10
+	.byte	0x7
+	.byte	0xf5
+	.long	0x3b6
+	.uleb128 0x4
+	.long	.LASF2403
+	.byte	0x7
+	.byte	0xf7
+	.byte	0x11
+	.long	0x18b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2404
+	.byte	0x7
+	.byte	0xf8
+	.byte	0xf
+	.long	0x2f4
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2405
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x14
+	.long	0x223
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2406
+	.byte	0x7
+	.byte	0xfc
+	.byte	0x13
+	.long	0x3b6
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x22
+	.long	0x3c6
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2407
+	.byte	0x1c
+	.byte	0x7
+	.value	0x104
+	.long	0x41a
+	.uleb128 0x5
+	.long	.LASF2408
+	.byte	0x7
+	.value	0x106
+	.byte	0x11
+	.long	0x18b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2409
+	.byte	0x7
+	.value	0x107
+	.byte	0xf
+	.long	0x2f4
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF2410
+	.byte	0x7
+	.value	0x108
+	.byte	0xe
+	.long	0x118
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF2411
+	.byte	0x7
+	.value	0x109
+	.byte	0x15
+	.long	0x35b
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2412
+	.byte	0x7
+	.value	0x10a
+	.byte	0xe
+	.long	0x118
+	.byte	0x18
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2413
+	.byte	0x30
+	.byte	0x8
+	.value	0x235
+	.long	0x498
+	.uleb128 0x5
+	.long	.LASF2414
+	.byte	0x8
+	.value	0x237
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2415
+	.byte	0x8
+	.value	0x238
+	.byte	0x7
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF2416
+	.byte	0x8
+	.value	0x239
+	.byte	0x7
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2417
+	.byte	0x8
+	.value	0x23a
+	.byte	0x7
+	.long	0x64
+	.byte	0xc
+	.uleb128 0x5
+	.long	.LASF2418
+	.byte	0x8
+	.value	0x23b
+	.byte	0xd
+	.long	0x132
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF2419
+	.byte	0x8
+	.value	0x23c
+	.byte	0x14
+	.long	0x49d
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF2420
+	.byte	0x8
+	.value	0x23d
+	.byte	0x9
+	.long	0xc1
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF2421
+	.byte	0x8
+	.value	0x23e
+	.byte	0x14
+	.long	0x4a7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x20
+	.long	0x41a
+	.uleb128 0x9
+	.long	0x197
+	.uleb128 0x15
+	.long	0x49d
+	.uleb128 0x9
+	.long	0x41a
+	.uleb128 0x17
+	.long	.LASF2422
+	.byte	0x10
+	.byte	0x9
+	.byte	0x8
+	.long	0x4d3
+	.uleb128 0x4
+	.long	.LASF2423
+	.byte	0x9
+	.byte	0xe
+	.byte	0xc
+	.long	0x96
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2424
+	.byte	0x9
+	.byte	0xf
+	.byte	0x11
+	.long	0xa2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2425
+	.byte	0xa
+	.byte	0x31
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x24
+	.byte	0x80
+	.byte	0xa
+	.byte	0x3b
+	.long	0x4f5
+	.uleb128 0x4
+	.long	.LASF2426
+	.byte	0xa
+	.byte	0x43
+	.byte	0xf
+	.long	0x4f5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x4d3
+	.long	0x505
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2427
+	.byte	0xa
+	.byte	0x46
+	.byte	0x5
+	.long	0x4df
+	.uleb128 0x8
+	.long	.LASF2428
+	.byte	0xb
+	.byte	0x28
+	.byte	0x1b
+	.long	0x51d
+	.uleb128 0x34
+	.long	.LASF2637
+	.long	0x526
+	.uleb128 0xa
+	.long	0x536
+	.long	0x536
+	.uleb128 0xb
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2638
+	.byte	0x18
+	.byte	0xc
+	.byte	0
+	.long	0x56b
+	.uleb128 0x1b
+	.long	.LASF2429
+	.long	0x30
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2430
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x1b
+	.long	.LASF2431
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x1b
+	.long	.LASF2432
+	.long	0xae
+	.byte	0x10
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2433
+	.byte	0xd8
+	.byte	0xd
+	.byte	0x31
+	.long	0x6f1
+	.uleb128 0x4
+	.long	.LASF2434
+	.byte	0xd
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2435
+	.byte	0xd
+	.byte	0x36
+	.byte	0x9
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF2436
+	.byte	0xd
+	.byte	0x37
+	.byte	0x9
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF2437
+	.byte	0xd
+	.byte	0x38
+	.byte	0x9
+	.long	0xc1
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF2438
+	.byte	0xd
+	.byte	0x39
+	.byte	0x9
+	.long	0xc1
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF2439
+	.byte	0xd
+	.byte	0x3a
+	.byte	0x9
+	.long	0xc1
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF2440
+	.byte	0xd
+	.byte	0x3b
+	.byte	0x9
+	.long	0xc1
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF2441
+	.byte	0xd
+	.byte	0x3c
+	.byte	0x9
+	.long	0xc1
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF2442
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x9
+	.long	0xc1
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF2443
+	.byte	0xd
+	.byte	0x40
+	.byte	0x9
+	.long	0xc1
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF2444
+	.byte	0xd
+	.byte	0x41
+	.byte	0x9
+	.long	0xc1
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF2445
+	.byte	0xd
+	.byte	0x42
+	.byte	0x9
+	.long	0xc1
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF2446
+	.byte	0xd
+	.byte	0x44
+	.byte	0x16
+	.long	0x70a
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF2447
+	.byte	0xd
+	.byte	0x46
+	.byte	0x14
+	.long	0x70f
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF2448
+	.byte	0xd
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF2449
+	.byte	0xd
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF2450
+	.byte	0xd
+	.byte	0x4a
+	.byte	0xb
+	.long	0x7e
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF2451
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x12
+	.long	0x29
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF2452
+	.byte	0xd
+	.byte	0x4e
+	.byte	0xf
+	.long	0x3e
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF2453
+	.byte	0xd
+	.byte	0x4f
+	.byte	0x8
+	.long	0x714
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF2454
+	.byte	0xd
+	.byte	0x51
+	.byte	0xf
+	.long	0x724
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF2455
+	.byte	0xd
+	.byte	0x59
+	.byte	0xd
+	.long	0x8a
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF2456
+	.byte	0xd
+	.byte	0x5b
+	.byte	0x17
+	.long	0x72e
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF2457
+	.byte	0xd
+	.byte	0x5c
+	.byte	0x19
+	.long	0x738
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF2458
+	.byte	0xd
+	.byte	0x5d
+	.byte	0x14
+	.long	0x70f
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF2459
+	.byte	0xd
+	.byte	0x5e
+	.byte	0x9
+	.long	0xae
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF2460
+	.byte	0xd
+	.byte	0x5f
+	.byte	0xa
+	.long	0xef
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF2461
+	.byte	0xd
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF2462
+	.byte	0xd
+	.byte	0x62
+	.byte	0x8
+	.long	0x73d
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2463
+	.byte	0xe
+	.byte	0x7
+	.byte	0x19
+	.long	0x56b
+	.uleb128 0x36
+	.long	.LASF2639
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x25
+	.long	.LASF2464
+	.uleb128 0x9
+	.long	0x705
+	.uleb128 0x9
+	.long	0x56b
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x724
+	.uleb128 0xb
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x6fd
+	.uleb128 0x25
+	.long	.LASF2465
+	.uleb128 0x9
+	.long	0x729
+	.uleb128 0x25
+	.long	.LASF2466
+	.uleb128 0x9
+	.long	0x733
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x74d
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2467
+	.byte	0xf
+	.byte	0x34
+	.byte	0x18
+	.long	0x511
+	.uleb128 0x9
+	.long	0x6f1
+	.uleb128 0x9
+	.long	0x768
+	.uleb128 0x15
+	.long	0x75e
+	.uleb128 0x37
+	.uleb128 0x9
+	.long	0xd2
+	.uleb128 0x15
+	.long	0x769
+	.uleb128 0x8
+	.long	.LASF2468
+	.byte	0x10
+	.byte	0x48
+	.byte	0x10
+	.long	0x77f
+	.uleb128 0x9
+	.long	0x784
+	.uleb128 0x26
+	.long	0x78f
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2469
+	.byte	0x11
+	.byte	0x19
+	.byte	0xd
+	.long	0x64
+	.uleb128 0x8
+	.long	.LASF2470
+	.byte	0x11
+	.byte	0x1d
+	.byte	0x1c
+	.long	0x7a7
+	.uleb128 0x23
+	.long	.LASF2470
+	.byte	0x70
+	.byte	0x12
+	.value	0x117
+	.long	0x86b
+	.uleb128 0x5
+	.long	.LASF2471
+	.byte	0x12
+	.value	0x118
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2472
+	.byte	0x12
+	.value	0x118
+	.byte	0xe
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF2473
+	.byte	0x12
+	.value	0x119
+	.byte	0xf
+	.long	0x78f
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2474
+	.byte	0x12
+	.value	0x11a
+	.byte	0x9
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF2475
+	.byte	0x12
+	.value	0x11b
+	.byte	0x7
+	.long	0x64
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF2476
+	.byte	0x12
+	.value	0x11c
+	.byte	0x7
+	.long	0x64
+	.byte	0x1c
+	.uleb128 0x5
+	.long	.LASF2477
+	.byte	0x12
+	.value	0x11c
+	.byte	0x12
+	.long	0x64
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF2478
+	.byte	0x12
+	.value	0x11d
+	.byte	0xa
+	.long	0xafa
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF2479
+	.byte	0x12
+	.value	0x11d
+	.byte	0x18
+	.long	0xafa
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF2480
+	.byte	0x12
+	.value	0x11e
+	.byte	0x34
+	.long	0xa59
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF2481
+	.byte	0x12
+	.value	0x11f
+	.byte	0x30
+	.long	0xa92
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF2482
+	.byte	0x12
+	.value	0x120
+	.byte	0x30
+	.long	0xac6
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF2483
+	.byte	0x12
+	.value	0x121
+	.byte	0x10
+	.long	0x8cf
+	.byte	0x68
+	.byte	0
+	.uleb128 0x24
+	.byte	0x38
+	.byte	0x11
+	.byte	0x1f
+	.long	0x8cf
+	.uleb128 0x4
+	.long	.LASF2484
+	.byte	0x11
+	.byte	0x20
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2485
+	.byte	0x11
+	.byte	0x21
+	.byte	0x9
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF2486
+	.byte	0x11
+	.byte	0x22
+	.byte	0x10
+	.long	0x8cf
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF2487
+	.byte	0x11
+	.byte	0x23
+	.byte	0x10
+	.long	0x8cf
+	.byte	0x18
+	.uleb128 0x28
+	.string	"msg"
+	.byte	0x11
+	.byte	0x24
+	.byte	0xf
+	.long	0x769
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF2488
+	.byte	0x11
+	.byte	0x25
+	.byte	0x9
+	.long	0xc1
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF2489
+	.byte	0x11
+	.byte	0x26
+	.byte	0x7
+	.long	0x64
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.long	0x79b
+	.uleb128 0x8
+	.long	.LASF2490
+	.byte	0x11
+	.byte	0x27
+	.byte	0x3
+	.long	0x86b
+	.uleb128 0x8
+	.long	.LASF2491
+	.byte	0x11
+	.byte	0x29
+	.byte	0x10
+	.long	0x8ec
+	.uleb128 0x9
+	.long	0x8f1
+	.uleb128 0x26
+	.long	0x8fc
+	.uleb128 0x1
+	.long	0x8fc
+	.byte	0
+	.uleb128 0x9
+	.long	0x8d4
+	.uleb128 0x8
+	.long	.LASF2492
+	.byte	0x11
+	.byte	0x2a
+	.byte	0x10
+	.long	0x90d
+	.uleb128 0x9
+	.long	0x912
+	.uleb128 0x26
+	.long	0x91d
+	.uleb128 0x1
+	.long	0x769
+	.byte	0
+	.uleb128 0x1a
+	.long	0x30
+	.byte	0x11
+	.byte	0x2c
+	.byte	0x6
+	.long	0x972
+	.uleb128 0x3
+	.long	.LASF2493
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2494
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2495
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2496
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF2497
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2499
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2500
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF2501
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2502
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF2503
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF2504
+	.byte	0xb
+	.byte	0
+	.uleb128 0x1a
+	.long	0x30
+	.byte	0x11
+	.byte	0x3b
+	.byte	0x6
+	.long	0x99d
+	.uleb128 0x3
+	.long	.LASF2505
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2506
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2507
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2508
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF2509
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1a
+	.long	0x30
+	.byte	0x12
+	.byte	0xae
+	.byte	0x6
+	.long	0x9c2
+	.uleb128 0x3
+	.long	.LASF2510
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2511
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2512
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2513
+	.byte	0x3
+	.byte	0
+	.uleb128 0x24
+	.byte	0x20
+	.byte	0x12
+	.byte	0xb5
+	.long	0x9f2
+	.uleb128 0x4
+	.long	.LASF2514
+	.byte	0x12
+	.byte	0xb6
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2515
+	.byte	0x12
+	.byte	0xb7
+	.byte	0xf
+	.long	0x78f
+	.byte	0x4
+	.uleb128 0x28
+	.string	"fds"
+	.byte	0x12
+	.byte	0xb8
+	.byte	0xb
+	.long	0x9f2
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0xa02
+	.long	0xa02
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x505
+	.uleb128 0x15
+	.long	0xa02
+	.uleb128 0x8
+	.long	.LASF2516
+	.byte	0x12
+	.byte	0xb9
+	.byte	0x3
+	.long	0x9c2
+	.uleb128 0x1c
+	.byte	0x18
+	.value	0x110
+	.byte	0x9
+	.long	0xa4c
+	.uleb128 0x5
+	.long	.LASF2517
+	.byte	0x12
+	.value	0x111
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2518
+	.byte	0x12
+	.value	0x112
+	.byte	0x11
+	.long	0x8e0
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2485
+	.byte	0x12
+	.value	0x113
+	.byte	0x9
+	.long	0xae
+	.byte	0x10
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF2519
+	.byte	0x12
+	.value	0x114
+	.byte	0x3
+	.long	0xa18
+	.uleb128 0x1c
+	.byte	0x10
+	.value	0x11e
+	.byte	0x3
+	.long	0xa8d
+	.uleb128 0x5
+	.long	.LASF2488
+	.byte	0x12
+	.value	0x11e
+	.byte	0x16
+	.long	0xa8d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2520
+	.byte	0x12
+	.value	0x11e
+	.byte	0x20
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2514
+	.byte	0x12
+	.value	0x11e
+	.byte	0x28
+	.long	0x64
+	.byte	0xc
+	.byte	0
+	.uleb128 0x9
+	.long	0xa4c
+	.uleb128 0x1c
+	.byte	0x10
+	.value	0x11f
+	.byte	0x3
+	.long	0xac6
+	.uleb128 0x5
+	.long	.LASF2488
+	.byte	0x12
+	.value	0x11f
+	.byte	0x12
+	.long	0xc1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2520
+	.byte	0x12
+	.value	0x11f
+	.byte	0x1c
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2514
+	.byte	0x12
+	.value	0x11f
+	.byte	0x24
+	.long	0x64
+	.byte	0xc
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x10
+	.value	0x120
+	.byte	0x3
+	.long	0xafa
+	.uleb128 0x5
+	.long	.LASF2488
+	.byte	0x12
+	.value	0x120
+	.byte	0x12
+	.long	0xc1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2520
+	.byte	0x12
+	.value	0x120
+	.byte	0x1c
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2514
+	.byte	0x12
+	.value	0x120
+	.byte	0x24
+	.long	0x64
+	.byte	0xc
+	.byte	0
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2521
+	.uleb128 0x7
+	.long	.LASF2522
+	.value	0x128
+	.byte	0x15
+	.long	0x8cf
+	.uleb128 0x7
+	.long	.LASF2523
+	.value	0x129
+	.byte	0xc
+	.long	0x64
+	.uleb128 0xa
+	.long	0xcb
+	.long	0xb29
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2524
+	.value	0x12a
+	.byte	0xd
+	.long	0xb19
+	.uleb128 0x7
+	.long	.LASF2525
+	.value	0x12b
+	.byte	0x1b
+	.long	0x901
+	.uleb128 0x7
+	.long	.LASF2526
+	.value	0x12c
+	.byte	0x12
+	.long	0xa0c
+	.uleb128 0x7
+	.long	.LASF2527
+	.value	0x12d
+	.byte	0xf
+	.long	0xafa
+	.uleb128 0x7
+	.long	.LASF2528
+	.value	0x12e
+	.byte	0xf
+	.long	0xafa
+	.uleb128 0x7
+	.long	.LASF2529
+	.value	0x12f
+	.byte	0xf
+	.long	0xafa
+	.uleb128 0x13
+	.long	.LASF2530
+	.byte	0xf
+	.value	0x201
+	.byte	0xc
+	.long	0x64
+	.long	0xb88
+	.uleb128 0x1
+	.long	0x759
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2531
+	.byte	0x13
+	.byte	0x7e
+	.byte	0xc
+	.long	0x64
+	.long	0xba8
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xba8
+	.uleb128 0x1
+	.long	0x132
+	.byte	0
+	.uleb128 0x9
+	.long	0x1be
+	.uleb128 0xc
+	.long	.LASF2532
+	.byte	0x13
+	.byte	0x66
+	.byte	0xc
+	.long	0x64
+	.long	0xbcd
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2553
+	.byte	0x8
+	.value	0x29a
+	.long	0xbdf
+	.uleb128 0x1
+	.long	0x4a7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2533
+	.byte	0x13
+	.value	0x128
+	.byte	0xc
+	.long	0x64
+	.long	0xbfb
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2534
+	.byte	0x13
+	.byte	0x70
+	.byte	0xc
+	.long	0x64
+	.long	0xc1b
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xba8
+	.uleb128 0x1
+	.long	0x132
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2535
+	.byte	0x13
+	.value	0x115
+	.byte	0xc
+	.long	0x64
+	.long	0xc46
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x75e
+	.uleb128 0x1
+	.long	0x132
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2536
+	.byte	0x8
+	.value	0x294
+	.byte	0xc
+	.long	0x64
+	.long	0xc6c
+	.uleb128 0x1
+	.long	0x76e
+	.uleb128 0x1
+	.long	0x76e
+	.uleb128 0x1
+	.long	0xc71
+	.uleb128 0x1
+	.long	0xc7b
+	.byte	0
+	.uleb128 0x9
+	.long	0x498
+	.uleb128 0x15
+	.long	0xc6c
+	.uleb128 0x9
+	.long	0x4a7
+	.uleb128 0x15
+	.long	0xc76
+	.uleb128 0xc
+	.long	.LASF2537
+	.byte	0x14
+	.byte	0x43
+	.byte	0xc
+	.long	0x64
+	.long	0xc9b
+	.uleb128 0x1
+	.long	0xca0
+	.uleb128 0x1
+	.long	0xb0
+	.byte	0
+	.uleb128 0x9
+	.long	0x4ac
+	.uleb128 0x15
+	.long	0xc9b
+	.uleb128 0x39
+	.long	.LASF2640
+	.byte	0x10
+	.byte	0x5d
+	.byte	0x17
+	.long	.LASF2641
+	.long	0x773
+	.long	0xcc4
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x773
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2538
+	.byte	0x13
+	.byte	0x8a
+	.byte	0x10
+	.long	0xe3
+	.long	0xce9
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x75e
+	.uleb128 0x1
+	.long	0xef
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2539
+	.byte	0x15
+	.byte	0x95
+	.byte	0xc
+	.long	0x64
+	.long	0xd05
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2540
+	.byte	0x13
+	.value	0x132
+	.byte	0xc
+	.long	0x64
+	.long	0xd26
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4a2
+	.uleb128 0x1
+	.long	0xd2b
+	.byte	0
+	.uleb128 0x9
+	.long	0x132
+	.uleb128 0x15
+	.long	0xd26
+	.uleb128 0x13
+	.long	.LASF2541
+	.byte	0xf
+	.value	0x166
+	.byte	0xc
+	.long	0x64
+	.long	0xd4d
+	.uleb128 0x1
+	.long	0xc1
+	.uleb128 0x1
+	.long	0x769
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2542
+	.byte	0x16
+	.value	0x1a3
+	.byte	0xe
+	.long	0xc1
+	.long	0xd64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2543
+	.byte	0x17
+	.byte	0x40
+	.byte	0x14
+	.long	0x769
+	.long	0xd89
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x763
+	.uleb128 0x1
+	.long	0xc6
+	.uleb128 0x1
+	.long	0x132
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2544
+	.byte	0x13
+	.byte	0x74
+	.byte	0xc
+	.long	0x64
+	.long	0xda9
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4a2
+	.uleb128 0x1
+	.long	0xd2b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2545
+	.byte	0x13
+	.byte	0x82
+	.byte	0xc
+	.long	0x64
+	.long	0xdc9
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4a2
+	.uleb128 0x1
+	.long	0xd2b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2546
+	.byte	0x16
+	.byte	0x2f
+	.byte	0xe
+	.long	0xae
+	.long	0xde9
+	.uleb128 0x1
+	.long	0xae
+	.uleb128 0x1
+	.long	0x75e
+	.uleb128 0x1
+	.long	0xef
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2642
+	.byte	0x1b
+	.byte	0x25
+	.byte	0xd
+	.long	0xdf5
+	.uleb128 0x9
+	.long	0x64
+	.uleb128 0xc
+	.long	.LASF2547
+	.byte	0x13
+	.byte	0x91
+	.byte	0x10
+	.long	0xe3
+	.long	0xe1f
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xae
+	.uleb128 0x1
+	.long	0xef
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF2548
+	.byte	0x18
+	.value	0x27d
+	.byte	0xd
+	.long	0xe32
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2549
+	.byte	0xf
+	.value	0x164
+	.byte	0xc
+	.long	0x64
+	.long	0xe4a
+	.uleb128 0x1
+	.long	0x769
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2550
+	.byte	0xf
+	.value	0x175
+	.byte	0xc
+	.long	0x64
+	.long	0xe6b
+	.uleb128 0x1
+	.long	0xc1
+	.uleb128 0x1
+	.long	0x769
+	.uleb128 0x1
+	.long	0xe6b
+	.byte	0
+	.uleb128 0x9
+	.long	0x536
+	.uleb128 0x13
+	.long	.LASF2551
+	.byte	0x18
+	.value	0x234
+	.byte	0xe
+	.long	0xae
+	.long	0xe8c
+	.uleb128 0x1
+	.long	0xae
+	.uleb128 0x1
+	.long	0xef
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2552
+	.byte	0x16
+	.byte	0x3d
+	.byte	0xe
+	.long	0xae
+	.long	0xeac
+	.uleb128 0x1
+	.long	0xae
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xef
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2554
+	.byte	0x18
+	.value	0x238
+	.long	0xebe
+	.uleb128 0x1
+	.long	0xae
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2555
+	.byte	0x2
+	.value	0x166
+	.byte	0xc
+	.long	0x64
+	.long	0xed5
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2556
+	.byte	0x13
+	.byte	0xff
+	.byte	0xc
+	.long	0x64
+	.long	0xeff
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0xd2b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2557
+	.byte	0xa
+	.byte	0x66
+	.byte	0xc
+	.long	0x64
+	.long	0xf29
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xa07
+	.uleb128 0x1
+	.long	0xa07
+	.uleb128 0x1
+	.long	0xa07
+	.uleb128 0x1
+	.long	0xca0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2558
+	.value	0x482
+	.byte	0xd
+	.long	0x78f
+	.long	0xf46
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x482
+	.byte	0x29
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2559
+	.value	0x47d
+	.byte	0x5
+	.long	0x64
+	.long	0xf63
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x47d
+	.byte	0x28
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2560
+	.value	0x478
+	.byte	0x5
+	.long	0x64
+	.long	0xf80
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x478
+	.byte	0x24
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2561
+	.value	0x473
+	.byte	0x5
+	.long	0x64
+	.long	0xf9d
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x473
+	.byte	0x1f
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2562
+	.value	0x46e
+	.byte	0xd
+	.long	0x769
+	.long	0xfba
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x46e
+	.byte	0x2a
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2563
+	.value	0x469
+	.byte	0x5
+	.long	0x64
+	.long	0xfd7
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x469
+	.byte	0x20
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2564
+	.value	0x463
+	.long	0xffb
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x463
+	.byte	0x23
+	.long	0x8cf
+	.uleb128 0x16
+	.string	"opt"
+	.value	0x463
+	.byte	0x2f
+	.long	0x64
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2565
+	.value	0x45e
+	.long	0x101f
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x45e
+	.byte	0x23
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2566
+	.value	0x45e
+	.byte	0x32
+	.long	0xafa
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2567
+	.value	0x456
+	.long	0x1050
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x456
+	.byte	0x1f
+	.long	0x8cf
+	.uleb128 0x16
+	.string	"fmt"
+	.value	0x456
+	.byte	0x33
+	.long	0x769
+	.uleb128 0x19
+	.uleb128 0x7
+	.long	.LASF2568
+	.value	0x457
+	.byte	0xb
+	.long	0x74d
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2569
+	.value	0x418
+	.long	0x10bf
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x418
+	.byte	0x20
+	.long	0x8cf
+	.uleb128 0x16
+	.string	"fmt"
+	.value	0x418
+	.byte	0x34
+	.long	0x769
+	.uleb128 0x2
+	.long	.LASF2568
+	.value	0x418
+	.byte	0x41
+	.long	0xe6b
+	.uleb128 0x6
+	.string	"buf"
+	.value	0x419
+	.byte	0x8
+	.long	0x10bf
+	.uleb128 0x6
+	.string	"str"
+	.value	0x41a
+	.byte	0x9
+	.long	0xc1
+	.uleb128 0x6
+	.string	"f"
+	.value	0x41b
+	.byte	0x8
+	.long	0x10d0
+	.uleb128 0x6
+	.string	"fp"
+	.value	0x41c
+	.byte	0x9
+	.long	0x759
+	.uleb128 0x6
+	.string	"c"
+	.value	0x41d
+	.byte	0x7
+	.long	0x64
+	.uleb128 0x1d
+	.long	.LASF2574
+	.value	0x432
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x10d0
+	.uleb128 0x2a
+	.long	0x37
+	.value	0x1ff
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x10e0
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2570
+	.value	0x40f
+	.long	0x111a
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x40f
+	.byte	0x1e
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2488
+	.value	0x40f
+	.byte	0x32
+	.long	0x75e
+	.uleb128 0x2
+	.long	.LASF2489
+	.value	0x40f
+	.byte	0x3c
+	.long	0x64
+	.uleb128 0x6
+	.string	"p"
+	.value	0x410
+	.byte	0xf
+	.long	0x769
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2571
+	.value	0x3f2
+	.byte	0x5
+	.long	0x64
+	.long	0x1186
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x3f2
+	.byte	0x1f
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2572
+	.value	0x3f2
+	.byte	0x33
+	.long	0x769
+	.uleb128 0x2
+	.long	.LASF2475
+	.value	0x3f2
+	.byte	0x3d
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2573
+	.value	0x3f3
+	.byte	0x13
+	.long	0x41a
+	.uleb128 0x6
+	.string	"ai"
+	.value	0x3f3
+	.byte	0x1b
+	.long	0x4a7
+	.uleb128 0x6
+	.string	"err"
+	.value	0x3f4
+	.byte	0x7
+	.long	0x64
+	.uleb128 0x6
+	.string	"buf"
+	.value	0x3f5
+	.byte	0x8
+	.long	0x1186
+	.uleb128 0x1d
+	.long	.LASF2575
+	.value	0x409
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x1196
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2576
+	.value	0x3ed
+	.byte	0x5
+	.long	0x64
+	.long	0x11bf
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x3ed
+	.byte	0x1e
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2475
+	.value	0x3ed
+	.byte	0x2a
+	.long	0x64
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2577
+	.value	0x3b7
+	.byte	0x5
+	.long	0x64
+	.long	0x124d
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x3b8
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2572
+	.value	0x3b8
+	.byte	0x24
+	.long	0x769
+	.uleb128 0x2
+	.long	.LASF2475
+	.value	0x3b8
+	.byte	0x2e
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF2578
+	.value	0x3b8
+	.byte	0x38
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2573
+	.value	0x3ba
+	.byte	0x13
+	.long	0x41a
+	.uleb128 0x6
+	.string	"ai"
+	.value	0x3ba
+	.byte	0x1b
+	.long	0x4a7
+	.uleb128 0x6
+	.string	"err"
+	.value	0x3bb
+	.byte	0x7
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2579
+	.value	0x3bb
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x6
+	.string	"buf"
+	.value	0x3bc
+	.byte	0x8
+	.long	0x1186
+	.uleb128 0x6
+	.string	"e"
+	.value	0x3bd
+	.byte	0xe
+	.long	0x8d4
+	.uleb128 0x1d
+	.long	.LASF2575
+	.value	0x3e7
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2580
+	.value	0x3ad
+	.long	0x1265
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x3ad
+	.byte	0x1c
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2581
+	.value	0x39a
+	.long	0x1287
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x39a
+	.byte	0x1e
+	.long	0x8cf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x39b
+	.byte	0xe
+	.long	0x8d4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2582
+	.value	0x38c
+	.long	0x12b7
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x38c
+	.byte	0x2b
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2517
+	.value	0x38c
+	.byte	0x37
+	.long	0x64
+	.uleb128 0xf
+	.uleb128 0x6
+	.string	"i"
+	.value	0x390
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2583
+	.value	0x37f
+	.long	0x1309
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x380
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2517
+	.value	0x380
+	.byte	0x1c
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF2518
+	.value	0x380
+	.byte	0x31
+	.long	0x8e0
+	.uleb128 0x2
+	.long	.LASF2485
+	.value	0x380
+	.byte	0x41
+	.long	0xae
+	.uleb128 0x6
+	.string	"i"
+	.value	0x382
+	.byte	0x7
+	.long	0x64
+	.uleb128 0xf
+	.uleb128 0x6
+	.string	"x"
+	.value	0x384
+	.byte	0xf
+	.long	0xa8d
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2584
+	.value	0x374
+	.long	0x1351
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x375
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2517
+	.value	0x375
+	.byte	0x1c
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF2518
+	.value	0x375
+	.byte	0x31
+	.long	0x8e0
+	.uleb128 0x2
+	.long	.LASF2485
+	.value	0x375
+	.byte	0x41
+	.long	0xae
+	.uleb128 0x7
+	.long	.LASF2585
+	.value	0x377
+	.byte	0xc
+	.long	0xa4c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2586
+	.value	0x366
+	.byte	0xe
+	.long	0x8cf
+	.long	0x136e
+	.uleb128 0x7
+	.long	.LASF2486
+	.value	0x367
+	.byte	0x10
+	.long	0x8cf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2587
+	.value	0x35b
+	.byte	0x14
+	.long	0x901
+	.long	0x1397
+	.uleb128 0x2
+	.long	.LASF2588
+	.value	0x35b
+	.byte	0x34
+	.long	0x901
+	.uleb128 0x6
+	.string	"old"
+	.value	0x35c
+	.byte	0x16
+	.long	0x901
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2589
+	.value	0x356
+	.long	0x13af
+	.uleb128 0x2
+	.long	.LASF2566
+	.value	0x356
+	.byte	0x23
+	.long	0xafa
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2590
+	.value	0x351
+	.long	0x13c7
+	.uleb128 0x2
+	.long	.LASF2566
+	.value	0x351
+	.byte	0x22
+	.long	0xafa
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2592
+	.value	0x34c
+	.byte	0x5
+	.long	0x64
+	.uleb128 0xe
+	.long	.LASF2591
+	.value	0x33f
+	.byte	0x8
+	.long	0xafa
+	.long	0x13ef
+	.uleb128 0x6
+	.string	"tv"
+	.value	0x345
+	.byte	0x12
+	.long	0x4ac
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2593
+	.value	0x33a
+	.byte	0xd
+	.long	0x769
+	.uleb128 0x2c
+	.long	.LASF2594
+	.value	0x32c
+	.uleb128 0x2c
+	.long	.LASF2595
+	.value	0x31e
+	.uleb128 0xd
+	.long	.LASF2596
+	.value	0x2a5
+	.long	0x1458
+	.uleb128 0x7
+	.long	.LASF2486
+	.value	0x2a6
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0x6
+	.string	"tv"
+	.value	0x2a7
+	.byte	0x12
+	.long	0x4ac
+	.uleb128 0x1d
+	.long	.LASF2597
+	.value	0x304
+	.byte	0x1
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2579
+	.value	0x2f3
+	.byte	0xf
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2598
+	.value	0x2f4
+	.byte	0x15
+	.long	0x132
+	.uleb128 0x6
+	.string	"e"
+	.value	0x2f5
+	.byte	0x16
+	.long	0x8d4
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2602
+	.value	0x26f
+	.byte	0xc
+	.long	0x64
+	.long	0x1493
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x26f
+	.byte	0x31
+	.long	0x8cf
+	.uleb128 0x3c
+	.long	0x1486
+	.uleb128 0x7
+	.long	.LASF2489
+	.value	0x273
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x28a
+	.byte	0x10
+	.long	0x8d4
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2599
+	.value	0x24e
+	.long	0x14db
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x24e
+	.byte	0x3a
+	.long	0x8cf
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2487
+	.value	0x250
+	.byte	0x12
+	.long	0x8cf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x251
+	.byte	0x10
+	.long	0x8d4
+	.uleb128 0x6
+	.string	"err"
+	.value	0x252
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2473
+	.value	0x253
+	.byte	0x11
+	.long	0x78f
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2600
+	.value	0x206
+	.long	0x1547
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x206
+	.byte	0x34
+	.long	0x8cf
+	.uleb128 0xf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x209
+	.byte	0x10
+	.long	0x8d4
+	.uleb128 0x7
+	.long	.LASF2488
+	.value	0x20a
+	.byte	0xa
+	.long	0x1547
+	.uleb128 0x7
+	.long	.LASF2489
+	.value	0x20b
+	.byte	0x9
+	.long	0x64
+	.uleb128 0xf
+	.uleb128 0x6
+	.string	"i"
+	.value	0x228
+	.byte	0xb
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2601
+	.value	0x228
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x6
+	.string	"buf"
+	.value	0x229
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0xf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x231
+	.byte	0x16
+	.long	0x8d4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x1558
+	.uleb128 0x2a
+	.long	0x37
+	.value	0x1fff
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2603
+	.value	0x1fa
+	.byte	0xc
+	.long	0x64
+	.long	0x1599
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1fa
+	.byte	0x34
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2517
+	.value	0x1fa
+	.byte	0x40
+	.long	0x64
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1fb
+	.byte	0x7
+	.long	0x64
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2585
+	.value	0x1fd
+	.byte	0xf
+	.long	0xa8d
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2604
+	.value	0x1ed
+	.byte	0xc
+	.long	0x64
+	.long	0x15da
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1ee
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2605
+	.value	0x1ee
+	.byte	0x1c
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF2484
+	.value	0x1ee
+	.byte	0x28
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF2606
+	.value	0x1ee
+	.byte	0x32
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2607
+	.value	0x1e6
+	.long	0x15fe
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1e6
+	.byte	0x2b
+	.long	0x8cf
+	.uleb128 0x2
+	.long	.LASF2473
+	.value	0x1e6
+	.byte	0x3f
+	.long	0x78f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2608
+	.value	0x1da
+	.long	0x162e
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1da
+	.byte	0x36
+	.long	0x8cf
+	.uleb128 0x16
+	.string	"opt"
+	.value	0x1da
+	.byte	0x42
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF2472
+	.value	0x1df
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2609
+	.value	0x1c0
+	.long	0x1699
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1c0
+	.byte	0x2d
+	.long	0x8cf
+	.uleb128 0x3d
+	.byte	0x80
+	.byte	0x12
+	.value	0x1c1
+	.byte	0x3
+	.long	0x1680
+	.uleb128 0x27
+	.string	"sa"
+	.value	0x1c1
+	.byte	0x1b
+	.long	0x197
+	.uleb128 0x27
+	.string	"sas"
+	.value	0x1c1
+	.byte	0x37
+	.long	0x1d3
+	.uleb128 0x27
+	.string	"sai"
+	.value	0x1c2
+	.byte	0x1e
+	.long	0x375
+	.uleb128 0x3e
+	.long	.LASF2610
+	.byte	0x12
+	.value	0x1c2
+	.byte	0x37
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2611
+	.value	0x1c2
+	.byte	0x3f
+	.long	0x1645
+	.uleb128 0x7
+	.long	.LASF2489
+	.value	0x1c3
+	.byte	0xd
+	.long	0x132
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2612
+	.value	0x1b2
+	.long	0x16df
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1b2
+	.byte	0x27
+	.long	0x8cf
+	.uleb128 0x16
+	.string	"msg"
+	.value	0x1b2
+	.byte	0x3b
+	.long	0x769
+	.uleb128 0x16
+	.string	"err"
+	.value	0x1b2
+	.byte	0x44
+	.long	0x64
+	.uleb128 0x6
+	.string	"buf"
+	.value	0x1b3
+	.byte	0x8
+	.long	0x16df
+	.uleb128 0x6
+	.string	"e"
+	.value	0x1b4
+	.byte	0xe
+	.long	0x8d4
+	.byte	0
+	.uleb128 0xa
+	.long	0xcb
+	.long	0x16ef
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2613
+	.value	0x1a0
+	.long	0x1729
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x1a0
+	.byte	0x2b
+	.long	0x8cf
+	.uleb128 0x16
+	.string	"e"
+	.value	0x1a0
+	.byte	0x3f
+	.long	0x8fc
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1a1
+	.byte	0x7
+	.long	0x64
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2585
+	.value	0x1a4
+	.byte	0xf
+	.long	0xa8d
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2614
+	.value	0x185
+	.long	0x1757
+	.uleb128 0x2
+	.long	.LASF2486
+	.value	0x185
+	.byte	0x29
+	.long	0x8cf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x186
+	.byte	0xe
+	.long	0x8d4
+	.uleb128 0x7
+	.long	.LASF2483
+	.value	0x187
+	.byte	0x11
+	.long	0x1757
+	.byte	0
+	.uleb128 0x9
+	.long	0x8cf
+	.uleb128 0x10
+	.long	.LASF2615
+	.value	0x16e
+	.long	0x178a
+	.uleb128 0x7
+	.long	.LASF2616
+	.value	0x16f
+	.byte	0xa
+	.long	0xafa
+	.uleb128 0x7
+	.long	.LASF2486
+	.value	0x170
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x171
+	.byte	0xe
+	.long	0x8d4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2617
+	.value	0x15a
+	.long	0x17ae
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2486
+	.value	0x161
+	.byte	0x12
+	.long	0x8cf
+	.uleb128 0x6
+	.string	"e"
+	.value	0x162
+	.byte	0x10
+	.long	0x8d4
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2618
+	.value	0x14a
+	.long	0x17d4
+	.uleb128 0x7
+	.long	.LASF2486
+	.value	0x14b
+	.byte	0x10
+	.long	0x8cf
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2483
+	.value	0x14e
+	.byte	0x14
+	.long	0x8cf
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2619
+	.value	0x140
+	.byte	0x13
+	.long	0x8d4
+	.long	0x17fb
+	.uleb128 0x2
+	.long	.LASF2484
+	.value	0x140
+	.byte	0x23
+	.long	0x64
+	.uleb128 0x6
+	.string	"e"
+	.value	0x141
+	.byte	0xe
+	.long	0x8d4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2620
+	.value	0x132
+	.long	0x1820
+	.uleb128 0x16
+	.string	"fmt"
+	.value	0x132
+	.byte	0x1f
+	.long	0x769
+	.uleb128 0x19
+	.uleb128 0x7
+	.long	.LASF2568
+	.value	0x133
+	.byte	0xb
+	.long	0x74d
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2621
+	.byte	0xf7
+	.byte	0xc
+	.long	0x64
+	.long	0x1858
+	.uleb128 0x11
+	.string	"s"
+	.byte	0xf7
+	.byte	0x22
+	.long	0x1858
+	.uleb128 0x11
+	.string	"set"
+	.byte	0xf7
+	.byte	0x29
+	.long	0x64
+	.uleb128 0x11
+	.string	"fd"
+	.byte	0xf7
+	.byte	0x3a
+	.long	0x78f
+	.uleb128 0x6
+	.string	"p"
+	.value	0x104
+	.byte	0xd
+	.long	0x185d
+	.byte	0
+	.uleb128 0x9
+	.long	0xa0c
+	.uleb128 0x9
+	.long	0x30
+	.uleb128 0x18
+	.long	.LASF2622
+	.byte	0xe2
+	.long	0x1894
+	.uleb128 0x11
+	.string	"s"
+	.byte	0xe2
+	.byte	0x23
+	.long	0x1858
+	.uleb128 0x11
+	.string	"set"
+	.byte	0xe2
+	.byte	0x2a
+	.long	0x64
+	.uleb128 0x11
+	.string	"fd"
+	.byte	0xe2
+	.byte	0x3b
+	.long	0x78f
+	.uleb128 0x1f
+	.string	"p"
+	.byte	0xec
+	.byte	0xd
+	.long	0x185d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2623
+	.byte	0xd4
+	.long	0x18b1
+	.uleb128 0x11
+	.string	"s"
+	.byte	0xd4
+	.byte	0x24
+	.long	0x1858
+	.uleb128 0x1f
+	.string	"i"
+	.byte	0xd5
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2624
+	.byte	0xc8
+	.long	0x18da
+	.uleb128 0x11
+	.string	"s"
+	.byte	0xc8
+	.byte	0x24
+	.long	0x1858
+	.uleb128 0x1f
+	.string	"i"
+	.byte	0xc9
+	.byte	0x7
+	.long	0x64
+	.uleb128 0x3f
+	.long	.LASF2625
+	.byte	0x12
+	.byte	0xca
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2626
+	.byte	0xbe
+	.long	0x18f7
+	.uleb128 0x11
+	.string	"s"
+	.byte	0xbe
+	.byte	0x26
+	.long	0x1858
+	.uleb128 0x1f
+	.string	"i"
+	.byte	0xbf
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2627
+	.byte	0x73
+	.long	0x194a
+	.uleb128 0x14
+	.long	.LASF2488
+	.byte	0x12
+	.byte	0x74
+	.byte	0xa
+	.long	0xfb
+	.uleb128 0x14
+	.long	.LASF2520
+	.byte	0x12
+	.byte	0x74
+	.byte	0x15
+	.long	0xdf5
+	.uleb128 0x14
+	.long	.LASF2514
+	.byte	0x12
+	.byte	0x74
+	.byte	0x22
+	.long	0xdf5
+	.uleb128 0x14
+	.long	.LASF2628
+	.byte	0x12
+	.byte	0x74
+	.byte	0x30
+	.long	0x64
+	.uleb128 0x14
+	.long	.LASF2601
+	.byte	0x12
+	.byte	0x74
+	.byte	0x3b
+	.long	0x64
+	.uleb128 0x14
+	.long	.LASF2629
+	.byte	0x12
+	.byte	0x74
+	.byte	0x46
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2630
+	.byte	0x68
+	.long	0x1985
+	.uleb128 0x14
+	.long	.LASF2488
+	.byte	0x12
+	.byte	0x68
+	.byte	0x1f
+	.long	0xfb
+	.uleb128 0x14
+	.long	.LASF2520
+	.byte	0x12
+	.byte	0x68
+	.byte	0x2a
+	.long	0xdf5
+	.uleb128 0x14
+	.long	.LASF2514
+	.byte	0x12
+	.byte	0x68
+	.byte	0x37
+	.long	0xdf5
+	.uleb128 0x14
+	.long	.LASF2628
+	.byte	0x12
+	.byte	0x68
+	.byte	0x45
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2631
+	.byte	0x5f
+	.long	0x199b
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x5f
+	.byte	0x1d
+	.long	0xae
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2632
+	.byte	0x56
+	.byte	0xe
+	.long	0xae
+	.long	0x19bf
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x56
+	.byte	0x21
+	.long	0xae
+	.uleb128 0x11
+	.string	"n"
+	.byte	0x56
+	.byte	0x2a
+	.long	0x64
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF2633
+	.byte	0x19
+	.byte	0x22
+	.byte	0x1
+	.long	0x58
+	.uleb128 0x14
+	.long	.LASF2634
+	.byte	0x19
+	.byte	0x22
+	.byte	0x18
+	.long	0x58
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 28 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF396
+	.file 29 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 30 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF515
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF533
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0xd9
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF635
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF695
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1040
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1041
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1042
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1043
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1044
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1045
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1054
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1055
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1056
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1057
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1058
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1064
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1065
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1066
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1078
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1085
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1086
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0xb4
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/socket-constants.h"
+	.byte	0x3
+	.uleb128 0x184
+	.uleb128 0x3a
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/in.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 60 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0x193
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1476
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x196
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x197
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1489
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/netdb.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1536
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/fcntl.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1604
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1605
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stat.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1606
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1655
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1656
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1657
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1658
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1663
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 73 "/usr/include/netinet/tcp.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1721
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1739
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1742
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1743
+	.byte	0x4
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1744
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1745
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1746
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1780
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF515
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1723
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1824
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x55
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1861
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1862
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1874
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/signum-arch.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1916
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/types/__sigval_t.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1919
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/siginfo-arch.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1922
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2006
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/sigevent-consts.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/sigaction.h"
+	.byte	0x3
+	.uleb128 0xe5
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x137
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/sys/ucontext.h"
+	.byte	0x3
+	.uleb128 0x13c
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/sigthread.h"
+	.byte	0x3
+	.uleb128 0x178
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2033
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/signal_ext.h"
+	.byte	0x3
+	.uleb128 0x187
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2036
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2037
+	.file 104 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x68
+	.file 105 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x69
+	.file 106 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2038
+	.file 107 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2173
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2174
+	.byte	0x4
+	.file 108 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2175
+	.file 109 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2176
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x6c
+	.file 110 "/usr/include/limits.h"
+	.byte	0x3
+	.uleb128 0xcb
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"
+	.byte	0x3
+	.uleb128 0xc3
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2182
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/local_lim.h"
+	.byte	0x3
+	.uleb128 0xa1
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.file 113 "/usr/include/linux/limits.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x72
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x73
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2246
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2253
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"
+	.byte	0x3
+	.uleb128 0xc7
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF2273
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2310
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2322
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.4fcc72200ea2768811361419cd04ad06,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF439
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.399.1d968b0a8570a9ca1fc65b1c72068200,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF453
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF532
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.34.7aefa0a1ce660b7f06a1931d229ef869,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF557
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.210.b7626dff4e8645cee35c44183ab9e1fb,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF634
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.221.1c4b8ffb35d9df7e3e05ff92aa0722d4,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.233.c606d47172d71af5b9cd2a3610e806aa,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1039
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.20.08bd3c6531df306b747ad30a61a6808b,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.bd5b3149d68c6eadcc27732883eeb786,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1053
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.171.532b0f99c70942325cc8ad325910ccaf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket_type.h.28.5a26c72aa620989d56a4a7f4b904e12a,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.41.e4f0faad59a1da54fad3da8d9088aa2a,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1224
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockaddr.h.24.0f72ba81a432198016bbf84b8b7dd664,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.192.240720fbd034beed39d5db25eebaf402,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socketconstants.h.25.2a9be5ddbf015310b78561a58fdcf0ba,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1280
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.44.faa1ad965e926697db19cbab56850849,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1285
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.41.56ba25335d25f144a31108dfa1151714,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1407
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.43.23c9b3aef00d8fd8755755aad05a7f3f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1475
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1480
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1482
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1488
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.422.ee437be11cfc9d4be701124d8f6f0975,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1506
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.netdb.h.43.048c387cfcfdca638748ec47edfc91fa,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1535
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.24.62c7e777a8b210e920ccbb92cfe8b9d8,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1540
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntllinux.h.42.e6888a49bd4f2139a7635f6a4494065b,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_stat.h.24.58804b9fde232cb81d58c44500307576,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1613
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stat.h.29.cab33b67e546bcdba0ebb7d142404f85,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.80.df43bf252a5f227617a0cde5a5409472,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1665
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.bc773b5704e26039a693187e0f407a99,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.118.ddf97f25dfa2c24163741c389d063ce4,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.tcp.h.33.ca10008192403376cd935f0fcafe7ff2,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1724
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1726
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1728
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1730
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1732
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1734
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1736
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1738
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1754
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.a67cc0d6228c985787c3c8f11e9d56c3,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1765
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1770
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1772
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1801
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.38f8a7cea5a7dfe0d9ad992f7c8483f3,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1803
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF1804
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1821
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1822
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1823
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.804fe69305bce718c77f3d95d8d5a239,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.3fa7b8f6daaa31edd1696c08c77f2a73,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1864
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1873
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.signumgeneric.h.20.2e2ad585057087ac0ed98bca05f75601,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1893
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.signumarch.h.20.32799b206e0b2f0eb1350cfcae9f8f5c,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.siginfo_t.h.8.53b7afdad4aebaf0ed95612d5dad4eef,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.siginfo_t.h.18.b56415c198410a525a06da001d45c389,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.siginfoconsts.h.20.56f3fd7827102ab719d27bea53f02fe2,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sigevent_t.h.8.8f252baf9d86ba41c1b2ecaa6b01d9f8,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sigeventconsts.h.20.d462cdb6f651c116014a48a61b74441d,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2015
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sigaction.h.20.7620eeec56928b1deec358855bed2047,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2027
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stack_t.h.20.c18dfca5b03576e2243fa200893dcc02,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ucontext.h.19.59462b3a667ad473622078b766d3bb1e,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2031
+	.byte	0x6
+	.uleb128 0x104
+	.long	.LASF2032
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.signal.h.387.a563c12087da832bdf92377abbc44ccf,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF2035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.23.3c23ae3e8f372a0298be6ce978307bc7,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.32.6a1c51cbc8834927c9b529a347d7b23f,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix1_lim.h.32.a7cb894e219b90f9f73cd9217f417c40,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2212
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.local_lim.h.25.97ee4129efb08ad296101237bcd3401b,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2216
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.3.0a3ae0fffe30e22dfdd77ac2c1b1fbdd,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2230
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.local_lim.h.42.a403368f4a1bbbff510e22bd9037c5aa,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF2231
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF2232
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF2233
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF2234
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF2235
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF2236
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF2237
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2243
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2245
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.local_lim.h.84.535be492ad9773d11e46b49da2c4d18d,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2252
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix2_lim.h.23.56b9c4f885cbac0b652f53ee56b244b1,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.60.7bfe30ae3ff4e90f07238e284348f8e7,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2274
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2276
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2278
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2280
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2282
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2284
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2286
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2288
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2290
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2292
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2294
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2296
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2298
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2300
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2302
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2304
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2306
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2180
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2309
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF2643
+	.long	.LASF2644
+	.long	.LASF2645
+	.long	.LASF2646
+	.long	.LASF2647
+	.long	.LASF2648
+	.long	.LASF2649
+	.long	.LASF2650
+	.long	.LASF2651
+	.long	.LASF2652
+	.long	.LASF2653
+	.long	.LASF2654
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x75
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2655
+	.byte	0x8
+	.long	.LASF2656
+	.byte	0xb
+	.long	.LASF2657
+	.byte	0xc
+	.long	.LASF2658
+	.byte	0x8
+	.long	.LASF2659
+	.byte	0x8
+	.long	.LASF2660
+	.byte	0x8
+	.long	.LASF2661
+	.byte	0x5
+	.long	.LASF2662
+	.byte	0xb
+	.long	.LASF2663
+	.byte	0x7
+	.long	.LASF2664
+	.byte	0xa
+	.long	.LASF2665
+	.byte	0xc
+	.long	.LASF2666
+	.byte	0
+	.long	.LASF2667
+	.byte	0x7
+	.long	.LASF2668
+	.byte	0x7
+	.long	.LASF2669
+	.byte	0xb
+	.long	.LASF2670
+	.byte	0xb
+	.long	.LASF2671
+	.byte	0x1
+	.long	.LASF2672
+	.byte	0x1
+	.long	.LASF2659
+	.byte	0xa
+	.long	.LASF2673
+	.byte	0xa
+	.long	.LASF2674
+	.byte	0xb
+	.long	.LASF2675
+	.byte	0xb
+	.long	.LASF2676
+	.byte	0x2
+	.long	.LASF2677
+	.byte	0xb
+	.long	.LASF2678
+	.byte	0x8
+	.long	.LASF2679
+	.byte	0x8
+	.long	.LASF2680
+	.byte	0xb
+	.long	.LASF2681
+	.byte	0xb
+	.long	.LASF2682
+	.byte	0xb
+	.long	.LASF2683
+	.byte	0xb
+	.long	.LASF2684
+	.byte	0x8
+	.long	.LASF2685
+	.byte	0x8
+	.long	.LASF2686
+	.byte	0xa
+	.long	.LASF2687
+	.byte	0x8
+	.long	.LASF2688
+	.byte	0x9
+	.long	.LASF2689
+	.byte	0x9
+	.long	.LASF2690
+	.byte	0x8
+	.long	.LASF2691
+	.byte	0x8
+	.long	.LASF2692
+	.byte	0x8
+	.long	.LASF2693
+	.byte	0x8
+	.long	.LASF2694
+	.byte	0x8
+	.long	.LASF2695
+	.byte	0x8
+	.long	.LASF2696
+	.byte	0x8
+	.long	.LASF2697
+	.byte	0x8
+	.long	.LASF2698
+	.byte	0x7
+	.long	.LASF2655
+	.byte	0xa
+	.long	.LASF2699
+	.byte	0x7
+	.long	.LASF2700
+	.byte	0x7
+	.long	.LASF2701
+	.byte	0x7
+	.long	.LASF2702
+	.byte	0x7
+	.long	.LASF2703
+	.byte	0x8
+	.long	.LASF2704
+	.byte	0x8
+	.long	.LASF2705
+	.byte	0x8
+	.long	.LASF2706
+	.byte	0x8
+	.long	.LASF2707
+	.byte	0x8
+	.long	.LASF2708
+	.byte	0x8
+	.long	.LASF2709
+	.byte	0x8
+	.long	.LASF2710
+	.byte	0x8
+	.long	.LASF2661
+	.byte	0x8
+	.long	.LASF2711
+	.byte	0xb
+	.long	.LASF2711
+	.byte	0x8
+	.long	.LASF2712
+	.byte	0x8
+	.long	.LASF2713
+	.byte	0x8
+	.long	.LASF2662
+	.byte	0x8
+	.long	.LASF2674
+	.byte	0x8
+	.long	.LASF2714
+	.byte	0x8
+	.long	.LASF2715
+	.byte	0x7
+	.long	.LASF2716
+	.byte	0x8
+	.long	.LASF2717
+	.byte	0x8
+	.long	.LASF2664
+	.byte	0x8
+	.long	.LASF2718
+	.byte	0x7
+	.long	.LASF2719
+	.byte	0x7
+	.long	.LASF2720
+	.byte	0x5
+	.long	.LASF2721
+	.byte	0x8
+	.long	.LASF2722
+	.byte	0x7
+	.long	.LASF2723
+	.byte	0x7
+	.long	.LASF2724
+	.byte	0x7
+	.long	.LASF2725
+	.byte	0x7
+	.long	.LASF2726
+	.byte	0x8
+	.long	.LASF2727
+	.byte	0x8
+	.long	.LASF2728
+	.byte	0x8
+	.long	.LASF2669
+	.byte	0x8
+	.long	.LASF2729
+	.byte	0x8
+	.long	.LASF2730
+	.byte	0x8
+	.long	.LASF2731
+	.byte	0x8
+	.long	.LASF2732
+	.byte	0x8
+	.long	.LASF2733
+	.byte	0x7
+	.long	.LASF2734
+	.byte	0x7
+	.long	.LASF2735
+	.byte	0x8
+	.long	.LASF2736
+	.byte	0x8
+	.long	.LASF2737
+	.byte	0x7
+	.long	.LASF2738
+	.byte	0x7
+	.long	.LASF2739
+	.byte	0x7
+	.long	.LASF2740
+	.byte	0x8
+	.long	.LASF2741
+	.byte	0x8
+	.long	.LASF2742
+	.byte	0x7
+	.long	.LASF2743
+	.byte	0x8
+	.long	.LASF2744
+	.byte	0x8
+	.long	.LASF2745
+	.byte	0x7
+	.long	.LASF2746
+	.byte	0xa
+	.long	.LASF2747
+	.byte	0x8
+	.long	.LASF2748
+	.byte	0x8
+	.long	.LASF2680
+	.byte	0x8
+	.long	.LASF2680
+	.byte	0x4
+	.long	.LASF2680
+	.byte	0x6
+	.long	.LASF2680
+	.byte	0x3
+	.long	.LASF2749
+	.byte	0x3
+	.long	.LASF2750
+	.byte	0xc
+	.long	.LASF2751
+	.byte	0xc
+	.long	.LASF2750
+	.byte	0xb
+	.long	.LASF2752
+	.byte	0x8
+	.long	.LASF2753
+	.byte	0x8
+	.long	.LASF2750
+	.byte	0x4
+	.long	.LASF2754
+	.byte	0x8
+	.long	.LASF2755
+	.byte	0x8
+	.long	.LASF2756
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1240:
+	.string	"MSG_FIN MSG_FIN"
+.LASF2147:
+	.string	"ESHUTDOWN 108"
+.LASF574:
+	.string	"_POSIX_THREADS 200809L"
+.LASF1615:
+	.string	"__S_IFDIR 0040000"
+.LASF1944:
+	.string	"si_band _sifields._sigpoll.si_band"
+.LASF1138:
+	.string	"PF_ALG 38"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1377:
+	.string	"IPV6_RECVDSTOPTS 58"
+.LASF2108:
+	.string	"ESRMNT 69"
+.LASF2195:
+	.string	"_POSIX_NAME_MAX 14"
+.LASF1713:
+	.string	"TCP_FASTOPEN_NO_COOKIE 34"
+.LASF1073:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF626:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF1685:
+	.string	"TCP_KEEPCNT 6"
+.LASF1294:
+	.string	"IP_MULTICAST_IF 32"
+.LASF2040:
+	.string	"EPERM 1"
+.LASF1604:
+	.string	"__OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)"
+.LASF2462:
+	.string	"_unused2"
+.LASF1029:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF972:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF1209:
+	.string	"SOL_RXRPC 272"
+.LASF799:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF847:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1815:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2497:
+	.string	"DYAD_EVENT_CONNECT"
+.LASF2448:
+	.string	"_fileno"
+.LASF1323:
+	.string	"IP_CHECKSUM 23"
+.LASF1509:
+	.string	"_PATH_NETWORKS \"/etc/networks\""
+.LASF455:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF757:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF755:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF1322:
+	.string	"IP_NODEFRAG 22"
+.LASF960:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF1097:
+	.string	"PF_UNSPEC 0"
+.LASF1423:
+	.string	"IPPROTO_AH IPPROTO_AH"
+.LASF1907:
+	.string	"SIGXFSZ 25"
+.LASF482:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2608:
+	.string	"stream_setSocketNonBlocking"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2163:
+	.string	"EMEDIUMTYPE 124"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1435:
+	.string	"IPPROTO_HOPOPTS IPPROTO_HOPOPTS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1316:
+	.string	"IP_PASSSEC 18"
+.LASF794:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1528:
+	.string	"EAI_MEMORY -10"
+.LASF642:
+	.string	"__SQUAD_TYPE long int"
+.LASF1429:
+	.string	"IPPROTO_SCTP IPPROTO_SCTP"
+.LASF2624:
+	.string	"select_grow"
+.LASF1101:
+	.string	"PF_INET 2"
+.LASF949:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF2617:
+	.string	"updateTickTimer"
+.LASF605:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF2553:
+	.string	"freeaddrinfo"
+.LASF2380:
+	.string	"IPPROTO_RSVP"
+.LASF1279:
+	.string	"SO_TIMESTAMPNS 35"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1297:
+	.string	"IP_ADD_MEMBERSHIP 35"
+.LASF552:
+	.string	"_XOPEN_XPG2 1"
+.LASF1203:
+	.string	"SOL_IRDA 266"
+.LASF727:
+	.string	"R_OK 4"
+.LASF725:
+	.string	"__pid_t_defined "
+.LASF1442:
+	.string	"IN_CLASSA(a) ((((in_addr_t)(a)) & 0x80000000) == 0)"
+.LASF1367:
+	.string	"IPV6_HDRINCL 36"
+.LASF826:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF506:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1385:
+	.string	"IPV6_ADDR_PREFERENCES 72"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1440:
+	.string	"IPPROTO_DSTOPTS IPPROTO_DSTOPTS"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2001:
+	.string	"POLL_OUT POLL_OUT"
+.LASF1153:
+	.string	"AF_IPX PF_IPX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2329:
+	.string	"__uint8_t"
+.LASF2503:
+	.string	"DYAD_EVENT_TIMEOUT"
+.LASF2377:
+	.string	"IPPROTO_TP"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2619:
+	.string	"createEvent"
+.LASF2344:
+	.string	"uint32_t"
+.LASF822:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF1612:
+	.string	"_STATBUF_ST_RDEV "
+.LASF2228:
+	.string	"XATTR_SIZE_MAX 65536"
+.LASF517:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2254:
+	.string	"_BITS_POSIX2_LIM_H 1"
+.LASF1376:
+	.string	"IPV6_RTHDR 57"
+.LASF854:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2217:
+	.string	"_LINUX_LIMITS_H "
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1392:
+	.string	"IPV6_FREEBIND 78"
+.LASF1718:
+	.string	"TCP_REPAIR_ON 1"
+.LASF997:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF1747:
+	.string	"__struct_FILE_defined 1"
+.LASF2180:
+	.string	"LLONG_MAX __LONG_LONG_MAX__"
+.LASF1470:
+	.string	"INADDR_MAX_LOCAL_GROUP ((in_addr_t) 0xe00000ff)"
+.LASF459:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2199:
+	.string	"_POSIX_PIPE_BUF 512"
+.LASF2291:
+	.string	"USHRT_MAX"
+.LASF2311:
+	.string	"DYAD_VERSION \"0.2.1\""
+.LASF1659:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1252:
+	.string	"CMSG_DATA(cmsg) ((cmsg)->__cmsg_data)"
+.LASF909:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF2039:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF1893:
+	.string	"SIGCLD SIGCHLD"
+.LASF956:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF1655:
+	.string	"_SYS_TIME_H 1"
+.LASF2048:
+	.string	"EBADF 9"
+.LASF787:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF1285:
+	.string	"__CONST_SOCKADDR_ARG const struct sockaddr *"
+.LASF2477:
+	.string	"bytesReceived"
+.LASF1863:
+	.string	"_STDARG_H "
+.LASF1748:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF810:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1992:
+	.string	"BUS_MCEERR_AR BUS_MCEERR_AR"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2028:
+	.string	"__stack_t_defined 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2402:
+	.string	"sockaddr_in"
+.LASF2357:
+	.string	"sa_family_t"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1266:
+	.string	"SO_ERROR 4"
+.LASF1461:
+	.string	"INADDR_BROADCAST ((in_addr_t) 0xffffffff)"
+.LASF2353:
+	.string	"SOCK_DCCP"
+.LASF2261:
+	.string	"_POSIX2_LINE_MAX 2048"
+.LASF2543:
+	.string	"inet_ntop"
+.LASF2176:
+	.string	"_GCC_NEXT_LIMITS_H "
+.LASF1278:
+	.string	"SO_TIMESTAMP 29"
+.LASF1709:
+	.string	"TCP_FASTOPEN_CONNECT 30"
+.LASF2144:
+	.string	"ENOBUFS 105"
+.LASF1830:
+	.string	"WNOWAIT 0x01000000"
+.LASF1807:
+	.string	"__WCHAR_T__ "
+.LASF2091:
+	.string	"EBADE 52"
+.LASF2233:
+	.string	"LINK_MAX"
+.LASF1824:
+	.string	"_STDLIB_H 1"
+.LASF920:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF1965:
+	.string	"ILL_PRVOPC ILL_PRVOPC"
+.LASF1133:
+	.string	"PF_RXRPC 33"
+.LASF1740:
+	.string	"__need___va_list"
+.LASF1705:
+	.string	"TCP_CC_INFO 26"
+.LASF2111:
+	.string	"EMULTIHOP 72"
+.LASF2263:
+	.string	"_POSIX2_CHARCLASS_NAME_MAX 14"
+.LASF1144:
+	.string	"PF_XDP 44"
+.LASF2063:
+	.string	"EMFILE 24"
+.LASF1914:
+	.string	"__SIGRTMIN 32"
+.LASF1425:
+	.string	"IPPROTO_BEETPH IPPROTO_BEETPH"
+.LASF2255:
+	.string	"_POSIX2_BC_BASE_MAX 99"
+.LASF2280:
+	.string	"SCHAR_MAX __SCHAR_MAX__"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2499:
+	.string	"DYAD_EVENT_READY"
+.LASF2514:
+	.string	"capacity"
+.LASF2080:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF2115:
+	.string	"ENOTUNIQ 76"
+.LASF1941:
+	.string	"si_lower _sifields._sigfault._bounds._addr_bnd._lower"
+.LASF1749:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF932:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF2320:
+	.string	"DYAD_UNSIGNED_BIT (sizeof(unsigned) * CHAR_BIT)"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1646:
+	.string	"S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)"
+.LASF480:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1001:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF2007:
+	.string	"__SIGEV_MAX_SIZE 64"
+.LASF1207:
+	.string	"SOL_NETLINK 270"
+.LASF768:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2572:
+	.string	"host"
+.LASF2343:
+	.string	"uint16_t"
+.LASF573:
+	.string	"_XOPEN_SHM 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF474:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF692:
+	.string	"__FD_SETSIZE 1024"
+.LASF584:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF2209:
+	.string	"_POSIX_TIMER_MAX 32"
+.LASF1566:
+	.string	"O_DIRECTORY __O_DIRECTORY"
+.LASF2085:
+	.string	"EL3HLT 46"
+.LASF2375:
+	.string	"IPPROTO_UDP"
+.LASF1237:
+	.string	"MSG_DONTWAIT MSG_DONTWAIT"
+.LASF2431:
+	.string	"overflow_arg_area"
+.LASF2406:
+	.string	"sin_zero"
+.LASF461:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1311:
+	.string	"IP_RECVTOS 13"
+.LASF1661:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2434:
+	.string	"_flags"
+.LASF1269:
+	.string	"SO_OOBINLINE 10"
+.LASF730:
+	.string	"F_OK 0"
+.LASF1649:
+	.string	"S_IXGRP (S_IXUSR >> 3)"
+.LASF2483:
+	.string	"next"
+.LASF814:
+	.string	"_SC_POLL _SC_POLL"
+.LASF2123:
+	.string	"EILSEQ 84"
+.LASF1761:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF2520:
+	.string	"length"
+.LASF2240:
+	.string	"PTHREAD_KEYS_MAX 1024"
+.LASF915:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF1204:
+	.string	"SOL_NETBEUI 267"
+.LASF2432:
+	.string	"reg_save_area"
+.LASF2057:
+	.string	"EXDEV 18"
+.LASF1421:
+	.string	"IPPROTO_GRE IPPROTO_GRE"
+.LASF1286:
+	.string	"__USE_KERNEL_IPV6_DEFS 0"
+.LASF837:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF738:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF1415:
+	.string	"IPPROTO_UDP IPPROTO_UDP"
+.LASF1711:
+	.string	"TCP_MD5SIG_EXT 32"
+.LASF786:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF639:
+	.string	"__U32_TYPE unsigned int"
+.LASF2502:
+	.string	"DYAD_EVENT_ERROR"
+.LASF2569:
+	.string	"dyad_vwritef"
+.LASF1754:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF2148:
+	.string	"ETOOMANYREFS 109"
+.LASF2079:
+	.string	"ELOOP 40"
+.LASF1036:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1630:
+	.string	"__S_IEXEC 0100"
+.LASF1540:
+	.string	"F_SETLKW64 7"
+.LASF1647:
+	.string	"S_IRGRP (S_IRUSR >> 3)"
+.LASF1231:
+	.string	"MSG_OOB MSG_OOB"
+.LASF1028:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF611:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF731:
+	.string	"SEEK_SET 0"
+.LASF1600:
+	.string	"AT_SYMLINK_NOFOLLOW 0x100"
+.LASF2159:
+	.string	"EISNAM 120"
+.LASF2640:
+	.string	"signal"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF741:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF795:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF1896:
+	.string	"SIGPWR 30"
+.LASF1842:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1160:
+	.string	"AF_ROSE PF_ROSE"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1052:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF599:
+	.string	"_POSIX_SHELL 1"
+.LASF2515:
+	.string	"maxfd"
+.LASF569:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1261:
+	.string	"SO_DEBUG 1"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1922:
+	.string	"_BITS_SIGINFO_ARCH_H 1"
+.LASF2582:
+	.string	"dyad_removeAllListeners"
+.LASF2454:
+	.string	"_lock"
+.LASF1123:
+	.string	"PF_IRDA 23"
+.LASF1491:
+	.string	"ntohs(x) __bswap_16 (x)"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1984:
+	.string	"SEGV_ACCADI SEGV_ACCADI"
+.LASF1357:
+	.string	"IPV6_MTU 24"
+.LASF1522:
+	.string	"EAI_NONAME -2"
+.LASF1136:
+	.string	"PF_IEEE802154 36"
+.LASF621:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF2179:
+	.string	"LLONG_MIN (-LLONG_MAX-1)"
+.LASF2206:
+	.string	"_POSIX_STREAM_MAX 8"
+.LASF1349:
+	.string	"IPV6_UNICAST_HOPS 16"
+.LASF518:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1762:
+	.string	"L_tmpnam 20"
+.LASF659:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1958:
+	.string	"SI_QUEUE SI_QUEUE"
+.LASF2260:
+	.string	"_POSIX2_EXPR_NEST_MAX 32"
+.LASF905:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1182:
+	.string	"AF_IUCV PF_IUCV"
+.LASF2466:
+	.string	"_IO_wide_data"
+.LASF2508:
+	.string	"DYAD_STATE_CONNECTED"
+.LASF481:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1147:
+	.string	"AF_UNSPEC PF_UNSPEC"
+.LASF1546:
+	.string	"O_EXCL 0200"
+.LASF1114:
+	.string	"PF_KEY 15"
+.LASF2516:
+	.string	"SelectSet"
+.LASF797:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2616:
+	.string	"currentTime"
+.LASF1597:
+	.string	"POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2227:
+	.string	"XATTR_NAME_MAX 255"
+.LASF1981:
+	.string	"SEGV_ACCERR SEGV_ACCERR"
+.LASF1432:
+	.string	"IPPROTO_ETHERNET IPPROTO_ETHERNET"
+.LASF883:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1542:
+	.string	"O_RDONLY 00"
+.LASF908:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1006:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF688:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2182:
+	.string	"_BITS_POSIX1_LIM_H 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1567:
+	.string	"O_NOFOLLOW __O_NOFOLLOW"
+.LASF478:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1724:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1226:
+	.string	"__SOCKADDR_COMMON(sa_prefix) sa_family_t sa_prefix ##family"
+.LASF2013:
+	.string	"SIGEV_NONE SIGEV_NONE"
+.LASF1594:
+	.string	"POSIX_FADV_RANDOM 1"
+.LASF1652:
+	.string	"S_IWOTH (S_IWGRP >> 3)"
+.LASF2488:
+	.string	"data"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1716:
+	.string	"TCP_CM_INQ TCP_INQ"
+.LASF710:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1154:
+	.string	"AF_APPLETALK PF_APPLETALK"
+.LASF2637:
+	.string	"__builtin_va_list"
+.LASF777:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2494:
+	.string	"DYAD_EVENT_DESTROY"
+.LASF2223:
+	.string	"MAX_INPUT 255"
+.LASF1177:
+	.string	"AF_IB PF_IB"
+.LASF2463:
+	.string	"FILE"
+.LASF1879:
+	.string	"SIGINT 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1581:
+	.string	"__F_GETSIG 11"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF615:
+	.string	"_POSIX_TRACE -1"
+.LASF2078:
+	.string	"ENOTEMPTY 39"
+.LASF1449:
+	.string	"IN_CLASSB_NSHIFT 16"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2041:
+	.string	"ENOENT 2"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF457:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2358:
+	.string	"sa_family"
+.LASF767:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF1535:
+	.string	"NI_DGRAM 16"
+.LASF1493:
+	.string	"htons(x) __bswap_16 (x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1118:
+	.string	"PF_ASH 18"
+.LASF1223:
+	.string	"SOL_SMC 286"
+.LASF1699:
+	.string	"TCP_REPAIR_QUEUE 20"
+.LASF553:
+	.string	"_XOPEN_XPG3 1"
+.LASF1574:
+	.string	"F_GETFL 3"
+.LASF2491:
+	.string	"dyad_Callback"
+.LASF1656:
+	.string	"__timeval_defined 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2000:
+	.string	"POLL_IN POLL_IN"
+.LASF830:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF1916:
+	.string	"_NSIG (__SIGRTMAX + 1)"
+.LASF1340:
+	.string	"IPV6_2292HOPOPTS 3"
+.LASF1729:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1411:
+	.string	"IPPROTO_IPIP IPPROTO_IPIP"
+.LASF2539:
+	.string	"fcntl"
+.LASF2154:
+	.string	"EINPROGRESS 115"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1606:
+	.string	"_BITS_STAT_H 1"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1487:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF528:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1873:
+	.string	"__va_list__ "
+.LASF1653:
+	.string	"S_IXOTH (S_IXGRP >> 3)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1277:
+	.string	"SO_SNDTIMEO 21"
+.LASF2397:
+	.string	"__u6_addr8"
+.LASF501:
+	.string	"__always_inline"
+.LASF1095:
+	.string	"SOCK_CLOEXEC SOCK_CLOEXEC"
+.LASF1781:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2221:
+	.string	"LINK_MAX 127"
+.LASF817:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF1451:
+	.string	"IN_CLASSB_MAX 65536"
+.LASF806:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2537:
+	.string	"gettimeofday"
+.LASF2242:
+	.string	"PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF1227:
+	.string	"__SOCKADDR_COMMON_SIZE (sizeof (unsigned short int))"
+.LASF2633:
+	.string	"__bswap_16"
+.LASF2419:
+	.string	"ai_addr"
+.LASF2298:
+	.string	"UINT_MAX (INT_MAX * 2U + 1U)"
+.LASF2478:
+	.string	"lastActivity"
+.LASF561:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1346:
+	.string	"SCM_SRCRT IPV6_RXSRCRT"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF591:
+	.string	"_LFS_LARGEFILE 1"
+.LASF1447:
+	.string	"IN_CLASSB(a) ((((in_addr_t)(a)) & 0xc0000000) == 0x80000000)"
+.LASF1654:
+	.string	"S_IRWXO (S_IRWXG >> 3)"
+.LASF746:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2578:
+	.string	"backlog"
+.LASF2112:
+	.string	"EDOTDOT 73"
+.LASF824:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF1302:
+	.string	"IP_DROP_SOURCE_MEMBERSHIP 40"
+.LASF1501:
+	.string	"IN6_IS_ADDR_MULTICAST(a) (((const uint8_t *) (a))[0] == 0xff)"
+.LASF2116:
+	.string	"EBADFD 77"
+.LASF1586:
+	.string	"F_RDLCK 0"
+.LASF2440:
+	.string	"_IO_write_end"
+.LASF2273:
+	.string	"_GCC_NEXT_LIMITS_H"
+.LASF1701:
+	.string	"TCP_REPAIR_OPTIONS 22"
+.LASF606:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF1089:
+	.string	"SOCK_DGRAM SOCK_DGRAM"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1210:
+	.string	"SOL_PPPOL2TP 273"
+.LASF1580:
+	.string	"__F_SETSIG 10"
+.LASF985:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF2521:
+	.string	"double"
+.LASF829:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF1113:
+	.string	"PF_SECURITY 14"
+.LASF669:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2306:
+	.string	"LLONG_MIN (-LLONG_MAX - 1LL)"
+.LASF1489:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF484:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2363:
+	.string	"__ss_padding"
+.LASF745:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF2638:
+	.string	"__va_list_tag"
+.LASF889:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF2322:
+	.string	"DYAD_FLAG_WRITTEN (1 << 1)"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2487:
+	.string	"remote"
+.LASF1119:
+	.string	"PF_ECONET 19"
+.LASF2139:
+	.string	"ENETDOWN 100"
+.LASF1275:
+	.string	"SO_TYPE 3"
+.LASF2332:
+	.string	"long int"
+.LASF2528:
+	.string	"dyad_tickInterval"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2009:
+	.string	"sigev_notify_function _sigev_un._sigev_thread._function"
+.LASF1694:
+	.string	"TCP_COOKIE_TRANSACTIONS 15"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF2554:
+	.string	"free"
+.LASF535:
+	.string	"__stub_chflags "
+.LASF2513:
+	.string	"SELECT_MAX"
+.LASF1874:
+	.string	"_SIGNAL_H "
+.LASF1977:
+	.string	"FPE_FLTSUB FPE_FLTSUB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF551:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF1743:
+	.string	"____mbstate_t_defined 1"
+.LASF2061:
+	.string	"EINVAL 22"
+.LASF2589:
+	.string	"dyad_setUpdateTimeout"
+.LASF2394:
+	.string	"IPPROTO_MPTCP"
+.LASF1841:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF946:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1166:
+	.string	"AF_ROUTE PF_ROUTE"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2082:
+	.string	"EIDRM 43"
+.LASF714:
+	.string	"_GCC_SIZE_T "
+.LASF1853:
+	.string	"__ldiv_t_defined 1"
+.LASF539:
+	.string	"__stub_setlogin "
+.LASF1866:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1982:
+	.string	"SEGV_BNDERR SEGV_BNDERR"
+.LASF2536:
+	.string	"getaddrinfo"
+.LASF2436:
+	.string	"_IO_read_end"
+.LASF785:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF1851:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF927:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF1156:
+	.string	"AF_BRIDGE PF_BRIDGE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2526:
+	.string	"dyad_selectSet"
+.LASF541:
+	.string	"__stub_stty "
+.LASF1422:
+	.string	"IPPROTO_ESP IPPROTO_ESP"
+.LASF2566:
+	.string	"seconds"
+.LASF440:
+	.string	"__WORDSIZE 64"
+.LASF2268:
+	.string	"COLL_WEIGHTS_MAX 255"
+.LASF601:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF2236:
+	.string	"__undef_OPEN_MAX"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF983:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF1181:
+	.string	"AF_BLUETOOTH PF_BLUETOOTH"
+.LASF2628:
+	.string	"memsz"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF943:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF1205:
+	.string	"SOL_LLC 268"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF722:
+	.string	"__uid_t_defined "
+.LASF2157:
+	.string	"ENOTNAM 118"
+.LASF2583:
+	.string	"dyad_removeListener"
+.LASF2042:
+	.string	"ESRCH 3"
+.LASF1281:
+	.string	"SHUT_RD SHUT_RD"
+.LASF1925:
+	.string	"__SI_CLOCK_T __clock_t"
+.LASF1369:
+	.string	"IPV6_PKTINFO 50"
+.LASF622:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF562:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF1980:
+	.string	"SEGV_MAPERR SEGV_MAPERR"
+.LASF1633:
+	.string	"S_IFMT __S_IFMT"
+.LASF805:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1838:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF2371:
+	.string	"IPPROTO_IPIP"
+.LASF885:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF2403:
+	.string	"sin_family"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1173:
+	.string	"AF_IRDA PF_IRDA"
+.LASF2036:
+	.string	"_ERRNO_H 1"
+.LASF2530:
+	.string	"fgetc"
+.LASF922:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF2230:
+	.string	"RTSIG_MAX 32"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1890:
+	.string	"SIGALRM 14"
+.LASF2129:
+	.string	"EMSGSIZE 90"
+.LASF2035:
+	.string	"SIGRTMAX (__libc_current_sigrtmax ())"
+.LASF1562:
+	.string	"__O_TMPFILE (020000000 | __O_DIRECTORY)"
+.LASF1670:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF1424:
+	.string	"IPPROTO_MTP IPPROTO_MTP"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF513:
+	.string	"__attribute_copy__"
+.LASF1750:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF2501:
+	.string	"DYAD_EVENT_LINE"
+.LASF1629:
+	.string	"__S_IWRITE 0200"
+.LASF1668:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF2186:
+	.string	"_POSIX_CHILD_MAX 25"
+.LASF445:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1190:
+	.string	"AF_VSOCK PF_VSOCK"
+.LASF1282:
+	.string	"SHUT_WR SHUT_WR"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1726:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1533:
+	.string	"NI_NOFQDN 4"
+.LASF651:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1045:
+	.string	"_SYS_SOCKET_H 1"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2495:
+	.string	"DYAD_EVENT_ACCEPT"
+.LASF2244:
+	.string	"PTHREAD_THREADS_MAX"
+.LASF1158:
+	.string	"AF_X25 PF_X25"
+.LASF1239:
+	.string	"MSG_WAITALL MSG_WAITALL"
+.LASF1276:
+	.string	"SO_RCVTIMEO 20"
+.LASF1959:
+	.string	"SI_USER SI_USER"
+.LASF1651:
+	.string	"S_IROTH (S_IRGRP >> 3)"
+.LASF2350:
+	.string	"SOCK_RAW"
+.LASF2376:
+	.string	"IPPROTO_IDP"
+.LASF1184:
+	.string	"AF_ISDN PF_ISDN"
+.LASF544:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF494:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1971:
+	.string	"FPE_INTOVF FPE_INTOVF"
+.LASF846:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF1913:
+	.string	"SIGWINCH 28"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF2017:
+	.string	"sa_handler __sigaction_handler.sa_handler"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2258:
+	.string	"_POSIX2_BC_STRING_MAX 1000"
+.LASF938:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF1899:
+	.string	"SIGURG 23"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1525:
+	.string	"EAI_FAMILY -6"
+.LASF2247:
+	.string	"DELAYTIMER_MAX 2147483647"
+.LASF1623:
+	.string	"__S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1723:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF627:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF1256:
+	.string	"CMSG_SPACE(len) (CMSG_ALIGN (len) + CMSG_ALIGN (sizeof (struct cmsghdr)))"
+.LASF931:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1526:
+	.string	"EAI_SOCKTYPE -7"
+.LASF2183:
+	.string	"_POSIX_AIO_LISTIO_MAX 2"
+.LASF2484:
+	.string	"type"
+.LASF1481:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1230:
+	.string	"_SS_PADSIZE (_SS_SIZE - __SOCKADDR_COMMON_SIZE - sizeof (__ss_aligntype))"
+.LASF1903:
+	.string	"SIGCHLD 17"
+.LASF1457:
+	.string	"IN_MULTICAST(a) IN_CLASSD(a)"
+.LASF2326:
+	.string	"long unsigned int"
+.LASF1116:
+	.string	"PF_ROUTE PF_NETLINK"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1232:
+	.string	"MSG_PEEK MSG_PEEK"
+.LASF1858:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2365:
+	.string	"in_addr_t"
+.LASF1999:
+	.string	"CLD_CONTINUED CLD_CONTINUED"
+.LASF981:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF2121:
+	.string	"ELIBMAX 82"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1247:
+	.string	"MSG_WAITFORONE MSG_WAITFORONE"
+.LASF1343:
+	.string	"IPV6_2292PKTOPTIONS 6"
+.LASF2196:
+	.string	"_POSIX_NGROUPS_MAX 8"
+.LASF703:
+	.string	"_T_SIZE_ "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1014:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF1003:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF2288:
+	.string	"SHRT_MIN (-SHRT_MAX - 1)"
+.LASF1565:
+	.string	"F_SETLKW F_SETLKW64"
+.LASF2330:
+	.string	"__uint16_t"
+.LASF1471:
+	.string	"s6_addr __in6_u.__u6_addr8"
+.LASF2272:
+	.string	"RE_DUP_MAX (0x7fff)"
+.LASF2015:
+	.string	"SIGEV_THREAD_ID SIGEV_THREAD_ID"
+.LASF1433:
+	.string	"IPPROTO_RAW IPPROTO_RAW"
+.LASF1071:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1978:
+	.string	"FPE_FLTUNK FPE_FLTUNK"
+.LASF612:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2404:
+	.string	"sin_port"
+.LASF1314:
+	.string	"IP_IPSEC_POLICY 16"
+.LASF1167:
+	.string	"AF_PACKET PF_PACKET"
+.LASF2545:
+	.string	"getpeername"
+.LASF396:
+	.string	"_UNISTD_H 1"
+.LASF364:
+	.string	"__k8 1"
+.LASF2359:
+	.string	"sa_data"
+.LASF554:
+	.string	"_XOPEN_XPG4 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF864:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF2547:
+	.string	"recv"
+.LASF873:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF721:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2058:
+	.string	"ENODEV 19"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2576:
+	.string	"dyad_listen"
+.LASF1560:
+	.string	"__O_PATH 010000000"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1199:
+	.string	"SOL_X25 262"
+.LASF1362:
+	.string	"IPV6_MULTICAST_ALL 29"
+.LASF898:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF1350:
+	.string	"IPV6_MULTICAST_IF 17"
+.LASF525:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF2556:
+	.string	"getsockopt"
+.LASF747:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF1015:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF1507:
+	.string	"_PATH_HEQUIV \"/etc/hosts.equiv\""
+.LASF1931:
+	.string	"si_timerid _sifields._timer.si_tid"
+.LASF716:
+	.string	"__size_t "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF771:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF911:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF1672:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1110:
+	.string	"PF_ROSE 11"
+.LASF1046:
+	.string	"__iovec_defined 1"
+.LASF2030:
+	.string	"__ctx(fld) __ ## fld"
+.LASF1599:
+	.string	"AT_FDCWD -100"
+.LASF1876:
+	.string	"SIG_ERR ((__sighandler_t) -1)"
+.LASF1020:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1439:
+	.string	"IPPROTO_NONE IPPROTO_NONE"
+.LASF2509:
+	.string	"DYAD_STATE_LISTENING"
+.LASF1139:
+	.string	"PF_NFC 39"
+.LASF1012:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1162:
+	.string	"AF_NETBEUI PF_NETBEUI"
+.LASF1496:
+	.string	"IN6_IS_ADDR_LINKLOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfe800000); }))"
+.LASF2428:
+	.string	"__gnuc_va_list"
+.LASF1517:
+	.string	"AI_V4MAPPED 0x0008"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2175:
+	.string	"_GCC_LIMITS_H_ "
+.LASF1727:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1115:
+	.string	"PF_NETLINK 16"
+.LASF2447:
+	.string	"_chain"
+.LASF511:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1317:
+	.string	"IP_TRANSPARENT 19"
+.LASF1051:
+	.string	"__mode_t_defined "
+.LASF1544:
+	.string	"O_RDWR 02"
+.LASF1109:
+	.string	"PF_INET6 10"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1446:
+	.string	"IN_CLASSA_MAX 128"
+.LASF1796:
+	.string	"__f32x(x) x ##f32x"
+.LASF1667:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF856:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF1733:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF833:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF1983:
+	.string	"SEGV_PKUERR SEGV_PKUERR"
+.LASF849:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF1531:
+	.string	"NI_NUMERICHOST 1"
+.LASF1143:
+	.string	"PF_SMC 43"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2529:
+	.string	"dyad_lastTick"
+.LASF2308:
+	.string	"ULLONG_MAX"
+.LASF1373:
+	.string	"IPV6_HOPOPTS 54"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1295:
+	.string	"IP_MULTICAST_TTL 33"
+.LASF2259:
+	.string	"_POSIX2_COLL_WEIGHTS_MAX 2"
+.LASF1976:
+	.string	"FPE_FLTINV FPE_FLTINV"
+.LASF2323:
+	.string	"unsigned char"
+.LASF1044:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1593:
+	.string	"POSIX_FADV_NORMAL 0"
+.LASF2571:
+	.string	"dyad_connect"
+.LASF526:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1380:
+	.string	"IPV6_PATHMTU 61"
+.LASF2395:
+	.string	"IPPROTO_MAX"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1005:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF2235:
+	.string	"OPEN_MAX"
+.LASF2349:
+	.string	"SOCK_DGRAM"
+.LASF2107:
+	.string	"EADV 68"
+.LASF2425:
+	.string	"__fd_mask"
+.LASF735:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF758:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF2544:
+	.string	"getsockname"
+.LASF967:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF2639:
+	.string	"_IO_lock_t"
+.LASF1324:
+	.string	"IP_BIND_ADDRESS_NO_PORT 24"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF910:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF1255:
+	.string	"CMSG_ALIGN(len) (((len) + sizeof (size_t) - 1) & (size_t) ~(sizeof (size_t) - 1))"
+.LASF1145:
+	.string	"PF_MCTP 45"
+.LASF2388:
+	.string	"IPPROTO_COMP"
+.LASF2641:
+	.string	"__sysv_signal"
+.LASF1016:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF1613:
+	.string	"_STATBUF_ST_NSEC "
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF740:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF379:
+	.string	"linux 1"
+.LASF1124:
+	.string	"PF_PPPOX 24"
+.LASF1817:
+	.string	"___int_wchar_t_h "
+.LASF759:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF1195:
+	.string	"AF_MCTP PF_MCTP"
+.LASF576:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1310:
+	.string	"IP_RECVTTL 12"
+.LASF907:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2045:
+	.string	"ENXIO 6"
+.LASF1306:
+	.string	"IP_PKTOPTIONS 9"
+.LASF2356:
+	.string	"SOCK_NONBLOCK"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1092:
+	.string	"SOCK_SEQPACKET SOCK_SEQPACKET"
+.LASF1058:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1383:
+	.string	"IPV6_TCLASS 67"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF976:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF2382:
+	.string	"IPPROTO_ESP"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2598:
+	.string	"optlen"
+.LASF893:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1356:
+	.string	"IPV6_MTU_DISCOVER 23"
+.LASF2234:
+	.string	"__undef_LINK_MAX"
+.LASF1352:
+	.string	"IPV6_MULTICAST_LOOP 19"
+.LASF2043:
+	.string	"EINTR 4"
+.LASF1624:
+	.string	"__S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1975:
+	.string	"FPE_FLTRES FPE_FLTRES"
+.LASF462:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF2222:
+	.string	"MAX_CANON 255"
+.LASF1990:
+	.string	"BUS_ADRERR BUS_ADRERR"
+.LASF2264:
+	.string	"BC_BASE_MAX _POSIX2_BC_BASE_MAX"
+.LASF1678:
+	.string	"ITIMER_PROF ITIMER_PROF"
+.LASF2128:
+	.string	"EDESTADDRREQ 89"
+.LASF2511:
+	.string	"SELECT_WRITE"
+.LASF1381:
+	.string	"IPV6_DONTFRAG 62"
+.LASF2610:
+	.string	"sai6"
+.LASF2029:
+	.string	"_SYS_UCONTEXT_H 1"
+.LASF1584:
+	.string	"F_DUPFD_CLOEXEC 1030"
+.LASF743:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF1043:
+	.string	"_NETINET_IN_H 1"
+.LASF558:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF991:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF2479:
+	.string	"timeout"
+.LASF1308:
+	.string	"IP_MTU_DISCOVER 10"
+.LASF500:
+	.string	"__wur "
+.LASF1375:
+	.string	"IPV6_RECVRTHDR 56"
+.LASF1086:
+	.string	"__have_pthread_attr_t 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2493:
+	.string	"DYAD_EVENT_NULL"
+.LASF1577:
+	.string	"__F_GETOWN 9"
+.LASF1840:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1960:
+	.string	"SI_KERNEL SI_KERNEL"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1183:
+	.string	"AF_RXRPC PF_RXRPC"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1360:
+	.string	"IPV6_JOIN_ANYCAST 27"
+.LASF596:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF2220:
+	.string	"ARG_MAX 131072"
+.LASF1334:
+	.string	"SOL_IP 0"
+.LASF1054:
+	.string	"__clock_t_defined 1"
+.LASF1075:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1814:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF876:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF1499:
+	.string	"IN6_IS_ADDR_V4COMPAT(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && ntohl (__a->__in6_u.__u6_addr32[3]) > 1; }))"
+.LASF800:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF2564:
+	.string	"dyad_setNoDelay"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF919:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1224:
+	.string	"SOMAXCONN 4096"
+.LASF1196:
+	.string	"AF_MAX PF_MAX"
+.LASF844:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF2090:
+	.string	"EL2HLT 51"
+.LASF2105:
+	.string	"EREMOTE 66"
+.LASF624:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF2603:
+	.string	"stream_hasListenerForEvent"
+.LASF1527:
+	.string	"EAI_SERVICE -8"
+.LASF565:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF1666:
+	.string	"__NFDBITS"
+.LASF460:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1047:
+	.string	"__BITS_SOCKET_H "
+.LASF726:
+	.string	"__intptr_t_defined "
+.LASF1628:
+	.string	"__S_IREAD 0400"
+.LASF2245:
+	.string	"AIO_PRIO_DELTA_MAX 20"
+.LASF516:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2540:
+	.string	"accept"
+.LASF1843:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF2083:
+	.string	"ECHRNG 44"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF473:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF545:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF1869:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1034:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF2127:
+	.string	"ENOTSOCK 88"
+.LASF899:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF1467:
+	.string	"INADDR_ALLHOSTS_GROUP ((in_addr_t) 0xe0000001)"
+.LASF2312:
+	.string	"INVALID_SOCKET -1"
+.LASF1962:
+	.string	"ILL_ILLOPN ILL_ILLOPN"
+.LASF643:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1897:
+	.string	"SIGBUS 7"
+.LASF1966:
+	.string	"ILL_PRVREG ILL_PRVREG"
+.LASF2131:
+	.string	"ENOPROTOOPT 92"
+.LASF2586:
+	.string	"dyad_newStream"
+.LASF1714:
+	.string	"TCP_ZEROCOPY_RECEIVE 35"
+.LASF1601:
+	.string	"AT_REMOVEDIR 0x200"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2109:
+	.string	"ECOMM 70"
+.LASF1328:
+	.string	"IP_PMTUDISC_WANT 1"
+.LASF1171:
+	.string	"AF_RDS PF_RDS"
+.LASF1057:
+	.string	"__timer_t_defined 1"
+.LASF836:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF2074:
+	.string	"EDEADLK 35"
+.LASF1090:
+	.string	"SOCK_RAW SOCK_RAW"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1739:
+	.string	"__need___va_list "
+.LASF1938:
+	.string	"si_ptr _sifields._rt.si_sigval.sival_ptr"
+.LASF1769:
+	.string	"stdout stdout"
+.LASF1786:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF443:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2439:
+	.string	"_IO_write_ptr"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF685:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1892:
+	.string	"SIGIOT SIGABRT"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1379:
+	.string	"IPV6_RECVPATHMTU 60"
+.LASF1664:
+	.string	"____sigset_t_defined "
+.LASF1792:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1476:
+	.string	"_ENDIAN_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF524:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1864:
+	.string	"_ANSI_STDARG_H_ "
+.LASF2386:
+	.string	"IPPROTO_ENCAP"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1455:
+	.string	"IN_CLASSC_HOST (0xffffffff & ~IN_CLASSC_NET)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF812:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF1132:
+	.string	"PF_IUCV 32"
+.LASF2060:
+	.string	"EISDIR 21"
+.LASF1108:
+	.string	"PF_X25 9"
+.LASF2565:
+	.string	"dyad_setTimeout"
+.LASF563:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF887:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF650:
+	.string	"__STD_TYPE typedef"
+.LASF2049:
+	.string	"ECHILD 10"
+.LASF1253:
+	.string	"CMSG_NXTHDR(mhdr,cmsg) __cmsg_nxthdr (mhdr, cmsg)"
+.LASF2092:
+	.string	"EBADR 53"
+.LASF2467:
+	.string	"va_list"
+.LASF2336:
+	.string	"__suseconds_t"
+.LASF1479:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2271:
+	.string	"CHARCLASS_NAME_MAX 2048"
+.LASF2482:
+	.string	"writeBuffer"
+.LASF2548:
+	.string	"exit"
+.LASF548:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF1128:
+	.string	"PF_MPLS 28"
+.LASF1788:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF865:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF933:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF1135:
+	.string	"PF_PHONET 35"
+.LASF1409:
+	.string	"IPPROTO_ICMP IPPROTO_ICMP"
+.LASF2252:
+	.string	"SEM_VALUE_MAX (2147483647)"
+.LASF1557:
+	.string	"__O_CLOEXEC 02000000"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2596:
+	.string	"dyad_update"
+.LASF2008:
+	.string	"__SIGEV_PAD_SIZE ((__SIGEV_MAX_SIZE / sizeof (int)) - 4)"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1475:
+	.string	"INET6_ADDRSTRLEN 46"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF649:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF693:
+	.string	"_BITS_TIME64_H 1"
+.LASF1077:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1695:
+	.string	"TCP_THIN_LINEAR_TIMEOUTS 16"
+.LASF2498:
+	.string	"DYAD_EVENT_CLOSE"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1964:
+	.string	"ILL_ILLTRP ILL_ILLTRP"
+.LASF673:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2364:
+	.string	"__ss_align"
+.LASF486:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2424:
+	.string	"tv_usec"
+.LASF2172:
+	.string	"EHWPOISON 133"
+.LASF2602:
+	.string	"stream_flushWriteBuffer"
+.LASF2304:
+	.string	"ULONG_MAX (LONG_MAX * 2UL + 1UL)"
+.LASF1834:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2006:
+	.string	"__sigevent_t_defined 1"
+.LASF1596:
+	.string	"POSIX_FADV_WILLNEED 3"
+.LASF2489:
+	.string	"size"
+.LASF2178:
+	.string	"MB_LEN_MAX 16"
+.LASF1771:
+	.string	"__attr_dealloc_fclose"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF600:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1059:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1327:
+	.string	"IP_PMTUDISC_DONT 0"
+.LASF502:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1445:
+	.string	"IN_CLASSA_HOST (0xffffffff & ~IN_CLASSA_NET)"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1573:
+	.string	"F_SETFD 2"
+.LASF1514:
+	.string	"AI_PASSIVE 0x0001"
+.LASF637:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1505:
+	.string	"IN6_IS_ADDR_MC_ORGLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x8))"
+.LASF2281:
+	.string	"UCHAR_MAX"
+.LASF497:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF912:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF2573:
+	.string	"hints"
+.LASF992:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF2152:
+	.string	"EHOSTUNREACH 113"
+.LASF1318:
+	.string	"IP_MULTICAST_ALL 49"
+.LASF934:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF487:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1973:
+	.string	"FPE_FLTOVF FPE_FLTOVF"
+.LASF1774:
+	.string	"__HAVE_FLOAT128 1"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1684:
+	.string	"TCP_KEEPINTVL 5"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1448:
+	.string	"IN_CLASSB_NET 0xffff0000"
+.LASF1755:
+	.string	"_VA_LIST_DEFINED "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2140:
+	.string	"ENETUNREACH 101"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1681:
+	.string	"TCP_MAXSEG 2"
+.LASF1746:
+	.string	"__FILE_defined 1"
+.LASF2202:
+	.string	"_POSIX_SEM_NSEMS_MAX 256"
+.LASF1783:
+	.string	"__HAVE_FLOAT64 1"
+.LASF939:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF881:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF1220:
+	.string	"SOL_XDP 283"
+.LASF878:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF2137:
+	.string	"EADDRINUSE 98"
+.LASF1641:
+	.string	"S_ISUID __S_ISUID"
+.LASF831:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF1797:
+	.string	"__f64x(x) x ##f64x"
+.LASF2341:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2192:
+	.string	"_POSIX_MAX_INPUT 255"
+.LASF1339:
+	.string	"IPV6_2292PKTINFO 2"
+.LASF2024:
+	.string	"SA_RESETHAND 0x80000000"
+.LASF974:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF2101:
+	.string	"ETIME 62"
+.LASF2073:
+	.string	"ERANGE 34"
+.LASF2581:
+	.string	"dyad_close"
+.LASF675:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2342:
+	.string	"uint8_t"
+.LASF1618:
+	.string	"__S_IFREG 0100000"
+.LASF754:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF1935:
+	.string	"si_stime _sifields._sigchld.si_stime"
+.LASF1344:
+	.string	"IPV6_CHECKSUM 7"
+.LASF952:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF536:
+	.string	"__stub_fchflags "
+.LASF1765:
+	.string	"L_ctermid 9"
+.LASF641:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF631:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF2284:
+	.string	"CHAR_MIN SCHAR_MIN"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2266:
+	.string	"BC_SCALE_MAX _POSIX2_BC_SCALE_MAX"
+.LASF1078:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF2612:
+	.string	"stream_error"
+.LASF1404:
+	.string	"SOL_ICMPV6 58"
+.LASF1134:
+	.string	"PF_ISDN 34"
+.LASF2620:
+	.string	"panic"
+.LASF1254:
+	.string	"CMSG_FIRSTHDR(mhdr) ((size_t) (mhdr)->msg_controllen >= sizeof (struct cmsghdr) ? (struct cmsghdr *) (mhdr)->msg_control : (struct cmsghdr *) 0)"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF2177:
+	.string	"_LIBC_LIMITS_H_ 1"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF2212:
+	.string	"_POSIX_CLOCKRES_MIN 20000000"
+.LASF2621:
+	.string	"select_has"
+.LASF1453:
+	.string	"IN_CLASSC_NET 0xffffff00"
+.LASF2567:
+	.string	"dyad_writef"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1050:
+	.string	"__dev_t_defined "
+.LASF441:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1436:
+	.string	"IPPROTO_ROUTING IPPROTO_ROUTING"
+.LASF2541:
+	.string	"sprintf"
+.LASF590:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF2606:
+	.string	"protocol"
+.LASF529:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1819:
+	.string	"_GCC_WCHAR_T "
+.LASF1917:
+	.string	"__sig_atomic_t_defined 1"
+.LASF514:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF821:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF2370:
+	.string	"IPPROTO_IGMP"
+.LASF654:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1845:
+	.string	"__WCOREFLAG 0x80"
+.LASF645:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1880:
+	.string	"SIGILL 4"
+.LASF1850:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF2253:
+	.string	"SSIZE_MAX LONG_MAX"
+.LASF1904:
+	.string	"SIGTTIN 21"
+.LASF2443:
+	.string	"_IO_save_base"
+.LASF521:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2469:
+	.string	"dyad_Socket"
+.LASF2611:
+	.string	"addr"
+.LASF2141:
+	.string	"ENETRESET 102"
+.LASF382:
+	.string	"unix 1"
+.LASF1865:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1408:
+	.string	"IPPROTO_IP IPPROTO_IP"
+.LASF2347:
+	.string	"socklen_t"
+.LASF977:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF1022:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF1541:
+	.string	"O_ACCMODE 0003"
+.LASF592:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF1107:
+	.string	"PF_ATMPVC 8"
+.LASF430:
+	.string	"__USE_ISOC99 1"
+.LASF2420:
+	.string	"ai_canonname"
+.LASF904:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF840:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF1088:
+	.string	"SOCK_STREAM SOCK_STREAM"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2379:
+	.string	"IPPROTO_IPV6"
+.LASF1779:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF882:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF706:
+	.string	"_SIZE_T_ "
+.LASF2145:
+	.string	"EISCONN 106"
+.LASF2119:
+	.string	"ELIBBAD 80"
+.LASF1979:
+	.string	"FPE_CONDTRAP FPE_CONDTRAP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF568:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF1267:
+	.string	"SO_KEEPALIVE 9"
+.LASF728:
+	.string	"W_OK 2"
+.LASF790:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF717:
+	.string	"__need_size_t"
+.LASF1211:
+	.string	"SOL_BLUETOOTH 274"
+.LASF1067:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF975:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF930:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF1486:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1785:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1272:
+	.string	"SO_REUSEADDR 2"
+.LASF2453:
+	.string	"_shortbuf"
+.LASF998:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF2296:
+	.string	"INT_MAX __INT_MAX__"
+.LASF1412:
+	.string	"IPPROTO_TCP IPPROTO_TCP"
+.LASF2021:
+	.string	"SA_SIGINFO 4"
+.LASF1676:
+	.string	"ITIMER_REAL ITIMER_REAL"
+.LASF1878:
+	.string	"SIG_IGN ((__sighandler_t) 1)"
+.LASF872:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF2362:
+	.string	"ss_family"
+.LASF1942:
+	.string	"si_upper _sifields._sigfault._bounds._addr_bnd._upper"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF879:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF2531:
+	.string	"connect"
+.LASF1393:
+	.string	"IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1790:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1831:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1715:
+	.string	"TCP_INQ 36"
+.LASF2279:
+	.string	"SCHAR_MAX"
+.LASF1417:
+	.string	"IPPROTO_TP IPPROTO_TP"
+.LASF664:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF1529:
+	.string	"EAI_SYSTEM -11"
+.LASF2460:
+	.string	"__pad5"
+.LASF2026:
+	.string	"SIG_UNBLOCK 1"
+.LASF2457:
+	.string	"_wide_data"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF466:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2097:
+	.string	"EDEADLOCK EDEADLK"
+.LASF2243:
+	.string	"_POSIX_THREAD_THREADS_MAX 64"
+.LASF979:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1342:
+	.string	"IPV6_2292RTHDR 5"
+.LASF2016:
+	.string	"_BITS_SIGACTION_H 1"
+.LASF2094:
+	.string	"ENOANO 55"
+.LASF1571:
+	.string	"F_DUPFD 0"
+.LASF1809:
+	.string	"_T_WCHAR_ "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF537:
+	.string	"__stub_gtty "
+.LASF567:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF687:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2378:
+	.string	"IPPROTO_DCCP"
+.LASF1149:
+	.string	"AF_UNIX PF_UNIX"
+.LASF2401:
+	.string	"__in6_u"
+.LASF1186:
+	.string	"AF_IEEE802154 PF_IEEE802154"
+.LASF2557:
+	.string	"select"
+.LASF937:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF1691:
+	.string	"TCP_QUICKACK 12"
+.LASF1643:
+	.string	"S_IRUSR __S_IREAD"
+.LASF2120:
+	.string	"ELIBSCN 81"
+.LASF1780:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2084:
+	.string	"EL2NSYNC 45"
+.LASF580:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF764:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF1179:
+	.string	"AF_CAN PF_CAN"
+.LASF990:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF1441:
+	.string	"IPPROTO_MH IPPROTO_MH"
+.LASF689:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1924:
+	.string	"__SI_BAND_TYPE long int"
+.LASF1175:
+	.string	"AF_WANPIPE PF_WANPIPE"
+.LASF713:
+	.string	"___int_size_t_h "
+.LASF1585:
+	.string	"FD_CLOEXEC 1"
+.LASF2307:
+	.string	"LLONG_MAX"
+.LASF1155:
+	.string	"AF_NETROM PF_NETROM"
+.LASF1274:
+	.string	"SO_SNDLOWAT 19"
+.LASF1778:
+	.string	"__f128(x) x ##f128"
+.LASF1062:
+	.string	"__fsblkcnt_t_defined "
+.LASF890:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF871:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF593:
+	.string	"_LFS64_STDIO 1"
+.LASF508:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF857:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF2623:
+	.string	"select_zero"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1099:
+	.string	"PF_UNIX PF_LOCAL"
+.LASF1949:
+	.string	"_BITS_SIGINFO_CONSTS_H 1"
+.LASF942:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF2237:
+	.string	"ARG_MAX"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1063:
+	.string	"__fsfilcnt_t_defined "
+.LASF1137:
+	.string	"PF_CAIF 37"
+.LASF815:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF1825:
+	.string	"WNOHANG 1"
+.LASF1010:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF780:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF1238:
+	.string	"MSG_EOR MSG_EOR"
+.LASF1549:
+	.string	"O_APPEND 02000"
+.LASF1072:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1189:
+	.string	"AF_NFC PF_NFC"
+.LASF2613:
+	.string	"stream_emitEvent"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2181:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1)"
+.LASF555:
+	.string	"_XOPEN_UNIX 1"
+.LASF1955:
+	.string	"SI_ASYNCIO SI_ASYNCIO"
+.LASF448:
+	.string	"__GNU_LIBRARY__"
+.LASF2046:
+	.string	"E2BIG 7"
+.LASF980:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF444:
+	.string	"__USE_ATFILE 1"
+.LASF973:
+	.string	"_CS_PATH _CS_PATH"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2339:
+	.string	"__socklen_t"
+.LASF2099:
+	.string	"ENOSTR 60"
+.LASF811:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF1758:
+	.string	"_IONBF 2"
+.LASF2474:
+	.string	"address"
+.LASF2077:
+	.string	"ENOSYS 38"
+.LASF1930:
+	.string	"si_uid _sifields._kill.si_uid"
+.LASF819:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF1947:
+	.string	"si_syscall _sifields._sigsys._syscall"
+.LASF2525:
+	.string	"panicCallback"
+.LASF1636:
+	.string	"S_IFBLK __S_IFBLK"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1589:
+	.string	"F_EXLCK 4"
+.LASF2287:
+	.string	"SHRT_MIN"
+.LASF1111:
+	.string	"PF_DECnet 12"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1087:
+	.string	"__socklen_t_defined "
+.LASF2270:
+	.string	"LINE_MAX _POSIX2_LINE_MAX"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1372:
+	.string	"IPV6_RECVHOPOPTS 53"
+.LASF1055:
+	.string	"__clockid_t_defined 1"
+.LASF2318:
+	.string	"vec_push(v,val) ( vec_expand(vec_unpack(v)), (v)->data[(v)->length++] = (val) )"
+.LASF2110:
+	.string	"EPROTO 71"
+.LASF941:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF1763:
+	.string	"TMP_MAX 238328"
+.LASF1259:
+	.string	"_EXTERN_INLINE __extern_inline"
+.LASF1157:
+	.string	"AF_ATMPVC PF_ATMPVC"
+.LASF1827:
+	.string	"WSTOPPED 2"
+.LASF718:
+	.string	"NULL"
+.LASF550:
+	.string	"_XOPEN_VERSION 700"
+.LASF1607:
+	.string	"_BITS_STRUCT_STAT_H 1"
+.LASF1568:
+	.string	"O_CLOEXEC __O_CLOEXEC"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1060:
+	.string	"__blksize_t_defined "
+.LASF2275:
+	.string	"CHAR_BIT"
+.LASF2038:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF2337:
+	.string	"__ssize_t"
+.LASF2301:
+	.string	"LONG_MAX"
+.LASF1690:
+	.string	"TCP_INFO 11"
+.LASF851:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2162:
+	.string	"ENOMEDIUM 123"
+.LASF1096:
+	.string	"SOCK_NONBLOCK SOCK_NONBLOCK"
+.LASF1806:
+	.string	"__wchar_t__ "
+.LASF1332:
+	.string	"IP_PMTUDISC_OMIT 5"
+.LASF2216:
+	.string	"__undef_ARG_MAX "
+.LASF454:
+	.string	"__PMT"
+.LASF2590:
+	.string	"dyad_setTickInterval"
+.LASF1820:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1319:
+	.string	"IP_ORIGDSTADDR 20"
+.LASF1245:
+	.string	"MSG_NOSIGNAL MSG_NOSIGNAL"
+.LASF739:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2542:
+	.string	"strerror"
+.LASF1076:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2241:
+	.string	"_POSIX_THREAD_DESTRUCTOR_ITERATIONS 4"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2051:
+	.string	"ENOMEM 12"
+.LASF2132:
+	.string	"EPROTONOSUPPORT 93"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1313:
+	.string	"IP_FREEBIND 15"
+.LASF1202:
+	.string	"SOL_AAL 265"
+.LASF564:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1837:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF616:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF1591:
+	.string	"__POSIX_FADV_DONTNEED 4"
+.LASF823:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF1619:
+	.string	"__S_IFIFO 0010000"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2400:
+	.string	"in6_addr"
+.LASF891:
+	.string	"_SC_BASE _SC_BASE"
+.LASF2047:
+	.string	"ENOEXEC 8"
+.LASF456:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1291:
+	.string	"IP_RECVOPTS 6"
+.LASF603:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2314:
+	.string	"vec_unpack(v) (char**)&(v)->data, &(v)->length, &(v)->capacity, sizeof(*(v)->data)"
+.LASF1035:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF1033:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1617:
+	.string	"__S_IFBLK 0060000"
+.LASF1331:
+	.string	"IP_PMTUDISC_INTERFACE 4"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1697:
+	.string	"TCP_USER_TIMEOUT 18"
+.LASF2411:
+	.string	"sin6_addr"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1103:
+	.string	"PF_IPX 4"
+.LASF2067:
+	.string	"ENOSPC 28"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2468:
+	.string	"__sighandler_t"
+.LASF2134:
+	.string	"EOPNOTSUPP 95"
+.LASF723:
+	.string	"__off_t_defined "
+.LASF1738:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF2014:
+	.string	"SIGEV_THREAD SIGEV_THREAD"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF507:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF861:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF1378:
+	.string	"IPV6_DSTOPTS 59"
+.LASF1120:
+	.string	"PF_ATMSVC 20"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1188:
+	.string	"AF_ALG PF_ALG"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1206:
+	.string	"SOL_DCCP 269"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1019:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1017:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF640:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1169:
+	.string	"AF_ECONET PF_ECONET"
+.LASF2125:
+	.string	"ESTRPIPE 86"
+.LASF2485:
+	.string	"udata"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2207:
+	.string	"_POSIX_SYMLINK_MAX 255"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF450:
+	.string	"__GLIBC__ 2"
+.LASF2250:
+	.string	"HOST_NAME_MAX 64"
+.LASF855:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF2066:
+	.string	"EFBIG 27"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF2257:
+	.string	"_POSIX2_BC_SCALE_MAX 99"
+.LASF2609:
+	.string	"stream_initAddress"
+.LASF1140:
+	.string	"PF_VSOCK 40"
+.LASF2313:
+	.string	"Vec(T) struct { T *data; int length, capacity; }"
+.LASF1812:
+	.string	"_WCHAR_T_ "
+.LASF586:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF1387:
+	.string	"IPV6_ORIGDSTADDR 74"
+.LASF788:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF1172:
+	.string	"AF_SNA PF_SNA"
+.LASF959:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF2118:
+	.string	"ELIBACC 79"
+.LASF1521:
+	.string	"EAI_BADFLAGS -1"
+.LASF753:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF2138:
+	.string	"EADDRNOTAVAIL 99"
+.LASF2635:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF464:
+	.string	"__P(args) args"
+.LASF2558:
+	.string	"dyad_getSocket"
+.LASF733:
+	.string	"SEEK_END 2"
+.LASF1341:
+	.string	"IPV6_2292DSTOPTS 4"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF684:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF784:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF702:
+	.string	"_SYS_SIZE_T_H "
+.LASF665:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2133:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF724:
+	.string	"__useconds_t_defined "
+.LASF2552:
+	.string	"memset"
+.LASF2219:
+	.string	"NGROUPS_MAX 65536"
+.LASF1038:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1032:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF1163:
+	.string	"AF_SECURITY PF_SECURITY"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2197:
+	.string	"_POSIX_OPEN_MAX 20"
+.LASF1868:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1974:
+	.string	"FPE_FLTUND FPE_FLTUND"
+.LASF793:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF2034:
+	.string	"SIGRTMIN (__libc_current_sigrtmin ())"
+.LASF866:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF1365:
+	.string	"IPV6_IPSEC_POLICY 34"
+.LASF2615:
+	.string	"updateStreamTimeouts"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1301:
+	.string	"IP_ADD_SOURCE_MEMBERSHIP 39"
+.LASF1552:
+	.string	"O_SYNC 04010000"
+.LASF1399:
+	.string	"IPV6_PMTUDISC_DO 2"
+.LASF1538:
+	.string	"F_GETLK64 5"
+.LASF1464:
+	.string	"IN_LOOPBACKNET 127"
+.LASF2534:
+	.string	"bind"
+.LASF2200:
+	.string	"_POSIX_RE_DUP_MAX 255"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1326:
+	.string	"IP_RECVERR_RFC4884 26"
+.LASF2445:
+	.string	"_IO_save_end"
+.LASF2198:
+	.string	"_POSIX_PATH_MAX 256"
+.LASF1657:
+	.string	"__suseconds_t_defined "
+.LASF1428:
+	.string	"IPPROTO_COMP IPPROTO_COMP"
+.LASF1270:
+	.string	"SO_RCVBUF 8"
+.LASF1985:
+	.string	"SEGV_ADIDERR SEGV_ADIDERR"
+.LASF1427:
+	.string	"IPPROTO_PIM IPPROTO_PIM"
+.LASF676:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1065:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2238:
+	.string	"__undef_ARG_MAX"
+.LASF2165:
+	.string	"ENOKEY 126"
+.LASF1673:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1598:
+	.string	"POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE"
+.LASF913:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF1307:
+	.string	"IP_PMTUDISC 10"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF1722:
+	.string	"_STDIO_H 1"
+.LASF2135:
+	.string	"EPFNOSUPPORT 96"
+.LASF2076:
+	.string	"ENOLCK 37"
+.LASF1300:
+	.string	"IP_BLOCK_SOURCE 38"
+.LASF677:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF720:
+	.string	"__need_NULL"
+.LASF2410:
+	.string	"sin6_flowinfo"
+.LASF762:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1193:
+	.string	"AF_SMC PF_SMC"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF781:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF809:
+	.string	"_SC_PII _SC_PII"
+.LASF1933:
+	.string	"si_status _sifields._sigchld.si_status"
+.LASF1662:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF442:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2430:
+	.string	"fp_offset"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1454:
+	.string	"IN_CLASSC_NSHIFT 8"
+.LASF2335:
+	.string	"__time_t"
+.LASF1280:
+	.string	"SO_TIMESTAMPING 37"
+.LASF2232:
+	.string	"__undef_NR_OPEN"
+.LASF560:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF2417:
+	.string	"ai_protocol"
+.LASF2429:
+	.string	"gp_offset"
+.LASF2142:
+	.string	"ECONNABORTED 103"
+.LASF628:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF2559:
+	.string	"dyad_getBytesReceived"
+.LASF1988:
+	.string	"SEGV_MTESERR SEGV_MTESERR"
+.LASF1320:
+	.string	"IP_RECVORIGDSTADDR IP_ORIGDSTADDR"
+.LASF434:
+	.string	"__USE_POSIX199309 1"
+.LASF2167:
+	.string	"EKEYREVOKED 128"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1473:
+	.string	"IN6ADDR_LOOPBACK_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1 } } }"
+.LASF796:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF1225:
+	.string	"_BITS_SOCKADDR_H 1"
+.LASF489:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF801:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF694:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1569:
+	.string	"O_DSYNC __O_DSYNC"
+.LASF2191:
+	.string	"_POSIX_MAX_CANON 255"
+.LASF1744:
+	.string	"_____fpos64_t_defined 1"
+.LASF1222:
+	.string	"SOL_MCTP 285"
+.LASF2210:
+	.string	"_POSIX_TTY_NAME_MAX 9"
+.LASF1946:
+	.string	"si_call_addr _sifields._sigsys._call_addr"
+.LASF2203:
+	.string	"_POSIX_SEM_VALUE_MAX 32767"
+.LASF1268:
+	.string	"SO_LINGER 13"
+.LASF1497:
+	.string	"IN6_IS_ADDR_SITELOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfec00000); }))"
+.LASF1996:
+	.string	"CLD_DUMPED CLD_DUMPED"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF470:
+	.string	"__END_DECLS "
+.LASF2470:
+	.string	"dyad_Stream"
+.LASF2072:
+	.string	"EDOM 33"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1764:
+	.string	"FILENAME_MAX 4096"
+.LASF2164:
+	.string	"ECANCELED 125"
+.LASF1338:
+	.string	"IPV6_ADDRFORM 1"
+.LASF877:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF2585:
+	.string	"listener"
+.LASF2599:
+	.string	"stream_acceptPendingConnections"
+.LASF969:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1777:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1707:
+	.string	"TCP_SAVED_SYN 28"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1041:
+	.string	"_GETOPT_CORE_H 1"
+.LASF662:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1082:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1283:
+	.string	"SHUT_RDWR SHUT_RDWR"
+.LASF1719:
+	.string	"TCP_REPAIR_OFF 0"
+.LASF858:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF1860:
+	.string	"_STRING_H 1"
+.LASF1689:
+	.string	"TCP_WINDOW_CLAMP 10"
+.LASF588:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF2299:
+	.string	"LONG_MIN"
+.LASF1337:
+	.string	"IP_MAX_MEMBERSHIPS 20"
+.LASF1386:
+	.string	"IPV6_MINHOPCOUNT 73"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF957:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF2324:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1498:
+	.string	"IN6_IS_ADDR_V4MAPPED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == htonl (0xffff); }))"
+.LASF1170:
+	.string	"AF_ATMSVC PF_ATMSVC"
+.LASF1679:
+	.string	"_NETINET_TCP_H 1"
+.LASF2327:
+	.string	"signed char"
+.LASF1793:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2618:
+	.string	"destroyClosedStreams"
+.LASF463:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1986:
+	.string	"SEGV_ADIPERR SEGV_ADIPERR"
+.LASF2211:
+	.string	"_POSIX_TZNAME_MAX 6"
+.LASF897:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF1970:
+	.string	"FPE_INTDIV FPE_INTDIV"
+.LASF2087:
+	.string	"ELNRNG 48"
+.LASF1611:
+	.string	"_STATBUF_ST_BLKSIZE "
+.LASF2601:
+	.string	"start"
+.LASF699:
+	.string	"__size_t__ "
+.LASF1347:
+	.string	"IPV6_NEXTHOP 9"
+.LASF436:
+	.string	"__USE_XOPEN2K 1"
+.LASF2276:
+	.string	"CHAR_BIT __CHAR_BIT__"
+.LASF947:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF2348:
+	.string	"SOCK_STREAM"
+.LASF1926:
+	.string	"__SI_ERRNO_THEN_CODE 1"
+.LASF1939:
+	.string	"si_addr _sifields._sigfault.si_addr"
+.LASF1712:
+	.string	"TCP_FASTOPEN_KEY 33"
+.LASF945:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF1816:
+	.string	"_WCHAR_T_H "
+.LASF1987:
+	.string	"SEGV_MTEAERR SEGV_MTEAERR"
+.LASF1159:
+	.string	"AF_INET6 PF_INET6"
+.LASF1683:
+	.string	"TCP_KEEPIDLE 4"
+.LASF490:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1578:
+	.string	"F_SETOWN __F_SETOWN"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1991:
+	.string	"BUS_OBJERR BUS_OBJERR"
+.LASF1056:
+	.string	"__time_t_defined 1"
+.LASF1488:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1911:
+	.string	"SIGUSR1 10"
+.LASF2506:
+	.string	"DYAD_STATE_CLOSING"
+.LASF1235:
+	.string	"MSG_PROXY MSG_PROXY"
+.LASF2069:
+	.string	"EROFS 30"
+.LASF572:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF1912:
+	.string	"SIGUSR2 12"
+.LASF534:
+	.string	"__stub___compat_bdflush "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1485:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2629:
+	.string	"count"
+.LASF2510:
+	.string	"SELECT_READ"
+.LASF940:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF804:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF1122:
+	.string	"PF_SNA 22"
+.LASF1348:
+	.string	"IPV6_AUTHHDR 10"
+.LASF1910:
+	.string	"SIGPROF 27"
+.LASF2384:
+	.string	"IPPROTO_MTP"
+.LASF1085:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF765:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF1795:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1309:
+	.string	"IP_RECVERR 11"
+.LASF707:
+	.string	"_BSD_SIZE_T_ "
+.LASF1104:
+	.string	"PF_APPLETALK 5"
+.LASF1677:
+	.string	"ITIMER_VIRTUAL ITIMER_VIRTUAL"
+.LASF1687:
+	.string	"TCP_LINGER2 8"
+.LASF2265:
+	.string	"BC_DIM_MAX _POSIX2_BC_DIM_MAX"
+.LASF1303:
+	.string	"IP_MSFILTER 41"
+.LASF492:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1388:
+	.string	"IPV6_RECVORIGDSTADDR IPV6_ORIGDSTADDR"
+.LASF1426:
+	.string	"IPPROTO_ENCAP IPPROTO_ENCAP"
+.LASF618:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF775:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF604:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF751:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF1039:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF807:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF559:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF1293:
+	.string	"IP_RETOPTS 7"
+.LASF2031:
+	.string	"__NGREG 23"
+.LASF1023:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF1602:
+	.string	"AT_SYMLINK_FOLLOW 0x400"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF533:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1675:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF633:
+	.string	"STDOUT_FILENO 1"
+.LASF1759:
+	.string	"BUFSIZ 8192"
+.LASF2437:
+	.string	"_IO_read_base"
+.LASF1849:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF663:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF951:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF1784:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2455:
+	.string	"_offset"
+.LASF2373:
+	.string	"IPPROTO_EGP"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1273:
+	.string	"SO_SNDBUF 7"
+.LASF1595:
+	.string	"POSIX_FADV_SEQUENTIAL 2"
+.LASF2360:
+	.string	"sockaddr"
+.LASF749:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF1844:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1645:
+	.string	"S_IXUSR __S_IEXEC"
+.LASF1867:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2089:
+	.string	"ENOCSI 50"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2471:
+	.string	"state"
+.LASF2442:
+	.string	"_IO_buf_end"
+.LASF1234:
+	.string	"MSG_CTRUNC MSG_CTRUNC"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1570:
+	.string	"O_RSYNC O_SYNC"
+.LASF655:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF432:
+	.string	"__USE_POSIX 1"
+.LASF2102:
+	.string	"ENOSR 63"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1305:
+	.string	"IP_PKTINFO 8"
+.LASF1434:
+	.string	"IPPROTO_MPTCP IPPROTO_MPTCP"
+.LASF2575:
+	.string	"fail"
+.LASF458:
+	.string	"__LEAF , __leaf__"
+.LASF1603:
+	.string	"AT_EACCESS 0x200"
+.LASF2361:
+	.string	"sockaddr_storage"
+.LASF2418:
+	.string	"ai_addrlen"
+.LASF1459:
+	.string	"IN_BADCLASS(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xf0000000)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1923:
+	.string	"__SI_ALIGNMENT "
+.LASF1438:
+	.string	"IPPROTO_ICMPV6 IPPROTO_ICMPV6"
+.LASF2218:
+	.string	"NR_OPEN 1024"
+.LASF1710:
+	.string	"TCP_ULP 31"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF791:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF1503:
+	.string	"IN6_IS_ADDR_MC_LINKLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x2))"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1397:
+	.string	"IPV6_PMTUDISC_DONT 0"
+.LASF2604:
+	.string	"stream_initSocket"
+.LASF2518:
+	.string	"callback"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2632:
+	.string	"dyad_realloc"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1888:
+	.string	"SIGKILL 9"
+.LASF1474:
+	.string	"INET_ADDRSTRLEN 16"
+.LASF1191:
+	.string	"AF_KCM PF_KCM"
+.LASF2461:
+	.string	"_mode"
+.LASF1008:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF632:
+	.string	"STDIN_FILENO 0"
+.LASF523:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF556:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF623:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF2438:
+	.string	"_IO_write_base"
+.LASF2476:
+	.string	"bytesSent"
+.LASF1852:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF853:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF2505:
+	.string	"DYAD_STATE_CLOSED"
+.LASF1639:
+	.string	"S_IFLNK __S_IFLNK"
+.LASF1366:
+	.string	"IPV6_XFRM_POLICY 35"
+.LASF1802:
+	.string	"_BITS_STDIO_H 1"
+.LASF1956:
+	.string	"SI_MESGQ SI_MESGQ"
+.LASF1794:
+	.string	"__f32(x) x ##f32"
+.LASF2588:
+	.string	"func"
+.LASF2149:
+	.string	"ETIMEDOUT 110"
+.LASF2019:
+	.string	"SA_NOCLDSTOP 1"
+.LASF657:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF813:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF732:
+	.string	"SEEK_CUR 1"
+.LASF1410:
+	.string	"IPPROTO_IGMP IPPROTO_IGMP"
+.LASF2500:
+	.string	"DYAD_EVENT_DATA"
+.LASF2561:
+	.string	"dyad_getPort"
+.LASF2122:
+	.string	"ELIBEXEC 83"
+.LASF656:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2351:
+	.string	"SOCK_RDM"
+.LASF2267:
+	.string	"BC_STRING_MAX _POSIX2_BC_STRING_MAX"
+.LASF1127:
+	.string	"PF_IB 27"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF918:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1363:
+	.string	"IPV6_ROUTER_ALERT_ISOLATE 30"
+.LASF2150:
+	.string	"ECONNREFUSED 111"
+.LASF1929:
+	.string	"si_pid _sifields._kill.si_pid"
+.LASF527:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF955:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF1418:
+	.string	"IPPROTO_DCCP IPPROTO_DCCP"
+.LASF1928:
+	.string	"__SI_SIGFAULT_ADDL "
+.LASF468:
+	.string	"__ptr_t void *"
+.LASF1767:
+	.string	"FOPEN_MAX 16"
+.LASF2555:
+	.string	"close"
+.LASF2517:
+	.string	"event"
+.LASF646:
+	.string	"__SLONG32_TYPE int"
+.LASF1704:
+	.string	"TCP_NOTSENT_LOWAT 25"
+.LASF1548:
+	.string	"O_TRUNC 01000"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1437:
+	.string	"IPPROTO_FRAGMENT IPPROTO_FRAGMENT"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1083:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1361:
+	.string	"IPV6_LEAVE_ANYCAST 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1804:
+	.string	"__STDIO_INLINE"
+.LASF1330:
+	.string	"IP_PMTUDISC_PROBE 3"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF825:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF892:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF1413:
+	.string	"IPPROTO_EGP IPPROTO_EGP"
+.LASF2354:
+	.string	"SOCK_PACKET"
+.LASF1752:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF752:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF996:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF1212:
+	.string	"SOL_PNPIPE 275"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2303:
+	.string	"ULONG_MAX"
+.LASF2580:
+	.string	"dyad_end"
+.LASF1648:
+	.string	"S_IWGRP (S_IWUSR >> 3)"
+.LASF848:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1721:
+	.string	"_ARPA_INET_H 1"
+.LASF2464:
+	.string	"_IO_marker"
+.LASF903:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF1194:
+	.string	"AF_XDP PF_XDP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1768:
+	.string	"stdin stdin"
+.LASF1354:
+	.string	"IPV6_LEAVE_GROUP 21"
+.LASF1953:
+	.string	"SI_TKILL SI_TKILL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1402:
+	.string	"IPV6_PMTUDISC_OMIT 5"
+.LASF1638:
+	.string	"S_IFIFO __S_IFIFO"
+.LASF2522:
+	.string	"dyad_streams"
+.LASF1069:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1251:
+	.string	"MSG_CMSG_CLOEXEC MSG_CMSG_CLOEXEC"
+.LASF2422:
+	.string	"timeval"
+.LASF465:
+	.string	"__PMT(args) args"
+.LASF634:
+	.string	"STDERR_FILENO 2"
+.LASF619:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF2317:
+	.string	"vec_clear(v) ((v)->length = 0)"
+.LASF389:
+	.string	"SITL 1"
+.LASF1287:
+	.string	"IP_OPTIONS 4"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1264:
+	.string	"SO_BROADCAST 6"
+.LASF1766:
+	.string	"FOPEN_MAX"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2020:
+	.string	"SA_NOCLDWAIT 2"
+.LASF1920:
+	.string	"__SI_MAX_SIZE 128"
+.LASF1720:
+	.string	"TCP_REPAIR_OFF_NO_WP -1"
+.LASF834:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF1536:
+	.string	"_FCNTL_H 1"
+.LASF838:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF1520:
+	.string	"AI_NUMERICSERV 0x0400"
+.LASF1605:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1284:
+	.string	"__SOCKADDR_ARG struct sockaddr *__restrict"
+.LASF1857:
+	.string	"EXIT_SUCCESS 0"
+.LASF708:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1490:
+	.string	"ntohl(x) __bswap_32 (x)"
+.LASF2215:
+	.string	"__undef_OPEN_MAX "
+.LASF2426:
+	.string	"__fds_bits"
+.LASF2004:
+	.string	"POLL_PRI POLL_PRI"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF701:
+	.string	"_SIZE_T "
+.LASF1168:
+	.string	"AF_ASH PF_ASH"
+.LASF579:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF2246:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2262:
+	.string	"_POSIX2_RE_DUP_MAX 255"
+.LASF1389:
+	.string	"IPV6_TRANSPARENT 75"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2201:
+	.string	"_POSIX_RTSIG_MAX 8"
+.LASF453:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1883:
+	.string	"SIGSEGV 11"
+.LASF471:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF970:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF1553:
+	.string	"O_FSYNC O_SYNC"
+.LASF1671:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF2366:
+	.string	"in_addr"
+.LASF2352:
+	.string	"SOCK_SEQPACKET"
+.LASF1760:
+	.string	"EOF (-1)"
+.LASF2292:
+	.string	"USHRT_MAX (SHRT_MAX * 2 + 1)"
+.LASF705:
+	.string	"__SIZE_T "
+.LASF962:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF2003:
+	.string	"POLL_ERR POLL_ERR"
+.LASF2025:
+	.string	"SIG_BLOCK 0"
+.LASF2465:
+	.string	"_IO_codecvt"
+.LASF1918:
+	.string	"__siginfo_t_defined 1"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2496:
+	.string	"DYAD_EVENT_LISTEN"
+.LASF929:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF1798:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2248:
+	.string	"TTY_NAME_MAX 32"
+.LASF1094:
+	.string	"SOCK_PACKET SOCK_PACKET"
+.LASF2278:
+	.string	"SCHAR_MIN (-SCHAR_MAX - 1)"
+.LASF2193:
+	.string	"_POSIX_MQ_OPEN_MAX 8"
+.LASF1572:
+	.string	"F_GETFD 1"
+.LASF1753:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF2627:
+	.string	"vec_splice"
+.LASF1576:
+	.string	"__F_SETOWN 8"
+.LASF667:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF683:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1919:
+	.string	"____sigval_t_defined "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1468:
+	.string	"INADDR_ALLRTRS_GROUP ((in_addr_t) 0xe0000002)"
+.LASF1472:
+	.string	"IN6ADDR_ANY_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } } }"
+.LASF1620:
+	.string	"__S_IFLNK 0120000"
+.LASF950:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF750:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1799:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF575:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF1626:
+	.string	"__S_ISGID 02000"
+.LASF841:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF852:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF2427:
+	.string	"fd_set"
+.LASF433:
+	.string	"__USE_POSIX2 1"
+.LASF617:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF1821:
+	.string	"__DEFINED_wchar_t "
+.LASF1894:
+	.string	"_BITS_SIGNUM_ARCH_H 1"
+.LASF1290:
+	.string	"IP_TTL 2"
+.LASF2136:
+	.string	"EAFNOSUPPORT 97"
+.LASF477:
+	.string	"__flexarr []"
+.LASF1801:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF483:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF635:
+	.string	"_BITS_TYPES_H 1"
+.LASF1236:
+	.string	"MSG_TRUNC MSG_TRUNC"
+.LASF1216:
+	.string	"SOL_ALG 279"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1859:
+	.string	"__COMPAR_FN_T "
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1229:
+	.string	"__ss_aligntype unsigned long int"
+.LASF479:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1967:
+	.string	"ILL_COPROC ILL_COPROC"
+.LASF1665:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2387:
+	.string	"IPPROTO_PIM"
+.LASF2033:
+	.string	"_BITS_SIGTHREAD_H 1"
+.LASF845:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1642:
+	.string	"S_ISGID __S_ISGID"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2297:
+	.string	"UINT_MAX"
+.LASF1887:
+	.string	"SIGTRAP 5"
+.LASF1839:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF543:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF1353:
+	.string	"IPV6_JOIN_GROUP 20"
+.LASF1995:
+	.string	"CLD_KILLED CLD_KILLED"
+.LASF1855:
+	.string	"RAND_MAX 2147483647"
+.LASF1515:
+	.string	"AI_CANONNAME 0x0002"
+.LASF1828:
+	.string	"WEXITED 4"
+.LASF608:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF1241:
+	.string	"MSG_SYN MSG_SYN"
+.LASF1018:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF2584:
+	.string	"dyad_addListener"
+.LASF869:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF999:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF1197:
+	.string	"SOL_RAW 255"
+.LASF2593:
+	.string	"dyad_getVersion"
+.LASF1148:
+	.string	"AF_LOCAL PF_LOCAL"
+.LASF744:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF2642:
+	.string	"__errno_location"
+.LASF792:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF549:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF966:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF585:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF803:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF2305:
+	.string	"LLONG_MIN"
+.LASF748:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF789:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF2338:
+	.string	"char"
+.LASF1070:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1575:
+	.string	"F_SETFL 4"
+.LASF1121:
+	.string	"PF_RDS 21"
+.LASF1634:
+	.string	"S_IFDIR __S_IFDIR"
+.LASF988:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF2527:
+	.string	"dyad_updateTimeout"
+.LASF2383:
+	.string	"IPPROTO_AH"
+.LASF658:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2412:
+	.string	"sin6_scope_id"
+.LASF1963:
+	.string	"ILL_ILLADR ILL_ILLADR"
+.LASF1126:
+	.string	"PF_LLC 26"
+.LASF808:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF2229:
+	.string	"XATTR_LIST_MAX 65536"
+.LASF1787:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2415:
+	.string	"ai_family"
+.LASF2405:
+	.string	"sin_addr"
+.LASF1731:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF963:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF828:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF2143:
+	.string	"ECONNRESET 104"
+.LASF1882:
+	.string	"SIGFPE 8"
+.LASF499:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF636:
+	.string	"__S16_TYPE short int"
+.LASF1444:
+	.string	"IN_CLASSA_NSHIFT 24"
+.LASF859:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF1741:
+	.string	"__GNUC_VA_LIST "
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF680:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1826:
+	.string	"WUNTRACED 2"
+.LASF1368:
+	.string	"IPV6_RECVPKTINFO 49"
+.LASF2441:
+	.string	"_IO_buf_base"
+.LASF2560:
+	.string	"dyad_getBytesSent"
+.LASF395:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF496:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1249:
+	.string	"MSG_ZEROCOPY MSG_ZEROCOPY"
+.LASF2631:
+	.string	"dyad_free"
+.LASF1358:
+	.string	"IPV6_RECVERR 25"
+.LASF1042:
+	.string	"_NETDB_H 1"
+.LASF2088:
+	.string	"EUNATCH 49"
+.LASF2551:
+	.string	"realloc"
+.LASF1257:
+	.string	"CMSG_LEN(len) (CMSG_ALIGN (sizeof (struct cmsghdr)) + (len))"
+.LASF1901:
+	.string	"SIGTSTP 20"
+.LASF880:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1013:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF503:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF610:
+	.string	"_POSIX_IPV6 200809L"
+.LASF1895:
+	.string	"SIGSTKFLT 16"
+.LASF1025:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF638:
+	.string	"__S32_TYPE int"
+.LASF1215:
+	.string	"SOL_CAIF 278"
+.LASF670:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF709:
+	.string	"_SIZE_T_DEFINED "
+.LASF1504:
+	.string	"IN6_IS_ADDR_MC_SITELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x5))"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2309:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)"
+.LASF2075:
+	.string	"ENAMETOOLONG 36"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1456:
+	.string	"IN_CLASSD(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xe0000000)"
+.LASF1430:
+	.string	"IPPROTO_UDPLITE IPPROTO_UDPLITE"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF695:
+	.string	"__STD_TYPE"
+.LASF860:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF928:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF978:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1523:
+	.string	"EAI_AGAIN -3"
+.LASF1945:
+	.string	"si_fd _sifields._sigpoll.si_fd"
+.LASF1847:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF653:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF647:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1782:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2433:
+	.string	"_IO_FILE"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1416:
+	.string	"IPPROTO_IDP IPPROTO_IDP"
+.LASF698:
+	.string	"__need_NULL "
+.LASF1579:
+	.string	"F_GETOWN __F_GETOWN"
+.LASF661:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2171:
+	.string	"ERFKILL 132"
+.LASF1026:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF1702:
+	.string	"TCP_FASTOPEN 23"
+.LASF1093:
+	.string	"SOCK_DCCP SOCK_DCCP"
+.LASF2173:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF1506:
+	.string	"IN6_IS_ADDR_MC_GLOBAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0xe))"
+.LASF577:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF1450:
+	.string	"IN_CLASSB_HOST (0xffffffff & ~IN_CLASSB_NET)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF886:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF2321:
+	.string	"DYAD_FLAG_READY (1 << 0)"
+.LASF2398:
+	.string	"__u6_addr16"
+.LASF1800:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1590:
+	.string	"F_SHLCK 8"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF773:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF719:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2065:
+	.string	"ETXTBSY 26"
+.LASF2010:
+	.string	"sigev_notify_attributes _sigev_un._sigev_thread._attribute"
+.LASF1791:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2184:
+	.string	"_POSIX_AIO_MAX 1"
+.LASF697:
+	.string	"__need_size_t "
+.LASF1886:
+	.string	"SIGQUIT 3"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1201:
+	.string	"SOL_ATM 264"
+.LASF1213:
+	.string	"SOL_RDS 276"
+.LASF1084:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF620:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF1007:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF906:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF2037:
+	.string	"_BITS_ERRNO_H 1"
+.LASF2251:
+	.string	"MQ_PRIO_MAX 32768"
+.LASF863:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2054:
+	.string	"ENOTBLK 15"
+.LASF798:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF1735:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2055:
+	.string	"EBUSY 16"
+.LASF902:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF2282:
+	.string	"UCHAR_MAX (SCHAR_MAX * 2 + 1)"
+.LASF1292:
+	.string	"IP_RECVRETOPTS IP_RETOPTS"
+.LASF760:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF1663:
+	.string	"__sigset_t_defined 1"
+.LASF994:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF1898:
+	.string	"SIGSYS 31"
+.LASF519:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2607:
+	.string	"stream_setSocket"
+.LASF2214:
+	.string	"__undef_LINK_MAX "
+.LASF1296:
+	.string	"IP_MULTICAST_LOOP 34"
+.LASF504:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2393:
+	.string	"IPPROTO_RAW"
+.LASF1823:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1551:
+	.string	"O_NDELAY O_NONBLOCK"
+.LASF1187:
+	.string	"AF_CAIF PF_CAIF"
+.LASF2597:
+	.string	"connectFailed"
+.LASF2114:
+	.string	"EOVERFLOW 75"
+.LASF1079:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1141:
+	.string	"PF_KCM 41"
+.LASF1246:
+	.string	"MSG_MORE MSG_MORE"
+.LASF1198:
+	.string	"SOL_DECNET 261"
+.LASF2622:
+	.string	"select_add"
+.LASF964:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF827:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2490:
+	.string	"dyad_Event"
+.LASF2064:
+	.string	"ENOTTY 25"
+.LASF1192:
+	.string	"AF_QIPCRTR PF_QIPCRTR"
+.LASF2169:
+	.string	"EOWNERDEAD 130"
+.LASF1891:
+	.string	"SIGIO SIGPOLL"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF377:
+	.string	"__linux 1"
+.LASF1495:
+	.string	"IN6_IS_ADDR_LOOPBACK(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == htonl (1); }))"
+.LASF1989:
+	.string	"BUS_ADRALN BUS_ADRALN"
+.LASF452:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2093:
+	.string	"EXFULL 54"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1315:
+	.string	"IP_XFRM_POLICY 17"
+.LASF530:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF532:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1130:
+	.string	"PF_TIPC 30"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1053:
+	.string	"__id_t_defined "
+.LASF2095:
+	.string	"EBADRQC 56"
+.LASF2156:
+	.string	"EUCLEAN 117"
+.LASF1587:
+	.string	"F_WRLCK 1"
+.LASF901:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF1031:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF1458:
+	.string	"IN_EXPERIMENTAL(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xe0000000)"
+.LASF2399:
+	.string	"__u6_addr32"
+.LASF1244:
+	.string	"MSG_ERRQUEUE MSG_ERRQUEUE"
+.LASF2023:
+	.string	"SA_NODEFER 0x40000000"
+.LASF2614:
+	.string	"stream_destroy"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1117:
+	.string	"PF_PACKET 17"
+.LASF2050:
+	.string	"EAGAIN 11"
+.LASF914:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF1333:
+	.string	"IP_UNICAST_IF 50"
+.LASF1954:
+	.string	"SI_SIGIO SI_SIGIO"
+.LASF1081:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1091:
+	.string	"SOCK_RDM SOCK_RDM"
+.LASF923:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF2533:
+	.string	"listen"
+.LASF2053:
+	.string	"EFAULT 14"
+.LASF505:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2086:
+	.string	"EL3RST 47"
+.LASF2538:
+	.string	"send"
+.LASF2315:
+	.string	"vec_init(v) memset((v), 0, sizeof(*(v)))"
+.LASF571:
+	.string	"_XOPEN_REALTIME 1"
+.LASF850:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF2446:
+	.string	"_markers"
+.LASF1832:
+	.string	"__WALL 0x40000000"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF924:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF1616:
+	.string	"__S_IFCHR 0020000"
+.LASF472:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2562:
+	.string	"dyad_getAddress"
+.LASF1482:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1934:
+	.string	"si_utime _sifields._sigchld.si_utime"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF874:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1100:
+	.string	"PF_FILE PF_LOCAL"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1208:
+	.string	"SOL_TIPC 271"
+.LASF607:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF1808:
+	.string	"_WCHAR_T "
+.LASF965:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF2302:
+	.string	"LONG_MAX __LONG_MAX__"
+.LASF2456:
+	.string	"_codecvt"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1545:
+	.string	"O_CREAT 0100"
+.LASF1608:
+	.string	"st_atime st_atim.tv_sec"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2550:
+	.string	"vsprintf"
+.LASF1539:
+	.string	"F_SETLK64 6"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF629:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF1770:
+	.string	"stderr stderr"
+.LASF2605:
+	.string	"domain"
+.LASF1905:
+	.string	"SIGTTOU 22"
+.LASF2594:
+	.string	"dyad_shutdown"
+.LASF1048:
+	.string	"_SYS_TYPES_H 1"
+.LASF1221:
+	.string	"SOL_MPTCP 284"
+.LASF832:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF2166:
+	.string	"EKEYEXPIRED 127"
+.LASF2625:
+	.string	"oldCapacity"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1708:
+	.string	"TCP_REPAIR_WINDOW 29"
+.LASF835:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF2289:
+	.string	"SHRT_MAX"
+.LASF668:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1803:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF1862:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1480:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2204:
+	.string	"_POSIX_SIGQUEUE_MAX 32"
+.LASF1027:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1396:
+	.string	"IPV6_RXDSTOPTS IPV6_DSTOPTS"
+.LASF1395:
+	.string	"IPV6_RXHOPOPTS IPV6_HOPOPTS"
+.LASF566:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF2310:
+	.string	"DYAD_H "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2340:
+	.string	"ssize_t"
+.LASF630:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF1592:
+	.string	"__POSIX_FADV_NOREUSE 5"
+.LASF678:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2249:
+	.string	"LOGIN_NAME_MAX 256"
+.LASF1299:
+	.string	"IP_UNBLOCK_SOURCE 37"
+.LASF1478:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1401:
+	.string	"IPV6_PMTUDISC_INTERFACE 4"
+.LASF1494:
+	.string	"IN6_IS_ADDR_UNSPECIFIED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == 0; }))"
+.LASF2568:
+	.string	"args"
+.LASF2414:
+	.string	"ai_flags"
+.LASF2256:
+	.string	"_POSIX2_BC_DIM_MAX 2048"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1627:
+	.string	"__S_ISVTX 01000"
+.LASF1813:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1463:
+	.string	"INADDR_DUMMY ((in_addr_t) 0xc0000008)"
+.LASF1772:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1854:
+	.string	"__lldiv_t_defined 1"
+.LASF1742:
+	.string	"_____fpos_t_defined 1"
+.LASF2224:
+	.string	"NAME_MAX 255"
+.LASF2188:
+	.string	"_POSIX_HOST_NAME_MAX 255"
+.LASF2274:
+	.string	"_LIMITS_H___ "
+.LASF491:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1968:
+	.string	"ILL_BADSTK ILL_BADSTK"
+.LASF2239:
+	.string	"_POSIX_THREAD_KEYS_MAX 128"
+.LASF1248:
+	.string	"MSG_BATCH MSG_BATCH"
+.LASF921:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1074:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1635:
+	.string	"S_IFCHR __S_IFCHR"
+.LASF2519:
+	.string	"Listener"
+.LASF1622:
+	.string	"__S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1885:
+	.string	"SIGHUP 1"
+.LASF582:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1064:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2331:
+	.string	"__uint32_t"
+.LASF2549:
+	.string	"printf"
+.LASF2205:
+	.string	"_POSIX_SSIZE_MAX 32767"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1543:
+	.string	"O_WRONLY 01"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF2174:
+	.string	"errno (*__errno_location ())"
+.LASF2126:
+	.string	"EUSERS 87"
+.LASF681:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1650:
+	.string	"S_IRWXG (S_IRWXU >> 3)"
+.LASF2416:
+	.string	"ai_socktype"
+.LASF782:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF2390:
+	.string	"IPPROTO_UDPLITE"
+.LASF2355:
+	.string	"SOCK_CLOEXEC"
+.LASF1288:
+	.string	"IP_HDRINCL 3"
+.LASF2117:
+	.string	"EREMCHG 78"
+.LASF884:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF1700:
+	.string	"TCP_QUEUE_SEQ 21"
+.LASF958:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF894:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF488:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1129:
+	.string	"PF_CAN 29"
+.LASF1106:
+	.string	"PF_BRIDGE 7"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1370:
+	.string	"IPV6_RECVHOPLIMIT 51"
+.LASF779:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF644:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1561:
+	.string	"__O_DSYNC 010000"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2285:
+	.string	"CHAR_MAX"
+.LASF1335:
+	.string	"IP_DEFAULT_MULTICAST_TTL 1"
+.LASF1625:
+	.string	"__S_ISUID 04000"
+.LASF917:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1969:
+	.string	"ILL_BADIADDR ILL_BADIADDR"
+.LASF1061:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF774:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF1484:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1810:
+	.string	"_T_WCHAR "
+.LASF715:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF2104:
+	.string	"ENOPKG 65"
+.LASF1200:
+	.string	"SOL_PACKET 263"
+.LASF1564:
+	.string	"F_SETLK F_SETLK64"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2062:
+	.string	"ENFILE 23"
+.LASF1696:
+	.string	"TCP_THIN_DUPACK 17"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1877:
+	.string	"SIG_DFL ((__sighandler_t) 0)"
+.LASF1698:
+	.string	"TCP_REPAIR 19"
+.LASF686:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF729:
+	.string	"X_OK 1"
+.LASF439:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2592:
+	.string	"dyad_getStreamCount"
+.LASF1271:
+	.string	"SO_RCVLOWAT 18"
+.LASF1757:
+	.string	"_IOLBF 1"
+.LASF1477:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1037:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1518:
+	.string	"AI_ALL 0x0010"
+.LASF2106:
+	.string	"ENOLINK 67"
+.LASF954:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1185:
+	.string	"AF_PHONET PF_PHONET"
+.LASF1500:
+	.ascii	"IN6_ARE_ADDR_EQUAL(a,b) (__extension__ ({ const struct in6_a"
+	.ascii	"ddr *__a = (const struct in6_addr *) (a); const struct in6_a"
+	.ascii	"ddr *__b = (const struct in6_addr *"
+	.string	") (b); __a->__in6_u.__u6_addr32[0] == __b->__in6_u.__u6_addr32[0] && __a->__in6_u.__u6_addr32[1] == __b->__in6_u.__u6_addr32[1] && __a->__in6_u.__u6_addr32[2] == __b->__in6_u.__u6_addr32[2] && __a->__in6_u.__u6_addr32[3] == __b->__in6_u.__u6_addr32[3]; }))"
+.LASF1582:
+	.string	"__F_SETOWN_EX 15"
+.LASF690:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2290:
+	.string	"SHRT_MAX __SHRT_MAX__"
+.LASF1068:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1364:
+	.string	"IPV6_RECVERR_RFC4884 31"
+.LASF1431:
+	.string	"IPPROTO_MPLS IPPROTO_MPLS"
+.LASF1420:
+	.string	"IPPROTO_RSVP IPPROTO_RSVP"
+.LASF1833:
+	.string	"__WCLONE 0x80000000"
+.LASF1932:
+	.string	"si_overrun _sifields._timer.si_overrun"
+.LASF1336:
+	.string	"IP_DEFAULT_MULTICAST_LOOP 1"
+.LASF766:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1908:
+	.string	"SIGXCPU 24"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2595:
+	.string	"dyad_init"
+.LASF1822:
+	.string	"_BSD_WCHAR_T_"
+.LASF1559:
+	.string	"__O_NOATIME 01000000"
+.LASF1329:
+	.string	"IP_PMTUDISC_DO 2"
+.LASF1142:
+	.string	"PF_QIPCRTR 42"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF2225:
+	.string	"PATH_MAX 4096"
+.LASF2056:
+	.string	"EEXIST 17"
+.LASF2295:
+	.string	"INT_MAX"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2130:
+	.string	"EPROTOTYPE 91"
+.LASF1102:
+	.string	"PF_AX25 3"
+.LASF818:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1462:
+	.string	"INADDR_NONE ((in_addr_t) 0xffffffff)"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1024:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF2634:
+	.string	"__bsx"
+.LASF1131:
+	.string	"PF_BLUETOOTH 31"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2421:
+	.string	"ai_next"
+.LASF1811:
+	.string	"__WCHAR_T "
+.LASF1419:
+	.string	"IPPROTO_IPV6 IPPROTO_IPV6"
+.LASF737:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF1040:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF2473:
+	.string	"sockfd"
+.LASF1304:
+	.string	"IP_ROUTER_ALERT 5"
+.LASF1836:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1583:
+	.string	"__F_GETOWN_EX 16"
+.LASF2408:
+	.string	"sin6_family"
+.LASF1717:
+	.string	"TCP_TX_DELAY 37"
+.LASF2459:
+	.string	"_freeres_buf"
+.LASF2396:
+	.string	"in_port_t"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1150:
+	.string	"AF_FILE PF_FILE"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF522:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1669:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF666:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1856:
+	.string	"EXIT_FAILURE 1"
+.LASF2423:
+	.string	"tv_sec"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1789:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2286:
+	.string	"CHAR_MAX SCHAR_MAX"
+.LASF1262:
+	.string	"SOL_SOCKET 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF583:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF2345:
+	.string	"long long unsigned int"
+.LASF1049:
+	.string	"__ino_t_defined "
+.LASF2546:
+	.string	"memmove"
+.LASF1937:
+	.string	"si_int _sifields._rt.si_sigval.sival_int"
+.LASF691:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1151:
+	.string	"AF_INET PF_INET"
+.LASF2480:
+	.string	"listeners"
+.LASF2451:
+	.string	"_cur_column"
+.LASF1217:
+	.string	"SOL_NFC 280"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1875:
+	.string	"_BITS_SIGNUM_GENERIC_H 1"
+.LASF557:
+	.string	"_XOPEN_LEGACY 1"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1972:
+	.string	"FPE_FLTDIV FPE_FLTDIV"
+.LASF2012:
+	.string	"SIGEV_SIGNAL SIGEV_SIGNAL"
+.LASF1532:
+	.string	"NI_NUMERICSERV 2"
+.LASF2334:
+	.string	"__off64_t"
+.LASF756:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2160:
+	.string	"EREMOTEIO 121"
+.LASF2018:
+	.string	"sa_sigaction __sigaction_handler.sa_sigaction"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF953:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF1952:
+	.string	"SI_DETHREAD SI_DETHREAD"
+.LASF1466:
+	.string	"INADDR_UNSPEC_GROUP ((in_addr_t) 0xe0000000)"
+.LASF2161:
+	.string	"EDQUOT 122"
+.LASF1734:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1403:
+	.string	"SOL_IPV6 41"
+.LASF2385:
+	.string	"IPPROTO_BEETPH"
+.LASF761:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1384:
+	.string	"IPV6_AUTOFLOWLABEL 70"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF469:
+	.string	"__BEGIN_DECLS "
+.LASF916:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF509:
+	.string	"__restrict_arr __restrict"
+.LASF1414:
+	.string	"IPPROTO_PUP IPPROTO_PUP"
+.LASF1407:
+	.string	"IPV6_RTHDR_TYPE_0 0"
+.LASF1030:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF1558:
+	.string	"__O_DIRECT 040000"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1773:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF570:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF1927:
+	.string	"__SI_HAVE_SIGSYS 1"
+.LASF1871:
+	.string	"_VA_LIST "
+.LASF1390:
+	.string	"IPV6_UNICAST_IF 76"
+.LASF2158:
+	.string	"ENAVAIL 119"
+.LASF704:
+	.string	"_T_SIZE "
+.LASF435:
+	.string	"__USE_POSIX199506 1"
+.LASF783:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF734:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF816:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2591:
+	.string	"dyad_getTime"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1452:
+	.string	"IN_CLASSC(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xc0000000)"
+.LASF1737:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF538:
+	.string	"__stub_revoke "
+.LASF679:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF510:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1492:
+	.string	"htonl(x) __bswap_32 (x)"
+.LASF542:
+	.string	"_POSIX_VERSION 200809L"
+.LASF926:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF1610:
+	.string	"st_ctime st_ctim.tv_sec"
+.LASF2374:
+	.string	"IPPROTO_PUP"
+.LASF1835:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF802:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF987:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF1382:
+	.string	"IPV6_RECVTCLASS 66"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF2044:
+	.string	"EIO 5"
+.LASF2504:
+	.string	"DYAD_EVENT_TICK"
+.LASF2444:
+	.string	"_IO_backup_base"
+.LASF437:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1848:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF476:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2435:
+	.string	"_IO_read_ptr"
+.LASF1728:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1243:
+	.string	"MSG_RST MSG_RST"
+.LASF2070:
+	.string	"EMLINK 31"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1693:
+	.string	"TCP_MD5SIG 14"
+.LASF1405:
+	.string	"IPV6_RTHDR_LOOSE 0"
+.LASF2170:
+	.string	"ENOTRECOVERABLE 131"
+.LASF1588:
+	.string	"F_UNLCK 2"
+.LASF1640:
+	.string	"S_IFSOCK __S_IFSOCK"
+.LASF2300:
+	.string	"LONG_MIN (-LONG_MAX - 1L)"
+.LASF1125:
+	.string	"PF_WANPIPE 25"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2636:
+	.string	"__socket_type"
+.LASF1547:
+	.string	"O_NOCTTY 0400"
+.LASF936:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2187:
+	.string	"_POSIX_DELAYTIMER_MAX 32"
+.LASF1872:
+	.string	"_VA_LIST_T_H "
+.LASF696:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF438:
+	.string	"_ATFILE_SOURCE"
+.LASF1870:
+	.string	"_VA_LIST_ "
+.LASF2458:
+	.string	"_freeres_list"
+.LASF1745:
+	.string	"____FILE_defined 1"
+.LASF531:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF447:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF868:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF1325:
+	.string	"IP_RECVFRAGSIZE 25"
+.LASF2392:
+	.string	"IPPROTO_ETHERNET"
+.LASF1178:
+	.string	"AF_MPLS PF_MPLS"
+.LASF763:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF2532:
+	.string	"socket"
+.LASF1502:
+	.string	"IN6_IS_ADDR_MC_NODELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x1))"
+.LASF1351:
+	.string	"IPV6_MULTICAST_HOPS 18"
+.LASF1706:
+	.string	"TCP_SAVE_SYN 27"
+.LASF948:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF1644:
+	.string	"S_IWUSR __S_IWRITE"
+.LASF2391:
+	.string	"IPPROTO_MPLS"
+.LASF1993:
+	.string	"BUS_MCEERR_AO BUS_MCEERR_AO"
+.LASF1161:
+	.string	"AF_DECnet PF_DECnet"
+.LASF1829:
+	.string	"WCONTINUED 8"
+.LASF1214:
+	.string	"SOL_IUCV 277"
+.LASF485:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1906:
+	.string	"SIGPOLL 29"
+.LASF1460:
+	.string	"INADDR_ANY ((in_addr_t) 0x00000000)"
+.LASF776:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF2319:
+	.string	"vec_splice(v,start,count) ( vec_splice(vec_unpack(v), start, count), (v)->length -= (count) )"
+.LASF594:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2277:
+	.string	"SCHAR_MIN"
+.LASF900:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF1508:
+	.string	"_PATH_HOSTS \"/etc/hosts\""
+.LASF1066:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1250:
+	.string	"MSG_FASTOPEN MSG_FASTOPEN"
+.LASF2574:
+	.string	"writeStr"
+.LASF609:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF2492:
+	.string	"dyad_PanicCallback"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1686:
+	.string	"TCP_SYNCNT 7"
+.LASF2450:
+	.string	"_old_offset"
+.LASF1260:
+	.string	"SCM_RIGHTS SCM_RIGHTS"
+.LASF989:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF1915:
+	.string	"__SIGRTMAX 64"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1881:
+	.string	"SIGABRT 6"
+.LASF581:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF512:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF682:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2059:
+	.string	"ENOTDIR 20"
+.LASF2189:
+	.string	"_POSIX_LINK_MAX 8"
+.LASF2283:
+	.string	"CHAR_MIN"
+.LASF1400:
+	.string	"IPV6_PMTUDISC_PROBE 3"
+.LASF1371:
+	.string	"IPV6_HOPLIMIT 52"
+.LASF1692:
+	.string	"TCP_CONGESTION 13"
+.LASF2333:
+	.string	"__off_t"
+.LASF1889:
+	.string	"SIGPIPE 13"
+.LASF2294:
+	.string	"INT_MIN (-INT_MAX - 1)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1165:
+	.string	"AF_NETLINK PF_NETLINK"
+.LASF1180:
+	.string	"AF_TIPC PF_TIPC"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1394:
+	.string	"IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP"
+.LASF449:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1512:
+	.string	"_PATH_SERVICES \"/etc/services\""
+.LASF2346:
+	.string	"long long int"
+.LASF2103:
+	.string	"ENONET 64"
+.LASF672:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF935:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF2475:
+	.string	"port"
+.LASF1537:
+	.string	"__O_LARGEFILE 0"
+.LASF1105:
+	.string	"PF_NETROM 6"
+.LASF2449:
+	.string	"_flags2"
+.LASF925:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF1818:
+	.string	"__INT_WCHAR_T_H "
+.LASF1021:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1660:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF1465:
+	.string	"INADDR_LOOPBACK ((in_addr_t) 0x7f000001)"
+.LASF1534:
+	.string	"NI_NAMEREQD 8"
+.LASF2151:
+	.string	"EHOSTDOWN 112"
+.LASF1846:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF888:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF1658:
+	.string	"_SYS_SELECT_H 1"
+.LASF602:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF1674:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF540:
+	.string	"__stub_sigreturn "
+.LASF2367:
+	.string	"s_addr"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF595:
+	.string	"_POSIX_CPUTIME 0"
+.LASF1751:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF712:
+	.string	"__DEFINED_size_t "
+.LASF2098:
+	.string	"EBFONT 59"
+.LASF1004:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF2481:
+	.string	"lineBuffer"
+.LASF1730:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF1321:
+	.string	"IP_MINTTL 21"
+.LASF1080:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1961:
+	.string	"ILL_ILLOPC ILL_ILLOPC"
+.LASF1637:
+	.string	"S_IFREG __S_IFREG"
+.LASF1951:
+	.string	"SI_ASYNCNL SI_ASYNCNL"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1312:
+	.string	"IP_MTU 14"
+.LASF1242:
+	.string	"MSG_CONFIRM MSG_CONFIRM"
+.LASF1219:
+	.string	"SOL_TLS 282"
+.LASF982:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF613:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF1554:
+	.string	"O_ASYNC 020000"
+.LASF493:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2113:
+	.string	"EBADMSG 74"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2011:
+	.string	"_BITS_SIGEVENT_CONSTS_H 1"
+.LASF1345:
+	.string	"IPV6_2292HOPLIMIT 8"
+.LASF1940:
+	.string	"si_addr_lsb _sifields._sigfault.si_addr_lsb"
+.LASF870:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF2407:
+	.string	"sockaddr_in6"
+.LASF2389:
+	.string	"IPPROTO_SCTP"
+.LASF1289:
+	.string	"IP_TOS 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1680:
+	.string	"TCP_NODELAY 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2190:
+	.string	"_POSIX_LOGIN_NAME_MAX 9"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF2535:
+	.string	"setsockopt"
+.LASF1936:
+	.string	"si_value _sifields._rt.si_sigval"
+.LASF971:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF546:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF2168:
+	.string	"EKEYREJECTED 129"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1609:
+	.string	"st_mtime st_mtim.tv_sec"
+.LASF2269:
+	.string	"EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF843:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF944:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF380:
+	.string	"__unix 1"
+.LASF515:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1000:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1775:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF986:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF772:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF1550:
+	.string	"O_NONBLOCK 04000"
+.LASF495:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF896:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF1756:
+	.string	"_IOFBF 0"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF2068:
+	.string	"ESPIPE 29"
+.LASF1732:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2124:
+	.string	"ERESTART 85"
+.LASF587:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1703:
+	.string	"TCP_TIMESTAMP 24"
+.LASF1359:
+	.string	"IPV6_V6ONLY 26"
+.LASF674:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2052:
+	.string	"EACCES 13"
+.LASF2381:
+	.string	"IPPROTO_GRE"
+.LASF862:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF1805:
+	.string	"__need_wchar_t "
+.LASF993:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1218:
+	.string	"SOL_KCM 281"
+.LASF2032:
+	.string	"__ctx"
+.LASF736:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1861:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2630:
+	.string	"vec_expand"
+.LASF671:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1621:
+	.string	"__S_IFSOCK 0140000"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF598:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2626:
+	.string	"select_deinit"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF742:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF2579:
+	.string	"optval"
+.LASF547:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF2368:
+	.string	"IPPROTO_IP"
+.LASF1355:
+	.string	"IPV6_ROUTER_ALERT 22"
+.LASF1469:
+	.string	"INADDR_ALLSNOOPERS_GROUP ((in_addr_t) 0xe000006a)"
+.LASF2570:
+	.string	"dyad_write"
+.LASF2096:
+	.string	"EBADSLT 57"
+.LASF625:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF1112:
+	.string	"PF_NETBEUI 13"
+.LASF1998:
+	.string	"CLD_STOPPED CLD_STOPPED"
+.LASF778:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF2507:
+	.string	"DYAD_STATE_CONNECTING"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1011:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF770:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF597:
+	.string	"_POSIX_REGEXP 1"
+.LASF2293:
+	.string	"INT_MIN"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2372:
+	.string	"IPPROTO_TCP"
+.LASF2002:
+	.string	"POLL_MSG POLL_MSG"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF984:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF2071:
+	.string	"EPIPE 32"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF700:
+	.string	"__SIZE_T__ "
+.LASF820:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF589:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF2185:
+	.string	"_POSIX_ARG_MAX 4096"
+.LASF1164:
+	.string	"AF_KEY PF_KEY"
+.LASF1516:
+	.string	"AI_NUMERICHOST 0x0004"
+.LASF711:
+	.string	"_SIZE_T_DECLARED "
+.LASF660:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1902:
+	.string	"SIGCONT 18"
+.LASF895:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF1443:
+	.string	"IN_CLASSA_NET 0xff000000"
+.LASF475:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF467:
+	.string	"__STRING(x) #x"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1909:
+	.string	"SIGVTALRM 26"
+.LASF2587:
+	.string	"dyad_atPanic"
+.LASF1511:
+	.string	"_PATH_PROTOCOLS \"/etc/protocols\""
+.LASF968:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2231:
+	.string	"NR_OPEN"
+.LASF1556:
+	.string	"__O_NOFOLLOW 0400000"
+.LASF578:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF2512:
+	.string	"SELECT_EXCEPT"
+.LASF2325:
+	.string	"unsigned int"
+.LASF2153:
+	.string	"EALREADY 114"
+.LASF1513:
+	.string	"IPPORT_RESERVED 1024"
+.LASF1009:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF1406:
+	.string	"IPV6_RTHDR_STRICT 1"
+.LASF1884:
+	.string	"SIGTERM 15"
+.LASF1682:
+	.string	"TCP_CORK 3"
+.LASF1631:
+	.string	"UTIME_NOW ((1l << 30) - 1l)"
+.LASF1152:
+	.string	"AF_AX25 PF_AX25"
+.LASF2100:
+	.string	"ENODATA 61"
+.LASF2022:
+	.string	"SA_RESTART 0x10000000"
+.LASF2005:
+	.string	"POLL_HUP POLL_HUP"
+.LASF1146:
+	.string	"PF_MAX 46"
+.LASF2486:
+	.string	"stream"
+.LASF1002:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1776:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1614:
+	.string	"__S_IFMT 0170000"
+.LASF1736:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2523:
+	.string	"dyad_streamCount"
+.LASF498:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1398:
+	.string	"IPV6_PMTUDISC_WANT 1"
+.LASF1483:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF2208:
+	.string	"_POSIX_SYMLOOP_MAX 8"
+.LASF1530:
+	.string	"EAI_OVERFLOW -12"
+.LASF1519:
+	.string	"AI_ADDRCONFIG 0x0020"
+.LASF1228:
+	.string	"_SS_SIZE 128"
+.LASF2563:
+	.string	"dyad_getState"
+.LASF2027:
+	.string	"SIG_SETMASK 2"
+.LASF2194:
+	.string	"_POSIX_MQ_PRIO_MAX 32"
+.LASF652:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF451:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF2213:
+	.string	"__undef_NR_OPEN "
+.LASF520:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF614:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF1563:
+	.string	"F_GETLK F_GETLK64"
+.LASF2328:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1943:
+	.string	"si_pkey _sifields._sigfault._bounds._pkey"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1524:
+	.string	"EAI_FAIL -4"
+.LASF839:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1994:
+	.string	"CLD_EXITED CLD_EXITED"
+.LASF1950:
+	.string	"__SI_ASYNCIO_AFTER_SIGIO 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF867:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF2452:
+	.string	"_vtable_offset"
+.LASF2413:
+	.string	"addrinfo"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1174:
+	.string	"AF_PPPOX PF_PPPOX"
+.LASF1098:
+	.string	"PF_LOCAL 1"
+.LASF648:
+	.string	"__S64_TYPE long int"
+.LASF961:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF2577:
+	.string	"dyad_listenEx"
+.LASF2369:
+	.string	"IPPROTO_ICMP"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2600:
+	.string	"stream_handleReceivedData"
+.LASF1957:
+	.string	"SI_TIMER SI_TIMER"
+.LASF1374:
+	.string	"IPV6_RTHDRDSTOPTS 55"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1555:
+	.string	"__O_DIRECTORY 0200000"
+.LASF1263:
+	.string	"SO_ACCEPTCONN 30"
+.LASF769:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF2316:
+	.string	"vec_deinit(v) dyad_free((v)->data)"
+.LASF1948:
+	.string	"si_arch _sifields._sigsys._arch"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1688:
+	.string	"TCP_DEFER_ACCEPT 9"
+.LASF2226:
+	.string	"PIPE_BUF 4096"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1900:
+	.string	"SIGSTOP 19"
+.LASF1233:
+	.string	"MSG_DONTROUTE MSG_DONTROUTE"
+.LASF2146:
+	.string	"ENOTCONN 107"
+.LASF1921:
+	.string	"__SI_PAD_SIZE ((__SI_MAX_SIZE / sizeof (int)) - 4)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1391:
+	.string	"IPV6_RECVFRAGSIZE 77"
+.LASF1176:
+	.string	"AF_LLC PF_LLC"
+.LASF995:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1258:
+	.string	"__CMSG_PADDING(len) ((sizeof (size_t) - ((len) & (sizeof (size_t) - 1))) & (sizeof (size_t) - 1))"
+.LASF1632:
+	.string	"UTIME_OMIT ((1l << 30) - 2l)"
+.LASF431:
+	.string	"__USE_ISOC95 1"
+.LASF2155:
+	.string	"ESTALE 116"
+.LASF2472:
+	.string	"flags"
+.LASF1265:
+	.string	"SO_DONTROUTE 5"
+.LASF875:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2524:
+	.string	"dyad_panicMsgBuffer"
+.LASF1997:
+	.string	"CLD_TRAPPED CLD_TRAPPED"
+.LASF1725:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2409:
+	.string	"sin6_port"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1298:
+	.string	"IP_DROP_MEMBERSHIP 36"
+.LASF2081:
+	.string	"ENOMSG 42"
+.LASF1510:
+	.string	"_PATH_NSSWITCH_CONF \"/etc/nsswitch.conf\""
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2705:
+	.string	"thread-shared-types.h"
+.LASF2720:
+	.string	"tcp.h"
+.LASF2653:
+	.string	"/usr/include"
+.LASF2717:
+	.string	"struct_stat.h"
+.LASF2664:
+	.string	"select.h"
+.LASF2728:
+	.string	"floatn-common.h"
+.LASF2689:
+	.string	"stubs-64.h"
+.LASF2755:
+	.string	"pthread_stack_min.h"
+.LASF2650:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2722:
+	.string	"__fpos_t.h"
+.LASF2673:
+	.string	"time.h"
+.LASF2684:
+	.string	"wordsize.h"
+.LASF2714:
+	.string	"fcntl-linux.h"
+.LASF2676:
+	.string	"inet.h"
+.LASF2708:
+	.string	"struct_mutex.h"
+.LASF2704:
+	.string	"pthreadtypes.h"
+.LASF2694:
+	.string	"confname.h"
+.LASF2747:
+	.string	"sigthread.h"
+.LASF2691:
+	.string	"environments.h"
+.LASF2696:
+	.string	"getopt_core.h"
+.LASF2649:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2721:
+	.string	"libc-header-start.h"
+.LASF2702:
+	.string	"timer_t.h"
+.LASF2710:
+	.string	"socket-constants.h"
+.LASF2752:
+	.string	"posix1_lim.h"
+.LASF2654:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2723:
+	.string	"__mbstate_t.h"
+.LASF2679:
+	.string	"socket_type.h"
+.LASF2742:
+	.string	"sigevent_t.h"
+.LASF2647:
+	.string	"/usr/include/netinet"
+.LASF2700:
+	.string	"clockid_t.h"
+.LASF2656:
+	.string	"unistd.h"
+.LASF2746:
+	.string	"ucontext.h"
+.LASF2750:
+	.string	"limits.h"
+.LASF2681:
+	.string	"stdc-predef.h"
+.LASF2672:
+	.string	"dyad.c"
+.LASF2711:
+	.string	"endian.h"
+.LASF2671:
+	.string	"dyad.h"
+.LASF2718:
+	.string	"sigset_t.h"
+.LASF2682:
+	.string	"features.h"
+.LASF2668:
+	.string	"FILE.h"
+.LASF2736:
+	.string	"signum-arch.h"
+.LASF2693:
+	.string	"time64.h"
+.LASF2680:
+	.string	"errno.h"
+.LASF2753:
+	.string	"local_lim.h"
+.LASF2751:
+	.string	"syslimits.h"
+.LASF2646:
+	.string	"/usr/include/linux"
+.LASF2719:
+	.string	"__sigset_t.h"
+.LASF2683:
+	.string	"features-time64.h"
+.LASF2678:
+	.string	"byteswap.h"
+.LASF2688:
+	.string	"stubs.h"
+.LASF2666:
+	.string	"<built-in>"
+.LASF2729:
+	.string	"waitflags.h"
+.LASF0:
+	.string	"lib/main/dyad/dyad.c"
+.LASF2716:
+	.string	"stat.h"
+.LASF2745:
+	.string	"stack_t.h"
+.LASF2743:
+	.string	"sigevent-consts.h"
+.LASF2730:
+	.string	"waitstatus.h"
+.LASF2674:
+	.string	"fcntl.h"
+.LASF2685:
+	.string	"timesize.h"
+.LASF2737:
+	.string	"sig_atomic_t.h"
+.LASF2652:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2698:
+	.string	"struct_iovec.h"
+.LASF2701:
+	.string	"time_t.h"
+.LASF2657:
+	.string	"stddef.h"
+.LASF2740:
+	.string	"siginfo-arch.h"
+.LASF2727:
+	.string	"floatn.h"
+.LASF2644:
+	.string	"/usr/include/arpa"
+.LASF2643:
+	.string	"lib/main/dyad"
+.LASF2741:
+	.string	"siginfo-consts.h"
+.LASF2707:
+	.string	"atomic_wide_counter.h"
+.LASF2754:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2724:
+	.string	"__fpos64_t.h"
+.LASF2713:
+	.string	"uintn-identity.h"
+.LASF2749:
+	.string	"errno-base.h"
+.LASF2738:
+	.string	"siginfo_t.h"
+.LASF2659:
+	.string	"socket.h"
+.LASF2697:
+	.string	"unistd_ext.h"
+.LASF2748:
+	.string	"signal_ext.h"
+.LASF2712:
+	.string	"endianness.h"
+.LASF2658:
+	.string	"stdint-uintn.h"
+.LASF2756:
+	.string	"posix2_lim.h"
+.LASF2669:
+	.string	"stdio.h"
+.LASF2699:
+	.string	"clock_t.h"
+.LASF2667:
+	.string	"struct_FILE.h"
+.LASF2687:
+	.string	"long-double.h"
+.LASF2686:
+	.string	"cdefs.h"
+.LASF2665:
+	.string	"stdarg.h"
+.LASF2692:
+	.string	"typesizes.h"
+.LASF2645:
+	.string	"/usr/include/asm-generic"
+.LASF2690:
+	.string	"posix_opt.h"
+.LASF2660:
+	.string	"sockaddr.h"
+.LASF2733:
+	.string	"locale_t.h"
+.LASF2739:
+	.string	"__sigval_t.h"
+.LASF2744:
+	.string	"sigaction.h"
+.LASF2661:
+	.string	"in.h"
+.LASF2734:
+	.string	"__locale_t.h"
+.LASF2670:
+	.string	"signal.h"
+.LASF2732:
+	.string	"stdlib-float.h"
+.LASF2726:
+	.string	"stdio_lim.h"
+.LASF2677:
+	.string	"stdlib.h"
+.LASF2725:
+	.string	"__FILE.h"
+.LASF2715:
+	.string	"struct_timespec.h"
+.LASF2663:
+	.string	"struct_timeval.h"
+.LASF2703:
+	.string	"stdint-intn.h"
+.LASF2695:
+	.string	"getopt_posix.h"
+.LASF2735:
+	.string	"signum-generic.h"
+.LASF2662:
+	.string	"netdb.h"
+.LASF2655:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2709:
+	.string	"struct_rwlock.h"
+.LASF2731:
+	.string	"stdlib-bsearch.h"
+.LASF2675:
+	.string	"string.h"
+.LASF2706:
+	.string	"pthreadtypes-arch.h"
+.LASF2648:
+	.string	"/usr/include/x86_64-linux-gnu/asm"
+.LASF2651:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\006"
+	.text
+	.section	.gnu.lto_.icf.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\375\007%\036"
+	.string	"f\342\205L\260\022Vc\277\224\355 @\311\347d\322\035U?\006\030\322O\335*\204\230pJ\004\n\022\003\364\222\017\304\037{\367\333~\220\177@\177\320\177\320\177\320\177\320\263\251\252\252\252D\305M\3304\245\311\367\277\377\377\275\367\336\276\374{K\231\344\016e"
+	.string	"s"
+	.string	"z"
+	.ascii	"("
+	.string	"?\236T\365\272U\223\216*)R\365z5\223H\231#hi.\005s<\274\266\213=\373\263SEOB\247\372U\305<\262~F\246~\271\314\3100\352\214\206x9\306|\177\243:\227\337O\367\321\327\367\317o\375\222\364\206\2504\304\331\274\353\370\347\315\237\307\3277\257\237\377\343\227\227\255\277\242\246\225\022C\271\223\001\270\354#\212\341!\371\255hpn\373;\003;\364\"\312h\253\275\366\234\312\332#\241\244\312K;-\273wQ\332]\016x\306\210\224\244Z\031\313\271lfxD\320\366w\256\375Y\212a\344\252+S\321\021r\206\236X\352\306H\217\254}\253[\252\235\252\025\261\224\306gI\b\326\352\331g\263\313\036{\354&\030g\212\030\204\355\001\003\006jm\337\302\016\353\275^\002\266k0\251\202\264\266\024`\241p\252\230\240-\242S\003\364e\027\2608TD\220\257aj\315\020!\322\001\363\247yW\r\266\370"
+	.ascii	"\032\320\357\373^o8\013\"\227\024\223\262\207\2118@8\025X\257"
+	.ascii	">\034=\021\320\257+\252\035\250\001%\002\356\243\241\303\022"
+	.ascii	"@\237X\307\240\024\200\223\r\262\212r\321+q\226\211-\024\336"
+	.ascii	"\356\275~\277\2469\277+ ]i\342\030\207A\271\255\203\345D1e\276"
+	.ascii	"\376Q\241\025\212\022\027\260\361X\243\307B\224\217\326\260\202"
+	.ascii	"RO\222\205\302\365\215\026*\210\023\330\026\244\230\037\t\371"
+	.ascii	"<\221\001b\214\220]2XXU\020x\347\375Y\b\223\023\314\203\335w"
+	.ascii	"\273\273\327\351\256\373\311JD\242\t\351 _\347\236Ck'2\207\220"
+	.ascii	"H\003\334q\271\247\256t\360\261aPn\033;\200n\026\340\216\273"
+	.ascii	"\375\246I~{\253o\327\267=\200\326\250!\246\240d\306\244%I\273"
+	.ascii	"\001@\002\207f\252\330\001\022@\224%\306\224L\261\231!I\n\n\345"
+	.ascii	"\332\001\020\210\245\265\344\322.7\026[R\371\321\373T\257\273"
+	.ascii	"I\303|\326yS\347\264<,\376\326R\204i\261\330\221\346\231X\215"
+	.ascii	"F\022\350E\237/\220\025A;\211\230B\305\031*\n\201P\304\314`a"
+	.ascii	"R\2309\347;\3358\024\262\256B\344\200\227o\344\304\277\224\256"
+	.ascii	"\303}\317\251\031\377h\375M\365\257\356\204*\363I&c\325\310\316"
+	.ascii	"\305\240\225#\261k;"
+	.string	"S\221\027&\346mv\224\240\033\302e\303\276,Q\t#\363\201\217\210\247\275:\023\224\262\\\273a|T\200\314\035\007\366\240\351-\271HG\3076\235X\205\277\330#\316&\217\340\254\212$\262\026\304\235\027(4\013\303\200\334\361\366T#\005[\216\300\241\034\214\302\225~\252\202zIX\263\221E\270\354/\213\016\207R\022\312\246\227[\252,#\310p\214\326\0057\237]\346\351g\304\217K)`\\\223\235\n\304\374\350\376\367\357\264S\221\256~\006K\262\347m4{oz\301\330\316\277\330\325\226\275\201T\005=\206\244\236%8\325L\037Q\304H\267\262Eu\352s\005\252w4\021\217>u\334\375\273\230\221d\355D\354~\342E\236Z3\254\223{e?\263/\035v\352\251\324\310\244P\020&\017\345\034\365z\356\217o\304\273\210u\237\241;F*2\232\016\2148\264(\206\321'\306\314\356KU\362\331\002\354'\356\316\207"
+	.ascii	"_\257\356\354=\345\271Q\377\314\215\323\343\317##\213}\356\262"
+	.ascii	"\\w\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`>\004e\r"
+	.string	"\322L%\"\020U\223\016\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\005@\213\027\t?\360-\246\362\365\32604wwkd\313\235d,3\2114R\021\241\204\224q\326\316\202lb\017\322\217=::M\216n\220\321\345\353\246\361\221w\362\206+\003\343a\276\260\270bN\301'\270\222\210(\304\203Ci\221\312\006\206\312\013\265\256\360\224l\303\305\023Z\312\217@\362`\032L\346V@\343\315\255\217g\026\233\004\275\001\001\373s\316$\333\002\216\276"
+	.string	"d'D\362.\333\254z\252\356+\371i\234\250\246\200\220\250\241Q\244RPIs`\202!f\312\352\001\021 \035D\3169\021\232\026\206=\003\361\237\355\303\017\\?\361\376:\216|)\327I\330\371\356\026$o\027\365X;\001\222\221\037\032\371\367\214,\223*L\312\006\245d\266\316\2447cz\243\227\233*5E\037\335\3519\227\006\031\241c\234\031\261"
+	.string	"\260\3560\005\nT\315\361\001\270\324\331\026\020\327\315\263\233 \371\224\004\231G1&1\033\257\324\250\034`\346?\346a:\327\001U\224\013\376\303\312%\336\274\344T0\272\214\211\233\232\312\205\355I\2551l(`\020L\305[\271D\352\251T\317\231\307\325\005\311n\276|\rTN\360\177z@\201)z1\001\332\372\377\274"
+	.ascii	"\005#\355S\240d\267\314\261A\367Ps\335Z|gR\247\025\352\034\002"
+	.ascii	"\030\330\373\235\344\375\030P\302\336N\2774i\202\222\fT\016\325"
+	.ascii	"^4\022\323\310\f\222\251\2138\361\205a\342}\301\321\006\331\004"
+	.ascii	"\374\251\206\252Fc\201\3546\363V\250\365WwJ\024"
+	.text
+	.section	.gnu.lto_.inline.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\330\022\005;"
+	.string	"\272@\344\rHp\\N:_\214?[\246\202(X\rmun;{3\243\204\177\242Xx\331W\366\016\267\200,\033\2079\222\243\177W\246\253\355lBc2\241\305b\332L\350\264\220\317\251\260\370Y\253\2105i\265\265\215\024\261{K\231\002\272"
+	.string	"\312"
+	.string	"\321"
+	.string	"\177\021\255?\363y\251\225I\257,:\347\005\177\240\345\363O\254\375\"H\244\330\006\374\234<L\353\355\031h\355\255\261~\325\311\265\001\337\366m\211\375\303J\324\213\232\342\336\213\374\317\277\236\250\253\021\037{\356\215\216\213\200\357>L}\304\363?\326,\"gh\202L\2556\005n\013xk\177\3370\355\377\277:L\371\277\257\321\023[y\357\335\275\321wR\337{/\027[\353\336\353\373\217\375\304\006\227\032\"{\244za\363\217TU\260\n&'Q\243x\237\231j\2275\264$\f4\360\203\302\370\347\240\355\367R\247\321\365(\363\373\231j\027&\024\232\003\375sS3\325\302\314"
+	.string	"\375\026\276\263\026\315-\017Mm\225f\211\003\002\337\001\"\352\234Y\234\224+/=y\214E\323\253\331\303]<\314J\267\234\\\023\322\373\231\332-\353)\212\320\336\336z\"\265/2u\005\276\363a\372\263\266~\th\343\375="
+	.ascii	"\237k\377\352\217D\355\221\\\223\006D\377\325\251\277\300Q5\271"
+	.ascii	"\300\251\316\201H4\251\373\302\023\355\203\301\234\347\234\340"
+	.ascii	"\237\255\324\2757\300\201\347_\207\331\256X\006a\002\177c\003"
+	.ascii	"\t\023\222\005d\317\267\236\247\371\214\006\247\314\214\r\f\365"
+	.ascii	";OJ\027+s\216\b\224\236\222\2631q=\366\357+-SU|\356;z\233\204"
+	.ascii	"\276\330q\367\"s\214\235\336\213\314\272\367\372\354\220\367"
+	.ascii	"\"\207\336\343a\312\007Z\245V\252q\300|\201r\006l\254\312cPP"
+	.ascii	"A\261o\021"
+	.string	"\202z\200X\211\356R+\203Bb\033h;\033\263\034\"\321.\276jx\375\\\310X\225A\350\210~\243\244\213\r?\030<o\225\261\026\006\t\357@\357G1\253\021d\347\005\226j\357\004\370l\207\251\265O\252T9\252\224\361\212=6\006\005vt\313\227\357\333\"\035\251+\216\212\016\276P\030\274R\255\357\240\230\024\0377|\177\261\362p\221\004M\350\267S\326\363\234B\247\377\274\325\304\317\327c\223]a\212\235\355i?<\242\337\350\226ZV\242b\200\365\203'\332\316\221\353\277\353\371X\333\262T\221%h9\037\3733\200\363\314\233j\237\233\246\276B\343\314\230\240\337\251\3414\257\226\374\244\333D\027A\203\301\204\253^&\327\263\245\031\357\320\227C\334\006\245\006\016q\362(3\374\307\300}\036\251\336\355\302\177\266\360\237\n=2ff\352t\212\024\226Q\033\2519,^\246\265\200\301\305C\354\n\n?\312\265\352\336$"
+	.string	",SoeE]\245pL]\031\372\004\376\335<m\201\203fAzi&\350GEu-1|\215\204\364\350\257\347\253#tI\337\277T\331\304\232K>\364\317\344\270\230\027\303F\"X\024\205`O\274Ju\325\235A\377"
+	.string	"\335\271\031\325\024N\315V\017\310\223\325\003{\3134s\365$\274\203\027\033(4w\357\023\2017x\217\377\177\030c\367\357\216\304\352\244\026\2654\016S\242\265\214\324ya7\266b\300\327\331\361\211\006E\005\346$\347o\252VV\314\304\0249\365\016\031QpG\227[\020\201\316\250\24192#2\"\"\222$I\2061\221\004\004!\303\240\324\324\003\022"
+	.ascii	"D%\307\362\2342\310\314\214\004#\022DR\220\244\222\345\027\226"
+	.ascii	"\360\271\2778g-\246\272m7\256V\t\001#B)\270\362 a\204\235@x\237"
+	.ascii	"\211\331\0074\370\224n\261\310MB\242\221x\356\250O\376E\354q"
+	.ascii	"\37262\314J\243V"
+	.string	"\234\253GG\007\307\204\222Zk\001l\2335S\302\360\250\304E\201\t\364\270\2303\354W\266\227\f\002\t4Hz\004\275\005\325\032\352\206eu\323\t\306\004\3453\200N|\230\3122a\024\034q\022\221B\001\361\262\006\205>\0269\306\273a\325\335 \323\030\252X\330j/a\023\035\025n\275e\270\334\"\\\016\227\200\323\027\367\357\031\004\262\025y\341\340\243\336c\235\241hrp\245\304g\233E\231\031\013\036\030\251Y\312\26506\032\260R\322\037B\211\257\226\"h\332K\267\001\220\377H\234\360\323\275\204\243\211\327\rW\314\t\bWs\212\245\346\374\0017\020\373\016-z?\034\3442\352?\031\r\330>\300\037\027\320\t\371'\306\026\207-.\237\331\220M\024\201\205\247=\277x]A \203`D\256&\244\251\306Q\375\226\315\201\024\302wJZ\256\237h\001\340N\344o\204\0244\251\242j\241 [\350\325\200`H\271L"
+	.string	"\340\030\375) \025\355,|\"C\220,t\305\365s\265 7\237Q -\033G\341,Z\273\366)\033\2645\351\340\311d\001\261\025>\254\035E\220\232\2301\343\362E\204Qg\312 &K\371M\306\237L[\033}t#\363\232\342\332\366\274\311}\004%Z\337^\233\303\303\245+\267%A\224\223_O\247\214\375\024\216\214 \350\327\210\b\315@<\235\374\260\205\245\314\n\372\\\tZ\250\353\200\211\330\316\235L\005lec\004g\3525\034\302\267\236\330$;\303\r\360\033\227)\026\216\261\350Z\265X"
+	.string	"\221E\025\201\373\004;\212\265\2404\300.\302\007\221\361\022a\235\f\361LQ\033\254#&K\267n,\300\372L\272\303\001\213'\r\001\261?<\360N\231\277w\323;>\277A7K\260\250u\3621[*\266\272\230\002\310)\320\t\241q\340\256\311w<@\274Fu\006\b\"\314\343,\350i\256\342Cw\f\304Y\364\t\221`\253\003\220\325\353\374\2336\032\2445\332\377\370\333C\b\374\357\226l\320g T\035\252mx xNo\235\214\223\037\353\366r\312\t\333knT\370\220\025\374a\266\201\334\201la\376"
+	.string	"\353e\220\b\255"
+	.string	"\264<i,\204Y\f\364?}\216\222\036\343p\276''(\324\023\362\234OSk\241\240\265t\374\004\016h\222[M\231\345\325\036\025\326\006Q^\233\212n$\021\021^!\350\305\201z\"\222\354\242\310K\r\350I\267\206\221\233\017\275{?\320+\020pD\201\337\256V\226"
+	.ascii	"\t\310\353\274>\221\305:_&\324\002\221\263\334\214\353m\0021"
+	.ascii	"0+\201T\341\226T&\214c\346\222 5\201\"\305\326\336h_<\004\002"
+	.ascii	"\342\366kS';i\352\207\210\361\233\247\022\207jz\001\013YM%66"
+	.ascii	"\022j$\251Wc\255+\343\2363\020\377\377\344K\317\245H\217V\226"
+	.ascii	"^\021\345\253\220P<\315\261!\006\276\357\345\210\376\t:\333;"
+	.ascii	"A\030\305\023Dhd\020\212\311\210(\354\341Yj\232\355x\345p\260"
+	.ascii	"\207\247\234uk\"z\265\256\033{\354\265\nP1\nJ|\204\224\345t\360"
+	.ascii	"\264b?\222\311.\322B\025$\360\215,\342\211\254\271l\\ \204\021"
+	.ascii	"\301m\034}@lAs\301b\252\207\276~\352%Y\203\260\017\200c\034\230"
+	.ascii	"\376V~\256G\273\b\230jx\313_N\355\350\357\265\233*\301\253\302"
+	.ascii	"\n\305\003\306"
+	.text
+	.section	.gnu.lto_.jmpfuncs.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\322\033\3256"
+	.string	"\206y\273G\320\030'\035"
+	.string	"\245j\232d 9\001Yd\303\020\322\013\340\024\237\215\267\330J\262V\327\231\357~\371\202\340\213d\r\n\201\226\315\325\313!\276`\006\345\r`bl\377\251\247~1\266\245\2523\246\bx\355\356\336\215l\231d\224"
+	.string	"\245"
+	.string	"\260"
+	.string	"|\303_#\177\354\247\022\3438\2164\fCy\035T\354Q\311N\365\265\351\307\374\r\240\336\316&\fDN\313\027\371\211\274\357\016*V\225\314X\347\335\250~\377\363\206|\2362\373|\303\325{\276\2242\276\277\377\3451\373\f[\3752L5\337\303|\307h\232/\344\366\230Wq}P\361\252\227\336!\252\017\344\177\354\246\371\367\307\374\303\233f\375\033lZ\347\347T\337\304Y\363\315Z\366\225\377\353e\276\235\305\370Y\354\314\277Y\277\257\354+\3637\373\360Q0+\320\02087,\033\346Ten\320\013\356\253\030\365\177i\314\206\201\311\230QW o6;\325\227}\237\343\377\263\004|kP\361,Tr\262D`2=\371\235\274?\205\233\246\032\276\277A\305\017*\212\352\003Ac\320x)G\351`*\225\222\350\315bt\336O\003g\362\002\037\362&\027\307\274\212\r\245Ks$\377\221\3133\214"
+	.string	"\337\247\372f\315\247\276\003X\200\217\017\213cX\356<\313\356S\f\303\034\206m\342<<|:1\024#\326;\233\231\371\3151;\353>C\231MY\216\343[\276\324\276\251\276/}\203\376\313"
+	.ascii	"\001\326\003\277j\207@\006|\301B\005 \n\262Y\376?&\246\224\237"
+	.ascii	"&\260|`(\t\314\031\372\242\"\314$\032\2433\325\027CPO\253\305"
+	.ascii	"\\V\255Q\216F\034f\323\237\376f\351\244\240bkQI\272\202\212\r"
+	.ascii	"\205fy\353t\022\231\311\202\212M\244k\250$s\351\026;\246N\365"
+	.ascii	"\037\204g\247uV\020\270\246&\211\312\030\2356}\201\306\007\314"
+	.ascii	"\334\274\342\225\t\026\206\341\211\337\237x\225\235!\374K~\302"
+	.ascii	"\322e\311\237\344\272\240\342\251\250$\377\264\234\235\363b6"
+	.ascii	"\214y\345\306\220A\305+y\222O\276\225\007\220\207\315\240\342"
+	.ascii	"m\250\344\345\257\342-\274\305A+\f~\335P\265GD\335g\275\rGr'"
+	.ascii	"\304\275\274m\323*hE\034\330\270W\b\003\314u5,\202{q\026\374"
+	.ascii	"^D4\354\331#\317~(\346\272\027\350\262\034\327\271\352fi\030"
+	.ascii	"4\262.\227V\271\256v`\335,\321K\023\262a\320\216pu_\265\240f"
+	.ascii	"=W\005;\256nD$:W\215\365\272\242\352uB\025i\323\254W\277\027"
+	.ascii	"\003~\360\265\200xpr\352\327\372\351\341\301\221a\r\324\266\272"
+	.ascii	"\331\243\227uY/\2067\373uD\256\030F\362\272\"[T\205\272\n\222"
+	.ascii	"\350b\370\364\341T\013\256\027\247\031\325MC\332fx\263H\235\007"
+	.ascii	"~v\253\234\265!\352\247\r\325\"-\201\304\250QQ\205FDD$)HRj\f"
+	.ascii	"\321\004\2040\346\030\204\362\006\022\300\001I\210BQ\022\343"
+	.ascii	"\034C\314\0202\"2\022\210\210HA\212\222\244\003\276U\227\n\231"
+	.ascii	"P\307\347\360\313H\324\237\241\322\222F\375y\354\332\\\257\326"
+	.ascii	"\317p\224\355\215\362x\332[?6\377eL\377\261\377?\360sS\266\031"
+	.ascii	"\2261\272e\345\324\300\322?\271&XJ\354\260R4Yc\0018\220\355\301"
+	.ascii	"'\301\243\372\003\242\332\303\315\222\245\307\376\r\252\tI\314"
+	.ascii	"\207\202^\024\202"
+	.string	"0\301[\200\326\030\026\3411\022\323R\327\340t{\224\364\263\265}\360er\213\323W\256&\376\253\201\212\"W\026\3273k,H(h\214\315\341\360\322\255\002\276A\254\321d\324\364\273\256\352RS\300\013\345\377\233>|!/\301\313\244&\331\311\376E\361\312\305\365\303\242\002\350W\232\2148\267/\343E\231D\212\346k\340F:\213jC\001d\236@\234Ks\247\315Ac\004\300\254\276\f\337n\205\274\227\237\377\375\304\2423\2356q\375l\304\fCk\350w\311\216\004\256~\310\306\310\272\026\202\341g\t\345\300\357D\340\007\333pz\\\336\020\034*u\242S\234\241\327d$\321\020ocr\330\242\252\373*A\375\3101\364pS\364\bm5\352\037\234\024^C\025\337\375\330f\226\316\312)\321\365X\261ZS\310\206f\\\272!\261\177\243\fyu\217\t\030\026Sj\203\233\313\312>\247\352\247t\356\261vV\377#\367"
+	.ascii	"\005\004\321\215\007\2544\017\363 \013R\341\301\022\360\320\300"
+	.ascii	"\013\315\212R\303Y\205\205z`\232\222\337\\\322\354\236M\233}"
+	.ascii	"#Z\224\034\231\030\304(\001\267E\207\211sZJ=V_\321`\307\205\305"
+	.ascii	"\334\243\212.\021.\f\017m\025\254r\323\255\323\333\307N\022\300"
+	.ascii	"mA\341\224\2635\225\206\033>'\247\315Dzg\234\263%\240\216\267"
+	.ascii	"\312cm\210\n_\270\326cX\026]\365C\033\300\335\262>\004\307\323"
+	.ascii	"G\177X\270\245\245:\214nZWRf\022\346\243\260\217\275xN\004\346"
+	.ascii	"\026\254d\333\334i\236\007\360\301c\330\022\205\221\313\247\177"
+	.ascii	"+\255^"
+	.string	"\312\0072\264\036)\\\226F\277\307Z\0325i\347\\\246\n\273&h-\321\212\213\r\347\271\264\370\231\245\243!\377\237\214\251k\351\200TE#\ryJ\343\210\345\277\270F`\336\021\264\030\200\034(V\306\227\005\f\005\3563\311e\032%\220\032\3629\035m\3156\215f\274_G\036_\036\2166=$U\33183\017#!\0255\035\277\001\270c\204\265Q\257\227\321\261\222Uo\321\315\347\252wc\261\016\224/\341\374\3378\313\340\203\203\225\b\314\3574\013h\037a\005\373:\332\307\271\360\233\365z'\213\233\373,cF3\230R\257m?\2163\355\202\203h\200\340%,bx\321C\2672}\302\204\235\237\275\333E\037w\225\215J\370\021\346c\247\331\341\253\237\354\253\277\003\305\372\252\250\253\301_=\363\350\347Kj\036H 8AA\263P\005g\222m\204E\361Gz~\304\"\273\207\307<\314H\001\020\025\337\226\352K"
+	.string	"\370\210\030\025M\212\337#\337\212<1\206\350\005\321\213\354\005|k\002\241\370\200\365M\274SUb\364\3249v\214\377\031\332\024\330"
+	.ascii	"\007hH\270\201u\031\f\t\205\303O\343\257\222\031\362\213\305"
+	.ascii	"\371J\221]c\034,\276\331Fw2\302\362\342*\347\234T\200l\342\261"
+	.ascii	"\373\224>\260G\204A\031j\f\355\234\373B\252\205\333\374\fA\036"
+	.ascii	"J\330!F\214Y\002\216\020\361j\260S$z\371{\b\372I\344\372V\234"
+	.ascii	"1^6\310\201E#fI\264\323\035\305\223\335\230\244\203\tx\035*\020"
+	.ascii	"\033\257\202\200\263\210\002)\304c\336x\314\307\374)\243n\253"
+	.ascii	"\227jm\315"
+	.text
+	.section	.gnu.lto_.pureconst.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375 \241]\004"
+	.string	"\022\312!*0\351$\035\200\201\001\024#\0350T\320\350\302\300\300\300\300\300@\025\351\236u\207\037$\020\246)\221@\002\tM~\225~\212F\0027\205[\302\r\341vp3\270\025\354\b\356u\016\340\203\300\r\300\002\234+\254j\227\332\241\356\351\232n\351\222\356\350\212\316\320\t:?3x\316\316\013\034|\233Ss3\027\263\273\\\013\272\312\245\374&Wr#\027r{\374\034\273\006\226q\027Wae\002\033\020\027\177c\255\313.\306\230C"
+	.text
+	.section	.gnu.lto_.ipa_modref.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\264\007-\031"
+	.string	"\226\231R; Q\223t"
+	.string	"\\\314\b\t(\300\3004\325 Ak\2618\302\2233\202\203\"@\016\202\254 \345?\"\2719\3418h\366c\346\315\215\253\337\356P|\377a\306[\017\263\255\265-w\n8"
+	.string	"E"
+	.string	"G"
+	.string	"Wn*J#`\250@\321j\034\366\306I\302-\023\225yV\272v9\206\355\234\336\231\177ws\372\211\364\273\364[\305G\232)\261\325\333\r\333\367=\265\203(\2569\037"
+	.ascii	"\213\240W\033)\202-\025<\360\337\204M\032\007\rt\260\024\337"
+	.ascii	"U\275\253\"\305\322\0027j\3012oY\b\264\323\273S\2226T\301\001"
+	.ascii	"7\022p2f\260\0279X\250\001(\"\306@z\324\215\316\314;Q\322;I\357"
+	.ascii	"\003E"
+	.string	"\f\206\377\302[\240\200n\213\nU\244\217\313\215\373V\341'\215\261J\242\220\023>0\374\262(\341\b\020\276\254\324\\\362`\217\345\340\006\307\300C\304Xf\266\242\022\307\211\276q\201\211\227\202\016\226\002\023dR\023\033)\001o2\033\317'39Kt0\323\351\331x>\231\351$\361\301L\247\207\262\016\"\016\277D,\033\226\324N\303\337\fW\224\215\206\\\f\020\r\027+@\177\310\335P\243\3461s\243+H5i\375D\364\373\350\027\"\200\364\250\341E*\221\246 )Lc`\002\031\232*\353\022\300\2641\210:i\250dF\n\013\222\322\036\007\017h1\n\310CT\230\225\225\355\250\206\340J\003Z\006+\324i\262\037\327\fN\225[\023'I\327P\3521)v\203\372\275$\030\256\023\t\205\0047N\t\021\355#\235\300,\250\356\222\375\304I\274\247Aj=\325\372g\036\005\261\250Y\007\241@\364o\b\316\265\271"
+	.ascii	"V\377\ngv\013\317\356g+\220/\2222\244\341~\204\t\312\320\240"
+	.ascii	"\324\2248\206{f\335\311\366\246==3\347\266\322\250\322!frz\027"
+	.ascii	"T\263\342\300r\260\b\360U\302p1%\032_~\250x5\337+G\324\361\025"
+	.ascii	"\277Vv\354\266\310\333\230\025\030_\204\252\373\202\361\3774"
+	.ascii	"\305p\3171c\033\203\276\360\221\315\242g\223\206\373\006\300"
+	.ascii	"\371\2466\327\274\234mS\371\310\3209\232\235@\302\224\263\f\303"
+	.ascii	"\272Q\255\206\341\221\020y\344\203\026t\322N`l\266\376o\361\254"
+	.ascii	"\215\214\365\252\355\017\306r\033\225\007\276V\226\2059'|j\246"
+	.ascii	"\214p\023\217G\276AjNv\364\020@\016\322__\0341w\245\370H\201"
+	.ascii	"\013\222G8\340\250\305C\030\207\336]\205\026\025\025LY\343\251"
+	.ascii	"\022#\203\217\322\316D6\016\332\227\305\275\271\360T\303\235"
+	.ascii	"j\013\374\262NL\033\rE\341l+\244\004\273\353N~\231v\333\307\013"
+	.ascii	"\201K\022\317i\200\246\r0kB2\217S\273\306 \305qF\344\3670G/\216"
+	.ascii	"v\3200\0374\023\267\220\004\376\217\251\320\325\312\275E\025"
+	.ascii	"\243\325\035\261\005I\031\255\332%@\361z*eE<\242C\267\376\245"
+	.ascii	"6'\212\001\365\201\201\210\375s\bz\025\274;~W\254\250\305\001"
+	.ascii	"!\277}\306\376\021T\005Dq\236\211\223\002"
+	.text
+	.section	.gnu.lto_.lto.87b8ba8dacdedcb9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dyad_realloc.19.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`4\001u\016"
+	.string	"\306\234eE\360\220*\035B3\365\fu]H\217E\262.\306\252u\207\214\304S&\215N^\336i\267\251\243\030\341\376\206d\362w\227r\242[\377*\360\f\\\006\006u\327\251\231qCvf\371\342\324\327C{\032Y\262\245L)Q"
+	.string	"K"
+	.string	"Q"
+	.string	"\033\206\330@\347\234m\237\304]P\266\215@\330\201\205#\373\320:Qc7\374\034\336cs\256\363\001\233s\312\341\250GM\224?\3222\343z\245\036\255qA\r\013Z\307\213\025U\203\210\313\236\025^\253L\016\203\335u\272^,7w\333$\266\033\330\207\005~\\\205\331\217\335\335c?\347/?\027\3231\2465\246S\323\367\024py\315\266k\341V\263-8\031\020\266Q\266\307\026\t\001\222i?|\t\324_\254\302\335n\206\0251\273\033\342P\347\234\027E<\200<\037\263\355\002va\264\230\r,M9g3>ZF\250'l\242~\310b\260\322\206US\243\276\326\272\200\340\234\252&L+\305*o\376\336i\252\202\226\314JF\247\217\335S%\2159y\345\250-!%\357\352\324\243\240)sz=L\353\206*o\376l\306\305&\215\035\246R78V1\201\245Q\311{"
+	.string	"z\247\024\260\343\344\006\205B \320hD\364)\371\0040\235P\324%\037\023\221\212\311wB\022\225>\007\244\b\036\006QF\246\357\004\202\246\317\023\356\025\326i\002\f*]\3713\032z\253\275\240E\216\274\211\243 \001\200\261\273r\027\204\316\n\311\201sv\t\314\273\354\005\024"
+	.ascii	"4\203\213rC\246mC\307i!L\256\nV\353%\002\253$X\260=\023\227\230"
+	.ascii	"\201\301\211\252\252A\027\362Y\233Au\301\n4\241\004\241\006P"
+	.ascii	"y\362\264j\017"
+	.text
+	.section	.gnu.lto_select_grow.24.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\317\003\335\031"
+	.string	"\366/\241G\260XQ:\300\345\202mQ@\363\332\224mH\216s\254\t\252\204\210C\247Zn\201\341M\343\231\303\035m\230}\341\034\003\251K\252\372C\316C\376W\204\236\016\023e\001\366\266\304\025\276\324N\337>\372\337\032!$\311\224\002\215"
+	.string	"\204"
+	.string	"\216"
+	.string	"\255{\336\261\343\243:}\321G\003%*\236\304\030g\006\253 e\020\346\253\301\021\343l\235\303:vl\024\302"
+	.string	"b\f\002\022$\306\336L\013\244\f\266gYh0\345"
+	.string	"\241\301\356\264N\334#\212\250!\024>IUb\214\264\017\365\376zn\230;F\205\340\367\334\251\363\006\323\216\307c\324\007\363\371\f\210\310P\306\t\203a\221\222\035\357\204\277\025\317\204\357\342\365|01F'9\177x\271L\324\202\030cs\307+\341\246\334vD[\006\355\241\0047\373\250S*\306\230\240\356\001A\203"
+	.string	"\242\027\006\353\020\241\301\330\317\304\b\227Ou\325\360\022\r$1\261\264=\036;^\250\265\343\203\332\227\314\312|\344\306ld\007\310,\314H\356\013\314\272\236m=\353\362,\353\331UfU\231M\205Y\024\230\r3\013~\331\357\313\376\331\314\254\007\250\232\344`\272\351\021#\211\247,\361\b(\004\206\217l$\363pRY5HHu\202\351\201\305\236\241\0241pR\006k\224b\332O\302dE\007\352C<\264\2264\235H\313.J+\301\207o)\330\322;\324\037"
+	.string	"\2118O\004\007\361\020C\024c\264i+\230\351\202A\002K\302\307\264\020\362\035\274\243?\204\377w\353f\344\376\247\222\237\267\317\026\\>\001I\3713-r\t\307\037c\344\001/\324L\031\037H\212\321e\207\375\247\235!"
+	.ascii	"\302\025\301\376#_LP\340\362\351\373d\034\273\354\326e\311\345"
+	.string	"\223\333\2131\376B\2359\366\263\340\321\244'\257\324K6b\367\221_@\270\0066\203\350`\313\251e\250\341\350X\270\261jsscc3\341@\215&\207\006\306\301\315\241\321\251\201\320\241a\260\325.\320$\330,\310z\3130a\003\255\303\355\266\201\306\352E?\250\016\232\216\340\236+\352BU\355\300\227\337\3057\363\353?3~\035'\311_\023\213\327\027\340\022\213\277\360\345F2\214\214_\177\271u+\n\214H\326gv\275\255\345\244we\001\351\316\323\326Qw\335\272\032\271\"vy\313\3459\245F\302\325Y_\025QQ}\025{\352\252_I\027#G$\365N\2501 \2071g\02024\"\"3\024&-\006`\002\031\262:\017\021pQuEi\266\003b\200\310>7.4\242\315V\221\366B>;\342Q\375'\245\300\347\2667He\344%1\247\224\355\244\017h\207\366jr\313l\240\356>6\373\342\n\371"
+	.string	"\307\256# \320\347l\223\034iX6\242\303\212\271\212\324\\yTN\255\026\243\223I6\b1\335\320RPF\303\223\252\276N\023\013\200\020^\354\020\005o\313:\374bo\317\314\336\0072\221V\360\344v\3269S\241\246\036 "
+	.ascii	"\2051\311\227L\3432\252z[\314xC\036\251>\210fy{`\031}\332B\245"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_select_zero.25.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`K\002\355\022"
+	.string	"\226#zG\320\322(\035b\301E\231\275\213t\213\365_\b\004);t\375E\002\365g#\034%\004)6\256\002n\234\t\375o%\344\002\366g\030\b^\025^p\032\r\371Pn\021\245\266a\023|m\f\251\205l\341\267H\366\2262\245d"
+	.string	"a"
+	.string	"g"
+	.string	"0f\354\346T\214bzt\356\251\357\321\364\001\337\243_\266\217\347n;\342\003\204#\224\264\273+\365\261\036\346\356\230\257\177\021j\276|\330?h\262\273\250\332\f\"\330\335\233\214(t\016?\025.h5\235+4\260c\024\002U\223\301T\016\022=\276{\346\324f\231#.\273\353\244\325@\334#\267\035\263\315\262\263C\273C\250\241cs\311\316\301Rm\366\037\224$bf\355\261O\307\375"
+	.string	"\256\273?\230\216\232\206\232\326Lg\246\217\"\371ADF\203\243\335\017=\"\213#\022\235\270\356\267\377\235KX|Rl\373\271\007\275\256s\021\334\241\007G&\200\354\256\352\321\fL\217'\220e'\345i\177\305Y\274\216\263\271\200\335\236\033R\267\335e\331\024\036c\346\021\265#j\352\207ho\033\237*T\225Y\n\231\252\036\247H,{/R\013 \341\2227DuwaPm\272+\340\211\361\202\250n\273>\204!o\250\233\220\363n\354\356\252\332\254\372\225\300\016\351&\225l\327\274\205\213L\273\273\300\027\232\240\301\004\364\350\333|\217\327"
+	.ascii	"?\270X\366\2142z\255\233\325\322\302b\311$xY\201Y1\251\271aV"
+	.ascii	"b^8\304\254,\264^fV\021Z\025Rv]\220\241Yep\271hV%\271\275KLe"
+	.ascii	"\237\332LB\203'\325\022\252\372\2479*\377\324\001\217\233T\202"
+	.ascii	"4F|v\211\345\322a<\351u?\211\345\222\017\374\323\223~\266#\313"
+	.ascii	"\236Q<\234\022\252\352Qm\t\255<\315%<3\205\321\234\0270 `\002"
+	.ascii	"!Rz\007\362(\002\337\220\333\206\021_\0050\024H\316v\245\263"
+	.ascii	"\243&\033N\355\366\255\260;c)\324p\231\361\242b\300\232\326\036"
+	.ascii	"\210\026\230o\243\375\341\326!\334J\244\237y\270\227\304\342"
+	.ascii	"\321\250\001\031\306o\034\001\361\241\217\2475\260\002oEvld1"
+	.ascii	"\215\370\254YW\002~\355}\333e\324\225\\\\f\b\270\003J\005x89"
+	.ascii	"\312h\256\005\005"
+	.text
+	.section	.gnu.lto_select_add.26.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`E\003-\030"
+	.string	"v-\234G\260XQ:D\213im\302:\036$\020hs\034S\343\364\215\"g\212\304\017mho\212N\205\241\306\306;\340!\372\bkxNeh\302~\320\276\360\2479\331\303\373Nt\031\310_\317\321\237\2465]\362\311&R\246\024\205"
+	.string	"~"
+	.string	"\212"
+	.ascii	"Hv\267\201%\204\2174\237\203)5O\373?~$;\022\212\307\354\022\025"
+	.ascii	"A\262\213k`\004\341\243q\227\001\037\303\273\300G\313l*\307\031"
+	.ascii	"m\212\206\256F\344\312\356\276\224\206\277\224=\005\306OS\346"
+	.ascii	"'\013+3\236\356\366\363T\213\203/\267\332G\263\273\253\033-\343"
+	.ascii	"\227\n\022\272\361r\013\372`PU\224\236{\252\270\315\362\3131"
+	.ascii	"t}\356\007XP\021\302\323\335\206\236)\f\273\353\264\335V\334"
+	.ascii	"\341m\333l_\260\265'N\233=\033\367\223Zd\037f\004U\305Jdgz&\246"
+	.ascii	"]O\272[\017\362\307|\310\317:\322\017\223\351\025\230v\001\323"
+	.ascii	"\252L\207`:\005\246\301/\035c\372\213i\315tf\372\003\\Vf<(<\235"
+	.ascii	"\362p+\024\225e\227\242\022\216'\375\366\237\363\352\201\255"
+	.ascii	"\306N:\361\255\013\334\256\240p\264\364\343\312.n\301\243-\370"
+	.ascii	"\301\326\350\220X\257B\370\350\340\251&q\007\"{\020\357\254\332"
+	.ascii	"\235\321$v\002\272\364\323\0044\035Q\325\245\247ma\251\352\211"
+	.ascii	"\324\266(i\351\223"
+	.string	"\276\222\001\224=\r?\202S@\312\356\302l\235\033\371\360(\300\250\245\331\244\364#I\230\242\026\231\245\251- NQ\236\244H(\207{\357\300kj>\321t\3142\312\366\316\213x\027\356n\004_\307\001DX\343\321G\001>^C\304\260\201\004\224QN \344\203\351\333\335\375T\t\2436\017\211\274\3154)\364\307\001zK\232[\022tS\303\364`\002\320\303a\t=\317\361\220>:&\324\260\t\023`0\035\b7686,\0237\216M\316M,\3475b\347F\304\253\303N\b\031\363\364\350\224x\371\360\360\224x\255p{%\312\300d\tHg)-b\022\233\221b\240\t\306\206\031\233\275\027\030:\342\001\256\224\200\020\373\346Kb+}iB\332\271h\032\335\346\244RP]\364\333\325\206BU\351S\312\340\241~ZhYf4\245\317]\346\311\300c Kg\324Ysq%>\nB\377\004\370\b\352U\274"
+	.ascii	"\322\226F=m\307\367? `\002\031\262\254\007bQDn\310\255)\315A"
+	.ascii	"*\340\035\345\273\263\204[|\311\306\3039\366\255\260\325A,2$"
+	.ascii	"W\261\302+\207\345\276\306\331\332fq\216\316\b\0320(+\034\263"
+	.ascii	"\223\242>M\260N\340r\336\034\357M`\215\242\305\007\220\231\355"
+	.ascii	"\016i\255/\301]\027s\245\036k\221\225\345!L\203#\3046\250`\271"
+	.ascii	"LpKX#\fK\271i\246\205\220k\350\276\bO\254\032W\214\f\31718\301"
+	.ascii	"\227V:q\263\255\"\250\272\032[\367\205$\362\272\314\023"
+	.text
+	.section	.gnu.lto_panic.36.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002]\021"
+	.string	"\326\236qJ\300\222U:\240U\365\265N\0221\322\354\352\2572\262\251\034l|\f\202\375\3647\002\346\007\350\227\006\020rZ\313\302\"2\334-\366\352e\233M\003"
+	.string	"\220\304\262\212h\020\352\001\223\233\b1\223\347\337\236D\334P\265\243\277\311\336)\005Z"
+	.string	"X"
+	.string	"\\"
+	.ascii	"o\201\373O\207\003\330\345q1\334\005*\260\t\352\325\300\257L"
+	.ascii	"\257\250\0070\275\032g\037\035\370\333\223\n#\0200\202\354\256"
+	.ascii	"\213\2468\356u\244\023\347\273\352|\034\351\351\234\216\251\234"
+	.ascii	"#\035$\275\335\270\302\243g\342\301O\021=\017s\236\032\354\256"
+	.ascii	"g\331#q\233n\233\305v\213=+\004\245Y\037h\316\"\276\240\007\017"
+	.ascii	"\301\347\223\344c\247\020\033\230\233\364\204\375qw\327\224\307"
+	.ascii	"\376\317_\351\364S.J7;\305\026\241\335\233\245!:\034\265\306"
+	.ascii	"\212\003\375\366\037tJ%\007\305\266\017\374\013\334\2018|y8,"
+	.ascii	"E;\220vqR^\rC"
+	.string	"\275~\200\n\017\345\323>\213=\206(\212\034!h\320\027\323i\201\240\321n*\331\237\361\341\213\337c\n00\246\327SZTB7\227\254\362!\225L2\266#R\315\223_\245\027^\306\214\344\267\253{\351\007=\306\214\337\363j\331l\276|\365g\264\032\217\346\254\362\rO3\345\027>x;0bw_\332\0314\314\007\036\271!`-\210\311h\310\032\326m\306F\216~\301`\257\227\314\n\331\212\265Jlh\027\250c\255\030rC\214\213FF\322\\\026d\030V\256\325\310\330\\6\265\232\315\225:\37160\023\334v\360\340\304\244\241J\340\306\314\344W\274\360B\021x/%\240x\fN\\&\374pq\007\210\317(`^x\033\263\025\021\221Nb* \240\002\031\251\263\003\223\312\"\n.z\303\031s\267\262\322@E\022z\314\023-\241\270\333\242\317g\236\317\302\0171l7-\004\355\322\316u\304\332G\206j\355"
+	.ascii	"It\033wy\035\003F\342\205\321_\3410\270\303\204\332\236/\301"
+	.ascii	"\275\006I\306s\033U\354\354\263]\342!\030W\226\360F\336\324\325"
+	.ascii	"h\327\036"
+	.text
+	.section	.gnu.lto_destroyClosedStreams.38.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`w\002\005\024"
+	.string	"&d\201J\300\020)\035\370\336?\354\250\b\336\177\374\371\036\345TCH\255\275}\013,\2712C\345\271\034\216\214:\215\005\2037\374z\233l\030\214(\002\361J!\350\377\025\205\337\234\274\221"
+	.string	"\235C\247B\024\036a\0200$\226\020\262\211\334)\005n"
+	.string	"f"
+	.string	"m"
+	.string	"\340\251x\001\340\251cv\214\347|j\bt\201B\022\215Zk\271=V\315\330EUH\277\2351\177\262\2201\253\275\\\374B\231\032\241C\331\350|\254\036\217\351\270OZ-f\252\300\233\235\2079\247c-\347\337W\200\247B\n@M\346\353\250\021\232\2215\331\334\343\276"
+	.ascii	"(\303\f\0177;\237\341H\255\325sV\273\271\307\333\246\261=bO\r"
+	.ascii	"\001\224\356\200\037\035\2309\345\357D@\325Y\303\316\275\314"
+	.ascii	"\265\331g\371\364x^\036{\274\356\016A\372\333=\347\364\311\021"
+	.ascii	"\206\321\n\022\247Zk\246l\324'\3124t\335\177\373\264_&\255\374"
+	.ascii	"\234\217d\262T\322\321h\033\020\210\247?\316dY\264\262\355\033"
+	.ascii	"\375(\366\033\354u\306F5\243a\340\325\232[\235\032D<u\356\035"
+	.ascii	"\001\273\246\t\242\207\346\006\r\023x\244\030\347\\;\3455?\363"
+	.ascii	"\207l_\274;\\\270\327\235\204\203\037\374\004\f\304E\270\036"
+	.ascii	"?7\244\223\273\243\343\fIY\370\326\346\325\277%$\242d\263g\233"
+	.ascii	"\345&\334$\326Z\017\370K\023 \210A0\360\364\313\021u\233\273"
+	.ascii	"\021\273\344$S\333\265\355\212\350\376\366\017\230\227x\022\314"
+	.ascii	"\017r\004\227\371\331\251\357\002>-\022\\*\237Y\"\",\226\313"
+	.ascii	"@+\304$$@J\313\265\322\302\002\332$\344\244\345rR\252\240\264"
+	.ascii	"R\312\022\224\006\035~9p\255\224-\257\327JI\346\352\227\307\f"
+	.ascii	"Z<\301l\214\2706U\207\020\267I\327_8\356\\\232\225>W\301\013"
+	.ascii	"\331\354\275\002N\321\364\310\377\325Z\253jm\224\350\003\005"
+	.ascii	"\367H\247D3_\270\343\322\354\207 \n\002>\340r\340N\0066 \220"
+	.ascii	"\202\2312\353'\341\205o\204\254\251\264\343\327\256\215\016\344"
+	.ascii	"le\305N\271\221\205\276YL`Q\352\027#\210\347\306\312\302(\f\323"
+	.ascii	"\310\216\374(X\353$9\273\016\rc\n\363\370L\307M7\200\230\231"
+	.ascii	"\323\033\204~\276\270`x\253q\215\2430\230\025W\022\270\372\214"
+	.ascii	"\026X\331v\225\026\336\nA\013\210\214\330=\320\243\200\260W\276"
+	.ascii	"\371\326\317[N\305\343-\367y\302\324R2"
+	.text
+	.section	.gnu.lto_updateTickTimer.39.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\226\007\005+"
+	.string	"\372JP\020B`\346Jc\365\025<\234\007\213\"w\371]"
+	.string	"\024\266\316\332\217\331\251\247B\030 \365Zd\022+\245F\036\003Gi[\216/\033\2752\353\021{;2\351\242#Xu\300\317\375g#\032\332{\357-eJ\001\354"
+	.string	"\334"
+	.string	"\375"
+	.ascii	"\30648\204\311\366\360oX\277]_\035l\274!\357\326WS\334\225\017"
+	.ascii	"\027D\302\371]\356\345\352oXY\023\360\2728\2457\255\321\351E"
+	.ascii	"g\233\357\326`\t\236\257\371l\006z(\343j\226\260\344\317L\355"
+	.ascii	"\336\013\274\351k\221\001\274\311\244"
+	.string	"\206\311\276\321\277r,2\236eFy\307\214w\007\020\033\336\0335\276{\277\232n:Az\363\367F\347M\242\027\2357-\320C{\316\215g\027Mb\305\253\215\357\336\033\264H|\032h\207\007\002\242\247Y\376\330:\364\253\0314E\260\254\003]\357\313\307V\005\036\321Qv\264D\271r0\031\002\363*\235\372\220t?r\325\323I\330\315\037_J)C\247\b\026\366\262\226\375\347\300\020\035d\267%\003\3441\317\365\276\310J\243\034L\212O{\265\001\246U+j\341\336\353Z\004\323q\007\335\366\026\333$lT*\310=w\252\235_=\242u\264G\333\025\301m\022\333\336V\355\263O\346e|\364\225X\312s\365\305\233\276\347\316\233\267G{c\304\232\364\355\366\350\335\352g\033\265\2525b\377\354K6\261-b\243\325Jh\265\001\264:)\255.\200V\023H\253\221\320\352#\264\332\b\255\036\220V\027\241\325\002\322\352"
+	.ascii	"D\237\233\273O\264\332D\253K\264\332\242\325\025\255\376\002"
+	.ascii	"\240<\177p%\356\356\315\221\374\273iL\272&_\373\361\376\266?"
+	.ascii	"\356\237\273\037w<?\317@o\200\253\201\274:\235\177g\266\261\241"
+	.ascii	"b\017\323"
+	.string	"\254\257\224K\022+M7\203k\230\316z;?\314\305\\\275\316u\377J\351\342\320@\336{\033\334\364\205\364\346R\331\203\311W\363\345~\f\373r0\303\317Y\375\024\341\274 \3575JHo:\0302\324\0273\2347\203\354\020\332\030Y\235\rCo\356\355z\221C\332\245\201\311\303\345>\330\233)\206\325;\261\333\375\307?L\254G\032,<<!\2641\2626?\236A<\317u\365L\b\355\207\230\336\255\017n2gS\234\020\336;\034\021\276\222\233\037\363\274\021Bg\226s\342\221(\321e\263|\304#\357?v;\356\376\036v`j\200w\335y\273/\021\253\237\221x\034\017t\267\303\351\254\017Y\376\034Y6O\273\202(g\330\334\274\331\231Q\336;\244\002r\255&md\005\330#3\037\337UFG\310\030?'s\327\256\220L\216\331\272\227\210`\2005\262\357z\242U\223.\262\003l)g\342n'\212\254R"
+	.ascii	"+\300V6]\3106\013\357\366\224\336{!\004\260ChXP'H>;B5\370s\271"
+	.ascii	"\233\212\264\350\267E\261\250/z\211\313f9\306\017\267\177,O\231"
+	.ascii	"\336\267\3747\274\202\004N\001Ee\365\3644\265\004C\270b\211\305"
+	.ascii	"ST\325\222\260\b\352\005VU)%\204\242\252\202qB\335N\021\"89A"
+	.ascii	"=\020:xr@\024\243\252\372\311A\n!V\212\240\213(\241T\020ET\013"
+	.ascii	"#O\275\200\242\nVMMQ\005\201F\342m\021\217\230\222\206h\265\200"
+	.ascii	"\254\021+Y\323b(\263U\373\252\227i\251,\3713\2732\266f\300\022"
+	.ascii	"\260J\327{\2225"
+	.string	"P\300&\331R\316\304\331\n Y\002k\026\236\ri\313\331\326\330\264<\355\377\021\226|\005\"}A\200qe\262h\307\332jK{>>\016\247X\373\343W\255\321\336\030\024\324\0321V\225>&\221}\025\2672\310\236\326\206\365\374\264\030\340\340\020+;\255\005by\357\275'\021\005!\304\352W\345{\254R\237\217j\230\206t\246\304\352\274Id\001\240aA2;POw\271\021\351i\355a\226\013\366\016\210\345r\307\005f\326\273\262 \373\271/\021\357\034\217U\200\235\250Q(F\025cj\204D\2024)(\344\200\002\031)\242\363\022\200\306E\211\250\031mJ\325\372oc8\342I1\250\232\224>(&\"\001\243H\035\030_\355\326\372\332\224_]\"YR\002e0x\2279\250\352X\246!\307%O4\216\336\221\013\322\331\300\201\004\244\236\021\272\244\255V\236b\300\335\324\2574v\217\206\225\327\227}t\377-"
+	.string	"\323\005\377\263\177\262\264\212\234\263\366\243\312J\201f\372\262X\370\224\264\350\317\337an\034\250\225\374\223\206W=K}\026^\232\271\254+\326Q\333"
+	.string	"\366KH\213N\314\234[ \3745?\"4\264,\005,\332\311\216\336\336\234"
+	.ascii	"gd\360e\254\013C\032c2\023\3770\206\\;e\317mMb\330SF\202\225"
+	.ascii	"\354(,\214\317\231\306\322_(\372\0075O\206G\345\260\302`n\330"
+	.ascii	"p\003\377\2220X\334\217r\276\232\314R_,\240~\366\246\352\215"
+	.ascii	"\313\344\227\347\370hfG\256\203$\304y\020\226#@\274\235\2231"
+	.ascii	"\247F\363\"&\303\204\rR\2775#!\261\325\247R\320\232.\277\204"
+	.ascii	"\020\200\023\215\365\360!\215\027{'FG\250\021T\344\2710\235\345"
+	.ascii	",\020L\206&#\363\242g\002K\r"
+	.text
+	.section	.gnu.lto_updateStreamTimeouts.40.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`H\007U,"
+	.string	"\372L\370\020F`\034R:\032>\206\251\366-F:\241\324.\n\036\027\204\232\373]\024WO\242\240\241\304#\236\320E\213\345\370\350T1\361\365\2370\303\257#\f"
+	.string	"\035\037V\317\021]\376\313oA\034<9\350\373\243\362[B\366N2\372"
+	.string	"\360"
+	.string	"\377"
+	.ascii	"7\213\272\230\324\212\374\246\364KK\203\257\375/Q\300\257Fz\216"
+	.ascii	"\272\357%\352\317)5;\3032\225o\354M\233\227\024\037\354c'k R"
+	.ascii	"\233.\r\005Pv&\327\346\234+\260_\221\354\302\316\005y1\251\337"
+	.ascii	"R\007]\233sX\004\366k\263H\323\243{\375\013\371\347\324\263\222"
+	.ascii	"\311\341\254\256\315VL\006_\333\210\375\212\303^\324\373Z<Q\357"
+	.ascii	"k#\273\345<\214+\373\232\304\335 \223\346\234\211\230I\377.\362"
+	.ascii	">?\266\267\252\370\"\373Wn\316\262Iu\037\325w\325\003\312\347"
+	.ascii	"\230C\324\"^\213v\262_\035\315\252\373\363]X\202%\344\254\001"
+	.ascii	"-,\347{\352\002#o?\204M\245Z\224&\t\234\207\271\001*L\347]\325"
+	.ascii	"\005-\024OQ\017(K`\363\352\252\352p\216\351T\2079g`\323\352\342"
+	.ascii	"\223}C\0238t\264\260\204\374\372.\344\234\373.\233Xo\340\273"
+	.ascii	"[Jw+u\373\024\004\377\332\325Z\260\313~\332\322\213\373e\017"
+	.ascii	"\2570U\323(\242\366;\361\020\371\216\033G\332;\273G\301\346\362"
+	.ascii	"\315\353\016\253\272x\253\373E.\274\266\261\222n\337m\"\366\366"
+	.ascii	"\020{[\210\275\035\364\273\r\304\336\026\376n\007\177~\027{\253"
+	.ascii	"\354m\314\336\276\354\355\017\360\231z\265\245\310\223s\217\251"
+	.ascii	"\236\214fE\213\362\264\037\356\177\376bW\273\337\217\036\256"
+	.ascii	"\037\327\300\316\321\346\374\364\266n\331\221\"Y*&\353\245I\034"
+	.ascii	"q\315"
+	.string	"\221\357\336\255\337v3O?\323kg\262hop4\370\332 \330\257C\365D\275\350S\237\215\330\262=Qh\373\362\264\276Z\003\033\t\365\262.B\321c\304\013\r\252\017E\240\006\332\037s2P/S\303\207\317X\033\235\2274g\017\354\327\347\240\023\365~\326\017\323\300Fv\324\313\372`0\020=X\276\232aM\200k\275\244F\355\321\275\001\re\373wh`p\"\325\373z\fT\367\274Q7\354%z\325\304x+j\346\207/\366a\262\316\355\244\372N:\203\206\373\245\206\336\327\037\016v9\243-\207 ]\316\312/;\260J\021\b>\034\f\304\345\272\230e\220dt\355n\007\222\225\206f\n.\330\345\024\302\346\207\353\020\217\353\265\313\325U\204-k.\337\007o\267\036\0037#\232\356u%\372N\276^\356q&\202\\\035\247\007w\002\205\022S5\200\037q\377\261\371x\373\201\2605\325\370\274\327zw\3730"
+	.ascii	"\332\034tn\b\277\313O\366_\232-\355]\233\274y]C\315Y\313\302"
+	.ascii	"\323\376V\354N[\b\013\361\220\221\206^Id\016\2223yS\312\344n"
+	.ascii	"\013\323\351\031\253\234\223\007\202\260\020\276\222J\325\235"
+	.ascii	"6\020\016\302\252\230\024WS\001\204\tt=\203X\210/\033e\373\264"
+	.ascii	"N\272\232\022\233s\206\020\304\302\256g\362N\3337\245\225\326"
+	.ascii	"\t^b}\204j\032\26202-\035\207BF\031QG\225\306\361\032\231\226"
+	.ascii	"H\034c\030\235\234\240\224\200LIF\247\343S\257\213\022$\024\213"
+	.ascii	"\306\007IHJHA\306\267\022\022\213\244(\026\304\030KIL\304\025"
+	.ascii	"K0\212\272I\206\321\211xljr\"\002\303\222\307J\332D\036\232$"
+	.ascii	"\256\352\251\247\017\336\352\031`O\366\007\377\353\312\375a\025"
+	.ascii	"\353\270\235\2538\203\033\036Yf\346.\2509\347\374\373\221\200"
+	.ascii	"$y\363\236\334,\005\340\007\013\273\362\230\261l\300\362]\233"
+	.ascii	"d\023\\\025\367\317\220S\220U\356\227\255b*\007d\350\264z\fN"
+	.ascii	"\204\005\214\325\375\254\221V\276\247\327\232\b\013"
+	.string	"mH\303\374N\274<`\016\274\021Erg\247\342\233}\230l\215\356\313\016f\202Uq72\013r\313OT\256\317\262\362\226+\336j\214\217]\214\275]<\2041\276{\224R\252\356\364\353w\027\027\300Q\270\253y#\366E\205v\367=p\274b\314\215\325\305\003;\236\200\236\250a \345\024SL\321\214\210\302$)\346p\002\231!\273n\021\3205ER\222J\215\016p\243b\327\"Jq\232\270\303o\316\336*'\310A\360\2645\370\210\020\361\320\034$\340\211\354\273\227T\215\r\276? \013:\030p\336G<'\306/r\301e\264\034\344{\021v8\177j ?\370\347\225I\222<\242\334\347\030m\215\363\325\344TH\227\233.s\300\037\177a,\253N\253\233\364XJ9j/\230d@]#\227B\362a;\353\026W\347M\372\345+\356\243#\225d\\\315%\033F\3451\203\224n\250'6\210,=\242\202\225"
+	.ascii	"\320\372\335\336\303\342\310\037\003\204\034\317%\354Hs\3665"
+	.ascii	"\343s\"\234\225G\374!J\202\241\320\025\027B\374x\024/\315V\236"
+	.ascii	"]\364\221\345\033Ng\213\314\265\345]G*\301\006\240\020\240s\344"
+	.ascii	"%!\357b\322D-\257\330\037\245(\315\301\016\007)\254\212\333\251"
+	.ascii	"\210$@R\017\341\253\3504\200\261\"\206\203\263;2T\370f\250OR"
+	.ascii	" ?\025\232\271Nz\265\355\357\203AQ \035h\201Y\213C\202\331\254"
+	.ascii	"\314l\314\302\362(rc\304\232\272\354\023ZF\027\032R\n\207Ph\232"
+	.ascii	"\311M\265\371\003"
+	.text
+	.section	.gnu.lto_stream_destroy.41.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\353\007\235("
+	.string	"\312E \017D\200\236QcB4/\252)C\305\024\225\006\206h\274rA\202)\007{u\022\236\013_\212\337R\204 w\200/\023cR\3429{\301\310\266\241\344\002B'`0\001\201\314\325H\246\322\333\fq\267\275\267\224)\005\331"
+	.string	"\327"
+	.string	"\334"
+	.ascii	"\017\323cS\345\336k3J\336\036\302\273\243\202\231\231\3271\002"
+	.ascii	"\226\256\254\007S\343_|\307\200\360\356\270\361\343\350u|i\r"
+	.ascii	"\007\253a\333^\226\327\362\241m;\341\226sA\337\245\211C\230\016"
+	.ascii	"\343\225\312\312p\276\264E\2730:[\350"
+	.string	"\364K\225UK\273\260\214\367\nu/m\301;)\272W\373^\307\202\376\353\351\002\3565\242\306\314\275\302\007fp\276\264\3608\363\345\371\001\346K\2436\236\013\271.\255\353\252jx\274\367\362,\022\233\025=\315,I[Q\277\326\311\223\006\241N#iSXLn\301*\262(\220Ql\252\232O\264^~x\022\n\035\2624\250u\222\307-\231[SVu\013J\221\n\214\b\001\364\341\253U0\252V\032\206{\257k\032\334q\237\267\215\303\266\013\233v'C\337Q\361\241\211\356\325z\370pn\213W\312\200U\220\035\240'T\326\t\326u\245\343\311\321\231\365p|7\177c\3642\023\237u\212\325\301a\274\367r8_\346\310\034\360\ni\267l\337\352\255\355kQ\237:'e\241\\\213S\020pq\223\306\332\255\2770o\017p\241#U\003\331Nz\361E\317W\263B\351\274\367~\311\223\371\362\366v\366\005\254\205|"
+	.string	"\312\201 /\002\211s\253 [\030U\355\226\375\"\256@F[#6\356_\377\315vV\017\235\325\265\263\372\244U\323\314j\323\254._M\276\332^xW\263\372\013lM\274\316\220\362\334\213Uh\320-+\305\232\\\370w!K\323sSe\fM\257\315\361\214\231^\233*d\302zl\216U]W\027c\333\\\343^\034\005\314h\226\201\036\323\026\372\356\2455\355\251\202D\r:!\023\375%F\261x\254>\365\230\371\262\264\270\263\036lH\353\033o<\335,,\335\003\350\211\264\004\316\276\326\320\354\226\223\210_%\316\332\224t\006'{d\354h\263V\266\326\236\310\215HO\247\265'Z\371\030\376<|\330,\006 y\357\275&n\302\020\240\037\247\033\227\215fy\237\247S\215\r\245\002\\\367^\234=1\325\252E2\013F6\025,\355V\221\270\307\t"
+	.string	"\327\275\300\247\276\361z\236\374%N\365\251\223\360\020\206"
+	.string	"\305\022\324{\371p\303\323\233\2659t\230\262P~1\313\355x"
+	.string	"`v/\325S\020'\325\207\006!>\024Q\271\036\226j\025\261\350n\217\370\2316\211\017\177\237s\273\304\207(P\230\266\211\017Q\360n\247x>\3625\375\226\230h\370\216r1|\276\0259\032FH\271\234\017\211)\201OF\023\023\271\304$\303\372\316d\303\027\203t\021\005\nEE>\tF;\026\273"
+	.ascii	"JF\276%&\032\246Y\354\216\214\232\216x1\222\214\224x+\222`\340"
+	.ascii	"\374\223\341[\3421\375~K<\233m\013\201'M\233\255\326\352\204"
+	.ascii	"\2402\240\215r\023y/\221\013\357\362\033\267\020\2057\353\223"
+	.ascii	"\221\245\271\331\023\237;\2129\031\262\376\330\030\232!{\261"
+	.ascii	"\"\365\352"
+	.string	"7dq\177\312\f\251Y\377\314\03135\3732[5ERs\240I\210\314j\226\350\254\317\230\254\323\372d\310\204\235\366c\224T\252_W\235B\233\020q\235\226(\311\327\2368\027\314?|Iv\217\306\006\225f}1h\024t\312\305\274\006\026\214s\303\374\354C\305\b\210\017\315\036\314s\300*\210J\005\3160j\245B\241W\030\230\005\200\240\250Q,\245 3J\221\214\210HS\220\244\003\240\002\021)\252\362\022\340\3649*)\2530\244\2440\373wy\"\275\016\004\030\002\262Z\212\365)BM\177':(\326\333\257m\303\n\312\231\t/\254z\322r\b\213(\345.b\017\272\367\b\362\361\246\307#\343\254\177\022\270u-\357\307\274\213\250\033\260\3172\307d\224\314\336\230:\377\311\031\371\247\326=\223U%\260#\263\255\215\031\215\361\024ymld\224\236Oj\253J[\204\321\022\253\305%\207L\2206\2321\365\225"
+	.string	"b\354&\334\300*\030[\035\017\023@\036\367\032\346\352)\326!;\334\023\316DsY\201t\303\t\037\271\025S\302Q\b\335\266Cd&DJ\354f\340\325\2232\210%\331\375g\3171\261\027\023\035\253\220\005\355\337\214\030t\177#\237!\252\006\222>\025\001{n\031PE\276$\217y\371\034\237\252A\002\337;\3732\264\357\353\315c\304\311\264\347\020\350\324\333"
+	.ascii	"\022\205J5)y\205\277n \351\rI$\377f\016\316\020\004p\325;QVH"
+	.ascii	"\360\215j\314\3200\275\0249\244'\323\315\372y\324\023D\262/\321"
+	.ascii	"\237\373\304\313\227\313\b\336\203\234\330\2309%\223\325"
+	.text
+	.section	.gnu.lto_stream_emitEvent.42.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\204\004\035\035"
+	.string	"v\364\266J\260\324Q:X6\036\2635[v\363\023~cJ\002\255\017fUy\017\333\332B\347{N\225\273P\254(\3616{4\335\230\00362\337/\3059<\345?A8w\230\rxl\322\325\365C\177\205\017Pn\377'\204\020\"wJ\001\243"
+	.string	"\226"
+	.string	"\244"
+	.string	"'\017\214\265\036\215\002K\024%\234'\033t\321N\355\363x\017\237\377z\036S\353\323\020I\255\300\006Fp\2364\3602\345\311\363\263\362\244}l*\007FUsF\325P0K\255\325\2660|R\237\277N\263$\307\245>>%\026\211|?\177\215\246\220\t\032\177b\2644\336\272\270\254\036\344\321\363\305\221\322\315\244\227\343l\211\b\224\027\337\320\310"
+	.string	"\312\r\246\036%Q|\034\02781Az\361\t\2152Y.\246\274\352\264\310\027D\367\301\217\304!UZ\034)\235\2325\265VS\"\337\321\r\273m\031\266+\330cP\025\202/\244\203\016\215\222q\322/Q\236|\331J\001D\213\036\200\364\341\211'\225j\261\201?t\241\354\337\242\272\250x\237l\232\231\013\357\331\177\177\314\201?\214\354Tw\214\244\206-\365k\251O\223\332,\251K\222\232$\251\307\221zGj\272\324\027\360\034\305)\"\034a\255&\212[*\026iU\343\302\237\252\306D\363\201\370U\216\325\232h\266p\367\3323z\r\021\211p\325\n\2549O\376A\307jF4\333\376\217O\371\234\312Wc\255\242@\f\302Uk\245\235\364\2043Nv\n\264\232\0308W\201\216\023\244\f\205Y\233k"
+	.ascii	",\202\366\307\366\205\0173\230\013`\207+\312\2655|\211\211\262"
+	.ascii	"(\032$\262\302\341JL,\267\200\324\016U\234\t\213\222\326\270"
+	.ascii	"P&w\\\233\251\255 \332e\333\303\257|E\256\201\255\037\356I|e"
+	.ascii	"\205\341\346\334m\200\255\037\0356\315\366\302\037\330\375\316"
+	.ascii	"\366\\z8\004\334\303\222\356\356{6x\264h\331\322-\213\fu\261"
+	.ascii	"s?\262\253E\031\304\215\350\212l\b\201@\253\247<\371"
+	.string	"\255I\375^u\330pi\205J\204|k\332\003\026@I1k\347|H\317Yk;9\0219\036\022:\234S\367\334}\213\020\341v\3139\300\325nj09\270\334\016\017\211\3227\265\017\270\335\007\233\b\035.\307f\243\303\221\261\316\210\334\216\215GGg\307\026\003\326\357\2235\370\300\002Z\036\327k\241\034\213b\322\354\306\240\264\313\266H\266\260\375\213)'\026\236\345\253\004X\004`\233@\352\007\2044\224}\254\265\326s\241\316\254\241\221rf=\222\262\215m\221M\303\340\261\245\331\367\234x\301\277FSRlk\200\250\026\212\302\234\331S\325.\333\231}\260\347\304\333A\177[\256H)g\373Z\233\251(\273\347\276\226\022{8x\001[\250A \347\234sdF&\022!Z`\030\016p\002\231!\264\016\020P\210\246\272\032g\024\021R\fW\213\004\202@\262\362\354m_\020z\032L\310S\030\322\307w\264\023\222O"
+	.ascii	"\372\005%e\234\204\312\377S`t\030e\270g\026\316\343z\006hqD6"
+	.ascii	"\261\202\"\350\265\347\362\243h\341\362X\307\3377W\245\352\325"
+	.ascii	"\257\256\021\252\t\023\315;S\347\244\375\333\262\352\304\301"
+	.ascii	"\022\242F\373\265\372Gh\266A\250gN\312}N\243\334qH\252qb\275"
+	.ascii	"\234\225M)\324\2467&\373\200\335\372p\275\370\002\013\367\314"
+	.ascii	"\002\241D$\336W8B_\301\177\007r\233\237nA\274z\027A\003\0339"
+	.ascii	"s\351\277!\227\341\262mj\352\357\017"
+	.text
+	.section	.gnu.lto_stream_error.43.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\016\005\025!"
+	.string	"&\274\321G\200\334Qc\tte\236"
+	.string	"\251c\266\365Aa\001\3054\321*\017\321)\305\263y%\032M=\252\013dUB{\b\227\333\340\226\006\362\357\306T\366m_x\230\3065/\322\234V<H\n|\321\217\212\216%do)S\n\267"
+	.string	"\272"
+	.string	"\270"
+	.ascii	"\365z\245\266\375*\267\022\374\021\351\227\351)\003\022\314\362"
+	.ascii	".=\245?m\001\375i{xT\251\225r\253\340\247\370\313\324\271KCj"
+	.ascii	"h\335{y\236\200\376\334\231<&i5\302X\213\200\376\344I\245\257"
+	.ascii	"\366\251\036%\370\252\244\007\270W*\213\326\275F\236w\320\237"
+	.ascii	"6^g\373\211^\200\355\247\203\266\230\033\247\356-IZ\023\025\265"
+	.ascii	"{\257\317\032y\3607\333i\332\032\364\217\374\r\261(\374m\307"
+	.ascii	"m\346\202\037c9rE&Sg6\004\314\275\232\352\tu\023\247\buk.Xn\235"
+	.ascii	"\311\025\227L\235\223\022\342\221\2574\212J\265\336&\334{]\211"
+	.ascii	"\305\0337z\333-l\217\260\317^\307\271\361??\3457\321\352\353"
+	.ascii	"\356\004\215\025\217\025\311{\235\332\254\271e'\327\222+\377"
+	.ascii	"\343\217uk\337O^\351\217\031g,3\226\367\022i9\213\234\t\242\302"
+	.ascii	"'\324J\222\264\364\247\257Kj\353\305\210\036\346\257?\241\\_"
+	.ascii	"d,\357\275\032\320$\221\017\346[\202\021\325\260#\325\223{\237"
+	.ascii	"\322w\371^\3069h\340\263|.\0366O\356\275\270\237[7 \210\321\242"
+	.string	"R\273\327\230\376\334Y\246\257\337\002\276*\351\347\276\250\026\005\312\362\247\257\005\304\375\334Y\223\332\317\002\374\021\311\274Q\306+\274Y}\t\243R\253\277:\3228\336\361\312\261\004\217u\204^&\030l|Y\336\213\001\375\251s\003\317z\232\007\335\324\275L'~@\231: \370\371\254#A\344\274\330!D4Y\241\003T\323\332$|\352\211\267\273%+tU\222}J\315R\313Z\"No\332\002ViKU\215\257T^\354G\376P=\304\312\220\314{\205HXJ\251m\234s$\212\007\331\2574\320\307\374U\247\356\275<9G|\fk\033\037l\307YNup+m\351\257\374\331\220O\364\313nv\302G\362\363d\037\013\312\231\":\214M\231B\250\236\350\035\223\025z@\216\261\337\200\341\320\362C\201\025\271\334\334_\266\213}7\254k6\020ve\362\354\3265\333\250T-\021\373\346\265R\266\255\316\275\352\001V"
+	.string	"d\320\323;\220`\007d\300\323\240w"
+	.string	"\300\217\205\013#\323\304\321\217\375\275\250\350gO"
+	.ascii	"\205\254{\036<\350\351\3719\360\351\001\365t\204|~EF@\233\201"
+	.ascii	"z%|\\\224"
+	.string	"\360\255\b\362\021\362\375\004\251\320y\210\305\257\310g44T\344\303\031\2077\257\225\262\210\265\262\241U2\322\361\b\213\303\026c\232\345\360\266\2538\326\357\242P\241\236h\323\n\353\226\031\263 \266\234-`\205\326\345\013'\343/\324\037\203\"\203\217$\311\3663gshU/\324\274\376(5h\270\216kJ\002IS\006\307~\353\273\241\332\331\255\317\372U\020\212c\355\r\034bX\241\257Ds\2366\007\315G\231\232\214\341\324\304\354\360+\030\366dD\035U\271\205@\275=me\250Q0\305\220b\210\031\021\tdH\211\241\341p\002!)\273\016\021p\311F\301\024\013\333\001gE<g\254\206dY\211\361\261X\006\3315PY\202\323\245pt\300T\324G\242\0163\373z\342\201}\266%fM@\245\274E\202\316~\340!Z\373-,\336\317\203\336-\214\201\310\211$\377\207\343$%a\324\007\351H\207GPU1"
+	.string	"\"?\307\217YO\357\007:\334\223\177Gr\262\306:\243Cdg\242]e\354\024\354D\365(\"\317F\f\205\200\247':\205\274\203\322^\260TX\252D\312\nR\272\216\005\037\365I\276\200$&\330\240~\300\203\200]\034\232\227\324\272\243\247\223\352\246"
+	.ascii	"\213[\201\377\031\344q\206[\347\3748\303\032\b\221\n\202\376"
+	.ascii	"\375\243\254\377\375\370Qc\241j"
+	.text
+	.section	.gnu.lto_stream_initAddress.44.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\322\007\245*"
+	.string	"\272IP\020Fp\\N:\377I<4\250\005\"n~\\\257\245\356\216\364\206\210-D\300\222T\252~j\271\217,1\316\025\275\364-@\367\352\023u\211\354\222\350\377\236Y\241\224\313\352\264\312\273u<\227|\264\265m\322\b![&\031\347"
+	.string	"\344"
+	.string	"\366"
+	.string	"Kd\331\362^\344\360'\004-C\264\317\205\317v-R\337\022\325\310\313\325\304\246&e\371\223;\244?\177\372Y\244\230\177?\355\323\276\362o\350^9\026\365jT\2774\270\212\350\030\225\367riH\177\246\367w\350\306\360\310[Q\217V\225Zq\245+\231\r\345\275m\303\237|!\375\031d6\2302|3\277\354f\352\317b<\300\275D\314\264\335\213\034\342\004\351OF^\210\376L/"
+	.string	"\375\311*\363\234#\307.\217\254\206\026\226\345\275\267h\215\\}/\345\241\247i[\345[\275\267>\345=\254\313\353\250\311"
+	.ascii	"\254L\016\237\243\226)L3$\016\215>\021\204u\365\270i>`;v\t>\231"
+	.ascii	"\323\344w\234\321\326\204\220\265\364\341s\3142\201w\264\326"
+	.ascii	"|}\3338bu\3632\334{\271\215\307\256\263\357\314\314\203\231e"
+	.ascii	"0\363\230\004)]\024\245\335\234\275\230\007]5\036f.\372\231\245"
+	.ascii	"\364\336;\201\017G\302(M\022\303\n\335\234\375\270\257B\217v"
+	.ascii	"\340\030\335U\337\361\341\276|\372\367L\006\035\376k_\223\202"
+	.ascii	"cF\346\025J}#\007\321\260V\f"
+	.string	"\344\005\264#\356\353A\324\341\262\223\273\215\207\031\211\325V\214\371\366\356\356\356\216-\021f_\263\002_\263\320\317~!\332\354\2036\007}\315\300\264\371\2076\373\320\346\236\2579M\233y\276f\024m>\321f\023m\266hs\367\232\277 \005\334\026\230\234\251\365\336\255\273<\027\315\351Fv\264_\215\017\346o/\306PX\245\250\346\365B\336\256\255a\332\027\363\342aX\016\001\344\355\202\361\265,\253J\301\274`\376\271}\031\232\025\271\027\346\037K}\215\337eh\006\005\254\354\336\373c\365[\242\202\256\220\227\313B\252\030\320\330\200dj\257\004Sr&\254\343j\320\304W\241<\373\265\353Q\217\030P\221<\217\252DhL%\373\25229\035X\022\037\263\352D}\242\245\344\331\345R\032\224c\224K\320\304s\030\264xfu\212J\245o\344\331\242 Y\326\212\205sh\354\344^\344\315\312\021\365]\255\202\242f\237S\253"
+	.ascii	"H\262\206\257\033\202I\324\002\240b\337\204E\271sV\241Q\231\367"
+	.ascii	"\206a\270\332{J\264\276c\013\367Dhf-\313<\355\321\234\017\300"
+	.ascii	"!f\016'\034\023\300\003\246\0056\234\2238n\323v\026\304Z1&\336"
+	.ascii	"\332\002inf\364\0356\320_{\232\207\364kO~\260I\020_C4\030c\026"
+	.ascii	"1\242o\264\226\271\304\331\230\260I\003m\255\233\263\340\334"
+	.ascii	"\265\223[B\343\200Ia\222\016\b,\356^\314\277\376\254\203f\251"
+	.ascii	"\024\320\267\374\267\023(fX+\376\333{\3531n\314\003NPM\226Y\020"
+	.ascii	"\233\214\244\236\222\240\250\216\212OPJG\305(\246\025CSQLJ-\206"
+	.ascii	"\"L(\232@4ULB\212j\241\202I\251\350\364\024U$N=\035\025\025\235"
+	.ascii	"NHHFf\022\f\245'\223\211*T \"J\212`DTA\374Y2Jr\202zBY\005\021"
+	.ascii	"\311\210\n\251\310\244d\264T<Rj!d\027MINE(\027.\234\212?\344"
+	.ascii	"\325\315k\211p\206+\213u\363\336{{?\236\324\247K\201\365\341"
+	.ascii	"\362\026\264|/\n\274t9\027\240\rn\365\226*v \t\264\217\323\366"
+	.ascii	"\363*\364g\277\3267\324\343\200$\216\266\241\352H\300\343\253"
+	.ascii	"\332\343\312\256C\376Z\353\347W\267\244\323\262\330y\303\263"
+	.ascii	"b\226Y\375j,\016\023\304b\303&'d}\366Zo\353)\251\363\262S:\350"
+	.ascii	"\236\345\273\251@T!\350\215BVB\020\267\203\370\372r\016:n\324"
+	.ascii	"\231\273o;gHm\317\n\325\260Y\367\\\365\335\220\276\001\200\234"
+	.ascii	"\250a0\006\221b\210FDD\244)H\322\001\220\002\231\251*z\022\340"
+	.ascii	"\204I\313-\223\321\224Q\250g\315G\354\342u\241\030@\341\020\356"
+	.ascii	"\306\376\236O\237;D\244(\241\2053&C\006l\006\240\300\265\262"
+	.ascii	"jN\004\033s ;\0220C\003\021}\223\201\270\301!\2348Ff\023\263"
+	.ascii	"L\262\2236h\364\002\363\313\2141ZC\307\344\212\214 \373\232\222"
+	.ascii	"2\356\350\2503c,O\034\b\307\345x\240\321\027\215\315 '\204\275"
+	.ascii	"`q\330\2328h\\0c\377\"\231\355\255\262)4\340r~\215\335\221q\363"
+	.ascii	"\351\205F\322Euj\330:B8\bH\245\367\322$M4\207 \222\211 \f\254"
+	.ascii	"?\235)\375\321\373\035\306\360\333E\333\200\345 ,o\271\005\027"
+	.ascii	"s\307\302\344\236\320\236\253\317w\234}\225\356\030o \217\034"
+	.ascii	":).\352Wb\253\326\332\305\220\266TR\210\226\314\356\206\223\265"
+	.ascii	"\257B\305\230P\362\243\034\207e\030C\320M\364\004H\033K}u?\272"
+	.ascii	"\221u-\017\363n\007\372\244\336n5\327\035\3724N\241\340\213\357"
+	.ascii	"\037t;\021\301(\364\017\200\276\273\273\221\347\t3\374\342\030"
+	.ascii	"\201\232\357\272gY\251\032"
+	.text
+	.section	.gnu.lto_stream_setSocketNonBlocking.45.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\260\0015\020"
+	.string	"\266\337mF"
+	.string	"\257(\035"
+	.string	"\270\0064\245\262\220\215..\370=rT\024\262\260j\2764\236o \261\305\336\3631\036\213uJ"
+	.string	"\304\n\013\277,\220\304\250\352\227~\016Yf\f\272}\3177\n\362\363\224\373W\333'\204\354-eJ\001W"
+	.string	"W"
+	.string	"W"
+	.string	"\377p\020\255\313\244\\\300\356K\216\315\356wr\201\356\321\3375\266\307\356\003\266G\267\354\234\177\033\226\213\361"
+	.string	"\243\201\261\273)\325\360\326#\324l\371\034\207'&s=\272\034~d.\327"
+	.string	"\262\025H\332\335\323<Yd\257L\216cw\2351Y\205{\273m\005\266;\354\f\005\316\364'\323\236\317\374\335g7w\231?fZ3\235\231>"
+	.ascii	"\320N\n\027*Z\"\234\330m\251\315X\024\321D\314g\277\375\323\030"
+	.ascii	"d\302P\262g\276\201[\323\321\"\204\316\356\226\036\315a\223K"
+	.ascii	")\277\213h}\3067p\264+\031b6\273{2\202\356\221\004M\024JO;\234"
+	.ascii	"~\3640\013\257\254=w\327\245\n\343\322;M\300b%c8D[N?;I%e\270"
+	.ascii	"\313\323\257\366\003\223|\214S\222\004u\331\206\360\232\023\021"
+	.ascii	"\316\356\036\360G\260P\b\340px\364S\266\307\253h\205\214J\326"
+	.ascii	"\034z\241C\333\331\224a\177\256T\030\373pw\327\372\342&\rV\""
+	.ascii	"\f\"\213\304S\25366T*\020\003+\224\007j4\262\002)a\231l\366@"
+	.ascii	"}\254P>R\016BV#\251\005!\"\032\366H@JR,\317+I\201\276=\\}qB\217"
+	.ascii	"z5\260\022\372QU\226H\353@\323Q\321\227\273T\205i\322\004\022"
+	.ascii	"'\027\245z`\364j\036=\354\302+k\tG{\337l\001  \220\202!\271\362"
+	.ascii	"\001\267\360\2427\302\366\3223\320b\3234{M\223q\236\367=\215"
+	.ascii	"\306E\270[\305\274\255!+q\340\326\035\306\001\253b\322\003}J"
+	.ascii	"\360\306\035\263\340J\247d\241\342e`O\360e+\001A>\340\263\334"
+	.ascii	"\200{[k\364"
+	.text
+	.section	.gnu.lto_stream_initSocket.47.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\375\002\205\026"
+	.string	"\006i\220J\300\322Q:\246\304\317\314(\241\363pe\320\013\030\fw\023\254\301\355\215L\354\373.\302!\205\334`\005\376\026}\264\267jf\200\355I\303\001\274=E\2518\3440\212C`\214R\372\027\037\224\021\020\317\350\242\271\265\222O\b\331;\245w"
+	.string	"{"
+	.string	"v"
+	.ascii	"\033BhiwW\234\240\374\330\032\321:=\221\277\342C\267\2376dO\265"
+	.ascii	"\343\331\360\261{\256\270"
+	.string	"@\371\321gi\333Wq\241\233\035\024O _\212W#\207\305\220\335u\245\374\204\374(\336\204\374XE\374\366Q\254\364\346\343>\376w1\310\210\220\235o\347b\271\363**`j\232\021\300\247\023Ux\200\376;\325\361\335P\232z\331]\323\235\317\303M\3366\004\333\021\354\312 \347\277z\213\277\374\321\237z\321ORj\221RSJ}\001\254\250& =\204\025\307\271\274#E\366\306(\303\204\377\342J\266\273\360a<\251\016\005\361\b\355.\013\030\243V\342z\345o\177\264Dz\240\3551j\357\225\302}P~D\372\342\364T9\274\032\255\217\255\034H\266\017=\222>\372/l6\353\343}\0277\233e\267\200\277\026<\032\020\2618\232\261 E\213\322\033\275\310A\25364\312$\303\245:\344\351@$\222\320U\265/\300\320\357h\025+\316e\212\254\216\261\203\224\203\256gw\rP\332\364t\326\372\343\333k\344\353"
+	.ascii	"\243\035:J\304\02729\275\3323g\252\225\273\213\300\227\201\301"
+	.ascii	"\004\240cw_\302\206\374H\203\273\247\034=\342\024-k\252\222\325"
+	.ascii	"\256\321@\277{\225\320\203Sq\376\357\016\206\013\365\2644\312"
+	.ascii	">oh\375\261/\356\356\272\372\330\0171\01310\263\206\2241a&\315"
+	.ascii	"\234\321\2242\032\033M4c\244[\\\\ZZd\007^,0\226\222\231\227l"
+	.ascii	"F\253!\rc\211\275l1W\006\230\327\214\253\002\214\314\211M\032"
+	.ascii	"\331\314E3\315\231\213u\346.n\365!@Bl\335U\307\266X\375\222\253"
+	.ascii	"7#\n\r\247\005\376\277\217\303\245!>L\350\004\n:\024N%T\345\253"
+	.ascii	"\352+\275`\364;\247l\2508\243\234P\272J\b\"\351e\020\250\033"
+	.ascii	"P@\016\\\325#=%\027? \220\002\241)\273\003O\242\336b\212>l\021"
+	.ascii	"{Zk\355/\333E\263\036\327\262\215\265\244\302\263\237\365\217"
+	.ascii	"\235l\3034\004a\276h\354\203\360\343\335>\242\n\243m\307\317"
+	.ascii	"b\213\3636\200\"t:\210\303\247}\032\300BO\031\026\214\330=\270"
+	.ascii	"\023GB\007!l\360\270\322\322\324Wx\025\177\302:&l\031\316\262"
+	.ascii	"\332+\316\210WH\3672\243\245k\355\225YY\230#\030A\310Gf\030A"
+	.ascii	"\f\305\032\007~L\022\332\376P7\321\350\b\f\356\001"
+	.text
+	.section	.gnu.lto_stream_handleReceivedData.49.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\003 }\221"
+	.string	":\342\0302K \222\322\031\016\374\346\377\201\373\026\016z^h\0074\f0\237E\322\370\233^\275\337\360\007"
+	.string	"\236\337t\301\003\362\331[ \372\252\210\337\365\236\315*\022\021\005\210"
+	.string	"\004 \"\001\3621\254`\341\237\016\306\343\020\211a\340\344w\333R&\031\017\003\332\002\033\003\253\346\274\371Y\261\300\246\271\2120tv!9\235,\274\315\206\246\365\\\203lS\326\260\260O\002\3110\t\026\316\345G\003UA\326\027~vkQV\253%\362~\373\2775\256\272\344\221\246\271\256\374\251G+\267\225+'I\020\347\332`\215\275>\036\347[\346\227E:\277 $\024\321\360\330\237\251\341<\303\343\\~L\341\260\223[\033\274\336~o\215\253\372x\227\315!\342\312^\323\307\276L\f\2752{1\037\343\343d^@\327/\267\325k\347\315\216O\204\342\211_\177.\224\312\375n\217\267\306U\017f\037f\325\025\375\341\320nmp]\327\032\336e\317\274]s\301\255\225\255\255\353j\374\342em\203L\371_\274,3h}\220\346\026\241"
+	.string	"'n\007\305\023\353\276l\243\226\203\f>\344\371um6\244K\035\261-B\347\211\001"
+	.string	"\"\367n{#\256\345t\001\004\"\361-\352\271\374\370Y\233\253\016\02250\347j\265A\361\304vS\n"
+	.ascii	"\316\021\317\242~N\206\257\312\265\310\247\026\346\\\327\345"
+	.ascii	"\005\305\023\321u=Q\272\312\270\001\271\273\352\261,\363k\327"
+	.ascii	"\372 {jb\023\024ODf!/\367+\3738\255\270\032\016\007\344\253r"
+	.ascii	"\251\203\265\006\216s]\335\026\370\225\032\214'\"W\344\356\213"
+	.ascii	"\330\023q+5\374m\231\350*\027\301\232B\347\272\256\310\023\027"
+	.ascii	"G\361\304#\232c\334\r\340\f\362\274\373\265\263\251o\263\341"
+	.ascii	"@\353\252\344o\313\272\272\t\260H\305\023\327\355D\351\211\305"
+	.ascii	"\013\245'\252\273I\234\270Z\247\nP\313\001\353\312\340\272\256"
+	.ascii	"5\232\007\236\234\303\303\303\303\025n\353Q\267\357\3206Q\375"
+	.ascii	"\013\027-\216,V\034\031\251H\201\342\204\211\"\242!\241 \240"
+	.ascii	"\237\022>H=<\306\235$\235bNJD\233\325\375\324_T9\032\345+\356"
+	.ascii	"\r\215\021j^w\321\302\210\037Q\026J\216<\337\\bA\217wd\260\376"
+	.ascii	"d)\307,\252\020\376\300+\332~d\326\305v#\025kT8\305\224\243@"
+	.ascii	"e<YJ\341\023h\2122\274!o"
+	.string	".\247\240Ie\222\3741X\0246\201\022p58\266-\232K6\224\207\020k\357O\226M\270\310Hm\f\033\263\256\266\023\2419W[?\274\271\364\001U\"t\322\235\260\214\207v\350br\241%\017\002\312i\300\254\253\207\377\244=Y\242q\t\364\330\\.A\217\353\272\262\221#\354\303\344H(\r\274!l'|\213\346\322\b\024(\211\337\333\351\262pOsI\026&\214yv\350\032\273\021\305\301\026%\355\315\245\030\332V\342\276\034\217\214wN5\366\244\271'\313#X\347t/\356\251\241\2611\353:\342\305\026f]_\317\301\n|\213'\313/N\337\\\036ADe\224\341\r\361\341\272B\211\312$\3713r)\031E\025\250+\262\365\346\022\f\345%}lNw\326\342\262\342\336\341\362:\3474\260\256\353r\026W\327\027\306w9pw\225\354\036\241\020\304\356\351kc\263\224\206]\313\022\017\337\272\256JChm"
+	.string	"h\3465W%5\3125:M[\216\203\223\252\350\202\007\350=\240\312\246V\341g-\332S\027b\205\207\034\004:\305[\337\001\327\001N[fq\021h\237\2766\032\006\003\377/\3027ln\304\372\202\344\0318@\337\351|\002\336K\020n\322e\246h\033u"
+	.ascii	"\324K\263\274\303\f\313,\356\267\256\373\212V\330\n\336\215`"
+	.ascii	"\202\364Y\335Fp^vOgUO\375BP\031#\366\331\362\300y\265\265\215"
+	.ascii	"\336\321Z;z\205\267>\245&\225&\017\231\002\006\355\263E\336F"
+	.ascii	"7\275\345Y1\341\002\320\224b\243\217\345G*.\\n\033\3759\2548"
+	.ascii	"*\030y\006\016\277w\351\273\\\213\005\305\254\367.\006\031\360"
+	.ascii	"\263\270\217X=\265\273\0330\222\016\206\320\326u\275\261|D-\373"
+	.ascii	"\340\210\217\211\r\351\211\357\241\2646*>\334&!\232\240\320\375"
+	.ascii	"hM \232\257\362\030f+\027\356\272U=\201)\"\344\272\317\366\374"
+	.ascii	"T\313\335s[\311n\312\013\305\303\253\002\020\257\023\017o\nC"
+	.ascii	"\274\311\035)\257\216\224\267)\345eJyQHyOHyM(!\345%\341w\337"
+	.ascii	"\245!\336\021\206xE8\230o\216\346\rA\210\027\004!\336\017\204"
+	.ascii	"x=\370\341\355@\210\227\203\037\336\r.\240@\202\273\371\342H"
+	.ascii	"y\0218\226\257\215\267\375\003\304\200\221\364\347\027)\345}"
+	.ascii	"\221\362\272Hy\217)/\013\036\336\025@\274G)\257Q\020\257\n\036"
+	.ascii	"\336\024@\274(\200xO\244\274&xx\213\200x\211\202x\207xx\205\200"
+	.ascii	"x\203\202x\201xx\177\200xK\244\274>)o\017\017/O\017\257\321\207"
+	.ascii	"w\347\203_\235\224\267\230\362\246)/1\345E}x\373\207\227S\336"
+	.ascii	"\253/\300\354\326\n\235j94\032\267u\353\320p%C\244k\302c?\230"
+	.ascii	"\377\356\327\373\375\316_"
+	.string	"\277\233\177\360\177\376X\376\271\237\313yv\277G\303c\313d\034\266,\326l\342\230\310\210\202\\0\031R\242\250\3659\331\b\323\013\227\227\334\305C\270H\253\301\375\021\261\032$\302\304Vadn^\177^<%\206\271\310p\305\201B\346\306[u\310\036\346-\246\317%\245\310\3348\007\246]#\343\360\364\302=\034^\271\212\225\034\204\265Z-\313Z\026\337\300\226\3057\244cSE,5\254\017\272\341+\266\262q\206L\231\257\236\330j\231\250\333\312\365-k\r*\030\322\207\231\212\247\266\356C\240T!H\037\376a\234\255\033\241h8\227\2641\205\354\341\033>}.y\302m\355*\240\214\314\332\240\f\"\310}\363\347\te\024Q\217:\353j&\266\005\311\340\240\232]\262x\242\f&n\234\204\2701\025\005\237v\215\007\334\007\25619\350\r]\320\177\"\365\005\355\324\013\002\250\227\rMX\352\"\320\234\322\023q0\263"
+	.ascii	"\205\270\226\245\"P\367_\037]\211\346\351\237V\272\242\204\322"
+	.ascii	"\323%:\001A\2548>\375\034\354i\237N@\320\3152\005\245\004\373"
+	.ascii	"Kg\351\351\376\022\350\004(%\310p8\t\236f8i^\\[\027\342"
+	.string	"\024\302\200g|\247\215\275lD\n\215T_\332S\034\304\312\215\203\232\372Y\2003\232\347\224\206UT\200f|\210\257M\307\rq\324\006\315\362\207\211\343\202h\366i\321\241D\23715\n\235\342m\314_\035S\263\032\2550N\243\226-s\317d\267\240\320\234\247\025f\344:q@p\221\027\333Pa\";\315^?R\2219s\031\233\267\316\227\364c4Ng\244\004o\3040\366\013yO\r\3535\245\004\317\004\342\002\367W\266&\265f\267\256\210\244+\tm\200#\325\230\255\353\341\223b\303b\226Y\224\n\344<)\301\013\242\375\314N\237P\314I\357\233.cD\370\370\354\001\232!\265\022!J\256\037x\220?\336'@\342\020\013\211\235\031?\241\265N8\230\037\251\356\300\234O\347\222\236>[c\032c\t\335=$!\237\243\265L\350\034\375\035\336\360\336\360\3352a\204Q\247\214Lh\030imTh\027\263\034\335"
+	.ascii	"\025\272\256\353\312SB\037\314\214\347\350\022\372\312\262\252"
+	.ascii	"0\177\223#\317&\0262%^\214}V$\241\233\236\374e\231E/RrR"
+	.ascii	"\205{&@\322\023I\350\241\276\2661p\226\372w?\216\320!\364R\037"
+	.ascii	"\216\022\312\t\021z\204\034-B\247sXq\340p\027 4\320\300\254\324"
+	.ascii	"!\323\251SH|\304\020\232FZ\033\336?8\334\362\004l=?+r;7\232w"
+	.ascii	"=$\265\022\001^\354\246\267u\200\267\024\273D_\233\216!\013\360"
+	.ascii	"\273\234N\325\2418\300\225\212\005@\363\320\306\r>i_p\264XP\002"
+	.ascii	"mU\255\3239\231"
+	.string	"\311*R\310XT!>|\353\252|\226\272UT\036+\206\312u:\325\253\237\227U\344y\205\210\n\226\356\252FN\247\202\325\020;\335\252Y\272e\356\r\235/\252\367\031q\362t\376\360\003k\256R~\277U\311\376\267LF\353I\033\363b\244\311\005 \177?ns\332g-\2571\333\322\252\371\237\252C\017\332\252I\375\324$\352\231\262\247\266h\310\337u\274x\245\271\216\017j\35330\347}?R\275\001\201\007\216\262\\\350\216\266\371\302{Cc\004\340\013\350\272\2321\340\264\302\207\373As\320 4\233\341r\245\330\032$a\n\325\266\254\273\f\034\036\206\261ZW\252\027\036\364\007}\345\223\016\332\203F\347\322\276\247.\351\240\215\322\3326h\016\232\315(\235\327[\325\207\357\251M\212\033\264OZ[\216\232s\0200\006\327\370\315|O\005b\257\247\006\241\016q\274\352\251\215al\357\377r#v\034\260\2168\237\201"
+	.string	"4\003\323v\262\314b\317\263"
+	.ascii	"m4\261\323\356<eY\025\037J\341\037\002\233\354\361\324\302\036"
+	.ascii	"w$cxJ\352HB\371D\365\370\341C\007\221\006\030x$y\020\201D=\351"
+	.ascii	"`r\201IGQ\205(\247\036\311\026\322((\246(\030\210)\374h\352\244"
+	.ascii	"\013@\242\320\030\2428\252G2\206$1y\246(\246\035h\222\206'\030"
+	.ascii	"P\250d\217d"
+	.string	"\024\fO-\024\237\276J\007\034\240\244\224,\200\211\206\016\032?<\230\222PQ0\244\253\203\306\016& ;j\364xb\342Q\243\351\251\005\242\365\341B\022\252F\224\017\037P5\214nTo%\273\rPu\225\316\013\256+H\312\330\236j\271+|\241\003\307\345|\002\312\360\203\313Ow\240\002\236\230A\302\305\213\236\"\305E\277\350\003\324(\235\364\020\313l!\244\004\033\356\215\213n\270,\254+\246:4Ts>\235\032p\262U\350\024z\031\007\2512Rz\0347\206\214S\247\320*@\251rj4\017+N\003\241\2269\311=\231\236\230B\3378\022\247\025\326\311N\313\016\261\342\3504T\353\350\031\216 \241tR%\006\207\353\304\345i\275\330\206\315\3113P\2479\353G*\306\342\253$g*\264\377\260}\370\r\257\326N\234\232H\t\336X\0356Y\326\222LzI\367\220e\355\205\315C\357\320g(\270dY3"
+	.string	"\211\334\231#A\354\322Z\364\231\3312\213:H\t\262\340#B\233\001$wF,e\242\204\354\270\"F\353\264\326\f8\2618+\216\r\325ZP\255\323+<\312\0310\036(\206p,\320#\030\355\003'&\206\b\371\030\255\3253\345\210\202\3564D\310'\265VR\037\373B\364\221e\316\350\262\025\307\236\321\327F\025\304\247W%\211\373\203e\302\004q\304\212>\333!pG\264\030I\320\213\026\305h\030\024\364\237\024\364\213\354\364\2524a\364\007\231N\360\r\355\b"
+	.ascii	"3\200gF_\327qZ9\303\325D\020OE\237\261h\032:\214E\027\365\035"
+	.ascii	"J\320\037Lj\t\312\252\0069\214\301\336\244x`\211\210\217\005"
+	.ascii	"Z\233\243.\352\025\315yJ(UGF&\370Z\220\306M\264\321\371\364\002"
+	.ascii	"\213ul_(\372l{\276\224\252\350\247\251@\005\212.\352\024\352"
+	.ascii	"\205\322\023\215\242\321<e\231\211>\321\250\232\243X#kr\302D"
+	.ascii	"\323\360&\306\212\t\331\230\270\201\301\226\231\324&\232\005"
+	.ascii	"\225N\252\362\212\232\301\234\230Y\200D"
+	.string	"\215\243\213b4Q\263\031\2548w\275\245\n!*\302`\252\227\017\032\317\201a0\006c0;\006\343\2603\330\277\005G\306cc\253\2221\031W9\362<\326\312\276\3422&\033c2\026c\273s\330\217Tvz_\230\274\004\032\021Z\233\272\346\312\007\262\323\353\202$\3027e\242\317v\347K\351PC\275\365\031\346X*\016\365\265\302\202\032G\013\365\223:\250\371\nV\0349=.M\346\231\224\253\242>S\240\n\216\276\233\033\200\204\212\013\017\235X\360\305\221\022,\022\361\341P\322cC&\200DI\217\nQ\237mN\032\241\013\272\323 !\217\324Z6\032\251!\300\263bB\364\016\251\377\374\225Q\002\202\327\250\"\341<\213\322\244b\206DFD\222$I\007B\n\020\fcq\036\350\322\007\022@\245Aj\235\231\031\021\221$)Ha\232\003\362\006\341\221i\357\322\027\337\202X\037~\271O\307\273D\316/f\324\225"
+	.ascii	"\224\323\313+mD\362\004T\323\272\240\220\240;\r\006\244XgiB%"
+	.ascii	"\303\n7bPE\021..\243}\032\226\022,\326\001EJ\326\236\252\347"
+	.ascii	"D\027`\274\307?\006x\3070>\357\362 \377\023\375\023\267m\032"
+	.ascii	"\\sL\341OlT\367\327\026\362x\356\345%\021p\346u\363\"\357lm<"
+	.ascii	"q\242\277\356~\003\223\240[\265p\352_\250\203\036ZGW\327\324"
+	.ascii	"\212\221\232\255\341\317b\237TJ=\314 \225\036\b\326p\326)\255"
+	.ascii	"\277Uft,Q\242\343<p\373\321\223\237\254\253\267\220e\177+s\027"
+	.ascii	"\361\266\215\024\213\2552i\270\t\341\310\313\375y0CC\241\342"
+	.ascii	"\230\370;9\237\354!o6\024\031J\3466K\362\232\366\t\002<SP\321"
+	.ascii	"q{ G\314\376&\260\315\372\341-\033\177\0233(\003\272\315\254"
+	.ascii	"\207\300\275\233\0162#\356\231\305Ua\324\342\203\377\330\352"
+	.ascii	"'9;\262\327\203\020\265\020\277g\305\204\2560\026\217d\2703\322"
+	.ascii	"\355\b\332v\267\034@n\354\343u=\254G\231\204\211\223\212\365"
+	.ascii	"\311\037\257q\035\252\210mh0CZ\334\227\037\235\307\201\004\365"
+	.ascii	"\323\2436}\b\024\366#PE\212\250|h\242\0309\305\240\017\361F\001"
+	.ascii	"\233\237&\025\t\311\274K\230DD\334\233!(*\235&H\335\201B\355"
+	.ascii	"3\r\276\005v\320JC\356<Y\r\376\255\202eB\222\027\206y\006\221"
+	.string	"17\r\331\322m\\\235\313\371M\227\207rRD\026\017\205\373\303Z\2772\"\036\360D$\354R5\361P\221\357\363}q\3705\254B\206f\274L\322!I4\355\215\214.\372)\n\225\007\341\016.\025K\003\n\233\n\006\273\036\263\033*b?j\b'z\022\b\177\r\211\214\355\314\037\345\366O\336\0349\257\367\362\343\025k\246\272\326\024I\t\231\216\276J\364\031\317\330k\244\307(\222M\331\252B\203\f\372\325\272X*\0334\373\365x\211\266ZM\001\302\036\0216/\266\372eR\275\025G;`\2078N{~\341\202\002\320m?\272\247\233\341\230>\004\210\036\006\333-]\037\022\344M\241y/R/\262`$_\226~\204\212do\017\reK\034\372\351\350\364Yc\215V\t)t\32043\203\323%u\360Wk\327\240\203\340\225F|\331\275\364\324\022\336*\r\t|\322\225W\243\274:.6W\351H\201\257\034"
+	.ascii	"\305\023C\274\271\265\311)\325\373l!\207l\004\202:\365\024\212"
+	.ascii	"\2214\320=\340\255Y\216\210\244\"2\356\206\227f\234\240\277\006"
+	.ascii	"\327u\201\231pP\0222\265P\025\f\361\3508\274H\332,h\204\323\364"
+	.ascii	"\006~q\"\376\b\273\022\226\325g<\3176P\253#\n\\5\035\t"
+	.string	"\006\316n\261\202H6\226\200\231*\005\3206o\274\346\344\230\333\273U\370\022\326'\212<!\262\357\237\016\260h\300\027\227\3478+\336\013XR\200`g\016\3518t\t%\266p\223\267\333m\314\224M\f{W\224x\305\270z\220\236v\311@\271$S\304\003L%\0160\021\215\202\177w\212\345\252\261\303\027\260\336\375I\327-n\275\033\344X\375v.\bg\327P\316\fw\214g: \335*\360y5C\303lF\264\341"
+	.string	"SD\300\344i/[l\217\255D\252\227\267\033n\362\366M\276KQN\340!o<\2369\032g8u\332\344."
+	.string	"9\036\345\034\334U\003\r\001\t\240\020\245\321\255i\366!\227\356c\025\320\304\207\361\274+\302\255\366&\275[H\312\357\262,Jz\206\3509-\362]bD\302\326\260\257\243W\355&#C\250\336H{\204\277\255Y\241\270\330\272V<\261\235\275\n\365\314\255\241|y\201\001\224\360\022c{\032\217fG\365\270\324"
+	.ascii	"\002\022\306H;/eo\001\201\374\030\365<\300\204\211\240\200\216"
+	.ascii	"\215\363\344Z\366\327\213\fG\210z\210\261\343\263\271/.\027\242"
+	.ascii	"nw!\177\tx(\371\325\306\204\251\302\251E>WZ'\310\260\260\212"
+	.ascii	"\233\343\021\315\036)'c\223\273\322~\2349\004:>\231/\232n\233"
+	.ascii	"Z\004\201\341\330\317\007\341\244\037k\004\204\214fbK>\316\365"
+	.ascii	"\002\304\242?\354)\266x\344\265\336\\\325\231\251\271\224aA\266"
+	.ascii	"\366\345\013\375C\340\0025\225]}`\370th\324\2719\035\243w\376"
+	.ascii	"\2479\324m\340\300\275!\013\036\3323k=\301\017J\024\350 .j\271"
+	.ascii	"\246:\207s\231=\211\222\324\243\247\036p\245\356?\tQ\375\f\246"
+	.ascii	"\213\237\270\005\013\340\245>\004(\"\032\306\236TaR\3167\353"
+	.ascii	"z\277\017\2170\372\214n\177\267\221\b\212h\r\334\330\332;\325"
+	.ascii	"\013\b\340\264{\303\035\240\331\224\034Z(\363\300\036\225\267"
+	.ascii	"e3c_.\231v\3640\235h{\001'D^(\363dR$GK+\231\024)=r-9\363\315"
+	.ascii	"!\3046\321w\323\264\212|O\232\311\026\375Z\262\360\r\216\244"
+	.ascii	"'1\234&\252W0\214\246+\367 %\321W4w\347\333\354S\346\006\256"
+	.ascii	"d\371\227\247\213\245\270\3231\276[d\205>v\315\002\344\345\362"
+	.ascii	"\252\277\004V8\210\240\213\t\326,\346\204w\022\007j0\274\336"
+	.ascii	"\372\320L\207^\243V\262i23X\3003l+\251X\357\306\251<\323\027"
+	.ascii	"UN\332\365\374\035\001"
+	.text
+	.section	.gnu.lto_stream_acceptPendingConnections.50.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\307\007E/"
+	.string	"jQ\350\021Ip\032R:\021\367+\336-`f+\250\243H?h\037\323Q\037\352\373{\270\204f;\360\300\213S.\024nc\304U\351\335\271#\2412\323\262\264\334e\177\b\305\"\353\226\302\037%\332\346\320a\033A\351c\327\311 \204\354\235d\005\001\376"
+	.ascii	"\r\0017B\246\234]h|`|\2777C\272W\322\201d\216:\2235\316.4Oy\210"
+	.ascii	"\370\372\311\276\224O\371\362d<E|\335cI?b!\261\2349'AlQy\225"
+	.ascii	"\366b0tr3\353\252\220Y\316\314\004\365a}\212}x\240(\233)\343"
+	.ascii	"\013\222H\207\365)\017\231\357Q\016\326>\214\370\034\225?\303"
+	.ascii	"\nY\304\231s\366=m\f\353\323\036z(H\335\273\247w\327\315C\345"
+	.ascii	"\373\355~\327\237\264\367J\272\200\234\255\322X\31199\241!\254"
+	.ascii	"O;\371\002\352\323\365\003\324\247\335v\2239\320\224\225z\220"
+	.ascii	"TOR\320\344\234\177xH\343\333~\275QS\024\337\266\257\364\365"
+	.ascii	"_G\233L\231\201\301\211i\335\370M\002d\026\271 QRW\237vG\247"
+	.ascii	"\233\242\030\2364\311\302Q\246`\271\022(\251\213\242\f\254\200"
+	.ascii	"<y\307&\264\327\346\366t\262_\032G\246\213\001\034o\374\336l"
+	.ascii	"\3109\3675\036\243\336\272w\367Tw\327\350\276\321\021'\252;\374"
+	.ascii	"\003\026\206\351\246\351\253\\\222|\316\355\360\303\336+^5\315"
+	.ascii	"\273}V\355\257P\217\273\203Z\334\033w\270\347\204\225\272{\350"
+	.ascii	"\\\210\n\260r\316\026\372[\204\204;qF\222\324\247\307\n\262\274"
+	.ascii	"\212\267MGx\303\342\253PU\274\242\002\215\354\307z"
+	.string	";k\376\353;A\362U\323\235\\:\232s\316\030_\365/\217\227.T\032[u\353|\354\315\303y\330{w\257_\267^\371F\325\333\370\346\366Uo\337\001\212\324\362dV\003\013I\205\341\222\331F\2335\331-ECr\266?\354W\376b\377\330\373jg\353\267\365\256\333\243,\370Xf\325\376\276\370\324\373\265\243ci\346\241V412\234#V\265\243>\363\347\364u\237yt1\030J\030\326\250@\371\236\206\364\262\276\225\243\221 [C\325\225s\336\235\365\230\222\371\230\345|\370\376\f\351aD4\231\217g\263\306\3315\341\251\031\232\245\2229*\355W\273\245v\267K\276l\267~\\_\366\230^6\263-\350\244\372k\257\241\344\202z:a\2409\007\321p\266\337\031e\212\314\317\326\255\223\2675\363\346\250\355h6\270=\3576\325\367\263\275L\373\3257\366\345>\307\241\257\345m\035r\260\214=Fe\363\360\301"
+	.ascii	"\216\266\353\324nd\271\356\210V~\226\271_[\021\325\314gw>\235"
+	.ascii	"\bn\b\021LX\251\031(9p%\234\207\373i$J\334\033\273\327\324E\253"
+	.ascii	"\231\326C\027C\304\211\353,\037O\273\256\013\020\264\257g\236"
+	.ascii	"n\3172g\357\025\315\"\274\265iNx\267\211\207i\346\372#\314)\020"
+	.ascii	"gFM\223\207?F\340v\237@qo\344\341\fUKX\t\200r+\211\342\rE,G\246"
+	.ascii	"u&\305W\335\335L\025\007\263\300\312%n8\370\312\343$\317$\305"
+	.ascii	"\203\211\321\314\027TF\372}E}\212\203s\300\300,y\b\270\335)\200"
+	.ascii	"\352\215\027\343\270g\222%\254\324>om\315\333\304%s\241\370*"
+	.ascii	"=,b\203A`\217H\330\033\262=v\bd\215\202=\341\260\007\304\n\005"
+	.ascii	"\001U8h\"a\3200\310\022\021\t\203= vX\304\006\203@\002l\021q"
+	.ascii	"\210\262C\341\020k\244\26272b1\220\212\026A\241\013\265}.\\\360"
+	.ascii	"\361a{\200\024\202\024t\206\200\254\321\320\205\332A\n@@\"\320"
+	.ascii	"\217(\b8\364\373\t\022*\320\302\"\326\3507\024\n\215~\273d\361"
+	.ascii	"\033\212x\211\354\017\216dnTO\336\311\245\025_}]\247D:\237sY"
+	.ascii	"\f\253Q"
+	.string	"Uq\335\340\253\266\341\264U\226\362\260\016\246\321h\212\342\325\007\016\331sW\374\262+\243\235Z\200\325cub\261\363T\347G\013\004+\235\344\347\034\002$G'*\276j!\344\221'3\024\007\003!\211<\231a\337QL\243\233\307\370\3476\021W\214\003\204\361ZA\365\273/\373\262\303\252\023\322^E\200\233j\346\356v\310\227I\001\262\244v4\363\315m\026/.g\247\033\333\"\253\223\211\235\366\310\227-\022\374-F\035p9\264\276\220_\006\200\253\250Q$\347\230B\b\215\314\210\bI\222\244\003P\0021\250\254\314\003\021\260AED\2553\007\214 \365\336G\250\007\350%\330\004\230\236\230\265\332z\264J\236\021a\227\231=\200\004.\261\017\324\306\261AsP\260^\261\371\020\260D\206\022\340\333\266\276\204(AA\020DU\031j\223\002\3509\227\006lV\001\214P\333U\234\353\361\351\214\257I@AT0\221\204"
+	.string	"\202\357T_:\232)\253\035\374\025@\362b\223\030\017\247Q\242\362\352\342\t\373\355\305\211\331c\004\216 \347M\220\303\226\036,}\213,\253\207v\220\224(LX\307\240gI\346\241\257&A\300]\036\341\234*)\343.\257\205\247\235\256\277\2154\251E\303\336\200%\026\224\314\315\001\221\004\241r\317\261\210\347K@\325-\264x\310*\274dV$=\032\312\232'\303q\255\270\256\252?\354\244T\230\240\256\302s\364hj\013\321\225\230r\305\255r\250 H7\254j\326j?\005\306\006\373;H)R\\"
+	.ascii	"\024\215\325z\234\f]\245M\3525\375!\317T\313\265XAA\360\007{"
+	.ascii	"X\016\302N~\257\314\375EH\034P\201\273\022\263\335R\353\335\327"
+	.ascii	"\360\360\230\233\215\371\256\245_[\232\210\b\373\361,QW\205\261"
+	.ascii	" \346\337\355\177\033\024\246\324pli\230\204\\n\005\t\373\251"
+	.ascii	"k\2534"
+	.text
+	.section	.gnu.lto_stream_flushWriteBuffer.51.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\372\017\325L"
+	.string	"\n}\234\033A@dN:/\216\025z*]\2170nQ\bo\232"
+	.ascii	"lh\377#A+\024^(\200\270\266O>\236CI\214u\177\t;\300\3418\341"
+	.ascii	"\217=\325}\214Lh\240CC@\005\033\332W#\226\220\275\223\f\244\001"
+	.ascii	"\207\001\265\001w\317<>f\362\370\b\235l\355\321\263e\217\236"
+	.ascii	"D/\013<w\256\332\220->\236\035\277\323\3225\372:o\367\246\250"
+	.ascii	"#eRG\332wGBb\350\226!\205\370t\346\364\235\n\020\303\263vq\302"
+	.ascii	"\316\332\345\023A\344\331\2531$\213o\267\343q\302\004D\337\263"
+	.ascii	"\tjzo\202g\273\003\234\035\335\304\327\365\3354\261]\261\267"
+	.ascii	"\3516\356N\214\332\333\373\276\201\310>\232>\233\251A\344\327"
+	.string	"\264\364\b$\372:\205R\324\356\274\031N'F<\313\300\017\262\373s}\271\247\021\273\032\037\353\213\026}\217$\311\335\241\276\t\276\257\031\362l_\030\236\375\013\340N\335n7\261{\212\212<\356>\334\317\270\217\3768\323\373N\341\263{\337\350\203N0<\333\321aw\367\313\374\315\355\226~\b\242tB\350\222\327T#\370\276\257\325\361P\302\263\353\235\204gs\225\273ob\002\260dT*\022\223\220\206\255\220]3v\373I\316\26171E9\203\036\300\322z\325\306\t\347S\263\347\252\364e\020\227\377\255a\343z\234\232A\327c\234\032Vz\362\"1\312\231\223'\255\006\246\254\r~j\226\266\036\365\3505\317\305\254\tF:\233\207X\256\355\2219\223|x \312\031\332\333\346\n%\350\007\270\230\241a\341\225V\316\256\016\324\366 1:\231+T\037)~Dg\020\274\256\n\372H\361\373\324\214\311\032\245\266\007\311\331"
+	.ascii	"\301yU0fQ\235O\315\236\254QsA\254<\356x\210s\211q\253\341}\337"
+	.ascii	"\306d\316\263\267\323\273_\241\273\315\272\227\030\004S{z\244"
+	.ascii	"\362\327\374\250\304\214\272\315R\371o\232\217\006`\344\327\314"
+	.ascii	"fa\356\036Q\002\237\254\315\307f\036\353n\023\257\236xzJ\t\363"
+	.ascii	"\023\024N\211\342\216\270.4z\300\346\0139\257\031\253i>b\363"
+	.ascii	"?\367\354L\177\347f%N\316m\215"
+	.string	"|\316Qr|\200\340E\335\235\342\213Z*\365\354\025\037\324:k\314Y\n\n'`\217\316\024gEE\352\311\f\375xK\205\3178\3437M\264%\256v7\213\007\266t\370\276/V\377P\210\344\020\313\017\341\331\347\"\037\234\022W\373qG\2323\363\016\032z1\243\356\350\022\347\266\356\347j\265Z\355<\245\333\210\033\313\210\233\202\021\367\204\"n\tF\334WE\334\021\210\270\253\224p? \342\246J\302\215lq;hq7\370\232\267\324\243\177T\213\033\252\305\375\324\342vjq7\265\270\231Z\334K-nc\213[\251\305]lq'\265\270\221\204\270\207E\334m\213[H\304\315&\341^[\334\271\305\215[\334\317\200\340\312\2327F\177\272\344\345\275\350k\244\332\350\325c\347hy\335\357\367\257y\356>`\277\320\240>!\034w\201\r\230\177\r\232\310\356v\223\226P\273\367\365\0055\261\335.\276\354\214\343GM"
+	.string	"\210<>\265\353\321\037-\336;\005\315\220\001\334\353\352\007J\320(P\337\317\377t\035\220\327X+'\b\b\215\341\331\034\315\272\223\360}v\274M_\316\357n\347y\216w\275\354\f\320\b\331\b\205Sn\001\0244\344"
+	.ascii	"[\375o\356\306\315R\347jq\267\034\203\344\261\326\341\304\315"
+	.ascii	"\217\226(m\372\376D\232k"
+	.string	"\200\203\207\246\372\236,e\250\022\325\230\2272v\304T[\342j\027\\\305\230\225\370\372\322\374\212J\271mJ1+e\013\216\230nQ\240he:\334\250\2303\035\264\273\355\344\260\r\002*\300\310\\\225\251r\277\217\033\306\035s\272<=f\036\353\007\231*We\374\206\351e\371 \257x\315GJ\254\026\202\253\217\245\357<Lx\226*c\255\321\ri\342 #\263P\255\352 \363X\213\303tk\371\3649\022\035\336\364\325\3730\320\214\333\340\241<\344\277\207\352\307S\344\257s\344\247\363\243\022\355\267\273\2230\0248\215\253\211\026\205F\n[\242$\211\326\245O\246\270\243\262\r>\353\273\"\225\254\333-\203\235-5\323:\"\352\007\310\271{\252\275\271f\272\357\206lg\n\236\020$\260e\365%\301\260\226\307F\314me-\035\022\3212\360|b@\r\314\352sv\2649V\227$\225\223r\0139>L\326\322\005XH"
+	.string	"\352\373\276Iy\001tj\257\352\210\212\236 \244\030'\002\250\034\036qT\356\367m\340\200O\326k\036S\240h\254N\333 G\311\361\275\257=`f7\310F>\270\036\202\202~\264E\212\316wb\323\016\333\340\241\250|jq\356\214\333\240!\013odm\302\334\366/\355\274"
+	.ascii	"b\211HY\030g\310\017\037^\332h\351\260\337w\302\263H\371xC\232"
+	.ascii	"\020\300\335 D\bO6\314y\315\240\3332\217u\326\036^\333\021\302"
+	.ascii	"\346\317*\225[\310\341\005\235\004K\2768n}yu\035\277\274`\034"
+	.ascii	"\305^$\267\276\2169\270\216\005\266n\210\201\255[\007\263\021"
+	.string	"\346\345\202\005\373J\202\345`{\344\350\332\352b\305\300\270\\$o$]\fe\200\305\260\261UC\230\004K\276X\267zp\345Xu\200\341\316\262`!+kkB\262\312E\025\200\256\344\326\027X\016a\273\250z\221\024{ae\203+\331e\325\202\253\006T{\335\330\372\262\002\363\362\372\262\"F\225_\337<\245\214i\247\b\023\025\022\346\231\",\362PyHwC\345\326\240\314\313\365}\337\267\t7\322R\227\306\344\227\001\177\320\377\334eT\020\2679\325\207g\372\342:W\210\221\372\276\314\223\271C\206\314/\006n\331\377\\#\371\211G\246\304\316\364ur\035\371\037W\232$w\231\b\273\335%\377s\231X\245\375\257\377p\364\335\356\223\377\265\264\261\220\320\224\270\372\342\234\224m\020P\330\335\370\f\206\263\372\203l1>\263\206\341\224\334\211\016\317\036\225\322\247\374Fu\247\374\2241^\023\t&\343D\347U\002\335\312"
+	.string	"x\371}\t\n\210\346m\372\016\372\377N\234\243c\007X\210\320\240\037\313P\315\t\032[\242zSn\341\001\203i\312K|p3\304\374\375\317\276/e\322\312\214L\330\013\356bd\312R\320\243\365u\311\317D`\322\224\260r\267\013\005oi9Jl\276\0066\241[\356\265\361\261\276o\224\f\257\373\001\321\340jS\310W\031+c@r\316L#\304\226\207\321\026\273\267;C\265\232\007\310\373*\021L\310\024\362\231\\$\344\ty}#\345n\3346\t\231@\204|\2251 &`]\273U\356\306\r\201P\250\201(\307\224SjDD$\210$I\222\016!\205\0061H!z\022"
+	.ascii	"\2255OJc4\n\n\322\244\316\306\032C\224\325\343\331\205O\216\252"
+	.ascii	"\355\377\321\343\032\031\305\236\321\tm\240#\353\241\356\366"
+	.ascii	"\365\3057\265\254c\367r\273!\311Q\214J3RxM\001\217X\362\250\211"
+	.ascii	"iL\345\311\276c#?\333q\\\b{\233\305\004\337$\001\324\223\271"
+	.ascii	"9\361TGK\325\2141m2\374\267\332\207T:\351\023!F\026\254QB\207"
+	.ascii	"\025\264\020G\225\330\2125I\032\251\357\206\231\371\371\206\344"
+	.ascii	"s\211r\360a \366\005\372\267\226L\247\002\254Q\345\316\345A\225"
+	.ascii	"\226\261t$\333\372y\217\032\231\006\021\331&Q'`\277gH\331F\016"
+	.ascii	"\r[\242X[\366\233h\357\351\315t\274i\360L\365r\256^\\"
+	.string	"\004\247h\333\340\313\260[-2]\276=\264\025S\267\2305%9M\214b\177\356=}&\016\036\025Z\346T\202\323\007\274\261\b\252\037\365\332\226\373g\004\325:\377Y\314E1\261\345\246ODw\317\206^N\250\237\326D\247N\253\323=\375/\024\370\2468\261\376X\224\261!\310\267\031XW\263A\201\355\343\221h\245o\234\257\256\340i\347\362\202x5\f\233DF?\216\317vN\317V\007.\363\00482'W\221\217\216\244\363\230-cK\356\334\323\b9\001\344K\230Z\315\307\234z\002\254[^\240\261\310\255\211\200\213`\273\277<\004#\230u.\237Uj\210\263\207\332\312\313\206\337"
+	.string	"\245\266\017k\304\276<\334\311\353\032\330\343\377\374\025\301\026\bv\037M\313\312=\350PJ\016\2015\230\241\"\340\035\n\362\316d\004#\2219M\2401\213\263\004?bY\036\023S\t\225\032|\330\207\216\366\017\3349\301P\n\327\373\r$\037\243\205\0028?\2139\250\n\013:\275q?4\255,\366\347>\316S\315T\003-;\214\246\001u\243\356y\373\300\262Z\302\347O\334\001\341\233\320\225\002CH9\234\203\267\273@\356\003\271@\001r\233\236\200q\035\250\315\362\341"
+	.ascii	"2\267\272%Y%\035\374\306\226\"\352\364\236\020\372D\315=\207"
+	.ascii	"x\371\245X\021\202\3559\341`\330\034i\370-U\025%\016\262'cx\374"
+	.ascii	"8\r\237\b\026\321\002\364P\232av \2664\332\302Ce\037c*}\r\361"
+	.ascii	"\240dZZ\211\300NQ\263\206#\250\342\253IG\273\344)\022\3540\021"
+	.ascii	"\237$\037\277\b\304/n\214\b\371X\347\324\355;#'\036\262\372P"
+	.ascii	"\356|\024v\270\t5\005\346V\332\216\200w\003\317\235\234\222\312"
+	.ascii	"\271?"
+	.text
+	.section	.gnu.lto_dyad_update.52.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\332\037\025x"
+	.string	"Z\261\314'O0PR\352\366\343.Y\301\231x\252\215_j\374\237j\273j \257\256\360\002g\2460VH\221\r\013\204\301k\024\241DC\205yk\313V^\022.\016e\t\302"
+	.ascii	"\250 ,aP\226<\025\200bDJ7\270&\222\367\364\220\031\260\333FR"
+	.ascii	"J)l\0029\002u\002\027:4\335\"\243o\3646\016$]x\327{\3176 \366"
+	.ascii	"\260\204\024!\306\366\036\263\371h4\215baL\031\020{\370Se\323"
+	.ascii	"\264Z\216\270\257\001\\\271\036\265A\263p\347a\351\273\306{4"
+	.ascii	"\270\253:n\353\\\323u\017\217\006\207g\205\273\n\327q-\367hq"
+	.ascii	"o\334T\330\310\314\266v\353)\25757\204\241M\345^c#\331\223\033"
+	.ascii	"@dr`^'"
+	.string	"\364\030\267\224Fk\036\036m\316:\005\246\226fCL\350\305[-\315\006\337\005Df\222iz\241\256\227P\353}\306m\326:\234\320;0U8\275P\275u+ \3660),\213\242$\274R\261,\253\212#BC\357\262(J9\323\033\355\035aS\024=d\027\r\345\004c\017U\230\t17\331\t\375\344F\264\005\005\304\036\276t\016\275\244\235\260\261\304\016&-\306\354&)\310\334\352m(*.\035\256\367N\037\230\022\251\204:\254\2250{\252\202\360J\247W\007\214X\326\037\330\337\275P\023=\344\006\210=\354\3336m\017e\232\246\355a\t\"B\375\325\r\306y\304{\177\310\344\300\004\350!\003\021{\310L\346\274\236^\335\034.3''\177\367\336\240\237\201\177\330\370\314\006\372\361\351I\222\340\031!\"\304\216N\016\316\215M\r\r\210\031\231\017\310\230\243\021\246H|i\207\302w&w\331\333\023T\263\201\244"
+	.string	"\361\237\227\005d\210\226\265O\224\356\211\262\005\205\342\311(dN\202GI\230\217\310aMD\210\244\02029\260\354\0264\211\357\340@E''I\343\bI\f\t\222\355*\324K\230|\223s\352\354\021\277\3712\3426E\252_^\243\244i\224\020q\0204X\273g&\271\005U\3422]\205b]\371\007\341"
+	.string	"STvt\025\032DhcE\b^\347u\317\026\024\313\221`SYXJ\2061\237\344\n\366U\025-\353\243\360\245)\207\221\256B\177\b\225\200\327\264%7\312\020\225j\230\026\212\005\340 \n\271\004\265^z\252\242>\272\025&\253P\037\302\344\275\327\b\365\364\241p\200+\332\026$T\223\320&\207\221\247v\322\316\002\324\323\205=\230\272\n*\205\201rj\217=\330\340\203{\252\240>\206\337N\372\001!F\310\300\262UQ\251\366\227\005\356\275\354OP\321f"
+	.string	"\232\371\217\314<\305<\002('\216\030!b#\006\001k\333v\247\345"
+	.ascii	"3%[\355\360\215"
+	.string	"Pl]bX\230\034\260\313\261\230\nt\305\314/\277b&\351\241\215u\370\r\365\341\367\325\b8\331\3050|+6\321\302G\022\263cr@>\321\377\302\377,N\322%\037\314\301e\370\277\261\013\233\222t\177\023\335c>D\b3\320\300\363\233\314\354\200S\3318Z\017\270\272\367\372\027\233\354\316\315}\264\2145\271\246\013\362\033\024\222%!\020\366)a\327\223\024\247\270\253\341^){\017o\246\266=l\252\313\325\245\006\030\030E\323k\356\017\256\300\353\245\272\002\370\016\356)\342\325\205\336\351\025\300H\365\364.\314\f\201G\231J\274\367\262`\207b\342\020\0011+\205\266\207\3756va%\356\250\325\177\302\306t\237s\356\324T|7\351\244\323_\360\034)pg\261\004\024P\320\366P\305\307`I\235>\3102\316r\274\307\274\005%\342\275\316~b\177r\026*\340\316\352![\240\344\375\244t\301\013&0\rn\340"
+	.ascii	"\311\2143\2030\344\375\304\311\245o\262\214\255\252\214\251j"
+	.ascii	"\217\271\311e\261\327\003\231\247K\376V\314\255\274\002\324\201"
+	.ascii	"\177\bs\353<\324:\207\320:\203pt\376\340\350\354\301\321\271"
+	.ascii	"\203\030g\016\216\316\033\3048k\320:g\320:\277\300\300E\353<"
+	.ascii	"A\353\334\242uV\266\316,V\250\370\351&\315>\255sO\353\234l\235"
+	.ascii	"I\264\316<\255s\210\326y\247u\326i\235sZg\234\326\371\246u\266"
+	.ascii	"i\235k\220\3164Hg\020H\347\231\030g\231\243\363\207\2433\362"
+	.ascii	"\350\034\023\343|<:\033[g\230\326\271\330:\023[\347\227\326\271"
+	.ascii	"m\235\207"
+	.string	"\255\263\260u\376\326\331[\347.\372)k\003\313\312q\231}\335\364\346\030\344r\345\206iG:\260}\251\233\257{K\367_\367\264\273I\27707\367\240/\2613\261\221\231E\r\310\356|-q|\314\2409\241\326\275Y\344\227\251\r%\246\335\255p%\2018X\304\335%\350\332\245\350\20062\260\277\016\344\346\302F>j@.\306\020W\302\006!\356k\277\316\226@\362\307\324\025\270t\335]oT\341\275U\n\364_\363`]\231\360A\271_\3057\252\256\0076L\324\212\207\023\342Q\020\303\362\327!\036\007K\332\n^\377\260\tx\003\266\037\263iF\003v\226yx\274\251,\007\322'z\307\211\211\343\210\312\233\260e\264\275\245o\334\252\367\203\225/\3333mzl7\031\304\301U\331\201A\351\243\254d`\363\342w\254D\241^T\345v\276\343\340>\307\277P\345[\260\356\250\331\265R\017M\256\246\205\013\314\034_"
+	.string	"4\251Fi\224tsWt\036\007\336\257P\247d-q{.\200\230\340u\352\230i\365M\3174\201\265\007\235o\272\023\335s\357\374\346\225A\253N\227U/J\316Y\327YY8<gr\036\005A\257\234#i\265"
+	.string	"\377\321\301\214\3526=\0364xT\372dZ<\022s\3335\225\323q"
+	.string	"\225\262Y\230=\230R\336O-\276\375\246\216(\266\017o\305,\036\347w\304\340\262l\351c\361G,\020>\252yM\001\3244\213\305k\342U\360\232\335\303\371\2763\321\215\245\223N\337\303\266\335\325\006\322\232"
+	.ascii	"\316#"
+	.string	"\355\364\242\356\272\315B\377\256T\310<\366\251\246\207B\006\346\205\327\005\005\013{\017\253\225Qp\036R*\213\327S\0177s^7y\203M\321\230<\301\025\325\025F\200\004x\217\365\022f\020\342\323\314\203x\232\267\211\201)Dx\245\337\344\023]\3636?\3429\265\304\264r8\033\304*5/\002+\354\204\277Ma\373s\243A\341lk^T\020=\\\rF+\305\346u\357U23g\3604&V\r)*\177h3_L\253\"C\244\2270\213|x\231\357>\264\346\213r\t\246{\235?\310\377\360\255\331s+\346\215\217\374~\326p\374\230\027\322=\2579y\307gf\036\351%L-\267>a\215\177\374~\3029\275\314\2450\032\323\006>\343\263\266\207\306G\332I\307\372.\334\361\255\030\371\324\222\007\203\301\267U\236\256\342}\236\005h\373|\003\355\244g\316\356\324|~\001\247\007\376\340`\0278#\006\337M\332"
+	.string	"*\247\007r9\224\024\2107\030<\022+\017\210\216n\027\204\302Ha\336\304\2231\261+\230<\036?Z\231\027U4\212\026\337\245K\2469 P4\202\022\223\340\320E\034\344\321\312;A\242\f\300\227?\301\205D\313\372\222\215j\345\235\337K\322\333\017\311\244#\243d\214\031JG0D0\022\221\tHD%$\217\222\2221\210j\210j\334H\022\316\0302\301\210hFR\215\243\226\250c\214\340ID%|\t]\243i\f\021!%\225\320\232\220\344\2544\300"
+	.ascii	"\245\222h\305P\n\030)db\020\315(\032z "
+	.ascii	"\t\006\221\221\321\021\214\030\206\221\"\306\320\215\030AFEC"
+	.ascii	"4\202D(\232a\303G5\210\220\202\222\216\216\220\202\214Sg\377"
+	.ascii	"\020\"\326O\316\371K\323+\320[q\215\257/\247\035|\\|\353\267"
+	.ascii	"v\\\361??\355\302\323O.\213\375\021\376\270x8/\027\330\275!>"
+	.ascii	"Jl\025.\343\021\350BO\317\027\233tG\336z\276\305\217\265\257"
+	.ascii	"+wL\320\222\311\377&\035\021\022\237|\1777\022\337\342\0075\033"
+	.ascii	"\366$\212\n9\026X\203\025\313EWE\302\t\266\213g\350\221\324\316"
+	.ascii	"\312x~M\211J\035\032\021\302\363P\323\036-\2045\036x\276\325"
+	.ascii	"\316v\320\241L\312\025\017\226+K+\2616\210\350\300MDYB\001\272"
+	.ascii	"*#>\333\031@\017\227f\313\035\236X\251\352\005k\"\266G\0175\360"
+	.ascii	"\206\020 \374PkN\210[\033\233K\237(\275\326\334\330\033\bAO\253"
+	.ascii	"\035;T\246\270u\322)\355n{\261g\302\326\335\206\325!W\343\004"
+	.ascii	"u\373\2051A\350\223!lDt\272_\364-\367\210jKj\323`\365~\222%\233"
+	.ascii	"\215\365\336g?-\335\210O\032\001,\337\272oY\005\351fO0\b\306"
+	.ascii	"\351Y\351\276\245\336#\271\322\313\272\226yI\327}\313\272 \273"
+	.ascii	"\356\343,\314\242\310\274\274\353>\2462\213\242\264\331\235\355"
+	.ascii	"\31616x\226\275\322\360\245\036\325%^\3369\023S\375*\006\353"
+	.ascii	"\307\032\217\b|E\363[k\242}\351\213,\365\270\237\370\211|\326"
+	.ascii	"R\01379\323r/\346\212\263\370\322\262o\351w\263\203\251\213k"
+	.ascii	":\252\316.\026\321\272\331= \355\315N\036\001.\263~\325\017\236"
+	.ascii	"y\031\37030Zg{\b"
+	.string	"\225\022\\\252\213\202U!\260\333\203\337\340?\230ZzJ\351QM\t\324:\273\314\n\f\016N\351\340=\370~nq\360\035\274\320\214\013\263\b\007/B\203\337\340\235\356y\r\344\302\324\322\340E\353\372\207e\300\203\272\005\233\013w\340r\220\331l\372&\233\360\243z\275[\272E\252\n\330\335\202S\220\276*\212f\206\340\2030\225X#b\257\350\306\207#\207\006\337\226.^\231\004\202\245\250\362X=KJ\306\320\214\210\004\221\244I\032\003b\013\020\206\"I\232\245X\017\022\200s-\312\262\016\032c3\"A$IR\312\264o`\022@\3508\f\263J\022\035xHA\b&\201W\351\"\021K\035\326\226\234\f\210\207\0021pH\320\013h\335b\016\260)J\276H<\275@\377\226\2264\370\314,\247\326\262\337`\211b\332\370\030\350\032\363\341s\261\016Qg\007\257\306`z%\313\367\226\250\361DS.&\230+\271\377"
+	.ascii	"\307s\312\312\032\205\261\271\241q^x\252\342\210\001\215[2\305"
+	.ascii	"\346\325\240\f/XCi6\334\301\255\351\204\366\261\311\2054\237"
+	.ascii	"e\fm\260P\3047\033d\370\275\006\324\037\231?\200\301\334\035"
+	.ascii	"\304\035\314p\353`mB$\240\322\350'\030\235\335\234\352\247\252"
+	.ascii	"\035\266\204\225P+$\313|\261t\322\204o\351\023\002A\230\004x"
+	.ascii	"\030\320\317Ny\n\222\003'_*\025\022q\3358\234\006\006\277\022"
+	.ascii	" B\276/\237\b\322\2567f\317\225\231\025{\016\375bF!L\252\\~L"
+	.ascii	"pqh\240\350V\216\243\364\"yi\321\342\250\214\0207\355\t\"\220"
+	.ascii	"6\217\2231\362\303;\373\2260S\225\365\374\231\204h:\020\300\024"
+	.ascii	"\354\2068"
+	.string	"\244X6z\355h\266\177\266\364LfYN\273C\266p\206 B\226\244~\210\301\2772v\037}\372\007\301\262\343S\013\245\224{{\032h\206FXRw\277i\020\221\201n\332EZ\023\303\027\025\234\363ED\352&\226\314/\177t\240\264\240\221\2010\377a\340DU\303q\201p:~Z(K+*\0179\016\331wz\250`\326\300\306\321\344\225i\352x[[\301#\310r\201\022\252dX\242\002sM<4\214\3536\301\tA\224\255*\274\341\3609\313;\027\032\373\214\262\273+\026\276\357\300\034\022eQ\006\021\340s\241s\363m,\033\364\311\300;\223\230J\227\321J\253\210O\337\371\371\335\006\345B\345\246\354e\303B\3456^\263\\#M\246\244\034\322|6&o\260\3062v\242\025\240\242\016\247%{M\312\355M\201\325P\243\fM5#\265g~i\033=\222\276Q;\021\264Dv8\246X\037\271\241&\307"
+	.string	"A.H\2225\3232\2040\223\037\202\227\304*/\242\004$X-\377\336c\200\251\220\020\3479\031 #/,\240\334x\245\222\267\274\217\b\305\023wR\237\235<\241\361v\017@8\357\316\352\341\271\016\234\333;\205\272zu\006\253\032\326\321\304{\360\262?\325\177S\211\\\357{\261\234\373A|'3\032\333\206\337\237F\260\022\177\367$\3308\376\372\3130\212kZ\224\304\321["
+	.string	"\337\002\357\347\342m73\342\273\376\242\307\305i\f\260\375\310\310m\276\325\204\031\016\326S\2618\005\331\224\225|\200\360Ws\020\252\333\242\205j\257P\254)b\322\202\030\230O\237d\026O\r0hh\2658FY_x\214wgy\352\206\200\206sjK\226\200\236jO4\370_\255b\030Q\002\240\266S\366\250|\017N\251\277\256\234n\261\362M\320E\300k\211`\030\331\243M S\355\031HFj\364\247\245\032"
+	.string	"\013\004\017\270\023\021u\313(\022\266n\n\300[&2\210\2542\310\272\316\304\007\037\177\311\354\351\007\302j\306\370J'\205\212\350\206\323\273\210 \237e\316%\375\001\036\333\004\320\304U3N\003X\356\016\007\305Yz`T8\252\365\246\005\202\032l\331k_\270\0201\324\200\202\230\371\245\235dW\0218\323\025\270\342\326\354\f\316\330c\306\002\233\331u\206\225\334\256G\231\3001uR'\342\223pm,\362\f\343E:\204L\312\233\334\266p\251\230s\266a\207,\324\206B=\354\237\352.\220b\372aI\347\306\370\333\b\362\273\026R\034\347W.\226\304\006\bw\002\262f\302\0225c8'L"
+	.string	"\td\013\202\375\347r]\b\315}\345\361\346\327Px\376B\020*\372\3703\211A\200D\036\232G\255\202\266\212ygH\016XK^\354\240\222\0304\366|m\277\344\375\216\251\"\217\371`\032`OQ\247\275\177\302q\\\371h\252\237\204\340\037CG\306C\310d\032\031\277\237\344(\370\027\276\375\253\f9P\334\261[C\001\270\003uGjQ\362\313\004(\314\223\262\310\267\260\353"
+	.ascii	"&3\013\303(\364\334\274\240\350\260U(M\302l\252\221K\254\035"
+	.ascii	"\360 \301\273h\204\242\306\347\332\327\273\357\212\217\272\270"
+	.ascii	"\240\212\316\211\n\344-\020@\201\220\\\366\t~:\304\356}\301q"
+	.ascii	"\210\325\247 \324$\b\205R\027\016\024\265\372\300\300^\n\227"
+	.ascii	"\350\"\214-\253\351$\302\360y\257^\270\220w\270\317\211o\223"
+	.ascii	"8\022]\351s{\237\272\240\334f!;o\fg\222t\3537\020\265B\rDH\020"
+	.ascii	"\245\335\276}|!\313\021\3574\230A)T(@<\021\007\026\017\035\002"
+	.text
+	.section	.gnu.lto_dyad_init.53.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375 \342U\006"
+	.string	"\004\013\220"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\276\271\030\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\362\001\274\310\315#\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\362\371\360\231\307\001"
+	.string	"\201\003\205 "
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006\325"
+	.string	"\001\r\006y\001\001\002\004"
+	.string	"\203\003\202\360\371\220\233G\244\003\001\200\300\013/root/repo"
+	.string	"\025lib/main/dyad/dyad.c"
+	.string	"\t"
+	.ascii	"3\003\376:\303i\270\3055\321-\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_dyad_shutdown.54.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`a\005\375 "
+	.string	"6\272\312F\220\332JcpL\217/\026\213\307`\344\356b5=\221\2529\321\216\\+h\202E\314\030\002\nO\307\"QDHe\200\364\272\331\005 \020.\313H^\303\263\227t\377\3212\031\031\310\034S\227!d\357\275\367\2262\245\261"
+	.string	"\266"
+	.string	"\262"
+	.ascii	"\020\316\223NO#E~\021\006Vl\354\027\361\207\234H\321S\223\215"
+	.ascii	"wxG\037UE\254\233\223\2569O\322\\\246<9~@y\322\3172\262y'+\317"
+	.ascii	"6\320\276\362t\352\316X\245-m\025\357\2759v\207\375\230\336\247"
+	.ascii	"K\013<z\232\273\222\034m\005\372c\024X\035\223\360\350\350\030"
+	.ascii	"\303\346\024c\\\320\265TO\035OP7\037\204\372n4\225\232|\234\315"
+	.ascii	"I\306\330\243#\212\375\n\251\226; 0N\276\3708\"\260\221\346\002"
+	.ascii	"F\2304\312<\211\202;\332\353\n\241R\265\277\372\205\250/.LB\030"
+	.ascii	"\257&\205{\257+\223\360\351\346\335\366\230m\0136)!\346Y]\232"
+	.ascii	"\325\325\254~\314h\205%\256\315*\315RIoS\235\227\273F\212U}\370"
+	.ascii	"\333\367\231\374\314G3\317\300\237\331\216\006\22622\240\032"
+	.ascii	"\242\215Y_\366;\031\220\210{a1K\310\204\223\311\317\037\253\361"
+	.ascii	"bc\177\314\017\373\222\337\305R\034\231ZogX\305\233\344$\341"
+	.ascii	"<i\323\336\301\214\236\304\377\322p\004\030\241\212\330\240\311"
+	.ascii	"f\254\3672\272\022[\231I\357\023\321\214\"VQ\347\374\320\357"
+	.ascii	"2\260\350X>WIcK\361\336\313;i\033\370\255\241\361B\245\367\351"
+	.ascii	"Z_kX\305{\323\233\223\f\242\330\330z$\276\326\217\024}k\250t"
+	.ascii	"B[l}!\336\233*8\351\005"
+	.string	"\334\304\272\276!\316i.\313\247\350\210a\246\225\362wM^m\205*I\225\016J\265(\324\303\306{\357-om\0204I\366\310\276\332\327\200|*\207\360\3253\371\312\223\267(\324/\354\277\372\216k\006q\216\030$aj\265\376\331N\211z&\217\366\250R\251\301\361\030\255\224o^Z\003ZnI\225\316?3\317\323Lv\336{\037\370N\210L\370T@\345\311\322\302\270\r\t\326:\023\025\321~(:.l7;o\311\354\306\234\\\265/;M\260v\361\0019\"\226\313LIh=#\227\305vk\027;E\252V\312~o\212\216h\233\303F\321\352\363\303;=\276\235 \241_\271\363 \241\037\373\273{::\275\336\216\003\037\316\b\234\030\236{\004\016\t\337\020\211\034\024<\276\236\034\021<'d\354\363\263\023\224#\344\343\023\224\303K\203\2679|\312\251\255\005-\022\312U\343\307\034\361\346\037\032\303\343LV\211"
+	.ascii	"\342\322\271,\250\2252\312d\242\326\366\330\335\334\264+\024"
+	.ascii	"\334\034\307p\230\246\020\374\223\250\267\364D\355\207\247Ip"
+	.ascii	"\323\242\366*l \325:\327\260\020\366\224Vz\002\300u"
+	.string	"\260o\002\332\264\300\270\360\372L=\255\017\226A\303\301\216r\t\331\356\327O-A\210sr\247\275\327i\202C\373\347m=\005\332\356\275\275\017\315\341T:\020\230\272\367>\220\362)\036>\f\r\331q\250\201$\307\220R\n\215\214\210\bia\032\003\200\002\031\232:\017\021\2601\203\210\250\205i\rb,\361\224\036\226z\262\251\342\004\201\240k\261\210\031\003c\214\353G\024\275C\267\347o\301\236\217u#lJ\303R=\025>\200\273\351\372+\264\260\006\361'\030o\310\306cah\271\0316\255\230\214&\214\316\0275M%w\222\242\215\026\235\3110+\222_Z\004\025\321\0058\244\253Ae\013\303{\242\373\005\244/\020t\341\375\206\235\020\250LR\374\217\241\223lg\332\303\264\355}<\363\354x\020\366A\r\352>\257G(V\353\\\321\261\300Je\225\234\324N0\323Q\254`\232#h\003-\n\017\030HP\215\350J"
+	.ascii	"\301Q\330|\3409|hQ-\263\026\002\340\353\227\022\200\376\343\004"
+	.ascii	"\031S6\340\021\251K\002\007\376\243%r\334\247z<\367\204UV\247"
+	.ascii	"L\nU\003"
+	.text
+	.section	.gnu.lto_dyad_getVersion.55.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375 \353\335\006"
+	.string	"\004\f\217"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\337\317\303F\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\b\005\001\006\025\001\300"
+	.string	"/\300\200\200\370\305\207\372\2714\241\202\205\210\003\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\335\344\001\374\271\004\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\242\007"
+	.string	"\203\003\202\2405\005\001'$\206\b{\212\001\206\200\200\by\277"
+	.string	""
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\025lib/main/dyad.c"
+	.string	"\0060.2.1"
+	.string	"\t"
+	.ascii	"\242\310\220\031\032\324y2!d\327D\330\b\274\205\310\305]1\265"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_dyad_getTime.56.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"\325\f"
+	.string	"f\030XC\020\221\223\016`u\370O\023\247C\b$\225\3548\260\032\244\275\002@\022\377\036j\223\200\003\321\200\247Vd\033\376\215\361\247@Us@\317\252\252F"
+	.string	"\\\n\245\304\214\357\375\241\021\002>\235\242\245\3266\2212\245A"
+	.string	"B"
+	.string	"G"
+	.string	"\273\033\f\034\232\200u\370\355\370-_\221\331)\275P*\245<*\242\205\0262\273{\271\373\207\346\320z"
+	.string	"\315\241\232x\366\314\374{_\240\311\210\333\312\350\271Q\260\273\316m\205\303\255\267]\300v\002\373Z9cw\243\324\022\366\253U\022\266\246-MCMW\231VMg\246\357\361\f6D\344\270\301\035F\334\325\020w\354\f\030\003\305\273\333Ge\034\020\032 \366=\377t\026\331;\225\316\302\354;\234h\301\360\005\025vI\003*\205zS\n-\243U+\255^\210\3565P\025\300r\272\246f\r\323g\233\334\303\254\335Ep\005\300r\"e\364\206\373db6y\375\250{\021\254\315\2260!\277\331S\322\221S>\300\334\005\347\242#f\003\006\205\204\200@%\007B\237\221O'\005%=\362!\tQ \271\036\210B&\027\003\221\203\017c\020JN.\024\f;\2718\335\336\266\324CR\315*\325\356\b\221w\377\207\312h\250\251\026\b-u\223\007\034!^f8\227\265Eb|\t\026"
+	.ascii	"3\303\210rC\246m0\"\255\205\213B\340G\025\036 2\324\351\027\343"
+	.ascii	"\335\264a\324z\262\261\245\305~\327p\n\232\200\272\320`\211\002"
+	.ascii	"N\232j\3008)\246k\222\001"
+	.text
+	.section	.gnu.lto_dyad_getStreamCount.57.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375 \372\325\006"
+	.string	"B\r04Pm\222\016\274\246\354\"%3.\226WKnM\365\034\364\034X\313]/\226\255\275\241\252O\366\370 :2UU\027UU\0048Ms\t]h[kd\313\024'\024\\\026\347z\227\305\271^\203\306bx\b\232\005\314\230\203\302\346=`\330\346]\266\254\003\241\313x\\\304\027\244\333\244\3131\304#\254V\352>\252J\241\003\330\250\360`i\013Fb\312o\035t\241\357\224\016\364\305\321M\242\213\232\254dN\224T\262\204\032\351\370\263\277\\Q=\262'M\233\306G@d!!\202\222\231/SLUjj@U\312e4+f\267\037=\b!9\321>\235\242\305 3G\355C\321]\177\202\177\340\017\005\b"
+	.ascii	"2\001\0178cb\034\240k8o\204\323B\020\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_dyad_setTickInterval.58.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\215\b"
+	.string	"\226P=9@o\323\001@![\365f\247\273\327\320\240\275\322\233\007V\340\240\002!\f]nS\375W\231\023O\230\201I\033\3728\212R0V>\b\375o\245\003\017\334\377\323\247M\366N)+"
+	.string	"-"
+	.string	"+"
+	.string	"\002\330\253E\033\346\244\306zP\033\024%1\273\273\321\214\213\237\242\177\221oF\023\351S\263\260\273\236\243\311\342\246\267M`[\301\266I\237\327\205\342\270\013\313nEkfW\025\305\303\3669\266\301\307\301\247}\220\207\210OY\365\200\335\225\223rw\021\\\220\275\232|\007{\315\036\023\236\324\0379\211U~\207%\\\316\217\257\276K\354u\340\345\2424[\366\260RZv\312\330$iR\f\373\327\356\256\351\311~\352\001\346>\037\216\003\023:\315\323"
+	.string	"F_(\364\300\221\306\236\366u\021\337\026\002u\016\033\003\250\241\343\360\001\024m\020a(\3328\344\376Zzr\306RY\225h\t"
+	.ascii	"8#\211rC\306^\363Y;\234\335r\031\032\270\232\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_dyad_setUpdateTimeout.59.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\215\b"
+	.string	"\226P=90\217\323\001\2604@C7&k\200!\3604\250O\275\023\320s\207G\007\303P\t\216\220\214\240\261\f\367\316\033JRPPF}/\016\3463\017\202\007}\357\240O\233\354\235R+"
+	.string	"-"
+	.string	"+"
+	.string	"\002\330\253E\273\345\344\306vN\036\024&/\273\273Q\215\213\237\242\377\221k\306\322\3503\263\260\273\236c\311\342\246\267M`[\301\366I\237\327u\002\371j\265[\321\212YUM\371\260\375\215m\200q\360i?\344\"\342QN=`W\005\245\334]\004\027d\257&\317\301^\263\007\023\236\324'y\211S~\207%\\\316\217\257\276K\354u\200\343\2024[\356\260VXv\302\330\344h\322\f\373\327\356\256\251\311>\352\001\346<\036\216\003\023:\315\323"
+	.string	"D\037(\364@Q\306\236\366u\021\337\006\372t\016\033\303\247\201\343\360\001\fm\020a\030\3326\344\376Zjr\306rQ\221h\t"
+	.ascii	"8#\211rC\306^\363Y;\234\335r\031\032\270\232\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_dyad_atPanic.60.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\315\n"
+	.string	"\226\323IB\020\311*\035?\334\375x\224'VvA\370\301`\273\277\334\363\332\021\260\255\344\361\211H\210\005@\023\217 \214\375\226\013\006\314\352\216?"
+	.string	""
+	.string	"\200 \\_\263\001\201\036\236.\001e\207M\213\254\356n{\247\0246"
+	.string	"6"
+	.string	"6"
+	.string	"\263\227\301I\"\022\256P\214\343\310\200\007\273\325s\275's\252\371B\346t\266\034\274\004\375\327\256a\2739\020c\260K\205\214\335\265\024c&\367\274m\220m\f\373\021\001\bvKv\0216\001="
+	.string	"\340\365\267_~\315\033\b1dW\220\263\270},\3008k\260[%N}\001\232\020\262<\r|gW\266\300\300n\235\360\203\346\324\266?>\f\nPt\322!\274\355\002@\377\305-\227\274x\352\2732\247r6\270\234\204r\347O\016\002n\245\316\25609Y\354cv\312\354\323\376\371zK\332a\260+\240\362['\3257=\"\221F#TEId\022qL+\020\016\214M\242S\251u\362V\251R\207\267\221Ry\374y\240X\336\307\367\261\274M\335cv\312l[N\213\224p\206\370\223\2230'\201\022"
+	.ascii	"5\343\210rC\306^\0272p\341n`\025M\361\001sU\217E\301\232\226"
+	.ascii	"\262\3325\361@\013\0022aJ\212.Q\367\r?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_dyad_newStream.61.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\006\003\r\027"
+	.string	"Fi\223J\240\024Vc\b\024\232\022/\032<3gOB\343\260`@C\037\327\314Z\351(\200\232J\260\214\306@\031\226\230 4k~q\251\227:r&\320\350qrz/^\215ul\343p\223\005\036\2705\361?8\345\304\372\355/eJ\001x"
+	.string	"u"
+	.string	"\207"
+	.ascii	"\247\277\304\203\375,\360\203f\277\206O\343J\274\037y\\W(\275"
+	.ascii	"%\002\034\245\260\210Z\367\216P\360\372\371+\273\335\343\033"
+	.ascii	"\r\203\361A{\261'\273\312\373 \341\360\306\362\336\224\366\323"
+	.ascii	"\004^?\375\341\211=\356Y\020?\276\242\333\320\thI\353\336\324"
+	.ascii	"\346\3643\364\347\353,\350O\333\342\275\327\236\177\343\033\034"
+	.ascii	"\253\222\301 \237W\023\006\367^\327`\020\211\333\3366\214\355"
+	.ascii	"\005\2665\0216\032\352\203v"
+	.string	"\001\016/j_\274\213\257n\031@\365\362\216Bm\267u\036\352\203\250\305\021\376X\037?)c\231\204y\353\226\235\376\252ea\337u\355\n\033\255^A\253U\320j\331Y\235\202V\307\316j\224\027o\324Um]\325\237\275T1\021\225\034\r\235\354UzE4\227\\\2533\307\213#\377\342\253}\177\351H?i\230{xOmRDD\b\021\361\336\013{V\2611\273B\344\247\003\207\212\b\247\266\220p\\[\246\331\234\372p\257\357EfU\354\201I\277\332t\212\225YW\223\204''\244\330\001FE\024\033\263\025\bpy\244)<Y\001\305\306\214\212&HK-&K\265\375LOZx\005}\344\005\f:'\222\277\020\222!\345\255[\017\001\224b\231\304HKV\214\332m\334\235h^\367\336\004~\323.w\202u\324C\177\316\\\034\361\325\246w`\354$)O\250P\332Qk\007:9\325\267\230\230\333-w"
+	.ascii	"W\243\251\311np\271]\016\016j\232Z\r\216Wc\343`\203\273\261e"
+	.ascii	"\260\3310\263\256Cng\313\321\351v6X\352\273\215Z\004B\237\375"
+	.ascii	"\271%\353\311Z\245\201Wk\355\201D\277\036\267r\224\003C\031\n"
+	.ascii	"\375Y\355,\210Q\311c\206\265\037\234\252\027d\372.\365\035=\377"
+	.ascii	"\310\020f\352\2033V\200\221PK\326P\271b\355\b\327\341\247\033"
+	.ascii	"\357Z\242\030r\274\262\301\344q\335\253Bf\251T\233\001> P\002"
+	.ascii	"Q\346r\036\347\360\"n\210m\003#\274\311\370C\037j\261\212\333"
+	.ascii	"\337B\262\247c\355\200\235OY\306\341N\024\\1\217\346\345\232"
+	.ascii	"0\030g\032\346\263\302\220\275pZbs\t\356\327\323?\375\350(\252"
+	.ascii	"\007J\212\213\262P\252Lx\372c\0347\203\322Zg\365l\321\344\252"
+	.ascii	"\335\005\240\036\3601(`a\206\030\344\216ck\227B\355\313\036\223"
+	.ascii	"u]\226\027\003\354\200\306p\377\354x\215\241\\\bA\225\311\213"
+	.ascii	"\327\025\305\335\354\2260PG\341\246M\302#\003"
+	.text
+	.section	.gnu.lto_dyad_addListener.62.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`k\007\265'"
+	.string	"*C\250\016J\220\332M:\206\016\335D\274@\031\024\b\352\211\235\256R\004\221}\316\256OD\267\013\240\340\360I\002\n\261\335\346\227\203D_\260\200\335um\220\260P"
+	.string	""
+	.string	"\001"
+	.string	"\021H_\213\204\0167G;(\3279\344`\335\2064B\310\226I\006\317"
+	.string	"\314"
+	.string	"\327"
+	.string	"NF\344\324\333\204\342I\2452{\311\034\236\345c\276\275\374\261\370\226c\205^\311\227"
+	.string	"\317\304\bw\277\356I65Fv\357E_2\206\363\345s9BP2\t\033s\270;\254Za!\007j\255\216~soT\330\223\n\347\313\034(\264\325\033\001\376\b\257\\so\r\252'\367^\006<\341|\211C\346\274@\337\314\247\372\020\340\211\234\360\271'BM\031\311\356U\031p\202\363%\253/`\276<?\300|\311@f0W\245nnJL\t\211\331\275w\307\3368\3605\263$m\003\3715\nX\257Y\"\"\275\006\343\246\323K\033\321\351d\212\033q\330V"
+	.string	"Q\211\304\271\367\236\353\315D\024v\327(\334{\271\227\210M\347\363\314,\202\231\243\230k\026\002\351\261\330\310S\346\226\305k\207S\361\205t\027*\312\037\366\216u\324\001*8\306f\257`\341\365w\013\351*R\\\224\215@\034\213W\326\275\344\201\n6\032.A\226+\313\362u\033\r\263*lk\203\371\344\265Q\314\335|\323\315\270n\2669\221?\300\223\374"
+	.string	"n\365\337~\344\267\331\232\317[s\355\326lvs\331\315\244\255\331\3264\367\331\374\003gq\234\301\343]e\367\2668\242]\257rK\007?\353\\\3147\366\275\t\377\311\243\\\312\253\330\236\322\314\2008C\365\022\257\031\332}*\276O\341\225T/\321\224q\211\326\242\330Z\354\372"
+	.string	"\364B\317\376\026\024.\346~x8_j9\031A\336\030\352mzU\227\027\372\322A\021\255\365\265|\017Z?\326mWEv\234\221\005\311\232\201\276\230\337\266\345s]\300\320_b\323\"\265\212\241\332\346\215\375\222\230\005\307\331\033\333YIh\302\251r\301\t\200\221\261WAN\242\307Y\237\252\260\276\002\322\367^$km\340\254\215=P\225e\330g\230o\306\ng\333\310$\203O\206\307+?\007\253\347\242\371\322\3066\026&\031\\\257\271\362\361u\253\374$3u\317\306\334\363j\236\212\375\372\260\177\253\355\265\036F\b\201T\206\223\001\215\365\350\200%hk\221\274\311\215<\027\373\322\363,)\266\3212&F\203J\003s\361\204jR \325"
+	.string	"'x0.\366\022\363\206{\341\365\344\016\357\322s1\260{\257\216\013\317\303\273\300r\2340_\3362Xr\n\366\221see"
+	.ascii	"\276\266\260\321)\351/\345\031\335$\020`\302'\324\023*\217~?"
+	.ascii	"\273TD\272;C\374@\f\365\202L\262\2507\324\373\371~\202\316\364"
+	.ascii	"\227\362\214J\240]\352\023\024\224\356\316\337P\217D\257d\b\021"
+	.ascii	"\"@\200\320{\220\352\354tpBi\257\350\3473y\247\303K\217x;C?\251"
+	.ascii	"\320\216\317OP\001&\022\321+\332\371\021\021\025\355\334\324"
+	.ascii	"\340\311k\243\370,;\363\nZ!\363\267x\275\261\274\323fb\243\356"
+	.ascii	")MH\257W\034\351\236\320\314\004\\yJ;\213\021\354#\210V\342U"
+	.ascii	"\367\204&\244\223\206\214\332\f\220\371\322N\301\021\243f\255"
+	.ascii	"=\355\223~\b\373h\3054m\315\352\030\223z\220\326\264\022V\245"
+	.ascii	"4\245\025v\220\264\245\225\260&\321\020\362\364\345\365\330c"
+	.ascii	"\263\244\216R\244\265Y8\322\200\316{\257\016\255\247\307\232"
+	.ascii	"\213\265=\026F\204\312\272\025\200\241\250Q<\344\030C\206Jf\244"
+	.ascii	"\240 I\032\003\200\002\231\251\243\036\021 =&Yi\222\202JaZ\003"
+	.ascii	"\304\003\207\001Q\nH\361\020\376\242Q\327\231\002\313\351\004"
+	.ascii	"\235\375\223U\006\005\356\203\275\203?[ }\035\265\244\314\247"
+	.ascii	"\242\324\257gf\322\006\377am\350\334:i\314\323\204*\bx\277\234"
+	.ascii	"1\002\300}Xi\211i\214\371j1\221\211\t?a\252\302SY\013\257\027"
+	.ascii	"~\217\001a\244\2251\226\203\207\240\207d\352(h\231\206\020\347"
+	.ascii	"\315\325|\246\024\263\0210Gr>\024\211 \3132\336\210A\330\027"
+	.ascii	"4\354\252\225\236-\322\215\266b\f\203}FG4\364\026\325\342\200"
+	.ascii	"($p\372i\202\f\202\325^tR\025\273O\230h\2600\\\272\032G\214\240"
+	.ascii	"\005\235@@\347]\360\267\275:\340Y7i\006\r\200S\300\"\036\003"
+	.ascii	"\256\262@\301I\357\257\354?-\332\307\370:\327\274Qe\322\334R"
+	.ascii	"fZ,(\256]A\353\313\373\316\3444\367z\377\370\367*\247N\306\013"
+	.ascii	"\242$PDq\307\326q\227!N\221wu%\005S\n^V\215-y\f\355hrdG\020\336"
+	.ascii	"8\250\037\353\364r\330[(TG\375\205\343\224\035\240\251D\252\355"
+	.ascii	"b\230\315\300j"
+	.text
+	.section	.gnu.lto_dyad_removeListener.63.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\300\be/"
+	.ascii	"JS \022G`ZR:]\211o2Pn\377\253\221\302\324\276\255\251\243d\021"
+	.ascii	"\360\365yl\337\276\324\335\220\322\347\265\226;\300\273ek\255"
+	.ascii	"Q\316`\363\203<\277\340\0356Xy\343d\253.\240@&g~S%\373%\237\020"
+	.ascii	"\262w\222\001\f\001\003\001\022\001x\210\335iQ>\231.\177k\357"
+	.ascii	"y\003\304\271Hu\007\277\376h\035,\202C\354>\353h[\265\325\302"
+	.ascii	"=\263\362r\316\304\257\375\241\213\352\210\252\226v3\364\311"
+	.ascii	"We68\214"
+	.string	"!b,S\377\311\271\310\035\333\206\366kQ\027\342\205\336\n\325\257t\264\1779\207\215\261\345\234%4\206\366+\221Zt\205\370\333\375\261?\251N6#)\237\t\366\254\221\2273TB7h\2776\364A\354\327\366@\354\327\246\352\306;\324\231\207U\2464\262\350\345\234\217\360\221\366M\247\323\351U\350\033x\251\376\003\266\354\252\342K\325gp\267\226\305\254\372O\365a\345Xr\272-/\265(\315\363r4\253\013d\271\276\336.\b\343\352:\253\"\265a\006u\340\325\005\231\313\273\252\021\352\240|\001y\245\325\005\231XWU!4\341v\234n\253K\r\232#\322\346j\277Z\314\253\213\217\366\026\315S\353M\030\327\327\257OC\316\271o\026\223\353\035|w[\351n\031\335-\214\335\306\2439\2669g\013g\224\220\003\354\222\314`\277\366`|G\246\274\323\036Jy\320\345{\247\033ju\261X\367\213Ni^\343\"\335"
+	.string	"n\037\b\336\036\272\267\r\374n\013\335\333\303{\273\300\275M\340\336\016\272\226\037\350X~\001\277\362\377<\355\355#\3549\331\037\340g\267\177\367v\373\263\267O\275\315\002o\257\367\266\372\273\215\177\267/{\373\n\236\303\310\230\223\333\255\345\234c\272\227\345V/L\236\366\237\275\317\345s\335\301\226z\227~\333\335\016\346c^\346r\024\232fSr\316\30183\31783,\220\027pd\234\300\221\351\250J'\267\240\"\272\202ff\026#\336{1}\350\255H=LGUhf\236-\257x\213z\275E\333m\270\303H\205\203\330\336\177\361\322n$H\364\331\326\\\250\271\013\232\271^\026\2477\246G\241\212\350\273g\223\372\232\213!4s!5\345\306\364\276v\210=b\177K_\255(\270"
+	.string	"\306i\226\315 L"
+	.string	"\3374\313&}\225J\035\355'i\350\333\215\375\032\204\213B\326\264\276\224w\332>3ty\356?\2632tY\356\255\234g\023;q\"\374qB|\270({1o\3767:\377\227;?\333\247\036\0228\363D\3419\"\365\257\315\303\024\230\324\216\336\361k\316\237!D\357\3629\355\006 \253\373\303\345t4\316\361xv\027b\312\231\322\034\003\321\355\326\202q\0259'T"
+	.ascii	"+J\203\2647\366\316X \314bL%\304\363\332\r\2133 \271FO%lV,\326"
+	.ascii	"\002\360\212\217'\342xS+V\360\177\325\351\262S\261X\377`\025"
+	.ascii	"'\225\335]]iw\217x\233\216\266gs\242D\033\205\003 !{ \375\341"
+	.ascii	"\203\237v\"\345\275\323\030\037\373\340\343YF\261z\223a/\306"
+	.ascii	"\370\313'Vw\332B|\361\032\245\221Gy\247\335m\342vQ\016\354\324"
+	.ascii	" "
+	.string	"p\036;\270\332\357\224za30XL\334C\251\217\036\374\263\013\301\224\215\342i:\232\300\031I'\251\247\343\232\2042&\243\326\030QM\310\246u*\271t4\2660\036[\025\311\024NH&V\205\361\245\033\223F%\251\225\305\321\230\304\304d<\266I'\344\013\344\332\305\013\027\212E$\222\321\350h\344\323dDB%\243\330>\032)\031\247\224\216\234\226\214MGIKLA\375\324\002\tu\224|z\202:\nB\225\307E\272\225B\221Sb\253\037\026\013\232\265-\271=\270\325\326\207\201X\213x ^Q\266\346\352J\317\214\016\304B\3742\313\246\025\332U)a@\254Ay5\347\234\201X\254\357*\304\227\025\342\253\n\361\321~\034fmdX\210}X\253\373-\026\353\356\037\266Q#\013\216\262\305?\\\214.\233V(\356\262\243\355\305:\336=\273\213\327\342\273\007'\346\355\313o\230\265\311\331\311\033\272B\370"
+	.string	"\366\301\3759\016\035\356\263\372fqrK\\\325C\370\370"
+	.string	"\276j\313(\006\360\020>\020\033\300\357!\304l\371\004\013a\2669\245\221\347\346\027\300C\254\272Y>1:\201\200\261\250a0\304\030CF\241\231@D\202\244\005\352\240\002\031!\253u\021\200\251\203\214\002I\231I\373\031\246A\217\016E?B\007K|\023\026p\002\307\023\327B\b\333\275\363"
+	.string	"\\\220J\371W\033\001\236\362K"
+	.string	"\210F;\024\312\0276\313\343\315,\246K\"D\233\030:?\300\232\215\322\362`\235\002\013}\365\252\223\364\223\206\r\227\366R\205d\211\342\241\370;(\212\210c\350\t\215\034\356@}\323\006\031e\033\0022\201\334F\271.a\225\365\037"
+	.string	"\346\331C\307\342\347\006P.\316@-\233"
+	.string	"\250Z\347\215/\325\346\331}\342\372\002X\177gU\006\325)\257\233\013^\211\315\005E"
+	.string	"\234\361B/\002`Ip\026\206\257_$\353\241\2341:5\324\f\004\276 W\214\214\226\315s\037\210\234\216\276\202\264\034!5\004\205\203ml\220/B\ndQ\246\241&\030_\033;h\253\340\031\230W\344\301>\350\342\003s\243#+\251\207$\310#k\230`\351\330\201o&\337(\246b\250"
+	.ascii	".LI\211\266Kc]$\021\226\242\343\317\326=\252R\2348q\20654\027"
+	.ascii	"j\241\255^\335c\225\207\3433U\362\t\017\022\267\203\221O\310"
+	.ascii	"\321)\377\341\255WO\335B\377s\311\013\027\035\30496\266*\345"
+	.ascii	"\021eY\300(\374\013\241T"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.64.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\r\r"
+	.string	"F\030YE\020\2176\035\300H\263\301I\032L\327\335\263'\244\365\217\013\252\t\f\\\261\360Kw\260\201\013\375\n\315\"\376\3233\030\2577f\f\214\320\b("
+	.string	" >\350\265\272\020\373s]\370\017\321?\323{\375\376\264\211\334)\005B"
+	.string	"C"
+	.string	"G"
+	.string	"'p}\332\263Y\\\004\267\023b\250\300\362bw3\335\340I\357\323R\351\371\231\r\315\351+\371\304Pne|(W"
+	.string	"\237\211\345\331\335\253.-|&)3\033\273ky\372N\356\353\266\033\330f`\237#\027bb\354j\226H\261}\373!<{c\1772\200\244\274\312\027\017\302\373\212]\254\331\325\320\242ewC^\200}z\254\317\t\350\362\037|\017\017\275\253\220|\300.\312D\313\256\030\362\001\354\323\3429\327'\026v\204\213\230`"
+	.string	"\334]\005,\024F\002\200\034>}\222\353\363\243\302EI\306\030\301\030j\340\370\242\2322\350\327\002\252\025&rtg\354\200b%\f[4IM\275\220\200YYQ\366U~\375\312\377\214\025\246<\005\314n\244\020N\0027\255ihh\032\227`\023u\210\004\200l\334\210$r\271C\344\261\215xd!\037\033H\306\361\341\200\343\356\0017\312H]7\3126b\351\21226\236X\225\32445\362\252jw\020\344O\236Zbi\312\026\371\b\273`\001\027"
+	.ascii	"7\303\213rc\246m<\223\021\037\214b{\303\321\026\024:\244\320"
+	.ascii	"\374eS\314\352/t\005\243t\307\331\3462C1\025\006\234(T\255\b"
+	.ascii	"'\b\030\260\251\311C\235\336\332R\006"
+	.text
+	.section	.gnu.lto_dyad_close.65.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\345\f"
+	.string	"\246\030YD"
+	.string	"\2216\035@\304\215\211D\003\324\006\2049\370A\025Q^;g\007\314\364u'\022\214\217M\264&\303\363\207\322\373\250\202\303?b\277\252\362\377\177w\271\355\346\324\"\300\260Ri\257\220\237\231\371@\2216\221;\245E"
+	.string	"F"
+	.string	"B"
+	.string	"\326\347\365"
+	.string	"\326\247=\333\306\305\020+\340d\242\202Jjw5\005q\357\263R\351\371"
+	.string	"\300\223O\354\325\206kE"
+	.string	"\205\206\206\rH\2520\324\207\032\037/-\200\237\224\035\036\273kY\0023\334\326m+\260\235\300\376G.Pw\231\261{aFfWf\f\022\266o\237\205\247\361\310d\366G_\274\n\357+(p\226e\257\324\351\304\313\2220d\237Fp}\352\346y\311.\237\302G\361\223\367\320\344\235\335\224\360\305\256X\300\236\353\323\342\261(+\252&g\277\016\030[H\022\306\366\203\267\260\214\003\276J\004\b\327\356^\304\247ob}^7-\341H\316xB\352\343\317\001&\007\313\312\030[\374\244\232\354W\273\273\326\024\373\341\257*}\253\203\303%\335\275\201@\333\326\031\340> \037\316\b\327\211JH,\203|B8\t!\032\003\021nD\373\020Y\2009\324\240\023i%\241\220H\323\210\243{\214\364\373\274\244\252\355\200D\276\344JO,a\334@u\250\324T\302\303\312\230[\374\376\021\245\025"
+	.string	"7\303\213rC\246m0\022\263"
+	.ascii	"M\004}\230b\204:\220cQ\346\231\2153{\213\345/\255\226\013n\263"
+	.ascii	"X\002\206\250TY\306\265\334\"\257\251\353\246\024j\017"
+	.text
+	.section	.gnu.lto_dyad_end.66.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\345\n"
+	.string	"\006\025MB0\211*\035@!\256Ytg\231\371\342\343]t\211\365J6\210\204aGo^\231\326+Nv\244\203\ra\005T\255*\3056\005\240\261\210\210(\262\023\250gR\3167\206\tv\bkQ\004\021\262\367N):"
+	.string	"8"
+	.string	"7"
+	.string	"\236\3602\300>\220\016<\016T\330\335\217\002x\370Jg\3503\214\251W\257uZ#F\032\264*\243X/\263\222\332e\237\037\343j\316Igw=Yc\310\315\335\266\205\355\n\373\226tN\277\253d\355\021$\354\202\334.\354\003N\301"
+	.string	"\333\267_\2066\305\3060\310|^\346\303N\206\217\241\336\260\353\202!\330-%\214\361\316\271\374\245;\347\335\241;\347\320\001/g~\na\200\266\232\026ls\274\200\027P\370\004:N\336\356^\3009\037\325\235;\255\320b\252y\363e\277\210\215\204\260\323f\227\342\244/\373uw\327\324e?\366\007\336p8\233\rh\002\324x4\026\021\b\"\231J\235=\232\017x\372|\031!P\364]\2040.\036i\200H\237i4\"}\224R\365\216\212\212u2)\265K\033\363,W\232\262K\3613\001\205\031\t\245\001\016"
+	.ascii	"7\303\213rC\246m0B1\001\256\006\222\303^\204j\027\267\201-K\227"
+	.ascii	".\030\3055\327\"4\215AA\001"
+	.text
+	.section	.gnu.lto_dyad_listenEx.67.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\252\013m="
+	.ascii	":h\f\027?@\246Q:\t\236\247x=\323\016\252\320\243\016\267N?\315"
+	.ascii	"G\361\002s%\260\234vG\266R\212\221\2059\355h\355\240_\350\035"
+	.ascii	"\345\247\227\001~\367\300\306.\361\f\253\233\016\027\377I#\204"
+	.ascii	"\354\235dZ\001C\001k\001\335q^dO\210\354\334\330\2409\273i\225"
+	.ascii	"\301\265\363\222\310`Ob\250\r\273\337\332\371L\226_\344\216\r"
+	.ascii	"^\013\366*\225\227=\347\323\336M\307s2\263\206\330d\272\313y"
+	.ascii	"\005{5\315/\260\252\031\342y\236\366zx\244\331\254\231\277zq"
+	.ascii	"\354\236l\320"
+	.string	"\03466\274\332*\330\253X\003\225\234\341\323\274\275\235\206\304\346\234\225\t\312\026\341j\237`\033L\242\003\025\301h\210\357\345\264\263}9\253\021r\3139Oh\020r\303\013\007\310\241r\276\242\307\215\003{\265\001\237\341o\367\333\334M\373\246\020\031\371\31346\320\273\234\233\023\232\212\275\332M\266\273\373k\316\326v;\323&sI\200\215\235\330\034h\316\371J\370\002\353\325\364\003\326\253\030\313\333?\005\201N?\037\333[\325\024\337\266\377[~\375\351Ry\220\201\032\331\331\201\251\024\"BeN7v\226NM\251\222\347b\306\246\\\247\032n\366DR#\243\362\037\3063\304\226\306\027E\314\030\224\313b\202\366N7f\346\264\024\273+\0167g\221\324\264\003\\\242CO\313d\372-R\320\234\226Dnz+\321&[T\215L\312q\352A\313\242\347\3232,]\001\305\354r\277G\226C\356\355}\3109\367U.\311\336"
+	.string	"\336\335\216\272\373\255\373w(x\255\207_\200\021\304i\024v1u\324\246\263\005\370p\027\202]\274Np?\367?%\200O*\246\224\024\3566\201\342^\271"
+	.string	"[H\023\303_\035\265I\n\335\201\233"
+	.string	"\177\356O\025\004\2309'\257\\\301&o<\350\303\"\370\354n\341\242\371\242"
+	.string	"\263N$0Q\t\357\206q\271v\002\2319g\f\006z\221\322\240\222\24261\001p%\274\345\326\341\373\207\262\372\312~\241\033\"\366\271\\\375\334\345\274\202L\345\325\364\375h\245Q\274W\2660\211\277\0329\206\t\b\224\356u\n\201\271\327\372\270K=)\201\335\274\276\334}u\n\245E%\345\213\327\335\034\3624\343\265\356\2479\347\334\370Jw\204\323\371\037TM\275\371\013\017\367^p8\277\324\345\374\t\360\355\001\353m\001\353m(|;"
+	.string	"{\033"
+	.string	"\276\375\204o\007\331\333@|\333\351w\373\347\273\355[o\263\370v\017\337^\361m\025\337N\327\333\030\337\276\354\355\177`\363\310,\241\022\346v|r^\222\227)\033R\337\276\\\317\357\366\277\375p\177\334/\350k\367\373w\336\366>\367s\347\377\\\256\235\032\344\001z\240\366\202r\b\277\240r\006\333\342\2263\r\nG\206\001D.\224,S\362\322\356V\354\226\265\223\005\022xR\322\244\250N\314\314\357R3@\223\326\310\0216\371\264\030\001"
+	.ascii	"\340\340\363R\0228\201|\021*E\330p\037\340\247%\355\362^\031"
+	.ascii	"\001\013\211(9\3604\251\221%<K\330JwA\374\271\213\244e\342\204"
+	.ascii	"M\336\310\214 \020\007\355\fR\233\204a\324\253\222\253\272p}"
+	.ascii	"\370\207\235\240\264R\356\225UX\230\274\311v\013\320\t\003\353"
+	.ascii	"\316n\230\r\226\375a\252,h\027\254\265\302\225\303\352\351\303"
+	.ascii	"\300:\026[\325\231\005\272\272\351[+\353\347\356\247\341\360"
+	.ascii	"!ML*l\367\355\\%\274\267\326b\271Wv\232\315\262<S\273\345O\274"
+	.ascii	"\266M\333\305@_\310z\265\207}m\374\320\375\355A&%\244\333\235"
+	.ascii	"\022\317\322z\334\240\226/\336\177y\324\350Q\247\326LA\270)V"
+	.ascii	"\361\212\303"
+	.string	"\264c\356\225SX(\206\277\312\034Z\365\\-\265\023\370\304\300T\261\357\314)\265\263\002Z\033\264?\250G\216\376\201\266\007M\3169\305\025\320\332\242m\342\216\361\017\264=i\314\2426\235\301\230\342\314\274I\323;\031\253\365\2553)G%5\270WR\273F\252e\303&s<\270*\304\335\255\033\020}\273 \355d\271\364\033n\275z\361\215\243(O\024\005\267;\304\210\365\312\343 \240(\230!\370\253!lB\243S\263\334i\342M\203\253\350U$@\304\341\343\2306\027\361\350U\334\022r\031\205ZDaT\037\2116\262\214^B-\256\242\f\003m\234\301U\354\322\322\302\022\036\2114\204G#\227PkK\2071\353@k9\300^G\256b\r\265\210u\273\272\210x\013k\307\021\207q\235\241C\006&~\253\2105#\245a\334\262\221\205%\243w\3542\342H\217^\306\032ik\330\260A\203\006\342\005,\253,\253"
+	.string	"7\260\210]G\257\265\263\254\264\260|h]q\025\261n\\\311(n\025h#\016b\327\325\321h\354\272rj\202\035_\351\036^Y\320\352\227\373\223\210E!\375\206\037\200\217t\367"
+	.ascii	"\334\037\300\360\220\346\241G\207\233\363\315+.G\232\263\232"
+	.ascii	"\207\013\372\357\340\334\274'\274\026Lq\005d\b"
+	.string	"\346\025r\004\304k\375\271\013\020\200q\035\030;o\251\030\372\272\232\020\224A\3638\341\265)).\324 d!(\334FA\321\206D\304\"\025!\031\021\201r\231\310\272\340\023\351\210M\276\315\003\344\243\267\001\271\314\267)\313\362\236\f\355\262\"\275-\353V\231t\344\245\265\033Y\351m\310KW\321\267\365#$\336\333\332\331\030|f`7\357\270N4-z7\341\236\t\303\254@\202\262A\257\022\r\361\275gHMwJ^\276\fP\223\rz\265\237\206\275\3326\371p\205_\355\020a\030\376\352\250\274%]\016\200\371\250a4\246\0343\206fDDD\223$\205\016\260\"\021\243b\035\0210\271d\256HARZ\306\332\232\001\222;kg\252\251mW\275.$\234\367\206\215{CZ\336\035\207\301\373BWz\216\343e\343\311\350;\353\204[}\263k\343\274\321,'\027%F\236\216\272\374Y\310\343\b\204W!\210t"
+	.ascii	"\325\303\326\371\327\005\334\031\322\023%^\2149\215\374\237:"
+	.ascii	"~M-\270S\211\316yA\331X\223B\261\2154\257\204\310\312\034\376"
+	.ascii	"\330\t8Y\313\206\r\206\310T\007t.uR\330\006\tDy\320kl\351\"-"
+	.ascii	"}'\022Y\006\321,\237`\036f&#\252(\302\262\3626\315:\206\300i"
+	.ascii	"\277=\324\330m\023\022\0047\225\3263T\200\264\312\007\177\003"
+	.ascii	"i\345(s\204\347\372\242+\217.\277\256\2474\036\007FE7*\247<\300"
+	.ascii	"\257+\302\027]\013\341}qtYS\005\234\266\311w\312\312\307#\"{"
+	.ascii	"\027j9\177\177\357\"\263\002\255\310\023\005f@\263d\\\227\335"
+	.ascii	"\246B\003\200\215d\nD\273M\020\356\310\205\241~p\250\320h\245"
+	.ascii	"\253X\314~\363\206L,\"\222q\214\341-\023\267\221k\310\264>\330"
+	.ascii	"\nRl\220\004u\017t}\242\274\002eq\263\007'\002|=3g\177\316\222"
+	.ascii	"\213\231\024\t(\203O\360\327\017\243\273 \013B\374\210\343:\361"
+	.ascii	"\301\336\223{\304~\276\237g\020\035\025\315\245\374Fu\250\310"
+	.ascii	"@\031>xO\375\"\362\232\207\221X\324\325\036\246\324\323/\232"
+	.ascii	"\256\373l\003\215~\343\f(zA\034\301)\215\351(I\240\332m\200\213"
+	.ascii	"\216~5\201W,\343\036\267\324c\266bkl\331\274H\342\347\352C\\"
+	.ascii	"\250\320\331\034W\nLzL\330\335D\375\n\260(Q\247\355\243\247\243"
+	.ascii	"\020\032\340\317D\226\313\302wb7\322_\240\244(^\177"
+	.text
+	.section	.gnu.lto_dyad_listen.68.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\265\t"
+	.string	"\026\323D;0\305*\035\300\363\266g\303b\214QR?\356M\fs\0064`\007\332\264h\r\234\t\326\320\031\261M\007\256\250"
+	.string	"Mh((:rj\353\204T\331\177\304\251\311fkd\223-S\n4"
+	.string	"1"
+	.string	"3"
+	.string	"\256q\343\006\313 F\242\232\331v\327\303\374\322}r/\350>\245\306\305\253\350\037\344\234\207\305I\312$\204\205\272R>\273k]\261*ny\333\b\266?\266m\001\266h[\354L\207F\3652\327,\260\333\032\241\355\356\306\013\225\317L\206\346j\037\366\230\370Q\342\004\273.\030mw\334\370\240\362\351\261b\333\377\370KtR\372\020\235J;\342\244_M\251p\241\222(SZ\253\001\354\021\245\022\303>\267\322e\253z^\366\313\217\277v\231\001\266\327\001\314v)n\002\266d\212p8\246\020,q\356x<\235\216(\341\343\2008\003\244O\024\232\036:\2038\241\357\024\362\034F\037\311c\0305\\\f\226D\241g\002\301\320\263\214{{J\314\204L\271Sy\273k]\f"
+	.ascii	"7\303\213rC\246m0\"\224\020\240k\370\221\026\017e\301\027\023"
+	.ascii	"\022@cOJ4\354\232z"
+	.text
+	.section	.gnu.lto_dyad_connect.69.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`B\006m'"
+	.string	"\332F\224\017C`\346M:\207\013\005\032\276\240\305\375!VH\363\325pH\037\031\227\032\"\300\032\360?P\206\303~\033\353\273\251\303\"I\344\b\372;;\366\312\372\212\247\352\034U\234\n1\374}z\213\255\031\261\204\020\271\223\f\343"
+	.string	"\330"
+	.string	"\357"
+	.string	"\327\013\370\223K\244?\315\373$\324\251\016x2\254\236\r\027J\357uP\244\315\230\204\237<\"u*\003\266\375\032V2\357\336c\335\332\275\367\211A\204\001\3322\037\2038\244?\235\260"
+	.ascii	"o\231\217\346d\352\223@N\340\336*dk\367&\237\270A\372\223\223"
+	.ascii	")3\363\315|LeV\232I\244\021\211L\320\0203E\367\336\250\337\223"
+	.ascii	"\320\237\346\r\240?\333\312\325\367x\351\016=\315\266*\277g$"
+	.ascii	"\276g\233\234\307\013\216_aO\315\246>z\300\374\315+\314tz2\005"
+	.ascii	"\355^\274\300\354\316J\016\230\241\343W\223\243;!D\002\235f\007"
+	.ascii	"7?|\002\030\273\314gq\022\305g\024b\315SY\327\242\221\311"
+	.string	"\333\364\200\005\3202\200\221\313\\\021\006\366\266[#\306 \326\356>\334{\331\026\215_g\337\231y\n3\357`F\025\004>K\341|\007\005\376no\323\002\200\274\367\276\310l\343\206}\221\177]Md5N\265\363\366\263\272\344\265\320\253\275i)\267eW~\333ygu\\\346\016]K\307\234$\332\026c~\257\353\272rWafz\362_z\332Y\351e\177\322\327\374\006\332\262\357\264\334;-\363\332r\232Z\336\355,\243\247\345\263-\233m\271\333\262=-\237A\2015qP\306\272ty#:\367&Y\031\335='\333\226\277\371\323~\265\237\355&\363\371gG;\234\307y\033\373\234\324\326.G=\233\360G$p\357V\2265\026\351\317\246`\007\310\254\246e^\260\344\375\n\320\247Q\2355\025\177\200\314i\254L\211^)\0362Bq\367^\024\206\200m\356F\375\233\035?b\362\022\321 \215\226c\212n\273V"
+	.ascii	"\207f\313\256fNH=\363\241\360\t\355\303\235\375t\345\307&qE:"
+	.ascii	"9t\270\341x-\335{he\320N&\004\3070\246\237\265\335m6\210\020"
+	.ascii	"\366E\246\3761\2138\334\203\245\031\210\225GK\f\310n\0363\211"
+	.ascii	"\377ae\005\244\331\030\276\362\207\220{ \315\256\345\247\355"
+	.ascii	"\nH32h\272\007\322l\016\f\301q\311\333\2429a\310L\323\315\355"
+	.ascii	"#GX\327\004\266O\211&\023i\227\f\b?\227\232\031E\212\bk\335\333"
+	.ascii	"y\305M\262[\214\201Wj&5\202\270\354\"^Z\351\224\372i\377mY:>"
+	.ascii	"`\357\3668+\216\226\r\220M\313\244fn\341\302\276\250\324\026"
+	.ascii	"\244\fi\"/\255so\005\254\201\276\333\361\300@B\336\333\365b\214"
+	.ascii	"\264\353\005\204\237w;\232\024\200\345T\325\317V.s\023\316\\"
+	.ascii	"\343m\254<\302p`\267JQthiE\024<\024\006\255~U:\260\202\302\252"
+	.ascii	"\254\3370\210\343G\205\245\025\234Rb*\007-\034\342\270\262:\257"
+	.ascii	"\244lVVU\323\320\232\321XWR4\314aV0\2079\024\006\255L\326\260"
+	.ascii	"a\203\006\rU\027\244\240\246\240\006\334\220\252\312\032\nQ\236"
+	.ascii	"\202\242\222\342A\025\205\343J\352F\324\214+\254$\016\346\250"
+	.ascii	"\312\212\032\006\203YQ\276\344}W\341\236\2220<\250\277\355?R"
+	.ascii	"T\202\004\005\336\327F\230\331\327\374a\253\203\360\2167ZjB\363"
+	.ascii	"\336\243\207\263\375qeve\363\266\030\357\311\3662\244i\302\362"
+	.ascii	"\244-\306w{\257\327\r\007\206\315y\307/{\210\266N@\".#\273\026"
+	.ascii	";ry\262<+\352\025\256&\362\232\027\305\236\225(\263\232\345r"
+	.ascii	"\254L\217\220\226rO$X\264w\2356\263\272E\355\362\345\206T0q'"
+	.ascii	"T1HK>\020\364g\332'\363B\3014\r~\250a(\007\231CdHDdFR\220\026"
+	.ascii	"\016p\002\0319\263:\020H\212\212\263\254\001\367 Q\356\321\031"
+	.ascii	"r8\351\206\371\261\274n\007\242\013\343X\211\240\244n\033\307"
+	.ascii	"\354\362\226\306\213u,\203\212_\036Uz\203e\334\313&GWcAi(`\334"
+	.ascii	"\222\331\236v\206\201P\024_`\320\006X\020\301\275\f*\367N(\220"
+	.ascii	"\331)\n\302\304'<:\007L?Iu@\234R\024\005\241A\316y\235\263\022"
+	.ascii	"\251\345\215\212\026\016\210\3542\342\026\3244tw\022\210\003"
+	.ascii	"\377E$\312\202k\241\371Sv\003\223\327I\331\tUJ\332\003qf\006"
+	.ascii	"G<\210\276\361\267V\262\223\375\344\247\026\200\242\326\023\345"
+	.ascii	"<\fK2\373\325G\253t\376K9\352\315v5\312r\207\205\332\357\363"
+	.ascii	"g%\342\331\322Jh\206\324o\020_\006j\t\237\030\n\222\bV\031\023"
+	.ascii	"\001\205Gx\365\035|\b\221\212\343\031.\311\332\036\333\372\363"
+	.ascii	"\321.\365\321Q4\320\250\001"
+	.text
+	.section	.gnu.lto_dyad_write.70.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`L\007e("
+	.string	"\212F@\017H\200^Q:9\203S\226\250\271\306E?\315}\226l\315\350d\276\241\004s\214\207\331B\201x\224P\023U\373\347\027\313p3\020\255\360r\021q\315\223\020n\007\337\3516E\240\227\344\206\202\034\317M\257\375O\032!D\356$\003\334"
+	.string	"\324"
+	.string	"\343"
+	.string	"'\237\n\0233\355\347od\032\202\033:\346+\026"
+	.string	"\256\362\036\007X\026\261\353^U\367\22310\202&]Ky\225\357E^Yv\357\020\f\353\336\333\200/\244?\177\314\003utV\3457j\206\322\237\007\326\350n\231?\365(\276S\275\270\355^)*\254{\325\006\254 \375\311\352\007\240?\323\013@\177\262\217\331\315U\342\305e\005\231a\265\274\367\nu\021\366\t\013\013\313sS=\313\254\3573Y\032CO\263\255\217\277"
+	.ascii	"\370\006\030\214\361\231\031\223q\003\311\2258\242\314\335WW"
+	.ascii	"\226\033\233\254\214\210\320\307\323\230\205\241\260\307c<\216"
+	.ascii	"\316\202<~\366\004\237hA\031\326T\342\350a\376\254\267PA'\333"
+	.ascii	"7>5\223e\004\316P\350\3436f\341\336\313\026\030\024\236ig\346"
+	.ascii	"\"3\207`\216\031\bF?\303u\344\005\372\363M\001\270"
+	.string	"\343g\303\230\301pm\343\026\031\301\346\334P\253\247\177\365\nB~\366\016\347\206Y\312k\3570\253M\266\2070\177G\374\352\342\226bn\313\271\266\214k\313\004n\247\372\003\330^\374}\256\376=\277:\327^<\323\332\362\254-\313f\226\323\324rLf\031m\313g[6S\313\215Z\2661\3137`\211Z\226J\206\257\021v\357\2150\260\273ufI\362\253\237\371|*_\231i\314\364)\374*\277\362\254'{\210\353\023\337\217\223z\203w\251k{-\246g\341\325To\020\215\272\035\260\260\260\301\302\"F\203oK\027\263GZ\341$\216I\006\376Q\311\274=\324+\274U\215\345\324\022BR\207\332\037\231\256*\341\324+\204\361C\235Z>H\242\331\r\306\210\033\244\364\336+\241M\221\305c\335t[<i\250n\375\253\007\257\365\255) \237\2304ia!\217\277\361\264\243\016!v\272~\351\315\002\375m\233\277z"
+	.ascii	"a\017d\264cX\032N\252\215\345\372\3008@\307u\256-\362\t\254\t"
+	.ascii	"\n\n\364\033\227W\033\2350\2349d\244N\335q=\242*\21556y\2315"
+	.ascii	"R\246\230=\004\327\004\272@\325\030'\373\305|4fpm\333@E\361\317"
+	.ascii	"|\340\225\177\204\267\316I\364'\201\266a\240\242\326\313\214"
+	.ascii	"K\2247\371\324\013\312\265#\007\350\327\352c\375\313\217\264"
+	.ascii	"\375\343\313(\205\270\022\211LQ\004\256\005\266\377)\037#\342"
+	.ascii	"b\302\024=I\264\r\255\210@\246x\314\311T\210p\001q\313\301\317"
+	.ascii	"\357^8\331@f\242w\3415\345\336\271\024\335\213\353\336+a\313"
+	.ascii	"\207.\224\216zGg\213%#\"^\022\217(5\261T\244\242\227\002Mz\317"
+	.ascii	"\205\221\222\311[\342\2210y7a\302n\327\213\300\013\"\n\002p\304"
+	.ascii	"\353\255XRB\231(\210\004\257\005\t!\025F\274#\241\021F)\0060"
+	.ascii	"RRo\205\320\022\022\322\n!\232\372{K\261l\370e\353\327M<k<5."
+	.ascii	"{^QY\317\332\"g\344\330\360/^SY\327\322P\345\206]f=\204\233\315"
+	.ascii	"Q\007\222\364\326>G\0356lO\327\032\352\306'P\223\332\232M\353"
+	.ascii	"\323\264\206\242\365\211*5\266~1\350\264\266\365\347<\001\271"
+	.ascii	"\361\266\254\241\226\222\326/\336\332;\\k\013\346\275\367\312"
+	.ascii	"\322"
+	.string	"\346/\223Pt\221\013\t\3759t\006\030\347G\247\004\207\224\317\242\207\360@E\241\335\035\353\035\362\211\211\331h\017Y\315\310s\266\227\034\263\317\036\262z\002\002\207\327\256\242\006C\354\200\230\250Q8\004\031T\206dFRP\220\026\206\003\200\002\231)#\333\021@\271\203\312\002Mj\fsgD\361HD\344\356_\333\342\302\352d\034\231\"\202\343\0164|iQ\216\245\215\303%\224\357\007DP\211\300\306\317s$\307}\246\340\240\354&7\200\277\271*b\327\302o\350\336\312]\325\213pA\306W\202\351%n7\242\004\257\025\200\355H\033C\263\231\305~LZ\352\020\232H\260N({\326\372\0342\314\346\351\340\223z\331Z\363A\027\277\346\265UE&\rjx\34307\273\316\361\f2\217=\004OA\310\275\311\t\370\300\310\3527\371Wqn\034\213\001\227\2411q(\263LT{3\235P\374Q3I\006\237\212\265"
+	.string	"\245\217\240\360gi\nT\235\230C\352\327?\f\333\032\266)\314\364\367K6c|V\255\3618`-\001p^\203kA\231\267[\212\341\231Nq\323)X\253\f"
+	.ascii	"\360\233\240\"\302\007Q\374\207\234r91r\016i\244\235\255\007"
+	.ascii	"R\365\301\b\275|=d\032\267\177\201\370j\207\t\321\362R\222#\346"
+	.ascii	"\351\306\264I\243\320-\315\341X\204\210\331\350\236\027\327\377"
+	.text
+	.section	.gnu.lto_dyad_vwritef.71.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\374$e\202"
+	.ascii	"J\311\340,K \016\333\031\003\243<\237\247\341\216\220\2462\346"
+	.ascii	"O\233d\031p\373\006\331\327X\304\242\001\037\004M\351\030Xs\351"
+	.ascii	"\273\264\234\215\033\231\026\377\225\320I\256@\300\266\177\322"
+	.ascii	"\356\b\241BG5G4\312\314\003\t5\341Q7\330(d\247\224R\304\002\211"
+	.ascii	"\002\277\002\325&\3542m\346\257p\205N\206\276\357\373\347\347"
+	.ascii	"\320\036dvy\252\367\270\303t_\003\266\340\203\311a\317\330\336"
+	.ascii	"\367u\003\307(a\231\256w\340T\217a\352q\372~\265do\221?\277\302"
+	.ascii	"??1TI\247\037\023\307[\f\037\347\375T\271 \331H0_\244\216\257"
+	.ascii	"\330\364\005\353\267\256)\033V)\217y\343\rf\252\277H\375L_0\016"
+	.ascii	"\314\246l\330F"
+	.string	"\362\216\3662\305\3546\022\331p\375B\317\365]\303\320z\354.\033\363\232\352\354\030\200\\\231\340}\273\360\252X\220 \214\256\353\234m\027\244_\2557\351w\267f}_(\004\311F\376\374\bLf9!</\340\333\320\300;6\353\373Nm$\033\031\364\204\331\\\272\213\263\343\230\272\314\232\276_-\330Uec6\222k\034\203T`\366\225\356-|&\371\276\255`\022;6\354\213\366\0225\222g,\3230\337\271\335\\\030\362\303\363f\271u\020#\331Z\230o\032\311\002\220a\372\264H\241\213d#\227`\230\355\314\315\326X\234\335\266Akx\337&\\\354\336wz\304'\222\215\344i\373\264\215LvO\333Hf'\363\231\236\252\275?wV\266\336\260\357\373&=\t\314Lb\247\261\261\221\261\217\323\346!\326a&\244\263\233\230\226X(\255P\221\204td\304,\"J\201bH\350\204\211\022AK \022#D\204"
+	.string	"\361\341\307C\007\037\016=\0334\360\354\350\344(]\234\233\244M\333\002y|wr\013\221\365q}]u\323\031,g2\354\245\302fa\246\225V\224i\025\204UO23\330\347Hc}\\_a}ddD\f\313\004\022\024\263\026\221x\023\363#\302!\025\343\353\024`\366\274|\t\203D\301\305\207\350Zh\256O\230\220\353\022/\304y\320\\a\027_\342H\275\354\350\032\310\212\223h\353\021XZD\b\266\006\261\306\202\177\300r\275\342?\311\260\366p4\032\244B\226\002\021k\f\335\327\326\261gLn\260\365\242x\207\302\366\021\364"
+	.ascii	"Jsx\322=\033Lh\r%8q\236'\307%V\315w\2166F\274Nh@(\224\243S\242"
+	.ascii	"\025\257\365\304\\'\r\354\254s\314Z\031\344\332\b\020\005\023"
+	.ascii	"\241q\312P\200\222\371\r \324\354\270d\354 \024\240c\236lk\033"
+	.ascii	"\003\244H\242t\333\317\263nq\\R\341\310\\\003B\321\034\335.j"
+	.ascii	"\250\264^{\327\227\226#O\300\3712\262\244\243\320,\255r"
+	.string	"\220\n\031\007E\241u\310\343\261\350,\f\b\r\b\025s\364\371cR\350~e\371\267^\027 \355\262\262e\243`\206\3556\002\274\357\313\316\365\005\326\354\324\314\307\022\314\214\2049h\200h`Bj~*\226O3\316\333\2512+\340\"05\311\013xY\263\32745\222\235\214\003,\003mX\335\340{\221K\211N\\\0314{5\001\214\n\231\344K\271Y\335\202\353 \343?\361\210[\257\001$\230\\\365\214\215\313&\321\003{X\215\0330\270&gl\377]\314<\275j'\265D\253\315\261\313\373QnB&f\200\036B\r\237\352\373j5\227\215\244V\033A\321\310\306k\006\320t\342\306\354\216T\305\265\366\245\334\355\363\201\013KZ\260\220v\306\023\311\211\033\233f\2573\276\345z\371\224r\017i\271o\264\b<\363\214'\342vD\353\257\270\2750\t\363\256\306\031C\303Z\257|\361\003a\226/H\367b\207\246\361"
+	.ascii	"\t\273\007W$vlV\336\267\003v\2561\036\370i\261o\001vT\333\310"
+	.ascii	"6\202L\202e\263\342Y\314W}\226T{[\251\227u\007M\313\031\231\375"
+	.ascii	"\351\004\213 \371\244\273H\333H\377^\354\"{~\020\343{\332\313"
+	.ascii	"\247+\362\212n\372\030\337T\255*X\336\310OL\276\372\312\253\255"
+	.ascii	"\355\370R\026\352\bZ\245\237\300\2150\313\023\231(\332\b\350"
+	.ascii	"\212\200#@\377\245\3215\211\037\242Y\300 I\255\276B\321v\255"
+	.ascii	"t\002}z#wt\206\350!`\307\205A\263\327\327\025\231\247X\376R\346"
+	.ascii	"F\302^)\341o\302\354:\027q\235\211\270\316C\\\347\f\\g!\2563"
+	.ascii	"\006\256s\020\327\331\312u\256r\235\251\\g \256\363\017\327y"
+	.ascii	"\312u\366\341:K\365\340q\343\001\0335h\264\\\363\f\031\355B7"
+	.ascii	"\0021\272\255\033FO\273\007\350\270\346'\247\026M=mfr\235\227"
+	.ascii	"\\g\026Jg%\245\363\212\326YE\216s\222\353\214\344:\037\265\316"
+	.ascii	"F7\316L\034\347\"\036g\242\035\347\024\2563\n\035\347!\245\263"
+	.ascii	"P\353|\"\307\331\204\353\\\302u\016j\235\2277\316@8\316$\224"
+	.ascii	"\316#\224\316\"Z\347\0209\316 \\\347\017\256\363O\353\354"
+	.string	"\341\306\271\003\216\263\217\322\231C\353\334\223\343\274\301u\326\340:\363\264\316;\256\263\316\215s\016\216\263R\351\354\266\31689\3167\256s\322u\266i\235\333\033g$\216\363\261\361\232_\351\354\035v\204\301\204\255:$lwV\236\314\364\365j\\\363\372\035\361\242t\\\267\\\267]7^w\f\214\211\255\330kz\361\257[\002\261\207\215\3303\264\232\307\333rx=\323h\332\3322\374\025NJaf\312\220\370&\\\323]\005\372&\363Y\217\365O\240\177\033\031\013\025\023\263$\324\330a\261\324-\321l|\307\315\265\215\307 'nI\r\337\353\0322\030\351\003zi\017b\234\031\335\b\036\317G\233\377\026\337\305Q\355\210\207Q&\313\023G|w\221\351\365\206;&z-^\200\343+\342\200\027\202\\\327+NhTR\304\277X\354\"\003\361\036>\304\317\203\370\220\346\372\363\037\254h~\f\013=\360\370\306k\361<\036"
+	.ascii	">\255*XV4g\f\315\246Y\353s\204\317wx\356+\237\210 V\037d-\204"
+	.ascii	"\f\210\177M@X\2151\243\205\313\007\253\257\262\252\272\312`\365"
+	.ascii	"\371F\303\327}\246\303\267\241`\340\230\016\177~}pR\302\200\371"
+	.ascii	"\342\343\345\341\364\214|\375\274\224\361\332\306\232\225\362"
+	.ascii	"le\nt]<\274\324\255\264\f3h\366*\343\033OJ\306sp\227\244\273"
+	.ascii	"\013\223,~W\276\330\341\245n>9qe~\331+\007\007\242\036N\3479"
+	.ascii	"\374\013\352\206\337\371\236wZ\344\371\r\357\002QC\f\324\346"
+	.ascii	"\367\345\361\274\206w\201\b\003^\363\373\362x\376\373\354\252"
+	.ascii	"\352\232\357\202#\356\274\210&gP\332\244\016\326\334\234\247"
+	.ascii	"\363m\013\3271\3343 \036\246I\022Wf\307A\3719\317\215u(\355="
+	.ascii	"T@\236jC\313B\0245\032\200(\017\373\fy\200\374\017 ?\260j\372"
+	.ascii	"\270\366bgP~#f\351>\314\371N\003'\245\263\345\255\331\302(\307"
+	.ascii	"\215\363t\264\264\320l\275\347\226\3036\316\323\301\302\326l"
+	.ascii	"5]\250\3746\\\003|\217\2642\256l\232\335y)#5\215\367\022\334"
+	.ascii	"\312\320\370\216+\3413\236\331\211\305\231\305\233\213\306\343"
+	.ascii	"@\313\372+\026\342*{\263\327w*\305j\351\270\317~\305\202\250"
+	.ascii	"\227\253rW\2654\336\375\027\202[\2147\337>\316?\315iU\261\371"
+	.ascii	"\233\177\361\266\305\230\374\025T\260\371\344\277x\323:\253\302"
+	.ascii	"T*\315\017T{\252\232\315\177\240\223\266)UI)\315\177\363\031"
+	.ascii	"\332\3777\3026f\356l\267^\267\227\365\231\003"
+	.ascii	"\344F}"
+	.string	"|\344s3\302 \300\233\213\333\277\362#YSWN}s]\215\332\307O\275\317i\255\301Zs\215\232C\365\360\341V(\n\224K\304a\266\017\207K\001\220\251]\306\322\334\274\224}\274\324\203p\353c/!\320\307\273a\027\031\273\032\007X\246r?a\277\346\274\266\221R\357|]d\214}\003G\005\360]\354\344\341\332\233Mc\324\275\346\370\255\330\313\347Yw\"\362;\333iR\006\270\264\252I\323E\365\b\371\315\245d\317\2431|\004\264f\207Q\353\211n\t<cK\2009/\031L\324\243G\020\037)l\030\207\320\023\251\222\322!\205\034b\305#\007\324\017\250\034\311\n\254\242|\350\350\321BYAQp\334\021d\202\247\262\252\372\035\375c\207\347h*+\006tX\361\240\022\222\254\212\242\202:\346\320\361\243j\031E\005\225\264\222\332\361\354\364\364\344\344\244c\t\n)\007\022\217\024\224\016*\253\252\226s Q"
+	.string	"5\204\202$\037<\240\244\222&\340\321\303\207\247~\350\240J\262\232\232\242Jr\371\331\337\344&M\317\357\371X\034\304\016\310\361}\243\001t\f\335V-\336\310K\337\247\254z3\265e\361K\357s[ `y#\224\017\303\324$\213W\022\266\245Q\001\313\232^\232\364\203Am\253n\251\307\363\321\007\370\246\bZ%\245\233\350\232&\377\022\276DM`:\262h\372\n\356\270l\325\371\304x\246\036\337S\246\357\361\375\346$\355\216\351{\252di\305Y\324\277\271@\344\272\276\036\257\370\027sIo\364*\336\211\357\350\223\336\005\025\211\232\327|>\272\243Gz\027T\274\273\346\363\321\035\375\363\325U5\3215\235\321\321\030\2753\022\266=\003\377\304\200A\022G\305/k}\262(z\346s\017~\026\245\"D\276\310\n"
+	.string	"\362\366\362T\020\341E'S\234$\021\371!D\206\f\n\006\026}\377}\226n1\314o0\017'\245\374-\377\326d\032b\276\033\347)_\313\267\320l\252\006-r\330o\343<\345cy\266f#\016\026}\317q)y\246a\001|\023\361"
+	.string	"\361\220V\340P\305\353"
+	.ascii	"\320\236\256\230\002\230\243\227\252i\275(\243*R\365\320,\252"
+	.ascii	"\0275\342\021qD\225L1\232\0229\243\020=\214#8\242M\2260\255)"
+	.ascii	"\234S\332\024fbeEh(P\214\225u\023\246\205\371\021\275\324.\213"
+	.ascii	"\302\220\017}\357\365\2353\205!\265\336k\275\006\200\234+8\257"
+	.ascii	",\265\376\312n\350ax6-\204?k\234)Pd\bH\372R\250U\301vT\373R\376"
+	.ascii	"4+\023>\343rR\316D \354\250v\311\243\375\b\203d\304\270\274\b"
+	.ascii	"\374f|&\031\2707\306O\306g\210\340\304\366\304\252\037f#\035"
+	.ascii	"\233\3768#\267\227\264\257g\346\243\276\213\322Q{\337\327\311"
+	.ascii	"\337\032\261\026Q<\271K\334\252\023z\340\255\356\262[u@6\376"
+	.ascii	"\351\273\200\236\334)n\325\t\335x\r\356\260[u@5\336\351\273\236"
+	.ascii	"\276\037@\352\247\177\340\235O\353\f\013\321\311]\221\237\276"
+	.ascii	"\343\312\374-:\031z\351\253\220D\310\304/\377D\320\233(\361`"
+	.ascii	"\377\025\364%\336\353\223\004=\222\357Z\336p\372\033e\b\253d"
+	.ascii	"\226H\311Z\237B$\036\350\271\013\327\234\310@\310g\260fb\351"
+	.ascii	"\314\253J\t!\\e;\253\006\ty\f\204`P\030\202\334\250\322H%\220"
+	.ascii	"\203L\251\221\021\021\221$I\322\001\362\013\020\b\"9J\255,\017"
+	.ascii	"\022\340Bq\222H!S\314H #\243 \005)\243$Y6\003\307\200\016\200"
+	.ascii	"-P\315M\245\301\026z\3262G\367\r\337b]\323!m\357\0044\203\nq"
+	.ascii	"\b\324r\001\021\312*G\235g\036/\346\372\033\nrU\372\220?\235"
+	.ascii	"\213\260\\&\202\267\311!43Q\347p\302\007\021GD\002jp\243\325"
+	.ascii	"Z\3339\202\235J\246\266v\t[1\326"
+	.string	"\227\300\006\257aG\314\314\333\221\316\206\303S\017R\214\007D\246Y\226\334\177K\263\201(\317\341r\017x\344\023\334\307h\361\177\313\002\243\346\351\031B\215\262\023B\344\261\351\215\322\021\273\035\312\252\325\253\244\b}\034\205~\035\325\353PJ\253(\203`\201\022'+\016|\321g\264a\272uO\351\373I\323\026\003\344|\345\272\304.\237\205\267u\204\370t#\346\2034\232\315\031\013E\255 :\200q\270\265B\333\362y\320\272+)F\272}\3537IZ\330:|\377u\215\261\220\224\307G!e0\214\027\266\3221A\375\335]\037\307\n\305\336\230gWB\254/&\036?\214\355\bb\244\276\211\221K\340>i\r\031\227\002\224\0337\211`G\251\2179\240-\274\304\333 \302\031\262\237F\233\016\201\373\177\025\302\331n\2028\001\275\345z\310\376E\024GMC\203H\216\225\340\024\367\216\020\351CQF\303>\017\001Cb/"
+	.ascii	"\224\260P\212Rab!Tp1\210\233\2037Zie\007\257\310 \306\260Q\314"
+	.ascii	"vq\031de\243\356y\031B\215\262\023B\344q\013Qv\314Tc\213\037"
+	.ascii	"l^\223C\337y%d\006c\207\031\026ik^O\214\310\211\026\362\025\f"
+	.ascii	"\003Vv\264\247\306`On\347\233\032\331M\267\206\213\266*\013\316"
+	.ascii	"\327\251\276\3278-\034\256Qrkn\f\232v<l\233\022aP\t\303\200\006"
+	.ascii	"\r]k(\215s=\374\023fQL@\335rz\360Ow\235|e\023^q\314\r\256\233"
+	.ascii	"hC\002\005\377\255\322\325\337\021\036\213\374\307OA\214\006"
+	.ascii	"\317:D\316w\021'\301?\231\324\032\230\013a\007\332\206\336\""
+	.ascii	"o\310\310\210\313\355\364\357\177\364\340\267\276\227V\362\200"
+	.ascii	"/\201\225,\225Dv\262~\235\200J\030\356:\313\252\227\334\241\311"
+	.ascii	"\223\365\216\275\260=\346\3235\363\224P\215\361\276\0042p\rt"
+	.ascii	"\304\314\270\201\324\332\007*\264\306\316\301\312\376\253\234"
+	.ascii	"\242\266\257`\253\317\030\246\312\344\023%L\005f\312\013\376"
+	.ascii	"$\033t\026\361\216\310\224\255\240\252G\307Cw\236/\322\004\231"
+	.ascii	">5\326m\004\246\r\246\377\002X\307v\374f\226\331Po\252\034\352"
+	.ascii	"\305\265wd\016\326JNc\371Ol\313\027\246{\362\364\364\006\312"
+	.ascii	"\203@\354'\004\013\235Bs\354\004'S\221%\256\037\374\034\006@"
+	.ascii	"\\\300\332<\226s\230;\206\337n\334\204%\210\217\\\303l<3\213"
+	.ascii	"9\234\230\004\224\336]\246\274L\t\030\311\273 r)[\355\207m[M"
+	.ascii	"\304Z\354\300\205\343\311\232!\242\223E\247\315\242\251>&\372"
+	.ascii	"\007\243\345J\021\bo\002\0058\311?9\347\347\276\005\360\227k"
+	.ascii	"\343\314J gr\235\255s\227I@#\026\033\326\213#\351l\363\022\""
+	.ascii	"3\027\217v\027\253a2\344e\3640q\b\205?^\366\023~\013\356\303"
+	.ascii	"\177\315\020\340.AP\206\023\223#Y#\211\275Ik\323\317C\303I\322"
+	.ascii	"b\261@\363\334YX\262\255=\313&\267w\022\013p\254t\216M\274P\305"
+	.ascii	"\2317O\214#\255\200a\370p\037\232Ax)\024\374ylb[\314y\277\006"
+	.ascii	"\356\211i\246}\007\316FQ48\264\247\230\260\266\367G5n\274\260"
+	.ascii	"\365\205\233\242\033\2716\330\032\366\245\263\225\224\363\230"
+	.ascii	"\013\r\201\204cb\300 A>\332Y\371\027<\3325\206\277:%[\247,l\235"
+	.ascii	"\266\260uZ\006\026\272\033\227\177\305:d\020\234\231\330YG\376"
+	.ascii	"\017\001\034\343d\302\003\005\342\030\017\344\232|\360\261\344"
+	.ascii	"+Yp\036\347^\036u\004\212\"\"\364h\f\337Js\002\003\371\233\243"
+	.ascii	"\201\227\r\242\205\322\204/\033\177c\324w\212\fA$?\003a\261H"
+	.ascii	"\300\005\333:\201\254\230f\007\267"
+	.ascii	"R~idf\3612\344\251\225\204\312\302dn\240S'\224\032wD\265\334"
+	.ascii	":^\370\0238\244\340\313\222\212X\037\256i8\020 \237\363t\235"
+	.ascii	"\366\216\356l\352\200\005\221\271C\024\301\001~\267\3348\036"
+	.ascii	"\006\271\002\004\023\266Q/\3066'\0166\034\305\3641\376c\272d"
+	.ascii	"\3618\234\256w\257\227\342 \022\314bL3\200\256\025\224\212\021"
+	.ascii	"t\225\032\2441eD@\201\366\214\2576\327\222u\364~ \243y\006\240"
+	.ascii	"wG\321D\265L+\344q\317\035\271=O\rE\307WF\333`\364\234j\332\342"
+	.ascii	"\306>\203\361\262\336m\2273=\t;d\323\273\005\364\267\214\204"
+	.ascii	"\304\211#\2000,\313\240\005"
+	.text
+	.section	.gnu.lto_dyad_writef.72.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\205\f"
+	.string	"\346VTA"
+	.string	"Q5\035\360(\371\262\221;\b\013\320\001g\261#\204\245\001\220\022\215y\200{\333\317\236\244\303\315\350\245v\306\021\n\305B\2711s\351\177\327\372\037|\\\030\314\037\243\217_\223\364\021\250\037\255\355\235R="
+	.string	"C"
+	.string	"A"
+	.ascii	"\027\260{b\341b\267<`\003"
+	.string	"\3335\227\257D\256m\037\020\271\346\321\376x\211ZK\314\204\0063\307\356z\225\304\307\323\321\277y\017\3224:\225hv\327\2244}\270\353m\027\260\275\300>\207\0370n\324\200=\004\216]\017!;H/4X\352\256\337\376MO\270Vg\333g\2755\336%\242l\214\335h\304R\347n\251\273f\315v\355\026.EGK\n3\022l\327\270\022\335\251}\025_1~U!\001\250\347s\001\005\200\312\310j\2556\030fx\251J\022\332\375-n\202\bt m\t\023\350Is\030\352\310'U\033\376Bq\202\330X\252\303.G\264\216\260\237\355\356\272\236\354\227\177\366\325_\267\203\b \217\370e!\320A5&\223\301`:\b\276\313\346B\001\277\216\030\002E\274\271p>\021\307\203\360\371@\257\301\347A\305a\204\216\350\205\302P\364&\345>\333z2\003\325\t\220\223T-X\224\355\212Pp\327\177\262h\210\003\031"
+	.ascii	"7\303\213rc\306\336\217\346L?\013\003\331@\310\024\306ej \030"
+	.ascii	"\346\324E\320\002\254\241\024\275\210e\303\226\361\3155\020\f"
+	.ascii	"s\013\f\001\205L@!\270\f\204\232\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_dyad_setTimeout.73.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\245\t"
+	.string	"\206RD< \345*\035"
+	.string	"\254\030J\034\251\360\t\341\361\032]\356\361\b\b\205\302\370\006"
+	.string	"\236jRn\037\273h7\317\021\332r\206(\204"
+	.string	"\204&\214\247\r\t\227\016\326\363z\304\240J\0327\332;\245/"
+	.string	"3"
+	.string	"1"
+	.string	"\347t\247\336\t\272S\217v\313\253\306\026\334h\025\"/\273\373\315\331\307\313\321\377\3075/X\3532\303\260\273\226/X\354\236\267}`\273\301\266K\267\221\247\234\354Z\344\002,\216\226p\330\376\306\356\304<\262\332f\302R\333\335\217\027\274\323\016\205\347\322~\307=\306\323X\037\330\225\221\324v\353\307\b\336\251kv\304Cl\363vW\301\007\221X\005\250l\234\372\254\356\224\263r\341\2229\033d\344PV\002\260kKN\f\373\230\335]O\231\375\372\317\323~I1\001)\322I\034\205\251\214C\"Q(\024&\200\240\021H\300\004\206(U\252\363\bD\002W\244\357T\002M\237C\351\201c\021\"D}*QD}\233\272\307\354\224if0\234kNx\316\f"
+	.ascii	"7\303\213rC\246\275\245\254\005\235\177\232\205\357\302z\013"
+	.ascii	"c\017U\003\205\n\b\356\334\242\235O"
+	.text
+	.section	.gnu.lto_dyad_setNoDelay.74.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"}\f"
+	.string	"\226\030WB\020\261f8\3630\222U\372"
+	.string	"\032\320\257\026T\035\034\261\351r\204\210\003\206,\340D\374\027B\004\374\344\\\037H\221fyzR\344"
+	.string	""
+	.string	""
+	.string	"@\274[\300\004Z\277\004\232G\036D\216~[\373{o)S\nA"
+	.string	"A"
+	.string	"E"
+	.ascii	")\223\350\2542\261\200\377\364\002\363\177 M\300\361\325\317"
+	.ascii	"\036\230"
+	.string	"/\216\007`\276\332\2655\376V^@\305\213\311%\306\177-Q\356\214]\355\026g^J\311\270\021\341\177\321K\331\340\246\333\"h\013\241\265(\031\242\265\365\377\315Sk\225\275\201X\013\261\231XD\2543\005*/R\206\301\342\317pC\3433W\n\021m\335\321~\324t\360s\211\316\253\3124\373A\254\200\3715\200\324\001\307\327\001\353\203\246cl\035\345*\240\275Z\347\220\245\266%>a\301-\3767\250]D\027\b\254\3747\213\257\332$3\225\001T\007\232L\257\374\300\263\301\314\264\251F\307NL\233bPVv\002p\241r\20275\212\021\237\f\233\343\214\366+a$\021\227\375\204\204|> \006\233G\304\023 \264\201F\244\022\254\"\236\221\r\303\210F\201d\013i\022H&x\224\023\201F\032\211\343FZ\307w[\317S3\224\207\231\223D)\007Z\016a6\341\226\306d\352\003\213\267\300\230+\203Y\331\023"
+	.ascii	"7\303\213rC\246=\243\254\2053\\Rm\003\215\271\233\226\2732\356"
+	.ascii	"b\206\247!^\354X\327\330g\230\035\210\001N\360\251V\300I^\\\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_dyad_getState.75.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\355\b"
+	.string	"\006\221>90\217\323\001\260\\D\b\236=\220\364\035H9\026w\225\322z\207\271\020\324\355}\302\"\326\237ks\023\376{\375cF\020\302@\317>\2105\340%\301Cc\272\323\247M\366N)-"
+	.string	"-"
+	.string	"-"
+	.string	",\026\213\325\313\356r\235s\262S\354\002\331\351\344\270x)\372'9CE\306\nj4]f\026v\327\0225b\334\363\266\013l+\330v\005\027\257\230m\241* \266E[c\017\240\030\\\332W}D|-=`7u\222\262[\017L\240\235\272j\266\375\220\213\210v\013\253\035\343&\332\356&\370%\023$\355\343\324/e\247sn<T'\371rFc%\214]Mrn\330\307v\246l)=_\177\211a,\327]V\273\001\356<\236\256\373\020\274\355\263\001\210\274/\034Ed\376l \217\004\342\036B\236\210k\b9p\fB|!7\002\301\220\323\324\275=g\3474)lK\334\304\255\f"
+	.ascii	"7\303\213rC\246m0\342)b\3143\001\273&\006dAn0A\300\211'\325\212"
+	.ascii	"I\230d"
+	.text
+	.section	.gnu.lto_dyad_getAddress.76.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"u\013"
+	.string	"6\026Q@"
+	.string	"S\225\016\360\205\002m\240,E\303\276&Av\"\"\017\177\307\366\357\263\361\32572\312l]737\311\372\333\273\240R\032\376\377\377\273\361}\312[\201\345c\017\354`zj\200|\262\267\224)\005>"
+	.string	"?"
+	.string	"="
+	.string	"\353m\366n\311\036\265W\262G%\361\323\241\346\311/\300\n\021su\250C"
+	.string	"\335\207+\254\204\304\370\002t+\310\340\033\001q\026O\220N\2259\211\260\273NW\347\341\216\267-\3016\004\373\006\002/\373\260\037:\235\232~\204%9\376\325\330\355\020\373\2618\"\215\024\266M6\305>\200bA\346a\245\017\330}\331\220\261\3535p\002\355\321\266\257\342+L>)\007VJ\004\246\344\306\006\022\036\033\251 \266S\021\244T\005\241\212<\277\221\220\031jRv\315\035/t\254\262\207m\fwAr\340\267\310\240A\333\335\237x\364K\331\343\225\200\tX*c\236\214\330\364a{\250T\021\373p5\2763\032M&\323\301p\227\315E\300\207\353\204F\242\314\233\013\207#q\266\n\036\356\263M\360P\260\030d\241\023\332F Ph\243\330\266\267\207\253/S`\244Ora+\261\333\272K\244\265\036(xL\275\006\016"
+	.ascii	"7\303\017u/m\330\302E\345'\242\264\210\353\016\021\334\022\210"
+	.ascii	"kbo\026$c\302,~f\214\331N\rAA\001"
+	.text
+	.section	.gnu.lto_dyad_getPort.77.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\365\b"
+	.string	"\306\020>90\217\323\001\274\\\022\034k\234"
+	.string	"\277\003N\337b~AZ\356p\302a2uM\201\020\353\317\265\271\t\377\275\3761#\ba\240g\037\304\032\360\222\340\2411\335\351I\333{\247\024,"
+	.string	","
+	.string	"-"
+	.string	".\026'0\273\313y\336\311\216\321\013d\307f\307\305K\321?\311\031*4ZR\343\351R\263\260\273\226\2511\343\236\267]`[\301\266J2\273\202\245\204\330\026\355\215=\200api\177u\226\370jz\300\256\212\205\262[\017L\240\035s\325l\373\"\037\021m\027\255\036#\247\025.mw\023\374\222\211\222\006r\3147M\316\307\n%_\326l\254\214\261\353IN\016\373t\247\312\226\322\363\365\227\224\266^\3162\263{\361\n\356>\237\256\373\020\274\r\264\001\214\274/$Ed\006m!\257\024\342\036D\336\210k\0209t\fB|!G\002\301\220\333\324\275=\247\0075)lK\334\304\001\r"
+	.ascii	"7\303\213rC\246m0\342)b\360,`\222\t\30051 \013r\203\t\002N<\251"
+	.ascii	"VL\302$\003"
+	.text
+	.section	.gnu.lto_dyad_getBytesSent.78.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\365\b"
+	.string	"\306\020>90\217\323\001\220c6\222\332]\031\354rD;\026w\225\322z\207nQq\255y\302\"\326\237ks\023\376{\375cF\020\302@\317>\2105\340\221\016\330g\273\323\223\266\367N),"
+	.string	","
+	.string	"-"
+	.string	".\213\023\327\356r\235s\262c\364\002\331\261\311q\361R\364Or\206\212\214\024\324h\272\314,\354\256%j\304\270\347m\027\330V\260\315\0221\333\202\255\200\330\026m\215=\340bpi_\365\021\361\265\364\200\335\024\212\312n=0\201v\314U\263\355\207\\D\264Y\264v\214\233U,mw\023\374\222\t\222\366q\314/\315\215\207\352$_\316h\254\204\261\253I\316\r\373tg\312\226\322\363\365\227\224\256^\336j\355^\274\002\356<\236\256\373\020\274\355\263\001\210\274/\034Ed\376l \217\004\342\036B\236\210k\b9p\fB|!7\002\301\220\323\324\275=g\3474)lK\334\304\001\r"
+	.ascii	"7\303\213rC\246m0\342)b\360,`\222\t\30051 \013r\203\t\002N<\251"
+	.ascii	"VL\302$\003"
+	.text
+	.section	.gnu.lto_dyad_getBytesReceived.79.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\375\b"
+	.string	"\306P>; \3458\035\340\305\002H\021\250\341`\006\031>\310\006\273 \256\220\210/\300c\346\312\374#\366\2409\006\312\035\226i\033\200 \001\020\273aG\256A\021,\030\035\031\261%#m\357\235R,"
+	.string	","
+	.string	","
+	.string	"\001.V0\273\273u\316\301~\321\017`\277f\307\303\313\320\177\311\033,4^P\242\3512\303\260\273\226(1\343\236\267m`{\3016K"
+	.string	"\266\345J\t\261\035\332\032\233@\345\340\322\276\352$\341k\351\002\273\251\025\224\335\212\340\202\354\227kf\333\027\371Hh\267h\365\0207\254\255lw\025|\023\nR\006\362\313/\315\315\207\352$Gg6V\306\330\325$'\207}\2723eK\351\371\372KJY\343]V\273\030c\346<\036\216\363\022:\355\243\005\210:\017\034I`\376h\240\216\004\332 B\235hs\b=p\374Ex\3406\372>p\323\324\275=g\3474+lO\374\304\001\r"
+	.ascii	"7\303\213rC\246m0\342)b\360,`\222\t\30051 \013r\203\t\002N<\251"
+	.ascii	"VL\302$\003"
+	.text
+	.section	.gnu.lto_dyad_getSocket.80.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\355\b"
+	.string	"\226\320=90\217\323\001\260\\Drf\275Vk\031\317,E_J\353\035.\022\321\365\024\251\rQf\341\263\332\245\253\234\2661#\b\365\220\221\325`\326\200G:\360\315V\247\247F\366N),"
+	.string	"-"
+	.string	"-"
+	.string	"\245\005\312\313\356r\234o\262c\327\005\262c\224\343\343\347\350\277\344\r\247\016\226\022e\372\314,\354\256g\211\312\270\351m\033\330V\260\315\n\255\230m\301V@l\213\266\306&\b9\230\323\276\352$\342k\351\001\273)\226\312nEp\201v\314U\263\355\213|D\364\310p\"Q\235U'\243\266\273\t\276\t\005I\3738\346\227\350\200\207\212\234-g4v\302\330\3254\351\206\375ki\312\3664}\375\347u\255.\356\222\262\213\021\356<\236\256\373:\336\366\331"
+	.string	"D\336\027\216$2\1776\220G\002q\020!O\3049\204\0366\006#\276\220\033\201`\310i\352\336\224rHZa{\342\001\r"
+	.ascii	"7\303\213rC\246m0\")n\354\314\340\221\261\30051\037\013\362\202"
+	.ascii	"\t\002N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_select_has.part.0.114.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`i\002\245\023"
+	.string	"\366d}G\3200'\035\013\266\037>\b\264\007\033\302M\375\254\250\244H\334\037i\362\352D\206\311\037\336.%[\027\216\f\320\360\027\n\253w}<\316\204\027\\\341\005\247\240\205\030b\336\210\222\313\030\201\357@\372\rYB\310&R\246\024f"
+	.string	"h"
+	.string	"f"
+	.ascii	"\257\037\335\f\b\267\207\307\204h\225y$\337\304C\330\217n\036"
+	.ascii	"\262\013\304\324\264\033.x\364\001\360\321!h\277\304\213\307"
+	.ascii	"\266O\342F0\033\327\205B\263OFC\246\344\264\273\254G\003\037"
+	.ascii	"\361\036\273\007\360\0365\304a\327\354`~\352\3142\\o{,\242\345"
+	.ascii	"tf\033\236\"\357\276\224\3355\310\341\216\267\215b;\202\2350"
+	.ascii	"\002\034_:\025\323\240\227\376\274\264\347\245\343i\177\367\332"
+	.ascii	"\255W\372\363H\377C\004\254\214v5\344\240\366'\336\210^\273\375"
+	.ascii	"\332\313\267Ye\246\232|\r\246z4\261\255\354\243`\252\351\326"
+	.ascii	"'\334\036\024\232\013#\247\3350\301\243!\200^\2629\261\352\362"
+	.ascii	"\264%\033\033\017^O\332\031\217\311\210\225\346\225\236d\234"
+	.ascii	"S\273 V4\355\256\203\035>U\005\3651\0217\013\317\323O\337\"V"
+	.ascii	"\224\2239\234\027\325\323\307\242r2\347N\243\376\206,\352\366"
+	.ascii	"A_\273\352\007'\237l\373\302U\270\020\210\261\273-\233\302\233"
+	.ascii	"^H\204v\267A\n\f.\177\350\321\277\321\224q\303\311\234o{\352"
+	.ascii	"\346\341\305\346Sj\220\265{\267\ndk\032D\323\037\232\366\320"
+	.ascii	"t\307\227Vi:1g\231\2204-3\352\326\311I\253\325\302@\245d\245"
+	.ascii	"\004\300\314\275R\302\242b\201\205\005\343\242\362\302\222\340"
+	.ascii	"Ra\304\256\230\026\031\026\215\313%\303\312+\220H~(\210\356\330"
+	.ascii	"\006Q\247\340h\216U5\310\266\207v\350\307\210M\346\223R\017u"
+	.ascii	"\252T\301;4\326\210Aq\250Jo;\311\fYT\201\333x\235r\250S\346\343"
+	.ascii	"\343`\020\370C~\215\367\230\322\357\0046 `\002!\226\253\007\342"
+	.ascii	"(A7B\267b\344\214\007\fa\302\231\f\221\373P\300\203\304\341\225"
+	.ascii	"\221bE \02029W\307I\273J\264\266F\22146u\313\332\310\343\021"
+	.ascii	"NL\305+\303x\214BXD\247\017m\366\225\017g!6x\377\272\307\256"
+	.ascii	"\300wxXz\035&\030$\336\001\364k\b\032\343-\030~F\213\343\207"
+	.ascii	"\300\254C_<\334\r\322(q\330d\323\333\2158\220|\364\265\n\017"
+	.text
+	.section	.gnu.lto_vec_expand.part.0.122.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\375\001\315\020"
+	.string	"\006\037kF"
+	.string	"\221(\035\260\025\024.\351U\016\315\021\005\3620\016\320eq>\200\"}\347\351a\212G\267S\315*\320>\002mQ` }\344\376d6\371\377\253\257y\322\017\353\222\312\266\232\356\376\031r:z\033\204\220\275\267L)Q"
+	.string	"Y"
+	.string	"R"
+	.ascii	"\017\375\025g\001^\266:\310nL&\263\033\032\3704\201\356\323\341"
+	.ascii	"C\266\317\356\002\266O\373)l\177/\203v\216\207%\226c\231\201"
+	.ascii	"\301\305fwC\237\221\304\301G\225\240\177\332\001\270`\254G\016"
+	.ascii	"\314\3035\300%\247`w\335}\270\347m'\260\375\300VT\263\333\237"
+	.ascii	"}>\315\035\333\237\207\025\242\300\247?\003\355\316\247'\330"
+	.ascii	"5\315\260\022\356\356\001Q\315\213\030\327h\310\330A\367\251"
+	.ascii	"\366\027.\354%\262\371H=\214\357r\027\340_L#?v\205e\203\314\356"
+	.ascii	"2\350>=\362\273\361\211\372\226\026\256\351\030\371.[\r\b\267"
+	.ascii	"\303KT\373\250\0062\036\307\005\024*zc?F\005\323\370&|\327\266"
+	.ascii	"O\215r\246\001DKo|\3329/2\033\253>\214\177vU\036~\314\275\240"
+	.ascii	"\245<\034e\034a_n\214\331\234\232\333\324\333\303\177J\265<\314"
+	.ascii	"\037\245Z\337\362\277\0032\242b\227\303M\217\0251e\234x\022T"
+	.ascii	"\021JL$\033\005\024\224\t5ST'\222g\342\221:\217DDF#\023\002\017"
+	.ascii	"D\002}x*\257$M\002\225\274\224R\250\344\344\241B\020N$!N\231"
+	.ascii	"\230NB\252T\352$\244\227\033cn0S\323\212*\221\213\257\341\332"
+	.ascii	"\301Q\031\267h\243Rz\027\027=\026\"\313\376\214\ne\265}n\361"
+	.ascii	"1j\f/ \220\202!3\331\006\2458\201n|l\313u\322\306\215\266L\027"
+	.ascii	"\300\305\307Dr\215\221x7\254\007\260,\225\245*\235\306\215\234"
+	.ascii	"\214\327 \261\377d\034k2a'K\330\252\254(\220\303\367\033\247"
+	.ascii	"-\266\262\266\363\217\035\003\326K\b\341\001\254\353Ch\227n\016"
+	.ascii	"\355\370\314\273,\257\347<\026l\311+f\301\333\013\311)\235~\255"
+	.ascii	"\031\003"
+	.text
+	.section	.gnu.lto_dyad_removeAllListeners.part.0.131.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\320\007\345)"
+	.string	"\nI\260\017E\200\336Mc\033\022\032\006K\r\273\247\273\333\303y\201R\261\bW\270x'\004I\340\271\242q05\324e\333TC\031m\204\360\201#\311@\021gh\311k\026\356\f\351\300\336\235%\354O\2360l\267\275\267\224)\005\335"
+	.string	"\341"
+	.string	"\356"
+	.ascii	"\351/\327\275\0132`\305\265{o\356\246'|\312\324\375#\320\276"
+	.ascii	"\371G*\373f`i\274C\031K\304\234\255\217\342?y\030\325\2418\265"
+	.ascii	"\317\275=\334\224\335{#\240"
+	.string	"7\225J\340\235\260H2^.\031K\\\271Zo\364\301\336\204\352NX\274\350\336\037ge\367\032\021\3344\001\364\246\215\307\2357\321\037\2357\355/\261\r\224a*\273\315\215\305\233\004\246#+\212\235{o\323M\013\304\266d2\231|i\274\317Ju\333i\226\266\242T\376\217/}\244Ij\r\253n+mX1\210\b\r\263J\035r\r\313\307^\267\206V\365T`\343f\325\032\326xY2\300\262\243Ch\210U\002!\263\310\334\206W\325~\354\025\306\244!\323\032\332x5:j\223p\357\365\2037n\237\333\336a{\204m\003\013\367^\007cZ8\371_,\316\233\325\002\241i\022\254I\177\354/\"\257\210\271\025O\265^\266\250\256\210\\\263\375a\343l5\222\255>\372\2516\362\251.\262\325DCh\265\220\255\016\262\325@\266\372f\253\177\036\345\367\261\325\250\255\332\206V\237h\265Y\332\252\355\305\356z\343\377"
+	.string	"\225\230\313so\214d\236\333eb)r\261\337\276?\345a\246n\305\277r\263o\271\227\177\271\232\003bzK\003\003\226\006\346\324\321C;;\202vF\347\003\332\205\213\323\353\325e\352\\^v7hIqhIm\226D\343\002\360E\356\254\317\202\305f\034,\240/#CQ\336\033\306\313\36504\271\233\013\252rf}\331\324\311P4 \2521\261s\257\221\202\330\245\370c@+]-\t\311]\354G\277\312\322\220\234\375*T\034\007\262A\266d#D\302\364\233\005\262\266\214\220\370co\266\226\021\032\261\372\236\026N\375/\033o\263\363\346\217\325\361 \333\312\021\254I\333\300\210\271a\356s\374\"\346\252\035\225\003f\344N\234\003\177Zi\217\226\236\357\302\346\327\002\347\317R\347/;\036\r\003\212H\023w|AG4"
+	.ascii	"\273\350\314\221\343;\256J\311\312\337\330,\350\214\226\275\341"
+	.ascii	"kNQ7\276\007x3\347\213\310\244\203m\206vq-\025\325\230$xp)\310"
+	.ascii	"-F\333\201\344Gi\275\354cQ;\"\f\315UE\332\366\3605N\321\253)"
+	.ascii	"\361\301\3772a\013\004irZkm\366\302$I\367\331i"
+	.string	"\332\323^\210\304\252&]Z\323\226cY{\354\335\317\230\020`\306\207d\255\200 :djo\217[\260\206\326z\3316\200\314R\031t\005+\036\333\274\227q:\240h\367N\306\207;\023?(\024Q<\363'\265\373\2350W\234x\352=\231*~N\274]\211\035\017\025\361\363A\365H\234\273\337.D\351\364\037T/E\317\264\016\002\004\235\256\327`\307\304c\"z\332\365\244~'N\363\230B\354T\204h\202r\332=5\201p\"\201sT\211\236T\323/*J\252\351f\273\376\370\273@\246\251\005\255\225\355uE\344\232\2554q\026\350\230\302\250\325\016\331\255\334\207\254TX\232\322^\354JL\037\262\245=\033!\321\252T\322c\310J\b\226\367\336{Z/\327\262\264B\307\224hK\213\263[\236a\"Y\254+_\325s\346Zp\202G\026\311\352x5\350\024\255U>\364\310V=h\266_\366\027\307\324\310\2355"
+	.string	"U\310\032Y\233\365\303`\310P\257\345\037\323\324\204\266\312E\326Z#[\307\204I\210l\221\375\220%\262\267\301\343\030d\205\354ILf\355\311\023\200\245\250qH\206\0342#4\"A$I\223\016\220\002\031\242*z\022 \2261\224\261\300\2444\005\315\316~\006\267\230B\b\033\211\324B_\356=\216\337\374\220\341\006j\234s\361\331i\317v\220\t\251\224L+\357\322z\216\335\026@\271s\201a&\317:\260@)"
+	.ascii	"=`\3304\327\277\025\300\274\004\n\334[\370\206\372\377`\023\222"
+	.ascii	"\344\247\227i\303\330\300\371\323/o*\316\301$\364\265~a\022\364"
+	.ascii	"\002\230U\301\336%\315\230\036\\\3066%\351)Z\267z\233\231a\237"
+	.ascii	"\215BU.[~O((\216\007\034*\326\f\0011\261\337\222$\020@\350s\214"
+	.ascii	"\244\237\240\025\362\036\304e\2710\333\303:\377\252\254\207\257"
+	.ascii	"\250\300\251\303\213\035>ob\355`\216\367\226B\365e\246\250\242"
+	.ascii	"\254\212\246v\241\275*\\\236\2044-Z\f\035\027DQ\3400\231\004"
+	.ascii	"cb\375I\205\304\212(\276\343>\\\212'kd \370\225\307\235\225="
+	.ascii	"\371&\033\024\326\016\004\324\357\240\275\007!\006\037#\324\""
+	.ascii	"C^l\213\376v: >\254\266\335\001J\311\331\035\372L\205\310\222"
+	.ascii	"\212v\335\305\277<\202\251\230\220\0307\375|\313\272wZK\203\242"
+	.ascii	"\300K%\277J0\264\220\022\0211\333\243\002"
+	.text
+	.section	.gnu.lto_dyad_close.part.0.133.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\354\005\035 "
+	.string	"Vv\276H\220\234Qc\300\243/e\303\202\305\312Z\273\001\230\200\031\236q\t\f\002jY\365\033\n\212_\031b\360x\214~Z\016{\334\353\324\210\210\275\0022q\257\n\002B/\201%\222\343\327\374TU\313\032\220\275\360f\273\311\226)\005\241"
+	.string	"\262"
+	.string	"\245"
+	.string	"\006~\352gg\352\025\026O\025\224\375\314QS\263\317\304_r\251\340\247~\005\356\326M\277\236\232\224wX\254\3754\206\364\247\2313\360QC3\365\"\025s\2245k\257\372O\207\n>j\350\006\356]\202\272\272W\225\360\3239\351O\253W\200\376L\217"
+	.string	"\375i\277\3116\260\350\240M\346\352\361\316\236\224\314`\362u\357\275\3754\205<\3703fZ4\350\013\177\022\2159\036\263D#\216\2331\232\226.3n\214\303\230\203%\037i\276\336\3260\026Y{\340(\200\r\367^\247I7\200\333\336\261=d\243\001\002=pZ\367\332\bSs\177\234T\212\234\352IO\035\205C\377f\352Qx\002Ku\372\372\371\253\207\001\003\246\205\027\340\226\273t]\270p\331\331\242\325\323\352\231\310\222\365\223\365#\"\305\002\274\342\2633\365\210T\274F\352\207\324J\025#]\f\276\312\321\350vH\177\006\260\357;\371\225?\3052\003\257\020\003V\225\323\327\275B\257\362\245\334\364\b\223\344\336+\003\322\206\3525^\212\353\312\251\366\363\366\245v\332[\371O\016E\350Q\214|1\245\302ECy\357\315\220\376\244\305\216"
+	.ascii	"u\"\3447\271)\233\b}\352\027\273J\252\305\252rJr\357}*\240\277"
+	.ascii	"Z\026\366\212\257F\032g\243\344[\375\353ek\226\232F\371\213\335"
+	.ascii	"\033D\303\257~\345\022\033f\034\245$\034\034Sns\345\306\326\245"
+	.ascii	"\334\206\310\221\233\346\314y#\321[\235Fd\227\236-u\304L&\333"
+	.ascii	"\266\227\341\rH\342\034\275\206\220\bXk\332<;{\242iCS\350\bK"
+	.ascii	"\243\371\203\001\t\2532M\246\363Pk.\220\0323\264`\266[\274\213"
+	.ascii	"\227Z\363F\f\324\f,\254v\333\305\271\214\024\220\274\367\342"
+	.ascii	"\37412|\374!C\350\317\004I/\"\033\346\257\277\022\330r\353\332"
+	.ascii	"\2455\231l\242\217]s\311>\255\355\325\377\tl\356\331\371z/xh"
+	.ascii	"7\026p\027r:\271\t\024tl$J\234\273\030\277\240\330\356\316\351"
+	.ascii	"\350\344r\273\n:\033\217\255\200\217n\007\024\344C\315c\353\321"
+	.ascii	"\375zn0x:\237\033\013\336\013\005\356\305\330\001\335\202z=\240"
+	.ascii	"\233\314\266\375\006\"\263\350\244\n6\331\243\340\2235\nF58&"
+	.ascii	"\275\220p\260EF\246\356`\211<0H\236\017\2140\260\257\372\372"
+	.ascii	"!%\336\264A\20402\205\236-y\370kD\fH\336{t\342\210\364\310\007"
+	.ascii	"\302O\273\304\327\037{\274\367\342\036\205\230\264\334a\302\207"
+	.ascii	"\332(\276\372\320\334N\361\265\327C\355\235\257\275\333m\025"
+	.ascii	"_\335u3\017"
+	.string	"\200\204\250\201H\247\f\"C3\023\210H\2224\035\240\002\0312\"7\021 ='QM\320\226\2243\006\314A\266J\006\021\305\370\333\266\020AD$\337\003S\223P\301\241W*a\277A;2.\367f\211\247\215\223?\276=S\005\3171\377\2251\222\r\027\022?\031W\341\246\021\246G.\214c\340\204\364z->\362D\231\2512\256\r\317\246\301<\026\205e\b3\247\303\266]\035O0\201\212Q\031\274Bo\220#TV`bo6\177\315m\203=K\n\f\tI\315\037ZIh\021\210,f\340\030\t\337d\225\320 \254n\245\273T\216\013=\340\307U\325\221\234\311\337Bv\266>\345w\265@{J\tO\220\264-x\270\344\037\332-p\234\2678\214&\363\3261\004>B=\2060w{\261\200\242\fI\324\230U9\234\364e\352D\212\255\212j \bw\257,\303\314\3739\247f\372\273\b\304\351\233\253\211\241"
+	.ascii	"\202\006\244/\356~"
+	.text
+	.section	.gnu.lto_stream_initSocket.part.0.147.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`5\003\215\025"
+	.string	"F(\213I\340\356(\035\216+\\szVG\275\r\227\271L\r\211n\326\376\317\231\260\244\002\357!\217\203\367\365g\347y\217\231\366Y\024\263\275\2074thQ\2031\"A\022l\251O\214bV\217\274\212\211\361U\024\247\305\210%\204\354\235Rq"
+	.string	"z"
+	.string	"o"
+	.ascii	">\273\353\341\006\344\305\321\256\335\006\245\243\267"
+	.string	"\032v%\210\222\322\337\3705\357\331n\2032\3564r:#\245\335\236\307E\037 /\272G\332?Q\333\331\366M\234\306f\007\303\236\f\017\245+b\311\221\261\273\254\213\252s\214\027\303\023\030/\326\017\267\275\322\320\346\323\034\357\366z\237\207%f\034\345x\033N7\036\242Bv\327d\313-\336\366\002\3330\273\332\002N\231\366\037_\350)j\315\b\0174\273\233\032\n\312J\030\345H?D{P\366\035y\224\004\204@\006}q;\r\026]Qy\261D\n\242qH\002\036\210f\247.\336\377\325|\340{\356\343\024\317\216\216\317A\253Vz\313\333\325\310\333\216\364\351\212\224v\267\274\350\377lv\352\307\263\363\342\201\215\216\217\310\001y\321\026\354 \305\260\342\262\273\tJ\022e\245\3179\216\203\326\330}\241\t\256 B\237\263\nWo\366\215.8\350\207\360-4^\244\225\242@\342\351\220B\237\f\200\332%\347\370\334k"
+	.string	"\027K3*\365\346\373<\202\223\313R\214\2455\206\305\337\263\263\342\007\372\256\342\377\235R&\037\347O\241L\256a\215\261\037n\205\261+u\370\233\277Vj\212\242>\252"
+	.string	"\203\246]\335S\323\272\210@\"\376\373\201\177\317\253}\037\350D\016\236\275F\314S\246z\315Z\257\230\251\232\235&*\027\t\3554;\\\024F\314S6\222\234\3469;c0\362\005;\231\205\247k\364\007\b\310\307\307KAke\256\006\224\264^\261\231l\264\271r\265N\\,\023\221V\tk\202\b\t\207O\330+\306\232\235g\214\225\262M\037n\205\331\240\253\2075\203\355\260:$\245\252TT\213\316\326\027s8\315\b\240\264\376\347-L\0032\273\270\347^$N\002\202\213\265:< \320\002\231\2321\017\217Q\017b\006\353\310\344X\233`\301I"
+	.ascii	"\372b7\3160\371\3261h\323\300\200D\2145U\3772\232\305\002YI\323"
+	.ascii	"\236\017\341j\206\227\220\006\002A\027\002\f. #\006Sb\3050\343"
+	.ascii	"\tq/\216\201\b\365pe\314I\374%\002\03244\270\337\240+C\207\261"
+	.ascii	"\235p\007c\274\2647\263\316\242\326!\240\300\372\032\215]\207"
+	.ascii	"n\274\335\r6\2628D\262\351\264\033u \345\321\327.<"
+	.text
+	.section	.gnu.lto_dyad_end.part.0.160.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\031\002%\022"
+	.string	"\266\340tI\340\316*\035\210b(\205\r0\216E\006,\246\002Vf\347\247\017\240\0360\234\334\373\327sQ\272\023j\232z\304\261\324\366\032\232\270?\356 \274\34104\302\030\343+2!\216\301\321K\363$\253K\243o\207i\237l\262wJ\001["
+	.string	"`"
+	.string	"^"
+	.ascii	"<\273\344\201W\237F\257&o\022_G\037 \276\332\227\261=\273\231"
+	.ascii	"f\2778\251[\217\335\017\206\032\340\356\216\257\364\303i\257"
+	.ascii	"!\235\"\315Oy\235+\270\226\207\033\270\226\323\260\244\013\302"
+	.ascii	"\350\300\331\302\321\307\002\313{\237\032p*s\n\270(\022\331]"
+	.ascii	"\2178\334\242\333n`\233\201=e\001"
+	.string	"9\033.B1\273{\234\357\205\033\200\334\356\347\267K\242^O?\234\330y\262\221=\016\270#\361\373M\314\2679\r\241\354\333\370&^\023\373\t\224\322\002\355\b\270\223\371\255\355\206z\365\202\321+U\335\357\315l\222\337\243\331$\317\316\223y\220\273\341vZ\201\232\363\244\277\373\f\355<\331\003\354\276\224\b\245\212I#F7\203R\030\243>)\001\032\026\266\031\264\355:\217}\037:\373\365\024\023:\202v7\001\212\n&~\210W_&\276N\372\001b\2466k\370\275?W\362\200v\226\223\302\230\212\017\227\276\330uz\236\374/\232.\n:\354\262\324\030Z\017\265G\204\177s\035\177\307$\317b\247\361\003\254[\025\022\242R\261\020\254R$\251\222k\305\202\235\230\210&I\225\254PJ\306\b\255\225k\034iA0\371%\201\005\033O^/\330H\272H\215\252\\W\372Z\324*\307<\365u\034\264\346W\034\322\024S"
+	.ascii	"\356\374\271\240\f\240\234\177DP\310\305\351q^\2406K\203\224"
+	.ascii	"\276\327l|2\204\006n?x\217}\034A\246\240\030 \001/ `\002)D\332"
+	.ascii	"\r\347\360\"\334\034\2105\030\216PX\225\005\245-\256\203\206"
+	.ascii	"[VB\263\300\375m(Z\337\256\340\304\207B\210\330\221aGw\222g\306"
+	.ascii	"~K\252\354\203\350\207\371\303a'\221\277a^\b9\322_x\340\r\327"
+	.ascii	"\036\214\353\342&\203YZ\300~sq\257.n\005\273\3169\0050'/5+\246"
+	.ascii	"\275\264\033wX\036i\343\t\030\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\036\017\0058"
+	.string	"\312\\\350\024= \250\326\001\200FyY\244\3452\3521\254d\203F\031\352\177\276\364\002@\027H\226 \244\340@\232$N\212\030\022\003\314\001"
+	.ascii	"\020\327\016\301R\251\271\240\003\331\355\270\246\266\260\257"
+	.ascii	"D'\231RC\0017\001@\001Z>\377\223\345s=,\237\023\352\372|\320"
+	.ascii	"\225\317\367\254|\016\250\312\347|\\\237k\251|N7\345\363\272"
+	.ascii	"\255\317\355\264"
+	.string	">\277\243?\367\223\3659\336\374\371\\\365s>]\226e\316\tt\371\363>\375\177\036'\345s\270(\237g\241|\376\366\344s7'\237\2675\371\034\313\344s60K>_\213\031U\273(\371\\-\311\347z\220|\236\347\310\347\267\221\317\323\212|n\023\371\374\312\005\345\024\001\032\3629\232+\344g\b\362\251n\026\310\217\240\200oo\355\307\237\372\370V=~\025\217\002\304\035\037\003\326\277\240\343[\310\361+\340\370\024&D\021\257\376\004w\226\351\334\370\022h\033\277\223\325\370\017\242h\374\316e\306\247ze|\006n\026\257Q\214\017\301\205\361a\372\305\357Z\264\213\337\263Z|n\030\305\342\363Aw\205\001\242\212\003\304\327\360\220M\212/E\361\035\370\303\303\303\303\023\277\201\211\017\355%\376\223\304_\272#\b\020a(bu\226\303\222dY\226E|\004\375\312hl+\304wrA|)\367\303\023\321s\336i\331\303"
+	.ascii	"\242`\207\257\340\225\347Y\236\303\371\347<\253\245W@ch\210\303"
+	.ascii	"_\340r\316\003@\003\315~VG\fwk\372~w\f\325\353\032\177kz\250"
+	.ascii	"\335!\300\371Y\231M\276iw\336\346\305Q\025\336\344\217\324&\337"
+	.ascii	"klS7$s\270f\305\364L3\323+\353\316\363\306\274\251y\333\322w"
+	.ascii	"\255\222\322C\321=C\031\303\261\245\315\223>IS\223\376\245\273"
+	.ascii	"[\226%\307\261I\377n\331\226<\024\r\255\235vw\323\330\n\377\224"
+	.ascii	"\220\276Y\347Az\345\315\365 =\223\266\3672\273\253\227\022\322"
+	.ascii	"\037\357\316\373\342\356\220q5\2447\336|\r\351\213UH\337\351"
+	.ascii	"\356\251H\337\347\356\325\352\264\274\214G\317T\033\275Q\253"
+	.ascii	"d\364\257\266C\303\310y\225n%_\004\353\276\214\217K\356M2\322"
+	.ascii	"\031\370\235Xa\033\216\366\372\276\275\276\276\327\366\353s\364"
+	.ascii	"$9\355\365\305\273{Y\226\253T\242/\316\275waS\370\325\223<\026"
+	.ascii	"}uCm\243\264\263\256\352\3768\363\356\373\266G\323\364\350\254"
+	.ascii	"\272?\306\351\035\314\242/~<\211\354sDc\237\013\212}\3767\346"
+	.ascii	"s@1\237\007\206\371\274\020\230\317\r\205}.\367\345\363=^>\027"
+	.ascii	"\324\345s?\260\317\017}}\336\307\345\363@[>\337z}\236\027\211"
+	.ascii	"\272\004\300\336\210\335\227\201y\212\232\260\0372\367*.`u\002"
+	.ascii	"`\217U"
+	.string	"\353\3619\330;\265M{\251U\332Lv\257z\303\363\346\bs</8YG\330\2776\021\366\357\334\004\373n'a\337\347$\330_Y{\224\215W\035\247\324C\331\\\352\2337U\352\2256R\352\225\363\222\324\037\255\335#zs\243H\312\325\322\223\347p7)\037\251/\326X)\252\224\327 \205\215\362\307\273\352\311\027\255\375I\315^\240\031\363i\317\200>\253\325QaF\275\321FB\275q\356\036\222X\327u\t\352_kw\371\006\321\234\240~\203\034\324\277\264\233\223\177m\247\223wb\367~\206\260M\027\177\372!vo\240\007\260\312|rHe\200\0029\366\351\243w\267\032\333#\343m\317\004\213\252t\314'\257\343b\333r\267\247/\322\275\367i\223\006\216\307=\275r\356\256\234\">2L\247O:\275\361\316:\275\261\356\035\215\241`\034\207sR\235\276\027\336\375\245bg\306\333\232\276\343\231y\323\3675\333\316"
+	.ascii	"\314\257Jmz'\332\216\201P\226\214\262\351qXy\323Gij\323/\353"
+	.ascii	"^\241\320\326!\216m\372\344\334{\227}\206\031\374\275\223@\345"
+	.ascii	"\273uJE\345]\253"
+	.string	"\265sHfn\314\006\353C4\340\366\357\356D\260+{<;\365\235\216\266s?;b~\312\251\357V{\212$\334+\244\234z\002w\357hf\030m\361\274\251\207\316\235\317\261\205%RN}\322\332{ @{M\t\301C\353\016\340\032\366\247y\323M\371%!\307\233\362I\033\017t\312\033\355)_\254\375L\371w\233\235\362\375\236\212\037x#u_:\334\003\024r\323\305\376\207\226\307\036\313\356^\020\241)g\310\330_\331\316\330_\321\235\330e\337q\267\330\377\025b\263\360\272\330GmgL\374r\323\347\334\332\305^\260\212\243B~\027{C\272\263+4\366G\2553\366\307\272\023\315\330\320\270[\354\215~b_\274\263q\354\373\034u\340\273M\306l\340\273u\311\300/\267\035\300\225Gk\274m\201g\262vW\251\300\367H]O\330\367\302Y\n\373>\330\001\355^`\316\321\231\023\366\275O\333\037l\231\371\022"
+	.string	"\373\256\2359\354;\235\232\n\373~\246E\302\276\277\241\273\322\035!\027\307\302\276\247\251y\037\330\3672\266\024\273'\270\265[\236\260\1772w\216h/\200\350\250Q\024\307qiHdDD\222\202&\035\240\002\251\241\251m\003\021` \351\2302DF\002\tH\304$=\261\226\254\346\2566\314\326\334\260\177\030\006\260\347\233\376\336-\254\242\\\277\337$\336@\220_\236!\231\273h\321\024E[\363\326\302\206\276&\336-\315J\376\334F\333\233\367\337&vu\026\313\336\236\204\377\265\375\331\265F\336\335I\224QfJ\350 \260\025\233\347xX\035K}"
+	.string	"#;\310A>c\027\365\300\257\002{\233\r(VX\274"
+	.string	"\0045\301\021STE\234\030\223\242MVG\3424\375\032\030\332\356\007\272\262\261,6f\375q\206e8%\314\373|\357\231\274+P\247|\b\344\337\216\211\310\243yr\232\023\367\r\351\344\017_\332\024\270\247\273\311\376\023\236\017\004*\366\201\327\035\007]\303\205\226\247\315\035\253\231\272\306\315=`\016\021\017\342\253v\207\304W7.%f\201y\224\245\220\205K^\276)l\363\246@K\263\004\374\227\225\276\034g\354\273\337\303\373\363||\037\337\217\363\363{x\177\236\217\357\343\373q~~\017\357\317\223\027\300\347^[\004,2\017\353\342\252\227\016\261"
+	.string	"@\3730\200!1\311\002?`s\024[\311\212\031\3258\260\261\004\fCSX\002Y48\256`\312\320\326\357\304)\017\033\" \3072\241\201\330\004\333\227"
+	.ascii	"s\305e\r\315\274QIl\003oH\367\016\033\272\353\260\361=\220\241"
+	.ascii	"\224A\002\210\312p\312\200\372\212\260W\317a+e\332\350I\017\016"
+	.ascii	"\013Kn\246\320\340\300z\251~\006[\013\251\226\307\370\3520=i"
+	.ascii	"\350\035\242e\031\220\022\322\362z\310\314\3315\333\272\372s"
+	.ascii	"\220\323"
+	.text
+	.section	.gnu.lto_.refs.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\275\005"
+	.string	"\262M'+\200K2\034{\303\302D\262\302\357\026\232\240\tXDFdD)\240s\270\233m\213\235Ms\267v\374m\343\221%\273\021\262\245L\001?\216\362m\364\207\021Q>\b\217\016\215\3623.\370[TP\364\237\350?X>S\316P\216)\217\312[>)\017(\027\b\256\244M\331\005\\\241\331y6\237/\234\226%lJ\026m\246\021v\324m\320=\320_|\210S\234+|\262\227X\357\260v\203\3443\353#\276\300\332\\G\324\021\305!\305\001\236w\024!\315\344\315\306\244}I\177@.\375\037\001\t"
+	.ascii	"(Q \016\004k\t(3 \bAT\274%\"!\b\227\221\002"
+	.text
+	.section	.gnu.lto_.decls.87b8ba8dacdedcb9,"e",@progbits
+	.string	"(\265/\375`\334z\035\362\001j/k\260S \016%\235\306\277Zx\223\013\013\213\210\250\250\b \242\215F\223I\0040g\233\252\2122\253\210\b\242\212\200\b\210U\265U\377.\274\004\203\275\263\231\210{e\344A2\240:\372\314\364\367\325\216\201\264x\343a\"we\037)E\247\361\254v\313\275\267\334R\246\201\t\006\013a\013P=\032K\340\336^l\004A\262\303\031\273\255~1\212~\340\374\264K?\204kd\017p\r{a\265\022@M\n\354E\003\367\336l\030\tn\273O\274\366_=<d\r\013\271\200\027/m\347\034U\202\226\274p\024\0221E\235\177\374u\254v\374L\253\234UM\236i-wttk8c4\b\fZ=\341\374\264\207\376\217\215\334'>r\004\213\3413\036\026J\f\272ft\357]\003\202\004K\270\204r\3761\331\361\331\217\301p\0306{\221\332"
+	.ascii	"\003T6%\bg\354\304e\367y;\\\344\267\315\t\361\017\347cB\335\002"
+	.ascii	"\273\365v+\036\2639&[\025\013c\244\341,3E\353}i\326\273\357\314"
+	.ascii	"\212\211\330\034\177\315\254M&\347N\333{\313\244oK\200\020q\306"
+	.ascii	"Q4\336O\364\217\203`\242+e\353\311\016H\033\314\215#TT\272.\341"
+	.ascii	"Et2$\362cI\214\206\030\023\027\256\322P\242\212\242l\375\017"
+	.ascii	"\363\224\ra\242\225\025\243\003:DH\226\217'E\236`\340|\355d\360"
+	.ascii	"\334\220\370p~\3029\256x\360\300=\360\325}Z\341\035\030\013\033"
+	.ascii	"\375\017\013ca\035\207\306\3748w\322\355\273\nZ\212b\277\302"
+	.ascii	".7\235oM\035\306\001\223eHc\n\347c6\375\373\304UT1nSseS\307T"
+	.ascii	"\007|\331\031\244<d\244\215\341\374A,\365\277u\311\201\244J\210"
+	.ascii	"T\024\213\006%1\n7e\300\",C\2341\024>\323?v\3027\266\232\300"
+	.ascii	"\300\0317\265A\376\376zp>&\242\215\376\227\201\217P\t?\364\204"
+	.ascii	"0Q\006>B%\214\255\005\206\305@\362c%,\0033\341\032x\006\266\201"
+	.ascii	"i\334'^\3721\022n\036\245\341\242K\230\201\217P\toj\201{;\361"
+	.ascii	"\022N\312j[\272h\267\355\34219\267\214\021lJK\321\275\2352AR"
+	.ascii	"\b\371.\344c(\235:/\315Z\342\316\254\3076\364\261\222>.\322\307"
+	.ascii	"0\210\206"
+	.string	"d\300f\350\350\341\f\333{\313\264p\207Ah\340|\314\243\177\034\204\201\244\264\332\370p\3761\020\206A\304H\237\017\3165\035\210j1\341\374\020\376\253\307\247\366\f\213Sr\227\220\005\352\355\035y\212\005\216\225\335\267\022@\315\226n(\355\254\312\241O\257@\277\013\230\22655Z\037\021&P\016W\002\250\251\241mH,\320\020\363`\237\213x\025q\017\376\271\321\233\345\036\336E\274o\341}\336\304k\345\367\312\025\374ar\023/\335}R\002\250\331\326=\204\276\333V\002\250\331\002]}\005\356\355\024K\274X.a\t\240fK4\364\f\334\333\031\350U$\312\2411?\027\366\317U\330\326%K\274R\016\275xi$\364\201\005\356\275A\324\200\2101t\022\"\313\200ppM\3531\364c\360Z\301\316\"4,\234\177\0215\273/\315\372\300@\375\353\247\177\365\364\235r\251\334\347\241\367\357\355\217s\237\355\275e\\\202"
+	.ascii	"\371)\302\371wN\267\260\367\336\367\320\225]\\\\\\\274\207\256"
+	.ascii	"\277p\372\367\251\177\317\364\357\227\376\355\241\177\243\264"
+	.ascii	"\207;\263\376\326\320O\346\362\256\223\213w\237\367\311\223\213"
+	.ascii	"v\357\262\336\366v>I24\026X\003\002\204L\233\237\327\241\316"
+	.ascii	"\377\275k\242s<i(\342|\355\322?\267\255"
+	.string	"C\234\177\217\364\377\373\274u\316]s\217\270`\324\341\374\373\243AX\262D\356B\357\334}\336%K\264\333\020Y\340\013}\347\235Y\037\302o\363v\321n[\f\017\206\275q\360x\333\333\371[\304\310\2411\355\336Tko{\357\377\027\356\272\335$\367y\337\376Kv\235\257q\356\275\266\367\266\371\257\331=\273o\367\310\241iYs\377X\235\215\340\331;\342$\272\367\006\001\242\006\304\004\316\200 \351\374\373\274m\377\005\273a\227-\025*\222\332i{;1\220 \344\306\024\234/\222\273\366\313v\325>b\204\247<Ev\330\336\373\262\211 \265w\317e\223A\334\273G\346^\016\356\345 \177Ui\251\255\371\033\320/&~\323\276A\317\036\341\002\320\337@\177\203~\214\366pi\326L\263\036\353\273/\315z\341\316\254\177\2733\353\361\356\314z\347\245Y\365\235Y\217\336vU\036\252\007\236\302\323p\250'(\031d;\272"
+	.string	"~U\003\242\232_\245aS\001\350.\267\204\023Z\310\202W\375_\b\377Mi<\370\237e\246\203\377\204\030\004\360\2531\177F\362\337\360\252\267]\001\360?\252\202\313\206L\"m\327\231\377\211\354*\203\021U\230l\"\305\253\372\177\261\003y\204\372\242\272\374j\313\257\262\377\325\035<\203\n8\375\317\246\256?f@\342\341\325o7\263\265\312?\265\356\202\217\253\367\020\277\352\366\343\272\377\266\231\353\354\257\232\375\351b\336:!\206\274j\3759+_\360\361_*\377\255\362\347\016\377\325\353\201\253~\214\003\360\277Vx\374x\001\271\203\377b\271\272\212\367\360^\371\357\337;\230bh\247\022\301\272\376U\016t0R1 \372\335[~u\346\206H\363\340\031\016\002\244g\360\253XwO\f\360!\304=\300"
+	.string	"\342\254\n\357U\270\252\232\344!\306\217\313\306V\360\343\023\204\275P\341\351\257\236"
+	.string	"\205\253\366\227_U\361\347\035\177\266\372\361\217\347_E\376\027\003\022\270%\344d\252?\243x\207_5\376\351\223\037o\220\245\256\376j\b~\254\026\365\343\020\276R\247\364/\005\3743\324\217o\344',\203\205\354\364\247\205\377]\3137\376k\201\027\342\233\334\024\305(h"
+	.string	"7M\3106\376[\202^\013\377\355\200\332I\360\2536\236\345o\377\323\334\376\364\355\317Lo[D\341l\330(#]\365\020\370\325\004\374\270\306\237k\374\230"
+	.string	"yI\003F\3134\200R\275\233\257\302U?\302\257\322\370\323\035\177z\365\347\031?\206\221\225\256d\311\357n{o\232e\344\244?\035\362\337$\271\211\3023`\236\020\220~lt\025\3402\3205\360\253\004\270_8E\376\371\261\216\037[\245\375W\224\373\323\271?\367d\236_\360\253&\374)RV\301\333?\307\375w\351\317)\370o\215\377\312\370\257\330\177m\374'\3743\n\376t\371\347\027\377\r\372/\013\376t\005\177n\341\277?\377}\361\337\260\377\ne\026r\374\227\347\277c\377\265\002\372\361\007d\377\375\361\2471\376\354\342\346\353,\300\177\266\235?\267\370/\230\372\004\374i\213\254\363\347\234\037c\220\232\375Y\305\237\246e\023\344\017\310]\005\365\034\374\252\315\377\273\377r\360_\017\376;"
+	.string	"\003\334\017\377=\300\235\t\300\007\3527\374\331\347\277\341\177\270\377\376\277\333\177\271\377\342\377\320?\365\360\247\034\3749\371\337\311\377\303\377x?\256"
+	.string	"&\341b\220\341\277\030\376\253\341\2773\267\346\277\027\244\003\310)\376+\376\377;\233\n\031\305\177;\\\365\"\376\034\364\277\360(z\357\377\304\377f\344\237q\362\007\214:\034\304\257r\360B\b\344\022d\343\237I\360\337\r\027\374\251\b_\373/\006\317\377\236\375\027\311\177\321\376\324\351\277k\031\004\017\301\177\024\362\007\376\333\341\252\235"
+	.ascii	"\177\226\373/\221\314\201\377\205\377\243\377\315wU\357\362g"
+	.ascii	"\032\177V\341O\027\220S\370\263\006"
+	.ascii	"~\234!\243\360\337\024~\354!\237\360\247\027\310\031\3703\006"
+	.ascii	"~\254!\223\360\247\037\370\363\004\376\224\004\177\226@\216\300"
+	.ascii	"\177U\370\263\211\377\266\327\340\317X\267\004\234\037p\020\374"
+	.ascii	"\357\027\376\374\264\300\377\277[\302c\376\\\365\247\"d\007\374"
+	.ascii	"8\004\271\001\377\275\300\177M\370/\006\236\223\025pQ8\206?\213"
+	.ascii	"\375X\005\255\234\200?5A.\361g\022\377A\220\363c\021\374\207"
+	.ascii	"\3713\221?\207\360g\020\177\376\360g\f\376\214\341\317\354\237"
+	.ascii	"\377\247\206\177\n\370\247z\177\232\367\247s\177\372\366\247"
+	.ascii	"\317?5\373S\257?\325\372\323\253?}\372\323\346\237\306\370\323"
+	.ascii	"\240?e\301\237.\377T\305\237\032\377\364\003\177\212\201?\255"
+	.ascii	"\300\237.\340OG\370S\002\374)\007\177\312\341Oi\376t\346O1\374"
+	.ascii	"\251\314\237\272\374i\373\247\354\237\342\037'\376\370\357\307"
+	.ascii	"Q~\374\344\307v?\346\361c\243\037\017\375\030\372\343\270\037"
+	.ascii	"\257\375X\355\307i?6\362\343\262\037\217\3758\354\307^?\016\362"
+	.ascii	"\343\037?\326\372\261\217\037c\375\030\307\217\255~\354\364c"
+	.ascii	"\246\037\313\370q\363\307G?&\3721\320\217_\374\370\004?V\376"
+	.ascii	"X\305\217\223\377\375\3721\316\217I\360c\021\374\330\003?\346"
+	.ascii	"\300\2175\360c\013\374\270\002?&\341\307\022\370\261\211\377"
+	.ascii	"\016\376w\312\377\016\376[\302\177O\370o\207\377\036\340\277"
+	.ascii	"\371\307\f\370\257\374o\342\217\027\360\343\022\377\035\300\217"
+	.ascii	"C\3701\b?\016\361\343\003\374\330\203\037\203\3701\001~\354\341"
+	.ascii	"?\n?\336\340\307\027~\214\301\217k\376\253\367_\255\037o\370"
+	.ascii	"q\206\037c\3701\314\217_\376\017\376\317\371\257\302\377\277"
+	.ascii	"\037\263?\316\377U\374o\373\337\303\377\022\376W\360\277X\376"
+	.ascii	"\313"
+	.string	"\344\277s\377M\362\237\355\277k\377-\373\177\302\177\235\377\355\300\1779\360_\r\374\027\205\377\212\360\337\020\376;\342\2776\377\005\341\277\"\376\373\301\377\024\376\253\3767\304\1771\370\357\372\177\352\177\335\377\021\026\027\027\027\377\r\372\207I\362w\340J\207)\323\037z|\370\310j\t\030\013Z\362\352j2\b\003\347\303\f\271R\261\256\322\257\001\260\361P\261x\244_Mb\266\256\234J8\037&K\037\006J\205Rs\250P\252\225\216\253V\036D\2519\242T\034w7\2534\251\272\212\003\252\201\242\362\376pV\251.!\036a\324\035\316\352\324\241\372\360I\246\207\263*u([wW\025\005S\244\377\"\250?\314\251Mj\223\352\304c\005\204.'\352\215\253NP\030A5\304\030/u\372\003\033\352\fu\206\312\364\347\027\264\344\245\326\270\312\304\203\nQ\024gu\351\022\252_i\202V8\25340\321^\221&k/m\332"
+	.ascii	"u2d\244_6G/@t\b;\023\315\253\315\254\2467\326\335K\224Z\244\036"
+	.ascii	"\251E\351\327:\200=\023F\352\221Q\372uwso&\006\210}mm&\246\017"
+	.ascii	"2\204\211gu8\377e\206\376K\217*\244\022\251B\271o%@\220:\244"
+	.ascii	"\022\251C\271O\327\21091}h\341\201\005C\320O\337\005\311\241"
+	.ascii	"\332s\250\002\2550\256\002\331\024\n.\341\254\376` N\366\022"
+	.ascii	"\237pV}F\250!\252=\210*\217\256\232S\367U\036@\230\305\036s\210"
+	.ascii	"8\347E\f\244\345H\026\0372p\316\212V>5\236\340\234\023\257d\215"
+	.ascii	"\306\3618\2718\365]\262\364\005s\241`\216\026`\357\353\224Bj"
+	.ascii	"n\246\346\007\020\244\260\344B,9Z\002OP\225\240\245\350fjfy\216"
+	.ascii	"BO4\021\331\201s&\034t\251\322wI\322\032\230\230\310Un\266b\345"
+	.ascii	"p5\027v\214\253\273\255E}\270\213\177\366\356\021\200\312c\004"
+	.ascii	"G\021\2345\354\231\310Tn\006\004<\\\215s\373`\373\234\004-E["
+	.ascii	"\254h,\200\030\037`P=p\026A4eJV\233\362\325\362D{\240\310\307"
+	.ascii	"\227\373\252|\005-yIy\356\003\304PRG\270p\316Q.a\213\022!\330"
+	.ascii	"\023#\032\204<<\274\254\027Em\013\312\263\336E<\332J\202s\316"
+	.ascii	"S\373\004a\340\341\234\237\034J$\361\206\022\300\377-\253\304"
+	.ascii	"m\211 \316o\371\3226\\\371.\337e8+\246\240\245hK\226\016\341"
+	.ascii	"\006\023&\331\316,\253\356\331\356\257ULDj\3039\323\375o\210"
+	.ascii	"\207(F\313\224\326\020\304\304\263\234\\\236Z\233\355Q_]\340"
+	.ascii	"n:=x\213\222\026q\030\027\227\241w\013\365\371\005-ym\246\255"
+	.ascii	"\017\177V\362\f}\"\3257\207\363a\302\264\242\334\341\374\026"
+	.ascii	"#m3c\355k\031\356\356\2757\323N\243\364\bZ\362\312o\317p9\221"
+	.ascii	"\314\307\017\347\017f7\242\245\250\021\267\266\034bRB\330\255"
+	.ascii	"\235\361D\2570\263\265\360h\021Y\317gV\303j\312jj\036\220,5\234"
+	.ascii	"\337R\321\032\214L<\243=3\332\241\267\251\321\206\230\004\356"
+	.ascii	"\346\366\340m\235\326\300c\342\331\210\021\fT\343\3342\\\256"
+	.ascii	"\346\336<x\333\246C\\e\263lva\373\374\031m\265d\372\203*y,\217"
+	.ascii	"\3452\037i\331\371\\\226\202\037'\022\2343Y\312e\264\250\244"
+	.ascii	"\315\322\177\026\373\235\"W\220\251\257\347\260?#e0\225\307\214"
+	.ascii	"\266,8_\257K\263\346!6\317_0;z\bq\0232${\271\2249A$\202\363\335"
+	.ascii	"\2724\253\206 6\317Bd\236\262x\230p\246\351z\006\3422\224\027"
+	.ascii	"\235\201s\376a\363\334\305\362\230\022\303\302\031\203;\263j"
+	.ascii	"(3\361\274\365\373\314[\370-C\323\002O\273\3006J\3779k/\203\342"
+	.ascii	"R3k\257\205\361$\205\260\271\2040\217H\017\254\030)M@\260\354"
+	.ascii	"\310W\231G\f]\016\271#\234\257\324\245Y/\260\262y\336\201\244"
+	.ascii	".Q\013\347\231;\263f\035\177\306\221s\254n`aJ8\343\346\245Y\003"
+	.ascii	"pg\326Le\363\\\245\372\371\tB\301\231\203;\263f\251\264\304$"
+	.ascii	"\0348\277-\322\277\317\034\225\241\264\320\242\234<=C\035\022"
+	.ascii	"\252\005\301\371\203\207\376o3\r8\260&Mx,\337\250c\002\345\020"
+	.ascii	"\347G/\315\232b\331<7-.\306]e\033\351\326\306\323\221\207\263"
+	.ascii	"\206+\023\3173\236yF\256Q\202s\363\260WtAK\321\335lz\220kH\021"
+	.ascii	"BT\202s\246a\363\2744\345\003)\t\316\327Q\235\225"
+	.string	".[\0335\343F\236\214\234\004X\225\004\021\347\234\304\256\341UI\3029#\331<7\265\224\220!U8o82b\201E\314\217\350\331\350\3171r\321_\323\030\017\234o\340\245Y7\2703k\036\262y&\212!\302\363\224\205\263\006Y(H\035\214\022\212\001\335g\016\372]K\233\322\022\026\31666\317@d\207er\031F\376\tB#\251\211\363\237yrO\366a\203.\036\341\354a_\2325\357;\263\346m\363\314\343Bd\247E\005\347tq1U\034R\206\003\b\247\212?\206\222&\346\034P~Q8\327\\\232\365O\021\017\333\265\304\273\275\302\247\207\377\215K\r_\256\350\272\340p\316\373\322\254i\324\346i!\332\f\246'8? \013\341]\214\2231F\330\365\301\t\230d0\305\262\362Q\361$b\341\373\352\001\205\363C\350\253R\204\317P\317\311mcw\336\276M=\256D(\351^\t\031\373\na\341:\234"
+	.ascii	"Wt+\245\222F\261\343*\f$\303K\3632\360\021*\201\013qkJj%\375"
+	.ascii	"K\003\323+)`Z%\025\274\317\224Jj\367\313$\365\243\222\326\245"
+	.ascii	"w\251\223ko\034=\326\250>\253\031\321\275\2351SMSJ\031r\252\231"
+	.ascii	"\350k7}m\246\257\207\350a\034F}\333\207\276\246\312{\222\202"
+	.ascii	"\215\025"
+	.ascii	"6=I\177\260}{Q\320p\276n\322\327F\372O\357\322&w\206\223\f\242"
+	.ascii	"\264Ij\3672d\r\256\b\316\327?\372,\242\376S:\274\226\242\355"
+	.ascii	"\031\341a2\327\362\003\017\t\026\350\222TN\246\251W\245\007\316"
+	.ascii	"\027\366\245Y\261\022\233\247P\"\".,8\337\2704\t\2141% 8\247"
+	.ascii	"I\376\364-\205\273l%P3\022\002\204s\336\316}g\326\264\315\346"
+	.ascii	"\251\333g^\306\242\3340\302\371\001\213)\333\225%\036U8?\204"
+	.ascii	"#iZ\006>B%xA\251\245k\367\231\"I\237)\222\324,5\322R\025U\224"
+	.ascii	"\021\005\321\3065a\302\265\346\263D\320~t\025C\b\347\263[\372"
+	.ascii	"\354\225N\317>\346F\303\020\347\2637\364Y%\375\247En'\027\244"
+	.ascii	"\214\007\347?-\013\343\221v\305\250{\367\200\275\245a\251S\272"
+	.ascii	"\243\004P3\004U\206\002\303R\242\264)\246\335[\307\330[\032\206"
+	.ascii	"\351\322\241\264\254\031\202*Db\351XJ\226:S\2604\f\004\b\016"
+	.ascii	"\252z\200,\023\251\220t\310S\257\247^\351\227\336{\36387\022"
+	.ascii	"\253%\024\264\024\335L\315\017\177J\344\351\027\316\243bk#\374"
+	.ascii	"\337\222 \311\342\025\234\317n\375\377\036\377\353\356i\356\275"
+	.ascii	"e\250\316\335\364yY\377\373\253\336\373\341\207\271i\336[\003"
+	.ascii	"\026\234\233\007\020q\357}\261\350.\267\236\0338\377\367\260"
+	.ascii	"U\274\246\320\031\025\017\004\250\222~\250j\b\235Q%a\020:\243"
+	.ascii	"\332<?Y<\030\232\233\212G\350lo\f??<\023\220J\022:\353\331\030"
+	.ascii	"\204\316v\322\206\221\227t\267\223\212g\377Hm\f\373g\367\354"
+	.ascii	"3\251$\017B?TIBg=I\030\204\316\250\222\366\031\325\276\260\177"
+	.ascii	"z\232C?\273\211a\237QY\331gRI\027\204\316\244\222\204\316\250"
+	.ascii	"\236.\231P\226\255\244?\304\252\272\313%\364\263\217\214\234"
+	.ascii	"z\232\027\360\204\234R[\312\3367\rh77\336\336\001\330\333I\252"
+	.ascii	")\245\247\306}\363\301;\362Y\353\221\272\316\2757\007#\237*\251"
+	.ascii	"\375\203\307s7\236\020\020\251\275\201\370\244\330F{\357-\002"
+	.ascii	"\217\023o_]<\036\034N\273\bh\357\016\333\271\267\321\336<w\343"
+	.ascii	"\355\275y\366\336l\323\311\271w\323\005\241-#\243\275\231j\214"
+	.ascii	"\266\023\017\034\320\3368\315\357-I\350\254J\312\006\356\310"
+	.ascii	"\331\326\016r\362\\\241\"\251\275\265\245P5\365\031O\331.\332"
+	.ascii	"{_A\275\225\244t\005\347\256\224+Ga\340\336\316\264+\365\221"
+	.ascii	"n\305\360\\\330;\207\341\026\2204\310}\246]\351\017\354\334\373"
+	.ascii	"\207%\332\022\252[\363\327$\372k\232N\267\376\024+\355\201\213"
+	.ascii	"n0U\3019\315\262y\252\205\265\322\352\352p\206q\352\007^\232"
+	.ascii	"5\346\316\254_\305\3641\225\337&\335\221J\245U\251s\213\002h"
+	.ascii	"H\251Uz\225\352\270\317tG\232\343J\272#}z]\214(L;R\034i\317\t"
+	.ascii	"\244\\ys\311\322\203\312\025\235\257.\352\253\203\372O\251\236"
+	.ascii	"V\375)T\032u\331J\240AO\035\024\347t\312\346)\325g\242\376\230"
+	.ascii	"x\340\374A)\232\335\2724\353\t\357\314z\265\211\276\312D?\004"
+	.ascii	"\032VUR\033)SZ#\275q\237iS\272\224\323\2464FZ\224:\267Z\242("
+	.ascii	"\210\201M\251Q\252\224\22655\222\240\302\300\246t\006^\214\351"
+	.string	"q\356f\013\204\322,\263\276\037-\371*\233\276ZD_%\"\343>S\2454\351,UJ\217\322\346\025S\236\242W\313\r;\253\240\234\257r\245H0sM\340\342p\276j\245\257J\351\2535\322\"\rJ\2607\264sS\304\260\340|\365H_%\322\377\323\237\024F\032\224\n\245@\367\231\016\245>\307s\230\3113\246\202\023\361b\352|\323A}Hg\277\r\"S:\224\356\264'u\276i\242\253\243t\b\343a\303\264\254\331\"\271\262\021\230\016\341:\354\244)pog\r\b$e\2132^\362sb\312\303\022\325\355\365\300\371\331\212~\336\323\212)\036\223\037/\234\237\353\3643\234~63\304Op\226\264\254\331\036\261R\013<\274Ol\210\013'\020\310C*\347\347/\235\207\367\242<\267p\024\023\342\301\373\304Y\262s\3575>\f\230:\337\332#Q\322\002\263\340*\030\313\305c\332=\\\037\262D\363\0249\200"
+	.ascii	"\221\026-\375\030i,\202%\330{M\306\232Y\020\234q \266r\237\032"
+	.ascii	"\340+N\031\030E\"\212\2078?\327\320\277\032\254w\361j\260>\027"
+	.ascii	"I9\006\374\2731\\M\236\226\340\214\373\260\337}v\200\247\034"
+	.ascii	"\023\301T\256\3668\267so\247\f\306J|\232\341|\341\322\254\317"
+	.ascii	">\372\267\2035]\\\274\035\2548\212\315\261\224\r\330\240p8\263"
+	.ascii	"Y\364\217\365\216\367\260\023,\265a\035\002\355\372\2013\206"
+	.ascii	"bs\254\367\031\006`\341\370\3029\2753\353\323)\372)\024\375\224"
+	.ascii	"\211\306v\270\311}~\300wN\231\226O\360)\r\347\247o\372\367\303"
+	.ascii	"*\363a}ZD?\025\323"
+	.string	"\027\357\322\254\031\334\231\365\307r\037`\n\371|\274\226@\277\350\250\214p\376}b\250\2223\2507>\234\261\022\255\330\027EH\364\277\225\031r\030\203/\3113\007\327\316\f\267_\206\310e\201i\2625\b\036\331\342\025\036\263\333k\013\233\303Y\203\245-X\\\\\\D\334\273G\203a-\246\303\256\301.\303J\361\022\352Y\363\257\2772\024\n\f9(\"\353\0241\031\212n8\353!X\013\321^\327Ct\220\217\030\341/?zH\336\273\347^\016b\356\345@\205\372\3501[\3635\364i\rVz\364\320]IM]Kb\352\n\257\004\371q\335\205\207hh\305%e\204x\307\245\267\340p\304\320\303YK\316\371\224\210\3635\350i\235\245}\364\300\243\363\302\371\032\352\3645@\365\006!\036?\217\007\370\2211y\305\200\022r\205\3635\260\351\232#\372I?\351\035\267\310FZ\241O\253\031^\\lQ#V\327;b"
+	.ascii	"\243\240\bq\326:t\216$\202V\004q\3268t\016\262'\024\347\026)"
+	.ascii	"MAYp\326R\272\312\206V\026B%M\324\314\250\364T\013\324T\317\236"
+	.ascii	"\314ba\021\"8\177PG\345\3119\241j\252d\207`T4Tz\027\366\303\344"
+	.ascii	"\244L\327\334P\272\246\241\244o\334\"\033\351\322\240c\241~,"
+	.ascii	"\351\246\353\033\355\331\021\025\022\316"
+	.string	"\332\206J\345G\024\013\316\232i\003fL\360p\3265\016m\231T\311\b\304Y/\275\212\022\300'\2053\204\350\r\207z\350:\206\036\322I\r \272 \207\345\243y\235\364\227\r92\302Y#\035\032\203\264\027\350\204\263.\322GtH\310\222\034i\243\254\326\304\341\343<\344\3639\242\211\270\364\006'\272\347\372G\367\350 \233\033DdL\315\273\266'\234\177\rt\035\364\207m=\367p\3260\264\017\017\275\201\r\361\254\"\242\336O\345\256\254fDe\004\225b\b\262\213\327[\360\271\344\343\316\307\223\2519\234\331\304'\255\301b\340\003Y\303\032\251\024J\033]\023\006ko\254\250\360\254a\016-$\2018\263\321C\367\240\200\\8\263Y\330A\2712&s8\263\204\354\340K\017$V>pf\255\260\203,\326\242\037 \026\3015\306^\332\024,g\005\013\315\310\3420\332\267\332\016\375pf\257\330\230q\004)mIk"
+	.ascii	"\345;+\205\217\005\274E6R\013\f\311\230\274`\274\026\227\220"
+	.ascii	"\375\235\005\374\261z\222\310pf\251\034\232\362\335\230b\205"
+	.ascii	"3;\345\320\353!\221\303\231\365;4\220\307i\017g\266\217\245\241"
+	.ascii	"\327\205\243F\024\r1t\007\030\254\036\253\307\006="
+	.ascii	"\361 c\212\222m\361p\341|\r?\232C\016\272\263vM\330\274\032)"
+	.ascii	"\236+\f\030BW\345\013,\013\006\330\223\263yN\356\025\032\332"
+	.ascii	"\034\316,\236\215!KvN\376\316x\234pf\357\352\350t\340\341|\232"
+	.ascii	";}\0329\315\326\321\244\351\r>\222\234U\222\204\235#\342G\306"
+	.ascii	"\024\305B{\262$wv\016\210\n\226<\234\331%,4\256Ls8C\202\204}"
+	.ascii	"\213\343\341\202\310\367\227\345v\366-\272\024\326\2043\333\206"
+	.ascii	"\251\374\b\271\2023\313\366*\267iG\320\037\316\354Z\230\356\300"
+	.ascii	"f\344,\232\021\366Y#\305c%\001L\276~4\243g\206BY\322\316>o\033"
+	.ascii	"\034\033\334\030{\244Kw\330\372:\013\366\305\232e\244\353\334"
+	.ascii	"L]K^\276\256`\031\024;kv\266\b\241\236\242\024\234\331\262\265"
+	.ascii	"L\355\341\204\b\003\347\263N\2304\244\266\0308\263d\253\230\313"
+	.ascii	"\322\231\236\"\316\354\330J\326Stu\206\363C$\356XS\302\231\r"
+	.ascii	"\273m^1\324\004i\2604\006\206\\?\027\353U#\305s\305\003\264\211"
+	.ascii	"\214\311gH\b\023\033"
+	.string	"\344\254\027;\004\013t\321\007gV\310\303l\3547\234OS\245Y \207\016^Q\265\341\314v\375/5j\242k\303\231\375\261\372(\n\233\343\241\201\322\030\364a\235\315\302b\265n\221\215\304^\321\371mE\267\220\323\207\027\276\257'\027\253\245D\207\220[\023\234Y\037\030.\332t\004g\266G\026\215\301\223\215:;\305F\261W\251\036\213\304\360G3\332\006\t!\272\303q\366\352\354\216\021#\374O\251\343\310\021\234Y\253\337+\301#:Z.*k\2128\2639\330\252\377\031%\t\362\2043K\365*0ke;\234X\251*\232\303\226qv\206\f\366\311\346\213\257)&\tK\221\247\351\354\323Y\247*\315#N8\237\275\301.\2616\222\004\231\232c\365z\030~\261Ll\r\257\2510\"8\327H\237\227\201\"\321\252\303\371\203,\r=\276\252\237\377\035\260\213J\2221\234Y%/\315\241\317\3507b\233\267\310F\342"
+	.ascii	"\035\224\031^{3}X"
+	.string	"\221\320Q\231!\235m\026\261\t\366\341\314\036\035Jc\360\f\006\316?\224\312\350\350\311Icp5t6\306\020\033t\213l$\r\360 cZ\027\225\220-\301\231%\272\240\2511\030b\367\331\036v\263A5R<V@\020S#c\002\204\316Hd\201\316\006eA,B\236pfa\034:hV\006\003g\326\207\3751B\205\305\007\3162g;\362\242d\255\0273)\321C\234Y\2369\335Ao\360k\226\301U\261F\212\347\n\b\\D`\210Q\030DbG\211_\025\235>\234@\341\274\"\036\352SX\344\f\347\325p=\354\301\242\302W\345\2012Q Q?\234\327\350Z\350L\302A\2051^X\326\016\234?\230\356\375oc\214\222x\004\301y%\234\001\362\367\325\312\337*\230\2258}\220yR\004\261y\345\253\340?b\204\016|h!Fq\376`\007gYM\332p^\003\331({uEp^\253\2507\224\246"
+	.ascii	"\001\264\273\273\202\363g\262\364g\234t\006\201O\276By\262N\241"
+	.ascii	"9\203Z\237\324\230>\\\247\265%\203{_\247|\365\0331\302\377\254"
+	.ascii	"\246\314\341\274FY\245\254}\177\273\366Y9\233\201\363g\2224\337"
+	.ascii	"\337\256^I\206\200\340\374\f\212z\325\373_\230O\024S\036a\335"
+	.ascii	"\327&u\253\023u,]:rGw\367\325\211\337\025\036\037\234\357\242"
+	.ascii	"5\206\303\t\316\253\035\024\235\201\232\t\267\257on+\223\274"
+	.ascii	"\364\262y.8}\246\374mm!\246\0172md]R\342\2762\371:\267\256M\311"
+	.ascii	"\022\304y\225[\313*\340\304\226\270\244\005Ppk\r\347\025\272"
+	.ascii	"\212\265(q\252\375\300yU\262\222\001\245\005\272\341\374\003"
+	.ascii	"\270\2209y\332\302yMr\333l\320\200\302y\205\243[\237_\221<W6"
+	.ascii	"Ulo\037\020\234>RXB,V{k_\331\\\204\204\034\031\262\252=u\006"
+	.ascii	"?\304~\261\025-\007]\347fR\353\3021\324\250\320\030\373\212\366"
+	.ascii	"\365\310\210\021\016mi\262\243I\005\347\365l5\242\341\242|\265"
+	.ascii	"\341\374\265\310j\366\267W\254\t\t\f\234\237\241\207^\313V1\034"
+	.ascii	"\207sS8\257\316\017\236\f\247\020q\376J\266#\317G\020\234\361"
+	.ascii	"=t\315\220Cg\0205\344+\330"
+	.string	"\220\f5\243\244f\373\374l\250\247\225\214\016\313.\272\205\274>\260xDsNp^\211|\375\372\333\027\300\265\036Z8?\203\223^\275Z\031AZo8?E\252\202\361\206\3633\324\320\032\024Y}\275\262Z\203\244|\254\033\335\217f\324\245,F\331\223\255\257A\276\002\0311\302\377\274\204\360\365\340\274v=\206\251I\222@\234\277r\255?\376\266\245+\307\331\020\234\217!\252\377A\221\245\244$\234W\255\377a \177EVp^\263^\230\242D\255p\376\340\352\343\256\n\212\017\316+\217\025\353>_\267\366\270S&&I\320\263\016\347c\260\242\177_\267\266\340\276n]w\370i\r\306\252\376\2525G\215\024\217\025\033\"~YK\242{3}P\t\371\350\366p|\315\001\225\271\221#\351\007\003\233\326\240\207\211\377\353\215\257Q7\326)\225\347e\363\024\331Hk\024\021\226\235\327\026b\372\200\337\214\004v\255R_\247"
+	.string	"\007\275\340\016\327\247\257P\177\333&\201\312A\205\3631d\351\177u\372[V\215\357\306\026\316\307p\245\217\001\207\336\340\252F\215\325\006\224\bS\0311b\307\364\325\306\005\314?=\236[\030h\350\r\216\320\240\221\270\005c\346U\310dQo"
+	.string	"EIIuj\243[Dq\203k8\377\302\237\006\300^\223\326$\325)C\334\024*\265\301-<\r\200'#\243\025\tK\305\335\005\206\0211\342c=\372\212\244\372\314\351\200\272\360\246\001\360\265\306Xc\250N%\\\020\307$h\n\325\017\316\277PD\003@n\035Z\207r_\034\222\0226\n\225~h"
+	.string	"\034\256?\353\317\032\244\367\036\323`Sd7\200\276\006\001\302\344\3550\222\004\347\025\306%\364\262*\304\273@\245=D-.\256=z;S\310\nZ\362\212y\343!Ci\345\371\332\003\030\263\203\2106\316\353\026\301d\244\343\302\222\366\360V\245\212\232\b\347\265u\003j\305\224\345j\342U\304\021#\0340\253+j\n\347\253\206\352\341\337jA.9)\234\177\001I\253Q\2650\016\b\252\205\363\361\205\241\016^\246\330\230\223\201\363\277u\330#\013g\225\320\016\255J\035\316\352 &\372\201\342\033\303\371\203*\026#pu\204XT\301\227'0\024\217\256\n\252\201\352\025\227@\244\305$+\177\353\362\206#\260\013\347\313D\365e\374\364e\232h\016\360\372\372\324\277\032\270\250\240\245(\036Z\274\262\242r\365\017\220\235\013t\362\206\263:\345e\252\260\211\210\263\352\367*.\203\212R\321$:"
+	.string	"MP\240\250Q\374R7\300C*|W\243@uQ\331\222=\234\325==#Z"
+	.string	"Kww\352\223\0074\tZ\362\272<\300\226\246\360\256>\201\302\334\215\361\030\302YuBD\013\200LNN\265S\"V%\260\215\302\005D\256\356\252\235\237V\215.\234U\272\026la\235\341\2542\301D/;\206\272\346d\2604\001\206@\241j\334\342\226\"\024h\261\206.@[\233\032\267"
+	.string	"*AK^Q\240\274,5\311\325\270\003\312\r\315P\302Y\205\273\204MEA3\234\325\267\373\303\013\211\013g\325\r\347\260C2*\362'\307\243\352\016\347\313"
+	.ascii	"\351\017Ck_\313jz"
+	.string	"\007a{\261\202\245+\b\316\2171\324\006PRSK\277D\350\202\212\241\323\005\200C;\232\232\346aG\301\332n\230\017SX\332%\214B\363\211\303\3711Ht\001"
+	.string	"\315\314T#W@"
+	.string	"\003\013Z\212\262woS\342\316\256\032\311S*\324\221!nSOLR\202p~\314\230\326\300fB%\273j\231Z\326$h)\032\203\325A\215\261\217\251awo\260\254\3143\230\205\b\347\307\320\320\035h}\375K\r\303{\357\275\305\316\201]\251=\334h"
+	.string	"Q\301\256\206\301\f\306\345\255\301\r)\252c\303\3711[w\2006d\210\352U\302\005`NAK\321\230\3059\277%/h\016\342'\306EEw\020\007D\025\002D\r\342\341\007\217\310b\340fb\372"
+	.ascii	"\023h\250\244$\310\341^\376\254\320\330\201\363a\234\350\016"
+	.ascii	"\252\230\340:\227\372\303\303\336\033h\267\200\205\210a\340f"
+	.ascii	"r\372\0203\365\204/\t\316\352\017L\004-j\213\272\351\016\016"
+	.ascii	"\265\264\354\\\336\324rp\341\034O\021\202\204\013\230@\001\004"
+	.ascii	"\214\320\353\016\223\305\013\316\021\271\023\263\303d\201\243"
+	.ascii	"D\032_p\224H\343\211\026+ \227\307\025`\220\313\343\nF\026-T"
+	.ascii	"\334\034W0\236`\202Q\006G\2114\"]\034\227\306\023L0\276,w\220"
+	.ascii	"*v\216+\214Z\231<\246\2701\256:JdN\362\204\221\035\3012\215,"
+	.ascii	"N\216\216\321E\271\242E\216\316\215q\247\305\215\321\005\231"
+	.ascii	"\263\302\221\351\302\030s\242\305\n\314\035\235\024Kc\3134\236"
+	.ascii	"`\202\261E\305\215N\216Qe\032E q\342\204\216\321\3302\221\313"
+	.ascii	"\023't\214\354\t&\030]\230.n\2208:7F}\202\tF\030$N\222\005c\013"
+	.ascii	"s\231\314\2019\321b\005\343\022\271\3632\002\316\221\205\321"
+	.ascii	"\270\"qtV\030UfR\231D\342\030a\2207\311\034\026\313\035\035\n"
+	.ascii	",;<E\b\026G\026B\030\215-$l\214\306\026$r\347\004\222yD\356\334"
+	.ascii	"\270\2609::\0210\252$\\\300\004\nd\022.`\002\005\214'\230`\324"
+	.ascii	"7L$\212\023*\313D\242pY\266\340(\223+\344\025\211\3349\361\262"
+	.ascii	"2Y\350\2640Y<E\b\246q\007Eri4\306\2549G%\212\344\322h\004\021"
+	.ascii	"\303D\342(\221\313\274\303\\\352%\353\342\006\271\223\237\"\204"
+	.ascii	"R'\311"
+	.string	"<\336\350\344\030u\224;;H\243\361\002\322\205\316\212\025\310\025\354S\204@\256H2E,_,\r\360\342\210s\202\211D\361\362\024!r\230\312\233\023*r\305Q\271\203D\262`\"Q\270 W\034\225*nt\226L$\n\227\247\b\301D*\223\"\216,v\216\034X\3500\225F&R\231l\231K\245\316\215J\302\206\305\221\205\345\n\030\220(H.\215-\314\234\026K\344\216\021\007\271l\241laT\356\034Y\310\3002w\216\314e\206\245\013\215\243D\032\217.\214\312$3'\331b\005\243\361\302S\204\320I\3420\227\314\343\212\035\235\023\353\t\2462\271\303bU\356\264`\"wt\224\232\231l\001\231\237\"\004\ner\207\271\314\311i\241T\352(Y\246\021\211\202\344re\"\227+\220+\326\247\b\201\303\\&\225-\324\247\b\261B2\007\207\271\324\300\202\316N\n\246\216\222=qD\346d$r\347D\216\211"
+	.string	"M\00400wtP@2\217\314\024\230H\0240/\2169\310\t\350d@f\211\274\2719\256#\260\t\301\b\022\250\036\222+\034\215.\226/\226\027P\034\231\306\243\013\243\021\346\204\213\233\026H\200\231\301\3019\272,\225:I\346\rR\251\324\221"
+	.string	"\ne\022G\211D\201\311\002yss\004"
+	.ascii	"\013H%\363\370\302\001\032\344\frER\005&\022\205R'\271\334Av"
+	.ascii	"\200\211D!\243dA\007\207\331\"\305\222\231T&[\215\224\301P\343"
+	.ascii	"\201\024\313\0269'6\354\350\354\354\274\034\231\307\t sp\224"
+	.ascii	"\307\024\034\226*\\\200\\\352\344\334l\310\3111\201t\241\263"
+	.ascii	"\002\271\263\001\216\362\310\242\005\244\361\006\351\002\303"
+	.ascii	"\362\230\002\204\020\314\235#\213\020\313c\n\f9G\027;H\246\322"
+	.ascii	"\004\0257I&\006\0257I\025\230\313c"
+	.string	"\316\016rER\005\0257I\025\220\314#\016\213\0262(\224I\0257:9\021P\352d\200\211\\\0321\300\3019\266\260\240\263\203\342F''\347\210\334y\201Q]R\300A.ur$p\001S\331BG\002\027\226//tv\230K$N\f3\271\002ya\031\203B\006\024K\f\334$\225G\0263O\021b\005\034&RIcL\036\223\307\026\311\342\005S\305\215\316\322\230<\272\344\350\334\3500uvX\030\223G\027\246Q\211\314Qq\243\263l\225\310\234\226\344\221E\2568*\225:\312\343\2151y|\3219\241L\356\340\340\0345\263\005\244\322\230<\262O\021\"\347\350\202y\323b\207\271\024\261D\262x\301T@\316\321\005\323\210\\\221d\032\215\372\006\2714\272`\256L\343\022G\251s\203\\\266X\032\21507\310e\013\243\013&k\202\231T&\215\031~\223\334A*\221(\364E \361\001\211\022-\260/\241"
+	.string	"\020\024"
+	.string	"\302\372\022\n\260\261Q"
+	.ascii	"\t\033}\0226\251n\217\314#\216\361\270d\217K\374\024!\226\"\226"
+	.ascii	"\314\344\n\007@\2428\356\3500\227\027\226\313\026\2052\211\203"
+	.ascii	"sd\361\242D\221\3149\032\227K\243\261ey\\\246\312\344\262\205"
+	.ascii	"\271\243\303\202e\032\333\345\272\203\203s\324\331A\242\300\250"
+	.ascii	"L.u\362\270LI(\223\306\035\034\234\243\212\033\235\345\013\323"
+	.ascii	"x\\\272\274\310I\2568\236pa\032\225\311\226\271\243\303B\347"
+	.ascii	"\2042\311\202N\316\t\375\024!\224I\021L\2442\311D*;0\215%\230"
+	.ascii	"\312d\013\266D\013\323H\302\206\204\315\210\020Z\030\215.-\214"
+	.ascii	"$\224I\243\221\335\301\3019\266L\343\210\020\230\312d\013\215"
+	.ascii	"\2234\"Y\350\334,\215$\224\311%\f\211\344q\231\231\310\024Rh"
+	.ascii	"\231\310\245\021\347\304\372\024!\2307\310\034\344R\304\362\305"
+	.ascii	"RD\013%\212\017Zh\241L\346| \002\t#\211\022-\210@\342\264\310"
+	.ascii	"\271Q&E\354,[\210\360@\305\362\270\302\210s\302hl\227\314\344"
+	.ascii	"\n\306%\316\t\243\261e\211s\"\3059\321\302q\205\312T\"] U\t\300"
+	.ascii	"\250\2709\256\220\223s\274\321L%\322\005\t-O\201DAr\231\221,"
+	.ascii	"^0\363\221y\304i\241.W$Sg\005rgE\261\\\2212[@*\363\212#r\207"
+	.ascii	"\211d\036\231Ku\211\342\230sBe\"U\334\350\244`\3049\276\300q"
+	.ascii	"\3019\241\342Fg\271.\227\310\035\034\234#\313\334\321a\221\231"
+	.ascii	"Jd\n-\016\322E\022y\203\334\300\022\311|\261\002\314\013f\322"
+	.ascii	"E\222yc\202\271<\346\2740[\350 W$\231\354\005\364r\007\251D2"
+	.ascii	"\227\311\234V\231\314i9\315uX wD0utvD\270\354\034S\334\344\227"
+	.ascii	"H@\002J\224@\212p\fq\341\tH\200\004<p \003\025\3207!p\216/pD"
+	.ascii	"(\223\307\025\"VH\346\\pd\036qr\n&\n%2g}\301L\336\034Y\034o\364"
+	.ascii	"\016\362\304\211\026\021@2\223;,\270\374oAj\327dd \361\313j9"
+	.ascii	"R\023\327\303\2440\267\026#\335\365\302DJ\017\221\226\242\226"
+	.ascii	"\030\203zM\224Z\206\336\022\343\307QZ\210\366\332\256\354\300"
+	.ascii	"\271\304\245Y[\0356o\031\372\214\230\016!\036B-A0><=M-A-@5\360"
+	.ascii	"\020\273p\326jI\312\013\\\202\263\027X;V\002\250\331\036U\205"
+	.ascii	"\005v\001"
+	.ascii	"9\264*mKo\312V\034S \023\242+n-\034\224\246\273C2gk\006\005,"
+	.ascii	"P\017\257\360^i\017\333$Pl\264RZ~\332*m\226\026K\013\214V\261"
+	.ascii	"\265\322\n\266S\332+ma\313n\021[zZ\302\026\260\205\247\245\322"
+	.ascii	"F\333\276v\260]l\r\333\304\366\257\365k\003[|\356\263=\324>\336"
+	.ascii	"\356\265|N\f1X{\330\266u\220:\3374\221\331S\\\335m\023j\203\f"
+	.ascii	"\371_\325\230\222\243\300\275\235M\020\275\210\264_>b\030\f\255"
+	.ascii	"U\273xL\027\366\217\331\325\026\246"
+	.string	"\302V\223:\267X4(P\201{\357\226\354\254=R\002\250\331\006U\021\t\204\002\330\006\021\262\3720#\013\024\203\266sfEO\242[{;\307\350\252\206\002\367v>M\3741\330?b\204\366\260E\322\256\245\316-\366\210OT\340\336\233,\257\312V\\{\330\332\335\266\304\266\253=l\243d\254\213\307\264w\222\007\"X_\204Q\020\252^\017\3038\006\344c C\3038/\315z\347\356\314z\fb\350wP\324\357`E\277\003\024\375\016J\364;\034\321\357\340\245\337\001K\277C\224~\207$\375\016<\372\034\260\350\277\235k\345t\017\233\022'\255\\\273\204\314\207)\t\347s\350\323\347\200\247\317\201\211>\0078}\016O\335\2765\3211\005\006\316\347P\246\317!\210>\207+}\016M\372\317@o\327.[\t6\264\360\343\263\210\36394\365\337\252\265\317$]sW8\003\266i\377\377\202\001\314\331\322\222\031\316\347"
+	.ascii	"C\277f\2615\262\206\344\353\007\347\327\f\352\327\374\351\277"
+	.ascii	"5k\213\310\020:\331s\266E\3322\275@\266'\3725s\3726\307Z\261"
+	.ascii	"\224\310h)J+\326\206\305\270AA\227\340\374\0325\375\0322\375"
+	.ascii	"\267_YkP|D8\277\206K_)\034\3725O\372n\335\231\36555\364u\266"
+	.ascii	"?T;\021\020\3655\341\322[\035\022\344J\336V\320\345q\005\203"
+	.ascii	"\252\325\312Dr\340\b\312\322I\027M\251\212\f\037\372\206\013"
+	.ascii	"\224\250\271h\017\025\2076r$\344\n+\207\245MS\344\200\360\320"
+	.ascii	";\322\034Ph\207W\355\216A\277\252\240\034ow\374\255\216\326J"
+	.ascii	"\350\207\n\b\316 \\\232u\2753k\213\303\346m\016)Ip4pV\357\314"
+	.ascii	"jCG\325V\265T\031\356\356\346\236b\320\222W\315\320\024\233\007"
+	.ascii	"V\006(\005\004\006\021K\2640\212\005\304cz\\@\240\234\236\242"
+	.ascii	"\267\251\356\013\310\2115L\177\264\200\320nd\2755\361"
+	.string	"NF\226&\265\374\264\261\243\312\006\373\346\006\244\215\255e\322\221\227\024\336(\322\326P\231\242\304\320\343j\227\324\264\273\272\302$-\r\366\352\b\354P\307\f\025\350\t\304\311\024\303\024E\321J+\203\325\362\023D\342\323&\261^N\234m\262\264Bm\263\025j\221\252\246\034\275E\332Q\204n\n\347\326\b\003A\302\265\027\204s[t%\254R\025\037\035\316m\214+\351RK,\304\271%j\2076(j\020s-P\033\324\002\251OJ@2\204\242\377\026F\356\353\212j\022\327\376\250VA\342\216L\341\374\267>s\351\325\242\022A\234=\240Sl{\024[\036V\253\255\335oyH\330\b\222\303Y/^\302[\001F\331\220D\377:\221mn@I\230\017\304TI\215\016\310\233\223\204\037Q\233\341*\330\"\314\306\215Bl8\202\260\307*\252\330\262\004#\013\216,lP\013\023b\023\016\347\020\310\254hB+z\2605"
+	.ascii	"\217\303\245\350f\232\361\341\327X\256\007\265\240\232\3267H"
+	.ascii	"&\270#-\n\210\263\276r\251\242\212x\340\374\rL\372\033\214\364"
+	.ascii	"\257\253\\\007\236-2b\204C=\3205\303\bg\r\270\026B\301\242\364"
+	.ascii	"\366\227\235^\252\232}9\250\230\311H\001\305\2402\205}\302\320"
+	.ascii	"\2502\332~\353\024\233w\207\003\255o\315\021V\204\020\n\347\020"
+	.ascii	"`\350(Z\212\216\262N\221m\360\321\277\346\323{0y8\222\354\351"
+	.ascii	"\274\353\275_C\321zxB\204\360\341|\205.\315\212\341\316\254\227"
+	.ascii	"\314\346"
+	.string	":\3573-m\201`HOr\331\365\222\321\364\303\323N\326$\037zz\272\311\265\223?[\351\273KcS\001\341|\231.\315\252\355l\256\233\264OC\035r8g\320u\354S\021\223\334\023g\021J\264\234\246\323r\232\211n\231\"\244\347\256\231\340\033\207w\202e\032\262\350_/I\277Vh\215A\037R\031\254Xo_[q\327J\276\036\351\343\021\272\202\363u\016v\252\207\226\214$Yi\313\360\351\030\273\203[\321\326\302\234z\274M\265\364P\214\301\304\215MC\201\352\322{^\267]\263\215\030\341\320\240\"oK8\257szM\205j&\231\341\254\3254\022\2356\"\317+\021g\215\246s\260\212AP\376\216\344\032\330n\356N\206\221\225I\213\330\324V\364L\027q\211\262E\331f\253\223uJ\351\360\251\313\\lD\321\375\341|\rU\364\003\210\352\250D\004\r\324E\314\215\262`\230\311A\220)\006\021\031\021\031"
+	.string	"\323\025"
+	.string	"080 \222K\306]z\003\024"
+	.string	"\020q\310\216X\033\022\266$K\"\b\211"
+	.string	"\200H4\223\0200(\002\335a\013\366SO\240\270\330M\207\206\245\233\332"
+	.ascii	"\230#\325\2730\037+\220$\214j\033\363\364\202\340\354\004\241"
+	.ascii	"\360c\327\231"
+	.string	"\3628\364y\026\031\327lr\025m\300[\321\277\322\350UA*\t\300Z\004\311\215}*H\203\372-N\360X6\254B\372\300\311\343\036\026\224%\2527,}\346\240\246\231\215\262\307~F\037\307N\270)\206}4\004(\356\364\226L \013E\354g\033\303\340+\325\2444x\246\257b\263\024\221\255\001\315\007=\031\273\246\330\326\266\225\267\325\303\324Bp.\001\231\373;\r\305f\200!\327\307Z/\246\362\f\334\227p\314<gc\304\311M!8\366\230\205\276\274Rj:u\033\206\033\340J\262\264\301+~\211P@B\240\367)K\301\276\343\344\020\017\r\360D(\304\342G\023\001.!\022\332/\370\243Ab\007Q\305\374\245[\205}\337\340\031\277OE\242B\227@\373e\311O.]\330)\302-pU\363\236\324:\032\204\330\365U\264[ \246\206\2204PQ\207\217\006\376\336a\304}\b\024\331\217\220~Am\351+"
+	.string	"I\t^\224nJp\244\n\0236^\330\350\246e\270;"
+	.ascii	"\031{\354\025\005\232\036\002QG\007c\262)\344\207\227\255}\311"
+	.ascii	"\b\002\247J\364\022\3100~&\270S\252V\247\006\236\234\255\256"
+	.ascii	"2P\241\254t\322\340I\333\354O0Y\307\360\352\005\271g\r\241\332"
+	.ascii	"\n\322\315-\023\372<\225`L\\MU\031D+o:Rqr\361\033G\314Bz\242"
+	.ascii	"\031LG\273\n8\337\002)\013\227\207E\332\341\336\242\036(\224"
+	.ascii	"\370}\377\3310Z\030S@k\251.i\321b\002\300w\316\203\035\227jg"
+	.ascii	"g)\\\223\025$\364\207\027[CA\370\224S\250\371\376,\n\255\336"
+	.ascii	")}\240n?\341\315h/\360 Evm\367P\204m}\214+\2126\005\273\263\212"
+	.ascii	"\303\357\207\352y\207j\335\320\b\240\350\243O\007$!\214\031v"
+	.ascii	"\231*\310D\330\256\036C\373\273\024\346\256\212\311P\204\036"
+	.ascii	"P-\b'\016E\354\203\340e8\017\332\020\037\031`\317\252\221:\321"
+	.ascii	"k\325\202^\340]\254\0220\310\375\227\337}\362\335C\253)ZpaF\373"
+	.ascii	"u\302\376\341\373y\350\324\327\207\342\234\230WG\251\333\210"
+	.ascii	"DU\246\253\361D\271\204r\262\343\221B\212\t\016\270\txUD\"\233"
+	.ascii	"\333\25528\230\204>\355\244\221\226t)"
+	.string	"W\024\r\275\275\270\274\332\306\t\212E\323\213\001\241\301_\321\2661\222\213\362\233>j..\240\305\214\370\247\350\373D\325\257\246\250\2511\026[\273\371\303Q\222\"\315V\204I\023.\231=\331\335\351\313~vQ7\300~\344\267~6\320\341\361\203\362\240\310\236\031\362\247\365\252v\232|\202\247\252)\352\\\213na\203\313\245;^t4\304Pu\256\277/SU}\201\277R\330n\205.\035wK~G\021*\321\326\005n\353IlR\255\327>k\354\204\356\326\340\244Z7\260\t\241\255Vd\310\336\343\001<*\310\226\345!F\340\362\323\313\033\3406\360\372\213\214\314\024\230\306{\"\340S\300\265\300afL\377kM\004\257\263\337\002\202\366K=\301\217e\356Kq?\032\022\275\036\006\205\2260\304\2108<\312\264\rQFW\247\200\222B\301"
+	.string	"\"0o\007\264\375\f\023\234\352\025o\275\337/\251\231UN\357\n\247\025\212\347\317c\241a\024\025\343\315\363\243\030\303u\345\233dq\2410\005\017\002\001cI\310\221D$P\020\205IC:i\321\210`\3161\n\245\3153iW\3417\0223\323\257\203wE9Q\356U*\364\200M\2203\331M\005>^\376\017W\032\360+\312)\264\n\003B\354\240~MAP=`Y9IJ\340\367:\364H\230\r?\302HL\264\021\211%>a\025\375\267NR-\220\212\345F4\005m\253\3430\211\225N\273\323\353\310s7\224\204\207\217\n\350P&\320\257JD\356\357"
+	.ascii	"\032\244\330\004\226\304[\350N%\360\\\324h&\313R\233\027\200"
+	.ascii	"&\205~\202J\204\223J&\241Ek\225_m\317\347S\230u\022V\322!\242"
+	.ascii	"\031\346\006{a\212|\307\242\006\306\237\332\026i\313ZX{\3752"
+	.ascii	"\241\355\\\344V\260\235\235D\304\222F\337\223\362\205\211\033"
+	.ascii	"\220\345\226\005Y\321\364\003\200O\nEs-5\335\252\240 \367`$v"
+	.ascii	"F-\rk-\205\277\25359\001A\246\013\264\203z,\030_M\005_ps\245"
+	.ascii	"`$\376\364\347\260\217\276\307\270\235\345\232tw\023\262\305"
+	.ascii	"\016\257\330F\251\301,\203y\357\330\350\270\334\203\350\0249"
+	.ascii	"\362x\205\320\212\236\246\272\346\264\266ev` um\r&a\036\334\374"
+	.ascii	"\241\27014L8\320\271\"*;\025\341\t\206.w\300\325\343)\350\r\023"
+	.ascii	"O\260\310D&\3358\036\002HU\326\243u\030\236\245\305q@f\337\354"
+	.ascii	"\177\327\332t\267\256\275\034}B4\223\033\215\257\342\034A\351"
+	.ascii	"8\331\267:\001!XW\242"
+	.string	"8NU\331}\177\306\334\035uu\n\006\007r\3650\352'\256cR\263&\221\324\225\314\255\342\313\327\340\032]\374\377\234X}\016=W\333\f\nG\236\313\326\302-\031\f\004\302\311/\322]\337\352\210\006,\237\270\347\271c\356\207\f\220\326\220\tO5\350\213\213\017*\227\274\004d\353w\325-\207\302\232\f\013RY>\305\004Ph\321\027\005N\200\272s\2010\371Fn\371I\371m\334V\3533!f5\257G$P\2240\254\f\360w;i\363)a%\240\317\367\332\005'\324\205\205O\303d\360\253\255\362\364+\270&z\317hS:c\372\304=v\030=\342\343\335\362^dg/\034\036X~|\303\222x\257\327t~\327\367VU\307\327\023E\345\360h17\371K\024Zc\022\025\305\365j\254\237`\006*\261\364\372\363\367T\246\013I\365\250\004\030\327H\243\273Q\t,\307\251\370 T\326\f\026<\235\236\336\254"
+	.string	"\275-W\313\253<\027\251\234Sh\0031h\036\003\325\272)`\f\336\304\"\177\210\340\262J\223\364\024r\377\344\342"
+	.string	"6\032s\276J\222A%\254\361\306>Z\236\324D\036\240\342\234\207\357+#o\241\201:\005\323\233)\364\345,\354\351\332\3129\310\253\254\3337\200]5\326\330@2\343|\356{\244u$\337\343\347\306V5\340\244\231\214ue\275O}\20406\244G\230\031\320\fm\356\004l\2274`\266\246\304\311c\022\231^xF{\241\f\356_\346yG|\204\377'U\336V\177\3716P\326\221\037\216~\0021\307\202\204\251\222"
+	.ascii	"\277\215\204\344%\2045\b+}\200T\227\365\312E4\202\264\201d\007"
+	.ascii	"\2644n\263BnVt;\246\\\211\fM\261\366x,2cy\022Uu*\227\256\362"
+	.ascii	"\231\205\370L\250Q\231Sk\366R\341\343(c\243\310\332a\177\002"
+	.ascii	"\r:\323\315C\215V\260$\344\032\034\177\242u\223\002\213\206e"
+	.ascii	":\305\250\261\205\033\371\210\212\332_B\007]\031-\310\024\210"
+	.ascii	"}\315\250KY\273\212\373\f/\307\"f\037\024^!\306Gh\177\305\233"
+	.ascii	"\007\363F\300\207\253\036\003\333\214)Z\"1&D*a\322R\230@\311"
+	.ascii	"\372x\b\026\327\261M\032.\207\367\024YzN8\243i^\213\214\316\213"
+	.ascii	"\304\021\226w\030\017\356\327\026f\360F\263\275\nC\247\214~K"
+	.ascii	"\333D\246\362\3664\320\220\024o\306S\260Gc\303\002S\361\027."
+	.ascii	"\373pMce\354\311~\314I\370=\305\274\266\030:,\274\317\222\035"
+	.ascii	"t\f\302\357I\347j\262\360\035\204\350\302\024n\301\336\241\002"
+	.ascii	"+U\265\325e^\324\334f\357\332\021\364\237/\005\267m\005\016\350"
+	.ascii	"\032\254\316\261\016\037?\247\234s\343\353123\004l\350Y\"\235"
+	.ascii	"\273T\313\336\b\205@\351wn\211l\304\271\363m\347\360\257\031"
+	.ascii	"~\320\375e*#d\032/\rl\bZg\302\275\202\264\262\212j\221\264\027"
+	.ascii	"%\270>y\003\217Z\322\200p=\335W\001\220|\222\032\322\207\007"
+	.ascii	"\302\253q\270\203_\203\361\030A\216\242\310\025\263\227n\263"
+	.ascii	"\3548\321\307\243\242\361\30489\356)\340"
+	.string	"\374\323^\376d\267\013\354\013\221P\022\tO\275ui\016\004t\200\274\253$\253z\233A\374\205\035\336\353\033\346\232\002\304\004\250x\315\323\373\026\207)\240\277\317\322\034i\314\364\037\345\305\261#N\020\225\303\024\323ee4\356qB\0075R97\005\275RM\037SQ\216\222\030\213\347\212\243\032\002\3632\013\022!\314\237!\034M\n\031My\261\211\b`N\0050Z\001|\036\312\377!\363\326\201\207\234\021\323\031=d~\\0!\256\316\272\t/\036\213r\210\244\322\324\001\255*{\351\320 t3\355\312X\255k\004m\266\332\tsy\314}8\317x<\244#Y*V\343\354;l\020\266\312\263d.\033\337pV\267\362@\255h\350e;4\312\330v\351C\236=\205\247+Zsz\3350B/c\304I\334\255\202\222\247Dx\b\030\352R@\375\325\225\202\200\n)\233\204\331\315\266\020\247\212 e\350p\200r\316"
+	.string	"\356d%\022\177\231R\027\327\003\236\004}\317\007\013P\311\346\327\t\220\255\301\337\250\037\n\351\013\200\006\3040l\267|\036\231J\356\200j\024\265\253\202\374.2\335\361"
+	.string	"g\371\232]\271^\316\2054l2\312W\377\215atX\301\200AeaNAL\0212\030,@c\0176\341\"\215\207\343V\202J\237\202K\354+\302?\366\274\315"
+	.string	"\01741=\346\303~\367(\204Q\225"
+	.string	"\321\372Z\n\313'-\377\342\240[\207?sn\325\205\276]\277??5\206EQj\344\212X\224-\"\2163f\325\340E\334&\r\330\022\241\023)m?\231\001\340qNu\037\232wa\316['/|\007\304\210X\330>\222\250\274N\017\025;\210\027+\334X"
+	.ascii	";jg\rjeq33k\2711\216\021\031%$.\340r>i\362\317A\223\345\300\310"
+	.ascii	"VJ \301\024M'>?\007"
+	.string	"r\304\325\323\230\357\"1W\222\217#\231@\260@\353\224\260X\001\276\344\375\230;r\365\224O\325\267\233\373\266\020\350!\370\241\206\243\321\0212"
+	.ascii	"\241\177\214\234\325\333\004\rQ\372wt\034\325<a~+\312\342:\341"
+	.ascii	"\002b\234y\373hG\030&H\330\"zdA8s+\351\266\324\233\344\234\260"
+	.ascii	"\273\340\007W\303\377B\363\265>\275L\033\231\376\tC\301\375\362"
+	.ascii	"~m\240\270R\300\354\r\020\021N\332\020\205?\334\310\034\337\326"
+	.ascii	"\034Q!Rc\324\301\335\023\020\341F\300\342\307\223\345\301\331"
+	.ascii	"J\236\314$D\301_dn\324#X%\332\205\3131\004\r\301\320X\320\223"
+	.ascii	"B\364O\370\323\031S\317\b\004\336\334\251\272mQ\326\340\023\303"
+	.ascii	"\347\375@\030\030P}Z_\343\230_\205\205+\205\034\tm\031\326?\b"
+	.ascii	"\034\217\006'\211\031\206\260.'\342[\271\t\314\002A\242\002\214"
+	.ascii	"\024\177\255\016\237A\277H\344\272\310\377\207\330\356\313\232"
+	.ascii	"\001f\313\211\3545\373\335+\201F\300\252\f\354K\366\031o\350"
+	.ascii	"\021\372\200,E\311\221\204\\\375i\226\202\221\356\240\243\b;"
+	.ascii	"\325MR9\254H\223)-a\022\363\027m\213\312\257\214\316\310\372"
+	.ascii	"i+\357<\334 \2213fQ\r(VIf\226\300\n\301O\001\223\017\017\005"
+	.ascii	":P\244\263#\201\341\246$\270`\340wD\334\221\205\355@\030Z\r#"
+	.ascii	"\204CZ\037\254\234\220g\363\221M\351!\210\254T\023\307\003 \256"
+	.ascii	"\207?F\023\266A+\240<\307\356iu4HA\343\360\030\226\004\257,\352"
+	.ascii	"\023\277\306;\277\241H\275\017\230S\371\"\223\211\025\203\303"
+	.ascii	"\373\205\307C6\331J<!\201\324$\224\344\354\243E8i\372\237\007"
+	.ascii	"i\312\367\346\210\017~\215\220\\\223\322\326}\253\220E\004i\246"
+	.ascii	"kt\371\035\244\246\246\301|\273\207j\304\331\225\245\351g\234"
+	.ascii	"H\272#\n\017}\366wP\370\343O\240\347~\362\037dUl\004\362\251"
+	.ascii	"6'\245\216F\304'\263p\327\260I\263\316\177\320\361\035\035\207"
+	.ascii	"G\312\310x9\325\203X\335S\362\351\262\314K\274\031\r\374\260"
+	.ascii	"\fO2{q\2221[\235\340\307N\265\345\220\270\333\344\005V\217\355"
+	.ascii	"/\253\2351R\374\232\206\323uy\262_\347h\025NSifHs\307\247\301"
+	.ascii	"\350\356\004\255(y\224\313\216B\200,\245I\332\221\306\034U%\204"
+	.ascii	"\035lF\0042\264\365:4\022M\3722\205\217\263I]\346\027\274\277"
+	.ascii	"\224i\213\373\233\210\274\211aj,LQ\241\025C~\215)b8Q\276cW8\260"
+	.ascii	"01\203\241\304M\030\376\317\365\305\025\262\t\210\003j\207\224"
+	.ascii	"\305\340\352\252h?\367K\3110\377r\234\021\246\200M\315f\211\230"
+	.ascii	"\316\262[Y5a\313\310\224\250\374\r\271lu2\237\364\035\316\205"
+	.ascii	"x\376x\227\"\240\203\325\341\207\304HVf\237\203\347\nJ\300\215"
+	.ascii	"P\362\3235b\332\231\257\255\020\262\336x\236\300~)a\215\237D"
+	.ascii	"N0\266Z\306\233\007m\245T\320\023\234\341>\350\320\327Ni\276"
+	.ascii	"\030q')\275\220\304\300W\240@\245\n\310\001|\260B7\033`\202a"
+	.ascii	"/\303\027\253\372ZP_\357\261\327\013\270\314!\244\356c0\r\200"
+	.ascii	"\275dIN\346\312v\336\214F\236\022'\357\3252\\\304R\305QPG!\310"
+	.ascii	"\006_,)\321\303\346\004H\244\202\316\224\332\303\026G\322/{u"
+	.ascii	"\221\037\002\277\245L\201\302\347\300a\035E1\027U\007\224-K\026"
+	.ascii	"\3359\f\213`\001\215\247\215C$&\030\227\354\332\036\357*]p\217"
+	.ascii	"\033[\303\2405\275\240\264\007\243\324\311\346\377\353\330\277"
+	.ascii	"\275\267$\377\211I\304\355\240\324\271\177k\216doB\372R\025\270"
+	.ascii	"w8\360QX\212\325\336\035$\311\253\274\272Pe\257L\277\206\206"
+	.ascii	"\352G\322\333\344f\017Y\367*\261q\237`\366SPB_A\005\337Bp\264"
+	.ascii	"\371\001\217\270\017B\376F\311\3043X\3531z\3167\345\227w\370"
+	.ascii	"\251\256\275n:\230G\337\252\271\240\177\215\272\217\270{\340"
+	.ascii	"\362\252\021\003\222E\3418&8<\305\007\237\367[K\f\214K6\3055"
+	.ascii	"\252~&\376\374(z\032\376^\212x#\374\260\324L+\370b\313\314fW"
+	.ascii	"\363\005\264\362\017s\303\274SE\360\n\264\276\016\3207`\314\214"
+	.ascii	"\031\277\220\347\352L\273\r_\177\354\236Du\312\211\016\374/\366"
+	.ascii	"l\013\3609i\237\204\373\316,\373b\360$\335\035+\234\272\226`"
+	.ascii	"\317\343\233\274\305\361[\215\007\002Ggl\021a7\306\370x\216\365"
+	.ascii	"-\253\214\200\273~;`\250\377\2745\371\367\254\2715\250o\256\257"
+	.ascii	"\3572\351\317\364\367\027(=\213\355\257\343\036\300\311\330\001"
+	.ascii	"\232\335\200\347\216\227\362\274\341s\215\350\215\231\330\005"
+	.ascii	"\335"
+	.string	"\367\275\236;\360\357\343\206z\354\235k\3130\213\265\372v\373\363]-d\316>\216#\341\375\0358\016\230\234\235m\307\243\373h;;\030v\240\026<\016\252K\325j\026\362\377Bl\272\347{\007\236\356\362l\377g\305\340!\264\030\223\331\267\0369\036\377\2406\330\354\376\023g\277y\026\304p@\206\216[m\333\3262\263|\235\231\351\306\344k)\336\037\203\33354\b\031\305\325\333H\354\007\336;\016,\021\334\255{Lr\376i\3731\327Y\223 \357Mz81\351\361\f\277\271\316n\310\023_\016\214\377\253`\237s\206\207D\225/\343\264\211\271\374\033\244\353-g\223Q\033\366M\305o\0162\365\245\246\f?t\252G^\356\272\367\203\312\361\323U7\235t\326,\036\340\226\217!n}<_|h\037\344E0\202\237_\346\220V\264\006\311?^i\361\251\265\224\255\244\346\335\003\264\001l\306f\363\221\202y\221\236v"
+	.ascii	"P\317\265\311O\357\027Y\375\351\367\357\325\353z\233\227\317"
+	.ascii	"\020\263\256\312/\200\356\305\273\277\303\272\373\025\262\212"
+	.ascii	"\215S\336\361#\222E\247\373}\336P}\376M\240#\264\366\027\326"
+	.ascii	"}V\275\316\316\347\034\236\345\323\r\240"
+	.string	"Q>\274\301\215\013 \270\340B\346\302{\340\3356kz=j.N\364\357\002\023d\302y\336\rD\372\035'v\342\372\212\333\331\250f-\377?B\274\020\226\207\323{4\005\372\002\335$P\237\2766\005\365\346owf\225[\364nwi\353\232\336s6V\327\177\321\311\276\3218\376p{\016\3745\257\370\267\227\343\251}\247\2053d\346\373<\007\335\007\276;^\310\225\277[\\h?5\034\344\2344\254\315~D\375\337Y\345\247\371u\225F<>\213\336\277\227\351\316\274\226\376&D\036\347\344e\0369\2522\337,\371\254\367g\306Dq/\n\f\033\360\230\302\2536\\P\305\335\245\370\213\270#\323{#\257]\005\267<\366D\230\233\362\367\207\264\363\016W\214\35381\225\325\245&\3157\304*`9\363W\\\357=9\b1\346\355\330\257\321\210!\361/\022\275e5\034\265\374*\303\275\336./\263\325\217\306\303\223"
+	.ascii	"\034\310\374j\327Z\262U\253\262\234\006\343\243\326\021\373:"
+	.ascii	" V\220\347(zp\371\305*\253on\007\236\017\347\020\372]q\256\377"
+	.ascii	"\252\177H]F~\277Cq\254:\006^\377\310\306\205\322\247\226\311"
+	.ascii	"<\301\237~{\236E\263\360=\216V+\037\342%\350o\234\237S7\301\\"
+	.ascii	"\035\274b\2179\254\314\203\350\205J?\274\340\271\332\341]\236"
+	.ascii	"\022\254\017\371\2772\336\274q#\327,\373\345{\034\373\340\213"
+	.ascii	"\301\361;hE\255&\034\027\357\037"
+	.text
+	.section	.gnu.lto_.symtab.87b8ba8dacdedcb9,"e",@progbits
+	.string	"dyad_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"dyad_getVersion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"dyad_getTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"dyad_getStreamCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"dyad_atPanic"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"dyad_removeListener"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"dyad_removeAllListeners"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"dyad_end"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"dyad_listen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"dyad_connect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"dyad_vwritef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"dyad_writef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"dyad_getState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"dyad_getAddress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"dyad_getPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"dyad_getBytesSent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"dyad_getBytesReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"dyad_getSocket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"inet_ntop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"getsockname"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"getpeername"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"gettimeofday"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"__sysv_signal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"accept"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"getsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"freeaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"getaddrinfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"connect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"fgetc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.87b8ba8dacdedcb9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8404 @@
+	.file	"msp_dataflash.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/streambuf.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/fc/runtime_config.h"
+	.file 7 "./src/main/msp/msp.h"
+	.file 8 "./src/main/msp/msp_dataflash.c"
+	.file 9 "./src/main/common/maths.h"
+	.file 10 "./src/main/io/flashfs.h"
+	.file 11 "./src/main/msp/msp_serial.h"
+	.file 12 "./src/main/common/utils.h"
+	.file 13 "./src/main/target/SITL/target.h"
+	.file 14 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	msp_dataflash.c.4faf4c58
+	.weak	msp_dataflash.c.4faf4c58
+msp_dataflash.c.4faf4c58:
+	.long	0x5b5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF1217
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1139
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1140
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1141
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1142
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1143
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1146
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1148
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x7c
+	.uleb128 0x2
+	.long	.LASF1149
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1150
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1151
+	.uleb128 0x2
+	.long	.LASF1152
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1153
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1154
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0xba
+	.uleb128 0x2
+	.long	.LASF1155
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x9
+	.long	0xcb
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x9
+	.long	0xdc
+	.uleb128 0x16
+	.long	.LASF1218
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xa
+	.long	0xdc
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1157
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1158
+	.uleb128 0xd
+	.long	.LASF1168
+	.byte	0x10
+	.byte	0x4
+	.byte	0x19
+	.long	0x12e
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x1a
+	.byte	0xe
+	.long	0x12e
+	.byte	0
+	.uleb128 0xb
+	.string	"end"
+	.byte	0x4
+	.byte	0x1b
+	.byte	0xe
+	.long	0x12e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0xba
+	.uleb128 0x9
+	.long	0x12e
+	.uleb128 0x2
+	.long	.LASF1159
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0x107
+	.uleb128 0x2
+	.long	.LASF1160
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x12
+	.long	0xdc
+	.uleb128 0x9
+	.long	0x144
+	.uleb128 0xf
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x15
+	.long	0x16e
+	.uleb128 0xc
+	.long	.LASF1161
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF1162
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1219
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x10
+	.long	0xba
+	.uleb128 0xf
+	.byte	0x5
+	.long	0x7c
+	.byte	0x7
+	.byte	0x17
+	.long	0x19f
+	.uleb128 0xc
+	.long	.LASF1163
+	.byte	0x1
+	.uleb128 0x10
+	.long	.LASF1164
+	.sleb128 -1
+	.uleb128 0xc
+	.long	.LASF1165
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1166
+	.sleb128 -2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1167
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x3
+	.long	0x17a
+	.uleb128 0xd
+	.long	.LASF1169
+	.byte	0x18
+	.byte	0x7
+	.byte	0x23
+	.long	0x1ec
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x7
+	.byte	0x24
+	.byte	0xc
+	.long	0x138
+	.byte	0
+	.uleb128 0xb
+	.string	"cmd"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xe
+	.long	0xcb
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1170
+	.byte	0x7
+	.byte	0x26
+	.byte	0xd
+	.long	0xa2
+	.byte	0x12
+	.uleb128 0x4
+	.long	.LASF1171
+	.byte	0x7
+	.byte	0x27
+	.byte	0xd
+	.long	0xba
+	.byte	0x14
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1172
+	.byte	0x7
+	.byte	0x28
+	.byte	0x3
+	.long	0x1ab
+	.uleb128 0x2
+	.long	.LASF1173
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x10
+	.long	0x204
+	.uleb128 0x6
+	.long	0x209
+	.uleb128 0x18
+	.long	0x214
+	.uleb128 0x1
+	.long	0x214
+	.byte	0
+	.uleb128 0x6
+	.long	0x219
+	.uleb128 0x19
+	.long	.LASF1220
+	.uleb128 0x6
+	.long	0x1ec
+	.uleb128 0x6
+	.long	0x1f8
+	.uleb128 0x2
+	.long	.LASF1174
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x17
+	.long	0x234
+	.uleb128 0x6
+	.long	0x239
+	.uleb128 0x1a
+	.long	0x19f
+	.long	0x248
+	.uleb128 0x1
+	.long	0x21e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1175
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x49
+	.long	0x2e4
+	.uleb128 0x4
+	.long	.LASF1176
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x9
+	.long	0x2e4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1177
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xd
+	.long	0xba
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1178
+	.byte	0x8
+	.byte	0x4c
+	.byte	0xd
+	.long	0xba
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1179
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xe
+	.long	0xcb
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1180
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xe
+	.long	0xcb
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF1181
+	.byte	0x8
+	.byte	0x4f
+	.byte	0xe
+	.long	0xcb
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1182
+	.byte	0x8
+	.byte	0x50
+	.byte	0xe
+	.long	0xcb
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF1183
+	.byte	0x8
+	.byte	0x51
+	.byte	0xe
+	.long	0xdc
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF1184
+	.byte	0x8
+	.byte	0x52
+	.byte	0xe
+	.long	0xdc
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1185
+	.byte	0x8
+	.byte	0x53
+	.byte	0xe
+	.long	0x144
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF1186
+	.byte	0x8
+	.byte	0x54
+	.byte	0xe
+	.long	0x144
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1187
+	.uleb128 0x2
+	.long	.LASF1188
+	.byte	0x8
+	.byte	0x55
+	.byte	0x3
+	.long	0x248
+	.uleb128 0x3
+	.long	.LASF1203
+	.byte	0x57
+	.byte	0x1a
+	.long	0x2eb
+	.uleb128 0x7
+	.long	.LASF1189
+	.byte	0x9
+	.byte	0x92
+	.byte	0xa
+	.long	0xcb
+	.long	0x322
+	.uleb128 0x1
+	.long	0xcb
+	.uleb128 0x1
+	.long	0x322
+	.uleb128 0x1
+	.long	0xdc
+	.byte	0
+	.uleb128 0x6
+	.long	0x327
+	.uleb128 0x1b
+	.uleb128 0x7
+	.long	.LASF1190
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x5
+	.long	0x7c
+	.long	0x348
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x12e
+	.uleb128 0x1
+	.long	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1192
+	.byte	0x4
+	.byte	0x2e
+	.long	0x35e
+	.uleb128 0x1
+	.long	0x35e
+	.uleb128 0x1
+	.long	0x7c
+	.byte	0
+	.uleb128 0x6
+	.long	0x138
+	.uleb128 0x7
+	.long	.LASF1191
+	.byte	0x4
+	.byte	0x2c
+	.byte	0xa
+	.long	0x12e
+	.long	0x379
+	.uleb128 0x1
+	.long	0x35e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1193
+	.byte	0xb
+	.byte	0x5e
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x214
+	.uleb128 0x1
+	.long	0x228
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1194
+	.byte	0x4
+	.byte	0x1e
+	.long	0x3a5
+	.uleb128 0x1
+	.long	0x35e
+	.uleb128 0x1
+	.long	0xba
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1195
+	.byte	0x4
+	.byte	0x1f
+	.long	0x3bb
+	.uleb128 0x1
+	.long	0x35e
+	.uleb128 0x1
+	.long	0xcb
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1196
+	.byte	0x4
+	.byte	0x20
+	.long	0x3d1
+	.uleb128 0x1
+	.long	0x35e
+	.uleb128 0x1
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1221
+	.byte	0xe
+	.byte	0x1d
+	.byte	0xa
+	.long	0x144
+	.uleb128 0x1d
+	.long	.LASF1197
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xa
+	.long	0xdc
+	.long	0x3ef
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1198
+	.byte	0x4
+	.byte	0x26
+	.byte	0x9
+	.long	0xba
+	.long	0x405
+	.uleb128 0x1
+	.long	0x35e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1199
+	.byte	0x4
+	.byte	0x27
+	.byte	0xa
+	.long	0xcb
+	.long	0x41b
+	.uleb128 0x1
+	.long	0x35e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1200
+	.byte	0x4
+	.byte	0x28
+	.byte	0xa
+	.long	0xdc
+	.long	0x431
+	.uleb128 0x1
+	.long	0x35e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1201
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x5
+	.long	0x7c
+	.long	0x447
+	.uleb128 0x1
+	.long	0x35e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1202
+	.byte	0xd3
+	.long	0x19f
+	.long	0x477
+	.uleb128 0x8
+	.string	"src"
+	.byte	0x8
+	.byte	0xd3
+	.byte	0x32
+	.long	0x35e
+	.uleb128 0x12
+	.string	"seq"
+	.byte	0xd9
+	.long	0xd7
+	.uleb128 0x3
+	.long	.LASF1177
+	.byte	0xda
+	.byte	0x13
+	.long	0xc6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1204
+	.byte	0xa0
+	.long	0x19f
+	.long	0x4eb
+	.uleb128 0x8
+	.string	"dst"
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x33
+	.long	0x35e
+	.uleb128 0x8
+	.string	"src"
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x40
+	.long	0x35e
+	.uleb128 0xe
+	.long	.LASF1205
+	.byte	0xa0
+	.byte	0x5a
+	.long	0x223
+	.uleb128 0x3
+	.long	.LASF1183
+	.byte	0xa6
+	.byte	0x14
+	.long	0xe8
+	.uleb128 0x3
+	.long	.LASF1184
+	.byte	0xa7
+	.byte	0xe
+	.long	0xdc
+	.uleb128 0x3
+	.long	.LASF1179
+	.byte	0xa8
+	.byte	0xe
+	.long	0xcb
+	.uleb128 0x3
+	.long	.LASF1178
+	.byte	0xa9
+	.byte	0x13
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF1177
+	.byte	0xaa
+	.byte	0x13
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF1206
+	.byte	0xb0
+	.byte	0xf
+	.long	0x83
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1209
+	.byte	0x9b
+	.long	0x501
+	.uleb128 0xe
+	.long	.LASF1207
+	.byte	0x9b
+	.byte	0x3a
+	.long	0x214
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1222
+	.byte	0x8
+	.byte	0x79
+	.byte	0x14
+	.long	0x19f
+	.long	0x527
+	.uleb128 0xe
+	.long	.LASF1208
+	.byte	0x79
+	.byte	0x38
+	.long	0x21e
+	.uleb128 0x12
+	.string	"now"
+	.byte	0x7b
+	.long	0x150
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1210
+	.byte	0x59
+	.long	0x597
+	.uleb128 0x8
+	.string	"dst"
+	.byte	0x8
+	.byte	0x59
+	.byte	0x33
+	.long	0x35e
+	.uleb128 0x8
+	.string	"seq"
+	.byte	0x8
+	.byte	0x59
+	.byte	0x41
+	.long	0xcb
+	.uleb128 0x3
+	.long	.LASF1211
+	.byte	0x5d
+	.byte	0x14
+	.long	0xe8
+	.uleb128 0x3
+	.long	.LASF1183
+	.byte	0x5e
+	.byte	0x14
+	.long	0xe8
+	.uleb128 0x3
+	.long	.LASF1184
+	.byte	0x5f
+	.byte	0x14
+	.long	0xd7
+	.uleb128 0x3
+	.long	.LASF1212
+	.byte	0x60
+	.byte	0x15
+	.long	0x133
+	.uleb128 0x3
+	.long	.LASF1213
+	.byte	0x66
+	.byte	0x15
+	.long	0x133
+	.uleb128 0x3
+	.long	.LASF1214
+	.byte	0x69
+	.byte	0x15
+	.long	0x133
+	.uleb128 0x3
+	.long	.LASF1215
+	.byte	0x6a
+	.byte	0xe
+	.long	0xcb
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1216
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x17
+	.long	0xae
+	.uleb128 0x8
+	.string	"a"
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x26
+	.long	0xdc
+	.uleb128 0x8
+	.string	"b"
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x32
+	.long	0xdc
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 15 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.file 18 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 34 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF939
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x7
+	.byte	0x4
+	.file 35 "./src/main/msp/msp_dataflash.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x23
+	.byte	0x4
+	.file 36 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1138
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF938
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF950
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.21.42b0efe26f2c975d82840e6ab4f40d87,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.59.465b2f7532a4846ee89798d0d344cbd1,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1123
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1223
+	.long	.LASF1224
+	.long	.LASF1225
+	.long	.LASF1226
+	.long	.LASF1227
+	.long	.LASF1228
+	.long	.LASF1229
+	.long	.LASF1230
+	.long	.LASF1231
+	.long	.LASF1232
+	.long	.LASF1233
+	.long	.LASF1234
+	.long	.LASF1235
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x25
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1236
+	.byte	0x9
+	.long	.LASF1237
+	.byte	0x9
+	.long	.LASF1238
+	.byte	0x9
+	.long	.LASF1239
+	.byte	0x1
+	.long	.LASF1240
+	.byte	0x1
+	.long	.LASF1241
+	.byte	0x3
+	.long	.LASF1242
+	.byte	0x5
+	.long	.LASF1243
+	.byte	0x5
+	.long	.LASF1244
+	.byte	0x1
+	.long	.LASF1245
+	.byte	0x4
+	.long	.LASF1246
+	.byte	0x5
+	.long	.LASF1247
+	.byte	0x1
+	.long	.LASF1248
+	.byte	0x6
+	.long	.LASF1240
+	.byte	0x2
+	.long	.LASF1249
+	.byte	0xc
+	.long	.LASF1250
+	.byte	0xd
+	.long	.LASF1251
+	.byte	0xd
+	.long	.LASF1251
+	.byte	0xc
+	.long	.LASF1252
+	.byte	0x9
+	.long	.LASF1253
+	.byte	0xc
+	.long	.LASF1254
+	.byte	0xc
+	.long	.LASF1255
+	.byte	0x9
+	.long	.LASF1256
+	.byte	0x9
+	.long	.LASF1257
+	.byte	0xb
+	.long	.LASF1258
+	.byte	0x9
+	.long	.LASF1259
+	.byte	0xa
+	.long	.LASF1260
+	.byte	0xa
+	.long	.LASF1261
+	.byte	0x9
+	.long	.LASF1262
+	.byte	0x9
+	.long	.LASF1263
+	.byte	0x9
+	.long	.LASF1264
+	.byte	0x8
+	.long	.LASF1265
+	.byte	0x7
+	.long	.LASF1266
+	.byte	0xd
+	.long	.LASF1267
+	.byte	0x7
+	.long	.LASF1268
+	.byte	0x5
+	.long	.LASF1269
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1203:
+	.string	"dataflashStream"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1093:
+	.string	"MSP_SET_MOTOR_3D_CONFIG 217"
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF940:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF963:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1165:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1132:
+	.string	"DATAFLASH_STREAM_MIN_FRAME_SIZE 64"
+.LASF1078:
+	.string	"MSP_GPS_CONFIG 132"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF982:
+	.string	"MSP_FC_VARIANT 2"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF958:
+	.string	"API_VERSION_MINOR 36"
+.LASF905:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF911:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF952:
+	.string	"FLASHFS_WRITE_BUFFER_PAGES 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1058:
+	.string	"MSP_ATTITUDE 108"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF492:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF945:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF999:
+	.string	"MSP_SET_MIXER_CONFIG 43"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1153:
+	.string	"int32_t"
+.LASF1053:
+	.string	"MSP_SERVO 103"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF1166:
+	.string	"MSP_RESULT_CMD_UNKNOWN"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1083:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1009:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF1172:
+	.string	"mspPacket_t"
+.LASF922:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF975:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1109:
+	.string	"MSP_TRACE_READ 152"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1098:
+	.string	"MSP_SET_MOTOR_CONFIG 222"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF1040:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1011:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF1059:
+	.string	"MSP_ALTITUDE 109"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1178:
+	.string	"window"
+.LASF1163:
+	.string	"MSP_RESULT_ACK"
+.LASF1135:
+	.string	"DATAFLASH_STREAM_TIMEOUT_MS 3000"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF479:
+	.string	"__P(args) args"
+.LASF1024:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF953:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_WRITE_BUFFER_PAGES * FLASHFS_PAGE_SIZE)"
+.LASF1209:
+	.string	"mspDataflashStreamStart"
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF936:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF919:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1171:
+	.string	"direction"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF792:
+	.string	"USE_VCP"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF928:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1127:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF1111:
+	.string	"MSP_DATAFLASH_STREAM_DATA 154"
+.LASF989:
+	.string	"MSP_SET_BATTERY_CONFIG 33"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF932:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1079:
+	.string	"MSP_COMPASS_CONFIG 133"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1222:
+	.string	"mspDataflashStreamNext"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1112:
+	.string	"MSP_DATAFLASH_STREAM_ACK 155"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1052:
+	.string	"MSP_RAW_IMU 102"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1221:
+	.string	"millis"
+.LASF984:
+	.string	"MSP_BOARD_INFO 4"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1128:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF1066:
+	.string	"MSP_BOXIDS 119"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1050:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1220:
+	.string	"serialPort_s"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1092:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1047:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1170:
+	.string	"result"
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF1030:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF516:
+	.string	"__always_inline"
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1091:
+	.string	"MSP_SET_MOTOR 214"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF1069:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1150:
+	.string	"long int"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF920:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF897:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1181:
+	.string	"nextSeq"
+.LASF907:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1010:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF381:
+	.string	"__unix 1"
+.LASF1084:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF985:
+	.string	"MSP_BUILD_INFO 5"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1197:
+	.string	"flashfsGetSize"
+.LASF901:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1062:
+	.string	"MSP_PID 112"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF1074:
+	.string	"MSP_VOLTAGE_METERS 128"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF910:
+	.string	"Q12 (1 << 12)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF943:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF962:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1090:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF990:
+	.string	"MSP_MODE_RANGES 34"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF1036:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF1143:
+	.string	"signed char"
+.LASF1154:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1219:
+	.string	"armingFlags"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF969:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF793:
+	.string	"USE_PPM"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1139:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF991:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF986:
+	.string	"MSP_NAME 10"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1000:
+	.string	"MSP_RX_CONFIG 44"
+.LASF992:
+	.string	"MSP_FEATURE_CONFIG 36"
+.LASF1043:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF1124:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1134:
+	.string	"DATAFLASH_STREAM_RESEND_MS 250"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF954:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1187:
+	.string	"_Bool"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF877:
+	.string	"NULL"
+.LASF948:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF981:
+	.string	"MSP_API_VERSION 1"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF959:
+	.string	"API_VERSION_LENGTH 2"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1071:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF1073:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1118:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF918:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF980:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1182:
+	.string	"ackedSeq"
+.LASF966:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1031:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF995:
+	.string	"MSP_SET_BOARD_ALIGNMENT_CONFIG 39"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF398:
+	.string	"true 1"
+.LASF1161:
+	.string	"ARMED"
+.LASF1147:
+	.string	"__uint16_t"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1100:
+	.string	"MSP_SET_COMPASS_CONFIG 224"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF916:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1173:
+	.string	"mspPostProcessFnPtr"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF937:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF1107:
+	.string	"MSP_STATUS_EX 150"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1177:
+	.string	"flags"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1105:
+	.string	"MSP_DEBUG 254"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF965:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1206:
+	.string	"maxFrameSize"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF925:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1049:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF1180:
+	.string	"frameCount"
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1028:
+	.string	"MSP_SET_RXFAIL_CONFIG 78"
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1167:
+	.string	"mspResult_e"
+.LASF1189:
+	.string	"crc16_ccitt_update"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF978:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1113:
+	.string	"MSP_SETTING 156"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF949:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF858:
+	.string	"__need_size_t"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1008:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1077:
+	.string	"MSP_MOTOR_CONFIG 131"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1075:
+	.string	"MSP_CURRENT_METERS 129"
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF988:
+	.string	"MSP_BATTERY_CONFIG 32"
+.LASF971:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF840:
+	.string	"__size_t__ "
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF397:
+	.string	"bool _Bool"
+.LASF951:
+	.string	"FLASHFS_PAGE_SIZE 256"
+.LASF921:
+	.string	"STR_HELPER(x) #x"
+.LASF1144:
+	.string	"__uint8_t"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1179:
+	.string	"frameSize"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1101:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1057:
+	.string	"MSP_COMP_GPS 107"
+.LASF1097:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1081:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF970:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF933:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF917:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF767:
+	.string	"GYRO "
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF1123:
+	.string	"MSP_SET_4WAY_IF 245"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF961:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF710:
+	.string	"USE_PWM "
+.LASF1022:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1121:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1133:
+	.string	"DATAFLASH_STREAM_DEFAULT_WINDOW 16"
+.LASF1169:
+	.string	"mspPacket_s"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1089:
+	.string	"MSP_SET_HEADING 211"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF912:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1094:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1190:
+	.string	"flashfsReadAbs"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF972:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF977:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1174:
+	.string	"mspStreamFnPtr"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1183:
+	.string	"address"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1218:
+	.string	"SystemCoreClock"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1037:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1018:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF1114:
+	.string	"MSP_SETTING_INFO 157"
+.LASF1202:
+	.string	"mspDataflashStreamAckCommand"
+.LASF915:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1023:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1041:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF1176:
+	.string	"active"
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1110:
+	.string	"MSP_DATAFLASH_READ_STREAM 153"
+.LASF899:
+	.string	"VERY_FAST_MATH "
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF927:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF938:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF913:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1099:
+	.string	"MSP_SET_GPS_CONFIG 223"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1126:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF794:
+	.string	"USE_PWM"
+.LASF1001:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF1072:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1149:
+	.string	"__uint32_t"
+.LASF1213:
+	.string	"dataLengthPtr"
+.LASF1056:
+	.string	"MSP_RAW_GPS 106"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF1103:
+	.string	"MSP_RESERVE_2 252"
+.LASF926:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF955:
+	.string	"FLASHFS_ERASE_POOL_SECTORS 4"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF998:
+	.string	"MSP_MIXER_CONFIG 42"
+.LASF898:
+	.string	"FAST_MATH "
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF942:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF946:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1157:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1191:
+	.string	"sbufPtr"
+.LASF1129:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1019:
+	.string	"MSP_RX_MAP 64"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF997:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF30:
+	.string	"_LP64 1"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1055:
+	.string	"MSP_RC 105"
+.LASF987:
+	.string	"MSP_SET_NAME 11"
+.LASF1208:
+	.string	"frame"
+.LASF469:
+	.string	"__PMT"
+.LASF1070:
+	.string	"MSP_MOTOR_3D_CONFIG 124"
+.LASF1004:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF1137:
+	.string	"DATAFLASH_STREAM_ACK_RESEND (1 << 0)"
+.LASF1106:
+	.string	"MSP_RESERVE_3 255"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF906:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF393:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF902:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF365:
+	.string	"__k8 1"
+.LASF967:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF1082:
+	.string	"MSP_SET_PID 202"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1141:
+	.string	"unsigned int"
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF993:
+	.string	"MSP_SET_FEATURE_CONFIG 37"
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF960:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1046:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF973:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF957:
+	.string	"API_VERSION_MAJOR 1"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF947:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF931:
+	.string	"BIT(x) (1 << (x))"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF1108:
+	.string	"MSP_TASK_LATENCY 151"
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1020:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1026:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF515:
+	.string	"__wur "
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1185:
+	.string	"lastAckAt"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1044:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF399:
+	.string	"false 0"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1015:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1211:
+	.string	"offset"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF765:
+	.string	"ACC "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1007:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF1051:
+	.string	"MSP_STATUS 101"
+.LASF896:
+	.string	"sq(x) ((x)*(x))"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1013:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1061:
+	.string	"MSP_RC_TUNING 111"
+.LASF1095:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF1119:
+	.string	"MSP_ACC_TRIM 240"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1027:
+	.string	"MSP_RXFAIL_CONFIG 77"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF1122:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF1033:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF769:
+	.string	"MAG "
+.LASF1012:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF996:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1025:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF749:
+	.string	"USE_NAV "
+.LASF1039:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF1151:
+	.string	"char"
+.LASF1085:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1120:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF1138:
+	.string	"DATAFLASH_STREAM_ACK_ABORT (1 << 1)"
+.LASF721:
+	.string	"LED_STRIP "
+.LASF783:
+	.string	"USE_UART7 "
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF964:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF1003:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1032:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"BLACKBOX "
+.LASF1205:
+	.string	"mspPostProcessFn"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1029:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF1016:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF909:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF1215:
+	.string	"dataLength"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF914:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1164:
+	.string	"MSP_RESULT_ERROR"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1054:
+	.string	"MSP_MOTOR 104"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF818:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF771:
+	.string	"BARO "
+.LASF390:
+	.string	"SITL 1"
+.LASF935:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF1131:
+	.string	"DATAFLASH_STREAM_FRAME_INFO_SIZE 12"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1184:
+	.string	"length"
+.LASF1155:
+	.string	"uint16_t"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1142:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1038:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF1186:
+	.string	"resendAt"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF1042:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF819:
+	.string	"USE_SPI"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF857:
+	.string	"__size_t "
+.LASF1048:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF728:
+	.string	"CMS "
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1217:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1195:
+	.string	"sbufWriteU16"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF879:
+	.string	"__need_NULL"
+.LASF1198:
+	.string	"sbufReadU8"
+.LASF1117:
+	.string	"MSP_GPSSVINFO 164"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF1096:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1145:
+	.string	"__int16_t"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF709:
+	.string	"USE_PPM "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1088:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1192:
+	.string	"sbufAdvance"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1168:
+	.string	"sbuf_s"
+.LASF1159:
+	.string	"sbuf_t"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF968:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1021:
+	.string	"MSP_REBOOT 68"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF856:
+	.string	"_SIZET_ "
+.LASF956:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF748:
+	.string	"GPS "
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF1060:
+	.string	"MSP_ANALOG 110"
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF1196:
+	.string	"sbufWriteU32"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1125:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1002:
+	.string	"MSP_LED_COLORS 46"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1045:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF1207:
+	.string	"port"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1199:
+	.string	"sbufReadU16"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF1146:
+	.string	"short int"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1175:
+	.string	"dataflashStream_s"
+.LASF1188:
+	.string	"dataflashStream_t"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF1212:
+	.string	"frameStart"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF908:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1152:
+	.string	"int16_t"
+.LASF941:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1216:
+	.string	"cmp32"
+.LASF1063:
+	.string	"MSP_BOXNAMES 116"
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1116:
+	.string	"MSP_UID 160"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF1102:
+	.string	"MSP_RESERVE_1 251"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1034:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1204:
+	.string	"mspDataflashReadStreamCommand"
+.LASF1076:
+	.string	"MSP_BATTERY_STATE 130"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1086:
+	.string	"MSP_RESET_CONF 208"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF983:
+	.string	"MSP_FC_VERSION 3"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF979:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF930:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1162:
+	.string	"WAS_EVER_ARMED"
+.LASF706:
+	.string	"USE_CLI "
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF1005:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1130:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF1006:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF923:
+	.string	"EXPAND_I(x) x"
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF934:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1201:
+	.string	"sbufBytesRemaining"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF903:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1160:
+	.string	"timeMs_t"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF1140:
+	.string	"short unsigned int"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF994:
+	.string	"MSP_BOARD_ALIGNMENT_CONFIG 38"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1104:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1080:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF1156:
+	.string	"uint32_t"
+.LASF1136:
+	.string	"DATAFLASH_STREAM_FLAG_TRIM_BLANK (1 << 0)"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF944:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1017:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF900:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF974:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF383:
+	.string	"unix 1"
+.LASF1158:
+	.string	"float"
+.LASF950:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1194:
+	.string	"sbufWriteU8"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1067:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF379:
+	.string	"__linux__ 1"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1064:
+	.string	"MSP_PIDNAMES 117"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1200:
+	.string	"sbufReadU32"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF904:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1148:
+	.string	"__int32_t"
+.LASF1210:
+	.string	"serializeDataflashStreamFrame"
+.LASF1087:
+	.string	"MSP_SET_WP 209"
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF1193:
+	.string	"mspSerialStreamStart"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF924:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1035:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF976:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF1068:
+	.string	"MSP_NAV_STATUS 121"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF378:
+	.string	"__linux 1"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF939:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1214:
+	.string	"data"
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1014:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1115:
+	.string	"MSP_SET_SETTING 158"
+.LASF1065:
+	.string	"MSP_WP 118"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF929:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1239:
+	.string	"streambuf.h"
+.LASF1258:
+	.string	"long-double.h"
+.LASF1264:
+	.string	"platform.h"
+.LASF1224:
+	.string	"src/main/drivers"
+.LASF0:
+	.string	"./src/main/msp/msp_dataflash.c"
+.LASF1252:
+	.string	"libc-header-start.h"
+.LASF1233:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1226:
+	.string	"src/main/io"
+.LASF1237:
+	.string	"stdint-intn.h"
+.LASF1248:
+	.string	"target.h"
+.LASF1240:
+	.string	"time.h"
+.LASF1232:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1235:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1259:
+	.string	"stubs.h"
+.LASF1228:
+	.string	"src/main/target/SITL"
+.LASF1246:
+	.string	"msp_serial.h"
+.LASF1256:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1243:
+	.string	"msp_dataflash.c"
+.LASF1231:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1268:
+	.string	"msp_dataflash.h"
+.LASF1254:
+	.string	"features-time64.h"
+.LASF1236:
+	.string	"types.h"
+.LASF1241:
+	.string	"runtime_config.h"
+.LASF1250:
+	.string	"stdbool.h"
+.LASF1234:
+	.string	"/usr/include"
+.LASF1267:
+	.string	"common_fc_post.h"
+.LASF1253:
+	.string	"features.h"
+.LASF1261:
+	.string	"typesizes.h"
+.LASF1223:
+	.string	"src/main/common"
+.LASF1262:
+	.string	"time64.h"
+.LASF1238:
+	.string	"stdint-uintn.h"
+.LASF1229:
+	.string	"src/main/target"
+.LASF1247:
+	.string	"utils.h"
+.LASF1265:
+	.string	"common_fc_pre.h"
+.LASF1230:
+	.string	"src/main"
+.LASF1245:
+	.string	"flashfs.h"
+.LASF1263:
+	.string	"wchar.h"
+.LASF1225:
+	.string	"src/main/fc"
+.LASF1244:
+	.string	"maths.h"
+.LASF1242:
+	.string	"msp.h"
+.LASF1227:
+	.string	"src/main/msp"
+.LASF1257:
+	.string	"cdefs.h"
+.LASF1251:
+	.string	"stdint.h"
+.LASF1266:
+	.string	"stddef.h"
+.LASF1260:
+	.string	"stubs-64.h"
+.LASF1269:
+	.string	"msp_protocol.h"
+.LASF1255:
+	.string	"wordsize.h"
+.LASF1249:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"=\004"
+	.string	"\344\004\375"
+	.string	"\007"
+	.string	"\213\366\364\257\013"
+	.string	"\001\330\326\362\344\016\"\002"
+	.string	"\002\001\002\003\002\001\004\002\001\002\003\002\005\001\376\352\242\202\002\016\002\002\001\002\006\003\240\342\234\212\n\005\330\273\257\317\002&\001\004\007\002\007\006\263\316\225\265\007\020\003\004\007\240\342\234\212\n"
+	.string	"\031"
+	.string	"7\267\200\2716Sp+\002C\021\260\302\001\344\001\033P\334\025<\366\030`\016\367\347\253F\330 \204*p/\310\003\362Vl"
+	.string	"\002/\004n\336\330\365"
+	.ascii	"\026\203\001\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\375\003"
+	.string	"D\003U\001"
+	.string	"\005"
+	.string	"\005\001\002\001\200\004\001\001"
+	.string	"\003"
+	.string	"\002\002"
+	.string	"\b"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\001\001\200\f"
+	.string	""
+	.string	"\b\005\003"
+	.string	"\003\001\001\201\006\001\003\001\f"
+	.string	""
+	.string	"\b"
+	.string	"\037"
+	.string	"*\033`\334\325\024\203\350\206\tL\325\201h\302T\315"
+	.ascii	"2\004\3442p\207\b \"\3030 L{.\004`H8\312\202\252\016\030\352"
+	.ascii	"!\253\205#\f0\024\007\236\343r\024@\200\215b\317\263q\315\205"
+	.ascii	"ob\201iq\001\206"
+	.text
+	.section	.gnu.lto_.inline.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\225\001\025\t"
+	.string	"\002\316.1PO\222\016Px\234S\312\r\004\003C\307G\246\007\333\034@\214pu\f\350\265\274\032\310Z\253?\302pJ\314\270\202\271\231%\312\003\244\021\322\210\334)'\325~\352\310\207\211\307\240{\240\200X\bnn\347\334u\n\235\020Q\321\310\335nj\005\207D\"\341\201\027Z\022\372lD\021\373\245f?AR\352Cf\232\324L\327\211Y'\234\016\350\317\254\277\230\257_\200\3756\277M\325\036\2630ZbDA\177\327\314<\035\326EFGu\347\002\364\027\363E*d\341\"\375\264\252\024\317\013\002k\236g\303\342\240X\321\034\234\377\213\375\003\326\227\241\020\002BH}?\247\025\002!l\317\256&(  B\345\214\335\003\354"
+	.string	"\034\304\315\205\2010"
+	.string	"~\347/1\263b-TM \016,\256\216\316 \310F\266\254\020@\002}~\221V\361G\035\320'\263\b\006\367\022\300\217\003\256\271\022$\016\005 \0248\332"
+	.string	"\374vcx\300\037\374\006\232\033\020b\n"
+	.ascii	"\371\243fK!\003\226\351*\316\234i\311\233\203\025`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\203\002]\006"
+	.string	"\362\007\026\034\260%\351\f\243\034\300a\230s\252\356 IH\256"
+	.string	"V\202%\250\331\3266\331[&\031\334\264\3726\347\204\231\022\203\237J\253\355a\374\260N\306\203!\367Rp\016r\215E\317\324\b|[\3229_Q\245G\377\235\330'\326Y0J\344\265\f\274\fs^\025\240\367YH\2041 `\302r\326\003p\362\017\030\3243pW\024\032\316Ho+\244\312#\f\242\333\b\242\r\370\214CP\204\300\356sf\202\031\264s\b\017\313vd|\0033\222(]\340C\003\253\303\357\2105#\257B\333\201\026\334j\004C\001\207\f\033u\325\201}\211\300\001\321\024\024\200\006\320\212\276.@\005\314\367\305\362\242\263"
+	.ascii	"\361\210\017\013/\206@\273\302\r\001"
+	.text
+	.section	.gnu.lto_.pureconst.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\001\232\004\002\232\004\005\232\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375 \206u\002"
+	.string	"R\004\r\030\300%\303\030\377\357\276\252^\240\377\377\177\347\332n\001\264[#dK\231\002W\231"
+	.string	"\177\236\245\204U\340\360(6F\206\252djV\203\025Y\t6\226M\211\205\t"
+	.string	"W8\3202\267\253\030(\341w\267"
+	.ascii	"*RvC\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.2dc07d482d3bacd8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serializeDataflashStreamFrame.7.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`Y\007%*"
+	.string	"\252K0\020Fp\336M:w\301\016\364E.\031xx-\037\034\256/\256\026b\373ACh\241\341.t\346\366\030\223S\032\262\356"
+	.string	"/\375\366h\212\305\217Y\n`\336I\311\b\272\373,J\037\321\334\250\342\177\266f\t!\204\310\235d\360"
+	.string	"\333"
+	.string	"\365"
+	.ascii	"\237r\264Sy\225_\271\226\267\361NG\205M\354\305\226\247cy\226"
+	.ascii	"\365k\303\237\221w\215?\306\216\374\252?\177&\031+*\266\212Q"
+	.ascii	"\340\260X\243\226vB\375\251\203K\2732/\016\3365\226a9\002\342"
+	.ascii	">1\237]\375\036g\344\266~x\351\240\376\334m=1\233a\251wME\226"
+	.ascii	"}\201s\257\022\370\223/\260N\354\251\225\227\262\236\f\313\362"
+	.ascii	"\256\261\b\243\202\372\223guH\236n\231\017\345b\353\307Z"
+	.string	"<\350^ l\326\356U\"\340&\365'+?\204\376T/\204\376\344\225\331\315\225Bn\372\003\f9\345\316\275\327\251\203p/\2277\225g\323\256GO\263S\273\362\323\007I\256\254\243;\256\242=\315&C{k \366\344\313\2055uHj\274\325\032O\201\270\216\346\357\336\373\266\333-.\244\265\351\203{/\333$\027\215\263zf\226\301\3141\230\323\004\001\035\376\305\203\027\263\233\324\214i\235\3559\352\263\375\247e\363p\367\373\250m\232c\222\242]\262\355\356#\343\230?\374\rK\275\367.\340\273\235K\220O\344'K\t\355\223?\371\302v\3605f\324\357n\203\214\323\262KF\361\3303;g\256\315\303\254\314\262\355\325fJ\223-\334@\230s\226\243R\313PL\300\237\235\227\236v6p\265\263\322\307\376\244\257\235\221\316v>:\331o\344\273\331\271\327\226\213T\313\003R\313D>\226\207v\226\005\264e\241\234\345"
+	.string	"\252\345\240\234e^\3162\200\235e \235\345\037\235e\237\234\345][\326\265\345\\[VS\313ij\031M-\237\251e3\265\334\252e\233Z\276\202t\214\031\243\267{e,\365\3342'\233\221\233\375g\177\332\257\366\257\375lG\231\037j'\22407\315\324+\302\212\244\300\356\365\026\204\266\337\007ZX?\3202\357\275\327l/ff\352\345\362Xh\257\231\332\3569\366"
+	.ascii	"B\023k*<\200t\351\366\342\177\301\0310C\322#4J=S\266\306h\361"
+	.ascii	"\360\177\204\356:\252\331\"q\024\355\322\311\327\254`jvM\340"
+	.ascii	"k\f\f\3307\3235\260\017\207\214+`\241z\251\221\232y\025[\243"
+	.ascii	"\330'u}\325ud\262\324?[j\026]\306$I\326\236\335P\b\021|\030\350"
+	.ascii	"\247\031\350\353\3502\356\310Au\256\337\366\0342\256\241\232"
+	.ascii	"mRN\212\203\200E\232@!\275\321\263j[\300`\237\344\237\213\316"
+	.ascii	"b\243V\321l(\365\325\210lR3k\330`\237T\352\333\3502v\026[4\256"
+	.ascii	"oA\241B=\336\3129t\241\335\235vR\232#\235\243>\033m_\232\343"
+	.ascii	"\021\016\027\023\346\354c\371Z\"\365\327\376\3232\033\251G1D"
+	.ascii	"\341\220\212\252\n\035\016\205VSS\301\264\004J\264\n\0223\bM"
+	.ascii	"\004\255\250tV\304\013?\346\b\242\210\023\302\n\272\024\302a"
+	.ascii	"3\003\005RQTA\252\250\246\036q8\325,\3254b\030,A\025$\006\247"
+	.ascii	">\240\030\232p:A\"h\302I\312j\350\324\224\304U(\204VN\304\252"
+	.ascii	"*+\247\235\362\376\3545\233\346\335|EX\021\013l_oI SF\253\213"
+	.ascii	"\334\263E\003\272\250\021\034\260D\255\324\3003\257JV&\366\311"
+	.ascii	"\001\375;v\026\0175Q\333=\3108\245\026\320C]\004wlR\264K\001"
+	.ascii	"\3759a\204\332\327B^\0024\277\316\237\224\023\324\001T_\007\265"
+	.ascii	"\205;\306\025\337x\315\217\263&Y\301\206\204<)\307\327\274\266"
+	.ascii	"p:47\237\033\332^\313\257`(\200~\\\231\032~\234\020+\030\021"
+	.ascii	"\376\025\372\023@\177+\307O/5P\377\270d\275\020\352\323?\375"
+	.ascii	"^\373\364w\360xs4l\310\002\200\230\250a0\306\030CF\206FDD\323"
+	.ascii	"$\255\001\200\002\031)+z\020@\251H\223$\215\001\220\b\037\373"
+	.ascii	"\360i\344*\034\032\373\317i\304\345\330\002\bALP\265W6[\305\202"
+	.ascii	"3\376\367\327\222P\005\212\244\363\222n\007\262)\227L\021-}\215"
+	.ascii	"\006\243,\325\252\360\0031\265\026\376*\253\360H\376\032V\351"
+	.ascii	"j+l-k\365\300:\334b\244}\202\312b\345\2001S\037\257\365\3123"
+	.ascii	"6\200_\016\207\t\267\305j\263\253\235\302\342\370\035r\261\323"
+	.ascii	"\305\243\233\310\004\226\316L\020\243e~\305\266_\205=\340\302"
+	.ascii	"w\f)\312\264Pt\341\210\f\205\377]\3129\345U\030}\340\n\344\027"
+	.ascii	"\205e\275\023h\341\307&\261\206^\202\241\366\021?b\\\315K\300"
+	.ascii	"\007m\n\242\257\313\273\326\312\025p\243\024S\002i\225\335(\334"
+	.ascii	"f\243\002\331\003\021\275\243q808J\365\003\034\270\232\237\001"
+	.ascii	"\254\232C\250y\203!y\203\206\032\314\3310K\273\035^p\304~Y\200"
+	.ascii	"5\215\352\253u\317\260|\r\255\013uv\250~ |\3151\350\300\327\324"
+	.ascii	"  H\352\215t\370\226\220\222\231\266\307X\224\355=5"
+	.text
+	.section	.gnu.lto_mspDataflashStreamNext.8.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`k\b\215-"
+	.string	"\nP\224\021Gp\\N:\033V\027\332\037/\233`)\200\001w\fI\213\210\375\212\001\214\324\272\320:1\t\365_\373\270t\362\317\363S\004\274P\342o\302\r\211+\213\203m\205.\340\217\031q@i\337\240\231\266D\2324B\210\334I\006\006\001\356"
+	.string	"\020\001P\332\266e\325\252\030Q\253rD\245\036MC\303\nn1[%\207/*P\346\330 N\350}Z\326\321\260Nf\253\fjF9~\231;\312\030~\226\305\314\036=3\013~\223\331\225\207\323\315T\250Z]\252\025\243\035\234\266e\0328\312\025\324U\351t/\363\313.\205\305\231+\016\324\266`sZ\332\226y\200\231\324\243\314T\231\231\377\344PX0\361d\212)Y#\035\362l\256m\333\246\340\207\322\243\347\203\322\243=\344\304\373\374z|\354\332Sy)z\366%\362\265\356\303\343j\362[\366\274\370u\337\t\004\373\242\373[W\2173(\246\f\362\354\271\264c@\222.\036w\035"
+	.string	"\204\206\216\367\316\243e\233\215\244$]9\256\372\326\245\343I\272\274.o\345r\021\007\b\215\257\247H\224\353\374)\267X\345\361\366\271\264l\263\301*\215\347\220\231 m\336\374\225\241<\336\313s\320\266-\337\244\222\306\371\347\314/b\346*f\336\227\277\200\264{\251\371\"\275\214\367\216\371\\\336E\003\277\bo\350\320\241\235\340\274\212\367\356\227\215\216\231\037\315W\351\033\252\031\267u\353\230\331\303\331\256\324\266m\023\360\263\\\313\007~\221\243\fbx\237\034\246G\337Hpe\305{\3077\315\356\r\3307{\260x\355\370w\231E\214\270O\002\033\313\207\261\265\370\315g\220BF'\327^;f\246\361v\030\363\317\266\301\230y\227\227\326\313Jg\376\004z\227\2037;\003\371\362\221z\331H\275\034`\275\\\244^&Z/\017\261\227\205\326\313A\353e"
+	.string	"\352e\240\365\362\017\357\262\317z\371\267^\356Y/\373\324\313l\357\362\332\273\334S/\253\275\313\274\336\345T\275\214\252\227O\336\345N/\337\300\020\232%\217 u\275\206\331\316\270\273\323\226A\267\034\271\331\371g\277\302\314r\326\247\360\251\334J\267\260A\266\f?}d\036\b\237\323\240\332\361\351s\201+\353i_\377\372Ls$;\273\247S7l\373:\305\230\0332\017\3136\332P\3151t\346\260K\326\265\345\236\342tI\312\275\356O)\260\327F\317\216K\343\327\333\331o\204Hbn\326\222r>\265\036IqB\300z\021R\245\356:M\267\255[\367\264\277\371\303\360\301\306\244\203S\274v\034l\245\346\321A\346\3515\260\203m\264v$\373\225\243n@\254\3748\320\352b \221\323\353\253=XL{\260\310\022\036\367\004\327\353O\031+c\316"
+	.string	"\363\242v\030\253}N\370\032\241\252Fm\2441\265\034l\246\006\230\027/\004[\027\235\334\267\034\315\025\222\330\231\002bs\326\256\267\366\332\365\262\215\030\270\264\210\311\237R^K5\311\244\rl^\337\263#\231\221\302\313<\271\245\335S\336\321\325\310Ad\007\332a\214\366\331RM7\013\037\323\206\266\0028\276\3600B0g\363\220\3349\271\2331\n\226S@\272\324o~\025\022Pg\022LW&J\240\300j:A55E\025u4|\026\325\211\346\005\b\242\234\244\206RNLF\"\246\206VR(G1\221\270\032\232\220\032\242\030\206"
+	.string	"Qu5\325t\242\304p\252)\312\352\252\211\t\310TU\"\254\232PPQY5\261\314\342\317\266\301\270\312\213\214\337OL\205h>>1}\363=\037l\313\224xbz\324/\230\371\250\331A\261\215>W-\216Q\317\020\022\211\311\370\205i\2006\352Ns\\\032_\bo2@\023\215\225\265)\335\242>BDr\237\344 Wk1Q\027\365\201\t\027y\217D\335"
+	.string	"N\314\233\216\013Sf\242\222k\024\366\b\211\315\001\343#V\007\317o\250\203\032*\351\n53\221\t\321\311}r\250\203[\255\305|\333\022>6If\342\223\337\021\243\344!6!JI\022k\333\366EV\244G\205\372k\311\033\347.)\200\016jt\355\270\004j"
+	.string	"\017nW\007\324\f\330\200D\332\216\364t\330\231-\316\310\016\337O\377|:\200\242\250A8\005\231bHff\202\202\302\302$\215\001\240\002\021!3z\0200\207\210hR\2505\223\363%\355B\377|\350i\217\254\371\225\013\003\264aZ9;\362\305*\311\243\214\b\255j/\037~s\247\"(7X\253\331\256yF\314\244i\322\216\223\353\007\272[\003A\220\270y\260\3206$\201i\"{\016\207*&^\313CQ\344\210\260D\312\036U\235+\266&\225\362\230q\275\"\267\313\20217h\337\200M\225B} \025tg+\226j\363,c\213\n\221\240\243<|@\324\337|J"
+	.ascii	"\r\275zp\001\240L^\031\264!3\016\203\367a0\352E\303\274\020*"
+	.ascii	"\023:\274#\307\252\325\234\221\360g\025\330\3359UV\262\277\345"
+	.ascii	"\2629.\366\361W\b\0053H\211\254)\026\256\3705\272\3370\032\034"
+	.ascii	"&qH\211\304&7q\322\005\001\344[Eu\242.\016$\350\202\t\352\363"
+	.ascii	"\330\367\0325\362)I\t\377vI\212\004q=\t\030\205\340I\020!\324"
+	.ascii	"\250\231BE6\304\345s\003w\332)\230\031\201\352>\321\341\264E"
+	.ascii	"J\3704r\311\307\256\302riY\f\332\230A\342o\204q\327\033{\033"
+	.ascii	"=K\035\353\310\002G\240\247\022\251\232]\r"
+	.text
+	.section	.gnu.lto_mspDataflashStreamStart.9.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"}\b"
+	.string	"F\320<90\3456\035\340~s\f\034\331Z\325\244r\336|\220N\313\316\244\200\217\303\001\372\033s\b\260\021@q\341\230\204\211He,\003l\232\033\242Bi\352!\264\372~jd\357\224\002)"
+	.string	"."
+	.string	"*"
+	.string	"\247\f\3320\257#\253\t\225|\244\310\354.\235\"\007/A\377(\337\210\240\360R\343\260\273\226\"(\344\236\267\215`\033\302\266(S@\251%\341e\027$@iG\024\013\211\355s\354M\314\302\245}\223\237\200\027q\\`w\234Y\331\255\n\276\254S\256'\250NY\037\250\002"
+	.string	"F\237\331\341J\276bdX\273\237\213r\332\032\033\362\242\017<fh\251BrYI\262k(g\310\376\264\273\3539\332\027\3752n`\310:\032\246u\256\202\257\333\270\311\331E\341a\026\032\366a\022\021\234\347\241\027\025\230\207f\235G/\003o\334DG\277m\353(\247\356\247\235\243\037\002\t"
+	.ascii	"svxgX\306\236\360Y3\316\352\270\f\375\255F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_mspDataflashReadStreamCommand.10.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\314\013\245:"
+	.string	"\232g\314\026BP\244N\007\003\377\302+e\243\\\210\003Rt\n\376\b\247\374YA(\352G\005\216\340H\324\326\351\006"
+	.string	"\023\203w$"
+	.string	"\"\004A4S@\324)\206\\\245\354\"@\266\335\264-Y\332\264\2447\331)\245\024^\001=\001_\001M\272K\267]7\230n\274n\275n2\255273\203q{\351/}\327y=\246\367\230]\341\310h\335\215\341\001\332\230\323\333B\212\035\257\0304/\256\307\260@\205i1`\215\267\034^\275\241\223\013\232\031\303\016\036}\375\002\306\013\031v\274M\2774q]e\240\240\244\300\332\316kx\343\204`\374\324"
+	.string	"\336K\227\345\006\252\273|\r\303\314\206^\374\346"
+	.ascii	"\336{\033t\220\223\303u\r\352\267\304\240\022\342L\313\214\243"
+	.ascii	"\343\025\253\243\341a\330\301u\f\312\235\271\261t\026\260\246"
+	.ascii	"\233\321E\367\276\325\321\273\227\316\001;\r;\310tCf\346\256"
+	.ascii	"\322V\300\270M\351\340\316\204P;'\227?\367\336'd\033\251\035"
+	.ascii	"L;\200\332\3017\322m\023\031\207\212,q\035\n\325`\372\336r\207"
+	.ascii	"5\321^op\302\351\031\202\326\326F\266\036Zc\363\242\360\302\020"
+	.ascii	"\264 \315\246L\200c\372t\237Y\220\324(\007\223g\357u\00293 N"
+	.ascii	"L0\004\355G\257?\206}fj)\362\336\333rf>\\\350T\233\331\326\301"
+	.ascii	"T\351\255\r\220\361\214,E\256y\343L\323\250(4\304\030\317\304"
+	.ascii	"R\366\213\2379\366l\314?ebc\243\303x\326L\215\340\020\261\323"
+	.ascii	"{\355egc\356\302\013\367^\366\347\031Z\363\261\231\373\310\314"
+	.ascii	"i\314,Rm\367"
+	.string	"\340\277\2408}\2039\320\341\203\367\323\351c\3145}\343\035\211\030\341\375lz/'L\337zL\237\242m\351\233L#\231.\210\215J\230\360~.=\230\337\255\365\265\023\332\267\247>\264\377J\236\032S\202H\352\204\357\275f\361\324\321\351FR\375'<\273S\255\351Q\346F\323i\224\334J\370\004\n\357'\212o1\177jL\217\272\016\27749i\fu\301;\225\272?1\017\324>\206\017\034!\377Pf\233\315\250\375*\352\370\304<\020\037]\3013'\253\274\237\375\021\334\304>\214{\257I\244q\003\024x]\0203]\230?\224\271\323{\357\345\177c\246\022:W :O\230\222\352.\315QM\327\r\325v\315\017\032L\263SS\353535\231\346\245\336\322\275\240\265t+\030rF\n\235\225\3309\251\361\232\221Vg\004D\347\003\253\263\001\242s\201\325\371\250\350L`u\036Pt6b\235\005\260\316\001Xg"
+	.string	"\254sQ\321\371\310:\023\261\316F\326y\210\350\\d\235Y\326\231\310:\257\254\363\220u\026\256\316\352\352\034d\235S\242\263\257\316\r\302\313\354\217\236\246\274{sD\007\3357A2\001\375\fd\376\361S.\316B\3047>\321\013\371\310\250\020E\243\321ho\251Co|\225\017\031\033\325\023\177\350\203f\310\330\232\204\246\346\372\317\322\217\322\237\232 $\224\346\263\307B\017@\266+jL\217\032\037\352C\377\306Ndz\025\\\3628\363\330\n\257\364e\355\245:}\007\326\321\001\324W|\346VJ\353Q\002>\3373\220\331J\365\301\027?\345s\2525\343"
+	.ascii	"\005v\267UT\346vJ\333i\253\f\200\273\367Nq\323\351:\355\025n"
+	.ascii	"%\035\3446\013\006\fj\007\223\340\366\bp\343\006(\220\n\311d"
+	.ascii	"\237\352\333\217l\317G\243\275\244\022\237\375 !2\271\251'\376"
+	.ascii	"\373\235\036%\nnL\027\224\026\037\272~\205?2\263~w\271s\363\246"
+	.ascii	"\371am\364\027\005\013\373Pn%|LV\251\3579kp\f\233\036\351\313"
+	.ascii	"\230~\370E$u|K/\374\341\007\375\310\342\232\036\025\376\227["
+	.ascii	"\323\315T/U\244\237\352\323\364(\361.\r\322_`\022\245\244\336"
+	.ascii	"\371\270xg\006B\0304}\326\207F\275\372\335W\327\246\351\325O"
+	.ascii	"\3578\0131=\332\thTy\033\366"
+	.string	"Rmz\025u\177~\267\027\365\335\345E\360\243\276\t\221\261\035\035*8\206\265\230\365\261\023.}\372*\352\330$9s\206\r\336\317\364K\2705\247<\370\313\245\222\313\312*)d\321\265\"K\351B\275Z\277\264\254\262Z|\251\313\025I\027WA\245\214\026#\224XI.\r0\222X\305,\r\313\245\262J\213+D\327R+\304\213%\326\261\212k\371<A\252*\352*y\025\345T\240ki\365\\\345\304b\231tq\225\354JZ\245x\261\304z\312j\221\304z\252\342Z>9)\261\326\013%\327S\227\226\026\327\023Kw;\275\377\306B'\2343\317\330\335\252\275\327\034\306\356\234y\301\266[5)\351\371\002\363\233D\017e\037:\266Rm@7xE\247G~\031\263\343\215i\307Z'\2029\3672\373\311}\246\225kk\370\234{o+qBO\036V\020\034x\004R\334H\221\003Q*\270\201\033m\216\002o"
+	.string	"\212\023Q\016)\360\013\376\236\034\021\370#'\336\306F@N\202\017Hkw\030\375\200w0\347@\226?\214\236\301\2218\001=\266\206<\004\374\212\305\310\346\001\036\312G\013\304\373\311\310\261\017\343\264\255!Z\200_\2610\327"
+	.ascii	"\254\271Y+\304s\360\t\324\255\020\265\350\001\274\020\317GQ\233"
+	.ascii	"\333h\205x\031\241g\240\2233\267\320\326\210\367\263\350;\315"
+	.ascii	"\255\211\327\203\352\210\323\330r&\035Q\333\301\334&\361\261"
+	.ascii	"-\261\244?\265\264%\316\3640%8\274\263\2768\315\3346\351h\241"
+	.ascii	"\2449{\230\321\243\223\036$(\200\344\2501L&\235\"C\"\"R\220\024"
+	.ascii	"$\205\016\320\002\021!#u\0208\210fhR\322\034\253\242\376P\204"
+	.ascii	">\245\267\242\360W\266\277M\"\331\033R\370-\2561\234\222\362"
+	.ascii	"\035[\235};}\376\263\274\335\351)^\221\365\351wOU9k\f\234\324"
+	.ascii	"\216W\362NA\030\026\374V\264 \376\242\026-\026\234\371;\373b"
+	.ascii	"\246\310W\316\030t\t\344,X\"\363\202\351:\255\025\023]\251t\005"
+	.ascii	"\nh\013\004-\252\2165\253xCa\254\374\f\351\345\275\357\330\310"
+	.ascii	"\317\366\276\2649^r\335m#M=\323\211\036\237\241>u1\026\030\215"
+	.ascii	"\337\361}m\366\335\b\022\314\007\033m\366\277s\310\333\301\314"
+	.ascii	"6\0165\006\263\336C;jpx!J\005\312\276'\275\2448\202\035\207\027"
+	.ascii	"\001\206mr\240^3\315%\026U\233\336A\244\230\313`K\027\246\204"
+	.ascii	"\f\035\270x\272>\211f\323!Q\032\355e\006]\3538R\227\234\233 "
+	.ascii	"a rAl\331s\342&\255\017]l/`o+\257\245B\252\326Y\021\017\316~"
+	.ascii	"L\022\2701!\bq4\227\371LK\020\375\225\023\314\206@ \345\205\f"
+	.ascii	"\210\3018(\243IK\212\226\253B9\214=\313b\361\327\327\202\007"
+	.ascii	"#(\240\363\363\354gv,\262YMN\304,\374\267\250\314:\200\240\340"
+	.ascii	"\315\004\210\n\231\017\223g\272\212\236\016;\337\370\216\256"
+	.ascii	"\240\262]:#\034xo\033Q\270\257\342\365\n\004\022\213@\217Ck\232"
+	.ascii	"\222]V7\024m\332\330xq\"2\026\361A\252\225\013a\242C9\241\006"
+	.text
+	.section	.gnu.lto_mspDataflashStreamAckCommand.11.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\366\004\315\036"
+	.string	"6\267\303H\220XN:\200C`^\213\005\320#\270f\340\350S\315\\\377\306FOjP\250\353\320<\334\264"
+	.string	"T\302\307\306~\027{\222\241\215\255*\023@8\316\200\027 6i\240\217N/+]\007\250\316OXm\333&\204\020)\223\f\256"
+	.string	"\244"
+	.string	"\261"
+	.ascii	"fN\316\324Zl\360r?P*\026\304\274\373\255s5\275H\343:\265Z\235"
+	.ascii	"\205\325Z|\260@\364\345\026\351\356\356\237\034J\323\372\310"
+	.ascii	"\"Qx^\035\001NY\253\265\356~\316c\276$\277c\276\354\253\373\236"
+	.ascii	"\203"
+	.string	"\223\303\335\350i\226d\263o\357\364\034\0038S9\252 \214\003\302\267\377\204\234\226IM\221?ZR?\370|\021\035S7uB \371Sk\315\top\211\023\3668I28\203e\215Nh\203\344\311\221\025\314\t\241\270\311\0138\264\310\350\204O\344\322\025\252{\335\200\226\224\020\346\023C\255u9(\324\361\325}w\313vwh\227\\\022je:\375\256\377\374\270muE+\370A\235\236\301_i\312\326\214>\256\272\207\353\340\357\024\3061(n\2639\326\365\256\213#~\360\r\241\n\252\235\366^'\241\026\306\226V\271m\267\350\304=\334}\037\217\307\343\266\325.\345\355i^\036\312\273\363\256\257\316\213\277\256yq\313{3y\351\311{\236\274\246\311[\232\274d\311\313%\357\007\320P\262\206\306\202Y\2559\216n*Y\231%\311\273\376\335\246\275\361^\233\243a\202\244|J\323\273\226h\r\243Q\300&\"\350K"
+	.string	"\374\035\264\240 \tM\217\302D\253\222\223J\302\335\020\377\"\344C\364\202"
+	.string	"k\352\270"
+	.ascii	"lL\020Wv\0271\202\001q.[\312\276\0253[?>\356\033)2Tn=\304\242"
+	.ascii	"Mv\r\343\330n\210k\021\242bd+\300\332JbC\306\226v\366p\310\334"
+	.ascii	"\035\361,C>\304Z\353\204}\330\261\224\330#y\271&N\224\373\023"
+	.ascii	"\346\313\003D5?>.\316W\333\335\020\251\302\303\354\341\226Nz"
+	.ascii	"\317d6\0236Y$O\343:j\007\230;}\257\3232\343\031\237\311\304\365"
+	.ascii	"N/\003\247\236\370\270\374\305\206\353Gy\211\252\037\267\221"
+	.ascii	"\304R\007\005\217\037\344\351{\371\215pI"
+	.string	"]\221=\334\006\347~\226\361\214{)1\212z\335[\301{aTn\005\tD\021\214xF\021\200\004\020)\365z\211\200X\364x/\214x2x*P$\365\216v0Z\360\216vDJ\275\035P\201EJ*R\332\311@BR\332\345\212\365m\265'\260\013\020\214\356}\346\275\336\001\230\005\004c\337}\346\255\243v\367\326\213\341\327OK\326ZkN\017\321\204\b\234%0\243\003\243*@\205\006\304\241\3756\306/>\256\227\021\242f\264)`\0050K\263\221\353\341\225\367\244\275\347\307\331\273\031>F\214\330\333|\203i\366\331\247\332\215!O`;\314\336\325p\262\r>D0c\3014\037\336\345\340\201\0374\373TUO\355\2648`\001`\250a8&\tC\246F(\210\202$I\322\001\220\002\021\251\264\003\020@\251\204(\2056\320\324?tB\306\2452\177\210$\310N\361@\267\210\302\322\360]\210\333\274\345\244\322"
+	.string	"\004\371\020\276sF\024\336\264\023\241\230\263\3770&\030\002\273n\270\016\221+\0320k\345\316\"T\275\3736L\365\342\020\324\225\260\251xP\246\256\267\205\221\362x\261\f\250LBw\323\027T:\373\274\333\216\n\273\247=\246\203r!@\017"
+	.string	"7\244\251|O\204\214\307Y\224kuy\311\213\265\376C\237\232\354\235'\335{\332\224\205\344N\235\022\221\275%\242\021\245\356\020\263\301\311:\355lY\032\334(\272\337\013"
+	.ascii	"<b|\006\037\006+q\2177hXU"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\261\002\375\f"
+	.string	"&\024L@ \2518\035\301\243\032\031,\"i\266\245\032\330P\375\327\007\370\341>\023\230'\003\006F\005\317\205\230C\341\240\203\003\312\001\f\200\260"
+	.string	"!\222\310\262,\2140\036\370\357&\315\332\377.\277\335\326iK\031;"
+	.string	"<"
+	.string	"9"
+	.string	"\273\037Ngx\013lv~\034\307Q\323\227$}\0012mYt\226\371]\256\0048:?"
+	.ascii	"\033\341\200\251\301\326\023\253)"
+	.string	"\324#\221\026\224\354\366n\202\217\025<\317\363\264\256\344\356~$\365\"\177]\362Vh\221\367\2348\013IM\220\374\216\310\037\021\007$\225\305\007Q\366\024\215Mt&\321\227\210\306@t\367\320\233Cs>\275\361\264\246\241;\f\315-\264\326\351\n{\237\027\307D\336\323\227BP\315cU\233\277@+\334\346'\"7?\251\024d\346\370x\300\240\233\325\274H\274\344E`E>\204\262\310\207*\n\223\337\302L^\0235\020\223\317\262\212\005\213\205\\\241@\354\260\350i\310\f2\340+m\364\264V\364\f\362%\030\360(q\364 ~E\277\241\201\231\317\300\270\346G\342\250^\346/@k^\023r\007\301$@\233\317h39 P\203\f'\035=f\005\n\264\257L\367\275\254]0\016m\030\312\274\206^\260\241ch\217\202J\211>\364 \246\270\305C\347\202m\220\327\215s\3013\210u\326\017\344`\035\205L8\214z"
+	.ascii	"\007p\200#8\200\003\034\301\001\034\340\b\016\201\343\t\f\223"
+	.ascii	"o\227z\2660\034\226\264\320C@\262\371\262\b\270\341\b\177\306"
+	.ascii	"\b\336\0324\033\235"
+	.text
+	.section	.gnu.lto_.refs.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375 \336\275\004"
+	.string	"r\n\036'pM2\214\001\240\311\203\210<\023\021VUUUUUUU\361P\036\316\345\036S\325O\\\305\215\023c#Dn\231\002GL\037v\303\224a\2720M\330\025J\300'\317&%$#\027\221=\004\344\303\243\203ccZc\2321\265\230Z\246\r\263\251\234X\201\315\354abL/\266eWl\212-\261!\246\016S\205\215\260\017\246\005\233`\017l"
+	.string	"\346fe\360\350\324/\001\r"
+	.ascii	" 3\b\342@0\020\002\342\202(\020\007\202\201\020\020\007\202\211"
+	.ascii	"\022\271\352\227\212\002"
+	.text
+	.section	.gnu.lto_.decls.2dc07d482d3bacd8,"e",@progbits
+	.string	"(\265/\375`\371\031\315x"
+	.ascii	"z\304|+R0\220BJ\007\0162\227\257\337h\357)\376\321\270Q\330\215"
+	.ascii	"\276\371\311Y\024\360M\223\270\325\"\247\210\351\246V\272\371"
+	.ascii	"\372\277M\f\313\212\250\374\356\\<\263\234\023\025\210\255\266"
+	.ascii	",\024\b\215\t\017FH\236\365B\324\005a\272\215%Mu(\255\254\375"
+	.ascii	"\204H\231\0025\002\232\002\316\0027y\357\275\n6^#\323\372\001"
+	.ascii	"\315\302fi\225\345J6\306\005=\241\202\241\254\206\303\322\266"
+	.ascii	"\253wE\313\n\nf\205\315np\232\3414\241\243\207\233D^1\332o\202"
+	.ascii	"\313\021\024?\213\235\241\254\205\317\204\222\036nR\013I\327"
+	.ascii	"\275\355\231\314o\342\f\3452\234\226\266h7\211LCb\254mK\235\350"
+	.ascii	"\275m\211\022%\210Jp\331\2226,\"\225E\360s=\213\255g\260\225"
+	.ascii	"\321\260\032?Gp\232\324(v\301\202\362|\345\231s\262\236G\360"
+	.ascii	"\270\216G\360\316I\326\263\326zf\256\021\360re0\034\206\237$"
+	.ascii	"X\314\271\013{\371\356\330\336\266\271\350\236c\255\236\243\326"
+	.ascii	"3\t^ZW\307$x\227a\365\300!x"
+	.string	"\215\306!xoa\275\032\207\340m\351a\023wU\326\352\205\353\231\326\237\260\362\025&\343g\021c9\217\261\363=\311\366:\357m\207\226\206\220yi\365I+\020\322\271\354\005\034\257\212\177X\317E\274!.\342}]\021\340\020<\225A\360<p\225\237\2450\030\207\245\312\034\315[vo\373\241'\005\214VY\253\034\326L\205\333s\030O\371\t\025\007J^\260{[\016S\357=2' \304\234\300\356K\222\343\030O}\257o9\004oe\020<\030\033$\360\367T\001.hAa\310\372Y\006!?\037\233?C\375\034\004\353\347+\013\376\006\341\201\037\357\375\375C\022\3729\311\352\347\240\237{\217\363s\217\377n\376\313\371\277C\333\177\350\033\036\341g\033\230\3713U\003\377K\374\215\302\362?\234\377i~\026N\375,C\307\317\304\237\245~f\221\343\347\0308\376\273\375o\363\177\313\3777\032\376\233\360\363\377\213\370\317"
+	.ascii	"\337\370Yy\030/\372;\352g\344\3173\374\034\303\3175~.\376<\374"
+	.ascii	"\271\351\347\337\317J?\227\3603\t?\303\370\371\305\317\034\374"
+	.ascii	"\274\301\317.~\256\340\347\t~F\372\331\304\317\"~\006\340?\226"
+	.ascii	"\377T~>\372\031\202\237\037\370\331\201\237\007\370/\346\347"
+	.ascii	"\021?\007\3603\210\377t\376\317\371/\367?\356\177\373\237\304"
+	.ascii	"\1772\377yuuuu\177\332\365\253)~\020\273C\336\\\215\244\201\271"
+	.ascii	".V\255\366\021!-6\340\354xY\233H\027\341g\033\271*\326\274A?"
+	.ascii	"C\320\312\216\255\326\350\375\013\357sz\213\277\350\332\240\266"
+	.ascii	"\264\276\310\310\001\331\241\202\226\0333Y}c\335\241\346*\247"
+	.ascii	"\254\177\377\274{w\354\332\273D\002\361x\307\\\364\007q\312\n"
+	.ascii	"\374WS\t\272\356}\002\225[\233\234\035\177\034\201{\301\275F"
+	.ascii	"\222\307\245\322\231e\374\240t\036\257\322\212\032\325\007e{"
+	.ascii	"\205\fp\235[W\3316\215j\323\330\267\275\311,\252\233l\032g(\333"
+	.ascii	"\273\274m\323\350\341&\251<(\333\243Q\351\314\242b\245\263I\365"
+	.ascii	"\341&\257\361&\217B\326d\223JY\246I\345A\351<R)\223YT|\333\346"
+	.ascii	"\3454]\332,#\324u\036\203\356\2759\332.#\320\275\307\3455\256"
+	.ascii	"\265\324\315\202J]\254\313j_\355\326\275\327X\346\246\325\354"
+	.ascii	"i\221WM\351\244\331\004u\257\333\225Jadc\324E\032\371^\250vy"
+	.ascii	"/\262\231\002\263\311j\242\2267\350&\2179\220ZM (d3\352:\021"
+	.ascii	"\302TJ\247V\323\004\227+\316\256\213l\215\334u\335\262\226\253"
+	.ascii	"\323\330^\216\013rr1s`]\021!\362,k\265\201\350\240\203\n\303"
+	.ascii	"\\\177Xy\200\205\026g\303\333\352p\200\356\025\241\266\261q\243"
+	.ascii	"\252\325\317i\346\377\036\0376osj\314\366a\343\316\030g\253\317"
+	.ascii	"\366\321=\016\2045\304\252\255\325\2478Z\336\031$e\3144\217\256"
+	.ascii	"\002\312\363\004\016\332\352\216d\257\007\032;i\352\326\263\227"
+	.ascii	"(\343\021\332\335\333\334\322\345l\251\316\301k\254\306\244 "
+	.ascii	"\312\031\264\245\230\216\323X\315\310\005`Z\240-\305u\255\274"
+	.ascii	"U,\262\370`\022\275\367.\233\252\247Z\007?[\252o\274ih\034'*"
+	.ascii	"\021T\005N\013\224\217\372F\2632Qw\211\"b\035k]\350\262\254\377"
+	.ascii	"\333F'\371\331P}<\213q\236\023\265\367fa0d\033\205\214\037\356"
+	.ascii	"\335\222\322\325P}\333\310j\314v\201(UQ\240\334\333\022\225("
+	.ascii	"\241\"\307\332\2249\262\276\263\326\277\215k\315f&\007\022k}"
+	.ascii	"[\255|\273\307\312v\370\016?\t\340\271;\304r\214 \251Z}\353X"
+	.ascii	"e\270\227\t\340q]\035\023\300{G\255?\327)\n\262\303\006\t\205"
+	.ascii	"\016\2115\331\305\fl\316\210\241\266\207\324V\253?\313A\205\234"
+	.ascii	"\314i\261\0026&\210\2273@\240:|Y\243\306\214\274a8\334\206\337"
+	.ascii	"8\016\307\261\033\273a9\f\307;\360\223\241\274\346\314\206\333"
+	.ascii	"\256\2667\307\247\310\240\256\255\265-\320\265\007GG\327u'\266"
+	.ascii	"TE\211\376P\341\371a\226\347]\307k\273\2526RE\326\254=3w\356"
+	.ascii	"\364\234\231\332\0343z\344\213\016WZ\375\034\237\371\210\325"
+	.ascii	"y*\301\254\275\2519s:\3724y\261\250t\261\234\254\257\033u\336"
+	.ascii	"\321\036\327\231!;Zm:\252\215&x\232k;-:o\316\260\254=)Ph\307"
+	.ascii	"\225UE\211\256\367\007\03679\357\270<\321\26586\200 y\323\233"
+	.ascii	"\262\362\214\274\2755\034V\002\235cz8\322\261\262\303\033\316"
+	.ascii	"\027noT\301\321j\277\341\2631w\202\270i\343\317\3651\367\243"
+	.ascii	"h\210\206+t\2205\254\274\2625k\332\215=\264\3107g\240\273'O\230"
+	.ascii	"\234i{\2735\036hK\246\325f\323^d;\222\274\371\227\032\270H1s"
+	.ascii	"c\345\261\245I\323l,f@\231\252(Pz\314\250\3112e\355\315\326\306"
+	.ascii	"\236\230\234\233\261g\\yG2d\032\rQ\323\030\247\350K\263\016\220"
+	.ascii	"]\264\216\215H\237y\243I[2wu\243\3256\303i;g\2201wZ\3552\207"
+	.ascii	"c\223P\276\316xg\246\360\334\351\262\366\206\244\245\365\027"
+	.ascii	"Q3}\023V\025\345g\313\314I\347\312\332\343\002\006L\207\341\221"
+	.ascii	"\241\305=Q\213\334\231\362\326j\207a\263\036;64\351\266\326u"
+	.ascii	"\211\016:\264\027\242f\372F\246*\n\023\241\202C\222.o/\377\322"
+	.ascii	"\024\022\025\345Q\255<;Hff\215\306bw\212\310K\rNL\364^f\021\020"
+	.ascii	"\262+\207\034go\264\002xd]\265\332[\232\231\226\301\241\243\242"
+	.ascii	"e\310\211\031\027Yg\341\"\003#\347\\\263~\207\266\362\016H\357"
+	.ascii	"'?\373\311g\027\224\335#UQ\332\322\r\225\350]\212q\340C\0225"
+	.ascii	"\257 \353Jf\305J\223\265qMaAI\335dy[r\345M\366Sw\305D\r\306\232"
+	.ascii	"74\255~w\\\327:aa=V\306,\352\031\251\022\205\024{\217\221\220"
+	.ascii	"c\262\244\325\256\322^\255\346\206\261\270V\273m/(RM\034\254"
+	.ascii	"\036\2307`\306\324\254\r\007\351=\345\331SxM5\212\335)\237\250"
+	.ascii	"&\033f\364^1\016\2445\240U)\203\262\356\352 \275\245\234\237"
+	.ascii	"-\245\273|\226\037\214)\201\336\345u\340\252\221\325\247H\223"
+	.ascii	"7\351/f\336\224\355k\n\013\n\224\367\327\016\007;Z\324Zm'\355"
+	.ascii	"\325\363\244\315\025+\257'?]VqtQ\310;ar\350#_\355\270!\214\323"
+	.ascii	"\324\260&L\"\255^\245a\355q\263dI[\365\206"
+	.string	"HI\345\254\255\204\250\261\b\231\262F\r\007e\222&b\310V\223p\361W\232\031Y\253>F\244\016\322\315\267\220\377B\232km\357\324\017\322\316\024V\3642\227\001\3540\230:\005Y\032\254\322\t\024'P\314\020\376v'P\2540\361\303B\004\037\026\270\001\213\237\023(\216\236\202D\305\030-\212LB\300\337\320\327\302R\213\037\"\373\242\367&\243b\023\353\023\002Y\337\322\f\032J,\033\374\375\224V\230\370\021\177"
+	.string	"\2540!\002\220\r\022I"
+	.string	"z\223\321Q\221\bl!H\\*\240\030tr\n\ny2\206A`\bE \373\002\006"
+	.string	"\274\311H\204P\322\214\2420\2007\031u"
+	.string	"\203\203\244#\026(\203\350c\021X\341\367\344\344\002H|r!\004\262\305\027\222\206V\370\265\020\2614\364\t\205O.\226|\300\020F\274\311HF\220i\370\364S\032\322 \036\375\2304\2201\f\n\211\276\237!\r\2000\004G\260D\037\2334"
+	.string	"\253\024B\r\340\007\031\314(\n\005\370/H\004\016\2012\326\247X\001\301\n\0265zD\366\305P\203b\021\370{\"\276`\213O \212J,\361\351\205\223/H\004\026\201\3307\031\205\030>\005\331\037\220\030\\\352)*\261/f\024\205?\354\233\214\230h\304(\036\r\237\204\302\247\337\322\020\230\026\225\230h\304(\362\210\354\214\224\211F\214tI\370K{\254\023\215\"\220\310\373\001\177\232\001$\036\261OO\304\243\237\242\222\320\007$\262I\037\200-\004\331\237\217W\224\341sb\332\261J,z.<-\r\203.\360\2000\004\223z\330!\215'\027@\241\217\310\344\303\0020\211\255\001\034\366X\245\025&X"
+	.string	"&-\001W\370\371\326b\021H\\Z\362\365X\245\023(\330a\220\306\332\304\312\030\002\235xl\213\025~-\330\242\317\251\207U*z"
+	.string	"\024\006\331\365,T\374R0\371\230R\030\021p$$\027\b\210\360\301\006\353\317\250\251\350sb\362\261\276%\245\031E\341\3210\350\023\036\375\210\305##\003\330\026KC`\021H\\\235\236\2360P\332mE\351\\)\321\232\353\301\032\302&%\253NM\233\2133\nI\221\353\030\034xX5\323(6\320&W\253-\030\320\324\024W\363\252\025:\323\306\306m\311\372\247@\320\342\310)\221\363\303K"
+	.string	"F8-Va\310\234\345\340\325\352\217\217\264*\265!\255J\231\274\\\032\345P\340\305%\253L\3642y\024\375i\rO\231\251\217\344\223\371\374\227\264\307\2210\306#:\326\224\007\237\365\260Y\275\265\255\312\025\313\212\205\2113\213\nM{q\236\265K8\275\267(\022\270)7%f\212 u\304\005u\221;\203&\365\225\352\360\202\213\312\301\246&y\252\311\341x\327\256\r\323\243\254\325-\2553"
+	.string	"\246\227\216V\333\0374\254'\217V\327\037\251\215\324F\032%\246\213\265\330,\311\240\236F\235q\225E\271\340YW\033\25115\246H\242\365\20299\203\016\225)\242d\231\006\2021\250B\331 \310\023\235AF\241\021\221\021m\222t\242\n\020\206\"i\252\312n\003\022@u)\022\"\307jf\322\324\3308"
+	.string	":\013\346\300\261\355\036\036\366B\256\277\261\235\267 \f9\034>\0359"
+	.string	"\266\301\345\227"
+	.string	"\341\276{\321\347g\344\241\266\330C\304]\330\217\f]\t\204\013\362e"
+	.string	"\232a\216\007\304t\t\23450N\275\020u\300]B6\337\203\350\372\022X\260\273\335\360\236R|V\003Q\200\"09\025\332\320r\032k\305VD\004%;\326Q\243~\312\021\241\353U=\n#\212\347\025o\3552\375\202\334\225h\210\203\237\346\037MH\274\303\236]{\243\272\2558\276p\f\355\255\216\003\253\255\370\362\033\215'\220\025c\366\376D\036\205\364O\026\023\267|\361\277+\235D\221\211\013\211\032P\301Xq?\036\267\340}\0240B{\220.\026\177\2679|\340C^\002\n\271\211\266\305\036\332A\341[\212\372\332\267\024D\320\266\261\247\236n\033K\231\016y\356y\263 \"\2658=\320\353\364l\032\345\021I\343\366\370\367\b\374\037\037\236;\353s\032\024\267g\3705\254\252"
+	.string	"V\347;\323n&\322U\031\022\200\307+\366\364\334vQp\032j#\214\320\216\370\215V\224\257\037\325\237\376DG"
+	.ascii	"\022b\231\205\360\326\264:8\372\327\322\275\\W\3061\351\334t"
+	.ascii	"\235U\316\302\271\177\261,%b\257\321f(\200+\022\213\r\305\"k"
+	.ascii	"\263+U\316c\360\346N\327S\255\233\360)\330T\273\312!+\316\250"
+	.ascii	"\203\236\234\363\224`\376y\312\231\217\264\244\223h\374\224\330"
+	.ascii	"@W sN\344\336nnc\247\211H\236\306\376\307X\020?\214\022k\005"
+	.ascii	"\266\034F5\306z\310uz\311P\273*\272\207\216\\\335CR]X\354a\245"
+	.ascii	"&\303Fc(\301j\n\317:E\351(@>\233ix{\177\246_w~\031\016p\020="
+	.ascii	" \244w\271P\301>e\0053\311\240\254K#\004\3746.+\004\262w\245"
+	.ascii	"\277\325\361\332\002\275\\AE\207\013\003\016\230+\327`\n\022"
+	.ascii	"_@\nTS\300>\034\240\311\201|\231\216Itm\223M\tT\213w\036\207"
+	.ascii	"hn\320\362Q\356\350\315K\224\236\322\317c\264\334\326^*\342\377"
+	.ascii	"k\n\272`!\3560=\206\315\335\201\306&kgt\276\357\016\013\205I"
+	.ascii	"'\226}\353\033hY\245\363\033\303\375\311\332\206)w\315\030`\020"
+	.ascii	"\317\225mX\3112\224\362\215\"\313\351\210\361\236\311Q\333\007"
+	.ascii	"\374sD<\216\254\271"
+	.string	"\022\341\027\"\206\267\360\244\203\336fw\023[\322\231\260\334\215\365\355\027\377\272?Z\334\303\214(l\202lr\242\240\246\361\256\\uf\356'\004\031\315\203\"\310Q\224\343j7\356=\037\242\217\314\245\311C\261\002\320\025\\\210%\020\013\2018S\2260\245\t\327\324\255\026[I\327`\317t\244_a2n\350\315\013\346z\001gS7\272D(\356\0044\311*\247\\D4zb\372N|\355He\272kK\226-j\243\360\351\271\3445x\260\364I\361H\347\021\372\304\b\020\264\002\013<\273\026\250[t^\344\314\316A\027:\005\b\265\272\213 \322\334-j\226\225\220\276\223:\212L\212<\232o\372>?\r\221f\210\324\001S\\\264\250\215\232P\206\026\272Q\310\203\020\346f\260\321D\bC\234\343-\355F:\213\367\304\261\220t`F\322\2055\256\370\235O\333\036=k\034\027\324[\235\3374\237\347\016{\340\275\001\341"
+	.string	"\3643[\227\t\375C\305\275\224\277\355+\365\313\214Q\022]\245\364=^\270LX\236'\374A\033\256\243\"\\\204\276"
+	.ascii	"z\237\365\327\177\233\363\331\177\271`p}\323\340\361\033\237"
+	.ascii	"\246\202\207\363\367\277\r\203\t\226\263\361s\303\365:x`\350"
+	.ascii	"8%\371\006\376\226yx\335 w\373\307=\306Y\361n\273\177\230\355"
+	.ascii	"\245\205\345`\314\372\374\334\3649\n\317\036+i\324\364\262d;"
+	.ascii	"4T\255\225\325v%.kW\266?\322\271G/Aw\300\362R\323\365 \356\321"
+	.ascii	"\337\017\322cv\037};tj\213!\266\002"
+	.text
+	.section	.gnu.lto_.symtab.2dc07d482d3bacd8,"e",@progbits
+	.string	"mspDataflashReadStreamCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"mspDataflashStreamAckCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"mspSerialStreamStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2dc07d482d3bacd8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12157 @@
+	.file	"msp_serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/streambuf.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/io/serial.h"
+	.file 9 "./src/main/msp/msp.h"
+	.file 10 "./src/main/msp/msp_serial.h"
+	.file 11 "./src/main/msp/msp_serial.c"
+	.file 12 "./src/main/common/maths.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	msp_serial.c.020e44ed
+	.weak	msp_serial.c.020e44ed
+msp_serial.c.020e44ed:
+	.long	0xf4a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF1632
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1379
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1380
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1381
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1382
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1383
+	.uleb128 0x4
+	.long	.LASF1384
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF1385
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1386
+	.uleb128 0x4
+	.long	.LASF1387
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1388
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1389
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1390
+	.uleb128 0x4
+	.long	.LASF1391
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF1392
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xa
+	.long	0xa4
+	.uleb128 0x25
+	.long	0xa4
+	.uleb128 0x4
+	.long	.LASF1393
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xa
+	.long	0xba
+	.uleb128 0x4
+	.long	.LASF1394
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0xa
+	.long	0xcb
+	.uleb128 0x4
+	.long	.LASF1395
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x26
+	.long	.LASF1633
+	.byte	0xe
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcb
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1396
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1397
+	.uleb128 0x11
+	.long	.LASF1462
+	.byte	0x10
+	.byte	0x5
+	.byte	0x19
+	.byte	0x10
+	.long	0x12a
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xe
+	.long	0x12a
+	.byte	0
+	.uleb128 0x17
+	.string	"end"
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xe
+	.long	0x12a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xa4
+	.uleb128 0x4
+	.long	.LASF1398
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0x102
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x262
+	.uleb128 0x1
+	.long	.LASF1399
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1400
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1401
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1403
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1406
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1407
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1411
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1412
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1413
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1415
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1416
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1417
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1418
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1419
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1420
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1421
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1422
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1423
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1425
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1426
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1427
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1428
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1429
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1431
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1432
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1434
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1435
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1436
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1437
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1441
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1442
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1444
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1445
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1449
+	.long	0x30
+	.byte	0x17
+	.long	0x283
+	.uleb128 0x1
+	.long	.LASF1446
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1447
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1448
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1449
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x3
+	.long	0x262
+	.uleb128 0x1d
+	.long	.LASF1450
+	.long	0x30
+	.byte	0x1d
+	.long	0x2da
+	.uleb128 0x1
+	.long	.LASF1451
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1452
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1450
+	.byte	0x6
+	.byte	0x30
+	.byte	0x3
+	.long	0x28f
+	.uleb128 0x4
+	.long	.LASF1461
+	.byte	0x6
+	.byte	0x32
+	.byte	0x10
+	.long	0x2f2
+	.uleb128 0x5
+	.long	0x2f7
+	.uleb128 0xf
+	.long	0x302
+	.uleb128 0x2
+	.long	0xba
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1463
+	.byte	0x48
+	.byte	0x6
+	.byte	0x34
+	.byte	0x10
+	.long	0x3c6
+	.uleb128 0x3
+	.long	.LASF1464
+	.byte	0x6
+	.byte	0x36
+	.byte	0x24
+	.long	0x45b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1465
+	.byte	0x6
+	.byte	0x38
+	.byte	0xd
+	.long	0xa4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1466
+	.byte	0x6
+	.byte	0x39
+	.byte	0x10
+	.long	0x283
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1467
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x13
+	.long	0x2da
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1468
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xe
+	.long	0xcb
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1469
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xe
+	.long	0xcb
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1470
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xe
+	.long	0xcb
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1471
+	.byte	0x6
+	.byte	0x40
+	.byte	0x17
+	.long	0x460
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1472
+	.byte	0x6
+	.byte	0x41
+	.byte	0x17
+	.long	0x460
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1473
+	.byte	0x6
+	.byte	0x42
+	.byte	0xe
+	.long	0xcb
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1474
+	.byte	0x6
+	.byte	0x43
+	.byte	0xe
+	.long	0xcb
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1475
+	.byte	0x6
+	.byte	0x44
+	.byte	0xe
+	.long	0xcb
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1476
+	.byte	0x6
+	.byte	0x45
+	.byte	0xe
+	.long	0xcb
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1477
+	.byte	0x6
+	.byte	0x47
+	.byte	0x1e
+	.long	0x2e6
+	.byte	0x40
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1478
+	.byte	0x50
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x8
+	.long	0x456
+	.uleb128 0x3
+	.long	.LASF1479
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xc
+	.long	0x48b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1480
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x10
+	.long	0x4a4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1481
+	.byte	0x6
+	.byte	0x60
+	.byte	0x10
+	.long	0x4a4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1482
+	.byte	0x6
+	.byte	0x62
+	.byte	0xf
+	.long	0x4b8
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1483
+	.byte	0x6
+	.byte	0x65
+	.byte	0xc
+	.long	0x4cd
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1484
+	.byte	0x6
+	.byte	0x67
+	.byte	0xb
+	.long	0x4ed
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1485
+	.byte	0x6
+	.byte	0x69
+	.byte	0xc
+	.long	0x502
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1486
+	.byte	0x6
+	.byte	0x6b
+	.byte	0xc
+	.long	0x522
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1487
+	.byte	0x6
+	.byte	0x6d
+	.byte	0xc
+	.long	0x532
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1488
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xc
+	.long	0x532
+	.byte	0x48
+	.byte	0
+	.uleb128 0xa
+	.long	0x3c6
+	.uleb128 0x5
+	.long	0x456
+	.uleb128 0x5
+	.long	0xb5
+	.uleb128 0x4
+	.long	.LASF1489
+	.byte	0x6
+	.byte	0x48
+	.byte	0x3
+	.long	0x302
+	.uleb128 0xa
+	.long	0x465
+	.uleb128 0xf
+	.long	0x486
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0xa4
+	.byte	0
+	.uleb128 0x5
+	.long	0x465
+	.uleb128 0x5
+	.long	0x476
+	.uleb128 0x14
+	.long	0xcb
+	.long	0x49f
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x5
+	.long	0x471
+	.uleb128 0x5
+	.long	0x490
+	.uleb128 0x14
+	.long	0xa4
+	.long	0x4b8
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x5
+	.long	0x4a9
+	.uleb128 0xf
+	.long	0x4cd
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0xcb
+	.byte	0
+	.uleb128 0x5
+	.long	0x4bd
+	.uleb128 0x14
+	.long	0x4e1
+	.long	0x4e1
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1490
+	.uleb128 0xa
+	.long	0x4e1
+	.uleb128 0x5
+	.long	0x4d2
+	.uleb128 0xf
+	.long	0x502
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x283
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f2
+	.uleb128 0xf
+	.long	0x51c
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x51c
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	0x521
+	.uleb128 0x27
+	.uleb128 0x5
+	.long	0x507
+	.uleb128 0xf
+	.long	0x532
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x5
+	.long	0x527
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x20
+	.long	0x5a4
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0x80
+	.uleb128 0x12
+	.long	.LASF1500
+	.value	0x200
+	.uleb128 0x12
+	.long	.LASF1501
+	.value	0x400
+	.uleb128 0x12
+	.long	.LASF1502
+	.value	0x800
+	.uleb128 0x12
+	.long	.LASF1503
+	.value	0x1000
+	.uleb128 0x12
+	.long	.LASF1504
+	.value	0x2000
+	.uleb128 0x12
+	.long	.LASF1505
+	.value	0x4000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1506
+	.byte	0x8
+	.byte	0x30
+	.byte	0x3
+	.long	0x537
+	.uleb128 0x15
+	.long	0xd7
+	.long	0x5bb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0xa
+	.long	0x5b0
+	.uleb128 0x29
+	.long	.LASF1634
+	.byte	0x8
+	.byte	0x45
+	.byte	0x17
+	.long	0x5bb
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x70
+	.byte	0x8
+	.byte	0x48
+	.long	0x621
+	.uleb128 0x18
+	.long	.LASF1507
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1519
+	.byte	0x8
+	.byte	0x55
+	.byte	0x3
+	.long	0x5cc
+	.uleb128 0x11
+	.long	.LASF1520
+	.byte	0xc
+	.byte	0x8
+	.byte	0x6c
+	.byte	0x10
+	.long	0x689
+	.uleb128 0x3
+	.long	.LASF1521
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xe
+	.long	0xba
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1465
+	.byte	0x8
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x621
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1522
+	.byte	0x8
+	.byte	0x6f
+	.byte	0xd
+	.long	0xa4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1523
+	.byte	0x8
+	.byte	0x70
+	.byte	0xd
+	.long	0xa4
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1524
+	.byte	0x8
+	.byte	0x71
+	.byte	0xd
+	.long	0xa4
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1525
+	.byte	0x8
+	.byte	0x72
+	.byte	0xd
+	.long	0xa4
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1526
+	.byte	0x8
+	.byte	0x73
+	.byte	0x3
+	.long	0x62d
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x70
+	.byte	0x9
+	.byte	0x17
+	.long	0x6ba
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF1528
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1530
+	.sleb128 -2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1531
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x3
+	.long	0x695
+	.uleb128 0xa
+	.long	0x6ba
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x1e
+	.long	0x6e4
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1534
+	.byte	0x9
+	.byte	0x21
+	.byte	0x3
+	.long	0x6cb
+	.uleb128 0x11
+	.long	.LASF1535
+	.byte	0x18
+	.byte	0x9
+	.byte	0x23
+	.byte	0x10
+	.long	0x732
+	.uleb128 0x17
+	.string	"buf"
+	.byte	0x9
+	.byte	0x24
+	.byte	0xc
+	.long	0x12f
+	.byte	0
+	.uleb128 0x17
+	.string	"cmd"
+	.byte	0x9
+	.byte	0x25
+	.byte	0xe
+	.long	0xba
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1536
+	.byte	0x9
+	.byte	0x26
+	.byte	0xd
+	.long	0x98
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1537
+	.byte	0x9
+	.byte	0x27
+	.byte	0xd
+	.long	0xa4
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1538
+	.byte	0x9
+	.byte	0x28
+	.byte	0x3
+	.long	0x6f0
+	.uleb128 0x4
+	.long	.LASF1539
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x10
+	.long	0x74a
+	.uleb128 0x5
+	.long	0x74f
+	.uleb128 0xf
+	.long	0x75a
+	.uleb128 0x2
+	.long	0x75a
+	.byte	0
+	.uleb128 0x5
+	.long	0x302
+	.uleb128 0x4
+	.long	.LASF1540
+	.byte	0x9
+	.byte	0x2c
+	.byte	0x17
+	.long	0x76b
+	.uleb128 0x5
+	.long	0x770
+	.uleb128 0x14
+	.long	0x6ba
+	.long	0x789
+	.uleb128 0x2
+	.long	0x789
+	.uleb128 0x2
+	.long	0x789
+	.uleb128 0x2
+	.long	0x78e
+	.byte	0
+	.uleb128 0x5
+	.long	0x732
+	.uleb128 0x5
+	.long	0x73e
+	.uleb128 0x4
+	.long	.LASF1541
+	.byte	0x9
+	.byte	0x2d
+	.byte	0x10
+	.long	0x79f
+	.uleb128 0x5
+	.long	0x7a4
+	.uleb128 0xf
+	.long	0x7af
+	.uleb128 0x2
+	.long	0x789
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1542
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x17
+	.long	0x7bb
+	.uleb128 0x5
+	.long	0x7c0
+	.uleb128 0x14
+	.long	0x6ba
+	.long	0x7cf
+	.uleb128 0x2
+	.long	0x789
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x19
+	.long	0x818
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1553
+	.byte	0xa
+	.byte	0x24
+	.byte	0x3
+	.long	0x7cf
+	.uleb128 0xa
+	.long	0x818
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x28
+	.long	0x842
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1556
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x3
+	.long	0x829
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x2f
+	.long	0x867
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1559
+	.byte	0xa
+	.byte	0x32
+	.byte	0x3
+	.long	0x84e
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x34
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1562
+	.byte	0xa
+	.byte	0x37
+	.byte	0x3
+	.long	0x873
+	.uleb128 0x11
+	.long	.LASF1563
+	.byte	0xe8
+	.byte	0xa
+	.byte	0x4a
+	.byte	0x10
+	.long	0x928
+	.uleb128 0x3
+	.long	.LASF1564
+	.byte	0xa
+	.byte	0x4b
+	.byte	0x1a
+	.long	0x75a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1565
+	.byte	0xa
+	.byte	0x4c
+	.byte	0xe
+	.long	0xba
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1566
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xe
+	.long	0xba
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1567
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xd
+	.long	0xa4
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1568
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xba
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1569
+	.byte	0xa
+	.byte	0x50
+	.byte	0x10
+	.long	0x818
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1570
+	.byte	0xa
+	.byte	0x51
+	.byte	0x15
+	.long	0x867
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1571
+	.byte	0xa
+	.byte	0x52
+	.byte	0x12
+	.long	0x842
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1572
+	.byte	0xa
+	.byte	0x53
+	.byte	0x14
+	.long	0x7af
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1573
+	.byte	0xa
+	.byte	0x54
+	.byte	0xd
+	.long	0x928
+	.byte	0x28
+	.byte	0
+	.uleb128 0x15
+	.long	0xa4
+	.long	0x938
+	.uleb128 0x19
+	.long	0x37
+	.byte	0xbf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1574
+	.byte	0xa
+	.byte	0x55
+	.byte	0x3
+	.long	0x898
+	.uleb128 0x15
+	.long	0x938
+	.long	0x954
+	.uleb128 0x19
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1575
+	.byte	0x23
+	.byte	0x12
+	.long	0x944
+	.uleb128 0x15
+	.long	0xa4
+	.long	0x970
+	.uleb128 0x2a
+	.long	0x37
+	.value	0x100f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1576
+	.byte	0x26
+	.byte	0x10
+	.long	0x95f
+	.uleb128 0xb
+	.long	.LASF1577
+	.byte	0x6
+	.byte	0x73
+	.byte	0xa
+	.long	0xcb
+	.long	0x991
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1579
+	.byte	0x6
+	.byte	0x7f
+	.long	0x9a2
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1578
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xa
+	.long	0x12a
+	.long	0x9b8
+	.uleb128 0x2
+	.long	0x9b8
+	.byte	0
+	.uleb128 0x5
+	.long	0x12f
+	.uleb128 0x10
+	.long	.LASF1580
+	.byte	0x6
+	.byte	0x74
+	.long	0x9d8
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0x9d8
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0xb
+	.long	.LASF1581
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x5
+	.long	0x70
+	.long	0x9f3
+	.uleb128 0x2
+	.long	0x9b8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x7e
+	.long	0xa04
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1583
+	.byte	0x5
+	.byte	0x30
+	.long	0xa1a
+	.uleb128 0x2
+	.long	0x9b8
+	.uleb128 0x2
+	.long	0x12a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1584
+	.byte	0xc
+	.byte	0x93
+	.byte	0x9
+	.long	0xa4
+	.long	0xa35
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0x22
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1585
+	.byte	0x8
+	.byte	0x9f
+	.long	0xa46
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1586
+	.byte	0x6
+	.byte	0x72
+	.byte	0xa
+	.long	0xcb
+	.long	0xa5c
+	.uleb128 0x2
+	.long	0x49f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1587
+	.byte	0x8
+	.byte	0xa7
+	.long	0xa72
+	.uleb128 0x2
+	.long	0x486
+	.uleb128 0x2
+	.long	0xa4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1482
+	.byte	0x6
+	.byte	0x75
+	.byte	0x9
+	.long	0xa4
+	.long	0xa88
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1588
+	.byte	0x8
+	.byte	0x9d
+	.long	0xa99
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1589
+	.byte	0xd
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8f
+	.long	0xab9
+	.uleb128 0x2
+	.long	0x8f
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xdc
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1590
+	.byte	0x8
+	.byte	0x8a
+	.byte	0x15
+	.long	0xacf
+	.long	0xacf
+	.uleb128 0x2
+	.long	0x5a4
+	.byte	0
+	.uleb128 0x5
+	.long	0x689
+	.uleb128 0xb
+	.long	.LASF1591
+	.byte	0x8
+	.byte	0x95
+	.byte	0xf
+	.long	0x486
+	.long	0xb03
+	.uleb128 0x2
+	.long	0x621
+	.uleb128 0x2
+	.long	0x5a4
+	.uleb128 0x2
+	.long	0x2e6
+	.uleb128 0x2
+	.long	0xcb
+	.uleb128 0x2
+	.long	0x283
+	.uleb128 0x2
+	.long	0x2da
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1592
+	.byte	0x8
+	.byte	0x89
+	.byte	0x15
+	.long	0xacf
+	.long	0xb19
+	.uleb128 0x2
+	.long	0x5a4
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1593
+	.value	0x1ab
+	.byte	0xa
+	.long	0xcb
+	.long	0xb5e
+	.uleb128 0x1b
+	.string	"ret"
+	.value	0x1ad
+	.byte	0xe
+	.long	0xcb
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1594
+	.value	0x1af
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1595
+	.value	0x1b0
+	.byte	0x1b
+	.long	0xb63
+	.uleb128 0x6
+	.long	.LASF1596
+	.value	0x1ba
+	.byte	0x18
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x938
+	.uleb128 0xa
+	.long	0xb5e
+	.uleb128 0x1e
+	.long	.LASF1603
+	.value	0x1a2
+	.long	0xba8
+	.uleb128 0xe
+	.long	.LASF1597
+	.value	0x1a2
+	.byte	0x29
+	.long	0x486
+	.uleb128 0xe
+	.long	.LASF1572
+	.value	0x1a2
+	.byte	0x44
+	.long	0x7af
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1594
+	.value	0x1a4
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1595
+	.value	0x1a5
+	.byte	0x1b
+	.long	0xb63
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1598
+	.value	0x180
+	.byte	0x5
+	.long	0x70
+	.long	0xc1d
+	.uleb128 0x1c
+	.string	"cmd"
+	.value	0x180
+	.byte	0x1c
+	.long	0xba
+	.uleb128 0xe
+	.long	.LASF1599
+	.value	0x180
+	.byte	0x2a
+	.long	0x12a
+	.uleb128 0xe
+	.long	.LASF1600
+	.value	0x180
+	.byte	0x34
+	.long	0x70
+	.uleb128 0xe
+	.long	.LASF1537
+	.value	0x180
+	.byte	0x4c
+	.long	0x6e4
+	.uleb128 0x1b
+	.string	"ret"
+	.value	0x182
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1594
+	.value	0x184
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1595
+	.value	0x185
+	.byte	0x1b
+	.long	0xb63
+	.uleb128 0x6
+	.long	.LASF1601
+	.value	0x18f
+	.byte	0x15
+	.long	0x732
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1635
+	.byte	0xb
+	.value	0x17a
+	.byte	0x6
+	.uleb128 0x1a
+	.long	.LASF1602
+	.value	0x16b
+	.byte	0x5
+	.long	0x4e1
+	.long	0xc53
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1594
+	.value	0x16d
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1595
+	.value	0x16e
+	.byte	0x1b
+	.long	0xb63
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1604
+	.value	0x141
+	.long	0xcc3
+	.uleb128 0xe
+	.long	.LASF1605
+	.value	0x141
+	.byte	0x2f
+	.long	0x88c
+	.uleb128 0xe
+	.long	.LASF1606
+	.value	0x141
+	.byte	0x5a
+	.long	0x75f
+	.uleb128 0xe
+	.long	.LASF1607
+	.value	0x141
+	.byte	0x84
+	.long	0x793
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1594
+	.value	0x143
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1595
+	.value	0x144
+	.byte	0x1b
+	.long	0xb63
+	.uleb128 0x6
+	.long	.LASF1608
+	.value	0x149
+	.byte	0x1d
+	.long	0x73e
+	.uleb128 0x8
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x14d
+	.byte	0x1b
+	.long	0xb0
+	.uleb128 0x6
+	.long	.LASF1609
+	.value	0x14e
+	.byte	0x17
+	.long	0x4e8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1615
+	.value	0x115
+	.long	0xd27
+	.uleb128 0x1c
+	.string	"msp"
+	.value	0x115
+	.byte	0x2f
+	.long	0xb5e
+	.uleb128 0x6
+	.long	.LASF1610
+	.value	0x117
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1611
+	.value	0x11c
+	.byte	0x12
+	.long	0x12a
+	.uleb128 0x6
+	.long	.LASF1612
+	.value	0x125
+	.byte	0x15
+	.long	0x732
+	.uleb128 0x6
+	.long	.LASF1613
+	.value	0x12b
+	.byte	0x12
+	.long	0x12a
+	.uleb128 0x6
+	.long	.LASF1614
+	.value	0x12d
+	.byte	0x1b
+	.long	0x6c6
+	.uleb128 0x8
+	.uleb128 0x6
+	.long	.LASF1596
+	.value	0x11e
+	.byte	0x1c
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1616
+	.value	0x101
+	.long	0xd57
+	.uleb128 0x1c
+	.string	"msp"
+	.value	0x101
+	.byte	0x36
+	.long	0xb5e
+	.uleb128 0xe
+	.long	.LASF1607
+	.value	0x101
+	.byte	0x50
+	.long	0x793
+	.uleb128 0x6
+	.long	.LASF1617
+	.value	0x103
+	.byte	0x11
+	.long	0x732
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1619
+	.byte	0xde
+	.byte	0x1c
+	.long	0x73e
+	.long	0xdb4
+	.uleb128 0x13
+	.string	"msp"
+	.byte	0xde
+	.byte	0x47
+	.long	0xb5e
+	.uleb128 0xc
+	.long	.LASF1606
+	.byte	0xde
+	.byte	0x63
+	.long	0x75f
+	.uleb128 0x7
+	.long	.LASF1617
+	.byte	0xe0
+	.byte	0x11
+	.long	0x732
+	.uleb128 0x7
+	.long	.LASF1613
+	.byte	0xe6
+	.byte	0xe
+	.long	0x12a
+	.uleb128 0x7
+	.long	.LASF1618
+	.byte	0xe8
+	.byte	0x11
+	.long	0x732
+	.uleb128 0x7
+	.long	.LASF1608
+	.byte	0xf5
+	.byte	0x19
+	.long	0x73e
+	.uleb128 0x7
+	.long	.LASF1614
+	.byte	0xf6
+	.byte	0x17
+	.long	0x6c6
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1620
+	.byte	0xb8
+	.byte	0xc
+	.long	0x70
+	.long	0xe11
+	.uleb128 0x13
+	.string	"msp"
+	.byte	0xb8
+	.byte	0x27
+	.long	0xb5e
+	.uleb128 0xc
+	.long	.LASF1621
+	.byte	0xb8
+	.byte	0x39
+	.long	0x789
+	.uleb128 0xc
+	.long	.LASF1571
+	.byte	0xb8
+	.byte	0x4e
+	.long	0x842
+	.uleb128 0x20
+	.string	"len"
+	.byte	0xbb
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x20
+	.string	"hdr"
+	.byte	0xbc
+	.byte	0xd
+	.long	0xe11
+	.uleb128 0x7
+	.long	.LASF1622
+	.byte	0xc1
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x7
+	.long	.LASF1567
+	.byte	0xc3
+	.byte	0xd
+	.long	0xa4
+	.byte	0
+	.uleb128 0x15
+	.long	0xa4
+	.long	0xe21
+	.uleb128 0x19
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1623
+	.byte	0xad
+	.byte	0x10
+	.long	0xa4
+	.long	0xe52
+	.uleb128 0x13
+	.string	"crc"
+	.byte	0xad
+	.byte	0x29
+	.long	0xa4
+	.uleb128 0xc
+	.long	.LASF1599
+	.byte	0xad
+	.byte	0x3d
+	.long	0x9d8
+	.uleb128 0x13
+	.string	"len"
+	.byte	0xad
+	.byte	0x47
+	.long	0x70
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1624
+	.byte	0xa5
+	.byte	0x10
+	.long	0xa4
+	.long	0xe83
+	.uleb128 0xc
+	.long	.LASF1567
+	.byte	0xa5
+	.byte	0x2d
+	.long	0xa4
+	.uleb128 0xc
+	.long	.LASF1599
+	.byte	0xa5
+	.byte	0x46
+	.long	0x9d8
+	.uleb128 0x13
+	.string	"len"
+	.byte	0xa5
+	.byte	0x50
+	.long	0x70
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1625
+	.byte	0x4f
+	.byte	0x18
+	.long	0x4e1
+	.long	0xec5
+	.uleb128 0xc
+	.long	.LASF1595
+	.byte	0x4f
+	.byte	0x40
+	.long	0xb5e
+	.uleb128 0x13
+	.string	"c"
+	.byte	0x4f
+	.byte	0x51
+	.long	0xa4
+	.uleb128 0x2c
+	.long	0xeb7
+	.uleb128 0x7
+	.long	.LASF1626
+	.byte	0x62
+	.byte	0x1a
+	.long	0x824
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x7
+	.long	.LASF1566
+	.byte	0x8e
+	.byte	0x1c
+	.long	0xc6
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1627
+	.byte	0x44
+	.long	0xef5
+	.uleb128 0xc
+	.long	.LASF1597
+	.byte	0x44
+	.byte	0x34
+	.long	0x486
+	.uleb128 0x8
+	.uleb128 0x7
+	.long	.LASF1594
+	.byte	0x46
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x8
+	.uleb128 0x7
+	.long	.LASF1628
+	.byte	0x47
+	.byte	0x14
+	.long	0xb5e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1629
+	.byte	0x2f
+	.long	0xf2e
+	.uleb128 0x7
+	.long	.LASF1594
+	.byte	0x31
+	.byte	0xd
+	.long	0xa4
+	.uleb128 0x7
+	.long	.LASF1630
+	.byte	0x32
+	.byte	0x19
+	.long	0xacf
+	.uleb128 0x8
+	.uleb128 0x7
+	.long	.LASF1595
+	.byte	0x34
+	.byte	0x14
+	.long	0xb5e
+	.uleb128 0x7
+	.long	.LASF1597
+	.byte	0x3a
+	.byte	0x17
+	.long	0x486
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1636
+	.byte	0xb
+	.byte	0x28
+	.byte	0xd
+	.uleb128 0xc
+	.long	.LASF1631
+	.byte	0x28
+	.byte	0x25
+	.long	0xb5e
+	.uleb128 0xc
+	.long	.LASF1597
+	.byte	0x28
+	.byte	0x43
+	.long	0x486
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 15 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.file 18 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.file 35 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 36 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 39 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.file 40 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 41 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 42 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 43 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 44 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1366
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1378
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF944
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF950
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF973
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF985
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1365
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1368
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.23.9b774467666991c1fe9817e4daf581cb,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1375
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1637
+	.long	.LASF1638
+	.long	.LASF1639
+	.long	.LASF1640
+	.long	.LASF1641
+	.long	.LASF1642
+	.long	.LASF1643
+	.long	.LASF1644
+	.long	.LASF1645
+	.long	.LASF1646
+	.long	.LASF1647
+	.long	.LASF1648
+	.long	.LASF1649
+	.long	.LASF1650
+	.long	.LASF1651
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1652
+	.byte	0xb
+	.long	.LASF1653
+	.byte	0xb
+	.long	.LASF1654
+	.byte	0xb
+	.long	.LASF1655
+	.byte	0xf
+	.long	.LASF1656
+	.byte	0x2
+	.long	.LASF1657
+	.byte	0x4
+	.long	.LASF1658
+	.byte	0x4
+	.long	.LASF1657
+	.byte	0x5
+	.long	.LASF1659
+	.byte	0x6
+	.long	.LASF1660
+	.byte	0x6
+	.long	.LASF1661
+	.byte	0x6
+	.long	.LASF1662
+	.byte	0x2
+	.long	.LASF1663
+	.byte	0xe
+	.long	.LASF1664
+	.byte	0x7
+	.long	.LASF1665
+	.byte	0xe
+	.long	.LASF1666
+	.byte	0xf
+	.long	.LASF1667
+	.byte	0xf
+	.long	.LASF1667
+	.byte	0xe
+	.long	.LASF1668
+	.byte	0xb
+	.long	.LASF1669
+	.byte	0xe
+	.long	.LASF1670
+	.byte	0xe
+	.long	.LASF1671
+	.byte	0xb
+	.long	.LASF1672
+	.byte	0xb
+	.long	.LASF1673
+	.byte	0xd
+	.long	.LASF1674
+	.byte	0xb
+	.long	.LASF1675
+	.byte	0xc
+	.long	.LASF1676
+	.byte	0xc
+	.long	.LASF1677
+	.byte	0xb
+	.long	.LASF1678
+	.byte	0xb
+	.long	.LASF1679
+	.byte	0xb
+	.long	.LASF1680
+	.byte	0xa
+	.long	.LASF1681
+	.byte	0xa
+	.long	.LASF1682
+	.byte	0xe
+	.long	.LASF1683
+	.byte	0x9
+	.long	.LASF1684
+	.byte	0x8
+	.long	.LASF1685
+	.byte	0x8
+	.long	.LASF1686
+	.byte	0x2
+	.long	.LASF1687
+	.byte	0x1
+	.long	.LASF1688
+	.byte	0x1
+	.long	.LASF1689
+	.byte	0x3
+	.long	.LASF1690
+	.byte	0x4
+	.long	.LASF1691
+	.byte	0x4
+	.long	.LASF1692
+	.byte	0x4
+	.long	.LASF1693
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1357:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1113:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1187:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1133:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1019:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1004:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF734:
+	.string	"USE_CLI "
+.LASF906:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1469:
+	.string	"rxBufferSize"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF1104:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF821:
+	.string	"USE_PPM"
+.LASF1485:
+	.string	"setMode"
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF1361:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1002:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1260:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"sbufSwitchToReader"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF956:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1384:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF957:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1490:
+	.string	"_Bool"
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1206:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF924:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF978:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1407:
+	.string	"OWNER_ADC_CURR"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1060:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1166:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"IOCFG_AF_OD 0"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1476:
+	.string	"txBufferTail"
+.LASF1451:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF1587:
+	.string	"serialEvaluateNonMspData"
+.LASF1000:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1284:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"USE_SPI"
+.LASF971:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1494:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF989:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF1353:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"MODE_TX"
+.LASF1112:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF1192:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1325:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1271:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"evaluateNonMspData"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1041:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1393:
+	.string	"uint16_t"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF380:
+	.string	"linux 1"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1501:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1292:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF916:
+	.string	"Q12 (1 << 12)"
+.LASF1378:
+	.string	"CHECKSUM_STARTPOS 3"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1136:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF1259:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1017:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1602:
+	.string	"mspSerialWaiting"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF940:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1012:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1511:
+	.string	"SERIAL_PORT_UART4"
+.LASF1586:
+	.string	"serialRxBytesWaiting"
+.LASF1316:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1603:
+	.string	"mspSerialStreamStart"
+.LASF1063:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1541:
+	.string	"mspProcessReplyFnPtr"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1217:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1352:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1496:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1020:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF985:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF959:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF937:
+	.string	"BIT(x) (1 << (x))"
+.LASF1435:
+	.string	"OWNER_BEEPER"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1473:
+	.string	"rxBufferHead"
+.LASF1233:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1372:
+	.string	"MSP_PORT_DATAFLASH_BUFFER_SIZE 4096"
+.LASF1179:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF952:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF904:
+	.string	"FAST_MATH "
+.LASF799:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1487:
+	.string	"beginWrite"
+.LASF925:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1338:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF1443:
+	.string	"OWNER_SPI_PREINIT"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1274:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF991:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF970:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1044:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF1573:
+	.string	"inBuf"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1432:
+	.string	"OWNER_BARO_EXTI"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1613:
+	.string	"outBufHead"
+.LASF516:
+	.string	"__always_inline"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1446:
+	.string	"MODE_RX"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF822:
+	.string	"USE_PWM"
+.LASF1139:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1410:
+	.string	"OWNER_SERIAL_TX"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF928:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1572:
+	.string	"streamFn"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1371:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1607:
+	.string	"mspProcessReplyFn"
+.LASF1636:
+	.string	"resetMspPort"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1067:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1311:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1254:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF913:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1066:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"OWNER_USB"
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1633:
+	.string	"SystemCoreClock"
+.LASF399:
+	.string	"false 0"
+.LASF1445:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF968:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1535:
+	.string	"mspPacket_s"
+.LASF1538:
+	.string	"mspPacket_t"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1628:
+	.string	"candidateMspPort"
+.LASF1635:
+	.string	"mspSerialInit"
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1061:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF1236:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1182:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1042:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1368:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF1190:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1551:
+	.string	"MSP_PAYLOAD_V2"
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF1277:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF1223:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1047:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1403:
+	.string	"OWNER_SERVO"
+.LASF939:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF793:
+	.string	"ACC "
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF738:
+	.string	"USE_PWM "
+.LASF1307:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF1088:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1034:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF958:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1608:
+	.string	"mspPostProcessFn"
+.LASF1021:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1429:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1584:
+	.string	"crc8_dvb_s2"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1385:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1387:
+	.string	"__uint16_t"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1402:
+	.string	"OWNER_MOTOR"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1364:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1499:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1069:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF1533:
+	.string	"MSP_DIRECTION_REQUEST"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1547:
+	.string	"MSP_HEADER_ARROW"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF931:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1475:
+	.string	"txBufferHead"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1466:
+	.string	"mode"
+.LASF1544:
+	.string	"MSP_HEADER_START"
+.LASF1245:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1062:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF903:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1585:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF950:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1404:
+	.string	"OWNER_LED"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF923:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1185:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1131:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1537:
+	.string	"direction"
+.LASF356:
+	.string	"__amd64 1"
+.LASF1495:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1379:
+	.string	"unsigned char"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF977:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF960:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1209:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF777:
+	.string	"USE_NAV "
+.LASF1226:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF365:
+	.string	"__k8 1"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1172:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1397:
+	.string	"float"
+.LASF1465:
+	.string	"identifier"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1317:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1486:
+	.string	"writeBuf"
+.LASF795:
+	.string	"GYRO "
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1155:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"mspDirection_e"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1091:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1504:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1578:
+	.string	"sbufPtr"
+.LASF1037:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1615:
+	.string	"mspSerialProcessStream"
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF945:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1588:
+	.string	"closeSerialPort"
+.LASF1488:
+	.string	"endWrite"
+.LASF1491:
+	.string	"FUNCTION_NONE"
+.LASF1115:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF1566:
+	.string	"dataSize"
+.LASF1072:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF990:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1441:
+	.string	"OWNER_VTX"
+.LASF515:
+	.string	"__wur "
+.LASF1302:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1559:
+	.string	"mspPacketType_e"
+.LASF1624:
+	.string	"mspSerialChecksumBuf"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1106:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1227:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1424:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1323:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1269:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF932:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF972:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1084:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1208:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1577:
+	.string	"serialTxBytesFree"
+.LASF1022:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1134:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1373:
+	.string	"MSP_PORT_DATAFLASH_INFO_SIZE 16"
+.LASF1119:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF955:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF976:
+	.string	"IO_TAG_NONE 0"
+.LASF1483:
+	.string	"serialSetBaudRate"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1482:
+	.string	"serialRead"
+.LASF1343:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1272:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1175:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1477:
+	.string	"rxCallback"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1355:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1283:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"packet"
+.LASF1005:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1523:
+	.string	"gps_baudrateIndex"
+.LASF1562:
+	.string	"mspEvaluateNonMspData_e"
+.LASF1314:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1471:
+	.string	"rxBuffer"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1470:
+	.string	"txBufferSize"
+.LASF1455:
+	.string	"SERIAL_PARITY_NO"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1434:
+	.string	"OWNER_USB_DETECT"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF980:
+	.string	"IOCFG_OUT_OD 0"
+.LASF975:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1045:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF973:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1563:
+	.string	"mspPort_s"
+.LASF1574:
+	.string	"mspPort_t"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF933:
+	.string	"PP_IIF_0(t,f) f"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF1546:
+	.string	"MSP_HEADER_X"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1550:
+	.string	"MSP_HEADER_V2"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF1617:
+	.string	"reply"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1438:
+	.string	"OWNER_INVERTER"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF1395:
+	.string	"size_t"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1419:
+	.string	"OWNER_SPI_MOSI"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1326:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF1027:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1137:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF905:
+	.string	"VERY_FAST_MATH "
+.LASF1083:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"mspState_e"
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF934:
+	.string	"PP_IIF_1(t,f) t"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1265:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1178:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1110:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF1203:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"datalen"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF1598:
+	.string	"mspSerialPush"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF756:
+	.string	"CMS "
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF820:
+	.string	"USE_VCP"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF992:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1556:
+	.string	"mspVersion_e"
+.LASF962:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1512:
+	.string	"SERIAL_PORT_UART5"
+.LASF1506:
+	.string	"serialPortFunction_e"
+.LASF1618:
+	.string	"command"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF936:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF1282:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1289:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF1023:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1109:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF1358:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF965:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF393:
+	.string	"__REVISION__ \"17fe620\""
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1576:
+	.string	"mspSerialOutBuf"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF1256:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1030:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF918:
+	.string	"NOOP do {} while (0)"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1596:
+	.string	"bytesFree"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1167:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1173:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1086:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1032:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF996:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1625:
+	.string	"mspSerialProcessReceivedData"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF1319:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1304:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1502:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF917:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1295:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1127:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1570:
+	.string	"packetType"
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF984:
+	.string	"IOCFG_IPU 0"
+.LASF1593:
+	.string	"mspSerialTxBytesFree"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF721:
+	.string	"NULL"
+.LASF1073:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1552:
+	.string	"MSP_COMMAND_RECEIVED"
+.LASF719:
+	.string	"__size_t "
+.LASF1416:
+	.string	"OWNER_SYSTEM"
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1622:
+	.string	"hdrLen"
+.LASF1052:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__PMT"
+.LASF1524:
+	.string	"blackbox_baudrateIndex"
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1525:
+	.string	"telemetry_baudrateIndex"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF919:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF994:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1630:
+	.string	"portConfig"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1340:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1492:
+	.string	"FUNCTION_MSP"
+.LASF1399:
+	.string	"OWNER_FREE"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1158:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1299:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1103:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF1224:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1170:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF1003:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF479:
+	.string	"__P(args) args"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF963:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1589:
+	.string	"memset"
+.LASF1024:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1149:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF1536:
+	.string	"result"
+.LASF1313:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"push"
+.LASF1121:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1244:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1130:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1076:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1286:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1568:
+	.string	"cmdMSP"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1532:
+	.string	"MSP_DIRECTION_REPLY"
+.LASF1055:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1015:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1448:
+	.string	"MODE_RXTX"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1531:
+	.string	"mspResult_e"
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1157:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF1549:
+	.string	"MSP_HEADER_CMD"
+.LASF1481:
+	.string	"serialTotalTxFree"
+.LASF912:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF920:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1422:
+	.string	"OWNER_SDCARD"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1571:
+	.string	"mspVersion"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1344:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF953:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1391:
+	.string	"int16_t"
+.LASF1096:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1380:
+	.string	"short unsigned int"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1383:
+	.string	"signed char"
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1036:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1540:
+	.string	"mspProcessCommandFnPtr"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1341:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF1287:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF1452:
+	.string	"SERIAL_INVERTED"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF902:
+	.string	"sq(x) ((x)*(x))"
+.LASF1614:
+	.string	"status"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1627:
+	.string	"mspSerialReleasePortIfAllocated"
+.LASF1320:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1268:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF1038:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1098:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1006:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1162:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1517:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1518:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1247:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1193:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1079:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1498:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"BLACKBOX "
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1530:
+	.string	"MSP_RESULT_CMD_UNKNOWN"
+.LASF1059:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"openSerialPort"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1436:
+	.string	"OWNER_OSD"
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1308:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF974:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1010:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1610:
+	.string	"bytesSent"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1201:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1025:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF942:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1545:
+	.string	"MSP_HEADER_M"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1211:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1597:
+	.string	"serialPort"
+.LASF1458:
+	.string	"SERIAL_BIDIR"
+.LASF379:
+	.string	"__linux__ 1"
+.LASF1016:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1039:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1516:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1214:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF776:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1508:
+	.string	"SERIAL_PORT_USART1"
+.LASF1509:
+	.string	"SERIAL_PORT_USART2"
+.LASF1510:
+	.string	"SERIAL_PORT_USART3"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1513:
+	.string	"SERIAL_PORT_USART6"
+.LASF1514:
+	.string	"SERIAL_PORT_USART7"
+.LASF1515:
+	.string	"SERIAL_PORT_USART8"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1480:
+	.string	"serialTotalRxWaiting"
+.LASF997:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF1290:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1389:
+	.string	"long int"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1122:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1008:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF914:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1412:
+	.string	"OWNER_PINDEBUG"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1331:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1101:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF1369:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF390:
+	.string	"SITL 1"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1058:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1196:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1082:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1142:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1028:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF929:
+	.string	"EXPAND_I(x) x"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1394:
+	.string	"uint32_t"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1463:
+	.string	"serialPort_s"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1474:
+	.string	"rxBufferTail"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1205:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1561:
+	.string	"MSP_SKIP_NON_MSP_DATA"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1580:
+	.string	"serialWriteBuf"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1116:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF910:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1275:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF492:
+	.string	"__flexarr []"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1579:
+	.string	"serialEndWrite"
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF949:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF366:
+	.string	"__k8__ 1"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF948:
+	.string	"UNIT_TESTED "
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF1413:
+	.string	"OWNER_TIMER"
+.LASF1085:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1263:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1125:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1298:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1390:
+	.string	"char"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF1220:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1634:
+	.string	"baudRates"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF981:
+	.string	"IOCFG_AF_PP 0"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1050:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1215:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1033:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1301:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"SERIAL_PORT_NONE"
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1594:
+	.string	"portIndex"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF1199:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1145:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1107:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1631:
+	.string	"mspPortToReset"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1527:
+	.string	"MSP_RESULT_ACK"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"__need_NULL "
+.LASF1629:
+	.string	"mspSerialAllocatePorts"
+.LASF1632:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1456:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF954:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1595:
+	.string	"mspPort"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1425:
+	.string	"OWNER_FLASH_CS"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF927:
+	.string	"STR_HELPER(x) #x"
+.LASF1151:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF1417:
+	.string	"OWNER_SPI_SCK"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF999:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1409:
+	.string	"OWNER_ADC_RSSI"
+.LASF946:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1262:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1161:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1200:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1581:
+	.string	"sbufBytesRemaining"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF378:
+	.string	"__linux 1"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1242:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1128:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1188:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1074:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1152:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"serialPortConfig_s"
+.LASF1526:
+	.string	"serialPortConfig_t"
+.LASF1071:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1337:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1359:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1053:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1454:
+	.string	"SERIAL_STOPBITS_2"
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF383:
+	.string	"unix 1"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1626:
+	.string	"headerState"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1575:
+	.string	"mspPorts"
+.LASF966:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1148:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1620:
+	.string	"mspSerialEncode"
+.LASF1094:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF967:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1554:
+	.string	"MSP_V1"
+.LASF1555:
+	.string	"MSP_V2"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1064:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1396:
+	.string	"double"
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1420:
+	.string	"OWNER_I2C_SCL"
+.LASF1418:
+	.string	"OWNER_SPI_MISO"
+.LASF1040:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1421:
+	.string	"OWNER_I2C_SDA"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1442:
+	.string	"OWNER_COMPASS_CS"
+.LASF1367:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF941:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1164:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF398:
+	.string	"true 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1328:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1305:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1611:
+	.string	"frameEnd"
+.LASF1457:
+	.string	"SERIAL_UNIDIR"
+.LASF1388:
+	.string	"__uint32_t"
+.LASF1569:
+	.string	"c_state"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF1599:
+	.string	"data"
+.LASF1266:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF1370:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1309:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1070:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1007:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1346:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF1519:
+	.string	"serialPortIdentifier_e"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF983:
+	.string	"IOCFG_IPD 0"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1191:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1077:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1522:
+	.string	"msp_baudrateIndex"
+.LASF1472:
+	.string	"txBuffer"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF935:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1374:
+	.string	"MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)"
+.LASF1257:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF995:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1013:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1362:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1505:
+	.string	"FUNCTION_RCSPLIT"
+.LASF1363:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1232:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1347:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1582:
+	.string	"serialBeginWrite"
+.LASF1095:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1437:
+	.string	"OWNER_RX_BIND"
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF1251:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1440:
+	.string	"OWNER_TRANSPONDER"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1097:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF1043:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1163:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1478:
+	.string	"serialPortVTable"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF1176:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF1453:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1493:
+	.string	"FUNCTION_GPS"
+.LASF1051:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1449:
+	.string	"portMode_t"
+.LASF1018:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF938:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1565:
+	.string	"offset"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1500:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1528:
+	.string	"MSP_RESULT_ERROR"
+.LASF1430:
+	.string	"OWNER_SPI_CS"
+.LASF986:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1462:
+	.string	"sbuf_s"
+.LASF1398:
+	.string	"sbuf_t"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1590:
+	.string	"findNextSerialPortConfig"
+.LASF1310:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF846:
+	.string	"USE_I2C"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1623:
+	.string	"mspSerialCrc8Buf"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF797:
+	.string	"MAG "
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF1248:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1461:
+	.string	"serialReceiveCallbackPtr"
+.LASF1329:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1557:
+	.string	"MSP_PACKET_COMMAND"
+.LASF1567:
+	.string	"checksum"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF911:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF944:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1194:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1616:
+	.string	"mspSerialProcessReceivedReply"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1140:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF951:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1026:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"OWNER_ADC_BATT"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1154:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1619:
+	.string	"mspSerialProcessReceivedCommand"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1235:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1065:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1489:
+	.string	"serialPort_t"
+.LASF1400:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1606:
+	.string	"mspProcessCommandFn"
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1118:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1068:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1539:
+	.string	"mspPostProcessFnPtr"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1377:
+	.string	"MSP_MAX_FRAME_OVERHEAD 9"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF947:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1460:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1100:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1054:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1350:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1212:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1592:
+	.string	"findSerialPortConfig"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1334:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1564:
+	.string	"port"
+.LASF979:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1450:
+	.string	"portOptions_t"
+.LASF1423:
+	.string	"OWNER_SDCARD_CS"
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1604:
+	.string	"mspSerialProcess"
+.LASF915:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1011:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1009:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1468:
+	.string	"baudRate"
+.LASF1529:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF1332:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1218:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1278:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1056:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF737:
+	.string	"USE_PPM "
+.LASF1444:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1375:
+	.string	"MSP_STREAM_BYTES_PER_PROCESS (4 * MSP_PORT_OUTBUF_SIZE)"
+.LASF1229:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF381:
+	.string	"__unix 1"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1143:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1089:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"long unsigned int"
+.LASF987:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1439:
+	.string	"OWNER_LED_STRIP"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1238:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1184:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1543:
+	.string	"MSP_IDLE"
+.LASF1376:
+	.string	"JUMBO_FRAME_SIZE_LIMIT 255"
+.LASF1479:
+	.string	"serialWrite"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF1548:
+	.string	"MSP_HEADER_SIZE"
+.LASF1049:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF964:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF988:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1558:
+	.string	"MSP_PACKET_REPLY"
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1426:
+	.string	"OWNER_BARO_CS"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF1609:
+	.string	"consumed"
+.LASF907:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1427:
+	.string	"OWNER_MPU_CS"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1381:
+	.string	"unsigned int"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF1365:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1560:
+	.string	"MSP_EVALUATE_NON_MSP_DATA"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF921:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1296:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1459:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1001:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1542:
+	.string	"mspStreamFnPtr"
+.LASF1405:
+	.string	"OWNER_ADC"
+.LASF1386:
+	.string	"short int"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1431:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1057:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1366:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1335:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF30:
+	.string	"_LP64 1"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF1281:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"frame"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1464:
+	.string	"vTable"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF1408:
+	.string	"OWNER_ADC_EXT"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1401:
+	.string	"OWNER_PPMINPUT"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1467:
+	.string	"options"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1428:
+	.string	"OWNER_OSD_CS"
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1322:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF969:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1202:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF1105:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1092:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF998:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1656:
+	.string	"streambuf.h"
+.LASF1674:
+	.string	"long-double.h"
+.LASF1681:
+	.string	"__locale_t.h"
+.LASF1683:
+	.string	"platform.h"
+.LASF1664:
+	.string	"target.h"
+.LASF1668:
+	.string	"libc-header-start.h"
+.LASF1666:
+	.string	"stdbool.h"
+.LASF1649:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1638:
+	.string	"src/main/common"
+.LASF1653:
+	.string	"stdint-intn.h"
+.LASF1684:
+	.string	"common_fc_pre.h"
+.LASF1648:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1651:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1675:
+	.string	"stubs.h"
+.LASF1661:
+	.string	"msp_serial.c"
+.LASF1690:
+	.string	"io.h"
+.LASF1643:
+	.string	"src/main/target/SITL"
+.LASF1660:
+	.string	"msp_serial.h"
+.LASF1641:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1693:
+	.string	"io_def_generated.h"
+.LASF1642:
+	.string	"src/main/msp"
+.LASF1682:
+	.string	"strings.h"
+.LASF1670:
+	.string	"features-time64.h"
+.LASF1652:
+	.string	"types.h"
+.LASF1647:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1691:
+	.string	"io_types.h"
+.LASF1672:
+	.string	"timesize.h"
+.LASF1640:
+	.string	"src/main/drivers"
+.LASF1650:
+	.string	"/usr/include"
+.LASF1637:
+	.string	"src/main/build"
+.LASF1685:
+	.string	"common_fc_post.h"
+.LASF1669:
+	.string	"features.h"
+.LASF1677:
+	.string	"typesizes.h"
+.LASF1680:
+	.string	"locale_t.h"
+.LASF1657:
+	.string	"serial.h"
+.LASF1639:
+	.string	"src/main/config"
+.LASF1678:
+	.string	"time64.h"
+.LASF1654:
+	.string	"stdint-uintn.h"
+.LASF1644:
+	.string	"src/main/target"
+.LASF1686:
+	.string	"utils.h"
+.LASF1645:
+	.string	"src/main"
+.LASF1658:
+	.string	"resource.h"
+.LASF1688:
+	.string	"debug.h"
+.LASF1679:
+	.string	"wchar.h"
+.LASF1692:
+	.string	"io_def.h"
+.LASF0:
+	.string	"./src/main/msp/msp_serial.c"
+.LASF1646:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1662:
+	.string	"maths.h"
+.LASF1659:
+	.string	"msp.h"
+.LASF1663:
+	.string	"string.h"
+.LASF1673:
+	.string	"cdefs.h"
+.LASF1667:
+	.string	"stdint.h"
+.LASF1687:
+	.string	"build_config.h"
+.LASF1655:
+	.string	"stddef.h"
+.LASF1676:
+	.string	"stubs-64.h"
+.LASF1671:
+	.string	"wordsize.h"
+.LASF1689:
+	.string	"parameter_group.h"
+.LASF1665:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	"\006"
+	.string	"\b"
+	.string	"\r"
+	.text
+	.section	.gnu.lto_.icf.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\037\002\005\013"
+	.string	"\002N34pk\322\030\323\345\035u\340;\004\236X\240K\225\253e\300\320#Y\336NKe\tP\007\201p"
+	.string	""
+	.string	""
+	.string	"H \250\3578i\204l\262\t\331\222\020\262\367N{\007nV\266\017F\243\357'4\302H\350HC\206D&\021\260(`\300\034%B\260\030T\t!\262\331\256I\245\001\302\331h<>\365d\b@\326\314\326\226|\235\311\205\016\207\212}\27786\231>:\224\f5+\333\0073\325k\275\322\257\351\273\277\253\037\200e\031a\214H+\355N\370\334\255\253}>\017\240B\0224\027)y:\034\227\030\227P\302\205\013\227\222\323\300u"
+	.ascii	"\272\320\300\270\364\322Ch\202\".\177\3038\374\375\3577V=D\033"
+	.ascii	"\234\347vOQ\0246\021NsP\013G\250\361\271\240\002\241\322\224"
+	.ascii	"T3\007\240\202\241\"\333\001\022`\304\025\317R\245L0Ui\255\365"
+	.ascii	"\357b\013\354\030Fe\376\272fS1\275r\026S\365\002\2763\330C\340"
+	.ascii	"\356\337\363[\360v\301\365\375\372\311\352\340n\277xe\356\365"
+	.ascii	"\364%u4\231\262\227(\251\363z\t\365\274\325zV\366N\342\271?O"
+	.ascii	"\250\354\001\202\312\033\252\223p\304\216\202\233\b\207\201S"
+	.ascii	"v\260\037\210\326\t\262\351\035C`N\3463\317\350b\024\3472j\240"
+	.ascii	"\351~\377*\376\001\005rd"
+	.text
+	.section	.gnu.lto_.ipa_sra.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\255\004"
+	.string	"\302\004\r\024\300%\303\001\300\377\377\177\347Z\333\255\025\213\254\275\267\224)\005\352\034,\320\3069"
+	.string	"X\227n.\b\335G\341\225uD\037,2z\304\rm\247W\317y\234\020+ \200\202\021;\3630\neoHH\256HxE\263x\367\217\021i\203k\203\323\210\203k&g\206\270E\027\202\321\272\302\277x6>\036\bt0{'%\203\300&\207m\364R\304\210\200,B\206\250\324\340k\327\360{C\""
+	.ascii	"\003\310\3672X\350\006\bm\230K.\246\032\243\313D\242\225!"
+	.text
+	.section	.gnu.lto_.inline.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`M\013\355)"
+	.string	"\206\267\273H\220\332M:\330\213\320\2320\273>\024\352\332\024\005\022t \034\310\260\235\302\263\343\342U\215\313w\327\365\202\272\"\021"
+	.string	"\265\300\331\317v|b\306\231\355U\253pk1\001\260\002\300\313\204\266{\257C\323\322\321\266\021\273\267\224)\230"
+	.string	"\250"
+	.string	"\253"
+	.ascii	"\274L*\026my\306\253\3051QT\210\375'H\340\031\277TV\276S\213"
+	.ascii	"c\243\375\237%\265:\034\002\311\3520\210qF\213&\021\213\330\305"
+	.ascii	"\360+X\013#\216\213v\237V\207\215\376\355\371\345\031u\270\350"
+	.ascii	"\b\276\035\346\360\f\215\261]\361\371\235p\376\267\321\277\307"
+	.ascii	"s},<-\3133\371\036\277\276\236"
+	.string	"7Du7\355\017\342\032\355#.\314\017\340\245\274\237_\337$v\367\rn\377\336\351\236\317\034\270\273{\374\205f\r&+0\222\377\013\340\345\375\n\315\037LV`\265\277<I!e\356\352E\215(~m\362\272\025\233\272\326\355u\335=\334[\271y\224\344\373\360\224\036S\210{\332?`\363\347\255\031i\305\013\2538R\352\303?\256\247\346\363\246\2121e]\022P^:\322\265\343v\037\346\342Deh\023CI\224\342H\316H\n\023E)\325\300]\274p\020y\376T\346\262\273{\246\020\340\030\221kw\003q\222\260\"bU\007\241\201\246\024(#\303:\201*s\255\315c\037SWZ\3436\327\332?\374\343:\262\206_+\007\306}v\326uwo\226\225\225\215\215?\211\356\376\375\021\376\343x\367\274y\234\216@\354\344\n\022\324\203\332\n\315 UN\004\033@\030\277\023\276\322Zw\302%'\375o\263\340|\020"
+	.string	"\327\327\336\334\321\205d\205S\177\346\r)5\277=\3233\005\232\303&\251\257==\r\232W\304\220\250\b\\\367 &\342\202\205\0242\210\225\234\212_\344\337a.\341\n\033\346j\377wx\311\317\333x\233\354\016\027m\205q\207\215xV\002\f\026\255o\251\315\2766\312]O\236l\330\f1\020%4C\310\357\204\337\t\371\345\317\264\344\321\332\264G\257\353\236\271Ec\211\310gv*z5\237\362hZ*\356N]Q\001\243\257\271\332\235+\313\007f\231I\203{\272*&\345<g\253\373\227C\036\207|o*Q\211\221\341!b\224\222\020\320\377"
+	.string	"\257\001\336\245_\017\334\"E\320\307\016\256\264Y\337\024vw\375\315\321\370\373\346\021\024\026\262\034>\n20d7\277\225\324f\206\311\351c`X\325\027\177`\035GXK\031\n\0201\n-9\262<\353\266\357\204"
+	.string	"\370_\260\356\337M\210\1778y\221Q\236\374w\254_1\376\036&\260\211\313\227\004C\363\205V\031\224\005\257\355qf\344\244\255\271\315\376\373XFUU\031\233\177h\002\251\210\004q"
+	.string	"\202\267\364\2402\301"
+	.string	"W\367\001h\177.\007#\310\304\202\366\373\002\2014\250a9S\206dD$)H\n\205\016\361\004\204Y\b]Q\017\022`\2645\210Z\246T\rIR(\355\265\035 \320Z\n\273r\217\310\257\233\212\212\247&\023\2201\351_\273\201\267\200$*u\256\217'\371\270\252\031S\226E\363\001\273}=nI\005 \210\254\333\031\364C$`\353d\310}\334\303<YC\300\265\246\320\2245M!`\241\327\270G\231\311\374\f\211{~\004A\363\2625\001K\245\341\370\362\302\222A\251\324EV,U\303"
+	.string	"\265\264"
+	.ascii	"\013q\345\205@E*@h\355\211\326Yl\035\0226\304\265\307\005\364"
+	.ascii	"\315\r\353\215\375B\207)\2710\246\276\226S\245\317\262G\201\204"
+	.ascii	"\200\343{\020\267\204\215bU5\\\340\371@\305l\342\244)$\207\004"
+	.ascii	"\257\271\r\346\372\324\312\327M=HV}\244S\324r\006|\221\370V~"
+	.ascii	"|*}\022AN\003\350\034\001\373\024x\034\t\032\022=\300h\300\215"
+	.ascii	"B\017\322\016\0249\267\335b\016\263\235\246 LA\032J(\307\267"
+	.ascii	"\262\366\312\210\227gX5j\302\331\202\363\271\273q\nt\003\271"
+	.ascii	"CO\307\273l\347\340N&\021\002\335\035e\207<e1\277\354\311\023"
+	.ascii	"\251\"\337\214\331\352y8\247\256\231\370\212\273\205U\033\271"
+	.ascii	"\\#[[J\0053\253\345\321\304d\232\213\003\231\022\264\261\221"
+	.ascii	"Y^d\0354:\016g.\340\201\322S\226\235L\371=\233\003\315\020\027"
+	.ascii	"g\205B^\235\201\367YC\255\250\020:=\f\036\256\004\332\020\231"
+	.ascii	"wE\\\336\313f)\317c\265\362B\270C\310\302\271\347\007\262\372"
+	.ascii	"y\320\261\tIL;\037CQ\311\254 \373\027\002)t\3268\300\346\265"
+	.ascii	"\314k4\224@i\215\031\016\303#\356&\234E\034B\322\354\344\210"
+	.ascii	"X{\327\337)b\n,\031\312 Y\252\267\267\305\341:\302b\214a\244"
+	.ascii	"\0263\303\222\247Y9\217{\263\235Y\270\202\274\244H\237k\365\255"
+	.ascii	"qI\036\322;\022\204z\311\215\353\247\256\0365\017\032\367N~\277"
+	.ascii	"\276\212\257\300\312\325\243\323\031\232\276C\004\r\031g\034"
+	.ascii	"\253Ec\302\372\303\356f\005|\217\240\320J\243\352x@'\032\b\036"
+	.ascii	"\215\273\234\337\"\034\230\241x\251\312\267\241\317\237\022J"
+	.ascii	"mW'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\367\005\345\020"
+	.string	"\026\226@5@K\224t\303\2006\305;su\354\2359\314\331\3552\"\343\306\326w\263\004\b\003\222e&\233\357\350.pT\214Y\364\207E\306\251\f%\223je7Bd\222\001/"
+	.string	"/"
+	.string	"5"
+	.string	"<\022\332\2009X\026\351\255^\364\255\364}\261\277Xg\246\013\202/\210\3070\312Sk\030}\026\322W/\300\367E\217\275F\257\301\257\250\240}\b\212\021o\231\304\372h\270\223!\366SG\352\257\332\006=\263\203\365\350\t\225\307\340\316\371\fw\253\243\227\340\303\247WC1\342\210\351\301Jn\271\fG\301\212\271\nV\016'\326\237\005kI"
+	.string	"\325T\370\206\3254\275\300^\303\271\013\035\302|\364\305\256\236zH\372\303`s\222YB\243\334a\037AA\025\355A\202\006,`\351E\b<\3058\305\372gx\275\362\201\240\267\350=z\214\336\323\377R<\233gS\2512\222\321"
+	.string	"\351\372-I?\320\263\bh\247\023IL\260R\251\003{\250\2419S#$M\222L\333\001P\002!\245\252\312\003\022@\0021\206d;\2269Fj\206DIAR\277\032\003\303A{\224\211\340\r\361\266P\221K\3546\301\345\007@B\332\033\026F\340'\031\013[\210\205\3004\005WL\227\344 \304\213\\\375\030"
+	.ascii	";\220\315E\342\021T\006\243vuer\240\355J)\333\221\377\313\220"
+	.ascii	"\316\027fJ\264X\024\316\211\270\275\302\244{e\0200lG\306\017"
+	.ascii	"\245\301\340?\325\347zS_\001\350d;\324\340\017\302\200\341\374"
+	.ascii	"q\210\347\250;\275\256{\365-+\005g:\332\206\006\372\004\221\201"
+	.ascii	"\371g\375\372\311\315\204\\2\355\242\210\304M1E\330;;\266R \241"
+	.ascii	"\020\206[*\275\275\344\235\235\200\030-\276\201,y\304\030P\362"
+	.ascii	"\337\345\373x*\025\311\304._\255\201\231\250h\333RXc>\243\333"
+	.ascii	"gUq\222t\304\221\207M\231\246\016\020OV\310\031\031\326\b7g\257"
+	.ascii	"a46\007\206\373\365\020\202\b\272\357 !9K\345G\262<\325|\321"
+	.ascii	"\001\031"
+	.text
+	.section	.gnu.lto_.pureconst.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\205\004\001\232\004\002\232\004\003\232\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\b\232\004\t\271\004\f\231\004\r\232\004"
+	.ascii	"\016\231\004\017\230\004\020\231\004\021\232\004\022\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\233\001\265\t"
+	.string	"2M*/`k\222\016PM\031x\004Z\302|\036\242\207\324\021\202\020\242\226\3240d\320\307\b\032\265\033;\306\363\325\330\t\032 \232\242\206\330\326\332\2262\005/4<(<?!\030\302t\340\337Y\020&p"
+	.ascii	"\303&Bml2\025\026\306$\236\023\204\271\210\362CJ\351\234\006"
+	.ascii	"\350\2222\311\242\232\234\346B?\225\342\345\265h\231\344\007"
+	.ascii	"\275\023\032\365+\367tT>\347!T\333\005\241\031\364\221\326-R"
+	.ascii	"I5c\256\324\231\317\241\347\\h\330\204E\273\035\265K\022\331"
+	.ascii	"\234\027p\314\327Zc\336#\345S\211q9\377\321\234\366`\367\032"
+	.ascii	"\372R\004A\250\201\271372\222\024V\213\001P\002A\352\354\016"
+	.ascii	"\0208\252\202\031m2\214\001\004\254\272\037\217\301\277\217W"
+	.ascii	"D\277O\346I\207\353*`\201J\212\371>\260x\331\352\266p\303\315"
+	.ascii	"\220]R\236!\346\232e\234\225H(\325b\346_\322\311\327\361]N\266"
+	.ascii	"I\206b\214\322|\332\206\027\325s\246\005\367d\024\3129Fl\005"
+	.ascii	"\250\347\314\316\255\005m\r\220\350\242\362/\357D\243\367\324"
+	.ascii	"+\3226\324\275\301^;[\027w)\013\246.S\017\370"
+	.text
+	.section	.gnu.lto_.lto.78a952ca00fb31b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.14.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"E\013"
+	.string	"\326\325OC"
+	.string	"oj:\300&\320\243\336\257\n\253\f\321d\360\022\244r\235$\341\250B\372G\314\240\f\016\024*\1775#X4\215x\r\337/"
+	.string	"\017U\255\020\324\240\t\350b\243!41\221\214\034%8#D\233l\231R9"
+	.string	"<"
+	.string	"<"
+	.string	"\233\n1bw\f\361E\373\364\370-\373\324\316\221}Z\264U|\254\260\033\023\rZ+v\227\223\024.^E\377\254_\234P\243\353\204dw\255'\024\204[\336\266\305\266"
+	.string	"\373\226\343H\345\004\373\330\356\256e\312\276:\373\370c_\375:\241\224\330D\354>x\265X\327$\201\301\366)v\205\265\321q\201\207\3062\370\340\240D\373\254l\330\\\355w\270\007\361+\32176\266w\020\007\264\335\035\361[\n\300-\305\205O_\224}\202X\210@\322\227\317a\352]\367\211\354\362L\332\b\022\350O>\353*\301$G\276\352*3i5e(\351\313\233\006\024\253,\354\341\347q0L\240\323h\272\214H\006\323\021v`\007\300\013\020~\036'\004\2022\354\301\024\350|\276\016\034\020\002A\234\201O\007\304y>\220\303|\330\013u\037\027z\336\307Q\306=\2662\345\251r\221d\311\230\f\016"
+	.string	"S\r^\240x\2743<\323^R\326"
+	.ascii	"\313\002\226Y\263\252\355p\341\255\205\261A\341 \324\300q7\026"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.15.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`)\005\235\""
+	.string	"\326>\335H\200\030R:\177\001#[\004RA\333\207=\300\003x\325\265U\205\257\027\360^\323v HG\273\340\330e\275\3119)\330\347\024a\220\200m\3773\346\303\3619\253N%\301B\247\232\032\034\247R\021\322\332\377\266O\310\226;\311\317"
+	.string	"\274"
+	.string	"\313"
+	.string	"\374%|&7c\037P\r\347\223\032\031\022;\312X\254\311}\330\035\375\225\234\214}?s\r\036 \337\204\262\367\206\204#n\032vG\201\224C\037{\022\344\231.\212\246\254.\300\215y\273\267\251\340(+\330\035\345\346\205\351\321\335\003\244G\031\311lF@\325\257K\322\271\346\336;\354\036\354\253\310\367|<]\212\332\256H>\216s*L\223e\324{VW%\003\310\331f\340\260Droh'\233\252\276\024K\353<\235\215\247\366\347\313\032\221\3402i\013\344\330\341\304\267|QQ\bg\320tae\335\332"
+	.ascii	"YO\300\004\227Uv\001\230!8n\366z\265\244\252}\262\033\020S\033"
+	.ascii	"\213\353\302\322z\325\025\335{\271*\227X\347\337\231Y\214\231"
+	.ascii	"\223\230\355\233}\347ApIEy\032\360\245d\346\026\207\022\"\201"
+	.ascii	"\230{/\221\223?\021\301\377q\224G \325+\217\362\221\322\243\302"
+	.ascii	"\256m\312\032\300~[7\3117Ru\216o\366]\033\026\266~\246U-\233"
+	.ascii	"\205il9}\346\203\202\365'\246\314(\222\352\2259}\035\\T\035\305"
+	.ascii	"B+l\207J\337|\004.\251\312\206\0176#\016\356V6\314\315\250\332"
+	.ascii	"^\314'\372\2223\303\315\203\331\247\207\347e\347\235;\317\302"
+	.ascii	"\034\234 \360\315\363\257W\331\327\253\334\353U\346\361*\353"
+	.ascii	"v\225S\2642\252\253l\317<wZ\271\242\225\377\323\312\344S\347"
+	.ascii	"y\257\214\2716\327\013\212\026\344e\277\363g\376\315[\346\003"
+	.ascii	"\321\030\n\315s\271\003u\247\205\315\2144\202DR\257\344\240\252"
+	.ascii	"\216b\2478\3463\030[_R\026\351N\032$,\016n\247_\366 \002\225"
+	.ascii	"\217T\222\366)\244i\363\215\322\237]\327\314\025,\324+w\332\336"
+	.ascii	"\254\216bf\f_\313\200\340k\202\030]\327\260\246o\321\260\273"
+	.ascii	"\227\212\210\237\345Z6\330\016G\351\225G\351\321\264\037\306"
+	.ascii	"\r\3156\332O\276a\366p5\250\335\323H|\330\375p\221\036\265\r"
+	.ascii	"\340k\013,\r\337*K\f\037hPkl\353v\027;u\361\3517\037t\250\024"
+	.ascii	"\330>]\323\274\330\232\252s\354\304\345\225\331F\215\233=\246"
+	.ascii	"\265\215ec\250\252\0343\2038\225\343\002\2615\367\336!\264\020"
+	.ascii	"\033\304\212H\371\224\247\364hm\035\037L\242\026aM\306\"\007"
+	.ascii	"\246\243\222\256\311X\344\320[A4\261\204\201\307&\210\016\034"
+	.ascii	"\020\0314` \244\203\"\351\304R\321\250\311Xd\352q\t!\025HIF\342"
+	.ascii	"q\004\323Qi\270\224\204\2444,a<\016\205|\270\310D4\016\233\212"
+	.ascii	"E\343\320\327\274o\036V\bW\334\233TO\275\365\332\353\b\n\220"
+	.ascii	"\232\323ly\335\301\276:\331-\200m\325?\317\226\207\323\300\276"
+	.ascii	"\342\247H}m\324k^\373\272\272I\336\250\275\266m\311#W\036l^\277"
+	.ascii	"-Y\205\354\031\312\204\305\301\001+\027\331{\357\365\031\260"
+	.ascii	"J>u=\3156\330\335Wlu\277"
+	.string	"^J>\255O\343\234\327^\303+)O\263E\201\375\353+\346\236\2633#\211\364\264\210\233\3750\314\226\277.\222\322\361X90h\250A$\250\220r\312\b\211\004\"$Ri\306\200\002\0312#\017\020x9M\322\034\331J\201\373`C>@\b`\215\200\013\236\034\b\343Q\0138\345\024\2532\344\2276\225\270\225\334\262o\211jK\325F\337\027\001\006\254h\031\375\256m\240\305\004%v\025T\202\235\237!\034\241\222\fY\331\227<\361O\337\t%\030\201-#(t\203`\021M6\272\177SHm\342\306\374D,\371\261\202\240~i\"\374U\005j\304\013\236`<\177\343\273h\310-=\224\215#\237T\037N0\345!C\262\314\232\364\001l\325V\254\300\255\0069\351\276B\267\031\234\257\324\023'\203\017\227n\221a\272}\273\016\241\232\022\250\0321W\342\367\220\360\273\210'\"\204\230Q\266\216?:\267\313\266\356\324"
+	.ascii	"\351\305\314\037"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.16.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\315\002\215\026"
+	.string	"\346j\225J\260XQ:\300W~4F0\225\343\0241\211\277F\240\223\005\202\213f\376\266F\t\330\222\202\210=\315f\255\236\001:|\325\315\026\037\255o|(}\215\273sx\344/\372i\224\262/\306Fu\311h\033\032\307 \204l\262wJ\001}"
+	.string	"z"
+	.string	"\202"
+	.string	"\237\366i\274\306\355J\032\036`\027\351\t\220]\337\002\317\220\257\366}\200\370J^\200\370\352\233\r\345\276\023{\246\240\037 \225\335MQ\023\246\017}\2678o\037\305\032\322y\363m\034\201\210(\274\036\356c\030\263\2730\275\237\260F7\305\026\026C\257!\036\206\252'\275\"\230\336\206\260\374"
+	.ascii	"E\311\201\237@\275\335\244_\272\002\242)\274\336\320\347x\263"
+	.ascii	"\273\236\274\236\207\233\274m\020\266u\354\031\f\357\021\377"
+	.ascii	";\204\243\334t\362\227\036\276(1\203FGv:\331>\334\244I\366\277"
+	.ascii	"\273k\212d\227W\372\3117\335\343\1777\255\3233\234\276\213(\303"
+	.ascii	"H\201(\273BOV\266H\025\242\342M\377\017\245d\3453\371@\227\250"
+	.ascii	"%+\273\211\347\353\323\201\005H'\024\201"
+	.string	"|E\rY\371>\177\311\345+\212\310\312\266m\030\334\376\353!w\305\250\203\211\203\224]\337\314\253q\310\327\2276\352\307*f\265|(\316\242\213\227IR[\0076\317\263\314\216\342\f\023l\341\245)DHB\232d\222NJcj\262\233UlS8\220\013c\020\0361vw\365#\366\202\273A\245\307}\360\210\257\223\036h\242\344\022dqd\244o\272\204\243\334w\360$`\262\273\347\331\316p\0351\325\211\335m\200\3439d~\212W[\250\315\363^\375\232\370:\322\231\2047D\351\251\b\374\271\222\233O>\360\017\n\222\240\273\213\243v6\232,gV\303y\331X.\230k\207\325\212\301\360r\355<\260\321d3\026\273^*\325\253\306\246\206\206\200\215&\313iq\213\246\002\013F{\325&\314j\261\324\016\214\025K\265h\265\024\215\001\313f/Z\312&\223\321R\245o\377\245H\267q28\243H\216\352F\232d"
+	.ascii	"E\265\244\025\305|\360\224\0029p\262\233U*\214\022\224\336\344"
+	.ascii	"\246\323C\261\244\377]\346=\"\245%\275\317\b\335|:\215\240\321"
+	.ascii	"\2541\363Ln\"\342\314G\3522 @\002\202\320]y\034\256;\307\177"
+	.ascii	"c\314\343-1\332\026\267\223%\033\223j\266G4p\214\030\201)\033"
+	.ascii	"\372`r\205\270\275\342H\375q\272\364u\020)\263x\003\033\201\002"
+	.ascii	"\270\027\231\222\035\025\230\372\205\022N2\312\351\221\023\b"
+	.ascii	"\336\020\321\262\204\373\t\201\202\342\342\216\303d\r\250 \264"
+	.ascii	"\367\0138\220.P\202\337\273\362\266K\261\210\355\240z\256\177"
+	.ascii	"\353\305\334\267\275*)\356\264\201\f"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.17.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\326\025\245N"
+	.string	"Jx\314\032B@bR\007v\325\334C\343\302\256\036c\022\333\025j\226\366S\230\177\231\003\3469:\210;\022m\254H\001\"\357\326U\004\bi"
+	.string	"\2143g\330\032\211.e\266\373<\020\361Xf\315/m\267\335{\313\224R\237\001r\001\244\001nu\357\366%\224.]\\F\331\342\\V\270\025\f\216\301\3005\\\254\341\311"
+	.string	"\273+\364K\"\004\332\261\264\327uqi\204\200\323y\226\025\256\005\005\263\00556\013K\003S\345\312\335\206"
+	.string	"\273\313l\277{Ew\261{\251F\240}\247B](.s\343\346"
+	.ascii	"vwyF\340\277\333\253\270\334\n\237S\201$\024\267\240\203\001"
+	.ascii	"&\216\251X}\005\273\333T7z\335\205\275\350u\267\273{\200\201"
+	.ascii	"\025-\346\324\266\032\3072\037Q-~\342\230\352\314E\\\314\233"
+	.ascii	"VUTSRQPON\314&\246\245rI)\t\351(i\204,\"\032\022\n:\002\031\213"
+	.ascii	"\304!,|\3356\277X;\321l\314\233VUzyO\205v\367Sh_^\312\235\262"
+	.ascii	"$\252m\342\t\303\247\006\234\324\343\246^\036\312\256\313?91"
+	.ascii	"\271l\371\246.\356\2647E\263\362L-\001\027~\322|ojm\215\201\321"
+	.ascii	"7~e\356\227\312\245*T^In\312'\311Iy\244$\034i\236\243(I>i\204"
+	.ascii	",:\322"
+	.string	"2\343\246F\236H\250\3454\224\321,\021\252\363\026O\215Z\0050\310\231\233\007\265\371x\215\336\256F<\310\324-\037\235\202\234\2559\220Z\235;\305M\327\336Xt23N\034\366\210\233\362xX\3306\327\320\334\360\275\351\216\326\250\215\020:\321\177\023da5\225/\361\372vm\370\305\353\n\265\202\234\241y\27375S4k\361\371h\346\242e\306q\354W\374c\230\225\375\013\265\3428\356\227\232\235y_y\367\007vw\207\356\"\023\001Zc\306\314v\347\177Y\"k \225\342g\263\331@b\366\023\364;\200C.X\376\f3[\3479\034\362E\037\345\r9(\360\317\371\333s\256\267{\313\371\270\242\370\364\034\251u\324\204\231\255\355\\F]\236='\343\376\203\315\353\333\230\367M;\234\267M\373\236\253\246}Mk\306\3178\232\317e\332\363\334O\274\356\372\265\273\355\270\257\331yil\325Z\321\307\266\t'x"
+	.string	"\375\334\314\346^/^\262\255\251m\317\261\256\314\236\267Q\016}\021\344/c\335u\357\3438\036\313^\257g\017t}-\272\374\213\027\034\307\361\201v;\261\263\020\360\021w\333U\274\356zF\272\315\221}\266\375\212[p2\005\364\213_\260\233:\366\231\255\333\3338\017\351v\253w\003\247\272#\3609\367\003\356\367\200\376\0260\374\016"
+	.string	"\177;\341\357\254\366\033\013\376\006"
+	.ascii	"\177_\r\277\233\355\267\325\360\273\252\375\246\202\277\247\340"
+	.ascii	"o)\370;\212\370\rE\374~j\277\235\332o\346\360\273\211\370\315"
+	.ascii	"4\374^\022\277\225\304\357\245\366[\251\375N\032~#\021\277\217"
+	.ascii	"\206\337\311\366\333\b\376F\302\337E\303o\242\366{h\370-\324"
+	.ascii	"~\007\r\277\217\3607\020\374ml\277\213\3607q\370=\034~\303\360"
+	.ascii	"\267\020\376~\207\337\356\360\273\205\2773\374\375\302o\347J"
+	.ascii	"\036YK\023\322\226\343P\343\032\331?1\033\027/IQ,\0246;\2240"
+	.ascii	"\tY\034\245L\f\324\200\203\261\264\342C\250\343LM9\254\222l:"
+	.ascii	"Z{d=+zK\307)\307\234\344A\304\023\206\217\022P6\256\211\002\224"
+	.ascii	"}\214\333\223\2471/\350s\2436B\346$\021q\317,\350\372hHu\214"
+	.ascii	"\361\326b\220\315b\221\032\3047\201\036\361\305q\234\240[\302"
+	.ascii	"3\241\340.\022\253/\355\315\305\334\016F\261\304\274\344\331"
+	.ascii	"\304\347\376|\337L\314\355\340\213\2652+\216!\034\234\207G`\243"
+	.ascii	"\325\306Qfka~s\206\243C\363&\314~\3277\327\366|\263_q'^\026)"
+	.ascii	"n<\371\272\327\313\226u\263\020"
+	.string	"h\233\335\234\323Ds\224}\266\201@\333\301\234\273+\274\017d\316\331.\212%\373\254 \033#\327\275\336\264?\004\031\r\232\007\245~B\277c5\017\r\337\361d\342[\363\271\373\302\347x\272\324\017A\376\234\007\243\3304\310\277Q\3253z\273\276\0259UM\265L\032o-\242\314\006}\2731\374\024\312'\346\371vk\370\031O\2442\214\237\353\220\224\030P\034\206\223A?V\231\b!\253K\272\273\376\205\227\224\333\016\037\034\336\356\r_\306A9\305\207\254\252\005\372\261\332\203\315\330\017\246E\361\013\312l\375@BG\361\002\371\221\002gl\035\305; \307\300\266g\027\350)\211\177\b\266\377i;\260\002\207\276\356\366K\3432;%\2009\214\035?q<\346k\b2\263\305c\333X\345\321\007\2714Vu\f\310\256\305Q\374 {\301\366\230\331\036\210\216{\006\n\364:w\031U\034z\336\001])BT\330\n\333\372"
+	.string	"w\205m\205U\370\352\372\260\325\005\242\310\345\375\241\253@\201\256"
+	.string	"\003\002d%\303\276JL0\0016B\330\\Y\"\266B|u\201q0\0016\302I\"\304\326\b'\327\027\2303K\331%Lt}9\303J\224\370r\026\251\261\347!\375\302\261V\357\210\356b\257_q\007n\220T\357r\273\330+@@n-\262\\\326\314d\3316\rM\214\325\313\345X\360s\260\305U\001\260\001"
+	.ascii	"\3378+b\250\2349\353\21730\313\370&[d\252\217\324\227<\"RbC\336"
+	.ascii	"O\237\253\214\005\340\357*\003\320s\365\327\314C\225\255\232"
+	.ascii	"U\331\312N\025\225\236\226\215\\\\\324T\226\2423%G\352\310\004"
+	.ascii	"\217\021(\276<\315$8\362\236`\367z\343\234\201\243\347\346\331"
+	.ascii	"\267\243LT\233\247\235\324\017*Ge\177\312L\031\312)?\345\267"
+	.ascii	"N\024{ufv\312I\327\246\314L\363k\240^U\303\340\233\262W\227\231"
+	.ascii	"\t\353\317@\013\230\301\312\005\372\360\256"
+	.string	"NyJ)\2445\214\367\001\356a\202\275\r\262\007\241Ss\264Zi\220\335\352L\262\027len\2203\234(6\037ee\366\350\r\245\274\224\205vQ,\234\224\225r\322\337\213?H9\351\361~\f\324\355\332\304\270\026>\357\353\353.Rv;7\274d>\312\336Y\017\006z\340\316\231\314\007\372\360\272\270\323\260\312\211\321\023\247\351\371\"\255T,\274\227.E\331\b\311\345\223xQFV\237E\271\251o\216L\n\221\026d\032\251\337\322\007\345\241\334\375 \302\273\224(3]\344\261\026\312CX\240B\271\200\333\\P\316u\002\201\274\250qD\006\0213B\"\"\"IA\222\f\007\341\005\204\020\306\030\232\007\021\300,\250 \232\031\021\021\221\250\240F:\263.\372\237\367}\217j7\305i\225*K\301\316\265$F\222\266L\271d\322(<@Q\177\\w\326\373(M\270\332\3632bO\261\334\352\345hS\21253\336"
+	.string	"w}DA\212\261\002\2703\034\013,\2432\301\352\260A\201\017Go(j\300\323\376\225\021{Jo\373\245F?\204\252\003@w\247\226\235.\030\272q\365\335\222r%\247gmp@\314}\251f&\365#\242\215\244\016\006\303%\360V\270\020]b\003\314\325\232\2204\317\0061\255\353$1W\312\366\020\205\212A\202\r\261\255<\275\310\033\024Z\177@\343\360]\306\332{D._\300%\270`7\177H\271F\3645\355\276\240\344\363\374\242\004\314\326\204\342[C\3217\255\206\216\034\332\023\212\3311\266$\364%\365\025\333\207b\221u\222?\313ETd\312A.Z\266"
+	.ascii	"\300"
+	.string	"9\227\240\022\215\233\032z(\346X\246\243\202m\274\214\342\272\005\032c\037\315\213%\334?\225i\313L?\331T~,Ig@\r\177\n\334\327\216w\235\273\213\273\325\201\276\024\032\003\3712\341([<\247\001\002\203[\320t2\326D\230H"
+	.string	"W\307\352c\345\274$2\304\230E_T\t\266@(\317\255\016H\260\b'\316\314\307\r\324\246<\277u\221\017\t\343U~$]Z\353b~\360\302\f\005\222\300\354\341\303E\026)\253|Y\025\230\0354,\267p\314\3621-A\3550\247\026:\013,"
+	.ascii	"&\312\2405\347\002\363\350y\b\336\b"
+	.string	"-\322\304\332\224&{t\365\200\3037\217\26059E\017\0324\371\367PH\205\332\016M\200\366\021'\377@\205\252H\355\367\224w\236,\264\252\"\253f\277\252;\313\037t\r\002>4\035A\016\265\261\206K\303\234ZL\300Pb\304\036\254\030\327\033\206\307\234$\202\316!vp\233;\t(\231`\337*s\265\311\220+\264p\023\364X\250{vf\347\344\230\025\344`\222\334Nt\350\ti\255\360\243\335x\320\220z\244t\237$\245\351-f\005\264\020!\337\nX\342sPP\207A\202f%\325\270\271d'\202\371\251\013\346\300\200\202)\247\243)\361\226XB\024\342\341goK@\206HX\330\257[h\340\277\256\bpE1S\300\345@\250\306\202\260\224\274\302\274-\306\035cL$9\013\256\220\367\005\321}\224\365\2417\201,\353\367\276\242\204\206Oi\200\302\203\316\202\323\377\234`T\3673\231@\270\240\025\244\370\331"
+	.string	"\032\247\240\251\343\234\240\305\270\374\002\200\237\333\321\372\342\232"
+	.ascii	"0\032h\204\347\213\202\217\254&\033f\266\256\bv\231\025< \\\331"
+	.ascii	"\"\312\031\224\007\230K\205\312\361\036J(V\260(v5X\354\301\n"
+	.ascii	"Z\025h\021S\026\243\027\254\035)L\357\312T7L\204\274\033I}\336"
+	.ascii	"\033\006},J\330\n\3465T\005\343\246)\177"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.18.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\373\001\345\021"
+	.string	"F\242vF\360\356&\035\n\317Z\034<R\220\275\207A`\016\262\013\367xH\201\334\347\035:r\351\372\365\205\357ss\3557V\311\263z\220\323=muq2\377\016\203\2118\375\231)N\323\262I\003\246/\267\246\244\021\262\245L)c"
+	.string	"_"
+	.string	"`"
+	.ascii	"'\325\317Z^)gL\364H99\274\321}\363P\300r\353\263&\206\004\033"
+	.ascii	"\361Rc!\345\374V\203Ga\030\206\217\363\216\332\372\026W[\376"
+	.ascii	"\307\006 \030\031\313\2678\202\305p\b \203\305\017\"!\237\327"
+	.ascii	"\2561\331K#\216\314\367\265\307\234\233\020F&s\035\201H)\255"
+	.ascii	"0\262\t7w\333)\266\033\330z \336\fv)\252\275\317\233\324\235"
+	.ascii	"\366\217>\177\356\263\177;\355\216\237\367\352g\367\001x9A\b"
+	.ascii	"\206\244\214\t[H\024\233O\007\333,\333\2633\206N*\342:\254\323"
+	.ascii	"\374\0231d\013\206\232\036)%\207\031t\3374\242\212\323\252}\020"
+	.ascii	"\017\301\372\\)\200![t$\204\314\017\340\276u\027\300}\313\b\n"
+	.ascii	"J\344nO3=n\267w\3412\363\322\320\257=dF\367\263U-r\\\020W\224"
+	.ascii	"R\312X\332\317\274\325-\255\376\274P\360w\"\250t7\376\n\367\315"
+	.ascii	"[]\021\253\340\322\320\244\375\274\206K\213\234\340\273\244\335"
+	.ascii	"\037\027\017/\r]\342\301\331\035 \230l\255<\026RH-\262'\213."
+	.ascii	"\215\375\217\032\"\241& \311\242RP\"\321\"\340\351\004vxt\230"
+	.ascii	"\b\224\250\254 \244\300\007\251\316)\023\tjD\005\256\034\240"
+	.ascii	"\254J>\223\021T\311\227R\255>S\206OP@\325\227rr\242\372\274)"
+	.ascii	"\037\243\3567\266\013.\270\366e\345\371\260-\215_{\327\202\304"
+	.ascii	"\213\355F\033\r\330,\211\333\335X\t\227-\255\243n\253\033\263"
+	.ascii	"\355\215\307\275\215\316\211\226( \200\202\241\263\315\003T\230"
+	.ascii	"}\330`\261\346\026;]\243\327\025Q\350\376b\214Gh\231\216\213"
+	.ascii	"\264/\301&d\376\222\326,\303\205*Wc\007\313D\376 \313(\364,\024"
+	.ascii	"M\301|\320\375\325\267uo6B\r;\314z\330\250\t\317\230\231\273"
+	.ascii	")V.\354\265\227d\221/\246\374: \"\246\353<\001"
+	.text
+	.section	.gnu.lto_mspSerialCrc8Buf.19.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\036\002m\022"
+	.string	"&\343xF\360\316(\035\237<\254I\213\210\316\007M\224\256\206\241\272\020\213F\037\273\362\326\326n\304\253x\277\200\226\374\325n\363(\035\335\344\333\220\355\367\211\f\"\335\205\255\212t\212A\321\2151\273\305\325\220y;>!{K\231Re"
+	.string	"b"
+	.string	"b"
+	.ascii	"\227\031\032>\325\337^\3369aH\344\314\trxCt\351a\300\345\327"
+	.string	"\301\231\332H\326\343\222k1'\370m\005{a\030\206\217\340\035\365u\031W_>\b\r\317\314\266r\031=Y\215\306d\223E\220\037\037\235\347\2564[L\343\206\227\357s\217\0350\2043\333\313\325\013\231sZg6\bww\333)\266\025\330\272 2\366Af~|\2741\366\311T:\356'\035\374G\277\375\027\307\335\336\301\273\223\277\251W\325\032\325\307 \215H\301\301b\316Z\0304QH\235\f\266]6\311\316\b\361)\210\333\270\216\363N<M\026\n\265\2349'\207\023\210.5\242\207o\325\376\207\327\270\016\252\034c\316\030!\004\340\005t\227\242\007\350\002\367\266\264\027j\201\211\345\376\b4\271\277u\252@\3666\004\026\347\2343\236\3667\221\352\356\332\rZ\372\331i5d\273b\271\273\377\352^\310e\310\277a9\020]\360U\272\313o\314\321$\3004\264i\017^\003\246@.\360nM\033W\264p\210ih"
+	.string	"8\"\366\206Gf[+N\215\212\251@6\270\242\033&+\222M\245\244D\242EV\037\037\253\016\217\016\324"
+	.ascii	"\025K\265V\241HR#\254U\213\001J\253\3443\031I\225|*V\353Ce\370"
+	.ascii	"\004e\305\372RNNX\037\t\234\217Qn\214{`\002lcV\234\035\27126"
+	.ascii	"1\264%\322z\004J\254i\264\335\322\236\273(\250\347\301\236\326"
+	.ascii	"Q/V.\315\2667\356\355-\330\234`\321\037\227\3668T, `\202Q\316"
+	.ascii	"\212\007%\\_\206\333Xk\213--m\251\340Ur\244|\3446\306&+\2542"
+	.ascii	"\t'\371\366\3318\311\034\263aph\333\232P\320\226\233\202\307"
+	.ascii	"\237\350\035\220\246\005\255)\230\013\272^]6\t\330\365j\003h"
+	.ascii	"N+-;\310z\331`\023\03613wk\254]\330d/\313\"_L\371u\240DL\227"
+	.ascii	"x\002"
+	.text
+	.section	.gnu.lto_mspSerialEncode.20.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`1\013\0358"
+	.ascii	"j`\300\024@`\350\312pW\376\027-\264V\035@\273x\b\227\252P\301"
+	.ascii	"}\334c\331\200\251Nh\367\217\306\370\213:w\330\177R\302\271_"
+	.ascii	"\356Q.\314\365^6\\_\370\203\201\357\020#\232\260\333&{o)\223"
+	.ascii	"\f>\001\034\001=\001On\367\337\375c~27w\277\273\307}\230\213"
+	.ascii	"9\336\363V\350T\207LX\030;\204`\3641\356\216\241\221\256P\210"
+	.ascii	"\322\342\n\371\255k\262E\240q\367n\367\322\261dj\267$\207\337"
+	.ascii	"\272\256Z\351\317\2473\343\203\b\307\333\211\245+\224`\230%j"
+	.ascii	"~\353\252\267\340\347\242H\235\330\030\233\377\245\206y\264\232"
+	.ascii	"!q\303R\032\271\213\215A\034\322\237N^\214\347\335\323}\313\361"
+	.ascii	"u7\216\264\256I\312\350\255k]\203]\220\376\334\272tw\367X\236"
+	.ascii	"\345\270\273g\326\311\255\005\317\004\245\201\021\264\256\253"
+	.ascii	"1\352K\350O\363J\350\317^\362\343\223\220\216\214\210EC\241J"
+	.ascii	"\224\242\247\331|\334\347\335\374\203E\016rm\354IsG:br#\276\244"
+	.ascii	"\234\224\344\021&\232\006\256\004\2529_r\316\034`w6\347\306E"
+	.ascii	"\303\"\027\362%\213\020a\365p=\214\234\310\274:\023T\344|\311"
+	.ascii	"!\34600\255\316\363.%%)\204S)\270\036mG\211khf\324\272\256\227"
+	.ascii	"\222l\343\223/\331v\306\346\217\267\251\300\355\315\017\342Z"
+	.ascii	"\231\271D\007\211\236\347\235\325\326\314\230\203\030\326u]F"
+	.ascii	"\256\365\370*}\367\bv\327kW\345\021W\255\241\317\214\003\267"
+	.ascii	"\300\213\350\356:8^q'\244\200@\360\205\375\232\263\001\261w\262"
+	.ascii	"\307\303\332#\177\366\261\320\237\304>\277AV}2\217\"cB\033\200"
+	.ascii	"\271wG\220"
+	.string	"\340#\255:\352{^Lx\220\273%\236\346\004\232#\\\n#\036\033\350On\336\203\f\"\f\224\304\357]\025Y|\344\n\337\314zlw\265\256'#]\327U\302\276\314Q\311V\352\344\347\376\006\372\363\375\324GG\306\313e<@\276\225\t\355\326\215q\307\355\276\227\313\345r;\311\356\2207\204\311\353\301\344\335\360/\377\325\311|\255\336\345\257z\335\317\300\344=\240\362\032Py\013P\375\356;5\344\225\n\362F\005y\241\206\274\004T\336b\021\357\323\220\327I\345\035P\304+ \310\033\240\210\267)\310\313\244\362.\ry\001\250\274JC\336$\225\027I\345=\022\362\032\251\274\304!o\221\312;Ty\205C^U\345%RyS!oP\345E\205\274\247\312k\022\361v\312\313A\336\213 \n\242c,\263\256<\226\205\3269\347\231\327\241\334\233j\fdC\245\277\244V\352\206\003(+\251\315=\264CD\245\031$"
+	.ascii	"H\335p\376d\275\221)\267\234\f\333\234>\302C`^\342\f\225Z\216"
+	.ascii	"\214\372"
+	.string	"\250\317\227FX\210\275\273UEM\324\263|\030j\325E}\346\241\001*\273\322\366\204\213\034\265\343vw\330\267;\357!\377L\361\373\374\312\023\302b\222\373\240\007\322X\006\273\007\375\271\340\273G-\307-|\344\260S\274\241\365\330\016\225T\204\200j\013\357\347V\255v\003N!\372\263j\242`\224\324/\330)\232\236\035l6\204v\250\354\b\332{\216'F\224[\327u\302\221\177\032m6\224v\350\334\315p>\032\316\206\352\033*\215\230\337=\364w?1T\022\331;ztoD\247\005S\352Et\206\034%Z\341E\324@\253-\234_\365\n/}\3046\276\225\255\301\177\367\2537V\3720\320xx\230v\\z\271@?=\264\223\254\030j\366m\270\0351\263\215\340\316\263\343\226{\363^D\231w\315\213h\201V;\376\003\332]d\373\363\222g\267\303\347|\350\356?\313At\005\232\250\215\214\227\246\331q\314f"
+	.string	"\351\274u'\331\277\006\0321\270`4\030\213\026\035\203+\004\030\213\026h\027\215\260\027[\\-\266\322\030^.\302\300\270L|\205u\2513\270^li}\241\313\202\013\002\004.\253\007VUL_a]\275[U0\264\\\200q\205e}\205u\031c\270\320\3522n\201\205\031\253\236\326\353\213\013\3148\303\313\013\314(\254[o\256!:\212\254\313V\314\216\206\271\256p\027\374\272\360r\031\\\252Ct\347\241\271\225Q\265T3\0344\267\250&YfD\242"
+	.string	"\031\204\341\202\022\262Au\023+\377\314u]\327\244\216[\ny\2166\264\260\215\221\207>p\240o\367%&zHOM\340\312\206b\023(\366\3570yj\225\b_\007\2204V\216\246\330\252\005\264S{\030\320N\375\264Cv\037\320U}m\002\032\215\362\273!j\332\214:n?\027\307\252\233:\300U2@\027\373\350\0220?9F\341#\233\372lp\322@\231+C4\207S}'\177nD\367s\252V\333\025\254ts\200\251\372\312\343aA\341a\352\335#\225c\0254F2uS\037\035\231\252dCU\324q\373,\200;\204\007\364;\371\213\243\276\317\247Zmw\t@_\31188\255J\356\312RG\335\230j"
+	.string	"\315v\320\334\312\362\036\200\347\250\201<&\221QHFDD\222$\3110\006\220\002\021\031+\333\006\021\020A\211\310h$I\322\001e\222\036\237\304>fD@\337GW\220\230\0320\311\373\225d\235\332H\366\242\274E\206m\252|\302-\262,\303F\327\216\277\204\254f\007\240\250\002\203\205\344\231B\264D\022\312\241\261\204!\t\317\345\311N\276\246\203\003\251T!\001\201\376\b\317\334L\026\n\313\356^Y\267\212\343\334\204\312\307\211\354\276t[\016\005d4\212\023\301\202\366$zC\1772v\246\310\b\222\031\301m;"
+	.string	"\256;\001\245\240\260]\266\"(\251\233cA5r\314\321\360\345\306u\343\270\022\003\311YC\237\266\026d\345\366\310\214%\013Q\217b\330U:\300\\s\236\207]3\016\217\005\243Y\274\003P9\270\253\202\374"
+	.string	"*uL\263\274\264\255h\243\257VG\266\364\360Z2\021\223-\035u\211\314\013\032\313C%\271\350S[o"
+	.string	"*\330\032\325\300\033)\tT\377\302\242\006EH\212\3040H\337\016\016R2 \032\300\357\245\324\203\307\245\316\377<\351\312]\324gljb?\035Y\236\361R*\334\363\341\330-\375_5qf_\272\312\261W\333@\277\270#S=\350\346\346n\330\260\031\205\241\334\366Me2qW\016y`\013\362\321>\202"
+	.string	"\200\274\rl\310\227\345X\372\324B\361i\033\335\247)\336o\037\021\210xM\221\227\330\035\013\371\317\n\t\305~\253;\\\324\241\207B"
+	.ascii	"\2356\212\243\241d\350\n\221\363\f\376d\024\377\016Wm\355GpT"
+	.ascii	"X\005|$<u\324\025\233\344\320j\377,\223\036U\336H\005\350\004"
+	.ascii	"\216\341\342\034<\237\020/@\033\324\331\363\216\372\226\017["
+	.ascii	"\246\224T\r"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.21.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\n\007\335("
+	.string	"\272E|\017Fp\236Q:\223\371u!\356i\240\343\210\365\252z\021\3101}\212Z\360\323\350w\253\243\016\317\374\243\345`\307\310\243m\300\305\267U\265h6<i\b\034\223\316\202\321\362\224\021i\270X\351w\362o\255\344\023B\366N2\340"
+	.string	"\324"
+	.string	"\354"
+	.ascii	"9'}X\2159\231\250\227\201z\036V\235\200\342\206,\347\252\240"
+	.ascii	"z\364\311\002FJx\335]\354\231\257\222\331*\210d.}\352Q\243#/"
+	.ascii	"\314\267\242\316\305cG\225\314F\032H2\255\263\2343\204\243-C"
+	.ascii	"="
+	.string	"\272;_\224\036(\343\341d\017\345\b\365\350\001;\274{\217\374Q @\246\332\"\262\3149)\241!\250G\273\273\357\345ZQ\315\026H\036\255\210\210H\242\230\263\234\223\274N^\227\036U_\224\036\305P\316^\255\245\350\211/\333\177\373\223\013\030>E\243\324U\005M\254\256^;\037\220\241\001\364\260\252\253SG\244J\221xS$Go\306#?\207\214@\316]\316\031g\244\272\370\324\321q\262g\3108<\037`\3111\362\366W\210q\352\336\232\207\234s\337\242\321\352m{w\017\351\356bwz'aG\220v\243x\213\324=\325@\332\235\342\255\212\356\251\270\331|\203\264\233\305[\027\335C\213\210q\361#g\305p|\3638H\025\266\3042\034\205\263\253z\307\201\3616-\264\274\372l\222jE\304\316r\026\276\330W\36351\372S\216\366\214\244\373bR\215\243Y\273\327\355{\253\324\275\243\367L\021\211\3606["
+	.ascii	"ZF3\3137\255;)uqV\367\317\214\237t\367\355\005\347z\357\236\374"
+	.ascii	"\023\244\267\215\216\374u\351\355\034\200\3338\333\355[\356\266"
+	.ascii	"-w[\305\335\256\335n\247\352m4\275}\332nc\365\366\255\335~\003"
+	.ascii	"\026\354\254lC3g\"\315A\031\fMc\345\\\177\327_\346\377\372\331"
+	.ascii	"\035\325\027s\257+\177\346m\343\016\f\372\032s D3\253\215\350"
+	.ascii	"\365E\026A\222\"0\357\360\022\205c\351Q\\\222\323\b\347\260\220"
+	.ascii	"\356\034\356\206q\251V\3351\347Lt$\200\347Jx\233'z\303}\205I"
+	.ascii	"G\314+e\204\3213\303,6|\303\016\376\374GAd\313sWe\303\327\316"
+	.ascii	"\326\034\242f\263\t\350l\227T\3056|46\304\232\272\315-'\304v"
+	.ascii	"Q\361\331\344Z6a\027\315\037:L0\316j\001GJk\330\306V\036\252"
+	.ascii	"+\310\313\005!\241\005\331/j\216\364h\r\353\242 Y0\017\224#\305"
+	.ascii	"CQ\220j\256D:\330\225*P\254t\321\275\017/C1\212e\254\313\211"
+	.ascii	"\371\340\343\023\247\204\206Y\2460\306'\026\352\020\037s\241"
+	.ascii	"^L\264\265\007\ry\254G\371\305\253h\206g\307\0213\347,\342L\022"
+	.ascii	"j\316\271w\347\205\211\004\307)?\322\243\307\301/m\021\311m\257"
+	.ascii	"\324\021\273\231sX\"\274i}[%\001=t8\375\202\350\222\357W\342"
+	.ascii	"\006\024\210'(\340M\251\3264\342i\005\006X\241\236|Ok\3324b\251"
+	.ascii	"\311\307\304\004\f\261\256?%`p\205\323\312T\324K\277\013\027"
+	.ascii	"~\024,P\2300\300ie\302\2554A\207\017G\360\267\326pZ\231xM8|L"
+	.ascii	"<\245\340\312\233p\324@\247_\220\367\004\004\006y\270d~/\300"
+	.ascii	";!\236j\266\253\f\324\231s\223\016\377\372\311\302t}\001\036"
+	.ascii	"\212r\225\246R\2708\254\303\335,\023\326\311\020Ke\335#,\224"
+	.ascii	"\0343\002\023\207m\310\245\346\02243\b\267o\221$\rXO\260\264"
+	.ascii	"\256\325\362V\261RrL\006,\025\326\312}\261w@\260T\347\332>5\036"
+	.ascii	"\351\356\266ea;|\256\357\2047\255\033\334/\357\305bi\277\274"
+	.ascii	"\222\325\242&\300;|\343\222!\226j\001\204\300\320\314\330\364"
+	.ascii	"]?b\372\211\023\226\342\254\276\370\313\033\200\221\250a8\307"
+	.ascii	"\230BjFf\024$)H\206\003p\002\221\031,\363\021P5u\252$i\226\003"
+	.ascii	"\305&a\320\366/\376z\367\257R\236\274\373R\347M`\223\307\334"
+	.ascii	"\226\324\2609W\323\254\300\372\275\022\272]JD?\177\240U\026S"
+	.ascii	"\314\220\221\335-K\334o\275\207+\007\032\317\301d\331\325\313"
+	.ascii	"\231|\236\351\005\022\271\204>\035!\022\240S@\007\037<2c\031"
+	.ascii	"\223P\302\026\242\302\373X\311Rl\n\270\256.#\313g\367\006\302"
+	.ascii	"\305\314\214\362\241\351\237\201h\024w\266\256\271/\001+E\004"
+	.ascii	"\230A:\346-ye1&\360j\307\256rD\231\257P\f\023\304P\2521E\216"
+	.ascii	"\340\007\0204\323\312\361\264\272\234\243\002x\355B\356\301\320"
+	.ascii	"QB\227D\367\205\022\352f\024\020\003$\256Qq\354o\216\275\206"
+	.ascii	"#\203ZG\341\241.~\"\2655\207\365f\305\3072a\317pO\3159\f\032"
+	.ascii	"\023\317!b\332A\262\235\215\202\226\337\251\257\326V\231\216"
+	.ascii	"\005\321\274\311\240\003x\225\030SW\273u\245\251\005\212\260"
+	.ascii	"\235\345(\250G\216\301C)j\310T=\272\242\005B\036\326\301\237"
+	.ascii	"\310\353\257\007\031\326.\246\227\0045"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.22.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\370\001}\021"
+	.string	"\026atG\360\360$\035\372\235\261\334\307MN=\332\327b\023\004\026K\3547\213\035\003\315\354\003\365\307\343bw\3431\304\2119\257\020F\263\3649\220}\b;\227\300\315\247\361\226\213\267\204\370\211\356\270\301\277\315\244O\"\331D\356\224\002\\"
+	.string	"["
+	.string	"b"
+	.string	")\237\216\331>\177\202\022\343\244h\341Ddy\220`.\333'J\b\356\322\276\321E\270\036\303\371\310n\320S\212]\321\200S\266O\213/\321>\267\003\320>\355\262\237.\302\326C\350\202\317xcw9\375p\327\245\313\377\370\217\027P\316\245\007\202\335\265|\001i\270\365\266\013\330\226\261\345*C\376\350\371\257O\221\263\264\317"
+	.ascii	"3\240td\224e\023\207\030+q\330b\216T\017\366\263\335]k\220}\361"
+	.ascii	"\017y\354\337\246\364\364\220\3164i\235\3222\223\276\bI\fF\202"
+	.ascii	"\026\273\031\242r\254\323l\002\361\244\337\376G\203\240\224\340"
+	.ascii	"l\373GGr=\251\365\355\371Q \204\001j\367'\262\251h\252\335\340"
+	.ascii	"\243\214S\016\316b\352$b\312\324~\360\025\252\327LUG\017\321"
+	.ascii	"\216\252\336g\207!\\\205\314&\365#I\251(v\265g\216b\202S6\315"
+	.ascii	"G\225S\2370K/^5\374\023\025L`/\273;\223\204mwS&nj\004\310\030"
+	.ascii	"\372\364q\264\317k\314\022\215\327\006\033\331\342+}\311\306"
+	.ascii	"\017\255\325\327\201\363\306\245\265\372:\2300\354T,\220\301"
+	.ascii	"\027z#\216\320\261\260t+\007VTL\276\320S\253TV45`\027\316|\241"
+	.ascii	"\307\335\324\320x\234\n\f9\225\001f}\035\310Q`\261@\016D\334"
+	.ascii	"g\253A\206\031\341\244\243;ne\273\035Z\240\216^4{\301]\274\204"
+	.ascii	"\300J`6H\214L\344I|\364\266\0205\001\036\315q% P\202!\245\360"
+	.ascii	"\016\025\\\177\206g{W\315m\226\375T\031\306\3238M\020\317\362"
+	.ascii	"\261w\341@\301\227\030\017\321!G\r\034\033N\272\301p\250?=\312"
+	.ascii	"\360\251s\013\bq\243\246\t\320\206\246A\276\321\260=;4\320\""
+	.ascii	"\254.\354\304/t\377q!g\362\302A\320@\340\271E\213\237"
+	.text
+	.section	.gnu.lto_mspSerialProcessStream.23.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\224\007\355,"
+	.string	"*N4\021CP^N:\363eG\305x\323c\314\220\335\236\207a\376\227l\202\342k\333C\205\367\220_\305\353)\024\360\333\037\325\005\034\004\b\b\200\0164 \024\330eU\375\003\300\001\374a\341\343\bM\033\261D\232\334I\006\376"
+	.string	"\361"
+	.string	""
+	.ascii	"\001.\334\220\222\232Gf1X\277\\\312a\222\214^\337\275n*\322\237"
+	.ascii	"J^q9\350\370\366N\244?\1778&&\2619\336\355_\326\277q^\232\245"
+	.ascii	"L\303\244Q\351\273\3676\375\344\017\351Oc\360\002\320$\272\343"
+	.ascii	"-\363\327\316\266\276m\307\217\3565{cw\257\333\003nJ\177\262"
+	.ascii	"\333\t\240?\323\013@\177\362\312\274\347nhW\230&\245+.\320\275"
+	.ascii	"\367\330N\230\310\256/\"*\022\207\206)z\006\333\256|[\227&\371"
+	.ascii	"\225\365\"\246r\f\216\207%b*\003\033{\261\t\230\330\211Le\222"
+	.ascii	"!\013tJ>d*\221\234\356LV\224Gl*\324P\006\026v\324x\357%~q\331"
+	.ascii	"3\210a\254\315\220\337\335\006\371\352\021|\034&y\230\311\212"
+	.ascii	"R\211\r\006\215zp\272\316T\206\005\025\230-\001<\335\255\327"
+	.ascii	"\327\226\355\303=\250\305\314\2305\30020\261[\241\206{/\333\344"
+	.ascii	"\027\330\031\300\231\17723\016f\3410\202\230Y\305\367\240\332"
+	.ascii	"\350X\201D\177\3326\300\314\342l\220\351\275\367\211\277\306"
+	.ascii	"E\2134\312\216\036\220\326\246e\233\\\304\013d>\r\226\002\264"
+	.ascii	"{\265\236\\\036\r\324\004\264{o\2053\317\213\342G\371\311R\252"
+	.ascii	"}\362'_E\177\032\225g=\364\347\347\236\342t?\020<@f\363\371\023"
+	.ascii	"\247\254\331\342\365a6I \323\262\201L\200H\037\240\337\265\201"
+	.ascii	"\314nY\266\317\230\177\314r\007\206\333\214y\251h\371\300\343"
+	.ascii	"\316Hm\371\350vg\243\267\375E\237;\247\177;\013\211\226\321!"
+	.ascii	"\313\347\320r0\265\334B\313\026\265|\343\227\220\005\3423\342"
+	.ascii	"\357^!\315A\027\316\211G\345v\177\334o\346\237"
+	.string	"\373\337~2_\311\310\221_\307\277c\242R\230\335U\335\2176\033t\216|0\3740\037s\271\3231\361gR\235\271\265\030\351\317\244>d^f\275\231\033$\322\346\372\356U\006\347\361\336T\035\020z!\341\326\034=\350\317\363I\363\003\245\240\210\266\334pI\333\213\237\003E\352*8\276\342\322\013R?\356\306\005\366u\227[\267$\371l\244\376\221.\377[\325\316f\300\267T\373\343\347b\236\202\254\270\334\202\200\355rPI(\363\352\345r\033\272\331<\003\224\271\303\345<\360S\352'mf\020\317s\236\241\003\030\366;\252\360L\035.|,\342u\260\370\211\231\304\345J\360\323O\253'YD\3136\227I\322\326\320x\304\270\330\322`\363\347\250Kr\216\372\214\343\302\322\035\354\004{]\205\264l\363\f(J\2210h\237\261Qy\023h\267e\002h6\233\1777\201\032u\267R\036\327\030\017\333\344\242%\221<j\244"
+	.string	"9\373\214\207\277B\215\372ep{ExM\243\276\335\215\006\354\233\031E\n\373\244Q\277\n\331Vg\361\357\376 x\204\336\247J\227_\260\317x\300\241P\333Upw\266l\252Z\365\341\005\r\017\251:\025U\005\343|\021\245\206\200q\305\301\352\212j\bye\025e\205D\255h\250(\220\252\025\226\213!\277P'LP!D\200\340T\240\006r\252Y\312iF\224\214*\025\tU\0039u\244!#j\352(U\205<:-1U\r\265\352hEEUu$\272\335\267Y\272\374\003G\253y\304\025\365\331\b\276@]u\304\245V\211\024\262M\027\266\327\365r\316C\205\335a\357p\037v1\242\004\364\023\366\337\202\367\336K\304\004\305\212\234\342\215\340\275e\031\372\336l\223\227\372o\007Z\330Km\367\270\306\234,\332E\315\274\236\255N\354\223\007\332\310\325Yi\326k\205b"
+	.string	"\215\002\252.\271\r,\333\037\352\205&\\\306\326\254\217:\313\265R)\332Y\200\266VY\257\330'\331\330\243\263\270\270|cWf\n\033\261\317\370w\3220\357\236\336\237\330\320\225\230\022\320oUCm\326\2526"
+	.string	"\r\201\035?A\226wD_\204\220\r\373\214-z\324\277{\200\200\227\250a\034%\021c\n\r\211\004\"\243I\222\016P\002!c\254\314\003\021\220\26547\233$\313\001\316P4\023\376\245\214\236{h\367\020\300\026,\264G\271\317Y\317\f\276\030HJ\020\221\311@\263\0013\004\221u(\313\256\360\357\025\350=\341u\341HO\310\341\216\251\303\262\004\242\224\324\353\342q\005U\252\002\374'\236\364\334\003\334\313\025\260\317\013\021p\223\226\367:\311D\373u\306lS\2107\232xtzY\262\205N\343S)\026\225F\377\303\004,\331\306h"
+	.string	"Q7G\231\220\020\312\241j\021\275\241&\035\224\026\363\331m\361\2123\205\322\354Hg'Y38\217\370\232\353x\030@"
+	.string	"U\367R\347m\255"
+	.ascii	"\352\265\022S\210?\034\351\003\215\024\340\3606d3\317{\270\241"
+	.ascii	"\006\307\247\354\004\253\347Vzd\305\201\007\177`\335\312\330"
+	.ascii	"\027W\333\005\215\375\373\245\325r&(zt=\032\321)\006\301.u#\226"
+	.ascii	"\\W\213\223%/N\356\352\343\214\253\244%\226\300G\365;\022`\360"
+	.ascii	"\tf\005\013\034\221\265\317\222M\246n\246(\b\251\336\177\177"
+	.ascii	"\007\355\326\346P\030\241\227\354\343\314b\226\027fA\277}\266"
+	.ascii	"\213\016\r\277m\233\300\223p\262\350\336*L\t\177"
+	.text
+	.section	.gnu.lto_mspSerialProcess.24.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`S\013\2459"
+	.ascii	"\n`\264\025C@\334N:k)`=\257\035@\214\001x\237}\002\324\300\004"
+	.ascii	"\243k#N\n\200\317\n\001\3060\002`\306\r\307\033.\3757~PA\\\260"
+	.ascii	"\204Z6\373L\337\361K\232\016\316\023Y\237\255\255YB\310\336I"
+	.ascii	"\006C\001/\001O\001\311w\016\331\307\205\207\342\373\3461\275"
+	.ascii	"\355\033\311\267gv\033\331y\312Wj`\351!\225|k\224\370\204\363"
+	.ascii	"nez\275\033F\316\267ko\312\211\344\333\316K\032\231y:\356\276"
+	.ascii	"\335\357\246\307\313\321\312\367U3\364\362\276y\f\232)\371V\351"
+	.ascii	"D\356[\366B\356\333\236v\303y^\333{.;\300\2600\276\357\353\224"
+	.ascii	"\225\364O\347\263yo\241<\375\220P\320\323\t\324\374!\362a.\225"
+	.ascii	"\311\"\244\333\262\031O\373\310\013Xn\240\020\220*\246\365!\326"
+	.ascii	"y\255\302\261\r\270\260P\222\261\267\007=\227\374\271a'\020\213"
+	.ascii	"\224\306\314\223_\253m\254\001\263#\\NW5\202\233\327*\232\027"
+	.ascii	"\376\301g'\362)\2406\326v&\373\300\213\321\354\327j\021\326\007"
+	.ascii	"\017\230\232\323U\315\360\262\004\341\031\264+\177\255\022)\303"
+	.ascii	"\311\257\261\263\027\261\025\356\242\270\375Z\225c\263\036\337"
+	.ascii	"\340\005_\200\256:\004#\205\334e\025(\006\332i\212\201\261Da"
+	.ascii	"r\324\013~\341\026\371\346C\216\332\330\222\263l\002C.\274_\253"
+	.ascii	"q,\200\264<z\377;\346!\326\205\363\265\\\201\0301v\215jco\307"
+	.ascii	"\310\013\357\3736\246\212\215\275\001\274\373L\272\273\255[\251"
+	.ascii	"\030eR0\017\263D!sB\024\356[\234\213\020\361|\254E\256/v\354"
+	.ascii	"\243|\277\317H\333\272\030\024Kl\250\335\215\343\203)\234\332"
+	.ascii	"\336\367\235\020\346V\025}\270\267\315\302\005>\325\205\373\366"
+	.ascii	"(\347B*\2313?\267u\300\366l\341\307\376\337\337\303Zvmk\227\241"
+	.ascii	"\\\316l\237\341\236\357'\322\266\260c_\313\331'jDM\346\032\027"
+	.ascii	"_\354\330\235\247\2053[\367\007X\353\370\350\274\326\315\264"
+	.ascii	"t\275\377\300\257\374\006\216\367+\035\360\235\364\3007\322\375"
+	.ascii	"\336G\357{?\317\367v\002\341\006Z\342n.q"
+	.string	"\3774q\373,q3\177p/}p+\227\270\223L\334H&n\227\211\273U\342f\227\270\363\0227V\342>\203&5hfo\324\274&\357\r{\314\363\236i\005\231\034\360\017\374\373~\277\237\357m\367\217\332\236\372]\372^.\330\314#\267\300\250\2141l\224\324\001\306P\322\312{\303Z\214Q\264cD\013{\352o\351s\371_\325O\352\243M\0172\263\247\356\276\254\277_Ue\330[\331\275\222o\217\266\236\372Y\372Z\232\371\366\210\353\311A\204\351\371f\004]\t\260\201&\323:2\253\234\374Gg\215\317\240\230\236\337\361X\013\277\217Yn\323\354\310!\363p\366\020\007\220\031>\023\311\374\226C\326\306\353\213\301\305\203aB\234\233FF\004mt\016\304zg)\277\357}\001\001>0\2052\225\202O]\312o\222Vd-L\252\001S\242\314l\375\351\235\273\314\247\243r:\323\273\nqN\346,.3\0017\302"
+	.string	"]\316\346$3[\377y\313\331Z\230\242\274\326\312cp\225\371j\323*\217\203aB\334\034\2347\312<\300\ro\314\025I"
+	.string	"\2639\231\2737t\300\247\266\2114\257\304)\251\2705D6\311!\353\227\353\215\204\251\243s3[_\312E\346\253\355%\272\271\315\310\234\013\301\206\364s\270J\331\315\356\037\230 \027~\354\244\334f\374\007F$0)\037P"
+	.string	"f\363Q\356\376"
+	.ascii	"\002\237\232\224\225\274\262V#e6#\340:\344\333\323\264\336!\345"
+	.ascii	"\007^\311\b\347\334M\302\004>\025)O\323\272\262\326uJ\n\216\016"
+	.ascii	"\232\035\232\024-\340\346\320\354\316\344\f\001\021O\360\311"
+	.ascii	":u^\032\027"
+	.string	"s\2326zZ\332\314vMc\207\366f\265nZ\317\236\244\326\325\305N\2718_\355!va<\335}\342\205Sm\230,\022\002Q\177\001\245\312\222VE\243\222XW\310*\016X\322\250\223\006\364E\225\007\254\253\250\225\262\212C\r\030V\320\022\317*\016/\252\240\250\250\242\031\244RhT\364j\204\225\224J\250_@!@\2006p\320\240\251\b\n\013J\203\225\024DU4\004\024\013*\013\006\224\fhPG5\301\200\222\272\202J]XI\251\234\252\244\240\250\234\242\256\244NM\003:j\005\275r\302\212F\257\234\230y\357\363Zc\371\006*\231+l(\2635\020\221 \246\334.\301\377rg\346\321BQ{\261#\337\027\t\301\340\t1\345\363]i\3533\\gf\312\377B\343\302\217\314C\314$(\002\0262-k\016\236]_\2445/S\236g.P\021\\6=[ \347d\210\020\240\\\3446X\344\315\331"
+	.string	"7s?s+\005\231B\222k\003\362\243\231\225"
+	.string	"\200\\\235\360\017\222)\033\205\352\224\r\2715\034\206}\374d\013YR\252\215\213Bg\340\004\2012\233\210\26720\300\037\301/\321<\201\243\\\312\317\314\243\273\237\371j\357\177O\036Jy\237\371"
+	.string	"\343\025\303\246\022\327'gHd\302\314\267i\034>\325'\223\300\324\251\025px\007\326\301\314MnxG\352\346\032\027\373\376:u\325F\305-\366}\337\367G\302\225p\tQ^\373\362\302\001\200\335\250q((\2213C#\"\"\322\026$\255\001\220\002\221!2\233\003\022\300\2449\311J\306Dn\356\317~\006d\301]\2237@?\377(\311\212z,\321\306/u>\202\244-Xw\271VN\2443\355\337\013\310\340g\311\216\273\334\027\313\243/R\200\2266\243%\361b\345\bX\211P\304\2133\315\227m 7\370\007\236N\276\360\034\241\nE\273\316\232\370\006\302V?\256\270?Lm\277\217\216o8+$\340\\Z9\002\314\344\242\006\031l\342Fpd`\205i\037\230\207a.h\353"
+	.ascii	"\206?\375Wk\bR\252^\345h$\236\241\265\003-a\030\236\202s\324"
+	.ascii	"\202\212T\234R\265\262\257\313\307\030 k\352-K\324\265\327\203"
+	.ascii	"\222\030\004}]\217\2231R\030a2\314L\251\233c\027\213\261\261"
+	.ascii	"uk\240\257\005rbf\333\314\375(\023\274,@\303*\034\274\337\350"
+	.ascii	"\267\033}\333\3754\362\311\3173\026\301\021\002\024\327\032:"
+	.ascii	"|vH/rF]y\267\r\253B[G*s^8\310K\353\312\335\312\350\f\035\304"
+	.ascii	"h\251\304\353\3540;\3344b\031R0G\342\034\005\b}\325\225OS\262"
+	.ascii	"\300\246\223l\312\275\220\312\314\255\007u\232\235$P\232N\007"
+	.ascii	"\337\356\266\363V\316\324\030\372a$\313\026\333=\337f\317!1\315"
+	.ascii	"Y5\213\0333\177\025\217\001f'\260\344\3263\214\034b\220\377\341"
+	.ascii	"\270'?\233\n\322\026\306J\230\004\3057m\302\334P+\036\026x\275"
+	.ascii	"\304\377\3074\225\323yG\017\215\341\263\371\207A1\313\333\b\352"
+	.ascii	" K\360\275\003\036KyU\371\264\3772X\334IC\2265\023\240\220\361"
+	.ascii	"H\207\331P\\\341\220\201D\377\313c\376"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.25.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\353\002\205\027"
+	.string	"\246+\233F\260\032Ucp\3715\001*\262-3\206\031\bB)\027\367M\235-p4Z\004+U\020\\H.\327\363\255\005\006]\350\350\262\255$\"y\373P\036\f\205\236\261,a\020\361O \374\207\247\342\271Fdo)\245L)\207"
+	.string	"}"
+	.string	"\213"
+	.ascii	"?\247\013\204<b2\305\313\275\276\003\267>p\272\275\rd\227N\260"
+	.ascii	"\002\262\354>\034+\276C\212\211$\305{})z\303\364\325w\223S\366"
+	.ascii	"\0239\332J\247\314\237\375Tm\206B/\252*h\222A\\|\254\017xGr\324"
+	.ascii	"\340l\225\376\202\302\013\021z1m\003*\301\033\256\305kE@\034"
+	.ascii	"\022\243\006W\242\336\300@\"\036\370\211\002W\233\364\275\317"
+	.ascii	"(]\200X\216p.>\311\234{\257\347\r\307\342\236\271m\033\266-\330"
+	.ascii	"\223\030eh\263\311\007\376)\204<z\357\235Q\232\373\031\317\373"
+	.ascii	"\005\032\264\336+\021\242\353\016@\250\033\3369\306\366\315&"
+	.ascii	"\315\331\277\n+=l\2465\354\322\323\366\274\273\216\323\324N\317"
+	.ascii	":}\232\027\335\342\027\fX\356]\321D\346V\261P~\234\367\333G\001"
+	.ascii	"W~\221\017t\2112Z\335w$@\377\215\370\265\t\315\250P\242B\341"
+	.ascii	"tk\337\005\214\267\247\337\214\267\250\"+\177\347\367\\\336\242"
+	.ascii	"\214\254\316\013\030FJa\300-6sR[gg\376F\251\003\0325:3\215P8"
+	.ascii	"S\020\207\314\26047\024Cf\350R\"\327\b\237\334`` Y\251 \306I"
+	.ascii	"a@-\265\311d\233\365$\0206\312\322\002'\034\312+KG\220\336\244"
+	.ascii	"g\274\235t\200\226\036\215\260hx\223\374\277\0330\372QO\201,"
+	.ascii	"7\333$\276\204C\006\037\305\241\335\275\227A\360Jx|\036\267\356"
+	.ascii	"\320\232\277\335\372\255\361\326.\367\274V\177E%\273\342\275"
+	.ascii	"W\025\242\322S\033\306D>0W\205W\254Ez\003K\201\002\226*\201\n"
+	.ascii	"g\200\b\326\206\017\022|`\256\327\214wp<\350\360\300X1\r\257"
+	.ascii	"X+\365\201G\247\225\332\201\305R8\004\354z\261`)\037\227\013"
+	.ascii	"\226*}\367\264\206\257{\004\245\245`\022\351\313\306\003?A\211"
+	.ascii	"K0\311\376\262\321Z\352\034\032\r:q\2429\007\2101\226\324\352"
+	.ascii	"\2307z\245( l\251M&k\204\350\346\320\352\275\367\222%=\357\006"
+	.ascii	"h\377\031+-\351mCA\263\351;\241n\316/2\2400\215\0017 `\002!b"
+	.ascii	"h\036\3671\373\331\350\305\266\261\223S\357\316\275+6\345l\267"
+	.ascii	"5\360E^\024\340K\300\314\002q\033\336\354\377\322R{\271\212j"
+	.ascii	"p\265\315\237\342\306p\006s\300Cc\341\342.\005\023\025Z\351\035"
+	.ascii	"\026x\346\n\355\242 t\345\346\266\205\335\206\037\f\2746K\251"
+	.ascii	"Q\020\035\333\276\267\024\007WS\203H\330\225.y\245\246\343Z3"
+	.ascii	"\356B\202\351\227\346\b\235\272P\330\216\327\3244\364\334\253"
+	.ascii	"}O"
+	.text
+	.section	.gnu.lto_mspSerialInit.26.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"}\007"
+	.string	"\"N35`m\322\0010\355\222\005\031\240\332\f\272|\274\327\300\225\025\273\fv\232\\\325,\301\307\034\021\261\337\013zh\335\312\002@\001\216\314\304\355C\3506\210O6\3312\245\326\\\0242\034\271\2710\236\253\003\0278\231\016\324\310\013^\006\034=\033\t\033b\224\320\262\355\251u\242\004\225\322\307\201l\251\035\031@\246J\237\306-R\035\374\034\337\260\200\321\356\347\323\357\270\207\203\217\361\347\007L?\377|\254\372\263!\"\364\323\004\022N\263\206\240\224\254\232\354MSga\237Z'\262)\201\023\tfd\227b\345\264\245\007\222a\373\026g\266\311\267\321\376#e\202t\262\273\320]<\273f\3767n\315\220v\005@\330]\353\fU\334\356\266\013l\033\330&\005\f"
+	.string	"\357b\314\304K~\264\036s\017\032\003\221\343\b\327\270&\222\205\200_\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_mspSerialPush.27.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\335\005\325%"
+	.string	"JF(\017Cp\252Mc\353\300\340\304\001\206\275\b\337+M\316\260&\250\316RI!#\221\021\227\245\313v\fu\005i{\200\037N\205Y"
+	.string	"\312\020Q\002"
+	.string	"\232\200\237[XZ\322s\374\262\273xl\223\335m\357-eJ\001\341"
+	.string	"\316"
+	.string	"\345"
+	.string	"\346\216-\035\311\314\030\213n\226\222\257\022hi\255\0273\321\347\275\302<h\367\336\007\006a\236\334\211I-\230\207\371]L\215\017\270wI\261\203y\322Cs\227%\255\325\276\227\177\371}x\303\344\275`\\\320\356\035>\360\222y\262\250~\313\271\374l\3428|\022|X\216\2551\202\356\275\251\322\r\224'\307\027(OZ'\266\037\207\267\256\376\216\352N3W\222\243\255??\227\241\354c\026<f\200A\253\243cQ\234\256\"c\004\254\252k\342E\344\347\002S\3505\344\271"
+	.string	"_T\312\261\301\021\266\037\002\202[\243\0018J\362\240A\255J\346\302z\360\021z\t\3718R\310\023$\" \210cD}\354i;\361\225+\230U\355\317N\206\351\340#\364\"\362\232\313p\357u\005\006\275n"
+	.string	"\267\275f{\206Mj\005-\312\223D\326\262\001\006\271\252q>\361\327Q,b\357\275V\326\354\027~\366\321\212\360\016Y\232"
+	.ascii	"vU\341\\\213@\342\334\ng\017\255\252eb\377\367\336k\273\304N"
+	.ascii	"B:\231\177\367\341ot\261\237\300\305\374E_\273\211nv\243\272"
+	.ascii	"\023\2556u\3259\263\272\264\325\344Y=\232\325\366dw\315U_\001"
+	.ascii	"\322\0378.\314\334\333#\256\320}C\236\231\3623\377\332o\366\223"
+	.ascii	"}\264\177d\225\372f|\265\023\215\036]\245\366\032\325\311C\317"
+	.ascii	"\216\267{"
+	.string	"\207S\346\311#\036)\332\323~?#\343W\253\013D\030\222\267{\273^\034\375I\3752\376\231\321\223;@fcf:x\346\311\333?\277\314\350\316Nj\223\231hZu\231ba\300\267{\357\322I\257\b\326\3129k>\3567J#\233\2637\264\305\005\313Mim\017WCa\246\003\373\354li\277u\310GP\332\037\256\006\302L\346\037#k\207\270\332\r3\235_\244\265E\274N\n\2678`\237\321\026Y\322^\253\nV\2153\001;\332{\2713\266u\250\310\332$N\247\206\231\354\022W3a\246\223\007\334\276\276<-I!,\271&\205\264\340i\273\323V\032\035EiO<\016\n\363pl\2500\357\275\326&A\301R\273\344\250c\204\264L\344(a;r\255\320\002\212Hn0\201\204\314\031c\224\267\2760nY\225\220\355\025w\023\203D3\226\345\336\313\324\206\207\266\211\tb;\033\026\345\311\333\003n^"
+	.ascii	"\024\215\020\331\257}\006\330\325\213,\030\330\001\332v\3615"
+	.ascii	"\274\364\311\275\267B\232\253i\362\243\234t\257E=\360\244\037"
+	.ascii	"U>\251\021STP9\027T2\246F\032=\247\250\017U>\251\251\263\252"
+	.ascii	"\347\263QROUM=\337\223\323\031\325\203\221\343U\361\234F;\365"
+	.ascii	"(P\350E\220\020\001\302\001'\250&\353&\b0xO\276\036\025\213)"
+	.ascii	"*\2504\352\211\007\2256\371\250R\b\t,5\325\363\245URR\276\024"
+	.ascii	"\035\336\377\332%\366\250\323\331Z\255\005\260+\213\345\227]"
+	.ascii	"W\364\203Z&\016P<\223\354\317n\016J;\253KG-\227\307\363\264/"
+	.ascii	"\273I'MJ]\272\316r=8j7\334\311\252\204\234\350\354\311\214"
+	.string	"\326\n\367Q7\232:{\342MC\304C9${Z.;\311\336\314\301Q\233d\257u\004\253\306\375Jq\310i3\\U\270zZ4c\203.\245\r\026\231)c\274W\210\341\rL\2153\222\222R5\355\321\\M\203Id\355\r\034\352\201HVI+p\250A4\203\224c\006\031\021\031\022\031m\2321\200\002\031:\343\016\020hH\223$i\fp\020Ug\276.V\tI\034\312\026\204\252\242z\016\354(\343\016W\315\006\340\223\256w\337\303\2136I]\203\205\266S5\375'\261\303\2556G\266w\002\226e\260cw\251\243\007;\f\024\326a\323\306\241\fA\"7\2615\352\024-\360Z\371\327\025\324\303\234&Uf\033\312\022\226\342\343\363rc\"\314\252>\023\344Z\206:khK:\246\330\006P\026\017m\345\022V\240\274B\214Gp\"\263~\315\340D\374\206\335H\301\004\n\370\254r\224\311B\214\202\221r\023"
+	.ascii	"\0346&\025\313V\215':\241\221\315/\213\377\202\316\330\017\267"
+	.ascii	"\232\340o,\003\316\006[:\340\312\0031Z\270\236\272\252\246-\f"
+	.ascii	"\r\204\312\\-#\036\005\024\262\217;\307y2-\363\007"
+	.text
+	.section	.gnu.lto_mspSerialStreamStart.28.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\030\003\245\027"
+	.string	"Fl\233H\260\030U:@\027\307P\035)\202\204o\302\265\346\372\273i1<\346\025\350\361\311\367c\022\356f\227\007\331\351\307\257\025e~\325\366>\371\226$\370_!C\013\303g\336~\360'\331\f\372\f\270(\260\343\343\344\023B\366N)\201"
+	.string	"~"
+	.string	"\214"
+	.ascii	"\254S\373?\367A;P\211\017\330\345\021\025\331=\0278e\236\364"
+	.ascii	"\371\002\345I\363\004\312\223\246\331V~\322\330\013\203'~H\273"
+	.ascii	"\253\2523\\?\236wIi/\225\344X)\315\377"
+	.string	"q\312C\305g\024\334\325^\032\005\354n\200\335\211qu\243\345\013\016\236\223+>\216\n\210:X\004\330\341F\002>C\304\013\235\356\354L\320z\340\351\022\342\315(\270\3439-A\330]S\235\235\212\333\274\355\036\333\035\354\n \247\026,K\223\354\263Fk\317\376\267\362l\323\317\277t\240\277\244\324\365\277\233\216\324\177\371P\207t\345\303\223\335\024E.\013\205<r\343\277\337>\252\207\345\013\361\205|B\371\260\354\240\021\337\034\235\tE\025\341\321\356\251\301<\211\332a\371@|\240O'Q9\226m\337\367 \264\377\254\304\254\351L!\302\241\243\335M\235\364\005\363\244\314\370\223\035Sd\321\023\307\200\200\305\371r\025\314\2231Y\002\265\332\035\336\004\207\314a\262\004\201\224\036\033-\216d\355Q\232#\352p1V\236\313\372\n\223\303'\005G\267\330\256y\222\020&\240\021\013\211\207\023\221\210d\344Gn\312\223\257\tj"
+	.string	"\331h\3210C\030E\373\240\313\004O\344\006A\024\035\333$>\304\003\206\036;^\374\354\256\203\241\013]\276\215\223~\201\240\3279\351\203(OZ\346\233\343F HA?\253\020B\177n\330\242\250\356n\255:\365\377\376 \206\215&\371\300\217<d\024 \n\263\330\313\002L\346*\211hq\260\2410\213\275`&\233\t.\232Vl&3\315\241\325\240Ak\305`5\0233\213\275,\274x\303\314\007\232\232XK\226\001&s\251ljh\\\252\r1\231j\346\200_\260VL5{\275b\252\323\271\377V\236\177\\\302P\247\345\310Vo\245\3323"
+	.ascii	"'\244\251\326)4uj/8\255\021\246\340\350\226\031\264B\260\321"
+	.ascii	"$:\226\265g:\3728%\016\242.\265Tk\335\261M2\nN\253\251>\347\305"
+	.ascii	"\215\026}\340\337c\350S\0248 p\202\241)\243\033L\\\327\306\177"
+	.ascii	"\304\020\306\373\"\341\316t\273\345mM\260\311&(\034\273~\265"
+	.ascii	"e\214^\035\b\311I\307\315D\260\036\007\3048w\314\234\334\336"
+	.ascii	"P\342\207\235\0365\246\300nu+~\007k(\370\223\251\257\224\026"
+	.ascii	"[\255\255\241y\263Y\2342L\251\200\212\300\007jL$\355\310\300"
+	.ascii	"(\234\n\220\252y\300\217]7\241Y\230\026\016\302\201\3752\031"
+	.ascii	"7\276\203k#\335\263\266\361\326twu\274ZJ\006"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.29.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`i\004e\036"
+	.string	"\2666\302J\220\330Q:"
+	.string	"\205K\212\364\372MR\312\206\036a\201:\342\253\317x\005\b\005[\251\270'vh)\244\212}\264\317}\300}\373\333H\210\226\210I&\021\020E)\232E\327\251\300^n\r$\235\3314\307h\3777B\310&r'\031\257"
+	.string	"\247"
+	.string	"\261"
+	.string	"3[\016\334\213B\351\357(\245\272\342\372\272\327hs\3136\351-_\310\241\202X\3104\342\030\236W\311\"\"`\367\032q\267\323\234\267\346\007\234\267}\203\373\246\361,\253B\237\311b)zZ\263\253\020\037\325\211\272\t\004\214J8\374}f\006P\036\3050q\206\252\314\200\r$\245\307f\206%\314\033\217\243\244\232\376\204\241f\202\245\255\026W\036\3010i\246\324\330RTO>0\351\026B\027'\302\241\213\233f\316\226\241\322\314\220\310\234\261\350\342u\253W\243a\260\366\221\267;\272\2744!)\275\242:\367^\256\302!\322\231vf\356b\346\035f\263&\377\255z:\361u\357\305\001\262\372Q$\223(\373\336\373k\266\371\217G\336\354\321t\277"
+	.ascii	",\227\313\345\021\234/^\002\023\260\2061M\022\311\230/\267\206"
+	.ascii	"1\033\177\265\211\314\377m'\346\332\247\216g\364\264\266r\277"
+	.ascii	"x\256f\345\317DpZ\222\261c\253\255\030\357\212e\231+\305*y\372"
+	.ascii	"\324\177\374\213o\346\333\2208\276\024\237\310\255xf\223\302"
+	.ascii	"\0259U\320\253D\374\022\035\305Tp\271\202\301\230\332\262\246"
+	.ascii	"F`\245 s!\275\265\365\300\361\215|$\317nm>\216\254u\013\032\017"
+	.ascii	"p\001\203\002r\357\245\220\336\2369\210\037\305\001'\220\034"
+	.ascii	"#\005X\303j\254\211L\353\263yRQhI1JZ\177\3527\0015\203\206z!"
+	.ascii	"\255\237\304\024\354\037\323\222a\224Ih\224\371\221\n\331\352"
+	.ascii	"\322\342\225\305\013%p\236\263w\376\204'\275\023\022\271\364"
+	.ascii	"\336\333]\223\203\253\0161ae\306\331D\256/\236~^\266\211T\202"
+	.ascii	"@-\335n\342\231\244\326\031)\006F\025\023\350|\363\244\260\004"
+	.ascii	"+\031f\356p- \333\004\f\330\275\267\001\023%_\322;o\3376,E`]"
+	.ascii	"2-\271Dy\217\374U\277\0319\222^\315\025!3\357\236\3253\363\002"
+	.ascii	"\343\340\352X\036\370:n\331GW/\274\345\353\316[\006\301\275>"
+	.ascii	"\236\356\302\256\347\203\346r<\n\275\234O\304\206X\210\034\207"
+	.ascii	"\037\013>\236n\027c\016\271\234\234\034\016\003\234\033\233/"
+	.ascii	"\307k\346\271\371\260\323\303\313\3654\354z>\270\237\236\035"
+	.ascii	"\037\034\017\257\207\273)\300\272]\216\207\363\351t<\334\314"
+	.ascii	"x\377\333N\314\246\354\354Z\373\001\023\260\207\370Q\227E\031"
+	.ascii	"*gM\344\032\224X\255\217\374\202\256\"\252js\264\215\330\214"
+	.ascii	"\331~\324+\\q\025e\325\033\371\331F\013\216\366\204,\301J\346"
+	.ascii	"\306Yk\030\243\375\343MY\023c\304.\254\224\326l\332\263m\033"
+	.ascii	"1\327\372G\005G\273\326'Z\032\252\313\373HF\331\326\341\027\003"
+	.ascii	"Y\2501 \305\224cF\231`Fdf\264m\016p\002\241)\253\036\020xG\223"
+	.ascii	"$\255\001e\206/#_\366!f<\227\212\025*\003\360\227\215\004\323"
+	.ascii	"L\t\032\016\212\026\341\255\023\322\\/\341\3072\266\265\247+"
+	.ascii	"v\3058\371\326U\323\f\037\362\262\232\t\303\305^\003\344\273"
+	.ascii	"\215No\213\210\013P\350C\0175f\3567P\320\r\302\303\3339dQ\325"
+	.ascii	"pJ*\253\202\\\\g\315\350\320wZ\333\007\205\201\316\354\322\326"
+	.ascii	"\275t\210!sO\001XF\n\316[_d\3747\322\201;-H\243z=|\376\221\346"
+	.ascii	"\2506Bw\002=b!\340\211\372.\360\001E\373\302\365u\276\236\206"
+	.ascii	"\rI@$\352\230zeo\252\346\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`_\004m\024"
+	.string	"V!\200K\260\326M:\364u\362\2101T\206o\345_\266\303`?6\177\377c\002\007#\034\372x\250\315\234\374ym\334\220GJ\027@\345?e\366\336\351\3478\024G4f\310\340\0067\360(|\370xm\344\2362'P##\226l\222\210\334\001o"
+	.string	"m"
+	.string	"j"
+	.string	"h\2557\016\215\343:\265\241Z\r}\223\241m\030\332\346B\327 \001\205\024Yh\032\333U\027R\205\256\205L\241eZL\270\331\036\030[k\r\323\\\324\025\tm\372\024\251\352\375\364\031\276V\276Jp\245\215\320\263\007\203\301 \204\236y\3202\007\035\240A\307\210(\212\242\f\2326\242i\232CRk\327\372$\307?L\\\270\026t,\254\265Z\026\001@\240\324\354a\334\323\336\005\217\257k\232\252R\355\317\037W-_\022\036\242=\367h\354\205\3705\366\343\345/\231b\003\307L<7\355X\304\222z\232\3755.\277`\351\234f\277\320L\370W\022\213+\232GE\013H\321\003P4\201\023\275c\242qJt\016\211\326\031\321>\"\332@\210\356\001\321\007>t\002\017\215\240C+"
+	.ascii	"\352\002\214\346\002\225\311\221\216\254\020\366\230\313|\203"
+	.ascii	"\n\322\017\034\330\371\336`\217%\361\267\224\212\244H\361\\\262"
+	.ascii	"\344i=\276\257\311\020)\033\362#\2209\013\021#,6\362\261\256"
+	.ascii	"Q\244\375\354x\332ef\342\302\345\263\031O\343\322\354g\354N{"
+	.ascii	"\031i\265'\3321\037%Y\035\251\331\023\245\242}\214\035W\252\034"
+	.ascii	"W\272\232\375P\357\264\037\272\314VN\001\025\300\265\305n\376"
+	.ascii	"\230\253zt1be\316)\314<\220\031\036Y\201R\302\305<\250\253\024"
+	.ascii	"_\244|\263\363E\221\345\203.\313\260\202D\321)\177\273\270\362"
+	.ascii	"5<\276\023-Z\\^\2262\t4\3621\2267/\363\016)PO;\345_~/\377\002"
+	.ascii	"\362\263\266xT<\345_\275\031\230\277.W\336\026\0350\007\346\262"
+	.ascii	"\033\330\315%\016B\250Q\020\002;F\204\202\211\231\213\216\001"
+	.ascii	"\340\002!\"r\003\021\220\220\211\224H\004\022\n\0052C\017,\001"
+	.ascii	"b\326\327\225X\021\2009\223/\224q\347\334\363h\212\035v'9\032"
+	.ascii	"\215\316\244$A\340\314J&lj\322\021\202r\256\251\261\273\311+"
+	.ascii	"\344\265f\013?\272<y\225^6\fj\023\026\200\021\334\034\300\356"
+	.ascii	"uRD\352T\273\313\336\231\234\244V\254\r\341\227\n\327\221s1\256"
+	.ascii	"1dp59\320\320\255\372\245,p\027tnO\032"
+	.text
+	.section	.gnu.lto_.refs.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375 \250\245\003"
+	.string	"\022\t\031\037\220)\351\260\370_\365\377\377\377\377\271\352\031\312G\275\"\324\003\377\267\326Z\223\244m\302\211\334)\337.\260\231\332K\017\360\366\257\004p\226\220=\366\023I\377H\377\321w\324n\324V\324N\364\243\376\241\377t\307y\365\225\262\341\005\346\233\376*W\232A8n8>8.\352\305\361\3508\342x:\316\243\242~H\004"
+	.ascii	"B\b\r\224Ph!\371g\216\f"
+	.text
+	.section	.gnu.lto_.decls.78a952ca00fb31b,"e",@progbits
+	.string	"(\265/\375`\2354E\335"
+	.ascii	"\372M\025JV \fA;\351\226\326j\t7s\0368\363\347\n.dd\302\340\275"
+	.ascii	"\315\373\317l!8\233\377QU{\345\213}S\237\256\321S\033\331\232"
+	.ascii	"\300\365\253M\273K\261\002\340\267\221\263q\361\243{\316\272"
+	.ascii	"\341c#1\322*\024Gt/\362\345\265\241\204&\020#?\331\340\336r\247"
+	.ascii	"\355\003\216\004\270\004`Br4\266]\267(\035\256vM&\375\273F\323"
+	.ascii	"(\032\203%\3324z\006\316\323\017\247\272\274\364\315%}\307\245"
+	.ascii	"\357+\351\315\314\322\303\365X\372=\213A\350l\0303GZ\302h4qb"
+	.ascii	"5\273\250c\274\200\361D\252\231\243\227\366\350\307\223\276\306"
+	.ascii	"o\245\324\226\261\203v\355\3745\347\022\331p+\373 \324\371 |"
+	.ascii	"3-\231\234\260*~Q\277t\214\030\253u%J\330\227[1\20089o\310\200"
+	.ascii	"L\232Sc\033fHV\244'\306.\265}\326\317\256\026\214\215\036\177"
+	.ascii	"As4\347\234s\363\303L\214\2501\266;B\0274\366j\302\377Y>\253"
+	.ascii	"%Xg\304\267G\243\305\346\247\243\261\236\tQxnm\251\315\263oO"
+	.ascii	"e\314egZ\212\263\356\b=\244\315\264(\\vk3Q,~Y\032\307\335\\q"
+	.ascii	"Ai\211A\261S\20639C\247TE9\350\300\306\331'6\314\3025\201\260"
+	.ascii	"\244l\3576\316\226\3314\013\027\304\001\\d{6\316\252\331,\026"
+	.ascii	"\256i\3153>\220r4\0060\347\274\305\322\3319+gW\033g\337n\341"
+	.ascii	"\254\226f\316\031\004\b\020 4\344x\351\221\031\331`\253\301Z"
+	.ascii	"\271i\260Jqi\202\215o\205\244\267X\354j\333\254\225['\226\312"
+	.ascii	"5\2549K\3119\337r]\261k\303\245\205\234}lU\345\274\036\001\377"
+	.ascii	"\2106[\305\256\335\325*g\037O\303/\262\260A\300\234W\r @`&\030"
+	.ascii	"\2276!~\b\322"
+	.string	"+\323\337\256\205\265\234\033\022\263\361\205\322\003\2456\233\3313\273z\260h=Dp\f\254\361{\322[\017\302;8h=\b\317\223\332(V\212]+\260d\267cV\3543Dk^s\316:\366K\020&S\343k %A\316\266\002\241\035\034\264\025\b\177\"m\273#\254`1\bsN\031\2552d\032?\204\264\202\335\021v\260\030\204\226\313~]'\0224\213\345\274Z\2701\230\370\2255\266Ll\023\273r\260^\347\240\203\337\345\327\312\225\363\252\203\263\2644\004\332\370\rHq<\334v]\347+w\360No9\b\355\240\345 \374j1\bS\273#\334\360\235\037\357<\347\3079$\f\362\024\033\203\037\337\337\322u\322m\376\373wAW\215\313\367[\271F\262A\033\370\352\243\337\276u\214\366\300\337h\355\374{\305\013{\333\350\036\374\027\357\200\034\260<\240\350\211\n1\"\376;\306\324\315W\360\337\027\277\305\322\314^"
+	.string	"\217\337\346\360\300o;\370\255\212\017X~\033\344W>8A/\363\210\377zmP\202\2773 \301\222\036\301\177\271\317\375\337\322\"h\022\312\377q\377\335\022\240\341\357\344o\221\277\375\321\340\277YjC\376{]\370\337\017\374\215\001\006\277\265\340\267\006\370-\001~\333\301\026@"
+	.string	"v"
+	.ascii	"A\r\364\367\t\027H\236\t\377}\263c]\374\033\003D\277u\361[.\277"
+	.ascii	"\275\353\021\330#\375\363\367\004\324\337\232\375\026\205\377"
+	.ascii	"\036\f\360\337\262\337^\320\033|^\363\337\032\177\367\374\315"
+	.ascii	"\363w\007\376\336\300\337$\374\255\342o\024\177\213\360w\211"
+	.ascii	"\277A\370;\001\177w\360\367\210\277A\374M\200\277\005\3607\207"
+	.ascii	"\277o\376\256\371[\370\267\375\355\230\337\002\376\366\357\267"
+	.ascii	"z\277\305\373m\335o\347~\013\367[\266\337\252\3756\355\267P~"
+	.ascii	"\013\366\333\255\337\026\375\226\204\337\026\177;\363\333\017"
+	.ascii	"\377\311\374\366\352\267&~+\201\337\216\370m\221\337\n\371\255"
+	.ascii	"\323\177\262\337N\375\026\352\377\206\3376\375\266\306oi\374"
+	.ascii	"v\351\177\225\337\"\375\326\376\177\362\333\232\337\322\374G"
+	.ascii	"\2630~\353\374\255\321o\205~{\374\355\t\277\345\371\255\t\277"
+	.ascii	"m\361[\026\277\355\371\355\212\337\022\177[\302oA\3746\203\377"
+	.ascii	"v\377\353\376\323\375\377\372\257\342?\333\177\013\203\203\203"
+	.ascii	"\203\177\352\363\323T\340/\200[\313\n\271\311T\301\271\022-\235"
+	.ascii	"Q(&\353\214B\231,\344f^\346&Q\217\264\ter\266A\231*8\243DL\316"
+	.ascii	"&\024\223\315+4[-i+\324\322(G\211rr\316Hk\325\022'g\242g^\306"
+	.ascii	"uR\206\332K\312O\331\302i\255>r\3169/\305\354\242\2405+3\303"
+	.ascii	"9\221@[\030\345l\227\223H,\355\362Ef.m\316F\3533g&\264\204&\250"
+	.ascii	"\235{\361\3149\271I\204\304\214\202\342\0301\241/2\222\036\226"
+	.ascii	"\311\031\215\202\2168{\022\255\312\314ui\253\262\035\3243\215"
+	.ascii	".\327,\326\227\023\035\322\204\324x\002*\036~\251\354z\251\356"
+	.ascii	"U\215\023S\211\262w\257\376[u\255z\n\007z\243T\306\227\033\333"
+	.ascii	"\261\021\277G\256Y\025\243\300\306\032\314(Iq\244Dn\221!\230"
+	.ascii	"\243\277\265\306O\233D\206L}i6\227\032O\260\347\341\327\307z"
+	.ascii	"}\334\251\t\254yi\003\003n\360\t0?\237\032\374N\375\367\307\225"
+	.ascii	"j\352\204\001CC\260\361\0052\3427\bN\2210-C\032wX\262;\302^f"
+	.ascii	"\213A\330\341I\263v\241\206D\214\230\353\355q\241xL\007\230\033"
+	.ascii	"\227\307/tX\025\207\024\326\370>\331PY\221)5\276;,_\215\231`"
+	.ascii	"\026!\257\241\251\322\245\n\230\216\347\220\032\023\273NJ\202"
+	.ascii	"FD\322\377\342h\032\342\021\301`k|o\\*Dt\254\361H\247V\023\360"
+	.ascii	"\264Hi|i\\\0314RSSW\215O\023\343\316\2702jr\035\022\300\313\364"
+	.ascii	"+C'p\314\034Qc\245\273$\244{\016\032\221Q\272H\305\036Ysr\367"
+	.ascii	"(F\207\301jL^\370.\214\353\234\242\245d\253\361\235\307j\350"
+	.ascii	"S\270\305\254\351\326\370\0329}\331\341\325\370\026\t\257<\367"
+	.ascii	"\352\032_hv\211\356\262\007\273\314e\336l\327\333l2\357\300N"
+	.ascii	":\036q\233=\326b\312\230Y\372\213\340]\325R\037\227\333\3541"
+	.ascii	"n{\355\367g\303\206\313\n\231)gWu\233\r&/\371Hl\355\365\355\351"
+	.ascii	"\320\205\021\2732\304\027BS\034aRzan@\033\r\233\""
+	.string	"\303\245\303\254\245\237q\222^l\306Hz+\026\003\337\230\231\036\\^p{zH\236MI\215\365\362Fx2\353\363\362\316\303\\\212`\314\350\0326twd\340\272|\310\021C\307T\202w\207S\006Ko\257\261\036\215\21571Z\270T@\223u\306C\312\256\216++\3435~\327\211\321\\\r*}i\334[F\274\351. S;kL3\307Ag\265\221\344C\256\031\227\265\300\331\030\261\"\222\002\347\374R\"\223\324\244\261\20659C\rF\225\034Ue!U!i\254a\263BnF%UE\327\300&R\244\217,\201-1i.9gWcq\225\301\322m\355\326Y:\255\317\372J\277\265\225f\353*\215\326jM\305\256\275\3263\336em\346\325\321*cF\364Z\217\001B\351)\033\230N\021\232\362\372J\253\261\302\300b\254\265\223\026\263pb\0200\023\263\326K\232k\003\323\231\211\240@\260z\336\241\331"
+	.string	"\312\315\311\270"
+	.ascii	"\343Ul\n\231P\314\253\313\335\212\217\324\225QI\351(\302&rA\260"
+	.ascii	"4\376LN\217\305\244\307y)\276\032\213\342\013\353':\350\266`"
+	.ascii	"\310\245\307YR\033-&[\006\033\203\365\327\360\250\317G\234Yz"
+	.ascii	",\226\036w\245\307G"
+	.ascii	"\322\343\037\351\261\016\256\255*\252//\215\341tp\312l\311\365"
+	.ascii	"h|<#=6J\177\305\244\277]\322\017\235\244\246\271\346h\r]\337"
+	.ascii	"\0161\271\364\267J\272\201\335\021\266\025\225\316\021$\256-"
+	.ascii	"&]\325T3jQ\226A\332\310\233\352y\327M\310U\264\361\377l\032\356"
+	.ascii	"\272j\222:\222~\265;C\332\t\206e\tQ\013\231\302T}Ji\215\203p"
+	.ascii	"\301C\342\243\361o\220\364\275\364\334\021e\266Q\224\250\251"
+	.ascii	"\021\rm%\033v\327*\232\260\250\247~\3211\230A\2344\324\n6\321"
+	.ascii	"\365z\246P\300\204X\256\2066\216\326q\327*\tD\021\331c\262iw"
+	.ascii	"5K_\200\351\370\033\252\237:\252\245\332G\357\350\037\r\244{"
+	.ascii	"4\017\2736\264m\274otS\313\350\032J`9\356\240\326\213\r\374\300"
+	.ascii	"\350Ys\304\0342\242\241\215d\323\206Dk~\322\200\361p\302\002"
+	.ascii	"\001\002\004\b\020 \272\253\250*/\003~\353\260]lX\t\024\344x"
+	.ascii	"ICR\246q;\215x\347\330\021>\233\326,fS\0248=\312\004\361\234"
+	.ascii	"\034\217a\2610Ggtb8\254M\312\321"
+	.string	"\226[\364\243\314\025\275'M\306\002/N\262k\204L\313\023\262\246t\0022M\232\340\257\017L\252\334\242`D\301^\307_?\344\210D\341\025g]\346<\274\342\256\232/]\360\232Cf\216\252\034\243\364BSK\013s\331\257\013\354b`]\201\303\203n\035s\335\301\031}\202\215\361\022L\305\005\2525\266\306\365\327\325\227\356\364ee\301\r\375\226h<\343\322\035\267\253_\341$\266\302\312\274c\333\263RM\214\024Ar\234\344\006\332\343\005`Y\272\003E\204\b\266\"\321\026\003\253\306mNJ\325\261\325\032\315\227\237\335\222J\305\226\2737L\205\215T9\365\t\2721\307\254\341\"\326\212\335!\203HWX\272\303DJ\n\013a\300z\207\246\204J\223\013\310\324\261\220\034)1h;\032\343 \327f\351\217\356\2521\006\242$\335a\362\341\343\352\331\257\274\244\241k\357\016M\370\326\305\b\220\251\364\202\023\217\237\007\206\322"
+	.ascii	"]\362\021@\315*\216\0130\347\246\017\351\030\037\027\223\036"
+	.ascii	"\307Pm9\316\356\032c\250\r\363`.\251\n\007\274)so\215\217C\224"
+	.ascii	"b\300\341!\351\230)\t\357\270t8y\371\225\227h\312\256ta\001f"
+	.ascii	"g\323\207\033\257#\257\246\343\035\307:8\350\340^R%Xt9\216\235"
+	.ascii	"\232\334\320\366p`\247\253\037\321,\271\364\007\370\262\301\304"
+	.ascii	"\324\030\337\270\227F\342\005\211\2571\266q\265\246:@ \270F\226"
+	.ascii	"(9fc,\003\317\260\353\3310\215\017\321^\214\261\265\245/\201"
+	.ascii	"=\233\020/\035?\321\236~@QI\177\254\004\205.GUY\372\033\261\324"
+	.ascii	"\332y8>\262+>j,\334\\3\023\007\230\266\236\224\344\247\025\r"
+	.ascii	",\024\201\313\272\221f\300\201\235\330\211ad\300v\2634\0268\206"
+	.ascii	"a4\326]\026\034U\343\337\020\245\031\3540\0233\261\021\031\224"
+	.ascii	"\275\033\255\027fZp\321\261\021\027\3000N\215q\363\206ua5y\261"
+	.ascii	"\201:H\242\f\t"
+	.string	"\363\222R\020$0\020/-\003\2128\367\234\020a\342\243\361\361Rm\315B\265\325\370\016\332\264f\252c\353\322\370\226\261k\\:\304\004\257v\277\310\2604y\332$\035\221\302\361\226j\3301f\314\255\253\240\013\232\263\2021%\235\245\032\244\302\204\271\200\030\266\252\204\320\277-\300\032\253\253(\2445\325\220\306\307w\377\254\236\203OJ\206C\336\366\300\\\277\337?,+al4\276}7\251\310\362\210U\343\373\345F\351\220\202\227\203*\345\340\304\213\227\253\247\301j\315\322\022\323\226\367\253'\225c\311e\263\224\336\254\036~\271p\271x\016\020\203f\031 X\231\365\355\001\346\254C\003,\346\364\"\314\275\263OV0*\215\327\013MYJ\215oS\224r\370\243;\335\255K\327\274d\243\3545}\230\361[\242\343\361\367[7\023\207\304\b\224\274\264\002\260\270\270;W\303L\356w\356\f\251\251\206\327M\222Q\031\257\265\024"
+	.string	"knn\027\256\354E\223\267_\270\233#\007L\257\r\253\361\315r\275\206cqEv7\ng\215\251\b\232\225Z\200dm\355\262u\025MX\021\340\036\226_\266\253Y\272\270\037k\215\357\025\013xa\274\032_+\226o9\245i\252\211R\277\0312\276\032\277\006H\272\241\207\232\332\335\262lf56R\016L)RnZ_\207\253\275)\277i\367\314\306\006\030%J\032\337\263\276f\027\355\367\354\226\3414\327{\206s&\262\026\203\241\265\030\314\250\025!\002\023\342\327<\323K\346\001$/r6,\nL\227\262\276\364\002#N\234\\(\027/\017>)\271P\260 \035\027`\343+\326>\272\222l\t\203\003\003F,\354>\271V\224\330\206\334\033\330)\n\225+t)"
+	.ascii	"\2000ar\301,_\007L\317\257_\260f\222\252\322\322\3706\271^\024"
+	.ascii	"T\221Q\244\361]\243O\\f\004\3115NK\342\344nW\333\2704\260P\361"
+	.ascii	"\335\032"
+	.string	"3FE\250\324\304\322\rh\036n\222\213\365\254\273U\323\224\227_:\\1kz~\370\357\222\337\2550\034)\033iM\032_-\033v\351\210\234\0056\276J,X\316\340\230\301\253\3258\333r\273J\377\376\2059\313\230Y\363\223\211#\374\355\355\214\315\261\327\n\340?\316\371\377\207\240\234\211\236\004\361K\257\312\210rt\310\016\3109H\223\350\351\214B--8\243D\331\351\004\216\311\202s\315=(\310Q\037\331\271B\227\030\272\354\274\346&\024SnB\227B\3165?\363\n\rHb\213\036\2544\026\257\017\321\006\205\262\030\2244\022\221*Z$\213\306b\bG\025\310c\b\312\"\361\003\005P\223G\240\036\235\013FU\3508L\241t\241Z\300\307X\374\321`\001\251\372\020U\024G\025-z\224\305\017\2440\026Y\250%X\030\213*\212\t\220\312\0234?C%Te\021\251\001\037c\004\206o\021\"\331BI\f\002"
+	.string	"\007I\236\025(\370\360|\320\203\354\271y\213\020,\214E\325g\b\250\307X\024\201L\016\211\310"
+	.ascii	"\0044d4\036\2154J\036\025\004\305\244\360\003Gd\013\345\321H"
+	.ascii	"\363CT\201\202\324 \341[\204\250\200\n\021R\210P\252,\220De\207"
+	.ascii	"\023z\216@&T\344\321D\220\252L\246\220BGU\221!$Ue\n%\\\250P\""
+	.ascii	"\211\312\024\027Z$\207N(\213F\021rX\030\213\312\"Q\003>?\"$"
+	.string	"\211*\220\212\"Y\223T\225\304\236#\020\320\0032\004@\3659\366\030#\3603T\342\203\036\244\211\n@\307c\t\236\231\r#(\325\244\212\304\361\341\3603T\302\304\205\367\024\221\252Qe\221\236\204\007\007\360\340\003\0274I%2UyB\270\360\036\345\320\005R\370\030\211AAG\023\031\224\311\343\216\222\007'\005 !\025E2\251\366\034\221\027T\036\b\020\225D\b\b%G0\036-\240*\211C@D\024\" \224\f\242@y,R\220\002R\251\006\251@\252\222\202$\017\213\342\217\361hb\202\023\222\304\021\214C?8*\217\b\031\222B,,\270P}\214\"\250J\"\222\307\305q\305\t=D\240\025\031D$\221*\nE\244\017\t\025T\240\025D\025(\b\221j\361\247\2504\252>E\033%\217\352s\034\301F\3659\006a%\317\005r\222BG\032UID\3413D\\\221\246\312\024\211\343CT'\240\344\341"
+	.ascii	"\001@E\242\n\244\372\3633T\302\205\022\007\251<\241\242PT{T\024"
+	.string	"\032N\350!\256"
+	.string	"\002\"\232p\201\264Q\276\305\206\237\241\022\306\342LM\222G\211<\236\300Q\"\217BX\251&\177~\216B\025\004\305\024D%\321'\r\032J\236\320\243\266\350IO\244\030\301'\250G\250\362\244P\225De\222\247\207F\345\321Q\205RP!d\243\362\340\030\217\305$R%A(\031d\203T\2360\206\220B(\0314TyP\030CH\337\"\004\206$\217R=\241\207xB(\031t\243|\213\020?C+\202\210*R\231\024a<\006\005\035{.\370QHE\212P\036\217H\0217>F\365&y~\206V$\205H\245\320\375\031Z1\224\372\004\365\\%\217\007#\224\306\"\215\022h(\251\"\205\306cQ\331\243\"\213>5J\236\017\224\306\342\020\315}T\022$\324\r8\330 D\206+@\001&:d\300\002\022H{B"
+	.ascii	"\021\213H5\311#\224\f\022a,\022\203D\364 \223\"BX\360\177F\251"
+	.ascii	"\016G\220\250\244\271*IQH`\367\031F&zt\341\204|p6\326\030\370"
+	.ascii	"m\370\367\224%5\003\343\246M\211#sb9\016\350\252\222\032\257"
+	.ascii	"C!\026\221\027g3F\370\313\246I\320\210\333L\221\330P\260\310"
+	.ascii	"\321[\363\262Q \nm\206\211\271\300\232\312`"
+	.string	"\231!j\035^od\214\254)\332\0171\264\231lUd\f\316oP\210\230\224\032ap\231-\277,+X\360\307a0 \016\304\231\342\346D\2521\036\203\311\034\007b1\031\007\222\200\006\352\004\346L\244\203\227DQA\021\342\017\305\322\017\026\203p\306\356\b\355\337\210c0\330\007\230\245#\1778\311\205\245\036\231\237\315R\344\352\213y5\374e\230\245\216\316.\312\207\241\372\007\237\225\242\3068\317\016\016\006\346\3518\243\320\234\211\360\036\326;\316\273\265\030X\213\201N\tHQHB\274\2567fOc4\032\257:Ib\224\001\301\323\263\371\221\327Vuw\241\320(a\253\202\301\005\243Yf\222(\225\035\336\323TQ\335\275\302Y\313\262DG7\026\006\330\205c\313\361\016\270\256\301\251\306\027\276h\321\202\345\230\230\335\241]0KHn\304\035\313\321\270\362%5\324J/\264\265\265\341\267+3s2\240aY\216\337\266"
+	.ascii	"\006\302h\214\335n\330\020*"
+	.string	"7\256\206\320\364\302\023,X\2405I=\274\234\032\177x\224^Hb\305\312\325\333\322U\345\344\344\355\311\226\024\203\263J\225\265{&dp\214Z\232\201I\205\3123GH\r#/\326\024\003\225(Q0\032\bj4k\353\215\277\263c\264;\303$\353\353\25416k184\262\224\231\322\030\227]#8/Y2\327\030O\351#J`QG\2151Yc\335\350\314\254Fc,\245\305\032\300\345\t&\272\0257\306\316*\305\240\025\215\3421\r\320\345\027\022i\320\276=\300\204\245\250SC\363\201t2\004\225b\314\224\b\315h\2224\006#\025@@HP$\233N\230\251\017\023\200S\311\023\202\230H\2312%2\"\005I\n\n\231\016\177\021\322\360y\263p\245\325N<S(\206\336\237P\375-\023\354\031\222H^}\214\335\226\235\343\2473\t\002\351\262#U\216\271\374\332*\307\222\202\237\243u\241\343\326\230\234+\n"
+	.ascii	"\303`%\253&\027\274*\232\006b\366\375Y\220\003\300h#\301w=\304"
+	.ascii	"l\275JKvc8\305\031\031=l\331R\226\f\n\312\363\352\372|\252w\034"
+	.ascii	" \3607\031\2347|8-h\rQ\343~s\304m\214\360\263\002\223\224G\t"
+	.ascii	"E/\357.t~p\201\201Gh3\n\241\375b\334\243\320\n\006u*\213#\263"
+	.ascii	"H\r\225\013\245 \375\224X\202\314\235JjE\222\313\220\265\024"
+	.ascii	"\265\312)rdE\236\032\361j\007\34126u|\226\003\354\252\303=\247"
+	.ascii	"-\231\320\r}\341UPQs\324\247P/\234\200tx\3500\355\310\207\231"
+	.ascii	"\356\277\265\013\200\2135\252;\361\257A\2176\337\2314\0208I\306"
+	.ascii	"\377H\224\2672\004C\370\301\025\023\232\227O\021ph\350W\2738"
+	.ascii	"h\223\355r\236\3204\266\270\200y\212\317(\257\016\024sy\356\f"
+	.ascii	"\004.\001B\271L\341\270\336\232\336\314\tc5\004>\nM,b#\232\f"
+	.ascii	"4\226\234\311O7\212\347?\276\207}\311~}<\327wF\302\363\b\365"
+	.ascii	"ul\257I\221\260\033\r\030H\302\206I\273\\\267\211\021\322A[\225"
+	.ascii	"\"`\204\340\202-w*)*v\205!\300\202v@\002=\312&\336\377\212\222"
+	.ascii	"-n\266\304\277h\\\235\357{\346\250\262\017msJ\340\247\356\241"
+	.ascii	"\025\331$\206Z\265\0210q_\326\002\t\264\021C*\242+\370:tA\fD"
+	.ascii	"\327\177\227\215{\367UI\317\200E\201-\345H\322\022\304q*\024"
+	.ascii	"E\270\356/F\001\202_\253\324\332\025\303`\025\200\242Y([K\027"
+	.ascii	"\001\024\226$`?v_AO&\215\334\016\027]\321j\255\341~\271\266\206"
+	.ascii	"y\301\017|\207\f\220\272U]\210\225\002\246\375K~?\013:\254\311"
+	.ascii	"\316\335\334z\356\313\354\251\243\003v\323\314\370iAE\266\007"
+	.ascii	"#/P\256\340,\003\265\251*\255\023\223\336\341\357\347\f\3325"
+	.ascii	"\016\031\302D$I\003\375\024\200u\264\245x\0164\007\035\300Y\326"
+	.ascii	"I0\332tW\023 \341\345\231\260\231J\\[%\202\241\222\321\245\334"
+	.ascii	"p\254\351\025c\b\002\231\371\030\373\201\235\376C\200\017?\020"
+	.ascii	"\371\211\013\344\337\322\223\376s\356\354\200\377\305/0w\227"
+	.ascii	"\032&\252\340:\237\247L\243\211j\300qS\351:\214z\253)@V\262\364"
+	.ascii	"\366\353\201c \252\017\261\276\ng\307\210Z\277\3710\n\201d\365"
+	.ascii	"\246"
+	.string	"\210\364Y\026\314\215gnZ$NH\327\257\016P\235g\265\342$+\311\205Ny\020\024S+\202\245\316\313\225j\337p\217\026*B\214\253|c\021\247$\232Ah!v+\020\220\316\207:\365\213Z*\310\340^\203\0029\017X\021\271)W\343\371\026MR\026\315h\207>\250~\332^\263\265\t\265R\006a-\351\325p\206\243\016\005iQ\237\354\266\217\272\215\234e\205\\\374z\237\002\311\204\247l\264\266[\002\0265m\232/T\210*\005m\276\233\321\257\272\272P\r\211\315+V\026\371l\250\334\242\036\005S\320\244{\250\264\323\032V\247aLL\210m\3574dX\240I\301\305\243oY\255\3357\211\273\226K&\262\345\361w\n\034`\217\261\024\232z\313\001\220\215\377\033\241\022U\326t\370V\322&\232\215\220<\257\"T\263m\346uX\344Q\214g\222q\233\241\300\024\265B4\264\214\241\326\032\275\361\177\254G\317"
+	.string	"\r\257\261G\235\004\331\226\345L\226@\307\355\024I,\263\016\266\304\275\257\203\200\016[\026\243P\242q\021\030\336dVF\311\221\313\263\037\277\200\323\277\254\341h\221\362}\233\216\253\371h"
+	.string	"k\3633\232L*\373-\302\020\350\331\272\344\251\216kc\177t\377\200\227\362NM\374\200&\030\207f\230 \245\256\336\002\223m\030\304w\273\241\274\376\3664\307\332^"
+	.ascii	"Q\366\003\330\343\034\316\305\241\rz\337\347ZD\231\303\210U\b"
+	.ascii	"\371e\215\005\317\350\312O\277\331e\0016\r\213\376\213<\363\337"
+	.ascii	"6\344|^\371O\001Xp\322\200\274\355\262a\363\r\373@7e\310\366"
+	.ascii	">0\204\201\352?\024\026\334\t\207\240\177\\\013d$\221aY\276\017"
+	.ascii	"4(\226\244\211*&\224\251\345\215\241r\332\242\357T$/I\371E\t"
+	.ascii	"\201\337\304\257=\323\\\353\267\036c\311}\324\027\354+\211\362"
+	.ascii	"\307T\202.+\373!\320\233F! ?\314,\206\205"
+	.string	"B3\221\002\232\252\001%(\341Y,[I5*L\207\240\230\262\3416\201\216\021e\263\201\\\255\375X\343\002N\3761m_\250\r|\220A\206\322\016$\f\234\007\222[\017-]\201E\321\334\333\030I\227\266\373\202n>\267\007\363\217\201\260\212m\321/\300:@\n\323\304\034\030\r\272u\036\247\252\367\257S\344\f\032\n\366\265\334\363\265B\223R\r\004O\252\021\301\262Ht\r\013\001\330F~:8\323\237\t\234`\3057\323\371p\023:\247\036\213\"]\022<c\362\026\226\246\254<\345W\353\265\377\007\254\253\223\315\3148\365kK\274K\366\354\336\207\240\3576{4,\340\003\370\307\320\217t6\274E\233\213\213"
+	.string	"N\216\264\250\260\307\335\034sd\370\026\240\336\220Ak\013\252\t\206h\377\031\332\305u\005\002\337iZ\302\217\225\005\340#\200"
+	.string	"\354\032{\005m\031\201\026\272*)\367\330\311}u\221\216\257|2\326e\3162\320\225\231>\350\250\250GS&A["
+	.string	"\272\240\347B).\222\003\036|\2413\003=\212"
+	.string	"t;\367\212_\t\307\250#%\003\262d\236\032\007Cd\016kd%%1\235^\2349\037B\\\217R\236\252\b\367\274xtX\230\347\030m;\210}\345\204L\314\304w\363o\340S.\002j>\345\262e\206+\244"
+	.string	"\013z\376X \275#9\335\240\311\030cXn\257T\355Vr\370\340\305$F\343al\355\034O\270\322\203\227\353\350 fLm\361e\004\020\304\3469\277\262\201\243I~\225\200\252\227\246\037F\277d\340\023\003b\231-\360\354\367\307\361\312\370\332Y\315\232\342\364\315$\257\207TkM\036f\264\241\3610A\317`\3550}oF\330'aS\"f\277\331y\226\267EA\306;=V\030\237\377\003\030\371m\007\2379)+q@i\234\213\345h\274!\342\262\214Q$\304\251\366\314\211\004d&\271\032\320\342\344u\314\225\205\242a\206\303\026\344\327\355\320'CQ\267\370\362\303QN\354\365G1\016&\274x\004\177\303\307\267\013\201G\314.\365\266X\321\374\255\276:\305\265i\276j\231\240\327\327\021\347\372\030D\212\020\207s\275\223\235\226bU"
+	.ascii	"\245\371\303\2110\350o\346f\315\251]\357\266v\215Y\202aP\nO\200"
+	.ascii	"\004\304\213\353\350\317\245VPv\333V\263\233%\346\350\307\237"
+	.ascii	"\307\215~X\037{\253+\266\343 \312\200\375P\315\300~\2550\246"
+	.ascii	"\225}L\032\331\030\353\t\323\250\261\373\302\370\213\340Oi\341"
+	.ascii	"\017\363W\\S\377\\\373\353\031\336\276}\\E\246\244\f\207\300"
+	.ascii	"\377\177\267Q\324\207\310\360}.\037\013^\3750\323\243\034m\211"
+	.ascii	"\327I\267G\372\207\326u\330\f82'\335]\304\\\212\271\034~=\013"
+	.ascii	"\264\231nw\344\266\n\231\262/\314\026\204\261\355O\357)N\277"
+	.ascii	"\377\365\210\365\307\255\305{L\026\013\216\0267\007\240\205\326"
+	.ascii	"\207\321\327\002\2710o\314\375\356\301\016\343\036\031\347\314"
+	.ascii	"\332M\224\177\224\273\332s=\370\314L\003\262y\317'\336~\340\360"
+	.ascii	"\276\373WzfRv\320\370\231\373\224;\267\371\312g\276\336\335\367"
+	.ascii	"\212\231s\334\n\377QX\026?\334]\266\237\376\334c\362Y\236\346"
+	.ascii	"m\355;C\3761h\t\362R?\336\203\366<\244\371\325O\366Y\256MDi\310"
+	.ascii	"2;\265\027\373\031\224G\244\254\372_\"\277J\254n\263\271\312"
+	.ascii	"\237\222\335\321\311\242\361\313\343\374{n\320\336>\321\354V"
+	.ascii	"?\313\f\357r:\313\351\237c\275\234\347>\322\305Ls\205p\216f\031"
+	.ascii	"G9\001\033\375\377W\377~\337\341i /\375\026,>\3557\366\303R\303"
+	.ascii	"\342?E\360|\216\370\3606\313?\201\273\347Xa\223\357\331\345\021"
+	.ascii	"_j\353\222\236g\032\377\031\273G\236\275\344\256rbRn\324\255"
+	.ascii	"{\023\355\322|\n>Jz\306uoj\343\b\363\353\367\223\034\231n,;\376"
+	.ascii	"/\342\256\025\264\363\3271\254G\371.K\354\355\267?\027%\033\362"
+	.ascii	"\004>\302\346\3663\214@\213\314\322}\317f\367\313\362\021*\377"
+	.ascii	"\035\206\212\fs\177\200\263\307\023>#\360\220v\251\027=\224n"
+	.text
+	.section	.gnu.lto_.symtab.78a952ca00fb31b,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"mspSerialStreamStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"serialEvaluateNonMspData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.78a952ca00fb31b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7782 @@
+	.file	"msp_settings.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/streambuf.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/fc/settings.h"
+	.file 8 "./src/main/msp/msp.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "./src/main/msp/msp_settings.c"
+	.file 11 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	msp_settings.c.757bca04
+	.weak	msp_settings.c.757bca04
+msp_settings.c.757bca04:
+	.long	0x681
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1058
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF950
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF951
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF952
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF953
+	.uleb128 0x3
+	.long	.LASF955
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF954
+	.uleb128 0x3
+	.long	.LASF956
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF957
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF958
+	.uleb128 0x3
+	.long	.LASF959
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF960
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF961
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF962
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF963
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF964
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0x3
+	.long	.LASF965
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF966
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x4
+	.long	0xd7
+	.uleb128 0x3
+	.long	.LASF967
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF968
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x100
+	.uleb128 0x1a
+	.long	.LASF1059
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xe8
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF969
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF970
+	.uleb128 0xc
+	.long	.LASF998
+	.byte	0x10
+	.byte	0x5
+	.byte	0x19
+	.long	0x14b
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xe
+	.long	0x14b
+	.byte	0
+	.uleb128 0xd
+	.string	"end"
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xe
+	.long	0x14b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF971
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0x124
+	.uleb128 0x3
+	.long	.LASF972
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xd7
+	.uleb128 0xf
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x205
+	.uleb128 0x1
+	.long	.LASF973
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF974
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF975
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF977
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF980
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF981
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF982
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF983
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF984
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF985
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF986
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF987
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF988
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF989
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF990
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF991
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF992
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF993
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF994
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF995
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0x17
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF997
+	.byte	0x7
+	.byte	0x47
+	.byte	0x3
+	.long	0x168
+	.uleb128 0x4
+	.long	0x205
+	.uleb128 0xc
+	.long	.LASF999
+	.byte	0x10
+	.byte	0x7
+	.byte	0x49
+	.long	0x23b
+	.uleb128 0x6
+	.long	.LASF1000
+	.byte	0x4a
+	.byte	0x19
+	.long	0x23b
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1001
+	.byte	0x4b
+	.byte	0x13
+	.long	0xd2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0x105
+	.uleb128 0x3
+	.long	.LASF1002
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x3
+	.long	0x216
+	.uleb128 0x4
+	.long	0x240
+	.uleb128 0xf
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x53
+	.long	0x29a
+	.uleb128 0x1
+	.long	.LASF1003
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1005
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1006
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1007
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1008
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1009
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1010
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1011
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1012
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1013
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6a
+	.long	0x2c1
+	.uleb128 0xd
+	.string	"min"
+	.byte	0x7
+	.byte	0x6b
+	.byte	0x13
+	.long	0xc1
+	.byte	0
+	.uleb128 0xd
+	.string	"max"
+	.byte	0x7
+	.byte	0x6c
+	.byte	0x13
+	.long	0xc1
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1014
+	.byte	0x7
+	.byte	0x6d
+	.byte	0x3
+	.long	0x29a
+	.uleb128 0xc
+	.long	.LASF1015
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6f
+	.long	0x2e6
+	.uleb128 0x6
+	.long	.LASF1016
+	.byte	0x70
+	.byte	0x1e
+	.long	0x211
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1017
+	.byte	0x7
+	.byte	0x71
+	.byte	0x3
+	.long	0x2cd
+	.uleb128 0xc
+	.long	.LASF1018
+	.byte	0x1
+	.byte	0x7
+	.byte	0x73
+	.long	0x30b
+	.uleb128 0x6
+	.long	.LASF1019
+	.byte	0x74
+	.byte	0x13
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1020
+	.byte	0x7
+	.byte	0x75
+	.byte	0x3
+	.long	0x2f2
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.byte	0x77
+	.byte	0x9
+	.long	0x342
+	.uleb128 0x10
+	.long	.LASF1021
+	.byte	0x78
+	.byte	0x1c
+	.long	0x2e6
+	.uleb128 0x10
+	.long	.LASF1022
+	.byte	0x79
+	.byte	0x17
+	.long	0x2c1
+	.uleb128 0x10
+	.long	.LASF1023
+	.byte	0x7a
+	.byte	0x1c
+	.long	0x30b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1024
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x3
+	.long	0x317
+	.uleb128 0x4
+	.long	0x342
+	.uleb128 0x1c
+	.byte	0x11
+	.byte	0x7
+	.byte	0x7d
+	.byte	0x9
+	.long	0x39a
+	.uleb128 0x6
+	.long	.LASF1025
+	.byte	0x7e
+	.byte	0x11
+	.long	0x100
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1026
+	.byte	0x7f
+	.byte	0x13
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1027
+	.byte	0x80
+	.byte	0x1c
+	.long	0x34e
+	.byte	0x9
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x7
+	.byte	0x82
+	.byte	0xb
+	.long	0x15c
+	.byte	0xd
+	.uleb128 0x6
+	.long	.LASF1028
+	.byte	0x83
+	.byte	0xe
+	.long	0xd7
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1029
+	.byte	0x7
+	.byte	0x84
+	.byte	0x1b
+	.long	0x353
+	.uleb128 0x4
+	.long	0x39a
+	.uleb128 0x13
+	.long	0x24c
+	.long	0x3b6
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x4
+	.long	0x3ab
+	.uleb128 0x11
+	.long	.LASF1030
+	.byte	0x87
+	.byte	0x21
+	.long	0x3b6
+	.uleb128 0x11
+	.long	.LASF1031
+	.byte	0x88
+	.byte	0x17
+	.long	0xe3
+	.uleb128 0x13
+	.long	0x3a6
+	.long	0x3dc
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d1
+	.uleb128 0x11
+	.long	.LASF1032
+	.byte	0x8a
+	.byte	0x19
+	.long	0x3dc
+	.uleb128 0xf
+	.byte	0x5
+	.long	0x7c
+	.byte	0x8
+	.byte	0x17
+	.long	0x411
+	.uleb128 0x1
+	.long	.LASF1033
+	.byte	0x1
+	.uleb128 0x15
+	.long	.LASF1034
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1035
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1036
+	.sleb128 -2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1037
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x3
+	.long	0x3ec
+	.uleb128 0x9
+	.long	.LASF1041
+	.byte	0x5
+	.byte	0x26
+	.byte	0x9
+	.long	0xc6
+	.long	0x433
+	.uleb128 0x2
+	.long	0x433
+	.byte	0
+	.uleb128 0x8
+	.long	0x150
+	.uleb128 0xa
+	.long	.LASF1038
+	.byte	0x29
+	.long	0x452
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x9b
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1039
+	.byte	0x24
+	.long	0x467
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x100
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1040
+	.byte	0x1e
+	.long	0x47c
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0xc6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1042
+	.byte	0x7
+	.byte	0x8c
+	.byte	0x13
+	.long	0x497
+	.long	0x497
+	.uleb128 0x2
+	.long	0x100
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x8
+	.long	0x3a6
+	.uleb128 0xa
+	.long	.LASF1043
+	.byte	0x2e
+	.long	0x4b1
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1044
+	.byte	0x9
+	.value	0x19d
+	.byte	0xf
+	.long	0xf4
+	.long	0x4cd
+	.uleb128 0x2
+	.long	0x100
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1045
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xa
+	.long	0x14b
+	.long	0x4e3
+	.uleb128 0x2
+	.long	0x433
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1046
+	.byte	0x5
+	.byte	0x27
+	.byte	0xa
+	.long	0xd7
+	.long	0x4f9
+	.uleb128 0x2
+	.long	0x433
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1047
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x5
+	.long	0x7c
+	.long	0x50f
+	.uleb128 0x2
+	.long	0x433
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1048
+	.byte	0x23
+	.long	0x529
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0x529
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x8
+	.long	0x52e
+	.uleb128 0x1e
+	.uleb128 0x9
+	.long	.LASF1049
+	.byte	0x7
+	.byte	0x8e
+	.byte	0x7
+	.long	0x9b
+	.long	0x545
+	.uleb128 0x2
+	.long	0x497
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1050
+	.byte	0x1f
+	.long	0x55a
+	.uleb128 0x2
+	.long	0x433
+	.uleb128 0x2
+	.long	0xd7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1051
+	.byte	0x78
+	.long	0x411
+	.long	0x595
+	.uleb128 0x7
+	.string	"src"
+	.byte	0x78
+	.byte	0x2a
+	.long	0x433
+	.uleb128 0xb
+	.long	.LASF1052
+	.byte	0x7a
+	.byte	0x17
+	.long	0x497
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x7f
+	.byte	0xb
+	.long	0x9b
+	.uleb128 0xb
+	.long	.LASF1053
+	.byte	0x86
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1054
+	.byte	0x6e
+	.long	0x411
+	.long	0x5c5
+	.uleb128 0x7
+	.string	"dst"
+	.byte	0x6e
+	.byte	0x2b
+	.long	0x433
+	.uleb128 0x7
+	.string	"src"
+	.byte	0x6e
+	.byte	0x38
+	.long	0x433
+	.uleb128 0xb
+	.long	.LASF1052
+	.byte	0x70
+	.byte	0x17
+	.long	0x497
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1055
+	.byte	0x63
+	.long	0x411
+	.long	0x5f5
+	.uleb128 0x7
+	.string	"dst"
+	.byte	0x63
+	.byte	0x27
+	.long	0x433
+	.uleb128 0x7
+	.string	"src"
+	.byte	0x63
+	.byte	0x34
+	.long	0x433
+	.uleb128 0xb
+	.long	.LASF1052
+	.byte	0x65
+	.byte	0x17
+	.long	0x497
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1056
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xd
+	.long	0x62e
+	.uleb128 0x7
+	.string	"dst"
+	.byte	0x4a
+	.byte	0x2a
+	.long	0x433
+	.uleb128 0x16
+	.long	.LASF1052
+	.byte	0x4a
+	.byte	0x41
+	.long	0x497
+	.uleb128 0xe
+	.string	"min"
+	.byte	0x4c
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0xe
+	.string	"max"
+	.byte	0x4d
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1060
+	.byte	0xa
+	.byte	0x3c
+	.byte	0xc
+	.long	0x7c
+	.long	0x64a
+	.uleb128 0x16
+	.long	.LASF1052
+	.byte	0x3c
+	.byte	0x2f
+	.long	0x497
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1057
+	.byte	0xa
+	.byte	0x2c
+	.byte	0x1a
+	.long	0x497
+	.uleb128 0x7
+	.string	"src"
+	.byte	0x2c
+	.byte	0x31
+	.long	0x433
+	.uleb128 0xe
+	.string	"id"
+	.byte	0x31
+	.byte	0x14
+	.long	0xe3
+	.uleb128 0x22
+	.uleb128 0xb
+	.long	.LASF1025
+	.byte	0x33
+	.byte	0x15
+	.long	0x100
+	.uleb128 0xb
+	.long	.LASF1019
+	.byte	0x34
+	.byte	0x13
+	.long	0x83
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 33 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.byte	0x4
+	.file 36 "./src/main/msp/msp_settings.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF949
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.79.c3a4237a3ea21f9a324a771e53fbcf5b,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1061
+	.long	.LASF1062
+	.long	.LASF1063
+	.long	.LASF1064
+	.long	.LASF1065
+	.long	.LASF1066
+	.long	.LASF1067
+	.long	.LASF1068
+	.long	.LASF1069
+	.long	.LASF1070
+	.long	.LASF1071
+	.long	.LASF1072
+	.long	.LASF1073
+	.long	.LASF1074
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x25
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1075
+	.byte	0xa
+	.long	.LASF1076
+	.byte	0xa
+	.long	.LASF1077
+	.byte	0xa
+	.long	.LASF1078
+	.byte	0xe
+	.long	.LASF1079
+	.byte	0x2
+	.long	.LASF1080
+	.byte	0x3
+	.long	.LASF1081
+	.byte	0x4
+	.long	.LASF1082
+	.byte	0x5
+	.long	.LASF1083
+	.byte	0xd
+	.long	.LASF1084
+	.byte	0x5
+	.long	.LASF1085
+	.byte	0x6
+	.long	.LASF1086
+	.byte	0xd
+	.long	.LASF1087
+	.byte	0xe
+	.long	.LASF1088
+	.byte	0xe
+	.long	.LASF1088
+	.byte	0xd
+	.long	.LASF1089
+	.byte	0xa
+	.long	.LASF1090
+	.byte	0xd
+	.long	.LASF1091
+	.byte	0xd
+	.long	.LASF1092
+	.byte	0xa
+	.long	.LASF1093
+	.byte	0xa
+	.long	.LASF1094
+	.byte	0xc
+	.long	.LASF1095
+	.byte	0xa
+	.long	.LASF1096
+	.byte	0xb
+	.long	.LASF1097
+	.byte	0xb
+	.long	.LASF1098
+	.byte	0xa
+	.long	.LASF1099
+	.byte	0xa
+	.long	.LASF1100
+	.byte	0xa
+	.long	.LASF1101
+	.byte	0x9
+	.long	.LASF1102
+	.byte	0x9
+	.long	.LASF1103
+	.byte	0xd
+	.long	.LASF1104
+	.byte	0x8
+	.long	.LASF1105
+	.byte	0x7
+	.long	.LASF1106
+	.byte	0x7
+	.long	.LASF1107
+	.byte	0x2
+	.long	.LASF1108
+	.byte	0x1
+	.long	.LASF1109
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF994:
+	.string	"TABLE_FAILSAFE"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF963:
+	.string	"int8_t"
+.LASF263:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF36:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF65:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF340:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF120:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF968:
+	.string	"size_t"
+.LASF74:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1035:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF24:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF257:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF793:
+	.string	"ACC "
+.LASF346:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF31:
+	.string	"__LP64__ 1"
+.LASF1060:
+	.string	"settingValueSize"
+.LASF189:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF911:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF314:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF917:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF250:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF492:
+	.string	"__flexarr []"
+.LASF275:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF1036:
+	.string	"MSP_RESULT_CMD_UNKNOWN"
+.LASF987:
+	.string	"TABLE_MAG_HARDWARE"
+.LASF1000:
+	.string	"values"
+.LASF311:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF148:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1049:
+	.string	"settingGetValuePointer"
+.LASF44:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF317:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1005:
+	.string	"VAR_UINT16"
+.LASF175:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF964:
+	.string	"int16_t"
+.LASF980:
+	.string	"TABLE_CURRENT_METER"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF234:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF50:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF135:
+	.string	"__UINT8_C(c) c"
+.LASF60:
+	.string	"__INT16_TYPE__ short int"
+.LASF380:
+	.string	"linux 1"
+.LASF398:
+	.string	"true 1"
+.LASF1033:
+	.string	"MSP_RESULT_ACK"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1010:
+	.string	"MODE_DIRECT"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF358:
+	.string	"__x86_64 1"
+.LASF1027:
+	.string	"config"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF479:
+	.string	"__P(args) args"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF237:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF233:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF117:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF171:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF230:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF195:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF1026:
+	.string	"type"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF225:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF247:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF48:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1013:
+	.string	"cliMinMaxConfig_s"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1030:
+	.string	"lookupTables"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF938:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF185:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF43:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF325:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF201:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF274:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF246:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1051:
+	.string	"mspSetSettingCommand"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF41:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF313:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF386:
+	.string	"DEBUG 1"
+.LASF978:
+	.string	"TABLE_BLACKBOX_DEVICE"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF297:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF348:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF54:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF224:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"sbufReadData"
+.LASF203:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF982:
+	.string	"TABLE_GIMBAL_MODE"
+.LASF150:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF289:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF516:
+	.string	"__always_inline"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF71:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF362:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF973:
+	.string	"TABLE_OFF_ON"
+.LASF1016:
+	.string	"tableIndex"
+.LASF961:
+	.string	"long int"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF903:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF282:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF290:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF323:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF913:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF262:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF82:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF381:
+	.string	"__unix 1"
+.LASF67:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF47:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF336:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF304:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF945:
+	.string	"VALUE_MODE_OFFSET 4"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF232:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF81:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1014:
+	.string	"cliMinMaxConfig_t"
+.LASF49:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF279:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF933:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF907:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF153:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF194:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF167:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF33:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF976:
+	.string	"TABLE_GPS_PROVIDER"
+.LASF37:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF130:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF200:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF916:
+	.string	"Q12 (1 << 12)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF394:
+	.string	"_STDC_PREDEF_H 1"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF941:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF255:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF319:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1044:
+	.string	"strnlen"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF166:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF252:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF169:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF932:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF954:
+	.string	"signed char"
+.LASF965:
+	.string	"uint8_t"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF239:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF331:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF931:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF177:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1018:
+	.string	"cliArrayLengthConfig_s"
+.LASF1020:
+	.string	"cliArrayLengthConfig_t"
+.LASF136:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF242:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF287:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF249:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF821:
+	.string	"USE_PPM"
+.LASF145:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF950:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF238:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF168:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF385:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF324:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF157:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF294:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1007:
+	.string	"MASTER_VALUE"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF104:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF119:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF139:
+	.string	"__UINT32_C(c) c ## U"
+.LASF373:
+	.string	"__SSE2_MATH__ 1"
+.LASF107:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF199:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF35:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF227:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF820:
+	.string	"USE_VCP"
+.LASF132:
+	.string	"__INT64_C(c) c ## L"
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF1052:
+	.string	"value"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF109:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF962:
+	.string	"char"
+.LASF229:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF78:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF32:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF243:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF359:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF959:
+	.string	"__uint16_t"
+.LASF1022:
+	.string	"minmax"
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF118:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF173:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF295:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF375:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF85:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF125:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF264:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF395:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF341:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF928:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1009:
+	.string	"PROFILE_RATE_VALUE"
+.LASF218:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF75:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF929:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1048:
+	.string	"sbufWriteData"
+.LASF1037:
+	.string	"mspResult_e"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF133:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF62:
+	.string	"__INT64_TYPE__ long int"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF720:
+	.string	"__need_size_t"
+.LASF345:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF384:
+	.string	"__ELF__ 1"
+.LASF92:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF108:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1023:
+	.string	"array"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1011:
+	.string	"MODE_LOOKUP"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF312:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF281:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF397:
+	.string	"bool _Bool"
+.LASF105:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF956:
+	.string	"__uint8_t"
+.LASF112:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF134:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF26:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF985:
+	.string	"TABLE_ACC_HARDWARE"
+.LASF305:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF351:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF186:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF981:
+	.string	"TABLE_VOLTAGE_METER"
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF127:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF161:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF321:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF955:
+	.string	"__int8_t"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF991:
+	.string	"TABLE_RC_INTERPOLATION"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF795:
+	.string	"GYRO "
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF377:
+	.string	"__gnu_linux__ 1"
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF1004:
+	.string	"VAR_INT8"
+.LASF70:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF122:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF993:
+	.string	"TABLE_LOWPASS_TYPE"
+.LASF1001:
+	.string	"valueCount"
+.LASF280:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF374:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1053:
+	.string	"newValue"
+.LASF114:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1055:
+	.string	"mspSettingCommand"
+.LASF350:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF158:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF64:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF206:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF310:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1003:
+	.string	"VAR_UINT8"
+.LASF160:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF97:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1059:
+	.string	"SystemCoreClock"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF984:
+	.string	"TABLE_GYRO_HARDWARE"
+.LASF28:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF366:
+	.string	"__k8__ 1"
+.LASF30:
+	.string	"_LP64 1"
+.LASF143:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF266:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF1012:
+	.string	"MODE_ARRAY"
+.LASF228:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF905:
+	.string	"VERY_FAST_MATH "
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF327:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF949:
+	.string	"MSP_SETTING_ID_BY_NAME 0xFFFF"
+.LASF183:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF288:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF926:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF935:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF106:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF253:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF27:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF387:
+	.string	"FLASH_SIZE 2048"
+.LASF215:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF369:
+	.string	"__SSE__ 1"
+.LASF110:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF202:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF335:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF272:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF128:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF822:
+	.string	"USE_PWM"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF343:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF960:
+	.string	"__uint32_t"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF162:
+	.string	"__FLT_RADIX__ 2"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF1021:
+	.string	"lookup"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF57:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF207:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF357:
+	.string	"__amd64__ 1"
+.LASF101:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF904:
+	.string	"FAST_MATH "
+.LASF144:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF937:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF344:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF248:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF939:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF969:
+	.string	"double"
+.LASF146:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1045:
+	.string	"sbufPtr"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF55:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF934:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF103:
+	.string	"__WINT_WIDTH__ 32"
+.LASF40:
+	.string	"__CHAR_BIT__ 8"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF353:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF142:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF469:
+	.string	"__PMT"
+.LASF391:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF216:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF152:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF912:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF988:
+	.string	"TABLE_DEBUG"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF997:
+	.string	"lookupTableIndex_e"
+.LASF45:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF129:
+	.string	"__INT32_C(c) c"
+.LASF284:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF393:
+	.string	"__REVISION__ \"9e0e790\""
+.LASF52:
+	.string	"__WCHAR_TYPE__ int"
+.LASF84:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF330:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF908:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF53:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF303:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF365:
+	.string	"__k8 1"
+.LASF1015:
+	.string	"cliLookupTableConfig_s"
+.LASF1017:
+	.string	"cliLookupTableConfig_t"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF974:
+	.string	"TABLE_UNIT"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF25:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF73:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF952:
+	.string	"unsigned int"
+.LASF77:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF922:
+	.string	"UNIT_TESTED "
+.LASF1042:
+	.string	"settingFind"
+.LASF268:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF165:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF258:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF940:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF283:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF164:
+	.string	"__FLT_DIG__ 6"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF170:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF86:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF270:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF100:
+	.string	"__LONG_WIDTH__ 64"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF265:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF277:
+	.string	"__FLT32X_DIG__ 15"
+.LASF96:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF972:
+	.string	"pgn_t"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF355:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF46:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF63:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF515:
+	.string	"__wur "
+.LASF58:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF34:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF996:
+	.string	"LOOKUP_TABLE_COUNT"
+.LASF98:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF322:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF256:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1028:
+	.string	"offset"
+.LASF367:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF278:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF184:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF992:
+	.string	"TABLE_RC_INTERPOLATION_CHANNELS"
+.LASF902:
+	.string	"sq(x) ((x)*(x))"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF116:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF59:
+	.string	"__INT8_TYPE__ signed char"
+.LASF141:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF231:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF797:
+	.string	"MAG "
+.LASF174:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF308:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF777:
+	.string	"USE_NAV "
+.LASF552:
+	.string	"__stub_revoke "
+.LASF999:
+	.string	"lookupTableEntry_s"
+.LASF1002:
+	.string	"lookupTableEntry_t"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF749:
+	.string	"LED_STRIP "
+.LASF811:
+	.string	"USE_UART7 "
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF370:
+	.string	"__SSE2__ 1"
+.LASF948:
+	.string	"VALUE_MODE_MASK (0x30)"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF90:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF936:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF212:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF990:
+	.string	"TABLE_MOTOR_PWM_PROTOCOL"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF306:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF261:
+	.string	"__FLT128_DIG__ 33"
+.LASF123:
+	.string	"__INT8_C(c) c"
+.LASF925:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF235:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF151:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF181:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF748:
+	.string	"BLACKBOX "
+.LASF61:
+	.string	"__INT32_TYPE__ int"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF315:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF339:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF220:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF915:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF208:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF349:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF285:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1034:
+	.string	"MSP_RESULT_ERROR"
+.LASF946:
+	.string	"VALUE_TYPE_MASK (0x03)"
+.LASF273:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF259:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF42:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF846:
+	.string	"USE_I2C"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF292:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF799:
+	.string	"BARO "
+.LASF390:
+	.string	"SITL 1"
+.LASF87:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF211:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF93:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1019:
+	.string	"length"
+.LASF966:
+	.string	"uint16_t"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF299:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF83:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF953:
+	.string	"long unsigned int"
+.LASF223:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF943:
+	.string	"VALUE_TYPE_OFFSET 0"
+.LASF72:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF56:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF307:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF1008:
+	.string	"PROFILE_VALUE"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF154:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF29:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF847:
+	.string	"USE_SPI"
+.LASF371:
+	.string	"__FXSR__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF756:
+	.string	"CMS "
+.LASF352:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF927:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF51:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF1058:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Os -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1050:
+	.string	"sbufWriteU16"
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1031:
+	.string	"valueTableEntryCount"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF1041:
+	.string	"sbufReadU8"
+.LASF368:
+	.string	"__MMX__ 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF957:
+	.string	"__int16_t"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF737:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF178:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF944:
+	.string	"VALUE_SECTION_OFFSET 2"
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF188:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF301:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF91:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF69:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1043:
+	.string	"sbufAdvance"
+.LASF302:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF998:
+	.string	"sbuf_s"
+.LASF971:
+	.string	"sbuf_t"
+.LASF198:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF209:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF210:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF342:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF286:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF738:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF193:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF776:
+	.string	"GPS "
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1032:
+	.string	"valueTable"
+.LASF271:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1024:
+	.string	"cliValueConfig_t"
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF329:
+	.string	"__REGISTER_PREFIX__ "
+.LASF328:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF180:
+	.string	"__DBL_DIG__ 15"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1025:
+	.string	"name"
+.LASF39:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF254:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF930:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF376:
+	.string	"__SEG_GS 1"
+.LASF121:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF363:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1046:
+	.string	"sbufReadU16"
+.LASF79:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF360:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF372:
+	.string	"__SSE_MATH__ 1"
+.LASF958:
+	.string	"short int"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF95:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF137:
+	.string	"__UINT16_C(c) c"
+.LASF221:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF222:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF392:
+	.string	"__TARGET__ \"SITL\""
+.LASF296:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF914:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF236:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF192:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF111:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF244:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF80:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF76:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF923:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF947:
+	.string	"VALUE_SECTION_MASK (0x0c)"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF318:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF1054:
+	.string	"mspSettingInfoCommand"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF924:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF187:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF115:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF99:
+	.string	"__INT_WIDTH__ 32"
+.LASF389:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF260:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF113:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF723:
+	.string	"__need_NULL"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF204:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF918:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF921:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF734:
+	.string	"USE_CLI "
+.LASF399:
+	.string	"false 0"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF354:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1006:
+	.string	"VAR_INT16"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF240:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF309:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF66:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF131:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF300:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF38:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF979:
+	.string	"TABLE_BLACKBOX_PROFILE"
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1047:
+	.string	"sbufBytesRemaining"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF909:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF267:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF251:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF217:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF1029:
+	.string	"clivalue_t"
+.LASF951:
+	.string	"short unsigned int"
+.LASF219:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1057:
+	.string	"mspReadSetting"
+.LASF89:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF942:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF347:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1039:
+	.string	"sbufWriteString"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF213:
+	.string	"__FLT16_DIG__ 3"
+.LASF156:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF364:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF977:
+	.string	"TABLE_GPS_SBAS_MODE"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF356:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF382:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF975:
+	.string	"TABLE_ALIGNMENT"
+.LASF196:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF94:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF245:
+	.string	"__FLT64_DIG__ 15"
+.LASF320:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF172:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF124:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF906:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF68:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF970:
+	.string	"float"
+.LASF241:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1040:
+	.string	"sbufWriteU8"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF379:
+	.string	"__linux__ 1"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF197:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF989:
+	.string	"TABLE_SUPEREXPO_YAW"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF967:
+	.string	"uint32_t"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF986:
+	.string	"TABLE_BARO_HARDWARE"
+.LASF361:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF138:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF23:
+	.string	"__FAST_MATH__ 1"
+.LASF383:
+	.string	"unix 1"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF910:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF920:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF276:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF102:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF126:
+	.string	"__INT16_C(c) c"
+.LASF293:
+	.string	"__FLT64X_DIG__ 18"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF316:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF388:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF155:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF919:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF378:
+	.string	"__linux 1"
+.LASF182:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF147:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF190:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF298:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF983:
+	.string	"TABLE_GYRO_LPF"
+.LASF1056:
+	.string	"serializeSettingInfo"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF179:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF149:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF995:
+	.string	"TABLE_CRASH_RECOVERY"
+.LASF88:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF140:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1079:
+	.string	"streambuf.h"
+.LASF1095:
+	.string	"long-double.h"
+.LASF1102:
+	.string	"__locale_t.h"
+.LASF1104:
+	.string	"platform.h"
+.LASF1084:
+	.string	"msp_settings.c"
+.LASF1085:
+	.string	"target.h"
+.LASF1089:
+	.string	"libc-header-start.h"
+.LASF1072:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1062:
+	.string	"src/main/common"
+.LASF1076:
+	.string	"stdint-intn.h"
+.LASF1105:
+	.string	"common_fc_pre.h"
+.LASF1071:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1074:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1096:
+	.string	"stubs.h"
+.LASF1066:
+	.string	"src/main/target/SITL"
+.LASF1093:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1065:
+	.string	"src/main/msp"
+.LASF1103:
+	.string	"strings.h"
+.LASF1091:
+	.string	"features-time64.h"
+.LASF1075:
+	.string	"types.h"
+.LASF1070:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1087:
+	.string	"stdbool.h"
+.LASF1073:
+	.string	"/usr/include"
+.LASF1061:
+	.string	"src/main/build"
+.LASF1106:
+	.string	"common_fc_post.h"
+.LASF1090:
+	.string	"features.h"
+.LASF1098:
+	.string	"typesizes.h"
+.LASF1101:
+	.string	"locale_t.h"
+.LASF1063:
+	.string	"src/main/config"
+.LASF1099:
+	.string	"time64.h"
+.LASF1077:
+	.string	"stdint-uintn.h"
+.LASF1067:
+	.string	"src/main/target"
+.LASF1107:
+	.string	"maths.h"
+.LASF1068:
+	.string	"src/main"
+.LASF0:
+	.string	"./src/main/msp/msp_settings.c"
+.LASF1109:
+	.string	"msp_settings.h"
+.LASF1100:
+	.string	"wchar.h"
+.LASF1064:
+	.string	"src/main/fc"
+.LASF1081:
+	.string	"settings.h"
+.LASF1069:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1082:
+	.string	"msp.h"
+.LASF1083:
+	.string	"string.h"
+.LASF1094:
+	.string	"cdefs.h"
+.LASF1088:
+	.string	"stdint.h"
+.LASF1108:
+	.string	"build_config.h"
+.LASF1078:
+	.string	"stddef.h"
+.LASF1097:
+	.string	"stubs-64.h"
+.LASF1092:
+	.string	"wordsize.h"
+.LASF1080:
+	.string	"parameter_group.h"
+.LASF1086:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375 \225m\003"
+	.string	"D\005\211"
+	.string	"\b"
+	.string	"\246\315\256\256\013\004\002"
+	.string	"\002\001\002\002\002\001\001\336\230\236\333\002\020"
+	.string	"\002\003\002\004\002\005\002\001\005\320\355\231\250\b"
+	.string	"\006\352\344\260\272\r\002\007\215\207\273\234\004"
+	.string	"\b\326\240\351\324\007"
+	.string	"\t\367\316\334\302\007\022"
+	.string	"\006\002\006\002\007\002\007\n\240\342\234\212\n"
+	.string	"\t"
+	.string	"V "
+	.string	"\346VB\261=\303Rjjw`\323\2022I\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"U\004"
+	.string	"\002\305\f\022\300\025\322\001\300\360\377\377\177f\026\221\2445\262eJ\001NI\371\347yh\202\327\021SR^\001)\367\f\030\036\312Z8\365\004\375!M?5i\205\017\002( \260\002\241Iz\030\304\026\301"
+	.ascii	"\030N\374p\334gX\241Ab\027\346\212M;\345f\300B\006A\355b\006"
+	.ascii	"\030\3347\260\202R\314\315X!\357Rb\0161\261I\200\222/h\t\352"
+	.ascii	"a\213\327\330\267|\2413\206\251\231\274\002|P\212\201\247\200"
+	.ascii	"\231\346h]\361\206"
+	.text
+	.section	.gnu.lto_.inline.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\332\002%\016"
+	.string	"\266\325J>@k\224\016\303\274m\221\221@\225\200\267\272l6\375\216\354\013+\004^\353a@E\244\267\335\277\3501#`\361#Z\232\377\255\035\347\376V\245\027F\327\335|9f1\330,\331\334vK\231R9"
+	.string	"6"
+	.string	"7"
+	.ascii	"\273\033\fk\352\2307%\225J\241\256\201\226\344\205$\001\3501"
+	.ascii	"\250\232\376\032h\245\207?\372!\334J\020W\034\203\266\222\273"
+	.ascii	"\246\3311h\345\207#>&\033x@ \272\354\312"
+	.string	"Z!\031W\376\223\374+\037\335\257\374\214~\330\025`\341?\315\3714\347\323\320\320\210\002\351\216\231#\247\005J\003@Dg\346\224\264\273\2253sZ\356tr\271\273\013\355\220\r9\241C\004\t\230#\367\366\271\275}\322\366\245\271\346:\317\357\373\215\216\226g\311\335\r\240\316\2309\343F\232\030\230\036\334\025\212\263\242\273\353\211\366%I\273\036\311e\373\001\336@\033\223!\221H\301F\200\203\342\340\316\326\353t'\003\023\307\264:\320\260 D\354\320\003\030.p(\\\375\222\033J]\002\211\264\317\241\031:\013\247\tC\377\033\310\033(\342m\240s\232\3663\001@\250a5bLFD\302\204)i2\034\200\242RU\355\022`3-O\362\234QJMP\263\374\273m,\022\341\230\336\370\326\332y\351ZF`\371\351F<\225v\234@\013\021M\243\026\200\231\323,\270\206.\250G\t\300K\337\225Z[\210\024\326!("
+	.string	"\026L\243\341\243\225\261\225\207V\341\005C\313Ql\314nj@\303\\H\214\254g\343X\037\303\212\222\335\200y"
+	.ascii	")\034W\344\202\315\034_\246\rt\t2\220\313\366\271b\202\257\372"
+	.ascii	"\330\244\344'\177\r}-\255\271&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\226\002]\006"
+	.string	"r\310\026\035\240%I\007\377\243\343\025\b"
+	.string	"`P\3708\377\377\377bU\037\204\263\226\020\322\366\226I\006\374\233"
+	.string	"\203\270GMI?P\227;L7\255\340K\246\376\240m\027\341\356\256\234s\316\f\030t\325t\350\017\244\373\255\312\351n\222\023\227\264V\301\253\230\244U]3-\203\357\227\364$\244B/ \200\"9vvpb\030\r1\031$H\033\236Y\004\024Qr\200\310\201z\006\310\025L\266\316\f\337\2430\202\201p>ei\321%\013\212\205\020\225\241?N\356\022 !9\276\262\025\316Nr\030\200VZ\0209z\016B\035\315X\207sa\3418\342\034\220\021\257f\337\220\002<T\"#"
+	.ascii	"\020R\320\340\205\001\300{\305s\\xO\343C"
+	.text
+	.section	.gnu.lto_.pureconst.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\205\004\001\231\004\005\030\006\230\004\007\230\004\b\230\004"
+	.ascii	"\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375 \242\r\003"
+	.string	"\002E\017\031\260\247\320\030\3201L\224\327\210\023\215\202\352\0040\020r\333\022#\226l\231\002\017\210\204\341\330%3A\212l,\313\217\265*SP\266m\020\316\210.\006C\264\356\236\311\354\200Zd\340\212\016"
+	.string	"6\243\200\200\001\301,2\334@%\345\360TFr6\201u\001\324H9Qj\221\\\304\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.a95e377bc336fe1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspReadSetting.6.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`D\0025\024"
+	.string	"f&\210J\260\322U:B\222\322\r.\263e\027\315\f1\336\250\272\212\314\272\317\363etv[\225\0314u\250\261\021Sl\332\236\356\260\203\321S\374\260\340v\376\220\377\214\364\037i\257}4\273f\345\207\326\031\2025\303Pa#\204l\271S\ns"
+	.string	"n"
+	.string	"u"
+	.string	";\225U\247\213\266\375\020\027\272\261\214d\247\343\211\301\260\025\365\250u\267\362\356#\343\305\323E\306\213\253\341\262\237\310Q\244;e\376\354\247g\340\3619I\007\034\271\310)q8T\005B'\264\315Q\244+H\325W\342t(\371a\350!g\322\323|\276\024\005\310FS\211\253\321rE\005\235\367>wp8s\222,\265V\317\033\216\347\006p\3337\333\n\354\331\n\267\357\001\f\265\235\371\275\213\033\224\230r\324)\264w\263\2719\373\264\356\217\355\351\322\323\251\363n\324\207~\322\323\224N\2578=\351\364CJ\210p"
+	.ascii	"\177\273\264\253\023\206>\252\222\250\242\303y\267?\342\006$"
+	.ascii	"5\003\305~\317\337\235\350\346<\033Zu\225\346\030\221\020*p\321"
+	.ascii	"\tN\027\003\314\213\214\251\026(s^\304\207$\\@\255?\301\024\265"
+	.ascii	"\006\273\343\317\366\2036\207?\217\0354#\022\265s\027\330\213"
+	.ascii	"\341\227\270\t\033z \273\260\306\337.\372\254\r\t\372\320\346"
+	.ascii	"\320#:\200u\n\347\257\347\307\205\261|\201\231\277\225Kw\246"
+	.ascii	"J\n\006\211;\034\336fDm\253\027\034a\001D\355y'@\233B\203<\220"
+	.ascii	"\231\277\241\026\306\201\302\336h,%\321\315\375/\202z\352n\316"
+	.ascii	"&\377\266z\277\332l\362i\222kC\200\315\007\016b\246\021\030`"
+	.ascii	"\271Z*)*'$\256\027l\355:\201\301\314\304\304b/0\227\032\230\314"
+	.ascii	"j&\206%\263r\275`\253\223\022\323\324\274\274V1\032\232\327\n"
+	.ascii	"\304\266w\365\264\356\317\r&\233\217L\255\251X\356{\247C2\216"
+	.ascii	"|\353\313F\272;\266\351\232\205\2668\247\315\331'3\321\325Z{"
+	.ascii	"\204\243X\220R\243\326\332\312\211#1\240\007\272\350\006--\343"
+	.ascii	"\305\324\222E7\013\250\r( P\2021Cl\035\357e\361\341\207G\013"
+	.ascii	"[\316\342My\211\202\031\377$\206\f\233\232\211\030-\035\330b"
+	.ascii	"J.\2151Pfj\270\225 \271\211\017=4\335q\237\265#\336\362\004G"
+	.ascii	"\030x\231\345q4T1\332\342L\334\023\212\355\304\223\002C\206T"
+	.ascii	"x\271\264\265\343\031F^\271\275\026\303\305V\030\243\310@\241"
+	.text
+	.section	.gnu.lto_settingValueSize.7.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\355\001\375\021"
+	.string	"6avF\320R%\035\217\r\264u\357I\375}\020}T\340\006:\004\200\230(\200\021\323\031\"\034\373\232r\236\200\372\343z\332\232\204o\007jh\271p\255|\021/\"\265\020Y\376%a\356e>\314\202Bo\250\221\266\367\2262\245c"
+	.string	"V"
+	.string	"e"
+	.ascii	"\177q\0306\373\tzG]\203\253\237\031?\346\234\261\223\017\220"
+	.ascii	"\217\360\002\344\343\222\270\3552\302U\233\257s\371\333\241\323"
+	.ascii	"\220\217\bIV\334\020\361\352| l\351H\2075CwA\241\213\305\007"
+	.ascii	"\324y\370\302\004L]S\200\256\007\002PQ\225\342\267kP\307\243"
+	.ascii	"\332r\231sZ\201\272\rw\353\266g\266\035\330\232\022\337\221)"
+	.ascii	"\244\035\375\374\333!`EM\rb{:\272F\366\341\334\"{\325!\252v\251"
+	.ascii	"\232\203\352\026T\313{\177\\\365\252ZU\375\027\213O\001\2539"
+	.ascii	"5|W\023*\3328a\333f\277l\021$\226\253}\244"
+	.string	"\307\260\335\3139\311\234E9\234\346\364T\254\302=\332\343l;8F\276\357\313:\216\224\333Z\031\302\265r[\353R%\016\333\241\006\006\036P7d\377\223\265\023s\246\032\212\224e\2764\301Djv\032\264G\002R\272(\262\317T&z\b\355\032\371\344%\222\333\337\316E%M\365(\020\257\274D~\271\265\376\f\361\350g\273\302e\324\2709{\030\370I67\\\211G?G>\006V\260\362\002#\241eA\013\314\200\354\206\302\213\205h\030X-fF\306\306FV\213@S\233\305fd^f1\230\232Z\ffb\032\215\254&fC\243\325\304^\336<\234[d\004;\342\201\237\bE\023\324\373I\376\366\007VY\033\262\273A\266w\355\262\263<RD\tD\025w4\205&\321L\221\037\240t\024KG\264\240r\021\217#[\233\024( @\002C\306,\0363$|\306\217\366\341\252\245\225\f\305\\ff\003`"
+	.string	"\0023\365\003l[Y\266\307Lkqa\252eZ\335\230\205\340|\031\252\210\035\327o%\0271(\300EA\300\207\275\032\356pc\214\261\231\305\007\016x\032\005\347\r_"
+	.ascii	"\006<3\342\271+\210\006/\352@\266I\272\030\032\201B\001"
+	.text
+	.section	.gnu.lto_serializeSettingInfo.8.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`6\006M#"
+	.string	"\206\276\331H\200XN:\263\0300\006\247\205U\316\177\001%\210\035)\233D\321\271\216;\303wQC\200\240\346\357\257\262\261m \251\207\266\362\030\277\253\246\252k\2328\324\375r\261\370]W3\334zp\252\314UUW\255\304\022B\344N2\301"
+	.string	"\270"
+	.string	"\311"
+	.ascii	"\251\345\264-\243\250\345\363\264\334\247e\333\226\177\244@\353"
+	.ascii	"L\230\240\266{c4\325\\7T\212\217\233\375\314/\371\031\363z5\230"
+	.ascii	"\254VT\364\335\"\222\213,\203\216\245'\271\222\365f\254\246\016"
+	.ascii	"\265T&\022\007\230{o\360(WP\217\026\235=\030Kv\271\002\350\273"
+	.ascii	"E%.\"\250G{\303\245[\346\033\371\221\365J\026\377\335\373\205"
+	.ascii	"%\355\336%\022#\251Gyy\237\364\250z\236\364(\257\314s_&\357\016"
+	.ascii	"y\303\270\344\314\275W\330;\276\036=\333\256|\313\205v\334\032"
+	.ascii	"\036\025\032s\376\354'\220\033m\307-\032\357\"V\352#\246\306"
+	.ascii	"\343f\253E\333\035\203{/\333\343\226\214szf\366\300\314\033\230"
+	.ascii	"\323\024\001\335`<\205"
+	.string	"O\3057Fv\275\322\370QxN\275w\370.F\331\036/V\222\354\336;\340P\370]j\362j\335\345\035p\224\247\177\366\240W\321\326\261\322\207\3227O\2635\332\300\262Mf\036q'Q\352\275\305\003\374&\027H\250\367\336\217\035\345\257H\217\276}\302\224D\333\344\23620tb\336<\253\2457\263\314\"o\301\002^D\233\206{\312\226tb\256M\303\274\034\332\006c~7\233M:\356/\346\324\262Qj\231\350\312_(\b\b\364\345\377\223Z\356i\313<7;\357\234y\376\331X\366\245\226uR\3139m\031'\265\334S-\363R\3137\252e\233\235eugy\0277-\324\314\353\221\025\211\375\221\213Z\364\220m\372\246\257\266M#\031\353~g\266t\327j?\213\r\353qM\352\275Y?\362\277\034\256\201\203\246\364\307\246\364\350O\357\272\345\262\204\374\3547\3141?k\323\360N3 >\371\317{\357E\265"
+	.ascii	"%=m\240\276\\V\027\332i\377\301\275D-H2\212w\2010\224\340\355"
+	.ascii	"\\$\234<\201B\372#\205\364(\332\013\302\224\026\356\206\201)"
+	.ascii	"\251\341m\033\b\300m1\202;\233),\213\224[\346\225\263\307\254"
+	.ascii	"\022\3247\353\016\342p\266,XZ\355\r\330g\276\250\201}9c\035\261"
+	.ascii	"\303\255|8\202c\020\257\342D\224|\372\032\324\321\237\244\355"
+	.ascii	"\243\270\036s\312\033\332\3234\267\241]s15\261\265SQR\255\302"
+	.ascii	"I\252\241N\224pB\2012\223\222\323S\b\004\006\020$\001\257\254"
+	.ascii	"D4?%Y\215\230\212\272\272\202\262\002a\302JJ8\025\345$%|\252"
+	.ascii	"\262\022&\0211\225\t\250*\341\025\025U\225\220\307\314\274\274"
+	.ascii	"?o\177\261\201\265\023\250wH1#Z\007u\2015{&\337\351\027g\360"
+	.ascii	";d\230\021\255\201\235\"\271\214h6\370_\277\340\031n\304\306"
+	.ascii	"b\0016\370\235\226\222\365\345X\221<\260\323\255;|\r NI\2543"
+	.ascii	"z\231\357\264\221\032\"\333\315_\023\245hz\316\344:\335\023\264"
+	.ascii	"?\315\274\362X{\330\037u\372\203W\261\207\234\236\021`s~\254"
+	.ascii	"e8\235\023\006\247\207\342\224fz\274\356]\356sk\220\363c\274"
+	.ascii	"\016Y\211\254D\322\243\274\266\261\221\222\t`\003}\250a4\347"
+	.ascii	"\030r\204FDD\222\2024\303\001\240\002\021\032\272n\021@\275\243"
+	.ascii	"\244fAJ\222\306o\331\363\367_/\331?}R\263w\013\356S\205%E\343"
+	.ascii	"\274\316\313b<\246V~\251\207\036\373\307PV\316J\243/A2>\210\307"
+	.ascii	" \033\257\340%\303\225x\260MO.\013\350\240\200\233;\372=P\203"
+	.ascii	"\306D\337\341\023\373\245\222\241\363\227o\233o\222\227\244e"
+	.ascii	"t\033B\202\311\017\263\254\200[>\3626\2505\266\034\267\005\r"
+	.ascii	"\n\243Qkhjm)\307\325\177l'3I&\370\025v\213\320\342\002\345\271"
+	.ascii	"t\317\276\323\261\356\273\323a\370\207N\017\343|%\020\003\275"
+	.ascii	"\264D\254(W\376nS\357!\177^\312)\007%Hy\202\n\230\242D\343|\254"
+	.ascii	"\177q\221\367_:\325\332oa\265:\224-\370S\227[_\211\016\260\221"
+	.ascii	"\344\332$\232\356\256g\024\207\354\275\220 \262\325\374\004\335"
+	.ascii	"\337@\004\354R\263m\327\230?"
+	.text
+	.section	.gnu.lto_mspSettingCommand.9.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\347\001\315\021"
+	.string	"F\343yG\320\322(\035c\002\365\026\013\3103\343R\376\034,\320\327!]t\254O%[8\212:K\253\324\303;\211\377\367-\271\314\326-~\344S#\227\346\277\256\206\265\030\324\351G\303\360e\236\254\bV\373\352G\215\354\275\245L)e"
+	.string	"a"
+	.string	"b"
+	.string	"\246\033(\252\366w\036#\346\337\207\223\314\211C\243\306\234\237\211MH\217\376H\266}\235\303\210\261\f~)l\335\315\017M.\310\2343\205\272"
+	.string	"\371\b_\"\037\027\305e\207\2532\177v\330\300F\207g#\361\205\tJ\370\340"
+	.ascii	"`\223\201%C97\317]kl3\252\235\312\234\323\352\331F\334\361\266"
+	.ascii	"\037\330\246`\253\203z\357\264\262\333\314\316\374\334K=&xL-"
+	.ascii	"\262\277\231\356\t\373p.\216\375\357\0379\356>\235\347/Y\335"
+	.ascii	"uj)\325Q\252aT/T+T\237\244s!d`"
+	.string	"h\316\020GC\346\216hc\305q\277\035\343\347l2\021\241\3308\230\317\232\b\221\232\036@@\346\374\020<:\002\311\224\203\307\007\004\322c\213\352Z\004P\270#k\253Vz\317(\020;\363.\334\323\030\321v\327\204\306\210\246G&\271\203\344W\367\265 \377\247E\232\263v\317\367\371\f\026\274\212G\263\264\344\275G\277%\037O\373\335\037\265\034\031=\262\366\260P!\034\020\321\302\310\323\256\310 \232Q!\326\036\233\323\036w\024M\213\\\322\322\332-\256\254\016\033T\036\342\352\005[/P\240Z\255\2440H9!\020\203iX\257N`,.\255X\214\005\313\360\002kI\271\264T-\251\325\013\226:9`\327\013\353\225\212\271\\\257\224\311\266\277\371\305\361\213\316\316\3762\371\334En/\214Tv\231\354\266f\255B[\031\330\345\024\320\270R\302\004\323\255\2663\017\250`A\357\311\345p+\321\323\332\0270\350\275\030\037"
+	.ascii	"o\312\312\216\275\245\302\241ca\006\255X~\303E\020\r\207\207"
+	.ascii	"`\306f\0375\253z\277\360A\223\241\t!D\252\260\241 \212X/\326"
+	.ascii	"\251-\325\212\013cq\262\026\323f\275#\210A! 0\f\fQ\241\346\301"
+	.ascii	"]@\252A\251t\240i\025\024"
+	.text
+	.section	.gnu.lto_mspSettingInfoCommand.10.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`8\001\005\016"
+	.string	"V\032`E\360\222(\035\300\272\233\372\253\240\370\213L\245h\217\361(\016\214\335\207B:\253\211w\006\017v\333\202\027\372#\252\370G\243{Cw\322z!4\227\n\235#\256zq<-n\357u\204\026w\350\266\021B\266\224)\005K"
+	.string	"N"
+	.string	"H"
+	.string	"\266\237\342*N\366\"X\342\323X2\033\\6\273\313y> ;\026\037\222\035S\022\367\0365=\037\365\310@D\017\325\007\342\032\021\204p\201#\300\327\022Cv\234`\335\365\\}\251L\255dw\235\252\317\303\215\335v\003\333\020\354\177\b\331c\376\350\364;\332\215\231\002Av9\004\001\26290\031&\036\376\366\311wy\333P\214\330\341\312WC\207\316J\007\017\037\273\340\201c~\300\331^bl\034p\216m\254\221L\373+\316\342t\020\303\005\354\266l\300\330\005E,\3029f\220\343\231\251\246\366\250B^eO\006E9_4r&|Q\243+Y\246&-jR\371\303\371\232A\263\372\360\036\226\274q\226Qm\225\013yU\246\236KJQ\276\353"
+	.string	"^1h6ol\020\225:\302~\\m\331\007\177\355\341\035\"\025\n \013X\250\324\251\025$"
+	.string	"\205LH\026\220|\b\230:\t\352\320\247\233\220rb2\211\272\b\244\016\205K9\001\241p\241R\307}\fxD\022\2258\323hT\3426\333\006\367\3322\tFF\357z\307\005\346%\275{\331u\245.a\321\226\250\325\350\004\030"
+	.ascii	"o\312\312\216=\251\360x\231r\302\226\300\354\245\33206\210\006"
+	.ascii	"UQ\004\3607\267\324b\213kb\0376t\332\302t\004](\204\006\214\200"
+	.ascii	"q+\324<\270\013H5(\225\0164\255\202\002"
+	.text
+	.section	.gnu.lto_mspSetSettingCommand.11.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\260\t\2052"
+	.string	"\312W4\023D`\236N\00730\003\272#\316Y0\203\207\370\334\315\243.\016\036n\214\244~\371\243Q\031\237o\235\306d\215\r\177\220\207\276i\310\235\242N!\276C\240\310b\3366\364J`(\212\206\202\232\320&{\357\224R\n(\001\005\001#\001,\302\304\334\321\300\266\032\334#\305\\\307j\372~\211\001\277\304D\333\334;W\305\266*\224!\325t\214\307r\211\261v\313\031m\356\275\004Z\345\tl\020*\345\316\334N\372\211\213\236k\321@\367\266q\251r\357\034\024C\261\255\362\034\313\314\334r\315\304\005\267\351\034S\371c\253\003\006\245\316\275\027\231\324\307\265\325\264\215k\253\357\243\333\036:\n\031\203\200\212?D\237\2410\bd\177\253\232\276\267\334A%W\017)\035\205\202"
+	.ascii	"qc\320\017\240\267b\212\024\2232\244\371\304\230i\221\215\021"
+	.ascii	"+Be\f\377I\235\320\364n4\237\230[z\f\303\226\246\211\210\245"
+	.ascii	"9\361\315\2079<\213\023\376\246\234\raY\346f\255\006Z\007w\230"
+	.ascii	"\225\255\305{o"
+	.string	"\257\211\235\245@V\r\213[\253A\326\277t\301\335\245\322|b:\322\037\221h\034\230\257\335%\244\325\013if\222\312\261NS\244\2664;D\345W\232\324e\017L\250\364\362O\237\310\242x!*a\244F3H\330\332\331\036\246\364r\377M\335{\331\223\312\032\315D\315\334a\314\314\201\231m\022\327+\001\367\263eR\305\002i\365\377\347\214\223.\217\262?m,}\327\0355l\360N.}\225;\243\r\304\f\223\275\365\227\375=\372t0\325\241\323\016\026\262\246Z\372K\377\376^k\352\005\271\3223w\360\340\235\364o\271\237+,\357d\277\206\3660uw\320g\261*=\210\346\031/\277\303\356\244\243\364m\327I]\216\207\207\216\364\314\"Fx'\225\276U\363z.ng\007\235r\370\256\343a\236\343\362_2\367G\243\321(\177\033\263\352,\245:G\251\316PONML]\327\274\324v\315J=\327\215\304\316"
+	.ascii	"\232\256\331Hu.\3729\023\245\316C\251\363\221u\026J\235\215\254"
+	.ascii	"sP\352\f\244:\027\201\316?\2523\221u\366\3719\017\177\316\302"
+	.ascii	"\3259\250:\003Ug6u\376\251\316\253\352\374\251\263\247\316m@"
+	.ascii	"X\026\006\211\312\2754\242y\356\236zeH\323u\327u\333\365373\273"
+	.ascii	"\340n6\224v\2620\b\307.z\303\247\033\003x\320\216\374\374\222"
+	.ascii	"1\364\360y\372\2529C\246\257\262\0236}3\261\240\005\235\336\350"
+	.ascii	"\303\212}\264J5\225&\276\224\031\342\023\214\321Ou\271\021\363"
+	.ascii	"\236|\376i\370>\357d\206\337\002/\257\375\211\305\307\n\223\360"
+	.ascii	"\231\336\361\230\216\264I\274\223\302\337\360\004L\373\263\311"
+	.ascii	"P\256)\370M\300\017\276\223\001>\213%z\355\317$\302\347\021\247"
+	.ascii	"o:\366\235\336\361\004x+\3276\361N\262\277a\370"
+	.string	",\322[:\b\267\307\345z\230\312\246\364\005\367\270\3038\232\027\356/m\006w\325\270pw\351\243\265U2\270{\357\200\326\302\314k\330{\271\032\215\231y\r{\362\306p\203\273jw@\253Q\257\026\303\367\360G\005\321\374yF\326'\307\004\362\226\2612Z\330 \216$\377\375\3227p\340\235\344\244\257\347\342\365\177\337w`{\272\036t\026*\004P\216\320X$DA)\364\225\n\2552A\327G0|\216\031\365p)\371\375\222\223\372h\205\372v6\313\327<S\240\217\326\177\250g\007#\203\341Qf\266\320S\250\330\033X)HX\251P\263\266P<V\n\022V\031V`\231`\371@\001\253+\020\n\020(\210*\272\312\322z\276\212\322\naB\304\326\026\226\226\007\024Z%\220&DX\225@^ei!\243\002\360\t\024XY\310\255\023'\262\220\302\271\333\337\306TH\330\356vmg\003\325\236LQ\333nW"
+	.string	""
+	.ascii	"\236\247\272\036Fz\357\275CE\317\035m\221\2644\224E\377w`{\204"
+	.ascii	"7\240\360\232p9\022=\267\236\026Ikc\b\345n\307\326V;\371\306"
+	.ascii	"\350\211\376\245(\211\232>\354\204~\311\336\214\267\016\r\275"
+	.ascii	"\201g\024\n"
+	.string	"\031\0315\343\361\237HSO\350\2179\332Nk\326y\314:mZS\201\322i\247\320w\036]\024#A\202\214\377\242\371%\350\215:ZNk\206\204\236u\2346\355\211\tg\211y\357\rz\344\031b\222\016\217a\263\003\016\220Q_\323K\361\201\276[\036\355\206\252\363\370C\267i\331\022,X\323l\332e\312\255\217d\253\334\255\333\332j\361;\317\315I\373\326i\332 }\307l\2074\2326\256\241\3641\200\376|\337\2715\217<o\305_2\2016\372\254f\200\304\250Q(\007\021s\212FDDR\220$\031\016\300\002\021\241\343<\021\360D\311\330m\222L\007o\321\177\343?\304 &>\212r\210\226c\322\2049,R~\004\275Z\223\245\331\224\356S-\300\271\376@\2011\275^/\275\217e\200\261kL.ue\334\035\276u\377Wz\372Dip\250q4\266\211\303\333A\022\367\316\232c\274\026Ypk_\235"
+	.string	"\r_\277G\231\334\274\226r\0165\035\207\224\256\227(w\r\017*\272B\372\234)\022\312\003\352\016\224\213\205K3I\t\364S_\323\273\006\350\016\030\204H=\024\221a&\217\304pon\201zUnZ`\236\033}\373\024A\200\307\002y\034\312\2331\324\225\231W\027X\313\241\330\213r@,O\346B\306\330|\353\230Qx\253Z\376aL&GuK>2\345O%\007\347\221~\303\")2R\313\363b\345\204r\3710\271C;\300\343\007;\364\347q?\326\231\016\033FM\207\027\276\344"
+	.ascii	"\257\343\246\237b^#@\355:\361h\013\371\235\202\344\235\220\334"
+	.ascii	"C\257]\273p\240#\211\2602\033\245\341W\213\312\325\325:\267\204"
+	.ascii	"\177\214\t\346\200\352vv\242\246\357\314\003-\231%\006=\216\006"
+	.ascii	"\232\310\214\203\200`\305\340\266\321\320\304N\241n\217\315\216"
+	.ascii	"\326\300^\214\226[\203)\033\300\356D\002\027X.i\227\006b\222"
+	.ascii	"\345o\r\204\244\r$\\\356\201*\n\226\263\032"
+	.text
+	.section	.gnu.lto_mspReadSetting.part.0.28.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\003\003]\026"
+	.string	"\306i\220I\320TQ:8\003$<\t\206*j\337AS\200\215W\241\376pn\016\264\357x\326"
+	.string	"@h\315\360\004\373\337:\376\006\314\353\243\313 \004\345\027ObQ\312\023\353\346\021"
+	.string	"\277\330"
+	.string	"\030%T\351!4\340W#B\b!R\246\024z"
+	.string	"~"
+	.string	"p"
+	.string	"\001\364+\242go\241\323RN\227S\016\230\325\227o\241s\2259\203\206\374\346,]\036\332\205|h\237\305\354\307\266\257\342+h\336i)\207@\310z\360\300P2g\231z\350\362,\342C\362+\342\303-\361\235\207\340\252\270\343\327\036\016\021\025\t\231\261\023qPu\273\020_\220\305\347\204.ew\003\r$\035!\371\321\265g\207S\025pqT\3159M\216\270\307\333\246\261=\301^U\345\177\026U\002"
+	.ascii	"4\247\317\022\223\311\013q\240x\357\377\375\276\257}\337w#\377"
+	.ascii	"\367#\233<\233\235\212\300\334\367\236_\3437\214\334\260\021"
+	.ascii	"S\335<4\340Q$)\002\371\360\224\244\206/\3433h\247\301\001\234"
+	.ascii	"F\fr\030I\232s: \037\242\300\373\275\231\037\303&\317\376\"\307"
+	.ascii	"([9\177~\336\243\231\036\236~\300\330\207\341\273x\021\355/r"
+	.ascii	"\30094\301\\\317h\205\2229\313\003\017=C>\f=p\252D\356\211\020"
+	.ascii	"\\\334qA\244\016@7]r\013I\334\373\302\025W\221T\024\\]\233f\245"
+	.ascii	"\327\205\213\312m\315\273\340n\020\236&6]rJ\253F\257\333\326"
+	.ascii	"\016E\331t\211M\252\301\245\327\351>\005\017\2675\377\350d\020"
+	.ascii	"\035@\246.\321\025\362\212\007\347\006\331V\237\2546\215j\224"
+	.ascii	"Q}2\252\311Q=\336w\213\244:$\325\340\250\336\377n}-\327\352\005"
+	.ascii	"f\220\325\274Z\033\304\0136\352\005\tV,\013212/-,Xl\315z\211"
+	.ascii	"\325\274ld\262V\214\006'\346J\275lV\256\024\013\026K\275\024"
+	.ascii	"\360\rN\013\226\222\335\334\300R\246\203s\203f>4\001M{\362i\255"
+	.ascii	"\262\355-\\!\307\020\331\223\025M\034\321qQ\266\307\006\215\346"
+	.ascii	"\2220\001\025!H\320\353L\373\200\227\3631@Q\226B\005\275\316"
+	.ascii	"\nx\271\255\201'+\"\361p\377\220R\322oW\310\344\216\213\241("
+	.ascii	": `\002\231Ig\016\357\311\372\311\343n\327Y\225\333|\336}\262"
+	.ascii	"x\024\237k!\030\177\\f\217P\261\036\236\2304\260\220\270\300"
+	.ascii	"n(\217,\024\023b\333J\020\252Q28\257[\220\204\314cum\303\200"
+	.ascii	"\035\220w#\2541`\200\004C!K&\244]\251\230\003\356\312\2265\237"
+	.ascii	"\345FB\241\355\332\036M\220\t\277(\336A\216X+\272\235>\027ct"
+	.ascii	"\353\032\317\006\2077\271\307K\273\205\341\232\373\201\244=4"
+	.ascii	"\033\367\2560\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\264\002\235\f"
+	.string	"F\223F7P\253sDc\032t\315i`jn\n!3\251\023r\360U=\033\274td2$3\3472\252\212fUC\035\232a\350\232M\243\321\3509<\217\267\313/%#\355\224\0026"
+	.string	"7"
+	.string	"7"
+	.ascii	"\r^x,\307\316S8?\271\276\360\264\371zu?C\334{\256\215\323T$3"
+	.ascii	"+h\235"
+	.string	"\364q\034C\262\227L\373}a\005\3633\243\302\006\260\326\332\314\323\213\231}\" \360s+\355\236\350\201\235N\305\355\035\245\235\323L\226v\204\357\034\274'\372\213\301c\005\237!\370m\3405\002\257\205\036\003\372\354\363\226\200\347\264\r-3\310\363\233f\346NKL}\212}q\334\214\226\205\372hR\237\245NH\265Nrz\203\307*\245M'M']\244\267\251E\214t\212I\247\267;B\004D\003\223>\0013\322'7\223\036\274\3605c8t@p\365N\344LZ\365\354b`\213\036P\037\\u\n\330\332\b\003EW[be\261\261\261\270z_\026V}\324>\253\267\252%\022\247\242\206:\275\033\r< \020\003!\343\034\b\343\352-\n\344\0068Z\020\307\355\232V{\340\254\220C\337\320|\324\016\025\016\022e\347x\251\264#\223\227\241q\350\267\340\rm/\370ZX\336\355\310\310\304uc\331\303P\217\340"
+	.string	"\216\340"
+	.string	"\016\340"
+	.string	"\016\340"
+	.string	"\016\340"
+	.ascii	"\034\036@\256\275\264*\205\201\260\310\360+\013\026qZ\004\260"
+	.ascii	"\033\017\001iG\t@\363Y\3532\234\310\260\266\210\303i\0269\001"
+	.text
+	.section	.gnu.lto_.refs.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\026"
+	.string	"\002\003!"
+	.string	""
+	.string	"\004'"
+	.string	"\002\006"
+	.string	"\004\013"
+	.string	"\002\003\016"
+	.string	"\001\007\002\003\007"
+	.string	"\001\t"
+	.string	"\002="
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a95e377bc336fe1,"e",@progbits
+	.string	"(\265/\375`\032\035\035\205"
+	.string	"\332\330\f0Q0\222\312I\007\017\306\213k0\236c\320/\236\360+\306\306\267\251\246R\214\363\311\202w\205H>\261\005\377C\351\366\262\261-\272\273Z\177\327\375\343\270\263\262\357\246\273\275\252\212\252V\334M\367\273\200\324\300\250\307\335]\024\211\252p}\265\325~\262\245L\001\205\002\331\002\b\003h<\246\246\\\254\0268\272\347\034&\303qLs\317{o\001&L\230"
+	.string	"\212K\357xX\364\315\020zg)\346N\023\373\t$`\301mX\216\331\324\224\351\313\002\307\306\r;\271\r\247\341\364^\261!\237U\027\235\032\212\262\032\036\202\235$x\315%`\361z$K\305\200UUG\226\215\276\217\3303\211\036\3471\211\336\333\313\276\247\354\373\351\f\260y\225\304\354i\337\330\311p\\\006\375\004\277\n\206\34356S\253X\3314+r\317{\233C&\202\236\254\211\355@QvK9,\016\216'\233e6nc'\013q\224l\231\376T\244\016\266\264\022\275\240\274\274\274<.\321;{\261g)\366\ff\305\f\005\351\230\342t\327\350\231\313~\202-\354\005\b)\342&\231\31209e5\016\202\275\324\224\313M6-\241"
+	.string	"y\366D7wo\022\f\207a'\253\361\227s\026\326\362N\357m\336{M\230\030\352\231\022\304\223\250\036\372\032\3662,\2471\027v\026\300]\322\364\336\033\004t\007\256\312N\243\237\301\366p/\027\320\343\274<.\240w\030\354_\330\227`\025`\241\036Z\306B=\266\302Mv:\300X\316c\234\236\007\231\336\364\3364\310\306=\201\2645z\020,0"
+	.string	"\344e\361\236=;\320\253yy\354@\357m/\307B=\021,\324\3539\026\352\261\030\211\252\224Z\336\262{\323\021A\251\216)\257F\237\262P\317r"
+	.string	"\275\237w\224\375\214\205\345\347)\347\rW\376\303\360\037\0067S\350\255\237\025@\177 \373YI\025\002h\260\340\357*?g\220\312\320\363w\224\237\267\306~\026B\005\205\033\375\207\361\302\177\003\376>\232\3623\017\263\020\373\231\206\224b\330"
+	.ascii	"?o\3603\007Q\376\233\371\363g(\377\325\376\203\201\363\363\223"
+	.ascii	"\337\305\320\366\177\350*\376\346\341\177\233\377q~v\362\263"
+	.ascii	"\357\367\003\376\363\367\021\b@\200\375|B\223\237}0\371Y\207"
+	.ascii	"%\377\033\370\017\343\347\021\204\376\016\3623\363g#?\017\371"
+	.ascii	"\231\353\347\037?g\375|\343g\252\237w\370\031\207\237\225~&\376"
+	.ascii	"<\3749\306\3174\374,\303\3170\374\214\302\317)\374L\302\317!"
+	.ascii	"\374\334\301\317\032\374\334\342g\021\377\351\374\f\374\371\304"
+	.ascii	"\377.\377\335~f\340\377\001\377\327\374\274\300\317\t\374\214"
+	.ascii	"\300\317$~>\340g\240\237\177\376\213\375\177\340\177\231\377"
+	.ascii	"6///\357G\355\217\002\177\241:\001U\351[\235\271\233eU\242\235"
+	.ascii	"\\\rx\017\370\371r\373\341l\364t\032\354\377\357\347\346i\315"
+	.ascii	"\016X\023`\332\030\234\267\226*\373A\021C\256i\364\315\344}\177"
+	.ascii	"\236+\347\0220\215\036\205\262\375\367\356\305\342I\257\025\023"
+	.ascii	"\360\314\303\\\342\377\341\212\336\373\277z\340u\357\330\231"
+	.ascii	"9\266I\032\322\207\002w\203{\213$\221V\312&\327q\204\262\211"
+	.ascii	"\274\312+nW#\224\351\335\"\3406\275\2562]\036\321\345\261oz\223"
+	.ascii	"\\W7\271<&)\323ku\323\345Q\304M^\211P\246\310\243\262\311u\305"
+	.ascii	"\312\346\362j\304M\336\343M\"\267lry\245\\[^\211"
+	.string	"P6\221W\312$\327\025\337ty\331\314\227\224\353\350t\233\310\237{\257T\312<\002\357EZ\335\343[O]\256\347\324\325\272\354\026%\365\272\367\336{,\223\353Z\376R\246\353\246\004[\322p\272W\356N\2558\362\361\3512\035\371^\247\324\352^\246%\rYK>\363du\177n\022)\305\324\265\004:1-\237.\330\026_)\233]K\025]\234M\346eJ\217\314\274r\\V\266yLo\231\234\237\346\221,\251\376J\362\223\244\t\031S\243H\230\352\355\313]\034k\244\177`g\037i\"E\232\013\3508\342^/)\314{\323#=\244\271\330-+\275X\030\204i\201\231C\231\254\250YK\263\257e\366\265i\273\253\372\320]\335B\332\353\335\365_2\275A>9(Jd\217k\253\341\330\244\230\372\007/\n^\335\262\233v4\325ii\024\217\345\230@\326\264\034\260\311/Z\304\200\374\200K3C\326\350\217\373"
+	.ascii	".\255n\362\336K@\317\225.L\272F{\324&\247\343\330\222\035\235"
+	.ascii	"\305\316\346\3217\3368:\307\207\322{\317\356\275<\332\252\261"
+	.ascii	"*p\262\372Qu\365\340\321:\230\r\320Q\304e\202\363\3014\361\313"
+	.ascii	"\001dK\035b\371\326\033X}\005\204\346i\207\326\350]\352\223\245"
+	.ascii	"D\243\"e\377\256\3429=2W\320\324i\364o\252\236\3621\227H\272"
+	.ascii	"F[\252,\t4\227\242\241i\364\365h\377\367S\333heC\265\023;;\352"
+	.ascii	"}\373\330He\222\305:\212\355\344q\025&\3432\2478(6\353(>\343"
+	.ascii	":iM\312'\225\216j\246n\252M\246}\272\022\325Q<\307x\265\311\374"
+	.ascii	"Au\341=\357M\207L\230`\036\031\203\004\210v\262\217\334\231Y"
+	.ascii	"\231\263o8\226\225,\324\033\221\367\377z\330\354\360`\016a\177"
+	.ascii	"\306\343;)8\206 \371u\251\003\"G\243|\207\353\316vL\307v+\226"
+	.ascii	"\367\"\331.\310\356^d\020\363\002\314\013\240a]J\262\364\320"
+	.ascii	"w\234}\273\331w\031\246\2236\201\312\252$\231\312b\345p\034\206"
+	.ascii	"\303N\236\3639\214\206\237iLw\002\251\265v9r\324,&\273U=q?\240"
+	.ascii	"\230@\2628\037_v\274f\241O\276$\3234Zu0^/\216\214\355\f\314\376"
+	.ascii	"~T\253jUo\264i\201\231\343q\342\204I[\305z\275\321v\317\264L"
+	.ascii	"\243\365\212\261`%as\265\034]\244\260\025\261\277%w\257Lw\225"
+	.ascii	"\252\332\261Y\313#\234\f\302\210\271\343e\356*\263J\004\251\341"
+	.ascii	"\222\006\210j\343\225\352uJ\002\026\365\251\002\261&\005\252"
+	.ascii	"\321*u\240,6/O\250\032\325DH\363\211\r\373\023\226L\307\325U"
+	.ascii	"\243U\311xUH7p\352Sm\353\202cj\264&k\023;_\246:\275g\225\225"
+	.ascii	"\3362 /Ofe\032\275\017i\357\003\277L\257\036_\221\377\317\207"
+	.ascii	"\212\232\023\334\035\333y\257\367\377\361\020*\2677:xp\220\350"
+	.ascii	"0\362\264\357\311\331\037\035\035]\327\261\210\224i\2102\317"
+	.ascii	"!T\276\222\334y\327\371,\267\236\346\324\354\017\215\016\235"
+	.ascii	"\2663d\257\030\330\332\363\307v\346lJ\235\267\035.\037\331\034"
+	.ascii	"\271#\232\355\271\362|\266\2341\037/-\315:q\336rx\276\350\320"
+	.ascii	"\334\032m8?'j\234=\272\t\035k\2225$\265\326\313\2325\355\346"
+	.ascii	"5y\265\316\230>\b\021\225\266y\273\001z\372\262\021\327h\263"
+	.ascii	"\001j\221\003W\207\361\202\236\324E\241aZ\233\346\004\0324\255"
+	.ascii	"fhY\331P\311*\301q\270\242\330\220{\253\361\035i\023\202\325"
+	.ascii	"h\247A\233\232\330-\267\272\352\260Ik\364=/\333P'\336o\316~\353"
+	.ascii	"3\033\224]\344U\2111Vqt\314]+1\020\214H\342\366\244K4\\\320\017"
+	.ascii	"\215\034 ew\354y\206\260=d\332\332\332m\216\331C\276\031\313"
+	.ascii	"\"\304\333m\214O\036\020&nj\326'\307\332Z\223\261\367\3366&\221"
+	.ascii	"5]\302\214Y\237+'\274\334K\223\341\254{\204\263\"\n3\253D\220"
+	.ascii	"\217\2513V\202x\223\3511*`q\253\322h\213\001BkzC\327\304\266"
+	.ascii	"Z\203ag\207"
+	.string	"\371\361\021\302\245\f\331h\r\337\325z\375\245\267C\310s\313\226\375Ys9\353\264\336\275\234.\253\254\200Y\320\232\013Z\247\331#\220\226-\357\264\006\003\216\231\252\"\203\0217\204\020\215\236\007\313\036\265\263>\347\211\267\231\263\315:\013_.|\225QqY\317{\327 \260V\236c\316N\203|\270h\231\341Hc}fN\274\233\315\306\302\227\311\367n\021\322\343i\241\230!\301\246|vA\262n\243\316+4"
+	.string	"\301\250\341\220\032\352\260(b\250\326\254O\312\211w\2326\331\006Yd\367\b\200\220*(\346\334\275? "
+	.string	"\2661K\206\251\362\223\006G]\216\364\354.o\t\2354\353C\007\312\2414\225f\372\260t\365xNySq\363{bce\244\321\216\322b<Z\276\3040\265XK\271\314\036r\356\220\370t0\335\t\023\326D\200`!\031\013\263\300\257\023\255\244\231\357%_\322NDHo\225/F\342\260\006\215A\017\200\025\364\024\205F\342\020)\005\2430\204\001\202\306\240\007?-T\260\020\2038\004\301GXD\f\336\020\203\203\031\304\2410\306\222Q\021q\230\242\250\264\224b"
+	.string	"#\243%\"\021\211\3503\022\tu\030*\365p@*\3220\"\021}2\202B#TX\\JB\211B#b\321\250\344\233A\034\nWP\022\032s\350"
+	.string	"\200\2421\005_\013\025,"
+	.string	"g\020\207E\343\213\240\nX\020\032\207E\027|N\003E\t0Fx\221\302(\234Q\f\032\0250\022I0\201\rEHF.\204E$\027GB\243R\016/\202\004\020\022\022\031\215\226\224|b\020\203GGH.\222\224\216F"
+	.string	"E\200\302X\f&\241\210\021\024\256\220\244t$$"
+	.string	"\020I\006q\204\027B\035\206F\301aQ\250$\300\205:\f_\210x\321\260($\ng\330\257hq\242E\0055|\306\323@!c\251\206\243\240\260hTJAD::B*B \006QX\225\210d,\325\240\324+\032\223\252\321H\\Br\321\243D\224C\321H\374@\251g$\272ahT\324c\215B%\0312\220z1\2046\024\005\223z\305 \215\"Tx\024$\242\302\244\034\214\250q\311(\330\302\320\250H\204\321HT\201\2218\\\362\031\365h\030g\020\205%p\220C\260X\f\362\030\205DF"
+	.string	"\324\020\306 \216`\354\021\032\325\020\204Q\302\320\250h\200\244%\033\220\220\214z\306\323HQ$\243\200#%\t\213)\214HH\305\024>5\202GU\211\310E\215\240\t\304\241\tC\243\242\021F\242\026*\214\304\241\2178<\2525\202G\304\341Qo\306P\006\021\251\250g$\"\316H\342\371\212\b\202E5P\300\202\002\024C\267\300\002\027\n\260pB\b\266\b\205\322\f\342\320h\024*\021%)\035\245 \016\203G)\212\212J)P\220 \316H\252fY?gd]ke\365\306\217\0226\"LX*U^\324\221+g\333Ib\3466\347j\265\2316\201\332\322\240\221k\364\326\206\375\253\025#\350\230:9G\262\312D\267\260\211\343Q\205\312\005\311%Q\322\312\365c\342\244v6V\207"
+	.string	"\213HuYRq\003\374j\273\3026\245\235\350\360\342\346Y\325\324\001\242D\212\234J\365\344\315S\r#\013\2226\347\256Q4\210\352\255\312T\243-\207\016\221\270N\305\314\2049\235N\260"
+	.ascii	"\235\324\205\301\003\"\313\217Y\205\006\006\254\323\200\264\236"
+	.ascii	"\\SM\352\0172_8zT&u\002\034\337\2405j\241 AR\231c\202\266\354"
+	.ascii	"\310\022\245\344\225\331\013\343\301\306\243\321\372\305A\354"
+	.ascii	"\276\260\032\255I\336\006\265q\204\212\262\263\026H\221\"\325"
+	.ascii	"\210\004[|\256\354|h\371\341\325\310\026\317\r5SD\340\330\036"
+	.ascii	"%^^u\b\307iA1\347\200\354\270\345\210R\205"
+	.string	"\274\016i#\245\006\315\233\217\214\355\251\252ZU\253r\261\321\362\254s\312\310\325\255W.\316\022\204\313\221F\353\262\305\320\324\240\2055Z\203\374\215\017\035\274\345\334\231\375\301\365\350Q\177\254H\323\0023\027\264FD\211U\365\361\372\243\351\207\351\365\266%\202]\2502\2718\206C\031ChHFd&I\322\030\322\n\020\206\202a\036\331\316\003\022\240\2049\322)\307H\210\202$\311\260\237\001~H\264|k\233)x\037\f\244\234\037^\267\032\376\203\026$\357\323W{\230\3420X\233\261\031W\372\332\236\257\353\353S+L\247>\373f)n\001p\rk\276\"O\311id\207*g\205\225?\372\017(L\216\227\320d\313\363-\006\334\275\264\034\373\374\235(l\005B'[<\244)\ran\205\335\207\356=\354\374\020Y\310``%\372eZU\232\362}PE\343p\310z\n\001\002s\035\326Z\265\355\003-\200&\272"
+	.string	"U\312\274]{m\240'j\256\2242^]\006R\246\231\345\320\256lB\022\232q\256I\255\025R\036\021v6\005"
+	.string	"D\356\243\354\225!\n]\315\032\fqC\\U\031\246\317\253\272^\211\276\007\024X\227\344\251\273\341\250\031\311\262\026\363\242\006Zn>\371\206f\261\217\341\212\t\377\343\300|A\255W\nx\263t2J\340\224\376\324\323\335j*\211\217\226\"\001\306\022K\202H\360\263\016BP\031\206\333\036\223\024\002\360\224\230\006\204\355bhT\027l\325a(\321c\222\361_1T\227H;\177\024\034v\375\227,z.acN\bu\202\321l\211&\233\245\376\271 YL6\027[4\234\303Dx\345D\003;\261`ndF}!_\350\264\337\217Y\264\300\234\035\241\374Hg\312Q\246\364\341\341Y\226\030\274A\021c\227Q\017\027\241AR\360\230\312\360E\323\315>l\022\220\351\327\0368\367\211"
+	.string	"2T\362\256\nix\030~V\276\006\302\347\345@\217e\340B!\236A\221\234\022\376\3076\270`\241i\220o\177\034r\321X\231\\R\253w\306P\202K\331\202\354\2113\375\335\274\364\335\200\216j\264\3534\034\217\t\321\246\006m\\\277\275\211,@/J\244\344r\222\225\027\236\b\270aP\325\235\317\226\250-uk\300d\273\236o\233\315\257\344\030b\007/\030\251\177s\251\310\302\b\033B\206\357\r\221\232\020\036\331Q8&\200;i\274+\237'\t\023\345\021\272Q\335\252\372.gs\335@%\006X\203\234>\317\373\221\323_\022\304\246\212^HA\347\233\375\220`\3540\312\035=\003\306\264N\327\020\264\227\360;.\200I\246\226\025p\001|\025\215\224\244\0029:\211"
+	.ascii	"#B\272\323\230\377\210FA\004k\n\254\033\201\036\"N8\272!\244"
+	.ascii	" \215\205\300\351\351*\030\232\371\007p\205-\376\2052&\020\233"
+	.ascii	"\275\331\234f\373\303D\355.5\017\001\242bWi\017\2743\354\372"
+	.ascii	"\303\177\362\223\004Q\357(\247\312\243\336\220*Lh\225\3510\215"
+	.ascii	"rH\215\342\364\321np&!]$ \336\370\0078\263\264\022brr\037\336"
+	.ascii	"\034\260q\316j|\203\267\262\331\275\357\357+\035\r+V&\304\221"
+	.ascii	"Dr\222T\270\266\035\001zMw\321\237\220)\247`\201n?\213\354\370"
+	.ascii	"\335\\\217\344\317\007\370\216\266>GZ\241N\024\357\007\301~\265"
+	.ascii	">\262\336\302}\347\210*\027\320\001( O\227\225\3127)d\206w\221"
+	.ascii	"\020\220)\336Tm\342\253U\377k\001\301\031g\372\314D\341\341\220"
+	.ascii	"<\353\221\261\t\r\247\300\233\255\033r\363{\321M<s8\330\177Q"
+	.ascii	"8U{\257\352_\256\365\310\013\354\233\203!\236\310\372\347wGg"
+	.ascii	"\302,\315e\367\002Y\340\n\003q(\177"
+	.ascii	"\314\340\344$\310\300\207\006\320\333\373\274+\307.\f\031p\r"
+	.ascii	"\236\251z\233]\274\037?%\003j\274\020\252\263\231\251\320\247"
+	.ascii	"\t^\020\3609nv\017z96\f\257\034\027\300\233\346\001[|D|h7\213"
+	.ascii	"h\004\251\202 ^\033B\rT\270\r\004\313i\343t\300\322w\200a\244"
+	.ascii	"\325\321\016\327r\216\360\003\362 \021\310h1\022\b\020 \035\256"
+	.ascii	"U\034\353\362\326\rZ\263m\351\035O\026t\017\370\3463\305\207"
+	.ascii	"\245\223s\225\336\372\351|\303\272\373\2669}}\222xd\354\357U"
+	.ascii	"\341\363a|D{\304\024\027\367\376\361\256\271\336\3266\325/f\362"
+	.ascii	"\260e\244\221\236F\317X\277\313=\277\3635(\207\242\"]\271\032"
+	.ascii	"\246s\372\025\267\311)\362\243\333[|\253\311\346$G0Y\223L\305"
+	.ascii	"\247K\026_~g\016\361V:1\375N\356/\0027\364\\\032\200?\265\267"
+	.ascii	"n\200\310\310\316\347\274\221\026&\363>\312{:\266!\\\f|\020\330"
+	.ascii	"\002\030\244\277dLq\245\344\265\002"
+	.text
+	.section	.gnu.lto_.symtab.a95e377bc336fe1,"e",@progbits
+	.string	"mspSettingCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"mspSettingInfoCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"mspSetSettingCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"settingFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"settingGetValuePointer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a95e377bc336fe1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15659 @@
+	.file	"rx.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/fc/rc_controls.h"
+	.file 10 "./src/main/fc/rc_modes.h"
+	.file 11 "./src/main/rx/rx.h"
+	.file 12 "./src/main/rx/rx.c"
+	.file 13 "./src/main/target/SITL/target.h"
+	.file 14 "./src/main/flight/failsafe.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/common/maths.h"
+	.file 17 "./src/main/rx/msp.h"
+	.file 18 "./src/main/config/feature.h"
+	.file 19 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rx.c.fffd974f
+	.weak	rx.c.fffd974f
+rx.c.fffd974f:
+	.long	0x10f1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x29
+	.long	.LASF2063
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1733
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1734
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1735
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1736
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1737
+	.uleb128 0x3
+	.long	.LASF1738
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1739
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1740
+	.uleb128 0x3
+	.long	.LASF1741
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1742
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1743
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1744
+	.uleb128 0x2b
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1745
+	.uleb128 0x8
+	.long	0xa2
+	.uleb128 0x3
+	.long	.LASF1746
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1747
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1748
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x8
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF1749
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1750
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x8
+	.long	0xe3
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1751
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1752
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x21
+	.long	.LASF1980
+	.byte	0xd
+	.byte	0xa1
+	.long	0xe3
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1753
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1754
+	.uleb128 0x3
+	.long	.LASF1755
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xd7
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x153
+	.uleb128 0xf
+	.long	.LASF1756
+	.value	0xfff
+	.uleb128 0xf
+	.long	.LASF1757
+	.value	0xf000
+	.uleb128 0xf
+	.long	.LASF1758
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1760
+	.byte	0x4
+	.byte	0x29
+	.byte	0xf
+	.long	0x15f
+	.uleb128 0x2c
+	.long	0x16f
+	.uleb128 0x6
+	.long	0x9b
+	.uleb128 0x6
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2d
+	.byte	0x8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x5
+	.long	0x18e
+	.uleb128 0x22
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x9b
+	.uleb128 0x22
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x18e
+	.byte	0
+	.uleb128 0x5
+	.long	0x153
+	.uleb128 0x14
+	.long	.LASF1899
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2b
+	.long	0x1ee
+	.uleb128 0x17
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2c
+	.byte	0xb
+	.long	0x120
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1761
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1762
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1ee
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1763
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ee
+	.byte	0x10
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x30
+	.byte	0xf
+	.long	0x1f3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1764
+	.byte	0x4
+	.byte	0x34
+	.byte	0x7
+	.long	0x16f
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xc6
+	.uleb128 0x5
+	.long	0x1ee
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x193
+	.uleb128 0x8
+	.long	0x1f8
+	.uleb128 0x3
+	.long	.LASF1766
+	.byte	0x5
+	.byte	0x18
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1767
+	.uleb128 0x8
+	.long	0x215
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0x6
+	.byte	0x19
+	.byte	0x11
+	.long	0xba
+	.uleb128 0x3
+	.long	.LASF1769
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1770
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x36b
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1792
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1802
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1803
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1804
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x8
+	.byte	0x22
+	.long	0x447
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x80
+	.uleb128 0xf
+	.long	.LASF1825
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF1826
+	.value	0x200
+	.uleb128 0xf
+	.long	.LASF1827
+	.value	0x400
+	.uleb128 0xf
+	.long	.LASF1828
+	.value	0x1000
+	.uleb128 0xf
+	.long	.LASF1829
+	.value	0x2000
+	.uleb128 0xf
+	.long	.LASF1830
+	.value	0x4000
+	.uleb128 0xf
+	.long	.LASF1831
+	.value	0x8000
+	.uleb128 0xd
+	.long	.LASF1832
+	.long	0x10000
+	.uleb128 0xd
+	.long	.LASF1833
+	.long	0x20000
+	.uleb128 0xd
+	.long	.LASF1834
+	.long	0x40000
+	.uleb128 0xd
+	.long	.LASF1835
+	.long	0x80000
+	.uleb128 0xd
+	.long	.LASF1836
+	.long	0x100000
+	.uleb128 0xd
+	.long	.LASF1837
+	.long	0x200000
+	.uleb128 0xd
+	.long	.LASF1838
+	.long	0x400000
+	.uleb128 0xd
+	.long	.LASF1839
+	.long	0x800000
+	.uleb128 0xd
+	.long	.LASF1840
+	.long	0x2000000
+	.uleb128 0xd
+	.long	.LASF1841
+	.long	0x4000000
+	.uleb128 0xd
+	.long	.LASF1842
+	.long	0x8000000
+	.uleb128 0xd
+	.long	.LASF1843
+	.long	0x10000000
+	.uleb128 0xd
+	.long	.LASF1844
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2064
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x9
+	.byte	0x18
+	.byte	0xe
+	.long	0x4a2
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x1
+	.uleb128 0x2f
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0xb
+	.byte	0
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x9
+	.byte	0x33
+	.long	0x4c6
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.long	0x5b6
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1897
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1898
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x3
+	.long	0x4c6
+	.uleb128 0x14
+	.long	.LASF1900
+	.byte	0x2
+	.byte	0xa
+	.byte	0x53
+	.long	0x5e9
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0xa
+	.byte	0x54
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0xa
+	.byte	0x55
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1903
+	.byte	0xa
+	.byte	0x56
+	.byte	0x3
+	.long	0x5c2
+	.uleb128 0x14
+	.long	.LASF1904
+	.byte	0x8
+	.byte	0xa
+	.byte	0x58
+	.long	0x629
+	.uleb128 0x2
+	.long	.LASF1905
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0x5b6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0xa
+	.byte	0x5a
+	.byte	0xd
+	.long	0xc6
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x14
+	.long	0x5e9
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1908
+	.byte	0xa
+	.byte	0x5c
+	.byte	0x3
+	.long	0x5f5
+	.uleb128 0x8
+	.long	0x629
+	.uleb128 0x10
+	.long	0x629
+	.long	0x64a
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1912
+	.byte	0xa
+	.byte	0x5e
+	.byte	0x22
+	.long	0x63a
+	.uleb128 0x13
+	.long	0x30
+	.byte	0xb
+	.byte	0x29
+	.long	0x674
+	.uleb128 0x1
+	.long	.LASF1909
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1910
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1911
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1913
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x10
+	.long	0xa9
+	.long	0x68b
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x8
+	.long	0x680
+	.uleb128 0xa
+	.long	.LASF1914
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x13
+	.long	0x68b
+	.uleb128 0x10
+	.long	0xae
+	.long	0x6ac
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1915
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x10
+	.long	0x69c
+	.uleb128 0x13
+	.long	0x30
+	.byte	0xb
+	.byte	0x57
+	.long	0x6dc
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1918
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1920
+	.byte	0x2
+	.byte	0xb
+	.byte	0x67
+	.long	0x703
+	.uleb128 0x2
+	.long	.LASF1921
+	.byte	0xb
+	.byte	0x68
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1922
+	.byte	0xb
+	.byte	0x69
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1923
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x3
+	.long	0x6dc
+	.uleb128 0x8
+	.long	0x703
+	.uleb128 0x10
+	.long	0x703
+	.long	0x724
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1924
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x22
+	.long	0x714
+	.uleb128 0xa
+	.long	.LASF1925
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x6d
+	.long	0x714
+	.uleb128 0x14
+	.long	.LASF1926
+	.byte	0x4
+	.byte	0xb
+	.byte	0x6e
+	.long	0x763
+	.uleb128 0x17
+	.string	"min"
+	.byte	0xb
+	.byte	0x6f
+	.byte	0xe
+	.long	0xd7
+	.byte	0
+	.uleb128 0x17
+	.string	"max"
+	.byte	0xb
+	.byte	0x70
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1927
+	.byte	0xb
+	.byte	0x71
+	.byte	0x3
+	.long	0x73c
+	.uleb128 0x8
+	.long	0x763
+	.uleb128 0x10
+	.long	0x763
+	.long	0x784
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1928
+	.byte	0xb
+	.byte	0x73
+	.byte	0x1f
+	.long	0x774
+	.uleb128 0xa
+	.long	.LASF1929
+	.byte	0xb
+	.byte	0x73
+	.byte	0x63
+	.long	0x774
+	.uleb128 0x14
+	.long	.LASF1930
+	.byte	0x2c
+	.byte	0xb
+	.byte	0x75
+	.long	0x8ee
+	.uleb128 0x2
+	.long	.LASF1931
+	.byte	0xb
+	.byte	0x76
+	.byte	0xd
+	.long	0x8f3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1932
+	.byte	0xb
+	.byte	0x77
+	.byte	0xd
+	.long	0xc6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1933
+	.byte	0xb
+	.byte	0x78
+	.byte	0xd
+	.long	0xc6
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1934
+	.byte	0xb
+	.byte	0x79
+	.byte	0xd
+	.long	0xc6
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1935
+	.byte	0xb
+	.byte	0x7a
+	.byte	0xd
+	.long	0xc6
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1936
+	.byte	0xb
+	.byte	0x7b
+	.byte	0xe
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1937
+	.byte	0xb
+	.byte	0x7c
+	.byte	0xd
+	.long	0xc6
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0xb
+	.byte	0x7d
+	.byte	0xd
+	.long	0x209
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0xb
+	.byte	0x7e
+	.byte	0xd
+	.long	0x209
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1940
+	.byte	0xb
+	.byte	0x7f
+	.byte	0xd
+	.long	0xc6
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0xb
+	.byte	0x80
+	.byte	0xd
+	.long	0xc6
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1942
+	.byte	0xb
+	.byte	0x81
+	.byte	0xd
+	.long	0xc6
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0xb
+	.byte	0x82
+	.byte	0xd
+	.long	0xc6
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1944
+	.byte	0xb
+	.byte	0x83
+	.byte	0xd
+	.long	0xc6
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1945
+	.byte	0xb
+	.byte	0x84
+	.byte	0xe
+	.long	0xd7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1946
+	.byte	0xb
+	.byte	0x85
+	.byte	0xe
+	.long	0xd7
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1947
+	.byte	0xb
+	.byte	0x86
+	.byte	0xe
+	.long	0xd7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1948
+	.byte	0xb
+	.byte	0x87
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1949
+	.byte	0xb
+	.byte	0x88
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1950
+	.byte	0xb
+	.byte	0x89
+	.byte	0xd
+	.long	0xc6
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1951
+	.byte	0xb
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc6
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1952
+	.byte	0xb
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc6
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1953
+	.byte	0xb
+	.byte	0x8c
+	.byte	0xe
+	.long	0xd7
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1954
+	.byte	0xb
+	.byte	0x8e
+	.byte	0xe
+	.long	0xd7
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1955
+	.byte	0xb
+	.byte	0x8f
+	.byte	0xe
+	.long	0xd7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x79c
+	.uleb128 0x10
+	.long	0xc6
+	.long	0x903
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1956
+	.byte	0xb
+	.byte	0x90
+	.byte	0x3
+	.long	0x79c
+	.uleb128 0x8
+	.long	0x903
+	.uleb128 0xa
+	.long	.LASF1957
+	.byte	0xb
+	.byte	0x92
+	.byte	0x13
+	.long	0x903
+	.uleb128 0xa
+	.long	.LASF1958
+	.byte	0xb
+	.byte	0x92
+	.byte	0x36
+	.long	0x903
+	.uleb128 0x3
+	.long	.LASF1959
+	.byte	0xb
+	.byte	0x95
+	.byte	0x14
+	.long	0x938
+	.uleb128 0x5
+	.long	0x93d
+	.uleb128 0x31
+	.long	0xd7
+	.long	0x951
+	.uleb128 0x6
+	.long	0x951
+	.uleb128 0x6
+	.long	0xc6
+	.byte	0
+	.uleb128 0x5
+	.long	0x997
+	.uleb128 0x14
+	.long	.LASF1960
+	.byte	0x18
+	.byte	0xb
+	.byte	0x98
+	.long	0x997
+	.uleb128 0x2
+	.long	.LASF1961
+	.byte	0xb
+	.byte	0x99
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1962
+	.byte	0xb
+	.byte	0x9a
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1963
+	.byte	0xb
+	.byte	0x9b
+	.byte	0x18
+	.long	0x92c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1964
+	.byte	0xb
+	.byte	0x9c
+	.byte	0x18
+	.long	0x99c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0x956
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0xb
+	.byte	0x96
+	.byte	0x13
+	.long	0x9a8
+	.uleb128 0x5
+	.long	0x9ad
+	.uleb128 0x32
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF1966
+	.byte	0xb
+	.byte	0x9d
+	.byte	0x3
+	.long	0x956
+	.uleb128 0x8
+	.long	0x9b2
+	.uleb128 0xa
+	.long	.LASF1967
+	.byte	0xb
+	.byte	0x9f
+	.byte	0x1a
+	.long	0x9b2
+	.uleb128 0x10
+	.long	0xa9
+	.long	0x9df
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0x9cf
+	.uleb128 0x33
+	.long	0x690
+	.byte	0xc
+	.byte	0x43
+	.byte	0xc
+	.long	0x9df
+	.uleb128 0x12
+	.long	0x674
+	.byte	0x45
+	.byte	0xa
+	.uleb128 0xb
+	.long	.LASF1968
+	.byte	0x47
+	.byte	0xc
+	.long	0x215
+	.uleb128 0xb
+	.long	.LASF1969
+	.byte	0x48
+	.byte	0xc
+	.long	0x215
+	.uleb128 0xb
+	.long	.LASF1970
+	.byte	0x49
+	.byte	0xc
+	.long	0x215
+	.uleb128 0xb
+	.long	.LASF1971
+	.byte	0x4a
+	.byte	0xc
+	.long	0x215
+	.uleb128 0xb
+	.long	.LASF1972
+	.byte	0x4b
+	.byte	0xc
+	.long	0x215
+	.uleb128 0xb
+	.long	.LASF1973
+	.byte	0x4c
+	.byte	0xc
+	.long	0x215
+	.uleb128 0xb
+	.long	.LASF1974
+	.byte	0x4e
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF1975
+	.byte	0x4f
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF1976
+	.byte	0x50
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF1977
+	.byte	0x51
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF1978
+	.byte	0x52
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0xb
+	.long	.LASF1979
+	.byte	0x54
+	.byte	0x10
+	.long	0x69c
+	.uleb128 0x12
+	.long	0x6ac
+	.byte	0x55
+	.byte	0x9
+	.uleb128 0x10
+	.long	0xe3
+	.long	0xa92
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1981
+	.byte	0xc
+	.byte	0x56
+	.long	0xa82
+	.uleb128 0x12
+	.long	0x9c3
+	.byte	0x61
+	.byte	0x13
+	.uleb128 0xb
+	.long	.LASF1982
+	.byte	0x62
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x12
+	.long	0x914
+	.byte	0x7c
+	.byte	0x3a
+	.uleb128 0x12
+	.long	0x920
+	.byte	0x7c
+	.byte	0x56
+	.uleb128 0xa
+	.long	.LASF1983
+	.byte	0xc
+	.byte	0x7c
+	.byte	0x7f
+	.long	0x204
+	.uleb128 0x34
+	.long	0xabd
+	.byte	0xa5
+	.uleb128 0x12
+	.long	0x784
+	.byte	0x9f
+	.byte	0x5f
+	.uleb128 0x12
+	.long	0x790
+	.byte	0x9f
+	.byte	0x9c
+	.uleb128 0xa
+	.long	.LASF1984
+	.byte	0xc
+	.byte	0x9f
+	.byte	0xda
+	.long	0x204
+	.uleb128 0x23
+	.long	0xadd
+	.value	0x10d
+	.uleb128 0x12
+	.long	0x724
+	.byte	0xa9
+	.byte	0x68
+	.uleb128 0x12
+	.long	0x730
+	.byte	0xa9
+	.byte	0xac
+	.uleb128 0xa
+	.long	.LASF1985
+	.byte	0xc
+	.byte	0xa9
+	.byte	0xee
+	.long	0x204
+	.uleb128 0x23
+	.long	0xafe
+	.value	0x124
+	.uleb128 0xb
+	.long	.LASF1986
+	.byte	0xcc
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x18
+	.long	.LASF1989
+	.byte	0xf
+	.byte	0xf6
+	.byte	0xe
+	.long	0x9d
+	.long	0xb37
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1987
+	.byte	0x5b
+	.uleb128 0x1d
+	.long	.LASF1988
+	.byte	0x5a
+	.uleb128 0x18
+	.long	.LASF1990
+	.byte	0xa
+	.byte	0x66
+	.byte	0x5
+	.long	0x215
+	.long	0xb59
+	.uleb128 0x6
+	.long	0x5b6
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1991
+	.byte	0x10
+	.byte	0x59
+	.byte	0x5
+	.long	0x7c
+	.long	0xb83
+	.uleb128 0x6
+	.long	0x7c
+	.uleb128 0x6
+	.long	0x7c
+	.uleb128 0x6
+	.long	0x7c
+	.uleb128 0x6
+	.long	0x7c
+	.uleb128 0x6
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1992
+	.byte	0x58
+	.uleb128 0x24
+	.long	.LASF1993
+	.byte	0xe
+	.byte	0x57
+	.long	0xb9a
+	.uleb128 0x6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1996
+	.byte	0x1b
+	.long	0x239
+	.uleb128 0x24
+	.long	.LASF1994
+	.byte	0x11
+	.byte	0x16
+	.long	0xbba
+	.uleb128 0x6
+	.long	0xbba
+	.uleb128 0x6
+	.long	0xbbf
+	.byte	0
+	.uleb128 0x5
+	.long	0x8ee
+	.uleb128 0x5
+	.long	0x956
+	.uleb128 0x18
+	.long	.LASF1995
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x5
+	.long	0x215
+	.long	0xbda
+	.uleb128 0x6
+	.long	0xe3
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1997
+	.byte	0x1d
+	.long	0x22d
+	.uleb128 0x1e
+	.long	.LASF1998
+	.value	0x2ba
+	.byte	0xa
+	.long	0xd7
+	.uleb128 0x19
+	.long	.LASF2003
+	.value	0x2b0
+	.long	0xc08
+	.uleb128 0x7
+	.long	.LASF1999
+	.value	0x2b0
+	.byte	0x1a
+	.long	0x239
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2000
+	.value	0x289
+	.long	0xc20
+	.uleb128 0x7
+	.long	.LASF1999
+	.value	0x289
+	.byte	0x24
+	.long	0x239
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2001
+	.value	0x277
+	.long	0xc38
+	.uleb128 0x4
+	.long	.LASF2002
+	.value	0x279
+	.byte	0xd
+	.long	0xae
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2004
+	.value	0x26d
+	.long	0xc74
+	.uleb128 0x7
+	.long	.LASF2005
+	.value	0x26d
+	.byte	0x22
+	.long	0x102
+	.uleb128 0x7
+	.long	.LASF2006
+	.value	0x26d
+	.byte	0x35
+	.long	0xc74
+	.uleb128 0x9
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x26f
+	.byte	0x16
+	.long	0x102
+	.uleb128 0x9
+	.uleb128 0x1b
+	.string	"s"
+	.value	0x270
+	.byte	0x15
+	.long	0x102
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x903
+	.uleb128 0x19
+	.long	.LASF2007
+	.value	0x25b
+	.long	0xc91
+	.uleb128 0x7
+	.long	.LASF1999
+	.value	0x25b
+	.byte	0x34
+	.long	0x239
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2008
+	.value	0x21a
+	.long	0xd07
+	.uleb128 0x7
+	.long	.LASF1999
+	.value	0x21a
+	.byte	0x38
+	.long	0x239
+	.uleb128 0x4
+	.long	.LASF2009
+	.value	0x21c
+	.byte	0x9
+	.long	0x215
+	.uleb128 0x4
+	.long	.LASF2010
+	.value	0x21d
+	.byte	0xf
+	.long	0x21c
+	.uleb128 0x4
+	.long	.LASF2011
+	.value	0x21e
+	.byte	0x14
+	.long	0xef
+	.uleb128 0x26
+	.long	0xcf8
+	.uleb128 0x4
+	.long	.LASF2012
+	.value	0x231
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2013
+	.value	0x233
+	.byte	0x12
+	.long	0xd7
+	.uleb128 0x4
+	.long	.LASF2014
+	.value	0x235
+	.byte	0xd
+	.long	0x215
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2012
+	.value	0x251
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2015
+	.value	0x207
+	.long	0xd47
+	.uleb128 0x4
+	.long	.LASF1961
+	.value	0x209
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2012
+	.value	0x20a
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2016
+	.value	0x20c
+	.byte	0x17
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF2013
+	.value	0x20f
+	.byte	0x12
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2019
+	.value	0x1f7
+	.byte	0x10
+	.long	0xc6
+	.long	0xd72
+	.uleb128 0x4
+	.long	.LASF2017
+	.value	0x1f9
+	.byte	0x14
+	.long	0xc6
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2018
+	.value	0x1fc
+	.byte	0x11
+	.long	0xc6
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2020
+	.value	0x1ea
+	.byte	0x11
+	.long	0xd7
+	.long	0xd9b
+	.uleb128 0x7
+	.long	.LASF2013
+	.value	0x1ea
+	.byte	0x35
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF1907
+	.value	0x1ea
+	.byte	0x5b
+	.long	0xd9b
+	.byte	0
+	.uleb128 0x5
+	.long	0x76f
+	.uleb128 0x15
+	.long	.LASF2021
+	.value	0x1cd
+	.byte	0x11
+	.long	0xd7
+	.long	0xdc9
+	.uleb128 0x7
+	.long	.LASF2012
+	.value	0x1cd
+	.byte	0x28
+	.long	0xc6
+	.uleb128 0x4
+	.long	.LASF2022
+	.value	0x1cf
+	.byte	0x26
+	.long	0xdc9
+	.byte	0
+	.uleb128 0x5
+	.long	0x70f
+	.uleb128 0x15
+	.long	.LASF2023
+	.value	0x1b3
+	.byte	0x11
+	.long	0xd7
+	.long	0xe35
+	.uleb128 0x7
+	.long	.LASF2024
+	.value	0x1b3
+	.byte	0x37
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF2013
+	.value	0x1b3
+	.byte	0x46
+	.long	0xd7
+	.uleb128 0x4
+	.long	.LASF2025
+	.value	0x1b5
+	.byte	0x14
+	.long	0xe35
+	.uleb128 0x4
+	.long	.LASF2026
+	.value	0x1b6
+	.byte	0x14
+	.long	0xe4b
+	.uleb128 0x4
+	.long	.LASF2027
+	.value	0x1b7
+	.byte	0x10
+	.long	0x215
+	.uleb128 0x4
+	.long	.LASF2028
+	.value	0x1b9
+	.byte	0x13
+	.long	0xd2
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2029
+	.value	0x1c7
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xae
+	.long	0xe4b
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xb
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x10
+	.long	0xae
+	.long	0xe5b
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2030
+	.byte	0xc
+	.value	0x18b
+	.byte	0x5
+	.long	0x215
+	.long	0xe93
+	.uleb128 0x7
+	.long	.LASF1999
+	.value	0x18b
+	.byte	0x1c
+	.long	0x239
+	.uleb128 0x7
+	.long	.LASF2031
+	.value	0x18b
+	.byte	0x37
+	.long	0x221
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2032
+	.value	0x1a8
+	.byte	0x17
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2033
+	.value	0x184
+	.uleb128 0x27
+	.long	.LASF2034
+	.value	0x17d
+	.uleb128 0x36
+	.long	.LASF2048
+	.byte	0xc
+	.value	0x178
+	.byte	0xc
+	.long	0x215
+	.uleb128 0x1e
+	.long	.LASF2035
+	.value	0x173
+	.byte	0x5
+	.long	0x215
+	.uleb128 0x1e
+	.long	.LASF2036
+	.value	0x16e
+	.byte	0x5
+	.long	0x215
+	.uleb128 0x15
+	.long	.LASF2037
+	.value	0x166
+	.byte	0x10
+	.long	0xc6
+	.long	0xefb
+	.uleb128 0x7
+	.long	.LASF2038
+	.value	0x166
+	.byte	0x39
+	.long	0xefb
+	.uleb128 0x7
+	.long	.LASF2039
+	.value	0x166
+	.byte	0x4d
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF2040
+	.value	0x166
+	.byte	0x6b
+	.long	0xc6
+	.byte	0
+	.uleb128 0x5
+	.long	0xd2
+	.uleb128 0x19
+	.long	.LASF2041
+	.value	0x123
+	.long	0xf44
+	.uleb128 0x26
+	.long	0xf1b
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x12a
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x133
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2042
+	.value	0x134
+	.byte	0x2a
+	.long	0xf44
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2043
+	.value	0x137
+	.byte	0x16
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x635
+	.uleb128 0x37
+	.long	.LASF2044
+	.byte	0xc
+	.byte	0xde
+	.byte	0xd
+	.long	0xf6e
+	.uleb128 0xe
+	.long	.LASF2012
+	.byte	0xc
+	.byte	0xde
+	.byte	0x31
+	.long	0xc6
+	.uleb128 0xe
+	.long	.LASF2045
+	.byte	0xc
+	.byte	0xde
+	.byte	0x4a
+	.long	0x215
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2046
+	.byte	0xc
+	.byte	0xd7
+	.byte	0x18
+	.long	0x215
+	.long	0xf8b
+	.uleb128 0xe
+	.long	.LASF2047
+	.byte	0xc
+	.byte	0xd7
+	.byte	0x2e
+	.long	0xd7
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2049
+	.byte	0xc
+	.byte	0xd2
+	.byte	0x18
+	.long	0x215
+	.uleb128 0x38
+	.long	.LASF2065
+	.byte	0xc
+	.byte	0xce
+	.byte	0xd
+	.uleb128 0x1f
+	.long	.LASF2050
+	.byte	0xc
+	.byte	0xc5
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x16
+	.long	.LASF2051
+	.byte	0xc
+	.byte	0xbd
+	.byte	0x11
+	.long	0xd7
+	.long	0xfd4
+	.uleb128 0xe
+	.long	.LASF1967
+	.byte	0xc
+	.byte	0xbd
+	.byte	0x38
+	.long	0xfd4
+	.uleb128 0xe
+	.long	.LASF2012
+	.byte	0xc
+	.byte	0xbd
+	.byte	0x51
+	.long	0xc6
+	.byte	0
+	.uleb128 0x5
+	.long	0x9be
+	.uleb128 0x1c
+	.long	.LASF2052
+	.byte	0xb4
+	.long	0xffa
+	.uleb128 0xe
+	.long	.LASF2053
+	.byte	0xc
+	.byte	0xb4
+	.byte	0x43
+	.long	0xffa
+	.uleb128 0x9
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xb6
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x763
+	.uleb128 0x1c
+	.long	.LASF2054
+	.byte	0xaa
+	.long	0x1020
+	.uleb128 0xe
+	.long	.LASF2055
+	.byte	0xc
+	.byte	0xaa
+	.byte	0x44
+	.long	0x1020
+	.uleb128 0x9
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xac
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x703
+	.uleb128 0x1c
+	.long	.LASF2056
+	.byte	0xa0
+	.long	0x1046
+	.uleb128 0xe
+	.long	.LASF2057
+	.byte	0xc
+	.byte	0xa0
+	.byte	0x3e
+	.long	0xffa
+	.uleb128 0x9
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xa3
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2058
+	.byte	0x7d
+	.long	0x105d
+	.uleb128 0xe
+	.long	.LASF2006
+	.byte	0xc
+	.byte	0x7d
+	.byte	0x25
+	.long	0xc74
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2006
+	.byte	0xb
+	.byte	0x92
+	.byte	0x65
+	.long	0x1069
+	.uleb128 0x5
+	.long	0x90f
+	.uleb128 0x16
+	.long	.LASF2057
+	.byte	0xb
+	.byte	0x73
+	.byte	0xb3
+	.long	0xd9b
+	.long	0x108b
+	.uleb128 0xe
+	.long	.LASF2059
+	.byte	0xb
+	.byte	0x73
+	.byte	0xcd
+	.long	0x7c
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2055
+	.byte	0xb
+	.byte	0x6c
+	.byte	0xc4
+	.long	0xdc9
+	.long	0x10a8
+	.uleb128 0xe
+	.long	.LASF2059
+	.byte	0xb
+	.byte	0x6c
+	.byte	0xe1
+	.long	0x7c
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2060
+	.byte	0xa
+	.byte	0x5e
+	.byte	0xc4
+	.long	0xf44
+	.long	0x10c5
+	.uleb128 0xe
+	.long	.LASF2059
+	.byte	0xa
+	.byte	0x5e
+	.byte	0xe1
+	.long	0x7c
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2061
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x28
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x28
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0xe
+	.long	.LASF2062
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 36 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF742
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF778
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 42 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF699
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.file 47 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF825
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF864
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF881
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF882
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF883
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF903
+	.byte	0x4
+	.byte	0x4
+	.file 64 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF907
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF909
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF910
+	.byte	0x4
+	.byte	0x4
+	.file 69 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 70 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x46
+	.file 71 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 72 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.file 73 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 74 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 75 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 76 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.file 77 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 78 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.file 79 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 80 "./src/main/drivers/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1237
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1238
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.file 81 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x51
+	.byte	0x4
+	.file 82 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x52
+	.byte	0x4
+	.file 83 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x53
+	.file 84 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x54
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 85 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 86 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1629
+	.byte	0x4
+	.file 87 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x57
+	.file 88 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 89 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 90 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1639
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 91 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 92 "./src/main/rx/pwm.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5c
+	.byte	0x4
+	.file 93 "./src/main/rx/sbus.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x5d
+	.byte	0x4
+	.file 94 "./src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 95 "./src/main/rx/sumd.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/rx/sumh.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x11
+	.byte	0x4
+	.file 97 "./src/main/rx/xbus.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/rx/ibus.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "./src/main/rx/jetiexbus.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x63
+	.byte	0x4
+	.file 100 "./src/main/rx/crsf.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 101 "./src/main/rx/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 102 "./src/main/rx/targetcustomserial.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1732
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF950
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1004
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1008
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1014
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1021
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1028
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1038
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1053
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1122
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1234
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1236
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1240
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1635
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.68.074d72f9fdc6df5977b1481e64156ab9,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1663
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial.h.89.f8a031d5ed9d74c22de8e9d69030ae8b,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.7a5cf5e700661e87e5a836c794cefef8,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.7eabd3dc96720430f10f642c53b6edaf,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.crsf.h.20.8981513d6f7ad0e71c8bd24b527fbc08,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1709
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_spi.h.64.fd2df210de894f8eb89a02c524951c8f,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1715
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2066
+	.long	.LASF2067
+	.long	.LASF2068
+	.long	.LASF2069
+	.long	.LASF2070
+	.long	.LASF2071
+	.long	.LASF2072
+	.long	.LASF2073
+	.long	.LASF2074
+	.long	.LASF2075
+	.long	.LASF2076
+	.long	.LASF2077
+	.long	.LASF2078
+	.long	.LASF2079
+	.long	.LASF2080
+	.long	.LASF2081
+	.long	.LASF2082
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x67
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2083
+	.byte	0xd
+	.long	.LASF2084
+	.byte	0xd
+	.long	.LASF2085
+	.byte	0xd
+	.long	.LASF2086
+	.byte	0x3
+	.long	.LASF2087
+	.byte	0x4
+	.long	.LASF2088
+	.byte	0x2
+	.long	.LASF2089
+	.byte	0x4
+	.long	.LASF2090
+	.byte	0x5
+	.long	.LASF2091
+	.byte	0x5
+	.long	.LASF2092
+	.byte	0x5
+	.long	.LASF2093
+	.byte	0x8
+	.long	.LASF2094
+	.byte	0x8
+	.long	.LASF2095
+	.byte	0x9
+	.long	.LASF2096
+	.byte	0x6
+	.long	.LASF2097
+	.byte	0x10
+	.long	.LASF2098
+	.byte	0x2
+	.long	.LASF2099
+	.byte	0x8
+	.long	.LASF2100
+	.byte	0x3
+	.long	.LASF2088
+	.byte	0x4
+	.long	.LASF2101
+	.byte	0x10
+	.long	.LASF2102
+	.byte	0x11
+	.long	.LASF2103
+	.byte	0x11
+	.long	.LASF2103
+	.byte	0x10
+	.long	.LASF2104
+	.byte	0xd
+	.long	.LASF2105
+	.byte	0x10
+	.long	.LASF2106
+	.byte	0x10
+	.long	.LASF2107
+	.byte	0xd
+	.long	.LASF2108
+	.byte	0xd
+	.long	.LASF2109
+	.byte	0xf
+	.long	.LASF2110
+	.byte	0xd
+	.long	.LASF2111
+	.byte	0xe
+	.long	.LASF2112
+	.byte	0xe
+	.long	.LASF2113
+	.byte	0xd
+	.long	.LASF2114
+	.byte	0xd
+	.long	.LASF2115
+	.byte	0xd
+	.long	.LASF2116
+	.byte	0x10
+	.long	.LASF2117
+	.byte	0x11
+	.long	.LASF2118
+	.byte	0xd
+	.long	.LASF2119
+	.byte	0xd
+	.long	.LASF2120
+	.byte	0xd
+	.long	.LASF2121
+	.byte	0xd
+	.long	.LASF2083
+	.byte	0xf
+	.long	.LASF2122
+	.byte	0xc
+	.long	.LASF2123
+	.byte	0xc
+	.long	.LASF2124
+	.byte	0xc
+	.long	.LASF2125
+	.byte	0xc
+	.long	.LASF2126
+	.byte	0x10
+	.long	.LASF2126
+	.byte	0xd
+	.long	.LASF2127
+	.byte	0xd
+	.long	.LASF2128
+	.byte	0xd
+	.long	.LASF2129
+	.byte	0xd
+	.long	.LASF2130
+	.byte	0xf
+	.long	.LASF2130
+	.byte	0xd
+	.long	.LASF2131
+	.byte	0xc
+	.long	.LASF2132
+	.byte	0xc
+	.long	.LASF2133
+	.byte	0xc
+	.long	.LASF2134
+	.byte	0xc
+	.long	.LASF2135
+	.byte	0xd
+	.long	.LASF2136
+	.byte	0xd
+	.long	.LASF2137
+	.byte	0xd
+	.long	.LASF2138
+	.byte	0xd
+	.long	.LASF2139
+	.byte	0xd
+	.long	.LASF2140
+	.byte	0xd
+	.long	.LASF2141
+	.byte	0x10
+	.long	.LASF2142
+	.byte	0xd
+	.long	.LASF2143
+	.byte	0xd
+	.long	.LASF2144
+	.byte	0xc
+	.long	.LASF2145
+	.byte	0xc
+	.long	.LASF2146
+	.byte	0x10
+	.long	.LASF2147
+	.byte	0xb
+	.long	.LASF2148
+	.byte	0xa
+	.long	.LASF2149
+	.byte	0xa
+	.long	.LASF2150
+	.byte	0x1
+	.long	.LASF2151
+	.byte	0x1
+	.long	.LASF2152
+	.byte	0x2
+	.long	.LASF2153
+	.byte	0x3
+	.long	.LASF2154
+	.byte	0x3
+	.long	.LASF2155
+	.byte	0x4
+	.long	.LASF2156
+	.byte	0x4
+	.long	.LASF2157
+	.byte	0x4
+	.long	.LASF2158
+	.byte	0x4
+	.long	.LASF2159
+	.byte	0x4
+	.long	.LASF2160
+	.byte	0x4
+	.long	.LASF2161
+	.byte	0x4
+	.long	.LASF2162
+	.byte	0x4
+	.long	.LASF2163
+	.byte	0x4
+	.long	.LASF2164
+	.byte	0x4
+	.long	.LASF2165
+	.byte	0x4
+	.long	.LASF2166
+	.byte	0x4
+	.long	.LASF2167
+	.byte	0x4
+	.long	.LASF2160
+	.byte	0x7
+	.long	.LASF2168
+	.byte	0x8
+	.long	.LASF2169
+	.byte	0x8
+	.long	.LASF2170
+	.byte	0x8
+	.long	.LASF2171
+	.byte	0x8
+	.long	.LASF2172
+	.byte	0x8
+	.long	.LASF2173
+	.byte	0x8
+	.long	.LASF2174
+	.byte	0x8
+	.long	.LASF2175
+	.byte	0x8
+	.long	.LASF2176
+	.byte	0x8
+	.long	.LASF2157
+	.byte	0x8
+	.long	.LASF2177
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1620:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF800:
+	.string	"__ldiv_t_defined 1"
+.LASF1376:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1659:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1256:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1539:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1450:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1396:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1387:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1730:
+	.string	"BINDPLUG_PIN NONE"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1732:
+	.string	"RSSI_ADC_SAMPLE_COUNT 16"
+.LASF1949:
+	.string	"rcInterpolationChannels"
+.LASF1267:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF730:
+	.string	"_WCHAR_T_DEFINED "
+.LASF952:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1421:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF2019:
+	.string	"getRxChannelCount"
+.LASF1896:
+	.string	"BOXBLACKBOXPROFILE"
+.LASF919:
+	.string	"USE_CLI "
+.LASF1837:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1085:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2007:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF1351:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF996:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1160:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1006:
+	.string	"USE_PPM"
+.LASF1818:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF827:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF925:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1265:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1523:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"USE_FAKE_GYRO "
+.LASF1096:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF815:
+	.string	"__pid_t_defined "
+.LASF826:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1128:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2023:
+	.string	"calculateNonDataDrivenChannel"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF748:
+	.string	"WNOWAIT 0x01000000"
+.LASF1008:
+	.string	"SERIAL_RX"
+.LASF1033:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1892:
+	.string	"BOXCAMERA1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1738:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1524:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1767:
+	.string	"_Bool"
+.LASF1940:
+	.string	"spektrum_sat_bind"
+.LASF1322:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1629:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF997:
+	.string	"USE_UART8 "
+.LASF1123:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF1469:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF967:
+	.string	"SKIP_IMU_CALC "
+.LASF986:
+	.string	"USE_FLASHFS "
+.LASF1103:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF971:
+	.string	"U_ID_2 2"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1999:
+	.string	"currentTimeUs"
+.LASF947:
+	.string	"TELEMETRY_SRXL "
+.LASF811:
+	.string	"__mode_t_defined "
+.LASF1779:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1611:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1484:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1584:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1662:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1429:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1245:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1719:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1547:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1976:
+	.string	"needRxSignalMaxDelayUs"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1252:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF722:
+	.string	"__WCHAR_T__ "
+.LASF1944:
+	.string	"rssi_invert"
+.LASF742:
+	.string	"_STDLIB_H 1"
+.LASF1058:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1616:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1191:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1375:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1183:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1455:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1588:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1534:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1147:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1922:
+	.string	"step"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1623:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1978:
+	.string	"skipRxSamples"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1827:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1749:
+	.string	"uint16_t"
+.LASF838:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1220:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1168:
+	.string	"PG_RX_CONFIG 24"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1555:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1399:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"TELEMETRY_HOTT "
+.LASF921:
+	.string	"USE_CLI_BATCH "
+.LASF1638:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1522:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1061:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1043:
+	.string	"_T_PTRDIFF_ "
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1468:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1683:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1498:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1000:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1316:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1367:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1711:
+	.string	"RC_CHANNEL_FLIP RC_SPI_AUX2"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1982:
+	.string	"rcSampleIndex"
+.LASF1187:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF812:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2032:
+	.string	"frameStatus"
+.LASF1983:
+	.string	"rxConfig_Registry"
+.LASF721:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1275:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1640:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1579:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1088:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1882:
+	.string	"BOXSONAR"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF795:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1358:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2004:
+	.string	"parseRcChannels"
+.LASF941:
+	.string	"CMS "
+.LASF1587:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1480:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1543:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1615:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1783:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1802:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1680:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1283:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF954:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1115:
+	.string	"BIT(x) (1 << (x))"
+.LASF1807:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1235:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1342:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"RC_CHANNEL_RATE RC_SPI_AUX1"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1442:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1014:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1077:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF855:
+	.string	"_SYS_SELECT_H 1"
+.LASF1747:
+	.string	"int32_t"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF867:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1566:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1083:
+	.string	"FAST_MATH "
+.LASF984:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1903:
+	.string	"channelRange_t"
+.LASF910:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF863:
+	.string	"__timeval_defined 1"
+.LASF1815:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF1537:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1254:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2000:
+	.string	"updateRSSIADC"
+.LASF1962:
+	.string	"rxRefreshRate"
+.LASF1966:
+	.string	"rxRuntimeConfig_t"
+.LASF1307:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1237:
+	.string	"RX_SPI_MAX_PAYLOAD_SIZE 32"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1021:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF840:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1702:
+	.string	"SRXL_FRAME_OVERHEAD 5"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1804:
+	.string	"OWNER_BARO_EXTI"
+.LASF1164:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1991:
+	.string	"scaleRange"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF779:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1644:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1007:
+	.string	"USE_PWM"
+.LASF1402:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1782:
+	.string	"OWNER_SERIAL_TX"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1865:
+	.string	"BOXMAG"
+.LASF1107:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1184:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF953:
+	.string	"USE_SENSOR_NAMES "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1436:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2015:
+	.string	"readRxChannelsApplyRanges"
+.LASF1198:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1758:
+	.string	"PGR_SIZE_MASK"
+.LASF1907:
+	.string	"range"
+.LASF1987:
+	.string	"failsafeOnValidDataFailed"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1259:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1753:
+	.string	"double"
+.LASF850:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1001:
+	.string	"STACK_CHECK"
+.LASF842:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF851:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1630:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF859:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1825:
+	.string	"FEATURE_FAILSAFE"
+.LASF1636:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF2011:
+	.string	"currentMilliTime"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF948:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1986:
+	.string	"validFlightChannelMask"
+.LASF1517:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1092:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1329:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1875:
+	.string	"BOXLEDLOW"
+.LASF1930:
+	.string	"rxConfig_s"
+.LASF1956:
+	.string	"rxConfig_t"
+.LASF1805:
+	.string	"OWNER_USB"
+.LASF2002:
+	.string	"pwmRssi"
+.LASF1408:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1216:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1918:
+	.string	"RX_FAILSAFE_MODE_SET"
+.LASF759:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1817:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF744:
+	.string	"WUNTRACED 2"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1140:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1530:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1580:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1264:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1282:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1862:
+	.string	"BOXHORIZON"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1939:
+	.string	"spektrum_bind_plug_ioTag"
+.LASF1565:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1942:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF813:
+	.string	"__uid_t_defined "
+.LASF1324:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1963:
+	.string	"rcReadRawFn"
+.LASF1499:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1445:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1423:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF756:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1346:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1829:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2025:
+	.string	"rcSamples"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1673:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_UARTDEV(x) ((x) - SERIAL_PORT_USART1 + UARTDEV_1)"
+.LASF1876:
+	.string	"BOXLLIGHTS"
+.LASF775:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1787:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1025:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1540:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF974:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1688:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1952:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1176:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1863:
+	.string	"BOXBARO"
+.LASF1131:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1775:
+	.string	"OWNER_SERVO"
+.LASF1117:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF978:
+	.string	"ACC "
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF944:
+	.string	"TELEMETRY_IBUS "
+.LASF923:
+	.string	"USE_PWM "
+.LASF1570:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF837:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF723:
+	.string	"_WCHAR_T "
+.LASF1003:
+	.string	"TELEMETRY_LTM"
+.LASF1639:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1297:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1281:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1385:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1614:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1933:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1130:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF830:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1134:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1708:
+	.string	"CRSF_PAYLOAD_SIZE_MAX 32"
+.LASF1826:
+	.string	"FEATURE_SONAR"
+.LASF905:
+	.string	"alloca"
+.LASF805:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1700:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF1049:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1945:
+	.string	"midrc"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1674:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1739:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1262:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1741:
+	.string	"__uint16_t"
+.LASF798:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1652:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1774:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2018:
+	.string	"maxChannels"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1057:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1627:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF364:
+	.string	"__k8 1"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1801:
+	.string	"OWNER_RX_SPI_CS"
+.LASF733:
+	.string	"__INT_WCHAR_T_H "
+.LASF1124:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1641:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1660:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1637:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1063:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF856:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1838:
+	.string	"FEATURE_AIRMODE"
+.LASF1935:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1921:
+	.string	"mode"
+.LASF1508:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1343:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1583:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF769:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1082:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1382:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1712:
+	.string	"RC_CHANNEL_PICTURE RC_SPI_AUX3"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1658:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF2045:
+	.string	"valid"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1075:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1689:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF794:
+	.string	"__f32x(x) x ##f32x"
+.LASF1776:
+	.string	"OWNER_LED"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1707:
+	.string	"CRSF_MAX_CHANNEL 16"
+.LASF1102:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1448:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF968:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1221:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1394:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1601:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1266:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1733:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF810:
+	.string	"__gid_t_defined "
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1821:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1992:
+	.string	"failsafeOnRxResume"
+.LASF1934:
+	.string	"halfDuplex"
+.LASF1231:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1234:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1132:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1435:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1050:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1472:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF962:
+	.string	"USE_NAV "
+.LASF1177:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1489:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1936:
+	.string	"rx_spi_id"
+.LASF1301:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF976:
+	.string	"USE_FAKE_LED "
+.LASF1647:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1993:
+	.string	"failsafeOnRxSuspend"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1155:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1288:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF1860:
+	.string	"BOXARM"
+.LASF379:
+	.string	"linux 1"
+.LASF1951:
+	.string	"fpvCamAngleDegrees"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1055:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1378:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1820:
+	.string	"FEATURE_RX_SERIAL"
+.LASF980:
+	.string	"GYRO "
+.LASF1946:
+	.string	"mincheck"
+.LASF1211:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1723:
+	.string	"RX_SPI_DEFAULT_PROTOCOL 0"
+.LASF2026:
+	.string	"rcDataMean"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1354:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1243:
+	.string	"IOCFG_OUT_OD 0"
+.LASF891:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF945:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1042:
+	.string	"_PTRDIFF_T "
+.LASF1877:
+	.string	"BOXCALIB"
+.LASF1899:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF835:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1823:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1062:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1070:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF2037:
+	.string	"calculateChannelRemapping"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1873:
+	.string	"BOXBEEPERON"
+.LASF853:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF940:
+	.string	"USE_SERVOS "
+.LASF1335:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1596:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1813:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1928:
+	.string	"rxChannelRangeConfigs_SystemArray"
+.LASF934:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2029:
+	.string	"sampleIndex"
+.LASF1848:
+	.string	"AUX1"
+.LASF1849:
+	.string	"AUX2"
+.LASF758:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1851:
+	.string	"AUX4"
+.LASF1065:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1853:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1855:
+	.string	"AUX8"
+.LASF1222:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1162:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1844:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2062:
+	.string	"high"
+.LASF1947:
+	.string	"maxcheck"
+.LASF820:
+	.string	"__clock_t_defined 1"
+.LASF1369:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1845:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF729:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF931:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1076:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1988:
+	.string	"failsafeOnValidDataReceived"
+.LASF1068:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF1796:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1586:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF866:
+	.string	"__NFDBITS"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1111:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF761:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1144:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF1686:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1471:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1285:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1230:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1979:
+	.string	"rcRaw"
+.LASF823:
+	.string	"__timer_t_defined 1"
+.LASF857:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF1397:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1756:
+	.string	"PGR_PGN_MASK"
+.LASF1883:
+	.string	"BOXSERVO1"
+.LASF1884:
+	.string	"BOXSERVO2"
+.LASF1885:
+	.string	"BOXSERVO3"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1080:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF731:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1840:
+	.string	"FEATURE_RX_SPI"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF861:
+	.string	"____sigset_t_defined "
+.LASF964:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF825:
+	.string	"_ENDIAN_H 1"
+.LASF1606:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1535:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF973:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF2003:
+	.string	"updateRSSI"
+.LASF1182:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF398:
+	.string	"false 0"
+.LASF1633:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1618:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1192:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2033:
+	.string	"resumeRxSignal"
+.LASF1218:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1642:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1577:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1582:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF841:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1303:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1769:
+	.string	"timeMs_t"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF2056:
+	.string	"pgResetFn_rxChannelRangeConfigs"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF894:
+	.string	"__ONCE_ALIGNMENT "
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1692:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1806:
+	.string	"OWNER_USB_DETECT"
+.LASF752:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1038:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1240:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1761:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1597:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF877:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF824:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1315:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1202:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1917:
+	.string	"RX_FAILSAFE_MODE_HOLD"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1955:
+	.string	"rx_max_usec"
+.LASF847:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF972:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1327:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1112:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1037:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2022:
+	.string	"channelFailsafeConfig"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF781:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1833:
+	.string	"FEATURE_DASHBOARD"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1697:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1717:
+	.string	"PPM_AND_PWM_SAMPLE_COUNT 3"
+.LASF1810:
+	.string	"OWNER_INVERTER"
+.LASF1023:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1684:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF836:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1791:
+	.string	"OWNER_SPI_MOSI"
+.LASF1589:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1760:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1748:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1578:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF895:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1109:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1125:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF1998:
+	.string	"rxGetRefreshRate"
+.LASF1418:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"TELEMETRY "
+.LASF1425:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1196:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1846:
+	.string	"PITCH"
+.LASF1460:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"VERY_FAST_MATH "
+.LASF1612:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"USE_ADC"
+.LASF809:
+	.string	"__dev_t_defined "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF987:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF734:
+	.string	"_GCC_WCHAR_T "
+.LASF1113:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1880:
+	.string	"BOXTELEMETRY"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1019:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF763:
+	.string	"__WCOREFLAG 0x80"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1528:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1898:
+	.string	"boxId_e"
+.LASF1441:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF699:
+	.string	"__need_size_t "
+.LASF1373:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1819:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF896:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1466:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1022:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF737:
+	.string	"_BSD_WCHAR_T_"
+.LASF2059:
+	.string	"_index"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF777:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1649:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1005:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2047:
+	.string	"pulseDuration"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1714:
+	.string	"RC_CHANNEL_HEADLESS RC_SPI_AUX5"
+.LASF1720:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1773:
+	.string	"OWNER_PPMINPUT"
+.LASF1766:
+	.string	"ioTag_t"
+.LASF1895:
+	.string	"BOXDSHOTREVERSE"
+.LASF1052:
+	.string	"__need_ptrdiff_t"
+.LASF839:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF913:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1069:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1602:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1180:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1039:
+	.string	"_STDDEF_H "
+.LASF1545:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF983:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1552:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1286:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1542:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1560:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1634:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF920:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2035:
+	.string	"rxAreFlightChannelsValid"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1409:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1675:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1970:
+	.string	"rxSignalReceivedNotDataDriven"
+.LASF1206:
+	.string	"PG_OSD_CONFIG 501"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1943:
+	.string	"rssi_scale"
+.LASF1170:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1372:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1137:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1175:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF858:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1336:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1967:
+	.string	"rxRuntimeConfig"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF778:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF828:
+	.string	"__BIG_ENDIAN 4321"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1507:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1891:
+	.string	"BOXBLACKBOXERASE"
+.LASF1087:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1624:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1188:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1219:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1016:
+	.string	"LED_STRIP"
+.LASF1519:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF916:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2058:
+	.string	"pgResetFn_rxConfig"
+.LASF776:
+	.string	"__f128(x) x ##f128"
+.LASF879:
+	.string	"__fsblkcnt_t_defined "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1564:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF834:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1948:
+	.string	"rcInterpolation"
+.LASF1097:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1289:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1384:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1889:
+	.string	"BOX3DDISABLE"
+.LASF1233:
+	.string	"IO_TAG_NONE 0"
+.LASF1013:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1430:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2043:
+	.string	"value"
+.LASF1836:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF880:
+	.string	"__fsfilcnt_t_defined "
+.LASF743:
+	.string	"WNOHANG 1"
+.LASF1300:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF936:
+	.string	"TELEMETRY_FRSKY "
+.LASF1900:
+	.string	"channelRange_s"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1506:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1217:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1126:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF1567:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1786:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1762:
+	.string	"address"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF1110:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1558:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1444:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1504:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1390:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1645:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1012:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF821:
+	.string	"__clockid_t_defined 1"
+.LASF1247:
+	.string	"IOCFG_IPU 0"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF745:
+	.string	"WSTOPPED 2"
+.LASF739:
+	.string	"NULL"
+.LASF1665:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2046:
+	.string	"isPulseValid"
+.LASF903:
+	.string	"__have_pthread_attr_t 1"
+.LASF746:
+	.string	"WEXITED 4"
+.LASF1788:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2012:
+	.string	"channel"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1193:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1345:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF1269:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF735:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF966:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF893:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1859:
+	.string	"RC_SMOOTHING_MANUAL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1249:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1593:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF965:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF755:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1603:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"I2C2_OVERCLOCK true"
+.LASF870:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2041:
+	.string	"rxInit"
+.LASF1488:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1433:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1718:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1759:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF774:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1152:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1598:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF846:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1778:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1562:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF747:
+	.string	"WCONTINUED 8"
+.LASF1268:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1366:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1073:
+	.string	"UNIT_TESTED "
+.LASF1995:
+	.string	"feature"
+.LASF1151:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1857:
+	.string	"RC_SMOOTHING_DEFAULT"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1487:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1841:
+	.string	"FEATURE_SOFTSPI"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1143:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1064:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2063:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1657:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF790:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2008:
+	.string	"detectAndApplySignalLossBehaviour"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1135:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF912:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF932:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1287:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1227:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1298:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1709:
+	.string	"CRSF_FRAME_SIZE_MAX (CRSF_PAYLOAD_SIZE_MAX + 4)"
+.LASF1400:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1576:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF928:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF865:
+	.string	"__suseconds_t_defined "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1393:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF882:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1958:
+	.string	"rxConfig_Copy"
+.LASF874:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1705:
+	.string	"CRSF_PORT_OPTIONS (SERIAL_STOPBITS_1 | SERIAL_PARITY_NO)"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1146:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1549:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"rawChannel"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF741:
+	.string	"__need_NULL"
+.LASF1053:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1726:
+	.string	"RX_MIN_USEC 885"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1481:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF922:
+	.string	"USE_PPM "
+.LASF1318:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1278:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1772:
+	.string	"OWNER_PWMINPUT"
+.LASF1129:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1009:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1255:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1653:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF989:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1169:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1420:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1764:
+	.string	"reset"
+.LASF1018:
+	.string	"TELEMETRY_HOTT"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1752:
+	.string	"long long unsigned int"
+.LASF1153:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1091:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1969:
+	.string	"rxSignalReceived"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1099:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1032:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1794:
+	.string	"OWNER_SDCARD"
+.LASF908:
+	.string	"_STRING_H 1"
+.LASF1521:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1607:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1078:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1746:
+	.string	"int16_t"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF1974:
+	.string	"rxUpdateAt"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1734:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1737:
+	.string	"signed char"
+.LASF791:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1904:
+	.string	"modeActivationCondition_s"
+.LASF1908:
+	.string	"modeActivationCondition_t"
+.LASF702:
+	.string	"__size_t__ "
+.LASF938:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF939:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1604:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1490:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1550:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1161:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1190:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF822:
+	.string	"__time_t_defined 1"
+.LASF849:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF873:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1831:
+	.string	"FEATURE_RSSI_ADC"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1081:
+	.string	"sq(x) ((x)*(x))"
+.LASF1478:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1703:
+	.string	"SRXL_FRAME_SIZE_MAX (SPEK_FRAME_SIZE + SRXL_FRAME_OVERHEAD)"
+.LASF1513:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"VTX_TRAMP"
+.LASF902:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF793:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1531:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1002:
+	.string	"USE_DASHBOARD"
+.LASF963:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1784:
+	.string	"OWNER_PINDEBUG"
+.LASF1361:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1868:
+	.string	"BOXCAMSTAB"
+.LASF751:
+	.string	"__WCLONE 0x80000000"
+.LASF1248:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1646:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF876:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1981:
+	.string	"rcInvalidPulsPeriod"
+.LASF767:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF960:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1034:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1980:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1456:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1888:
+	.string	"BOXAIRMODE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1932:
+	.string	"serialrx_provider"
+.LASF1035:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1173:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1379:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"needRxSignalBefore"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1145:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1551:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF933:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1041:
+	.string	"_ANSI_STDDEF_H "
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1957:
+	.string	"rxConfig_System"
+.LASF1228:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1808:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF2050:
+	.string	"nullFrameStatus"
+.LASF1310:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1491:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2005:
+	.string	"input"
+.LASF1757:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1571:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1212:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1866:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1273:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1919:
+	.string	"RX_FAILSAFE_MODE_INVALID"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF926:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1253:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF819:
+	.string	"__key_t_defined "
+.LASF1856:
+	.string	"RC_SMOOTHING_OFF"
+.LASF957:
+	.string	"VTX_SMARTAUDIO "
+.LASF1120:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1643:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1909:
+	.string	"RX_FRAME_PENDING"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF844:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1474:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1728:
+	.string	"RX_MID_USEC 1500"
+.LASF833:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1548:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF2040:
+	.string	"channelToRemap"
+.LASF1663:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1279:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1477:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1834:
+	.string	"FEATURE_OSD"
+.LASF1677:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1763:
+	.string	"copy"
+.LASF961:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1156:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1706:
+	.string	"CRSF_PORT_MODE MODE_RXTX"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1027:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1292:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1260:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1172:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1553:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1744:
+	.string	"long int"
+.LASF1893:
+	.string	"BOXCAMERA2"
+.LASF1894:
+	.string	"BOXCAMERA3"
+.LASF1165:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2010:
+	.string	"rxIsDataDriven"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1271:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1093:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1911:
+	.string	"RX_FRAME_FAILSAFE"
+.LASF1650:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1594:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1364:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1879:
+	.string	"BOXOSD"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF943:
+	.string	"TELEMETRY_CRSF "
+.LASF1046:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1223:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1321:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1977:
+	.string	"suspendRxSignalUntil"
+.LASF1334:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"__PTRDIFF_T "
+.LASF864:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF804:
+	.string	"EXIT_SUCCESS 0"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1667:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1459:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2039:
+	.string	"channelMapEntryCount"
+.LASF1405:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1554:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1291:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1108:
+	.string	"EXPAND_I(x) x"
+.LASF1453:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1020:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1750:
+	.string	"uint32_t"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1568:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1605:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1864:
+	.string	"BOXANTIGRAVITY"
+.LASF796:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1914:
+	.string	"rcChannelLetters"
+.LASF2017:
+	.string	"maxChannelsAllowed"
+.LASF1325:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1693:
+	.string	"RX_MAPPABLE_CHANNEL_COUNT 8"
+.LASF1527:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1997:
+	.string	"millis"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1871:
+	.string	"BOXGPSHOLD"
+.LASF797:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF868:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1089:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1209:
+	.string	"PG_PID_CONFIG 504"
+.LASF736:
+	.string	"__DEFINED_wchar_t "
+.LASF1538:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF491:
+	.string	"__flexarr []"
+.LASF799:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF907:
+	.string	"__COMPAR_FN_T "
+.LASF1017:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1867:
+	.string	"BOXHEADADJ"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF862:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF724:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1148:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF1960:
+	.string	"rxRuntimeConfig_s"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2054:
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF802:
+	.string	"RAND_MAX 2147483647"
+.LASF1870:
+	.string	"BOXGPSHOME"
+.LASF1785:
+	.string	"OWNER_TIMER"
+.LASF1348:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1189:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1670:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF1965:
+	.string	"rcFrameStatusFnPtr"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2060:
+	.string	"modeActivationConditions"
+.LASF1526:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1556:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1502:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1105:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1388:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1561:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1704:
+	.string	"CRSF_BAUDRATE 420000"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1916:
+	.string	"RX_FAILSAFE_MODE_AUTO"
+.LASF1590:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2024:
+	.string	"chan"
+.LASF959:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1745:
+	.string	"char"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1971:
+	.string	"rxFlightChannelsValid"
+.LASF1679:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1632:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF1485:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF1696:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1483:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1244:
+	.string	"IOCFG_AF_PP 0"
+.LASF1968:
+	.string	"rxDataReceived"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1313:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1902:
+	.string	"endStep"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1874:
+	.string	"BOXLEDMAX"
+.LASF1886:
+	.string	"BOXBLACKBOX"
+.LASF991:
+	.string	"USE_UART2 "
+.LASF852:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1142:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1557:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2052:
+	.string	"resetAllRxChannelRangeConfigurations"
+.LASF1232:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1432:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2044:
+	.string	"rxUpdateFlightChannelStatus"
+.LASF1887:
+	.string	"BOXFAILSAFE"
+.LASF1015:
+	.string	"USE_SERIALRX_XBUS"
+.LASF951:
+	.string	"USE_RX_MSP "
+.LASF1462:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1101:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1370:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1661:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1824:
+	.string	"FEATURE_GPS"
+.LASF1682:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1619:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1238:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1685:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1913:
+	.string	"rssi"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF780:
+	.string	"__HAVE_FLOAT32 1"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF2027:
+	.string	"rxSamplesCollected"
+.LASF2038:
+	.string	"channelMap"
+.LASF914:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1079:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1881:
+	.string	"BOXGTUNE"
+.LASF1181:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2020:
+	.string	"applyRxChannelRangeConfiguraton"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF740:
+	.string	"NULL ((void *)0)"
+.LASF1797:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1060:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1106:
+	.string	"STR_HELPER(x) #x"
+.LASF901:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1414:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1822:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1186:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1029:
+	.string	"VTX_SMARTAUDIO"
+.LASF927:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1789:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF950:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1781:
+	.string	"OWNER_ADC_RSSI"
+.LASF1071:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1651:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1525:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1011:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1424:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"USE_FAKE_BARO "
+.LASF860:
+	.string	"__sigset_t_defined 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1920:
+	.string	"rxFailsafeChannelConfig_s"
+.LASF1923:
+	.string	"rxFailsafeChannelConfig_t"
+.LASF1861:
+	.string	"BOXANGLE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1463:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF738:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1915:
+	.string	"rcData"
+.LASF1044:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF814:
+	.string	"__off_t_defined "
+.LASF1495:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1792:
+	.string	"OWNER_I2C_SCL"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2048:
+	.string	"isRxDataDriven"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF979:
+	.string	"USE_FAKE_ACC "
+.LASF1224:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF377:
+	.string	"__linux 1"
+.LASF1569:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1905:
+	.string	"modeId"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1391:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1451:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1337:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF788:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF816:
+	.string	"__id_t_defined "
+.LASF1412:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1465:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2014:
+	.string	"validPulse"
+.LASF899:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF760:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1415:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1600:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1725:
+	.string	"SERIALRX_PROVIDER 0"
+.LASF1546:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1284:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF898:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1533:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1608:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1622:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"__daddr_t_defined "
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1669:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF750:
+	.string	"__WALL 0x40000000"
+.LASF2051:
+	.string	"nullReadRawRC"
+.LASF1847:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF831:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1500:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF845:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1138:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1411:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1357:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1139:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF762:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1201:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF917:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1339:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1210:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1516:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF806:
+	.string	"_SYS_TYPES_H 1"
+.LASF2036:
+	.string	"rxIsReceivingSignal"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF848:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF2028:
+	.string	"currentSampleIndex"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF829:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1790:
+	.string	"OWNER_SPI_MISO"
+.LASF1277:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1814:
+	.string	"OWNER_COMPASS_CS"
+.LASF727:
+	.string	"_WCHAR_T_ "
+.LASF1666:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1119:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1427:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1901:
+	.string	"startStep"
+.LASF1149:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1830:
+	.string	"FEATURE_RX_MSP"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1926:
+	.string	"rxChannelRangeConfig_s"
+.LASF1927:
+	.string	"rxChannelRangeConfig_t"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1950:
+	.string	"rcInterpolationInterval"
+.LASF728:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2064:
+	.string	"rc_alias"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF801:
+	.string	"__lldiv_t_defined 1"
+.LASF1591:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1067:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1226:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1897:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1742:
+	.string	"__int32_t"
+.LASF2006:
+	.string	"rxConfig"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1793:
+	.string	"OWNER_I2C_SDA"
+.LASF1698:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1878:
+	.string	"BOXGOV"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF757:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1529:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1832:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1166:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1095:
+	.string	"Q12 (1 << 12)"
+.LASF1731:
+	.string	"REQUIRED_CHANNEL_MASK 0x0F"
+.LASF1990:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1839:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1024:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1574:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1768:
+	.string	"timeDelta_t"
+.LASF1333:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1270:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1609:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1174:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1133:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF988:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF700:
+	.string	"__need_wchar_t "
+.LASF1664:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1454:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF878:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF749:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF725:
+	.string	"_T_WCHAR "
+.LASF1114:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1520:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF1691:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1512:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF949:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF942:
+	.string	"TELEMETRY_LTM "
+.LASF1040:
+	.string	"_STDDEF_H_ "
+.LASF1258:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1276:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1625:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1626:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1681:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1610:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1727:
+	.string	"RX_MAX_USEC 2115"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1171:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF904:
+	.string	"_ALLOCA_H 1"
+.LASF1229:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1809:
+	.string	"OWNER_RX_BIND"
+.LASF1200:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF956:
+	.string	"VTX_CONTROL "
+.LASF1850:
+	.string	"AUX3"
+.LASF1514:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"OWNER_TRANSPONDER"
+.LASF1167:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1852:
+	.string	"AUX5"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1854:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF732:
+	.string	"___int_wchar_t_h "
+.LASF1360:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1026:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1306:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1938:
+	.string	"spektrum_bind_pin_override_ioTag"
+.LASF1426:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"__f32(x) x ##f32"
+.LASF1047:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF726:
+	.string	"__WCHAR_T "
+.LASF1729:
+	.string	"SPEKTRUM_BIND_PIN NONE"
+.LASF1127:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1518:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1961:
+	.string	"channelCount"
+.LASF1486:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF807:
+	.string	"__u_char_defined "
+.LASF1890:
+	.string	"BOXFPVANGLEMIX"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1699:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF869:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1715:
+	.string	"RC_CHANNEL_RTH RC_SPI_AUX6"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1116:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1770:
+	.string	"timeUs_t"
+.LASF970:
+	.string	"U_ID_1 1"
+.LASF969:
+	.string	"U_ID_0 0"
+.LASF808:
+	.string	"__ino_t_defined "
+.LASF1203:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1510:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1799:
+	.string	"OWNER_MPU_CS"
+.LASF1755:
+	.string	"pgn_t"
+.LASF1214:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1910:
+	.string	"RX_FRAME_COMPLETE"
+.LASF772:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1676:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1573:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1031:
+	.string	"USE_I2C"
+.LASF1754:
+	.string	"float"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2031:
+	.string	"currentDeltaTime"
+.LASF2013:
+	.string	"sample"
+.LASF982:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1511:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1163:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1713:
+	.string	"RC_CHANNEL_VIDEO RC_SPI_AUX4"
+.LASF1515:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1592:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1701:
+	.string	"SPEK_FRAME_SIZE 16"
+.LASF1575:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1668:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1056:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1631:
+	.string	"I2CDEV_COUNT 4"
+.LASF1150:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF753:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1090:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1973:
+	.string	"rxIsInFailsafeModeNotDataDriven"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1122:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1906:
+	.string	"auxChannelIndex"
+.LASF929:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1438:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1925:
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+.LASF1403:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1972:
+	.string	"rxIsInFailsafeMode"
+.LASF1207:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1104:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1771:
+	.string	"OWNER_FREE"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF770:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF911:
+	.string	"_STRINGS_H 1"
+.LASF1417:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1672:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1912:
+	.string	"modeActivationConditions_SystemArray"
+.LASF817:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1954:
+	.string	"rx_min_usec"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF875:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1328:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1937:
+	.string	"rx_spi_rf_channel_count"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF789:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1381:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2057:
+	.string	"rxChannelRangeConfigs"
+.LASF1331:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1656:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1072:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2001:
+	.string	"updateRSSIPWM"
+.LASF883:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1363:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF906:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1036:
+	.string	"DEFIO_NO_PORTS "
+.LASF1309:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"rxResetFlightChannelStatus"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1671:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1048:
+	.string	"___int_ptrdiff_t_h "
+.LASF1989:
+	.string	"strchr"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1716:
+	.string	"MAX_INVALID_PULS_TIME 300"
+.LASF1721:
+	.string	"SKIP_RC_ON_SUSPEND_PERIOD 1500000"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1635:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1924:
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+.LASF1613:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1010:
+	.string	"USE_SERIALRX_IBUS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2034:
+	.string	"suspendRxSignal"
+.LASF946:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF872:
+	.string	"NFDBITS __NFDBITS"
+.LASF1751:
+	.string	"long long int"
+.LASF1501:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1984:
+	.string	"rxChannelRangeConfigs_Registry"
+.LASF1242:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1695:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1828:
+	.string	"FEATURE_3D"
+.LASF803:
+	.string	"EXIT_FAILURE 1"
+.LASF2049:
+	.string	"rxHaveValidFlightChannels"
+.LASF1154:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1795:
+	.string	"OWNER_SDCARD_CS"
+.LASF764:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1074:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1536:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1094:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1931:
+	.string	"rcmap"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1274:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1272:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1257:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF897:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2053:
+	.string	"rxChannelRangeConfig"
+.LASF990:
+	.string	"USE_UART1 "
+.LASF754:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1964:
+	.string	"rcFrameStatusFn"
+.LASF1595:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1194:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1541:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1724:
+	.string	"SBUS_INVERSION_DEFAULT 1"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1929:
+	.string	"rxChannelRangeConfigs_CopyArray"
+.LASF1509:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1319:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1059:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1215:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1816:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1492:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF998:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF900:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF930:
+	.string	"USE_SERIALRX_SUMH "
+.LASF765:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1352:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"long unsigned int"
+.LASF1250:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1811:
+	.string	"OWNER_LED_STRIP"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1098:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF955:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF958:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1722:
+	.string	"SKIP_RC_SAMPLES_ON_RESUME 2"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1985:
+	.string	"rxFailsafeChannelConfigs_Registry"
+.LASF1687:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1694:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1028:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF909:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1617:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1158:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1185:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2030:
+	.string	"rxUpdateCheck"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2042:
+	.string	"modeActivationCondition"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF992:
+	.string	"USE_UART3 "
+.LASF924:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1497:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1312:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1678:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2009:
+	.string	"useValueFromRx"
+.LASF975:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1136:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1251:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1798:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1197:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1205:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1118:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1086:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1953:
+	.string	"airModeActivateThreshold"
+.LASF1735:
+	.string	"unsigned int"
+.LASF993:
+	.string	"USE_UART4 "
+.LASF1208:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF854:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1628:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1621:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1532:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1690:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2021:
+	.string	"getRxfailValue"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF832:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1843:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1559:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1872:
+	.string	"BOXPASSTHRU"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1213:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1496:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1777:
+	.string	"OWNER_ADC"
+.LASF1740:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1803:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1765:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1581:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1959:
+	.string	"rcReadRawDataFnPtr"
+.LASF1869:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF994:
+	.string	"USE_UART5 "
+.LASF1544:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1835:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF871:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1159:
+	.string	"PG_PID_PROFILE 14"
+.LASF1295:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1780:
+	.string	"OWNER_ADC_EXT"
+.LASF1599:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1204:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1996:
+	.string	"micros"
+.LASF2055:
+	.string	"rxFailsafeChannelConfigs"
+.LASF1066:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1800:
+	.string	"OWNER_OSD_CS"
+.LASF2061:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1585:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1051:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1141:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF768:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1355:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1261:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1246:
+	.string	"IOCFG_IPD 0"
+.LASF1858:
+	.string	"RC_SMOOTHING_AUTO"
+.LASF995:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1994:
+	.string	"rxMspInit"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2156:
+	.string	"rx_pwm.h"
+.LASF2136:
+	.string	"thread-shared-types.h"
+.LASF2079:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2081:
+	.string	"/usr/include"
+.LASF2127:
+	.string	"endianness.h"
+.LASF2130:
+	.string	"select.h"
+.LASF2121:
+	.string	"floatn-common.h"
+.LASF2103:
+	.string	"stdint.h"
+.LASF2066:
+	.string	"src/main/build"
+.LASF2078:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2102:
+	.string	"stdbool.h"
+.LASF2158:
+	.string	"flash.h"
+.LASF2088:
+	.string	"time.h"
+.LASF2142:
+	.string	"stdlib-bsearch.h"
+.LASF2074:
+	.string	"src/main/target/SITL"
+.LASF2135:
+	.string	"pthreadtypes.h"
+.LASF2166:
+	.string	"sound_beeper.h"
+.LASF2174:
+	.string	"ibus.h"
+.LASF2077:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2104:
+	.string	"libc-header-start.h"
+.LASF2125:
+	.string	"timer_t.h"
+.LASF2096:
+	.string	"failsafe.h"
+.LASF2147:
+	.string	"platform.h"
+.LASF2082:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2177:
+	.string	"targetcustomserial.h"
+.LASF2089:
+	.string	"resource.h"
+.LASF2071:
+	.string	"src/main/flight"
+.LASF2123:
+	.string	"clockid_t.h"
+.LASF2175:
+	.string	"jetiexbus.h"
+.LASF2151:
+	.string	"debug.h"
+.LASF2101:
+	.string	"stdc-predef.h"
+.LASF2159:
+	.string	"sdcard.h"
+.LASF2126:
+	.string	"endian.h"
+.LASF2162:
+	.string	"io_def.h"
+.LASF2105:
+	.string	"features.h"
+.LASF2152:
+	.string	"utils.h"
+.LASF2164:
+	.string	"bus_i2c.h"
+.LASF2072:
+	.string	"src/main/io"
+.LASF2114:
+	.string	"time64.h"
+.LASF2107:
+	.string	"wordsize.h"
+.LASF2068:
+	.string	"src/main/config"
+.LASF2106:
+	.string	"features-time64.h"
+.LASF2146:
+	.string	"strings.h"
+.LASF2100:
+	.string	"feature.h"
+.LASF2140:
+	.string	"struct_rwlock.h"
+.LASF2128:
+	.string	"byteswap.h"
+.LASF2090:
+	.string	"config.h"
+.LASF2111:
+	.string	"stubs.h"
+.LASF2118:
+	.string	"waitflags.h"
+.LASF2095:
+	.string	"target.h"
+.LASF2172:
+	.string	"sumh.h"
+.LASF2112:
+	.string	"stubs-64.h"
+.LASF2148:
+	.string	"common_fc_pre.h"
+.LASF2098:
+	.string	"maths.h"
+.LASF2119:
+	.string	"waitstatus.h"
+.LASF2154:
+	.string	"parameter_group_ids.h"
+.LASF2115:
+	.string	"wchar.h"
+.LASF2094:
+	.string	"rx.c"
+.LASF2067:
+	.string	"src/main/common"
+.LASF2093:
+	.string	"rx.h"
+.LASF2080:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2169:
+	.string	"sbus.h"
+.LASF2165:
+	.string	"rcc_types.h"
+.LASF2124:
+	.string	"time_t.h"
+.LASF2117:
+	.string	"stddef.h"
+.LASF2070:
+	.string	"src/main/fc"
+.LASF2120:
+	.string	"floatn.h"
+.LASF2108:
+	.string	"timesize.h"
+.LASF0:
+	.string	"./src/main/rx/rx.c"
+.LASF2138:
+	.string	"atomic_wide_counter.h"
+.LASF2161:
+	.string	"io.h"
+.LASF2086:
+	.string	"parameter_group.h"
+.LASF2153:
+	.string	"config_reset.h"
+.LASF2173:
+	.string	"xbus.h"
+.LASF2163:
+	.string	"io_def_generated.h"
+.LASF2129:
+	.string	"uintn-identity.h"
+.LASF2157:
+	.string	"rx_spi.h"
+.LASF2167:
+	.string	"vcd.h"
+.LASF2092:
+	.string	"rc_modes.h"
+.LASF2085:
+	.string	"stdint-uintn.h"
+.LASF2122:
+	.string	"clock_t.h"
+.LASF2155:
+	.string	"adc.h"
+.LASF2110:
+	.string	"long-double.h"
+.LASF2091:
+	.string	"rc_controls.h"
+.LASF2109:
+	.string	"cdefs.h"
+.LASF2170:
+	.string	"spektrum.h"
+.LASF2073:
+	.string	"src/main/rx"
+.LASF2113:
+	.string	"typesizes.h"
+.LASF2099:
+	.string	"msp.h"
+.LASF2168:
+	.string	"pwm.h"
+.LASF2176:
+	.string	"crsf.h"
+.LASF2149:
+	.string	"common_fc_post.h"
+.LASF2144:
+	.string	"locale_t.h"
+.LASF2075:
+	.string	"src/main/target"
+.LASF2069:
+	.string	"src/main/drivers"
+.LASF2131:
+	.string	"sigset_t.h"
+.LASF2160:
+	.string	"serial.h"
+.LASF2143:
+	.string	"stdlib-float.h"
+.LASF2116:
+	.string	"stdlib.h"
+.LASF2134:
+	.string	"struct_timespec.h"
+.LASF2150:
+	.string	"build_config.h"
+.LASF2133:
+	.string	"struct_timeval.h"
+.LASF2084:
+	.string	"stdint-intn.h"
+.LASF2141:
+	.string	"alloca.h"
+.LASF2171:
+	.string	"sumd.h"
+.LASF2145:
+	.string	"__locale_t.h"
+.LASF2083:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2139:
+	.string	"struct_mutex.h"
+.LASF2076:
+	.string	"src/main"
+.LASF2097:
+	.string	"string.h"
+.LASF2137:
+	.string	"pthreadtypes-arch.h"
+.LASF2087:
+	.string	"io_types.h"
+.LASF2132:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n"
+	.string	"("
+	.text
+	.section	.gnu.lto_.icf.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`w\002]\017"
+	.string	"t\024k\003"
+	.string	"9"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\222\252\354\340\007"
+	.string	"\004\351\320\257\242\017\022\002\004\002\005\002\006\004\002\007\005\007\005\352\263\360\321\b\006\240\342\234\212\n\007\b\t\277\201\230\306\016\b\002"
+	.string	"\002\b\n\311\274\304\215\f\002\002\t\002\002\002\n\002\013\002\013\002\f\002\n\002\004\002\r\013\f\r\016\017\020\307\265\226\262\f\t\002"
+	.string	"\002\t\021\330\367\256\304\004\b\002\016\002\016\022\023\024\301\376\230\240\001D\004\002\r\002\017\002\020\025\026\027\242\302\263\302\013\030\031\032\033\034\202\234\243\220\005\035\332\322\230\254\002"
+	.string	"\036\264\370\341\227\005\037\363\356\304\374\004 \021\017\002\017\004\002\r\002\022\017\002\017 \"\350\300\306\254\005#$\376\340\327\201\004\004\002\002\002%&'\214\276\367\272\016(\235\352\316\307\f\032\017\002\017)*+,\217\300\253\210\r\b-\365\273\261\345\023\002\024\002\024.\202\245\236\333\006/\213\204\321\377\007\032\002\023\002\023"
+	.string	"\002"
+	.string	"0\210\217\356\203\t\b\002\002"
+	.string	"\002"
+	.string	"12\317\356\361\267\004\002\002"
+	.string	"\002\n3\361\246\255\314\00645\312\274\242\261\00567\304\212\251\367\01389\240\342\234\212\n"
+	.string	"S\250AE\001R\246L\n\223\024\322\001p\002c3\325\003\021\320hRRm+\031\366\r\200\007de~\3433\236F#!}Q\304\265\027\177\315\200\256\304\247N)\232T\034\227\303{\016\220\367j\302\3209\210\201#\031"
+	.string	"\265\321\210\262\254\023?P\243"
+	.string	"\022\355\026\301\356\202\310\201\225\002\212\361\313A\342\232\022B\003\267\321/\331Qr\373Z\317\222q@\210\212\273oB6\0172\252\ff\302/\362T\007\367\361\203v\021H["
+	.ascii	"xj\330{\262'\234\236joyZ}\275E\342\032Vs2\305\373b7/\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"U\004"
+	.string	"\022\006\021\027\200M\206\00330\0033\304\3305\341\227\315Y\02597\272\267\224)\005N\312d5\225_\022\031\242\373\341hL\306\\(>\201\330\375\340\004\271\201\316E\201\374\263\243KKU\220\024\230\314\334"
+	.string	".J\257\301\017\035"
+	.ascii	"v \263y\027\030*eC\017\301\3127\0322\204\251\fAs\230\245\026"
+	.ascii	"\003\303?6\016l3\263]\250\024Q,\2604\342\"%\346%\220a77\2528"
+	.ascii	"*\301A\030JQi\tEe0\314\213\0130\004"
+	.text
+	.section	.gnu.lto_.inline.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`G\004\215\024"
+	.string	"\346\235jH\320TQ\032\003B}"
+	.string	"\3063\317\356\265o\244\341\022\326\002\311'\355\341\240\206\363(q\263+z\030/"
+	.string	"S1\226\301\350\177\264\360_n\244\271\232\201\023\\\353\250\217"
+	.string	"\300l\311\230\313\343\243\243\017\024\f\375W\322\366\226;\005R"
+	.string	"T"
+	.string	"X"
+	.string	"\021\2246\237\034\034\337\244\3779\250;+t\3300\271T\306E\017\236\005\362G\321\030\377\224\306\365\350R\236\231\020\025)OIbw_/\327\027\375\221\321\314N^\024HF339\352\272\322\335]\357[2\027\206@"
+	.string	"\364cK\206a\bTz\325\"\n\001\n\342\227\">\304\013^JC,:\202z\233\211\341\024X\300\233Vr\244\260\335-\375}\362Lf\007\035\002rs\363"
+	.string	"FM\034\231\235h\271\264\013L\364\374\217dn\230O\025\225u~\353\374\326\251A\n\355\ba\361\321s\364\237\034\245Q\245\f\242JG<\0171*\214\340E\030\006\231r\3020\210t\312\203\242\017x5\273K\332@)\356\002\213\037M\222\245:B4p\023Fs66-bM\376\0044\036\217\036T\006\305O\314\272O\376\373\022\035=G\031\344m&\206\323-\274R\333\256\b\356T\302{\226\306l;#\251\231#\246\002K"
+	.string	"\345\313F\033Z\321\227-e\241s\013\202:\002\250\373\240\236~\354.j\b\262\306\254f\b\t\214\0247h(>Dr<\006\354\200%ct+;\371\300\321\365\004\270\3017[Z\333}Mp)m\367\305\262\202u\302N\260'k-,\034T\345J\211F9c\247g\207A\277\311\330\005f\2501\265cD\004\205$E\205\225\003`\002)bc\346\001\022\340\024]\305,\"\210\241"
+	.string	"\245\300\300~\017\362\260\374\007\235;\212\260\273\245$7o\343\230\225\017\231'\370\234\344\236\331\210HE^\262]^\334$l\007\274\265\277\306!9\323\210(F\366D\225\222\021f\327e\260\274\220\347\017\2148}>\260}cs\223\016\322\335\331\341\316\366\340$\354\353\276\330\225RZ$\2718\207\335\376\317#\333\006'X\342%\255\203x\316-d\320\314\350R(\353\270I\360\212F\311\327&\252S\347\212\224\300t[\220\260\276\202\032E\025*\004\266\220$!\206\346\325ATM\276q\371U\2000\234>A\311Lp\351\007\265"
+	.ascii	"?\355\357\003p\341\\t\210\251\b\337\317\350\313\301\354+\344"
+	.ascii	"%\356\023Ow\373\340O\2360\266\236J\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\362\001\345\013"
+	.string	"\266\32196`\207\223\3410\fe\013 N\240\36434SRA\020\004\202\203}\372*\206a_\326P/\020#\372\361\377\356\372G\210\024m\r\331\273\332\377\273v\267$\354-e\n&"
+	.string	","
+	.string	")"
+	.string	"\034A\024\301\222\275\307v\315v\361wm\022\351\027IB\235\245N\"\333\236Y\272B\237l\031Y\307\310/O\276\n\002QIu\252l9\270\262*\213\235\250}\203\312\315G\002\344"
+	.string	"\226{d\312\232\243'\"=Q\371G\333O$\220\004\032\022\202\204\312"
+	.string	"\001;|\303,\300\226\244\312\332S\\\250e\325\322,\275\367^\237\312\222\231\277>\327g\366\f\220\027K\n\203\241\006\0025\321\324\004c\\p,68:\031\222\237\363T\361\256\256N@\004"
+	.string	"7\254Q(~\316r\035\fe\215RW\231\220\250\334U\237\n\361\277\371\004\007\026<\034> @B\245\324\235\007\303\022t\016\017l\024\254\246\223\345F\270\305\022\031\354\322m/,6J\364\321 HQ"
+	.string	"@\216\240\217\315\002\271"
+	.string	"\r<\376d\374bY\321\230N\036\273`1\005"
+	.ascii	"\033\310\330\005,\304\262\037\023\320\\\024\321p \266V\317\013"
+	.ascii	"\0250\352A\002n\224\007\340D\0364\234E\267\330\275\313\333F\257"
+	.ascii	"\360\270\213\3076\364\020L\027\330\372.\250}r\312^\005\b\200"
+	.ascii	"\022\b\366\241\331\314\350j\301\245}\202\334LpY\344\345aw\260"
+	.ascii	"z\345\340\340"
+	.text
+	.section	.gnu.lto_.pureconst.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 M\025\002"
+	.string	"\322\204\017\027\200M:-\356\351b$&\231\251\0335\341\227\315E\215\344\230\"\264\0037\353V'uNW\272\321\205\356ssn\315\310\234\313Unr\217\321\270\305H\214\303}&\314\202\0238\017\271\273+"
+	.text
+	.section	.gnu.lto_.ipa_modref.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\021\001U\b"
+	.string	"\362\f%*\220)\031\016P\374D\335\276\223\356=?U\361\335\315\024\373Qj\003\244\221\330\222_~\333\317E\001\375X\351\262\r\362\333N2\005>\034 $"
+	.string	"Uz\025\3507M\315S3\213s\035\257\265\304\021\027\024\233p\256\245\205\223\321/_tJ\210RQ\313\202\326p\244\243<\245\235\363tV.y\"\220!,zF\037\030\350(\303n\362\234\254\006\204^\363ht\233\005\317\205\247>\270\200Jv\317\363\331)<\023V\006`\334P\377#\323\361\204\274\212I \243\313\b5 p\002)\211\310\003#\215\2073\311\t\353\274\200'6h\fx\211\035\342Vm\215X:\227r-\260\r\034P\3673\020\344*\230T\301\367\332\212\325\326>\t\371b\212\203\332E:X\257\3740b\026\342Y\277\304\356E\355\353\336`\207\335\270\021\372\373\"B\036\t\356\322\001\006~\\\330\331\300v\021\262\3430vs\261\226\270D\035.\337"
+	.ascii	"o\347a2\270\""
+	.text
+	.section	.gnu.lto_.lto.74f7a9e084ad5bc4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.82.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\376\241\035\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\375\005us\327\005uq"
+	.string	"\005\001\006'\001,\030?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.83.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\372\001\035\016"
+	.string	"f\030]G\320\324\324t\244\345\225_\273\"7\207\253\007\226\245C\224R\f\"cFi\017 \260\310\325\202\214\r)F4\333\270\343\005\030\215\341\200\311\215I\373\\DR\t\032\252\022\027%\377\310R\350\034\b\323\\F\214\224\r\355\235RB"
+	.string	"H"
+	.string	"N"
+	.string	"\207A^\345\344\237\335\332\r\333\256\251\300\007\274s6/\352\316y\007u\347L\332Bn\262\330\263$1\3212\263\273_]q\362\224\364\277rN\2312;-\231\260\273\246eJ\212\273\3366\002\333'\233\236\bvp.t\0261\361h\022\374\030#L\350\331\302?\351\316\205\200\304\320h\215C+1G\210,\245\261\315\031\255*\354ovw]k\366U~\372A\331f\206\030\220\331EQ\203do\334\213\013\333\357\330#[\202S\373/\002\021H\347l\r\033\350K\217J\324\231\251\r\031\037\003`n\001X8\374\207\330\031I\275\007\200\031\252\363\020\273\325u\200X\317!\243\255\303\310<A<\374\305sq\035\207\330\331qRg\207w\021\013\300^\243\345v\210\323\370\tt\266\210\313\220\00565`\260\340\002\206\n\0248\006M\017 t"
+	.ascii	"A\260\344a\265\300Wx\212\215\236U\245\330\370\305\306\357\325"
+	.ascii	"J\271>\325\b\373J \207\037V\343\007\"\f\307\257c\3567[k\266@"
+	.ascii	"s\243U\022\026QZo\376D\t8wQ^f\360P\002! \300\202\031:vB\024\201"
+	.ascii	"x\346\022\r\350\330\334\340t3\355\370\312*F\030\002X\265@\352"
+	.ascii	"]\230\300%\t\324z\025\tD\305\n\003\200K\b\304P;VF \270\241e\023"
+	.ascii	"\202\211\303\032\320\274\251\265C~\350o\035\r}y\321\0362"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.87.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\337\322\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\325\030us\336\007uq"
+	.string	"\005\001\006'\001\020,?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.88.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\335\001u\021"
+	.string	"F\341tG\340\360&\035\263\007+L\341\213\357\230\220r\216x\242\237\325\020&\362\n\222\277\026\200s\305\315\223@\357Z\322F=\277\326\343\326,rG\3071\f\202\370"
+	.string	"\017o\327N\001\253&\r\221"
+	.string	"'\367OhCk\204l)S\n]"
+	.string	"["
+	.string	"b"
+	.string	"\033\"0\b\352\235\303\177x\357P\367\360\3369f\307x\250\263\027\"\212\021\252\261\273\237\216p|\f\357\230\261wQ3\346\007\035d''3sy\0279p>\037:f\033b\002Z\021\356\266\347\314\354%c\017\315\365\266\037\330A\222\231\321<O$\273\353\224\231y\270\275\333\006mC\260S@\276q>4#+\216\235:\320\177z\355\216Ok\2463\323W\251l^\204\254\330\345\220\273\261I\035\013\236\327~\373\253\023#~\350\333\254Z\375\214\330\366S\\E\3545\037\241\\:\240\206\204n2v\227\365\316\017P\357V\361*{\3053\362\264\377s\024\261\003\265<\300.N\223\321\006!\217\232\322\303\330\f\270\325"
+	.ascii	"0Z\371\r\304I\351,\236\215\341D,\005\224vw\201?\004\313@@g\347"
+	.ascii	"\235\337\342\2753\2403#\365\244\252\207)q\273\360\256\251\207"
+	.ascii	"!\361\2229G\275*\215\230&Y\346\314q\243\251\322\212p=j\326_\273"
+	.ascii	"\003\021\262d\362m\217&n\362V\003c\223\311\016]Rs\034*wK\001"
+	.ascii	"\203\006\022Z\255\226H\307J\212J\313\365*AIq\231D\240\200\342"
+	.ascii	"r\231L(\201\201\037>\021\201\201\037\f\374\\*&\025\276\023p\345"
+	.ascii	"\023\361\360\313\002\n\370]x\275\300O\025\356\025\307\017:\352"
+	.ascii	"\026\"I\246/\235\346\370\324BS\252K\311z\324\031\333G^\324\222"
+	.ascii	"%\ri\003\351&*\211,\231\036wwcJ_\373*% p\002)\205\263\003\367"
+	.ascii	"\n8\n\370\035\302\036\020\024-\323\301\316\232\032\253\261X\241"
+	.ascii	"\325_\205\007)=\342\b\036\243\303\267\023\223p\347\002\230\271"
+	.ascii	"0p\203mF\331L:vv\005\267x\333\260\254\311A\3205\013\033\303\211"
+	.ascii	"\370\366\225\245]\204E\270\027*\307\373\021\351\\\353\t"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.92.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \215\005\004"
+	.string	"$\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\354\222\021\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\366\030us\350\375\007uq"
+	.string	"\005\001\006'\001$+?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.93.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\220\003u\031"
+	.string	"\266.\245I\300\224Q:\264$\266\213\030\004\365\314\324\315\016\271n\323\363\263\032\351\260}4\"\357o\233\211\366\342m\005\370l\361Z\313\002\237\2235\275_\017\002A\020\004\223\341;6_\033\321\340\037\202\2528\\Kd\365b\355\223\275\345N)\215"
+	.string	"\210"
+	.string	"\227"
+	.ascii	"\3645\337\262_&n.\355\037\035H\356AF\034\bP\201\200EJ\265\376"
+	.ascii	"j\314\200u\352\337\013\210\247\254\023\020O\235\263\245\376\253"
+	.ascii	"Q\217\344D\bi\252\326\n[\032\036\360\371\273E\231\373J\244se"
+	.ascii	"\316\027r\0068\232\f\361~\276\232\213#K\221\213'4-,\025iy\360"
+	.ascii	"\222\210\267\223\"\314\016"
+	.string	"\243\323\025\2373B\322\013/.\036\320t\351\200\262k\361H\310}\360\017n@\r\361\214.W\030j\255\226C\274\0247\353\266Q\330\306\331\373\023OD\271\273\017\342!\256\334\211D\350\213NV\271\346\342~\021<\t\035\355d\225c\204?\366\251\004\024\2145\315\017\374\205\027:I\345\007?}\304\220B\237\224*\251\354\337Nn\317\376\314\226\026N\336\031\266\314\203\3740Tzu\340-Niz\351\271\322\273\322RJ\337\325Z\022\245\006J\255'\252\272T'\312\224\343\300\337\376k\305\215\377\363\203n\275\214n>\344Dr\007z\310\372A\301*\202\324t\245\326Jsj\r\254\007\017r\241\200\310\267Z\333\303\231\264bX\361\265\320\311\252I\267\347\244\277t\027\376\301_\205p\311I\300\021%LPJ\230f\246\214T*)ISR\022\003@\017\254S)\251\334j\272\207\242\355\\5R\247\215\033JGS\013\226n"
+	.ascii	"\310\013\307\037\361p\376*o\200\214/AJ5\247\336\200A'\247L\370"
+	.ascii	"\254\314\355\311(`\025 \311\3051B R\350\332 n\244\307A\215Z\353"
+	.ascii	"\004\277H\b\\\003*6N\375\021\342)\035\016a\371\322E\360\264\013"
+	.ascii	"\263s\037\324C\336\001\263\016\264\331\0241\356\254g6\270\031"
+	.ascii	"O\254\006\263\215\265\332\2303\303S\213-\355\226I\240P\201\203"
+	.ascii	"L&\263q\341:\320d\266\021gG\307f\213\315ptd1\334\016-\226\301"
+	.ascii	"\347v\30096>7\230\317\rf\243\305j\260\234\033\016fC\300\343\007"
+	.ascii	"\235\033\214g\034o\260\326O\367\235a\0139K8t\322\355n\265=\257"
+	.ascii	"\242\250\314n\224\244\271\270D\342\342D\001I.g!\364\211r\326"
+	.ascii	"Z\253\270=\313\231\340=\242\244\362Dj\351{\304\325\022\3312{"
+	.ascii	"\340_\020.\256\314\006D\250Q<G\0202\2100\301\214\210\314P\032"
+	.ascii	"u\300\002\031\262\351\006\021\240AsTZ\267\034\2130U|\r\310\\"
+	.ascii	"\217(\263M\224\266\2501\254\215m\322\311\316=\n4A)]\025e\003"
+	.ascii	"a\342L%n9\233;\220xa\030\324+3D5\250:\220\354\353\362\305L\252"
+	.ascii	">x\250\264]\264\210\303\205\312\212,\311\320\256\353\240\230"
+	.ascii	"\006\330\332\347\360\234\334\364\251bg\f$\265\206^W\356\362\355"
+	.ascii	"y\027\204D\252\221\272\207\335\366\215?\020\3511\007y \022~q"
+	.ascii	"t\\O'\201T"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.94.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\355\001\325\021"
+	.string	"V!wI\340\322&\035\240\206\274\366J\210\004\322\245$dL\024\211#\251\323\251[\276\030M\324I\304=\233T\200\275P\343\206\332Z\356j\304\025\037\265*8\206\321\030\307a\265\236Y\003\240\231\034\013j\344\323m\320&\214XB\266\334)\005_"
+	.string	"^"
+	.string	"d"
+	.string	"\273\342\002\227|\357,\236\200\367\356\373\210\367\3161\033\351\"\212\275\217\016\020>?v\027\324\023\236\237\342=e\354\335T\031\363{^\242\203\233\251\301\274\233!9\236\022\"\265\017\223AMP\356\267KZm&\347\016\315\365\267'P\341c\246Fsy:\331]\313\231\332\210\333\273\355\320\266\004[\"\b\"\214\324\034\373\316\361\324\bYql\324w\333??\336\362\266\373"
+	.string	"N\"il\261\302\261\033\242)\310\026u4t>\376\366UI,_\364oN\251\224X\266}\030\217\021\373\350\241\017F\304\367\343\203\244\264\273&\357\034\341{G2\237\262U7X\227\366]\374E\354\266\227\002\0026f\244\t\005z\"\223L\237\273\273\023\245\037O\242\340RQz\031\233\231lr\312\306\247\267\235D\374\365S\335!\263b\326#\200\320\206\317\340at:\272\213gs\370\217\313\267\273\016|\031\036:\0308J\361\316\177\361\336\0358Z\222\311&\207"
+	.string	"\341Tk\202r;j\223\177<\004\0232\311\344\337>Y\334H \"\243\225Lv-w\253\001\353\001\205V\253\265\022aii\271^(+,\256\224\t\026V\\\256\224\n(\260p\200UV\260\020\204\205\240\253%\345\002\250\022f"
+	.ascii	"W#~aX\tA\r\257W\b\246\304\275\342\270\347\037\220\217\"\231\316"
+	.ascii	":\315\361\251\206\242\024F\204$M.\225\366\333QK8\033\375\324"
+	.ascii	"SN\275\322<\344IE\311\021#\201\340n.\003' \220\002\2412\352\001"
+	.ascii	"\346\n(\n\3705$\224\3670\207\373\215sP\232\303\032#b\002\266"
+	.ascii	"]\007M\333J\254]\310\272j$\201\224o\322\004\202y\r\204\007\226"
+	.ascii	"\206k\212v\350\b\207X\024\217\021\326a\262\003\022\202\211a8"
+	.ascii	"\301m\367\033)\325\275\340\020\341^\250\036\357C\244s\345'"
+	.text
+	.section	.gnu.lto_nullReadRawRC.95.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"u\t"
+	.string	"\366\320A< \345*\035\340\005\0130\232\fP\252 \304\366\0161\013\263\371\330\266N\240}\202\352\352\206d\035\r:\300\210\005C\3745\b"
+	.string	"\220KA!\005\263QsQ \277A\244\211\277\211%;\245."
+	.string	"/"
+	.string	"1"
+	.string	"\263"
+	.string	"\032)\266\335:A'\340\274\223\017q\336q \037/G\377(\337\320h.\257X\353\262\263\260\273\226\257\030\307\315\335\266\201m\007\333/\0016)A\374\311\305A\353\232\021a\360\274\023\325HR\332/\271\211\370\212\361\201]\231\215e\267\036\270\300\363\316\325c\333\257\235D\364(k\b, u?rJ\037\031\234\313^\207\007\223+7\231\2255vmInf\177\263\234\314\226\236G\314\244\331\335\270\001X\230\256e\304\266h\177l\221\ni#\003\023(\0204I\234:\376\020\024J\020\337\367\215\274\210\324\007\206\r(Uj\005Z<\260\250\200O#\026\235,:\301\224I5O\264b\216B\016)Pt\256\302\220\316O\016"
+	.ascii	"\2213\240\314\200`\330kX'\004R9\274\322\274\013y\231YKd\354\250"
+	.ascii	"PC\300\t#\325\212I\230d"
+	.text
+	.section	.gnu.lto_nullFrameStatus.96.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \304m\005"
+	.string	"\"\212%,pm:\2004\300H\377\272\260_\364\023\2549\352\222P"
+	.string	"6b\263\017>bh\246\260\n"
+	.string	" \020\027`\255@"
+	.string	"[1\261\330\366\226)\307.\255R\255\322\310\243\001\241X\245\320\253\360L\342\250\264\222e\225Z\267y\206\277\r,4\226y\271\265i\211\372/''\347\347\252\273\3733\374%\001TR\230\272\2771\325$\300\350\363\177\373\255#\022\333-_\3177\3500\235\350\324}\351\354\260ei\317\034\342J\024G\017\344X\n\030\335}\351\201\031\376\344\377\207\377\206\377\223\007"
+	.ascii	"2\003\036jt\257\302\232k\336\022\202\204;gj\347\023"
+	.text
+	.section	.gnu.lto_rxInit.102.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\327\013m<"
+	.string	":e\\\026@@\244N\007\277\321\025Z$\350\356\307\036 \320$h(\260\336\013\373\026\262\333\271\317G-:P\367\251"
+	.ascii	"0\257\330\001;\204E\"\354%\350\366\027\313\244\244\351\251uf"
+	.ascii	"f\202\232\210\220\275wJ)\005X\001>\001U\001F\2611\177d\030{="
+	.ascii	"\362\035=\206\333\314\203/\203\264\224Q\357\336U\351\314\270"
+	.ascii	")\240\005J\365.\263\243\311\260_\207\333D\203\260\004\017l\315"
+	.ascii	"T\257\374\301\330\253S\023(\356/\334{q`:L\333bx\364\005+;\026"
+	.ascii	"\031\303G\360\336h\225\261W\216\032\235\324\3648\331\253S\222"
+	.ascii	"\243\3535\267g\212\223\030\0247\224\333\013'\235\312\240\032"
+	.ascii	"\257\273\264\035e\277'\257\3505\263p\206\017\032\325+\0330\366"
+	.ascii	"\372\324Kl\257j/\331^\271GC9\212\356\220\rz\357M\252\311\226"
+	.ascii	"\331OG\345n\217)\023\006\246\320\275\227\371qJJJG\234\324j\264"
+	.ascii	"Y\375\266\227IHGFED\312$\362h,\262\253\372\336r\0273\020\301"
+	.ascii	"\323\325\313'\235\2446\020\354\033\324\323\262'\352\022Y\224"
+	.ascii	"g\3379q"
+	.string	"$\365\277\n%\351i\331\234j\3010\314N\353\245\371Q\2233\2716j\353\"\"\266V\256\365%\361$\22525GN\313\332\324\247\275.@\245\f\211\037\365\232\301\236\272\2673\2716\026(\0263\274\235\035i\266\310,L}\272\003\363U\375(\203A\212\314\276T\013}A\b\305\314\234\256\326\r\351o/\355k\3728\363\2201\033\322^\314p\357e\177\232\2355+5s7\231\371\213\031\371%\314,\242\003a\030\001\336{)p\003\266\236\366J\233\245\265k\355\344<\003\365\373w\030b\323\023\231\271\275k<-\027\343\275^\022\270\355\364\235\266\213\006++\266\327~\002z\360\224\322,\323\307b\0308}\216\272\340\326tC\334^Z\275\362\346\322+\354\230[o`\271\377\272\316\006\016\036<\310\021\326\365\007\226;N\313\371\300M\307!F\214`{]\002$l#QB\301\211~\203\302\215\332\307\245k\323\024*\020"
+	.ascii	"\336\333\354'\363\212\366c\001@\356\336+\201[\332kZp\323\365"
+	.ascii	"\312WX\336\317^\271\261\316<\2134=\221\227\322\370\n\003]7\304"
+	.ascii	"\034u\372\30317\223\024/\177\374L\230\253\230SRJg\005J\347\004"
+	.ascii	"J\347\001\315\327,\240\363\232\233:\332\314tt\016Pt\006\240:"
+	.ascii	"/\251\316JI\347%\353\234\304:#\251\316G\252\263\021\353\\\304"
+	.ascii	":\023\251\316J\3259\231tF&\235\217Hg#\353\\d\235\331\243\363"
+	.ascii	"jtV\215\316_tv\326\271#\264]\264\020 \020y\356%K<\274\177\253"
+	.ascii	"\032)\315\327\235\327\035\355gn\247*P\334\307I'+P\214\246\323"
+	.ascii	"\264\315\207\303x\371\002R:S.$$\333K\"\377\370\217\247\027\307"
+	.ascii	"\313\r\277\034\355\254\035[\325\314\312\220\357g\302\\H\013\304"
+	.ascii	"\310"
+	.string	"\334\212\371X;\366\3205\210\330\361{N\367 `[\031\2625c\215\317\245\247\307\313\r\311\374Gk\006\"\316\n\0334\354\313\301x|\20298S\304n1]\267\026-\024l\272\263]{Ar\317>\303\f\302\233-\232\272\004\210\216\323\t\264W\366\353]-\021#mZ\032\253q\273ft;; \005\020\352\200G\370\031ey\273fz\031\006\354pln\260\351\273L?\355u\007\221\276\311\303\207\247\344\370p\354\305\004\337w}\264SCd\025\374\200\027\313\323k3\200\252\017\301 :<\036iz\242j,~\202\2666,,~\247)\262\257\340]\020\241A\354_\230\303S\032\371\023d{\006\273~o\321c\372\323\345vI\013\347\375\\\337\206\233\327wq\3375R\332e\272>\034\027\003\277\352?\320\243\232\351\305\330\217ez\253@/7\244\303\364\031\232n\250\3238\241\313S\253\276\243\375$\325L_\365M"
+	.string	"\355\212*\270\301I\316O\377i\343\346\332'O\3008]\267P\330\177\365W9`lNO\344\005\316\334\326\265U\274\237\377M\304\315\371]\254\224\332M?\034\003\013\207\214\0269V\216Ae\203\305\025\027\363*\253I\007\326\013\032Z,X\255\0274\266\254hli\335h\221C\353\306\225\006\254\027[3\002pV\204\t\025^deeQ\025i5_Q\351\340b\352\340b\322\320j1\203y\305e\203I\265\344\255\032X\\\314\033[[\\\314d\264\331\317\204W\273w\362R\211$\352N\240\344\b\233l\372\246\032\274\241.\207\205\201\356\220M\352q\315\305\341\254\232\200\032?g \364\336\246\035g\302>\022\333.\357\247\361N\025\301B\301\257\357\342\242\2347h#\341!\263\206lnP\311\246\213\361K\213\222\244\207#\354"
+	.string	"\357\242o\200\257:Q\345\2570\020\222\021\363?\320\030\325MJMzy\352\275\367\0361\277\363\232\236\371\335mhm\334\350\341\270\333\260\020I}sicSN\275\200\027c\006`\302\331`,\371Z?\003\tx"
+	.ascii	"\317\344\027\206\250*\375\322\027\373,_\311\351HZ *\342\n\261"
+	.ascii	"A\323\216,\177\352\320T\3007_\221\224\027"
+	.string	"\351\244\227r\"\215\364IG\217$\325F\177\364M}\220oD\210h\352\233\257\350\3258\330\242\237zoj\034,\321\027}\203QQ>\321\277 \252N\276\362\233\016\035?\371Lw\302\020\225\244\203J \354\361\373M/p)\330}\335B\002\200\372\250a0\005\031c\206dDD\222$Ik\220\002\231\031\243u\003\021p\255TF2\222\2449\347\tS\322G\"\345Om\366\205\024\334\2379\254\021\211\375Z\245i!\263Y\237\2735\231r\016\207\365\331G\016_\n\354\333\372*]\004\374\"\337>6\371\304N\247\026\200\325\020\034\376\252\241\334\341WV(e\246\035\307t\200\267J\264\203\314\352\355P;\333}\003?\210\336\356\302\322m\225\335\341\007\034\300d`n\270@\253\022\221PDd\005@\365TH\301\377\202\227\231}h\261_\352\033\330i\352@\31641#@L\f,\232}\342\206\2611\311@*\203t_"
+	.string	"\362Sn7\024\ri\334N\330V\352Q:\025\2650\343\217\363\"z\304V\274\341U\231NF\033\220o\006\334\334hs\026\265\357\037\354+\333"
+	.string	"C~\\\330I\302\345H\370\216\025\\\211<\254\332\357\021\273\321\005S.3K\364\r\236IY\255\267\224\323$\224e\261=2?~\242&\352X\034F\217\3615eW\346\276\317D\366kz\204Zv$\362\205Q\336\f\270XD4\202\274\3622\234\237\210\265\247\361w\276\234\334\022r\223)\004c!\317\210\227\251\223Yy\231D3\023T\302j\317\034 -\375r\217\206l\207\374\264\255{\345\243\311\257\261?\305\2478S]\346`^\333\002$\251e\346,u-,\034\3643/|\263p\364\006\247\006\360\243\375m\302C\006&\333\020Q\365r\270\270\t\"\322\214=\201^\220U\234@\266\204'\362s\336\314\002\3115-\\\241\334Q/\306\tc&\301\235\236\214@WT\376\237"
+	.ascii	"\212c\002\312\322\t\332Xp\376\266\026\035\261\343\004\243\265"
+	.ascii	"pT\306oPH\006};\373\227\202\343\344\360#\217\277\r\372\373\016"
+	.ascii	"\243\330\317\030\005\373\231\242\225tw\003\302Vy)\364\017"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.104.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \345]\006"
+	.string	"\362K,3Pm\222\016\260&3H\313\316\246\027\026`"
+	.string	"\200\200[\213\271\341\337\267n\330\277\333\331\035)\270\021\343q33f\250\025\261B\022\020\033L\215\326\376\3362\005c.\231\252e\252\366\320\260\340\3200UD\273\bLA0TM\202\242\2526aY\f\035\022t\220\342\033R\021\353v<\241\271^\225\256\306R\3510`\303\242s\331\323E\036\312c\234C\214o%1\364\337\207\003\"\023\205,\323\223\245d\211$\362\3707?}\200\260\331*\246\341)\307\250b\344$\023k\230Q\253g\335\202\264\3621\"\271>\234\036@Bf~\327\007\324\261\277\301_\360\203\002\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.105.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375 \345e\006"
+	.string	"\362\213,3@o\222\016@\265\350\225\033\3703\022 \232k\261\371\034k\244{3I\004a\377f\017\b\215\220@\304\256[\206\001\341\303\f\0057z\214\276{\234f\367\226)k2\233\3066\215A80<0M\223`\231\201\253\210\206\306&\252\2521\352\312\"\351\260\340\203\025_\221\216X\327c\n\316\025\324\351r"
+	.string	":\035\np\\|\2564\205\221\347\362\227\3470\343\213I$\375\367!\201I\312\202Jf\250\364\222(S\311\307\337yj\204\204\316V\257\215P;V,HZ2/\206\032\265z\326mH1 ', \221\247\027\240\220\231\037H4\352\330\377\3407\370G\001\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_suspendRxSignal.107.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\375\b"
+	.string	"v\220<9 \0057\035\340\3240\344m\324!s\350\270\264\242(\0018\3659'E\273\337\302\201\332o\026\215W\255\252\221\201\331\233\034 \001P"
+	.string	"\251\365'H\245\fYq\377nD\312\224\002)"
+	.string	"+"
+	.string	"."
+	.string	"\276\307\235MsPd\277\022"
+	.string	"#\005gw\243\206\274{v\376K.\360\231\274gGaw\235\237I\343\326\333N\260\215`\277\023U\332\243\212\374w\035}\224\324s\272\2041\23396\350\245\202\330\257VO\366\323\371\364\003\f8`\030nv3B"
+	.string	"\233\262XH\354\376\311Q\260\207,\273n\025\310\330$\312\224\352\233\034\324\374\021Kp\226\317]\267\264\345\253!eh\277\250\244Nq]S\253\231\013\217R\206\016\006}D[\024m\021\002k\310\"h\343\342\207\300ZDh\213\023\232\266E\017\270\257VO\013\035)\222\226<\220\332e\207\034\362\237\017,P\033\307\256\020"
+	.ascii	"3\241\027(0\370\357\250\321I\017\0137\205\007X\274T\032\2466"
+	.ascii	"@\241\225?\265\240\0139\302`\377e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_resumeRxSignal.108.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\005\b"
+	.string	"\322\21656@s\322\001@\024\031\230\253e\023\302.\204\364\025o\306\343\370rq\30512\330F\350de\327V_f\360f\376;\206\325e\347\313\226\\o\026~g\t!R\246\024\366tH\320\221\240s\370(\204\234\007\212\\G\300\357a\001\272\210\367\240\343\250\366\327j*!\204e\322\223\003\322f\370\344\243\013>\362\240\314/\271\t(\364^vl\240E&W\030W\177\344$\020~\207E#\314\037e\307T%\306\230\262\345+\355\222D>^K\031'\335\234\253\013\226M\032[\265\245j\330\277VS\366\323\337\020\200\2544\300\354V\264j\226\205\245x\330>\307\232\375r\025\307\036\205b\342dfw\235n\\{j\376E\016\020Q\333s\203\260\273\316\210\262\270\365\266\017l\033\330v\t\017"
+	.ascii	"3\241\333\037\230\320n8\303\210\246\016\001\213\227J\303\224"
+	.ascii	"\r]\265\032\317U\\\030\351\202\315/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.109.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`l\004%\033"
+	.string	"\326/\247H\260XQ:@\021\367Q\002O\216\275\342\004\252\340f\252uT/C\310_\256\305;_\037\\N\365\347\336\366\353\213\2142\030\271\342z\224ps\001hOw\216\357\234\rJ\375\177\325ut\250#\256x6K\b\331D\356\224\002\221"
+	.string	"\206"
+	.string	"\230"
+	.string	"@vi\337\220\331\331\037\212/J\265\326\034? Oo\272\354\314i\377\350C\200\216\224\302\251Zo\034)\325\372\313\261\001\362\324\365\226x\032>\200xj\333\t\026"
+	.ascii	"\371\366_\321\320u\314\330\031!S\353\357\2658~\273*E\216\"\r"
+	.ascii	"w\336\374\021B8\346\t\211\020\017w\325s2\236\222A\006[\364\n"
+	.ascii	"\364h\021c\2160.\356\222VL\372\342a\311\013\232\313\342\251\b"
+	.ascii	"]\265\326\023\371d\301\323\3159B\250\265z\n\361\\\334\345m\007"
+	.ascii	"\261\275\301\016%\004\277\211\337\017@.A\323\214\375#Gr\363s"
+	.ascii	"X\004m^\350\324\247\211\247\337\325\226^nF\331\006)\330bR*\003"
+	.ascii	"U\347\031\373\207\233\353\263\037\326%\262="
+	.string	"ms\340\335:\322_CN\257\350t\351i\025\235N\321ir\234\036=-\216\323\324\323\2418\275t\372\002\032\020\325\240\241\203\306f\371\325\241(4\325\nu\262\343\300\337>N\320\216_\304Or\211\243b\347@\023.\334\257\016u\360\362;:pj\n\344\351\355\342~\347D\007$\\*\026B#BPQ>n\270O\372\3549\355\236\314\261\211\307o\242\224\001EaXM?D\034\221.\324oBl-]\317]O\327\344#X\367\300\273r\323\273\255\375\f\033\272\305\331\316p(\032\310Z+\003\237\351O6\3709N\315\301\203\007\361t\227\201\021R\254\251.\301n\212\236t\322I\n\030\332\204'G\313\017\024\033e\240\236\344L\b\024\205aMa\n>\\\237kvn\rHE\311\227\304B\314f\342\351\\\234\325\224\245\340\254\265\342v}\016>?6\230\315B\214\006\253\311J\230mD,B\215e\n\0328"
+	.string	"!\223\311tX>\030b\264\331\005\033\211X\255\366\303\003\300<:'j\257\023\265\027\211\031\214\366\342\251\371\274t\002\270\247D\254\366\262\365\364\324^\345\257~\211<\311\003\237)\004_-\013\3336\353\312\255\316\253\265\331\357\322\344f\224\250Z\237\377M-Q\271\177\312\022\2330+Wg\313$\327\227\344\252\375\223\223jYF=\"W5-\005\307\324b\251YrS\373\0255t3\352J\254\302\214\\\005F\275\234\020\261\212\210\025\023e\250QD)\031\252\031\t\232\024\0255\007\260\002\231\251\252\016\020@\310h\223\244\003\345p\300q~\372\313>\023\336\245\212a\032lx\244\352\2166\031\261\275ZH\240\206\304\377\021"
+	.string	"\244\177f\366\352\033\352\341\315\004a\301\3474~q\210\361o^I\316G\321n)\312.C1\363m\307\036\371\215\230P\2570z\322\025\252Fa\023\377\003\274I\033\234 \272\324c'*e(\206\346\215\017Q\340u\f\263\365\316\031\032w\202\275\246\027\025\002\034i\252\225V\031@\017eH\226,\032\212"
+	.ascii	"K\221\352n\233\353AP\313\375\365\350\323\307\377\f\212Tq\207"
+	.ascii	"?\036\274U\231@\367\"O\263\306K\2773\033\350&\332\332\215-\320"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_calculateNonDataDrivenChannel.110.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\376\004\r "
+	.string	"F8\307K\220\330Q:\300\226\bD\2548\274\364\322[\340\300\f\3077N\3241V\302K.ZX\260c\022K9\263\335r\177\224.\375\332B._MH\262\"\b`D& |B\244-\374\002'\264=N:\312\035O\032!\204\020\"w\222\001\262"
+	.string	"\245"
+	.string	"\264"
+	.string	"F\353]\322\320\345\352H\316K\326\301\t\323\265\375Zdi\356\321\360\205\003\364%\216Q\327\226yA\003\242#\031\342\276\027\252K\326\275k\0026\200\276\274\221\037!\342\"\273N1\315|lIRBv\357\312\243\371\315|i\037\300|\331;\270O\256\347\323\026=EO\263$\333\026\361\215\236\236=\013TO_\242`\3148J\322\034\231\234H\005\266\005\021\311\236?\232n\236\275\253\037 +S\"6\275\224q\222<"
+	.ascii	"\265\025\243F<\"o^8\304\016\204i\206m\225\270\202\314\335{_\274"
+	.ascii	"}A\034Z{\366\356\275l\225\2100\316\26333\021f\336a&\215\001W"
+	.ascii	"z\311\007\32170'\241-\343[a\"\0333\342l\035_|\006\256\2540c\327"
+	.ascii	"\216a^\215lK1\377O4\274dp\347`\306\261\345\233\257\277\315\221"
+	.ascii	"\374\267W\235k\330\262\355V\347Zjy&\265LK-\253\252\345\231j9"
+	.ascii	"M-\243\252\3453\265l\316,\227\251e\262-w[\266\250\345\023\220"
+	.ascii	" \006U\303\207XkY"
+	.string	"\357R\031\231\333UjQ\335\352\257\372iM[\332\222\3718\035:~\022\376\025\253\270\035:%_Bt+\236\222;Z/Q\002\031\331\275\200\276\314\221g&\342\027Y\305=\351\230\253R\344\002^>\264\313\354\033\230\326\217n3\347\267\272\316\r\341\325\311 Q\326h\343x\237\311\345\263}\275\312\2676\004q\340`\276\0240\005\346K\327\275\367\226-u\037\223J\201)04c\323\202\261%!\244\375\220\371\016\026\271hF\342\221\235\270\360\302\244}\314\262=\024\303\216\254\030\346G\271\024\037\023;\366J;\346\313\262i`Ned3\263\320\241\370l\230Y\305\263:\330\246\356\275\020\236\034\213\207\337\343%\243\370\375\224\306l\232\354\322IMw\377\326\266m\226\2442\266J\230cM\277\3529\241\035\303}\002\346\273\246\217\2445\264e\314g\362&C\374\036\f\004a\003A\252\020\360\303\017\005\f'~\200\301 \212\037"
+	.string	"\340\210\022$x\202L\356a\360 \302\207\236\236\236]\355\207'\304\217\344\337N(\310\023\n\362~D\360\220\340\375\202A\274]"
+	.string	"\006*\001\f\362N"
+	.ascii	"\001\005y\352z\3379\330F\365\224\204\205\336\364\213\257\260"
+	.ascii	"\304\"\t\253m\332fk\356\t{\230\316\364M\177\200I\353\231n.HE"
+	.ascii	"\206[|h\030\255\005\360\320*~f\frD[\212mEL\\wX\231\363Z\267H"
+	.ascii	"\360ZO(\207D\325\272'\264cN\236\270\276\025\202\327\032\327\327"
+	.ascii	"1\3328\252\375\345\273}i\231\265\232\366\331\263\356)HPh\247"
+	.ascii	"\036\236\305\267\303\322Aw\005\355\035\017-\263\317j\250Q,%\025"
+	.ascii	"E#3\"#-H\212Y\003`\002!Sw\035\020`X\242$\035\217\034\303$\333"
+	.ascii	"\337e0\261\245\002\366P\255tD\274\f$f\217\310\244/|\023\330R"
+	.ascii	"\"@6\304\251A\n\371\032\2678\342L|\236\2364o2\317\\\021Q\"\207"
+	.ascii	"\374\214\033\341\315\307\343@\nF\210\334\006i\276j\273\006\035"
+	.ascii	"c\307hi,\351\204\003xS|\n\204\340\322\264a\374\035\224\331l\234"
+	.ascii	"=\214\216/\240\345\377\020\305\f\366\372\205\232=\264\031!\255"
+	.ascii	"\270\232h\332\332\241\003m\024-\035p+\317\254\017\341\021nn\245"
+	.ascii	"\322\325\363Y\005\217\210\340\327\302+>\"\216\224;Rr\210\n^+"
+	.ascii	"\215A_\353\307\215\334\323\200\013\267A\241\340\224\016\240\177"
+	.ascii	"\212\352\f\313\242\266\t^\3347jk\333\372\335\320\n%,\375\255"
+	.ascii	"+5"
+	.text
+	.section	.gnu.lto_getRxfailValue.111.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\022\005}\037"
+	.string	"\306\370\306F\200ZN:\377)\004k\361\370\233\342\245\360{\227S\b-\302\333\214\213\357.\302\320ba\251z\333\201\265\366|\007\336\325\377\243/\262,;u\374\303\226\023\3771\306\362\033\206\261\211 B9\177\260[#\204H\223;\245\257"
+	.string	"\254"
+	.string	"\264"
+	.string	"\247\362*1n\305c\033j\220\007\204!dPdm\265V\007'Mt\236\f\302\335\237\002\334\021\350b`\337\313/>\n\360Rd\274B\355\310\361"
+	.ascii	"\013\242"
+	.string	"Vk\261\301I[(\236\367)\tl1Xz(\206 \001x\"\223\267\326*1]j-:0\202\363\244m\337\311\273\200n\242E#;tZ@\242\250\264\325Z\344\001\370Oy\222\336\247<\271E\336\364\323,I\334\322&\337\351\347N\213\213\351\001,K\371 \325\311{\235\bLkM\310\024\325q5\2366JX\376d\215\035\321IA-5\207j\255\246C\251\251;w\333=l\377l\322\fjnj\301\203\035-\233\221\341\261\3304\316\245\b\367\263f\024&\351\252\265V\320\362-F>\222\223V\361\243\037\236\364\177\345I\263\360\321i5\225@\353\201\211\306\254z\230\b\271r\237*Q\\8\232\274\371\376\353AA\032\307\273\375\232lQoAz\364\275\256+\203\202Vi\034\273(\244K\304\376\036\217G6\357\225m\352\036S\363\230z\347\304\177gj\235I\2353\251\317\222\332<\251K\223zKj\272\324\007"
+	.ascii	"\264ef\006\234Zu\034\345\32432L\3131>\305\277\322\223\006\254"
+	.ascii	"\31560\350\251X\245B\270\251\351jp\362\200\217/\007?J\001\324"
+	.ascii	"\006!\202~\270\273\353\344\3352Q\033\3023\212v\235\262\2653r"
+	.ascii	"\304\325\2208}4OS\302\304\211\023\345I\236\005\302\">G\231Y\331"
+	.ascii	"=Ta-\355\013\227\346\237\3313q\231\375\354fl4\301P11\225'\377"
+	.ascii	"\252\335\342\350\233u\312\302\204\271\001\2613':\347YcYb\273"
+	.ascii	"D\3742>\031\335"
+	.string	"\262U\255\304\370cl<_\240<i:\254:\262\266j\255\013\016\306\266\321<CU\253\323\253\f\264\215tXk-\326\005;\253'\372f\033\305\305z\035\236\\Uu\325\3724\341\213\227\207\311X\005XDZ\366\005\r\313/\345A_\277\327wno\002^\261d\224\002\351\207\242T\361\363!%]0\362\365^\264\370\3652\374\330\027\201\202\205\024>\237O\210\247\205\021\022RoE\221\351\"\241%%\336\222\022\017\351\327;\342\025)\275\340\t\3718\311\205\221\022\017FR\222\022oW\f\036W\367\312o\342F,{\226\270\031\315\2355\216\334\275\327snlo8\236\325\355\r\333\272\365Pp\205\270Zk=I\343\233\312\334\356\354\241\252\006\274\251<7\267\207R\"\244G\233{.m\203\341nz?\"\327\232\232\271\021\326\020u\314\200\22095\363a\226\333\263\217z\263Q\303\351\263y\033\016\036>|(O\226\033"
+	.ascii	"+,H\217\006\352\201V\307\3764+9\002_\250!D\002\231TFH\206\222"
+	.ascii	"\024\026\024j\f\220\"\2512\333\001\021\2201\224L\n\n\f\303\030"
+	.ascii	"\227i\2523\023\322\371\327\236\371K6\265\001\301X\276\023>\222"
+	.ascii	"\t(u\021A\024\335\341\357`d\326\230y&\256\315o\216\355\"\267"
+	.ascii	"\007;\244W\006Kq\310y\244W\307\263L\005\326\332\250X@NKh?\022"
+	.ascii	"F\022O#%S\205\311\001\304\322\200\3619\006\017\r\360t\243\b#"
+	.ascii	"\337\252\023\215\235/\b\214xU\330\247V\204\311#\0131\343W\255"
+	.ascii	"\233\276\035\205$?4\331=\336\320 P\354\365\333\030\227\037\021"
+	.ascii	"\306\250'\311J#\343j\345\272n\315\237\314F\376\340y\261\212\b"
+	.ascii	"\f\f\341D\032\333\352\257lr$\020\366\032\223\007\020\222\257"
+	.ascii	"\217m\013\213n\307i"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.112.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\274\001\255\020"
+	.string	"v`qF\340\360&\035;\007)\330&\235\036\266hTM\024\345\326\237\030{\303:\305\361\253\n\322C\253\373\234\201a\237e\364y\201\306\357\007t\370\300\f3\254\201<t\2460\231"
+	.string	"x}\202s*\214\335\242o\333\310\336R\246\024\\"
+	.string	"U"
+	.string	"]"
+	.ascii	"\256\177\256\031\265\333!\306\320\356\226\230\300\351q\004\332"
+	.ascii	"\366{>\302\345W~\037.t\360\020\311h5v\277\356\343\001\266\307"
+	.ascii	"<\310\366\250\036\376:\324|\3714\207'J.nf\031\256PDg\203\215"
+	.ascii	"\325\254\006\216\2540\222\235\366\304\231\3052M(\273\353\274"
+	.ascii	"\231a\270\343m7\260\315\300\316\222I\366G\223\272c\037\256\352"
+	.string	"\330N\2572\255\312t\352\337\315\035\350G\375\373MN\307LC\230\326L'L\337C\204\210\205\253h\327\302\022\2165\212(xl\273l\316\016\251@\242%\376\343:\320\214\200\217\215\375\364\f\355~%>9=\372;\205\300H2\355\373\234DG\253\377>\002\313$s\3511dzq\327\266T\250&\265%\264\344o8\205\253Ai\254\n[\027R-pM\375\f\231\222\r\363\240\230\323n,\201o\202\205\302iw\037\342\321\237\331\036\257\b@\370\300r\311Y\224\3427r\226\202Twl\340&u\360\003#\2267|\332;\212z\2166\003+\020\\R\274h\326\001\005\013\036\260X,\223\325\n\313KKJ\314f\025\023\031\257\223\361:\227\b)-\235\212\027\323\231\200\270\365\262\342u\023Z-\257\343\276\275\352\030&\307\t\332Q9IH\351\277\266\2508\266\243\032\005\24650\245+}\013\231\022LEJi\207\"8"
+	.ascii	"\020RiJ\23562\"\022\247*\035P\263\241QS\013  \200\002!i\241\007"
+	.ascii	"\200F\221Yhf\003\031FGV\330\267\363\222\253\377\341\223M\347"
+	.ascii	"\r+\343\225\3414;\230\366P\334o\\N<`i\330\207K(*W\224\004\354"
+	.ascii	"O4 \0221Z\240\216\361\211\274\333\227\013\250\013\245\032h.\b"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.114.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`n\tM6"
+	.string	"\032]x\024C@dR\007\033\006\212\252\342\035EV`\245Jd\013\006DP\216V\271$3\200\253p\006\331/IKa\204xKdG\004\375\213\376cOw\354\360\235\321\305\225\375\3501\361T\254 6\216\266\367\336R\246\024/\001,\0018\0018~7\367c\241E\313P"
+	.string	"\2375\312D2\243\277\324\237\214\227\305\371t/:&\0028\306\312\375\r\363o\376p\376:\374n\3569^\352:\240e\360\214\037\346\277\370\267\021\347\030\335\277\315%P\310\361`\224\300M\305\215\233B\250\272\267t\003\360Y\377/9\334\337g\365\263\371K|\032_\355\275\300\277\266\343\367s\177\027\241\250Xu\357\335\364\254#"
+	.ascii	">[|\245\366\331\365\221\332g\035v\337\303\264\265\261&D\277\230"
+	.ascii	"n{{o\243f\342G\277J\337\205\031\376\241\360\r\016\001\335\226"
+	.ascii	"]u\206\375\331\036\001\264.\213N\234\023\353\207\253\273\365"
+	.ascii	"%\345c0#\353\205\276\352\334\223af\341\222g\221\177\017\230="
+	.ascii	"\211|p\225\360\025\306\347c0\"\353\260\232\307\371scy\250\312"
+	.ascii	"N\214\032\237\331S\354\201k\003\262: \037\203\211\255Jr\222\344"
+	.ascii	"\371\274?P\005\f\232]\227\003\231W\021\035\353c\366,\362\255"
+	.ascii	"\220g\203N!\277\0229\267^\247V\326p\237\1778\271\326\342\336"
+	.ascii	"\373\335>{9\263rv9\354\275=7\235\317w\242w\377\325\335\243\270"
+	.ascii	"\003\243\001\255\221\226\321fG+\367\271?\235\257\243\364\207"
+	.ascii	"\3421\216\371\233\307\366Y#-\264\003]\346?7\020\310\355"
+	.string	"\203T?\017\244\214\212\307 N\213w\036\344.\315\312\372\314\375/\240\365U]+q'\312> \230\235\030\314.`(;\3230\373R0{\200`v\245\244\243`v\243\242`\366\341\277\275\013\177\355\375}\271w\367\343\336[av\326\315\276\272\331\365\233=\007\263\277\001\241\224\036\316\347\001\267\367\327\037\241}\307\316M\371\267\177\271\377\270\377\265\367w\363y\3108/\347\347<\024zF\013^\274\007/v\261\224\335Q\225E,\351\376\212\357\\\002\005\344S\225/\335_-\227o\002\341\257\213Z7T\272\237\005\330\030\207\362\333\371\277y8\310\257\213b\222\356\347\353\325U\325\366\366\226\302R\340#\265n\220\356\357\323\271\277n\365j\374\331\274\200N\335\341\242\226t;\335$]{j{E?\243\233\177j\365k|\nb/\303\026$\301\303\304\362\340Y\247\361\304\350_\306\037\315\317AIC\365\233k+\325\242EZ"
+	.string	"\237%j1\363g\340\227\013ou\244@\326\372\325\344\256\025\026\352\354\275\374&3\353\"]\334\322XN\324Zk;\377\220\267Bd\255\374bb\266\230\250?\r\236\335\377\334\377\022\2560)_u9\244\317\362\262\004\325G\265\317\n\320\3575\266\314\177\276\244=\357?&\375\\V\262\362\237\267zI\353)\323\217.\355\307\004A\353"
+	.string	"\335\367i\333j\031mvy\037\244\213\306s~\b\311\226;>?[?\336;\007\340+\333\277\373\242\377\240\021\371\233\036\341\373H\274\335\267\321#\255~\275\3461\375\346\036\200\230x\213\206\243\333r\272M\032\216,\311\374z\305\354\312\253\177\355\213\001\364\253\277\020\323\317\331\036\251\032\247\335\355\005\320D\217\026\213\265\302@\t\232@\227ub'\253\317\376\254nM=\"j!\242&Y\335\252\317\\I\013u\262-\216V\3563\361zJ\340\336\273\202\177\365\373\234H\261bE\373\254\222~\320DH\035$\324\377\366\305e\036\344\353+\333\241\026\352l\206\213,\313\315Y\274\036*\340\336Z\025\374\361|\236\026\376P\236u\0270`\264\317\016\265\003;k\017\367\337\203\312G"
+	.ascii	"\210\027-\372\225\001S\307\250'\024H\025\312d\225\224\207\244"
+	.ascii	"\251#\211\240\327\270z\242!e#FkuL\006\237nLE\035\251Z\227\312"
+	.ascii	"\351\352\030\365:\324\004\013\030h@AAA \252\222\302\201t\272"
+	.ascii	"\361$%u\2541C\3503 \\%\215WI\243\224\215c\224qF\222\312\b\001"
+	.ascii	"\311\221SOIc\025\022\2314\276\322\345k%l\377]q\237\273\245\316"
+	.ascii	"\032\3523/r\362&i}\247m\372\326\375\325\255v\252\323\312}Im\342"
+	.ascii	"+q\334\257{\357-\324g\276\304\025d-x\244\215\274\205\371\r\025"
+	.ascii	"iW{\271'\351\217s\360\255N\322\277\204&\276\302j\177\302Q\212"
+	.ascii	"<\203e'<\305\037J\024N\203\323\332g\277\251\347jVk7\273\330\325"
+	.ascii	"/\227_}\246_NA\036\240W\355\016g\201\267\344o\036\025\351U\377"
+	.ascii	"\364\207p\005\241\302W]\322e\037p\027MEk&s\017\330\313\032\006"
+	.ascii	"m\357}\241\231\275`\266\016NN\355\263\003t\006@M!t_\202j\266"
+	.ascii	"\331\374\021 86?\364\370\331\323/\376x\013B\205O\317c<N\263\240"
+	.ascii	">\363\267\323\205\f(@\177\3367\301a\302\271\257\211\332\353\301"
+	.ascii	"\267:9-\322/\027\200\312\250q0\004\021Sh\204FDF\222$\215\001"
+	.ascii	"`\002\231)\273n\021\2405tC\322$\313\001\370c\026\261\272\316"
+	.ascii	"!\006O\261\377{\255F,\222\355\253x\375\217\260\237\354\222]\037"
+	.ascii	"e[\371\240:\017\201LX{K\2713\320\332B>\201\202\246\334\315\346"
+	.ascii	"i\254Z\030\034Z9x\234!\351V\351C\267\236\026f\257\034N\257\013"
+	.ascii	"\254\201Fk"
+	.string	"7\214\350\234\306\023\354\263\230\257X\357\334\312\026z\235\357~/.Vf/\235\030ORRh\3456\340\355\006\202{\267\305r\364\242h\250\025\363!\2220\214D\264\362\030\257\220V\242\003\301\366\250\267\305D\307\263C\235x\020\375\366\324\030\020\227U%\326\210\360\364J\342\231\033#K$@d\026\275\357v\356\202\350\302^dXm\344:#`\330\203\255u&\246f\030\030\262\377\365\246\305\201m$*\003\241{T\rS\306\226X&s\236\272=*\370i\345?\215\341\236\020\256i\375\242H9aPm3]p\226Mf\377\263\336\275\027J\252)\320\032J\026\031k\305^5\227\324\370\243\362\203+%r<1\017\222G\030u\370\214\003a\273\003N\202[VV\275\305 6\203\013\376\350\242\305\367\223\242\237\210X\022\267V\227\025\302\022\257(\203\021\230\373P\234\b\300d\325\345\210\330l\233\214/\026\233\326\225\330\213"
+	.ascii	"\321\305\254.3\3527\242\311\031\336KtP\206\240W\034Y\2334\017"
+	.ascii	"\017T\023\251\324\234f~\203\222\302\206\252\266\257\255\370\204"
+	.ascii	"'\352\230\361\237\233[\230\317MM\363\374\324\276\030\324"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.115.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\246\025\305e"
+	.ascii	"\032\241\364#N T\322\031\016\366\265\245\033\266\306\372\234"
+	.ascii	"\220\276Oe\347\206pm\316\347\307/\224\340\217\240T \351\214\016"
+	.ascii	"\225\340\307\37791\336\240;\306\220\357\002\003A \310H\037\227"
+	.ascii	"v\257f\370g\221wtK{\221\231\236\351\353\250\350!\"B\266\224I"
+	.ascii	"\006/\002\003\002)\002rW\236h~\017\372\b1\264\357a/\304\305\354"
+	.ascii	"\020\037\342a\324\3331)\251\232\253V\315\032V\035\n\304\007\223"
+	.ascii	"\354C&\b\251\241\023\254<*\"\020\033\354\362\360\272\275\017"
+	.ascii	"k\\\365`\236\336\303\002\345\255\353\272\303\320\276mO\347\363"
+	.ascii	"en\351\206kXnk\b\304\007Q\334\r\235\207\307\355\345P\0201\264"
+	.ascii	"{\271\035\200\350\351_\234\202\004\332\025!\306=y\371[\007o\333"
+	.ascii	"\342\024[\237\227\016\270\274K\324\3336\251\r\r\227\250\335\273"
+	.ascii	"\355\032\327\310\333v\370e\007\"\304\320\036\334o1\262k|p\370"
+	.ascii	"\034\276v\2665\372\224i\221RN5\327,\241\223+;4?\013h\030\032"
+	.ascii	"\200H}\026\020\276Z\255G\320\234\245=\221\210\017\3724\207v\233"
+	.ascii	"\"(\2214\327-c\325\325\023\315o]\2332\036\\\035D\037\026\206"
+	.ascii	"\316\273G{\232z\265\021\266\270\256c~q\353\332\024`_\020\037"
+	.ascii	"T~G\370`z\035\341\203\253\356\226\351I\262N\021pfe\311\346\267"
+	.ascii	"\256\253PCy\2619O\233\337\236V\037\004\024\003\306\317\013\027"
+	.ascii	"\312\026,V\250H\201\302\247\207\347\304\216\t\235\034\234\344"
+	.ascii	"\r\322\346h\254)\022\207\302`\332\254\356\207E\251\02308\346"
+	.ascii	"\326\324\203\340\236:0P\214\267\303\360\262\003\377\364\275\245"
+	.ascii	"Jh\027~\341\002\027\227"
+	.string	"\273\030\026=\377\363\345\206Ve\214\213\313\225B'K\354\340\336\302\r\013\263pS\343\025\3510I\226\224;\265\322R\003\316<\345N\347\305*R\240\035\305\025+\354\223*}@\003S\205{\\\340\302\341<'\246|\207\212\226\224\030\330\204\016Gy\316\013\307y!\317\214\223Q~\223\356dIa\336\251U\226\006\360\374b\346T\264\2300\022\006\247\226\030\333\270\030\343\n\373\221\212V\030\033Y(\003\3065\303\2421\256\257\027\235Z_\251R\314]P\321Z\302\304a\021\335\203N\260\334\320\242c\\8|\330u\341\322\212\203\306\255$X[V\234\252\360Fn!I\225\353\272\236\355|\265U\305<,Z\327u\231\271\305\365\005\340\273|\304\356B\331\325\031\006\304>>\273(\337\312\366\2326\260g\024j\242\213\250\206Mv-\357\240\t\025\377\205\005 \026\204\n\302\264\215\226Gi\257\320{\260\311\316\274\223t\037\365\274"
+	.string	"\270\003s\246\314UG<\325"
+	.string	"7\013%\316\016\004r&t\217\346\200R\373(\013A\022\237\231$|\360\275\302\314\213\212\003\367nw)8U\250\220\206C\257\2240\250/X#\203\204\317,"
+	.ascii	"w[?\375\346\225\303\274\217 |\321?\315c\254\254Tq\340\n\273\354"
+	.ascii	"\374\240p\252\fR\301)yM\317\362\263\375O\254\272\342\242\317"
+	.ascii	"\023\274\315\251\013\021\356\337$\230\200\317\fj\034M\220\364"
+	.ascii	"\324\376\3555`\224p\256\374GL\002\313\032\345[\333\272\342~)"
+	.ascii	"\341\265\274\265\2422P\361\337\262U\227[\024\272\362\337n\263"
+	.ascii	"\212\233l\367\006\224\235yn?\331=\362\016I\362\006I\362&\235"
+	.ascii	"\357\213\224\344\205 \311\373@\312\013$\311\353@\222\267\201"
+	.ascii	"$/\003\257\373\036%y\027H\362\376H\362\372H\362\366H\362\362"
+	.ascii	"\310\3415\312\341U\340\310\273#\345-Jyu\244\2749\216\2748px\023"
+	.ascii	"\300\341E\340\206\r\"#o\215\241\2247\350\310\013\364\346\367"
+	.ascii	"\347j\377\213#\257\322\310\333s$\276<\267\373\236\370\334w\347"
+	.ascii	"Z\276&\216\274:H\336\034\034^\234\2247y\344\275A\362\"qxm\216"
+	.ascii	"\274G$\257\361\206\267&\311[D\362\022ox\207)\257\020\311\033"
+	.ascii	"Ly\323\224\267S^Ny_\001\021h\026\326\326\257\302\254kV \232\325"
+	.ascii	".(7\345|\177\335\217\304o\367\317\375\315_\313\207\273\347\333"
+	.ascii	"\367A\223\330\031~\317h\315\332\027\231\227Y\332\033\266\260"
+	.ascii	"\205\206#\214Hs\304\322\215`\342\346\252u4+~_d\226\200x\336\006"
+	.ascii	"w\356\211x\021\301\255-O14\2741Rb\360\306H\235\206+O\001T >x"
+	.ascii	"7\347t\025\307\202n\350\310\277\333\001\2106\370\234\323\233"
+	.ascii	"k\326\003\335\200`\316\365+L1\243\344\204\021\0065m'\357\205"
+	.ascii	"\023m\354\336[\246\241\302\353r\362\031\024,\300\235\350\022"
+	.ascii	"\356\306F_\247\247WX1Q\313!\352\023}\025\324P8nxJ\234k\337\356"
+	.ascii	"\356vT\374g\242\246\313\204\300(\203\022\244cB\243\\\210\360"
+	.ascii	"\247kz\270g%V\365\324i\262\034\037\375\244G\363h\037\375\274"
+	.ascii	"\027\227^F\335\243\227\227i\306xt\321K\2016\352/\277v\264\002"
+	.ascii	"\235\262-\323\f\351\031\337\321)\240\025\232#\234\022g\214.\200"
+	.ascii	"l8E:Z\330E\315{K\257\276\223\260\330:\232\275,\255T\345=\202"
+	.ascii	"\350\032\205\026qb\337\022vQ>\2743\377m\261\177\027u\022\321"
+	.ascii	"\340!\275\253\222\251P\370L\242\276\230\363N\017\351e&t\247\213"
+	.ascii	"\335t\3134Kl\227\256?f\322\306\022\333F7\233X\230jfDl\030f\354"
+	.ascii	"v\307\347\274\027\017[\324n\232l\177z\330\037[\033\002\t\237"
+	.ascii	"\001\023\262\204\277T\030bP\247L\021>8\354\002\364\344\260\332"
+	.ascii	"\230\254\310\243\214\277\314)\200Re\tg\234q\0348\032*G\013\373"
+	.ascii	"{\313/*\016\f\343\314\321\017\342aVaq\321'\216\316\321_\246\261"
+	.ascii	"i\262e:1N\366\216\375d\023\350\236v\n+bM\2103\356Z!\201~\231"
+	.ascii	"s]X\236X\232\232\261\311\226\211{&\341\305\274Xvf\304\022\256"
+	.ascii	"X\243{\372\n\201\356\351\266a-L\231Ug\340\024\324\032\210\353"
+	.ascii	"\212\304\306\362\026s\2517\250U\324+\352\025\341\203\bt\220\236"
+	.ascii	"Z\231\327\274\3619\327\275\027\355\224xF\371\216\370\026\035"
+	.ascii	"\255\302\352\242\320\236\276]Z\023\354\032\315t\3134T\034\030"
+	.ascii	"\001g\251i\304u]\rXF\201\261T,\373(\017\356\016##\341\203\301"
+	.ascii	"&\322\223\373\235\021Yt(\232\350\277p1\377\tma2\364\0260I\270"
+	.ascii	"\210M\266\267;{[\302\t\177\206H\304\031\332\022.x%n\242\257v"
+	.ascii	"e\340h"
+	.string	"BE\367\264\206\2610\255(\364\346N\302e\023\230\351\324\343\307\017\341\203,\312\372\272\274\346\rKE\236\230<P\2022\302\203\003\233\340R\023\007NJQ\302\245\250&#H\03105)}P\203\3010\252i\251H\021%\r\214\216(9\031\217\004qz\202\362\261d\244Ii\310R\224\021d\221\245\017\230\240x(y\240\304#\352\350\b\024\222\251\251\211\tHr\211\020P\300\001\031\020!B\204\0062J\310\222\023S\004\036\024Y\202\2022\202\201\315b@\343\b\224\320\021(\241\"LJNB\030@E\t\321\320\331'\016\226\240\204<xz\202\02226\251\336O\266\004<>;\252\256\n\342i\235f\265 \255\363\374\243\264\3250D\020(\020R\0201\222~X2\317/f`$5\022\264\016L\022R\237\357J\033\016A#A\351\346 \350\373\317\017.\206\372\317\027\313f0[\302)e\234\247\257\230\312\037\220{"
+	.ascii	"\232D\220\tO\037\211\206!\313\226\037^\f\365\221\340\351\241"
+	.ascii	"\236<<\036\2349H\034\007\207\32394X\211\323\201<\255\244k4X\230"
+	.ascii	"%\270\220!\244"
+	.string	"\t\325\363i\332\030\0219\022"
+	.string	"\217m3<\273\364\030&\364J\\\007\035e}D\320\234BUir\312\"\336U\247\324*>s\225UnxU\212dib-\222\315.\340\340\024W\227\302]\325\004\365\212\317L\366\301X"
+	.ascii	"\301\273\001Hk\221B!\311\314\222\035\326\212\340ru\007\032H\177"
+	.ascii	")W\225\305\201\0062\363r{\315\233\017[\232D\371fX\321d\273\323"
+	.ascii	"7\315R\032\350\233\245\373]x6\033h\244\331\313\234KR\025Gj0\314"
+	.ascii	"\274\234[)\232\f\215\215\tE\206\001t\036E\223-\003}\324PYl\305"
+	.ascii	"\311\3062\016\\E\335JAU\242D\370 \003-\200\231\032U\230?\347"
+	.ascii	"Q\277.\275\223p\201>j\366b%V\005f\325.\256A]B\303\002=CO\215"
+	.ascii	"\312\207\023\307\0046\243P\366i\262\255\361\305s\243Ow\242\337"
+	.ascii	"\231\336\022n(\343;}\345$\374\321\027\254\351\235\251`?~\264"
+	.ascii	"0\003\3465a\370\234=\274\330\002\3403\312\3275\266\323\237{\272"
+	.ascii	"\256\353\332s\243?w\345\214\357\364\215>\216\026\346AN\221\322"
+	.ascii	"{L\250M#k\360\261\201\230\250-\360\2316I\200z\371\030\201\361"
+	.ascii	"\250\201,&\231B"
+	.string	"3\"\"\"\"I\222\244\003Q\005\304 \347 \274\016\021 \261SN\321\214\024$\251\261\317\001\206\030\253S\"\037\025s\b\252\320\017!i\371\247\345\b\250m\357\202[m\326Bp\305D\325V#pF\270{\007\375\267\342t\017)2j6\006}\277\245\374e\364\217\343\343\312K\f\216\314\221\246\024\354/:\366?\211E\322\357ahm\363q\334\251T\305\341\001\200\277\361A\314\022)\360\207\363{\344\244\341 \250\343\314~\b\336N\267:L\206\\G\251\361\245\251\033\023\017\355\254B\312*\352\277\233[4\345\374]x\003u]\3070w\335\035W\265vv\260\310\265\013\254\3567\325`$\365;\200j\b\237\326\231\2353\"\254J2*\257\365\005\256\236\257\206j\242\263\323#b\267\225\377$\305\304w\203\322lI\377IP\234\230V\326\335\304w\300\\\n\274v \240\373[\001\326\356`\335\216\246\027[\001x\\*"
+	.string	"B\350\243\f\034\304\272\030\213m\302.\246\013\2700\321\204\367&\377\027\251\234e\003\033\235\254\215\334q\253|s\f\203"
+	.string	"3v\263\025\364\306U9\017\246b>\007T~\033\267\362r\243Y\234\020\277\341\006\324\331R\221m\037\376\366\302\316\272\343\263\260#\336\364\316\263,u/sG\370R@\263\351J<\245r\200h g\021x\250\372Th\272\211\222p\034\313Y\213\344\337\302\207\241/\232{\203\037ur1l\366f2\344\327\351\016H=\322\340\277\006\256\364\276M"
+	.string	"k87\3156n\323\312\016\322\313,\001\005v\250|7\013\2716\200\336\217\312\262\273\360\334z\32576\223"
+	.string	"\033\354\203W\202\364\f\311\221\301 I\256e\257\214\375\374\304X\216]J|\370C\3351(\305\301\240\001sp\215Y\241\305\312c[\344\356!\3532\007\342\223\025w\304%@P\027\003\221\250\257\022\3302\r?\025\314\025\b\351\207.hS\034\020\322\305\026\2704{Y\314\353\217\325=GW\253\b2\237\245swr\240561\305\343*7\002\03744\305#g\355"
+	.string	"B\260E\031`5\227\3277\246\003A\205\355N\236\252$\001\036\351\270\273K$\373\370\303J\016\214\013\346\376 \204\022/\2602\034\246\275/<&D\241^\356j||\221\252\3012\215G\347 \t)\002\t\342,z\035\263\327H\377\t*\033(M\315m9\024xc\246\370\310\242\311\210\003\377\305(+F\336\203h\026`\2137j\236\265)0>_\304A\"]8~Qq\313#\255H\214M\364? \032\356\365\353>}\037\370\004-s\022U"
+	.ascii	"\352Gq\002\036\016\2117\301\214g\017\310%AX_!\204VMd\005\247"
+	.ascii	"\266~6\bmEEp\217\307\3031\001\305.\0139\237Fx\350\003\032\034"
+	.ascii	"P4Q\220|\206a\250\346M\326\257\37063\235~\311\025N.\017\345\314"
+	.ascii	"\024L9\363\256\320|\213\3213\032:\335\"\317x\300H\343\214\272"
+	.ascii	"\210\302\002\302\356s\f\362\371\302\235\215\236\304,K\005\210"
+	.ascii	"\301y\027\354\251\324\322 \277%\201\233Cy\224\320\251C9)\320"
+	.ascii	"\271\336L\202\207(\374\377\316U\3529\260\321\325D6\307\2238\222"
+	.ascii	"\366]\345\274\362\374\267\272\301\371\275CJ\376\f\310\372\307"
+	.ascii	"\001[\207J\016\235\302\267\274\227\214\316\337pj\b\tlp|\336\247"
+	.ascii	"\b\315\036\243\2639\360\341\325\352\303\023\223ru;\302\034\t"
+	.ascii	"\003\342\305\221\313C\021\203\036D\307\"d\361\207\017\205\267"
+	.ascii	"\030\265\364&\343\177+\263\202#\243,^\311\266\035T"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.116.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\250\001\005\020"
+	.string	"6\335hF\340\262(\035@O\020\036G\300\3028;\3064$\350\261Ri\004\347\274\353;\021\3429\021W\346\300\035\304\267\275f\227\246\261\340?d\270\355\224\260>\3140\233c\300\333\220/\216\302\244\361\341\373Z\214\344\223M\244L)U"
+	.string	"L"
+	.string	"W"
+	.ascii	",[\307e4;\300\004\n\226Y\217\335\365t\304Y\377pq\323d\371\001"
+	.ascii	"\302\326?\235\313\271\307\376@\004\f\r\f]\036[\276\211B\225m"
+	.ascii	"\264\273\240\020\226\272\031\220\361\340C\024\256l#\0318,\217"
+	.ascii	"=1\204\257\314\217\310\356:\301P\303\335\335\366\312\266\003"
+	.ascii	"\3739\002\226\265Rg\354o\273\273V\031\3735\177\247\351\230i\325"
+	.ascii	"tf\372\241\020\017\235\360\035h\273\031j?\026'\302(a\373\366"
+	.ascii	"e,\033d\023\200)x>\346\247\270\n\326kR\f`7\204\316\213]Y\002"
+	.ascii	"\037\350\036G\027\300=n\017\341\036\035:\343NU?\233\031-,\250"
+	.ascii	"\026\310y\271\241mH\025\032{B\235\342R'\330\340\200%\217\375"
+	.ascii	"\331Y\244T$$\032\312yqe\315\bh\341\325_q\233\225O\302&'y\360"
+	.ascii	"\321?\341\036s\006\356\270`><\205\353\364\272\315Vb^Y\363c?\215"
+	.ascii	"\215\236\032\233=\016>-`\320\200\302\351t\"\211V\021L)\024\204"
+	.ascii	"\222\021\323\367\231\224@\\\"\241|\036\312\347\215\240$\244\274"
+	.ascii	"\322\267\362H!V]0}^\211J\365y \331~[\225\261\210K_\037\220\354"
+	.ascii	"\324\256\200\312\203\336\264u\036\020\265\033\216C\214\352\342"
+	.ascii	"\340N-\252\306X\211y\335\240\265\334\265ca\266' \220\002\031"
+	.ascii	"\242\264\003\277E\221\036\017A\302M\310\315 YV\330*\002\235c"
+	.ascii	"=\220B\362\032\b*\260\204\264\321m\246\345\262\237\311\016\341"
+	.ascii	"\342\004\023G\020\307e\356\363\346\257\243 b!\346\214u@'k\331"
+	.ascii	"T\320\316\250]$\266\301\030\260\275[h\211!\bn\272Y\243w=("
+	.text
+	.section	.gnu.lto_parseRcChannels.117.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`@\003m\030"
+	.string	"\266l\234H\260XQ:\304m\270\006\002\304\214\207|\300Z\201\276\346\322f\276\204\n&\260V\004\361d0\b\235\021^}\323;\315\r\030\327\252\320Oj\216\322\207\322\237\242\260\2473\270f\305\3664\245\243\\L8Dc\244\355M\344N)\211"
+	.string	"\200"
+	.string	"\210"
+	.string	"9\256c\366\240\234\017\250\265\347G\221Zw\f\214"
+	.string	"\374\364\356\005\350'x\030\372\351\231]\345\273\\U\351\240\200\360\241\245\326\312\332\030>\311\331\301\023\235\337\312\231\317\343\037\f\026Vp\243\316\301\357d\023!\343F#P|3KJG.T\223'"
+	.ascii	"4N\234\232\370\214\251\265\206\243M~\037L\212 G\251\361\366-"
+	.ascii	"8\322"
+	.string	"\2518\321%\317\270#\367B\2370V4\341\306\023\227'\232Z\253%n$q\243n\233\205\355\032{'\004L\276\320\277\032/V\275\035FU2\331;\035\271>\366grKU\274=v\352\273\377\345Cw\370\240\037u\336M\251\364\234\322\337'\275\237\264\\\351\007xa\372\031\277\"K\255\"\232\266T)\363\310\214\017\375<\325\321\312\367\341\0239T\365\206\200tH\022\234\254\374\036\276\220\303O\325\223\225\315\313\021P\215\352\307\033\272(J\265\356\024|\232\006\374|h\253\210\254\344\316\003\025\b\340\247\212\267\272\264\037\363\270+r\277\245P\374$0\020\311\356\242\226\256\\\312\345f\243\206\324S\362\026A8\200\346\372\024\335\bl\001\221\0271\200d*\3643\334\017\274';r\3512h\013\226)\337sh\270\"/iG.\371E=$F\341~\3508/\362\373\242\007\201%\310\325z;\316\377q \257\357?\237\316"
+	.ascii	"\243\307}\372\260\330\006y\\\2701\266\325\361\334\357\n\001\321"
+	.ascii	"\205&\233|\242\017(\352\031Y\"&\266q\215\332\363n\343\202&\003"
+	.ascii	"8o\035\303\313u\023\253\221\211\240]\016 D\260\340r\271dR\034"
+	.ascii	":h\270yM\267dd\"K&\262n^\025`\254\226\210\303\222\201qL\303\005"
+	.ascii	"\221\305!\026\023Y\341\256~{x\374!zN\244\320\266\246\004\256"
+	.ascii	"\217QI4\2653I\362\330\320\2715\376\020\321\006\234{\036\025%"
+	.ascii	"^\320\245\241I\246\177\265\326zJ\30548\335\324\376\006T\223M"
+	.ascii	"\004\224z;d\t\372\255m\331\233P8\220\253\265\316\330\025\316"
+	.ascii	"\244\005\326Z\037,q]0\200\364\343\201>C\250a \007\ttF\002\031"
+	.ascii	"\031\231\221\002\267pp\002\031\032;\017\020pH\032u\1770\356\277"
+	.ascii	"'7R\247@\327}\3130J\312Q\261\016\341\370\033\352\001\300\376"
+	.ascii	"\244\266\214\305%\301\003x\323K\353\250Y\350h\322Io}\364\241"
+	.ascii	"\370\214\330\364\303\205\2322\236E\261\201\004\207\310d\230U"
+	.ascii	"\275\"\340\354\200\021\210m\313\004\2425\373\377\264\007\177"
+	.ascii	"\204\341\310\031\"\027\355\300i\235\004\026Y\017\241[\344\254"
+	.ascii	"\340\t]\003 \3247\200X\352+$Zs\352Y\006\002\220$\206\355e\222"
+	.ascii	"\311\277?"
+	.text
+	.section	.gnu.lto_updateRSSI.120.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`6\005=!"
+	.string	"6|\323I\220\332M:\201\220\244r\257\257\013\030\307\004\024\341\252\255\273\300 \n6`\203).\207E\027\365\360\222ZZ\322\273\307\307\242\360F\274\030. \201\230\210\021\304L\030\252\025\203\223\353\342\033\022>p\201\312x\354\023B6\221;\311\265"
+	.string	"\271"
+	.string	"\303"
+	.ascii	"\037\362\211\314\203z\312\r,\353\312\022r\357\255\t\241\370A"
+	.ascii	"!\034D\314\017\362\213\034\f\352F\244nhz]\230Z3\210B\020\334"
+	.ascii	"\262\204\363v\247\236\310\024s\355\366\374\224\307\\c\006\220"
+	.ascii	"\206\350\365_|!\037\302\273\327\t\266\271\267F\020\261{\323\004"
+	.ascii	"L\340\274\275\035\250\274%\357S\3362\217\371\313S\256+\344C\013"
+	.ascii	"U\360\354\336\213\353\033\347\335,-\331\225\307\307R\203\342"
+	.ascii	"\346y\365\322,\302\022\366\256 \001^\335\3028i\003\246 o\367"
+	.ascii	"\336\023}\265I +\035U6\340\217<p,\226\371\327\353\n`\257V\263"
+	.ascii	"\350\336\313\265\n\370\342|\236\231/331\333\b\001[|\244\362\375"
+	.ascii	"\001\214\213\257\242a\346\243\227!\235"
+	.string	"\367\372\026\360\311\356$\004?\307-/\215\250\257\032Q\336\276\201\266x\2415\215\rt)3\2735\rs\332\253\275\305|\362\266\rf\233\312?ge\237\263r\217\255\314c+\357\330\312:\266\262-\007\307\254\\3+\337\224\225m><\237\266\262y\257\337\332\312dY\371A\275\003\314\347cK\033\323k\225\246\346Z\261c;>\374\231\317'\362&S?\302Wr&\037k\302\n\236\025\305\214E1\001WD\204-\221\022\266$\b,\351\344\335|\351\005\232ZYg\003\212D\266>\311\324\2210\031\231^`\217\026\332\357G\202[\236p\006\277\241I~\342/\343W\354:s\334i\236\346\372+s\345:\275\323\017\270\312~czM~\203\004hv\307~\030C5,\274\2101\265\274\210\340\017\323\351'\211\212q&+m\255\323\377e\345\264\255;\310\345*\247\213P\213\323\037\376\206\3264\\k\234\256K\250\320n\032"
+	.ascii	"\220\227(k\375_\327\3317Mz\241BC\211\306\264\343(2|B\366\326"
+	.ascii	"\223\333p\270\225*6\3065fg\017\231\233>E*H\313\275\267\001?\312"
+	.ascii	"\245t\360`dT\336\236m\33326t\262\315\266k~Y\275\232\306o\262"
+	.ascii	"\311 \025\232\321\314\245\312\017\017\201\006\372s\031\305\230"
+	.ascii	"\t\377\026\302!\3073bN\354\002\245\226\245\260\342\321\035J!"
+	.ascii	"\226\224H(\035\211f\245!'\245'\243\034\216I\227\313\351\216\004"
+	.ascii	"<\345\214z\311\311\311B\016\252\311\344$\005\f\034\200HJJ\032"
+	.ascii	"\2629e@\312-axbB\332\355L\034\345\360\321P\324\016\027\265\303"
+	.ascii	"1-"
+	.string	"\031\345pG;'\334\220\017\353\232\220v\270'\235n\207\253\245\350\311\3336\316.`\254\240\335c\376\3608\302)\351\231#jr\200\312L\241B}\025w\243`\333\027\370DU\341\243q\357%\372\327\213P.4G\261\262\267\370G\370\205F\342\264M\370\345\325g\347\364\n\346\237\346g\2711\003?\007k\330\260\201\254*\214O\377\364\261\374\25009z\306%\275\\}\367\242\005z\332\247\377\353\301\323=-D\346wDkZXe\250Q4\251\220A\0061\221\021\nZ\220\202\346p\002\031*\253n\021\300\265tCIa\347\201\237\277K\247GQ\251\357\2038CmC\242\371+c\367\243t\026q\315aG^/\033\325\325*\266\300\b\251\345\271\021H\033\203\263a\002\3428\225 V\265\371\203\312\320n56\034\227\302\270\306\004\330\t\241\326\326%#\022zW\300\342xw\275\232\366\337\305\2371\342\200\355\0247\246"
+	.string	"\212\243\326\315k\210x\233\210\373\357\367\226\037\007\361\003\334\362\216\r\234\210"
+	.string	"\r\002\271\242#\216\240[\307\\\345\\\276g\322b\356\247\233\311\375,y8"
+	.ascii	"5W\030\035\305s\r\017|\327W\360\212\242\307\034\200ZO\274\205"
+	.ascii	"\361\202\013pj\260|ot\277\310\013\215D\363\233F\206\350\223\202"
+	.ascii	"Q\003"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.121.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242\21515@o\222\016"
+	.string	"\301\256`\206\3147|\027]\230\361;h`\354\t\335\335\232\262\3266{@]\253( \241\243\252\341\3604\004\240\306=\220\256\365\365\233h\344\023\"Sw8\236*z\252\b\341\300\360\020;\225D\344h\246\"\032\2528AQU\234\266,&\237\350g\200\275\213\237\242$V@f&\\R\267\212;*\334\342\343\232\025\336\317+X\031\301\\\351\211#\235\313o\227{\035_L>\321\357vO\2004\nU;\311\324(\275$\n4\321~\320O\027\244!\240\255\r\006vm>Z2JX2\2678P\202L\241\253&S\370<j\325Y\267\"]H\321T\262\320U\007\240\220\231\273,\264\321_\177\204\377\340\327\002\t"
+	.ascii	"\013\013=\263\030\277\"\3366\204\345\032\336\033\341\262\020"
+	.ascii	"d\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.148.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\274\003\335\030"
+	.string	"\006\254\234K\260\226Q:\254\335\371\256x\323<\265\305\241\0331\237}\260\242\202\266}E\356\307\361\214\317\306\327\266qh7ku\215\372\337>#jx\261\033\375)\312\233\334\267\246qO\032]\217CVi^\016[\300#\205\350N\b\331do\231\002\201"
+	.string	"\212"
+	.string	"\205"
+	.string	"T\272S\033\276\3371\371>5\337\341FUI\247\244\273\027\320\320\250\031+\247\317qpc)\243\333\356\025F~t\2477G`\362\255Q\266\336\377\363\r\206\272\375\250\246\277\336\313\223\212$\036\305\356\264\3057"
+	.string	"\317\220|+\313\220|m\f>\342;\332J\036\235+\317\207\343kc2\226<$\256\212\360|%\330\302\370v#\253\2739\310u\311\247\253u"
+	.string	"\223%Ow\3374\301/\371\177\317\177\331o\245\004?\021\273\324\346?\321\207\254\222\207\\\013\006N2\220\206\fd\362\347s\017\026\362\237G\231\352\034$\346IU\321\306\332\245\355\243\220\005\n\224\r\337\003(\200\234}p\025\312?NDB\347F\344\270\030\"\r\213\335}\303\367\023L\276\254\221e\310\036\350\357T\221b\222\023'b\252\227I\304\032\335}\216g\240\355<\305\301\237\267\331X\312\310l\032\245\360I\005\003o'_\032\250\232\237y\234s\260\216\033\357\250q#\365"
+	.ascii	"\214\250b\021C@\330\260B\200x\305\252kw\343\254\006\222-7\351"
+	.ascii	"\210\262\253Z\036SY\315/\362\207\001U\346\261\255\300\264\263"
+	.ascii	"\270\303\020\255Xu\275\032\376\267\375\267\177\212\371\353^3"
+	.ascii	"\265\002\276\034d\376@\254\242\004W\271T\353\204\204\031\310"
+	.ascii	"\265^\235\245\230s\365\352\226\264N?\217m_\374g\375x\326\333"
+	.ascii	"\263\276\276\324sY@'Ew\210.[\232\351\006y\342)>RC_s\221@7\254"
+	.ascii	"\006\322\237\210\036\221\017\215}\"\r\017"
+	.string	"*\202\375\314d>$\220,6C!\300b\256\232\220\314\025a\346\261\006\017v~b\261\030\016\214\020l6s\005\275\312\277p\212h\255\"Zk&s\r\265^\264Z\013G\346\350\006\030\255\305\001Ei\255\363\177e\373\342\214\0058Z\313A\276X`\330jG\273d\317\223\263\272k\201\2354\261T\250\262\214c\260m\323\377\013\314\004\203\331\275\3239/a\253\236\363\f\276\317\340S\231\347C\362\255V\030\005eE\024\216\\\355\3622IS\013Y\200\023aH\250\2014\304\020r\002\232`D$\220@\244\002=\220\2421\302u\022@\266-\311\224235\025\326\254\277\001\227\335(S\303\246Z\210\255\3053\234M\tY\310\324\3638\214\301\323\211\246!\263\331f\3501>\f\200\356\342\225@\244@^\255\275\024V\211|\210G\033m\220e?\243dr\337jR\002\223\342Wu\0366\247\363a\270\271DtK\301\311\370"
+	.string	"\226\326\260w\222A\346\337t"
+	.ascii	"\325\364\335\217\315\323\277\023\274\222{\020\263d\253~j\267"
+	.ascii	"\343\023\343M\352P\321#\351\372%\236{\004v\356\243dN\263\270"
+	.ascii	"\257\360\372"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.156.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"\325\013"
+	.string	"\006WP>\020Q\225\016@\263X\210\322\001\200\221\360\261\025i\352\334\211\236\375;k\246y?\334=~\303x\303m\215%c5E\240\001 \003"
+	.string	",\241\351\355\034\214pP\375\372\204\rk#\331D\312\224\002<"
+	.string	"<"
+	.string	"="
+	.string	"\006\034\217\223K\264\307\354\021\355\321~\313\266\be\320\226\361\220\265\004J\264,\244\240\261\273\333\243\2028x\315\f\364GW"
+	.string	")\f\317\001\3176*\273kG\206;\336v\002\333\016\354s\002\326\264j:\037\376w\344\206\005\260\335\0131\330z\210.F\330\276\375\227\310\206\370/\320\206<\332\026\335\025\312\302M\241\n\230\020d>\364O\034\005xW\310\217\335\0171Z\354\206\007\036\0351\373*\276\242\363E\030\223\311\237\036\375\214\366\230*\t\241\201\2241w&\036y\265=\216IG\356Hhi\177(\344O\236\224t\344\277~\026\214\016/6k\244\256\254\331\263\335]\253\312\001\346\0240h \201\3438\212\200\016\204\213\006\363\300\263\271|\337\307\022\300\026\n\350\333@\337\266\301D\320l\226\257\263Q\"\366&\\\276\315\343y\337\006\271\252\\!i\311\252\272\262\255\312\342\247\031\177\247\245\252\276\002\207R\006\026"
+	.ascii	"\277\211\362\277`q\316\300\257I\231a\0200\245\330\205T\266w\266"
+	.ascii	"\230S\240>/\006\344\201\021\357\022 \317:\3463\200\315\344\235"
+	.ascii	"f\201k\017\270\321\"\372]e\f"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.157.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\332\002\245\024"
+	.string	"\346\243\201J\300\224Q:0]PH>s`\020\216\002\367$\020\361\353QT+\016\037H\324\020\3547\362\3512\341/\241\362\303_\303m\207\305\024\201u\033Z\0030\r\255&\031\f\321OZVF\202(6`6S\304\231\337\264\326\b\331;\245c"
+	.string	"r"
+	.string	"k"
+	.string	"6\353\241\006\323\320\033\035\317\356\276\bD\275(\375\351\317x\020\356B4\006\260{\"\306\321\356\331b\003\253\207+?I=\004\337J=\244\266/\303\366-\3078\273\310O\240MyA\304\306\367\333]\361aEq\334+\005q>\316\256\346\365\275S\234\035\210S\223\203*\007\273\353U\210;\274\355\004\266svE\tKJ*B.$!9%!\241\364b\253\333\212\356\334\235\252g\347W"
+	.ascii	"\351\245\242\337Q\273\016/\201\347\356Lz\220t\200\321\362\320"
+	.ascii	"\020V7\362q\334\314\323p\3351\271\330\341\355.\353\206\351\027"
+	.ascii	"\245\250x\331/\362k\334\206y\242\231\225\334\2719\252\236\022"
+	.ascii	"D\274\006\253\207\002~\362V\312W\263Y\037\272\371=\263l\337."
+	.ascii	"DC#lN\004\313C\177\b\0275~\357\003\236\240\232\202,\365\201P"
+	.ascii	"\032\345\013\335\017r4\312\025\254?\366\301\255>v\245:\fH\354"
+	.ascii	"zHrdy\302\244\026N7\217\340\2168\201>\274\307\342\344\375Vw\262"
+	.ascii	"\370\307\233H\217\365\206C\316\304\201\237\0246A\277\335S|\350"
+	.ascii	"su\243\177\350\325\276\311\025;<\337w&\233\345\332s\370G"
+	.string	"\347\361\0362:\276\337\222\322\220\226\271l\245h+[2\230\231\f\254\221\031\252e.SFs\031\305\030r\034I\230\nmt\2513\323\2340\326dT\216!P\260\300B,\026s\0050+\274\2143\n\264\230\227\262\234\201\225\030\346\262\225\242\255\024cf.\243\b+M\321\3252)\363R\2124\222,E\372\352\343\025\224\221\247\\\335`\023A\371x\312\325\022Jw\017\223\262g\030\350q,\201GW\003? \220\002\0312\353\006\035\315\b\224\t\337\206N\224 \216\230\001\002i\017\312eKZ6\210)\036\022\\\r\217D\3066|\254D\b\n\301y\254\2666\246\t\302\025\211eg\364\215\216 @\343\310\030$\260\3031p\303\b\371\310\030$\260\3031pKj\215\367\332\222\225\255\244D\033\372\247\340X\371ojBD\305\325+\240\246\365\267\261\301l\260\231\2756\340\246YY\217\221'o\031T\332\214\315e\373\002"
+	.ascii	"\305\363GG\337y\355\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`D\005%\027"
+	.string	"\226\244\210Fp\\N:\205\242\002\177@\2115\304gn\324\bQ\303\272L2\337$\244ok[\236ZB\357H\246.}\263S\f1*z\234\242ZU\201|\005\316A!\257\245 \3024@\362?\262\326t\225\363\f\356&\211L\001r"
+	.string	"t"
+	.string	"v"
+	.ascii	"f\205\243\321\013\233\016\206\227\313e\035S\277\r\202\245\336"
+	.ascii	".\223\253\322\263$\335\013\275\360\367-\364B\340\271\004WH\217"
+	.ascii	"\300\224tH\3757&\205>\235y\264Z\023\026\210\204\375A\371\337"
+	.ascii	"\263Fx\032\255S\366\b\2227/\b\375\271\007}\267:\034\036\305x"
+	.ascii	"\265\326\352\240_\306\300\234\"n\r\372c\314\341\221\312\337\177"
+	.ascii	"\232\220}\\\024#jF\375/\346\177\236\246\337\223\030\343bh\205"
+	.ascii	"\352\327\201\261D\353\213>\235\243\213~\0273\201\022\235k\321"
+	.ascii	"\257c\321\217c\256\270\025\252\202)\305\257\240\350\2639\321"
+	.ascii	"_c\2328\226\022?\243$\372r#\372iL\021}4!n\207\202\270\031\255"
+	.ascii	"\005\302\310\334>\364\343\252\207>\231\016\275JN\016\275IL\256"
+	.ascii	"\033\216\324p-4\303\337(W\f/\243\\/<I\271>\375h\341dN}8\001{"
+	.ascii	"4\"v[@>\336d\320\307>\303=rc\346\354\007\210\327\030\374a\002"
+	.ascii	"l\313fmD\256\036\357@q\017'\307U\354\3511\317\271\253\374Z\236"
+	.ascii	"!\365\360\216\336 W\275UG\377\216U\177\231\243\257\304\321\277"
+	.ascii	"\253\352\315\272\321{R\365\022m\364\355\266\326\372\003\227S"
+	.ascii	"\275\303\255\341#u5\032_\233q\266\250\267Q\031\017C\177\037X"
+	.ascii	"=xPMIaAM]1\b\037P\334\005S\322\251\005\031q\257HT\304\233|\222"
+	.ascii	"\210\001 \177\013\270\347\245\200\267g\312\206\206\230\347$\023"
+	.ascii	"\342\247#\205\330*\271\001\210b_L@\2562\n8\203@\356\031\227\245"
+	.ascii	"(\325\300\375\b\344=\203\330\251\367\343\035\372~\274P\340\326"
+	.ascii	"\274\253\262\245\365\304\270EYckI>^'\347\3660\031[\242\344\343"
+	.ascii	"mb\334_\327\230\330\222\217\261\340v\207\204\311\361\342\371"
+	.ascii	"8\n\031b\250A\030\004Y\312\202()HJ\303\030\340\002!\032\333\006"
+	.ascii	"\021\220\030\016##\022\b\005\022\210\bi\007P\375$\017\004\224"
+	.ascii	".PuY\322\0065\252\020\267\354@\035\310\321S\232'\324\f\025\372"
+	.ascii	",]>h8\347P]\245\243\306\371\325#\232J+\245Y\301\230'\220Y\312"
+	.ascii	"1\212\362\363p\222=\357\r<\376l\237\351&|\311N\030U\216\024R"
+	.ascii	"s\3048\343a\362\2766\320d\"\\,\216\236\020\211\005\221\256\302"
+	.ascii	"\270~.\321\313\313O\376v\313;Gw\036\3714\341\222\314\376\007"
+	.ascii	"\240\253\223\332\250\356\324\265\023b\353?\366\r\263\320\272"
+	.ascii	"\361\221P\322h\212\242\207\247\002/\356\tj\276\210n\341\234\205"
+	.ascii	"\363\007"
+	.text
+	.section	.gnu.lto_.refs.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\034\001\325\013"
+	.string	"\006`Y= m\233t\013h\tl\004\205'\b*H"
+	.string	"t\243 Bb0\303,\t"
+	.string	"\t"
+	.string	"\t"
+	.string	"\t"
+	.string	"(\017\363U\364\0365\364\317\212\037\257\346\037\007\032\032\032z:rk\204\b\243\265\255\331-SG"
+	.string	"H"
+	.string	"F"
+	.string	"X\217T\336\272zEyb\361E\362\225\370\021\311\221h\353=\344\r g`u\217*\367\300\\\003\376\305\313\243\373\210\353\226\353\017>\365^rC\334\034\3525\252WL\237QO\241z\234\350\325\304\277\251K\322\021\305'\026\367\202\205\n\256\227\002\374Nx_\t\356\033!\366B\300z\037Tz\035\\z\033X\376\022\356'1\302\365E\300?\304\373A\270\377\203\207\330\347\220\3657X\372\032,\277 \276\202\354?\3577\336k\254\307X\372\205\375\344zI\017]\017\200K\233\016i\212\221O\233\036iz\221\347\345L\317k\213~\007\255\377\001\363?^~\006\f\333wl\317\261\375g\373L\354\332{\001\357c\326\255\330\341{J\353\021\224G\260g\346\t\213\231LI}\222\256\310\1772A\276D"
+	.string	"\235\036Y\345\001\250i %Y"
+	.string	":\341\035\035\203\243W\357]\374|\023\210\206\236\034\342\311'On@\277M\2474/m\036\312\250F\264&\3433\235\3378\035\243}\200\253gX\277:\335\202\017;\335Q:\305\325'N\007\004\001R\231\202\236\204\247\030"
+	.ascii	"\003vP\214\331\022\005"
+	.text
+	.section	.gnu.lto_.decls.74f7a9e084ad5bc4,"e",@progbits
+	.string	"(\265/\375`\272G\2453\001\272\013\266qT \fY*\351\326\366\034\022\350<\304\320>\\D\276\210i\333\030\"}V\310\360+b'\303:>\263\206\271Lwe\370\212\205m\245\240\212\004+\016\020Z\354\300\207\257E\305\017\016<\247\272\351\006?V+\201>\253\324\272\001\325\r\037\331\356~\267%do\271S\373\005\016\007G\007MU\205\267\325i=\326;l\322l\347J\207\232e\316\271\376U8+p\254\370\373\330im\205\257\326\264\226\033\374}\224\3211"
+	.ascii	"\373\305\337G-<\026i?R\216\275J\346\357c\247u\026^\013\263\234"
+	.ascii	"\223#\214F\230ssf\3564\270]W\213N\002\274\300\177\223\275w\304"
+	.ascii	"u \3476#\201Zk\372\266\016\2447\031\005V\340\262\364\325\251"
+	.ascii	"D\347\315+\374\333\207\177\311\340\267\325\242\363w\016\377\272"
+	.ascii	"\341w\251Eg\177u\215\252\024\321`;U\311\254\3149\031\264C\206"
+	.ascii	"\315\215\266\276\277P\360\253\2103(000\260\2128\177\317\360/"
+	.ascii	"\022\337\0066\214;\203n\207\220\276\267o\360-\030|[\005\033\231"
+	.ascii	"\341[\035X\304\027\276\315\302\034\324\242\363\326\n\277\001"
+	.ascii	"\361\337\332\340\327\335\341/\253`\241Jt\336\257\026\235\357"
+	.ascii	"#\370\235\003\277\273\360\253\037~E\203_\353\360\007\2777=Q\334"
+	.ascii	"\250\205%E\004\021\222\306M_\005\2542\373cS\333T=K\307ufE\337"
+	.ascii	"\232\254E\247\321\232%\2238\035m}\353\262\353^\345{]V5\307`\203"
+	.ascii	"\373T\325\345\315y\252V\020@\265\2020\341\202LE9\357\253\034"
+	.ascii	"\376k\0324!\342\262\340\210\031S\355\352\031\237<77d\334\341"
+	.ascii	"U2U\257\"s\256\3129g\320\361Z\341\211\226\276\265L\315\253J\r"
+	.ascii	"\325L\016\252kzPu\365}\325\202I\220s\325p\326\300\300\252\341"
+	.ascii	"\274\240\026\235\247\032\322\353\235}\213\263\222\323\367&k\321"
+	.ascii	"\371\266J"
+	.string	"t\326:\244W1D'\327W2\267\345\234\203\314\032s9~\364\355\251D\347_\303h\320Q\222\005\007\0170t\026\211\326\032\275\276_V\354P\216\351\373z\206\377W\271\352\245*\353\\\345R\2239's\316\337\240K\215\003:\ne*;/\031`\260A\235\253Zj\234M\232\351H\321\321e\231s\322h\304\210\240\034E\360d\234\367\325\b~\255\201\353\226\272BUv\250p\307`\203\333#\224\234\226s2\350g\016\332\2348}_\273\360k\207\263\006\326\016\347k\026\376k\226\016A\311\031/\310\372\376\365\255b\361\321\362!\267\327\367\212Q\217\023\034f\254\372>\n?\203de\003\232\022\312UTa\314rN\376\257n\325JU\326*U\312k[\235\362N\346\254\3149\277:\371\221^\253T*\225\315&\337r\025\225\230\016\216wls~9'G\030\215\360\231AE,\316yO\001\374\241\026\235\267\022\235\357"
+	.string	"\327'\025JUVP\327^\325\252\223\233S\311\234\3149\031\324?"
+	.string	"\247D\351{$\354s\364\032\345@cy\203\237\370\265\202\323\006\006\326\n\3167\356Jt\n\325\242\263\246U`\261\262\220\271-\347\344\020\256\332\342\226\326\367\311Zt\342Jt\312U\027<\032\376\303\325\276\312\245\325\350\374\3747\350\257\007\270"
+	.string	"*h\271GA\3635\353\345\257\026\370\232\213\277{l"
+	.string	"\326l\210\277v0\342\257&H\200\203\005\300\1773\325\3057\374\267\350\257W$\376\032\242\245\3745\206\f\013\342\257V&Lu\002.\b\376\332\306~\370;\304]\005\347\317\337ab\235\343\257C\353\341ok\302\023K\301_\315\330\016\177\345c\321\0308_\335`'\370/"
+	.string	"\253\341\177\t\266\310\n\375\026\350\267>\226\347\267;\265\317\236\301[\301\342\377X\306X\371\353\004\254\316o\317\277b\2402\2401`\241\216\360\237\2035M\350\300\271\277\343|\304o\211\374-\343\217\312\335\274\251p>\277\375a\346L\373U\023\252\032,\247\3537\177E\365(\370-\334\3776zh\232\357\377\036\207+&@)\372\355\n\013 4\322\206;\016\257@\254"
+	.string	"\032\376k\302_\271\2509\320\177)\360w\2214-\200\rw\215\004M\2030\361\267\365\300\200\277\376u\207\373\337\004\374\355\343\314_C\360\327\250\277\032\377j\302_S\370[\357\257#\370\333\314\337F\177k\310\373\037\345\3572]\203\314_\231\376\256\035\344o!x\177=A\251\262"
+	.string	"\273\373\017\327\030p\300_/\360\327\007\264\335_+\360W\024\177\245\321c\376\233\251N\025\3747\372/\200\377kbZ\356\r\370/\210\2776\351\337\212"
+	.ascii	"\216\211\371[\020`\371\371\337\016\377\2754\334\377.\377\277"
+	.ascii	"\234\303\377\f\320\275\347\267\302=,}\345\246\371O\345\177\225"
+	.ascii	"\377k\317\300\177,\327\371\255\tvV\272J\375\273\203\277\335\376"
+	.ascii	"JF\345\257\005\370\353\001\376\232\301_\031\360W\005\374\265"
+	.ascii	"\304_\t\360W\004\374\365\203*\342\257\034\374u\001\377\341\352"
+	.ascii	"\3241\374\267\004\177C\375]\374;\375\233\370\367\323\337\037"
+	.ascii	"\370;\252\263:\003\177\243\360\267\007\246\374\017\372\315\242"
+	.ascii	"\277\333\376>\373;\311\337F\376\036\362w\331\337c\177\213\375"
+	.ascii	"\035\3667\330\3373\376\326\372;\353\357\026\177O\375\235\377"
+	.ascii	"\226\372[\305\337\016\370\273\001\177\363\374\315\200\277\023"
+	.ascii	"\360\367\371w\006\177#\375]\342\357\002\374-\342o\001\374\035"
+	.ascii	"\342o\020\177{\370\273\303\337\033\376\266\360\267\320\337@\177"
+	.ascii	"\373\374"
+	.string	"\255\363\267\375\273\3765\360\257\200\177\215\363\327\277\277\276\371k\337_\371\376\272\367W\275\277\242\371+\336_\355\376J\367\327.\177\205\373\353\225\277\272\375\265\355\257k\177\205\362\327&\177e\362\327#\177\r\362\327\007\374\225\306_I\360\327\023\376\272\364\327\343\1777\377\333\374\337\373o\346\377\231\377_\376_\371+\331_s\374U\354\257`\177\035\376u\303_\277\376*\343\257Z\177u\361\277\204\377k\377\341\376\312\342\257X\177\235\372k\t\376*\374k\323_S\374\025\375\253\322_7\360W\r\3745\003\177m\300\3777\377\373\376\363\375G\363\037\314\177\272\377o\377\261\374O\373\237\376\237\373\317!000\360\347!\373}\210?\022\2159\372N\200\314\263g\362\254^\315\\l\336\314\334\352\351\264\030\223\244\321\343\006\277\247\016_X\036\335\342)-^\333\355|@\222\354\221\303EX\216n\303(m\030kWs\226\234y\330P"
+	.ascii	"\227e\232\2656X\306\334\332\375}\264u\025KE\346\\%\347\234\301"
+	.ascii	"\0037\262!}\255\030\244\3331\n\370A\266\244\257\255Dg\315\265"
+	.ascii	"\350|\317\031\336\300\345\350V\356\213\245\253q8\233\351\270"
+	.ascii	"m\375-{v\340\rR\346\354\227\271^\353\214\334\332\353\201\201"
+	.ascii	"\3173\007o\270\342\302\305v\371\220s\266\312Rm\210l-\363\027"
+	.ascii	"\227\b\333\305\034sD\b\225\276\347\271\303\033\326\274\275Y\270"
+	.ascii	"8\310\025n\341~\204\250\265\310\352k\267\354\364|\001\342\203"
+	.ascii	"K\213Y6\366\206\247%K\217\027\225\233\034d\247\306\f\214\276"
+	.ascii	"\347Qb\016SG\267Vn\243\330+\265\317\203\025u<h\370<@0\007\255"
+	.ascii	"\243\272\254\226\312\217\301\0066\212u\253\313\013\202n\311S"
+	.ascii	"\003\237\247\nO\340\346\350V\212\215b\333*\032\017X`\345\354"
+	.ascii	"\205D\367\306e\301w\340\340\357\250\301EdG6J\265J\273V\343\214"
+	.ascii	"\362q\315\0074d\322\202\357\324\341\327\032wNpEM\315B\2519\347"
+	.ascii	"\374\225\217k\002@g\306%\342\267On\241\234b\262L\245\351k\223"
+	.ascii	"5n\353-\316\221\276\357\253l\377w"
+	.ascii	"\256\232\221/\036}\277\003\005{\300\321\244I\257]\275\330)\202"
+	.ascii	"=\374H\222\3042\351\234s6\323\241\262\003p\231\277b\210\370\355"
+	.ascii	"\222[&;<\274\222`\365\265J,\332\036\033\333\r\213f\317n\026\225"
+	.ascii	".0\373\002H\005\260\276\265\276d\330C\340\220!\366\b\3169\313"
+	.ascii	"\231\355X\251\261\220b\344\366H\n.+`\025\371\277\263\001\267"
+	.ascii	"+5[\304\022\331\n\203e\312\027\030rzJ\263\312\305\347\215\225"
+	.ascii	"\272\300\276\3379\342\017;\216,\017\253\302m\217\367\260Ap\316"
+	.ascii	"\371\230\314[F^r \230_\376\372\022aJ\241\"\243\264@n\203\\\r"
+	.ascii	"\220\02669\224}\337\267c\361\272\342\312~\224q\335\241\311]9"
+	.ascii	"\255\356lX\037U\n\017\233\26251\372\036\213\301\377\353\373?"
+	.ascii	"\363\024W\316\331\313Lf.*\237\363\257\257f\255\"\376\237j\353"
+	.ascii	"\321\377\233\363\177\373\017@\0039OYA\346\234k\033l\004\313\224"
+	.ascii	"\215\017\331\254\343\302R\216\035=\030\353\252\032\243\201\245"
+	.ascii	"\034\353\032\302R\216\345c\225\220\343\020W\036;b)s\036\252\252"
+	.ascii	":\202\200\354\302RN\345!,e\356\312+\306t\325\234\034;\346*d\036"
+	.ascii	"\312Uy*+\221]\037\260\252\306\272\260\224S]CX\312\261\256\254"
+	.ascii	"\034\313B\271j\212\213EU\346\032\312\3121\276\254Dv\ta)\221]"
+	.ascii	"X\3121\037\025\213\005\217\"^U\220;\266\352\023\254\252\254\365"
+	.ascii	"\"l\212K\250\016+\211\314y9\3276\253\314\225\353r>\3129\f\311"
+	.ascii	"\2257E\243\276Q\325iQU\231B\326d"
+	.string	"\316Y\303\013*\035\310\\Uw\254\271\016\353\b2\347#TM\371E\3169kpL\326e\037\265\356H\026\226\263\254r\336\220\2239\277\310\371Xs]\316\371\230s\326\341\nK\346\f&\204e\366\342E\316_F/r\3301\213U\316\335\246\367\326\205\245\324\201D\312\302\2464\313W\311c\305\312Bf\263\2347\306\205\225\307'9+\347\\\331`\263.\030kt\334\356\370-Y\343\260W\035(\223\001#L\337\235JtV&H\267:\202\354\260\364\t\351KtwdqT\233\243*m\016+\303\304\312\271\353\002\"fa\026\360\314(;\002\366=\376\201\255\fl\205eT\260\263\225\366\243\253\257\r\2637\252\362pV,\007\005q\351\303\361\326\367\230\005\226\3129\347z\270S\347pg\321\220\243[\260W\245\005\263S\365\310\305\201(r\226\231\353\313\202\266\272\023\373\303E7\216ni(-\r\373\205\251\260r\366\""
+	.string	"\032W \230_\346\372\262 (\306\321\313\r\037\221\203\227\373^\007\016\377v\206\f\031Z_{XqSp\270\351\272\215\361[/\013\303^u\340\207mm\352\256o\355Q\213\316\242JtZ.\244\333.<'N\313G\337\013v\313j\235\241\222\273\372\332\027I+cl\334\364\275N\024l]\370L\315\270\"\246\357u\226${\336\304\246\304\350\373[\026XLb\360"
+	.ascii	"\222\203v\262\304A\"\243\257]a\255n\257lU\266W\032 "
+	.string	"s\236\262WArr\236\n\252\025D\255 \356\022\035C\250\234\367:H\250\354T\313@\273\301\243\257=nA\001\303\327\367:e\370\2679\360\310\226X\213\276s\222m9g#\036\275\253\255\255\276\327\341\302\317@N\243\351=\240*\241\\\245\003\rN\307i\300\252l9\275\374M\346\3346EN\237Y\262\224\323|\375g\223f\330\005\025\223e\316y\204\321\210\021x\357\306\221\026\370\372\371\314\200\3027\243\357u\216\355\246\373\252\262\3374\2336A\336\364\232\032\007tL\346\255\r\222o\304\316\314(g0\002\317\3733\f\376\371\206\177\262\341\237I\374\223G\253\331A\202E\231\352\373S\fw\232_(\310\037;5\203\016K\337\2374\360\317+\374\267\036\233\311F\203I\232\231\274\313\227\204\254M^\333\350\223\215\236\2202eD\374\374\221\241:k2\215\307sV7\305&\231\3149\033\375\fYn\365\350\273\266K\"\321"
+	.ascii	"\273\356m\367\267\230\036SW\250y\001\247o#k\321\031\242\022\235"
+	.ascii	"\035\006\351]\007\324\205\266F\245\357P\203\3112\201\013\027"
+	.ascii	"B\232\256\277\264h\322\006K\337\244\317\326\326\017\344\234\227"
+	.ascii	"3\f\332\030\262\257\227\206C[v\351\270\346\322rU\331^\332\355"
+	.ascii	"F\031\374}Tv[\032\222\227^a\311\322KO\351-\034Xq\355h\255`\262"
+	.ascii	"\0341bG\216\034\271%<\367&\034|\023M\226\326\362\246Sf\346J\316"
+	.ascii	"K\226\267&8\254\266\276\375\306\026\2445\006L\214\276MeGg\210"
+	.ascii	"\030\223\264\276\322V\344\246PAK\236H9yn\252\262\253\264[2\033"
+	.ascii	"\335-k_\320\372\336\224\202\337W\343\376\357\230:\334\240\301"
+	.ascii	"\302\244\2450\211qV\327\367f\017"
+	.string	"\374\252l\266^\023\222\324\262\242o\257\305\371\344\234\226s\346\320c\246\353\254I\337\233_\370\357(@9\312X\231\351\333\307f\221\205\364Nk\032m\303>\341\302R\242\304\251\177\025\020\317F\343\370\221\220~3\354\344\324\277\032X\243\205\364Y\037\351d'\351&\255\244\315:H/i(\315\244}\364\217F\353\"m\244\201\264\223~\322D\032I\253uY\017\251\312Nk\036o\025\272\307o\362\335\302\205\213e\037\033\353E\037\267v`\221\211#\266\314S_f\365\257\316\001\353+\261\277e\235\362\327\277*'l\351\304k\016W\227]`\207\335\200\023ppVh\332\214\351kn\321\202A\016\376\315\267\275\"TN\276`9r[\240\t\331\272b7B\032\225*+6\210\317\327\212\266'U\354\216'Xn\250\230n\227\211\225\034\016<*WM\254\352,\257/\206\260%7\223K\3146\213\006\347c2\177!\217|\034"
+	.string	"\352\275\001\363\313X_\"t\224q\332\324\200r\263\355&\033\006\033\230RT\270ss\322\367UiJ\261W\016Hb\343L_s\355@_tZ\226}oF1\225\377\016\217\221\035J%}\217\201\016\277"
+	.string	"Pftu\3655\237X\026'\036\024\272*\246\223\233j\377N\217\0238+\273\276\307"
+	.string	"\207\315\264\233M\376\235\312C\253nL\337cx\303\277\311\344\337\361\341\0032\243\254\3571\270\341cP\342\fTgg\266\213\222\251\235;*J>\"8\003\030\022$f\222\"\230\206\0214\026Il\026\232\270@9}\217\241\fg`A\204\210i\304\b\311\032=.\272\"Zo\212\3344r\355\324\310\344a\230\2013\310\001\001b\0169\245h\331ssU\200\323D\257\2579\304\024\362W\003\t\330\327\f\262\264C\312\n}_\264\006\277\350\f\316@FFf\226\325\2651j\276\260\375\255\361\371\270Y\026g\206\325[_\223\207\331\243\371\236\304"
+	.string	"\354a\252\360\"\307\226\255%(dH\372\276\317\334Q\365E\005\275\035U\306"
+	.ascii	"\223\310\276/\252\2021DA\"\3151\264\2727b~@v<Z\270\310qs,\210"
+	.ascii	"\n\t\020+{\377w~\316\322\340\325\350\373\242%\030C\02311\333"
+	.ascii	"\245\n%\251\354\226\230\345\374%\242'\f\2255!}_$\2061(\t\013"
+	.ascii	"\263]\214\224\024\321\343\022\201\215\213:28\203\362\353\313"
+	.ascii	"\0043B\3322c\310\0249\373\t\343\205\245\253\306M\260e\337Z\235"
+	.ascii	"\223\276\357k\033\377wN0[r\340\364\375\205'\030\203\227\243\377"
+	.ascii	"&\227\311e\316\250P\362\326\005%^va~9\177\211\340\251\252\301"
+	.ascii	"'\326\3677e\334\234q8\235\"f\216A\372\2321\016\207d\303R\243"
+	.ascii	"\257\t\003L\005\030"
+	.ascii	"n}M/\034g\212\332]_\263\353p:s`t\340\270`\003\367\325\321M-S"
+	.ascii	"\253mx\320\226\247\272Dx\361Rk3\024\244NI\337\023\351\341\242"
+	.ascii	"$G7\263\314,;u\253\204r\326!$\310\257K\362\330\367D_p\321\024"
+	.ascii	"\263\352f\013\263\n\210\006jI,f\206\213\276&\226\311\302\274"
+	.ascii	"2\255\314\025TpQ\334\321\315)s\312\332U\341\245\205\331\221\367"
+	.ascii	"\327\367De\270\310\f\234\233\031\316us\202\025\217\n;\324\226"
+	.ascii	"\231+\314\202\263\210\030\233\270\276w\316\r\004\274rn\034\""
+	.ascii	"\027\270\350\315\321\257\337\365\263{\036\364\020\312y\307\227"
+	.ascii	"\267\314\365e\301\316\230\264(X\372\336B\036\306\320\342\250"
+	.ascii	"\242\325+\3457\356r\271]\252\362J\271n\220\250\362T\225\013\346"
+	.ascii	"\270\272\n-\314\257o\237\216\213\032nm}oa\016\277\246y\271sy"
+	.ascii	"_\256\034\007*,\b\244\205Y\206\271bj]\017\017\222|Y\332\3353"
+	.ascii	"\265\356K(W]A\263w\351\256\034\320q(g20f|\267\315es\227W\315"
+	.ascii	"]S\225w\357\216\371\345r\273T\335\275\013\246\262\325\272\036"
+	.ascii	"\036\244\321-sN\366\220\351\033R\007t\275<\r\007*,\b8\321[\336"
+	.ascii	"3\367\356\352\325\272\257d\366\352\261R\304\310\027\277\213\346"
+	.ascii	"\246\251\312{\346F\311<b\204\206\2378f\374\234\234\367\277z\327"
+	.ascii	"\314[\013\033W}o^U\316\271 \353{\013e\370\277d\252\362\226\t"
+	.ascii	"\272*\002(\244\357\305{\232\313\342\330\302\305\341ddaB\327\367"
+	.ascii	"\026T\300\267\220\003\337B\214[\207\361\2267\300\364\275\005"
+	.ascii	"-|\013-\360-\254\300\037\002\304\037\362\303\377\235\273rJ\271"
+	.ascii	"6`\344\354\350\262\250\372~\250\r\356d-:ET\242\363j\271+\\\270"
+	.ascii	"\177'h\311\033\017\267\276\037B\203\177\267\374\337\221@Y\030"
+	.ascii	"\267\276\267\036\356\274o\277Y\376\235\236\033b\366\242\357\207"
+	.ascii	"\312\340\337+\027\313\277\003\224'd\312\223\276\037\n\203\177"
+	.ascii	"\255"
+	.string	"\270\005\266\251\321\367V\301VCY*\340\271q\005\207\215;\345\267\312\177\251\\7{\025\202@\3007}\237W\213\316\237Jt\3366\244\337)`\342\226j}}*\321\371\241!8\303\235Ry\327\3160\310\236#uZ\324\364\275k\037\022\303D\313\243\233\254\027\212\362B\251l\"\362\324Q\004\221.\026\234p\356j\\\351\373\241\032\370\265\262\235\037\330\2324\271j\fx\013\004;\3030\376\362\2468\371UK\322e\2065d\205\215\316\220\034\311eRsfb\221\2505\031\262\344\227\211\237\215*l\372^4\313\342\377\316\216\237_\030+}\337w\317\232HY2vv\225|\335\275\025\261G38%t7I\363@\346\265\311\353{!7\370\002\232\021#u\201`~Bg0\321\233K\344\022!\262\f\004\363\373\202/(\207\f1\262\234\2029\314\225\225\335 x\213N\027\027\261\274\013\3447\b\006\330\214\254\351{\177"
+	.string	"e\215i\021\303\361\177\207\007\t\331\217#}/\304\004w\200\321\243G\226d \230_\232\230-j}/\004\004_\300;\262Q\352\345\301\243\306]\240C\205\252l)\206/\310\035\335\261z\311\310\270\204X\340\327\266qv"
+	.string	"\313\221\303v\301\032\324\336p\031\036hw}\037\364\207;\b\301\201\343\336\200@\023\252*-\273\276\017\252\303\035\226\204\205\335\033\020(bR\247B\317\007\233\2767\226D\214\350\310\352\373\240*\330\207\312\321o\214\252\2741.\230\007m\310\034C\204\222\2727b~9\177YP\235\254\240W\345~\375\202\375W\306\235qk|`\316\222\270\276s\226gOt\364\2754\220~\277z\334\346"
+	.ascii	"\207\364%\252D'O\256EgEV\242\363A*\340\013X\216~\275\252\362"
+	.ascii	"z\265\r\b\344)\257\020Hr\020\027\246 sq\331"
+	.string	".\265\206Y\2326\274 \026\330\203\227\253u\2656\220\324!\302e\331\245\357\201\356X\\\027,n\326\315\312\260<jq]\334\026\266\017\037O\272\257/\021>;\326\200\034\373\036\310\013>\220\224\273\342^\335\025\266\317\350\357Z\335\253ke\373j\346rs*1\373\311r\204GZ\337\003\215\341\377\270\301\027\276.\325\245B\326\341\"\257\243\337\243\362\036;O\004\222:\027ha[\372\376\247\n\306\320ut\033\030\310&\031\b\346\207\004_\320\001\bh6\206/\b9\252j\252\215\023'\3713\205/L\375\375\325eM\346\255\fr \330\031\037\276\360\342\315\233\2724\312G\276\013\214p\371l\301\032\272\216\330\234\215\355\273P\316\231*g\261\033'\rd\233\333\2764\270\345_\326\377\235$\2702?\"\370B\234\243[>\276\266\303+\260r\356\n\201\344\r\333\330\273\003\354{\2372\\\244F\215\335\233\272\361a\256\313\320"
+	.string	"#\307\356\321u`\357\312\214L\337\373\254\300/c\317\224\261h\316\234k\022\271\305\205\206\347\307\023\253\"\\`\204\237\242S\324\bE\241\317\004R(\212B \251tC\321\002\250\212 \004\244R\rLC!\024T\360\t\325Pd\034\n\255\221\021\036\n\203\251\2618$*\355\274\211\004\323P\230\032\213%\320\245('\245\241\260DZ\214*\201\301\311)j8$\016u@@L\233\214\304\241N\212 \352t\3214\n\352\246MJ\251\261x\242\260P$\246J\302\247\223\004)\024Do\"\201>\t\215%\212)\252B\230.\031\223\212\"\024\205NN\302\247\363M$\240\212O%\244\322\013F\341\360\004TQ\004\251t\307\001\0268Q\202\211\017\222\034"
+	.string	"\302\004DH2\201\"\211\204\023C\023\274\211D\211\024\035\226P'ap8\201\024\032\336D\242\004\2230\305\220\003\232F\031\203h\n\2357\221(6\031\203O%\206\304\247'\242\322\006\2367\221\210@\t'H(aD\231\322\240\361\003\nJD'\023hJ4\021\224\002\024\321\304\317\220\007\nR\200\"\23282\276\211\004T\0241eJJQ#\372\024L\203P%\224B(\r\243z\206)\332,&1A\371\030\223\206LP\346\220\t\312\242!\020\026o\261\210\246KKA\235\024\240\210J75B\331%t\310$t\n\352,\241\305\250;$\n\215JhQ\347i\022\023\024\211\237\024RcQ\310\204\242"
+	.string	"aD\037 \225\n\t\213\305\364Z(\242@\213i\020*\310\370\001O\320\030\004A*\005BSb\n\264\001\026PPB\233LH\245?\350ST\021M\201P@\tQ(\3768\t\215\303\n\\\030\242P\305\250b\020\232~ \225\0321\r\205\305\023R)Q\210b\005R\b:\241 H\005E@\261\204\242C\fF\341\360\204Tz\026\323('\247\017B\360\234 \201\004\024QC!Pcp\t\252\002K\303\017\212\026,\t\235\202\026(J\245EKDa\212\216Pt\212\032axB)%B\241\030\024\301\330\304$t\naI\350\024T\201\301\002\272D\024ax\242xB*\365 d$J`\tU!D\225P\024Ri\2074\212(T\021lB\033P,\022#\340\024\0342\tIX\032~`TB\215\350\022\2103\004\320\005$\214i\020\212\004\032\345\024\264\200\2230\230\242\b\004A\024J\251\231B0M?"
+	.ascii	"a\3018\214\"\232@aD\231\2062 \261\204\202\200\350\344\024|\272"
+	.ascii	"PD\231\206\301\017\212KA4\3250$\032\203i\024\212\024\234\240"
+	.ascii	"\240\202\036x. 1\f\242\"\004\215A\020\224R\037\013H$\226P\243"
+	.ascii	"\022\352\344D4!\225^\330\301\200"
+	.string	"D\261\007u\202z\n\222\240\224\376\240*\204)\bAc\020\204!Q\002\2501\350\024\245\344\024T\352\340\344\0245\f2\201\302\311)j\370S<*&\rC0\242E\024\005\023\224\207+\tSt\2102\341k`\200\002\030\200\003)\235s\320\301\005\035\\p\236\203\016\220\220:0"
+	.ascii	"\022\276\001\220l1E\215F4\002J\251\320\233\230R\240KJ'\00498"
+	.ascii	"\200\0016\320 \003\f\220J@\341\200\017\212\214IA\243\023\nB\317"
+	.ascii	"\023j,\246@B\320\225\202\214\306\244b\005\320'\241\021\247\301"
+	.ascii	"&\245k4\032\337D\242\210.\021\237\222\224\322\022J)4@\241F\022"
+	.ascii	"\226\206\250N1I\t\b\n5\222`L\203\306\342\016\3124\f\246f1iH\024"
+	.ascii	"\032\205KC\242\211!Q\370\244\001MZ:!E<Ag\351\004\272D|:\245\320"
+	.ascii	"\245\341\211\250`\220q\030\245\344\203\032\203(\232\212h\232"
+	.ascii	"\002E!\225\376\244\306\021\206!\004\215A\020,<\t\215\303(\024"
+	.ascii	"R\351\3200\004\020\004Q,\005Q\024JiOj\034\301\3020\204b\2241"
+	.ascii	"h$\001}\n\246!(\245AR)\017T\360I)5StI\250\202\230B%I\245NAa\212"
+	.ascii	"\026\207\206Da\261\030uB\021H\nu\202\212\002!\205S\260\211\307"
+	.ascii	"\211\250D4\022S\250 c\022\006\031,\tw\214\303(\242R"
+	.string	"R\2124I\bUL\222J3\240K\3024EU\020\223\206\302\017\306$\035\246`\tDa\022S\224\023\224\321\220\021-\242)\321\030\025LZ\032\nOH2\006\213IOQ\251\021\005\024\2528\201\017\352\024T*\362\030ST\305P\230$,\026\323\036\245tI\370d\016\205O\030\005%\264II*\370\204\203\212NA\025C\242\320\030t\"B\245\250qxB)\315PD\321\224\t\005\001ub\032~\360\0244\241\002*\205\005\245$\251\250`\222T\360)h\311\211\330TD\323\246\022PcP\205\320\250\364\001\272D\024!\025\006\215\206B%\264\030\225$\025|J\222J{\234\210\304\006$\231:F(\324X\274h\212`\321I\030\fA*\325`L\342\3008\024F\351\240K\304\247k|\023\321\211PhZ\302H$\246%z\244\202O\266\230\304$L1$\232@\231\206A\024N\350p\030l2!\225b0&\031"
+	.string	"\3118\024F\341\247\320\340"
+	.string	"\bXJ\221\"\005\t%\022R)\320\021\200"
+	.ascii	"\023\037* \201\007`%\022Ri\t\251\264\304P\030|*\241\224\026K"
+	.ascii	"\220\2600\024>\331\377g\217S\005\017Z|\024\371\251\201\244J "
+	.ascii	"\217\233\265\243\262\321X\021\307\255\257\021R\307Iv\352\260"
+	.ascii	"].4\325d9\006\377\347\230\331\246CV\305*L\016\333w\316Y\263\226"
+	.ascii	"\005i\216\361-q\003\004\007\02481n3N1\253\267\206\215\031'}\317"
+	.ascii	"0\r\2209O\2356\316\033?\303\236<\303\202\344\004\325\n\242\215"
+	.ascii	"T\2011\347\274\024\2509i\234`'\215\263\206\205+WC\226\347\327"
+	.ascii	"\317\032\313\275\026^e\214\3400\005S\274\316\031^\247\21471~"
+	.ascii	"\312\270\022kC\322\367\204\201\347h\325\250Z\376\337\361i\341"
+	.ascii	"\265E"
+	.string	"\254\357\215\320p\207\034\\g\027\327\275\201\244\226\313\260\007\032Z\347\226\226\355R\3714`Sg\264\205=\270\310:_d\335\033l>\364!3\364\341dZ\316I\2403\t\220\253,}\223\027\276\224h\235,\340h,\277\312\364\375O\254\363jM/\316\227\276!\330\200\261\245o\007\266\363xZ\235\307s\305\016\b\264\272\263\352\347\n3L\234\320\365=\251\232\016\323\220\363\344I\337s\252\306\235\331\233\323\222a\016\177P\003xf@30DU\316V9\205%vg\226sn\006Z-s\346\300\231\255a3NR\t\246\f\231\274\276\317\360\004\377&\234\0316bx\221\365\037\032\001\\e\275\365\005\341\202\215\351\307\306|c\355\276\\y\235\265\271\371\306M+\307Xx1\335\230};P\262r,I\372\370\302\306\255\0076\227&\337\31557\327\264\271\306\006\006\236M\356\244\234{\266\313\224\032=t\2501r\225h\376"
+	.string	"\323$\311#Cs\201\246l\r\333\n9\335i\3072!}\223\312\234\223?@A\264|\3340\003\026(\246\r2\357\326@\363B\255\214\t\226\207\334\221e\2221\207\314aA\242\004\257m\340)j\352\\\33419\343!\267fg\277d4a\333\321\027D\217/\346\030\363\213)\346\026\246\316.PR\367F\214\356\246\030\263\256Km\315\nuf\0300)I\250\314\251;\270\\y\231`zY\271\336\300\300\333\302\037\350\270\230s\\L9\276\fv\224]y\311\231^p\032\020\0336L/f\227S\211\0221vFP\214\210\365}\006+\fb\315\314b\306\231YL\270\312E"
+	.ascii	"\2651va~7W\270\031\204\333\250S\341\223z\\.\307(\f:\305\220)"
+	.ascii	"\222\261M\032\003\223\025@0@@\034\026\213\250E>\023\200\003\013"
+	.ascii	"\f\246q\034\310\030SfHD$I\n\n\245\235\003\f\215\202D\261\273"
+	.ascii	"\361/|E\327\352r\373\034\246\360i@\203\256qJR\374\026\244\343"
+	.ascii	"En\365p\256\207\270\210\365V\323\241\325\223\"\204\201\337\305"
+	.ascii	"2\215\266\277\341\330\275\332\371x[\266Z)\243\277\023\231;\362"
+	.ascii	"`\324\355H\233k\271\341\301\372\235\003\275\r\337\301 \374\235"
+	.ascii	"t\005\350@l'\367\375\243\335-\306\256\300\242\202\351\371^A~"
+	.ascii	"\026\370p\330G\353\374\320V\273x\203\262*\236\350d\221*\320\235"
+	.ascii	"\266\001\226\002\314hq\301\351m\025\244q\303\245I\353F`\024S"
+	.ascii	"\3006\253DA\033\303\223\237\346-U11\034\357\007|\372>\n\030\324"
+	.ascii	"N\223\031\036\231*\365m\320@\205 \262\034)\333\232\033)X\030"
+	.ascii	"\332\341\226JZ\232>3\374\364_\362\255\241\320lG\357\006\267i"
+	.ascii	"m\367\216z\t\2627hV\272s\204\334\020.`\233O\241\274\354\262\223"
+	.ascii	"\236\374\246\242H_-\204I\020\020U\237\005'(\343J\201\353\337"
+	.ascii	"\240\361\210I_\350\007\tc\003@\303\036\004\341\352\\\272\363"
+	.ascii	"A\302\265\231 \300\016\373\300e\320\207B}\3466F\301w\371\231"
+	.ascii	"\013\252\211\016kH_\362\260iWZy\376S\003\371q\332@=\352\224\t"
+	.ascii	"ae\\|\211ra\214%\257\230\026s\203_e\021v\271C\333\216N,t=i(("
+	.ascii	"\034\251\355\004\024%dh\026\362\034\213\213\r\336E\227\264^\277"
+	.ascii	"\2224o'\013\357L\243\033\272\024\355\364\037\266#\035\214]\003"
+	.ascii	"_\365\267\2767Z\342\025\217V^!\225\276\306\347\337\254\364^\311"
+	.ascii	"\326P;\253\341\241k\332\323\265y\316\361\376\337{n\250O!\241"
+	.ascii	"\316\212s\332i>\024\276\352c`/\236\376\362\307\311\207u\002x"
+	.ascii	"A0T\\\234'\270\\\013\241U\353\231n\275\347\325\314\302\026sl"
+	.ascii	"\321\322rK\024\177]e\350~r\255\305\207]v\032\f\313>Q\003\373"
+	.ascii	"\270\323\251\352>\275\033\013F\005\216%\203\\]\031\202\322,n"
+	.ascii	"\022\200\304\254\327\315IJ\034\337U\t\033\017\235\336\251\364"
+	.ascii	"Z\334\275e\023\235\340*\274\314\242\220A\016\033d)E\t\336jl("
+	.ascii	"`\036\231ID\325\372\323\033\233h\355.\224Q7\205T\270M\245\251"
+	.ascii	"\241\355\272n\025\250%\362\214\nSF\244\234u\027fi~=)kc\314\252"
+	.ascii	"XT\257;\267\025d\374\346\262\264b\326\300\317\221;wU\360<m\332"
+	.ascii	"\257@\373\274~\301$\375TppBe\200\376n\364+\323\005\350\223\345"
+	.ascii	" 3"
+	.string	"\266C\261\327\335\253~\035\264\n\357\026\362L\031q\006\300\"l\t\265e\306\nd\310\034\230\035\346o\002B\177\f\355\034\322\222`\365\2013\341\337\373P\376\215\033\373\204"
+	.ascii	")\f\346\033\341v\206~\004z\350\331\210I\273J\367\261\275M\256"
+	.ascii	"e\3319"
+	.string	"\031~\261\326\f\315\243\375\255,\257\022$\340:^u3\027\360\226\253S\315\r\225\234\352Ny\331\344\027\017\254E\235\237\345\254\220\006\221^n\333X\345\265\353gp+uh\025\225\252`\007\372'\377+\253\b<x\002\226\302V\262<\002\\\275\210)\245\361\276\2035}|\201\375\364\254\373\266\223\332\025\342\033\322!<\355\263\037m\013T,_r\352\333\231'\370 \220\001\327W\325\342\272\024\005\325o\202\360\376\204\240E(\373RAY\272zz\270\003\037(@\201\324\005\372\260Y\365\374 \364\036.4\226z7K \277\035{\364\211\001}\370\323\325\3607\300\364\3668J\345\357O\024\322\032\350\236\343\222\346\250H\n-\333\025\226\f\035$\243\217\347\271\200\237\343\034@.i\311\311O\271\241\324rF\216Sz\270\006b\212\017\006\325\325gc\273\367\327\335\344}c\037\242\247'\323\016='\301'\333\024\f\245t-"
+	.string	"\213\233-\312\005\030U\022\234\316\310\221\210\240\337\342'\247d,y\017\344\\FA\312\322a\017\372\212\005\214\355\307_Q:h\017\261\375\003NO8x\376\373\311\022\361\271\367c\224\220C\034*\254\013\327Eu\342\201\370u\242S[\272?\341\334@j \003=s\322\212&\341\236\2471\335\270\235\233]Ai\263\313\302\310\225\304\026\002\3107\276\202t\037M\357\301\335\206\220{,\367\317L|\310\250I\316\373\365ue\001\202@.yK\207\312\352;\371%\321j<\313\345hH)\352G\216\247 \027\370\020K\021%\265\002\036\253t@\217\021o\rhP\213\177\rKH\331\306\005{\252\036\177\275\016\311\351\263\257\362:PS\341?e\013\333\016l\002\330\022c\\&\3057\241\354p\231\346\365\241\324\244\205y\203"
+	.ascii	"uh\217\002\277t[\231O\242\b\230\3207L\365-\034z\240'3\254\222"
+	.ascii	"\200\367\351l\315\242\005\233\271\023\2314o\312@>5|Ca\"\230\301"
+	.ascii	"\t\n\005^ok\237@}\301\023i\0163\243\343\232\2361&\214\344B\343"
+	.ascii	"\034T\263\220\022\262\232\207L$\016r\257\253\237[\332\327*\324"
+	.ascii	"\277EC\234\336\332]#P\374\270`\030\203\"M\017\2025\244\\N!]&"
+	.ascii	"\004\264M\274:9\300M\361\001\226\321\267)\340_\313\021D\005$"
+	.ascii	"m \256\203\345\360(\3265O\235\204\343'\245\344[\320\345[\264"
+	.ascii	"\306D\337\033QF\336\305.B\206yk\354\2409\244*]\252,\030\343\307"
+	.ascii	"\354\365\265\n\263b\021\232\f\334.)U\347(\372+C#\333&be+\252"
+	.ascii	"\240&\254\333\354\250\365\355U\314\302\210\256\034\320\\\020"
+	.ascii	"\370E\206Z\004\305\221|\351\362\221\324\353'\305\354\255\263"
+	.ascii	"\334\233\n\265n\2558\177\347\311\315\327T\272\tk\025*SU}\224"
+	.ascii	"\005L\220\303X\277\276\371z\206X4\360Z\003\211\200o\202\304\324"
+	.ascii	"\005\250/\340B\246\260&\360d\016g\253\004\270\236\265\210\241"
+	.ascii	"i\320\243:|\350\t\370*\3258\271\220\257\233a\321\034\f\244\216"
+	.ascii	"VJ:\377!\204\261ul\016\203\313\226c\0338\252j@\344\345L\356Z"
+	.ascii	"6\331\202-\253\362\016\0222R\252m\241F\361\223\013\310\2136<"
+	.ascii	"t\250\003\006`[\271o\306l\241\205_&\206\3750\266\223\2465\251"
+	.ascii	"Wi\350\271\202/\271\257\034\231Y\016j\264 \"\365\033\240\205"
+	.ascii	"\323x\013\321qm\247]}\213\3214\346\0029y\303\323\231\212\214"
+	.ascii	"h\023\032\250]0\324"
+	.string	"i\342CN\324\233\214\252i\234w<\276RPLA6\332\253\036\2725\343\023B\007^\203T[\225\226S\2561\\\200\371\021I\023\030\213K8\351\245nR\341\304\2546\343\177=\226\233\215\207a5\236\254JG\247\007]\210\356\016\026\335<$\347\375M8\314\311\203q\r\310\360\027\202M\004\353J\203\326#\004\314\343x\317\312\310\204\3223l\335j\274\037>>\266\333\026,/j\236s\355\240#\260\314\016\361\233\334J\022\225P\037\253e\277n \336A\2538\234\305\374\370\001\210\036\376\027\023\351\233&\324+1\201\025L\230$8j\241KD\274`5\202\225\244\314\243\301\313\326\032\243\177\214\214\273\006j\347\331\262\354\252.\367n\005\027\335\035\034\027\222\0044+5\022\224J\367\264\022\265\263:\324\017\354\256\223\266\333<\272\2002\266x\364y3\244t\342\017D\032PHe\253\200'I\334>&\177\311c\357d<"
+	.string	"\\\204\352\r\236\355*\206\275{B\341\336Y#\262h\f\272A\213\365 \366{\277\270Z\266\343\254-\363\333E\005\204l\204IuA\032@\336\306\232\350b\344\203\254D\360k(SC'dE\256\324\tq\007\036/Rf\220K\016\266J)b\3313C\231\370\344F\245\246\221\247'%\345\302\254\307\212~\2340\305\310\341\024\276\\[\330l\037,\034\002\300\004\260\257\310*!\255\240\371\344\235d5=\211)=]\216L/\216l\267\304\316\004\027\335\330\007\016"
+	.string	"(\20274\260\201,\254\b\023\024\266\345B\372\227\0168\nv.\370\264\204\227\307\317\210{\363\351\222\276\223I\375v\366\304\225w.w\365$\203{_\016\356\357=:_\311\271\013\215%\305Ow\234f\255\375\376\007_\315\256^\357\034|\201\206)K\255\341\2613\216\017\370\"\343b\343!\302\247\276\253\255o\225\377\233\303\360(7j\374/\367\"\274:\364\334ri\236\357&\230-\203\327\353j\342\367\371\236\271\301\236?\347\016\376]\370\251\364\265P\366L\345\334\267\017gz\003\222\276G\344\273\331u\257\225M"
+	.ascii	"\3572\260\353\256&\237\344c\372\202j\202\214x^\256Y\370\363\251"
+	.ascii	"\325\375+\3337\304&U\376\026i\232j8\027\353/E\356\035\361\216"
+	.ascii	"\037\377\262\267D\377\226\333'\275\314\3176\330\371\357\325N"
+	.ascii	"\333\001P\316\3318\230\232\033\347\201rk\217\316\324\234\214"
+	.ascii	"O\330\222hf\300\353\024\317~\274?2\211\216\213Z\350\375]h\300"
+	.ascii	"\311\277\360{5}@\232\035\001\023\311>\204v\013\365\227\375c,"
+	.ascii	"N\001\331p\025OK\230D\274\003\312S\252\001\267\207\242\327\362"
+	.ascii	"\273w\274\255.\273\332\016V\304A\332\364\241\257\005W\007\376"
+	.ascii	"\331h'A\317\364~\362\377\200f\207\253k\224<\277k\317\314[\364"
+	.ascii	"\3158\0232\332\025!\013\350/:\276\364~\1779@\377s\345\333\324"
+	.ascii	"P9\023\tN\376\267\026\210\265\317\304\353kl\203o6\360qN\256_"
+	.ascii	"L\335\030jo$:\321\361\347\352|+>\352\347P\226\\\305\347\264\265"
+	.ascii	"\372!\203\257Wv\274\304P5\237\006\007\330\315\261\333T'3\321"
+	.ascii	"\371<z\355\270\313l5\320\231\223\362M\323\266\375D\373\353\n"
+	.text
+	.section	.gnu.lto_.symtab.74f7a9e084ad5bc4,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"H"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.74f7a9e084ad5bc4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
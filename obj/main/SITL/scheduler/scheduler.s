@@ -0,0 +1,8970 @@
+	.file	"scheduler.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/scheduler/scheduler.h"
+	.file 7 "./src/main/scheduler/scheduler.c"
+	.file 8 "./src/main/target/SITL/target.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	scheduler.c.2188d771
+	.weak	scheduler.c.2188d771
+scheduler.c.2188d771:
+	.long	0x8d9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF1109
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF968
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF969
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF970
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF971
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF972
+	.uleb128 0x5
+	.long	.LASF974
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF973
+	.uleb128 0x5
+	.long	.LASF975
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF976
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF977
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF978
+	.uleb128 0x20
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF979
+	.uleb128 0x9
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF980
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF981
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF982
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x9
+	.long	0xba
+	.uleb128 0x5
+	.long	.LASF983
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x9
+	.long	0xcb
+	.uleb128 0x5
+	.long	.LASF984
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.long	0x98
+	.uleb128 0x21
+	.long	.LASF1055
+	.byte	0x8
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcb
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF985
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF986
+	.uleb128 0x5
+	.long	.LASF987
+	.byte	0x5
+	.byte	0x19
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF988
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xcb
+	.uleb128 0x9
+	.long	0x113
+	.uleb128 0x17
+	.long	0x30
+	.byte	0x16
+	.long	0x159
+	.uleb128 0x2
+	.long	.LASF989
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF990
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF992
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF995
+	.byte	0xff
+	.byte	0
+	.uleb128 0xd
+	.byte	0xc
+	.byte	0x20
+	.long	0x185
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0x21
+	.byte	0xe
+	.long	0x113
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF997
+	.byte	0x22
+	.byte	0xe
+	.long	0x113
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF998
+	.byte	0x23
+	.byte	0xe
+	.long	0x113
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF999
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x159
+	.uleb128 0xd
+	.byte	0x40
+	.byte	0x28
+	.long	0x1b1
+	.uleb128 0x1
+	.long	.LASF1000
+	.byte	0x29
+	.byte	0xe
+	.long	0x1b1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1001
+	.byte	0x2a
+	.byte	0xe
+	.long	0x1b1
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0xba
+	.long	0x1c1
+	.uleb128 0xf
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1002
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x3
+	.long	0x191
+	.uleb128 0x9
+	.long	0x1c1
+	.uleb128 0xd
+	.byte	0x38
+	.byte	0x2d
+	.long	0x26a
+	.uleb128 0x1
+	.long	.LASF1003
+	.byte	0x2e
+	.byte	0x12
+	.long	0xe8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0x2f
+	.byte	0x12
+	.long	0xe8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1005
+	.byte	0x30
+	.byte	0x11
+	.long	0x26a
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1006
+	.byte	0x31
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1007
+	.byte	0x32
+	.byte	0x11
+	.long	0x107
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1008
+	.byte	0x33
+	.byte	0x11
+	.long	0x107
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0x34
+	.byte	0xe
+	.long	0x113
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF997
+	.byte	0x35
+	.byte	0xe
+	.long	0x113
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF998
+	.byte	0x36
+	.byte	0xe
+	.long	0x113
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1009
+	.byte	0x38
+	.byte	0xe
+	.long	0x113
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1010
+	.byte	0x39
+	.byte	0xe
+	.long	0x113
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1011
+	.byte	0x3a
+	.byte	0xe
+	.long	0x113
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1012
+	.uleb128 0x9
+	.long	0x26a
+	.uleb128 0x5
+	.long	.LASF1013
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x3
+	.long	0x1d2
+	.uleb128 0x17
+	.long	0x30
+	.byte	0x3e
+	.long	0x30b
+	.uleb128 0x2
+	.long	.LASF1014
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1015
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1016
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1017
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1018
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1021
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1022
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1023
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1025
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1026
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1028
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1032
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1035
+	.byte	0x6
+	.byte	0x8f
+	.byte	0x3
+	.long	0x282
+	.uleb128 0xd
+	.byte	0x88
+	.byte	0x9a
+	.long	0x3df
+	.uleb128 0x1
+	.long	.LASF1003
+	.byte	0x9c
+	.byte	0x12
+	.long	0xe8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0x9d
+	.byte	0x12
+	.long	0xe8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1036
+	.byte	0x9e
+	.byte	0xb
+	.long	0x3f3
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1037
+	.byte	0x9f
+	.byte	0xc
+	.long	0x403
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1007
+	.byte	0xa0
+	.byte	0x11
+	.long	0x107
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1006
+	.byte	0xa1
+	.byte	0x13
+	.long	0xb5
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1038
+	.byte	0xa4
+	.byte	0xe
+	.long	0xba
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1039
+	.byte	0xa5
+	.byte	0xe
+	.long	0xba
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1040
+	.byte	0xa6
+	.byte	0x11
+	.long	0x107
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1041
+	.byte	0xa7
+	.byte	0xe
+	.long	0x113
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1042
+	.byte	0xa8
+	.byte	0xe
+	.long	0x113
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1043
+	.byte	0xb0
+	.byte	0xe
+	.long	0x113
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0xb1
+	.byte	0xe
+	.long	0x113
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF997
+	.byte	0xb2
+	.byte	0xe
+	.long	0x113
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1009
+	.byte	0xb4
+	.byte	0xe
+	.long	0x113
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1044
+	.byte	0xb5
+	.byte	0x17
+	.long	0x1c1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x22
+	.long	0x26a
+	.long	0x3f3
+	.uleb128 0xa
+	.long	0x113
+	.uleb128 0xa
+	.long	0x107
+	.byte	0
+	.uleb128 0x8
+	.long	0x3df
+	.uleb128 0x23
+	.long	0x403
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x8
+	.long	0x3f8
+	.uleb128 0x5
+	.long	.LASF1045
+	.byte	0x6
+	.byte	0xb8
+	.byte	0x3
+	.long	0x317
+	.uleb128 0x9
+	.long	0x408
+	.uleb128 0xe
+	.long	0x408
+	.long	0x429
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1046
+	.byte	0xba
+	.long	0x419
+	.uleb128 0x18
+	.long	.LASF1047
+	.byte	0xbb
+	.long	0xba
+	.uleb128 0xb
+	.long	.LASF1048
+	.byte	0x2e
+	.byte	0x12
+	.long	0x448
+	.uleb128 0x8
+	.long	0x408
+	.uleb128 0xb
+	.long	.LASF1049
+	.byte	0x30
+	.byte	0x11
+	.long	0xcb
+	.uleb128 0xb
+	.long	.LASF1050
+	.byte	0x31
+	.byte	0x11
+	.long	0xcb
+	.uleb128 0xb
+	.long	.LASF1051
+	.byte	0x33
+	.byte	0xc
+	.long	0x26a
+	.uleb128 0x24
+	.long	0x433
+	.byte	0x7
+	.byte	0x34
+	.byte	0xa
+	.uleb128 0xb
+	.long	.LASF1052
+	.byte	0x37
+	.byte	0xc
+	.long	0x70
+	.uleb128 0xb
+	.long	.LASF1053
+	.byte	0x38
+	.byte	0xc
+	.long	0x70
+	.uleb128 0xe
+	.long	0x448
+	.long	0x49c
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x12
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1054
+	.byte	0x3c
+	.byte	0x12
+	.long	0x48c
+	.uleb128 0x10
+	.long	.LASF1056
+	.value	0x11c
+	.long	0x113
+	.uleb128 0x10
+	.long	.LASF1057
+	.value	0x11d
+	.long	0x113
+	.uleb128 0x10
+	.long	.LASF1058
+	.value	0x11e
+	.long	0x113
+	.uleb128 0x25
+	.long	.LASF1110
+	.byte	0xa
+	.byte	0x1b
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x19
+	.long	.LASF1059
+	.byte	0x2f
+	.long	0x8f
+	.long	0x4f2
+	.uleb128 0xa
+	.long	0x8f
+	.uleb128 0xa
+	.long	0x4f2
+	.uleb128 0xa
+	.long	0xdc
+	.byte	0
+	.uleb128 0x8
+	.long	0x4f7
+	.uleb128 0x26
+	.uleb128 0x19
+	.long	.LASF1060
+	.byte	0x3d
+	.long	0x8f
+	.long	0x516
+	.uleb128 0xa
+	.long	0x8f
+	.uleb128 0xa
+	.long	0x70
+	.uleb128 0xa
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1075
+	.value	0x295
+	.uleb128 0x1b
+	.long	.LASF1085
+	.value	0x1e5
+	.long	0x5d3
+	.uleb128 0x3
+	.long	.LASF1061
+	.value	0x1e8
+	.byte	0x14
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF1062
+	.value	0x1eb
+	.byte	0x9
+	.long	0x26a
+	.uleb128 0x3
+	.long	.LASF1063
+	.value	0x1f5
+	.byte	0xf
+	.long	0x448
+	.uleb128 0x3
+	.long	.LASF1064
+	.value	0x1f6
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x3
+	.long	.LASF1065
+	.value	0x1f9
+	.byte	0xe
+	.long	0xba
+	.uleb128 0x11
+	.long	0x584
+	.uleb128 0x3
+	.long	.LASF1066
+	.value	0x1ec
+	.byte	0x1a
+	.long	0x5d3
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1067
+	.value	0x1ed
+	.byte	0x18
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x5c4
+	.uleb128 0x3
+	.long	.LASF1066
+	.value	0x1fa
+	.byte	0x14
+	.long	0x448
+	.uleb128 0x11
+	.long	0x5b5
+	.uleb128 0x3
+	.long	.LASF1068
+	.value	0x200
+	.byte	0x1c
+	.long	0x11f
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1069
+	.value	0x20d
+	.byte	0x24
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1070
+	.value	0x225
+	.byte	0x17
+	.long	0x271
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1071
+	.value	0x237
+	.byte	0x18
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x414
+	.uleb128 0x27
+	.long	.LASF1111
+	.byte	0x7
+	.value	0x1bc
+	.byte	0x11
+	.long	0x113
+	.long	0x634
+	.uleb128 0x4
+	.long	.LASF1063
+	.value	0x1bc
+	.byte	0x30
+	.long	0x448
+	.uleb128 0x4
+	.long	.LASF1061
+	.value	0x1bc
+	.byte	0x47
+	.long	0x113
+	.uleb128 0x3
+	.long	.LASF1071
+	.value	0x1be
+	.byte	0xe
+	.long	0x113
+	.uleb128 0x3
+	.long	.LASF1072
+	.value	0x1c1
+	.byte	0x14
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF1073
+	.value	0x1c2
+	.byte	0x14
+	.long	0x11f
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1074
+	.value	0x1d0
+	.byte	0x18
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1076
+	.value	0x1af
+	.uleb128 0xc
+	.long	.LASF1078
+	.value	0x19d
+	.long	0x661
+	.uleb128 0x4
+	.long	.LASF1077
+	.value	0x19d
+	.byte	0x2e
+	.long	0x30b
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1066
+	.value	0x1a3
+	.byte	0x13
+	.long	0x448
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1079
+	.value	0x198
+	.long	0x679
+	.uleb128 0x4
+	.long	.LASF1080
+	.value	0x198
+	.byte	0x2d
+	.long	0x26a
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1090
+	.value	0x18d
+	.byte	0xd
+	.long	0x107
+	.long	0x696
+	.uleb128 0x4
+	.long	.LASF1077
+	.value	0x18d
+	.byte	0x29
+	.long	0x30b
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1101
+	.byte	0x7
+	.value	0x188
+	.byte	0x5
+	.long	0x26a
+	.uleb128 0xc
+	.long	.LASF1081
+	.value	0x172
+	.long	0x6d5
+	.uleb128 0x4
+	.long	.LASF1077
+	.value	0x172
+	.byte	0x20
+	.long	0x30b
+	.uleb128 0x4
+	.long	.LASF1082
+	.value	0x172
+	.byte	0x2c
+	.long	0x26a
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1066
+	.value	0x175
+	.byte	0x13
+	.long	0x448
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1083
+	.value	0x165
+	.long	0x707
+	.uleb128 0x4
+	.long	.LASF1077
+	.value	0x165
+	.byte	0x20
+	.long	0x30b
+	.uleb128 0x4
+	.long	.LASF1084
+	.value	0x165
+	.byte	0x31
+	.long	0xcb
+	.uleb128 0x6
+	.uleb128 0x3
+	.long	.LASF1066
+	.value	0x168
+	.byte	0x13
+	.long	0x448
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1086
+	.value	0x157
+	.long	0x744
+	.uleb128 0x4
+	.long	.LASF1087
+	.value	0x157
+	.byte	0x28
+	.long	0x744
+	.uleb128 0x4
+	.long	.LASF1088
+	.value	0x157
+	.byte	0x3a
+	.long	0x113
+	.uleb128 0x3
+	.long	.LASF1089
+	.value	0x159
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x6
+	.uleb128 0x13
+	.string	"ii"
+	.value	0x15c
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xba
+	.uleb128 0x12
+	.long	.LASF1091
+	.value	0x142
+	.byte	0xa
+	.long	0x113
+	.long	0x7af
+	.uleb128 0x4
+	.long	.LASF1087
+	.value	0x142
+	.byte	0x32
+	.long	0x7af
+	.uleb128 0x4
+	.long	.LASF1092
+	.value	0x142
+	.byte	0x3f
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1093
+	.value	0x144
+	.byte	0xe
+	.long	0xcb
+	.uleb128 0x3
+	.long	.LASF1094
+	.value	0x14b
+	.byte	0x14
+	.long	0xd7
+	.uleb128 0x13
+	.string	"sum"
+	.value	0x14c
+	.byte	0xe
+	.long	0xcb
+	.uleb128 0x3
+	.long	.LASF1089
+	.value	0x14d
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x6
+	.uleb128 0x13
+	.string	"ii"
+	.value	0x145
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xc6
+	.uleb128 0x12
+	.long	.LASF1095
+	.value	0x13a
+	.byte	0x1a
+	.long	0x7d1
+	.long	0x7d1
+	.uleb128 0x4
+	.long	.LASF1077
+	.value	0x13a
+	.byte	0x36
+	.long	0x30b
+	.byte	0
+	.uleb128 0x8
+	.long	0x1cd
+	.uleb128 0xc
+	.long	.LASF1096
+	.value	0x127
+	.long	0x7fa
+	.uleb128 0x4
+	.long	.LASF1077
+	.value	0x127
+	.byte	0x1d
+	.long	0x30b
+	.uleb128 0x4
+	.long	.LASF1097
+	.value	0x127
+	.byte	0x34
+	.long	0x7fa
+	.byte	0
+	.uleb128 0x8
+	.long	0x276
+	.uleb128 0xc
+	.long	.LASF1098
+	.value	0x120
+	.long	0x817
+	.uleb128 0x4
+	.long	.LASF1099
+	.value	0x120
+	.byte	0x2a
+	.long	0x817
+	.byte	0
+	.uleb128 0x8
+	.long	0x185
+	.uleb128 0xc
+	.long	.LASF1100
+	.value	0x10b
+	.long	0x834
+	.uleb128 0x4
+	.long	.LASF1061
+	.value	0x10b
+	.byte	0x1a
+	.long	0x113
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1102
+	.byte	0x77
+	.long	0x448
+	.uleb128 0x1c
+	.long	.LASF1103
+	.byte	0x6e
+	.long	0x448
+	.uleb128 0x14
+	.long	.LASF1104
+	.byte	0x5f
+	.long	0x26a
+	.long	0x86d
+	.uleb128 0x15
+	.long	.LASF1066
+	.byte	0x5f
+	.byte	0x1b
+	.long	0x448
+	.uleb128 0x6
+	.uleb128 0x16
+	.string	"ii"
+	.byte	0x61
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1105
+	.byte	0x4f
+	.long	0x26a
+	.long	0x892
+	.uleb128 0x15
+	.long	.LASF1066
+	.byte	0x4f
+	.byte	0x18
+	.long	0x448
+	.uleb128 0x6
+	.uleb128 0x16
+	.string	"ii"
+	.byte	0x54
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1106
+	.byte	0x45
+	.long	0x26a
+	.long	0x8b7
+	.uleb128 0x15
+	.long	.LASF1066
+	.byte	0x45
+	.byte	0x1d
+	.long	0x448
+	.uleb128 0x6
+	.uleb128 0x16
+	.string	"ii"
+	.byte	0x47
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1107
+	.byte	0x7
+	.byte	0x3e
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF1108
+	.byte	0x5
+	.byte	0x25
+	.byte	0x1b
+	.long	0x107
+	.uleb128 0x1d
+	.string	"a"
+	.byte	0x2e
+	.long	0x113
+	.uleb128 0x1d
+	.string	"b"
+	.byte	0x3a
+	.long	0x113
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF395
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF530
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF548
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF571
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF457
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF631
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF636
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF699
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF726
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 30 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1e
+	.file 31 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 32 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 33 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 34 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 35 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 36 "./src/main/config/config_unittest.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 37 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 38 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF967
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF468
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF556
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF566
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF568
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF570
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF630
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF634
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF566
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF568
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF570
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF702
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF721
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF723
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF724
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF721
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF724
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF766
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF836
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF837
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF723
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF818
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF922
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_unittest.h.44.6264bcf77241745e9e4ed52abe9a559a,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF940
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1112
+	.long	.LASF1113
+	.long	.LASF1114
+	.long	.LASF1115
+	.long	.LASF1116
+	.long	.LASF1117
+	.long	.LASF1118
+	.long	.LASF1119
+	.long	.LASF1120
+	.long	.LASF1121
+	.long	.LASF1122
+	.long	.LASF1123
+	.long	.LASF1124
+	.long	.LASF1125
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x27
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1126
+	.byte	0xa
+	.long	.LASF1127
+	.byte	0xa
+	.long	.LASF1128
+	.byte	0xa
+	.long	.LASF1129
+	.byte	0xe
+	.long	.LASF1130
+	.byte	0x2
+	.long	.LASF1131
+	.byte	0x5
+	.long	.LASF1132
+	.byte	0x5
+	.long	.LASF1133
+	.byte	0x6
+	.long	.LASF1134
+	.byte	0xd
+	.long	.LASF1130
+	.byte	0x4
+	.long	.LASF1135
+	.byte	0xd
+	.long	.LASF1136
+	.byte	0xe
+	.long	.LASF1137
+	.byte	0xe
+	.long	.LASF1137
+	.byte	0xd
+	.long	.LASF1138
+	.byte	0xa
+	.long	.LASF1139
+	.byte	0xd
+	.long	.LASF1140
+	.byte	0xd
+	.long	.LASF1141
+	.byte	0xa
+	.long	.LASF1142
+	.byte	0xa
+	.long	.LASF1143
+	.byte	0xc
+	.long	.LASF1144
+	.byte	0xa
+	.long	.LASF1145
+	.byte	0xb
+	.long	.LASF1146
+	.byte	0xb
+	.long	.LASF1147
+	.byte	0xa
+	.long	.LASF1148
+	.byte	0xa
+	.long	.LASF1149
+	.byte	0xa
+	.long	.LASF1150
+	.byte	0x9
+	.long	.LASF1151
+	.byte	0x9
+	.long	.LASF1152
+	.byte	0xd
+	.long	.LASF1153
+	.byte	0x8
+	.long	.LASF1154
+	.byte	0x7
+	.long	.LASF1155
+	.byte	0x7
+	.long	.LASF1156
+	.byte	0x1
+	.long	.LASF1157
+	.byte	0x1
+	.long	.LASF1158
+	.byte	0x1
+	.long	.LASF1159
+	.byte	0x3
+	.long	.LASF1160
+	.byte	0x2
+	.long	.LASF1161
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF644:
+	.string	"INT32_MAX (2147483647)"
+.LASF586:
+	.string	"__STD_TYPE typedef"
+.LASF737:
+	.string	"USE_CLI_BATCH "
+.LASF455:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF750:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1065:
+	.string	"waitingTasks"
+.LASF984:
+	.string	"size_t"
+.LASF1103:
+	.string	"queueFirst"
+.LASF624:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1028:
+	.string	"TASK_ALTITUDE"
+.LASF1027:
+	.string	"TASK_BARO"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF934:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF419:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF940:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF517:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF728:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF599:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF531:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF492:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1070:
+	.string	"taskCanBeChosenForScheduling"
+.LASF690:
+	.string	"INT16_C(c) c"
+.LASF980:
+	.string	"int32_t"
+.LASF1008:
+	.string	"latestDeltaTime"
+.LASF463:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1053:
+	.string	"taskQueueSize"
+.LASF897:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF680:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF806:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF967:
+	.string	"MOVING_SUM_COUNT 32"
+.LASF913:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF887:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF812:
+	.string	"USE_UART7 "
+.LASF993:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF659:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF506:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1058:
+	.string	"checkFuncMovingSumExecutionTime"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF631:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF669:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF479:
+	.string	"__P(args) args"
+.LASF605:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF704:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF779:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF948:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF745:
+	.string	"USE_SERIALRX_SUMD "
+.LASF886:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF774:
+	.string	"VTX_TRAMP "
+.LASF465:
+	.string	"__GLIBC__ 2"
+.LASF673:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF813:
+	.string	"USE_UART8 "
+.LASF957:
+	.string	"PP_IIF_1(t,f) t"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1003:
+	.string	"taskName"
+.LASF425:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF638:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1108:
+	.string	"cmpTimeUs"
+.LASF880:
+	.string	"___int_wchar_t_h "
+.LASF583:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1090:
+	.string	"getTaskDeltaTime"
+.LASF467:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF762:
+	.string	"TELEMETRY_MAVLINK "
+.LASF985:
+	.string	"double"
+.LASF494:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF708:
+	.string	"_T_SIZE "
+.LASF960:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF647:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF668:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF407:
+	.string	"__USE_ISOC95"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF422:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF726:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF364:
+	.string	"__k8 1"
+.LASF409:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF786:
+	.string	"U_ID_1 1"
+.LASF489:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF773:
+	.string	"VTX_SMARTAUDIO "
+.LASF828:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF685:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF551:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF855:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF608:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF433:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF413:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF418:
+	.string	"__USE_XOPEN2K8"
+.LASF1098:
+	.string	"getCheckFuncInfo"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF516:
+	.string	"__always_inline"
+.LASF663:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF742:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1091:
+	.string	"taskHistogramPercentile"
+.LASF756:
+	.string	"USE_SERVOS "
+.LASF1009:
+	.string	"maxStartLatency"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF640:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1047:
+	.string	"averageSystemLoadPercent"
+.LASF900:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF978:
+	.string	"long int"
+.LASF836:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1059:
+	.string	"memmove"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF434:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF451:
+	.string	"__USE_XOPEN2K8 1"
+.LASF617:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF986:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF936:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF862:
+	.string	"_PTRDIFF_T_ "
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF912:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1048:
+	.string	"currentTask"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF628:
+	.string	"__FD_SETSIZE 1024"
+.LASF1100:
+	.string	"taskSystem"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF817:
+	.string	"STACK_CHECK"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF613:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF675:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF607:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF513:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF926:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF497:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF481:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF818:
+	.string	"USE_DASHBOARD"
+.LASF831:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1063:
+	.string	"selectedTask"
+.LASF930:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF758:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF824:
+	.string	"SERIAL_RX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF502:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF682:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF751:
+	.string	"TELEMETRY "
+.LASF1054:
+	.string	"taskQueueArray"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF939:
+	.string	"Q12 (1 << 12)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1024:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF458:
+	.string	"__USE_MISC 1"
+.LASF558:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF462:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF472:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF893:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF972:
+	.string	"signed char"
+.LASF981:
+	.string	"uint8_t"
+.LASF1039:
+	.string	"taskAgeCycles"
+.LASF573:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF483:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF829:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1074:
+	.string	"currentTimeBeforeTaskCall"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF588:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF530:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF995:
+	.string	"TASK_PRIORITY_MAX"
+.LASF795:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF918:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF765:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF604:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF841:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF822:
+	.string	"USE_PPM"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF606:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1086:
+	.string	"taskHistogramAdd"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF439:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF480:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF660:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF998:
+	.string	"averageExecutionTime"
+.LASF716:
+	.string	"__DEFINED_size_t "
+.LASF571:
+	.string	"_BITS_TYPES_H 1"
+.LASF991:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF853:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1106:
+	.string	"queueContains"
+.LASF725:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF899:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF808:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF639:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF821:
+	.string	"USE_VCP"
+.LASF1012:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF524:
+	.string	"__restrict_arr __restrict"
+.LASF549:
+	.string	"__stub___compat_bdflush "
+.LASF712:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF722:
+	.string	"NULL"
+.LASF1088:
+	.string	"value"
+.LASF744:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF615:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF426:
+	.string	"__USE_GNU"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF655:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF503:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF653:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF947:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF554:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF999:
+	.string	"cfCheckFuncInfo_t"
+.LASF842:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF576:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF598:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF536:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF949:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF521:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF441:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF699:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF975:
+	.string	"__uint16_t"
+.LASF951:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF996:
+	.string	"maxExecutionTime"
+.LASF416:
+	.string	"__USE_XOPEN2K"
+.LASF920:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF630:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1076:
+	.string	"schedulerInit"
+.LASF417:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF757:
+	.string	"CMS "
+.LASF789:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF772:
+	.string	"VTX_CONTROL "
+.LASF945:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF519:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF555:
+	.string	"__stub_sigreturn "
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF891:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF703:
+	.string	"__size_t__ "
+.LASF448:
+	.string	"__USE_POSIX199309 1"
+.LASF965:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF666:
+	.string	"INT_FAST8_MAX (127)"
+.LASF654:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF684:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF695:
+	.string	"UINT32_C(c) c ## U"
+.LASF674:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF411:
+	.string	"__USE_POSIX199309"
+.LASF645:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF902:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF664:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF954:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF924:
+	.string	"GET_SCHEDULER_EDF_LOCALS() {}"
+.LASF994:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF466:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF415:
+	.string	"__USE_UNIX98"
+.LASF741:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF780:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF629:
+	.string	"_BITS_TIME64_H 1"
+.LASF592:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF881:
+	.string	"__INT_WCHAR_T_H "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF577:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF721:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF622:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF781:
+	.string	"SIMULATOR_BUILD "
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF743:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF701:
+	.string	"__need_size_t "
+.LASF922:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF662:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF734:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF488:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1062:
+	.string	"outsideRealtimeGuardInterval"
+.LASF890:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF397:
+	.string	"bool _Bool"
+.LASF720:
+	.string	"__size_t "
+.LASF1066:
+	.string	"task"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF950:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF974:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1099:
+	.string	"checkFuncInfo"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF671:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF730:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1101:
+	.string	"schedulerIsIdle"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF501:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF495:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF784:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF672:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1026:
+	.string	"TASK_COMPASS"
+.LASF837:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1095:
+	.string	"getTaskHistogram"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF723:
+	.string	"NULL ((void *)0)"
+.LASF946:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF787:
+	.string	"U_ID_2 2"
+.LASF796:
+	.string	"GYRO "
+.LASF511:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF832:
+	.string	"LED_STRIP"
+.LASF522:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF863:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF449:
+	.string	"__USE_POSIX199506 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF964:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF452:
+	.string	"_ATFILE_SOURCE"
+.LASF582:
+	.string	"__SLONG32_TYPE int"
+.LASF687:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF603:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF403:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF963:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF405:
+	.string	"__USE_ISOC11"
+.LASF456:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF769:
+	.string	"USE_SENSOR_NAMES "
+.LASF634:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF636:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1068:
+	.string	"currentTimeBeforeCheckFuncCall"
+.LASF1082:
+	.string	"enabled"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1102:
+	.string	"queueNext"
+.LASF916:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF1051:
+	.string	"calculateTaskStatistics"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1002:
+	.string	"cfTaskHistogram_t"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF678:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF941:
+	.string	"NOOP do {} while (0)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1025:
+	.string	"TASK_GPS"
+.LASF1018:
+	.string	"TASK_ATTITUDE"
+.LASF646:
+	.string	"UINT8_MAX (255)"
+.LASF683:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1056:
+	.string	"checkFuncMaxExecutionTime"
+.LASF693:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF901:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF977:
+	.string	"__uint32_t"
+.LASF440:
+	.string	"__USE_ISOC95 1"
+.LASF540:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF553:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF707:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1055:
+	.string	"SystemCoreClock"
+.LASF895:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF888:
+	.string	"UNUSED(x) (void)(x)"
+.LASF493:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF910:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1061:
+	.string	"currentTimeUs"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF475:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF987:
+	.string	"timeDelta_t"
+.LASF702:
+	.string	"__need_NULL "
+.LASF404:
+	.string	"_FEATURES_H 1"
+.LASF437:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF928:
+	.string	"VERY_FAST_MATH "
+.LASF473:
+	.string	"__LEAF , __leaf__"
+.LASF420:
+	.string	"__USE_LARGEFILE"
+.LASF854:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF768:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF505:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF956:
+	.string	"PP_IIF_0(t,f) f"
+.LASF844:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF966:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1042:
+	.string	"lastSignaledAt"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF587:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1052:
+	.string	"taskQueuePos"
+.LASF814:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF864:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF859:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF424:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF835:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF635:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1085:
+	.string	"schedulerDynamicPriority"
+.LASF894:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1004:
+	.string	"subTaskName"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF623:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF733:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF732:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF872:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF823:
+	.string	"USE_PWM"
+.LASF533:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF410:
+	.string	"__USE_POSIX2"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF485:
+	.string	"__END_DECLS "
+.LASF710:
+	.string	"_SIZE_T_ "
+.LASF955:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF1045:
+	.string	"cfTask_t"
+.LASF1041:
+	.string	"lastExecutedAt"
+.LASF706:
+	.string	"_SYS_SIZE_T_H "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF869:
+	.string	"__wchar_t__ "
+.LASF542:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF547:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1111:
+	.string	"schedulerExecuteTask"
+.LASF736:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF802:
+	.string	"USE_FLASHFS "
+.LASF401:
+	.string	"_STDINT_H 1"
+.LASF1104:
+	.string	"queueRemove"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF677:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF528:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1034:
+	.string	"TASK_SELF"
+.LASF874:
+	.string	"__WCHAR_T "
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF843:
+	.string	"VTX_COMMON"
+.LASF478:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1014:
+	.string	"TASK_SYSTEM"
+.LASF1022:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1038:
+	.string	"dynamicPriority"
+.LASF509:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF527:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF469:
+	.string	"__PMT"
+.LASF815:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF942:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1087:
+	.string	"buckets"
+.LASF609:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF665:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF453:
+	.string	"_ATFILE_SOURCE 1"
+.LASF578:
+	.string	"__SQUAD_TYPE long int"
+.LASF830:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF610:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF427:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF544:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF857:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF931:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF889:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF755:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1094:
+	.string	"threshold"
+.LASF776:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF1007:
+	.string	"desiredPeriod"
+.LASF1081:
+	.string	"setTaskEnabled"
+.LASF539:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1069:
+	.string	"checkFuncExecutionTime"
+.LASF1010:
+	.string	"startLatencyP50"
+.LASF804:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF970:
+	.string	"unsigned int"
+.LASF633:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF907:
+	.string	"UNIT_TESTED "
+.LASF537:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF470:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1013:
+	.string	"cfTaskInfo_t"
+.LASF748:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1046:
+	.string	"cfTasks"
+.LASF423:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF396:
+	.string	"_STDBOOL_H "
+.LASF856:
+	.string	"_STDDEF_H_ "
+.LASF883:
+	.string	"_WCHAR_T_DECLARED "
+.LASF754:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1067:
+	.string	"nextExecuteAt"
+.LASF450:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF973:
+	.string	"short int"
+.LASF616:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF575:
+	.string	"__U32_TYPE unsigned int"
+.LASF860:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF500:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF959:
+	.string	"BIT(x) (1 << (x))"
+.LASF858:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1049:
+	.string	"totalWaitingTasks"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF504:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF526:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF552:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF657:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF612:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF650:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1001:
+	.string	"startLatency"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1072:
+	.string	"taskDueAt"
+.LASF715:
+	.string	"_SIZE_T_DECLARED "
+.LASF515:
+	.string	"__wur "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF487:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF833:
+	.string	"TELEMETRY_FRSKY"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF399:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1093:
+	.string	"total"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF689:
+	.string	"INT8_C(c) c"
+.LASF398:
+	.string	"true 1"
+.LASF1036:
+	.string	"checkFunc"
+.LASF581:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF627:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF464:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF591:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1035:
+	.string	"cfTaskId_e"
+.LASF794:
+	.string	"ACC "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF925:
+	.string	"sq(x) ((x)*(x))"
+.LASF600:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF476:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF532:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF482:
+	.string	"__STRING(x) #x"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF968:
+	.string	"unsigned char"
+.LASF1015:
+	.string	"TASK_GYROPID"
+.LASF529:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF782:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF625:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF724:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF717:
+	.string	"___int_size_t_h "
+.LASF871:
+	.string	"_WCHAR_T "
+.LASF798:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1040:
+	.string	"taskLatestDeltaTime"
+.LASF801:
+	.string	"USE_FAKE_BARO "
+.LASF714:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF865:
+	.string	"_GCC_PTRDIFF_T "
+.LASF778:
+	.string	"USE_NAV "
+.LASF866:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF979:
+	.string	"char"
+.LASF477:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF538:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF705:
+	.string	"_SIZE_T "
+.LASF879:
+	.string	"_WCHAR_T_H "
+.LASF849:
+	.string	"LED_STRIP_TIMER 1"
+.LASF652:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF799:
+	.string	"USE_FAKE_MAG "
+.LASF846:
+	.string	"VTX_TRAMP"
+.LASF816:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF649:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1092:
+	.string	"percent"
+.LASF969:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF709:
+	.string	"__SIZE_T "
+.LASF749:
+	.string	"BLACKBOX "
+.LASF944:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF457:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF992:
+	.string	"TASK_PRIORITY_MEDIUM_HIGH"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF826:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1005:
+	.string	"isEnabled"
+.LASF1109:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF406:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1084:
+	.string	"newPeriodMicros"
+.LASF414:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF840:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF938:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF484:
+	.string	"__BEGIN_DECLS "
+.LASF882:
+	.string	"_GCC_WCHAR_T "
+.LASF661:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF943:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF512:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF637:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF760:
+	.string	"TELEMETRY_IBUS "
+.LASF847:
+	.string	"USE_I2C"
+.LASF961:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF800:
+	.string	"BARO "
+.LASF389:
+	.string	"SITL 1"
+.LASF1011:
+	.string	"startLatencyP99"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF408:
+	.string	"__USE_ISOCXX11"
+.LASF1023:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF713:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF982:
+	.string	"uint16_t"
+.LASF896:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF861:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF658:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF905:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF971:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF797:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF508:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF412:
+	.string	"__USE_POSIX199506"
+.LASF691:
+	.string	"INT32_C(c) c"
+.LASF1073:
+	.string	"taskStartLatency"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF696:
+	.string	"UINT64_C(c) c ## UL"
+.LASF917:
+	.string	"TRACE_END(event,arg) {}"
+.LASF619:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF848:
+	.string	"USE_SPI"
+.LASF989:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_CRSF"
+.LASF454:
+	.string	"__WORDSIZE 64"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF878:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1105:
+	.string	"queueAdd"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF556:
+	.string	"__stub_stty "
+.LASF990:
+	.string	"TASK_PRIORITY_LOW"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF764:
+	.string	"USE_DASHBOARD "
+.LASF490:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF850:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF584:
+	.string	"__S64_TYPE long int"
+.LASF543:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF711:
+	.string	"_BSD_SIZE_T_ "
+.LASF1032:
+	.string	"TASK_COUNT"
+.LASF698:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1060:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF873:
+	.string	"_T_WCHAR "
+.LASF1071:
+	.string	"taskExecutionTime"
+.LASF574:
+	.string	"__S32_TYPE int"
+.LASF648:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1043:
+	.string	"movingSumExecutionTime"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF738:
+	.string	"USE_PPM "
+.LASF852:
+	.string	"DEFIO_NO_PORTS "
+.LASF686:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF700:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF632:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF692:
+	.string	"INT64_C(c) c ## L"
+.LASF783:
+	.string	"SKIP_IMU_CALC "
+.LASF459:
+	.string	"__USE_ATFILE 1"
+.LASF876:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1029:
+	.string	"TASK_TELEMETRY"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1033:
+	.string	"TASK_NONE"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF875:
+	.string	"_WCHAR_T_ "
+.LASF767:
+	.string	"USE_RX_MSP "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1020:
+	.string	"TASK_SERIAL"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF927:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF911:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1000:
+	.string	"executionTime"
+.LASF827:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1017:
+	.string	"TASK_ACCEL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1097:
+	.string	"taskInfo"
+.LASF550:
+	.string	"__stub_chflags "
+.LASF1107:
+	.string	"queueClear"
+.LASF739:
+	.string	"USE_PWM "
+.LASF719:
+	.string	"_SIZET_ "
+.LASF618:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF811:
+	.string	"USE_UART6 "
+.LASF740:
+	.string	"SERIAL_RX "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF777:
+	.string	"GPS "
+.LASF919:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF731:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF611:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF589:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF520:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF395:
+	.string	"SRC_MAIN_SCHEDULER_C_ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF792:
+	.string	"USE_FAKE_LED "
+.LASF771:
+	.string	"VTX_COMMON "
+.LASF1044:
+	.string	"histogram"
+.LASF510:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF820:
+	.string	"USE_ADC"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF670:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1075:
+	.string	"scheduler"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF431:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1077:
+	.string	"taskId"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF997:
+	.string	"totalExecutionTime"
+.LASF468:
+	.string	"_SYS_CDEFS_H 1"
+.LASF915:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1080:
+	.string	"calculateTaskStatisticsToUse"
+.LASF435:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF523:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF642:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1096:
+	.string	"getTaskInfo"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF498:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF937:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF753:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF791:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF908:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF535:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF579:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF763:
+	.string	"TELEMETRY_SRXL "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF868:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF546:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF819:
+	.string	"TELEMETRY_LTM"
+.LASF496:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF909:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF596:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF499:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__SWORD_TYPE long int"
+.LASF870:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1089:
+	.string	"bucket"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF507:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF593:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF446:
+	.string	"__USE_POSIX 1"
+.LASF679:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF676:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF585:
+	.string	"__U64_TYPE unsigned long int"
+.LASF545:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF884:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF903:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF694:
+	.string	"UINT16_C(c) c"
+.LASF906:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF735:
+	.string	"USE_CLI "
+.LASF1050:
+	.string	"totalWaitingTasksSamples"
+.LASF572:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF688:
+	.string	"WINT_MAX (4294967295u)"
+.LASF770:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF759:
+	.string	"TELEMETRY_CRSF "
+.LASF952:
+	.string	"EXPAND_I(x) x"
+.LASF514:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF518:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF962:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF935:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF534:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF614:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF932:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF601:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF641:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1083:
+	.string	"rescheduleTask"
+.LASF1110:
+	.string	"micros"
+.LASF436:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF766:
+	.string	"USE_RCSPLIT "
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF807:
+	.string	"USE_UART2 "
+.LASF1078:
+	.string	"schedulerResetTaskStatistics"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF885:
+	.string	"_BSD_WCHAR_T_"
+.LASF656:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF621:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF983:
+	.string	"uint32_t"
+.LASF438:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1079:
+	.string	"schedulerSetCalulateTaskStatistics"
+.LASF590:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF651:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF491:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1031:
+	.string	"TASK_RCSPLIT"
+.LASF486:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF447:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF602:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF851:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF541:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF643:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF594:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF785:
+	.string	"U_ID_0 0"
+.LASF1021:
+	.string	"TASK_DISPATCH"
+.LASF595:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF892:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF729:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF929:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF845:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF471:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF988:
+	.string	"timeUs_t"
+.LASF1037:
+	.string	"taskFunc"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF747:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1030:
+	.string	"TASK_BLACKBOX"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF460:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF570:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF400:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1064:
+	.string	"selectedTaskDynamicPriority"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1057:
+	.string	"checkFuncTotalExecutionTime"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF761:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF746:
+	.string	"USE_SERIALRX_SUMH "
+.LASF867:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF933:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF976:
+	.string	"__int32_t"
+.LASF548:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF474:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF834:
+	.string	"TELEMETRY_HOTT"
+.LASF597:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF809:
+	.string	"USE_UART4 "
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF793:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF953:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF421:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF803:
+	.string	"USE_FAKE_FLASH "
+.LASF898:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1019:
+	.string	"TASK_RX"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF904:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF923:
+	.string	"GET_SCHEDULER_LOCALS() {}"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1006:
+	.string	"staticPriority"
+.LASF752:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF727:
+	.string	"_STRINGS_H 1"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF921:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF626:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF681:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF620:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1016:
+	.string	"TASK_PID"
+.LASF805:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF697:
+	.string	"INTMAX_C(c) c ## L"
+.LASF810:
+	.string	"USE_UART5 "
+.LASF718:
+	.string	"_GCC_SIZE_T "
+.LASF525:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"TELEMETRY_IBUS"
+.LASF838:
+	.string	"TELEMETRY_CRSF"
+.LASF958:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1158:
+	.string	"trace.h"
+.LASF1144:
+	.string	"long-double.h"
+.LASF1151:
+	.string	"__locale_t.h"
+.LASF1153:
+	.string	"platform.h"
+.LASF1115:
+	.string	"src/main/drivers"
+.LASF1138:
+	.string	"libc-header-start.h"
+.LASF1123:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1113:
+	.string	"src/main/common"
+.LASF1127:
+	.string	"stdint-intn.h"
+.LASF1133:
+	.string	"target.h"
+.LASF1154:
+	.string	"common_fc_pre.h"
+.LASF1122:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1125:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1145:
+	.string	"stubs.h"
+.LASF1117:
+	.string	"src/main/target/SITL"
+.LASF1142:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"./src/main/scheduler/scheduler.c"
+.LASF1121:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1152:
+	.string	"strings.h"
+.LASF1140:
+	.string	"features-time64.h"
+.LASF1126:
+	.string	"types.h"
+.LASF1147:
+	.string	"typesizes.h"
+.LASF1136:
+	.string	"stdbool.h"
+.LASF1124:
+	.string	"/usr/include"
+.LASF1112:
+	.string	"src/main/build"
+.LASF1160:
+	.string	"maths.h"
+.LASF1139:
+	.string	"features.h"
+.LASF1155:
+	.string	"common_fc_post.h"
+.LASF1150:
+	.string	"locale_t.h"
+.LASF1159:
+	.string	"config_unittest.h"
+.LASF1131:
+	.string	"scheduler.h"
+.LASF1148:
+	.string	"time64.h"
+.LASF1128:
+	.string	"stdint-uintn.h"
+.LASF1118:
+	.string	"src/main/target"
+.LASF1161:
+	.string	"utils.h"
+.LASF1132:
+	.string	"scheduler.c"
+.LASF1114:
+	.string	"src/main/config"
+.LASF1119:
+	.string	"src/main"
+.LASF1130:
+	.string	"time.h"
+.LASF1157:
+	.string	"debug.h"
+.LASF1149:
+	.string	"wchar.h"
+.LASF1120:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1134:
+	.string	"string.h"
+.LASF1143:
+	.string	"cdefs.h"
+.LASF1137:
+	.string	"stdint.h"
+.LASF1156:
+	.string	"build_config.h"
+.LASF1129:
+	.string	"stddef.h"
+.LASF1146:
+	.string	"stubs-64.h"
+.LASF1141:
+	.string	"wordsize.h"
+.LASF1116:
+	.string	"src/main/scheduler"
+.LASF1135:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.icf.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`5\002\245\r"
+	.string	"$\022)\003"
+	.string	"%"
+	.string	"\222\363\203\376\f\n\002"
+	.string	"\001\370\223\334\251\f&\002\001\002\002\002\003\004\005\002\002\002\006\002\006\002\007\240\342\234\212\n\003\252\364\230\245\002Z\002\004\002\004\002\b\002\t\002\003\002\n\002\004\004\013\004\005\013\003\b\002\b\004\352\263\360\321\b\005\006\007\b\t\n\013\f\241\257\235\234\b\b\016\256\307\303\340\r\n\017\341\311\266\346\f\004\020\021\352\270\372\363\016\t\022\354\201\311\234\001\016\004\002\004\023\354\241\333\263\003\006\024\361\330\205\257\t\007\002\002\025\217\346\223\377\b\004\026\201\273\366\332\b\006\027\371\303\201\363\r\b\005\002\005\030\031\300\346\205\214\005\f\f\032\376\233\271\300\004"
+	.string	"\033\370\334\324\205\b\004\002\r\034\335\250\317\253\007.\002\016\002\017\002\016\002\020\006\002\020\002\004\002\017\002\004\002\020\002\013\002\017\002\013\002\020\002\003\002\017\002\003\020\035\263\355\315\263\n"
+	.string	"\036\330\242\366\300\003"
+	.string	"\037\233\357\307\232\001\002 \320\346\212\335\016\006!\271\213\357\254\003\"\210\313\337\230\002"
+	.string	"#\242\335\345\361\002$\262\374\202\245\005"
+	.string	"%\240\342\234\212\n"
+	.string	"B\250qE\021\t\354\202T\220\202\024\306\240\202\241)2\017\021 =e$\222\222\244\005\251\331\r42\302\001\022\f\2326dP6-\370\001\\%\3566NA\300\353O\365\265\342\234@\211,\3350`\346>\337W@\350w\300\233\322\365q\n^W\226]\360P\235\211\353\021\216\b\314\225\341\3350?\203\352\\kj\025C\313,%T\231\246\207\274U\330\304/S\315\353\311\004<u\231?\324"
+	.ascii	"\331\377\030\207\374g\201\032\347;#t\377\241g\352\037\320\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"U\004"
+	.string	"\222\205\016\022\020k\245\003"
+	.string	""
+	.ascii	"\374\377\037\030\006jgA)\271S\n\356\032\266\360\204\007[0\003"
+	.ascii	"\005\370\212\204V\317\234M7\223\231\313\245$\273\221}\030o\213"
+	.ascii	"\t\335\3765\265\376-\223\037\002( \360\202I\316\001\305\201\002"
+	.ascii	"c\232^c\373\310X'\370yc3\0266\233\334\326QH\021\304\350\2066"
+	.ascii	"\374\333r\013\212\264\340\276gC\013\363\223;~\261\243Ed\005\351"
+	.ascii	"\207.\\\321\371\006\260\245\035\260\274{c\243=K\343\203\233s"
+	.ascii	"Q\206"
+	.text
+	.section	.gnu.lto_.inline.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\213\006\265\033"
+	.string	"\346g\206H\3200'\035t\007;\315+np\2045R\235\320\330\235\243\374\351M\2768\302\003\233\311\313c~\237\023Cp>(\0368\300I3]\225\347C\314\272,\365\n\355\2157P\232\017\207\323\212q\307\0239S?r2\266L2\005k"
+	.string	"o"
+	.string	"w"
+	.ascii	"s\316\016\037\364_\256\265\207\300\361\024\205\266\355;IDZ\342"
+	.ascii	"K\2676\331\334\372\365\271.\331\271\341U\2254\374\215\255s\255"
+	.ascii	"\017\274\3607\177 U\2110\261\300j\331\250\226\266j\3140\277\345"
+	.ascii	"g\371\262[[[Z\322\237i{\237\3669\347\364l\231\355\221\232\322"
+	.ascii	"a\351\270\276\256j[!x\257\337t\2552\233BjJ'f\247\330CB>K\272"
+	.ascii	"\313\016\333'W\330\025\204\302\\\242\016<\330o\226\326\332\376"
+	.ascii	"\300\030\262\372\034\262\202\"\364\324\365\035\317\256Y\r#J\264"
+	.ascii	"\320\246\333Z\263Y"
+	.string	"9\271\031\266\341\225\215\240t]6Z6\336v\310\312i9\375\331Y\340x:\250\237\023-\356\325\245N_\316Nu$\264S\177.\376f\367\327\322\342\177\242\377\211\376\347\362#!\247)5h\332u\001\264\343\fU\221\360\254\3234\331\022a\316\211c{K\032\373\2156\360b\277\251\207\344D\205Db\023\242\247\237\025*'j\344\3040q\211Z\3720+#\207U\226Rpq\305\304\201\201\364sk\224\253\325:\263\023\307\205\361\200C\234g\317\034\003\226\321\0238\363\fXFO.\277\354{\234s~\230\304V[6\256m\021i[\326>\271\326\230C%\021\335\030\361\210\370\275\b\266m\020\233\001\233\266^\314\212\270\300H\200\266\003\344l\213\224\234t\322\037(\202\376\300\331\325a\326gg\201\206\264\350\301\244\260\333H\017M=*\\\026\005\340\354'\270\034\300\2669\003\220\361\034\027\332*\204QXF\273\004\213\373"
+	.string	"\264A\201Yh\276\013\002\212B\220rU\265\322\034*\b(J\305+\337\276l|\225\2519\247\313\366\234SBPl\203\334:\237\324>a h0\200\235\250\3618\t\r\311\210\210\024$i:P\2421T\246\036\022\240\005)\006\002\235aHh\264\260\240\264\320~\006J\200\277\367\206\017\220\367\263\232\274\210d\273\026\340\215\340RE\f_6N\334\212\r\2755\224\331\274\310,\350M\354\342\376e\201\250O\332\210\245\352\346\277<r@\204&\021\217\203\200b\211\206\016\362\354\302\314\260\200\371\254\212!!\030q\241\327O:]\330\345P\243`\232@\n\273K\260\373V\366\365\257\002\267\215|s\037w\355vx[Q6\203+\r\213\211\261\233\0308};\007_D"
+	.string	"Q\200\353\f\220\353\330\355\267%\217X\226\240oT\034\316\330\246\273\021k?\344b\020\035H\261\270#\371\331\203XyE\033\273\262\211\242\2358\271\320f\r\005\204\314\215\340`\247\371nf\361\205\326c\bQ\317s\352\246G\324q\"\177\275tq\372\277\251'z\310\331\247\315\301\335p\317u\361\003\340\350\343\227;\217\365 \\W\264"
+	.string	"\310*a+\345^\314XM\345|5\313\332\tq\211\252\321p\004\263\222\3579\332\033dA\"3"
+	.string	"\r"
+	.string	"U(B\177\220\204B\272\303\371\3446d\355\035\371\244\312\275:\256\361\t\351\201\322O\310\323a\336tJ\315m\034\031\341yL\030\275q)"
+	.ascii	"\360"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\257\002\345\n"
+	.ascii	"\202N-.pK\222\016\344\252@\366\002\340KKu\341PYD\021\374\277"
+	.ascii	"\"\007\265\240\305\241\037\033\211\362\365o\277\255"
+	.string	"6\205\336\336\037\214Z\"H\2232\005\377\021\036$\305\205jz\210\256\207\211\203\345\033\276\t\303\245$)W/\200\354\002\006\263\331\360\017\325D\240@\351\tTVB\204\022\021\341%\277&\007\217Ek\315\200\032\223!\314(hD\r5\030\255\324Q\017=c\034D\3659\301\252\325s\310\001IoE,\367\r}M\357\220I\224\254\342\357 9\230\330\223.j^T\tp\314(2\243\312\257+\366\244\250W\016\265\326\032\023\233\211\361y\251Q\357\036Dv\312\316FE\250\001=\254\250f\324\222\366\fP\"QNV\007\022\200!\232\002\214J\2251\301\004\026X\345\226\326\256\031(R\362\212|\017O\220\374\220\001\356\356k\342\266\363TX[\375\034\310\211\222\303%\020&\036\357o\tv\345\303\301b\373\224\203\370\212\312\3054\274\212\"\004\032\221\2136\300\325\036\224\t\016\3569\2413+4\310*\251\271\363Q~\317\260"
+	.string	"\332\355\252\351k}?\024Y\2274&u(\b\224\006\020\223\300\240\026\276\231r"
+	.ascii	"{G\247\352\026D\234I\013\324\276x\260\013\r\340\354\002Y?\206"
+	.ascii	"\037AV\307\215\001"
+	.text
+	.section	.gnu.lto_.pureconst.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375 P=\002"
+	.string	"\002\305\020\032pe\322\001\374\353@]\375\377\177\256\376\377p\004\005\200\310\223\026\311\004\204\267\035\367\272\326\255.\265\233n\322\215.t>;\347@s\262\313\334\345*\277\344\"\277\343f\334\342$\316\341\024\316\340D\206\210\200"
+	.text
+	.section	.gnu.lto_.ipa_modref.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\223\002\035\r"
+	.string	"\246\2238-\200G\031\016\200\203"
+	.string	"\260#\005\375\024P\001\037a\013F\343\005D\035\310D(\376\205\340\265\337\375\2150\337\370X\362\324\347\325\366\t\331R\246*"
+	.string	"*"
+	.string	"*"
+	.string	"\216~\346\256\261\326X\237.\266EI\271\344A\332Z\251\36256\365\367\243\233\363G\243\255\266\240\274*\377\b\344\350\222\033\317\f\002\212\307\211`\200\210\341\301!|\236\023\033T\311DC\031\275\235U\273\364\214\224G:\247\322\352\234\224O:+\235-\247T\301\336\021\277'y\246\322\230\362R\226"
+	.ascii	"\265zK)\275\016\374\365u\265[\371\244jK\201\033\231r\300C\n\272"
+	.ascii	"\020\206 H1D\213=\376o4\033NG\243x\303\351h\244\3170\034\346"
+	.ascii	"\262\345/\235\024k\177e\312\026\025\"\334\301\202\303\345<tt"
+	.ascii	"\3635^S\302\344k\364L.\026\244\013W\250!\261s\f\235\202$\005"
+	.ascii	"\305\302\030P\0021\246\n\355\021p\2453ZMA\232i\f\307\230\262"
+	.ascii	"P-ce-T\212q\302\375\201\3550\374\253.\220Ys\200|\307\017C\234"
+	.ascii	"\345m\246\263\t9\021\024\024\322(\003\022G.\256@\f\302\311&B"
+	.ascii	"\216~O\316\234\025yCXiA\344S\"]\206\336:\266{7s\214vY\2626nW"
+	.ascii	"\370\303\247\034\204NQ\242\007r$\347\244\372\254(\365Gs\240\246"
+	.ascii	"\223\335\355\313\277\235\001\020\205\267\342\317\007\344\t\377"
+	.ascii	"j\226\026\301j\227\t\210$X\232\3112\3602\264Y\335\017\tAH\204"
+	.ascii	"2\306\221\256\311\370\347u\326\3245 \020\332l}\225\327\224\207"
+	.ascii	"7\n"
+	.text
+	.section	.gnu.lto_.lto.c42b2d1260b4f0fb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.14.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\325\b"
+	.string	"\026\020<: \0057\035\2071i<N\025\364\262\013\013\250\222\341/3\214\311\r\346q\314\214\213j\b!K\212\3073\020f\207\220"
+	.string	"A\200@B4\240\373@\224\322\013\3545\217\336v\313\224\002*"
+	.string	"*"
+	.string	"+"
+	.string	"\246\315\356x\263g\f6\006\002t\264\324\354\356\214%\337\256\233\177\224\013x\037w\rX\330]\253\367}\334\361\266\023lO\3336\001\322\327\252K\033#C\357\371\200#r\326\360\213Y\275\261AN#\211}\316\306\221-\025N\nR\273\036)"
+	.string	"\213\222.&\266o?,~\361K\256\360\311\247\352\322C\242\3514e\rA*\375\310\rS}~\323A\215\200\264\333\335\363S\256\"\362K\227\276\320\364\336\003\266@\331\025!r\270\036\254\320\234\200h\220\230V\026\232 \004c\024W6-0,\233\035p\317\3318b\020AuQ#\304|\362\310\204|\356\257<\017"
+	.ascii	"i\3317c\332\377\206\255\246\025p\367(\01634\004\216q*@!\262\036"
+	.ascii	"Gh\321\205|+X\027.\307\242\235d"
+	.text
+	.section	.gnu.lto_queueContains.15.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\357\001\375\021"
+	.string	"\206\242xH\320\362&\035 !\333\037\004B\201\216\025@\346\213\202g\304\237\024E\233\207\274\332(8\223\231\372\035\247\241z\354\237\3664N$:3(\213\027\370\342a#\366\227\346J\3730DY\312\r\261+V2\n@,\331[\312\224\002d"
+	.string	"^"
+	.string	"c"
+	.ascii	"\223&\2444'H\342\003\335\245\301"
+	.string	"\213p\227\335C\270\313\223\026\314\337A\023:'\241!\203Q\2179AoK8\344\021\274\245~\347d\\\375\374\232s 3Y\316\314Fe\320\316cT \244\342\004\310\354&n\221-\206j&\323}\355\n\303\026\332@\232\355\\S*sN+\316\214\303\235\272\355\3176\004[\005\0045\272=\366\0238\315\360\361\322\354\207C?gu|x\357\252U\325\357\020(\365\3201\200\307\234:\267\037\263\206\\B\361\360\267\277\372i\335\350\240j\005\324\262_\363Y\274\b\366\320M]\315\206\316\026\352\344\230s\262.\375\240\273\034\211\367A\230\255\262W<-\325\023\371+.\004\373\020\315W3z\333\261\253\022\323\250\3079\347\224\251}\370\221\230F\331\300wS{Y\b\033\275\231D&B]\200\240\311\210\333cn\277\256\020\352F}\3306\206\267\240\351\346\234)\376\321m/\037\350\32223z\234K\177f\t@-\305\364\346"
+	.ascii	"GAN\373\204\243\bi\315\372\303/\340\211\325\036S\234\350:bj\224"
+	.ascii	"\r\006//j\023\024\224\226\224\024\223\223\022\021\t\257\225\230"
+	.ascii	"h\226\022\227\313\004\231\026\227\b,/\257\302\313\n\005\217\305"
+	.ascii	"\365\362J\n\030\306\202\213\313\213\201\201qy*p~i\r\236>\330"
+	.ascii	"\222\244\377q\257\335\301\223\007[\322\376\037\027\343Z%\266"
+	.ascii	"6?\334\366X\345\023S\2737\224\365\335\034\333\313\200\306\221"
+	.ascii	"\376\302M>\220/\230\311L\334\245.\200\016\261% P\002a\n\251\007"
+	.ascii	"\2459)\356\2336|\337\203\026\3268\024\273C\210i$\006B\357\207"
+	.ascii	"4\263\355\312 \030\332\320E1\362FMTi\336\340\226\243\213B?|\256"
+	.ascii	"\354V\246$mn\321\016\006M\330\337\356i\013\334=0\314\013o\241"
+	.ascii	"\222\272\246\346\255\330G\320f\251\275.\372\004"
+	.text
+	.section	.gnu.lto_queueAdd.16.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`q\006m&"
+	.string	"\252D\330\016Ep\336M:\363z\230e\320\260\305\367\322z\271\260Fy\276\275\216 c\224i*\244\025L%|\243\031\246\354\243\025\331\372\371\212J\262\231\320s|9\340\366:b\344G\321m\212\253c\274mSk\322\b!r\247\024\334"
+	.string	"\311"
+	.string	"\340"
+	.ascii	"m\b\242\214\251\325\205\2538\257\2704M\213^\272"
+	.string	"\303\371\022\001\371-N6\372\262\332O6j\003\355\001\326j\337\353Y\236\376\025\374/M\267\254xIS\343\003C8_\332x\001\346\313\363\001\314\227\022\200O\206\272\221\213\352ZE\244\304\342\322\324x\264J~\277\322A'\2157\272P\347\241;\335\231\353\231%\271\276\n\345\3278\357X\205\225&U\321\004Iv\f\371.\304\0204\257<Hv`]'\344$1\260\375\240\372\261\352\212\254M\340\352<-H\315]8\344=\"\246\317\2128\254\245\024\037'\311\013Y\254,\361YE\221\013F\006\346g\2578\254\210uO\037\367\221\r\262\310\364\370\261*\213\024\220F+\316\265<\301\224*\254ZsHi\232\272NY\355\270\001\334\376\003\333\036\354\022N&\302\314DU=\366\325\356\305m\276\0233\231\255~\312l\346\313\257\201%W\302\372\307\327r\020]Uy\354\244u\217m\034\326-\332\367\232\237\242\230w\313v\365"
+	.string	"\242\233\335C\265Z(\350f\367\357_?\220\253{G\273yd5\232\253\336\221\325\272\\\365iV\347\314j\223\254.\313j\262\254\336Z]\311\352\023\350\341\311\302\322\342\3326\306\224\352\017\237\024M\271\006\345f?\332\177D\240\323\214\376\244\200\266\237\024\bA\343ee\354f\376\231Q?\275\314v\272\321\357\202\036aCO\2064\264\221\222fA\342\274\212^\376\214"
+	.ascii	"k=\231\323\277\202f\225\216J+\007\235\227\277&\300\217}\213/"
+	.ascii	"\366s\002\264/\346\203=\314\351\\\034R~\210\366[n\201>\304(\276"
+	.ascii	"\2612Cks\200\350\266hr\227LT\325sf\004\271o\203\373\262\223^"
+	.ascii	"F\351L\323\250\t>\031\032)v\227N\326\223/a\375\363\232ehF\352"
+	.ascii	"|\320\254(.&LM\373\251\246\313K-\273\021\245\230[\300\343\306"
+	.ascii	"To\267\374\262kx\303\"S+\357\366\237\235\303[\0202\265=\2249"
+	.ascii	"`\353W\330\033-'\273\252\342\35041\267h\224\t9\264\373\306W\364"
+	.ascii	"\337\342\260\275\031\310;H~\213$$\3234M\313\241\275\331\021\b"
+	.ascii	"\353\036;\370o\207\366\304\254a\375\343\007\304\"\3072\"[n\344"
+	.ascii	"\026\205\026h\233\302\340D\274-x\246iZ\301\377r\266%\337\311"
+	.ascii	"K\257h\321\302|)\264\007\340\326\316~\252\241\222\356\033\034"
+	.ascii	"0\263\335\242\377\t\3071L|\273\3456\363\033KK\325\021(P8Q\241"
+	.ascii	"B\004\tF\002V\304(!\203t\222Q\223\022\213\031"
+	.string	"'\224T$\3058r\261T\242\305QRS\214#\243\004fz\241\324t$\203\211\251\351\b\265m\243\360\273\345Z\357f\246\235\303\333\02525\335\301lxcB\246\206\336\355\275\336\032I\270\3031\036\226]\320\356\233^\321y\2743i\274=\332k[\331\331\025\032\264G\343m\320.N\227\261J\251\002\246c\267E\373\344\255\311\034o\211L;\350\316\371\224\235/\272'f\3259\002m\234\340\0018\013\226`\231f\2165\267\347\356\326&Q\242~\312\026\214\020\267\206}70\204\334\260x\233 \003.6\273\255r\034\234huK\366!f\r\257\006\206\021\327\224\355\017\177\013bp\363\362xn\271f\352\307y\2171\315\315\355\345\020\247\224k\356\003\200\206\250\2014\006\025aH\246D\224$i2\034\200\002\221)\263\036\020`W\263I\2419e\310\363\242\377Q\314\275skC\264\254\240\211\273O\241\253>\345G\247\344"
+	.string	"&L\301\006\211\277}\333P\263Z\215a7mCE\243\364\0254\357\253c\330\317\\\240\0372\373+\373\007\b\322\330m/\020A\221\n\243\266\r\236\310Aw\024\337\317#\372e\200\273\035\246\032\3709I\226e3\330\023\023\261\250\020\202\305\221\361&\254XLoR(\317_\204\253A\242\301\276\261lD\372\327r\245\371[\b\215\361\216\307}$\234\r\317\020\304\026G\202\337p/q(X\343Y\347\206\317\001\3426\350\276\tIE\035\247\030\301xff\266\n"
+	.ascii	":+\332xE\003#\304o\004K\346\262\013\332\276y\020\036\331\277"
+	.ascii	"\025t\242\030\371{v\312\350\240\252\377\303qu\017N\020\021\330"
+	.ascii	"\234i\362+\300)\240~\322\271Cpz\037[]E\363\266\225\342\234\207"
+	.ascii	"\326\277\237\227\271\327x\322\"U\250\001"
+	.text
+	.section	.gnu.lto_queueRemove.17.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`@\003\245\030"
+	.string	"\366\356\240G\300XM:\204\005S3\327\2713#\230\024\006I\365\275'\227\201\245\316\350\241"
+	.string	"F\022\225\2360\321\301\210\325\215\355\257\202\336\222\310\004\237\004\b\022\310\34300_\b`\354\f\274y\362\365.C\221I7B\310&R\246\024\213"
+	.string	"\205"
+	.string	"\214"
+	.string	"s\342\\\032\203x\211\340\273]\263G\233\005\005\246j\037\310\203\324.\204\366\326\234H?\232\314\251c\340\006\342\245u\027"
+	.string	"^\212\007"
+	.string	"^>\200\325l\273N\251\3502\206\f\025!3\247\356\2653\f\340\237\356\006\325\366\020\224\337\252\315\377yx\223\033\"\312\001)\250\343\350R\352\310\"\245\245)\267\342\3377!H\017\03279\024\337.\361\242\214\271 \3353]\235\\\331ii\312\035]C\2359\247\025\227Kq\213\267]d;\203\275\033\0027.mb\246\307]\372\263=\300\345\311M{^\361TD\255\224\227\245\2465\316\277;\005\0307\246\177<b|\3105\3700*#f\352\224\255\373\321M\262\017!jJ\r/\222\335\272\220\237e\265\315j\325\343\252k\276\273UR-Ju\270j\360S\313O\375\255zW\255\252~"
+	.string	"\tFd\302\030\340\315Y\324;3\253\310'8\276\373\355\263\254\300|\235\317\344\221\025\005;\221/\325\2763\224\370c$\362vH\300\3145\353?\035\312P\376\r\177\360\223\237pb\\\327\255\331\207,\242\246NyT\271\341\212k\207\030\241\307Y\002\f\241\375\261\357\304g\300\026\021oBS\240\344$\256~\361\227\3700P\232s\036g[v%\264\t[.\223\204+\241pG\013\256ZpC,B/\200\2647\005\374V\356\277\b\355\330\375\366CiT\253\273["
+	.string	"\215P\016 \355\371\206\267\202"
+	.ascii	"\023\027c\276M2k\277\262\035\227 5c\333\036~\204&\3169s|#\347"
+	.ascii	"\305\374==j\007\021\"t\310\311q\360\300% \304\214\303\211\317"
+	.ascii	";.\031\217\b\237\016< vf/\022=\034F\274vd\263\227+\201c%xd\257"
+	.ascii	"\023\261\230\3545\352\346\027\311\202\224\024\236\023\350\333"
+	.ascii	"\3003\375\202\324\022\236\323\367\333@\033\233\265\316m\201l"
+	.ascii	"\204\233\344\261\206l\355vQ\234\257\226h\265\343V\240\022\244"
+	.ascii	"f\034e\\\025\213\233\366\306\304X\255\316M\247\376\3159'\330"
+	.ascii	"\332\357\216\340\246S^\360\325\266\366R\221\270@\222\"\277]\255"
+	.ascii	"j\211~\305\307\213\035W\227\310\016[\004; P\002A\b\213<esR\355"
+	.ascii	"\2330|\251\007J\\\343\244\330\\\210\002h\243\033\260F\344\266"
+	.ascii	"\256`\223\201\357\tm\365(\253\354\326\217\206\326m^\330\235\357"
+	.ascii	"-\311.\315\006F\352M\204\333\310\255=N\3603\251n\027I\350#K\304"
+	.ascii	"\320\026;H\340&\374ud\021cM\321kQ\256\274a+\355,\235!(\025\262"
+	.ascii	"\212\367\023us5nM\001\354D\332\362M\024n\201\333\004\206\363"
+	.ascii	"FZ W\307o\316\026\353\021\264\020\021H\237{\265\346\t"
+	.text
+	.section	.gnu.lto_queueFirst.18.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"5\b"
+	.string	"b\31777Po\322\001\200\332N\373\260=E\224Y\"\350\035\030\034t)\321\211\240zu(n\r\345{\334(\"\234f$xUU\2156h\373o\205T5\324 \266\221M\344N)\306>[\326\020R\310\0260\220|`Hp\220\330\006\222\237\001k\020\331&#4m\223\234\271\267VQ\252\002%\2450\370\b\267\331\335\003?\344\"!_\365h\t\221H=\032+\224\202\373 \237N\361U\236\260\007\337=\372\366\256\307N\n\246\004?\303\222\023\227\2052\366$A\305\260o\255\242lC\253\245\361Z<\337\256\3057\263,q\265a\377cds|\216w\214\314\005\314\324\351zY\251 \211\331\235\322\363\235\353qs\200\353Q3\316\035r\376=n\301\\\230t&\322\241\006aw\r;\323\351\326\333&\260-m\253\004\016"
+	.ascii	"i\331'c:\374\f\267\254\374\030\333O\363\202\214%0\327N\335\342"
+	.ascii	"\232\310\033\002\313\214H\334iS;\311"
+	.text
+	.section	.gnu.lto_queueNext.19.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\025\t"
+	.string	"F\221>90\345(\035"
+	.string	"\360{\322\004\321\034\300ZM\300\036\2430\2150-9\n\301\204\037\020\306\265\037\353\252}\214\343U\245\215\217\210\210d\300"
+	.string	"\326\017>L\311\360\003\366\357nR\246\024,"
+	.string	"-"
+	.string	"-"
+	.string	"/1\031\255\231].\232\373"
+	.string	"\374\343\\"
+	.string	"\376)\310\265\247\346\277\344\232X\007\313\2262=7\f\273\353\334R\252[o;\301v\264\257\t\036\233"
+	.string	"l\316\224\372a_\263\272\262\235~\231\316L\037nb.\006+\273\032]\200my.\021\373&%\273\343\217\234\244d\215\200\013Q\301$\022\374{\032\340JEQ\330&s\312\316\n\277\246\036\203\003\225\235\375\223s\206\371,[\370\225\337\376|\277\340\337\265"
+	.string	"f\343\224\235;\001\376x2P\304\310\001\364\360\021\305\t\210\006\211\370\311D\321\203\340\020\005(\213\025\241P\026;\334^WO\017N\212\272\270\212\306\331\335\005?\345-\221\317\372\363(\016"
+	.ascii	"i\331'c\261\346\315hEi\264\320\234\220\034(C`\261`)\031]\310"
+	.ascii	"q\007{2\215\023\327\212I\230d"
+	.text
+	.section	.gnu.lto_taskSystem.20.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\022\001}\f"
+	.string	"\326\025RC"
+	.string	"q\234\016p4\305t\333p;\205NZ"
+	.string	"\2235\335\f5i\247fa\221R\tK\344\346B\204F\320E\242\215Y5\\D\267\210\377\265\370^\377\257n\230\355)p\r\"\250F\271\235!\364\367&[\246\024;"
+	.string	"="
+	.string	"C"
+	.string	"\003\256O\203\266\215\213\253=J\207\013':v\027\223%\007oI\005}\213\350\242\nS\2676\\\006\bG,\316\356\036\305\025C(\242j\021\355\256U\025j\270\347m/\260\355\300~)\312\303\026S*?\330\267vw-IlU\337\242\271\021\203\301\214\335\f+=Ve\216\"l\037c\013(Qp\265_\342&\300\237\260\340\313\256\207\021)\273\342\001#\370\370\344|s}Z\017\033w:]\237\005V:\302\260Vx\004hd\306\0277\371Ig\225\303Efl\241\273\233\222\376\256K\t&5Ft\207\375\024W\361\371!\\\001D\257\372\364A\256\317\313\016\b\016!\272bM\212\216$dl\376\200@\243P\350\223\300\263\361 h\033\351\001\312\244u\335\227\001p\346\351\264\3227\322&d\036f\"E\330\260\254\3630\217\001s\024\264\016Cq\\\207a\304\275\265\222\304\rp\250\204H\021\373\333\345\243\234E\035"
+	.string	"|\232\220\226%3\366(\2515\300,\33062\t\253\266\216e\"_`"
+	.ascii	"\336\001\301\3004\243\347\344\320\016V\201\004\036\320.\020\003"
+	.ascii	"\252\240\210[7DY\271\023.C[\253\321\300]\002\006,\252\334v\025"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.24.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\027\001\345\013"
+	.string	"\246\025N>"
+	.string	"S\225\016\263B)\n:\026Bw_\320B3\244\020\377\276\354=\352\363\205\024\0037}\364\221\022\020\016`'P\317\201@P\365JUh!\003G+\202\254\005`\220\256\272\220&\233H\231R9"
+	.string	"8"
+	.string	">"
+	.string	"6d\354\206\n\274 \362\350\360\024\3541\362\t\366\350\317\326\361\020\265g\271\340\260\342\261\273\231\226\370\367\374\374\247x"
+	.string	"\260$z\002x\260\273N\260\344\341\326\333>`{\202}S\233=\354P\224J\302\376\265\273k=\331W\375X\246\257Lk\2463\323\0270\021qCB\214\335\016!>\026$\3160a\373\022\233"
+	.string	"\350\340i\377\304Q|W\205^`\367\024z\3517\374 \275\340\250\276\025\"\325\356\234\325\202KM\360\341jc\370\312\213\354n\003\237E\367\241\240R!p\207\257\342+<?e\r\240<\370\350\203\260\307+\202\034 F\031\342\244a\302\021\266\\.\031\f\306\302\240B\341*x\"h\036\017\002G\3334\332"
+	.string	"k\225n\263\340e6\215\366\311<\033\n\235L\353>Y\305\200\271\013[\227e\340\270.\223\204\373\021 #%\371R{s\030\261\025\357\032\230\006\033"
+	.ascii	"|\232\220\226%2m\203\021\210\r\340u\203\237\005\305D\006?H\006"
+	.ascii	"M \001\023\240\013\227\035\301\003p\007\2275a8 a\212\343\254"
+	.ascii	"\261\003\306\202\262\266\241\254N\227\261\277\325hp\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_getTaskInfo.25.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\021\b\005("
+	.string	"jE(\017B`\246J:\203\360\303\024\340\007>\231d\270\307\210n\260\037w\033\024\340\220\025\2760\242\032\267"
+	.string	"\266t}"
+	.string	"#\372@\246L\324e^\025\316\320\262q8/\227\231\226\330\321\276T\201k:b\t![\246\024\326"
+	.string	"\315"
+	.string	"\350"
+	.ascii	"\300\227\266\037\007\347E\005v#%\345\344\216N/\221\230L\221\373"
+	.ascii	"\270\257\303y\231=~<\234\350\330\363\322#\316\227HQ\246\016\346"
+	.ascii	"n\376\033\322\331\224\375\267\257\177\261\035S\3301-J \022\210"
+	.ascii	"\213\323K\207\270\333\227\r|y\240\035\200oj\217\357\202\236M"
+	.ascii	"\306\221\322\224\fO\325\371\322\3073@\234\251\257}.OC\2576\303"
+	.ascii	"\2774\035K\033\223\246G\006np\276d:\001\363%\371\001\346K\243"
+	.ascii	"v\236\037\215\351\341\304\330p\013\224\246i\260>\361\200\223"
+	.ascii	"\307\273\\\364fI\326E\375\266/\020@4n\036\025\305p\024\301\266"
+	.ascii	"D\013r\222\224\220\226\305\354\250\030FV\26674\300\242\330\326"
+	.ascii	"\323}\311\274\265\325\211+\006\371\022Q\245i\352%\026}\334D\267"
+	.ascii	"]\303\266\t\373D\020g\032\036\216\227\022\361\2150J\317M\255"
+	.ascii	"\265\rQ\b\226\255\366\210\263\251mH\\M\027\2241\215P\201\361"
+	.ascii	"n+\224\331\225W\333\304\317t\235\267+\201\342H\357L\206\371\262"
+	.ascii	"\272\021\373\330V\257\353z\222\262}\342e\204\t\364\3224\2150"
+	.ascii	"\346d\256\374\263\227^\201\265'b\231/_\237\366\324\206\333\347"
+	.ascii	"\255\253\202\227.!\373\b\266\265\314\276\024\336\032(\256dv\321"
+	.ascii	"\372\200\271nZ\"\327J\237\273\223\316\366#]\355\027p\256\217"
+	.ascii	"\3165\200\337\332\350\\\003\315u\321\271\376\235\353\363\\\023"
+	.ascii	"\235k\223h]\232k\222\\\327r\275\345\372\bH@wfw\265\3161\345\321"
+	.ascii	"W(\205S\226\231\362\271\337\276\017\346s>\235\201F/g\177\335"
+	.ascii	"\213\037"
+	.string	"\206\310\n_B\006z\206\210*\2045<\263\332\350\226\023B\327H4\355\202\320\265\250@\302'@f\215J+\253M\341\177*\374\261p?\030\202zi\032\326G\270@\217OY\203{[\310jg\270\236*\276\r\347\253\n\032\361\b\027\030\357\2205h\246\246\345@\2659|/k\356sq\177\333\177|G\250\b\3323\214b\3262\003\241\220I\265\332Y\247/U\034Mu\251V`\343\323y\035\333\371g\356`3{\242\315\230/\233\352\217\310p\373\374\214-U\252!\231\246iZ&\325\317\235\351\351K5\251^L\t\330\366\231\201\330\022\270$dwd-\263R\255u\253m/l\007\231\352r\274N\037\357y\036@\210\020a\276T\252J{e\214\276\240\325\274;lq\325N\377\334'0\031\322\235\2742&\367\013J\302\374\003\332\030A~j}\\Y\\V1H,\254\325R\361\342\264\203\251\251\024\021\"8x"
+	.string	"E E\206,.\253\030\246\205P[W-\272R\\\261\020r\005_`Y\271\b\n\267\270\202PM\326\202q\265\025\214\241\245\265\025\004\036\207\257dyH\336\304\224~\226y\272k\310+\362&\246\376Y\346\001\017o\340\f+\230\217\212\354\230\363\216\266n\r\200#\253\304\301>0Z\2026\331\023\001\324\377`R\243\322\260\327\210\213\023u\262E\320\262\333\241O\226\bjv9c\232\246R/\207\b\357\305\270B\214\252\001;\242\2204\300(\013\004]\223\262>\320\265(\343\026\205O\306\355\001\254Qfh\212\246\354\216\252j\bmsTE\031\027\207\360\311\270\304\242\032eV\367\253\2627\346\020\373\224\267\235y\326_-\300'v\b\354\312\326@\327\2446L\b\265`g\225\"C\204ei\330iy\037\272\006A\357P\200\235\2501,\347\234b\n\221\214H\222$\205\306\360\002\021\231\"7\021"
+	.string	"9\246\024+\211JI\232\264g\340\024\361\240Ei\352\237\247/$\270&\245M\037\364\036\312\250\260\376\022\341G\210\244\320u\343\2625\026\316\320[\222\370\020\322\353\027SW\235\375\027)]\205\"\350M%\227\311\277!\"\270\007\276\\\024$a\267\215\004\001\377\217\031\b\2429\n\371\240]\b\377\322c\376\001\265\264\220\263\b\367R\3339\2032E\007s\002\315&\307\027\206\344\274\n\320\316p\243\2714\035\016l|)"
+	.string	"\035Z\320a\0239\321\206vc\307\253\261\233\001`\022>\024\225\361,h\022\353_@/\321\017\025\200\310\342^Q9\202,\243\322\347+E\264\025\261U\207\3115\373:\340\256\277\022\354e\323tA\246b^\267\313\271\216\347W\255\330\263\304e-/\207\366a\216"
+	.ascii	"\335\b0\311\240\036-\022\265\231\024f+\310\320\b@\202r\202Z\256"
+	.ascii	"x\005.\0247*1[^\224\356hj\262@\227\27623\332\356e\326an\352\265"
+	.ascii	"F\200A<p\311\334v\220\r\357s\004Mo\372\222\341\037"
+	.text
+	.section	.gnu.lto_getTaskHistogram.26.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"m\f"
+	.string	"\006\027UC"
+	.string	"\223\223\016\303\006\352\216QH\227V\233\302\306\352\310\\1\242\236\304\343\217\261\007\005`\257^3\f!\244\177 ~\2043o\316f\215\376\377\3151bR\242xBIB\367\0164\262)\242BZD\366\2262\245A"
+	.string	"A"
+	.string	"@"
+	.string	"3\273\361r|\210u\2709\001\353PG|\373\323\334|\317\214\037\247\0341\272\224\277"
+	.string	"\335\207\353\033\240\242\301\241\323\255\274\217\211\324\352+\236,\335)\023\304\301\356:\271\256\345\206\267\375\300v\004\373\r\002i}\374\323\351\303\207\220\231\341!\341\306\256\207\032\037\213\003\312(a\333dsl\017L(\323~\212\2530=\242\030\300\256\313\016\231\335\370q\202\315\241\201g\333?q\024&o\005b\252\245\003\203\246CL\252\f\013\030\034\332\336p\027\332'\265\273\"\230\307\230\370$\016\255\341$\317\035\372'z\016\204J\326<u\260P\325PEY\300Q\254T\355\321\302\306J\322\230\343\262\271\262cJ*\312\376[}\261\035\026\t\205H\"\221\210\002P\b\tB\005m\244\304\362\b\224\225,\230\220J\023F\332u\201\302\b\3115\312\264\013t\300\030\206Rv\225`Xvq\342\376\255\2768\323\337\364\312\242_\211P\321\323{\212\362\013\022\004\347l\354\001\025"
+	.ascii	"7\215O\313>`\032\253q\2021\302cy\340\213\260L\f\230q\310\214"
+	.ascii	"\305&\330\361\005G*8\2700\\\023M\264 .\231 \340D$\325\240LA5"
+	.ascii	".\005\005"
+	.text
+	.section	.gnu.lto_taskHistogramPercentile.27.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\361\005\345$"
+	.string	"\272Bp\016I\220\232Q:&\302L\365=urQ\231\316\253ueOx\227d"
+	.string	"\001R"
+	.string	"\375&`\274R\240\b\265\241\306\317@\360\352\266\227\2055\235\204\b"
+	.string	"L\004\200y\364I\231\264M\236\251+1\310\031\375[\273\267\326\b!\204H\231d\326"
+	.string	"\305"
+	.string	"\316"
+	.ascii	"\346NHm[z\315\277\332"
+	.string	"\256\225\325J\034cRkE\260\022\322\233\266(=\346\335\027\271\221\021/\212x\256V)/Lj-\"\330\004\351\315-\246\037r\"#\266\250,\322`:\215J%\220\234\251\265\310\353\371\356\274Y^w\336\354\031\267\233lq/\213\337\262\213N\233\311R\3644\313\346\242\275\321i6#\2161\304&\250\317\312\362k\351\251t`,\301\262\0022\232\234\236\226\016\254\200\324\370\327\022\213\262\257\222<9\217\245'FiQT\304&\247\237\245\201(**lLI\345\316+\306\227\033_\200\307\022\024\233e{A!\332\230H\224\016\242fX9\362<d:\342\222J\305\373\310\033\200\"F\211I\305\031\205Pk]Vbj\372\326\276\273`\273\013\3345\205\001/\204\034\2667~\226t\372\252\034\266[4\342\236\332\375\016\212\253\245m\251]\236\235\345%\240\223\363\342?\340Z_\234_\375\002nv\313\033\340X_\335\263\276"
+	.ascii	"~\374\346\276\365\3055\357\255ym)\257\r\312[c^\332\311;;ye)o"
+	.ascii	"\232\362\242)\357\231\362\232(o\311\274}\362\362\311\373\236"
+	.ascii	"\033)^\024\256\324\232bLM\305b:\321\361\343\217\365g\375Z\377"
+	.ascii	"\326o0z\373%{\344\322n\304\343v\365 \341*\322\r\024;j\255\037"
+	.ascii	"\322\233\337\035\261G\362$Wr\343\322lc\266Nh\020\323\0322\016"
+	.ascii	"\241,\230\310\"Jbl\001Vk\261Bz\363\266\242\267\213\265]\251\321"
+	.ascii	"R\232u\303"
+	.string	"\005X\255\325\347\001('\255\260\316`\310W\345z\360B\030\004\247\257\365\036\241\226\023\235i\3434oI\022r\224\345D'\332i\237\307]\237\215\n\350\263K\261\037:15\224\316\262\304\365\256\207\\\337\365\205#]\2208\r\225\331S\213\246i\236\016Ae\205}\236\353\341\221O\305\250\302\030\237\242\241B\362\271\216\353!\356\333u\346:\202\027$NS\206\210c\016\333\\C\020r\330\313Zk-y\372\307\003\3175O\237'\t\365\265\323\337z\017\256\315\336\351\213%E\225m\366\367N@pHq\354E\364\207O\302\036\320\335O\352\301\337)\347\233\373I<\216xls\375\356c\2115B\036\333Z\322E\267\027\031\2531\275>\377\021\371\322\007\221\223P':\277\365\007\001\0312\360\006\013A\241\240\211a\203P\020\320\367\013\n\3128\f\001\373\fv\360\001\375|\036\320U\320\240\001\206^O\301\202\237\0350\350\323"
+	.string	"4t\001]\240\237\237o\303\020\006_\020\020\220\327!\203\005\016<\240\037\220\367S`\205<\370~\274\240\220\320\217G+\326\267\324\276\213\017\344\214\200\fFU\224\271/:\003\004h\356#\232\354O\276%\252\353\233[\023\370\271\255o\335]7}\34065G\311(\303YO\355\315T\205Iu\332We\345\364\271\256\207CUk\322\234\016Q\205<\317u"
+	.string	"7]\371\204X\237\245\353c=\207\323\021L\246\323\307\322\265\316N\322\352\311\206\024\227\264\2476\247q\372w\244J-\331$\247\237\005\240m:\247\017\246\3266A\265Y\017h\332\231\\\3263]\313\232\305\214<\006\r#\243|\250A0\345\224ch\204DDD\222\246\205\003\240\002\021\242\";\020pV\2424\007\223FBJv\352\217\370C\247\237E^\202\t;\210,5\267!\356\251\022k4\020\024{jF\2174Q\007\223m\215Y\2243V"
+	.string	";6\373g\003q\303x\347\b\\ \352\253\332\325\242"
+	.ascii	"\265\353\213\221^^\224f2\204\333xk\201}\225\255\035C\223\253"
+	.ascii	"MDp\f=&\243x\327\301\022d8\r\314\331\n\003Z\346\350\252\210\b"
+	.ascii	"'\237\315r\333\275\016\302\302l \353\357\023\232B\353\001Q\231"
+	.ascii	"\013\n^\0050>\274\t\317\t\025Z\376,\271\343\230\361L@\030\242"
+	.ascii	"q\251\247:\2059D\004\245\017B\230w+\246,\312]\224\362B\276\376"
+	.ascii	"(3\016\262\216L9\013\253\342&MB\332\321\371R\314\0226\b\330)"
+	.ascii	"\2018\233|bW\342y,\3340\025\033H\r:\355!\302\345\376D\310A\237"
+	.ascii	"\340;bQ\001"
+	.text
+	.section	.gnu.lto_taskHistogramAdd.28.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\215\003E\032"
+	.string	"&1\251H\240\230Q:\245\312\230\2425F;\334\203\334\371\026\205\202\334\004?\356{\026\006\375\275\201\313W\220[\266\237-\376\025\274/\231\361\222\007\244\201\227\306\311\361\020s\341wb\034\037\274ARxnB\3672\265V\3627!R\246\024\222"
+	.string	"\214"
+	.string	"\225"
+	.string	"\020\304\2070p,!\273\332\347q%\332\227@<\300\234GOC\346\354!p\002\361\241{\247\221\017\305\313\310\207\246\331T\336{1W1f\340|Y\346\234\261ua"
+	.ascii	"\007{\267T\332W2\024\301U\232\277\312a\025\351\206\276\0027\352"
+	.ascii	"\2117\352p`\203\235\013&w\n\241\262"
+	.string	"\006\212\207\"\212\213\340\201\335\222\023w\272\216\320\341@\232\250\026Sn\303(\205\202-\335\211\357\250#\002as\316\373\2569\235Mu\2253\347\264\026\351J\334\254\333\346\331\246`o-\356\r\351\"\331\367\223\257\212\021\357\221]\363\245\177\006T\313\234\351\217\001\325\2577\335\243T\303H\365\213T\273\244\272u5+T\213\241z%\325\362\3520T\203\241zA\265\202\352\017\3009\332\255\210\221c\237\364&\211\037\227\t\025\026\231\361\246\337\376\210C\346\003\361\235\354\032\223\232|\004F\324\233\272\bJ\240xd\231 >\374}v\2150d\366\017\017\342\220\221\330$E\207\2259\247\315CG\360\270\223i\357=hg\372`\326\234\274-\001\273Zu\202\253\2529]\234J\032\262\033%\245$\025.\222\177\002\"\230\214\304=\262\252\315U)i\2672\373\332\334\376~\347\221r-\370\200\342\013\t\342\021e\370 \344C\271\317\251"
+	.string	"wf\303\375\355\206\355V\"w\301\375\315\306kw\325\207\253\252\351\317\212d\252\311k\377\343\016X\324\224\n\004_2\013v\271]\371\302\356#R7\234\272\321\260\351\317,\215Y\333\207\203|\321\367DX\020\355\320oxX\240\354?\310\230\325%\037Q\210t\213i\222\214\264HM\245r;;*gB=\025:\204V\300\200\301\005\231L\301\002\034\032\240\240\031\217\216\220\205\225up~f=B\027f\030t\200b\032v*d\210\351\374"
+	.ascii	"\305p\n\330g\303\354'\026\344\343\363\023s\365\346\367\310\022"
+	.ascii	"L@\325\326f\230}\375<\362ea\026\301\313~*\247\242\346{+\211\256"
+	.ascii	"\311j\221\314\332\021\326l\bC\264\371\270\271q\037\200T\274q"
+	.ascii	"sjJup\3169e\315\276\351\260\232R\371\346\343\326\354o;\003H\264"
+	.ascii	"\270V\300\213\027I\335\274\265\256\335 \267*\233\376zZ\342\316"
+	.ascii	",\353A\276Zq\fD\250a\034\305\214sD\240\b\rE4\243\005.\006@\002"
+	.ascii	"b\220T\347\001\020xW\232\244\003\217\006D\335$\0354Q\376\216"
+	.ascii	"K\220\321*\201\265\027\t\344\200&\006\234\341\002Vm\007\020#"
+	.ascii	"\266\032Dk\244\025o\342\256\202\265\n\331\371\306M\022\316\301"
+	.ascii	"\265\032e\320\340\361\230$\362\273x\372\022\364'\261\306D\346"
+	.ascii	"\305\340Fs6\3758\b\006\2729\276n\207\373\026iIT\22756\252\376"
+	.ascii	"\360\330gmVt\253S*r\346@\236J\222;m\341\370\356\177qT\024`\354"
+	.ascii	"\311>'\033\307\235\211\336 \310M\360?"
+	.text
+	.section	.gnu.lto_rescheduleTask.29.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"M\f"
+	.string	"&\027TB\020q\233\016|J@\373#\216\225\177\304E%\241^\213$\200\202\036\310\004\034\216\354|'\231~\235\3241\021\333\"T\356h\2104\332\030b\206\007\022\247\3036Y\225s\240an\276\366\375\255\033\331R\246\024="
+	.string	"B"
+	.string	">"
+	.ascii	"\237\3427\324'{\366\213"
+	.string	"\207\034\366%L|*1v\327\322\r\367\0365=\277\342\300\220@\321\343\305\344\272\001\226\304\316\356>\345Y\001\034eV\034\273\353$\201\027\356\351\266\021\330\366\260\177 Q\323\252\351\324\3641\002VRx\300\330\265\320BcK\023K\007\333\267/\302\2633\266\246\305\225\371\224p\302\212\216\313'M\351z>\204\377\341 \274\243\220\030\263\233\201\304\312nH\300\005.\237:\347P\001\026\031\311\223<\251(\325\022(U\006#X\224\244\f\247^U\325\305g\022 5\326\370<lNBE\275\246\312\3072\312\026'\n\f*6g\330\241(U\203\375\270\273k=\261\037\376\325Q\376\335\306a\241\216l\013q\232\202\021\r\004\200?\327\225\201@\037\003\036N\226\300A\367\021B\031\363p\332\003\221Lk\200u\026H\350\003\202\205q\235\345\031\340-\202\306Y!\333\306Y\231p\257'^p\242DAG1RYiT\007\027"
+	.string	"7\215O\313\276\231\026\357\034\262U\024\270\003\306\022\325"
+	.string	"\020\201\270+\202=\230\270 \004\270\362L;\026\227\021A\"h\f\206\302\r\\#"
+	.ascii	"\303\241&oW)\003"
+	.text
+	.section	.gnu.lto_setTaskEnabled.30.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`>\001]\016"
+	.string	"V\034dE\360\260(\035z\236)=\333$\370L\375a\262|\332\241cs\347\220\360u[n\334\222\276\316S\257u|d\026\217\277\324\270\246c\356\357\354\225\315\227nZy\330\210@\006\347):Ar4?\032!\204l)S\nM"
+	.string	"S"
+	.string	"L"
+	.string	"\273\032F\224\330\005\013\330"
+	.ascii	"\367\314\343\035\332\263x\016\355\231?\273\305\301\016{\0226"
+	.ascii	"\253"
+	.string	"\027\214\335\355\224\303\277G\315\317\337@\034V+\365\310\265\\a\317\n\255\225\350\261\273w=)\264T\231\033hw\235\254\326\205;\273m\021\333\n\354\263\004)v-\20436\226\325|\260}\017\314;\315e:\036\032\317>\314\237\271\210\357\257\b\337\t,\034\026\213\033\027\273 \201gN\300=3\310\335\227\371\354\216\355y\3614\3572\310\201\357 J\200\277\210\301\234@\300=\363x\360\236\017\341\303\034\304\367\230\024s\002\253\032*\031\346\356\256\032ES\035\231\261Y\311\030N\275\252\352\315\252\005@j\244\261z\341x\212\026\365\232\257U\215*C\247\t\024+6e\330`*u\203}\r\3030\264\272\330\007\377M\323\332c\376\230i\315tf\372\033\0020\250`\020$\247\020*\216H%#!\023\322\346\017\317\033\205\204|\200|:F\"$\247\020J\263\350c\"\225\234\214H\rD\247\316\304A\350A'2\235\272\317"
+	.string	"\227 \220L\035\252T2u\035p\037W]\274 CLEU1n\251iT\373t\222g\371\256\203$h\312\233j\352\f\027"
+	.string	"7\215O\313\276\031\323\256dc\301V\240\017,\026\252\204\300\301+L\\\030c`\027ty\346\032\205\013\306\263\330C\273ZA\034\fu\020\270\366"
+	.ascii	".G\r\342\017\245\f"
+	.text
+	.section	.gnu.lto_schedulerIsIdle.31.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"\025\007"
+	.string	"\362\r25`m\322\001"
+	.string	"\273\317\r\350\373O\317cV\025\342-\266=\bp\355d\032\212lC\275w(2\025\360;\224\244A\020\220\254\317\253\251p\005\b\347\210\020\"eJ\001\306.\230)< d\tX\3451P\016\026\036\006+\357\032\260\326\220\301\347\240i\360Uq/\255\202T\0054\312\331\277PW\325oD\\v\3669\336q\361/\fa\311s>\371\026\352\3235\300\342\243\311\316\325\304\246\211\0353\251\024\366\245\335]+\310vZ3}\351\"\032\243\022J\310n\247;\331\221I\224a\033cW&(\300x{\254\350\034\343\263\361\030\355\306\247\241o\317\315\377\306\255\b\020\216\344\303\223y\002\030\354\256\223\343\221\270\365\266-\333\317v(\b"
+	.ascii	"i\331'cz\365\206_`,\254k\n\023\"\207;\367j\347\023"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.32.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\207\001\235\017"
+	.string	"\226\034iG\320TQ:$\202f\303\215\337r\301\302Zp\331\024\205\311=u\376!\341\372\216\017<\270\007\330\307\213UM\213\315X\303\302\340\016\220G\253\361\205\027\034\332\fl\331J(r\202f\020\315\313\357\264\035\306\242\277\367\226;\245T"
+	.string	"P"
+	.string	"X"
+	.ascii	"\321\366\363\225N\214\300"
+	.string	" Tdw;\225\243\314\313\370\223y\251&\356}\312\250\320\363s>q|\334\220\250\357BT\331\335\323g\001\306\t>^\314>\020\327\310\202\373\210P\337N4Q\021$\305k\207<\237\016\204\245\226\3355\234}\036\356\322m7\260\275\300>\214\312\340\206\264\003\215\370\265\0030\252\365Xx\304\266\345@\365\261\037W{lCOC\313\323~54T\350\227\b\344\340\361Bd\227C\022\222\335!k\240\260}c\237l\223\f*\bO\263\261i\267\004\016\032\273\266\003FPri\333g\361\0267\366\002\273\212q\034\214c^\257y)5\005\211\226;\356gh\205\024\200s\323\201\022aC?\024i\020\022%|\310K\340\013U\210\225\354\356\201j\346\345T\023M\006\223\354\273\370\255\306\007\362\f\r\374\354\322\247\231\227\327\002H!d0\311\001\214\212\374#hH\007U\037\237\334fj^Q\251Z\253\325\nK\n\245\245"
+	.string	"&\346\"3\315J\301\\\017fZ.\007\254X\007\341\305%\246c\301b]\312\200_\021\\\260N\346\365\202u'\333>\256\366\370$rD\321\367\346\223\344\202\244\324\327n\002\222\333\240S\241\362\250[d\2523gx)G6\205\313\210\r8\332\r\037"
+	.ascii	"7\215Ok\037\022\246\3014{%kk`\367\355\243\b\037\227\3640\375"
+	.ascii	"\206\206\201;\200/(\005\362B\017\203Y\003t\001C\222\026K\027"
+	.ascii	"\312\026\246%O\230\200]\023\351\265\3209\023f\361\223c\204k\200"
+	.ascii	"\033\241\354Zi\037\215\240\240"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.33.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\365\b"
+	.string	"\306P@< \005)\035"
+	.string	"\254`\023N^\025\"\0242\020\246\303\215\223\331\333\005\365.\033\372\3747\354H\201F\020\240\370]\231\234$\004k(\200\206\241Q\326j\003Xl\b+\363\006\025i[\246\024+"
+	.string	"."
+	.string	"/"
+	.string	"\016\003\327,\3324\037E\366*&\034)7\273;e\310\305\253\350\377\344\004-\327\352*"
+	.string	"\261\273\326\226\313\343\226\267\315`\273\302vI\022\304>gw\327\362e\037\366+\007\241\346\305\264\262\3331\013\2601\215\205\304\366;v\301L\204\252\rz\020\017S\035\\\026\003k\331\035\033\034\3357C\317\373fg\334sV\276(lb,\271a\225>\312G\225?b\215\224\276u\315O\005\\S\220\371`\351\314\352\"\203Y\005`\217+\r\376\204B$\221\350\003\362\030t\340\2047\002\271R\b\226\302-\2240\201\333\250\013\267\023\212;m\\\2029\317\327\235P\244\316\202\003'Fi\273\230\334\007N\317\202\275\214\t"
+	.ascii	"i\312\274\264\354\2331}{\303\3420\r\306\005\227\227\232\f\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.34.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"\005\013"
+	.string	"\326\224K@ m\225\016\334\303`\2040\016\224"
+	.string	"^\002\260F\004\272\022\2101\021\001\314\013B\240\2121N\303\270\032F\211O.\f\243;M\002\\\342!\272\252)\212D'\004\347\306\240]1}m#dK\231R7"
+	.string	"8"
+	.string	"7"
+	.string	"\236\375\341a\204\375\205\326\007\013\261\273\234B\270\367\250\351\371\020\216$\005\232\036#\252+\005\210\212\227\335\375\353\251"
+	.string	"<eB8\273\353L\201\fn\355\2665ls\330\267\004\232\351\314\364#\026\326\206\020\210\335\0053\022+\323b\022l\337~\350\331\023{\302\202\346\371\227O\341-\357\256\222%\273\0164`\330\r/\214\021\271vye\273\026O\331\2569jJ5\202M\325\243B\007T\212p\352UU=|\252\212\324X\342cQ^\332\242^\023\366\305N9sfh\300as\204\035\232R\037\330\217\273\273\326\225}\327\0373\035\316h4\237\315&\223\201\251|6B\243\016i\263\007\323\201\002\024\370\200><#n"
+	.string	"\200\216"
+	.string	"\316\323\2158\214\205E\004@\035G\022\211:n\022\356u\345\216\t\262\004z\212Q\313\250\266\201\003\371\224c\024"
+	.ascii	"7\215O\313\276\231\026\357\034\222U\024\270\003\306\n\325*\020"
+	.ascii	"\201\270+\202\025\230\270 \004\270\362L;V\227\211\300\335\007"
+	.ascii	"F\031j\310v\2252"
+	.text
+	.section	.gnu.lto_schedulerInit.35.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\005\0025\022"
+	.string	"&\241vJ\320\320*\035\260\216\353I\006l\250@\t.i\343!0v\207\251<PR`\340\373x\243M\350\270C\205\211\007!\204\326\200\345\230\030gZ`\214\221\301\254I`!r\016,)\327\207\021\360\\(\003r\250\372QDd\023\262S\n["
+	.string	"b"
+	.string	"a"
+	.ascii	"&~\"v\024(\240\271\263\267\304\320\271\365v\315\004\257V\320"
+	.ascii	"\361J\272\030\276\202'\020\2321\373\271\224\337\\eh/\267\335"
+	.ascii	"\035\275\372\270\024{\364JG\226\3316n\322\366924\324\364vw\374"
+	.ascii	"@\\v*\363o;\200r\246r*b\260\273\246\345l\303\375\335\366\001"
+	.ascii	"\333\017lJ\006\364\345\253\377\n_\013\374\334 i\016\213\273\226"
+	.ascii	"3h\351\220m\256\320\357\203}p\277\030[t\272\275x\b\361\363\315"
+	.ascii	"0\227%\007\216\345\325\235\021\276y\234\330o~\315o\252\314\214"
+	.ascii	"\354:\030\270.\373\321 q\252\3646\006Y\020\273\016vsY>\343\240"
+	.ascii	"\343\325\266lo\026\254\325\350\225^=D\234>z\032?\2479\211\264"
+	.ascii	"]d\307;\203\\\240\314#\376t\360)\335\357y\013\367\3705\247\314"
+	.ascii	"c\236\360U\244Q\035\007\017z\227\033FX\372K|\207%\200\266K\276"
+	.ascii	"\364u\316\202\202_{\365\b\213\276d\205\271\222\026}iR\206O\305"
+	.ascii	"\317=\200n\346\263t\250\256\340\235B\342\016\346\207\205~\212"
+	.ascii	"\253\200\3715_x\005\252\025\311\004\224\311J\344\217\323I\025"
+	.ascii	"\022\362\001b\022U\rX/\324I\350\224\311\265\"\301\240ZUH\275"
+	.ascii	"F\223\021T\311\230r\275F\223\001\267,\254\\\343I\253\345\032"
+	.ascii	"G&yp\277\230\272\003:\201\310o\305\246\371m\257;^\017\210\244"
+	.ascii	"C\036@\021\374/\356\343D\220Pq.\2023\317\240\233C\300\301\234"
+	.ascii	"B\233\363\333\234D\036%\f+ @\002\302\220\331m\247\361)\357\033"
+	.ascii	"3m(\roIC*\303H\206\205\022\313<\302\3650\362\00775\330\367=\233"
+	.ascii	"a~\261\243\304\260k\2214\n\264\361eyA`\006G;!4\031\206\035F\261"
+	.ascii	"N\fC\210\221x\266\302\310>+\360l\260\241Dc0\036\327\316\276\266"
+	.ascii	"\214\t$\nd?\270a\214\343+\240\351\026\355{\002"
+	.text
+	.section	.gnu.lto_schedulerExecuteTask.36.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\246\t%2"
+	.string	"JU\270\022CP\346\316\030\017\252\017z\203-\241\255\353z'Au\007\230\025\236hQJ$\n[\036\030\022\020\300%9G\032\276\367ID\364\024!\001}2\007W\3571\017\210G"
+	.string	"5"
+	.string	"\273\331JKVn)eJ)\005\035\001\375"
+	.string	"\033\001;\324\240\274\357K\204\353\362\005\256\313\234$m\257on\356qk\372J9\304\251\233b'h\013\024{\277\261h7W\235\276\322\236\362\026\2053`\243\267\260`&\366\352\3140\270\325:K\2671\261\230\305\346fy\003\324{Qc\r\353\270\005\364n1\231q\326l{-\206A1c\301j\263\276\332-^Q\275\367\235\"{\345dK\354\203bo+\256\n\364n\021\361\352\320\366J\314\203rg\356\264\256\002\243\247.:\350}\213\340\301\275\357\324"
+	.ascii	"\037h{\345i\313\314\334Rz\n\fv\325i\231t\270\304\217K\315\316"
+	.ascii	"\373N\237\216M\304\366\252\266\020\333\353\037i\267\207\3026"
+	.ascii	"\310\256\352\273\313\335\326*\024\277.QiV\017\225\204=\344F\217"
+	.ascii	"nU\002zqt\332\356+L%\3622\213\266\223/\036\036\334\321\254j\024"
+	.ascii	"+\223\303G\312\2452\241!\342\006\352+X\253C)X\277*\024\346v\347"
+	.ascii	"#\335R\013\334\241\365\350\266\366.\351\323=\030\341}_\366\250"
+	.ascii	"\364F3\261\231\231\214\231\325\230\205\007\002\376Ho\374\203"
+	.ascii	"\212==\220\377\325o.\300\022]\227\374\3675fe\323\271\376}\227"
+	.ascii	"\347\035\346vw\246>\031/\273\214\333Y\312\222^\330~\207\026\026"
+	.ascii	"\367\177\305\366\367\244]a\263\345x\2309E\217\271j\337\367e\300"
+	.ascii	"-\246BT\253\304\005\333k\277\023\2224-\017d\247\303\321.\333"
+	.ascii	"l\r5\246\345y\330\311\374\331\275\236\207y\372\364'cn\365\375"
+	.ascii	"\"\314\310\226knb\235\227\202\316Jm\245\373\310\316I\354\214"
+	.ascii	"\324\323n\001\357ld\347\243fk6\022:\007\030:\027\r\235\211X\347"
+	.ascii	"!\326Y\210u\006\300:\007\261\316@\254\363\017\353\354\303:\367"
+	.ascii	"\260\316E\326\231\310:\017\205\316\302\326\271\r:\007Yg\226u"
+	.ascii	"^Yg5\350\374\254\263\257\316\235 )\007\032f\234\367\365\n\364"
+	.ascii	"{\353V/LZ\256\233\255\235\271\213dP<\307\304\242\0219,.^ezJ\332"
+	.ascii	"\0133\221Y\264\026n.\035G\f=O|\237_\373\240b\317G~\317\033\255"
+	.ascii	"\315s,\361\213/`\016\n\370\304\320u\\b\030\3447[\037\265\206"
+	.ascii	"\217\37473|\027Hr\336\364,|V0\266\365Y\314\254\241\347P\t\277"
+	.ascii	"(/\255H\367\245\351[\256\217F\316\274\241\203w\264\351{\314\330"
+	.ascii	"\363\263\270\347\272i\320\305\331\275]\206G\017\256]\271\261"
+	.ascii	"\330\237\275=3v\351\215\337\305L\266}\023W\330\300\3518Ln%\374"
+	.ascii	"\001\204w\024\304\027\363xT\261\373\031\362bh\"X\346\020\335"
+	.ascii	"F\004\336\234 vo\236\313\204\344\007\020\273\3403\217\3505\311"
+	.ascii	"!<\365/\312\307~p\375\343\263\317\376A\317\236j\334\365{-\317"
+	.ascii	"\207\361\033K\360\311\322\330\005\205\241\003\253\323\342/\327"
+	.ascii	"\262\304\217#\270YT\f\r\373d\354*\322\367P\331\023\373\244?\372"
+	.ascii	"\256$\253\364?|W\350\272\333z\250fo\354\216\336\322+\275Q\037"
+	.ascii	"\027\340\321\037\177\351\215}\320\263\366\322k\340\220\216k\341"
+	.ascii	"\233\036`B\344\300\035\277\337\372H\007v\364\275\326!\324U\375"
+	.ascii	"SSI\nRVI\017\313&\023\305r\302\221\211f\025NK\252(\347S\025\223"
+	.ascii	"\212\212\251<Jv\0253\312y\245\\\266\260\020\344\224\260\274\252"
+	.ascii	" \304RV-\235\311\f\316f\322\331A\312*\351\004\262\372\260\244"
+	.ascii	"\212\362\340\254Z6\233W\312\036F\320\240\301\t\007\016\020$p"
+	.ascii	"\"\222\262Jz8\261t*\227SK\253\"+\235\232\313\251\253\023K\025"
+	.ascii	"J\253\247\252\250$\325\223\262i\365\344\244\304\314\025\313\346"
+	.ascii	"\223\223\311l>\021\247Z\255\276_\244\275s\006\216\260\301t\317"
+	.ascii	"\265\360M\237Y\213|\243\357bf\243\1770\246\365O\36638\210A\244"
+	.ascii	"v\357G\030\032\375\370\034\300o\004\350\266&a\307\303\304\360"
+	.ascii	"j\"dr\343\027y\241\271\215\032EH|L\216|\242gv\237\270Q\274\243"
+	.ascii	"\254`,\306g1{T*\312\354J\361\031.\225\005xn\025\227!\241\327"
+	.ascii	"\001D\317\276Eu\354\r=\324\370B?\364Mo\024|K\350\033\344\235"
+	.ascii	"\001\360ZjA\017\340\233\336@\351X\3607\350! !\003\364\200\310"
+	.ascii	"\377y\240_\347\240b\027\332\357g\214\317\343q\213:\312\027\200"
+	.ascii	"\303\250\2018\350\024R2#\"\242 I\2224\006\240\242\2212\252\007"
+	.ascii	"\021P1tFhD\222\302f\330\f\271G\025\022\225\244\372\306E]\374"
+	.ascii	"\273CJ?u^\007r\307h.n\006\273\334-\222\3613@j\257S\021\3652G"
+	.ascii	"q\004\273x\262w/A\325\031(\231\200\335\373$\203O\037x6<\371Z"
+	.ascii	"\245\035\375*6\2553%\024\372\177<\035\241]!qc\376h\303\036.\201"
+	.ascii	"\031\202\016.\351\202mgX\222&\265U\362\025\216\032w\275\334]"
+	.ascii	"AR\303;\037\350\033\033p\240\266i\033f\274\362\316\"2\036\200"
+	.ascii	"P1\002)\302\365\301\275w\246W\360\265+mO\020X|:\3323w\tH\034"
+	.ascii	"\025iY\270l\253\242\302\365\2351<\253\366RT\375\333~Y\377\304"
+	.ascii	"h#\326\031v\220@'n1\337\264\201\035^\347b\305\n\211V/\300\352"
+	.ascii	"d.\030\250\232\340\244\320\030;Eu\242-9C\373\0244\037\"\2038"
+	.ascii	"R\314|up\323\177L\245\347\007\273d{B\317\354z\235\031]\337\031"
+	.ascii	"\375\354\317\001\335\253u\340r\277\020U\243\314\203\243\2055"
+	.ascii	"\002\026t\220N\315\255 F\004C\202`\223Hx\257\221\276 c\003;d"
+	.ascii	")v\246\357W\032\313\351E\335\326\215\367\335\031B\331`2o\353"
+	.ascii	"\374\201\013\331~\234\" X\244\2148\230\024l\266c\371\330\237"
+	.ascii	"f\253\017@\212\270\310.\301\345\023:\204\266\205\202*6\2615\244"
+	.ascii	"\253\300R\257\361O\350\034\237\t6\275H\251\301e5"
+	.text
+	.section	.gnu.lto_schedulerDynamicPriority.37.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\231\025\035f"
+	.string	":\247\030%J \020[\031\016n\373\310;\177\3153\276\202\214\377\tz\253\f\334\274\312I4d\335{1\370-\350\265^\221>Z`\031\261\241\020;\364\371\001\206)\276W \360\342\220\037\333\023\322\325U8\373\221\b`\300\306;\022\311\336R&\031>\002\005\002G\002o\376o~7\377\232\237\356g\376v\377\335\217\346>\273W\355\nWU\313\020\026\361 P\313\r\254\244\313\340\252j\n3\020Q\005? \234\273\2038%j\037\303^pU\225Js\353\253\332\372\262,Z\234 \366\035\217\252K\2426p\231"
+	.ascii	"\006\205u\300\004\363\007g\037\307\017\316v\035U\254O\365\340"
+	.ascii	"\210\004\213z\251\235\250\275\336\236o\325\024\0077\027(\022"
+	.ascii	"\306\035[\370\036\006\327[\226\322\002\006\273\352\331\354\252"
+	.ascii	"\373u\275\r\342\322\026\267\256\253\fQ\3734\373\274\264pM\227"
+	.ascii	"\227b \225\243\232\257]\365\350\361c\276\302\313\334\314\361"
+	.ascii	"VM\341\316\234\005\345\321\024q\022c\256i\022(2\317v<\352tra"
+	.ascii	"\341B\371;#NH\230\353\031\013\3057sw6`\222y\235\362vG\316u\215"
+	.ascii	"\271\252\331\310C\270u<\272\314c\232\206\t\346\264\024Z\305\316"
+	.ascii	"\016\2638p<\232\276\211\372\334\305(O\007\346\264d\256h5\026"
+	.ascii	"\317\314\335YW&\212\243\273\342xT\350G\306\243\374\"\343\321"
+	.ascii	"U\356\036\236\t\267\366`QCV\346\316\272\256OMe\227\026m\345\233"
+	.ascii	"<0-)%!\035\031\025\021\r\t\005!\201~\324\324\347\330cD\317f\345"
+	.ascii	"\276G\n\357\"\330\354\352h@\223\206\344Ms\367p~\020\204\241\313"
+	.ascii	"\233hs\247\210\022\242\340\035/\f3\235=I\316\256\274\211\006"
+	.ascii	"\346\214\241\003b\2335^\232\242\366\345J\347\211\243\244\223"
+	.ascii	"\251\355\005\021\336D\303r\222\210\301\2048G\2722\350\205\217"
+	.ascii	"\274\334h\360!\232hq(p\021\321~i\345CU\372N`\241*\017\352\221"
+	.ascii	"B\206pSk;\320y\002\221\r\016o\242\265\235GgW\312.\207\346\204"
+	.ascii	"\177\236\234Nrh%\260\332#\345\246f\345i\023\255\311\351\024\370"
+	.ascii	"\020rhL\330\347,bK3\370&\032\334\231bp\013\223\313\241\261\361"
+	.ascii	"\261\357\274\2507\367\305M\355\313{\324\26406\"\323\310\2367"
+	.ascii	"\306\250\226%?\317\250\275\021\316\220ib'[)\224s\276\263Y\032"
+	.ascii	"\031\367\363\316|\207a4\240I[r\356\221Z\327u\271,M\355\373\341"
+	.ascii	"\273,b\367 v\213\024\bW?\353\302\001\230\347Q\274j\2376@:\261"
+	.ascii	"](\233\223\342V\r\244?\326\206\307\252?\024\256\261yj\206\216"
+	.ascii	"\336\217q\304 \016\331\001\374\322d\201p\n\337\331o\213\342h"
+	.ascii	"s\325\001\212\261\016{6\3327$\313\243\243\251\372lT\315X\226"
+	.ascii	"0^\334\037@1M\035}7\335o\035\335e\306\332\302\272\373dy\024x"
+	.ascii	"\016\013p\277L!\335.\217\333)r\\W\261\027\373:\3122\007\216q"
+	.ascii	"]\306\243o\025U\350\370~\234!Q\257\375\230\334\341\320\373\243"
+	.ascii	"\363\236\276%2\361 .\367vS|\316\221\343"
+	.string	"\272\2561\366\210\227S\265\217;\272\021L0\201\361\350\217\376P\245\r\233i\001\305\367\206?\\\027\366qK\301\356\361\313v\317x\364\b\256\316\222\027\367{O\315\260i\256\234x\214\023&\020\017\235\274\237]\334\216\022\231\277\021\343\357\336hx\262$z\241\352\243\271\323\222\023w\210w}X\361\313\250\372lP\302\032\311\036%\256x\346\254\234\270\313\f\343~\333\375\013\022\372N\330\226\262\313\274BT\336 *o\022\213y\257T^ *\257\025\363\376\360\321\343\315o\025\217\273\371\3528\232/\325\337|\247\244N\367\275q\346\327\306\231\337\250\333}k\334\356K\343k\2763~\367\225\221\362\306Hya\244\274/R^\027)o\213\037\336\002\220\274,\220\274PH\336\025H\336'$/\001?\274)N\367E\201\344=\221\362\016\220\362\232Py\005HyK\244\274$\220\274\001 yG\374\360\212HyC\244\274N)/"
+	.ascii	")/\210\224\367C\312\333\224\362zHy\231R\336\245\346Uj\336$\225"
+	.ascii	"\027)\345=Jy\215\220\274EH^\"$\357\320\017\257\020\2227\b\311"
+	.ascii	"\213Ly\201R\336\037\225WMy\323\224\327\007\311{\004\342\355\371"
+	.ascii	"\3415\252\274h\312{\246\274\255\362r\312\373!O#\245\255\004,"
+	.ascii	"k\232\006\346z\266\270\303\032\210\266\301\022'\372)E\0230\227"
+	.ascii	"\242[\024\322-\256\020C\027\021\210\372\355\007A\314\337\341"
+	.ascii	"\320\211\276\233\342\211\006c4@\237\350\323D\227\350\001zI\200"
+	.ascii	"6\341E)\346\330\337+\244#\321T]\242\215\177)L\221\350\032\211"
+	.ascii	"adj\200\023\352\2670.r\202z\364\370\013@nD\007 \242Gd\021\341"
+	.ascii	"\327\\\257\200\225 \254\323\327\\\343\246\004\250\262\266\344"
+	.ascii	"E\2423M>d\210>\001Ut\352\020\3751\034\340Ppj6\303\006\200)X\252"
+	.ascii	"\032D\003 \005\013\210n1\346C\273\275lNS3\365\2076\032\216\265"
+	.ascii	"y\350\252n\352%E\364\353\202\221\251=\364\307\362p\033?\231\322"
+	.ascii	"\242\334\262\305x\224\251_\247pmI\330\024S\325o\336i\271\324"
+	.ascii	"U}\316\260\324O\274\340\211\b\233a\226\340\3408\001R\352\313"
+	.ascii	"1\023nbD\331E\251\002\277L\251\202\361\250R#\025\256}\3314/\300"
+	.ascii	"\301\371\341\261'\365\351F0RS\365\366tR;%i\244\3562dy\214\232"
+	.ascii	"\252\217\272I\221\007\257\031\365\017\003\233OT\037}:\251\366"
+	.ascii	"\321m8\326\026\346\244\250GPd\264\023uQ\243\177C\035\324D\255"
+	.ascii	"\344\302\230\234P\017Q\261\b;\204\272E\223\240\336U\206a50$\302"
+	.ascii	"\323\260l\316\301\214"
+	.string	"\310\016\002jd\243j\310\362,;m\240f\372\033\003\243\366\217\002|\246\024\243\366_(\244\363i\252N\273\347o\f+\231\362\351\333\025\322-\3174\331\316\346\205\r\227\364\330w\303\301f`\307F\"l\222\320\004\274\221\300\017\0216\323\232,'\307\215\320'i\354i\256\272\032\020\340\016\222/\226\3038\330!\201\2366*D\027\231w\346\244\300E\t\332\261\337\226Q\274\347\300\342G\226g\274\r?\337!\310\003$\313\353\275\021\243\2146\353\273\217\341\"\024N\362\367B\237\235\346\032\026\005\205\001\3514\301\214g>\n\312R1\360G\214\267\373\r(x\257R\324\3033GF\377\256\247\337\026\375\016\243\261\373\260\016\206]*^w\030\373e\3320J\226;\306~\3336$\303;\257\232\212\f\217\177\364\2146\243\363\031\215\243\0061\326\001\315\301mFK-9\361\347\272\256+\032CB\264\262\034\340\332\312\241\225\354\332\252"
+	.string	"G\322"
+	.ascii	"-+\034MZ[YWHC\206X\341\270\322\372\312a\301U\262\002\034I\256"
+	.ascii	"\255 I\003@xM%\275\276\256\222\032 \340\245AR\013\310\202.+\257"
+	.ascii	"\263\253*I$\353\001/\255$\027\327\327\025\320\020\253\f\270\222"
+	.ascii	"^ZTX\\V_\t$\211dy\r\261J6\220\304\312\352\362\372\332j\3721\342"
+	.ascii	"\225\305\265\225\305\305\300U\026\021+-#\007`%\275\256\222C\222"
+	.ascii	"]\036\026\n\006\f\254\0301\240X\2508\352\262\240\313\352\001"
+	.ascii	"!ZY^YVE~\366J\005Wr\310\027V\262\202\253\256'\255,+\"OW\\]O*"
+	.ascii	"B\354\326\005I\256'\257\255-\256'\225\271|K\331\343`\b\201\313"
+	.ascii	"\016\333 \267\225\023\237e0\255yFPN\263\251\337\230\252\261\234"
+	.ascii	"(\237\360\313"
+	.ascii	"\366_\240$)\004l\332\201\214\233\207%\251F\261T\243\261\260\032"
+	.ascii	"H\235\tA?\254^~\303}G\242(M0\301x\324\250p\215/\206\2337\030"
+	.ascii	"\375\242c\354)\251\274)\255\300h\2375\024\375\242YQ\260\205\246"
+	.ascii	"\213n\243\244bl\321.\326p\236\222J\025\245\025+\306\243-\032"
+	.ascii	"Daz\347$\216\251\337\026\214\fOIH_\351\371\321S7\320\305\021"
+	.ascii	"\244\242\362\016\303n\243\315\366T\242\321\307{\0027\030\222"
+	.ascii	"\345\365\360\3625\332l\371\251\306\221\342\251\321\267\263\321"
+	.ascii	"gJ\365\351\246\372o\342\340\r\206Y\352\267\345$\250\346#\250"
+	.ascii	"_\271kr\005\t\312FG\265\031'M5\037M\365\007\357sG\213\037Y\036"
+	.ascii	"\322T\357iT\243i\b\351\277\271\235E(~\273\034\310q\032\306\023"
+	.ascii	"\022\204YHv\0206\223\364\203\243\316\241\321\267;s\342F\265\224"
+	.ascii	"\335\033QP\205\300%\363(\241`\227\300%'\262R\277\255\361;\214"
+	.ascii	"\005\264\252\345nL]\241\030\353`W@\367X\213\363%E\016t\242$\365"
+	.ascii	"\033\213\006Br\027\246\016\0062`,:\251"
+	.string	"\n\033\252\t\223\202$\243)\370`K\ft\004\007?D(\330\304\217\311\330\231\243~\273sHE\211QK\311\2216\230\372\350\367=\007\333\030\021\217\336sH\252\037\370\267\335-9D\366\350\033mf\243\241\232\253\016\006&\030T\033\235\021dk\336\350\323\025\361\340!\230\266\202\356\251W\020\320\001\201\275\250q$&\235RjDDD$I\222\264\006Q\005\204 \346\034\204\266\001\021\0205TJ\321\214\246(\205\302\326\0012\002\020?q?\023\306\021Z\351\262\003\r}B\243\352\261\364\320\334o$\244\364\246h\327&\0370\226*\326\214\267\224\234!%\025\b\353t\031P\347\337\321\202s<\373)I\200+\037+\210\020\357@\244Q\367L\243\314\244\0034\020\361!I\202\334\307\310\304\n\201\301\375r\255S\301\031\332M&]\fA\233\2355\372A\245`_?\260\252\372\335\367\\+.\315\370\275\032\235\320a\275\341S"
+	.ascii	"\253X\305\212\037\f<L\244\024WL\276\3478\371\267T\256r\001\016"
+	.ascii	"\317\317Q+\330\376\315\264\226Z\001mI\301\263{\006/\332C\210"
+	.ascii	"\326HgP\374x\200\326\221\241^\036E1\366+\230\212\360\261\346"
+	.ascii	"\342\241\222\2600t\375\252\273\233F\t\347e*N\377\304\273\314"
+	.ascii	"\301\030_=\263b\003\2272Y.\217!\31125\211\336\030\376\223yP\274"
+	.ascii	"c\210\267\\\215F\342-p\250Z\342\214\345\244Yb\254\207\bc{\361"
+	.ascii	"\366\220\334\027\013_O|\306\024\313+A\006\241*\343\350\003s\231"
+	.ascii	"]\231\323+f\270\306\254\370\247\356\200KVI\032\"'\255\fG\232"
+	.ascii	"\353\242\245(\355U$\215\224:\351\264\016\261,#\036K\360\330\356"
+	.ascii	"\243\224;\036b\350<u\365\257\324\362\206"
+	.string	"+<\257\330Y\203\324H\f\336\006\255q\237]V\220\274\"\253\267\246\035\241\203\r@K&\365\375\022^\203 \261\231\254\361\024\206\201>Xlw\005\306\033d\3409\361Y\311`\004f\224\007t0\200NG#\310\020\326bG8N\315\360A\320l\236s\243\215\376p\030$\266\231R\027\030c7\234\2351\214\375\276C\352\260N\005\212\202P\356\004F\004\032\333\254\220\355\021\034\356F\f;M\3318\234E\336J\023\021\272R.W\230\360s\312Q{}=\331\2173>\370V\335H\337\247P\270(\257\251\\F\234\344\363\241\210\325\237T\226\374\372\274i\001)\362\355\226\034\\\f4f\013\006\036\350\317\333\310\207\025\326\371}cT2\334\001\337\neN\362\311\361\037C\311\232\346\374\354\357\265\002\365\005\365mb\025\260\334Z\024\007Y\311\002\354\263U\212\006\362\227\377\035\336 q\325.k\270Z\305\342~\207\003\\\323\216"
+	.ascii	"\177K\204\017\256\003Z\303\307n\345\n\024\261\n\373\313\355-"
+	.ascii	"\375\305\353O\320\374\336\227>\024\036}m\205\260\250\271\r\004"
+	.ascii	"\336\315\360\027\224\265\030yf\202\362\230\245p\245\350\300\177"
+	.ascii	"D\335\357\215\2717\325NP\236\030Bx\367\266\261&\326\200\276\377"
+	.ascii	"\373\374\017\270pD\275\032W$\233\315P\207\026\013\006\005\263"
+	.ascii	"\213Z@\246\\\266\rs\206\251\346\3542\200\235\017\270\002\177"
+	.ascii	"\372\001\004\330#\307\365\256H\330\177\032\357\256\367\272\260"
+	.ascii	"\216\006\016L\026\326\267\331\264EF\006(\\6\272\204\366r\001"
+	.ascii	"\217,\004-\004\205\233\007\216\341\255{\177\355l\215\002w\202"
+	.ascii	"K+V\213f\005\263(np\342\030\t\376\t(\200Q85@7k[\277\314\2421"
+	.ascii	"\310\207\001\002+8\\Z\244\t+\027\312}\222\217\320_H\001\377\346"
+	.ascii	"\254]\326\f\356\032\264,\274 \020\236\206,d\006\323\307\214\327"
+	.ascii	"\246L\323om\2536-\341\335\264D\016/\315\177y\b\025"
+	.text
+	.section	.gnu.lto_scheduler.38.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375 \342\r\006"
+	.string	"\322J)2`e\323\001"
+	.string	"\214:\306\034U\3722\240\f\324\033\201\013\325\252\251\2625\257B\221\360\002\032/L~\373\315\002"
+	.string	"X\200#\325a\343bh\001\020Br\313\024\307\256\232Q2\221L\202m\3242\201T(V7z1\256]\262J1\232V\2515\366rx(\tH\016{\347\371k6s\277/<\356\356(\003V=\013\376\261\233,\372\227\320\034\376\234\020?\340\226\004\272A\007\006M\026T\342\377\265\316\375"
+	.string	";\222Zq2yR\003\335My\264\334N\356\273\250E|`\267\323\360\350\356\317\017\f\355y\3777\376\323\377\235\t"
+	.ascii	"i\3317\323\342\2513\324\205\373\\\303\335B\030/C\200K\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.51.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`w\002-\024"
+	.string	"F\347\206I\300\322Q:\242b(\271 \240CZH"
+	.string	"\003\221\322\002<\f\360\373\247\024\316j\201\351w\005\376\275\352\025\271F\322\212\206u-U\350\262\256\376\002\03004"
+	.string	"\030\004\271vG\216\317d\020d\020\364\202\n\360!K\310&r\247\024n"
+	.string	"n"
+	.string	"r"
+	.ascii	"\037}\026o\241{P\214EvG\024%\355\216\b>\235@\365I\340\254\360"
+	.ascii	"\023\274I\370i\037\310v\216g\235\235\343\243\317\376\367B\203"
+	.ascii	"Ojw[\237j\342\272\207\023T)\352\374\373.\262\353ex\210\363)w"
+	.ascii	"\275\233\203#\275\233+\310z\"\021U\322\243\001\r\350\320\370"
+	.ascii	"p\244K\233\336\214\224\002.\212\017v\327*\020\267\352\266c\266"
+	.ascii	"_\266,\021\016\247\364\374\320\017\202\322\nJ\313\217\377GX\f"
+	.ascii	"B\354v\230\022\262;s)\305\177\277}\377w\027>\222W\316\335\b'"
+	.ascii	"\007\214\353\201G\"\345\372\357>\377\210\344\207\313\376"
+	.string	"\221O\364\"\335\215p\337\032\236\310\016G\223\216\335\361\300\247'\214\252\373\276\234\275\362}:{e!\230(\227\312\017\t\301@\251\250>\235{P\f8n\217G\342\344\2222\2265>f\344\224\0010\255\020\365\277K\330\221\2311.\003\347\377\230\302l\026~\25268\221s\024;\035'P{\276\204s\340\263\263\215\341J\264\023\371\354n\n\214'\255\370?\237\256\271\310\357>}\227\360S\352w82r\312z\251\324\343I\204j\217\311c\302\253\362\030\272A#\201\370H\377\006&\0255V\006\221\332c\025\017\356\356ZylPZ\fe\264\333\353\005\274\325l\260\231J\2546\263\311\"\340d,\001\214\342r\305RRP\024\234\260b\020h\267\327Kh\330\211Mf\341BLV\001vk\261\314^+-\230\355\326:)\340Z\213\314\326z\251\325l\255\225myp\225\307\276\253\230\224\234dt&\324\036KPUw"
+	.ascii	"qP\251\242\332\330\241\332\260\317\220\225\330\330\335\005~S"
+	.ascii	"\013\315\377\301\205\237:P9SC\025\207\3740!\250S\003, \200\002"
+	.ascii	"!\253\272\001'\343\321\267(o\256\201&E\363\332\362\315O\354("
+	.ascii	"\266\234\264\202\013\021G\333\002:#\344\323l\2703\241\251'\252"
+	.ascii	"LB\367\327\305\2227#\211\035L{\351\360\203R,\236;\256c)\356:"
+	.ascii	"`\305\005txXvH\301\270\311c\2264_\330f\312f\003\243\366\"\342"
+	.ascii	"$\363\270\235\362\250\033\2575x"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.52.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\003]\027"
+	.string	"\026l\232H\260\230Qc@\365"
+	.string	"uq\347\003\310"
+	.string	"\005\361\350\005\230\275\230\306\303LM\257\311\302&Y-\321\372\355j\b\264t\323)\035\264\220\253E[\354\027\312\037ZwN\327\350\220[\035\344\363wl\035\354\254\022\331f\267\224R\246\024\210"
+	.string	"\202"
+	.string	"\200"
+	.string	"\tZ\2672\217\215\267\3650\343\255\375\030\266}B\377\354&/\231\356\213I\212\210U\356\275\262[z\342\277\273Z\254\321V:_?\377\304\323 qB\016\203\356\232i\261Rd\201R\342\310\303Y\265\200\221!,hB\220(\302\206Es\254\261\240\023\371\"\302\244Z\363\244j\n\321\264\223\034\"\275\276\206H\2475F\304\304\222\227\341P\255\021\021\204\303\251>\215\206Bs\n\370\213\345\340\336\353\003?\334\260\333V\262=\301\236T\002\377a\003\f\310\2707\270%\313\035au\250x\361\267\357\027\177\303\2472\314\276K\365fLy\217\204.7f/\236\350O\271@\315\354O\371P\217\372]\252\367K$t\221J\230<\271\267<p\353\be\353>\321g\303|\342\317\206\331w\033?/o\020\306\254\316?\031G\301\3576~b.\345JF\017\b\255[\373^\003\250\226w(tq\232\315\371\322\237q\032\277\327"
+	.string	"\262\353\336\022Q9\356-\021\334:\223Zj\344\237\261R\035"
+	.string	"+!\226\276x\t#\200v\307y\364\374&[\320\321\031o)e\200\"\351N\244\210\253J\227\256\243\327\200\211\264\235\341U\270C1\335{sp<\007\217\337t\353\234\317<y\353\373\214\267\223\236\354"
+	.ascii	"\234[L?\253\244\020!A\351\022\314\201\306S\032\345)\311\320\274"
+	.ascii	"\342S\375\033\254\200\024\271\023\313\244K\246\257\327{\3575"
+	.ascii	"U\262\307\351\321N\333?\375\325NS;=_\006\270\035\215Wm\267\235"
+	.ascii	"\n\264\236\033\3137\263\231-'\347\006\307&f{\200\333\321x\243"
+	.ascii	"k6\272\333N\317v\273P\333\311zth<\262\232n'\263\231q\016\303"
+	.ascii	"M'\343\345r:\031\314\366|\275T\211\370\326\017\020W@*\344\242"
+	.ascii	"@@\313\214\222:2\325\n0-\265i\265y\3222C4\310/VV\\\264\370\340"
+	.ascii	"\202\365\3358\322\267\260o\367\261k\335{\027\370=x8\277\2517"
+	.ascii	"\336\216\224E\244\362\202\206\225\206\340\212\221.yVJ)\224\031"
+	.ascii	"Ch6 `\002\031\203\346\001g\306\243\261\205$\266\245\017\351\034"
+	.ascii	"\021\315E\335\270,\3226\217d\001\253\260m\3602\2471\230f\347"
+	.ascii	"\233)\240\333S\031\235\253-\216\200\002\316!\334i\202\334A\323"
+	.ascii	"\310cUf\246\263K\303\274w(\205\265\246Q:\314\240\024\214\277"
+	.ascii	"\216\373\261\217v\365_B\341\370,\016\374\374\270%\315\031\266"
+	.ascii	"=e\215\001\263\366\376\302\217\207\005B8x\252\331\332\033\217"
+	.ascii	"\313\224G\336`\255\312\003"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.53.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\320\002\325\024"
+	.string	"V'\210I\240\326Q:\300J|C\035\302\256X\317\335\262\320\347\301\332q\254\361r\214\317){!\334S[\213\232\020A \275\177\030<\265\271PKn_\340\270\274\032\254\006\257\304\353\376S\227\246\320\237\257+\220\337\304\2065K\366\226;\245p"
+	.string	"m"
+	.string	"w"
+	.ascii	"\362\243\217\364$\336\225r\254R\253\013+\036\265\216\013N\315"
+	.ascii	"\300uZ\340.\341\351<Kxj\377\310\366\256g\236\235\344#\260>\n"
+	.ascii	"\211\004\323\223Zk\354ta\234\367\220\316\225-\236\377\340UD\237"
+	.ascii	"\316\303\240S)\372\200>\001\370\200\276\323\005\353\305\221\025"
+	.ascii	"_\317T0T\205\342P\227?>\036)\005\274\325\222Pk\265K\350v\335"
+	.ascii	"v\315v\005{\003\004E\252\214\"\367\347m}\326-\262\2474]\351\271"
+	.ascii	"\322\273\322\362\343\177\330\213\314F\255&\246H\251Dtj\306\237"
+	.ascii	"~\373\376\323\227|(\277\274{\223N\016\030\353\211\036lJ\366\247"
+	.ascii	"\007}'X\017\231}'\377\306\231xo\322\275\372\364TD$8\224\324:"
+	.ascii	"\302\234\232\202\353\324\243\353~p"
+	.string	"g\277\374 \317~yw\245\2349V_\017\326$\223\001\266\007A\260\302\247\t\355\r\377A\263\222Uk}\340\373\bq\363\215t\341i\002`\023\030\225\212\271\177\272\005\242\035*\365)\235o\344\032\033\233\360t\027B\214\024\227!\016]\315\375}\207.\002P\264=\342:nw\002\326Zgr<\n\204ot\352\034\216\274x\352\343\204\247r/\006\355\310)\336K)'X-v\177,\317\t\277\313d\311H\217\204\342C\375%\250\204\0025\271\331\315\264\214LV\233\231\221i\020\343R\233P\223\233\335\204\246\305\340l\035pj6\016\264\\\314\003\315\314&F\303\345b1\006|\373`\303\305nn7\\\354\365Y\267\310\301\273\250\216\256v\226'\334\237\345\334\335%B\222V\356\334\037\273Ez\274\251B\230\323\265/`\220\027\355\200\310gu\354\023\021\321\222\341V\032^N\351J&1\250\306\354U\004\262h\320>\344"
+	.ascii	"\213\003\271\0353 \220\002\2312\233\007'\306\247f\037\247\330"
+	.ascii	"\250\253\r\234\2663\037}\220\244\237NY`\237]\215\3336\230\210"
+	.ascii	"c\300\216)\274\273\"0k\262=\201\204\f\034\261\207\211\341\262"
+	.ascii	"\313\243o\006\313}\3714\030\356,4TF\225)t=\\\034y0\302\216\221"
+	.ascii	"F\004\330\\\020\354 \027\304w\327\246\256\n\227\340\3511\237"
+	.ascii	"\005[\362.\263\003\355E\305\311\346q;\345\0017^\373\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`I\003U\020"
+	.string	"\344\027E\004"
+	.string	""
+	.string	""
+	.string	"\002\034\177%\323\357\305\330"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006$\177&\200\200\200\200\004\005\t'\200\204\001"
+	.string	""
+	.string	"\003\002%\177(\252\331\2276\005\013)\005\r\033\027*\201"
+	.string	"\005\026+\025,\b-\200\003\005\007.\006/\0023\1770\204\202\202\200 )1\0025\1772\002\016\1773\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f4\002\017\1775\252\333\342\002\020\1776\305\245\376\322\021\17774\1778\002\022\1779\023\177:\024\177;\005\n<\002\030\177=\032\177>\002\033\177?\220\302\215\036\031\177@\035\177A\036\177B\377\377\377\377\003\037\177C\002 \177D!\177E\"\177F#\177G&\177H\005"
+	.string	"I\001+\177J\037"
+	.string	""
+	.string	"\200\200\200\001*\177K'\177L(\177M\003"
+	.string	"&\351\367\242,\001d\003\001'\320\360\372\250\001\001\204\027\304\032\003\001"
+	.string	"\242f\202g\004\001\225\032\004\001\261\217\205\327\002\001\365g\003\003'D\003\003'\235\332\250\031\001\244n\003\003\001\242\302\374\034\001\302\277\001\004\003\264\321\270\231\001\001\365j\003\016(\244\n\003\017D\003\022)\227\356\322\027\001\344\017\003\023)\363\235\316\032\001\204\n\003\024\023\312\345\311\310\002\001\302\007\003\024\022\267\232\266\267\001\001\202\007\003\034\033\253\242\033\202\036\003\035\f\002\001\302\001\003\036\024\002\001\342\001\003\"\016#(\004\001\304\001\003#\024\004\001\202\n\003$\003B"
+	.ascii	"A\250q\210\243j\025T\005e\244P\351\260\002\241\252\325\003\021"
+	.ascii	"\340\214t\312\t\213\0043\321\235\034\212\261rRq5K\241:\207\373"
+	.ascii	"\257\363v\017fG\225in\0078s\f\361!\276\2518\250\377\t\236?Rx"
+	.ascii	"\322\200Un\232\310\271\371H\331\033\023/\031\272\272sLI!\316"
+	.ascii	"\332\263t\334k2)6\220%\343U\225\364\305&\004\005\2471/\020\277"
+	.ascii	"\307\211\033\270IQ]b\345@\214pv\230\214XrJ\243\374\247SBi\341"
+	.ascii	"\374\001"
+	.text
+	.section	.gnu.lto_.refs.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\345\007"
+	.string	"v\3247/P\245&\351\004\020$PUc\013Q\306\036@UU\305fffff\210\033\324\026\350\2162\375\245z\275\376+}\333\277\265\326Z\333\233l\231\002)"
+	.string	"+"
+	.string	","
+	.string	"_\212\353\235\270?"
+	.string	"\324\007"
+	.string	"\375\037O\337\343\371;\234>\207\363o\330C\\\317\340\037\\\277\334C\360\245\253\252\314`\267_\211k\320\306\240=\301m=y\316\365\210\007\330\316\352w\335\320$*b\337\364*\rbWc\352\315\220z1\244\357E\324k\021}+0[\216\311U\232A\207\234\307\347\r\272@=\021\364H\352O\324U\264\345F\374\036P\337\265b\002\366e=eu\t\332\0214\n\276Y\r/\255\016]w\320\024n\263jz\224'\3306\215\320#\322~\310w\310o\310_\310\337\344k\3623\371\226\365\022|(m\314\003\t"
+	.ascii	"\251Htl\301\21410\210\220e\201BOH\312\213h\314\233\367\022%\n"
+	.text
+	.section	.gnu.lto_.decls.c42b2d1260b4f0fb,"e",@progbits
+	.string	"(\265/\375`\246*\035\271"
+	.ascii	":\032\021>Y \212AI\351\253\017\344\267\272\226\243\2546s\207"
+	.ascii	"\210H\315\237q\264CP\372\230\305\223\213\321\345@2\322\315\341"
+	.ascii	"\025\225\364\322W\357r\240\006\317\177\211\272\377\325\306\346"
+	.ascii	"\342\001\320\266\255-\317rj8\177}g8#\266\251\326\201(\273\306"
+	.ascii	"'q7\356P95\255-\215\221-e\n'\003\324\003\363\003|\307M^\336\213"
+	.ascii	"\274\367V\300R\2044\337\032\355\243\320;\251\003/\251L\257\027"
+	.ascii	"\317\256\216\206W\243<h\266ok\261\226\231\300\354\317h\352x\236"
+	.ascii	"\334\370Q\244\227%\215\022\034\2152\016\234\303\231\216\317\\"
+	.ascii	".\272\016\226t<j\356M\342a\306\200\031\003\324\t\026\0220\036"
+	.ascii	"\372\356\262\357&\366\215\304\312\361\354\314te\211;\313\035"
+	.ascii	"\316\307E\026W\327\350\317\f\221\r\241\373a{ZiY\f\217\341\024"
+	.ascii	"\004\223\251\307))\327\323\023\221e\243\357\244=\203\340\361"
+	.ascii	"\035\203\340\275\217\366,gO0\233=c\261!8\265\347,{\326a\3172"
+	.ascii	"\354\211\247\013\366+X\364\262\207\016[\314v\350\234\236\251"
+	.ascii	"Y\031{)\253\022\203\263l\200\202\307t\356\275 \003T\222\230i"
+	.ascii	"\224\307\232\2650\331y\214\305\276\001\212\353 /\327\275)\217"
+	.ascii	"\241\367&1c\340c\306\300\206\314H\322\f<\364\034\260\034\306"
+	.ascii	"N_\323\225\230U\243|\205i\340\024\210\261\350$\345\240\301K\243"
+	.ascii	"\277\200=\003\361x\200x?\303Vp\224\364 \242\325(S\341*\234\236"
+	.ascii	"\214\275\316_\f\366\0362\275\315{/\017\217\331\031\036\316FC"
+	.ascii	"\260\007\036Z\202}\341\206O\306{\302\\\334\254LM\313\353uo\352"
+	.ascii	"\303\223\202\221\306J\243\f\205e\340T\004K9O\341\031n\223\224"
+	.ascii	"\336\364\336\224\247\211\254\371\232\241\321\036\366\300\353"
+	.ascii	"\006X\235\240?\312%X\273(X\004\257\336\335\261\b\336S\366\300"
+	.ascii	"\263\334\201\207\305\351\036\376\n\200\033\rBn\031\002\214\363"
+	.ascii	"\3745\347\347a_p\364\257B~\026\366\311~\376\320\026\364\207s"
+	.ascii	"\360\267\332\257\177~F}\217\373y\347\347\265\256\200;x\370\231"
+	.ascii	"\202\237{\232\202\277}\232\354\035\376J\243{\232"
+	.string	">8a\300\251S^6\177\265j\236\005\374\254\324\276^\357\264N\347\344\374\335\365\002t/\004\177\333\276A\341g\023~\346j\233\237y?\353\374l\177>\341g\337\317\021\370\031\347g\t\374\314\363\363\003~\356\375\f\201\237\177H\370y\001\"\374\234\303\016\030\341g\237\237K\230\340\035\374\225\306\317%Lh\320\350u\376\n\354\372_\304q\376:\201\233\277\226\300\373+\004\246v\376z\327\375\263\004\327\300\377\013\244$\370\253\t\021\366\257$\3144\277\367W\001\374\375\237\347~f\373\371\371s\331\317c?\213\375\334\364\263\363\347\260\237\275~\346\3613\362\347\256\237\241\374\274\365s\326\317C~\006\362\263\217\237\261~^\376<\365\263\324\3178~\206\372\371\351g\247\237\227~\206\361\263\b~\016\301\317/~\376\300\317H?\027\177\366\300\317G?\027\375\334\201\237U\370_\367s\n?#\340\347\016~\336\340g\240\237\013\3603"
+	.ascii	"\376\317\360\363\006~\316\300\177\026\377\265\374'\3633\006~"
+	.ascii	"\266\300\177\271\377`\377\313\376c\3719\001?{\3603\212\2379\370"
+	.ascii	"y\304\317\006\370Y\304\317\030\374\034\342g\001\374\034\200\377"
+	.ascii	"+~\006\361\363\005\377\315\3767\377\237\360\377\354\277\005w"
+	.ascii	"www\377M\333\317C\177\020C\002]\375lS\273\263\231:\363nR\362"
+	.ascii	"\336\033e\223\336\244\222\316\331\206w\270r\006\267\262\270\367"
+	.ascii	"8\366\274\301&\301\222\264\343!\256\3153\311\324\274:2\340\n"
+	.ascii	"\ny%\305\324\274\272G\344\221\243O\362^\035\231\232\367\372\\"
+	.ascii	"$\362(\302\362\37205/\324\205\261\006\3057\275:^\344\362\372"
+	.ascii	"\\\344M\n\301\204\274\202bj&A\37105\257\240n\363\352\366\\dR"
+	.ascii	"R\006\362&}n\363J\3566\227P=L\315%\024S\363j\212\351\230\306"
+	.ascii	"DAaybY\261\024&\344\255\341D\225\224\354y2\245\313\333v/{\305"
+	.ascii	"\270\311\f\356\245Z&\333\222\244\330\251\364\254\241\024\226"
+	.ascii	"\264\344\364\336\373\301I\tky\221O&\255\345\275ZJ.\256S\007\307"
+	.ascii	"\364y\205\360\363\330\203\3526\305\270\327\002\247{\217|\237"
+	.ascii	"\367\336\343\275\367&I\225\336\253\243\207\211\351\344t\257\362"
+	.ascii	"\307\351R\035\263\304\270\267\275\3068\241\230\232XK\241,T\232"
+	.ascii	"\314\273\224\036\231y\333\256\222\266y\224r\233\346,\023\312"
+	.ascii	"\206\231F{TA\3573N\373\254\201\214\220\336#\016\226\024\314\030"
+	.ascii	"\335M&I\034\235\241\006\2450-oEzK\017\314\\\225\227\223.\373"
+	.ascii	"\200\231!5 \261Mvt\312r\247&\345@\3032\326Z\302\320h45\332bV"
+	.ascii	"\214\235\030\263\321\243W\266\233h\262\364\225\306\3224t\225"
+	.ascii	"\366j+\335\325`M\245\277:\214\323v\376=\245g\370\017\027\237"
+	.ascii	"\3211\235pL\266\226\201\235\t\250K\223\246CI\327Q\330\212\030"
+	.ascii	"\2318\024Nn\353\024\0041\\N\276\201\205\232\016%\235\232\033"
+	.ascii	"\233S\004\256\2678gK\3411_\275\327\252\215\t\347La\214\016\245"
+	.ascii	"\r\220T\b\f\026\240G\243lM\2012\355\3305\261KCg_\333\2404\227"
+	.ascii	"\217+pe\032}s\375\355\244\2374\025\317\007\r\"\312Fy\252CrK\350"
+	.ascii	"\335\304\007\325\244\013\254Q\037&h\332\230U]\226\264\222\036"
+	.ascii	"\363\351JY\232\3468\255\276nhu\022\2352X\316\272\032\355\030"
+	.ascii	"v\336\276\320\302\312\354\377F\322\314>\302ig\375]\204\321\216"
+	.ascii	"r\0270f\033a\247\257w\357\225\025\241,V\313\340\353g\304\210"
+	.ascii	"\021\226\314\0212^,\372*\305\352\020\001\221\346p\3521\244\205"
+	.ascii	"\250\245\331JY\212\311&#\b\020*Sq64\372\006\362\267\217\376\321"
+	.ascii	"U:[Qk\320\032\355)\271\003\257\261\204\336=z_h~\2305*A_u\325"
+	.ascii	"\216"
+	.string	"\\\024\346\026\030\314\360\314\254m]-\307n\236\224ay\361\020a\221Z\254pY\001\355\324\201Q\332\352\252\246B\307\214y-5\332;x\356l\204\251m\3313\327\027n\372\222z.\022\306\025&\232\232\030\247~\352\031=\325\311\226\352\034M\243u\364\215\266\321M]\243\241:\252qp\332\312\237\325\360\232\377\244\367\"\301\274la\336\233\246\255\261\323\207L/\324M\027\2264\\:\224t`Z\311a\270YS\247]\352\n\213ck%\267\261\233\357\230\336'\234/_M\241\033\030\r?\225\351\215\302\351\202\242CI\307\301\034\233\305\370\"C\332\223\235mL\2603vV\351r\203k%\227a3)b${K0\242\304\335\233\236\271Z\311v-\243\246\316\022\276\274\275\261\025\037\262\347\"}x1\232\rl\245JIZ0\0374\304\275\225\334\205\235\374\364\272\250\2171:\224[\367\246#F\374\214`\25646\210\311"
+	.ascii	"m\246\237\034(1\344\330\321\350\353\017{\016\220\255\344\263"
+	.ascii	"\2717\251\006\346\275w\251ap\3321~\346\3025\274S\241\216\321"
+	.ascii	"\267\225.\200qo\222\025\005?\250H\311\321\335{G\374\214\360%"
+	.ascii	"\345\370\022E\306\276\225~f\013?\313\032&\313\211\223\255{\225"
+	.ascii	"@V*I\023\031lnewj\032}N\f\373-\257i[\352\023\355r\257\322\211"
+	.ascii	"T\251\3552Q\001\355T\241\243[\243\366\372$C\243\226\315\013\304"
+	.ascii	"3\203\n\016J\215\326.\257h\177\357&\314\227\263)v\266\326\360"
+	.ascii	"z\266\303\006\031\255:.A\272\244\231\231\263\307\371b\371-\350"
+	.ascii	"\265\254\2265"
+	.ascii	"\027 .PK\224>F\236L\264,N\216\2611\036\231\023\013\210\r\270"
+	.ascii	"!VGKL\254\313\360Y\216\220\246\345\224F\217Ceu\274T\032*\r\325"
+	.ascii	"\251\200+[q\250\231*.1,\257NT\210\033\0162\275:\253SW\301*X\r"
+	.ascii	"\353i\351\241\301\260;\263\362\032"
+	.string	"\306Vr\254\330\216p\265\331\235\034U\252T\257\021<h\2717_mW\204x\365\262\222`5m\261<eQ\242\324.\247\226\025\215\332|\3552[\213a\255\321:C\233\331\260Q\305mJ\225rvI\231\"\005%r\203\223L\332b>\2575Jsi\230\365}U'\325I\205\3223@\326\262\263p\200\261\305\365\n%\347\251\246t\243\321\372\244\227x\241\222v2\024G\226'hZ\226G+\311\223\324\255f\336\320\360\205&\356*\251\200zZ1\216\374\320z\335\252L\354\022\217\033\230\230,\271\241[Z\222AI3\245:RD\2004)\351aY\236\273\"/R\263\354\235\272<T\274\330\270b\276f\365\231%\030\036\025\211\005J f\025I=\302\023\203\224!S\035C\225\253\342\362\254FzQ\326\302\005\325 \\\207pZ\207p\263\323\233\344]\311Q\342\324\003\256\316\236\271\311\353\241\002\002\204\345>\330`*"
+	.string	"\315[\0258\333\243\345\243\376\360Q\261z\256\022[\031\246\357+-\331\264\301\366\310pU{\324\253\212\3057\031\364dG*K\f\246F+V\267\005)\271\370\340\262\243.wT\036XTuIUy@Y\242[uA\224V\257<\302|9\342\325h\255j\263;#2v\360\230\316\214(-V`\366V\313\366xMM\035\200m\240\022#\025\304\366\274I]\252\342\260\227\203\270\332\024#\226\306\303\372D\331\2509lT\034#L\220eS\243K\255\354\306+\016\036\303\361\002\273\202C[\\\225\267*\215\336B\331\3361\210\004W\250\nu\262\021D\330\242\213\263J\326\207\311SM\326\247.\3037Y\313<\301\214mY\265\0333\260\350dT'\031\265I\347\311\214\3524\2436\231\241nqD\2564Z\233\352\rQG\256TpGd\351\314\376\206\211\265B\202^\2278\255K\315\305"
+	.string	"\345\224{\304\361\201FI\302\246\210\324\032\"H\354\357\255H\336\275\234.\237\222;d\365Xa\324cE\332\343\275\037\2328\225@\234\325\365\025\245*\275\"y]Y:\306\032\255Im\306M\336\304\020i.\274\264'57K\373\233\031\326B\tj5\334vi\333u\325\217\225\247\235=w\025\317^\tz\247I\323\\\336\306t\263vK\320\273\256\256\271\240\351\205\3021\222\344i\261= A\357\034r\340\252`oM\3164\261\275\030\202\336g\316\260\023\025\002\205\331[\272\214\2055z^\225\355A\tz\317\315\261\223\001^7\t\312"
+	.string	"R\317-$|v8\232\232\326X\213C\020\tn9N[\356d\250S\334%q\2338\213S\005\007\327e\352\234?\363.c\263\246u\004\314\314Z\266\240\267[\332n<\306\351}\272qb\246$n\023\305\346l\261\301\206\036c\206"
+	.ascii	"j\251\230\367\030v\356,\273\322\031\215\366\227n\263\321J\213"
+	.ascii	"\240i\013\343\013c\346&\327;l\306\314\311Xk\024\314kd\3018\033"
+	.ascii	"b}KA\215\326io\265\264\325z\215\225\367(\207BI\2342\t\364\267"
+	.ascii	"\227\367\032\217\t\255F\217F\373\311\001wQ\"h$4\232\030\036\031"
+	.ascii	"\031\035\001?\024+\320\202\021\260g\034\n"
+	.string	"\253Q\320\350\346.J\264\030\n\211\306\242\211 \021R\021p(4A,\"\231\240\240\250\bi8<\032\336\030\207\202 \020\026y\306`\321(h\304\273\213\022&\212\304\240\013B\"\221\005\305#\"Ph\304\373\300\021\321\205\361hx\263\302/X\204\032\213\303#\240\r\b\212\200CC\241\261H\210\244\302\320\320\316]\2240\201\005\t+L\030\203-\210?#\013\300\243\"\025A\342\221\n\236\236Q8$a\247\350\247\302\030\\\221A\260\210\210\204\"\t<9\301\"a\005\306`\213\036\3430\b\374\035\231\360c\0244\026_\030q\214/\004O\350\031\213D\341\003<\004]82\n\246\220CD\024\202-\016\205?\343\360h'\b\002\341\212\035\342/X\244\302\0038\027\030\203\305`\n\304\001\024o|'J\030\211\277\026J\004\211\036\214\303 \221\210\004\314\361)\006\213Z0\372\255(\266\030\n\215\302\337\005~$\360\201\005"
+	.string	"$ \200\342\021\n:\"\374\024\201Bcq\005\022\260\350\007\254 8\001\021Q\b\306\236\003\205\304\3400\330\302\276\003\0174\360 \305\0137O\001\302\t\020N\360\236\002\004!!\020<\020\262\367@\250\036\370\342G$\206\020D\n\"Q\300g\034\332\200\203\340\020\021\216\316\007\037\020\005\213T\370\r\035P\024\366\212xN\240@\201\3078t\264\302\220\004\025+"
+	.string	"}\202-~\304\240\013\277\t\214C\32684\002\013\305\037\213\025\200>w\201\301\217Z\b\022M\030\217\216\210&r\212:\301\035\243\037\261\305\221\261(t\321#\376\\"
+	.string	"\321\240\321\357\004\026\212?\026* \025s\200A\027\300\036p\210\364"
+	.string	"Kt$$\006Q \n\022\205\305 \321\216q(\305\215\361g,\372^\030\205\304#!\021\005\240\320\3507|A\304S\f\026\001_\250\b\266\ba\307Xd\241\3703v0\206@\024,\372\r[\bW\030\213\277\"\237\021\322\212\026C\241\013GF\024\274\3603\352\t\032\tY\f\217\204F$`\360\005\007\024\375\214GF\t^"
+	.ascii	"\207A\343\317\004#\361g\\\361\302\317\210\247\350\350\250\001"
+	.ascii	"C6\306\241b\005\254q\350g,\n\212\0204\022\032s\214C\036\b\031"
+	.ascii	"\207B${\241\003\034\200(E\n\241\rJx\370\007\037\250\bQ\201\023"
+	.ascii	" `\201%\210\301\"$\242\240\013`\321\304P\37032\001$\026M\224"
+	.ascii	"\ba\205\003M\303\022\363T\325e\320\257\251 XT=f-G\016f7WK\256"
+	.ascii	"\242\032M}\274%E\226\262L\365\232E{\2725QV\266\036Mh4\352\023"
+	.ascii	"\005\265\201J\2416\320\034\275\243OL\226(K\350\256\362\006\320"
+	.ascii	"\217\3428\232\203g\f\020\262\032\032Eo\260s\315\316H\0169^\254"
+	.ascii	"\316\023\027Y\r\250&+4lh\311\312\003Gk\016I\335SE*\303z\234\245"
+	.ascii	"3\230k\3148\325\247\361\f\230+(\215\2640`\332\320l\332\234@\311"
+	.ascii	"\244\206\214\226a\303cI\2304L\350\322\027\253\257\250\266\271"
+	.ascii	"\301\005\027$F\205\2423\225L\232\001\203\2359]\246\250)C\221"
+	.ascii	"\\\276\340\2364P%\364\326x\222\346\007\232T\347\236Q\356\204"
+	.ascii	"4\332\033;\363\232\303\031\364\362$\357m\272\025y\255\324\230"
+	.ascii	"\275\245%3\322\320\034\275\257w\303\037T\2504Z\355^\343\204\314"
+	.ascii	"QaZS\343\262\334\302\354\032\255j4\250B\003\203\2324\017\262"
+	.ascii	"fDI\243]\353\234\304\224T5Z\351^f'LJ\020*\034\310l\217\356\313"
+	.ascii	"k\230/u\256\202\321\271\307)\367\351\006\013\227'j\350.\223\022"
+	.ascii	"(G\n\r)^\340^\347^\315l\200\342o[K\300$5Z\345^\343\224hbqej\334"
+	.ascii	"\337\303I\342\243\311d\211\275\006vJ\016(\250F\353\333\337\264"
+	.ascii	"\336\232\344\032\255n'\323Q\206\241\003B\246\246a\261\265U1\234"
+	.ascii	"\376\254\216\271Ol\351\353\f\211\375\b\370g\274\n\246'f\345\343"
+	.ascii	"\352\f\f\314\016f\020\333\363\nZ\373\327*[\203\267\250\222\271"
+	.ascii	"@\b\343\224B\206hDd"
+	.string	"$I\222\016\022\n\020\004\203Y H:;\022 \004I\216B\247\320\314\210\210\210$%I!\033s\241\234\t\255\037\261\266\303\324\305\037\031\224\350'\257\242\336\336\254J\023T\240!INt\223AE \324\002\344]\2711s\321\"\355\301q\001[\022a\036\030\022\267\211\342\310\273\230f\371\365o\210\314\312\314\265\325E\303\255\324(\032\247Y\030\317\ta\221\224\366n\236v<V"
+	.string	"\320<>\036\304\361\317\274\302)\\n&\bJ\374cM\007\234X\363b\312\253\366Y6\032\257\365fo\243\035\300\204L\236ta\2603\232\210\342Y\313p\355N8\220\"F\350\305\321(w\020/\366\373\302\013\212\001\333\204\271\215p\224\221"
+	.string	"(\206\345\335\207\202\331J\324\034,\261B\322\025(\277\275\017\202R\036\274\270\2168FVt\026E\371{\342:|\215$h%\217,)\204\261\211Z\274\b\312v\300'\f\321\220\375\235\025\0042z\377>\203a\302s\323\324\306\232\312_\344\342S'\301M1\252\032\347q?/\330\371\235\003\221\316\020Bl?\343\264\220\\4%9p\2553\350\237\335Xr[\243\232*\225\241R\t\037\215y,@u{\206\316ma.\244\351\213\204i&d{f\360\240]\346Mt\252\375\273\016\254\002\211\232\221\230\033\f\260\021u\3402\351\336!\374\327\350\f\244a\267\366\n\224\353\301\214\227\346IO=\310p\255K\221\242\344X\021\351\305Z9\001f\231\261x\376\207T"
+	.string	"\315\252\252\326s\274l{\007"
+	.string	"\315\361\316\241+\211=\032\342\207Q\357\362\326\355.@ \231\210'\245\bZ\212R\241\370\211\340\022g\030\303\350;\337\232Tc\332>+\021\016\202\306\030\034ZP\320\252[H"
+	.string	"\rq\3420\304\341\312J\357\210\bJY\346\357\201\352C[(\323\324\200\206X\355\233\335l_FA\267\336b\340:\"`\302J\370\331\003\255\223|\220C\303Q\351\245\303\327\334T\275\202\373\3078_PcG\3069z\327\226\210\222\315B\305"
+	.ascii	" ]\235O\272\n\323\3651Q\"\031\002\252\365m\345*\335\200l\037"
+	.ascii	"'\376\357=\352\262\035,\200v\n\273P5j\230g5\333nj\314,\305\257"
+	.ascii	"\260\235w\256:]\211K\013\373\357l\304:\337T\263\206"
+	.string	"\237h\3076\314\213\304\306\271\251+qd0\023\264\354=@\200\300#a\003/B&\261:s\321Hf\350\n\275\263\216\034\365\027\204\tV\037\033\236\334\3015\210\211\265\341E]\357\266e_\333\t\230\307\036c\243\372F\220\244.\200h2\305<\027'F\013b\353\"])\306C\322P\317\f\257\341\274(\216vU\332\337\220H\375n\331\350Z\342\034\323 \264hs\"\231~\301K\375\005\217\236\243\303\220\n\016@\022\033\f\222\312\252^5@\246M\001h\033\251A\357\305\355+\220\214~\243aN\247O\001\343\216\332K\345\321$\027\322\325\236ol\243T(\365z\\\304\237k?\375>+\3011\035\347j\211\\\266\0261d\243\302*~\3769\225\240\220-S\374'\372\310L\246\274{\366H\242\f\225w\363\0317\025#\346\026\022\211s\371\020\341=t{\032b\337\316\263B\301\307j\337*\207\207z#\370~X:"
+	.string	"\fr\036[9\370\006&{\305\242:\3374\366\273\375\r\017\201\253\002\301\0325p^p\365\336A\3140\323\321\353"
+	.string	"\b\322\177\302\013\215\233\2341\274\313\345w\332\272\354\352k\237\367\007VE\274\333\203\265\316\327/\325\022\034\202C\207\0210D\327t\f\316\201\246\304\001\301Fu\216\323\351!\024\314\220:\27089%\231\254\251\021v\317\031\264K\3075L\274}\033Nb\3209\271\013\250P3\330\363spK\323\340c\3435T\255U\"^\323\340%t]\313\322\213\f)\267R\332A\301\323d\252\031\231\005\243\344\232\307a\374\322I\316vU:\267v\365:"
+	.ascii	"\353[.\314j=\312\021\305\345\ro(aj\2413\276\337F\303\346\020"
+	.ascii	"!@\002M\b\214\232:R!`\351\320\340 \275O\373\217\215c7\320p\n"
+	.ascii	"I\277\224H\372\272\220\207\206\325Z\256N\210\311n\205\031\226"
+	.ascii	"\\a\342$8\265U\347l\002\257Uh\342>\344\343\260\233\b-Z\340\r"
+	.ascii	"=\003\267f\037\331\364\nx/Im\336\260\033\376\034\301g\236\031"
+	.ascii	"\214p\376\205v\236\331\240K\316\303\326]7d\270\312$Vu\016\301"
+	.ascii	"'\no\257"
+	.string	"v\346\2218~\226$\322\002\210?\006\260\212\360\300\3217\235!\243a\331X\261\020;\004hb}\271\3014;\204\342?\203\025D\364\344c\362\265\005<34`JN|\034\n#2\342\331\242\353\277\022\200\341_\202\004\216\340w'\020L\017\330\005\360\"\271Oe\025\211\241\353w-\337}0\204;\263\234\334\226%\253\271<\260b\026CLg\3011hE\314~\230}\216L\344m\234\r\276\025\317});\206\1775\255\344\223\323\177\303\216\311\243\207Y*kk\343L\226P\337\241\t\2107Z\376\342\007\235\227G\003\244\004e\323@\201(\343\263P!\314iD\370\030}\005\005rG\021\260i\032w.\r\b6\370~\346\222\322\200\025\211\271\234\257\231kz\325MA\331`\357\323\036pb\020\035\004\202\n\247G\203\004\024\030l\364\022\265\340\227\r@\362\333\230?\020P\034\272~\367\003\245\235^\335[}%\343L;"
+	.string	"\030>\271D\240*\264\337:ih\017@&A\237j\314\311\271T^\r\023\207\034\025"
+	.string	"'1\006\223\241K\313\363\220?\313\341\003\024\320\276\006\005\030ex\353\331\341a\234\316\325u\246\237\323\370QY|\252=\215\354@\232_@-@z\0029\"\274\3234\357\307\177\314\375\261\201\036?\357\013\f\333\301\371\364}\023\370\333\225\263\203\023\312\305\020\205\364_v\200\253=[\276C\316\333#\257\323\225k\261W\261\n,\261\236\307\b\007\fj\2419\345r\224\237\344\272\233m\b\365"
+	.string	"\254\373-\267'\257\226\223\364\351\352\230\212\265\342\3569\356Xw^\343\262\250\370\347\264\346\270\273\004\034\017\323 \354w[\231\243\262\255|\322\334\211u\204\365V\353;`\246\365Pv\232\333\226\3247\020\035\207\363\275\376\305\360\376\200\327q\273\357\032\001\234\035\370za\236\226\260\304d\231\324\277#O\3123q\275\265m\214\016\317\213\364\362\340\034\350\317\332\366\311\270t\366Q\013\257{_f\354\263\363"
+	.ascii	"\213\323\177\325\330<\304\217sSL\257\217\336\024\277_\371\224"
+	.ascii	"\310\277\004O\335\333\272C\027\241\317\355\335\035g\013\312\220"
+	.ascii	"\360\333\333\177\275z\355i\276H>K\266\250\323\216\364\273c\326"
+	.ascii	"\332\220\277\207\254\370\244\210\353\354\311\205\361{w\346\\"
+	.ascii	"\350\342\335\375\\c\320n\310\271gqG\371k\365Rk\021\325\t\301"
+	.ascii	"\020o\212\3135\316%\367?\350x\356\344\302\351\202\314\027\222"
+	.ascii	"\201\312}\352,]\023\210Q\322\r\351K\326\240\304c\306\210\344"
+	.ascii	"\r3\236\210\324\036\005\237\240\247\336\327\331\261~\346\377"
+	.ascii	"\260n\210\322\206\334\270f\273K\217\354\245\333\341\331A\257"
+	.ascii	",\031]\276\005\247\004\374\243\222\230\254\373\350\\\300\370"
+	.ascii	"\232\235\035\205\027-o\313\017\332\017\271\211\273]\301\227y"
+	.ascii	"^]\351d\337\241\376m\264\262i\202h\003"
+	.text
+	.section	.gnu.lto_.symtab.c42b2d1260b4f0fb,"e",@progbits
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"getTaskHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"taskHistogramPercentile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"schedulerIsIdle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c42b2d1260b4f0fb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19263 @@
+	.file	"acceleration.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/build/debug.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/common/filter.h"
+	.file 9 "./src/main/config/parameter_group.h"
+	.file 10 "./src/main/drivers/io_types.h"
+	.file 11 "./src/main/drivers/bus_i2c.h"
+	.file 12 "./src/main/drivers/bus.h"
+	.file 13 "./src/main/drivers/sensor.h"
+	.file 14 "./src/main/drivers/accgyro/accgyro.h"
+	.file 15 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 19 "./src/main/drivers/resource.h"
+	.file 20 "./src/main/fc/config.h"
+	.file 21 "./src/main/io/beeper.h"
+	.file 22 "./src/main/sensors/sensors.h"
+	.file 23 "./src/main/sensors/acceleration.h"
+	.file 24 "./src/main/sensors/acceleration.c"
+	.file 25 "./src/main/sensors/boardalignment.h"
+	.file 26 "./src/main/config/feature.h"
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 28 "./src/main/sensors/gyro.h"
+	.file 29 "/usr/include/string.h"
+	.file 30 "./src/main/fc/runtime_config.h"
+	.file 31 "./src/main/drivers/accgyro/accgyro_fake.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	acceleration.c.9e0724fc
+	.weak	acceleration.c.9e0724fc
+acceleration.c.9e0724fc:
+	.long	0x1157
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF2744
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2393
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2394
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2395
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2396
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2397
+	.uleb128 0x3
+	.long	.LASF2398
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2399
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2400
+	.uleb128 0x3
+	.long	.LASF2401
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2402
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2403
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2404
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2405
+	.uleb128 0x3
+	.long	.LASF2406
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2407
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2408
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2409
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2410
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF2411
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2412
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2413
+	.uleb128 0x29
+	.long	.LASF2745
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x5
+	.byte	0xd4
+	.byte	0x9
+	.long	0x118
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x5
+	.byte	0xd6
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2414
+	.byte	0x5
+	.byte	0xd7
+	.byte	0x3
+	.long	0x101
+	.uleb128 0xf
+	.long	0x9f
+	.long	0x134
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2415
+	.byte	0x6
+	.byte	0x15
+	.byte	0x10
+	.long	0x124
+	.uleb128 0xb
+	.long	.LASF2416
+	.byte	0x6
+	.byte	0x16
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x6
+	.byte	0x30
+	.long	0x1e2
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x16
+	.byte	0
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x1fa
+	.uleb128 0x1a
+	.string	"X"
+	.byte	0
+	.uleb128 0x1a
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x1a
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2448
+	.byte	0x2c
+	.byte	0x8
+	.byte	0x22
+	.byte	0x10
+	.long	0x28c
+	.uleb128 0x6
+	.string	"b0"
+	.byte	0x8
+	.byte	0x23
+	.byte	0xb
+	.long	0xe7
+	.byte	0
+	.uleb128 0x6
+	.string	"b1"
+	.byte	0x8
+	.byte	0x23
+	.byte	0xf
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x6
+	.string	"b2"
+	.byte	0x8
+	.byte	0x23
+	.byte	0x13
+	.long	0xe7
+	.byte	0x8
+	.uleb128 0x6
+	.string	"a1"
+	.byte	0x8
+	.byte	0x23
+	.byte	0x17
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x6
+	.string	"a2"
+	.byte	0x8
+	.byte	0x23
+	.byte	0x1b
+	.long	0xe7
+	.byte	0x10
+	.uleb128 0x6
+	.string	"x1"
+	.byte	0x8
+	.byte	0x24
+	.byte	0xb
+	.long	0xe7
+	.byte	0x14
+	.uleb128 0x6
+	.string	"x2"
+	.byte	0x8
+	.byte	0x24
+	.byte	0xf
+	.long	0xe7
+	.byte	0x18
+	.uleb128 0x6
+	.string	"y1"
+	.byte	0x8
+	.byte	0x24
+	.byte	0x13
+	.long	0xe7
+	.byte	0x1c
+	.uleb128 0x6
+	.string	"y2"
+	.byte	0x8
+	.byte	0x24
+	.byte	0x17
+	.long	0xe7
+	.byte	0x20
+	.uleb128 0x6
+	.string	"d1"
+	.byte	0x8
+	.byte	0x25
+	.byte	0xb
+	.long	0xe7
+	.byte	0x24
+	.uleb128 0x6
+	.string	"d2"
+	.byte	0x8
+	.byte	0x25
+	.byte	0xf
+	.long	0xe7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2441
+	.byte	0x8
+	.byte	0x26
+	.byte	0x3
+	.long	0x1fa
+	.uleb128 0x3
+	.long	.LASF2442
+	.byte	0x9
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x9
+	.byte	0x21
+	.long	0x2cb
+	.uleb128 0xc
+	.long	.LASF2443
+	.value	0xfff
+	.uleb128 0xc
+	.long	.LASF2444
+	.value	0xf000
+	.uleb128 0xc
+	.long	.LASF2445
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2447
+	.byte	0x9
+	.byte	0x29
+	.byte	0xf
+	.long	0x2d7
+	.uleb128 0x20
+	.long	0x2e7
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x9
+	.byte	0x31
+	.byte	0x5
+	.long	0x308
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x9
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x9
+	.byte	0x33
+	.byte	0x16
+	.long	0x308
+	.byte	0
+	.uleb128 0x5
+	.long	0x2cb
+	.uleb128 0x8
+	.long	.LASF2449
+	.byte	0x28
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x10
+	.long	0x369
+	.uleb128 0x6
+	.string	"pgn"
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xb
+	.long	0x298
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2450
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0x9
+	.byte	0x2e
+	.byte	0xe
+	.long	0x369
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2452
+	.byte	0x9
+	.byte	0x2f
+	.byte	0xe
+	.long	0x369
+	.byte	0x10
+	.uleb128 0x6
+	.string	"ptr"
+	.byte	0x9
+	.byte	0x30
+	.byte	0xf
+	.long	0x36e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2453
+	.byte	0x9
+	.byte	0x34
+	.byte	0x7
+	.long	0x2e7
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0x369
+	.uleb128 0x3
+	.long	.LASF2454
+	.byte	0x9
+	.byte	0x35
+	.byte	0x3
+	.long	0x30d
+	.uleb128 0x12
+	.long	0x373
+	.uleb128 0x3
+	.long	.LASF2455
+	.byte	0xa
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x2b
+	.long	.LASF2461
+	.byte	0x5
+	.byte	0x4
+	.long	0x7c
+	.byte	0xb
+	.byte	0x1e
+	.byte	0xe
+	.long	0x3c1
+	.uleb128 0x2c
+	.long	.LASF2456
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2461
+	.byte	0xb
+	.byte	0x24
+	.byte	0x3
+	.long	0x390
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2462
+	.uleb128 0x8
+	.long	.LASF2463
+	.byte	0x10
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xc
+	.long	0x3fc
+	.uleb128 0x2
+	.long	.LASF2464
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x16
+	.long	0x3fc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2465
+	.byte	0xc
+	.byte	0x1f
+	.byte	0xe
+	.long	0x384
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x118
+	.uleb128 0x8
+	.long	.LASF2466
+	.byte	0x8
+	.byte	0xc
+	.byte	0x21
+	.byte	0xc
+	.long	0x429
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0xc
+	.byte	0x22
+	.byte	0x12
+	.long	0x3c1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0xc
+	.byte	0x23
+	.byte	0x10
+	.long	0xb7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2647
+	.byte	0x10
+	.byte	0xc
+	.byte	0x19
+	.long	0x44e
+	.uleb128 0x11
+	.string	"spi"
+	.byte	0xc
+	.byte	0x20
+	.byte	0x7
+	.long	0x3d4
+	.uleb128 0x11
+	.string	"i2c"
+	.byte	0xc
+	.byte	0x24
+	.byte	0x7
+	.long	0x401
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2468
+	.byte	0xc
+	.byte	0x25
+	.byte	0x3
+	.long	0x429
+	.uleb128 0x12
+	.long	0x44e
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xd
+	.byte	0x17
+	.long	0x4a1
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2478
+	.byte	0xd
+	.byte	0x21
+	.byte	0x3
+	.long	0x45f
+	.uleb128 0x3
+	.long	.LASF2479
+	.byte	0xd
+	.byte	0x27
+	.byte	0x10
+	.long	0x4b9
+	.uleb128 0x5
+	.long	0x4be
+	.uleb128 0x20
+	.long	0x4c9
+	.uleb128 0x4
+	.long	0x4c9
+	.byte	0
+	.uleb128 0x5
+	.long	0x4ce
+	.uleb128 0x8
+	.long	.LASF2480
+	.byte	0x88
+	.byte	0xe
+	.byte	0x4c
+	.byte	0x10
+	.long	0x56b
+	.uleb128 0x2
+	.long	.LASF2481
+	.byte	0xe
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x4ad
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2482
+	.byte	0xe
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x56b
+	.byte	0x8
+	.uleb128 0x6
+	.string	"bus"
+	.byte	0xe
+	.byte	0x4f
+	.byte	0x11
+	.long	0x44e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2483
+	.byte	0xe
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0xe
+	.byte	0x51
+	.byte	0xd
+	.long	0x812
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0xe
+	.byte	0x52
+	.byte	0xa
+	.long	0x98
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0xe
+	.byte	0x53
+	.byte	0x9
+	.long	0x3cd
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0xe
+	.byte	0x55
+	.byte	0x15
+	.long	0x7ff
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2488
+	.byte	0xe
+	.byte	0x57
+	.byte	0x14
+	.long	0x4a1
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0xe
+	.byte	0x58
+	.byte	0x1a
+	.long	0x6ff
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0xe
+	.byte	0x59
+	.byte	0x18
+	.long	0x642
+	.byte	0x68
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2491
+	.byte	0xd
+	.byte	0x28
+	.byte	0xf
+	.long	0x577
+	.uleb128 0x5
+	.long	0x57c
+	.uleb128 0x1c
+	.long	0x3cd
+	.long	0x58b
+	.uleb128 0x4
+	.long	0x4c9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2492
+	.byte	0xf
+	.byte	0x80
+	.byte	0xf
+	.long	0x597
+	.uleb128 0x5
+	.long	0x59c
+	.uleb128 0x1c
+	.long	0x3cd
+	.long	0x5ba
+	.uleb128 0x4
+	.long	0x5ba
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0x369
+	.byte	0
+	.uleb128 0x5
+	.long	0x45a
+	.uleb128 0x3
+	.long	.LASF2493
+	.byte	0xf
+	.byte	0x81
+	.byte	0xf
+	.long	0x5cb
+	.uleb128 0x5
+	.long	0x5d0
+	.uleb128 0x1c
+	.long	0x3cd
+	.long	0x5e9
+	.uleb128 0x4
+	.long	0x5ba
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2494
+	.byte	0xf
+	.byte	0x82
+	.byte	0x10
+	.long	0x5f5
+	.uleb128 0x5
+	.long	0x5fa
+	.uleb128 0x2d
+	.uleb128 0x8
+	.long	.LASF2495
+	.byte	0x20
+	.byte	0xf
+	.byte	0x86
+	.byte	0x10
+	.long	0x63d
+	.uleb128 0x2
+	.long	.LASF2482
+	.byte	0xf
+	.byte	0x87
+	.byte	0x1a
+	.long	0x58b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2496
+	.byte	0xf
+	.byte	0x88
+	.byte	0x1b
+	.long	0x5bf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2497
+	.byte	0xf
+	.byte	0x89
+	.byte	0x13
+	.long	0x5e9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2498
+	.byte	0xf
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x12
+	.long	0x5fb
+	.uleb128 0x3
+	.long	.LASF2499
+	.byte	0xf
+	.byte	0x8b
+	.byte	0x3
+	.long	0x5fb
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xf
+	.byte	0xa9
+	.long	0x6a2
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2512
+	.byte	0xf
+	.byte	0xb6
+	.byte	0x3
+	.long	0x64e
+	.uleb128 0xa
+	.long	0x30
+	.byte	0xf
+	.byte	0xb8
+	.long	0x6c6
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2515
+	.byte	0xf
+	.byte	0xbb
+	.byte	0x3
+	.long	0x6ae
+	.uleb128 0x8
+	.long	.LASF2516
+	.byte	0x8
+	.byte	0xf
+	.byte	0xbd
+	.byte	0x10
+	.long	0x6fa
+	.uleb128 0x2
+	.long	.LASF2517
+	.byte	0xf
+	.byte	0xbe
+	.byte	0x11
+	.long	0x6a2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2518
+	.byte	0xf
+	.byte	0xbf
+	.byte	0x19
+	.long	0x6c6
+	.byte	0x4
+	.byte	0
+	.uleb128 0x12
+	.long	0x6d2
+	.uleb128 0x3
+	.long	.LASF2519
+	.byte	0xf
+	.byte	0xc0
+	.byte	0x3
+	.long	0x6d2
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2520
+	.uleb128 0x8
+	.long	.LASF2521
+	.byte	0x10
+	.byte	0x10
+	.byte	0x33
+	.byte	0x10
+	.long	0x73a
+	.uleb128 0x2
+	.long	.LASF2522
+	.byte	0x10
+	.byte	0x35
+	.byte	0x23
+	.long	0x73a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2523
+	.byte	0x10
+	.byte	0x36
+	.byte	0x23
+	.long	0x73a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x712
+	.uleb128 0x3
+	.long	.LASF2524
+	.byte	0x10
+	.byte	0x37
+	.byte	0x3
+	.long	0x712
+	.uleb128 0x8
+	.long	.LASF2525
+	.byte	0x28
+	.byte	0x11
+	.byte	0x16
+	.byte	0x8
+	.long	0x7c1
+	.uleb128 0x2
+	.long	.LASF2526
+	.byte	0x11
+	.byte	0x18
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2527
+	.byte	0x11
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2528
+	.byte	0x11
+	.byte	0x1a
+	.byte	0x7
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2529
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2530
+	.byte	0x11
+	.byte	0x20
+	.byte	0x7
+	.long	0x7c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2531
+	.byte	0x11
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2532
+	.byte	0x11
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2533
+	.byte	0x11
+	.byte	0x24
+	.byte	0x14
+	.long	0x73f
+	.byte	0x18
+	.byte	0
+	.uleb128 0x21
+	.byte	0x28
+	.byte	0x12
+	.byte	0x43
+	.byte	0x9
+	.long	0x7ef
+	.uleb128 0x13
+	.long	.LASF2534
+	.byte	0x12
+	.byte	0x45
+	.byte	0x1c
+	.long	0x74b
+	.uleb128 0x13
+	.long	.LASF2535
+	.byte	0x12
+	.byte	0x46
+	.byte	0x8
+	.long	0x7ef
+	.uleb128 0x13
+	.long	.LASF2536
+	.byte	0x12
+	.byte	0x47
+	.byte	0xc
+	.long	0x8f
+	.byte	0
+	.uleb128 0xf
+	.long	0x98
+	.long	0x7ff
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2537
+	.byte	0x12
+	.byte	0x48
+	.byte	0x3
+	.long	0x7c1
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2538
+	.uleb128 0xf
+	.long	0x9f
+	.long	0x822
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	0xab
+	.long	0x832
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2539
+	.byte	0xe
+	.byte	0x5a
+	.byte	0x3
+	.long	0x4ce
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x13
+	.byte	0x14
+	.long	0x964
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2557
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2558
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x14
+	.byte	0x22
+	.long	0xa40
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF2594
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF2595
+	.value	0x200
+	.uleb128 0xc
+	.long	.LASF2596
+	.value	0x400
+	.uleb128 0xc
+	.long	.LASF2597
+	.value	0x1000
+	.uleb128 0xc
+	.long	.LASF2598
+	.value	0x2000
+	.uleb128 0xc
+	.long	.LASF2599
+	.value	0x4000
+	.uleb128 0xc
+	.long	.LASF2600
+	.value	0x8000
+	.uleb128 0x9
+	.long	.LASF2601
+	.long	0x10000
+	.uleb128 0x9
+	.long	.LASF2602
+	.long	0x20000
+	.uleb128 0x9
+	.long	.LASF2603
+	.long	0x40000
+	.uleb128 0x9
+	.long	.LASF2604
+	.long	0x80000
+	.uleb128 0x9
+	.long	.LASF2605
+	.long	0x100000
+	.uleb128 0x9
+	.long	.LASF2606
+	.long	0x200000
+	.uleb128 0x9
+	.long	.LASF2607
+	.long	0x400000
+	.uleb128 0x9
+	.long	.LASF2608
+	.long	0x800000
+	.uleb128 0x9
+	.long	.LASF2609
+	.long	0x2000000
+	.uleb128 0x9
+	.long	.LASF2610
+	.long	0x4000000
+	.uleb128 0x9
+	.long	.LASF2611
+	.long	0x8000000
+	.uleb128 0x9
+	.long	.LASF2612
+	.long	0x10000000
+	.uleb128 0x9
+	.long	.LASF2613
+	.long	0x20000000
+	.byte	0
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x15
+	.byte	0x17
+	.long	0xad0
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2636
+	.byte	0x15
+	.byte	0x31
+	.byte	0x3
+	.long	0xa40
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x16
+	.byte	0x14
+	.long	0xb06
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0xb16
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2642
+	.byte	0x16
+	.byte	0x1c
+	.byte	0x10
+	.long	0xb06
+	.uleb128 0x8
+	.long	.LASF2643
+	.byte	0x6
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x10
+	.long	0xb57
+	.uleb128 0x2
+	.long	.LASF2644
+	.byte	0x16
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2645
+	.byte	0x16
+	.byte	0x20
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x16
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2646
+	.byte	0x16
+	.byte	0x22
+	.byte	0x3
+	.long	0xb22
+	.uleb128 0x1b
+	.long	.LASF2648
+	.byte	0x6
+	.byte	0x16
+	.byte	0x24
+	.long	0xb88
+	.uleb128 0x11
+	.string	"raw"
+	.byte	0x16
+	.byte	0x25
+	.byte	0xd
+	.long	0x812
+	.uleb128 0x13
+	.long	.LASF2649
+	.byte	0x16
+	.byte	0x26
+	.byte	0x1f
+	.long	0xb57
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2650
+	.byte	0x16
+	.byte	0x27
+	.byte	0x3
+	.long	0xb63
+	.uleb128 0x12
+	.long	0xb88
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x16
+	.byte	0x2d
+	.long	0xbcf
+	.uleb128 0x1
+	.long	.LASF2651
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2652
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x40
+	.byte	0
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x17
+	.byte	0x19
+	.long	0xc3b
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2665
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2674
+	.byte	0x17
+	.byte	0x2a
+	.byte	0x3
+	.long	0xbcf
+	.uleb128 0x8
+	.long	.LASF2675
+	.byte	0xa0
+	.byte	0x17
+	.byte	0x2c
+	.byte	0x10
+	.long	0xc89
+	.uleb128 0x6
+	.string	"dev"
+	.byte	0x17
+	.byte	0x2d
+	.byte	0xe
+	.long	0x832
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2676
+	.byte	0x17
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2677
+	.byte	0x17
+	.byte	0x2f
+	.byte	0xd
+	.long	0x822
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF2678
+	.byte	0x17
+	.byte	0x30
+	.byte	0x9
+	.long	0x3cd
+	.byte	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2679
+	.byte	0x17
+	.byte	0x31
+	.byte	0x3
+	.long	0xc47
+	.uleb128 0x2e
+	.string	"acc"
+	.byte	0x17
+	.byte	0x33
+	.byte	0xe
+	.long	0xc89
+	.uleb128 0x8
+	.long	.LASF2680
+	.byte	0x4
+	.byte	0x17
+	.byte	0x35
+	.byte	0x10
+	.long	0xcc9
+	.uleb128 0x2
+	.long	.LASF2644
+	.byte	0x17
+	.byte	0x36
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2645
+	.byte	0x17
+	.byte	0x37
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2681
+	.byte	0x17
+	.byte	0x38
+	.byte	0x3
+	.long	0xca1
+	.uleb128 0x1b
+	.long	.LASF2682
+	.byte	0x4
+	.byte	0x17
+	.byte	0x3a
+	.long	0xcfa
+	.uleb128 0x11
+	.string	"raw"
+	.byte	0x17
+	.byte	0x3b
+	.byte	0xd
+	.long	0xcfa
+	.uleb128 0x13
+	.long	.LASF2649
+	.byte	0x17
+	.byte	0x3c
+	.byte	0x1d
+	.long	0xcc9
+	.byte	0
+	.uleb128 0xf
+	.long	0x9f
+	.long	0xd0a
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2683
+	.byte	0x17
+	.byte	0x3d
+	.byte	0x3
+	.long	0xcd5
+	.uleb128 0x8
+	.long	.LASF2684
+	.byte	0x14
+	.byte	0x17
+	.byte	0x40
+	.byte	0x10
+	.long	0xd65
+	.uleb128 0x2
+	.long	.LASF2685
+	.byte	0x17
+	.byte	0x41
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2686
+	.byte	0x17
+	.byte	0x42
+	.byte	0x14
+	.long	0x4a1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2687
+	.byte	0x17
+	.byte	0x43
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2688
+	.byte	0x17
+	.byte	0x44
+	.byte	0x1b
+	.long	0xb88
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2689
+	.byte	0x17
+	.byte	0x45
+	.byte	0x19
+	.long	0xd0a
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2690
+	.byte	0x17
+	.byte	0x46
+	.byte	0x3
+	.long	0xd16
+	.uleb128 0x12
+	.long	0xd65
+	.uleb128 0xb
+	.long	.LASF2691
+	.byte	0x17
+	.byte	0x48
+	.byte	0x1e
+	.long	0xd65
+	.uleb128 0xb
+	.long	.LASF2692
+	.byte	0x17
+	.byte	0x48
+	.byte	0x57
+	.long	0xd65
+	.uleb128 0x1d
+	.long	0xc95
+	.byte	0x45
+	.byte	0x7
+	.uleb128 0x14
+	.long	.LASF2697
+	.byte	0x47
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xb
+	.long	.LASF2693
+	.byte	0x18
+	.byte	0x49
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xb
+	.long	.LASF2694
+	.byte	0x18
+	.byte	0x4a
+	.byte	0xc
+	.long	0x3cd
+	.uleb128 0xb
+	.long	.LASF2695
+	.byte	0x18
+	.byte	0x4b
+	.byte	0xc
+	.long	0x3cd
+	.uleb128 0xb
+	.long	.LASF2696
+	.byte	0x18
+	.byte	0x4c
+	.byte	0xc
+	.long	0x3cd
+	.uleb128 0x14
+	.long	.LASF2698
+	.byte	0x4e
+	.byte	0x1f
+	.long	0xddb
+	.uleb128 0x5
+	.long	0xb88
+	.uleb128 0x14
+	.long	.LASF2699
+	.byte	0x50
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xf
+	.long	0x28c
+	.long	0xdfb
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2700
+	.byte	0x51
+	.byte	0x17
+	.long	0xdeb
+	.uleb128 0x1d
+	.long	0xd76
+	.byte	0x53
+	.byte	0x5b
+	.uleb128 0x1d
+	.long	0xd82
+	.byte	0x53
+	.byte	0x8d
+	.uleb128 0xb
+	.long	.LASF2701
+	.byte	0x18
+	.byte	0x53
+	.byte	0xc1
+	.long	0x37f
+	.uleb128 0x2f
+	.long	0xe14
+	.byte	0xf2
+	.uleb128 0x15
+	.long	.LASF2702
+	.byte	0x15
+	.byte	0x3c
+	.long	0xe37
+	.uleb128 0x4
+	.long	0xad0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2728
+	.byte	0x14
+	.byte	0x74
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF2704
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0x5
+	.long	0x3cd
+	.long	0xe55
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2703
+	.byte	0x19
+	.byte	0x1e
+	.long	0xe6b
+	.uleb128 0x4
+	.long	0xe6b
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x31
+	.long	.LASF2705
+	.byte	0x1b
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xe87
+	.uleb128 0x4
+	.long	0xe7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2706
+	.byte	0x8
+	.byte	0x6e
+	.byte	0x7
+	.long	0xe7
+	.long	0xea2
+	.uleb128 0x4
+	.long	0xea2
+	.uleb128 0x4
+	.long	0xe7
+	.byte	0
+	.uleb128 0x5
+	.long	0x28c
+	.uleb128 0x15
+	.long	.LASF2707
+	.byte	0x8
+	.byte	0x6a
+	.long	0xec2
+	.uleb128 0x4
+	.long	0xea2
+	.uleb128 0x4
+	.long	0xe7
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2708
+	.byte	0x6e
+	.byte	0x24
+	.long	0xecd
+	.uleb128 0x5
+	.long	0x6fa
+	.uleb128 0x1e
+	.long	.LASF2709
+	.byte	0x6c
+	.byte	0x22
+	.long	0xedd
+	.uleb128 0x5
+	.long	0x63d
+	.uleb128 0x1e
+	.long	.LASF2710
+	.byte	0x6a
+	.byte	0x14
+	.long	0x5ba
+	.uleb128 0x16
+	.long	.LASF2711
+	.byte	0x1d
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xf0d
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2712
+	.byte	0x1e
+	.byte	0x6a
+	.long	0xf1e
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2713
+	.byte	0x1f
+	.byte	0x16
+	.byte	0x5
+	.long	0x3cd
+	.long	0xf34
+	.uleb128 0x4
+	.long	0x4c9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2715
+	.value	0x1e8
+	.long	0xf5a
+	.uleb128 0xd
+	.long	.LASF2717
+	.value	0x1e8
+	.byte	0x25
+	.long	0xc3
+	.uleb128 0x18
+	.uleb128 0xe
+	.long	.LASF2714
+	.value	0x1ec
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2716
+	.value	0x1e3
+	.long	0xf72
+	.uleb128 0xd
+	.long	.LASF2718
+	.value	0x1e3
+	.byte	0x32
+	.long	0xddb
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2719
+	.value	0x1c4
+	.long	0xfaa
+	.uleb128 0xd
+	.long	.LASF2720
+	.value	0x1c4
+	.byte	0x25
+	.long	0xfaa
+	.uleb128 0x32
+	.long	0xf9b
+	.uleb128 0xe
+	.long	.LASF2714
+	.value	0x1cb
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xe
+	.long	.LASF2714
+	.value	0x1d1
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xd0a
+	.uleb128 0x1f
+	.long	.LASF2721
+	.value	0x1bd
+	.long	0xfc7
+	.uleb128 0xd
+	.long	.LASF2698
+	.value	0x1bd
+	.byte	0x41
+	.long	0xfc7
+	.byte	0
+	.uleb128 0x5
+	.long	0xb94
+	.uleb128 0x1f
+	.long	.LASF2722
+	.value	0x188
+	.long	0x1011
+	.uleb128 0xd
+	.long	.LASF2720
+	.value	0x188
+	.byte	0x49
+	.long	0xfaa
+	.uleb128 0xe
+	.long	.LASF2714
+	.value	0x18a
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x22
+	.string	"b"
+	.value	0x18b
+	.long	0x822
+	.uleb128 0xe
+	.long	.LASF2723
+	.value	0x18c
+	.byte	0x14
+	.long	0x812
+	.uleb128 0xe
+	.long	.LASF2724
+	.value	0x18d
+	.byte	0x20
+	.long	0xd0a
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2725
+	.value	0x168
+	.long	0x1040
+	.uleb128 0xd
+	.long	.LASF2720
+	.value	0x168
+	.byte	0x40
+	.long	0xfaa
+	.uleb128 0x22
+	.string	"a"
+	.value	0x16a
+	.long	0x822
+	.uleb128 0x18
+	.uleb128 0xe
+	.long	.LASF2714
+	.value	0x16c
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2726
+	.value	0x163
+	.long	0x3cd
+	.uleb128 0x23
+	.long	.LASF2727
+	.value	0x15e
+	.long	0x3cd
+	.uleb128 0x33
+	.long	.LASF2729
+	.byte	0x18
+	.value	0x159
+	.byte	0x5
+	.long	0x3cd
+	.uleb128 0x17
+	.long	.LASF2730
+	.value	0x154
+	.long	0x107b
+	.uleb128 0xd
+	.long	.LASF2731
+	.value	0x154
+	.byte	0x27
+	.long	0xc3
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2732
+	.byte	0x18
+	.value	0x12d
+	.byte	0x5
+	.long	0x3cd
+	.long	0x10a7
+	.uleb128 0xd
+	.long	.LASF2733
+	.value	0x12d
+	.byte	0x16
+	.long	0xcf
+	.uleb128 0x18
+	.uleb128 0xe
+	.long	.LASF2714
+	.value	0x14a
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2734
+	.byte	0x18
+	.byte	0x79
+	.byte	0x5
+	.long	0x3cd
+	.long	0x10e2
+	.uleb128 0x36
+	.string	"dev"
+	.byte	0x18
+	.byte	0x79
+	.byte	0x19
+	.long	0x10e2
+	.uleb128 0x19
+	.long	.LASF2735
+	.byte	0x79
+	.byte	0x33
+	.long	0xc3b
+	.uleb128 0x14
+	.long	.LASF2736
+	.byte	0x7b
+	.byte	0x1a
+	.long	0xc3b
+	.uleb128 0x37
+	.long	.LASF2746
+	.byte	0x18
+	.byte	0x81
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	0x832
+	.uleb128 0x24
+	.long	.LASF2737
+	.byte	0x6e
+	.long	0x10fd
+	.uleb128 0x19
+	.long	.LASF2464
+	.byte	0x6e
+	.byte	0x3b
+	.long	0x10fd
+	.byte	0
+	.uleb128 0x5
+	.long	0xd65
+	.uleb128 0x25
+	.long	.LASF2739
+	.byte	0x69
+	.uleb128 0x38
+	.long	.LASF2738
+	.byte	0x18
+	.byte	0x62
+	.byte	0xd
+	.long	0x1120
+	.uleb128 0x19
+	.long	.LASF2688
+	.byte	0x62
+	.byte	0x3d
+	.long	0xddb
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2740
+	.byte	0x5d
+	.uleb128 0x24
+	.long	.LASF2741
+	.byte	0x55
+	.long	0x113c
+	.uleb128 0x19
+	.long	.LASF2720
+	.byte	0x55
+	.byte	0x32
+	.long	0xfaa
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2742
+	.byte	0x17
+	.byte	0x48
+	.value	0x103
+	.long	0x10fd
+	.uleb128 0x3a
+	.long	.LASF2743
+	.byte	0x17
+	.byte	0x48
+	.byte	0x9c
+	.long	0x1155
+	.uleb128 0x5
+	.long	0xd71
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 32 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x22
+	.file 35 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 37 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 38 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x26
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 41 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 43 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2b
+	.file 44 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x34
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 60 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.file 61 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 62 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.file 64 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xe
+	.file 66 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.file 67 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 68 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1639
+	.file 69 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1641
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1642
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1651
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1656
+	.byte	0x4
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 77 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1692
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1694
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1695
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1696
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1697
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1709
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1716
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1717
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1718
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1721
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5a
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1722
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 92 "./src/main/drivers/accgyro/accgyro_adxl345.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x5c
+	.byte	0x4
+	.file 93 "./src/main/drivers/accgyro/accgyro_bma280.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x1f
+	.byte	0x4
+	.file 94 "./src/main/drivers/accgyro/accgyro_l3g4200d.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x5e
+	.byte	0x4
+	.file 95 "./src/main/drivers/accgyro/accgyro_l3gd20.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/drivers/accgyro/accgyro_lsm303dlhc.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 97 "./src/main/drivers/accgyro/accgyro_mma845x.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/drivers/accgyro/accgyro_mpu3050.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 99 "./src/main/drivers/accgyro/accgyro_mpu6050.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x63
+	.byte	0x4
+	.file 100 "./src/main/drivers/accgyro/accgyro_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 101 "./src/main/drivers/accgyro/accgyro_spi_bmi160.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x65
+	.byte	0x4
+	.file 102 "./src/main/drivers/accgyro/accgyro_spi_icm20689.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 103 "./src/main/drivers/accgyro/accgyro_spi_mpu6000.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 104 "./src/main/drivers/accgyro/accgyro_spi_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x68
+	.byte	0x4
+	.file 105 "./src/main/drivers/accgyro/accgyro_spi_mpu9250.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 106 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1951
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x14
+	.file 107 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6b
+	.byte	0x4
+	.file 108 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6c
+	.byte	0x4
+	.file 109 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 110 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6e
+	.byte	0x4
+	.file 111 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6f
+	.file 112 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x70
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 113 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x71
+	.file 114 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x72
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.file 115 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2370
+	.byte	0x4
+	.file 116 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 117 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2374
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x15
+	.file 118 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x76
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2386
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1415
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1423
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1428
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1435
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1540
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1542
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1646
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1648
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1688
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1708
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1720
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1752
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_lsm303dlhc.h.57.fca8398e4fda95a0f26079c2c3deff7e,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu3050.h.21.5c2c3f68cf533de2f049158113684e6d,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1927
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu6500.h.20.81784e103e59d17986bd067df6cf9997,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_icm20689.h.21.e4ceb006a38c1b53339fd03e766f2c2c,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1941
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu6000.h.6.3b6c85f4d39f2b8f455a259d1cae7373,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu9250.h.6.ec8aa7be40d86c318c904947d7c80cc8,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1953
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2373
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2385
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2392
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2747
+	.long	.LASF2748
+	.long	.LASF2749
+	.long	.LASF2750
+	.long	.LASF2751
+	.long	.LASF2752
+	.long	.LASF2753
+	.long	.LASF2754
+	.long	.LASF2755
+	.long	.LASF2756
+	.long	.LASF2757
+	.long	.LASF2758
+	.long	.LASF2759
+	.long	.LASF2760
+	.long	.LASF2761
+	.long	.LASF2762
+	.long	.LASF2763
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x77
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2764
+	.byte	0xd
+	.long	.LASF2765
+	.byte	0xd
+	.long	.LASF2766
+	.byte	0xd
+	.long	.LASF2767
+	.byte	0x11
+	.long	.LASF2768
+	.byte	0x9
+	.long	.LASF2769
+	.byte	0x1
+	.long	.LASF2770
+	.byte	0x2
+	.long	.LASF2771
+	.byte	0x2
+	.long	.LASF2772
+	.byte	0x3
+	.long	.LASF2773
+	.byte	0x5
+	.long	.LASF2774
+	.byte	0x5
+	.long	.LASF2775
+	.byte	0x5
+	.long	.LASF2776
+	.byte	0x5
+	.long	.LASF2777
+	.byte	0x4
+	.long	.LASF2778
+	.byte	0x4
+	.long	.LASF2779
+	.byte	0xd
+	.long	.LASF2780
+	.byte	0xd
+	.long	.LASF2781
+	.byte	0xd
+	.long	.LASF2782
+	.byte	0x5
+	.long	.LASF2783
+	.byte	0x6
+	.long	.LASF2784
+	.byte	0x7
+	.long	.LASF2785
+	.byte	0x8
+	.long	.LASF2786
+	.byte	0x8
+	.long	.LASF2787
+	.byte	0x8
+	.long	.LASF2788
+	.byte	0x8
+	.long	.LASF2789
+	.byte	0x3
+	.long	.LASF2790
+	.byte	0xd
+	.long	.LASF2791
+	.byte	0x8
+	.long	.LASF2792
+	.byte	0x10
+	.long	.LASF2793
+	.byte	0x6
+	.long	.LASF2794
+	.byte	0x4
+	.long	.LASF2795
+	.byte	0x10
+	.long	.LASF2796
+	.byte	0x11
+	.long	.LASF2797
+	.byte	0x11
+	.long	.LASF2797
+	.byte	0x10
+	.long	.LASF2798
+	.byte	0xd
+	.long	.LASF2799
+	.byte	0x10
+	.long	.LASF2800
+	.byte	0x10
+	.long	.LASF2801
+	.byte	0xd
+	.long	.LASF2802
+	.byte	0xd
+	.long	.LASF2803
+	.byte	0xf
+	.long	.LASF2804
+	.byte	0xd
+	.long	.LASF2805
+	.byte	0xe
+	.long	.LASF2806
+	.byte	0xe
+	.long	.LASF2807
+	.byte	0xd
+	.long	.LASF2808
+	.byte	0xd
+	.long	.LASF2809
+	.byte	0xd
+	.long	.LASF2810
+	.byte	0xc
+	.long	.LASF2811
+	.byte	0xc
+	.long	.LASF2812
+	.byte	0x10
+	.long	.LASF2813
+	.byte	0x10
+	.long	.LASF2814
+	.byte	0xd
+	.long	.LASF2815
+	.byte	0xd
+	.long	.LASF2816
+	.byte	0xd
+	.long	.LASF2817
+	.byte	0xd
+	.long	.LASF2818
+	.byte	0xd
+	.long	.LASF2819
+	.byte	0xd
+	.long	.LASF2820
+	.byte	0xd
+	.long	.LASF2821
+	.byte	0xd
+	.long	.LASF2822
+	.byte	0xb
+	.long	.LASF2823
+	.byte	0xa
+	.long	.LASF2824
+	.byte	0xa
+	.long	.LASF2825
+	.byte	0x3
+	.long	.LASF2826
+	.byte	0x1
+	.long	.LASF2827
+	.byte	0x3
+	.long	.LASF2828
+	.byte	0x5
+	.long	.LASF2829
+	.byte	0x5
+	.long	.LASF2830
+	.byte	0x10
+	.long	.LASF2831
+	.byte	0x10
+	.long	.LASF2832
+	.byte	0xc
+	.long	.LASF2833
+	.byte	0xc
+	.long	.LASF2834
+	.byte	0xd
+	.long	.LASF2835
+	.byte	0xd
+	.long	.LASF2831
+	.byte	0xd
+	.long	.LASF2836
+	.byte	0xc
+	.long	.LASF2837
+	.byte	0xd
+	.long	.LASF2838
+	.byte	0x10
+	.long	.LASF2838
+	.byte	0xd
+	.long	.LASF2839
+	.byte	0xc
+	.long	.LASF2840
+	.byte	0xc
+	.long	.LASF2841
+	.byte	0xc
+	.long	.LASF2842
+	.byte	0xc
+	.long	.LASF2843
+	.byte	0xc
+	.long	.LASF2844
+	.byte	0xd
+	.long	.LASF2845
+	.byte	0xd
+	.long	.LASF2846
+	.byte	0xd
+	.long	.LASF2847
+	.byte	0xd
+	.long	.LASF2848
+	.byte	0xc
+	.long	.LASF2849
+	.byte	0xc
+	.long	.LASF2850
+	.byte	0xd
+	.long	.LASF2851
+	.byte	0xd
+	.long	.LASF2852
+	.byte	0x4
+	.long	.LASF2853
+	.byte	0x4
+	.long	.LASF2854
+	.byte	0x4
+	.long	.LASF2855
+	.byte	0x4
+	.long	.LASF2856
+	.byte	0x4
+	.long	.LASF2857
+	.byte	0x4
+	.long	.LASF2858
+	.byte	0x4
+	.long	.LASF2859
+	.byte	0x4
+	.long	.LASF2860
+	.byte	0x4
+	.long	.LASF2861
+	.byte	0x4
+	.long	.LASF2862
+	.byte	0x4
+	.long	.LASF2863
+	.byte	0x4
+	.long	.LASF2864
+	.byte	0x4
+	.long	.LASF2865
+	.byte	0x4
+	.long	.LASF2866
+	.byte	0x5
+	.long	.LASF2867
+	.byte	0x5
+	.long	.LASF2868
+	.byte	0x5
+	.long	.LASF2869
+	.byte	0x5
+	.long	.LASF2870
+	.byte	0x5
+	.long	.LASF2871
+	.byte	0x5
+	.long	.LASF2872
+	.byte	0x5
+	.long	.LASF2873
+	.byte	0x5
+	.long	.LASF2874
+	.byte	0x2
+	.long	.LASF2875
+	.byte	0x5
+	.long	.LASF2876
+	.byte	0x5
+	.long	.LASF2877
+	.byte	0x5
+	.long	.LASF2838
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2361:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2133:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1663:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1422:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1997:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF1932:
+	.string	"ICM20602_WHO_AM_I_CONST (0x12)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2536:
+	.string	"__align"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2495:
+	.string	"mpuConfiguration_s"
+.LASF2499:
+	.string	"mpuConfiguration_t"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1860:
+	.string	"LSM303DLHC_IT1_OVERRUN ((uint8_t)0x02)"
+.LASF1895:
+	.string	"LSM303DLHC_FS_1_3_GA ((uint8_t) 0x20)"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1775:
+	.string	"LSM303DLHC_OUT_Z_L_A 0x2C"
+.LASF2008:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF2525:
+	.string	"__pthread_mutex_s"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF1881:
+	.string	"LSM303DLHC_X_DOUBLE_CLICK ((uint8_t)0x02)"
+.LASF2606:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1853:
+	.string	"LSM303DLHC_HPF_AOI2_ENABLE ((uint8_t)0x02)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2738:
+	.string	"resetFlightDynamicsTrims"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1672:
+	.string	"sched_priority sched_priority"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF1907:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_5_6Ga 330"
+.LASF2587:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1644:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1628:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF2712:
+	.string	"sensorsSet"
+.LASF2264:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2094:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1610:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1651:
+	.string	"__pid_t_defined "
+.LASF1643:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2453:
+	.string	"reset"
+.LASF2386:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1436:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2345:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2398:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1673:
+	.string	"__sched_priority sched_priority"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1509:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2265:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2462:
+	.string	"_Bool"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2210:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1658:
+	.string	"__CPU_SETSIZE 1024"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2548:
+	.string	"OWNER_ADC_CURR"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2064:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2015:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2325:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2298:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2629:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2623:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1982:
+	.string	"BIT(x) (1 << (x))"
+.LASF1498:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1960:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1917:
+	.string	"LSM303DLHC_SINGLE_CONVERSION ((uint8_t) 0x01)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2475:
+	.string	"CW90_DEG_FLIP"
+.LASF1682:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2461:
+	.string	"I2CDevice"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2288:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2188:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2394:
+	.string	"short unsigned int"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF1886:
+	.string	"LSM303DLHC_INT1INTERRUPT_HIGH_EDGE ((uint8_t)0x00)"
+.LASF1585:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2477:
+	.string	"CW270_DEG_FLIP"
+.LASF2379:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2357:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1869:
+	.string	"LSM303DLHC_MOV_RECOGNITION ((uint8_t)0x40)"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1499:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1834:
+	.string	"LSM303DLHC_BLE_LSB ((uint8_t)0x00)"
+.LASF2642:
+	.string	"detectedSensors"
+.LASF1491:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2196:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF2180:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2329:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1630:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2304:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1455:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1780:
+	.string	"LSM303DLHC_INT1_SOURCE_A 0x31"
+.LASF2545:
+	.string	"OWNER_LED"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2028:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2333:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2045:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1930:
+	.string	"MPU9255_WHO_AM_I_CONST (0x73)"
+.LASF1721:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2596:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2497:
+	.string	"resetFn"
+.LASF2409:
+	.string	"uint16_t"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2689:
+	.string	"accelerometerTrims"
+.LASF1662:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2463:
+	.string	"deviceSpi_s"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2296:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2066:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2140:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2275:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1939:
+	.string	"MPU6500_BIT_I2C_IF_DIS (1 << 4)"
+.LASF2373:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1446:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2249:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2732:
+	.string	"accInit"
+.LASF1931:
+	.string	"ICM20601_WHO_AM_I_CONST (0xAC)"
+.LASF1894:
+	.string	"LSM303DLHC_ODR_220_HZ ((uint8_t) 0x1C)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1618:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1555:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1487:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2012:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1459:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1580:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2317:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2716:
+	.string	"setAccelerationTrims"
+.LASF2334:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1771:
+	.string	"LSM303DLHC_OUT_X_L_A 0x28"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1472:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1752:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF1985:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1758:
+	.string	"LSM303DLHC_I2C_SCK_PIN PB6"
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2628:
+	.string	"BEEPER_READY_BEEP"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2016:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1656:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF2320:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1789:
+	.string	"LSM303DLHC_CLICK_THS_A 0x3A"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1495:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1265:
+	.string	"CMS "
+.LASF2230:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1796:
+	.string	"LSM303DLHC_OUT_X_H_M 0x03"
+.LASF1593:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2328:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2221:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2284:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF2136:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF2356:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2552:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2571:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1453:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF2295:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1872:
+	.string	"LSM303DLHC_Z_LOW ((uint8_t)0x10)"
+.LASF1963:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1733:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1893:
+	.string	"LSM303DLHC_ODR_75_HZ ((uint8_t) 0x18)"
+.LASF1737:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1822:
+	.string	"LSM303DLHC_Y_ENABLE ((uint8_t)0x02)"
+.LASF2576:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1952:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2083:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF2407:
+	.string	"int32_t"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1844:
+	.string	"LSM303DLHC_HPFCF_32 ((uint8_t)0x20)"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2307:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1308:
+	.string	"BARO "
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1971:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2139:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF2584:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2278:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1995:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2044:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1945:
+	.string	"BITS_DLPF_CFG_98HZ 0x02"
+.LASF2048:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2079:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1842:
+	.string	"LSM303DLHC_HPFCF_8 ((uint8_t)0x00)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF2377:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF2151:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2124:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1554:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2573:
+	.string	"OWNER_BARO_EXTI"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF2070:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"LSM303DLHC_I2C_SDA_PIN PB7"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1944:
+	.string	"BITS_DLPF_CFG_188HZ 0x01"
+.LASF1875:
+	.string	"LSM303DLHC_X_HIGH ((uint8_t)0x02)"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF2710:
+	.string	"gyroSensorBus"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2143:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2004:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2360:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2649:
+	.string	"values"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1981:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2551:
+	.string	"OWNER_SERIAL_TX"
+.LASF1851:
+	.string	"LSM303DLHC_HPF_AOI1_ENABLE ((uint8_t)0x01)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1492:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1552:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2057:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2445:
+	.string	"PGR_SIZE_MASK"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1928:
+	.string	"MPU6500_WHO_AM_I_CONST (0x70)"
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1915:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_8_1Ga 205"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF1701:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2229:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2594:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1753:
+	.string	"LSM303DLHC_OK ((uint32_t) 0)"
+.LASF1741:
+	.string	"__cleanup_fct_attribute "
+.LASF2528:
+	.string	"__owner"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2315:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF2272:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1867:
+	.string	"LSM303DLHC_OR_COMBINATION ((uint8_t)0x00)"
+.LASF2741:
+	.string	"resetRollAndPitchTrims"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF2427:
+	.string	"DEBUG_VELOCITY"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF2371:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1904:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_2_5Ga 670"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF1676:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2141:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1589:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF2258:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF1565:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF2635:
+	.string	"BEEPER_PREFERENCE"
+.LASF2112:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"SCHED_RR 2"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2574:
+	.string	"OWNER_USB"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF2149:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2484:
+	.string	"ADCRaw"
+.LASF2728:
+	.string	"saveConfigAndNotify"
+.LASF2486:
+	.string	"dataReady"
+.LASF1765:
+	.string	"LSM303DLHC_CTRL_REG3_A 0x22"
+.LASF398:
+	.string	"false 0"
+.LASF2586:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1448:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2271:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1865:
+	.string	"LSM303DLHC_IT2_ACT ((uint8_t)0x08)"
+.LASF2526:
+	.string	"__lock"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1903:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_9Ga 855"
+.LASF1888:
+	.string	"LSM303DLHC_ODR_1_5_HZ ((uint8_t) 0x04)"
+.LASF1708:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF1959:
+	.string	"IOCFG_AF_PP 0"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2131:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1974:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1450:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2306:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2376:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2524:
+	.string	"__pthread_list_t"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2660:
+	.string	"ACC_ADXL345"
+.LASF2065:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2202:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1746:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2611:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1467:
+	.string	"PG_PID_PROFILE 14"
+.LASF2186:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2491:
+	.string	"sensorAccReadFuncPtr"
+.LASF1817:
+	.string	"LSM303DLHC_ODR_200_HZ ((uint8_t)0x60)"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF2734:
+	.string	"accDetect"
+.LASF1909:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_3Ga 980"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF2142:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF2598:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2653:
+	.string	"SENSOR_BARO"
+.LASF2500:
+	.string	"MPU_NONE"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2170:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF2241:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2556:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2281:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2595:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2147:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1484:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1528:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2685:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1543:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1972:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2544:
+	.string	"OWNER_SERVO"
+.LASF1830:
+	.string	"LSM303DLHC_FULLSCALE_8G ((uint8_t)0x20)"
+.LASF1302:
+	.string	"ACC "
+.LASF2515:
+	.string	"mpu6050Resolution_e"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1879:
+	.string	"LSM303DLHC_Y_DOUBLE_CLICK ((uint8_t)0x08)"
+.LASF1559:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2702:
+	.string	"beeper"
+.LASF1466:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF2615:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF2625:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1979:
+	.string	"PP_IIF_0(t,f) f"
+.LASF1744:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF1940:
+	.string	"ICM20689_WHO_AM_I_CONST (0x98)"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF2038:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF2022:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2126:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2381:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2355:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2420:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF1421:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2382:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2252:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2470:
+	.string	"CW0_DEG"
+.LASF2674:
+	.string	"accelerationSensor_e"
+.LASF2644:
+	.string	"roll"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2089:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2389:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF2646:
+	.string	"flightDynamicsTrims_def_t"
+.LASF2399:
+	.string	"__int16_t"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1760:
+	.string	"LSM303DLHC_DRDY_PIN PE2"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2425:
+	.string	"DEBUG_NOTCH"
+.LASF2401:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1681:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1816:
+	.string	"LSM303DLHC_ODR_100_HZ ((uint8_t)0x50)"
+.LASF1604:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2543:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1823:
+	.string	"LSM303DLHC_Z_ENABLE ((uint8_t)0x04)"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2368:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2073:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1626:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2570:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2508:
+	.string	"ICM_20602_SPI"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF2473:
+	.string	"CW270_DEG"
+.LASF1832:
+	.string	"LSM303DLHC_BlockUpdate_Continous ((uint8_t)0x00)"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2078:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2234:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1712:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2176:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2607:
+	.string	"FEATURE_AIRMODE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF2084:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF2054:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1794:
+	.string	"LSM303DLHC_CRB_REG_M 0x01"
+.LASF2534:
+	.string	"__data"
+.LASF2324:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2119:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2173:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1629:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2638:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2283:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2656:
+	.string	"SENSOR_GPS"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2189:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2145:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1679:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1969:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1529:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1934:
+	.string	"MPU6500_BIT_RESET (0x80)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2701:
+	.string	"accelerometerConfig_Registry"
+.LASF2007:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2393:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1900:
+	.string	"LSM303DLHC_FS_5_6_GA ((uint8_t) 0xC0)"
+.LASF2023:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2590:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2740:
+	.string	"accResetRollAndPitchTrims"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1539:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1542:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1440:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2688:
+	.string	"accZero"
+.LASF2213:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2537:
+	.string	"pthread_mutex_t"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF1738:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF2589:
+	.string	"FEATURE_RX_SERIAL"
+.LASF2448:
+	.string	"biquadFilter_s"
+.LASF364:
+	.string	"__k8 1"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF2042:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1468:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF1611:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1615:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1929:
+	.string	"MPU9250_WHO_AM_I_CONST (0x71)"
+.LASF2412:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1463:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2538:
+	.string	"long long int"
+.LASF1803:
+	.string	"LSM303DLHC_IRA_REG_M 0x0A"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2321:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1778:
+	.string	"LSM303DLHC_FIFO_SRC_REG_A 0x2F"
+.LASF1659:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF2177:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1734:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1569:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2127:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1519:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF1627:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1970:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2095:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF1958:
+	.string	"IOCFG_OUT_OD 0"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1798:
+	.string	"LSM303DLHC_OUT_Z_H_M 0x05"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2104:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2449:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2722:
+	.string	"performInflightAccelerationCalibration"
+.LASF2592:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1430:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1814:
+	.string	"LSM303DLHC_ODR_25_HZ ((uint8_t)0x30)"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1573:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2435:
+	.string	"DEBUG_ALTITUDE"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2469:
+	.string	"ALIGN_DEFAULT"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1417:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1545:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1572:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF1728:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2076:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1871:
+	.string	"LSM303DLHC_Z_HIGH ((uint8_t)0x20)"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1922:
+	.string	"MPU3050_DLPF_FS_SYNC 0x16"
+.LASF2487:
+	.string	"lock"
+.LASF1480:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF2582:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2512:
+	.string	"mpuSensor_e"
+.LASF1756:
+	.string	"LSM303DLHC_LONG_TIMEOUT ((uint32_t)(10 * LSM303DLHC_FLAG_TIMEOUT))"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1613:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2530:
+	.string	"__kind"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1640:
+	.string	"_SCHED_H 1"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1530:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1470:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2613:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF2675:
+	.string	"acc_s"
+.LASF2679:
+	.string	"acc_t"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2391:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2624:
+	.string	"BEEPER_RX_SET"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF2353:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2110:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1730:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1582:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2231:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2502:
+	.string	"MPU_60x0"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2088:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2565:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1588:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2327:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2021:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1891:
+	.string	"LSM303DLHC_ODR_15_HZ ((uint8_t) 0x10)"
+.LASF1797:
+	.string	"LSM303DLHC_OUT_X_L_M 0x04"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2633:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1878:
+	.string	"LSM303DLHC_Z_SINGLE_CLICK ((uint8_t)0x10)"
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2148:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2212:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2489:
+	.string	"mpuDetectionResult"
+.LASF1724:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1570:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1949:
+	.string	"mpu9250_CONFIG 0x1A"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2115:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2132:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"__timer_t_defined 1"
+.LASF2429:
+	.string	"DEBUG_ANGLERATE"
+.LASF1755:
+	.string	"LSM303DLHC_FLAG_TIMEOUT ((uint32_t)0x1000)"
+.LASF2061:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF2503:
+	.string	"MPU_60x0_SPI"
+.LASF1899:
+	.string	"LSM303DLHC_FS_4_7_GA ((uint8_t) 0xA0)"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2443:
+	.string	"PGR_PGN_MASK"
+.LASF2226:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2123:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2261:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2609:
+	.string	"FEATURE_RX_SPI"
+.LASF1764:
+	.string	"LSM303DLHC_CTRL_REG2_A 0x21"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1719:
+	.string	"____sigset_t_defined "
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2347:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2276:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2378:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF2415:
+	.string	"debug"
+.LASF1546:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1837:
+	.string	"LSM303DLHC_BOOT_REBOOTMEMORY ((uint8_t)0x80)"
+.LASF2359:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2666:
+	.string	"ACC_MPU6500"
+.LASF1500:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1639:
+	.string	"_PTHREAD_H 1"
+.LASF1526:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2440:
+	.string	"test"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2013:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1874:
+	.string	"LSM303DLHC_Y_LOW ((uint8_t)0x04)"
+.LASF1567:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2318:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"LSM303DLHC_LOWPOWER_MODE ((uint8_t)0x08)"
+.LASF2164:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2299:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1948:
+	.string	"MPU6000_WHO_AM_I_CONST (0x68)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1551:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1804:
+	.string	"LSM303DLHC_IRB_REG_M 0x0B"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1632:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1791:
+	.string	"LSM303DLHC_TIME_LATENCY_A 0x3C"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2575:
+	.string	"OWNER_USB_DETECT"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2308:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF2535:
+	.string	"__size"
+.LASF1605:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2450:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1866:
+	.string	"LSM303DLHC_IT2_HLACTIVE ((uint8_t)0x02)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2639:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2056:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1510:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2496:
+	.string	"writeFn"
+.LASF2713:
+	.string	"fakeAccDetect"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2636:
+	.string	"beeperMode_e"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1633:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1840:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE ((uint8_t)0x80)"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF2217:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF1877:
+	.string	"LSM303DLHC_Z_DOUBLE_CLICK ((uint8_t)0x20)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2351:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2602:
+	.string	"FEATURE_DASHBOARD"
+.LASF1558:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1438:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2432:
+	.string	"DEBUG_STACK"
+.LASF2579:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2411:
+	.string	"size_t"
+.LASF1685:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2560:
+	.string	"OWNER_SPI_MOSI"
+.LASF2125:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2330:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2527:
+	.string	"__count"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2005:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF2408:
+	.string	"uint8_t"
+.LASF1805:
+	.string	"LSM303DLHC_IRC_REG_M 0x0C"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2559:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2006:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2091:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2118:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2169:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1709:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1976:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1426:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF2640:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2159:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF2516:
+	.string	"mpuDetectionResult_s"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1590:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF2709:
+	.string	"gyroMpuConfiguration"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1725:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2201:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1824:
+	.string	"LSM303DLHC_AXES_ENABLE ((uint8_t)0x07)"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF2730:
+	.string	"accSetCalibrationCycles"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2384:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2031:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2668:
+	.string	"ACC_ICM20601"
+.LASF2669:
+	.string	"ACC_ICM20602"
+.LASF1591:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1898:
+	.string	"LSM303DLHC_FS_4_0_GA ((uint8_t) 0x80)"
+.LASF1537:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2269:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2655:
+	.string	"SENSOR_SONAR"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2647:
+	.string	"busDevice_u"
+.LASF1739:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2182:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2588:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF2627:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1710:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF2135:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF2207:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF1306:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2676:
+	.string	"accSamplingInterval"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2242:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF2699:
+	.string	"accLpfCutHz"
+.LASF2572:
+	.string	"OWNER_MPU_EXTI"
+.LASF1664:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2157:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1996:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2542:
+	.string	"OWNER_PPMINPUT"
+.LASF2720:
+	.string	"rollAndPitchTrims"
+.LASF1961:
+	.string	"IOCFG_IPD 0"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1657:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1868:
+	.string	"LSM303DLHC_AND_COMBINATION ((uint8_t)0x80)"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1429:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2343:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2714:
+	.string	"axis"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1488:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF2286:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1856:
+	.string	"LSM303DLHC_IT1_AOI2 ((uint8_t)0x20)"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1606:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2354:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2301:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1516:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2113:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2150:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2223:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2729:
+	.string	"isAccelerationCalibrationComplete"
+.LASF1514:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2053:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2114:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1978:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1524:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1445:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1483:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1847:
+	.string	"LSM303DLHC_HIGHPASSFILTER_ENABLE ((uint8_t)0x08)"
+.LASF1547:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1852:
+	.string	"LSM303DLHC_HPF_AOI2_DISABLE ((uint8_t)0x00)"
+.LASF2154:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1873:
+	.string	"LSM303DLHC_Y_HIGH ((uint8_t)0x08)"
+.LASF1645:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2464:
+	.string	"instance"
+.LASF2521:
+	.string	"__pthread_internal_list"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2011:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2198:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2216:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1425:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF2522:
+	.string	"__prev"
+.LASF2121:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2365:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2436:
+	.string	"DEBUG_FFT"
+.LASF1527:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF2260:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1957:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF2742:
+	.string	"accelerometerConfigMutable"
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF1924:
+	.string	"MPU3050_TEMP_OUT 0x1B"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2034:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2305:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1964:
+	.string	"NOOP do {} while (0)"
+.LASF2422:
+	.string	"DEBUG_MIXER"
+.LASF2030:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2723:
+	.string	"accZero_saved"
+.LASF1729:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1439:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2605:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1951:
+	.string	"SPIDEV_COUNT 4"
+.LASF1923:
+	.string	"MPU3050_INT_CFG 0x17"
+.LASF1697:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1950:
+	.string	"MPU9250_BIT_RESET (0x80)"
+.LASF1751:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1926:
+	.string	"MPU3050_USER_CTRL 0x3D"
+.LASF2000:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2672:
+	.string	"ACC_BMI160"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF1880:
+	.string	"LSM303DLHC_Y_SINGLE_CLICK ((uint8_t)0x04)"
+.LASF2247:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1553:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1525:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2652:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1427:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2555:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1653:
+	.string	"SCHED_OTHER 0"
+.LASF2451:
+	.string	"address"
+.LASF2457:
+	.string	"I2CDEV_1"
+.LASF1977:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1776:
+	.string	"LSM303DLHC_OUT_Z_H_A 0x2D"
+.LASF1808:
+	.string	"ACC_I2C_ADDRESS 0x32"
+.LASF2245:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1889:
+	.string	"LSM303DLHC_ODR_3_0_HZ ((uint8_t) 0x08)"
+.LASF1955:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF1564:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2643:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1962:
+	.string	"IOCFG_IPU 0"
+.LASF2160:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1723:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF721:
+	.string	"NULL"
+.LASF2735:
+	.string	"accHardwareToUse"
+.LASF1652:
+	.string	"_BITS_SCHED_H 1"
+.LASF2608:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1686:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF1717:
+	.string	"__have_pthread_attr_t 1"
+.LASF2645:
+	.string	"pitch"
+.LASF719:
+	.string	"__size_t "
+.LASF2557:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1810:
+	.string	"LSM303DLHC_NORMAL_MODE ((uint8_t)0x00)"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1501:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2086:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF2010:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2290:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2662:
+	.string	"ACC_MMA8452"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF2630:
+	.string	"BEEPER_ARMED"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1707:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1754:
+	.string	"LSM303DLHC_FAIL ((uint32_t) 0)"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1762:
+	.string	"LSM303DLHC_I2C_INT2_PIN PE5"
+.LASF1965:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1574:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2504:
+	.string	"MPU_65xx_I2C"
+.LASF2724:
+	.string	"angleTrim_saved"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1502:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2344:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1864:
+	.string	"LSM303DLHC_IT2_BOOT ((uint8_t)0x10)"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2510:
+	.string	"ICM_20689_SPI"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2092:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2385:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2174:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF2240:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2446:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2291:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1460:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1839:
+	.string	"LSM303DLHC_HPM_REF_SIGNAL ((uint8_t)0x40)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF2694:
+	.string	"AccInflightCalibrationMeasurementDone"
+.LASF1855:
+	.string	"LSM303DLHC_IT1_AOI1 ((uint8_t)0x40)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2547:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1768:
+	.string	"LSM303DLHC_CTRL_REG6_A 0x25"
+.LASF2303:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1420:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF2040:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF2419:
+	.string	"DEBUG_BATTERY"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1433:
+	.string	"UNIT_TESTED "
+.LASF2704:
+	.string	"feature"
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2239:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1704:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1858:
+	.string	"LSM303DLHC_IT1_DRY2 ((uint8_t)0x08)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF2228:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF1933:
+	.string	"ICM20608G_WHO_AM_I_CONST (0xAF)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF2610:
+	.string	"FEATURE_SOFTSPI"
+.LASF2063:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1938:
+	.string	"MPU6500_BIT_RAW_RDY_EN (1 << 0)"
+.LASF2494:
+	.string	"mpuResetFnPtr"
+.LASF1702:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1451:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2744:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1454:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1927:
+	.string	"MPU3050_PWR_MGM 0x3E"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1561:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1443:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF2650:
+	.string	"flightDynamicsTrims_t"
+.LASF2648:
+	.string	"flightDynamicsTrims_u"
+.LASF1819:
+	.string	"LSM303DLHC_ODR_1620_HZ_LP ((uint8_t)0x80)"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2711:
+	.string	"memset"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1535:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2695:
+	.string	"AccInflightCalibrationSavetoEEProm"
+.LASF2039:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2085:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2311:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2052:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1706:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1669:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1835:
+	.string	"LSM303DLHC_BLE_MSB ((uint8_t)0x40)"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1792:
+	.string	"LSM303DLHC_TIME_WINDOW_A 0x3D"
+.LASF2152:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2671:
+	.string	"ACC_ICM20689"
+.LASF1784:
+	.string	"LSM303DLHC_INT2_SOURCE_A 0x35"
+.LASF1848:
+	.string	"LSM303DLHC_HPF_CLICK_DISABLE ((uint8_t)0x00)"
+.LASF2248:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2163:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF2134:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1696:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2523:
+	.string	"__next"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1691:
+	.string	"__clockid_t_defined 1"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2018:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1703:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF2696:
+	.string	"AccInflightCalibrationActive"
+.LASF1416:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2678:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF2634:
+	.string	"BEEPER_ALL"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2614:
+	.string	"BEEPER_SILENCE"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1870:
+	.string	"LSM303DLHC_POS_RECOGNITION ((uint8_t)0xC0)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF1625:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1598:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2161:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2492:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF1876:
+	.string	"LSM303DLHC_X_LOW ((uint8_t)0x01)"
+.LASF2743:
+	.string	"accelerometerConfig"
+.LASF2520:
+	.string	"long long unsigned int"
+.LASF1461:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1595:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2622:
+	.string	"BEEPER_BAT_LOW"
+.LASF1773:
+	.string	"LSM303DLHC_OUT_Y_L_A 0x2A"
+.LASF2532:
+	.string	"__elision"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2466:
+	.string	"deviceI2C_s"
+.LASF2563:
+	.string	"OWNER_SDCARD"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF1599:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1556:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1896:
+	.string	"LSM303DLHC_FS_1_9_GA ((uint8_t) 0x40)"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1790:
+	.string	"LSM303DLHC_TIME_LIMIT_A 0x3B"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1638:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2071:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2406:
+	.string	"int16_t"
+.LASF2100:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF2348:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2243:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2397:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1437:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2417:
+	.string	"DEBUG_NONE"
+.LASF2363:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF2493:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1469:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2482:
+	.string	"readFn"
+.LASF1954:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1641:
+	.string	"__time_t_defined 1"
+.LASF2600:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1560:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1517:
+	.string	"PG_PID_CONFIG 504"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1736:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1986:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1435:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1809:
+	.string	"MAG_I2C_ADDRESS 0x3C"
+.LASF2254:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2338:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2375:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1716:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2618:
+	.string	"BEEPER_DISARMING"
+.LASF2667:
+	.string	"ACC_MPU9250"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1772:
+	.string	"LSM303DLHC_OUT_X_H_A 0x29"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1786:
+	.string	"LSM303DLHC_INT2_DURATION_A 0x37"
+.LASF2421:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1695:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1747:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1984:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF2390:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF1779:
+	.string	"LSM303DLHC_INT1_CFG_A 0x30"
+.LASF1612:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2706:
+	.string	"biquadFilterApply"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1841:
+	.string	"LSM303DLHC_HPM_AUTORESET_INT ((uint8_t)0xC0)"
+.LASF1477:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2256:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF2485:
+	.string	"revisionCode"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2172:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1700:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2745:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2197:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2684:
+	.string	"accelerometerConfig_s"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1481:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1694:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1887:
+	.string	"LSM303DLHC_ODR_0_75_HZ ((uint8_t) 0x00)"
+.LASF1918:
+	.string	"LSM303DLHC_SLEEP ((uint8_t) 0x02)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2292:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1743:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1536:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2577:
+	.string	"OWNER_OSD"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1732:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1727:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF2263:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2346:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2444:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2312:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1486:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2506:
+	.string	"MPU_9250_SPI"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2014:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2158:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2383:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2438:
+	.string	"DEBUG_FFT_FREQ"
+.LASF2739:
+	.string	"accResetFlightDynamicsTrims"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1994:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2205:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2481:
+	.string	"initFn"
+.LASF1418:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF2721:
+	.string	"applyAccelerationTrims"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF1620:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2103:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2215:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2727:
+	.string	"isOnFinalAccelerationCalibrationCycle"
+.LASF2289:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1777:
+	.string	"LSM303DLHC_FIFO_CTRL_REG_A 0x2E"
+.LASF2020:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1863:
+	.string	"LSM303DLHC_IT2_INT2 ((uint8_t)0x20)"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1617:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2218:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF2603:
+	.string	"FEATURE_OSD"
+.LASF2670:
+	.string	"ACC_ICM20608G"
+.LASF1506:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1285:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1914:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_5_6Ga 295"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1988:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2001:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2404:
+	.string	"long int"
+.LASF2108:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1473:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2120:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1921:
+	.string	"MPU3050_SMPLRT_DIV 0x15"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2458:
+	.string	"I2CDEV_2"
+.LASF2459:
+	.string	"I2CDEV_3"
+.LASF2460:
+	.string	"I2CDEV_4"
+.LASF1518:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1637:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1750:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2553:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2335:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1911:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_2_5Ga 600"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1829:
+	.string	"LSM303DLHC_FULLSCALE_4G ((uint8_t)0x10)"
+.LASF1668:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1795:
+	.string	"LSM303DLHC_MR_REG_M 0x02"
+.LASF2105:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF515:
+	.string	"__always_inline"
+.LASF2726:
+	.string	"isOnFirstAccelerationCalibrationCycle"
+.LASF2380:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF2686:
+	.string	"acc_align"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF2431:
+	.string	"DEBUG_SCHEDULER"
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1531:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2062:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2657:
+	.string	"SENSOR_GPSMAG"
+.LASF2075:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2705:
+	.string	"lrintf"
+.LASF2232:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF1642:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2166:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1854:
+	.string	"LSM303DLHC_IT1_CLICK ((uint8_t)0x80)"
+.LASF1667:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF1690:
+	.string	"__struct_tm_defined 1"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1683:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2024:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1464:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1722:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2026:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2128:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF2032:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1967:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1575:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1975:
+	.string	"EXPAND_I(x) x"
+.LASF1452:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF2194:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2687:
+	.string	"acc_hardware"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2410:
+	.string	"uint32_t"
+.LASF1636:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2673:
+	.string	"ACC_FAKE"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF1774:
+	.string	"LSM303DLHC_OUT_Y_H_A 0x2B"
+.LASF1983:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2309:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1689:
+	.string	"__clock_t_defined 1"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1825:
+	.string	"LSM303DLHC_AXES_DISABLE ((uint8_t)0x00)"
+.LASF2209:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2273:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2467:
+	.string	"device"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2208:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1726:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF2069:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1892:
+	.string	"LSM303DLHC_ODR_30_HZ ((uint8_t) 0x14)"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2236:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2692:
+	.string	"accelerometerConfig_Copy"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2293:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF2717:
+	.string	"initialAccLpfCutHz"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2279:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1674:
+	.string	"_TIME_H 1"
+.LASF2225:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1680:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1937:
+	.string	"MPU6500_BIT_INT_ANYRD_2CLEAR (1 << 4)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1434:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1496:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2416:
+	.string	"debugMode"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF1541:
+	.string	"IO_TAG_NONE 0"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1456:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1910:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_9Ga 760"
+.LASF1609:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2193:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF2554:
+	.string	"OWNER_TIMER"
+.LASF2480:
+	.string	"accDev_s"
+.LASF2539:
+	.string	"accDev_t"
+.LASF2191:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1497:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2483:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2314:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1801:
+	.string	"LSM303DLHC_OUT_Y_L_M 0x08"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1956:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1785:
+	.string	"LSM303DLHC_INT2_THS_A 0x36"
+.LASF2270:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF2129:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2302:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1820:
+	.string	"LSM303DLHC_ODR_1344_HZ ((uint8_t)0x90)"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1549:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF2703:
+	.string	"alignSensors"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1614:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1688:
+	.string	"TIMER_ABSTIME 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF2352:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2364:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1833:
+	.string	"LSM303DLHC_BlockUpdate_Single ((uint8_t)0x80)"
+.LASF2224:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1843:
+	.string	"LSM303DLHC_HPFCF_16 ((uint8_t)0x10)"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2531:
+	.string	"__spins"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2455:
+	.string	"IO_t"
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2691:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1990:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2529:
+	.string	"__nusers"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1563:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1540:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2227:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1846:
+	.string	"LSM303DLHC_HIGHPASSFILTER_DISABLE ((uint8_t)0x00)"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2566:
+	.string	"OWNER_FLASH_CS"
+.LASF1718:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF2203:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1968:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF397:
+	.string	"true 1"
+.LASF1597:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2111:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF1634:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2663:
+	.string	"ACC_BMA280"
+.LASF2178:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2388:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1838:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE_RES ((uint8_t)0x00)"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2424:
+	.string	"DEBUG_PIDLOOP"
+.LASF2452:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1520:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2507:
+	.string	"ICM_20601_SPI"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1571:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2731:
+	.string	"calibrationCyclesRequired"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1818:
+	.string	"LSM303DLHC_ODR_400_HZ ((uint8_t)0x70)"
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF1783:
+	.string	"LSM303DLHC_INT2_CFG_A 0x34"
+.LASF2051:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1489:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1699:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1731:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF2476:
+	.string	"CW180_DEG_FLIP"
+.LASF1885:
+	.string	"LSM303DLHC_INT1INTERRUPT_LOW_EDGE ((uint8_t)0x20)"
+.LASF2331:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2715:
+	.string	"setAccelerationFilter"
+.LASF1973:
+	.string	"STR_HELPER(x) #x"
+.LASF1715:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2155:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1687:
+	.string	"CLOCK_TAI 11"
+.LASF2591:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1850:
+	.string	"LSM303DLHC_HPF_AOI1_DISABLE ((uint8_t)0x00)"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1494:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2558:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2550:
+	.string	"OWNER_ADC_RSSI"
+.LASF1431:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2266:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2165:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1666:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2479:
+	.string	"sensorAccInitFuncPtr"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2204:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1677:
+	.string	"CLOCK_REALTIME 0"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1992:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2077:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2456:
+	.string	"I2CINVALID"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF2631:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF1678:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2719:
+	.string	"accUpdate"
+.LASF2604:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1906:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4_7Ga 400"
+.LASF2282:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1532:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF2280:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2441:
+	.string	"biquadFilter_t"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2310:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2246:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2616:
+	.string	"BEEPER_RX_LOST"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2192:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1905:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4Ga 450"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2162:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2428:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2341:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2206:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF2501:
+	.string	"MPU_3050"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1713:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2471:
+	.string	"CW90_DEG"
+.LASF2259:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1693:
+	.string	"__itimerspec_defined 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2478:
+	.string	"sensor_align_e"
+.LASF2287:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2025:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2693:
+	.string	"InflightcalibratingA"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2349:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1882:
+	.string	"LSM303DLHC_X_SINGLE_CLICK ((uint8_t)0x01)"
+.LASF2107:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF2681:
+	.string	"rollAndPitchTrims_t_def"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1836:
+	.string	"LSM303DLHC_BOOT_NORMALMODE ((uint8_t)0x00)"
+.LASF1471:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2423:
+	.string	"DEBUG_AIRMODE"
+.LASF1648:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1821:
+	.string	"LSM303DLHC_X_ENABLE ((uint8_t)0x01)"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2175:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1412:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2181:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2098:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1507:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1980:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1447:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1987:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2372:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2418:
+	.string	"DEBUG_CYCLETIME"
+.LASF2433:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF2068:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2465:
+	.string	"csnPin"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF2214:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF2257:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2413:
+	.string	"double"
+.LASF1763:
+	.string	"LSM303DLHC_CTRL_REG1_A 0x20"
+.LASF2002:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF2033:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1577:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1953:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2087:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2561:
+	.string	"OWNER_I2C_SCL"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1849:
+	.string	"LSM303DLHC_HPF_CLICK_ENABLE ((uint8_t)0x04)"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2583:
+	.string	"OWNER_COMPASS_CS"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF2700:
+	.string	"accFilter"
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF2168:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1649:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1457:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2599:
+	.string	"FEATURE_RX_MSP"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2097:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1742:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF2593:
+	.string	"FEATURE_GPS"
+.LASF1449:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2332:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2690:
+	.string	"accelerometerConfig_t"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2387:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1534:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1705:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2402:
+	.string	"__int32_t"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2562:
+	.string	"OWNER_I2C_SDA"
+.LASF2403:
+	.string	"__uint32_t"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1424:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1603:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1583:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2601:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1474:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1608:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2468:
+	.string	"busDevice_t"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2511:
+	.string	"BMI_160_SPI"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2437:
+	.string	"DEBUG_FFT_TIME"
+.LASF1616:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2313:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2074:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1476:
+	.string	"PG_RX_CONFIG 24"
+.LASF1503:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1482:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1441:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2027:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1883:
+	.string	"LSM303DLHC_INT1INTERRUPT_DISABLE ((uint8_t)0x00)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2183:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2733:
+	.string	"gyroSamplingInverval"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2195:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2725:
+	.string	"performAcclerationCalibration"
+.LASF2081:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF1650:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF2439:
+	.string	"DEBUG_COUNT"
+.LASF2122:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2350:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2080:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1943:
+	.string	"BITS_DLPF_CFG_256HZ 0x00"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1947:
+	.string	"GYRO_SCALE_FACTOR 0.00053292f"
+.LASF2253:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1757:
+	.string	"LSM303DLHC_I2C I2C1"
+.LASF1646:
+	.string	"__PDP_ENDIAN 3412"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF1999:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1861:
+	.string	"LSM303DLHC_IT2_CLICK ((uint8_t)0x80)"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF2366:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2367:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1966:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2146:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2244:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2621:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1799:
+	.string	"LSM303DLHC_OUT_Z_L_M 0x06"
+.LASF1479:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1782:
+	.string	"LSM303DLHC_INT1_DURATION_A 0x33"
+.LASF2099:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2474:
+	.string	"CW0_DEG_FLIP"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1684:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2184:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2578:
+	.string	"OWNER_RX_BIND"
+.LASF1508:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2255:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2581:
+	.string	"OWNER_TRANSPONDER"
+.LASF1475:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1936:
+	.string	"MPU6500_BIT_BYPASS_EN (1 << 1)"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2392:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1602:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1635:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2101:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2677:
+	.string	"accSmooth"
+.LASF1806:
+	.string	"LSM303DLHC_TEMP_OUT_H_M 0x31"
+.LASF2047:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1807:
+	.string	"LSM303DLHC_TEMP_OUT_L_M 0x32"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2019:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2167:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2514:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1428:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF1660:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2698:
+	.string	"accelerationTrims"
+.LASF1661:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF2414:
+	.string	"SPI_TypeDef"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2665:
+	.string	"ACC_MPU6000"
+.LASF2746:
+	.string	"retry"
+.LASF1788:
+	.string	"LSM303DLHC_CLICK_SOURCE_A 0x39"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2055:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2067:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2654:
+	.string	"SENSOR_MAG"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1511:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2251:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2442:
+	.string	"pgn_t"
+.LASF1942:
+	.string	"MPU6000_CONFIG 0x1A"
+.LASF1522:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1770:
+	.string	"LSM303DLHC_STATUS_REG_A 0x27"
+.LASF1735:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2130:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF2707:
+	.string	"biquadFilterInitLPF"
+.LASF1913:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4_7Ga 355"
+.LASF1581:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF2533:
+	.string	"__list"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2632:
+	.string	"BEEPER_USB"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2426:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF2626:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2490:
+	.string	"mpuConfiguration"
+.LASF2617:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2405:
+	.string	"char"
+.LASF1941:
+	.string	"ICM20689_BIT_RESET (0x80)"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1787:
+	.string	"LSM303DLHC_CLICK_CFG_A 0x38"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2200:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2680:
+	.string	"rollAndPitchTrims_s"
+.LASF2683:
+	.string	"rollAndPitchTrims_t"
+.LASF2682:
+	.string	"rollAndPitchTrims_u"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF2138:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF1533:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1901:
+	.string	"LSM303DLHC_FS_8_1_GA ((uint8_t) 0xE0)"
+.LASF2316:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1647:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2518:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1544:
+	.string	"I2CDEV_COUNT 4"
+.LASF1458:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1916:
+	.string	"LSM303DLHC_CONTINUOS_CONVERSION ((uint8_t) 0x00)"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2274:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1800:
+	.string	"LSM303DLHC_OUT_Y_H_M 0x07"
+.LASF1908:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_8_1Ga 230"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1989:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2179:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1925:
+	.string	"MPU3050_GYRO_OUT 0x1D"
+.LASF2153:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2144:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2540:
+	.string	"OWNER_FREE"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1831:
+	.string	"LSM303DLHC_FULLSCALE_16G ((uint8_t)0x30)"
+.LASF2035:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1596:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2430:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1419:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2106:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1568:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2187:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2090:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1538:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2541:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1675:
+	.string	"_BITS_TIME_H 1"
+.LASF1745:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1550:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1857:
+	.string	"LSM303DLHC_IT1_DRY1 ((uint8_t)0x10)"
+.LASF1884:
+	.string	"LSM303DLHC_INT1INTERRUPT_ENABLE ((uint8_t)0x80)"
+.LASF2072:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1862:
+	.string	"LSM303DLHC_IT2_INT1 ((uint8_t)0x40)"
+.LASF1579:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF2156:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2220:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1576:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1432:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1654:
+	.string	"SCHED_FIFO 1"
+.LASF1670:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1423:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1671:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1793:
+	.string	"LSM303DLHC_CRA_REG_M 0x00"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF2050:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1845:
+	.string	"LSM303DLHC_HPFCF_64 ((uint8_t)0x30)"
+.LASF1619:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1890:
+	.string	"LSM303DLHC_ODR_7_5_HZ ((uint8_t) 0x0C)"
+.LASF1902:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_3Ga 1100"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF2664:
+	.string	"ACC_LSM303DLHC"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1557:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF2058:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1698:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1548:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1769:
+	.string	"LSM303DLHC_REFERENCE_A 0x26"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1766:
+	.string	"LSM303DLHC_CTRL_REG4_A 0x23"
+.LASF2009:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1919:
+	.string	"LSM303DLHC_TEMPSENSOR_ENABLE ((uint8_t) 0x80)"
+.LASF2509:
+	.string	"ICM_20608_SPI"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1781:
+	.string	"LSM303DLHC_INT1_THS_A 0x32"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2498:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1490:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2037:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2659:
+	.string	"ACC_NONE"
+.LASF1920:
+	.string	"LSM303DLHC_TEMPSENSOR_DISABLE ((uint8_t) 0x00)"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1815:
+	.string	"LSM303DLHC_ODR_50_HZ ((uint8_t)0x40)"
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1720:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2597:
+	.string	"FEATURE_3D"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1462:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2564:
+	.string	"OWNER_SDCARD_CS"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2267:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2434:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF2137:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"LSM303DLHC_SR_REG_M 0x09"
+.LASF2277:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1578:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF2708:
+	.string	"gyroMpuDetectionResult"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1621:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF377:
+	.string	"__linux 1"
+.LASF2651:
+	.string	"SENSOR_GYRO"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF1600:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1622:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1998:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2661:
+	.string	"ACC_MPU6050"
+.LASF1711:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2029:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2003:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1623:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2336:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1935:
+	.string	"MPU6500_BIT_RESERVED (1 << 0)"
+.LASF2222:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1826:
+	.string	"LSM303DLHC_HR_ENABLE ((uint8_t)0x08)"
+.LASF2116:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1485:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1749:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2505:
+	.string	"MPU_65xx_SPI"
+.LASF1631:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1827:
+	.string	"LSM303DLHC_HR_DISABLE ((uint8_t)0x00)"
+.LASF1587:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2060:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1523:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2585:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF2517:
+	.string	"sensor"
+.LASF2233:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1714:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2093:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF2396:
+	.string	"long unsigned int"
+.LASF1991:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2580:
+	.string	"OWNER_LED_STRIP"
+.LASF2250:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2519:
+	.string	"mpuDetectionResult_t"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2190:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF2041:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1740:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1859:
+	.string	"LSM303DLHC_IT1_WTM ((uint8_t)0x04)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2235:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2358:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1566:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2641:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1912:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4Ga 400"
+.LASF2400:
+	.string	"short int"
+.LASF2736:
+	.string	"accHardware"
+.LASF1493:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1594:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1665:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2185:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2238:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1504:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1624:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1812:
+	.string	"LSM303DLHC_ODR_1_HZ ((uint8_t)0x10)"
+.LASF2697:
+	.string	"calibratingA"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2513:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF2211:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF2620:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF1444:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2737:
+	.string	"pgResetFn_accelerometerConfig"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2017:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1562:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2567:
+	.string	"OWNER_BARO_CS"
+.LASF2171:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF2619:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF2447:
+	.string	"pgResetFunc"
+.LASF1513:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2059:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2568:
+	.string	"OWNER_MPU_CS"
+.LASF1897:
+	.string	"LSM303DLHC_FS_2_5_GA ((uint8_t) 0x60)"
+.LASF1584:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2395:
+	.string	"unsigned int"
+.LASF2637:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF2219:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2369:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2362:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1993:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2262:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1586:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2612:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF2300:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2082:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1946:
+	.string	"BITS_DLPF_CFG_42HZ 0x03"
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1521:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2237:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2546:
+	.string	"OWNER_ADC"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2488:
+	.string	"accAlign"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF2454:
+	.string	"pgRegistry_t"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2658:
+	.string	"ACC_DEFAULT"
+.LASF2322:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2370:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF2339:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2268:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF2285:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1465:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1828:
+	.string	"LSM303DLHC_FULLSCALE_2G ((uint8_t)0x00)"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1813:
+	.string	"LSM303DLHC_ODR_10_HZ ((uint8_t)0x20)"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2102:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF2036:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2549:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2117:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2340:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1512:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2323:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2472:
+	.string	"CW180_DEG"
+.LASF1761:
+	.string	"LSM303DLHC_I2C_INT1_PIN PE4"
+.LASF2199:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2569:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2326:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1442:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2718:
+	.string	"accelerationTrimsToUse"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF2109:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF2096:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2319:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1767:
+	.string	"LSM303DLHC_CTRL_REG5_A 0x24"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2342:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2337:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2374:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2869:
+	.string	"rx_pwm.h"
+.LASF2779:
+	.string	"thread-shared-types.h"
+.LASF2855:
+	.string	"accgyro_l3gd20.h"
+.LASF2860:
+	.string	"accgyro_mpu6500.h"
+.LASF2815:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2762:
+	.string	"/usr/include"
+.LASF2821:
+	.string	"mathcalls-helper-functions.h"
+.LASF2817:
+	.string	"floatn-common.h"
+.LASF2797:
+	.string	"stdint.h"
+.LASF2851:
+	.string	"pthread_stack_min.h"
+.LASF2747:
+	.string	"src/main/build"
+.LASF2759:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2796:
+	.string	"stdbool.h"
+.LASF2864:
+	.string	"accgyro_spi_mpu6500.h"
+.LASF2872:
+	.string	"io.h"
+.LASF2838:
+	.string	"time.h"
+.LASF2801:
+	.string	"wordsize.h"
+.LASF2837:
+	.string	"cpu-set.h"
+.LASF2775:
+	.string	"bus.h"
+.LASF2755:
+	.string	"src/main/target/SITL"
+.LASF2781:
+	.string	"pthreadtypes.h"
+.LASF2876:
+	.string	"sound_beeper.h"
+.LASF2827:
+	.string	"parameter_group_ids.h"
+.LASF2848:
+	.string	"__sigset_t.h"
+.LASF2758:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2798:
+	.string	"libc-header-start.h"
+.LASF2842:
+	.string	"timer_t.h"
+.LASF2849:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2822:
+	.string	"platform.h"
+.LASF2763:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2771:
+	.string	"filter.h"
+.LASF2782:
+	.string	"resource.h"
+.LASF2845:
+	.string	"atomic_wide_counter.h"
+.LASF2788:
+	.string	"boardalignment.h"
+.LASF0:
+	.string	"./src/main/sensors/acceleration.c"
+.LASF2841:
+	.string	"clockid_t.h"
+.LASF2769:
+	.string	"debug.h"
+.LASF2795:
+	.string	"stdc-predef.h"
+.LASF2777:
+	.string	"accgyro.h"
+.LASF2813:
+	.string	"math.h"
+.LASF2834:
+	.string	"endian.h"
+.LASF2828:
+	.string	"exti.h"
+.LASF2863:
+	.string	"accgyro_spi_mpu6000.h"
+.LASF2799:
+	.string	"features.h"
+.LASF2757:
+	.string	"src/main"
+.LASF2753:
+	.string	"src/main/io"
+.LASF2814:
+	.string	"math-vector.h"
+.LASF2847:
+	.string	"setjmp.h"
+.LASF2749:
+	.string	"src/main/config"
+.LASF2861:
+	.string	"accgyro_spi_bmi160.h"
+.LASF2865:
+	.string	"accgyro_spi_mpu9250.h"
+.LASF2843:
+	.string	"struct_itimerspec.h"
+.LASF2800:
+	.string	"features-time64.h"
+.LASF2812:
+	.string	"strings.h"
+.LASF2789:
+	.string	"feature.h"
+.LASF2750:
+	.string	"src/main/drivers/accgyro"
+.LASF2784:
+	.string	"beeper.h"
+.LASF2846:
+	.string	"struct_rwlock.h"
+.LASF2793:
+	.string	"runtime_config.h"
+.LASF2783:
+	.string	"config.h"
+.LASF2819:
+	.string	"fp-logb.h"
+.LASF2791:
+	.string	"gyro.h"
+.LASF2808:
+	.string	"time64.h"
+.LASF2792:
+	.string	"string.h"
+.LASF2768:
+	.string	"target.h"
+.LASF2873:
+	.string	"io_def.h"
+.LASF2823:
+	.string	"common_fc_pre.h"
+.LASF2866:
+	.string	"bus_spi.h"
+.LASF2752:
+	.string	"src/main/fc"
+.LASF2809:
+	.string	"wchar.h"
+.LASF2802:
+	.string	"timesize.h"
+.LASF2748:
+	.string	"src/main/common"
+.LASF2761:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2829:
+	.string	"rcc_types.h"
+.LASF2787:
+	.string	"acceleration.c"
+.LASF2857:
+	.string	"accgyro_mma845x.h"
+.LASF2832:
+	.string	"time_t.h"
+.LASF2786:
+	.string	"acceleration.h"
+.LASF2767:
+	.string	"stddef.h"
+.LASF2820:
+	.string	"fp-fast.h"
+.LASF2816:
+	.string	"floatn.h"
+.LASF2774:
+	.string	"bus_i2c.h"
+.LASF2853:
+	.string	"accgyro_bma280.h"
+.LASF2806:
+	.string	"stubs-64.h"
+.LASF2805:
+	.string	"stubs.h"
+.LASF2772:
+	.string	"parameter_group.h"
+.LASF2850:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2825:
+	.string	"config_reset.h"
+.LASF2875:
+	.string	"io_def_generated.h"
+.LASF2868:
+	.string	"flash.h"
+.LASF2874:
+	.string	"utils.h"
+.LASF2862:
+	.string	"accgyro_spi_icm20689.h"
+.LASF2836:
+	.string	"struct_sched_param.h"
+.LASF2785:
+	.string	"sensors.h"
+.LASF2877:
+	.string	"vcd.h"
+.LASF2778:
+	.string	"accgyro_mpu.h"
+.LASF2854:
+	.string	"accgyro_l3g4200d.h"
+.LASF2835:
+	.string	"endianness.h"
+.LASF2766:
+	.string	"stdint-uintn.h"
+.LASF2839:
+	.string	"clock_t.h"
+.LASF2794:
+	.string	"accgyro_fake.h"
+.LASF2867:
+	.string	"adc.h"
+.LASF2804:
+	.string	"long-double.h"
+.LASF2803:
+	.string	"cdefs.h"
+.LASF2818:
+	.string	"flt-eval-method.h"
+.LASF2790:
+	.string	"mathcalls.h"
+.LASF2807:
+	.string	"typesizes.h"
+.LASF2852:
+	.string	"accgyro_adxl345.h"
+.LASF2776:
+	.string	"sensor.h"
+.LASF2824:
+	.string	"common_fc_post.h"
+.LASF2810:
+	.string	"locale_t.h"
+.LASF2756:
+	.string	"src/main/target"
+.LASF2840:
+	.string	"struct_tm.h"
+.LASF2770:
+	.string	"axis.h"
+.LASF2751:
+	.string	"src/main/drivers"
+.LASF2871:
+	.string	"serial.h"
+.LASF2859:
+	.string	"accgyro_mpu6050.h"
+.LASF2830:
+	.string	"pthread.h"
+.LASF2833:
+	.string	"struct_timespec.h"
+.LASF2826:
+	.string	"build_config.h"
+.LASF2858:
+	.string	"accgyro_mpu3050.h"
+.LASF2754:
+	.string	"src/main/sensors"
+.LASF2765:
+	.string	"stdint-intn.h"
+.LASF2856:
+	.string	"accgyro_lsm303dlhc.h"
+.LASF2811:
+	.string	"__locale_t.h"
+.LASF2764:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2780:
+	.string	"struct_mutex.h"
+.LASF2870:
+	.string	"sdcard.h"
+.LASF2844:
+	.string	"pthreadtypes-arch.h"
+.LASF2773:
+	.string	"io_types.h"
+.LASF2831:
+	.string	"sched.h"
+.LASF2760:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"\037"
+	.text
+	.section	.gnu.lto_.icf.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\305\001\235\f"
+	.string	"\364\020\271\002"
+	.string	"\036"
+	.string	"\331\364\215\335\002\004\002"
+	.string	"\002"
+	.string	"\002\001\002"
+	.string	"\001\263\233\373\313\f*\002\001\002\001\002\002\002\003\004\005\002\005\002\006\002\006\001\002\004\007\001\352\263\360\321\b\003\240\342\234\212\n\004\005\006\275\323\245;`\b\002\t\n\002\n\013\b\200\343\367\203\001\t\342\306\306\223\006\n\016\254\365\230\374\f\002\002\f\002\r\020\365\266\252\230\005\022\016\002\004\002\017\020\002\021\002\020\002\004\021\022\023\024\231\215\300\232\b*\002\013\002\004\002\f\002\f\002\b\002\004\002\b\002\022\002\020\023\002\023\027\251\274\224\333\006\030\314\341\206\214\004\004\007\002\007\031\355\214\377\356\t\032\273\330\316\306\r\033\202\253\300\374\b\002\002\020\002\024\034\315\320\267\275\007\016\002\025\002\004\002\026\002\026\002\027\002\004\002\030\002\030\002\031\002\004\002\032\002\032\002\f\002\021\035\265\372\210\203\b\002\036\200\333\377\224\002\037\302\273\360\257\005\002\002\033\002\004 \226\266\306,\002!\324\237\236\201\n\"\211\326\207\344\017#$\240\342\234\212\n"
+	.string	"< \220\0022\032\262\003\022\021\206dU\002\033\313^)\222Y\310\025|$\024y\0353]\363@QW\002O\215\003h\f0\220\267\026\261"
+	.string	"$\357\335:\271\034KQ\307\266{\327\260\302wZ\307$\f\367\3724!6\3770\316\202\317\0071^\210\001\026|\301\3013\206-,dv\245\263(\224\200YC"
+	.ascii	"\213\301\265\211\346\201\204\224\356\306\226p\327;v(>\205-\021"
+	.ascii	"\0160N\300h\261\255\334'\273\342\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375 \325u\003"
+	.string	"B\004\r\026\260i8\f\303`M\222$\201$[3\262\020\314\3564\266\345N)\217\2437\223\331e\267br\311\"{l\354\026\n\372M\007.'\266v\n\013\354\357`\024\027"
+	.ascii	"1SD\317AR\007\370\303\024\235a\204*\340\325a\242,Nj\f\252\212"
+	.ascii	"\333\274\0053\001\032<a\351Le\237f\001\254\f\214\315l\221\345"
+	.ascii	"9\025l/\326m\240\r"
+	.text
+	.section	.gnu.lto_.inline.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\t\003}\017"
+	.string	"\026UL?0Q4\214\001;k\274\017M7\337\347k\221\030\262\376\335xG[\310\033\316|\270\322e\254K\375\340\203Edi\215\273\bf\324\013\351"
+	.string	"\205P\241"
+	.string	"\261qU\347\230\251\361\206m\233l)e\n>"
+	.string	":"
+	.string	"5"
+	.string	"(8\334\340ay\222^P\231\360\200\030\2561w\022\317\221\244/Z\22081\215/K\007\223\r1\260/e\006\r0>8(%\210\n!3\026\214yV>D\311G.Y\354\356\365\231\365$=rl\3474\243T\355\256\207\362k\211\336\n\025!\250%\005\223\334\201\253\023lpi9a"
+	.string	"+Is\354\256\2021+!wwS\244\002\016\220\030vZ['\204\264\361\341\211`{\201\267N/\371)\233\300[\207[\367\027}\353\360\361\242)B\265\322\361 _M\031b\004\225\332\305\232\307Xo\235>f\326?\003\334\\kA\203\"\350\367}\001\377[\220\303\262\004\301\201\f\3454\322\032\037^\212\354\217'\257\220\256=f\226(Kvw\200\310\b\252\373\334y\003\302i\211\024\210\205\312\207cE\222\300\224#d\220x\234\r('dm\024\013Y\250\001E\211\204\002\222\231 m\261\001\220\002!\251*\017\022@4M\210\264h\212h\\\377w\030\334\026\263\013\271\f\360\246\217\375\277*\277\361\374\272\306o\233\234i\220\f&\026[\020KO(\201w\017\317\246\025`.\371\372|\366\210i"
+	.ascii	"\300\234\307#\242\323\312\220\256\265|\377C\267E\003\322\361"
+	.ascii	"\221\355\214Vs\370@\3455\254E\207X\2014z\264<\324\220\231\224"
+	.ascii	"\361\205\314^\233\370$z\325\"\245\271\355C\r2j`\332\035\204/"
+	.ascii	"\305L\310\256w\242\337\363p\337\200 \f\253\200\n\301!\315\356"
+	.ascii	"z,\217\265IC\235\373\227\373\373W\201\327\320\242\352\314\203"
+	.ascii	"\203\001pZ\316#\315U\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`I\0015\b"
+	.string	"\362\314&*\200)I\0073\260\f\221\006\355\207g\220IH\277\272\023\231\220y@\233B\344p\232\026E_\374#\306E\0011\350\366\233\310$\003d\323C\277`\fs\212\002\231\320,\344\304\0233\303J\336p\231\"#!\306!\326k\351}\004\206\336\243\347\370\036\220\006d\201B@\016TUyz\3471.\212s\256\202\021T\245\264\375\007s\267\304^b\235\022\235|\026v'M\237\274\213s\036\030A\245#\245\224\256\207\327zH[\002\332#\b@^O\343zfc\bk\215\312\354\241\247"
+	.string	"\353\020- `\242Aw|\305\304t\311\2003\002\252bp\226"
+	.ascii	"\270\213\3414\256\036\271\256[\021('\006m\026+\001/S1\273\200"
+	.ascii	"\367al\026\266\303\240\361\300\267\025\323;S\234@9\217\2156\003"
+	.ascii	"\335\005\344+\230\272\210\363\310\026\336\354vo\240\375\200\004"
+	.ascii	"\272IK\217\016`+\351\345\r\\;\204\335\271\027\326N\323IMj\300"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.pureconst.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\232\004\006\232\004\016\230\004\020\230\004\024"
+	.ascii	"\231\004\027\230\004\030\232\004\031\232\004\032\232\004\033"
+	.ascii	"\232\004\034\231\004\035\230\004\036\204\004\037\230\004 \230"
+	.ascii	"\004!\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\243\001\275\t"
+	.string	"\222N)+pk2\034\374\252\252\212\216\210U\261?W\246\200\372\253X\377\216\250\232\331\344\227_m\310\322t\366i(qE\352A\210\020i2\245j.00\320\323\202J+\266\224\210*L\321Z\024\363\211\371f2\327l5\363\31463\307l1{ S)\250s\331F\022\024\341@\245\f\326\202\207cYlt\254\325YK\t\267l3\201\372\345!e\353\021\233\346\020\017\025\320\001t\313\3262\207l\037\002T\351H\225\264\016\363\312\2662\244G\333hR\346\r[\206\271d\317J\222ds\346\350\356ds\2625v\300H\227\021@\250\241-c\210DDR\324\254\001@\002B\030d\346\001\021@94\252h\232}\003\303\212\307h\016\235\031\304"
+	.ascii	"\212\314\340Cx\241\272\267\356^\247C\317\272J\025\217\253\240"
+	.ascii	"r\264\352\352\302gP\200#HdC\351\205\377L\"\024\3409t\362\"\321"
+	.ascii	"\336\261\344\316\026r\350\001\275g\321u\212\013\366\221\304O"
+	.ascii	"J\t]\376[W\263\251\376L\302\007Z\340\341Tk*3\2170|\370v\324n"
+	.ascii	"\355\001\201;U7\342\017\211\3343%|\243\316\366, \n"
+	.text
+	.section	.gnu.lto_.lto.550b119b0c29bdce,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.46.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\b`"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\325\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\354\007us\350\374\006uq"
+	.string	"\005\001\006'\001\024#?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.47.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"U\n"
+	.string	"\226\023I?\020\0059\035"
+	.string	"\360\016?d\nV\370\270jV \366v\234\330"
+	.string	"\272\\\372\312\004\200f\340\325G\246\377\016\026FqY\337;e\036A!P\336#\023\246bY\345\210\333\025\005J\371\247\344\357\235R3"
+	.string	"4"
+	.string	"9"
+	.string	"\240s>o\320\235\003\275\240;g\323\356\371\t\333\317XLh\006\354\256WUn\236\232\376e'h\271V\247\003\023\273k\332r\241\334\365\266\027lg\330\007\0055\305\376gw\327\365e?\366S\256\023\220\223`\333=\271\025\330\032w\323b\373\366O\323\016\331#\227\212\323\313\374\227\303\230\217\251.\332}\361\330\354\236\fv\b\347\376\263\365ea\253\261*\211kI\200\317\334\366x\r\315G\350\354\362\263\017\227l\220\313\204\270\024#2BwV\316\371\252\356\234\002\f"
+	.string	"\213\336Li8:K\t\330\347\212\006\3766 \036\"\032@\t\322A\211\nI\f\216/\025^h\210\024\247\323H\212\374\221\3041L\231H\360\004~\237\311+\311\261\024\301\322\023C\023\312\373\310\322#\215<v\200\244\227\032G\322\013\005\r"
+	.ascii	"BQ\022gX\223\270\360\370\005\231\3412\310\330\251iQ\245,\306"
+	.ascii	"\364\253g\007\3502\021\334\271E;\237"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.48.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`%\001U\r"
+	.string	"\326\230ZB"
+	.string	"U\2341"
+	.string	"y\2064i\265\306\253%\215\344\020*\202\301\211\370\357\306Q\005\277\241\231\312\276\036\2170\262\213"
+	.string	"\366U\273eQ\020RNW\342\376\335\371\302A\300\363\376\017!\007\002\321\366\333\237b\267L)B"
+	.string	"J"
+	.string	"G"
+	.string	",\204X[*x5\003\314\253\313\013\260^1\017`\275\372\344\310\276^\1779\264\203\2744\261\277\344\210\024#\326Z\254R\361\3604\364\177\362\314x\022qz\361XkM\307\223\211\273\272m\004\2661\330G\021G\375\200HWL\315\323\207\245+vI\242U\n\373\026[\225\330\226\213\251G\201\"\326\2268\217\330T\335\321\302'\177G\177\341\243XP\271^m\207/A\017\211\004\205K&x\335\270\220@\351Q>\214\307\030\275\004-S\346\304\r\327\230g\252*\021\271\361_s\270\216\03480>\001\353\327\241\333\350\334\371\265\207\327\370\334\231q\032\240\365j\300d\210HO\377^c\252\034\345W\211\307\217\313"
+	.string	"\351G?\345\346\007\177\305\253A\204\240\037_In \326k\31648h\360`\201\006\2013\340\013m\336\205\r\231h\253\220\201\213"
+	.string	"\002u\036"
+	.string	"g\034\256\333D\037O\003iY\366\301>\257\3738\355\303\270\355\023\3022\357\3038\033w\0354\017\023u\235\207]\245x\213\255J<\341\224\022+\222}\324\177\022\030"
+	.ascii	"BQ\022eX\177\322\305\361\r2[\316\0168\002\"\2408\252$\263UD\336"
+	.ascii	"\002\027\b\b\276\272=T5\350B\216h\214\375\230n\321x\216m\001"
+	.ascii	"\211\030(\203\227\306\300\271\274\020&\031"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.50.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`n\001\335\r"
+	.string	"\326\230[E"
+	.string	"s\233\016@\332{\026\256\037$\234V\273\325\221\332\320\t%\217Y\213\225,\343\3277\331e\226\344\214M\\\263\201 1\340\255w\006\022B\275*"
+	.string	",\b@\330\231g\260\240Q\r\202\271\250\b\231\375\357\265m\247\024A"
+	.string	"J"
+	.string	"J"
+	.string	"+Bv\307\004\247^\2609\365x\001\327\351\346\001\256S\037\345dc\247\307\f\332/\037S{\222\205\203\n\221\335\315,\025\007?A\377'\347\210$\033>5\242\335\365\024IB\334\326m\037\260=\262\377\022W\335@8a<K\223\226\2350\366\210\232V\n\373\231\265Jl\252i\361\303\343c\367CL\221]Q\035,|\224\223\247\277\360SF.\330\251m\360\343'Bu\210@\262 8\375\210\b\315y\225\017\3431N\037\277\013\004\347\004\212\005L\330\370ISx\016\0347<AfY\242\245^']z\215:\200\364\205\323\360"
+	.string	"\244v\327\301\214\257|\327\251'5$\2341>\371NI\342)\277\207r\004\220\227\337\274\350\253\\\006\006\177\305\2513h\230\027O;\267\313u\032\336&4`\360@\001\027\002\021\250\035'a\3334\2157\220\251\222F\264\216\253\300m\233\226y]\365L\234\227\231HZ)\333:/\003}\\-p]6Rk\227ac\370\314Z%\020\\\254B\013e_\365\237\274S\232\254B\322{\360\330\021\036"
+	.ascii	"\270S\340\fkyZ\3701\025\001\024\016p\002\216\003\311\210x\342"
+	.ascii	"a0\006\034\203C\024!\361\022\202ha \230I\372\017\306 p\001\341"
+	.ascii	"\370P\325\240\0139\2421\366c\272E\3439\266\005$b\240\f^\032\003"
+	.ascii	"\347\362B\230d"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.51.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\271\001\335\017"
+	.string	"\246\233hH\320\024q:\240F\206\260\205H\317\244^\f\206V(>\237N\3218\225\206C\210\266}\301\301#w\324K?\b\352^@#Y\322\304$\020\244\b\255\272r\341\324\352\235\t\356\024\266`/\007\261\251^\355\2055\342\332\266S\nK"
+	.string	"T"
+	.string	"["
+	.string	"G\261\013$\021\235\332\177\235F\35251O\331u\331pv\317\004V\340\275\372<\200\356\325\273J\367\352\224\215\344g\213=l&\223c\311\356~\034\213\247NS\376k\034\304\242\021q\372y\331]S\026M\211\233\273m\003\266K6\035\020#<7\232\234\257\026\002*j3\215\351p2AN~\240\263?\034\007\b\273\274\256\354(\201\361T\017|\033!`\350\216\013?\246{]9RS\321\233i\f\210\221\2456\373\\Qn\205}\317\356\2569\227\375\232\237\326\317\254\210\200\333n\353\306diU\006\303v\261!>rd$\023\242\023\372\234\3602R7\003J\241\242G\210C\332\360\037\"\205\326\f\322G\310iL\207\246\34376\250\227\025\t\t\260Ym\367D\300\022CT\351oL\267Au3\240\023\260\027\265W[\360^\177\236\007\212e\223\337\341\301\333]\227WOh\311@\361\262i\324\003d\031b"
+	.ascii	"\301\321\3074\211\345\005\016\340I\254\220a\204P*\221e\212A\r"
+	.ascii	"\f\0264h\t\035\204\002\204\3408:\231\243\350\031\f\215\244x\032"
+	.ascii	"\225a)\004\301\321g\226\2449\206\3467\212#\323\007\226\346\027"
+	.ascii	"b1\331!,\277\023I\226\037\312\251\272g9\227#\020\241\251\270"
+	.ascii	"\325i& \260\002\232\232\352\001\311\027(g\355'\213\361\032\272"
+	.ascii	"\b\274\033\353\266\031n\315c\306V\313\037S\344v8\310&\007\372"
+	.ascii	"\322\306\004\027$0\031\345EO?\327>\n\355\243\306\3342\"\0016"
+	.ascii	"\337%;S\033\311\204\304\307\032\320|\247\266#\226\241\2779\032"
+	.ascii	"zy\321z2"
+	.text
+	.section	.gnu.lto_accDetect.52.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\270\0045 "
+	.string	"\006\273\315J\220\330Q:\204\205s\036D/\236\366\221\370\007I\353\301\303\267\223{\234\002;\"\252\217\r\362"
+	.string	"_\327\354\245\202\376\370\303mEk}\262\251\257M\023H\002\201\t\"\021\0022\202\027\351"
+	.string	"\242%"
+	.string	" \323\017\366?i\204\354-\223\f\271"
+	.string	"\256"
+	.string	"\267"
+	.string	"O\337\304\367b\217g\367\352\360\242\001\275\251cw\214\370t\237\212\257\344K|gB\364"
+	.ascii	"\367B!I\336\2336\340\007\350MN\237s\336D?\340\274\t\301\307\307"
+	.ascii	"EO\245\224\276\243L\260*\354\336\324Vyp\355\242\327h3Tv\232\266"
+	.ascii	"v\021\377\367\332\215\232N\263<O\320T]9\274a\013\0241Jr\"\303"
+	.ascii	"\246\236\325\031X\216\264 \207,\035=\221\241\215\226\331Z<N\271"
+	.ascii	"r\310d-,9\322\243F\f\366yC\004Z\235{\357\217\357$b\2136\013\334"
+	.ascii	"\332\034\245 B"
+	.string	"\032\021\311.Xr\215\241\021\201]i\304\245\267\354\347\336\313-$\3128\327\234\231\215\314\234\202\331\366\002\274?\031B\357\275\022\370H\020,j\244\200\334\344\023\2357s\266\2101\3521\032\222\206\362\254/\276\257\376\343\344\031\226\276~\215\306^\376{\347\255>\364d\324b\374\3437PM\225\ts[\2149\375u\215b\276\004\245\025\037\\\241\230\317\344\307y\361\277\261\341\346\331\255\316(7\313^<\237\334l\271\2716\237\300\233\246\302\300\034\230r\257\322\330\231\373ev\t\271\325\231\177\345\343W\375\310\265\035-\037\346\037\255z\350o\210j\031\305\226\367\246\fnr\016\275\271S\305\347H\376*f\366\335\t\203]\301\213\345\275\227\347&\207@w\214>\265o\344UD\255]m\265YA\033G=v\326Z\317/\301(G=\206\326\256\375%\330u\324cf\215$Z\217D\223\372R\022v\323\313\363\263\350|\335\031\273"
+	.ascii	"\333\f\317\032\2472\353T\364\205\257\025\236\200\365\307\002"
+	.ascii	"\222\312\245dX\030\342\223o9\224\344=\205X~H=\f;|q\230\n\013"
+	.ascii	"S\203\304\241\274[\347J\226Y^\312\3142if\235\177\376\372\243"
+	.ascii	"x\254bk\024\377x\rXT\301-\364\311\263\355\233z\326$\346{=\n\203"
+	.ascii	"\365\221J\003x\357L\362\271\030\f\275\367w'6\271\205\027)\306"
+	.ascii	"\324\265\230\031\354wbff\260\026\336{V\035`\247\341F2\361\207"
+	.ascii	"N\346\265\336N(\2673s<\016\272\r\271\335\215\305\210\335\r\003"
+	.ascii	"\016w\303a\034\211\b\020&8\310Q\3501\260\"7\2422\256'H\007"
+	.string	"$t\333\345N\344p\270\233\215\267\323\361\202r<[\020\320\r\205\r\267\343\331z\020\260.Eng\023\322\351v\266Zz_\241\230-MV\177\374\005.Y\307\255\331\245|6\253\374cT\217j6\315\\\002\250/\224\325Z\177|\323k\027\300\247n1\306\251l\202\211\332\0050\275\367:\370\361\t\240\344H\322d\277:\333\023\25565\311\246\2120ri/&\345\217\231\305\272U\007\327x\021_\354\032\253X8\240\250\2400\242\310\234\323\337\353\025/E\244l\226\205\206\223\371\256\263\265IRn\003^\250\201\030\3160e\020\021\241\021\021\221F\351\200\002\231\2512\017\020`\312$IcR\333?\235wN\307\322P\020i\237+\300b\327\246\233\2036\236,\341av\2560\037\fV\272\312\032\335|\256}_O&\204GK \302\"A\223\020uw\201\372\210\334\272\327\260\277\335\362/m\311\035,u,\356ZH\221"
+	.ascii	"]\252\t\022\302\3177E0\343\020\303\035\303@\207\271\344\007@"
+	.ascii	"a\356\022&\302\324\201\223?\254\235\273U\236m,&\013\241\340\200"
+	.ascii	"\253\341\006\3438\237\341\264\217 \221\224\244\024\016\366\263"
+	.ascii	"C\312\257\210G\017\244\bU\314O\354P\3507\367\224\343W\336\205"
+	.ascii	"\317Q\261B\245\006\302H\210\234>\223\210\351\361\225\273n:\234"
+	.ascii	"\337M\272\036S\001"
+	.text
+	.section	.gnu.lto_accInit.53.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\262\002\365\024"
+	.string	"v\347\214J\220\026R:\300g\334i\306\021A\303\360XCA\246\t\177Vi0\200\n\316\256\030\216\363]\310\304k\211\351\2676\263\200\033]\273\013\3160\353\311a\321\201"
+	.string	"\b\342\017k\006\260 \243&\247\277F"
+	.string	"4gv\364\333 \204l\231Rr"
+	.string	"n"
+	.string	"\201"
+	.ascii	"MW\252\324#%\220)\333\267oL\262[l\003#&\354\276\350\333\270U"
+	.ascii	"\322\211\037<\253\225E\f\255Z\2154f {)s\232\371\222<\214\371"
+	.ascii	"\322\266mn\222|\3368lz\224\327\022\326X\255\306\032\205:\367"
+	.ascii	"<I\367\364\001\b}'eN\247\344\314\212.\247\026!\220\244}"
+	.string	"\265`\362\342\267\204Pi\227%\247\326\352\r\nM\334\345mG\260\215\301\246f\353\203)\305o\257X\300\332\266\033\375y\002R\237\367x\004s\331?\335EL\005\277\3618\204^\206\265\376\036\364o\374*\310\227z\351\234\320>\370\322\027\"\332\355\203\226\021A}~\361>*\304\244<\251K\3056\002\227\276\260O\201bD\022\246.\354\023\177\030\257g^\313\2746Y\326\245\271&\3135%\327K\327\247\235\352i\314\tO\224Z\0030\\\300\200\b|\371\234:e\354\203&\225\tA}&iI\277\265d\305>g\334\310I%\253U\t\307\357\272\327I\343\254qV\235U\346K\222\336\204\021\3678\204H\207\323*\301\206\263x!\020\270\202\220X\005\326\226\240\263\017Rz\024\\G\017;\b\206\034(\374\007\217V\026\205\022\263v\205\236}p\351Ol\201\275\007\b\037\232\222Z\353\245|$\013\347\361\363b_\370\016\240"
+	.string	"\303Z+\316K\035\001\276ih`\343`\001\356AM\314\220\355\210\207;\322\355\004\351rCED\266\236\035\017)h\200o5\272]\316\310\306\303\r\341n7[\255\307\333\365t\270^M\227\263\021\325n\274^\255\346\200wE8^\315h\267\343\325Z\214\277\223tF_\274NX\223\034Y\373$\227Q&\3332\352\234\037\005\2224\013C\355\023\352\214\332\007g\224\244\276\255\265\372\250O\323\244\031\256\226(\355\024\317lIo<\2223- \320\242\t\250\252\007\005\222D0\303A\326\233\330\214cW(Z\260@\013\033\302\225\204\256=\200a\272N\260u\237\262\033\013\313\324<\b\232\023\325b\307\261\254 V\276\357M\034\227\304\300?\263\371\225B\243\341s0\311\226$\376#\023[\241)"
+	.ascii	"\212\366\247\260\256\306Ei\261\347\362U4\215\300$\357\240\356"
+	.ascii	">\032C\336\003"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.54.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"-\t"
+	.string	"\346QB90\221\322\001\200\300\326\223\206\361g\310\275\362Gi=4\333\247\220\206\374\305\233\262\r\373\033P\003F^C\200\335f\301\004\205A\031\207cJ\f\325\023T\256\033o\330n{\247\024."
+	.string	"1"
+	.string	"2"
+	.string	"\240\317x\002\320\247A[\366\020e\017\343\ny\331\331]M\236\034|\004\375\267\\`\305J=\002H\354\256\343\2125r\313\333V\260Mm\303\002\237\335]\313\226\375\327\037?\00568\027:\273\"\263\236\215\315\031\025\333\017\331\b2\212\030\355\257\234\005\374\013\345\271[\022#\263\033.\270!\340s\340\242\236f\352:O\013\205\373\317\312\226-nb*\t\342(}\227\303P\276\313\037\247\370\325\247\177\002}\212RHTq\346HS\223\263\221\307\016SQ\232\330\017\246\032\017\016\020\f5bd\220Q=\316\243\243V|\225DO\023\030\034i\243\007\246\243R\307\2316\257\222*\245\233\366y\335W\252\237V\342\266\r\215z\2376Jp\307Q\003\t"
+	.string	"M\311Z"
+	.ascii	"\267\214=\343\26368\273\3432\264\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_isAccelerationCalibrationComplete.55.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"=\007"
+	.string	"\202\31635`m\322\001"
+	.string	"{\007\241R\377M\263\202\375\252"
+	.string	"\256GxP\366\236\267\005tk\350\330\201fw\343\270\016\b\241\004"
+	.string	"&\230\300\263\375\207\276\004\\P#D\312\224\002\266*\030\264\\\252x-\\\226U\275,\302\f\273\262\207Y*\206g\305\354U\b\f\033\256\370.\020\306Gq{i5\244:\300\321\216}\f\345\252z\217\250\223\235}\216w`\374\013;d\362\333'?C\371t\025 \201\340dg*b\323\304\3466\251\022\366\245\325\220\355\264f\372R\300hD\341c\367\323\235\254\310$\302\260}\373\033\032\233\362\001\202\306\332\271\212\317-2<\036\243]\356)\305\265\247\346_\343R\tH\310\006\332<\001\022v\327\271\201\036n\275\355\002\333\006\266'\002\007"
+	.ascii	"2\241U\037\370\003&@\327p\220!J\270\313\246v\222\001"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.58.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`#\b\005,"
+	.string	"\212K\200\020CPdN:\023&\037>T\305\311\241;\212\355\242c\252)\006\254p\365\361\307\257\035t0\350\251\351\034/>y\fV\253}A~\024\002"
+	.string	"FQP\b\225({\301\204\364\240\347s\2405#v\023\262e\222\001\355"
+	.string	"\343"
+	.string	"\377"
+	.ascii	"RG\271Ez\224x~\311\236\331\321v\267\036g2\232\210\254\255\007"
+	.ascii	"\363\360l>\316\344\257U%l^\356\275\303\243\314|\265\363\2221"
+	.ascii	"\257X\2069\246\324Q\004Z\250\336W\363\301\274bw\303\244N\214"
+	.ascii	"\336Q>\031\037\314\303\243u\310L,\243z3_\314\307\034\217\366"
+	.ascii	"#@\322\365Z\013\302\346^\246\003\216\220\036e\346\233\354\321"
+	.ascii	"\364K\366(\037\231\003\235\271\274\300+p\300\312\350\335{\247"
+	.ascii	"j\025\256?\231g\333\307\007S\240E\317\332G~\332\021\324\035J"
+	.ascii	"*\271\036<\020El\311\323s\002\020\275\262\323\205-9\213\370\300"
+	.ascii	"\362<\355\007\270\204\2215\360L\272\367\036)\301N\b=D\331\325"
+	.ascii	"V\270E\311\321$?O\006O\346 9R\0029\233\356H\3713Tzu=\334\031"
+	.ascii	"\314\361I*\225\274\201\033\356\275\334I\245\330Yxf>c\346\027"
+	.ascii	"\314i\007(\347(\026\355Q\247:\274\243f\033\244[3\310Y\251\204"
+	.ascii	"\335h\241"
+	.string	"j\031\226\2775;\257\346c~\233\307\031\371f,\343\252\237\274\262G\241*\224\035\031\262\377\370k.l6\241\273j\376\"ccx\212\232i\365\336\313UY\352\177\273\006(\310\356\343\303\375<\213\362\344\245\233gt\267\373\230\231]]\2510\377\367\336\313u\n\263\260yA\324\321~\242\260\031\352o\347'a\263\223\260\271)mf\n6/\t\233\001\004\233\225ls\222mF\262\315Gi\263\221m.\262\315C\333,L\233\203\300\346\3246\003m\263\265\315(\260\371\264\315\3256\267m\276\324\200\262;.\326\334k\344\017\321\265\203\306e\371\333\321\346\237\371\232\035W\303UN\320\026*\206#r\241b4Os\374\033\313\245\\a\251[\2329\203\356\275\001\265(\357\302:\364K$\354\013\326>>,`\r\326s\016\314O/\255a\266\002+\260\314\027\230.3g9\213V[\321\271\006\307\253J\357\320\032e\027\267'"
+	.string	"\317\210\231\3647\332\005\365iWR\363#s\207g\320\002\267\013\233J\272\266\247\204\272\330\331\273K\273\260\231\007\254T8\330\007\215\252\265OK\375\251\016q\360\247J\325\307\253\371\372\352\006d\367\375\264Q\365o'6\370S\215\252\217\032\373r\020\026\020\b\003!\376GD\352G\007\t\002K\263\033\366h\324\022\017\371\272\333\335(q\242\237<a\217\236\225\200\025\262:R\337S\365\264\324cu\264\314S\240\016o\216\256V\272*\243\345\235d\241\256\257\2656\334\327\223\256\376\343:U\t\352\030\305\351X=\325\335{+\314\371\234\n\026.\\\330\243]\023\330\311\251J\343\274\032Y\211+j6\033e\346\021oV!-\357\275\027\370r\177c\3057{[W<\254N.\306\240 \301\002\004#\206\007\001\266j\\i\231\230Q\304q5\002\006\026\007\0324\262\264\224\270\370"
+	.string	"+\353\n\207\225\226\221\206\261X\264\232\332\322\312\332\3022nMa]Y\325\230*jmM=@\300Y6\214ZS8\262\262\264\246\206L\344\177\353\024^\341\304\016\262v\261SeR\377\376n\264M\325\251\276\307\232*\223\035Y\313i\362\240\202f>v9~\351'\231\330U\271x"
+	.ascii	"\222?\355\251\2366wo\020\362+O\3710\215\344H*\300\216\3510\020"
+	.ascii	"\\\341l|Lk#\034\270\302Q\356\"G4*\276\331\017{\224\300\022\217"
+	.ascii	"\355\302\266:kOq\306f\357\216X\257v\"R\216\222\251\022\351!\347"
+	.ascii	"\\\262\320Re\252\007\363\003P\225\352R\005\346}i\351\320B\214"
+	.ascii	"wc\366\320A>\274L]\203\001\250w\263CK\252J\025\230\207T\223\216"
+	.ascii	"*Rw5\220\366\352\243G\211\214\0344W\337\242jd\350\303\200\253"
+	.ascii	"\250Q(\b\021DjHF\202$-H\032\003\220\002\221\241\252\362\021p"
+	.ascii	"1Dd\244\005\312\316vB\221\0353jH\351\2340\f\343\001Oj\260p\314"
+	.ascii	"\275\262\254\006XI(\202\035L\220\rV\3344\031$L\261|Z\364\270"
+	.ascii	"}\002n\214\3732D(\350\241\326\313\2646\231\352\202\303j\354|"
+	.ascii	"t\326\3649h\3216\243\036|\372\r\005\272}Y\244\375,\367a\016\204"
+	.ascii	"\360\363l\204\273\341,\212\216\tb\331\352\3038Zt;Hr}\360n\243"
+	.ascii	"\341A\242\204\304\371\222V\202\346~\332\205\3463?\351V\351\201"
+	.ascii	"\320\326C\231#\372\345\355\361,\027pk{-\352\006F\334\240}\312"
+	.ascii	"$\363\321\366\263\017j'[<\343\217\024\211\352L@\210(\256NB\303"
+	.ascii	"M+q\256l]H9\360C\225y\306\253\320\351B\355\222\376\361\321\215"
+	.ascii	"\341\324Tg_\335\347\271\3500\034q\330\024Pa\221(\312\354\376"
+	.ascii	"\322@\334HV\361K\236\025h\367\326<\235\217\320\3454\273s\241"
+	.ascii	"\"\2648\275\303\036\221\343\231\310R\241W\334\203\341\327\347"
+	.ascii	"\303\013\337\360\035^ \003[{r74\357A\301\021\\\200b\2740\220"
+	.ascii	"q\233\321Gk*\227>\364\200\321\001E\212\377\366*\200\301\315\342"
+	.ascii	"\373\262\3754\354g\325\265a#y\352$\375\017"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.59.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\325\r\375="
+	.string	"Zc\350\025?@\244N\007Si\213(\251`M\226\002\3575\262h\005"
+	.ascii	"=?\021\212\211eHTy$\002\375\007L\314u\2535\322~\021Z\b\232\003"
+	.ascii	"\350\377\205\006\313v\237G\331\216R\243%m\357\235RJ\001C\001"
+	.ascii	"5\001V\001k\353\254\266\316\177tv\243s\177\250\360\347\315-K"
+	.ascii	"\333\367\211^#\213\212\356\235uo\013\353\253\253\336\321V\231"
+	.ascii	"\233\373\256\363\230\223\274\243\317p\243i\0223\3676w\357Mr\343"
+	.ascii	"\251\227-z\3270\020F\347\020\251\342\266\332\033oG\364\256\265"
+	.ascii	"\234%\3239\304^\271\357v0'{\355\266\343\3442\317\026\204\t\315"
+	.ascii	"\216\3668\3368c\232,K\n\357\215.\350\225S\360\322o\253\235\271"
+	.ascii	"\347\232\256\331u>\230\222.\220\2736\275{\243\r\370\301\261W"
+	.ascii	"\216\366\022\333\353\261\005\260\275r\2239PG\237\327\230\205"
+	.ascii	"\r\r\r\342\275\027\353\253\360\267\032m>z\263\217\214\224Id{"
+	.ascii	"4\262+\222\372\336\3446f\265N\265\037}\364\326F\252\202\3028"
+	.ascii	"\206Z\232\366\246.\031\321\342l\342JcV\2245\267NNEYc\322H5B\020"
+	.ascii	"D\267\226\2461Q\225\211\320\364t\227\264%\336\252Im\252\203{"
+	.ascii	"o\020?\032\263\250\254\261\265QI\263hg\276v\031[#I\323\334T\251"
+	.ascii	"{o\333\365T\2274'\256\036\351W\025\274\3259r\244\006D]\302#\345"
+	.ascii	"O\333\265\023Q3s7f\335{\331\235jk\315I\315\334Q\314\334\202\331"
+	.ascii	"\bDx\204\201\354\373a.\247\204\\O\317\236\216`2\037* \020\315"
+	.ascii	"\207\331x\024\230C\364\036.=M\267\021\031\236>\330^\331o<h\335"
+	.ascii	"\337\372R<-\330\203v\274\271\217\355u\365S?\020\260A\323"
+	.string	"\361S\373\244\327\023\371\277\217I\240\371Z\016\nn,\2752\016\022\336N\022}N\3032_d\320q\230\023\236\367^\013\314&Z\017\305\361\336K\001\016\217\256\253)\0261\266\327\377\t\320=n7\375FL\005\013\026l\257\376W\204J@>)\373\0051\022\367\017\307\355\305\366\273\270#\004\342\211\230[M\257\361\342\306\302_`\336\316^\271\301\330^\373\227P\2662_d'=2c\234\302H\227\370\236 2\274\236\310\0345\363\207cn\277\367\376\340\237\302\254\325u\335\017:\332l\325:W)\235\017\030\235\r(\235\251\220\316SHg\251\326y\211t\216B:C\265\316OG\347\002Hg'\244sS\322\231\311\350L\300\350<\240u^j\235\225Zg\001\255s\200\326\031\300\3219\311\350\214tt>B:\033!\235\225H\347$\322\031\211tn\215\316\307\326\331\330:\263\255sy\320:1\002>n\213g\301\""
+	.string	"L\200\267\002m\340U\250\004\370\n\320=/"
+	.string	"~\n\263j\352RVt-\237\213\034\n\363\350O"
+	.ascii	"|\005\350\336[R\2018i\002Wvs\013\313\334\344\322\364\342\355"
+	.ascii	"d) \377\203q\374\335\35160\023\2468\376\364\020\031\206\261\354"
+	.ascii	"H<IXSLS\316\333\331\224c\333\232\016\215\250A\266\027\213\364"
+	.ascii	"c\276\206\364UP\266@%\322n\037\216[?F\255_\311 1\221\255\266"
+	.ascii	"k51\212\025g\225yb\253"
+	.string	"G\255\357hK\225y\"w\367`\255^\353\033\301\222A\334L\266\b\263j\352D\\t-\033<\017}\310\321/\241l\201j\013\032m\013\352\351g\034\224\236\036\344\300\364p\321\350\315\266\220\236^\326N\303O\276\321;\240\26373\031~\267\254\246\3152\275\310\001j\272\250\025\233tM3ZZl\257\312\267\"\334+\363E\031\235\270uL\224\374v\017\371]\bM1\321\337\270\240\231yF#n-\031\352C\034rt\360vv`{}\232\036Z}\373\336\207\246\250\004x\250\313\322\370\ta\233M\037\277\243\034\036\037\001\224\355\b\260\320\257\017\307\335}\357\275H?\205\3758\340\240T5\376\240BA\205>4 f\343M\377\030\277\003da:\274T\376\202!\001B\005\007`\027\256\230\310h\204\215\225\210\361u#L\304\213\032Z3f\210\215\001\340\257\253\032ba7\274\306\300f\200}}ya\221\215\211\221\325"
+	.string	"#\303\252\021\346E\003\353k\214\f\353\212\212\305l\200\215a\335\020\023\033\303JF\313\372\247p\327\241;eov\344\300\231\233P\232R\314\376\007\0270\354\266\353\343\036\301BD\205\177VH\252\247;\217?x\037>\307\303&\266\363\030\204\347a2\205\316\343\020.\345b\206z\036v^#\363\006\245h\372\004\030=D\204\036|\343)\003\007\253\376\316\240\240\323\360\300W}\243)\032x\252?\360\353\242\26383_\204sA\257\f\315*^\247\t\245\020h\3403@\353\246\236\352\327ER?\365GG*p\371s\372\242~\331\246\241>\212o\017\352O\372\364z\314%\034\017]PN\377\364\252 \232\242\027x((\033\204\246w\372\265\357\214\f\233\255\343\232\246G"
+	.ascii	"\335\003\023\214Ks\365<\f\354\223C7\346i\364p\256\244\231\320"
+	.ascii	"\\i\3121\275\222\220\315\003\371\224\004\376\356\027\027\333"
+	.ascii	"\213\035\360\004\242\003>\212\220\256\223K_G\007\350\203\227"
+	.ascii	"av\336\224\f\327\206\247\334\322w\036\241\234\322\213a\"xz\230"
+	.ascii	"u\217\177av\336\323\275pi\230z\027\245\357\201*\250a8\350\024"
+	.ascii	"C4\"\"\242 IRH\007q\005\304"
+	.string	"\020h\231\231\007\021\3004\311\030#\032Q\352\0246\346BI\226L\205\344yE\300(\\F\241%\243d\236a\255\330\327\237\255\231\252\337d\237\2438|\t\213\264(\3727\263G\177\276\006\253O\271\225\326\210\366\266\242v\026\3641\335$\031 \371\202ua\234\375\315t\2600\2152\200;c\346.5\253\375\276&\265]\221\377\f9H\256\273\210\273\334w\223E\260~\016y:e\367[\322\371\016g\372Vk\234E-\020\017\362\355OQ\353\304\n\276\360srS\3651>d\260A\202\360Q\255\205M\240y\347\345\026\020\241\250,\350C\302\021\370V\022{t\023\324\n\232\240\003\272\300\244z\247C \001\210\222\253T\230\203\233\362E\210\2562F~\275\311\004\366j\225<\263\305r\255\322\342\364m\030\030\377\214D\231?*2\377\3102D\357\204^n&\352\273.\321^\316\212\323\370\275\247\201!0\254\023\361\314\245\006"
+	.string	"x8\307\326\253\036\362J\322?\2662\005w$3pQ\036b\347\001\337\375\200\300]\213\264\200\326\201'\302\343\301\312\203!\020c\272Ah\351\372+L\224\375\367\353YK\324e\030\333|\220\316\236b\250\305\344\255b"
+	.string	"\217\023\2334\363\002\316\036REq\220\327\035\243\365\2115\332\371\221\340mU\337\263\207\374\333\3579\247I\030\354\177>\377\034\235\3067\241\rT\225\025\313\232\372\302\230\260\177.V\024\016g\340=\257=}h\007\314ex\362\317\246K\353\211}"
+	.string	"\311z/\021Z\364\360\342\246H\361CB\303z|\303H#\373hL\b9,\354\030\207\235]OF\371\207\366\243\220\331\344;\317\3007\353\032\017\327\344w\334N)0\267\013\375\275\246<\212\333\315\202d\364\222\264N\212hn\315\035\377\306x\327\002uv\303X|\006W\302\326&\002yT\262\347ZH\t\321\"FH\327\262\322\327|\207\006\352Tf94\341\350\344\234S\247\022\247\006"
+	.ascii	"r\n\241\221n\2273z\204r\322y7'H\022bZ\335f\343\333\202\3201\024"
+	.ascii	"f#M\311\301?"
+	.text
+	.section	.gnu.lto_accUpdate.61.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\017\001=\r"
+	.string	"f\331\\D\360t\224\016\350\365\021a\232\314P\227E\037\265zQ\203\331\223\025\274\177zdX\340\2715\235\363m\037`\002\017K \321\f\207\232\2406\023\242\211S\210hN\213&\313&[\004\276\362U\025\2465\262\211\224)\005G"
+	.string	"F"
+	.string	"J"
+	.string	"\016_\202=n^"
+	.string	"{4h\007y\330\262\307!\0025\243\265\273\231\262"
+	.string	"A\005\177i\202>"
+	.string	"\025\351\327f\345z!8\261c\205\2432]%<T"
+	.string	"9\3539Bu\312\324\234\354\2563\2452q\307\333F\261m\301\376\0262C6\213\330\241)u\205\375\273\264P\204\260\262\330_\375\032Mg\246\277\271L\211V\214\007!\273$f\214,L\324\341\302\366\355\207\240\315\261M\216\240<\317\362_\034\006\370\025\210wvYn\344\330\r\023x\301\3461\244\335]\365\007,\365\302\313\217S\022q\200|x\033\234\200\226\335\322S5RLhh\252\203\024'%\331\336p\031!\022\273\373K\312\200\036\273\373\300\3451>\277\305\243;\250\344S\217\276\n\366x%\361\261*\345\214\317z\205\030\230\32624`"
+	.string	"A\301\026\301c\340\013q\036\005\r\332\210\233\200A$\001\004\352\274\2165\217\250\343F\037o\003m\232\366\311>\257\373D\333\227\211\270O(\323\274/\363\034p\307a\363\262Q\327y\031',\241~RR\023\352\"\220\032\265\265-\237\362\245\001\023"
+	.ascii	"BQ\022e2\f\202d\023\341j BS\230P\267\302\274\221\205\210ib\200"
+	.ascii	"\340\200!l\205\353\345\322m\332\242\272L\004\356^K\32340\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.62.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\005\t"
+	.string	"\206\321@80\221\322\001\200@\227r\t\356\202R\030i\210Ku\230\264\256\217\237\230\376z\332\217\333\f\307\002\220\367\271\366\275y`\3141\2408\027\375\004\207B\341\250\346\372Q\367\337;\245-"
+	.string	"0"
+	.string	"0"
+	.string	"2\364\001\320\245=[\347_\311\036\346\305\303egwg$\271w\350\371Wy@\313\265:\004\230\330]\303\226\013\344\216\267\275`\373\302vK\2160\373\261\037~\022^4\0347\273\037\263\236\225I\231\023\333\027\331\b6\024\207\366Q\236\342=\246\272\300.,'f\367c\260C\350\322\337\t@\017\242o\377\331\b\263\205\210\214\025;\f\243\277r\026\225o\342\215\024|\353\322O\201.\rp^,83\234\t\251Y\310c\177+\030G\354\177vw\003\246\030\020\017\021\rUB\243\332A\355*\266Qg*q\243\002S\355\264\225P$\256fTJI\263\343\266\356T\273y*\221L\223r\335\324\024\274iTn\242\266\215\233\001\t"
+	.ascii	":9\0173\031\312\230>>\303\203\2630.\243|\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_setAccelerationFilter.63.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`Z\001\365\016"
+	.string	"6\336iG\360\2226\035\300\226\217\fo\352\177\264s+"
+	.string	"\260cxz\257\323\343rW9\323\316\242\226\032\033\215\347\021\021\002\031ah\374 \231J\304H\242t\"\353D\313\r\r\261(\243\331\214\005FK\277\364\267\376F\266\333\226)\005S"
+	.string	"Q"
+	.string	"T"
+	.ascii	"\341[(\317\335\0212nvG\004N\220}\0028\001\317\247^\200\347\323"
+	.ascii	"\241\335\343\243\211\275\315\215\r3?vW\223%B\r\217I\r\375\020"
+	.ascii	"\223\217j%\036\313B\\\312\\;\254R\330\310\356\336uuY\265\250"
+	.ascii	"\206\230\354\256U\265\002q\317\333\226`{\263O\"*Y\366uwE\313"
+	.string	"\027\373\255\177\376u\253T\377c\340&\007\312f\327\303N\220\315\2315N\374\365\333\017\325\214>\363\021\024\2121\262/\343\263x\213\360/\333\310\304\017\031\215\r\016\037\273K\362i\n\331\347\bv\177\fm\220\035r\215T\357\362U|E\026\364*K)zJ\317(\345\220*Q\325\271G\361\337\335\225\222\345\223<\227\025^<R\n\304\366\205\327\220\262\335e\340\3038\315\347\307|\032\003\bJ\021\230V\212)}\027\177\201\362c\254\262\242W}\372+\236\317\001;D\260\350\216\025\007\205\216U\035{\024\003\240\227a\303\314\235,P\320\240\244s *\240!\302I\005\302I\312\004\216{\200\262y'\257\344\0050'*}\336i3u(\035\307m\032h\372\300R\007j%o#i\234\t\324D\007\374\245t&\355\364}&\r4\356\345\213\353\031\016\215\034\026\331\202I\226/\363\017\214\316\f%\271J\027[D\355.\024"
+	.ascii	"\203Q\022e2\374\203\007\210\343\314\367\366\r\325e\314\265\214"
+	.ascii	"\023\3374\257\315X\002s\267\324-\3542\333,A\300\t\313\252\301"
+	.ascii	"\340\304\003\243\0345\210?\2242"
+	.text
+	.section	.gnu.lto_accZero_saved.2.81.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.82.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.94.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`E\002e\022"
+	.string	"\326\241wI\320\3226\035\b\213\225)\336\360@C\226f2^x\003\027Q\240`\330n\251k\013"
+	.string	"\200\316\201E\216\270\207\241\3465\016\217\322\233$\021\326\t\365"
+	.string	"D\017:\374\345\260u\002\237z\005]\300c\244V\002\301h{\333m\357\224\002_"
+	.string	"f"
+	.string	"]"
+	.ascii	"\035\235/\375\026w\321\372\017\353\004vu|\220v\313\021;\330^"
+	.ascii	"]\336\300\351u{\310\351U\263}\026.\351\310\032\333.\351Zv\275"
+	.ascii	"\344\241y\016\323\007\241\036\273%\367JO\334u:5\227?a60\247?"
+	.ascii	"\372\202\236\03599\212lF|\026\270\006\300dw\275\221\270\353m"
+	.ascii	"O\260\315bO\021\001(\223$\231z\225kSC\376\207e\"3S!\207\351\261"
+	.ascii	"\226O\364\"\243^U\262\316~\021\f\227\r\246f\223\001\315\224v"
+	.ascii	"\313\006\257\006\267W\225\215\356>?\221\355\326\207\314\343\f"
+	.ascii	"@(\355\256\310\2531l.s\346\205\003\324\325y!\377\305\201Z\017"
+	.ascii	"rq\200]\023:,l\257)\315/f\315\231W\271\273$\252\025\001"
+	.string	";g\006y\202\223\355\221\327P9\300\263\273\021\374\244\323\b}\024\257\3560\316\303\306\037\260\245\230\331\344\037\375\344f\231\226v\322\035\0313\350G\232s\346\377\3741sf\252\321\035\373\332R\035\333\323\257\"7@J\354\3224\371X\234:#\305e\177\3547:\265o?F\372F\217q\331\217\034(\226\330\002\212\025\034O\302\013\240\350\275\240\210\036\205\357\363\006\370\313\360\240\004\002\t(a\205\300\003\210B\375\255V\302\224\026O\0049\200\337\347q\243\030\216+\340\310\255\244x*\334'\216\334J\201C\026P\344Z\302P\344P\247:\363f(6\177\327\3514\004\265I\f\225\241!=\002\346\274\206\223\235\262a\036\346\324\213\302x&\251\300\021- `\242a(\357\322\214G\007\001?,T\304\341\307R\001\266\240\013\177\270\035\rQ,\343\371\002\224\300\025a\241\271w\263\242\216\360P,\374,0T\202\212gx\241&"
+	.ascii	"\205\371\267E\2238q\0038\274\r\364\253y+\361\202\024\002\354"
+	.ascii	",\243N\022\244:\357\327\333{\377\346q\002\334'P\257S@A\275}\211"
+	.ascii	"S\224\335\177\255\032\003"
+	.text
+	.section	.gnu.lto_accInit.part.0.97.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\020\007%'"
+	.string	"\312C\260\016D\200\236M:#/\323\316\036B\245\024\301*\332\356\243\276(\251|\373\325O)#I$T\260\250\305\242}*$\tv\350\002\307\204\261/GL?\330TCU[\275\326B\220\317@\3244\030Y\333F\b\331;\245\321"
+	.string	"\316"
+	.string	"\325"
+	.string	"\245Y\334^rX\322\205\345U\257\300T\361\215\213y\003W ,\257\335=I?\354\311>\3750(\373\364\323\261"
+	.ascii	"I\343VQ\r\3718\252\364F\377\353`P\307\0024n7\313I\230]c\321K"
+	.ascii	"O\270\275"
+	.string	"\334\335\200\371\222<\001\363\245\375+\246`\341\211\212\202\005(\007o\334\002r&ithQ\3335\362^\326%\256'\215\367\215\006\257;s\270\233\315,\311J\001\004}\233Q\324u\324\310\317\241,\253\"\317\221\273\"CQ\250\210P\034)@\002\231\016z\263\031)\261*\336V\274I\366!7TC\310\035\355Q5EKJ\254\272:\371\2603\270\312\"%\207\254\352\352U\212\334\355n\256jH\351\200\003\260\031\355\256/<r\013\335\266\035\333S\266i\025[\273\302\023\323\364\024\240\251>\221\fk\224\355\024?\243\302L\231W!&`\264L\017\335#\231\366\212\223A\022\262Y|LO\267\265\273\027\304\274,\311\347zi\237\022=\361\245\257d\276<\260\225&\244G?\354\271\2625n\226\256\321\252\345\n\340tw\243\\\223\330\246>O\352\034.G}\263\341\250M\033uy\243&m\324\365\306\237\232\324G@\324$"
+	.ascii	"\326.\220c\240ER\212y\362\261\323\004\306-+\252/O\256a$\265#"
+	.ascii	"\007I\346\345\314Km\207F\242w\271\227\033\256Qw\344\020f\361"
+	.ascii	"\244\212:\2126\336N\300\276?v1\237\314\247\237\274\033\016\025"
+	.ascii	"\217>\3660\237\313\320\220#\373\\\266\230\314nh\334\252\023f"
+	.ascii	"\302x\251\355.\321\003\364D\357\246\350\302\020:#\332\236\361"
+	.ascii	"\343\207\242\263\335\315 \350\203@\204\020!\242\236(\244\254"
+	.ascii	"f\375T\036!=\256\225\025\367\007xS#+\016\214\354\377aF\245\332"
+	.ascii	"\252\226\211d\326\332B\214\316\220\002\262\237\366>H>\227G\220"
+	.ascii	" a\276\254U7\247H\315\244\224U\013\317\367\3501;\302\346\324"
+	.ascii	",\b\033RgVe;;\320\264K\034\r(t\247\301Y\232\220\036\255+;\376"
+	.ascii	"\315wQT\220\353\277\273[\253\226\355:F#\005\225\251is\212\324"
+	.ascii	"\217\034\243\221\203\312\034\020\034?\216\321\310\243\240\003"
+	.ascii	"\3157\313c\255kw\037\264\261\215Vj)\356F\035\313>\033\333O6\332"
+	.ascii	"mk\251\240l4S\342\366\340\321\265H\366\301KZwSt\220iY\237\003"
+	.ascii	"\364bW\203\342@~\341\264\204"
+	.string	"\243G:\311E\005\n\030$\3704DH\020\243g\343\347\263\301\024B\211i)\306\f\031=\023M?\240R\001'E`jZ\242\321\373\371b\370\222\222z<\247_\223\023\223\317\211\307\264\324\223\301K\3729\361\",p\323\f\337\217G\243\251\351\307;O\267&9\252\303d\013\230\363\017\232\347Ym$\254R\2723W\355 \024J\fJ)@y\364\204\350\216\260;\320\002#&\207l\217\230\316\fK\256j\371A*f\316\301)4G\220\312mwx\301T\212\016\203V\202W\202_\301/\363e\256\202q\251a}\201\235z\262\262|\200\232\251\256\037P\370,]3\373\302U-\237Ml\270Z61\211n\253=\212n\253\036\312 Y\325HH\336p\365c\337\t\351\232!\334Vq\365SXR\364\350\"!Sv\224\254f\275U\273\203\207\200\217\250a4\006\225RfDdd$IS\350p\002\231\032\253z\022"
+	.string	"\3261(\025*SI\241\264\037c\331\351\263@\302R\223\036r76I\313Ds\360\312/\033\217\203\007U\317\200\330Q^>Pw\226\n\004\233d\377\304\224\264\272\234\250\343\3500\231\267\345\350\266\005\317+#\330\021\207\247\304\341W\322\361\3212\307z\260D\267\232\272\252\255i\267R\005\237\253\033g\320~\337\0224V\246\265\013\337y\316\022\200\320[#\251BIY\201\025n\302\232p\236\214\377A\301\006!A&\207^\302x\266:\304\232\222\311.(\r\234W\313\325\277\305X79\356\306\302!\233\263\0042 \274\2357\272\1778\f\233\244\035W\310\232\022z\375\274\005\327\334'\254E\367\306"
+	.ascii	"Spo@x\f\301j_<\021\215\233\230M\270\313\327G\277\376u\363I=\232"
+	.ascii	"e\243YL\211\013\212\357\033b0X\322zL\r\370\356\301m\300\352\202"
+	.ascii	"P\220]\346\2179\241\342S^;\235\321\327Fr\323F\301\257\220\224"
+	.ascii	"\332\024J'\345`\347SEz\001\035\363\200\354f\334;~\f\323+\231"
+	.ascii	"3P\001"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.99.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\371\013\275:"
+	.string	"\212c\264\025AP\246N\007K\305\253\371\037\353\3078#\013\235\002S\310\375\247v\372\353;\3565|P\337\2061Db\254\024\357'\020@\025"
+	.string	""
+	.ascii	"\020\020\b"
+	.string	"\343^E\337\034\346\017*\f\n\373\251\221\335m\357\235RJ\001E\0013\001L\001+\030s\225\253[\342w\357\225\352\224\271\326N\237\320VR\325\364\232\032\035\307/\245N\03055\230\211=\227\243\343\270\345R2hgn\367\336Fs\346FU\230\217\ruA\374\356}Ju\3524\346\n\365F\223\243\317\334`q\233\251gE\221_\2126\223\003\345\206\373b&r\303\265\314D\376\3522;\230\236\267\214y@\321\225{?\271\337\232L\333ev\364\361^5\2726\367>\247:e\007k\247\374\354%\265\323\265\225\324N\231\273\215\231\277\230\314-3\240~:o\327\005!;\003x\357Ev\372RT\376F\237\315\303o\033\351\310hT$\016\331U\250\246\350\373\261\345\006k$a\325\\G\001\266q\013L+s\366\221\2236:9s#\250\264\262&]D\027\370\331\031j=f\023t\211\310\225e\3031q\"\212\324"
+	.ascii	"N\022\037\n\253\242\224)iVI\257p\032J\217\271\004}\202k\250-"
+	.ascii	"L3\027\242H\367^c\223\fm\340@\232a\256\016\265 \351\324\227\315"
+	.ascii	"#\215\242\013\316\352\03016\307\320\245<P\374\020\233b\376}\327"
+	.ascii	"\013\002\357,\233H\332\223\372(\254\272\367r+\331\232\223\232"
+	.ascii	"\271G0\263\0273QAi\255\224\213\343\003\3755F[\204\332o#\216O"
+	.ascii	"\314\0211\367\235\306#\202\273\n\2230aB\355\264\277\211\315\314"
+	.ascii	"\350L\214\336\367\337{\301\376\327\230Y\252\333\2561\240)\357"
+	.ascii	"\032\365\222\266\364\227%p\320uA\356N\252\314'\272N\262\350\274"
+	.ascii	"\367N\340\236\323tPpW\351\224U\254\360^\256P;E\260GH\351\203"
+	.ascii	"\334p=\314\343\242w]\320\177\215\377\330}_"
+	.string	"\215\231u\216b\235\241V\347'\326\331\211u>\300:\033X\235\233X\347\002\2543\001\326y\300\352\314\304:\0138r\016\240:/\365\263\033\300\320Y\211uN2:\037\215\316HG\254\263\321\310\331\210\350\\,:\023\211\316C\326\231]\207\316B\225uNWgtu\376\266kv\241sO@\2469:\273\227\310`\242\213\226\336ai\273n\274\226\303\017$|q\022\275fc\357\007\020\217\033\340\025{J=\220P\203\223Lc\337Gg\316\r\360\336'ss\343\301y\263\344\252\361\3360y\243\246\216\255\355\356\230\310_\374$\366\274M\346\275\367\307U\3335\034w\033\247!W\314\335\206\233\256\331\264]\307x\001Y*\322\037\237\235\314,\314\007\235\370\262}\302\200=\370\017\020\t| =\00362v\210\277\306\304)\354\321\247SV\251^\327\264\310\372\215\347\303\243o\274\365\217\246\316\334\030\271\274G\373f\300\307\254"
+	.ascii	"\270X/\007\275\361Q:\262ET^\\k\245\250\2754\372'\261\007c)\037"
+	.ascii	">\361\231[*\255\025\357e\361\237\306\036\214\331\357\013\004"
+	.ascii	"{\313\301\026K\313)\352E\255\226\226K\353\305\213\332)\361{\211"
+	.ascii	"\204\375\341\243vz\370)}\220\253\005\333\267\346\203\310\252"
+	.ascii	"\3538\003\331o>p\272\207\344\341\261\374\274\367\256\257\306"
+	.ascii	"\335\202Q\205\317\"\256\257P\033j\301\264b\332\266\266M\355T"
+	.ascii	"\370E>3;\341\2571\333\227\252\377}.\325\376@\246\332\377\252"
+	.ascii	"O\314\021\t\246\371W)\321{\357U\325'\245\0132\203\366W\277{\234"
+	.ascii	"\205\371 +8\003\223\376_\373&\300\331\226\351AVF\247\240?\313"
+	.ascii	"A\350\247\337d\213\002m\240\332\003\324A\201\363\017\b\004N?"
+	.ascii	"\350S\361\335\025\363\332\324\300\264\364\327\276o\303\205\n"
+	.ascii	"\334{\315w\225A\203\006\265S&\272\345 \245\017\352\350>\033\032"
+	.ascii	"\257\0023\207\346\323\241\351<\364\036\020-\267\327\251\236\377"
+	.ascii	"\306c\273\213\023\311-\034X\350\221\263\\Dx@\241\201\226\005"
+	.ascii	"*\246\244\214-\257\0210\262hl}h\301e\025#F\227\327\221\263\250"
+	.ascii	"\270\272\266h`yi\305\320\312\312\302B&\275\272\222\\ZI$\327\026"
+	.ascii	"\226\fd\226W\022I\025\305]3\264\274\2204\272\272\274\220\304"
+	.ascii	"\356\373j\\\245\374\260n\270&\021x\003\375\224HQ\377\346\326"
+	.ascii	"\006\365N\037\365\364Pb\302<9\027\377\342\245\2137\343\251\235"
+	.ascii	":\0259\360Z\262`1\360\005\376@\323\033\260R\245i\312\247\260"
+	.ascii	"9\013x^S\217\300GY\263*\252\rx\001O\340\275P\217,L? \215G r\357"
+	.ascii	"^1\036\202\376\204\207\242)\347\275b\216\026\202\307 w\225\033"
+	.ascii	"j\247L\217\344cf\340g\355\333\322\\\023\253\242\223\211\200_"
+	.ascii	"b\273\353\271\036\322\031\224\353\265\320\2356\201\177\001\276"
+	.ascii	"\321\260'"
+	.string	"q%X`mX\230\332i\200g\315\374N\363hL\320\370k\234T\227.8\332\355\017\225\271\005\322\n\361^.=\0044\317\013\324\273mT\301\0014\333\"\305\274?\275\342\257\035j\245c\034 \260?=^v\244mS\372&>\2635]\302\220\336U\323)\030&\340_\236\240\b\236\364\035\347\3146\311z\257\262\227D\254\002\354\ri\227\264M\274\227|\374\244o\270n+d\213\006;\200\365\250Q,&\231C\206FF\202H\222$\351\220\002\221\2412\326\001\021`\255C\212jFUg8N\016`\213)\224Eg\225rS\222\005\003\213\024\243\026\312\346,dS\332\277\357\312\265\336\260||\2555\237\"M\364Dj\364\231\352\331\322IWa\325\277\275\372\250\343\273\033K\357\364\353\373\264\366\345\242\036\221\203f\363`\210o\324\"\354\270\260c_\2140\322){+\361U\021\210\237l\357\177;\346qh\017\250\270"
+	.string	"\027n\265yQ\355\022[\025\205\374\374\371\223\356g\202S&#\276\021\256\177\234>eQ\3715*\3142\022\232B\2324\342\341\2632R\327\030v\226p&\307>q\2068\242\270!\210\203\323\266\207\271\375#\231\307\264\337\242N\270R}\200@f\302\366\340\021\310\031B\364\330]Z\204\213\356\255\331\241\210\353\232\026V\306\346\376\216\372=H\322|\027U\214\3745\301\346\306{\367\326\021\243\377\267\b6\n\300\225')\273-\223\375\213H[nt\033\250\375\256n\242Q\"\324\321\245e\224\261i-\267S\224.\344\020-\225X\2316>\240\230\027Ds9S\300\224PU\210oyc\375R\367d\020\004\004\352H\001\002G\213h\346\005\306\301\346\203\215\310\226X\033\262\0325\240h*0E\351\003*\373\303x\024\252\231\277EF3\027\361\376\315\016\304\363\354\217\243\225{\025P\307+3\362?\212\211\032F1^\220"
+	.ascii	"\216\b\340\021r\302\362\352h2\356#h!eiK\335\316\300\241\311\254"
+	.ascii	"I\310\266\320H3o^MgM\200\031*\314?\250\177q!\334\224\347M\262"
+	.ascii	"\366\266\027\252l[\243\202\227\r\207t\316e\033\223\022yf|@0\327"
+	.ascii	"T\353\243\346\002i\231\177\214\377H\351\365<tQB\262\304\217i"
+	.ascii	"g\363K\003"
+	.text
+	.section	.gnu.lto_setAccelerationFilter.part.0.100.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\177\002}\024"
+	.string	"\266\247\205I\320\322(\035`\002\365\365H\364+BWK\260\033h\b5\367F0\210\222\217m\264\234\210`G\204V\273G{\353=;\377\345\325\323V5\330\340\277\035\245t\223\037\0133\273\220\362 \037([\2525bX6\211d\023\271S\nl"
+	.string	"l"
+	.string	"m"
+	.string	"\273+(\274\027\225\357\3710\376S;o\346\271\233Sdc\267\2272\002\361\323\344\001~\022~J\333\367\261M\273q\315\376\361\336\212\275\221\216\017AAvW\365\251*\254\007{\267\312\332A\225\263\346\213\260"
+	.ascii	"}D\267\263\035\004Mv\267d\207\003Wv\367C\2276\273\233T\022\027"
+	.ascii	"8\227'\237\",\273kq\304\035\336\366\005\333+[\262\b\377\252\216"
+	.ascii	"\035\212\322\363\277\033\024\221\326PZN\351\223\fx`bWD\323\220"
+	.ascii	"\315\231H-\376\373}\227\366\375\337c\370C>\231f\024\256\267\273"
+	.ascii	"\033\024\242\227\377\356\363\205Ph\274\330\027\362\203.\243\366"
+	.ascii	"\031N\022m7\342\220\321\016 \273kA\374D\201\367}4\037\310'\333"
+	.ascii	"\264\363f\322\300\336r)\237\276\257f\237>\315\3013\t\002\267"
+	.ascii	"\033K+\231,@^U\247\332\022&\310\353\214\312\251\315~\216W\311"
+	.ascii	"u\2667\034\007\205T\217\335mp\343I\025\374\036\030\230\360s\352"
+	.ascii	"u$\244\252>\007\344GG\232\371=^\215\243\216\224"
+	.string	"\260Y7\302 \356\356\002\277\3505Z~\317\2473\314\310\353ft\344\347&\233\374\241?\204\222\317\322\352\356\332\244O$\231|\336\335r\223L\326\177\352\216\035\261V\207\025\3501FA\002\006+,\007*\004<@\220ip\211\241\2110\216-2\253\226\254\345j\001\360\250\342z\265d+\030K\2065\216+U\f\366\212\271X1\225\253\265\232Q\215\260\230J\245\200_4,\230J\366z\301T\362_\325\361\201.*\035\361\270i\r\250;\236<3\345'\036\031*\2506\266\235:\250.>pR\310\304I\001\232\005\324P\377;\352\300A\r\365\271\0235\262\311)\024/\0021 @\002\202\224D\346\001\202\021\022C\204\311\206\035j\013\331\324wkv\364\366\256\027\032\231DM\210\321\345{l\031\336j\331Eb1\267\313\366\332b\341\357\311\0061\307\273e\017L\240\277-\272L\255QR(s\340)#\270e\203$9"
+	.ascii	"\305\236aC\r\002$\034\206P\034\313\322>\306\217L\373Mm\313lU"
+	.ascii	"\273\313z\201N4\0357\266\301\274\345r{OPx"
+	.text
+	.section	.gnu.lto_.symbol_nodes.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\325\003\315\021"
+	.string	"V\232fH\300ZI:PEiAP!!\315\245g-m\221\021\310C\rn\333\244\f\204\307 "
+	.string	"\244\254g\017\322\326u\344\366\305\354d\324I"
+	.string	""
+	.string	""
+	.string	"@\n0\323\260H_\023\337\347\376\264\255\001\246\271\245\232!\006h\023\"\267L\001O"
+	.string	"]"
+	.string	"Q"
+	.ascii	"\347b\341K\024\004kR\205\376\026)t,\024ne\302\243$\274J\204S"
+	.ascii	"\331\202\016%\003\364\231\244\224\306~\332GB\260\331\036\223"
+	.ascii	"\241\361\371\323\306\377V\332S\263\375\237\024\004i\322>\350"
+	.ascii	"\036\t\312\224\376\376\237\202\254F)\245\016Z\201\374\257A\005"
+	.ascii	"aX\364\247\354\212o*r\266_\207\021\216\0335`EFC0\033\257o\355"
+	.ascii	"\221\342\265\241\350\240\023\r\264K_\210\3700\321?%\272\001\211"
+	.ascii	"\346a\036SJ~\214h\006<RY\214\210\350\005!:\201\006\242w\250\322"
+	.ascii	"\207\326\221\036\372c\207?\341\360\246\r\375.\3621\r8\031\\\030"
+	.ascii	"n.t\256!Z\204L\216\367\310\312\225\026`\\\266Y\361\2545*\336"
+	.ascii	"Q\367QI\220 \315Lf\2114\223\211\216\226\200\027 M3\3134\372K"
+	.ascii	"`}qF\237IQ\277\211\214\276,F_\nQ\337\tF?\312\213>\224\241\276"
+	.ascii	"\023\027}\246\026\375+\373\377o\005\237`W\200s\264\264\r\271"
+	.ascii	"\026\003\b?\216\221\362>\236\342\353\343\035u>\336\272\363\261"
+	.ascii	"\020\202\217\273p\r8\025\231\251<V\035\355\"\201\231\232\035"
+	.ascii	"\360x\326\216\005\2147\034\017\250\2732J\251\213\343N\304\341"
+	.ascii	"\330\013\227co\334\315\341\230\305\264\001N\250a\020\344\211"
+	.ascii	"\207\206\024\225X:\300\002)\"\242\007\021\240 \r\231\221\210"
+	.ascii	"&\230\030\222\036w\354X\230\346\007R\212\354\221\207]\261\304"
+	.ascii	"2brr\315\223\0216\3338\325\367Zz\344\\Z\032kL\212JQ)*EM\373\236"
+	.ascii	"\002\"q\327O\241\307\fbej\224*\022\227\342\205\315\241\033\311"
+	.ascii	"p\222\fA\337\034\272\020~\263Q+\r\365\301u\327\220\361\236\207"
+	.ascii	"\027]\321)e\216M-\343?]FC\232\331Tn\013)U\252\222\307\356J \001"
+	.ascii	"\2664}u\300\200B\031}\003\351\n\247\n"
+	.text
+	.section	.gnu.lto_.refs.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\265\t"
+	.string	"\366\327A4PI\233t@\275\036\201\372\323\350\031\226\231\231\231\231\231\231\231\231\231\231u\212\024F\252H\215\343\260\217\201\037#\212o\037\243\255\255\277Y\230\265D\032\331d\313\0240"
+	.string	"6"
+	.string	"3"
+	.string	"N\277\234N\275.\275\016\275\356\264o\334M\344\033`\277\202\177 \237"
+	.string	"\373"
+	.string	"\354%\332O\330G\360\257\366U\366\211u)?b\017\261\376\360*\276\227\024&Hh\177\204\347\207\020\3653\321\377\300\3651\356w`q\376\312\373)\357\027\274W\320>\301BG"
+	.string	"u\003\356\001\264\237\310\036\361\364I\276\344y\310\323\035\3343\002\026\006\331\247d\001\374\001\211\013\310\376\250pG~\203\372)\241\305;\206\353\222X\277\250\360\213z+\177\242^\312\376do\211g>f'\350FQ\251_!\377\217\023\264P\302\250B\340\330\032\351,q\314!8\342\217\216\330\207\256H<\262\036\312\376:&:\232\035\253\273\006vc\365f\265\201\273\no\324\f\366\031\314%\021"
+	.ascii	".\333\224+s\277\326\260\202\t\005\301@H+.\300\202\261\331\234"
+	.ascii	"F\013Ka\rn*H\324\303\0071\r(\313n\331\374\301Z\320"
+	.text
+	.section	.gnu.lto_.decls.550b119b0c29bdce,"e",@progbits
+	.string	"(\265/\375`\203F\2453\001J\016\326rW \nQ:\3514F\375\3360\214@\254\241\031\274t\377\004\371\243\245y\362\336\210\240\261<#0\030\032<*(\344\235_h\332\274\335\241\005\302@\322n\363\002\303u1\2549HUW\250V_\243"
+	.string	"\320\264i\344b\237c\356\2363.J\216\t\336}tGB6\221;\005\032\006=\007E\007M\315\354Y\223sS\217\265\022X+\301]\262U\244\251\336\247z\270\231\020\275\303TpMa\365\255"
+	.ascii	"\017?\005\203\233i\203\324\016\026H\ra\201"
+	.string	"\324\247N\214D\250\347\005\216(Q}\237\246\341_\360\243\203\240dV\270\331\243\315\337]}\3046\333H\013\371ef#=\244\213\360<1\363U\360)\006\013l\247\311\347'C\275(4\221\036)\024V\b\351\373\224\n\205\264\t\377\222i \215\365$\310\345\322\\\027\013\376\215\202\337f\201\324\316@\352\235\026H\375u\2021\323\006\2516\312\002\251\035\032\007\263\007hw\006\307Y\337\337%\370\327\007\376\275\201m\266@j/\273g4\215\367\262e\\D\006\327y\352\345\315\271\311Z\tx\254\225 \245\202B\223\023\365\376\312\300G\327`k\365\002\253\237\264h\232\321\267\261\376\236j\252\276j\235\2665P2\372\266\213\256\262\315Si+\340\0233\233\001\261\242\004\322\367(\032|B\3169\333SQoNE\275\323\006\251:\026H\375[\252\002\3744%-\254E\263@\243\246\262\362Y\316\314\237\273\3341\246\244oGm"
+	.ascii	"-\354\257\357\3219\374\013~+v\246\225(\263\r\257mQ={E?\265\212"
+	.ascii	"nj'\333l(\373\274-c\315\374\3320\021\0314\224u\332.(\263\353"
+	.ascii	"&\312\226\024\263\241\254\023\273\005e\266\201P7\365l(+\306\346"
+	.ascii	"\241\3146\274\302\t\213g\316\314\333&\re\275\3300(\231\025Ns"
+	.ascii	"j\361\314\231\351A\310\203\007\017\036t\354\372\252\300\350\334"
+	.ascii	"\316\030t\262\3305s\337\243M\334\306\262\261M\373g\367\332\354"
+	.ascii	"\032\353\344*\241f\315\363\317\232Y=\2364g-\277\256\2343\006"
+	.ascii	"\017\036p\314\004\251\241^?\241\235\037YIt\364=z\004\337Jq\313"
+	.ascii	"Sc\371l\323\366\3314f}\366\315\252\36141\263\025\007x5\306\204"
+	.ascii	"<\240}fZ\236\352}\373\341\367\027\374[4\267zf9\347\0139/\234"
+	.ascii	"`h\364\025At\213F\005\203"
+	.string	"\333\321\327\367\r\207m\226\rR-X \365=\206\355\030K\3066+\260x\314\236\026\302\006\315I\337w\022|[\201\212\376\375\331\n\324w\020\013\306\326\355\251a\321\367m\003[;\373\3056\307l\223\337\262\254l\2263s\007m\222\241\205\255\357m\007\265\347\357\357\357\317vP\337W\330r\261t\266\271\301\326]D\006G\225e9,gf\317N\033%m\374\372\276Y\340\333\r\252\375\263\033\324\3335x\016\203J\304\213\032*}o\355p\233\305b\235\\\267\315\332S\213\315b\233V\316\262\311Y3\273\306\223\346\334\244\326\225s\366\200\301C\216\016\036W,\324{E\b\345\273\322\226\326\367V\n\276\225\342vf\233\300Y5\2364\347,\264\256\234\363\177k\305\306Y*\266i\253\330)o\346/\370\211n\253\3307\253\246AE\316Y8z\350\362\244b\360\345\234=x\020\362\220\356=\373\312\340{\233\003\3376\341w"
+	.string	"\337\004\374%|\013\340\337B!\263eV\315f\345\374\224s\276p\203\005G\366\326\327F\261g\266\211\301\246\335>\261R\2366133\347\334c\315p9]\365\365\261A\352E\300:E\267h\217\240)gp\036\354\201\234-\006\325\376\375Y\f\252}Bt\013\345\267Ll\030\220j\265d\346\263\234s\017\332V\005jM\337\266@\352q\360\033\207\260A\252j\201\324\267\331 \225\203\rR\257\005R},\220z\246\rR\261\005R7\020"
+	.ascii	"-\351\302\177\257\374(\001\320\n~\333E"
+	.string	"\2038\034\264\207\312o+\240\003@)@\005\360\367\023t\202\343\371X:[\367\344\277\332\353,\220\337\262\275\375\002'\341\032\332\004T\002a\211\377:\261\277\365k&\232\341\357\n\374m\0014\002\030f\277\235q\274\177\371Q\f\377A\370_\201\215\361\243B?\n\301\006\035\376\273\201\277\277~\273\001\375\221\263Z\216\026B\370\177\r\232_\004\334\f\376.\341\357\244\037\365Y\373\355\206\346\240\002\r\\*o\277\377e\3637\016\332\363[\027\314\337^\331\252\373\374\227\f\311o\317\240<6\256\312\005t\207\004\002\324\375\026\356D\377\375\360\333\032\326\006\031\226\377j\r\244f}l\005t\347\277\320I@q~\024\377]\314\271\027\376\343\021\340o\023\324\377\346\241\352\177\022\376\343=\375/\230\2775@\323\277-@\357o\357\217\242\277\305Nz\013\332P\332\013j\305\332\372\016\375\337|\277\335\353\2776\277\345\373\257\341\267y`\372"
+	.ascii	"C\3775\376\r\202\215\013[\365\333\2603;{\001\003\026}\263*Z\377"
+	.ascii	"\307\003\236\347\277\300\377U\376[\371\017'\367\377\312\377\271"
+	.ascii	"^s\235\377z\261\300\347\374\227\313\377\276\377i\316\346\277"
+	.ascii	"\237\205;\376\257\226\277y\374\375\343o\037\177o\375\275\343"
+	.ascii	"\357\036\177\003\031\322U\177\353\370;G\253\371\337\363\247\022"
+	.ascii	"\370\273\357o0\177\333\375\355\374\033\313\337q\177W\371\273"
+	.ascii	"\355o(\177\223\375\r\366\267\327\337]\177\023\371{\310\337"
+	.string	"A\376\326\300\337\036\370;\003\177\233\360w\362\357\003\374=\364\367\361\357\245\277\213\177'\375\275\376=\374[\3707\006\376\276\300\337\034\374\275\301\337\"\376\016\3617\001\376\246\340\357\t\376\346\360\367\206\277#\370\373\302\337A\177\003\375\375\3637\317\3379\177\337\337^\375\366\202\337.\371m\324o\361~+\346\267w\277\245\373\017\346\267~\277\235\361\333\013\377\325~\373\377s\277\335\373\255\317o\361o\325\374V\355\267?\377\361~\333\366\3334\277=\373\355\231\337n\370/\345\267\317\337\346\375\226\314o\307\3746\314o\301\374\366\313o\355~\353\345\267u\277\345\362[\347o\267\374v\356\267Z~{\345\267q\277\265\362\333*\277\245\362[\270\337\276\375v\312o\335~[\341\377\b\277\305\371-\360?\361\177\226\377A\177\177\177\177?^\376;\031~\"f9g%3W\t1\341B'\307\227\227\313\016j\0224\273\254\353\364\373de"
+	.ascii	"\321\273M\377\201:i\262\340xq\233\256R\352k\314\214\216\332\321"
+	.ascii	"\233:2u\263}b<\031:\372^\347\f\376o\337\277\232\233\254r\316"
+	.ascii	"X)3[9\351\250\277\275M\255\355\360\357X\324N\360\377\346\\\244"
+	.ascii	"\224\263\323\032W\316\331\242\301H\330\232lp\310\251\323*\312"
+	.ascii	"LK\331\201\326\325\223\326\214(3\255\253\237(3\255\254|\"\242"
+	.ascii	"\374\261\312Z\312(\263\234\177\236\236\224%\262\256\242\314\232"
+	.ascii	"\362O\224Y\276\312*\350\256lfj)\363SV\376\311O\271)\233e]q\210"
+	.ascii	"z\322\272\2122k\272\372\2112\323\272\312fZ\331'?5Y\261x\312V"
+	.ascii	"?\331L\253L6\313\272\362\2112\313\272\2122\323Rb\203\260\260"
+	.ascii	"\333{\241\306\365\203\206\345\022\365\224]P\335h\262\362qF1\263"
+	.ascii	"\362]\316\366\f*[eg\316\023\344|#\313\352\256i\206msr\272p\222"
+	.ascii	"\322\224e\2319g\fTN[Y\371\311\251\264\331\031\345\225\225\263"
+	.ascii	"\227\023R\246\3129g\f\224Lg\006b\235J\0367\362\024T\316\021d"
+	.ascii	"f\316T9+mv\346\234\2259\347\033\253\033\314\234k\370"
+	.ascii	"DuQQ\345\274\024\242\3127\224nP9\367Y\230\266\253(\263\255,\""
+	.ascii	"7(f]y\005Si\243\246\262rW\276\323\262\302fJ\262<\225s\266gp\327"
+	.ascii	"\325\0133}\231N\316(\231\321\267\017U\203\223\245\226\230\365"
+	.ascii	"\275\216\222\276\f.\212\216\352\3356Q=4M\007KfVj0\342F'\307\227"
+	.ascii	"\255\226\037n\262\326\334T\364\335\273.\250\322\240\372^\307"
+	.ascii	"\n_g\n=\3233\244\216`\365}\316\037j\246\214U\267\211\241+{\346"
+	.ascii	"\215i\323\023\353\313<{r\346\266\002\257\215\204\231\253kCfL"
+	.ascii	"\232\021\257\265F\302|\222[\002\241\023\363\265\303\203\311\222"
+	.ascii	"/\314\301\2649Sf\326\227y\235J\232$\271\203\352\001\222\343\f"
+	.ascii	"\327\027\2644H\225\246\022\273{I\302\245\007W_&\bdz\030\351R"
+	.ascii	"\207b\271\034\253\313\027x^<\001\253A\007\265\263C\207\024)."
+	.ascii	"w\251\023,K\232\234\035v\372\354\234\300\266\310\270)\002W\205"
+	.ascii	"\312\034\252\305:\301tt\311\035\325\322%\003;xpL\024\372\242"
+	.ascii	"Y\210\216\312%@\b\217%}Q\024\313\206\036\246\f*\036W\226L\252"
+	.ascii	"l\235\305\331?L\205M\334\233\225\265#\2168\276*\030\276\334t"
+	.ascii	"\370\240\322\312\033\275.hX\340\320)\300.rj\340\246\330-bll\300"
+	.ascii	"\274\241j \330E\241\321\367\027\240j\275\003ES&@K\2151>\030j"
+	.ascii	"\035\243\227<Jf\256\022q\307\254\241\3267:\207u\236\225\b\233"
+	.ascii	"{\326@\325\332Fc\361<1\263\222\203-5\306\370\332\3205\224\ru"
+	.ascii	"\263MT\rm\036MC\245\360(a\262\345\t\316\305\3116H\265Y\026H}"
+	.ascii	"N\037>\263s*\240\004\351\373\234'\326:\312Di\240L^p\370\272\032"
+	.ascii	"\363\342\223\362\367\026\312\3540v\re\2661`\013\310\363\005\272"
+	.ascii	"\274\300m\314\013\214\352\357\036\355\243\275P2+\240\013'`\317"
+	.ascii	"\024\2162[I\333ip\212\312\031\013\203$nc^|\275\2052\233\213\211"
+	.ascii	"\266@\261\234\344\210\202\232\241b\250\0234\fm\202BA\313\320"
+	.ascii	"1\224\f}b\233(\023\225z\353\350\254\013\201i&\312\354\272\201"
+	.ascii	"\342$\310\023e\366\030\224\305\021\n\220\224\031\363\342\353"
+	.ascii	"\036(\263\223\024\351/\177o1\373\256\227\326\271\314\3122\024"
+	.ascii	"$12\346\305\2273\023=Be\267F\350.\311\351\022\323\212\352\373"
+	.ascii	"\234/\374\013Z\240G\236T=u\240@6\200\262\002\272\360\262DS@\223"
+	.ascii	"\240`\250\022\333D\277P$\357\255\346a\305\320/\324\253G\215g"
+	.ascii	"\316L\364\013\255\201\346\3202\300\024+1X|93=x\020\362\340\341"
+	.ascii	"\346\006\224\033\016\234\373\234\036\3709X\270\0135R\204\247"
+	.ascii	")\314\212\027\233\256\"\267\317\253i\f\221\243EnY\236\223\035"
+	.ascii	"}Q\024P\036~|Cv\364E\207`\255\032K\236}Q!\266\213\224\2550\261"
+	.ascii	" hY\230^\223 \266\213\226)\247\276?P.\037=xuPK\276\374\360\201"
+	.ascii	"\0237$\206\225\036G}\364\027\273.\314\276\350\016\224\307\177"
+	.ascii	"\240E\323u\325\305c\013\3253\313CC\243\230\271G\326\214)Z\255"
+	.ascii	"\006\003\002\372\234Z\364E\263p\304\344ey\353{=\333\345?0\335"
+	.ascii	"\332\033\303\326\3678[n\2408l\250F\356\200\374\271\335\260q\321"
+	.ascii	"hpm]\357\250\215\224\316\213H\263\357q\320\360q\300d\2403b`\024"
+	.ascii	"\274\334\200\333\222\021\243\356,\337\3018\032\343xj\030e\025"
+	.ascii	"57\320\253\25252\334\212\364=\316\n|\333D\255\320*5/\026R\\\034"
+	.ascii	"\255Z\352d\r:j\344\346`\364\275\036J\365\037\310c7\3066\245\357"
+	.ascii	"\217R\241S<TtY\013\235B\245\200{wl\230\364=\260\r>0\rF\2430\330"
+	.ascii	"6\245\032\251\276\007\212\301(T\223\351>\037g]*\320\025\266\211"
+	.ascii	"B\265\032\024\252\375P\2475)\317\017Pj\330\324\213:5\0334[\347"
+	.ascii	"Y\t\270&\332\204>\331&\352\204*\317\232\240N\275\306v\261\316"
+	.ascii	"e\002\332\322\236<E\2200\021S\357\201[\360\375z\212\242\245\377"
+	.ascii	"\272M\336\331\301\303A\305\253\357\201T\360\201k\370@(\370\300"
+	.ascii	"2|`\ni\232\3176\273\257\367\312\264\236\006\247\250\006\3101"
+	.ascii	"y\3665^?o\242\224\t\302\207\247\004\201\003\242\336\003\255\364"
+	.ascii	"\320\354\260`C\362\305L\237\301\211\261t\302\365=\360\t\233\271"
+	.ascii	"uaDE\226\276\307~\370\266y2\235w<!r2\304\372\036\357\341\343"
+	.ascii	"<|,\006\037\177\301\307N||\005\037K\301\307e\370g6Hm/=<~4y\351"
+	.ascii	"{|\004/i2\224\331\345\201\223\013.\335\245\351l\263\353^\327"
+	.ascii	"eme\003(\253\b8Q=\353\332y9\rNQ\271iG\b#|\177m\370<\\(\\Wt\340"
+	.ascii	"\373\2334\370\266\214\r\203urup$\rN\311\263\255\264Y\257ip\212"
+	.ascii	"z@\234\024\267S\341\001\346\254u\3265eIS\275u\260\316\263\022"
+	.ascii	"ma\317\234\231V\232\312\251\360<\371\344'\"`O+f\245\3330\250"
+	.ascii	"@\270\332,\371\264\364\226\216k"
+	.string	"\271\306\322Yz\256\257\330f[\351*\027\362 \224By\302\347W\341\376\346\b\376\215\020\374\233-\374\033\033\3707X\3707R\3707N\370j\237\232P+\363\350\252\372^\275\303\377\273\331i\266\331R\032\312\255X;\271\0203g)O\372\214G\371\2233\0172]a?\221\224F\3533\353\\23V\0052wg\302\370rf\ny\360\200\256\211A\363D\275W\177\340\277\317\242\344\264\021\303\321\3066;JCaf!\236\261\"S<\372^\255\302W\243\360U%\266\331\006\251O\325\340\277\303\276\032\254\231\031H\321XdY\321\267\307\272\311\233\331b\271\231\030d\345\034\251S(K\211&\004\223\272-,\253B\205\222\252\324\231n\341\361\361\366\004l\313\234\217-\"(0\261\224\351{\322\322B\032-\307\0204}/\324\002\003 \007\026,h\225P\026\352\205\256M\033\260\324-\211\033\nnXC\223\270\270\373e\313"
+	.ascii	"\360\346\027\027\227\363\262\303\316\026,\266\253\276\2770\004"
+	.ascii	"k\240\362\366\277\245UlY\256\262Q\350\324\344\340S\231\244\265"
+	.ascii	"@B\345i\225)Y\266\302\372\246SR8!Y:RH\341\372\252\210\213\"z"
+	.ascii	"j\260\206\347\331\323\265\263\264\315\352Yf^f)\315\f@\007\226"
+	.ascii	"=/\276\034u\243\303\221\017\035r)\333\3236\271\277'mZ\251\224"
+	.ascii	"\247j?\360\346\213\227,e}\017A\031N\233O\323~`j\343\205\030\257"
+	.ascii	"\276\207@\f\377)\332\017\324\341\222\2333\323\367\020|\341C\320"
+	.ascii	"\2057\254p\342$\205\"\204\263X\335\334S\347\313\223\314\227'"
+	.ascii	"O\241\260\351D5\351\211\365M\315\266\320\300\3108[\2225%\315"
+	.ascii	"\276\207 \007\336\360c\311\227\244dB\034\224f|,\2279/;\340(\315"
+	.ascii	"\0336\230O\311\312\246\260\364\365M\303\322&\377\201=VX4a\223"
+	.ascii	"6I\307\334xp5]\321Yc\303\314\227T\354\242\241^ZK\234}S&g\213"
+	.ascii	"+S{B\320\002\003\200*\205\024R0[\226\253\020\240\225\347\225"
+	.ascii	"\263\327\342LT\372\365\024\354\3265\261\273\333\2025\3708r$\365"
+	.ascii	"\022\312B\363\312\360r\200\345\274\354\3205\316\314\005A\362"
+	.ascii	"\324\3538m\240\312\244\241\371\017\f\021F\b\221\276\017bb\r_"
+	.ascii	"E\377\323\256\264\013\265a\313r\225\220X\231\230.\276\234\227"
+	.ascii	"\035.\223/Tl}\037\004\003[\275\242\247DR\"\235\243\203\263\334"
+	.ascii	"t\325\341\n\326\227*|\331*\356\303\017"
+	.ascii	"\n\316\257\276\267P\2075P\025=\035\222\016i\026\367\311'\347"
+	.ascii	"\0368\332\262\325\362C\232\303+\t^\337[hb\rYEV\211M\363S\027"
+	.ascii	"\375\325`\266\231\3464\b\221Sn\032\353\220\304\310\215\017;>"
+	.ascii	"\262\236~}\201\334H\321H;\353{\013b\3706\254*\265\272\273B\203"
+	.ascii	"hp\212j@\330\226\027i\f\353\344\352 \005\271g\316\314tF\252\303"
+	.ascii	":\227>\371im\3143\335\3525h\220\271\256\036)W\372#\345\221j\245"
+	.ascii	">l3\335JeHI\267R,\233g\235\\\035\204iy\346\314\314\261\323+\342"
+	.ascii	"\344\271U'\243\301)\252\001ca\23693S\035\3512\315\221\243v\204"
+	.ascii	"\356\311\227f\245;l3\325q\206a\307\017\f\337\230z\3774G\212C"
+	.ascii	"\247\255\205\215\025}\323\033fY\244x\364\275\205)\374\2475l3"
+	.ascii	"\265q\204\r\221\276)\215\223a\241l!u*1\334\230h\351{\013,\360"
+	.ascii	"-8\341\003\355\2450\260\227'\216'>\320\030|\240/\370@t\370O\255"
+	.ascii	"\202\230aA3\327\367@s8m\221N\245T?\260gI\233\217\264\276\007"
+	.ascii	"\252\202\237J\375\007"
+	.string	"\202\020dKZ\337kOEM\243\236\262\370\201\235\245H\027U\337\003\271\341\247P\351\212\037\310sG\004\215\254\357\201\320\360S\025i\177hh\364M\2370\024\020\223\npp\254\351\260\321\367O\225O\237\376\264)u\342\300\037\2334}\177g\203\324\035\013\244\366\024\321Se\316\\\225g\223\276\007\312\201\001\200\245\357}\267\r\316\030\372\214\320\310\202a\327\267\215\216\230\272\265\2755@&[Z\326\370\2755\307\302\314\301\215\34515\226\355\006\313ieE\337\003\261\300\034\252\354]\276\275\233\246\001A_\327\212\263\253G\3374\257\360\005s\250\273h.\232\033\306&!\243\223\003\353\275$G\350\330\360\004Mf\314\\\351Z\32257\243\357+ \301\023d\335\347}\2426|\262S\235XW^\034\214\270\276\257@\003O\340\003\357\346\341]\251\f\334\350\344\300\362r\331\341B\031k\262\325\367\025\232\276\\1_\356\230;\006"
+	.string	"^wW\314\335\r\343\247\004\2325\261[\321\367\206A\265\004Ab\226\367\037x\233 Y\372\350\373\2371\370?l\270\275\212~\275xA\353n\372\224y\240\320\225\363\362\003\316X\023+j}\377\203\206\233Y\364[Wg\273\340\250\240\0232\246\323G\326\007\246\357\177zl\271\\\266\\)"
+	.ascii	"\230q^.\316+\205\241\f\331N\231\031\027J\372\376\307\006\376"
+	.ascii	"O\013\254\001\252\350W\313m\363ji\026>X\031\343\325\tyn\351\222"
+	.ascii	"\345J\337\373\344\341\f~E\277a\266y\303n\026`\002\222\\\335,"
+	.ascii	"\377\025\273c\027KN^\2155\276\276Wp\221g\2144}\357\343\304P\322"
+	.ascii	"\234\330h+\033\223\362\2049'\345\254\267\232\244\240f\305\310"
+	.ascii	"\316f\235g\266\253\212\224\253v\337.\334u\273U\256\225\313v\251"
+	.ascii	"\334\270\273v\247\330\346m\273h\277\315\233\366d\306\244-\312"
+	.ascii	"\331x\2009\307\245um\265])g\343yb\346!7`\336|,u\256t\001\003"
+	.ascii	"C\350\336\207\f\267\323\006\251\0068\202\357S\004\337g\b\276"
+	.ascii	"\017\020|\037\037\370>[\370>Y\370>8\360}j\340\373\314\300\367"
+	.ascii	"\201\201q\226\rR\355\223\005R\357\323\002gp.Y\222D\331\323\306"
+	.ascii	"\353\202y\335/\016~I.X\222\373\025d\303\315NY\222\207\226\302"
+	.ascii	"\357\327\216\336\023\347"
+	.string	"X\337\353u\216\377@u\256j\215\232\276\357\331\303\357\371\202!\220Q\364{\244y\217\240Z\256\262,_\205\020&\025\306\227\363\362C\232F\257\207\230\276\357\261\202\317\305u\273\324\234-3\253\312*/\255:\334.\240\021$[S}%\370\001\344\026\271@.\021\254\264\320\344\252\303\236\322\304.\n\277D\322\033`\222\250\365\275A\356\220\033\032zk_w\310\025b\357\236}\\gc\262xa\342\207F\007\024+}\337\243\206\337\023\2063\200\025\375\372\360a\344\316pkR\365}\017\r\234aH\321/\017\036\275\274\312\262\\u\301\016:9\260\234\343>\344|\321\300\322\352{\23638\203Y\321\257\326/\"\003\333\274Z\275\354`\231\245,\023\002\t\0310\316\207\r\276\276\347\251\202\003\220W\364\253C\306\315j,\233\241\254\034@e\343\311\003\207\317\323\2069<\335\2702.\216V\342\334\206\337\250p<\231\370<Dp"
+	.string	"\370\212\254\022{i\\\031\267\206]\273\231k\nY\376p\236,|\036+\234!\253\350w\306\f\233\327\001WVS\023\005H\256\350\344\370r\216\373\260\223\204\351\002J\337\357\370\341"
+	.string	"H\211\021c\312\016\034\316\320V\364\373\242y_\240S\320\250\334\264\225"
+	.string	"$\\\3120\007\256\242_\253;u\257\032\253\003\"&;\254>|\207\211\277\023\2063\304(\272S\366\272h^\0276\257Cnj\242\300H\031\346\207\357\024\301\2676O\345pu\241\016u\245l\3169/\263\262L\006L\224V\035\376\333\342W\252g\305\236\325\032\013\333\364\304\305\223E\324\003\242\\9\3239\353L\211\241SsW\330=4\311\0139\250\276\337\271\302\022|)B\331\240m\216\376\375\357>\341H%\342\221\204\024IKKB\b\200\222\310\343\2324L\221$,\022=(F"
+	.string	"I\034\200\320\221\206\216\212\304c\022\tAR\022S\261h,\336$\203+\007\210H5\271\"\225V%\025\311\244"
+	.string	"\3431\305\321\216\205#\r\031\217)\216\"\200\200\361\230\342\b\202#\r\255%\bOx\030\261\226 <\261s\244!\020\032\326#SR\270\236\2709\322P\262\270*\031\035\205F\023 t\2164\204LJ\022\016\221\222B%\020&\030\217HIc\361\346\204pM\272Id\3218LO$\213\304c\222\232\"iii\304\217\007!< I,~"
+	.string	"\024\\\225\210\311\"\323\021\304\360D"
+	.string	"\222\353\bH\234#\r\2010\022\325#\r\rO\\Hq\202\2304\202`T\034\261\242\020\"\201\2164\364"
+	.ascii	"\022>\030\001Dr=:\n\223\034J\030\032\223H\254G#\211\236\024K"
+	.ascii	"F\022\311#\r-1\031\217GA\341Q\270\004bH\301\260\310\224S<\321"
+	.ascii	")2x\264\244\223\f\026\217\226\322\342\321\022\272r\200\210\274"
+	.ascii	")\226\214\303{L.\241F\353\215\321\212d\272\310\233\2478\036\203"
+	.ascii	"GKC;)\216\032,\254\3115iI\311HB\002\344\2324LAb\035a8\024^\360"
+	.ascii	" \203\b\303\241\020\203\b\020\004\255H\r\351\221\206\216\230"
+	.ascii	"L\254F \214\222\210L&V##\004\216\230L\254F\3005\211L1B0\202\344"
+	.ascii	"\221\206N\200(\032\225\224\214\303\f\"\214\032\0314\0222m\200"
+	.ascii	"h\202'\204\211&2\321\"L4\221\260E\b\233\350\204\026qB\023\245"
+	.ascii	"h\021)\232\310\250\217k2\211\350\301p(\004r\240\001I&\022'\226"
+	.ascii	"\0360\034\nsn\204<H\243\325\250\007\030b(y\024.\r%\207k\322G"
+	.ascii	"\311x\fa\001\0130&W\024\302\021&X\213\306\022\311\342\252\264"
+	.ascii	"\036\231\220\302\025\002\003XQ\020\223\303\021E#\211\341p\204"
+	.ascii	"\006\0236\304\220\t\264\207hH\211x$aM:*\n\177vD\f\031\255(\204"
+	.ascii	"\310`\217\205\021\305\017\b\360#\264\027\f\t\321\021G\305\241"
+	.ascii	"\216\tb\222\220\304p8B\351h<q\\\2276\004\217\2266|H<\256\305"
+	.ascii	"\365\b\037\003\r,\320`\203\023n\276\001\007!8\b\241~\003\016"
+	.ascii	"\210\2108\320\200\b_\003\"\324\302\207\311\341P\210\256"
+	.ascii	"\301\325\310\b\201\343\272\264\256&t\220\301\341P\230&\21744"
+	.ascii	"\200$\005\214\204\253\b\306c\212\243\037d\260\202\221\320\302"
+	.ascii	"1\031B\321\203\343\232D\022\217V\021&\300\264\244\024T\364`M"
+	.ascii	"\022\217&\334\034\223!\210\300\264\244\264S\364 \271\"\327\343"
+	.ascii	"\r\023\323\222\222O\222X\374\240\350A\222X$\252\307d\b\303\""
+	.ascii	"\223"
+	.string	"\007F\302U\204\341p\204\005d\020\305Zb8\024\342\242\007F\302\365\250&\221A\022\"> !\342\003\240\212D\256G##\341\315P\004\021e\n\226@2\231\3109\322\020\222\311\004\006d\220\2704\302:$\242X\215rN\254%\326\245\024$\004?\ba\204\234uX\024&\221E\"N\006#\360\301-\022C(\"\207*q\t\211\"\231L\240\f \n\016\207B\325\004\241\b$J\214PW##\t\024\353Q'\205\221p\025A\230\024\032\001\223=\301\233#\r%\207L\307$R\0042x\302\232dR\372)ahL\n\006\325d\221\3118\f\006o\216k\321\004c0x\203<\256H\246b0\210\215\212\304\022\202A\025Y$.!\203\301\233\242\221\210$&\255\301 0\031L\"\211I>G\032B\256K)\222\026\030\255G!\022\322\002\020\310$\321\004\b\246\342\221\005'0\025\211I\026`\240AP\203\rN"
+	.ascii	"\261\032"
+	.string	"1%\r\213D\020G$\023\210\242\344\tk1IX<\256\311\"1h$\\\217H\311\245`\360\002\212\365\270\024\f\252I$1)\030T\205I\241Q0\250\036\205H\303\273r\200\210\f\006\325\022\206\306\244[<\"&\215\030\016\2058y\244!\246%\245\240\361\230\342hEA<\032\025`\r\212\020\"\203\020\0320-)\001\025\215\304$S\222\021\271\036q\220A\013kp\004\246%\245\0345\231\304\204\\E(\032\211\311\341\232\\K0-)U@\261\032\241\311\240\210\013\222\204(\216k\262\370\301Q\221\230\264\244$\034a8\024\002!%\215F\245\021\206C!0\311hT@0]\207\305\b$\221\302\365\001\311\021FkRh\264$\201\244u8\034\201$bH\006E\\\220,\022o\222'V\243`\362\302\221&@2\005\221\206Ib\bF\305\021II\306#P\005d\360\210x\242h$q\\\223\253\222\221\ts"
+	.string	")xb))8\034\nq\326 O\361\210\230$\f\016\207B`2\270A\262Hd\272Y\217B\023\214\216B\244\340p(\324I\236X\2150\034ih\303\215K\353\021D\322h<\202\3101A\230\002EfHJ2\036/\3220I\\J\221+S\222\020\205\312\024D*\021\217$ \207D%a1E\211$\322\0211\351DP2\250\001Q\262H\274\371\360\004\006\"\016\020b-\032\022zQ\021\t\016\022"
+	.string	"\201\001x8T4\022\223\302\343\232\264\016\207B\020\310\243\021Y\\\221 \212D\241\022\210\341\021\tbH\002\023\204G\324x\\-0\034\no\256\376@\375\266\272\342\230\314\234s\017\217\232\272\2524>\322*m1\200\3301\275\242\200\331\251<\3226(|kX\352V\n\345\307\221\271\034}\003P\004\207\252\245\342Pw\330l\265\305M\315\272\272\303"
+	.ascii	"S\\.T\035=O`?\260T\035j\216KF\026\006\244m\324\270\261\326\367"
+	.ascii	"\021\250\300\277z#%\273P\350\240\224\330\270Yt\276\2662\215\032"
+	.ascii	"Xz\t\035\230\226JC]\336\244\231\223\321e\307\t\2326\312\276\023"
+	.ascii	"\240\275Pg\274PeX+3 \234\2265\306\370\362\022F\007U\206\032\003"
+	.ascii	"\256\311-\214\032C\205qaT\231b$U\262\007\246\255\3571\224\301"
+	.ascii	"\277\212\225\202\231\215\351csu\307\250VW\252\347\013\357\311"
+	.ascii	"\227Z\225zA\371\022s\326W\235R\251\256\272\270\352\242U\027\350"
+	.ascii	"\337\237*\326%\212z90[\250Rj\213\233\246\001J%F\350\344\300\322"
+	.ascii	"0\20745Je\241F\3354@\242/.=\360\257\256\260y3T\370\245\251P\367"
+	.ascii	"\353.\253\307\224\252\342\022y\342)\361\322\227\251SU%$\313\311"
+	.ascii	"y\301\236,\2264\331!\371r\003\213\252\004\343\034\303\266F\315"
+	.ascii	"iT S\276Z\244\177i\237\263\311\037\2206]\n03\325\243\357\004"
+	.ascii	"Q\351\232\224M\272\346\266\261\331\n\003%;0\370\335\247\276?"
+	.ascii	"\034~}7\220\021\363\224\214\230\264\017\265\323\311\312\262\\"
+	.ascii	"u\303\226\345\007\026\276\034\265\354\220C&E\306\005\315\323"
+	.ascii	"\276\247|\"28\031\f\226\202]S\3374\315y\226Z\336\236}\237\352"
+	.ascii	"\245{?\020\007I\017\263\257\276\027\"\203oA\231\214\253\253\276"
+	.ascii	"\351\231\366\"3U\246oj\346T\226_\370~\244e\346\266\352\234\372"
+	.ascii	"\246xi\236m>K\372<\263\207\347m\005Z\226\276\027\262\303\267"
+	.ascii	"\317\242~\300>\213\232\216\001\276\345\350\241\325\3677M;\033"
+	.ascii	"][\360\006"
+	.string	"\272\273\273\024L\232\023\226\017\336bD\201Ay<\341HR\306\rox\243\243K\355B\330\274\342\315\211\334s\215S\227+\273\324\313\023\221\275\324K\332e\315\335\230-,\226\006\315Z\035\212$\247\007\334\036\233\276\027\n\303\033\312\344\344\002\204\245\250\343a\203zP2KQ\030\211)\206\024C#D\324\026\003C\025@0HP \231\252\323f\017\023\300C\215\fE1\016\224\320\251\231\031I\222\222Be\230\003\337V\251\312\245\237L\007\334H\271HV\216g\204\002\353\202g\266\311\013_\343\372L\007\312\242\337\273Q\242\205A\231\335\301\307\005~mR\302\362\007\316\205\352\331\f\254\334\236\321,>e\344\r\234&\272\270p\264\272\2427\3323\241\267\323[t+!\213\030\205\226C\204\213\n\326~\351\034\334;\3578!>\244'\n\325\363\225\034\353\360\332\306\341\331d\307\231\027\002\256W\211\311\211\241\006\360\242\235B\341"
+	.ascii	"\200W\246w\263\222%\020\211\257\026\033\267\361\320{/+\007\243"
+	.ascii	"\361\301^Q@\363\361\376\216\203T)\215T4\220\367U\342e\262 j*"
+	.ascii	"ig\2431\242\007f=\363\217\201\224Q\201\030~d](r\230\305)X\244"
+	.ascii	"3\240\215\f\245H\bv_*m\021\016,\3703\314\211W\033\333\310\021"
+	.ascii	"\034\361N]\032\033\351z\204\220\235\024\2062\020\274\242\312"
+	.ascii	"\030\274\362?\273\2179\317$\023\2452\t\022\251\311s7M&\224\""
+	.ascii	"\350\024Jk\365>b\031\"b\202+T\316\032\200\357\376),\302wA;7s"
+	.ascii	"x\264\354\374\244\327\372\237\n\260f\022\227\222\312$\032,8\036"
+	.ascii	"\006\324\017\342\377\350\325\224\007^\336\\#\216\005\364\320"
+	.ascii	"\265\331\262b\317\222\t\r\004\032\217\233\343q!P\270\006\301"
+	.ascii	"\204W\310\375\033)\235*\222\276*\231\301\324\347\204\316\"\264"
+	.ascii	"\377\017\004\203i\024\305\224\234\353\332\254\330<,9p=\312\\"
+	.ascii	"\364\360\233p\022;\202p=\223\030\\A\272\360\355\303\320\377\230"
+	.ascii	"o\245L\303\310r\031\373\336\235\270\321sc\332\035n\333$b?\316"
+	.ascii	"m\374\243\326\360\036\021\331_k\320f#\002j.\035\030U\316\234"
+	.ascii	"\027}\310b\3136L0\302\016E>\020T3\254P\331\354\007\277D\b\035"
+	.ascii	"\275\3048Y\2601\250b4\n\005)K\343\245%\261N\312N\315{\001\267"
+	.ascii	"\035\313c\236\301\3336\256\213\365\355\245r\007\003\310\034\023"
+	.ascii	"v\204h\254\343p{\240J\024\336\006st.#\350\250\346\3763N 0\237"
+	.ascii	"\n\026'\333\013eN\277\363!\027\351\321\327\220)ij\177\315\327"
+	.ascii	"\205~\325\220\364t\007\372 \354\255\351k<8yl\0227Ax\037\024\365"
+	.ascii	"5\275\b"
+	.string	"!\322\330\255\315\241\2168\017\324\273\271\315:\307\032\273;\204\215:\332w\262\211\024\271\215\376"
+	.ascii	"\323a\373\224h\233\257\367[f\311\017n\316\354X4\261\201>u\246"
+	.ascii	"8\350\204\364\004sn.\007Fz\272a\205\220 \241s\362\264R\235T\031"
+	.ascii	"\200f\243\007\224B\300-\224\262'j\301\355\"\362Bu\254:\260\037"
+	.ascii	"\220\350\351\bh\271\007\226xv\230m\320_\260\367JSH\256\341\251"
+	.ascii	"\321\256 8\311@{s\207(q\f\021S\023\330\026Z\233\370\272\352]"
+	.ascii	"\311\310>\314\327\371\235w\004\367\241\306\275\237WWys\340L\216"
+	.ascii	"\237\353\271\007\026\271\"\344\321l\206\367.<\310u\007\304\310"
+	.ascii	"\234\3446\254\347\002g\267\034\343v\221\215q\344\023%\352\037"
+	.ascii	"Q\211;\317::x\265\222\201\037&\240\n\335gq1\302\240\2401I\035"
+	.ascii	"\031I\365\277\202B\246e\340\314\374]\027w\204\3147i\231{lM\277"
+	.ascii	"\351\216v\355"
+	.string	"\360\"0\201oSh\177\377\205\242\rtm@\022\311\2100(\253\205\225\274<\222\355\262\033\316m\250\007U\211\034\373\231\2452\366r\334\344\005\360\017\313\312\n\263tD\351\006\266b\031%\035\303\020M\003r\313\357l\335\t]*\311Mq\rg\244\005>3\001R\260\231\265\225a\232Q\023\300\212\261\"\0243\323\016\240\235?\350*G\034\323\205\320D\256\212\245\363+ux\320\227\330\270}\303[\023}s\032\330\3667\343\200\344X\200R\256\032\277Td__\034\352\353B\217\302_\3159Z\365^/\243\274s\355u\037J-\346\275\365\205\\v\213\022:=}L2\034\235\372f9\210\261\327\027\364{\263\203\244dU\371\017F[M&4\362:\204N\221D\036\367@'\372\310\307N\001\236mDB\273KI\217\252wg=D\334v<\270\3105WpWQ]\223j\202p\220\031\232g}\225\271\024\005\216\300\\"
+	.string	"A\321\032W\033\r~4\241\026\262\b0\327[W\277\366\245\226B\312\331\r\266\232=\312oUuY\220\353\\\203]\bs\220\251\353\254\034\332\t0,\206\211\362i\002\352\245\356\322\315\207cZ\211t\026\330\373\3728%sF>Q\343i]\367Y\317\334\b\324<\251B\355\364\214\267\304\032\364\324R\363\321\335\247\254\301\204\365\352\360\236\036G\351[B\252\326\377JR\""
+	.ascii	"\361(TM\342\bm\312\001$\270\256\312\321\250\325\t\3223\204\304"
+	.ascii	"\227^\266>(\230+\316\275\217@x\355Z%\200m\263sj\312\356\350P"
+	.ascii	"W\312\035\227}*-\245\355\375\244\013++\370\030\"9\201\240\034"
+	.ascii	"0)\007-a/\332\261Kg\214\306\337\305n\362'\334d\311\267\220\240"
+	.ascii	"\023A\317\n\243\355\207\332:\210\354\203\333\031\350\251`\254"
+	.ascii	"vDWZ\r\342\316s\022\331\024\267\022\241\343\330\020\\\244[\354"
+	.ascii	"9S\372\236\353T\005\342\016\201\210\203\360%y\007\373\006\225"
+	.ascii	"\230\353K\2614\335A\364:\255m\250-\224g\204\252\334+\263\365"
+	.ascii	"<\032<%\333YH\346\r\"z\021\321n\361\303W"
+	.string	"\212U\222\211D\327\243\301\276\314\274nW\334\332R*\r\303D\r\310Os\254\262C\242}\317\027\030\3371~w\223\363\343\307\325\017\rfz[\263\031V\245\026L~\226\205\373^?wN\303\0267\006\207\023\254b\222\315\340\272X\005\204k\362\234\326\373AV\241\316\352\177\365\376\347\243\231s\026\263z\262\035\001\237r\007:G\261\302&\0220\300L\210,\b0\212\376\257\263\245\251\346\362\030j\376?\316qj\022\004:\275\351d\342rz\313\021<\253\355\326\177\030\316~\211\224c4\333\202'M\314;J\370r)pz\335\267a\316,hX\224\\\232%5\200\031\253\272\237!a{\351E\024\364'\013\350\363\206R{e\247A\b\035+\272\302\277\333\363\321\226\316q\301\200\033>\270\225\370\005#\324%7\371\026\370\370\240\377\246X$\346\013\206\325G\215#\347'\0037\376SY\240\274\3671g\271\310y\372\b\b"
+	.string	"\320X=\361\\\255j\351S_J``\326\212\256\206\3346@\243\226\f;\240}{\r\271VbW\340,\023g$\273y2\360Z\301\031\276\313\340\204\360\305\363\232\261\b$:\276\372;2\252\337 \375~\037\212\037\020\332s\035\353S+\002\256\231\362\2019Y\016M19\t\245\332\367u\346\365\215\223\360e\310\372\246\342\002\266\022.\226\262\b\325{\237p\271\331Fv\357\330E\005\243Q\266G3t\257S\224\260\350\366\364\330bS(>\221\211\255O\034\233a`M\206\224P\232\221\200|\305l~\320\224\0349\257b\334\240e\313@\366Q:\363\325\026m<1G\342\347i\362Z\271/\232\234\355%\234\240\240?O\335\240b\300\356\367\214\241\2220\302\020\202"
+	.ascii	"\350+\367H\225p\251[\001<s\317\007<+\225\232!\022+x.\344\035"
+	.ascii	"\036\311\227\225\355\362\253\362\360\237\262\177\0273O;\243\005"
+	.ascii	"\210\232Q\017\354\266\271FU\366\b\254\204x^\352\243k\265\r\223"
+	.ascii	"\324\007\341\344\342<\031B\177F\224\377\031\324@\\'O}%\212\272"
+	.ascii	"\3226\353\277k,\354\372]\241\2633\033S\034\223f\316&!\313//\320"
+	.ascii	"\035>\272\275\027p\254\302\2042\273\025q\n\317*9\006\307\257"
+	.ascii	"o\\m?\255gT\304\241\270Z\023\311R\250!\202%\364\005\202\301\347"
+	.ascii	"k\"\f<nr\322W\030\253\344\237\177\302 \221X\217e\374\245\365"
+	.ascii	"\315\001\0326&;\035\004X9\212\016\241\235\340\344\tG4\033\271"
+	.ascii	"\304w\210\013\254\345\360\211\310\016&\331Q&\345\355\254\272"
+	.ascii	"\237\236\204\275~\360\224\346l\210"
+	.string	"\261?\310\356\037\222\005\275\333 t\024\324F\316\314\346}\215w\363\336r\261\246\360g\270\236=\323nc\336\213\213\236XL\214\314\301\025\267\224\374\371\345%\251\207D\334k\215\246\272\027\276uK\215\213\321f\311\376\217\362\271h\353F\311,\372\264\021t7\350oEg\215\276J\356\f\202\257\375\305\\\027w\023\377.~\313\377E\360\2214N6\314~\005\234I\352?\316\333\376sH\276j\270i\352l`s\327\340m\022\203\317\275Y\237\375\207\204\324\017\363\305u=\257kA\022#\340\271v\340\026\222\337\243\371R\353|\321\264\263g\2318b^\300\343\247P\307\377\332!\262\374m+P\004\266\214\356\220\350\367\350\270\020>\230\365\376\360\264\357n\373\270\177\201\373\372ld\321\177X\333 DO\2208\203\266\373e\210\327\330`\236]\2069\270]\256xe\321\204\232\276%\361\253~\347\367\316\250;%l\252\030}\031\334"
+	.ascii	"\364Kq\325\3519\202U7\227\214.?]\n\030t\377\254\nO-f9\354\242"
+	.ascii	"\365-\367M\225\275Rf|\361d\342+\326\017\205~T\017n7\230\257\325"
+	.ascii	"=@\357\264\3337\366\307\352\376\2268U\002MW\371G\214\013\261"
+	.ascii	"\327[\343X\306\253\352\255\331/\367N\021\270n\306G\315\016\003"
+	.ascii	"\344\312Sl\236\256"
+	.text
+	.section	.gnu.lto_.symtab.550b119b0c29bdce,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"isAccelerationCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"setAccelerationFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.550b119b0c29bdce,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
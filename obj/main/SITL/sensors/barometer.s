@@ -0,0 +1,11334 @@
+	.file	"barometer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/drivers/barometer/barometer.h"
+	.file 6 "./src/main/sensors/barometer.h"
+	.file 7 "./src/main/sensors/sensors.h"
+	.file 8 "./src/main/sensors/barometer.c"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 10 "./src/main/common/maths.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	barometer.c.8925e6e1
+	.weak	barometer.c.8925e6e1
+barometer.c.8925e6e1:
+	.long	0x667
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1696
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1582
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1583
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1584
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1585
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1586
+	.uleb128 0x2
+	.long	.LASF1588
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1587
+	.uleb128 0x2
+	.long	.LASF1589
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1591
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1592
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1593
+	.uleb128 0x2
+	.long	.LASF1594
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1595
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1596
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1597
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1598
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1599
+	.uleb128 0x1c
+	.long	.LASF1697
+	.byte	0xc
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb7
+	.uleb128 0x2
+	.long	.LASF1600
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x110
+	.uleb128 0xc
+	.long	.LASF1601
+	.value	0xfff
+	.uleb128 0xc
+	.long	.LASF1602
+	.value	0xf000
+	.uleb128 0xc
+	.long	.LASF1603
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1605
+	.byte	0x4
+	.byte	0x29
+	.byte	0xf
+	.long	0x11c
+	.uleb128 0x12
+	.long	0x12c
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x70
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x4
+	.byte	0x31
+	.byte	0x5
+	.long	0x14b
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x13
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x14b
+	.byte	0
+	.uleb128 0x7
+	.long	0x110
+	.uleb128 0xb
+	.long	.LASF1613
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2b
+	.long	0x1ab
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2c
+	.byte	0xb
+	.long	0xdd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1606
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1ab
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ab
+	.byte	0x10
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x30
+	.byte	0xf
+	.long	0x1b0
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1609
+	.byte	0x4
+	.byte	0x34
+	.byte	0x7
+	.long	0x12c
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x9f
+	.uleb128 0x7
+	.long	0x1ab
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x150
+	.uleb128 0x14
+	.long	0x1b5
+	.uleb128 0x2
+	.long	.LASF1611
+	.byte	0x5
+	.byte	0x14
+	.byte	0x10
+	.long	0x1d2
+	.uleb128 0x7
+	.long	0x1d7
+	.uleb128 0x1e
+	.uleb128 0x2
+	.long	.LASF1612
+	.byte	0x5
+	.byte	0x15
+	.byte	0x10
+	.long	0x1e4
+	.uleb128 0x7
+	.long	0x1e9
+	.uleb128 0x12
+	.long	0x1f9
+	.uleb128 0x6
+	.long	0x1f9
+	.uleb128 0x6
+	.long	0x1f9
+	.byte	0
+	.uleb128 0x7
+	.long	0x93
+	.uleb128 0xb
+	.long	.LASF1614
+	.byte	0x30
+	.byte	0x5
+	.byte	0x17
+	.long	0x266
+	.uleb128 0x3
+	.long	.LASF1615
+	.byte	0x5
+	.byte	0x18
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1616
+	.byte	0x5
+	.byte	0x19
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1617
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x13
+	.long	0x1c6
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1618
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x1c6
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1619
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x13
+	.long	0x1c6
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1620
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x13
+	.long	0x1c6
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x1d8
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x3
+	.long	0x1fe
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x6
+	.byte	0x17
+	.long	0x29c
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x3
+	.long	0x272
+	.uleb128 0xb
+	.long	.LASF1629
+	.byte	0x8
+	.byte	0x6
+	.byte	0x21
+	.long	0x2f6
+	.uleb128 0x3
+	.long	.LASF1630
+	.byte	0x6
+	.byte	0x22
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1631
+	.byte	0x6
+	.byte	0x23
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1632
+	.byte	0x6
+	.byte	0x24
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1633
+	.byte	0x6
+	.byte	0x25
+	.byte	0xe
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1634
+	.byte	0x6
+	.byte	0x26
+	.byte	0xe
+	.long	0xab
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1635
+	.byte	0x6
+	.byte	0x27
+	.byte	0x3
+	.long	0x2a8
+	.uleb128 0x14
+	.long	0x2f6
+	.uleb128 0x8
+	.long	.LASF1636
+	.byte	0x6
+	.byte	0x29
+	.byte	0x1a
+	.long	0x2f6
+	.uleb128 0x8
+	.long	.LASF1637
+	.byte	0x6
+	.byte	0x29
+	.byte	0x4b
+	.long	0x2f6
+	.uleb128 0xb
+	.long	.LASF1638
+	.byte	0x38
+	.byte	0x6
+	.byte	0x2b
+	.long	0x353
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xf
+	.long	0x266
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1639
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xd
+	.long	0x93
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xd
+	.long	0x93
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1641
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x3
+	.long	0x31f
+	.uleb128 0x8
+	.long	.LASF1642
+	.byte	0x6
+	.byte	0x31
+	.byte	0xf
+	.long	0x353
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x395
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x4
+	.byte	0
+	.uleb128 0xe
+	.long	0x9f
+	.long	0x3a5
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1648
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x395
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x7
+	.byte	0x2d
+	.long	0x3e7
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x40
+	.byte	0
+	.uleb128 0x10
+	.long	0x35f
+	.byte	0x2c
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF1656
+	.byte	0x8
+	.byte	0x2e
+	.byte	0x20
+	.long	0x302
+	.uleb128 0x10
+	.long	0x307
+	.byte	0x2e
+	.byte	0x53
+	.uleb128 0x10
+	.long	0x313
+	.byte	0x2e
+	.byte	0x7d
+	.uleb128 0x8
+	.long	.LASF1657
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xad
+	.long	0x1c1
+	.uleb128 0x1f
+	.long	0x408
+	.byte	0xda
+	.uleb128 0x20
+	.long	0x3ee
+	.byte	0x30
+	.byte	0x19
+	.uleb128 0x4
+	.long	.LASF1658
+	.byte	0x3a
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF1659
+	.byte	0x3b
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1640
+	.byte	0x3c
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1660
+	.byte	0x3e
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1661
+	.byte	0x3f
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1662
+	.byte	0x40
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1663
+	.byte	0x8c
+	.byte	0xc
+	.long	0x46e
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1664
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x8
+	.byte	0xc0
+	.long	0x48d
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1667
+	.byte	0x8
+	.byte	0xc3
+	.byte	0x3
+	.long	0x475
+	.uleb128 0x21
+	.long	.LASF1668
+	.byte	0x9
+	.value	0x13d
+	.byte	0x11
+	.long	0x83
+	.long	0x4b0
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1669
+	.byte	0x9
+	.byte	0x8c
+	.byte	0x39
+	.long	0xc3
+	.long	0x4cb
+	.uleb128 0x6
+	.long	0xc3
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1670
+	.byte	0xa
+	.byte	0x60
+	.byte	0x9
+	.long	0x93
+	.long	0x4e1
+	.uleb128 0x6
+	.long	0x1f9
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1672
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x6
+	.long	0x4f3
+	.uleb128 0x6
+	.long	0xb7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1688
+	.byte	0xf3
+	.long	0x509
+	.uleb128 0x4
+	.long	.LASF1671
+	.byte	0xf5
+	.byte	0x14
+	.long	0x93
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1673
+	.byte	0xe2
+	.byte	0x9
+	.long	0x93
+	.long	0x524
+	.uleb128 0x4
+	.long	.LASF1674
+	.byte	0xe4
+	.byte	0xd
+	.long	0x93
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1675
+	.byte	0xca
+	.byte	0xa
+	.long	0xb7
+	.long	0x53f
+	.uleb128 0x4
+	.long	.LASF1676
+	.byte	0xcc
+	.byte	0x1d
+	.long	0x48d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1691
+	.byte	0xc6
+	.long	0x46e
+	.uleb128 0x18
+	.long	.LASF1683
+	.byte	0xa8
+	.byte	0x11
+	.long	0xb7
+	.long	0x59b
+	.uleb128 0x9
+	.long	.LASF1677
+	.byte	0xa8
+	.byte	0x33
+	.long	0x9f
+	.uleb128 0x9
+	.long	.LASF1678
+	.byte	0xa8
+	.byte	0x4d
+	.long	0xb7
+	.uleb128 0x9
+	.long	.LASF1679
+	.byte	0xa8
+	.byte	0x64
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1680
+	.byte	0xaa
+	.byte	0x14
+	.long	0x59b
+	.uleb128 0x4
+	.long	.LASF1681
+	.byte	0xab
+	.byte	0x10
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1682
+	.byte	0xac
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0xe
+	.long	0x93
+	.long	0x5ab
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1684
+	.byte	0x90
+	.byte	0x10
+	.long	0x93
+	.long	0x5f2
+	.uleb128 0x9
+	.long	.LASF1679
+	.byte	0x90
+	.byte	0x33
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1685
+	.byte	0x92
+	.byte	0x14
+	.long	0x5f2
+	.uleb128 0x4
+	.long	.LASF1686
+	.byte	0x93
+	.byte	0x10
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1687
+	.byte	0x94
+	.byte	0x10
+	.long	0x46e
+	.uleb128 0x4
+	.long	.LASF1682
+	.byte	0x95
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0xe
+	.long	0x93
+	.long	0x602
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1689
+	.byte	0x87
+	.long	0x618
+	.uleb128 0x9
+	.long	.LASF1690
+	.byte	0x87
+	.byte	0x28
+	.long	0xab
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1692
+	.byte	0x82
+	.long	0x46e
+	.uleb128 0x11
+	.long	.LASF1693
+	.byte	0x42
+	.byte	0x5
+	.long	0x46e
+	.long	0x654
+	.uleb128 0x23
+	.string	"dev"
+	.byte	0x8
+	.byte	0x42
+	.byte	0x1b
+	.long	0x654
+	.uleb128 0x9
+	.long	.LASF1694
+	.byte	0x42
+	.byte	0x2d
+	.long	0x29c
+	.uleb128 0x4
+	.long	.LASF1695
+	.byte	0x46
+	.byte	0x12
+	.long	0x29c
+	.byte	0
+	.uleb128 0x7
+	.long	0x266
+	.uleb128 0x24
+	.long	.LASF1698
+	.byte	0x6
+	.byte	0x29
+	.byte	0x88
+	.long	0x665
+	.uleb128 0x7
+	.long	0x302
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 29 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 38 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x26
+	.file 39 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 41 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.file 42 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 43 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1533
+	.byte	0x4
+	.file 44 "./src/main/drivers/barometer/barometer_bmp085.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.file 45 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 46 "./src/main/drivers/barometer/barometer_bmp280.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 47 "./src/main/drivers/barometer/barometer_fake.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/barometer/barometer_ms5611.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1576
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1581
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF989
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF993
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF995
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1300
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1317
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1384
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1385
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1427
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1532
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1535
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.barometer_bmp280.h.20.12d0a75f7d7a90ce6a83e177a70ec71d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1579
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1699
+	.long	.LASF1700
+	.long	.LASF1701
+	.long	.LASF1702
+	.long	.LASF1703
+	.long	.LASF1704
+	.long	.LASF1705
+	.long	.LASF1706
+	.long	.LASF1707
+	.long	.LASF1708
+	.long	.LASF1709
+	.long	.LASF1710
+	.long	.LASF1711
+	.long	.LASF1712
+	.long	.LASF1713
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x31
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1714
+	.byte	0xb
+	.long	.LASF1715
+	.byte	0xb
+	.long	.LASF1716
+	.byte	0xb
+	.long	.LASF1717
+	.byte	0x3
+	.long	.LASF1718
+	.byte	0x4
+	.long	.LASF1718
+	.byte	0x7
+	.long	.LASF1719
+	.byte	0x7
+	.long	.LASF1720
+	.byte	0x7
+	.long	.LASF1721
+	.byte	0xb
+	.long	.LASF1722
+	.byte	0x2
+	.long	.LASF1723
+	.byte	0x6
+	.long	.LASF1724
+	.byte	0x8
+	.long	.LASF1725
+	.byte	0xe
+	.long	.LASF1726
+	.byte	0xf
+	.long	.LASF1727
+	.byte	0xf
+	.long	.LASF1727
+	.byte	0xe
+	.long	.LASF1728
+	.byte	0xb
+	.long	.LASF1729
+	.byte	0xe
+	.long	.LASF1730
+	.byte	0xe
+	.long	.LASF1731
+	.byte	0xb
+	.long	.LASF1732
+	.byte	0xb
+	.long	.LASF1733
+	.byte	0xd
+	.long	.LASF1734
+	.byte	0xb
+	.long	.LASF1735
+	.byte	0xc
+	.long	.LASF1736
+	.byte	0xc
+	.long	.LASF1737
+	.byte	0xb
+	.long	.LASF1738
+	.byte	0xb
+	.long	.LASF1739
+	.byte	0xb
+	.long	.LASF1740
+	.byte	0xe
+	.long	.LASF1741
+	.byte	0xb
+	.long	.LASF1742
+	.byte	0xb
+	.long	.LASF1743
+	.byte	0xb
+	.long	.LASF1744
+	.byte	0xb
+	.long	.LASF1745
+	.byte	0xb
+	.long	.LASF1746
+	.byte	0xb
+	.long	.LASF1747
+	.byte	0xb
+	.long	.LASF1748
+	.byte	0xb
+	.long	.LASF1749
+	.byte	0xa
+	.long	.LASF1750
+	.byte	0x9
+	.long	.LASF1751
+	.byte	0xf
+	.long	.LASF1752
+	.byte	0x9
+	.long	.LASF1753
+	.byte	0x1
+	.long	.LASF1754
+	.byte	0x3
+	.long	.LASF1755
+	.byte	0x4
+	.long	.LASF1756
+	.byte	0x5
+	.long	.LASF1757
+	.byte	0x4
+	.long	.LASF1758
+	.byte	0x4
+	.long	.LASF1759
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1061:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF732:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1187:
+	.string	"MATH_ERREXCEPT 2"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF965:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1057:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF948:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1377:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1248:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF841:
+	.string	"__DECL_SIMD_sinh "
+.LASF1409:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1638:
+	.string	"baro_s"
+.LASF1641:
+	.string	"baro_t"
+.LASF1242:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF769:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1302:
+	.string	"USE_PPM"
+.LASF1658:
+	.string	"calibratingB"
+.LASF1621:
+	.string	"calculate"
+.LASF1221:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1672:
+	.string	"sensorsSet"
+.LASF905:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF885:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF742:
+	.string	"__DECL_SIMD_expf "
+.LASF1277:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1593:
+	.string	"char"
+.LASF1428:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF961:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF946:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1304:
+	.string	"SERIAL_RX"
+.LASF1329:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1588:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1030:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1005:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1664:
+	.string	"_Bool"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF700:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1293:
+	.string	"USE_UART8 "
+.LASF1267:
+	.string	"U_ID_2 2"
+.LASF1282:
+	.string	"USE_FLASHFS "
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1654:
+	.string	"SENSOR_GPS"
+.LASF909:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1243:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF837:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF988:
+	.string	"__DECL_SIMD_exp"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1490:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1583:
+	.string	"short unsigned int"
+.LASF1054:
+	.string	"__DECL_SIMD_atanhf"
+.LASF1564:
+	.string	"T_SETUP_PRESSURE_MAX (10)"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF746:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1369:
+	.string	"__WCHAR_T__ "
+.LASF1249:
+	.string	"USE_SENSOR_NAMES "
+.LASF1491:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1648:
+	.string	"detectedSensors"
+.LASF1483:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF890:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1617:
+	.string	"start_ut"
+.LASF843:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1447:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF730:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1596:
+	.string	"uint16_t"
+.LASF743:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1023:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"PG_RX_CONFIG 24"
+.LASF1066:
+	.string	"__DECL_SIMD_tanhf"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1233:
+	.string	"TELEMETRY_HOTT "
+.LASF724:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1217:
+	.string	"USE_CLI_BATCH "
+.LASF1032:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1438:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1182:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF699:
+	.string	"_MATH_H 1"
+.LASF1397:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1339:
+	.string	"_T_PTRDIFF_ "
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF713:
+	.string	"__DECL_SIMD_sinl "
+.LASF1479:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1296:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF715:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1451:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1197:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1550:
+	.string	"BMP280_TEMPERATURE_CALIB_DIG_T1_LSB_REG (0x88)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF763:
+	.string	"__DECL_SIMD_acosl "
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1464:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1626:
+	.string	"BARO_MS5611"
+.LASF1259:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF734:
+	.string	"__DECL_SIMD_logf16 "
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1036:
+	.string	"__DECL_SIMD_atan2"
+.LASF1412:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1104:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1487:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1633:
+	.string	"baro_cf_vel"
+.LASF1536:
+	.string	"BMP280_I2C_ADDR (0x76)"
+.LASF790:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF733:
+	.string	"__DECL_SIMD_logl "
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1554:
+	.string	"BMP280_OVERSAMP_1X (0x01)"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1078:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1064:
+	.string	"__DECL_SIMD_tanh"
+.LASF1445:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF970:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1360:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1250:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1689:
+	.string	"baroSetCalibrationCycles"
+.LASF741:
+	.string	"__DECL_SIMD_exp "
+.LASF951:
+	.string	"__DECL_SIMD_erfc "
+.LASF1076:
+	.string	"__DECL_SIMD_tan"
+.LASF816:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF833:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1134:
+	.string	"_Mdouble_"
+.LASF1594:
+	.string	"int32_t"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1407:
+	.string	"FAST_MATH "
+.LASF1280:
+	.string	"BARO "
+.LASF1180:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF991:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1693:
+	.string	"baroDetect"
+.LASF1052:
+	.string	"__DECL_SIMD_atanh"
+.LASF925:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1379:
+	.string	"___int_wchar_t_h "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1317:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1567:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1326:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF996:
+	.string	"__DECL_SIMD_acos"
+.LASF1636:
+	.string	"barometerConfig_System"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF515:
+	.string	"__always_inline"
+.LASF807:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF926:
+	.string	"__DECL_SIMD_erff64 "
+.LASF840:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1555:
+	.string	"BMP280_OVERSAMP_2X (0x02)"
+.LASF1303:
+	.string	"USE_PWM"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1311:
+	.string	"USE_SERIALRX_XBUS"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1484:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1135:
+	.string	"__MATH_PRECNAME"
+.LASF876:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10"
+.LASF1497:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1040:
+	.string	"__DECL_SIMD_log10"
+.LASF1603:
+	.string	"PGR_SIZE_MASK"
+.LASF1145:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1024:
+	.string	"__DECL_SIMD_expm1"
+.LASF808:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1009:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1138:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1661:
+	.string	"baroGroundPressure"
+.LASF1558:
+	.string	"BMP280_OVERSAMP_16X (0x05)"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF976:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1122:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1297:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1353:
+	.string	"_T_SIZE_ "
+.LASF1128:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF913:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1171:
+	.string	"__MATHCALL_NARROW"
+.LASF899:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1244:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1556:
+	.string	"BMP280_OVERSAMP_4X (0x03)"
+.LASF1120:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1048:
+	.string	"__DECL_SIMD_log1p"
+.LASF1686:
+	.string	"currentFilterSampleIndex"
+.LASF1156:
+	.string	"__MATHDECL_1"
+.LASF1049:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1560:
+	.string	"BMP280_TEMPERATURE_OSR (BMP280_OVERSAMP_1X)"
+.LASF1033:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1657:
+	.string	"barometerConfig_Registry"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1516:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1148:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF922:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1440:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1364:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1092:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1026:
+	.string	"__DECL_SIMD_expm1f"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1442:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1046:
+	.string	"__DECL_SIMD_log2f"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF789:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1566:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF801:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF819:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1183:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1651:
+	.string	"SENSOR_BARO"
+.LASF930:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1557:
+	.string	"BMP280_OVERSAMP_8X (0x04)"
+.LASF1084:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1321:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1361:
+	.string	"_SIZE_T_DECLARED "
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1476:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1520:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1534:
+	.string	"IO_TAG_NONE 0"
+.LASF1274:
+	.string	"ACC "
+.LASF975:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1458:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1240:
+	.string	"TELEMETRY_IBUS "
+.LASF1219:
+	.string	"USE_PWM "
+.LASF826:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1370:
+	.string	"_WCHAR_T "
+.LASF1299:
+	.string	"TELEMETRY_LTM"
+.LASF1572:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1069:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1570:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF760:
+	.string	"__DECL_SIMD_powf128x "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1585:
+	.string	"long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1345:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1301:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1579:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1589:
+	.string	"__uint16_t"
+.LASF1107:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF398:
+	.string	"false 0"
+.LASF827:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1393:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1685:
+	.string	"barometerFilterSamples"
+.LASF1416:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1270:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF872:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF797:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1193:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1399:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF766:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1366:
+	.string	"__size_t "
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF828:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1034:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1263:
+	.string	"SKIP_IMU_CALC "
+.LASF936:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1406:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1537:
+	.string	"BMP280_DEFAULT_CHIP_ID (0x58)"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF729:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1041:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1185:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1644:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1103:
+	.string	"__f32x(x) x ##f32x"
+.LASF815:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1200:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1524:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1161:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1264:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1521:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1582:
+	.string	"unsigned char"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF889:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1113:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1531:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1535:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1071:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1346:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1698:
+	.string	"barometerConfig"
+.LASF985:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF1273:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1258:
+	.string	"USE_NAV "
+.LASF1477:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF364:
+	.string	"__k8 1"
+.LASF1214:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1460:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1272:
+	.string	"USE_FAKE_LED "
+.LASF1598:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1455:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1391:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1276:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1511:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF923:
+	.string	"__DECL_SIMD_erfl "
+.LASF863:
+	.string	"__DECL_SIMD_atan2l "
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1628:
+	.string	"baroSensor_e"
+.LASF1338:
+	.string	"_PTRDIFF_T "
+.LASF1548:
+	.string	"BMP280_TEMPERATURE_XLSB_REG (0xFC)"
+.LASF1613:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF973:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1398:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1422:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1051:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF717:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF849:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1236:
+	.string	"USE_SERVOS "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF514:
+	.string	"__wur "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF774:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1186:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1462:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1142:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1179:
+	.string	"FP_NORMAL 4"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1376:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF784:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1227:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1130:
+	.string	"_Mdouble_ double"
+.LASF1404:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF796:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF822:
+	.string	"__DECL_SIMD_coshf "
+.LASF903:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1677:
+	.string	"baroSampleCount"
+.LASF1551:
+	.string	"BMP280_PRESSURE_TEMPERATURE_CALIB_DATA_LENGTH (24)"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF800:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1152:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1601:
+	.string	"PGR_PGN_MASK"
+.LASF1093:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1328:
+	.string	"USE_SPI"
+.LASF1378:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1132:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1260:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1269:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF710:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF873:
+	.string	"__DECL_SIMD_log10l "
+.LASF1571:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1492:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1518:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF750:
+	.string	"__DECL_SIMD_expf128x "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1074:
+	.string	"__DECL_SIMD_erfcf"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1095:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1165:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1047:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1561:
+	.string	"BMP280_MODE (BMP280_PRESSURE_OSR << 2 | BMP280_TEMPERATURE_OSR << 5 | BMP280_FORCED_MODE)"
+.LASF860:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF879:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF782:
+	.string	"__DECL_SIMD_asinf "
+.LASF1334:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1606:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1645:
+	.string	"SENSOR_INDEX_BARO"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1502:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1427:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1162:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1268:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1133:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1146:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1020:
+	.string	"__DECL_SIMD_cosh"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF749:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF906:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF740:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1333:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF702:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1065:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1090:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1431:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1363:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1199:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1358:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1533:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1605:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1595:
+	.string	"uint8_t"
+.LASF1121:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1155:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1136:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1646:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1663:
+	.string	"baroReady"
+.LASF1231:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF767:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1055:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1073:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF959:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF941:
+	.string	"__DECL_SIMD_asinh "
+.LASF1408:
+	.string	"VERY_FAST_MATH "
+.LASF1300:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1283:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1381:
+	.string	"_GCC_WCHAR_T "
+.LASF1203:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF969:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1315:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1529:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF768:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1176:
+	.string	"FP_INFINITE 1"
+.LASF1166:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1167:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1168:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF711:
+	.string	"__DECL_SIMD_sin "
+.LASF1318:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_"
+.LASF979:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF989:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF1072:
+	.string	"__DECL_SIMD_erfc"
+.LASF869:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1086:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1639:
+	.string	"BaroAlt"
+.LASF1356:
+	.string	"_SIZE_T_ "
+.LASF995:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1181:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1679:
+	.string	"newPressureReading"
+.LASF1367:
+	.string	"__need_size_t"
+.LASF1077:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1434:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1348:
+	.string	"__need_ptrdiff_t"
+.LASF754:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1662:
+	.string	"baroPressureSum"
+.LASF785:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1111:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1209:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF823:
+	.string	"__DECL_SIMD_coshl "
+.LASF1421:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1137:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1150:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1480:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1335:
+	.string	"_STDDEF_H "
+.LASF908:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1279:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1164:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1114:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1216:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1508:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1640:
+	.string	"baroTemperature"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF739:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1506:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1139:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1580:
+	.string	"PRESSURE_SAMPLES_MEDIAN 3"
+.LASF1470:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1400:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1437:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF775:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1475:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1618:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF898:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1620:
+	.string	"get_up"
+.LASF1612:
+	.string	"baroCalculateFuncPtr"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1519:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1312:
+	.string	"LED_STRIP"
+.LASF1212:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1039:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1085:
+	.string	"__f128(x) x ##f128"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1141:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1553:
+	.string	"BMP280_OVERSAMP_SKIPPED (0x00)"
+.LASF1653:
+	.string	"SENSOR_SONAR"
+.LASF981:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1309:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1310:
+	.string	"USE_SERIALRX_SUMH"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF997:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF783:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1232:
+	.string	"TELEMETRY_FRSKY "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF962:
+	.string	"__DECL_SIMD_tanf "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1517:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1650:
+	.string	"SENSOR_ACC"
+.LASF1544:
+	.string	"BMP280_PRESSURE_LSB_REG (0xF8)"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1169:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1607:
+	.string	"address"
+.LASF1420:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1308:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF703:
+	.string	"__DECL_SIMD_cosl "
+.LASF821:
+	.string	"__DECL_SIMD_cosh "
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1124:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1271:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF1386:
+	.string	"NULL"
+.LASF1667:
+	.string	"barometerState_e"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1368:
+	.string	"__wchar_t__ "
+.LASF1493:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF468:
+	.string	"__PMT"
+.LASF1382:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF1262:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1694:
+	.string	"baroHardwareToUse"
+.LASF929:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1261:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1494:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1211:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1192:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF882:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF931:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1575:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1660:
+	.string	"baroGroundAltitude"
+.LASF1604:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1083:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1452:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1044:
+	.string	"__DECL_SIMD_log2"
+.LASF1228:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1079:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1559:
+	.string	"BMP280_PRESSURE_OSR (BMP280_OVERSAMP_8X)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1022:
+	.string	"__DECL_SIMD_coshf"
+.LASF1059:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1425:
+	.string	"UNIT_TESTED "
+.LASF735:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF871:
+	.string	"__DECL_SIMD_log10 "
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF780:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1374:
+	.string	"_WCHAR_T_ "
+.LASF986:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF999:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1443:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF779:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1696:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1562:
+	.string	"T_INIT_MAX (20)"
+.LASF1099:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1446:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1687:
+	.string	"medianFilterReady"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1435:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1208:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1352:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1149:
+	.string	"_Mdouble_ _Float128"
+.LASF1527:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF950:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF897:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1546:
+	.string	"BMP280_TEMPERATURE_MSB_REG (0xFA)"
+.LASF1042:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1568:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF1224:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF836:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1578:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF893:
+	.string	"__DECL_SIMD_log1pl "
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF820:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF725:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1388:
+	.string	"__need_NULL"
+.LASF1389:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1170:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1151:
+	.string	"_Mdouble_ _Float32x"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1067:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1218:
+	.string	"USE_PPM "
+.LASF787:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF755:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF886:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1322:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF771:
+	.string	"__DECL_SIMD_atan "
+.LASF817:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1285:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1157:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF974:
+	.string	"__DECL_SIMD_cosf"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1237:
+	.string	"CMS "
+.LASF1609:
+	.string	"reset"
+.LASF1314:
+	.string	"TELEMETRY_HOTT"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1453:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF788:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF891:
+	.string	"__DECL_SIMD_log1p "
+.LASF1632:
+	.string	"baro_noise_lpf"
+.LASF963:
+	.string	"__DECL_SIMD_tanl "
+.LASF818:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1665:
+	.string	"BAROMETER_NEEDS_SAMPLES"
+.LASF1158:
+	.string	"__MATHDECL"
+.LASF917:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1002:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1035:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1586:
+	.string	"signed char"
+.LASF1100:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1429:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF736:
+	.string	"__DECL_SIMD_logf64 "
+.LASF719:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF835:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1349:
+	.string	"__size_t__ "
+.LASF1234:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1173:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1235:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1070:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1295:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1461:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1050:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF919:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1405:
+	.string	"sq(x) ((x)*(x))"
+.LASF731:
+	.string	"__DECL_SIMD_log "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1017:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1539:
+	.string	"BMP280_RST_REG (0xE0)"
+.LASF1001:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1102:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1357:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1298:
+	.string	"USE_DASHBOARD"
+.LASF1204:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF883:
+	.string	"__DECL_SIMD_log2l "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1469:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF984:
+	.string	"__DECL_SIMD_log"
+.LASF1652:
+	.string	"SENSOR_MAG"
+.LASF1256:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1091:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1330:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1697:
+	.string	"SystemCoreClock"
+.LASF1000:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1433:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1394:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1331:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1473:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1143:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1676:
+	.string	"state"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1229:
+	.string	"BLACKBOX "
+.LASF839:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF944:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1337:
+	.string	"_ANSI_STDDEF_H "
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1528:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1602:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1459:
+	.string	"PG_PID_PROFILE 14"
+.LASF990:
+	.string	"__DECL_SIMD_expf"
+.LASF859:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF987:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1512:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1207:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1195:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1573:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1112:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1538:
+	.string	"BMP280_CHIP_ID_REG (0xD0)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1222:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF728:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1530:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF887:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1253:
+	.string	"VTX_SMARTAUDIO "
+.LASF1101:
+	.string	"__f32(x) x ##f32"
+.LASF1432:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1081:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1177:
+	.string	"FP_ZERO 2"
+.LASF1631:
+	.string	"baro_sample_count"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF744:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1684:
+	.string	"applyBarometerMedianFilter"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1637:
+	.string	"barometerConfig_Copy"
+.LASF1004:
+	.string	"__DECL_SIMD_asin"
+.LASF1498:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1608:
+	.string	"copy"
+.LASF1257:
+	.string	"GPS "
+.LASF1576:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1025:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1323:
+	.string	"VTX_COMMON"
+.LASF1045:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1472:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1592:
+	.string	"long int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1008:
+	.string	"__DECL_SIMD_hypot"
+.LASF1465:
+	.string	"PG_SERVO_MIXER 21"
+.LASF978:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1625:
+	.string	"BARO_BMP085"
+.LASF884:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1417:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF920:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF847:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1541:
+	.string	"BMP280_CTRL_MEAS_REG (0xF4)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1239:
+	.string	"TELEMETRY_CRSF "
+.LASF1342:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1523:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1655:
+	.string	"SENSOR_GPSMAG"
+.LASF1668:
+	.string	"lrintf"
+.LASF1341:
+	.string	"__PTRDIFF_T "
+.LASF848:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1125:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1456:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1611:
+	.string	"baroOpFuncPtr"
+.LASF1678:
+	.string	"pressureTotal"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF851:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1444:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1316:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1131:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1597:
+	.string	"uint32_t"
+.LASF1355:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF980:
+	.string	"__DECL_SIMD_sincos"
+.LASF1053:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1063:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1105:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1198:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF881:
+	.string	"__DECL_SIMD_log2 "
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF888:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF900:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1106:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1160:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF910:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1413:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1509:
+	.string	"PG_PID_CONFIG 504"
+.LASF939:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1108:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1230:
+	.string	"LED_STRIP "
+.LASF751:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1313:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1194:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1426:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1488:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1371:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1448:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF720:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1383:
+	.string	"__DEFINED_wchar_t "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF1206:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1489:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1675:
+	.string	"baroUpdate"
+.LASF1688:
+	.string	"performBaroCalibrationCycle"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF994:
+	.string	"__DECL_SIMD_powf"
+.LASF1255:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1007:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1163:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF877:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF937:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1094:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF707:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF874:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1306:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF791:
+	.string	"__DECL_SIMD_hypot "
+.LASF1116:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1565:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1634:
+	.string	"baro_cf_alt"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF706:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF878:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF770:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1532:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1247:
+	.string	"USE_RX_MSP "
+.LASF397:
+	.string	"true 1"
+.LASF708:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF972:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF762:
+	.string	"__DECL_SIMD_acosf "
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1359:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF748:
+	.string	"__DECL_SIMD_expf32x "
+.LASF945:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1691:
+	.string	"isBaroReady"
+.LASF1196:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1542:
+	.string	"BMP280_CONFIG_REG (0xF5)"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1690:
+	.string	"calibrationCyclesRequired"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1089:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1563:
+	.string	"T_MEASURE_PER_OSRS_MAX (37)"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF757:
+	.string	"__DECL_SIMD_powf128 "
+.LASF850:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1021:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1210:
+	.string	"I2C1_OVERCLOCK true"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1027:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1481:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF957:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF786:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1387:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1396:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1543:
+	.string	"BMP280_PRESSURE_MSB_REG (0xF7)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1486:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1325:
+	.string	"VTX_SMARTAUDIO"
+.LASF1223:
+	.string	"USE_SERIALRX_SBUS "
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1246:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1423:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1043:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1307:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1281:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1011:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF812:
+	.string	"__DECL_SIMD_exp10f "
+.LASF745:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1574:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1630:
+	.string	"baro_hardware"
+.LASF1075:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1385:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1110:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1340:
+	.string	"_T_PTRDIFF "
+.LASF776:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF968:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1003:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF911:
+	.string	"__DECL_SIMD_acosh "
+.LASF1577:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF967:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1275:
+	.string	"USE_FAKE_ACC "
+.LASF1629:
+	.string	"barometerConfig_s"
+.LASF1635:
+	.string	"barometerConfig_t"
+.LASF1549:
+	.string	"BMP280_FORCED_MODE (0x01)"
+.LASF377:
+	.string	"__linux 1"
+.LASF1172:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1205:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1175:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1097:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF868:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF824:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF921:
+	.string	"__DECL_SIMD_erf "
+.LASF1191:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1123:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1324:
+	.string	"VTX_CONTROL"
+.LASF737:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1058:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1659:
+	.string	"baroPressure"
+.LASF956:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1037:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1463:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF983:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF761:
+	.string	"__DECL_SIMD_acos "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1581:
+	.string	"PRESSURE_SAMPLE_COUNT (barometerConfig()->baro_sample_count - 1)"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f "
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF738:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1499:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1439:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1615:
+	.string	"ut_delay"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1501:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1319:
+	.string	"TELEMETRY_IBUS"
+.LASF1213:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1202:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF993:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1510:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1599:
+	.string	"double"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1681:
+	.string	"currentSampleIndex"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF998:
+	.string	"__DECL_SIMD_acosf"
+.LASF1056:
+	.string	"__DECL_SIMD_acosh"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1430:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1674:
+	.string	"BaroAlt_tmp"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1449:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1375:
+	.string	"_BSD_WCHAR_T_ "
+.LASF809:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1403:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1190:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1526:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1590:
+	.string	"__int32_t"
+.LASF1117:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1184:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1591:
+	.string	"__uint32_t"
+.LASF772:
+	.string	"__DECL_SIMD_atanf "
+.LASF1415:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF949:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1466:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1419:
+	.string	"Q12 (1 << 12)"
+.LASF1215:
+	.string	"USE_CLI "
+.LASF1062:
+	.string	"__DECL_SIMD_erff"
+.LASF810:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1642:
+	.string	"baro"
+.LASF1623:
+	.string	"BARO_DEFAULT"
+.LASF1495:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1474:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1284:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1087:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1522:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1126:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF752:
+	.string	"__DECL_SIMD_powf "
+.LASF1622:
+	.string	"baroDev_t"
+.LASF1372:
+	.string	"_T_WCHAR "
+.LASF758:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1365:
+	.string	"_SIZET_ "
+.LASF1627:
+	.string	"BARO_BMP280"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF927:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1245:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1238:
+	.string	"TELEMETRY_LTM "
+.LASF1336:
+	.string	"_STDDEF_H_ "
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF781:
+	.string	"__DECL_SIMD_asin "
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1545:
+	.string	"BMP280_PRESSURE_XLSB_REG (0xF9)"
+.LASF971:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1619:
+	.string	"start_up"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1159:
+	.string	"__MATHCALL"
+.LASF875:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF943:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF1471:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1500:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF928:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1252:
+	.string	"VTX_CONTROL "
+.LASF901:
+	.string	"__DECL_SIMD_atanh "
+.LASF714:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1467:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1119:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF813:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1411:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1343:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1373:
+	.string	"__WCHAR_T "
+.LASF1006:
+	.string	"__DECL_SIMD_asinf"
+.LASF1068:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1028:
+	.string	"__DECL_SIMD_sinh"
+.LASF830:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF792:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF966:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1031:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF726:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF777:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1178:
+	.string	"FP_SUBNORMAL 3"
+.LASF1096:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1153:
+	.string	"_Mdouble_ _Float64x"
+.LASF1266:
+	.string	"U_ID_1 1"
+.LASF1614:
+	.string	"baroDev_s"
+.LASF1265:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1503:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF870:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1129:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF756:
+	.string	"__DECL_SIMD_powf64 "
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1600:
+	.string	"pgn_t"
+.LASF1514:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1670:
+	.string	"quickMedianFilter3"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1327:
+	.string	"USE_I2C"
+.LASF778:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1278:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF718:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1109:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1088:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1080:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1292:
+	.string	"USE_UART7 "
+.LASF1525:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1354:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1392:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1144:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1450:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF924:
+	.string	"__DECL_SIMD_erff16 "
+.LASF977:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1414:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF829:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1225:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF940:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1454:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF811:
+	.string	"__DECL_SIMD_exp10 "
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF825:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF799:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF916:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF716:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf "
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF964:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1098:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF759:
+	.string	"__DECL_SIMD_powf64x "
+.LASF709:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1424:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f"
+.LASF773:
+	.string	"__DECL_SIMD_atanl "
+.LASF952:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1332:
+	.string	"DEFIO_NO_PORTS "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1344:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1390:
+	.string	"UNUSED(x) (void)(x)"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF701:
+	.string	"__DECL_SIMD_cos "
+.LASF1673:
+	.string	"baroCalculateAltitude"
+.LASF765:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1029:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1482:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF753:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1682:
+	.string	"nextSampleIndex"
+.LASF935:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1380:
+	.string	"__INT_WCHAR_T_H "
+.LASF1656:
+	.string	"pgResetTemplate_barometerConfig"
+.LASF1147:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1616:
+	.string	"up_delay"
+.LASF1418:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1649:
+	.string	"SENSOR_GYRO"
+.LASF1154:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1362:
+	.string	"__DEFINED_size_t "
+.LASF1220:
+	.string	"SERIAL_RX "
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1305:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1286:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1547:
+	.string	"BMP280_TEMPERATURE_LSB_REG (0xFB)"
+.LASF1671:
+	.string	"savedGroundPressure"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1401:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1395:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1515:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1201:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1294:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF793:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF704:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1226:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1695:
+	.string	"baroHardware"
+.LASF1569:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1287:
+	.string	"USE_UART2 "
+.LASF1251:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1254:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1692:
+	.string	"isBaroCalibrationComplete"
+.LASF1060:
+	.string	"__DECL_SIMD_erf"
+.LASF861:
+	.string	"__DECL_SIMD_atan2 "
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF723:
+	.string	"__DECL_SIMD_sincosl "
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1115:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1647:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1587:
+	.string	"short int"
+.LASF1485:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1680:
+	.string	"barometerSamples"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF803:
+	.string	"__DECL_SIMD_exp2l "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1288:
+	.string	"USE_UART3 "
+.LASF1127:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1496:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1507:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1038:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1350:
+	.string	"__SIZE_T__ "
+.LASF1436:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF992:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1683:
+	.string	"recalculateBarometerTotal"
+.LASF1505:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1410:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1584:
+	.string	"unsigned int"
+.LASF1643:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1289:
+	.string	"USE_UART4 "
+.LASF795:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF960:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1174:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1540:
+	.string	"BMP280_STAT_REG (0xF3)"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f "
+.LASF721:
+	.string	"__DECL_SIMD_sincos "
+.LASF1478:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF933:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1513:
+	.string	"PG_PWM_CONFIG 508"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1552:
+	.string	"BMP280_DATA_FRAME_SIZE (6)"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1666:
+	.string	"BAROMETER_NEEDS_CALCULATION"
+.LASF712:
+	.string	"__DECL_SIMD_sinf "
+.LASF1610:
+	.string	"pgRegistry_t"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF747:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1290:
+	.string	"USE_UART5 "
+.LASF1669:
+	.string	"powf"
+.LASF1457:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF1351:
+	.string	"_SIZE_T "
+.LASF1624:
+	.string	"BARO_NONE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1320:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1118:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF953:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1504:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1402:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1347:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1441:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1188:
+	.string	"math_errhandling 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1189:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF947:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1291:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1756:
+	.string	"io_types.h"
+.LASF1748:
+	.string	"mathcalls-helper-functions.h"
+.LASF1740:
+	.string	"math.h"
+.LASF1734:
+	.string	"long-double.h"
+.LASF1749:
+	.string	"platform.h"
+.LASF1721:
+	.string	"mathcalls.h"
+.LASF1702:
+	.string	"src/main/drivers/barometer"
+.LASF1703:
+	.string	"src/main/drivers"
+.LASF1742:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1728:
+	.string	"libc-header-start.h"
+.LASF1711:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1741:
+	.string	"math-vector.h"
+.LASF1715:
+	.string	"stdint-intn.h"
+.LASF1724:
+	.string	"target.h"
+.LASF0:
+	.string	"./src/main/sensors/barometer.c"
+.LASF1710:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1713:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1735:
+	.string	"stubs.h"
+.LASF1706:
+	.string	"src/main/target/SITL"
+.LASF1732:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1746:
+	.string	"fp-logb.h"
+.LASF1709:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1730:
+	.string	"features-time64.h"
+.LASF1714:
+	.string	"types.h"
+.LASF1744:
+	.string	"floatn-common.h"
+.LASF1743:
+	.string	"floatn.h"
+.LASF1723:
+	.string	"runtime_config.h"
+.LASF1726:
+	.string	"stdbool.h"
+.LASF1712:
+	.string	"/usr/include"
+.LASF1699:
+	.string	"src/main/build"
+.LASF1752:
+	.string	"common_fc_post.h"
+.LASF1729:
+	.string	"features.h"
+.LASF1737:
+	.string	"typesizes.h"
+.LASF1700:
+	.string	"src/main/common"
+.LASF1701:
+	.string	"src/main/config"
+.LASF1758:
+	.string	"barometer_fake.h"
+.LASF1719:
+	.string	"sensors.h"
+.LASF1738:
+	.string	"time64.h"
+.LASF1716:
+	.string	"stdint-uintn.h"
+.LASF1707:
+	.string	"src/main/target"
+.LASF1720:
+	.string	"barometer.c"
+.LASF1750:
+	.string	"common_fc_pre.h"
+.LASF1718:
+	.string	"barometer.h"
+.LASF1705:
+	.string	"src/main/sensors"
+.LASF1745:
+	.string	"flt-eval-method.h"
+.LASF1708:
+	.string	"src/main"
+.LASF1757:
+	.string	"barometer_bmp280.h"
+.LASF1754:
+	.string	"parameter_group_ids.h"
+.LASF1739:
+	.string	"wchar.h"
+.LASF1747:
+	.string	"fp-fast.h"
+.LASF1759:
+	.string	"barometer_ms5611.h"
+.LASF1704:
+	.string	"src/main/fc"
+.LASF1722:
+	.string	"maths.h"
+.LASF1733:
+	.string	"cdefs.h"
+.LASF1727:
+	.string	"stdint.h"
+.LASF1753:
+	.string	"build_config.h"
+.LASF1751:
+	.string	"stddef.h"
+.LASF1736:
+	.string	"stubs-64.h"
+.LASF1731:
+	.string	"wordsize.h"
+.LASF1755:
+	.string	"barometer_bmp085.h"
+.LASF1717:
+	.string	"parameter_group.h"
+.LASF1725:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	""
+	.string	"\025"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"M\b"
+	.string	"d\013\204\001"
+	.string	"\036"
+	.string	"\367\255\350\337\016\n\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002"
+	.string	"\002\002\001\352\263\360\321\b\002\003\240\342\234\212\n\004\205\320\323\240\004\016\002"
+	.string	"\002\003\005\006\007\b\253\240\306\374\t\022\002\004\002\005\006\002\005\007\002\007\002\b\002\t\n\002\n\002\013\002\005\t\n\013\f\r\016\017\223\216\323\207\002\002\002\b\002\f\021\200\333\377\224\002\002\002\013\002\013\022\023\265\372\210\203\b\024\350\300\306\254\005\002\025\367\340\312\251\r\n\013\002\005\026\240\275\357\376\r\022"
+	.string	"\005\002\013\002\t\027\030\271\271\257\254\001\024\013"
+	.string	"\002"
+	.string	"\031\364\201\355\242\016\032\033\267\250\230\222\t\034\201\223\306\247\016\035\036\240\342\234\212\n"
+	.string	"% P\202r\b{T\344{^L\346v\004\315"
+	.ascii	"\210:+}\357e\230\233\026\301\023\226-\020\030\t\200\030\001\364"
+	.ascii	"g\256k\206le\2744\356\026\215)\222\336\001o\214.q\337\266m\343"
+	.ascii	"\305\261\216\345&2r\336X\007\374K\220\320\217\3278\t+\334\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 hu\002"
+	.string	"4\003\\"
+	.string	"\n"
+	.string	"\001\003"
+	.string	"\002\004\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\001\017\002"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\001\021"
+	.string	"\003\023\001\024"
+	.string	"\003\025\026"
+	.string	""
+	.string	""
+	.string	"\030"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"Q\211\030\r \204\320\\\235)\312*g7\247M8K\277\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\034\001\325\b"
+	.string	"B\01604@o\222\016\034\215\016\234\350hd\270\025$4B\323\261\227\004\250\367{"
+	.string	"\365\350,0\213~\237\3321\303\252\224\335i&\277\374\306\341\036\326\0055\266\215\020\271S\267\222\tE\205BI\305C$a\203\377z\3755\356zX;2G\013\375\346P\220L\211\317\236PS^2\222\252\257d\244\026\316\235\202\277\241\355#\250\021\374}\fM[\217\001}\307\320X>b^\247v\021\2319zW\304w\370\311T\205\300\216\242n\234p\224Po\254\351M\373z\325\304y\350Ef\036L}\275\206\320_S\034G\254\205h`\300tv\217\277@\273\240fff^\324\221\214\344\342\351#\326\t\224\f\013\353\001\356@$ P\002a\006\263\003R\006`\026\004p`\354\016m\2602\020G\003\370%\340\024\200\245\360\374\030\030'$I?\354\203Q4P1\007q\322\346+\024#+\326\221\033\230b\027\003&p\214\2052:qv\214\035r\006\272"
+	.ascii	"\231\341\345\216\n\362\272Y3\007'\361\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"M\005"
+	.string	"b\311\035#\240)\035\360\273\nA\337u(!"
+	.string	"\353\017\376\376\001\375\227W\313\256\270yBH\263\335\357o\033\313\235R\nE\\l\301L$R\313\310\314D$\t\222\370\275\205\236\326\201\232\326\320;7\326O8>\257\300>k\350\\\271bS|\367\361\346\352\032\266a\213,3s\265\200\242{\274\263\373p\034\034\027\266\325\241\243eG\353\256\3437\3257\271\205\253\263\243\262\033\250\025\001\023"
+	.ascii	"F\271@*\n\\<\bF9\013cTb\203\353/=4\242M\005\233\324e\347L\n'"
+	.ascii	"I3\r\301\024t8\334\231\333\024S\004\026`\b"
+	.text
+	.section	.gnu.lto_.pureconst.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\004\230\004\b\230\004\017\230\004\021\204\004\023\230"
+	.ascii	"\004\024\204\004\025\230\004\026\230\004\030\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"U\005"
+	.string	"B\307\024\035\260'\303\001\f\303"
+	.ascii	"\222$\220\206a\030\216\311\232]b7m\333nGW\302m\357$S\372Q\316"
+	.ascii	"\005H\272]oP\013\004M\317\364\300G\313s\231b\207<\221\321.\355"
+	.ascii	"\022;\304\306\365\t(\312\3018\032\346\250C\317\303F\247\236j"
+	.ascii	"\227<\223W\340\026\001& `\242S\312\003\205@p\271T\211\300\241"
+	.ascii	"X77\340Vp\032\334\242\260\314\362\370\240\233\036&EW8\302\"\227"
+	.ascii	"\252\323\205\201\244#0\035\356z\001\2161F\321\273\317X\346d\263"
+	.ascii	"\037Mv#\370\375\t\365@\216.\023\350p\265\222\227<\276~\340j\232"
+	.ascii	"s\003"
+	.text
+	.section	.gnu.lto_.lto.126febab6cb6f85f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.12.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\b_"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\257\375\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\007us\350\334\006uq"
+	.string	"\005\001\006'\001\b&?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_barometerConfig.14.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 C\325\001"
+	.string	"\324\0026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\305\007\331\330\004\005\001\006\035\001\025\001?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\004"
+	.ascii	")\202\3010\225\273\007P\004"
+	.text
+	.section	.gnu.lto_baroDetect.21.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\260\001\335\020"
+	.string	"f sG\340\360&\035;qa\344\003\355\177\256\004\354\236:x.\r\351\304\230\332\007\3712VA\036\332$\223\270\030\333\272\326\330\310`\215\r\317r44\003\267\001\361\254!\376\251=\207#\243$N\355\013\026rK\006\331{\313\224\002^"
+	.string	"\\"
+	.string	"^"
+	.string	"(\236\223z\n\f\367\330}\235"
+	.string	"\332\r\021\330\264}:\374\207\366\271]\200\366i\333'\221\224U\017oh\036\2425\003\223\355\206\\\024q\325eT\225\277\272<\354\005pfD3|\\\034\036eH\f\241\231\016\227\214\004yu0\n\340\212Q\345 \331]k\313\265\341\236\267]b[\202\375\032\001\036X\212\344\303~\202#d\024[E\262\303\225F\033\373rw\327\361e_\347\227V\253T\177{\2602\032\004d\354\322\314l\254\320|A\302v\312\207\271\243\324s\262w`\266U\315\346\263BC\321nx\340\323\020\266R\316)\206W\221\272\016\214\001\354\202\b2\331>Cd\t\347\244j?%\225_\321\354\t,\372\226Cd\342\312\312sc(\332~\317]x\003nvw\304oq\237\n\376\210O\203/\372\326\247\377\242}\352\rC\373|+\306\322Y\234\260\231$\226\316\334"
+	.string	"H\026\333\222\230IX?\3720\353\211\321\306\362\0064\031\035\004\311\350\221\027\324\310b\312\242\304\220\214\3379J\245\016D\361N\272\017uA\345C\231x8A\247\240\02391\0301}X\350T\242SL_\347\322\261x\037*\002\007~\036\330\322\201\\\313\n\212\205K\371@\316\004b\217B\367q.\236\367q\035\341^n|Y#\232\361\374\304_\245\021\035\361\374\250\257\3224f\260\255Qc\214\375\235\337D\016\220Q\021Kr$\r\005\035"
+	.string	"5Y\345\264>h\f\256_h\t$>\230\205\026\331"
+	.ascii	"\263\005\2105\276\024\353qd\253\225\023\004\n\032\024\024\006"
+	.ascii	"\336\272\307\021\222\307\331Z1\242N;\3025\373l\302|\224,\027"
+	.ascii	"\"\003\341;5\n\2169O\2658\225\216<\255\202\002"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.22.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\035\007"
+	.string	"R\31624`\213\322\001@\007HU\260E\001>$')\\\255\201\327M@\365\244\005f\033\252WhmW\367\2549[\203 a\334\323\313r\f\013\240\272\332\b\331R\246\024\256L\242\205\261,0R\024\336\025\341u\261\256wY\240X^%^o\"`\310`\305\207\2010\276J\333\273U\221\352@G=\3663\324U\365\237\222'7\373\030\317\310\370\024n\320\344\263O\276\206\372t\r\370x\350\344\346*bS\304\3268\251#\373nUd;\255\231\276\003\200\350(\330\330\005m#\3131\225*l\337\376\305\306\256|\200\2601v\215\004\372(\373h\204\354jO'\216=1\377\026w $\217,\304yJ\022v\327\231\205\034n\275m\002\333\006\266%\002\007"
+	.ascii	"2\241U\037\370\003&@\327p\220!J\270\313\246v\222\001"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.23.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"U\t"
+	.string	"\026\322C=0\345(\035"
+	.string	"p\373\003\236\254\334\216\210Y\325\320\206\233\"\266\336\336\372\"\004\375\365\232\325\032\366\007\324\306\"\370>@6H\251\321\nLi@\231\254\243\342\025/\307$\205\nu\377\275S\n/"
+	.string	"1"
+	.string	"4"
+	.string	"\237\316g|B\347\323\240-\340!\312\376\245\ny\r\330]M\236\034|\004\375\307\274 \265:=\016T\354\256cj5r\313\333f\260\255a\333\025>gw\327\222e\277\365G\216A\013\200\206\231]U\254\300\302\246\315\212\355{\354\003\221\213\030\355\277\034\006|\313\344\271[rS\263\033:8#\370Dx\036\007\255\032\311\363\252\346\t\367\234\225,c\270\300P\022\304Q\3722w\231|\025\177\224\342S\237~\251\363\371I!A\305\230#\rK\200\215\004\354\360\024\245\211\003~\240\0224\002\202b\"\373l\320\332yt\320\214\217\206\270\222\305\310\353H[\005u\241\215S0\227UJ\242\"\257n \355\253\3367\242\2376\3526\221\306\325O\313\026\034\b"
+	.ascii	"\207R\026eB\033_\340\301\005\030\227Q\254\325hp\227\027\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.25.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\254\002\345\025"
+	.string	"F\250\221L\260\324Q:\324 yQL\242\243\r/\225l\257V\305\244yQt\266\243\240a\177\033\374L\330\302\210^B\360\323\3644\004\361\fb0\207{p\320?\350\"\020;\370\306o\300S\036;\370\331s\357\034\213z\337\372h\203\220\275\245L\001{"
+	.string	"s"
+	.string	"\177"
+	.ascii	"/\"\200O-\034>B\253\204\314\233O\330\016\340\336\017?z\367^\227"
+	.ascii	"\307V"
+	.string	"\034\376?\233\340\247\236\333l\252\204\262\200\224\204T \271\367\312T\030&rhY\200\310a\r\3016\026C[\333v\366aq\206\t\306\211z\340\320\262\b\211q\344\205\006Y\030Q\323\t\324\266\210\253e\311\335(z\2418\013\323\001\002\b\357\270\207\320\237n\223\230{\357\373D;\360M\370\177\205\377\023\376\356\005uU;HP\356\247\253~\206\342\024\367\235\231\236\341Q\315'\207\347G\211\034r5 et\353\252\263p\374 \364\220\004k\260f\374x\307\017|HS\301\333I\376\324\247\253\356g{k\322\377\376\213O0\263V\357[N\371U\354w\330\347\223\001#rG\272\245\332#\275DUJn\216P\206\023\247l\273v\267\375{\316\273\267Z<d\376\364>\025\\z\321;h\344j\013\267tNB0zUk\035\372M\261+\r\224\017\\S\275\327\325%\325\002\375\275HY2j\336\222\372\177\003\273\260\241"
+	.string	"\357\2750g\036\267\240\235\2318\274\006\222\0249L\260tt\353*\032\275\251`}\314\3152\233\342y\005\2630wrrD\016Q\200E\\<#-\314)\233H.\036\221\0377\235\271\034\265\352\356\302\253J\003%\205k\2527o\310\252r\312*\267Nr\002\314\001<\243Mm\301x\001\2076s\240\3033\326N^`D0\036xQ"
+	.string	"\023\203Q\250\335\330\314\306\006c\211\3014\307rfg\254\005xM\254\034uF\032Y\316hdfI\232\265\321\224\325nf4YMi\312b)'q\306R\246C\222\245\254\225^\256I\227@\302\262*\357x\345\f_\325\332\372\230[\375\021]\315(\330G\256"
+	.ascii	"\357\275\361\031\365\033\013\315\347\2532@\302U\237\333\330\340"
+	.ascii	"0\025T\242\022\322\013\253\356\0340 `\"\"\226w\300\320b\305\001"
+	.ascii	"{qB\215\273]\366\200V\256\367\254=\260Pe\225b\032\b\32199\217"
+	.ascii	"\0219@p\347\221\241\307\006\na\267\234H\354\246\366\372\257s"
+	.ascii	"\215\357C\243\234\205u\334\364XCOL6\220\205\351(1\224\027pp\031"
+	.ascii	"]\273\212\fW\250\336\304\036\022?X\300q\202WS\"\016M\372\325"
+	.ascii	"\342\221\217\274\\\204\3672\334\224\202\356\001"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.26.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`K\003\r\030"
+	.string	"\006\355\235I\300VQ:P\nY\234\001\251\316\274_\1771f\3254;\235\3378\272\263\3119\036\037$\310D\233a\335\3200 \017\2116\351\350\245B\3542\242hd\273\264\245\323\240\304T\263\310\274\325-\255\337"
+	.string	"\313\366Q\311'\204\310\235R\210"
+	.string	"}"
+	.string	"\212"
+	.string	"Lj\255.\017}\263\242\344\005\224\201\203c\250\326\372r\314\220\027\323\237:`\200z+A\002f|\270R\364\262\324N\240 \347A\034\274\265\352\216\f\325z\276\f\033\037\332\366a<F\216u\300\023EneW\324\323\213R\353\031#p\227\370\020<K|\270'\256sp\251\216\377\336A\027+\226\340r;\007G|A\003: #"
+	.string	"\344n\240KH\t$\357\235~\310\361PjrPk5\305\345D\334\341mG\260}\2637C<t\311~\215\333\360\317Oa\232y\320\343\036\372\346!>\374\276\214\370\330\350\222QA.P-\220Z?~\244$U\252d\237;tw\366\301Zk\365\232\260[?o\326\317\237\3452\376\325\203~U\352\274\373d\242\036\227\332d\242\026\227:\\jp\251w\251\351R\277\245\302Q\224&/\241ZA,Q\251G!\321\212\363.\322\220\256\235\343\367\214B\201x\261y\376\215;!F\032; \001F\341\212{\r\357\2013\376\302=\021\331v\200["
+	.string	"\310\247\311\256\355\016\327\201\323R\244\326\312\300\027\372\220\314O!##>\f\177\270$\025]\255}a\206\036\267\373\027?\267\335\361{\2071:\245$\235\354\300\006\356\356\030D\377\306}\030j\312R|\350*\362$\345\373\271\374\274\323~l\276\035HW\201\323\035\355\356\234Z\27213\214\334\350\024\253\226\356\346\350\251B}:\220*Urj\317;\001\033U\362\201\177SK\223x\320\005\033H\0133\b\265\r\344lua6cAFN\220\200C\316Xhd\265\022\2064oh4\322\264Q\031\001\271\200T\220\240\001\003\230\2536\273)\037\2204652\n+\313\300L\262F\326\224\246,&F3K\332\214\244\305f3\262\232\230\214I\213\301\006\270\264!\315X\255,\315\030\352\254\007\353\232\360\211\030\351\326\345\250]\220\036!\232\332\323~\260\335\332\006?\266\3451\365)!\375\020"
+	.string	"\344\003\2455.k[,L;\322\334G\221i\013"
+	.string	"\0219a\355O\226\025\227\2654< \260\242\221\252\363\312\031)bv"
+	.string	"Z*0Jt\304\343\335\004\302i\254\200\t\223.\n\355\252\332\330\3265\016\233\260\224:\262-\017s$\215v\350\302\200VK\260\250|t\205\305\244jA\306E\215q\267\004h\347\210Xg\257\"\353\300\216\2073v\n\266\3300\315m\030m\276\261\006c\177\002rCa\\\301\310\324\355\330\213r\b\276\335"
+	.ascii	"Z\354\333\372G)\200\335la\034\027\262\204+_\0044\306\352\322"
+	.ascii	")\205\330\003"
+	.text
+	.section	.gnu.lto_isBaroReady.27.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 \361\215\006"
+	.string	"\262\314-1pk\322\001\300\0045\020"
+	.string	"\001\302m\200\341A\264Y\007p\257=\213\324[k\255\235\336N\375\342\371\332\254\252~\355ON\341\217\241\177\211\332\210\2252\245\256L\034\3030Ks\024\205\365\\{\027\366\326e\201bY\025\367\326D\300\215\201\271\205i\315\255)\3565\224:\300Q\007\373\030\317\200~\205\0332y\352\222\237\221\\J\r\240"
+	.string	"q\262\362\024\261\371a\307M\252\204\375\310j\310v:\265"
+	.string	"\364\216\220\335N\005\262\034\322\206\205m\215=\371"
+	.string	"Ac\3708\321\271\b\342A\303c7.\025\035>\241\377\213GF\243\212\362l\236"
+	.string	"\t\273\353\244<\237[o\233\300\266\201\355O\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_baroUpdate.28.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\353\001\r\020"
+	.string	"\226\334fF\340\262(\035r\222\016\023\005\007T\355E\3579-"
+	.string	"\346\241v\220\006\f\245f\317\024\300\340p\032\337\274\346\325\376=\313x\034}V\211\320\337\227F\243\034\343|\332\033g\314\036\303\023\007\334\223\324\336#I\336{K\231RR"
+	.string	"M"
+	.string	"["
+	.string	"*\033\344\247\270\214\312+(\203}\322\346\303JM\317\2342\356\300G\362\021~\200|\334\021_=\302\325\225\037\362\261\036\267\226\303\307\016{P\334x}-_8\252\205\300\001\372T`\002\227\032\035D\237K\025"
+	.ascii	"\311\234\323\372\3728\334\362\266\037\330V`\253)\016vT\224\207"
+	.ascii	"}\232\313:?\306\031P\364\257G\037E>~A<\264\364\307\"\231\307"
+	.ascii	"\0362;acj\017[\346\322\205\261\017\347\212\260\255\016I\365f"
+	.ascii	"\265\214j\b\325\013\325\272\352\213\002\260\324\030\344\314\271"
+	.ascii	"\341\307g\322\"\216\tU\3733\0018\023D`7%\005`0DH\320x'_\214t"
+	.ascii	"v\314X\nw\321\202\305\312\020\240\326u\203\027\327\262l\227n"
+	.ascii	"c\"\331\247\257(!\2403\347\\\240\3425&~\314\243-\240P\362Q\227"
+	.ascii	"\26433\213a\225\235c\203M\2269'\202\320\214\206\306R\037z\303"
+	.ascii	"S\003\261\013s\f\362\0336\215x\247\224\023\252\363J\025\270\224"
+	.ascii	"\327\245NN)\356\304\244\204\342L^\212\0331\340\356\302\311\343"
+	.ascii	"R\272\316\343@\262\326!\334\366\261\203\350\340\231mh\345j\260"
+	.ascii	"-\327$\255uY\344\023IjC\210\240\177m\273\313z\311y\211\227\013"
+	.ascii	"\r\032nh\277\362\303\226\360+ \220\202\231)\253\003\202\004l"
+	.ascii	"\230\363\n\362m\244\260\0274<\202c\f\353+\1774\236\265\034Bl"
+	.ascii	"\007\213\003n-\376\222\031G\343\032\b9<\265\3531\240#\026\216"
+	.ascii	"c$\231T\025w\326\302[\2501P\221)\303[[\205\342\211\205\250-2"
+	.ascii	"#\352\323\224\213\\\boP4n\260\225\243x\020\223\321\\\020\n"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.29.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\274\004\205\035"
+	.string	"fv\272I\240\230Q:@;\277iUv\355\312\003M;\231\307$\262!\304\004Y\"\036\216\026F0:H\026\231\276\361_\341\031\347+T\255|\321\365\030\017^\340\231\317\214\363j\222\006\3140\366\022\271\233x\341\342g$\177o\"\245L\001\235"
+	.string	"\230"
+	.string	"\250"
+	.string	"\264\371s\362\305\311o\221\317\315\337\0014%T\032L\251u\305\327\231\2725\225\324X\341\356\277\337\253\305\372c7\261Vo\027]v\324Zc;\277W&\376\330\316\375O|\253\036\263qb\260\302\336\270\304b\f\022e\304\253\326Z`\347q\343\316o\217\365q\342=\321\212F\220F\021i\312\"Sk\315\221[\243;\305\335\241;;j{;\305\346\336\027\366@D\"\f\002\f.\355|\261\242M\360\305\366,\310$\222\265\326\255ZV\021\3741\303\036\324Z\317\300`\213=\335\377\032\376c\370\247,t'\367:\341\022~\205\354\020#]\210\020t\347\366f\311\2067\270\326\272\324\ruD\205z\2536\347j\314\022\030+\\L\\\346_ \233u\364\235\272\b$^ \022\335)\324"
+	.string	"\270\234|\374\365\305Z\013Nb\222\031d\300\320\250x\b\243Je3\277\325\217\033\352_\261\366\323\177\376\320\310\027\"W\270\277M~\020\214\017D\371?\224\357C\371=\224o\243\374\032\345\363P\376\016\345\353L~\316\310\307\241|\332\344\317&\377\006\306\227Q~\214\362m(\277\206\362G\312\2075?\337'\013E\302\004\n\024\350\316Y\033\220\022\352 o\372\326doI\365c\262Mz\025.\\\240;o\332\226\343\326+\\\322\307f.\353[\263\227\037\216\365\217!\003]\240\254I\246\246'\034\270X3\232\322FM\177\270\265V\266i\021KIe\343\017\027\253kj\306\231\261\177\r\033\350\002k\232D\321K\377p\241\210\370j\275\203\257\257-\246Z}C\260\036[\024S\332\240\r\353\251Uz\315\336\246\355\243U\362\020{\342\266[\354"
+	.string	"Z\245\214\037\177\235\273{\233\322\234\303\036\3510\326\312D\364-\262F<|\247v\376CQQ?\240#\322%@\260@\001\256V\002I\351\203\322\b\b;^Q\204\330\215p<\235\222\016i\307+\002\221K\342\355\222H\350\222r$\216\212\220rF\274\244\034\356\366]\t\035/\247\264\333\361r1+\337\212\265\237\206\232\364\365\357\\z#\327P\363H\t}\303$\263\300j\311\322C#\314\017\361A}\2457\333be\201_\200:\250Y\314\017\220O\363\364OwV)\243\247k\355\323\002l=}CSR\375\272t\332\326\004\216\220]k"
+	.string	"X~)blu\3554\217N\323z\2477\247u\232j\225^8\235\323\373\261Z\275*)8\275K\244\204\263\246u\243)\275 l\224\336Xk%\n[\250Q4\006\215q\212\r\211\222$I!\215\001\240\002\031\251\232\333\021@\265d\316J\345v\3114%\324\232(\261`A\002\257i\022\005\204[\271\364\362\355\353\244\t\023"
+	.ascii	"\361\023lv\246\013\314N-M\b\024`\b\031\2523\264W`bM)\262ZB\350"
+	.ascii	"\227\t\317>8M\310\307\2101@ \003A[\362\331`h\247\213\335`\017"
+	.ascii	"\217\221\264\305l\204\375\021\316\210\200\274D\305\344\n6\351"
+	.ascii	"\275q\023;C}\221\033\202\224\263F\301\263\027\025P\232j\251h"
+	.ascii	"\3673\276\234\251\211\210\222\nY\3138:\f\375\322nz\264B\n_C\247"
+	.ascii	"mS\225\332xMv#\273\360Y\203\273B\204>\360(9\353\233\345\330\353"
+	.ascii	"\2553\177"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.30.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`-\003\005\026"
+	.string	"&\247\207I\300\322Q:\212\210\271\341\303\201Q\321\324\003\006\225\364\347M9&Rp\344"
+	.string	""
+	.string	"\001\360\217"
+	.string	"\002\301\300\253u\213h\234\344\332E\016\352\325;\003\223\332H\202\353\252\306\364\021\330e\026b!8"
+	.string	"\367\003\035\370o\373d\223$e\nn"
+	.string	"h"
+	.string	"s"
+	.ascii	"\253\257U\273N\355:\004\327\362kp\327\337\365\356ZO^9M\bb\314"
+	.ascii	"ia\214\232L\362\350\203\256\332\332\262\215\375\244E>SO\310\300"
+	.ascii	"\361"
+	.string	"\351\230s\316\336AmT\202_\033\253\016\351j\307\273Q\251\243`Je\316\311\342\351\350A\003</0\270x90\326\304a\206\016\351V\340\341vS*sN\357\216\227\243\016\325\266\002\333(\3667\004R>\305\211H\034\241F\020`bbB\024\247\375\325\270\376\277O\307#A\215\024\352\367\252\023\302\355h\253\b%\222\261\002\271F\263\272Si\245\tU\352g?;\342\216\026Y\332_\022\214\271=\354\"\334\276g+8\337c\177m\022\256c\341\032\266\353\222]\277\344\232D\256G\344ZD\256]r\035\262k\220]\267\276f}\035\270\373\247s\316\0359\350\323\201\200\255\177j\364\004\224!\312u\233A\203Pw\"'@\3417\366O{)\3049\2352\216L\2719\305\002!w]uA \0179\210\244\243\321:\310S6ZG\241;(\326[&_\235u\375W\277Ou\360&\227J:\241\324U2\r\237z"
+	.string	"%\371\360\212\363\303\016\324\304\003\325\234\271\003\326\022\352k\261\002\251\364\013\215\026j~\221\331h54\231\232\255\305ev\263\325n3\264\333l\006\246Ef\366b\273\315d\003\\\213@\263\315jj5\333\254U$\352\005&\3618\331\272\322\221vPc\354I\343\250+!\3541\027\260\307\234v|,\013\034M\032\300\367t%\264\266P\244\225\004,,\241J"
+	.ascii	">7\304\337\016\365\260\343a\372{%o\335\205\204Sny\034M(\371\311"
+	.ascii	"\317\216\230\343\265b\001\311_K\342\2168=!d$\027\240B\027\024"
+	.ascii	"K\250a@\310\020B\350\210\224Q\234j\003\220\002\031\261\";\020"
+	.ascii	"P\252\2102\034\022\346$\030\326\371\275\204\313\336\t\247\312"
+	.ascii	"8\221H\353d[\r\017t\276u\370I\221\334\303\211W\363A\272\004\204"
+	.ascii	"\260\272`\243\030\236B \253b\035\321\333\360\372\272}\331D\r"
+	.ascii	"q,\230\032\213\272\245g\245\255\331x\005\244/J\322d\276U\255"
+	.ascii	"\262\367\276\353\212\214h\200\345J\016\343\253V\357\026\213\025"
+	.ascii	"w\341\266\304\306\001\3614N\332\222'\207\207\313\211\235\210"
+	.ascii	"od\232\177O\264{dq\270?b\203\245.\344\375\b\374\003"
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.44.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`o\003\255\026"
+	.string	"\366g\215J\260RN:\356W\313\304\356\025\212\226\270\233\270\271;\2572\214\210\377\201\365R\357\301\323\206\331\326f\t\363gX\033q7\3243\310,\334m\203\331\026\263]\321r\001\235x\325\225U\341\351\270\267k\342\326\201Y#\226\020\"wJ\001s"
+	.string	"u"
+	.string	"}"
+	.ascii	"\225\350\024\n-h\222\361\024V{\316\004'\216\"\3078\003N\241\020"
+	.ascii	"\316G\352\311gy\347\374t\200\241\034a\265V\333\375\241\317\266"
+	.ascii	"\371C\035\333\366\021\312\027d\333w\372\223\216M\361\024\006"
+	.ascii	"I\026E?*\302j=o\037UnB~\024_B~\334\0217\277T4}\n\f\376\276\037"
+	.ascii	"^\fs\362\001\f\016\235\222\\\234\265\324Z]v\270\307\333f`\033"
+	.ascii	"\306^\253/*\234\3303w\221\023\240Ukeiq)\235\237\364\321\027h"
+	.ascii	"\350\201\037}\232=\331\212\332\241e\036\231\0022R\225U\351\330"
+	.ascii	"\n\333>[\307\366*\2055\250\032U\004\037?\3747La\351\370Q2\272"
+	.ascii	"H^\361b\335#\273\244\266\225\324\265\0325\255\244.g\3243\032"
+	.ascii	"5YR\2173j\221\244\336\221\232\216\324/)Q\340\241V\016eD\252\321"
+	.ascii	"H\245\224\302g\0341\345\252h\330\237\311\235\355\222\375\024"
+	.ascii	"\261\tu\036\346\260\254\265\207\305\337\361,\007\017\\\\\310"
+	.ascii	"\217\344~x\003E\037\270@@E\331\202!~\236&\002HH,\310\257\216"
+	.ascii	"eBxy!?\216K\263\212\361\223,\203\0237e\213H\b\001\372\363U8`"
+	.ascii	"~\376\006\256\254u\347@\277\306m\304\310\340\350\2018\362\243"
+	.ascii	"\327'\302iH\240\232\261`t\302cL\301\240_$\324_70\342\331\237"
+	.ascii	"m\n\017\306\220[\341\351nt5;\336\214\205[\217\267\353\331\350"
+	.ascii	"z7\033\232\231\232[\216\327\273\255\244x\227A\307\273\335\354"
+	.ascii	"v\274\233\3156\375\036\371\303\323~\f\271\242\265\265-\220m\333"
+	.ascii	"\272egy\f`\212lw\221l\323\266\266/q/S\tE\330\225+ \344\242-\n"
+	.ascii	"\211\250\261,s\211\364\265\276e.\231&L&\223\211\374h\242\005"
+	.ascii	"&\226Un\217\355\002~\035\240\342\216;[\333l2\235\350\201\001"
+	.ascii	"I\2501@\207\024SfDf\002\t\206\02469\240\242)\272s\021 A\252\210"
+	.ascii	"\2104\367?\003\037\357\337\001oC\341X\373b\233\376S\207\320\302"
+	.ascii	"\222\363\330y\252\021\037\2576\274\346\277|_\301\037 \233\260"
+	.ascii	"\314\253\307\303_\320\fE\323M\002\261\031\270\267\346\340\251"
+	.ascii	"\301\013W|\r\346\r\333\244v\177\f\n\354\203\376$\333_<\225!\301"
+	.ascii	"@H\036\236X~S2\367v\257\362\233xAQS\236\031\025!\177\367\372"
+	.ascii	"\0238\247\235g\202Kv:F\202=?\355N\217:a\272\242#H,/1h"
+	.text
+	.section	.gnu.lto_.symbol_nodes.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\321\001u\013"
+	.string	"\304\020\315\002"
+	.string	""
+	.string	""
+	.string	"\002\031\177 \200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005$!\200\204\001"
+	.string	""
+	.string	"\003\005%\"&\020\002\032\177#\"$\030%#&,\177'\204\202\202\200 \b(\201"
+	.string	"\005\020\023\021\024\005\024)\t*\201"
+	.string	"\005!+\002\025\177,\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\037-\002\026\177.\017/\027\1770\002\033\1771\002\034\1772\035\1773\005\0224\036\1775\005\0236\005*7\0168\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f9gistry"
+	.string	""
+	.string	"\005\n:"
+	.string	";\201"
+	.string	"\001'\177<\377\037"
+	.string	""
+	.string	"\200\200\200\001 \177=)\177>(\177?\003"
+	.string	"\037\320\360\372\250\001\001\244\016\003\004"
+	.string	"\302\n\003\b\004\342\n\004\b\365\006\225\265\001\003\017 \310\377\241\372\001\001\204\007\003\025\b\340\236\212\256\001\001\302\n\004\025\241\341\365\321\002\001\225\006\365\006\003\026\"\201\001\204\n\003\026!\344\023\003\030\"\244\013"
+	.ascii	"- \340\002)\"\356\255A3\3270\0059\024M^\271&\270\032\304\032"
+	.ascii	"Z\206AU\217\202\303\013\210E\226Fo\301\230\220\254\233H\236\244"
+	.ascii	"7ffG\016N\324\261\273\256\264\333\3722O\023\3211\274\213\305"
+	.ascii	"\236`f!D\017)\2074\214\337<\f,I\033X\272\034\034\3560\272\030"
+	.ascii	"\257D\030\217\331)\003"
+	.text
+	.section	.gnu.lto_.refs.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375 \361-\005"
+	.string	"\002\316%%\240%I\007\377\377\377\377\377\377\377?\372\377\340\3736~\373\233m\2665\333,\261\326\022\322\b\331\215\020b\311\226)7\310\300\206"
+	.string	"\347\201E\027x\275\361>\340\365f\361\314\322\rL?\332+\344\017\263bm\220_\220\235 ;\243}\223\277,\237\355\017\344\321[\311\013\371\315\3658L'Et|\037\3722\264\320\025\371\212\353\t\322\017\355\035\362m=c8[\370\312W\371\204\374`7Po\324+\352\023\350\021\252\273\324\021\232\240f\016\256\340'\355\357t\207=\365\323\177\020\003"
+	.ascii	"I\024\306BP\236\240\230\001"
+	.text
+	.section	.gnu.lto_.decls.126febab6cb6f85f,"e",@progbits
+	.string	"(\265/\375`\246#\345\250"
+	.string	"\n\016\201;Y0JA:\351\366\265\353\375\324\335\276\314\264\322\375V{\024)\"\232\377\335\336F\257\320\355U\265\222\264\213^\352\312L\276k]\237\357\370\025SS,@\341"
+	.ascii	"G\t\266\335\001E\261\242M\253h\252\324i\252PT\262\370o\030\266"
+	.ascii	"\255\216\323dI\371K\232k\025"
+	.string	"\335\260v\357-S\036\003\247\003\276\003\355\344\025\251\237\364\231MR\232\233:x\223Q#\357\257IuEU\352fE\252\371\025Y\223 @\200\310i\"aZ\300\200\2575Q\245p\230\234\273\005\306\234\252\367\325\t\307Q\361\352/\235\327|\215\327z\275\327\315\006\323Y\336N\032\312s\322\213\300\002DD\224\226\302&D\256\301\264\225\246k\270\034\036|u\305Mi)l_\375\246\245\273X\200\244\004\201\013X]\316i\017\230\256\322Rl\352#\347\253\0356D\260\300\320\313\3139\005\221\003\302F\310\027\026\023\234\333\\\354\232\312\262\b\336\021|gWs\244M\205d\275mG\203\247\004\246\254\336\256\263Q\370XH\326\373.\301\0320-+l\365\236e\301\310\352\"\004\277\267\360[\007\356\271\226\241\233\037\372\312[\254\345\376K\2469\3159\275\251;\370\232D\250\360\373\003\320\366\365\365\007\340\373\t\343t\f\374V\342\217"
+	.string	"\343\364\006`\303\2619\351EU\251\367&\340w"
+	.string	"{H\201\3559\200\037\002\0266a\322mb4r\324\373n6\023\266\333\204\312aUo\263]\013M\316\026\374\342\270z\224\255-\241j\262\302E\275\357\030Z\355'\205\212Z\2754\2719"
+	.string	";E\353y\247\231p\305\304\252\227GI\222Z\304E2\205z\337I\272H\237Uf\316I9g\nh\320\300(\325\250\267\215\364\221n~\255\313\336f\215\344\301\2444\2175\026\023$V\275\036\232\003\360:"
+	.string	"\323\b\337d\337\020\2273\211c\214B\3169\307\364\327\200\207k\016@\232\336"
+	.string	"l\261\2367\221\r\300\345S\232o,\032\233\022\230zko"
+	.string	"\366W\207Y\345\013f&\3139\325\020\343\305fEVo\207\325\006\353\364\035\326B\316\001\211\323$\345\257\234\323\016\2739'\2733\260\351\316\340\267\306#I\004x_\361\323\346"
+	.string	"\304\275\341K?\240\376\266\214\300\353\242w\273zA\374u\307;\374u/\314\337\367|\177\203\371{\357\213^\3363\360?\204\001\374\365\356o\024y\367\362\177\355?\230\337\3770x]\316\366\267"
+	.string	"(\370+\326\375k\226\336\200\313\007\234\2776\375\215\344N\270\201\377\376*\203\335\177\003T\264\336B\200[\360W"
+	.string	"\374\315\341\357\234\277;\374M\301\337O\377\201\277\025\361w\330\337b\177\017\371\033\354\357\257\277\323\277\307\352\376\306\372\333\353\357\256\031\376\337\374v\351\357\266\277\323\376>\373\273\371\367\221\277\213\374\r\3657\322\337\371o\021\374\035\202\277U\374-\302\337'\374\215\376m\364w\321\337\035\370[\350o\022\376\326\300\337\030\370\373\002\177\217\360w\005\376\236\300\337\021\370\033\204\277?\370{\001\177\357\374\235\200\277;\370\317\345?\334\337&\376\253\375?\373\017\366_\204\377W\376.\3617\211\277G\374\315\301\177-\177\013\377#\371\373\303\337\022\374\255\301\337\036\376\306\340\357"
+	.string	"\374\035\374\033\377\035\3637\360?\223\377K\376'\371\237\376G\361\337\203\377m\377k\372\372\372\372\376;\343\007\362\370;\214\020\217\231!\004\030\363E\370\n\245Y\241T\257\316hA%\266\267:\231\034J*&>\214\233\bk\223\256\365I\335\352%.\263R\326e\301\357\272\005\214\261\"|e\362nV&\265\313\203\2474#\201KO!b\272n\354M\231\303\217\241\256\305P\227"
+	.ascii	"s\356\224\031c)s\245V\327\324\352\222\316\313-:w\314'\235\356"
+	.ascii	"\342\353[\252K\354\225\037pY\365\036\350\206\0174\3032z\302W"
+	.ascii	"%\265Y\321z\211\007-\2249;\t\333\230\300 \370@\034\030O9\353"
+	.ascii	"f=\353\260\234\214\334\"TK\343\270\362\2006\360LRY\263\232}\r"
+	.ascii	"#\227\270lE[\035\320\005\376"
+	.string	"\257\013\226i\216\215U2\r\332\216\274\222\325\255\013\003\214\265\037\365V#U\206L\332\230\024\032\365\326\"u\253\262\215\315!\375\332\360L\233\260\303\272\016\311\252b\035\346\001\231\346\030#\244i\210\377\232\370\277\027\360\f\032XV\r\373\232\207\021\264\342\270\200\344e\016\361\237\024\376\0179U\277j\024\026nD\352p\220\230(\034vSo\030H\2652\303\224\013L\360_\177\364e\341\250\253Q/\376!\f\321\375\344`\264p\013\302\020]\271\272Y\271\372\354\246\271I&\206V\034W^\231Nu!(wg\203\254\336\337!x\246\210\360\025\253fU\255N\322Yi\031\201\025:\352\362r\031\342W\007\236\331!\254:\352\216\327\026\232\265\205\332\243\2372\322\316\303Z\216\343\312\313OK\235\277\362x\355\321g7^Mewg@\031\270\250X\314\200\353\017\314\311e\316\331\351\227\346%\022\315\373\327\255\363\327\264\355\001d\253"
+	.string	" 9\013\311\343\202\267\224$\243\356!?#\201$%\2334\3444/\225cUHe\221\270&\ri\246\242 \217]eeZ\325t\231\271\3464wN\252j2A\2312\227\312\224\211\304\311ILd\316i\023\216\222,\211l\345XU\223r\214\331\244!'ed\036KR\341$f\223\022\n\263\tG9\226lR&U5i\370\312\313\312Z\262\"\246\327T\312\244\f\203I*\271\304\201S\246\314<\227s\223)\345\345"
+	.ascii	"r\226b.\347\222)4\032\022\034\f$$If\2479\347\016LHV\314\234\004"
+	.ascii	"\247\344b\346\314\205$\224\231F S\270\214\325p\310+\251\374B"
+	.ascii	")\347\n\230rFv\206\3139#s\3161K\2514g\025p\224ZLL9?\3450e)d\232"
+	.ascii	"R\316\225\354\nZ\223r\314\212\331\223fdL+\263H\221\255\225\347"
+	.ascii	"\252\226x\f9$\277\270\303ZM2\354|T\034\367\213\217\245\220zo"
+	.ascii	"\2570\013+\324+8 SZ\365\276^\311 !\347\261\032-KR\036\365\326"
+	.ascii	"\252\236W\253\004\354\270\nR\257\355\rT\037p\222\232\331\027"
+	.ascii	"s\352G\344I\220d\275\325F\275\321\315:\365+\306\314c9\24756Y"
+	.ascii	"\303M\211\016\360FG\252F\331\360\200rzRo\n\265F\205\252*\324"
+	.ascii	"\247n\326\250J\3435\315\231\214D\f\263:9\030H8 Q\243\352\214"
+	.ascii	"*\243\341\236\022\020\244\254\256.\275h:\233_\316\314$ZHjTe:"
+	.ascii	"\313\351\342\305\374Bso\235\360m\022\256\313\332\324\315\013"
+	.ascii	"\252\223E\212\345\257\2320]a\366\300\340\367\005\300\356\353"
+	.ascii	"\013\200\257W\360k\033~U\202_\211`aspq\301MZ\203\351\252\205"
+	.ascii	"N\215\236\034\022\020\345\357\362\344\254VT\026\025)\b\347\305"
+	.ascii	"\354\251\336\213\250H\355\326}\026 )/\030\224\272\266>\263\t"
+	.ascii	"\346\\\345\246\025\267N\324l[w\3514?1\221v\005\230r\"'\225\227"
+	.ascii	"\225R:A,LA\261On\333\016\245\257\bZ\225\222~!IWY\275\226\311"
+	.ascii	"m\023+U\332\304\300\260]\273e\213\222A\307\325\265\344\017\322"
+	.ascii	"\344\200\362f\267\205O\323\002\016JQ\242\304\246\265X\216\221"
+	.ascii	"\343E\025\007d\006\317\305\235\022\3556\355N\t\223\233\253[o"
+	.ascii	"1\300\320 q\320Lhf\315\354Y\016\023\271E\203.d\230\224\016\220"
+	.ascii	"\256n\306\027\213\344\366,\002Fx \325p\247\to\233\315\272\345"
+	.ascii	"\001YN6\3518i\362Z"
+	.ascii	"\222\227\227MBh\340\001\367\243\nc\244\360\366\210=R\275n\022"
+	.ascii	"''\021\341C\263\2312\267\245\006\023\3063\242nW\350\246\215\262"
+	.ascii	"E\254\362)\313\3301\203\003\276\361Xr\325;\226&-A\231\315d\374"
+	.ascii	"\376\312au\314\305\355\260X_QzX-\030\240\270`\2034\334\023NN"
+	.ascii	"J\202\245\356\013\314\266`\261l\220\032r\276z\323J-\021+f\303"
+	.ascii	"\254\020;\244\233\026\314\372\270e\301\342\260`\226\207[\035"
+	.ascii	"\b\0203r]\262\340ln\216g\001\273b\203\330-\333\325pOiv\2329\363"
+	.ascii	"\001\003\236\227\rB\326\241fO\206<0`\027\020\0324\027Q,\352\265"
+	.ascii	"?z\254m\351J\311\013\335\2640\260p\201\257G\275\226\353YZ ],"
+	.ascii	"}\215F\232\227\033\022|\031#\3702]6\013W\251\263\361\266\205"
+	.ascii	"/\223\205/\243\003_\246\n"
+	.string	"_\306\006\376\255\016\2135\366\204\313\233\305\2522\246\270\275@\252\3672P\270\352T\331\253\233 h,\230Y\205\240#\212Y\275\227\352VF[\226\026\023\323f\256Gs\310\224Y\037\027\250z\355\r\254$\263\364A\306F\222\251\250zoo\374V\311\332\260L$\200\240\217\317K\275\237\033\353\271\225\232yc\253\013\263\303X\005aw\265]q\373dWX\250:$u\262\341\221\245B\3140\371h\320\2507%\3332$KU\275v\206\255aS\370\203A\265\027S\244\256\340[\03229\342x\274Po\265N\2672\376`\314\3272\251Y\005\337.m\023\037\024\265\026\365>\350\206oc\214\200\216\252\253^\013\003+\005\223|\b^\021\313\262\243\336[\030\277U\332\026\226\211\204\234\223\352\213\250\247\031\352\265K\366\305-\223u\221-\323\bf\316I\313t\003&\347\344Mw\006\335\031\334 VYe\300\373`\023\277\2569"
+	.ascii	"mz\003\320*\365\334\262\250Ydmm\365\326\004\261p\220O\030\242"
+	.ascii	"m2\214E\3523'!\037Z\220\006>\356\303\370LX\303\264\3156\327a"
+	.ascii	"\301=_s\301;>\276f\343\213\371ZBv\205\206\261\330\336\036\\\034"
+	.string	"W\036\026\202eZ\344\345U\275\252\025c\004GY\335\335\312\221DD\357\f\270\002,G\027\016,\023\206\207W\263\2000\301\0268\240\2733\031\2420M\322\356v\225\013\3169iu4]iP1\324[\271X7\035[ct7l\353\211\205z\217\223\030S\t\253\226\256u\315Z\327t5\315K\231,f\027\374n: \315\023\226\252\005K\315\002\0022\355\250\207\227\224,A\037[V/\332p\314\n\302\327+W\352\325E\212\345&\031\026\351\336\227\274\234\237B\374\274tY\201\216\007\246\251\022\306=\256\316\341\234\363\004>T\264P\341\315\312\353\\\207\331p\365H\373\252\267N\251r?#0\254\214\310\325*2iH^\330\022\246\246\n\035\223\262^*\235\245\217$\223H5\207\024X\327\f\365>\246\n\313l\t\253[\327(k\025\256\n\271\231,'e\214\270\213\221\302\0017\367B?\304\241\261\004\342\020Z$\322"
+	.string	"\025\r\035=\234\306!\321\317\t\344\301\250\250\210\223\342\003E\243KD4\3749\242C%\360\034\021\2036@\341\2108D\264\301\210\022>%L\240\300s\002\035\021\375\020\207x\214\307#\036\236\017\024\215Bh\221\030\223bx\022]\364H,\376\374R\240\304!#\021\360B;EC(\361\310\310\363\223\002=Q\310\b\241\303\"\036b\261\250\250\370S\201\b\017\374\f\035\231 \301\205v$ \002\004P\360\240g\220q\210z\360\300O\221\350\304i,\236\270QaT<1\001z\241\035\243\243\2421\310gh\034\032\361\374h\200\236\307\031b\212\372;\372\320\240>\304 \243\0371\310\310\236 \030:^ \240a\214\n\243\342\3175\242F\3665*\214\350q(\350\264\200\017\320I\f\032\"\032\306"
+	.string	"\235\307\243\373s\036c>D\207@F\237 \243\035\033\343P\350\347\372\240\347\361\264@\220\021\006\033\204;@\347\t\303#\207\"c1\205\3614\n"
+	.string	"\020\361\250h|\300\tt\204\016\241D\f\3400s<\211~T\240'\212\017\202\210?4'Z<A,\016\241Cc\tCD\303\023\307\241\016\027\332\271\340\bt\002\335\240?'z6\340Wb\347\030St\242G\025(\212\216P\\\031\341\016j\034\032\355\234\350\020\310h\204\021\022H@b\002\242!Z\024\3414v\320\300\301\216\n\240\341i\201\242\r9\"vP8\201\210\020@\211\247\321x\364S\301\351s\242C\024\005\016\212\236\306\243\343\3614V\200\006"
+	.string	"\377!\016\207\200\316\t|\240\202\310\310hX\301\177\206\214'\361\f\302\037Qb\203\022&P\210\271\211\016\204\035\b\2017\321AOO\007%z\360K\364\330\236\235#\n\343\211\022\r9 \347\364AAs\364\t\032JA,\236\320p\032\207\037"
+	.string	"2\016\205|P\037\0231(\361\250\370\343s\022\031\025\r\217\032R\030\021\371\234\307\241\"\321\206\350<\001%\032\372\244\370\231\271\020\006G\037 z\241\363\204!#\320\001^4:\215<h\261h\344\23191\301\211\016\211\216~\210\206?\301\243\317\tg\003\202\350\021F}J\364\240\304\241#\254bHt\002\371\030\035a\0245\016\321#6\242\025\370!\0369\300\210\0025FG>\350\031\004<\341\004\262(\021\003\212\306\341\0071\247\361\b\035\032O\243\242S\204\033\324\207\003\021(q(\346=g\211\223\004\007\b0\261\303\341\b@\300\t\017#\204\360"
+	.ascii	"\374\263c<\321\263\250h\034\226\300s4\026\217\304\363\310C\034"
+	.ascii	"\032\026\361\374\030\217<;\002 *\026?\360\371)U2*8\344\217zi"
+	.ascii	"\234\334|W\334|\223\2022ZNd\324\310\313O3tn\322E2K\3421]\244"
+	.ascii	"\233t\222b\266\024$\375\2051W\360r\221\225F\037\024\231\n7\322"
+	.ascii	"t\006\355Fs\006\024\313u\004\210\034_\233\221\274$N)\033\013"
+	.ascii	"*Q{\267Z\266\222@\372\352M\277hb\304\330\301\324\333\302M-pK"
+	.ascii	"yKnZ\334\320\262"
+	.string	"\347\245\213\306\215\016\357\005<!xG\n_\304\272\324\036\267F\0138\\\340b\317~T\370hL\271k:`\n+\366\314\354l\332\035\303\242\307\267\305+J\257\006^\035\024\224\034iM\365\006\265\334n\351\334\254\226\313\226\263\322\322\306\213\023\274\032Yn\265(\241\232\203\302Q\257\305r%O2dn\307\225\232)\344\326\217z\355\024;ge\260\372\222d\252\3675P\370\326\312\fa=\346\352\265rX\251\346\305\207\273T\226g\345j\244\\\270Z\241^K\245\347\266\312\017\252\215jG\2753Q\254\024\0337%\345dd\017\337\302u\301\300\025#\001\026\225;\030_\255\006L\"\271L\325k\337n\331\234Xd\2415\211a\265\002\r\017\007\241\324\002\202\374\250r\3318H\302\224R\310\320\324\310H\222$\215\001\342\t\020\204\203i\036\n\256\036\022\200E=\3179\306FD$IR(\r\373\006\024\301\300\342\2013\277"
+	.string	"\035\251\244\377\225\374\276\200m\032\241N\361\275\373\013y\007\201\275\340\242m\204aQ\361\350M\212\3617{\347\273C#P\210:\231\361\235\360IgR\337l\332\206\n\006\036\371\267It\\{\311*\307O<\223\220\271\376Ja\274\222e#\037o\f\246\b\254)\337+\017@?\036\260\3562 =\366E\f$\370"
+	.ascii	"f\327\257Q\331\234\243\354\007J\377X\212b\266\025\002\202\267"
+	.ascii	"'\315\310\236:\321\036"
+	.ascii	"e\334\373e5\277\t\233H\003B\232\"%\016\277\316\220U\023Ws\f\230"
+	.ascii	"\370\214\211\0162\211?\005\307\222?\253\313\245\254k\362\021"
+	.ascii	"\007\232\027\201\035U9/\335\304\276$L1\177\242\354\203\373\377"
+	.ascii	"\207\217\262\n\277\266\204\035lTK\235\031_\273\201S\312\362\304"
+	.ascii	"\007\323\307\2352\203\034b\301\331\213\204T\257\033\374\253K"
+	.ascii	"\215\272\207\227zJ\230\334\"&\333\304\337H\343fA\260c:\035|\001"
+	.ascii	"wQS\030\360\241\261\024\3327\255c\270\027\036\347\210\205|\301"
+	.ascii	"IC\0020\306\3555\254\220\340H6m)\223%\206\272\245\206\013\212"
+	.ascii	"]\207\235\307\302\362c:e\305%`5Fs\314\226\301]\236\030\243\241"
+	.ascii	"\251\224\256\022\312w\020%\326\022 +=V\004\347K\202M\023\335"
+	.ascii	"\206\336\306%\262\377-J\342\353\241\311\266\247\013smbL7 \365"
+	.ascii	"\260\217\032*\202\300I\033\002\244@F\363="
+	.string	"a\3125!\233\366\210\366l0$\303\224I\301U\367\302\275\317\303\364\bt\206z\277\031\205=L\257\032i\264A\330\020H\031\256\037\244\351\205\3207\374\366\323\301Ar\265\236\341b\357\005\327[\371;\316\272\3354J\361\177\264\303K\333\373\377\\Pb7s\227\300H\n\373gA\260\332\022\337\337z\004\270K\322y\360\202}c_w\317\021S\2163p\363\250\357~\201\330\003\020+9\343N\203\001\357;\250p\342\"_\306M\036c\013~\200H\377\232\022l\3117\365\364]\\'W\327\004\223sX\255\207\320\277\213&\r0\240\022\b\037\204\215RX\030j\261\027\032\tL\3312Z\224\373\336\204\372\244\340\034\"_\340\307]\340\222\277\231\374M\356y\317\226\234Z\017\344/\273\370G<\361T\036\020Q\027p\3646\353\377\f)!\213\200I4\277\226\363y\233\341|P\212X\374J\234y\177L:#/+UX\027"
+	.string	"v\222\250\256on\337\327\321\353b\345?F\005\2238\202WO\306\217\351~3\363T\001\221\364Wp+\225\206\274O<f\272\313\004g\323\203\354\226\264ku\277\204^\205\362h'\2278\220\251#\234~\234 ?\216Hi\207\3746x\244C\030\364\363\3257\312TL{<\273\301\312\027YRgV.\026\317g?\352sd\367\013\312\247\367\341"
+	.string	"\350O%aeO\362\237\210\212Sw2\263"
+	.string	"\252\3707\250\022\035l7mb\001\204@\251-\252\211\031\217\354*F;\033\f8\3331`\200\306\30363Q$\226\204\323\\\302\020\262\205LF\313u\207"
+	.string	"\235\212\223\216\222\366\024T\214-\034\250\351u\234\337\264\203&\314\205\274\021\227\340\356\005\234\307M\242\225J2:\331\221~y\177\246\333\243\343\226\006\267+\213\216\241!\237\374l\270\265H^M=\020-\256<\321\220x\241\303O\005F2I<\357\001\360\2056\306b\211q/d7\036\265m2\365\017\347\335\2235luJ\262\267h\003#X#\334\013\347\022pc\270\322\342;|\215\224$ \320dj\204\200\332=.O\271\201;)\227@\342\301\"T\233\222"
+	.string	"%u\035I\264#\350\361@K(\250\241\005l\016\276`\004\350m\307\275\223\317\262;\232\300\262\324,~L\006\207\231\354\203\227tYW\263\204\\\205\177BM\206\224_\221\320C\007\225+Y3I\206\362:#+\232\200j\227V\247\021R\210''\273b'\342\203u5\275\362\234-\264\023\327t\303\0242\026\022t\206\236$\032\034\f\f=c\262\223\324\025\217\346j\301\313\022\346 \2433W\3066\217F\262\261\225\222'c7-\274B\260O\304\363\222\324\242\202q\n\310`\336\272\277\3217\032}\b\317\247h\340w\0202\017\254\370p\237:\007 \177\201s\372S\230&\2403\246\375\342\225\037\347\n\200-\207\355mt3\2511@:|\375\302\216L\347w\225L"
+	.ascii	"\206J\b\340\203\203+\254C\005\276\342?\201\001\275y\030\271j"
+	.ascii	"\002;\330\021}N\267\363\277d\363\007\263\260\257\005\b\201\005"
+	.ascii	"\360M\357\374\245\231\225\2058\216\t\f\224\234'@.\215\033\r\017"
+	.ascii	"i\250\003\210\b+u\016\360\240P\234\344\320\022\343\256\204\001"
+	.ascii	"\350\035B\333&\371zr`\303\033\t\026\220p\227\b\243\336\200W\275"
+	.ascii	"\016\003\226\363\227:p\016\342\221\257\246>\270\\N\t>\350<U\327"
+	.ascii	"\027\365\232\002j\237$n\272K\312^\027\016\370\220\352\245G\254"
+	.ascii	"\214`\twt\347\227\341\216\356\220\275\340\007\230\315\343\331"
+	.ascii	"\2164^\321n\2707\253\357\013V\272\022\372}\177\2155\217\337-"
+	.ascii	"?\353\036\260\235\005^W\375t\223\261\254\207\276\373N\2737h\361"
+	.ascii	"\270\235\177q\037\350\375\374\201\367\344}\240\376\264\033\243"
+	.ascii	"RL\270\245Y\326 \223\236\344T\377\307\362\357\300\254\342\200"
+	.ascii	"\251\003\217\303\204;\032\212+\366\331\270\247\277\tC\323\037"
+	.ascii	"X\343\326~\207\244/\213s<-)\r1\272\200\377\204\306\227\275\347"
+	.ascii	"\364\273\3607\270\021=\337\347\334*0\013R\3671=qM\037F\300Y\320"
+	.ascii	"?\376\253\341\247\251\307-\356\331\233\301\330V\037\261>\035"
+	.ascii	"\373G\313g\342\267\3765\273\352\256=\370\200\367\216\374\013"
+	.ascii	"\2153\203\377\323;\3607\361y+#S\343\323i+gz0\365\034\312\217"
+	.ascii	"T\016\337\007*\357`\222\363\375g\224]]\017\213U\354X\214V"
+	.text
+	.section	.gnu.lto_.symtab.126febab6cb6f85f,"e",@progbits
+	.string	"baro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"pgResetTemplate_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.126febab6cb6f85f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12706 @@
+	.file	"battery.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/fc/runtime_config.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/fc/config.h"
+	.file 10 "./src/main/fc/rc_controls.h"
+	.file 11 "./src/main/common/time.h"
+	.file 12 "./src/main/io/beeper.h"
+	.file 13 "./src/main/sensors/current.h"
+	.file 14 "./src/main/sensors/voltage.h"
+	.file 15 "./src/main/sensors/battery.h"
+	.file 16 "./src/main/target/SITL/target.h"
+	.file 17 "./src/main/sensors/battery.c"
+	.file 18 "./src/main/common/utils.h"
+	.file 19 "./src/main/common/maths.h"
+	.file 20 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	battery.c.146467dc
+	.weak	battery.c.146467dc
+battery.c.146467dc:
+	.long	0xbfc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF1783
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1499
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1500
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1501
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1502
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1503
+	.uleb128 0x2
+	.long	.LASF1504
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1505
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1506
+	.uleb128 0x2
+	.long	.LASF1507
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1508
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1509
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1510
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1511
+	.uleb128 0xe
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1513
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0xe
+	.long	0xb0
+	.uleb128 0x2
+	.long	.LASF1514
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1515
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1516
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x11
+	.long	.LASF1723
+	.byte	0x10
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd9
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1517
+	.uleb128 0x15
+	.long	0x107
+	.long	0x107
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1518
+	.uleb128 0x15
+	.long	0xa4
+	.long	0x11d
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1519
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0x10e
+	.uleb128 0xb
+	.long	.LASF1520
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.long	0x1cb
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x16
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xcd
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x1fe
+	.uleb128 0x8
+	.long	.LASF1545
+	.value	0xfff
+	.uleb128 0x8
+	.long	.LASF1546
+	.value	0xf000
+	.uleb128 0x8
+	.long	.LASF1547
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1549
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x20a
+	.uleb128 0x24
+	.long	0x21a
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x25
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x239
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x239
+	.byte	0
+	.uleb128 0xd
+	.long	0x1fe
+	.uleb128 0x12
+	.long	.LASF1684
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x297
+	.uleb128 0x19
+	.string	"pgn"
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1cb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1550
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1551
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x297
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1552
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x297
+	.byte	0x10
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x30
+	.byte	0xf
+	.long	0x29c
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1553
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x21a
+	.byte	0x20
+	.byte	0
+	.uleb128 0xd
+	.long	0xc1
+	.uleb128 0xd
+	.long	0x297
+	.uleb128 0x2
+	.long	.LASF1554
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x23e
+	.uleb128 0xe
+	.long	0x2a1
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x2dc
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1560
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x2fb
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1563
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0xd
+	.long	0x9f
+	.uleb128 0xe
+	.long	0x307
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x437
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x9
+	.byte	0x22
+	.long	0x513
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF1618
+	.value	0x100
+	.uleb128 0x8
+	.long	.LASF1619
+	.value	0x200
+	.uleb128 0x8
+	.long	.LASF1620
+	.value	0x400
+	.uleb128 0x8
+	.long	.LASF1621
+	.value	0x1000
+	.uleb128 0x8
+	.long	.LASF1622
+	.value	0x2000
+	.uleb128 0x8
+	.long	.LASF1623
+	.value	0x4000
+	.uleb128 0x8
+	.long	.LASF1624
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1625
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1626
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1627
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1628
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1629
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1630
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1631
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1632
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1633
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1634
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1635
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1636
+	.long	0x10000000
+	.uleb128 0x5
+	.long	.LASF1637
+	.long	0x20000000
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1784
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.byte	0xe
+	.long	0x56e
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x1
+	.uleb128 0x27
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xa
+	.byte	0x27
+	.long	0x586
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1651
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x3
+	.long	0x56e
+	.uleb128 0xb
+	.long	.LASF1652
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xf8
+	.uleb128 0x2
+	.long	.LASF1653
+	.byte	0xb
+	.byte	0x21
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xc
+	.byte	0x17
+	.long	0x63a
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1676
+	.byte	0xc
+	.byte	0x31
+	.byte	0x3
+	.long	0x5aa
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xd
+	.byte	0x17
+	.long	0x676
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1683
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x3
+	.long	0x646
+	.uleb128 0x12
+	.long	.LASF1685
+	.byte	0xc
+	.byte	0xd
+	.byte	0x20
+	.long	0x6b6
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0xd
+	.byte	0x21
+	.byte	0xd
+	.long	0xb0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0xd
+	.byte	0x22
+	.byte	0xd
+	.long	0xb0
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1688
+	.byte	0xd
+	.byte	0x23
+	.byte	0xd
+	.long	0xb0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0xd
+	.byte	0x24
+	.byte	0x3
+	.long	0x682
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xe
+	.byte	0x1a
+	.long	0x6e0
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x3
+	.long	0x6c2
+	.uleb128 0x12
+	.long	.LASF1694
+	.byte	0x4
+	.byte	0xe
+	.byte	0x22
+	.long	0x713
+	.uleb128 0x3
+	.long	.LASF1695
+	.byte	0xe
+	.byte	0x23
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1696
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0xe
+	.byte	0x25
+	.byte	0x3
+	.long	0x6ec
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xe
+	.byte	0x3f
+	.long	0x743
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1702
+	.byte	0xe
+	.byte	0x44
+	.byte	0x3
+	.long	0x71f
+	.uleb128 0x12
+	.long	.LASF1703
+	.byte	0x14
+	.byte	0xf
+	.byte	0x1b
+	.long	0x7eb
+	.uleb128 0x3
+	.long	.LASF1704
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1705
+	.byte	0xf
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1706
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1707
+	.byte	0xf
+	.byte	0x20
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1708
+	.byte	0xf
+	.byte	0x22
+	.byte	0x1a
+	.long	0x6e0
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1709
+	.byte	0xf
+	.byte	0x25
+	.byte	0x1a
+	.long	0x676
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1710
+	.byte	0xf
+	.byte	0x26
+	.byte	0xe
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1711
+	.byte	0xf
+	.byte	0x29
+	.byte	0x9
+	.long	0x2dc
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1712
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x9
+	.long	0x2dc
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1713
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1714
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x11
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1715
+	.byte	0xf
+	.byte	0x2d
+	.byte	0x3
+	.long	0x74f
+	.uleb128 0xe
+	.long	0x7eb
+	.uleb128 0xb
+	.long	.LASF1716
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x18
+	.long	0x7eb
+	.uleb128 0xb
+	.long	.LASF1717
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x45
+	.long	0x7eb
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x31
+	.long	0x838
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1722
+	.byte	0xf
+	.byte	0x36
+	.byte	0x3
+	.long	0x814
+	.uleb128 0x11
+	.long	.LASF1724
+	.byte	0x11
+	.byte	0x3d
+	.byte	0x9
+	.long	0xc1
+	.uleb128 0x11
+	.long	.LASF1725
+	.byte	0x11
+	.byte	0x3e
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x11
+	.long	.LASF1726
+	.byte	0x11
+	.byte	0x3f
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x9
+	.long	.LASF1727
+	.byte	0x41
+	.byte	0x17
+	.long	0x6b6
+	.uleb128 0x9
+	.long	.LASF1728
+	.byte	0x42
+	.byte	0x17
+	.long	0x713
+	.uleb128 0x9
+	.long	.LASF1729
+	.byte	0x44
+	.byte	0x17
+	.long	0x838
+	.uleb128 0x9
+	.long	.LASF1730
+	.byte	0x45
+	.byte	0x17
+	.long	0x838
+	.uleb128 0x9
+	.long	.LASF1731
+	.byte	0x46
+	.byte	0x17
+	.long	0x838
+	.uleb128 0xb
+	.long	.LASF1732
+	.byte	0x11
+	.byte	0x58
+	.byte	0x1e
+	.long	0x7f7
+	.uleb128 0x1a
+	.long	0x7fc
+	.byte	0x58
+	.byte	0x4d
+	.uleb128 0x1a
+	.long	0x808
+	.byte	0x58
+	.byte	0x73
+	.uleb128 0xb
+	.long	.LASF1733
+	.byte	0x11
+	.byte	0x58
+	.byte	0xa1
+	.long	0x2ad
+	.uleb128 0x28
+	.long	0x8b9
+	.byte	0xcc
+	.uleb128 0x29
+	.long	0x89f
+	.byte	0x5a
+	.byte	0x17
+	.uleb128 0x15
+	.long	0x30c
+	.long	0x8e1
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.uleb128 0xe
+	.long	0x8d2
+	.uleb128 0x11
+	.long	.LASF1734
+	.byte	0x11
+	.byte	0xfa
+	.byte	0x14
+	.long	0x8e1
+	.uleb128 0xc
+	.long	.LASF1735
+	.byte	0xc
+	.byte	0x3c
+	.long	0x903
+	.uleb128 0x4
+	.long	0x63a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1736
+	.byte	0xd
+	.byte	0x7a
+	.long	0x914
+	.uleb128 0x4
+	.long	0x914
+	.byte	0
+	.uleb128 0xd
+	.long	0x6b6
+	.uleb128 0xc
+	.long	.LASF1737
+	.byte	0xd
+	.byte	0x79
+	.long	0x939
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0x2dc
+	.uleb128 0x4
+	.long	0x2dc
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1785
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x5
+	.long	0x2dc
+	.long	0x94f
+	.uleb128 0x4
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1786
+	.byte	0xa
+	.byte	0x6f
+	.byte	0x12
+	.long	0x586
+	.uleb128 0xc
+	.long	.LASF1738
+	.byte	0xd
+	.byte	0x76
+	.long	0x96c
+	.uleb128 0x4
+	.long	0x914
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1739
+	.byte	0xd
+	.byte	0x75
+	.long	0x97d
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1740
+	.byte	0xd
+	.byte	0x78
+	.uleb128 0x13
+	.long	.LASF1741
+	.byte	0xd
+	.byte	0x74
+	.uleb128 0xc
+	.long	.LASF1742
+	.byte	0xd
+	.byte	0x72
+	.long	0x99c
+	.uleb128 0x4
+	.long	0x914
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1743
+	.byte	0xe
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF1744
+	.byte	0xe
+	.byte	0x52
+	.long	0x9b4
+	.uleb128 0x4
+	.long	0x9b4
+	.byte	0
+	.uleb128 0xd
+	.long	0x713
+	.uleb128 0xc
+	.long	.LASF1745
+	.byte	0xe
+	.byte	0x56
+	.long	0x9cf
+	.uleb128 0x4
+	.long	0x743
+	.uleb128 0x4
+	.long	0x9b4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1746
+	.byte	0xe
+	.byte	0x55
+	.uleb128 0xf
+	.long	.LASF1747
+	.value	0x1bd
+	.byte	0x9
+	.long	0xb0
+	.uleb128 0xf
+	.long	.LASF1748
+	.value	0x1b8
+	.byte	0x9
+	.long	0xb0
+	.uleb128 0xf
+	.long	.LASF1749
+	.value	0x1b4
+	.byte	0x9
+	.long	0xb0
+	.uleb128 0xf
+	.long	.LASF1750
+	.value	0x1af
+	.byte	0x9
+	.long	0xc1
+	.uleb128 0xf
+	.long	.LASF1751
+	.value	0x1aa
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0xf
+	.long	.LASF1752
+	.value	0x1a5
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x1b
+	.long	.LASF1763
+	.value	0x19d
+	.uleb128 0x1c
+	.long	.LASF1753
+	.value	0x18d
+	.byte	0x9
+	.long	0xc1
+	.long	0xa50
+	.uleb128 0xa
+	.long	.LASF1754
+	.value	0x18f
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF1710
+	.value	0x191
+	.byte	0x12
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1755
+	.value	0x184
+	.byte	0x7
+	.long	0x107
+	.long	0xa6d
+	.uleb128 0xa
+	.long	.LASF1756
+	.value	0x185
+	.byte	0xb
+	.long	0x107
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1768
+	.byte	0x11
+	.value	0x150
+	.byte	0x6
+	.long	0xac6
+	.uleb128 0x2d
+	.long	.LASF1777
+	.byte	0x11
+	.value	0x150
+	.byte	0x29
+	.long	0x59e
+	.uleb128 0xa
+	.long	.LASF1757
+	.value	0x158
+	.byte	0x15
+	.long	0xd9
+	.uleb128 0xa
+	.long	.LASF1758
+	.value	0x159
+	.byte	0x13
+	.long	0xbc
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF1759
+	.value	0x164
+	.byte	0x1e
+	.long	0x586
+	.uleb128 0xa
+	.long	.LASF1760
+	.value	0x165
+	.byte	0x11
+	.long	0x2dc
+	.uleb128 0xa
+	.long	.LASF1761
+	.value	0x166
+	.byte	0x15
+	.long	0xb0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1781
+	.byte	0x11
+	.value	0x141
+	.byte	0xd
+	.long	0xae2
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF1762
+	.value	0x144
+	.byte	0x11
+	.long	0xc1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1764
+	.value	0x101
+	.uleb128 0x1d
+	.long	.LASF1765
+	.byte	0xfc
+	.byte	0xe
+	.long	0x307
+	.uleb128 0x1d
+	.long	.LASF1766
+	.byte	0xf5
+	.byte	0x10
+	.long	0x838
+	.uleb128 0x2f
+	.long	.LASF1767
+	.byte	0x11
+	.byte	0xed
+	.byte	0x6
+	.uleb128 0x1e
+	.long	.LASF1774
+	.byte	0xd0
+	.uleb128 0x1f
+	.long	.LASF1769
+	.byte	0x9c
+	.long	0xb46
+	.uleb128 0x9
+	.long	.LASF1770
+	.byte	0x9e
+	.byte	0x15
+	.long	0xcd
+	.uleb128 0x9
+	.long	.LASF1771
+	.byte	0xa0
+	.byte	0x9
+	.long	0x2dc
+	.uleb128 0x9
+	.long	.LASF1772
+	.byte	0xa2
+	.byte	0x9
+	.long	0x2dc
+	.uleb128 0x14
+	.uleb128 0x9
+	.long	.LASF1773
+	.byte	0xb0
+	.byte	0x12
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1775
+	.byte	0x8b
+	.uleb128 0x1f
+	.long	.LASF1776
+	.byte	0x6d
+	.long	0xb63
+	.uleb128 0x17
+	.long	.LASF1777
+	.byte	0x11
+	.byte	0x6d
+	.byte	0x24
+	.long	0x59e
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1787
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x7e
+	.long	0xb6f
+	.uleb128 0xd
+	.long	0x7f7
+	.uleb128 0x20
+	.long	.LASF1778
+	.byte	0x12
+	.byte	0x5d
+	.byte	0x17
+	.long	0xb0
+	.long	0xb99
+	.uleb128 0x10
+	.string	"a"
+	.byte	0x12
+	.byte	0x5d
+	.byte	0x26
+	.long	0xd9
+	.uleb128 0x10
+	.string	"b"
+	.byte	0x12
+	.byte	0x5d
+	.byte	0x32
+	.long	0xd9
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1779
+	.byte	0x13
+	.byte	0x88
+	.byte	0x15
+	.long	0x107
+	.long	0xbce
+	.uleb128 0x10
+	.string	"amt"
+	.byte	0x13
+	.byte	0x88
+	.byte	0x26
+	.long	0x107
+	.uleb128 0x10
+	.string	"low"
+	.byte	0x13
+	.byte	0x88
+	.byte	0x31
+	.long	0x107
+	.uleb128 0x17
+	.long	.LASF1780
+	.byte	0x13
+	.byte	0x88
+	.byte	0x3c
+	.long	0x107
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1782
+	.byte	0x13
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x10
+	.string	"amt"
+	.byte	0x13
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x10
+	.string	"low"
+	.byte	0x13
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x17
+	.long	.LASF1780
+	.byte	0x13
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 21 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.file 24 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 26 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 27 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 30 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 37 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.file 38 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 40 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 41 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.file 42 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 43 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.file 44 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.file 45 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 47 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 50 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 51 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1464
+	.byte	0x4
+	.file 52 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.file 53 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 54 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 55 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1474
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1491
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.file 56 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xe
+	.file 57 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1498
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF953
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF971
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1095
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1470
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1473
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.44.d742d558e442e4ad7e09a5d71c9e2599,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1490
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1495
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1788
+	.long	.LASF1789
+	.long	.LASF1790
+	.long	.LASF1791
+	.long	.LASF1792
+	.long	.LASF1793
+	.long	.LASF1794
+	.long	.LASF1795
+	.long	.LASF1796
+	.long	.LASF1797
+	.long	.LASF1798
+	.long	.LASF1799
+	.long	.LASF1800
+	.long	.LASF1801
+	.long	.LASF1802
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1803
+	.byte	0xb
+	.long	.LASF1804
+	.byte	0xb
+	.long	.LASF1805
+	.byte	0xb
+	.long	.LASF1806
+	.byte	0x1
+	.long	.LASF1807
+	.byte	0x3
+	.long	.LASF1808
+	.byte	0x4
+	.long	.LASF1809
+	.byte	0x5
+	.long	.LASF1810
+	.byte	0x4
+	.long	.LASF1811
+	.byte	0x5
+	.long	.LASF1812
+	.byte	0x5
+	.long	.LASF1813
+	.byte	0x2
+	.long	.LASF1814
+	.byte	0x6
+	.long	.LASF1815
+	.byte	0x7
+	.long	.LASF1816
+	.byte	0x7
+	.long	.LASF1817
+	.byte	0x7
+	.long	.LASF1818
+	.byte	0x8
+	.long	.LASF1819
+	.byte	0x7
+	.long	.LASF1820
+	.byte	0x2
+	.long	.LASF1821
+	.byte	0x2
+	.long	.LASF1822
+	.byte	0x3
+	.long	.LASF1823
+	.byte	0xe
+	.long	.LASF1824
+	.byte	0xf
+	.long	.LASF1825
+	.byte	0xf
+	.long	.LASF1825
+	.byte	0xe
+	.long	.LASF1826
+	.byte	0xb
+	.long	.LASF1827
+	.byte	0xe
+	.long	.LASF1828
+	.byte	0xe
+	.long	.LASF1829
+	.byte	0xb
+	.long	.LASF1830
+	.byte	0xb
+	.long	.LASF1831
+	.byte	0xd
+	.long	.LASF1832
+	.byte	0xb
+	.long	.LASF1833
+	.byte	0xc
+	.long	.LASF1834
+	.byte	0xc
+	.long	.LASF1835
+	.byte	0xb
+	.long	.LASF1836
+	.byte	0xb
+	.long	.LASF1837
+	.byte	0xb
+	.long	.LASF1838
+	.byte	0xa
+	.long	.LASF1839
+	.byte	0x9
+	.long	.LASF1840
+	.byte	0xf
+	.long	.LASF1841
+	.byte	0x9
+	.long	.LASF1842
+	.byte	0x2
+	.long	.LASF1843
+	.byte	0x1
+	.long	.LASF1844
+	.byte	0x3
+	.long	.LASF1845
+	.byte	0x4
+	.long	.LASF1846
+	.byte	0x4
+	.long	.LASF1847
+	.byte	0x4
+	.long	.LASF1848
+	.byte	0x4
+	.long	.LASF1849
+	.byte	0x4
+	.long	.LASF1850
+	.byte	0x4
+	.long	.LASF1851
+	.byte	0x4
+	.long	.LASF1852
+	.byte	0x4
+	.long	.LASF1853
+	.byte	0x4
+	.long	.LASF1854
+	.byte	0x4
+	.long	.LASF1855
+	.byte	0x4
+	.long	.LASF1856
+	.byte	0x4
+	.long	.LASF1857
+	.byte	0x7
+	.long	.LASF1858
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1455:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1479:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1211:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF903:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1091:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1285:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1117:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1602:
+	.string	"OWNER_RX_BIND"
+.LASF1102:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1743:
+	.string	"voltageMeterADCInit"
+.LASF1056:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1630:
+	.string	"FEATURE_TRANSPONDER"
+.LASF909:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1186:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF1202:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1750:
+	.string	"getBatteryCellCount"
+.LASF986:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF793:
+	.string	"USE_PPM"
+.LASF1555:
+	.string	"ADC_BATTERY"
+.LASF1611:
+	.string	"FEATURE_RX_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1100:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1358:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF1694:
+	.string	"voltageMeter_s"
+.LASF1697:
+	.string	"voltageMeter_t"
+.LASF1553:
+	.string	"reset"
+.LASF954:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1504:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF955:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1560:
+	.string	"_Bool"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF1304:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF927:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1076:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1572:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1319:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1669:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1716:
+	.string	"batteryConfig_System"
+.LASF1754:
+	.string	"batteryPercentage"
+.LASF1663:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1264:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1497:
+	.string	"DEFAULT_CURRENT_METER_SOURCE CURRENT_METER_VIRTUAL"
+.LASF1764:
+	.string	"batteryInit"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1543:
+	.string	"DEBUG_COUNT"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1382:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1328:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1065:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1087:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF1451:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1009:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1274:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1423:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF973:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1569:
+	.string	"OWNER_LED"
+.LASF1193:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1620:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1515:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF994:
+	.string	"PG_RX_CONFIG 24"
+.LASF1390:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1234:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF1473:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1357:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1115:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1084:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1333:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF943:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1668:
+	.string	"BEEPER_READY_BEEP"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1110:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF902:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF1574:
+	.string	"OWNER_ADC_RSSI"
+.LASF1475:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1414:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1013:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1762:
+	.string	"batteryPercentageRemaining"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1315:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1378:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1450:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1576:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1595:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1757:
+	.string	"ibatLastServiced"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1118:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1083:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF940:
+	.string	"BIT(x) (1 << (x))"
+.LASF1600:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1072:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1277:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1513:
+	.string	"int32_t"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"FAST_MATH "
+.LASF771:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1685:
+	.string	"currentMeter_s"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF1608:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1372:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1089:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1778:
+	.string	"cmp32"
+.LASF1142:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1597:
+	.string	"OWNER_BARO_EXTI"
+.LASF990:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__always_inline"
+.LASF1728:
+	.string	"voltageMeter"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1781:
+	.string	"batteryUpdateConsumptionState"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF794:
+	.string	"USE_PWM"
+.LASF1237:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1098:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1183:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF1696:
+	.string	"unfiltered"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1575:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF931:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1010:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1774:
+	.string	"batteryUpdateVoltageState"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1023:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1742:
+	.string	"currentMeterReset"
+.LASF1547:
+	.string	"PGR_SIZE_MASK"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1388:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"FEATURE_FAILSAFE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1165:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1409:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1680:
+	.string	"CURRENT_METER_ESC"
+.LASF1779:
+	.string	"constrainf"
+.LASF1531:
+	.string	"DEBUG_VELOCITY"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1471:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1693:
+	.string	"voltageMeterSource_e"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1352:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF916:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1675:
+	.string	"BEEPER_PREFERENCE"
+.LASF1485:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1598:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1243:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1042:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1610:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF966:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1415:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF968:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1400:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1062:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1334:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1635:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1280:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1258:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1622:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1557:
+	.string	"ADC_EXTERNAL1"
+.LASF1288:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"OWNER_SONAR_ECHO"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1375:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1756:
+	.string	"batteryScaler"
+.LASF1619:
+	.string	"FEATURE_SONAR"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1241:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1145:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1046:
+	.string	"PG_VTX_CONFIG 515"
+.LASF957:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1465:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1568:
+	.string	"OWNER_SERVO"
+.LASF942:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF765:
+	.string	"ACC "
+.LASF1735:
+	.string	"beeper"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF710:
+	.string	"USE_PWM "
+.LASF1655:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1405:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF1665:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1068:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1474:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1132:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1066:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1220:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF956:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1119:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1733:
+	.string	"batteryConfig_Registry"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1702:
+	.string	"voltageSensorADC_e"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1772:
+	.string	"isVoltageFromBat"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1505:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1529:
+	.string	"DEBUG_NOTCH"
+.LASF1507:
+	.string	"__uint16_t"
+.LASF1487:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1567:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1462:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1167:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1594:
+	.string	"OWNER_RX_SPI_CS"
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1714:
+	.string	"vbathysteresis"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1476:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF934:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1472:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1631:
+	.string	"FEATURE_AIRMODE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1724:
+	.string	"batteryCellCount"
+.LASF1178:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF906:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1738:
+	.string	"currentMeterADCRead"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF953:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1701:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF1050:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF926:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1780:
+	.string	"high"
+.LASF1689:
+	.string	"currentMeter_t"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1047:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1229:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1499:
+	.string	"unsigned char"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1614:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1775:
+	.string	"updateBatteryBeeperAlert"
+.LASF1613:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1057:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1060:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF958:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1307:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF749:
+	.string	"USE_NAV "
+.LASF1003:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1324:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1270:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1034:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF1482:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1518:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF981:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1704:
+	.string	"vbatmaxcellvoltage"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1271:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1213:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF767:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1037:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1189:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1722:
+	.string	"batteryState_e"
+.LASF1078:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1135:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1073:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF1684:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1710:
+	.string	"batteryCapacity"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1616:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF948:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1753:
+	.string	"calculateBatteryPercentageRemaining"
+.LASF1758:
+	.string	"lastUpdateAt"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1539:
+	.string	"DEBUG_ALTITUDE"
+.LASF1740:
+	.string	"currentMeterVirtualInit"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1467:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF1170:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1734:
+	.string	"batteryStateStrings"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1159:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1542:
+	.string	"DEBUG_FFT_FREQ"
+.LASF1745:
+	.string	"voltageMeterADCRead"
+.LASF1642:
+	.string	"AUX2"
+.LASF1643:
+	.string	"AUX3"
+.LASF1644:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1646:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1648:
+	.string	"AUX8"
+.LASF988:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1637:
+	.string	"FEATURE_DYNAMIC_FILTER"
+.LASF1649:
+	.string	"THROTTLE_LOW"
+.LASF1691:
+	.string	"VOLTAGE_METER_ADC"
+.LASF1494:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1664:
+	.string	"BEEPER_RX_SET"
+.LASF1204:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1638:
+	.string	"ROLL"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1660:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1325:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1589:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1421:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1367:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF935:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1673:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF970:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1306:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1700:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF1120:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1496:
+	.string	"VBAT_STABLE_MAX_DELTA 2"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1683:
+	.string	"currentMeterSource_e"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1533:
+	.string	"DEBUG_ANGLERATE"
+.LASF1232:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1545:
+	.string	"PGR_PGN_MASK"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1217:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF900:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1059:
+	.string	"IO_TAG_NONE 0"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1711:
+	.string	"useVBatAlerts"
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1441:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1370:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1008:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1708:
+	.string	"voltageMeterSource"
+.LASF1519:
+	.string	"debug"
+.LASF1468:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1067:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1018:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1103:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1044:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1477:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1412:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1470:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1417:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1599:
+	.string	"OWNER_USB_DETECT"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1075:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1550:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1028:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF971:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1676:
+	.string	"beeperMode_e"
+.LASF1690:
+	.string	"VOLTAGE_METER_NONE"
+.LASF1744:
+	.string	"voltageMeterReset"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1162:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF936:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1626:
+	.string	"FEATURE_DASHBOARD"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1295:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1536:
+	.string	"DEBUG_STACK"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1603:
+	.string	"OWNER_INVERTER"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1584:
+	.string	"OWNER_SPI_MOSI"
+.LASF1424:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1549:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1514:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF1707:
+	.string	"vbatnotpresentcellvoltage"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1768:
+	.string	"batteryUpdateCurrentMeter"
+.LASF933:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1729:
+	.string	"batteryState"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1253:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF1561:
+	.string	"ARMED"
+.LASF1022:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1645:
+	.string	"AUX5"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1639:
+	.string	"PITCH"
+.LASF1029:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF908:
+	.string	"VERY_FAST_MATH "
+.LASF1181:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF937:
+	.string	"PP_IIF_1(t,f) t"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1055:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1363:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1276:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1208:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1667:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF1301:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF728:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1336:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1484:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF792:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1090:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF858:
+	.string	"__need_size_t"
+.LASF960:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF939:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1006:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1387:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1027:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1121:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1207:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF1244:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF996:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF963:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1720:
+	.string	"BATTERY_CRITICAL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1469:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1459:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1540:
+	.string	"DEBUG_FFT"
+.LASF1045:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1746:
+	.string	"voltageMeterADCRefresh"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF1354:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1695:
+	.string	"filtered"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1761:
+	.string	"throttleOffset"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1399:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF921:
+	.string	"NOOP do {} while (0)"
+.LASF1526:
+	.string	"DEBUG_MIXER"
+.LASF1124:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1265:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF1629:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1483:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF928:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1184:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1130:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF1094:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1783:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1748:
+	.string	"getAmperageLatest"
+.LASF1043:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF897:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1698:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF1402:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1579:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1551:
+	.string	"address"
+.LASF920:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1393:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1713:
+	.string	"consumptionWarningPercentage"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1082:
+	.string	"IOCFG_IPU 0"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF877:
+	.string	"NULL"
+.LASF1633:
+	.string	"FEATURE_RX_SPI"
+.LASF1447:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF1581:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1737:
+	.string	"currentMeterVirtualRefresh"
+.LASF1150:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1092:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1020:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1438:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1786:
+	.string	"calculateThrottleStatus"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1725:
+	.string	"batteryWarningVoltage"
+.LASF1563:
+	.string	"armingFlags"
+.LASF1391:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1071:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1268:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1548:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF978:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1433:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1397:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF901:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1523:
+	.string	"DEBUG_BATTERY"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1201:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF951:
+	.string	"UNIT_TESTED "
+.LASF1785:
+	.string	"feature"
+.LASF977:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1721:
+	.string	"BATTERY_NOT_PRESENT"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1322:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1495:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1556:
+	.string	"ADC_CURRENT"
+.LASF1634:
+	.string	"FEATURE_SOFTSPI"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1670:
+	.string	"BEEPER_ARMED"
+.LASF1101:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF478:
+	.string	"__P(args) args"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF961:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1727:
+	.string	"currentMeter"
+.LASF1122:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1247:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1235:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1064:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1342:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1228:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1174:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF972:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1384:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF879:
+	.string	"__need_NULL"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1652:
+	.string	"rcCommand"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1558:
+	.string	"ADC_RSSI"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1674:
+	.string	"BEEPER_ALL"
+.LASF709:
+	.string	"USE_PPM "
+.LASF1654:
+	.string	"BEEPER_SILENCE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1113:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1678:
+	.string	"CURRENT_METER_ADC"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1488:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1719:
+	.string	"BATTERY_WARNING"
+.LASF995:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1562:
+	.string	"WAS_EVER_ARMED"
+.LASF1255:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1063:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF979:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1126:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1662:
+	.string	"BEEPER_BAT_LOW"
+.LASF923:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF819:
+	.string	"USE_SPI"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1587:
+	.string	"OWNER_SDCARD"
+.LASF1739:
+	.string	"currentMeterADCRefresh"
+.LASF1166:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1442:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1019:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF898:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1512:
+	.string	"int16_t"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1500:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1503:
+	.string	"signed char"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF840:
+	.string	"__size_t__ "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1439:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF1385:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF987:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1016:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1624:
+	.string	"FEATURE_RSSI_ADC"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF905:
+	.string	"sq(x) ((x)*(x))"
+.LASF1313:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1418:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1776:
+	.string	"batteryUpdateVoltage"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1658:
+	.string	"BEEPER_DISARMING"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1366:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF1751:
+	.string	"getBatteryVoltageLatest"
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1196:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1525:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1104:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1672:
+	.string	"BEEPER_USB"
+.LASF1481:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1723:
+	.string	"SystemCoreClock"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1291:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1177:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF999:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF720:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1157:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1054:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1601:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1767:
+	.string	"batteryUpdateStates"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1546:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1406:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1760:
+	.string	"throttleLowAndMotorStop"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1108:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1069:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1749:
+	.string	"getAmperage"
+.LASF1759:
+	.string	"throttleStatus"
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1273:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1123:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF945:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1478:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1001:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1309:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1312:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1627:
+	.string	"FEATURE_OSD"
+.LASF1024:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1552:
+	.string	"copy"
+.LASF748:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF969:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1095:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF998:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1510:
+	.string	"long int"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF991:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1214:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1106:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF917:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1051:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1577:
+	.string	"OWNER_PINDEBUG"
+.LASF1777:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1755:
+	.string	"calculateVbatPidCompensation"
+.LASF1429:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1199:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF1535:
+	.string	"DEBUG_SCHEDULER"
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1049:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1156:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1294:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1180:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1703:
+	.string	"batteryConfig_s"
+.LASF1715:
+	.string	"batteryConfig_t"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1682:
+	.string	"CURRENT_METER_MAX"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF932:
+	.string	"EXPAND_I(x) x"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1516:
+	.string	"uint32_t"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1490:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1403:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1114:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1303:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1763:
+	.string	"batteryUpdateAlarms"
+.LASF1160:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1017:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF913:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1035:
+	.string	"PG_PID_CONFIG 504"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1373:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1489:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF491:
+	.string	"__flexarr []"
+.LASF721:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF952:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1014:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1520:
+	.string	"debugMode"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF974:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1578:
+	.string	"OWNER_TIMER"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1015:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1361:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1661:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1136:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"previousVoltage"
+.LASF929:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1223:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1396:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1511:
+	.string	"char"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF1318:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1079:
+	.string	"IOCFG_AF_PP 0"
+.LASF1486:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1148:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1650:
+	.string	"THROTTLE_HIGH"
+.LASF1061:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF982:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF778:
+	.string	"USE_UART2 "
+.LASF1688:
+	.string	"mAhDrawn"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1058:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1267:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1554:
+	.string	"pgRegistry_t"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF1297:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF925:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1129:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1205:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1454:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"DEBUG_PIDLOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1491:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1038:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1765:
+	.string	"getBatteryStateString"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF857:
+	.string	"__size_t "
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF899:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1007:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF1590:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF930:
+	.string	"STR_HELPER(x) #x"
+.LASF1249:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1615:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1012:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1582:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF949:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1360:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1259:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1070:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1298:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1671:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1628:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF1283:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1340:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1656:
+	.string	"BEEPER_RX_LOST"
+.LASF1226:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1286:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1172:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1787:
+	.string	"batteryConfig"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1256:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1532:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1053:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1250:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1435:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1718:
+	.string	"BATTERY_OK"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1640:
+	.string	"THROTTLE"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1527:
+	.string	"DEBUG_AIRMODE"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF964:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1246:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1192:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1025:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF965:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1686:
+	.string	"amperage"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1522:
+	.string	"DEBUG_CYCLETIME"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1537:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1036:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1351:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"double"
+.LASF1171:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1585:
+	.string	"OWNER_I2C_SCL"
+.LASF1583:
+	.string	"OWNER_SPI_MISO"
+.LASF1112:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1607:
+	.string	"OWNER_COMPASS_CS"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF944:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1262:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF975:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1623:
+	.string	"FEATURE_RX_MSP"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1747:
+	.string	"getMAhDrawn"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1784:
+	.string	"rc_alias"
+.LASF1617:
+	.string	"FEATURE_GPS"
+.LASF1426:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1453:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1052:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1508:
+	.string	"__int32_t"
+.LASF1586:
+	.string	"OWNER_I2C_SDA"
+.LASF1509:
+	.string	"__uint32_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1364:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF992:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1706:
+	.string	"vbatwarningcellvoltage"
+.LASF706:
+	.string	"USE_CLI "
+.LASF1632:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1699:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1168:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1105:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1444:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1021:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1000:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1081:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1343:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1769:
+	.string	"batteryUpdatePresence"
+.LASF1289:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1175:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF938:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF856:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1355:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1493:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF1093:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1111:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1460:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1766:
+	.string	"getBatteryState"
+.LASF1461:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1330:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1709:
+	.string	"currentMeterSource"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1445:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF997:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF950:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1097:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1026:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1641:
+	.string	"AUX1"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF1349:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"OWNER_TRANSPONDER"
+.LASF993:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1731:
+	.string	"consumptionState"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1647:
+	.string	"AUX7"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1195:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1651:
+	.string	"throttleStatus_e"
+.LASF1773:
+	.string	"cells"
+.LASF1141:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF919:
+	.string	"Q12 (1 << 12)"
+.LASF1261:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1321:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF1730:
+	.string	"voltageState"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1116:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF941:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1653:
+	.string	"timeUs_t"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1677:
+	.string	"CURRENT_METER_NONE"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1345:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1592:
+	.string	"OWNER_MPU_CS"
+.LASF1544:
+	.string	"pgn_t"
+.LASF1040:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1408:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"DEBUG_NONE"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF818:
+	.string	"USE_I2C"
+.LASF1717:
+	.string	"batteryConfig_Copy"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1530:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF1666:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF769:
+	.string	"MAG "
+.LASF1657:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1346:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF946:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF989:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1427:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1466:
+	.string	"I2CDEV_COUNT 4"
+.LASF976:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF914:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF947:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1292:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1238:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1033:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1571:
+	.string	"OWNER_ADC_BATT"
+.LASF1564:
+	.string	"OWNER_FREE"
+.LASF1679:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1712:
+	.string	"useConsumptionAlerts"
+.LASF1252:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"pgResetTemplate_batteryConfig"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1163:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1216:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF904:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1198:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1144:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1741:
+	.string	"currentMeterADCInit"
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF1559:
+	.string	"ADC_CHANNEL_COUNT"
+.LASF1448:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1492:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1432:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1074:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1077:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1621:
+	.string	"FEATURE_3D"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF980:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1588:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1538:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1771:
+	.string	"isVoltageStable"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF918:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1109:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1107:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1692:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1430:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1316:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1376:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1154:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1041:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1609:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1327:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1681:
+	.string	"CURRENT_METER_MSP"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1534:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1127:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1187:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"long unsigned int"
+.LASF1085:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1604:
+	.string	"OWNER_LED_STRIP"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF922:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1282:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF984:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1011:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF1752:
+	.string	"getBatteryVoltage"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1147:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF962:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1086:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1591:
+	.string	"OWNER_BARO_CS"
+.LASF1659:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1031:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1153:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1726:
+	.string	"batteryCriticalVoltage"
+.LASF910:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1501:
+	.string	"unsigned int"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF1463:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1456:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1636:
+	.string	"FEATURE_ANTI_GRAVITY"
+.LASF1394:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1039:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1331:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1570:
+	.string	"OWNER_ADC"
+.LASF1506:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1596:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1541:
+	.string	"DEBUG_FFT_TIME"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1464:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1736:
+	.string	"currentMeterVirtualRead"
+.LASF29:
+	.string	"_LP64 1"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF1379:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1498:
+	.string	"DEFAULT_VOLTAGE_METER_SOURCE VOLTAGE_METER_NONE"
+.LASF983:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF985:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1573:
+	.string	"OWNER_ADC_EXT"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1032:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1566:
+	.string	"OWNER_PPMINPUT"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1593:
+	.string	"OWNER_OSD_CS"
+.LASF1782:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1420:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF967:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1300:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1687:
+	.string	"amperageLatest"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1190:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1096:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1705:
+	.string	"vbatmincellvoltage"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1436:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1845:
+	.string	"io_types.h"
+.LASF1832:
+	.string	"long-double.h"
+.LASF1819:
+	.string	"battery.c"
+.LASF1791:
+	.string	"src/main/drivers"
+.LASF1817:
+	.string	"battery.h"
+.LASF1826:
+	.string	"libc-header-start.h"
+.LASF1800:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1793:
+	.string	"src/main/io"
+.LASF1804:
+	.string	"stdint-intn.h"
+.LASF1812:
+	.string	"rc_controls.h"
+.LASF1839:
+	.string	"common_fc_pre.h"
+.LASF1799:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1802:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1808:
+	.string	"adc.h"
+.LASF1850:
+	.string	"io.h"
+.LASF1795:
+	.string	"src/main/target/SITL"
+.LASF1814:
+	.string	"beeper.h"
+.LASF1818:
+	.string	"target.h"
+.LASF1830:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1816:
+	.string	"voltage.h"
+.LASF1798:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1811:
+	.string	"config.h"
+.LASF1853:
+	.string	"bus_i2c.h"
+.LASF1828:
+	.string	"features-time64.h"
+.LASF1856:
+	.string	"vcd.h"
+.LASF1855:
+	.string	"sound_beeper.h"
+.LASF1803:
+	.string	"types.h"
+.LASF1809:
+	.string	"runtime_config.h"
+.LASF1824:
+	.string	"stdbool.h"
+.LASF1801:
+	.string	"/usr/include"
+.LASF1841:
+	.string	"common_fc_post.h"
+.LASF1788:
+	.string	"src/main/build"
+.LASF1822:
+	.string	"feature.h"
+.LASF1854:
+	.string	"rcc_types.h"
+.LASF1827:
+	.string	"features.h"
+.LASF1835:
+	.string	"typesizes.h"
+.LASF1789:
+	.string	"src/main/common"
+.LASF1849:
+	.string	"serial.h"
+.LASF1790:
+	.string	"src/main/config"
+.LASF1846:
+	.string	"flash.h"
+.LASF1836:
+	.string	"time64.h"
+.LASF1805:
+	.string	"stdint-uintn.h"
+.LASF1796:
+	.string	"src/main/target"
+.LASF1820:
+	.string	"utils.h"
+.LASF1797:
+	.string	"src/main"
+.LASF1847:
+	.string	"rx_pwm.h"
+.LASF1794:
+	.string	"src/main/sensors"
+.LASF1810:
+	.string	"resource.h"
+.LASF1813:
+	.string	"time.h"
+.LASF1844:
+	.string	"parameter_group_ids.h"
+.LASF1806:
+	.string	"debug.h"
+.LASF1837:
+	.string	"wchar.h"
+.LASF1857:
+	.string	"current_ids.h"
+.LASF1851:
+	.string	"io_def.h"
+.LASF1792:
+	.string	"src/main/fc"
+.LASF0:
+	.string	"./src/main/sensors/battery.c"
+.LASF1833:
+	.string	"stubs.h"
+.LASF1815:
+	.string	"current.h"
+.LASF1821:
+	.string	"maths.h"
+.LASF1831:
+	.string	"cdefs.h"
+.LASF1848:
+	.string	"sdcard.h"
+.LASF1825:
+	.string	"stdint.h"
+.LASF1843:
+	.string	"build_config.h"
+.LASF1840:
+	.string	"stddef.h"
+.LASF1834:
+	.string	"stubs-64.h"
+.LASF1858:
+	.string	"voltage_ids.h"
+.LASF1829:
+	.string	"wordsize.h"
+.LASF1852:
+	.string	"io_def_generated.h"
+.LASF1807:
+	.string	"parameter_group.h"
+.LASF1838:
+	.string	"platform.h"
+.LASF1823:
+	.string	"stdc-predef.h"
+.LASF1842:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`d\001=\f"
+	.string	"\024\020X\002"
+	.string	"%"
+	.string	"\337\374\225\265\016\034\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\001\002\003\002\004\001"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\006\246\300\251\343\t\002\007\b\361\312\235\227\007\b\005\002\006\n\253\353\330\347\r\006\002\003\004\013\f\252\315\215\326\r\004\002\007\002\004\016\371\235\265\200\0060"
+	.string	"\002"
+	.string	"\003\001\002\001\017\352\263\360\321\b\020\021\354\206\342\366\006\022\234\236\237\233\f\b\002\t\023\303\232\323\226\004\024\341\354\356\262\003\020\n\002\004\025\026\264\312\272\256\005\f\013\n\002\004\002\f\002\r\027\032\251\331\204\340\001\002\033\274\272\250\314\001\001\002\004\002\016\002\017\003\002\004\034\373\325\227\324\f\016\002\020\003\035\303\366\326\240\b\006"
+	.string	"\002"
+	.string	"\036\200\224\310\322\016\002\037\300\253\277\314\017\002 \317\356\361\267\004!\350\300\306\254\005\002\"\207\312\266\244\016\002#\320\374\270\356\001$\325\241\220\227%\265\224\221\027&\335\223\302\325\004'(\240\342\234\212\n"
+	.string	"< P\202A\320\334\rf\212\204\321\366\n/3\025\2301\266\301\227-\031\213\016\026\320\025\346\220\301\254;\023\0136u^\267\300\037\205\231O\t\032\266\177\367\314Z\313\373\336\f\224\320$ \207\001/\300\003\300\001\360ZV\372\024cW\n\337\270\026\376,8Xp\023\327\304\034\340'\300;\001(\003,jf\021\200E"
+	.ascii	"\326\317\270\341V\3074M\304\355\2547\332\210\371]v3\264\2030"
+	.ascii	"\234\210-\356\307eX\207\346\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 \231\315\002"
+	.string	"\202\004\r\023\240]\016\377\377\377\377\303f\267\360\314\034qs\337J\222RNkV\223\232\323\224f\004\355\343\314\006p2\373\037\270$\023\231\307\032\253\027\223\330a\205U\361\n\017"
+	.string	"(15\343\362\214\264\022p\346\b|\200'\024\202cH\231"
+	.string	"\013j\022\202"
+	.string	"4/\345\254\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\271\0025\013"
+	.ascii	"b\216360q\222\016\200)%\276`N\226\016;\031\357$\325\365H\301"
+	.ascii	"\374\207\236\273A\021\021\341\321\315<#E\207\026\260@i\204\357"
+	.ascii	"\377Ly\267\0207;\353\355=\354\336-\005?\224H\016\243\006\r\226"
+	.ascii	"\232\022\317\"\304>\332\006\314`\323>\222H\373@/4W\332'\201\250"
+	.ascii	"\366\211V\030[\016\231T\233T\235_\003x(\223Q\224\210._pLB \006"
+	.ascii	"\241F4*\036\251\320\007[^\2702\250@\334\262s\301\273\276\313"
+	.ascii	"\231\215\233w\201oY F*'eb\315:\313\377XY\227 \0351\034\004g/"
+	.ascii	"\001?\271\\\265o\340\317\t\261\223g\314\372\005\020u\375\226"
+	.ascii	"Z\246\\F`\264\257\177\0347l\333\3539<iK\201oq\230\323\266\364"
+	.ascii	"\b'IC\2501I\212D\252B;\033kp\002\031*3\017\022`DI\001\004\225"
+	.ascii	"\200\n\224\340\324\304\\\376\036\270\fq\325\322\361\202v4VV\240"
+	.ascii	"vo\220\361\351~\334\205\321\241\240\277\001R\272\2773\323\310"
+	.ascii	"p\006\332\f\304\226P\302\351}n\faV\016.\310N5\261j\\d\300\354"
+	.ascii	"F\245\321\311-+\203\361\252\002\226\025\257\265\375\246*>\377"
+	.ascii	"7u5\304\t6EH\202 m+\320\205\275E\013>\252\323\377\n\373o\374"
+	.ascii	"\316\336\035\331\246_\036G\352\237\327\363\026\374\352\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\305\005"
+	.string	"\002J\036&\200K\322\001\235\004=\201L\036\006\236g\020(f\212\301\272-\t3@&\266m\233\302:\272i\330B\262'i[\246\177\344!\377x\3077\236\361/\024\177\342\021\377\301\341\363T\222\210\254\2526\226\351\275\367\272&\261\256\273\006\241s\332h\212\376\302C?x\301\315\264\230~\357$q\271J\331J\211\275\202\213\232\200\016\0165\360\200o\255uQ\254\213\352\254\224D\374\374\r\367\022\031"
+	.string	"\b+\310\243\340\260\200\271g\200\201\260\260\271\311bQP\305\013b\306\300\254\263\266YU\333\301@\305\023\222\202\007\312H\301\272L!\307'\211\250\016\376\264\b\232"
+	.string	"q\321\314\255"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"B\204\r\026\240\3250\006\177\372\377\377j\325\003\376\277m\333=\231n\265-\2052.\360\200\003|r\311#\007\271\3079\3368\343\026\2278\342\2073\\\341\204\033\234\340J\251\252A"
+	.text
+	.section	.gnu.lto_.ipa_modref.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"]\004"
+	.ascii	"r\305\017\025pU\r\007\374\377\377\277kh\345\226\353\357\336B"
+	.ascii	"\356\037K\231\002\003\226W\256<\3677\307\226b\345\t\231r\203"
+	.ascii	"\260u\262\366t\030_\022\253\\\225sxa&\324\211\312\223\316S~\032"
+	.ascii	"\\\314@$ \340\002\0313\017f1o\254\030X\3019\211%\033J\320\302"
+	.ascii	"\3075\215\230\221\027M\307I.\207>\206\025_\030:\330\177\233\203"
+	.ascii	"\2131\016\254s,\355\f\324\364\223\345\035bD\203O\263\007\347"
+	.ascii	"\021\366\"\364\205q2\260\255\240n"
+	.text
+	.section	.gnu.lto_.lto.dc27ee09143a3f37,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.55.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\ba"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\334\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\024\213 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.57.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 w\r\003"
+	.string	"\244\004j"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\005\001\006\177\001"
+	.string	"'}\001\002\005\001\006{\035\001\036#!+?\202\210\200\330\001yw\305\001u\304\001s\303\001q\302\001o\301\001m\300\001k\277\001i\276\001g\275\001e\274\001c\273\001"
+	.string	"\t"
+	.string	"/\"\340\356Tm"
+	.ascii	"\261\227\273\232\026@3)\242\f\240\b"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.58.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`2\002u\022"
+	.string	"\026\241xI\320\224M:\304\t\376P\030\367\022Z\331\336\370D\3112\021\035O\002WvjM\301\240\025\002\305\002 gk\333V\322\370i\261\326\275\330~\227\345\274{\301!\315@\313];B\366Q:\254\2663\216%.ld\023\262eJ\001c"
+	.string	"\\"
+	.string	"j"
+	.ascii	"\373\302\350hW\307\300\013T\377T\316\232\377\274\237\314\177"
+	.ascii	"\246\331D\256\363\331\017\t\301\341\001\265\273\241\224q\332"
+	.ascii	"\301\371yRi>\202\037\037c\256vP\245\342\023\207\204~\t\224\274"
+	.ascii	"\013\335\263\321\242\310\230Kq\351\261\226`\fY\345n\236\202\235"
+	.ascii	" :&9\234*\030aw\255c\356\304\255\272\355\032\333\025l\215\t\252"
+	.ascii	"]\\\213\257\343;d>\320?\327\330\350\307\177\276\315\374\247\362"
+	.ascii	"\300O\220M\247\f&1\025\270\341\024ud5\211\255\273\251\214a\337"
+	.ascii	"\333\335\265\354\261\037\364O\251\226\252\326\325K\016\224\221"
+	.ascii	"\224\247]\023SJv\367%\321\260}\373:\232\275\262Q\200@\270^\310"
+	.ascii	"\307\361\034\264\007\335\030\300\006\237\224\254\246\025Z\304"
+	.ascii	"\202\351\013\240\303B:r\006\r\270\"\024<\273\"\200hj\247HH\226"
+	.ascii	"\\x\240\024\001\275\356F.\325\256\355\243_\364\036\0338\270\364"
+	.ascii	"\243k\276\246\r\3530B\326\fB\255\324\3660\243\037\255r\2235\233"
+	.ascii	"\020=\251|6gwWb\204x\242\234j\272\3443\306\235\235\274\210\251"
+	.ascii	"\022e\250\t\247R\266c\037\002\021~\305<haiaq\320:\221a\200\315"
+	.ascii	"\310\\\230\321\300D\261\3465\300\257V\b\0216\233\271`B\231\030"
+	.ascii	"\223\321\300d!\215\214k&|\211\262\260\225\342\330\007\230\030"
+	.ascii	"\316b11\\\351l\367V\366xB\215\235M\336@\003jK\240 e\315S\332"
+	.ascii	"7Z\002\307\263\273\rT\223L\275\313\224\022\346J\377\341\342\003"
+	.ascii	"\331\302\313\313|- \200\002!\252\272\r\311+8\035\272\215b4\204"
+	.ascii	"\342\2737L\227\220.^J\221\357\313\331\320,{\310\023D\026%q\327"
+	.ascii	"C\233\275\344\361E\353a_V\214\210\232\277\222\200\340\0017<~"
+	.ascii	"^\214\226\260\200\271\203\264\315`\213E\335\2025x\335\305\007"
+	.ascii	"\354&.\212\332`\fio\353qg\230\264\362U\312\3617R\027C#\344="
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.59.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`r\001\005\016"
+	.string	"\246\230ZD"
+	.string	"\2216\035\023\034\336A\327\255\356J\337H\253\240\303\375\216\324\275\006\263\243\365\305\234\201Pg\212\016\205o\025\276\375fT\342\200F\\\300\337\037\f\366\256Z\377/\375\021\233\021w\002\205\337wj\263\337\233l\231RE"
+	.string	"G"
+	.string	"H"
+	.string	"v\366\371\314!;\346\242\311jL\030$\254\320\330]Mfx\350\323\222\032\362\365\344\345\003\275\317\0020\254\237ny\bY>\320\302\345\210t\t\bS'\0308\"Us`w\255\037X\341\276n[\201m\003\366a\002\037\350\372\224\262\243\341\202HG_\345\030\013\f\207d\246e\025CQ'\027\2535lq\244\322d_\216\343\270\262,\261U-/LF\013\216\027\273\023F\033\253\232.\034l\337O\271\212\310Q\254(V\354n\366\351\247\210\004\035\324\207\021\307PT\236\316<L\205*\244\t\377\204Z\277\035\t;,\311\212O\3021\233]\357\245?\344\372\324"
+	.string	"\033\301T\222\331\265/\302/mL\226\302\212\313\361\323\023\244hY\311\220\364\206}\361 B\374\r\206"
+	.string	"\322\007\376\350"
+	.string	"q\236\317\307c\201\326q[\007\342\3514\020\006\036\r\264\017\256\323:\006xs\340\341\264\317\266qZ&\212n\255,1\202\031*\221\034\371!~kww\262\320\274\2248"
+	.ascii	"T\312\302\\8\272\371v\331\017:\375g\002$\3519% \220\002)\302"
+	.ascii	"\335#B\377\027\003s\360\347z\234\031\323\213\317\240J\346+\315"
+	.ascii	"\231+\230N\334\301\025[vmN0\273\364\312\266x\245\330\336R\266"
+	.ascii	"\371\3308b\303s\230a\332Rbp\264\263f\364\340\020\357W\f\246\003"
+	.ascii	"5~\013\322\301\034\227:\213.{O"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.60.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\376\b\365/"
+	.string	"\032Q\250\021B`\236\316p3\320\016a<\351x9\203\bcL\201\247MJ]\004\324\022X\267\235\265\304\261\341\373\212\265\267|\3676:/\310\223\254X\016 2@\037W\272_"
+	.string	"U\350\376\373L\003\b7\331{K\231d\005\001\353"
+	.ascii	"\016\001(oz\362\242'\357\331\274}\362r\363~\001S\236\243\016"
+	.ascii	"\244]\257Y\2563\232}V3\350\226\"g\376u\277\362\314\347\356\223"
+	.ascii	"\2300\330/\367Q6\230D\367'\207B<\263\nJm\271\276e \262\374R\217"
+	.ascii	"B\035)=z\336(=\372\333\375n\203I>\224Nr\313:&^\352\321\244!\f"
+	.ascii	"\266\022\020_\267\002\252\305r\235\261%\227\245.\317\272.\t\034"
+	.ascii	"],\365\350\022w\341|\231\\\217W\307\206\227g]W\255\016r\342\211"
+	.ascii	"\206\206B\302`\020\220\nL\321\263\231\270\227\242\303c|kq\242"
+	.ascii	"\344\207\222w<x(t\334\301\302>\267\343\234\233\016\016\002\033"
+	.ascii	"\240i\304\314\361\001w|P\224\0178\034\007\302\021\345Qsn7X\235"
+	.ascii	"s\213c\340yu\034C\343}n9N\2443?\334\260q\252\3268\272v\006\337"
+	.ascii	"\\p\017\337\324N\250u]\177wn{Kc\0066X\327u\331\370\006\367-\372"
+	.ascii	"\356\013\354\356\210]\025D\315\240\006\022f\0315\336\263j\003"
+	.ascii	"u\270\026\017\352\272\252q\355\261<\313\007\020__\351Q\265\205"
+	.ascii	"I\222U}\345\241\212\314g\317\243H\201]\325\267\302\326\204\217"
+	.ascii	"\"M\033\330_;\242\2356V\232F\373"
+	.string	"kF\322\270\271\335\347\253<Ol/\267*\300\300\322\243\335O\343\027\367\346>\333\237\335\260S\021S\327u\345\332K\371\024\022{\271\243[\202\214o<\272'k!4\307!\312\"7\227\b\314\213\243=3z\376V\346\263\273L\343F\356\276\233\315fs\033\310\356\325\353\276VW~\253N^\2523\277S*\257T\312\033\245\362B\001y\237R^\247\3636\235\227\251y\227\232w@\312+\240y\225\2327@\312\233\324\274H)\357\321\311kt\362\0028y\213R^\242\363\016\001y\207'\257\320\311+l\336`\312\033\324\274@)\257\212\362\002\003\021\300\374\030\377\0024R+u\252\2676\227\324\001&\274\215_R\037\317Oy\324H\235\316\351\353\275\232\257\351\242P\241\202\361\257\310\315\235\352\243n=\266?\302\2742\357;\232\013\255g\374\363J\317`\261\251s\030y|S\335\240\030\324\310\252\364\314s\3501\314\333#"
+	.ascii	"e\312\027 \325\250\315\230d\204y\\\256\372L\243\276j\326\303"
+	.ascii	":\2006\352%\274\265cQs\003\350\324\312Z\223\264.\342\033C\324"
+	.ascii	"\307\023\242\214r\nYv\317\305\f#\352\212t\250!\264\261\352\252"
+	.ascii	"\036\352\255!{lqiD\214G3\300F.\237\004\376:`\256\240X\247\352"
+	.ascii	"\266\276W:l\245\032wL\277\375\336\277xa\320\240!=:l\264\317\r"
+	.ascii	"]\\1\217G\237U\277\216\252\255zKn/m\344\376\274\\\327\025m B"
+	.ascii	"\315d\370\253\227\n[\250\231\364\326\346\324\026vz\224[\363u"
+	.ascii	"]\327\263\221\033\354\367\3570\371\202:\310\341]\270\004\365"
+	.ascii	"\201b\032=\357F.P?gcca`h\330X\210/4\fC\013&B\001\027\002.\004"
+	.ascii	"\006\262\214\320\276\036\220\225\231I\b\023\373B\033+\333pF\202"
+	.ascii	"h\301\262R\230\205\241\241}\205\320:3+;3\021v\246e\202\304\027"
+	.ascii	"\231\026\230\331\231VV\323\226\235\b3\323B++3\323\n.\213?\327"
+	.ascii	"\006b\301\316L\261\323\366\034\203\337\030\377\234\020I\365\356"
+	.ascii	"fq\2331\252\245\324\360\213(%P\355\205\327\210K\206\222\353\272"
+	.ascii	".XVc\027D:\242\023\242\035\321\356\251\241\366\270\370\324HB"
+	.ascii	"\342\220\f5r\371]\251S\207`\3725\273\210wN\215\344w\345\310\271"
+	.ascii	"6\222\317\3758"
+	.string	"\240J\346\020K\367<\261\271\321\367\256\024OS\262\316\025\033`\354\320\031\302\035\3061\210\030\2410oj\bU\315\324MqV\315\324\013\212\304a\303Q\344&\307\325aY\"l$\230\017\233\005\263\315\357~\031mv\222{\344`\t\312\361)\201^\346O\362\311P\257z\252\333v\227\34688\361\0064R/u\312'\240\007@x\0348\002\372R\204(\351(\265\033\261\200\310\250q(*\021R\210DDD\222$\2054\006\200\002\221!\253\252\003\021p\261eS\025&\315\001h\303\3447\325\230\214CR\t\241k\b_-\215\357\350\301'g\276L\341\241\374\255<\222\b\314\364Ly\016\2601\222G\332f\220\252'\202\200LP\036\303\221\320PX\356Y\366\032z\275\032H\316\334\017\003t\3666\320\365\227\352\265\024\360\216*N\021&6B;O\377D9n\341:\036\321\"\361\267\2132r+\324\360eH\240\030\243"
+	.ascii	"jM\204\275 \006R\370\300\005#\264\027\356\311Hx\006#\364\fNW"
+	.ascii	">|\"\226f\275\236\276 \234v\307\241UT\367\240\315\254\303M\232"
+	.ascii	"\344\202\217w.\302\233\036\341)qu\373Y?\304\211\376@3h\220\354"
+	.ascii	"\213\2223Y\356XcI.\336B\021\361\336&\206\227\f\301\245\374\245"
+	.ascii	"P\262v\275\271\253]\344\274\374<\222\242\377\203\217\007s\007"
+	.ascii	"uXl\020\260\334\r\200\020Q0\337]c}\320M\021SS\372\300\204m\345"
+	.ascii	"}\331\362\315\177\023\021\315\273\342j]\336\216\004\024R\342"
+	.ascii	"Q%[s\205\001b\366\210\314)\372$gjG\f\255\364\345\031[f\r\240"
+	.ascii	"\001\363\257\315\344\213m\354D.\312&\302\023/b\334/\355\254x"
+	.ascii	"j\237\313^\341\277el\241t\316cY*z_M\270\231\211\2053V\257\320"
+	.ascii	" /\2165a>\300\350\273\345\347\030\005\"h\322\007\206\253\344"
+	.ascii	"\346\256u\323(\363p\207Z\274+\003\263\325\370\017"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.61.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\315\004\r\030"
+	.string	"6)\220K\320\360(\035?\221\023\245\313\r-8X\t\3100<\300A\260\350\223\2543\200D\211\372!\017!\225]<\030L\346\336\355\245\205a\027>\306\035\267\342\2761\300\027\017q/\035`\3604\330\021R\003>\365\253~\322\b!\204\020)e\nz"
+	.string	"l"
+	.string	"~"
+	.ascii	"\314\027\233\337\314\347\345o\200U\007\027\b\200\265V\030\346"
+	.ascii	"\250\301q\210\303\377E\337\362/\255\317\246\226566\240\033\265"
+	.ascii	"\326\264k\266eQ\324i\226\344(6\267|\313\326y\313\271,\212\032"
+	.ascii	"\321\301e\340\323\324\301\351\270,[\244*g\203\341qd\0273\263"
+	.ascii	"\242\022nF\024\331Y\236\220\253q\313\274\240r4\222Uk\335\035"
+	.ascii	"nF\344\262Uk=\337r1\373\324\376/\372\177\340\027y\002#\026DN"
+	.ascii	"\335\320\363\365\371\222\271*\344\216\347[\265\341\344\374\353"
+	.ascii	"\373\277\324\026f|\250\325e5\360\255\032\020y\341\247\177ClO"
+	.ascii	"\345\213s\031\013\357m\307/\013\271\343\366\251\233\361\360\374"
+	.ascii	"+R\252\334\364\373h\334\274\177\305Zk}\323\374\314"
+	.string	"\377`\276\007\363Y\315_5_%\362;\232\237b>\332|\024\363\317\346\233\315/E>\331\37416~6\365\25316\357\313\202\200\r\r\220\037\322}\265V\261y7w>H5fz\331c\233\035\"\004\223C\343\341\311.\025\354\212\005f\255\265\222\357\320\252`\320\300\345\"w${\211nzb\217\013\334\024'&\257\027\271\243\330\373#\354\356\265=\315x\370\377\301\n\235\230\265\326\222\357\211E\001\341\213\263\343Q`0rG\356\001\302\236\352w\264\"Ve\024ta\247\355\240o\t6\001\364\r7!\221\020{\255\254\270\034\244\262\030L\226\362\222\245)'.\224\324$&KI\004\034\026\341\025KW`\260X\212\372f+n\323\354\254\t\364\020\2345\355\313\263o\211\250\f\020\240\f\352\243=zw\302\217. \324\305\200\341\001\304@bS\300\013g\317\013'\263yg\365\331\333\363I\2521\223\022\253\323\033\035"
+	.string	"\nMeP\020\007\271j\224\252S\275\352\020\242\216V%!u\364\022\t\321N\035%x\241\275@7g\243Z\030\235\001h\250Qd$\221\321\bIQJ\205\306\360\002\021\251a\035\021\020%eJ\331T\250\215\003\202^\030\241H\310\0274\"x\370\221\345\231U\372b/F\022ki\360\343\334\220\374\240\224\037/\344\343\034m\035\314\213\300\334\221\203\222b\355&\034\031P\177\236\364\301\216\216\200{\233\316^\226\nR\253\020s\177\030\367\034\004x\031\221\030\256\270\177\213"
+	.ascii	"(\227G\217\"\f\353q\322\322)\247\317\255\024>}\224\201yk]\245"
+	.ascii	"\0010\2057PT\034Q:\036i\221x\213\213\"N\206\267\356\216\007o"
+	.ascii	"\225u\316g\270\307?`\231\317i\360\313#b\007\374\355\205\020\206"
+	.ascii	")\2241`\306\t\2100y\271aGV\003"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.62.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\b"
+	.string	"\242O76@o\323\001@e\032$aR\316\240\2053P\237\330\001\210=d\343\373\316\023\256-Q\254\246i`P\273J\233\274<\306\007q\031\002V\267pj\265\037\034B\244L)\366pB\331\245i\235\005\0303,\202\256\bA\f\235\017\364d\021r\b\2149\\\031\3240,\203\233oO\255\222\024RL\"\355\254\372\321p\342\271\244^U/\361\322y|R5~\351\037\346o\370!\346\275W~\004xu\275\210\206\205(O\266L ,\022*\355PD\336sA\247\234s\244\304\262)c\177\\\352\205}j\225d?\255O\347\323\027\260PV\020`v)N3k\252J8l\177\343\315n\371\227\261\017Q\231"
+	.string	"\211\331]\250\030\337\236\233\377\216k\274\021\367\fH\330]\2477\252\270\365\266\rl\037\330\037\b\023"
+	.ascii	"3\241!(p\371\335\001;\320\030p\227\324j\340\030\020\202\347\214"
+	.ascii	"\021u\037\224\233s\261:\333pad\031,y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_getBatteryState.63.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 \376\365\006"
+	.string	"\302\31514`m\322\001"
+	.string	"9\265!\344V\202\324\273\265\025\350^\265\035k\221S\212`ZC\275\207\223\354\006\272J\350]\222\3542\030\243\220\347Z\325\357\257\210l\"eJ\001\306X4\220\272\256\313\302\263`ee(\353e\030.\r\017\003\255g1p\345@\301wU\025|S\334+(\265\342\321\007\373\037\217\230\237a\315&\237\335\371\033\351.U"
+	.string	"C\302\223\233'\212M\024;vR+\354G\273\273V\220\355t\352@\311H\202\311.\304\226\262\".D\303~\210cO>\307;8\306\242x\241\005|H> '\273\361U^ \335E'\220\356\324\342\330\023\363\357\361h#\264eZ\347\t\240\260\273\316L\213\270\365\266\017l#\330\236\b\007"
+	.ascii	"2\001/8\003\\\034 ]\346\311\f>\334\025S;\311"
+	.text
+	.section	.gnu.lto_batteryStateStrings.64.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"D\nq"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\237\366\320\277\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'9\206\b{\by\276\002\005\001'C\206\bwu\301'L\206\bsq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\fNOT PRESENT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\006"
+	.ascii	"O\221\006\001\003\302y\346\321\240\362\033@\021"
+	.text
+	.section	.gnu.lto_getBatteryStateString.65.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\365\t"
+	.string	"\246\322D< \345*\035@\252\314D\310*\024"
+	.string	"' B\322\341}0\021\304\036t\200F\0047U7k\377\217\233\267\004\225\250J\355\004"
+	.string	"\006\200B\221\245>\215\252\234{L9+\262d\223\275S\n3"
+	.string	"0"
+	.string	"6"
+	.string	"'\003\321\243\225\231\3310d\001v\305j\361\005\335\251\346\004\335\351\354\370\351\362\344\037v\356\026\003\240bY\\f\034v\327R\305j\335\363\266\023l/\330\337\004\366\271\235.\333\322sJKnski\200\331]\215\266e\2414\020?v\261\364\022\007\244\306\220\335\365N\375X\311\366No\233l\317\0379\211\311\001 \356\257S\177\242N4\017\273B\314(B\363M~\022\372/O\220\344U\244\356T\316\201\017\r\224\034}\361\002)+.+k\317X\251\274x\033+k\266\230\222\223#\366p(\300\317h\324y\250!\370\205\241OXC\020\035P\365\200a\345\034\370\223\370\200u\364}`\365D\324\271\235\2569\021P3e\333\025\237Ehv/\030|\331Q\002\017"
+	.ascii	"2\241'h`\265\204G:Wj\342\030\032\365\036!\226\020/%H\327D$&r"
+	.ascii	"T\361\024*2q\247M\355$\003"
+	.text
+	.section	.gnu.lto_batteryInit.66.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\203\003\365\025"
+	.string	"Vc\202I\260RN:\256\373\212\347CZ\366\031\232K\025#K_\374\307\335l\276\"\376\357\304\013\n\005\217b\025\346\034k\333F\371\361\256\204\252\377\213\351\273\223dB\222^\205\336X\212\253\030\372OH\363\303\305xv\264\265M\310\226)\005m"
+	.string	"g"
+	.string	"s"
+	.string	"\007@\373Q\203AU\255\032\202>*P\364\225\260\375\231I\233\353LA\365O:9N_\265\326q\2128\371\030\025\303\271\244\277R\301\262\227{l\245\213\356\213\246\262\307s1\003H\017\207\222\bQ\221\310\231\341\217\036\246\200\252*{;\237a\bX\016\326\254\267\013\017\340|\365\210\364x\273\261\224Z\253\267\354q\270e\267\255\263m\300\236.\002\242'\264\264\320\213\266\313\313\2764\001\336\314y}0\236\016\005S\2231I\202\241>\213\267\200\211\221\221\241\027K\264\216\276t\247\031\022#\337F}\025_a\263\200\303\321\213\002|\346m\250\237t%\033\177\310\027n\366\345E\377\206^$\t\362\322m\320\353\373pU\267\207\315\264\333\031\302\376\f\006\203<<\201\354]\357\327\001FWK\363P"
+	.ascii	"\2502\3434\310$rIE%\201\202_\007\033j\265\340G\007\371\361lY"
+	.ascii	"O\234\222\333\260p\304k\300\332\rVv3g\021_\227,\250n\250?\365"
+	.ascii	"$\304\267\003\230\3330gM)\371\314c\240\237\001\232\266x\013f"
+	.ascii	"\333\301c<\220\325\312C\340\373\376\203\020\201\205\205^\374"
+	.ascii	"4\031\2414\342\243\355\221>\325\"\253U\367\322\217\272\224\004"
+	.ascii	"\177\350\001~A\271\271\325jj\\(\214\270\233\rGS\303\21541.3\343"
+	.ascii	"\313\r7\242\224\330V\241v\033kl\266\3338c\322}\002\311~A\240"
+	.ascii	"n\356|\254\2071$\023F[\017\371\025Q\032\021y\342\347\203\343"
+	.ascii	"\264\236\013Q\t\311\020s\370:\326\212\250\376d\371Z\346\222\375"
+	.ascii	"d\021\275\350-\253N\024\321o\330\346\232;a_\265\346\016b\366"
+	.ascii	"\303\333\037(n\203\fZ\250qD\215\214RE\222\242\222\202\244\003"
+	.ascii	"\340\002\021\261\331\r\021 A(\335P\nY\326\022 B\020p\032h\373"
+	.ascii	"\301if\035}m\262\b\367\335F\344\366%\225\357\273\032q\311\224"
+	.ascii	"\031\355\242\207\036\304+Yw\013\026]\260i\305fq\027k\372,OR\002"
+	.ascii	"1\360!1\324\276\340D\030-\202\206\363r\210}fl\001\207\353\310"
+	.ascii	"\030\330\271\271\257\350I3U\205\373\312\nX{.Q\001\350\316\303"
+	.ascii	"\347\334\f y\357K5#\r\351\217sgi\\\211\372B\250(\372\221\264"
+	.ascii	"\202z\013VE[\235J\013ya.\254|\210m\210\223\270\247qlvdg\320\310"
+	.ascii	"\254\n"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.67.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\347\002\265\023"
+	.string	"&\342zI\320\322(\035bAh\302\2445Ix\310DXF\220\021j\356C\362\271\035\276}|\250\024\020e^\374\372\264\266i\230q\376\361\327\007\370qs&\210;\354`\275\222/\225\310AC\300\356\214\254\002\333\306G\215\020B\310\226)\005e"
+	.string	"`"
+	.string	"d"
+	.ascii	"\273\271\004\377\254@\374w\224a\266\217\347|6\374\351`S\024d"
+	.ascii	"w\307i\342\260\213\234\304\020\374"
+	.string	"\274\2510?\\9\321j5\02799\211J8;\236\t\013\034\035\r\303\225\0229<\007Gj6\250\032\007\3756\2507\323\211\373\211\022\016\217g\262\273\017\272z\250\311T\303\225\335\265\322j97\352\266\207lS\2605\027\177\321\022wg*~\356C\030|\240\177v\315\350i\377\374\031\360\337\247\201\023\270\230\356\254\272\020J\253MvN\246\323f\337\333\331c\377v\207\236\332\363\324s\252U\325G\021\020\3321\001\307\356\207\235\220M\372\216R\374\366\333/Ab\361\205|\234Q%6X\0304\200\375F#\256\212\320\350\347\346G>@b\272\363\210n\0048m3\036\316\222hi\246L\006\240\023q\223\2306\231D\355\224JO\013\347o$d\263\306\307\3757\272\035\347v\367\243\001\347\f\200\273\214\033\321\370@&W+\360\337\234\357\261\244\023\323\235\336\2336?\006\324\251C`\036#\246H\347a,\351\356\326\314k"
+	.string	"?_\210x\314\224\311\266LVYp\240\222\242\222\262"
+	.string	"E\300\212\005CB W\251\027\213T\225\344\203\002V\241d(\311\327+\3652\272\312\226\213E\272F\026LJfT\225\256\021\345\200[\027\310r|\265Z\345\210\312\305>{\034tQwK\212M\231\210s\2708\375F\013\222\335\025\247\315\341\364\346Q\020\351\210p$\tG\336"
+	.ascii	"\020+B}\013\350\323x\215\226\n..\340?\004\001? \260\002)\242"
+	.ascii	"\262\003\211E\234C\232;\213\334\266\207\311~\356IhOc\273\322"
+	.ascii	"\357j\307\274B\276\300;l\356A\031\302q\320\342\246d\013\3056"
+	.ascii	"\230]\357>x(\213Q\236\365\321\005\030$\f\021\216\256:\260m\336"
+	.ascii	"\275\301\253D\227\341\354YN\265\335\016#4\343\243h7\231\250\223"
+	.ascii	"\205KY\t 6\r\306\233\350$\306\0265\360\351\025F~\034\225\361"
+	.ascii	"\234)0\301-\270\321^\030\n\241\267\033\r\255F=\032u\370\030-"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.68.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\263\007\215-"
+	.string	"\312N\214\021E`^N:/\263r`\226\360v\252{\270>\202cC?6\031#:\024\272(0\366\256\257\032Q\033\220\374\320\032\373\001\225\205\016\273\241a\203W\022u\374\b\013:\016\323N\337\004\233\177f\3327b\t!{'\031"
+	.string	"\001\372"
+	.ascii	"\t\001O\353\016\266\324\273\364\277<\f\260K.\210\006\346\007"
+	.ascii	"\032\030\0025\3306\243\345\364+\356)\006\315\371\351\340*Q\025"
+	.ascii	"Rz\177&u/Q\3513k\0050\033\263\342\203^\355\0257\223\352\016^"
+	.ascii	"\275/\353`Q\bR\367\363\006\313\314b\323\352\204\345\345\234\035"
+	.ascii	"\\m\021\354\325n\001|H\277\335\027\373X{\262\034\r\314\231+\315"
+	.ascii	"Z\316O\b\375\200\275j\364\342z5}\200\365j\267\335x\177>\311\027"
+	.ascii	"\363\344\352\f\232s6b'o\037\004\002\262\277UM\361m\373\314\007"
+	.ascii	"!\354\240\002\264\006N,\f\370K\372T\221\263FU\262\212\334_\332"
+	.ascii	" \217\215\317\353\262\266\322\"\020)\315\263]\335\365\227T\366"
+	.ascii	"\016P\320\360\250\347\312:b\005\244\245c\rB\300\225e$M%\304\331"
+	.ascii	"\211\355q\0059r\234N\320\001EB\324\252J\205|Wo^\366\213\245E"
+	.ascii	"u\357/)\347\334\267\251\025\344-|w\257\351n\260\356_\201'\362"
+	.ascii	"\205\317\307\236<\370hC\374\263\033M]\356k\242\220%J\254W/V\240"
+	.ascii	"w\335\360\340-\260\262\271t(n\350\276\313\343R\2609O\275\331"
+	.ascii	"\207{\032\245\376\327\325F\221\"\305\272\202\305}\263\215\252"
+	.ascii	"0\263\205ni\352Z\316\032\231\023w\213\365\330\205\331\234\252"
+	.ascii	"\313\327}3?\323\242\377\325K\307\373\346q\275z\\\344\2655u\243"
+	.ascii	"=\344V\367\262+]q\356\351\345\333\247\373IuqW\367q4\032\2156"
+	.ascii	"n\322\r\274m\340j\357\342\327\336B@\267\203\206\267\211'\373"
+	.ascii	"\207\303\333\300\341m\026x\3737\274\275\no\253\353\3554x\033"
+	.ascii	"\003\335\276\300\333/:\233\023\212GE\231\234\201D\375d:\265\r"
+	.ascii	"\354j\377\332\331\213\273_\\\202\324c^\346l\035,:\327h\340\220"
+	.ascii	"\243\023\2032\371\222P\241=\031%\233\247\374\322\240\214\311"
+	.ascii	"\343\301^-jQ\2032\252zf-\025rybP\033\001m\304\267$mMJ\326\352"
+	.ascii	"dn\3029u\373\254@\334\365F\263\304\315\016\253\\S,\3043\243\263"
+	.ascii	"\340\006=j\355n\255\264W\356\233)^\307\234U\230y\004pV\210\374"
+	.ascii	"Nc\025\3020\332\350\271\241\021\006\267\247'\204\277\226\340"
+	.ascii	"v\267a\355\226\373\246\020>\027'\025f\366\331\376\037oE\346\\"
+	.ascii	"\3706\204n%\312\322\223\247\3331\026C}F\227\210\2735l \272\375"
+	.ascii	"\251\213\363gY\203\3461\357\2378XyZT\334uw\274\337i\274#\250"
+	.ascii	"\022$\370\034n\223N\277\316\355\333\314XiS\262SN\337\356\347"
+	.ascii	"\260^%\221\325\330\211i\311938\234\316\231y%\354\223,a\316N\f"
+	.ascii	"\232\235\231A\320\251\343\366uw\207\273\361\300\346\\e\241\337"
+	.ascii	"\346u\037B\214\030\261^\305\370\200\027\331^]\236#\362B\342\266"
+	.ascii	"\207\210\377D;\373\313\016\344\225%k//\b\023\361o\317U\337\305"
+	.ascii	"C\034\204\007\214\261\232Bu\243\375\264\253s\\a\036J\250\345"
+	.ascii	"\322\322\304\f\344\322D\022\271D\206x\361\244!\n\t\202h\311\244"
+	.ascii	"\204\001c\004S\323r\211L\306X\022]\274c\034)\233d,\241\214OH"
+	.ascii	"''\344\221\300\322\227\032\230\226K/f(-\225KM\302>\276\270`\201"
+	.ascii	"\202\005\n\021\216\002(\225\230\234d\234X>1%\223P\307a\037\217"
+	.ascii	"\244\222L\313\345\222\013\2432\211T>1)\215O2\226\234\214\307"
+	.ascii	"\244\322xT\324\310\031LI\343\022\211L\032\203\317\251\247\031"
+	.ascii	"7\351\213\251\372v\336Ii&\220u\261n\363-\372\346=\336\372\320"
+	.ascii	"\001\341\256\276\254\203\013\357\302\330\374\036\034\210\261"
+	.ascii	"\272\211\260\264\335\253k\305\204\250J\335\321-b fq\333\325:"
+	.ascii	"\271\302\3146\200Y|\266\003\270\273\352\233z\321\372\303\006"
+	.ascii	"p\337\253-\252\033\275\314\326\353\370\303?\233\263E\245\256"
+	.ascii	"\210\257Vc\353\215f]q\021\337;+%*^q\272\307\212\315\324\215\036"
+	.ascii	"\275\257\313\2609g\f}?\377\323Bi\243\264`-\330zU\305\031\274"
+	.ascii	"\002\200\232\250a0\350\230BfhD\302hAZ\030\016\200\002\221\251"
+	.ascii	"2z\020P\207h&Ia8JP\212x|\245\2634\331\322\261&iS\t\330L\315\210"
+	.ascii	"\257Y\341\b\356w\024\251{Er\204\364W\371\031x\342\307b\300\205"
+	.ascii	"pu\376;\251`\334\203~\332\205\213\363\20666OWW\033\214\3214F"
+	.ascii	"\240\334\370e\332d\243~\271\374%\006H\254\303\212\374\322\242"
+	.ascii	" \rs\034#\213\214\326TI,|\223\212\255\334`\376C;I\316\301l\316"
+	.ascii	"c_Y\\\321\253uv\211\2050\b\313\016\004\031\364N\203\302<\b \204"
+	.ascii	"\023\203\013\215\305:\324\253o\374n\003\243\271]o\316\013c\272"
+	.ascii	"G\337\347\276-\274\252t\024\232/\033\354\206'\266/\245\222\204"
+	.ascii	"j\2325\277\347\366q\324\244\372\245T\340\324\344\331,C\241\003"
+	.ascii	"\215\214(\033\037di\242\334b'\020\324\277JZJ\315\242\307(\305"
+	.ascii	"\306%\b\350mI\004,\221d_/E\341\034\213\332ZX\322%\255\0228\363"
+	.ascii	"\247R1ZL\310H?\325;\204\301|\346\254\245\277\245=\343#\234\256"
+	.ascii	"\252d/,f\313\256S\201\271]\246\034\037\317\202h\367\261e\307"
+	.ascii	"\003\002\375\356\332$\255\320\241@\373F\221\350j"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.69.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\r\001\r\r"
+	.string	"F\330WC"
+	.string	"\2216\035@3\221\320\305V\300X\313\f@\2365=\250\006\233\361\371\267\267A\313\262\253\317c\373\366r\005"
+	.string	"h\304Etg\373TH\352Z]\255\362%\214\301V[\036}\300\211\346\255{\177\262\267\224)\005C"
+	.string	"D"
+	.string	"B"
+	.string	"6\301\257\304\312]4dp\201cw-\217\027\240\036\341;\250G%q\356P\223\3633\035\230\242F\214\021\ttX}\270\016 \211\240\307\356\276\364D!\20523\235\335u\216H\036\356x\333\017lC\260/\022\316\023\210\031\233/\366\027JU\261\017WE\330z\357\316\247\0375#`N\023h\354r\210\201\331\226\b\343\304\275\333\3778\r\201\026\007\366K\367l\252@\035\f`p\331pcw\025<zA\365\350\253\370\n\316\001\320"
+	.string	"\322\316,\344G\251\252\240\247\252J\tu\ra\261!\312\034\266\267\267(\251vE\034\237\305Y.\370+\21769\311\217\036\375\023\352\361z\300\204\327e\214\363\024\302t\247h\267Kp\357 )]\276\004\276$\200p>8\037\f6\035\032&\342\271\"\b\360\2651\321\260\317\307\023bmZ\266\221`\233EB\3013b]\332fm\0208\253\200i\326'\3134K\363u\207\232:\362BF\376\273*\212m\325\006)\235\206\374\322\003\234Ph\247\013\031"
+	.ascii	"<\213\231+\213\033l\203\021\207-\234dw\201\246E`&c\006\3660Q"
+	.ascii	"\205\035\3135\031\"5\210\2730Tm\2700\226\214eQ\314\351L\263X"
+	.ascii	"\276\250i\200\273\320\250q\206\032\262]\245\f"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.70.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\331\006\265&"
+	.string	"\312E\020\017G\200\334M:\237\205.!VD@\2349\342\221\206\007\233\306*)D\366T\030\r\325\353A\003\227C\226\t\321\236\332V-"
+	.string	"\250ij\357\b+(\342\263\250\335d\343Yx2\217\001\027H \201j\231\332\023K\b\2212\311\337"
+	.string	"\313"
+	.string	"\337"
+	.string	"\253\333\024G\262_\362&w\262\003\306&D--\215Z\032\222\027\025hL\300\2401!*\373VVS\327\261\026\025\214\021c4p\263(9U\362\317\366fO\222\342J\026Y\036k\021\b\307\233\027\2157\265V\00477\004z\263\251\024:2\265\037\333\227\t\221M\375\370#Y'\303B\353\023\364+\255G\006\364\246\317\207\316\233\374\240\363\346\336H\212]\335M\336\315\332\027Y\235P\220\251\033\265\320\032\206S\362\303\206[\255G\0037\367"
+	.string	"zs\0250\310Z\255\037y\2748\177\324\3602{S\353\221\327;\256\365\323,\233\265\366\270\b\245\2202l_\305\255\237`7sE\260\227\273\242\n]\261\213\273\354\354\242\230\226M\265\326\0279\263(r1\343\"\324Z\227\277\2121\276\270\357n\211\335]\261{R\t7\235z\250\307\330\313\376\026\3115\256\265n\365\224\277C\224\221\351\3428\273\247\362*Z{\037K\002\310\377\002\2367\337K=f\020\271\316r\022\312\265\316\033\017\341\006\221\345,'\215t\251,g\367\310\305\255c\367e\355\034\273PO'\373:\225\274\001n\3742\225\274K(\257\022\312\233T\362\"\225\274G%\257Q\311[T\362\022\231\274C(\257\020\312\033\204\362\002\225\274?%\257O\311\333S\362\356L^"
+	.string	"(/\017\216WW\362\346N\336\235\223\027-yq'\357y\362\232'oY\362\366\311\313&\357\005 \265\341R\345\246\326\027u\346\324-f\024 '\373\215\347\335#\243|\355Rv\300\246\250\245-\ft\013\006\232\344G\r\267?\331o\024^\246\002J\006@_\313\2301]\363\264i\306\353\315\302\305`\201y\030\f\0326l8o\352\372fc\306\260\230P}\243QCu\323\371Z\023\021\312_\366\234\016\344\021\216[Q\033\365r\332\346\313s]\324\017x\260\245k\270\220\3171)v\251,g/\345\227\241d\216\213!j\352\227/\362\374\232\201?J\256\017\345M;\235\3532-\315\202\366\331;\3754\211k\264\237\272\341Z\t\351\365\346\344g\273\353\252\225\be\366\331Im\251X\331O\303\270\270\316v\227m\204%u\333\345\360.\035\320Z\253\324~\313\271x\370"
+	.ascii	"\002\304y\263\373R\306\21495\267\331\226\272\355\222U^\266\216"
+	.ascii	"\305:\235Z\310\223ds\352\223}\303\r\342\366\216\305\307@L\255"
+	.ascii	"]R{+\277\362\333\373\270\271#\252\252\316T#\252\250J\024\301"
+	.ascii	"\022\275TQWT\303\036\220g\025\004\002\203>\244!\260\327X\303"
+	.ascii	"*_\317DOB\317\372D4\220Z \265 AT\320oDoh\365\363\t\177\027~\326"
+	.ascii	"\027\205%\374\r\207\275\020\274+a\360\312\352w\305\263\252\352"
+	.ascii	"\001y>\341\025/ji\203&~B\3360\030\024\362tG\342\313\3329\366"
+	.ascii	"H0\346S\277\354;t\220j%T\237X{\343"
+	.string	"O9S\263\330]\246vp\203\330\\\373\"\317%\3310\365\215\337\b\304\362|\352\351'5\264\263-\001\272g\251\003<qr5\264\245\376\231R/u\231\226\324B\255\324\005\314R\"H\235t\324>\215\324\020\350\244b\273&\352\243\346\231\245aCM4\341h\316\f5\267\r8\203Z\250\t\244\245b@\315\323A}d&\r\373i \237\336\365O?\025k\237fj\003\320\273\276W\200\211\250a@\345\024B\246\210D\nR\220\024Z\r\260\002\031\242b\035\021P\251\226\2504\3112\006\333&\335\200\007~>w\276\\\231\031\334P\177\312\233\323\323\3217x\324$\262\211~C\320l\215\324\n\264][\027i#\230\374M\276\212\220=n\031]T\361\345\223\351\360\210]\253n\036_\321\242\230\311\270S\240\360z\277\256\323rv\327\247\325\rY\210=\355\257\273\002(\366+>\273\033Kt\310&#\305|\364\214\304f"
+	.string	"\007\rZ\275\266\370\352\242\021\266\353\345\347c\003K\254\260\002\205\243\243\305[\321@d\317\251\306\211B\256\376\321\222(\372N\002\232\020d\326\270\355*\326\024\362\324"
+	.string	"\021\215\262\233\222\005\245\320\342N\270\r\245\327\300<\344\277\250>\241\311h\300\207MBZ\336"
+	.ascii	"\316\030\325\301?\377\236q\024\037.I\bCi\342\222\362\203t\335"
+	.ascii	"\004E^\206\363\017\215\346\260\3267\250Q\304\221?,B\306ZL\231"
+	.ascii	"\001\261\036S\030|\206\376\001"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.71.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"\226\321A<0\305*\035"
+	.string	"\330\277\236\177\363\3100\230B~m\224\n\275\327\260d\211 ,\035\031\243\313\350\347\207^\324\250\026\264\250\251\221\3366#\230\240&*4e1i\342\031\200U\373do\231R/"
+	.string	"1"
+	.string	"1"
+	.string	"2\252\311\317tv\367\255k\300\360t\311\361(\027f*\001\n\302\2244P\215\200o]3\302O5\323\331]+\030j\334\333m;\330f\260\355\022\261\260e\225\200\r\3734~\330\227\033W\366\325\337\016:X\"\004\354\252j\005V\266\255\220\330\376\306&\033\300a\254=\212\013\343d\300\356\316\br\323\003_<\231 \266q\026m\226\022}\201y\374\230\274\244\224f\333{I\305\300n\252\301w\375e\341\213|3\251\244\007\277\371%\314\267G\204\220\027Jk\326\006qH]h4\362|\246\327q\236(\344M\021\204Gb\202:or\022\314M\204\2729\342\270nn`\250\313\215+?x\310P\361\223\032\2659\n=h\205\r"
+	.ascii	"3\241\333\037\003\210P|\330+\251\026@\241\025&\003\035\254qM"
+	.ascii	"$`B~\031\202\270\\\246\024j\017"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.72.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"U\007"
+	.string	"\"N35Po\322\001\200\362\275\331\336\220\252\035~ \202\275*o*sz\276\016\305\255\241\326\273Gd\031i7h\235\251\252*\306j\377s-\235\024\205\321\210l\"eJ\001\336d:\320\3122M\303\303\340\205q,\354q\0344\020o\003\261\2279\360\025a\301\227]\027|U\334O\253#+BH)lK\374D\013\330\335\005\337\344q\302\367\270s\307\223\337\356|\217\032t\224\204\262\344*c\023\306\216\240T\r\373\323\352\310v:\265 d\345\301e\327\242\024\263*.\005\304\366\307\256|\221\217|\254e\344\270\240H\244\n\224\227\335\370\004N@\335\345\007\250;\335\270\366\324\374\223|ja)m\"\320\023\200aw\235\233\b\343\326\333N\260\255`\373#\t"
+	.ascii	"\t\013\035\263\030\277\"\3365\204\345\032~\0331\262\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.73.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"]\007"
+	.string	"\"\21635Po\322\001\200~V.\240\345\250\001\225\tDp\204\251a\210U\362\342P\334\032j\275{D\226\221\266\202\332\231\252\252b\254\366?\327\322IQ\030\215\310&R\246\024\346h>\320\312\262M\303\303\340\205y,\354y\0346\235\307\201\330\323\034\370z\260\340\313\256\013\276*\356\247\325\222\025a\244\022\266!^\242\005\354\356\202O\362\030\341s\334\371\003\312ow>H\r6FF9\343\352b3\306\216\242T\f\373\323j\311v:\265\340\203\245\243\262K1#\263+\016\305\303v\310\256|\220\207\204\254e\324\250\240NR&L`v\343\0238\001u\227\037\240\3564\343\332S\363/\362\351\305\245e#\211\236"
+	.string	"\f\273\353\334H\026\267\336v\202m\005\333\035\001\t"
+	.ascii	"\t\013\035\263\030\277\"\3365\204\345\032~\0331\262\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.74.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375 \357\245\006"
+	.string	"\222\214.3`m\322\030"
+	.string	"\255\207P\323\0365c\261h\250r}\276\305<j2\250\020\315\242\336\303Iv#_E\365+\bZ\002\205\216Bf\b\364\270\265M\232\2242\005g.\232Ga\030&\301]\317\272*\352r\225\002f\301e\336\345.\002[\f\324s\230e=7m\213*J\035\360h\303\243\006ndc\305\232M\242\206\322\270\251\240\224\n@\361\340\311\321\023\304\246\311o\235\324\210G\312\252\350\317S\003@F\252\216\335\317\350dE\244\217\213\237\363\323\006\007\2343\334&>\025\213\020\007\216\222\335\315\251\004f\230\331\210\031H\301 \361\320@\035L\013\302\356\236\032(\204+\376\004\177\301\037\n\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_getAmperage.75.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"bN34`m\322\001"
+	.string	"\315D\033\274\007\013T\036\360c\t\250\256_\203\203\234\262B4\213z\357P\223\335@W\t\275K\222\225\027\323D\310\263\330u\352\037\221\275\245L)\326`8\221\272\256\314\002\264bem(\013n\0302\rP\023-\210)p\345@ExUU\204\323\266w\253!\353\005\244\021\266\037\036\202\005\354n\202\017\362\r\302\327\3703\247\223\317\376\374\216\364\227J\220\361\001\312\026O\025\233+\366\366I\265\260\357VC\266\323\251\b\243\233\220\354N\264\260l\311\033\331\260\355\261'\237\343\035\036cn\303\320$\321\211\204\210\312\356\302\313\007\244?w\001\351O/\216=1\377\036w)#\224L\373<\001\024v\327\231i\024\267\336\266\201\355\003\333\242\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303iC\214\230\261\207\273bj'\031"
+	.text
+	.section	.gnu.lto_getAmperageLatest.76.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\242N45`m\322\001"
+	.string	"\353\347D\226\177\034T\036\360c\t\250\256_\203\203\234\262B4\213z\357P\223\335\230\352\021z\227$+/\246(\344x\354\213\305C\226\354\275eJ\001\316\\6\263\272.\214B\264\246\2644\225\0255\013\030\206\230\231V\274\024X6T3^R\3168m\373\267\016dG}\034\204m\207\203`"
+	.string	"\273\213\340\177|{\3603\016\275\341\350\263C\237#\035\252#\300\360\370\350\310\023\305\252\212\275y\324U\330\177\273\273v \333ju\003)&RdWb\264\262%pD\303v\307\236\374\215st\214\275\355B\223B\242\210\020\321\356F\352\002\322\341{\200t\350,\216]1\377\035\177('$\231\346\271Z\022v\327\232i\023\267\273m\003\333\007\266C\001\007"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"\357\232\227\205 \303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getMAhDrawn.77.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"b\21634`O\322\001|\0010\340\002C\271\020d\244@\2271[\203\202\240\203\nFkH\333v\210\310.\332\356\311M?\f\207\005\206s\001\240O\313\342\377 {o\231R\316\\6\223\262,\314B\254\246\2544T\0255\f\230\206\230\231U\274\024X:P3ZR\316(i\373\267\016d7}\\\204\355\207\213\\\001\273\233\340\207\\\203\3607\016\275\341\350\261C\237\023\035\252#\320"
+	.string	"\371\350f\311bu\305\326<\352.\354\277u \333ju\006\024&2ewbc\331\022H\302a\273cK~\307=:\276\236\226\221E\241\026\211\021\225\335\215\323\007\242\303w\201\350\320a\374\272^\376?\376PN6,\363\\\001\024v\327\212e\025\267\273\355\003\333\b\266C\001\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.101.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\001\002u\020"
+	.string	"\226\035jH\320TQ:\302v\262\004[il$\026\206\001L\363\2726t\204x\0201+\346%\016 gA\027\274\247%\353\025\304\377\207\213z\3305\201\205\022;\200[8\310\337\236M\"\331\271\331\0038H\002\353W\200\337n\262eJ\001P"
+	.string	"W"
+	.string	"S"
+	.ascii	"1\236\363\372\254e\222\335\024\266\235\3351\305(\335'\202\023"
+	.ascii	"\b}r7\t}\252\355\303\260\355\n\341\227M\344\243l_\003\"3\343"
+	.ascii	"\266\273\336\247\\\361\327\245r/\377\265\223\304h8\\\002\240"
+	.ascii	"\031q\035pN\264\262\273\356H"
+	.string	"\334\363\266\033\330n\261\225%k3w\270\260\3412k\005f\246\003g\253\031\202s\333\230\361\3044^\303\305,\003\243L\204\b(\210\007\234\333\356\350}z\354N\273\332\267\313eX\362\030\031\335\247\271\374\232G\266]\237\265T\302\302J\234|\372\264\227=\372|qKgblvwA\201\036\b\252\037\375\327\361\035\323\007\202>bE\244\312\313\034\2613<\307\251\333\335\222\217\343\266\026\277\305\247Q\241>\026\312\004,r`\032\344\327\376\017:5>\253\376\215\353\217?\273#\300\364\307\222\223*\354s+ol\221\232\013\251\245H\255!\365;\005&JN\354\202\b\002\n\326\360apPR)\2510 \231\250X@\324\211\302*\005\212\"\353\023\340\217\364\"\202\253\225\351\202\247\022CU\nTy\251\223\t\345}\242\312#\035p\270\001\024\275U\030\212\236^\336x\302\013!0\t#\271\224\377\350\221\222\253\360\036<d"
+	.string	"\035\024>\253?Vi\033\345<\026Jd\273\373\300\001+ \200\202\031\263\362\303\367 \247\002\262,\313\035Ga#\206\376\t\354\324\270s\036\332\303=\336\256\205d\315\274l\334\364\245\250\213\215}\027\240\327\377\336;\330\332\301\235d\302a-\323G\306?|G\211\177\343\342\\"
+	.string	"\221a\232"
+	.string	"\230\324\032\007\205\231'\3372\250n\306\342\262\264"
+	.ascii	"\200\274\240;\375\246\237`\306"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.115.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\216\0045\034"
+	.string	"\306q\255I\260XQ:\022\016\307\203O\037m\341\263uGg%/Jm\306\374\256\235\006\312\204\345A9\322\255\037\036\375\327j\265c\266ES\372\336\246,\314\344\376m\354\354\263C\r\025|:\0214\207#\353\200U~#\215\220-wJ\001\222"
+	.string	"\233"
+	.string	"\226"
+	.ascii	"?%\r.\232\002\271\244\263I\\\311\245\225\246\036\265\326r}\244"
+	.ascii	"\235\237\344\322;\323\370\202\025\030t\244\235\362\342\200\250"
+	.ascii	"\t\366\203\027\342!\311\023T\340\247\005\305T\255\265\346\242"
+	.ascii	"\031\220\027\203\354\202l\373?\016d\307\036\322 \r\340\265\234"
+	.ascii	"\360Y\242\252\265\276.\322\234\300x\221^f\274\2703\276s\272S"
+	.ascii	"\334\361W0\332\003K\223\037!\236\323\025l\370\371#\304\342\033"
+	.ascii	"@\310Gij\255O\3724!\324\233S\300\305\025\254\326j\262\305=\336"
+	.ascii	"v\005\333+l\372\".xs\314\334\"\257H\353\312\260]t\272\244\323"
+	.ascii	"-:\315\242\323$9\275\242\323#\235\026W\323\224N\3578=\307\351"
+	.ascii	"\007(\260\240\252V\2401U\225HD\202\343H\237ALz\312\024\265\306"
+	.ascii	"\266\256,R\262\263\bX\257D\017}\362\005k\220<\t\t\2138\020\244"
+	.ascii	"\241bU%\305\347\tU"
+	.string	"\255\301\327E\007Ij\177\207\204\376\322\207vi\335\225|\"7\362\247\325\220S\023\222SS\202\236\020LE\214\230\212\314\024\325v\225H-S\\\211\002Be\240\306\004:/\324}H\005\312,\271\bgb\355\205\247\341M0&w\\\326\256\323\017j\265\344\"p\262p*\027\310Z\353\215?\345R\0302h\3200^\\\355\305`9\022ww\334\377v\364\346\030\323\025\367\277\251/\335\231%>b\346\356\3220\277){\303\245\304\310Z}7>\224G\221\371\300\213\236\341\340\214\027\347\206\341\021\005#\310Q\313I\214+\375@^\216\200|lqA\351\220\252\023\214\367\263\326\312\263[d;g\374\272n(e\361\315/\366\235\034*\307\007\332Cm\376\2476^\374B\350\"\364\021\246\321prht\204\355\303\232f\203\243\345b\265\227\216\255V\263\311fr\265\330Z\326!\302\315\203\233\007\016ldn\263\0171Y\005"
+	.string	"\226\331\350n\263\\.\306\341\205\273\331p:3\334K''V{\311n\270\227\r\002\333@\314n\257\234\315v{\225\266\347i]\031\236[n\355H\224y+w\255\t\333\256\225@\304\333\236\237\364\026\224\221\324\302|\341\237tV\225$\325\313\024\217\322\326\226;v\251r\326\266\326\363\307\2457|\213\311H\352\351\037b\312\201\242\306\226j\003\306\023\"'\017\357\351\253\225\247 d\250\201L\304\fQh\206$\022Q 1\214\001\200\002\241\242\";\021p=\225\264\260\220\215}\003\254\253\324\261\304Yp\342g\265R\342\207\240\373;Z\235\021c}\320\3028H\204-P\372\214\3040\322\230\017\n\003\004e\366\367\353D"
+	.string	"\241\355\253\241r\023\023W3\244\342D\211\3447w\003\"\375\036\252\370u\r\022\316\372\350\bu@\210~,\332<\245\211u\241\233R\251\226[\311\375\334\361M\371\351\020\304\346=>\006\344\246_<.\025@"
+	.ascii	"\fdV\307\n\\\355$\251\241\312\246\013\t\237\230\006u\236\205"
+	.ascii	"\204O\231\310\202YsBr\352G`\024T\367\223\316\177\225`L\033\203"
+	.ascii	"O\273\357{\277\323[C\241\346\326r\245\320$\344\331\347!\206\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`q\004m\022"
+	.string	"f\034lI\300\226M:\350\377\2150\335j\2161\206\300\3240\005k\274\234\004\210\376\005_=\021\305\321\366\226G$b\335?\352\005\276\247\260G\220\030!F\210\347e\350\264\030kk\333\324\3553\216\025\001\376\331\346\327\271\325G\243\335\344\226)U"
+	.string	"Z"
+	.string	"Z"
+	.ascii	"\266>\016Y\353\037\311\225V\233\275\310N\326<\340\227dXm\304"
+	.ascii	"ZG\302^\257\376\024is\"\001j\030\212\256>\024Y3\343\335n7\205"
+	.ascii	"\240w\344\201\230\001\333\374"
+	.string	"\211\002\260\027\331\344\177\305J\2006\377{5\fk\215\277\177\245\025\253\252\265\326\001\335#\377O\022\001}\250\225\360\031\3416\177\023D\270\242\021C\020p\346\037\204\013\022\201\023*\022\"\n1T\"\366\025Q<\310\231\016\372B\032\364\2030\350\003\001\352\377X\320\367\241\240\337C\376\364y\370\264\217\354\351\347\340\351\357\220;}\035R\347Mf\316\231$\270\023N\177\244\340M?\351v\244\031.d\037\257\304)\327\307\254'+-^\345V.Q\201\202\341j\261\227\263i\361F\355\312H\321\342\351\325\342\225'\356\0361\0355\325x\f\242\217\344C?\211\207\276\222\016\375%\034\372N6\364\2374\364\215d\3503a\3507]\350\037\261\320W\252\320\037B\241\257\333Z\353\017`B_\243\335\030U\244t\036\ro(3\303@\253\372\f{F{\244Zk\214\fo\322J\026\f\323\210 \345\030qF\031f\244Q~\311\255"
+	.string	"\247\031,j\224]l\224[r7\312,Q\373(*\244h\334P\336\027 e\227\021\366q\313\030\373\230\005\374\2305\356\245\350n\004M\250Q\b\004\202\271I\nK\332,k\320\002!\242\242\003\021\260\020\006\r1\002A$\224\2000\314\003U\221\204\235\245|&\323>\026~s6\337\3462\243G\336S\354qD\232\246O\017\340cK\350\225\244\310Z\266\372\2233\022tO)\f\315\303\205)r\240\333\373rp\023\024z_e\244\247\313e\331\263\302\257\n\206\316\256\236\032\266\033\007\203q\020\276\325"
+	.ascii	"\350l\211\352l\262\263\352NYJ\243j\r2\017\204\314b3\355\017\263"
+	.ascii	"\251{\264\261\334@\260\t\212\235m\025\265\221\316U"
+	.text
+	.section	.gnu.lto_.refs.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"]\t"
+	.string	"vYB1P\205(\351\f\303T\226e\254\250\231\231\231\231\231\231\231\231\231\231\311B\005\304a,\032\241\300+\240?\230\002=a\177\304\266}\322Zk\244m\262e\n0"
+	.string	"4"
+	.string	"8"
+	.string	"\257|\221\267\374\266\247\365$\365\b\237I=\361(Oh\3267\355\232\3473\370\227\366\312zJ;$\377\361|\003\237\321>\345G\353\031>\366\253o'\375\002\375\tP\377\200\247/`\365\003\264>"
+	.string	"\327\357\264W<\235\223O\261\272D~D\353\017\256;\264[\362'}\227O\345?\214_x%\331QO!.!\006\020\006\317 \371\312\303#\371/\322\247\310\263\207\2576dz\222/y8\304\365*\177\201\370\364\364hu\326\236\255#\324\307\364\343\270\201#tA?\001\243\217\340@\373\rH\001+\340\006\023\027\226&\323\361\215\351\330N\270t\304-E\350\022\324\241>s\317u\207k\345:k\217\371\001tC\276&\037\203O\275\207\362\263Magr\036>\361\360\013"
+	.string	" \004p?\245\271\247\373\273v\031\274\021\263\243\361W\320\302p\231"
+	.ascii	"uK\204W\301<\003"
+	.text
+	.section	.gnu.lto_.decls.dc27ee09143a3f37,"e",@progbits
+	.string	"(\265/\375`\0302=\326"
+	.ascii	"\252I\245HW LA:\351\366u\323s\244\372\303\305\233;\213\f\001"
+	.ascii	"L\2164t\324\353\357\364/D.f-\315\354\352\337\355\321)<\362\274"
+	.ascii	"b\024\3070k\340\021\264\366\2217\300tzuT@\350\267\023/1\253y"
+	.ascii	"\301aH\346s/\363\256\312\360\r0\333k\025\214\335\216\275\245"
+	.ascii	"L\001\262\003\201\004\260\004\032X\351\252\353\343`\357lOI\036"
+	.ascii	"\207a#\223$\254\311\030\266r\004mo\213\037\273\300m=Q\347U\216"
+	.ascii	"x\243\373\215\352\330\216\233\\#\306\256\3541\032N\323\227\377"
+	.ascii	"\370\005^\303gX\r\0072 \237\354\307|\3472l\346\365\274w\212\203"
+	.ascii	"9\266\322C\357\255Q\027\266\301\025\272\256\272>3\366c.\354\205"
+	.ascii	"\233j\"\230q\333c1\032p\300~\254\307Vz\222\347\315\372@\255\253"
+	.ascii	"\356\303\007\242\017\037>|\b\232\251\272\201\206\250\362\222"
+	.ascii	"\207\202\030\350\016{\312\302\236^\373\316\263o8K\304C\301/\f"
+	.ascii	"\206\247\t#\217\355\310\027\036\214\307Xft\024\351\372\336\262"
+	.ascii	"]\002\355y\214}S\213\375\036\017\005\331\2569\0137\317v\214e"
+	.ascii	"g\212\355\352\275Q\314\026\3640[`3\027$jI\260\236\351\354\271"
+	.ascii	"\211}\037\373\260<\205\251\360\331\201\253\\\003\016N\223J\256"
+	.ascii	"\031\317\032#k\376n\330s\207 \007r\207\340y\313\376\260"
+	.string	"P\224\016>\347\013\254\034P\342X\r\313\016\270\256\347&j\334\326cs\357\262-\354\336\363\f\307'\307\361[\237\367~\203\337\350\034\307n\334\306\001\305\275\313\032AZ^\250\022\353\273\367\374@\364\241G\214\336\217f\260\036\003\366%X^c6>=\360\223\263\023nr\233\250\363\236\367\236>\375\005\270\266\244\353\035`\317\036\20240\220=\004?\3026\013\005\177x(\3703\023\017v*\312\0233&\233\361\022j\265by\325\356=\201l\226\\9\022\325\225\223\360\031\237\234\306J^\225,/\363\336\223\207F\275\300\002\327\265\002\036\nV\026\n\356\b\317h\367\271\273\034\2600\350\303\302\340O\036\nZ\026\n\252\251\202\002\nLH\b\372\233\254\013\001?_\020c\203\237=\300\b\321\202\026\340\177\334\326\005\312\007\177j\201\t\214E)\300\240Gx\025\352\3633\007:\204\341\222\237\001\377\246\177\223\330\3207 \374\315\303"
+	.string	"\241\005(\200\004\017\2753\342o\004<\203\277\375\250\272\203\346"
+	.string	"\203g\370\251\320\317{\307\353k\021\177]J\340r\341\337g~V\2417\370\351\274\237?\360\267\321\337!\376.\372\033\304\337\037\376\306\340\357\013\376\343\374M\346\365\357-E\276\032\341:?\325\300\341C\177km \t\002-\200\266\340\377\333\211\032"
+	.ascii	"\377Q\370\217\301/\370\333\256;4\207\377J\236\363\267\216\237"
+	.ascii	"3"
+	.string	"\320\024\374G\373_\005\311\317]z\202\237\301\364\206&\372\331\001\255\341\034\336\341\357\026\376\243\371\377\302\177\277\377\201\377\323\374?\363\037\360\277\231\377\177\377\327\374W\363\363\327\377\274\377\\\376g\201\362\363\334\317R~\226\373\031\356\347(?Si\263\237\337~n\353\241\377>?\025\373\033\303\337?\177\367\374m\377\256?\003\376\374\367\263\337\317|?\357\375\254\367s\230\237\361~n\376\\\367\363\225\237\253\374\f\344\347\256\237c\374\f\343\347\026?o\375\254\374\031\353g\025?_\375\\\365\363\360\347\251\237\243~\276?\213\340\347\020\374\f\202\237\221?{\340\347\342\317L?\237\370\331\304\317\030\3709\351\347\024~\336\300\317\032\370\031\205\237M\370\271\204\237I\370Y\002?C\340\347\021~\016\300\317\"~.\361s\b?\223\370\371\346g\3733\b\377\237\374l\364\363\002~\036\361\363\007?{\3603\007?k\360s\321\317\006\370\271"
+	.ascii	"?\013\377\237\360\363\004\377'\360\263\206\2373\374<\3643\320"
+	.ascii	"\3179?\343\374\314?\377?\224\377r\377\231\377\227\374\277\300"
+	.ascii	"\177\272\377\033\002\003\003\003\177\213\302\217c\177\013\200"
+	.ascii	"\004H\320\344\200U\241(\243\245<u\270\254\334\316\300\354P^\231"
+	.ascii	"2m&(\354\306\211\0235{;9VDI\232\321\242s+\336\372\270\354\220"
+	.ascii	"\231\275\346\333k28W\311W\001`\034\316\020&\231(d\032\315'\312"
+	.ascii	"\037\226\027]\217ce\201Z\b\337zzM\213\306f\200!\354<n0\235\327"
+	.ascii	"a\270\315\3368\253B\307\331\236\305\263\267s\366\314m\301\fX"
+	.ascii	"^\356\245\325\354%\242\302S#\313T\f4\333>\204\357.]\224\334\254"
+	.ascii	"\034\024\315* v\374\322\374\362\210\330\037\246\360\355\302\331"
+	.ascii	".\260\225\032\024\022\247\223\"\020\217,\207]\337\331\265\026"
+	.ascii	"\f0\3045\373\256\331ZF\350 wR\033e\200I\272"
+	.string	"j\201\303\341\372Rv\275\255\262\277\331b\233\206\360\215\345l,}U\243\224\334\255\034\024qk\306\372\356\345\002\221s\206F\305m\211\375\224)M\027\274\227\317e\226\222.C\033\225\276B\245\255\330\344\275DH\342\270\2048Vec\177U\336Vz\314\346\366\374\272\376L\0139\232\373\321\327\3657`\3667[\366g\215\360-E\312y\203\302fh\002\005J\224\260`\030\373S'|\307\305q[\r\302\355\341\215\365\361\210\251\302\224\232\263@_\302\367\333\371\354\267N\263W\367F\305\020Av\271@\360\222+]o\247\375\211\023\276\333\316n\3436\020z\2000d\315\336UV\001\261\223\342\306\262\313\017\013t%|\263\2615\332\bq'\210\007i\330\fU\302f\322M\336N\316v\322j\314u\223dD\234\271\\Ja\253]o\347r\260\271\033\002\026\224\262\357?x\243\224\367\336-\233\363*\245v\202l\303<LY"
+	.string	"\227\376\024\214\340\336\244]\0173\266\005\270\250\256Wpm\232J+\246W\022\004/\255)/\030VL\257\233\234\002K\002)\257W\322\212y/\320\235\232J\212\260\274@V\314\253uQ\334i\361=\275\222wjy\201\356\324\215\252\300j\312K\313\212\031\245\005d\305\364\322\272L\257\373s\247\242\224WSW\tt\231^d.s\251\365c\305\\jY1\275\272\230\315jL\021\255,=p a-VS\227\005\254\031Q\312\237\246\325\271\274^\356e5\252\253\024\300\2753\226J/Q08N\252\311\202T[\324\222\317{\357\006,)\034\313;\325\264\032\262\274w\210\324\211\213%\"y6\257\017n&s\314\270+\250\356\235"
+	.ascii	"\353\336$\337\346\2757y\357\275Q\3168\357\225\361c\025\206\205"
+	.ascii	"u/\027\021\326\235\221\224\243\272\267\325\276\304iY1q,\215\344"
+	.ascii	"\2320\303n\325\231\344\260\353\305Ki\231\311\264\273\242\214"
+	.ascii	"\r\323b\301\327\365\354\t\026\001R%\327\325\222\211\361\370\353"
+	.ascii	"z\262\311\250\343\321\265O\036Cr\275\274-\3513\036\035:(C\002"
+	.ascii	"\321\314|p\272\224\241\241V\304\376x\021\276\217\234\317>\322"
+	.ascii	"D\210~\356\305q\025f\343\203\254\313\306\270I)\362\202\254\b"
+	.ascii	"\221\234'TN\265\256C\210l\230\f.\033]oSe\177\312\b\337ag\207"
+	.ascii	"\365\230\360Fm\215\020[\342\215\365]\245\022D\213]\242\034\256"
+	.ascii	"f\227\345\025\373\352&l0\237\235\250\027oZ\230\r\244a\250\030"
+	.ascii	"\333\352\372J\326_?\354n\220L\301\241\346C\007\316\331Tfu\375"
+	.ascii	"\006^kf3z\331\203s\257\327\2230V\322:\372F/{\246\316\253u\343"
+	.ascii	"cy\307\327\3677\217\336\321=\370l\035\215\343\235\203\267\324"
+	.ascii	"\032{B\256l\335\251)\354k\322\236\362\331\246\3215\370\374\\"
+	.ascii	"\333\300\231:/\323\007\225\244\217/"
+	.string	"\026\0047\237\013\236j\351\222\021\254\262\301\264\223\3211\016\327\313{\333\354\325\031\3004]\371\362\020\227\220\307\257\213T\031\214./\\\f\341\350\003s\3617\213n\321Z;\313{\247h\227,\262&]\373\362P\260\202--\366\022F\243N\253\225HZ\354"
+	.ascii	"r\232\341\310\375\021q\321\265\261\232\205wV\257\270\235%byo"
+	.ascii	"Tg\371\250\2717\312\207\331\002f\013\352\021\034B\330\202\365"
+	.ascii	"\264N\305\227\024}\245\002\027\327Y\327\367U[\361\362j\350a\301"
+	.ascii	"\244LF\327F\321T|n\350*\346\353!\245\325\365T\212%\301\275\274"
+	.ascii	"!\310\201\201\274!\330RF\357)\241\240\222\353\274>#\276r\034"
+	.ascii	"\351J;j\303\r\231\234\215\035\235\364\323\242\245'\245\345\216"
+	.ascii	"\355\002l\227\013\b\020\013\033DW\225UI\375\210\2224\357\370"
+	.ascii	"|\354\262Rp\005\332 \270\024)*\013D\313$\237\020\t\316\224,+"
+	.ascii	"|T\026*VWX\033\222\256u\305N \336\0264\275\252\342g\212\r2R\251"
+	.ascii	"*U\265\342q\207\203\257\217\307n\013N\253V\275Z\261\335\031&"
+	.ascii	"\315\263$Y\262\324\244\021\263A1\002\003\353\224\362\216\257"
+	.ascii	"\354\n\026\213\274*\365:\245\307\202\025.\267k\215\352\245\205"
+	.ascii	"\362\205\f\254kMV\261\2721z]\353e;\313d\021\204\331\313`\336"
+	.ascii	"\220\033?/l\220\024  \365[\336\361\225\361\354p\303\243\262\306"
+	.ascii	"\n\315\370\373k5 UU\312\354\336\305\263\361\305\n\2510c\206\372"
+	.ascii	"}\tk'\201\311\027}\247~\315\245\311\005\215\016\216S\252I\321"
+	.ascii	"\320\027\204\340\335!\031\202\023x\246\310\334\231\306a%\211"
+	.ascii	"\215\273*Vh\212\217/L\330\226\036gVL\033\004\270\267\327j\f\270"
+	.ascii	"w|e5L\022\255\t\020+\004\247\247\327jA\302\202g<\366\302\\X!"
+	.ascii	"#yy4\f\377\234R[\300\302(\221\030X\252\300\234\206\261?\266\334"
+	.ascii	"\351\350J\277\264\021\256\202\326\243\315'i\205p\334\375\216"
+	.ascii	"\342\021-\351\226\037UU\312t\276TH\345\350r\212\307\303&\246"
+	.ascii	"\310\031\312\345)\304\344rpq\201\255\206\326\226\026\253C\244"
+	.ascii	"x\265u\335"
+	.string	"\302o\301\2652\177jc,\020\2370K\026\332d%7\213\341\322^\310\"l\031e\262\374\260;m\256\241\"\363\244\203d\360\345\013,\3162\027\341i\035\255\353$ \250\335(-\241\025\2552g@A\232d6,\320\230\360\364\n\275\322iu\nL\\P\007\340\2145]\337\263\302\0021\001;-\343\223\202\321*FR7\312H\006i\\@!\243+\225\033\0251\236\250\231!\241I\274\354\235Q33\2734\272\244H\335\036\023\352\306M\256\237;\365\026fO\216\242Q\263\236$\320\2759\262\204E\241S\350\034\205B\343\250\024>\251\034e\236\032\241GN\304M\250\034=\271\215\233=@0\303\242\323\345\214\220fOEr1\034\244\254F8\373\342F\233\3206nr\235wK\307ML\317\314\033\205\343\223\272\235\350\274Wm\003\317_^\337Y\260\355\311N\\\212\256\252\256\224\215\231t*r\274\251\361I\327\252\306"
+	.string	"\301\272R'\027s\225L\241\342s\325\205\034\022,O\354y\230\330\363\224Q%\226\313\036\215,c\366<`\366<>\354yn\330\363\314\260?MB\315\230W\314d\241fl\245\267`Y!\325\365<\\\266\205D(\231\317\221\270\035O\212\220\360\303\356I\327:\244\351\204\204a\265\320\343\005l-m\314\346I\240\231\030]\251\230\245\342I\341!\207\306\233\215.!\264\006\r\013A  \232\256\367\302C\301\316at*D'\313\224=\2642\026\350\t\245q\372EiP #p\335\255\021d:*\206\3008O\242NJ\325\251\351JyP\037\364\307\217\203\023e\305\226\031`\354i\217\234\036wA\210tm\252\343t\307\217sc\246\234Z\353bOq\320\034?\016\005\254\213r\225\305\236z\225"
+	.ascii	"\314\r#]\351\rK\265\003\347\001\347\213\0221_]Oo\374t\311Z:\213"
+	.ascii	"\003\275\242\213kL\327\036\026\n\322\032F\2476Z\210\032\035]"
+	.ascii	"W\236\0351+4\245\253\013\220^\205\211\242E\207\025\272\213\021"
+	.ascii	"\203\302\350\013\363!\205M\217\205\025\322{\361\202\302\bcs\222"
+	.ascii	"\3219\201\321\313 \212\263\036F\272~\247\312\n\245i\321\202V"
+	.ascii	"\005\261\333\263S`pAR\306b\240\242[t\213*G\020s%,8DF\225\032"
+	.ascii	"t\026\303\026\315\242YT\331\304\315\rDY\2319e[\316W\032\325\215"
+	.ascii	"5\213\241\006\305\242"
+	.string	"XL%\016o\254,\307\310\215\026i\210\330\241@\252\202\252p\202e\257\247\231\346g\246\353un\330!zE\2578\020S\352HY\f:(\325)\025\255\302\271\227\314\005Q\200t\221]Z\305Vt\362\264\312\222\330Y\233?\341\351\024\235\252\272\321\302\032\352\".M\255\005\253\263%<\215\342\223F\265\f\020\324\226Qb\036\264@f\254NG\357\n/H\327\347\254\260CU\302\006\344\016\004\244\267\223\330\244\322>\371*\303\371\263\307\361b\317\235$\210A\214\232\253i+\366\347J\201\351\021v\006K\013\356\315\016\335\245I\243\200\265\253=\237$UT\234\022\013\324E\310F\270_\340\263_\350\276 e\004\252\322\354]\345\f\020=w\312\274&rxN \207M\305\245\241\021\211\263\204\204\nQtjj\232@\203\r\236\232\220l2\020\217\220?G(&$\322\311x\002\005\r?QD4B!\207D\0237\023h"
+	.string	"*!\002\t!\246!\024\322\270T\001$\r'\216D\243\211\fIC\242\t%D !\004\364\023E!\234\2264\004\177\242H\002(<\340\204\020H\242\222q\210\254\240\003HNL%\210F\247\022>+<9\225\bB>A9\031\225\232\206\306\341S\b$\002 \025\241\032\200$\036u\212&\332\346x\264\203<**=\331\024\225\236(1\004K\307z<\022\215II\303\233\025\236\234\220\252\021\371D\317\263\202\021y\\R\"\232p\224D,*-1\ro\222\210G\250\212D<\336|\210\034&!\217\224\236\212z\216\236\232\210( \211G\242\tJO\035&"
+	.string	"D\002IT\322\021\322"
+	.string	"tl2\016\231H\034;(\025\227\210&,\231(B\005\340\2504dj\200Rq\251\3118\324\371\211\242#\223\223\021YtB:B2\206@2\221T\034659\225@2\342\374dP\224DDZR\301H<\001y\034J"
+	.string	"9La)\250\004r\251\370"
+	.string	"\235\243\220Rq\311\210<a(\004$Q\311\347\307\307\250\250\002G(\247%\025\210\306' \"R\t8\310\"\224S\t&&\342\017\207\341\261H|jr*\221\264T\002r\230\002\023\024\022\323\020i"
+	.string	"?Q\024\"\211i\t*\205\rJP)\020\223l2(B\032\207OE\024\354\204\020\002\024\021\323\020i\t\271d\314\320t\002\206\241\n\020\221\303\244'\nl8\322\222\221X$*\331\213\350\340"
+	.string	"\035x"
+	.ascii	"\202\233{\360A\006\037d\020\274\007\037\030\031}\320\201\221"
+	.ascii	"}\007F\024yDD\016\221'\354\020\217J\210@\342\004\344\221\220"
+	.ascii	";\310\243#\005\210MKHK<\"&9M\300H|\"\022S\330\371\211\242\036"
+	.ascii	"\213<\022\221C\t\020\225\206F\342S\323\260\007y\244\301\006\305"
+	.ascii	"\017\f\215\"\234 \321d\215\303\023H\365\346'\216GJK&\212N \030"
+	.ascii	"\026\227\232\202>\220\201\211\211\210\204,\022\217D\343\023\322"
+	.ascii	"\251\270\201x\024D<\302@D2B9\235"
+	.ascii	"\200,\022\215F(\244\240\025\220KH\303\247a\t\037\3440\204\n\020"
+	.ascii	"\217P<LNN!\034\331\034\221F\"\023\211\022\304#\024\206\"\021"
+	.ascii	"\311H,A\251\270T4\016-PtZB>5A\035\213NH\034\220G\036\334\034"
+	.ascii	"\227\216\307\025N \207)\250\320\363\023E\035\356\364D4\206@:"
+	.ascii	"9\031C\350\034\217\214D$q\002D\245!\222\311I\205\036\213<\352"
+	.ascii	"\300\bY\\\202\262ID#\021\311\264d\242\b\225s\244$\004t \242\003"
+	.ascii	"\021FEBO@\002JT@\001\022\034`\221\212V0\022\221\310a\n!\216F"
+	.ascii	"\247c\221x\fQ\\\0326\205@2\036C\024q\270\206\030qu.\256J\021"
+	.ascii	"\021%*\312\253\024\270\"K\304\310u\255P\016\227\246CN\356p>o"
+	.ascii	"i^\276\340\210\274\031a"
+	.string	"[c3la\253p\225\255\276\341$o\324\330u\325\275U\267\232$\271$Y\335j\233W\231\030`\372<}\324(ar\251O\230\217\255\274\3051\331\263\032\336\230u\215Y\325\f\200v\007v\305\311\253\332\234\rU\0303w]k\223\317\375\255\241\271\320\2652\371\334\r]\026\0346\200\236\330\277.i-<gj\\uJ\352\224\216\f94ki\325\312\307\313R\307\212\263\262p\307\234m\241\325\026h\250@\241:\353$kzM\025]3T#5I5R\315X9\202\f\312W\\\337\345j!\374+\222W\263\2515\256\265\256\365H'\371\026\031_\360\200~\234\314\235/lvg\310h\225\016\330\t\005E\327S'\256\306Z\013\"\324\217&\333\262\350\206t_\213\355\270|\265\205:F\226\226\203\252\353\353\330\337R,f\252\352\250\361\305FWvb\364*F\343\246P\251\t\023r\244%\306\245\353\253\220,\016"
+	.ascii	"\006Qa\327\265\0061z\005\003\200\333\234\\\327\233\n\244~\245"
+	.ascii	"Y\275P\277\376\352\243\376\330\371\341\202\205]\327\253\361P"
+	.ascii	"\020\007\211\321k\017\237-pg\300x\324\035/P\244\325\035<3\306"
+	.ascii	"r\350\350Zs\030\275\352\260\211Aw\343\253\253\016\013\005\263"
+	.ascii	"\262\276\226^\334\006\003\305\237\rZ\202j\243\353\215\272|\265"
+	.ascii	"q\237\033/eVQ\301\032\264\331\204\f\214\032\215F\263n\314\274"
+	.ascii	"\0243\350\272(\336\016\236_\2324\031=\226\203\343\013\036_\f"
+	.ascii	"\032\246\307E[\027\017.\265\272\026\243\007\016\030\235\246\306"
+	.ascii	"mL`}\001\304\305\326\345\3225(L\335\252[\265\205\2300\332\002"
+	.ascii	"\032\270),^[<\204M\2503\223\343\201X\270$\031b\n\321\b\315H\223"
+	.ascii	"4\006\263\024@ XT,\233QW\271\007\023\300\224\t\004z\226E\235"
+	.ascii	"16#I\222R\333\001\026I\347\004\236\n\372\\\301\333\315Y\025}"
+	.ascii	"D\336\270\002\305\032 \260\371\274%\302$/\337&\205>\275,v\232"
+	.ascii	"0\031\032\001\320u}UD\330\250\f\255\245\273\227my\303\373\351"
+	.ascii	"U\236O\035\244\226N\370\362\177q\272\354\023F2\216\317\257\t"
+	.ascii	"s$\227\362\241\031\2264\365\007\341\370F\271]f\312\223\032\347"
+	.ascii	"\002zO\333\363\252\372\331\273\352R\204\004\274\355\003\256="
+	.ascii	"8d\037\246\tJ\220\324\216\f\304\374\256\214+\341%\030\251 \331"
+	.ascii	"G\262\201\306\252Wp?\352\213Q5\225w\226i\200\372h_X\312\\j\177"
+	.ascii	"\214C\020\342\254\332\005\306[\266\300(\375\267\036\035\036Z"
+	.ascii	"D\313p\272\213\374\260\317h\257\321\336\316KBV4\032\217\205\r"
+	.ascii	"\316\233\023\306\260\334\213\2367W\266\017e\316\027\207\262\001"
+	.ascii	"\343\n\340\017\361\206H\345\347\223\3179\317i\177~\247@\003\352"
+	.ascii	"XR\354Z\221\330\201\226\0205\251\255\351S\324\320\263\335R\314"
+	.ascii	"\217)a\263\313Jj\215K9 I%\024\260:\265\246\242\277\227\263\216"
+	.ascii	"I\215+j\032\t\250\206\034ck)9\311\230\034?\001\356\263\021\245"
+	.ascii	"\311\250\b(|\321\"\210B=\231q\354\005\254\210\375O\370<b\"\325"
+	.ascii	"r*\022\224\256\277\214\227A\243R(\274\355\206\rU9\300\372\222"
+	.ascii	"\261Z\227'\032X\274YM\251X\245\357\315\021\320\200<\250\273\235"
+	.ascii	"27&\261M\356\324Q\256+\027\027\031\241\232\3201\313\202\n\377"
+	.ascii	"oK\216\336\326\342\2000E1;?ed\b/b\031\354\r\004p\025#V\231\027"
+	.ascii	"\3736\275@\345t\0248\244E\027\004\310\377\300;V\315\224\017\223"
+	.ascii	"\372\252K\331\230\327}\220d\2674D\001!\025\244\332r\0300b\032"
+	.ascii	"7\303\257\367\257\356\273S2\300n\253z\222\003\252\223%\340MH"
+	.ascii	"E\210\334^n\252\360\025/\352\231\275\245W\347,9GP\n'-*MZ\302"
+	.ascii	"QP\200\200{\034\n\340\tL\017\036}u~\360\215\260G\346\266Wa8F"
+	.ascii	"\254\375\022\313\356TT}g\274\273E\037\323>U|\311\026\204\362"
+	.ascii	"v\177\265pR\205kS\203\n\376\326\240/\230V\226|u&\304m\b\327n"
+	.ascii	"\273\f\373:\227W}\036\344y\334a\273\244\017.\274\334u\244\257"
+	.ascii	"\233.\250\203\351^\363{\312\002\212*\214\002\363\3566\274\210"
+	.ascii	"F\001J\0166\363^\222\013y\200\301\323\276mU\t\225(\225\234u\033"
+	.ascii	"TP\007\255\bTm\021\022\311\244\266\326\244\323\321X\250\006f"
+	.ascii	"d\307d\301\255\t\0209\323\013\333#\362\301$\307\266\237\241\354"
+	.ascii	"h\350+sf\306NY\341V\023e\032\314B\252U!\301\351\304\263\207x"
+	.ascii	"C\021\204\275\024\22798\226\026Q\272@\021\366=`\262\324\260\205"
+	.ascii	";\316\t\350\005\264d\212\264'X\347\234e \217\002Ug\235\001*\006"
+	.ascii	"\236Fn\253@\215Xo\327\250\200\330\f1\220\206\343*\332!="
+	.string	"\325\246\234\375\202L\300\211d\362\025\321\365\346N}\244\271\301\332\260\bJ\016aa<\331\237/\r\321\022l`k\355\277\211\301s\325\335\300\025\363I\016m\343\306]\243\030\003\231\324\322=\36496\323H\232C\024f\242\252C\t\r\373(\366\nw\305\006\243/&pv?{^V\354\004\375Y\005\202\311\nz\367\221\364D\313{\357\330\r[\215\331\327\032\021\024\241\333\375r\377\375\270\320\375\224H\b[\237\273sb\251D,\006\3005q\270\024\210c\333p?\301\342\203\315\363\2461B\236?\211\337\360w\223\246\023\334d\240\365\3545i\360\nP\212fb%\220\364..\003\345\201\022]\305\232\007B\247\247u\335\317g\327\351OD^\020\316y\352JK:\377B\333\217\nFz\002\\j\247\374|\300S\\X8\311u\331Z\001\034ddO\325>>s\340\312\271*\201\204\253\234Y\267\371\r0^\222\350\246b"
+	.ascii	")U\005G\205L\226\375\355Ja\356\\:\361\324\211q[\330R\270\367"
+	.ascii	"\355\335\230\343`\271\304\303#\203\247J\235\200kC\353\352 \336"
+	.ascii	"\256\315\266\241\250\264p\007\373\261\216#\256\321\301\324\366"
+	.ascii	"\242\n\363\327ITfd\360d/\353i\361R[H\032p0.\003\023/\320[\353"
+	.ascii	"{AS\275\265\206\226\310\301\002\353\\/\253u\205\3327\027\233"
+	.ascii	"\233\245Za(\363\b\b\357yZ\356Kr\365\330p\255\3635Xkvj\356\256"
+	.ascii	"[\341\301\031\234.t\016\006\021\305\230\037\227\263l\307\200"
+	.ascii	")\002\360oU4\nl\035\234\303\373r\235\334K\370\217.i\022\225\334"
+	.ascii	"W\373A\033\371pO\004\277\331Y0=(v\355\367\305;0\036us\225\231"
+	.ascii	"\006\236\244\374\265\204HT!C\233Z\304\027\260K_\037\314\032+"
+	.ascii	"4\001\220\332.\372\300\0277\266\263\212F\235B\032\024O\r0T\350"
+	.ascii	"\231\033Zi\270j\377J<\307*h\257\"WO.9[\300"
+	.string	"\230$\200\2224&\370%\315Kn\3559T_s\f\013\212h\315V\305J\345\3134\320\277;A\241l<v\301 \020\235\342d-\355Z\322\231\016\"\262\305\331\013U\227?k\314=\351r\320~\334L\232\204\252+\247\016Go\265P\271\037\214a\222\004\326\235P\241?\347uK\345\322\\[\331\203\316\244\364\013$\302j\022uN\232\257Z\344\332z\310|WUR\023\253?\252\312\261\217>>\221\225*\016\374\001\303\255\251={\243\363\256!\007u\317\0066\324\f\245\357D\347S(}\223\033;/\316\207c\271\315r\t\212\205\272\264\346\245rt7\252\230\301\2402\361\221\242\277\304\177 V.\212\332\362F*]V\272\203\271\035\342\364\260F\203_|\207^\234\020\267\031\213G\347\203\315Sx\203\350-Kb\3422(R\224\233V\004/u\b\234v\312\210\377\315O"
+	.ascii	"\351\374s=\324)<&\f\223\357\r\360\031\036pc\n\024[\3526\211M"
+	.ascii	"\t@\032\241#\362\002\201\006a#K\207\351\241\243\2277\367T\226"
+	.ascii	"\247\310\343\f5\237\\\237\026\273=\357\303\025K\364\235\343\250"
+	.ascii	"l2\316\013\340\300\301\307\203\226\271o3\t\3565\301o\232\225"
+	.ascii	"\361\325\200\244\003h\253\r/'\260~T\236\r\354\255T\211\323\376"
+	.ascii	"Z\247\304\214\323\252\371\3534\201`\345\240>\303H\331\313\333"
+	.ascii	"\352"
+	.string	"\034m@\365O\005D\\\027ma\351<\221\210\224\246`\347\373\233]}3\266{\226\003\316\204\206\263\272\366\263\ba\177\225S\"\251\366G\004\250\r\035{>\207\271S~\007\022J\307\301\201V\316\347\022\340\310\355\346\304\263\\6\0327Cp\007H|\316\020\034\337\265\262H\221\005\357g;{\267\007\237\026\377KZd\217\321\307\375#@G=r\213\3636T\f\344q=:\210i\253\324/\354\245\304\237\215\365\200\335\355\321\005v\340\336\243\357\355\365~\323\f\264\365>\306\016\233\323\001\255?w~\222\037;\311\373\244\217\035\361\372{F\347\t\340p\272\227\3077\357t`X\203w\240\247\2165\257\255\330\276a\316\375\271n\3153~\337\266\323\036\276\253\214\030\362\350\300`\376\352\006(\023H\334\351\365\216H\017\321\026r\3446i&\3411\210\031w$Zc\305\032o'\r\246\025Z[\303\317\226\225\321i\352\3073'"
+	.ascii	"Y\204\236\351\271F\256l\336*\226o\020\277f\256\300`p\273\033"
+	.ascii	"\266\036\302\031j\232\271Z\004\274\375G\231\262\371\224\360C"
+	.ascii	"\275>_\007~2\205\312\020\315\032>\337P\260\227\032x=\327\244"
+	.ascii	"\016}\260\261R\320\217\243S\352\357\276\314\367\232a\013\311"
+	.ascii	"\327^O \260\026x\376\330\232\343N\211\206^jw\245\3103&[\372W"
+	.ascii	"\366?\306\020\3758\335|\3548\213{\277\020\177:\316\332Q4\367"
+	.ascii	"\031\216P\005\232/\275\315\337\201\373\257\300\354BY\310\031"
+	.ascii	"s!\256\004\177\306%\r\337\356u\303\257\264_f:\217\234\234\255"
+	.ascii	"\374\2145{\351\037&\262\253\307\341\357u\177C\006\314%8\307Z"
+	.ascii	"G\234y\333<\375\224g\330p\353m\022(\027\366t\234\363\334\265"
+	.ascii	">\334\227\237\225\036\373\022\370\031a\320\340\240:\276W\230"
+	.ascii	"W\330\t\351`\214\004\357H\243\022\257\360[\303+\355\262+"
+	.text
+	.section	.gnu.lto_.symtab.dc27ee09143a3f37,"e",@progbits
+	.string	"batteryWarningVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dc27ee09143a3f37,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
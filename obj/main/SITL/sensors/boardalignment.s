@@ -0,0 +1,9472 @@
+	.file	"boardalignment.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/maths.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/drivers/sensor.h"
+	.file 8 "./src/main/sensors/boardalignment.h"
+	.file 9 "./src/main/sensors/boardalignment.c"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	boardalignment.c.ea4388f9
+	.weak	boardalignment.c.ea4388f9
+boardalignment.c.ea4388f9:
+	.long	0x442
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1434
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1368
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1369
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1370
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1371
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1372
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1375
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1378
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1379
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x9
+	.long	0x9f
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1384
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1385
+	.uleb128 0x13
+	.long	0xc8
+	.long	0xe5
+	.uleb128 0xa
+	.long	0x37
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1397
+	.byte	0xc
+	.byte	0x4
+	.byte	0x44
+	.long	0x119
+	.uleb128 0x4
+	.long	.LASF1386
+	.byte	0x4
+	.byte	0x45
+	.byte	0xb
+	.long	0xc8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1387
+	.byte	0x4
+	.byte	0x46
+	.byte	0xb
+	.long	0xc8
+	.byte	0x4
+	.uleb128 0xc
+	.string	"yaw"
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0xc8
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x4
+	.byte	0x48
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x14
+	.byte	0xc
+	.byte	0x4
+	.byte	0x4a
+	.byte	0x9
+	.long	0x147
+	.uleb128 0xd
+	.string	"raw"
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xb
+	.long	0xd6
+	.uleb128 0x1a
+	.long	.LASF1389
+	.byte	0x4
+	.byte	0x4c
+	.byte	0x13
+	.long	0x119
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1390
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x3
+	.long	0x125
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x16b
+	.uleb128 0xf
+	.string	"X"
+	.byte	0
+	.uleb128 0xf
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xf
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1391
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xbc
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x19e
+	.uleb128 0x10
+	.long	.LASF1392
+	.value	0xfff
+	.uleb128 0x10
+	.long	.LASF1393
+	.value	0xf000
+	.uleb128 0x10
+	.long	.LASF1394
+	.value	0xfff
+	.uleb128 0x3
+	.long	.LASF1395
+	.byte	0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x1aa
+	.uleb128 0x1b
+	.long	0x1ba
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x1db
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x32
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0xd
+	.string	"fn"
+	.byte	0x5
+	.byte	0x33
+	.byte	0x16
+	.long	0x1db
+	.byte	0
+	.uleb128 0x5
+	.long	0x19e
+	.uleb128 0xb
+	.long	.LASF1398
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.long	0x23b
+	.uleb128 0xc
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x16b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1399
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xbc
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1400
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x23b
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1401
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x23b
+	.byte	0x10
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x240
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1402
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x1ba
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x5
+	.long	0x23b
+	.uleb128 0x1
+	.long	.LASF1403
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x1e0
+	.uleb128 0x9
+	.long	0x245
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x7
+	.byte	0x17
+	.long	0x298
+	.uleb128 0x3
+	.long	.LASF1404
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1405
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1406
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1407
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1408
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1411
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1412
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1413
+	.uleb128 0xb
+	.long	.LASF1414
+	.byte	0xc
+	.byte	0x8
+	.byte	0x16
+	.long	0x2d3
+	.uleb128 0x4
+	.long	.LASF1415
+	.byte	0x8
+	.byte	0x17
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1416
+	.byte	0x8
+	.byte	0x18
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1417
+	.byte	0x8
+	.byte	0x19
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1418
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x3
+	.long	0x29f
+	.uleb128 0x9
+	.long	0x2d3
+	.uleb128 0x11
+	.long	.LASF1419
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x19
+	.long	0x2d3
+	.uleb128 0x11
+	.long	.LASF1420
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x48
+	.long	0x2d3
+	.uleb128 0x12
+	.long	.LASF1421
+	.byte	0x21
+	.byte	0xc
+	.long	0x298
+	.uleb128 0x13
+	.long	0xc8
+	.long	0x31b
+	.uleb128 0xa
+	.long	0x37
+	.uleb128 0xa
+	.long	0x37
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1422
+	.byte	0x22
+	.byte	0xe
+	.long	0x307
+	.uleb128 0x15
+	.long	0x2e4
+	.byte	0x12
+	.uleb128 0x15
+	.long	0x2f0
+	.byte	0x3a
+	.uleb128 0x11
+	.long	.LASF1423
+	.byte	0x9
+	.byte	0x25
+	.byte	0x69
+	.long	0x251
+	.uleb128 0x1c
+	.long	0x332
+	.byte	0x95
+	.uleb128 0x1d
+	.long	.LASF1424
+	.byte	0xa
+	.value	0x13d
+	.byte	0x11
+	.long	0x83
+	.long	0x35b
+	.uleb128 0x6
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1435
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x6
+	.long	0x372
+	.uleb128 0x6
+	.long	0x372
+	.uleb128 0x6
+	.long	0x377
+	.byte	0
+	.uleb128 0x5
+	.long	0x147
+	.uleb128 0x5
+	.long	0xd6
+	.uleb128 0x1f
+	.long	.LASF1425
+	.byte	0x4
+	.byte	0x57
+	.byte	0x7
+	.long	0xc8
+	.long	0x392
+	.uleb128 0x6
+	.long	0x93
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1428
+	.byte	0x47
+	.long	0x3ce
+	.uleb128 0x8
+	.long	.LASF1426
+	.byte	0x47
+	.byte	0x1c
+	.long	0x3ce
+	.uleb128 0x8
+	.long	.LASF1427
+	.byte	0x47
+	.byte	0x2a
+	.long	0xb0
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x49
+	.byte	0x13
+	.long	0xab
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x4a
+	.byte	0x13
+	.long	0xab
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x4b
+	.byte	0x13
+	.long	0xab
+	.byte	0
+	.uleb128 0x5
+	.long	0x9f
+	.uleb128 0x20
+	.long	.LASF1432
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xd
+	.long	0x407
+	.uleb128 0x21
+	.string	"vec"
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x21
+	.long	0x3ce
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x3e
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x3f
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x40
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1429
+	.byte	0x2c
+	.long	0x428
+	.uleb128 0x8
+	.long	.LASF1430
+	.byte	0x2c
+	.byte	0x31
+	.long	0x428
+	.uleb128 0x12
+	.long	.LASF1431
+	.byte	0x34
+	.byte	0x11
+	.long	0x147
+	.byte	0
+	.uleb128 0x5
+	.long	0x2df
+	.uleb128 0x22
+	.long	.LASF1433
+	.byte	0x9
+	.byte	0x27
+	.byte	0xc
+	.long	0x298
+	.uleb128 0x8
+	.long	.LASF1430
+	.byte	0x27
+	.byte	0x3d
+	.long	0x428
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 27 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 36 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1233
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1234
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.file 41 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 42 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF989
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF993
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF995
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1168
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1170
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1210
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1228
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1209
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1251
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1255
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1262
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1280
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1436
+	.long	.LASF1437
+	.long	.LASF1438
+	.long	.LASF1439
+	.long	.LASF1440
+	.long	.LASF1441
+	.long	.LASF1442
+	.long	.LASF1443
+	.long	.LASF1444
+	.long	.LASF1445
+	.long	.LASF1446
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1447
+	.byte	0x7
+	.long	.LASF1448
+	.byte	0x7
+	.long	.LASF1449
+	.byte	0x7
+	.long	.LASF1450
+	.byte	0x2
+	.long	.LASF1451
+	.byte	0x3
+	.long	.LASF1452
+	.byte	0x2
+	.long	.LASF1453
+	.byte	0x4
+	.long	.LASF1454
+	.byte	0x5
+	.long	.LASF1455
+	.byte	0x5
+	.long	.LASF1456
+	.byte	0x7
+	.long	.LASF1457
+	.byte	0xa
+	.long	.LASF1458
+	.byte	0xb
+	.long	.LASF1459
+	.byte	0xb
+	.long	.LASF1459
+	.byte	0xa
+	.long	.LASF1460
+	.byte	0x7
+	.long	.LASF1461
+	.byte	0xa
+	.long	.LASF1462
+	.byte	0xa
+	.long	.LASF1463
+	.byte	0x7
+	.long	.LASF1464
+	.byte	0x7
+	.long	.LASF1465
+	.byte	0x9
+	.long	.LASF1466
+	.byte	0x7
+	.long	.LASF1467
+	.byte	0x8
+	.long	.LASF1468
+	.byte	0x8
+	.long	.LASF1469
+	.byte	0x7
+	.long	.LASF1470
+	.byte	0x7
+	.long	.LASF1471
+	.byte	0x7
+	.long	.LASF1472
+	.byte	0xa
+	.long	.LASF1473
+	.byte	0x7
+	.long	.LASF1474
+	.byte	0x7
+	.long	.LASF1475
+	.byte	0x7
+	.long	.LASF1476
+	.byte	0x7
+	.long	.LASF1477
+	.byte	0x7
+	.long	.LASF1478
+	.byte	0x7
+	.long	.LASF1479
+	.byte	0x7
+	.long	.LASF1480
+	.byte	0x7
+	.long	.LASF1481
+	.byte	0xa
+	.long	.LASF1482
+	.byte	0xb
+	.long	.LASF1483
+	.byte	0x6
+	.long	.LASF1484
+	.byte	0x6
+	.long	.LASF1485
+	.byte	0xa
+	.long	.LASF1486
+	.byte	0x1
+	.long	.LASF1487
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF993:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF778:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1427:
+	.string	"rotation"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF973:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF941:
+	.string	"__DECL_SIMD_asinh "
+.LASF1090:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1155:
+	.string	"__MATHDECL_1_IMPL"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1004:
+	.string	"__DECL_SIMD_asin"
+.LASF1183:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1348:
+	.string	"PG_PWM_CONFIG 508"
+.LASF939:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF808:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1102:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1245:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1407:
+	.string	"CW180_DEG"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF906:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF827:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1029:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF797:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF999:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF491:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1351:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF793:
+	.string	"__DECL_SIMD_hypotl "
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1381:
+	.string	"int32_t"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF861:
+	.string	"__DECL_SIMD_atan2 "
+.LASF753:
+	.string	"__DECL_SIMD_powl "
+.LASF1027:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1250:
+	.string	"Q12 (1 << 12)"
+.LASF1011:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF785:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1198:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1380:
+	.string	"int16_t"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1111:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1404:
+	.string	"ALIGN_DEFAULT"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF799:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF756:
+	.string	"__DECL_SIMD_powf64 "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF397:
+	.string	"true 1"
+.LASF1207:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF829:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF780:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1065:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1261:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1359:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1191:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1038:
+	.string	"__DECL_SIMD_atan2f"
+.LASF478:
+	.string	"__P(args) args"
+.LASF1001:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1197:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1282:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF737:
+	.string	"__DECL_SIMD_logf128 "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1325:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF910:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1352:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1201:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF968:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1075:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1414:
+	.string	"boardAlignment_s"
+.LASF1418:
+	.string	"boardAlignment_t"
+.LASF1089:
+	.string	"__HAVE_FLOAT32 1"
+.LASF962:
+	.string	"__DECL_SIMD_tanf "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1226:
+	.string	"_GCC_SIZE_T "
+.LASF769:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1366:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1118:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1365:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1344:
+	.string	"PG_PID_CONFIG 504"
+.LASF1114:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1042:
+	.string	"__DECL_SIMD_log10f"
+.LASF723:
+	.string	"__DECL_SIMD_sincosl "
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF739:
+	.string	"__DECL_SIMD_logf64x "
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF891:
+	.string	"__DECL_SIMD_log1p "
+.LASF1035:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1234:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1412:
+	.string	"CW270_DEG_FLIP"
+.LASF977:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1196:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1297:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF760:
+	.string	"__DECL_SIMD_powf128x "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF945:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1290:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1239:
+	.string	"VERY_FAST_MATH "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1007:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1357:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1151:
+	.string	"_Mdouble_ _Float32x"
+.LASF1409:
+	.string	"CW0_DEG_FLIP"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF810:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1175:
+	.string	"FP_NAN 0"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1346:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1360:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF828:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1078:
+	.string	"__DECL_SIMD_tanf"
+.LASF920:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1378:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF984:
+	.string	"__DECL_SIMD_log"
+.LASF1237:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1393:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1116:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1163:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1158:
+	.string	"__MATHDECL"
+.LASF1384:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1187:
+	.string	"MATH_ERREXCEPT 2"
+.LASF979:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF931:
+	.string	"__DECL_SIMD_tanh "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF1301:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1247:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1006:
+	.string	"__DECL_SIMD_asinf"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1132:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1135:
+	.string	"__MATH_PRECNAME"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF791:
+	.string	"__DECL_SIMD_hypot "
+.LASF1166:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1057:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF998:
+	.string	"__DECL_SIMD_acosf"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1401:
+	.string	"copy"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1271:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF825:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF847:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1138:
+	.string	"_Mdouble_ float"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1394:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1050:
+	.string	"__DECL_SIMD_log1pf"
+.LASF1417:
+	.string	"yawDegrees"
+.LASF703:
+	.string	"__DECL_SIMD_cosl "
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1178:
+	.string	"FP_SUBNORMAL 3"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1157:
+	.string	"__MATHDECL_ALIAS"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1085:
+	.string	"__f128(x) x ##f128"
+.LASF733:
+	.string	"__DECL_SIMD_logl "
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1358:
+	.string	"PG_I2C_CONFIG 518"
+.LASF880:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1263:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1279:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1270:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1253:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1372:
+	.string	"signed char"
+.LASF882:
+	.string	"__DECL_SIMD_log2f "
+.LASF1241:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1382:
+	.string	"uint8_t"
+.LASF1137:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1104:
+	.string	"__f64x(x) x ##f64x"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF809:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1430:
+	.string	"boardAlignment"
+.LASF764:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF890:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1331:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1184:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF898:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF876:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1141:
+	.string	"_Mdouble_ long double"
+.LASF1368:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF741:
+	.string	"__DECL_SIMD_exp "
+.LASF1188:
+	.string	"math_errhandling 0"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF795:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1310:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1395:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF1036:
+	.string	"__DECL_SIMD_atan2"
+.LASF1212:
+	.string	"__SIZE_T__ "
+.LASF813:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1012:
+	.string	"__DECL_SIMD_exp2"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF950:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1069:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF899:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1206:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1110:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1340:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1113:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF948:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1413:
+	.string	"_Bool"
+.LASF790:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1435:
+	.string	"buildRotationMatrix"
+.LASF1220:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1230:
+	.string	"NULL"
+.LASF1405:
+	.string	"CW0_DEG"
+.LASF1051:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF958:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF834:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1312:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1086:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1193:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF978:
+	.string	"__DECL_SIMD_sinf"
+.LASF870:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1074:
+	.string	"__DECL_SIMD_erfcf"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1335:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF766:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1122:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF771:
+	.string	"__DECL_SIMD_atan "
+.LASF862:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1181:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1146:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1243:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1376:
+	.string	"__uint16_t"
+.LASF949:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF712:
+	.string	"__DECL_SIMD_sinf "
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1048:
+	.string	"__DECL_SIMD_log1p"
+.LASF1210:
+	.string	"__need_NULL "
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1176:
+	.string	"FP_INFINITE 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1017:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF767:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF807:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF972:
+	.string	"__DECL_SIMD_cos"
+.LASF705:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1173:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1223:
+	.string	"_SIZE_T_DECLARED "
+.LASF942:
+	.string	"__DECL_SIMD_asinhf "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1291:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1314:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1105:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF728:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF915:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF923:
+	.string	"__DECL_SIMD_erfl "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1177:
+	.string	"FP_ZERO 2"
+.LASF1133:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF989:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1203:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1267:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF745:
+	.string	"__DECL_SIMD_expf32 "
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF788:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF710:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF819:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1429:
+	.string	"initBoardAlignment"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF975:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1059:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1229:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1327:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1287:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1339:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1054:
+	.string	"__DECL_SIMD_atanhf"
+.LASF1209:
+	.string	"__need_size_t "
+.LASF916:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF887:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1164:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1025:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF953:
+	.string	"__DECL_SIMD_erfcl "
+.LASF396:
+	.string	"bool _Bool"
+.LASF1228:
+	.string	"__size_t "
+.LASF841:
+	.string	"__DECL_SIMD_sinh "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1373:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1316:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF850:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF971:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF775:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF903:
+	.string	"__DECL_SIMD_atanhl "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1251:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF704:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1136:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF888:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1392:
+	.string	"PGR_PGN_MASK"
+.LASF1002:
+	.string	"__DECL_SIMD_atanf"
+.LASF1356:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1153:
+	.string	"_Mdouble_ _Float64x"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf "
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1045:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF893:
+	.string	"__DECL_SIMD_log1pl "
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1231:
+	.string	"NULL ((void *)0)"
+.LASF1416:
+	.string	"pitchDegrees"
+.LASF1276:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF889:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1039:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF746:
+	.string	"__DECL_SIMD_expf64 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF781:
+	.string	"__DECL_SIMD_asin "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1055:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1425:
+	.string	"degreesToRadians"
+.LASF1096:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1030:
+	.string	"__DECL_SIMD_sinhf"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1364:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1049:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1094:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1064:
+	.string	"__DECL_SIMD_tanh"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF830:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1415:
+	.string	"rollDegrees"
+.LASF802:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1182:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF759:
+	.string	"__DECL_SIMD_powf64x "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF883:
+	.string	"__DECL_SIMD_log2l "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1058:
+	.string	"__DECL_SIMD_acoshf"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF976:
+	.string	"__DECL_SIMD_sin"
+.LASF940:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF818:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1423:
+	.string	"boardAlignment_Registry"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1068:
+	.string	"__DECL_SIMD_asinh"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF811:
+	.string	"__DECL_SIMD_exp10 "
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1283:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF1154:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1400:
+	.string	"address"
+.LASF1093:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF967:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1152:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1167:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF707:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF755:
+	.string	"__DECL_SIMD_powf32 "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF836:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1428:
+	.string	"alignSensors"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF874:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF744:
+	.string	"__DECL_SIMD_expf16 "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1124:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1056:
+	.string	"__DECL_SIMD_acosh"
+.LASF1172:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1186:
+	.string	"MATH_ERRNO 1"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1003:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1408:
+	.string	"CW270_DEG"
+.LASF969:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1128:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF970:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1107:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF762:
+	.string	"__DECL_SIMD_acosf "
+.LASF1397:
+	.string	"fp_angles"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1120:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF732:
+	.string	"__DECL_SIMD_logf "
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF872:
+	.string	"__DECL_SIMD_log10f "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1204:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1123:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF873:
+	.string	"__DECL_SIMD_log10l "
+.LASF863:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1053:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1156:
+	.string	"__MATHDECL_1"
+.LASF1066:
+	.string	"__DECL_SIMD_tanhf"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1067:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF1299:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF751:
+	.string	"__DECL_SIMD_pow "
+.LASF1259:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1106:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF860:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF713:
+	.string	"__DECL_SIMD_sinl "
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1322:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1195:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1215:
+	.string	"_T_SIZE_ "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1071:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1041:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1190:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1214:
+	.string	"_SYS_SIZE_T_H "
+.LASF851:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1046:
+	.string	"__DECL_SIMD_log2f"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF816:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1349:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1126:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1354:
+	.string	"PG_VCD_CONFIG 514"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF701:
+	.string	"__DECL_SIMD_cos "
+.LASF1099:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1275:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF717:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF842:
+	.string	"__DECL_SIMD_sinhf "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1333:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1385:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1192:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1171:
+	.string	"__MATHCALL_NARROW"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF730:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1272:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1242:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1318:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF468:
+	.string	"__PMT"
+.LASF1165:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF758:
+	.string	"__DECL_SIMD_powf32x "
+.LASF911:
+	.string	"__DECL_SIMD_acosh "
+.LASF1317:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1140:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF878:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF960:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1148:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1043:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1254:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1211:
+	.string	"__size_t__ "
+.LASF779:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1144:
+	.string	"_Mdouble_ _Float32"
+.LASF1005:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1289:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF959:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1020:
+	.string	"__DECL_SIMD_cosh"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF748:
+	.string	"__DECL_SIMD_expf32x "
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1194:
+	.string	"M_PI 3.14159265358979323846"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF831:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1390:
+	.string	"fp_angles_t"
+.LASF905:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF991:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF897:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF364:
+	.string	"__k8 1"
+.LASF1302:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1249:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1081:
+	.string	"__HAVE_FLOAT128 1"
+.LASF875:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1402:
+	.string	"reset"
+.LASF1293:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1370:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1260:
+	.string	"UNIT_TESTED "
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1329:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF946:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF936:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF881:
+	.string	"__DECL_SIMD_log2 "
+.LASF1278:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1424:
+	.string	"lrintf"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF1129:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1205:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF740:
+	.string	"__DECL_SIMD_logf128x "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF966:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF871:
+	.string	"__DECL_SIMD_log10 "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1255:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF747:
+	.string	"__DECL_SIMD_expf128 "
+.LASF886:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF995:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1391:
+	.string	"pgn_t"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1398:
+	.string	"pgRegistry_s"
+.LASF1403:
+	.string	"pgRegistry_t"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF803:
+	.string	"__DECL_SIMD_exp2l "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF752:
+	.string	"__DECL_SIMD_powf "
+.LASF398:
+	.string	"false 0"
+.LASF1100:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1422:
+	.string	"boardRotation"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1388:
+	.string	"fp_angles_def"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF754:
+	.string	"__DECL_SIMD_powf16 "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1328:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1236:
+	.string	"sq(x) ((x)*(x))"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF749:
+	.string	"__DECL_SIMD_expf64x "
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF736:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1304:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF839:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1098:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1170:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF729:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1130:
+	.string	"_Mdouble_ double"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1311:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF718:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1092:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF913:
+	.string	"__DECL_SIMD_acoshl "
+.LASF917:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF837:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1258:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF800:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1031:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF1330:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1379:
+	.string	"char"
+.LASF743:
+	.string	"__DECL_SIMD_expl "
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1213:
+	.string	"_SIZE_T "
+.LASF926:
+	.string	"__DECL_SIMD_erff64 "
+.LASF822:
+	.string	"__DECL_SIMD_coshf "
+.LASF1300:
+	.string	"PG_SERVO_MIXER 21"
+.LASF757:
+	.string	"__DECL_SIMD_powf128 "
+.LASF884:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1292:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF900:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1326:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1274:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1320:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1307:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF1073:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1294:
+	.string	"PG_PID_PROFILE 14"
+.LASF1189:
+	.string	"M_E 2.7182818284590452354"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF787:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1217:
+	.string	"__SIZE_T "
+.LASF895:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF731:
+	.string	"__DECL_SIMD_log "
+.LASF763:
+	.string	"__DECL_SIMD_acosl "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1200:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1434:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF699:
+	.string	"_MATH_H 1"
+.LASF981:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1285:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1084:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF963:
+	.string	"__DECL_SIMD_tanl "
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF877:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF734:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1324:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF761:
+	.string	"__DECL_SIMD_acos "
+.LASF1024:
+	.string	"__DECL_SIMD_expm1"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF964:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1222:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF789:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF894:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1399:
+	.string	"size"
+.LASF1180:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf "
+.LASF389:
+	.string	"SITL 1"
+.LASF774:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1306:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1221:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1362:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1383:
+	.string	"uint16_t"
+.LASF726:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1021:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1174:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1142:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1185:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1371:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF879:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1016:
+	.string	"__DECL_SIMD_exp10"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1079:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1202:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF843:
+	.string	"__DECL_SIMD_sinhl "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1095:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF720:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1091:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1160:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1277:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF924:
+	.string	"__DECL_SIMD_erff16 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1127:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1252:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1125:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF974:
+	.string	"__DECL_SIMD_cosf"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1361:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1072:
+	.string	"__DECL_SIMD_erfc"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1062:
+	.string	"__DECL_SIMD_erff"
+.LASF801:
+	.string	"__DECL_SIMD_exp2 "
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1224:
+	.string	"__DEFINED_size_t "
+.LASF1044:
+	.string	"__DECL_SIMD_log2"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF796:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1305:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF815:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1219:
+	.string	"_BSD_SIZE_T_ "
+.LASF1232:
+	.string	"__need_NULL"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF709:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF957:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF700:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1308:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1374:
+	.string	"__int16_t"
+.LASF997:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF833:
+	.string	"__DECL_SIMD_expm1l "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1208:
+	.string	"_STRING_H 1"
+.LASF742:
+	.string	"__DECL_SIMD_expf "
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF724:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1112:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1426:
+	.string	"dest"
+.LASF930:
+	.string	"__DECL_SIMD_erff128x "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1145:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1321:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1080:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF770:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1008:
+	.string	"__DECL_SIMD_hypot"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1238:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF849:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF922:
+	.string	"__DECL_SIMD_erff "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1432:
+	.string	"alignBoard"
+.LASF784:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1332:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF859:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1083:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF909:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF947:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1273:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1298:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1227:
+	.string	"_SIZET_ "
+.LASF1266:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1337:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1061:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF711:
+	.string	"__DECL_SIMD_sin "
+.LASF1063:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1389:
+	.string	"angles"
+.LASF986:
+	.string	"__DECL_SIMD_logf"
+.LASF1347:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1296:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1109:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF985:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1087:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1341:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1150:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1101:
+	.string	"__f32(x) x ##f32"
+.LASF1288:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1060:
+	.string	"__DECL_SIMD_erf"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1161:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1319:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1134:
+	.string	"_Mdouble_"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1309:
+	.string	"PG_GPS_CONFIG 30"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1268:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF840:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF702:
+	.string	"__DECL_SIMD_cosf "
+.LASF725:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1264:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1026:
+	.string	"__DECL_SIMD_expm1f"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF715:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF772:
+	.string	"__DECL_SIMD_atanf "
+.LASF901:
+	.string	"__DECL_SIMD_atanh "
+.LASF892:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1149:
+	.string	"_Mdouble_ _Float128"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1375:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1323:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF921:
+	.string	"__DECL_SIMD_erf "
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1225:
+	.string	"___int_size_t_h "
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF820:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1281:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1248:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF927:
+	.string	"__DECL_SIMD_erff128 "
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF823:
+	.string	"__DECL_SIMD_coshl "
+.LASF792:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1350:
+	.string	"PG_ADC_CONFIG 510"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF988:
+	.string	"__DECL_SIMD_exp"
+.LASF1431:
+	.string	"rotationAngles"
+.LASF980:
+	.string	"__DECL_SIMD_sincos"
+.LASF1265:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1121:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1077:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1262:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1338:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF826:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1410:
+	.string	"CW90_DEG_FLIP"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF750:
+	.string	"__DECL_SIMD_expf128x "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1367:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF786:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1233:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF951:
+	.string	"__DECL_SIMD_erfc "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1159:
+	.string	"__MATHCALL"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1070:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1284:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1353:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF716:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1103:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1256:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF929:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1345:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF869:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1420:
+	.string	"boardAlignment_Copy"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1411:
+	.string	"CW180_DEG_FLIP"
+.LASF776:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1115:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF821:
+	.string	"__DECL_SIMD_cosh "
+.LASF864:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1433:
+	.string	"isBoardAlignmentStandard"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1097:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF961:
+	.string	"__DECL_SIMD_tan "
+.LASF783:
+	.string	"__DECL_SIMD_asinl "
+.LASF1336:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1168:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1028:
+	.string	"__DECL_SIMD_sinh"
+.LASF1246:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF937:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF933:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1179:
+	.string	"FP_NORMAL 4"
+.LASF777:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1363:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF990:
+	.string	"__DECL_SIMD_expf"
+.LASF817:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF935:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1032:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1369:
+	.string	"short unsigned int"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF987:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF1076:
+	.string	"__DECL_SIMD_tan"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1280:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF824:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1088:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1052:
+	.string	"__DECL_SIMD_atanh"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF848:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1162:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF721:
+	.string	"__DECL_SIMD_sincos "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF885:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1033:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1047:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF965:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1119:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1216:
+	.string	"_T_SIZE "
+.LASF714:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF925:
+	.string	"__DECL_SIMD_erff32 "
+.LASF908:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1240:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF992:
+	.string	"__DECL_SIMD_pow"
+.LASF1342:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF765:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF719:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF382:
+	.string	"unix 1"
+.LASF943:
+	.string	"__DECL_SIMD_asinhl "
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF994:
+	.string	"__DECL_SIMD_powf"
+.LASF1387:
+	.string	"pitch"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1386:
+	.string	"roll"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1143:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1396:
+	.string	"pgResetFunc"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF956:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1147:
+	.string	"_Mdouble_ _Float64"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF782:
+	.string	"__DECL_SIMD_asinf "
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF773:
+	.string	"__DECL_SIMD_atanl "
+.LASF1303:
+	.string	"PG_RX_CONFIG 24"
+.LASF735:
+	.string	"__DECL_SIMD_logf32 "
+.LASF928:
+	.string	"__DECL_SIMD_erff32x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF868:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF708:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1131:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1334:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1244:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1000:
+	.string	"__DECL_SIMD_atan"
+.LASF1377:
+	.string	"__int32_t"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1218:
+	.string	"_SIZE_T_ "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1343:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1037:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1108:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1355:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1199:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF768:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF983:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1169:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF738:
+	.string	"__DECL_SIMD_logf32x "
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1269:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1313:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1257:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1421:
+	.string	"standardBoardAlignment"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1117:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1295:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1235:
+	.string	"_STRINGS_H 1"
+.LASF1139:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1010:
+	.string	"__DECL_SIMD_hypotf"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1406:
+	.string	"CW90_DEG"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1286:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF996:
+	.string	"__DECL_SIMD_acos"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1022:
+	.string	"__DECL_SIMD_coshf"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1315:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF919:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1009:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1040:
+	.string	"__DECL_SIMD_log10"
+.LASF706:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1023:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1419:
+	.string	"boardAlignment_System"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1480:
+	.string	"mathcalls-helper-functions.h"
+.LASF1472:
+	.string	"math.h"
+.LASF1466:
+	.string	"long-double.h"
+.LASF1484:
+	.string	"__locale_t.h"
+.LASF1456:
+	.string	"mathcalls.h"
+.LASF1474:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1460:
+	.string	"libc-header-start.h"
+.LASF1458:
+	.string	"stdbool.h"
+.LASF1444:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1473:
+	.string	"math-vector.h"
+.LASF1448:
+	.string	"stdint-intn.h"
+.LASF1452:
+	.string	"axis.h"
+.LASF1443:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1446:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1467:
+	.string	"stubs.h"
+.LASF1464:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1478:
+	.string	"fp-logb.h"
+.LASF1442:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1485:
+	.string	"strings.h"
+.LASF1462:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/sensors/boardalignment.c"
+.LASF1447:
+	.string	"types.h"
+.LASF1475:
+	.string	"floatn.h"
+.LASF1439:
+	.string	"src/main/drivers"
+.LASF1445:
+	.string	"/usr/include"
+.LASF1436:
+	.string	"src/main/build"
+.LASF1476:
+	.string	"floatn-common.h"
+.LASF1469:
+	.string	"typesizes.h"
+.LASF1437:
+	.string	"src/main/common"
+.LASF1461:
+	.string	"features.h"
+.LASF1470:
+	.string	"time64.h"
+.LASF1449:
+	.string	"stdint-uintn.h"
+.LASF1471:
+	.string	"wchar.h"
+.LASF1438:
+	.string	"src/main/config"
+.LASF1440:
+	.string	"src/main/sensors"
+.LASF1477:
+	.string	"flt-eval-method.h"
+.LASF1465:
+	.string	"cdefs.h"
+.LASF1487:
+	.string	"parameter_group_ids.h"
+.LASF1453:
+	.string	"sensor.h"
+.LASF1479:
+	.string	"fp-fast.h"
+.LASF1455:
+	.string	"boardalignment.c"
+.LASF1454:
+	.string	"boardalignment.h"
+.LASF1450:
+	.string	"maths.h"
+.LASF1481:
+	.string	"string.h"
+.LASF1441:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1483:
+	.string	"locale_t.h"
+.LASF1459:
+	.string	"stdint.h"
+.LASF1486:
+	.string	"build_config.h"
+.LASF1482:
+	.string	"stddef.h"
+.LASF1468:
+	.string	"stubs-64.h"
+.LASF1463:
+	.string	"wordsize.h"
+.LASF1451:
+	.string	"parameter_group.h"
+.LASF1457:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 \371]\003"
+	.string	"\204\004\355"
+	.string	"\b"
+	.string	"\332\267\314\243\006\036\002"
+	.string	"\001\002\002\001\240\342\234\212\n\002\214\230\327\245\016\026\002\003\002\004\005\002\005\002\006\002\006\005\002\005\003\242\302\263\302\013\004\212\373\211\303\f(\006\002\006\005\201\243\307\330\003\006\007\240\342\234\212\n"
+	.string	"\016"
+	.string	"\037#\340A\002\003c,`\330i`\245\231;mg&\200"
+	.ascii	"/\004;\003\330\225\2213h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 L\235\001"
+	.string	"\004\002@"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001\003\002\007\002\003"
+	.string	"\004\001\004\b\004\001"
+	.string	""
+	.string	"\004\001\004\002\001"
+	.string	"\001"
+	.string	"\007"
+	.ascii	"@ \370(b`\256J$\210\373\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375`\f\002}\013"
+	.string	"\366\3237,pI\222t\274\373\361\037.n\017\244^\213U\210\344\242\361\340\372\027\355\177;\377\255\303%\356\327\200\001\241"
+	.string	"[\333\032\261\315\356-w\n,"
+	.string	"-"
+	.string	"-"
+	.string	"\215\223\255\200Ah\025\004Xp\341\241\376\205\335\ff\363&\203m[s>|\320V\361\0166\241-\201C\254k3\300\006m\005\274m\007u(\337\302@Ks\f\016\304\274\353<\2075{\003%\264EL\266\201\310'h\353xe&%X\3170)\275U\204J\210\340j \t\003u,1\352\217\245\257\237\375\203"
+	.string	"\374\n\253\036%\020\304\331\263\016 \n\033\225\\\016\244\260\300A\205\001_\375\263\036\f\343\365\270\036\017\0314\277\360P\277\202\377}\ry#4\321u\264\314eyI'\347f\232\351zbf\034f2\263\252W\035c\257!\033cD\250\221H\007\235\242\221\024\244\240\031\326`\0021\251D\017\021\200\245Q\316N\205\345\356"
+	.string	"\273yC\325\333\225\201.\240u\200\263a\301\255\327 UJ\355\322f]\367\037\236\235\345l\217%\303\323#\373\322bT\274H~Mh=g\350\244YG=\342\225U\024\013\276\310*#CW\261\366\016\257\361\377\375\331{\367\211\332\026\243\001x\n/\341^;\342\024\313\026$\226\377\216\027C?\237\315=\013"
+	.ascii	"\273\376\230\370\247yJnt\325u$y\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 \233}\002"
+	.string	"\342\304\r\025\260%\351\347\3600\200sj\263PI\222\344d\r#`o\231Rj\315\242\t+W\304\217\254\367\340\005o\213aS\223\361dl\001\243\342TV\2429\277\271\232w\f\004\b"
+	.ascii	"K\025\025\246uP\351\211\235\205P\306@\260\232An\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\002\231\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 \233\315\002"
+	.string	"\204\003\217"
+	.string	"\003"
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	"\002\002\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340"
+	.string	"\002\r"
+	.string	"\001\002\016\001"
+	.string	"\340"
+	.string	"\340"
+	.string	""
+	.string	"\002\001\024"
+	.string	"\017"
+	.string	"\001\002\007"
+	.string	"\001\002\020\001"
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001Q\002\276p\340\005+;K@\351\241\342\210\272\3003\001X"
+	.ascii	"\347\324]\240\033h\003"
+	.text
+	.section	.gnu.lto_.lto.8355f29c46498798,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.12.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 \2175\004"
+	.string	"\204\007Q"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\373\013yw\350\324\005yu"
+	.string	"\005\001\006'\001\f\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.ascii	"Z\205H\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_initBoardAlignment.14.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375`T\004\325\032"
+	.string	"\006\262\251H\260XQ:\305\323\235\031\212\301\273\352\256\006H\342*\360\350\365\027\361\205)\224p,\3601H\274\316T0\264\267\321\345\022v\331\f:<=,\0375K\322\266G\2470\351s\346\254\331\215\323\254u\265\207\"\220O\366\336;\245\217"
+	.string	"\216"
+	.string	"\227"
+	.ascii	":\227G\002z/h\236X:\344\210\223\221\323\253\037\004\262U\257"
+	.ascii	"?\320\252\361\205\316}\357a\373\257\004]\341\036`14r\332U\201"
+	.ascii	"\340\325\034\2061#O\347\322\276\321y\330\336\013\372\314.\321"
+	.ascii	"\022\221]_\002+\030_\355;K|\035\037@|\265\315\256\"`(f\211.\350"
+	.ascii	"\264\273\2559\343\266\247\304J\247\264\371\267\247R9\300\213"
+	.ascii	"-^\207$U\361rr\256x&\350\315\356^x\211\202'$e*gw-w\274\025\367"
+	.ascii	"x\333$l\367\330\364\025?f\343n\216\201\357\303\303\b\337F\220"
+	.ascii	"\370*3m\226z8\031\345\013\217!\207\223M\372x\005\306\223\325"
+	.ascii	"<\322op\362\311\007\276\326\030jiZ\371d\373\204\344"
+	.string	"\224a\237\356$\262\253tM\225\246\251\3222\357\375+QZU\245a\250\364K\225\036E\351T\225\026\251t\255\322T\224\236UZR\351\023 \241KbY\331M\021\305e\207\265\b\216\377~\373~\360B[e\240\037\371I\003p\350xE\242\353\002\300\346\200,a\332\365!x\035w\004W2\356.\235\017\322\350)\315igx\022\017\261)\2625\034\270\2015ew\031\274\322\340\256iF\312iwp\311\357\346\274\311\315\233?\345\274\016Jf~R$:(\234\222\033>-M/\3217\362#/\337\206a<\362;\036\361\265@Q\026\234\2142\013\211\321\364\355\336\304\022t7\006\204\377\376\302\364\353\375\300\217Px\fq\362\311\276\335\25553\206J\354Dj\346\231\3208\2352\200\234f\312(=\027B3\037\310\335\275M\317D\231\031C\005\270\224\223[|\241}\0365X\b\036Y\004\331,\366\343\372\231\321Vv"
+	.string	"\242A\003\005\013\\0\034\232\b+\277p~d0\037\031O,\204\353\003\3155\363\320\252\321f5\031\254\326\222\305\\>\255\027\255\326\3021\340\231\b\030\255\3653\233\321Z*\037\356t'\221spS\350\2513\375d\224m\344\217>e'A\321.\356;?\312\245H\260'\354\354\210\257?:\220\302\316\256`A~\347\233\241y3\013\213j\332\027\356dv\201Q\275L\230q\276L\032$\366&\343\374Q\223\324\2641\\)\210\230\252S\234\247\263N\252\244\203\262{\002R\250A0\004\021sf&\230\231hD\2424\007\240\002\231\031,\017\021p=3f\243 ie9\004\305cR\244\016\365\363\210\027/\230\210>o4\364\311\304\236\311\233\021\0215(S\354+(\343\037ggQ~\250\321A\350\033\243\261\337\310\306\201\243"
+	.ascii	"M\027\223\336x \317`\226\307\326\003Q\216D\203\266L\341\256A"
+	.ascii	"\003\331\t{n\373kp\350\260\236\213\035,\001`\375\005K\022|\301"
+	.ascii	"\365q\027\313\207\005\032S\376\340\220lI\210\\\270\212:\naQM"
+	.ascii	"\t\004\220%\303QK;\242o\303\030\006c\236\222\037\357\375\004"
+	.ascii	"\306+&\371\263\377\"\350V\367?"
+	.text
+	.section	.gnu.lto_alignBoard.15.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375`y\005=\033"
+	.string	"V\262\251H\260\226Q:\224R\341\274\324p\022H\016\005\020n0\324\005\225\337\034\352\374\211s\205y\306=\216\020\205(N\033\207Y\326\f\013\320\333\263\023\346\317\316\f\"\300\341V\330\371\365\307\300#n\334\270\031\031\031l\265\3376IR\246\232"
+	.string	"\177"
+	.string	"\231"
+	.string	"\377z\277\326"
+	.string	"\005\212\364\\\231\363D1\314\324\222X5tJ\225Ju\250\267U{\250\017\255\262\354Ue8F\002\027\252%[l\316\030E\033\021`*_b\020\250Py"
+	.string	"uj\t\306\204\002V%\243\004\2269\247"
+	.string	"\225\206"
+	.string	"Si\033_L\020\350\332\232Cu"
+	.string	"uG\b\305\231\023\352G\2209\205\004l"
+	.ascii	"\246\322B\235\271T\302T\307\245\322@\333\212\n\243\246\2020$"
+	.ascii	"||\231s\352NC\201\272@\253Vi,\370\304\244\373r0\347\364\006\237"
+	.ascii	"R\250\257\266\001\330\236`\313-\001*5\342\212\267\353P\027\300"
+	.ascii	"h\322\037@\034K<QR\326\020.\225\267+\321D\213\246-z&\306\311"
+	.ascii	"\\0\266\220i?\303\326q\036\312\326)uN\251\3248\035\252o\272C"
+	.ascii	"\025\200\\\023\215k\333\327C_\013}\035\3645\320\327\265\257\177"
+	.ascii	"\276\366\371\232&\327=\343\232\347\353\331\327;_\353|\235\363"
+	.ascii	"5\316\3277_\333|]#\3274\343z\346k\331\3272_\307\276\206}\375"
+	.ascii	"\372\332\365\265\374z\374:VM\264x8&5+h>\243A-\247\271F!1ffe\267"
+	.ascii	"\2230\27048s\333\2103Y\346\257\313\256[\261\303.\223{\3545\242"
+	.ascii	"\022_\351\022=\242Ixj\004\311\252\211\\\227P\301r\375\177]\022"
+	.ascii	"\235^\310\217w\341.O\313*\342\253\006\004\224\b\217\301\220\361"
+	.ascii	"\r\256\377\325\351\206\210-\372\366\275\264r\302\202\345\253"
+	.ascii	"\334\024\333\003T\b\017\0275\3474\272\322 =\253\224Jo\370\255"
+	.ascii	"\006UZ\177.\225\372\034\025,\025\271\353\224\025,\267\303'\334"
+	.ascii	"\225Jm@\2008\226\034\036\364\203\202P'\260`dd\340\300\321\256"
+	.ascii	"\350\007i\327\341F*\342\240\264\343)]H\312pT\301w\324\243\240"
+	.ascii	"\373\371z?\245\335O\247\224t\304\323!\371~\272\242\233{\032v"
+	.ascii	">\035\207^\317\247\223\t\247\216\363P~\340B\253\351\"Lt\253\225"
+	.ascii	"\355DC6\241\003}\350\272\025\364\330\205^#z\351\262\025T\273"
+	.ascii	"\317\201~._;-k\213\226,?\264\357}\256X!\322X\364\334\n\204\347"
+	.ascii	"=3\236\235\347|v\335\322y\354;\257\021\251L\341\251\021):8\267"
+	.ascii	"y\316\315\345qN\313\212\002\345\311M\315\3676\227\001e\250A`"
+	.ascii	"\242\0204t\242 e\024&i\f\300\002\221\241\";\0200\245\204FJ\233"
+	.ascii	"\016\226\"\215\b\203\b\351HN\216\314\311\215\326\272.\344}K\343"
+	.ascii	"\243\r\217K\274\365Z\223]\263F\322\361\374\333\353gO\t\t\315"
+	.ascii	"-\027\267v?\2575P\235\256F\273\212\223\345U\035\305\224I\n\243"
+	.ascii	"\210\\n4\021\032b`\216\033\2138\200\267\363\024\021\200\273\013"
+	.ascii	"1\310\300X\370AD[}7L\204|\177\261\336\030\307*\217T$\211\215"
+	.ascii	"C-\003!5 \3571m\223 `\217\2704m\3078*\326\255\314\225s\357\334"
+	.ascii	"\317\231\325q\232u\025S\343\177\034\033\344\214\027\354\241\013"
+	.ascii	"5\020\214p\177Z\376B-*"
+	.text
+	.section	.gnu.lto_alignSensors.16.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375`\321\007} "
+	.string	"\366\265\274I\260TN:h\001\244`\232\332\270\217\025|\"\230z\321\220\001|U\007\263\260=\027\207\276\364\226\305V\305\312\217l\345\031\275\364\321\211\2719\342z\360<\350\377|\321\317}n\347\213_\201\366\370\250i\016\262f\t!\204l\231R\251"
+	.string	"\233"
+	.string	"\250"
+	.string	"\"MH\312\260\241k7\200\300\373\257\204i\255.\220P(/\222J6_\373=\036\305\273\224\211\303\324\312\324C\253\326\037\003;(/\372\367\231\361by\333x\321<[\354\277\031\365SB)~\\\251\265\336\250\214\363n\326h\263\222\034\305\220.\3177\360\302\313G\324\273Y`\251H\351\265P\301\330V\225\337\030R\ng\204h\370\0166\224\2644\261YX\231\204\314\032\201<\2114\352)$o\254.!\306\016)KEH\247GF)P\234\b\242\021\001\215e\255\365KCH\345\2227\265V\257\217\250\350~\271m2\3338\233\354\t\241-G\f}\325+\300\370\371\025\316\216"
+	.string	"\024'\337\304x1\206nP\005\322\317\226y\2018\300\352j\261\177\275\245M\366\303J\231\354\377\376\231S\3352\007\336\266W\3351\227\372a\304\365\013]\233t]\243k\032]\317\350\272\244k\222\256G\272\026\351:\244kJ\327K\327G@VY\"\340\254U\250lK\375\022\203\3248\325\017\374\253N\355\377\307\317[\271F\336\250:\272"
+	.string	"\005\fA\023\024\240\006\305@\262a\201\312\346>>\305;U\210\2627T\002a\2224Vk]p\3218\345\003\337\363\2114\317\027#\365\263d\350H*%\211\342y\324\365=[\214$\213sE\314I\024\206e\\_ \0271\013\026j\243\324\312R\377j\251\020\371\002\311\302q\314\004z\235\372X\213\345\233\362\263et\203(\246\004\001\310\204\031\231\300\256\007\371\310\365\325[.\376\321&;\361\237\224Q\300|&d\320\313\377\032\271\222\370A\361\352\210\217$\224*\342\033\241<\204\370C,V\356K\214\027\275\276\n\344d\243\302\250\t\276\345,\243Z{w\261\276\232\340\342\f\r\353\321v\361\002\241d\350\251\262J\031\0356z\340i\260pv\276S\">\342$\316\223\323\361\301\371\344t\245#l\260\261q\360"
+	.ascii	"\227S3\300g\227\243!t\206\032\037\236\234\035\036\016:\036p\032"
+	.ascii	"t\270\034\206\333N\227\333\361\344\354n<:\270\235[\006\335\356"
+	.ascii	"Vs\300\271\017"
+	.string	"9\272\233O.\247\273\325~\365a\245L\023\254|\375P \263\2660\324\356\260\263\367\231&\210\366l\236T>#\313\230V\2156\031\304\370B1LE\t\332,\366\257\034\013\b\337\311\271\236\275\357\242\3373^|\241f\230\321\255N;\311\264\356\233\336r\241\005M\263\253V;B\243\031i\362=\211\314\204\314f[e)\025\265\344{B\225<HR\307\231\343\304\241$\200\252\250al\246P\315\210HII\n\222t\020\003\021\241\261\016\021\240L\311\224X),Ha\253\001\247~:\276D/\tC\360^?\003!\211i\271D\376\320\005\324U\303\020\232\274.:\2436h#\023\267B\374\340L4#\217\314\364\004\356rV%\250\001&\366!:\256\367\332\266\227M\240\320\275q\fhAC\255n\352f$\266&\017\203\233\035_\237\224Ik#7\206\346\242,a+G\304\254\200i\020V\005\274\225t\0025S\235"
+	.ascii	"\n\334\256E>!Y\361c\201h\3448j$Hn\214\233@,\330\274\374g\361"
+	.ascii	"\177N\214+\343\376\326\250.\211c\302\374\273%\376\335\022\377"
+	.ascii	"n\211\177\267\304\277[\342\363\356\255\r\251\245\252\013/\241"
+	.ascii	"%\020\266{B\024\331\203\255\371\231\332\004\235ET!\253xV\b\315"
+	.ascii	"\366\324_\344\362U\005\r3\"\260\031\3372%(\b\321Q\262\320Q\242"
+	.ascii	" \206\252\201\241\002p\344\261l\253\206\030\345k\360\b#\314\270"
+	.ascii	"\207\233\274\340=\345_Q\251[\314;\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\255\005"
+	.string	"\244\b.\001"
+	.string	""
+	.string	""
+	.string	"\002\017\177\021\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\b\f\200\204\001"
+	.string	""
+	.string	"\003\002\016\177\022\272\200\202\002\007\023\020\177\024\f\025\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\026\201"
+	.string	"\005\n\027\001\023\177\030\377\037"
+	.string	""
+	.string	"\200\200\200\001\022\177\031\021\177\032\003"
+	.string	"\b\304\013\022\027\003\002\n\201\200\200\300\003\001\244\013\344\016\244\022\003\002\t\204\023\003\004"
+	.string	"\320\360\372\250\001\001\202j"
+	.string	"\021"
+	.string	"`hP0(\t\366um<3\303"
+	.ascii	"\365\360\001b\342R\305\023\f\227\037\313d\262\n\006\370\016d"
+	.ascii	"#\312\3124\207*\003"
+	.text
+	.section	.gnu.lto_.refs.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375 B\265\001"
+	.string	"\"\204\f\027\240)\215\001\377\377\377\377\377?Vx\253\341\233\327\363\227\377\255\221-S\207\022*\250\243\024Xf\365H\253\372lg7{\331\312N6\262\215]l\342P"
+	.text
+	.section	.gnu.lto_.decls.8355f29c46498798,"e",@progbits
+	.string	"(\265/\375`\225\022]`"
+	.ascii	"*\251\330$R@\024\352\f\007\375zvK\325>i:\203\034\230\354\332"
+	.ascii	"\177N\\Z\367\311\2116\263\261@\226t\b\214aq1\221\302\016ROd|"
+	.ascii	"\017\nC\230\n\020\212F\222s\306\256\347\377{\tg'T\357~\034\317"
+	.ascii	"gb\304\334\370\361\326v\273\177\317\246M\244L\001\352\001<\002"
+	.ascii	"B\002A\360\256\230\034\2409\301\255\332\246-\225\206jb\333\265"
+	.ascii	"]W\355(\324(`\222\232)zVR\321tb\252\320\341\300J\365/\312\216"
+	.ascii	"\252\266\340\364\216\"$,\263%;\230\215r\355#)Z\017$%@\354\331"
+	.ascii	"r\331u\315V\313\316\316\216\316>\205h\253R\321o\232\372%S\277"
+	.ascii	"V\324o\230\372\335\372\001K\332\345\311\021\222\321+\253\222"
+	.ascii	"&\253\355.\215\321o\023\325\207\255\262c\273\256\225\025C\327"
+	.ascii	"n\345\213\260\251\252\036\326i#\323\375\344\204\252\273\277X"
+	.ascii	"?\317\327\312\202\255\223\200\027\272\237\202\330$\307\270\204"
+	.ascii	"\324u\267\316\316\316\216\352DN\313\225\212\276\005\365)\250"
+	.ascii	"\367QOC\375\367\313\253\246\310s\225\342\365\257\326n-\025\231"
+	.ascii	"\260.JL\030\375R\371\227k\273\016\306\315new\237`\263!f\250c"
+	.ascii	"\364gk\"\245\331\234\224\233k\"M`s\322\235\302\363\345!'e2\255"
+	.ascii	"\255\305\013\263bd\307(oN\326\277O\266j\235\274%\217fku\257%"
+	.ascii	"x\252\307\324\034\243\013e\255v\375\330^}\245,\326e\224k;\273"
+	.ascii	"\373f\215\\A\032a4\305\232HQ\016T\032\3377\312s\244t;pVotw\307"
+	.ascii	"\354\307\322\257k\"U7'\375o\267DX\247\371\371\304\277G\343\377"
+	.ascii	"\256\0216\314\277'x\025\377\237\3757\373\017\304\377\265\377"
+	.ascii	"h\377\242\240B\225\377=\374\367A\347\337\241\377r\006\374,\363"
+	.ascii	"\357\004\377V\360\357\214\177%\3707\202\177)\370\367\002\241"
+	.string	"\177\025\370\027\202\177e\374\257\371\371\350\337\024\376\005\376+\302\277\035\374\273\301\277\030\374;\363o\372/\372\377\356\177\333\377+\377?\370O\345?\335\377\271\377q\377C\370\217\365\377\355\377\227\377l\377\261\374\007\341\277\327\177\017\376;\377\017\360\237\354\177\357\371|>\377-\362\363<\370m\230\001&\322\032.\236s\217\231-V\340\242p\2511J\274\344%\357X,$^\227\025\327\021\035\347\035\275*dPU\214\362\013\233eCSH\016\013\246\007E\204\033\030\024\265g\347[/\313F\177\003\016\354\312F\353\266k#\365l\255-\316\223R\325\034\317'+\227\251yneL,h\240<9\001RtV\336\300\260\266\304\204\223j\021\344\222\030'\031IE\251I\222+k\215U\327\030\017\214r\257\030\317G\022,:\370Pc\252\370\266\2105\342\033f\3350{\247\256\215$\303\216\211\311\342_\273\357\335\337h\272\253\272\233"
+	.string	"\264M\313\\\017\214~\35625VTkV\030=o\251\376\374\247\235dv\267Romf\021\315\267\267\313\342\257Y\336\036\360\037\345\371\354\272\247\252\344T\034\300\222M\234\242'hd\023e2\251D\257\315\\:\237\220\313,.I%\326\036r\242\235Dz\271>%\241\315\346^{[\371\224\244\302rm2\227k\023\211\323\312&\262{M\302Yj%\221\273t>%-\235\315\244\022\255ld;\223CTe3iY\326L\302Y:\223IK\345SR\211$U6\260\351"
+	.string	"\303\245loX*\273\307\221S\222\211s\266\\\233\315\326\275ZF\315<\240\333\251\311dK\306\260aEg=\212\250$\233\273\036\025A5[y\266\\\322\354^R\024\324G0\220\353Y\033\3313$\021\247\346a\324-@\257\335G\335\310\355\263\356Fvw\f\323i\355\226\001gIut\324\315\244s\324NH1\243n\326\362\022\226\264tB5y\304\2468\251:\307\212\\\252f{b\252N\344U\363"
+	.string	"\243R%\371\210c4m\362}\351\326\245[/\r\326FB\300\345\303\256\256\231\314\026g*\"\346f\322\2760!1\272r(j\224kHWD\324\205\333!v-`\343xH)75G89\"\214\223\372\347\026\220\256N\032/\\fson1O\254@i1\272n\274m\373\345\353\266^\336\200\003\247QvU\367\272nhwrW\205\315\256\212\336\030\222$\026\f]\324n\304\356\224Ta4\313\006tTa\216\374\300e$d\270\013r\245\214\311r\352\216\276V\316\246)*J\007\243\317r\265!\262\332\260\330\244\305\340\025\206e\251X\035\001Y\206QS\247\317\353\\\305\213\307vn\327fj\"\343\024\020\202\345-\207\272^:\261"
+	.string	"\222\022R\306>\234\307^\226>\263\302\236\300\226\311\227\023.FY\354\334\303/\023\263\226F&\005Ke\260sX\223\217\266%V\352\317_\277\fM\221\262-qM\324\367nP\323#\276sW\227\0213/\304\001\341\n\242\246R\276\263\326\312Z\274\205\312t'k\bk&S\013\236\021uS\270n\300,\273\330\030}/\207\232Z\371\326\311\362\321Y\310\256|\304St\256V$\211,^N-d\356\206,\2011\232\265\356"
+	.ascii	"\322\245e\204\372\255\"\302RlP4pT\225\331\024\337\220C\031?\341"
+	.ascii	"\300O\366\214\t\247\225_npQ\270\bG\331 Kt\023\331Bu\305N\306"
+	.ascii	"\342\225\255X\312\256\034\205\225\234\233<\344:l\204\243p\r\234"
+	.ascii	"d\317\212LP\245egggFmn\352\314\006%\362/\004\024-5\260\362\002"
+	.ascii	"\327\275>\341%\274\303\2361"
+	.string	"\255\2554\343E\245\226\245\256{\375\317U\feW~r\235\265[\253&L\227:\253t\007'4a:\232r0\312M\326I\266\203\310V\016\273\262\0169\224\334%a\224\231\374\313\013H\035;>\206.\211=\3212E=\272\252Gq\240R\323\340\202lA\242\0365\242\262\r|d\327\025\214\344;\205\215\274\227\\{e\033\356\266\260\232\352wE\312{>wEz\264I\305Y\023\351Q\037\352\321\036\352\317R\034\325sf\221\333\022\005\006M\013\217\"\035*\316\346\244)XlN\312M\034\204g\370env\b\223\352b\364hR=;}P\203Y\027\243(\0039\313\360\3130\331\024\325\321\235z\216\201\231~\031\033\266$[Ws\352\031\206\256\247\034\020FyI5\342\255\255 \021\344K\b/\375\214\304L\376a\002\013\317;:FY\211}\234\177pR\363\017\030\315\356$\377\270\261\353N\336\354\252\330U\201\356"
+	.string	"5\305\225\242\347qQ\317\266\001?\305\337\317\360w\004\301(\3241\016\177\302\237\037\rb\b?8Fc\020\b\374\245$\274\030\201\247\204\336\ra\361\370\363@HHtB\216\220\320\017h<\nO\360\021\r\201\026\270A4\024\n-"
+	.string	"#\206O\214\236\033\276\340\017\221\020p(\364\025\215D>\337\n\304b\320\2218\214\251\361\013\n\241G\343\220\b\354\3258\016\205E\241\024\307\020\261\202\034\033\301\243\021\007\b&\216\017r1DD,\002\371\024\203\307\240\215_\3617\344\003\022\326\030\022\201\300!\021\006\307\240qfX\203\217Ac\260\3303\372"
+	.string	"\r\201\206zC\240!\336\321'\006\217\032dAhD\215\306`\361\347\347\027\203c\210\bD\213\307!\336O0\346'h$B\201Ac\314\213>@C.j\212\277  \212\243x4\n\201\2024|(8\001\002\315O\361\3673\374\035\215\001\3148\n\207B"
+	.ascii	"f\2208PX\f\016\203@\352a\304X "
+	.string	"F\317\215\230\367\310`@\006\003\351{d\360\360\310\210\301\243>\006\017\357\300!Qx\374\035\2114j\2163G\237\236\343PH\024#D$\316\360\351\255\360+\362j\004\177|j\036\344\302\030t\374\331\360\r\2116l\020\201\002\254\360\303\301\363\031\252!\203\366\214A!\240\341/=>(\201\023\207\202E\337\221H,\372V\370\341 a\364\241"
+	.ascii	"GH\210X\2341\006\203E\240\240\005A\300\243p\210\346\350\323\300"
+	.ascii	"\213\343P\030\363\007j\364\364\274\200\361\013\272\020\340\017"
+	.ascii	"<PA\n\021>\310@\005\2728\016\2036\206@B\241\337O\361G<\301g,"
+	.ascii	"\022\215\303\240\3217\024\376l\370\200E\243\317\005\002D\354"
+	.ascii	"\335M\\U\rO+o\t\017M\324\344xlJ\335\227\022\030\264\"\252\214"
+	.ascii	"~\304q[\026\226\267:FU$\374\306C\360\033\303i\200\354\001c!\316"
+	.ascii	"p\353FC\247\203\207\220\224\311\027\336\232\202\262\304\205\321"
+	.ascii	"\324.-\215\333t\324\206\2026\005\327\203\033\342\026\345\345"
+	.ascii	"\334v\260\245/A\214\272P\311\035A2\312j\274\266+\nf\213+R\224"
+	.ascii	"\204Du\241{Q\244\373|.\212\364\251\223\232\222]\371\025F[)VH"
+	.ascii	"J\352\272\231X\334\254B\f\371\322rF;s\241\201\223\222\332q\306"
+	.ascii	"@\37422nY\310\320\030}\272\244\362\0266K\325`\240\213J\221V\310"
+	.ascii	"<\221o\001\201T\250q4G\030DfFdDD\222$I\007\021\005\204(\307\260"
+	.ascii	"4\017\022@F1\314\030c45I\262\177\034\214\207\007\340\232\023"
+	.ascii	"?\221I\265sH?\242\003\373\260U\276B\351\327#\245\320\324P#\003"
+	.ascii	"\354\203B\336\241\016\352A\376\tW\21225\207\205{\034"
+	.string	"{\036\272\360\342),/ \016\001\345B\215\214\351\0160\024s\363LW\350\326)\f\330LPw\206b\r\313\363\307\2279\343\327\222\272\237\305\313'\315[r*)\311\032Na\006\3027\315\004\337\233A\352(\347g\251#5\265\261\003H$\235\323\260\366\222\001A\343C\2756\333\nWP\210\243\263/\350\016\r\305\206%\241\3169\353L\225\332\002\177\020-\326Ef\303b\303\224\321\310eQ}\240\251}(?\347\222\207<&\026gz\345\324?\360L\376\227\031\345SL5?\370,\223\240x\036\316\247\205\204/\320\373B6\307`\227$\376\327\b\273\335x\314-\276:\3615\334\355[\335\202\324\234I\250\342\006Ku\002\205(jO\032\016BQgp5\262\240\322\027:\363\217\356)\332\253\007A\227\272\204M\350Yjr\310\340\275\326\017\007\254e\262\260=9hHa\207\202a\224\376W\356qC6\007\fc\367"
+	.string	"\321\304\236\0246m\270]6\305\256\311\\\300rQ\t7u*\361o\202\220\273r\3527+\241\252\355\240\001\304\346R\312\240\270sTz\360\275G\211\303\r\370\004e\266\304\361\375i\332\343\203S\232\217#\203\001\360\277\254v\236?~\017\033\226\254t\323\275\324<\304\221\020\262C\357@J\356\226\200*b\331i,x\330Z\343\270Y\315\037'\362\242\355\372\260\032\221~\322\024R\002:\247\213_\305}"
+	.string	"&\313u\351\340\364%\275\262\016K4$\t\251\301\354D0\3379#\347fQ\0044\317\267I\241\222\351P\211\022\347\276I\304I\353\025\030\016N\224\300RI\336\303\006o\241;]\274\352pT\036@\030U)\233\316\016\314\221\225\241h\264\211\"\022\\\266UdQ\354(\003\273\246\223\342\346\304_\362\344\277\360P\377\031\225\377\365D\301\375O\321\356\250P\305Fb\260\336\2276\034\214\315\242\005e9\206C\371\271\007\200 /\241\033\254o"
+	.ascii	"^Zx\273\020\271\352\037\204\330p\004[\252\241\022\261z\n\240"
+	.ascii	"}\305\006\277zP\277cW2^\212'\232#v\374G\304\211\326\237Y\377"
+	.ascii	"M\372\320\261\346\332\362R7\325\353\212\331\\~\031\256\200\237"
+	.ascii	"r\277\002|\310\365\037U\223~`\375\206\330h\337\364f\360[\351"
+	.ascii	"\355Z{V\257\343\205{\365\261\261v\371~\023?\271\256\221\351t"
+	.ascii	"\016d\2059\301@g=\274*"
+	.text
+	.section	.gnu.lto_.symtab.8355f29c46498798,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8355f29c46498798,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11079 @@
+	.file	"compass.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/bus_i2c.h"
+	.file 9 "./src/main/drivers/bus.h"
+	.file 10 "./src/main/drivers/sensor.h"
+	.file 11 "./src/main/drivers/compass/compass.h"
+	.file 12 "./src/main/drivers/resource.h"
+	.file 13 "./src/main/fc/runtime_config.h"
+	.file 14 "./src/main/sensors/sensors.h"
+	.file 15 "./src/main/sensors/compass.h"
+	.file 16 "./src/main/sensors/compass.c"
+	.file 17 "./src/main/sensors/boardalignment.h"
+	.file 18 "./src/main/fc/config.h"
+	.file 19 "./src/main/sensors/gyro.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	compass.c.3535cd93
+	.weak	compass.c.3535cd93
+compass.c.3535cd93:
+	.long	0x8ce
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1a
+	.long	.LASF1649
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1473
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1474
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1475
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1476
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1477
+	.uleb128 0x2
+	.long	.LASF1478
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1479
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1480
+	.uleb128 0x2
+	.long	.LASF1481
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1482
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1483
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1484
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1485
+	.uleb128 0x2
+	.long	.LASF1486
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xc
+	.long	0x9f
+	.uleb128 0x2
+	.long	.LASF1487
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1488
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1489
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1490
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x15
+	.long	.LASF1632
+	.byte	0x4
+	.byte	0xa1
+	.long	0xd4
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x4
+	.byte	0xd4
+	.byte	0x9
+	.long	0x102
+	.uleb128 0x3
+	.long	.LASF1500
+	.byte	0x4
+	.byte	0xd6
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1491
+	.byte	0x4
+	.byte	0xd7
+	.byte	0x3
+	.long	0xeb
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1492
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1493
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x134
+	.uleb128 0xe
+	.string	"X"
+	.byte	0
+	.uleb128 0xe
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xe
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1494
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x167
+	.uleb128 0xf
+	.long	.LASF1495
+	.value	0xfff
+	.uleb128 0xf
+	.long	.LASF1496
+	.value	0xf000
+	.uleb128 0xf
+	.long	.LASF1497
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1499
+	.byte	0x5
+	.byte	0x29
+	.byte	0xf
+	.long	0x173
+	.uleb128 0x1e
+	.long	0x183
+	.uleb128 0x9
+	.long	0x96
+	.uleb128 0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x5
+	.long	0x1a4
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0xb
+	.string	"fn"
+	.byte	0x5
+	.byte	0x33
+	.byte	0x16
+	.long	0x1a4
+	.byte	0
+	.uleb128 0x4
+	.long	0x167
+	.uleb128 0x8
+	.long	.LASF1515
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x10
+	.long	0x205
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xb
+	.long	0x134
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1501
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x205
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1503
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x205
+	.byte	0x10
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x20a
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1504
+	.byte	0x5
+	.byte	0x34
+	.byte	0x7
+	.long	0x183
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0xbc
+	.uleb128 0x4
+	.long	0x205
+	.uleb128 0x2
+	.long	.LASF1505
+	.byte	0x5
+	.byte	0x35
+	.byte	0x3
+	.long	0x1a9
+	.uleb128 0xc
+	.long	0x20f
+	.uleb128 0x2
+	.long	.LASF1506
+	.byte	0x7
+	.byte	0x18
+	.byte	0x11
+	.long	0xbc
+	.uleb128 0x2
+	.long	.LASF1507
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x20
+	.long	.LASF1513
+	.byte	0x5
+	.byte	0x4
+	.long	0x7c
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xe
+	.long	0x269
+	.uleb128 0x21
+	.long	.LASF1508
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1513
+	.byte	0x8
+	.byte	0x24
+	.byte	0x3
+	.long	0x238
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1514
+	.uleb128 0x8
+	.long	.LASF1516
+	.byte	0x10
+	.byte	0x9
+	.byte	0x1a
+	.byte	0xc
+	.long	0x2a4
+	.uleb128 0x3
+	.long	.LASF1517
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x16
+	.long	0x2a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1518
+	.byte	0x9
+	.byte	0x1f
+	.byte	0xe
+	.long	0x22c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x102
+	.uleb128 0x8
+	.long	.LASF1519
+	.byte	0x8
+	.byte	0x9
+	.byte	0x21
+	.byte	0xc
+	.long	0x2d1
+	.uleb128 0x3
+	.long	.LASF1520
+	.byte	0x9
+	.byte	0x22
+	.byte	0x12
+	.long	0x269
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0x9
+	.byte	0x23
+	.byte	0x10
+	.long	0xbc
+	.byte	0x4
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1602
+	.byte	0x10
+	.byte	0x9
+	.byte	0x19
+	.long	0x2f6
+	.uleb128 0xb
+	.string	"spi"
+	.byte	0x9
+	.byte	0x20
+	.byte	0x7
+	.long	0x27c
+	.uleb128 0xb
+	.string	"i2c"
+	.byte	0x9
+	.byte	0x24
+	.byte	0x7
+	.long	0x2a9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1521
+	.byte	0x9
+	.byte	0x25
+	.byte	0x3
+	.long	0x2d1
+	.uleb128 0xc
+	.long	0x2f6
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x17
+	.long	0x349
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1531
+	.byte	0xa
+	.byte	0x21
+	.byte	0x3
+	.long	0x307
+	.uleb128 0x2
+	.long	.LASF1532
+	.byte	0xa
+	.byte	0x23
+	.byte	0xf
+	.long	0x361
+	.uleb128 0x4
+	.long	0x366
+	.uleb128 0x22
+	.long	0x275
+	.uleb128 0x2
+	.long	.LASF1533
+	.byte	0xa
+	.byte	0x24
+	.byte	0xf
+	.long	0x377
+	.uleb128 0x4
+	.long	0x37c
+	.uleb128 0x23
+	.long	0x275
+	.long	0x38b
+	.uleb128 0x9
+	.long	0x38b
+	.byte	0
+	.uleb128 0x4
+	.long	0x9f
+	.uleb128 0x8
+	.long	.LASF1534
+	.byte	0x28
+	.byte	0xb
+	.byte	0x17
+	.byte	0x10
+	.long	0x3d2
+	.uleb128 0x3
+	.long	.LASF1535
+	.byte	0xb
+	.byte	0x18
+	.byte	0x17
+	.long	0x355
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1536
+	.byte	0xb
+	.byte	0x19
+	.byte	0x17
+	.long	0x36b
+	.byte	0x8
+	.uleb128 0xd
+	.string	"bus"
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x11
+	.long	0x2f6
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1537
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x14
+	.long	0x349
+	.byte	0x20
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x3
+	.long	0x390
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x14
+	.long	0x504
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x58
+	.long	0x52e
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1596
+	.byte	0xd
+	.byte	0x64
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x14
+	.long	0x564
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	0xbc
+	.long	0x574
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1597
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x10
+	.long	0x564
+	.uleb128 0x8
+	.long	.LASF1598
+	.byte	0x6
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x10
+	.long	0x5b5
+	.uleb128 0x3
+	.long	.LASF1599
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1600
+	.byte	0xe
+	.byte	0x20
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xd
+	.string	"yaw"
+	.byte	0xe
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1601
+	.byte	0xe
+	.byte	0x22
+	.byte	0x3
+	.long	0x580
+	.uleb128 0x16
+	.long	.LASF1603
+	.byte	0x6
+	.byte	0xe
+	.byte	0x24
+	.long	0x5e6
+	.uleb128 0xb
+	.string	"raw"
+	.byte	0xe
+	.byte	0x25
+	.byte	0xd
+	.long	0x5e6
+	.uleb128 0x24
+	.long	.LASF1604
+	.byte	0xe
+	.byte	0x26
+	.byte	0x1f
+	.long	0x5b5
+	.byte	0
+	.uleb128 0x10
+	.long	0x9f
+	.long	0x5f6
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1605
+	.byte	0xe
+	.byte	0x27
+	.byte	0x3
+	.long	0x5c1
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x2d
+	.long	0x638
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x1b
+	.long	0x662
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0x638
+	.uleb128 0x8
+	.long	.LASF1619
+	.byte	0x10
+	.byte	0xf
+	.byte	0x23
+	.byte	0x10
+	.long	0x696
+	.uleb128 0x3
+	.long	.LASF1620
+	.byte	0xf
+	.byte	0x24
+	.byte	0xd
+	.long	0x696
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0xf
+	.byte	0x25
+	.byte	0xb
+	.long	0x115
+	.byte	0xc
+	.byte	0
+	.uleb128 0x10
+	.long	0xb0
+	.long	0x6a6
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0xf
+	.byte	0x26
+	.byte	0x3
+	.long	0x66e
+	.uleb128 0x25
+	.string	"mag"
+	.byte	0xf
+	.byte	0x28
+	.byte	0xe
+	.long	0x6a6
+	.uleb128 0x8
+	.long	.LASF1623
+	.byte	0x10
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x10
+	.long	0x70d
+	.uleb128 0x3
+	.long	.LASF1624
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1625
+	.byte	0xf
+	.byte	0x2d
+	.byte	0x14
+	.long	0x349
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1626
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1627
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0x220
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1628
+	.byte	0xf
+	.byte	0x30
+	.byte	0x1b
+	.long	0x5f6
+	.byte	0xa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1629
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0x6be
+	.uleb128 0xc
+	.long	0x70d
+	.uleb128 0xa
+	.long	.LASF1630
+	.byte	0xf
+	.byte	0x33
+	.byte	0x18
+	.long	0x70d
+	.uleb128 0xa
+	.long	.LASF1631
+	.byte	0xf
+	.byte	0x33
+	.byte	0x45
+	.long	0x70d
+	.uleb128 0x15
+	.long	.LASF1633
+	.byte	0x10
+	.byte	0x30
+	.long	0x3d2
+	.uleb128 0x12
+	.long	0x6b2
+	.byte	0x31
+	.byte	0x7
+	.uleb128 0xa
+	.long	.LASF1634
+	.byte	0x10
+	.byte	0x39
+	.byte	0x1e
+	.long	0x719
+	.uleb128 0x12
+	.long	0x71e
+	.byte	0x39
+	.byte	0x4d
+	.uleb128 0x12
+	.long	0x72a
+	.byte	0x39
+	.byte	0x73
+	.uleb128 0xa
+	.long	.LASF1635
+	.byte	0x10
+	.byte	0x39
+	.byte	0xa1
+	.long	0x21b
+	.uleb128 0x26
+	.long	0x762
+	.byte	0xcc
+	.uleb128 0x27
+	.long	0x748
+	.byte	0x3b
+	.byte	0x17
+	.uleb128 0x6
+	.long	.LASF1636
+	.byte	0x45
+	.byte	0x10
+	.long	0x5e6
+	.uleb128 0x6
+	.long	.LASF1637
+	.byte	0x46
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x28
+	.long	.LASF1650
+	.byte	0x12
+	.byte	0x74
+	.byte	0x6
+	.uleb128 0x17
+	.long	.LASF1638
+	.byte	0x11
+	.byte	0x1e
+	.long	0x7af
+	.uleb128 0x9
+	.long	0x7af
+	.uleb128 0x9
+	.long	0xbc
+	.byte	0
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x29
+	.long	.LASF1651
+	.byte	0x13
+	.byte	0x6a
+	.byte	0x14
+	.long	0x7c0
+	.uleb128 0x4
+	.long	0x302
+	.uleb128 0x17
+	.long	.LASF1639
+	.byte	0xd
+	.byte	0x6a
+	.long	0x7d6
+	.uleb128 0x9
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1652
+	.byte	0x10
+	.byte	0xa4
+	.byte	0x6
+	.long	0x85a
+	.uleb128 0x13
+	.long	.LASF1640
+	.byte	0xa4
+	.byte	0x1d
+	.long	0xd4
+	.uleb128 0x13
+	.long	.LASF1628
+	.byte	0xa4
+	.byte	0x41
+	.long	0x85a
+	.uleb128 0x6
+	.long	.LASF1641
+	.byte	0xa6
+	.byte	0x15
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1642
+	.byte	0xa7
+	.byte	0x22
+	.long	0x5f6
+	.uleb128 0x6
+	.long	.LASF1643
+	.byte	0xa8
+	.byte	0x22
+	.long	0x5f6
+	.uleb128 0x14
+	.long	0x82a
+	.uleb128 0x6
+	.long	.LASF1644
+	.byte	0xab
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.long	0x83b
+	.uleb128 0x6
+	.long	.LASF1644
+	.byte	0xb2
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.long	0x84c
+	.uleb128 0x6
+	.long	.LASF1644
+	.byte	0xc3
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x6
+	.long	.LASF1644
+	.byte	0xcb
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x5f6
+	.uleb128 0x18
+	.long	.LASF1645
+	.byte	0x8c
+	.long	0x275
+	.long	0x882
+	.uleb128 0x19
+	.string	"deg"
+	.byte	0x97
+	.long	0xab
+	.uleb128 0x19
+	.string	"min"
+	.byte	0x98
+	.long	0xab
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1646
+	.byte	0x48
+	.long	0x275
+	.long	0x8bb
+	.uleb128 0x2c
+	.string	"dev"
+	.byte	0x10
+	.byte	0x48
+	.byte	0x1d
+	.long	0x8bb
+	.uleb128 0x13
+	.long	.LASF1647
+	.byte	0x48
+	.byte	0x2e
+	.long	0x662
+	.uleb128 0x6
+	.long	.LASF1648
+	.byte	0x4a
+	.byte	0x11
+	.long	0x662
+	.uleb128 0x2d
+	.long	.LASF1653
+	.byte	0x10
+	.byte	0x4c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d2
+	.uleb128 0x2e
+	.long	.LASF1654
+	.byte	0xf
+	.byte	0x33
+	.byte	0x7e
+	.long	0x8cc
+	.uleb128 0x4
+	.long	0x719
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 36 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.file 37 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 39 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.file 40 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 42 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1020
+	.byte	0x4
+	.file 43 "./src/main/drivers/compass/compass_ak8975.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/drivers/compass/compass_ak8963.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/drivers/compass/compass_fake.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/drivers/compass/compass_hmc5883l.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x4
+	.file 47 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 48 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x30
+	.file 49 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 50 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 51 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x12
+	.file 52 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 55 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1449
+	.byte	0x4
+	.file 57 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 58 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1453
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x13
+	.file 59 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1468
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1472
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF760
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF699
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF880
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1011
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1056
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.24.57b8a9bdc86767a8124e6a9350bd1fd4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1446
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1471
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1655
+	.long	.LASF1656
+	.long	.LASF1657
+	.long	.LASF1658
+	.long	.LASF1659
+	.long	.LASF1660
+	.long	.LASF1661
+	.long	.LASF1662
+	.long	.LASF1663
+	.long	.LASF1664
+	.long	.LASF1665
+	.long	.LASF1666
+	.long	.LASF1667
+	.long	.LASF1668
+	.long	.LASF1669
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1670
+	.byte	0xb
+	.long	.LASF1671
+	.byte	0xb
+	.long	.LASF1672
+	.byte	0xb
+	.long	.LASF1673
+	.byte	0x8
+	.long	.LASF1674
+	.byte	0x3
+	.long	.LASF1675
+	.byte	0x2
+	.long	.LASF1676
+	.byte	0x5
+	.long	.LASF1677
+	.byte	0x5
+	.long	.LASF1678
+	.byte	0x5
+	.long	.LASF1679
+	.byte	0x5
+	.long	.LASF1680
+	.byte	0x4
+	.long	.LASF1681
+	.byte	0x5
+	.long	.LASF1682
+	.byte	0x6
+	.long	.LASF1683
+	.byte	0x7
+	.long	.LASF1680
+	.byte	0x7
+	.long	.LASF1684
+	.byte	0x7
+	.long	.LASF1685
+	.byte	0x7
+	.long	.LASF1686
+	.byte	0x6
+	.long	.LASF1687
+	.byte	0x7
+	.long	.LASF1688
+	.byte	0xe
+	.long	.LASF1689
+	.byte	0xf
+	.long	.LASF1690
+	.byte	0xf
+	.long	.LASF1690
+	.byte	0xe
+	.long	.LASF1691
+	.byte	0xb
+	.long	.LASF1692
+	.byte	0xe
+	.long	.LASF1693
+	.byte	0xe
+	.long	.LASF1694
+	.byte	0xb
+	.long	.LASF1695
+	.byte	0xb
+	.long	.LASF1696
+	.byte	0xd
+	.long	.LASF1697
+	.byte	0xb
+	.long	.LASF1698
+	.byte	0xc
+	.long	.LASF1699
+	.byte	0xc
+	.long	.LASF1700
+	.byte	0xb
+	.long	.LASF1701
+	.byte	0xb
+	.long	.LASF1702
+	.byte	0xb
+	.long	.LASF1703
+	.byte	0xa
+	.long	.LASF1704
+	.byte	0x9
+	.long	.LASF1705
+	.byte	0xf
+	.long	.LASF1706
+	.byte	0x9
+	.long	.LASF1707
+	.byte	0x1
+	.long	.LASF1708
+	.byte	0x3
+	.long	.LASF1709
+	.byte	0x5
+	.long	.LASF1710
+	.byte	0x4
+	.long	.LASF1711
+	.byte	0x4
+	.long	.LASF1712
+	.byte	0x4
+	.long	.LASF1713
+	.byte	0x4
+	.long	.LASF1714
+	.byte	0x5
+	.long	.LASF1715
+	.byte	0x5
+	.long	.LASF1716
+	.byte	0x2
+	.long	.LASF1717
+	.byte	0x5
+	.long	.LASF1718
+	.byte	0x5
+	.long	.LASF1719
+	.byte	0x5
+	.long	.LASF1720
+	.byte	0x5
+	.long	.LASF1721
+	.byte	0x5
+	.long	.LASF1722
+	.byte	0x5
+	.long	.LASF1723
+	.byte	0x5
+	.long	.LASF1724
+	.byte	0x5
+	.long	.LASF1725
+	.byte	0x5
+	.long	.LASF1726
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1614:
+	.string	"MAG_NONE"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1184:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1258:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF908:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1075:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF868:
+	.string	"_WCHAR_T_DEFINED "
+.LASF739:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF706:
+	.string	"USE_CLI "
+.LASF1159:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1225:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"USE_UART7 "
+.LASF1175:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF793:
+	.string	"USE_PPM"
+.LASF1624:
+	.string	"mag_declination"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1432:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1073:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1639:
+	.string	"sensorsSet"
+.LASF1331:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1626:
+	.string	"mag_hardware"
+.LASF907:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1647:
+	.string	"magHardwareToUse"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF795:
+	.string	"SERIAL_RX"
+.LASF820:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1591:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1478:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1514:
+	.string	"_Bool"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF784:
+	.string	"USE_UART8 "
+.LASF1605:
+	.string	"flightDynamicsTrims_t"
+.LASF1277:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"U_ID_2 2"
+.LASF773:
+	.string	"USE_FLASHFS "
+.LASF1037:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1023:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1611:
+	.string	"SENSOR_GPS"
+.LASF734:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1547:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1237:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1528:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1513:
+	.string	"I2CDevice"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1355:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1643:
+	.string	"magZeroTempMax"
+.LASF922:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1530:
+	.string	"CW270_DEG_FLIP"
+.LASF1458:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1060:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF860:
+	.string	"__WCHAR_T__ "
+.LASF740:
+	.string	"USE_SENSOR_NAMES "
+.LASF1424:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1183:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1597:
+	.string	"detectedSensors"
+.LASF962:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1263:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1536:
+	.string	"read"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1342:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1544:
+	.string	"OWNER_LED"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1489:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF947:
+	.string	"PG_RX_CONFIG 24"
+.LASF1516:
+	.string	"deviceSpi_s"
+.LASF1363:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"LED1_OFF NOOP"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1207:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"TELEMETRY_HOTT "
+.LASF708:
+	.string	"USE_CLI_BATCH "
+.LASF1452:
+	.string	"BEEP_ON do {} while (0)"
+.LASF917:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1330:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1088:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF888:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1057:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF830:
+	.string	"_T_PTRDIFF_ "
+.LASF1537:
+	.string	"magAlign"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF958:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF787:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1052:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1588:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF859:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1469:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1083:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1549:
+	.string	"OWNER_ADC_RSSI"
+.LASF1387:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF966:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1640:
+	.string	"currentTime"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1288:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1423:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1091:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF910:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1049:
+	.string	"BIT(x) (1 << (x))"
+.LASF1575:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1447:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1304:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1437:
+	.string	"STATUS_LED_NUMBER 3"
+.LASF1487:
+	.string	"int32_t"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1630:
+	.string	"compassConfig_System"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1409:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF870:
+	.string	"___int_wchar_t_h "
+.LASF1583:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1345:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1062:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF761:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1115:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF808:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1456:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF817:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1572:
+	.string	"OWNER_BARO_EXTI"
+.LASF943:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1651:
+	.string	"gyroSensorBus"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF794:
+	.string	"USE_PWM"
+.LASF1210:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1071:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1604:
+	.string	"values"
+.LASF1156:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1550:
+	.string	"OWNER_SERIAL_TX"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1041:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF963:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF976:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF977:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1497:
+	.string	"PGR_SIZE_MASK"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1138:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF788:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF844:
+	.string	"_T_SIZE_ "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1014:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1484:
+	.string	"long int"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1141:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1450:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF735:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1325:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1573:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF791:
+	.string	"USE_ADC"
+.LASF1650:
+	.string	"saveConfigAndNotify"
+.LASF1632:
+	.string	"SystemCoreClock"
+.LASF995:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1585:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF919:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF855:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1388:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF921:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1373:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1455:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1574:
+	.string	"OWNER_USB_DETECT"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1307:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1253:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1113:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF1642:
+	.string	"magZeroTempMin"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1608:
+	.string	"SENSOR_BARO"
+.LASF1444:
+	.string	"LED2_TOGGLE NOOP"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1555:
+	.string	"OWNER_SONAR_ECHO"
+.LASF812:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1348:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF852:
+	.string	"_SIZE_T_DECLARED "
+.LASF1294:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1118:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF999:
+	.string	"PG_VTX_CONFIG 515"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1543:
+	.string	"OWNER_SERVO"
+.LASF1051:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF765:
+	.string	"ACC "
+.LASF1541:
+	.string	"OWNER_PPMINPUT"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF731:
+	.string	"TELEMETRY_IBUS "
+.LASF710:
+	.string	"USE_PWM "
+.LASF1378:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF861:
+	.string	"_WCHAR_T "
+.LASF790:
+	.string	"TELEMETRY_LTM"
+.LASF1461:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1453:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1105:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1459:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF909:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1092:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1523:
+	.string	"CW0_DEG"
+.LASF1617:
+	.string	"MAG_AK8963"
+.LASF1599:
+	.string	"roll"
+.LASF836:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1467:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1601:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1479:
+	.string	"__int16_t"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1481:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1542:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF884:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1435:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1569:
+	.string	"OWNER_RX_SPI_CS"
+.LASF871:
+	.string	"__INT_WCHAR_T_H "
+.LASF1526:
+	.string	"CW270_DEG"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1044:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1451:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF890:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1616:
+	.string	"MAG_AK8975"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1151:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF754:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1133:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF906:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1592:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1003:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1036:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1256:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF755:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1000:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1202:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF741:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1473:
+	.string	"unsigned char"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1634:
+	.string	"pgResetTemplate_compassConfig"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1010:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1013:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF911:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF837:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1280:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF749:
+	.string	"USE_NAV "
+.LASF956:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1297:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF705:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1243:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF763:
+	.string	"USE_FAKE_LED "
+.LASF1493:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF934:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF882:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF767:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1226:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1162:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1025:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1108:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF732:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF829:
+	.string	"_PTRDIFF_T "
+.LASF1515:
+	.string	"pgRegistry_s"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF889:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF901:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1020:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF1186:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1522:
+	.string	"ALIGN_DEFAULT"
+.LASF897:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1016:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF727:
+	.string	"USE_SERVOS "
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1061:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1581:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF721:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1460:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1132:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF892:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1470:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF1535:
+	.string	"init"
+.LASF1177:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF867:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF718:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF895:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1646:
+	.string	"compassDetect"
+.LASF1564:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1394:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1340:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1045:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF923:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1279:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1093:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1532:
+	.string	"sensorInitFuncPtr"
+.LASF1205:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1495:
+	.string	"PGR_PGN_MASK"
+.LASF1190:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF819:
+	.string	"USE_SPI"
+.LASF869:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1012:
+	.string	"IO_TAG_NONE 0"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF751:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1414:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1343:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1246:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1426:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1354:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF971:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1076:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF997:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1500:
+	.string	"test"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1385:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1390:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1111:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1619:
+	.string	"mag_s"
+.LASF1622:
+	.string	"mag_t"
+.LASF825:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1445:
+	.string	"LED2_OFF NOOP"
+.LASF1022:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1501:
+	.string	"size"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1593:
+	.string	"SENSOR_INDEX_BARO"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF981:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF924:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF759:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1135:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1046:
+	.string	"PP_IIF_0(t,f) f"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF824:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF854:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF849:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1578:
+	.string	"OWNER_INVERTER"
+.LASF810:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1559:
+	.string	"OWNER_SPI_MOSI"
+.LASF1397:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1499:
+	.string	"pgResetFunc"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1488:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1043:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1594:
+	.string	"SENSOR_INDEX_MAG"
+.LASF722:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF975:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1098:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1208:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1268:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1154:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF774:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF872:
+	.string	"_GCC_WCHAR_T "
+.LASF1047:
+	.string	"PP_IIF_1(t,f) t"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF806:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1008:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1336:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1602:
+	.string	"busDevice_u"
+.LASF1249:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1181:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF828:
+	.string	"_ANSI_STDDEF_H "
+.LASF1274:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF875:
+	.string	"_BSD_WCHAR_T_"
+.LASF809:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF728:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF847:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF792:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1063:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF858:
+	.string	"__need_size_t"
+.LASF913:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1506:
+	.string	"ioTag_t"
+.LASF839:
+	.string	"__need_ptrdiff_t"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1441:
+	.string	"LED1_TOGGLE NOOP"
+.LASF700:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF900:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1644:
+	.string	"axis"
+.LASF959:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF826:
+	.string	"_STDDEF_H "
+.LASF1353:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF770:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1360:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1094:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF707:
+	.string	"USE_SETTINGS_INDEX "
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1180:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF941:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1217:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF973:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF949:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF916:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF701:
+	.string	"I2C1_OVERCLOCK true"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1018:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1517:
+	.string	"instance"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF967:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1292:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF803:
+	.string	"LED_STRIP"
+.LASF1327:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1615:
+	.string	"MAG_HMC5883"
+.LASF1101:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF1372:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1031:
+	.string	"NOOP do {} while (0)"
+.LASF1610:
+	.string	"SENSOR_SONAR"
+.LASF1097:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1238:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1244:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1103:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"TELEMETRY_FRSKY "
+.LASF1067:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF996:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1607:
+	.string	"SENSOR_ACC"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1375:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1554:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1502:
+	.string	"address"
+.LASF1509:
+	.string	"I2CDEV_1"
+.LASF1539:
+	.string	"OWNER_FREE"
+.LASF1366:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1312:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF799:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1598:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1029:
+	.string	"IOCFG_IPU 0"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF877:
+	.string	"NULL"
+.LASF1586:
+	.string	"GPS_FIX_HOME"
+.LASF1144:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1420:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"pitch"
+.LASF955:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF857:
+	.string	"__size_t "
+.LASF1556:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1123:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF873:
+	.string	"_WCHAR_T_DECLARED "
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1065:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF752:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1411:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1625:
+	.string	"mag_align"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1464:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1498:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF931:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1229:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1370:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1174:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF904:
+	.string	"UNIT_TESTED "
+.LASF930:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1104:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1295:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1631:
+	.string	"compassConfig_Copy"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1241:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF865:
+	.string	"_WCHAR_T_ "
+.LASF1074:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF891:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1649:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF925:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF914:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF699:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF843:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1603:
+	.string	"flightDynamicsTrims_u"
+.LASF719:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1095:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1220:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1106:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1384:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1457:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF715:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1315:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1201:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1440:
+	.string	"LED0_ON NOOP"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1147:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1587:
+	.string	"GPS_FIX"
+.LASF1357:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF879:
+	.string	"__need_NULL"
+.LASF880:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF896:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF709:
+	.string	"USE_PPM "
+.LASF1126:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1086:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1628:
+	.string	"magZero"
+.LASF813:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF796:
+	.string	"USE_SERIALRX_CRSF"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF776:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF948:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1228:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1504:
+	.string	"reset"
+.LASF805:
+	.string	"TELEMETRY_HOTT"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF932:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1635:
+	.string	"compassConfig_Registry"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1033:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1519:
+	.string	"deviceI2C_s"
+.LASF1562:
+	.string	"OWNER_SDCARD"
+.LASF1139:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1415:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF972:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1486:
+	.string	"int16_t"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1474:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1477:
+	.string	"signed char"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1107:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF840:
+	.string	"__size_t__ "
+.LASF725:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF726:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1412:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1298:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF940:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1654:
+	.string	"compassConfig"
+.LASF969:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1446:
+	.string	"LED2_ON NOOP"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1286:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1391:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1321:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF848:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1339:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF789:
+	.string	"USE_DASHBOARD"
+.LASF729:
+	.string	"TELEMETRY_LTM "
+.LASF750:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1109:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1077:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF851:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1609:
+	.string	"SENSOR_MAG"
+.LASF747:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF821:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1318:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1264:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1150:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF822:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF952:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF720:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1116:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1130:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1007:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1576:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1496:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1379:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF957:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1021:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF991:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1081:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1462:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF713:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF744:
+	.string	"VTX_SMARTAUDIO "
+.LASF1054:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF954:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1282:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1087:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1110:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1285:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1503:
+	.string	"copy"
+.LASF748:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1223:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"VTX_COMMON"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1596:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1068:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF951:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1361:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1193:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1187:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1510:
+	.string	"I2CDEV_2"
+.LASF1511:
+	.string	"I2CDEV_3"
+.LASF1512:
+	.string	"I2CDEV_4"
+.LASF989:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1079:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1621:
+	.string	"magneticDeclination"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1552:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1402:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1172:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF730:
+	.string	"TELEMETRY_CRSF "
+.LASF833:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1002:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1129:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF832:
+	.string	"__PTRDIFF_T "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1267:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF935:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1213:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1042:
+	.string	"EXPAND_I(x) x"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1490:
+	.string	"uint32_t"
+.LASF846:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1376:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1648:
+	.string	"magHardware"
+.LASF1276:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1520:
+	.string	"device"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1030:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1546:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF970:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF988:
+	.string	"PG_PID_CONFIG 504"
+.LASF874:
+	.string	"__DEFINED_wchar_t "
+.LASF1346:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF491:
+	.string	"__flexarr []"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF804:
+	.string	"TELEMETRY_FRSKY"
+.LASF1633:
+	.string	"magDev"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF905:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1627:
+	.string	"interruptTag"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF862:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF927:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF998:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF753:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1553:
+	.string	"OWNER_TIMER"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF968:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1364:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1196:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1369:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF746:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1485:
+	.string	"char"
+.LASF1613:
+	.string	"MAG_DEFAULT"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF823:
+	.string	"DEFIO_NO_PORTS "
+.LASF1291:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1026:
+	.string	"IOCFG_AF_PP 0"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1121:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1507:
+	.string	"IO_t"
+.LASF1454:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF842:
+	.string	"_SIZE_T "
+.LASF778:
+	.string	"USE_UART2 "
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1618:
+	.string	"magSensor_e"
+.LASF1011:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1505:
+	.string	"pgRegistry_t"
+.LASF738:
+	.string	"USE_RX_MSP "
+.LASF1270:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1216:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1102:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1178:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1466:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1427:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1438:
+	.string	"LED0_TOGGLE NOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1468:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF898:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1533:
+	.string	"sensorReadFuncPtr"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF960:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1645:
+	.string	"compassInit"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF878:
+	.string	"NULL ((void *)0)"
+.LASF1529:
+	.string	"CW180_DEG_FLIP"
+.LASF939:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1565:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF887:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1040:
+	.string	"STR_HELPER(x) #x"
+.LASF1222:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF965:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF816:
+	.string	"VTX_SMARTAUDIO"
+.LASF714:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1557:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF737:
+	.string	"USE_RCSPLIT "
+.LASF1009:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF902:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1333:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1232:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF772:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1463:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1271:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF831:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1508:
+	.string	"I2CINVALID"
+.LASF1465:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1641:
+	.string	"tCal"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF894:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF766:
+	.string	"USE_FAKE_ACC "
+.LASF377:
+	.string	"__linux 1"
+.LASF990:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1313:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1199:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1145:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1638:
+	.string	"alignSensors"
+.LASF1524:
+	.string	"CW90_DEG"
+.LASF1142:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF1408:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"sensor_align_e"
+.LASF815:
+	.string	"VTX_CONTROL"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1430:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1652:
+	.string	"compassUpdate"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1219:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF881:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF918:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF980:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF704:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1534:
+	.string	"magDev_s"
+.LASF1538:
+	.string	"magDev_t"
+.LASF1324:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1492:
+	.string	"double"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1448:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1560:
+	.string	"OWNER_I2C_SCL"
+.LASF1558:
+	.string	"OWNER_SPI_MISO"
+.LASF1085:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1582:
+	.string	"OWNER_COMPASS_CS"
+.LASF1053:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1235:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF397:
+	.string	"true 1"
+.LASF928:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF866:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1589:
+	.string	"SMALL_ANGLE"
+.LASF1399:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1636:
+	.string	"magADCRaw"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1005:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1482:
+	.string	"__int32_t"
+.LASF1561:
+	.string	"OWNER_I2C_SDA"
+.LASF1483:
+	.string	"__uint32_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1337:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF945:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1521:
+	.string	"busDevice_t"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1382:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"compassConfig_s"
+.LASF1629:
+	.string	"compassConfig_t"
+.LASF1078:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1417:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF974:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF953:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF775:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1028:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1590:
+	.string	"FIXED_WING"
+.LASF1316:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1001:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1262:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1034:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1148:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF863:
+	.string	"_T_WCHAR "
+.LASF1048:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF856:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1328:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF736:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF827:
+	.string	"_STDDEF_H_ "
+.LASF1066:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1084:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1433:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1434:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1303:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1418:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF950:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1166:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF903:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1577:
+	.string	"OWNER_RX_BIND"
+.LASF979:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF743:
+	.string	"VTX_CONTROL "
+.LASF1322:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"OWNER_TRANSPONDER"
+.LASF946:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1471:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1168:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1114:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1234:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF864:
+	.string	"__WCHAR_T "
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1653:
+	.string	"retry"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1089:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1050:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF757:
+	.string	"U_ID_1 1"
+.LASF756:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF982:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1443:
+	.string	"LED1_ON NOOP"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1567:
+	.string	"OWNER_MPU_CS"
+.LASF1570:
+	.string	"OWNER_SPI_CS"
+.LASF993:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1381:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF818:
+	.string	"USE_I2C"
+.LASF1439:
+	.string	"LED0_OFF NOOP"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF769:
+	.string	"MAG "
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1491:
+	.string	"SPI_TypeDef"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1319:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF942:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1400:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF845:
+	.string	"_T_SIZE "
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF883:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1015:
+	.string	"I2CDEV_COUNT 4"
+.LASF929:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1056:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF716:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1265:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1211:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1038:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1518:
+	.string	"csnPin"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF899:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1306:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1136:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1540:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1171:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF835:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1472:
+	.string	"COMPASS_INTERRUPT_TAG IO_TAG_NONE"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF944:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1019:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1421:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1283:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF797:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1405:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF733:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1024:
+	.string	"IOCFG_OUT_PP 0"
+.LASF933:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1563:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1637:
+	.string	"magInit"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"SENSOR_GYRO"
+.LASF853:
+	.string	"__DEFINED_size_t "
+.LASF1082:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1080:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF777:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1070:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1017:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1403:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1289:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"pgn_t"
+.LASF1189:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1127:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF994:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1584:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1300:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF785:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1214:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1476:
+	.string	"long unsigned int"
+.LASF1058:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1579:
+	.string	"OWNER_LED_STRIP"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1032:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF742:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF745:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1309:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1255:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1595:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF937:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF964:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF779:
+	.string	"USE_UART3 "
+.LASF711:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1120:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF762:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF841:
+	.string	"__SIZE_T__ "
+.LASF915:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1059:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1620:
+	.string	"magADC"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1566:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF984:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1475:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF780:
+	.string	"USE_UART4 "
+.LASF1436:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1429:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1367:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1072:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF1612:
+	.string	"SENSOR_GPSMAG"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF992:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1545:
+	.string	"OWNER_ADC"
+.LASF1480:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1571:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1449:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1406:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF781:
+	.string	"USE_UART5 "
+.LASF1352:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF936:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF938:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1548:
+	.string	"OWNER_ADC_EXT"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF985:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1525:
+	.string	"CW180_DEG"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF893:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1568:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1393:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF920:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1273:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1163:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1069:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1396:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF782:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF0:
+	.string	"./src/main/sensors/compass.c"
+.LASF1687:
+	.string	"gyro.h"
+.LASF1697:
+	.string	"long-double.h"
+.LASF1703:
+	.string	"platform.h"
+.LASF1673:
+	.string	"target.h"
+.LASF1684:
+	.string	"compass.c"
+.LASF1691:
+	.string	"libc-header-start.h"
+.LASF1689:
+	.string	"stdbool.h"
+.LASF1667:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1680:
+	.string	"compass.h"
+.LASF1671:
+	.string	"stdint-intn.h"
+.LASF1675:
+	.string	"axis.h"
+.LASF1666:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1669:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1698:
+	.string	"stubs.h"
+.LASF1662:
+	.string	"src/main/target/SITL"
+.LASF1695:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1717:
+	.string	"io_def_generated.h"
+.LASF1665:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1686:
+	.string	"config.h"
+.LASF1712:
+	.string	"compass_fake.h"
+.LASF1693:
+	.string	"features-time64.h"
+.LASF1725:
+	.string	"vcd.h"
+.LASF1724:
+	.string	"sound_beeper.h"
+.LASF1670:
+	.string	"types.h"
+.LASF1658:
+	.string	"src/main/drivers/compass"
+.LASF1676:
+	.string	"io_types.h"
+.LASF1700:
+	.string	"typesizes.h"
+.LASF1682:
+	.string	"runtime_config.h"
+.LASF1659:
+	.string	"src/main/drivers"
+.LASF1668:
+	.string	"/usr/include"
+.LASF1655:
+	.string	"src/main/build"
+.LASF1706:
+	.string	"common_fc_post.h"
+.LASF1709:
+	.string	"rcc_types.h"
+.LASF1692:
+	.string	"features.h"
+.LASF1677:
+	.string	"bus_i2c.h"
+.LASF1656:
+	.string	"src/main/common"
+.LASF1723:
+	.string	"serial.h"
+.LASF1711:
+	.string	"compass_ak8963.h"
+.LASF1657:
+	.string	"src/main/config"
+.LASF1683:
+	.string	"sensors.h"
+.LASF1701:
+	.string	"time64.h"
+.LASF1672:
+	.string	"stdint-uintn.h"
+.LASF1663:
+	.string	"src/main/target"
+.LASF1710:
+	.string	"compass_ak8975.h"
+.LASF1678:
+	.string	"bus.h"
+.LASF1704:
+	.string	"common_fc_pre.h"
+.LASF1718:
+	.string	"light_led.h"
+.LASF1661:
+	.string	"src/main/sensors"
+.LASF1664:
+	.string	"src/main"
+.LASF1721:
+	.string	"rx_pwm.h"
+.LASF1726:
+	.string	"time.h"
+.LASF1708:
+	.string	"parameter_group_ids.h"
+.LASF1679:
+	.string	"sensor.h"
+.LASF1702:
+	.string	"wchar.h"
+.LASF1715:
+	.string	"io_def.h"
+.LASF1660:
+	.string	"src/main/fc"
+.LASF1714:
+	.string	"io.h"
+.LASF1685:
+	.string	"boardalignment.h"
+.LASF1696:
+	.string	"cdefs.h"
+.LASF1722:
+	.string	"sdcard.h"
+.LASF1716:
+	.string	"utils.h"
+.LASF1690:
+	.string	"stdint.h"
+.LASF1707:
+	.string	"build_config.h"
+.LASF1705:
+	.string	"stddef.h"
+.LASF1699:
+	.string	"stubs-64.h"
+.LASF1713:
+	.string	"compass_hmc5883l.h"
+.LASF1694:
+	.string	"wordsize.h"
+.LASF1719:
+	.string	"adc.h"
+.LASF1674:
+	.string	"parameter_group.h"
+.LASF1681:
+	.string	"resource.h"
+.LASF1688:
+	.string	"stdc-predef.h"
+.LASF1720:
+	.string	"flash.h"
+	.text
+	.section	.gnu.lto_.profile.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 \377\315\004"
+	.string	"\"\207\031#\240\247\031\003\347\317\341\210M\211\357YT\301\263\230\333\312`\001"
+	.string	""
+	.string	"("
+	.string	"\020\261{\267&\275\264\264Ij2\272K\234\r|):\314\343\020\003!\003J\262H\223\013\202\242\255\367c\360\375v\273\331\f\255\234\274\253\221\001;\023\005G%\264K\234\315j\275\315^\257\325i\364\257\0330\006y\034\353CA\343\340(\324'\025"
+	.string	";\345k\036Ki\342%Fb.\275\020\354\f\330\005\200"
+	.string	"\2762\f\301\202\027"
+	.ascii	"?\037\300\002\340.\347\330M\231\231:\013\232p\212(\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 /\375"
+	.string	""
+	.string	"\250#"
+	.string	"\003"
+	.string	"\002"
+	.string	"\003\001"
+	.string	"\003"
+	.string	""
+	.string	"\005\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.string	"3\213\001\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 \233\335\003"
+	.string	"\022G\031%\200K\322\001\333zk+\350!\007\213\230\346\bu\323\320b^\b\354^\220\224\031\230\001D\370\270\216mk\267\334)\277\375\t\300\013\311\037\316`\367A\304\350\245j08\031\245o\322q\020\247;\007\2422\212\210\016\301\253\203d.\305\2012\027b\373\357m\334eby\f^uS\311x\n}S\re.\302\337\221\007"
+	.ascii	"3\203\200\200}\212\\S\001\003\271zT+0h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 m\225\002"
+	.string	"\302\304\020\035\240'\351\377\377\017|\254\252*\336O\r\212\265\027\200\243\n\306'\326\3160i\204\310\224\002\016j\306/\336*&X\2317\256\321yt\266\211\231\344&\255\026\f\007\t\305\210\254\002\207:`\365*\371YD\004\004"
+	.ascii	"3\t_\316\362\312\034k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\271\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 a-\002"
+	.string	"r\004\r\026\320\2455@\001"
+	.string	"\300\025\226\002-SB\b\221\003\240$h\247\224\002Uf\005\032P\316\302GN\3026Pp\232\315\274w\316\207\314\312F\266\221\030\210+2\004\005"
+	.ascii	"s\306\212\031\351\316\b \304\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.3ec79f6f690bff15,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.38.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 \226e\004"
+	.string	"\344\007_"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\317\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\020(?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_compassConfig.40.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 7\215\001"
+	.string	"d\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\005\001\006\177\031\001"
+	.string	"?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\003"
+	.ascii	"/B\247\f=\200\""
+	.text
+	.section	.gnu.lto_compassDetect.43.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375`\031\002\025\023"
+	.string	"\246c\200J\300\322Q:*\002t!\207\321nn\"\031,\301\360f?,8d\034\241)\363\375\007\031\205\361\365\020M\013'{\373\302\005u`R\327\036v=(\022\034\004A"
+	.string	""
+	.string	"<L(c\336\267\351\264K\305\2415n\210 \262\311\336)\005i"
+	.string	"f"
+	.string	"j"
+	.string	"\376\320\211h/\2329k\027G\324\264[&0\202\360\325\345K\300\327\360$\340\253\002\027\315\265\227B8\377\341\200!)j\267\024i\220\351\254\035\254\037\2355\337v\220\352 \325\324\340\225\330yU\335,\314\357\243\271\035\f"
+	.string	"\267\013\037\003\242\024 \276\373\274\271\331L:r\333\371\fI\331]\317\f7\235;\344\266G\333\022\354\351\n8\373E\177}\356\247\317\335\017q\320\023\225C@\213]\234\251\037;\243\276 a\373\366\225h~\322wV\261\202Z\366w\272Yh\313\ty?\036\240v\313\003\257\206\020\276\262L\264\256\342O\262M;\222q\274"
+	.ascii	"\017\324\356\032x\365J\310\342i\321\371#\277\374\n\332s3\213"
+	.ascii	"\354\372\310P\t_\t|\254\234\326\2347\n\266S\0327r\274\217\002"
+	.ascii	"\211<\031\005\251g\272\277I\351\351\215i\204#\0336\323\307g\324"
+	.ascii	"\024\245C\351S\347\302\217\001m\362,b\302\335E\361y02+\241\335"
+	.ascii	"\375\210W\177\006|-y\332A3\247\f\016\355>\242C\321\333)\345\371"
+	.ascii	"\031x\335\235B3\245|\244\177w\225\023e\017(\333\004b\227\266"
+	.ascii	"\177K\201\374\211\322s\na\032\252\331\b\023\033k\214\\\221=\210"
+	.ascii	"\215/\031\226\361\325`\302\253%\200O\026\260\300\\'\256\023\023"
+	.ascii	"\222\n1\026j\230\tI\276^Zd0\221\034e\244K\214\024](\274ZD\330"
+	.ascii	"H\212&\003,{\211\215\"\214L6\212\252rOq5\320)4\264\306+^\207"
+	.ascii	"\336\3626\240\364\234D\200\337\322R\037\257x\267\036\323\237"
+	.ascii	"{L\317j7\265\364\001\027\243R J5\340\360\270\313' @\002\203\220"
+	.ascii	"\332\rR\233wy\225 \032\253\353Fv>\351\200g\245)\035B\033\327"
+	.ascii	"\320\t\030{F\006\036\232F\227\377H\354`\001j\302P\205F\272\270"
+	.ascii	"\253\006\377n\361\323R\034\013\230\021\225X^c@\023Q\216\023\362"
+	.ascii	"\332\366|\324\261\302Z\007\271n\200\037Z\207\316\026]\276q/\225"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_compassInit.44.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375`]\004U\035"
+	.string	"6\264\271H\240\330Qc\300\217&\375\001\335?s\362\027}(\247\003\t\325\354\266\200_,\003*\200?\220q\233\t\206\215\220%\375\371HQ[>\256\272\304\310_l\364\300\372\202O"
+	.string	"\363F\322+q\002\257\346\177\022kn\266\367\2262\245\240"
+	.string	"\236"
+	.string	"\244"
+	.string	"\250\205\363\245\215\244\001rs\"\177\225m\337\217\030\313om\022K\360\322\022\316\227\267\177\276\324\247L\233!CQ\330\2003\027IE\017\037\021\272\334|\370\"\277\033Aa\003\242\227I\303\016tx\274\367*x\351\005\347\313\231\327\230/\353\t\230/\335 \347\347\242\243PK\027:\261\260:\336\213\336l\016\333Zt\263$m-\362\215n\332\027UGc\351\017\030/iA\025\225$-\025V\230\200\340\n\022B\221!Q\377zU\n\"U;\013\302x\225\331\271\367\272&\005_\3342\267\275\263=d\223%\002<`\267L\313\255_l\364\250Z\241}\235\342\023\035\266O\366\211\367\354\254\2662\325\325\254>\255"
+	.string	"T\r'!\r;\206\336\2451`\256X\351\325\343\304\337\276\257u/\177\311\277L\363\357\347;\225\257\344]\366\006\030\355w\263.\251\303\351\206\254'r\021\221\350\r~\330\204\016\217 \354\337\223\364v\216Z\\2\215\022\033\036i\230n\312\372-?=\022\337\223\364L&"
+	.ascii	"K8d0x\351\016\347K\243\347\265|~\325\263L{I\223\343\306~\226"
+	.ascii	"o\365+\337\261\210N#\2463\3051#\313\275\001\367\362\204_\241"
+	.ascii	"P\323\261Rc\344b\016\213\367\353\263+!\305Y=\221\371%\367\216"
+	.ascii	"\327\377\365\363\212\210\230Q\rC^+\354:O\220[\266\305\332\023"
+	.ascii	"O\365\261\336y/\360IU\276u\033\260~q\265\326\036\214\205\030"
+	.ascii	"\273\302\251\\8\357E\322\361\213\237\202!CO\217u\020e\244\246"
+	.ascii	"a\027K\261\241\346<|\236\311\341R<\0040By\224\017!z=+\245\031"
+	.ascii	"\003\252\375\203\263\033l\034Y#\327\024\254\310e\273\"\260\203"
+	.ascii	"\336\304\\5\250{\257\216\317\344aB>\217\227\036\221\253O\312"
+	.ascii	"\231/\017\030\217\300:\306\237z8^\217\216g\346\004\016\310\342"
+	.ascii	"v>D@;\037\tA>9\232og\002\267+\203p@\3268\017\200~rprpl\b\f\t"
+	.ascii	"\345\254\177lx<\037\0229\335\317\215\267\323\361\206p\274\333"
+	.ascii	"\220\220O\356\366\263\343\335l\fXG\002\267\273\231\320\351v7"
+	.ascii	"\032\n\274}*2\275\003\264G\256\245Nl\300\255\177\352\247\021"
+	.ascii	"\314GY\226\264\251x\323\030\305\035&\251u\355\r\327\322`\221"
+	.ascii	"\354'\276g\243\2065F\213\306S\223\322\ng\326\272X\352b\247\\"
+	.ascii	"\241JI+\004`\224\022S\236\354&\253\2653\253d\023\2313+\342\210"
+	.ascii	"\025\244\352\205\224\"\036\265\030_\257\272(\230\001Z\250Q8\350"
+	.ascii	"\024RF\202*\221\202$I\032\003\200\002\221\271\264\003\020hH$"
+	.ascii	"I\2419\035#\377\305T\2308?\377A\241L\232xE\206\315#5\374\024"
+	.ascii	"\3214\023\030zh\232\300X9\205g\233\002\240V\271\323\370q\251"
+	.ascii	"*\223\304\274\032\301KjF\341\003\034\310\253\033\006!^\360\271"
+	.ascii	"\355\360\211\324D\2233+w\006A\223\210k\372\355C\320\244x\313"
+	.ascii	"\247\374\337\316\310\021\311\024^\305\214|\017\222\201\2008\354"
+	.ascii	"\034\344\327`M\217\202\206\345\222\372\374\247\354\017\370\""
+	.ascii	"\203\033Fy\013\n\216C\356\030B\322\235\003\247N\334w\037\222"
+	.ascii	"Y\301O)\257)\023\203SF\340\252\034\364\251\035\264\250\301?\327"
+	.ascii	"[z\005\246\002"
+	.text
+	.section	.gnu.lto_compassUpdate.45.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375`\245\017\rB"
+	.string	"\372i8\027AP\346\316\030\023\b\025\371\220"
+	.string	"\341I\313\n(\261\325\327\324\340\3075\247c\355\214\277\277X\233\312\225\212\200\221D\360\304\tt\322$\260\251\347\213\343\357\377\352\367\373\f"
+	.ascii	"3\001\"\021\"\245\2242\245\224\002b\001>\001f\001\005\352\274"
+	.ascii	"\357\214B@/\033\265\017IG\273\271t\347u\343\265\352\251\277\263"
+	.ascii	"\314\215\334\333\343\"\262\213\023\013\344\313\202\310[\235\024"
+	.ascii	"=.\"\241\321\274\265\271-\\D\"\321\303\023D\352\320\342\316\302"
+	.ascii	"\255\205\213H\037Z\314x\354\327\242\321h\363\360\316\330y\337"
+	.ascii	"\327\252U\316\320\266\232"
+	.string	"\026\231\217s\264\034\332W\334\306\242\002\t\371\262\270{\341\325\266\312\320\366\370\247\325\316\334S\232\212\333UV\360\360}\341\250|y_\350\025\027h[u\352\344\332j\332Ek\253\314.3\235\206>\337\306\333k\342\365y\337\027\353\211\024)[\376N\241\315\251\3526\322\2212iTD4\204<\032\223\204\202\212\304a\313\256j\372\356r\263\\\002\242\220q\262\2415\322\223>B\262g\304\225G:\271\327]D\336\356\300\265\035i\243\024y\300\207\027\261\\C\332\2124\321\\\017\315\351\3119\362\331\307\247\336\01776\263H'\321)\241\001\305\205\236\364\360 \036]\344\361\244\204\306\233\023\341\332v\3640E\352\330\322\364\366iH\233[\263,\327\226\216\020'x\007\256\315\255\327\324\351\217\306\216\324\351N\315\325\024\371\276\257\221\255Ez\300\327\330\322<Mb\243\277\265t\225\2215N6\033\355,\327\373\276\354N\266\266f"
+	.ascii	"\315\354Q\314\254\201\331\250\024\314W-\365\017\004Y\370\237"
+	.ascii	"A8\251\347b\372`\247\251\3277^;\025h\251\367\372V\363\221\346"
+	.ascii	"\205,\265f\367\367\217FB\022\220)\364\231/\343\263L\233\261p"
+	.ascii	"\001\003\206\265\325\367s\342\361\377\357&!\323\013\353\232\314"
+	.ascii	"Rk\214\177T`_P\024\312\377\373\276h\317V[@\230>\310\255\245\323"
+	.ascii	"&pvF\336YZL\007#\300\367e\266\223\273\257\303\200q\350\340\355"
+	.ascii	"\354\260>\027\201\260x4f\366\320_\302\332\367}\263\270\371\332"
+	.ascii	"\213\0307]\253<\026\302\333\331*w\210\265\325~\241\300*L/\344"
+	.ascii	"\"\223\272\242\017\217\366\370{}\220\031\212\346\037\307\334"
+	.ascii	"\375\276\020f\257\t]\\\215\245\273\001\321\231AW\351\326\032"
+	.ascii	":gu\264\271\252\2714Su^\363T\3435K\261\316Q\2553\201\326\031"
+	.ascii	"\252u\036\300:\013h"
+	.string	"\235\237Xg'\326\271\251u\016\300:3\261\316K\255\263\022\353\f\240uN*:#\025\235\217Zge\353\234d\235\215Z\347\242\326\231\250u\036b\235\221\255\363\261u6\266\316B\254sP\353\\$:\023\211\316C\326\271m\235Y\242\363\332:\253C\347\264u~\326\331W\347\3762\212i\023\237\204\013b\344<\374\207\217\036\336\354\267\266Z4H\364;t\270\r\375\361\211\220?\204\343\006\362\312k\264\261\035?\351\307\3703\\\206\307\020\372\342\033\337\003\251\325\245\275\320\332R\352\351N\250\240\227\222\353cza\001w!!\t\350\315/\343\323\325\212\237\f\354\343S$\376\207;OC\342J!~\220\036\342\360\271\3438Z\017\266k\267\256?|\237\323t\203\021]3\3748.\316\261\\\257\316\255V=5\245\326\230\372\316\363\226\353;o\352\271\256\326\374\b\003\001r\227\230P\241\307\211\347\314_\373\177\226M~\300\230"
+	.ascii	"\273\217\273\344\204\212v\342a\277\375TO\223p\217\204\004O=_"
+	.ascii	"Wy\330O \327W\246\227\353\221\276\263\\r\223\264\035\260\266"
+	.ascii	"\216\253\346.Q>\351T\254\255B=\363\030\243d\232]n\351\224"
+	.string	"\n\\P\324O\353\271\345\364\234\025)\334&M\326V\217r<\3020C\337\367]\233ie\320\376\335\245\315\264\256\317\240\3434\240k\307M\307.\024W\212\267\323\225\262\266\272\2762\320-\n\346\357\311\325\357,\r\307\265\322\276\371R\002\272a\007\017\274\235\354\324\342\3218\353\325\357\273n#M\302\302&[\323\317z\366\246[\032\204^\323\245&\375(\271*}\327\304(\025\365\343x(\370^\377\202n\325R\277\306\034g\"P\204\245efc\033B\204\221\261\214`\001\b\261\004\b\022 0P4F&\"C\211\021cff&\304\212,f\340\354,\214\004Y\231\030\326\231Y\331\331\210\2613\254\021\"\302\310\260\304\314\316\260\f0q\031\21113\254\022eefXE\350\333\375\276\020\256\340\307\206\371i\214\344\314n\021\327H\332\243Y9Jv\275*hd\325UU{U\337Qe\327w\264\352\273\354\242>\272\f"
+	.string	"\250\267\364$\360Q\237\302i\022\2765\324\023x%8jQ\006\374\323C=\022\236\200\037\260e\331c\362\300Z\214\026\001\337c\344\234\376\351{\316\263,\033"
+	.ascii	"\336\201e\001b9\341\364\r\002\241$\243\335a\257S?8>;\271\206"
+	.ascii	"&\237y"
+	.string	"\2302\370\232\030\t\022MxU0\311\252\251\250\3247\252o.E\023\276\271P\375\004,\0319\234\250\251\n\225)&\232~\f\005P\303\364\001\242,\267\236\016\005L\301\323\2370\375\226\\\037\223\257\007r\351\235,\245\274\t\030\001g\222\364K\257\352i\022*\371\336\016\274\357{\3748\245O\372Vr\207\006\300+)Yn==\t\230\202\247\327\001\370-\227\316\217Hh2\362\265D\227\364M\201}z\3356\370t\260\3718\356Nz!F\"j\205\275bEz\263\2734G\257\365H\377~jui|5\204V\254Gr\374y\364G9>\266 \345\017\211\023\222\374\242W\032\005\201S\250a4G\03533\"\"\222\024\244 i\f\261\005\304\030\346\334\231\007\021\360\250D\216\241\231\241)T\206\003\247J\035\325\273\022D\2659\007\324\372\037U\036\235E\220|\3034\202\231\013\r\276\321\356\201\233\357\325\300,\366\262\247"
+	.string	"\036M\204\250Q5\241\324\351\272\013\373=\177\fT\347\254\310\206W\036\270\353\341#j\016\203\330_\305\3564\"\242\376\023\312M~\227\234\245\226C$\210B8\210\275\262%\020\036\001\327H\362`\357USqv\372u\306x\355\247\301\235\3157\b)\215\032\n9'\321T\276\241A\200\357\246{\277\037\227_\244oU\\]\331\353\251\373\321*\340\374\234C\221\373\217 \217G\321+\2121oz\255\306X\264\020\245\326\352UM]\365No\376Zf\256\031\210HO\311\277\227\004\002\255\025\251\004IOn\362\357\275\340\351F\354{\364\253;\301\205\351<H\322\221\214\307Q\376\340\316\373\005\266y\2151W\265\021T\b\035\t[\310{\376 "
+	.string	"y\344\260\b\333\373\320\261\376m\362)\354\320\3675\006\354\0368R\240\2037"
+	.string	"\237\223\226O\270\230Z\025>\230&c\005M\"\2719X\375"
+	.string	"\321#7\205\242\307AL{\250X\t\253\310\r?\376h\351j\267\267n\360\b]8m\373\030\n`\n\362`n\244\203r\200{\302\023y,X\213\027\025\027b\213v}\256m\312Q"
+	.string	"\220t\020@\237\353\020R\317\221 \004\271\336\020ij\241\341\202f>\243\013 \216\274\026\223.\240f\202W\244oN\375n^\333\356{3\352\377\356}6J(\rr\321\246+\236\030\035\fP\021\372\311\376\006\234\032/O<\246\341\356H!O\271\265\346\366\326\265\351\024\373XO\276U\240\310\3622"
+	.ascii	"\nSe\331V\366x4\016\310\241\341\363\177,\345\207XW\006sK*kt\236"
+	.string	"\350\023\005t:\021\320\020\334\255\023\304D\333F\025M\203W\304\030$\001\371\367=\223*\330@\\K\214\3544\327\204`U\350\255\365\346\364\330y\021\250\250\253\037\300\324\036\365U4\376\335#\242\006G(Q\031\367\0134\001@Y\243+\252\242\230A'\376!\033=\r\325\266s\244\377QHu\307\225V&b\314\232\bb`\272\022AT\215"
+	.ascii	"\242\347\304\305j\251tZ!_\211\351h\n\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"e\006"
+	.string	"D\tN\001"
+	.string	""
+	.string	""
+	.string	"\002+\177\035\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002,\177\036\005\"\023\201\204\005!\037# \002-\177!\200\200\200\200\001\005)\025\200\003\0052\" "
+	.string	""
+	.string	""
+	.string	"\0053#4$5%*&('\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005&(gistry"
+	.string	""
+	.string	"\005$)"
+	.string	"*\0010\177+\377\037"
+	.string	""
+	.string	"\200\200\200\0016\177,1\177-\003\001\020\204\001\003\005\022\244\016\003\005\021\200\200\200 \001\204\177\004\005\325\001"
+	.string	"\026"
+	.ascii	"7C\231\177t\311\272\006\250\207\017\220\354/\205\030\301p\371"
+	.ascii	"\301h\f\223'97\006\271\201\334Xr\233\231\223\250\225\233\320"
+	.ascii	"\017\030\230%\207V\226\0069\322`\216\001"
+	.text
+	.section	.gnu.lto_.refs.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375 \235\305\003"
+	.string	"\022\t\033$\200U\031\016\253\342F\fM\003\030\221G\310\204L\310\024\340.T\025\223\357\270\235\222F\366\336{\357\275\245L\001\007*h\352\203>"
+	.string	"`\323\370\232\307\317\274\037\343\370\027\367[*\355\247\224?\351/)\207\364\037\345\216~\303y\006\343\213\307\025\216'\372\210\306\r\354\013\355\004\364O\271\263~\255\256\320\352\360"
+	.ascii	"q\226^!\336\222\351\217\004\003\024\004\001'\344\241J\024"
+	.text
+	.section	.gnu.lto_.decls.3ec79f6f690bff15,"e",@progbits
+	.string	"(\265/\375`\366\035m\222"
+	.string	"\032\364\3105Q RJJ\007\253\273\252{k\272\332\322\273\023\271\263\2319\317d\342\276\276j\276\246\252\376\255\252\256\246W\356\262\351\257\371\\@\312\325\367\352\035M\377\366\265"
+	.string	"\240\252\264\252*\253\266 "
+	.string	"TU\245\347%\206\036\346hikw\353\346\267m\244\221\275e\n\317\002]\003P\003YS6\275\275\321ul\300\301F\357\r\316\243\243\332\355\030\213\202\363\2463\307'g\023@ub\230A\330\264\347\330\226\323x\3579\035\307\247\331s\322\234\231\335\b"
+	.string	"\273\021\360\2619aji\203\037\347<<n\316\310)\261\351\337o\336wG\240|\371\262i\267\351\272^Kt\020o\273vs\037s\315k\316\031\250\357\2248U\3314\250I\250\266\317`\034r\356\022j\357\355u\t\365\035\305kJ4\3322Oj\r7]\2235\033p)\"g$c\\9\3474\255\246\327\246\3530t-\246\317"
+	.string	"\233A\271\371\305\313P\211!\025Oygj\372\026\177Q\237i\2706\323\3211\243\265.v9\347\037\032M\257}\246\347\3225\347\242\237E\004}\246\307\364[G\2550@+\033\022\032\002nE\371\272\242\246\3571\234v5\271\300\331\264\343Z\256\327.\323\321\374\363SG\204MJ\030\246\341w6\365\335\205\233L\267\365z\242\335\316\"\202\337\245X\006\313y\005\372\321\253\242W\307\246\357-\374>\241\366^\237P\337I\360;\013\277\177`\265^\353\265\331:\355\355Cs\271\320\232\263\227\234\363[\2305\030\023NN\017\336\276\354r^\213\330\272K{\271+\224\234\265\212"
+	.ascii	"\225\321\343\242\206\227\363*44\204\325\230\254-Q\323\027\361"
+	.ascii	"\337`\336h?8\316\242\244\261i\237\205\350a\025]\263\351Y\300"
+	.ascii	"\375\345\177\026\352\034Pn\270\331\364%\3406]\366\272\264\311"
+	.ascii	"\233\217+6"
+	.string	"=\b\370F\370.\3601\300\235\233\204\032\324#T\024\320\277\277\032\254\265\\\347\324U\036\313y\025\341\323\322f\205i\323\276\322a\275fi\261\247bW\031\232\363\372s\231>\340\316l\212\242I\250i\217P}\202\377\201\314\344\bn\361;\250\002uP\375\332$T\334#\316\242-\376\236\340o\271\254\277\331\376\216\203#q7\377\361\376f\240\347\177\235\0242\376\013\375\247\003\302\033\370\355\334\033\366\342\3667\001\177\313h\373[\204&c\342\267e\177\363\220 \347\377\357\267F\177k\360\267\213\2777\370\273\307\177\261\377:\360\367\225\277\327\277\261\374\r\366\267\225\277\303\376\026\033\363\267\326\337U\376\356\022\363\037\350\277P\177\207\371\033\355o\263\277\271\374\275\345o-\177\373\370;\377}\303\3375\374=\303\337\311\277e\370\333\3707\322\337\305\277\211\377\327\374\037\341o\031\177\263\360\267\001\177\253\177\377\374\255\302\337B\177\243\360\267"
+	.string	"\177\233\3607\t\177\207\3607\b\177\177\360?\306\3370\376\366\340\357\016\376\346\340o\024\177\037\360\367\211\277M\374]\300\177\021\376\006\376\327\362\237\350\277\333\177uooo\357\2676\374>\251_"
+	.ascii	"\271\321\247\023\212\265t\201U\325\304\372\341\204b\345e\363"
+	.ascii	"\311R\3043c-\235\320\234E\344fsit\225E8\241\271*\3370S\325y\305"
+	.ascii	"Z\346\346U\026\221\233\231\211\302\331\304\252rB\231U\"\234P"
+	.ascii	"\254\252\f\305\312A\271\311|\342h\346\247\210\f\305r\223\241"
+	.ascii	"WUAN\350U\225\023\212%\244\3558\357\202T\311\331ea\351\245\263"
+	.ascii	"\231sP\ra>\203\242\316\365*\323\345\334cO\371\231@\316C\256\236"
+	.ascii	"t\314\037\215\346\024\315\341\344\205y\325+\225S\326UnF\235R"
+	.ascii	"\256r\226\342\224\224\251 X\256\321\274\244\243K\255!y\352)g"
+	.ascii	"\002\250r^v\216\346\234\2279\347\337s\310\232s\220 '\027\025"
+	.ascii	"U\316VBTy\310\022\314S\316vl\rZ\225\023\232uU\004\306\007(W\206"
+	.ascii	"Z\227\315\225\351\260\236\030\272\314\222\247\336`\256*\036w"
+	.ascii	"6%\363\303\306D\016\024:\f\254\023\274\025\263Z16I\t\0378Q\331"
+	.ascii	"\345\347S\305}q\030\230%x\253\366^\255\232eK\273\315\263\356"
+	.ascii	"\211\227\237V*z\266\254\351@c\323\265\236)f\222\246\025|\037"
+	.ascii	"\225\240\005\003\304\203\346\r\2211'\366\314\247\313\330\032"
+	.ascii	"06\275o\007l\277\230M\t\341\003\226\"u\254\027\353u\345\354\216"
+	.ascii	"\232\262\340\017\0354N^]l\022$\2211xd%~]`\214 \031\353<"
+	.string	"\0379]se6\265bjK\263\026b\026\213\033\227\255b\305\202\311Y,1{\304z\311\241\263\003\263b\366\212\2258\250\335b\265\330,\326\207^\255\230]\305l\230\205\252Z\001.H\333P\032\035\2215>\351}U\370\276%~:\007?]c\277R\037pG\236\230\301O\331\360\307\232\204\332UB}r&\217\r\013^b\243tTI\252\367\205\212\225\322\253\235b\225\330)\026\211M\3024\343\3521\242U\205CM{\270xd\320\312l\372\364\b~\273a2\306\325bN\372\016\350\313\371\212\214\213\313B\261Oz\265[\226\207[\273e\233\364\035\220\271\346\347/\211\235\231\"CBC>9vt\334\340\364\251\023\376M\203\177\315\340\3377\374\313\206\177\261$\371m\226\325\352\273\376\355X\313\222\366\205\177\243\340\007\232\204\252\242\355pb\365A\245ueD\357\215\030\324\246k\032\255\202eJ\221_\027\256;]\210"
+	.string	"-)\362\306\016\t\002\204s\346\246\303\323\006\261U?\353\350XsQ1\023b\201\364j\203X\253\247EA,\017\373\003\330\\\363\322\002/A\332\360\204\206T'\216)[j\372\253\003\337\376\370\355\016\373\264>\354\325"
+	.string	">hv\236|\234\315\366\340i\256\031\332K\304,\227@\341\266+\272\325a\204\372\264Z\363\330E\013\363d\307\246\277\031\373\260\301\2176\t\365\267:ns\\'J\320\266\330\224J\310\204\245\231\330\034~\203\261i;&\234\234\036\304U\371m\224\305a\247\254\263W+e\231\267N\266\331\264R\366\206\205\032\323\302J\365X\003a\302\311\031B\232\025;+\325w\354\262\243Vk\336\341\202\027\217<\274\241! \270\037\266\270B\330\247\236\223\223\207\343\t\276=\202m\320\016\261Y\017\b\2227:Q{\327\323\340n\352\310\343\274\365x\240D\t\327\352j\271N\253\314#\205\216\347\020\025=Of`Pl*\366\223\002R6&\005\277\301\262\356\021:\037\220\\-09\036\356\023*o[.\327\365\352\250UPn~a\003\326c\256\226V\034W\330\315r\327{\345~],\275^\260\273\345\346\202\335$\267IG\225\270"
+	.ascii	"\203\263\353A\023g+\nL\263\336&l\315\365\272PnW\217\031\024&"
+	.ascii	"aU\256\225^\257\327\205J\374\324Q\203\027\246v]*hQB\240lz\247"
+	.ascii	"4\324MJ\313)J\257W\nT\017w\236\330\364\366\36068\226QRgK{\200"
+	.ascii	"\371\202\263\351y2>\316\303\307m\234\3403vD\342\322\340\3439"
+	.ascii	"|\225\334%\275\246\270Ll\223;dZ\332\360;\205z\367\366:\205z\314"
+	.ascii	"\206\217\321\360\177\217\\-h\033\234\270\253\325ov\016n\312\311"
+	.ascii	"\013\276F\356\016@V\320\220\224]\215\300D\256\314\246i\021\353"
+	.ascii	"\266\305EE\004H\367\204,\313\220\262=8@lz\205\340'\034\226\""
+	.ascii	"\004\221/F\204\330\364W\310\177\235n\220\032\366\356\3205\t\325"
+	.ascii	"\356(\372\005\322\023\027\306\016K\022\f\204\023\354*}\231\277"
+	.ascii	"=.\363\372\360@\315\315\270"
+	.ascii	":v\3719D\205O\fI^\324\352[\022\307ii\323[uy\\\035\324\246\346"
+	.ascii	"\206\030\301\277;\224\230q2\305\246\366\352\370}\376<?\260g\223"
+	.ascii	",\b\376\245\2729~\236{\347M\r\207M\217w\340\337\251\034\200\330"
+	.ascii	"\241\212M\257\024~\302N)x\326\210\265ib\323_\251\377\336\270"
+	.ascii	"O7\352\005;%\304*\b\233^\347\305\361\033u\241\362\215\202\340"
+	.ascii	"*g\346\215\002\262\2233\023\250\033\201n\004R+Y[]\324\364?=|"
+	.ascii	"\273&\241\002{\204z\235\212~\233vk\314\315\315\246?\277(\006"
+	.ascii	"z\nZ\275\276\371\346~\023\312\313;\024P\306\340w\277\251A9\202"
+	.ascii	"\267v\356X/\024\314\240\234\217\214\341\"\303\377y\341 \247\340"
+	.ascii	"-\235;\233g\275pF;a\313\331o\t\376\317\n\003\341\005-\234\266"
+	.ascii	"r\356\354\034\233\226\346\261\314\334\001\001\231\350\252\342"
+	.ascii	"?\036\370\277)\374\266ij\210'\301\3337\253}\323o.\254\256\226"
+	.ascii	"w(\252\254s\274\360r\036\243\302\207%gN\2252\030(\f\020\007\302"
+	.ascii	"\272\301Y\210\314\352\3634\246F\207\335\255\233\327\245vyxP6"
+	.ascii	"\265A\330\264\020l\240@\177\324\361|e\301\361\250k\303\223\326"
+	.ascii	"%lM\227\317ZX\016cc\225\224\370\355\210\212\201R\303\300\265"
+	.ascii	"\340\255"
+	.string	"\0325\266\255\227O\016\254\320\261\203Rr\203I\030\006R\t\336\246y\2576\215\315\341\302j\315K\325,s\320\206\t\234.\034$w\346gZ\017\347\030k\335\323\013\b\313\212\034\225&X\0043h\335\354\333-\234\375\001\316\316\341e\316\3135\353\b J\266\262\n\366\340 S\267f\315\334\316\375\300\355\210\023\307\2466\316\226i:y\223\244\314m\024\013\031*mT<PI\260t\260r\226\371S\006\2077\307\246\217c\321\376\363\370\362\021.V6\275J\004\337\376jf>s\316;|k~:\371\274}\335\301\377\247o'\360?\3157\205\234\227?\330\301\301Q\316\230BP\344\373\002O\"R\036\213JG\310\341\022\fI\237\025\304\031\003\330\230aT.\215pt\314\240Xc\230\034\361$\"\002\222M\032,!m \375<\211(\004\0310b\254P\026\221\220C%\212\030\210K4^\024\221K/\200l0-\275"
+	.ascii	"@\371$\"\246\246%$\222\020YT\026\225\206\310!\323\n\005\212\311"
+	.ascii	"\236\343\f\353K\n}\224\302#\022\223\357\210\304tk0&S\033LK\304"
+	.ascii	"\024\251d\272\377\261\201T&\215H\305\023\204\002\034\025\177"
+	.ascii	"G\305dSJ,&\177\037*\207GH!\022\023\021\0209L\"\246\312!\re1Y"
+	.ascii	"<\001\211\351\004\r\303\007\210h\030\002\213\210\216F\021\230"
+	.ascii	"\224\2122\202R\026D4\206/\224\352\223\210\210\302\242\222Qyl"
+	.ascii	"B\256 \3168 \2114\244\301AQ9T&C\024\225\303#&\024\224\212\312"
+	.ascii	"\244\215\030\001\324(\032\365(\211Ee\321\350\347D#\262x,\"\341"
+	.ascii	"C \201\003\022P@\303\357\024X\360\200\005\017\250\247\300\202"
+	.ascii	"\242\"\013$(\302\227\240\350*g\030\236\360\302(\203\023\225H"
+	.ascii	"C\245\213\213\302\030HC\245\236\244\020\3118\343\270\364\002"
+	.ascii	"\350\b\210\247\210\034\316p\204\034&\371(\205HC\031K\306\037"
+	.ascii	"\322P\206\222\251\t\211,*\217F\037\245R8\243xT\342ID3\fm\334"
+	.ascii	"d\0014h,!\323$\242\322\310\344K\026\233h\fk\250M\302\244\222"
+	.ascii	"\021)#I4*\r\2176\214\224IHF\0323H\3140D\336%d\261\005\244\241"
+	.ascii	"\322\357I'\222B\244\241\222O)d\321\342\205Q\006HC%\365\270dT"
+	.ascii	"\016\217F\032\304\242\021\321\250,\036\221\206J#\224OZ\240(\034"
+	.ascii	"\n\201G$#\215\f\222\302\032E#\244\241\022V\032\2170\224\306\243"
+	.ascii	"1E*K \036\23388\032\026O\020AciI\003\241O)\224\240Hy4\376\216"
+	.ascii	"\206Ed\252L\n_\260\200\361\202\005\f\036U)\244@y46\375\222\311"
+	.ascii	"\"\362\350h\370#\2620\336&\241Q\262\t\206\236'\021%\233`X\221"
+	.ascii	"D\026k\030\221G%\276\304TD\256P.-!W\364$\205F\246\030E\242\261"
+	.ascii	"F\361\250gF\321\250\310dC\206\020F\t1z\212\304\343P\231<\032"
+	.ascii	"\261RH\002\214\364h,\341\230$\252F\246\344M6\301p\337\242\202"
+	.ascii	"#b\004-\"hA4\342\025T\360\002\005\n#t\200\211D\311\344\220Ii"
+	.ascii	"\211\270\"\211\\J\036\213\311\025G\343Pi\005\021\231\\Ad\242"
+	.ascii	"\314E#\003\242$+j\3230Y]TJ\356\307\226(\346\217\033w\303\240"
+	.ascii	"\365X\202\306\246+\230\217\016\035M\256\336\314\242l\316\354"
+	.ascii	"\\7\313f\335\240P^\353\n\314\233\3231\207L\333O\220\037\204\314"
+	.ascii	"\271c\256\017\266\"Vf6\005\002\222\226v\303\b]\3354e\272\212"
+	.ascii	"x\251_eQQ.\333o\0305\267,0\233^\265\273\326\344\312\b\2255\353"
+	.ascii	"c+\307V\234~\313\222\303\346\254\r\003U\235\235]\264\026\313"
+	.ascii	":\204\256d\241\242C\372\225\206\352\f\315gF\312\223.O0\220\224"
+	.ascii	" \331\311\256\231\320\325\362\356\201\257\035z\b\203\227\263"
+	.string	"U\020FZ\017\3475\273^|\232D\246\270\261^\312n\034h\020dk~\344\352\207\332\355\322a.\240\343\024\342\006\356h\360\227\313z\271\3304\027c\231Y\025$S\265e\205\227\237cT\210p\022\355Z\303@\267\340\357\226\273\305\266\245\315\240\234\263\200@\003N\341\"6\227\005\003\353\254~\261\002\202=\250\"\251@\207\362\030BJ)3#4\243i\322\001\322\t\020\206\002z\232\352e\017\022\300DA\217)\007\r\321H\222\244\222a\f\b\322\205-\333\007\331`\037\025\212\346U\331\033\235~D\223\002\023I^\016\0320\341\032\211\265Y<\255\016F\2422zCC\023by\261\224\025\330\231\260H\210\317\274\257\203\3358\314\305\3573z\222\323\032\235\034Ei\255\221\031\007\261\030\263\214\243`\324.\r\246\"e\241\213V\035l{\214{\201\245\234j\331\234\256V\2112\020\220\372\217\335\256\241\251\263D\245K\223\312\215"
+	.ascii	"Yu^\315\263\"E\247U\234d\025p\324^Y5\260\3437\356}\260\257\263"
+	.ascii	"K\354\212W\340qKxyK6\245\270)\2553\372\275\222!\f%\013Ez\357"
+	.ascii	"AM\023\007\235\217\323\306\004$\231\232)F\263\372\2058eg\374"
+	.ascii	"\375\265\033\216|\335+\005t`OX\227\305\257\337\266\275\331x0"
+	.ascii	"\307\202\320\324\317\025\211>9\353\022\323VM\327(30\215Q\205"
+	.ascii	"\316\242\354\025ld\276\2022\330\224\337\r\231\222.0\353\013\316"
+	.ascii	"yh\2714\362\357h:\226 \372E\210-\233B`\262\032\335\250$\211\037"
+	.ascii	"\314l\317\236\035\2439\350\212\232\260\201\366\203\247\0311\004"
+	.ascii	"\344e\273\331\fpqx\310\005\262\354\023\324\240\345\204@de\221"
+	.ascii	"]&\373\356\354\250\313\024kzBr\260\f\262\364\332\301b\221j\366"
+	.ascii	"\245\232\036\304\356\220\016\246\373Ao\233\215\026\326\366\212"
+	.ascii	"\223\265#\013>X\311\036l\210\210\b\215\270x\002\3072\032\245"
+	.ascii	"u\033q\350\241\022inG\261\360\006\324=.,\204\020\361\025\357"
+	.ascii	"\3230:\254\242q\221\\\240\346W\223\b\204\334G\201\220\261\254"
+	.ascii	"\216L\020TL\322s\333a\247\3366i\260\212I\216Y\313\215\370*7\305"
+	.ascii	"\332=l\"3\235\"\315C\302\213\235]\232 \217\320\317)\211\f\030"
+	.ascii	"\261A\361 \312\034\337\354E\001>\177\376\236S\374\241\207\002"
+	.ascii	"`\310\271\371i\216\341\227\214-\217\230\361\t\353I\177\362*"
+	.ascii	"\002it\214a5\267\360\320#\345c\023\024\334\316\305Q\321\352R"
+	.ascii	"A\177\223\t\270K\307t\376\250l-\254\225D\241S\261\324\210E\b"
+	.ascii	"\327,\247\3660~\226\262vr\311\226\222\270^\325@\241\265\207/"
+	.ascii	"\350l\240\034\320\375~\244\343\206U\022`\236I\223\235\236\354"
+	.ascii	"<\307E\204\326\266g\035\243T\265\376\262q&\024ON\rk\246\226\362"
+	.ascii	"U\252\2542\215\027\305q\361\300\200:\306\036\257\357\307\245"
+	.ascii	"\355\246=\262\340\307\\\020\024\256S\223\223\304f\2106\204\302"
+	.ascii	"O\336\271D5K\031\250\362\234Q#\211\027\254@\255\310\201S\241"
+	.ascii	"\311\005\347\374\352\222`\271\311;\254lzl\273awkL\2655\017\226"
+	.ascii	"\022\007\315\213\226\346p\266\274\001\013h\356%\366:z.\362\314"
+	.ascii	"*\n\316\331\035\202\021\334\206\016\354\254\024\363]9,`p\263"
+	.ascii	"\356\370/\330\331\212v7\02005Ur\252M\241\230S?r\025*\350y\323"
+	.ascii	"\234F\204\363.l"
+	.string	"v\341\273\003Yc)\373M\312\342\325'\201y\223\244\300daD\210\250g,\306\353\2648O\275_H\b\344\220\371\263Z}\200U\241\270\223Y\302\342l\256\244\202\213\226/\244\007\363\251\317\001\363VA\032k\213\306\214\355V\001\262\373\312\006y\314\030w\2578\211t\323?U\300X\357\257\251G\335\365zJT\374w\030`q\036\330\373\200\205\336\217\017\344)d\335`\273\202\343\003<\236\026\235\330\307&\225\\#\205.\0165mI \372\202\205f\270\001H\341\245_\200\260\0065\031o\021\321\303\335\017\232\315\333\204g\221J\256C\323\267\233\312\313\201Q\327\310\337d\300\033\273a\363\036X<a\350\323\244I\004C\001\002\265.!\031\300\212\016\232&\213$p\201\250D\3235\203\366\301?\312\\\310\020B^_\205\316\306d\335\353\316\2326Z\215\357G\367\2374\261\245\240)\352K\265\036\005=\220\371\030\214\202\316>"
+	.string	"\373\027\253T\001IQ1\027?8\241"
+	.string	"@+F#\2555\350\023v\032\257i\220C\024Bd\250\245\203\031\247\316\357N\035\021A\260zHl\361\315\341s\340\206oG`\"b\231\3477\030\266Q?\302//Q\306\356\220s'\035\252K\357\276P~\004\034\234\357\236sYv\013\344\217\331.\2765"
+	.ascii	"o{}\303\220W\330\255\243m\250\267\2637\354\335\350\360\202c\206"
+	.ascii	"\016)\r\226\370\363\262\347^\305\334(\r\035\2169K\327\035\225"
+	.ascii	"\021\302\233\350\207\026\275\006?\241\031\202%\346)\261T\031"
+	.ascii	"O_\201x\222\377\305W\304\362m\004o\310\341\001\373\213\201\333"
+	.ascii	"\306\272\213'm\005"
+	.text
+	.section	.gnu.lto_.symtab.3ec79f6f690bff15,"e",@progbits
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"pgResetTemplate_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ec79f6f690bff15,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8953 @@
+	.file	"current.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/filter.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/sensors/current_ids.h"
+	.file 9 "./src/main/sensors/current.h"
+	.file 10 "./src/main/sensors/current.c"
+	.file 11 "./src/main/target/SITL/target.h"
+	.file 12 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	current.c.4a6ee188
+	.weak	current.c.4a6ee188
+current.c.4a6ee188:
+	.long	0x7bb
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1204
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1075
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1076
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1077
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1078
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1079
+	.uleb128 0x2
+	.long	.LASF1080
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1081
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1082
+	.uleb128 0x2
+	.long	.LASF1083
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1084
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1085
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1086
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1087
+	.uleb128 0x2
+	.long	.LASF1088
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1089
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1090
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xb7
+	.uleb128 0x2
+	.long	.LASF1091
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xb
+	.long	0xc8
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xf
+	.long	.LASF1177
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xd9
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1094
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1095
+	.uleb128 0x9
+	.long	.LASF1109
+	.byte	0x2c
+	.byte	0x5
+	.byte	0x22
+	.long	0x19c
+	.uleb128 0x4
+	.string	"b0"
+	.byte	0x5
+	.byte	0x23
+	.byte	0xb
+	.long	0x104
+	.byte	0
+	.uleb128 0x4
+	.string	"b1"
+	.byte	0x5
+	.byte	0x23
+	.byte	0xf
+	.long	0x104
+	.byte	0x4
+	.uleb128 0x4
+	.string	"b2"
+	.byte	0x5
+	.byte	0x23
+	.byte	0x13
+	.long	0x104
+	.byte	0x8
+	.uleb128 0x4
+	.string	"a1"
+	.byte	0x5
+	.byte	0x23
+	.byte	0x17
+	.long	0x104
+	.byte	0xc
+	.uleb128 0x4
+	.string	"a2"
+	.byte	0x5
+	.byte	0x23
+	.byte	0x1b
+	.long	0x104
+	.byte	0x10
+	.uleb128 0x4
+	.string	"x1"
+	.byte	0x5
+	.byte	0x24
+	.byte	0xb
+	.long	0x104
+	.byte	0x14
+	.uleb128 0x4
+	.string	"x2"
+	.byte	0x5
+	.byte	0x24
+	.byte	0xf
+	.long	0x104
+	.byte	0x18
+	.uleb128 0x4
+	.string	"y1"
+	.byte	0x5
+	.byte	0x24
+	.byte	0x13
+	.long	0x104
+	.byte	0x1c
+	.uleb128 0x4
+	.string	"y2"
+	.byte	0x5
+	.byte	0x24
+	.byte	0x17
+	.long	0x104
+	.byte	0x20
+	.uleb128 0x4
+	.string	"d1"
+	.byte	0x5
+	.byte	0x25
+	.byte	0xb
+	.long	0x104
+	.byte	0x24
+	.uleb128 0x4
+	.string	"d2"
+	.byte	0x5
+	.byte	0x25
+	.byte	0xf
+	.long	0x104
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1096
+	.byte	0x5
+	.byte	0x26
+	.byte	0x3
+	.long	0x10b
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x1d2
+	.uleb128 0x1
+	.long	.LASF1097
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1098
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1099
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1100
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1101
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1102
+	.uleb128 0x2
+	.long	.LASF1103
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x20c
+	.uleb128 0x11
+	.long	.LASF1104
+	.value	0xfff
+	.uleb128 0x11
+	.long	.LASF1105
+	.value	0xf000
+	.uleb128 0x11
+	.long	.LASF1106
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1107
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1108
+	.byte	0x6
+	.byte	0x29
+	.byte	0xf
+	.long	0x218
+	.uleb128 0x1a
+	.long	0x228
+	.uleb128 0x6
+	.long	0x96
+	.uleb128 0x6
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x5
+	.long	0x247
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x13
+	.string	"fn"
+	.byte	0x33
+	.byte	0x16
+	.long	0x247
+	.byte	0
+	.uleb128 0xa
+	.long	0x20c
+	.uleb128 0x9
+	.long	.LASF1110
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2b
+	.long	0x2a7
+	.uleb128 0x4
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1d9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1112
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x2a7
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1113
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x2a7
+	.byte	0x10
+	.uleb128 0x4
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x30
+	.byte	0xf
+	.long	0x2ac
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1114
+	.byte	0x6
+	.byte	0x34
+	.byte	0x7
+	.long	0x228
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x2a7
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x6
+	.byte	0x35
+	.byte	0x3
+	.long	0x24c
+	.uleb128 0xb
+	.long	0x2b1
+	.uleb128 0x14
+	.long	0xc3
+	.long	0x2cd
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0xb
+	.long	0x2c2
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.long	0x39e
+	.uleb128 0x1
+	.long	.LASF1116
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1118
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1119
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1120
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1121
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1122
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1123
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF1133
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF1134
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF1146
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0x5b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1148
+	.byte	0x8
+	.byte	0x48
+	.byte	0x3
+	.long	0x2d2
+	.uleb128 0x9
+	.long	.LASF1149
+	.byte	0xc
+	.byte	0x9
+	.byte	0x20
+	.long	0x3de
+	.uleb128 0x3
+	.long	.LASF1150
+	.byte	0x9
+	.byte	0x21
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1151
+	.byte	0x9
+	.byte	0x22
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1152
+	.byte	0x9
+	.byte	0x23
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1153
+	.byte	0x9
+	.byte	0x24
+	.byte	0x3
+	.long	0x3aa
+	.uleb128 0x9
+	.long	.LASF1154
+	.byte	0x8
+	.byte	0x9
+	.byte	0x28
+	.long	0x411
+	.uleb128 0x3
+	.long	.LASF1152
+	.byte	0x9
+	.byte	0x29
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1155
+	.byte	0x9
+	.byte	0x2a
+	.byte	0xb
+	.long	0x104
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x3
+	.long	0x3ea
+	.uleb128 0x9
+	.long	.LASF1157
+	.byte	0x10
+	.byte	0x9
+	.byte	0x3d
+	.long	0x451
+	.uleb128 0x3
+	.long	.LASF1158
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x21
+	.long	0x411
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1150
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1151
+	.byte	0x9
+	.byte	0x40
+	.byte	0xd
+	.long	0xab
+	.byte	0xc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1159
+	.byte	0x9
+	.byte	0x41
+	.byte	0x3
+	.long	0x41d
+	.uleb128 0x9
+	.long	.LASF1160
+	.byte	0x4
+	.byte	0x9
+	.byte	0x43
+	.long	0x484
+	.uleb128 0x3
+	.long	.LASF1161
+	.byte	0x9
+	.byte	0x44
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1162
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1163
+	.byte	0x9
+	.byte	0x46
+	.byte	0x3
+	.long	0x45d
+	.uleb128 0xb
+	.long	0x484
+	.uleb128 0x8
+	.long	.LASF1164
+	.byte	0x9
+	.byte	0x48
+	.byte	0x21
+	.long	0x484
+	.uleb128 0x8
+	.long	.LASF1165
+	.byte	0x9
+	.byte	0x48
+	.byte	0x60
+	.long	0x484
+	.uleb128 0x9
+	.long	.LASF1166
+	.byte	0xc
+	.byte	0x9
+	.byte	0x4e
+	.long	0x4d4
+	.uleb128 0x3
+	.long	.LASF1158
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x21
+	.long	0x411
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1150
+	.byte	0x9
+	.byte	0x50
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1167
+	.byte	0x9
+	.byte	0x51
+	.byte	0x3
+	.long	0x4ad
+	.uleb128 0x9
+	.long	.LASF1168
+	.byte	0x4
+	.byte	0x9
+	.byte	0x53
+	.long	0x507
+	.uleb128 0x3
+	.long	.LASF1161
+	.byte	0x9
+	.byte	0x54
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1162
+	.byte	0x9
+	.byte	0x55
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1169
+	.byte	0x9
+	.byte	0x56
+	.byte	0x3
+	.long	0x4e0
+	.uleb128 0xb
+	.long	0x507
+	.uleb128 0x8
+	.long	.LASF1170
+	.byte	0x9
+	.byte	0x58
+	.byte	0x25
+	.long	0x507
+	.uleb128 0x8
+	.long	.LASF1171
+	.byte	0x9
+	.byte	0x58
+	.byte	0x6c
+	.long	0x507
+	.uleb128 0x8
+	.long	.LASF1172
+	.byte	0x9
+	.byte	0x89
+	.byte	0x16
+	.long	0xc3
+	.uleb128 0x8
+	.long	.LASF1173
+	.byte	0x9
+	.byte	0x8a
+	.byte	0x16
+	.long	0x2cd
+	.uleb128 0x14
+	.long	0xc3
+	.long	0x558
+	.uleb128 0x1d
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.long	0x548
+	.uleb128 0x1e
+	.long	0x53c
+	.byte	0xa
+	.byte	0x26
+	.byte	0xf
+	.long	0x558
+	.uleb128 0xc
+	.long	0x530
+	.byte	0x3f
+	.byte	0xf
+	.uleb128 0xd
+	.long	.LASF1191
+	.byte	0x53
+	.byte	0x17
+	.long	0x19c
+	.uleb128 0x8
+	.long	.LASF1174
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x27
+	.long	0x490
+	.uleb128 0xc
+	.long	0x495
+	.byte	0x5d
+	.byte	0x68
+	.uleb128 0xc
+	.long	0x4a1
+	.byte	0x5d
+	.byte	0xa0
+	.uleb128 0x8
+	.long	.LASF1175
+	.byte	0xa
+	.byte	0x5d
+	.byte	0xd7
+	.long	0x2bd
+	.uleb128 0x1f
+	.long	0x595
+	.value	0x10b
+	.uleb128 0x20
+	.long	0x57b
+	.byte	0x5f
+	.byte	0x20
+	.uleb128 0xc
+	.long	0x518
+	.byte	0x65
+	.byte	0x1e
+	.uleb128 0xc
+	.long	0x524
+	.byte	0x65
+	.byte	0x5e
+	.uleb128 0x8
+	.long	.LASF1176
+	.byte	0xa
+	.byte	0x65
+	.byte	0x99
+	.long	0x2bd
+	.uleb128 0x21
+	.long	0x5bd
+	.byte	0xd1
+	.uleb128 0xf
+	.long	.LASF1178
+	.byte	0xa
+	.byte	0x7d
+	.byte	0x18
+	.long	0x451
+	.uleb128 0xf
+	.long	.LASF1179
+	.byte	0xa
+	.byte	0x9a
+	.byte	0x1d
+	.long	0x4d4
+	.uleb128 0x12
+	.long	.LASF1180
+	.byte	0x5
+	.byte	0x6e
+	.byte	0x7
+	.long	0x104
+	.long	0x602
+	.uleb128 0x6
+	.long	0x602
+	.uleb128 0x6
+	.long	0x104
+	.byte	0
+	.uleb128 0xa
+	.long	0x19c
+	.uleb128 0x12
+	.long	.LASF1181
+	.byte	0x7
+	.byte	0x33
+	.byte	0xa
+	.long	0xc8
+	.long	0x61d
+	.uleb128 0x6
+	.long	0xb7
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1205
+	.byte	0x5
+	.byte	0x6a
+	.byte	0x6
+	.long	0x639
+	.uleb128 0x6
+	.long	0x602
+	.uleb128 0x6
+	.long	0x104
+	.uleb128 0x6
+	.long	0xd9
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1182
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x659
+	.uleb128 0x6
+	.long	0x96
+	.uleb128 0x6
+	.long	0x7c
+	.uleb128 0x6
+	.long	0xe5
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1184
+	.byte	0xa
+	.value	0x112
+	.byte	0x6
+	.long	0x680
+	.uleb128 0x24
+	.string	"id"
+	.byte	0xa
+	.value	0x112
+	.byte	0x28
+	.long	0x39e
+	.uleb128 0x25
+	.long	.LASF1183
+	.byte	0xa
+	.value	0x112
+	.byte	0x3c
+	.long	0x680
+	.byte	0
+	.uleb128 0xa
+	.long	0x3de
+	.uleb128 0xe
+	.long	.LASF1185
+	.byte	0xaf
+	.long	0x69b
+	.uleb128 0x7
+	.long	.LASF1183
+	.byte	0xaf
+	.byte	0x2e
+	.long	0x680
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1186
+	.byte	0xa1
+	.long	0x6df
+	.uleb128 0x7
+	.long	.LASF1187
+	.byte	0xa1
+	.byte	0x29
+	.long	0xab
+	.uleb128 0x7
+	.long	.LASF1188
+	.byte	0xa1
+	.byte	0x3b
+	.long	0x1d2
+	.uleb128 0x7
+	.long	.LASF1189
+	.byte	0xa1
+	.byte	0x47
+	.long	0x1d2
+	.uleb128 0x7
+	.long	.LASF1190
+	.byte	0xa1
+	.byte	0x68
+	.long	0xab
+	.uleb128 0x26
+	.uleb128 0xd
+	.long	.LASF1192
+	.byte	0xa9
+	.byte	0xd
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1196
+	.byte	0x9c
+	.uleb128 0xe
+	.long	.LASF1193
+	.byte	0x8e
+	.long	0x6fb
+	.uleb128 0x7
+	.long	.LASF1183
+	.byte	0x8e
+	.byte	0x2a
+	.long	0x680
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1194
+	.byte	0x85
+	.long	0x71c
+	.uleb128 0x7
+	.long	.LASF1187
+	.byte	0x85
+	.byte	0x25
+	.long	0xab
+	.uleb128 0xd
+	.long	.LASF1195
+	.byte	0x87
+	.byte	0x14
+	.long	0xd4
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1197
+	.byte	0x7f
+	.uleb128 0x27
+	.long	.LASF1206
+	.byte	0xa
+	.byte	0x73
+	.byte	0xd
+	.long	0x750
+	.uleb128 0x7
+	.long	.LASF1198
+	.byte	0x73
+	.byte	0x45
+	.long	0x750
+	.uleb128 0x7
+	.long	.LASF1151
+	.byte	0x73
+	.byte	0x54
+	.long	0xab
+	.uleb128 0x7
+	.long	.LASF1187
+	.byte	0x73
+	.byte	0x6c
+	.long	0xab
+	.byte	0
+	.uleb128 0xa
+	.long	0x411
+	.uleb128 0x28
+	.long	.LASF1207
+	.byte	0xa
+	.byte	0x68
+	.byte	0x10
+	.long	0xab
+	.long	0x788
+	.uleb128 0x29
+	.string	"src"
+	.byte	0xa
+	.byte	0x68
+	.byte	0x3a
+	.long	0xd4
+	.uleb128 0xd
+	.long	.LASF1199
+	.byte	0x6b
+	.byte	0x25
+	.long	0x788
+	.uleb128 0xd
+	.long	.LASF1200
+	.byte	0x6d
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0xa
+	.long	0x490
+	.uleb128 0xe
+	.long	.LASF1201
+	.byte	0x45
+	.long	0x7a3
+	.uleb128 0x7
+	.long	.LASF1183
+	.byte	0x45
+	.byte	0x28
+	.long	0x680
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1202
+	.byte	0x58
+	.byte	0xbf
+	.long	0x7ae
+	.uleb128 0xa
+	.long	0x513
+	.uleb128 0x16
+	.long	.LASF1203
+	.byte	0x48
+	.byte	0xab
+	.long	0x788
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.file 33 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 36 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.file 38 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 39 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 40 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.file 41 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1067
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.file 42 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1074
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF950
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF956
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF974
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1061
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.37.6498376d1e1396b14288709c9edf6d99,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1208
+	.long	.LASF1209
+	.long	.LASF1210
+	.long	.LASF1211
+	.long	.LASF1212
+	.long	.LASF1213
+	.long	.LASF1214
+	.long	.LASF1215
+	.long	.LASF1216
+	.long	.LASF1217
+	.long	.LASF1218
+	.long	.LASF1219
+	.long	.LASF1220
+	.long	.LASF1221
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1222
+	.byte	0xa
+	.long	.LASF1223
+	.byte	0xa
+	.long	.LASF1224
+	.byte	0xa
+	.long	.LASF1225
+	.byte	0xe
+	.long	.LASF1226
+	.byte	0x2
+	.long	.LASF1227
+	.byte	0x3
+	.long	.LASF1228
+	.byte	0x4
+	.long	.LASF1229
+	.byte	0x5
+	.long	.LASF1230
+	.byte	0x5
+	.long	.LASF1231
+	.byte	0x5
+	.long	.LASF1232
+	.byte	0x6
+	.long	.LASF1233
+	.byte	0xd
+	.long	.LASF1234
+	.byte	0xd
+	.long	.LASF1235
+	.byte	0xe
+	.long	.LASF1236
+	.byte	0xe
+	.long	.LASF1236
+	.byte	0xd
+	.long	.LASF1237
+	.byte	0xa
+	.long	.LASF1238
+	.byte	0xd
+	.long	.LASF1239
+	.byte	0xd
+	.long	.LASF1240
+	.byte	0xa
+	.long	.LASF1241
+	.byte	0xa
+	.long	.LASF1242
+	.byte	0xc
+	.long	.LASF1243
+	.byte	0xa
+	.long	.LASF1244
+	.byte	0xb
+	.long	.LASF1245
+	.byte	0xb
+	.long	.LASF1246
+	.byte	0xa
+	.long	.LASF1247
+	.byte	0xa
+	.long	.LASF1248
+	.byte	0xa
+	.long	.LASF1249
+	.byte	0x9
+	.long	.LASF1250
+	.byte	0x9
+	.long	.LASF1251
+	.byte	0xd
+	.long	.LASF1252
+	.byte	0x8
+	.long	.LASF1253
+	.byte	0x7
+	.long	.LASF1254
+	.byte	0x7
+	.long	.LASF1255
+	.byte	0x1
+	.long	.LASF1256
+	.byte	0x2
+	.long	.LASF1257
+	.byte	0x2
+	.long	.LASF1258
+	.byte	0x4
+	.long	.LASF1259
+	.byte	0x3
+	.long	.LASF1260
+	.byte	0x3
+	.long	.LASF1261
+	.byte	0x2
+	.long	.LASF1262
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1035:
+	.string	"PG_OSD_CONFIG 501"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1180:
+	.string	"biquadFilterApply"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1093:
+	.string	"size_t"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1051:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF1042:
+	.string	"PG_PWM_CONFIG 508"
+.LASF954:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1144:
+	.string	"CURRENT_METER_ID_VIRTUAL_1"
+.LASF1145:
+	.string	"CURRENT_METER_ID_VIRTUAL_2"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF924:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1130:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_10"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF491:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1164:
+	.string	"currentSensorADCConfig_System"
+.LASF1089:
+	.string	"int32_t"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1189:
+	.string	"throttleLowAndMotorStop"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1074:
+	.string	"CURRENT_METER_OFFSET_DEFAULT 0"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1088:
+	.string	"int16_t"
+.LASF1149:
+	.string	"currentMeter_s"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1148:
+	.string	"currentMeterId_e"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1043:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1070:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF989:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1053:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1063:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1199:
+	.string	"config"
+.LASF1198:
+	.string	"state"
+.LASF478:
+	.string	"__P(args) args"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1124:
+	.string	"CURRENT_METER_ID_9V_2"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF932:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1201:
+	.string	"currentMeterReset"
+.LASF1116:
+	.string	"CURRENT_METER_ID_NONE"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF820:
+	.string	"USE_VCP"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1190:
+	.string	"throttleOffset"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF992:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1038:
+	.string	"PG_PID_CONFIG 504"
+.LASF1173:
+	.string	"currentMeterIds"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF944:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1097:
+	.string	"ADC_BATTERY"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1101:
+	.string	"ADC_CHANNEL_COUNT"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF991:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1045:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF984:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF980:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1205:
+	.string	"biquadFilterInitLPF"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1171:
+	.string	"currentSensorVirtualConfig_Copy"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF515:
+	.string	"__always_inline"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1086:
+	.string	"long int"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF910:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1105:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1129:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_1"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1169:
+	.string	"currentSensorVirtualConfig_t"
+.LASF920:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1037:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1113:
+	.string	"copy"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF965:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF914:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1106:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF905:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF923:
+	.string	"Q12 (1 << 12)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1052:
+	.string	"PG_I2C_CONFIG 518"
+.LASF957:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF973:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF964:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1100:
+	.string	"ADC_RSSI"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1079:
+	.string	"signed char"
+.LASF1020:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1090:
+	.string	"uint8_t"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF963:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF926:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF1195:
+	.string	"iBatSample"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1031:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF998:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1161:
+	.string	"scale"
+.LASF1009:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1075:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1158:
+	.string	"mahDrawnState"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1004:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1107:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1102:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF721:
+	.string	"NULL"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1153:
+	.string	"currentMeter_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1006:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1058:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF931:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1029:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1012:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1154:
+	.string	"currentMeterMAhDrawnState_s"
+.LASF1156:
+	.string	"currentMeterMAhDrawnState_t"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF700:
+	.string	"__need_size_t "
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF933:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1083:
+	.string	"__uint16_t"
+.LASF935:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF929:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF702:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF949:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF985:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1168:
+	.string	"currentSensorVirtualConfig_s"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1044:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1203:
+	.string	"currentSensorADCConfig"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF938:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF941:
+	.string	"PP_IIF_1(t,f) t"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1191:
+	.string	"adciBatFilter"
+.LASF961:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF956:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1010:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF720:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1122:
+	.string	"CURRENT_METER_ID_5V_10"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1033:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF917:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF396:
+	.string	"bool _Bool"
+.LASF934:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1080:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF955:
+	.string	"IO_TAG_NONE 0"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF968:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1178:
+	.string	"currentMeterADCState"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1104:
+	.string	"PGR_PGN_MASK"
+.LASF1192:
+	.string	"throttleFactor"
+.LASF1202:
+	.string	"currentSensorVirtualConfig"
+.LASF945:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF930:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF795:
+	.string	"GYRO "
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF948:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF983:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1175:
+	.string	"currentSensorADCConfig_Registry"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF925:
+	.string	"NOOP do {} while (0)"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1120:
+	.string	"CURRENT_METER_ID_5V_1"
+.LASF1121:
+	.string	"CURRENT_METER_ID_5V_2"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1112:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1177:
+	.string	"SystemCoreClock"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1193:
+	.string	"currentMeterADCRead"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1123:
+	.string	"CURRENT_METER_ID_9V_1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF928:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF701:
+	.string	"__need_NULL "
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF912:
+	.string	"VERY_FAST_MATH "
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1183:
+	.string	"meter"
+.LASF940:
+	.string	"PP_IIF_0(t,f) f"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF950:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF799:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1188:
+	.string	"armed"
+.LASF958:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF967:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF1021:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1126:
+	.string	"CURRENT_METER_ID_12V_1"
+.LASF1127:
+	.string	"CURRENT_METER_ID_12V_2"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF993:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF822:
+	.string	"USE_PWM"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1085:
+	.string	"__uint32_t"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF939:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF1055:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1119:
+	.string	"CURRENT_METER_ID_BATTERY_10"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF977:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF969:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF976:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF1027:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1094:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF966:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF468:
+	.string	"__PMT"
+.LASF1041:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1157:
+	.string	"currentMeterADCState_s"
+.LASF1159:
+	.string	"currentMeterADCState_t"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF919:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1170:
+	.string	"currentSensorVirtualConfig_System"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF915:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF364:
+	.string	"__k8 1"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1065:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF1114:
+	.string	"reset"
+.LASF987:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1077:
+	.string	"unsigned int"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF906:
+	.string	"UNIT_TESTED "
+.LASF952:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1069:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF972:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1059:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1068:
+	.string	"ESC_DATA_INVALID 255"
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1073:
+	.string	"CURRENT_METER_SCALE_DEFAULT 400"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1048:
+	.string	"PG_VCD_CONFIG 514"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF943:
+	.string	"BIT(x) (1 << (x))"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1103:
+	.string	"pgn_t"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1146:
+	.string	"CURRENT_METER_ID_MSP_1"
+.LASF1147:
+	.string	"CURRENT_METER_ID_MSP_2"
+.LASF1155:
+	.string	"mAhDrawnF"
+.LASF1110:
+	.string	"pgRegistry_s"
+.LASF1115:
+	.string	"pgRegistry_t"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1151:
+	.string	"amperageLatest"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF514:
+	.string	"__wur "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF398:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1007:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1207:
+	.string	"currentMeterADCToCentiamps"
+.LASF397:
+	.string	"true 1"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1162:
+	.string	"offset"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF793:
+	.string	"ACC "
+.LASF1200:
+	.string	"millivolts"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1131:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_1"
+.LASF1132:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_2"
+.LASF1133:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_3"
+.LASF1134:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_4"
+.LASF1135:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_5"
+.LASF1136:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_6"
+.LASF1137:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_7"
+.LASF1138:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_8"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF1056:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF723:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF1005:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF797:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF777:
+	.string	"USE_NAV "
+.LASF1109:
+	.string	"biquadFilter_s"
+.LASF1096:
+	.string	"biquadFilter_t"
+.LASF1024:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1087:
+	.string	"char"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF749:
+	.string	"LED_STRIP "
+.LASF994:
+	.string	"PG_SERVO_MIXER 21"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF996:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF997:
+	.string	"PG_RX_CONFIG 24"
+.LASF978:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1036:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1160:
+	.string	"currentSensorADCConfig_s"
+.LASF1163:
+	.string	"currentSensorADCConfig_t"
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF988:
+	.string	"PG_PID_PROFILE 14"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF909:
+	.string	"sq(x) ((x)*(x))"
+.LASF1165:
+	.string	"currentSensorADCConfig_Copy"
+.LASF1076:
+	.string	"short unsigned int"
+.LASF970:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF748:
+	.string	"BLACKBOX "
+.LASF1185:
+	.string	"currentMeterVirtualRead"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1152:
+	.string	"mAhDrawn"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1204:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1014:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF922:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF1018:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF1039:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF927:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF951:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1030:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF990:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1057:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1111:
+	.string	"size"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF846:
+	.string	"USE_I2C"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF389:
+	.string	"SITL 1"
+.LASF947:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1000:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1091:
+	.string	"uint16_t"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1181:
+	.string	"adcGetChannel"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF904:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1078:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1002:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1066:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF1025:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1187:
+	.string	"lastUpdateAt"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1125:
+	.string	"CURRENT_METER_ID_9V_10"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1196:
+	.string	"currentMeterVirtualInit"
+.LASF971:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF847:
+	.string	"USE_SPI"
+.LASF1174:
+	.string	"pgResetTemplate_currentSensorADCConfig"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"__size_t "
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF756:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF959:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1060:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF999:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1182:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1064:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF986:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1081:
+	.string	"__int16_t"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF737:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1099:
+	.string	"ADC_EXTERNAL1"
+.LASF1179:
+	.string	"currentMeterVirtualState"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1176:
+	.string	"currentSensorVirtualConfig_Registry"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1015:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1011:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF911:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF918:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1167:
+	.string	"currentSensorVirtualState_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF738:
+	.string	"USE_PWM "
+.LASF718:
+	.string	"_SIZET_ "
+.LASF960:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF776:
+	.string	"GPS "
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1206:
+	.string	"updateCurrentmAhDrawnState"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1040:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF821:
+	.string	"USE_PPM"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1026:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF982:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1013:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1003:
+	.string	"PG_GPS_CONFIG 30"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF962:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_10"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1142:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_12"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1001:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1061:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1046:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1186:
+	.string	"currentMeterVirtualRefresh"
+.LASF1194:
+	.string	"currentMeterADCRefresh"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1082:
+	.string	"short int"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1017:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1139:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_9"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1141:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_11"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF975:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF921:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF907:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1150:
+	.string	"amperage"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1143:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_20"
+.LASF981:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF908:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1032:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF1166:
+	.string	"currentMeterVirtualState_s"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1022:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1008:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF902:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1184:
+	.string	"currentMeterRead"
+.LASF734:
+	.string	"USE_CLI "
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF936:
+	.string	"EXPAND_I(x) x"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1071:
+	.string	"ADCVREF 3300"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF946:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF916:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1019:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF974:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF1016:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF953:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1092:
+	.string	"uint32_t"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1117:
+	.string	"CURRENT_METER_ID_BATTERY_1"
+.LASF1062:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1072:
+	.string	"IBAT_LPF_FREQ 0.4f"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1034:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF995:
+	.string	"PG_IMU_CONFIG 22"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1023:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1049:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1054:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF913:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1095:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1108:
+	.string	"pgResetFunc"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF979:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1098:
+	.string	"ADC_CURRENT"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1028:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1084:
+	.string	"__int32_t"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1050:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF937:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1172:
+	.string	"supportedCurrentMeterCount"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF1197:
+	.string	"currentMeterADCInit"
+.LASF1118:
+	.string	"CURRENT_METER_ID_BATTERY_2"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF903:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1067:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1128:
+	.string	"CURRENT_METER_ID_12V_10"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF1047:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF942:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1258:
+	.string	"io_types.h"
+.LASF1243:
+	.string	"long-double.h"
+.LASF1250:
+	.string	"__locale_t.h"
+.LASF1252:
+	.string	"platform.h"
+.LASF1232:
+	.string	"target.h"
+.LASF1237:
+	.string	"libc-header-start.h"
+.LASF1235:
+	.string	"stdbool.h"
+.LASF1219:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1209:
+	.string	"src/main/common"
+.LASF1223:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/sensors/current.c"
+.LASF1253:
+	.string	"common_fc_pre.h"
+.LASF1218:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1221:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1244:
+	.string	"stubs.h"
+.LASF1213:
+	.string	"src/main/target/SITL"
+.LASF1241:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1217:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1251:
+	.string	"strings.h"
+.LASF1239:
+	.string	"features-time64.h"
+.LASF1222:
+	.string	"types.h"
+.LASF1231:
+	.string	"current.c"
+.LASF1211:
+	.string	"src/main/drivers"
+.LASF1220:
+	.string	"/usr/include"
+.LASF1208:
+	.string	"src/main/build"
+.LASF1254:
+	.string	"common_fc_post.h"
+.LASF1238:
+	.string	"features.h"
+.LASF1246:
+	.string	"typesizes.h"
+.LASF1249:
+	.string	"locale_t.h"
+.LASF1262:
+	.string	"esc_sensor.h"
+.LASF1210:
+	.string	"src/main/config"
+.LASF1247:
+	.string	"time64.h"
+.LASF1224:
+	.string	"stdint-uintn.h"
+.LASF1214:
+	.string	"src/main/target"
+.LASF1257:
+	.string	"utils.h"
+.LASF1256:
+	.string	"maths.h"
+.LASF1212:
+	.string	"src/main/sensors"
+.LASF1215:
+	.string	"src/main"
+.LASF1261:
+	.string	"time.h"
+.LASF1259:
+	.string	"parameter_group_ids.h"
+.LASF1248:
+	.string	"wchar.h"
+.LASF1230:
+	.string	"current.h"
+.LASF1216:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1233:
+	.string	"string.h"
+.LASF1242:
+	.string	"cdefs.h"
+.LASF1236:
+	.string	"stdint.h"
+.LASF1255:
+	.string	"build_config.h"
+.LASF1225:
+	.string	"stddef.h"
+.LASF1245:
+	.string	"stubs-64.h"
+.LASF1260:
+	.string	"config_reset.h"
+.LASF1240:
+	.string	"wordsize.h"
+.LASF1228:
+	.string	"adc.h"
+.LASF1227:
+	.string	"parameter_group.h"
+.LASF1229:
+	.string	"current_ids.h"
+.LASF1234:
+	.string	"stdc-predef.h"
+.LASF1226:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"E\006"
+	.string	"\324\bF\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\326\245\251\266\r"
+	.string	"\004\005\006\244\326\212\346\t\024\002\003\002\004"
+	.string	"\002\005\006\002\007"
+	.string	"\002\007\007\b\365\253\371\246\005\f\t\233\346\244\226\006"
+	.string	"\n\242\233\362\205\b\020\002\b\002\t\003\013\f\270\272\250\266\013\r\265\257\306\344\t\022\016\245\225\310\252\007\017\020\340\207\245\357\f\021\244\304\344\337\f\022\023\253\327\227\253\013\024\231\366\331l\025\240\342\234\212\n"
+	.string	"\030"
+	.ascii	"5\362Q\177\031\3318\020\007h\244\346\013\332Y!\0020X\271+e\204"
+	.ascii	"X\035\373\303\004\240\316`\325\b\220\001\001x\271\261;Oil(!\003"
+	.ascii	"e\377r\203]^\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375 f\335\001"
+	.string	"\350Z"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\006\b\001\001\n\004\001\f\r\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.ascii	"6\t\026j .\207\255j\226\212K9\356i-\346\260\\p*\323^\202\333"
+	.ascii	"@\033"
+	.text
+	.section	.gnu.lto_.inline.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`N\001\215\t"
+	.string	"R\31701`k\222\0160\264\247\200\372\330\220\254\336\026y\221\352\306\004DC\005\006M\374\3466o\377\337\340\202P\353\nF\241U\025s|\333Z\t6K\266\334)_\371\334\255*\273\314R\017\303D\003^\270\320\341q\220n\326\267Y\226jd<P\340\215r\273\312\021\022\212`S:S\275\213\r\213\243\312\271MD5\341\310\207\204G(\340\211\344\237\3150\325\314\232]eW_X\246\240\314\024\210L\275\373\253\270\251\234C\210\246r\216\215\232\201\247?\004-a\244\376e\232M\202W>\337\203\202dfA\0377\205\310L\202\243\277\361\237\260\346\n\231\331y\rR\343\205\231\231\330\350^\351/"
+	.ascii	"\375\303 Ff\266\227\256A. P\002Q\252\252\007\352\003\320G\262"
+	.ascii	"-\270\230\nM\030\215\210]x\035e7\024\344\270{\204\304p\366\204"
+	.ascii	"\013B\337\004\017c`\340\205\234KxL\350\205\213\275xB\2315\026"
+	.ascii	"\224\240\230n.\320\f\257C\332\365\240\371\204\242\360\330\240"
+	.ascii	"\306t\260\370\347\313qYx\315b\302;\307o\330\326(\332\321\335"
+	.ascii	"\261\r\247\206\031$\234V5\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\235\005"
+	.string	"\022\211\035'\2205I\007\357\364\227\237\303\337\321\317n#6#\032\266'\317\235]\201\377\030wn|\277\212mh\344\267E\016!2\311$\257\177\252\355\031z\313\367P\326\224^\353\035\375+\2051D\322\302\213[\222Tm\2656\017V\334\t~\340N\310\222\034(9\320\217U\203\013\020\004\002\032\262\021E\t"
+	.string	"M\023I\364f\3263\253\323Q\365p\365L\326\264\310\324\366\3223\341\214\031"
+	.string	"wF\013a\016\3235\005r\340b\341\005\035\016Ac@\004\325\313@\f\001a\210\013s\f4AS\210k\270\302@\036\212\227\b\013\204\030Z\3174\301Jp\266\250\fY"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\006\232\004\b\232\004\t\230"
+	.ascii	"\004\n\232\004\f\232\004\r\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"\205\004"
+	.string	"RF\024\037\240'\351\377\243\356\377\377]\205\324\371"
+	.string	"\177\037\216\r\373\377\277\265}d\222[s\2445\"e\n#\024\213\003\362\263\313\255\273Ih\037\024\315\022\373P\f*\371\366)(\017\024\320\371\224;E\213\361\243o\267\376\255\360\2347d\312\257lpuz&\002\033"
+	.string	"0\b\311\022X\303\200`0\360\n\240\017&\303\203\364\255\202\001\2717l\001&\200\003\n\363\023\324\002X\267&\"\r\243w\3324\024\244\300\005>=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.397f764beda7f9ae,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.17.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\225\t"
+	.string	"\026\222B:0\221\322\001\200\"h\322\225\fc\322\341f\0043oD\251\235\371-\302\nz\315j\r\233\r\371\326\300\310wW\275\214\b\022\326[\202\276u\242\351a\261\366\341\372#nKvJ\001/"
+	.string	"1"
+	.string	"4"
+	.string	"\005\335\245\347\240\356\322\240M\363P\266_\321\310h\271\331\335\311\201\034|\004\375\323\036\360\202\265\036\001\036v\327\361\005\343\270\271\333F\260\ra\377 1\373\263?v]I\214\201\315\356\306-gm\362E\304\366\355\207\240\375\261\007:\032\036O\363O\216\002~\306:\301n\f\306e7\\\260\202\347\322\341\003.\016\343{-D\262:\213h$\3416\305U*<\273K\362S,.\004d!\227>\253\273\f\315\324\270\342\315\261\346!\263\021\307\016[\221\373\260\337\331\3355\027.\225\030(%\231\034F\240JU\024%}\032\251R\264\326\325i~\325\373R\364\233)\t\023j\236\3527G\"{\023\264N\225\347\325\371\t\367\235\345b\2160\261\005\017"
+	.string	"A\263\240L\350\036\007\306\205\001\327"
+	.ascii	"z\3401\240\271\246\250\200wM\025\366\312\204\001\272L\004wn\321"
+	.ascii	"\316'"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.22.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\261\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\315\030us\334\007uq"
+	.string	"\005\001\006'\001\004\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.24.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.28.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375 \212\r\004"
+	.string	"4\007S"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\346\321\027\007yw\350\347\006yu"
+	.string	"\005\001\006'\001\004\201\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.32.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"\025\t"
+	.string	"\226\220>; \0057\035\207lA\201\020\313\003 \327\251o\001\216*B\201\230e #\361\241\320\342\370M\353R\360\266\3254\270\\\203"
+	.string	"\200\005"
+	.string	"\026Bl\367\003>\f\204\205\211k\232\220\275S\n)"
+	.string	"/"
+	.string	"1"
+	.string	"\3669\006\355\232\213\250=\312\210\241\262\331]:C\016^\202\376K>\020\232F\227\001\f\273k\031\2324\356y\333\035\333\036\373W\236\370\344\303_\376\207\375\262)*\344C'\224\346\310\222ecf\345\215-\216\344\004\261o\355<\331\026A\207\214\302\312n\306\b`W\027\314\210\003\230]\336BC\362\261^\030\307"
+	.string	"\027\273\244\316SW\331\004R\256\002Al['\301\201\311\203;\006\363\374\251\213\237\001j\227\364\3207\371\211\310\027\371\025\316>!N\253U\224Q\257v\036\247y\224\0039l4\253\036\375 \270\213\320*\ru]\245\034qo\355<\271\301cE\232\026.\220\263\364\362\207\017"
+	.ascii	"2\241\023h`\360\030<\346\002\2203\030\b\222\201\326 \212a\004"
+	.ascii	"a\\\023\311B\300/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.33.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\246\b\255,"
+	.string	"JO$\021E`\336Q:\367\212\305\260\r\315\321\376r\330\256\b\017\005\357\003\257\f\037@\270\340\035\002\036\354m\352\266\331\371\243\274[\240\246\364A\222+\"\r\224\303%^\004\342\233T'\346\316<7\361\364PV\331l7\271\223\f\370"
+	.string	"\354"
+	.ascii	"\004\001I8cz\333f&\013C\362F\324\023\250^}[\361f\262Z\334\203"
+	.ascii	"\2659\002gU\246\310\374[\343\263}\214\230 5\264\271C\371i\017"
+	.ascii	"\303?>\036\265n\306\007\363\013C\253r\357\375\335>\321l\354."
+	.ascii	"\223\fM\035\3007P\266\376\251u4\033\"\322!ee\342\3565\223p\313"
+	.ascii	"2\376E\213\317\345N\376\335\002\3618\371g\357\242u/5~\225`A?"
+	.ascii	"\216\234\221Joy,\005\002\202b>\027\2557\267R.\260\364\354H4\356"
+	.ascii	"\336\213\"\275\355\227\361\017\b\006\365\261o9\236\314Fz\323"
+	.ascii	"\322\034^<\342\356\035\203p\313 \322\333\241\n\364\202ze"
+	.string	"~\226\213\035\317\334\342\240{\215<\323\356\275\0228Bz\033\374\021\357v\367\"\336-\037\231\355|\214\311}S\307Ws\356\336\353\324K~|=\362_\366\240e\017\256\327\036\206{/\327e\017\037\347>371s\021\346\224LY\356E~\311w\3637+\370Mn\231\205\260~)\344\335>\355\027+\202\fs\337\031\225\203\371\201|Ii\363<c\250N)\275>\331\203\310\372\207\2015\302\231\2070\352\227\275\376\217\"]\315\305\325I\204\315\255\177\230\307\222\265\2230\177w\033\t\263\255\334\300Vf\360\253\274\300VV\320d+'\370UFp\3509\350\253|\300W\231\311Wy\311VV\262\225\r\374*\027\260\225\223\220le\002\277\312\003\276v>\362U6\362U.\362U&\262\225\005\244\225\207\322\312\001\322\312\3003\177\241\264\362\317VNOv\356\331\312\273\240\312\235V\256i\345?\360UY\343\200\317\275<\352"
+	.ascii	"]7\253\006\345\320"
+	.string	"\177\355'{3\237_\346k\230\177\\<\3634w#\361\234S\3034S\303\344\023E\263\265\273]6\\+P\257\217\026\217f\213\350\376\006\\]5\271\213\256\251)qN1\320I\255T\240\r\364\216\355D\345\252\267\300\351\034\251\223\220\372k\004\372\250\221\0064\2015Nq\272@\003\216\372kF}\364\267\027\265Q\234\023uQ7\321\332\377\3709\333\0301\335W\353\356]\035e\032\246\372\276\331\347\242\322=\347\263\201CT\024\317\003\210\372e\355\240Wsq\257\337HMe\034\3229\245A3\207x\236-\245\267{\357\023\037\317\345F\2240a\202wk\237K9\376\313~'N)n\fZA7\350]SyeA3\350\035\333\211\337\261\263\240+\310a\"\337\232ZAwS\031\226\f\323\224\240\203\335\324\265\251\214\202\240\023\364\277\350\016\345\024\207S\221\336\333\3654\007A+\311a\3263\261`\037z\240\203\375:"
+	.ascii	"\316l<\246>\320\274\247\222.\311\315\035\360\226\232\251\355"
+	.ascii	"S\031\226\254u\334\353\245\356\350\027\035\262\326\261\021\226"
+	.ascii	"\264>r\027z8\302>\352\201\346\225#\034\303X\034\032\205\037\206"
+	.ascii	"0\204\304!V\225\02084\n\215E+E,6\214\251\027VWR\274\242\221\352"
+	.ascii	"\212\306\024\025\325T\225oH\205U%,a\024j\230\362\261\005\013"
+	.ascii	"\024\206"
+	.string	"\303'a\205\tE\306\fC\243\320\005\226\tcQH\005\200\245&\030\255\206D\342\f)\247\"\361\252h5,:YM\t\253\234\244\210E\247\tK|\2055$:\031\257\256\210N\2771\344wo$\334\301\212\033\262\223\321\266\277\354>'\0257\001V\252\220\255 _\312\r\265\200\256u\224i\242l\206\372\007C\205\230\370\250z\226r\001\372\327Cm\237\312!I\350\231x\276\270]\276PW\327\245\353^d\023\260\003\364\323\006v\022\2332N\250w\235v/\252\fK\362\021K\345\301\320\264\352\250;\216ZJde\361n\177\315$\207\271\346\276\2633l\256\333\277\343\214L\033\241\276\232\007w\375\350\203H\263\232#\253\276\361Q\254.\217Z\236nq\274\215C\324\257\255T\331AL*J\315\234\241\006\200\242\250Q,\306\224rJ\315\214H\222\224$\035\260\002\221\241*;\022\200u9\fZ\026\211\221\244\365Y\3663"
+	.string	"~\257pW\225q\034\3520[\304\204a\017\346Y\265\320\244@/\304\207#\277\347\017D\020b\212CO3\367\243\217\"\245%\266\222\321\275\031\2221\n\243P\366\n\341\025M\337\001\207\342\354\362\265\265\211\205 m\247\034\266\262\023\322c\017\035\322>\202\235L\031<^\377\362\031|s\303\225\255-\221m\376v\0356\215R\212\207\243\211\030%\275\305\353"
+	.ascii	"\312E\203\022\255\333/{6@\2315^\224\363\333x'L\332\350\201a\264"
+	.ascii	"%\004?A\215\241pL\225\354\233\340\231Q\253_\245mZ\211\350\036"
+	.ascii	"(\037\205p\201\227\f\232\325[\026\370\222\347Y\210>\340>p\005"
+	.ascii	"\303(\317\321\246r#\305\267\303\255\027\242\267\0255\345\244"
+	.ascii	"\034\357>\227\330|\225\177\206U\213\374\210\233\311\351\357&"
+	.ascii	"\336,<ca\021\214=\220u\302\225\3214\\\375\b\\\004\017?g\233n"
+	.ascii	"%\017HL\302n\021M\255\n1,\211I]\302b\005Z\231S\305\277\212\032"
+	.ascii	"\215NEBa\363\2525*@\321\343v\261T\217\303y\016\327`\376\007s"
+	.ascii	"\272\270,*"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.34.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`.\001%\f"
+	.string	"\326\326P? Q\224\016\260\202\350\0012\2368\361X\207\212uU\237Al\003\352(<#\200t\211\301\321[\303\216\024h\004\030\331.\325N, \300\004\004F\275\\\2019\036G\255&(\177\331\312m\245L)="
+	.string	"<"
+	.string	"A"
+	.string	"\027\260{r\201b\367\273\370\200\344\320\337\007X\207\222[\254Cw6\215\177\250\275\312\302\004\325\215\335\275\024\303\273g\347\337\343\023\317Dz\002P\260\273N\317T\341\326\333.`{\201}\r\001+\347\210\217\030\2338\354\217\224z\301~dw\327z\262\237\372a\2465\323\231\351O\002\260\200a`\265Ka\225cA`\212\f\266o\377\353l\212]\251\221\340y\017\177\3039tO\215\002&\032\\B\016K\250rV\244\332\236\223\310\031\016.\"D\352E\305\325\376\034\204\212\313*\250\216\221u\250/<\0336\204\177\330$\273\253\361;\334C\310\3578t\004Q\336;\364E\326\3415##U\312\336l\020\304\250\351d0\026-r\361\003\215a8P\324\264\020vmZ\266\201\342v\201<\235\317\205i\333\205!\340\354A\324..\313\264\213\362\355#\253'\006-@J*\301\252v\347\037\330Ol\234\020\307\007\031"
+	.string	"A\263\340Lh\356\007V\271\227\222\241"
+	.string	"\317\250\354\354\f\302\030\002\213\001\351\300\023 \230*P\f\336"
+	.ascii	"|\267 \007\336\r\2030JI\313&\330S\021\021\252\260Y\227\211\340"
+	.ascii	"\316-\332\371\004"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.36.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\375\006"
+	.string	"\302M13`m\322\001\017-^\230\226p\247H"
+	.string	"<\t\0261&\326\210z\252\304\032\226\340c\036\254\335\215|\025\301!\230\260\200\3031\201)4\0030\352\240\335\244L)\236.\230\212\20203\275\013ZWE]\257ZP`x\023\274\336\245\300V\003\005\037\306\262\340\263l{\345$\204@\032\215p\224\0037H$\375\236o\030AgW\363\350s\274#\343c\334\331\001\313\307;\037\213\356\354\007\210|\264\201\204jN\017\024\221M\023{\323R-\354WV9\266\n\244\204H$\273\024\241\223\005\271\017\r\333\2678\263G\276u\366\037\317\304\247dw\237^<{f\3767\036\0207\332\023"
+	.string	"aw\235qSq\353m\037\330\226lg\004\b"
+	.ascii	"3\001{8\323\030\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.37.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\363\0055$"
+	.string	"\nA,\016J\220\330Q:\300\313\244\023\230\326\002\361\213\255.Pj\374\2766\274\321\b\340\312jzH\334\204\005\216\364w\313u\353\025(7\037\2728RX\200\004\n\363\340/\t\260\346\361t\306@\342h=\306\002\313 \273\377%\237l\"w\222\001\312"
+	.string	"\276"
+	.string	"\322"
+	.string	"\367(\264\b\265$\357\tu&\277\"!\n\t\307%\311{\215B\2675>t\266\036\311W\362%Ng\362\3431\336\026\346\f*\260+\263[.q\336\262\361|\226\023\363\355\266\336\230qI\260\200\245\315\225\302\001&\242\310\221\247\033\201b\230\031\001\321ueN\260"
+	.string	"\352\306'\236\217\001\273\002\273\327x\200+\234\267\270*\335+\363\257n\004\352E \327\356\275\021\306u\357=\300\006\316\333\240\0170o\313\343\230\267\f\305\314\345\306\035\367\307%'\216f\367\336\\\3538\324M[v\205\342\323\212j\304\251\250\233\266\251\027\267.^\232\370\222\252]35,\203\356\275?\276\246\230\022\326J+\272\367r%N\2658\323\316\314J\314\\\203\331V\t]\333j\235H\303\214>\f\304y\257\024\021\037\312\301\224\370=nY\304R=q\311\274}\177\213G1X\317\270\"a\214\335j\206\331(\254]\305\374\362v\016\346\256\354sV\3569+\363\234\225w^\374u\272r\316Y\031\347^\347\233c\375\002~\344\267\271\361\017\320\225q\307:\333\272r\255+\237]\231\326\225MZe\333\225\313\256\334]\271\232\225\377s#R\305"
+	.string	"\224{W\234\235\271Tl\327\217{\375\314\307=\321\361\027\337p]:f/\376:\243X\234YUaB+\316w9=\t\277\311\267\376\304\276HR]\335{o\\E,\256\342\030'Z\300\362*\201p\207\350^\357\304\351Z\300\233@X\272n\313\2122v\237\374\fc\004\b\0310:}\256Z\337\311\223\274\354W\311\356\r\236\310\234\341[\216\032\334jAb\001\236d\265\256\025\217\267!\207\230]UK\206q)\205\316e\013h[\247`>\257"
+	.string	"\013X9\361KN\327>\333\212\r\251hd\264\316\351\037+C\"7M+\033Z\3316\233\206F\303\3076T\261\375+<\212"
+	.string	"\220Bn\372^\017\n\226}\323/\033R%8\177\231\335e\373\034\207Dlm\353n\032\232\241\225\260\236\005\261uQ\320\n\375X'a#X\315p\r\262\306\313\256\232r\233\356\375\353W\201\244Q\357\275Q\315Of\200\366\200$\213T-\303\025)\24363\207\213\001\201\310\356\275D\374(\227\322a\207\204\204\206\370\345\001=^\212\264\213\220\372\320tG\001\005\261\353\241MK\273\0324\335\245>\233\242\276\017\037,\3244\361R\243\036/\345UHbz\340\304\243\200\216HS^/D\272\223\204.\365v\226\0310@\200\242D;\005C8\351\0034\335%5eH}\273\021"
+	.ascii	"\030i(eB{\275\037R\316\327\343\371\230P_\216Ii\267\224C\352\371"
+	.ascii	"rC?\314kB{\271\224\307\353\345n\306\340\313"
+	.string	"\3339xB\021*\301\02623\037\371\037\217!\212\221L\322\347\302\315\200c\216~=\355\323\265l8%Kl\254\247\305\360\026nG\230*\206\370\205\247q\272\247\255\326\220J\270\365\242\027$\225\313\016\316\316\224H\335\033$\260\323<}\\\357t\317\3270\251\323\265\3065Mlh%d\243{\341\255\263\313\223G\277\237y\213\323\001x\2501<\307\224B\210\215\210\210(LA\322\034\220\002\221)+;\020XW\264I\206\003\037m\006\202\302\265U\314\265bz\300\364\341hA\232\006l\300\370\001\215u,\311\210\243\364\027\206\215Y(\352\233|\357\301\215f\235\370\272\237\rsK\334?\307\336\220\210\"\226\360\204i\241\3764\336\035\r\247\360\033\022\017@\255$\024\330\312\327\213\231\333\311\246Z\262\257T\027)\021\203\200\215k\016\257\227\305`\264\325b#\237\332 \221\257\221\354(T\231\365\037\200'\276F8\033\243\206K"
+	.ascii	"\333\254\306i\236\375\\<\232\241\301\275\222\217\\~G\342\370"
+	.ascii	"I\321\306/\247\367$\013\023\034\272@\236\301\300\f\247\233[\335"
+	.ascii	"\200\002A\350\314\035B?\372\3101\3413\335e\270\277V3\345\f\f"
+	.ascii	"P\nbj\303\300*\301X|3\344\007\372\256e|\177%P\372\\\220\266\377"
+	.ascii	"\265\342\322Pn\346\375\001"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.38.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\003\001\275\013"
+	.string	"6\026O> Q\224\016\260\002\020\270\346[w\264\262\343\371X(\r'\021\004$\305\347"
+	.string	"\020\263{\270\370f\261#\353\315\002#\333\245\332\211\005\004ht\035\263\004#\217"
+	.string	"\004\022\252@\035N\016\267\3352\245;"
+	.string	":"
+	.string	"@"
+	.string	"+jQb\367;`\003\326\243\277\017\250\036\255K\252Gs\266\214\177\243\275\311E\005\323\214\335\225\020\303\271+\347\277\364"
+	.string	"]\310s\005\260`w\255]\310\302\ro\273\200m\006\366A\001z:\001c\225\206\375y\024^\260\377\330\3355\024\331\367\376\207\252U\325\267 *^\\ vA\0355\026\025Md\260}\373\037gC\354\b(\301\365%_\3037p\367:\027\260\001\016~\272\310\324\243\b\205\225\r/\305\203\207\320\030\035\007\212C\033\363\017&\tYdD\352T\217\220E\307aG\270\207\315\332\335\211\317\341\0356>\351\321\0238\372\356\321\347T\217\207\223\r\357\243\035\016\246P\020\3149\261(\270$\332\324LL4vi2S\3236\230\334\264l\313\314Mf.\026\214\304\264M^\004\234A\230\232\324d\231&!\337\376\261P\344\006+P\037H\301\nm\354$\346Gl\225\224\003\026"
+	.string	"A\263\240L\350\332\013\f\017\212\f\265*F\220b\267\303`\b\0263\030\371"
+	.ascii	"\026\240\030NQ\002\274ahF\351k\330,{j#B\2656\352\202\021\\s\013"
+	.ascii	"a>\001"
+	.text
+	.section	.gnu.lto_currentMeterRead.39.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\002\004\025\031"
+	.string	"6\255\237H\260\230Qc"
+	.string	"\026\2030\240G\317\032\261\371\371\035\026X\233\373\370r\266^I\340\017\305ZQ]\264\330\220\300\226<\021\222\300\232\267}\3358,\027\357\017\356\337\302\f\231\314`H\340N\336v~\020\307{Q\273m\271\245L)\210"
+	.string	"\207"
+	.string	"\216"
+	.ascii	"\347!{\023\321\005\334\213\264\205Ay\353\\\371\362\304<\375\016"
+	.ascii	"\177\351:dg*2\200{[\020\001\336\233\3131Nyk\363\031\362v\274"
+	.ascii	"\fyk\231=\345\271\030\367@f\210\3601\274\367\232\025\306e_\221"
+	.ascii	"v\254T\346\353N`\312\207\257x\247*\2025\333\355dy\273\r\001\202"
+	.ascii	"\216\377}@\224\256I\317v{\035\017\034\0359\021\300f4\316,q\021"
+	.ascii	"\345\272S\0226\032\245\253\005\367^\323\232\315\304]\336\366"
+	.ascii	"\314v\003{\304\t:*#\232\3053(rD\341\245Z\354\034\215\326$\373"
+	.ascii	"\265X,\026]\221lK]Z\352\225\245&\337\364\3273\375\2179\0168\254"
+	.ascii	"\342@\311\275%\212[\256\224\205\262\341\367\376\023r\252'\204"
+	.ascii	"\f}0T|B9dT\365\204l\326yC\357\341\3770\360\"\312\321\322\275"
+	.ascii	"\227uk\373\273\005\264\021wt\352\001oncn\273\2417\021\025\310"
+	.ascii	"]\023WJ1\2654\274\365}\f\331\254[\352\367\220\331,\373EhRz\235"
+	.ascii	"\237\013\027\001\265P\350\"hk\222\201\035\256\273\275\335\241"
+	.ascii	"\220>aY\302b,'\\\212\302\223\270\024\374\\\341H|r\246n\217\224"
+	.ascii	"UA\324\252\365\"T\312y\"CV5\207\366\202d\375\317\030\036\345"
+	.ascii	"\202\211\021\304\303\217O\203\210\274\255HjBg8\224\253\274\367"
+	.ascii	"\362\370\300?\275|\032\267\336\020\243\257\335\3721\362\226\254"
+	.ascii	";TL3Z\364\177w\351=1\271\323#\004\245\210Vj\275\35763\252\305"
+	.ascii	"/PF\230\274F\355H\252\326$\227\027\221\257\026\002\2603\350t"
+	.ascii	"Y\367\364$8O\036\237\035\035\231\013?\324-\235 \240\023\006\343"
+	.ascii	"\3202c\260W\f\350\214\231@?>.\263\005\213\231:5~i8af\320\353"
+	.ascii	"\0053Y\271\331\307[\221lq@b\325\254\322\354\373~\024\300a\225"
+	.ascii	"\277\373u/\235\340\224\210U\263\361\336{W\023NE\203\003\303\241"
+	.ascii	"\324L]\331\335\270\371yn\335\t\315\324\025\336]v+~<\302\r\340"
+	.ascii	"\356\304)\021\257\204\246\343G\322\320Z\355\007\020\350k\036"
+	.ascii	"\353\007\277Jp\021\035a\304\342\336O\2501<f\215S\202\023\021"
+	.ascii	"\t\223\026\244\240\r\320\002\021\271\333b\0210Ak\252Hi\251a7"
+	.ascii	"\016\021E0#\222<\024\242%\307\214\360\217Uv\001\321\202w\307"
+	.ascii	"\264c$O))\266\225Q\005\3300\306~\034\342\333dR96\203\240\205"
+	.ascii	"\214h\212\f\305\256-@|\2029j\206\023\nT\031;\2454\r\220\347Q"
+	.ascii	"\305aC\257Ld\350\377xZ\212\313;\224\361\350M\003\374\035w\221"
+	.ascii	"\370v.x\220,\233\332\220\350,\231CPkQ\016|\004)\263|,*\320T%"
+	.ascii	"\342n\276Q\274\235'\237\225\234\253"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.50.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\\\003\035\026"
+	.string	"Ff\210J\260\022R:"
+	.string	"Cf\2112\320\023\b"
+	.string	"\351\343V\313\rUU\226p\025\321\265d\247\375\205\317`V\347\247J\2162v\376(\355\212\277\332\336\350\345G\355\342\250?\360>\215x\271`\016\313\211\337\324\224\271e\271\204\220\332n{\247\024l"
+	.string	"x"
+	.string	"l"
+	.string	"\265\3445\355\334\213h\f\3706\004\017\204\353d\316\373|\027'\322\275\210\346\003v\177\272\204\273>\006\257^@\276\332\367\002\260W\362$\260W\373-l\347x\326\331[\367\005\355\225R\200@*\356n\371JO\\w:_:?\351\004\266\214\256\2009\036N?\374\210\217\232+`\216\210\317\221\277"
+	.ascii	"\254\354\256I\235\273\3366\004\333,6U\nPT\007\352\211\307S\f"
+	.ascii	"\013\024D\247\030\246\017oMT\247\252(\f\301\021\336z*\212L7;"
+	.ascii	"v\030v\314\270+\371K\007L\350\350\351\355n\3545\270Rc\263\257"
+	.ascii	"%\240\260W\024\331\t\342>D\"\253W\004\342\250\377\313\371I\216"
+	.ascii	"\331\316\375hf\262\354n\204\202W\377\247\263c\257\034<3m>\370"
+	.ascii	"\354n\003\020\034't\036\311\177q#\335\217f\034`\267\204\224\320"
+	.ascii	"\022\310\007V7\\\236\275\312\205\334]\024\177\352T/\276\320\253"
+	.ascii	"5\320\346oh\260\327S\024-\242\335\374\341\017/ \030\303\3066"
+	.ascii	"\235\002\025\321\330c\347\321\223^\370\222]\322I\254\035\236"
+	.ascii	"\221k'\005\222\372\177\237\363\350\037\335\021v\363h\372\242"
+	.ascii	"@\366_K\177lr\232\336\367Or\372d\002+\221\236]\234\037]\353S"
+	.ascii	"\207+\376\373\355\373N\217\212\t\031^\246SR\034\314f(-\017LH"
+	.ascii	"l3\231\031\255Zf\"\0033\263\331p\262\362f\253\335`f\267\022\346"
+	.ascii	"\245\205V\312l\267\322\004\201k\033f\266R\246V\263\225\363\257"
+	.ascii	"\245?\225Gh$\356h\315G\246h\354\346\361\337\341\025\211\273y"
+	.ascii	"<\317\220\221\270\243t\302sT8\226\213\312\320\026~\343B\231\365"
+	.ascii	"zE\251\212\026Q\024\206\327\230;f\360\211~\350\226\317p\t\t\222"
+	.ascii	"\321A\346\013\321\300^iJ\250A8\007\215B\246j\204\024%-\346\260"
+	.ascii	"\002\021*\343\016\021\200\265TC\246\244 \205\235\003@Z\355I\022"
+	.ascii	"\037\230\341:\226K@\354\350\204\247N\355(\343\222\254o\023\004"
+	.ascii	"\2000\204C\324@/\036\250\331\031r\243Q\205\343\007\275|\364\375"
+	.ascii	"a\215J\356\023\320\351`O\017'\224D\334\343,S\031\206=M=\247\f"
+	.ascii	")\004\231\214\361\245+\354\235A\222r\271\345)V\256\335\200B\270"
+	.ascii	"H4UL0\201\260\301\227\340%\276\036\265\201\324\340\245Em\262"
+	.ascii	">\347\353\214\322\025/\300?\307\220 \276\257\247\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`%\001e\b"
+	.string	"t\013!\002"
+	.string	""
+	.string	""
+	.string	"\0022\177\033\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005#\021\201\204\001\021\177\034\272\200\202 \177\035\005\037\017\005\022\f\200\003\002!\177\036\005\023\037\002\"\177 $\177!\002%\177\"\005\031#&\177$'\177%\377\377\377\377\003\005\034&\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\032'\005\030(setdata"
+	.string	""
+	.string	"\005\026)\024*\020+\017,"
+	.string	"-\001)\177.\037"
+	.string	""
+	.string	"\200\200\200\001(\177/+\1770*\1771\003\003\027D\003\003\026\204\001\003\006\031\006\030\304\017\003\t\027\r"
+	.string	"\323\243\362\362"
+	.string	"\001\302\n"
+	.string	"$ \240\002\231:\333\001\210\306\300\230D\267\007ai\030\353\001px\002\271\312\322\275-\314\207E\020\b\fL3\006\316\370\031\357JHw\n\334\203\210a\354\"\276\243\234\271\231\316\244c\332\013\022\035\322\034\306I\027a\204\017\317\312"
+	.ascii	"o\370\257\301\215\232\200=\001"
+	.text
+	.section	.gnu.lto_.refs.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375 \245\265\003"
+	.string	"\362I\033\"\200EI\007`&\004L\214\304H\214D\226\023\003T\032y@\370B\240/\372\255\261\331\356\337$\2212\005?D\260x@\006&\026\270\323g\372\325\035\264\033\036\331\206l?\366\214\375b;\221\276\333L3\313\034\t{\351+}\366\005}A\367\004\335\002\375\200>@\367\244^R\357Px\243[Q\377\324\203t\025\316\022\361f_{\376\003\001\001"
+	.ascii	"\202\300`\244"
+	.text
+	.section	.gnu.lto_.decls.397f764beda7f9ae,"e",@progbits
+	.string	"(\265/\375`\231\"e\234"
+	.string	"\332\375\2747Q0R\312I\007\257\273\252c\3553\277\263\331\355\311\251\237\377\337c\232\211^\322\321W\361T\337\325\303]\375\316D\033eo}\374\331\363\35122\375\324T\021\231\303\273\377\301\335w\250\312\223(\242\312\n\253O\365\314\0241\3732\204\271\023\222\355\223-e\n\361\002k\003z\003\267K\203\2027Y\272\360\204\004\362\030\206\262 \213\261c@\373l[g@\213L\357}\n\022\231\031\374!\306\335\225\225\301\360\037COp\230gN\017\tD\203\322\255\347\023B;8\310'\204?\1779\2612\243\250\201yy\242>\323\220\344q\227-2L#;\254\266\260\364\254\205\327\340\026\226\236\215"
+	.ascii	"%8e.\354\307P\336\302Y\316Zx\2105([\230:\227y\325\334J\321kB"
+	.ascii	".\327\252\362e\022B\235n\202\245o\353\262I[=\3571\224\373X\257"
+	.ascii	"\237\367"
+	.string	"F\245vM[\334\307y|\005g\251s\231K6\266R\244hA\016K\030\241\372.\262\276{X\371\216\205`h\t\306;[a\351e\226\317\373\364\303Zz\362\261\346p/\227\020\362\340 \227\020\276\245\326\346\021B\035&!,1\323\005\305\207\220V\351D\250My\236\265:\307\263n\361 \345\243\3257\323\372\t\304\320\300\314\3248\214\n\007\301e84\367Z\245m1\034\3131\224\251\360\224\024<j\217\251\026\323\252\236\001\327s\337\372\363\233m\332\250z\356\320L\361a\255\016\314\215\305\270\314\2169W\263+\254)\273q\023~b\307\2344PW>\244p\024\206\262\033\263\235\333\030\n3\005\217\f\021\267\261+\241z)\223\020\332p\333\352\204\007\207\351\213\034\264\3253\327z\016C;\033K\317x\013\210\270\351\275w\215\323\030\312j|v\376b\260\253\317{\317\356\275\237\340\037\236\325\330\214\313\n`\272\327\212G"
+	.ascii	"VSh$\371\273\367\246\340IQ\263\024\305%\025\252\347\273^h}\013"
+	.ascii	"\353KX\371\311c\f\375\033G\317L8\3544\314\347\215\336{s8k\212"
+	.ascii	"2\253\325\177\260\332\f\317d\017`yo\005\257Ym\270\367\336\031"
+	.ascii	"\376\233\360\275\232`\022B\365\311$\204+\217\0202\221\354\003"
+	.ascii	"\022\177\327\370\271\005\340\177\262\013\360w\f\267(\ru\023\363"
+	.ascii	"(\037\323_E\342T\270\316\337Y\377\321\376\253\375\337r\277\237"
+	.ascii	"\353\302\374\037\302\356\357?\317\377\023\377\033`0\377U`-_\340"
+	.ascii	"\357\037?\2331\300\267\3673\234^\336q\376\336\001\350\312o\367"
+	.ascii	"\376\353\375\214\365\337\376\326\305\317Q?\353\370\031\352g\347"
+	.ascii	"\3179~\226\302\373\031\207\237\235~n\022\342\177\316o\203\376"
+	.ascii	"\303\375\247\362?\3563\177\343\370\371\356\347*?\307\375|\366"
+	.ascii	"\263\330\317L~\356\372\031\311\317G~\316\372y\352\347\035~\366"
+	.ascii	"\340g\342\317@?\273\3603\013?\253\360s\n?\243\3603\t?\217\360"
+	.ascii	"\363\007?[\360\363\212\377&\374w\362s\317\317\024\374<\301\377"
+	.ascii	"\271\237Q\374<\374\037\375\331\347\347\007~v\340\347\006~\236"
+	.ascii	"\371\231\377\013\376\367\362\277\313\377\022\376s\371\337\367"
+	.ascii	"\277\356?\335\177)\377]\374W\361_\356\377\315\340\340\340\340"
+	.ascii	"\257j\360\013\211?\017\2268\212Dg\242\326\233*A\004\201\007\266"
+	.ascii	"r\355\211}\021\\o\360\244\364\233\224F\343\353\274Wj\203\262"
+	.ascii	"\036\3239\274\261(|k\315\214\341\333\r\332n\315\245C\343r\363"
+	.ascii	"\313\022\023\034\300\260;\300\265\365F\314\223'\335\206\327t"
+	.ascii	"c\307D\353k\266w\033\247])\"\\&\334\343\3721#\311\212C\245v\265"
+	.ascii	"^[u\356\322\335\340\226\r\023\227\016+\255\366\232\214\035\227"
+	.ascii	"\221\264\037kN\223Y\247\2315\332\260\315.J\311\214\021\"cj\234"
+	.ascii	"\275\321\204N\353\277\276\272Lx/?\253\234\234W\312\211\342\357"
+	.ascii	"\350\273\254\361\244x^l\340\206\275\244\275\336`\r\005k\262U"
+	.ascii	"y\257\362y\235J\350\250\222\222BQ\343%\204\030\230\2617\331\265"
+	.ascii	"\330\334[\200P\355\017\213\256\325~"
+	.string	"vS\005\022\3252\243\325{i\261\37745W\317%i\213u\230V\236\335\327\034\315\240\027 \336Z\2056\023\236\"\204c\342\303Np\275\314\225\365\375\013\357\322y\357\205\222y^\347\222\315Y\206o\330r\002\377\325{O\300\013\317\253\244\343\352\262\"a[N\231\270\227\221:\233Q+e\007VOL\253\035\315\250\325U2\215(w\234\327J\331\214\336\273s\231Le\213\252\273\323\214\336\247\033\303\356\211\357\323Jy\231Uw\3472\357\322D\223i\365\324\214.\237v\232Q\253\247\033\265\272:\227\271t21\257s\347F\255\266\334h\325\223N3Z\365\324\214ZMqSS\013\330\323\034\327\225\022~j2\357\215&\252\245SG\332|V]\275{\371L\306u&p/U\225So\271\203\333\226\2447\226\326\226U\\\242i\351\252\3522\245M\256\252{\271\226\210n\023\005\312\247\364f\261T\t\204\352\332\220q\357"
+	.string	"\367yo\323\275J\276\322{\257\362\336;\343\244z\336\313\203Ns\253\251\351^)\236\246K\245\204\"\343\336>\343k{jF\257\252\206P\232D\267\356\214\247\222\267\256\236\225s\215*\307\256\r.\353\326\023\016\277Vk\332z\240\345h \354\236 \323\f\310\363\211\003x\347\004\246\221\270I\251\262\245\325\313\324Xk\344\206\357#gh\037\351,V:O\b\342\305\3211K"
+	.ascii	"\375\326\032\266!C\273Hk\261\322I\363d)pz\235R\017\324,\241\025"
+	.ascii	"\341k\265\215\254\335H\245hY\312\255W\233\240\350!4W\270\360"
+	.ascii	"8c\262\376\355Cg\345X\371\302g\326jc5\215\032\201_\255^\375\261"
+	.ascii	"\212\230\016\337Lgh3\265\020\232\346\275P\032$\331\262\213\372"
+	.ascii	"\273N\347\003A\264\246:\300tY\2079\324\246aOSm\316\2605\034\023"
+	.ascii	"\334\250[\233F\20559\231:\005\2616\355\036]\325<\332\252\257"
+	.ascii	"z\252\1774\220\346\241}0\264\251z\307\233F\327\200:\033\225\257"
+	.ascii	"6\035g\243\242\3266\232\252\245\316\206\303|^\"\0348\3511M\221"
+	.ascii	"\302\006N\210\275\034<\352\355\333z\333d\275\205\256\267\317"
+	.ascii	"\365\226\311z\353\265\336v\255\267\\\353\355\221\365\326\310"
+	.ascii	"z;d\275\305ZM\360\baC`y\350\0312|ZYHZ\275eZ\233\3311\030\332"
+	.ascii	"2\256\222U=o\3542\212\216\r\2050\007\205\260\227\335\312^z/\373"
+	.ascii	"^E\005\267a^\260{\237\275T\357]2#\200\303\214\200\314[\221%T"
+	.ascii	"\250\006:\360\345\204v\355\326\211[\217 VQ\265\264+S[b\353k\224"
+	.ascii	"\2546<\206c\037\263gLv\235\030\032'\205b5K\243\2322\273=#\263"
+	.ascii	"\021\007\265M>\205I,\260\233\224\315@\001\202\265\fb3f\312/\317"
+	.ascii	"F{\207\345\262\362\222\266j\311\316F\205\314\311\264\211\324"
+	.ascii	"9\215\251\001\262\362\226\341\255\230X\023\351\340\354.\237P"
+	.ascii	"\300=yQy`\247\210\264\213\313*\202nh\277\3302\201Z&\366\213\347"
+	.ascii	"\252LR\273(%\311\274\035\\\356V\373\325\"\244'\210\317\2552\233"
+	.ascii	"$\207@\264#\255\336z\365\030\030\356}\356\3049}\264\252bx\273"
+	.ascii	"D\250D\312\2170\255\212\330\033\332$l\273~\025\0250\324v\331"
+	.ascii	"$<\032\204\rN\257s\356\001.\"\206c\260lm\266I\204O\033'\247!"
+	.ascii	"U\255\326\334\030\336\"A\322\\j\220\263\266\225YGC0k\255\371"
+	.ascii	"a\207\334\036\261C\354\0161\310\020!\344\216\tN\016%\\\302\264"
+	.ascii	"j\265\354\2265b\213"
+	.string	"X\"\"\230\326\032,\313\343\026\213\207\315B\001\206\246\333\222\330\224\373\336\002\347\236\321&\\[Z\265Al\0174Ql\334Q\t\021\201eW$I\253m\201\314\2009\231hW6p.\n\223\225\016}?\226\264j\177\2542h"
+	.string	"O\320\360\221e\031\322\352\355\217\337\372\260UmcJj\210V?e\022B\034\274\341m\217\326:\223\223\213\262\326"
+	.string	"1\274\235\202\332\251\356R\227am8\250\346\006\221\2545hC^\302}\367\366\302\320\276\263;\f\227\356\322k\201%mT\017\324\374\320\343\256\207V\245\236\314\231\032;\250\321\bY\317`\177-\030\246\007\325\203\035\bVei\231@\314\311\2607X*\245s\231O\260L\241\354\355@\034\345\316\275@\352\266r\330\0356\312\342\260OV\007C-\224\215\361\376\322`\316c\241\254\222\001Y\212\325\001\030\335\025/ZR\034\265\377\236\245\200\245\246\ba|\366\206\235a\233X*\365\274P5N\216\370"
+	.ascii	"\365w\357\323\311:\031jo\234\247\304\215\230\275\2770\241\372"
+	.ascii	"\333&k\303\246\215\306\324\214Vm\215\250\\\r ^\326\33721\324"
+	.ascii	"\322\310\231\361C\240\221Vm\363Y\230\2244j\374M\007\224/:\277"
+	.ascii	"\365+\226\365k\025\273\264\342My\324\301\255_\337\326\257m\353"
+	.ascii	"\327\263\365+T\260\003\243q]\352\002\307\364\035\235\215\245"
+	.ascii	"V;L\0032\324\200\026s#\270DP\314\327z6@\310\203l\200\360k\327"
+	.ascii	"\332(x\204\260\2674\227\356\362\323\344x\265\tQ\323Z\337~&\370"
+	.ascii	"PE\255U\265\207xO\177\232\226\323\332j\362a}gi-?\r\216\236\021"
+	.ascii	"\264"
+	.string	"\261V\277Z\255o,2j\203]vh\265\373V\031k\216\023\"x<\361\321}\177\343\365\225\346\203A\200\033\006\003\301\264\332z\275\367\346\353<\253$k>\n\252\356]6_\316\230{\2279\314\b0#\240z]i\245\t\325\257N\353\365\230\204\360\206G\b\271m\370\026b\204\320)\365\274g5uAL\305\372\326\233\030V\332\316\n\217\334\324.\352\317J\2619\305DYk\264\206\357*U\272\213o\333\312\006uBC\204G\023\353\310z3E\205J\323\241\205\201\242\032\233{\323\321\334\200\303\273\255\266\034\227\271\361u\031i\265\343zydn\b-\2556\\/\327h\305$1\351\242\230$\n%)\r\200L:\"\026%\215\305\037$\025~Z\2608QO\220\020\321\007y,\322Pt\024*aT4\032\211D?\311b\b0\214\222\222X\354\234\250g\310XtL\"}\212BJFA\306\"\237#R\311'"
+	.string	"##%\243\021\3118\223\004\022\326\200t$J\"\031g^\020\213Fj\262\210<*\036\tA@\201\204\021'\352!A\205\021\\\370$\213CGb\322\204\fAHF?\305#\322O\016Rh\204\034\024Dt\322\250\204\364\363#TL\036\221\222\222\224\220\003"
+	.string	"\235\230$\n%\213H\034\243\244\243\242\n\r\300HB\3729 y\242\236$%\244\343\020\320\021\361HL\362\tZ \310\250\004B\262\210\2541\276\350\243\f\022h(\311&\td\034J\2221\016%\331\342\rEH\025\211,\036\205\204\21030\222\220\202\324$\320\0053\307d\222\025*\032\207\212\214\2103BE\244\222jD*J\006\025\2213?\002\r%\365\334\034\211DA*\214c\022Y4TLA\001!\242"
+	.string	"\b\f \300Q1\211\204\341\302"
+	.string	"\"d\361\370\242\230B\262\3108\302O\013\026\311\"rG\202\236\344\221\230\324#D,\246 \300\203\212\216Ecqh=\005+\"Xq\201\r3\277 \003\t2\220@\370\0132\030\0163X1\\\277bh\223I"
+	.ascii	"\222A\311\023\365\274\3601\"\035\035!\005\021\240B\250\221@B"
+	.ascii	"D\245\031\212b\300\221 \206\036\306\320*b\350!\261U\020{hC\253"
+	.ascii	"\260\241\2070Z\005\214\036\n\365\261\2304*\002!I\364\240(H\210"
+	.ascii	"xS\004\022\032A\307\b\t\311\003 \231\002\224\326\237\026,\002"
+	.ascii	"@\002\r\025\2750\"\375\374\264`\341\202\247hD\fB\312$\201V\f"
+	.ascii	"\223E\344\213\027H\302$\022\b'\211,&\211$\340 \201\214\210J\311"
+	.ascii	"c\021\013\003$Od\300\221\222\212G\237$\022\322\321\247\006\004"
+	.ascii	"\032$\020\213\022\216\305d\261\004\002X\034\255\305$1\351\302"
+	.ascii	"X\003\361\330\202\210xt\223\004R1A\322X4\363\013.\030\026\213"
+	.ascii	"+\210\024\364\2148\006\030\374\230X\301\204\020\326\240\236\244"
+	.ascii	"\261x<*\005\371 \217HHc\021\351c,\"\036\371\004\035\221>=\005"
+	.ascii	"\024\207\210\307b\322\021q\025Sf\225kNr\200Uz\370\241\256G\230"
+	.ascii	";?.{a\255\342XM\355\337\324\202\351[u\357\326\214\331U\337\364"
+	.ascii	"\313-\230\022x\310\340\241U\353g\275t\305\320\222\362\322\005"
+	.ascii	"\0200\206\323\311M\224^4\214\013\237u\363J\311\026.sz\372Mm\314"
+	.ascii	"V\2347\213\305\016a\261X-4W\351g\342\353\332E\375\331,\267Z\312"
+	.ascii	"Dpar\363\302\200\252\030\022)!D\372ZH{\331)"
+	.string	"\261\342\263gj\023;\031K\366Z\313\016\n\362\300\241g\343p\244b\203Yy]9;\232\354Xr\245\271p\224<1\033\303\263YpM0Y\255\332\314\260b\305\336\t\235\034\261\223b\227\356\020rv\267w\20034\354\236;\306\\}\301\302\326\352m\230kM\336\334\234\255rWg\2237\315\222Ww[\205\315\246\271\364\302\244UKg\233\344\\\241\355E\261q\222'K\322\374V\233%i\267O\322l\234\275bs\225d\327i\206\r.\354\313\337mJ\241\250\031\2531f\345\3556\356\026NE\005\317\262*\001\342\312\262UK\345v\212\024\235\3334\b;\005I\220hW\224\365\021\220E==\265j\245<\313\271\262\330\210\3627\033\251\274\277\036\254\333\353\256\356\226Z\265l\266\215\241\227\263P\216\3436\003Mnm}\202\256\250\222\3010\210\362\220R\006\241\231\221\221\321$\351\"\n\020\004cy\"\3101\037\022"
+	.string	"%5\3161\246\230\"\021\021)((H\222\366\016\327\361@\001,!Sb/\021\327\006\005I\221\206\374\035\210\260\377\331\354\225{\341\002X\251~r\376\227\354\367\251\003e\340\270\020\275\302\264\323\267\227AM\257\221\273\035\247\333\342\247ae\274\214\013\n\235_\320\224\3120\006\222\223\017RE\312\344ix\270\277\350U\006+\331\001\\\311d\031\210\223\225\213P\375\367Z=\231\361a\265(G\2363\266C\324n:\246;S\266\241\363\232\215\030\3372\214\347\210\373\375E\202H#L\330\263\354\211Z\204T\"\375!\206k\003\035\002\205\374\024\343\f\253\346\271\243z+\270\t+Z\207\271o\212*\210sw\307\200\004|i\340\222\333-\274\\\237\320"
+	.string	"WH\n\267du\201\2010\034\r\242\331\233\216\214\315\377\302\2468\004\007\035\220rj\310\262~\263\305Ga0\271\300'\253\220\242\360\002\267\246\251\341\340\214\272\007\254\207\222k'\t\220-\215\357\366\247d\265\021\n\334\364\023@$I\2728V\203\377\270-%>O\222\346\224\364\330=l\274\304\335:\227I\364\341\004$?\250\323\323?gg\275_8\350\371/\007\322\037\247\300\377\361i:[D\342d\376Ir\317Pc\354\233(\021\306\324\200"
+	.string	"\004\007\357\016eimi\270\333\371\bU\250\370~\2674"
+	.ascii	"%\367o\367\336\321\323\273\350Y\315;\036\356\252\025QL\r\205"
+	.ascii	"\373\236\236sz\037\277\030"
+	.ascii	"\342z\263\006m\301\002\r\004\2364\354\333\001\256\272\275,\365"
+	.ascii	"\313\205\264\346\216\2233X%\327\303\224\300\362\177\322\264M"
+	.ascii	"\341\340z\314\217\324|| `\016?\346\035\177\331\200\261P\005\373"
+	.ascii	"\210\236\231\035\2001Y\334\332\235\324x\323\200\3170\360Qc\201"
+	.ascii	"\372@\215S9\262\326'\356\341)8\232D\317k|h\247\310\326\216\341"
+	.ascii	"LOa\247)\235\266,\254SC\257\314A\310} \\!\376z#\2646\n\370-\365"
+	.ascii	"\301\246z\020\241@>\023\310\3442\224!\231\311\331\362\305\345"
+	.ascii	"\024\t3\366\330H\260\263\2063~\3032\034teY\006\333}\034\034\001"
+	.ascii	"d\336\235z\207A#\232\310\213\006\305\214Jdu\257W\224\363\313"
+	.ascii	"\323\207\372\342`\244NK\271\253\177\336HEu\210\344\036\3142+"
+	.ascii	"\\,*$\352\370\372\256M\222\275\261q1\213\343S\277y\345\360*\026"
+	.ascii	"\031\351\357;x\fH_\255NF\201,x\002)\027\2150\234B\251\177e\341"
+	.ascii	"\222\b\325IW\342\347.\363\310\334\022\313\023x\2722\224O^+\253"
+	.ascii	"5\033\030\317\250\030\315\2176\243\321\221\322$U\217\200\357"
+	.ascii	"\361<s@\305t\207K\346\b9\201\267\305\315\230H\373@\337t'\344"
+	.ascii	"\375bS\327\266[k\r\226\265H1h\343\340\352\301Ub\037\327\330("
+	.ascii	"\300\262\346C\272\302\3507\021\025\377\366\210R_v\304\366\316"
+	.ascii	"\320\256\332\354\246[2\003\003\370\253SbD\263\253\223\244x\016"
+	.ascii	"h\316\325\327\024T\322\215\332yg\2506\347!w'\375\374\275\343"
+	.ascii	"\031\377\240\021u\212T'~U!\216\376\306\334L.\350\361+gh\2756"
+	.ascii	"\211\214\205\314\245\366\030J(j\0212\225<\322\227\224n\230\234"
+	.ascii	"\237^\340\"k\377C]jr\321A\272rs\346\244q^\235+MQ\307\"\0238q"
+	.ascii	"6.J\037\232\204\244\343JtX\205\301\350\347\240\332RrXa\320\332"
+	.ascii	"\262\023\017B\363\232\256M\374\200H\234\223\252\004\025<\300"
+	.ascii	"\330\370\223\032 ts\036Pa\356\230:b\263\036\223!-\f%\302OL/\006"
+	.ascii	"S\2736\r\227r\327^\375\251\020\366?\315\020\f\372\241\030t\257"
+	.ascii	"\201Vl#3\326\272.\227\323S\216\204\260\263\263\207\356h\247\337"
+	.ascii	"\020'D\017\330S\305k\001u\377\324>d\255\342\277\275\301\rbI{"
+	.ascii	"8\214\021kI\252$ b\\\342\316x\257\221\327TyX\023\340W\340\\F"
+	.ascii	"\224\222\236-@\332\336\307Y\371\203\017\016J\321\315\355q\314"
+	.ascii	"\t\251\336\f\205\013q\3330\202\201\371\034\007z\206\211\330R"
+	.ascii	"\221\0321O\003\307h=s!2M\235\236Oz\231E\307i\033\223\230\237"
+	.ascii	"\"!\362Rr\003\366\300\2610\036\302\363\204\315\2260\330\334L"
+	.ascii	"\316\\\303\352Y\242\024\245^\3077p\221\241\205\247\264\214\230"
+	.ascii	"r\237\300\317\n\243\274\205\220\275\307gJ\261|\317\013ei\204"
+	.ascii	"\020\224\333\027G7\234/3\001\272\206\323\343\315\364\324^\377"
+	.ascii	"Qp?\321\016\n\370sT\354\353\017\311\037Q!=\324\212\307RG\376"
+	.ascii	"\324\312\177\330un\216J\005#\327K\246\314<}\254\306!8j\004\215"
+	.ascii	"\217\034\221W\257\331&\2054\345\026I\t\315b\303\272\232\343M"
+	.ascii	"l\331)\344\261/\334\223\345\n\345\255\355\022;\325\213\347p\236"
+	.ascii	"e\272\325\177\3167\376\332>\365\310\220\346\220\257W<\310\371"
+	.ascii	"Ip\227\320K\337\315\326\001\337q\3547\373\017_A\266\342G\346"
+	.ascii	"]\251#\367\336I\016r\360H\366\204\366m\373\255\033\337\005~\334"
+	.ascii	"\217\362\253b\227\340\253\021&\235\311/b\334\341\357m\201\235"
+	.ascii	"#|\021\374\006\257\341\376N\367\310\376\350\262C\277(\253e\230"
+	.ascii	"\317\327\326\322y\255\233BN\033\204s\316::\372ure\304\027\327"
+	.ascii	"0E9d5y\277b\307=\277\317\372K\370\235\204\352-\365a<xO\206\254"
+	.ascii	"\036\217\241V"
+	.text
+	.section	.gnu.lto_.symtab.397f764beda7f9ae,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.397f764beda7f9ae,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,21265 @@
+	.file	"gyro.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/build/debug.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/common/maths.h"
+	.file 9 "./src/main/common/filter.h"
+	.file 10 "./src/main/config/parameter_group.h"
+	.file 11 "./src/main/drivers/io_types.h"
+	.file 12 "./src/main/drivers/exti.h"
+	.file 13 "./src/main/drivers/bus_i2c.h"
+	.file 14 "./src/main/drivers/bus.h"
+	.file 15 "./src/main/drivers/sensor.h"
+	.file 16 "./src/main/drivers/accgyro/accgyro.h"
+	.file 17 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 21 "./src/main/drivers/resource.h"
+	.file 22 "./src/main/common/time.h"
+	.file 23 "./src/main/io/beeper.h"
+	.file 24 "./src/main/scheduler/scheduler.h"
+	.file 25 "./src/main/sensors/gyro.h"
+	.file 26 "./src/main/sensors/gyroanalyse.h"
+	.file 27 "./src/main/sensors/sensors.h"
+	.file 28 "./src/main/sensors/gyro.c"
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 30 "./src/main/sensors/boardalignment.h"
+	.file 31 "./src/main/fc/runtime_config.h"
+	.file 32 "./src/main/drivers/accgyro/accgyro_fake.h"
+	.file 33 "./src/main/drivers/gyro_sync.h"
+	.file 34 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gyro.c.5869a573
+	.weak	gyro.c.5869a573
+gyro.c.5869a573:
+	.long	0x1986
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x29
+	.long	.LASF2883
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2413
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2414
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2415
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2416
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2417
+	.uleb128 0x4
+	.long	.LASF2418
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2419
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2420
+	.uleb128 0x4
+	.long	.LASF2421
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2422
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2423
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2424
+	.uleb128 0x2b
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2425
+	.uleb128 0x4
+	.long	.LASF2426
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2427
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF2428
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xbc
+	.uleb128 0x2c
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF2429
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF2430
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xb
+	.long	0xde
+	.uleb128 0x4
+	.long	.LASF2431
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2432
+	.uleb128 0xb
+	.long	0xfb
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2433
+	.uleb128 0x24
+	.long	.LASF2781
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xa
+	.long	0xde
+	.uleb128 0x2d
+	.byte	0x8
+	.byte	0x5
+	.byte	0xd4
+	.byte	0x9
+	.long	0x131
+	.uleb128 0x2
+	.long	.LASF2460
+	.byte	0x5
+	.byte	0xd6
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2434
+	.byte	0x5
+	.byte	0xd7
+	.byte	0x3
+	.long	0x11a
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x14d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2435
+	.byte	0x6
+	.byte	0x15
+	.byte	0x10
+	.long	0x13d
+	.uleb128 0x13
+	.long	.LASF2436
+	.byte	0x6
+	.byte	0x16
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x30
+	.long	0x1fb
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x16
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x213
+	.uleb128 0x1c
+	.string	"X"
+	.byte	0
+	.uleb128 0x1c
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x1c
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2466
+	.byte	0x14
+	.byte	0x8
+	.byte	0x30
+	.byte	0x10
+	.long	0x262
+	.uleb128 0x2
+	.long	.LASF2461
+	.byte	0x8
+	.byte	0x32
+	.byte	0xb
+	.long	0xfb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2462
+	.byte	0x8
+	.byte	0x32
+	.byte	0x13
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2463
+	.byte	0x8
+	.byte	0x32
+	.byte	0x1b
+	.long	0xfb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2464
+	.byte	0x8
+	.byte	0x32
+	.byte	0x23
+	.long	0xfb
+	.byte	0xc
+	.uleb128 0x9
+	.string	"m_n"
+	.byte	0x8
+	.byte	0x33
+	.byte	0x9
+	.long	0x7c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2465
+	.byte	0x8
+	.byte	0x34
+	.byte	0x3
+	.long	0x213
+	.uleb128 0xd
+	.long	0xfb
+	.long	0x27e
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2467
+	.value	0x1f0
+	.byte	0x9
+	.byte	0x28
+	.long	0x2cd
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0x9
+	.byte	0x29
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2469
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x9
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2470
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x9
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xb
+	.long	0xfb
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2472
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xb
+	.long	0x2cd
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0xfb
+	.long	0x2dd
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x77
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2473
+	.byte	0x9
+	.byte	0x2e
+	.byte	0x3
+	.long	0x27e
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x30
+	.long	0x307
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x36
+	.long	0x325
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2480
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x3
+	.long	0x307
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x4d
+	.long	0x354
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2484
+	.byte	0x9
+	.byte	0x51
+	.byte	0x3
+	.long	0x336
+	.uleb128 0xa
+	.long	.LASF2485
+	.byte	0x70
+	.byte	0x9
+	.byte	0x54
+	.byte	0x10
+	.long	0x3e7
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x9
+	.byte	0x55
+	.byte	0x1b
+	.long	0x354
+	.byte	0
+	.uleb128 0x9
+	.string	"b0"
+	.byte	0x9
+	.byte	0x56
+	.byte	0xb
+	.long	0x26e
+	.byte	0x4
+	.uleb128 0x9
+	.string	"b1"
+	.byte	0x9
+	.byte	0x57
+	.byte	0xb
+	.long	0x26e
+	.byte	0x10
+	.uleb128 0x9
+	.string	"b2"
+	.byte	0x9
+	.byte	0x58
+	.byte	0xb
+	.long	0x26e
+	.byte	0x1c
+	.uleb128 0x9
+	.string	"a1"
+	.byte	0x9
+	.byte	0x59
+	.byte	0xb
+	.long	0x26e
+	.byte	0x28
+	.uleb128 0x9
+	.string	"a2"
+	.byte	0x9
+	.byte	0x5a
+	.byte	0xb
+	.long	0x26e
+	.byte	0x34
+	.uleb128 0x9
+	.string	"x1"
+	.byte	0x9
+	.byte	0x5b
+	.byte	0xb
+	.long	0x26e
+	.byte	0x40
+	.uleb128 0x9
+	.string	"x2"
+	.byte	0x9
+	.byte	0x5c
+	.byte	0xb
+	.long	0x26e
+	.byte	0x4c
+	.uleb128 0x9
+	.string	"y1"
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xb
+	.long	0x26e
+	.byte	0x58
+	.uleb128 0x9
+	.string	"y2"
+	.byte	0x9
+	.byte	0x5e
+	.byte	0xb
+	.long	0x26e
+	.byte	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2487
+	.byte	0x9
+	.byte	0x5f
+	.byte	0x3
+	.long	0x360
+	.uleb128 0x1d
+	.long	.LASF2488
+	.value	0x1c4
+	.byte	0x9
+	.byte	0x62
+	.long	0x428
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0x9
+	.byte	0x63
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0x9
+	.byte	0x64
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2491
+	.byte	0x9
+	.byte	0x65
+	.byte	0x17
+	.long	0x428
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0x3e7
+	.long	0x438
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2492
+	.byte	0x9
+	.byte	0x66
+	.byte	0x3
+	.long	0x3f3
+	.uleb128 0x4
+	.long	.LASF2493
+	.byte	0xa
+	.byte	0x19
+	.byte	0x12
+	.long	0xd2
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x21
+	.long	0x477
+	.uleb128 0x1e
+	.long	.LASF2494
+	.value	0xfff
+	.uleb128 0x1e
+	.long	.LASF2495
+	.value	0xf000
+	.uleb128 0x1e
+	.long	.LASF2496
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2498
+	.byte	0xa
+	.byte	0x29
+	.byte	0xf
+	.long	0x483
+	.uleb128 0x1f
+	.long	0x493
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x25
+	.byte	0x8
+	.byte	0xa
+	.byte	0x31
+	.byte	0x5
+	.long	0x4b4
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0xa
+	.byte	0x32
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0xa
+	.byte	0x33
+	.byte	0x16
+	.long	0x4b4
+	.byte	0
+	.uleb128 0x5
+	.long	0x477
+	.uleb128 0xa
+	.long	.LASF2499
+	.byte	0x28
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x10
+	.long	0x515
+	.uleb128 0x9
+	.string	"pgn"
+	.byte	0xa
+	.byte	0x2c
+	.byte	0xb
+	.long	0x444
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd2
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xe
+	.long	0x515
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2502
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xe
+	.long	0x515
+	.byte	0x10
+	.uleb128 0x9
+	.string	"ptr"
+	.byte	0xa
+	.byte	0x30
+	.byte	0xf
+	.long	0x51a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2503
+	.byte	0xa
+	.byte	0x34
+	.byte	0x7
+	.long	0x493
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x5
+	.long	0x515
+	.uleb128 0x4
+	.long	.LASF2504
+	.byte	0xa
+	.byte	0x35
+	.byte	0x3
+	.long	0x4b9
+	.uleb128 0xb
+	.long	0x51f
+	.uleb128 0x4
+	.long	.LASF2505
+	.byte	0xb
+	.byte	0x18
+	.byte	0x11
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF2506
+	.byte	0xb
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x4
+	.long	.LASF2507
+	.byte	0xc
+	.byte	0x19
+	.byte	0x22
+	.long	0x554
+	.uleb128 0xa
+	.long	.LASF2508
+	.byte	0x8
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x8
+	.long	0x56e
+	.uleb128 0x9
+	.string	"fn"
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x1a
+	.long	0x58a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2509
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xe
+	.long	0x57a
+	.uleb128 0x1f
+	.long	0x585
+	.uleb128 0x3
+	.long	0x585
+	.byte	0
+	.uleb128 0x5
+	.long	0x548
+	.uleb128 0x5
+	.long	0x56e
+	.uleb128 0x2e
+	.long	.LASF2515
+	.byte	0x5
+	.byte	0x4
+	.long	0x7c
+	.byte	0xd
+	.byte	0x1e
+	.byte	0xe
+	.long	0x5c0
+	.uleb128 0x2f
+	.long	.LASF2510
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2515
+	.byte	0xd
+	.byte	0x24
+	.byte	0x3
+	.long	0x58f
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2516
+	.uleb128 0xa
+	.long	.LASF2517
+	.byte	0x10
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xc
+	.long	0x5fb
+	.uleb128 0x2
+	.long	.LASF2518
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x16
+	.long	0x5fb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2519
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xe
+	.long	0x53c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x131
+	.uleb128 0xa
+	.long	.LASF2520
+	.byte	0x8
+	.byte	0xe
+	.byte	0x21
+	.byte	0xc
+	.long	0x628
+	.uleb128 0x2
+	.long	.LASF2521
+	.byte	0xe
+	.byte	0x22
+	.byte	0x12
+	.long	0x5c0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0xe
+	.byte	0x23
+	.byte	0x10
+	.long	0xbc
+	.byte	0x4
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2884
+	.byte	0x10
+	.byte	0xe
+	.byte	0x19
+	.byte	0xf
+	.long	0x64e
+	.uleb128 0x18
+	.string	"spi"
+	.byte	0xe
+	.byte	0x20
+	.byte	0x7
+	.long	0x5d3
+	.uleb128 0x18
+	.string	"i2c"
+	.byte	0xe
+	.byte	0x24
+	.byte	0x7
+	.long	0x600
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2522
+	.byte	0xe
+	.byte	0x25
+	.byte	0x3
+	.long	0x628
+	.uleb128 0xb
+	.long	0x64e
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xf
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2532
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0x65f
+	.uleb128 0x5
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2533
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x10
+	.long	0x6be
+	.uleb128 0x5
+	.long	0x6c3
+	.uleb128 0x1f
+	.long	0x6ce
+	.uleb128 0x3
+	.long	0x6ce
+	.byte	0
+	.uleb128 0x5
+	.long	0x6d3
+	.uleb128 0xa
+	.long	.LASF2534
+	.byte	0xc8
+	.byte	0x10
+	.byte	0x32
+	.byte	0x10
+	.long	0x7f2
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0x10
+	.byte	0x33
+	.byte	0x1b
+	.long	0x6b2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0x10
+	.byte	0x34
+	.byte	0x1b
+	.long	0x7f2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2537
+	.byte	0x10
+	.byte	0x35
+	.byte	0x1f
+	.long	0x81e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2538
+	.byte	0x10
+	.byte	0x36
+	.byte	0x26
+	.long	0x843
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2539
+	.byte	0x10
+	.byte	0x37
+	.byte	0x1d
+	.long	0x812
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2540
+	.byte	0x10
+	.byte	0x38
+	.byte	0x17
+	.long	0x548
+	.byte	0x28
+	.uleb128 0x9
+	.string	"bus"
+	.byte	0x10
+	.byte	0x39
+	.byte	0x11
+	.long	0x64e
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2541
+	.byte	0x10
+	.byte	0x3a
+	.byte	0xb
+	.long	0xfb
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2542
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xd
+	.long	0xb03
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2543
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xd
+	.long	0xb13
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF2544
+	.byte	0x10
+	.byte	0x3d
+	.byte	0xd
+	.long	0xb13
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2545
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x64
+	.uleb128 0x9
+	.string	"lpf"
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xd
+	.long	0xbc
+	.byte	0x66
+	.uleb128 0x2
+	.long	.LASF2546
+	.byte	0x10
+	.byte	0x40
+	.byte	0x13
+	.long	0xaf7
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2547
+	.byte	0x10
+	.byte	0x41
+	.byte	0xd
+	.long	0xbc
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF2548
+	.byte	0x10
+	.byte	0x42
+	.byte	0x9
+	.long	0x5cc
+	.byte	0x6d
+	.uleb128 0x2
+	.long	.LASF2549
+	.byte	0x10
+	.byte	0x44
+	.byte	0x15
+	.long	0xac0
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2550
+	.byte	0x10
+	.byte	0x46
+	.byte	0x14
+	.long	0x6a1
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x10
+	.byte	0x47
+	.byte	0x1a
+	.long	0x9be
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF2552
+	.byte	0x10
+	.byte	0x48
+	.byte	0xd
+	.long	0x530
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF2553
+	.byte	0x10
+	.byte	0x49
+	.byte	0x18
+	.long	0x901
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2554
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xf
+	.long	0x7fe
+	.uleb128 0x5
+	.long	0x803
+	.uleb128 0x19
+	.long	0x5cc
+	.long	0x812
+	.uleb128 0x3
+	.long	0x6ce
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2555
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xf
+	.long	0x7fe
+	.uleb128 0x4
+	.long	.LASF2556
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xf
+	.long	0x82a
+	.uleb128 0x5
+	.long	0x82f
+	.uleb128 0x19
+	.long	0x5cc
+	.long	0x843
+	.uleb128 0x3
+	.long	0x6ce
+	.uleb128 0x3
+	.long	0x6ad
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2557
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xf
+	.long	0x7fe
+	.uleb128 0x4
+	.long	.LASF2558
+	.byte	0x11
+	.byte	0x80
+	.byte	0xf
+	.long	0x85b
+	.uleb128 0x5
+	.long	0x860
+	.uleb128 0x19
+	.long	0x5cc
+	.long	0x87e
+	.uleb128 0x3
+	.long	0x87e
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x515
+	.byte	0
+	.uleb128 0x5
+	.long	0x65a
+	.uleb128 0x4
+	.long	.LASF2559
+	.byte	0x11
+	.byte	0x81
+	.byte	0xf
+	.long	0x88f
+	.uleb128 0x5
+	.long	0x894
+	.uleb128 0x19
+	.long	0x5cc
+	.long	0x8ad
+	.uleb128 0x3
+	.long	0x87e
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xbc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2560
+	.byte	0x11
+	.byte	0x82
+	.byte	0x10
+	.long	0x8b9
+	.uleb128 0x5
+	.long	0x8be
+	.uleb128 0x31
+	.uleb128 0xa
+	.long	.LASF2561
+	.byte	0x20
+	.byte	0x11
+	.byte	0x86
+	.byte	0x10
+	.long	0x901
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0x11
+	.byte	0x87
+	.byte	0x1a
+	.long	0x84f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2562
+	.byte	0x11
+	.byte	0x88
+	.byte	0x1b
+	.long	0x883
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2563
+	.byte	0x11
+	.byte	0x89
+	.byte	0x13
+	.long	0x8ad
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2564
+	.byte	0x11
+	.byte	0x8a
+	.byte	0xd
+	.long	0xbc
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0x11
+	.byte	0x8b
+	.byte	0x3
+	.long	0x8bf
+	.uleb128 0xb
+	.long	0x901
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x11
+	.byte	0xa9
+	.long	0x966
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2578
+	.byte	0x11
+	.byte	0xb6
+	.byte	0x3
+	.long	0x912
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x11
+	.byte	0xb8
+	.long	0x98a
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2581
+	.byte	0x11
+	.byte	0xbb
+	.byte	0x3
+	.long	0x972
+	.uleb128 0xa
+	.long	.LASF2582
+	.byte	0x8
+	.byte	0x11
+	.byte	0xbd
+	.byte	0x10
+	.long	0x9be
+	.uleb128 0x2
+	.long	.LASF2583
+	.byte	0x11
+	.byte	0xbe
+	.byte	0x11
+	.long	0x966
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2584
+	.byte	0x11
+	.byte	0xbf
+	.byte	0x19
+	.long	0x98a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2585
+	.byte	0x11
+	.byte	0xc0
+	.byte	0x3
+	.long	0x996
+	.uleb128 0xb
+	.long	0x9be
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2586
+	.uleb128 0xa
+	.long	.LASF2587
+	.byte	0x10
+	.byte	0x12
+	.byte	0x33
+	.byte	0x10
+	.long	0x9fe
+	.uleb128 0x2
+	.long	.LASF2588
+	.byte	0x12
+	.byte	0x35
+	.byte	0x23
+	.long	0x9fe
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2589
+	.byte	0x12
+	.byte	0x36
+	.byte	0x23
+	.long	0x9fe
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x9d6
+	.uleb128 0x4
+	.long	.LASF2590
+	.byte	0x12
+	.byte	0x37
+	.byte	0x3
+	.long	0x9d6
+	.uleb128 0xa
+	.long	.LASF2591
+	.byte	0x28
+	.byte	0x13
+	.byte	0x16
+	.byte	0x8
+	.long	0xa85
+	.uleb128 0x2
+	.long	.LASF2592
+	.byte	0x13
+	.byte	0x18
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2593
+	.byte	0x13
+	.byte	0x19
+	.byte	0x10
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2594
+	.byte	0x13
+	.byte	0x1a
+	.byte	0x7
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2595
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x10
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2596
+	.byte	0x13
+	.byte	0x20
+	.byte	0x7
+	.long	0x7c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2597
+	.byte	0x13
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2598
+	.byte	0x13
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2599
+	.byte	0x13
+	.byte	0x24
+	.byte	0x14
+	.long	0xa03
+	.byte	0x18
+	.byte	0
+	.uleb128 0x25
+	.byte	0x28
+	.byte	0x14
+	.byte	0x43
+	.byte	0x9
+	.long	0xab0
+	.uleb128 0x20
+	.long	.LASF2600
+	.byte	0x45
+	.byte	0x1c
+	.long	0xa0f
+	.uleb128 0x20
+	.long	.LASF2601
+	.byte	0x46
+	.byte	0x8
+	.long	0xab0
+	.uleb128 0x20
+	.long	.LASF2602
+	.byte	0x47
+	.byte	0xc
+	.long	0x8f
+	.byte	0
+	.uleb128 0xd
+	.long	0x98
+	.long	0xac0
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x27
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2603
+	.byte	0x14
+	.byte	0x48
+	.byte	0x3
+	.long	0xa85
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2604
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x10
+	.byte	0x2b
+	.long	0xaf7
+	.uleb128 0x1
+	.long	.LASF2605
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2609
+	.byte	0x10
+	.byte	0x30
+	.byte	0x3
+	.long	0xad3
+	.uleb128 0xd
+	.long	0x9f
+	.long	0xb13
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0xb0
+	.long	0xb23
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2610
+	.byte	0x10
+	.byte	0x4a
+	.byte	0x3
+	.long	0x6d3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x15
+	.byte	0x14
+	.long	0xc55
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2645
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2648
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2649
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2650
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2651
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2652
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2658
+	.byte	0x16
+	.byte	0x19
+	.byte	0x11
+	.long	0xb0
+	.uleb128 0xb
+	.long	0xc55
+	.uleb128 0x4
+	.long	.LASF2659
+	.byte	0x16
+	.byte	0x21
+	.byte	0x12
+	.long	0xde
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x17
+	.byte	0x17
+	.long	0xd02
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2674
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2675
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2676
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2677
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2678
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2679
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2680
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0x15
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2682
+	.byte	0x17
+	.byte	0x31
+	.byte	0x3
+	.long	0xc72
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x18
+	.byte	0x3e
+	.long	0xd98
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2692
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2700
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2704
+	.byte	0x18
+	.byte	0x8f
+	.byte	0x3
+	.long	0xd0e
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x19
+	.byte	0x1a
+	.long	0xe0a
+	.uleb128 0x1
+	.long	.LASF2705
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2708
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2709
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0xe
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2720
+	.byte	0x19
+	.byte	0x2a
+	.byte	0x3
+	.long	0xda4
+	.uleb128 0xb
+	.long	0xe0a
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x19
+	.byte	0x30
+	.long	0xe33
+	.uleb128 0x1
+	.long	.LASF2721
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2722
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2723
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x35
+	.byte	0x10
+	.long	0xea9
+	.uleb128 0x2
+	.long	.LASF2724
+	.byte	0x19
+	.byte	0x36
+	.byte	0xe
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0x19
+	.byte	0x37
+	.byte	0xe
+	.long	0xde
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2726
+	.byte	0x19
+	.byte	0x38
+	.byte	0xe
+	.long	0xde
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2727
+	.byte	0x19
+	.byte	0x39
+	.byte	0xe
+	.long	0xde
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2728
+	.byte	0x19
+	.byte	0x3a
+	.byte	0xe
+	.long	0xde
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2729
+	.byte	0x19
+	.byte	0x3b
+	.byte	0xe
+	.long	0xd2
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2730
+	.byte	0x19
+	.byte	0x3c
+	.byte	0xe
+	.long	0xd2
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2731
+	.byte	0x19
+	.byte	0x3d
+	.byte	0x9
+	.long	0x5cc
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2732
+	.byte	0x19
+	.byte	0x3e
+	.byte	0x3
+	.long	0xe33
+	.uleb128 0xb
+	.long	0xea9
+	.uleb128 0xa
+	.long	.LASF2733
+	.byte	0x10
+	.byte	0x19
+	.byte	0x40
+	.byte	0x10
+	.long	0xee2
+	.uleb128 0x2
+	.long	.LASF2734
+	.byte	0x19
+	.byte	0x41
+	.byte	0xe
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2735
+	.byte	0x19
+	.byte	0x42
+	.byte	0xb
+	.long	0x26e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2736
+	.byte	0x19
+	.byte	0x43
+	.byte	0x3
+	.long	0xeba
+	.uleb128 0x13
+	.long	.LASF2737
+	.byte	0x19
+	.byte	0x45
+	.byte	0xf
+	.long	0xee2
+	.uleb128 0xa
+	.long	.LASF2738
+	.byte	0x10
+	.byte	0x19
+	.byte	0x47
+	.byte	0x10
+	.long	0xf22
+	.uleb128 0x2
+	.long	.LASF2739
+	.byte	0x19
+	.byte	0x48
+	.byte	0xe
+	.long	0xc66
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2735
+	.byte	0x19
+	.byte	0x49
+	.byte	0xb
+	.long	0x26e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2740
+	.byte	0x19
+	.byte	0x4a
+	.byte	0x3
+	.long	0xefa
+	.uleb128 0xa
+	.long	.LASF2741
+	.byte	0x18
+	.byte	0x19
+	.byte	0x4c
+	.byte	0x10
+	.long	0x100c
+	.uleb128 0x2
+	.long	.LASF2742
+	.byte	0x19
+	.byte	0x4d
+	.byte	0x14
+	.long	0x6a1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2743
+	.byte	0x19
+	.byte	0x4e
+	.byte	0xd
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2744
+	.byte	0x19
+	.byte	0x4f
+	.byte	0xd
+	.long	0xbc
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2745
+	.byte	0x19
+	.byte	0x50
+	.byte	0xd
+	.long	0xbc
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0x19
+	.byte	0x51
+	.byte	0xd
+	.long	0xbc
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x19
+	.byte	0x52
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2748
+	.byte	0x19
+	.byte	0x53
+	.byte	0xd
+	.long	0x5cc
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2749
+	.byte	0x19
+	.byte	0x54
+	.byte	0xd
+	.long	0x5cc
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2750
+	.byte	0x19
+	.byte	0x55
+	.byte	0xd
+	.long	0xbc
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2751
+	.byte	0x19
+	.byte	0x56
+	.byte	0xd
+	.long	0xbc
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2752
+	.byte	0x19
+	.byte	0x57
+	.byte	0xe
+	.long	0xd2
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2753
+	.byte	0x19
+	.byte	0x58
+	.byte	0xe
+	.long	0xd2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2754
+	.byte	0x19
+	.byte	0x59
+	.byte	0xe
+	.long	0xd2
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2755
+	.byte	0x19
+	.byte	0x5a
+	.byte	0xe
+	.long	0xd2
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2756
+	.byte	0x19
+	.byte	0x5b
+	.byte	0xd
+	.long	0xbc
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2757
+	.byte	0x19
+	.byte	0x5c
+	.byte	0xd
+	.long	0xbc
+	.byte	0x17
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2758
+	.byte	0x19
+	.byte	0x5d
+	.byte	0x3
+	.long	0xf2e
+	.uleb128 0xb
+	.long	0x100c
+	.uleb128 0x13
+	.long	.LASF2759
+	.byte	0x19
+	.byte	0x5f
+	.byte	0x15
+	.long	0x100c
+	.uleb128 0x13
+	.long	.LASF2760
+	.byte	0x19
+	.byte	0x5f
+	.byte	0x3c
+	.long	0x100c
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x1a
+	.byte	0x20
+	.long	0x1059
+	.uleb128 0x1
+	.long	.LASF2761
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2762
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x1b
+	.byte	0x14
+	.long	0x1083
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0xbc
+	.long	0x1093
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2770
+	.byte	0x1b
+	.byte	0x1c
+	.byte	0x10
+	.long	0x1083
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x1b
+	.byte	0x2d
+	.long	0x10d5
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x40
+	.byte	0
+	.uleb128 0x21
+	.long	0xeee
+	.byte	0x49
+	.byte	0x8
+	.uleb128 0xa
+	.long	.LASF2778
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0x4c
+	.byte	0x10
+	.long	0x1111
+	.uleb128 0x9
+	.string	"sum"
+	.byte	0x1c
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb13
+	.byte	0
+	.uleb128 0x9
+	.string	"var"
+	.byte	0x1c
+	.byte	0x4e
+	.byte	0xd
+	.long	0x1111
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2779
+	.byte	0x1c
+	.byte	0x4f
+	.byte	0xe
+	.long	0xd2
+	.byte	0x48
+	.byte	0
+	.uleb128 0xd
+	.long	0x262
+	.long	0x1121
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2780
+	.byte	0x1c
+	.byte	0x50
+	.byte	0x3
+	.long	0x10dc
+	.uleb128 0xb
+	.long	0x1121
+	.uleb128 0x24
+	.long	.LASF2782
+	.byte	0x1c
+	.byte	0x52
+	.byte	0x5
+	.long	0x5cc
+	.uleb128 0x1d
+	.long	.LASF2783
+	.value	0x8e8
+	.byte	0x1c
+	.byte	0x54
+	.long	0x11e8
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0x1c
+	.byte	0x55
+	.byte	0xf
+	.long	0xb23
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0x1c
+	.byte	0x56
+	.byte	0x17
+	.long	0x1121
+	.byte	0xc8
+	.uleb128 0x10
+	.long	.LASF2786
+	.byte	0x58
+	.byte	0x12
+	.long	0x438
+	.value	0x114
+	.uleb128 0x10
+	.long	.LASF2787
+	.byte	0x59
+	.byte	0x18
+	.long	0x11e8
+	.value	0x2d8
+	.uleb128 0x10
+	.long	.LASF2788
+	.byte	0x5a
+	.byte	0xd
+	.long	0xbc
+	.value	0x2e0
+	.uleb128 0x10
+	.long	.LASF2789
+	.byte	0x5b
+	.byte	0xd
+	.long	0xbc
+	.value	0x2e1
+	.uleb128 0x10
+	.long	.LASF2790
+	.byte	0x5d
+	.byte	0x9
+	.long	0x5cc
+	.value	0x2e2
+	.uleb128 0x10
+	.long	.LASF2791
+	.byte	0x5e
+	.byte	0x18
+	.long	0x11fd
+	.value	0x2e4
+	.uleb128 0x10
+	.long	.LASF2735
+	.byte	0x60
+	.byte	0xb
+	.long	0x26e
+	.value	0x8b4
+	.uleb128 0x10
+	.long	.LASF2792
+	.byte	0x61
+	.byte	0xd
+	.long	0xb03
+	.value	0x8c0
+	.uleb128 0x10
+	.long	.LASF2793
+	.byte	0x62
+	.byte	0x12
+	.long	0xea9
+	.value	0x8c8
+	.uleb128 0x10
+	.long	.LASF2794
+	.byte	0x63
+	.byte	0x9
+	.long	0x5cc
+	.value	0x8e4
+	.byte	0
+	.uleb128 0xd
+	.long	0x11f8
+	.long	0x11f8
+	.uleb128 0xe
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x3e7
+	.uleb128 0xd
+	.long	0x2dd
+	.long	0x120d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2795
+	.byte	0x1c
+	.byte	0x64
+	.byte	0x3
+	.long	0x113e
+	.uleb128 0xb
+	.long	0x120d
+	.uleb128 0x14
+	.long	.LASF2796
+	.byte	0x66
+	.byte	0x15
+	.long	0x120d
+	.uleb128 0x14
+	.long	.LASF2797
+	.byte	0x6a
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0xd
+	.long	0xf22
+	.long	0x1244
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2798
+	.byte	0x74
+	.byte	0x15
+	.long	0x1234
+	.uleb128 0x14
+	.long	.LASF2799
+	.byte	0x75
+	.byte	0x19
+	.long	0xcd
+	.uleb128 0x14
+	.long	.LASF2800
+	.byte	0x76
+	.byte	0x19
+	.long	0xcd
+	.uleb128 0x14
+	.long	.LASF2801
+	.byte	0x77
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x14
+	.long	.LASF2802
+	.byte	0x78
+	.byte	0xc
+	.long	0x5cc
+	.uleb128 0x13
+	.long	.LASF2803
+	.byte	0x1c
+	.byte	0x86
+	.byte	0x1b
+	.long	0x1018
+	.uleb128 0x21
+	.long	0x101d
+	.byte	0x86
+	.byte	0x44
+	.uleb128 0x21
+	.long	0x1029
+	.byte	0x86
+	.byte	0x64
+	.uleb128 0x13
+	.long	.LASF2804
+	.byte	0x1c
+	.byte	0x86
+	.byte	0x8f
+	.long	0x52b
+	.uleb128 0x32
+	.long	0x1295
+	.byte	0xb7
+	.uleb128 0x33
+	.long	0x127b
+	.byte	0x88
+	.byte	0x14
+	.uleb128 0x11
+	.long	.LASF2805
+	.byte	0x17
+	.byte	0x3c
+	.long	0x12bf
+	.uleb128 0x3
+	.long	0xd02
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2885
+	.byte	0x1f
+	.byte	0x39
+	.byte	0x5
+	.long	0x5cc
+	.uleb128 0x11
+	.long	.LASF2806
+	.byte	0x18
+	.byte	0xc3
+	.long	0x12dc
+	.uleb128 0x3
+	.long	0xd98
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2809
+	.byte	0x8
+	.byte	0x56
+	.byte	0x7
+	.long	0xfb
+	.long	0x12f2
+	.uleb128 0x3
+	.long	0x12f2
+	.byte	0
+	.uleb128 0x5
+	.long	0x262
+	.uleb128 0x11
+	.long	.LASF2807
+	.byte	0x8
+	.byte	0x54
+	.long	0x130d
+	.uleb128 0x3
+	.long	0x12f2
+	.uleb128 0x3
+	.long	0xfb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2808
+	.byte	0x8
+	.byte	0x53
+	.long	0x131e
+	.uleb128 0x3
+	.long	0x12f2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2810
+	.byte	0x9
+	.byte	0x8c
+	.byte	0x7
+	.long	0xfb
+	.long	0x1339
+	.uleb128 0x3
+	.long	0x1339
+	.uleb128 0x3
+	.long	0xfb
+	.byte	0
+	.uleb128 0x5
+	.long	0x2dd
+	.uleb128 0x11
+	.long	.LASF2811
+	.byte	0x9
+	.byte	0x89
+	.long	0x1354
+	.uleb128 0x3
+	.long	0x1354
+	.uleb128 0x3
+	.long	0x331
+	.byte	0
+	.uleb128 0x5
+	.long	0x438
+	.uleb128 0x11
+	.long	.LASF2812
+	.byte	0x9
+	.byte	0x88
+	.long	0x1379
+	.uleb128 0x3
+	.long	0x1354
+	.uleb128 0x3
+	.long	0x331
+	.uleb128 0x3
+	.long	0x7c
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2813
+	.byte	0x1d
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0x1390
+	.uleb128 0x3
+	.long	0xfb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2814
+	.byte	0x1e
+	.byte	0x1e
+	.long	0x13a6
+	.uleb128 0x3
+	.long	0x13a6
+	.uleb128 0x3
+	.long	0xbc
+	.byte	0
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x12
+	.long	.LASF2815
+	.byte	0x9
+	.byte	0x85
+	.byte	0x14
+	.long	0x11f8
+	.long	0x13da
+	.uleb128 0x3
+	.long	0x1354
+	.uleb128 0x3
+	.long	0x354
+	.uleb128 0x3
+	.long	0xfb
+	.uleb128 0x3
+	.long	0xde
+	.uleb128 0x3
+	.long	0xfb
+	.uleb128 0x3
+	.long	0x325
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2816
+	.byte	0x9
+	.byte	0x6f
+	.byte	0x7
+	.long	0xfb
+	.long	0x13f5
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0xd2
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2817
+	.byte	0x9
+	.byte	0x8b
+	.long	0x1410
+	.uleb128 0x3
+	.long	0x1339
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xd2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2818
+	.byte	0x9
+	.byte	0x83
+	.byte	0x14
+	.long	0x11f8
+	.long	0x1430
+	.uleb128 0x3
+	.long	0x1354
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xfb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2819
+	.byte	0x9
+	.byte	0x84
+	.byte	0x14
+	.long	0x11f8
+	.long	0x1450
+	.uleb128 0x3
+	.long	0x1354
+	.uleb128 0x3
+	.long	0xfb
+	.uleb128 0x3
+	.long	0xde
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2820
+	.byte	0x9
+	.byte	0x82
+	.long	0x1466
+	.uleb128 0x3
+	.long	0x1354
+	.uleb128 0x3
+	.long	0xbc
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2821
+	.byte	0x1f
+	.byte	0x6a
+	.long	0x1477
+	.uleb128 0x3
+	.long	0xde
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2822
+	.byte	0x20
+	.byte	0x1b
+	.byte	0x5
+	.long	0x5cc
+	.long	0x148d
+	.uleb128 0x3
+	.long	0x6ce
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2823
+	.byte	0x21
+	.byte	0xc
+	.byte	0xa
+	.long	0xde
+	.long	0x14b2
+	.uleb128 0x3
+	.long	0x14b2
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x5cc
+	.byte	0
+	.uleb128 0x5
+	.long	0xb23
+	.uleb128 0x12
+	.long	.LASF2824
+	.byte	0x22
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x14d7
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0x7c
+	.uleb128 0x3
+	.long	0xef
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2825
+	.value	0x35e
+	.byte	0x15
+	.long	0x14f4
+	.long	0x14f4
+	.uleb128 0x6
+	.long	.LASF2827
+	.value	0x35e
+	.byte	0x2e
+	.long	0xbc
+	.byte	0
+	.uleb128 0x5
+	.long	0xeb5
+	.uleb128 0x15
+	.long	.LASF2829
+	.value	0x359
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x16
+	.long	.LASF2826
+	.value	0x354
+	.byte	0x9
+	.long	0x9f
+	.long	0x1522
+	.uleb128 0x6
+	.long	.LASF2828
+	.value	0x354
+	.byte	0x19
+	.long	0x7c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2830
+	.value	0x34f
+	.byte	0x9
+	.long	0x9f
+	.uleb128 0x26
+	.long	.LASF2861
+	.value	0x348
+	.uleb128 0x15
+	.long	.LASF2831
+	.value	0x343
+	.byte	0xa
+	.long	0xde
+	.uleb128 0x15
+	.long	.LASF2832
+	.value	0x33e
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x16
+	.long	.LASF2833
+	.value	0x333
+	.byte	0x5
+	.long	0x5cc
+	.long	0x1576
+	.uleb128 0x6
+	.long	.LASF2834
+	.value	0x333
+	.byte	0x21
+	.long	0x1576
+	.uleb128 0x7
+	.long	.LASF2835
+	.value	0x335
+	.byte	0x13
+	.long	0xc8
+	.byte	0
+	.uleb128 0x5
+	.long	0xf22
+	.uleb128 0x16
+	.long	.LASF2836
+	.value	0x322
+	.byte	0x5
+	.long	0x5cc
+	.long	0x15be
+	.uleb128 0x6
+	.long	.LASF2837
+	.value	0x322
+	.byte	0x1d
+	.long	0xc66
+	.uleb128 0x7
+	.long	.LASF2838
+	.value	0x324
+	.byte	0x13
+	.long	0xc8
+	.uleb128 0x7
+	.long	.LASF2834
+	.value	0x329
+	.byte	0x13
+	.long	0x1576
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x32b
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2839
+	.value	0x313
+	.byte	0x5
+	.long	0x5cc
+	.long	0x15f3
+	.uleb128 0x6
+	.long	.LASF2840
+	.value	0x313
+	.byte	0x1e
+	.long	0xc66
+	.uleb128 0x6
+	.long	.LASF2841
+	.value	0x313
+	.byte	0x39
+	.long	0xc55
+	.uleb128 0x7
+	.long	.LASF2842
+	.value	0x31b
+	.byte	0x17
+	.long	0xc61
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2855
+	.value	0x304
+	.byte	0x1c
+	.long	0x15ff
+	.uleb128 0x5
+	.long	0x1219
+	.uleb128 0x17
+	.long	.LASF2843
+	.value	0x2f0
+	.long	0x161e
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x2fa
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2844
+	.value	0x27b
+	.long	0x1694
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x27b
+	.byte	0x25
+	.long	0x1694
+	.uleb128 0x7
+	.long	.LASF2735
+	.value	0x29c
+	.byte	0xb
+	.long	0x26e
+	.uleb128 0x22
+	.long	0x1653
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x29d
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x22
+	.long	0x1685
+	.uleb128 0x7
+	.long	.LASF2786
+	.value	0x2a4
+	.byte	0x17
+	.long	0x1354
+	.uleb128 0x22
+	.long	0x1676
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x2aa
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x2af
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x2b7
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x120d
+	.uleb128 0x1a
+	.long	.LASF2847
+	.value	0x256
+	.long	0x16e5
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x256
+	.byte	0x2c
+	.long	0x1694
+	.uleb128 0x6
+	.long	.LASF2846
+	.value	0x256
+	.byte	0x3c
+	.long	0x5cc
+	.uleb128 0x7
+	.long	.LASF2793
+	.value	0x258
+	.byte	0x13
+	.long	0x16e5
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2542
+	.value	0x263
+	.byte	0x18
+	.long	0x16ea
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x26c
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xea9
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x1a
+	.long	.LASF2848
+	.value	0x22f
+	.long	0x172f
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x22f
+	.byte	0x32
+	.long	0x1694
+	.uleb128 0x6
+	.long	.LASF2743
+	.value	0x22f
+	.byte	0x46
+	.long	0xbc
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x231
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2849
+	.value	0x23f
+	.byte	0x19
+	.long	0x102
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2850
+	.value	0x22a
+	.byte	0x5
+	.long	0x5cc
+	.uleb128 0x17
+	.long	.LASF2851
+	.value	0x21a
+	.long	0x1753
+	.uleb128 0x6
+	.long	.LASF2852
+	.value	0x21a
+	.byte	0x1f
+	.long	0x5cc
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2853
+	.value	0x214
+	.long	0x176b
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x214
+	.byte	0x34
+	.long	0x1694
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2857
+	.value	0x20f
+	.byte	0xc
+	.long	0x5cc
+	.long	0x1788
+	.uleb128 0x6
+	.long	.LASF2854
+	.value	0x20f
+	.byte	0x43
+	.long	0x1788
+	.byte	0
+	.uleb128 0x5
+	.long	0x112d
+	.uleb128 0x27
+	.long	.LASF2856
+	.value	0x20a
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x1b
+	.long	.LASF2858
+	.value	0x205
+	.byte	0xc
+	.long	0x5cc
+	.long	0x17b6
+	.uleb128 0x6
+	.long	.LASF2854
+	.value	0x205
+	.byte	0x43
+	.long	0x1788
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2859
+	.value	0x1f5
+	.byte	0x5
+	.long	0x5cc
+	.uleb128 0x16
+	.long	.LASF2860
+	.value	0x1f0
+	.byte	0x5
+	.long	0x5cc
+	.long	0x17df
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x1f0
+	.byte	0x39
+	.long	0x15ff
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2862
+	.value	0x1e6
+	.uleb128 0x1a
+	.long	.LASF2863
+	.value	0x1da
+	.long	0x17fe
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x1da
+	.byte	0x31
+	.long	0x1694
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2864
+	.value	0x1ca
+	.long	0x1824
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x1ca
+	.byte	0x2f
+	.long	0x1694
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2865
+	.value	0x1cc
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2866
+	.value	0x1c0
+	.long	0x1862
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x1c0
+	.byte	0x28
+	.long	0x1694
+	.uleb128 0x6
+	.long	.LASF2867
+	.value	0x1c0
+	.byte	0x3d
+	.long	0xd2
+	.uleb128 0x6
+	.long	.LASF2868
+	.value	0x1c0
+	.byte	0x4f
+	.long	0xd2
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2869
+	.value	0x1c5
+	.byte	0x15
+	.long	0x102
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2870
+	.value	0x1b2
+	.byte	0x11
+	.long	0xd2
+	.long	0x1897
+	.uleb128 0x6
+	.long	.LASF2867
+	.value	0x1b2
+	.byte	0x3a
+	.long	0xd2
+	.uleb128 0x6
+	.long	.LASF2868
+	.value	0x1b2
+	.byte	0x4c
+	.long	0xd2
+	.uleb128 0x7
+	.long	.LASF2871
+	.value	0x1b4
+	.byte	0x14
+	.long	0xea
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2872
+	.value	0x19b
+	.long	0x18d5
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x19b
+	.byte	0x26
+	.long	0x1694
+	.uleb128 0x6
+	.long	.LASF2873
+	.value	0x19b
+	.byte	0x3a
+	.long	0xbc
+	.uleb128 0x7
+	.long	.LASF2871
+	.value	0x19e
+	.byte	0x14
+	.long	0xea
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2828
+	.value	0x1aa
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2874
+	.value	0x184
+	.byte	0x5
+	.long	0x5cc
+	.uleb128 0x1b
+	.long	.LASF2875
+	.value	0x142
+	.byte	0xc
+	.long	0x5cc
+	.long	0x1916
+	.uleb128 0x6
+	.long	.LASF2845
+	.value	0x142
+	.byte	0x29
+	.long	0x1694
+	.uleb128 0x6
+	.long	.LASF2827
+	.value	0x142
+	.byte	0x3d
+	.long	0xbc
+	.uleb128 0x7
+	.long	.LASF2876
+	.value	0x162
+	.byte	0x18
+	.long	0xe16
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF2877
+	.byte	0x1c
+	.byte	0xab
+	.byte	0x15
+	.long	0xe0a
+	.long	0x193e
+	.uleb128 0x37
+	.string	"dev"
+	.byte	0x1c
+	.byte	0xab
+	.byte	0x2b
+	.long	0x14b2
+	.uleb128 0x14
+	.long	.LASF2876
+	.byte	0xad
+	.byte	0x12
+	.long	0xe0a
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2878
+	.byte	0xa6
+	.byte	0x1d
+	.long	0x1949
+	.uleb128 0x5
+	.long	0x9ca
+	.uleb128 0x23
+	.long	.LASF2879
+	.byte	0xa1
+	.byte	0x1b
+	.long	0x1959
+	.uleb128 0x5
+	.long	0x90d
+	.uleb128 0x23
+	.long	.LASF2880
+	.byte	0x9c
+	.byte	0x14
+	.long	0x87e
+	.uleb128 0x28
+	.long	.LASF2881
+	.byte	0x5f
+	.byte	0xbb
+	.long	0x1974
+	.uleb128 0x5
+	.long	0x100c
+	.uleb128 0x28
+	.long	.LASF2882
+	.byte	0x5f
+	.byte	0x6f
+	.long	0x1984
+	.uleb128 0x5
+	.long	0x1018
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 35 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.file 38 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 40 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 41 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 46 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 53 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1142
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 63 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3f
+	.file 64 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 65 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 66 "./src/main/build/trace.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 67 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x43
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.file 68 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 69 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xd
+	.file 70 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 71 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1679
+	.file 72 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1682
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1691
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1696
+	.byte	0x4
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 80 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1729
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1730
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1731
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1732
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1733
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1734
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1735
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1736
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1737
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1749
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1756
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1757
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1758
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1761
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5d
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1762
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 95 "./src/main/drivers/accgyro/accgyro_adxl345.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/drivers/accgyro/accgyro_bma280.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x20
+	.byte	0x4
+	.file 97 "./src/main/drivers/accgyro/accgyro_l3g4200d.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/drivers/accgyro/accgyro_l3gd20.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "./src/main/drivers/accgyro/accgyro_lsm303dlhc.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 100 "./src/main/drivers/accgyro/accgyro_mma845x.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x64
+	.byte	0x4
+	.file 101 "./src/main/drivers/accgyro/accgyro_mpu3050.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 102 "./src/main/drivers/accgyro/accgyro_mpu6050.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x66
+	.byte	0x4
+	.file 103 "./src/main/drivers/accgyro/accgyro_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 104 "./src/main/drivers/accgyro/accgyro_spi_bmi160.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x68
+	.byte	0x4
+	.file 105 "./src/main/drivers/accgyro/accgyro_spi_icm20689.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 106 "./src/main/drivers/accgyro/accgyro_spi_mpu6000.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 107 "./src/main/drivers/accgyro/accgyro_spi_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6b
+	.byte	0x4
+	.file 108 "./src/main/drivers/accgyro/accgyro_spi_mpu9250.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 109 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1991
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x21
+	.byte	0x4
+	.file 110 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x6e
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 111 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.file 112 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2393
+	.byte	0x4
+	.byte	0x4
+	.file 113 "./src/main/io/statusindicator.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2412
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.9f8b128333f8cca0a707261000791500,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1174
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1184
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1186
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1194
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1196
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1198
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1274
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1345
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1362
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1392
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1393
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1415
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.trace.h.31.e6db63bc7bc873213f50daf721f0f83f,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1418
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1422
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.e08278c015129c2bd6e9a5b0d30489bd,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1438
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1469
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1475
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1493
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1582
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1394
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1395
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1688
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1711
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1728
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1752
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1760
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_lsm303dlhc.h.57.fca8398e4fda95a0f26079c2c3deff7e,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1960
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu3050.h.21.5c2c3f68cf533de2f049158113684e6d,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu6500.h.20.81784e103e59d17986bd067df6cf9997,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_icm20689.h.21.e4ceb006a38c1b53339fd03e766f2c2c,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1981
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu6000.h.6.3b6c85f4d39f2b8f455a259d1cae7373,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu9250.h.6.ec8aa7be40d86c318c904947d7c80cc8,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1993
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2381
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.38.6b984264cdc3ea801be8575590326aa8,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyroanalyse.h.24.d83421841cfcc753a55e2729ef7d5afa,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2406
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2886
+	.long	.LASF2887
+	.long	.LASF2888
+	.long	.LASF2889
+	.long	.LASF2890
+	.long	.LASF2891
+	.long	.LASF2892
+	.long	.LASF2893
+	.long	.LASF2894
+	.long	.LASF2895
+	.long	.LASF2896
+	.long	.LASF2897
+	.long	.LASF2898
+	.long	.LASF2899
+	.long	.LASF2900
+	.long	.LASF2901
+	.long	.LASF2902
+	.long	.LASF2903
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x72
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2904
+	.byte	0xe
+	.long	.LASF2905
+	.byte	0xe
+	.long	.LASF2906
+	.byte	0xe
+	.long	.LASF2907
+	.byte	0x12
+	.long	.LASF2908
+	.byte	0xa
+	.long	.LASF2909
+	.byte	0x1
+	.long	.LASF2910
+	.byte	0x2
+	.long	.LASF2911
+	.byte	0x2
+	.long	.LASF2912
+	.byte	0x2
+	.long	.LASF2913
+	.byte	0x3
+	.long	.LASF2914
+	.byte	0x5
+	.long	.LASF2915
+	.byte	0x5
+	.long	.LASF2916
+	.byte	0x5
+	.long	.LASF2917
+	.byte	0x5
+	.long	.LASF2918
+	.byte	0x5
+	.long	.LASF2919
+	.byte	0x4
+	.long	.LASF2920
+	.byte	0x4
+	.long	.LASF2921
+	.byte	0xe
+	.long	.LASF2922
+	.byte	0xe
+	.long	.LASF2923
+	.byte	0xe
+	.long	.LASF2924
+	.byte	0x5
+	.long	.LASF2925
+	.byte	0x2
+	.long	.LASF2926
+	.byte	0x7
+	.long	.LASF2927
+	.byte	0x8
+	.long	.LASF2928
+	.byte	0x9
+	.long	.LASF2929
+	.byte	0x9
+	.long	.LASF2930
+	.byte	0x9
+	.long	.LASF2931
+	.byte	0x9
+	.long	.LASF2932
+	.byte	0xe
+	.long	.LASF2933
+	.byte	0x9
+	.long	.LASF2934
+	.byte	0x6
+	.long	.LASF2935
+	.byte	0x4
+	.long	.LASF2936
+	.byte	0x5
+	.long	.LASF2937
+	.byte	0x11
+	.long	.LASF2938
+	.byte	0x11
+	.long	.LASF2939
+	.byte	0x12
+	.long	.LASF2940
+	.byte	0x12
+	.long	.LASF2940
+	.byte	0x11
+	.long	.LASF2941
+	.byte	0xe
+	.long	.LASF2942
+	.byte	0x11
+	.long	.LASF2943
+	.byte	0x11
+	.long	.LASF2944
+	.byte	0xe
+	.long	.LASF2945
+	.byte	0xe
+	.long	.LASF2946
+	.byte	0x10
+	.long	.LASF2947
+	.byte	0xe
+	.long	.LASF2948
+	.byte	0xf
+	.long	.LASF2949
+	.byte	0xf
+	.long	.LASF2950
+	.byte	0xe
+	.long	.LASF2951
+	.byte	0xe
+	.long	.LASF2952
+	.byte	0xe
+	.long	.LASF2953
+	.byte	0xd
+	.long	.LASF2954
+	.byte	0xd
+	.long	.LASF2955
+	.byte	0x11
+	.long	.LASF2956
+	.byte	0x11
+	.long	.LASF2957
+	.byte	0xe
+	.long	.LASF2958
+	.byte	0xe
+	.long	.LASF2959
+	.byte	0xe
+	.long	.LASF2960
+	.byte	0xe
+	.long	.LASF2961
+	.byte	0xe
+	.long	.LASF2962
+	.byte	0xe
+	.long	.LASF2963
+	.byte	0xe
+	.long	.LASF2964
+	.byte	0xe
+	.long	.LASF2965
+	.byte	0xc
+	.long	.LASF2966
+	.byte	0xb
+	.long	.LASF2967
+	.byte	0xb
+	.long	.LASF2968
+	.byte	0x1
+	.long	.LASF2969
+	.byte	0x2
+	.long	.LASF2970
+	.byte	0x1
+	.long	.LASF2971
+	.byte	0x3
+	.long	.LASF2972
+	.byte	0x5
+	.long	.LASF2973
+	.byte	0x11
+	.long	.LASF2974
+	.byte	0x11
+	.long	.LASF2975
+	.byte	0xd
+	.long	.LASF2976
+	.byte	0xd
+	.long	.LASF2977
+	.byte	0xe
+	.long	.LASF2978
+	.byte	0xe
+	.long	.LASF2974
+	.byte	0xe
+	.long	.LASF2979
+	.byte	0xd
+	.long	.LASF2980
+	.byte	0xe
+	.long	.LASF2925
+	.byte	0x11
+	.long	.LASF2925
+	.byte	0xe
+	.long	.LASF2981
+	.byte	0xd
+	.long	.LASF2982
+	.byte	0xd
+	.long	.LASF2983
+	.byte	0xd
+	.long	.LASF2984
+	.byte	0xd
+	.long	.LASF2985
+	.byte	0xd
+	.long	.LASF2986
+	.byte	0xe
+	.long	.LASF2987
+	.byte	0xe
+	.long	.LASF2988
+	.byte	0xe
+	.long	.LASF2989
+	.byte	0xe
+	.long	.LASF2990
+	.byte	0xd
+	.long	.LASF2991
+	.byte	0xd
+	.long	.LASF2992
+	.byte	0xe
+	.long	.LASF2993
+	.byte	0xe
+	.long	.LASF2994
+	.byte	0x4
+	.long	.LASF2995
+	.byte	0x4
+	.long	.LASF2996
+	.byte	0x4
+	.long	.LASF2997
+	.byte	0x4
+	.long	.LASF2998
+	.byte	0x4
+	.long	.LASF2999
+	.byte	0x4
+	.long	.LASF3000
+	.byte	0x4
+	.long	.LASF3001
+	.byte	0x4
+	.long	.LASF3002
+	.byte	0x4
+	.long	.LASF3003
+	.byte	0x4
+	.long	.LASF3004
+	.byte	0x4
+	.long	.LASF3005
+	.byte	0x4
+	.long	.LASF3006
+	.byte	0x4
+	.long	.LASF3007
+	.byte	0x4
+	.long	.LASF3008
+	.byte	0x5
+	.long	.LASF3009
+	.byte	0x5
+	.long	.LASF3010
+	.byte	0x5
+	.long	.LASF3011
+	.byte	0x5
+	.long	.LASF3012
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2373:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2145:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF2408:
+	.string	"GYRO_HEALTH_MAX_STUCK_SAMPLES 100"
+.LASF1703:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF2509:
+	.string	"extiHandlerCallback"
+.LASF1441:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF2009:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF760:
+	.string	"__DECL_SIMD_logf "
+.LASF804:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2602:
+	.string	"__align"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2561:
+	.string	"mpuConfiguration_s"
+.LASF2565:
+	.string	"mpuConfiguration_t"
+.LASF993:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1900:
+	.string	"LSM303DLHC_IT1_OVERRUN ((uint8_t)0x02)"
+.LASF1935:
+	.string	"LSM303DLHC_FS_1_3_GA ((uint8_t) 0x20)"
+.LASF1309:
+	.string	"USE_FAKE_BARO "
+.LASF1016:
+	.string	"__DECL_SIMD_exp"
+.LASF1269:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1815:
+	.string	"LSM303DLHC_OUT_Z_L_A 0x2C"
+.LASF2020:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1386:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1276:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2550:
+	.string	"gyroAlign"
+.LASF2591:
+	.string	"__pthread_mutex_s"
+.LASF2116:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1979:
+	.string	"MPU6500_BIT_I2C_IF_DIS (1 << 4)"
+.LASF869:
+	.string	"__DECL_SIMD_sinh "
+.LASF1921:
+	.string	"LSM303DLHC_X_DOUBLE_CLICK ((uint8_t)0x02)"
+.LASF1427:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1893:
+	.string	"LSM303DLHC_HPF_AOI2_ENABLE ((uint8_t)0x02)"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2055:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1270:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF797:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1712:
+	.string	"sched_priority sched_priority"
+.LASF1330:
+	.string	"USE_PPM"
+.LASF1947:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_5_6Ga 330"
+.LASF1600:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1627:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2574:
+	.string	"ICM_20602_SPI"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1684:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1249:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1945:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4Ga 450"
+.LASF2821:
+	.string	"sensorsSet"
+.LASF2276:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF913:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF770:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2106:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1650:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1618:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1691:
+	.string	"__pid_t_defined "
+.LASF1418:
+	.string	"TRACE_END(event,arg) {}"
+.LASF2503:
+	.string	"reset"
+.LASF828:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1476:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2357:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2469:
+	.string	"targetCount"
+.LASF1229:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2750:
+	.string	"gyro_to_use"
+.LASF1357:
+	.string	"LED_STRIP_TIMER 1"
+.LASF2462:
+	.string	"m_newM"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2418:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2464:
+	.string	"m_newS"
+.LASF1058:
+	.string	"__DECL_SIMD_sinhf"
+.LASF2097:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF1033:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2277:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2516:
+	.string	"_Bool"
+.LASF2075:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF728:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1114:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2222:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"SKIP_IMU_CALC "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1295:
+	.string	"U_ID_2 2"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2507:
+	.string	"extiCallbackRec_t"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2840:
+	.string	"currentTimeUs"
+.LASF1147:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2836:
+	.string	"gyroSamplePush"
+.LASF1698:
+	.string	"__CPU_SETSIZE 1024"
+.LASF937:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1271:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2619:
+	.string	"OWNER_ADC_CURR"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2284:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2076:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1555:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2237:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2337:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2310:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2675:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2329:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2669:
+	.string	"BEEPER_GPS_STATUS"
+.LASF2182:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1998:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1957:
+	.string	"LSM303DLHC_SINGLE_CONVERSION ((uint8_t) 0x01)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2529:
+	.string	"CW90_DEG_FLIP"
+.LASF2833:
+	.string	"gyroSamplePop"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2515:
+	.string	"I2CDevice"
+.LASF2016:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2300:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2187:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1056:
+	.string	"__DECL_SIMD_sinh"
+.LASF1356:
+	.string	"USE_SPI"
+.LASF1491:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1625:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2531:
+	.string	"CW270_DEG_FLIP"
+.LASF2386:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF774:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1378:
+	.string	"__WCHAR_T__ "
+.LASF1277:
+	.string	"USE_SENSOR_NAMES "
+.LASF1400:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2369:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1909:
+	.string	"LSM303DLHC_MOV_RECOGNITION ((uint8_t)0x40)"
+.LASF1161:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1150:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1539:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1874:
+	.string	"LSM303DLHC_BLE_LSB ((uint8_t)0x00)"
+.LASF2770:
+	.string	"detectedSensors"
+.LASF1531:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF918:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2208:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF2192:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2848:
+	.string	"performGyroCalibration"
+.LASF1968:
+	.string	"MPU6500_WHO_AM_I_CONST (0x70)"
+.LASF2341:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2691:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2316:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1495:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1820:
+	.string	"LSM303DLHC_INT1_SOURCE_A 0x31"
+.LASF2616:
+	.string	"OWNER_LED"
+.LASF733:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2040:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2345:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2547:
+	.string	"mpuDividerDrops"
+.LASF1106:
+	.string	"__DECL_SIMD_tanf"
+.LASF2719:
+	.string	"GYRO_FAKE"
+.LASF887:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF758:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2563:
+	.string	"resetFn"
+.LASF2429:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1148:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1702:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF2517:
+	.string	"deviceSpi_s"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2308:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1859:
+	.string	"LSM303DLHC_ODR_1620_HZ_LP ((uint8_t)0x80)"
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2078:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2152:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2727:
+	.string	"saturatedCount"
+.LASF1261:
+	.string	"TELEMETRY_HOTT "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1060:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1590:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1486:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1210:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF727:
+	.string	"_MATH_H 1"
+.LASF1403:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2261:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1971:
+	.string	"ICM20601_WHO_AM_I_CONST (0xAC)"
+.LASF1934:
+	.string	"LSM303DLHC_ODR_220_HZ ((uint8_t) 0x1C)"
+.LASF1367:
+	.string	"_T_PTRDIFF_ "
+.LASF1361:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF1658:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF2221:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF741:
+	.string	"__DECL_SIMD_sinl "
+.LASF1595:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1527:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1324:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2024:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2751:
+	.string	"gyro_fusion_mode"
+.LASF1620:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF1225:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2287:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2388:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2783:
+	.string	"gyroSensor_s"
+.LASF1811:
+	.string	"LSM303DLHC_OUT_X_L_A 0x28"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1535:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1792:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2764:
+	.string	"GYRO_FFT_WINDOW_256"
+.LASF2794:
+	.string	"calibrationMissed"
+.LASF989:
+	.string	"__DECL_SIMD_tan "
+.LASF1465:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1100:
+	.string	"__DECL_SIMD_erfc"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"__wchar_t__ "
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2674:
+	.string	"BEEPER_READY_BEEP"
+.LASF762:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2028:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2882:
+	.string	"gyroConfig"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2"
+.LASF2332:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1430:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1829:
+	.string	"LSM303DLHC_CLICK_THS_A 0x3A"
+.LASF1132:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2803:
+	.string	"pgResetTemplate_gyroConfig"
+.LASF2851:
+	.string	"gyroStartCalibration"
+.LASF1265:
+	.string	"CMS "
+.LASF1836:
+	.string	"LSM303DLHC_OUT_X_H_M 0x03"
+.LASF2741:
+	.string	"gyroConfig_s"
+.LASF818:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2340:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2842:
+	.string	"timeoutUs"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2233:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF2296:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF761:
+	.string	"__DECL_SIMD_logl "
+.LASF2148:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2368:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2623:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2642:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2708:
+	.string	"GYRO_L3G4200D"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"__DECL_SIMD_tanh"
+.LASF1493:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF2307:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1912:
+	.string	"LSM303DLHC_Z_LOW ((uint8_t)0x10)"
+.LASF1466:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2001:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1933:
+	.string	"LSM303DLHC_ODR_75_HZ ((uint8_t) 0x18)"
+.LASF1312:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1462:
+	.string	"BIT(x) (1 << (x))"
+.LASF2647:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2095:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF769:
+	.string	"__DECL_SIMD_exp "
+.LASF979:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1104:
+	.string	"__DECL_SIMD_tan"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1162:
+	.string	"_Mdouble_"
+.LASF2427:
+	.string	"int32_t"
+.LASF2030:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2197:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1884:
+	.string	"LSM303DLHC_HPFCF_32 ((uint8_t)0x20)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2319:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"FAST_MATH "
+.LASF1308:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1019:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1450:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF1080:
+	.string	"__DECL_SIMD_atanh"
+.LASF953:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1651:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2151:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1388:
+	.string	"___int_wchar_t_h "
+.LASF2655:
+	.string	"OWNER_SPI_PREINIT"
+.LASF771:
+	.string	"__DECL_SIMD_expl "
+.LASF1670:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2290:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF2007:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2413:
+	.string	"unsigned char"
+.LASF1985:
+	.string	"BITS_DLPF_CFG_98HZ 0x02"
+.LASF2060:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1882:
+	.string	"LSM303DLHC_HPFCF_8 ((uint8_t)0x00)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF2384:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1354:
+	.string	"VTX_TRAMP"
+.LASF2163:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF2136:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF1594:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2644:
+	.string	"OWNER_BARO_EXTI"
+.LASF1512:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2480:
+	.string	"biquadFilterType_e"
+.LASF1018:
+	.string	"__DECL_SIMD_expf"
+.LASF2082:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1799:
+	.string	"LSM303DLHC_I2C_SDA_PIN PB7"
+.LASF515:
+	.string	"__always_inline"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF954:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2476:
+	.string	"FILTER_FIR"
+.LASF1984:
+	.string	"BITS_DLPF_CFG_188HZ 0x01"
+.LASF1915:
+	.string	"LSM303DLHC_X_HIGH ((uint8_t)0x02)"
+.LASF868:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF2880:
+	.string	"gyroSensorBus"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1331:
+	.string	"USE_PWM"
+.LASF2155:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2372:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1460:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2622:
+	.string	"OWNER_SERIAL_TX"
+.LASF1891:
+	.string	"LSM303DLHC_HPF_AOI1_ENABLE ((uint8_t)0x01)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1532:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1163:
+	.string	"__MATH_PRECNAME"
+.LASF904:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1592:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1193:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1044:
+	.string	"__DECL_SIMD_exp10"
+.LASF2881:
+	.string	"gyroConfigMutable"
+.LASF1068:
+	.string	"__DECL_SIMD_log10"
+.LASF2496:
+	.string	"PGR_SIZE_MASK"
+.LASF1173:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1052:
+	.string	"__DECL_SIMD_expm1"
+.LASF1195:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1196:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1037:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1955:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_8_1Ga 205"
+.LASF2735:
+	.string	"gyroADCf"
+.LASF1741:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2120:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2235:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1793:
+	.string	"LSM303DLHC_OK ((uint32_t) 0)"
+.LASF2279:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"__cleanup_fct_attribute "
+.LASF2594:
+	.string	"__owner"
+.LASF1004:
+	.string	"__DECL_SIMD_sin"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1273:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2395:
+	.string	"TASK_QUEUE_SIZE TASK_COUNT"
+.LASF2544:
+	.string	"gyroADC"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF1738:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1907:
+	.string	"LSM303DLHC_OR_COMBINATION ((uint8_t)0x00)"
+.LASF2816:
+	.string	"filterGetNotchQ"
+.LASF2466:
+	.string	"stdev_s"
+.LASF2465:
+	.string	"stdev_t"
+.LASF1583:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF941:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1199:
+	.string	"__MATHCALL_NARROW"
+.LASF2447:
+	.string	"DEBUG_VELOCITY"
+.LASF927:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF2798:
+	.string	"gyroSampleQueue"
+.LASF1944:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_2_5Ga 670"
+.LASF1272:
+	.string	"USE_DASHBOARD "
+.LASF1716:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1629:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF2270:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1605:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"__MATHDECL_1"
+.LASF2681:
+	.string	"BEEPER_PREFERENCE"
+.LASF2124:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF1695:
+	.string	"SCHED_RR 2"
+.LASF1730:
+	.string	"__struct_tm_defined 1"
+.LASF2243:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2645:
+	.string	"OWNER_USB"
+.LASF2470:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2161:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF2548:
+	.string	"dataReady"
+.LASF1805:
+	.string	"LSM303DLHC_CTRL_REG3_A 0x22"
+.LASF398:
+	.string	"false 0"
+.LASF950:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF1488:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2283:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1905:
+	.string	"LSM303DLHC_IT2_ACT ((uint8_t)0x08)"
+.LASF2592:
+	.string	"__lock"
+.LASF1120:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2543:
+	.string	"gyroZero"
+.LASF1928:
+	.string	"LSM303DLHC_ODR_1_5_HZ ((uint8_t) 0x04)"
+.LASF1748:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f"
+.LASF1997:
+	.string	"IOCFG_AF_PP 0"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1453:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2306:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1870:
+	.string	"LSM303DLHC_FULLSCALE_8G ((uint8_t)0x20)"
+.LASF1490:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2318:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1074:
+	.string	"__DECL_SIMD_log2f"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2528:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2383:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF829:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2590:
+	.string	"__pthread_list_t"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF2434:
+	.string	"SPI_TypeDef"
+.LASF2356:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2077:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2214:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1786:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2252:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"PG_PID_PROFILE 14"
+.LASF2198:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2403:
+	.string	"GYRO_FFT_BIN_COUNT (GYRO_FFT_MAX_WINDOW_SIZE / 2)"
+.LASF2815:
+	.string	"filterBankAddBiquad"
+.LASF1857:
+	.string	"LSM303DLHC_ODR_200_HZ ((uint8_t)0x60)"
+.LASF1158:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1949:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_3Ga 980"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF2154:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF1927:
+	.string	"LSM303DLHC_ODR_0_75_HZ ((uint8_t) 0x00)"
+.LASF2773:
+	.string	"SENSOR_BARO"
+.LASF2566:
+	.string	"MPU_NONE"
+.LASF1622:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF958:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2376:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2253:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2862:
+	.string	"gyroInitFilters"
+.LASF2627:
+	.string	"OWNER_SONAR_ECHO"
+.LASF2847:
+	.string	"gyroUpdateHealth"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF2293:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1208:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2159:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF2863:
+	.string	"gyroInitSensorFilters"
+.LASF1524:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1568:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1042:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2849:
+	.string	"stddev"
+.LASF1773:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1451:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF2866:
+	.string	"gyroInitFilterNotch"
+.LASF1464:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1514:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1302:
+	.string	"ACC "
+.LASF2581:
+	.string	"mpu6050Resolution_e"
+.LASF1003:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1919:
+	.string	"LSM303DLHC_Y_DOUBLE_CLICK ((uint8_t)0x08)"
+.LASF1599:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2805:
+	.string	"beeper"
+.LASF1506:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1325:
+	.string	"STACK_CHECK"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2334:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1268:
+	.string	"TELEMETRY_IBUS "
+.LASF1247:
+	.string	"USE_PWM "
+.LASF2852:
+	.string	"isFirstArmingCalibration"
+.LASF854:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1327:
+	.string	"TELEMETRY_LTM"
+.LASF2671:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF2389:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1784:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF1980:
+	.string	"ICM20689_WHO_AM_I_CONST (0x98)"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF2050:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF2034:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2138:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1865:
+	.string	"LSM303DLHC_AXES_DISABLE ((uint8_t)0x00)"
+.LASF2367:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2313:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2440:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF788:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2486:
+	.string	"type"
+.LASF1687:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1482:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1902:
+	.string	"LSM303DLHC_IT2_INT1 ((uint8_t)0x40)"
+.LASF1440:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF2859:
+	.string	"isGyroCalibrationComplete"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2264:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2524:
+	.string	"CW0_DEG"
+.LASF1373:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2730:
+	.string	"consecutiveStuck"
+.LASF1851:
+	.string	"LSM303DLHC_LOWPOWER_MODE ((uint8_t)0x08)"
+.LASF1329:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2406:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2419:
+	.string	"__int16_t"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2789:
+	.string	"softLpfStage"
+.LASF2058:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF2445:
+	.string	"DEBUG_NOTCH"
+.LASF2421:
+	.string	"__uint16_t"
+.LASF1135:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1721:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1856:
+	.string	"LSM303DLHC_ODR_100_HZ ((uint8_t)0x50)"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2614:
+	.string	"OWNER_MOTOR"
+.LASF855:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2471:
+	.string	"movingSum"
+.LASF1863:
+	.string	"LSM303DLHC_Z_ENABLE ((uint8_t)0x04)"
+.LASF2761:
+	.string	"GYRO_FFT_WINDOW_32"
+.LASF2557:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF1399:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2380:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF2188:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1434:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1666:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF2641:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1298:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2726:
+	.string	"stuckCount"
+.LASF900:
+	.string	"__DECL_SIMD_log10f "
+.LASF2527:
+	.string	"CW270_DEG"
+.LASF1872:
+	.string	"LSM303DLHC_BlockUpdate_Continous ((uint8_t)0x00)"
+.LASF2745:
+	.string	"gyro_lpf"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2090:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1456:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF2799:
+	.string	"gyroSampleQueueHead"
+.LASF1221:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF2721:
+	.string	"GYRO_FUSION_AVERAGE"
+.LASF794:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2728:
+	.string	"unhealthyCount"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1523:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2796:
+	.string	"gyroSensor0"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF856:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF2710:
+	.string	"GYRO_L3GD20"
+.LASF1310:
+	.string	"USE_FLASHFS "
+.LASF1652:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1834:
+	.string	"LSM303DLHC_CRB_REG_M 0x01"
+.LASF2600:
+	.string	"__data"
+.LASF2336:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2131:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2185:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1424:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1854:
+	.string	"LSM303DLHC_ODR_25_HZ ((uint8_t)0x30)"
+.LASF1669:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF757:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF785:
+	.string	"__DECL_SIMD_powf128 "
+.LASF826:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2712:
+	.string	"GYRO_MPU6500"
+.LASF2766:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2295:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1094:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2776:
+	.string	"SENSOR_GPS"
+.LASF1131:
+	.string	"__f32x(x) x ##f32x"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2397:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF2201:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2157:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2468:
+	.string	"filledCount"
+.LASF1448:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1189:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1197:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1569:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1974:
+	.string	"MPU6500_BIT_RESET (0x80)"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1278:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1777:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF2019:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2541:
+	.string	"scale"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1406:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1940:
+	.string	"LSM303DLHC_FS_5_6_GA ((uint8_t) 0xC0)"
+.LASF2035:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF786:
+	.string	"__DECL_SIMD_powf32x "
+.LASF917:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1715:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2164:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1141:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1579:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1582:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1480:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1099:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1374:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2398:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF2225:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2603:
+	.string	"pthread_mutex_t"
+.LASF1301:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF1286:
+	.string	"USE_NAV "
+.LASF1961:
+	.string	"MPU3050_SMPLRT_DIV 0x15"
+.LASF1525:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2242:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1242:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF2054:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1508:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1300:
+	.string	"USE_FAKE_LED "
+.LASF2742:
+	.string	"gyro_align"
+.LASF1655:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1969:
+	.string	"MPU9250_WHO_AM_I_CONST (0x71)"
+.LASF2432:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1503:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF2809:
+	.string	"devStandardDeviation"
+.LASF2792:
+	.string	"previousADCRaw"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2333:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1818:
+	.string	"LSM303DLHC_FIFO_SRC_REG_A 0x2F"
+.LASF1699:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF2189:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1774:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF1397:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1609:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2139:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"__MATHDECL"
+.LASF1304:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1559:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2200:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF951:
+	.string	"__DECL_SIMD_erfl "
+.LASF1659:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1449:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2107:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1351:
+	.string	"VTX_COMMON"
+.LASF1996:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2053:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF1838:
+	.string	"LSM303DLHC_OUT_Z_H_M 0x05"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF812:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1366:
+	.string	"_PTRDIFF_T "
+.LASF2499:
+	.string	"pgRegistry_s"
+.LASF2504:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF1001:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF1404:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF1470:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1079:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF908:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1613:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2455:
+	.string	"DEBUG_ALTITUDE"
+.LASF2474:
+	.string	"FILTER_PT1"
+.LASF2523:
+	.string	"ALIGN_DEFAULT"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1420:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF877:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1585:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF2845:
+	.string	"gyroSensor"
+.LASF1264:
+	.string	"USE_SERVOS "
+.LASF1960:
+	.string	"LSM303DLHC_TEMPSENSOR_DISABLE ((uint8_t) 0x00)"
+.LASF2801:
+	.string	"gyroSampleQueueDropped"
+.LASF1768:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF2885:
+	.string	"isArmingDisabled"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2088:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1911:
+	.string	"LSM303DLHC_Z_HIGH ((uint8_t)0x20)"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1962:
+	.string	"MPU3050_DLPF_FS_SYNC 0x16"
+.LASF1520:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF2653:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1499:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1258:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2578:
+	.string	"mpuSensor_e"
+.LASF2703:
+	.string	"TASK_SELF"
+.LASF1978:
+	.string	"MPU6500_BIT_RAW_RDY_EN (1 << 0)"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1653:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2596:
+	.string	"__kind"
+.LASF2823:
+	.string	"gyroSetSampleRate"
+.LASF802:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1214:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1680:
+	.string	"_SCHED_H 1"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2100:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF2036:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2718:
+	.string	"GYRO_BMI160"
+.LASF1170:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2399:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF2670:
+	.string	"BEEPER_RX_SET"
+.LASF1207:
+	.string	"FP_NORMAL 4"
+.LASF2122:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2807:
+	.string	"devPush"
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2790:
+	.string	"softLpfDenoiseEnabled"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1255:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2568:
+	.string	"MPU_60x0"
+.LASF2207:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF2804:
+	.string	"gyroConfig_Registry"
+.LASF2636:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1628:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2339:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2033:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF1931:
+	.string	"LSM303DLHC_ODR_15_HZ ((uint8_t) 0x10)"
+.LASF1457:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2693:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2679:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF850:
+	.string	"__DECL_SIMD_coshf "
+.LASF1918:
+	.string	"LSM303DLHC_Z_SINGLE_CLICK ((uint8_t)0x10)"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF931:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2160:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2787:
+	.string	"notchFilterDyn"
+.LASF382:
+	.string	"unix 1"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2224:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1981:
+	.string	"ICM20689_BIT_RESET (0x80)"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF2551:
+	.string	"mpuDetectionResult"
+.LASF2166:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF1764:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF1610:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1989:
+	.string	"mpu9250_CONFIG 0x1A"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2127:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF2829:
+	.string	"gyroSensorCount"
+.LASF2144:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"__timer_t_defined 1"
+.LASF2449:
+	.string	"DEBUG_ANGLERATE"
+.LASF2069:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF1795:
+	.string	"LSM303DLHC_FLAG_TIMEOUT ((uint32_t)0x1000)"
+.LASF2569:
+	.string	"MPU_60x0_SPI"
+.LASF1939:
+	.string	"LSM303DLHC_FS_4_7_GA ((uint8_t) 0xA0)"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2302:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2494:
+	.string	"PGR_PGN_MASK"
+.LASF2238:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2135:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1157:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1160:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1428:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1759:
+	.string	"____sigset_t_defined "
+.LASF2832:
+	.string	"gyroSampleCount"
+.LASF1288:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2394:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF2359:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2288:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF738:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2385:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF901:
+	.string	"__DECL_SIMD_log10l "
+.LASF2435:
+	.string	"debug"
+.LASF1586:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1633:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1235:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2371:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1540:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1679:
+	.string	"_PTHREAD_H 1"
+.LASF1566:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2460:
+	.string	"test"
+.LASF778:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2025:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2303:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1102:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1607:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2330:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2704:
+	.string	"cfTaskId_e"
+.LASF2176:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2311:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF729:
+	.string	"__DECL_SIMD_cos "
+.LASF2177:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1075:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1988:
+	.string	"MPU6000_WHO_AM_I_CONST (0x68)"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF994:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1591:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1844:
+	.string	"LSM303DLHC_IRB_REG_M 0x0B"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1672:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1831:
+	.string	"LSM303DLHC_TIME_LATENCY_A 0x3C"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2646:
+	.string	"OWNER_USB_DETECT"
+.LASF2401:
+	.string	"GYRO_FFT_MAX_WINDOW_SIZE 32"
+.LASF907:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2320:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2396:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF810:
+	.string	"__DECL_SIMD_asinf "
+.LASF2601:
+	.string	"__size"
+.LASF1645:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1993:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF2500:
+	.string	"size"
+.LASF1246:
+	.string	"USE_PPM "
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF1906:
+	.string	"LSM303DLHC_IT2_HLACTIVE ((uint8_t)0x02)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2767:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2068:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF2860:
+	.string	"isGyroSensorCalibrationComplete"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1550:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1095:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2562:
+	.string	"writeFn"
+.LASF2365:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2682:
+	.string	"beeperMode_e"
+.LASF1190:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1673:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1296:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1880:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE ((uint8_t)0x80)"
+.LASF1002:
+	.string	"__DECL_SIMD_cosf"
+.LASF1174:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2685:
+	.string	"TASK_PID"
+.LASF2229:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF777:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1047:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"__DECL_SIMD_cosf "
+.LASF1917:
+	.string	"LSM303DLHC_Z_DOUBLE_CLICK ((uint8_t)0x20)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1804:
+	.string	"LSM303DLHC_CTRL_REG2_A 0x21"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1093:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2363:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1479:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2112:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1478:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2452:
+	.string	"DEBUG_STACK"
+.LASF2650:
+	.string	"OWNER_INVERTER"
+.LASF1224:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2431:
+	.string	"size_t"
+.LASF1725:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2631:
+	.string	"OWNER_SPI_MOSI"
+.LASF2137:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF2342:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2593:
+	.string	"__count"
+.LASF2755:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF2017:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF2428:
+	.string	"uint8_t"
+.LASF1654:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1845:
+	.string	"LSM303DLHC_IRC_REG_M 0x0C"
+.LASF1149:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1783:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF2630:
+	.string	"OWNER_SPI_MISO"
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2491:
+	.string	"stage"
+.LASF2018:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2103:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF2746:
+	.string	"gyro_soft_lpf_type"
+.LASF1164:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2181:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1749:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1455:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2063:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF2768:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1837:
+	.string	"LSM303DLHC_OUT_X_L_M 0x04"
+.LASF1259:
+	.string	"TELEMETRY "
+.LASF2582:
+	.string	"mpuDetectionResult_s"
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF795:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1630:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF2879:
+	.string	"gyroMpuConfiguration"
+.LASF1083:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1765:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF1101:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2096:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinh "
+.LASF2153:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF2213:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1426:
+	.string	"VERY_FAST_MATH "
+.LASF1864:
+	.string	"LSM303DLHC_AXES_ENABLE ((uint8_t)0x07)"
+.LASF1328:
+	.string	"USE_ADC"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2686:
+	.string	"TASK_ACCEL"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2391:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1311:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1390:
+	.string	"_GCC_WCHAR_T "
+.LASF2723:
+	.string	"gyroHealth_s"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1631:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF997:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1343:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1938:
+	.string	"LSM303DLHC_FS_4_0_GA ((uint8_t) 0x80)"
+.LASF1577:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2267:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1358:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF796:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2884:
+	.string	"busDevice_u"
+.LASF1779:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2194:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1204:
+	.string	"FP_INFINITE 1"
+.LASF1194:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF849:
+	.string	"__DECL_SIMD_cosh "
+.LASF2475:
+	.string	"FILTER_BIQUAD"
+.LASF739:
+	.string	"__DECL_SIMD_sin "
+.LASF2673:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1750:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1722:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2147:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF2219:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"TELEMETRY_CRSF"
+.LASF1306:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF1282:
+	.string	"VTX_TRAMP "
+.LASF1007:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2756:
+	.string	"dyn_notch_window"
+.LASF897:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2709:
+	.string	"GYRO_MPU3050"
+.LASF2204:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2254:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1704:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF1023:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2169:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF2008:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF1105:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2613:
+	.string	"OWNER_PPMINPUT"
+.LASF2505:
+	.string	"ioTag_t"
+.LASF1999:
+	.string	"IOCFG_IPD 0"
+.LASF1376:
+	.string	"__need_ptrdiff_t"
+.LASF782:
+	.string	"__DECL_SIMD_powf16 "
+.LASF813:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1139:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1237:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1697:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF1908:
+	.string	"LSM303DLHC_AND_COMBINATION ((uint8_t)0x80)"
+.LASF851:
+	.string	"__DECL_SIMD_coshl "
+.LASF1461:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2355:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2828:
+	.string	"axis"
+.LASF1178:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1528:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1363:
+	.string	"_STDDEF_H "
+.LASF2298:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1050:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1896:
+	.string	"LSM303DLHC_IT1_AOI2 ((uint8_t)0x20)"
+.LASF1006:
+	.string	"__DECL_SIMD_sinf"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1549:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1646:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2366:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF392:
+	.string	"__REVISION__ \"7bb5b45\""
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1125:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1244:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1556:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2808:
+	.string	"devClear"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2125:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF767:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2162:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2537:
+	.string	"temperatureFn"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1667:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1554:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1167:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2065:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1518:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2126:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1564:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1485:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF803:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2830:
+	.string	"gyroGetTemperature"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2813:
+	.string	"lrintf"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1887:
+	.string	"LSM303DLHC_HIGHPASSFILTER_ENABLE ((uint8_t)0x08)"
+.LASF1587:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1862:
+	.string	"LSM303DLHC_Y_ENABLE ((uint8_t)0x02)"
+.LASF2241:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2542:
+	.string	"gyroADCRaw"
+.LASF2818:
+	.string	"filterBankAddPt1"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1913:
+	.string	"LSM303DLHC_Y_HIGH ((uint8_t)0x08)"
+.LASF1685:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2518:
+	.string	"instance"
+.LASF2587:
+	.string	"__pthread_internal_list"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2023:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2210:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2228:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1868:
+	.string	"LSM303DLHC_FULLSCALE_2G ((uint8_t)0x00)"
+.LASF2588:
+	.string	"__prev"
+.LASF2133:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF2377:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2456:
+	.string	"DEBUG_FFT"
+.LASF1567:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1926:
+	.string	"LSM303DLHC_INT1INTERRUPT_HIGH_EDGE ((uint8_t)0x00)"
+.LASF1340:
+	.string	"LED_STRIP"
+.LASF2272:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1113:
+	.string	"__f128(x) x ##f128"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1169:
+	.string	"_Mdouble_ long double"
+.LASF1817:
+	.string	"LSM303DLHC_FIFO_CTRL_REG_A 0x2E"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1839:
+	.string	"LSM303DLHC_OUT_Z_L_M 0x06"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF2317:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2819:
+	.string	"filterBankAddBiquadLPF"
+.LASF1443:
+	.string	"NOOP do {} while (0)"
+.LASF2442:
+	.string	"DEBUG_MIXER"
+.LASF2042:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1719:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF2676:
+	.string	"BEEPER_ARMED"
+.LASF1769:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF1337:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2183:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1338:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1991:
+	.string	"SPIDEV_COUNT 4"
+.LASF1963:
+	.string	"MPU3050_INT_CFG 0x17"
+.LASF1990:
+	.string	"MPU9250_BIT_RESET (0x80)"
+.LASF1791:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2734:
+	.string	"targetLooptime"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF811:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1260:
+	.string	"TELEMETRY_FRSKY "
+.LASF1966:
+	.string	"MPU3050_USER_CTRL 0x3D"
+.LASF2012:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"__DECL_SIMD_tanf "
+.LASF1920:
+	.string	"LSM303DLHC_Y_SINGLE_CLICK ((uint8_t)0x04)"
+.LASF2259:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1593:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1565:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2772:
+	.string	"SENSOR_ACC"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF1040:
+	.string	"__DECL_SIMD_exp2"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF2626:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1693:
+	.string	"SCHED_OTHER 0"
+.LASF2501:
+	.string	"address"
+.LASF2511:
+	.string	"I2CDEV_1"
+.LASF1438:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1176:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1816:
+	.string	"LSM303DLHC_OUT_Z_H_A 0x2D"
+.LASF1848:
+	.string	"ACC_I2C_ADDRESS 0x32"
+.LASF2257:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2143:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"math_errhandling 0"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1336:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF731:
+	.string	"__DECL_SIMD_cosl "
+.LASF1604:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1830:
+	.string	"LSM303DLHC_TIME_LIMIT_A 0x3B"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF2172:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF1152:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1763:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF1299:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF721:
+	.string	"NULL"
+.LASF1692:
+	.string	"_BITS_SCHED_H 1"
+.LASF1168:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1757:
+	.string	"__have_pthread_attr_t 1"
+.LASF2409:
+	.string	"GYRO_SAMPLE_QUEUE_SIZE 32"
+.LASF2628:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1624:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1850:
+	.string	"LSM303DLHC_NORMAL_MODE ((uint8_t)0x00)"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1541:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2098:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF468:
+	.string	"__PMT"
+.LASF2022:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2725:
+	.string	"readErrorCount"
+.LASF1391:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1401:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF2258:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1747:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1794:
+	.string	"LSM303DLHC_FAIL ((uint32_t) 0)"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1802:
+	.string	"LSM303DLHC_I2C_INT2_PIN PE5"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2778:
+	.string	"gyroCalibration_s"
+.LASF2780:
+	.string	"gyroCalibration_t"
+.LASF2570:
+	.string	"MPU_65xx_I2C"
+.LASF2837:
+	.string	"sampleTimeUs"
+.LASF1289:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1542:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2484:
+	.string	"filterBankStageType_e"
+.LASF1239:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1904:
+	.string	"LSM303DLHC_IT2_BOOT ((uint8_t)0x10)"
+.LASF1220:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2576:
+	.string	"ICM_20689_SPI"
+.LASF1345:
+	.string	"USE_RESOURCE_MGMT"
+.LASF910:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2104:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"_Mdouble_ _Float64x"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF959:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2171:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2412:
+	.string	"GYRO_SYNC_DENOM_DEFAULT 4"
+.LASF2186:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"USE_SERIALRX_IBUS "
+.LASF759:
+	.string	"__DECL_SIMD_log "
+.LASF2497:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1206:
+	.string	"FP_SUBNORMAL 3"
+.LASF2056:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF2871:
+	.string	"gyroFrequencyNyquist"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2713:
+	.string	"GYRO_MPU9250"
+.LASF1500:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1879:
+	.string	"LSM303DLHC_HPM_REF_SIGNAL ((uint8_t)0x40)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1072:
+	.string	"__DECL_SIMD_log2"
+.LASF1256:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1342:
+	.string	"TELEMETRY_HOTT"
+.LASF1421:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1895:
+	.string	"LSM303DLHC_IT1_AOI1 ((uint8_t)0x40)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2618:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1808:
+	.string	"LSM303DLHC_CTRL_REG6_A 0x25"
+.LASF2315:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1439:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1024:
+	.string	"__DECL_SIMD_acos"
+.LASF1379:
+	.string	"_WCHAR_T "
+.LASF2439:
+	.string	"DEBUG_BATTERY"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1151:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1473:
+	.string	"UNIT_TESTED "
+.LASF763:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2251:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1744:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1898:
+	.string	"LSM303DLHC_IT1_DRY2 ((uint8_t)0x08)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF2240:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1973:
+	.string	"ICM20608G_WHO_AM_I_CONST (0xAF)"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF808:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF1612:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF745:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1014:
+	.string	"__DECL_SIMD_logf"
+.LASF1901:
+	.string	"LSM303DLHC_IT2_CLICK ((uint8_t)0x80)"
+.LASF2560:
+	.string	"mpuResetFnPtr"
+.LASF1742:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1027:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2873:
+	.string	"lpfHz"
+.LASF807:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2883:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF2839:
+	.string	"gyroSampleIsDue"
+.LASF1127:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1494:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1967:
+	.string	"MPU3050_PWR_MGM 0x3E"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1601:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1483:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1236:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2661:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1198:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2824:
+	.string	"memset"
+.LASF1177:
+	.string	"_Mdouble_ _Float128"
+.LASF1575:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2248:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2051:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF978:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1557:
+	.string	"PG_PID_CONFIG 504"
+.LASF2323:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2064:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF1746:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1709:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF2782:
+	.string	"firstArmingCalibrationWasStarted"
+.LASF1875:
+	.string	"LSM303DLHC_BLE_MSB ((uint8_t)0x40)"
+.LASF2820:
+	.string	"filterBankInit"
+.LASF2540:
+	.string	"exti"
+.LASF1070:
+	.string	"__DECL_SIMD_log10f"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1832:
+	.string	"LSM303DLHC_TIME_WINDOW_A 0x3D"
+.LASF2091:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"BLACKBOX "
+.LASF1252:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1888:
+	.string	"LSM303DLHC_HPF_CLICK_DISABLE ((uint8_t)0x00)"
+.LASF2260:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2175:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF2146:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2729:
+	.string	"consecutiveReadErrors"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF1736:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1417:
+	.string	"TRACE_BEGIN(event,arg) {}"
+.LASF2589:
+	.string	"__next"
+.LASF921:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1731:
+	.string	"__clockid_t_defined 1"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF848:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2683:
+	.string	"TASK_SYSTEM"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2687:
+	.string	"TASK_ATTITUDE"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1743:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2762:
+	.string	"GYRO_FFT_WINDOW_64"
+.LASF1419:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2680:
+	.string	"BEEPER_ALL"
+.LASF1142:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2660:
+	.string	"BEEPER_SILENCE"
+.LASF815:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1910:
+	.string	"LSM303DLHC_POS_RECOGNITION ((uint8_t)0xC0)"
+.LASF783:
+	.string	"__DECL_SIMD_powf32 "
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF914:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1350:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF799:
+	.string	"__DECL_SIMD_atan "
+.LASF1665:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF845:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1638:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1313:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1185:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2173:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF2558:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1048:
+	.string	"__DECL_SIMD_cosh"
+.LASF2870:
+	.string	"calculateNyquistAdjustedNotchHz"
+.LASF1916:
+	.string	"LSM303DLHC_X_LOW ((uint8_t)0x01)"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1501:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1635:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF2668:
+	.string	"BEEPER_BAT_LOW"
+.LASF1445:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2598:
+	.string	"__elision"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF816:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2520:
+	.string	"deviceI2C_s"
+.LASF2634:
+	.string	"OWNER_SDCARD"
+.LASF2737:
+	.string	"gyro"
+.LASF1231:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF919:
+	.string	"__DECL_SIMD_log1p "
+.LASF2473:
+	.string	"firFilterDenoise_t"
+.LASF1639:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1596:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF991:
+	.string	"__DECL_SIMD_tanl "
+.LASF846:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1936:
+	.string	"LSM303DLHC_FS_1_9_GA ((uint8_t) 0x40)"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2483:
+	.string	"FILTER_BANK_STAGE_BIQUAD_DF1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1678:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2083:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2426:
+	.string	"int16_t"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1538:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2255:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2414:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2417:
+	.string	"signed char"
+.LASF1128:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1477:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF747:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2437:
+	.string	"DEBUG_NONE"
+.LASF2289:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2375:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF702:
+	.string	"__size_t__ "
+.LASF1262:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1201:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF2875:
+	.string	"gyroInitSensor"
+.LASF1263:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1294:
+	.string	"U_ID_1 1"
+.LASF1098:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1323:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1387:
+	.string	"_WCHAR_T_H "
+.LASF2559:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1509:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1078:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2536:
+	.string	"readFn"
+.LASF2684:
+	.string	"TASK_GYROPID"
+.LASF1681:
+	.string	"__time_t_defined 1"
+.LASF2825:
+	.string	"gyroSensorHealth"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF947:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1423:
+	.string	"sq(x) ((x)*(x))"
+.LASF743:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF915:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1970:
+	.string	"MPU9255_WHO_AM_I_CONST (0x73)"
+.LASF1776:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1045:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF2854:
+	.string	"gyroCalibration"
+.LASF1475:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1849:
+	.string	"MAG_I2C_ADDRESS 0x3C"
+.LASF2266:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2350:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2382:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1756:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1029:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF1130:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2664:
+	.string	"BEEPER_DISARMING"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1812:
+	.string	"LSM303DLHC_OUT_X_H_A 0x29"
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2831:
+	.string	"gyroSamplesDropped"
+.LASF1266:
+	.string	"TELEMETRY_LTM "
+.LASF2360:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2748:
+	.string	"gyro_isr_update"
+.LASF1287:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1232:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2114:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1826:
+	.string	"LSM303DLHC_INT2_DURATION_A 0x37"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1735:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1787:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2700:
+	.string	"TASK_RCSPLIT"
+.LASF911:
+	.string	"__DECL_SIMD_log2l "
+.LASF1819:
+	.string	"LSM303DLHC_INT1_CFG_A 0x30"
+.LASF1614:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1881:
+	.string	"LSM303DLHC_HPM_AUTORESET_INT ((uint8_t)0xC0)"
+.LASF1517:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2459:
+	.string	"DEBUG_COUNT"
+.LASF1012:
+	.string	"__DECL_SIMD_log"
+.LASF2774:
+	.string	"SENSOR_MAG"
+.LASF1284:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2184:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF1119:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2498:
+	.string	"pgResetFunc"
+.LASF2781:
+	.string	"SystemCoreClock"
+.LASF1028:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2485:
+	.string	"filterBankStage_s"
+.LASF2209:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1407:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1359:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF1521:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1171:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1734:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF1809:
+	.string	"LSM303DLHC_REFERENCE_A 0x26"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2472:
+	.string	"state"
+.LASF1958:
+	.string	"LSM303DLHC_SLEEP ((uint8_t) 0x02)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2304:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1082:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1292:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF2061:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"_ANSI_STDDEF_H "
+.LASF1576:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2648:
+	.string	"OWNER_OSD"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1772:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF2410:
+	.string	"GYRO_SAMPLE_QUEUE_MASK (GYRO_SAMPLE_QUEUE_SIZE - 1)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1767:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF2275:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2358:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2495:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF765:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2324:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1526:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1929:
+	.string	"LSM303DLHC_ODR_3_0_HZ ((uint8_t) 0x08)"
+.LASF2826:
+	.string	"gyroRateDps"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1644:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2572:
+	.string	"MPU_9250_SPI"
+.LASF2752:
+	.string	"gyro_soft_notch_hz_1"
+.LASF2754:
+	.string	"gyro_soft_notch_hz_2"
+.LASF1223:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2026:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2170:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF2390:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1140:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF2458:
+	.string	"DEBUG_FFT_FREQ"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2869:
+	.string	"notchQ"
+.LASF2006:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF756:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1578:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2217:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1281:
+	.string	"VTX_SMARTAUDIO "
+.LASF2535:
+	.string	"initFn"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1976:
+	.string	"MPU6500_BIT_BYPASS_EN (1 << 1)"
+.LASF1205:
+	.string	"FP_ZERO 2"
+.LASF2554:
+	.string	"sensorGyroReadFuncPtr"
+.LASF1892:
+	.string	"LSM303DLHC_HPF_AOI2_DISABLE ((uint8_t)0x00)"
+.LASF2490:
+	.string	"stageCount"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2227:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2301:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1827:
+	.string	"LSM303DLHC_CLICK_CFG_A 0x38"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF772:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2130:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2032:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1903:
+	.string	"LSM303DLHC_IT2_INT2 ((uint8_t)0x20)"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1657:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2867:
+	.string	"notchHz"
+.LASF2230:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1032:
+	.string	"__DECL_SIMD_asin"
+.LASF2868:
+	.string	"notchCutoffHz"
+.LASF1546:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF916:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1285:
+	.string	"GPS "
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1954:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_5_6Ga 295"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2546:
+	.string	"gyroRateKHz"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1073:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2699:
+	.string	"TASK_BLACKBOX"
+.LASF2013:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1362:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1183:
+	.string	"__MATHDECL_1_IMPL"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1166:
+	.string	"_Mdouble_ float"
+.LASF2424:
+	.string	"long int"
+.LASF2487:
+	.string	"filterBankStage_t"
+.LASF1036:
+	.string	"__DECL_SIMD_hypot"
+.LASF1513:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2132:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF2605:
+	.string	"GYRO_RATE_1_kHz"
+.LASF2080:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2512:
+	.string	"I2CDEV_2"
+.LASF2513:
+	.string	"I2CDEV_3"
+.LASF2514:
+	.string	"I2CDEV_4"
+.LASF1558:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1853:
+	.string	"LSM303DLHC_ODR_10_HZ ((uint8_t)0x20)"
+.LASF748:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1677:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2402:
+	.string	"GYRO_FFT_MAX_PEAKS 1"
+.LASF1435:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF948:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1790:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2624:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2347:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1694:
+	.string	"SCHED_FIFO 1"
+.LASF1914:
+	.string	"LSM303DLHC_Y_LOW ((uint8_t)0x04)"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1951:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_2_5Ga 600"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1869:
+	.string	"LSM303DLHC_FULLSCALE_4G ((uint8_t)0x10)"
+.LASF1708:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1835:
+	.string	"LSM303DLHC_MR_REG_M 0x02"
+.LASF2117:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1740:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2606:
+	.string	"GYRO_RATE_3200_Hz"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF1824:
+	.string	"LSM303DLHC_INT2_SOURCE_A 0x35"
+.LASF1069:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1267:
+	.string	"TELEMETRY_CRSF "
+.LASF2451:
+	.string	"DEBUG_SCHEDULER"
+.LASF1370:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF1571:
+	.string	"PG_I2C_CONFIG 518"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1396:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2482:
+	.string	"FILTER_BANK_STAGE_BIQUAD"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2074:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF2777:
+	.string	"SENSOR_GPSMAG"
+.LASF2087:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1632:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2244:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2115:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"__PTRDIFF_T "
+.LASF1682:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2178:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF2326:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1894:
+	.string	"LSM303DLHC_IT1_CLICK ((uint8_t)0x80)"
+.LASF1707:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1153:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1723:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2212:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2835:
+	.string	"tail"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1504:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1762:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF2246:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2689:
+	.string	"TASK_SERIAL"
+.LASF2044:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1446:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1615:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1454:
+	.string	"EXPAND_I(x) x"
+.LASF2694:
+	.string	"TASK_GPS"
+.LASF2206:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1788:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2073:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF1752:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1344:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2843:
+	.string	"gyroUpdate"
+.LASF1159:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2732:
+	.string	"gyroHealth_t"
+.LASF2844:
+	.string	"gyroUpdateSensor"
+.LASF2430:
+	.string	"uint32_t"
+.LASF1676:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincos"
+.LASF1814:
+	.string	"LSM303DLHC_OUT_Y_H_A 0x2B"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2321:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"U_ID_0 0"
+.LASF1729:
+	.string	"__clock_t_defined 1"
+.LASF1081:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1077:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1091:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1133:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1226:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2877:
+	.string	"gyroDetect"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2285:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"__DECL_SIMD_log2 "
+.LASF1395:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1043:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2521:
+	.string	"device"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2220:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1766:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF2081:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1076:
+	.string	"__DECL_SIMD_log1p"
+.LASF1932:
+	.string	"LSM303DLHC_ODR_30_HZ ((uint8_t) 0x14)"
+.LASF1134:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1188:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2714:
+	.string	"GYRO_ICM20601"
+.LASF2715:
+	.string	"GYRO_ICM20602"
+.LASF1511:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF938:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2305:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2555:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF1431:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF2865:
+	.string	"peak"
+.LASF967:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2291:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1714:
+	.string	"_TIME_H 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF779:
+	.string	"__DECL_SIMD_pow "
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF1341:
+	.string	"TELEMETRY_FRSKY"
+.LASF2416:
+	.string	"long unsigned int"
+.LASF1720:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1977:
+	.string	"MPU6500_BIT_INT_ANYRD_2CLEAR (1 << 4)"
+.LASF1222:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1474:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2393:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1536:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2436:
+	.string	"debugMode"
+.LASF1380:
+	.string	"_T_WCHAR_ "
+.LASF2508:
+	.string	"extiCallbackRec_s"
+.LASF1581:
+	.string	"IO_TAG_NONE 0"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1496:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1950:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_9Ga 760"
+.LASF1649:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1290:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF2688:
+	.string	"TASK_RX"
+.LASF2797:
+	.string	"gyroToUse"
+.LASF2758:
+	.string	"gyroConfig_t"
+.LASF2205:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1034:
+	.string	"__DECL_SIMD_asinf"
+.LASF1219:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1392:
+	.string	"__DEFINED_wchar_t "
+.LASF2625:
+	.string	"OWNER_TIMER"
+.LASF2038:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2724:
+	.string	"sampleCount"
+.LASF2203:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1537:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1240:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1841:
+	.string	"LSM303DLHC_OUT_Y_L_M 0x08"
+.LASF2701:
+	.string	"TASK_COUNT"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1994:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1825:
+	.string	"LSM303DLHC_INT2_THS_A 0x36"
+.LASF2282:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"USE_FAKE_MAG "
+.LASF2141:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2314:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1860:
+	.string	"LSM303DLHC_ODR_1344_HZ ((uint8_t)0x90)"
+.LASF1022:
+	.string	"__DECL_SIMD_powf"
+.LASF1589:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF2814:
+	.string	"alignSensors"
+.LASF2121:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1283:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF2425:
+	.string	"char"
+.LASF1191:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2538:
+	.string	"intStatusFn"
+.LASF905:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1964:
+	.string	"MPU3050_TEMP_OUT 0x1B"
+.LASF819:
+	.string	"__DECL_SIMD_hypot "
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1728:
+	.string	"TIMER_ABSTIME 1"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF2841:
+	.string	"currentDeltaTimeUs"
+.LASF2364:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1122:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2348:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"DEFIO_NO_PORTS "
+.LASF1873:
+	.string	"LSM303DLHC_BlockUpdate_Single ((uint8_t)0x80)"
+.LASF2236:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF735:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1883:
+	.string	"LSM303DLHC_HPFCF_16 ((uint8_t)0x10)"
+.LASF902:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2597:
+	.string	"__spins"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2066:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"USE_SERIALRX_IBUS"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF2506:
+	.string	"IO_t"
+.LASF2855:
+	.string	"gyroDataReadySensor"
+.LASF2231:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF867:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2874:
+	.string	"gyroInit"
+.LASF859:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2002:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2595:
+	.string	"__nusers"
+.LASF734:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF906:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF798:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1603:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1580:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1886:
+	.string	"LSM303DLHC_HIGHPASSFILTER_DISABLE ((uint8_t)0x00)"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2637:
+	.string	"OWNER_FLASH_CS"
+.LASF1758:
+	.string	"_BITS_SETJMP_H 1"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1339:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1275:
+	.string	"USE_RX_MSP "
+.LASF2215:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1347:
+	.string	"TELEMETRY_IBUS"
+.LASF397:
+	.string	"true 1"
+.LASF1637:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF736:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2123:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF1800:
+	.string	"LSM303DLHC_DRDY_PIN PE2"
+.LASF790:
+	.string	"__DECL_SIMD_acosf "
+.LASF1674:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2757:
+	.string	"dyn_notch_peaks"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1843:
+	.string	"LSM303DLHC_IRA_REG_M 0x0A"
+.LASF2534:
+	.string	"gyroDev_s"
+.LASF2610:
+	.string	"gyroDev_t"
+.LASF1878:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE_RES ((uint8_t)0x00)"
+.LASF776:
+	.string	"__DECL_SIMD_expf32x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2444:
+	.string	"DEBUG_PIDLOOP"
+.LASF2502:
+	.string	"copy"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1038:
+	.string	"__DECL_SIMD_hypotf"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1560:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2573:
+	.string	"ICM_20601_SPI"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1611:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF2407:
+	.string	"GYRO_HEALTH_MAX_READ_ERRORS 10"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1117:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF719:
+	.string	"__size_t "
+.LASF701:
+	.string	"__need_NULL "
+.LASF1858:
+	.string	"LSM303DLHC_ODR_400_HZ ((uint8_t)0x70)"
+.LASF878:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1049:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1238:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1332:
+	.string	"SERIAL_RX"
+.LASF1823:
+	.string	"LSM303DLHC_INT2_CFG_A 0x34"
+.LASF1414:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF871:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1529:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1739:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1771:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF2530:
+	.string	"CW180_DEG_FLIP"
+.LASF1925:
+	.string	"LSM303DLHC_INT1INTERRUPT_LOW_EDGE ((uint8_t)0x20)"
+.LASF1126:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2343:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1452:
+	.string	"STR_HELPER(x) #x"
+.LASF1755:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2167:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"CLOCK_TAI 11"
+.LASF2128:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1890:
+	.string	"LSM303DLHC_HPF_AOI1_DISABLE ((uint8_t)0x00)"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1534:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1353:
+	.string	"VTX_SMARTAUDIO"
+.LASF1251:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2629:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_RCSPLIT "
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2621:
+	.string	"OWNER_ADC_RSSI"
+.LASF1471:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1071:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2278:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2695:
+	.string	"TASK_COMPASS"
+.LASF1416:
+	.string	"TRACE_EVENT_END_FLAG 0x80"
+.LASF1706:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1039:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF744:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f "
+.LASF773:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2549:
+	.string	"lock"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2216:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1103:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1394:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2004:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2690:
+	.string	"TASK_DISPATCH"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1368:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF2089:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2510:
+	.string	"I2CINVALID"
+.LASF996:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1031:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF939:
+	.string	"__DECL_SIMD_acosh "
+.LASF2677:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF1718:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF995:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2657:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1737:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1946:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4_7Ga 400"
+.LASF2294:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"USE_FAKE_ACC "
+.LASF1572:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF2822:
+	.string	"fakeGyroDetect"
+.LASF2292:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1200:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2322:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2085:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2662:
+	.string	"BEEPER_RX_LOST"
+.LASF1233:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2195:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF1203:
+	.string	"FP_NAN 0"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1855:
+	.string	"LSM303DLHC_ODR_50_HZ ((uint8_t)0x40)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2174:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF2448:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1797:
+	.string	"LSM303DLHC_I2C I2C1"
+.LASF852:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF949:
+	.string	"__DECL_SIMD_erf "
+.LASF2567:
+	.string	"MPU_3050"
+.LASF1041:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1753:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2525:
+	.string	"CW90_DEG"
+.LASF2281:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"__itimerspec_defined 1"
+.LASF2533:
+	.string	"sensorGyroInitFuncPtr"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1648:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2353:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2532:
+	.string	"sensor_align_e"
+.LASF2299:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2037:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2711:
+	.string	"GYRO_MPU6000"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1086:
+	.string	"__DECL_SIMD_acoshf"
+.LASF2361:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1922:
+	.string	"LSM303DLHC_X_SINGLE_CLICK ((uint8_t)0x01)"
+.LASF2119:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1877:
+	.string	"LSM303DLHC_BOOT_REBOOTMEMORY ((uint8_t)0x80)"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2392:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1876:
+	.string	"LSM303DLHC_BOOT_NORMALMODE ((uint8_t)0x00)"
+.LASF2800:
+	.string	"gyroSampleQueueTail"
+.LASF2632:
+	.string	"OWNER_I2C_SCL"
+.LASF1013:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2443:
+	.string	"DEBUG_AIRMODE"
+.LASF1688:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1011:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1861:
+	.string	"LSM303DLHC_X_ENABLE ((uint8_t)0x01)"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1717:
+	.string	"CLOCK_REALTIME 0"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1412:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2193:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2110:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1547:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1459:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1487:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1467:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2438:
+	.string	"DEBUG_CYCLETIME"
+.LASF2453:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1180:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1241:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1138:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1230:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2519:
+	.string	"csnPin"
+.LASF1021:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF2226:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1245:
+	.string	"USE_CLI_BATCH "
+.LASF2269:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2433:
+	.string	"double"
+.LASF1803:
+	.string	"LSM303DLHC_CTRL_REG1_A 0x20"
+.LASF2014:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF2045:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF2749:
+	.string	"gyro_use_32khz"
+.LASF1458:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1463:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1137:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2099:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf"
+.LASF1889:
+	.string	"LSM303DLHC_HPF_CLICK_ENABLE ((uint8_t)0x04)"
+.LASF1084:
+	.string	"__DECL_SIMD_acosh"
+.LASF2861:
+	.string	"gyroReadTemperature"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2654:
+	.string	"OWNER_COMPASS_CS"
+.LASF1383:
+	.string	"_WCHAR_T_ "
+.LASF1305:
+	.string	"USE_FAKE_GYRO "
+.LASF2180:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1689:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1497:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2692:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2788:
+	.string	"staticNotchStage"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2109:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"_BSD_WCHAR_T_ "
+.LASF837:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1782:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF1489:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2344:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1602:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1409:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2404:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1218:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2806:
+	.string	"schedulerResetTaskStatistics"
+.LASF1574:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1745:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2422:
+	.string	"__int32_t"
+.LASF1145:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2717:
+	.string	"GYRO_ICM20689"
+.LASF2633:
+	.string	"OWNER_I2C_SDA"
+.LASF2423:
+	.string	"__uint32_t"
+.LASF800:
+	.string	"__DECL_SIMD_atanf "
+.LASF1433:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF977:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1643:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1623:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2731:
+	.string	"healthy"
+.LASF2696:
+	.string	"TASK_BARO"
+.LASF1437:
+	.string	"Q12 (1 << 12)"
+.LASF2747:
+	.string	"gyro_soft_lpf_hz"
+.LASF2522:
+	.string	"busDevice_t"
+.LASF1243:
+	.string	"USE_CLI "
+.LASF2577:
+	.string	"BMI_160_SPI"
+.LASF1090:
+	.string	"__DECL_SIMD_erff"
+.LASF2327:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1846:
+	.string	"LSM303DLHC_TEMP_OUT_H_M 0x31"
+.LASF1656:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2838:
+	.string	"head"
+.LASF2325:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2658:
+	.string	"timeDelta_t"
+.LASF2086:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF2720:
+	.string	"gyroSensor_e"
+.LASF791:
+	.string	"__DECL_SIMD_acosl "
+.LASF1516:
+	.string	"PG_RX_CONFIG 24"
+.LASF1543:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1522:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1481:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2039:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1923:
+	.string	"LSM303DLHC_INT1INTERRUPT_DISABLE ((uint8_t)0x00)"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2795:
+	.string	"gyroSensor_t"
+.LASF1115:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1570:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1087:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2093:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF780:
+	.string	"__DECL_SIMD_powf "
+.LASF1690:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1156:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1381:
+	.string	"_T_WCHAR "
+.LASF2607:
+	.string	"GYRO_RATE_8_kHz"
+.LASF2134:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF2362:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1807:
+	.string	"LSM303DLHC_CTRL_REG5_A 0x24"
+.LASF2273:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF2092:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1983:
+	.string	"BITS_DLPF_CFG_256HZ 0x00"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2697:
+	.string	"TASK_ALTITUDE"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1987:
+	.string	"GYRO_SCALE_FACTOR 0.00053292f"
+.LASF2265:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF817:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1686:
+	.string	"__PDP_ENDIAN 3412"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1364:
+	.string	"_STDDEF_H_ "
+.LASF2011:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2481:
+	.string	"FILTER_BANK_STAGE_PT1"
+.LASF809:
+	.string	"__DECL_SIMD_asin "
+.LASF2378:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2379:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF999:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1187:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2158:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF2256:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF971:
+	.string	"__DECL_SIMD_asinhl "
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2667:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1326:
+	.string	"USE_DASHBOARD"
+.LASF1519:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF2760:
+	.string	"gyroConfig_Copy"
+.LASF2101:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF2111:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF2467:
+	.string	"firFilterDenoise_s"
+.LASF1179:
+	.string	"_Mdouble_ _Float32x"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1724:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1234:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2196:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2649:
+	.string	"OWNER_RX_BIND"
+.LASF1548:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF956:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1280:
+	.string	"VTX_CONTROL "
+.LASF929:
+	.string	"__DECL_SIMD_atanh "
+.LASF742:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1393:
+	.string	"_BSD_WCHAR_T_"
+.LASF2652:
+	.string	"OWNER_TRANSPONDER"
+.LASF2477:
+	.string	"FILTER_LPF"
+.LASF1972:
+	.string	"ICM20602_WHO_AM_I_CONST (0x12)"
+.LASF1146:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2400:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1642:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1675:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF841:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2113:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1634:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2059:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1847:
+	.string	"LSM303DLHC_TEMP_OUT_L_M 0x32"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2031:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1429:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1129:
+	.string	"__f32(x) x ##f32"
+.LASF1371:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1107:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2580:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1813:
+	.string	"LSM303DLHC_OUT_Y_L_A 0x2A"
+.LASF1096:
+	.string	"__DECL_SIMD_asinh"
+.LASF2489:
+	.string	"channelCount"
+.LASF2239:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1700:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF2707:
+	.string	"GYRO_MPU6050"
+.LASF1701:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF858:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1059:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF2545:
+	.string	"temperature"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1726:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2791:
+	.string	"softLpfDenoiseState"
+.LASF1828:
+	.string	"LSM303DLHC_CLICK_SOURCE_A 0x39"
+.LASF805:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2067:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2079:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF2552:
+	.string	"mpuIntExtiTag"
+.LASF1209:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2659:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2586:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1551:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF898:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2743:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2802:
+	.string	"gyroDataReadySignalled"
+.LASF1085:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2263:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2493:
+	.string	"pgn_t"
+.LASF2811:
+	.string	"filterBankApply"
+.LASF1562:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1810:
+	.string	"LSM303DLHC_STATUS_REG_A 0x27"
+.LASF1775:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF1109:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2142:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1953:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4_7Ga 355"
+.LASF1621:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1355:
+	.string	"USE_I2C"
+.LASF2599:
+	.string	"__list"
+.LASF806:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2678:
+	.string	"BEEPER_USB"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF2446:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF2672:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF2834:
+	.string	"sample"
+.LASF2553:
+	.string	"mpuConfiguration"
+.LASF2663:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f "
+.LASF2872:
+	.string	"gyroInitFilterLpf"
+.LASF746:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2775:
+	.string	"SENSOR_SONAR"
+.LASF1468:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF1046:
+	.string	"__DECL_SIMD_exp10f"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2853:
+	.string	"gyroSetCalibrationCycles"
+.LASF2608:
+	.string	"GYRO_RATE_32_kHz"
+.LASF2052:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1320:
+	.string	"USE_UART7 "
+.LASF2150:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF2479:
+	.string	"FILTER_BPF"
+.LASF1573:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF1941:
+	.string	"LSM303DLHC_FS_8_1_GA ((uint8_t) 0xE0)"
+.LASF2328:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2609:
+	.string	"gyroRateKHz_e"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1982:
+	.string	"MPU6000_CONFIG 0x1A"
+.LASF2584:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1398:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1172:
+	.string	"_Mdouble_ _Float32"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2744:
+	.string	"gyro_sync_denom"
+.LASF1584:
+	.string	"I2CDEV_COUNT 4"
+.LASF1498:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1956:
+	.string	"LSM303DLHC_CONTINUOS_CONVERSION ((uint8_t) 0x00)"
+.LASF952:
+	.string	"__DECL_SIMD_erff16 "
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2190:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2286:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1005:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1432:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1840:
+	.string	"LSM303DLHC_OUT_Y_H_M 0x07"
+.LASF1948:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_8_1Ga 230"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1469:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF857:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF864:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2191:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1965:
+	.string	"MPU3050_GYRO_OUT 0x1D"
+.LASF2165:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF2702:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2156:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF968:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2611:
+	.string	"OWNER_FREE"
+.LASF2411:
+	.string	"DEBUG_GYRO_CALIBRATION 3"
+.LASF839:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1871:
+	.string	"LSM303DLHC_FULLSCALE_16G ((uint8_t)0x30)"
+.LASF2047:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1636:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF827:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF944:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2450:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF2716:
+	.string	"GYRO_ICM20608G"
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF2057:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1422:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2118:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF2461:
+	.string	"m_oldM"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF992:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1608:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF2463:
+	.string	"m_oldS"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2199:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2102:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF2705:
+	.string	"GYRO_NONE"
+.LASF2612:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1778:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1785:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF2738:
+	.string	"gyroSample_s"
+.LASF2740:
+	.string	"gyroSample_t"
+.LASF1897:
+	.string	"LSM303DLHC_IT1_DRY1 ((uint8_t)0x10)"
+.LASF1924:
+	.string	"LSM303DLHC_INT1INTERRUPT_ENABLE ((uint8_t)0x80)"
+.LASF2084:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__DECL_SIMD_powf64x "
+.LASF737:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1713:
+	.string	"__sched_priority sched_priority"
+.LASF1619:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF2168:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2232:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1616:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1472:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2539:
+	.string	"updateFn"
+.LASF1710:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1442:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF801:
+	.string	"__DECL_SIMD_atanl "
+.LASF1321:
+	.string	"USE_UART8 "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1711:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1833:
+	.string	"LSM303DLHC_CRA_REG_M 0x00"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf "
+.LASF2062:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1885:
+	.string	"LSM303DLHC_HPFCF_64 ((uint8_t)0x30)"
+.LASF2615:
+	.string	"OWNER_SERVO"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1930:
+	.string	"LSM303DLHC_ODR_7_5_HZ ((uint8_t) 0x0C)"
+.LASF1942:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_3Ga 1100"
+.LASF396:
+	.string	"bool _Bool"
+.LASF1372:
+	.string	"___int_ptrdiff_t_h "
+.LASF1796:
+	.string	"LSM303DLHC_LONG_TIMEOUT ((uint32_t)(10 * LSM303DLHC_FLAG_TIMEOUT))"
+.LASF1408:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF899:
+	.string	"__DECL_SIMD_log10 "
+.LASF1597:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2070:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF2478:
+	.string	"FILTER_NOTCH"
+.LASF955:
+	.string	"__DECL_SIMD_erff128 "
+.LASF838:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2706:
+	.string	"GYRO_DEFAULT"
+.LASF1588:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF2856:
+	.string	"gyroCalculateCalibratingCycles"
+.LASF2733:
+	.string	"gyro_s"
+.LASF2736:
+	.string	"gyro_t"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1806:
+	.string	"LSM303DLHC_CTRL_REG4_A 0x23"
+.LASF2387:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2021:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1959:
+	.string	"LSM303DLHC_TEMPSENSOR_ENABLE ((uint8_t) 0x80)"
+.LASF2575:
+	.string	"ICM_20608_SPI"
+.LASF793:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1821:
+	.string	"LSM303DLHC_INT1_THS_A 0x32"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2858:
+	.string	"isOnFinalGyroCalibrationCycle"
+.LASF2405:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2564:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1057:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1530:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"__DECL_SIMD_powl "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2604:
+	.string	"long long int"
+.LASF2739:
+	.string	"timeUs"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1992:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1995:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1760:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2441:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1389:
+	.string	"__INT_WCHAR_T_H "
+.LASF2793:
+	.string	"health"
+.LASF1943:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_9Ga 855"
+.LASF2817:
+	.string	"firFilterDenoiseInit"
+.LASF1502:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2635:
+	.string	"OWNER_SDCARD_CS"
+.LASF1175:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1660:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2488:
+	.string	"filterBank_s"
+.LASF2492:
+	.string	"filterBank_t"
+.LASF2454:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF2149:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"LSM303DLHC_SR_REG_M 0x09"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1436:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2878:
+	.string	"gyroMpuDetectionResult"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1661:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2271:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2771:
+	.string	"SENSOR_GYRO"
+.LASF1182:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF2027:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1640:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF2876:
+	.string	"gyroHardware"
+.LASF1662:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF2010:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1333:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1751:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1761:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF2041:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1314:
+	.string	"USE_UART1 "
+.LASF2753:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2015:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1663:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1683:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1975:
+	.string	"MPU6500_BIT_RESERVED (1 << 0)"
+.LASF2234:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1866:
+	.string	"LSM303DLHC_HR_ENABLE ((uint8_t)0x08)"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1789:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2571:
+	.string	"MPU_65xx_SPI"
+.LASF1671:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2268:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1867:
+	.string	"LSM303DLHC_HR_DISABLE ((uint8_t)0x00)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2722:
+	.string	"GYRO_FUSION_FALLBACK"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2072:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1212:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1563:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2656:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF1696:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF2583:
+	.string	"sensor"
+.LASF2245:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"TELEMETRY_SRXL"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1322:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1754:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF821:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF732:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1254:
+	.string	"USE_SERIALRX_SUMH "
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2105:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"SERIAL_RX "
+.LASF2003:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2651:
+	.string	"OWNER_LED_STRIP"
+.LASF2262:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1315:
+	.string	"USE_UART2 "
+.LASF1279:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2585:
+	.string	"mpuDetectionResult_t"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1088:
+	.string	"__DECL_SIMD_erf"
+.LASF889:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2202:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1780:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF1899:
+	.string	"LSM303DLHC_IT1_WTM ((uint8_t)0x04)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1352:
+	.string	"VTX_CONTROL"
+.LASF751:
+	.string	"__DECL_SIMD_sincosl "
+.LASF2763:
+	.string	"GYRO_FFT_WINDOW_128"
+.LASF2247:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2370:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1143:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2769:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1952:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4Ga 400"
+.LASF2420:
+	.string	"short int"
+.LASF2179:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1533:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2346:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF768:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1316:
+	.string	"USE_UART3 "
+.LASF1705:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1155:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF2850:
+	.string	"isFirstArmingGyroCalibrationRunning"
+.LASF2250:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1544:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1664:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1852:
+	.string	"LSM303DLHC_ODR_1_HZ ((uint8_t)0x10)"
+.LASF1382:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2579:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF2223:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2779:
+	.string	"calibratingG"
+.LASF1066:
+	.string	"__DECL_SIMD_atan2f"
+.LASF2666:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF789:
+	.string	"__DECL_SIMD_acos "
+.LASF1484:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1020:
+	.string	"__DECL_SIMD_pow"
+.LASF2029:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2698:
+	.string	"TASK_TELEMETRY"
+.LASF2638:
+	.string	"OWNER_BARO_CS"
+.LASF2556:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF2665:
+	.string	"BEEPER_ARMING"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF1545:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2857:
+	.string	"isOnFirstGyroCalibrationCycle"
+.LASF1553:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2071:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF2810:
+	.string	"firFilterDenoiseUpdate"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2639:
+	.string	"OWNER_MPU_CS"
+.LASF1937:
+	.string	"LSM303DLHC_FS_2_5_GA ((uint8_t) 0x60)"
+.LASF2812:
+	.string	"filterBankApplyStages"
+.LASF2415:
+	.string	"unsigned int"
+.LASF2765:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1317:
+	.string	"USE_UART4 "
+.LASF2864:
+	.string	"gyroInitFilterDynamicNotch"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2827:
+	.string	"gyroIndex"
+.LASF2381:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF988:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2374:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2759:
+	.string	"gyroConfig_System"
+.LASF2005:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2274:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1626:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1668:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f "
+.LASF749:
+	.string	"__DECL_SIMD_sincos "
+.LASF2312:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2785:
+	.string	"calibration"
+.LASF2094:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF1986:
+	.string	"BITS_DLPF_CFG_42HZ 0x03"
+.LASF1402:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF1798:
+	.string	"LSM303DLHC_I2C_SCK_PIN PB6"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1561:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1515:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2249:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2617:
+	.string	"OWNER_ADC"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2643:
+	.string	"OWNER_MPU_EXTI"
+.LASF1492:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF740:
+	.string	"__DECL_SIMD_sinf "
+.LASF1015:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF775:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2457:
+	.string	"DEBUG_FFT_TIME"
+.LASF1617:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF2351:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2280:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1318:
+	.string	"USE_UART5 "
+.LASF2297:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1598:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF1444:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF2048:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2620:
+	.string	"OWNER_ADC_EXT"
+.LASF981:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2129:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF2352:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1552:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2335:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1822:
+	.string	"LSM303DLHC_INT1_DURATION_A 0x33"
+.LASF2526:
+	.string	"CW180_DEG"
+.LASF1801:
+	.string	"LSM303DLHC_I2C_INT1_PIN PE4"
+.LASF2211:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2784:
+	.string	"gyroDev"
+.LASF1116:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2640:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2338:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2846:
+	.string	"dataRead"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2218:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1217:
+	.string	"M_E 2.7182818284590452354"
+.LASF2000:
+	.string	"IOCFG_IPU 0"
+.LASF2108:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2331:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF764:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2786:
+	.string	"filterBank"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2354:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2349:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2921:
+	.string	"thread-shared-types.h"
+.LASF2997:
+	.string	"accgyro_l3gd20.h"
+.LASF3002:
+	.string	"accgyro_mpu6500.h"
+.LASF2958:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2902:
+	.string	"/usr/include"
+.LASF2964:
+	.string	"mathcalls-helper-functions.h"
+.LASF2960:
+	.string	"floatn-common.h"
+.LASF2940:
+	.string	"stdint.h"
+.LASF2993:
+	.string	"pthread_stack_min.h"
+.LASF2886:
+	.string	"src/main/build"
+.LASF2899:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2939:
+	.string	"stdbool.h"
+.LASF3006:
+	.string	"accgyro_spi_mpu6500.h"
+.LASF3009:
+	.string	"io.h"
+.LASF2925:
+	.string	"time.h"
+.LASF2944:
+	.string	"wordsize.h"
+.LASF2980:
+	.string	"cpu-set.h"
+.LASF2917:
+	.string	"bus.h"
+.LASF2895:
+	.string	"src/main/target/SITL"
+.LASF2923:
+	.string	"pthreadtypes.h"
+.LASF2990:
+	.string	"__sigset_t.h"
+.LASF2898:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2941:
+	.string	"libc-header-start.h"
+.LASF2984:
+	.string	"timer_t.h"
+.LASF2991:
+	.string	"struct___jmp_buf_tag.h"
+.LASF2965:
+	.string	"platform.h"
+.LASF2903:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2912:
+	.string	"filter.h"
+.LASF2924:
+	.string	"resource.h"
+.LASF2987:
+	.string	"atomic_wide_counter.h"
+.LASF2933:
+	.string	"boardalignment.h"
+.LASF2983:
+	.string	"clockid_t.h"
+.LASF3012:
+	.string	"statusindicator.h"
+.LASF2909:
+	.string	"debug.h"
+.LASF2938:
+	.string	"stdc-predef.h"
+.LASF2919:
+	.string	"accgyro.h"
+.LASF2956:
+	.string	"math.h"
+.LASF2977:
+	.string	"endian.h"
+.LASF2915:
+	.string	"exti.h"
+.LASF3005:
+	.string	"accgyro_spi_mpu6000.h"
+.LASF2942:
+	.string	"features.h"
+.LASF2897:
+	.string	"src/main"
+.LASF2968:
+	.string	"trace.h"
+.LASF2892:
+	.string	"src/main/io"
+.LASF2957:
+	.string	"math-vector.h"
+.LASF2989:
+	.string	"setjmp.h"
+.LASF2982:
+	.string	"struct_tm.h"
+.LASF2888:
+	.string	"src/main/config"
+.LASF3003:
+	.string	"accgyro_spi_bmi160.h"
+.LASF3007:
+	.string	"accgyro_spi_mpu9250.h"
+.LASF2985:
+	.string	"struct_itimerspec.h"
+.LASF2943:
+	.string	"features-time64.h"
+.LASF2955:
+	.string	"strings.h"
+.LASF3004:
+	.string	"accgyro_spi_icm20689.h"
+.LASF2889:
+	.string	"src/main/drivers/accgyro"
+.LASF2926:
+	.string	"beeper.h"
+.LASF2988:
+	.string	"struct_rwlock.h"
+.LASF2934:
+	.string	"runtime_config.h"
+.LASF2996:
+	.string	"accgyro_l3g4200d.h"
+.LASF2962:
+	.string	"fp-logb.h"
+.LASF2928:
+	.string	"gyro.h"
+.LASF2951:
+	.string	"time64.h"
+.LASF2937:
+	.string	"string.h"
+.LASF2908:
+	.string	"target.h"
+.LASF3010:
+	.string	"io_def.h"
+.LASF2966:
+	.string	"common_fc_pre.h"
+.LASF3008:
+	.string	"bus_spi.h"
+.LASF2911:
+	.string	"maths.h"
+.LASF2971:
+	.string	"parameter_group_ids.h"
+.LASF2952:
+	.string	"wchar.h"
+.LASF2945:
+	.string	"timesize.h"
+.LASF2887:
+	.string	"src/main/common"
+.LASF2901:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2931:
+	.string	"gyro.c"
+.LASF2972:
+	.string	"rcc_types.h"
+.LASF0:
+	.string	"./src/main/sensors/gyro.c"
+.LASF2999:
+	.string	"accgyro_mma845x.h"
+.LASF2975:
+	.string	"time_t.h"
+.LASF2907:
+	.string	"stddef.h"
+.LASF2963:
+	.string	"fp-fast.h"
+.LASF2891:
+	.string	"src/main/fc"
+.LASF2959:
+	.string	"floatn.h"
+.LASF2916:
+	.string	"bus_i2c.h"
+.LASF2995:
+	.string	"accgyro_bma280.h"
+.LASF2949:
+	.string	"stubs-64.h"
+.LASF2948:
+	.string	"stubs.h"
+.LASF2913:
+	.string	"parameter_group.h"
+.LASF2992:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF2893:
+	.string	"src/main/scheduler"
+.LASF2969:
+	.string	"utils.h"
+.LASF2979:
+	.string	"struct_sched_param.h"
+.LASF2930:
+	.string	"sensors.h"
+.LASF2920:
+	.string	"accgyro_mpu.h"
+.LASF2978:
+	.string	"endianness.h"
+.LASF2906:
+	.string	"stdint-uintn.h"
+.LASF2929:
+	.string	"gyroanalyse.h"
+.LASF2981:
+	.string	"clock_t.h"
+.LASF2927:
+	.string	"scheduler.h"
+.LASF2935:
+	.string	"accgyro_fake.h"
+.LASF2947:
+	.string	"long-double.h"
+.LASF2946:
+	.string	"cdefs.h"
+.LASF2961:
+	.string	"flt-eval-method.h"
+.LASF2932:
+	.string	"mathcalls.h"
+.LASF2950:
+	.string	"typesizes.h"
+.LASF2994:
+	.string	"accgyro_adxl345.h"
+.LASF2918:
+	.string	"sensor.h"
+.LASF2967:
+	.string	"common_fc_post.h"
+.LASF2953:
+	.string	"locale_t.h"
+.LASF2896:
+	.string	"src/main/target"
+.LASF2973:
+	.string	"pthread.h"
+.LASF2910:
+	.string	"axis.h"
+.LASF2890:
+	.string	"src/main/drivers"
+.LASF3001:
+	.string	"accgyro_mpu6050.h"
+.LASF2976:
+	.string	"struct_timespec.h"
+.LASF2970:
+	.string	"build_config.h"
+.LASF3000:
+	.string	"accgyro_mpu3050.h"
+.LASF2894:
+	.string	"src/main/sensors"
+.LASF2905:
+	.string	"stdint-intn.h"
+.LASF2998:
+	.string	"accgyro_lsm303dlhc.h"
+.LASF2954:
+	.string	"__locale_t.h"
+.LASF2904:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2922:
+	.string	"struct_mutex.h"
+.LASF2936:
+	.string	"gyro_sync.h"
+.LASF3011:
+	.string	"io_def_generated.h"
+.LASF2986:
+	.string	"pthreadtypes-arch.h"
+.LASF2914:
+	.string	"io_types.h"
+.LASF2974:
+	.string	"sched.h"
+.LASF2900:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\026"
+	.string	"\036"
+	.string	"("
+	.text
+	.section	.gnu.lto_.icf.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\257\002\235\021"
+	.string	"\246YbG\360\262\2505"
+	.string	"2\255\b\217\255\266,\256\332 iHz\324\310\241(\373\352\336\254\b\237\035\030\211q!\357Wr.\341\023\331D6\221Md\023\362\fT\376\033\327\270\372*\001\261\272$XKd\223\275W\222-\267\334DdF"
+	.string	"P"
+	.string	"O"
+	.string	"*~jl\370\244\340\213C-F(T#\310\t\232\367\271\244b%\355\276^\353\335\213\323\355\266[t\370\034\374SB\265\333\017\036\356\333\036\332\233\202\312\327j\005\250\336M\347\346\006=\227`S\274X\341\231*\223\223\tv\274\222\264H\t\342\0069nG\222K\027&C\217\211\236\232\321(\221\214\333\253\310\205Ba\033\247=b\002&\004i\212@F\2400\214\356\364bvpT\242hNE\035(#-!XkMk\306\346\033=\272#m\273\355\350{\367\365&|8\001\266\035%\nP\356\306\246\272!\020~'\277\323+\223\261r\006\230J\026\257\321~\\\b \237.\"\307\207\025\240\376w\013\313\007\027"
+	.ascii	"\322\245A\007\206b\372\267-\330m\306\311\004U9`+&\333\325\016"
+	.ascii	"Mv\232\326\006\f\233Y\311\270ww\351.\363sI\305\312\b\020D\031"
+	.ascii	"Cb^\036PY\207\n\033\034L\272\3620\363\241\322`P\213\036\232\031"
+	.ascii	"\006\344\367\220\366\230\321\340X@N\377\262\360y\335\024\220"
+	.ascii	"\243<\225y))\244\\\211\304Xl\t\250w\201\204\020\035\004'\233"
+	.ascii	"|\227e\241\305\343\200\001\273=}\002o\001O\250q)qd\306hF\013"
+	.ascii	"\212Z8@\002e\254\2127\021pE2G\263\300\205\266\003\016\204\200"
+	.ascii	"\n\017\360D\304(\350D~)lC\242\036#;\244\224#*p\2243\rW\200\324"
+	.ascii	"\034(:>\217:n\276\255x\266\016\310\260!\305z\217\263\313A\312"
+	.ascii	"m\340\357\013\254^\227\257\237\271\226\332\024\263\3015\224\201"
+	.ascii	"w\343\004\016\254\246h\210\344a\251\024\241A\317Y\016y\356\371"
+	.ascii	"R{\312\350\215~\265\t\320\337\350Hi\030B'\331\300\177\277/\274"
+	.ascii	"\r{\354s3\345TCk\367#\377\375<\301\254\347\345^T\334\345\032"
+	.ascii	"\334\357\022"
+	.text
+	.section	.gnu.lto_.ipa_sra.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"%\006"
+	.string	"\002\210\026\034pO\241\003|\253\256\252\252\252\252\372\210\253\231\334\r\344\270\306\217\2416\002\211\334)\005Nu\315\314\224\212\231\027\313\254L\312d\252%\021}\310|H\3231\250\242\2538UR}\203\261\330r*vbD=\264\303j\r\2630\243I\230\203-\320\003\353{\300\256\317fo9y'0 \220\202\241\262\363n\"\257\202\321\271\325\021"
+	.ascii	"\006nuQ\337\352e\005\233\340\n!y\267\022\016\226\b\0318\241\035"
+	.ascii	"\204\253\301\247l\274\2158<3`!\026\227\024\354$\b\027p\203t\b"
+	.ascii	"\n\025\034\251(\270\312\035\013\006j\265A\351\225\026\325\005"
+	.ascii	"\210\t\230\325\305$\034\217^|\006\313\256\265%C\332\330\332\032"
+	.ascii	".k`\b"
+	.text
+	.section	.gnu.lto_.inline.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\332\be\""
+	.string	"\246.\234G\260XQ\032\003\214\264~\352dX\372\362\345\356\022B\251\031\f\035\032\346\031\f\231\356\333D\341y!Lb\0377\177\266\371\025@\264\377$\317\371N\265;\207\371\364\257\220\301\214H\350\227\214\337T\324Q\336*k\377\226r\247\204"
+	.string	"\211"
+	.string	"\207"
+	.ascii	"\252\247\251\222\246\035\022*\375xS\035>9$p\271\244i\023\033"
+	.ascii	"%`\200\253\\\345\315\036)\322\001$\327\f\233\304\210\027%\036"
+	.ascii	"\347\372i\320%)\212\214\342_l\375b\353\267!\376\375\335\324\304"
+	.ascii	"\025\336\224\n\353\267~\263u!\305\b\tx8M\347\234S\256kM\205\346"
+	.ascii	"\004\321z\233\002\315\211\243i\035yt9\236\271\273P\032k4\306"
+	.ascii	"\217<b\215\352\304?^H\325hNT\035q4\307\023\317\211wo\363\013"
+	.ascii	"\2217jeG\r\021E=;#<\004x\331\3556(\335\016\223\273\335\205\232"
+	.ascii	";Lhw9\331a\032_\352\266\303\0221\205\030\362\026\360eY\256%o"
+	.ascii	"\312b\316\311\322x\304Y\336\234\270\326\037K\227\345\226\345"
+	.ascii	"\024\334\fjb\247\307Go\326\207\007G\016\\\206\313\rz\370L\207"
+	.ascii	"\242h\251!m;\273@Y\002\360\034\366\207\006\025\031\030R\377\253"
+	.ascii	"G|i\216\205\324Ku\342\276\035\264\311\320\023\213\223\336e9p"
+	.ascii	"\237\245?Mws\316\241\214I-\313\355\f\244)D+&?N>`\034t\307\351"
+	.ascii	"\b\310\203\007\274\356k\033s`\001\037\252l\333s:\n2\243\t4\352"
+	.ascii	"\242x\362\343D\340\031\371-\251K\371-5\250R\220\322\320l\233"
+	.ascii	"\224\202\226\006\374\341TY\346\234(\324M\215(\005!y\r@&\3740"
+	.ascii	"\347\304=Mah\253;0\3655\205\251\255\2239\347\352\225\306\343"
+	.ascii	"\262\234\374aP:\237\355\256:\327\270\2133\316X\214\002\f\026"
+	.ascii	"\206+\370L\377>y\377\177\323\344\256\263N\220`[ \024"
+	.string	"\001\302=D-\222X?X\007\r\376\025L7\232ft\211\351FSk\006\357\n\033%^,\320\265\264@\222B\263\r\215# \274\017\b\210\013\226\325\260,\213\003\376\222A\305\277\321\330\013\"\203\307\212\221\364D$F\306v\005\032\327**~\bq\355\002k\270\227k\376\031\210o?-2'n%?\347\2051'.\034\201~@\312\314\035\3014`[\335\005|z\275\036\312\250\327\353\245&\360\033o\273\243\t\200\335\250\001=\206\f#4#\222\024\024$i\f`\242ACU\345\001\022@51IZ\250\214\f\221\026\024\224\024\3529\020t\020\013\340\fC\252^\311\261M]\276\331\252\214bK\2769r\255\355\311\271\016.l\023T*k\360\017\252{\250\265r\302a\354Fx\f\353\022\250\221c\330\004lv\fP\215\034\001X\203\320Q\r&T\\\333?\261\nM\f\211'\202\001\221\260\2310\3510\212\007\270"
+	.string	"\362\033\201 x,s8\007\267F\3425m\270\351>\032\301\032L\364\353X\"\223aj;T\245,\fV%\345K(xiX\220\310\333\033:Ac\020u0x\332"
+	.ascii	"j\007\257\362\366M+\317\030\373x\335\330Y\370\204\"\320\327\354"
+	.ascii	"\006\216\303\232\216\016U;\030\266\267\027\030\316Z\3660\227"
+	.ascii	"S\264\223\242\222\005\221 \352\026\f\230`\272Q\347\214\252\323"
+	.ascii	"\240.\300\320l%\007\375\370bh\321\277\367\242\032A\262v!\212"
+	.ascii	"\360\371\232\342^\220\351.\316\335b\305\364Q\344\251uE[0\222"
+	.ascii	"\334\204#\032\206ox\f#\307Y\346m\0271\\ph\201\"\3211\035l\247"
+	.ascii	"\245J\223\343)\256\026}\352\2319f\376\375q\236W\275\342@\t\236"
+	.ascii	"\215\325^>-\267T\334W\006\362\267a\261\325Y\300QG\214AC\"\256"
+	.ascii	"^7\006?\312\262!Zy^LX\220\371\001}4|\361\235en\016W\370^Y\344"
+	.ascii	"\313\027\363$\214\347\023l&61`\331/3\244s\213\024\2063\340\222"
+	.ascii	"\305\300l\316\271\322f(\343$C\257\342\366\021\257Ma\204'\336"
+	.ascii	"\013\034\003v%\346\332W\234'\316\353\021\312\234\246W\300Ff\350"
+	.ascii	"\0171'b\313\017\373?\002A\311\213_&\320:\227>\267\212dTk\016"
+	.ascii	"\013;\245wL"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\220\005u\020"
+	.string	"f\025A5`U\223\0160\fu\3501\26087\310F\020(T\201\023[41\373\026U\020I\020\240$\327J\262Z\330\362l\315D<>V\331\355\223\253\247m&\311\336)\245-"
+	.string	"4"
+	.string	"3"
+	.string	"Fg"
+	.string	"\366\210[:\204v\b\357\277\225\212\023\004\377\206\340_\2616\337\256\266\331\336\272]\256\235\"\370\273'\263M=\245\347\304~3E\214\251\241\260\315\016:y\357Y4\364e\007\300\246\233A;\265\224\266\240\225p\b\232"
+	.ascii	"{\354\347\022@{|\321'\r\347Z\351rM\032({~\246\320\246\360\366"
+	.ascii	"\013\f\226\227\331\013o\025.\245PD\2373\274\370Yk\023\332\351"
+	.ascii	"4\232Fn\001\274_;\367\352=B\231\345\033\353'Y\272A{\2037{\317"
+	.ascii	"\036\370\201\227h\036\255\236\314\266Z\317\037:\255\004&[\206"
+	.ascii	"\007T\024d\211mdGr\024\304i7m\304\005\242V\246\231\355\234\333"
+	.ascii	"z\235}L\325k\242u\355\343\337\241\245\250\2066q\250a\255s\212"
+	.ascii	"h\2460\305\332\001@\002B\020sf\033\022\340\301!\002\022\2059"
+	.ascii	"\216ACQ`\221\220\024\226G2\006\323\260 \254\221d\030\033\324"
+	.ascii	"8|\267\330'\315\332#\016\306:\262\310\352\353F\200rP\f\340W\336"
+	.ascii	"WbV\020N\371\233;\333mp\324\211*\3248\247j\272?\264<\262G\225"
+	.ascii	"\365\013\277j\230\310D\206\341`Tvp\273\232\364\345\177I\272\247"
+	.ascii	"js$\213\302D\177U%\354\214\262\261\035\336\r\337\f\t\333Tc\n"
+	.ascii	"_\205;G\220\344U\022\016p\317#\321\007\263\220B\336\317\330\346"
+	.ascii	"X\276 8A\372u(\320\276\261\367\317W\020\252VQ\333\314p\205\017"
+	.ascii	"\275DE\277\"JA\354\037C\017\312\032\004\033\201Zo\272J\356fk"
+	.ascii	"\\\256\327n\0010\335G\022\257\341\241\204\202\217\222%\022lL"
+	.ascii	"\313\226#\265v\217*\341\003\275\313\271h\023\201k\332\306\265"
+	.ascii	"\234\033\223N\217Q4\0207\321\204\236\337\257\300\335\001"
+	.text
+	.section	.gnu.lto_.pureconst.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375 h\305\002"
+	.string	"\202\006\025\035`O\322\0014\034\210\355%a\b\202 \b3\254\254r\263\302\n*\212\210\016\256\371\266\003\333\346\323|\231\0173/\237\345V.\345\2469\231\222\033\371 \363\3619\3564&\343.\246\342&.b\036\256a+l\204m0\0053p\0017\272\320}n\245\252\342\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\353\002}\016"
+	.string	"FS=7`K\223\341P\3601A\206\362\270\25189\021C\006\330p\242\202\260\242`0\265\240hK4\332\211\223m\323\202\305\"K\310\377o\377\377\337\2375\370\275\233\264O\244L\001*"
+	.string	"+"
+	.string	"1"
+	.string	"\327\271\265\307\233\177[\213Or\276\264#`\244\340\226\224O}\236\240\215\261\232\224U\033\332\3009\245\375RG\003\353\321\317;\034\002\023\362Oi\307\007FpBE5\336l\177\374Z\026\013\022\237\224\362\005]?\025T\250f\fr\277i\020\233M\203\364V\347\251}\006Qy\203\306#\306\027\231\237\f\214@\234E\3049\207i\200\256\365`\230\316\231\0011\275\025\257Y\303\226\305\315\367\253\274L\273\026taN\361\004\246\225\bO\021$\\\032C`\345)\307\343\201\237\f\374\240\300O\340\031\360\354\360@\212\203\262m\024)"
+	.ascii	"Ou\220~\002J\311\322Ks\3222\372(\2031\310\005l\250\001E\310\330"
+	.ascii	"M\223\264\031`\002\031\252:\017\021\26014eS\220d\331\r\f\013"
+	.ascii	"W\271\227\024\026\021\025\251)8\362\035\036z\035\211\004\024"
+	.ascii	"\321\025\313\352(\361\202\303\301Fvp)\004$$\240\207]/z1)\021"
+	.ascii	"l.\177\3724Y7c\021\031#\375\322\241C\266`\330\356\345\004\002"
+	.ascii	"q\215\001\340@\336\037R\262\204<\354(\266\021\\0<\332\211\236"
+	.ascii	"\2263\303#\374u\374\330U4z\321Q\363\361n`n\352t\276\237!J\315"
+	.ascii	"qh\307`\005\025f>nr%\346\033\323\237\224~\272\201\277\357\340"
+	.ascii	"\025\352\354\340%N\201;\201\005)\243sE`W\t\257I \360\n\373\340"
+	.ascii	"rn\200\302\242\023}\252E\177\325\231\327\254I\365\376\326\315"
+	.ascii	"\274U\365\353\037\373\257\n\340v\\\037"
+	.text
+	.section	.gnu.lto_.lto.c2f916ca4449eec7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.30.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\307\342\021\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\325\006us\356\005uq"
+	.string	"\005\001\006'\001\030\212\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gyroConfig.32.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375 \213\255\003"
+	.string	"\344\005~"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001'\001\344\310\001\254\002\220\003\005\001\006\177\035\001\332\035\001\0040\005\001\006}\001"
+	.string	"?\202\210\200\300\002{y\305\001w\304\001u\303\001s\274\001q\274\001o\302\001m\301\001k\301\001i\274\001g\274\001e\300\001c\277\001a\276\001_\275\001]\274\001[\273\001"
+	.string	"\t"
+	.ascii	")2@\214\242\256\200\206\201\300*3/\001Rn\031@\021"
+	.text
+	.section	.gnu.lto_gyroSensorBus.33.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"m\007"
+	.string	"B\31635Po\322\001\203\362MZ \256\006\037\251\207\004\256\261\t\004Lm_\0351\332\206Z\357FhC\270]\261\347\314\314\224\033\362\375?\316\021\033\265\314\377\323n{\247\024\356p\242\fE\300)\343\004y&\004I@|`GN\3109p\234\360HX\021\243\204\257\356U>\003\326n\351\324\216O\241H\360<\212\005\202\265\273\rw\376\311\353\205/r\347\220\210\235\336\371\"\352\316\201\243\3240\374:\226\311\330\225\304\332\207\375\3156\017\233\t\320\2700\274\354n\324\314l\213c\031\261=\262\237_\362k\344\312\240Z\247\227qi\254\304\354V\350\372\002\352.\340\004\324]\003yuV\3717\371\206$\004\206\232Hg"
+	.string	"\017\273kFM\247\273\335\266\202\355\005\333W\n"
+	.ascii	"2\003\302\260\032a\351!\254\212I\240kx5\242i!\bqWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroMpuConfiguration.34.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"u\007"
+	.string	"B\01646Po\322\001\200\276\032\2262\324t\227\250\274\022\267\260J \240\225\355\253\203\3316\324z7B\033\302\355\212=gf\246\334\220\357\236q\016)\030\371\377h\264\333\336)\005\356p\242\f9\300)\343\004y&\004=4|`GN\310!p\204\360H(\021\243\204\257\356K>\233k\267tj\307\223D\030x~d\242\340\332]\205;_\344\225\302G\3359$b\247w\276\250\272[\310(\265\n?\215e/v%\261\306a?\263m\303f\017\203%!e\367\"\006fW\034\212\207\355\221\375|\220\247F\266\006\352u\332\264\234X\230\270\354V\350z\201\352\016\340\001\325]\353\270uf\371\017y\346\003\245BM\2443\r\303\356\232Q\323\351n\267}`\033\301v*\n"
+	.ascii	"2\003\302\260\032a\351!\254\212I\240kx5\242i!\bqWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.35.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"u\007"
+	.string	"B\01646Po\322\001\200\276\252\025\250n\241\202\224W\342\265\316O\242\312\252\373\352`\266\r\265\336\215\320\206p\273b\317\231\231)7\344\273g\234C\n\256\371?\032\355\266wJ\001\346l\242\004A\300)\343\374t&\374D<x GN\2701p\224\350HH\021\243\204\257\356Q<\001\327.\351\324\216?\231@\360\274I\305\301\265\273\fw~\311\253\205\357qgP\210\235\336\371\241\352\256A\203\324.\3746\226\301\330u\304\332\311~f\033\207\315^\210\313Bj7#\025\263-\216\005\304\266\310~\376\310Q\"[\005\3652\t\234V0R^v+t=Au\007\360\201\352\256u\334:\263\374\223<#\362\241BK\2433\215\303\356\232\321\222\351n\267\235`[\3016*\n"
+	.ascii	"2\003\302\260\032a\351!\254\212I\240kx5\242i!\bqWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroDetect.36.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\251\001\335\020"
+	.string	"V\037qI\340\262(\035 \355\352\304B%\035\016q4\205'\345\003p+\357\035\002Ba\022\257\210\204\241d\205I\343\212\3771\217 F\016v\336\230a6\301\3049,o\310\031I\026\236\036S\007\003\213 [\254\261>\2120B\366\336)\005["
+	.string	"Y"
+	.string	"_"
+	.string	"\245\314Eve>=\273e\311\n\274s.=\333>\212\337\254<\326r\366\032\325\370h\310\t\332-\277\221\027\350\316\325\017\350\316\321\020\037_\351\034\375\327^M\360\334\310\027\353\325\303i=\351\f\335\204\274\\5@\211\f*^\373\244y\315\314\t"
+	.ascii	"ew=\311W\207\233\273%\330S\024\236;8?\377\330\235\366\t\261\326"
+	.ascii	"\364a\002>=B@;}\330%k\322\032\373u\251\314>\355\026\275\374+"
+	.ascii	"\235>\310GlP\216\322\214\335\r\267\037\033\203{!\342\264\337"
+	.ascii	"\276\355\225_\363\350D\242t\332\350\2618x:90p\354\226\013\316"
+	.ascii	"\031\202w\002Q"
+	.string	"\232\323~\212\343\254\036\266\031\234\007D0\333]\023\277\305]\250x\205e\236d\351\316q2H \222\215G\355 6\035!Fi\331\306\314&Fc\272S\261V\3035\207,\232\225\332\341\205y\362\364A\314EY\006a+\0044wl?w\351l\325Y\270x\273[\342\257x\201!\315l\316\3712\3359\003\263\035\255y\013\240\210\202I\021Q\021Hn\340\200\004uRbBb\022\360\002\246P\247L\241\030\243\362\251\304P\325\002\252\276\226\025T\205/%\252>\323\001\207\026@\361\303\020\206\3427*\367u\251\314\247\001\373@\277\363\237\200\335\230\376\330\211(\215m\021=\211\265\350\314\255\212\314\237Bg\243R\363\244GH\266\036\t\272! `\002\0311\333\003\204\301\363N\201\"^$\022\bo\310\362\003<@B\370\372uu|9\bN`\222\007aD\301=4\317+\b\034CVC\006\206\261~\375\213\\$\f"
+	.ascii	"\tVb\030v\342\301\0216\310\272\211\f\322\t@m\320^\244\027S\336"
+	.ascii	"\303,\002"
+	.text
+	.section	.gnu.lto_gyroInitSensor.37.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\024\005\355\036"
+	.string	"\246\265\277G\200\334M:\237\251\240\364\227Y\215.\277\364O\2421/0.\024\240\205\332\263[\246\017\340\b\016H\351\007\033\254\004\031\207\254[p\f-\333\030bL\n:\306PC\221\313R\306geP\206\203\271G#\204\020\"e\222\001\251"
+	.string	"\240"
+	.string	"\252"
+	.string	"\\1x\277\264\002_\220\001\313z\360qA\230\037y\242\020\333\220\310O\231\266k\255b\333`~\024:\033b\336}\326\2514]\213\306\177j\265\n\003Vk\na\033\230\0377\275\216\374h~"
+	.string	"\371qw7\002Q\323\236O\2038\312)TJX\247\326\264\327F~\336,\311Ql>\367N7E(C\257\2545\"T>^\3668\031"
+	.string	"(\025\305\343\205O\260Cm\253\f\013p\307E\034\260\206\310\273\001\374q\213\016\252\310\350\b"
+	.string	"\204\022ucE\332\\x\004Mr\370`.1\324Z\227Q \325\367\366\335\325\261\273&v\307\002\001&.\274E6\224\207N\212\2205\264\237\344.\212g9\t\fwS\034\213\221Yk\235p\345\304\221\317\020\311\307=\r\362\243\202`\332\023\267\355\016\b"
+	.ascii	"\376\031~\307\220\017\376\323\273,Z\360\321\345E\265\323\356"
+	.ascii	"~\220]\370\021L\3225\264\312wvS(\356\253\335\213\265\255vM\336"
+	.ascii	"\335\271\276\272k\375?\313\233\353\341\305\335x{J\336\233\311"
+	.ascii	"k\212\274e\311K\212\274c\311+\212\274\275\274L\362\036h(X\005"
+	.ascii	"\344\310T\227\245\025G\033\236zf\354\242\344\\\377n\323^\270"
+	.ascii	"\270\b6\206n\345[M\017i\316({J9\247\234S\310\217\255\005EC\300"
+	.ascii	"\335c\227}V\311\300G\315\346I\265\323\222]j\370\330\031\262\377"
+	.ascii	"%\366\270\341e\212\304\304~\231Yw\267\230T\2361\035\314Z\177"
+	.ascii	"b\270\271\013K\213\303\314\220\215HT\226\254"
+	.string	"\207\207\235@\301{\371\227\017{$!\370h\b\362c\3200-\027\346\205\354A;q\300\304\361\f\310]o\211\371\264\265\265\255\235\001\251\353]/GUA\305a.jcC\272\257vc\220\272V\261e\366c;\313a=t}\256\363\236\370\316\356\370\275;\202\004\037\3255\357\327N\273\377ZZ\200\356\226\370\226H>#\031+|F\034r3\220V$u\270\255\004\nDF\026&T \n:\n\022 \242g\217\202\224|L,zK>\245\245$\244\245^R\013#\027\275#\337R/\310\300*\275@\362\365`()\371z\270\364\351m\265\244\033\033]_\345\275~\341\213\330xu}\361\301<\327S\273\233\353\305\360\324P\246\001*!>\203\234C8\354N\211+\3629\347\025\220\232NdC\321\350\220'\026\211k\025[k~l\307\310\321N\2543\\\357\b\2449\340\367\366\364\342\204\354\231\344pN%oz\372"
+	.ascii	"\226\234\033\223\267a:\020d\343\323nP4\263\242\341\255!\230\235"
+	.ascii	"\231N\256\346|\222\033\242yh\2501<\305\240bhH(H\232\242\244\003"
+	.ascii	"\240\242\021:\343\001\021@E\246\252H\232{\0065\030\352\367\263"
+	.ascii	"k^\354\336\267\216=\327p\337\221\312\336\364\211\216\tz\333\207"
+	.ascii	"\t\271\033\222U\362c\230e\"\325\365X\242=eA\321\300J\\\235\301"
+	.ascii	"R7\230\322\234\366\327\027'\tV\032\337=\0231RF\245\214\364\325"
+	.ascii	"\272R*\021P9\r\244\rD]\0015\344\021x\254\250\203\364\224\215"
+	.ascii	"\354\330\232\337\253\306\372>\325\304\240\347\324m\204uj?\305"
+	.ascii	"\245\017v7\352\276w\262\257\030\034\344!\306\336\361qn\032\357"
+	.ascii	"XF\312\205I\313\313P\301\035Q\255x\302f\216\3366G}\306No\336"
+	.ascii	"\355\310\r\261\212\306\353\373\"<\361\316\261 A\220\325+\261"
+	.ascii	"=J\265\356\306L\311w\334\227n&\254B/5"
+	.text
+	.section	.gnu.lto_gyroInit.38.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\365\b"
+	.string	"\006\220=;0\345(\035"
+	.string	"\360I\350\305\341\211\215\232\017<&\304%\340\245r\366\202\242\266\320\214\366h\004\373,\020\007@\354\206\231\372\322\201\201\001\203\016E\355\3034\021\302\001;\266O\366\336)\005*"
+	.string	"-"
+	.string	","
+	.string	"%w\377T\247\177`\\\254\\\273\337\214\035\357\016;\377\"\227!-\257\212\362\0165\r\273kXQ\032w\274\355\003\333\b\266[\001\257\346XD\317\005(\254\230\326B"
+	.string	"\366\347\301\310a_nL\331\206\226\330W2\\0\017.\273\247W\200ea) \266K\366\306\n\013\001\231\210\302W\031\0316*T^4\220\340f\311$\374#\377\270\001\325\256\351\325'y\311\346{\034\263\004\007_\217\371\\\346\230M\232\200\001\366t\250F\002\315M\243\333\350\263\315Q\310A4=\3326;\006\246\020\037mFP\252\315\315\267\227\033S2rL\221\302\002\360$\0130\371\n\024\312\002\017"
+	.ascii	"2\241\355\037\270iq\220p\007\310\004\f\204dI\350\016\013\217"
+	.ascii	"#\340\343\232X\030\221\227\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_gyroInitFilterLpf.39.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`#\004\r\034"
+	.string	"vs\263D\220\236\315p\234@\267$\346"
+	.string	"nB\251\356G>\354zH\263\002\nK?\342\225gpC\327\004\342\035f\205<\222q\2309\363\bQ\221\250\024\252\037 \317ER\203@\2105m\261\342N#\332{\357-e\222\001\235"
+	.string	"\231"
+	.string	"\234"
+	.string	"\r\036\252\007\362\241\r4jr\304\373*\n\001Iw\323\206r\367\225\236\f\344C##G\337S\321s}\212\356]7^\353\316\352\362\245\333|\240\013\310\207j\236H|H^\200\370Pu\252sn\"\351\207I\251\002\303\323\3357>\242[\335\311Q\fA^\235~\201\330\241b\243\3057u\362\245\325G"
+	.string	"^\240\210\243\022\270\025\207\214+\217\021\037V\017s"
+	.string	"\371x\"Q\0221%U\f\322|\273\345\262\036V\240\255\273\017\366\325\341\243\332\035\225\272[\267\347\363q\375\271\252\026QU\025\252 \201kx[T{>li\313\2710i\223\323\276\347$><Wp\323E\366\026\242\352\323\263\264 \273;I\217e\305\213"
+	.string	"m\226<\324\337\020\037*hc\247\334S\211\312|\311S\247w\217\252I\265\254\245z>\317\363T\316R\275\371\327\376u\035z\327/D\256\322x\025h\\\375\031WIru\034WE^\005\305U\016W7\\\375"
+	.string	"\tXWC\230p1\033\263y\234|\232,\f\343\344_W\375\025\035\315h\353H\365`z+\367\322\375\213\206mg\266\317\004\0343.<\335f\373\236\332x<\245\37248\241\236\252\210\217\215xx\033\371= 5\026\371<\263rO\025\372\005)\3533\267Mm\037\006bI\310\204\254\205F\377\273\226'\335e\364f~@|\030v1U\235CvO\375J\267\327;\314<i\254^\020\001k\267g\252J\342bJ\220\335\273$=\230\2079\201\"E\n\361!3\0027]A\277\037\335\335 k\351\020/\343\360\032\253\3612\203U\235\225{\376\314Zz\033b\215Wx\275\331\255\036\335\237\257l\210\377u[\271{\364\214\300\n\326\227\304!\3362\242\236f\304\220\002!\305\004\3254#FSN\303\200\032\034X\300p\021j\004\tHK\024\222& \0251\025\r\215"
+	.ascii	"R\246\"\\N\312\351\026\225\303EA5E\335\240\236\226^\334\230r"
+	.ascii	"Q\267\242\002\212\203\321\224\273\311\300\341r7\232Y\036l\316"
+	.ascii	"\322p\254\363\230\225L\005\222\266\005Y\210U/`8\330\225r\360"
+	.ascii	"\224\326\030d\335\252\263r\314\203~P\306\253\003\373\303@Lc\325"
+	.ascii	"\r\035\324\2249\240\001\361\253\316J/\347\t\241\203\325\255\026"
+	.ascii	"\316\023\315\256\273L@\362\017_\016/\312\231\344\361\016\021"
+	.ascii	"2\017\372\t!\023\rX\025\330\263\310#\253~\b\021P\2501<\303\020"
+	.ascii	"D\006\231\231\tGF\323\346\200\002\2411\252\033\021`\301d\245"
+	.ascii	"i\323f\225d\363\2431f8\374Shq\326,Ni\237\207\274\035\266\222"
+	.ascii	"iF\t\013\241\365\230mg*\331uR#o\003yj8\364\032\335\230\001}\250"
+	.ascii	"J\365\342{\351\022\323\260\262\3421+wy\326\\Gr\327\325|?p9E\215"
+	.ascii	"0\350&\026r\210\3473\262\270E\303\325!\243\266\326\256jM\364"
+	.ascii	"s\3354\251{D\2449\304\354\n@\245x/\263Vy\314\004Sgc\315\177~"
+	.ascii	"\363\016\304\3631Dj\264\276A\222\246I\275X\227;\334\203M1\247"
+	.ascii	"E\353\20317\177"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch.41.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\310\004\315\036"
+	.string	"\266\367\300H\220\232Q:%\320\365b\310\304\233\252\267\311|\205D\220\355b\342\215\261\032\3362\363\346|\325\347\334\374\320\326\177.\252\341\275\307<\\\237\342g\3132\306\352\313\270\023\212\352\325\353Fh\326S^\275\255\030!\022K\210\334)\005\252"
+	.string	"\240"
+	.string	"\260"
+	.ascii	"PZ\234\300\032\247\024'3_\265\022\023\274\264\210\363e\215<M"
+	.ascii	"f\337\234\\!\321YUJ\362\221\341|yC\202[\342\227\374n\205\344"
+	.ascii	"\262\326\037p,\234/g\364F\205;\265\237\344J~\257\212q\237Z\243"
+	.ascii	"\264\024k%.\360\201\363\245\211\027\020{y\236\026{\351\237\215"
+	.ascii	"\346\304\251z\255\031LXmj\255\266\005\362\337\315XI.\375\371"
+	.ascii	"f\020\326s\204C\340\315\034\217\221\b\276\266\326\bx\022\"<\326"
+	.ascii	"\022-u\206P'\231dC%\272<C\031d\255\326\372\255\323\246a\022\245"
+	.ascii	"fP\255\325T8\264q\237\267\r\3036\013\233\214\02261\211\256\224"
+	.ascii	"}\262\326Z\275Q6\355Y\367\217I\355cR\317^\274{Lj\236W\375;\347"
+	.ascii	"\272e\267\372\317_\375f\016uyR\223&\365.5]\352\00700\304\213"
+	.ascii	"\013\255Z\237\342\274\251^e\025\252\027\377\254\237\353k\377"
+	.ascii	"\306\205\263\025\313nVp\266\271z'\260\306\200&*\247\257Z\253"
+	.ascii	"\212\363E\177\3132\377|o\342O\271\326\262\3012B\345*\214\312"
+	.ascii	"\025\222N}\025\343d?\213\254S\024\264f\334\322\340\226>\313w"
+	.ascii	"+$\016g\217)e\276^\372R|\262\227\f\2048\373Q|'\177\342{\247q"
+	.ascii	"\334\3410.7\222\304V*\247HW\030\371\263&\351\271\264m\362\221"
+	.ascii	"b\264-\301\244\f=\352\260*\276\026\304\372\237\216P^A\n\006F"
+	.ascii	"\333\362g\237\365Z\360g\351\031\036c\227\223>\333\263<&Gs}v\273"
+	.ascii	"v\214]\264\326\n\334\225\362l{\266\004\023.J\324\215\317\235"
+	.ascii	"-\235b4\366\354\213\257\361\254\001\253\037\327\305z\226\206"
+	.ascii	"Y:\222Tt\356Ztg\255\365\201\217\345YL\370A^\232\b\005\275\020"
+	.ascii	"E\354%\317N S\365\255\353\030\267\\\353\277a\274\002\246R9\245"
+	.ascii	"`>7(H\301l\356\367p\230\302\2024\216\351\021\352K\245`\001\035"
+	.ascii	"N\344\214vE1\243\036\221o\305\221\206\243\\\221\316\267B\307"
+	.ascii	"\273\020\340\005\206\241\241\235\221\257\002\200\027\030N\344"
+	.ascii	"\214vE\246\033@p $\341A\004\007@9\240\231\007\035\347\200v\274"
+	.ascii	"#\023\266\036o\327+\322\365lEDB)l9^\317\006T\300;\025:\236\315"
+	.ascii	"h\267\343\331d\304\340\311\272Q\036A\304+\270I\266I"
+	.string	"\200\376\033b\262\335w\210\225k{\370@/4Yu,\320\376\227\024;c\2046\210{\t\3415$B\301T\220\030\261\227\345^\210\203\266\344~\351\313\316\375\330\265\233Su\344!\333s\371\320/]\233\204\020\275P\2665\031\0134m\351\256\032\246\260\240\225\007a\250a4\303\020c\310)\tD\202\026\0244-\006`\002!cev\022`\3471F*)d\331\377\016J@\2470\372\375\305\220\316\253\306\262\322\304\351\220\026\315\250\201\352P\020\030>\007L,\2148\311\034\246bU\\\022\345\216\026\215\207\250\206\232\370\364\247\314\217Z&4\354\336\242L\232\212\026\251\"\205\304O[\255\204\341\302\ru\0058\264u \352\273\356a\n\233~\350\f\233\321\274-m\346\316 \213\301\342\326!\016\007\305\352\002\227\246w\037YI\254=\b,\312[:w2V>%\213\227\004\247\205<\331\366\341y\fk\n:\020\213\340\006"
+	.ascii	"\306Z\346\226$\230C\263\005\371e\223\260\363a\267\007\310\227"
+	.ascii	"\373\307b\201\327\177\224\231\256\222\312e\345\264=\260\032"
+	.text
+	.section	.gnu.lto_gyroInitFilterDynamicNotch.42.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\177\001\225\017"
+	.string	"\306\234gH\320TQ:@\344\312\346\206j\365\3601\216z\222@\225\326\3326\b\304\201\b\351N@\216H\300\200RA\265})\247.\3744#\026\270^\350a \262\360\250\271\t\f\307\301\330-F\340I\206\304`\257"
+	.string	"\211d\357\275S\nO"
+	.string	"Q"
+	.string	"P"
+	.ascii	"\242\355\224\273\201\355\324\240\035\344\225f\217Cb\203\315\317"
+	.ascii	"\356v\022\205\377Y\357\031\301\323)#\350\317\036G\360p\235\316"
+	.ascii	"\321\356\016\210i\230#\230\030,\316\025"
+	.string	"1\227\257=\356\270\001\373a#\026\363H\222\262\273\216\035b \356\355\266]lC\260\317\"\367\331\037!\255\234]\017AG\326\007\315\241\342\264\337\376)\004\3526\257\241\223\b\224\375\232/\3433\300\323\254\203s}\340npJ\364\354.\351\324*\334\351h\336\257\240\035\262O\034P\217\237\3710\036\003|\315\313\013\354\312rp\354\326\022+\340N]\037~\313f\273\364\032-\bvv\027\305\276\360\233\026\267\273'4\\0\210vR\234\372/\333i\tM\221W\f\262\200\036/t6\206R\232\364\323\356\340\304+\206~\355\263\205\214\210H\005\032\2621\264\253+\312\031\373qw]\2262\3735\377<\355\376\026\024R+\226\351\005\fLR\rNPLL*\023\201\b\001\2542y_KB\307\372<\326\312\212\325\255LHU\350T\037\2533\035\260\307\262\372:\013\236\367u\241\272\227\262\331U|\026\250\347%aT\316\030"
+	.ascii	"\217,]\362D\030\313\007@2D#\241\314\312\224W\f?wwgi\224\300\204"
+	.ascii	"\013\235\" `\0029f\344\001.\344x\027\313\212\3206p\303\255f\364"
+	.ascii	"'\233x\213'L\241\374Fa\273\271\232\306\352\372J,3u3(\326\205"
+	.ascii	"\254\246-k\240\002\254\005f\251\332\331&\202\370\304\351\033"
+	.ascii	"|\005\263q\243\275>\332=\374N\326\201D^\227x\002"
+	.text
+	.section	.gnu.lto_gyroInitSensorFilters.43.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\031\004u\031"
+	.string	"f\255\236G\260ZM:\200n\254\300\240\362p\304\216\303Z\362+\031%YG\330\016\340\227\346\236)\344\025\370yr\026\311 }I\245\016\333\277a\245\334\"\347\221\363\3600\026D!\310n\322\201c\371\335\240F#\333\244\221M\366N)\202"
+	.string	"\201"
+	.string	"\217"
+	.ascii	"\363NB\327\r\2015X9\304\360\030\363\272sC\366&O\3427\355\340"
+	.ascii	"\220\331o"
+	.string	"\362\225|\211\320\231\370\351\365\242\334\"\nURK:\257\316\020\276\276\276'\021\262\305\327\213\366HF\366i\177\351H\310\353\206.`\367\210j\312n\ts\203\360\325\345s\300\327\360\003\300W\223v\230\227H\273J:\"\243I\315\356\2164\b9\311O\322?\323Y\271\"\242\317\225\205\335\365\314\025\031\335\364\266\025\330\336`\177>\0029\033\350Ql\341\356\362@)\261\002\301\324\220!\360\365\3649\034\270\331\306\023\252\307\333\331\263K\027\223\002\261\377-=\262\257\373q\300\351\233o\332\365M\213\340t\253N\263\300\351\260N\257\300i\260NWp\372\253\323\364\233\236t\372\004V]t$)Q/\345\322h\263f\245j\225$\277\311w\376\023\213&\205^\372NDD\025\331]\361\325\366\235\276\325Q\256\321\204\336\224%5\273\245\316\353\316\f\331\003YB\330\"|\346s>\340+\245\267B\245\213*\342Q{\304\257\314B"
+	.string	"\337S\256\214M\342Vf\025\220l\240?\331\302\021iw'\255 Dw\200\row\177\341\234~\246\207H#U5\006\347\200A\017#<\237\006~g;x\025\332\202\251\335\215\360\235k\247\362\2233e\030\322\031\027\224\022o{:\377\356\266\200{\362\217\310\217\te\204w'\3671\343\243\312\f\016\275\323_\270\331\363\2015\256\t\373\251}\002\305|\316/\030\224\310\276\224\0263(h?*>?\350\201@\223\300\023\001B\254\026\013"
+	.ascii	"\242\345Z\314vkab\f\272\331\202R\374\004\215)N\320\200\306\332"
+	.ascii	"-h\214\025\260M\305\317mda\263\335F\261\304\235\036y\266C\nG"
+	.ascii	"]8\301\274!\225H$.zC2]\314\2050.:\346\020\251\215\341`(\232/"
+	.ascii	"\263\036*\230H{\204\330\bi\213E[\031\336\205\013kEC\r\337\302"
+	.ascii	"[!020?\nR\034js\350\020\203\022\271R\320\303\243\240*\225Q\351"
+	.ascii	"(\375(L\006\233\017\327\002\"\334}\301\343cyR\250!<C\031#H\215"
+	.ascii	"\020E\005\205\222\026\003\240\002\031\"+\017\021@\2752\310pa"
+	.ascii	"\f\323\0016\335\036\230W\262\016,\023\315Y\230\026\013\213\002"
+	.ascii	",p=/I\013:\261 \227\f\344f\267/+\376\007\332,2!\244 \243$\312"
+	.ascii	"\212[\213g.\217\016eX\223\352J\203\253\247?\f\025Q\030\t6\314"
+	.ascii	"K0\260\027\351\347\215\005Vqgt\017\231\027\035\205p4\3246?d^"
+	.ascii	"\\<\036\227\227\357\201\352Zm\266\337\006\215`Z\021o\004\035"
+	.ascii	"T\0337\"\350\306\237\277Q@8;\002\177%H\020\025\304\212\365\347"
+	.ascii	"Y\347\337\002B\276s\177<\351\342\240T"
+	.text
+	.section	.gnu.lto_gyroInitFilters.44.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375 \374\305\006"
+	.string	"\022\215/4@o\222\016@\265\345T\223\335\375\027\300EO\276`\256\213\216wK\365=\325\266AH%\252)\301\236i\217s\024\3055\274\256:\036\303.03s\033\204\310\024o4\017R\fn\202o\352p&\327iXpp\03389\r\301\357\201\003\035\304{\320e\256l\003)\204\214<\315b\f\253\250\027%\220\351i\274\"\035\211\270\035\225\226\240Xc\245Ka*\375D\005k\334\340\242Y3\224\017\225d-\177Y\254\205\276"
+	.string	"\331@\337\nD)\024/\231\031/.9\222N<\376f\256~\245\027G\326\244\004\203\204%3]\333hUV\335\202t ~\254\262\200\204\314\234\305\217Fo\375\017~\204?\024\b"
+	.ascii	"3\001[8S\370\370\032\327D\262\020\360\313\020\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.45.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\305\t"
+	.string	"V\323E:0\221\322\001\003\023\230\264\207b\232\004-\024Sf\276\322\353\334l)T\347\247\343\177}\375\2171\022KjV\277\f\n)\224!\025U\356N\321v\t\370\220]\334*\331d\357\224\0023"
+	.string	"4"
+	.string	"5"
+	.string	"\247\235\023t\247\266\335"
+	.string	"B9uQ\366\372\314\326Z\251\331\025\353$y\3522\345\277v:\346\300\270`\252K\200\211\335\265t\301B\356y\333\n\266)l\323\004\346N\373\347\224>Ex\221\371h\331}\335p6\206\2163\333\267/\242l\217]\307\007)_\363M~\202:\355\364\201\335\230\215\313\256\310\340\205\316\251\305\027t\001\263ci\215,y\263\375]\305\364\261\331\341S6:\273 !\224\016\016\003Y\311\251\177\352N??3\264\225\274\331#\262\362\306\026Ur\216\330\347vw=c\266ev\200"
+	.string	"\211$B\021 o\344\tT\004x\344}\240\207E\r\301/,\221\302Z\272\020a\324\021\030V\357\300_\006\t\254\032\337\007V\217\270\347v\306\270\231\260\232,\373\246\356\223\013\013"
+	.ascii	".!7\357b\305\212\214=\002\255\275|\226]l\306\330[\366,F\270\f"
+	.ascii	"2]\223\f"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.46.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\002\001U\r"
+	.string	"\006\031[D"
+	.string	"\261&\035\f>\340\350\202\233\301\367\n\004\304\016\250\376\255_\356\037\227\372lr\351\216\270<\353\223> \254\365\026\247\035`d\f\035\244:\275\327\377\233\301=X\3755\363\313z\007\346\320\341\3426D6\221;\245B"
+	.string	"H"
+	.string	"H"
+	.string	"\235G\317\017\270\036;\027p=\372/\"\033{\274\377\215l\314\013<#\223>O)G\3018\231\251\261;\245\2168\351\220\344\337\345\022<\224\025%\223\206C\016\220\3355,\231Tn\275\355\003\266#\330\357\0206\264Z\320\320\272L\313\312\007T\fu17%\307\306\262\210+\224\377r\225\350\237\037\243)\231\323\312\267\273\330\243\355\321g\b\304CY\213\006\247&\301\243\\5P\370\224\017s\022\242\317P\201\271*\237\2013?\005\217F\020\0365*\227\234F#p\332\335\360\361x\002\252\307\013\230\016\346\370\252WP\321\"\346\024n\254\r\215\1777\001\312N\273\335K\376\314K`\360[\036\315\201\340K\240\353\361\251wt\360\306X\210\2057\366\364\240\212\260o\255\2628f\340\300\023\002\341\343\201'\373d\001&"
+	.string	"\360'\323\266\220\005\311m\032g\"\302I\223\221\220\022\371\3318\231\031\260vAd\223\0314m\223\330\354n\255\262\250vt\352\331O\375.\277\007\016&\02062\272\223\\PU\257\024'+\317#GA\022\027"
+	.ascii	".!7\357b\305\212\214=H\262\346\214LP\236\321\255\332\006S\024"
+	.ascii	"\202+\b\262\276\310\316j\270;\023\230k8\270&\236\320\320\357"
+	.ascii	"\020\030\310\304\320v\016\302z\341\304\231\256\371\004"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.51.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\030\003\305\027"
+	.string	"V\252\227L\260\224U:\2601CE\274\306]\204oI\321\026ytbhl\310\352\364\\)\031*D\335p*G\244\230\375\323\017hbdse\021D`p\227\255\243\344\213\372\017\366\307zw\315\240\216TY\351\362\033{!]\331,!A{'\031~"
+	.string	"}"
+	.string	"\204"
+	.string	"@\227\341r\341\255\2456\r\202]\017)\370t\222U\324\033(O\252^\240T]\370?/\314\254\223g1\273V\024k\231#\224\344\036\304\265\336\364\024,\352V!\260\003\325I\3161\023\271\n\354\326\016\217\f\361\251\273\317\273\342\271\227d\352\332\034\337<Y\365|0/Q\234\344\205\260)\236"
+	.ascii	"_\214\275,\337.E\322\335\357\271\235\361\305Xk\236t7\333\236"
+	.ascii	"\217\346l\236\231i\314\274\302|Q\002\250}\017-O\376"
+	.string	"2\310\371\351l\324mw\303\\\306\225\367\262\b\205\304\330\"l\327\032\365\310\324\026\212Y\335\331\213\303\374T\337\033f\323\362\312\264\254*-\233\245\345\362\301\377\336\362\003\264\206\354\222\206;1\256\222\332$\242\2144\022I\304\202\377s\241\227\0071\013\210\370\342+\263\313}\370\304\353#:\245\bv7s\356\302[\252\177j\323\\(b(\370\324\255>8\351\n\202B\332\017\371\001\003\214\335mr\262\350\353I\027\277\036;%\032L:\343WJ\325]\335\363Z\230Wu\311\0332G\312k\032\377*\315ky\360xv\314\341;^\252\3566\341\023]\007,&\223\225'\313\233 \307Gg\243\370B0\212A\277\211\265\204\212c\323\372\003\213FE\342?\263\236P\217M\367\371\320M\325\255{\217\217\3439f|\235\223\354\341v\033\236Dg\241\230\245H\361\246.\316\214\377v\340\327\270\r\034_\207i\001)j\253\305T"
+	.string	"\260\204\t%\257\n&\024J\\\004j\350\254\345\225\262\314>\274.\310j3Zj\241\305\226\316Rl\263\026\303\\h\372\";m)j\253\305lgm\366\242\235\260\324v\272\0160\n\"\226\236-(\232\236,U\367{\303)6}\\\322\335]yq\216+\217N\240\2231\311\346jw\223\367\246\260\337\207\177\317?b\255\031:.\351,\324\312\030n\204\003\262\300\350\324\240xT\\\335\257\234\341?V\024"
+	.ascii	"W\326p\037\033\002D\250Q '\021R\004!\032\221\241\305I\332`\002"
+	.ascii	"!V8\017\020xg\f\031\306d\236\200\270\302\277\227f:\030\310\n"
+	.ascii	"\257@\321*\345\007\204\221\314{[\231%uA\n\020\224s\030\270g\231"
+	.ascii	"\322S\303-\030\371\031@@\313\f\r\316\004f\304\333$\243N\376z"
+	.ascii	"Q\030\343e\bkYoG\303\023\235\315\200kE\203\212*\024\n\226\032"
+	.ascii	"\"B\206,\354F\365\254\234K@6y\323\030\317\375\240\344O\236\007"
+	.ascii	" @\024\310\327\321\027C\206\232\220\3216Uu\371S\375m\025S\001"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.52.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\327\001\225\021"
+	.string	"f\340sH\340\320(\035{\346{\277\262\301\323\313\310 \211\234\360\276>\"\242\253\b%\211\225*\247\260.\2254\367\362\337\032\251\257\217L\277\314\344Fk\364)\222\243\031\346\201\022\266G\254\004\317\367\001\214\243\354\230V\240E\262\311\226)\005["
+	.string	"_"
+	.string	"a"
+	.ascii	"\263t\001\336\247Y\216\343\003\311\340(\361\351\347\300l\323"
+	.ascii	"\347\355\230m\262\002T\314\262\2178"
+	.string	"\230\0016/ZN\024\355\216\237\fq\331g'U\346\177\244$\200x\t\262\211\263\317R\207w&\021\203J\020\261\326\205\354\356o\256.\"M\365#\265\273V\233\030s{\267=\3016\004[I\0022\241&\331\364a\365\310\036i*i\354w+gl\253\247\247\356\246\372\236|\271Q\263\201!\203\306\205I\342\2612&\320\b?\3479\330u\374\036\271\223\303y\300\261c\337YI\3214l\347\203$4\362\371\0011\350\364<\276\211\217\260\357\254\030\0307\346CH#N\202O#(}z<\001\357\001\252\377\254D\204rf\275\305I\001\334n\255\344\223\205H\r\235\347N\301\305\214\236\233\364X#\242\257h\235p\273\341m\276\317U\240\3705\237\256\320jy\237\347\271\365\026\352\221=\361V4\264zd\322\343\307\210Hww&-\363.UG\217\215\232\356\260\217\342)d~\215A\025\275M\305\373\274\004\021\021^\320"
+	.string	"\245zP\342"
+	.string	"uZ\235\002D"
+	.ascii	"\340\325\tt\261\234|/\027\370Ja\275\276\024\024U\353[\271^\337"
+	.ascii	"\351\200A\013,\327w\001\004]\237i\f\337\255\234\261v#WIr\225"
+	.ascii	".\266\247\f\t%\315*\247|\013R\250I\336\2244\376e'gV^'\177s\215"
+	.ascii	"\261\201\304\214\210\3069d\020oF9\302\234\003' @\002\203\020"
+	.ascii	"%oN\310\375.\266\225\005\332\333\214\264DCj\023\006%Y\207\r "
+	.ascii	"\030\274\310\340\300\247Z\0070\007Jml\264b\244\031\026\210\001"
+	.ascii	";E\005\366M\020)\304u1L?\b7q\035\343\253\321\004\241\r\2074z"
+	.ascii	"\306\310\304\240\335P\353\214\265\202`A\360\206\254=\344\362"
+	.ascii	"\351\355Re"
+	.text
+	.section	.gnu.lto_performGyroCalibration.53.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\201\017MK"
+	.string	"*z\004\033<0\242N\007\223\037\243\204\020Q\267\007H\240\375\240\200#Q\334e\026[BcO\236\306\034O\004Yg;\200\002\b\241\037\201\201"
+	.ascii	"\320\273\273\253\030\024\b\312j\035M\3244\262\273\245\224R\237"
+	.ascii	"\001\206\001\241\001l\b\227\207kJLz\353\230\2608i\304k<\262\244"
+	.ascii	"\323\205^}\207\231t\370\262\270\3415!3\020;\001\026\341\031|"
+	.ascii	">\016\002Q\322\330u\20003\351x13\345\br\307\t\020\311\326t\247"
+	.ascii	"\267\321\024\331!V\237jP\016|>\201\362\233\206\3236 \023\366"
+	.ascii	"U\273\235\244\321.P\365\336+\241W\036\262\354u*\331Ol\373\021"
+	.ascii	"\3516\334}\026\332\342\240\271\3672{e\346\346s#$y\331\244WM\211"
+	.ascii	"\205I\243\204^\255\350\240\2537\037\221v#\344\223\334\350\025"
+	.ascii	"\005\212I\250x\215\275\362\215\336#\302\314\354ue2?\311\240\357"
+	.ascii	"\314\026\256\332\226\036\351\246\033\246\330D\304\262\327\t\215"
+	.ascii	"\240\355\314\215\327k\332\316C\322\316{\2630\316\271W:\201!,"
+	.ascii	"{eiG\261\275.\373\211\355\225[\346B\001\306.\030\324\016\261"
+	.ascii	"\214\257\361\336k\365[\370;)m^\362\266\237\234\234MM\246%%f\022"
+	.ascii	"\322R\311\256\311\367\226;)\r\254\237\234\270\264\223K\223\030"
+	.ascii	"\2649:ora\363\346L\311&\267$\2050_\322\242f\245\225\2524S\t\""
+	.ascii	"\313\230&\207\342\324\272tR\262\303\0324t\337\306\257\260\305"
+	.ascii	"\240Mq\244)\032\225\344\224a'\020\203\326\346\313\004qjl\255"
+	.ascii	"LFp;\204\322S4\266dT\"\226AmX\346lO\321\252t`\373Y\032\231\257"
+	.ascii	"k\235L^\030k\254\302\2246\226TjT\346\207\231&\346\337\201\335"
+	.ascii	"\302.\320\24185+\355J\020\367^v\2634\265f\250f\356\035\314\f"
+	.ascii	"\306\314\244$b\336\250;\260\273I"
+	.string	"\237\2250\216\325\250?\262\222\332Yl\325S}\223\211\251\360U\277\n\226AZx%\265E\260\025\336\t\311\324\204q\2106$\202\233P\027\"\301%Nx\233\235`{\265\360\005\350\n\323L\357tC\351{\002\347\230\210\220\265Z\020\212\345\275bX\334\214m\236\n\356\277\026\302\366\232\340\r\004\312\213z$7a\367\334tpj\247\273\t\331\223\252c\242\353\247{\260\247\004\233\032c\002\325\214\231E\003r\261\274\367b-\266y/x)\321\257\316\r\257\016\t\f\216\261\204S[pX\305\243\320g\376\024\013\377\336\013\366,\301\003\\4\260\223e\342\232M\367\234\342\340\364\372#\2634\314_\216\271;\232\006\307\215?\013s\323\371C\323\331C\323\271\203\323\231\203\323yC\323YC\3239\203\323\031\203\323\031\253\351|\005u:[p:Whi7\205\316\323\374l:W5\235\251\232\316\t:\257{\252\001\233\245\232\316"
+	.ascii	"\232\316"
+	.string	"QM\316PM\316O\357\354\364\316\316wnz\347f\323\231\351\235\227\224\234\225\336\231\311tNbrFZr^&9+\225\234\331w^\3379\311t\376w\366$\347\316\372)\212bv\324\007$\275N\"\035\335>k\0350\235\247\033Pq\312L6|h\370t\"s\217\326\303\335gE[_#\"\037h{#\366\350<$\001\244W\215@\230Y\037>=\230\231\207z\230\255\266\005\276A\003\211\314\302\347\\4\251\211\275\222a+\f\003\004\007\321\241\316\360\0320|\006\254\357jcP\344\020\256\305\345\260\024\247\211{\246\267\317\232\3241\321\3247bOE\377\026\251x\032\234\267\244W\372\347\262w\310|%\n\317|\345\237\246*$\245\016\351\bK\341;n\217\261\251\213m\354/\223\236\231\237\036\327b\271\242:\234_i\313Z%\355\331\031\213\364I\257\024,\203\324\340O'm\032\333fH\337\216k\342\256?\366"
+	.ascii	"3h\004)_\216\277\217\260\313o-N\305\253\034\341\256\343\366I"
+	.ascii	"\273\326\256\375\001:\266\352\342\223\347w\236\236\202\272\262"
+	.ascii	"\255\245\342m\366\374^\203k\303vR\025#Y\024\354\225\340[\037"
+	.ascii	"\307jT\016k\271\224+9oq\322\346\270Z\267\240\2579\224F7\274\032"
+	.ascii	"\216*8\373\312\267\366\312\230\243\355Pr'm\231'\325\233\264i"
+	.ascii	"\252\250\316\344\300\234\222\375&\253F=\322q\3753\263V\217\201"
+	.ascii	"+\2112C\224|\377\365\327=dn\377\311\3572\310\262\026K\307\221"
+	.ascii	"s\262vK\273\241\372X\353\245\303\334\177\307\361\260\366\216"
+	.ascii	"\312\243\255\036\003\007s\021\345OEW'\352\221\214\326\310\366"
+	.ascii	"\256\212J\327\220\255\036\203\266K?j\275HA\347\024\325\340\363"
+	.ascii	"\300\373\231[\273v\214\267\031O\211=\030s7\332\301\344\330\226"
+	.ascii	"\271j\317tc\233\306\212\021\203\3766\213\242g*\241\2319E/j\357"
+	.ascii	"\252\346\356\275\031\230\3335\255\250\325\243\232K$E\275\367"
+	.ascii	"ZQ\025Q\025\363\260\340\341\027<\311\227\243\372\004\337\265"
+	.ascii	"\027(C\266l\330\b\342\305z\351(2#\331\264\301\203+\207\327VW"
+	.ascii	"\216\026>\270t\004\231\321EC\007\217\031!\202\370\330\352\261"
+	.ascii	"5\204Kk\212/`\270\232\241\001+\303\325\263\306\263\211E\022\327"
+	.ascii	"xru\031\301a\345\325\305\345\345c\313\313\312\207\216\031=\254"
+	.ascii	"jtyY=\0070"
+	.string	"\327\217\255.\253 \\\\]VLi\264?\013\203\210~\030\334\023\200\017\004\374\310\310\316b\243\036\300O`\326\362\277,\004s~.\240\242\036\001]\336\"a;\231\360\356/B,\363\227\241\257CzOg\316\3568\241\336!\367F8\363\327\242/F\336fP\337\205pa\017\326Mu\375\364]{\214l\274\215\214/\307\257\307\257G\266\327\247g\n\304v\003/\313\237\372+\222en\301\332\260\376[\274\023\240\310\311_\363\345\330\331\372\303\323\340\353%}c\244~\254\345k>\370\365\241\351\346k\343w1\034\250\271\022Xu\303{\203\213.\246\2316\323\3131\022\243\022\364\237\321%\264\324\237Mh\251\017\301(\346\215\036\343\244\030D\324\037;y\357\275K\320o\300\252\226z\3507TUq\320\375Q\2412S%\247\3673tn\246L\353E\212\3453C\344\374\246wz\004\217<\274\363\037\b\226A6\177\351\233~"
+	.string	"!\246oV\265\207g\3726l\022\210\332\002\303"
+	.string	"\365A\206ux\017\034\276\303\006\016\207\034\302\307\210\331p\250'L{\327r\300\264z-\370\345\303\322\267\034\272:\213v\200p\374\244a\336\250\322mh7\307\261\032m\031l'r;\346]d4\251\r\250\212\036L\0215|'\262\226\323e\035\230\013\201T\250q4\346\224CC\"\"\"\222$I\032\003A\005\304 e\2413\017\021\3604\207\024S#3A\222\2440\215\001\214"
+	.ascii	"\221<\245N\276z]\003v\374\264\250\262D\034\356K\223F\341\300"
+	.ascii	"\020\007!\313,\352V!\177\267|i\356\fg\013\377P\343\214Oza\313"
+	.ascii	"\225d\3603\t\246\257)\215\206\2145C3\247\256`\024\235\025\227"
+	.ascii	"\202\316\206[\f\33666\257o\264\210\336\240\"\201\311\212\r\370"
+	.ascii	"\356\340\020\332$]\371x\303\334\020\344\242~\315Q\247*!\026("
+	.ascii	"\245\257h\241\242\256\243\313\026\376\232\021D\341\226f\f\256"
+	.ascii	"\r\276B/\312M\367\026\016x\307\331\227j\317L\372\271\332\201"
+	.ascii	"\230\370\227:HC.\2515\036\302\002\343\024E\216\335\005-\251\354"
+	.ascii	"\316Wv\377\007\270\313\263\177\324)\252\3714I\002\037g\004jK"
+	.ascii	"\344\367\177\216P\364v{\350\226\207\271\273\311\227\0072y\231"
+	.ascii	"=\220\n[\"\235\322\347oY"
+	.string	"Py\354\032\274U\336x\312\343\006\220\250\253\2062\327\245C\007\006\325\200\236\306\244\247 \263\001\306MA\235t\205\264\003E1\001\234\276\b\330[v\306M\257\331Hi\375\223\"\364\315\343\365@\027\216\177\310\\@\b@\267'\024\261\351\276HX\035I+t\253:\221\241ga\034l\0130=\203B,\273m\321~/\021\214\307\341\332\2437\037\234\200o\2702/\001\240\316\207\360UN\020n(\326\201\306dz\311\t%\207J\206\020\355\221\r\306\244\204\363F/\264P\216\337\324\023!\207\254\f\f\030\030\305)\321\212\241\370\003F\237\213\207!l\275+O\254uo\006c\360R\216i\3035\325\367\265l\370\344\243\207=[6\327\3507X\026T\372\025\260\261\326\236d\3203"
+	.string	"h\236\202\007\376\021V\216\221Ek,wG\032Q\204X\034h\311vOi\363\003\t<8*\033A3\017\215\202/\332(\373$\226\266\204\334\2221V\3223\303\375\357\366|\377\374\211\276\324\314\n\325\322;\263\032\245\265"
+	.string	"\037\244\332\373\303sH\242\307\303\240)\377]\233*\"\205\370g\026\202&\006\021\317\226n\242\257\353\235\230\227\270\247\221Zq\333\3537v\346{\306\372V\355\340$\350\357\003"
+	.ascii	"\007\327&1{\020\304\350\250\002h~0\t\203.|\023\201\321+a \023"
+	.ascii	"\210Uc\f\242\207\301s\344M}A8\f\002\347u}\256\260cC\2248W6\250"
+	.ascii	"\013\272\370}w\2240\261\210\206\306\037\022xmZ<X\340\0247&\255"
+	.ascii	"KnYf\250\251\353\250"
+	.text
+	.section	.gnu.lto_gyroUpdateHealth.54.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\027\013U7"
+	.ascii	"\372\\x\024AP\246U\007\377'%5W\3508\361\177;\031\350\326\032"
+	.ascii	"\277>\272\343\"$\320\311\036\267\363iP/\013j\267D\241\331(0M"
+	.ascii	"\023\021M\222\200\270\342\335\223*\246\310\020m7\022\244\377"
+	.ascii	"\357\277\367N2\2452\001$\001:\001S\355f\332\321\232\347m\021"
+	.ascii	"\315Y\0166'\211f\257\336\026\023;e\211J\274\336\272K\233W,\233"
+	.ascii	"\352.\223\365\313\323\354N,\\\302\304\345\034\225\362\266Atq"
+	.ascii	"\313\324\343\356\007\021\222\036\345\321\344\210\332\312\354"
+	.ascii	"lx\275-\206M9\356\36627K:\264\207\003s\016\313\343&\347h\261"
+	.ascii	"\027\274\336v\324\205\256\267\257/\271\336v\262;P\323\217\254"
+	.ascii	"5\305e\254\353,Q\316\331\370T\372\235\215z\017q\322\205\301%"
+	.ascii	"%\340o\330KB\332\371to\316m\331\307\311\366\034\025+\305I\233"
+	.ascii	"\245S\313\205Y<\230e\332\304\202\227\256\270\022Y\363\n\006\262"
+	.ascii	"D+,QZ\005\377\330_\316\331A\316\231\t\036N\361\032\363^\030\227"
+	.ascii	"\352\240$\326\202Y\230*>m\202\261_\346L\035W\343\004\310\232"
+	.ascii	"M0R\216j\207\307\334\347\304uN\310\232J\360K\326L\202s<g\027"
+	.ascii	"v}\332\374Bs\314tr\341\226@\024/1gY\341\036)\200|\332\024c\243"
+	.ascii	"\300\362\024\3419}\340\3479\177\260\304\234\263K\035\013qna\234"
+	.ascii	"\243\31297^:\275\274\231\274\333\221t\267\213\356\335/c\313\377"
+	.ascii	"g;\017W\301\263\220\276\371\300\213Z\301\037D\323\374tzU_Z\335"
+	.ascii	"\221\256?\376\"\027\330\026\276v\267\n\217\203l\207\223\374R"
+	.ascii	"\365\002\323<\313\365\326\277\347\006U\342k+\370Ch\232\327\270"
+	.ascii	"\227q\242\233q7Y\302\352\262\273\205\267\251zs\316\022\330$\277"
+	.ascii	"\274h\335 \2656\2602,\336\266\367\210\321Y\357\023\257\002y\342"
+	.ascii	"\034\234x\242\304\214\032\243\201\311\212\254\0313\352\216j\341"
+	.ascii	"\177v;\266\002\226\247H\177X\267\321\317\274\243<\352\256\340"
+	.ascii	"\200C\335\r<n\242\247\361\206rq\017pq\013\300\270\237r\270\003"
+	.ascii	"\344p\003pq;\271\270\233v\270\231v\270\207/na\213;\250\303\275"
+	.ascii	"\244\303\255\224\303\r\314\341\376\271\270}.\356\336\213;\351"
+	.ascii	"\305\215\364\342\346\275\270w/n\335\213\373\315\341\316\345p"
+	.ascii	"\273.\356\326\305\315\272\270\261\213\333#85\222\3621\303E\313"
+	.ascii	"S\243y\310\265Qnk\341h\3614\356g\3059S\355g\332\3254\257H'\315"
+	.ascii	"\321$=M\317!\372\210f\347N\332\244-\257x\275%\262\305\264J\277"
+	.ascii	"\364\316E\006\365J\237\233\323\365H\315\230i\316Y\013\351\237"
+	.ascii	"}\\)\024\253R\275\f\201B\344\311\356\237\215uR\216_)w5\356F\270"
+	.ascii	"\306\260\331I\371\201g\266\373\200\337\275\001\347'=\376{`\020"
+	.ascii	"ML\334\013r\342\321\375\263\331\374\367\036e\203?:\376\236\251"
+	.ascii	"\211\357\033\r{\357{\207\343\340\213z?t\203V\251K\332@_oo\322"
+	.ascii	"#}o\221\037\362D\0350\033\"\314\006{\317q\275"
+	.string	"Mz\314V(\r\351\241\3260\020\214\f\\\356\237\315\373\335\277\265\350\326\016\0167\210\204\257\361\336\341\004\241\355\336I\215\371\245\304W\177p\347\216!\367\237\255\373\367\257\244n\315\300\341:P\350\366\340\200H0\020\323\275\205*p\224\376\226\374\362\341m3\236\343\261#\346\027UI\324\373\231\337x\242\254\206@ \302\251$,\210\225\360?'\214Q\377g\313#T$S?\272||\t\252\205\320\034\230F%\322v\356\367\034\207\271\367\036\032\2306E\326\236z\221c\204\375\347\365\352G\327\375\253n\024\276vt_\310h\332>\236\240\034g\277}WK\341w\330\017\272A\323\376(\232\272\221!\001X1t \331,\344\210\f\0320\300\3001\003Y\005\303u\201\254\032\201\304\201t\3616\204\t\021\220\025$P\210\320\240E\203\037\211]\267h`u\265\343\205\021\353\312\n\253F\025\226\261F\f$\rc\213+,c\003"
+	.string	"me\243\352\312\210\303\312\352\312\310\213f\377\260~\251\204\332\224\277\325\302\001\377%\340\007\274\253%\311\340$H\001\037\244\352a\006\225\244\374\002\227\031\033\220\201\023\237)\345D\352\332\323wc\300Gx$U\341\226V\342?\275w=R\342\253{d\351\237\254\236:?\232J\037\326|\374\350\006 \022\340\375\314\r\n\364\243\013\340\377M\272\206\233G"
+	.ascii	"?\300\r*\365\035\232\231\033#\277\177JY\351\031\277Y\337\201"
+	.ascii	"\207z&\324gh\211D\201z*%f\344\356l\3169\017\215\357i\234\310"
+	.ascii	"\300\241\336X\344\032\023\305\370-\356M\242\036N\243\276qz!O"
+	.ascii	"M\357\364X-\003\016\322\364OnP\345\2308EV\341\220\261e\222#\227"
+	.ascii	"\3412\375N\313\312\207\315\257W\227\341\016\237I\370\3037n\371"
+	.ascii	"9\363\310L\370\335M\205\201tHP\305]L\255\241\245U\211\177\230"
+	.ascii	"\020\2763\277\226>\352\203\357\\]\2607\0367\200\333\250A0\006"
+	.ascii	"\025s\246DFD\222\024$i\f\200\002\221)+v\021 9C\222\211\214&\205"
+	.ascii	"\264\237\001<a\214|/\f\303?\377\312\3361\013\245\223\\\315(q"
+	.ascii	"\221V\032U\373\354\316t\232:\214\026\026\357\300\243\341\270"
+	.ascii	"ES\261\241\373o\310\020\265\020\331@\343\271\255\320h\213\342"
+	.ascii	"\3046d\322R\002\253!\277y%\0245\017T\026q\257:\t4\306K]q\301"
+	.ascii	"z\267\251\252\370T\360\244\372\200b\265\342c\016F^\376\251\331"
+	.ascii	"t\24532~$\304\252\367\3404\271\366\210\274\337}K\005$=\304\036"
+	.ascii	"m\276\246\031\322\240H\017\340k\353\272\341\013\223\313q\241"
+	.ascii	"\270\270%\240;\026-K0\321,a\210<B\b\312\027\314\333\217%5#%\222"
+	.ascii	"\234-\275\251;\032b|\332\200gSV'$\372y\264\251\340i\271\261D"
+	.ascii	"\210<5\212\302\306M3Z\250\266\021\377\225\002\017|\r\201WU\267"
+	.ascii	"\230y\204\265)\024\241$\314Qr\027\314\341w\220\201\326A\331\256"
+	.ascii	"7\241\310\205\216\257K\355\004h\330\265\241\003\211\354\255\314"
+	.ascii	"\207\344\311C\t\034\027>;\002\314\354A\303\321t\027\222\017\307"
+	.ascii	"on\303\213+E\335J\320\324K{\006\335.\201\315KJxxR\f\021T\360"
+	.ascii	"\273\213\364\340\313OpR*9r\223s\2019'\330\214/TFA\342}\223\261"
+	.ascii	"\3626\262\002\236\222\002\312\304h\227g\347\204\255\214\007?"
+	.ascii	"\252O\0305\333b,\311\361\203c\351W\251p\023\240N H\315y\302\335"
+	.ascii	"\001\247\300V\r\255\307\241fU=\312s\273\207w\350y%7u\312'\206"
+	.ascii	"\246\235\210a\317\341A\213\237\3039\241\207\265K\251\366`\307"
+	.ascii	"\276u\266\353\t\013\374m\306\177"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.55.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`S\004%\034"
+	.string	"\026q\257H\240\230Q:$\307b&\351\321\023\002\275\244=\256\234\207\325QQ[-,\262\345\210\303\362\242\031\b\3706\315\326\254\354\361\210;\230}\301O\254\201Wx.\037\275O\312\323\023\373\351\232\036.\323\226\237\263^\315\022B\366N)\230"
+	.string	"\223"
+	.string	"\241"
+	.string	"?\017\305|\024\030:\274su\245\326\021\254_q7\007\317I\013a\005\3501\362s\372\240\377\373\023\363\300\030'\260\353d\205j\367\234\340\b\262\223>\217S\236\224\275@y\322\246]\346\347\323&X\002F#\252\270\273\265Z\3044M\2234/\213\225\344X\251\351\317|\272\313\030\bYbz\354\307\225\222V\371\035\323\311\033\337\f\031t\244\340#L\2705\305\327\343u\224"
+	.string	"\244\313\016\232\2177\342\204\031\342u\341\351\r\237\022\2451\r\273k\332\363-\335"
+	.ascii	"n\273\206m\020\366\210\0249D\273\350T\214d\273\0334\345h\305"
+	.ascii	"\201'$1\312\223\2579\\\300\035\r\363\205\237\r\203T_g\226\202"
+	.ascii	"\331\247\022\255D\354S\"^@*\256N\366\214\372\346\300\177\006"
+	.ascii	"\200\232\224Q\2171\352ZRS\222\372\006\024\264\021jA-YS\267\316"
+	.ascii	"\305\021\266f\261H,I\374\250K\3314\347\016\345K\251>+%@~\273"
+	.ascii	"K\363\207I\3432\t\233\266\360\234\254a\371\031\351\207\271\003"
+	.ascii	"\223\022\234\273\3643m\316_\361\244\037\225\263i'\357C\231\264"
+	.ascii	"\036&?\366\205\016!\312\233\232B\310\305\243j~\341ocXu~\231\331"
+	.ascii	"I\031\304\271\204\330!JY\304\267\214@\360\264\313\013\322rD\302"
+	.ascii	"G\222T\236\274\251;\\\300K\035\205U\226\224\223l\266\210fV?\274"
+	.ascii	"\316\216\202\271\254:{\350\260*\310\327\251n\227\270\025\322"
+	.ascii	"\202\247,\002\210;\3044\020\272t\034J\261i\306X\006\315\024\013"
+	.ascii	"P\236\317\252m\342\004}\317:2\252\316\227\332b\223e\2554MP\325"
+	.ascii	"He\255)\204]<\252\306\003(\255~\255\025(\b\257\352\354O\341\036"
+	.ascii	"\020{W~h\035\311\364x\330C\257B\024*8t\330`\273\345\214d\256"
+	.ascii	"`\001h\bC\320\005 \037\"\237\001#f&\362\261\335rF5\334\315\206"
+	.ascii	"kQ\204\253\265X1\304\242Ft\303\325|\024\330\346\242\350V{a\263"
+	.ascii	"\335j\264s\367\352d\r\273\252\364*\262\307\256\336u\2571\367"
+	.ascii	"UY5\341[b\202YS\266i\003\333=\327\362T\016qw/\330&\223g\301\300"
+	.ascii	"q@,\036\375\262\034P\262\232ML'c%\353\255\320h\263\243aO\016"
+	.ascii	"\306\f\312|/\377\262\201\203\020}O\250<9\326\fF\272\232\270\\"
+	.ascii	"@=|\240\357y\254\272\357\356\222\001\\\250QD\345\230rdDF\244"
+	.ascii	"\2408M\007\220\002\231\261\262\016\021\300\271*\243$\306\354"
+	.ascii	"\0336<\"`\357\205\\\264\207@L\302\036\331\025)&\241\023\262j"
+	.ascii	"L\321?\303\336\372h*\242\337NI\\\261Q\316r\2747\332k\275\206"
+	.ascii	"\354\b)\347:X\241\251x\311:&\230\247 |-A\203\342\"\036'\360\r"
+	.ascii	"\262#H.\360t\240\334sv\026\272\211\377}\2466\240\215\247@\335"
+	.ascii	"\224\362\27693\2218M<]\277\370\251\035F\001\341\315\232\260e"
+	.ascii	"o\252\226\241\342oA=\244\026\362\321\017|5\341%\344\323\020L"
+	.ascii	"d\234\373:\022tv\322E\310\266\022\376\r\222Y\223\260\264T$\357"
+	.ascii	"\241\277\350\302\316\300\324\247h9j"
+	.text
+	.section	.gnu.lto_gyroUpdate.56.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\353\001U\021"
+	.string	"f`qF\360\360$\035xn\352\027k\b\215\020gH\214\002\f\233\f"
+	.string	"{6q\f\237\317OJf\263\210\026`\340\210\244\311dhbH\225\366\\\370\265\330Z\034\fhjPd,\371\337\310<\003\267\222w\315F\332\336[\246\024Y"
+	.string	"X"
+	.string	"a"
+	.string	"\323\bN\237\036'`\372\224\027`\372<\312+\273\305\301\326\026\360qY\030\242\261\273Y\344\340x\t\336RW\2372\352\312\307N~.u\276\260\363X\237\262cw\003x\024\244\210\326x3*A\340<\036|\003\235/E\347\341\\\261\223\335\265v\336\315m\272m\030\333\013l\r\t\357>\375\030\323\247-3A\337\331\203&\262|\242\027\f%\216\034\221\027\222\322\352\222\r\2624\362\330\377\356\256\343\216\215\375\273\365\352\237"
+	.ascii	"\204,\274\013\031\355\332\20466i\036y\370\367\333\007\261I\371"
+	.ascii	"@>h\024\b\206\324\203.\264\372g\244\357\315\376B\313\247\206"
+	.ascii	"\213\335\375x"
+	.string	"\032f4\364D\361\222\241\264\361\204\215\016\264T^\244\rp\225\270\211\025\226\226\226\242\356\005\247\241\204\223\260Q\211kwMl\227\023iYkwI>G<\226\2508\3424\364]\257\0311\356.+\372\343\377\356`\003\247K>x\031\224\243\305\300\364@\037\2129\355r\357\374\020\027\261\371\035>\r!F\003NP2\202\242\200\304d$\325\261\261D@\221NIi*\231\225lSi\333\213\312\226\275\260\240\270d)\252-K\031\260\366@E\225\301h\232*C\201\373\270\343\323+L\342\342\2149r~\376\017\257\0333\362\030\325\023\2618{\364\343\032kB\256\221\301\n\032\25513\250O8]\272\224X\374w\017\220k\304\342+\004* \200\0021Ud\007\005M\031\205\346>y?\320\036WI\026Y\023\370ha\230\302\332\200\r9Q\\\031\256\234a\241s\0234]\\\200\b\371\300\016\222\335\254\301\0202lK"
+	.ascii	"%\017\263.\204g\255\276\032~\312\216\321\3260\231\003\002\217"
+	.ascii	"=\315\320\367\212*3\215\033\330\220cog@`\312\246+?\001"
+	.text
+	.section	.gnu.lto_gyroSampleIsDue.58.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\264\001\205\021"
+	.string	"V\241xI\320\224M:\024\306\001\254\200p\"\341\304@\346\205\b\353)6]m4k\316'\260\304O\365\205sV\200\373\320\342\002\357[\003!\031\273\006D\223\200\2539\370\305\210\360\356\2752\246g\350\207u\0206J\004pZ#\233\354\235Rc"
+	.string	"a"
+	.string	"f"
+	.string	"5\257\321\270d7E\315h\267\\1\003\325k\312Q\272W\356\006\272W\333~\320R\343\361\245\217\316\001 \027!\206\236vK\217\266\370\370\312\3219\372&\244\315\253j\347\334\204\023GLM6\310\235S\256\001\317Q\t\001\344\214CQR!\344\266\317\034\022g\316\324\313\356z\322H\022ww\333\026lo\260O$FPN;\221\330%\316\244,\354s\273\273\246+\354\227\177\352\265\277z\232N\337$\001\222\215I\b\350\2076\225\253\023\225d\223\352\016\030\266o_\250\346d\345\203e\337F\003D\312\254\\\362\204\251\210G\320\323\356\256^\215A\265\352\301\242\3633\312\031(\243\335]q\005\325\353*\007k\316\313\360\203\036#v\231f\212\230\365\354\256\2039u\030Q\352\341"
+	.string	"\334L\214\200r\372\330\371E\2771\372?\376b\346i1\335\353\002\237\"'r\032\262\364\0274\236$\352\261\233T\203-\310l\036\261\375:\021\007\225\0376\3547P\201\317\356\314e\3505>\370?\257\026e\363\264W_\326\275N\252\002\244v3\243\034\"-\335v\223\333N\"LL\006~\260W\254\244\025\353\360Q(`\b\254\226\226\004\227\b-,\003D\230\017\366\272\020\223\371\302P\346\n`\027\013\030\316\304xb\b\2122\237\350\311\274Z0\317\025\212\036\013\002\203\036\276\320\213\201`\350\235\330vys\216;\275\355\023\305\255\210\036\307)\315\261M\251_n(N%0S\324\316\320\242\034\265q\245\001\036"
+	.string	"G\r-T\366\234s"
+	.string	"\f#dC^\233\025Y\233/\261\334\f+\201+GH\361\260\013Q\3306\203\325@\025G\334%\023\341%\350l\006\0013"
+	.ascii	"]&#w\204e\243%RD\301n\220\250\r\325\316M\361\244\232\254\350"
+	.ascii	"RP"
+	.text
+	.section	.gnu.lto_gyroSamplePush.59.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\201\004\035\037"
+	.string	"\366x\307I\220XN:\200C\352\312\344s\343\\\345\306\303\265\255z\272jb\376\276\023%\004\302\016\322\256=S>\247\004\003\333\3721r\313\344\373\276\2217\200A4\225\001\257\005A"
+	.string	"\177\232\n\r<\013\245\tx\245f\257\022B\366\226;\311\257"
+	.string	"\250"
+	.string	"\267"
+	.string	"\037\314[\334\016\035\363\207\374\363XE\317\032\2527x\336&"
+	.string	"d^[B\334-o0o\3714qL:Jo\204/<\221\242\027!b\231{\245\210,\271\367\204\300\r\314\333\232\323\220\267\3657\362V\002N\021\033\375\244\242Q\340\212k\251\210v\357\231\353\036\334\257\347\231\244F7K\322\326\246F|\340\321\315\3425\220%!\n\323\244\232\202/+\201{\357"
+	.string	"\340R\215 \203\222An\334~\353\016\236\272\f\265p\001o\274\336\027|W\007Pa6\006"
+	.string	"\223*\215\225\035\\^<e\002\"QZ\346\334{\231\376\200Mg\2313s\017f\336a\256B\001mk\332W\002\202D\327\274|\336\001l\216Nc\266>\3615\276s\275\213E\315\253\370\207G\377\273\345\363\310[[\323\224\005\263\350\032\277x"
+	.string	"\306\034g\332\331\245j\314\347\021\355)\346\037\013M\207\0227\017\346\233\245<\363\"\277\200\023\3176\246l\336x.-e\262\244lI\312\225)\267\245L-\345\027@"
+	.string	"fHF\274\352j-\347\245\261&\346\212\331\257\0377\376\304S\346\343~\350~\344Z6\034\220-#\203\325$\235\027X\016\275\240\b\321\356\275\"\314\333\363\265\212\370\303\027\331\206\303Q<Q\250\336\340m2$bB\253T^%\004\277JG\207\274\265\235+\373\362m\035\257\272\357\275G\026\367\033\177!\312\267\365*D\312\3468d\347aD\272\247.V\367^\335\024\022\267z\342\202\026\345R\206\310[\003>\236l\216B\306\356\327\237\365\232k\375\311\020\315\226\0373\303\270\023\0226\254,W\240\204\367\336\nM\016V\202_u\313&N\234 o\207\314\250\246\005a_\204h;Q>\252\3063]\373\305\033"
+	.string	"[\032\343\243k\254\340B\244\255g\232\351R\220\032\235j\244\235\335\337{o\235\241\314=;\372_w\367\021\013h\025LDg$E\335{#P\356\236b\005O@\322F1\244\222D\303\360\003=\237\030<5\005\317nE%y\002\005\034\036\013\272\n87\004z:\273\037\237\021\273\026@?<\275"
+	.ascii	"\334s\303\013\032R\221\353\005\361z.v\275\234\013\037\236\237"
+	.ascii	"\\OP/ws\200y@\273\240\334\013\036/(g;\357\233\007\277x\352d\354"
+	.ascii	"*\177#\222\273\3334\233s|\215d\332\034\231\214\221]\326^\277"
+	.ascii	"\263\254s mMv-*A!\235\352hd\254\354)\2261\263\267n\263\212{\331"
+	.ascii	"L\020^v\006\263$\032FM\252\354\034\037U{%o}\343\203\227}\353"
+	.ascii	"+A\325/\307!c\266\263\260\022\004\035\216\005\004\206'/VW\310"
+	.ascii	"j\361w\306\314@\267\302Jr[\230=\\\f\004\003\252Y\250A4\245\234"
+	.ascii	"2\314\314\bID\232$\351`\002\231\261\273\016\020pWTPHcA\246\027"
+	.ascii	"^3\327\356\006\355\364\025Tr,\261\210r\363+\324b]\266\204\201"
+	.ascii	"\377\034C\316\353\257N\024'\261\022n7\276\221\013u\311\352\356"
+	.ascii	"V\350\2161\030\002\376\247\236\r\341\322\323~\260\200\307 8I"
+	.ascii	"\300\237-?\343\273\376;\037\204)6\001\304\271\250\300\326\276"
+	.ascii	"r\2719pY\005C\252\204\030p\321 \231\331\211Hbm\346\357\353g\020"
+	.ascii	"\b\037,R*5\307\300gY\031i\205\207\355\317:\252\364\025\003K\274"
+	.ascii	"\217G$\321\230%\330\346\312\023\327\030\004\214\355g\2742\225"
+	.ascii	"\200\032b$\246N\303\252Bp'\005\231E\306R\003"
+	.text
+	.section	.gnu.lto_gyroSamplePop.60.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\267\001\205\021"
+	.string	"\226!xH\300\020)\035\n`8\306\364g\243\273\260\256\322\346.\303\375\240Dx\263\323C\202\340\207\037\312\342f7F\241\032e\323\251\255Oi\337r\243\266\256\242(\n\363\237\260A\272\\\211\215\263\001\310I\242.\307n\263\204l)S\nb"
+	.string	"]"
+	.string	"f"
+	.string	"i_\304G\320<h\346\005v}\210\222v\303\005N\260\372\347\360\037\340\277\325\r\200\377l\333\344\204\306\265\207@;\036:\0279CP\273aK;\274\366\250Y\363k\036Q2\340X\321T\204\343\271F\223\"\334Q\007\316\026\005\204\200\001\342\273\247\016\356&S\245\262\273\316\033\016\303\375\335v\004\333\020\354D\020\237\201\377T\372\321\353!\221S\376\356"
+	.ascii	"x\032\222l8mF\331aM\352\217\375\270\273k\365\261c\232\365\240"
+	.ascii	"\177\365\360V9\035cZ\277t\306\364\003"
+	.string	"\314\240v,\340~\324\264\2733%\265*>\245\017\017\177\233\306\337\2315\322+yH\373\342,-\247{!c7T\360\317\017V#K%\031\233Q\024n\324\002\002\264\273)\376\211\243x\371\271\177f\201\345o0\220\b\246%[\354\356s\376\f\370\257\243\247\304\322\324\357\356\301\"'\207MN\031\3444P\245,u\346\364\330r\312\311\343pAyRT\230\241\372\243\022\204z7y\303\304\313u\200\007\221\247%&\225>|\210\315\205^\"\026\362\234'\314\362\267\177\016.0\227L4\203\006'.\007()'$\004^.1/\256\031\350\025\222\230\214\306\322\232\311b3\230\327\254\005\003s\275\264Vd\263\026\311\001\307b^\262\226L,&k\261\302}\\\365\261\213.\212\207\244\177\r\374\356+)]\f\036R\37250\252\216\355\250V\261Q[\024y\252\241\232\244F7\247\257\200*U\215C8\033l4\230\002\036"
+	.ascii	"\227\231\"\370x8Y\320*\273\242f\332\260J\020\002\223-\355\020"
+	.ascii	"\215\254MR\312N\217\007\033)k=\306\354d,\301\361\006\316\026"
+	.ascii	"T\266\2401 \304SC\252:\242\225\231Ce\313\341\232\310\263p>!\331"
+	.ascii	"\211\312\032\252\312)\272\324\036"
+	.text
+	.section	.gnu.lto_gyroSampleCount.61.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"m\007"
+	.string	"\022\31624`O\322\001s\210\f\020\363\004\360DL\200\013\223\334\254\031\001\301\302\217%\203 \207\030c\354\242m\364\266\022\001\004\301,\352\366\370\320<1\200\037\232l)S\n\346l`\244\032\336\024\341\344\351L\317\343\300\360\3608qz\233\002C\210N|\021\020\306'i{\267\nr\232\241\320\313\251W\247\267"
+	.string	"\271\264)U\300\0379\211D\346!OPy\354\221O\001<\272j<4Jr\263\264\261\371bkV*\207}\267\n\262\235v\231\316L?\032`\teG\331v16\230]\211R>l\177l\311\b\t\037W\004\025V\213&$\346\302\304eW{\332\361\352Y\371\027\371\302\245r\202e\3263@aw\235X\226q\353m\033\330>\260]\022\f"
+	.ascii	"2\241\215\037x\307\204\005y\2401\236\3502T\323.\214M\303\310"
+	.ascii	"\022,\207k\316$\314'"
+	.text
+	.section	.gnu.lto_gyroSamplesDropped.62.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375 \374\355\006"
+	.string	"b\31504`m\322\001"
+	.string	"-2\312\"\231&)\374U\200\306\200-\310t\360\263a@\223\206z\217\211\216\305\324\205\361\020\004OP)\004\354\257\031\352\\o\020\331D\312\224\002\276X\036\324$\270\b_\314`\242\313( ,\270\013\214\3162\340\307\200\201\256\341=\350\250l\257\240T\212\245\036\373\033\317*\377\302\232M\376z\3637\323[\352\304b\302\312\221\251\317&\211\235uR)\354K\253 \333\351\324\tH\007vQ\310n\304\250d?\232\007\206m\216M\371\241gp\\\0358XX%\004\361\3001\262\2339\312\005\2467\351\001\323\233V\274zV\3765n\340\021\211\\X\347\tP\260\273\316\013\223\270\365\266\tlWl\177\002\b"
+	.ascii	"2\001\0038\003^\034\240kxo\204\313B\220\341\256\230\332I\006"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.63.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"e\013"
+	.string	"\346\023LD\020\311*\035"
+	.string	"x\240N\005\233\347 \233<\240?\350\340\206o4bU\324\324\254\271\007\302b\212$\240;\205\233\371\356\\c\004\211q\240\312\246\001"
+	.string	""
+	.string	"A\n\304P\304\234B\006I\300\312]t\253%d\357\224\0027"
+	.string	"7"
+	.string	":"
+	.string	"\346\211H\r\302\356\202U\345\250{\225\242\374\233g \313\324=\223W\357\241U"
+	.string	"\247)Y\036\005.\206r\363t\244\\Q\252\200\261\273\246dYr\177\267\235a\233c_#\237\177\302\374{\335\254\314Ttg\216\256\205\301R\t\366\231\2425\305\276\267\273\353\352\262O\375O\323"
+	.string	"V~\301\201]\222\335\204\275}\tXl?c\224\375\340\347k#\002\262\327D\025\271]\325\311"
+	.string	"\245\213\034\255z\"\244\246|\233\316\205\342b-\004\325$\314+\007\315\001\213F\260\035\376$m\354\361"
+	.string	"J\020\257\335\265x\371\f\304\207\375\263\351DO>\366tB\321\004\002G1\034G\237\021\034\2056D\240G\034\301\216\204C\217\217\b~\204\241\bf\316\275\267\325\345\005\235yS\325\225\347@/;\001PC\350\003:\256 \367\317V\272\001\001\017\027"
+	.string	"3\241\315(\006\352\203\311m/\304\032\007\342\r\304\026;\314\"\020_\250$\001F"
+	.ascii	"_0 \017Ue\304U0\021^\216\316\246\325r\031\372e\bq\351\246jg\212"
+	.ascii	"\246\240"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.64.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\235\007"
+	.string	"\262\01656Po\322\001\200\276V\250U{\256,$B\017\3375$\225^\315\243\022G\371\204\240\326\273\021\332\020.\362\255\211\f\"\345R\263?\266\002_#\303O\266\266\355\226)\005\376x\242\0245\300)\343\f\201&\f90<\300\217\234\320S\340\b\001\222P\"F\t\253m\237YW\2623\300\\\205\355\210\223X\034{~d\202\200ew\023\376|\221o\024\276\307\237E#}\366\347\217\034\247\345\204i\312\325\306*\214\275]\3528\354g\326\225l\253\325\001\270\234hG\231\354b\244bV\345\245|\330&\331\225o:\b\311V\307\002\273\016L\032\027%/\273\013\003>\240\371\323\013h\376\\\307\255\253\345?\344\013+(\224L\273\256\033\205\335\265fZ\306\355n\033\301v\307\366)\n"
+	.ascii	"\032\013-\264\030\314\020\237\257{\333`\227kxo\204\313B\220\341"
+	.ascii	"\256\230\332I\006"
+	.text
+	.section	.gnu.lto_gyroRateDps.65.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"%\f"
+	.string	"\306\027T@ Q\\8\263\016\nF\202\260\250\200KS\301\231\210\004\304D1\240\240\360\013Q\225,\234km\311\256\331\217mF\266\263\251\237\005\001\241\024\025R\217&\356\361\235\021\262\310\027\034U/m\"eJ\001@"
+	.string	"?"
+	.string	"C"
+	.string	"\273\273\300\t&\267,\225m\037\344#D\036!\310@\n/ \037&\021\033\273\253UN\340\272\225\037p\335R\020\037=G\376K\034B)UC<\205O\354\301\356:\305\023\207[o\373\200m\215\375.\250\315\033\366\030\246~\260_\255z\260\235\306>\376W\225\2564\255\232NM\177\022@\306\214\323S4v7\224\340\330\027\026I\b\333\"\233b+\350\220e\332\0179\t\321G\2730\200]\224\210\026\001\252\207\241!U\342\316\302#\232\315\336|\005g\353Hq\025\235\316\223\027=\252\361\b\261\375\035\205G.\035\273\233\261?\027\361\n\304\330\335\315\304OP\360?n\031\f\345\305[~\350\272u\275x\220\220\262\304\224f\320"
+	.string	"\3039\3302\230\254\002v\026\270\312\233\314\373.t4\360\363@\020\007\324@\035\367\3216\037\250e\006\354M\340|Z\005\317\3734\312\2707\246\026\222\226\\)\2467\345\020\220\252v\004\t\327\305J-\0304t\3525\023"
+	.ascii	"\2059Efh0B\324\256\006\206e 4\004K\302\313A@uj\214m\226\r\202"
+	.ascii	"\215\330\264\3325Q`\026\373\005\023\004\2340R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_gyroSensorCount.66.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\025\t"
+	.string	"\026\221?90\345(\035\036CI\213\01353E\352\207C\213\365a\263\334B}\320\340\321\262\357\320\2765\354\017\304"
+	.string	"\bf\217\251*\310\b\301H\226\362\177\243$\320\344C\247mdK\231R/"
+	.string	"0"
+	.string	"/"
+	.string	"\327|v\367\257+\244\310NR_\351\360\342\n=+\223\026\347;\301"
+	.string	"\027\r\331_O\325\207\312\324|v\327\231\372,n\355\266\023l\037\330\216\005p\225e;\235\231>\344\260\254\276\313Jv)f"
+	.string	"\026E\213u\330&\331\033{\020H\366\006$J-\006/\217\211\221\227]X\324\215{\207\232\236\003\332J\255P!q\351\275\314\365\001DVP\tc\377\343 \236\317\341\210Q>u\315\037e\256]\005\\\030\246\234y\223\261\031c\303J\251-\373\001\006u6n\304\020;n\353D\241.\212\032\026\034\"\210\353b\207\300\333C\210\213\020\333\306\305\rl\257,\247\376^&\363!OUi\201IO\020\006\f"
+	.string	"D\b\030\230\2004\300**#\0215E"
+	.ascii	"\213B\200\256\341IX\2747\004\001\334\205S\n\005\005"
+	.text
+	.section	.gnu.lto_gyroSensorHealth.67.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\025\013"
+	.string	"\326\024N?\020Q\225\016`\230"
+	.string	"$\344\374\247\013 \305H?F\371\327\210\330\312\\\177\013"
+	.string	"\327\244\330\276\277a\3542~"
+	.string	"#\035\344}\001"
+	.string	"\224\n\311\340#\245\225\t\0161\210b\034\203\3646\022\262\345N);"
+	.string	"="
+	.string	"8"
+	.string	"\327\036/\260]\323\023\017?U\206\376[\327^$h\270`.\304\316g\351:\t\264\200\021\022 ~\246D\225\222\275u9\022ARv@\330]K\221\030\342\326n{\202\355\b\266m\004 \304\307\230\355\222f9v\206\366Ba\233cC\354\bl\242\322^@\341\234\265\261\356\226\220\361bw\2248\362\270f\333_=\005\307\241~\byL\fV,\017,n\354\216\235\307\033\330\002\273\236\213lp\203FAlw+\327\256#M\340\321\317\234\212\222/\251P\245\324\233M\252\232p\325"
+	.string	"I\034\206\230V\312\354\261#\025e\177\256\236\354\263~i\351O\315\bR\2364\240X\036T\034P\270\0137\200\003\206BF\002"
+	.string	"_8\357\353P\241\003?\017\314`\300.c\301r\241\273|`\307\035\260\207\001\363u\032<\357\353 \343~\256\236,\325\017\267"
+	.string	"\"\244\277\"\003\202X\016"
+	.ascii	"-Q\260\212\242E\274\367M\220\244\002\254\2522RQS\343vB`\256\341"
+	.ascii	"\323Y|\3451abu\325\224BA\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterLpf.part.0.98.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\324\003\345\032"
+	.string	"\026\361\250H\260XQ:\300\347\357\355\321\036\030f#\231\277Zi!P\264\020\266\267g<\316\320\365\215y\275N$MV\355\247+\232j\344 \344\354b\303L\337K\013\b\374\016\261.\n\335\201\361\002\3578\223\020\006K>\331d\357\224\002\215"
+	.string	"\224"
+	.string	"\225"
+	.string	"\341<\022?\340\301\375\210\315tW\251\214\205\333\237\204\020\224;\003i\207\3115\347K\277\310\215\340\376$\364\001\2739\246|\273e\316\253\031\214\257.o@|\035_@|\265O\304\366\r\3116\230\227;\366RD\216\222T\355.\371Ju\230>,\357p\342^C:E\234\277\352\211\272\0020<\335n\3505\024\260\2735;\243\320\301\214\261#\232\341\324\375\240qz\337\303!_\246\350v4>\t\\\\\365\354\256\307\244{u\333-l\343l\332\013\341\264x$\177\r\247\303q\232\216\323\363\345\377\232\034`"
+	.ascii	"\245]\031\3013\273T\237\3708\324\337\373\223\233\203z\210`\030"
+	.ascii	"\205M\274Pq\252\332\242\022\3076\315A\024\206Q\016\207\204-O"
+	.ascii	"G6\354\373\2753\361}n\371\266\243\304\365\336\241\374)\336\224"
+	.ascii	"\224\243\204"
+	.string	"\370\342s\"A;\023\327$.\255\351C\335\374(\267|;\257f\244C\341Z\257;C\\\366\227\370I\256\004w^\355\246\250\334\235\007/a\234\252vK\234Wg\030_oB\337~\304\366re\364p\005@\307\322\341\274\035\273;\341\303\257\200p\001_Gz]R\245\"=\r\351}' u\224\206\006\203_ NJ\251\347Q\r\242\031\264-\342VF\214U\376\363y\301\346u0\361u\322[\351b$7\203\266\371\t\321BOww\210\322&\3338\"\226r\323\214\2430\325~Kd\304\3741\3216\361)\261\003\300\335\215\340Kq\201\302\347!$\276\222\3001\271\031t\315\017\210\226\235f\240\330\276\215K\313\340\025\366[2a\206&\232I\233L\305/\315a\263X\323\343*>A\213\261\360\tW\320b\265 \233\006\333\353\007V\013\202\315.\330\264\300P\002(E5\004\t<>\024\"L\340\321y\351\b\330"
+	.ascii	"\300/\035\331\314f\202\244"
+	.string	"\315d\264\037\030\215\374\211\371\250 _3\032\251\223\3002 \330\214\\!\223\315\310\226\355\371\250\217?'Xr\224\310\364\257\264\311-*\312\242\225j\342|Ec\344|E+P\025\3152\276\357\365\006\323\212\366\344\302\335\335\220E\337\373M\203\257(\213\376\205\022y#\310\201\031R\221\216\324\336\300a^\347\233\027t\310~\026\0256@\235\355R\250a0\206\214cDf\202\231\221\251\005\326\006P\002A\314Q\361\021 \256d\333\354\237\001\265O\305w\177\030s\231\220\327\265\bM\367b$\020\323\262\227\315]\210\221\215\263\021\252\267}?k\256\234\r\317\324fPm\224to\230RJ\rZ\025xY\006\264a\336\"\270\212\224\344V<I\240\272\342\204M\002d\2768\"\013\034\262\207U\247\243-\306\306\344I\302\367\001\323\363\255\367\3347=A\216vQ2a\367\206cj%Pp\033Lr\031\325V\227e\034\0351"
+	.ascii	"\362\252\221\032\204:n\017\230\233\363{\346\267\375\325\374\013"
+	.ascii	"C\007A\026\301&\210\244%,?<P\001"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.114.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\364\023]V"
+	.string	"\272\211T\036Q0R\312I\007\227iU{\331~=fo\023n'\271\307t\342\344\352\204\374!\022\323\306hm\210\225\365K\254q\r:.3\376\255\364\270\231\251\271\020D\001\b\2020F\020\004Q\351n\246\316kw\254\364\253\034\035.w\257\246Z1\264f\t\2212\311\310\001\265\001\320\001\2775\266E\227j\263\216rX\372\332\317\366jgj{.\357\222\336\313~\321\362a\t\233#k\340\367\223h~\247\367-\273\350\376x\332\276\207\326b\233r\036\246\314\212\004KW\230\342O\243\332R\217\317\303\217\233M\375\016OI\226f\207\037\273#<m\321\034\330\354\270\310j\255ho\177F\265G[t\251\236\005\310f\375,E\177\036\211-\355^\313^\207cI\237\005\b1\210\262V\365\312\204\301\221\245\2515\253\370s\021\200\273Y\252\233\225"
+	.string	"\244\254[YG`K\314W\356\257\274,\275Y\t\317\251\265\311\226.\265*\221~.\213\337\317U\276\247\367\363\367\235\336\317\335\217\355.U\326n\272K\304\225\311\nD\303\232\243\2264\265V\343\317\226\301\024\362l\337T~\205\316\364(\206\204\202N"
+	.ascii	"\375\370\364\360\354\350\344\f\205A\234\033\024h\363\363\365"
+	.ascii	"N\263\231(\335kU\035E\n\257\255+\037\"\223\263\201\205\306\036"
+	.ascii	"\204\303O\230-\354\274$\361e\026\016f\017\221(\310\313\335\300"
+	.ascii	"@?c\367\361=]\0058\261\035\320xmEy\317\fd\300\230\007\312w\302"
+	.ascii	"\256\023V%\353\t\347\370\236"
+	.string	"\310\374\027'\366\206\306k\013\312\207\346p\231\2254\225j\255/\260\320\367\344d\253\353A\256\343p\215\201\201o\270\353\250\222\003\225\270\3006)\274\266\222\374g\266\340r+\362eV\022\263\207\f\223!\336\366\024U\262\220\260\317,j\322\245\346\313,)&\261\r\356\210j\035\271g\022\261L\"\332\221OsXk\rj\t1\225x\210\326\025\233\214\244R\344}\266\237L\302\212@j\0259\353\234\310\367Tk\335[\225}\213\276\313\027\354.\t\273:7\001\311#\240z\346N-\310;\263\203\316`M\271\272[\340xI\006\216&\307\221\230\263\203\372\231\244\331\307\003S\343\356>\277\034\361\2548\357\350D\3508\233\214]\007~\346\201\243%!\370\020PNs\265\326\246:\023$\330C)\241\367\223\373ltjV\234\267)\234y\201SsWy\r\367\3276\321k7\331\305q\343)\310k#\310\353\224\303[#\310["
+	.string	"\r\033^\002|\2743P^\031B\336\030(o\223\220\227i\t\310\013c\310\373\"\310\353\342p_%!\257\021\345M\022\362\"\241\274GB\336b\013 /\213!\357"
+	.string	"A^\001\356\3665\002\362\0060\344]\021\344\005@\310\253\002\345M!\344%\002y\213\206\274DA^\024\027\363\035\262\341\025\262\341\r\262\341=!\344\005\372\t\362\372\004y{\202\274<(\357\316\327\276:8\2749(\357\360\206Wx\303\033DyqP\336\033\224\027\005\362\002Q^\033\224\367\207\362\372\200\274=\224\367DyM\224\267\201\274|\345\177\nL\261&\204\\\265\022\311c\242.9\325\244\374\354_\373\305\374n?\334\037\367\335=\335\276`\242\332\036\304*e\222\310\013\246\037\333\003HH\233\301S\222\t\261Q\311 \312\342\356\216\260Q}\202\020\253\030b\2241\303b\302\370\363\267\373}\234\\\031$!K\217+\203\204U\346\2044bE\330\301\221yKb\351poJ\274\2315\355"
+	.ascii	"\261\267)b\356\266\037\263\350R\205i[\252\270\245\213y\230\375"
+	.ascii	"\017t?\274n\325\243\220\024\023c\267\266\3640`\302\200\361\301"
+	.ascii	"\307\260.\353\265\310\304z\260\253U\351@V\234G\305\005\247\350"
+	.ascii	"\"Z\332\20547\024C\312\204x\354\252%v\212~\372\305UR+?b_K]\327"
+	.ascii	"\262w\305\313\246\250y\212\016cr9\nKIe\330\024,\r\013\353\375"
+	.ascii	"<\362\216\250\213\272'w\304c\301(z7\225\222R\351\035I\324\304"
+	.ascii	" ]\365C\3211\350\324h\360\"\242Y\341\355\327_\273M\016\324\""
+	.ascii	"\274K\235\222\241\276\230S\260d\371\211\017\243dJ\003\203\245"
+	.ascii	"b\306\241\346&\220G\332\236\223V\227\004\256\r\356\350\353\257"
+	.ascii	"\276\303B\327_e\255\265\327\243'\324\025`\t\352\023-\324?\026"
+	.ascii	"\371\005\355<\265\322\003\352\023\375\243\032{1\223\324\312\036"
+	.ascii	"\312\2467\244c|d:\326\373\t\324+\300\220$\353\214,\317\376Z\033"
+	.ascii	"3\375\323m\206\213\327\351!:m\200\231 \274\304\032/\235"
+	.string	"~\2622k\255\325\374\351\257\235xt\235\376\351cq]\331\231Y\343\323G[.<s\255\005y\327\323<\355\323@c\260\252\\q\336\025\356Z.w\343\202:\227\271\236\276\033X\331N\363t\177\301\262\263\212\200_X\300II\216&\027\240\220v\332\t,o\331\357ZkU\367\327\356\026k,\261\3425{\266\233b^\034,\261\34430J5wD\036vN\357\3360\200\217\\\030K\204t\325.\267\300\343\207<\222\343\310\b\324\212\234>\267 \217\b{\330G{\316\226#^\3363\350\005[\330\313G$W\b\360V\002Z\301>\032X\231\030N\023YA\205\233F\033g\b#\031\205\033`\243\034\204\217\214\305B\370\373\245\367\023H\305\006\211\255\270\212\353\257}m\203\327\004\023\277^\373\220\276\204\232\007\216\226\006\312\251\227f\246kyv\022\013\030%\0258\0229\210\002\253A\007\037\354\300!\305#\004\0176\300"
+	.ascii	"8\265\001\t;L\f\f8\340\306oa\304`\3321\243I\006S\222\005IC\007"
+	.ascii	"\200kAR\224\024\220\f\214SRQS\037\360\2302~\260\301\216\036F"
+	.ascii	"\013\244\246\214IA\033\005\002\017)c\bQQRF\364k\325W(\200\230"
+	.ascii	"\265z\331\370\331\355t\340\274\241\376ba&\350\251\327\364\301"
+	.ascii	"\3214h\310\321\350\307\t=\365\343h\364S\335\233\215\016b\271"
+	.ascii	"\020\315\355\246W,\007\244gN\016yg\243\215uJ\0049\265\217\034"
+	.ascii	"\362\256\006\027\3205\216)\n|\244S\303MP\224\344\267t\310}\220"
+	.ascii	"\221\252\300@"
+	.string	"\244D\236\245F\377\204\002\272\bLm\256\316\210%\236[\021\262\023NN@Ka\321\342\266\036?\002\372\207\256L\016\rP\023?\215)9\303H\332\002\030\0377s>\244bF3\372\310#h?\374\364\327\362O\361\227\373\211`\215\301\353)\036G\017Y\037\027\334\3242:F\313P\213\301\324MI\270\013s1!\025+r\037\275\237L}\267/=\375\265\350\223\235\245>\237\f\213WR\"\243\324\207\343Y\352\303)\365\222\231\021;0\270x\213\016\246\271\036^4\214\366\311\271x\301\345\242m\320]\321\351\257e\031n\354;I36\221\227e\316\003K\254\310\334\274bv\324I\215\324IY\220\332\006]Y\261\217\224\260\016\305>\020tec\313a\177\025\237\004[\364\232\350\21562\032\363\223\005\243\276[[\025Qa\020\266\350\273\031u\213\263K\235\030\022^A\026\315J\035Mf\0034\213\366\235\021`\200\264\212"
+	.string	"\375,`jf^\3135(\\8\375\265\374u\025}'vuV\226\354\305\302\222#7\375\265\f,\376c~#XmQl\212\277\321C\026\r"
+	.string	"\211\307pX\321\001"
+	.string	"\260\002"
+	.string	"\240\212\032T\364\020\030\222\201\251\250a@\005\231R\"\"\"\"\"I\222\244\003a\005\304 \345$<n\021"
+	.ascii	"\255C\016\321\214\210H\222\024$\303\032\246}O\036\335u"
+	.ascii	"\263\027\223\b4x\314\324\1772w\"\024_\253\007\320\203B\230\003"
+	.ascii	"R\214\270\370\224\226\b8\006}\237\223\323\244\214\244\203\022"
+	.ascii	"\360\022@\271U\027\267\0032O\337\263p\017@#m\277iK\374za\227"
+	.ascii	"\321\226qs\003\306\333\023\263\224(\001\370UN1J\350\311\024\021"
+	.ascii	"/\266\006O\212B6\232U\220\273\236H\204m?F\362M2\307O\016\307"
+	.ascii	"\371\f\344\372\2157I,\247\tY\363\254\211\243D\220~\2077\033Z"
+	.ascii	"\341\025\024F\205\210\336\346\253\274\273L\036\376\005\266\340"
+	.ascii	"\202L:b'6\206+*\002\203\020\033I\265~D8\256\343\017r\204\030"
+	.ascii	"\346\005\211\323\261c\315\244|\351b)d\351\237*Cb.\033\0308W\306"
+	.ascii	"\341\350\243\272[\2670@&\200\"U\316\343\313&\222d\204\004\240"
+	.ascii	"8liM$\352\f\277\304\265R\241\254^\177v\202\317\351/_\r\302\375"
+	.ascii	"t\3578\356\353{\313\203\b?\035\312\006\200\330\026\223<\242\225"
+	.ascii	"\325\220\217\203\222\207Qz\364\020\"\344\201]\203\023\024\326"
+	.ascii	"ml|\302\301\364'M(\256\222JA\242\261e\222\025\267\341\020b:["
+	.ascii	"\277\317e\250E+W\224\211\223\357OZS\351\210\240\330gQ\343\223"
+	.ascii	"=( JN\177p\025&\214N\342p\026\274\320\353\205\256)\333\262V\240"
+	.ascii	"\241&\275\2630\365\373\277\rxL\216\033L\343\3220k\037\304\023"
+	.ascii	"\275:\361\f\374\t\353D\310\221\301\327;e\242*\227\3116\\k;\031"
+	.ascii	"\035\326!%O\246X8\254Lh(\250\344Q0^\235\325*\312c\300@t\365\232"
+	.ascii	"\214\224(\027=B&\265\222a\225S\n\267*\276\017\276\371L\377wt"
+	.ascii	"%C\013\230Q\023\002\252\035\306a\"\267-[\334TT\302\244)\327\227"
+	.ascii	"@\306\2537\223G\305\237l/\372\331<\322\242\317\341L\363\335O"
+	.ascii	"e\302\203\370\376\321\347b\312\206\3706\327Y&E;\3256\202q#c\212"
+	.ascii	"N<\361\234~\243<Q\364\323\003\2718k\374\035\222\r\243c\025.\330"
+	.ascii	"\326\253J\270\243)*\317\326xx\270\225\242\274U\232\344\262\350"
+	.ascii	"\316.l2\225.\344\251\r\234\240\272\224\345\324\0339\002\276~"
+	.ascii	"8\243\227j\026hu&\217\374\302\022n\365*\267\254 \363\250\340"
+	.ascii	"E\374J\222\t\006b?\300\3154G\034\3322\306\347\321_\360\006\334"
+	.ascii	"A\007Np3,&\365x\025g\231\371=\366\262E\n\342\255\366\367\344"
+	.ascii	"\024\262\331X\233\275\200\305\006\354\005\313eH\260y\025\327"
+	.ascii	"\321\3609\016T=\310\030\245\301S0c\f\004\236\302\342\254D*\331"
+	.ascii	"/\225\330\235:|\261\340eT?w\272Md\341\241\fc\352\246\357\234"
+	.ascii	"s\362\025J$k\\\266\03057\211w\225\024Q\027AO\224\220L[\216\311"
+	.ascii	"H\220\t\332/\302\373\211f\032\221\205\216\330\371(9&9\252\355"
+	.ascii	"|O:\233\035\226\325\250\022)\353\307Z\344lk\f\242|N\336\235\301"
+	.ascii	"\235\037"
+	.text
+	.section	.gnu.lto_gyroSampleIsDue.part.0.115.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\032\003\325\026"
+	.string	"\206j\223I\300\224Q:\264\210\034S\322?\306\016\201\355\3003\275\204F\212B3\035*)z\362SA\230\312\355K\357?}zt\204\265\315\211\312\264\375\371]\032\003d1\246v\221\2521j(\276\266Eb\r\327\324\333F\b\331D\356\224\002{"
+	.string	"\201"
+	.string	"t"
+	.string	"*r\276qy@\254\034/*?\372)\256\244s\0259N\355v8\"cwW>\215@\374Ty\001\360\363\373"
+	.ascii	"\360\323>\n\267\270n@\266\335\342\3221\356#\322\017\001\023\""
+	.ascii	"xV\030\331\035[\237\n\342\270\203\363S\031\342\374\235\203!\214"
+	.ascii	"\004\037.\202\364\3606|\312\036\236\320?\025O\350\032\200\267"
+	.ascii	"\373Tv\367N\227><\235\224(\017C\230\335\2658t\213\267-\263m\301"
+	.ascii	"\326\007\001\007\360\231HqR\264\373\023\225d\215&\r\022o\372"
+	.ascii	"\323\315\263o\211F\244\240\335\310\362\213\303\260\361\314\300"
+	.ascii	"\210\024t\242k\342\221\344Q|\357j\3376oa\345\375H*J\332\335\325"
+	.ascii	"\375\336\315o\272\223W\276\235i\t\347\036Z\214\357\351\254>Y"
+	.ascii	"@^\354\263XQS\331\215\313[\371p\201#\311\310\356\262>MA\374\364"
+	.ascii	"\215q\244\206\235\321\356&`=\275|\362LK8J2v\307\025G\020?\245"
+	.ascii	"}{\240T\325\220H\206\022:\031e\273\302o\310\210\273\353\342\327"
+	.ascii	"\270\215\227?\342\323\260X\f\374\224z\026!\224\364rww\024\007"
+	.ascii	"^MJ0\t\331I$\366g\234\006\316\037\341\031\231|\217L\035\204 "
+	.ascii	"\312\311(\337\351G\032R\244\307J=\212\361\367.%\224\277\364\347"
+	.ascii	"$\2245\324#\373\337\352\007\333\322*K\247>\376\242J:TI\203)\351"
+	.ascii	"\251\222\376R\322\232\222\016\265\030\333\315,F#\263\245L\254"
+	.ascii	"`\201\353\325\300\205\201\213E@-&F#\233\360\262]\210A\260\325"
+	.ascii	"\304h\264\033\030\212a,3Z\316L\253F\233\325jb\265V\215\354E\323"
+	.ascii	"\202\321j-\226\024\3170\304h-\333lFk\255\376\255~\340\320\033"
+	.ascii	"z\232)UY\245\206\311\251\016\324#\313\017\324\333\340\031R\322"
+	.ascii	"OC\365\261E\r5\245\252\204\347\304\201!Gz\254\204r\250o\272\214"
+	.ascii	"QnN\005u\344\230\372\035\237\352\247)?x\226\310\313\004; p\002"
+	.ascii	"\0312\244\007\302\001\016e\277\356\201\214$\006\326\004v\351"
+	.ascii	"q\244\345\003'\007`a\311\354\275\ra\f\345{c\224\344\354\230\306"
+	.ascii	"\305\320\352\340\354\300\306\f\035N\272\243HV\374b-)\214\375"
+	.ascii	"l\n\"T\234\341n'\361\244\350\240\270\376{\022Ob\235\255Dd[\023"
+	.ascii	"[\220x\212s\3660\261\341\302\035Nfw\337\332p\026%?\007\206\255"
+	.ascii	"%[NM\261\365\230\337B\365\260\253\201\200\224'1\344\335\300\341"
+	.ascii	"\275\336\300\023\002\036"
+	.text
+	.section	.gnu.lto_gyroSamplePush.part.0.116.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`8\002E\022"
+	.string	"vavI\340\322&\035@\033\024a\264\030A\216\003\343K\021\013^?$\347\250\200]d\030\214\006X"
+	.string	"#8\240\245\302\233\262l2\314\212\035\350\032\313\264\321\341\030\036\b2\034K\236\354\270\313;\034*\353P*P\353\2074\262\367\336)\005]"
+	.string	"f"
+	.string	"["
+	.string	"\362\242\237s\035\331wb\006\331\235\311)\332\025\023\030A\367*r\003\334+=\001\356U\332\376\013\217\250\302\026\333\036Q\311<\273\270\302V\340\346\006\242\247\307\256\350\275N\025\237}J:\363e\315%\345\363@\247:(\222\220\222n.$.CNM$\273\353\256\304]o\373\201m\013\266\204\t-\206\204lCdE\\\027\023\217\020\216\235\320\275\336\037C\377\347\267\003\371\3440\f\277\023\353RZ:\243\233\333\216\2172\277\347>>\275\242N\370\\\006H\367e'R\320\021\216\013\t\335+*\305\312~\217\017\343<\262\307\340@\367E\334\021"
+	.ascii	"\220\204F\034\324\253#t\257\026;wpL\206X\221\331]\005(\226\325"
+	.ascii	"\f\257q#\023\237\205_\237|\355\343^?A^hr\311\007\372E\370\300"
+	.ascii	"\034\371\340\261r\326\314\220R\311\337\371iR\311\223\316\032"
+	.ascii	"\373t'\215m\351i\222\226&\351s\364F\207\200\230]\333\322\217"
+	.ascii	"\225\2514l~\373\177~\242\177<\265\357\023=\310/\362\311\241["
+	.ascii	"P6\253\023}\364\207\002\240\313\003\213^`\2652P\316\013\030\250"
+	.ascii	"X\016V\rT\251\001`\205\326\313E\241\245\001\345\305\002\003\270"
+	.ascii	"$\365\301b\030<\020\366\201'-\320;q\261^^\t\f\364R\007\374\241"
+	.ascii	"\264`\336\206\357\203y\247O\232\020\351\317\2709Yl\317i\022\332"
+	.ascii	"T\231\020l&\306\2353\006cr\254T\262\2347^\343q\023\356S\316\177"
+	.ascii	"\210Q\221Kv. `\"!\352zA\303\027j\300\333\020.\315\350;\004I\254"
+	.ascii	"}\253u\325<\212jW\212\325\244` \340\353u5\200\022\025o\370N+"
+	.ascii	"@\305\236\020\327\275\223\203\275\353\3002\202\222J\232(aC\231"
+	.ascii	"\250\035\030\317@qq2\006\276\240bN\334\251\346v\235\260\177e"
+	.ascii	"\272\277\206\265\373\n\013\246\bQ\031F5\020\345\201M\235z\355"
+	.ascii	"\034\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`2\007\225\032"
+	.string	"Fj\234Gp\234\326\030A\261\3232\266\305\261`\223-\371\336\373\237\204\301\340\224\023\217\001\232v\230t\236\361\317d\345\244\345v\254\033!\020D\316\022+U\252TS\373\277~\227=]\2579\026\024\332r'\360\nm\232H\231dJ\001\214"
+	.string	"\212"
+	.string	"\211"
+	.string	"\177$\361B#>H\304\003\205\370\005 \376\007EY\226]~\370\036\017\177"
+	.string	"\355\360\0068\274\317\206W\200\362RC"
+	.string	"\277\273\273\273\313\360\bP\fO"
+	.string	"\275\360\003|\200h\3132\261\360<\025tT\n\317v\250\263\023v\324T\302\263\230\b\317aP\266m\335nzv\242\020~LLE}\300STfnw\371\263v\013d\355\313\301\017\031\227\370\211\232\262,\313*}\001\036\333\266\354\022\346gv\373\321\350\330W]W\322\023\241\314\\\003\024\317l7\236\343\262\236\253\330x\206\303z\226r\365\034\245\306\263\234\362\331J\362y\316\352\371\215\306\363\225\252g,T\317t3\236\323\232\231\231\2132\236\325:\006\2530\004\250\314YV\312\344\024\362\005Qe~R>E)\245\222RVN\310* nW\307\224Qu\361|\206\f\252-\236\233R\317fQ\317eP\277\304\342\225\236>i\305#\241\254\223P\005"
+	.ascii	"\325M1T\333\214\f\330\016\024\177\224\236x#\023_\204\016\371"
+	.ascii	"\342\204\255DP\3146\202\351\221\345\330s$\223\212\231|\233\235"
+	.ascii	"pd_\307\236k\275\315Z\350\264p%\365|\353\355\"\023\254\214R\317"
+	.ascii	"[\214\331|\246\256\253\311R\317i\230G5\216\365\354_\022\036r"
+	.ascii	"B\356Xn\343\230\341z\016\271_\271\255c\347C\215\310}\347\355"
+	.ascii	"\035$J\274\034\335\207n\221\373\372\2667p\277y\233\333\352\212"
+	.ascii	"\314\031\271\323\274\315^\210\220\2051h\357gP{/\237\337f\237"
+	.ascii	"\321\376\031\312\326s[\216g7\034\317kZ\001\334\314N\217=\336"
+	.ascii	"G\032\355b$\310[\202\224'\206\303\343<\2610\033\2437\261\350"
+	.ascii	"\355EL}m\263\023\375\246\355\356\021\235\246e\242\267\263\231"
+	.ascii	"\213\035\330\313Dg\n\352x\013\207\3364\364\325K\230\376\234A"
+	.ascii	"\241\373\230\215\276\215\331\"\204\321\204\316k[\230&\364\237"
+	.ascii	"s\r\372\332\372\232\235\002\203\036\325)\373\006\375\3476\201"
+	.ascii	"\236\363\362\031\320s\2325\253\373\312V\267y\273'nL\216\315V"
+	.ascii	"\367\271\335H='\272\305gs\250Q\f\004S\245\031R\220\222\244\322"
+	.ascii	"\030\340\002\231\252M\033\021\300\220d\b\021\241!dF\202A\321"
+	.ascii	"\003\200\335\224\bM\r\006\035Y\334\txD\224)\245\242BYkj\332\353"
+	.ascii	"\232Rza\335\226\336\b\267S\271>Q \266\261\362\343\204N\257\201"
+	.ascii	"Ma\004Cm\235\216\252\301W\323+\332\220\304K\251$\330\360t\f#"
+	.ascii	"\232]\"\025YP%\251\220\205*\221\312\362?9\niB\324\346X\304\223"
+	.ascii	"@f\3379+\320\322k\257\204\233\035(\237F\272\343Z\351\336\337"
+	.ascii	"\245\231\261\275L\272\022=\302\374\215\013EG\3719\357\353\254"
+	.ascii	"\247\336\210\017\227\377AK\tJXR\210\006JL\361\004J\"ld\005\031"
+	.ascii	"\206\017wuH\003^\203\215\235\270\026\334\177\214\033\240\210"
+	.ascii	"`\206\262Dt\002\023Y2-H\264\005\325"
+	.text
+	.section	.gnu.lto_.refs.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"m\b"
+	.string	"6T90`E\223t\336$\213Y\004\3020\f\303\260\350(\212\242(F\261\030\017T\003T\361\355\367\033^\037P\375\375Jh\215\240nk\355\023B6\3312\005*"
+	.string	"*"
+	.string	","
+	.string	",?\037;\324\003\310X?\206\005\353w\326S\260\276Y?\355F\336\350\007h\377E\376\235\374\t\3269\353\241\\\261!l\373\255\b/y\377\336C^\245\266\346}\345=\345=\301{\351-Y_\362[>\200C\3573\027\300\b\244\243\303\200\316\242\236\321\020\376\344\007\217\323\0276{t\345\266\340\216LP\225\376\270\3076\002.\265\036q\335\271\376\310Wm\312z\271\017\nz:\034\023'\370d\220}\362\002G\240\004>\344\250\225C\210\216\017o\272\312\035\032\272\334\fj\214^\350J\001\2170\335\221\3715=b\326\344\226\251K\231.\311\207d\372\302\004\016"
+	.ascii	"{\210\021\363\360\3368l\226\337\247\020fv\330\272\370m\254'\f"
+	.ascii	"B}Q\t\300\330R\232\264,|\254e\017"
+	.text
+	.section	.gnu.lto_.decls.c2f916ca4449eec7,"e",@progbits
+	.string	"(\265/\375`\361m]\316\001:\362\276\245S LI+\215\001i\025\301\300\316\252\232\177\232\352\316\037\244\200h\340,\310\264\211\210\211E\263\b"
+	.ascii	"\340Wj\222Ev%\r\0217\270\307\306\303\377b\344\230\215^F\325d"
+	.ascii	")y\304\341\354\202\237m\237\252\324\213h\333\373\264\350_=\177"
+	.ascii	"\322\210\310\275\267\224R\246\353\bf\n\265\nJQn>\272\244\347"
+	.ascii	"\314\335r\311\340\263\246\021\254\246\232A\356\231k\306\256a"
+	.ascii	"&\234\216\321\344\007\232Kx\007\255\332=s\005\177\261\334,gn"
+	.ascii	"\363\006Z\273\265\275\235>\340\202\373\023\034\254\001\314s\323"
+	.ascii	"\322\371(\223\376Y\030\b\bW\bC\307\315\327\357\376Y\265\313\335"
+	.ascii	"2XW\214\260n\376\t\250]\330{o{94\275\034\372\263I\346\277uW\313"
+	.ascii	"\355;\351\314\240\340n\346\253)D*\223\344\346\237z\372\036x\211"
+	.ascii	"\202\353bEL3o\2579f\3677\034\342\336sbpb.\230\033\346\356\335"
+	.ascii	"1V\355\352\335\273\337/\027O\357r\371\033N\022s\033\321\300G"
+	.ascii	"\325\027\226Ny\231\203\273\311?\331\264\245\262<\350\2063\375"
+	.ascii	"3L\377\344\322?\215\350\237W\372'\020\215\355,\017\272\200\034"
+	.ascii	":\333Y\036\364Q\354\016j\231v\007\265\202\001\214\311\025\337"
+	.ascii	"\315?\225\364Ah\273R8F:\033\351.\312\326\336L\023 \334\270\033"
+	.ascii	"\345Ja\346V\372\304\252\255y\251\\\271[\305\252\335\270+\345"
+	.ascii	"W\355>\211\273nw\n>k*\341NJs\357-B\004\007\021J/9=\235\377\013"
+	.ascii	"\307v\241\\4\255\204$\313\353\346\373\326\363\013\267\200\254"
+	.ascii	" a7c\273\203\376<\322\317\201\372YO?k\321"
+	.string	"\0360\223\212\366@eyP\234fw\320\333dw\320\233\326\344\206j\3575\245.\256\301\333\344\242\345\266\252\302)7\237\021\227r\004b\271\371\231\251mY\326\027\020\257\262\255;\204HX\225\025\331\326\rr5\266ev\311\356\330\375\272e\027\3542/\223\033v\227X\265+v\225\374r\335\256#H.V\021\260\033D\210-\304I\322\331\333Jlk\357}\305\256\021[\210\317\232D\270\323j\212]$7\t>k\322nwG\232\"D\324\034\271%\271BA~&\323\351\266<\350\233Yw\353z=\301\273\272\3719\207\276Z\317hT\030\360\221\016-o7?7\351\347%\375<C?\307\320\317IZ\003\273\203>\033\351\022\206\372\230P\2379\250ogw\320\236\236_*kFxv\345\346\3430\372\204\263;\350\361\234\276<n\017\253\206\301\215\272\t\020\216\215\320r0\030\202\031\022\336|\f\247o1@\355\241\305"
+	.ascii	"=n\242\217\217\350\253\343\267\206\366\360\346\270A\363\242\312"
+	.ascii	"\220\233qd&W`\276\334|\334C_\033w\306]\262vky\211\226&\333\213"
+	.ascii	"\313e\331\032K\272\234\265[K\241\204\256\211\3647k\267f\267\226"
+	.ascii	"\3245\367\336\377\357\215\333t\235\356\323e\262j\327\306\215"
+	.ascii	"\361\253tex\360\367\\\033"
+	.string	"\027\306\345L`\331Q8\270\367\276\241\342\005\005\306M\376o\215\337\245\377\032\335#\234\257\036Jp7_\032=\2775n\342\342\216\254n\276\231A\235A\023O\377b\321\277R\364\357\023\375K\246\001\260-\017\212\355\260\364\265l\313\203\332\300\331\035\364\264+\374-\032;\345o\367r\361\233\032\274\371\227J\337\330\0354\303\226\340\355\340o\001\255\2315c\251*H\237\252\234Q\331\366\217\b\222\323\315\226\331s+\270\2036A1\367\332\336;\007\303Y\201Qx\363\257\223F\355\016\372;Cg`\332\0354\203\235\335ivH\231L\371!\204L\237\225\273\"\243q\263\335\263c\254Z\007\313\307d\356\275sp\320\334\3310s\363\357\2216\301\336\266\003j\017\017m\007\364\267b@\350\244\270\266\261\233\177\033\306\352]%Tmbn\006\303\301\002hM\374n\276\r\324\267lU\310l\261A!\264eQ,\034N\022s;-"
+	.string	"\315\230\t\020l\027\213\305\326\341\0301\267\r\023i\230"
+	.string	"\007\315~[v\333\305\242\3315\234so\252\302\337\336Y/\026\317~\261vv\213\315\263\\\254\232\355b\255\334^\261s\317\314\275\223\366\336\267S\250\234\361@\316\302\341\020\367\256\352\333\332\233y;\366\367\334v\261q\026\316\203\214\275\253\246"
+	.string	"\200\244\205\211lpo\246\b\016\"D\210\270\301B\003\212\223\206l\353\256\245\263Zn\353l\226\233"
+	.string	"\3417I{lo\246\255\313{\037Y\273\001\216\265\033\234rG\216\232\240\371vM\3372\265\265\263<\250\007\273\203\336r\351\333!\372\026J\337.\351\233@\337\316\362\240V\212u\263j!\354\333m\233e;1\211\271\323\366f\346\020\363\312\370X\273\371E\3726\004\232sxxxhC\240g\241\263\335A\217\202\326\300\362\240\266\211M\263j \354\223[\246=\373y\304\334\314\275\23197+\r[\223\233?\202\2769q\353\344\025Tm\020\276\243oA\240\370\360\320\202@\177\265\216\345A\257\335AKX\036T\307\222\375V\314\216\205\300J5\250\366\332\336\314\f\030\316\344!}\335|\246\345A\265\335A\377\277\035\004\336`\363\243\004"
+	.string	"\221\231\376\334\302\355\3026\025`\302L\003\013\346\031\277U\001\373\375\367\004Y\306\177\217\366\002\f&+\225p# \230c\374V\007\207\273s\322}\003~\364\374q\227\f\343\267\033\376\313\342\267<\371\305\177\0209\351\317%\020\236gn\361`\262\t\302\334\036\034\202\363G\345R\234\200\203\320)\377\305"
+	.string	"\376\271\376Q\266\377\356\374W\347\277\030\030\341\277\024\334\r?66\311$\370q1\377\250\231\007{\001\330o/\270a&\344\027N\207r}\235p\311\177\303\376{\366\343\024\360N\036\301\177'&\344\027\376\237\220#\320u:\224\203\037\327d\027\377\235\334\344\\v!\267\320u:4\303\177G"
+	.string	"\002\374\254\002\227\260\343\277 \370\257_>!G"
+	.string	"?\253\270\"\374\267Knq+\360\337\016\367@<\241E\361\377\273s\371\337\345\277\0265\027}9\336\377-\377\337\326\377\033\370\317A\317\213\223\037\177\375\367I\026\301\217Od\"\\\366_(9\371\337\037\301\214\314C=?~\313B?\256\222Y\270\024\370o\346\277\021\300s9\004\277\035\372\355\013\277E\266\360\333\265\310\311\237\217t\034\370\357\341\034\376\034\364\347\017"
+	.string	"\375\271\003Y}\t\377\211\247\002\n\025:?z\343\277?\277uaI\360\377I\022D\376\300\237;@w\n~\324\006Fq\363\2431~\353\202\205\377\026}"
+	.string	"\370\001\304\037E\372\361\237\376h\013\204W\b\320\177\211\340\002d\r\374W*\355\370\333\214A\006>\200\273/\362\037~\264\350\363[\024\310\243?\272\374\363\016\0068\\\300\002\177^q\221\267\340G9\360_\277|\302\237s6\341\3175\023\370o\320o/\220#p\215C?!\227\360\r\376\323\314\217=\270S\262\004\376\374\001>"
+	.string	"\316\217&\177\374\254\"\223\360_\017\377=\341Z\340\277.n\225<\302\237?\210\220#@\205A\\19\305\275\374\267\370\037L\376"
+	.ascii	"\305\305\340?\210\377\0362\004\354\005\370\003\023?z\374\261"
+	.ascii	"\222\377o\371\001w\371_>}\211\377U\341n@\004a\376k\370\317+\177"
+	.ascii	"v\300\177Q\374\026Gn@\t\177f\300\177W\374\027\002y\001\r\370"
+	.ascii	"s\002\376k\302o\313\f!3\002\376\327\374\250\007\377-\362\337"
+	.ascii	"\037\377\005\362_\"\377\355\361_\251\377V\375\367\352\277T\377"
+	.ascii	"\215\372\257\220\377b\375\327"
+	.string	"\352\277>\376;\344\277A~\234\364[\035;\177j\363\343\253\037\023\371\361\220\037\007\371q\325\217\205\374\270\310\217A\344\003\374\330\351\307@~\374#\237\370\237\363\247\030\3703\b\177\346\340\317"
+	.ascii	"\370s\207?o\370\263\315\237\317\037\027\376\330\314\217\377~"
+	.ascii	"\254\367c/?\306\362c\271\037\303\375\230\355\307f?\026\3731\330"
+	.ascii	"\217\275~\314\365c\255\037\037\371q\326\217_\374x\375\361\320"
+	.ascii	"\217C\360\343\240\037\377\374\330\370\343\342\217;\360c\r\374"
+	.ascii	"8\205\037\243\360\343\023~\254\341\307\372\307%\374\330\376X"
+	.ascii	"\305\217G\3701\212\037?\340\307\n\3701\002~|\200\037\177\360"
+	.ascii	"c\022?6\300\217A\374\227\360\307\034\3748\203\037w\3701\005?"
+	.ascii	"\336\360c\f?\266\371\361\375o\341\177\007\377+\370_\300\377\376"
+	.ascii	"\375\227\357\277{\377\365\362_\n\376;\367_$\377\315\340\267\020"
+	.ascii	"\370\357\225"
+	.string	"\377'\374\267\312\177K\360\337\241\377|\377\301\374\027\003\377]\341\277\033\370o\327\177\345\376;\345\277o\277-\361\337(\377\205\362\337'\377\337\376\253\360\337\016\377\237\374\026\352\267\313\337^\360_\360\246\375\267\311\177\321\376;\366_\261\377&\371\357\326\177\265\376{\344\277F\376\233\365\337\375\337\023\3747\341\277&\370\277\342\277$\370o\213\377\256\377U\376W\004\377%\372o\362\277\310\377d\376\367\375\017\363_\357\377\330\377\243\377t\377?\034\036\036\036\3768\031\3705|\370OP\003NJiG;\203R\332v\332/\2748\331\315\2542\332IT;\303N\332G;\215\312I\003\245\244*'\245\264#\247\fJiUN;\255j\353\354\244\243&\031I\273)\303N\253\362\333iTN:JiTNJiUs\366\314\214<\0349\236|\311b\262S\224\2226\323\222\324Q\223\216\235\022\223j\353\355m\327`\354\246m\267w"
+	.ascii	"\366\226\242j\322;\332a\341\220\354\230\220\242\034QY\346\336"
+	.ascii	"\273\303\022\222\025\325N\2623\262\333N\251\213j\357.\244\240"
+	.ascii	"\275\264\367\336\037\0301\3556\226\2653\n\"\265k\300\330\333"
+	.ascii	"\202\315\334{io#\273\355\366\336F{\357\264I\212\271w\017\035"
+	.ascii	"\245\255\245\245\275\2418,m)\243)0\366\276kb\340\234\224\322"
+	.ascii	"\254\250z\246\250\245m\355\030L#\253T\203jom\275\252&\235ft\266"
+	.ascii	"k\354\275m\031\275\345t\343\357f\346\330\336L\034t\211\221\030"
+	.ascii	"Sn\276\202\265\222\370m\335\374\rD\364\006r'~\306\335\252\235"
+	.ascii	"q\247\234\003\326\366v\322\200\253\t\252\003b\226X\214\266\233"
+	.ascii	"\317*8Aj\364\275\335\374\r@\3647H\351\017"
+	.string	"S'~N\371\263\226\274\305\252\235Sr\037Qi\357\247\017\300\354\376\004\007wSS\007\337\320t\372\355\361\260J\343vF\311\271\022\370\003\316\357\204\322\302_\221,yl\347\223\273\203\206\222\247\233\277\203\345Tc\332\300M\261\341H\3139p\274\214\t\213k\202V3\225\205\306\231\331O\264\377d\236g\247\030\206\261&O\320n\326`[\0364o\273\203\236e=?\3150\314\ri\336\234\301Iv~\235P\246\204l\031;\305\266h\205\275\335\034\226\372\370{*s\363w\242\350\363\213\307\tv2\261j\347\327\271\344\374:\271N/\250\234\027X\220\304@\363w\314\364\331us\244\303\255\313\315\337Y\242\277\243\245\377S\311\214\\\270v\327$\211\237\221\031\300s\353\324\272yq\243\214/\304R\026\022$y\352\224\262\321e\351H\023M\346\246\366\305\310\317\0379l\340\241\335\374\363\350\267eHcGOXe0\300\230"
+	.string	"\007\331tLm\2159\025a\002\374\242Q\343\b\023\340\340\371\343\334\341\243\331s\203\b\023\340\227\2352\003\311\213\260\346\022\223\2553\262\225\264\361\235\030\023\340\327\231uR\235U'\326\031u\3728\255N!'\220S\352\034r\0269\203\234S'\221\363\312\252\235?N\250\237<\316\036\317'\216\034W\352\307\251\364\367\310\320b\002<m\374=\347\217\263\311\326Ye1\001\016\236?\316\030v-m\362\305\0048\2707\263&\311\024\325_"
+	.string	"\262eZ\036\224\203\335A\277S\245\277\263C_\203\240\276\206<\035B\213\276\006(\372\032\300\3645`\351\257\365\320\207\263<\35050\351\317\245\321\317\240\247\337\264<\3503\274\351g\b\323\317"
+	.ascii	"D?C\223~\206\255C\260<\350\177\032\335+"
+	.string	"8U3\b\005\317]X\266\304C\351\320\260\005\024T\231\241\305\271\341\344\253G\032B\272\275\275$7\023\316(\314h\254Z&\314g2a\036L\233\310`\002\034\304J]\232$A\363u\316\350\353\210\321\1776#\210g\345K\225\233\231Ig=\260\266\002\017h\367\365c\353f\300_)\020\354\n0\364Ua\036)\203A\016S\307R\220\277Lg\003f\r\251\315\017\3578\233d\t;j\332:1+Vkd\336g\205\313\\\231\233\371n\030[W\324\315\327\321\242o\307\362\336\245\273i\2204\361\262]\316\313]2\230\354%\353e1\371K\016\223\307\344;\253\226\367r\335\263\226\274\305\003\037aM'\317{w\355^\301gM\022h\362\005\002\324\225b\262\365'8\230&\357\335}u\340\263\246\023\220\312\376\366l\340\336N\037\2005\375\t\016Z\277\275\314\005l\353Oppj\357\376\270iH`y\017\357L\347\264"
+	.string	"/\270?\301\301\263\337\246\331\273;l\035fn\245jVdM{&\357Y\302\265\277\347=[\306\352=\205"
+	.ascii	"\243\372\023\344 BD\032E\004\313\020\013\362u\332\264ebZ\036"
+	.ascii	"4\203\236\335A\257S\246\263h+^\200\315\233\257\323\245o\247D"
+	.ascii	"\221\261\005$\307a*\326\214\265#\342\2000\303\346R\266\341\001"
+	.ascii	"II\205T_s\312\225J\265\3760\f\035\230\007>k\322mHL\315\034\227"
+	.ascii	"\201\344&\036\220\224\366\276\241\001\327S\325\330`\256\222\241"
+	.ascii	"\344\264,\227\333\362\223\214%K\311V\362\\\216\222\3252\\v\222"
+	.ascii	"\3352[\236\222\257\344\265L%\277Y\265\034\227_\374\032\336C\250"
+	.ascii	"\334c\fV"
+	.string	"R\256\341\001I\211\0044d\2327H\216\303rv\320\332\021\311a\204\315\250L\345\001I\211\004\301\275;$\307\341+\030\320\003\222\322\004\250\234\001\"\005\303\335)5\253\342n N\022s\033\245ZT\252\306\006\271\236\343\260\024f\013\001FS\tV5\232\330\b\t\277\370\200\353(0#y@R\"a\313`n\312;r\370\250`(\377\005\022\207\333l\235\265\203\332F~\037\2220s\034\256\222\303\n\2339\016[A\311TU\215\rb\030q8\006\316\201\223\304\334O=\177Uc_{\357\2334ix6\n\220\321l\266\310\252\224n~\016\241\276\007P9\314\211\215\346\220\234$\004\030MD&<\250\\\226\31123\237Y\265l\226\305~\261\360Q6\313cW=\232\331,We!U\005\210kJ\245`L\361Q\223\237\023F?\307J\006\3039\032\273\322u\363s\316\276\230\3443]Gc\226<3\311hd\232"
+	.ascii	"\2719{e#\204\203F\200\334\234\273\256TU\217\260\346\315\231\353"
+	.ascii	"J\331(VcdJ0\332X\240\231\222_\251;-5\220n\316[H\372\356`\204"
+	.ascii	"\335\374\234,-$5sFr\\9\362\214\344\202\311\373\302\2749ce#\200"
+	.ascii	"[NF\262\002\323\310\260\225a\356+\252\035qE0^\007\005\234A\232"
+	.ascii	"qs&R\263G\206\216\312\315\017\274R\377\211\247\225\340\230\267"
+	.ascii	"\233\237c\025$_Y\241I\364\260\016o~N\216 V\231\215\007"
+	.ascii	"\021\253\007>[\235^\272\220@\271\3719K\3728\205\371\207\322\253"
+	.ascii	"\017H\336\324}\340\"\3150[R\317>\214\366\332\300p\341\341\225"
+	.ascii	"\203m\314\315\307a\323\307A\313:\272\b\313\300\335|\034\"9p\244"
+	.ascii	"Ig\320\266"
+	.string	"\334x\306a\305\372\356\314\334\234\237\364\226\r\243\027\331\211\350\207\307\205Hv\262f\256\222\270\211\335|\234\036LOQi3n>\2063\372\030\3702\r\021\272@\371\270\371\030\344\364\255Z\236\221e\020\363\306\334\004o\3162\352p\340\224\220#9\2065\203\312\361\226cd\0309st\206=2\214\374\002\r#\203\324t\3631\264\351c@\323g8\340'I`\331\310\252\345#,\310\301\203|\204\315\344\215\363d\312\336\324\315\226qfJ\316\177\336\370\220\211\251\251t36$\326\341\310\201\345\346c\270\241\177\\h\325p\232\367\335l\017!\200p=\335\374@L\370\237x\207\340\221As3F\323\264\237\360\270\371L\332\347\344\005\355\346c0\322\203X\360\0029\372\342t\363o\f\365o\306\350\337\200\321e:X8#44n\376\r\235\366\303s\370\213\220\265\255\275w\023\377Y5\354\207\361\374p\036\356s\213\322\354"
+	.string	"\006\23274\337\203>\254\207\367\254\335Z\212*P\232{o>L\306\252\341><\006\367a0W\312\332A-"
+	.string	"\256\255\211\243\305%F\206\346\337\274\351\314$\351\211\026,\006\207\331\0300\364\371\220\353\272\3717N\364o\312\364o\226\350\337(\321\277\021\342\005\337Y5\374\005w\251\303v\036\220\224H\250\023k~\301X0]\372\304\317\313\227\216+R\005\013\315\277\331v\\0\310x\343\002\243\005o\251\311\001eW\345\346\333"
+	.ascii	"j-\267LI^\320\335|\233=}\253v>\234\345}Yu:\310n\276M\236\276"
+	.ascii	"\r\027}\033:}\233+\3726S\364m\324\364m\310\364m\274\364m\260"
+	.ascii	"\364m\256\264\033~\303L7,^n\276\315\0167\033\032\3725\204\372"
+	.ascii	"5~\372z\226\007\305k\035r\202\f9\302\273\3715]\264\017\034\004"
+	.ascii	"3\267D@bj\246\341'\330\211U\303jW\303W8,\004\030M\024@Zj\252"
+	.ascii	"\341&\257\363\200\244\264\217\200\224Hr\206k\254\203\b\021Y\215"
+	.ascii	"\b\226\037:\277F\210\2765S\322\301\332\021q\200\22266&`M\034"
+	.ascii	"\206\207\340$\036\220\224&0\027\245kmkIX\323+\204\265[K\0017"
+	.ascii	"\326\334\233\031\206\277.\207\223\244\263\223\220|5q\030\346"
+	.ascii	"\352\200s\304\334M(\026\226\226\225A\314\304hX\f\233a2\\\206"
+	.ascii	"\317\360\230U\303a\030,I\304\251\346d\220PC>\261\213>1\213>\221"
+	.ascii	"\212>\021\212>\361L\237\030\246OT\242O$\262\305\341\032\221\361"
+	.ascii	"b\343\346\023w\350\377\370\bFb\325\260\026\306\272-\303B\316"
+	.ascii	"\201\271w\024\"8\013\307(\303\336A\370\264\260\021\234e\355\240"
+	.ascii	"\230\373I\003_\030!h\006\367fr\020!\002\273\355\001:A\363\265"
+	.ascii	"\025\375\343,\\\304\306\220\314\207\341\315\377\255\032.\202"
+	.ascii	"\261\230\233\003N\231V\215 7_\227\351k&\372zK[\215\245\177\374"
+	.ascii	"\243\007\216\302V `\223A\027\343f\f\004W\035[a\252\215\255>\240"
+	.ascii	"\332\373\b[\345\024\356}\224c\355\006\326n\220\303\254\264\240"
+	.ascii	"\240\371:\210\306S=\307?^\020\251\361t3\b\273\203^\373\320\327"
+	.ascii	"P\3722-\017\032\302\356\240;0\224\275\023D#\343\346k\031;\016"
+	.ascii	"5\016\01697|<Q\272\371\251\030}\017\2240\r|\326\244\241\\\031"
+	.ascii	"b'|\303\252\341'\\c\r?\341%\334d\355"
+	.string	"\326\366\321\215\017\\\232\206M\034D`\2002H\250\003\315L\330F\016\215#1\262\2140\245@\364\323\032x\306\223\223\"2n~\272\261\f\364\214>\232\247m\223\335AqR\326\241\345\n\311\315G\267\350\243p\372n\313\203Z*\273\203\036]\3237L\313\203\3325\273\203\026\336\\\031\013|7k\247\233\344?1\347\310\n\216\244\233u\323\337\354\230:\226n\3266,\234\221\2532\0357k\246\277\245?\240\024\006\236p7\315\213\230]\026\035bK\307\32014\215\032[D4\246\022$3\256i\3140\363\302\313\315ZF\332l\316\220\202u\263V\312shR\232Mt\210&CC\375\242\204\3351\332^\320h\346*:\340\302\264\321\365\013\235\264\244D\343\346_'i\244\262\2700R\316\210jiG\242\350\243\253d\316\220\255\310\315z\247M1Y7\342nN\017\257\324\345\301\224\321T\242\0070u\346LZ\210'\005"
+	.string	",.V\b\237\026\276\325\020\301\272\002vs\212&\265\303I\002\247\304\026\245\007P\006\b\230\232\261:L$<\036[i\034\f\036>\004\237\232!\002\246\027\346\34640m\3669\241\323\273\233NbE\306\222\233\277\001\r="
+	.string	",b.&\375\343@\205\361\240v\024~\355"
+	.ascii	"\342\367\364\357&\307\214/AnN\371\322&\022#ROi3%\003\304\211"
+	.ascii	"\210\031+\033\2379B\032L\373\256\224\256\265\245\247\233\323"
+	.ascii	"1w\2632\n4ss\272w9\272-V?\0025\210\246/_R=\213\266m\220\240"
+	.string	"\206\020\270/T\254m\006\027\230\247z}g\034\235\325\330\315)^\232wfQ\375X\222w\001\265\230\264\002\233h\020\201t\247K\275p\240\302xQ;\n\277\366\206\n\221#%\026\365\227vy\352\005/\005ij\2729\325\222b\330s[\252K\355R.=v\224\351\302\241\225\212\324\270\332rc\020\331\221ewsZ\207m\300\021v!\321\003X\272r%\305bu\230HwY[g\334\240\035\227\271\247X\372p\322\252\2705\271\322\034\230\241r*\251\034\007\275\311\232\030i\356\r\025\202\003\032\036\230*O\345\232x\2037\247qb_s9\256\201\017\315A][[\n\347\301\313\256/L\303\030|\302\344\355)\334\337\310xm!I\335\356\031'\205:R\267T\nZU\216)|v[_gi\224{\027\330\225\005\360\346k\240\244\007p\346\354\351\223\263\224\315\006Z\346\206\2422\372\343\340\007\235asp+I\205"
+	.ascii	"\022\362\243n\355)[\035z\350\004"
+	.string	"\256\352\315\313\r\f\312\315\251\223\247j?1\005\203G\207v\3633\200\323i\223\247i?\361\214\272\261\327u\3633h\323\177\212\366\023o\210\324m\371\273\371\0318\321\317\240Ls\320FF\226\232q\360\343B3\310W\345\204U\366\324\f\003>!\221\322V\301aV\214C\315\201\231\230\030\312D\353\006\231,\330\310\335\276\322\2479@\302\204I\nf\337\232\b\326\335\036e\266\024\371z\nVc\b\303\257\255\204\230,$o:\204\031/\257,\303\016\341*\003e\255\214\021\323t\363\001\220C\207\310;\361?M\222&I\271,\332\266\301A\314\212L\226\301\275\241B\330\b\316(\243\224*y\312ug\226\247\007\367\237\210n\261Q\210\346\346c F_\246\023O\265R-\013\347\200\265}\344\024\002\313\215>%\031\216\3301\271\371\030\200i\016\230N<=\222\0369\347r\024\270\335\004\325A\232w\244\311\343\346c\200\2459"
+	.ascii	"r\302\202\3314\306\323&\334\003GY\2654F\232\325\203\264\217\220"
+	.ascii	",`\212\035jF\354p\312\315ER\032<\332\326n>\006R\372v\314)}\322"
+	.ascii	"\273\221\225x@R\"a\214K3G\272\303\332\021q\300\222\272\224GJ"
+	.ascii	"e\355\240tv\222\333\230f\032\004\203\311J\266l\tI\261R\"\351"
+	.ascii	"Uj\225\016\261ji\220\024\352\270"
+	.ascii	"\007\216:\373{\322 )\016\273f\355\2108`L\213M^\240\226\035NN"
+	.ascii	"\235\316\347\001I\211\20421\315\224\n\233I\177\330H\341\002\263"
+	.ascii	"e0\005\222VY\265\224j\255\003\006\3020\203eh\376\323\037\351"
+	.ascii	"\024\334\214\250\0307\247>\322\350h\004\271\371\036\366\364\237"
+	.ascii	"FY\265T*\206\2224HnN{\234O\206\321\f\032\036\360\364=\314\351"
+	.ascii	"T\207\306k\372\240\242\357\301M\337\003\233\276\2074\375\247"
+	.ascii	"OYIZ\026\300-7\337\003S\247K\251\215\23408!m7?e\372O<\241\b\227"
+	.ascii	"\266\233sZ\343\322im-\335\374\224\006\216\036\022\266\263\233"
+	.ascii	"\237\316h;\004\344qs*C\303\360\240\004D\215\017\267\037Q\251"
+	.ascii	"\322S\031?j\006Cy\3410\215\231\233-\232\236\247J6[\2544\315n"
+	.ascii	"\276\207)\315\301\220\023\026\314\242\202O\223\004\323\027$@"
+	.ascii	"\355\247\022q[\252\003\0341V^\\0\230\271*Q7\247;=J\221~\"1\256"
+	.ascii	"\306\235\324\315\367\240C?5\"\342\345\210\327\315\327^\016E\r"
+	.ascii	"\217\036\376\304t\254)\211\355\346{p\322G\013\3214?\021\247\251"
+	.ascii	"\213\223q\363=\310\320GO\260\007\004\354f\024\215\206q\001\032"
+	.ascii	"\020D1h|Y\203G\321\374\350\231S\t[\201\240F\024\024\231\233q"
+	.ascii	"\354\016\212\232\3519:x\265\326\350\350n\306`w\320_\300E\023"
+	.ascii	"\340\n\0312(\340\221\224\211]\016\023<4\263\346Q"
+	.string	"@\264\f\024S\031*\264\f\372\247\204\006\314\013\f\323\206\016/K\030?k%G\314\022f\227\013\334\364\007\254\023\350\236E\371\370\256\024\207m\364\247\201\030\325\005i\372\366J\241\0048#F\fZ\007\266\225viJ\263\344\346_\320\245E\274\310\313C\365\210\013\0203\262\245\217\350p\204\241`\216\352y\200\306\215\034\227\3131EL\013\021-\242\352\356\016\375\362E\354\207\215_^\231-_\314p\221\231Q\273\371\027\344\320\"\220t\351\222\255\346\304\240\232G\376^X\335\374\013\214\264\b\257-[P.\227j\357\rc\273\240'F\243\211\207$\315Yq\201\023\303\304N\353\346[\320\247E\234\241t(\035Z\307#\375a\207\301\210\223\022\"uW\312&\214\323\327\026-BJ\225WA\261\330\275}d\300r\232\232;\212\005\363\t\261\n\273\362\237hsd\312\016\017\275\202Z)S\233R\026\266o\362\264\230\375\220;\227"
+	.ascii	"\362=Q\273\371\026\300\351\017i'\216"
+	.string	"R\261j(\225\023MCS\tVc\232\0260\365\207,'\216\302\301\241nVg#\335\365m\355\246.\035\334\002#\372\303\333\211\243R\244\240n\034\266Q\231\017dp]:\260\313\2711\024\273\003r\363-\200\322\005Hjk\313V5rwZ\310n\276\005Kz\204\026\333\331P&\304\275\321(t\210\236\215\016a\364\b1'N\320'\202\350\016*\2340B'sjG\237`\215\311\261WE\223X\322\004Mk\2022!\301(\r\0341Nl\214\2200M\002\215\fE#C\317H0\342I\243\303T\001R\006e\036=;\2714\013\017o~ j\306\006%\347u\3212\234(qO;p\334\274\250\275\270\371\035zh\022\\\304\304\262\225=c\367'\370E\305K\207\031\232\204!\n\206\206\241`\250Q\031\300%\203dt\217\334\222%(\023\236)L\233\253\034U\256\334\314$O\367tI\222\004\355\352I\202va"
+	.ascii	"\024\324!\344fT\t\207+\232D\036\252\205j\241F~ \230\241\342p"
+	.ascii	"\246K\004\301:\212\205\036\321\333o\347tE9\3310r\364\210\221"
+	.ascii	"\302\246\271\233\321\254\323\016*\tM\227\233\321\" \230\273\253"
+	.ascii	"Z\373O\314f\\PBn>\207#\232\203\030'\216\016\271UC\207\234sZ\306"
+	.ascii	"\336GP%\246\330\271\360\246\205.J\233(\003\002\004\275z\273r"
+	.ascii	"\253QS\002\034r\025$g+\361r\205\006A\255\310\330h\236\3418\t"
+	.ascii	"\305\314\370\250\3025.\333\224\021\300\233\317!I\233p\213z\024"
+	.ascii	"\372\343\356\275\367V\352\206\307\326\334PR!N\275\265,<\364\007"
+	.ascii	":\025\026&\013\030t\n\3651\246\353\360\013\332\223\037t1P\251"
+	.ascii	",fsUE0\315\315\257\200\2146\261\345\004\324\241P\036v\357\277"
+	.ascii	"\022W\230R!p\016\251\236p\335\314#\033\271I\362\341\345w\363"
+	.ascii	"+\350\242?\340\2358\252\003\325a\341H\330GO\037\310\232Pl\240"
+	.ascii	"7l\2408P\034I\270\254j\334,\202\260\t\275\321\204>\361\240\""
+	.ascii	"\216\241y\342r:\372dX\307\244\307\315\017,\312\025\031\274\371"
+	.ascii	"\025\210\351Wp\245?4O\034]B\227l\035\207m\344W\302l3;x\005Lh"
+	.ascii	"\022*\003MBi\2403\216\322\310\222\343\213\216\016\312N\240/P"
+	.ascii	"\031\350\013T\311\356\246\3004\307M\221*974\306Q%\r\250q\375"
+	.ascii	"\335\214\3028\275jTQ\231\222R\343\025$\253\313P\237\0020\206"
+	.ascii	"\350\221!jT\200\251C\364\350\0205B\315\266\376\004\2776\024T"
+	.ascii	"\210\223I\207\021t\0375J\345\272\224\310\335\374@\234!^t\206"
+	.ascii	"7\237\002+\372\024\224\351\243As\376\241{[&\225\215\246\r\325"
+	.ascii	"\024\242g\007\341YHx\376i\243\275\215\230\333F\207+[P!\256\341"
+	.ascii	"\024\017\0377\237\002#\372\024\334\320\001Pr\302\326\331sp\320"
+	.ascii	"\326Y\346\266\261\301\213j\256\003\264\n\263P\306\315\347\371"
+	.ascii	"\323W\312\211\237\202j\247`6\314g\322\016rdko\250\016j\312\314"
+	.ascii	"\256H\271\371<c\364\305r\342'\240\332\tx\245\262\021\332\266"
+	.ascii	"Q\363\302K_\225\301\275\347:\2709sv&\314\315\347Y\323\006 C\206"
+	.ascii	"\314\371\027\325\364\373\371G\004P/\356\346\263y\332\351+>\250"
+	.ascii	"\200\341I\2427\270q\342'\237\332\311\227\001\263\021\332v\252"
+	.ascii	"\211\201&\306\312\340\336P\035\234f\002\257\366n>\017\2226\241"
+	.ascii	"\343\313\227s\317\356\2757\3246\372\373\200n\013\314\317\275"
+	.ascii	"SLM\216-+0n\326;\303\330\263&1\264n\376\006A\2753O\337`\366\300"
+	.ascii	"q\346\235xx\2159E)\013\356\322\025u\345\346o\330\323\006\340"
+	.ascii	"q\342\314r\322\375\254{\335\351\345:{o\244\275\247|\240^PM!\376"
+	.ascii	"\263"
+	.string	"\313O/\030\234\252\270X\335|j9\355\376\023S\2625C/;.4\342^`\341\233\202\006\226vn\311u7GU=\004o~\240\255\373O\274\231\361\0247u\3637d\321\377\355\357\217\356\243\246\275\367\323\311\334MH7\350ooOkC\374\030,\266\001\370\237\367\276\006T`\356\027Q\276\354\275-\240\346z;\212\322`\237vMJiUF\016\250rJ\252\332\241\224V\345\224A)\255j\033%!1\312\320\264\253\214\224\322\366\316\220\224d\224\202*\312\344\022\251\356\324\254K\245\220\021y\024\001I\201\345\021\003u\305R\025\362q\201\002\b\t\200\325\230\024bq\276@\302\217\272.\213B\360\363\200uy,\022\201\213\023\324\325(T\344#d\364\311\340A#\200\220G\345\272\244@H\250\b\211L\"\323\265\250\276p\\\242\253\272\034R\207\320\007\215PWc\n\253\272\342\210T\201S\201U\035aG\004\024&"
+	.ascii	"\001\nzV\024~~t(\310Y\272\020\"\"z\300\203F\254Hu\350GiL\256"
+	.ascii	"\260\274Y\217H\025\033\224FU\bE\013\365G\007-\213Ph\241\376\244"
+	.ascii	"\307\026j\212\037\245\361\007i\\W\264P\1776<h\304RH\310\350\023"
+	.ascii	"\264\032\207H\264\220T\006\255Id\312\302\250\n\345u\211L\372"
+	.ascii	"\234,V\344"
+	.string	"Q)\204>h\304\006K\237\343\272<\256\306u\005\013K\243\nJU\250\350G\r\362YzX\036S,\217:\017\032A\"y\254"
+	.string	"}\320\b\225\005#\213\242\210\021T\026\214,p\0364\242\250\016\035Wd\221\222\204\017\213\fVuE\315\203FL@\005\025+Hh\300\202OR\b\205\252L\242\310qA\224D\221\263>h\004QQR\tTT\252\253:dT\032\211H\370|\360A\026\211`s.\213@D7k\021\tDt\"\201\210\260\372\302q\231]\020%}\262r%\302\307\340BYL\177\324eQ^\2467\256\306\237\"\020\321\b\234\242\272\032\205\210\206T\025\200\210,XZ \251\0021gI\224B]\215)\330\254\352\b*\374\030\325\024v\226\032\210\222(`\310\021:\032U\3701\252$\354\324"
+	.string	"!\217HdQ\n\",\217\002\350\240\256\252\020\321P\022\305\b\313c\006\313\234!\243\005\032g\311\2633\244\256K\027+2\230`\302\262\b\002\030~T\"\242\2442\205Z\244\026U hY\204\002N\320\262\b\005\236\037UH\310\210\004:\256H\221\243\026\245X\252\240@\247\202\f%F\254J#\321\b\026D\023\370QW\245q]\2614b"
+	.string	"\by\034R>`]*\217,48\0374\002\250h\005\365\207\304\217\320\261h\005\365'i\002P\321\n\352\017q\204!e\222\205R%\242\340A#0X\376\250?9>G\245\212T\201\364?8a\200\023!\270\220>\204\004\224H@\t\364!$\240\247'\001'z\364O\364\340uM*]"
+	.ascii	"\345\0226?\306\"\021\034W\320\260\026\215\253\220\232B\035:\256"
+	.ascii	"6j\361G\005\013K\243\n,|j\324\242\372\2234A\251\022\251\352\n"
+	.ascii	"7\353\262\250\227\026P\207\216+\272,\376\b%\203\226\2522H\205"
+	.ascii	"\025\251\016\251-\222&$\225.\2004\030J\"\325\237\242\017\322"
+	.ascii	"\305\262\230\303\202H\250\250\022\271X5\274\020TdA$\244ST.\217"
+	.ascii	"9/\004\261`\302\203\242\272,*\342\250\313\242br-\252?\311\241"
+	.ascii	"\"2y\\\026\261\320\351\3511Q|!h\203\211\"\013\026\311\265\310"
+	.ascii	"ge\221\344\320B\362\007ylAg\311\202Q%*\026\221.~r\226\305\244"
+	.ascii	"\322\005\020\252\016\035W\242dr\0028\353\217\272\\\036M@&3,W"
+	.ascii	"<h\004\007k\006~\214j\n\313\242\206\037\343\006\345\212"
+	.string	"\002R\004\245\272.\217@j\n\030(\"\032\342A\212\240\256Ge\013\251rE!\205\"\242!\fH\021Vu\251*\323\"\240#\013d\022E\021\321\220\316zD\252X\217\310#\017R\204\037\243\252D\215\2531\305\217QM\241\003R\004\fDEJ\245\272\"Uh\200\024aY\264\032\327\025+\362h\243\\Q\360A\026Y \251t1B\005\313b\0135\005R\004u5\376\020\025\351\007\2158\256.\250JU\350\007i$\341\270\272\240\356\254H\026wY\364QS`\301\307\270\202\220\220\021\305quA\315p\\]P\363\272,\2420\241\002\205\t\025Dt\271T\225??\306\324\307\304\021\027\025S,\213V\260y\320\210e\321\n\313\342\221h\205\352sl\241\376\330\260PS\250D.T(\252@a\205\215\352\2034\256K\344Q\257E\n\250\310\310#\n\310\245\017z$Z\342e\321\nX\0252\372,\317\232\244R\335"
+	.string	"\212\024\017P\225E\253Q\251\022\r\251\253\r\013\"!\254\0261\274@B\t\352jL!\251t\001d\263$J*S(\325\237c\213c\212\"\242\241\034\027?F5\005\343j\374!\2569\305\364A#V\237\"\345\2724\261,\272\240\256EC\031X\360I\n\025\213\350\212,J\372\024\213\251RE\266\220,\026\323\245R]\026!\213E\375\203<\262P,\242K\344\221hY,\246\310\344qy\024R\213E\342Z\\\227G!\235\007\215X\252D.V\003\374\250Jc\320\322"
+	.ascii	"$\226\353q\005\022EH \003\270P\204<\n\031\340\203\023\305\023"
+	.ascii	"!\270@B"
+	.string	"\375)\022\362A\036I(\227E$\020\260\272\240\"\205\214H\245\272\"\217\305\037\243\252\fZ\211\212\305\nZ\250J\242b\021]\227G\241b\0215\256\306\237b\021U\032\203|\262\372\302qY,\242,\370$\205\262ZD\002\035\205\214E\034$\320Q\210\270>hD\021\321P1\251t\001\344\343c$\261T\252-\216\312\037\002\250\305\024J\200P\342D\021\321\320\0162y\\\213\204\222KUY\263,nP\213+\212\210\206l\320U\250h\251\246\200L\036W\037uUS\024\021\riX\213@F\025\222\307\024\310\250\302qu!\002+RE\021\321\020\206\026j\212\244\322\005P\272~\004 \344\315\262\210\"\251t\001\224!\035*Z\342\365A#\226A\253q\bY\034\302\313b\013\365g]\246&\230\260\342G(Y\034BW\264\240\"\213C\250\322\330\002#\223\307\325\250\\\341(d\364\261YU\240\033!\025\2114\006\371"
+	.string	"\031\327eM\315j\302\305]\0263\250E\225\310\205\n, \215\020\340Q\211\\\254\271\304\n\267g\205kb\205\333c\274&\214\267\307\205k\302\205\333\343\342\"]\004\371\254I$N\220\317\232<\301\347\270\032\327\245\316Z\faE\036\213R\025\310\270\256\270\371Q\205V0\"#\300\263>h\004\013\022\310\344\320P\322\347\002u5\256\313sYT\252\253\320Q\004\345\221\205\006!\241#\013\233U\005R\032W\033\027\324\037\344\361\034*Z\001\204<\266H\016\021\325\325\270\256P\227\307$RM\301\202h\002+\213\344r\207\005\212\024\017H*]"
+	.string	"\351\026\214)\240H\361\200eQ\362\330BU\022\341\240\351\372 \013\236$R\225$\326dRI\302F(\231\204@\361L\227E\022\222J\027@7\252\020\321\220qi\243\304a\301\247h]\326\374\250\253QY\264\032\2278k\321\204\007+\262(\211\302E\320*dT\203\220E8KeR\251\214\300\217QM\201g-\236\350Y\221\307\"}\017\016"
+	.string	"\202\021\001'B"
+	.string	"a\204\316\021\200"
+	.ascii	"\024\032X\340\204\021\264\317\210\244\322\005\020\211\2452\271"
+	.ascii	"D\252K\022\310\243q\210\204\217rIbD\007\026|\212\326\025j\213"
+	.ascii	"\343Z\344\243.\221I\037\235wP\206\270D\264A\\\"2\215\245N\314"
+	.ascii	"?A&\324,\210\223\036Xn\376\007'\375\023k\024\362\351\215\241"
+	.ascii	"A\244a\006\377\205)cG\234\361\2272e\001\324A\224\241\007\227"
+	.ascii	"\003+\217\250t\003\257\223\031G;\2101R/y\314\217L\216\b#\307"
+	.ascii	"\236\220\244\256\233M\234!n\342\013\342&&\331\246\246\003\334"
+	.ascii	"\2311\001\016n(\034\304$\"\322\\\231\2313\"\022\361ho\t\363\344"
+	.ascii	"\312\205\322\202f\013\321\350\204\312d/\2124\335\374\0170\364"
+	.ascii	"\257\017\265\341\225+(,7\203\2615\276\f1\222\306\302\261\365"
+	.ascii	"\331\321(\304A\210\272mi\241\361\241Ai\354\371\030\002\344f\023"
+	.ascii	"\222\006\001\231i\325\222\252'3\247\227B\037jZ\202vP\351cn\360"
+	.ascii	"f]F\003^\007^\007^\035\210\017\017Q\262/O\320\374\353\277\024"
+	.ascii	"\254F\215\311\336\232\366C\231@\340\257\306U35\233Bs\247\205"
+	.ascii	"\331\365\344+\257\217-U\033t{\342\203\313qz\373Ae\214\034:U\005"
+	.ascii	"\213\340^\212\245\206\356J\033\226\2304Y\322|\314\bs\373\354"
+	.ascii	"\266\304\005\336<b\017\214\326\003\243\361\232\177\202_z\232"
+	.ascii	"\004\017;\235g\247\361n\233\244P'8\375\345\032\017\211\224\037"
+	.ascii	"U\356\320"
+	.string	"\304yy\335i/f\201\2078\nu\\\027\363Mw\271\202W\\h\306\334|\001@\321#\342\266h.z\013jt\235\243\034L\001$\321$\2264\235\326\242\351t\035\t7\250\376\004\277t]\326\031\f 7_"
+	.string	"OY\320#\026\307]\214&,S \220\331\213\232\3238p\352\376\226\276\256\360\300\321\352\023\203\244\3667-w\266\265\367\326\271\021\003(e\355\346\013\240\206.\341E\303\351*\032N\307\021w\323\037\007Z4\225\3538\273FT:\2522w\263\236\022\2001\372\327o\347\037qi\255+\315\355\205\216\263\034Z\212\246aEm\337\314\334"
+	.string	"\305\204\251\r\355\262Qc\202\324\004\nj\024E\366\003\360\346\232&e\300v\254\235r\026X#\263\362D_\021J9\313\272\2319f\303F\026\225\223s\357\016\242\321jK\363\2623;\304b:\235i{BK\271\322\306\234I\243\317p\315\235\215\276-\315\324fc\340\002\311nf\3268Y\233\022\243,7\3212\350eD\246\307\332\222t\271\335L\254\203\302\362\242\3050  \0163Q:L\203\031\226AK\273\231\231\355\300\314\274\364\3279\207\017u\004\362i&\351\013\253/:\0337\023\200\211\036r\215\245\207h/\234\347\207"
+	.string	"\302\032K\262\fn%\250\0206g4\316\272l]{]w\231"
+	.string	"\341|\372kI\336\321\315\232\3538PZ\2504o\276N\242\225\374\304\032\256\2534&7?"
+	.string	"R\364\r\200\246\303\311\351f\255u>\276\032~7k$\227\203\00238\344\346\007\352#[\254\356\220n\326Et\226U;\2356rf\016\016\225\030lt7?"
+	.ascii	"j\372\366t\350\t\354\351PM\204He\352\252\352\346\247P\362\242"
+	.ascii	"\266\3144\001\226\250\250\364\025\007*#\277\020_5\224\030\016"
+	.ascii	"\376HB%K\007\271\276\nA\r\301,7k\2533\317\n\031\023\220\233u"
+	.ascii	"\325\225J\233\354EQ\271Y\003\271R\206L<\222\002\260\244C\300"
+	.ascii	"\351(\035\245\2478\350M\346dF\023?i=\t\243}\\O\325\024\001\013"
+	.ascii	"\022v\263\226J\233ZN\242\0041\324 \262\350\320\241yp\320\233"
+	.ascii	"\354\216K3\r\344b"
+	.string	":\322P\327<\336\242t\364=\335\254w\364i\020YKK\032\307\322\005\314*S\345\3065\216\266*?\276\233\365S\332\354\362\361\025\207\340\250#\022\223rd\262\246(\216*\304\220)\032\231Q\322\001S\025@0@H \023\313\266Qw\003\023\300\304\312\214dq(\007\225cfFDDD\nRR\220B\206\003\206j\006+\n\007\017\353\213A>8)\261\023r\320s\241FVLQZ\235\356&\003ALA\013\270\370\363\254\361\037\235\026\nW\226@=v=\257\355\260\330\344\324J\021\326b\177\251\256\324\035U>\016v[2\n\232\257pc\026\r9\016\234q\270\031\363\b\002\003\313\215K\377Z\3745\007\212j\2256\332g\254\304\232Dn\017\254\3746^>\312\004\"\253\322\237W(e\334\f 6)1,\026\264a\b\363\007w\004\202p\361\333\314\307\n\260%\001u\300T\036\255\f\326\"j\223\017\002\250"
+	.string	"\f(\246\340\203\035\241#\372\305J\240\310L\220\016\204j=\235\306\360\232\013&\361\357b\316\270\217\tf\202\231_;]\231o\214|Uq9\317\023GKy\334\343W\255\206`\307\364\367\371#_Q\225A\032"
+	.string	"uj\370W\020\\C_\2016\224\324H\f\341\263N\253O\036xa\251\"\204Q\376\200\002#\3509\237o>8\351wx\300\344\341&\330\276}U\fA\223\256l\373\257\300\331hZS=ir\331\005H\376"
+	.string	"9\211/UwJ\237p\023\32555\317\345K\320\277\233[[\n\210\3449E\030&f\2111\252\307r\004Y\366\203AK\031;\231\b\241p\203;\201\354\235\031\"W\022\263\343\275\350;\246\2310\304\353P\330t\026\354~=\021\025\022\316\\e\234m\023\372\260\00610\204@\315\217\260A\230\034I&\025\tH\260\356\230\004u\337\201B\357_;\232p\2046I\325\232\023\314\210\030\033\230\341\276\031)4c\340f\354S\025\246K\311;\367\233\247O\220\251\t\202p@%\344\301\3458\371b\223\262(H\0165i\r\235V\273\332\342\274t\316\007\303\361\347W\302\023>\354;\217\337\371\025\334\244\310{_\001[\252\246S\n\366\202O\217=M"
+	.string	"\356\215\366\354\375\2362=\256\347#\346\rG'\342\260$x\005\256\024\004\033\003\355IW\306\362G'-\360\312v\005Jd\300\3314E\\T\002\001kJ\025\277\210\275E7\252\257:\243e:j\201\206\362\225[\211 \310E\007B\177\322\254\270[\nC(\244\366]Tm]\025 9\211\206\326a\033+\314t\020/,sF\275\314W\253;\247\201\\\250\302\222B/\330?\314\207\343j5\217\206[\214\302L\360\216[*\345\f\306\022\346I\360o\357@\254W\242\031\211\357\271\364\204\303\364\037\353\321\022\301's\013\306\2775A\f\251\350\246\313\236\022\n\313*V&{3Sru\274"
+	.string	"\nr\200h\346\377x\317\225\"\fW\004\267\300\t\274\225NPu\262\020\242\305\351\346\242'`\321\277M\340;\343dhUxs\327\342Bt\203\004\323bI*\\\247\367\327\212Y\264\246\341\256B\210g)\274\023xa1#\230\343!\26113\261\003\366_i\351\007\303%\252\031\277\177\264\232\217na\026\"(\231\377\016\257\305\234X\361\037{\233,%\277\375\027K\2571\277\310\206\262\036\261\361\311\031%7~OW\255\341v\036\263[l\005\223\363\211\212nD\200{\241\212\344Wm\222\243\267\031\363\202\310E"
+	.string	"U\372\004\nC\211Q\347\013\026\301\234\314\372\236\222 S\203w\317\024\r\366\262#V\\M\005\242\353g\321\016\264\240\027\376\256\345\020'v\241/\033C"
+	.string	"T]"
+	.ascii	"\027(\235\250\305\262t\275\203\275uj\354?.\301\235\262~\031\277"
+	.ascii	"_\375g\206\330s\375D.\272\252j&t\200 \221O\266\316\371\351\354"
+	.ascii	"\276\016\244KE\013\035.p\326\311A\3212c8\265\344\302\tk\2049"
+	.ascii	"$\362\300\004\312\033\034T<,v\f\275\205g\"f\233\236]\213\370"
+	.ascii	"><\331V\320\207\214\341\235\322H\212\326\301\231\360V\016\233"
+	.ascii	"\362\212`$:\016\020xV\301\255\263\372\322\t\013\026{\371\372"
+	.ascii	"\342\221~Y\303\253\325\341\307P\343\3502\021\211v\247p\213\245"
+	.ascii	"\303\305X \251\352\017\332V\304e\311j\327\t\230=\b\261\264\261"
+	.ascii	"-k)\332B\361\347\376N\216\375 K\361\226H\001\025\325\274\315"
+	.ascii	"\204\244\204\245z\346\372\273/W\374\332\007\232,4+\022$\206\363"
+	.ascii	"\214Mv\242\277\005\267\006\027\300(\032(o\251t\214\373/\033\323"
+	.ascii	"r?\036W\304\214:B@\211W\310ybq\332\260Ac\277\340\216\212\324"
+	.ascii	"u3dC(\210\210\257\234\263~\366\252me\250\r\254z\322\316\211\247"
+	.ascii	"0L\274\2659>e\233\227\272{\031S}\327'4\327r\320/\244\342_C\346"
+	.ascii	"Y\271/\016@\205\371\272tJ\003\301\361H\2274\264x\330\177\022"
+	.ascii	"K,6F:aN\023Q\"a\225\347\023\376P'\217\304Z\t?o\311\276\331\255"
+	.ascii	"\201\351\201gi\007\\CU\351`;H\357\217CC\212\321\374\223\016\310"
+	.ascii	"\fN\243\t&@9\021\020Y\367\313|a\350\"E@\224\202A\240C\177\004"
+	.ascii	"}'fa#\304]\216\016\305Q\363s\001\334\t\373\342\n\n\250\263s\364"
+	.ascii	"R\217\220\031\216"
+	.string	"E\365\036\210\264a\272\334\303\021\334\204\222z\001\305\205)t\267\241C\367\202\210\354\332\227\206\314\235\247\253$\277\312~\267\330\254\200\2253A\n\034\214\243\0370\276\245\220%\355\265\322_G\177\344s\261U{\304'\331#\2457\227\200\326\264\234T1\242\340\233Tm%\216Awpv\333\244\311T^\277y\001G\027\357\315f\347\025+#'\342g\243\020\264\265W\356\242\371\312\341\365\b\263\225\254\021\346\030\021\304K\006\r\210A\3315\214\256\227'\334M\345\301\020/z\254\002\331I\352\001\243\356y0\224\206\365_\352\201j\305\b\026\330\023\316\377e\"\222\271\323\245\266\r\217\027\203\363\257\t\250\247\256\310S\320\024)\022\245\n\366e\325\327\"s;\210C\201\006-b\274\341k\201\3276\261\2470\275T\035\264\025\267#^\345\001\353P0\224\017\201\207m\231\220\253s\202:Z0\234,"
+	.string	"\007\342Gnx/\030\255;>\267\242QV(Mg<\220\305S\002Yz\354\354\033\307\260\206\227\342s\0264\215.f\023\245\263\030\003\235\006hE(\324\220B\277%\223\341\216\322\302\237\3770M5\214\205\215\260@\201\205Iud\216\321\260b\214VeF\005\224\314\267"
+	.string	"k\037\240\017\005\031\354\253d\252\343\322\321g#\211\264\215|^\374\353\250V\274Q\r\307&\335o\216\027\314,\025\035d\260\241-\224:\nvu\006\206\247\001"
+	.ascii	"\344\200 =\022\211\020B\262\243\305yo\"\232\037\340\302\211\275"
+	.ascii	"\264\247-\205\314){\016\245<\343\201\235\b\t>\034L{0\036\205"
+	.ascii	"\021``\366\312\005\027\232\317\356P=\211\212?*\325K\f\270\317"
+	.ascii	"\367,\355-&\263'\3738B\034\263\f\027\352\323\357\021.\204\232"
+	.ascii	"6L,1\025r\210--\023,- \230\246\234^ kB\022<\272\200_\274\371"
+	.ascii	"J\332"
+	.string	"\361\324\337\007A\205\016\234s/\351>%\272mhM\277\361\324\335\332`\322:bt\2100\353GP+$\224\246I\221\002\227\022#\232\367g\r9T\b\020\031\251\2428\257\006n\"\304H\3167\370\210e((U\002\265\3617\211\354w\303h\357\300\003\016\221k\221\023\274A\335u\356\027i\005a\220\002RB1!\016\177\354ge\307\340\315\032\342j\373~wy\f\"8\270\317+'*_\326\311\267P\0026\244\375,\223\232'\317\324l\233\306\314\352\321\306 \246W\242\334\365Tk\005\022\317zfV.\214\020\024&T\321o\022\027\333\226\242\306\331\257\305\013\247\017\364\232HC\270\017T\232\211\217dG\033\316\345\bY\211C\214SA\330\t\022\232R\352\335\020Y\331\250\251\222hh\021\r\324 \225\243\\;Vj`\020Y@\260\226#V\366\327\370@Oq\232\b?\323\016Q\3342aG\225h\2002\316\241"
+	.string	"\033\224\300\314X\354j\202\361\200\004\372\334\360"
+	.ascii	"4\272\335\032$@\360\033\301\377{\321\205\220\271\362\263\317"
+	.ascii	"\372\352\201\362RAtV>\\\022G\301\237\256\270\310\302\020{yn\222"
+	.ascii	"\017\n\262\250Z\241\313\213\340f8`q\264\325\311*\t\276\261M\031"
+	.ascii	"\r(\233]6\315\020\217\331\374\242_\023\032\230\235\023"
+	.string	"\247_\275w\351\\\344\361H\022\263\r\206\340\376\330\236\251\255\264V\250Us\257\343\370,\310[t\275\017\314n\243\025f\004\315\006\251\031\331\003\321y\177\374\217\003X\362\366\027z]\004\272\225\007PEe\026I\032K\314\236\222\216\023T:]\006\300\266\314\366\031\257f\332\250\016\241d\2359?F\357\226v-Y\315S0!)\230\350\260\267\022\355\362\220/\246\016p\363%\031\177R\255\233F\022l\355\031#\007w\003\350\225Z$;\230\241!\226xl%8\034\201>\236\312\313\370<\360V`,1\262\344\366\360\271\241\t\024\035\206p\220\264\276\225u(\277\216\236h\035s\n\274p\260\364l\201\210\234\374%\016o^F\\\203f\361\310\330\370\347\006\247\316\352R\211\017Lw_\310\377\227\025\202\311\303|\323\002^\320\334Bd|\323\374\030\223ZB\177\264\013\205H`&\3749\3040\267\213b\213\226\253\360@e/"
+	.string	"ySC\300\326\366\351O\r\260\212 \001n]\350h]\265\251\260\256\233\250\332\333\250\216P\327\341\240\025{b\230\250\350P\251\246\271[\022\333;)\301T\316\330n\265F\224\fk\013?\027\327\036\263\343\330\367W\346\332\t\"\003\304{C\273qXK0,\326\202\003[\356\341\004i\035\017\365\034\261\333\265-\215\357\217`\355\222\362SX+\327\013\3610dx\244\314\255\270j\301)o\240cY"
+	.string	"\311%\213\nJO\346\216\"\235s\253 j*&t\376(\246\236E5\322\007\301\261)\2015\0215Y\332\226\222C,\313\220?X\371+\ro\220\330\341\374+\356\026\214\212n\246\"#\250\332y\245\232r\205\200\347\030\265]\004G&_G:\244`\2655\3007\00446\334\327cJI\317J[\352D`\t\320%\372\270\001\220\032"
+	.ascii	"\004-\311\317-\321u\026,\340-^\037\207\205\004Z\206E\355D\341"
+	.ascii	"\300*\230\351#\265\237\223\355kA\366\023`\277\247\b\334\226\206"
+	.ascii	"?\220\t\036<\022\321\"\001\310\364\331i2\362\242\364a\320\373"
+	.ascii	"*\006\30217\030\024\b\257q\023xrn\265N\003\235\024\265\230<Q"
+	.ascii	"ja=m\3310\2102\331\211\2449\325.\207\253\241\032O\273y\210\224"
+	.ascii	"\023H\237\267\003t\001\370=\302J\200\312\265\364\241\177O\342"
+	.ascii	"\217\237ht6\221>g\366\347\224UD\0211t\035\272F5\212M\245\261"
+	.ascii	"\246"
+	.string	"\330\267\345\252H0\266\370:\350c\272(\326ozf\252\352q\227\344\305\002\266\261\237V'\376Q\315\273L\324]BC\t\334\223`P\337;\335]\301\364)\355\214\263\005\223\271\016$q\333\210\340{(\n\316Z\np\354\252\260\355S:\254\322\354\356:\030\314Q\302#\020iO\224\003\233#<#\230'S\033M&\235\326E\307\203\302`1\343\340_#\365\233%T\347Q\325K\252\330\323\267\332\373\245\002>\214\2223\346\262h\020\272>\313\340G\253%L\201\336/N\266\355\334\373C\340~0\245\0046x\334\022\337\215\342\246I\242\234\n2\371\354\020\020i\346\013\252\232g\342xpD6\271\277\372BM'`M\\\"\312a\006\272\367\232\367\347-?\377h\203\275\213\276\305b\267\306\214\277\204a\206c#(\022\302Z\210\251\327\220\246^\240\275n3l\201\024`\034=\211\034I\220\022;ktwqc\267\212"
+	.string	"iB\225\340z\344\023\240\\\230\004\206a\374o\006,<\325(eU\343\214w\353#f=\366\351\037w\353N\\\347'\261\251S\234&S\177\333*\f\001r\213\271z]6\331\210\313\233\214\332=\031f\254)\0250pd\"\035\341\016Y\213\305\261\226\273\251\352\337i\234\356\202\211k\347\330(w\366\376\373\307\255\322\f\242\342\376C\021R|\370\241\020\342\030\210\240\274\330ea\344\bi\370\324#\034E\357\250%p_\266O\320\311\264\362\217\005L\3520\244\001\307Y%\270\261\026\370\032\035\231XI"
+	.string	"\203C\245\314\366G\002%\215-G\254\020\204!\266\253o)(j-d@\215V\332\300D\202k\2132\251\221\302d}\264\214L\204\230\267\205\236P\365\331/\022h\376H\241"
+	.ascii	"F\031\353:\031\232\032*V=U\275' \260\td\261\373\001F\340\032"
+	.ascii	"\303|\230E;\364\326S2\250\305\262\231'\351Q!\310"
+	.string	"\367\304\306\333\037\177\215\300\310=\001\224\n\307\257\230\306\375\375l\330\013\362\020`\361\270\247\255\337\330&\273WW*w\001\225+\216N3M\"\022WU0\213\343\232\300P9\237!\310DK6;\334\036\344\321\241\337~\251&\311\376\312\214O\323\006T\336V\361\217\266\\\t\213%mAT \224\240\201\201\261\005\355\177\302`\001\362A\347\247}\231l*c<"
+	.ascii	"\320;\212\302R\364\202\265\350q&\023y\342\305\373$ \236\245\247"
+	.ascii	"a\221\223\315ed\323]\2610\bx\2732\201\202\341G\022\242\204U\373"
+	.ascii	"d\007h\254\025\243\031\2315\216\252\202\277-\025\333\002\030"
+	.ascii	"k\230Q\303,\216lxG\370R0<\241\270]\342O\244{b\352\263\3017\t"
+	.ascii	"i\357\032\037N\343t\373\341~\261\353m\310@\3769\362\375;\t\326"
+	.ascii	".\326\352\3441Q\177|\255\234\237{\007\205.\345\376\266\264\346"
+	.ascii	"c\021\231I\252\r\372\030\355\304\242<\266\002\004\344}\273\272"
+	.ascii	"\371\336\345\332\234\223\020\347\222YM\337\2269\205\347\235z"
+	.ascii	"[\213\271\213\326\025\237m\343\230\305\345Q\211\330\254\271\024"
+	.ascii	"\307*T\247\223\327\355\225\373\"\240#\\\376\337\277\002\335;"
+	.ascii	"\226"
+	.string	">\330\213 l\270\276\271\021\002\276\021\375Vd\370\223\353\342>7\342\275+\337\311\312j5a|Sd\317\331\3138\262\230\354\340\356YK`\327\330\277\272~\230\016\377\3238\022\331\207\3711\222\004\372\210\236\023O\033\3622\220\024O)\357(!\335$\362\267\306aH\267\315\320b\206o\341\377sc\367S\337]\300{\212}E\337\020\200\303`?\331\376\232M\263\275\273\004q`\242\251I\f\037\321\203f\245e\003\364\027Z8%\332l\360z\261\033\213\335:\316\023T\376%3\023V\317\0270R\304^$\361{\251]\0206\236vx\003\233\214\313\177\332\230N\332~k\266\317\333^0\346\322\372L=\341\317\3307K\367\367\345)\302\326\221\205\036\276\205\216\235\235\342\352M\343\201\2217(\332\273\363\265\260\215\031>{:\347\374\376\347\037`\225E\237\305\263\336N6\007\036\347\240\273\003\356\221\371\036\340\025+\267Z\233"
+	.string	"e/ r\207\277\rV'\002?\300?\004l\326\354\2119\334`\325\245\252=\210\311?\035\365\225<\226\n'\227\276\227vX^}"
+	.ascii	"\031c>\227\217\363a>c\221o\244\274\230\273\316{\353f\031\370"
+	.ascii	"\027\356,\201\3077M\027\007<p\367\312\375V\215s\b\370D\366\013"
+	.ascii	"\201\036t\247`\263~\224\007,\361\321\276\017\205\376\201\306"
+	.ascii	"\336\337;\344\037\035\374\215\334\361c\344\340\321\036h9\253"
+	.ascii	"\3042\214sY\270\375\366Z\275i\337\205u\314\031\277\215\311\321"
+	.ascii	"\270\305\036\236\225o\001\324%0\013QM\264\032\266;W\n/\274\356"
+	.ascii	"\325\271\265\303\226\312`\365\205\026\377V\347\r\3150\260\347"
+	.ascii	"\301\354t\321h\307\262\246ij\332#_=\350{*\026\026`\266\302Mm"
+	.ascii	"\0164,\220\233\244C\376\352\027y\361\263*4gj\227\343oZ\320\r"
+	.text
+	.section	.gnu.lto_.symtab.c2f916ca4449eec7,"e",@progbits
+	.string	"gyro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"gyroInitFilterLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"gyroInitFilterNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"gyroInitFilterDynamicNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"gyroUpdateSensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"gyroSampleIsDue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"gyroSamplePush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"gyroSamplePop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"gyroSampleCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"gyroSamplesDropped"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gyroSensorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"gyroSensorHealth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"pgResetTemplate_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"filterBankApplyStages"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"filterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"filterBankAddPt1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"filterBankAddBiquadLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"filterBankAddBiquad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\004"
+	.string	""
+	.string	"filterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c2f916ca4449eec7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
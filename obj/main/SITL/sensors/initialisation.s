@@ -0,0 +1,11873 @@
+	.file	"initialisation.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/resource.h"
+	.file 5 "./src/main/sensors/sensors.h"
+	.file 6 "./src/main/sensors/acceleration.h"
+	.file 7 "./src/main/drivers/barometer/barometer.h"
+	.file 8 "./src/main/sensors/barometer.h"
+	.file 9 "./src/main/sensors/gyro.h"
+	.file 10 "./src/main/sensors/compass.h"
+	.file 11 "./src/main/target/SITL/target.h"
+	.file 12 "./src/main/sensors/initialisation.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	initialisation.c.a9f275af
+	.weak	initialisation.c.a9f275af
+initialisation.c.a9f275af:
+	.long	0x5ac
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xe
+	.long	.LASF1835
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1686
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1687
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1688
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1689
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1690
+	.uleb128 0x3
+	.long	.LASF1692
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1691
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1694
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1695
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1696
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1697
+	.uleb128 0x3
+	.long	.LASF1698
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1699
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1700
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x10
+	.long	.LASF1836
+	.byte	0xb
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb5
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1702
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1703
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1704
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x4
+	.byte	0x14
+	.long	0x208
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x232
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0x9d
+	.long	0x242
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1799
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x10
+	.long	0x232
+	.uleb128 0x6
+	.long	0x253
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1757
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1758
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x6
+	.byte	0x19
+	.long	0x2ce
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1775
+	.byte	0x7
+	.byte	0x14
+	.byte	0x10
+	.long	0x24e
+	.uleb128 0x3
+	.long	.LASF1776
+	.byte	0x7
+	.byte	0x15
+	.byte	0x10
+	.long	0x2e6
+	.uleb128 0x6
+	.long	0x2eb
+	.uleb128 0x12
+	.long	0x2fb
+	.uleb128 0x7
+	.long	0x2fb
+	.uleb128 0x7
+	.long	0x2fb
+	.byte	0
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x9
+	.long	.LASF1791
+	.byte	0x30
+	.byte	0x7
+	.byte	0x17
+	.long	0x368
+	.uleb128 0x2
+	.long	.LASF1777
+	.byte	0x7
+	.byte	0x18
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0x7
+	.byte	0x19
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x13
+	.long	0x2ce
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x13
+	.long	0x2ce
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1781
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x13
+	.long	0x2ce
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x13
+	.long	0x2ce
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x2da
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1784
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x3
+	.long	0x300
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x8
+	.byte	0x17
+	.long	0x39e
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1790
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x3
+	.long	0x374
+	.uleb128 0x9
+	.long	.LASF1792
+	.byte	0x8
+	.byte	0x8
+	.byte	0x21
+	.long	0x3f8
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0x8
+	.byte	0x22
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1794
+	.byte	0x8
+	.byte	0x23
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1795
+	.byte	0x8
+	.byte	0x24
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1796
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.long	0xa9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1797
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0xa9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1798
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0x3aa
+	.uleb128 0x13
+	.long	0x3f8
+	.uleb128 0x8
+	.long	.LASF1800
+	.byte	0x8
+	.byte	0x29
+	.byte	0x1a
+	.long	0x3f8
+	.uleb128 0x9
+	.long	.LASF1801
+	.byte	0x38
+	.byte	0x8
+	.byte	0x2b
+	.long	0x449
+	.uleb128 0x14
+	.string	"dev"
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xf
+	.long	0x368
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1802
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xd
+	.long	0x91
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1803
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xd
+	.long	0x91
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1804
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x415
+	.uleb128 0x8
+	.long	.LASF1805
+	.byte	0x8
+	.byte	0x31
+	.byte	0xf
+	.long	0x449
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x4c7
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0xe
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1821
+	.byte	0x10
+	.byte	0x9
+	.byte	0x40
+	.long	0x4ee
+	.uleb128 0x2
+	.long	.LASF1822
+	.byte	0x9
+	.byte	0x41
+	.byte	0xe
+	.long	0xb5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1823
+	.byte	0x9
+	.byte	0x42
+	.byte	0xb
+	.long	0x4ee
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0xd4
+	.long	0x4fe
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1824
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x4c7
+	.uleb128 0x8
+	.long	.LASF1825
+	.byte	0x9
+	.byte	0x45
+	.byte	0xf
+	.long	0x4fe
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xa
+	.byte	0x1b
+	.long	0x540
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x4
+	.byte	0
+	.uleb128 0x15
+	.long	0x242
+	.byte	0xc
+	.byte	0x29
+	.byte	0x9
+	.uleb128 0xc
+	.long	.LASF1831
+	.byte	0x8
+	.byte	0x33
+	.long	0xdb
+	.long	0x562
+	.uleb128 0x7
+	.long	0x562
+	.uleb128 0x7
+	.long	0x39e
+	.byte	0
+	.uleb128 0x6
+	.long	0x368
+	.uleb128 0xd
+	.long	.LASF1833
+	.byte	0xa
+	.byte	0x35
+	.long	0xdb
+	.uleb128 0xc
+	.long	.LASF1832
+	.byte	0x6
+	.byte	0x4a
+	.long	0xdb
+	.long	0x587
+	.uleb128 0x7
+	.long	0xb5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1834
+	.byte	0x9
+	.byte	0x61
+	.long	0xdb
+	.uleb128 0x16
+	.long	.LASF1837
+	.byte	0xc
+	.byte	0x39
+	.byte	0x5
+	.long	0xdb
+	.uleb128 0x17
+	.long	.LASF1838
+	.byte	0x8
+	.byte	0x29
+	.byte	0x88
+	.long	0x5aa
+	.uleb128 0x6
+	.long	0x404
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF529
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF547
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF570
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF630
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF698
+	.byte	0x4
+	.file 29 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.file 35 "./src/main/target/common_fc_pre.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x9f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 36 "./src/main/target/common_fc_post.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 38 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.file 39 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.file 40 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 42 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2a
+	.file 43 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.file 44 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 45 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 50 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 51 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1434
+	.byte	0x4
+	.file 52 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.file 53 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 54 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 55 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1444
+	.byte	0x4
+	.file 56 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6
+	.file 57 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.file 58 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 59 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3d
+	.byte	0x4
+	.file 62 "./src/main/drivers/accgyro/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1553
+	.file 64 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1555
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1556
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1565
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1570
+	.byte	0x4
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 72 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1603
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1604
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1605
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1606
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1608
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1609
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1610
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1611
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1623
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1630
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1631
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1632
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1635
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x58
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1636
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1667
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1668
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.file 90 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1669
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0x4
+	.file 91 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x5b
+	.file 92 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 93 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5d
+	.file 94 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 95 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5f
+	.file 96 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x60
+	.byte	0x4
+	.byte	0x4
+	.file 97 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x61
+	.file 98 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1685
+	.byte	0x4
+	.file 99 "./src/main/sensors/initialisation.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF467
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF719
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_pre.h.20.ff8a851cf90ded9d1d7ea8a03dbc0ac5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.21.8f96bc535495f947676007018b761a03,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF819
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF832
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF836
+	.byte	0x2
+	.uleb128 0x82
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF841
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.163.9fbb7036f5a9a2fdf3b538aa6e87da28,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_fc_post.h.35.e2b87ab9ba9e898d1df1c35fc5c77b83,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x23
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.efb934c5dbd861df79e206eeb52087ee,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.59.269ede80b73497e8c6b8083eb7e108bf,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF952
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.4d904e2259a468ab7816e7c6f1dae206,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1039
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.35a1f1a218fff79aced2dbf2e04d2433,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1043
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.69dcf12d286bc4eca446aa68097a81ef,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1053
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.30.0eefc6bd4a58f9128b2a250f5dedead8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1433
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.27.6da04b3048ef642b1b8add711b9c7ab1,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1440
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.28.a65251eee043d7c67b5854b20f69a2d5,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.31.21cef2524ef97285356b8b703d204e54,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF722
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1560
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.21.1f3eb4a9831fcf790f46c9e4cef5237a,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sched.h.47.6980b6f6208683ca72242049c0cd7055,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1587
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1602
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1634
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthread.h.40.dc07d1ebf494e4a61ca20b3d8502d62e,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1657
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.31.32d901da8993053a95b4b1f3fdb24a5d,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.44.b0a8ab6fef96453518192a5f0b541d52,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1672
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1676
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.filter.h.23.e446e47240c06c36d4143412b4ae381b,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1680
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1684
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1839
+	.long	.LASF1840
+	.long	.LASF1841
+	.long	.LASF1842
+	.long	.LASF1843
+	.long	.LASF1844
+	.long	.LASF1845
+	.long	.LASF1846
+	.long	.LASF1847
+	.long	.LASF1848
+	.long	.LASF1849
+	.long	.LASF1850
+	.long	.LASF1851
+	.long	.LASF1852
+	.long	.LASF1853
+	.long	.LASF1854
+	.long	.LASF1855
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x64
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1856
+	.byte	0xd
+	.long	.LASF1857
+	.byte	0xd
+	.long	.LASF1858
+	.byte	0xd
+	.long	.LASF1859
+	.byte	0x6
+	.long	.LASF1860
+	.byte	0x8
+	.long	.LASF1861
+	.byte	0x8
+	.long	.LASF1862
+	.byte	0x5
+	.long	.LASF1862
+	.byte	0x8
+	.long	.LASF1863
+	.byte	0x8
+	.long	.LASF1864
+	.byte	0x8
+	.long	.LASF1865
+	.byte	0x9
+	.long	.LASF1866
+	.byte	0x8
+	.long	.LASF1867
+	.byte	0x10
+	.long	.LASF1868
+	.byte	0x11
+	.long	.LASF1869
+	.byte	0x11
+	.long	.LASF1869
+	.byte	0x10
+	.long	.LASF1870
+	.byte	0xd
+	.long	.LASF1871
+	.byte	0x10
+	.long	.LASF1872
+	.byte	0x10
+	.long	.LASF1873
+	.byte	0xd
+	.long	.LASF1874
+	.byte	0xd
+	.long	.LASF1875
+	.byte	0xf
+	.long	.LASF1876
+	.byte	0xd
+	.long	.LASF1877
+	.byte	0xe
+	.long	.LASF1878
+	.byte	0xe
+	.long	.LASF1879
+	.byte	0xd
+	.long	.LASF1880
+	.byte	0xd
+	.long	.LASF1881
+	.byte	0xd
+	.long	.LASF1882
+	.byte	0x10
+	.long	.LASF1883
+	.byte	0x11
+	.long	.LASF1884
+	.byte	0xc
+	.long	.LASF1885
+	.byte	0xc
+	.long	.LASF1886
+	.byte	0x10
+	.long	.LASF1887
+	.byte	0xb
+	.long	.LASF1888
+	.byte	0xa
+	.long	.LASF1889
+	.byte	0xa
+	.long	.LASF1890
+	.byte	0x2
+	.long	.LASF1891
+	.byte	0x3
+	.long	.LASF1892
+	.byte	0x3
+	.long	.LASF1893
+	.byte	0x1
+	.long	.LASF1894
+	.byte	0x3
+	.long	.LASF1895
+	.byte	0x7
+	.long	.LASF1896
+	.byte	0x6
+	.long	.LASF1897
+	.byte	0x6
+	.long	.LASF1898
+	.byte	0x6
+	.long	.LASF1899
+	.byte	0x6
+	.long	.LASF1900
+	.byte	0x6
+	.long	.LASF1901
+	.byte	0x6
+	.long	.LASF1902
+	.byte	0x6
+	.long	.LASF1903
+	.byte	0x6
+	.long	.LASF1904
+	.byte	0x6
+	.long	.LASF1905
+	.byte	0x6
+	.long	.LASF1906
+	.byte	0x6
+	.long	.LASF1907
+	.byte	0x6
+	.long	.LASF1908
+	.byte	0x6
+	.long	.LASF1909
+	.byte	0x7
+	.long	.LASF1910
+	.byte	0x4
+	.long	.LASF1911
+	.byte	0x2
+	.long	.LASF1912
+	.byte	0x6
+	.long	.LASF1913
+	.byte	0x6
+	.long	.LASF1914
+	.byte	0x6
+	.long	.LASF1915
+	.byte	0x4
+	.long	.LASF1916
+	.byte	0x10
+	.long	.LASF1917
+	.byte	0x10
+	.long	.LASF1918
+	.byte	0xc
+	.long	.LASF1919
+	.byte	0xc
+	.long	.LASF1920
+	.byte	0xd
+	.long	.LASF1921
+	.byte	0xd
+	.long	.LASF1917
+	.byte	0xd
+	.long	.LASF1922
+	.byte	0xc
+	.long	.LASF1923
+	.byte	0xd
+	.long	.LASF1924
+	.byte	0x10
+	.long	.LASF1924
+	.byte	0xd
+	.long	.LASF1925
+	.byte	0xc
+	.long	.LASF1926
+	.byte	0xc
+	.long	.LASF1927
+	.byte	0xc
+	.long	.LASF1928
+	.byte	0xc
+	.long	.LASF1929
+	.byte	0xc
+	.long	.LASF1930
+	.byte	0xd
+	.long	.LASF1931
+	.byte	0xd
+	.long	.LASF1932
+	.byte	0xd
+	.long	.LASF1933
+	.byte	0xd
+	.long	.LASF1934
+	.byte	0xd
+	.long	.LASF1935
+	.byte	0xd
+	.long	.LASF1936
+	.byte	0xd
+	.long	.LASF1937
+	.byte	0xc
+	.long	.LASF1938
+	.byte	0xc
+	.long	.LASF1939
+	.byte	0xd
+	.long	.LASF1940
+	.byte	0xd
+	.long	.LASF1924
+	.byte	0x2
+	.long	.LASF1941
+	.byte	0x8
+	.long	.LASF1942
+	.byte	0x6
+	.long	.LASF1943
+	.byte	0x8
+	.long	.LASF1944
+	.byte	0x2
+	.long	.LASF1945
+	.byte	0x8
+	.long	.LASF1946
+	.byte	0x8
+	.long	.LASF1947
+	.byte	0x8
+	.long	.LASF1948
+	.byte	0x8
+	.long	.LASF1949
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1827:
+	.string	"MAG_NONE"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"DEFIO_TAG__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF1679:
+	.string	"FILTER_BANK_MAX_STAGES 4"
+.LASF1061:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1255:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"DEFIO_REC__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"DEFIO_REC__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF760:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1685:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1570:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF1087:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1072:
+	.string	"DEFIO_PORT_C_USED_MASK 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF877:
+	.string	"_WCHAR_T_DEFINED "
+.LASF767:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF469:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1037:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF734:
+	.string	"USE_CLI "
+.LASF1801:
+	.string	"baro_s"
+.LASF1804:
+	.string	"baro_t"
+.LASF811:
+	.string	"USE_UART7 "
+.LASF1172:
+	.string	"DEFIO_TAG__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__SQUAD_TYPE long int"
+.LASF1586:
+	.string	"sched_priority sched_priority"
+.LASF821:
+	.string	"USE_PPM"
+.LASF457:
+	.string	"__USE_MISC 1"
+.LASF1429:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF740:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1070:
+	.string	"DEFIO_PORT_B_USED_COUNT 0"
+.LASF1328:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"USE_FAKE_GYRO "
+.LASF1524:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1565:
+	.string	"__pid_t_defined "
+.LASF1557:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF935:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF635:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF520:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF823:
+	.string	"SERIAL_RX"
+.LASF848:
+	.string	"LED_STRIP_TIMER 1"
+.LASF1752:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1692:
+	.string	"__uint8_t"
+.LASF631:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1587:
+	.string	"__sched_priority sched_priority"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_E__NONE"
+.LASF936:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1704:
+	.string	"_Bool"
+.LASF541:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF812:
+	.string	"USE_UART8 "
+.LASF1274:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"U_ID_2 2"
+.LASF801:
+	.string	"USE_FLASHFS "
+.LASF908:
+	.string	"CONCAT2(_1,_2) CONCAT(_1, _2)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1046:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1572:
+	.string	"__CPU_SETSIZE 1024"
+.LASF1616:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF762:
+	.string	"TELEMETRY_SRXL "
+.LASF473:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1596:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF1713:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_E__NONE"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1234:
+	.string	"DEFIO_REC__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1050:
+	.string	"IOCFG_AF_OD 0"
+.LASF460:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF392:
+	.string	"__REVISION__ \"5cc34a2\""
+.LASF424:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1352:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF400:
+	.string	"_STDINT_H 1"
+.LASF950:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1499:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1449:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1057:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF869:
+	.string	"__WCHAR_T__ "
+.LASF768:
+	.string	"USE_SENSOR_NAMES "
+.LASF1421:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"DEFIO_REC__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1799:
+	.string	"detectedSensors"
+.LASF990:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF395:
+	.string	"_STDBOOL_H "
+.LASF1260:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1393:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1544:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1339:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1710:
+	.string	"OWNER_LED"
+.LASF1838:
+	.string	"barometerConfig"
+.LASF1163:
+	.string	"DEFIO_TAG__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1109:
+	.string	"DEFIO_TAG__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1700:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF627:
+	.string	"__FD_SETSIZE 1024"
+.LASF585:
+	.string	"__STD_TYPE typedef"
+.LASF975:
+	.string	"PG_RX_CONFIG 24"
+.LASF1576:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1258:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1204:
+	.string	"DEFIO_REC__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"TELEMETRY_HOTT "
+.LASF736:
+	.string	"USE_CLI_BATCH "
+.LASF1443:
+	.string	"BEEP_ON do {} while (0)"
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1327:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF894:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1832:
+	.string	"accInit"
+.LASF1054:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF858:
+	.string	"_T_PTRDIFF_ "
+.LASF1532:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF639:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF574:
+	.string	"__U32_TYPE unsigned int"
+.LASF1469:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF986:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF815:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF422:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1666:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF924:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1788:
+	.string	"BARO_MS5611"
+.LASF778:
+	.string	"USE_UNCOMMON_MIXERS "
+.LASF1670:
+	.string	"GYRO_CONFIG_USE_GYRO_1 0"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1080:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF413:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1678:
+	.string	"FILTER_BANK_MAX_CHANNELS 3"
+.LASF692:
+	.string	"UINT8_C(c) c"
+.LASF1384:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"INT16_MAX (32767)"
+.LASF532:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF594:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1012:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF994:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1507:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1285:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1420:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1717:
+	.string	"OWNER_SERIAL_RX"
+.LASF623:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1809:
+	.string	"GYRO_L3G4200D"
+.LASF492:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1631:
+	.string	"__have_pthread_attr_t 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF952:
+	.string	"CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)"
+.LASF1088:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1053:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF938:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF921:
+	.string	"BIT(x) (1 << (x))"
+.LASF1741:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1042:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1301:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1698:
+	.string	"int32_t"
+.LASF824:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF387:
+	.string	"HSE_VALUE 8000000"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF471:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF799:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1831:
+	.string	"baroDetect"
+.LASF1525:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF725:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_E__NONE"
+.LASF1406:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF879:
+	.string	"___int_wchar_t_h "
+.LASF1749:
+	.string	"OWNER_SPI_PREINIT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1342:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"__USE_ISOC11"
+.LASF1059:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1112:
+	.string	"DEFIO_TAG__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_E__NONE"
+.LASF836:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF845:
+	.string	"VTX_TRAMP"
+.LASF542:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1738:
+	.string	"OWNER_BARO_EXTI"
+.LASF971:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1800:
+	.string	"barometerConfig_System"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1675:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF515:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF822:
+	.string	"USE_PWM"
+.LASF1207:
+	.string	"DEFIO_REC__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1153:
+	.string	"DEFIO_REC__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF919:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1716:
+	.string	"OWNER_SERIAL_TX"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS"
+.LASF912:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF991:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF632:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1004:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1005:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1600:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF1823:
+	.string	"gyroADCf"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF661:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1135:
+	.string	"DEFIO_REC__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF604:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF816:
+	.string	"STACK_CHECK"
+.LASF498:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF706:
+	.string	"_T_SIZE_ "
+.LASF1612:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1435:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1696:
+	.string	"long int"
+.LASF488:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1441:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF528:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF763:
+	.string	"USE_DASHBOARD "
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1503:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1322:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF549:
+	.string	"__stub_chflags "
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"SCHED_RR 2"
+.LASF1604:
+	.string	"__struct_tm_defined 1"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1817:
+	.string	"GYRO_ICM20608G"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1213:
+	.string	"DEFIO_REC__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF819:
+	.string	"USE_ADC"
+.LASF1836:
+	.string	"SystemCoreClock"
+.LASF1023:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF398:
+	.string	"false 0"
+.LASF1751:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF688:
+	.string	"INT8_C(c) c"
+.LASF947:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"_GCC_SIZE_T "
+.LASF553:
+	.string	"__stub_setlogin "
+.LASF1385:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1622:
+	.string	"__ONCE_ALIGNMENT "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__stub_stty "
+.LASF1472:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF949:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF556:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1446:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF690:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1761:
+	.string	"ACC_ADXL345"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1660:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1304:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"DEFIO_REC__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF1110:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_E__NONE"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1018:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"FLASH_SIZE 2048"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1757:
+	.string	"long long unsigned int"
+.LASF1721:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF527:
+	.string	"__attribute_copy__"
+.LASF1345:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1291:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1115:
+	.string	"DEFIO_TAG__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1027:
+	.string	"PG_VTX_CONFIG 515"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1709:
+	.string	"OWNER_SERVO"
+.LASF923:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF793:
+	.string	"ACC "
+.LASF1585:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF1473:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF508:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF759:
+	.string	"TELEMETRY_IBUS "
+.LASF738:
+	.string	"USE_PWM "
+.LASF1375:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF870:
+	.string	"_WCHAR_T "
+.LASF818:
+	.string	"TELEMETRY_LTM"
+.LASF1452:
+	.string	"FLIGHT_MODE_BOXID_MAP_INITIALIZER { BOXANGLE, BOXHORIZON, BOXMAG, BOXBARO, BOXGPSHOME, BOXGPSHOLD, BOXHEADFREE, -1, BOXPASSTHRU, BOXSONAR, BOXFAILSAFE}"
+.LASF1658:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF1444:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1156:
+	.string	"DEFIO_REC__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1102:
+	.string	"DEFIO_REC__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF1450:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1486:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF937:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1830:
+	.string	"MAG_AK8963"
+.LASF864:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF670:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1458:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF687:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1693:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1708:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF890:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1432:
+	.string	"DEFIO_PORT_USED_LIST "
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_E__NONE"
+.LASF445:
+	.string	"__USE_POSIX 1"
+.LASF1540:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF408:
+	.string	"__USE_POSIX"
+.LASF1735:
+	.string	"OWNER_RX_SPI_CS"
+.LASF880:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF654:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1523:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1442:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF539:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF896:
+	.string	"USART8 ((USART_TypeDef *)0x0008)"
+.LASF1626:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF441:
+	.string	"_POSIX_SOURCE"
+.LASF1829:
+	.string	"MAG_AK8975"
+.LASF668:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1811:
+	.string	"GYRO_L3GD20"
+.LASF1148:
+	.string	"DEFIO_TAG__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"SKIP_IMU_CALC "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1237:
+	.string	"DEFIO_REC__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1543:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF525:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1813:
+	.string	"GYRO_MPU6500"
+.LASF1753:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1031:
+	.string	"PG_DASHBOARD_CONFIG 519"
+.LASF1553:
+	.string	"_PTHREAD_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_E__NONE"
+.LASF1593:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF907:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1253:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1028:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1199:
+	.string	"DEFIO_TAG__PC3 defio_error_PC3_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF769:
+	.string	"USE_VIRTUAL_CURRENT_METER "
+.LASF355:
+	.string	"__amd64 1"
+.LASF710:
+	.string	"_BSD_SIZE_T_ "
+.LASF1651:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF1686:
+	.string	"unsigned char"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_E__NONE"
+.LASF909:
+	.string	"CONCAT3(_1,_2,_3) CONCAT(CONCAT(_1, _2), _3)"
+.LASF662:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1589:
+	.string	"_BITS_TIME_H 1"
+.LASF540:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1038:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1041:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF939:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF865:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1277:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF777:
+	.string	"USE_NAV "
+.LASF984:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1294:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF733:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT 6"
+.LASF1240:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1015:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF791:
+	.string	"USE_FAKE_LED "
+.LASF1676:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1703:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF962:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF406:
+	.string	"__USE_ISOC95"
+.LASF1758:
+	.string	"long long int"
+.LASF405:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1573:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF689:
+	.string	"INT16_C(c) c"
+.LASF888:
+	.string	"GPIOA_BASE ((intptr_t)0x0001)"
+.LASF1183:
+	.string	"DEFIO_REC__PB13 defio_error_PB13_is_not_supported_on_TARGET"
+.LASF795:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1223:
+	.string	"DEFIO_TAG__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1674:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1159:
+	.string	"DEFIO_REC__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1048:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1105:
+	.string	"DEFIO_REC__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1790:
+	.string	"baroSensor_e"
+.LASF857:
+	.string	"_PTRDIFF_T "
+.LASF1494:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF536:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF415:
+	.string	"__USE_XOPEN2K"
+.LASF411:
+	.string	"__USE_POSIX199506"
+.LASF895:
+	.string	"USART7 ((USART_TypeDef *)0x0007)"
+.LASF929:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF476:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1487:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1647:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1460:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1437:
+	.string	"I2C_CFG_TO_DEV(x) ((x) - 1)"
+.LASF435:
+	.string	"_DEFAULT_SOURCE"
+.LASF1642:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF1470:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_E__NONE"
+.LASF1058:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1747:
+	.string	"OWNER_VTX"
+.LASF514:
+	.string	"__wur "
+.LASF1370:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1451:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1129:
+	.string	"DEFIO_REC__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1554:
+	.string	"_SCHED_H 1"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1671:
+	.string	"GYRO_CONFIG_USE_GYRO_2 1"
+.LASF1603:
+	.string	"__clock_t_defined 1"
+.LASF1644:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF436:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF876:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1295:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF746:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF901:
+	.string	"USE_I2C_OLED_DISPLAY"
+.LASF1730:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1502:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1391:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1337:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF636:
+	.string	"__intptr_t_defined "
+.LASF916:
+	.string	"PP_IIF_I(bit,t,f) PP_IIF_ ## bit(t, f)"
+.LASF644:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF655:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF530:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF951:
+	.string	"CONVERT_PARAMETER_TO_FLOAT(param) (0.001f * param)"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_E__NONE"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1276:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF551:
+	.string	"__stub_gtty "
+.LASF1090:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF418:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"__timer_t_defined 1"
+.LASF1202:
+	.string	"DEFIO_TAG__PC4 defio_error_PC4_is_not_supported_on_TARGET"
+.LASF672:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1187:
+	.string	"DEFIO_TAG__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1536:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF665:
+	.string	"INT_FAST8_MAX (127)"
+.LASF847:
+	.string	"USE_SPI"
+.LASF456:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1040:
+	.string	"IO_TAG_NONE 0"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1633:
+	.string	"____sigset_t_defined "
+.LASF779:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1411:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1297:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF788:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 100"
+.LASF1243:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF989:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF694:
+	.string	"UINT32_C(c) c ## U"
+.LASF1474:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF685:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1423:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1351:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1767:
+	.string	"ACC_MPU6500"
+.LASF999:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1073:
+	.string	"DEFIO_PORT_C_USED_COUNT 0"
+.LASF1793:
+	.string	"baro_hardware"
+.LASF1775:
+	.string	"baroOpFuncPtr"
+.LASF1025:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1661:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1481:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1382:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"INT64_C(c) c ## L"
+.LASF1387:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1577:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF1108:
+	.string	"DEFIO_REC__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1837:
+	.string	"sensorsAutodetect"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF427:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF584:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1369:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"_BITS_TIME64_H 1"
+.LASF1465:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF667:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF608:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1740:
+	.string	"OWNER_USB_DETECT"
+.LASF853:
+	.string	"WS2811_DMA_HANDLER_IDENTIFER 0"
+.LASF1519:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1045:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1506:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF420:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1754:
+	.string	"SENSOR_INDEX_BARO"
+.LASF516:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1009:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF572:
+	.string	"__U16_TYPE unsigned short int"
+.LASF934:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF511:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1477:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF787:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1528:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF545:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF501:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1802:
+	.string	"BaroAlt"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF852:
+	.string	"WS2811_DMA_TC_FLAG (void *)1"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF399:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1415:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF716:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF711:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1739:
+	.string	"OWNER_USB"
+.LASF1744:
+	.string	"OWNER_INVERTER"
+.LASF838:
+	.string	"TELEMETRY_IBUS"
+.LASF1599:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1725:
+	.string	"OWNER_SPI_MOSI"
+.LASF1394:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_E__NONE"
+.LASF1699:
+	.string	"uint8_t"
+.LASF550:
+	.string	"__stub_fchflags "
+.LASF576:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_E__NONE"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF914:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1755:
+	.string	"SENSOR_INDEX_MAG"
+.LASF750:
+	.string	"TELEMETRY "
+.LASF412:
+	.string	"__USE_XOPEN"
+.LASF1003:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1504:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1095:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_E__NONE"
+.LASF1639:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF434:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1205:
+	.string	"DEFIO_TAG__PC5 defio_error_PC5_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"DEFIO_TAG__PB3 defio_error_PB3_is_not_supported_on_TARGET"
+.LASF454:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF802:
+	.string	"USE_FAKE_FLASH "
+.LASF543:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF881:
+	.string	"_GCC_WCHAR_T "
+.LASF918:
+	.string	"PP_IIF_1(t,f) t"
+.LASF1769:
+	.string	"ACC_ICM20601"
+.LASF1770:
+	.string	"ACC_ICM20602"
+.LASF1505:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF589:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1036:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF684:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF647:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1333:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1246:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__need_size_t "
+.LASF1178:
+	.string	"DEFIO_TAG__PB12 defio_error_PB12_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"_ANSI_STDDEF_H "
+.LASF1624:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1271:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF438:
+	.string	"__USE_ISOC99 1"
+.LASF884:
+	.string	"_BSD_WCHAR_T_"
+.LASF837:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF756:
+	.string	"CMS "
+.LASF534:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF709:
+	.string	"_SIZE_T_ "
+.LASF615:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1578:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF820:
+	.string	"USE_VCP"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_E__NONE"
+.LASF1060:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF720:
+	.string	"__need_size_t"
+.LASF941:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF813:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF867:
+	.string	"__need_ptrdiff_t"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF728:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF920:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1819:
+	.string	"GYRO_BMI160"
+.LASF987:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF854:
+	.string	"_STDDEF_H "
+.LASF798:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF682:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1091:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1653:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF698:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF735:
+	.string	"USE_SETTINGS_INDEX "
+.LASF1602:
+	.string	"TIMER_ABSTIME 1"
+.LASF1803:
+	.string	"baroTemperature"
+.LASF697:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1177:
+	.string	"DEFIO_REC__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF969:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1214:
+	.string	"DEFIO_TAG__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1541:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF480:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF977:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF944:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1782:
+	.string	"get_up"
+.LASF1780:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF622:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1439:
+	.string	"I2C_ADDR8_MIN 8"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1776:
+	.string	"baroCalculateFuncPtr"
+.LASF1559:
+	.string	"__BIG_ENDIAN 4321"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF649:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF624:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF519:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_E__NONE"
+.LASF1289:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF831:
+	.string	"LED_STRIP"
+.LASF1324:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF731:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF695:
+	.string	"UINT64_C(c) c ## UL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF650:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1828:
+	.string	"MAG_HMC5883"
+.LASF1098:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_E__NONE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF902:
+	.string	"NOOP do {} while (0)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1094:
+	.string	"DEFIO_TAG__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1235:
+	.string	"DEFIO_TAG__PC15 defio_error_PC15_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1665:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1822:
+	.string	"targetLooptime"
+.LASF1154:
+	.string	"DEFIO_TAG__PB4 defio_error_PB4_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1100:
+	.string	"DEFIO_TAG__PA2 defio_error_PA2_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"TELEMETRY_FRSKY "
+.LASF1064:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1773:
+	.string	"ACC_BMI160"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF462:
+	.string	"__GNU_LIBRARY__"
+.LASF1467:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1024:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF657:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1720:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1567:
+	.string	"SCHED_OTHER 0"
+.LASF915:
+	.string	"PP_IIF(bit,t,f) PP_IIF_I(bit, t, f)"
+.LASF1363:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"DEFIO_REC__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF827:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1478:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF659:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF495:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1052:
+	.string	"IOCFG_IPU 0"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_E__NONE"
+.LASF402:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1637:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF721:
+	.string	"NULL"
+.LASF784:
+	.string	"U_ID_0 0"
+.LASF1662:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1566:
+	.string	"_BITS_SCHED_H 1"
+.LASF1141:
+	.string	"DEFIO_REC__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF719:
+	.string	"__size_t "
+.LASF1722:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF601:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF868:
+	.string	"__wchar_t__ "
+.LASF1120:
+	.string	"DEFIO_REC__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__PMT"
+.LASF882:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1763:
+	.string	"ACC_MMA8452"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1621:
+	.string	"__LOCK_ALIGNMENT "
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1062:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1488:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF780:
+	.string	"SIMULATOR_BUILD "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1001:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF393:
+	.string	"_STDC_PREDEF_H 1"
+.LASF730:
+	.string	"I2C2_OVERCLOCK true"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF696:
+	.string	"INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1455:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1814:
+	.string	"GYRO_MPU9250"
+.LASF959:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1226:
+	.string	"DEFIO_TAG__PC12 defio_error_PC12_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF521:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1367:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_E__NONE"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_E__NONE"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF575:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1171:
+	.string	"DEFIO_REC__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF932:
+	.string	"UNIT_TESTED "
+.LASF958:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1663:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF676:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF464:
+	.string	"__GLIBC__ 2"
+.LASF1292:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1684:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF663:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1238:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"INT32_MAX (2147483647)"
+.LASF874:
+	.string	"_WCHAR_T_ "
+.LASF1529:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_E__NONE"
+.LASF1071:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF897:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1835:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF478:
+	.string	"__P(args) args"
+.LASF755:
+	.string	"USE_SERVOS "
+.LASF675:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1475:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF653:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF942:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF727:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF705:
+	.string	"_SYS_SIZE_T_H "
+.LASF600:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1132:
+	.string	"DEFIO_REC__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1217:
+	.string	"DEFIO_TAG__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1103:
+	.string	"DEFIO_TAG__PA3 defio_error_PA3_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1381:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1189:
+	.string	"DEFIO_REC__PB15 defio_error_PB15_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF1496:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF426:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1448:
+	.string	"NUM_ARMING_DISABLE_FLAGS 11"
+.LASF743:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1772:
+	.string	"ACC_ICM20689"
+.LASF1312:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_E__NONE"
+.LASF1198:
+	.string	"DEFIO_REC__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1144:
+	.string	"DEFIO_REC__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF1610:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1521:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1011:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1605:
+	.string	"__clockid_t_defined 1"
+.LASF417:
+	.string	"__USE_XOPEN2K8"
+.LASF683:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF953:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1354:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF723:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF388:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF651:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1459:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF455:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF419:
+	.string	"__USE_LARGEFILE"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF579:
+	.string	"__SWORD_TYPE long int"
+.LASF737:
+	.string	"USE_PPM "
+.LASF1123:
+	.string	"DEFIO_REC__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1083:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF485:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF841:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF496:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1539:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF447:
+	.string	"__USE_POSIX199309 1"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF804:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF503:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF976:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1225:
+	.string	"DEFIO_REC__PC11 defio_error_PC11_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF833:
+	.string	"TELEMETRY_HOTT"
+.LASF507:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF669:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF960:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1509:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF484:
+	.string	"__END_DECLS "
+.LASF1571:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF904:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1728:
+	.string	"OWNER_SDCARD"
+.LASF1825:
+	.string	"gyro"
+.LASF1513:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1136:
+	.string	"DEFIO_TAG__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF1795:
+	.string	"baro_noise_lpf"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1412:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF597:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1000:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1552:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF699:
+	.string	"_STRING_H 1"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_E__NONE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1687:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1690:
+	.string	"signed char"
+.LASF477:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1104:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_E__NONE"
+.LASF1372:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"__size_t__ "
+.LASF753:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF449:
+	.string	"__USE_XOPEN2K 1"
+.LASF1643:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF754:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1409:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"_WCHAR_T_H "
+.LASF1355:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF968:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF1241:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF997:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1555:
+	.string	"__time_t_defined 1"
+.LASF569:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1283:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF548:
+	.string	"__stub___compat_bdflush "
+.LASF1650:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1388:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1630:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF403:
+	.string	"_FEATURES_H 1"
+.LASF840:
+	.string	"TELEMETRY_SRXL"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1768:
+	.string	"ACC_MPU9250"
+.LASF522:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1336:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1810:
+	.string	"GYRO_MPU3050"
+.LASF1655:
+	.string	"__cleanup_fct_attribute "
+.LASF506:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF817:
+	.string	"USE_DASHBOARD"
+.LASF757:
+	.string	"TELEMETRY_LTM "
+.LASF1106:
+	.string	"DEFIO_TAG__PA4 defio_error_PA4_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_TAG__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1609:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF593:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1074:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1526:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF713:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF547:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF775:
+	.string	"USE_SPEKTRUM_BIND_PLUG "
+.LASF598:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF849:
+	.string	"SOFTSERIAL_1_TIMER 2"
+.LASF1315:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1261:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF940:
+	.string	"PG_RESET(_name) do { extern const pgRegistry_t _name ##_Registry; pgReset(&_name ## _Registry); } while (0)"
+.LASF1147:
+	.string	"DEFIO_REC__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF850:
+	.string	"SOFTSERIAL_2_TIMER 3"
+.LASF980:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1608:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1683:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF590:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF748:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1657:
+	.string	"pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)"
+.LASF1113:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_E__NONE"
+.LASF1127:
+	.string	"DEFIO_TAG__PA11 defio_error_PA11_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1742:
+	.string	"OWNER_OSD"
+.LASF472:
+	.string	"__LEAF , __leaf__"
+.LASF1646:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1376:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1044:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1518:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1495:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1019:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1078:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1453:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1820:
+	.string	"GYRO_FAKE"
+.LASF537:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1677:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF664:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF741:
+	.string	"USE_SERIALRX_IBUS "
+.LASF792:
+	.string	"USE_TASK_HISTOGRAMS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1468:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1093:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF772:
+	.string	"VTX_SMARTAUDIO "
+.LASF926:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1461:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF982:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF592:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1607:
+	.string	"__itimerspec_defined 1"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_E__NONE"
+.LASF1794:
+	.string	"baro_sample_count"
+.LASF591:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1279:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1084:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1107:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_E__NONE"
+.LASF1531:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1282:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__ptr_t void *"
+.LASF1667:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1771:
+	.string	"ACC_ICM20608G"
+.LASF776:
+	.string	"GPS "
+.LASF1668:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF581:
+	.string	"__SLONG32_TYPE int"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF641:
+	.string	"INT8_MAX (127)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1220:
+	.string	"DEFIO_TAG__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF842:
+	.string	"VTX_COMMON"
+.LASF1796:
+	.string	"baro_cf_vel"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF440:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1065:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF979:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF407:
+	.string	"__USE_ISOCXX11"
+.LASF1358:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF972:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1184:
+	.string	"DEFIO_TAG__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF1491:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1787:
+	.string	"BARO_BMP085"
+.LASF487:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1497:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1076:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF433:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF637:
+	.string	"INT8_MIN (-128)"
+.LASF1032:
+	.string	"PG_SPI_PIN_CONFIG 520"
+.LASF645:
+	.string	"UINT8_MAX (255)"
+.LASF1664:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1718:
+	.string	"OWNER_PINDEBUG"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1399:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF640:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"DEFIO_TAG__PB9 defio_error_PB9_is_not_supported_on_TARGET"
+.LASF1614:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF479:
+	.string	"__PMT(args) args"
+.LASF758:
+	.string	"TELEMETRY_CRSF "
+.LASF861:
+	.string	"_PTRDIFF_T_ "
+.LASF389:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1030:
+	.string	"PG_I2C_CONFIG 518"
+.LASF1126:
+	.string	"DEFIO_REC__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF860:
+	.string	"__PTRDIFF_T "
+.LASF1582:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF1556:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1581:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1597:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF1264:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1150:
+	.string	"DEFIO_REC__PB2 defio_error_PB2_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"DEFIO_REC__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"DEFIO_REC__PA0 defio_error_PA0_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF467:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1635:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF1489:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF913:
+	.string	"EXPAND_I(x) x"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1701:
+	.string	"uint32_t"
+.LASF1550:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF1774:
+	.string	"ACC_FAKE"
+.LASF708:
+	.string	"__SIZE_T "
+.LASF1262:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1273:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1130:
+	.string	"DEFIO_TAG__PA12 defio_error_PA12_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF618:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1640:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF998:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1815:
+	.string	"GYRO_ICM20601"
+.LASF1816:
+	.string	"GYRO_ICM20602"
+.LASF446:
+	.string	"__USE_POSIX2 1"
+.LASF1016:
+	.string	"PG_PID_CONFIG 504"
+.LASF883:
+	.string	"__DEFINED_wchar_t "
+.LASF1343:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1588:
+	.string	"_TIME_H 1"
+.LASF491:
+	.string	"__flexarr []"
+.LASF749:
+	.string	"LED_STRIP "
+.LASF497:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF570:
+	.string	"_BITS_TYPES_H 1"
+.LASF832:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1594:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF658:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1537:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF933:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF493:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF995:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1641:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF871:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF955:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1026:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF781:
+	.string	"SIMULATOR_MULTITHREAD "
+.LASF443:
+	.string	"_POSIX_C_SOURCE"
+.LASF1551:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1719:
+	.string	"OWNER_TIMER"
+.LASF573:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF996:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1331:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1361:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"CONCAT4(_1,_2,_3,_4) CONCAT(CONCAT3(_1, _2, _3), _4)"
+.LASF1193:
+	.string	"DEFIO_TAG__PC1 defio_error_PC1_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1366:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF666:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1463:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF774:
+	.string	"USE_SPEKTRUM_BIND "
+.LASF1697:
+	.string	"char"
+.LASF1615:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1826:
+	.string	"MAG_DEFAULT"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__stub_sigreturn "
+.LASF851:
+	.string	"DEFIO_NO_PORTS "
+.LASF1288:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1049:
+	.string	"IOCFG_AF_PP 0"
+.LASF513:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1118:
+	.string	"DEFIO_TAG__PA8 defio_error_PA8_is_not_supported_on_TARGET"
+.LASF571:
+	.string	"__S16_TYPE short int"
+.LASF1479:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1445:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF963:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1834:
+	.string	"gyroInit"
+.LASF806:
+	.string	"USE_UART2 "
+.LASF1797:
+	.string	"baro_cf_alt"
+.LASF510:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1101:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_E__NONE"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1484:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1039:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF633:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF458:
+	.string	"__USE_ATFILE 1"
+.LASF766:
+	.string	"USE_RX_MSP "
+.LASF1267:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF906:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF397:
+	.string	"true 1"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"DEFIO_REC__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1175:
+	.string	"DEFIO_TAG__PB11 defio_error_PB11_is_not_supported_on_TARGET"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1520:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF605:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1424:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1764:
+	.string	"ACC_BMA280"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF630:
+	.string	"__STD_TYPE"
+.LASF1669:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF616:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF660:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1485:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF588:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF582:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"__need_NULL "
+.LASF729:
+	.string	"I2C1_OVERCLOCK true"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF988:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1833:
+	.string	"compassInit"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1613:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF722:
+	.string	"NULL ((void *)0)"
+.LASF1645:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF967:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1731:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF893:
+	.string	"USART5 ((USART_TypeDef *)0x0005)"
+.LASF911:
+	.string	"STR_HELPER(x) #x"
+.LASF1629:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1219:
+	.string	"DEFIO_REC__PC9 defio_error_PC9_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"CLOCK_TAI 11"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF993:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF844:
+	.string	"VTX_SMARTAUDIO"
+.LASF742:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1723:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF765:
+	.string	"USE_RCSPLIT "
+.LASF1067:
+	.string	"DEFIO_PORT_A_USED_COUNT 0"
+.LASF1715:
+	.string	"OWNER_ADC_RSSI"
+.LASF930:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1330:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1229:
+	.string	"DEFIO_TAG__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF800:
+	.string	"USE_FAKE_BARO "
+.LASF533:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1454:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF518:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1268:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"CLOCK_REALTIME 0"
+.LASF885:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF674:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF859:
+	.string	"_T_PTRDIFF "
+.LASF470:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1632:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1456:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1592:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF794:
+	.string	"USE_FAKE_ACC "
+.LASF1792:
+	.string	"barometerConfig_s"
+.LASF1798:
+	.string	"barometerConfig_t"
+.LASF377:
+	.string	"__linux 1"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1310:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1595:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1196:
+	.string	"DEFIO_TAG__PC2 defio_error_PC2_is_not_supported_on_TARGET"
+.LASF1256:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1142:
+	.string	"DEFIO_TAG__PB0 defio_error_PB0_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF546:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1034:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1627:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1139:
+	.string	"DEFIO_TAG__PA15 defio_error_PA15_is_not_supported_on_TARGET"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1405:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"VTX_CONTROL"
+.LASF1089:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1812:
+	.string	"GYRO_MPU6000"
+.LASF1174:
+	.string	"DEFIO_REC__PB10 defio_error_PB10_is_not_supported_on_TARGET"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1427:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"DEFIO_TAG__PA9 defio_error_PA9_is_not_supported_on_TARGET"
+.LASF486:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1562:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF538:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1216:
+	.string	"DEFIO_REC__PC8 defio_error_PC8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1162:
+	.string	"DEFIO_REC__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF946:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF421:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1777:
+	.string	"ut_delay"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1008:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF732:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1017:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1321:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1702:
+	.string	"double"
+.LASF1512:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF917:
+	.string	"PP_IIF_0(t,f) f"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1511:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1043:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF603:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1726:
+	.string	"OWNER_I2C_SCL"
+.LASF1724:
+	.string	"OWNER_SPI_MISO"
+.LASF1082:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1748:
+	.string	"OWNER_COMPASS_CS"
+.LASF925:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1232:
+	.string	"DEFIO_TAG__PC14 defio_error_PC14_is_not_supported_on_TARGET"
+.LASF1116:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_E__NONE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF956:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF613:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF875:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1656:
+	.ascii	"pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_"
+	.ascii	"t __cancel_buf; void (*__cancel_routine) (void *) = (routine"
+	.ascii	"); void *__cancel"
+	.string	"_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {"
+.LASF1396:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1476:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF900:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF505:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1033:
+	.string	"PG_BETAFLIGHT_END 520"
+.LASF1619:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1694:
+	.string	"__int32_t"
+.LASF1818:
+	.string	"GYRO_ICM20689"
+.LASF1727:
+	.string	"OWNER_I2C_SDA"
+.LASF1695:
+	.string	"__uint32_t"
+.LASF425:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF409:
+	.string	"__USE_POSIX2"
+.LASF1517:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1334:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF973:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF839:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1379:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1530:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1805:
+	.string	"baro"
+.LASF1138:
+	.string	"DEFIO_REC__PA14 defio_error_PA14_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1075:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1414:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF981:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF803:
+	.string	"FAKE_FLASH_FILENAME \"flash.bin\""
+.LASF1051:
+	.string	"IOCFG_IPD 0"
+.LASF416:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1313:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"PG_ESC_SENSOR_CONFIG 517"
+.LASF671:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1259:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF905:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1145:
+	.string	"DEFIO_TAG__PB1 defio_error_PB1_is_not_supported_on_TARGET"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1564:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF872:
+	.string	"_T_WCHAR "
+.LASF1344:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF718:
+	.string	"_SIZET_ "
+.LASF1789:
+	.string	"BARO_BMP280"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1325:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1682:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF764:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF621:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF855:
+	.string	"_STDDEF_H_ "
+.LASF1063:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF452:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1081:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1430:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF586:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1431:
+	.string	"DEFIO_PORT_USED_COUNT 0"
+.LASF1300:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"start_up"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1779:
+	.string	"start_ut"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF693:
+	.string	"UINT16_C(c) c"
+.LASF978:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF679:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1598:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1743:
+	.string	"OWNER_RX_BIND"
+.LASF1007:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF771:
+	.string	"VTX_CONTROL "
+.LASF1319:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1746:
+	.string	"OWNER_TRANSPONDER"
+.LASF974:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1672:
+	.string	"GYRO_CONFIG_USE_GYRO_BOTH 2"
+.LASF410:
+	.string	"__USE_POSIX199309"
+.LASF1516:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF681:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1549:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1165:
+	.string	"DEFIO_REC__PB7 defio_error_PB7_is_not_supported_on_TARGET"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1508:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1111:
+	.string	"DEFIO_REC__PA5 defio_error_PA5_is_not_supported_on_TARGET"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1231:
+	.string	"DEFIO_REC__PC13 defio_error_PC13_is_not_supported_on_TARGET"
+.LASF862:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF873:
+	.string	"__WCHAR_T "
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_E__NONE"
+.LASF1574:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF1808:
+	.string	"GYRO_MPU6050"
+.LASF1575:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF1590:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF442:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1766:
+	.string	"ACC_MPU6000"
+.LASF1119:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_E__NONE"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1086:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF922:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF785:
+	.string	"U_ID_1 1"
+.LASF1791:
+	.string	"baroDev_s"
+.LASF1784:
+	.string	"baroDev_t"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1010:
+	.string	"PG_VTX_RTC6705_CONFIG 259"
+.LASF1522:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF626:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1673:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1733:
+	.string	"OWNER_MPU_CS"
+.LASF1736:
+	.string	"OWNER_SPI_CS"
+.LASF1021:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1649:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1560:
+	.string	"__PDP_ENDIAN 3412"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1378:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF846:
+	.string	"USE_I2C"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1806:
+	.string	"GYRO_NONE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF797:
+	.string	"MAG "
+.LASF1636:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF483:
+	.string	"__BEGIN_DECLS "
+.LASF523:
+	.string	"__restrict_arr __restrict"
+.LASF1316:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF970:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF437:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF619:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1397:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF448:
+	.string	"__USE_POSIX199506 1"
+.LASF1561:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1638:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1620:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF889:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF552:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF524:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1436:
+	.string	"I2CDEV_COUNT 4"
+.LASF957:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF450:
+	.string	"__USE_XOPEN2K8 1"
+.LASF928:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF490:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF744:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1785:
+	.string	"BARO_DEFAULT"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1208:
+	.string	"DEFIO_TAG__PC6 defio_error_PC6_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1712:
+	.string	"OWNER_ADC_BATT"
+.LASF1705:
+	.string	"OWNER_FREE"
+.LASF453:
+	.string	"__WORDSIZE 64"
+.LASF1510:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF620:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF726:
+	.string	"_STRINGS_H 1"
+.LASF1222:
+	.string	"DEFIO_REC__PC10 defio_error_PC10_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF451:
+	.string	"_ATFILE_SOURCE"
+.LASF1462:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1357:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1482:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF461:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF494:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1133:
+	.string	"DEFIO_TAG__PA13 defio_error_PA13_is_not_supported_on_TARGET"
+.LASF1706:
+	.string	"OWNER_PWMINPUT"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1652:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF1659:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1464:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1783:
+	.string	"calculate"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_E__NONE"
+.LASF1493:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF499:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1490:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF931:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1568:
+	.string	"SCHED_FIFO 1"
+.LASF1584:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF1680:
+	.string	"filterGetNotchQApprox(centerFreq,cutoff) ((float)(cutoff * centerFreq) / ((float)(centerFreq - cutoff) * (float)(centerFreq + cutoff)))"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1611:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1168:
+	.string	"DEFIO_REC__PB8 defio_error_PB8_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"DEFIO_REC__PA6 defio_error_PA6_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1533:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF678:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF396:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"___int_ptrdiff_t_h "
+.LASF1765:
+	.string	"ACC_LSM303DLHC"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1471:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF526:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF617:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_E__NONE"
+.LASF887:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1807:
+	.string	"GYRO_DEFAULT"
+.LASF1440:
+	.string	"I2C_ADDR8_MAX 119"
+.LASF1821:
+	.string	"gyro_s"
+.LASF1824:
+	.string	"gyro_t"
+.LASF1418:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF745:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1280:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1558:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1681:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF825:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1402:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF761:
+	.string	"TELEMETRY_MAVLINK "
+.LASF463:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1760:
+	.string	"ACC_NONE"
+.LASF607:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF686:
+	.string	"WINT_MIN (0u)"
+.LASF1047:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1634:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1190:
+	.string	"DEFIO_TAG__PC0 defio_error_PC0_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1729:
+	.string	"OWNER_SDCARD_CS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1534:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1778:
+	.string	"up_delay"
+.LASF1492:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1535:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"__DEFINED_size_t "
+.LASF1079:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1514:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1077:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1762:
+	.string	"ACC_MPU6050"
+.LASF1625:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF805:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1438:
+	.string	"I2C_DEV_TO_CFG(x) ((x) + 1)"
+.LASF1400:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1286:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1186:
+	.string	"DEFIO_REC__PB14 defio_error_PB14_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1545:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1501:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1124:
+	.string	"DEFIO_TAG__PA10 defio_error_PA10_is_not_supported_on_TARGET"
+.LASF1515:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF898:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF892:
+	.string	"USART4 ((USART_TypeDef *)0x0004)"
+.LASF423:
+	.string	"__USE_ATFILE"
+.LASF1022:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1750:
+	.string	"OWNER_RX_BIND_PLUG"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1373:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1628:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF529:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1648:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF1211:
+	.string	"DEFIO_TAG__PC7 defio_error_PC7_is_not_supported_on_TARGET"
+.LASF1097:
+	.string	"DEFIO_TAG__PA1 defio_error_PA1_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"DEFIO_TAG__PB5 defio_error_PB5_is_not_supported_on_TARGET"
+.LASF1689:
+	.string	"long unsigned int"
+.LASF1055:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1745:
+	.string	"OWNER_LED_STRIP"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF903:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF770:
+	.string	"VTX_COMMON "
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF773:
+	.string	"VTX_TRAMP "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF680:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1654:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1306:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF724:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1480:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF606:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_E__NONE"
+.LASF1756:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF965:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF992:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF599:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF807:
+	.string	"USE_UART3 "
+.LASF1579:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF739:
+	.string	"SERIAL_RX "
+.LASF391:
+	.string	"__TARGET__ \"SITL\""
+.LASF1538:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1117:
+	.string	"DEFIO_REC__PA7 defio_error_PA7_is_not_supported_on_TARGET"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF790:
+	.string	"SCHEDULER_DELAY_LIMIT 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF703:
+	.string	"__SIZE_T__ "
+.LASF943:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1056:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF714:
+	.string	"_SIZE_T_DECLARED "
+.LASF595:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF394:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1548:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1732:
+	.string	"OWNER_BARO_CS"
+.LASF489:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF481:
+	.string	"__STRING(x) #x"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF459:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1498:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1688:
+	.string	"unsigned int"
+.LASF414:
+	.string	"__USE_UNIX98"
+.LASF808:
+	.string	"USE_UART4 "
+.LASF1433:
+	.string	"DEFIO_PORT_OFFSET_LIST "
+.LASF1426:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1500:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1563:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1542:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1547:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1364:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1546:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1069:
+	.string	"DEFIO_PORT_B_USED_MASK 0"
+.LASF587:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF465:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1020:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1711:
+	.string	"OWNER_ADC"
+.LASF1691:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1737:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_E__NONE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1759:
+	.string	"ACC_DEFAULT"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1403:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF809:
+	.string	"USE_UART5 "
+.LASF1349:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF583:
+	.string	"__S64_TYPE long int"
+.LASF704:
+	.string	"_SIZE_T "
+.LASF1786:
+	.string	"BARO_NONE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF966:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1714:
+	.string	"OWNER_ADC_EXT"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1013:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1707:
+	.string	"OWNER_PPMINPUT"
+.LASF1483:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF531:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF899:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1734:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1390:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF866:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF948:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1270:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__USE_ISOC95 1"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_E__NONE"
+.LASF1160:
+	.string	"DEFIO_TAG__PB6 defio_error_PB6_is_not_supported_on_TARGET"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1066:
+	.string	"DEFIO_PORT_A_USED_MASK 0"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF810:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1899:
+	.string	"rx_pwm.h"
+.LASF1931:
+	.string	"thread-shared-types.h"
+.LASF1854:
+	.string	"/usr/include"
+.LASF1948:
+	.string	"voltage_ids.h"
+.LASF1869:
+	.string	"stdint.h"
+.LASF1850:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1940:
+	.string	"pthread_stack_min.h"
+.LASF1839:
+	.string	"src/main/build"
+.LASF1851:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1862:
+	.string	"barometer.h"
+.LASF1868:
+	.string	"stdbool.h"
+.LASF1898:
+	.string	"flash.h"
+.LASF1924:
+	.string	"time.h"
+.LASF1873:
+	.string	"wordsize.h"
+.LASF1923:
+	.string	"cpu-set.h"
+.LASF1913:
+	.string	"bus.h"
+.LASF1847:
+	.string	"src/main/target/SITL"
+.LASF1910:
+	.string	"accgyro.h"
+.LASF1930:
+	.string	"pthreadtypes.h"
+.LASF1907:
+	.string	"sound_beeper.h"
+.LASF1902:
+	.string	"io.h"
+.LASF1870:
+	.string	"libc-header-start.h"
+.LASF1928:
+	.string	"timer_t.h"
+.LASF1938:
+	.string	"struct___jmp_buf_tag.h"
+.LASF1887:
+	.string	"platform.h"
+.LASF1855:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1843:
+	.string	"src/main/drivers/barometer"
+.LASF1859:
+	.string	"resource.h"
+.LASF1933:
+	.string	"atomic_wide_counter.h"
+.LASF1927:
+	.string	"clockid_t.h"
+.LASF1867:
+	.string	"stdc-predef.h"
+.LASF1900:
+	.string	"sdcard.h"
+.LASF0:
+	.string	"./src/main/sensors/initialisation.c"
+.LASF1926:
+	.string	"struct_tm.h"
+.LASF1920:
+	.string	"endian.h"
+.LASF1912:
+	.string	"exti.h"
+.LASF1871:
+	.string	"features.h"
+.LASF1890:
+	.string	"utils.h"
+.LASF1880:
+	.string	"time64.h"
+.LASF1936:
+	.string	"setjmp.h"
+.LASF1941:
+	.string	"sonar.h"
+.LASF1841:
+	.string	"src/main/config"
+.LASF1929:
+	.string	"struct_itimerspec.h"
+.LASF1872:
+	.string	"features-time64.h"
+.LASF1886:
+	.string	"strings.h"
+.LASF1891:
+	.string	"feature.h"
+.LASF1842:
+	.string	"src/main/drivers/accgyro"
+.LASF1935:
+	.string	"struct_rwlock.h"
+.LASF1909:
+	.string	"runtime_config.h"
+.LASF1895:
+	.string	"config.h"
+.LASF1877:
+	.string	"stubs.h"
+.LASF1863:
+	.string	"gyro.h"
+.LASF1882:
+	.string	"string.h"
+.LASF1865:
+	.string	"target.h"
+.LASF1903:
+	.string	"io_def.h"
+.LASF1888:
+	.string	"common_fc_pre.h"
+.LASF1894:
+	.string	"parameter_group_ids.h"
+.LASF1881:
+	.string	"wchar.h"
+.LASF1874:
+	.string	"timesize.h"
+.LASF1840:
+	.string	"src/main/common"
+.LASF1947:
+	.string	"voltage.h"
+.LASF1866:
+	.string	"initialisation.c"
+.LASF1945:
+	.string	"current.h"
+.LASF1853:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1949:
+	.string	"initialisation.h"
+.LASF1906:
+	.string	"rcc_types.h"
+.LASF1918:
+	.string	"time_t.h"
+.LASF1861:
+	.string	"acceleration.h"
+.LASF1883:
+	.string	"stddef.h"
+.LASF1944:
+	.string	"filter.h"
+.LASF1845:
+	.string	"src/main/fc"
+.LASF1905:
+	.string	"bus_i2c.h"
+.LASF1878:
+	.string	"stubs-64.h"
+.LASF1892:
+	.string	"parameter_group.h"
+.LASF1939:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF1904:
+	.string	"io_def_generated.h"
+.LASF1946:
+	.string	"current_ids.h"
+.LASF1922:
+	.string	"struct_sched_param.h"
+.LASF1860:
+	.string	"sensors.h"
+.LASF1908:
+	.string	"vcd.h"
+.LASF1915:
+	.string	"accgyro_mpu.h"
+.LASF1921:
+	.string	"endianness.h"
+.LASF1858:
+	.string	"stdint-uintn.h"
+.LASF1925:
+	.string	"clock_t.h"
+.LASF1896:
+	.string	"adc.h"
+.LASF1876:
+	.string	"long-double.h"
+.LASF1943:
+	.string	"battery.h"
+.LASF1875:
+	.string	"cdefs.h"
+.LASF1937:
+	.string	"__sigset_t.h"
+.LASF1879:
+	.string	"typesizes.h"
+.LASF1914:
+	.string	"sensor.h"
+.LASF1942:
+	.string	"sonar_hcsr04.h"
+.LASF1889:
+	.string	"common_fc_post.h"
+.LASF1884:
+	.string	"locale_t.h"
+.LASF1848:
+	.string	"src/main/target"
+.LASF1916:
+	.string	"pthread.h"
+.LASF1911:
+	.string	"axis.h"
+.LASF1844:
+	.string	"src/main/drivers"
+.LASF1901:
+	.string	"serial.h"
+.LASF1919:
+	.string	"struct_timespec.h"
+.LASF1893:
+	.string	"build_config.h"
+.LASF1846:
+	.string	"src/main/sensors"
+.LASF1857:
+	.string	"stdint-intn.h"
+.LASF1885:
+	.string	"__locale_t.h"
+.LASF1856:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1934:
+	.string	"struct_mutex.h"
+.LASF1849:
+	.string	"src/main"
+.LASF1897:
+	.string	"io_types.h"
+.LASF1932:
+	.string	"pthreadtypes-arch.h"
+.LASF1864:
+	.string	"compass.h"
+.LASF1917:
+	.string	"sched.h"
+.LASF1852:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\275\210\307\313\002\004\002"
+	.string	"\002\001\002\002\002\003\004\217\322\265\255\002"
+	.string	"\005\365\246\231\344\006\006\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 \036\305"
+	.string	""
+	.string	"\200\022"
+	.string	"\002"
+	.string	""
+	.string	"\003"
+	.string	"\001\004"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271P6\200\005"
+	.text
+	.section	.gnu.lto_.inline.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 |]\002"
+	.string	"\002\304\r\031\260'\035\214\270\202\021\013\030,\240\f\025@W\206a\nz\241\305\335\344N\001\377\0337\270$L#\\\337y\002\030\350;\364\033\237\301\027l\333\342\323A\245\255=G\002\006"
+	.ascii	"A@u\2231\231\373C-\006\013\306\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 ]M\002"
+	.string	"\264\003Q"
+	.string	"\002\001\300\004\001"
+	.string	"\300\004\001\377\377\377\377\017"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	"\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"9\313\317\263\364n\334\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 .\355"
+	.string	""
+	.string	"\230\""
+	.string	"\002"
+	.string	"\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	"\004"
+	.string	"\004\020"
+	.ascii	"\205\305\017x\303\002"
+	.text
+	.section	.gnu.lto_.lto.178d2297e39b4b22,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.52.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"E\t"
+	.string	"\026\021?9@\305(\035\240\205\346\314'c\002\205\343t\2540A\372g\217\215\201!\027\211\023626\233\034i\366\351\032\200\206\376%\227a62\225\207\345 \306\303\340\340\017F\266\224)\005."
+	.string	"."
+	.string	"/"
+	.string	"q9\316\035\256r\376\200\007:\264\\|\241A\tcu\361:xp\222\032\375t\245\360D\252\002\2329\247\225\344Y\334\327m+\330N\260\215\022\376:\335\r\373pn\311\266\032\252o\331\216\021\212\300d\316\212\026\200\231\272JL\266o\337\343c_lg>\346\n$V\265\032\211\250\314\371\005\037\207;a\033\2565\241\355\340\203\356.\350,\215\326\310\232\013\370.\204\250D\3122T\033\"BO\372f2\272\005\371\247_\246o\2252u\305\001\346`\260Lz6\233d\330H\217\304d\334\264l\303:[\304\344\246!r\264-b\020\2349t\264\350\3112-^\276\320\267\244\373\323!H"
+	.string	"\024\211>\020"
+	.ascii	"\\\b\370\251\031\347\204\301\341\225\240\f@_\250\226\006R^\343"
+	.ascii	"\256\f\241\270&\212!\342\362#{\301pS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.part.0.60.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375`\246\001\205\020"
+	.string	"\006\337nH\340\262(\035B\2728j\274\200\340\f\tVA\257\262\212\244\306\207\315U?\033\027\327S\214\323\212\360\234\375\321\352\351\00226\367\324*8\243M.W\375\266\270,FH\270\025f\370\305\361\016\031\207\236\202\342\233&\204\310\235RU"
+	.string	"\\"
+	.string	"_"
+	.ascii	"\2069\316*5\267\332mwG\367\311\226=\362\311\030{t\357,\214Rj"
+	.ascii	"\331\3652\307\246\203m\243\224b\354*\221\251\217\240\231\235"
+	.ascii	"\334n\t\336\323\023w]g\347\362\347\214\366\272\236\374\211\016"
+	.ascii	"\216\022=xh7\237$\357DVv\327\241\017\267w\333*\266#\330\023@"
+	.ascii	"\032\374\024\367\234\022\347g\367|QE8\330\034\342\223\227\240"
+	.ascii	"\263A@;\201L\305\261v\357Vm\266\247;\221i\375\246\2477}\321\t"
+	.ascii	"\212\221\332\256\315\220 ;\302\363Y\341\242\345\227nC\224\017"
+	.ascii	"l:d\334r\033+\r\224o\001\343\227\2222\307C\213lF\016\227\027"
+	.ascii	"\360\335\013=\300\367\007\277\241`\300O\215\333X\300\200\205"
+	.ascii	"\345\273g7p \323\227\247\252\036\230\021bC8\215\226\320n,\305"
+	.ascii	"\347y\317\004\n..\337\275\251'?w\324\334j\344\210F\342\270\213"
+	.ascii	"L\320\334\250\370\361\325H\246]\301\202\214\276\374\201\3401"
+	.ascii	"2\257\366\t5?\263IL_\2661\034F\030\332\335\024\377\305w\002\316"
+	.ascii	"@\032Q,TJ\034M\027\b\370DR\211!\313\264\n7\230BV\250\n\301\325"
+	.ascii	"(\256T\250\025\250\nM)\3604\256@R\001\213\034P#\310\022\305\021"
+	.ascii	"\034\331\236\357Vm\026\021\243g\376\256\257S\032\333\235z\005"
+	.ascii	"\2462VU\034\333\245\315\001\231L\325\343\356\203`\376\354\302"
+	.ascii	">\263\023\004\" p\"\202\346\316\001\211N\302\020\305x\332\241"
+	.ascii	"\255h\020\304\334\nk\f\204\201k%g\275\375\213\265\300X\236\254"
+	.ascii	"\361\355\300+\345j\271\300\345ma6H\223\r$\257#l\214!\027\377"
+	.ascii	"\306\315\336\322\264\251oOp\264\017\367\013e\2754\026\265\366"
+	.ascii	"\237\200\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\225\004"
+	.string	"\204\006\374"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002<\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\0056\f;\r:\005\0024\177\016\272\200\202\0023\017\201\204\001"
+	.string	"\020\0017\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\0018\177\0229\177\0235\177\024\003"
+	.string	"\t\344\006\003"
+	.string	"\b\244\001\003"
+	.string	"\007d\003\004\nD\003\004"
+	.string	"\310\377\241\372\001\001\202\001"
+	.string	"\021"
+	.string	"8\007\001C\273\206\306\230a\200z"
+	.ascii	"p\370\004\002u)\030\004\303\345\007\246\261\304\023*\310R\035"
+	.ascii	"\001\201\301a\251-O"
+	.text
+	.section	.gnu.lto_.refs.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\002\t"
+	.string	"\002\003\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.178d2297e39b4b22,"e",@progbits
+	.string	"(\265/\375`\247\020\325U"
+	.string	"\212\223\244 S@R:J\007g\212\210Q\300\346f\257l\350N\356g|3\302\031`~'\357\375nZU\230\255\235\267\241\360\033\334\3576~\345"
+	.ascii	"\273K\203\365\035\350h\227Z\315\033\273k6SwWe\313\356\377\375"
+	.ascii	"\276\213\003s\261=\275\253\225\023A;^\232\222&e\n\277\001\360"
+	.ascii	"\001\361\001n6\315\242\331\245\221F\025\245\034\2640\253V\344"
+	.ascii	"\323}\364\302\325\235\256\233-\263jE\301\264\2114\272X]!\251"
+	.ascii	"(\262c\345\250g\310\374\262\325o\232\272:\354r\225%\366\314]"
+	.ascii	"\3008\016(\326_DnT\334|P\253\337\022\271}\333\022\271/Y\375V"
+	.ascii	"\251\337'u\305\354\230U\246X2_\261M\273O0\355\224\267~ \303\222"
+	.ascii	"\244~S\344poo\233\"\367%RA\254\210\\\213\025\201C\t\243\364\212"
+	.ascii	"\n\t\233\377\336\260gBjo\336Da\363\013\366/\355\331\206m\022"
+	.ascii	"\027F\234 M\0209\335\rf\277\254r\317\266\313\327\313\232\335"
+	.ascii	"L\377\342_\372\236\255\226\345\202\013#\2660\353\f\212\030\336"
+	.ascii	"~\240\265u\247*\220T\340\206g\260D\311\231\333+\"\007bC\344n"
+	.ascii	"B\335-;\266\312\244"
+	.string	"-\373fY\260\003\t\323Nv\247F@k\350\2740\306\346K\250CL_\262\033 \3260>\242~\223rF\233\224\273P57\371\257\r\233\336\214\217\335\302\356\026\200u`\203\241\215\315\025[\372b\t\221#\032\3236\302}I\363\261\207M\346\372\345\212\310\rm\210\234\211\025q\345_+\373\225\204\033N\035{\254;=\"\312\263F\312\213\315\247+\"W7D\356_\n\226\200\021D\370\277\346\337\020@\200\340\201\017\376\233y\360o\215\377$\376\247\370\267\203\17778\361\263\b*.H\372\237\373\031\204\177-\370\267\202\177!\370\227\306\2772\376\215\361\357\212\177[\374\253\364\257\002\377\236\370_\366\257\001\377\226\370w\200\177I\374[\364\337\315\377\033\376\203\371\377\365_\304\177\265\377\270\267\267\267\267\177\207~\234\357'\032 \301!\373Ej)D\212K\360\270iw\017@%\225ul\341r\330u\354\356\222\332\321T\f"
+	.ascii	"\323ek\355\022\210\004\253\247|t\217\240\352\006n/\273\033\330"
+	.ascii	"\335?D\254\264\273\b\210!\027\025U\267\021\211\252\261\200g>"
+	.ascii	"\272y\314\315\227\3420\231u\\:\323\222\344\352\037)p\271\272"
+	.ascii	"\r\222X\223\300\260\236\242S\271\212,\314\341\030~\214,\231s"
+	.ascii	"\304\255\362\221\"$Skfx\352\3170p\025\224%r\256\330\254hLg\342"
+	.ascii	"W\311D\3062\201G\302\016\362\300\325m\\ad\205M\230&l\032a6q\216"
+	.ascii	"\314 \247\376\005\017\341\026\270\212\204\324\320\004+#\207\205"
+	.ascii	"u+\002\352F\232\341\352\356m\343!|\265nE\302\264\2133rh#\023"
+	.ascii	"\341\"\253\344!\354\302\271\310V*T\250@Z,n@h\250\346q\313z\334"
+	.ascii	"\230z\034Z=\256K\305\311\300\215U\026\202dJ\001;\036a\3638\260"
+	.ascii	"\372\027t\226-\315\312\317?8\b\017\231\212}0\020^a\225<\265x"
+	.ascii	"\276m\233\347Hw\274\340\\\341\251\265C\305\313\234eK\373\332"
+	.ascii	"\036\364\260\n$\244\206\024\324\001\373\372\227\246\266\316\262"
+	.ascii	"\355\322\230\266\325\007U\212\210\271\362\245\025\006\204\311"
+	.ascii	"\302UC\314r\347\215\2458H\264E\255H\220\201\347\340\320\035\037"
+	.ascii	"{\224lr\343t\370AI\220\315\3339\020\021\030\027\233\264\267\273"
+	.ascii	"1\024!P\354\260\271>\354\236U\036m\177X\2550@-<\025\205\237\243"
+	.ascii	"\345\316p*\256\323\3243\231z>\253\347\261z\016\253g\257\225\263"
+	.ascii	"\366c\225\307\310\0162\324\257r\343\254\231dD\230d\331\371\256"
+	.ascii	"}m\250\373\253\273I\370\240\351z\242d\363\234UMl\2107n\212\234"
+	.ascii	"\020\261\"\303\346\232\335a\333,\017\313f\225"
+	.string	"\353f\325\234\323\3561\0309\224\245\231Y\265]2\251\361\305\345\205\013\030\033\273%\030\224b,AX`T\342\260\311b\246\236(\304+]8\354\246\330\221\b\027\2742c&V\203\330\200\201\361\026\322\021\007\347\013\035\243\327\226\001}\030\262\371\234\261\006\315a\252\362*\374\265b]\005\200\224c\0342I\225\t\235\026\246\260\225\363\027\221\235,K0.\271\034\252\366\350\201S7\214\351\354\345\265\\j\214u\260\2304\206\270\346\325\326D1+\216\234,k\370\252A)\023w-\323\240d\032\270\013\251\315,\"\033,1M4\2560\251P!ckR\271\213}\226\244 \252\343\246\204\310\346\271\013\r\t\335I\2425\034R'l\362\fKg)4\266\220Ta\023\267!r\025\b\323\231K\311\\\2144\203bm\205\216\261\2722\2222\322D\214X\203\2020\235\237|\225\374\204\217\246P\254\201?i\250~\354i\3536\256"
+	.string	"Zs$\316\032\233\367Y\241>I\022\336\312uoz\254\"\266\221\230$d\305\304Y\214\344\254\204\233\374Jx\253\002\273\201iW-\024\"\033\254\2666\032\223\214x(\003\266\361\026k\001E\221\2225\305&k13a\031\316Z\274\344.`|H\310Zfwp\367D\321\356\t\0374'A,9\363\346\262\336\364RoN\251\347?\327Abw[\371\244M\224\032\372\372,\321\342\026\305\177\263\373Gz\352\006j\341\252S\245\230\005\215\230\350\373,\211\303$\022X\003Y\024\"\207\f\223\310\006\n\237"
+	.string	"\217\210\215\004\016\223\335G-\024\002o\034\373h\230\354b\253\200\246\270\235\"\201-<\366Q\013;hb(D\026\207\311`\361h\230D\026;\211l\020-\f\022\201\b\233x\324I$['\217E\020\303\344\2618L\"\215\333d\210FO1\013WV\220\005\016\205-\204\n+H\004\261\034\246\307n\323\275c>\232\210\242\033\353Hl\023F\247n\350F\320w(\225\370\375vP<z<\241\357p:y\274\035\n\264\351\251\002\036o\367\363\035J\027tP\001\007,L\230\300\3539\3318}=\033F\034\3408\215v\367&\217\023\375\245\300A"
+	.string	"\346\021p\352\365$\320\371\034\265PB};(%\224w\242'\216\036\032\025\001\322yM\276\363\351\324Q\317@\214\005b\310@\341\3472f\264\230\321\"w\0313\226\226f\304X\252\217\261\204C\321\323\027\205\356|'\024\217\263\003\243\237.\327\343\304\201C\235\"\350\371v\022\374\230\350\331\243\311\207#\001\033"
+	.string	"\374\234\350\316)\212\347\264\343\001\375t=\316\033@hTMa\347t\342\320AEU\024\365\355\320_\365\241\032\360\236\242&\200\312"
+	.ascii	"*J\207\236:r\337\241d\300O\247\243)\307S\317\206\357DO\036\247"
+	.ascii	"ow\002\016\337n\007\021\252\223\361\203>E\365x\272\323\t\212"
+	.ascii	"\307\356w\224\003\312Iw\376\232zOENg\017T\027c\tu\332\351r\360"
+	.ascii	"t=\337\256\004\241\357P\032\361\036\324\351c\201\366z>\026B?"
+	.ascii	"]\016\325\271x\201>5E\325\347\330\301h\300E\016\007vJ#\356\200"
+	.ascii	"\0036Lx\200\001S\345)=\365\232\320\335\257\311i\327\2046=5\261"
+	.ascii	"\370\371z\277\247\363\307\342\251i\307\203\005\317\367c\241t"
+	.ascii	"\300\311\243\t\205\352\365.@O\035\276\035Z\224\303\306\215\b"
+	.ascii	"z\276\024tT5\254!3o\356L!C\246\246\213\361\b\233\351\327PU\325"
+	.ascii	"\326Q\f#\215\344\271\272\023\346\253\3151\311T\332\321\203\261"
+	.ascii	"+ih8\3242L\316\212\351\030[\030\034$\233B0x\341\033\2740\030"
+	.ascii	"\240 \2561\306\026\222\300\234\225\005\357"
+	.string	"P\235}\001\262:S\266\202\031\307\220\372\330pL\202\307l\325\274\021\031+\222\246v\331\222`\316T\0226\205~\224\225\245!\373\261\307\364Rb)C\246\006\215\245O\231l\305\nxcu\225\201\233\037z\306\316dE]O\316\276\330\344$o\361\321\"$K\313\026-Ag\\\246\260\261\020\242\035\336P\r\331\314\262x\376?\201:\250\2010\207\0244#3\"#2\222$\351\021\005\204(*\2413\017\021 1\244\206h$I\n\205e7\326>\201gk\223\240\206=\"a\301Z\223"
+	.string	"W\264\034\316\r\t\005\217\222\021\201u\304\367\362Lj\245p=WJ\222\346\027\037\025\364/u\375\244U\2506?b\247\377\004\026\201H\340Q\005h\\\321\202\350\032\263\262\3072\236\373LB\361\375q`\032\275\261]T!Q\217\2736?\201\2764F\305\363\350\220\200 \321\352y\277\304oF\244\0222\302\2246<\247\003\300\031x\254\020\250\3214\357\r\013"
+	.ascii	"\353B\307X\300\371.L\331\241\311\005\002\367\213\204z\362\f4"
+	.ascii	"\177\236\237\311\\\315\353\357\366\272\311ESD\337X\327y\316\334"
+	.ascii	"\252ye/\364\017 7\200i\337s\215\354]&7\362H\257\032\205\270R"
+	.ascii	"6\262f!\223]u\n\340O:\262\224\371\307\344\006\275\002\232B\f"
+	.ascii	"\200`\336-\006\257w\340\036\177\210\224OP\206,\275h0\007\217"
+	.ascii	"\r\346a7\"\320\263&;k-\333\245\373\003\312\030O\351p\337\356"
+	.ascii	"\005^p\202\037\267vy\016\b\246\303\017\r&\235i \205\033r\025"
+	.ascii	"\301\230G\345\244s\205\303#\362\304\037\021\205#\"\265\227\207"
+	.ascii	"\273\226W\301\265\313\354\007\322\205\027d'\227\261\346J,\252"
+	.ascii	"\205\220\312t\275\206\223*\026\312\221Q\324\036\347&Ib1\304\373"
+	.ascii	"\317\261\325RJ\255\351\266\3453\301\032\325L\247bU@H\035\200"
+	.ascii	"\347PYz\227\253\016 \314\035\025\355OI3\350f\"\203\3606\240\311"
+	.ascii	"?\323\355\257\266\303X@\272r\344\316)DWVDe!\001I\001\212\250"
+	.ascii	"F\026\346/C#\230\323v\320\243\2321\322[r\253\270{\363\237iB\340"
+	.ascii	"\336({\203\333\243\326j\002\024\316[)\274\372(!\033=\202\027"
+	.ascii	"\177Mm1\337B\002D\005\007\f\330E\036\263\230x\004\374\337\373"
+	.ascii	"\332\242\205\270\343\r\235\210_gr\321\304\004\227\325\265?\f"
+	.ascii	"\032\345\177&\256\201\005\"\256\bpI\200w\322\\-^\232\324\321"
+	.ascii	"0\340#\252\312\002\360\312\324\032\217\344\210\310\307\363\362"
+	.ascii	"_\376\272\365e\3040\317\004\221\205\333\366c\276\264\344u\354"
+	.ascii	"?[\200\273T\266\232\224\304\350\215s\327\017\007\020\241\356"
+	.ascii	"\225\245\001\274\3118\002\254 \201?\314\3241\216\214\240\371"
+	.ascii	"\375=\376s\275\361\345pu\267\031\355\333\266\315\f<\234\302\231"
+	.ascii	"a\343\345\300\177p\260f\310WHW\001"
+	.text
+	.section	.gnu.lto_.symtab.178d2297e39b4b22,"e",@progbits
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.178d2297e39b4b22,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits